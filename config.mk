@@ -10,9 +10,25 @@
 # C++ compiler
 CXX=g++
 
-# Flags for the C++ compiler
+# MPI C++ compiler wrapper, only used for the examples that use domain_mpi.hh
+MPICXX=mpicxx
+
+# Flags for the C++ compiler. Adding -DVOROPP_SINGLE_PRECISION stores the particle and vertex positions in single
+# precision, which must then also be used when compiling any program that
+# includes the library headers. Adding -march=native allows the compiler to
+# use wider vector instructions, which mainly benefits the batch point_inside
+# routines of the walls. Adding -DVOROPP_COUNTERS=1 switches on the counting
+# of events in the cell computation, which can be read with the
+# total_counters() routine of the containers.
 CFLAGS=-Wall -ansi -pedantic -O3
 
+# The multithreaded routines use OpenMP, which is enabled by typing
+# "make OPENMP=1". Any program that links to a library built in this way must
+# also be compiled with the -fopenmp flag.
+ifeq ($(OPENMP),1)
+CFLAGS+=-fopenmp
+endif
+
 # Relative include and library paths for compilation of the examples
 E_INC=-I../../src
 E_LIB=-L../../src
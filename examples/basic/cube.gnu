@@ -0,0 +1,24 @@
+1 -1 -1
+1 1 -1
+-1 1 -1
+-1 -1 -1
+1 -1 -1
+1 -1 1
+-1 -1 1
+-1 1 1
+1 1 1
+1 -1 1
+
+
+-1 1 -1
+-1 1 1
+
+
+1 1 -1
+1 1 1
+
+
+-1 -1 1
+-1 -1 -1
+
+
@@ -0,0 +1,66 @@
+-1.11022e-16 0.427051 1.11803
+-1.11022e-16 -0.427051 1.11803
+-0.690983 -0.690983 0.690983
+-0.427051 -1.11803 0
+-0.690983 -0.690983 -0.690983
+-1.11803 5.55112e-17 -0.427051
+-1.11803 5.55112e-17 0.427051
+-0.690983 -0.690983 0.690983
+
+
+-1.11022e-16 0.427051 1.11803
+0.690983 0.690983 0.690983
+0.427051 1.11803 0
+0.690983 0.690983 -0.690983
+1.11803 -1.11022e-16 -0.427051
+0.690983 -0.690983 -0.690983
+0.427051 -1.11803 0
+0.690983 -0.690983 0.690983
+1.11803 -1.11022e-16 0.427051
+1.11803 -1.11022e-16 -0.427051
+
+
+-1.11022e-16 0.427051 1.11803
+-0.690983 0.690983 0.690983
+-1.11803 5.55112e-17 0.427051
+
+
+-1.11022e-16 -0.427051 1.11803
+0.690983 -0.690983 0.690983
+
+
+-1.11022e-16 -0.427051 -1.11803
+-1.11022e-16 0.427051 -1.11803
+-0.690983 0.690983 -0.690983
+-0.427051 1.11803 0
+-0.690983 0.690983 0.690983
+
+
+-1.11022e-16 -0.427051 -1.11803
+0.690983 -0.690983 -0.690983
+
+
+-1.11022e-16 -0.427051 -1.11803
+-0.690983 -0.690983 -0.690983
+
+
+-1.11022e-16 0.427051 -1.11803
+0.690983 0.690983 -0.690983
+
+
+0.427051 1.11803 0
+-0.427051 1.11803 0
+
+
+-0.690983 0.690983 -0.690983
+-1.11803 5.55112e-17 -0.427051
+
+
+0.690983 0.690983 0.690983
+1.11803 -1.11022e-16 0.427051
+
+
+0.427051 -1.11803 0
+-0.427051 -1.11803 0
+
+
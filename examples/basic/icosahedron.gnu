@@ -0,0 +1,51 @@
+-0.572949 -3.18051e-17 -0.927051
+-0.927051 0.572949 1.66533e-16
+-1.11022e-16 0.927051 -0.572949
+0.927051 0.572949 1.66533e-16
+-1.11022e-16 0.927051 0.572949
+-1.11022e-16 0.927051 -0.572949
+0.572949 -3.18051e-17 -0.927051
+0.927051 -0.572949 1.66533e-16
+-1.11022e-16 -0.927051 -0.572949
+-1.11022e-16 -0.927051 0.572949
+0.927051 -0.572949 1.66533e-16
+0.927051 0.572949 1.66533e-16
+0.572949 -3.18051e-17 0.927051
+-1.11022e-16 0.927051 0.572949
+-0.927051 0.572949 1.66533e-16
+-0.927051 -0.572949 1.66533e-16
+-1.11022e-16 -0.927051 0.572949
+0.572949 -3.18051e-17 0.927051
+-0.572949 -3.18051e-17 0.927051
+-0.927051 -0.572949 1.66533e-16
+-0.572949 -3.18051e-17 -0.927051
+-1.11022e-16 0.927051 -0.572949
+
+
+-0.572949 -3.18051e-17 -0.927051
+0.572949 -3.18051e-17 -0.927051
+-1.11022e-16 -0.927051 -0.572949
+-0.927051 -0.572949 1.66533e-16
+
+
+-0.572949 -3.18051e-17 -0.927051
+-1.11022e-16 -0.927051 -0.572949
+
+
+-0.927051 0.572949 1.66533e-16
+-0.572949 -3.18051e-17 0.927051
+-1.11022e-16 -0.927051 0.572949
+
+
+0.572949 -3.18051e-17 -0.927051
+0.927051 0.572949 1.66533e-16
+
+
+-1.11022e-16 0.927051 0.572949
+-0.572949 -3.18051e-17 0.927051
+
+
+0.927051 -0.572949 1.66533e-16
+0.572949 -3.18051e-17 0.927051
+
+
@@ -0,0 +1,15 @@
+-1.11022e-16 1.5 1.66533e-16
+-1.5 -8.32667e-17 1.66533e-16
+-1.11022e-16 -1.5 1.66533e-16
+-1.11022e-16 0 -1.5
+-1.5 -8.32667e-17 1.66533e-16
+-1.11022e-16 0 1.5
+-1.11022e-16 -1.5 1.66533e-16
+1.5 -8.32667e-17 1.66533e-16
+-1.11022e-16 0 -1.5
+-1.11022e-16 1.5 1.66533e-16
+-1.11022e-16 0 1.5
+1.5 -8.32667e-17 1.66533e-16
+-1.11022e-16 1.5 1.66533e-16
+
+
@@ -0,0 +1,54 @@
+// Two-dimensional Voronoi calculation example code
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+#include "voro++.hh"
+using namespace voro;
+
+// Set up constants for the container geometry
+const double x_min=-1,x_max=1;
+const double y_min=-1,y_max=1;
+const double carea=(x_max-x_min)*(y_max-y_min);
+
+// Set up the number of blocks that the container is divided into
+const int n_x=6,n_y=6;
+
+// Set the number of particles that are going to be randomly introduced
+const int particles=100;
+
+// This function returns a random double between 0 and 1
+double rnd() {return double(rand())/RAND_MAX;}
+
+int main() {
+	int i;
+	double x,y;
+
+	// Create a two-dimensional container with the geometry given above,
+	// and make it non-periodic in both coordinates. Allocate space for
+	// eight particles within each computational block
+	container_2d con(x_min,x_max,y_min,y_max,n_x,n_y,false,false,8);
+
+	// Randomly add particles into the container
+	for(i=0;i<particles;i++) {
+		x=x_min+rnd()*(x_max-x_min);
+		y=y_min+rnd()*(y_max-y_min);
+		con.put(i,x,y);
+	}
+
+	// Sum up the areas, and check that this matches the container area
+	double varea=con.sum_cell_areas();
+	printf("Container area : %g\n"
+	       "Voronoi area   : %g\n"
+	       "Difference     : %g\n",carea,varea,varea-carea);
+
+	// Output the particle positions in gnuplot format
+	con.draw_particles("random_points_2d_p.gnu");
+
+	// Output the Voronoi cells in gnuplot format
+	con.draw_cells_gnuplot("random_points_2d_v.gnu");
+
+	// Output the particle IDs, the cell areas, and the neighbors
+	con.print_custom("%i %a %n","random_points_2d.vol");
+}
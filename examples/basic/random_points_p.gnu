@@ -0,0 +1,20 @@
+8 -0.686642 -0.198111 -0.740419
+19 -0.959954 -0.0845965 -0.873808
+18 0.780465 -0.302214 -0.871657
+6 -0.716795 0.213938 -0.967399
+2 -0.329554 0.536459 -0.444451
+9 -0.782382 0.997849 -0.563486
+12 -0.012834 0.94555 -0.414966
+14 -0.199543 0.783059 -0.433371
+1 0.59688 0.823295 -0.604897
+17 -0.827888 -0.615572 0.326454
+3 0.10794 -0.0452059 0.257742
+11 -0.407937 0.275105 0.0485744
+16 -0.860489 0.898654 0.0519907
+10 0.0258648 0.678224 0.22528
+7 -0.514226 -0.725537 0.608354
+0 0.680375 -0.211234 0.566198
+13 0.542715 0.05349 0.539828
+5 0.83239 0.271423 0.434594
+4 -0.270431 0.0268018 0.904459
+15 -0.295083 0.615449 0.838053
@@ -0,0 +1,936 @@
+0.0563538 0.0268561 -0.920227
+0.0460461 -0.0178417 -1
+-0.0236458 -1 -1
+0.0332809 -1 -0.363618
+0.0792065 -0.140755 -0.531802
+0.0563538 0.0268561 -0.920227
+-0.8666 0.257453 -0.379002
+-0.700553 -0.0724766 -1
+0.0460461 -0.0178417 -1
+
+
+-1 0.111557 -0.229826
+-0.877548 0.254686 -0.358925
+-0.8666 0.257453 -0.379002
+
+
+-1 0.111557 -0.229826
+-1 -0.793461 -1
+-0.700553 -0.0724766 -1
+
+
+-1 0.111557 -0.229826
+-1 -0.083741 -0.112692
+-1 -1 -0.471218
+-1 -1 -1
+-0.0236458 -1 -1
+
+
+-0.0553779 -1 -0.346157
+-0.0554729 -0.902285 -0.307934
+0.0241111 -1 -0.356318
+-0.0553779 -1 -0.346157
+-1 -1 -0.471218
+
+
+-1 -0.083741 -0.112692
+-0.348201 -0.40313 -0.151373
+-0.0590153 -0.116392 -0.425503
+0.0792065 -0.140755 -0.531802
+
+
+-1 -0.793461 -1
+-1 -1 -1
+
+
+-0.348201 -0.40313 -0.151373
+-0.0554729 -0.902285 -0.307934
+
+
+-0.877548 0.254686 -0.358925
+-0.0590153 -0.116392 -0.425503
+
+
+0.0332809 -1 -0.363618
+0.0241111 -1 -0.356318
+
+
+-1 0.111557 -0.229826
+-1 0.32339 -0.312434
+-1 0.371094 -0.363099
+-0.986042 0.362212 -0.355165
+-0.979339 0.338485 -0.330686
+-1 0.32339 -0.312434
+
+
+-1 0.111557 -0.229826
+-1 -0.793461 -1
+-1 0.171425 -1
+-0.700553 -0.0724766 -1
+-0.8666 0.257453 -0.379002
+-0.877548 0.254686 -0.358925
+-1 0.111557 -0.229826
+
+
+-1 0.171425 -1
+-1 0.371094 -0.363099
+
+
+-1 -0.793461 -1
+-0.700553 -0.0724766 -1
+
+
+-0.986042 0.362212 -0.355165
+-0.8666 0.257453 -0.379002
+
+
+-0.877548 0.254686 -0.358925
+-0.979339 0.338485 -0.330686
+
+
+1 -1 -1
+1 0.373353 -1
+1 0.213816 -0.326884
+1 -0.220232 -0.136273
+0.702153 -0.133572 -0.16249
+0.61137 0.138975 -0.278569
+1 0.213816 -0.326884
+
+
+1 -1 -1
+1 -1 -0.0869333
+0.431467 -1 -0.126509
+0.0332809 -1 -0.363618
+-0.0236458 -1 -1
+0.0460461 -0.0178417 -1
+0.0914982 0.114006 -1
+0.0563538 0.0268561 -0.920227
+0.0460461 -0.0178417 -1
+
+
+1 -1 -1
+-0.0236458 -1 -1
+
+
+0.315656 0.132105 -0.453095
+0.0792065 -0.140755 -0.531802
+0.0332809 -1 -0.363618
+
+
+0.315656 0.132105 -0.453095
+0.61137 0.138975 -0.278569
+
+
+0.315656 0.132105 -0.453095
+0.187289 0.24079 -1
+1 0.373353 -1
+
+
+0.702153 -0.133572 -0.16249
+0.431467 -1 -0.126509
+
+
+1 -1 -0.0869333
+1 -0.220232 -0.136273
+
+
+0.187289 0.24079 -1
+0.0914982 0.114006 -1
+
+
+0.0792065 -0.140755 -0.531802
+0.0563538 0.0268561 -0.920227
+
+
+0.0563538 0.0268561 -0.920227
+0.0914982 0.114006 -1
+0.0460461 -0.0178417 -1
+0.0563538 0.0268561 -0.920227
+-0.8666 0.257453 -0.379002
+-0.986042 0.362212 -0.355165
+-1 0.371094 -0.363099
+-1 0.381094 -0.369816
+-0.984848 0.38135 -0.367852
+-0.986042 0.362212 -0.355165
+
+
+-1 0.705799 -1
+-0.440385 0.75262 -1
+-0.984848 0.38135 -0.367852
+
+
+-1 0.705799 -1
+-1 0.171425 -1
+-1 0.371094 -0.363099
+
+
+-1 0.705799 -1
+-1 0.381094 -0.369816
+
+
+-0.440385 0.75262 -1
+0.0914982 0.114006 -1
+
+
+-1 0.171425 -1
+-0.700553 -0.0724766 -1
+0.0460461 -0.0178417 -1
+
+
+-0.700553 -0.0724766 -1
+-0.8666 0.257453 -0.379002
+
+
+-0.877548 0.254686 -0.358925
+-0.8666 0.257453 -0.379002
+-0.986042 0.362212 -0.355165
+-0.979339 0.338485 -0.330686
+-0.877548 0.254686 -0.358925
+-0.0590153 -0.116392 -0.425503
+0.0792065 -0.140755 -0.531802
+0.315656 0.132105 -0.453095
+0.187289 0.24079 -1
+0.0914982 0.114006 -1
+0.0563538 0.0268561 -0.920227
+0.0792065 -0.140755 -0.531802
+
+
+-0.440385 0.75262 -1
+-0.984848 0.38135 -0.367852
+-0.575175 0.814859 -0.245995
+-0.435338 0.731688 -0.0357608
+-0.979339 0.338485 -0.330686
+
+
+-0.440385 0.75262 -1
+-0.423778 0.768918 -1
+-0.575175 0.814859 -0.245995
+
+
+-0.440385 0.75262 -1
+0.0914982 0.114006 -1
+
+
+0.271194 0.370342 -0.283921
+0.111081 0.486931 -1
+0.187289 0.24079 -1
+
+
+0.271194 0.370342 -0.283921
+-0.269061 0.644903 -0.0553307
+-0.435338 0.731688 -0.0357608
+
+
+0.271194 0.370342 -0.283921
+0.287764 0.318091 -0.281654
+0.315656 0.132105 -0.453095
+
+
+-0.269061 0.644903 -0.0553307
+0.100343 0.301449 -0.178669
+0.287764 0.318091 -0.281654
+
+
+0.0563538 0.0268561 -0.920227
+-0.8666 0.257453 -0.379002
+
+
+-0.0590153 -0.116392 -0.425503
+0.100343 0.301449 -0.178669
+
+
+0.111081 0.486931 -1
+-0.423778 0.768918 -1
+
+
+-0.986042 0.362212 -0.355165
+-0.984848 0.38135 -0.367852
+
+
+-0.338619 1 -1
+-0.423778 0.768918 -1
+-0.440385 0.75262 -1
+-1 0.705799 -1
+-1 0.381094 -0.369816
+-0.984848 0.38135 -0.367852
+-0.440385 0.75262 -1
+
+
+-0.338619 1 -1
+-1 1 -1
+-1 0.705799 -1
+
+
+-0.338619 1 -1
+-0.515304 1 -0.208558
+-0.575175 0.814859 -0.245995
+-0.984848 0.38135 -0.367852
+
+
+-1 1 -1
+-1 1 -0.270068
+-0.515304 1 -0.208558
+
+
+-0.423778 0.768918 -1
+-0.575175 0.814859 -0.245995
+
+
+-1 0.381094 -0.369816
+-1 1 -0.270068
+
+
+-0.266112 1 0.000178962
+0.460422 1 -0.0437354
+0.270522 0.414738 -0.276625
+-0.266112 1 0.000178962
+-0.167523 1 -1
+0.162538 1 -1
+0.100732 0.691764 -1
+0.270522 0.414738 -0.276625
+
+
+0.100732 0.691764 -1
+-0.167523 1 -1
+
+
+0.162538 1 -1
+0.460422 1 -0.0437354
+
+
+-0.342758 1 0.0264093
+-0.399273 0.757628 0.00717305
+-0.435338 0.731688 -0.0357608
+-0.575175 0.814859 -0.245995
+-0.515304 1 -0.208558
+-0.342758 1 0.0264093
+-0.266112 1 0.000178962
+0.270522 0.414738 -0.276625
+0.100732 0.691764 -1
+0.111081 0.486931 -1
+0.271194 0.370342 -0.283921
+0.270522 0.414738 -0.276625
+
+
+-0.266112 1 0.000178962
+-0.167523 1 -1
+0.100732 0.691764 -1
+
+
+0.111081 0.486931 -1
+-0.423778 0.768918 -1
+-0.338619 1 -1
+-0.515304 1 -0.208558
+
+
+-0.435338 0.731688 -0.0357608
+-0.269061 0.644903 -0.0553307
+0.271194 0.370342 -0.283921
+
+
+-0.338619 1 -1
+-0.167523 1 -1
+
+
+-0.423778 0.768918 -1
+-0.575175 0.814859 -0.245995
+
+
+-0.269061 0.644903 -0.0553307
+-0.399273 0.757628 0.00717305
+
+
+1 0.373353 -1
+0.187289 0.24079 -1
+0.315656 0.132105 -0.453095
+0.287764 0.318091 -0.281654
+0.486582 0.34701 -0.139849
+0.61137 0.138975 -0.278569
+0.315656 0.132105 -0.453095
+
+
+1 0.373353 -1
+1 1 -1
+0.162538 1 -1
+0.460422 1 -0.0437354
+0.740925 1 0.149201
+1 1 0.0905046
+1 0.213816 -0.326884
+0.61137 0.138975 -0.278569
+
+
+1 0.373353 -1
+1 0.213816 -0.326884
+
+
+0.162538 1 -1
+0.100732 0.691764 -1
+0.270522 0.414738 -0.276625
+0.460422 1 -0.0437354
+
+
+1 1 -1
+1 1 0.0905046
+
+
+0.111081 0.486931 -1
+0.271194 0.370342 -0.283921
+0.270522 0.414738 -0.276625
+
+
+0.111081 0.486931 -1
+0.100732 0.691764 -1
+
+
+0.111081 0.486931 -1
+0.187289 0.24079 -1
+
+
+0.740925 1 0.149201
+0.486582 0.34701 -0.139849
+
+
+0.271194 0.370342 -0.283921
+0.287764 0.318091 -0.281654
+
+
+-0.0553779 -1 -0.346157
+-0.0554729 -0.902285 -0.307934
+-0.348201 -0.40313 -0.151373
+-1 -0.083741 -0.112692
+-1 -1 -0.471218
+-0.0553779 -1 -0.346157
+-1 -1 0.704898
+-1 -0.247682 0.998365
+-1 0.131441 0.577022
+-0.437369 -0.191246 0.393015
+-0.436827 -0.192085 0.393426
+-1 -0.247682 0.998365
+
+
+-1 -0.083741 -0.112692
+-1 0.131441 0.577022
+
+
+-0.437369 -0.191246 0.393015
+-0.348201 -0.40313 -0.151373
+
+
+-1 -1 0.704898
+-1 -1 -0.471218
+
+
+-0.436827 -0.192085 0.393426
+-0.0554729 -0.902285 -0.307934
+
+
+0.702153 -0.133572 -0.16249
+0.61137 0.138975 -0.278569
+0.315656 0.132105 -0.453095
+0.0792065 -0.140755 -0.531802
+-0.0590153 -0.116392 -0.425503
+-0.348201 -0.40313 -0.151373
+-0.0554729 -0.902285 -0.307934
+0.0241111 -1 -0.356318
+0.0332809 -1 -0.363618
+0.0792065 -0.140755 -0.531802
+
+
+0.702153 -0.133572 -0.16249
+0.677636 -0.109983 -0.104294
+0.417457 0.351512 0.135249
+0.103124 0.337805 0.624523
+-0.166924 0.30065 0.479276
+0.100343 0.301449 -0.178669
+-0.0590153 -0.116392 -0.425503
+
+
+0.702153 -0.133572 -0.16249
+0.431467 -1 -0.126509
+0.295653 -1 0.125537
+0.0241111 -1 -0.356318
+
+
+0.103124 0.337805 0.624523
+0.0939152 0.311697 0.647851
+-0.182465 0.282251 0.48943
+-0.166924 0.30065 0.479276
+
+
+0.431467 -1 -0.126509
+0.0332809 -1 -0.363618
+
+
+0.295653 -1 0.125537
+0.104908 -0.506143 0.745343
+0.161715 -0.292687 0.754813
+0.677636 -0.109983 -0.104294
+
+
+0.61137 0.138975 -0.278569
+0.486582 0.34701 -0.139849
+0.287764 0.318091 -0.281654
+0.315656 0.132105 -0.453095
+
+
+0.486582 0.34701 -0.139849
+0.417457 0.351512 0.135249
+
+
+0.0939152 0.311697 0.647851
+0.161715 -0.292687 0.754813
+
+
+-0.437369 -0.191246 0.393015
+-0.436827 -0.192085 0.393426
+0.104908 -0.506143 0.745343
+
+
+-0.437369 -0.191246 0.393015
+-0.182465 0.282251 0.48943
+
+
+-0.437369 -0.191246 0.393015
+-0.348201 -0.40313 -0.151373
+
+
+0.287764 0.318091 -0.281654
+0.100343 0.301449 -0.178669
+
+
+-0.0554729 -0.902285 -0.307934
+-0.436827 -0.192085 0.393426
+
+
+-1 0.131441 0.577022
+-0.437369 -0.191246 0.393015
+-0.348201 -0.40313 -0.151373
+-1 -0.083741 -0.112692
+-1 0.131441 0.577022
+-1 0.262173 0.614949
+-1 0.318442 0.590692
+-0.482668 0.6952 0.35432
+-0.166924 0.30065 0.479276
+-0.182465 0.282251 0.48943
+-1 0.262173 0.614949
+
+
+-0.877548 0.254686 -0.358925
+-0.979339 0.338485 -0.330686
+-1 0.32339 -0.312434
+-1 0.111557 -0.229826
+-0.877548 0.254686 -0.358925
+-0.0590153 -0.116392 -0.425503
+0.100343 0.301449 -0.178669
+-0.166924 0.30065 0.479276
+
+
+0.100343 0.301449 -0.178669
+-0.269061 0.644903 -0.0553307
+-0.399273 0.757628 0.00717305
+-0.435338 0.731688 -0.0357608
+-0.269061 0.644903 -0.0553307
+
+
+-0.437369 -0.191246 0.393015
+-0.182465 0.282251 0.48943
+
+
+-1 0.318442 0.590692
+-1 0.32339 -0.312434
+
+
+-0.0590153 -0.116392 -0.425503
+-0.348201 -0.40313 -0.151373
+
+
+-0.482668 0.6952 0.35432
+-0.399273 0.757628 0.00717305
+
+
+-1 0.111557 -0.229826
+-1 -0.083741 -0.112692
+
+
+-0.979339 0.338485 -0.330686
+-0.435338 0.731688 -0.0357608
+
+
+-0.342758 1 0.0264093
+-0.399273 0.757628 0.00717305
+-0.435338 0.731688 -0.0357608
+-0.575175 0.814859 -0.245995
+-0.984848 0.38135 -0.367852
+-1 0.381094 -0.369816
+-1 0.371094 -0.363099
+-1 0.32339 -0.312434
+-0.979339 0.338485 -0.330686
+-0.986042 0.362212 -0.355165
+-1 0.371094 -0.363099
+
+
+-0.342758 1 0.0264093
+-0.515304 1 -0.208558
+-0.575175 0.814859 -0.245995
+
+
+-0.342758 1 0.0264093
+-0.419446 1 0.418659
+-0.482668 0.6952 0.35432
+-1 0.318442 0.590692
+-1 1 0.836246
+-0.419446 1 0.418659
+
+
+-1 1 -0.270068
+-1 0.381094 -0.369816
+
+
+-1 1 -0.270068
+-1 1 0.836246
+
+
+-1 1 -0.270068
+-0.515304 1 -0.208558
+
+
+-0.979339 0.338485 -0.330686
+-0.435338 0.731688 -0.0357608
+
+
+-0.482668 0.6952 0.35432
+-0.399273 0.757628 0.00717305
+
+
+-1 0.318442 0.590692
+-1 0.32339 -0.312434
+
+
+-0.984848 0.38135 -0.367852
+-0.986042 0.362212 -0.355165
+
+
+0.287764 0.318091 -0.281654
+0.486582 0.34701 -0.139849
+0.740925 1 0.149201
+0.460422 1 -0.0437354
+0.270522 0.414738 -0.276625
+0.271194 0.370342 -0.283921
+0.287764 0.318091 -0.281654
+0.100343 0.301449 -0.178669
+-0.166924 0.30065 0.479276
+0.103124 0.337805 0.624523
+0.417457 0.351512 0.135249
+0.410891 0.691848 0.82199
+0.540507 1 0.921447
+0.740925 1 0.149201
+
+
+-0.419446 1 0.418659
+-0.482668 0.6952 0.35432
+-0.399273 0.757628 0.00717305
+-0.342758 1 0.0264093
+-0.419446 1 0.418659
+0.540507 1 0.921447
+
+
+0.417457 0.351512 0.135249
+0.486582 0.34701 -0.139849
+
+
+0.103124 0.337805 0.624523
+0.410891 0.691848 0.82199
+
+
+0.100343 0.301449 -0.178669
+-0.269061 0.644903 -0.0553307
+0.271194 0.370342 -0.283921
+
+
+0.270522 0.414738 -0.276625
+-0.266112 1 0.000178962
+-0.342758 1 0.0264093
+
+
+-0.269061 0.644903 -0.0553307
+-0.399273 0.757628 0.00717305
+
+
+-0.482668 0.6952 0.35432
+-0.166924 0.30065 0.479276
+
+
+0.460422 1 -0.0437354
+-0.266112 1 0.000178962
+
+
+0.295653 -1 0.125537
+0.326511 -1 1
+0.165497 -0.626005 1
+0.104908 -0.506143 0.745343
+0.295653 -1 0.125537
+0.0241111 -1 -0.356318
+-0.0554729 -0.902285 -0.307934
+-0.0553779 -1 -0.346157
+0.0241111 -1 -0.356318
+
+
+-1 -0.248325 1
+-1 -0.247682 0.998365
+-0.436827 -0.192085 0.393426
+-0.0554729 -0.902285 -0.307934
+
+
+-1 -0.248325 1
+-1 -1 1
+-1 -1 0.704898
+-0.0553779 -1 -0.346157
+
+
+-1 -0.248325 1
+0.165497 -0.626005 1
+
+
+-1 -1 1
+0.326511 -1 1
+
+
+-1 -1 0.704898
+-1 -0.247682 0.998365
+
+
+-0.436827 -0.192085 0.393426
+0.104908 -0.506143 0.745343
+
+
+1 -1 -0.0869333
+1 -0.220232 -0.136273
+0.702153 -0.133572 -0.16249
+0.431467 -1 -0.126509
+1 -1 -0.0869333
+1 -1 1
+0.326511 -1 1
+0.295653 -1 0.125537
+0.104908 -0.506143 0.745343
+0.165497 -0.626005 1
+0.326511 -1 1
+
+
+0.906506 0.119038 1
+0.269029 -0.212458 1
+0.165497 -0.626005 1
+
+
+0.906506 0.119038 1
+1 0.0895918 1
+1 -1 1
+
+
+0.906506 0.119038 1
+0.677636 -0.109983 -0.104294
+0.161715 -0.292687 0.754813
+0.269029 -0.212458 1
+
+
+0.431467 -1 -0.126509
+0.295653 -1 0.125537
+
+
+0.702153 -0.133572 -0.16249
+0.677636 -0.109983 -0.104294
+
+
+1 0.0895918 1
+1 -0.220232 -0.136273
+
+
+0.161715 -0.292687 0.754813
+0.104908 -0.506143 0.745343
+
+
+0.269029 -0.212458 1
+0.161715 -0.292687 0.754813
+0.0939152 0.311697 0.647851
+0.103124 0.337805 0.624523
+0.410891 0.691848 0.82199
+0.47487 0.692764 1
+0.250307 0.357974 1
+0.0939152 0.311697 0.647851
+
+
+0.269029 -0.212458 1
+0.906506 0.119038 1
+0.677636 -0.109983 -0.104294
+0.417457 0.351512 0.135249
+0.410891 0.691848 0.82199
+
+
+0.269029 -0.212458 1
+0.250307 0.357974 1
+
+
+0.417457 0.351512 0.135249
+0.103124 0.337805 0.624523
+
+
+0.906506 0.119038 1
+0.47487 0.692764 1
+
+
+0.161715 -0.292687 0.754813
+0.677636 -0.109983 -0.104294
+
+
+0.677636 -0.109983 -0.104294
+0.702153 -0.133572 -0.16249
+1 -0.220232 -0.136273
+1 0.213816 -0.326884
+0.61137 0.138975 -0.278569
+0.702153 -0.133572 -0.16249
+
+
+0.677636 -0.109983 -0.104294
+0.906506 0.119038 1
+1 0.0895918 1
+1 -0.220232 -0.136273
+
+
+0.677636 -0.109983 -0.104294
+0.417457 0.351512 0.135249
+0.486582 0.34701 -0.139849
+0.61137 0.138975 -0.278569
+
+
+1 1 0.0905046
+0.740925 1 0.149201
+0.486582 0.34701 -0.139849
+
+
+1 1 0.0905046
+1 1 1
+1 0.0895918 1
+
+
+1 1 0.0905046
+1 0.213816 -0.326884
+
+
+0.740925 1 0.149201
+0.540507 1 0.921447
+0.568617 1 1
+0.47487 0.692764 1
+0.410891 0.691848 0.82199
+0.540507 1 0.921447
+
+
+1 1 1
+0.568617 1 1
+
+
+0.906506 0.119038 1
+0.47487 0.692764 1
+
+
+0.417457 0.351512 0.135249
+0.410891 0.691848 0.82199
+
+
+0.0939152 0.311697 0.647851
+-0.182465 0.282251 0.48943
+-0.437369 -0.191246 0.393015
+-1 0.131441 0.577022
+-1 -0.247682 0.998365
+-0.436827 -0.192085 0.393426
+-0.437369 -0.191246 0.393015
+
+
+0.0939152 0.311697 0.647851
+0.250307 0.357974 1
+-1 0.305612 1
+-1 0.262173 0.614949
+-1 0.131441 0.577022
+
+
+0.0939152 0.311697 0.647851
+0.161715 -0.292687 0.754813
+0.104908 -0.506143 0.745343
+0.165497 -0.626005 1
+0.269029 -0.212458 1
+0.161715 -0.292687 0.754813
+
+
+-1 0.262173 0.614949
+-0.182465 0.282251 0.48943
+
+
+-1 -0.248325 1
+0.165497 -0.626005 1
+
+
+-1 -0.248325 1
+-1 0.305612 1
+
+
+-1 -0.248325 1
+-1 -0.247682 0.998365
+
+
+0.104908 -0.506143 0.745343
+-0.436827 -0.192085 0.393426
+
+
+0.250307 0.357974 1
+0.269029 -0.212458 1
+
+
+0.103124 0.337805 0.624523
+-0.166924 0.30065 0.479276
+-0.182465 0.282251 0.48943
+0.0939152 0.311697 0.647851
+0.103124 0.337805 0.624523
+0.410891 0.691848 0.82199
+0.47487 0.692764 1
+0.568617 1 1
+0.540507 1 0.921447
+0.410891 0.691848 0.82199
+
+
+-0.419446 1 0.418659
+-1 1 0.836246
+-1 0.318442 0.590692
+-0.482668 0.6952 0.35432
+-0.419446 1 0.418659
+0.540507 1 0.921447
+
+
+-0.482668 0.6952 0.35432
+-0.166924 0.30065 0.479276
+
+
+-1 0.305612 1
+0.250307 0.357974 1
+0.47487 0.692764 1
+
+
+-1 0.305612 1
+-1 1 1
+0.568617 1 1
+
+
+-1 0.305612 1
+-1 0.262173 0.614949
+-0.182465 0.282251 0.48943
+
+
+-1 1 1
+-1 1 0.836246
+
+
+0.250307 0.357974 1
+0.0939152 0.311697 0.647851
+
+
+-1 0.318442 0.590692
+-1 0.262173 0.614949
+
+
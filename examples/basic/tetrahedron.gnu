@@ -0,0 +1,12 @@
+-1.5 1.5 1.5
+1.5 -1.5 1.5
+-1.5 -1.5 -1.5
+-1.5 1.5 1.5
+1.5 1.5 -1.5
+1.5 -1.5 1.5
+
+
+-1.5 -1.5 -1.5
+1.5 1.5 -1.5
+
+
@@ -0,0 +1,46 @@
+// Example code demonstrating the cell_statistics class
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+#include "voro++.hh"
+using namespace voro;
+
+// Set the number of particles that are going to be randomly introduced
+const int particles=20000;
+
+// This function returns a random double between 0 and 1
+double rnd() {return double(rand())/RAND_MAX;}
+
+int main() {
+	int i;
+
+	// Create a container and randomly add particles into it
+	container con(0,1,0,1,0,1,14,14,14,false,false,false,8);
+	for(i=0;i<particles;i++) con.put(i,rnd(),rnd(),rnd());
+
+	// Accumulate the moments of the volumes, surface areas, and numbers
+	// of faces, along with a volume histogram, the face order frequency
+	// table, and the number of neighbors of each cell, using two threads
+	cell_statistics cs(query_volume|query_surface_area|query_faces);
+	cs.volume_histogram(0,1.5e-4,30);
+	cs.face_orders=true;
+	cs.face_counts=true;
+	cs.compute(con,2);
+
+	// Print a summary, and save the volume histogram
+	cs.print();
+	FILE *fp=safe_fopen("reduction_vol.dat","w");
+	cs.volume_hist.print(fp);
+	fclose(fp);
+
+	// Estimate the mean volume and number of faces from a random sample of
+	// 5% of the particles, with 95% confidence intervals
+	cell_statistics ss(query_volume|query_faces);
+	ss.sample(con,0.05,2);
+	printf("\nSampled %ld of %ld cells\n"
+	       "Mean volume : %g +/- %g\n"
+	       "Mean faces  : %g +/- %g\n",ss.cells,ss.population,
+	       ss.volume.mean,ss.confidence(ss.volume),ss.faces.mean,ss.confidence(ss.faces));
+}
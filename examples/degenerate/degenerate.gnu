@@ -0,0 +1,333 @@
+0.329623 -0.329623 0.270515
+0.581351 7.64666e-15 2.158e-15
+0.364897 0.364897 -0.0359392
+-2.92821e-15 0.581351 1.49186e-16
+0.359547 0.359547 -0.109067
+0.364897 0.364897 -0.0359392
+0.364897 0.364897 0.0359392
+0.359547 0.359547 0.109067
+0.348245 0.348245 0.186141
+0.329623 0.329623 0.270515
+0.316141 0.316141 0.316141
+0.329623 0.270515 0.329623
+0.581351 7.64666e-15 2.158e-15
+0.364897 0.364897 0.0359392
+-2.92821e-15 0.581351 1.49186e-16
+0.348245 0.348245 -0.186141
+0.359547 0.359547 -0.109067
+0.581351 7.64666e-15 2.158e-15
+0.359547 0.359547 0.109067
+-2.92821e-15 0.581351 1.49186e-16
+0.329623 0.329623 -0.270515
+0.348245 0.348245 -0.186141
+0.581351 7.64666e-15 2.158e-15
+0.348245 0.348245 0.186141
+-2.92821e-15 0.581351 1.49186e-16
+0.270515 0.329623 -0.329623
+0.316141 0.316141 -0.316141
+0.329623 0.329623 -0.270515
+0.581351 7.64666e-15 2.158e-15
+0.329623 0.329623 0.270515
+-2.92821e-15 0.581351 1.49186e-16
+0.186141 0.348245 -0.348245
+0.270515 0.329623 -0.329623
+3.9968e-15 6.52256e-16 -0.581351
+0.359547 -0.109067 -0.359547
+0.364897 -0.0359392 -0.364897
+3.9968e-15 6.52256e-16 -0.581351
+0.348245 -0.186141 -0.348245
+0.359547 -0.109067 -0.359547
+0.581351 7.64666e-15 2.158e-15
+0.348245 0.186141 0.348245
+0.329623 0.270515 0.329623
+2.63678e-15 2.04697e-16 0.581351
+0.364897 -0.0359392 0.364897
+0.359547 -0.109067 0.359547
+2.63678e-15 2.04697e-16 0.581351
+0.364897 0.0359392 0.364897
+0.581351 7.64666e-15 2.158e-15
+0.359547 0.109067 0.359547
+0.348245 0.186141 0.348245
+2.63678e-15 2.04697e-16 0.581351
+0.359547 0.109067 0.359547
+0.364897 0.0359392 0.364897
+0.364897 -0.0359392 0.364897
+0.581351 7.64666e-15 2.158e-15
+0.359547 -0.109067 0.359547
+0.348245 -0.186141 0.348245
+2.63678e-15 2.04697e-16 0.581351
+0.270515 0.329623 0.329623
+0.316141 0.316141 0.316141
+
+
+0.329623 -0.329623 0.270515
+0.316141 -0.316141 0.316141
+0.270515 -0.329623 0.329623
+2.63678e-15 2.04697e-16 0.581351
+0.186141 0.348245 0.348245
+0.270515 0.329623 0.329623
+-2.92821e-15 0.581351 1.49186e-16
+0.109067 0.359547 -0.359547
+0.186141 0.348245 -0.348245
+3.9968e-15 6.52256e-16 -0.581351
+0.329623 -0.270515 -0.329623
+0.348245 -0.186141 -0.348245
+0.581351 7.64666e-15 2.158e-15
+0.348245 -0.186141 0.348245
+0.329623 -0.270515 0.329623
+2.63678e-15 2.04697e-16 0.581351
+0.109067 0.359547 0.359547
+0.186141 0.348245 0.348245
+-2.92821e-15 0.581351 1.49186e-16
+0.0359392 0.364897 -0.364897
+0.109067 0.359547 -0.359547
+3.9968e-15 6.52256e-16 -0.581351
+0.270515 -0.329623 -0.329623
+0.316141 -0.316141 -0.316141
+0.329623 -0.270515 -0.329623
+0.581351 7.64666e-15 2.158e-15
+0.329623 -0.270515 0.329623
+0.316141 -0.316141 0.316141
+
+
+0.329623 -0.329623 0.270515
+2.16493e-15 -0.581351 7.70217e-16
+0.364897 -0.364897 -0.0359392
+0.359547 -0.359547 -0.109067
+2.16493e-15 -0.581351 7.70217e-16
+0.364897 -0.364897 0.0359392
+0.581351 7.64666e-15 2.158e-15
+0.348245 -0.348245 0.186141
+0.329623 -0.329623 0.270515
+
+
+-0.186141 0.348245 -0.348245
+-0.109067 0.359547 -0.359547
+-0.0359392 0.364897 -0.364897
+0.0359392 0.364897 -0.364897
+3.9968e-15 6.52256e-16 -0.581351
+0.186141 -0.348245 -0.348245
+0.270515 -0.329623 -0.329623
+2.16493e-15 -0.581351 7.70217e-16
+0.359547 -0.359547 0.109067
+0.581351 7.64666e-15 2.158e-15
+0.364897 -0.364897 -0.0359392
+0.364897 -0.364897 0.0359392
+0.359547 -0.359547 0.109067
+0.348245 -0.348245 0.186141
+2.16493e-15 -0.581351 7.70217e-16
+0.270515 -0.329623 0.329623
+0.186141 -0.348245 0.348245
+2.63678e-15 2.04697e-16 0.581351
+0.0359392 0.364897 0.364897
+0.109067 0.359547 0.359547
+-2.92821e-15 0.581351 1.49186e-16
+-0.0359392 0.364897 -0.364897
+3.9968e-15 6.52256e-16 -0.581351
+0.109067 -0.359547 -0.359547
+0.186141 -0.348245 -0.348245
+2.16493e-15 -0.581351 7.70217e-16
+0.186141 -0.348245 0.348245
+0.109067 -0.359547 0.359547
+2.63678e-15 2.04697e-16 0.581351
+-0.0359392 0.364897 0.364897
+0.0359392 0.364897 0.364897
+-2.92821e-15 0.581351 1.49186e-16
+-0.109067 0.359547 -0.359547
+3.9968e-15 6.52256e-16 -0.581351
+0.0359392 -0.364897 -0.364897
+0.109067 -0.359547 -0.359547
+2.16493e-15 -0.581351 7.70217e-16
+0.109067 -0.359547 0.359547
+0.0359392 -0.364897 0.364897
+2.63678e-15 2.04697e-16 0.581351
+-0.109067 0.359547 0.359547
+-0.0359392 0.364897 0.364897
+-2.92821e-15 0.581351 1.49186e-16
+-0.186141 0.348245 -0.348245
+3.9968e-15 6.52256e-16 -0.581351
+-0.0359392 -0.364897 -0.364897
+0.0359392 -0.364897 -0.364897
+2.16493e-15 -0.581351 7.70217e-16
+0.0359392 -0.364897 0.364897
+-0.0359392 -0.364897 0.364897
+2.63678e-15 2.04697e-16 0.581351
+-0.186141 0.348245 0.348245
+-0.109067 0.359547 0.359547
+-2.92821e-15 0.581351 1.49186e-16
+-0.270515 0.329623 -0.329623
+-0.186141 0.348245 -0.348245
+
+
+-0.270515 -0.329623 0.329623
+2.63678e-15 2.04697e-16 0.581351
+-0.270515 0.329623 0.329623
+-0.186141 0.348245 0.348245
+-2.92821e-15 0.581351 1.49186e-16
+-0.329623 0.329623 -0.270515
+-0.348245 0.348245 -0.186141
+-0.359547 0.359547 -0.109067
+-0.364897 0.364897 -0.0359392
+-0.581351 4.77396e-15 1.40166e-15
+-0.359547 0.359547 -0.109067
+-2.92821e-15 0.581351 1.49186e-16
+-0.348245 0.348245 -0.186141
+-0.581351 4.77396e-15 1.40166e-15
+-0.329623 0.329623 -0.270515
+-0.316141 0.316141 -0.316141
+-0.270515 0.329623 -0.329623
+3.9968e-15 6.52256e-16 -0.581351
+-0.109067 -0.359547 -0.359547
+-0.0359392 -0.364897 -0.364897
+2.16493e-15 -0.581351 7.70217e-16
+-0.0359392 -0.364897 0.364897
+-0.109067 -0.359547 0.359547
+2.63678e-15 2.04697e-16 0.581351
+-0.329623 0.270515 0.329623
+-0.316141 0.316141 0.316141
+-0.270515 0.329623 0.329623
+-2.92821e-15 0.581351 1.49186e-16
+-0.364897 0.364897 -0.0359392
+-0.364897 0.364897 0.0359392
+-0.581351 4.77396e-15 1.40166e-15
+-0.329623 0.270515 -0.329623
+-0.316141 0.316141 -0.316141
+
+
+-0.270515 -0.329623 0.329623
+-0.316141 -0.316141 0.316141
+-0.329623 -0.270515 0.329623
+2.63678e-15 2.04697e-16 0.581351
+-0.348245 0.186141 0.348245
+-0.329623 0.270515 0.329623
+-0.581351 4.77396e-15 1.40166e-15
+-0.348245 0.186141 -0.348245
+-0.329623 0.270515 -0.329623
+3.9968e-15 6.52256e-16 -0.581351
+-0.186141 -0.348245 -0.348245
+-0.109067 -0.359547 -0.359547
+2.16493e-15 -0.581351 7.70217e-16
+-0.109067 -0.359547 0.359547
+-0.186141 -0.348245 0.348245
+2.63678e-15 2.04697e-16 0.581351
+-0.359547 0.109067 0.359547
+-0.348245 0.186141 0.348245
+-0.581351 4.77396e-15 1.40166e-15
+-0.359547 0.109067 -0.359547
+-0.348245 0.186141 -0.348245
+3.9968e-15 6.52256e-16 -0.581351
+-0.270515 -0.329623 -0.329623
+-0.186141 -0.348245 -0.348245
+2.16493e-15 -0.581351 7.70217e-16
+-0.186141 -0.348245 0.348245
+-0.270515 -0.329623 0.329623
+2.16493e-15 -0.581351 7.70217e-16
+-0.329623 -0.329623 0.270515
+-0.316141 -0.316141 0.316141
+
+
+-0.329623 0.329623 0.270515
+-0.348245 0.348245 0.186141
+-0.359547 0.359547 0.109067
+-0.364897 0.364897 0.0359392
+-2.92821e-15 0.581351 1.49186e-16
+-0.359547 0.359547 0.109067
+-0.581351 4.77396e-15 1.40166e-15
+-0.364897 0.0359392 -0.364897
+-0.359547 0.109067 -0.359547
+3.9968e-15 6.52256e-16 -0.581351
+-0.329623 -0.270515 -0.329623
+-0.348245 -0.186141 -0.348245
+-0.359547 -0.109067 -0.359547
+-0.364897 -0.0359392 -0.364897
+-0.364897 0.0359392 -0.364897
+3.9968e-15 6.52256e-16 -0.581351
+-0.348245 -0.186141 -0.348245
+-0.581351 4.77396e-15 1.40166e-15
+-0.364897 -0.0359392 -0.364897
+3.9968e-15 6.52256e-16 -0.581351
+-0.359547 -0.109067 -0.359547
+-0.581351 4.77396e-15 1.40166e-15
+-0.329623 -0.270515 -0.329623
+-0.316141 -0.316141 -0.316141
+-0.270515 -0.329623 -0.329623
+2.16493e-15 -0.581351 7.70217e-16
+-0.348245 -0.348245 0.186141
+-0.329623 -0.329623 0.270515
+-0.581351 4.77396e-15 1.40166e-15
+-0.329623 -0.329623 -0.270515
+2.16493e-15 -0.581351 7.70217e-16
+-0.359547 -0.359547 0.109067
+-0.348245 -0.348245 0.186141
+-0.581351 4.77396e-15 1.40166e-15
+-0.348245 -0.348245 -0.186141
+2.16493e-15 -0.581351 7.70217e-16
+-0.364897 -0.364897 0.0359392
+-0.359547 -0.359547 0.109067
+-0.581351 4.77396e-15 1.40166e-15
+-0.359547 -0.359547 -0.109067
+2.16493e-15 -0.581351 7.70217e-16
+-0.364897 -0.364897 -0.0359392
+-0.364897 -0.364897 0.0359392
+-0.581351 4.77396e-15 1.40166e-15
+-0.364897 -0.364897 -0.0359392
+-0.359547 -0.359547 -0.109067
+-0.348245 -0.348245 -0.186141
+-0.329623 -0.329623 -0.270515
+-0.316141 -0.316141 -0.316141
+
+
+-0.329623 0.329623 0.270515
+-0.581351 4.77396e-15 1.40166e-15
+-0.329623 -0.270515 0.329623
+-0.348245 -0.186141 0.348245
+2.63678e-15 2.04697e-16 0.581351
+-0.364897 0.0359392 0.364897
+-0.359547 0.109067 0.359547
+-0.581351 4.77396e-15 1.40166e-15
+-0.348245 -0.186141 0.348245
+-0.359547 -0.109067 0.359547
+2.63678e-15 2.04697e-16 0.581351
+-0.364897 -0.0359392 0.364897
+-0.364897 0.0359392 0.364897
+-0.581351 4.77396e-15 1.40166e-15
+-0.359547 -0.109067 0.359547
+-0.364897 -0.0359392 0.364897
+-0.581351 4.77396e-15 1.40166e-15
+-0.348245 0.348245 0.186141
+-2.92821e-15 0.581351 1.49186e-16
+-0.329623 0.329623 0.270515
+-0.316141 0.316141 0.316141
+
+
+0.329623 0.270515 -0.329623
+0.581351 7.64666e-15 2.158e-15
+0.359547 -0.359547 -0.109067
+0.348245 -0.348245 -0.186141
+2.16493e-15 -0.581351 7.70217e-16
+0.329623 -0.329623 -0.270515
+0.316141 -0.316141 -0.316141
+
+
+0.329623 0.270515 -0.329623
+0.348245 0.186141 -0.348245
+0.581351 7.64666e-15 2.158e-15
+0.348245 -0.348245 -0.186141
+0.329623 -0.329623 -0.270515
+0.581351 7.64666e-15 2.158e-15
+0.364897 -0.0359392 -0.364897
+0.364897 0.0359392 -0.364897
+0.581351 7.64666e-15 2.158e-15
+0.359547 0.109067 -0.359547
+0.364897 0.0359392 -0.364897
+3.9968e-15 6.52256e-16 -0.581351
+0.329623 0.270515 -0.329623
+0.316141 0.316141 -0.316141
+
+
+0.359547 0.109067 -0.359547
+3.9968e-15 6.52256e-16 -0.581351
+0.348245 0.186141 -0.348245
+0.359547 0.109067 -0.359547
+
+
@@ -0,0 +1,27787 @@
+0.389392 0.0185887 0.31492
+0.420272 0.0202432 0.270855
+0.415969 0.0717108 0.269873
+0.414242 0.0692173 0.272903
+0.384719 0.088236 0.307581
+0.362049 0.185075 0.301682
+0.36155 0.182483 0.303206
+0.312942 0.14384 0.362567
+0.312306 0.14435 0.362921
+0.312123 0.144525 0.363011
+0.31134 0.145149 0.363441
+0.310549 0.14567 0.363918
+0.310078 0.145919 0.364224
+0.309773 0.146118 0.364407
+0.309016 0.146517 0.364894
+0.308263 0.146825 0.365412
+0.30773 0.146984 0.365801
+0.307522 0.147068 0.365943
+0.306795 0.147283 0.366469
+0.306076 0.147417 0.367018
+0.305371 0.14747 0.367585
+0.305355 0.147469 0.367599
+0.304668 0.14752 0.368147
+0.303976 0.147494 0.368729
+0.303301 0.147388 0.369325
+0.30306 0.14732 0.36955
+0.302626 0.147251 0.369931
+0.253366 0.252422 0.365024
+0.252778 0.250599 0.366267
+0.145377 0.224646 0.422847
+0.10996 0.245405 0.422055
+0.106591 0.243753 0.423986
+0.105038 0.280323 0.400982
+-0.0372893 0.324433 0.4
+-0.0334986 0.331177 0.394349
+-0.0279594 0.333318 0.391621
+0.105038 0.280323 0.400982
+-0.0432691 0.313754 0.408872
+-0.0374166 0.324211 0.400186
+-0.0372893 0.324433 0.4
+
+
+0.389392 0.0185887 0.31492
+0.389556 0.0223554 0.314416
+0.389646 0.0238182 0.314184
+0.420272 0.0202432 0.270855
+0.41366 0.0683105 0.273933
+0.412104 0.0660819 0.276637
+0.384719 0.088236 0.307581
+0.359666 0.172104 0.309169
+0.359272 0.170093 0.31035
+0.313758 0.143049 0.362164
+0.312942 0.14384 0.362567
+
+
+0.389392 0.0185887 0.31492
+0.389297 0.0170853 0.315154
+0.353916 0.0348819 0.352033
+0.350766 0.0610599 0.351108
+0.34948 0.0602371 0.352517
+0.335115 0.0786323 0.363201
+0.328311 0.103723 0.362616
+0.329164 0.104704 0.361572
+0.329892 0.105288 0.360749
+0.335115 0.0786323 0.363201
+0.326852 0.102282 0.364325
+0.327634 0.103205 0.363369
+0.328311 0.103723 0.362616
+
+
+0.266572 0.420205 -0.101389
+0.204528 0.456279 -0.0194397
+0.133275 0.48477 -0.0214586
+0.133926 0.484805 -0.0142384
+0.058974 0.496872 -0.00641194
+0.0301554 0.499131 -0.00624809
+0.0310356 0.499074 -0.00512995
+0.0272388 0.499148 0.0225842
+-0.0307565 0.500093 0.0202766
+-0.0347448 0.499996 0.023668
+-0.0248719 0.498374 -0.0374832
+-0.129256 0.489279 -0.033228
+-0.12927 0.489255 -0.0335342
+-0.129591 0.48847 -0.0435095
+-0.0248719 0.498374 -0.0374832
+-0.128911 0.49005 -0.0229417
+-0.128925 0.490026 -0.0232509
+-0.129256 0.489279 -0.033228
+
+
+0.266572 0.420205 -0.101389
+0.275543 0.415823 -0.102164
+0.281728 0.412807 -0.102626
+0.204528 0.456279 -0.0194397
+0.133954 0.484804 -0.0139708
+0.134596 0.484811 -0.00676761
+0.058974 0.496872 -0.00641194
+0.0325272 0.498973 -0.00364926
+0.0332605 0.498922 -0.00267112
+0.0272388 0.499148 0.0225842
+-0.037781 0.499916 0.026375
+-0.0428672 0.499776 0.0307147
+-0.0248719 0.498374 -0.0374832
+-0.128549 0.490795 -0.0124516
+-0.128564 0.490772 -0.0127699
+-0.128911 0.49005 -0.0229417
+
+
+0.266572 0.420205 -0.101389
+0.261554 0.422634 -0.101017
+0.181842 0.434736 -0.16834
+0.0416749 0.484971 -0.172334
+0.0417423 0.485211 -0.171637
+-0.104262 0.466121 -0.149203
+-0.14392 0.455329 -0.149697
+-0.145605 0.455779 -0.146897
+-0.164923 0.436861 -0.17987
+-0.243213 0.404938 -0.176216
+-0.242987 0.404886 -0.176569
+-0.23825 0.403895 -0.183758
+-0.164923 0.436861 -0.17987
+-0.244403 0.407675 -0.168387
+-0.24385 0.409655 -0.164128
+-0.310534 0.370612 -0.128901
+-0.403689 0.284689 -0.131874
+-0.401417 0.284085 -0.139192
+-0.399983 0.283745 -0.1437
+-0.310534 0.370612 -0.128901
+-0.407462 0.285632 -0.119688
+-0.40514 0.285026 -0.127256
+-0.403689 0.284689 -0.131874
+
+
+0.363494 -0.0444946 0.345712
+0.359034 -0.0463112 0.350312
+0.353916 0.0348819 0.352033
+0.349135 0.0598947 0.352914
+0.347917 0.05913 0.354236
+0.335115 0.0786323 0.363201
+0.325474 0.100925 0.365925
+0.326207 0.101812 0.36503
+0.326852 0.102282 0.364325
+
+
+0.363494 -0.0444946 0.345712
+0.374129 -0.116155 0.311345
+0.393506 -0.0407497 0.311194
+0.389877 -0.0379387 0.316467
+0.420272 0.0202432 0.270855
+0.411575 0.0652579 0.277566
+0.410137 0.0632169 0.280037
+0.384719 0.088236 0.307581
+0.357761 0.161841 0.315067
+0.357436 0.160208 0.316025
+0.314566 0.14215 0.361807
+0.314336 0.142372 0.361922
+0.313758 0.143049 0.362164
+
+
+0.363494 -0.0444946 0.345712
+0.364406 -0.0440994 0.34477
+0.353916 0.0348819 0.352033
+0.347592 0.0587954 0.35461
+0.346414 0.0580684 0.355876
+0.335115 0.0786323 0.363201
+0.324146 0.0996225 0.367454
+0.324849 0.100488 0.366599
+0.325474 0.100925 0.365925
+
+
+-0.132444 0.0818279 0.48802
+-0.0534567 -0.0227233 0.497018
+-0.0111705 -0.13387 0.491697
+-0.0191458 -0.137847 0.490603
+-0.0217484 -0.139111 0.490248
+-0.0534567 -0.0227233 0.497018
+-0.000801737 -0.12872 0.493073
+-0.00863773 -0.132637 0.492031
+-0.0111705 -0.13387 0.491697
+
+
+-0.132444 0.0818279 0.48802
+-0.129295 0.0838696 0.488457
+-0.121677 0.0887077 0.489512
+-0.0534567 -0.0227233 0.497018
+0.00744702 -0.120184 0.49449
+0.00827513 -0.124206 0.494237
+0.00171085 -0.127494 0.493393
+-0.000801737 -0.12872 0.493073
+
+
+-0.132444 0.0818279 0.48802
+-0.14016 0.0769155 0.486915
+-0.178942 0.188749 0.427498
+-0.271849 0.0945399 0.424016
+-0.274277 0.0962826 0.422198
+-0.281054 0.101256 0.41708
+-0.178942 0.188749 0.427498
+-0.262869 0.0879985 0.430718
+-0.265255 0.0897078 0.428949
+-0.271849 0.0945399 0.424016
+
+
+0.430987 -0.235997 0.0966334
+0.423901 -0.256742 0.066882
+0.423781 -0.256903 0.0670215
+0.423384 -0.257407 0.0675791
+0.422836 -0.258135 0.0682116
+0.422371 -0.258777 0.0686395
+0.422258 -0.258926 0.0687699
+0.421653 -0.259755 0.0693226
+0.421019 -0.260657 0.0697593
+0.420872 -0.260873 0.0698278
+0.420352 -0.261608 0.0701848
+0.419658 -0.262625 0.0705015
+0.419337 -0.263113 0.0705719
+0.41893 -0.263704 0.0707584
+0.418174 -0.264847 0.0709164
+0.417816 -0.265413 0.0708933
+0.417385 -0.266058 0.0709865
+0.416576 -0.267328 0.0709224
+0.41635 -0.267703 0.0708243
+0.415721 -0.26868 0.0707809
+0.414972 -0.26992 0.0704268
+0.414881 -0.270059 0.0704249
+0.413979 -0.27154 0.0699931
+0.413705 -0.27204 0.0696587
+0.413061 -0.273081 0.069386
+0.412567 -0.274003 0.0686706
+0.412143 -0.274661 0.0685731
+0.411562 -0.275794 0.067499
+0.411115 -0.276422 0.0676506
+0.410831 -0.277258 0.0659306
+0.412087 -0.275802 0.0642279
+0.412531 -0.275409 0.0631065
+0.413281 -0.274579 0.0618905
+0.413619 -0.274254 0.0611316
+0.414185 -0.273633 0.0601732
+0.414457 -0.273363 0.0595833
+0.414912 -0.272862 0.0587949
+0.415139 -0.272632 0.0583092
+0.41552 -0.272209 0.0576379
+0.415716 -0.272008 0.0572221
+0.416046 -0.271639 0.0566333
+0.416219 -0.271458 0.0562658
+0.416513 -0.271127 0.0557357
+0.416669 -0.270961 0.0554022
+0.416938 -0.270656 0.0549137
+0.417082 -0.2705 0.0546038
+0.417333 -0.270212 0.0541436
+0.417469 -0.270063 0.0538492
+0.417708 -0.269785 0.0534068
+0.417839 -0.26964 0.0531213
+0.418071 -0.269367 0.0526876
+0.418199 -0.269222 0.0524051
+0.418429 -0.268948 0.0519717
+0.418557 -0.268802 0.0516866
+0.41879 -0.268521 0.0512451
+0.418921 -0.26837 0.0509515
+0.41916 -0.268078 0.050493
+0.419296 -0.267918 0.0501845
+0.419548 -0.267606 0.0496984
+0.419692 -0.267436 0.0493671
+0.419964 -0.267095 0.0488406
+0.42012 -0.266908 0.0484763
+0.42042 -0.266528 0.0478927
+0.420594 -0.266318 0.0474816
+0.420934 -0.265881 0.0468179
+0.421132 -0.26564 0.0463394
+0.421531 -0.265121 0.0455624
+0.421764 -0.264837 0.0449841
+0.422253 -0.264194 0.0440429
+0.422536 -0.263848 0.0433053
+0.423172 -0.262998 0.0421173
+0.423532 -0.262572 0.0410601
+0.424524 -0.2612 0.0394431
+0.424621 -0.261348 0.0373512
+0.423909 -0.262499 0.0373744
+0.423532 -0.262572 0.0410601
+
+
+0.430987 -0.235997 0.0966334
+0.43121 -0.235861 0.0958009
+0.43238 -0.235254 0.0910994
+0.4244 -0.256102 0.0661763
+0.423901 -0.256742 0.066882
+
+
+0.430987 -0.235997 0.0966334
+0.429586 -0.236711 0.102194
+0.452817 -0.199577 0.0743398
+0.49076 -0.103032 0.0745236
+0.489127 -0.103767 0.0827298
+0.49032 -0.00243348 0.0999044
+0.487176 0.111435 0.0953004
+0.488462 0.113906 0.0884399
+0.489354 0.115561 0.0836888
+0.49032 -0.00243348 0.0999044
+0.485117 0.107603 0.106048
+0.486338 0.109909 0.09967
+0.487176 0.111435 0.0953004
+
+
+0.0979089 0.382853 0.307741
+0.0982824 0.382905 0.307549
+0.127516 0.351781 0.332251
+0.0557071 0.375428 0.330223
+0.064069 0.376964 0.325812
+0.0647817 0.377082 0.325449
+0.127516 0.351781 0.332251
+0.0442056 0.373308 0.33625
+0.0548243 0.375278 0.330672
+0.0557071 0.375428 0.330223
+
+
+0.0979089 0.382853 0.307741
+0.0840644 0.412413 0.270646
+0.0374166 0.419971 0.270128
+0.0374675 0.418162 0.272885
+-0.00934473 0.41695 0.276524
+-0.100442 0.413462 0.272108
+-0.103879 0.417496 0.265623
+-0.104691 0.418485 0.264037
+-0.00934473 0.41695 0.276524
+-0.0965629 0.408857 0.279445
+-0.099709 0.412564 0.273537
+-0.100442 0.413462 0.272108
+
+
+0.0979089 0.382853 0.307741
+0.0939 0.38218 0.309927
+0.127516 0.351781 0.332251
+0.0359407 0.369096 0.343417
+0.039388 0.372421 0.338755
+0.043059 0.373108 0.336834
+0.0442056 0.373308 0.33625
+
+
+0.478094 0.175438 0.041618
+0.480997 0.167897 0.0425935
+0.434716 0.190815 0.158152
+0.373575 0.319347 0.153137
+0.369478 0.318948 0.164678
+0.270737 0.406813 0.107727
+0.239757 0.426046 0.106184
+0.238717 0.426906 0.105285
+0.235207 0.429917 0.101835
+0.270737 0.406813 0.107727
+0.243166 0.423131 0.109443
+0.242356 0.423798 0.108767
+0.239757 0.426046 0.106184
+
+
+0.478094 0.175438 0.041618
+0.463013 0.171402 -0.0811302
+0.462967 0.171552 -0.0810559
+0.462914 0.171718 -0.0809845
+0.462853 0.171902 -0.0809167
+0.462783 0.172107 -0.0808535
+0.462701 0.172338 -0.0807961
+0.462606 0.172598 -0.0807467
+0.462494 0.172895 -0.0807078
+0.462361 0.173235 -0.0806834
+0.462203 0.173627 -0.0806788
+0.462013 0.174085 -0.0807017
+0.461783 0.174622 -0.0807628
+0.461503 0.175257 -0.0808779
+0.461158 0.176013 -0.0810693
+0.461047 0.176248 -0.0811475
+0.455078 0.185671 -0.0918264
+0.454999 0.185411 -0.0927372
+0.455241 0.184533 -0.0933043
+0.455173 0.184253 -0.0941828
+0.455409 0.183377 -0.0947503
+0.455328 0.18311 -0.0956524
+0.455589 0.18217 -0.0961973
+0.455454 0.181971 -0.0972075
+0.455824 0.180804 -0.0976498
+0.455399 0.181004 -0.0992488
+0.456647 0.178401 -0.0982369
+0.457964 0.176454 -0.0957052
+0.455824 0.180804 -0.0976498
+
+
+0.478094 0.175438 0.041618
+0.476543 0.179435 0.0411408
+0.434716 0.190815 0.158152
+0.368842 0.318871 0.166487
+0.364568 0.318427 0.178412
+0.270737 0.406813 0.107727
+0.24586 0.420814 0.112018
+0.245195 0.421358 0.11149
+0.243166 0.423131 0.109443
+
+
+0.0418429 0.462813 0.184581
+0.0398331 0.462809 0.185056
+0.0451587 0.471195 0.162285
+-0.138381 0.480971 0.162338
+-0.14206 0.481654 0.160911
+-0.143305 0.48312 0.156812
+-0.14674 0.48726 0.145226
+-0.146219 0.487494 0.144459
+0.0451587 0.471195 0.162285
+-0.102926 0.474319 0.176099
+-0.132264 0.479811 0.164748
+-0.138381 0.480971 0.162338
+
+
+0.0418429 0.462813 0.184581
+0.0566727 0.45453 0.201473
+-0.022236 0.460477 0.202402
+-0.029568 0.460178 0.204403
+-0.0334726 0.460954 0.202919
+-0.0349751 0.461262 0.202324
+0.0451587 0.471195 0.162285
+-0.0786205 0.469716 0.185512
+-0.0988888 0.473544 0.177693
+-0.102926 0.474319 0.176099
+
+
+0.0418429 0.462813 0.184581
+0.0423579 0.462865 0.184328
+0.0451587 0.471195 0.162285
+-0.0606226 0.466268 0.192463
+-0.0757118 0.469149 0.186662
+-0.0786205 0.469716 0.185512
+
+
+0.384466 -0.0357471 0.323658
+0.380027 -0.0375957 0.328388
+0.353916 0.0348819 0.352033
+0.346099 0.0577375 0.356235
+0.344939 0.0570294 0.357471
+0.335115 0.0786323 0.363201
+0.322839 0.0983473 0.368944
+0.32353 0.099205 0.368108
+0.324146 0.0996225 0.367454
+
+
+0.384466 -0.0357471 0.323658
+0.374129 -0.116155 0.311345
+0.389273 -0.0374943 0.317337
+0.386092 -0.0350437 0.321918
+0.386242 -0.0330759 0.321656
+0.420272 0.0202432 0.270855
+0.409644 0.062451 0.280894
+0.408287 0.0605395 0.283203
+0.384719 0.088236 0.307581
+0.356171 0.153371 0.319913
+0.355891 0.151995 0.320718
+0.31541 0.141152 0.36145
+0.314566 0.14215 0.361807
+
+
+0.384466 -0.0357471 0.323658
+0.385409 -0.0353298 0.322652
+0.353916 0.0348819 0.352033
+0.344628 0.0566995 0.357823
+0.343464 0.0559919 0.359052
+0.335115 0.0786323 0.363201
+0.321527 0.0970746 0.370424
+0.322223 0.0979346 0.369591
+0.322839 0.0983473 0.368944
+
+
+0.441415 0.151669 0.181162
+0.440459 0.153124 0.182148
+0.434716 0.190815 0.158152
+0.363898 0.318342 0.1803
+0.35935 0.317841 0.192868
+0.270737 0.406813 0.107727
+0.248081 0.418893 0.114138
+0.24751 0.419354 0.113715
+0.24586 0.420814 0.112018
+
+
+0.441415 0.151669 0.181162
+0.426136 0.138953 0.222487
+0.403121 0.204985 0.219039
+0.400504 0.208518 0.221466
+0.434716 0.190815 0.158152
+0.358629 0.317745 0.194879
+0.354724 0.317291 0.205572
+0.351119 0.319947 0.205292
+0.270737 0.406813 0.107727
+0.249978 0.417242 0.115945
+0.249465 0.417648 0.115603
+0.248081 0.418893 0.114138
+
+
+0.441415 0.151669 0.181162
+0.442861 0.149549 0.179586
+0.434716 0.190815 0.158152
+0.354648 0.314359 0.209475
+0.354487 0.310085 0.215209
+0.219585 0.354976 0.275998
+0.155791 0.392944 0.272538
+0.157013 0.395497 0.268231
+0.157581 0.396591 0.266353
+0.219585 0.354976 0.275998
+0.156711 0.387925 0.2785
+0.15602 0.389076 0.277484
+0.154858 0.391085 0.275679
+0.155233 0.391869 0.274368
+0.155791 0.392944 0.272538
+
+
+0.424773 -0.202364 0.202417
+0.424703 -0.203359 0.200623
+0.375883 -0.302347 0.133038
+0.421922 -0.240466 0.132004
+0.421911 -0.240573 0.131802
+0.424537 -0.23929 0.121696
+0.422258 -0.258926 0.0687699
+
+
+0.424773 -0.202364 0.202417
+0.452817 -0.199577 0.0743398
+0.488774 -0.103943 0.0844616
+0.487129 -0.104662 0.0925589
+0.49032 -0.00243348 0.0999044
+0.483128 0.103968 0.11621
+0.484312 0.106166 0.110155
+0.485117 0.107603 0.106048
+
+
+0.424773 -0.202364 0.202417
+0.425046 -0.197814 0.210757
+0.425511 -0.19685 0.210577
+0.42876 -0.190144 0.209263
+0.452817 -0.199577 0.0743398
+0.486771 -0.104835 0.0942842
+0.485084 -0.105552 0.102428
+0.49032 -0.00243348 0.0999044
+0.481168 0.10045 0.126014
+0.482339 0.102586 0.120149
+0.483128 0.103968 0.11621
+
+
+0.403372 0.181669 -0.234621
+0.404045 0.181746 -0.233432
+0.38169 0.223987 -0.233544
+0.299989 0.355052 -0.228144
+0.299387 0.354853 -0.229305
+0.293046 0.352643 -0.241639
+0.38169 0.223987 -0.233544
+0.306794 0.357383 -0.214823
+0.306198 0.357189 -0.215979
+0.299989 0.355052 -0.228144
+
+
+0.403372 0.181669 -0.234621
+0.412428 0.136992 -0.248066
+0.396359 0.181189 -0.246583
+0.397026 0.181269 -0.245435
+0.38169 0.223987 -0.233544
+0.31359 0.359681 -0.201421
+0.31299 0.359488 -0.202594
+0.306794 0.357383 -0.214823
+
+
+0.403372 0.181669 -0.234621
+0.401683 0.181591 -0.237504
+0.38169 0.223987 -0.233544
+0.320509 0.36199 -0.187677
+0.319893 0.361794 -0.18889
+0.31359 0.359681 -0.201421
+
+
+-0.12927 0.489255 -0.0335342
+-0.224704 0.446302 -0.0268837
+-0.247512 0.433602 -0.0276722
+-0.248254 0.433057 -0.0297125
+-0.248408 0.432928 -0.0303902
+-0.224704 0.446302 -0.0268837
+-0.246686 0.434211 -0.0251811
+-0.247383 0.433711 -0.0270513
+-0.247512 0.433602 -0.0276722
+
+
+0.458323 0.154602 -0.130324
+0.457966 0.158197 -0.126088
+0.448585 0.193932 -0.106863
+0.448352 0.194471 -0.106933
+0.448159 0.194932 -0.106963
+0.447998 0.195328 -0.106964
+0.447863 0.195671 -0.106945
+0.447749 0.195971 -0.10691
+0.447651 0.196235 -0.106864
+0.447568 0.196469 -0.106809
+0.447496 0.196678 -0.106748
+0.447434 0.196865 -0.106682
+0.44738 0.197034 -0.106612
+0.447334 0.197187 -0.106539
+0.447293 0.197327 -0.106463
+0.447258 0.197455 -0.106385
+0.447227 0.197573 -0.106305
+0.4472 0.197681 -0.106223
+0.447196 0.197701 -0.106207
+0.447175 0.197784 -0.106143
+0.447152 0.197881 -0.106062
+0.447132 0.197972 -0.105977
+0.447115 0.198058 -0.105889
+0.447101 0.198139 -0.105797
+0.44709 0.198217 -0.105701
+0.44708 0.19829 -0.1056
+0.447074 0.198359 -0.105495
+0.44707 0.198425 -0.105384
+0.447069 0.198486 -0.105266
+0.447071 0.198545 -0.105142
+0.447076 0.198599 -0.10501
+0.362157 0.373544 -0.10129
+0.360583 0.373972 -0.106955
+0.360424 0.374013 -0.107533
+0.364649 0.363219 -0.111975
+0.370568 0.348164 -0.118066
+0.447071 0.198545 -0.105142
+
+
+0.458323 0.154602 -0.130324
+0.462494 0.170116 -0.0861657
+0.462657 0.169986 -0.0856352
+0.462785 0.169902 -0.0851817
+0.462886 0.169853 -0.0847906
+0.462889 0.169852 -0.0847775
+0.455409 0.183377 -0.0947503
+
+
+0.458323 0.154602 -0.130324
+0.45875 0.149337 -0.136904
+0.448352 0.194471 -0.106933
+
+
+0.39186 -0.309099 0.0370347
+0.392606 -0.307686 0.0396567
+0.408551 -0.284862 0.0449231
+0.408501 -0.284895 0.0451599
+0.417469 -0.270063 0.0538492
+
+
+0.39186 -0.309099 0.0370347
+0.380791 -0.315481 0.0766182
+0.401671 -0.28817 0.0763326
+0.40215 -0.287044 0.0782604
+0.408696 -0.281271 0.062151
+0.409072 -0.280564 0.0628501
+0.413619 -0.274254 0.0611316
+
+
+0.39186 -0.309099 0.0370347
+0.391308 -0.310183 0.0348209
+0.408838 -0.284614 0.0438923
+0.408551 -0.284862 0.0449231
+
+
+0.446811 -0.22562 0.0261924
+0.428113 -0.253491 0.0499981
+0.42814 -0.253178 0.051399
+0.428118 -0.253143 0.0517699
+0.428132 -0.252928 0.0527343
+0.428054 -0.252795 0.0540412
+0.42799 -0.2528 0.0545415
+0.427942 -0.252724 0.0552944
+0.427785 -0.252732 0.0565041
+0.427622 -0.252826 0.057345
+0.427578 -0.252828 0.0576693
+0.440451 -0.230391 0.0568413
+0.440576 -0.23029 0.056323
+0.441274 -0.229817 0.0530422
+0.427785 -0.252732 0.0565041
+
+
+0.446811 -0.22562 0.0261924
+0.447052 -0.225413 0.0250531
+0.448598 -0.224183 0.0172014
+0.428006 -0.253935 0.0485791
+0.428015 -0.253823 0.0491049
+0.428113 -0.253491 0.0499981
+
+
+0.446811 -0.22562 0.0261924
+0.445568 -0.226587 0.0324366
+0.452817 -0.199577 0.0743398
+0.484713 -0.105727 0.10418
+0.482949 -0.106456 0.11253
+0.49032 -0.00243348 0.0999044
+0.479199 0.0969768 0.135656
+0.48038 0.0990933 0.129865
+0.481168 0.10045 0.126014
+
+
+0.473951 -0.0612827 -0.147215
+0.473674 -0.0624559 -0.14761
+0.479066 -0.0747935 -0.1237
+0.488701 0.00210254 -0.12035
+0.486663 -0.00691485 -0.124272
+0.485255 -0.0133233 -0.126905
+0.479066 -0.0747935 -0.1237
+0.494526 0.0283571 -0.109181
+0.490978 0.012489 -0.116038
+0.488701 0.00210254 -0.12035
+
+
+0.473951 -0.0612827 -0.147215
+0.467061 -0.0515947 -0.172025
+0.477426 0.0712034 -0.166381
+0.474586 0.0675676 -0.173444
+0.474471 0.0674164 -0.173731
+0.469074 0.0673482 -0.183426
+0.429296 -0.00494892 -0.257062
+0.426498 0.0669903 -0.257521
+0.425203 0.0670035 -0.25967
+0.422834 0.0669402 -0.263602
+0.429296 -0.00494892 -0.257062
+0.430125 0.0670364 -0.251449
+0.428835 0.0670509 -0.253608
+0.426498 0.0669903 -0.257521
+
+
+0.473951 -0.0612827 -0.147215
+0.474306 -0.0600214 -0.146599
+0.479066 -0.0747935 -0.1237
+0.500665 0.048685 -0.0938944
+0.500248 0.0489744 -0.0957045
+0.499195 0.0496564 -0.10025
+0.498959 0.0485939 -0.100707
+0.494526 0.0283571 -0.109181
+
+
+0.33003 -0.147545 0.348415
+0.330486 -0.149922 0.34697
+0.27822 -0.176201 0.376759
+0.321099 -0.105942 0.373583
+0.322149 -0.110549 0.370816
+0.322861 -0.113934 0.368828
+0.27822 -0.176201 0.376759
+0.319031 -0.0966552 0.379079
+0.320267 -0.102044 0.375862
+0.321099 -0.105942 0.373583
+
+
+0.33003 -0.147545 0.348415
+0.374129 -0.116155 0.311345
+0.379119 -0.0379959 0.32935
+0.374802 -0.0397835 0.333913
+0.353916 0.0348819 0.352033
+0.343148 0.0556609 0.359406
+0.34196 0.0549358 0.360652
+0.335115 0.0786323 0.363201
+0.320184 0.0957792 0.371926
+0.320903 0.0966522 0.371076
+0.321527 0.0970746 0.370424
+
+
+0.33003 -0.147545 0.348415
+0.329381 -0.144523 0.350306
+0.27822 -0.176201 0.376759
+0.316525 -0.0855029 0.385645
+0.31803 -0.0920256 0.381775
+0.319031 -0.0966552 0.379079
+
+
+0.369231 0.063132 0.331677
+0.368437 0.0642251 0.332355
+0.384719 0.088236 0.307581
+0.354795 0.146133 0.324033
+0.354547 0.144935 0.324731
+0.316199 0.140021 0.361189
+0.316118 0.140116 0.361224
+0.31541 0.141152 0.36145
+
+
+0.369231 0.063132 0.331677
+0.353916 0.0348819 0.352033
+0.341631 0.054601 0.361016
+0.340396 0.0538395 0.362301
+0.335115 0.0786323 0.363201
+0.318782 0.0944332 0.373478
+0.319544 0.0953324 0.372593
+0.320184 0.0957792 0.371926
+
+
+0.369231 0.063132 0.331677
+0.370446 0.0616064 0.330604
+0.384719 0.088236 0.307581
+0.353568 0.139761 0.327639
+0.353342 0.138691 0.328262
+0.317049 0.138768 0.360915
+0.316199 0.140021 0.361189
+
+
+0.389795 0.0275192 0.31368
+0.389879 0.0289703 0.313446
+0.420272 0.0202432 0.270855
+0.407817 0.0598126 0.284011
+0.406509 0.0579843 0.286212
+0.384719 0.088236 0.307581
+0.352445 0.134005 0.330878
+0.352234 0.133025 0.331446
+0.317818 0.137371 0.360761
+0.317615 0.137664 0.360831
+0.317049 0.138768 0.360915
+
+
+0.389795 0.0275192 0.31368
+0.353916 0.0348819 0.352033
+0.340045 0.0534971 0.362684
+0.338735 0.0526789 0.364038
+0.335115 0.0786323 0.363201
+0.31729 0.0930049 0.375116
+0.318114 0.0939479 0.374174
+0.318782 0.0944332 0.373478
+
+
+0.389795 0.0275192 0.31368
+0.389646 0.0238182 0.314184
+
+
+0.421004 -0.0623426 0.269793
+0.417321 -0.0593858 0.275495
+0.420272 0.0202432 0.270855
+0.406052 0.0572808 0.28699
+0.404766 0.0554967 0.28913
+0.384719 0.088236 0.307581
+0.351391 0.128681 0.333856
+0.35119 0.127763 0.334385
+0.318601 0.13582 0.360646
+0.317818 0.137371 0.360761
+
+
+0.421004 -0.0623426 0.269793
+0.374129 -0.116155 0.311345
+0.373909 -0.0401747 0.33485
+0.369628 -0.0419376 0.339339
+0.353916 0.0348819 0.352033
+0.338352 0.0523229 0.364449
+0.336933 0.0514242 0.365907
+0.335115 0.0786323 0.363201
+0.315668 0.0914554 0.376882
+0.316579 0.0924658 0.375857
+0.31729 0.0930049 0.375116
+
+
+0.421004 -0.0623426 0.269793
+0.421618 -0.0628145 0.268842
+0.420272 0.0202432 0.270855
+0.404313 0.0548027 0.289894
+0.403024 0.0530272 0.292016
+0.384719 0.088236 0.307581
+0.352201 0.121773 0.33511
+0.353559 0.115937 0.335352
+0.335115 0.0786323 0.363201
+0.313863 0.0897347 0.378831
+0.314893 0.0908444 0.377689
+0.315668 0.0914554 0.376882
+
+
+0.0788181 0.0954353 0.493737
+0.110458 0.196023 0.446961
+0.0241238 0.243241 0.443186
+0.0130635 0.24373 0.445252
+0.105038 0.280323 0.400982
+-0.0495694 0.302455 0.418177
+-0.0434019 0.313521 0.409064
+-0.0432691 0.313754 0.408872
+
+
+0.0788181 0.0954353 0.493737
+0.0780927 0.0957418 0.493782
+0.068463 0.0999215 0.494341
+0.110458 0.196023 0.446961
+0.000565964 0.244153 0.447646
+-0.0163186 0.244866 0.450786
+0.105038 0.280323 0.400982
+-0.0535993 0.290079 0.427684
+-0.0547577 0.293114 0.425806
+-0.0497107 0.302206 0.418381
+-0.0495694 0.302455 0.418177
+
+
+0.0788181 0.0954353 0.493737
+0.0885741 0.09119 0.493129
+0.0256701 -0.00678241 0.499695
+0.0573174 0.104729 0.494943
+0.0473812 0.10902 0.495435
+0.110458 0.196023 0.446961
+-0.0366012 0.245563 0.45463
+-0.0367369 0.245568 0.454655
+-0.0384748 0.250147 0.451928
+-0.0391853 0.252067 0.450781
+0.105038 0.280323 0.400982
+-0.0486629 0.277079 0.435657
+-0.0528384 0.288033 0.428942
+-0.0535993 0.290079 0.427684
+
+
+0.284321 0.124518 0.392169
+0.284509 0.12417 0.392135
+0.28047 0.0950224 0.403371
+0.260823 0.14772 0.401829
+0.266624 0.142433 0.399373
+0.267083 0.141989 0.399186
+0.28047 0.0950224 0.403371
+0.252283 0.155519 0.40541
+0.260213 0.148302 0.402078
+0.260823 0.14772 0.401829
+
+
+0.284321 0.124518 0.392169
+0.296968 0.121247 0.383569
+0.296495 0.122702 0.383465
+0.300005 0.128297 0.378896
+0.300107 0.128321 0.378809
+0.30149 0.128302 0.377732
+0.301574 0.128317 0.377661
+0.302755 0.128302 0.376735
+0.302828 0.128314 0.376674
+0.303866 0.128301 0.375855
+0.303931 0.12831 0.3758
+0.304867 0.128298 0.375055
+0.304926 0.128306 0.375005
+0.30579 0.128294 0.374313
+0.305846 0.128301 0.374266
+0.306661 0.128289 0.373608
+0.306714 0.128296 0.373562
+0.307499 0.128283 0.372924
+0.30755 0.128289 0.37288
+0.30832 0.128276 0.372248
+0.308371 0.128282 0.372204
+0.309142 0.128268 0.371567
+0.309193 0.128274 0.371522
+0.30998 0.128258 0.370867
+0.310033 0.128264 0.37082
+0.310853 0.128247 0.370133
+0.310908 0.128254 0.370084
+0.311779 0.128233 0.369348
+0.311839 0.128241 0.369294
+0.312786 0.128217 0.368489
+0.312852 0.128227 0.368429
+0.313907 0.128198 0.367526
+0.313981 0.12821 0.367458
+0.315189 0.128173 0.366418
+0.315275 0.12819 0.366336
+0.316703 0.128141 0.365102
+0.316809 0.128169 0.364999
+0.318564 0.128095 0.363478
+0.31872 0.128172 0.363313
+0.320999 0.127991 0.361357
+0.321199 0.125764 0.361963
+0.321191 0.125749 0.361975
+0.318564 0.128095 0.363478
+
+
+0.284321 0.124518 0.392169
+0.282127 0.128 0.392731
+0.28047 0.0950224 0.403371
+0.239655 0.167025 0.410671
+0.251417 0.156335 0.405763
+0.252283 0.155519 0.40541
+
+
+-0.123897 0.44899 -0.183254
+-0.125633 0.449559 -0.180467
+-0.164923 0.436861 -0.17987
+-0.243371 0.411198 -0.160859
+-0.242816 0.413139 -0.156645
+-0.310534 0.370612 -0.128901
+-0.411382 0.286593 -0.106882
+-0.40896 0.285974 -0.114866
+-0.407462 0.285632 -0.119688
+
+
+-0.123897 0.44899 -0.183254
+-0.104262 0.466121 -0.149203
+-0.146278 0.455995 -0.145667
+-0.148163 0.456491 -0.142516
+-0.164923 0.436861 -0.17987
+-0.242332 0.414666 -0.15338
+-0.241763 0.416606 -0.149131
+-0.310534 0.370612 -0.128901
+-0.415541 0.287593 -0.0931404
+-0.41296 0.286947 -0.101742
+-0.411382 0.286593 -0.106882
+
+
+-0.123897 0.44899 -0.183254
+-0.123199 0.448719 -0.184479
+-0.164923 0.436861 -0.17987
+-0.241264 0.418147 -0.145806
+-0.24067 0.420123 -0.141438
+-0.310534 0.370612 -0.128901
+-0.420054 0.288657 -0.0780636
+-0.417241 0.287967 -0.0875416
+-0.415541 0.287593 -0.0931404
+
+
+0.29859 -0.199347 0.34868
+0.300654 -0.197511 0.347982
+0.30802 -0.229117 0.320982
+0.346704 -0.175796 0.317814
+0.349783 -0.177972 0.313271
+0.350099 -0.178212 0.312794
+0.30802 -0.229117 0.320982
+0.343319 -0.173393 0.322775
+0.346391 -0.17556 0.318282
+0.346704 -0.175796 0.317814
+
+
+0.29859 -0.199347 0.34868
+0.27822 -0.176201 0.376759
+0.313369 -0.0715685 0.393812
+0.315275 -0.0797952 0.388959
+0.316525 -0.0855029 0.385645
+
+
+0.29859 -0.199347 0.34868
+0.297658 -0.20023 0.34896
+0.30802 -0.229117 0.320982
+0.339881 -0.170954 0.327774
+0.343005 -0.173155 0.323242
+0.343319 -0.173393 0.322775
+
+
+0.21159 0.155556 0.43224
+0.28047 0.0950224 0.403371
+0.226967 0.173836 0.417236
+0.229218 0.176535 0.414993
+0.238301 0.168288 0.411224
+0.239655 0.167025 0.410671
+
+
+0.21159 0.155556 0.43224
+0.215747 0.160522 0.428214
+0.216743 0.161676 0.427259
+0.28047 0.0950224 0.403371
+0.221836 0.16773 0.422289
+0.225959 0.172667 0.41822
+0.226967 0.173836 0.417236
+
+
+0.21159 0.155556 0.43224
+0.21057 0.154376 0.433209
+0.145377 0.224646 0.422847
+0.106098 0.243482 0.424285
+0.102253 0.241587 0.426476
+0.105038 0.280323 0.400982
+-0.04389 0.264492 0.443304
+-0.0479336 0.275114 0.436854
+-0.0486629 0.277079 0.435657
+
+
+0.296611 -0.282417 0.28998
+0.299462 -0.280535 0.288669
+0.319882 -0.304039 0.235874
+0.407739 -0.209275 0.227905
+0.4131 -0.208255 0.221516
+0.417002 -0.204848 0.218027
+0.420328 -0.201966 0.215009
+0.375883 -0.302347 0.133038
+0.422296 -0.236413 0.139592
+0.42196 -0.240118 0.132637
+0.421922 -0.240466 0.132004
+
+
+0.296611 -0.282417 0.28998
+0.30802 -0.229117 0.320982
+0.336319 -0.168431 0.332909
+0.339558 -0.17071 0.328249
+0.339881 -0.170954 0.327774
+
+
+0.296611 -0.282417 0.28998
+0.294227 -0.284038 0.291022
+0.319882 -0.304039 0.235874
+0.39845 -0.211013 0.238911
+0.407602 -0.209299 0.228069
+0.407739 -0.209275 0.227905
+
+
+0.224721 -0.263493 0.369993
+0.30802 -0.229117 0.320982
+0.331264 -0.169104 0.337379
+0.333701 -0.166764 0.336533
+0.333816 -0.166656 0.336491
+0.33598 -0.168177 0.333402
+0.336319 -0.168431 0.332909
+
+
+0.224721 -0.263493 0.369993
+0.230245 -0.258722 0.368511
+0.239972 -0.250472 0.365794
+0.30802 -0.229117 0.320982
+0.32466 -0.1753 0.339731
+0.326596 -0.173441 0.33907
+0.331264 -0.169104 0.337379
+
+
+0.224721 -0.263493 0.369993
+0.209723 -0.276203 0.374141
+0.27822 -0.176201 0.376759
+0.30677 -0.0628899 0.402324
+0.311983 -0.0653216 0.397429
+0.313369 -0.0715685 0.393812
+
+
+0.276488 -0.048736 0.430311
+0.278022 -0.0494681 0.428905
+0.27822 -0.176201 0.376759
+0.298035 -0.0588039 0.410466
+0.305618 -0.0623347 0.403404
+0.30677 -0.0628899 0.402324
+
+
+0.276488 -0.048736 0.430311
+0.353916 0.0348819 0.352033
+0.336507 0.0510461 0.366358
+0.334934 0.0500364 0.367965
+0.335115 0.0786323 0.363201
+0.311803 0.0877735 0.38104
+0.312997 0.0890272 0.379733
+0.313863 0.0897347 0.378831
+
+
+0.276488 -0.048736 0.430311
+0.268733 -0.0451405 0.437376
+0.26703 -0.0452415 0.438562
+0.28047 0.0950224 0.403371
+0.206274 0.14925 0.437331
+0.21057 0.154376 0.433209
+
+
+0.288553 -0.0543768 0.419236
+0.27822 -0.176201 0.376759
+0.266154 -0.0453018 0.439168
+0.25453 -0.0459848 0.447195
+0.28047 0.0950224 0.403371
+0.20068 0.142623 0.442639
+0.20521 0.14802 0.438333
+0.206274 0.14925 0.437331
+
+
+0.288553 -0.0543768 0.419236
+0.296796 -0.0582087 0.411619
+0.298035 -0.0588039 0.410466
+
+
+0.288553 -0.0543768 0.419236
+0.287192 -0.0537247 0.420494
+0.353916 0.0348819 0.352033
+0.334448 0.0496244 0.368473
+0.332657 0.0484618 0.370291
+0.335115 0.0786323 0.363201
+0.309382 0.0854716 0.383618
+0.310806 0.0869342 0.382078
+0.311803 0.0877735 0.38104
+
+
+0.0466209 0.109339 0.495473
+0.0362279 0.113815 0.495944
+0.110458 0.196023 0.446961
+-0.0368096 0.231516 0.460987
+-0.0368791 0.222804 0.464876
+-0.178942 0.188749 0.427498
+-0.253939 0.0815038 0.437321
+-0.256328 0.0832129 0.435566
+-0.262869 0.0879985 0.430718
+
+
+0.0466209 0.109339 0.495473
+0.0256701 -0.00678241 0.499695
+0.0354247 0.114152 0.495981
+0.0243281 0.118919 0.496439
+0.110458 0.196023 0.446961
+-0.0368759 0.21787 0.46707
+-0.0369417 0.209298 0.470855
+-0.178942 0.188749 0.427498
+-0.244887 0.0749317 0.443949
+-0.247326 0.0766735 0.442175
+-0.253939 0.0815038 0.437321
+
+
+0.0466209 0.109339 0.495473
+0.0473812 0.10902 0.495435
+
+
+-0.413056 -0.254464 -0.168497
+-0.409654 -0.255707 -0.17467
+-0.433806 -0.126861 -0.214754
+-0.393024 -0.252449 -0.210651
+-0.392202 -0.251655 -0.212823
+-0.388683 -0.248133 -0.222201
+-0.433806 -0.126861 -0.214754
+-0.397539 -0.256952 -0.198507
+-0.396676 -0.256116 -0.200809
+-0.393024 -0.252449 -0.210651
+
+
+-0.413056 -0.254464 -0.168497
+-0.335423 -0.353515 -0.113662
+-0.281833 -0.401416 -0.110171
+-0.281825 -0.401446 -0.110097
+-0.225451 -0.420597 -0.150567
+-0.189678 -0.437701 -0.151088
+-0.189468 -0.438911 -0.147914
+-0.153551 -0.446874 -0.1647
+-0.0385364 -0.479652 -0.168473
+-0.0404276 -0.477676 -0.172319
+-0.0437121 -0.474312 -0.178812
+-0.153551 -0.446874 -0.1647
+-0.0327687 -0.485553 -0.156941
+-0.0348948 -0.483352 -0.161264
+-0.0385364 -0.479652 -0.168473
+
+
+-0.413056 -0.254464 -0.168497
+-0.416077 -0.253311 -0.163049
+-0.433806 -0.126861 -0.214754
+-0.403191 -0.258074 -0.186269
+-0.400104 -0.259211 -0.191745
+-0.399865 -0.259295 -0.19217
+-0.397539 -0.256952 -0.198507
+
+
+0.402464 -0.28622 0.079853
+0.402774 -0.285474 0.0811339
+0.402853 -0.28497 0.0826433
+0.413061 -0.273081 0.069386
+
+
+0.402464 -0.28622 0.079853
+0.380791 -0.315481 0.0766182
+0.402871 -0.284658 0.0837307
+0.403018 -0.283646 0.0867541
+0.413979 -0.27154 0.0699931
+
+
+0.402464 -0.28622 0.079853
+0.40215 -0.287044 0.0782604
+
+
+0.417745 -0.282084 -0.0613746
+0.413033 -0.289291 -0.062993
+0.414654 -0.277299 0.0351012
+0.414531 -0.277471 0.0352082
+0.419296 -0.267918 0.0501845
+
+
+0.417745 -0.282084 -0.0613746
+0.415805 -0.23012 -0.156689
+0.455624 -0.153064 -0.153115
+0.45633 -0.154003 -0.149891
+0.479066 -0.0747935 -0.1237
+0.503498 0.0467924 -0.0814266
+0.503075 0.0470916 -0.083297
+0.500665 0.048685 -0.0938944
+
+
+0.417745 -0.282084 -0.0613746
+0.418987 -0.280182 -0.0609209
+0.415323 -0.276339 0.0346784
+0.414654 -0.277299 0.0351012
+
+
+0.475991 0.084382 0.151899
+0.49032 -0.00243348 0.0999044
+0.477449 0.0915417 0.144404
+0.478183 0.0952441 0.140521
+0.478397 0.09562 0.139496
+0.479199 0.0969768 0.135656
+
+
+0.475991 0.084382 0.151899
+0.477411 0.0913617 0.144597
+0.477449 0.0915417 0.144404
+
+
+0.475991 0.084382 0.151899
+0.475954 0.0842106 0.152082
+0.426136 0.138953 0.222487
+0.396126 0.2143 0.225618
+0.392548 0.219098 0.228929
+0.434716 0.190815 0.158152
+0.354337 0.30514 0.221751
+0.354161 0.300959 0.227325
+0.219585 0.354976 0.275998
+0.160069 0.38212 0.283668
+0.159476 0.383111 0.2828
+0.156711 0.387925 0.2785
+
+
+0.50637 -0.0637158 -0.00485048
+0.506721 -0.0592884 -0.00633066
+0.479066 -0.0747935 -0.1237
+0.506405 0.0448107 -0.0683959
+0.505967 0.0451262 -0.0703674
+0.503498 0.0467924 -0.0814266
+
+
+0.50637 -0.0637158 -0.00485048
+0.49032 -0.00243348 0.0999044
+0.474553 0.0774942 0.15909
+0.475954 0.0842106 0.152082
+
+
+0.50637 -0.0637158 -0.00485048
+0.505778 -0.0709636 -0.00250528
+0.479066 -0.0747935 -0.1237
+0.50945 0.042693 -0.0544952
+0.508987 0.0430324 -0.0566173
+0.506405 0.0448107 -0.0683959
+
+
+0.424137 -0.212246 0.184284
+0.424079 -0.213004 0.182917
+0.375883 -0.302347 0.133038
+0.422686 -0.231882 0.148035
+0.422336 -0.236028 0.140289
+0.422296 -0.236413 0.139592
+
+
+0.424137 -0.212246 0.184284
+0.452817 -0.199577 0.0743398
+0.482558 -0.106635 0.114344
+0.480679 -0.107392 0.123076
+0.49032 -0.00243348 0.0999044
+0.473107 0.070737 0.166127
+0.474516 0.0773276 0.159268
+0.474553 0.0774942 0.15909
+
+
+0.424137 -0.212246 0.184284
+0.424703 -0.203359 0.200623
+
+
+0.386972 -0.0222289 0.320298
+0.420272 0.0202432 0.270855
+0.402565 0.05233 0.29278
+0.401249 0.0505282 0.294924
+0.384719 0.088236 0.307581
+0.353803 0.114982 0.335366
+0.354934 0.110059 0.335563
+0.335115 0.0786323 0.363201
+0.308066 0.0824448 0.385397
+0.307876 0.080802 0.385907
+0.28047 0.0950224 0.403371
+0.195219 0.135251 0.448002
+0.19612 0.137235 0.446924
+0.199548 0.141313 0.443696
+0.20068 0.142623 0.442639
+
+
+0.386972 -0.0222289 0.320298
+0.387381 -0.0156243 0.319489
+0.387557 -0.0132346 0.319156
+0.420272 0.0202432 0.270855
+0.400775 0.0498146 0.295704
+0.399405 0.0479495 0.297913
+0.384719 0.088236 0.307581
+0.355143 0.10924 0.335571
+0.356116 0.104954 0.335735
+0.335115 0.0786323 0.363201
+0.307765 0.0790517 0.386373
+0.307566 0.0773373 0.386898
+0.28047 0.0950224 0.403371
+0.191263 0.126576 0.452677
+0.195126 0.135054 0.448111
+0.195219 0.135251 0.448002
+
+
+0.386972 -0.0222289 0.320298
+0.386758 -0.0250729 0.320686
+0.353916 0.0348819 0.352033
+0.332089 0.047999 0.370878
+0.329989 0.0466224 0.372998
+0.335115 0.0786323 0.363201
+0.307442 0.0754936 0.387385
+0.307228 0.073667 0.387935
+0.28047 0.0950224 0.403371
+0.187065 0.117391 0.457582
+0.191166 0.126369 0.45279
+0.191263 0.126576 0.452677
+
+
+0.426619 -0.257322 0.0422962
+0.426819 -0.25694 0.0426108
+0.427239 -0.25599 0.0441497
+0.427256 -0.255932 0.0443269
+0.427596 -0.255149 0.0456068
+0.42771 -0.254783 0.0466106
+0.427835 -0.254485 0.047117
+0.428006 -0.253935 0.0485791
+
+
+0.426619 -0.257322 0.0422962
+0.422253 -0.264194 0.0440429
+
+
+0.426619 -0.257322 0.0422962
+0.426301 -0.258045 0.0410433
+0.425857 -0.258853 0.0405405
+0.423172 -0.262998 0.0421173
+
+
+0.44325 -0.228364 0.0437502
+0.444154 -0.227695 0.0393156
+0.428132 -0.252928 0.0527343
+
+
+0.44325 -0.228364 0.0437502
+0.452817 -0.199577 0.0743398
+0.480258 -0.107579 0.124992
+0.478215 -0.10838 0.134315
+0.49032 -0.00243348 0.0999044
+0.471625 0.0639795 0.173145
+0.473069 0.070572 0.166302
+0.473107 0.070737 0.166127
+
+
+0.44325 -0.228364 0.0437502
+0.443096 -0.228493 0.0444281
+0.428054 -0.252795 0.0540412
+
+
+0.356853 -0.183012 0.302695
+0.357197 -0.183273 0.302167
+0.30802 -0.229117 0.320982
+0.319263 -0.180345 0.341635
+0.320866 -0.178806 0.341096
+0.32466 -0.1753 0.339731
+
+
+0.356853 -0.183012 0.302695
+0.374129 -0.116155 0.311345
+0.368734 -0.0423271 0.34027
+0.364406 -0.0440994 0.34477
+
+
+0.356853 -0.183012 0.302695
+0.353573 -0.180686 0.307616
+0.30802 -0.229117 0.320982
+0.314687 -0.184604 0.343232
+0.31606 -0.183286 0.342778
+0.319263 -0.180345 0.341635
+
+
+0.291086 -0.286099 0.292452
+0.294227 -0.284038 0.291022
+
+
+0.291086 -0.286099 0.292452
+0.30802 -0.229117 0.320982
+0.310683 -0.188312 0.344612
+0.311895 -0.187151 0.344219
+0.314687 -0.184604 0.343232
+
+
+0.291086 -0.286099 0.292452
+0.288429 -0.287892 0.293606
+0.319882 -0.304039 0.235874
+0.383953 -0.220549 0.247627
+0.390799 -0.215483 0.244197
+0.396396 -0.211391 0.24133
+0.398329 -0.211034 0.239055
+0.39845 -0.211013 0.238911
+
+
+0.326539 -0.130814 0.358654
+0.327057 -0.133395 0.357115
+0.27822 -0.176201 0.376759
+0.253594 -0.0460484 0.447839
+0.241034 -0.0467801 0.456443
+0.28047 0.0950224 0.403371
+0.182512 0.107459 0.462841
+0.18696 0.11717 0.457701
+0.187065 0.117391 0.457582
+
+
+0.326539 -0.130814 0.358654
+0.374129 -0.116155 0.311345
+0.358085 -0.0467198 0.351285
+0.353398 -0.0486194 0.356081
+0.353916 0.0348819 0.352033
+0.329305 0.046084 0.373699
+0.326754 0.044399 0.376259
+0.335115 0.0786323 0.363201
+0.307086 0.0716837 0.388456
+0.306853 0.0696945 0.389046
+0.28047 0.0950224 0.403371
+0.177462 0.0964665 0.468611
+0.182398 0.107216 0.46297
+0.182512 0.107459 0.462841
+
+
+0.326539 -0.130814 0.358654
+0.325788 -0.127432 0.360728
+0.27822 -0.176201 0.376759
+0.240011 -0.0468485 0.45714
+0.226129 -0.0476506 0.466577
+0.28047 0.0950224 0.403371
+0.171715 0.0839885 0.47511
+0.177333 0.096195 0.468755
+0.177462 0.0964665 0.468611
+
+
+-0.328868 -0.33453 -0.179872
+-0.330631 -0.332735 -0.180156
+-0.335423 -0.353515 -0.113662
+-0.28112 -0.404261 -0.102875
+-0.281111 -0.404293 -0.102795
+-0.225451 -0.420597 -0.150567
+-0.189456 -0.43913 -0.147303
+-0.18923 -0.440397 -0.14394
+-0.153551 -0.446874 -0.1647
+-0.0261693 -0.49225 -0.143738
+-0.0286261 -0.489729 -0.148729
+-0.0327687 -0.485553 -0.156941
+
+
+-0.328868 -0.33453 -0.179872
+-0.290413 -0.331313 -0.237261
+-0.22048 -0.388696 -0.235106
+-0.220994 -0.388616 -0.234624
+-0.225451 -0.420597 -0.150567
+-0.189214 -0.440629 -0.143286
+-0.188966 -0.441987 -0.139645
+-0.153551 -0.446874 -0.1647
+-0.0183868 -0.500087 -0.128155
+-0.0213171 -0.497107 -0.134104
+-0.0261693 -0.49225 -0.143738
+
+
+-0.328868 -0.33453 -0.179872
+-0.325809 -0.337682 -0.179289
+-0.335423 -0.353515 -0.113662
+-0.280317 -0.407371 -0.0948277
+-0.280307 -0.407407 -0.0947386
+-0.225451 -0.420597 -0.150567
+-0.188947 -0.442239 -0.13893
+-0.188669 -0.443728 -0.134894
+-0.153551 -0.446874 -0.1647
+-0.008875 -0.5096 -0.109099
+-0.0125045 -0.505939 -0.116459
+-0.0183868 -0.500087 -0.128155
+
+
+-0.229811 -0.332967 0.324409
+-0.223387 -0.332081 0.331411
+-0.176814 -0.420902 0.204888
+-0.00526453 -0.484989 0.203412
+-0.00496186 -0.485677 0.202202
+-0.00108767 -0.494712 0.186225
+-0.176814 -0.420902 0.204888
+-0.00912583 -0.475933 0.219275
+-0.00884287 -0.47658 0.218147
+-0.00526453 -0.484989 0.203412
+
+
+-0.229811 -0.332967 0.324409
+-0.327379 -0.209631 0.315085
+-0.240622 -0.334472 0.312523
+-0.234689 -0.333675 0.319025
+-0.176814 -0.420902 0.204888
+-0.012772 -0.467315 0.23423
+-0.0125021 -0.467937 0.233157
+-0.00912583 -0.475933 0.219275
+
+
+-0.229811 -0.332967 0.324409
+-0.234689 -0.333675 0.319025
+
+
+0.354076 -0.346137 0.0725017
+0.354154 -0.346083 0.0723569
+0.344351 -0.361304 0.035808
+0.373795 -0.330717 0.0375662
+0.376057 -0.328807 0.0334154
+0.376148 -0.328732 0.0332353
+0.344351 -0.361304 0.035808
+0.371711 -0.332455 0.0413787
+0.373716 -0.330782 0.0377232
+0.373795 -0.330717 0.0375662
+
+
+0.354076 -0.346137 0.0725017
+0.380791 -0.315481 0.0766182
+0.403038 -0.283293 0.0879606
+0.40319 -0.282151 0.091364
+0.414881 -0.270059 0.0704249
+
+
+0.354076 -0.346137 0.0725017
+0.351849 -0.347749 0.0762848
+0.344351 -0.361304 0.035808
+0.369816 -0.334016 0.0448227
+0.37164 -0.332512 0.0415193
+0.371711 -0.332455 0.0413787
+
+
+0.337001 -0.358174 0.101264
+0.337213 -0.358029 0.100896
+0.344351 -0.361304 0.035808
+0.368054 -0.33545 0.0480069
+0.369752 -0.334067 0.0449516
+0.369816 -0.334016 0.0448227
+
+
+0.337001 -0.358174 0.101264
+0.380791 -0.315481 0.0766182
+0.403212 -0.281741 0.0927383
+0.403374 -0.280417 0.0966785
+0.415721 -0.26868 0.0707809
+
+
+0.337001 -0.358174 0.101264
+0.330448 -0.362692 0.112171
+0.344351 -0.361304 0.035808
+0.366377 -0.336796 0.0510151
+0.367993 -0.335497 0.0481279
+0.368054 -0.33545 0.0480069
+
+
+0.258715 -0.234404 0.360571
+0.30802 -0.229117 0.320982
+0.307085 -0.191629 0.345837
+0.308183 -0.190579 0.345488
+0.310683 -0.188312 0.344612
+
+
+0.258715 -0.234404 0.360571
+0.260883 -0.232494 0.359986
+0.265092 -0.228907 0.358765
+0.30802 -0.229117 0.320982
+0.303773 -0.194667 0.346949
+0.30479 -0.193696 0.346632
+0.307085 -0.191629 0.345837
+
+
+0.258715 -0.234404 0.360571
+0.253448 -0.238883 0.362078
+0.27822 -0.176201 0.376759
+0.224984 -0.047726 0.467351
+0.209251 -0.0486279 0.477968
+0.28047 0.0950224 0.403371
+0.164986 0.0694076 0.482647
+0.171567 0.0836758 0.475274
+0.171715 0.0839885 0.47511
+
+
+0.331127 -0.152948 0.345064
+0.331582 -0.155352 0.343593
+0.27822 -0.176201 0.376759
+0.207937 -0.0487132 0.47885
+0.2021 -0.0490454 0.482762
+0.197988 -0.0381802 0.483381
+0.197568 -0.0370515 0.48344
+0.28047 0.0950224 0.403371
+0.162765 0.0538563 0.487458
+0.160493 0.0596975 0.487633
+0.16481 0.0690362 0.48284
+0.164986 0.0694076 0.482647
+
+
+0.331127 -0.152948 0.345064
+0.374129 -0.116155 0.311345
+0.35239 -0.0490503 0.357106
+0.347361 -0.0510785 0.362212
+0.353916 0.0348819 0.352033
+0.3259 0.0437463 0.377127
+0.322669 0.0415976 0.380355
+0.335115 0.0786323 0.363201
+0.306688 0.0675119 0.389616
+0.306428 0.0652932 0.390264
+0.28047 0.0950224 0.403371
+0.168084 0.0401055 0.486996
+0.163079 0.0530287 0.487434
+0.162765 0.0538563 0.487458
+
+
+0.331127 -0.152948 0.345064
+0.330486 -0.149922 0.34697
+
+
+0.183763 0.294414 0.366157
+0.188056 0.292816 0.365968
+0.105038 0.280323 0.400982
+0.0327253 0.242952 0.441517
+0.0241238 0.243241 0.443186
+
+
+0.183763 0.294414 0.366157
+0.127516 0.351781 0.332251
+0.0300742 0.363475 0.351253
+0.0341311 0.367403 0.345791
+0.0359407 0.369096 0.343417
+
+
+0.183763 0.294414 0.366157
+0.174963 0.297573 0.366628
+0.105038 0.280323 0.400982
+0.0470382 0.242372 0.438771
+0.0406551 0.242584 0.440027
+0.0327253 0.242952 0.441517
+
+
+0.388687 0.00577155 0.316696
+0.388802 0.00745904 0.316444
+0.420272 0.0202432 0.270855
+0.398906 0.0472051 0.298725
+0.397451 0.0452347 0.301047
+0.384719 0.088236 0.307581
+0.3563 0.104232 0.335738
+0.357158 0.100397 0.335878
+0.335115 0.0786323 0.363201
+0.306231 0.0628305 0.390905
+0.305935 0.0602892 0.391635
+0.28047 0.0950224 0.403371
+0.173439 0.0262057 0.486471
+0.168397 0.0392763 0.486968
+0.168084 0.0401055 0.486996
+
+
+0.388687 0.00577155 0.316696
+0.353916 0.0348819 0.352033
+0.321551 0.0407658 0.381481
+0.317232 0.0378776 0.385779
+0.335115 0.0786323 0.363201
+0.305694 0.0574308 0.392376
+0.305345 0.0544302 0.393225
+0.28047 0.0950224 0.403371
+0.178936 0.011883 0.485873
+0.173758 0.0253592 0.48644
+0.173439 0.0262057 0.486471
+
+
+0.388687 0.00577155 0.316696
+0.388449 0.00129064 0.317267
+0.420272 0.0202432 0.270855
+0.396914 0.0444423 0.301911
+0.395336 0.0423156 0.304405
+0.384719 0.088236 0.307581
+0.357325 0.099743 0.335878
+0.358101 0.0962283 0.335998
+0.335115 0.0786323 0.363201
+0.305042 0.0510014 0.394112
+0.304618 0.0473287 0.395135
+0.28047 0.0950224 0.403371
+0.18469 -0.00317045 0.485185
+0.179267 0.0110017 0.485837
+0.178936 0.011883 0.485873
+
+
+0.386242 -0.0330759 0.321656
+0.386758 -0.0250729 0.320686
+
+
+0.454511 0.188019 -0.0898303
+0.454932 0.186797 -0.0902463
+0.454798 0.186621 -0.0912849
+0.455078 0.185671 -0.0918264
+
+
+0.454511 0.188019 -0.0898303
+0.452696 0.191657 -0.0913983
+0.453429 0.190625 -0.0898395
+0.455059 0.187607 -0.0879049
+0.454511 0.188019 -0.0898303
+
+
+0.485226 0.0669062 -0.143941
+0.467061 -0.0515947 -0.172025
+0.481608 0.0712131 -0.154856
+0.479411 0.0738207 -0.161399
+0.479206 0.0735559 -0.161914
+0.477426 0.0712034 -0.166381
+
+
+0.485226 0.0669062 -0.143941
+0.482899 0.0697072 -0.150966
+0.481608 0.0712131 -0.154856
+
+
+0.485226 0.0669062 -0.143941
+0.48647 0.0654346 -0.140139
+0.463171 0.169811 -0.083484
+0.4632 0.169837 -0.0832909
+0.463223 0.169869 -0.0831133
+0.463241 0.169908 -0.0829492
+0.463255 0.169952 -0.0827967
+0.463264 0.170001 -0.0826544
+0.46327 0.170054 -0.082521
+0.463273 0.170111 -0.0823954
+0.463273 0.170171 -0.0822769
+0.46327 0.170236 -0.0821645
+0.463264 0.170305 -0.0820576
+0.463256 0.170377 -0.0819556
+0.463245 0.170454 -0.0818581
+0.463232 0.170535 -0.0817646
+0.463216 0.17062 -0.0816749
+0.463197 0.170711 -0.0815886
+0.463175 0.170808 -0.0815055
+0.46315 0.170911 -0.0814255
+0.463122 0.171021 -0.0813485
+0.46309 0.171138 -0.0812746
+0.463053 0.171265 -0.0812038
+0.463039 0.171311 -0.0811809
+0.455241 0.184533 -0.0933043
+
+
+0.438879 -0.231444 0.0639217
+0.427077 -0.25318 0.0598593
+0.427002 -0.253254 0.0600885
+0.426788 -0.253424 0.0608932
+0.42646 -0.253741 0.0618809
+0.426139 -0.254089 0.0626769
+0.426093 -0.254133 0.0628136
+0.425719 -0.254531 0.0637286
+0.425302 -0.255014 0.0645801
+0.425051 -0.255324 0.0650107
+0.424862 -0.255539 0.0653927
+0.4244 -0.256102 0.0661763
+
+
+0.438879 -0.231444 0.0639217
+0.439 -0.231349 0.063439
+0.439658 -0.230929 0.0604411
+0.427357 -0.252951 0.0587885
+0.427077 -0.25318 0.0598593
+
+
+0.438879 -0.231444 0.0639217
+0.43822 -0.231851 0.0668736
+0.452817 -0.199577 0.0743398
+0.477754 -0.10858 0.136383
+0.475486 -0.109448 0.146558
+0.49032 -0.00243348 0.0999044
+0.470079 0.0570911 0.180281
+0.471587 0.0638129 0.173322
+0.471625 0.0639795 0.173145
+
+
+0.399641 -0.292982 0.0675614
+0.400042 -0.2921 0.0690644
+0.40772 -0.283671 0.0576269
+0.407932 -0.28316 0.0585993
+0.415139 -0.272632 0.0583092
+
+
+0.399641 -0.292982 0.0675614
+0.380791 -0.315481 0.0766182
+0.4034 -0.279926 0.0982916
+0.403469 -0.279309 0.100124
+0.404238 -0.277779 0.101372
+0.416576 -0.267328 0.0709224
+
+
+0.399641 -0.292982 0.0675614
+0.399413 -0.293549 0.0664003
+0.40759 -0.284171 0.0561271
+0.415716 -0.272008 0.0572221
+
+
+0.444326 -0.227549 0.0385357
+0.445368 -0.226758 0.033362
+0.42814 -0.253178 0.051399
+
+
+0.444326 -0.227549 0.0385357
+0.452817 -0.199577 0.0743398
+0.474968 -0.109666 0.148842
+0.472391 -0.11063 0.16022
+0.49032 -0.00243348 0.0999044
+0.468936 0.0487317 0.185669
+0.468976 0.0522912 0.185241
+0.470038 0.0569195 0.180462
+0.470079 0.0570911 0.180281
+
+
+0.444326 -0.227549 0.0385357
+0.444154 -0.227695 0.0393156
+
+
+0.346391 -0.17556 0.318282
+0.374129 -0.116155 0.311345
+0.346268 -0.0515424 0.363314
+0.340753 -0.0537568 0.368872
+0.353916 0.0348819 0.352033
+0.315679 0.0367474 0.387333
+0.309471 0.0325777 0.393488
+0.335115 0.0786323 0.363201
+0.304224 0.0430496 0.396241
+0.303684 0.0383523 0.397531
+0.28047 0.0950224 0.403371
+0.190842 -0.0193246 0.484384
+0.185041 -0.00410662 0.485143
+0.18469 -0.00317045 0.485185
+
+
+0.38115 -0.20042 0.265291
+0.381801 -0.200907 0.264262
+0.30802 -0.229117 0.320982
+0.294719 -0.20288 0.349905
+0.295639 -0.202013 0.349633
+0.297658 -0.20023 0.34896
+
+
+0.38115 -0.20042 0.265291
+0.374129 -0.116155 0.311345
+0.33954 -0.0542677 0.370087
+0.333345 -0.0567452 0.376287
+0.353916 0.0348819 0.352033
+0.307127 0.0309018 0.395821
+0.302589 0.0278429 0.400307
+0.302212 0.0270407 0.400728
+0.28047 0.0950224 0.403371
+0.279103 -0.0228568 0.426141
+0.273517 -0.034984 0.432215
+0.268733 -0.0451405 0.437376
+
+
+0.38115 -0.20042 0.265291
+0.375384 -0.196297 0.274267
+0.30802 -0.229117 0.320982
+0.291783 -0.205514 0.350835
+0.292709 -0.204647 0.350566
+0.294719 -0.20288 0.349905
+
+
+-0.0233895 0.0321689 0.500239
+-0.0229836 0.0299483 0.500253
+-0.0534567 -0.0227233 0.497018
+0.0023795 -0.0952642 0.496025
+0.00604364 -0.112991 0.494938
+0.00744702 -0.120184 0.49449
+
+
+-0.0233895 0.0321689 0.500239
+0.0256701 -0.00678241 0.499695
+0.0234616 0.119282 0.496475
+0.0113504 0.124472 0.496929
+0.110458 0.196023 0.446961
+-0.0369368 0.204398 0.47301
+-0.037 0.195803 0.476765
+-0.178942 0.188749 0.427498
+-0.235535 0.0681519 0.450733
+-0.238073 0.069962 0.448904
+-0.244887 0.0749317 0.443949
+
+
+-0.0233895 0.0321689 0.500239
+-0.0249903 0.0399154 0.500173
+-0.0534567 -0.0227233 0.497018
+-0.00100082 -0.0786375 0.49702
+0.00148853 -0.0906325 0.496306
+0.0023795 -0.0952642 0.496025
+
+
+0.322149 -0.110549 0.370816
+0.374129 -0.116155 0.311345
+0.331964 -0.0573222 0.37766
+0.324814 -0.0601707 0.384767
+0.353916 0.0348819 0.352033
+0.300392 0.0229857 0.40278
+0.298374 0.0186959 0.405016
+0.28047 0.0950224 0.403371
+0.287505 -0.00479067 0.416989
+0.283658 -0.0131897 0.421203
+0.279103 -0.0228568 0.426141
+
+
+0.172873 0.403804 -0.247738
+0.170082 0.405315 -0.24695
+0.112594 0.380998 -0.304242
+-0.0464544 0.424346 -0.297982
+-0.0431059 0.42637 -0.294361
+-0.104262 0.466121 -0.149203
+-0.148933 0.456729 -0.141116
+-0.151101 0.457292 -0.13747
+-0.164923 0.436861 -0.17987
+-0.240147 0.421708 -0.137986
+-0.239515 0.423763 -0.133405
+-0.310534 0.370612 -0.128901
+-0.425076 0.289819 -0.0611118
+-0.421929 0.289063 -0.0718191
+-0.420054 0.288657 -0.0780636
+
+
+0.172873 0.403804 -0.247738
+0.181842 0.434736 -0.16834
+0.0493562 0.487211 -0.158982
+0.050184 0.487374 -0.157732
+-0.0248719 0.498374 -0.0374832
+-0.128161 0.491528 -0.00154258
+-0.128177 0.491505 -0.00187677
+-0.128549 0.490795 -0.0124516
+
+
+0.172873 0.403804 -0.247738
+0.177657 0.401156 -0.249166
+0.112594 0.380998 -0.304242
+-0.035331 0.430982 -0.286066
+-0.0322798 0.432811 -0.282757
+-0.104262 0.466121 -0.149203
+-0.152007 0.457564 -0.13583
+-0.154582 0.458224 -0.131476
+-0.164923 0.436861 -0.17987
+-0.238954 0.425426 -0.129748
+-0.238268 0.427606 -0.124845
+-0.310534 0.370612 -0.128901
+-0.430822 0.291124 -0.0415199
+-0.427199 0.290272 -0.0539611
+-0.425076 0.289819 -0.0611118
+
+
+0.209723 -0.276203 0.374141
+0.200659 -0.28399 0.376572
+0.30802 -0.229117 0.320982
+0.288791 -0.208183 0.351768
+0.28974 -0.207299 0.351496
+0.291783 -0.205514 0.350835
+
+
+-0.116637 -0.0952323 0.482999
+-0.125086 -0.0901409 0.482231
+-0.0534567 -0.0227233 0.497018
+-0.00345644 -0.066556 0.497717
+-0.00162277 -0.0753546 0.497213
+-0.00100082 -0.0786375 0.49702
+
+
+-0.116637 -0.0952323 0.482999
+-0.143539 -0.180191 0.444216
+-0.0572392 -0.241628 0.442414
+-0.0549479 -0.240229 0.443669
+-0.0213985 -0.321575 0.382795
+0.108594 -0.328915 0.377091
+0.106524 -0.331868 0.374578
+0.105621 -0.333127 0.373506
+0.103077 -0.335538 0.371451
+0.100702 -0.337745 0.369569
+-0.0213985 -0.321575 0.382795
+0.102434 -0.319261 0.385194
+0.107131 -0.321538 0.383294
+0.112102 -0.323996 0.381243
+0.108594 -0.328915 0.377091
+
+
+-0.116637 -0.0952323 0.482999
+-0.116625 -0.095239 0.483
+-0.0534567 -0.0227233 0.497018
+-0.00535295 -0.0572226 0.498233
+-0.00392044 -0.0640667 0.497858
+-0.00345644 -0.066556 0.497717
+
+
+0.300913 0.0970782 0.387381
+0.301023 0.0968301 0.38736
+0.28047 0.0950224 0.403371
+0.293633 0.00842993 0.410263
+0.290783 0.00216701 0.413413
+0.287505 -0.00479067 0.416989
+
+
+0.300913 0.0970782 0.387381
+0.306576 0.110027 0.379487
+0.305799 0.11042 0.379992
+0.305024 0.110911 0.380465
+0.304498 0.111318 0.380762
+0.30579 0.128294 0.374313
+
+
+0.300913 0.0970782 0.387381
+0.299664 0.0991484 0.387812
+0.28047 0.0950224 0.403371
+0.308167 0.08414 0.384941
+0.308066 0.0824448 0.385397
+
+
+0.40512 -0.0497709 0.294039
+0.401871 -0.0472151 0.298889
+0.420272 0.0202432 0.270855
+0.394746 0.0414539 0.305345
+0.392996 0.0391048 0.308085
+0.384719 0.088236 0.307581
+0.358255 0.0956222 0.335995
+0.358971 0.0923283 0.336101
+0.335115 0.0786323 0.363201
+0.303148 0.0327402 0.398979
+0.302589 0.0278429 0.400307
+
+
+0.40512 -0.0497709 0.294039
+0.374129 -0.116155 0.311345
+0.323197 -0.0608413 0.386365
+0.314685 -0.064221 0.394774
+0.353916 0.0348819 0.352033
+0.296144 0.0137633 0.407504
+0.293633 0.00842993 0.410263
+
+
+0.40512 -0.0497709 0.294039
+0.405641 -0.0501609 0.293261
+0.420272 0.0202432 0.270855
+0.392332 0.0381452 0.309132
+0.390342 0.0354836 0.312221
+0.384719 0.088236 0.307581
+0.359116 0.0917544 0.336095
+0.359791 0.0886025 0.336189
+0.335115 0.0786323 0.363201
+0.35114 0.0614164 0.350676
+0.350766 0.0610599 0.351108
+
+
+0.504281 0.0877653 0.00759096
+0.504592 0.0861595 0.00603911
+0.49032 -0.00243348 0.0999044
+0.468764 0.0383414 0.186977
+0.468824 0.0423646 0.186501
+0.468936 0.0487317 0.185669
+
+
+0.504281 0.0877653 0.00759096
+0.463232 0.170535 -0.0817646
+
+
+0.504281 0.0877653 0.00759096
+0.502827 0.0951671 0.0148799
+0.49032 -0.00243348 0.0999044
+0.468569 0.0285651 0.188194
+0.468638 0.0323751 0.187749
+0.468764 0.0383414 0.186977
+
+
+0.437559 0.0741709 0.235052
+0.438546 0.0734742 0.233539
+0.420272 0.0202432 0.270855
+0.390098 0.0341447 0.312692
+0.390134 0.0351871 0.312545
+0.388208 0.0377601 0.314376
+0.386876 0.0396389 0.315621
+0.384719 0.088236 0.307581
+0.35993 0.088048 0.336181
+0.360579 0.0849716 0.336265
+0.335115 0.0786323 0.363201
+0.352941 0.0627011 0.348663
+0.352526 0.0623217 0.349143
+0.35114 0.0614164 0.350676
+
+
+0.437559 0.0741709 0.235052
+0.426136 0.138953 0.222487
+0.38634 0.227274 0.234777
+0.381044 0.234334 0.239671
+0.434716 0.190815 0.158152
+0.353992 0.296076 0.233746
+0.353798 0.291908 0.23927
+0.219585 0.354976 0.275998
+0.162991 0.37704 0.288161
+0.162466 0.377917 0.287399
+0.160069 0.38212 0.283668
+
+
+0.437559 0.0741709 0.235052
+0.435089 0.0758111 0.238855
+0.420272 0.0202432 0.270855
+0.389114 0.0131759 0.315668
+0.389297 0.0170853 0.315154
+
+
+0.430825 0.0786936 0.245337
+0.43175 0.0780494 0.243943
+0.420272 0.0202432 0.270855
+0.38804 -0.00552022 0.318161
+0.388319 -0.000556727 0.317537
+0.388449 0.00129064 0.317267
+
+
+0.430825 0.0786936 0.245337
+0.426136 0.138953 0.222487
+0.371351 0.247076 0.24875
+0.362521 0.258788 0.256901
+0.434716 0.190815 0.158152
+0.353605 0.286994 0.245692
+0.353389 0.282758 0.25127
+0.219585 0.354976 0.275998
+0.165601 0.37247 0.292174
+0.165126 0.373268 0.291488
+0.162991 0.37704 0.288161
+
+
+0.430825 0.0786936 0.245337
+0.428462 0.0802358 0.248911
+0.420272 0.0202432 0.270855
+0.394071 -0.0411669 0.310374
+0.393506 -0.0407497 0.311194
+
+
+0.429317 -0.236868 0.103196
+0.423384 -0.257407 0.0675791
+
+
+0.429317 -0.236868 0.103196
+0.429586 -0.236711 0.102194
+
+
+0.429317 -0.236868 0.103196
+0.427578 -0.23774 0.110019
+0.452817 -0.199577 0.0743398
+0.471796 -0.110874 0.162807
+0.468791 -0.111976 0.175881
+0.49032 -0.00243348 0.0999044
+0.468346 0.0191765 0.189348
+0.468426 0.0228577 0.188925
+0.468569 0.0285651 0.188194
+
+
+0.374129 -0.116155 0.311345
+0.312727 -0.0650271 0.396698
+0.311983 -0.0653216 0.397429
+
+
+0.374129 -0.116155 0.311345
+0.315275 -0.0797952 0.388959
+
+
+0.374129 -0.116155 0.311345
+0.31803 -0.0920256 0.381775
+
+
+0.374129 -0.116155 0.311345
+0.320267 -0.102044 0.375862
+
+
+0.374129 -0.116155 0.311345
+0.323778 -0.117988 0.366377
+0.324403 -0.121009 0.364594
+0.27822 -0.176201 0.376759
+0.195106 -0.0597598 0.483134
+0.197557 -0.0559772 0.483015
+0.2021 -0.0490454 0.482762
+
+
+0.374129 -0.116155 0.311345
+0.325224 -0.12467 0.362366
+0.325788 -0.127432 0.360728
+
+
+0.374129 -0.116155 0.311345
+0.327759 -0.136588 0.355143
+0.328246 -0.139051 0.353666
+0.27822 -0.176201 0.376759
+0.185377 -0.0745967 0.483595
+0.187718 -0.0709945 0.483497
+0.195106 -0.0597598 0.483134
+
+
+0.374129 -0.116155 0.311345
+0.328915 -0.142127 0.351753
+0.329381 -0.144523 0.350306
+
+
+0.374129 -0.116155 0.311345
+0.332227 -0.158441 0.341634
+0.332689 -0.160919 0.340107
+0.27822 -0.176201 0.376759
+0.175967 -0.0888987 0.483975
+0.178248 -0.0854005 0.483896
+0.185377 -0.0745967 0.483595
+
+
+0.374129 -0.116155 0.311345
+0.333351 -0.164136 0.338055
+0.333816 -0.166656 0.336491
+
+
+0.374129 -0.116155 0.311345
+0.33598 -0.168177 0.333402
+
+
+0.374129 -0.116155 0.311345
+0.339558 -0.17071 0.328249
+
+
+0.374129 -0.116155 0.311345
+0.343005 -0.173155 0.323242
+
+
+0.374129 -0.116155 0.311345
+0.349783 -0.177972 0.313271
+
+
+0.374129 -0.116155 0.311345
+0.353246 -0.180439 0.308113
+0.353573 -0.180686 0.307616
+
+
+0.374129 -0.116155 0.311345
+0.36069 -0.185753 0.296886
+0.36106 -0.186033 0.296314
+0.30802 -0.229117 0.320982
+0.285682 -0.210941 0.352723
+0.286676 -0.210022 0.352443
+0.288791 -0.208183 0.351768
+
+
+0.374129 -0.116155 0.311345
+0.364862 -0.188738 0.290518
+0.365271 -0.189046 0.289883
+0.30802 -0.229117 0.320982
+0.282386 -0.213849 0.353721
+0.283448 -0.212875 0.353425
+0.285682 -0.210941 0.352723
+
+
+0.374129 -0.116155 0.311345
+0.369514 -0.19207 0.283367
+0.369977 -0.192418 0.282644
+0.30802 -0.229117 0.320982
+0.278815 -0.216983 0.354786
+0.279976 -0.215927 0.354465
+0.282386 -0.213849 0.353721
+
+
+0.374129 -0.116155 0.311345
+0.374844 -0.195892 0.275115
+0.375384 -0.196297 0.274267
+
+
+0.374129 -0.116155 0.311345
+0.388897 -0.205989 0.253149
+0.389717 -0.206599 0.251847
+0.30802 -0.229117 0.320982
+0.274858 -0.220439 0.35595
+0.276156 -0.219267 0.355594
+0.278815 -0.216983 0.354786
+
+
+0.374129 -0.116155 0.311345
+0.398329 -0.211034 0.239055
+
+
+0.374129 -0.116155 0.311345
+0.407602 -0.209299 0.228069
+
+
+0.374129 -0.116155 0.311345
+0.417002 -0.204848 0.218027
+
+
+0.374129 -0.116155 0.311345
+0.425511 -0.19685 0.210577
+
+
+0.374129 -0.116155 0.311345
+0.431384 -0.184653 0.208234
+0.434507 -0.178147 0.206949
+0.452817 -0.199577 0.0743398
+0.468088 -0.112256 0.178897
+0.464526 -0.113537 0.194186
+0.464515 -0.113393 0.194257
+0.49032 -0.00243348 0.0999044
+0.468095 0.00998166 0.190465
+0.468187 0.0136081 0.190054
+0.468346 0.0191765 0.189348
+
+
+0.374129 -0.116155 0.311345
+0.437054 -0.172767 0.205932
+0.440114 -0.166331 0.204651
+0.452817 -0.199577 0.0743398
+0.463328 -0.116191 0.194708
+0.464526 -0.113537 0.194186
+
+
+0.374129 -0.116155 0.311345
+0.442633 -0.160958 0.203628
+0.445688 -0.15447 0.202327
+0.452817 -0.199577 0.0743398
+0.457172 -0.129673 0.19741
+0.459908 -0.123666 0.196238
+0.463328 -0.116191 0.194708
+
+
+0.374129 -0.116155 0.311345
+0.448226 -0.149002 0.201277
+0.451336 -0.142334 0.19993
+0.452817 -0.199577 0.0743398
+0.423608 -0.21993 0.170138
+0.423558 -0.220537 0.169043
+0.375883 -0.302347 0.133038
+0.423101 -0.226684 0.157681
+0.422728 -0.231448 0.148821
+0.422686 -0.231882 0.148035
+
+
+0.374129 -0.116155 0.311345
+0.453945 -0.13666 0.198832
+0.457172 -0.129673 0.19741
+
+
+0.374129 -0.116155 0.311345
+0.459908 -0.123666 0.196238
+
+
+0.374129 -0.116155 0.311345
+0.464223 -0.10984 0.196037
+0.463427 -0.0998787 0.200928
+0.49032 -0.00243348 0.0999044
+0.46781 0.000802021 0.191566
+0.467916 0.00444342 0.191159
+0.468095 0.00998166 0.190465
+
+
+0.374129 -0.116155 0.311345
+0.463139 -0.0965507 0.202591
+0.453502 -0.0886381 0.218174
+0.420272 0.0202432 0.270855
+0.39804 -0.0442368 0.304556
+0.397501 -0.043837 0.305346
+0.394071 -0.0411669 0.310374
+
+
+0.374129 -0.116155 0.311345
+0.452159 -0.0875674 0.220334
+0.44469 -0.0814519 0.232343
+0.420272 0.0202432 0.270855
+0.409421 -0.0531309 0.287564
+0.408895 -0.0527344 0.288358
+0.405641 -0.0501609 0.293261
+
+
+0.374129 -0.116155 0.311345
+0.44362 -0.0806055 0.234052
+0.43755 -0.0756514 0.243749
+0.420272 0.0202432 0.270855
+0.413287 -0.0561841 0.281685
+0.412744 -0.0557726 0.282511
+0.409421 -0.0531309 0.287564
+
+
+0.374129 -0.116155 0.311345
+0.436662 -0.0749538 0.245158
+0.431535 -0.0707854 0.253289
+0.420272 0.0202432 0.270855
+0.426302 -0.0665697 0.261528
+0.425626 -0.0660466 0.262584
+0.421618 -0.0628145 0.268842
+
+
+0.374129 -0.116155 0.311345
+0.430772 -0.0701901 0.254491
+0.426302 -0.0665697 0.261528
+
+
+0.374129 -0.116155 0.311345
+0.425626 -0.0660466 0.262584
+
+
+0.374129 -0.116155 0.311345
+0.416749 -0.05895 0.276372
+0.413287 -0.0561841 0.281685
+
+
+0.374129 -0.116155 0.311345
+0.412744 -0.0557726 0.282511
+
+
+0.374129 -0.116155 0.311345
+0.408895 -0.0527344 0.288358
+
+
+0.374129 -0.116155 0.311345
+0.401346 -0.0468241 0.299665
+0.39804 -0.0442368 0.304556
+
+
+0.374129 -0.116155 0.311345
+0.397501 -0.043837 0.305346
+
+
+0.295925 0.105542 0.388977
+0.296002 0.10533 0.388976
+0.28047 0.0950224 0.403371
+0.30611 0.0880542 0.3856
+0.308194 0.0844735 0.384845
+0.308203 0.0844558 0.384842
+0.308167 0.08414 0.384941
+
+
+0.295925 0.105542 0.388977
+0.303426 0.11211 0.381374
+0.302631 0.112857 0.381776
+0.302379 0.113143 0.381888
+0.304867 0.128298 0.375055
+
+
+0.295925 0.105542 0.388977
+0.29483 0.107287 0.38933
+0.28047 0.0950224 0.403371
+0.304181 0.091398 0.386279
+0.305932 0.0884111 0.385651
+0.30611 0.0880542 0.3856
+
+
+0.40028 -0.291498 0.0702806
+0.400696 -0.290562 0.0718772
+0.407968 -0.283 0.0590986
+0.4083 -0.282196 0.0605875
+0.408422 -0.28196 0.0608512
+0.414457 -0.273363 0.0595833
+
+
+0.40028 -0.291498 0.0702806
+0.380791 -0.315481 0.0766182
+0.400213 -0.283352 0.100746
+0.397979 -0.286086 0.101256
+0.375883 -0.302347 0.133038
+0.410854 -0.211888 0.220219
+0.4131 -0.208255 0.221516
+
+
+0.40028 -0.291498 0.0702806
+0.400042 -0.2921 0.0690644
+
+
+0.429035 -0.264619 -0.0574011
+0.424672 -0.271409 -0.0589251
+0.416019 -0.275316 0.0344023
+0.415323 -0.276339 0.0346784
+
+
+0.429035 -0.264619 -0.0574011
+0.415805 -0.23012 -0.156689
+0.457336 -0.155456 -0.145136
+0.458022 -0.156381 -0.14194
+0.479066 -0.0747935 -0.1237
+0.512711 0.04038 -0.0393387
+0.512211 0.0407533 -0.041675
+0.50945 0.042693 -0.0544952
+
+
+0.429035 -0.264619 -0.0574011
+0.430207 -0.262792 -0.0569648
+0.416754 -0.274226 0.0341186
+0.416062 -0.275252 0.0343956
+0.419692 -0.267436 0.0493671
+
+
+0.393265 -0.317414 -0.0537248
+0.391873 -0.318016 -0.0399099
+0.412271 -0.280578 0.0372465
+0.411754 -0.281248 0.0379433
+0.411645 -0.281384 0.0381216
+0.418557 -0.268802 0.0516866
+
+
+0.393265 -0.317414 -0.0537248
+0.344351 -0.361304 0.035808
+0.36475 -0.338086 0.0539154
+0.366319 -0.336841 0.0511308
+0.366377 -0.336796 0.0510151
+
+
+0.393265 -0.317414 -0.0537248
+0.393945 -0.31708 -0.0600757
+0.412828 -0.279835 0.0366399
+0.412271 -0.280578 0.0372465
+
+
+0.417816 -0.265413 0.0708933
+0.416046 -0.271639 0.0566333
+
+
+0.400951 -0.289909 0.0731775
+0.401392 -0.288894 0.0749111
+0.4083 -0.282196 0.0605875
+
+
+0.400951 -0.289909 0.0731775
+0.380791 -0.315481 0.0766182
+0.396429 -0.288014 0.101503
+0.394586 -0.290253 0.101931
+0.375883 -0.302347 0.133038
+0.398813 -0.231251 0.213347
+0.406437 -0.21896 0.217759
+0.410854 -0.211888 0.220219
+
+
+0.400951 -0.289909 0.0731775
+0.400696 -0.290562 0.0718772
+
+
+0.440451 -0.230391 0.0568413
+0.43978 -0.230832 0.0599459
+0.452817 -0.199577 0.0743398
+0.423146 -0.226179 0.158594
+0.423101 -0.226684 0.157681
+
+
+0.385893 -0.320336 0.0151213
+0.38606 -0.320023 0.0157516
+0.387613 -0.317156 0.0212331
+0.409537 -0.283904 0.0419761
+0.409337 -0.284105 0.0425505
+0.417839 -0.26964 0.0531213
+
+
+0.385893 -0.320336 0.0151213
+0.382185 -0.323558 0.0220353
+0.344351 -0.361304 0.035808
+0.36314 -0.339345 0.0567671
+0.364694 -0.338129 0.0540283
+0.36475 -0.338086 0.0539154
+
+
+0.385893 -0.320336 0.0151213
+0.385965 -0.320317 0.0144788
+0.344351 -0.361304 0.035808
+0.361515 -0.340598 0.0596254
+0.363083 -0.339387 0.0568791
+0.36314 -0.339345 0.0567671
+
+
+0.445568 -0.226587 0.0324366
+0.445368 -0.226758 0.033362
+
+
+0.474382 -0.184662 -0.0515984
+0.470605 -0.192904 -0.0498774
+0.452817 -0.199577 0.0743398
+0.422728 -0.231448 0.148821
+
+
+0.474382 -0.184662 -0.0515984
+0.415805 -0.23012 -0.156689
+0.45901 -0.157828 -0.137181
+0.459691 -0.158757 -0.133951
+0.479066 -0.0747935 -0.1237
+0.512073 0.0250371 -0.03389
+0.512538 0.034509 -0.0369451
+0.512811 0.0403086 -0.0388673
+0.512711 0.04038 -0.0393387
+
+
+0.474382 -0.184662 -0.0515984
+0.475343 -0.182561 -0.0520148
+0.475822 -0.181197 -0.0510834
+0.477489 -0.176408 -0.0478817
+0.479066 -0.0747935 -0.1237
+0.511341 0.0109476 -0.029293
+0.511791 0.0194568 -0.0320372
+0.512073 0.0250371 -0.03389
+
+
+0.437054 -0.172767 0.205932
+0.434507 -0.178147 0.206949
+
+
+0.364862 -0.188738 0.290518
+0.36106 -0.186033 0.296314
+
+
+0.365774 -0.233805 0.256831
+0.371458 -0.229694 0.25394
+0.319882 -0.304039 0.235874
+0.361705 -0.2368 0.258839
+0.365774 -0.233805 0.256831
+0.30802 -0.229117 0.320982
+0.270359 -0.22435 0.357256
+0.27185 -0.223015 0.35685
+0.274858 -0.220439 0.35595
+
+
+0.178742 -0.283153 0.392407
+0.184449 -0.283863 0.388047
+0.179438 -0.375372 0.278026
+0.253963 -0.337594 0.274922
+0.25374 -0.334878 0.278652
+0.319882 -0.304039 0.235874
+0.353739 -0.242576 0.262815
+0.357101 -0.24011 0.26117
+0.361705 -0.2368 0.258839
+
+
+0.178742 -0.283153 0.392407
+0.27822 -0.176201 0.376759
+0.167652 -0.103586 0.483357
+0.168596 -0.119 0.476044
+0.0527917 -0.222753 0.444966
+0.172673 -0.187404 0.442824
+0.172819 -0.189686 0.441681
+0.173281 -0.198399 0.43733
+0.0527917 -0.222753 0.444966
+0.172023 -0.175948 0.448495
+0.172179 -0.178344 0.447306
+0.172673 -0.187404 0.442824
+
+
+0.178742 -0.283153 0.392407
+0.177464 -0.283004 0.393372
+0.171258 -0.286973 0.392255
+0.165966 -0.290304 0.391331
+0.0527917 -0.222753 0.444966
+0.171315 -0.163765 0.454472
+0.171485 -0.166335 0.453208
+0.172023 -0.175948 0.448495
+
+
+-0.332027 -0.387682 0.00419519
+-0.328338 -0.390843 0.00312415
+-0.335423 -0.353515 -0.113662
+-0.279391 -0.410862 -0.0857236
+-0.279379 -0.410902 -0.0856213
+-0.225451 -0.420597 -0.150567
+-0.188643 -0.444009 -0.134092
+-0.188324 -0.445685 -0.129503
+-0.153551 -0.446874 -0.1647
+0.00327124 -0.521672 -0.0847503
+-0.00143953 -0.516956 -0.0942928
+-0.008875 -0.5096 -0.109099
+
+
+-0.332027 -0.387682 0.00419519
+-0.295876 -0.38485 0.121445
+-0.251962 -0.416382 0.119605
+-0.252417 -0.414769 0.123814
+-0.208416 -0.429931 0.148736
+-0.132042 -0.463083 0.148739
+-0.142119 -0.457074 0.153519
+-0.176814 -0.420902 0.204888
+-0.0162848 -0.458948 0.248614
+-0.0160222 -0.459557 0.247572
+-0.012772 -0.467315 0.23423
+
+
+-0.332027 -0.387682 0.00419519
+-0.337276 -0.383166 0.0056508
+-0.335423 -0.353515 -0.113662
+-0.278294 -0.414893 -0.0751256
+-0.27828 -0.41494 -0.0750047
+-0.225451 -0.420597 -0.150567
+-0.189037 -0.445496 -0.129022
+-0.188323 -0.445691 -0.129485
+-0.187013 -0.446351 -0.128977
+-0.183997 -0.447827 -0.127934
+-0.153551 -0.446874 -0.1647
+-0.00162104 -0.526699 -0.0657178
+-0.00312122 -0.527508 -0.0619718
+-0.00441441 -0.528701 -0.0522179
+-0.00477167 -0.52904 -0.0493959
+0.183592 -0.464325 -0.0331205
+0.215355 -0.450243 -0.0335044
+0.21537 -0.450073 -0.0356658
+0.215303 -0.450008 -0.0369248
+0.183592 -0.464325 -0.0331205
+0.215401 -0.450464 -0.0300997
+0.21542 -0.450302 -0.0322588
+0.215355 -0.450243 -0.0335044
+
+
+0.325224 -0.12467 0.362366
+0.324403 -0.121009 0.364594
+
+
+0.328915 -0.142127 0.351753
+0.328246 -0.139051 0.353666
+
+
+0.301652 -0.279035 0.287705
+0.3043 -0.277276 0.286475
+0.319882 -0.304039 0.235874
+0.346988 -0.247444 0.26616
+0.349864 -0.245342 0.264767
+0.353739 -0.242576 0.262815
+
+
+0.301652 -0.279035 0.287705
+0.30802 -0.229117 0.320982
+0.250669 -0.241314 0.362826
+0.253448 -0.238883 0.362078
+
+
+0.301652 -0.279035 0.287705
+0.299462 -0.280535 0.288669
+
+
+-0.290748 -0.420371 -0.015194
+-0.188258 -0.456482 -0.0811385
+-0.0337643 -0.514389 -0.0731235
+-0.00312122 -0.527508 -0.0619718
+
+
+-0.290748 -0.420371 -0.015194
+-0.291573 -0.420494 -0.0119879
+-0.292863 -0.420715 -0.00680336
+-0.287546 -0.423717 -0.00294531
+-0.188258 -0.456482 -0.0811385
+-0.00441441 -0.528701 -0.0522179
+
+
+-0.290748 -0.420371 -0.015194
+-0.287604 -0.419803 -0.0277558
+-0.335423 -0.353515 -0.113662
+-0.27843 -0.418037 -0.0636676
+-0.280619 -0.418499 -0.0551114
+-0.188258 -0.456482 -0.0811385
+-0.00698288 -0.531011 -0.0327056
+-0.00734887 -0.531346 -0.0298142
+0.183592 -0.464325 -0.0331205
+0.215443 -0.450676 -0.0266446
+0.215464 -0.450519 -0.0288434
+0.215401 -0.450464 -0.0300997
+
+
+0.21 -0.410576 0.193582
+0.21079 -0.410231 0.193483
+0.211365 -0.409957 0.193455
+0.211519 -0.409889 0.193436
+0.212186 -0.409569 0.193403
+0.212812 -0.409245 0.193419
+0.213397 -0.408919 0.193479
+0.213944 -0.408593 0.193578
+0.214425 -0.408286 0.193705
+0.214454 -0.408269 0.193711
+0.214938 -0.407958 0.193838
+0.215394 -0.407645 0.193997
+0.215823 -0.407331 0.194187
+0.216225 -0.407015 0.194405
+0.216601 -0.406699 0.194651
+0.216947 -0.406386 0.194921
+0.21695 -0.406383 0.194923
+0.217299 -0.406065 0.195195
+0.217626 -0.405743 0.195497
+0.21793 -0.405418 0.19583
+0.21821 -0.405088 0.196194
+0.218465 -0.404755 0.196589
+0.218692 -0.40442 0.197018
+0.218699 -0.404408 0.197033
+0.21893 -0.404066 0.197468
+0.21914 -0.403704 0.19796
+0.219317 -0.403336 0.198497
+0.219458 -0.402963 0.19908
+0.284308 -0.366182 0.197114
+0.284115 -0.366106 0.197488
+0.319882 -0.304039 0.235874
+0.341085 -0.251675 0.269063
+0.343621 -0.249831 0.267847
+0.346988 -0.247444 0.26616
+
+
+0.21 -0.410576 0.193582
+0.209153 -0.410913 0.193756
+0.208251 -0.411233 0.194016
+0.208056 -0.411294 0.19409
+0.201245 -0.407776 0.207952
+0.201211 -0.4078 0.207936
+0.200208 -0.408691 0.207143
+0.200171 -0.408717 0.207127
+0.199081 -0.409679 0.206262
+0.199037 -0.409707 0.206246
+0.197826 -0.410771 0.20528
+0.197771 -0.410804 0.205266
+0.196391 -0.412014 0.204151
+0.196267 -0.41207 0.204157
+0.194746 -0.413463 0.20279
+0.19662 -0.413073 0.201778
+0.19724 -0.413278 0.200758
+0.198973 -0.413138 0.199356
+0.199122 -0.413156 0.199174
+0.200695 -0.413035 0.197875
+0.201693 -0.412848 0.197274
+0.202257 -0.412794 0.196825
+0.203648 -0.412538 0.195967
+0.204766 -0.412256 0.19543
+0.204981 -0.412214 0.1953
+0.206135 -0.411921 0.194742
+0.207234 -0.411584 0.194325
+0.208056 -0.411294 0.19409
+
+
+0.21 -0.410576 0.193582
+0.152244 -0.480291 0.100265
+0.162327 -0.476343 0.0979574
+0.183592 -0.464325 -0.0331205
+0.215479 -0.450882 -0.0230693
+0.215504 -0.450729 -0.0253528
+0.215443 -0.450676 -0.0266446
+
+
+0.345925 -0.351955 0.0863121
+0.346052 -0.351868 0.0860864
+0.344351 -0.361304 0.035808
+0.359843 -0.34187 0.0625466
+0.361457 -0.34064 0.0597388
+0.361515 -0.340598 0.0596254
+
+
+0.345925 -0.351955 0.0863121
+0.380791 -0.315481 0.0766182
+0.393285 -0.291866 0.102126
+0.39171 -0.293764 0.102498
+0.375883 -0.302347 0.133038
+0.389973 -0.245403 0.208303
+0.395636 -0.23631 0.211588
+0.398813 -0.231251 0.213347
+
+
+0.345925 -0.351955 0.0863121
+0.342185 -0.354577 0.0925813
+0.344351 -0.361304 0.035808
+0.358088 -0.343187 0.0655915
+0.359782 -0.341914 0.0626635
+0.359843 -0.34187 0.0625466
+
+
+0.359782 -0.341914 0.0626635
+0.380791 -0.315481 0.0766182
+0.390582 -0.295157 0.102656
+0.389195 -0.296815 0.102991
+0.375883 -0.302347 0.133038
+0.383083 -0.256377 0.204372
+0.387534 -0.249262 0.206961
+0.389973 -0.245403 0.208303
+
+
+0.361457 -0.34064 0.0597388
+0.380791 -0.315481 0.0766182
+0.388189 -0.298052 0.103121
+0.386934 -0.299538 0.103429
+0.375883 -0.302347 0.133038
+0.377459 -0.265282 0.201165
+0.381116 -0.259467 0.203296
+0.383083 -0.256377 0.204372
+
+
+0.366319 -0.336841 0.0511308
+0.380791 -0.315481 0.0766182
+0.386014 -0.300664 0.103539
+0.384852 -0.302028 0.103829
+0.375883 -0.302347 0.133038
+0.372694 -0.272781 0.198447
+0.375809 -0.267856 0.200267
+0.377459 -0.265282 0.201165
+
+
+0.369752 -0.334067 0.0449516
+0.380791 -0.315481 0.0766182
+0.383992 -0.303076 0.103923
+0.382892 -0.304356 0.104201
+0.375883 -0.302347 0.133038
+0.368526 -0.279293 0.196072
+0.371263 -0.274995 0.197672
+0.372694 -0.272781 0.198447
+
+
+0.37164 -0.332512 0.0415193
+0.380791 -0.315481 0.0766182
+0.382069 -0.305351 0.104285
+0.381006 -0.306577 0.104555
+0.375883 -0.302347 0.133038
+0.364781 -0.285104 0.193937
+0.36725 -0.281253 0.195384
+0.368526 -0.279293 0.196072
+
+
+0.367993 -0.335497 0.0481279
+0.380791 -0.315481 0.0766182
+0.380204 -0.307541 0.104632
+0.379157 -0.308738 0.104897
+0.375883 -0.302347 0.133038
+0.361333 -0.290414 0.191972
+0.363614 -0.286881 0.19331
+0.364781 -0.285104 0.193937
+
+
+0.364694 -0.338129 0.0540283
+0.380791 -0.315481 0.0766182
+0.37836 -0.30969 0.104972
+0.377308 -0.310883 0.105236
+0.375883 -0.302347 0.133038
+0.358085 -0.295376 0.190122
+0.360241 -0.292063 0.191388
+0.361333 -0.290414 0.191972
+
+
+0.358024 -0.343233 0.0657144
+0.358088 -0.343187 0.0655915
+
+
+0.358024 -0.343233 0.0657144
+0.380791 -0.315481 0.0766182
+0.376499 -0.311841 0.105311
+0.375422 -0.313054 0.105577
+0.375883 -0.302347 0.133038
+0.354963 -0.300108 0.188344
+0.357042 -0.296938 0.189565
+0.358085 -0.295376 0.190122
+
+
+0.358024 -0.343233 0.0657144
+0.35621 -0.344579 0.0688319
+0.344351 -0.361304 0.035808
+0.349198 -0.349644 0.0807803
+0.35176 -0.34781 0.0764477
+0.351849 -0.347749 0.0762848
+
+
+0.349093 -0.349716 0.080969
+0.349198 -0.349644 0.0807803
+
+
+0.349093 -0.349716 0.080969
+0.380791 -0.315481 0.0766182
+0.374585 -0.314036 0.105656
+0.373462 -0.315294 0.105927
+0.375883 -0.302347 0.133038
+0.3519 -0.304711 0.186601
+0.353946 -0.301618 0.187802
+0.354963 -0.300108 0.188344
+
+
+0.349093 -0.349716 0.080969
+0.346052 -0.351868 0.0860864
+
+
+0.342024 -0.354687 0.0928625
+0.342185 -0.354577 0.0925813
+
+
+0.342024 -0.354687 0.0928625
+0.380791 -0.315481 0.0766182
+0.372578 -0.31632 0.106014
+0.371381 -0.317652 0.106294
+0.375883 -0.302347 0.133038
+0.348838 -0.309277 0.184858
+0.35089 -0.306199 0.186063
+0.3519 -0.304711 0.186601
+
+
+0.342024 -0.354687 0.0928625
+0.337213 -0.358029 0.100896
+
+
+0.330147 -0.362896 0.112686
+0.330448 -0.362692 0.112171
+
+
+0.330147 -0.362896 0.112686
+0.380791 -0.315481 0.0766182
+0.37043 -0.318748 0.106394
+0.369127 -0.32019 0.106687
+0.375883 -0.302347 0.133038
+0.345716 -0.313892 0.183082
+0.347815 -0.310771 0.184313
+0.348838 -0.309277 0.184858
+
+
+0.330147 -0.362896 0.112686
+0.329845 -0.363103 0.113188
+0.325546 -0.366595 0.116741
+0.375883 -0.302347 0.133038
+0.342472 -0.318651 0.181237
+0.344661 -0.315423 0.182519
+0.345716 -0.313892 0.183082
+
+
+-0.273798 -0.145203 0.405789
+-0.282594 -0.14165 0.399405
+-0.310123 -0.0280028 0.391714
+-0.301219 -0.134115 0.385736
+-0.302835 -0.133475 0.384533
+-0.309444 -0.130756 0.379627
+-0.310123 -0.0280028 0.391714
+-0.292357 -0.137711 0.392266
+-0.294114 -0.137019 0.390969
+-0.301219 -0.134115 0.385736
+
+
+-0.273798 -0.145203 0.405789
+-0.327379 -0.209631 0.315085
+-0.218044 -0.33129 0.337273
+-0.210929 -0.330286 0.344987
+-0.176814 -0.420902 0.204888
+-0.019735 -0.450665 0.262717
+-0.0194747 -0.451273 0.261687
+-0.0162848 -0.458948 0.248614
+
+
+-0.273798 -0.145203 0.405789
+-0.271569 -0.146074 0.407409
+-0.310123 -0.0280028 0.391714
+-0.261956 -0.143535 0.415092
+-0.265474 -0.148521 0.411802
+-0.271569 -0.146074 0.407409
+
+
+0.191221 -0.0203406 0.484335
+0.190842 -0.0193246 0.484384
+
+
+0.191221 -0.0203406 0.484335
+0.0256701 -0.00678241 0.499695
+0.010394 0.124872 0.496965
+-0.00314564 0.130661 0.497422
+0.110458 0.196023 0.446961
+-0.0369937 0.190843 0.478923
+-0.037055 0.182058 0.482717
+-0.178942 0.188749 0.427498
+-0.225679 0.061018 0.457815
+-0.228372 0.0629375 0.455892
+-0.235535 0.0681519 0.450733
+
+
+0.191221 -0.0203406 0.484335
+0.197568 -0.0370515 0.48344
+
+
+0.236259 -0.304505 0.329527
+0.230763 -0.301734 0.336612
+0.30802 -0.229117 0.320982
+0.208005 -0.29022 0.365536
+0.20676 -0.289604 0.367088
+0.198828 -0.285541 0.377075
+0.200659 -0.28399 0.376572
+
+
+0.236259 -0.304505 0.329527
+0.179438 -0.375372 0.278026
+0.253497 -0.332598 0.281824
+0.253252 -0.329724 0.285746
+0.319882 -0.304039 0.235874
+0.335783 -0.255452 0.27165
+0.338077 -0.253793 0.270561
+0.341085 -0.251675 0.269063
+
+
+0.236259 -0.304505 0.329527
+0.237104 -0.304912 0.328452
+0.30802 -0.229117 0.320982
+0.21645 -0.294509 0.354861
+0.21536 -0.293973 0.356225
+0.208005 -0.29022 0.365536
+
+
+0.32479 -0.344019 0.17123
+0.326492 -0.34163 0.172154
+0.375883 -0.302347 0.133038
+0.339033 -0.323657 0.179281
+0.341361 -0.320249 0.180643
+0.342472 -0.318651 0.181237
+
+
+0.32479 -0.344019 0.17123
+0.319882 -0.304039 0.235874
+0.330903 -0.258905 0.274011
+0.333028 -0.257377 0.273012
+0.335783 -0.255452 0.27165
+
+
+0.32479 -0.344019 0.17123
+0.321012 -0.349383 0.169041
+0.375883 -0.302347 0.133038
+0.335308 -0.329037 0.177163
+0.337839 -0.325362 0.178641
+0.339033 -0.323657 0.179281
+
+
+0.31299 0.359488 -0.202594
+0.181842 0.434736 -0.16834
+0.0575795 0.488766 -0.146748
+0.0583436 0.488912 -0.145591
+-0.0248719 0.498374 -0.0374832
+-0.127739 0.492264 0.010035
+-0.127756 0.49224 0.00967674
+-0.128161 0.491528 -0.00154258
+
+
+0.316118 0.140116 0.361224
+0.312852 0.128227 0.368429
+
+
+0.305914 -0.398728 -0.0124384
+0.307852 -0.397244 -0.0169004
+0.246306 -0.434405 -0.0320329
+0.314061 -0.392388 -0.0311067
+0.315152 -0.391521 -0.0335532
+0.31762 -0.389542 -0.0393193
+0.246306 -0.434405 -0.0320329
+0.310839 -0.394927 -0.023714
+0.311836 -0.394146 -0.0259344
+0.314061 -0.392388 -0.0311067
+
+
+0.305914 -0.398728 -0.0124384
+0.344351 -0.361304 0.035808
+0.323052 -0.368631 0.118737
+0.31718 -0.373372 0.123565
+0.375883 -0.302347 0.133038
+0.331181 -0.334954 0.174818
+0.333997 -0.330897 0.176458
+0.335308 -0.329037 0.177163
+
+
+0.305914 -0.398728 -0.0124384
+0.305023 -0.399404 -0.0104827
+0.246306 -0.434405 -0.0320329
+0.302286 -0.401459 -0.00431323
+0.303154 -0.400811 -0.00620596
+0.305023 -0.399404 -0.0104827
+
+
+0.495686 0.0540845 -0.111463
+0.467061 -0.0515947 -0.172025
+0.488733 0.0626703 -0.133209
+0.48647 0.0654346 -0.140139
+
+
+0.495686 0.0540845 -0.111463
+0.493421 0.0569347 -0.118607
+0.492198 0.0584238 -0.122452
+0.467061 -0.0515947 -0.172025
+0.498959 0.0485939 -0.100707
+
+
+0.495686 0.0540845 -0.111463
+0.496934 0.0525425 -0.107484
+0.463241 0.169908 -0.0829492
+
+
+0.385481 -0.326486 -0.0793944
+0.39097 -0.320753 -0.0734755
+0.415805 -0.23012 -0.156689
+0.460679 -0.160225 -0.129095
+0.461366 -0.161178 -0.125768
+0.479066 -0.0747935 -0.1237
+0.510621 -0.00195273 -0.0250816
+0.511065 0.00587404 -0.0276058
+0.511341 0.0109476 -0.029293
+
+
+0.385481 -0.326486 -0.0793944
+0.344351 -0.361304 0.035808
+0.314063 -0.375899 0.126057
+0.306544 -0.381936 0.132211
+0.375883 -0.302347 0.133038
+0.31439 -0.358697 0.16528
+0.318983 -0.352217 0.167934
+0.321012 -0.349383 0.169041
+
+
+0.385481 -0.326486 -0.0793944
+0.383977 -0.328043 -0.0810394
+0.415805 -0.23012 -0.156689
+0.462374 -0.162695 -0.120716
+0.463083 -0.163692 -0.11722
+0.479066 -0.0747935 -0.1237
+0.509899 -0.0140276 -0.0211374
+0.510346 -0.00667079 -0.0235105
+0.510621 -0.00195273 -0.0250816
+
+
+0.388542 -0.31539 0.0248029
+0.389699 -0.31324 0.0288776
+0.40918 -0.284275 0.042917
+0.408838 -0.284614 0.0438923
+
+
+0.388542 -0.31539 0.0248029
+0.380791 -0.315481 0.0766182
+0.368078 -0.321386 0.106804
+0.366627 -0.322984 0.107119
+0.375883 -0.302347 0.133038
+0.30606 -0.370351 0.16055
+0.31188 -0.362187 0.163904
+0.31439 -0.358697 0.16528
+
+
+0.388542 -0.31539 0.0248029
+0.387613 -0.317156 0.0212331
+
+
+0.385965 -0.320317 0.0144788
+0.386207 -0.320223 0.0125573
+0.409921 -0.283482 0.0410748
+0.409537 -0.283904 0.0419761
+
+
+0.378778 -0.326488 0.0283822
+0.378886 -0.326397 0.0281691
+0.344351 -0.361304 0.035808
+0.302453 -0.385232 0.135479
+0.302194 -0.385439 0.13569
+0.302615 -0.382688 0.14107
+0.302734 -0.381977 0.142433
+0.375883 -0.302347 0.133038
+0.303477 -0.376999 0.152071
+0.304015 -0.373184 0.159423
+0.30606 -0.370351 0.16055
+
+
+0.378778 -0.326488 0.0283822
+0.380791 -0.315481 0.0766182
+0.365442 -0.324324 0.10726
+0.363783 -0.326142 0.107606
+0.375883 -0.302347 0.133038
+0.334984 -0.357527 0.112415
+0.329845 -0.363103 0.113188
+
+
+0.378778 -0.326488 0.0283822
+0.376148 -0.328732 0.0332353
+
+
+0.373716 -0.330782 0.0377232
+0.380791 -0.315481 0.0766182
+0.362407 -0.327684 0.107778
+0.360454 -0.329816 0.108172
+0.375883 -0.302347 0.133038
+0.344591 -0.347125 0.110825
+0.340865 -0.351187 0.11137
+0.334984 -0.357527 0.112415
+
+
+0.363083 -0.339387 0.0568791
+0.380791 -0.315481 0.0766182
+0.358805 -0.331649 0.108388
+0.356424 -0.334239 0.108851
+0.375883 -0.302347 0.133038
+0.351341 -0.339788 0.109702
+0.34866 -0.342728 0.110082
+0.344591 -0.347125 0.110825
+
+
+0.35614 -0.344628 0.0689638
+0.35621 -0.344579 0.0688319
+
+
+0.35614 -0.344628 0.0689638
+0.380791 -0.315481 0.0766182
+0.354371 -0.336505 0.109132
+0.351341 -0.339788 0.109702
+
+
+0.35614 -0.344628 0.0689638
+0.354154 -0.346083 0.0723569
+
+
+0.35176 -0.34781 0.0764477
+0.380791 -0.315481 0.0766182
+0.34866 -0.342728 0.110082
+
+
+0.376057 -0.328807 0.0334154
+0.380791 -0.315481 0.0766182
+0.340865 -0.351187 0.11137
+
+
+0.457752 -0.117171 -0.169923
+0.479066 -0.0747935 -0.1237
+0.509161 -0.0255653 -0.0173664
+0.509619 -0.018508 -0.0196436
+0.509899 -0.0140276 -0.0211374
+
+
+0.457752 -0.117171 -0.169923
+0.455184 -0.125528 -0.173395
+0.452315 -0.135059 -0.177152
+0.479066 -0.0747935 -0.1237
+0.508395 -0.036809 -0.0136893
+0.508872 -0.0299056 -0.0159178
+0.509161 -0.0255653 -0.0173664
+
+
+0.457752 -0.117171 -0.169923
+0.459538 -0.111178 -0.167582
+0.467061 -0.0515947 -0.172025
+0.490978 0.012489 -0.116038
+
+
+0.45901 -0.157828 -0.137181
+0.458022 -0.156381 -0.14194
+
+
+0.35239 -0.0490503 0.357106
+0.353398 -0.0486194 0.356081
+
+
+0.347815 -0.310771 0.184313
+0.319882 -0.304039 0.235874
+0.326312 -0.262132 0.276212
+0.328323 -0.260695 0.275276
+0.330903 -0.258905 0.274011
+
+
+-0.455544 -0.0962327 0.238944
+-0.413046 -0.239792 0.149308
+-0.374064 -0.301187 0.148812
+-0.37446 -0.301313 0.147519
+-0.376196 -0.301755 0.142039
+-0.413046 -0.239792 0.149308
+-0.371874 -0.300593 0.155694
+-0.372284 -0.300725 0.154369
+-0.374064 -0.301187 0.148812
+
+
+-0.455544 -0.0962327 0.238944
+-0.446952 -0.105591 0.248254
+-0.445976 -0.106662 0.249301
+-0.413046 -0.239792 0.149308
+-0.369581 -0.299959 0.162823
+-0.370014 -0.3001 0.16144
+-0.371874 -0.300593 0.155694
+
+
+-0.455544 -0.0962327 0.238944
+-0.45657 -0.0950988 0.237833
+-0.361072 0.00364482 0.34643
+-0.35841 -0.0831263 0.345109
+-0.359799 -0.0878969 0.343431
+-0.365147 -0.105557 0.337004
+-0.361072 0.00364482 0.34643
+-0.353942 -0.0683107 0.350441
+-0.354895 -0.0715982 0.349298
+-0.35841 -0.0831263 0.345109
+
+
+0.346268 -0.0515424 0.363314
+0.347361 -0.0510785 0.362212
+
+
+0.318817 0.135127 0.360711
+0.318601 0.13582 0.360646
+
+
+0.318817 0.135127 0.360711
+0.315275 0.12819 0.366336
+
+
+0.318817 0.135127 0.360711
+0.319351 0.134101 0.360616
+0.319755 0.132629 0.360796
+0.316809 0.128169 0.364999
+
+
+0.358085 -0.0467198 0.351285
+0.359034 -0.0463112 0.350312
+
+
+0.431535 -0.0707854 0.253289
+0.430772 -0.0701901 0.254491
+
+
+0.445004 0.069089 0.223481
+0.446149 0.0682712 0.221693
+0.420272 0.0202432 0.270855
+0.4633 -0.093695 0.202291
+0.463967 -0.0822286 0.201
+0.49032 -0.00243348 0.0999044
+0.467486 -0.00853974 0.192672
+0.467608 -0.00481254 0.19226
+0.46781 0.000802021 0.191566
+
+
+0.445004 0.069089 0.223481
+0.426136 0.138953 0.222487
+0.351818 0.269737 0.269006
+0.349313 0.265552 0.276389
+0.219585 0.354976 0.275998
+0.167989 0.368261 0.295844
+0.167549 0.369002 0.295211
+0.165601 0.37247 0.292174
+
+
+0.445004 0.069089 0.223481
+0.4422 0.0709837 0.22787
+0.420272 0.0202432 0.270855
+0.46433 -0.0754189 0.200287
+0.464859 -0.0658773 0.199199
+0.49032 -0.00243348 0.0999044
+0.467114 -0.0182337 0.193805
+0.467256 -0.0143431 0.19338
+0.467486 -0.00853974 0.192672
+
+
+0.380791 -0.315481 0.0766182
+0.382051 -0.323671 0.0222971
+0.382185 -0.323558 0.0220353
+
+
+0.380791 -0.315481 0.0766182
+0.38606 -0.320023 0.0157516
+
+
+0.380791 -0.315481 0.0766182
+0.390399 -0.311889 0.0316215
+0.391308 -0.310183 0.0348209
+
+
+0.380791 -0.315481 0.0766182
+0.393057 -0.306782 0.0415136
+0.393692 -0.305568 0.0437392
+0.408267 -0.285092 0.0459882
+0.408031 -0.285243 0.0471019
+0.407913 -0.285272 0.0479161
+0.417082 -0.2705 0.0546038
+
+
+0.380791 -0.315481 0.0766182
+0.394072 -0.304789 0.0453481
+0.394627 -0.303715 0.0472945
+0.408031 -0.285243 0.0471019
+
+
+0.380791 -0.315481 0.0766182
+0.394956 -0.303024 0.0487279
+0.395454 -0.302048 0.0504753
+0.407838 -0.285318 0.048259
+0.40766 -0.285357 0.0494669
+0.407565 -0.285267 0.0507043
+0.407565 -0.285265 0.0507152
+0.416669 -0.270961 0.0554022
+
+
+0.380791 -0.315481 0.0766182
+0.395745 -0.301421 0.0517842
+0.396203 -0.300512 0.0533906
+0.40766 -0.285357 0.0494669
+
+
+0.380791 -0.315481 0.0766182
+0.396467 -0.299929 0.0546129
+0.396896 -0.299066 0.0561225
+0.407565 -0.285267 0.0507043
+
+
+0.380791 -0.315481 0.0766182
+0.397141 -0.29851 0.0572874
+0.39755 -0.297674 0.0587362
+0.407461 -0.285168 0.0520153
+0.407459 -0.284917 0.0533366
+0.407472 -0.284871 0.0534809
+0.416219 -0.271458 0.0562658
+
+
+0.380791 -0.315481 0.0766182
+0.397782 -0.297134 0.0598682
+0.398179 -0.296308 0.061287
+0.407459 -0.284917 0.0533366
+
+
+0.380791 -0.315481 0.0766182
+0.398404 -0.295771 0.0624077
+0.398796 -0.294942 0.0638252
+0.407465 -0.28463 0.0547423
+0.40759 -0.284171 0.0561271
+0.40772 -0.283671 0.0576269
+
+
+0.380791 -0.315481 0.0766182
+0.39902 -0.294397 0.0649554
+0.399413 -0.293549 0.0664003
+
+
+0.215993 -0.397707 0.212585
+0.214814 -0.397267 0.214568
+0.213953 -0.397344 0.215277
+0.213209 -0.396659 0.217267
+0.215165 -0.394816 0.218706
+0.214814 -0.397267 0.214568
+
+
+0.215993 -0.397707 0.212585
+0.210232 -0.399527 0.214914
+0.210179 -0.399562 0.214901
+0.209002 -0.400686 0.21397
+0.20896 -0.400716 0.213955
+0.207895 -0.401722 0.213116
+0.207859 -0.40175 0.213101
+0.206875 -0.402673 0.212326
+0.206841 -0.402698 0.212311
+0.205911 -0.403563 0.21158
+0.205879 -0.403587 0.211565
+0.204982 -0.404415 0.210859
+0.204952 -0.404438 0.210845
+0.20407 -0.405245 0.21015
+0.204039 -0.405268 0.210136
+0.203155 -0.406072 0.209439
+0.203124 -0.406095 0.209424
+0.202219 -0.406909 0.208711
+0.202188 -0.406933 0.208696
+0.201245 -0.407776 0.207952
+
+
+0.215993 -0.397707 0.212585
+0.216082 -0.397712 0.212486
+0.217115 -0.398083 0.210762
+0.217574 -0.39844 0.209636
+0.209002 -0.400686 0.21397
+
+
+0.267466 -0.42516 0.0716174
+0.271551 -0.422536 0.0628091
+0.246306 -0.434405 -0.0320329
+0.299587 -0.403452 0.00173523
+0.300449 -0.402819 -0.000132673
+0.302286 -0.401459 -0.00431323
+
+
+0.267466 -0.42516 0.0716174
+0.344351 -0.361304 0.035808
+0.296344 -0.391744 0.129269
+0.293432 -0.394848 0.126121
+0.217626 -0.405743 0.195497
+
+
+0.267466 -0.42516 0.0716174
+0.265357 -0.42651 0.076039
+0.246306 -0.434405 -0.0320329
+0.296873 -0.405422 0.00778023
+0.297745 -0.404792 0.005901
+0.299587 -0.403452 0.00173523
+
+
+0.333997 -0.330897 0.176458
+0.319882 -0.304039 0.235874
+0.321901 -0.265211 0.278307
+0.323844 -0.263831 0.277413
+0.326312 -0.262132 0.276212
+
+
+0.190018 -0.417429 0.199205
+0.192591 -0.415261 0.201186
+0.19724 -0.413278 0.200758
+
+
+0.190018 -0.417429 0.199205
+0.191838 -0.412423 0.20766
+0.190813 -0.412036 0.209397
+0.190412 -0.411717 0.210409
+0.199037 -0.409707 0.206246
+
+
+0.190018 -0.417429 0.199205
+0.189942 -0.417507 0.199118
+0.199122 -0.413156 0.199174
+
+
+0.0993931 0.0864797 0.49241
+0.089316 0.0908756 0.49308
+0.110458 0.196023 0.446961
+-0.0370474 0.17694 0.48492
+-0.0371077 0.167787 0.488831
+-0.178942 0.188749 0.427498
+-0.215074 0.0533532 0.465367
+-0.217994 0.0554327 0.4633
+-0.225679 0.061018 0.457815
+
+
+0.0993931 0.0864797 0.49241
+0.0256701 -0.00678241 0.499695
+-0.00422821 0.131113 0.497459
+-0.0197767 0.137747 0.49793
+0.110458 0.196023 0.446961
+-0.0370989 0.1624 0.491124
+-0.037159 0.152668 0.495238
+-0.178942 0.188749 0.427498
+-0.203405 0.0449319 0.473603
+-0.206644 0.0472374 0.471329
+-0.215074 0.0533532 0.465367
+
+
+0.0993931 0.0864797 0.49241
+0.100167 0.0861507 0.492355
+0.110458 0.196023 0.446961
+-0.037149 0.146881 0.497675
+-0.037159 0.145136 0.498405
+-0.0393113 0.142922 0.498538
+-0.0435224 0.138644 0.498775
+-0.178942 0.188749 0.427498
+-0.189533 0.0451238 0.479322
+-0.179596 0.0515146 0.480924
+-0.0534567 -0.0227233 0.497018
+-0.00688806 -0.0496653 0.49863
+-0.00571689 -0.0552364 0.49834
+-0.00535295 -0.0572226 0.498233
+
+
+-0.394064 -0.265514 -0.191226
+-0.399865 -0.259295 -0.19217
+
+
+-0.394064 -0.265514 -0.191226
+-0.290413 -0.331313 -0.237261
+-0.228199 -0.387402 -0.227989
+-0.228644 -0.387331 -0.227569
+-0.225451 -0.420597 -0.150567
+-0.193246 -0.444362 -0.126181
+-0.19138 -0.444881 -0.127392
+-0.189037 -0.445496 -0.129022
+
+
+-0.394064 -0.265514 -0.191226
+-0.384195 -0.276142 -0.189488
+-0.335423 -0.353515 -0.113662
+-0.281174 -0.418595 -0.0530179
+-0.283578 -0.419077 -0.0435496
+-0.188258 -0.456482 -0.0811385
+-0.00963475 -0.533312 -0.0125466
+-0.0100172 -0.53365 -0.00952594
+0.183592 -0.464325 -0.0331205
+0.215512 -0.451088 -0.0192937
+0.215539 -0.450935 -0.0217141
+0.215479 -0.450882 -0.0230693
+
+
+0.333701 -0.166764 0.336533
+0.27822 -0.176201 0.376759
+0.168846 -0.122651 0.474294
+0.169636 -0.135806 0.468006
+0.0527917 -0.222753 0.444966
+0.170529 -0.150528 0.460908
+0.170718 -0.153345 0.459535
+0.171315 -0.163765 0.454472
+
+
+-0.0210376 0.138273 0.497968
+-0.037159 0.145136 0.498405
+
+
+-0.0210376 0.138273 0.497968
+0.0256701 -0.00678241 0.499695
+-0.0393113 0.142922 0.498538
+
+
+-0.0210376 0.138273 0.497968
+-0.0197767 0.137747 0.49793
+
+
+-0.313881 -0.403127 -0.000915437
+-0.309995 -0.406402 -0.00203511
+-0.335423 -0.353515 -0.113662
+-0.284194 -0.419178 -0.0412042
+-0.286902 -0.419693 -0.0304556
+-0.188258 -0.456482 -0.0811385
+-0.0124275 -0.53565 0.00869657
+-0.0128354 -0.535997 0.0119168
+0.183592 -0.464325 -0.0331205
+0.215541 -0.451296 -0.0152205
+0.21557 -0.451141 -0.017842
+0.215512 -0.451088 -0.0192937
+
+
+-0.313881 -0.403127 -0.000915437
+-0.295876 -0.38485 0.121445
+-0.252531 -0.414429 0.124656
+-0.252956 -0.412879 0.128662
+-0.208416 -0.429931 0.148736
+-0.145615 -0.455021 0.155086
+-0.152526 -0.450876 0.158376
+-0.176814 -0.420902 0.204888
+-0.0308012 -0.441247 0.273247
+-0.0210771 -0.44741 0.268208
+-0.019735 -0.450665 0.262717
+
+
+-0.313881 -0.403127 -0.000915437
+-0.319303 -0.398538 0.000578803
+-0.335423 -0.353515 -0.113662
+-0.291573 -0.420494 -0.0119879
+
+
+-0.0351884 -0.153856 0.484569
+-0.0360634 -0.157783 0.482799
+-0.143539 -0.180191 0.444216
+-0.0523999 -0.233773 0.447173
+-0.053578 -0.239369 0.44443
+-0.0523183 -0.240029 0.444003
+-0.042964 -0.245046 0.440742
+-0.0213985 -0.321575 0.382795
+0.0864807 -0.311382 0.391712
+0.0900795 -0.313127 0.390268
+0.102434 -0.319261 0.385194
+
+
+-0.0351884 -0.153856 0.484569
+0.0527917 -0.222753 0.444966
+0.164691 -0.102109 0.484484
+0.167521 -0.101683 0.484262
+0.167652 -0.103586 0.483357
+
+
+-0.0351884 -0.153856 0.484569
+-0.0334004 -0.145397 0.488356
+-0.143539 -0.180191 0.444216
+-0.0504028 -0.224482 0.451693
+-0.0517025 -0.230659 0.448695
+-0.0523999 -0.233773 0.447173
+
+
+0.106329 -0.487484 0.133624
+0.206135 -0.411921 0.194742
+
+
+0.106329 -0.487484 0.133624
+0.109061 -0.485183 0.135805
+0.156086 -0.445909 0.172607
+0.204981 -0.412214 0.1953
+
+
+0.106329 -0.487484 0.133624
+0.0834261 -0.506602 0.115688
+0.0967371 -0.501588 0.1127
+0.183592 -0.464325 -0.0331205
+0.215566 -0.451511 -0.0107237
+0.215597 -0.451352 -0.0136303
+0.215541 -0.451296 -0.0152205
+
+
+0.156224 -0.382354 0.281817
+0.157115 -0.383294 0.280028
+0.141621 -0.397458 0.269018
+0.162893 -0.38872 0.269022
+0.1631 -0.388801 0.268781
+0.163908 -0.389648 0.267064
+0.141621 -0.397458 0.269018
+0.161924 -0.387829 0.270881
+0.162136 -0.3879 0.270653
+0.162893 -0.38872 0.269022
+
+
+0.156224 -0.382354 0.281817
+0.179438 -0.375372 0.278026
+0.252986 -0.327284 0.289116
+0.252711 -0.324176 0.293329
+0.319882 -0.304039 0.235874
+0.31758 -0.268206 0.280342
+0.319493 -0.266855 0.279469
+0.321901 -0.265211 0.278307
+
+
+0.156224 -0.382354 0.281817
+0.156012 -0.382238 0.282095
+0.141621 -0.397458 0.269018
+0.160983 -0.386957 0.272682
+0.161198 -0.387023 0.272461
+0.161924 -0.387829 0.270881
+
+
+-0.181699 -0.340845 0.349034
+-0.179872 -0.342124 0.348131
+-0.176814 -0.420902 0.204888
+-0.045057 -0.432148 0.280622
+-0.0325985 -0.440091 0.274194
+-0.0308012 -0.441247 0.273247
+
+
+-0.181699 -0.340845 0.349034
+-0.0213985 -0.321575 0.382795
+0.0738909 -0.305144 0.396823
+0.0767853 -0.306548 0.395673
+0.0864807 -0.311382 0.391712
+
+
+-0.181699 -0.340845 0.349034
+-0.196322 -0.330681 0.356112
+-0.176814 -0.420902 0.204888
+-0.0577511 -0.423996 0.28716
+-0.0466389 -0.431125 0.281452
+-0.045057 -0.432148 0.280622
+
+
+-0.267286 -0.212757 -0.413146
+-0.26703 -0.212842 -0.413329
+-0.296119 -0.00157042 -0.403375
+-0.284281 -0.206966 -0.401071
+-0.267286 -0.212757 -0.413146
+-0.290413 -0.331313 -0.237261
+-0.234973 -0.38624 -0.221717
+-0.235369 -0.386176 -0.22134
+-0.225451 -0.420597 -0.150567
+-0.197119 -0.443302 -0.123557
+-0.19539 -0.443791 -0.124681
+-0.193246 -0.444362 -0.126181
+
+
+0.194746 -0.413463 0.20279
+0.194683 -0.413487 0.202802
+0.194045 -0.412809 0.204788
+0.196267 -0.41207 0.204157
+
+
+0.0383634 -0.120086 0.492937
+0.0464547 -0.11899 0.492527
+0.0527917 -0.222753 0.444966
+0.142745 -0.105297 0.486194
+0.148273 -0.104466 0.485777
+0.164691 -0.102109 0.484484
+
+
+0.0383634 -0.120086 0.492937
+0.0256701 -0.00678241 0.499695
+-0.038878 0.109283 0.499275
+-0.0370331 0.0997637 0.499413
+-0.0534567 -0.0227233 0.497018
+-0.00817853 -0.0433099 0.498945
+-0.00718515 -0.048015 0.498714
+-0.00688806 -0.0496653 0.49863
+
+
+0.0383634 -0.120086 0.492937
+0.0353636 -0.120522 0.493076
+0.0527917 -0.222753 0.444966
+0.124338 -0.107957 0.487575
+0.129034 -0.107252 0.487235
+0.142745 -0.105297 0.486194
+
+
+0.0215735 -0.410004 0.304337
+0.0191042 -0.412162 0.302288
+-0.0213985 -0.321575 0.382795
+0.0635228 -0.299989 0.401004
+0.0659433 -0.301164 0.400051
+0.0738909 -0.305144 0.396823
+
+
+0.0215735 -0.410004 0.304337
+0.141621 -0.397458 0.269018
+0.160051 -0.386084 0.274461
+0.160267 -0.386151 0.274242
+0.160983 -0.386957 0.272682
+
+
+0.0215735 -0.410004 0.304337
+0.0279657 -0.404304 0.309743
+-0.0213985 -0.321575 0.382795
+0.0546806 -0.295575 0.404541
+0.0567716 -0.296592 0.403726
+0.0635228 -0.299989 0.401004
+
+
+-0.0497321 -0.221491 0.453141
+-0.0504028 -0.224482 0.451693
+
+
+-0.0497321 -0.221491 0.453141
+0.0527917 -0.222753 0.444966
+0.108397 -0.110249 0.488719
+0.112508 -0.109633 0.488436
+0.124338 -0.107957 0.487575
+
+
+-0.0497321 -0.221491 0.453141
+-0.0484712 -0.215496 0.456021
+-0.143539 -0.180191 0.444216
+-0.0465661 -0.206634 0.460245
+-0.0478136 -0.212565 0.457426
+-0.0484712 -0.215496 0.456021
+
+
+0.244017 -0.36125 0.250252
+0.201839 -0.398206 0.225362
+0.202992 -0.397918 0.2248
+0.203107 -0.397897 0.22473
+0.207859 -0.40175 0.213101
+
+
+0.244017 -0.36125 0.250252
+0.250557 -0.357737 0.250304
+0.255489 -0.355136 0.250259
+0.255401 -0.353864 0.252057
+0.319882 -0.304039 0.235874
+0.313262 -0.271176 0.282355
+0.315184 -0.26983 0.281487
+0.31758 -0.268206 0.280342
+
+
+0.244017 -0.36125 0.250252
+0.237165 -0.364841 0.250323
+0.179438 -0.375372 0.278026
+0.252414 -0.321508 0.296989
+0.252099 -0.318072 0.301619
+0.319882 -0.304039 0.235874
+0.308865 -0.27418 0.284386
+0.310833 -0.272811 0.283505
+0.313262 -0.271176 0.282355
+
+
+0.400551 -0.201219 -0.22944
+0.400604 -0.201125 -0.229434
+0.360137 -0.185454 -0.293637
+0.360229 -0.185251 -0.293652
+0.36026 -0.185176 -0.29366
+0.349321 -0.179684 -0.309345
+0.348618 -0.180863 -0.30945
+0.348515 -0.181237 -0.309348
+0.347794 -0.182429 -0.309458
+0.347694 -0.182818 -0.30934
+0.346929 -0.184045 -0.309469
+0.346844 -0.184469 -0.309311
+0.345992 -0.18575 -0.309497
+0.345971 -0.186282 -0.3092
+0.344838 -0.187617 -0.309658
+0.346184 -0.18891 -0.307369
+0.347504 -0.189026 -0.305822
+0.345971 -0.186282 -0.3092
+
+
+0.400551 -0.201219 -0.22944
+0.415805 -0.23012 -0.156689
+0.464133 -0.165293 -0.111856
+0.464878 -0.166358 -0.108105
+0.479066 -0.0747935 -0.1237
+0.507587 -0.0479786 -0.010034
+0.508091 -0.0410955 -0.0122575
+0.508395 -0.036809 -0.0136893
+
+
+0.400551 -0.201219 -0.22944
+0.396687 -0.207871 -0.230022
+0.360037 -0.185654 -0.293633
+0.360137 -0.185454 -0.293637
+
+
+0.479443 -0.17077 -0.0440339
+0.480992 -0.166254 -0.0410189
+0.479066 -0.0747935 -0.1237
+0.504735 -0.0832592 0.00152579
+0.505391 -0.0755971 -0.000956084
+0.505778 -0.0709636 -0.00250528
+
+
+0.479443 -0.17077 -0.0440339
+0.452817 -0.199577 0.0743398
+0.422336 -0.236028 0.140289
+
+
+0.479443 -0.17077 -0.0440339
+0.477489 -0.176408 -0.0478817
+
+
+0.386777 -0.320056 0.00736761
+0.386207 -0.320223 0.0125573
+
+
+0.386777 -0.320056 0.00736761
+0.344351 -0.361304 0.035808
+0.29048 -0.398005 0.12285
+0.287576 -0.401071 0.11972
+0.217299 -0.406065 0.195195
+
+
+0.386777 -0.320056 0.00736761
+0.38704 -0.319948 0.00521754
+0.41035 -0.282982 0.0402411
+0.409921 -0.283482 0.0410748
+
+
+0.382051 -0.323671 0.0222971
+0.378886 -0.326397 0.0281691
+
+
+0.394956 -0.303024 0.0487279
+0.394627 -0.303715 0.0472945
+
+
+0.397141 -0.29851 0.0572874
+0.396896 -0.299066 0.0561225
+
+
+0.360045 -0.352513 -0.1066
+0.415805 -0.23012 -0.156689
+0.465995 -0.168085 -0.102287
+0.466797 -0.169249 -0.0981721
+0.479066 -0.0747935 -0.1237
+0.50356 -0.0964839 0.00586398
+0.504302 -0.0882095 0.00318068
+0.504735 -0.0832592 0.00152579
+
+
+0.360045 -0.352513 -0.1066
+0.361959 -0.350585 -0.104548
+0.368718 -0.343722 -0.0973888
+0.415805 -0.23012 -0.156689
+0.468016 -0.171155 -0.0917109
+0.468901 -0.17246 -0.0870852
+0.479066 -0.0747935 -0.1237
+0.500101 -0.10773 -0.00161053
+0.501977 -0.101683 0.00248477
+0.503553 -0.0965552 0.00588781
+0.50356 -0.0964839 0.00586398
+
+
+0.360045 -0.352513 -0.1066
+0.352469 -0.36014 -0.114581
+0.344351 -0.361304 0.035808
+0.284605 -0.404219 0.116435
+0.281654 -0.407305 0.113262
+0.21695 -0.406383 0.194923
+
+
+-0.188602 -0.472254 0.038012
+-0.187703 -0.47264 0.0381264
+-0.188258 -0.456482 -0.0811385
+-0.0154305 -0.538074 0.0315537
+-0.0158754 -0.538439 0.0350617
+0.183592 -0.464325 -0.0331205
+0.215586 -0.45174 -0.0056309
+0.21562 -0.451571 -0.00893837
+0.215566 -0.451511 -0.0107237
+
+
+-0.188602 -0.472254 0.038012
+-0.208416 -0.429931 0.148736
+-0.155036 -0.4494 0.159487
+-0.16015 -0.446314 0.161931
+-0.176814 -0.420902 0.204888
+-0.0693332 -0.416508 0.293097
+-0.0591794 -0.423065 0.287907
+-0.0577511 -0.423996 0.28716
+
+
+-0.188602 -0.472254 0.038012
+-0.198483 -0.468 0.0366452
+-0.188258 -0.456482 -0.0811385
+-0.0187331 -0.540646 0.056706
+-0.01923 -0.541038 0.0606186
+0.183592 -0.464325 -0.0331205
+0.215602 -0.451991 0.000306008
+0.21564 -0.451807 -0.00357062
+0.215586 -0.45174 -0.0056309
+
+
+0.419337 -0.263113 0.0705719
+0.416513 -0.271127 0.0557357
+
+
+0.411981 0.240064 -0.161817
+0.413097 0.237046 -0.162978
+0.447132 0.197972 -0.105977
+
+
+0.411981 0.240064 -0.161817
+0.38169 0.223987 -0.233544
+0.327693 0.364355 -0.173305
+0.327047 0.364153 -0.174585
+0.320509 0.36199 -0.187677
+
+
+0.411981 0.240064 -0.161817
+0.410366 0.244489 -0.16003
+0.447115 0.198058 -0.105889
+
+
+0.498606 -0.11252 -0.00479076
+0.500101 -0.10773 -0.00161053
+
+
+0.498606 -0.11252 -0.00479076
+0.452817 -0.199577 0.0743398
+0.42196 -0.240118 0.132637
+
+
+0.498606 -0.11252 -0.00479076
+0.496827 -0.118161 -0.00861689
+0.479066 -0.0747935 -0.1237
+0.493673 -0.128052 -0.015267
+0.495395 -0.122679 -0.0116179
+0.496827 -0.118161 -0.00861689
+
+
+0.464431 0.116562 0.15594
+0.461737 0.120773 0.1589
+0.434716 0.190815 0.158152
+0.353169 0.277717 0.257819
+0.352927 0.27333 0.263561
+0.219585 0.354976 0.275998
+0.170223 0.364295 0.299276
+0.169807 0.365 0.298679
+0.167989 0.368261 0.295844
+
+
+0.464431 0.116562 0.15594
+0.426136 0.138953 0.222487
+0.347884 0.261715 0.281581
+0.352364 0.244164 0.28522
+0.309773 0.146118 0.364407
+
+
+0.464431 0.116562 0.15594
+0.469 0.10953 0.150801
+0.434716 0.190815 0.158152
+0.406425 0.200609 0.215882
+0.403121 0.204985 0.219039
+
+
+0.267817 0.400647 0.133415
+0.266487 0.401988 0.131975
+0.270737 0.406813 0.107727
+0.251647 0.41578 0.117528
+0.251167 0.416149 0.117254
+0.249978 0.417242 0.115945
+
+
+0.267817 0.400647 0.133415
+0.245333 0.413089 0.139891
+0.150334 0.466378 0.133548
+0.150242 0.467835 0.129225
+0.150174 0.469944 0.122863
+0.245333 0.413089 0.139891
+0.150475 0.46293 0.143752
+0.150391 0.464348 0.139599
+0.150334 0.466378 0.133548
+
+
+0.267817 0.400647 0.133415
+0.268367 0.400149 0.133829
+0.270737 0.406813 0.107727
+0.253157 0.41445 0.118948
+0.252686 0.414798 0.118741
+0.251647 0.41578 0.117528
+
+
+0.405789 0.181823 -0.230429
+0.406492 0.1819 -0.229178
+0.38169 0.223987 -0.233544
+0.335306 0.366829 -0.157967
+0.334615 0.366615 -0.159347
+0.327693 0.364355 -0.173305
+
+
+0.405789 0.181823 -0.230429
+0.412428 0.136992 -0.248066
+0.398703 0.181355 -0.242619
+0.399359 0.181433 -0.241479
+0.38169 0.223987 -0.233544
+0.343552 0.369473 -0.141239
+0.342797 0.369242 -0.14276
+0.335306 0.366829 -0.157967
+
+
+0.405789 0.181823 -0.230429
+0.404045 0.181746 -0.233432
+
+
+0.0325272 0.498973 -0.00364926
+0.0310356 0.499074 -0.00512995
+
+
+0.47424 0.0883082 -0.162838
+0.479042 0.0748672 -0.161494
+0.46309 0.169786 -0.0839271
+0.463134 0.169793 -0.083695
+0.463171 0.169811 -0.083484
+
+
+0.47424 0.0883082 -0.162838
+0.412428 0.136992 -0.248066
+0.401026 0.181514 -0.238657
+0.401683 0.181591 -0.237504
+
+
+0.47424 0.0883082 -0.162838
+0.473725 0.0897604 -0.162968
+0.463035 0.169791 -0.0841838
+0.46309 0.169786 -0.0839271
+
+
+0.411061 0.18214 -0.221171
+0.411879 0.182221 -0.219695
+0.38169 0.223987 -0.233544
+0.352702 0.37237 -0.122559
+0.351855 0.372113 -0.124276
+0.343552 0.369473 -0.141239
+
+
+0.411061 0.18214 -0.221171
+0.412428 0.136992 -0.248066
+0.40833 0.181979 -0.225984
+0.40908 0.182057 -0.22464
+0.38169 0.223987 -0.233544
+0.364649 0.363219 -0.111975
+
+
+0.411061 0.18214 -0.221171
+0.40908 0.182057 -0.22464
+
+
+0.405248 -0.301087 -0.0656992
+0.399727 -0.309393 -0.067567
+0.413406 -0.279049 0.036056
+0.413042 -0.27954 0.0364559
+0.418921 -0.26837 0.0509515
+
+
+0.405248 -0.301087 -0.0656992
+0.415805 -0.23012 -0.156689
+0.470266 -0.174619 -0.0797222
+0.471269 -0.176122 -0.074377
+0.479066 -0.0747935 -0.1237
+0.490573 -0.13762 -0.0217062
+0.492273 -0.132399 -0.0181568
+0.493673 -0.128052 -0.015267
+
+
+0.405248 -0.301087 -0.0656992
+0.406672 -0.298942 -0.0651889
+0.414015 -0.278205 0.0355333
+0.413406 -0.279049 0.036056
+
+
+0.370445 -0.341966 -0.0955244
+0.376619 -0.33564 -0.0889478
+0.415805 -0.23012 -0.156689
+0.472846 -0.178642 -0.0657348
+0.474023 -0.180432 -0.0593583
+0.479066 -0.0747935 -0.1237
+0.487466 -0.147055 -0.0280628
+0.489177 -0.141884 -0.0245437
+0.490573 -0.13762 -0.0217062
+
+
+0.370445 -0.341966 -0.0955244
+0.344351 -0.361304 0.035808
+0.278605 -0.410504 0.109901
+0.275548 -0.413671 0.106621
+0.216601 -0.406699 0.194651
+
+
+0.370445 -0.341966 -0.0955244
+0.368718 -0.343722 -0.0973888
+
+
+0.461175 -0.213188 -0.0456911
+0.460134 -0.214291 -0.0410739
+0.452817 -0.199577 0.0743398
+0.424984 -0.239046 0.120037
+0.42724 -0.237931 0.111277
+0.422836 -0.258135 0.0682116
+
+
+0.461175 -0.213188 -0.0456911
+0.459521 -0.215899 -0.0463005
+0.420838 -0.267809 0.034498
+0.420458 -0.268417 0.0344495
+0.421132 -0.26564 0.0463394
+
+
+0.461175 -0.213188 -0.0456911
+0.463911 -0.207342 -0.0469221
+0.415805 -0.23012 -0.156689
+0.469031 -0.196311 -0.0492008
+0.465428 -0.204092 -0.0475692
+0.452817 -0.199577 0.0743398
+0.43121 -0.235861 0.0958009
+
+
+0.393057 -0.306782 0.0415136
+0.392606 -0.307686 0.0396567
+
+
+0.451709 -0.228587 -0.0492073
+0.446992 -0.236191 -0.0509147
+0.41911 -0.270589 0.0340278
+0.419063 -0.270661 0.034036
+0.420594 -0.266318 0.0474816
+
+
+0.451709 -0.228587 -0.0492073
+0.415805 -0.23012 -0.156689
+0.45809 -0.218229 -0.0468528
+0.453027 -0.226458 -0.0487014
+0.419972 -0.269219 0.0341669
+0.41911 -0.270589 0.0340278
+
+
+0.451709 -0.228587 -0.0492073
+0.453027 -0.226458 -0.0487014
+
+
+0.398152 -0.311748 -0.0681261
+0.394858 -0.316666 -0.0692328
+0.393945 -0.31708 -0.0600757
+
+
+0.398152 -0.311748 -0.0681261
+0.415805 -0.23012 -0.156689
+0.445749 -0.238179 -0.0513881
+0.441259 -0.245356 -0.052999
+0.418307 -0.271853 0.033916
+0.417588 -0.272955 0.0340216
+0.42012 -0.266908 0.0484763
+
+
+0.398152 -0.311748 -0.0681261
+0.399727 -0.309393 -0.067567
+
+
+0.344351 -0.361304 0.035808
+0.272358 -0.416987 0.103114
+0.269128 -0.420302 0.0996559
+0.216225 -0.407015 0.194405
+
+
+0.344351 -0.361304 0.035808
+0.265722 -0.423811 0.0959213
+0.262238 -0.427356 0.0921979
+0.215823 -0.407331 0.194187
+
+
+0.344351 -0.361304 0.035808
+0.260196 -0.429786 0.0871129
+0.265357 -0.42651 0.076039
+
+
+0.344351 -0.361304 0.035808
+0.273261 -0.421427 0.0592171
+0.276629 -0.419237 0.0519175
+0.246306 -0.434405 -0.0320329
+0.294091 -0.407407 0.0139391
+0.29499 -0.406768 0.0120115
+0.296873 -0.405422 0.00778023
+
+
+0.344351 -0.361304 0.035808
+0.278068 -0.418291 0.0488893
+0.280939 -0.416398 0.0426316
+0.246306 -0.434405 -0.0320329
+0.291184 -0.409447 0.0203381
+0.292129 -0.408786 0.0183212
+0.294091 -0.407407 0.0139391
+
+
+0.344351 -0.361304 0.035808
+0.282187 -0.415566 0.039998
+0.284705 -0.41388 0.0344758
+0.246306 -0.434405 -0.0320329
+0.288083 -0.411586 0.0271235
+0.289098 -0.410889 0.0249688
+0.291184 -0.409447 0.0203381
+
+
+0.344351 -0.361304 0.035808
+0.285817 -0.413127 0.0321224
+0.288083 -0.411586 0.0271235
+
+
+0.344351 -0.361304 0.035808
+0.289098 -0.410889 0.0249688
+
+
+0.344351 -0.361304 0.035808
+0.292129 -0.408786 0.0183212
+
+
+0.344351 -0.361304 0.035808
+0.29499 -0.406768 0.0120115
+
+
+0.344351 -0.361304 0.035808
+0.297745 -0.404792 0.005901
+
+
+0.344351 -0.361304 0.035808
+0.300449 -0.402819 -0.000132673
+
+
+0.344351 -0.361304 0.035808
+0.303154 -0.400811 -0.00620596
+
+
+0.344351 -0.361304 0.035808
+0.308785 -0.396525 -0.0189622
+0.310839 -0.394927 -0.023714
+
+
+0.344351 -0.361304 0.035808
+0.311836 -0.394146 -0.0259344
+
+
+0.344351 -0.361304 0.035808
+0.315152 -0.391521 -0.0335532
+
+
+0.344351 -0.361304 0.035808
+0.318844 -0.388556 -0.0420835
+0.321658 -0.386268 -0.0486849
+0.246306 -0.434405 -0.0320329
+0.25712 -0.431601 0.0888202
+0.253063 -0.433902 0.0885531
+0.215394 -0.407645 0.193997
+
+
+0.344351 -0.361304 0.035808
+0.323071 -0.385114 -0.0518984
+0.32638 -0.38239 -0.0596909
+0.246306 -0.434405 -0.0320329
+0.246786 -0.437462 0.0880664
+0.242787 -0.439709 0.0878008
+0.214938 -0.407958 0.193838
+
+
+0.344351 -0.361304 0.035808
+0.328066 -0.380997 -0.0635521
+0.332103 -0.377634 -0.0730896
+0.246306 -0.434405 -0.0320329
+0.236539 -0.443219 0.0873124
+0.232522 -0.445456 0.0870429
+0.214454 -0.408269 0.193711
+
+
+0.344351 -0.361304 0.035808
+0.334198 -0.375885 -0.0779176
+0.339349 -0.37155 -0.0901214
+0.246306 -0.434405 -0.0320329
+0.226184 -0.448984 0.0865439
+0.22207 -0.451254 0.0862649
+0.213944 -0.408593 0.193578
+
+
+0.344351 -0.361304 0.035808
+0.342084 -0.369243 -0.0964669
+0.349048 -0.363331 -0.113002
+0.246306 -0.434405 -0.0320329
+0.215563 -0.454837 0.0855695
+0.215516 -0.45444 0.0715911
+0.183592 -0.464325 -0.0331205
+0.215612 -0.452274 0.0074649
+0.215655 -0.452067 0.00276058
+0.215602 -0.451991 0.000306008
+
+
+0.344351 -0.361304 0.035808
+0.361959 -0.350585 -0.104548
+
+
+0.344351 -0.361304 0.035808
+0.378214 -0.334004 -0.0872148
+0.383977 -0.328043 -0.0810394
+
+
+0.344351 -0.361304 0.035808
+0.392416 -0.319241 -0.0718827
+0.394858 -0.316666 -0.0692328
+
+
+0.344351 -0.361304 0.035808
+0.391363 -0.318261 -0.035262
+0.390298 -0.318695 -0.0248343
+0.411754 -0.281248 0.0379433
+
+
+0.344351 -0.361304 0.035808
+0.389892 -0.318883 -0.0212261
+0.389032 -0.319211 -0.0129362
+0.411252 -0.281889 0.0386483
+0.410781 -0.282471 0.0394125
+0.410393 -0.282929 0.0401715
+0.418199 -0.269222 0.0524051
+
+
+0.344351 -0.361304 0.035808
+0.388692 -0.319362 -0.0100045
+0.387967 -0.319618 -0.00313796
+0.410781 -0.282471 0.0394125
+
+
+0.344351 -0.361304 0.035808
+0.387673 -0.319744 -0.000666084
+0.38704 -0.319948 0.00521754
+
+
+0.454023 0.0628394 0.209232
+0.455493 0.0617811 0.206901
+0.420272 0.0202432 0.270855
+0.465149 -0.0601106 0.198591
+0.465582 -0.0519033 0.197642
+0.49032 -0.00243348 0.0999044
+0.466684 -0.028499 0.19499
+0.46685 -0.0243536 0.194542
+0.467114 -0.0182337 0.193805
+
+
+0.454023 0.0628394 0.209232
+0.426136 0.138953 0.222487
+0.353326 0.240459 0.28596
+0.35692 0.226244 0.288883
+0.310549 0.14567 0.363918
+
+
+0.454023 0.0628394 0.209232
+0.450521 0.0652459 0.214799
+0.420272 0.0202432 0.270855
+0.465819 -0.0468684 0.197108
+0.46618 -0.039605 0.196257
+0.49032 -0.00243348 0.0999044
+0.491114 -0.102851 0.0727516
+0.49076 -0.103032 0.0745236
+
+
+0.362521 0.258788 0.256901
+0.352839 0.271498 0.265927
+0.351818 0.269737 0.269006
+
+
+0.444989 0.236441 -0.0263328
+0.441978 0.250713 -0.00800523
+0.447545 0.198712 -0.102521
+0.447631 0.198647 -0.102236
+0.447669 0.198623 -0.102097
+0.447825 0.198503 -0.101574
+0.448025 0.198321 -0.100955
+0.448284 0.198054 -0.100219
+0.448623 0.197667 -0.0993371
+0.449066 0.197112 -0.0982814
+0.449646 0.196321 -0.0970268
+0.449877 0.19598 -0.0965793
+0.450495 0.195135 -0.0952278
+0.451663 0.193384 -0.0930015
+0.452696 0.191657 -0.0913983
+
+
+0.444989 0.236441 -0.0263328
+0.462203 0.173627 -0.0806788
+
+
+0.444989 0.236441 -0.0263328
+0.447146 0.225874 -0.0402763
+0.447669 0.198623 -0.102097
+
+
+0.168955 -0.099491 0.484222
+0.175967 -0.0888987 0.483975
+
+
+0.168955 -0.099491 0.484222
+0.0256701 -0.00678241 0.499695
+-0.032421 0.0771216 0.499737
+-0.0313252 0.0713933 0.499811
+-0.0534567 -0.0227233 0.497018
+-0.00929828 -0.037793 0.4992
+-0.00842929 -0.0418921 0.499013
+-0.00817853 -0.0433099 0.498945
+
+
+0.168955 -0.099491 0.484222
+0.167521 -0.101683 0.484262
+
+
+0.11161 0.0811557 0.491544
+0.110458 0.196023 0.446961
+0.0580517 0.104421 0.494903
+0.0573174 0.104729 0.494943
+
+
+0.11161 0.0811557 0.491544
+0.110786 0.0815071 0.491605
+0.100167 0.0861507 0.492355
+
+
+0.11161 0.0811557 0.491544
+0.12304 0.0761461 0.490691
+0.0256701 -0.00678241 0.499695
+-0.0283583 0.0568932 0.499995
+-0.0276259 0.0530095 0.500038
+-0.0534567 -0.0227233 0.497018
+-0.0102969 -0.0328705 0.49941
+-0.0095162 -0.0365393 0.499256
+-0.00929828 -0.037793 0.4992
+
+
+-0.23593 0.365114 -0.247655
+-0.238187 0.363432 -0.247799
+-0.251055 0.349076 -0.25525
+-0.251109 0.348629 -0.255819
+-0.251048 0.348048 -0.256686
+-0.251144 0.347072 -0.257941
+-0.251292 0.346483 -0.258606
+-0.251328 0.346145 -0.259035
+-0.251532 0.345305 -0.259983
+-0.251823 0.344488 -0.260811
+-0.252004 0.344091 -0.261173
+-0.25213 0.343735 -0.26153
+-0.252442 0.343042 -0.26216
+-0.252797 0.342379 -0.262704
+-0.253185 0.341749 -0.263169
+-0.25331 0.341568 -0.263288
+-0.253555 0.341168 -0.263582
+-0.253932 0.340619 -0.263942
+-0.254329 0.340097 -0.264245
+-0.254742 0.3396 -0.264497
+-0.255168 0.339129 -0.2647
+-0.255214 0.339083 -0.264716
+-0.255576 0.338681 -0.264888
+-0.255994 0.338251 -0.265039
+-0.256425 0.33784 -0.265151
+-0.256868 0.337447 -0.265225
+-0.257321 0.337074 -0.265264
+-0.257632 0.336836 -0.265265
+-0.257779 0.336714 -0.265277
+-0.258241 0.336358 -0.265279
+-0.258716 0.336017 -0.265245
+-0.259206 0.335692 -0.265176
+-0.25971 0.335384 -0.265069
+-0.260228 0.335093 -0.264925
+-0.260396 0.335007 -0.264867
+-0.260762 0.334799 -0.264764
+-0.261318 0.334512 -0.264569
+-0.261894 0.334245 -0.264328
+-0.262489 0.333999 -0.264036
+-0.263102 0.333779 -0.263691
+-0.263288 0.333723 -0.263573
+-0.263757 0.333553 -0.263308
+-0.264445 0.333344 -0.262864
+-0.265157 0.333173 -0.262345
+-0.265886 0.333049 -0.261744
+-0.266092 0.33303 -0.261553
+-0.266683 0.332926 -0.261064
+-0.26752 0.33285 -0.260279
+-0.35544 0.259328 -0.259533
+-0.374029 0.247387 -0.254834
+-0.374176 0.243702 -0.258353
+-0.250076 0.305099 -0.307859
+-0.375581 0.197423 -0.301878
+-0.37562 0.196058 -0.303137
+-0.375883 0.183225 -0.315066
+-0.250076 0.305099 -0.307859
+-0.375264 0.210205 -0.289947
+-0.375304 0.208962 -0.291098
+-0.375581 0.197423 -0.301878
+
+
+-0.23593 0.365114 -0.247655
+-0.256345 0.35583 -0.240234
+-0.257104 0.35596 -0.239251
+-0.258244 0.349034 -0.247998
+-0.257776 0.349323 -0.248074
+-0.25676 0.350136 -0.247973
+-0.256215 0.350452 -0.248085
+-0.255061 0.351403 -0.247921
+-0.254347 0.35175 -0.248158
+-0.252976 0.353056 -0.247701
+-0.251847 0.352639 -0.249441
+-0.251964 0.351979 -0.250257
+-0.251438 0.35134 -0.251692
+-0.251367 0.350467 -0.252991
+-0.251189 0.350154 -0.253609
+-0.251055 0.349076 -0.25525
+
+
+-0.23593 0.365114 -0.247655
+-0.229259 0.369793 -0.247634
+-0.251048 0.348048 -0.256686
+
+
+0.17342 -0.200614 0.43621
+0.173861 -0.209156 0.431905
+0.0527917 -0.222753 0.444966
+0.094203 -0.112276 0.48969
+0.097899 -0.111724 0.489448
+0.108397 -0.110249 0.488719
+
+
+0.17342 -0.200614 0.43621
+0.27822 -0.176201 0.376759
+0.16985 -0.138969 0.466478
+0.170529 -0.150528 0.460908
+
+
+0.17342 -0.200614 0.43621
+0.173281 -0.198399 0.43733
+
+
+0.423764 0.0833494 0.255922
+0.422593 0.0816187 0.258032
+0.384719 0.088236 0.307581
+0.360715 0.0844252 0.336256
+0.361351 0.0813638 0.336331
+0.335115 0.0786323 0.363201
+0.354944 0.0641348 0.346407
+0.354473 0.0637201 0.346953
+0.352941 0.0627011 0.348663
+
+
+0.423764 0.0833494 0.255922
+0.424222 0.0830555 0.255242
+0.42516 0.082413 0.253854
+0.420272 0.0202432 0.270855
+0.466377 -0.0350906 0.195774
+0.466684 -0.028499 0.19499
+
+
+0.423764 0.0833494 0.255922
+0.421658 0.0876686 0.257497
+0.384719 0.088236 0.307581
+0.361486 0.0808148 0.33632
+0.362122 0.0777092 0.336387
+0.335115 0.0786323 0.363201
+0.357232 0.0657784 0.343811
+0.356682 0.0653111 0.344449
+0.354944 0.0641348 0.346407
+
+
+0.436194 0.0671367 -0.24116
+0.433785 0.0670793 -0.245267
+0.429296 -0.00494892 -0.257062
+0.43755 0.0671199 -0.23885
+0.436194 0.0671367 -0.24116
+0.412428 0.136992 -0.248066
+0.414065 0.18231 -0.215836
+0.414981 0.182396 -0.214174
+0.38169 0.223987 -0.233544
+0.377361 0.330716 -0.125241
+0.3814 0.320396 -0.129395
+0.447069 0.198486 -0.105266
+
+
+-0.526447 -0.057787 0.0983651
+-0.524709 -0.0568693 0.104885
+-0.413046 -0.239792 0.149308
+-0.367131 -0.299269 0.170361
+-0.367599 -0.299422 0.168886
+-0.369581 -0.299959 0.162823
+
+
+-0.526447 -0.057787 0.0983651
+-0.464303 0.153517 0.106091
+-0.520861 -0.054767 0.119227
+-0.519156 -0.0538786 0.125516
+-0.413046 -0.239792 0.149308
+-0.364458 -0.298505 0.178504
+-0.364974 -0.298674 0.176897
+-0.367131 -0.299269 0.170361
+
+
+-0.526447 -0.057787 0.0983651
+-0.530409 -0.0599787 0.0833504
+-0.413046 -0.239792 0.149308
+-0.361474 -0.297638 0.187509
+-0.362057 -0.29783 0.185714
+-0.364458 -0.298505 0.178504
+
+
+0.333351 -0.164136 0.338055
+0.332689 -0.160919 0.340107
+
+
+0.248165 -0.310433 0.314071
+0.243125 -0.307916 0.320654
+0.30802 -0.229117 0.320982
+0.223945 -0.298301 0.345331
+0.222966 -0.297823 0.346563
+0.21645 -0.294509 0.354861
+
+
+0.248165 -0.310433 0.314071
+0.179438 -0.375372 0.278026
+0.251762 -0.315084 0.305689
+0.251475 -0.312062 0.30974
+0.253108 -0.311011 0.309028
+0.319882 -0.304039 0.235874
+0.281843 -0.292243 0.296518
+0.284884 -0.290207 0.295205
+0.288429 -0.287892 0.293606
+
+
+0.248165 -0.310433 0.314071
+0.248957 -0.31081 0.313051
+0.30802 -0.229117 0.320982
+0.25869 -0.307349 0.30665
+0.264834 -0.303385 0.303952
+0.319882 -0.304039 0.235874
+0.274143 -0.297301 0.299896
+0.277729 -0.294918 0.298356
+0.281843 -0.292243 0.296518
+
+
+-0.225366 0.372635 -0.247456
+-0.229259 0.369793 -0.247634
+
+
+-0.225366 0.372635 -0.247456
+-0.25736 0.356058 -0.238839
+-0.258273 0.356219 -0.23764
+-0.259227 0.356252 -0.236584
+-0.259327 0.356245 -0.236488
+-0.259582 0.348039 -0.248013
+-0.259161 0.348308 -0.248072
+-0.258244 0.349034 -0.247998
+
+
+-0.225366 0.372635 -0.247456
+-0.212676 0.381575 -0.247325
+-0.251144 0.347072 -0.257941
+
+
+0.38029 0.167611 0.284976
+0.381268 0.165772 0.284391
+0.384719 0.088236 0.307581
+0.362258 0.0771467 0.336376
+0.362908 0.0739342 0.336436
+0.335115 0.0786323 0.363201
+0.359929 0.0677221 0.340731
+0.359267 0.0671759 0.341501
+0.357232 0.0657784 0.343811
+
+
+0.38029 0.167611 0.284976
+0.426136 0.138953 0.222487
+0.357709 0.223181 0.289487
+0.3607 0.211223 0.291922
+0.31134 0.145149 0.363441
+
+
+0.38029 0.167611 0.284976
+0.375095 0.177144 0.288167
+0.384719 0.088236 0.307581
+0.363047 0.0733463 0.336423
+0.363636 0.0703943 0.33647
+0.363227 0.0701063 0.336941
+0.335115 0.0786323 0.363201
+0.351908 0.122925 0.335086
+0.352201 0.121773 0.33511
+
+
+0.312727 -0.0650271 0.396698
+0.314685 -0.064221 0.394774
+
+
+0.408849 0.113526 0.266645
+0.409244 0.112718 0.266384
+0.384719 0.088236 0.307581
+0.364232 0.0696568 0.335961
+0.363636 0.0703943 0.33647
+
+
+0.408849 0.113526 0.266645
+0.426136 0.138953 0.222487
+0.361369 0.208603 0.292431
+0.363937 0.19822 0.294524
+0.312123 0.144525 0.363011
+
+
+0.408849 0.113526 0.266645
+0.406957 0.117214 0.26795
+0.384719 0.088236 0.307581
+0.36638 0.0668903 0.334129
+0.365092 0.0684909 0.335241
+0.364232 0.0696568 0.335961
+
+
+0.368734 -0.0423271 0.34027
+0.369628 -0.0419376 0.339339
+
+
+0.323197 -0.0608413 0.386365
+0.324814 -0.0601707 0.384767
+
+
+0.390098 0.0341447 0.312692
+0.390018 0.0326772 0.312932
+0.353916 0.0348819 0.352033
+0.290783 0.00216701 0.413413
+
+
+0.320468 0.130239 0.361027
+0.320471 0.130246 0.361022
+0.319991 0.132232 0.36073
+0.319755 0.132629 0.360796
+
+
+0.320468 0.130239 0.361027
+0.31872 0.128172 0.363313
+
+
+0.320468 0.130239 0.361027
+0.321008 0.127999 0.361346
+0.320999 0.127991 0.361357
+
+
+0.387381 -0.0156243 0.319489
+0.353916 0.0348819 0.352033
+0.283658 -0.0131897 0.421203
+
+
+0.365092 0.0684909 0.335241
+0.353916 0.0348819 0.352033
+0.273517 -0.034984 0.432215
+
+
+0.288089 0.118433 0.391197
+0.288221 0.118166 0.391178
+0.28047 0.0950224 0.403371
+0.30251 0.0942781 0.386856
+0.304033 0.0917047 0.386317
+0.304181 0.091398 0.386279
+
+
+0.288089 0.118433 0.391197
+0.298531 0.118167 0.383339
+0.297749 0.119625 0.383483
+0.297548 0.120195 0.383457
+0.30149 0.128302 0.377732
+
+
+0.288089 0.118433 0.391197
+0.286501 0.120954 0.391626
+0.28047 0.0950224 0.403371
+0.298394 0.101303 0.388225
+0.299567 0.0993803 0.387825
+0.299664 0.0991484 0.387812
+
+
+0.141514 0.196121 0.437796
+0.139774 0.198066 0.437438
+0.145377 0.224646 0.422847
+0.10168 0.241276 0.426818
+0.0990455 0.239972 0.428311
+0.0973589 0.240085 0.428659
+0.105038 0.280323 0.400982
+0.0581082 0.24191 0.436623
+0.0531007 0.242076 0.437623
+0.0470382 0.242372 0.438771
+
+
+0.141514 0.196121 0.437796
+0.110458 0.196023 0.446961
+0.123936 0.0757624 0.49062
+0.12304 0.0761461 0.490691
+
+
+0.141514 0.196121 0.437796
+0.142435 0.195225 0.437921
+0.145377 0.224646 0.422847
+0.101959 0.237094 0.429007
+0.100105 0.238883 0.428587
+0.0990455 0.239972 0.428311
+
+
+-0.19577 -0.0509948 0.473341
+-0.195842 -0.0510921 0.473281
+-0.310123 -0.0280028 0.391714
+-0.255338 -0.134177 0.421219
+-0.261901 -0.143458 0.415143
+-0.261956 -0.143535 0.415092
+
+
+-0.19577 -0.0509948 0.473341
+-0.143539 -0.180191 0.444216
+-0.0446508 -0.197725 0.464448
+-0.0459091 -0.203706 0.461634
+-0.0465661 -0.206634 0.460245
+
+
+-0.19577 -0.0509948 0.473341
+-0.193858 -0.0483519 0.474933
+-0.193965 -0.0453372 0.475081
+-0.0534567 -0.0227233 0.497018
+-0.0112096 -0.0283695 0.499586
+-0.0104914 -0.0317335 0.499457
+-0.0102969 -0.0328705 0.49941
+
+
+0.4184 0.0943711 0.259876
+0.418861 0.0934 0.259551
+0.384719 0.088236 0.307581
+0.372446 0.0589831 0.328842
+0.371232 0.0605175 0.329925
+0.370446 0.0616064 0.330604
+
+
+0.4184 0.0943711 0.259876
+0.426136 0.138953 0.222487
+0.365243 0.195244 0.294118
+0.366963 0.192056 0.293099
+0.384719 0.088236 0.307581
+0.374477 0.0563041 0.327033
+0.37324 0.0578781 0.328149
+0.372446 0.0589831 0.328842
+
+
+0.4184 0.0943711 0.259876
+0.416287 0.0986344 0.261418
+0.384719 0.088236 0.307581
+0.376579 0.0535137 0.325141
+0.375294 0.0551613 0.326311
+0.374477 0.0563041 0.327033
+
+
+0.453945 -0.13666 0.198832
+0.451336 -0.142334 0.19993
+
+
+0.33954 -0.0542677 0.370087
+0.340753 -0.0537568 0.368872
+
+
+0.373909 -0.0401747 0.33485
+0.374802 -0.0397835 0.333913
+
+
+0.453502 -0.0886381 0.218174
+0.452159 -0.0875674 0.220334
+
+
+0.4633 -0.093695 0.202291
+0.46314 -0.0965513 0.202589
+0.463139 -0.0965507 0.202591
+
+
+0.44493 -0.234246 -0.00560526
+0.436191 -0.245807 0.0138197
+0.426819 -0.25694 0.0426108
+
+
+0.44493 -0.234246 -0.00560526
+0.421696 -0.266377 0.0350318
+0.420838 -0.267809 0.034498
+
+
+0.44493 -0.234246 -0.00560526
+0.456458 -0.218865 -0.0304166
+0.427239 -0.25599 0.0441497
+
+
+0.420328 -0.201966 0.215009
+0.425046 -0.197814 0.210757
+
+
+0.394072 -0.304789 0.0453481
+0.393692 -0.305568 0.0437392
+
+
+0.328066 -0.380997 -0.0635521
+0.32638 -0.38239 -0.0596909
+
+
+0.187679 0.457238 -0.0947639
+0.190322 0.456063 -0.094965
+0.204528 0.456279 -0.0194397
+0.134625 0.484809 -0.00649803
+0.13527 0.484789 0.000827527
+0.058974 0.496872 -0.00641194
+0.0345806 0.498827 -0.00140405
+0.0352024 0.49878 -0.000517745
+0.0272388 0.499148 0.0225842
+-0.046855 0.49966 0.0342535
+-0.0537188 0.499451 0.0401288
+-0.0248719 0.498374 -0.0374832
+-0.127269 0.493016 0.0225902
+-0.127288 0.492992 0.0221973
+-0.127739 0.492264 0.010035
+
+
+0.187679 0.457238 -0.0947639
+0.181842 0.434736 -0.16834
+0.067923 0.488895 -0.136074
+0.0700361 0.48873 -0.134381
+0.058974 0.496872 -0.00641194
+0.0364095 0.498687 0.000589382
+0.0369415 0.498643 0.00141956
+0.0272388 0.499148 0.0225842
+-0.059308 0.499273 0.0450669
+-0.0693116 0.498945 0.053656
+-0.0248719 0.498374 -0.0374832
+-0.126735 0.493804 0.0365281
+-0.126756 0.493779 0.0360868
+-0.127269 0.493016 0.0225902
+
+
+0.187679 0.457238 -0.0947639
+0.183348 0.459169 -0.0943516
+0.204528 0.456279 -0.0194397
+0.135299 0.484786 0.00110436
+0.13596 0.484736 0.00870126
+0.058974 0.496872 -0.00641194
+0.0380798 0.498551 0.00240221
+0.0385351 0.49851 0.00320438
+0.0272388 0.499148 0.0225842
+-0.0778975 0.498652 0.06121
+-0.0942321 0.498084 0.075275
+-0.0248719 0.498374 -0.0374832
+-0.126113 0.494651 0.0524095
+-0.126137 0.494623 0.0518998
+-0.126735 0.493804 0.0365281
+
+
+0.414884 0.189217 0.20783
+0.434716 0.190815 0.158152
+0.411074 0.194364 0.21147
+0.408452 0.197851 0.213997
+0.406425 0.200609 0.215882
+
+
+0.414884 0.189217 0.20783
+0.412717 0.192111 0.209937
+0.411074 0.194364 0.21147
+
+
+0.414884 0.189217 0.20783
+0.416264 0.187307 0.206537
+0.426136 0.138953 0.222487
+0.373835 0.179497 0.288917
+0.375095 0.177144 0.288167
+
+
+0.363898 0.318342 0.1803
+0.364568 0.318427 0.178412
+
+
+0.327047 0.364153 -0.174585
+0.181842 0.434736 -0.16834
+0.0792651 0.487966 -0.127111
+0.0811441 0.487812 -0.125601
+0.058974 0.496872 -0.00641194
+0.0396395 0.498415 0.00408717
+0.0400274 0.498376 0.004883
+0.0272388 0.499148 0.0225842
+-0.109445 0.497541 0.0886075
+-0.124136 0.497008 0.101291
+-0.124447 0.496667 0.0937133
+-0.0248719 0.498374 -0.0374832
+-0.125369 0.495589 0.0710514
+-0.125398 0.495558 0.0704438
+-0.126113 0.494651 0.0524095
+
+
+0.436972 0.158224 0.185853
+0.436122 0.159501 0.18671
+0.434716 0.190815 0.158152
+0.418115 0.184823 0.20472
+0.416264 0.187307 0.206537
+
+
+0.436972 0.158224 0.185853
+0.426136 0.138953 0.222487
+0.385397 0.158158 0.281829
+0.38619 0.156654 0.281352
+0.384719 0.088236 0.307581
+0.3788 0.050547 0.323119
+0.377438 0.0523083 0.324372
+0.376579 0.0535137 0.325141
+
+
+0.436972 0.158224 0.185853
+0.438232 0.156411 0.184501
+0.434716 0.190815 0.158152
+0.420937 0.180958 0.201982
+0.41931 0.183154 0.203594
+0.418115 0.184823 0.20472
+
+
+0.0227021 0.486616 -0.156639
+0.0401629 0.485847 -0.168782
+-0.0248719 0.498374 -0.0374832
+-0.0283278 0.500148 0.0181009
+-0.0307565 0.500093 0.0202766
+
+
+0.0227021 0.486616 -0.156639
+-0.104262 0.466121 -0.149203
+-0.155687 0.458546 -0.129485
+-0.158866 0.459352 -0.124081
+-0.164923 0.436861 -0.17987
+-0.237656 0.429391 -0.120887
+-0.237434 0.430078 -0.119328
+-0.240267 0.428956 -0.116134
+-0.310534 0.370612 -0.128901
+-0.437614 0.292638 -0.0181431
+-0.433302 0.291645 -0.0330804
+-0.430822 0.291124 -0.0415199
+
+
+0.0227021 0.486616 -0.156639
+0.0192943 0.486771 -0.154222
+-0.0248719 0.498374 -0.0374832
+-0.0230387 0.500253 0.0135122
+-0.0250597 0.500215 0.0153314
+-0.0283278 0.500148 0.0181009
+
+
+0.364716 -0.261126 -0.234237
+0.3648 -0.260988 -0.234229
+0.359104 -0.187009 -0.293898
+0.359268 -0.186817 -0.293824
+0.35942 -0.186625 -0.293763
+0.359561 -0.186433 -0.293715
+0.359693 -0.186241 -0.293679
+0.359816 -0.186047 -0.293653
+0.35993 -0.185851 -0.293638
+0.360037 -0.185654 -0.293633
+
+
+0.364716 -0.261126 -0.234237
+0.415805 -0.23012 -0.156689
+0.440064 -0.247251 -0.0534511
+0.435701 -0.254163 -0.0550021
+0.417507 -0.273082 0.0340107
+0.416754 -0.274226 0.0341186
+
+
+0.364716 -0.261126 -0.234237
+0.358072 -0.271903 -0.235021
+0.358926 -0.187201 -0.293986
+0.359104 -0.187009 -0.293898
+
+
+0.442452 0.162415 -0.177607
+0.44255 0.162225 -0.177547
+0.447568 0.196469 -0.106809
+
+
+0.442452 0.162415 -0.177607
+0.412428 0.136992 -0.248066
+0.417456 0.182495 -0.209769
+0.418511 0.182587 -0.207846
+0.38169 0.223987 -0.233544
+0.386219 0.307935 -0.134513
+0.389194 0.300294 -0.137571
+0.44707 0.198425 -0.105384
+
+
+0.442452 0.162415 -0.177607
+0.439094 0.169043 -0.179571
+0.447496 0.196678 -0.106748
+
+
+0.190322 0.456063 -0.094965
+0.194556 0.454155 -0.0953656
+0.197165 0.452984 -0.0955619
+0.204528 0.456279 -0.0194397
+0.13599 0.484732 0.00899121
+0.136681 0.484649 0.0170307
+0.058974 0.496872 -0.00641194
+0.0411235 0.498277 0.00568709
+0.0414571 0.498239 0.00648931
+0.0272388 0.499148 0.0225842
+-0.124605 0.496118 0.115238
+-0.12675 0.496142 0.115519
+-0.124136 0.497008 0.101291
+
+
+0.392416 -0.319241 -0.0718827
+0.39097 -0.320753 -0.0734755
+
+
+0.439124 0.155063 0.183591
+0.438232 0.156411 0.184501
+
+
+0.439124 0.155063 0.183591
+0.426136 0.138953 0.222487
+0.389606 0.150322 0.279208
+0.390272 0.149048 0.278804
+0.384719 0.088236 0.307581
+0.381201 0.0473234 0.320913
+0.379723 0.0492488 0.322284
+0.3788 0.050547 0.323119
+
+
+0.439124 0.155063 0.183591
+0.440459 0.153124 0.182148
+
+
+0.472793 0.103587 0.146601
+0.469 0.10953 0.150801
+
+
+0.472793 0.103587 0.146601
+0.426136 0.138953 0.222487
+0.393192 0.143602 0.276949
+0.393769 0.142489 0.276596
+0.384719 0.088236 0.307581
+0.383857 0.0437366 0.318448
+0.382216 0.0458931 0.319984
+0.381201 0.0473234 0.320913
+
+
+0.472793 0.103587 0.146601
+0.478183 0.0952441 0.140521
+
+
+0.488774 -0.103943 0.0844616
+0.489127 -0.103767 0.0827298
+
+
+0.417456 0.182495 -0.209769
+0.414981 0.182396 -0.214174
+
+
+-0.0662686 0.404212 -0.329391
+-0.164923 0.436861 -0.17987
+-0.230332 0.433975 -0.116805
+-0.234364 0.431774 -0.118208
+-0.237434 0.430078 -0.119328
+
+
+-0.0662686 0.404212 -0.329391
+-0.0638418 0.406935 -0.325262
+-0.0578502 0.413738 -0.314887
+-0.164923 0.436861 -0.17987
+-0.222462 0.438261 -0.113993
+-0.226183 0.436247 -0.115288
+-0.230332 0.433975 -0.116805
+
+
+-0.0662686 0.404212 -0.329391
+-0.0728924 0.396641 -0.340835
+0.112594 0.380998 -0.304242
+-0.0251116 0.437026 -0.275089
+-0.0222684 0.438716 -0.271996
+-0.104262 0.466121 -0.149203
+-0.160271 0.459748 -0.121563
+-0.164387 0.460783 -0.11453
+-0.164923 0.436861 -0.17987
+-0.215081 0.442243 -0.111355
+-0.218591 0.440362 -0.112575
+-0.222462 0.438261 -0.113993
+
+
+0.360424 0.374013 -0.107533
+0.359341 0.374454 -0.108912
+0.352702 0.37237 -0.122559
+
+
+0.421401 0.182702 -0.202664
+0.422655 0.182804 -0.200367
+0.38169 0.223987 -0.233544
+0.392841 0.29079 -0.141468
+0.395157 0.284803 -0.143851
+0.447074 0.198359 -0.105495
+
+
+0.421401 0.182702 -0.202664
+0.412428 0.136992 -0.248066
+0.426151 0.182942 -0.194057
+0.427701 0.183059 -0.191204
+0.38169 0.223987 -0.233544
+0.398057 0.277183 -0.146968
+0.39994 0.272279 -0.148907
+0.44708 0.19829 -0.1056
+
+
+0.421401 0.182702 -0.202664
+0.418511 0.182587 -0.207846
+
+
+0.475231 -0.0562767 -0.145128
+0.474944 -0.0575213 -0.145558
+0.479066 -0.0747935 -0.1237
+0.484294 -0.156538 -0.0344587
+0.486048 -0.151319 -0.0309028
+0.487466 -0.147055 -0.0280628
+
+
+0.475231 -0.0562767 -0.145128
+0.467061 -0.0515947 -0.172025
+0.486663 -0.00691485 -0.124272
+
+
+0.475231 -0.0562767 -0.145128
+0.475602 -0.0549021 -0.144466
+0.479066 -0.0747935 -0.1237
+0.45458 -0.151577 -0.157958
+0.455624 -0.153064 -0.153115
+
+
+0.458369 0.125922 0.162674
+0.456321 0.129114 0.164904
+0.434716 0.190815 0.158152
+0.423466 0.177468 0.199506
+0.422 0.179459 0.200974
+0.420937 0.180958 0.201982
+
+
+0.458369 0.125922 0.162674
+0.426136 0.138953 0.222487
+0.396337 0.137669 0.274944
+0.39685 0.136669 0.274627
+0.384719 0.088236 0.307581
+0.416625 0.0727342 0.2687
+0.415969 0.0717108 0.269873
+
+
+0.458369 0.125922 0.162674
+0.461737 0.120773 0.1589
+
+
+0.21542 0.444606 -0.0971632
+0.218235 0.443302 -0.097371
+0.204528 0.456279 -0.0194397
+0.136713 0.484644 0.0173408
+0.137452 0.484524 0.0260332
+0.058974 0.496872 -0.00641194
+0.0425574 0.498136 0.00724176
+0.0428623 0.498097 0.00805067
+0.0272388 0.499148 0.0225842
+-0.089654 0.495679 0.110669
+-0.119804 0.496056 0.114638
+-0.124605 0.496118 0.115238
+
+
+0.21542 0.444606 -0.0971632
+0.181842 0.434736 -0.16834
+0.0894566 0.487087 -0.11904
+0.0911689 0.486939 -0.11766
+0.058974 0.496872 -0.00641194
+0.0439644 0.497989 0.00879046
+0.0442772 0.497946 0.00959718
+0.0272388 0.499148 0.0225842
+-0.06501 0.495321 0.107438
+-0.0863835 0.49563 0.110263
+-0.089654 0.495679 0.110669
+
+
+0.21542 0.444606 -0.0971632
+0.210983 0.446668 -0.0967532
+0.204528 0.456279 -0.0194397
+0.137486 0.484517 0.0263722
+0.138295 0.484351 0.0359912
+0.058974 0.496872 -0.00641194
+0.0453741 0.497833 0.0103675
+0.0457279 0.497784 0.011166
+0.0272388 0.499148 0.0225842
+-0.0463903 0.495009 0.104988
+-0.0626004 0.49528 0.107141
+-0.06501 0.495321 0.107438
+
+
+0.426136 0.138953 0.222487
+0.399165 0.132294 0.273117
+0.399632 0.131374 0.272825
+0.384719 0.088236 0.307581
+0.419357 0.0767897 0.263838
+0.418595 0.0756011 0.265211
+0.416625 0.0727342 0.2687
+
+
+0.426136 0.138953 0.222487
+0.401767 0.12731 0.271413
+0.402202 0.126446 0.271138
+0.384719 0.088236 0.307581
+0.413862 0.103523 0.263151
+0.415856 0.099534 0.261715
+0.416287 0.0986344 0.261418
+
+
+0.426136 0.138953 0.222487
+0.404212 0.122589 0.269789
+0.404626 0.12176 0.269525
+0.384719 0.088236 0.307581
+0.411531 0.108184 0.264794
+0.413452 0.104374 0.26343
+0.413862 0.103523 0.263151
+
+
+0.426136 0.138953 0.222487
+0.406557 0.118025 0.268211
+0.406957 0.117214 0.26795
+
+
+0.426136 0.138953 0.222487
+0.411132 0.109006 0.265062
+0.411531 0.108184 0.264794
+
+
+0.426136 0.138953 0.222487
+0.413452 0.104374 0.26343
+
+
+0.426136 0.138953 0.222487
+0.415856 0.099534 0.261715
+
+
+0.426136 0.138953 0.222487
+0.421151 0.0887411 0.257859
+0.421658 0.0876686 0.257497
+
+
+0.426136 0.138953 0.222487
+0.424222 0.0830555 0.255242
+
+
+0.426136 0.138953 0.222487
+0.427539 0.0808732 0.250288
+0.428462 0.0802358 0.248911
+
+
+0.426136 0.138953 0.222487
+0.434142 0.0764746 0.240293
+0.435089 0.0758111 0.238855
+
+
+0.426136 0.138953 0.222487
+0.441149 0.0717303 0.229497
+0.4422 0.0709837 0.22787
+
+
+0.426136 0.138953 0.222487
+0.449242 0.0661636 0.216813
+0.450521 0.0652459 0.214799
+
+
+0.426136 0.138953 0.222487
+0.459579 0.0589506 0.200358
+0.461323 0.057691 0.197572
+0.420272 0.0202432 0.270855
+0.46685 -0.0243536 0.194542
+
+
+0.426136 0.138953 0.222487
+0.466263 0.0542436 0.189612
+0.468414 0.0526863 0.186152
+0.420272 0.0202432 0.270855
+0.467256 -0.0143431 0.19338
+
+
+0.426136 0.138953 0.222487
+0.470038 0.0569195 0.180462
+
+
+0.426136 0.138953 0.222487
+0.471587 0.0638129 0.173322
+
+
+0.426136 0.138953 0.222487
+0.473069 0.070572 0.166302
+
+
+0.426136 0.138953 0.222487
+0.474516 0.0773276 0.159268
+
+
+0.426136 0.138953 0.222487
+0.477411 0.0913617 0.144597
+
+
+0.426136 0.138953 0.222487
+0.453688 0.133111 0.167842
+0.452048 0.135658 0.169611
+0.434716 0.190815 0.158152
+0.425786 0.174242 0.197215
+0.424435 0.176089 0.198582
+0.423466 0.177468 0.199506
+
+
+0.426136 0.138953 0.222487
+0.449893 0.138903 0.172003
+0.448525 0.141018 0.173464
+0.434716 0.190815 0.158152
+0.42796 0.171194 0.195048
+0.426688 0.172945 0.196348
+0.425786 0.174242 0.197215
+
+
+0.426136 0.138953 0.222487
+0.446695 0.143752 0.175485
+0.445514 0.145569 0.176731
+0.434716 0.190815 0.158152
+0.430038 0.168254 0.192955
+0.428817 0.16995 0.194217
+0.42796 0.171194 0.195048
+
+
+0.426136 0.138953 0.222487
+0.44391 0.147944 0.178492
+0.442861 0.149549 0.179586
+
+
+0.426136 0.138953 0.222487
+0.434908 0.161231 0.188001
+0.43408 0.162464 0.188827
+0.434716 0.190815 0.158152
+0.432065 0.165363 0.190895
+0.43087 0.167037 0.192143
+0.430038 0.168254 0.192955
+
+
+0.426136 0.138953 0.222487
+0.432887 0.164149 0.190084
+0.432065 0.165363 0.190895
+
+
+0.426136 0.138953 0.222487
+0.43087 0.167037 0.192143
+
+
+0.426136 0.138953 0.222487
+0.428817 0.16995 0.194217
+
+
+0.426136 0.138953 0.222487
+0.426688 0.172945 0.196348
+
+
+0.426136 0.138953 0.222487
+0.424435 0.176089 0.198582
+
+
+0.426136 0.138953 0.222487
+0.422 0.179459 0.200974
+
+
+0.426136 0.138953 0.222487
+0.41931 0.183154 0.203594
+
+
+0.426136 0.138953 0.222487
+0.412717 0.192111 0.209937
+
+
+0.426136 0.138953 0.222487
+0.408452 0.197851 0.213997
+
+
+0.295768 0.128566 0.382091
+0.293559 0.128047 0.383966
+0.29297 0.128334 0.384323
+0.294672 0.12964 0.382575
+0.295768 0.128566 0.382091
+0.296062 0.128345 0.381938
+0.298194 0.128279 0.38031
+0.298327 0.128326 0.380192
+0.300005 0.128297 0.378896
+
+
+0.160747 0.403096 0.255208
+0.161371 0.404298 0.253109
+0.219585 0.354976 0.275998
+0.172355 0.360481 0.302549
+0.171955 0.361165 0.301976
+0.170223 0.364295 0.299276
+
+
+0.160747 0.403096 0.255208
+0.0840644 0.412413 0.270646
+0.0375362 0.417426 0.273994
+0.0375855 0.41562 0.276722
+-0.00934473 0.41695 0.276524
+-0.0929409 0.404538 0.286266
+-0.0958854 0.408021 0.280762
+-0.0965629 0.408857 0.279445
+
+
+0.160747 0.403096 0.255208
+0.159427 0.400348 0.259926
+0.219585 0.354976 0.275998
+0.174432 0.35674 0.305736
+0.174038 0.357416 0.305173
+0.172355 0.360481 0.302549
+
+
+0.40833 0.181979 -0.225984
+0.406492 0.1819 -0.229178
+
+
+0.44391 0.147944 0.178492
+0.445514 0.145569 0.176731
+
+
+0.365682 0.3726 -0.0883174
+0.362157 0.373544 -0.10129
+
+
+0.365682 0.3726 -0.0883174
+0.204528 0.456279 -0.0194397
+0.138332 0.484343 0.036371
+0.139242 0.484119 0.0472929
+0.058974 0.496872 -0.00641194
+0.0468231 0.497663 0.0120008
+0.0472372 0.497606 0.0127969
+0.0272388 0.499148 0.0225842
+-0.031575 0.494723 0.103031
+-0.0445101 0.494972 0.104758
+-0.0463903 0.495009 0.104988
+
+
+0.365682 0.3726 -0.0883174
+0.367201 0.372165 -0.0827889
+0.447085 0.198649 -0.104869
+0.447098 0.198695 -0.104717
+0.447115 0.198735 -0.104554
+0.447137 0.19877 -0.104378
+0.447166 0.198798 -0.104186
+0.447201 0.198818 -0.103975
+0.447245 0.198829 -0.103744
+0.447298 0.198827 -0.103488
+0.447364 0.19881 -0.103202
+0.447446 0.198773 -0.102882
+0.447545 0.198712 -0.102521
+
+
+0.456685 0.172215 -0.108761
+0.45652 0.173363 -0.107553
+0.450359 0.190091 -0.105797
+0.449732 0.1914 -0.106268
+0.449244 0.192461 -0.106558
+0.448969 0.19308 -0.10668
+0.44887 0.193295 -0.106738
+0.448585 0.193932 -0.106863
+
+
+0.456685 0.172215 -0.108761
+0.461221 0.171578 -0.0894716
+0.461672 0.170999 -0.0884176
+0.462019 0.170592 -0.0875331
+0.462286 0.17031 -0.086791
+0.462494 0.170116 -0.0861657
+
+
+0.456685 0.172215 -0.108761
+0.456771 0.170934 -0.110519
+0.449732 0.1914 -0.106268
+
+
+0.165312 0.467056 -0.0927776
+0.168408 0.465721 -0.0930228
+0.204528 0.456279 -0.0194397
+0.139283 0.484108 0.0477301
+0.140337 0.483808 0.0604996
+0.058974 0.496872 -0.00641194
+0.0483494 0.497476 0.0137194
+0.0488341 0.497408 0.0145301
+0.0272388 0.499148 0.0225842
+-0.0192942 0.494451 0.101402
+-0.0300411 0.494688 0.102845
+-0.031575 0.494723 0.103031
+
+
+0.165312 0.467056 -0.0927776
+0.181842 0.434736 -0.16834
+0.0988323 0.486235 -0.111599
+0.100428 0.48609 -0.110309
+0.058974 0.496872 -0.00641194
+0.0499929 0.497266 0.0155619
+0.0505584 0.497185 0.0164118
+0.0272388 0.499148 0.0225842
+-0.00876413 0.494185 0.0999982
+-0.0179965 0.494417 0.101245
+-0.0192942 0.494451 0.101402
+
+
+0.165312 0.467056 -0.0927776
+0.160075 0.469321 -0.0922735
+0.204528 0.456279 -0.0194397
+0.140385 0.483794 0.061019
+0.141202 0.483532 0.0710089
+0.139951 0.483665 0.0747679
+0.058974 0.496872 -0.00641194
+0.0518021 0.497025 0.0175813
+0.0524644 0.496929 0.0185013
+0.0272388 0.499148 0.0225842
+0.000529808 0.49392 0.0987532
+-0.00763206 0.494152 0.0998619
+-0.00876413 0.494185 0.0999982
+
+
+0.319893 0.361794 -0.18889
+0.181842 0.434736 -0.16834
+0.107646 0.485393 -0.104588
+0.109164 0.485247 -0.103357
+0.058974 0.496872 -0.00641194
+0.0538422 0.496743 0.0198507
+0.0546278 0.496627 0.0208811
+0.0272388 0.499148 0.0225842
+0.00894442 0.493651 0.0976201
+0.0015441 0.493886 0.0986315
+0.000529808 0.49392 0.0987532
+
+
+-0.0366012 0.245563 0.45463
+-0.0163186 0.244866 0.450786
+
+
+0.158638 0.443384 0.18767
+0.157167 0.446572 0.180942
+0.245333 0.413089 0.139891
+0.151049 0.459309 0.153627
+0.150558 0.460273 0.151541
+0.150522 0.460936 0.149623
+0.150475 0.46293 0.143752
+
+
+0.158638 0.443384 0.18767
+0.0566727 0.45453 0.201473
+-0.0221378 0.457315 0.209495
+-0.023456 0.457811 0.208618
+-0.029568 0.460178 0.204403
+
+
+0.158638 0.443384 0.18767
+0.159168 0.442283 0.189957
+0.245333 0.413089 0.139891
+0.153147 0.455003 0.162952
+0.152604 0.456084 0.160637
+0.151049 0.459309 0.153627
+
+
+0.436489 0.277873 0.028479
+0.441086 0.266942 0.0299311
+0.434716 0.190815 0.158152
+0.478397 0.09562 0.139496
+
+
+0.436489 0.277873 0.028479
+0.462361 0.173235 -0.0806834
+
+
+0.436489 0.277873 0.028479
+0.436232 0.278481 0.028403
+0.433822 0.283665 0.0284206
+0.432326 0.286873 0.0284056
+0.447446 0.198773 -0.102882
+
+
+0.445749 -0.238179 -0.0513881
+0.446992 -0.236191 -0.0509147
+
+
+0.378214 -0.334004 -0.0872148
+0.376619 -0.33564 -0.0889478
+
+
+0.278068 -0.418291 0.0488893
+0.276629 -0.419237 0.0519175
+
+
+0.429886 -0.149214 -0.224553
+0.360635 -0.184143 -0.293835
+0.360698 -0.183893 -0.293909
+0.360753 -0.183631 -0.293999
+0.360801 -0.183355 -0.294106
+0.360838 -0.183064 -0.294233
+0.360865 -0.182755 -0.294383
+0.360878 -0.182426 -0.29456
+0.360875 -0.182076 -0.294767
+0.360853 -0.181702 -0.29501
+0.360832 -0.181519 -0.295141
+0.350127 -0.178128 -0.309333
+0.349424 -0.179313 -0.309444
+0.349321 -0.179684 -0.309345
+
+
+0.429886 -0.149214 -0.224553
+0.433011 -0.143553 -0.223991
+0.433695 -0.143591 -0.222245
+0.467061 -0.0515947 -0.172025
+0.483906 -0.0192191 -0.129489
+0.482932 -0.0236374 -0.131283
+0.479066 -0.0747935 -0.1237
+0.452735 -0.149053 -0.166303
+0.453841 -0.150605 -0.161274
+0.45458 -0.151577 -0.157958
+
+
+0.429886 -0.149214 -0.224553
+0.429794 -0.149382 -0.224567
+0.415805 -0.23012 -0.156689
+0.434529 -0.256006 -0.0554421
+0.430207 -0.262792 -0.0569648
+
+
+0.352469 -0.36014 -0.114581
+0.350585 -0.362023 -0.116589
+0.350403 -0.362096 -0.116961
+0.344784 -0.364363 -0.128281
+0.246306 -0.434405 -0.0320329
+0.215629 -0.453827 0.0533801
+0.215578 -0.453594 0.0452108
+0.183592 -0.464325 -0.0331205
+0.215614 -0.452609 0.0164577
+0.215664 -0.452366 0.0105026
+0.215612 -0.452274 0.0074649
+
+
+0.273261 -0.421427 0.0592171
+0.271551 -0.422536 0.0628091
+
+
+0.395745 -0.301421 0.0517842
+0.395454 -0.302048 0.0504753
+
+
+0.473725 0.0897604 -0.162968
+0.469608 0.101178 -0.1641
+0.412428 0.136992 -0.248066
+0.431972 0.182893 -0.183661
+0.432073 0.1827 -0.183601
+0.44738 0.197034 -0.106612
+
+
+0.432057 -0.139008 -0.2281
+0.433011 -0.143553 -0.223991
+
+
+0.432057 -0.139008 -0.2281
+0.360698 -0.183893 -0.293909
+
+
+0.432057 -0.139008 -0.2281
+0.431576 -0.13663 -0.230204
+0.467061 -0.0515947 -0.172025
+0.481951 -0.0278565 -0.133147
+0.481224 -0.0311422 -0.134463
+0.479066 -0.0747935 -0.1237
+0.450754 -0.146374 -0.175113
+0.451947 -0.148028 -0.169781
+0.452735 -0.149053 -0.166303
+
+
+0.349893 -0.285096 -0.235957
+0.350014 -0.284899 -0.235945
+0.358734 -0.187393 -0.294092
+0.358926 -0.187201 -0.293986
+
+
+0.349893 -0.285096 -0.235957
+0.415805 -0.23012 -0.156689
+0.423477 -0.273255 -0.0593658
+0.418987 -0.280182 -0.0609209
+
+
+0.349893 -0.285096 -0.235957
+0.339991 -0.300978 -0.237067
+0.358525 -0.187585 -0.294217
+0.358734 -0.187393 -0.294092
+
+
+0.435169 -0.0841327 -0.239404
+0.43804 -0.0745216 -0.235415
+0.429296 -0.00494892 -0.257062
+0.441504 0.0671587 -0.232053
+0.44007 0.0671766 -0.234516
+0.43755 0.0671199 -0.23885
+
+
+0.435169 -0.0841327 -0.239404
+0.467061 -0.0515947 -0.172025
+0.480464 -0.0343613 -0.135899
+0.47989 -0.0369452 -0.136918
+0.479066 -0.0747935 -0.1237
+0.461239 -0.105631 -0.165254
+0.459538 -0.111178 -0.167582
+
+
+0.435169 -0.0841327 -0.239404
+0.435046 -0.0845331 -0.239577
+0.429296 -0.00494892 -0.257062
+0.445747 0.0671962 -0.224698
+0.444198 0.0672154 -0.227382
+0.441504 0.0671587 -0.232053
+
+
+0.408507 -0.0993482 -0.282189
+0.411362 -0.101464 -0.27736
+0.429296 -0.00494892 -0.257062
+0.450406 0.0672332 -0.216556
+0.448692 0.0672536 -0.21955
+0.445747 0.0671962 -0.224698
+
+
+0.408507 -0.0993482 -0.282189
+0.360853 -0.181702 -0.29501
+
+
+0.408507 -0.0993482 -0.282189
+0.406697 -0.0979548 -0.285254
+0.429296 -0.00494892 -0.257062
+0.455658 0.0672703 -0.207308
+0.453709 0.0672921 -0.210739
+0.450406 0.0672332 -0.216556
+
+
+0.357973 -0.272066 -0.235031
+0.358072 -0.271903 -0.235021
+
+
+0.357973 -0.272066 -0.235031
+0.415805 -0.23012 -0.156689
+0.411717 -0.291289 -0.0634693
+0.406672 -0.298942 -0.0651889
+
+
+0.357973 -0.272066 -0.235031
+0.350014 -0.284899 -0.235945
+
+
+0.492273 -0.132399 -0.0181568
+0.452817 -0.199577 0.0743398
+0.432571 -0.235134 0.0903847
+0.433577 -0.234601 0.0862842
+0.424862 -0.255539 0.0653927
+
+
+0.426114 0.200132 -0.177359
+0.427085 0.19731 -0.178406
+0.447293 0.197327 -0.106463
+
+
+0.426114 0.200132 -0.177359
+0.38169 0.223987 -0.233544
+0.402337 0.265922 -0.151501
+0.403923 0.261758 -0.153137
+0.44709 0.198217 -0.105701
+
+
+0.426114 0.200132 -0.177359
+0.424794 0.204028 -0.175836
+0.447258 0.197455 -0.106385
+
+
+0.387673 -0.319744 -0.000666084
+0.387967 -0.319618 -0.00313796
+
+
+0.464133 -0.165293 -0.111856
+0.463083 -0.163692 -0.11722
+
+
+0.458917 -0.215596 -0.035824
+0.456458 -0.218865 -0.0304166
+
+
+0.458917 -0.215596 -0.035824
+0.460134 -0.214291 -0.0410739
+
+
+0.458917 -0.215596 -0.035824
+0.454793 -0.219047 -0.0143969
+0.452817 -0.199577 0.0743398
+0.433745 -0.234492 0.0856527
+0.434634 -0.234011 0.0819785
+0.425302 -0.255014 0.0645801
+
+
+0.404313 0.0548027 0.289894
+0.404766 0.0554967 0.28913
+
+
+0.479042 0.0748672 -0.161494
+0.479411 0.0738207 -0.161399
+
+
+0.44261 -0.0590222 -0.228935
+0.444326 -0.0530873 -0.226449
+0.429296 -0.00494892 -0.257062
+0.461752 0.0673082 -0.196498
+0.459469 0.0673317 -0.200547
+0.455658 0.0672703 -0.207308
+
+
+0.44261 -0.0590222 -0.228935
+0.467061 -0.0515947 -0.172025
+0.479269 -0.0395237 -0.138081
+0.478795 -0.0416468 -0.138902
+0.479066 -0.0747935 -0.1237
+0.463698 -0.097434 -0.161932
+0.462471 -0.101447 -0.163636
+0.461239 -0.105631 -0.165254
+
+
+0.44261 -0.0590222 -0.228935
+0.442539 -0.0592568 -0.229039
+0.429296 -0.00494892 -0.257062
+0.472498 0.0589006 -0.177532
+0.472676 0.0596495 -0.17719
+0.474471 0.0674164 -0.173731
+
+
+0.343747 -0.189917 -0.309469
+0.342957 -0.187075 -0.312078
+0.341977 -0.185984 -0.313827
+0.341375 -0.185628 -0.31471
+0.34025 -0.184491 -0.316638
+0.339539 -0.183461 -0.318044
+0.339422 -0.183335 -0.318249
+0.338813 -0.182463 -0.31944
+0.338367 -0.18163 -0.320428
+0.338047 -0.180859 -0.321238
+0.337824 -0.180157 -0.321899
+0.337819 -0.180136 -0.321918
+0.337647 -0.179595 -0.322425
+0.337522 -0.179079 -0.322865
+0.337439 -0.178602 -0.323235
+0.33739 -0.178163 -0.323546
+0.337367 -0.177757 -0.323808
+0.337365 -0.177381 -0.324029
+0.337381 -0.177031 -0.324215
+0.33741 -0.176706 -0.324372
+0.337451 -0.176403 -0.324504
+0.337452 -0.176397 -0.324506
+0.337487 -0.176127 -0.324622
+0.337533 -0.175864 -0.324723
+0.337587 -0.175612 -0.324807
+0.337649 -0.175371 -0.324878
+0.337717 -0.175139 -0.324935
+0.337792 -0.174914 -0.32498
+0.337874 -0.174697 -0.325014
+0.337962 -0.174486 -0.325038
+0.338056 -0.17428 -0.325052
+0.338157 -0.174078 -0.325055
+0.338264 -0.173881 -0.325049
+0.338378 -0.173688 -0.325033
+0.3385 -0.173497 -0.325007
+0.33863 -0.173309 -0.324971
+0.338768 -0.173122 -0.324924
+0.338858 -0.17301 -0.324888
+0.338914 -0.172934 -0.324868
+0.33907 -0.172738 -0.324806
+0.339239 -0.172541 -0.324729
+0.339423 -0.172343 -0.324635
+0.339625 -0.172143 -0.324524
+0.339845 -0.171941 -0.324391
+0.340088 -0.171738 -0.324235
+0.340357 -0.171534 -0.324051
+0.340654 -0.171331 -0.323834
+0.340984 -0.171129 -0.323579
+0.341353 -0.170931 -0.323279
+0.385113 -0.0781817 -0.321119
+0.387763 -0.0812477 -0.316759
+0.429296 -0.00494892 -0.257062
+0.468429 0.0414532 -0.185295
+0.468558 0.0419913 -0.185048
+0.472498 0.0589006 -0.177532
+
+
+0.343747 -0.189917 -0.309469
+0.344352 -0.189472 -0.309068
+0.344647 -0.187652 -0.309848
+0.342957 -0.187075 -0.312078
+
+
+0.343747 -0.189917 -0.309469
+0.342913 -0.191786 -0.309248
+0.348387 -0.189468 -0.304563
+0.350076 -0.189772 -0.302481
+0.350837 -0.189767 -0.301627
+0.346844 -0.184469 -0.309311
+
+
+0.418079 -0.170416 -0.226606
+0.418148 -0.170291 -0.226596
+0.360489 -0.184611 -0.293729
+0.360565 -0.184382 -0.293776
+0.360635 -0.184143 -0.293835
+
+
+0.418079 -0.170416 -0.226606
+0.415805 -0.23012 -0.156689
+0.350403 -0.362096 -0.116961
+
+
+0.418079 -0.170416 -0.226606
+0.413272 -0.178954 -0.227415
+0.360407 -0.184832 -0.293693
+0.360489 -0.184611 -0.293729
+
+
+0.215173 -0.449267 -0.0465291
+0.215096 -0.449172 -0.0479944
+0.183592 -0.464325 -0.0331205
+0.215605 -0.453029 0.0283531
+0.215666 -0.452725 0.0203986
+0.215614 -0.452609 0.0164577
+
+
+0.215173 -0.449267 -0.0465291
+0.246306 -0.434405 -0.0320329
+0.215657 -0.453186 0.0337899
+0.215605 -0.453029 0.0283531
+
+
+0.215173 -0.449267 -0.0465291
+0.215175 -0.44948 -0.0440892
+0.183592 -0.464325 -0.0331205
+0.208594 -0.457729 0.0873555
+0.211247 -0.45663 0.0867622
+0.215562 -0.454843 0.0857489
+0.215563 -0.454837 0.0855695
+
+
+0.396634 -0.207963 -0.230028
+0.396687 -0.207871 -0.230022
+
+
+0.396634 -0.207963 -0.230028
+0.415805 -0.23012 -0.156689
+0.343728 -0.364776 -0.130431
+0.337845 -0.367098 -0.142197
+0.246306 -0.434405 -0.0320329
+0.215666 -0.452725 0.0203986
+
+
+0.396634 -0.207963 -0.230028
+0.392786 -0.214536 -0.230591
+0.35993 -0.185851 -0.293638
+
+
+0.35495 -0.168619 -0.309163
+0.355814 -0.166609 -0.30927
+0.348943 -0.170056 -0.315222
+0.348977 -0.170071 -0.315176
+0.350955 -0.170442 -0.312722
+0.352099 -0.171206 -0.310996
+0.353898 -0.170929 -0.309096
+0.354516 -0.16909 -0.309402
+0.350955 -0.170442 -0.312722
+
+
+0.35495 -0.168619 -0.309163
+0.356086 -0.173272 -0.305288
+0.355048 -0.172795 -0.306744
+0.352773 -0.173085 -0.309182
+0.351877 -0.174411 -0.309461
+0.351816 -0.17487 -0.309271
+0.351041 -0.176131 -0.309438
+0.350951 -0.176535 -0.30931
+0.350227 -0.177747 -0.309438
+0.350127 -0.178128 -0.309333
+
+
+0.35495 -0.168619 -0.309163
+0.354516 -0.16909 -0.309402
+
+
+0.311895 -0.376858 -0.193517
+0.30313 -0.380041 -0.210608
+0.246306 -0.434405 -0.0320329
+0.215664 -0.452366 0.0105026
+
+
+0.311895 -0.376858 -0.193517
+0.415805 -0.23012 -0.156689
+0.336728 -0.367525 -0.144454
+0.330445 -0.369951 -0.156935
+0.246306 -0.434405 -0.0320329
+0.215655 -0.452067 0.00276058
+
+
+0.311895 -0.376858 -0.193517
+0.313401 -0.376316 -0.19054
+0.246306 -0.434405 -0.0320329
+0.21564 -0.451807 -0.00357062
+
+
+0.510346 -0.00667079 -0.0235105
+0.49032 -0.00243348 0.0999044
+0.493129 -0.101895 0.0624238
+0.492767 -0.102085 0.0642728
+0.491114 -0.102851 0.0727516
+
+
+0.0996468 -0.402728 -0.285392
+0.0859812 -0.404631 -0.284912
+0.0339636 -0.431711 -0.250744
+0.241811 -0.412 -0.239864
+0.255705 -0.402477 -0.253196
+0.260937 -0.398858 -0.258273
+0.0339636 -0.431711 -0.250744
+0.225632 -0.42303 -0.22429
+0.23744 -0.415001 -0.235619
+0.241811 -0.412 -0.239864
+
+
+0.0996468 -0.402728 -0.285392
+0.0259521 -0.389689 -0.312841
+0.244558 -0.372289 -0.302354
+0.243304 -0.369978 -0.305402
+0.272571 -0.31764 -0.306664
+0.337522 -0.179079 -0.322865
+
+
+0.0996468 -0.402728 -0.285392
+0.099914 -0.402693 -0.285398
+0.0339636 -0.431711 -0.250744
+0.211514 -0.432574 -0.2107
+0.221859 -0.425601 -0.220623
+0.225632 -0.42303 -0.22429
+
+
+0.365097 -0.147759 -0.308661
+0.368638 -0.14033 -0.308497
+0.343492 -0.170095 -0.321349
+0.344248 -0.169938 -0.320587
+0.345112 -0.169846 -0.319667
+0.345437 -0.169849 -0.319301
+0.34621 -0.169762 -0.318476
+0.347522 -0.169787 -0.31698
+0.348943 -0.170056 -0.315222
+
+
+0.365097 -0.147759 -0.308661
+0.360036 -0.178406 -0.297847
+0.35976 -0.177894 -0.298459
+0.350951 -0.176535 -0.30931
+
+
+0.365097 -0.147759 -0.308661
+0.364254 -0.149394 -0.308767
+0.344248 -0.169938 -0.320587
+
+
+0.353898 -0.170929 -0.309096
+0.354096 -0.17148 -0.308564
+0.352629 -0.172272 -0.309801
+0.352773 -0.173085 -0.309182
+
+
+0.345437 -0.169849 -0.319301
+0.351041 -0.176131 -0.309438
+
+
+0.368706 -0.0591238 -0.347726
+0.372142 -0.0630471 -0.342226
+0.429296 -0.00494892 -0.257062
+0.465375 0.0284833 -0.191053
+0.465476 0.0288952 -0.190863
+0.468429 0.0414532 -0.185295
+
+
+0.368706 -0.0591238 -0.347726
+0.340357 -0.171534 -0.324051
+
+
+0.368706 -0.0591238 -0.347726
+0.365801 -0.0557301 -0.35238
+0.429296 -0.00494892 -0.257062
+0.462949 0.0182909 -0.195566
+0.463031 0.0186218 -0.195413
+0.465375 0.0284833 -0.191053
+
+
+0.317416 0.258935 -0.296795
+0.314934 0.262939 -0.296735
+0.306299 0.180405 -0.352186
+0.264271 0.24278 -0.352519
+0.263858 0.241562 -0.353541
+0.262346 0.236769 -0.357474
+0.306299 0.180405 -0.352186
+0.266401 0.24947 -0.346972
+0.265941 0.2481 -0.348128
+0.264271 0.24278 -0.352519
+
+
+0.317416 0.258935 -0.296795
+0.38169 0.223987 -0.233544
+0.405968 0.256276 -0.155366
+0.407345 0.252631 -0.156789
+0.447101 0.198139 -0.105797
+
+
+0.317416 0.258935 -0.296795
+0.321281 0.252577 -0.29696
+0.306299 0.180405 -0.352186
+0.268823 0.257116 -0.340595
+0.268297 0.255531 -0.341937
+0.266401 0.24947 -0.346972
+
+
+0.209875 0.289658 0.35999
+0.204291 0.3005 0.351404
+0.219585 0.354976 0.275998
+0.176493 0.352998 0.308897
+0.176099 0.35368 0.308335
+0.174432 0.35674 0.305736
+
+
+0.209875 0.289658 0.35999
+0.127516 0.351781 0.332251
+0.0233209 0.356976 0.360241
+0.0280142 0.361536 0.35395
+0.0300742 0.363475 0.351253
+
+
+0.209875 0.289658 0.35999
+0.21105 0.287431 0.361733
+0.211403 0.287219 0.361719
+0.218292 0.283002 0.361494
+0.145377 0.224646 0.422847
+0.106796 0.232203 0.430207
+0.105372 0.233563 0.429896
+0.101959 0.237094 0.429007
+
+
+0.262554 0.375219 0.20988
+0.256036 0.379077 0.210282
+0.245333 0.413089 0.139891
+0.155173 0.450785 0.171997
+0.154645 0.451852 0.169735
+0.153147 0.455003 0.162952
+
+
+0.262554 0.375219 0.20988
+0.219585 0.354976 0.275998
+0.178579 0.349184 0.312094
+0.178178 0.349884 0.311521
+0.176493 0.352998 0.308897
+
+
+0.262554 0.375219 0.20988
+0.263215 0.374832 0.209828
+0.245333 0.413089 0.139891
+0.161215 0.437833 0.199221
+0.160669 0.438983 0.196853
+0.159168 0.442283 0.189957
+
+
+0.351855 0.372113 -0.124276
+0.181842 0.434736 -0.16834
+0.116102 0.484543 -0.0978453
+0.117576 0.484395 -0.0966473
+0.058974 0.496872 -0.00641194
+0.0562063 0.496405 0.0224748
+0.0571584 0.496261 0.0236715
+0.0272388 0.499148 0.0225842
+0.0167405 0.493372 0.0965646
+0.00987517 0.493616 0.0975085
+0.00894442 0.493651 0.0976201
+
+
+0.381044 0.234334 0.239671
+0.371351 0.247076 0.24875
+
+
+0.414065 0.18231 -0.215836
+0.411879 0.182221 -0.219695
+
+
+0.426151 0.182942 -0.194057
+0.422655 0.182804 -0.200367
+
+
+0.201383 0.451063 -0.0959583
+0.204007 0.449872 -0.0961542
+0.204528 0.456279 -0.0194397
+0.148824 0.4803 0.066173
+0.162719 0.474379 0.0574603
+0.165081 0.473372 0.0559302
+0.174896 0.469162 0.0497762
+0.242498 0.434148 0.0557766
+0.162719 0.474379 0.0574603
+
+
+0.201383 0.451063 -0.0959583
+0.181842 0.434736 -0.16834
+0.124375 0.48367 -0.0912331
+0.125833 0.483516 -0.0900448
+0.058974 0.496872 -0.00641194
+0.0590356 0.495989 0.0256106
+0.0602246 0.495806 0.0270583
+0.0272388 0.499148 0.0225842
+0.0241193 0.493081 0.0955599
+0.0176135 0.493337 0.0964598
+0.0167405 0.493372 0.0965646
+
+
+0.201383 0.451063 -0.0959583
+0.197165 0.452984 -0.0955619
+
+
+0.293039 0.407248 -0.103591
+0.301027 0.403328 -0.104193
+0.204528 0.456279 -0.0194397
+0.165081 0.473372 0.0559302
+
+
+0.293039 0.407248 -0.103591
+0.181842 0.434736 -0.16834
+0.13585 0.479613 -0.0901081
+0.140311 0.477739 -0.0904787
+0.204528 0.456279 -0.0194397
+0.176627 0.46842 0.0486467
+0.184049 0.465214 0.0439925
+0.242498 0.434148 0.0557766
+0.145334 0.48178 0.0684178
+0.148824 0.4803 0.066173
+
+
+0.293039 0.407248 -0.103591
+0.281728 0.412807 -0.102626
+
+
+0.238717 0.426906 0.105285
+0.245333 0.413089 0.139891
+0.165877 0.432505 0.206803
+0.164013 0.43435 0.204556
+0.161768 0.436599 0.201773
+0.161215 0.437833 0.199221
+
+
+-0.255286 -0.134105 0.421266
+-0.255338 -0.134177 0.421219
+
+
+-0.255286 -0.134105 0.421266
+-0.143539 -0.180191 0.444216
+-0.0426881 -0.188595 0.46871
+-0.0439822 -0.194744 0.465848
+-0.0446508 -0.197725 0.464448
+
+
+-0.255286 -0.134105 0.421266
+-0.249068 -0.125333 0.426962
+-0.310123 -0.0280028 0.391714
+-0.243006 -0.116802 0.432455
+-0.249018 -0.125264 0.427007
+-0.249068 -0.125333 0.426962
+
+
+0.412428 0.136992 -0.248066
+0.435526 0.176012 -0.181635
+0.435624 0.175825 -0.181576
+0.447434 0.196865 -0.106682
+
+
+0.412428 0.136992 -0.248066
+0.438997 0.16923 -0.17963
+0.439094 0.169043 -0.179571
+
+
+0.412428 0.136992 -0.248066
+0.445959 0.155433 -0.175527
+0.446059 0.155237 -0.175464
+0.447651 0.196235 -0.106864
+
+
+0.412428 0.136992 -0.248066
+0.449589 0.148139 -0.173345
+0.449693 0.147931 -0.173279
+0.447749 0.195971 -0.10691
+
+
+0.412428 0.136992 -0.248066
+0.453424 0.14036 -0.171009
+0.453535 0.140137 -0.170938
+0.447863 0.195671 -0.106945
+
+
+0.412428 0.136992 -0.248066
+0.457568 0.131882 -0.168454
+0.45769 0.131635 -0.168376
+0.447998 0.195328 -0.106964
+
+
+0.412428 0.136992 -0.248066
+0.461814 0.122518 -0.166157
+0.465118 0.113538 -0.165285
+0.462886 0.169853 -0.0847906
+
+
+0.412428 0.136992 -0.248066
+0.46552 0.112425 -0.16519
+0.469159 0.102432 -0.164209
+0.462968 0.169812 -0.0844696
+0.463035 0.169791 -0.0841838
+
+
+0.412428 0.136992 -0.248066
+0.479206 0.0735559 -0.161914
+
+
+0.412428 0.136992 -0.248066
+0.474586 0.0675676 -0.173444
+
+
+0.412428 0.136992 -0.248066
+0.466299 0.0673736 -0.188379
+0.461752 0.0673082 -0.196498
+
+
+0.412428 0.136992 -0.248066
+0.459469 0.0673317 -0.200547
+
+
+0.412428 0.136992 -0.248066
+0.453709 0.0672921 -0.210739
+
+
+0.412428 0.136992 -0.248066
+0.448692 0.0672536 -0.21955
+
+
+0.412428 0.136992 -0.248066
+0.444198 0.0672154 -0.227382
+
+
+0.412428 0.136992 -0.248066
+0.44007 0.0671766 -0.234516
+
+
+0.412428 0.136992 -0.248066
+0.432475 0.067095 -0.247478
+0.430125 0.0670364 -0.251449
+
+
+0.412428 0.136992 -0.248066
+0.428835 0.0670509 -0.253608
+
+
+0.412428 0.136992 -0.248066
+0.425203 0.0670035 -0.25967
+
+
+0.412428 0.136992 -0.248066
+0.421509 0.0669519 -0.265781
+0.419061 0.0668851 -0.269809
+0.429296 -0.00494892 -0.257062
+0.460934 0.00992602 -0.19926
+0.461004 0.0102024 -0.199132
+0.462949 0.0182909 -0.195566
+
+
+0.412428 0.136992 -0.248066
+0.417678 0.066895 -0.272064
+0.415099 0.0668235 -0.276272
+0.429296 -0.00494892 -0.257062
+0.459199 0.00281297 -0.202391
+0.45926 0.00305138 -0.20228
+0.460934 0.00992602 -0.19926
+
+
+0.412428 0.136992 -0.248066
+0.413626 0.0668314 -0.278652
+0.410852 0.0667538 -0.283141
+0.429296 -0.00494892 -0.257062
+0.457657 -0.00342028 -0.205125
+0.457713 -0.00320875 -0.205027
+0.459199 0.00281297 -0.202391
+
+
+0.412428 0.136992 -0.248066
+0.409251 0.0667591 -0.285708
+0.4062 0.0666735 -0.290605
+0.429296 -0.00494892 -0.257062
+0.456251 -0.00902819 -0.207576
+0.456302 -0.00883578 -0.207487
+0.457657 -0.00342028 -0.205125
+
+
+0.412428 0.136992 -0.248066
+0.40442 0.0666756 -0.293439
+0.400983 0.0665794 -0.298913
+0.429296 -0.00494892 -0.257062
+0.454935 -0.0141942 -0.209826
+0.454984 -0.0140152 -0.209743
+0.456251 -0.00902819 -0.207576
+
+
+0.412428 0.136992 -0.248066
+0.398952 0.066577 -0.302123
+0.394975 0.0664665 -0.308412
+0.429296 -0.00494892 -0.257062
+0.453678 -0.0190578 -0.211936
+0.453725 -0.0188877 -0.211856
+0.454935 -0.0141942 -0.209826
+
+
+0.412428 0.136992 -0.248066
+0.392591 0.066458 -0.312156
+0.387843 0.0663276 -0.319613
+0.429296 -0.00494892 -0.257062
+0.452452 -0.0237315 -0.213955
+0.452498 -0.0235665 -0.213878
+0.453678 -0.0190578 -0.211936
+
+
+0.412428 0.136992 -0.248066
+0.384948 0.0663104 -0.324132
+0.379068 0.0661513 -0.333314
+0.429296 -0.00494892 -0.257062
+0.451232 -0.0283119 -0.215925
+0.451278 -0.0281487 -0.21585
+0.452452 -0.0237315 -0.213955
+
+
+0.412428 0.136992 -0.248066
+0.375407 0.0661207 -0.338999
+0.369128 0.0659541 -0.348749
+0.368924 0.0745122 -0.344969
+0.368907 0.0750417 -0.344739
+0.306299 0.180405 -0.352186
+0.271666 0.266129 -0.333038
+0.271043 0.264235 -0.334648
+0.268823 0.257116 -0.340595
+
+
+0.412428 0.136992 -0.248066
+0.368924 0.0745122 -0.344969
+
+
+0.412428 0.136992 -0.248066
+0.368518 0.0901274 -0.338044
+0.368503 0.0905538 -0.337858
+0.306299 0.180405 -0.352186
+0.275125 0.277148 -0.323753
+0.274358 0.274794 -0.325761
+0.271666 0.266129 -0.333038
+
+
+0.412428 0.136992 -0.248066
+0.368155 0.102931 -0.332336
+0.368142 0.103288 -0.332181
+0.306299 0.180405 -0.352186
+0.279532 0.291238 -0.311829
+0.27854 0.288165 -0.314456
+0.275125 0.277148 -0.323753
+
+
+0.412428 0.136992 -0.248066
+0.367821 0.113808 -0.327461
+0.367808 0.114116 -0.327325
+0.306299 0.180405 -0.352186
+0.285481 0.310326 -0.295613
+0.284114 0.306052 -0.299275
+0.279532 0.291238 -0.311829
+
+
+0.412428 0.136992 -0.248066
+0.367503 0.123329 -0.323167
+0.36749 0.123603 -0.323046
+0.306299 0.180405 -0.352186
+0.297839 0.290628 -0.296047
+0.29047 0.30255 -0.295686
+0.28552 0.310453 -0.295505
+0.285481 0.310326 -0.295613
+
+
+0.412428 0.136992 -0.248066
+0.367193 0.131885 -0.319283
+0.367181 0.132134 -0.319173
+0.306299 0.180405 -0.352186
+0.307323 0.275299 -0.296441
+0.301629 0.284559 -0.296172
+0.297839 0.290628 -0.296047
+
+
+0.412428 0.136992 -0.248066
+0.366884 0.139757 -0.315687
+0.366872 0.139989 -0.315584
+0.306299 0.180405 -0.352186
+0.326746 0.243603 -0.297135
+0.323401 0.249142 -0.297002
+0.321281 0.252577 -0.29696
+
+
+0.412428 0.136992 -0.248066
+0.366571 0.147157 -0.312282
+0.366559 0.147378 -0.312184
+0.306299 0.180405 -0.352186
+0.331583 0.23561 -0.297272
+0.328609 0.240569 -0.297163
+0.326746 0.243603 -0.297135
+
+
+0.412428 0.136992 -0.248066
+0.366249 0.154259 -0.308992
+0.366236 0.154473 -0.308896
+0.306299 0.180405 -0.352186
+0.33597 0.228314 -0.297379
+0.333261 0.232861 -0.297289
+0.331583 0.23561 -0.297272
+
+
+0.412428 0.136992 -0.248066
+0.365911 0.161209 -0.30575
+0.365897 0.16142 -0.305654
+0.306299 0.180405 -0.352186
+0.340039 0.2215 -0.297462
+0.337518 0.225764 -0.297387
+0.33597 0.228314 -0.297379
+
+
+0.412428 0.136992 -0.248066
+0.365551 0.168141 -0.302493
+0.365537 0.168354 -0.302396
+0.306299 0.180405 -0.352186
+0.343893 0.215001 -0.297523
+0.341496 0.219084 -0.297462
+0.340039 0.2215 -0.297462
+
+
+0.412428 0.136992 -0.248066
+0.365162 0.175191 -0.299157
+0.365147 0.17541 -0.299056
+0.306299 0.180405 -0.352186
+0.347615 0.208679 -0.297566
+0.345292 0.212666 -0.297516
+0.343893 0.215001 -0.297523
+
+
+0.412428 0.136992 -0.248066
+0.368502 0.178909 -0.291915
+0.37022 0.179099 -0.289147
+0.38169 0.223987 -0.233544
+0.40914 0.247767 -0.15876
+0.410366 0.244489 -0.16003
+
+
+0.412428 0.136992 -0.248066
+0.374072 0.179393 -0.283021
+0.375449 0.17955 -0.280787
+0.38169 0.223987 -0.233544
+0.414583 0.232926 -0.164633
+0.415623 0.230086 -0.165719
+0.447152 0.197881 -0.106062
+
+
+0.412428 0.136992 -0.248066
+0.378603 0.179781 -0.275744
+0.37975 0.179914 -0.27387
+0.38169 0.223987 -0.233544
+0.417018 0.226168 -0.167286
+0.418005 0.22344 -0.168322
+0.447175 0.197784 -0.106143
+
+
+0.412428 0.136992 -0.248066
+0.382425 0.180101 -0.26957
+0.38341 0.180218 -0.267945
+0.38169 0.223987 -0.233544
+0.419342 0.219639 -0.169834
+0.420298 0.216966 -0.170842
+0.4472 0.197681 -0.106223
+
+
+0.412428 0.136992 -0.248066
+0.385746 0.180373 -0.264166
+0.386617 0.180478 -0.262718
+0.38169 0.223987 -0.233544
+0.421603 0.213207 -0.17233
+0.422546 0.210537 -0.173331
+0.447227 0.197573 -0.106305
+
+
+0.412428 0.136992 -0.248066
+0.38871 0.18061 -0.25931
+0.389499 0.180706 -0.257987
+0.38169 0.223987 -0.233544
+0.423846 0.206746 -0.174822
+0.424794 0.204028 -0.175836
+
+
+0.412428 0.136992 -0.248066
+0.391419 0.180821 -0.254837
+0.392149 0.18091 -0.253601
+0.38169 0.223987 -0.233544
+0.428452 0.193225 -0.179993
+0.429468 0.190237 -0.181097
+0.447334 0.197187 -0.106539
+
+
+0.412428 0.136992 -0.248066
+0.393948 0.181012 -0.250628
+0.394639 0.181096 -0.249448
+0.38169 0.223987 -0.233544
+0.430914 0.185863 -0.182785
+0.431801 0.18322 -0.183757
+0.431972 0.182893 -0.183661
+
+
+0.359267 0.0671759 0.341501
+0.353916 0.0348819 0.352033
+0.296796 -0.0582087 0.411619
+
+
+0.300392 0.0229857 0.40278
+0.302212 0.0270407 0.400728
+
+
+0.0383004 0.400136 0.299472
+0.038378 0.397404 0.303406
+-0.00934473 0.41695 0.276524
+-0.0894872 0.400401 0.29274
+-0.0923009 0.403744 0.287506
+-0.0929409 0.404538 0.286266
+
+
+0.0383004 0.400136 0.299472
+0.0840644 0.412413 0.270646
+0.0376539 0.414879 0.277831
+0.0377031 0.413041 0.280584
+-0.00934473 0.41695 0.276524
+-0.0861276 0.396358 0.299008
+-0.0888699 0.399631 0.293931
+-0.0894872 0.400401 0.29274
+
+
+0.0383004 0.400136 0.299472
+0.0382201 0.401178 0.297973
+-0.00934473 0.41695 0.276524
+-0.0827955 0.392329 0.305196
+-0.0855203 0.395597 0.300175
+-0.0861276 0.396358 0.299008
+
+
+0.261554 0.422634 -0.101017
+0.254134 0.426234 -0.100368
+0.204528 0.456279 -0.0194397
+0.185393 0.464633 0.0431088
+0.1913 0.46206 0.0394034
+0.242498 0.434148 0.0557766
+0.137976 0.483851 0.0808911
+0.136655 0.483977 0.0848519
+0.133505 0.484441 0.0846479
+0.058974 0.496872 -0.00641194
+0.0625558 0.495457 0.0295085
+0.0641021 0.495214 0.0313463
+0.0272388 0.499148 0.0225842
+0.0312454 0.492773 0.0945841
+0.0249551 0.493044 0.0954594
+0.0241193 0.493081 0.0955599
+
+
+0.0780927 0.0957418 0.493782
+0.0256701 -0.00678241 0.499695
+-0.0255201 0.0427676 0.500148
+-0.0249903 0.0399154 0.500173
+
+
+-0.251962 -0.416382 0.119605
+-0.25184 -0.416739 0.11871
+-0.208416 -0.429931 0.148736
+-0.162072 -0.445182 0.16277
+-0.166074 -0.442749 0.164691
+-0.176814 -0.420902 0.204888
+-0.0801381 -0.409475 0.29861
+-0.0706529 -0.415641 0.293785
+-0.0693332 -0.416508 0.293097
+
+
+-0.212098 0.190794 -0.434103
+-0.156562 0.0450098 -0.473141
+-0.1984 -0.104953 -0.466981
+-0.196967 -0.110545 -0.467771
+-0.194085 -0.121487 -0.469344
+-0.184431 -0.108772 -0.471947
+-0.156562 0.0450098 -0.473141
+-0.204679 -0.0809196 -0.46349
+-0.203615 -0.085105 -0.464088
+-0.1984 -0.104953 -0.466981
+
+
+-0.212098 0.190794 -0.434103
+-0.21944 0.194974 -0.430965
+-0.218047 0.196868 -0.430312
+-0.211775 0.205485 -0.427294
+-0.250076 0.305099 -0.307859
+-0.374927 0.22198 -0.278898
+-0.374969 0.220824 -0.279975
+-0.375264 0.210205 -0.289947
+
+
+-0.212098 0.190794 -0.434103
+-0.201516 0.184871 -0.438578
+-0.0533786 0.210915 -0.450628
+-0.185003 0.175544 -0.445543
+-0.193564 0.180334 -0.441953
+-0.156562 0.0450098 -0.473141
+-0.209509 -0.062349 -0.460751
+-0.208676 -0.0656545 -0.461229
+-0.204679 -0.0809196 -0.46349
+
+
+-0.00314564 0.130661 0.497422
+-0.00422821 0.131113 0.497459
+
+
+0.010394 0.124872 0.496965
+0.0113504 0.124472 0.496929
+
+
+0.0354247 0.114152 0.495981
+0.0362279 0.113815 0.495944
+
+
+-0.250075 0.355032 -0.247832
+-0.250937 0.35416 -0.248201
+-0.251847 0.352639 -0.249441
+
+
+-0.250075 0.355032 -0.247832
+-0.25325 0.354225 -0.245749
+-0.253886 0.35438 -0.244875
+-0.255061 0.351403 -0.247921
+
+
+-0.250075 0.355032 -0.247832
+-0.247849 0.35649 -0.248003
+-0.251438 0.35134 -0.251692
+
+
+-0.542778 -0.0668544 0.0354543
+-0.413046 -0.239792 0.149308
+-0.358058 -0.296632 0.197728
+-0.358734 -0.296855 0.195669
+-0.361474 -0.297638 0.187509
+
+
+-0.542778 -0.0668544 0.0354543
+-0.538303 -0.0643192 0.0529703
+-0.536382 -0.0632777 0.0604142
+-0.413046 -0.239792 0.149308
+-0.354033 -0.295432 0.209669
+-0.354841 -0.295699 0.207233
+-0.358058 -0.296632 0.197728
+
+
+-0.542778 -0.0668544 0.0354543
+-0.544866 -0.0680019 0.0272331
+-0.464303 0.153517 0.106091
+-0.515346 -0.0518225 0.139483
+-0.513642 -0.0509456 0.145667
+-0.413046 -0.239792 0.149308
+-0.349127 -0.293953 0.224115
+-0.350128 -0.294283 0.221124
+-0.354033 -0.295432 0.209669
+
+
+0.381116 -0.259467 0.203296
+0.319882 -0.304039 0.235874
+0.25419 -0.339769 0.271874
+0.253963 -0.337594 0.274922
+
+
+0.137947 0.422568 -0.237362
+0.13528 0.423951 -0.236586
+0.112594 0.380998 -0.304242
+-0.015516 0.442649 -0.264755
+-0.0128109 0.444243 -0.261803
+-0.104262 0.466121 -0.149203
+-0.166272 0.461299 -0.111167
+-0.171947 0.462715 -0.101427
+-0.164923 0.436861 -0.17987
+-0.208014 0.44602 -0.108826
+-0.211393 0.444227 -0.110001
+-0.215081 0.442243 -0.111355
+
+
+0.137947 0.422568 -0.237362
+0.181842 0.434736 -0.16834
+0.146986 0.474906 -0.0911227
+0.150831 0.473277 -0.0914369
+0.204528 0.456279 -0.0194397
+0.192391 0.461585 0.03868
+0.197287 0.459433 0.0356074
+0.242498 0.434148 0.0557766
+0.140036 0.481268 0.092026
+0.138019 0.482878 0.0877917
+0.136655 0.483977 0.0848519
+
+
+0.137947 0.422568 -0.237362
+0.142298 0.420257 -0.238702
+0.112594 0.380998 -0.304242
+-0.00632034 0.447988 -0.254824
+-0.00369489 0.449521 -0.25195
+-0.104262 0.466121 -0.149203
+-0.174485 0.463448 -0.0967343
+-0.170252 0.465881 -0.0921414
+-0.224704 0.446302 -0.0268837
+-0.245907 0.434775 -0.0228468
+-0.246576 0.434305 -0.0245991
+-0.246686 0.434211 -0.0251811
+
+
+0.161931 -0.408478 0.239245
+0.161837 -0.408564 0.239165
+0.141621 -0.397458 0.269018
+0.15911 -0.385195 0.276254
+0.159324 -0.385268 0.276029
+0.160051 -0.386084 0.274461
+
+
+0.161931 -0.408478 0.239245
+0.189744 -0.405038 0.223931
+0.190025 -0.404708 0.224294
+0.190331 -0.404383 0.224625
+0.190659 -0.404062 0.224926
+0.190955 -0.403796 0.225155
+0.204039 -0.405268 0.210136
+
+
+0.161931 -0.408478 0.239245
+0.164052 -0.406375 0.241306
+0.141621 -0.397458 0.269018
+0.158139 -0.384271 0.278096
+0.158349 -0.384355 0.27786
+0.15911 -0.385195 0.276254
+
+
+-0.241577 -0.448892 0.0303777
+-0.188258 -0.456482 -0.0811385
+-0.050885 -0.528532 0.0565772
+-0.0192555 -0.541057 0.0608116
+-0.0185714 -0.540889 0.0622723
+-0.00944802 -0.538648 0.0814953
+0.183592 -0.464325 -0.0331205
+0.197619 -0.462223 0.0898901
+0.200297 -0.461127 0.0892943
+0.208594 -0.457729 0.0873555
+
+
+-0.241577 -0.448892 0.0303777
+-0.241091 -0.44915 0.0307319
+-0.231369 -0.453521 0.032098
+-0.230464 -0.453927 0.0322151
+-0.188258 -0.456482 -0.0811385
+-0.0796979 -0.517049 0.0527249
+-0.0535499 -0.527472 0.0562355
+-0.050885 -0.528532 0.0565772
+
+
+-0.241577 -0.448892 0.0303777
+-0.247403 -0.445779 0.0262138
+-0.295876 -0.38485 0.121445
+-0.253065 -0.412549 0.129471
+-0.253469 -0.411029 0.13336
+-0.208416 -0.429931 0.148736
+-0.167619 -0.441837 0.165355
+-0.17089 -0.439833 0.166931
+-0.176814 -0.420902 0.204888
+-0.0904291 -0.402729 0.303834
+-0.0813838 -0.408651 0.299256
+-0.0801381 -0.409475 0.29861
+
+
+-0.286933 -0.37726 -0.169275
+-0.286925 -0.377297 -0.169191
+-0.225451 -0.420597 -0.150567
+-0.200762 -0.442288 -0.121082
+-0.199125 -0.442759 -0.122147
+-0.197119 -0.443302 -0.123557
+
+
+-0.286933 -0.37726 -0.169275
+-0.335423 -0.353515 -0.113662
+-0.300215 -0.414597 -0.00477292
+-0.294156 -0.419642 -0.00643367
+-0.292863 -0.420715 -0.00680336
+
+
+-0.286933 -0.37726 -0.169275
+-0.287148 -0.376048 -0.172121
+-0.289037 -0.374211 -0.172496
+-0.291254 -0.372076 -0.172882
+-0.335423 -0.353515 -0.113662
+-0.34629 -0.375361 0.00820718
+-0.340976 -0.37997 0.00672832
+-0.337276 -0.383166 0.0056508
+
+
+-0.190475 -0.431893 -0.166086
+-0.153551 -0.446874 -0.1647
+-0.0476653 -0.508399 -0.0782959
+-0.0337643 -0.514389 -0.0731235
+
+
+-0.190475 -0.431893 -0.166086
+-0.190469 -0.432114 -0.1655
+-0.190284 -0.433334 -0.162432
+-0.153551 -0.446874 -0.1647
+-0.0799252 -0.494521 -0.0900911
+-0.0719395 -0.497979 -0.0871025
+-0.0476653 -0.508399 -0.0782959
+
+
+-0.190475 -0.431893 -0.166086
+-0.190662 -0.430609 -0.169281
+-0.225451 -0.420597 -0.150567
+-0.204257 -0.441299 -0.118698
+-0.202677 -0.441761 -0.119728
+-0.200762 -0.442288 -0.121082
+
+
+-0.206644 0.0472374 0.471329
+-0.310123 -0.0280028 0.391714
+-0.23703 -0.108413 0.437811
+-0.242957 -0.116735 0.432499
+-0.243006 -0.116802 0.432455
+
+
+-0.34502 -0.317763 -0.182743
+-0.347283 -0.315406 -0.183106
+-0.335423 -0.353515 -0.113662
+-0.3554 -0.367162 0.00987233
+-0.359244 -0.363532 0.0100394
+-0.32754 -0.35453 0.132009
+-0.310306 -0.369566 0.130923
+-0.31045 -0.369708 0.130174
+-0.311095 -0.369642 0.128813
+-0.32754 -0.35453 0.132009
+-0.309479 -0.369481 0.133115
+-0.309651 -0.369614 0.132338
+-0.310306 -0.369566 0.130923
+
+
+-0.34502 -0.317763 -0.182743
+-0.290413 -0.331313 -0.237261
+-0.241073 -0.385168 -0.216042
+-0.241434 -0.385109 -0.215697
+-0.225451 -0.420597 -0.150567
+-0.207678 -0.440313 -0.116356
+-0.206123 -0.440776 -0.117373
+-0.204257 -0.441299 -0.118698
+
+
+-0.34502 -0.317763 -0.182743
+-0.341215 -0.32176 -0.182038
+-0.335423 -0.353515 -0.113662
+-0.364474 -0.358576 0.0101988
+-0.368408 -0.354831 0.0103695
+-0.32754 -0.35453 0.132009
+-0.308596 -0.369383 0.135441
+-0.308802 -0.369508 0.134618
+-0.309479 -0.369481 0.133115
+
+
+-0.37446 -0.301313 0.147519
+-0.32754 -0.35453 0.132009
+-0.307633 -0.369269 0.137963
+-0.307882 -0.369387 0.137071
+-0.308596 -0.369383 0.135441
+
+
+-0.298715 0.316838 -0.247182
+-0.302709 0.313499 -0.247169
+-0.270228 0.333024 -0.257155
+-0.270813 0.33322 -0.256266
+-0.271189 0.333264 -0.255799
+-0.2722 0.333615 -0.254235
+-0.272579 0.333914 -0.253422
+-0.273239 0.334112 -0.252435
+-0.27396 0.334802 -0.250718
+-0.274191 0.334823 -0.250435
+-0.275008 0.335774 -0.248249
+-0.273653 0.337271 -0.247719
+-0.272917 0.337653 -0.248014
+-0.271782 0.338677 -0.247872
+-0.27124 0.339016 -0.248007
+-0.270239 0.33988 -0.247928
+-0.269775 0.340186 -0.248017
+-0.268869 0.34095 -0.247961
+-0.268452 0.341231 -0.248029
+-0.267615 0.341926 -0.247984
+-0.267229 0.342189 -0.248041
+-0.266438 0.342838 -0.248001
+-0.266072 0.343088 -0.24805
+-0.26531 0.343708 -0.248012
+-0.264954 0.34395 -0.248058
+-0.264205 0.344553 -0.24802
+-0.263853 0.344792 -0.248064
+-0.263103 0.345392 -0.248024
+-0.262747 0.345631 -0.248068
+-0.261981 0.346241 -0.248025
+-0.261613 0.346485 -0.24807
+-0.260816 0.347116 -0.248021
+-0.260428 0.34737 -0.248072
+-0.259582 0.348039 -0.248013
+
+
+-0.298715 0.316838 -0.247182
+-0.276632 0.341177 -0.239008
+-0.276586 0.340258 -0.240339
+-0.270239 0.33988 -0.247928
+
+
+-0.298715 0.316838 -0.247182
+-0.291941 0.322288 -0.247477
+-0.271189 0.333264 -0.255799
+
+
+-0.27396 0.334802 -0.250718
+-0.272917 0.337653 -0.248014
+
+
+0.0140419 0.125464 -0.493422
+0.00426029 0.123376 -0.493404
+-0.0112878 0.011464 -0.500142
+-0.0366475 -0.0120709 -0.498725
+-0.0339001 -0.0136377 -0.498855
+-0.0336248 -0.0137697 -0.498868
+-0.0112878 0.011464 -0.500142
+-0.0398673 -0.0102605 -0.498559
+-0.0369374 -0.0119304 -0.49871
+-0.0366475 -0.0120709 -0.498725
+
+
+0.0140419 0.125464 -0.493422
+-0.0533786 0.210915 -0.450628
+-0.218047 0.196868 -0.430312
+
+
+0.0140419 0.125464 -0.493422
+0.0162692 0.125916 -0.493428
+-0.0112878 0.011464 -0.500142
+-0.0433735 -0.008288 -0.498363
+-0.0401789 -0.0101074 -0.498541
+-0.0398673 -0.0102605 -0.498559
+
+
+-0.289668 0.324215 -0.247441
+-0.291941 0.322288 -0.247477
+
+
+-0.289668 0.324215 -0.247441
+-0.276594 0.340208 -0.2404
+-0.276531 0.339066 -0.242049
+-0.276263 0.338458 -0.243188
+-0.271782 0.338677 -0.247872
+
+
+-0.289668 0.324215 -0.247441
+-0.285484 0.327541 -0.247661
+-0.2722 0.333615 -0.254235
+
+
+-0.280039 0.332059 -0.247667
+-0.281099 0.331089 -0.247791
+-0.273239 0.334112 -0.252435
+
+
+-0.280039 0.332059 -0.247667
+-0.276269 0.337929 -0.243906
+-0.27573 0.336972 -0.245818
+-0.273653 0.337271 -0.247719
+
+
+-0.280039 0.332059 -0.247667
+-0.277844 0.333693 -0.24791
+-0.274191 0.334823 -0.250435
+
+
+-0.113697 -0.221975 -0.466218
+-0.123902 -0.225508 -0.464692
+0.0542157 -0.290746 -0.403643
+0.216872 -0.259355 -0.396196
+0.216243 -0.256038 -0.398665
+0.214336 -0.246462 -0.405807
+0.0542157 -0.290746 -0.403643
+0.219395 -0.272287 -0.38648
+0.218764 -0.268936 -0.388993
+0.216872 -0.259355 -0.396196
+
+
+-0.113697 -0.221975 -0.466218
+-0.0433918 -0.0459736 -0.496391
+0.0708809 -0.157252 -0.489646
+0.0641975 -0.159686 -0.488947
+0.0542157 -0.290746 -0.403643
+0.221952 -0.285509 -0.376468
+0.221308 -0.282059 -0.379076
+0.219395 -0.272287 -0.38648
+
+
+-0.113697 -0.221975 -0.466218
+-0.100699 -0.217549 -0.46811
+0.0542157 -0.290746 -0.403643
+0.224596 -0.299296 -0.365949
+0.223925 -0.295672 -0.368709
+0.221952 -0.285509 -0.376468
+
+
+-0.389884 0.134882 -0.326019
+-0.383095 0.147969 -0.330806
+-0.445457 0.167217 -0.154943
+-0.495942 0.0121158 -0.156147
+-0.501649 0.00906981 -0.142345
+-0.433806 -0.126861 -0.214754
+-0.422581 -0.250841 -0.151181
+-0.419506 -0.252035 -0.156774
+-0.416077 -0.253311 -0.163049
+
+
+-0.389884 0.134882 -0.326019
+-0.296119 -0.00157042 -0.403375
+-0.300429 -0.201419 -0.389505
+-0.284519 -0.206886 -0.400901
+-0.284281 -0.206966 -0.401071
+
+
+-0.389884 0.134882 -0.326019
+-0.391423 0.131932 -0.324916
+-0.445457 0.167217 -0.154943
+-0.502436 0.00866214 -0.14043
+-0.508571 0.00535534 -0.125432
+-0.433806 -0.126861 -0.214754
+-0.429297 -0.248245 -0.138825
+-0.426105 -0.249505 -0.144678
+-0.422581 -0.250841 -0.151181
+
+
+0.172179 -0.178344 0.447306
+0.27822 -0.176201 0.376759
+0.170718 -0.153345 0.459535
+
+
+0.147162 -0.302193 0.387889
+0.142437 -0.305131 0.387035
+0.0527917 -0.222753 0.444966
+0.081251 -0.114115 0.49053
+0.0846527 -0.113609 0.49032
+0.094203 -0.112276 0.48969
+
+
+0.147162 -0.302193 0.387889
+0.179438 -0.375372 0.278026
+0.242315 -0.307528 0.32169
+0.237104 -0.304912 0.328452
+
+
+0.147162 -0.302193 0.387889
+0.153893 -0.297933 0.389146
+0.0527917 -0.222753 0.444966
+0.0691646 -0.11582 0.491269
+0.0723641 -0.115346 0.491084
+0.081251 -0.114115 0.49053
+
+
+0.249539 -0.361218 0.245256
+0.255619 -0.355255 0.249936
+0.255489 -0.355136 0.250259
+
+
+0.249539 -0.361218 0.245256
+0.202992 -0.397918 0.2248
+
+
+0.249539 -0.361218 0.245256
+0.248903 -0.361854 0.244742
+0.218928 -0.39953 0.206218
+0.218856 -0.399474 0.206397
+0.218504 -0.399022 0.207606
+0.217891 -0.398567 0.209079
+0.217574 -0.39844 0.209636
+
+
+-0.0883261 -0.260856 0.424853
+-0.0863251 -0.259653 0.425986
+-0.0213985 -0.321575 0.382795
+0.0469123 -0.291681 0.407623
+0.0487699 -0.292587 0.406907
+0.0546806 -0.295575 0.404541
+
+
+-0.0883261 -0.260856 0.424853
+-0.143539 -0.180191 0.444216
+-0.0406369 -0.179054 0.473119
+-0.0419946 -0.1855 0.470148
+-0.0426881 -0.188595 0.46871
+
+
+-0.0883261 -0.260856 0.424853
+-0.0938352 -0.264262 0.421661
+-0.0213985 -0.321575 0.382795
+0.0399073 -0.288155 0.410378
+0.041599 -0.288981 0.409733
+0.0469123 -0.291681 0.407623
+
+
+0.178248 -0.0854005 0.483896
+0.0256701 -0.00678241 0.499695
+-0.0217022 0.0237802 0.500289
+-0.021377 0.0219714 0.500295
+-0.0534567 -0.0227233 0.497018
+-0.0120625 -0.0241608 0.499735
+-0.0113875 -0.0273145 0.499626
+-0.0112096 -0.0283695 0.499586
+
+
+0.355143 0.10924 0.335571
+0.354934 0.110059 0.335563
+
+
+-0.167619 -0.441837 0.165355
+-0.166074 -0.442749 0.164691
+
+
+-0.241073 -0.385168 -0.216042
+-0.235369 -0.386176 -0.22134
+
+
+0.165966 -0.290304 0.391331
+0.158842 -0.294837 0.390025
+0.153893 -0.297933 0.389146
+
+
+0.316061 0.395899 -0.10546
+0.327021 0.39049 -0.106292
+0.204528 0.456279 -0.0194397
+0.198206 0.459029 0.0349932
+0.202402 0.457166 0.0323579
+0.242498 0.434148 0.0557766
+0.144719 0.477457 0.102028
+0.14278 0.479026 0.0979524
+0.140036 0.481268 0.092026
+
+
+0.316061 0.395899 -0.10546
+0.181842 0.434736 -0.16834
+0.156667 0.470777 -0.0919995
+0.160075 0.469321 -0.0922735
+
+
+0.316061 0.395899 -0.10546
+0.301027 0.403328 -0.104193
+
+
+0.11557 0.223208 0.432377
+0.113742 0.225157 0.431897
+0.145377 0.224646 0.422847
+0.110607 0.228341 0.43114
+0.109458 0.229425 0.430901
+0.106796 0.232203 0.430207
+
+
+0.11557 0.223208 0.432377
+0.110458 0.196023 0.446961
+0.137521 0.069805 0.48955
+0.136522 0.070234 0.489632
+0.123936 0.0757624 0.49062
+
+
+0.11557 0.223208 0.432377
+0.116411 0.222438 0.432532
+0.145377 0.224646 0.422847
+0.118752 0.220047 0.433079
+0.117999 0.220724 0.432951
+0.116411 0.222438 0.432532
+
+
+0.323778 -0.117988 0.366377
+0.322861 -0.113934 0.368828
+
+
+0.197988 -0.0381802 0.483381
+0.0256701 -0.00678241 0.499695
+-0.0203086 0.0168556 0.50031
+-0.0200383 0.0153271 0.500311
+-0.0534567 -0.0227233 0.497018
+-0.0128763 -0.0201424 0.499861
+-0.0122292 -0.0231608 0.499769
+-0.0120625 -0.0241608 0.499735
+
+
+0.404212 0.122589 0.269789
+0.402202 0.126446 0.271138
+
+
+0.208291 0.447901 -0.0965536
+0.210983 0.446668 -0.0967532
+
+
+0.208291 0.447901 -0.0965536
+0.181842 0.434736 -0.16834
+0.173221 0.463618 -0.0934847
+0.176098 0.462365 -0.0937092
+0.204528 0.456279 -0.0194397
+0.2032 0.456812 0.0318201
+0.206901 0.455152 0.0294935
+0.242498 0.434148 0.0557766
+0.14928 0.473692 0.11179
+0.147381 0.47525 0.10779
+0.144719 0.477457 0.102028
+
+
+0.208291 0.447901 -0.0965536
+0.204007 0.449872 -0.0961542
+
+
+0.387435 0.320553 0.113232
+0.383391 0.320242 0.124974
+0.270737 0.406813 0.107727
+0.254557 0.413213 0.120246
+0.254071 0.413551 0.120114
+0.253157 0.41445 0.118948
+
+
+0.387435 0.320553 0.113232
+0.434716 0.190815 0.158152
+0.48038 0.0990933 0.129865
+
+
+0.387435 0.320553 0.113232
+0.388059 0.320612 0.11138
+0.270737 0.406813 0.107727
+0.255884 0.412037 0.121455
+0.255357 0.412375 0.121414
+0.254557 0.413213 0.120246
+
+
+0.0677401 0.100226 0.494383
+0.0580517 0.104421 0.494903
+
+
+0.0677401 0.100226 0.494383
+0.0256701 -0.00678241 0.499695
+-0.019117 0.0109386 0.50031
+-0.0188853 0.00960632 0.500306
+-0.0534567 -0.0227233 0.497018
+-0.0136685 -0.0162285 0.499968
+-0.0130363 -0.0191754 0.49989
+-0.0128763 -0.0201424 0.499861
+
+
+0.0677401 0.100226 0.494383
+0.068463 0.0999215 0.494341
+
+
+0.401346 -0.0468241 0.299665
+0.401871 -0.0472151 0.298889
+
+
+0.409644 0.062451 0.280894
+0.410137 0.0632169 0.280037
+
+
+0.364217 0.197112 0.294737
+0.362049 0.185075 0.301682
+
+
+0.364217 0.197112 0.294737
+0.365243 0.195244 0.294118
+
+
+0.364217 0.197112 0.294737
+0.363937 0.19822 0.294524
+
+
+0.394746 0.0414539 0.305345
+0.395336 0.0423156 0.304405
+
+
+0.392332 0.0381452 0.309132
+0.392996 0.0391048 0.308085
+
+
+0.379119 -0.0379959 0.32935
+0.380027 -0.0375957 0.328388
+
+
+0.331964 -0.0573222 0.37766
+0.333345 -0.0567452 0.376287
+
+
+0.20676 -0.289604 0.367088
+0.179438 -0.375372 0.278026
+0.229863 -0.301297 0.33775
+0.223945 -0.298301 0.345331
+
+
+0.0256701 -0.00678241 0.499695
+-0.0180676 0.00573142 0.500292
+-0.0178633 0.00453852 0.500285
+-0.0534567 -0.0227233 0.497018
+-0.0144547 -0.0123416 0.500059
+-0.0138256 -0.015275 0.499993
+-0.0136685 -0.0162285 0.499968
+
+
+0.0256701 -0.00678241 0.499695
+-0.0171192 0.00102877 0.50026
+-0.0169345 -6.53028e-05 0.500248
+-0.0534567 -0.0227233 0.497018
+-0.0152501 -0.00840658 0.500136
+-0.0146126 -0.0113834 0.500081
+-0.0144547 -0.0123416 0.500059
+
+
+0.0256701 -0.00678241 0.499695
+-0.0162418 -0.00331851 0.500213
+-0.0160706 -0.00434427 0.500199
+-0.0534567 -0.0227233 0.497018
+-0.0478058 0.135491 0.498492
+-0.0446071 0.137526 0.498837
+-0.038878 0.109283 0.499275
+
+
+0.0256701 -0.00678241 0.499695
+-0.0154126 -0.00742486 0.500154
+-0.0152501 -0.00840658 0.500136
+
+
+0.0256701 -0.00678241 0.499695
+-0.0146126 -0.0113834 0.500081
+
+
+0.0256701 -0.00678241 0.499695
+-0.0138256 -0.015275 0.499993
+
+
+0.0256701 -0.00678241 0.499695
+-0.0130363 -0.0191754 0.49989
+
+
+0.0256701 -0.00678241 0.499695
+-0.0122292 -0.0231608 0.499769
+
+
+0.0256701 -0.00678241 0.499695
+-0.0113875 -0.0273145 0.499626
+
+
+0.0256701 -0.00678241 0.499695
+-0.0104914 -0.0317335 0.499457
+
+
+0.0256701 -0.00678241 0.499695
+-0.0095162 -0.0365393 0.499256
+
+
+0.0256701 -0.00678241 0.499695
+-0.00842929 -0.0418921 0.499013
+
+
+0.0256701 -0.00678241 0.499695
+-0.00718515 -0.048015 0.498714
+
+
+0.0256701 -0.00678241 0.499695
+-0.00571689 -0.0552364 0.49834
+
+
+0.0256701 -0.00678241 0.499695
+-0.00392044 -0.0640667 0.497858
+
+
+0.0256701 -0.00678241 0.499695
+-0.00162277 -0.0753546 0.497213
+
+
+0.0256701 -0.00678241 0.499695
+0.00148853 -0.0906325 0.496306
+
+
+0.0256701 -0.00678241 0.499695
+0.00604364 -0.112991 0.494938
+
+
+0.0256701 -0.00678241 0.499695
+0.0157923 -0.123176 0.493945
+0.024162 -0.122059 0.493586
+0.0527917 -0.222753 0.444966
+0.0576481 -0.117433 0.491929
+0.0607194 -0.116981 0.491763
+0.0691646 -0.11582 0.491269
+
+
+0.0256701 -0.00678241 0.499695
+0.0272128 -0.121618 0.493457
+0.0353636 -0.120522 0.493076
+
+
+0.0256701 -0.00678241 0.499695
+0.0494611 -0.11855 0.492376
+0.0576481 -0.117433 0.491929
+
+
+0.0256701 -0.00678241 0.499695
+0.0607194 -0.116981 0.491763
+
+
+0.0256701 -0.00678241 0.499695
+0.0723641 -0.115346 0.491084
+
+
+0.0256701 -0.00678241 0.499695
+0.0846527 -0.113609 0.49032
+
+
+0.0256701 -0.00678241 0.499695
+0.097899 -0.111724 0.489448
+
+
+0.0256701 -0.00678241 0.499695
+0.112508 -0.109633 0.488436
+
+
+0.0256701 -0.00678241 0.499695
+0.129034 -0.107252 0.487235
+
+
+0.0256701 -0.00678241 0.499695
+0.148273 -0.104466 0.485777
+
+
+0.0256701 -0.00678241 0.499695
+0.187718 -0.0709945 0.483497
+
+
+0.0256701 -0.00678241 0.499695
+0.197557 -0.0559772 0.483015
+
+
+0.0256701 -0.00678241 0.499695
+0.185041 -0.00410662 0.485143
+
+
+0.0256701 -0.00678241 0.499695
+0.179267 0.0110017 0.485837
+
+
+0.0256701 -0.00678241 0.499695
+0.173758 0.0253592 0.48644
+
+
+0.0256701 -0.00678241 0.499695
+0.168397 0.0392763 0.486968
+
+
+0.0256701 -0.00678241 0.499695
+0.163079 0.0530287 0.487434
+
+
+0.0256701 -0.00678241 0.499695
+0.151733 0.0635494 0.488382
+0.137521 0.069805 0.48955
+
+
+0.0256701 -0.00678241 0.499695
+0.136522 0.070234 0.489632
+
+
+0.0256701 -0.00678241 0.499695
+0.110786 0.0815071 0.491605
+
+
+0.255704 0.259964 0.359916
+0.253366 0.252422 0.365024
+
+
+0.255704 0.259964 0.359916
+0.260192 0.260122 0.356212
+0.303301 0.147388 0.369325
+
+
+0.255704 0.259964 0.359916
+0.255469 0.260111 0.359926
+0.219585 0.354976 0.275998
+0.180732 0.345218 0.315392
+0.180315 0.345951 0.314795
+0.178579 0.349184 0.312094
+
+
+0.30479 -0.193696 0.346632
+0.27822 -0.176201 0.376759
+0.171485 -0.166335 0.453208
+
+
+0.362399 0.0694405 0.337907
+0.359929 0.0677221 0.340731
+
+
+0.362399 0.0694405 0.337907
+0.353916 0.0348819 0.352033
+0.305618 -0.0623347 0.403404
+
+
+0.362399 0.0694405 0.337907
+0.363227 0.0701063 0.336941
+
+
+0.124633 0.214002 0.434404
+0.145377 0.224646 0.422847
+0.120861 0.217887 0.433563
+0.120168 0.218497 0.433455
+0.118752 0.220047 0.433079
+
+
+0.124633 0.214002 0.434404
+0.12401 0.214533 0.434323
+0.122803 0.21589 0.434
+0.145377 0.224646 0.422847
+0.126391 0.212181 0.434785
+0.125784 0.212693 0.434712
+0.124633 0.214002 0.434404
+
+
+0.0885741 0.09119 0.493129
+0.089316 0.0908756 0.49308
+
+
+0.294697 0.131575 0.381898
+0.294672 0.12964 0.382575
+
+
+0.294697 0.131575 0.381898
+0.298327 0.128326 0.380192
+
+
+0.294697 0.131575 0.381898
+0.294606 0.131795 0.381892
+0.294576 0.133703 0.381259
+0.294675 0.134053 0.381061
+0.300107 0.128321 0.378809
+
+
+-0.403799 0.302686 0.124509
+-0.464303 0.153517 0.106091
+-0.509797 -0.0488965 0.15953
+-0.508061 -0.0480142 0.165726
+-0.413046 -0.239792 0.149308
+-0.349937 -0.28681 0.233003
+-0.348317 -0.289622 0.232706
+-0.34632 -0.293116 0.232299
+-0.349127 -0.293953 0.224115
+
+
+-0.403799 0.302686 0.124509
+-0.407456 0.288069 0.132197
+-0.409164 0.2813 0.135693
+-0.464303 0.153517 0.106091
+-0.504108 -0.0459336 0.179748
+-0.502307 -0.0450286 0.186074
+-0.413046 -0.239792 0.149308
+-0.356208 -0.275785 0.234238
+-0.354777 -0.278283 0.233981
+-0.349937 -0.28681 0.233003
+
+
+-0.403799 0.302686 0.124509
+-0.402009 0.309719 0.12086
+-0.401059 0.309481 0.122599
+-0.377121 0.208972 0.25399
+-0.441835 0.0794264 0.253093
+-0.438746 0.0811577 0.256472
+-0.361072 0.00364482 0.34643
+-0.350702 -0.0576197 0.354271
+-0.351407 -0.060063 0.353431
+-0.353942 -0.0683107 0.350441
+
+
+-0.375724 0.116193 0.323286
+-0.373622 0.117303 0.325447
+-0.361072 0.00364482 0.34643
+-0.348197 -0.049403 0.357198
+-0.34875 -0.0513231 0.356547
+-0.350702 -0.0576197 0.354271
+
+
+-0.375724 0.116193 0.323286
+-0.377121 0.208972 0.25399
+-0.431297 0.0854121 0.26456
+-0.428577 0.0869257 0.267516
+-0.361072 0.00364482 0.34643
+-0.346165 -0.0427767 0.359543
+-0.346617 -0.0443529 0.359017
+-0.348197 -0.049403 0.357198
+
+
+-0.375724 0.116193 0.323286
+-0.381065 0.113279 0.317801
+-0.361072 0.00364482 0.34643
+-0.34445 -0.0372228 0.361496
+-0.344833 -0.0385637 0.361055
+-0.346165 -0.0427767 0.359543
+
+
+0.130945 0.255706 0.409572
+0.128433 0.254513 0.411089
+0.105038 0.280323 0.400982
+0.0670778 0.241524 0.434861
+0.062975 0.24166 0.435693
+0.0581082 0.24191 0.436623
+
+
+0.130945 0.255706 0.409572
+0.145377 0.224646 0.422847
+0.128113 0.210388 0.43515
+0.127513 0.210894 0.435082
+0.126391 0.212181 0.434785
+
+
+0.130945 0.255706 0.409572
+0.131292 0.255899 0.409344
+0.105038 0.280323 0.400982
+0.0746236 0.241188 0.433357
+0.0711405 0.241304 0.434076
+0.0670778 0.241524 0.434861
+
+
+0.134669 0.203388 0.436524
+0.13341 0.204825 0.436228
+0.145377 0.224646 0.422847
+0.129834 0.208588 0.435508
+0.129231 0.2091 0.435441
+0.128113 0.210388 0.43515
+
+
+0.134669 0.203388 0.436524
+0.110458 0.196023 0.446961
+0.152876 0.0630567 0.488285
+0.151733 0.0635494 0.488382
+
+
+0.134669 0.203388 0.436524
+0.135344 0.202777 0.436605
+0.145377 0.224646 0.422847
+0.131587 0.206747 0.435865
+0.130972 0.207277 0.435797
+0.129834 0.208588 0.435508
+
+
+0.308203 0.0844558 0.384842
+0.309382 0.0854716 0.383618
+
+
+0.134198 0.388308 0.287513
+0.134713 0.388369 0.287233
+0.127516 0.351781 0.332251
+0.0193853 0.349319 0.369476
+0.026189 0.347155 0.36953
+0.105038 0.280323 0.400982
+0.0811748 0.240886 0.432033
+0.0781275 0.240989 0.432673
+0.0746236 0.241188 0.433357
+
+
+0.134198 0.388308 0.287513
+0.0840644 0.412413 0.270646
+0.0377719 0.412279 0.281714
+0.0378227 0.410372 0.284546
+-0.00934473 0.41695 0.276524
+-0.0794267 0.388238 0.311421
+-0.0821862 0.391562 0.306361
+-0.0827955 0.392329 0.305196
+
+
+0.134198 0.388308 0.287513
+0.129095 0.387585 0.290422
+0.127516 0.351781 0.332251
+0.0395091 0.343028 0.369521
+0.0443519 0.341473 0.369558
+0.105038 0.280323 0.400982
+0.08702 0.240607 0.430833
+0.0842827 0.240701 0.431418
+0.0811748 0.240886 0.432033
+
+
+-0.0528384 0.288033 0.428942
+-0.178942 0.188749 0.427498
+-0.175705 0.0540562 0.481535
+-0.166676 0.0598485 0.482952
+-0.0534567 -0.0227233 0.497018
+-0.0626716 0.126126 0.496835
+-0.058512 0.12878 0.497299
+-0.0478058 0.135491 0.498492
+
+
+0.216743 0.161676 0.427259
+0.220844 0.16658 0.42325
+0.221836 0.16773 0.422289
+
+
+0.217741 -0.392299 0.220742
+0.221027 -0.389121 0.223254
+0.217115 -0.398083 0.210762
+
+
+0.217741 -0.392299 0.220742
+0.208852 -0.396985 0.22091
+0.208914 -0.396994 0.220834
+0.210179 -0.399562 0.214901
+
+
+0.217741 -0.392299 0.220742
+0.21767 -0.392384 0.220659
+0.216082 -0.397712 0.212486
+
+
+0.332227 -0.158441 0.341634
+0.331582 -0.155352 0.343593
+
+
+0.327759 -0.136588 0.355143
+0.327057 -0.133395 0.357115
+
+
+0.242315 -0.307528 0.32169
+0.243125 -0.307916 0.320654
+
+
+0.383953 -0.220549 0.247627
+0.376595 -0.225901 0.251384
+0.30802 -0.229117 0.320982
+0.269212 -0.300494 0.30208
+0.274143 -0.297301 0.299896
+
+
+0.183378 -0.392506 0.24997
+0.185024 -0.391738 0.249951
+0.193022 -0.40217 0.22628
+0.19346 -0.401892 0.226394
+0.204952 -0.404438 0.210845
+
+
+0.183378 -0.392506 0.24997
+0.179438 -0.375372 0.278026
+0.222966 -0.297823 0.346563
+
+
+0.183378 -0.392506 0.24997
+0.182078 -0.393169 0.249889
+0.192565 -0.402482 0.226122
+0.193022 -0.40217 0.22628
+
+
+0.385409 -0.0353298 0.322652
+0.386092 -0.0350437 0.321918
+
+
+0.427357 -0.252951 0.0587885
+0.427578 -0.252828 0.0576693
+
+
+0.388208 0.0377601 0.314376
+0.353916 0.0348819 0.352033
+0.38789 -0.00759267 0.318456
+0.38804 -0.00552022 0.318161
+
+
+0.389556 0.0223554 0.314416
+0.353916 0.0348819 0.352033
+0.388319 -0.000556727 0.317537
+
+
+0.421676 0.0801908 0.259695
+0.419357 0.0767897 0.263838
+
+
+0.421676 0.0801908 0.259695
+0.420272 0.0202432 0.270855
+0.467608 -0.00481254 0.19226
+
+
+0.421676 0.0801908 0.259695
+0.422593 0.0816187 0.258032
+
+
+0.326207 0.101812 0.36503
+0.316863 0.111076 0.370609
+0.316241 0.110571 0.371298
+0.315769 0.11028 0.371792
+0.30998 0.128258 0.370867
+
+
+0.402565 0.05233 0.29278
+0.403024 0.0530272 0.292016
+
+
+0.418595 0.0756011 0.265211
+0.420272 0.0202432 0.270855
+0.467916 0.00444342 0.191159
+
+
+0.382216 0.0458931 0.319984
+0.353916 0.0348819 0.352033
+0.389009 0.0115997 0.315909
+0.389114 0.0131759 0.315668
+
+
+0.305694 0.0574308 0.392376
+0.305935 0.0602892 0.391635
+
+
+0.379723 0.0492488 0.322284
+0.353916 0.0348819 0.352033
+0.385003 0.0421206 0.317388
+0.383857 0.0437366 0.318448
+
+
+0.38789 -0.00759267 0.318456
+0.387557 -0.0132346 0.319156
+
+
+0.375294 0.0551613 0.326311
+0.353916 0.0348819 0.352033
+0.377438 0.0523083 0.324372
+
+
+0.0888308 0.381334 0.312649
+0.0892512 0.381396 0.312435
+0.127516 0.351781 0.332251
+0.0541712 0.338421 0.36953
+0.0578529 0.337228 0.369557
+0.105038 0.280323 0.400982
+0.0923637 0.240342 0.429718
+0.089846 0.240431 0.430266
+0.08702 0.240607 0.430833
+
+
+0.0888308 0.381334 0.312649
+0.0840644 0.412413 0.270646
+0.0378927 0.409574 0.28572
+0.0379466 0.407556 0.288693
+-0.00934473 0.41695 0.276524
+-0.0759546 0.384002 0.317809
+-0.0788035 0.38745 0.312607
+-0.0794267 0.388238 0.311421
+
+
+0.0888308 0.381334 0.312649
+0.084212 0.380531 0.315138
+0.127516 0.351781 0.332251
+0.0655184 0.334836 0.369516
+0.0684606 0.333872 0.369535
+0.105038 0.280323 0.400982
+0.110397 0.245646 0.421787
+0.10996 0.245405 0.422055
+
+
+0.0655184 0.334836 0.369516
+0.0578529 0.337228 0.369557
+
+
+0.354795 0.146133 0.324033
+0.355891 0.151995 0.320718
+
+
+0.324329 0.12797 0.3584
+0.324004 0.128072 0.358654
+0.320471 0.130246 0.361022
+
+
+0.324329 0.12797 0.3584
+0.321199 0.125764 0.361963
+
+
+0.324329 0.12797 0.3584
+0.328789 0.127928 0.354432
+0.319991 0.132232 0.36073
+
+
+0.357325 0.099743 0.335878
+0.357158 0.100397 0.335878
+
+
+0.349135 0.0598947 0.352914
+0.34948 0.0602371 0.352517
+
+
+0.353916 0.0348819 0.352033
+0.37324 0.0578781 0.328149
+
+
+0.353916 0.0348819 0.352033
+0.371232 0.0605175 0.329925
+
+
+0.353916 0.0348819 0.352033
+0.367198 0.0657722 0.333437
+0.36638 0.0668903 0.334129
+
+
+0.353916 0.0348819 0.352033
+0.356682 0.0653111 0.344449
+
+
+0.353916 0.0348819 0.352033
+0.354473 0.0637201 0.346953
+
+
+0.353916 0.0348819 0.352033
+0.352526 0.0623217 0.349143
+
+
+0.391363 -0.318261 -0.035262
+0.391873 -0.318016 -0.0399099
+
+
+0.456129 0.177766 -0.101726
+0.455842 0.178821 -0.101157
+0.453798 0.183462 -0.10213
+0.452233 0.186416 -0.103928
+0.451902 0.187088 -0.104224
+0.451157 0.188496 -0.105059
+0.450359 0.190091 -0.105797
+
+
+0.456129 0.177766 -0.101726
+0.458544 0.175454 -0.0948467
+0.459708 0.173663 -0.0927109
+0.460608 0.172409 -0.0908173
+0.460803 0.172162 -0.0903606
+0.455589 0.18217 -0.0961973
+
+
+0.456129 0.177766 -0.101726
+0.456086 0.177156 -0.102986
+0.452233 0.186416 -0.103928
+
+
+0.492198 0.0584238 -0.122452
+0.489955 0.0612041 -0.129421
+0.488733 0.0626703 -0.133209
+
+
+0.433745 -0.234492 0.0856527
+0.433577 -0.234601 0.0862842
+
+
+0.417018 0.226168 -0.167286
+0.415623 0.230086 -0.165719
+
+
+0.396914 0.0444423 0.301911
+0.397451 0.0452347 0.301047
+
+
+0.457705 0.161468 -0.121945
+0.457449 0.163876 -0.119149
+0.44887 0.193295 -0.106738
+
+
+0.457705 0.161468 -0.121945
+0.462286 0.17031 -0.086791
+
+
+0.457705 0.161468 -0.121945
+0.457966 0.158197 -0.126088
+
+
+0.406534 -0.273106 0.105279
+0.407883 -0.270361 0.107504
+0.418174 -0.264847 0.0709164
+
+
+0.406534 -0.273106 0.105279
+0.375883 -0.302347 0.133038
+0.402133 -0.280955 0.100423
+0.400213 -0.283352 0.100746
+
+
+0.406534 -0.273106 0.105279
+0.406017 -0.27418 0.104354
+0.417385 -0.266058 0.0709865
+
+
+0.347884 0.261715 0.281581
+0.347634 0.262673 0.281388
+0.345481 0.262622 0.283283
+0.339211 0.262522 0.288747
+0.219585 0.354976 0.275998
+0.182999 0.341011 0.318863
+0.182557 0.341796 0.318229
+0.180732 0.345218 0.315392
+
+
+0.396467 -0.299929 0.0546129
+0.396203 -0.300512 0.0533906
+
+
+0.401671 -0.28817 0.0763326
+0.401392 -0.288894 0.0749111
+
+
+0.397782 -0.297134 0.0598682
+0.39755 -0.297674 0.0587362
+
+
+0.423477 -0.273255 -0.0593658
+0.424672 -0.271409 -0.0589251
+
+
+0.434529 -0.256006 -0.0554421
+0.435701 -0.254163 -0.0550021
+
+
+0.411717 -0.291289 -0.0634693
+0.413033 -0.289291 -0.062993
+
+
+0.45809 -0.218229 -0.0468528
+0.459521 -0.215899 -0.0463005
+
+
+0.389892 -0.318883 -0.0212261
+0.390298 -0.318695 -0.0248343
+
+
+0.440064 -0.247251 -0.0534511
+0.441259 -0.245356 -0.052999
+
+
+0.282187 -0.415566 0.039998
+0.280939 -0.416398 0.0426316
+
+
+0.375671 -0.243185 -0.232892
+0.375737 -0.243075 -0.232885
+0.35942 -0.186625 -0.293763
+
+
+0.375671 -0.243185 -0.232892
+0.415805 -0.23012 -0.156689
+0.329239 -0.370403 -0.159353
+0.322385 -0.372994 -0.172881
+0.246306 -0.434405 -0.0320329
+0.21562 -0.451571 -0.00893837
+
+
+0.375671 -0.243185 -0.232892
+0.3706 -0.251519 -0.233526
+0.359268 -0.186817 -0.293824
+
+
+0.496934 0.0525425 -0.107484
+0.499195 0.0496564 -0.10025
+
+
+0.380126 -0.0723563 -0.329289
+0.382952 -0.075612 -0.324681
+0.429296 -0.00494892 -0.257062
+0.449994 -0.0328883 -0.217886
+0.450041 -0.0327237 -0.21781
+0.451232 -0.0283119 -0.215925
+
+
+0.380126 -0.0723563 -0.329289
+0.340984 -0.171129 -0.323579
+
+
+0.380126 -0.0723563 -0.329289
+0.377794 -0.0696007 -0.333094
+0.429296 -0.00494892 -0.257062
+0.448714 -0.0375497 -0.219875
+0.448764 -0.0373803 -0.219797
+0.449994 -0.0328883 -0.217886
+
+
+0.413209 -0.179067 -0.227424
+0.413272 -0.178954 -0.227415
+
+
+0.413209 -0.179067 -0.227424
+0.415805 -0.23012 -0.156689
+0.321054 -0.373482 -0.175531
+0.313401 -0.376316 -0.19054
+
+
+0.413209 -0.179067 -0.227424
+0.408803 -0.186834 -0.228146
+0.36032 -0.185045 -0.293669
+0.360407 -0.184832 -0.293693
+
+
+0.380339 -0.235457 -0.232292
+0.3804 -0.235355 -0.232285
+0.359561 -0.186433 -0.293715
+
+
+0.380339 -0.235457 -0.232292
+0.415805 -0.23012 -0.156689
+0.30138 -0.380659 -0.214045
+0.291041 -0.384344 -0.234096
+0.246306 -0.434405 -0.0320329
+0.215597 -0.451352 -0.0136303
+
+
+0.380339 -0.235457 -0.232292
+0.375737 -0.243075 -0.232885
+
+
+0.308485 -0.351164 -0.240474
+0.308782 -0.35069 -0.240445
+0.358047 -0.18797 -0.294534
+0.358297 -0.187778 -0.294363
+0.358525 -0.187585 -0.294217
+
+
+0.308485 -0.351164 -0.240474
+0.415805 -0.23012 -0.156689
+0.288943 -0.385073 -0.238192
+0.28656 -0.385908 -0.242791
+0.283941 -0.387152 -0.245103
+0.275058 -0.391384 -0.252861
+0.246306 -0.434405 -0.0320329
+0.21557 -0.451141 -0.017842
+
+
+0.308485 -0.351164 -0.240474
+0.28656 -0.385908 -0.242791
+
+
+0.389807 -0.083694 -0.313354
+0.39234 -0.0866406 -0.309144
+0.429296 -0.00494892 -0.257062
+0.447366 -0.0423918 -0.221932
+0.447419 -0.0422141 -0.221851
+0.448714 -0.0375497 -0.219875
+
+
+0.389807 -0.083694 -0.313354
+0.341766 -0.17074 -0.322925
+0.341785 -0.170733 -0.322908
+0.342262 -0.170511 -0.322497
+0.342834 -0.170292 -0.321978
+0.343492 -0.170095 -0.321349
+
+
+0.389807 -0.083694 -0.313354
+0.387763 -0.0812477 -0.316759
+
+
+0.457713 -0.00320875 -0.205027
+0.467061 -0.0515947 -0.172025
+0.478267 -0.0437941 -0.139883
+0.477861 -0.045602 -0.140568
+0.479066 -0.0747935 -0.1237
+0.465551 -0.0912069 -0.159404
+0.464611 -0.0942933 -0.160732
+0.463698 -0.097434 -0.161932
+
+
+0.466299 0.0673736 -0.188379
+0.469074 0.0673482 -0.183426
+
+
+0.392733 -0.214627 -0.230597
+0.392786 -0.214536 -0.230591
+
+
+0.392733 -0.214627 -0.230597
+0.415805 -0.23012 -0.156689
+0.326713 -0.32218 -0.238518
+0.326919 -0.321849 -0.238498
+0.358297 -0.187778 -0.294363
+
+
+0.392733 -0.214627 -0.230597
+0.388825 -0.221247 -0.23115
+0.359816 -0.186047 -0.293653
+
+
+-0.0182909 -0.338463 -0.374472
+-0.0113336 -0.339239 -0.373208
+0.0542157 -0.290746 -0.403643
+0.227387 -0.31397 -0.35467
+0.226673 -0.310084 -0.357653
+0.224596 -0.299296 -0.365949
+
+
+-0.0182909 -0.338463 -0.374472
+0.0259521 -0.389689 -0.312841
+0.215157 -0.386301 -0.289181
+0.152818 -0.395212 -0.287159
+0.0339636 -0.431711 -0.250744
+0.19459 -0.440811 -0.19987
+0.190126 -0.442922 -0.197083
+0.183592 -0.464325 -0.0331205
+0.18641 -0.466761 0.0924658
+0.189164 -0.465646 0.0918556
+0.197619 -0.462223 0.0898901
+
+
+-0.0182909 -0.338463 -0.374472
+-0.022752 -0.337914 -0.375321
+0.0542157 -0.290746 -0.403643
+0.230399 -0.329935 -0.342312
+0.22962 -0.325671 -0.345608
+0.227387 -0.31397 -0.35467
+
+
+0.33059 -0.214005 -0.308917
+0.333849 -0.208046 -0.309096
+0.338367 -0.18163 -0.320428
+
+
+0.33059 -0.214005 -0.308917
+0.354467 -0.189578 -0.297639
+0.354528 -0.189559 -0.297582
+0.347694 -0.182818 -0.30934
+
+
+0.33059 -0.214005 -0.308917
+0.329431 -0.215993 -0.308934
+0.338047 -0.180859 -0.321238
+
+
+0.356197 -0.16605 -0.309135
+0.35727 -0.163697 -0.309177
+0.347522 -0.169787 -0.31698
+
+
+0.356197 -0.16605 -0.309135
+0.357438 -0.174594 -0.302995
+0.356086 -0.173272 -0.305288
+
+
+0.356197 -0.16605 -0.309135
+0.355814 -0.166609 -0.30927
+
+
+0.341785 -0.170733 -0.322908
+0.350227 -0.177747 -0.309438
+
+
+-0.126137 0.494623 0.0518998
+-0.224704 0.446302 -0.0268837
+-0.245157 0.435305 -0.0206134
+-0.245811 0.434857 -0.0222902
+-0.245907 0.434775 -0.0228468
+
+
+0.204493 0.331059 -0.32575
+0.198312 0.245013 -0.388641
+0.114213 0.310705 -0.384647
+0.111762 0.310139 -0.38617
+0.103435 0.30811 -0.391414
+0.198312 0.245013 -0.388641
+0.123789 0.312989 -0.3786
+0.121589 0.312487 -0.379974
+0.114213 0.310705 -0.384647
+
+
+0.204493 0.331059 -0.32575
+0.202148 0.330584 -0.327314
+0.19506 0.329057 -0.332104
+0.198312 0.245013 -0.388641
+0.13251 0.315047 -0.373059
+0.130488 0.314592 -0.374329
+0.123789 0.312989 -0.3786
+
+
+0.204493 0.331059 -0.32575
+0.212423 0.332747 -0.320361
+0.112594 0.380998 -0.304242
+0.00266621 0.453155 -0.245091
+0.00526384 0.454657 -0.24224
+-0.104262 0.466121 -0.149203
+-0.16904 0.466566 -0.0908677
+-0.164817 0.468964 -0.0862908
+-0.224704 0.446302 -0.0268837
+-0.244422 0.435814 -0.018433
+-0.24507 0.435379 -0.0200712
+-0.245157 0.435305 -0.0206134
+
+
+0.423526 -0.160671 -0.22567
+0.423605 -0.160528 -0.225658
+0.360565 -0.184382 -0.293776
+
+
+0.423526 -0.160671 -0.22567
+0.415805 -0.23012 -0.156689
+0.339837 -0.301227 -0.237082
+0.339991 -0.300978 -0.237067
+
+
+0.423526 -0.160671 -0.22567
+0.418148 -0.170291 -0.226596
+
+
+0.40456 -0.194261 -0.22882
+0.404615 -0.194163 -0.228813
+0.360229 -0.185251 -0.293652
+
+
+0.40456 -0.194261 -0.22882
+0.415805 -0.23012 -0.156689
+0.370526 -0.251641 -0.233533
+0.3706 -0.251519 -0.233526
+
+
+0.40456 -0.194261 -0.22882
+0.400604 -0.201125 -0.229434
+
+
+0.388771 -0.22134 -0.231156
+0.388825 -0.221247 -0.23115
+
+
+0.388771 -0.22134 -0.231156
+0.415805 -0.23012 -0.156689
+0.38467 -0.228234 -0.231717
+0.384726 -0.228138 -0.231711
+0.359693 -0.186241 -0.293679
+
+
+0.388771 -0.22134 -0.231156
+0.384726 -0.228138 -0.231711
+
+
+0.370526 -0.251641 -0.233533
+0.3648 -0.260988 -0.234229
+
+
+0.339837 -0.301227 -0.237082
+0.326919 -0.321849 -0.238498
+
+
+0.058582 -0.346529 -0.359338
+0.0631018 -0.346911 -0.358396
+0.0542157 -0.290746 -0.403643
+0.233728 -0.347726 -0.328447
+0.232858 -0.342931 -0.332179
+0.230399 -0.329935 -0.342312
+
+
+0.058582 -0.346529 -0.359338
+0.0259521 -0.389689 -0.312841
+0.15212 -0.395308 -0.287142
+0.120108 -0.399854 -0.286081
+0.0339636 -0.431711 -0.250744
+0.179479 -0.4479 -0.190542
+0.17553 -0.449751 -0.188072
+0.183592 -0.464325 -0.0331205
+0.174735 -0.471433 0.0951348
+0.177625 -0.470277 0.0944972
+0.18641 -0.466761 0.0924658
+
+
+0.058582 -0.346529 -0.359338
+0.0559906 -0.34627 -0.35991
+0.0542157 -0.290746 -0.403643
+0.214691 -0.358462 -0.323826
+0.235443 -0.359995 -0.318927
+0.236039 -0.360037 -0.318788
+0.233728 -0.347726 -0.328447
+
+
+0.326713 -0.32218 -0.238518
+0.308782 -0.35069 -0.240445
+
+
+0.38467 -0.228234 -0.231717
+0.3804 -0.235355 -0.232285
+
+
+0.408745 -0.186938 -0.228154
+0.408803 -0.186834 -0.228146
+
+
+0.408745 -0.186938 -0.228154
+0.415805 -0.23012 -0.156689
+0.435458 -0.14374 -0.217679
+0.438 -0.143873 -0.211127
+0.467061 -0.0515947 -0.172025
+0.477397 -0.0474491 -0.141422
+0.477039 -0.0490361 -0.142011
+0.479066 -0.0747935 -0.1237
+0.467018 -0.0862299 -0.157379
+0.466262 -0.0887187 -0.158466
+0.465551 -0.0912069 -0.159404
+
+
+0.408745 -0.186938 -0.228154
+0.404615 -0.194163 -0.228813
+
+
+0.429794 -0.149382 -0.224567
+0.423605 -0.160528 -0.225658
+
+
+0.484312 0.106166 0.110155
+0.434716 0.190815 0.158152
+0.482339 0.102586 0.120149
+
+
+0.493421 0.0569347 -0.118607
+0.463223 0.169869 -0.0831133
+
+
+0.457336 -0.155456 -0.145136
+0.45633 -0.154003 -0.149891
+
+
+0.265941 0.2481 -0.348128
+0.198312 0.245013 -0.388641
+0.140632 0.316944 -0.367865
+0.138732 0.316522 -0.369065
+0.13251 0.315047 -0.373059
+
+
+0.428711 -0.123281 -0.242159
+0.429907 -0.128752 -0.237253
+0.467061 -0.0515947 -0.172025
+0.476618 -0.05067 -0.142777
+0.476294 -0.0521004 -0.143295
+0.479066 -0.0747935 -0.1237
+0.468226 -0.0820887 -0.155691
+0.467595 -0.084173 -0.156615
+0.467018 -0.0862299 -0.157379
+
+
+0.428711 -0.123281 -0.242159
+0.360801 -0.183355 -0.294106
+
+
+0.428711 -0.123281 -0.242159
+0.428226 -0.120979 -0.244179
+0.467061 -0.0515947 -0.172025
+0.475903 -0.0535821 -0.143999
+0.475602 -0.0549021 -0.144466
+
+
+0.43958 -0.144004 -0.206991
+0.441887 -0.144118 -0.200986
+0.467061 -0.0515947 -0.172025
+0.474585 -0.0588244 -0.146192
+0.474306 -0.0600214 -0.146599
+
+
+0.43958 -0.144004 -0.206991
+0.415805 -0.23012 -0.156689
+0.443336 -0.144237 -0.197153
+0.445475 -0.144336 -0.191525
+0.467061 -0.0515947 -0.172025
+0.473317 -0.0637019 -0.14822
+0.473036 -0.064873 -0.148612
+0.479066 -0.0747935 -0.1237
+0.469252 -0.0785259 -0.154234
+0.46871 -0.0803277 -0.155047
+0.468226 -0.0820887 -0.155691
+
+
+0.43958 -0.144004 -0.206991
+0.438 -0.143873 -0.211127
+
+
+0.472 -0.0686127 -0.150248
+0.471691 -0.0698459 -0.150667
+0.479066 -0.0747935 -0.1237
+0.47015 -0.0753715 -0.152941
+0.469671 -0.0769726 -0.153677
+0.469252 -0.0785259 -0.154234
+
+
+0.472 -0.0686127 -0.150248
+0.467061 -0.0515947 -0.172025
+0.472671 -0.0661293 -0.149224
+0.47238 -0.0673198 -0.149624
+0.479066 -0.0747935 -0.1237
+0.470955 -0.0725072 -0.151764
+0.47052 -0.0739653 -0.152446
+0.47015 -0.0753715 -0.152941
+
+
+0.472 -0.0686127 -0.150248
+0.47238 -0.0673198 -0.149624
+
+
+0.415805 -0.23012 -0.156689
+0.446831 -0.144445 -0.187895
+0.448855 -0.144532 -0.182511
+0.467061 -0.0515947 -0.172025
+0.471289 -0.0712043 -0.151314
+0.470955 -0.0725072 -0.151764
+
+
+0.415805 -0.23012 -0.156689
+0.449895 -0.145269 -0.178838
+0.450754 -0.146374 -0.175113
+
+
+0.415805 -0.23012 -0.156689
+0.451947 -0.148028 -0.169781
+
+
+0.415805 -0.23012 -0.156689
+0.453841 -0.150605 -0.161274
+
+
+0.088214 0.435728 0.230379
+0.0842298 0.435632 0.231874
+0.0566727 0.45453 0.201473
+-0.0139467 0.454129 0.215107
+-0.015031 0.454539 0.214389
+-0.0221378 0.457315 0.209495
+
+
+0.088214 0.435728 0.230379
+0.0840644 0.412413 0.270646
+0.0380188 0.406703 0.289938
+0.0380779 0.404521 0.293126
+-0.00934473 0.41695 0.276524
+-0.0723039 0.379529 0.324493
+-0.0753042 0.383177 0.319039
+-0.0759546 0.384002 0.317809
+
+
+0.088214 0.435728 0.230379
+0.0887676 0.435752 0.230151
+0.0566727 0.45453 0.201473
+-0.00708351 0.451437 0.219796
+-0.00800716 0.451788 0.21919
+-0.0139467 0.454129 0.215107
+
+
+0.149376 0.187783 0.439142
+0.145377 0.224646 0.422847
+0.137443 0.200549 0.437004
+0.136713 0.201226 0.436913
+0.135344 0.202777 0.436605
+
+
+0.149376 0.187783 0.439142
+0.148049 0.189125 0.438951
+0.145563 0.191875 0.438478
+0.145377 0.224646 0.422847
+0.154233 0.18256 0.439974
+0.152528 0.18431 0.439722
+0.149376 0.187783 0.439142
+
+
+0.035126 0.315114 -0.405963
+0.0450472 0.308922 -0.409993
+0.112594 0.380998 -0.304242
+0.0116178 0.458252 -0.235369
+0.0142373 0.459752 -0.232485
+-0.104262 0.466121 -0.149203
+-0.163597 0.469645 -0.0850093
+-0.159303 0.472054 -0.0803605
+-0.224704 0.446302 -0.0268837
+-0.243688 0.436312 -0.0162622
+-0.244339 0.435883 -0.0178961
+-0.244422 0.435814 -0.018433
+
+
+0.035126 0.315114 -0.405963
+-0.0533786 0.210915 -0.450628
+-0.20724 0.211622 -0.425155
+-0.201684 0.219226 -0.422458
+-0.250076 0.305099 -0.307859
+-0.374566 0.233061 -0.268445
+-0.374611 0.231963 -0.269473
+-0.374927 0.22198 -0.278898
+
+
+0.035126 0.315114 -0.405963
+0.0336869 0.316024 -0.405364
+0.112594 0.380998 -0.304242
+0.020706 0.463376 -0.225471
+0.0233988 0.464902 -0.222498
+-0.104262 0.466121 -0.149203
+-0.158051 0.472745 -0.079046
+-0.153599 0.475212 -0.0742317
+-0.224704 0.446302 -0.0268837
+-0.24294 0.436808 -0.0140581
+-0.243601 0.436381 -0.0157221
+-0.243688 0.436312 -0.0162622
+
+
+-0.0817992 0.0438597 -0.494699
+-0.0112878 0.011464 -0.500142
+-0.0472847 -0.00608664 -0.498129
+-0.0437162 -0.00811716 -0.498342
+-0.0433735 -0.008288 -0.498363
+
+
+-0.0817992 0.0438597 -0.494699
+-0.0829664 0.0390332 -0.494812
+-0.0835533 0.0364067 -0.494877
+-0.0112878 0.011464 -0.500142
+-0.0517665 -0.00356295 -0.497845
+-0.0476711 -0.00589105 -0.498105
+-0.0472847 -0.00608664 -0.498129
+
+
+-0.0817992 0.0438597 -0.494699
+-0.0811898 0.0465746 -0.494622
+-0.156562 0.0450098 -0.473141
+-0.213401 -0.0473116 -0.458495
+-0.212721 -0.0500348 -0.458894
+-0.209509 -0.062349 -0.460751
+
+
+0.396337 0.137669 0.274944
+0.393769 0.142489 0.276596
+
+
+0.0193853 0.349319 0.369476
+0.0163559 0.350256 0.369472
+0.0209059 0.354689 0.363397
+0.0233209 0.356976 0.360241
+
+
+-0.0640818 0.369391 0.339447
+-0.00934473 0.41695 0.276524
+-0.0683847 0.374707 0.331637
+-0.0716111 0.378648 0.325797
+-0.0723039 0.379529 0.324493
+
+
+-0.0640818 0.369391 0.339447
+-0.0676302 0.373745 0.333048
+-0.0683847 0.374707 0.331637
+
+
+-0.0640818 0.369391 0.339447
+-0.0632404 0.368316 0.341011
+-0.156068 0.355593 0.31559
+-0.256061 0.306907 0.313954
+-0.262579 0.296972 0.321255
+-0.272468 0.359184 0.217136
+-0.347022 0.295667 0.219635
+-0.347797 0.295859 0.2183
+-0.352072 0.297012 0.210776
+-0.272468 0.359184 0.217136
+-0.342215 0.294372 0.228007
+-0.342959 0.294558 0.226735
+-0.347022 0.295667 0.219635
+
+
+0.0395091 0.343028 0.369521
+0.026189 0.347155 0.36953
+
+
+0.190557 0.326755 0.330471
+0.188125 0.331399 0.326706
+0.219585 0.354976 0.275998
+0.185438 0.336453 0.322596
+0.184959 0.337311 0.321907
+0.182999 0.341011 0.318863
+
+
+0.190557 0.326755 0.330471
+0.127516 0.351781 0.332251
+0.0747171 0.331912 0.369485
+0.0771637 0.331101 0.369499
+0.105038 0.280323 0.400982
+0.113824 0.247346 0.419792
+0.113428 0.247125 0.420038
+0.110397 0.245646 0.421787
+
+
+0.190557 0.326755 0.330471
+0.191161 0.325651 0.331348
+0.219585 0.354976 0.275998
+0.194694 0.318922 0.336748
+0.193985 0.320232 0.335713
+0.191161 0.325651 0.331348
+
+
+0.156667 0.470777 -0.0919995
+0.150831 0.473277 -0.0914369
+
+
+0.165017 0.411764 0.2401
+0.165764 0.413209 0.23754
+0.219585 0.354976 0.275998
+0.19895 0.310776 0.343248
+0.198086 0.312385 0.341981
+0.194694 0.318922 0.336748
+
+
+0.165017 0.411764 0.2401
+0.0840644 0.412413 0.270646
+0.0381534 0.40359 0.294476
+0.0382201 0.401178 0.297973
+
+
+0.165017 0.411764 0.2401
+0.163462 0.408542 0.245725
+0.219585 0.354976 0.275998
+0.211403 0.287219 0.361719
+
+
+0.140733 0.309859 0.36815
+0.142508 0.309206 0.368103
+0.105038 0.280323 0.400982
+0.116983 0.248907 0.417939
+0.116615 0.248701 0.41817
+0.113824 0.247346 0.419792
+
+
+0.140733 0.309859 0.36815
+0.127516 0.351781 0.332251
+0.0824585 0.329433 0.369442
+0.0845615 0.328729 0.369451
+0.105038 0.280323 0.400982
+0.11996 0.250373 0.416179
+0.119611 0.250177 0.416401
+0.116983 0.248907 0.417939
+
+
+0.140733 0.309859 0.36815
+0.13676 0.311227 0.368325
+0.105038 0.280323 0.400982
+0.122821 0.251776 0.414474
+0.122483 0.251586 0.414691
+0.11996 0.250373 0.416179
+
+
+0.150522 0.460936 0.149623
+0.0451587 0.471195 0.162285
+-0.0465209 0.463533 0.197894
+-0.0583912 0.465827 0.193346
+-0.0606226 0.466268 0.192463
+
+
+0.310078 0.145919 0.364224
+0.310033 0.128264 0.37082
+
+
+0.230998 0.437298 -0.09848
+0.234282 0.435748 -0.0987217
+0.204528 0.456279 -0.0194397
+0.207614 0.454833 0.02901
+0.210962 0.453315 0.0269027
+0.242498 0.434148 0.0557766
+0.168773 0.463868 0.110412
+0.154328 0.470952 0.112737
+0.150013 0.473075 0.11338
+0.14928 0.473692 0.11179
+
+
+0.230998 0.437298 -0.09848
+0.181842 0.434736 -0.16834
+0.180617 0.46037 -0.0941415
+0.183348 0.459169 -0.0943516
+
+
+0.230998 0.437298 -0.09848
+0.225933 0.439696 -0.0980215
+0.204528 0.456279 -0.0194397
+0.211613 0.45302 0.0264576
+0.214713 0.451598 0.0245044
+0.242498 0.434148 0.0557766
+0.184429 0.456145 0.107955
+0.174527 0.461021 0.109566
+0.168773 0.463868 0.110412
+
+
+0.180617 0.46037 -0.0941415
+0.176098 0.462365 -0.0937092
+
+
+0.401026 0.181514 -0.238657
+0.399359 0.181433 -0.241479
+
+
+0.469608 0.101178 -0.1641
+0.469159 0.102432 -0.164209
+
+
+0.319493 -0.266855 0.279469
+0.30802 -0.229117 0.320982
+0.277729 -0.294918 0.298356
+
+
+0.334615 0.366615 -0.159347
+0.181842 0.434736 -0.16834
+0.194556 0.454155 -0.0953656
+
+
+0.397026 0.181269 -0.245435
+0.398703 0.181355 -0.242619
+
+
+-0.39249 0.281783 -0.167201
+-0.310534 0.370612 -0.128901
+-0.432076 0.302277 -0.00349481
+-0.427412 0.309498 0.00626404
+-0.464303 0.153517 0.106091
+-0.495938 -0.0299536 0.194316
+-0.500057 -0.0402908 0.189684
+-0.50186 -0.0447962 0.187634
+-0.490355 -0.0576867 0.200539
+-0.488987 -0.0592274 0.202061
+-0.413046 -0.239792 0.149308
+-0.361826 -0.265835 0.235331
+-0.360532 -0.268111 0.235103
+-0.356208 -0.275785 0.234238
+
+
+-0.39249 0.281783 -0.167201
+-0.390104 0.281117 -0.174625
+-0.388556 0.280727 -0.179332
+-0.310534 0.370612 -0.128901
+-0.425376 0.312627 0.0104509
+-0.421128 0.319115 0.0192563
+-0.420684 0.319437 0.0208041
+-0.464303 0.153517 0.106091
+-0.487456 -0.00889462 0.203806
+-0.491 -0.0177164 0.199869
+-0.495938 -0.0299536 0.194316
+
+
+-0.39249 0.281783 -0.167201
+-0.393971 0.282149 -0.16265
+-0.445457 0.167217 -0.154943
+-0.509427 0.00490699 -0.123327
+-0.51618 0.00123238 -0.106644
+-0.433806 -0.126861 -0.214754
+-0.436376 -0.245461 -0.125696
+-0.432994 -0.246818 -0.13195
+-0.429297 -0.248245 -0.138825
+
+
+-0.241129 0.435755 0.117892
+-0.234559 0.439707 0.119334
+-0.272468 0.359184 0.217136
+-0.337546 0.293099 0.236079
+-0.338275 0.293283 0.234842
+-0.342215 0.294372 0.228007
+
+
+-0.241129 0.435755 0.117892
+-0.263681 0.425199 -0.00886505
+-0.379921 0.346507 -0.00926602
+-0.382851 0.344563 -0.00727078
+-0.310534 0.370612 -0.128901
+-0.408135 0.327772 0.0102308
+-0.421128 0.319115 0.0192563
+
+
+-0.241129 0.435755 0.117892
+-0.246091 0.432744 0.116851
+-0.272468 0.359184 0.217136
+-0.332921 0.291824 0.244015
+-0.333648 0.29201 0.242789
+-0.337546 0.293099 0.236079
+
+
+0.306198 0.357189 -0.215979
+0.181842 0.434736 -0.16834
+0.222926 0.441102 -0.0978001
+0.225933 0.439696 -0.0980215
+
+
+0.328609 0.240569 -0.297163
+0.38169 0.223987 -0.233544
+0.364185 0.180006 -0.297524
+0.362659 0.182649 -0.297565
+0.306299 0.180405 -0.352186
+0.351281 0.202406 -0.297591
+0.348985 0.206376 -0.297552
+0.347615 0.208679 -0.297566
+
+
+0.378603 0.179781 -0.275744
+0.375449 0.17955 -0.280787
+
+
+0.292425 0.352435 -0.242827
+0.285824 0.350106 -0.255576
+0.38169 0.223987 -0.233544
+0.360168 0.187047 -0.297558
+0.358726 0.189526 -0.297591
+0.306299 0.180405 -0.352186
+0.35496 0.196064 -0.2976
+0.352648 0.200092 -0.297572
+0.351281 0.202406 -0.297591
+
+
+0.292425 0.352435 -0.242827
+0.181842 0.434736 -0.16834
+0.239881 0.433073 -0.0992228
+0.243556 0.431323 -0.0994938
+0.204528 0.456279 -0.0194397
+0.215321 0.45132 0.0240857
+0.218251 0.44996 0.0222358
+0.242498 0.434148 0.0557766
+0.195871 0.450472 0.106151
+0.188545 0.454096 0.107356
+0.184429 0.456145 0.107955
+
+
+0.292425 0.352435 -0.242827
+0.293046 0.352643 -0.241639
+
+
+0.0741793 0.252657 -0.44023
+0.0759365 0.245984 -0.443575
+0.198312 0.245013 -0.388641
+0.148355 0.318727 -0.362893
+0.146534 0.318328 -0.364051
+0.140632 0.316944 -0.367865
+
+
+0.0741793 0.252657 -0.44023
+-0.0533786 0.210915 -0.450628
+-0.197612 0.22471 -0.420523
+-0.192564 0.23159 -0.418051
+-0.250076 0.305099 -0.307859
+-0.344899 0.266011 -0.262284
+-0.35544 0.259328 -0.259533
+
+
+0.0741793 0.252657 -0.44023
+0.0729456 0.257517 -0.437774
+0.198312 0.245013 -0.388641
+0.155847 0.320436 -0.358039
+0.154067 0.320051 -0.359177
+0.148355 0.318727 -0.362893
+
+
+0.339326 0.0313679 -0.390859
+0.342941 0.027757 -0.389348
+0.345227 0.0310853 -0.385856
+0.306299 0.180405 -0.352186
+0.366185 0.0616545 -0.353384
+0.368528 0.0650587 -0.349704
+0.369128 0.0659541 -0.348749
+
+
+0.339326 0.0313679 -0.390859
+0.197417 0.0278293 -0.458969
+0.19191 0.0640714 -0.457543
+0.193033 0.064333 -0.457036
+0.182225 0.0994352 -0.45531
+0.130247 0.192216 -0.451178
+0.127602 0.192913 -0.451998
+0.116345 0.195741 -0.455522
+0.182225 0.0994352 -0.45531
+0.141996 0.18922 -0.44747
+0.139731 0.189822 -0.448178
+0.130247 0.192216 -0.451178
+
+
+0.339326 0.0313679 -0.390859
+0.332167 0.0386002 -0.393813
+0.306299 0.180405 -0.352186
+0.359993 0.0525717 -0.363077
+0.362558 0.0562811 -0.359087
+0.366185 0.0616545 -0.353384
+
+
+0.38871 0.18061 -0.25931
+0.386617 0.180478 -0.262718
+
+
+0.427701 0.183059 -0.191204
+0.431801 0.18322 -0.183757
+
+
+0.468426 0.0228577 0.188925
+0.420272 0.0202432 0.270855
+0.468187 0.0136081 0.190054
+
+
+0.465118 0.113538 -0.165285
+0.46552 0.112425 -0.16519
+
+
+0.392149 0.18091 -0.253601
+0.393948 0.181012 -0.250628
+
+
+0.368502 0.178909 -0.291915
+0.36496 0.178628 -0.297522
+0.364185 0.180006 -0.297524
+
+
+0.253692 0.210268 -0.378887
+0.252379 0.206242 -0.382053
+0.306299 0.180405 -0.352186
+0.353099 0.0425131 -0.373765
+0.355973 0.0466519 -0.369334
+0.359993 0.0525717 -0.363077
+
+
+0.253692 0.210268 -0.378887
+0.198312 0.245013 -0.388641
+0.163256 0.322106 -0.353205
+0.161483 0.321728 -0.354347
+0.155847 0.320436 -0.358039
+
+
+0.253692 0.210268 -0.378887
+0.254031 0.211228 -0.378111
+0.306299 0.180405 -0.352186
+0.319619 0.0511612 -0.398969
+0.325648 0.0450865 -0.39651
+0.332167 0.0386002 -0.393813
+
+
+0.300137 -0.111309 -0.392742
+0.305944 -0.103083 -0.390958
+0.223301 -0.0667773 -0.442807
+0.239705 -0.00967802 -0.440462
+0.235081 -0.0112926 -0.442671
+0.234063 -0.0116812 -0.443155
+0.223301 -0.0667773 -0.442807
+0.246108 -0.00739968 -0.437378
+0.240849 -0.00924327 -0.439914
+0.239705 -0.00967802 -0.440462
+
+
+0.300137 -0.111309 -0.392742
+0.33863 -0.173309 -0.324971
+
+
+0.300137 -0.111309 -0.392742
+0.300077 -0.111393 -0.392761
+0.223301 -0.0667773 -0.442807
+0.253596 -0.00473079 -0.433743
+0.24743 -0.00689994 -0.43674
+0.246108 -0.00739968 -0.437378
+
+
+0.0238071 0.322158 -0.401313
+0.0336869 0.316024 -0.405364
+
+
+0.0238071 0.322158 -0.401313
+-0.0533786 0.210915 -0.450628
+-0.188819 0.236609 -0.416258
+-0.184127 0.242976 -0.413939
+-0.250076 0.305099 -0.307859
+-0.319579 0.282203 -0.268703
+-0.325179 0.278676 -0.267229
+-0.344899 0.266011 -0.262284
+
+
+0.0238071 0.322158 -0.401313
+0.0223603 0.323068 -0.400706
+0.112594 0.380998 -0.304242
+0.0301128 0.468627 -0.215197
+0.0329363 0.470211 -0.212073
+-0.104262 0.466121 -0.149203
+-0.152288 0.475926 -0.0728563
+-0.147578 0.478504 -0.0677696
+-0.224704 0.446302 -0.0268837
+-0.242162 0.437313 -0.0117759
+-0.242843 0.436881 -0.0135059
+-0.24294 0.436808 -0.0140581
+
+
+0.277462 0.347142 -0.271581
+0.27469 0.346142 -0.276862
+0.273683 0.346719 -0.276583
+0.112594 0.380998 -0.304242
+0.0426568 0.470768 -0.207913
+0.0380805 0.473038 -0.206462
+0.0387463 0.475263 -0.200196
+0.0388171 0.475518 -0.199473
+-0.104262 0.466121 -0.149203
+-0.146178 0.479259 -0.0663005
+-0.141089 0.482011 -0.0608111
+-0.224704 0.446302 -0.0268837
+-0.241336 0.437837 -0.00936458
+-0.24205 0.437392 -0.0112013
+-0.242162 0.437313 -0.0117759
+
+
+0.277462 0.347142 -0.271581
+0.181842 0.434736 -0.16834
+0.249908 0.428264 -0.100056
+0.254134 0.426234 -0.100368
+
+
+0.277462 0.347142 -0.271581
+0.278162 0.347383 -0.27026
+0.38169 0.223987 -0.233544
+0.356351 0.193693 -0.297574
+0.35496 0.196064 -0.2976
+
+
+0.299387 0.354853 -0.229305
+0.181842 0.434736 -0.16834
+0.275543 0.415823 -0.102164
+
+
+0.385746 0.180373 -0.264166
+0.38341 0.180218 -0.267945
+
+
+0.374072 0.179393 -0.283021
+0.37022 0.179099 -0.289147
+
+
+-0.324116 -0.339393 -0.179014
+-0.325809 -0.337682 -0.179289
+
+
+-0.324116 -0.339393 -0.179014
+-0.290413 -0.331313 -0.237261
+-0.246695 -0.384157 -0.210788
+-0.247031 -0.3841 -0.210465
+-0.225451 -0.420597 -0.150567
+-0.211092 -0.439313 -0.11401
+-0.209532 -0.439785 -0.115034
+-0.207678 -0.440313 -0.116356
+
+
+-0.324116 -0.339393 -0.179014
+-0.321148 -0.342428 -0.178444
+-0.335423 -0.353515 -0.113662
+-0.373813 -0.349668 0.010535
+-0.377919 -0.34573 0.0107125
+-0.32754 -0.35453 0.132009
+-0.306559 -0.369132 0.140761
+-0.306859 -0.369249 0.13977
+-0.307633 -0.369269 0.137963
+
+
+0.1631 -0.388801 0.268781
+0.179438 -0.375372 0.278026
+0.21536 -0.293973 0.356225
+
+
+-0.379417 -0.281241 -0.188714
+-0.384195 -0.276142 -0.189488
+
+
+-0.379417 -0.281241 -0.188714
+-0.290413 -0.331313 -0.237261
+-0.251988 -0.383181 -0.205816
+-0.252308 -0.383125 -0.205507
+-0.225451 -0.420597 -0.150567
+-0.214565 -0.438279 -0.111615
+-0.21297 -0.438769 -0.112667
+-0.211092 -0.439313 -0.11401
+
+
+-0.379417 -0.281241 -0.188714
+-0.371923 -0.28928 -0.187381
+-0.335423 -0.353515 -0.113662
+-0.383618 -0.340244 0.0108881
+-0.387994 -0.336015 0.0110763
+-0.32754 -0.35453 0.132009
+-0.30533 -0.368966 0.143948
+-0.305695 -0.369086 0.142815
+-0.306559 -0.369132 0.140761
+
+
+0.168174 0.273453 0.385994
+0.105038 0.280323 0.400982
+0.125628 0.253147 0.412788
+0.125293 0.25296 0.413005
+0.122821 0.251776 0.414474
+
+
+0.168174 0.273453 0.385994
+0.167086 0.272912 0.386713
+0.160273 0.269723 0.391077
+0.105038 0.280323 0.400982
+0.134264 0.257334 0.407516
+0.1339 0.257134 0.407756
+0.131292 0.255899 0.409344
+
+
+0.168174 0.273453 0.385994
+0.177303 0.277722 0.380117
+0.145377 0.224646 0.422847
+0.160776 0.17551 0.441076
+0.158445 0.177934 0.440725
+0.154233 0.18256 0.439974
+
+
+-0.144391 0.46477 0.187659
+-0.149602 0.457785 0.193545
+-0.272468 0.359184 0.217136
+-0.328251 0.290522 0.251968
+-0.328991 0.290713 0.25073
+-0.332921 0.291824 0.244015
+
+
+-0.144391 0.46477 0.187659
+-0.140294 0.460042 0.19557
+-0.00934473 0.41695 0.276524
+-0.0592403 0.363387 0.348198
+-0.0632404 0.368316 0.341011
+
+
+-0.144391 0.46477 0.187659
+-0.143365 0.47227 0.175823
+-0.00934473 0.41695 0.276524
+-0.0536399 0.356417 0.358282
+-0.058277 0.362155 0.349978
+-0.0592403 0.363387 0.348198
+
+
+0.0372928 0.422563 0.266157
+0.0373469 0.420715 0.268996
+-0.00934473 0.41695 0.276524
+-0.0469509 0.348065 0.370283
+-0.0525033 0.354963 0.360369
+-0.0536399 0.356417 0.358282
+
+
+0.0372928 0.422563 0.266157
+0.0840644 0.412413 0.270646
+0.0384652 0.396208 0.305115
+0.0385584 0.393025 0.309667
+-0.00934473 0.41695 0.276524
+-0.0386492 0.33767 0.385129
+-0.0455617 0.346288 0.372819
+-0.0469509 0.348065 0.370283
+
+
+0.0372928 0.422563 0.266157
+0.0372211 0.42333 0.26498
+-0.00934473 0.41695 0.276524
+-0.0258393 0.334152 0.390557
+-0.0136153 0.338846 0.384505
+0.105038 0.280323 0.400982
+0.137418 0.258851 0.405561
+0.137027 0.258639 0.405819
+0.134264 0.257334 0.407516
+
+
+0.067989 0.2764 -0.428158
+0.0698688 0.269324 -0.431775
+0.198312 0.245013 -0.388641
+0.170724 0.32377 -0.3483
+0.168924 0.32339 -0.349468
+0.163256 0.322106 -0.353205
+
+
+0.067989 0.2764 -0.428158
+-0.0533786 0.210915 -0.450628
+-0.180607 0.24767 -0.412239
+-0.176151 0.253688 -0.410018
+-0.250076 0.305099 -0.307859
+-0.304594 0.291761 -0.272485
+-0.308117 0.28956 -0.271549
+-0.319579 0.282203 -0.268703
+
+
+0.067989 0.2764 -0.428158
+0.0666408 0.281654 -0.425449
+0.198312 0.245013 -0.388641
+0.178399 0.325458 -0.343226
+0.176536 0.32507 -0.344443
+0.170724 0.32377 -0.3483
+
+
+0.169807 0.365 0.298679
+0.127516 0.351781 0.332251
+0.0891816 0.327265 0.369387
+0.0910413 0.326635 0.369392
+0.105038 0.280323 0.400982
+0.140839 0.260491 0.403425
+0.140409 0.260261 0.403709
+0.137418 0.258851 0.405561
+
+
+0.313341 0.344508 0.206377
+0.300812 0.352175 0.207265
+0.245333 0.413089 0.139891
+0.171393 0.426954 0.213577
+0.169552 0.428791 0.211358
+0.165877 0.432505 0.206803
+
+
+0.313341 0.344508 0.206377
+0.219585 0.354976 0.275998
+0.221099 0.281309 0.361374
+0.228439 0.276791 0.36111
+0.145377 0.224646 0.422847
+0.170293 0.165239 0.442657
+0.166823 0.168889 0.442126
+0.160776 0.17551 0.441076
+
+
+0.313341 0.344508 0.206377
+0.314707 0.343679 0.206265
+0.245333 0.413089 0.139891
+0.182229 0.42071 0.214095
+0.181253 0.421235 0.214149
+0.172157 0.426174 0.214525
+0.171393 0.426954 0.213577
+
+
+-0.0251116 0.437026 -0.275089
+-0.0322798 0.432811 -0.282757
+
+
+-0.233466 0.341027 0.288447
+-0.272468 0.359184 0.217136
+-0.323445 0.289167 0.260093
+-0.324213 0.289368 0.258817
+-0.328251 0.290522 0.251968
+
+
+-0.233466 0.341027 0.288447
+-0.234259 0.339822 0.289375
+-0.237841 0.334502 0.293381
+-0.272468 0.359184 0.217136
+-0.318401 0.28773 0.268558
+-0.319214 0.287946 0.267217
+-0.323445 0.289167 0.260093
+
+
+-0.233466 0.341027 0.288447
+-0.230164 0.345896 0.284754
+-0.156068 0.355593 0.31559
+-0.264285 0.294322 0.32322
+-0.272602 0.281579 0.332541
+-0.272468 0.359184 0.217136
+-0.312998 0.286175 0.277562
+-0.313876 0.286412 0.276123
+-0.318401 0.28773 0.268558
+
+
+-0.37653 0.260856 -0.233904
+-0.377917 0.266514 -0.224081
+-0.445457 0.167217 -0.154943
+-0.517134 0.00072693 -0.104274
+-0.524766 -0.0034637 -0.0852293
+-0.433806 -0.126861 -0.214754
+-0.444 -0.242413 -0.111444
+-0.440337 -0.243906 -0.118273
+-0.436376 -0.245461 -0.125696
+
+
+-0.37653 0.260856 -0.233904
+-0.27611 0.343914 -0.235761
+-0.276341 0.343064 -0.236696
+-0.276441 0.342369 -0.23756
+-0.268869 0.34095 -0.247961
+
+
+-0.37653 0.260856 -0.233904
+-0.376235 0.259591 -0.236063
+-0.445457 0.167217 -0.154943
+-0.525859 -0.00404957 -0.0824868
+-0.534751 -0.00897247 -0.060092
+-0.433806 -0.126861 -0.214754
+-0.452408 -0.238999 -0.0956088
+-0.448343 -0.240679 -0.103245
+-0.444 -0.242413 -0.111444
+
+
+-0.124928 0.321166 -0.384015
+-0.119554 0.328176 -0.381179
+-0.250076 0.305099 -0.307859
+-0.294523 0.298163 -0.275012
+-0.296984 0.29664 -0.274352
+-0.304594 0.291761 -0.272485
+
+
+-0.124928 0.321166 -0.384015
+-0.0533786 0.210915 -0.450628
+-0.172774 0.258169 -0.408373
+-0.168458 0.26397 -0.406202
+-0.250076 0.305099 -0.307859
+-0.287164 0.302822 -0.276846
+-0.289011 0.301692 -0.276345
+-0.294523 0.298163 -0.275012
+
+
+-0.124928 0.321166 -0.384015
+-0.128884 0.316066 -0.386045
+-0.250076 0.305099 -0.307859
+-0.281453 0.306423 -0.278258
+-0.282916 0.305538 -0.277857
+-0.287164 0.302822 -0.276846
+
+
+-0.369133 0.161627 -0.341029
+-0.365235 0.161988 -0.343989
+-0.250076 0.305099 -0.307859
+-0.276809 0.309335 -0.279396
+-0.278018 0.308613 -0.279061
+-0.281453 0.306423 -0.278258
+
+
+-0.369133 0.161627 -0.341029
+-0.296119 -0.00157042 -0.403375
+-0.315852 -0.196074 -0.378366
+-0.300653 -0.201343 -0.389343
+-0.300429 -0.201419 -0.389505
+
+
+-0.369133 0.161627 -0.341029
+-0.376268 0.161012 -0.33557
+-0.381443 0.151112 -0.331972
+-0.296119 -0.00157042 -0.403375
+-0.330708 -0.189941 -0.367596
+-0.338301 -0.17428 -0.362691
+-0.433806 -0.126861 -0.214754
+-0.461926 -0.235076 -0.0775534
+-0.457291 -0.237017 -0.0863233
+-0.452408 -0.238999 -0.0956088
+
+
+0.181842 0.434736 -0.16834
+0.348473 0.379843 -0.10808
+0.359341 0.374454 -0.108912
+
+
+0.181842 0.434736 -0.16834
+0.342797 0.369242 -0.14276
+
+
+0.181842 0.434736 -0.16834
+0.285172 0.349885 -0.256816
+0.278162 0.347383 -0.27026
+
+
+0.181842 0.434736 -0.16834
+0.257772 0.355888 -0.272041
+0.2496 0.360545 -0.269775
+0.112594 0.380998 -0.304242
+0.0627471 0.460797 -0.214204
+0.0508431 0.466736 -0.210434
+0.0426568 0.470768 -0.207913
+
+
+0.181842 0.434736 -0.16834
+0.237734 0.367357 -0.266368
+0.231451 0.370916 -0.264625
+0.112594 0.380998 -0.304242
+0.0784515 0.452958 -0.219105
+0.0690557 0.457676 -0.216135
+0.0627471 0.460797 -0.214204
+
+
+0.181842 0.434736 -0.16834
+0.222101 0.376258 -0.261925
+0.217033 0.37911 -0.260517
+0.112594 0.380998 -0.304242
+0.0912822 0.446513 -0.223093
+0.0835472 0.450424 -0.220653
+0.0784515 0.452958 -0.219105
+
+
+0.181842 0.434736 -0.16834
+0.209343 0.383481 -0.258282
+0.205093 0.385856 -0.257099
+0.112594 0.380998 -0.304242
+0.102149 0.441018 -0.226455
+0.095557 0.444376 -0.224383
+0.0912822 0.446513 -0.223093
+
+
+0.181842 0.434736 -0.16834
+0.198541 0.389559 -0.255182
+0.194861 0.3916 -0.254155
+0.112594 0.380998 -0.304242
+0.111637 0.436184 -0.229378
+0.105851 0.439155 -0.227564
+0.102149 0.441018 -0.226455
+
+
+0.181842 0.434736 -0.16834
+0.189109 0.39483 -0.252461
+0.185832 0.396633 -0.251544
+0.112594 0.380998 -0.304242
+0.120143 0.431817 -0.231984
+0.114931 0.434515 -0.230357
+0.111637 0.436184 -0.229378
+
+
+0.181842 0.434736 -0.16834
+0.180648 0.399524 -0.250007
+0.177657 0.401156 -0.249166
+
+
+0.181842 0.434736 -0.16834
+0.16557 0.407792 -0.245595
+0.16291 0.40922 -0.24484
+0.112594 0.380998 -0.304242
+0.127952 0.427775 -0.234365
+0.123147 0.430284 -0.232871
+0.120143 0.431817 -0.231984
+
+
+0.181842 0.434736 -0.16834
+0.158567 0.411586 -0.243526
+0.155981 0.412962 -0.242789
+0.112594 0.380998 -0.304242
+0.149154 0.416617 -0.240756
+0.144888 0.418902 -0.23945
+0.142298 0.420257 -0.238702
+
+
+0.181842 0.434736 -0.16834
+0.151718 0.415265 -0.241491
+0.149154 0.416617 -0.240756
+
+
+0.181842 0.434736 -0.16834
+0.144888 0.418902 -0.23945
+
+
+0.181842 0.434736 -0.16834
+0.130754 0.426334 -0.235186
+0.127952 0.427775 -0.234365
+
+
+0.181842 0.434736 -0.16834
+0.123147 0.430284 -0.232871
+
+
+0.181842 0.434736 -0.16834
+0.114931 0.434515 -0.230357
+
+
+0.181842 0.434736 -0.16834
+0.105851 0.439155 -0.227564
+
+
+0.181842 0.434736 -0.16834
+0.095557 0.444376 -0.224383
+
+
+0.181842 0.434736 -0.16834
+0.0835472 0.450424 -0.220653
+
+
+0.181842 0.434736 -0.16834
+0.0690557 0.457676 -0.216135
+
+
+0.181842 0.434736 -0.16834
+0.0508431 0.466736 -0.210434
+
+
+0.181842 0.434736 -0.16834
+0.0387463 0.475263 -0.200196
+
+
+0.181842 0.434736 -0.16834
+0.0402282 0.480195 -0.18613
+0.0402966 0.480441 -0.185427
+-0.104262 0.466121 -0.149203
+-0.13956 0.482826 -0.0592068
+-0.133934 0.485834 -0.0531457
+-0.224704 0.446302 -0.0268837
+-0.240439 0.438395 -0.00676215
+-0.241203 0.437926 -0.00875471
+-0.241336 0.437837 -0.00936458
+
+
+0.495887 0.128374 0.047522
+0.496542 0.125386 0.0445698
+0.496937 0.123556 0.0427933
+0.49032 -0.00243348 0.0999044
+0.495215 -0.100877 0.0515174
+0.494837 -0.10108 0.0534866
+0.493129 -0.101895 0.0624238
+
+
+0.495887 0.128374 0.047522
+0.495541 0.129309 0.0474115
+0.434716 0.190815 0.158152
+0.486338 0.109909 0.09967
+
+
+0.495887 0.128374 0.047522
+0.494336 0.125248 0.0562989
+0.49032 -0.00243348 0.0999044
+0.49742 -0.099771 0.0397534
+0.497017 -0.0999919 0.0418967
+0.495215 -0.100877 0.0515174
+
+
+0.412087 -0.275802 0.0642279
+0.411562 -0.275794 0.067499
+
+
+0.43755 -0.0756514 0.243749
+0.436662 -0.0749538 0.245158
+
+
+0.440114 -0.166331 0.204651
+0.442633 -0.160958 0.203628
+
+
+0.200107 0.288457 0.36531
+0.194273 0.28573 0.369096
+0.105038 0.280323 0.400982
+0.144639 0.262305 0.401036
+0.144154 0.26205 0.401356
+0.140839 0.260491 0.403425
+
+
+0.200107 0.288457 0.36531
+0.207666 0.287728 0.362859
+0.145377 0.224646 0.422847
+0.1858 0.14848 0.445204
+0.179922 0.154722 0.444292
+0.170293 0.165239 0.442657
+
+
+0.200107 0.288457 0.36531
+0.199717 0.288602 0.365328
+0.127516 0.351781 0.332251
+0.0951816 0.325315 0.369322
+0.096868 0.324737 0.369324
+0.105038 0.280323 0.400982
+0.148972 0.264368 0.398294
+0.148411 0.264077 0.398665
+0.144639 0.262305 0.401036
+
+
+0.441405 -0.229709 0.0524882
+0.442147 -0.229191 0.0489464
+0.427942 -0.252724 0.0552944
+
+
+0.441405 -0.229709 0.0524882
+0.452817 -0.199577 0.0743398
+0.434785 -0.233908 0.0814063
+0.435588 -0.233463 0.0780336
+0.425719 -0.254531 0.0637286
+
+
+0.441405 -0.229709 0.0524882
+0.441274 -0.229817 0.0530422
+
+
+0.440576 -0.23029 0.056323
+0.452817 -0.199577 0.0743398
+0.435728 -0.233366 0.0775029
+0.43647 -0.232944 0.0743379
+0.426093 -0.254133 0.0628136
+
+
+0.448903 -0.22392 0.0157335
+0.450933 -0.222274 0.00533494
+0.427835 -0.254485 0.047117
+
+
+0.448903 -0.22392 0.0157335
+0.452817 -0.199577 0.0743398
+0.436601 -0.232849 0.073835
+0.4373 -0.232441 0.0708028
+0.42646 -0.253741 0.0618809
+
+
+0.448903 -0.22392 0.0157335
+0.448598 -0.224183 0.0172014
+
+
+0.423146 -0.226179 0.158594
+0.423558 -0.220537 0.169043
+
+
+0.396429 -0.288014 0.101503
+0.397979 -0.286086 0.101256
+
+
+0.414972 -0.26992 0.0704268
+0.414912 -0.272862 0.0587949
+
+
+0.402871 -0.284658 0.0837307
+0.402853 -0.28497 0.0826433
+
+
+0.403469 -0.279309 0.100124
+0.402133 -0.280955 0.100423
+
+
+0.398404 -0.295771 0.0624077
+0.398179 -0.296308 0.061287
+
+
+0.39902 -0.294397 0.0649554
+0.398796 -0.294942 0.0638252
+
+
+0.390399 -0.311889 0.0316215
+0.389699 -0.31324 0.0288776
+
+
+0.388692 -0.319362 -0.0100045
+0.389032 -0.319211 -0.0129362
+
+
+0.463911 -0.207342 -0.0469221
+0.465428 -0.204092 -0.0475692
+
+
+0.469031 -0.196311 -0.0492008
+0.470605 -0.192904 -0.0498774
+
+
+0.427256 -0.255932 0.0443269
+0.421531 -0.265121 0.0455624
+
+
+0.475822 -0.181197 -0.0510834
+0.452817 -0.199577 0.0743398
+0.437426 -0.232348 0.0703164
+0.438098 -0.231944 0.0673534
+0.426788 -0.253424 0.0608932
+
+
+0.423608 -0.21993 0.170138
+0.424079 -0.213004 0.182917
+
+
+0.45628 0.176203 -0.103776
+0.456086 0.177156 -0.102986
+
+
+0.45628 0.176203 -0.103776
+0.459708 0.173663 -0.0927109
+
+
+0.45628 0.176203 -0.103776
+0.456298 0.175389 -0.105092
+0.451157 0.188496 -0.105059
+
+
+0.405968 0.256276 -0.155366
+0.403923 0.261758 -0.153137
+
+
+0.461445 0.12353 -0.166242
+0.462785 0.169902 -0.0851817
+
+
+0.461445 0.12353 -0.166242
+0.461814 0.122518 -0.166157
+
+
+0.461445 0.12353 -0.166242
+0.46088 0.12505 -0.166388
+0.460151 0.13316 -0.156641
+0.448159 0.194932 -0.106963
+
+
+0.456466 0.174382 -0.106071
+0.456298 0.175389 -0.105092
+
+
+0.456466 0.174382 -0.106071
+0.460608 0.172409 -0.0908173
+
+
+0.456466 0.174382 -0.106071
+0.45652 0.173363 -0.107553
+
+
+0.390018 0.0326772 0.312932
+0.389879 0.0289703 0.313446
+
+
+0.389009 0.0115997 0.315909
+0.388802 0.00745904 0.316444
+
+
+0.44362 -0.0806055 0.234052
+0.44469 -0.0814519 0.232343
+
+
+0.507729 0.0694471 -0.0103671
+0.508036 0.0677589 -0.0119964
+0.49032 -0.00243348 0.0999044
+0.499806 -0.098541 0.0267709
+0.499366 -0.0987875 0.0291595
+0.49742 -0.099771 0.0397534
+
+
+0.507729 0.0694471 -0.0103671
+0.463256 0.170377 -0.0819556
+
+
+0.507729 0.0694471 -0.0103671
+0.506317 0.0770826 -0.00286165
+0.49032 -0.00243348 0.0999044
+0.502457 -0.0971393 0.0120772
+0.501963 -0.0974214 0.0148104
+0.499806 -0.098541 0.0267709
+
+
+0.431384 -0.184653 0.208234
+0.42876 -0.190144 0.209263
+
+
+0.31606 -0.183286 0.342778
+0.27822 -0.176201 0.376759
+0.172819 -0.189686 0.441681
+
+
+0.416749 -0.05895 0.276372
+0.417321 -0.0593858 0.275495
+
+
+0.389273 -0.0374943 0.317337
+0.389877 -0.0379387 0.316467
+
+
+0.46618 -0.039605 0.196257
+0.466377 -0.0350906 0.195774
+
+
+0.465582 -0.0519033 0.197642
+0.465819 -0.0468684 0.197108
+
+
+0.283448 -0.212875 0.353425
+0.27822 -0.176201 0.376759
+0.173996 -0.21135 0.430785
+0.174424 -0.219886 0.426442
+0.0527917 -0.222753 0.444966
+0.0126288 -0.123629 0.494067
+0.0157923 -0.123176 0.493945
+
+
+0.438098 -0.231944 0.0673534
+0.43822 -0.231851 0.0668736
+
+
+0.392841 0.29079 -0.141468
+0.389194 0.300294 -0.137571
+
+
+0.464515 -0.113393 0.194257
+0.464223 -0.10984 0.196037
+
+
+0.459579 0.0589506 0.200358
+0.455493 0.0617811 0.206901
+
+
+0.449242 0.0661636 0.216813
+0.446149 0.0682712 0.221693
+
+
+0.441149 0.0717303 0.229497
+0.438546 0.0734742 0.233539
+
+
+0.434142 0.0764746 0.240293
+0.43175 0.0780494 0.243943
+
+
+0.427539 0.0808732 0.250288
+0.42516 0.082413 0.253854
+
+
+0.411575 0.0652579 0.277566
+0.412104 0.0660819 0.276637
+
+
+0.466263 0.0542436 0.189612
+0.461323 0.057691 0.197572
+
+
+0.496542 0.125386 0.0445698
+0.46315 0.170911 -0.0814255
+
+
+0.438997 0.16923 -0.17963
+0.435624 0.175825 -0.181576
+
+
+0.471796 -0.110874 0.162807
+0.472391 -0.11063 0.16022
+
+
+0.500653 0.105926 0.0254261
+0.50099 0.104278 0.02383
+0.49032 -0.00243348 0.0999044
+0.504302 -0.0882095 0.00318068
+
+
+0.500653 0.105926 0.0254261
+0.463197 0.170711 -0.0815886
+
+
+0.500653 0.105926 0.0254261
+0.499042 0.113673 0.0330675
+0.49032 -0.00243348 0.0999044
+0.505391 -0.0755971 -0.000956084
+
+
+0.468414 0.0526863 0.186152
+0.468976 0.0522912 0.185241
+
+
+0.41366 0.0683105 0.273933
+0.414242 0.0692173 0.272903
+
+
+0.406052 0.0572808 0.28699
+0.406509 0.0579843 0.286212
+
+
+0.398906 0.0472051 0.298725
+0.399405 0.0479495 0.297913
+
+
+0.420272 0.0202432 0.270855
+0.468638 0.0323751 0.187749
+
+
+0.420272 0.0202432 0.270855
+0.468824 0.0423646 0.186501
+
+
+0.0273247 0.499308 -0.00935394
+0.0284093 0.499242 -0.00802545
+0.0272388 0.499148 0.0225842
+0.0382631 0.492441 0.0936176
+0.0320616 0.492733 0.0944856
+0.0312454 0.492773 0.0945841
+
+
+0.0273247 0.499308 -0.00935394
+0.058974 0.496872 -0.00641194
+0.0671545 0.494746 0.0345981
+0.0692789 0.494407 0.0370762
+0.0272388 0.499148 0.0225842
+0.0453079 0.492081 0.0926418
+0.0390756 0.492399 0.0935189
+0.0382631 0.492441 0.0936176
+
+
+0.0273247 0.499308 -0.00935394
+0.0251968 0.499434 -0.0115614
+0.0272388 0.499148 0.0225842
+0.0525177 0.491684 0.0916375
+0.0461323 0.492035 0.0925409
+0.0453079 0.492081 0.0926418
+
+
+0.13585 0.479613 -0.0901081
+0.127981 0.482925 -0.0893491
+0.204528 0.456279 -0.0194397
+0.218832 0.449691 0.0218342
+0.221659 0.448364 0.0200461
+0.242498 0.434148 0.0557766
+0.204745 0.446045 0.104745
+0.199012 0.448898 0.1057
+0.195871 0.450472 0.106151
+
+
+0.276747 0.391852 0.142079
+0.270737 0.406813 0.107727
+0.257152 0.410902 0.122613
+0.256574 0.411247 0.122667
+0.255884 0.412037 0.121455
+
+
+0.276747 0.391852 0.142079
+0.275758 0.392806 0.141201
+0.27329 0.395292 0.138675
+0.270737 0.406813 0.107727
+0.258363 0.409791 0.123778
+0.25776 0.410141 0.123877
+0.257152 0.410902 0.122613
+
+
+0.276747 0.391852 0.142079
+0.280073 0.388498 0.14545
+0.245333 0.413089 0.139891
+0.192311 0.415204 0.213652
+0.191468 0.41566 0.2137
+0.182229 0.42071 0.214095
+
+
+-0.0958854 0.408021 0.280762
+-0.156068 0.355593 0.31559
+-0.274841 0.278094 0.33511
+-0.276594 0.275395 0.337076
+-0.283761 0.27756 0.325461
+-0.272468 0.359184 0.217136
+-0.307083 0.284456 0.287353
+-0.308052 0.284722 0.285773
+-0.312998 0.286175 0.277562
+
+
+0.146986 0.474906 -0.0911227
+0.140311 0.477739 -0.0904787
+
+
+0.459327 0.143202 -0.144215
+0.45875 0.149337 -0.136904
+
+
+0.459327 0.143202 -0.144215
+0.462657 0.169986 -0.0856352
+
+
+0.459327 0.143202 -0.144215
+0.460151 0.13316 -0.156641
+
+
+0.475903 -0.0535821 -0.143999
+0.476294 -0.0521004 -0.143295
+
+
+0.469238 0.198071 0.0387549
+0.472127 0.190741 0.0397115
+0.434716 0.190815 0.158152
+0.488462 0.113906 0.0884399
+
+
+0.469238 0.198071 0.0387549
+0.462914 0.171718 -0.0809845
+
+
+0.469238 0.198071 0.0387549
+0.467664 0.202031 0.038278
+0.434716 0.190815 0.158152
+0.49074 0.118269 0.0761416
+0.491714 0.120108 0.0708529
+0.49032 -0.00243348 0.0999044
+0.507263 -0.0522934 -0.00859199
+0.507587 -0.0479786 -0.010034
+
+
+0.238009 0.203752 0.397452
+0.23763 0.202617 0.398202
+0.145377 0.224646 0.422847
+0.199548 0.141313 0.443696
+
+
+0.238009 0.203752 0.397452
+0.299403 0.145597 0.373168
+0.299076 0.145266 0.373555
+0.298797 0.145051 0.373858
+0.298188 0.144436 0.374572
+0.297637 0.143706 0.375282
+0.297524 0.143505 0.375446
+0.297066 0.142903 0.376029
+0.296551 0.141982 0.376773
+0.296318 0.141385 0.377174
+0.296069 0.140947 0.377528
+0.295623 0.139789 0.378296
+0.295457 0.139033 0.378698
+0.295242 0.138495 0.379057
+0.294937 0.137056 0.379805
+0.294923 0.136555 0.379994
+0.294675 0.135453 0.380572
+0.294675 0.134053 0.381061
+
+
+0.238009 0.203752 0.397452
+0.240216 0.21072 0.392893
+0.145377 0.224646 0.422847
+0.20521 0.14802 0.438333
+
+
+0.46088 0.12505 -0.166388
+0.45769 0.131635 -0.168376
+
+
+0.389499 0.180706 -0.257987
+0.391419 0.180821 -0.254837
+
+
+0.132858 -0.181508 -0.464448
+0.131564 -0.18068 -0.46521
+0.0542157 -0.290746 -0.403643
+0.174208 -0.355552 -0.333247
+0.187214 -0.356537 -0.330182
+0.214691 -0.358462 -0.323826
+
+
+0.132858 -0.181508 -0.464448
+0.223301 -0.0667773 -0.442807
+0.262661 -0.00149414 -0.429309
+0.255172 -0.0041378 -0.432976
+0.253596 -0.00473079 -0.433743
+
+
+0.132858 -0.181508 -0.464448
+0.142448 -0.187763 -0.458724
+0.0542157 -0.290746 -0.403643
+0.146928 -0.353557 -0.339559
+0.155981 -0.354262 -0.337431
+0.174208 -0.355552 -0.333247
+
+
+-0.0852673 0.0291013 -0.495022
+-0.0112878 0.011464 -0.500142
+-0.0570632 -0.000579035 -0.49749
+-0.0522148 -0.00333252 -0.497815
+-0.0517665 -0.00356295 -0.497845
+
+
+-0.0852673 0.0291013 -0.495022
+-0.0863963 0.0244061 -0.495094
+-0.0869743 0.0218015 -0.495137
+-0.0112878 0.011464 -0.500142
+-0.0635565 0.00308048 -0.497035
+-0.0576011 -0.000298485 -0.497453
+-0.0570632 -0.000579035 -0.49749
+
+
+-0.0852673 0.0291013 -0.495022
+-0.0846905 0.0316919 -0.494968
+-0.156562 0.0450098 -0.473141
+-0.216657 -0.0346669 -0.456562
+-0.216082 -0.0369895 -0.456909
+-0.213401 -0.0473116 -0.458495
+
+
+-0.0136801 0.345242 -0.385606
+0.112594 0.380998 -0.304242
+0.25519 0.341554 -0.291108
+0.241858 0.338809 -0.300293
+0.198312 0.245013 -0.388641
+0.186446 0.327207 -0.337872
+0.184477 0.326801 -0.339166
+0.178399 0.325458 -0.343226
+
+
+-0.0136801 0.345242 -0.385606
+-0.0120274 0.34422 -0.386318
+-0.00107495 0.337526 -0.390933
+0.112594 0.380998 -0.304242
+0.238118 0.338068 -0.302834
+0.227297 0.335816 -0.310258
+0.198312 0.245013 -0.388641
+0.21508 0.33328 -0.318578
+0.212423 0.332747 -0.320361
+
+
+-0.0136801 0.345242 -0.385606
+-0.0254878 0.352423 -0.380588
+-0.0533786 0.210915 -0.450628
+-0.165153 0.268332 -0.404578
+-0.16089 0.274034 -0.402415
+-0.250076 0.305099 -0.307859
+-0.272888 0.31178 -0.280347
+-0.273923 0.311171 -0.280057
+-0.276809 0.309335 -0.279396
+
+
+-0.0570522 0.371519 -0.36699
+-0.0423241 0.362645 -0.373349
+0.112594 0.380998 -0.304242
+0.224198 0.335199 -0.312351
+0.21508 0.33328 -0.318578
+
+
+-0.0570522 0.371519 -0.36699
+-0.0533786 0.210915 -0.450628
+-0.157595 0.278362 -0.400782
+-0.153303 0.284074 -0.398585
+-0.250076 0.305099 -0.307859
+-0.269472 0.313897 -0.281167
+-0.270385 0.313369 -0.280908
+-0.272888 0.31178 -0.280347
+
+
+-0.0570522 0.371519 -0.36699
+-0.059359 0.372924 -0.365976
+0.112594 0.380998 -0.304242
+0.202148 0.330584 -0.327314
+
+
+0.285172 0.349885 -0.256816
+0.285824 0.350106 -0.255576
+
+
+0.310329 0.270471 -0.296527
+0.307323 0.275299 -0.296441
+
+
+0.310329 0.270471 -0.296527
+0.38169 0.223987 -0.233544
+0.352648 0.200092 -0.297572
+
+
+0.310329 0.270471 -0.296527
+0.314934 0.262939 -0.296735
+
+
+0.382425 0.180101 -0.26957
+0.37975 0.179914 -0.27387
+
+
+0.396359 0.181189 -0.246583
+0.394639 0.181096 -0.249448
+
+
+0.345292 0.212666 -0.297516
+0.38169 0.223987 -0.233544
+0.348985 0.206376 -0.297552
+
+
+0.337518 0.225764 -0.297387
+0.38169 0.223987 -0.233544
+0.341496 0.219084 -0.297462
+
+
+0.199845 0.17409 -0.428386
+0.182225 0.0994352 -0.45531
+0.152235 0.186593 -0.444203
+0.150239 0.187128 -0.444834
+0.141996 0.18922 -0.44747
+
+
+0.199845 0.17409 -0.428386
+0.198347 0.174511 -0.428894
+0.192543 0.176044 -0.430891
+0.182225 0.0994352 -0.45531
+0.1614 0.184227 -0.441245
+0.159595 0.184715 -0.441822
+0.152235 0.186593 -0.444203
+
+
+0.199845 0.17409 -0.428386
+0.205717 0.172528 -0.42634
+0.198312 0.245013 -0.388641
+0.259895 0.342481 -0.287895
+0.25519 0.341554 -0.291108
+
+
+0.368528 0.0650587 -0.349704
+0.429296 -0.00494892 -0.257062
+0.445917 -0.0475254 -0.224104
+0.445974 -0.0473349 -0.224018
+0.447366 -0.0423918 -0.221932
+
+
+0.0150267 -0.342181 -0.368207
+0.0542157 -0.290746 -0.403643
+0.126968 -0.352068 -0.344145
+0.133741 -0.352611 -0.342559
+0.146928 -0.353557 -0.339559
+
+
+0.0150267 -0.342181 -0.368207
+0.0177892 -0.342502 -0.367646
+0.02233 -0.342959 -0.36678
+0.0542157 -0.290746 -0.403643
+0.111468 -0.350884 -0.347677
+0.116816 -0.351327 -0.346432
+0.126968 -0.352068 -0.344145
+
+
+0.0150267 -0.342181 -0.368207
+0.0101541 -0.341677 -0.369124
+0.0259521 -0.389689 -0.312841
+0.119704 -0.399908 -0.286072
+0.099914 -0.402693 -0.285398
+
+
+-0.292364 0.404138 0.106666
+-0.286837 0.40761 0.107925
+-0.272468 0.359184 0.217136
+-0.300452 0.282513 0.298258
+-0.301549 0.282817 0.296479
+-0.307083 0.284456 0.287353
+
+
+-0.292364 0.404138 0.106666
+-0.263681 0.425199 -0.00886505
+-0.403828 0.330642 0.00728321
+-0.408135 0.327772 0.0102308
+
+
+-0.292364 0.404138 0.106666
+-0.29675 0.401357 0.105713
+-0.272468 0.359184 0.217136
+-0.292819 0.280257 0.310735
+-0.294096 0.280616 0.308675
+-0.300452 0.282513 0.298258
+
+
+-0.169979 0.391338 -0.274142
+-0.162841 0.390631 -0.281639
+-0.164923 0.436861 -0.17987
+-0.201112 0.449674 -0.106354
+-0.204429 0.44793 -0.107509
+-0.208014 0.44602 -0.108826
+
+
+-0.169979 0.391338 -0.274142
+-0.25213 0.343735 -0.26153
+
+
+-0.169979 0.391338 -0.274142
+-0.17249 0.391612 -0.27145
+-0.164923 0.436861 -0.17987
+-0.19424 0.453276 -0.103891
+-0.197559 0.451548 -0.105047
+-0.201112 0.449674 -0.106354
+
+
+0.232858 -0.342931 -0.332179
+0.33739 -0.178163 -0.323546
+
+
+0.176536 0.32507 -0.344443
+0.112594 0.380998 -0.304242
+0.192937 0.328623 -0.33351
+0.186446 0.327207 -0.337872
+
+
+-0.0502737 0.1117 -0.492653
+-0.0589897 0.109787 -0.492433
+-0.0112878 0.011464 -0.500142
+-0.0718839 0.0077754 -0.496428
+-0.0642285 0.00343587 -0.496986
+-0.0635565 0.00308048 -0.497035
+
+
+-0.0502737 0.1117 -0.492653
+-0.0533786 0.210915 -0.450628
+-0.149954 0.288451 -0.396911
+-0.14555 0.294282 -0.394638
+-0.250076 0.305099 -0.307859
+-0.266413 0.315781 -0.281892
+-0.267239 0.315311 -0.281656
+-0.269472 0.313897 -0.281167
+
+
+-0.0502737 0.1117 -0.492653
+-0.0484033 0.112088 -0.492701
+-0.0112878 0.011464 -0.500142
+-0.0832038 0.0141595 -0.495575
+-0.0727675 0.00824861 -0.496362
+-0.0718839 0.0077754 -0.496428
+
+
+0.0465061 0.307995 -0.410594
+0.056661 0.301624 -0.414681
+0.112594 0.380998 -0.304242
+0.184477 0.326801 -0.339166
+
+
+0.0465061 0.307995 -0.410594
+-0.0533786 0.210915 -0.450628
+-0.142081 0.298795 -0.392888
+-0.137472 0.304867 -0.39049
+-0.250076 0.305099 -0.307859
+-0.263606 0.317498 -0.28255
+-0.264372 0.317069 -0.282329
+-0.266413 0.315781 -0.281892
+
+
+0.0465061 0.307995 -0.410594
+0.0450472 0.308922 -0.409993
+
+
+0.000474451 0.336562 -0.391595
+0.0108502 0.330188 -0.395928
+0.112594 0.380998 -0.304242
+0.168924 0.32339 -0.349468
+
+
+0.000474451 0.336562 -0.391595
+-0.0533786 0.210915 -0.450628
+-0.133806 0.309614 -0.388625
+-0.128884 0.316066 -0.386045
+
+
+0.000474451 0.336562 -0.391595
+-0.00107495 0.337526 -0.390933
+
+
+-0.0272896 0.353532 -0.379807
+0.112594 0.380998 -0.304242
+0.161483 0.321728 -0.354347
+
+
+-0.0272896 0.353532 -0.379807
+-0.0254878 0.352423 -0.380588
+
+
+-0.0272896 0.353532 -0.379807
+-0.0403122 0.361414 -0.374227
+-0.0533786 0.210915 -0.450628
+-0.115188 0.333781 -0.37892
+-0.109182 0.341579 -0.375729
+-0.250076 0.305099 -0.307859
+-0.260973 0.319098 -0.283159
+-0.261697 0.318698 -0.282949
+-0.263606 0.317498 -0.28255
+
+
+0.16557 0.407792 -0.245595
+0.170082 0.405315 -0.24695
+
+
+0.38169 0.223987 -0.233544
+0.333261 0.232861 -0.297289
+
+
+0.38169 0.223987 -0.233544
+0.323401 0.249142 -0.297002
+
+
+0.38169 0.223987 -0.233544
+0.301629 0.284559 -0.296172
+
+
+0.38169 0.223987 -0.233544
+0.29047 0.30255 -0.295686
+
+
+0.38169 0.223987 -0.233544
+0.282616 0.31982 -0.29078
+0.28183 0.322295 -0.289543
+0.198312 0.245013 -0.388641
+0.27656 0.339067 -0.281039
+0.274539 0.345468 -0.277769
+0.259895 0.342481 -0.287895
+
+
+0.38169 0.223987 -0.233544
+0.277479 0.336196 -0.282485
+0.27656 0.339067 -0.281039
+
+
+-0.27843 -0.418037 -0.0636676
+-0.277917 -0.417944 -0.0655819
+-0.188258 -0.456482 -0.0811385
+-0.102552 -0.50787 0.0496612
+-0.0817685 -0.516219 0.0524604
+-0.0796979 -0.517049 0.0527249
+
+
+0.509619 -0.018508 -0.0196436
+0.49032 -0.00243348 0.0999044
+0.508091 -0.0410955 -0.0122575
+
+
+0.392591 0.066458 -0.312156
+0.394975 0.0664665 -0.308412
+
+
+0.0920703 -0.100495 -0.497303
+0.0908338 -0.112915 -0.495881
+0.223301 -0.0667773 -0.442807
+0.274111 0.00260021 -0.42367
+0.264614 -0.000763066 -0.428351
+0.262661 -0.00149414 -0.429309
+
+
+0.0920703 -0.100495 -0.497303
+-0.0433918 -0.0459736 -0.496391
+0.0553016 -0.16285 -0.488025
+0.0491158 -0.165096 -0.487354
+0.0542157 -0.290746 -0.403643
+0.0988651 -0.349898 -0.350523
+0.10327 -0.350275 -0.349504
+0.111468 -0.350884 -0.347677
+
+
+0.0920703 -0.100495 -0.497303
+0.0923505 -0.0978804 -0.497594
+0.223301 -0.0667773 -0.442807
+0.289373 0.00806523 -0.41611
+0.276651 0.00354561 -0.422416
+0.274111 0.00260021 -0.42367
+
+
+-0.0398712 -0.41811 -0.277801
+-0.0596627 -0.419697 -0.276316
+0.0339636 -0.431711 -0.250744
+0.165986 -0.454169 -0.182204
+0.162403 -0.455832 -0.179959
+0.183592 -0.464325 -0.0331205
+0.148855 -0.481617 0.101008
+0.152244 -0.480291 0.100265
+
+
+-0.0398712 -0.41811 -0.277801
+0.0259521 -0.389689 -0.312841
+0.0857884 -0.404656 -0.284908
+0.075616 -0.406054 -0.284537
+0.0339636 -0.431711 -0.250744
+0.153641 -0.459846 -0.174566
+0.150315 -0.461374 -0.172478
+0.183592 -0.464325 -0.0331205
+0.133881 -0.487417 0.104382
+0.137683 -0.485945 0.103552
+0.148855 -0.481617 0.101008
+
+
+-0.0398712 -0.41811 -0.277801
+-0.0396038 -0.418091 -0.277817
+0.0339636 -0.431711 -0.250744
+0.142091 -0.465099 -0.167411
+0.138937 -0.466532 -0.165429
+0.183592 -0.464325 -0.0331205
+0.116802 -0.493966 0.108215
+0.121182 -0.492287 0.10726
+0.133881 -0.487417 0.104382
+
+
+0.260937 -0.398858 -0.258273
+0.264729 -0.39624 -0.261912
+0.256402 -0.388114 -0.277483
+0.0339636 -0.431711 -0.250744
+0.13106 -0.47006 -0.16057
+0.128009 -0.471431 -0.158649
+0.183592 -0.464325 -0.0331205
+0.0731515 -0.510437 0.117017
+0.0834261 -0.506602 0.115688
+
+
+-0.007388 -0.415409 -0.280164
+-0.015402 -0.416096 -0.27959
+0.0339636 -0.431711 -0.250744
+0.120313 -0.474838 -0.153897
+0.117304 -0.476174 -0.152
+0.183592 -0.464325 -0.0331205
+0.045253 -0.520764 0.120672
+0.06384 -0.513885 0.118276
+0.0731515 -0.510437 0.117017
+
+
+-0.007388 -0.415409 -0.280164
+0.0259521 -0.389689 -0.312841
+0.0754679 -0.406072 -0.284535
+0.0674648 -0.407155 -0.284231
+0.0339636 -0.431711 -0.250744
+0.109641 -0.479526 -0.147262
+0.106616 -0.480854 -0.145353
+0.183592 -0.464325 -0.0331205
+0.0156664 -0.531435 0.119785
+0.0168875 -0.530996 0.119864
+0.0407489 -0.522419 0.121275
+0.045253 -0.520764 0.120672
+
+
+-0.007388 -0.415409 -0.280164
+-0.00726839 -0.415401 -0.280169
+0.0339636 -0.431711 -0.250744
+0.0988395 -0.484216 -0.140538
+0.0957401 -0.48556 -0.13858
+0.183592 -0.464325 -0.0331205
+0.00233019 -0.535395 0.101207
+0.00226024 -0.535415 0.101106
+-0.176814 -0.420902 0.204888
+-0.100426 -0.396129 0.308882
+-0.0916288 -0.40193 0.304453
+-0.0904291 -0.402729 0.303834
+
+
+-0.259999 -0.382948 0.200575
+-0.260626 -0.379858 0.207758
+-0.262228 -0.377433 0.211105
+-0.176814 -0.420902 0.204888
+-0.110326 -0.389547 0.313856
+-0.101604 -0.395339 0.309488
+-0.100426 -0.396129 0.308882
+
+
+-0.259999 -0.382948 0.200575
+-0.295876 -0.38485 0.121445
+-0.253574 -0.410703 0.134154
+-0.253966 -0.409183 0.138003
+-0.208416 -0.429931 0.148736
+-0.172182 -0.439069 0.167479
+-0.174952 -0.437357 0.168819
+-0.176814 -0.420902 0.204888
+-0.120318 -0.382856 0.318849
+-0.111505 -0.38875 0.314458
+-0.110326 -0.389547 0.313856
+
+
+-0.259999 -0.382948 0.200575
+-0.259772 -0.383919 0.198358
+-0.208416 -0.429931 0.148736
+-0.176068 -0.436695 0.169284
+-0.178485 -0.435187 0.170459
+-0.176814 -0.420902 0.204888
+-0.130599 -0.375924 0.32396
+-0.121521 -0.382038 0.31946
+-0.120318 -0.382856 0.318849
+
+
+-0.285782 -0.383429 -0.154633
+-0.285775 -0.38346 -0.154562
+-0.225451 -0.420597 -0.150567
+-0.218168 -0.437188 -0.109121
+-0.216505 -0.437706 -0.110224
+-0.214565 -0.438279 -0.111615
+
+
+-0.285782 -0.383429 -0.154633
+-0.335423 -0.353515 -0.113662
+-0.394133 -0.33006 0.0112669
+-0.3989 -0.325419 0.0114706
+-0.32754 -0.35453 0.132009
+-0.30388 -0.36876 0.147689
+-0.304334 -0.36889 0.146351
+-0.30533 -0.368966 0.143948
+
+
+-0.285782 -0.383429 -0.154633
+-0.286333 -0.380524 -0.16156
+-0.225451 -0.420597 -0.150567
+-0.221984 -0.436015 -0.106471
+-0.220214 -0.436574 -0.107652
+-0.218168 -0.437188 -0.109121
+
+
+-0.341132 -0.168358 -0.360867
+-0.347509 -0.15513 -0.356693
+-0.433806 -0.126861 -0.214754
+-0.473029 -0.230436 -0.0563494
+-0.467579 -0.232747 -0.0667339
+-0.461926 -0.235076 -0.0775534
+
+
+-0.341132 -0.168358 -0.360867
+-0.296119 -0.00157042 -0.403375
+-0.349923 -0.150044 -0.355118
+-0.355444 -0.138519 -0.351454
+-0.433806 -0.126861 -0.214754
+-0.483603 -0.219472 -0.040515
+-0.48568 -0.214968 -0.0389765
+-0.413046 -0.239792 0.149308
+-0.366978 -0.256641 0.236321
+-0.36578 -0.258762 0.236114
+-0.361826 -0.265835 0.235331
+
+
+-0.341132 -0.168358 -0.360867
+-0.338301 -0.17428 -0.362691
+
+
+-0.276269 0.337929 -0.243906
+-0.276263 0.338458 -0.243188
+
+
+-0.0396038 -0.418091 -0.277817
+-0.0259277 -0.416972 -0.27883
+0.0259521 -0.389689 -0.312841
+0.0673453 -0.407169 -0.28423
+0.0607704 -0.408044 -0.283969
+0.0339636 -0.431711 -0.250744
+0.0876943 -0.488998 -0.133592
+0.0844557 -0.490385 -0.131544
+0.183592 -0.464325 -0.0331205
+-0.000552172 -0.526125 -0.0683407
+-0.00162104 -0.526699 -0.0657178
+
+
+0.285817 -0.413127 0.0321224
+0.284705 -0.41388 0.0344758
+
+
+-0.352895 0.297214 0.209347
+-0.357491 0.298439 0.201202
+-0.272468 0.359184 0.217136
+-0.254694 0.309023 0.312374
+-0.256061 0.306907 0.313954
+
+
+-0.352895 0.297214 0.209347
+-0.377121 0.208972 0.25399
+-0.421929 0.090701 0.274683
+-0.41947 0.0920593 0.277337
+-0.361072 0.00364482 0.34643
+-0.342954 -0.0324153 0.363173
+-0.343289 -0.0335909 0.362794
+-0.34445 -0.0372228 0.361496
+
+
+-0.352895 0.297214 0.209347
+-0.352072 0.297012 0.210776
+
+
+0.104849 0.436062 0.223997
+0.0992733 0.435977 0.226127
+0.0566727 0.45453 0.201473
+-0.00114467 0.449086 0.223844
+-0.00195534 0.449396 0.223315
+-0.00708351 0.451437 0.219796
+
+
+0.104849 0.436062 0.223997
+0.0840644 0.412413 0.270646
+0.0386555 0.39161 0.311677
+0.0387715 0.387779 0.317121
+-0.00934473 0.41695 0.276524
+-0.0117812 0.339563 0.383578
+-0.00105352 0.343653 0.378237
+0.105038 0.280323 0.400982
+0.154066 0.266786 0.39505
+0.153395 0.266443 0.395494
+0.148972 0.264368 0.398294
+
+
+0.104849 0.436062 0.223997
+0.105657 0.436085 0.223665
+0.0566727 0.45453 0.201473
+0.00413917 0.446974 0.227435
+0.00340887 0.447255 0.226961
+-0.00114467 0.449086 0.223844
+
+
+0.369921 -0.13778 -0.308359
+0.375842 -0.125384 -0.30804
+0.342834 -0.170292 -0.321978
+
+
+0.369921 -0.13778 -0.308359
+0.360322 -0.179083 -0.29713
+0.360036 -0.178406 -0.297847
+
+
+0.369921 -0.13778 -0.308359
+0.368638 -0.14033 -0.308497
+
+
+-0.154643 -0.461743 -0.117302
+-0.151315 -0.463247 -0.116134
+-0.153551 -0.446874 -0.1647
+-0.100197 -0.485761 -0.0974991
+-0.0949427 -0.488051 -0.0955208
+-0.0799252 -0.494521 -0.0900911
+
+
+-0.154643 -0.461743 -0.117302
+-0.188258 -0.456482 -0.0811385
+-0.121442 -0.50022 0.0471216
+-0.104235 -0.50719 0.0494469
+-0.102552 -0.50787 0.0496612
+
+
+-0.154643 -0.461743 -0.117302
+-0.15599 -0.461117 -0.11783
+-0.153551 -0.446874 -0.1647
+-0.11434 -0.479617 -0.102664
+-0.110564 -0.481275 -0.101233
+-0.100197 -0.485761 -0.0974991
+
+
+0.350585 -0.362023 -0.116589
+0.349048 -0.363331 -0.113002
+
+
+-0.33959 0.373009 -0.0370641
+-0.340966 0.37211 -0.0361422
+-0.310534 0.370612 -0.128901
+-0.365067 0.356316 -0.019555
+-0.379921 0.346507 -0.00926602
+
+
+-0.33959 0.373009 -0.0370641
+-0.263681 0.425199 -0.00886505
+-0.418666 0.320902 0.0277051
+-0.415522 0.323131 0.0385427
+-0.464303 0.153517 0.106091
+-0.479998 0.0094563 0.212047
+-0.483139 0.00170441 0.208602
+-0.487456 -0.00889462 0.203806
+
+
+-0.33959 0.373009 -0.0370641
+-0.332109 0.377853 -0.0422101
+-0.310534 0.370612 -0.128901
+-0.351645 0.365137 -0.0288039
+-0.362909 0.357742 -0.0210169
+-0.365067 0.356316 -0.019555
+
+
+-0.249176 0.326158 -0.285734
+-0.251027 0.325033 -0.285379
+-0.250076 0.305099 -0.307859
+-0.258449 0.320621 -0.283735
+-0.259149 0.320239 -0.283531
+-0.260973 0.319098 -0.283159
+
+
+-0.249176 0.326158 -0.285734
+-0.257779 0.336714 -0.265277
+
+
+-0.249176 0.326158 -0.285734
+-0.248439 0.32655 -0.285936
+-0.250076 0.305099 -0.307859
+-0.255983 0.322098 -0.284289
+-0.256672 0.321726 -0.28409
+-0.258449 0.320621 -0.283735
+
+
+-0.0959957 0.438875 -0.228774
+-0.1021 0.441095 -0.218954
+-0.164923 0.436861 -0.17987
+-0.187265 0.456896 -0.101389
+-0.19065 0.455151 -0.10257
+-0.19424 0.453276 -0.103891
+
+
+-0.0959957 0.438875 -0.228774
+-0.104262 0.466121 -0.149203
+-0.132225 0.486735 -0.0513512
+-0.129756 0.488041 -0.0486951
+-0.123732 0.488239 -0.0530127
+-0.0248719 0.498374 -0.0374832
+-0.0185246 0.500325 0.00959594
+-0.0202626 0.5003 0.0111678
+-0.0230387 0.500253 0.0135122
+
+
+-0.0959957 0.438875 -0.228774
+-0.093052 0.43774 -0.23366
+-0.164923 0.436861 -0.17987
+-0.180047 0.460605 -0.098798
+-0.183568 0.458808 -0.100028
+-0.187265 0.456896 -0.101389
+
+
+0.0801207 0.229645 -0.451696
+0.081893 0.222848 -0.455033
+0.198312 0.245013 -0.388641
+0.284114 0.306052 -0.299275
+
+
+0.0801207 0.229645 -0.451696
+-0.0533786 0.210915 -0.450628
+-0.104242 0.347898 -0.373153
+-0.0973471 0.356809 -0.369469
+-0.250076 0.305099 -0.307859
+-0.253525 0.323559 -0.284834
+-0.254216 0.323189 -0.284636
+-0.255983 0.322098 -0.284289
+
+
+0.0801207 0.229645 -0.451696
+0.0789001 0.234501 -0.449291
+0.198312 0.245013 -0.388641
+0.27854 0.288165 -0.314456
+
+
+0.0254163 0.438202 0.241786
+0.0218926 0.439696 0.239408
+0.0566727 0.45453 0.201473
+0.00895781 0.445029 0.230699
+0.00828435 0.44529 0.230265
+0.00413917 0.446974 0.227435
+
+
+0.0254163 0.438202 0.241786
+-0.00934473 0.41695 0.276524
+0.000577519 0.344288 0.377407
+0.01024 0.347943 0.372567
+0.105038 0.280323 0.400982
+0.178812 0.278463 0.379121
+0.177303 0.277722 0.380117
+
+
+0.0254163 0.438202 0.241786
+0.0260136 0.43796 0.242164
+0.0566727 0.45453 0.201473
+0.0134522 0.443195 0.233735
+0.0128177 0.443443 0.233328
+0.00895781 0.445029 0.230699
+
+
+-0.503035 0.11147 -0.0304722
+-0.498496 0.125185 -0.0294179
+-0.464303 0.153517 0.106091
+-0.473259 0.0258799 0.219395
+-0.476118 0.0188911 0.216303
+-0.479998 0.0094563 0.212047
+
+
+-0.503035 0.11147 -0.0304722
+-0.445457 0.167217 -0.154943
+-0.536045 -0.00967371 -0.0568153
+-0.542709 -0.0133918 -0.0398855
+-0.538467 0.000272481 -0.0388582
+-0.464303 0.153517 0.106091
+-0.467021 0.0409335 0.226103
+-0.469684 0.0344852 0.223263
+-0.473259 0.0258799 0.219395
+
+
+-0.503035 0.11147 -0.0304722
+-0.503324 0.110593 -0.0305322
+-0.464303 0.153517 0.106091
+-0.461118 0.055036 0.232362
+-0.463654 0.0489582 0.229698
+-0.467021 0.0409335 0.226103
+
+
+-0.342959 0.294558 0.226735
+-0.377121 0.208972 0.25399
+-0.413387 0.0954925 0.283844
+-0.41111 0.0967404 0.286282
+-0.361072 0.00364482 0.34643
+-0.341612 -0.0281363 0.364654
+-0.341913 -0.0291946 0.364318
+-0.342954 -0.0324153 0.363173
+
+
+0.366571 0.147157 -0.312282
+0.366872 0.139989 -0.315584
+
+
+-0.420186 0.0754277 -0.303841
+-0.414212 0.0873324 -0.308314
+-0.445457 0.167217 -0.154943
+-0.537848 0.00225703 -0.0387191
+-0.528849 0.030997 -0.0365517
+-0.464303 0.153517 0.106091
+-0.455415 0.0685207 0.238322
+-0.457878 0.0626759 0.235771
+-0.461118 0.055036 0.232362
+
+
+-0.420186 0.0754277 -0.303841
+-0.296119 -0.00157042 -0.403375
+-0.357562 -0.134024 -0.350052
+-0.362471 -0.12371 -0.346747
+-0.433806 -0.126861 -0.214754
+-0.491563 -0.202126 -0.0346805
+-0.493626 -0.197601 -0.0331363
+-0.413046 -0.239792 0.149308
+-0.371804 -0.247961 0.237236
+-0.370673 -0.249979 0.237045
+-0.366978 -0.256641 0.236321
+
+
+-0.420186 0.0754277 -0.303841
+-0.421595 0.0726389 -0.302769
+-0.445457 0.167217 -0.154943
+-0.528354 0.0325679 -0.0364423
+-0.52101 0.0557965 -0.0346845
+-0.464303 0.153517 0.106091
+-0.450961 0.0874418 0.233019
+-0.453498 0.0734066 0.239828
+-0.453631 0.072685 0.240172
+-0.455415 0.0685207 0.238322
+
+
+0.312167 -0.094226 -0.389004
+0.318701 -0.0848769 -0.386911
+0.223301 -0.0667773 -0.442807
+0.311247 0.0159069 -0.40522
+0.29289 0.00936662 -0.414364
+0.289373 0.00806523 -0.41611
+
+
+0.312167 -0.094226 -0.389004
+0.338914 -0.172934 -0.324868
+
+
+0.312167 -0.094226 -0.389004
+0.312101 -0.0943184 -0.389025
+0.223301 -0.0667773 -0.442807
+0.343063 0.0260623 -0.389158
+0.342913 0.0272747 -0.389391
+0.316561 0.0178616 -0.402569
+0.311247 0.0159069 -0.40522
+
+
+0.378129 -0.120761 -0.307826
+0.390339 -0.0952393 -0.307097
+0.342262 -0.170511 -0.322497
+
+
+0.378129 -0.120761 -0.307826
+0.360527 -0.179708 -0.296535
+0.360322 -0.179083 -0.29713
+
+
+0.378129 -0.120761 -0.307826
+0.375842 -0.125384 -0.30804
+
+
+0.359508 -0.159267 -0.308983
+0.361252 -0.155575 -0.308947
+0.345112 -0.169846 -0.319667
+
+
+0.359508 -0.159267 -0.308983
+0.359129 -0.176675 -0.299875
+0.358411 -0.175676 -0.301267
+0.357656 -0.174915 -0.302565
+0.351816 -0.17487 -0.309271
+
+
+0.359508 -0.159267 -0.308983
+0.359024 -0.160134 -0.309076
+0.34621 -0.169762 -0.318476
+
+
+0.348977 -0.170071 -0.315176
+0.351877 -0.174411 -0.309461
+
+
+0.352099 -0.171206 -0.310996
+0.352629 -0.172272 -0.309801
+
+
+0.357681 -0.163012 -0.309074
+0.359024 -0.160134 -0.309076
+
+
+0.357681 -0.163012 -0.309074
+0.358411 -0.175676 -0.301267
+
+
+0.357681 -0.163012 -0.309074
+0.35727 -0.163697 -0.309177
+
+
+0.361865 -0.154423 -0.308853
+0.364254 -0.149394 -0.308767
+
+
+0.361865 -0.154423 -0.308853
+0.359651 -0.177633 -0.298733
+0.359129 -0.176675 -0.299875
+
+
+0.361865 -0.154423 -0.308853
+0.361252 -0.155575 -0.308947
+
+
+0.42645 -0.112925 -0.251324
+0.431216 -0.0972288 -0.244841
+0.429296 -0.00494892 -0.257062
+0.44048 -0.0662813 -0.231979
+0.440563 -0.0660104 -0.231859
+0.442539 -0.0592568 -0.229039
+
+
+0.42645 -0.112925 -0.251324
+0.426503 -0.113161 -0.251114
+0.467061 -0.0515947 -0.172025
+0.47052 -0.0739653 -0.152446
+
+
+0.42645 -0.112925 -0.251324
+0.426095 -0.112647 -0.251948
+0.429296 -0.00494892 -0.257062
+0.420959 -0.108732 -0.260887
+0.422915 -0.110257 -0.257479
+0.426095 -0.112647 -0.251948
+
+
+0.450041 -0.0327237 -0.21781
+0.467061 -0.0515947 -0.172025
+0.469671 -0.0769726 -0.153677
+
+
+0.482899 0.0697072 -0.150966
+0.463134 0.169793 -0.083695
+
+
+0.489955 0.0612041 -0.129421
+0.4632 0.169837 -0.0832909
+
+
+0.110458 0.196023 0.446961
+0.16481 0.0690362 0.48284
+
+
+0.110458 0.196023 0.446961
+0.171567 0.0836758 0.475274
+
+
+0.110458 0.196023 0.446961
+0.177333 0.096195 0.468755
+
+
+0.110458 0.196023 0.446961
+0.182398 0.107216 0.46297
+
+
+0.110458 0.196023 0.446961
+0.18696 0.11717 0.457701
+
+
+0.110458 0.196023 0.446961
+0.191166 0.126369 0.45279
+
+
+0.110458 0.196023 0.446961
+0.195126 0.135054 0.448111
+
+
+0.110458 0.196023 0.446961
+0.179922 0.154722 0.444292
+
+
+0.110458 0.196023 0.446961
+0.166823 0.168889 0.442126
+
+
+0.110458 0.196023 0.446961
+0.158445 0.177934 0.440725
+
+
+0.110458 0.196023 0.446961
+0.152528 0.18431 0.439722
+
+
+0.110458 0.196023 0.446961
+0.148049 0.189125 0.438951
+
+
+0.110458 0.196023 0.446961
+0.144479 0.192952 0.438325
+0.142435 0.195225 0.437921
+
+
+0.110458 0.196023 0.446961
+0.138967 0.198834 0.437332
+0.137443 0.200549 0.437004
+
+
+0.110458 0.196023 0.446961
+0.136713 0.201226 0.436913
+
+
+0.110458 0.196023 0.446961
+0.132772 0.205387 0.436155
+0.131587 0.206747 0.435865
+
+
+0.110458 0.196023 0.446961
+0.130972 0.207277 0.435797
+
+
+0.110458 0.196023 0.446961
+0.129231 0.2091 0.435441
+
+
+0.110458 0.196023 0.446961
+0.127513 0.210894 0.435082
+
+
+0.110458 0.196023 0.446961
+0.125784 0.212693 0.434712
+
+
+0.110458 0.196023 0.446961
+0.12401 0.214533 0.434323
+
+
+0.110458 0.196023 0.446961
+0.122153 0.216453 0.433908
+0.120861 0.217887 0.433563
+
+
+0.110458 0.196023 0.446961
+0.120168 0.218497 0.433455
+
+
+0.110458 0.196023 0.446961
+0.117999 0.220724 0.432951
+
+
+0.110458 0.196023 0.446961
+0.112775 0.226056 0.431707
+0.110607 0.228341 0.43114
+
+
+0.110458 0.196023 0.446961
+0.109458 0.229425 0.430901
+
+
+0.110458 0.196023 0.446961
+0.105372 0.233563 0.429896
+
+
+0.110458 0.196023 0.446961
+0.100105 0.238883 0.428587
+
+
+0.110458 0.196023 0.446961
+0.0949922 0.240172 0.429183
+0.0923637 0.240342 0.429718
+
+
+0.110458 0.196023 0.446961
+0.089846 0.240431 0.430266
+
+
+0.110458 0.196023 0.446961
+0.0842827 0.240701 0.431418
+
+
+0.110458 0.196023 0.446961
+0.0781275 0.240989 0.432673
+
+
+0.110458 0.196023 0.446961
+0.0711405 0.241304 0.434076
+
+
+0.110458 0.196023 0.446961
+0.062975 0.24166 0.435693
+
+
+0.110458 0.196023 0.446961
+0.0531007 0.242076 0.437623
+
+
+0.110458 0.196023 0.446961
+0.0406551 0.242584 0.440027
+
+
+-0.0663817 -0.125244 0.486764
+-0.0755197 -0.11982 0.486178
+-0.0534567 -0.0227233 0.497018
+-0.0760198 0.117699 0.495291
+-0.0722523 0.120109 0.495727
+-0.0626716 0.126126 0.496835
+
+
+-0.0663817 -0.125244 0.486764
+-0.143539 -0.180191 0.444216
+-0.0384488 -0.168877 0.477774
+-0.0399034 -0.175776 0.474626
+-0.0406369 -0.179054 0.473119
+
+
+-0.0663817 -0.125244 0.486764
+-0.0663686 -0.125252 0.486765
+-0.0534567 -0.0227233 0.497018
+-0.088291 0.109934 0.493819
+-0.0848001 0.112173 0.494238
+-0.0760198 0.117699 0.495291
+
+
+-0.375921 0.181688 -0.316478
+-0.376171 0.167042 -0.330027
+-0.250076 0.305099 -0.307859
+-0.245703 0.328142 -0.286516
+-0.246488 0.327724 -0.286308
+-0.248439 0.32655 -0.285936
+
+
+-0.375921 0.181688 -0.316478
+-0.445457 0.167217 -0.154943
+-0.520598 0.0570927 -0.0345948
+-0.514369 0.076589 -0.033114
+-0.464303 0.153517 0.106091
+-0.447707 0.105105 0.22448
+-0.449746 0.0939775 0.229901
+-0.450961 0.0874418 0.233019
+
+
+-0.375921 0.181688 -0.316478
+-0.375883 0.183225 -0.315066
+
+
+-0.0923009 0.403744 0.287506
+-0.156068 0.355593 0.31559
+-0.271009 0.269531 0.346418
+-0.259744 0.270955 0.35091
+-0.178942 0.188749 0.427498
+-0.1631 0.0621806 0.483498
+-0.154707 0.067551 0.484778
+-0.0534567 -0.0227233 0.497018
+-0.099819 0.102622 0.492384
+-0.0965154 0.104747 0.492796
+-0.088291 0.109934 0.493819
+
+
+0.131832 0.48461 -0.0370754
+0.132542 0.484705 -0.0293867
+0.058974 0.496872 -0.00641194
+0.0735615 0.493735 0.0416871
+0.0767141 0.493227 0.0453107
+0.0272388 0.499148 0.0225842
+0.0600434 0.491241 0.0905834
+0.0533705 0.491633 0.0915322
+0.0525177 0.491684 0.0916375
+
+
+0.131832 0.48461 -0.0370754
+0.204528 0.456279 -0.0194397
+0.222224 0.448099 0.0196534
+0.225005 0.446779 0.0178905
+0.242498 0.434148 0.0557766
+0.211949 0.442427 0.103598
+0.207261 0.444774 0.104388
+0.204745 0.446045 0.104745
+
+
+0.131832 0.48461 -0.0370754
+0.1318 0.484607 -0.0373696
+0.058974 0.496872 -0.00641194
+0.0833381 0.492169 0.0525028
+0.0885944 0.491312 0.0584737
+0.0272388 0.499148 0.0225842
+0.0680628 0.490739 0.0894541
+0.0609436 0.491184 0.090471
+0.0600434 0.491241 0.0905834
+
+
+0.444389 -0.0528786 -0.226355
+0.445917 -0.0475254 -0.224104
+
+
+0.444389 -0.0528786 -0.226355
+0.467061 -0.0515947 -0.172025
+0.46871 -0.0803277 -0.155047
+
+
+0.444389 -0.0528786 -0.226355
+0.444326 -0.0530873 -0.226449
+
+
+-0.489293 0.152463 -0.0273283
+-0.485224 0.164291 -0.0264074
+-0.464303 0.153517 0.106091
+-0.444994 0.119598 0.217448
+-0.446705 0.110405 0.221947
+-0.447707 0.105105 0.22448
+
+
+-0.489293 0.152463 -0.0273283
+-0.445457 0.167217 -0.154943
+-0.514013 0.0776955 -0.0330378
+-0.508557 0.0945845 -0.03175
+-0.464303 0.153517 0.106091
+-0.442649 0.131916 0.211448
+-0.444136 0.124058 0.215311
+-0.444994 0.119598 0.217448
+
+
+-0.489293 0.152463 -0.0273283
+-0.489544 0.151729 -0.0273786
+-0.464303 0.153517 0.106091
+-0.440559 0.142702 0.206173
+-0.44189 0.135787 0.209588
+-0.442649 0.131916 0.211448
+
+
+-0.0888699 0.399631 0.293931
+-0.156068 0.355593 0.31559
+-0.253666 0.271762 0.353291
+-0.244163 0.272942 0.357055
+-0.178942 0.188749 0.427498
+-0.151348 0.0697378 0.485275
+-0.143381 0.074823 0.486453
+-0.0534567 -0.0227233 0.497018
+-0.110871 0.0955946 0.490958
+-0.107682 0.0976519 0.49137
+-0.099819 0.102622 0.492384
+
+
+-0.134045 -0.0847298 0.481378
+-0.143697 -0.0788865 0.480418
+-0.0534567 -0.0227233 0.497018
+-0.193869 0.0422877 0.478622
+-0.189533 0.0451238 0.479322
+
+
+-0.134045 -0.0847298 0.481378
+-0.143539 -0.180191 0.444216
+-0.0453426 -0.137689 0.487985
+-0.0564141 -0.131147 0.487364
+-0.0534567 -0.0227233 0.497018
+-0.196555 0.0271102 0.477763
+-0.196877 0.0363965 0.478003
+-0.196983 0.0402803 0.478107
+-0.193869 0.0422877 0.478622
+
+
+-0.134045 -0.0847298 0.481378
+-0.134033 -0.0847374 0.481379
+-0.0534567 -0.0227233 0.497018
+-0.196048 0.0116348 0.477301
+-0.196362 0.0203006 0.477555
+-0.196555 0.0271102 0.477763
+
+
+-0.037 0.195803 0.476765
+-0.0369937 0.190843 0.478923
+
+
+-0.0368096 0.231516 0.460987
+-0.0368109 0.236579 0.458711
+-0.178942 0.188749 0.427498
+-0.129295 0.0838696 0.488457
+
+
+0.0243281 0.118919 0.496439
+0.0234616 0.119282 0.496475
+
+
+0.152876 0.0630567 0.488285
+0.160493 0.0596975 0.487633
+
+
+0.302384 0.0945502 0.386885
+0.30251 0.0942781 0.386856
+
+
+0.302384 0.0945502 0.386885
+0.307326 0.109671 0.378987
+0.306786 0.109945 0.379341
+0.306661 0.128289 0.373608
+
+
+0.302384 0.0945502 0.386885
+0.301023 0.0968301 0.38736
+
+
+0.312997 0.0890272 0.379733
+0.310941 0.108858 0.376275
+0.310239 0.108898 0.376842
+0.309526 0.109017 0.377392
+0.309157 0.109119 0.377664
+0.307499 0.128283 0.372924
+
+
+0.220844 0.16658 0.42325
+0.145377 0.224646 0.422847
+0.215747 0.160522 0.428214
+
+
+0.295457 0.139033 0.378698
+0.302828 0.128314 0.376674
+
+
+0.345115 0.120558 0.342258
+0.347395 0.12273 0.339487
+0.335115 0.0786323 0.363201
+0.342488 0.117825 0.345513
+0.345115 0.120558 0.342258
+0.320839 0.118702 0.364692
+0.320709 0.118352 0.364924
+0.313907 0.128198 0.367526
+
+
+0.158838 0.399213 0.26189
+0.159427 0.400348 0.259926
+
+
+0.158838 0.399213 0.26189
+0.0840644 0.412413 0.270646
+0.038883 0.386045 0.31957
+0.0390331 0.381251 0.326344
+-0.00934473 0.41695 0.276524
+0.0117265 0.348518 0.371805
+0.0163559 0.350256 0.369472
+
+
+0.158838 0.399213 0.26189
+0.157581 0.396591 0.266353
+
+
+0.251417 0.156335 0.405763
+0.296551 0.141982 0.376773
+
+
+0.332732 0.108222 0.357327
+0.333642 0.10901 0.356267
+0.335115 0.0786323 0.363201
+0.338848 0.114193 0.349961
+0.340816 0.116261 0.347527
+0.342488 0.117825 0.345513
+
+
+0.332732 0.108222 0.357327
+0.319127 0.114 0.367729
+0.318919 0.113712 0.368003
+0.311779 0.128233 0.369348
+
+
+0.332732 0.108222 0.357327
+0.331645 0.107026 0.358662
+0.335115 0.0786323 0.363201
+0.335989 0.111345 0.353434
+0.337543 0.112998 0.351517
+0.338848 0.114193 0.349961
+
+
+0.322223 0.0979346 0.369591
+0.314977 0.109761 0.372623
+0.314324 0.109466 0.373266
+0.313747 0.109289 0.373807
+0.309142 0.128268 0.371567
+
+
+0.340045 0.0534971 0.362684
+0.340396 0.0538395 0.362301
+
+
+0.389606 0.150322 0.279208
+0.38619 0.156654 0.281352
+
+
+0.361486 0.0808148 0.33632
+0.361351 0.0813638 0.336331
+
+
+0.361369 0.208603 0.292431
+0.3607 0.211223 0.291922
+
+
+0.399165 0.132294 0.273117
+0.39685 0.136669 0.274627
+
+
+0.123621 0.386812 0.293502
+0.12404 0.386864 0.293278
+0.127516 0.351781 0.332251
+0.100668 0.323517 0.369247
+0.102233 0.322975 0.369246
+0.105038 0.280323 0.400982
+0.164635 0.301305 0.367129
+0.171632 0.298811 0.366765
+0.174963 0.297573 0.366628
+
+
+0.123621 0.386812 0.293502
+0.0840644 0.412413 0.270646
+0.0391666 0.379033 0.329461
+0.0393704 0.372733 0.338318
+-0.00934473 0.41695 0.276524
+0.0209059 0.354689 0.363397
+
+
+0.123621 0.386812 0.293502
+0.119381 0.386185 0.295896
+0.127516 0.351781 0.332251
+0.105798 0.321821 0.369162
+0.10728 0.321302 0.369158
+0.105038 0.280323 0.400982
+0.156132 0.30436 0.367522
+0.161929 0.30231 0.36723
+0.164635 0.301305 0.367129
+
+
+0.0518021 0.497025 0.0175813
+0.0505584 0.497185 0.0164118
+
+
+0.239881 0.433073 -0.0992228
+0.234282 0.435748 -0.0987217
+
+
+0.0754526 0.435343 0.235198
+0.071963 0.435223 0.236483
+0.0566727 0.45453 0.201473
+0.017733 0.44143 0.236617
+0.0171229 0.441671 0.236228
+0.0134522 0.443195 0.233735
+
+
+0.0754526 0.435343 0.235198
+0.0840644 0.412413 0.270646
+0.043059 0.373108 0.336834
+
+
+0.0754526 0.435343 0.235198
+0.0759218 0.435369 0.235005
+0.0566727 0.45453 0.201473
+0.0301757 0.436188 0.244937
+0.0295676 0.436437 0.244554
+0.0260136 0.43796 0.242164
+
+
+-0.0468077 -0.335094 -0.379672
+-0.0364904 -0.336293 -0.377833
+0.0542157 -0.290746 -0.403643
+0.0882309 -0.349044 -0.352901
+0.091988 -0.349376 -0.352038
+0.0988651 -0.349898 -0.350523
+
+
+-0.0468077 -0.335094 -0.379672
+0.0259521 -0.389689 -0.312841
+0.0606703 -0.408056 -0.283968
+0.0550739 -0.408786 -0.283737
+0.0339636 -0.431711 -0.250744
+0.0759644 -0.493971 -0.126273
+0.0725105 -0.495434 -0.124087
+0.183592 -0.464325 -0.0331205
+0.0101418 -0.521036 -0.0850383
+0.00480079 -0.523178 -0.0817001
+-0.000552172 -0.526125 -0.0683407
+
+
+-0.0468077 -0.335094 -0.379672
+-0.0537001 -0.334231 -0.380946
+0.0542157 -0.290746 -0.403643
+0.0789729 -0.348279 -0.354948
+0.0822737 -0.34858 -0.354196
+0.0882309 -0.349044 -0.352901
+
+
+0.122583 0.436303 0.217094
+0.0566727 0.45453 0.201473
+0.0344616 0.434345 0.247784
+0.0338305 0.434606 0.247387
+0.0301757 0.436188 0.244937
+
+
+0.122583 0.436303 0.217094
+0.121358 0.436279 0.217592
+0.113237 0.436194 0.220729
+0.0566727 0.45453 0.201473
+0.0398989 0.433556 0.248164
+0.0391539 0.433499 0.24845
+0.0367383 0.433349 0.249305
+0.0344616 0.434345 0.247784
+
+
+0.122583 0.436303 0.217094
+0.133037 0.436392 0.213038
+0.0840644 0.412413 0.270646
+0.0548243 0.375278 0.330672
+
+
+-0.04389 0.264492 0.443304
+-0.0431771 0.262568 0.444465
+-0.178942 0.188749 0.427498
+-0.118537 0.0907379 0.489932
+-0.110871 0.0955946 0.490958
+
+
+0.0212946 0.439935 0.239028
+0.017733 0.44143 0.236617
+
+
+0.0212946 0.439935 0.239028
+-0.00934473 0.41695 0.276524
+0.0280142 0.361536 0.35395
+
+
+0.0212946 0.439935 0.239028
+0.0218926 0.439696 0.239408
+
+
+0.37194 0.369063 -0.0688841
+0.368807 0.371713 -0.0768098
+0.367201 0.372165 -0.0827889
+
+
+0.37194 0.369063 -0.0688841
+0.242498 0.434148 0.0557766
+0.218017 0.439358 0.102626
+0.214045 0.44136 0.103304
+0.211949 0.442427 0.103598
+
+
+0.37194 0.369063 -0.0688841
+0.373411 0.367803 -0.0651953
+0.447098 0.198695 -0.104717
+
+
+0.173221 0.463618 -0.0934847
+0.168408 0.465721 -0.0930228
+
+
+0.222926 0.441102 -0.0978001
+0.218235 0.443302 -0.097371
+
+
+-0.0222684 0.438716 -0.271996
+-0.015516 0.442649 -0.264755
+
+
+0.294923 0.136555 0.379994
+0.301574 0.128317 0.377661
+
+
+0.348473 0.379843 -0.10808
+0.327021 0.39049 -0.106292
+
+
+-0.103025 0.488797 -0.0679193
+-0.0968002 0.488934 -0.0723537
+-0.0248719 0.498374 -0.0374832
+-0.0145563 0.500371 0.00615309
+-0.0160939 0.500355 0.00755006
+-0.0185246 0.500325 0.00959594
+
+
+-0.103025 0.488797 -0.0679193
+-0.104262 0.466121 -0.149203
+-0.121658 0.488297 -0.0545358
+-0.113353 0.488542 -0.0604767
+-0.0248719 0.498374 -0.0374832
+-0.0109757 0.500396 0.00304674
+-0.0123708 0.500388 0.00431943
+-0.0145563 0.500371 0.00615309
+
+
+-0.103025 0.488797 -0.0679193
+-0.10453 0.488767 -0.0668119
+-0.0248719 0.498374 -0.0374832
+-0.00766842 0.500403 0.000177585
+-0.00896365 0.500402 0.00136332
+-0.0109757 0.500396 0.00304674
+
+
+-0.0434019 0.313521 0.409064
+-0.156068 0.355593 0.31559
+-0.23895 0.273626 0.35908
+-0.230677 0.274633 0.362332
+-0.178942 0.188749 0.427498
+-0.107682 0.0976519 0.49137
+
+
+-0.199476 0.389866 0.250076
+-0.203051 0.384899 0.254089
+-0.272468 0.359184 0.217136
+-0.248213 0.318875 0.305072
+-0.249353 0.317117 0.306394
+-0.254694 0.309023 0.312374
+
+
+-0.199476 0.389866 0.250076
+-0.156068 0.355593 0.31559
+-0.226074 0.275229 0.364104
+-0.218674 0.276113 0.366989
+-0.178942 0.188749 0.427498
+-0.0965154 0.104747 0.492796
+
+
+-0.199476 0.389866 0.250076
+-0.198606 0.3911 0.249059
+-0.272468 0.359184 0.217136
+-0.242691 0.32722 0.298849
+-0.243674 0.325711 0.299991
+-0.248213 0.318875 0.305072
+
+
+0.0500016 -0.409431 -0.283523
+0.0455812 -0.409984 -0.283322
+0.0339636 -0.431711 -0.250744
+0.0633589 -0.499254 -0.118398
+0.0595943 -0.50083 -0.116015
+0.183592 -0.464325 -0.0331205
+0.0290863 -0.513367 -0.0969157
+0.0158291 -0.518731 -0.0886407
+0.0101418 -0.521036 -0.0850383
+
+
+0.0500016 -0.409431 -0.283523
+0.0259521 -0.389689 -0.312841
+0.0549873 -0.408796 -0.283736
+0.0500786 -0.409423 -0.283523
+0.0339636 -0.431711 -0.250744
+0.0495056 -0.504996 -0.109735
+0.0453041 -0.506735 -0.107074
+0.183592 -0.464325 -0.0331205
+0.20679 -0.435053 -0.20736
+0.19459 -0.440811 -0.19987
+
+
+0.0500016 -0.409431 -0.283523
+0.0500786 -0.409423 -0.283523
+
+
+-0.178544 0.39219 -0.265069
+-0.17249 0.391612 -0.27145
+
+
+-0.178544 0.39219 -0.265069
+-0.251823 0.344488 -0.260811
+
+
+-0.178544 0.39219 -0.265069
+-0.180706 0.39242 -0.26274
+-0.164923 0.436861 -0.17987
+-0.143315 0.455129 -0.150807
+-0.14392 0.455329 -0.149697
+
+
+0.136121 -0.433228 0.214184
+0.135842 -0.433484 0.213925
+0.141621 -0.397458 0.269018
+0.154796 -0.381072 0.284358
+0.155019 -0.38121 0.284048
+0.156012 -0.382238 0.282095
+
+
+0.136121 -0.433228 0.214184
+0.188392 -0.407542 0.220419
+0.188492 -0.407163 0.22105
+0.188634 -0.406789 0.221632
+0.188814 -0.406421 0.222167
+0.189026 -0.40606 0.222658
+0.189222 -0.405774 0.223024
+0.203124 -0.406095 0.209424
+
+
+0.136121 -0.433228 0.214184
+0.141998 -0.427661 0.219914
+0.141621 -0.397458 0.269018
+0.153424 -0.379752 0.286899
+0.153665 -0.379918 0.286544
+0.154796 -0.381072 0.284358
+
+
+0.336728 -0.367525 -0.144454
+0.337845 -0.367098 -0.142197
+
+
+-0.323934 0.38395 0.0995406
+-0.317635 0.388011 0.101004
+-0.272468 0.359184 0.217136
+-0.229425 0.347012 0.283888
+-0.230164 0.345896 0.284754
+
+
+-0.323934 0.38395 0.0995406
+-0.263681 0.425199 -0.00886505
+-0.413527 0.324544 0.0452798
+-0.410392 0.326713 0.0559613
+-0.464303 0.153517 0.106091
+-0.438644 0.152397 0.20141
+-0.439868 0.146155 0.204509
+-0.440559 0.142702 0.206173
+
+
+-0.323934 0.38395 0.0995406
+-0.329088 0.3806 0.0983942
+-0.272468 0.359184 0.217136
+-0.225609 0.35262 0.279582
+-0.226313 0.351566 0.280407
+-0.229425 0.347012 0.283888
+
+
+0.147953 0.390175 0.279649
+0.148661 0.390259 0.279255
+0.127516 0.351781 0.332251
+0.110694 0.320189 0.369067
+0.112128 0.319682 0.369058
+0.105038 0.280323 0.400982
+0.14888 0.306948 0.36784
+0.15385 0.305205 0.3676
+0.156132 0.30436 0.367522
+
+
+0.147953 0.390175 0.279649
+0.0840644 0.412413 0.270646
+0.064069 0.376964 0.325812
+
+
+0.147953 0.390175 0.279649
+0.141122 0.389247 0.283576
+0.127516 0.351781 0.332251
+0.115462 0.318585 0.368959
+0.116876 0.318081 0.368947
+0.105038 0.280323 0.400982
+0.131452 0.313079 0.368514
+0.135134 0.311823 0.368361
+0.13676 0.311227 0.368325
+
+
+0.353605 0.286994 0.245692
+0.353798 0.291908 0.23927
+
+
+0.00828435 0.44529 0.230265
+-0.00934473 0.41695 0.276524
+0.0341311 0.367403 0.345791
+
+
+-0.0753042 0.383177 0.319039
+-0.156068 0.355593 0.31559
+-0.214505 0.276644 0.368579
+-0.207723 0.277437 0.371201
+-0.178942 0.188749 0.427498
+-0.0848001 0.112173 0.494238
+
+
+-0.153599 0.475212 -0.0742317
+-0.152288 0.475926 -0.0728563
+
+
+-0.239251 0.439119 -0.00315212
+-0.239443 0.439001 -0.00388821
+-0.224704 0.446302 -0.0268837
+-0.238308 0.439677 -0.000632618
+-0.239251 0.439119 -0.00315212
+-0.263681 0.425199 -0.00886505
+-0.408383 0.328101 0.0626645
+-0.405195 0.330251 0.073393
+-0.464303 0.153517 0.106091
+-0.436848 0.161318 0.197006
+-0.438001 0.155552 0.199884
+-0.438644 0.152397 0.20141
+
+
+-0.24205 0.437392 -0.0112013
+-0.263681 0.425199 -0.00886505
+-0.403134 0.331641 0.0801896
+-0.402814 0.331851 0.0812545
+-0.402649 0.32652 0.0908528
+-0.402635 0.325975 0.0918204
+-0.464303 0.153517 0.106091
+-0.435126 0.169706 0.192846
+-0.436235 0.164265 0.195575
+-0.436848 0.161318 0.197006
+
+
+0.160669 0.438983 0.196853
+0.0566727 0.45453 0.201473
+0.0457296 0.433912 0.246072
+0.045081 0.433863 0.246324
+0.0398989 0.433556 0.248164
+
+
+0.332318 0.262343 0.294782
+0.326713 0.262242 0.299634
+0.219585 0.354976 0.275998
+0.231462 0.274956 0.360971
+0.239457 0.270008 0.360658
+0.145377 0.224646 0.422847
+0.225959 0.172667 0.41822
+
+
+0.332318 0.262343 0.294782
+0.308263 0.146825 0.365412
+
+
+0.332318 0.262343 0.294782
+0.339211 0.262522 0.288747
+
+
+-0.0217484 -0.139111 0.490248
+-0.0300249 -0.143229 0.489077
+-0.0327522 -0.144552 0.488694
+-0.0534567 -0.0227233 0.497018
+-0.195545 -0.00304294 0.47681
+-0.195857 0.00521306 0.477082
+-0.196048 0.0116348 0.477301
+
+
+0.182557 0.341796 0.318229
+0.127516 0.351781 0.332251
+0.120195 0.31698 0.368838
+0.121617 0.316469 0.368821
+0.105038 0.280323 0.400982
+0.126442 0.314813 0.368678
+0.129929 0.313634 0.368543
+0.131452 0.313079 0.368514
+
+
+0.400504 0.208518 0.221466
+0.396126 0.2143 0.225618
+
+
+0.144479 0.192952 0.438325
+0.145563 0.191875 0.438478
+
+
+0.30773 0.146984 0.365801
+0.309193 0.128274 0.371522
+
+
+0.464859 -0.0658773 0.199199
+0.465149 -0.0601106 0.198591
+
+
+0.487229 0.151531 0.0446161
+0.490384 0.143141 0.045691
+0.434716 0.190815 0.158152
+0.493246 0.12315 0.062342
+0.494336 0.125248 0.0562989
+
+
+0.487229 0.151531 0.0446161
+0.46309 0.171138 -0.0812746
+
+
+0.487229 0.151531 0.0446161
+0.485577 0.15589 0.0440989
+0.434716 0.190815 0.158152
+0.463068 0.213525 0.0368126
+0.464699 0.209468 0.0373036
+0.467664 0.202031 0.038278
+
+
+0.242356 0.423798 0.108767
+0.245333 0.413089 0.139891
+0.201139 0.410348 0.213249
+0.200392 0.410754 0.213294
+0.192311 0.415204 0.213652
+
+
+0.289006 0.128252 0.387391
+0.288636 0.12831 0.387656
+0.294606 0.131795 0.381892
+
+
+0.289006 0.128252 0.387391
+0.295706 0.124941 0.383343
+0.295731 0.125194 0.383241
+0.298194 0.128279 0.38031
+
+
+0.289006 0.128252 0.387391
+0.29297 0.128334 0.384323
+
+
+0.368807 0.371713 -0.0768098
+0.348113 0.382734 -0.06315
+0.204528 0.456279 -0.0194397
+0.225566 0.446512 0.0174995
+0.228354 0.445173 0.0157273
+0.242498 0.434148 0.0557766
+0.22329 0.436669 0.101775
+0.219822 0.43843 0.102375
+0.218017 0.439358 0.102626
+
+
+0.249908 0.428264 -0.100056
+0.243556 0.431323 -0.0994938
+
+
+0.125642 0.485574 0.0842163
+0.119084 0.486521 0.0837848
+0.058974 0.496872 -0.00641194
+0.10054 0.489378 0.0715313
+0.111022 0.487658 0.0833264
+0.110923 0.487666 0.0833396
+0.0272388 0.499148 0.0225842
+0.0767983 0.490161 0.0882176
+0.0690334 0.490674 0.0893314
+0.0680628 0.490739 0.0894541
+
+
+0.125642 0.485574 0.0842163
+0.0451587 0.471195 0.162285
+-0.0167111 0.460736 0.200801
+-0.022236 0.460477 0.202402
+
+
+0.125642 0.485574 0.0842163
+0.133505 0.484441 0.0846479
+
+
+0.127981 0.482925 -0.0893491
+0.126827 0.483406 -0.0892516
+0.128 0.483755 -0.0771729
+0.058974 0.496872 -0.00641194
+0.133246 0.48477 -0.0217294
+0.133275 0.48477 -0.0214586
+
+
+0.130163 0.484299 -0.0547569
+0.131002 0.484472 -0.0458646
+0.058974 0.496872 -0.00641194
+0.130125 0.484293 -0.0551048
+0.130163 0.484299 -0.0547569
+0.204528 0.456279 -0.0194397
+0.228922 0.4449 0.0153308
+0.231772 0.443515 0.0135141
+0.242498 0.434148 0.0557766
+0.227998 0.434249 0.101011
+0.224888 0.43584 0.101556
+0.22329 0.436669 0.101775
+
+
+-0.13956 0.482826 -0.0592068
+-0.141089 0.482011 -0.0608111
+
+
+0.0301554 0.499131 -0.00624809
+0.0284093 0.499242 -0.00802545
+
+
+-0.202767 0.352364 -0.295021
+-0.211095 0.347691 -0.29345
+-0.250076 0.305099 -0.307859
+-0.242748 0.329849 -0.287134
+-0.243601 0.329394 -0.286915
+-0.245703 0.328142 -0.286516
+
+
+-0.202767 0.352364 -0.295021
+-0.253932 0.340619 -0.263942
+
+
+-0.202767 0.352364 -0.295021
+-0.198887 0.354477 -0.295821
+-0.250076 0.305099 -0.307859
+-0.239483 0.331722 -0.287809
+-0.240432 0.331214 -0.287573
+-0.242748 0.329849 -0.287134
+
+
+0.204528 0.456279 -0.0194397
+0.232359 0.44323 0.0131044
+0.23533 0.44177 0.0112045
+0.242498 0.434148 0.0557766
+0.232303 0.432016 0.100307
+0.229448 0.433489 0.100813
+0.227998 0.434249 0.101011
+
+
+0.204528 0.456279 -0.0194397
+0.235949 0.441465 0.010773
+0.239112 0.439895 0.00874405
+0.242498 0.434148 0.0557766
+0.236604 0.430098 0.0976851
+0.240246 0.428555 0.094906
+0.270737 0.406813 0.107727
+0.259544 0.408677 0.124986
+0.258969 0.409025 0.12504
+0.258363 0.409791 0.123778
+
+
+0.204528 0.456279 -0.0194397
+0.239778 0.439563 0.00828001
+0.24322 0.437836 0.00606457
+0.242498 0.434148 0.0557766
+0.240399 0.428493 0.0947775
+0.243574 0.427133 0.0923486
+0.270737 0.406813 0.107727
+0.260748 0.407526 0.126233
+0.260226 0.407872 0.126193
+0.259544 0.408677 0.124986
+
+
+0.204528 0.456279 -0.0194397
+0.243955 0.437466 0.00555431
+0.247792 0.435522 0.00307579
+0.242498 0.434148 0.0557766
+0.243709 0.427077 0.0922337
+0.246551 0.425845 0.090053
+0.270737 0.406813 0.107727
+0.262013 0.406314 0.127523
+0.261533 0.406663 0.127393
+0.260748 0.407526 0.126233
+
+
+0.204528 0.456279 -0.0194397
+0.248624 0.435099 0.00250053
+0.25302 0.432852 -0.000348473
+0.242498 0.434148 0.0557766
+0.246673 0.425795 0.0899477
+0.249279 0.424652 0.0879424
+0.270737 0.406813 0.107727
+0.263366 0.405012 0.128882
+0.262905 0.405375 0.128678
+0.262013 0.406314 0.127523
+
+
+0.204528 0.456279 -0.0194397
+0.253989 0.432355 -0.00101576
+0.259184 0.429676 -0.00439413
+0.242498 0.434148 0.0557766
+0.249391 0.424605 0.0878438
+0.251834 0.42352 0.0859584
+0.270737 0.406813 0.107727
+0.264842 0.403586 0.130349
+0.264375 0.403976 0.13008
+0.263366 0.405012 0.128882
+
+
+0.204528 0.456279 -0.0194397
+0.260352 0.429072 -0.00519446
+0.266724 0.425761 -0.00935124
+0.242498 0.434148 0.0557766
+0.25194 0.423476 0.0858642
+0.254277 0.422425 0.0840546
+0.270737 0.406813 0.107727
+0.270583 0.39797 0.13601
+0.269946 0.398562 0.135494
+0.268367 0.400149 0.133829
+
+
+0.204528 0.456279 -0.0194397
+0.268189 0.424998 -0.0103508
+0.276371 0.420717 -0.0157036
+0.242498 0.434148 0.0557766
+0.254379 0.422382 0.0839629
+0.256658 0.421344 0.082191
+0.270737 0.406813 0.107727
+0.281427 0.387175 0.146687
+0.280073 0.388498 0.14545
+
+
+0.204528 0.456279 -0.0194397
+0.278305 0.419703 -0.0170173
+0.289451 0.413837 -0.0243283
+0.242498 0.434148 0.0557766
+0.256759 0.4213 0.0821003
+0.259026 0.420255 0.0803312
+0.270737 0.406813 0.107727
+0.28828 0.380297 0.153439
+0.286252 0.382302 0.151541
+0.281427 0.387175 0.146687
+
+
+0.204528 0.456279 -0.0194397
+0.292184 0.412397 -0.026176
+0.308654 0.403685 -0.0370053
+0.242498 0.434148 0.0557766
+0.259127 0.420211 0.0802398
+0.261426 0.419138 0.0784389
+0.270737 0.406813 0.107727
+0.299575 0.368925 0.164571
+0.296086 0.372402 0.161247
+0.28828 0.380297 0.153439
+
+
+0.204528 0.456279 -0.0194397
+0.312905 0.401433 -0.0398667
+0.340413 0.386827 -0.0579911
+0.242498 0.434148 0.0557766
+0.26153 0.419092 0.0783452
+0.263907 0.41797 0.0764755
+0.270737 0.406813 0.107727
+0.322378 0.345909 0.187055
+0.314725 0.353588 0.179657
+0.299575 0.368925 0.164571
+
+
+0.204528 0.456279 -0.0194397
+0.360583 0.373972 -0.106955
+
+
+0.204528 0.456279 -0.0194397
+0.128049 0.483766 -0.076718
+0.129139 0.484059 -0.0653978
+0.058974 0.496872 -0.00641194
+0.057554 0.490388 -0.13149
+0.0536467 0.491395 -0.121101
+-0.0248719 0.498374 -0.0374832
+-0.00454678 0.500394 -0.00253039
+-0.00577545 0.5004 -0.00140256
+-0.00766842 0.500403 0.000177585
+
+
+0.204528 0.456279 -0.0194397
+0.129182 0.484068 -0.0650056
+0.130125 0.484293 -0.0551048
+
+
+0.204528 0.456279 -0.0194397
+0.131037 0.484477 -0.0455483
+0.1318 0.484607 -0.0373696
+
+
+0.204528 0.456279 -0.0194397
+0.132572 0.484706 -0.0291072
+0.133246 0.48477 -0.0217294
+
+
+0.257772 0.355888 -0.272041
+0.273683 0.346719 -0.276583
+
+
+0.379953 0.362157 -0.0485339
+0.447115 0.198735 -0.104554
+
+
+0.379953 0.362157 -0.0485339
+0.378546 0.363384 -0.0520927
+0.373411 0.367803 -0.0651953
+
+
+0.379953 0.362157 -0.0485339
+0.38491 0.357814 -0.0357701
+0.242498 0.434148 0.0557766
+0.264015 0.41792 0.0763777
+0.266524 0.416722 0.0743964
+0.270737 0.406813 0.107727
+0.374189 0.319418 0.151368
+0.373575 0.319347 0.153137
+
+
+0.447201 0.198818 -0.103975
+0.400237 0.340927 -0.00280012
+0.400626 0.340463 -0.00201021
+0.270737 0.406813 0.107727
+0.378797 0.319846 0.138217
+0.378192 0.319781 0.139979
+0.374189 0.319418 0.151368
+
+
+0.239778 0.439563 0.00828001
+0.239112 0.439895 0.00874405
+
+
+0.312905 0.401433 -0.0398667
+0.308654 0.403685 -0.0370053
+
+
+0.265991 0.402421 0.131639
+0.264842 0.403586 0.130349
+
+
+0.265991 0.402421 0.131639
+0.245333 0.413089 0.139891
+0.209075 0.40595 0.212872
+0.208396 0.406322 0.212915
+0.201139 0.410348 0.213249
+
+
+0.265991 0.402421 0.131639
+0.266487 0.401988 0.131975
+
+
+0.170396 0.422665 0.220808
+0.171393 0.424602 0.21733
+0.219585 0.354976 0.275998
+0.242786 0.267973 0.360496
+0.251706 0.262424 0.360118
+0.145377 0.224646 0.422847
+0.230162 0.179451 0.413144
+0.229218 0.176535 0.414993
+
+
+0.170396 0.422665 0.220808
+0.0840644 0.412413 0.270646
+0.0716545 0.378329 0.321806
+0.0722523 0.378426 0.321502
+0.127516 0.351781 0.332251
+0.124986 0.31534 0.3687
+0.126442 0.314813 0.368678
+
+
+0.170396 0.422665 0.220808
+0.168365 0.418477 0.22823
+0.219585 0.354976 0.275998
+0.265532 0.260357 0.35175
+0.260192 0.260122 0.356212
+
+
+0.167549 0.369002 0.295211
+0.127516 0.351781 0.332251
+0.129929 0.313634 0.368543
+
+
+0.392548 0.219098 0.228929
+0.38634 0.227274 0.234777
+
+
+0.449893 0.138903 0.172003
+0.452048 0.135658 0.169611
+
+
+0.432887 0.164149 0.190084
+0.43408 0.162464 0.188827
+
+
+0.506011 0.0787134 -0.00128689
+0.506317 0.0770826 -0.00286165
+
+
+0.506011 0.0787134 -0.00128689
+0.463245 0.170454 -0.0818581
+
+
+0.506011 0.0787134 -0.00128689
+0.504592 0.0861595 0.00603911
+
+
+0.505967 0.0451262 -0.0703674
+0.46327 0.170054 -0.082521
+
+
+0.459965 0.221218 0.035801
+0.463068 0.213525 0.0368126
+
+
+0.459965 0.221218 0.035801
+0.462783 0.172107 -0.0808535
+
+
+0.459965 0.221218 0.035801
+0.458242 0.225457 0.0352851
+0.434716 0.190815 0.158152
+0.453072 0.238097 0.0336604
+0.45493 0.233576 0.0342141
+0.458242 0.225457 0.0352851
+
+
+0.443394 0.261437 0.0306143
+0.447417 0.251779 0.0318949
+0.434716 0.190815 0.158152
+0.433822 0.283665 0.0284206
+
+
+0.443394 0.261437 0.0306143
+0.462494 0.172895 -0.0807078
+
+
+0.443394 0.261437 0.0306143
+0.441086 0.266942 0.0299311
+
+
+0.45034 0.210493 -0.0600875
+0.449567 0.21414 -0.0555116
+0.447825 0.198503 -0.101574
+
+
+0.45034 0.210493 -0.0600875
+0.461783 0.174622 -0.0807628
+
+
+0.45034 0.210493 -0.0600875
+0.450983 0.207195 -0.0645204
+0.448025 0.198321 -0.100955
+
+
+0.449463 0.246851 0.0325025
+0.453072 0.238097 0.0336604
+
+
+0.449463 0.246851 0.0325025
+0.462606 0.172598 -0.0807467
+
+
+0.449463 0.246851 0.0325025
+0.447417 0.251779 0.0318949
+
+
+0.434908 0.161231 0.188001
+0.436122 0.159501 0.18671
+
+
+0.453688 0.133111 0.167842
+0.456321 0.129114 0.164904
+
+
+0.446695 0.143752 0.175485
+0.448525 0.141018 0.173464
+
+
+0.477039 -0.0490361 -0.142011
+0.476618 -0.05067 -0.142777
+
+
+0.49074 0.118269 0.0761416
+0.489354 0.115561 0.0836888
+
+
+0.449387 -0.144574 -0.18107
+0.449895 -0.145269 -0.178838
+
+
+0.449387 -0.144574 -0.18107
+0.448855 -0.144532 -0.182511
+
+
+0.449387 -0.144574 -0.18107
+0.452315 -0.135059 -0.177152
+
+
+0.446831 -0.144445 -0.187895
+0.445475 -0.144336 -0.191525
+
+
+0.428452 0.193225 -0.179993
+0.427085 0.19731 -0.178406
+
+
+0.456947 0.169551 -0.112045
+0.456771 0.170934 -0.110519
+
+
+0.456947 0.169551 -0.112045
+0.461672 0.170999 -0.0884176
+
+
+0.456947 0.169551 -0.112045
+0.45707 0.167892 -0.114239
+0.449244 0.192461 -0.106558
+
+
+0.445959 0.155433 -0.175527
+0.44255 0.162225 -0.177547
+
+
+0.419342 0.219639 -0.169834
+0.418005 0.22344 -0.168322
+
+
+0.430914 0.185863 -0.182785
+0.429468 0.190237 -0.181097
+
+
+0.457273 0.166127 -0.116245
+0.45707 0.167892 -0.114239
+
+
+0.457273 0.166127 -0.116245
+0.462019 0.170592 -0.0875331
+
+
+0.457273 0.166127 -0.116245
+0.457449 0.163876 -0.119149
+
+
+0.453424 0.14036 -0.171009
+0.449693 0.147931 -0.173279
+
+
+0.40914 0.247767 -0.15876
+0.407345 0.252631 -0.156789
+
+
+0.447245 0.198829 -0.103744
+0.407265 0.332484 0.0113582
+0.407652 0.332015 0.0121515
+0.270737 0.406813 0.107727
+0.392895 0.320963 0.0971501
+0.392243 0.320906 0.099105
+0.388059 0.320612 0.11138
+
+
+0.26664 0.416669 0.0742925
+0.269345 0.415362 0.0721472
+0.270737 0.406813 0.107727
+0.398013 0.321298 0.0819452
+0.397316 0.321243 0.084053
+0.392895 0.320963 0.0971501
+
+
+0.26664 0.416669 0.0742925
+0.242498 0.434148 0.0557766
+0.269472 0.415303 0.0720343
+0.272459 0.413845 0.0696565
+0.270737 0.406813 0.107727
+0.403548 0.321624 0.0653387
+0.402786 0.321569 0.0676633
+0.398013 0.321298 0.0819452
+
+
+0.26664 0.416669 0.0742925
+0.266524 0.416722 0.0743964
+
+
+0.398057 0.277183 -0.146968
+0.395157 0.284803 -0.143851
+
+
+0.414329 0.32388 0.0257042
+0.414722 0.323398 0.026516
+0.270737 0.406813 0.107727
+0.409683 0.321946 0.0467619
+0.408829 0.32189 0.0493903
+0.403548 0.321624 0.0653387
+
+
+0.414329 0.32388 0.0257042
+0.447298 0.198827 -0.103488
+
+
+0.414329 0.32388 0.0257042
+0.407652 0.332015 0.0121515
+
+
+0.386219 0.307935 -0.134513
+0.3814 0.320396 -0.129395
+
+
+0.402337 0.265922 -0.151501
+0.39994 0.272279 -0.148907
+
+
+0.414583 0.232926 -0.164633
+0.413097 0.237046 -0.162978
+
+
+0.421603 0.213207 -0.17233
+0.420298 0.216966 -0.170842
+
+
+0.449589 0.148139 -0.173345
+0.446059 0.155237 -0.175464
+
+
+0.453798 0.183462 -0.10213
+0.454919 0.181629 -0.100324
+0.455399 0.181004 -0.0992488
+
+
+0.457568 0.131882 -0.168454
+0.453535 0.140137 -0.170938
+
+
+0.377361 0.330716 -0.125241
+0.370568 0.348164 -0.118066
+
+
+0.423846 0.206746 -0.174822
+0.422546 0.210537 -0.173331
+
+
+0.435526 0.176012 -0.181635
+0.432073 0.1827 -0.183601
+
+
+0.308785 -0.396525 -0.0189622
+0.307852 -0.397244 -0.0169004
+
+
+0.136713 0.484644 0.0173408
+0.136681 0.484649 0.0170307
+
+
+0.318844 -0.388556 -0.0420835
+0.31762 -0.389542 -0.0393193
+
+
+0.283941 -0.387152 -0.245103
+0.357767 -0.188178 -0.294729
+0.357955 -0.188034 -0.294601
+0.348515 -0.181237 -0.309348
+
+
+-0.14884 -0.377218 -0.331603
+-0.148397 -0.381016 -0.326914
+-0.156658 -0.383201 -0.314778
+-0.153551 -0.446874 -0.1647
+-0.124941 -0.474983 -0.106532
+-0.12205 -0.476262 -0.10543
+-0.11434 -0.479617 -0.102664
+
+
+-0.14884 -0.377218 -0.331603
+-0.290413 -0.331313 -0.237261
+-0.257074 -0.382219 -0.201015
+-0.257385 -0.382164 -0.200713
+-0.225451 -0.420597 -0.150567
+-0.226114 -0.434726 -0.103592
+-0.224188 -0.435342 -0.104886
+-0.221984 -0.436015 -0.106471
+
+
+-0.14884 -0.377218 -0.331603
+-0.149518 -0.370803 -0.339519
+0.0259521 -0.389689 -0.312841
+0.045511 -0.409991 -0.283322
+0.0414352 -0.410488 -0.283129
+0.0339636 -0.431711 -0.250744
+0.0339011 -0.511395 -0.0999656
+0.0290863 -0.513367 -0.0969157
+
+
+-0.0807325 0.116316 -0.487009
+-0.0855334 0.119025 -0.48524
+-0.156562 0.0450098 -0.473141
+-0.219466 -0.0236923 -0.454852
+-0.218966 -0.0257327 -0.455162
+-0.216657 -0.0346669 -0.456562
+
+
+-0.0807325 0.116316 -0.487009
+-0.0533786 0.210915 -0.450628
+-0.0915982 0.364137 -0.366449
+-0.0834398 0.374635 -0.362066
+-0.250076 0.305099 -0.307859
+-0.235782 0.333832 -0.288563
+-0.236867 0.33325 -0.288303
+-0.239483 0.331722 -0.287809
+
+
+-0.0807325 0.116316 -0.487009
+-0.0765749 0.113902 -0.488549
+-0.156562 0.0450098 -0.473141
+-0.221955 -0.0139027 -0.453296
+-0.221509 -0.0157423 -0.453581
+-0.219466 -0.0236923 -0.454852
+
+
+-0.380852 -0.302974 0.12694
+-0.382659 -0.303405 0.121041
+-0.413046 -0.239792 0.149308
+-0.376417 -0.239595 0.238098
+-0.375327 -0.241555 0.237917
+-0.371804 -0.247961 0.237236
+
+
+-0.380852 -0.302974 0.12694
+-0.32754 -0.35453 0.132009
+-0.30211 -0.368499 0.152238
+-0.302687 -0.368646 0.150597
+-0.30388 -0.36876 0.147689
+
+
+-0.380852 -0.302974 0.12694
+-0.380451 -0.302853 0.128292
+-0.413046 -0.239792 0.149308
+-0.380914 -0.231374 0.238926
+-0.379843 -0.233315 0.238752
+-0.376417 -0.239595 0.238098
+
+
+0.260883 -0.232494 0.359986
+0.27822 -0.176201 0.376759
+0.174557 -0.222099 0.425302
+0.174981 -0.230794 0.420837
+0.0527917 -0.222753 0.444966
+0.00171085 -0.127494 0.493393
+
+
+-0.208161 -0.232581 -0.454529
+-0.207107 -0.224045 -0.455701
+-0.296119 -0.00157042 -0.403375
+-0.364376 -0.119636 -0.345467
+-0.368844 -0.110179 -0.342412
+-0.433806 -0.126861 -0.214754
+-0.499523 -0.184577 -0.0287832
+-0.501611 -0.179945 -0.0272039
+-0.413046 -0.239792 0.149308
+-0.385381 -0.223138 0.239736
+-0.38431 -0.225096 0.239564
+-0.380914 -0.231374 0.238926
+
+
+-0.208161 -0.232581 -0.454529
+-0.20468 -0.235626 -0.454553
+-0.199669 -0.239964 -0.454593
+-0.0433918 -0.0459736 -0.496391
+0.0407922 -0.168044 -0.48646
+0.0349441 -0.17016 -0.485803
+0.0542157 -0.290746 -0.403643
+0.0706913 -0.347575 -0.356758
+0.0736677 -0.347856 -0.356086
+0.0789729 -0.348279 -0.354948
+
+
+-0.208161 -0.232581 -0.454529
+-0.227151 -0.22626 -0.441333
+-0.296119 -0.00157042 -0.403375
+-0.370596 -0.106401 -0.341216
+-0.374752 -0.0975395 -0.338329
+-0.433806 -0.126861 -0.214754
+-0.507637 -0.166482 -0.0227077
+-0.509792 -0.161647 -0.0210613
+-0.413046 -0.239792 0.149308
+-0.389904 -0.214728 0.240543
+-0.388812 -0.216743 0.240371
+-0.385381 -0.223138 0.239736
+
+
+-0.283643 -0.393725 -0.129542
+-0.283636 -0.393752 -0.129478
+-0.225451 -0.420597 -0.150567
+-0.230692 -0.433278 -0.100392
+-0.228545 -0.433973 -0.101844
+-0.226114 -0.434726 -0.103592
+
+
+-0.283643 -0.393725 -0.129542
+-0.335423 -0.353515 -0.113662
+-0.40567 -0.318806 0.0116828
+-0.410992 -0.313589 0.0119082
+-0.32754 -0.35453 0.132009
+-0.299852 -0.368153 0.158012
+-0.300617 -0.368331 0.155903
+-0.30211 -0.368499 0.152238
+
+
+-0.283643 -0.393725 -0.129542
+-0.284178 -0.391282 -0.135585
+-0.225451 -0.420597 -0.150567
+-0.2359 -0.431608 -0.0967396
+-0.233441 -0.432412 -0.098413
+-0.230692 -0.433278 -0.100392
+
+
+0.270049 0.260504 0.347997
+0.265532 0.260357 0.35175
+
+
+0.270049 0.260504 0.347997
+0.303976 0.147494 0.368729
+
+
+0.270049 0.260504 0.347997
+0.275268 0.260722 0.343605
+0.219585 0.354976 0.275998
+0.284926 0.261058 0.335468
+0.279726 0.260855 0.339875
+0.275268 0.260722 0.343605
+
+
+-0.099709 0.412564 0.273537
+-0.156068 0.355593 0.31559
+-0.203859 0.277921 0.37266
+-0.197504 0.278647 0.375094
+-0.178942 0.188749 0.427498
+-0.0722523 0.120109 0.495727
+
+
+-0.019117 0.0109386 0.50031
+-0.0200383 0.0153271 0.500311
+
+
+0.253989 0.432355 -0.00101576
+0.25302 0.432852 -0.000348473
+
+
+0.0503086 0.434168 0.244439
+0.0457296 0.433912 0.246072
+
+
+0.0503086 0.434168 0.244439
+0.0840644 0.412413 0.270646
+0.0781027 0.379474 0.318385
+0.0786204 0.379555 0.318121
+0.127516 0.351781 0.332251
+0.135134 0.311823 0.368361
+
+
+0.0503086 0.434168 0.244439
+0.0508888 0.43421 0.244211
+0.0566727 0.45453 0.201473
+0.0555703 0.434466 0.242514
+0.0550388 0.434428 0.242725
+0.0508888 0.43421 0.244211
+
+
+0.0618323 0.462876 0.178735
+0.0598407 0.462938 0.179231
+0.0451587 0.471195 0.162285
+0.00103074 0.461458 0.195901
+-0.00213614 0.461304 0.196841
+-0.0167111 0.460736 0.200801
+
+
+0.0618323 0.462876 0.178735
+0.0566727 0.45453 0.201473
+0.0599167 0.434689 0.240928
+0.0594188 0.434655 0.241128
+0.0555703 0.434466 0.242514
+
+
+0.0618323 0.462876 0.178735
+0.0623989 0.462904 0.178474
+0.0451587 0.471195 0.162285
+0.0121075 0.461892 0.192833
+0.0100273 0.461788 0.19347
+0.00103074 0.461458 0.195901
+
+
+0.141202 0.483532 0.0710089
+0.145334 0.48178 0.0684178
+
+
+0.193985 0.320232 0.335713
+0.127516 0.351781 0.332251
+0.146895 0.307681 0.3679
+0.14888 0.306948 0.36784
+
+
+0.378192 0.319781 0.139979
+0.434716 0.190815 0.158152
+0.425467 0.3015 0.0284505
+0.423737 0.305177 0.0284343
+0.447364 0.19881 -0.103202
+
+
+-0.182765 0.412878 0.231162
+-0.188034 0.405694 0.237091
+-0.272468 0.359184 0.217136
+-0.221932 0.357985 0.275431
+-0.222615 0.356969 0.276233
+-0.225609 0.35262 0.279582
+
+
+-0.182765 0.412878 0.231162
+-0.156068 0.355593 0.31559
+-0.193844 0.279098 0.376462
+-0.187766 0.279777 0.378768
+-0.178942 0.188749 0.427498
+-0.058512 0.12878 0.497299
+
+
+-0.182765 0.412878 0.231162
+-0.181421 0.414739 0.229602
+-0.272468 0.359184 0.217136
+-0.218318 0.363219 0.271349
+-0.218995 0.362219 0.272144
+-0.221932 0.357985 0.275431
+
+
+-0.338275 0.293283 0.234842
+-0.377121 0.208972 0.25399
+-0.405418 0.0999328 0.292324
+-0.403264 0.101104 0.294612
+-0.361072 0.00364482 0.34643
+-0.340378 -0.0242325 0.365994
+-0.340656 -0.0252078 0.365689
+-0.341612 -0.0281363 0.364654
+
+
+-0.47159 0.202897 -0.0234032
+-0.466975 0.215646 -0.0223943
+-0.464303 0.153517 0.106091
+-0.43344 0.177756 0.188835
+-0.43453 0.172516 0.191476
+-0.435126 0.169706 0.192846
+
+
+-0.47159 0.202897 -0.0234032
+-0.445457 0.167217 -0.154943
+-0.50824 0.0955571 -0.0316833
+-0.503324 0.110593 -0.0305322
+
+
+-0.47159 0.202897 -0.0234032
+-0.471864 0.202136 -0.0234564
+-0.464303 0.153517 0.106091
+-0.431758 0.185633 0.184889
+-0.432849 0.180489 0.187496
+-0.43344 0.177756 0.188835
+
+
+-0.379275 0.30402 0.162191
+-0.387269 0.306057 0.14768
+-0.272468 0.359184 0.217136
+-0.214697 0.368422 0.267257
+-0.21538 0.36742 0.26806
+-0.218318 0.363219 0.271349
+
+
+-0.379275 0.30402 0.162191
+-0.377121 0.208972 0.25399
+-0.397824 0.104135 0.30034
+-0.395744 0.105258 0.302532
+-0.361072 0.00364482 0.34643
+-0.339216 -0.0205898 0.367233
+-0.339478 -0.0215082 0.36695
+-0.340378 -0.0242325 0.365994
+
+
+-0.379275 0.30402 0.162191
+-0.377931 0.3037 0.164593
+-0.272468 0.359184 0.217136
+-0.210998 0.373696 0.263076
+-0.211702 0.372673 0.263903
+-0.214697 0.368422 0.267257
+
+
+-0.391464 0.339434 0.0839493
+-0.272468 0.359184 0.217136
+-0.207145 0.379148 0.25872
+-0.207885 0.378082 0.259588
+-0.210998 0.373696 0.263076
+
+
+-0.391464 0.339434 0.0839493
+-0.382437 0.345464 0.0860199
+-0.372022 0.352379 0.0884846
+-0.272468 0.359184 0.217136
+-0.193666 0.397942 0.243468
+-0.194643 0.396567 0.244608
+-0.198606 0.3911 0.249059
+
+
+-0.391464 0.339434 0.0839493
+-0.402814 0.331851 0.0812545
+
+
+-0.0403122 0.361414 -0.374227
+-0.0423241 0.362645 -0.373349
+
+
+-0.285296 0.277997 0.322995
+-0.292819 0.280257 0.310735
+
+
+-0.285296 0.277997 0.322995
+-0.377121 0.208972 0.25399
+-0.39044 0.108192 0.308071
+-0.388392 0.10929 0.310211
+-0.361072 0.00364482 0.34643
+-0.338099 -0.0171186 0.368402
+-0.338353 -0.0180011 0.368135
+-0.339216 -0.0205898 0.367233
+
+
+-0.285296 0.277997 0.322995
+-0.283761 0.27756 0.325461
+
+
+0.325648 0.0450865 -0.39651
+0.197417 0.0278293 -0.458969
+0.195178 0.0646902 -0.456084
+0.196325 0.064956 -0.455561
+0.182225 0.0994352 -0.45531
+0.1698 0.182042 -0.438502
+0.168131 0.182498 -0.439041
+0.1614 0.184227 -0.441245
+
+
+0.0123328 0.32926 -0.396556
+0.0223603 0.323068 -0.400706
+
+
+0.0123328 0.32926 -0.396556
+-0.0533786 0.210915 -0.450628
+-0.0764972 0.383207 -0.358524
+-0.059359 0.372924 -0.365976
+
+
+0.0123328 0.32926 -0.396556
+0.0108502 0.330188 -0.395928
+
+
+0.151718 0.415265 -0.241491
+0.155981 0.412962 -0.242789
+
+
+0.365551 0.168141 -0.302493
+0.365897 0.16142 -0.305654
+
+
+0.271043 0.264235 -0.334648
+0.198312 0.245013 -0.388641
+0.274358 0.274794 -0.325761
+
+
+0.209343 0.383481 -0.258282
+0.217033 0.37911 -0.260517
+
+
+-0.125398 0.495558 0.0704438
+-0.224704 0.446302 -0.0268837
+-0.236977 0.440456 0.00316365
+-0.238072 0.439819 0.000209597
+-0.238308 0.439677 -0.000632618
+
+
+-0.246777 0.357373 -0.247824
+-0.247849 0.35649 -0.248003
+
+
+-0.246777 0.357373 -0.247824
+-0.254317 0.35493 -0.24364
+-0.255284 0.355323 -0.242073
+-0.25676 0.350136 -0.247973
+
+
+-0.246777 0.357373 -0.247824
+-0.243856 0.359375 -0.247908
+-0.251189 0.350154 -0.253609
+
+
+-0.0556273 0.416213 -0.311099
+-0.0506319 0.421847 -0.302429
+-0.0534068 0.422884 -0.297952
+-0.164923 0.436861 -0.17987
+-0.141214 0.45452 -0.154381
+-0.141771 0.45471 -0.153357
+-0.143315 0.455129 -0.150807
+
+
+-0.0556273 0.416213 -0.311099
+0.112594 0.380998 -0.304242
+0.154067 0.320051 -0.359177
+
+
+-0.0556273 0.416213 -0.311099
+-0.0578502 0.413738 -0.314887
+
+
+-0.204222 0.387664 -0.247036
+-0.212676 0.381575 -0.247325
+
+
+-0.204222 0.387664 -0.247036
+-0.258273 0.356219 -0.23764
+
+
+-0.204222 0.387664 -0.247036
+-0.195551 0.39379 -0.246905
+-0.194397 0.393693 -0.248135
+-0.164923 0.436861 -0.17987
+-0.139243 0.453937 -0.157723
+-0.139768 0.454121 -0.156757
+-0.141214 0.45452 -0.154381
+
+
+0.344647 -0.187652 -0.309848
+0.344838 -0.187617 -0.309658
+
+
+-0.0832038 0.0141595 -0.495575
+-0.0844464 0.0148328 -0.49548
+-0.0433918 -0.0459736 -0.496391
+0.026994 -0.172962 -0.484918
+0.0213529 -0.174995 -0.484262
+0.0542157 -0.290746 -0.403643
+0.049188 -0.345638 -0.361339
+0.0516827 -0.345895 -0.360795
+0.0559906 -0.34627 -0.35991
+
+
+-0.194877 -0.127742 -0.468555
+-0.194085 -0.121487 -0.469344
+
+
+-0.194877 -0.127742 -0.468555
+-0.0433918 -0.0459736 -0.496391
+0.0136091 -0.177713 -0.483369
+0.00806148 -0.179704 -0.482701
+0.0542157 -0.290746 -0.403643
+0.0425506 -0.345003 -0.362714
+0.0449996 -0.345263 -0.362186
+0.049188 -0.345638 -0.361339
+
+
+-0.194877 -0.127742 -0.468555
+-0.195855 -0.135126 -0.467594
+-0.296119 -0.00157042 -0.403375
+-0.376398 -0.093961 -0.337188
+-0.380343 -0.0854832 -0.334402
+-0.433806 -0.126861 -0.214754
+-0.516073 -0.147454 -0.0163246
+-0.518342 -0.142305 -0.0145735
+-0.413046 -0.239792 0.149308
+-0.394576 -0.205971 0.241364
+-0.393439 -0.208084 0.241187
+-0.389904 -0.214728 0.240543
+
+
+-0.19131 -0.424923 -0.183295
+-0.153551 -0.446874 -0.1647
+-0.133323 -0.471293 -0.109588
+-0.131001 -0.47233 -0.108697
+-0.124941 -0.474983 -0.106532
+
+
+-0.19131 -0.424923 -0.183295
+-0.191297 -0.425249 -0.182477
+-0.191081 -0.426944 -0.17837
+-0.153551 -0.446874 -0.1647
+-0.140234 -0.468227 -0.112105
+-0.138295 -0.4691 -0.111357
+-0.133323 -0.471293 -0.109588
+
+
+-0.19131 -0.424923 -0.183295
+-0.191549 -0.422971 -0.18799
+-0.225451 -0.420597 -0.150567
+-0.242007 -0.429626 -0.0924447
+-0.239102 -0.430585 -0.0944348
+-0.2359 -0.431608 -0.0967396
+
+
+-0.268562 -0.434285 0.0108773
+-0.188258 -0.456482 -0.0811385
+-0.137594 -0.49362 0.0449431
+-0.122861 -0.499642 0.0469413
+-0.121442 -0.50022 0.0471216
+
+
+-0.268562 -0.434285 0.0108773
+-0.265322 -0.436063 0.0132594
+-0.259549 -0.439219 0.0174103
+-0.188258 -0.456482 -0.0811385
+-0.151811 -0.487753 0.043019
+-0.138828 -0.493112 0.0447866
+-0.137594 -0.49362 0.0449431
+
+
+-0.268562 -0.434285 0.0108773
+-0.274477 -0.431016 0.0066118
+-0.295876 -0.38485 0.121445
+-0.25407 -0.408854 0.138796
+-0.254457 -0.407306 0.14268
+-0.208416 -0.429931 0.148736
+-0.179477 -0.434597 0.170865
+-0.181644 -0.433233 0.171923
+-0.176814 -0.420902 0.204888
+-0.14139 -0.368598 0.329296
+-0.131851 -0.375066 0.324592
+-0.130599 -0.375924 0.32396
+
+
+0.324289 -0.225318 -0.308674
+0.329431 -0.215993 -0.308934
+
+
+0.324289 -0.225318 -0.308674
+0.355139 -0.189425 -0.296968
+0.355725 -0.189246 -0.296411
+0.35624 -0.189045 -0.295945
+0.356694 -0.188834 -0.295556
+0.357095 -0.188616 -0.295231
+0.357451 -0.188396 -0.294958
+0.357767 -0.188178 -0.294729
+
+
+0.324289 -0.225318 -0.308674
+0.322376 -0.228645 -0.308664
+0.337824 -0.180157 -0.321899
+
+
+0.215504 -0.450729 -0.0253528
+0.246306 -0.434405 -0.0320329
+0.215539 -0.450935 -0.0217141
+
+
+-0.204429 0.44793 -0.107509
+-0.224704 0.446302 -0.0268837
+-0.235364 0.441384 0.00774298
+-0.236683 0.440628 0.00415913
+-0.236977 0.440456 0.00316365
+
+
+-0.406629 -0.256841 -0.18008
+-0.403191 -0.258074 -0.186269
+
+
+-0.406629 -0.256841 -0.18008
+-0.335423 -0.353515 -0.113662
+-0.417002 -0.306997 0.00965892
+-0.423271 -0.299273 0.00449431
+-0.413046 -0.239792 0.149308
+-0.3995 -0.196665 0.242215
+-0.398293 -0.198929 0.24203
+-0.394576 -0.205971 0.241364
+
+
+-0.406629 -0.256841 -0.18008
+-0.409654 -0.255707 -0.17467
+
+
+-0.151377 -0.353768 -0.360331
+-0.150786 -0.35906 -0.3539
+0.0259521 -0.389689 -0.312841
+0.0413696 -0.410494 -0.283128
+0.0375288 -0.410951 -0.282938
+0.0339636 -0.431711 -0.250744
+0.0158291 -0.518731 -0.0886407
+
+
+-0.151377 -0.353768 -0.360331
+-0.290413 -0.331313 -0.237261
+-0.262058 -0.381254 -0.196287
+-0.262365 -0.381198 -0.195986
+-0.225451 -0.420597 -0.150567
+-0.249426 -0.427191 -0.0872137
+-0.245865 -0.428377 -0.089669
+-0.242007 -0.429626 -0.0924447
+
+
+-0.151377 -0.353768 -0.360331
+-0.152126 -0.34639 -0.369297
+0.0259521 -0.389689 -0.312841
+0.0374664 -0.410956 -0.282937
+0.033772 -0.411384 -0.282746
+0.0339636 -0.431711 -0.250744
+-0.00143953 -0.516956 -0.0942928
+
+
+0.246702 -0.376165 -0.297195
+0.244558 -0.372289 -0.302354
+
+
+0.246702 -0.376165 -0.297195
+0.356694 -0.188834 -0.295556
+
+
+0.246702 -0.376165 -0.297195
+0.249527 -0.381373 -0.290272
+0.216691 -0.386087 -0.289223
+0.0339636 -0.431711 -0.250744
+-0.0125045 -0.505939 -0.116459
+
+
+-0.0192555 -0.541057 0.0608116
+-0.01923 -0.541038 0.0606186
+
+
+-0.217926 -0.278772 0.373791
+-0.327379 -0.209631 0.315085
+-0.204937 -0.329381 0.351525
+-0.199325 -0.328571 0.357579
+-0.198469 -0.32917 0.357167
+-0.196322 -0.330681 0.356112
+
+
+-0.217926 -0.278772 0.373791
+-0.216871 -0.281504 0.372948
+-0.211604 -0.295382 0.368577
+-0.327379 -0.209631 0.315085
+-0.204061 -0.31509 0.36233
+-0.202555 -0.318961 0.361109
+-0.199184 -0.327745 0.358293
+-0.185363 -0.319456 0.366799
+-0.180138 -0.316371 0.369973
+-0.0213985 -0.321575 0.382795
+0.0334408 -0.284884 0.412897
+0.0350164 -0.285657 0.412302
+0.0399073 -0.288155 0.410378
+
+
+-0.217926 -0.278772 0.373791
+-0.222467 -0.266729 0.377545
+-0.143539 -0.180191 0.444216
+-0.0564285 -0.131139 0.487363
+-0.0663686 -0.125252 0.486765
+
+
+0.0368658 0.431211 0.252682
+0.0369423 0.428981 0.256192
+-0.00934473 0.41695 0.276524
+0.0370874 0.426063 0.260747
+0.037162 0.425256 0.261997
+0.0372211 0.42333 0.26498
+
+
+0.0368658 0.431211 0.252682
+0.0840644 0.412413 0.270646
+0.0837512 0.380461 0.315373
+0.084212 0.380531 0.315138
+
+
+0.0368658 0.431211 0.252682
+0.0367812 0.432168 0.251177
+-0.00934473 0.41695 0.276524
+0.0338305 0.434606 0.247387
+
+
+-0.30041 -0.363112 -0.174643
+-0.302264 -0.361305 -0.174958
+-0.335423 -0.353515 -0.113662
+-0.425709 -0.296257 0.00244404
+-0.432217 -0.288164 -0.00295012
+-0.413046 -0.239792 0.149308
+-0.404804 -0.186562 0.243118
+-0.403493 -0.189041 0.242919
+-0.3995 -0.196665 0.242215
+
+
+-0.30041 -0.363112 -0.174643
+-0.290413 -0.331313 -0.237261
+-0.267035 -0.380266 -0.19154
+-0.267345 -0.380208 -0.191235
+-0.225451 -0.420597 -0.150567
+-0.258837 -0.424072 -0.0805627
+-0.254268 -0.425605 -0.0837323
+-0.249426 -0.427191 -0.0872137
+
+
+-0.30041 -0.363112 -0.174643
+-0.296995 -0.366478 -0.173968
+-0.335423 -0.353515 -0.113662
+-0.434774 -0.284972 -0.00511218
+-0.44167 -0.276319 -0.0108625
+-0.413046 -0.239792 0.149308
+-0.410654 -0.175335 0.244097
+-0.409196 -0.178115 0.243879
+-0.404804 -0.186562 0.243118
+
+
+0.0126288 -0.123629 0.494067
+0.00827513 -0.124206 0.494237
+
+
+0.16985 -0.138969 0.466478
+0.169636 -0.135806 0.468006
+
+
+-0.25331 0.341568 -0.263288
+-0.261613 0.346485 -0.24807
+
+
+-0.228199 -0.387402 -0.227989
+-0.220994 -0.388616 -0.234624
+
+
+0.248957 -0.31081 0.313051
+0.251475 -0.312062 0.30974
+
+
+-0.252531 -0.414429 0.124656
+-0.252417 -0.414769 0.123814
+
+
+0.226041 -0.384224 0.227141
+0.233707 -0.376741 0.233032
+0.218504 -0.399022 0.207606
+
+
+0.226041 -0.384224 0.227141
+0.205719 -0.397338 0.223268
+0.206189 -0.397299 0.222892
+0.20896 -0.400716 0.213955
+
+
+0.226041 -0.384224 0.227141
+0.225878 -0.384393 0.226997
+0.217891 -0.398567 0.209079
+
+
+0.190818 -0.388886 0.250054
+0.194017 -0.401533 0.226542
+0.194564 -0.401207 0.226639
+0.19515 -0.400881 0.226697
+0.195777 -0.400559 0.226711
+0.196446 -0.400242 0.226677
+0.196508 -0.400215 0.226669
+0.205879 -0.403587 0.211565
+
+
+0.190818 -0.388886 0.250054
+0.192104 -0.388213 0.250126
+0.19378 -0.38741 0.250097
+0.194564 -0.401207 0.226639
+
+
+0.190818 -0.388886 0.250054
+0.189184 -0.389661 0.25008
+0.179438 -0.375372 0.278026
+0.19661 -0.285293 0.378768
+0.198828 -0.285541 0.377075
+
+
+0.213953 -0.397344 0.215277
+0.211681 -0.398181 0.215975
+0.211566 -0.398239 0.215982
+0.210232 -0.399527 0.214914
+
+
+-0.0125021 -0.467937 0.233157
+0.141621 -0.397458 0.269018
+0.151832 -0.378217 0.289832
+0.152103 -0.378419 0.289414
+0.153424 -0.379752 0.286899
+
+
+0.218856 -0.399474 0.206397
+0.207895 -0.401722 0.213116
+
+
+-0.0572392 -0.241628 0.442414
+-0.0633092 -0.24543 0.439015
+-0.0213985 -0.321575 0.382795
+0.0273409 -0.281785 0.41525
+0.0288394 -0.282522 0.414691
+0.0334408 -0.284884 0.412897
+
+
+-0.218044 -0.33129 0.337273
+-0.223387 -0.332081 0.331411
+
+
+-0.326474 0.0173436 0.379473
+-0.327925 0.0132417 0.378173
+-0.361072 0.00364482 0.34643
+-0.337004 -0.0137439 0.369528
+-0.337254 -0.0146086 0.36927
+-0.338099 -0.0171186 0.368402
+
+
+-0.326474 0.0173436 0.379473
+-0.310123 -0.0280028 0.391714
+-0.231025 -0.100004 0.443134
+-0.236982 -0.108347 0.437854
+-0.23703 -0.108413 0.437811
+
+
+-0.326474 0.0173436 0.379473
+-0.325976 0.0188745 0.379916
+-0.361072 0.00364482 0.34643
+-0.335909 -0.0103987 0.370634
+-0.336161 -0.011262 0.370378
+-0.337004 -0.0137439 0.369528
+
+
+-0.351576 -0.310869 -0.183893
+-0.354164 -0.308156 -0.184308
+-0.335423 -0.353515 -0.113662
+-0.444409 -0.27287 -0.0131905
+-0.451879 -0.263416 -0.0194555
+-0.413046 -0.239792 0.149308
+-0.417279 -0.16253 0.24519
+-0.415611 -0.165735 0.244942
+-0.410654 -0.175335 0.244097
+
+
+-0.351576 -0.310869 -0.183893
+-0.290413 -0.331313 -0.237261
+-0.272104 -0.379237 -0.186682
+-0.272423 -0.379175 -0.186366
+-0.225451 -0.420597 -0.150567
+-0.271453 -0.419855 -0.0716289
+-0.265235 -0.421954 -0.0759666
+-0.258837 -0.424072 -0.0805627
+
+
+-0.351576 -0.310869 -0.183893
+-0.347283 -0.315406 -0.183106
+
+
+-0.0439822 -0.194744 0.465848
+0.0527917 -0.222753 0.444966
+-0.00863773 -0.132637 0.492031
+
+
+-0.310249 -0.353374 -0.176476
+-0.311936 -0.351707 -0.176756
+-0.335423 -0.353515 -0.113662
+-0.454881 -0.259604 -0.0220193
+-0.463169 -0.249028 -0.0290092
+-0.413046 -0.239792 0.149308
+-0.425009 -0.147489 0.246447
+-0.42304 -0.151298 0.246156
+-0.417279 -0.16253 0.24519
+
+
+-0.310249 -0.353374 -0.176476
+-0.290413 -0.331313 -0.237261
+-0.277367 -0.378143 -0.181611
+-0.277702 -0.378077 -0.181279
+-0.225451 -0.420597 -0.150567
+-0.282472 -0.398782 -0.116868
+-0.281833 -0.401416 -0.110171
+
+
+-0.310249 -0.353374 -0.176476
+-0.307205 -0.356418 -0.17588
+-0.335423 -0.353515 -0.113662
+-0.466542 -0.244709 -0.0319038
+-0.475987 -0.232563 -0.0399121
+-0.413046 -0.239792 0.149308
+-0.434353 -0.129194 0.247946
+-0.431941 -0.133894 0.24759
+-0.425009 -0.147489 0.246447
+
+
+0.198973 -0.413138 0.199356
+0.197826 -0.410771 0.20528
+
+
+-0.175047 0.423386 0.222422
+-0.181421 0.414739 0.229602
+
+
+-0.175047 0.423386 0.222422
+-0.156068 0.355593 0.31559
+-0.184229 0.280204 0.380077
+-0.178299 0.280851 0.382305
+-0.178942 0.188749 0.427498
+-0.0384748 0.250147 0.451928
+
+
+-0.175047 0.423386 0.222422
+-0.173387 0.425669 0.2205
+-0.272468 0.359184 0.217136
+-0.163207 0.439449 0.208965
+-0.165353 0.436518 0.211442
+-0.173387 0.425669 0.2205
+
+
+-0.0549479 -0.240229 0.443669
+-0.053578 -0.239369 0.44443
+
+
+-0.284264 0.370826 -0.182336
+-0.280674 0.374068 -0.181505
+-0.310534 0.370612 -0.128901
+-0.324506 0.382744 -0.0474015
+-0.330943 0.378609 -0.0429868
+-0.332109 0.377853 -0.0422101
+
+
+-0.284264 0.370826 -0.182336
+-0.269848 0.352451 -0.230562
+-0.2703 0.352086 -0.230591
+-0.270356 0.352036 -0.2306
+-0.264205 0.344553 -0.24802
+
+
+-0.284264 0.370826 -0.182336
+-0.285079 0.3701 -0.182496
+-0.310534 0.370612 -0.128901
+-0.317786 0.387032 -0.0519741
+-0.323486 0.3834 -0.0480764
+-0.324506 0.382744 -0.0474015
+
+
+0.00404539 -0.269805 0.424006
+-0.0213985 -0.321575 0.382795
+0.0214684 -0.278787 0.417492
+0.0229222 -0.279505 0.416956
+0.0273409 -0.281785 0.41525
+
+
+0.00404539 -0.269805 0.424006
+0.00553457 -0.270552 0.423474
+0.00993268 -0.272854 0.421828
+-0.0213985 -0.321575 0.382795
+0.015703 -0.275829 0.419671
+0.0171407 -0.276543 0.419146
+0.0214684 -0.278787 0.417492
+
+
+0.00404539 -0.269805 0.424006
+-0.000519753 -0.267405 0.425697
+0.0527917 -0.222753 0.444966
+-0.0191458 -0.137847 0.490603
+
+
+0.0377719 0.412279 0.281714
+0.0377031 0.413041 0.280584
+
+
+-0.224824 -0.0913423 0.44857
+-0.224875 -0.0914118 0.448526
+-0.310123 -0.0280028 0.391714
+-0.218451 -0.0824592 0.454095
+-0.224824 -0.0913423 0.44857
+-0.143539 -0.180191 0.444216
+-0.0755318 -0.119813 0.486177
+-0.0841171 -0.114704 0.485589
+-0.0534567 -0.0227233 0.497018
+-0.195036 -0.0172447 0.476282
+-0.195352 -0.00922238 0.476576
+-0.195545 -0.00304294 0.47681
+
+
+-0.218995 0.362219 0.272144
+-0.156068 0.355593 0.31559
+-0.174815 0.281264 0.383581
+-0.168915 0.281892 0.385775
+-0.178942 0.188749 0.427498
+-0.0479336 0.275114 0.436854
+
+
+-0.403493 -0.189041 0.242919
+-0.327379 -0.209631 0.315085
+-0.223391 -0.264324 0.378279
+-0.222467 -0.266729 0.377545
+
+
+-0.419506 -0.252035 -0.156774
+-0.335423 -0.353515 -0.113662
+-0.479798 -0.227609 -0.0433176
+-0.473029 -0.230436 -0.0563494
+
+
+0.0391666 0.379033 0.329461
+0.0390331 0.381251 0.326344
+
+
+-0.206123 -0.440776 -0.117373
+-0.188258 -0.456482 -0.0811385
+-0.164648 -0.482402 0.0412754
+-0.152913 -0.487295 0.0428793
+-0.151811 -0.487753 0.043019
+
+
+-0.291809 -0.331232 0.262437
+-0.284379 -0.336331 0.266426
+-0.32754 -0.35453 0.132009
+-0.296811 -0.367676 0.165758
+-0.297882 -0.367905 0.162879
+-0.299852 -0.368153 0.158012
+
+
+-0.291809 -0.331232 0.262437
+-0.327379 -0.209631 0.315085
+-0.228245 -0.251409 0.382246
+-0.227415 -0.253582 0.381592
+-0.223391 -0.264324 0.378279
+
+
+-0.291809 -0.331232 0.262437
+-0.296229 -0.328218 0.260016
+-0.32754 -0.35453 0.132009
+-0.2924 -0.366966 0.176957
+-0.294019 -0.367292 0.172687
+-0.296811 -0.367676 0.165758
+
+
+-0.318362 -0.370214 0.108111
+-0.319327 -0.37019 0.105506
+-0.32754 -0.35453 0.132009
+-0.285261 -0.365798 0.195032
+-0.28802 -0.366324 0.187866
+-0.2924 -0.366966 0.176957
+
+
+-0.318362 -0.370214 0.108111
+-0.295876 -0.38485 0.121445
+-0.254561 -0.406967 0.143488
+-0.254952 -0.405358 0.147484
+-0.208416 -0.429931 0.148736
+-0.182547 -0.432693 0.172286
+-0.184535 -0.431429 0.173261
+-0.176814 -0.420902 0.204888
+-0.152955 -0.360694 0.334986
+-0.142719 -0.367682 0.329964
+-0.14139 -0.368598 0.329296
+
+
+-0.318362 -0.370214 0.108111
+-0.318008 -0.370139 0.109327
+-0.32754 -0.35453 0.132009
+-0.271377 -0.363497 0.23011
+-0.277181 -0.364554 0.215221
+-0.285261 -0.365798 0.195032
+
+
+-0.333849 -0.329397 -0.180764
+-0.335722 -0.327475 -0.181065
+-0.335423 -0.353515 -0.113662
+-0.467579 -0.232747 -0.0667339
+
+
+-0.333849 -0.329397 -0.180764
+-0.290413 -0.331313 -0.237261
+-0.282946 -0.376957 -0.17621
+-0.283306 -0.376885 -0.175852
+-0.225451 -0.420597 -0.150567
+-0.283071 -0.396236 -0.123281
+-0.28248 -0.398754 -0.116937
+-0.282472 -0.398782 -0.116868
+
+
+-0.333849 -0.329397 -0.180764
+-0.330631 -0.332735 -0.180156
+
+
+-0.363469 0.263905 -0.245206
+-0.374952 0.254455 -0.244927
+-0.376235 0.259591 -0.236063
+
+
+-0.363469 0.263905 -0.245206
+-0.276341 0.343064 -0.236696
+
+
+-0.363469 0.263905 -0.245206
+-0.324971 0.29529 -0.246524
+-0.269283 0.332893 -0.258343
+-0.270228 0.333024 -0.257155
+
+
+-0.284 0.32883 -0.247588
+-0.285484 0.327541 -0.247661
+
+
+-0.284 0.32883 -0.247588
+-0.276531 0.339066 -0.242049
+
+
+-0.284 0.32883 -0.247588
+-0.281099 0.331089 -0.247791
+
+
+-0.277013 0.334586 -0.247628
+-0.277844 0.333693 -0.24791
+
+
+-0.277013 0.334586 -0.247628
+-0.275772 0.336828 -0.245968
+-0.27503 0.335769 -0.248231
+-0.275008 0.335774 -0.248249
+
+
+-0.277013 0.334586 -0.247628
+-0.27503 0.335769 -0.248231
+
+
+-0.272579 0.333914 -0.253422
+-0.27124 0.339016 -0.248007
+
+
+-0.270813 0.33322 -0.256266
+-0.269775 0.340186 -0.248017
+
+
+-0.455451 0.246919 -0.0199279
+-0.449159 0.263726 -0.0185841
+-0.464303 0.153517 0.106091
+-0.430046 0.193491 0.180934
+-0.43116 0.188342 0.183555
+-0.431758 0.185633 0.184889
+
+
+-0.455451 0.246919 -0.0199279
+-0.445457 0.167217 -0.154943
+-0.498226 0.125995 -0.0293625
+-0.493938 0.138786 -0.028375
+-0.464303 0.153517 0.106091
+-0.428272 0.201481 0.176892
+-0.429431 0.196228 0.179579
+-0.430046 0.193491 0.180934
+
+
+-0.455451 0.246919 -0.0199279
+-0.455812 0.245951 -0.0199975
+-0.464303 0.153517 0.106091
+-0.426398 0.209766 0.172681
+-0.427627 0.2043 0.175489
+-0.428272 0.201481 0.176892
+
+
+-0.104242 0.347898 -0.373153
+-0.109182 0.341579 -0.375729
+
+
+-0.428577 0.0869257 0.267516
+-0.421929 0.090701 0.274683
+
+
+-0.0410345 -0.196895 -0.476489
+-0.0473256 -0.199113 -0.475632
+0.0542157 -0.290746 -0.403643
+0.035948 -0.344354 -0.364061
+0.0383989 -0.344621 -0.363541
+0.0425506 -0.345003 -0.362714
+
+
+-0.0410345 -0.196895 -0.476489
+-0.0433918 -0.0459736 -0.496391
+0.000372883 -0.18239 -0.481784
+-0.00518759 -0.184377 -0.481092
+0.0542157 -0.290746 -0.403643
+0.0292527 -0.343677 -0.365408
+0.0317532 -0.343956 -0.364885
+0.035948 -0.344354 -0.364061
+
+
+-0.0410345 -0.196895 -0.476489
+-0.032591 -0.193981 -0.477597
+0.0542157 -0.290746 -0.403643
+0.00715656 -0.341323 -0.369722
+0.0101541 -0.341677 -0.369124
+
+
+-0.0731975 -0.208044 -0.472068
+-0.0807978 -0.210699 -0.470979
+0.0542157 -0.290746 -0.403643
+-0.00152096 -0.340356 -0.37137
+0.00180909 -0.340755 -0.370716
+0.00715656 -0.341323 -0.369722
+
+
+-0.0731975 -0.208044 -0.472068
+-0.0433918 -0.0459736 -0.496391
+-0.0129675 -0.187084 -0.480132
+-0.0186482 -0.189105 -0.479402
+0.0542157 -0.290746 -0.403643
+-0.0763816 -0.331477 -0.38501
+-0.0671399 -0.33264 -0.383323
+-0.0537001 -0.334231 -0.380946
+
+
+-0.0731975 -0.208044 -0.472068
+-0.0632308 -0.20463 -0.473451
+0.0542157 -0.290746 -0.403643
+-0.108362 -0.327549 -0.390692
+-0.0950269 -0.329235 -0.388287
+-0.0763816 -0.331477 -0.38501
+
+
+-0.251109 0.348629 -0.255819
+-0.257776 0.349323 -0.248074
+
+
+-0.150081 -0.365868 -0.345563
+-0.149518 -0.370803 -0.339519
+
+
+-0.150081 -0.365868 -0.345563
+-0.290413 -0.331313 -0.237261
+-0.289037 -0.374211 -0.172496
+
+
+-0.150081 -0.365868 -0.345563
+-0.150786 -0.35906 -0.3539
+
+
+-0.122861 -0.499642 0.0469413
+-0.208416 -0.429931 0.148736
+-0.185376 -0.430924 0.173594
+-0.187241 -0.429727 0.17451
+-0.176814 -0.420902 0.204888
+-0.165631 -0.351977 0.341192
+-0.154397 -0.359694 0.335707
+-0.152955 -0.360694 0.334986
+
+
+0.272571 -0.31764 -0.306664
+0.285035 -0.295566 -0.307053
+0.308981 -0.252607 -0.308135
+0.337647 -0.179595 -0.322425
+
+
+0.339215 -0.198332 -0.30928
+0.339422 -0.183335 -0.318249
+
+
+0.339215 -0.198332 -0.30928
+0.339698 -0.197577 -0.309218
+0.341021 -0.195028 -0.30934
+0.34025 -0.184491 -0.316638
+
+
+0.339215 -0.198332 -0.30928
+0.337518 -0.201521 -0.309158
+0.352616 -0.189877 -0.299552
+0.353609 -0.189764 -0.298498
+0.354467 -0.189578 -0.297639
+
+
+0.257125 -0.170947 -0.404808
+0.264311 -0.161121 -0.402919
+0.223301 -0.0667773 -0.442807
+0.345059 0.00988491 -0.385985
+0.343565 0.0221571 -0.38838
+0.343063 0.0260623 -0.389158
+
+
+0.257125 -0.170947 -0.404808
+0.337874 -0.174697 -0.325014
+
+
+0.257125 -0.170947 -0.404808
+0.257046 -0.171054 -0.404829
+0.223301 -0.0667773 -0.442807
+0.346886 -0.00525817 -0.382971
+0.345516 0.00625887 -0.385252
+0.345059 0.00988491 -0.385985
+
+
+-0.20468 -0.235626 -0.454553
+-0.290413 -0.331313 -0.237261
+-0.294991 -0.36842 -0.173623
+-0.296995 -0.366478 -0.173968
+
+
+-0.15276 -0.340592 -0.376293
+-0.152126 -0.34639 -0.369297
+
+
+-0.15276 -0.340592 -0.376293
+-0.290413 -0.331313 -0.237261
+-0.305455 -0.358137 -0.175586
+-0.307205 -0.356418 -0.17588
+
+
+-0.15276 -0.340592 -0.376293
+-0.153575 -0.332414 -0.38616
+0.0259521 -0.389689 -0.312841
+0.0337113 -0.411389 -0.282745
+0.0300871 -0.411796 -0.28255
+0.0339636 -0.431711 -0.250744
+-0.0213171 -0.497107 -0.134104
+
+
+-0.154271 -0.32591 -0.393954
+-0.153575 -0.332414 -0.38616
+
+
+-0.154271 -0.32591 -0.393954
+-0.290413 -0.331313 -0.237261
+-0.314896 -0.348724 -0.177333
+-0.316553 -0.347073 -0.177605
+-0.335423 -0.353515 -0.113662
+-0.457291 -0.237017 -0.0863233
+
+
+-0.154271 -0.32591 -0.393954
+-0.154672 -0.321819 -0.398856
+-0.136613 -0.324107 -0.395633
+-0.108362 -0.327549 -0.390692
+
+
+-0.193167 -0.406957 -0.225972
+-0.192652 -0.411938 -0.21428
+-0.153551 -0.446874 -0.1647
+-0.146132 -0.465588 -0.11425
+-0.14446 -0.466349 -0.113602
+-0.140234 -0.468227 -0.112105
+
+
+-0.193167 -0.406957 -0.225972
+-0.225451 -0.420597 -0.150567
+-0.284709 -0.388777 -0.141719
+-0.284185 -0.391255 -0.135648
+-0.284178 -0.391282 -0.135585
+
+
+-0.193167 -0.406957 -0.225972
+-0.193239 -0.40587 -0.228561
+-0.153551 -0.446874 -0.1647
+-0.160306 -0.45913 -0.119394
+-0.159053 -0.459719 -0.118902
+-0.15599 -0.461117 -0.11783
+
+
+0.0607704 -0.408044 -0.283969
+0.0606703 -0.408056 -0.283968
+
+
+-0.265322 -0.436063 0.0132594
+-0.295876 -0.38485 0.121445
+-0.255058 -0.405003 0.148324
+-0.255461 -0.403298 0.152518
+-0.208416 -0.429931 0.148736
+-0.188041 -0.429244 0.174823
+-0.189827 -0.428087 0.175702
+-0.176814 -0.420902 0.204888
+-0.245176 -0.335119 0.307467
+-0.240622 -0.334472 0.312523
+
+
+0.36069 -0.185753 0.296886
+0.357197 -0.183273 0.302167
+
+
+0.010022 -0.413839 -0.281347
+0.00510697 -0.414299 -0.28102
+0.0339636 -0.431711 -0.250744
+-0.0286261 -0.489729 -0.148729
+
+
+0.010022 -0.413839 -0.281347
+0.0259521 -0.389689 -0.312841
+0.030027 -0.411801 -0.282549
+0.0264023 -0.412197 -0.282345
+0.0339636 -0.431711 -0.250744
+-0.0348948 -0.483352 -0.161264
+
+
+0.010022 -0.413839 -0.281347
+0.0100991 -0.413834 -0.28135
+0.0339636 -0.431711 -0.250744
+-0.0404276 -0.477676 -0.172319
+
+
+0.321054 -0.373482 -0.175531
+0.322385 -0.372994 -0.172881
+
+
+-0.290413 -0.331313 -0.237261
+-0.319489 -0.344093 -0.178173
+-0.321148 -0.342428 -0.178444
+
+
+-0.290413 -0.331313 -0.237261
+-0.339181 -0.323863 -0.181712
+-0.341215 -0.32176 -0.182038
+
+
+-0.290413 -0.331313 -0.237261
+-0.359149 -0.302858 -0.185213
+-0.362201 -0.299638 -0.185703
+-0.335423 -0.353515 -0.113662
+-0.448343 -0.240679 -0.103245
+
+
+-0.290413 -0.331313 -0.237261
+-0.36819 -0.293242 -0.186779
+-0.371923 -0.28928 -0.187381
+
+
+-0.290413 -0.331313 -0.237261
+-0.396676 -0.256116 -0.200809
+
+
+-0.290413 -0.331313 -0.237261
+-0.392202 -0.251655 -0.212823
+
+
+-0.290413 -0.331313 -0.237261
+-0.387883 -0.247363 -0.224291
+-0.384426 -0.243914 -0.233405
+-0.433806 -0.126861 -0.214754
+-0.525028 -0.127029 -0.00947872
+-0.52747 -0.121426 -0.0075762
+-0.413046 -0.239792 0.149308
+-0.465701 -0.0850779 0.227847
+-0.45657 -0.0950988 0.237833
+
+
+-0.290413 -0.331313 -0.237261
+-0.383632 -0.243153 -0.235457
+-0.380169 -0.239709 -0.244485
+-0.433806 -0.126861 -0.214754
+-0.534749 -0.104616 -0.00197242
+-0.53744 -0.0983761 0.000143071
+-0.413046 -0.239792 0.149308
+-0.476726 -0.0728827 0.215693
+-0.466804 -0.0838513 0.226641
+-0.465701 -0.0850779 0.227847
+
+
+-0.290413 -0.331313 -0.237261
+-0.379366 -0.238941 -0.246537
+-0.375832 -0.235437 -0.255653
+-0.433806 -0.126861 -0.214754
+-0.545565 -0.0794172 0.00646013
+-0.54861 -0.0722859 0.00887394
+-0.413046 -0.239792 0.149308
+-0.414631 -0.309904 0.011642
+-0.417002 -0.306997 0.00965892
+
+
+-0.290413 -0.331313 -0.237261
+-0.375005 -0.234648 -0.257744
+-0.371326 -0.231014 -0.267127
+-0.433806 -0.126861 -0.214754
+-0.547803 -0.0565566 -0.00266504
+-0.546272 -0.0430518 -0.0142864
+-0.464303 0.153517 0.106091
+-0.424379 0.218533 0.168203
+-0.425708 0.212729 0.171198
+-0.426398 0.209766 0.172681
+
+
+-0.290413 -0.331313 -0.237261
+-0.370458 -0.230187 -0.269301
+-0.366554 -0.226343 -0.279154
+-0.433806 -0.126861 -0.214754
+-0.54559 -0.0372213 -0.0193508
+-0.544082 -0.0245227 -0.0302709
+-0.464303 0.153517 0.106091
+-0.422158 0.228014 0.163338
+-0.423626 0.221713 0.166603
+-0.424379 0.218533 0.168203
+
+
+-0.290413 -0.331313 -0.237261
+-0.365624 -0.225459 -0.28146
+-0.361395 -0.221307 -0.292026
+-0.433806 -0.126861 -0.214754
+-0.543404 -0.0189844 -0.0350794
+-0.542709 -0.0133918 -0.0398855
+
+
+-0.290413 -0.331313 -0.237261
+-0.360377 -0.220341 -0.294526
+-0.355693 -0.215756 -0.306116
+-0.433806 -0.126861 -0.214754
+-0.495201 0.0124949 -0.157929
+-0.495942 0.0121158 -0.156147
+
+
+-0.290413 -0.331313 -0.237261
+-0.354553 -0.214676 -0.308891
+-0.349237 -0.209487 -0.321923
+-0.433806 -0.126861 -0.214754
+-0.489064 0.0157216 -0.172597
+-0.489775 0.0153615 -0.170904
+-0.495201 0.0124949 -0.157929
+
+
+-0.290413 -0.331313 -0.237261
+-0.347928 -0.208247 -0.325085
+-0.341726 -0.202211 -0.340157
+-0.433806 -0.126861 -0.214754
+-0.483102 0.0188233 -0.186685
+-0.483799 0.0184742 -0.185045
+-0.489064 0.0157216 -0.172597
+
+
+-0.290413 -0.331313 -0.237261
+-0.340177 -0.200744 -0.34387
+-0.332707 -0.193493 -0.361881
+-0.433806 -0.126861 -0.214754
+-0.477196 0.0218632 -0.200481
+-0.477892 0.0215183 -0.198862
+-0.483102 0.0188233 -0.186685
+
+
+-0.290413 -0.331313 -0.237261
+-0.33081 -0.191696 -0.366398
+-0.330165 -0.191071 -0.367942
+-0.330708 -0.189941 -0.367596
+
+
+-0.290413 -0.331313 -0.237261
+-0.316068 -0.196 -0.378209
+-0.315852 -0.196074 -0.378366
+
+
+-0.290413 -0.331313 -0.237261
+-0.300653 -0.201343 -0.389343
+
+
+-0.290413 -0.331313 -0.237261
+-0.284519 -0.206886 -0.400901
+
+
+-0.290413 -0.331313 -0.237261
+-0.24848 -0.219111 -0.426406
+-0.248197 -0.219205 -0.426606
+-0.296119 -0.00157042 -0.403375
+-0.381921 -0.0820254 -0.333291
+-0.385739 -0.0737541 -0.33055
+-0.433806 -0.126861 -0.214754
+-0.471234 0.0248998 -0.214251
+-0.471943 0.0245524 -0.212621
+-0.477196 0.0218632 -0.200481
+
+
+-0.290413 -0.331313 -0.237261
+-0.227471 -0.226155 -0.441109
+-0.227151 -0.22626 -0.441333
+
+
+-0.290413 -0.331313 -0.237261
+-0.18779 -0.253367 -0.450713
+-0.180762 -0.267973 -0.439782
+0.0542157 -0.290746 -0.403643
+-0.155084 -0.320969 -0.399512
+-0.154672 -0.321819 -0.398856
+
+
+-0.290413 -0.331313 -0.237261
+-0.177802 -0.274184 -0.435102
+-0.171498 -0.287206 -0.425281
+0.0542157 -0.290746 -0.403643
+-0.163019 -0.304701 -0.411983
+-0.160524 -0.309877 -0.408018
+-0.155084 -0.320969 -0.399512
+
+
+-0.290413 -0.331313 -0.237261
+-0.168811 -0.292813 -0.421022
+-0.163019 -0.304701 -0.411983
+
+
+-0.290413 -0.331313 -0.237261
+-0.160524 -0.309877 -0.408018
+
+
+-0.290413 -0.331313 -0.237261
+-0.158637 -0.383703 -0.3119
+-0.169788 -0.386621 -0.295462
+-0.153551 -0.446874 -0.1647
+-0.164376 -0.457238 -0.120867
+-0.163186 -0.457803 -0.120398
+-0.160306 -0.45913 -0.119394
+
+
+-0.290413 -0.331313 -0.237261
+-0.171355 -0.387011 -0.293179
+-0.180359 -0.38934 -0.279855
+-0.153551 -0.446874 -0.1647
+-0.168294 -0.455398 -0.122282
+-0.167141 -0.455951 -0.121828
+-0.164376 -0.457238 -0.120867
+
+
+-0.290413 -0.331313 -0.237261
+-0.181652 -0.389656 -0.277967
+-0.189201 -0.391582 -0.26675
+-0.153551 -0.446874 -0.1647
+-0.172139 -0.453572 -0.123669
+-0.171 -0.454125 -0.123221
+-0.168294 -0.455398 -0.122282
+
+
+-0.290413 -0.331313 -0.237261
+-0.190305 -0.391847 -0.265134
+-0.194476 -0.392895 -0.258909
+-0.19409 -0.396875 -0.249633
+-0.153551 -0.446874 -0.1647
+-0.175987 -0.451727 -0.125056
+-0.17484 -0.45229 -0.124604
+-0.172139 -0.453572 -0.123669
+
+
+-0.290413 -0.331313 -0.237261
+-0.200424 -0.391952 -0.25349
+-0.201181 -0.391837 -0.252787
+-0.225451 -0.420597 -0.150567
+-0.285238 -0.386188 -0.148
+-0.284716 -0.38875 -0.141783
+-0.284709 -0.388777 -0.141719
+
+
+-0.290413 -0.331313 -0.237261
+-0.211423 -0.390183 -0.243424
+-0.212036 -0.390089 -0.242853
+-0.225451 -0.420597 -0.150567
+-0.19397 -0.398554 -0.245665
+-0.193239 -0.40587 -0.228561
+
+
+0.114012 -0.32283 0.381608
+0.112102 -0.323996 0.381243
+
+
+0.114012 -0.32283 0.381608
+0.179438 -0.375372 0.278026
+0.171258 -0.286973 0.392255
+
+
+0.114012 -0.32283 0.381608
+0.120403 -0.318854 0.382866
+0.0527917 -0.222753 0.444966
+-0.0300249 -0.143229 0.489077
+
+
+0.0350164 -0.285657 0.412302
+0.0527917 -0.222753 0.444966
+-0.0376566 -0.165331 0.479388
+-0.0384488 -0.168877 0.477774
+
+
+0.3259 0.0437463 0.377127
+0.326754 0.044399 0.376259
+
+
+0.287192 -0.0537247 0.420494
+0.278022 -0.0494681 0.428905
+
+
+0.224984 -0.047726 0.467351
+0.226129 -0.0476506 0.466577
+
+
+0.278978 0.131058 0.394073
+0.279234 0.130799 0.393968
+0.28047 0.0950224 0.403371
+0.297182 0.103348 0.38861
+0.298307 0.101524 0.388233
+0.298394 0.101303 0.388225
+
+
+0.278978 0.131058 0.394073
+0.294675 0.135453 0.380572
+
+
+0.278978 0.131058 0.394073
+0.275901 0.133881 0.395415
+0.28047 0.0950224 0.403371
+0.293645 0.109259 0.38968
+0.294753 0.107499 0.38933
+0.29483 0.107287 0.38933
+
+
+0.307765 0.0790517 0.386373
+0.307876 0.080802 0.385907
+
+
+0.149923 -0.376373 0.293331
+0.141621 -0.397458 0.269018
+0.147545 -0.374071 0.297671
+0.147937 -0.374397 0.297027
+0.149923 -0.376373 0.293331
+0.150241 -0.376625 0.292822
+0.151832 -0.378217 0.289832
+
+
+-0.0706529 -0.415641 0.293785
+-0.0213985 -0.321575 0.382795
+-0.0020804 -0.266617 0.426249
+-0.000519753 -0.267405 0.425697
+
+
+0.158842 -0.294837 0.390025
+0.179438 -0.375372 0.278026
+0.135948 -0.309214 0.385802
+0.131348 -0.312058 0.384955
+0.0527917 -0.222753 0.444966
+-0.0399034 -0.175776 0.474626
+
+
+0.124969 -0.316049 0.383721
+0.120403 -0.318854 0.382866
+
+
+0.124969 -0.316049 0.383721
+0.179438 -0.375372 0.278026
+0.106524 -0.331868 0.374578
+
+
+0.124969 -0.316049 0.383721
+0.131348 -0.312058 0.384955
+
+
+0.115166 -0.452915 0.193796
+0.141621 -0.397458 0.269018
+0.144435 -0.371053 0.303325
+0.144948 -0.371498 0.302464
+0.147545 -0.374071 0.297671
+
+
+0.115166 -0.452915 0.193796
+0.0958316 -0.471018 0.174939
+0.0947794 -0.47199 0.173935
+0.141621 -0.397458 0.269018
+0.140102 -0.36684 0.311181
+0.140826 -0.367489 0.309944
+0.144435 -0.371053 0.303325
+
+
+0.115166 -0.452915 0.193796
+0.115762 -0.452366 0.194359
+0.188242 -0.408368 0.218968
+0.188299 -0.407946 0.219728
+0.188375 -0.407663 0.220203
+0.202188 -0.406933 0.208696
+
+
+-0.174815 0.281264 0.383581
+-0.178299 0.280851 0.382305
+
+
+-0.466681 0.216453 -0.0223374
+-0.461678 0.230112 -0.0212525
+-0.464303 0.153517 0.106091
+-0.41966 0.238509 0.15793
+-0.421319 0.231505 0.161572
+-0.422158 0.228014 0.163338
+
+
+-0.466681 0.216453 -0.0223374
+-0.445457 0.167217 -0.154943
+-0.49368 0.139549 -0.0283229
+-0.489544 0.151729 -0.0273786
+
+
+-0.466681 0.216453 -0.0223374
+-0.466975 0.215646 -0.0223943
+
+
+0.164114 -0.389742 0.266802
+0.164995 -0.390638 0.264956
+0.141621 -0.397458 0.269018
+0.133495 -0.360406 0.32313
+0.134631 -0.361451 0.321158
+0.140102 -0.36684 0.311181
+
+
+0.164114 -0.389742 0.266802
+0.179438 -0.375372 0.278026
+0.124014 -0.351086 0.340341
+0.133495 -0.360406 0.32313
+
+
+0.164114 -0.389742 0.266802
+0.163908 -0.389648 0.267064
+
+
+0.0794499 -0.357624 0.35233
+0.0775637 -0.359345 0.35082
+-0.0213985 -0.321575 0.382795
+-0.00858594 -0.263216 0.428606
+-0.00691621 -0.264064 0.42802
+-0.0020804 -0.266617 0.426249
+
+
+0.0794499 -0.357624 0.35233
+0.141621 -0.397458 0.269018
+0.121897 -0.349096 0.344061
+0.124014 -0.351086 0.340341
+
+
+0.0794499 -0.357624 0.35233
+0.0847386 -0.352685 0.356659
+-0.0213985 -0.321575 0.382795
+-0.0156465 -0.259509 0.431138
+-0.01382 -0.260442 0.430503
+-0.00858594 -0.263216 0.428606
+
+
+-0.300215 -0.414597 -0.00477292
+-0.304321 -0.411164 -0.00359426
+-0.295876 -0.38485 0.121445
+-0.25557 -0.402919 0.153408
+-0.255995 -0.401073 0.157904
+-0.208416 -0.429931 0.148736
+-0.190602 -0.427616 0.176003
+-0.192347 -0.426475 0.176862
+-0.176814 -0.420902 0.204888
+-0.25511 -0.336453 0.296452
+-0.250772 -0.335851 0.301298
+-0.245176 -0.335119 0.307467
+
+
+-0.294991 -0.36842 -0.173623
+-0.291254 -0.372076 -0.172882
+
+
+-0.400104 -0.259211 -0.191745
+-0.335423 -0.353515 -0.113662
+-0.440337 -0.243906 -0.118273
+
+
+0.3043 -0.277276 0.286475
+0.306354 -0.275858 0.285563
+0.308865 -0.27418 0.284386
+
+
+0.191482 -0.284666 0.382711
+0.19661 -0.285293 0.378768
+
+
+0.191482 -0.284666 0.382711
+0.27822 -0.176201 0.376759
+0.175114 -0.23307 0.419654
+0.175542 -0.242102 0.414974
+0.0527917 -0.222753 0.444966
+-0.0419946 -0.1855 0.470148
+
+
+0.191482 -0.284666 0.382711
+0.184449 -0.283863 0.388047
+
+
+-0.194839 -0.0233074 0.47603
+-0.195036 -0.0172447 0.476282
+
+
+-0.194839 -0.0233074 0.47603
+-0.310123 -0.0280028 0.391714
+-0.211605 -0.0729398 0.459968
+-0.218397 -0.0823861 0.454141
+-0.218451 -0.0824592 0.454095
+
+
+-0.194839 -0.0233074 0.47603
+-0.194513 -0.0312534 0.475709
+-0.0534567 -0.0227233 0.497018
+-0.180666 -0.0564035 0.47644
+-0.180688 -0.0563908 0.476437
+-0.193858 -0.0483519 0.474933
+
+
+0.175677 -0.24449 0.413722
+0.176118 -0.254065 0.408717
+0.0527917 -0.222753 0.444966
+-0.0459091 -0.203706 0.461634
+
+
+0.175677 -0.24449 0.413722
+0.27822 -0.176201 0.376759
+0.176259 -0.256623 0.407364
+0.176724 -0.266995 0.401895
+0.0527917 -0.222753 0.444966
+-0.0478136 -0.212565 0.457426
+
+
+0.175677 -0.24449 0.413722
+0.175542 -0.242102 0.414974
+
+
+0.28974 -0.207299 0.351496
+0.27822 -0.176201 0.376759
+0.176874 -0.269797 0.400401
+0.177376 -0.2813 0.394287
+0.0527917 -0.222753 0.444966
+-0.0517025 -0.230659 0.448695
+
+
+0.213209 -0.396659 0.217267
+0.213155 -0.396681 0.217279
+0.211681 -0.398181 0.215975
+
+
+0.323844 -0.263831 0.277413
+0.30802 -0.229117 0.320982
+0.284884 -0.290207 0.295205
+
+
+0.333028 -0.257377 0.273012
+0.30802 -0.229117 0.320982
+0.306354 -0.275858 0.285563
+
+
+0.229863 -0.301297 0.33775
+0.230763 -0.301734 0.336612
+
+
+0.292709 -0.204647 0.350566
+0.27822 -0.176201 0.376759
+0.230245 -0.258722 0.368511
+
+
+0.320866 -0.178806 0.341096
+0.27822 -0.176201 0.376759
+0.243743 -0.247195 0.364782
+0.250669 -0.241314 0.362826
+
+
+0.300654 -0.197511 0.347982
+0.301618 -0.196594 0.347687
+0.303773 -0.194667 0.346949
+
+
+0.308183 -0.190579 0.345488
+0.27822 -0.176201 0.376759
+0.266858 -0.227339 0.358286
+0.270359 -0.22435 0.357256
+
+
+0.27822 -0.176201 0.376759
+0.27185 -0.223015 0.35685
+
+
+0.27822 -0.176201 0.376759
+0.276156 -0.219267 0.355594
+
+
+0.27822 -0.176201 0.376759
+0.279976 -0.215927 0.354465
+
+
+0.27822 -0.176201 0.376759
+0.286676 -0.210022 0.352443
+
+
+0.27822 -0.176201 0.376759
+0.295639 -0.202013 0.349633
+
+
+0.27822 -0.176201 0.376759
+0.301618 -0.196594 0.347687
+
+
+0.27822 -0.176201 0.376759
+0.311895 -0.187151 0.344219
+
+
+0.27822 -0.176201 0.376759
+0.326596 -0.173441 0.33907
+
+
+-0.304321 -0.411164 -0.00359426
+-0.309995 -0.406402 -0.00203511
+
+
+-0.40567 -0.318806 0.0116828
+-0.3989 -0.325419 0.0114706
+
+
+0.253063 -0.433902 0.0885531
+0.246786 -0.437462 0.0880664
+
+
+0.115762 -0.452366 0.194359
+0.127474 -0.441365 0.205781
+0.141621 -0.397458 0.269018
+0.103077 -0.335538 0.371451
+
+
+0.21537 -0.450073 -0.0356658
+0.246306 -0.434405 -0.0320329
+0.215464 -0.450519 -0.0288434
+
+
+0.174557 -0.222099 0.425302
+0.174424 -0.219886 0.426442
+
+
+0.142437 -0.305131 0.387035
+0.135948 -0.309214 0.385802
+
+
+-0.111505 -0.38875 0.314458
+-0.0213985 -0.321575 0.382795
+-0.0234922 -0.255372 0.433924
+-0.0214451 -0.256425 0.433218
+-0.0156465 -0.259509 0.431138
+
+
+-0.0712115 -0.250329 0.434579
+-0.0213985 -0.321575 0.382795
+-0.0324426 -0.250635 0.437073
+-0.0300847 -0.251855 0.436265
+-0.0234922 -0.255372 0.433924
+
+
+-0.0712115 -0.250329 0.434579
+-0.0654591 -0.246738 0.437828
+-0.0633092 -0.24543 0.439015
+
+
+-0.0712115 -0.250329 0.434579
+-0.0732703 -0.251577 0.433433
+-0.143539 -0.180191 0.444216
+-0.0841286 -0.114697 0.485588
+-0.0923611 -0.109786 0.484988
+-0.0534567 -0.0227233 0.497018
+-0.166505 -0.0650317 0.478011
+-0.166523 -0.065021 0.478009
+-0.180666 -0.0564035 0.47644
+
+
+-0.0214451 -0.256425 0.433218
+0.0527917 -0.222753 0.444966
+-0.0523183 -0.240029 0.444003
+
+
+0.153665 -0.379918 0.286544
+0.179438 -0.375372 0.278026
+0.134631 -0.361451 0.321158
+
+
+-0.305623 0.0765401 0.397403
+-0.311444 0.0602491 0.39247
+-0.361072 0.00364482 0.34643
+-0.334792 -0.00701822 0.37174
+-0.335051 -0.00789664 0.371483
+-0.335909 -0.0103987 0.370634
+
+
+-0.305623 0.0765401 0.397403
+-0.310123 -0.0280028 0.391714
+-0.204151 -0.0625968 0.466297
+-0.211548 -0.0728612 0.460017
+-0.211605 -0.0729398 0.459968
+
+
+-0.305623 0.0765401 0.397403
+-0.303174 0.0835903 0.399469
+-0.361072 0.00364482 0.34643
+-0.333632 -0.00353486 0.372869
+-0.333904 -0.00444603 0.372604
+-0.334792 -0.00701822 0.37174
+
+
+-0.26275 -0.376659 0.212155
+-0.266942 -0.370263 0.22093
+-0.176814 -0.420902 0.204888
+-0.264708 -0.337708 0.285743
+-0.260495 -0.337138 0.290481
+-0.25511 -0.336453 0.296452
+
+
+-0.26275 -0.376659 0.212155
+-0.295876 -0.38485 0.121445
+-0.25611 -0.400659 0.158869
+-0.256568 -0.398618 0.163798
+-0.208416 -0.429931 0.148736
+-0.193113 -0.426006 0.177157
+-0.194852 -0.424859 0.178011
+-0.176814 -0.420902 0.204888
+-0.274163 -0.338911 0.27513
+-0.269991 -0.338361 0.27985
+-0.264708 -0.337708 0.285743
+
+
+-0.26275 -0.376659 0.212155
+-0.262228 -0.377433 0.211105
+
+
+0.168596 -0.119 0.476044
+0.168846 -0.122651 0.474294
+
+
+-0.26327 -0.15479 0.410115
+-0.25977 -0.16478 0.407377
+-0.327379 -0.209631 0.315085
+-0.232662 -0.239579 0.385837
+-0.231898 -0.241588 0.385239
+-0.228245 -0.251409 0.382246
+
+
+-0.26327 -0.15479 0.410115
+-0.143539 -0.180191 0.444216
+-0.0923723 -0.10978 0.484987
+-0.100423 -0.104965 0.484364
+-0.0534567 -0.0227233 0.497018
+-0.154382 -0.0724029 0.479312
+-0.154398 -0.0723936 0.47931
+-0.166505 -0.0650317 0.478011
+
+
+-0.26327 -0.15479 0.410115
+-0.264063 -0.152575 0.410706
+-0.327379 -0.209631 0.315085
+-0.236769 -0.228499 0.389158
+-0.236052 -0.230397 0.388601
+-0.232662 -0.239579 0.385837
+
+
+-0.0376566 -0.165331 0.479388
+-0.0360634 -0.157783 0.482799
+
+
+-0.240267 0.428956 -0.116134
+-0.241955 0.428293 -0.114181
+-0.24677 0.426359 -0.108735
+-0.310534 0.370612 -0.128901
+-0.31169 0.390886 -0.0561061
+-0.31687 0.387616 -0.0525767
+-0.317786 0.387032 -0.0519741
+
+
+-0.364532 0.357353 0.0901904
+-0.355735 0.363154 0.0922641
+-0.272468 0.359184 0.217136
+-0.143353 0.472368 0.175667
+-0.143365 0.47227 0.175823
+
+
+-0.364532 0.357353 0.0901904
+-0.263681 0.425199 -0.00886505
+-0.382437 0.345464 0.0860199
+
+
+-0.364532 0.357353 0.0901904
+-0.372022 0.352379 0.0884846
+
+
+-0.0386492 0.33767 0.385129
+-0.0368764 0.335402 0.388347
+-0.156068 0.355593 0.31559
+-0.165417 0.282297 0.387043
+-0.159436 0.28292 0.389245
+-0.178942 0.188749 0.427498
+-0.0684572 0.291844 0.421154
+-0.0604929 0.292606 0.423848
+-0.0547577 0.293114 0.425806
+
+
+-0.0716111 0.378648 0.325797
+-0.156068 0.355593 0.31559
+-0.155855 0.283325 0.390529
+-0.149674 0.283954 0.392782
+-0.178942 0.188749 0.427498
+-0.0871339 0.290111 0.414751
+-0.0806156 0.29075 0.41697
+-0.0684572 0.291844 0.421154
+
+
+0.134658 0.436418 0.212381
+0.0566727 0.45453 0.201473
+0.0640387 0.434886 0.239416
+0.0635624 0.434855 0.239609
+0.0599167 0.434689 0.240928
+
+
+0.134658 0.436418 0.212381
+0.133037 0.436392 0.213038
+
+
+0.134658 0.436418 0.212381
+0.148939 0.436514 0.206817
+0.0840644 0.412413 0.270646
+0.0935079 0.382124 0.310127
+0.0939 0.38218 0.309927
+
+
+-0.180688 -0.0563908 0.476437
+-0.143539 -0.180191 0.444216
+-0.100434 -0.104959 0.484363
+-0.108459 -0.100147 0.483706
+-0.0534567 -0.0227233 0.497018
+-0.0453264 -0.137699 0.487986
+-0.0453426 -0.137689 0.487985
+
+
+-0.234259 0.339822 0.289375
+-0.156068 0.355593 0.31559
+-0.145936 0.284367 0.39411
+-0.139418 0.285015 0.396461
+-0.178942 0.188749 0.427498
+-0.102796 0.288629 0.409338
+-0.0972683 0.289184 0.411234
+-0.0871339 0.290111 0.414751
+
+
+-0.252188 0.429045 0.115503
+-0.246091 0.432744 0.116851
+
+
+-0.252188 0.429045 0.115503
+-0.263681 0.425199 -0.00886505
+-0.349304 0.367397 0.0937173
+-0.341638 0.372416 0.0955166
+-0.272468 0.359184 0.217136
+-0.143305 0.48312 0.156812
+
+
+-0.252188 0.429045 0.115503
+-0.256842 0.426197 0.114521
+-0.272468 0.359184 0.217136
+-0.154802 0.483317 0.142263
+-0.170633 0.475548 0.136364
+-0.224704 0.446302 -0.0268837
+-0.233327 0.442536 0.0134984
+-0.234986 0.4416 0.00896582
+-0.235364 0.441384 0.00774298
+
+
+-0.0259277 -0.416972 -0.27883
+-0.0257346 -0.416959 -0.278841
+0.0339636 -0.431711 -0.250744
+-0.045436 -0.472493 -0.182319
+-0.0484677 -0.469361 -0.188305
+-0.153551 -0.446874 -0.1647
+-0.179913 -0.449826 -0.126467
+-0.178734 -0.450409 -0.126005
+-0.175987 -0.451727 -0.125056
+
+
+-0.231369 -0.453521 0.032098
+-0.208416 -0.429931 0.148736
+-0.195622 -0.424383 0.178308
+-0.197389 -0.423208 0.179174
+-0.176814 -0.420902 0.204888
+-0.277949 -0.344401 0.261231
+-0.279604 -0.339565 0.269021
+-0.279444 -0.339544 0.269203
+-0.274163 -0.338911 0.27513
+
+
+-0.378195 0.267731 -0.221991
+-0.379515 0.273228 -0.212386
+-0.445457 0.167217 -0.154943
+-0.484974 0.16501 -0.0263579
+-0.480893 0.176719 -0.0254424
+-0.464303 0.153517 0.106091
+-0.416779 0.250432 0.151759
+-0.418702 0.242438 0.155931
+-0.41966 0.238509 0.15793
+
+
+-0.378195 0.267731 -0.221991
+-0.275798 0.344738 -0.234951
+-0.275798 0.344738 -0.234951
+-0.267615 0.341926 -0.247984
+
+
+-0.378195 0.267731 -0.221991
+-0.377917 0.266514 -0.224081
+
+
+-0.319489 -0.344093 -0.178173
+-0.316553 -0.347073 -0.177605
+
+
+-0.302264 -0.361305 -0.174958
+-0.305455 -0.358137 -0.175586
+
+
+-0.339181 -0.323863 -0.181712
+-0.335722 -0.327475 -0.181065
+
+
+-0.0255201 0.0427676 0.500148
+-0.0276259 0.0530095 0.500038
+
+
+-0.490355 -0.0576867 0.200539
+-0.361072 0.00364482 0.34643
+-0.332401 0.000127245 0.374044
+-0.332695 -0.000837047 0.373765
+-0.333632 -0.00353486 0.372869
+
+
+-0.138828 -0.493112 0.0447866
+-0.208416 -0.429931 0.148736
+-0.198178 -0.422715 0.179479
+-0.200011 -0.421488 0.180372
+-0.176814 -0.420902 0.204888
+-0.274633 -0.354054 0.245579
+-0.277239 -0.346532 0.257753
+-0.277949 -0.344401 0.261231
+
+
+-0.286902 -0.419693 -0.0304556
+-0.287604 -0.419803 -0.0277558
+
+
+-0.294156 -0.419642 -0.00643367
+-0.295876 -0.38485 0.121445
+-0.256692 -0.398155 0.16487
+-0.257199 -0.39584 0.17041
+-0.208416 -0.429931 0.148736
+-0.200835 -0.420968 0.180693
+-0.202774 -0.41966 0.181633
+-0.176814 -0.420902 0.204888
+-0.271856 -0.362034 0.232566
+-0.274049 -0.35579 0.242727
+-0.274633 -0.354054 0.245579
+
+
+-0.0466389 -0.431125 0.281452
+-0.0213985 -0.321575 0.382795
+-0.078832 -0.255038 0.430264
+-0.0732703 -0.251577 0.433433
+
+
+-0.358734 -0.296855 0.195669
+-0.32754 -0.35453 0.132009
+-0.274049 -0.35579 0.242727
+
+
+-0.390799 -0.305367 0.0936356
+-0.393381 -0.305935 0.0848433
+-0.413046 -0.239792 0.149308
+-0.407097 -0.308945 0.0370385
+-0.408332 -0.309239 0.0326134
+-0.414182 -0.310452 0.0120094
+-0.414631 -0.309904 0.011642
+
+
+-0.390799 -0.305367 0.0936356
+-0.32754 -0.35453 0.132009
+-0.277239 -0.346532 0.257753
+
+
+-0.390799 -0.305367 0.0936356
+-0.39025 -0.305219 0.0955559
+-0.413046 -0.239792 0.149308
+-0.401474 -0.307731 0.056765
+-0.402417 -0.307963 0.0534018
+-0.407097 -0.308945 0.0370385
+
+
+-0.316068 -0.196 -0.378209
+-0.330165 -0.191071 -0.367942
+
+
+-0.375327 -0.241555 0.237917
+-0.327379 -0.209631 0.315085
+-0.240667 -0.217903 0.392293
+-0.239981 -0.219734 0.391763
+-0.236769 -0.228499 0.389158
+
+
+-0.314896 -0.348724 -0.177333
+-0.311936 -0.351707 -0.176756
+
+
+-0.359149 -0.302858 -0.185213
+-0.354164 -0.308156 -0.184308
+
+
+-0.131001 -0.47233 -0.108697
+-0.188258 -0.456482 -0.0811385
+-0.176509 -0.477407 0.0396584
+-0.165656 -0.481979 0.0411477
+-0.164648 -0.482402 0.0412754
+
+
+-0.310964 -0.130151 0.378486
+-0.317241 -0.127552 0.373789
+-0.310123 -0.0280028 0.391714
+-0.194306 -0.0373158 0.475434
+-0.194513 -0.0312534 0.475709
+
+
+-0.310964 -0.130151 0.378486
+-0.327379 -0.209631 0.315085
+-0.244441 -0.207569 0.39531
+-0.243771 -0.209369 0.394796
+-0.240667 -0.217903 0.392293
+
+
+-0.310964 -0.130151 0.378486
+-0.309444 -0.130756 0.379627
+
+
+0.155019 -0.38121 0.284048
+0.179438 -0.375372 0.278026
+0.140826 -0.367489 0.309944
+
+
+-0.0124275 -0.53565 0.00869657
+-0.0100172 -0.53365 -0.00952594
+
+
+-0.230464 -0.453927 0.0322151
+-0.220537 -0.458344 0.0336049
+-0.219659 -0.458733 0.0337178
+-0.188258 -0.456482 -0.0811385
+-0.209067 -0.463394 0.035185
+-0.199358 -0.46762 0.0365335
+-0.198483 -0.468 0.0366452
+
+
+-0.256692 -0.398155 0.16487
+-0.256568 -0.398618 0.163798
+
+
+0.0859812 -0.404631 -0.284912
+0.0857884 -0.404656 -0.284908
+
+
+0.205402 -0.381474 0.250262
+0.207689 -0.380328 0.250226
+0.197178 -0.399894 0.226633
+0.197968 -0.399549 0.22653
+0.198815 -0.399215 0.226353
+0.199718 -0.398898 0.226091
+0.199814 -0.398868 0.226054
+0.206841 -0.402698 0.212311
+
+
+0.205402 -0.381474 0.250262
+0.179438 -0.375372 0.278026
+0.144948 -0.371498 0.302464
+
+
+0.205402 -0.381474 0.250262
+0.203714 -0.382373 0.2502
+0.196446 -0.400242 0.226677
+
+
+0.175782 -0.396189 0.249738
+0.191732 -0.403111 0.225717
+0.192135 -0.402796 0.225934
+0.192565 -0.402482 0.226122
+
+
+0.175782 -0.396189 0.249738
+0.177229 -0.395467 0.249826
+0.17902 -0.394642 0.249819
+0.192135 -0.402796 0.225934
+
+
+0.175782 -0.396189 0.249738
+0.173855 -0.397072 0.249737
+0.179438 -0.375372 0.278026
+0.147937 -0.374397 0.297027
+
+
+-0.295876 -0.38485 0.121445
+-0.257336 -0.395311 0.171632
+-0.257914 -0.392612 0.178036
+-0.208416 -0.429931 0.148736
+-0.203654 -0.419099 0.18198
+-0.205752 -0.417675 0.182989
+-0.176814 -0.420902 0.204888
+-0.249777 -0.387401 0.202908
+-0.254546 -0.384112 0.204985
+-0.260626 -0.379858 0.207758
+
+
+-0.295876 -0.38485 0.121445
+-0.25807 -0.391988 0.179471
+-0.258752 -0.388741 0.187118
+-0.208416 -0.429931 0.148736
+-0.20671 -0.417056 0.183372
+-0.209034 -0.41547 0.184482
+-0.176814 -0.420902 0.204888
+-0.23749 -0.39594 0.197362
+-0.240678 -0.393757 0.198736
+-0.249777 -0.387401 0.202908
+
+
+-0.295876 -0.38485 0.121445
+-0.258936 -0.387979 0.188863
+-0.259772 -0.383919 0.198358
+
+
+-0.295876 -0.38485 0.121445
+-0.267558 -0.369339 0.222178
+-0.27136 -0.363494 0.230152
+-0.271856 -0.362034 0.232566
+
+
+-0.295876 -0.38485 0.121445
+-0.277181 -0.364554 0.215221
+
+
+-0.295876 -0.38485 0.121445
+-0.28802 -0.366324 0.187866
+
+
+-0.295876 -0.38485 0.121445
+-0.294019 -0.367292 0.172687
+
+
+-0.295876 -0.38485 0.121445
+-0.297882 -0.367905 0.162879
+
+
+-0.295876 -0.38485 0.121445
+-0.300617 -0.368331 0.155903
+
+
+-0.295876 -0.38485 0.121445
+-0.302687 -0.368646 0.150597
+
+
+-0.295876 -0.38485 0.121445
+-0.304334 -0.36889 0.146351
+
+
+-0.295876 -0.38485 0.121445
+-0.305695 -0.369086 0.142815
+
+
+-0.295876 -0.38485 0.121445
+-0.306859 -0.369249 0.13977
+
+
+-0.295876 -0.38485 0.121445
+-0.307882 -0.369387 0.137071
+
+
+-0.295876 -0.38485 0.121445
+-0.308802 -0.369508 0.134618
+
+
+-0.295876 -0.38485 0.121445
+-0.309651 -0.369614 0.132338
+
+
+-0.295876 -0.38485 0.121445
+-0.31045 -0.369708 0.130174
+
+
+-0.295876 -0.38485 0.121445
+-0.31122 -0.369791 0.128079
+-0.31186 -0.369713 0.126741
+-0.32754 -0.35453 0.132009
+-0.306891 -0.320866 0.254208
+-0.302884 -0.323617 0.25642
+-0.296229 -0.328218 0.260016
+
+
+-0.295876 -0.38485 0.121445
+-0.311979 -0.369862 0.12601
+-0.312615 -0.369781 0.124665
+-0.32754 -0.35453 0.132009
+-0.316708 -0.314047 0.24882
+-0.312993 -0.316616 0.250887
+-0.306891 -0.320866 0.254208
+
+
+-0.295876 -0.38485 0.121445
+-0.312742 -0.369923 0.123925
+-0.313377 -0.369848 0.122543
+-0.32754 -0.35453 0.132009
+-0.325942 -0.307583 0.243712
+-0.322425 -0.310033 0.245684
+-0.316708 -0.314047 0.24882
+
+
+-0.295876 -0.38485 0.121445
+-0.313522 -0.369978 0.121782
+-0.314163 -0.369913 0.12033
+-0.32754 -0.35453 0.132009
+-0.334804 -0.30133 0.238771
+-0.331408 -0.303714 0.240691
+-0.325942 -0.307583 0.243712
+
+
+-0.295876 -0.38485 0.121445
+-0.314335 -0.370028 0.119533
+-0.314993 -0.369974 0.117977
+-0.32754 -0.35453 0.132009
+-0.343475 -0.295162 0.233897
+-0.340132 -0.297528 0.235802
+-0.334804 -0.30133 0.238771
+
+
+-0.295876 -0.38485 0.121445
+-0.315197 -0.370075 0.117124
+-0.31589 -0.370032 0.11542
+-0.32754 -0.35453 0.132009
+-0.350128 -0.294283 0.221124
+
+
+-0.295876 -0.38485 0.121445
+-0.316133 -0.370122 0.114486
+-0.316882 -0.370087 0.112575
+-0.32754 -0.35453 0.132009
+-0.354841 -0.295699 0.207233
+
+
+-0.295876 -0.38485 0.121445
+-0.317173 -0.370168 0.111525
+-0.318008 -0.370139 0.109327
+
+
+-0.295876 -0.38485 0.121445
+-0.319766 -0.37026 0.104048
+-0.320927 -0.370241 0.100847
+-0.32754 -0.35453 0.132009
+-0.362057 -0.29783 0.185714
+
+
+-0.295876 -0.38485 0.121445
+-0.32149 -0.370309 0.0990276
+-0.322954 -0.370292 0.0949148
+-0.32754 -0.35453 0.132009
+-0.364974 -0.298674 0.176897
+
+
+-0.295876 -0.38485 0.121445
+-0.323709 -0.370361 0.0925257
+-0.325671 -0.370346 0.0869302
+-0.32754 -0.35453 0.132009
+-0.367599 -0.299422 0.168886
+
+
+-0.295876 -0.38485 0.121445
+-0.326748 -0.370419 0.0835753
+-0.329601 -0.370407 0.0753384
+-0.32754 -0.35453 0.132009
+-0.370014 -0.3001 0.16144
+
+
+-0.295876 -0.38485 0.121445
+-0.331285 -0.370489 0.0701597
+-0.335962 -0.370482 0.0565211
+-0.32754 -0.35453 0.132009
+-0.372284 -0.300725 0.154369
+
+
+-0.295876 -0.38485 0.121445
+-0.339007 -0.370585 0.0472502
+-0.348395 -0.370594 0.0196481
+-0.32754 -0.35453 0.132009
+-0.376585 -0.301877 0.140751
+-0.378311 -0.302307 0.135243
+-0.413046 -0.239792 0.149308
+-0.397039 -0.306756 0.072209
+-0.397797 -0.306948 0.0695218
+-0.401474 -0.307731 0.056765
+
+
+-0.295876 -0.38485 0.121445
+-0.350072 -0.372066 0.00931186
+-0.34629 -0.375361 0.00820718
+
+
+-0.295876 -0.38485 0.121445
+-0.340976 -0.37997 0.00672832
+
+
+-0.295876 -0.38485 0.121445
+-0.323053 -0.395352 0.00166354
+-0.319303 -0.398538 0.000578803
+
+
+-0.295876 -0.38485 0.121445
+-0.284008 -0.425702 -0.000330076
+-0.277828 -0.429155 0.00414071
+-0.188258 -0.456482 -0.0811385
+-0.250611 -0.444057 0.0238691
+-0.247403 -0.445779 0.0262138
+
+
+-0.295876 -0.38485 0.121445
+-0.256356 -0.440952 0.0197513
+-0.250611 -0.444057 0.0238691
+
+
+-0.295876 -0.38485 0.121445
+-0.242116 -0.446267 0.0386585
+-0.244237 -0.440043 0.0558702
+-0.208416 -0.429931 0.148736
+-0.210105 -0.414771 0.184915
+-0.212748 -0.412958 0.186168
+-0.176814 -0.420902 0.204888
+-0.22883 -0.401934 0.193449
+-0.23115 -0.400357 0.194438
+-0.23749 -0.39594 0.197362
+
+
+-0.295876 -0.38485 0.121445
+-0.244638 -0.43894 0.0588527
+-0.246151 -0.434426 0.0712752
+-0.208416 -0.429931 0.148736
+-0.213978 -0.412146 0.186672
+-0.217073 -0.410013 0.188129
+-0.176814 -0.420902 0.204888
+-0.222284 -0.406443 0.190489
+-0.224081 -0.405233 0.191245
+-0.22883 -0.401934 0.193449
+
+
+-0.295876 -0.38485 0.121445
+-0.246452 -0.433594 0.0735031
+-0.247599 -0.430106 0.0830485
+-0.208416 -0.429931 0.148736
+-0.218531 -0.40904 0.188735
+-0.222284 -0.406443 0.190489
+
+
+-0.295876 -0.38485 0.121445
+-0.247838 -0.429444 0.0848046
+-0.248749 -0.426614 0.0924984
+-0.208416 -0.429931 0.148736
+-0.224081 -0.405233 0.191245
+
+
+-0.295876 -0.38485 0.121445
+-0.248946 -0.426064 0.0939425
+-0.249697 -0.423676 0.100387
+-0.208416 -0.429931 0.148736
+-0.23115 -0.400357 0.194438
+
+
+-0.295876 -0.38485 0.121445
+-0.249866 -0.423203 0.101616
+-0.250504 -0.421122 0.107189
+-0.208416 -0.429931 0.148736
+-0.240678 -0.393757 0.198736
+
+
+-0.295876 -0.38485 0.121445
+-0.250652 -0.420702 0.108268
+-0.251209 -0.418836 0.113223
+-0.208416 -0.429931 0.148736
+-0.254546 -0.384112 0.204985
+
+
+-0.295876 -0.38485 0.121445
+-0.251342 -0.418454 0.114194
+-0.25184 -0.416739 0.11871
+
+
+-0.284194 -0.419178 -0.0412042
+-0.283578 -0.419077 -0.0435496
+
+
+-0.152913 -0.487295 0.0428793
+-0.208416 -0.429931 0.148736
+-0.241543 -0.447841 0.0343666
+-0.242116 -0.446267 0.0386585
+
+
+0.260196 -0.429786 0.0871129
+0.259301 -0.430353 0.0889878
+0.25712 -0.431601 0.0888202
+
+
+0.109641 -0.479526 -0.147262
+0.117304 -0.476174 -0.152
+
+
+0.303583 -0.373034 0.160259
+0.303275 -0.37292 0.160866
+0.319882 -0.304039 0.235874
+0.254611 -0.344501 0.265269
+0.254396 -0.342386 0.268255
+0.25419 -0.339769 0.271874
+
+
+0.303583 -0.373034 0.160259
+0.218692 -0.40442 0.197018
+
+
+0.303583 -0.373034 0.160259
+0.304015 -0.373184 0.159423
+
+
+-0.199325 -0.328571 0.357579
+-0.199184 -0.327745 0.358293
+
+
+0.119704 -0.399908 -0.286072
+0.120108 -0.399854 -0.286081
+
+
+-0.189886 -0.436313 -0.154727
+-0.189687 -0.437491 -0.151671
+-0.153551 -0.446874 -0.1647
+-0.189893 -0.436106 -0.155294
+-0.189886 -0.436313 -0.154727
+-0.225451 -0.420597 -0.150567
+-0.192605 -0.412709 -0.212428
+-0.192211 -0.416373 -0.203785
+-0.153551 -0.446874 -0.1647
+-0.190091 -0.43473 -0.158858
+-0.190085 -0.434937 -0.158296
+-0.189893 -0.436106 -0.155294
+
+
+-0.194476 -0.392895 -0.258909
+-0.200424 -0.391952 -0.25349
+
+
+0.0374664 -0.410956 -0.282937
+0.0375288 -0.410951 -0.282938
+
+
+-0.116387 -0.404406 -0.297108
+-0.153551 -0.446874 -0.1647
+-0.190669 -0.430373 -0.169896
+-0.190662 -0.430609 -0.169281
+
+
+-0.116387 -0.404406 -0.297108
+-0.120758 -0.401213 -0.301225
+-0.12784 -0.396091 -0.307774
+-0.153551 -0.446874 -0.1647
+-0.190869 -0.42874 -0.173953
+-0.190861 -0.428996 -0.173292
+-0.190669 -0.430373 -0.169896
+
+
+-0.116387 -0.404406 -0.297108
+-0.11014 -0.408893 -0.291322
+0.0259521 -0.389689 -0.312841
+0.0263416 -0.412201 -0.282344
+0.0226457 -0.412593 -0.282128
+0.0339636 -0.431711 -0.250744
+-0.0500746 -0.467649 -0.191574
+-0.0529333 -0.46467 -0.19721
+-0.153551 -0.446874 -0.1647
+-0.191566 -0.422588 -0.188938
+-0.191549 -0.422971 -0.18799
+
+
+0.28183 0.322295 -0.289543
+0.277479 0.336196 -0.282485
+
+
+-0.241955 0.428293 -0.114181
+-0.224704 0.446302 -0.0268837
+-0.230622 0.444046 0.0211174
+-0.232823 0.44282 0.0150734
+-0.233327 0.442536 0.0134984
+
+
+0.0868772 -0.151486 -0.491251
+0.0806 -0.153779 -0.490618
+0.0542157 -0.290746 -0.403643
+-0.187029 -0.247056 -0.455112
+-0.190264 -0.24815 -0.454614
+-0.18779 -0.253367 -0.450713
+
+
+0.0868772 -0.151486 -0.491251
+0.0869994 -0.150288 -0.491402
+-0.0433918 -0.0459736 -0.496391
+-0.0266733 -0.191886 -0.478381
+-0.032591 -0.193981 -0.477597
+
+
+0.0868772 -0.151486 -0.491251
+0.0957225 -0.157286 -0.486164
+0.0542157 -0.290746 -0.403643
+-0.151883 -0.235074 -0.460487
+-0.171213 -0.241625 -0.457558
+-0.187029 -0.247056 -0.455112
+
+
+0.342913 -0.191786 -0.309248
+0.342502 -0.19229 -0.309395
+0.341375 -0.185628 -0.31471
+
+
+0.312875 -0.245767 -0.308213
+0.322376 -0.228645 -0.308664
+
+
+0.312875 -0.245767 -0.308213
+0.355725 -0.189246 -0.296411
+
+
+0.312875 -0.245767 -0.308213
+0.308981 -0.252607 -0.308135
+
+
+0.20776 -0.0209258 -0.4553
+0.206951 -0.0212347 -0.45566
+0.223301 -0.0667773 -0.442807
+0.348593 -0.0197276 -0.380047
+0.347311 -0.00869649 -0.382265
+0.346886 -0.00525817 -0.382971
+
+
+0.20776 -0.0209258 -0.4553
+0.197417 0.0278293 -0.458969
+0.198537 0.0653255 -0.454569
+0.199733 0.0655999 -0.454019
+0.182225 0.0994352 -0.45531
+0.177671 0.179981 -0.4359
+0.176094 0.180415 -0.436415
+0.1698 0.182042 -0.438502
+
+
+0.20776 -0.0209258 -0.4553
+0.211213 -0.0197421 -0.453749
+0.223301 -0.0667773 -0.442807
+0.350217 -0.0338275 -0.377155
+0.348995 -0.0230534 -0.379354
+0.348593 -0.0197276 -0.380047
+
+
+-0.260396 0.335007 -0.264867
+-0.264954 0.34395 -0.248058
+
+
+-0.315952 0.302761 -0.246665
+-0.324971 0.29529 -0.246524
+
+
+-0.315952 0.302761 -0.246665
+-0.276494 0.342179 -0.237766
+-0.276632 0.341177 -0.239008
+
+
+-0.315952 0.302761 -0.246665
+-0.302709 0.313499 -0.247169
+
+
+0.189109 0.39483 -0.252461
+0.194861 0.3916 -0.254155
+
+
+-0.393971 0.282149 -0.16265
+-0.396274 0.282782 -0.155401
+-0.310534 0.370612 -0.128901
+-0.306031 0.394432 -0.0599272
+-0.310848 0.39142 -0.0566572
+-0.31169 0.390886 -0.0561061
+
+
+0.0186743 -0.412996 -0.281893
+0.0145947 -0.413402 -0.281638
+0.0339636 -0.431711 -0.250744
+-0.0544629 -0.463023 -0.200321
+-0.0572131 -0.460131 -0.205738
+-0.153551 -0.446874 -0.1647
+-0.19186 -0.419807 -0.195607
+-0.191836 -0.42027 -0.194472
+-0.191566 -0.422588 -0.188938
+
+
+0.0186743 -0.412996 -0.281893
+0.0259521 -0.389689 -0.312841
+0.0225833 -0.412597 -0.282128
+0.0187399 -0.412992 -0.281895
+0.0339636 -0.431711 -0.250744
+-0.0586984 -0.458517 -0.208757
+-0.061396 -0.455654 -0.214064
+-0.153551 -0.446874 -0.1647
+-0.141131 -0.386377 -0.320128
+-0.147099 -0.381968 -0.325717
+-0.148397 -0.381016 -0.326914
+
+
+0.0186743 -0.412996 -0.281893
+0.0187399 -0.412992 -0.281895
+
+
+-0.0628666 -0.45404 -0.217052
+-0.0655634 -0.451151 -0.222352
+-0.153551 -0.446874 -0.1647
+-0.106234 -0.411727 -0.287634
+-0.11014 -0.408893 -0.291322
+
+
+-0.0628666 -0.45404 -0.217052
+0.0339636 -0.431711 -0.250744
+-0.0670477 -0.449507 -0.225365
+-0.0697954 -0.446535 -0.230761
+-0.153551 -0.446874 -0.1647
+-0.0970063 -0.418331 -0.279003
+-0.100581 -0.415756 -0.282388
+-0.106234 -0.411727 -0.287634
+
+
+-0.0628666 -0.45404 -0.217052
+-0.061396 -0.455654 -0.214064
+
+
+0.0673453 -0.407169 -0.28423
+0.0674648 -0.407155 -0.284231
+
+
+-0.19409 -0.396875 -0.249633
+-0.19397 -0.398554 -0.245665
+
+
+-0.156658 -0.383201 -0.314778
+-0.158637 -0.383703 -0.3119
+
+
+-0.192652 -0.411938 -0.21428
+-0.192605 -0.412709 -0.212428
+
+
+-0.0915265 -0.422208 -0.273903
+-0.0917704 -0.422033 -0.274135
+-0.0970063 -0.418331 -0.279003
+
+
+-0.0915265 -0.422208 -0.273903
+-0.0600667 -0.419726 -0.276289
+0.0259521 -0.389689 -0.312841
+0.0145244 -0.413407 -0.281636
+0.0100991 -0.413834 -0.28135
+
+
+-0.0915265 -0.422208 -0.273903
+-0.0914514 -0.422293 -0.273756
+0.0339636 -0.431711 -0.250744
+-0.0713231 -0.444828 -0.233858
+-0.0741777 -0.441712 -0.239461
+-0.153551 -0.446874 -0.1647
+-0.0893289 -0.424737 -0.269484
+-0.0914514 -0.422293 -0.273756
+
+
+-0.136613 -0.324107 -0.395633
+0.0259521 -0.389689 -0.312841
+0.00502026 -0.414305 -0.281017
+-0.00058386 -0.414813 -0.280634
+0.0339636 -0.431711 -0.250744
+-0.0757818 -0.439904 -0.242707
+-0.0788081 -0.43657 -0.248645
+-0.153551 -0.446874 -0.1647
+-0.0838066 -0.430972 -0.25855
+-0.0856939 -0.428813 -0.262356
+-0.0893289 -0.424737 -0.269484
+
+
+0.0249315 -0.343255 -0.366244
+0.0292527 -0.343677 -0.365408
+
+
+0.0249315 -0.343255 -0.366244
+0.0259521 -0.389689 -0.312841
+-0.000684082 -0.41482 -0.28063
+-0.00726839 -0.415401 -0.280169
+
+
+0.0249315 -0.343255 -0.366244
+0.02233 -0.342959 -0.36678
+
+
+0.187214 -0.356537 -0.330182
+0.0259521 -0.389689 -0.312841
+-0.0155504 -0.416107 -0.279583
+-0.0257346 -0.416959 -0.278841
+
+
+-0.268636 0.332892 -0.259037
+-0.269283 0.332893 -0.258343
+
+
+-0.268636 0.332892 -0.259037
+-0.268452 0.341231 -0.248029
+
+
+-0.268636 0.332892 -0.259037
+-0.268359 0.332856 -0.25938
+-0.26752 0.33285 -0.260279
+
+
+-0.0920222 -0.214532 -0.469382
+-0.100699 -0.217549 -0.46811
+
+
+-0.0920222 -0.214532 -0.469382
+-0.0433918 -0.0459736 -0.496391
+-0.0563968 -0.202232 -0.474407
+-0.0632308 -0.20463 -0.473451
+
+
+-0.0920222 -0.214532 -0.469382
+-0.0807978 -0.210699 -0.470979
+
+
+0.303869 0.0668217 -0.405355
+0.308795 0.0619605 -0.403365
+0.306299 0.180405 -0.352186
+0.299186 0.0715124 -0.407216
+0.303869 0.0668217 -0.405355
+0.197417 0.0278293 -0.458969
+0.20206 0.0659908 -0.452964
+0.203332 0.0662793 -0.452373
+0.182225 0.0994352 -0.45531
+0.1852 0.177995 -0.43338
+0.183679 0.178417 -0.433883
+0.177671 0.179981 -0.4359
+
+
+0.2496 0.360545 -0.269775
+0.237734 0.367357 -0.266368
+
+
+0.348995 -0.0230534 -0.379354
+0.429296 -0.00494892 -0.257062
+0.416084 -0.105032 -0.269293
+0.417953 -0.106483 -0.266068
+0.420959 -0.108732 -0.260887
+
+
+0.29289 0.00936662 -0.414364
+0.197417 0.0278293 -0.458969
+0.205833 0.0667025 -0.451227
+0.207216 0.0670117 -0.45058
+0.182225 0.0994352 -0.45531
+0.207247 0.172094 -0.425814
+0.205717 0.172528 -0.42634
+
+
+0.222101 0.376258 -0.261925
+0.231451 0.370916 -0.264625
+
+
+-0.123902 -0.225508 -0.464692
+-0.139448 -0.230788 -0.46238
+-0.151883 -0.235074 -0.460487
+
+
+0.109904 -0.166539 -0.477947
+0.108472 -0.165618 -0.478776
+0.0542157 -0.290746 -0.403643
+0.12032 -0.173352 -0.471847
+0.109904 -0.166539 -0.477947
+0.223301 -0.0667773 -0.442807
+0.343505 -0.0490546 -0.378661
+0.343612 -0.0489026 -0.378624
+0.350759 -0.0384979 -0.376173
+0.350605 -0.0371072 -0.376462
+0.350217 -0.0338275 -0.377155
+
+
+0.337518 -0.201521 -0.309158
+0.336921 -0.202498 -0.309203
+0.338813 -0.182463 -0.31944
+
+
+0.341977 -0.185984 -0.313827
+0.345992 -0.18575 -0.309497
+
+
+0.342502 -0.19229 -0.309395
+0.341442 -0.194421 -0.309251
+0.350076 -0.189772 -0.302481
+
+
+0.341021 -0.195028 -0.30934
+0.341442 -0.194421 -0.309251
+
+
+0.285035 -0.295566 -0.307053
+0.35624 -0.189045 -0.295945
+
+
+0.00572645 -0.0358357 -0.4996
+0.00633268 -0.0361517 -0.499602
+-0.0112878 0.011464 -0.500142
+-0.0799684 0.051614 -0.494484
+-0.0811898 0.0465746 -0.494622
+
+
+0.00572645 -0.0358357 -0.4996
+-0.0433918 -0.0459736 -0.496391
+-0.139448 -0.230788 -0.46238
+
+
+0.00572645 -0.0358357 -0.4996
+0.000309987 -0.0327849 -0.499589
+-0.0112878 0.011464 -0.500142
+-0.0780182 0.0598484 -0.494224
+-0.0793225 0.0544771 -0.494392
+-0.0799684 0.051614 -0.494484
+
+
+0.0259521 -0.389689 -0.312841
+-0.0917704 -0.422033 -0.274135
+
+
+0.0259521 -0.389689 -0.312841
+-0.100581 -0.415756 -0.282388
+
+
+0.0259521 -0.389689 -0.312841
+-0.120758 -0.401213 -0.301225
+
+
+0.0259521 -0.389689 -0.312841
+-0.132868 -0.392396 -0.312496
+-0.141131 -0.386377 -0.320128
+
+
+0.0259521 -0.389689 -0.312841
+-0.147099 -0.381968 -0.325717
+
+
+0.0259521 -0.389689 -0.312841
+-0.0950269 -0.329235 -0.388287
+
+
+0.0259521 -0.389689 -0.312841
+-0.0671399 -0.33264 -0.383323
+
+
+0.0259521 -0.389689 -0.312841
+-0.0310625 -0.336967 -0.376815
+-0.022752 -0.337914 -0.375321
+
+
+0.0259521 -0.389689 -0.312841
+-0.00753627 -0.339701 -0.372474
+-0.00152096 -0.340356 -0.37137
+
+
+0.0259521 -0.389689 -0.312841
+0.00180909 -0.340755 -0.370716
+
+
+0.0259521 -0.389689 -0.312841
+0.0177892 -0.342502 -0.367646
+
+
+0.0259521 -0.389689 -0.312841
+0.0317532 -0.343956 -0.364885
+
+
+0.0259521 -0.389689 -0.312841
+0.0383989 -0.344621 -0.363541
+
+
+0.0259521 -0.389689 -0.312841
+0.0449996 -0.345263 -0.362186
+
+
+0.0259521 -0.389689 -0.312841
+0.0516827 -0.345895 -0.360795
+
+
+0.0259521 -0.389689 -0.312841
+0.0658492 -0.347178 -0.357782
+0.0706913 -0.347575 -0.356758
+
+
+0.0259521 -0.389689 -0.312841
+0.0736677 -0.347856 -0.356086
+
+
+0.0259521 -0.389689 -0.312841
+0.0822737 -0.34858 -0.354196
+
+
+0.0259521 -0.389689 -0.312841
+0.091988 -0.349376 -0.352038
+
+
+0.0259521 -0.389689 -0.312841
+0.10327 -0.350275 -0.349504
+
+
+0.0259521 -0.389689 -0.312841
+0.116816 -0.351327 -0.346432
+
+
+0.0259521 -0.389689 -0.312841
+0.133741 -0.352611 -0.342559
+
+
+0.0259521 -0.389689 -0.312841
+0.155981 -0.354262 -0.337431
+
+
+0.0259521 -0.389689 -0.312841
+0.235443 -0.359995 -0.318927
+
+
+0.347592 0.0587954 0.35461
+0.347917 0.05913 0.354236
+
+
+0.330842 0.106356 0.359583
+0.331645 0.107026 0.358662
+
+
+0.330842 0.106356 0.359583
+0.318603 0.113122 0.368465
+0.318046 0.112347 0.369192
+0.317511 0.111782 0.369833
+0.310853 0.128247 0.370133
+
+
+0.330842 0.106356 0.359583
+0.329892 0.105288 0.360749
+
+
+0.390134 0.0351871 0.312545
+0.390342 0.0354836 0.312221
+
+
+0.385397 0.158158 0.281829
+0.381268 0.165772 0.284391
+
+
+0.393192 0.143602 0.276949
+0.390272 0.149048 0.278804
+
+
+0.373835 0.179497 0.288917
+0.366963 0.192056 0.293099
+
+
+0.401767 0.12731 0.271413
+0.399632 0.131374 0.272825
+
+
+0.406557 0.118025 0.268211
+0.404626 0.12176 0.269525
+
+
+0.411132 0.109006 0.265062
+0.409244 0.112718 0.266384
+
+
+0.421151 0.0887411 0.257859
+0.418861 0.0934 0.259551
+
+
+0.407817 0.0598126 0.284011
+0.408287 0.0605395 0.283203
+
+
+0.400775 0.0498146 0.295704
+0.401249 0.0505282 0.294924
+
+
+0.385003 0.0421206 0.317388
+0.386876 0.0396389 0.315621
+
+
+0.367198 0.0657722 0.333437
+0.368437 0.0642251 0.332355
+
+
+0.329164 0.104704 0.361572
+0.318046 0.112347 0.369192
+
+
+0.344628 0.0566995 0.357823
+0.344939 0.0570294 0.357471
+
+
+0.334921 0.110391 0.354694
+0.335989 0.111345 0.353434
+
+
+0.334921 0.110391 0.354694
+0.319645 0.114979 0.366962
+0.319127 0.114 0.367729
+
+
+0.334921 0.110391 0.354694
+0.333642 0.10901 0.356267
+
+
+0.178178 0.349884 0.311521
+0.127516 0.351781 0.332251
+0.15385 0.305205 0.3676
+
+
+-0.335423 -0.353515 -0.113662
+-0.432994 -0.246818 -0.13195
+
+
+-0.335423 -0.353515 -0.113662
+-0.426105 -0.249505 -0.144678
+
+
+-0.335423 -0.353515 -0.113662
+-0.286341 -0.380491 -0.161636
+-0.286333 -0.380524 -0.16156
+
+
+-0.335423 -0.353515 -0.113662
+-0.285245 -0.38616 -0.148067
+-0.285238 -0.386188 -0.148
+
+
+-0.335423 -0.353515 -0.113662
+-0.284716 -0.38875 -0.141783
+
+
+-0.335423 -0.353515 -0.113662
+-0.284185 -0.391255 -0.135648
+
+
+-0.335423 -0.353515 -0.113662
+-0.283079 -0.396209 -0.123347
+-0.283071 -0.396236 -0.123281
+
+
+-0.335423 -0.353515 -0.113662
+-0.28248 -0.398754 -0.116937
+
+
+0.152818 -0.395212 -0.287159
+0.15212 -0.395308 -0.287142
+
+
+0.177625 -0.470277 0.0944972
+0.211519 -0.409889 0.193436
+
+
+0.121897 -0.349096 0.344061
+0.105621 -0.333127 0.373506
+
+
+-0.251342 -0.418454 0.114194
+-0.251209 -0.418836 0.113223
+
+
+-0.281174 -0.418595 -0.0530179
+-0.280619 -0.418499 -0.0551114
+
+
+-0.271453 -0.419855 -0.0716289
+-0.277471 -0.417845 -0.0673104
+-0.277917 -0.417944 -0.0655819
+
+
+-0.277367 -0.378143 -0.181611
+-0.272423 -0.379175 -0.186366
+
+
+-0.274477 -0.431016 0.0066118
+-0.277828 -0.429155 0.00414071
+
+
+-0.323053 -0.395352 0.00166354
+-0.328338 -0.390843 0.00312415
+
+
+-0.350072 -0.372066 0.00931186
+-0.351672 -0.370667 0.00975897
+-0.3554 -0.367162 0.00987233
+
+
+-0.383618 -0.340244 0.0108881
+-0.377919 -0.34573 0.0107125
+
+
+-0.476726 -0.0728827 0.215693
+-0.477939 -0.0715253 0.214355
+-0.361072 0.00364482 0.34643
+-0.33107 0.00405937 0.375294
+-0.331392 0.00301689 0.374993
+-0.332401 0.000127245 0.374044
+
+
+-0.445577 -0.107093 0.24973
+-0.443049 -0.112049 0.249358
+-0.434353 -0.129194 0.247946
+
+
+-0.445577 -0.107093 0.24973
+-0.432962 -0.107156 0.263674
+-0.327379 -0.209631 0.315085
+-0.248165 -0.197294 0.398269
+-0.247499 -0.199098 0.397761
+-0.244441 -0.207569 0.39531
+
+
+-0.445577 -0.107093 0.24973
+-0.445976 -0.106662 0.249301
+
+
+-0.536382 -0.0632777 0.0604142
+-0.532217 -0.060946 0.0764563
+-0.530409 -0.0599787 0.0833504
+
+
+-0.354777 -0.278283 0.233981
+-0.327379 -0.209631 0.315085
+-0.251911 -0.18688 0.401227
+-0.251235 -0.188723 0.400716
+-0.248165 -0.197294 0.398269
+
+
+-0.331408 -0.303714 0.240691
+-0.327379 -0.209631 0.315085
+-0.255752 -0.176121 0.404242
+-0.255054 -0.17804 0.403717
+-0.251911 -0.18688 0.401227
+
+
+-0.302884 -0.323617 0.25642
+-0.327379 -0.209631 0.315085
+-0.284547 -0.140884 0.397974
+-0.292357 -0.137711 0.392266
+
+
+-0.340132 -0.297528 0.235802
+-0.327379 -0.209631 0.315085
+-0.294114 -0.137019 0.390969
+
+
+-0.536045 -0.00967371 -0.0568153
+-0.534751 -0.00897247 -0.060092
+
+
+-0.381921 -0.0820254 -0.333291
+-0.380343 -0.0854832 -0.334402
+
+
+-0.438159 0.292752 -0.0162717
+-0.434054 0.299195 -0.00760007
+-0.464303 0.153517 0.106091
+-0.41336 0.264388 0.14451
+-0.415656 0.254981 0.149433
+-0.416779 0.250432 0.151759
+
+
+-0.438159 0.292752 -0.0162717
+-0.437614 0.292638 -0.0181431
+
+
+-0.438159 0.292752 -0.0162717
+-0.440916 0.285525 -0.0168528
+-0.445457 0.167217 -0.154943
+-0.480641 0.177438 -0.0253928
+-0.476469 0.189252 -0.0244652
+-0.464303 0.153517 0.106091
+-0.402283 0.316238 0.109248
+-0.402009 0.309719 0.12086
+
+
+-0.33158 0.139601 0.367612
+-0.328368 0.141252 0.370789
+-0.361072 0.00364482 0.34643
+-0.329596 0.00837827 0.376655
+-0.329959 0.00722485 0.376321
+-0.33107 0.00405937 0.375294
+
+
+-0.33158 0.139601 0.367612
+-0.377121 0.208972 0.25399
+-0.38312 0.112186 0.315671
+-0.381065 0.113279 0.317801
+
+
+-0.33158 0.139601 0.367612
+-0.339311 0.135527 0.359973
+-0.361072 0.00364482 0.34643
+-0.32363 0.0256149 0.381986
+-0.324242 0.0237621 0.381449
+-0.325976 0.0188745 0.379916
+
+
+-0.0525033 0.354963 0.360369
+-0.156068 0.355593 0.31559
+-0.135437 0.285445 0.397862
+-0.128418 0.286127 0.400368
+-0.178942 0.188749 0.427498
+-0.116354 0.287319 0.404612
+-0.111523 0.287815 0.406282
+-0.102796 0.288629 0.409338
+
+
+-0.402417 -0.307963 0.0534018
+-0.32754 -0.35453 0.132009
+-0.378702 -0.302427 0.133936
+-0.380451 -0.302853 0.128292
+
+
+-0.362909 0.357742 -0.0210169
+-0.263681 0.425199 -0.00886505
+-0.335953 0.376139 0.096791
+-0.329088 0.3806 0.0983942
+
+
+-0.36819 -0.293242 -0.186779
+-0.362201 -0.299638 -0.185703
+
+
+-0.282946 -0.376957 -0.17621
+-0.277702 -0.378077 -0.181279
+
+
+-0.234973 -0.38624 -0.221717
+-0.228644 -0.387331 -0.227569
+
+
+-0.19138 -0.444881 -0.127392
+-0.188258 -0.456482 -0.0811385
+-0.265235 -0.421954 -0.0759666
+
+
+-0.171355 -0.387011 -0.293179
+-0.169788 -0.386621 -0.295462
+
+
+-0.241091 -0.44915 0.0307319
+-0.241543 -0.447841 0.0343666
+
+
+-0.209935 -0.463013 0.0350738
+-0.209067 -0.463394 0.035185
+
+
+-0.209935 -0.463013 0.0350738
+-0.208416 -0.429931 0.148736
+-0.220537 -0.458344 0.0336049
+
+
+-0.209935 -0.463013 0.0350738
+-0.219659 -0.458733 0.0337178
+
+
+0.0455812 -0.409984 -0.283322
+0.045511 -0.409991 -0.283322
+
+
+0.0549873 -0.408796 -0.283736
+0.0550739 -0.408786 -0.283737
+
+
+0.0413696 -0.410494 -0.283128
+0.0414352 -0.410488 -0.283129
+
+
+0.483906 -0.0192191 -0.129489
+0.485255 -0.0133233 -0.126905
+
+
+0.468088 -0.112256 0.178897
+0.468791 -0.111976 0.175881
+
+
+0.511263 0.0494679 -0.0299197
+0.511592 0.0475454 -0.0317741
+0.49032 -0.00243348 0.0999044
+0.508872 -0.0299056 -0.0159178
+
+
+0.511263 0.0494679 -0.0299197
+0.46327 0.170236 -0.0821645
+
+
+0.511263 0.0494679 -0.0299197
+0.509782 0.0579912 -0.0215577
+0.49032 -0.00243348 0.0999044
+0.511065 0.00587404 -0.0276058
+
+
+0.448226 -0.149002 0.201277
+0.445688 -0.15447 0.202327
+
+
+0.396396 -0.211391 0.24133
+0.389717 -0.206599 0.251847
+
+
+0.421653 -0.259755 0.0693226
+0.420885 -0.242819 0.129943
+0.421911 -0.240573 0.131802
+
+
+0.371458 -0.229694 0.25394
+0.376595 -0.225901 0.251384
+
+
+0.390799 -0.215483 0.244197
+0.30802 -0.229117 0.320982
+0.310833 -0.272811 0.283505
+
+
+0.4034 -0.279926 0.0982916
+0.403374 -0.280417 0.0966785
+
+
+0.43647 -0.232944 0.0743379
+0.436601 -0.232849 0.073835
+
+
+0.4373 -0.232441 0.0708028
+0.437426 -0.232348 0.0703164
+
+
+0.435728 -0.233366 0.0775029
+0.435588 -0.233463 0.0780336
+
+
+0.428118 -0.253143 0.0517699
+0.419964 -0.267095 0.0488406
+
+
+0.439658 -0.230929 0.0604411
+0.43978 -0.230832 0.0599459
+
+
+0.42771 -0.254783 0.0466106
+0.420934 -0.265881 0.0468179
+
+
+0.45134 -0.22192 0.00332983
+0.454199 -0.219562 -0.0114284
+0.427596 -0.255149 0.0456068
+
+
+0.45134 -0.22192 0.00332983
+0.452817 -0.199577 0.0743398
+0.439 -0.231349 0.063439
+
+
+0.45134 -0.22192 0.00332983
+0.450933 -0.222274 0.00533494
+
+
+0.425857 -0.258853 0.0405405
+0.425679 -0.259316 0.0394219
+0.424877 -0.260665 0.0391668
+0.424524 -0.2612 0.0394431
+
+
+0.442288 -0.229074 0.048341
+0.443096 -0.228493 0.0444281
+
+
+0.442288 -0.229074 0.048341
+0.452817 -0.199577 0.0743398
+0.447052 -0.225413 0.0250531
+
+
+0.442288 -0.229074 0.048341
+0.442147 -0.229191 0.0489464
+
+
+0.428326 -0.256273 0.0306691
+0.42668 -0.25839 0.0346218
+0.425679 -0.259316 0.0394219
+
+
+0.428326 -0.256273 0.0306691
+0.423559 -0.263196 0.0364474
+0.422897 -0.264307 0.0361221
+0.422536 -0.263848 0.0433053
+
+
+0.428326 -0.256273 0.0306691
+0.429845 -0.254219 0.0276694
+0.426301 -0.258045 0.0410433
+
+
+0.427578 -0.23774 0.110019
+0.42724 -0.237931 0.111277
+
+
+0.424537 -0.23929 0.121696
+0.424984 -0.239046 0.120037
+
+
+0.428015 -0.253823 0.0491049
+0.42042 -0.266528 0.0478927
+
+
+0.454793 -0.219047 -0.0143969
+0.454199 -0.219562 -0.0114284
+
+
+0.433053 -0.25001 0.0203866
+0.429845 -0.254219 0.0276694
+
+
+0.433053 -0.25001 0.0203866
+0.422624 -0.264813 0.0356382
+0.42174 -0.266298 0.0350941
+0.421764 -0.264837 0.0449841
+
+
+0.433053 -0.25001 0.0203866
+0.436191 -0.245807 0.0138197
+
+
+0.486048 -0.151319 -0.0309028
+0.452817 -0.199577 0.0743398
+0.482825 -0.160883 -0.0373563
+0.484294 -0.156538 -0.0344587
+
+
+0.471289 -0.0712043 -0.151314
+0.471691 -0.0698459 -0.150667
+
+
+0.443336 -0.144237 -0.197153
+0.441887 -0.144118 -0.200986
+
+
+0.49868 0.115392 0.0347342
+0.499042 0.113673 0.0330675
+
+
+0.49868 0.115392 0.0347342
+0.463175 0.170808 -0.0815055
+
+
+0.49868 0.115392 0.0347342
+0.496937 0.123556 0.0427933
+
+
+0.433785 0.0670793 -0.245267
+0.432475 0.067095 -0.247478
+
+
+0.464611 -0.0942933 -0.160732
+0.467061 -0.0515947 -0.172025
+0.467595 -0.084173 -0.156615
+
+
+0.435458 -0.14374 -0.217679
+0.433695 -0.143591 -0.222245
+
+
+0.493246 0.12315 0.062342
+0.491714 0.120108 0.0708529
+
+
+0.502507 0.0967786 0.0164387
+0.502827 0.0951671 0.0148799
+
+
+0.502507 0.0967786 0.0164387
+0.463216 0.17062 -0.0816749
+
+
+0.502507 0.0967786 0.0164387
+0.50099 0.104278 0.02383
+
+
+0.480258 -0.107579 0.124992
+0.480679 -0.107392 0.123076
+
+
+0.452817 -0.199577 0.0743398
+0.489177 -0.141884 -0.0245437
+
+
+0.452817 -0.199577 0.0743398
+0.495395 -0.122679 -0.0116179
+
+
+0.452817 -0.199577 0.0743398
+0.501977 -0.101683 0.00248477
+
+
+0.452817 -0.199577 0.0743398
+0.501963 -0.0974214 0.0148104
+
+
+0.452817 -0.199577 0.0743398
+0.499366 -0.0987875 0.0291595
+
+
+0.452817 -0.199577 0.0743398
+0.497017 -0.0999919 0.0418967
+
+
+0.452817 -0.199577 0.0743398
+0.494837 -0.10108 0.0534866
+
+
+0.452817 -0.199577 0.0743398
+0.492767 -0.102085 0.0642728
+
+
+-0.340177 -0.200744 -0.34387
+-0.341726 -0.202211 -0.340157
+
+
+-0.245165 0.081534 -0.436007
+-0.156562 0.0450098 -0.473141
+-0.224216 -0.0049546 -0.451843
+-0.223808 -0.00665224 -0.452111
+-0.221955 -0.0139027 -0.453296
+
+
+-0.245165 0.081534 -0.436007
+-0.244642 0.0792084 -0.436458
+-0.242518 0.0702648 -0.438234
+-0.156562 0.0450098 -0.473141
+-0.226314 0.00340858 -0.450456
+-0.225933 0.00180789 -0.450714
+-0.224216 -0.0049546 -0.451843
+
+
+-0.245165 0.081534 -0.436007
+-0.247603 0.0918715 -0.433923
+-0.296119 -0.00157042 -0.403375
+-0.38728 -0.0703477 -0.329446
+-0.391046 -0.0621219 -0.326697
+-0.433806 -0.126861 -0.214754
+-0.4651 0.0279915 -0.228257
+-0.465836 0.0276346 -0.226585
+-0.471234 0.0248998 -0.214251
+
+
+-0.405401 0.104685 -0.314831
+-0.399273 0.116694 -0.319282
+-0.445457 0.167217 -0.154943
+-0.476209 0.189984 -0.0244143
+-0.471864 0.202136 -0.0234564
+
+
+-0.405401 0.104685 -0.314831
+-0.296119 -0.00157042 -0.403375
+-0.39258 -0.0587019 -0.325579
+-0.396366 -0.050364 -0.32277
+-0.433806 -0.126861 -0.214754
+-0.458668 0.031201 -0.242785
+-0.459446 0.030827 -0.241036
+-0.4651 0.0279915 -0.228257
+
+
+-0.405401 0.104685 -0.314831
+-0.406819 0.101925 -0.313784
+-0.445457 0.167217 -0.154943
+-0.461356 0.230985 -0.0211903
+-0.455812 0.245951 -0.0199975
+
+
+-0.136418 0.388112 -0.308769
+-0.13827 0.388018 -0.307462
+-0.14519 0.384186 -0.306151
+-0.250076 0.305099 -0.307859
+-0.231467 0.336277 -0.289433
+-0.232744 0.33559 -0.289137
+-0.235782 0.333832 -0.288563
+
+
+-0.136418 0.388112 -0.308769
+-0.164923 0.436861 -0.17987
+-0.137356 0.453367 -0.160911
+-0.137861 0.453549 -0.159982
+-0.139243 0.453937 -0.157723
+
+
+-0.136418 0.388112 -0.308769
+-0.124076 0.388645 -0.317577
+-0.250076 0.305099 -0.307859
+-0.226263 0.33921 -0.290471
+-0.227821 0.338368 -0.290121
+-0.231467 0.336277 -0.289433
+
+
+-0.255214 0.339083 -0.264716
+-0.262747 0.345631 -0.248068
+
+
+-0.246488 0.327724 -0.286308
+-0.257321 0.337074 -0.265264
+
+
+0.0988323 0.486235 -0.111599
+0.0911689 0.486939 -0.11766
+
+
+-0.128406 0.450527 -0.175801
+-0.129878 0.450988 -0.173434
+-0.164923 0.436861 -0.17987
+-0.135512 0.452798 -0.164016
+-0.136008 0.45298 -0.163105
+-0.137356 0.453367 -0.160911
+
+
+-0.128406 0.450527 -0.175801
+-0.104262 0.466121 -0.149203
+-0.111614 0.488583 -0.0617549
+-0.10453 0.488767 -0.0668119
+
+
+-0.128406 0.450527 -0.175801
+-0.127836 0.450307 -0.176822
+-0.164923 0.436861 -0.17987
+-0.133675 0.45222 -0.167098
+-0.134173 0.452406 -0.166187
+-0.135512 0.452798 -0.164016
+
+
+-0.251964 0.351979 -0.250257
+-0.254347 0.35175 -0.248158
+
+
+-0.119414 0.388868 -0.320857
+-0.124076 0.388645 -0.317577
+
+
+-0.119414 0.388868 -0.320857
+-0.164923 0.436861 -0.17987
+-0.13181 0.45162 -0.170216
+-0.132319 0.451814 -0.169288
+-0.133675 0.45222 -0.167098
+
+
+-0.119414 0.388868 -0.320857
+-0.104043 0.389495 -0.331783
+-0.250076 0.305099 -0.307859
+-0.219728 0.342873 -0.29176
+-0.221714 0.341797 -0.291328
+-0.226263 0.33921 -0.290471
+
+
+-0.263288 0.333723 -0.263573
+-0.266072 0.343088 -0.24805
+
+
+-0.265598 0.170006 -0.417775
+-0.257453 0.174424 -0.420162
+-0.252362 0.177217 -0.421625
+-0.250076 0.305099 -0.307859
+-0.179859 0.365022 -0.299493
+-0.186145 0.36159 -0.298226
+-0.198887 0.354477 -0.295821
+
+
+-0.265598 0.170006 -0.417775
+-0.262215 0.155304 -0.42087
+-0.156562 0.0450098 -0.473141
+-0.228302 0.0113893 -0.449104
+-0.227939 0.00984918 -0.449357
+-0.226314 0.00340858 -0.450456
+
+
+-0.265598 0.170006 -0.417775
+-0.267159 0.169895 -0.416653
+-0.250076 0.305099 -0.307859
+-0.0782318 0.390431 -0.350127
+-0.0782534 0.390531 -0.35001
+-0.0981095 0.389761 -0.335949
+-0.104043 0.389495 -0.331783
+
+
+-0.242366 0.360523 -0.247765
+-0.243856 0.359375 -0.247908
+
+
+-0.242366 0.360523 -0.247765
+-0.255401 0.355433 -0.241793
+-0.256345 0.35583 -0.240234
+
+
+-0.242366 0.360523 -0.247765
+-0.238187 0.363432 -0.247799
+
+
+0.19506 0.329057 -0.332104
+0.192937 0.328623 -0.33351
+
+
+0.020706 0.463376 -0.225471
+0.0142373 0.459752 -0.232485
+
+
+-0.16904 0.466566 -0.0908677
+-0.170252 0.465881 -0.0921414
+
+
+-0.242987 0.404886 -0.176569
+-0.266291 0.35464 -0.231304
+-0.266849 0.35436 -0.2311
+-0.267388 0.354063 -0.230941
+-0.267623 0.353922 -0.230888
+-0.263103 0.345392 -0.248024
+
+
+-0.114528 0.445672 -0.198616
+-0.117232 0.446612 -0.194275
+-0.164923 0.436861 -0.17987
+-0.120444 0.447753 -0.18901
+-0.121246 0.448066 -0.187616
+-0.123199 0.448719 -0.184479
+
+
+-0.114528 0.445672 -0.198616
+-0.104262 0.466121 -0.149203
+-0.0954606 0.488955 -0.0733396
+-0.0898464 0.489055 -0.0773306
+-0.0248719 0.498374 -0.0374832
+-0.00153962 0.50037 -0.00513887
+-0.00272932 0.500382 -0.00404494
+-0.00454678 0.500394 -0.00253039
+
+
+-0.114528 0.445672 -0.198616
+-0.113362 0.445219 -0.200602
+-0.164923 0.436861 -0.17987
+-0.108508 0.443451 -0.208522
+-0.110001 0.444031 -0.206002
+-0.113362 0.445219 -0.200602
+
+
+0.158567 0.411586 -0.243526
+0.16291 0.40922 -0.24484
+
+
+0.185832 0.396633 -0.251544
+0.180648 0.399524 -0.250007
+
+
+0.241858 0.338809 -0.300293
+0.238118 0.338068 -0.302834
+
+
+0.0581689 0.300661 -0.415296
+0.0623142 0.298046 -0.416949
+0.0631839 0.294798 -0.418641
+0.198312 0.245013 -0.388641
+0.268297 0.255531 -0.341937
+
+
+0.0581689 0.300661 -0.415296
+-0.0533786 0.210915 -0.450628
+-0.0120274 0.34422 -0.386318
+
+
+0.0581689 0.300661 -0.415296
+0.056661 0.301624 -0.414681
+
+
+0.282616 0.31982 -0.29078
+0.28552 0.310453 -0.295505
+
+
+0.0294544 0.128692 -0.493407
+-0.0112878 0.011464 -0.500142
+-0.0758956 0.0687849 -0.493909
+-0.0773188 0.0629325 -0.494114
+-0.0780182 0.0598484 -0.494224
+
+
+0.0294544 0.128692 -0.493407
+0.0269858 0.128193 -0.49341
+0.0162692 0.125916 -0.493428
+
+
+0.0294544 0.128692 -0.493407
+0.041486 0.131238 -0.493346
+-0.0533786 0.210915 -0.450628
+0.0646379 0.289163 -0.421573
+0.0666408 0.281654 -0.425449
+
+
+0.165274 -0.202567 -0.444926
+0.16399 -0.201749 -0.445703
+0.0542157 -0.290746 -0.403643
+0.153189 -0.194741 -0.452263
+0.143714 -0.188572 -0.457971
+0.142448 -0.187763 -0.458724
+
+
+0.165274 -0.202567 -0.444926
+0.223301 -0.0667773 -0.442807
+0.334082 -0.0627175 -0.381844
+0.334172 -0.0625887 -0.381813
+0.343505 -0.0490546 -0.378661
+
+
+0.165274 -0.202567 -0.444926
+0.175064 -0.208922 -0.438915
+0.0542157 -0.290746 -0.403643
+0.186642 -0.216411 -0.431753
+0.176394 -0.209768 -0.438102
+0.175064 -0.208922 -0.438915
+
+
+0.026994 -0.172962 -0.484918
+0.0349441 -0.17016 -0.485803
+
+
+0.276651 0.00354561 -0.422416
+0.197417 0.0278293 -0.458969
+0.209966 0.0674811 -0.449308
+0.211508 0.0678201 -0.44858
+0.182225 0.0994352 -0.45531
+0.214897 0.170017 -0.423125
+0.213303 0.170471 -0.423679
+0.207247 0.172094 -0.425814
+
+
+0.337439 -0.178602 -0.323235
+0.237101 -0.361469 -0.316857
+0.243304 -0.369978 -0.305402
+
+
+0.374713 -0.0660681 -0.338069
+0.377794 -0.0696007 -0.333094
+
+
+0.374713 -0.0660681 -0.338069
+0.340654 -0.171331 -0.323834
+
+
+0.374713 -0.0660681 -0.338069
+0.372142 -0.0630471 -0.342226
+
+
+0.24842 0.194465 -0.391277
+0.246818 0.189644 -0.394993
+0.306299 0.180405 -0.352186
+0.290439 0.0801752 -0.410676
+0.294727 0.0758942 -0.408995
+0.299186 0.0715124 -0.407216
+
+
+0.24842 0.194465 -0.391277
+0.198312 0.245013 -0.388641
+0.263858 0.241562 -0.353541
+
+
+0.24842 0.194465 -0.391277
+0.248817 0.195581 -0.390395
+0.306299 0.180405 -0.352186
+0.283024 0.0910289 -0.411968
+0.280706 0.0947878 -0.412187
+0.182225 0.0994352 -0.45531
+0.222966 0.16781 -0.420254
+0.221271 0.168295 -0.420852
+0.214897 0.170017 -0.423125
+
+
+0.314035 0.0566948 -0.401254
+0.319619 0.0511612 -0.398969
+
+
+0.314035 0.0566948 -0.401254
+0.197417 0.0278293 -0.458969
+0.214609 0.0683546 -0.447132
+0.216373 0.0687358 -0.446293
+0.182225 0.0994352 -0.45531
+0.23166 0.165417 -0.417127
+0.229818 0.165946 -0.417784
+0.222966 0.16781 -0.420254
+
+
+0.314035 0.0566948 -0.401254
+0.308795 0.0619605 -0.403365
+
+
+0.244659 0.0739896 -0.432755
+0.249078 0.0748789 -0.430607
+0.182225 0.0994352 -0.45531
+0.239634 0.16103 -0.41478
+0.237962 0.16369 -0.414831
+0.23166 0.165417 -0.417127
+
+
+0.244659 0.0739896 -0.432755
+0.197417 0.0278293 -0.458969
+0.219972 0.0693623 -0.444598
+0.222054 0.0698042 -0.443601
+0.182225 0.0994352 -0.45531
+0.244557 0.153234 -0.414582
+0.241386 0.158304 -0.414697
+0.239634 0.16103 -0.41478
+
+
+0.244659 0.0739896 -0.432755
+0.237575 0.0727198 -0.436166
+0.182225 0.0994352 -0.45531
+0.249344 0.145616 -0.414359
+0.24625 0.150588 -0.414491
+0.244557 0.153234 -0.414582
+
+
+-0.148909 0.155121 -0.460501
+-0.154475 0.158237 -0.458236
+-0.156562 0.0450098 -0.473141
+-0.230223 0.0191577 -0.447759
+-0.229869 0.0176467 -0.448013
+-0.228302 0.0113893 -0.449104
+
+
+-0.148909 0.155121 -0.460501
+-0.0533786 0.210915 -0.450628
+0.0711456 0.264322 -0.434329
+0.0729456 0.257517 -0.437774
+
+
+-0.148909 0.155121 -0.460501
+-0.14446 0.152563 -0.46232
+-0.156562 0.0450098 -0.473141
+-0.232115 0.0268669 -0.446396
+-0.231764 0.0253557 -0.446656
+-0.230223 0.0191577 -0.447759
+
+
+0.0269858 0.128193 -0.49341
+-0.0533786 0.210915 -0.450628
+0.0771519 0.241172 -0.445982
+0.0789001 0.234501 -0.449291
+
+
+-0.196967 -0.110545 -0.467771
+-0.296119 -0.00157042 -0.403375
+-0.397923 -0.0468644 -0.321617
+-0.401802 -0.0382485 -0.318691
+-0.433806 -0.126861 -0.214754
+-0.451787 0.0346007 -0.258161
+-0.452626 0.0342004 -0.256293
+-0.458668 0.031201 -0.242785
+
+
+-0.370458 -0.230187 -0.269301
+-0.371326 -0.231014 -0.267127
+
+
+0.248979 -0.182035 -0.406905
+0.257046 -0.171054 -0.404829
+
+
+0.248979 -0.182035 -0.406905
+0.337792 -0.174914 -0.32498
+
+
+0.248979 -0.182035 -0.406905
+0.248889 -0.182156 -0.406929
+0.223301 -0.0667773 -0.442807
+0.32594 -0.0744728 -0.384549
+0.326019 -0.0743604 -0.384522
+0.334082 -0.0627175 -0.381844
+
+
+0.0553016 -0.16285 -0.488025
+0.0641975 -0.159686 -0.488947
+
+
+-0.0129675 -0.187084 -0.480132
+-0.00518759 -0.184377 -0.481092
+
+
+-0.238954 0.425426 -0.129748
+-0.239515 0.423763 -0.133405
+
+
+-0.427664 0.0604434 -0.298155
+-0.421595 0.0726389 -0.302769
+
+
+-0.427664 0.0604434 -0.298155
+-0.296119 -0.00157042 -0.403375
+-0.403414 -0.0345969 -0.317477
+-0.40747 -0.0255146 -0.314369
+-0.433806 -0.126861 -0.214754
+-0.444269 0.03828 -0.274788
+-0.445195 0.0378418 -0.272748
+-0.451787 0.0346007 -0.258161
+
+
+-0.427664 0.0604434 -0.298155
+-0.429108 0.0575587 -0.29704
+-0.445457 0.167217 -0.154943
+-0.448744 0.264827 -0.018504
+-0.441407 0.284234 -0.0169477
+-0.464303 0.153517 0.106091
+-0.548502 -0.0628234 0.00278
+-0.547803 -0.0565566 -0.00266504
+
+
+-0.0533786 0.210915 -0.450628
+0.0831429 0.217854 -0.457482
+0.0849745 0.210793 -0.460913
+0.198312 0.245013 -0.388641
+0.261967 0.235659 -0.358401
+0.260565 0.231235 -0.362005
+0.306299 0.180405 -0.352186
+0.276659 0.101475 -0.412513
+0.274583 0.104824 -0.412698
+0.182225 0.0994352 -0.45531
+0.254088 0.138027 -0.414109
+0.251012 0.142996 -0.41426
+0.249344 0.145616 -0.414359
+
+
+-0.0533786 0.210915 -0.450628
+0.0862801 0.205554 -0.463456
+0.0868955 0.20317 -0.464603
+0.0845642 0.198284 -0.466688
+0.182225 0.0994352 -0.45531
+0.258882 0.130321 -0.413826
+0.255763 0.135384 -0.413998
+0.254088 0.138027 -0.414109
+
+
+-0.0533786 0.210915 -0.450628
+0.0821893 0.193419 -0.46876
+0.0789276 0.18658 -0.471645
+0.182225 0.0994352 -0.45531
+0.263819 0.122343 -0.413503
+0.260595 0.127602 -0.413702
+0.258882 0.130321 -0.413826
+
+
+-0.0533786 0.210915 -0.450628
+0.0766499 0.181915 -0.473608
+0.0734922 0.175291 -0.476368
+0.182225 0.0994352 -0.45531
+0.26901 0.113916 -0.413131
+0.265608 0.119489 -0.413363
+0.263819 0.122343 -0.413503
+
+
+-0.0533786 0.210915 -0.450628
+0.0712651 0.17073 -0.478265
+0.0681482 0.16419 -0.480957
+0.182225 0.0994352 -0.45531
+0.287608 0.0834269 -0.411572
+0.283024 0.0910289 -0.411968
+
+
+-0.0533786 0.210915 -0.450628
+0.0659286 0.159643 -0.482825
+0.0627926 0.153062 -0.4855
+0.182225 0.0994352 -0.45531
+0.2655 0.0779598 -0.422633
+0.280854 0.0807592 -0.415164
+0.288348 0.0822208 -0.411498
+0.287608 0.0834269 -0.411572
+
+
+-0.0533786 0.210915 -0.450628
+0.0605383 0.148443 -0.487374
+0.057322 0.141692 -0.490084
+0.182225 0.0994352 -0.45531
+0.228921 0.0710945 -0.440324
+0.234313 0.0720522 -0.437744
+0.237575 0.0727198 -0.436166
+
+
+-0.0533786 0.210915 -0.450628
+0.0549883 0.136908 -0.492001
+0.0534786 0.13374 -0.493258
+0.0557597 0.128885 -0.493551
+0.182225 0.0994352 -0.45531
+0.189789 0.0637183 -0.458474
+0.19191 0.0640714 -0.457543
+
+
+-0.0533786 0.210915 -0.450628
+0.00220354 0.122958 -0.493391
+-0.00692602 0.120999 -0.49334
+-0.0112878 0.011464 -0.500142
+-0.0735302 0.0787151 -0.493524
+-0.0751203 0.0721837 -0.493775
+-0.0758956 0.0687849 -0.493909
+
+
+-0.0533786 0.210915 -0.450628
+-0.00886636 0.120604 -0.49332
+-0.0175665 0.118729 -0.493239
+-0.0112878 0.011464 -0.500142
+-0.0708247 0.0900436 -0.493047
+-0.0726488 0.0825564 -0.49336
+-0.0735302 0.0787151 -0.493524
+
+
+-0.0533786 0.210915 -0.450628
+-0.0194343 0.118347 -0.493212
+-0.0278911 0.116515 -0.493099
+-0.0112878 0.011464 -0.500142
+-0.0676361 0.103362 -0.492445
+-0.0697933 0.0945107 -0.492843
+-0.0708247 0.0900436 -0.493047
+
+
+-0.0533786 0.210915 -0.450628
+-0.0297245 0.116139 -0.493066
+-0.0381047 0.114316 -0.492921
+-0.0112878 0.011464 -0.500142
+0.0442936 0.131805 -0.493333
+0.041486 0.131238 -0.493346
+
+
+-0.0533786 0.210915 -0.450628
+-0.0399389 0.113937 -0.492881
+-0.0484033 0.112088 -0.492701
+
+
+-0.0533786 0.210915 -0.450628
+-0.0609345 0.109381 -0.492375
+-0.0665238 0.10815 -0.492213
+-0.0676361 0.103362 -0.492445
+
+
+-0.0533786 0.210915 -0.450628
+-0.0714209 0.110989 -0.490424
+-0.0765749 0.113902 -0.488549
+
+
+-0.0533786 0.210915 -0.450628
+-0.0894462 0.121296 -0.483772
+-0.0940121 0.123868 -0.482069
+-0.156562 0.0450098 -0.473141
+-0.234014 0.0346652 -0.444988
+-0.233659 0.0331248 -0.445259
+-0.232115 0.0268669 -0.446396
+
+
+-0.0533786 0.210915 -0.450628
+-0.0977701 0.126048 -0.48064
+-0.102199 0.128539 -0.478967
+-0.156562 0.0450098 -0.473141
+-0.235958 0.0427083 -0.443507
+-0.235591 0.0411072 -0.443794
+-0.234014 0.0346652 -0.444988
+
+
+-0.0533786 0.210915 -0.450628
+-0.10588 0.130672 -0.477549
+-0.11026 0.133133 -0.475873
+-0.156562 0.0450098 -0.473141
+-0.237988 0.0511715 -0.441918
+-0.237601 0.0494731 -0.44223
+-0.235958 0.0427083 -0.443507
+
+
+-0.0533786 0.210915 -0.450628
+-0.113935 0.13526 -0.47444
+-0.11835 0.137737 -0.472728
+-0.156562 0.0450098 -0.473141
+-0.240154 0.0602665 -0.44018
+-0.239737 0.0584257 -0.440524
+-0.237988 0.0511715 -0.441918
+
+
+-0.0533786 0.210915 -0.450628
+-0.12209 0.139899 -0.471251
+-0.126626 0.142442 -0.46947
+-0.156562 0.0450098 -0.473141
+-0.248215 0.0945994 -0.433385
+-0.247603 0.0918715 -0.433923
+
+
+-0.0533786 0.210915 -0.450628
+-0.130508 0.144682 -0.467918
+-0.135262 0.147346 -0.466029
+-0.156562 0.0450098 -0.473141
+-0.251846 0.110252 -0.430201
+-0.251104 0.106939 -0.430865
+-0.248215 0.0945994 -0.433385
+
+
+-0.0533786 0.210915 -0.450628
+-0.139373 0.149714 -0.464366
+-0.14446 0.152563 -0.46232
+
+
+-0.0533786 0.210915 -0.450628
+-0.159403 0.161065 -0.456199
+-0.165646 0.164558 -0.453632
+-0.156562 0.0450098 -0.473141
+-0.256348 0.12976 -0.426185
+-0.255408 0.125561 -0.427039
+-0.251846 0.110252 -0.430201
+
+
+-0.0533786 0.210915 -0.450628
+-0.171248 0.167768 -0.451294
+-0.178443 0.171793 -0.448305
+-0.156562 0.0450098 -0.473141
+-0.257453 0.174424 -0.420162
+
+
+0.0837512 0.380461 0.315373
+0.0786204 0.379555 0.318121
+
+
+-0.128418 0.286127 0.400368
+-0.124084 0.286583 0.401879
+-0.116354 0.287319 0.404612
+
+
+-0.0367369 0.245568 0.454655
+-0.0368109 0.236579 0.458711
+
+
+0.058974 0.496872 -0.00641194
+0.0481025 0.49285 -0.105883
+0.0455409 0.493495 -0.0991121
+-0.0248719 0.498374 -0.0374832
+0.00141472 0.500331 -0.00770134
+0.000239549 0.500349 -0.0066201
+-0.00153962 0.50037 -0.00513887
+
+
+0.058974 0.496872 -0.00641194
+0.0417542 0.494471 -0.0886839
+0.039913 0.494922 -0.0838472
+-0.0248719 0.498374 -0.0374832
+0.00437372 0.500277 -0.0102676
+0.00318977 0.500301 -0.00917888
+0.00141472 0.500331 -0.00770134
+
+
+0.058974 0.496872 -0.00641194
+0.0371197 0.495626 -0.0761288
+0.0357071 0.495962 -0.0724413
+-0.0248719 0.498374 -0.0374832
+0.0073952 0.500206 -0.012888
+0.00617849 0.500237 -0.0117709
+0.00437372 0.500277 -0.0102676
+
+
+0.058974 0.496872 -0.00641194
+0.0335268 0.496497 -0.0663958
+0.032388 0.496757 -0.0634421
+-0.0248719 0.498374 -0.0374832
+0.010542 0.500116 -0.0156168
+0.00926591 0.500155 -0.0144482
+0.0073952 0.500206 -0.012888
+
+
+0.058974 0.496872 -0.00641194
+0.0306094 0.497181 -0.0584933
+0.0296544 0.49739 -0.0560319
+-0.0248719 0.498374 -0.0374832
+0.0138873 0.500003 -0.0185176
+0.0125203 0.500053 -0.0172701
+0.010542 0.500116 -0.0156168
+
+
+0.058974 0.496872 -0.00641194
+0.0281502 0.497736 -0.0518325
+0.0273227 0.497909 -0.0497127
+-0.0248719 0.498374 -0.0374832
+0.0170342 0.499847 -0.0218518
+0.0167079 0.499897 -0.0209294
+0.0160244 0.499925 -0.0203082
+0.0138873 0.500003 -0.0185176
+
+
+0.058974 0.496872 -0.00641194
+0.0260111 0.498199 -0.0460392
+0.0252738 0.498346 -0.0441612
+-0.0248719 0.498374 -0.0374832
+0.0185576 0.499605 -0.0259746
+0.0176093 0.499762 -0.0232933
+0.0170342 0.499847 -0.0218518
+
+
+0.058974 0.496872 -0.00641194
+0.024099 0.498593 -0.0408612
+0.0234257 0.498721 -0.039155
+-0.0248719 0.498374 -0.0374832
+0.0201087 0.499341 -0.030173
+0.0191392 0.499513 -0.0274335
+0.0185576 0.499605 -0.0259746
+
+
+0.058974 0.496872 -0.00641194
+0.0223477 0.498937 -0.0361191
+0.0217191 0.499049 -0.0345333
+-0.0248719 0.498374 -0.0374832
+0.0036621 0.487422 -0.143304
+0.00627778 0.487309 -0.145165
+0.0192943 0.486771 -0.154222
+
+
+0.058974 0.496872 -0.00641194
+0.0207075 0.49924 -0.0316788
+0.0201087 0.499341 -0.030173
+
+
+0.058974 0.496872 -0.00641194
+0.0191392 0.499513 -0.0274335
+
+
+0.058974 0.496872 -0.00641194
+0.0176093 0.499762 -0.0232933
+
+
+0.058974 0.496872 -0.00641194
+0.0192349 0.499764 -0.0182399
+0.0210905 0.499665 -0.0160756
+0.0272388 0.499148 0.0225842
+0.0865454 0.489482 0.0868311
+0.0778691 0.490085 0.0880805
+0.0767983 0.490161 0.0882176
+
+
+0.058974 0.496872 -0.00641194
+0.0238117 0.499513 -0.0132116
+0.0251968 0.499434 -0.0115614
+
+
+0.180315 0.345951 0.314795
+0.127516 0.351781 0.332251
+0.161929 0.30231 0.36723
+
+
+0.0374166 0.419971 0.270128
+0.0373469 0.420715 0.268996
+
+
+-0.397923 -0.0468644 -0.321617
+-0.396366 -0.050364 -0.32277
+
+
+0.038883 0.386045 0.31957
+0.0387715 0.387779 0.317121
+
+
+-0.120233 0.436675 0.234335
+-0.121543 0.43824 0.231765
+-0.00934473 0.41695 0.276524
+0.0295676 0.436437 0.244554
+
+
+-0.120233 0.436675 0.234335
+-0.156068 0.355593 0.31559
+-0.124084 0.286583 0.401879
+
+
+-0.120233 0.436675 0.234335
+-0.114972 0.430562 0.24439
+-0.00934473 0.41695 0.276524
+0.0171229 0.441671 0.236228
+
+
+0.293559 0.128047 0.383966
+0.295066 0.127115 0.383118
+0.296062 0.128345 0.381938
+
+
+-0.0391853 0.252067 0.450781
+-0.0431771 0.262568 0.444465
+
+
+0.296318 0.141385 0.377174
+0.303931 0.12831 0.3758
+
+
+0.132772 0.205387 0.436155
+0.13341 0.204825 0.436228
+
+
+0.120195 0.31698 0.368838
+0.116876 0.318081 0.368947
+
+
+0.240611 0.211912 0.392099
+0.240216 0.21072 0.392893
+
+
+0.240611 0.211912 0.392099
+0.300017 0.146073 0.372494
+0.299403 0.145597 0.373168
+
+
+0.240611 0.211912 0.392099
+0.242941 0.219303 0.387227
+0.145377 0.224646 0.422847
+0.232652 0.187137 0.408227
+0.230535 0.180555 0.412432
+0.230162 0.179451 0.413144
+
+
+0.320476 0.262064 0.305063
+0.315342 0.26196 0.309479
+0.219585 0.354976 0.275998
+0.294691 0.261373 0.327183
+0.28941 0.261181 0.33169
+0.284926 0.261058 0.335468
+
+
+0.320476 0.262064 0.305063
+0.307522 0.147068 0.365943
+
+
+0.320476 0.262064 0.305063
+0.326713 0.262242 0.299634
+
+
+0.171955 0.361165 0.301976
+0.127516 0.351781 0.332251
+0.171632 0.298811 0.366765
+
+
+0.297102 0.103563 0.388613
+0.297182 0.103348 0.38861
+
+
+0.297102 0.103563 0.388613
+0.304241 0.11148 0.380918
+0.303426 0.11211 0.381374
+
+
+0.297102 0.103563 0.388613
+0.296002 0.10533 0.388976
+
+
+0.155233 0.391869 0.274368
+0.0840644 0.412413 0.270646
+0.102136 0.383539 0.305435
+0.102499 0.383588 0.305248
+0.127516 0.351781 0.332251
+0.203192 0.302567 0.349782
+0.19895 0.310776 0.343248
+
+
+0.150242 0.467835 0.129225
+0.0451587 0.471195 0.162285
+0.0198046 0.46218 0.190695
+0.0183121 0.462102 0.191168
+0.0121075 0.461892 0.192833
+
+
+0.198086 0.312385 0.341981
+0.127516 0.351781 0.332251
+0.187594 0.332359 0.325939
+0.185438 0.336453 0.322596
+
+
+0.203192 0.302567 0.349782
+0.204291 0.3005 0.351404
+
+
+0.187594 0.332359 0.325939
+0.188125 0.331399 0.326706
+
+
+0.174038 0.357416 0.305173
+0.127516 0.351781 0.332251
+0.184959 0.337311 0.321907
+
+
+0.165126 0.373268 0.291488
+0.127516 0.351781 0.332251
+0.176099 0.35368 0.308335
+
+
+0.269946 0.398562 0.135494
+0.245333 0.413089 0.139891
+0.216378 0.401871 0.212513
+0.215746 0.40222 0.212554
+0.209075 0.40595 0.212872
+
+
+0.0675626 0.435033 0.238134
+0.0640387 0.434886 0.239416
+
+
+0.0675626 0.435033 0.238134
+0.0840644 0.412413 0.270646
+0.106276 0.384198 0.303163
+0.106635 0.384246 0.302977
+0.127516 0.351781 0.332251
+0.162466 0.377917 0.287399
+
+
+0.0675626 0.435033 0.238134
+0.0680273 0.435063 0.237944
+0.0566727 0.45453 0.201473
+0.079982 0.435505 0.233479
+0.0794964 0.43548 0.23368
+0.0759218 0.435369 0.235005
+
+
+0.121358 0.436279 0.217592
+0.0840644 0.412413 0.270646
+0.110411 0.384842 0.300881
+0.110773 0.384889 0.300692
+0.127516 0.351781 0.332251
+0.159476 0.383111 0.2828
+
+
+-0.0447249 0.463172 0.198605
+-0.0465209 0.463533 0.197894
+
+
+-0.0447249 0.463172 0.198605
+-0.00934473 0.41695 0.276524
+0.0128177 0.443443 0.233328
+
+
+-0.0447249 0.463172 0.198605
+-0.0349751 0.461262 0.202324
+
+
+0.0598407 0.462938 0.179231
+0.0593304 0.462901 0.179491
+0.057486 0.462962 0.179922
+0.0451587 0.471195 0.162285
+0.0255593 0.462384 0.18909
+0.0244192 0.462321 0.189467
+0.0198046 0.46218 0.190695
+
+
+-0.0123708 0.500388 0.00431943
+0.0272388 0.499148 0.0225842
+0.0977172 0.488668 0.0852347
+0.0877571 0.489393 0.0866739
+0.0865454 0.489482 0.0868311
+
+
+0.0548335 0.46292 0.180844
+0.0531466 0.462984 0.181182
+0.0451587 0.471195 0.162285
+0.0301014 0.462535 0.187817
+0.0291881 0.46248 0.188136
+0.0255593 0.462384 0.18909
+
+
+0.0548335 0.46292 0.180844
+0.0566727 0.45453 0.201473
+0.0937245 0.435866 0.228257
+0.0931131 0.435843 0.22851
+0.0887676 0.435752 0.230151
+
+
+0.0548335 0.46292 0.180844
+0.0552714 0.462977 0.180567
+0.0451587 0.471195 0.162285
+0.033842 0.462649 0.186762
+0.0330824 0.4626 0.187045
+0.0301014 0.462535 0.187817
+
+
+0.0176135 0.493337 0.0964598
+0.0451587 0.471195 0.162285
+0.0370316 0.462739 0.185857
+0.0363802 0.46269 0.186119
+0.033842 0.462649 0.186762
+
+
+0.148857 0.460324 0.15208
+0.12202 0.461239 0.160255
+0.0451587 0.471195 0.162285
+0.0446869 0.462909 0.183651
+0.0442151 0.462852 0.183912
+0.0423579 0.462865 0.184328
+
+
+0.148857 0.460324 0.15208
+0.0566727 0.45453 0.201473
+0.151235 0.436544 0.205891
+0.148939 0.436514 0.206817
+
+
+0.148857 0.460324 0.15208
+0.150558 0.460273 0.151541
+
+
+0.229252 0.394591 0.211851
+0.223244 0.398006 0.212161
+0.245333 0.413089 0.139891
+0.229833 0.394265 0.21181
+0.229252 0.394591 0.211851
+0.219585 0.354976 0.275998
+0.304756 0.261672 0.318584
+0.299289 0.261487 0.323282
+0.294691 0.261373 0.327183
+
+
+0.275758 0.392806 0.141201
+0.245333 0.413089 0.139891
+0.23628 0.390575 0.211454
+0.235707 0.390899 0.211496
+0.229833 0.394265 0.21181
+
+
+0.037162 0.425256 0.261997
+0.0840644 0.412413 0.270646
+0.11462 0.385484 0.298544
+0.114993 0.385531 0.298348
+0.127516 0.351781 0.332251
+0.15602 0.389076 0.277484
+
+
+-0.0676302 0.373745 0.333048
+-0.156068 0.355593 0.31559
+-0.111523 0.287815 0.406282
+
+
+-0.0368764 0.335402 0.388347
+-0.0334986 0.331177 0.394349
+
+
+-0.218397 -0.0823861 0.454141
+-0.143539 -0.180191 0.444216
+-0.10847 -0.100141 0.483705
+-0.116625 -0.095239 0.483
+
+
+-0.059308 0.499273 0.0450669
+-0.0537188 0.499451 0.0401288
+
+
+-0.113891 0.429263 0.246508
+-0.114972 0.430562 0.24439
+
+
+-0.113891 0.429263 0.246508
+-0.156068 0.355593 0.31559
+-0.0972683 0.289184 0.411234
+
+
+-0.113891 0.429263 0.246508
+-0.109462 0.424102 0.254937
+-0.00934473 0.41695 0.276524
+0.00340887 0.447255 0.226961
+
+
+-0.247326 0.0766735 0.442175
+-0.310123 -0.0280028 0.391714
+-0.195352 -0.00922238 0.476576
+
+
+0.0840644 0.412413 0.270646
+0.11899 0.386136 0.296103
+0.119381 0.386185 0.295896
+
+
+0.0840644 0.412413 0.270646
+0.128637 0.387529 0.29067
+0.129095 0.387585 0.290422
+
+
+0.0840644 0.412413 0.270646
+0.140528 0.389176 0.283902
+0.141122 0.389247 0.283576
+
+
+0.0840644 0.412413 0.270646
+0.157013 0.395497 0.268231
+
+
+0.0840644 0.412413 0.270646
+0.162787 0.40724 0.248016
+0.163462 0.408542 0.245725
+
+
+0.0840644 0.412413 0.270646
+0.167515 0.41683 0.231169
+0.168365 0.418477 0.22823
+
+
+0.0840644 0.412413 0.270646
+0.169552 0.428791 0.211358
+
+
+0.0840644 0.412413 0.270646
+0.164013 0.43435 0.204556
+
+
+0.0840644 0.412413 0.270646
+0.112262 0.43617 0.221127
+0.105657 0.436085 0.223665
+
+
+0.0840644 0.412413 0.270646
+0.0985803 0.435954 0.226412
+0.0937245 0.435866 0.228257
+
+
+0.0840644 0.412413 0.270646
+0.0931131 0.435843 0.22851
+
+
+0.0840644 0.412413 0.270646
+0.0837169 0.435608 0.232087
+0.079982 0.435505 0.233479
+
+
+0.0840644 0.412413 0.270646
+0.0794964 0.43548 0.23368
+
+
+0.0840644 0.412413 0.270646
+0.0715005 0.435195 0.236673
+0.0680273 0.435063 0.237944
+
+
+0.0840644 0.412413 0.270646
+0.0635624 0.434855 0.239609
+
+
+0.0840644 0.412413 0.270646
+0.0594188 0.434655 0.241128
+
+
+0.0840644 0.412413 0.270646
+0.0550388 0.434428 0.242725
+
+
+0.0840644 0.412413 0.270646
+0.045081 0.433863 0.246324
+
+
+0.0840644 0.412413 0.270646
+0.0391539 0.433499 0.24845
+
+
+0.0840644 0.412413 0.270646
+0.037021 0.428112 0.257547
+0.0370874 0.426063 0.260747
+
+
+0.176118 -0.254065 0.408717
+0.176259 -0.256623 0.407364
+
+
+-0.257336 -0.395311 0.171632
+-0.257199 -0.39584 0.17041
+
+
+0.201693 -0.412848 0.197274
+0.199081 -0.409679 0.206262
+
+
+0.192643 -0.415192 0.201277
+0.194683 -0.413487 0.202802
+
+
+0.192643 -0.415192 0.201277
+0.193098 -0.412863 0.20558
+0.192018 -0.412438 0.20746
+0.197771 -0.410804 0.205266
+
+
+0.192643 -0.415192 0.201277
+0.192591 -0.415261 0.201186
+
+
+0.195112 -0.386708 0.250167
+0.196865 -0.385858 0.250136
+0.19515 -0.400881 0.226697
+
+
+0.195112 -0.386708 0.250167
+0.179438 -0.375372 0.278026
+0.150241 -0.376625 0.292822
+
+
+0.195112 -0.386708 0.250167
+0.19378 -0.38741 0.250097
+
+
+0.167752 -0.393076 0.259647
+0.169051 -0.394312 0.256989
+0.141621 -0.397458 0.269018
+0.0945318 -0.343566 0.364562
+0.0923811 -0.345552 0.362853
+-0.0213985 -0.321575 0.382795
+-0.101508 -0.268955 0.417205
+-0.095865 -0.265478 0.420502
+-0.0938352 -0.264262 0.421661
+
+
+0.167752 -0.393076 0.259647
+0.179438 -0.375372 0.278026
+0.152103 -0.378419 0.289414
+
+
+0.167752 -0.393076 0.259647
+0.167515 -0.392924 0.260022
+0.141621 -0.397458 0.269018
+0.0867314 -0.350855 0.358249
+0.0847386 -0.352685 0.356659
+
+
+0.167515 -0.392924 0.260022
+0.166402 -0.391845 0.262312
+0.179438 -0.375372 0.278026
+0.157324 -0.383392 0.279774
+0.158139 -0.384271 0.278096
+
+
+0.227609 -0.369889 0.250326
+0.232593 -0.367296 0.250269
+0.20074 -0.39854 0.225784
+0.201839 -0.398206 0.225362
+
+
+0.227609 -0.369889 0.250326
+0.179438 -0.375372 0.278026
+0.158349 -0.384355 0.27786
+
+
+0.227609 -0.369889 0.250326
+0.224177 -0.37173 0.25027
+0.199718 -0.398898 0.226091
+
+
+0.250557 -0.357737 0.250304
+0.179438 -0.375372 0.278026
+0.159324 -0.385268 0.276029
+
+
+0.185024 -0.391738 0.249951
+0.186294 -0.391083 0.250029
+0.187919 -0.390319 0.250006
+0.193507 -0.40186 0.22641
+0.194017 -0.401533 0.226542
+
+
+0.180378 -0.393957 0.249903
+0.182078 -0.393169 0.249889
+
+
+0.180378 -0.393957 0.249903
+0.179438 -0.375372 0.278026
+0.160267 -0.386151 0.274242
+
+
+0.180378 -0.393957 0.249903
+0.17902 -0.394642 0.249819
+
+
+-0.0916288 -0.40193 0.304453
+-0.0213985 -0.321575 0.382795
+-0.109504 -0.273828 0.412523
+-0.103608 -0.270209 0.415995
+-0.101508 -0.268955 0.417205
+
+
+0.342084 -0.369243 -0.0964669
+0.339349 -0.37155 -0.0901214
+
+
+0.211514 -0.432574 -0.2107
+0.21038 -0.433341 -0.209597
+0.20679 -0.435053 -0.20736
+
+
+-0.266942 -0.370263 0.22093
+-0.267558 -0.369339 0.222178
+
+
+-0.25807 -0.391988 0.179471
+-0.257914 -0.392612 0.178036
+
+
+-0.25557 -0.402919 0.153408
+-0.255461 -0.403298 0.152518
+
+
+0.146969 -0.422942 0.224734
+0.146797 -0.423099 0.224579
+0.141621 -0.397458 0.269018
+0.0725091 -0.364039 0.346664
+0.0706877 -0.365691 0.345201
+-0.0213985 -0.321575 0.382795
+-0.118008 -0.278995 0.407504
+-0.111719 -0.275148 0.411236
+-0.109504 -0.273828 0.412523
+
+
+0.146969 -0.422942 0.224734
+0.188634 -0.406789 0.221632
+
+
+0.146969 -0.422942 0.224734
+0.150708 -0.419361 0.228378
+0.141621 -0.397458 0.269018
+0.0657603 -0.370241 0.341131
+0.0639673 -0.371858 0.339684
+-0.0213985 -0.321575 0.382795
+-0.127252 -0.284593 0.402005
+-0.120395 -0.280414 0.406105
+-0.118008 -0.278995 0.407504
+
+
+0.212812 -0.409245 0.193419
+0.200297 -0.461127 0.0892943
+
+
+0.030027 -0.411801 -0.282549
+0.0300871 -0.411796 -0.28255
+
+
+0.169051 -0.394312 0.256989
+0.169318 -0.394496 0.256545
+0.170882 -0.395961 0.253357
+0.141621 -0.397458 0.269018
+0.0590704 -0.376353 0.335623
+0.0572715 -0.377966 0.334164
+-0.0213985 -0.321575 0.382795
+-0.137545 -0.290807 0.395839
+-0.129884 -0.286155 0.400451
+-0.127252 -0.284593 0.402005
+
+
+-0.25611 -0.400659 0.158869
+-0.255995 -0.401073 0.157904
+
+
+0.173855 -0.397072 0.249737
+0.172741 -0.397621 0.249671
+0.172466 -0.397905 0.249404
+0.172378 -0.397988 0.249331
+0.141621 -0.397458 0.269018
+0.052311 -0.382493 0.330032
+0.0504715 -0.384133 0.328535
+-0.0213985 -0.321575 0.382795
+-0.149313 -0.297891 0.388742
+-0.140521 -0.29257 0.394068
+-0.137545 -0.290807 0.395839
+
+
+0.219557 -0.402586 0.199713
+0.219566 -0.402516 0.199841
+0.219654 -0.402177 0.200406
+0.219707 -0.401756 0.201166
+0.219695 -0.401332 0.201995
+0.219606 -0.400913 0.202893
+0.219575 -0.400843 0.203058
+0.21949 -0.400442 0.20391
+0.219276 -0.399972 0.205024
+0.218928 -0.39953 0.206218
+
+
+0.219557 -0.402586 0.199713
+0.219458 -0.402963 0.19908
+
+
+0.219557 -0.402586 0.199713
+0.280502 -0.364789 0.204278
+0.28032 -0.364716 0.204629
+0.319882 -0.304039 0.235874
+0.255012 -0.349169 0.258705
+0.254805 -0.347072 0.261688
+0.254611 -0.344501 0.265269
+
+
+0.219654 -0.402177 0.200406
+0.276867 -0.363442 0.211077
+0.276691 -0.363371 0.211414
+0.319882 -0.304039 0.235874
+0.258477 -0.356381 0.2448
+0.255619 -0.355255 0.249936
+
+
+0.29048 -0.398005 0.12285
+0.293432 -0.394848 0.126121
+
+
+0.19662 -0.413073 0.201778
+0.196391 -0.412014 0.204151
+
+
+-0.255058 -0.405003 0.148324
+-0.254952 -0.405358 0.147484
+
+
+-0.103608 -0.270209 0.415995
+-0.143539 -0.180191 0.444216
+-0.125098 -0.0901339 0.48223
+-0.134033 -0.0847374 0.481379
+
+
+0.162136 -0.3879 0.270653
+0.179438 -0.375372 0.278026
+0.161198 -0.387023 0.272461
+
+
+0.171196 -0.396191 0.252813
+0.172741 -0.397621 0.249671
+
+
+0.171196 -0.396191 0.252813
+0.179438 -0.375372 0.278026
+0.165204 -0.390747 0.264668
+0.166183 -0.391717 0.262637
+0.141621 -0.397458 0.269018
+0.0453484 -0.388781 0.324249
+0.0434305 -0.390481 0.32268
+-0.0213985 -0.321575 0.382795
+-0.163185 -0.306219 0.380322
+-0.152777 -0.29994 0.386665
+-0.149313 -0.297891 0.388742
+
+
+0.171196 -0.396191 0.252813
+0.170882 -0.395961 0.253357
+
+
+0.186294 -0.391083 0.250029
+0.179438 -0.375372 0.278026
+0.169318 -0.394496 0.256545
+
+
+0.192104 -0.388213 0.250126
+0.179438 -0.375372 0.278026
+0.177229 -0.395467 0.249826
+
+
+0.200146 -0.384195 0.25017
+0.195777 -0.400559 0.226711
+
+
+0.200146 -0.384195 0.25017
+0.201671 -0.383386 0.250235
+0.203714 -0.382373 0.2502
+
+
+0.200146 -0.384195 0.25017
+0.198275 -0.385112 0.250203
+0.179438 -0.375372 0.278026
+0.201671 -0.383386 0.250235
+
+
+0.224177 -0.37173 0.25027
+0.220322 -0.373719 0.250319
+0.179438 -0.375372 0.278026
+0.209606 -0.379304 0.250286
+0.212237 -0.377973 0.250247
+0.197968 -0.399549 0.22653
+
+
+0.253497 -0.332598 0.281824
+0.25374 -0.334878 0.278652
+
+
+0.198275 -0.385112 0.250203
+0.196865 -0.385858 0.250136
+
+
+0.159474 -0.410883 0.236878
+0.141621 -0.397458 0.269018
+0.0380328 -0.395349 0.318148
+0.0359921 -0.397149 0.316471
+-0.0213985 -0.321575 0.382795
+-0.198469 -0.32917 0.357167
+
+
+0.159474 -0.410883 0.236878
+0.157006 -0.413294 0.234476
+0.156895 -0.413395 0.23438
+0.141621 -0.397458 0.269018
+0.0301842 -0.402357 0.311576
+0.0279657 -0.404304 0.309743
+
+
+0.159474 -0.410883 0.236878
+0.159575 -0.410791 0.236964
+0.189488 -0.405372 0.223537
+0.189744 -0.405038 0.223931
+
+
+0.189184 -0.389661 0.25008
+0.187919 -0.390319 0.250006
+
+
+0.265092 -0.228907 0.358765
+0.266858 -0.227339 0.358286
+
+
+0.179438 -0.375372 0.278026
+0.21448 -0.376772 0.250305
+0.217605 -0.375175 0.250262
+0.198815 -0.399215 0.226353
+
+
+0.179438 -0.375372 0.278026
+0.255198 -0.351743 0.255094
+0.255012 -0.349169 0.258705
+
+
+0.179438 -0.375372 0.278026
+0.254805 -0.347072 0.261688
+
+
+0.179438 -0.375372 0.278026
+0.254396 -0.342386 0.268255
+
+
+0.220322 -0.373719 0.250319
+0.217605 -0.375175 0.250262
+
+
+0.209606 -0.379304 0.250286
+0.207689 -0.380328 0.250226
+
+
+0.237165 -0.364841 0.250323
+0.232593 -0.367296 0.250269
+
+
+0.255198 -0.351743 0.255094
+0.255401 -0.353864 0.252057
+
+
+0.21448 -0.376772 0.250305
+0.212237 -0.377973 0.250247
+
+
+0.168237 -0.402191 0.245345
+0.141621 -0.397458 0.269018
+0.0118917 -0.418558 0.296169
+0.00907043 -0.421013 0.293817
+-0.0213985 -0.321575 0.382795
+-0.167233 -0.35086 0.341988
+-0.165631 -0.351977 0.341192
+
+
+0.168237 -0.402191 0.245345
+0.166257 -0.404185 0.243424
+0.166171 -0.404265 0.243352
+0.141621 -0.397458 0.269018
+0.000700244 -0.428397 0.286694
+-0.00262124 -0.431278 0.283913
+-0.0213985 -0.321575 0.382795
+-0.154397 -0.359694 0.335707
+
+
+0.168237 -0.402191 0.245345
+0.168323 -0.402111 0.245416
+0.190659 -0.404062 0.224926
+
+
+0.154014 -0.416183 0.231587
+0.141621 -0.397458 0.269018
+-0.0126571 -0.440089 0.275351
+-0.0167085 -0.443592 0.271944
+-0.0213985 -0.321575 0.382795
+-0.142719 -0.367682 0.329964
+
+
+0.154014 -0.416183 0.231587
+0.150852 -0.41923 0.228507
+0.150708 -0.419361 0.228378
+
+
+0.154014 -0.416183 0.231587
+0.154139 -0.416069 0.231696
+0.189026 -0.40606 0.222658
+
+
+-0.110278 -0.475966 0.138553
+-0.126714 -0.466211 0.146323
+-0.176814 -0.420902 0.204888
+-0.100936 -0.481449 0.134277
+-0.110278 -0.475966 0.138553
+-0.208416 -0.429931 0.148736
+-0.199358 -0.46762 0.0365335
+
+
+-0.253574 -0.410703 0.134154
+-0.253469 -0.411029 0.13336
+
+
+0.216947 -0.406386 0.194921
+0.20407 -0.405245 0.21015
+
+
+-0.0210771 -0.44741 0.268208
+-0.0167085 -0.443592 0.271944
+
+
+0.0145244 -0.413407 -0.281636
+0.0145947 -0.413402 -0.281638
+
+
+0.0494611 -0.11855 0.492376
+0.0464547 -0.11899 0.492527
+
+
+-0.258936 -0.387979 0.188863
+-0.258752 -0.388741 0.187118
+
+
+-0.0185714 -0.540889 0.0622723
+-0.208416 -0.429931 0.148736
+-0.177451 -0.477007 0.0395389
+-0.176509 -0.477407 0.0396584
+
+
+-0.254561 -0.406967 0.143488
+-0.254457 -0.407306 0.14268
+
+
+0.30138 -0.380659 -0.214045
+0.30313 -0.380041 -0.210608
+
+
+0.15677 -0.445325 0.173167
+0.172731 -0.431978 0.185646
+0.203648 -0.412538 0.195967
+
+
+0.15677 -0.445325 0.173167
+0.189009 -0.410599 0.213924
+0.188665 -0.410151 0.215118
+0.188456 -0.409679 0.216232
+0.188386 -0.409329 0.21698
+0.201211 -0.4078 0.207936
+
+
+0.15677 -0.445325 0.173167
+0.156086 -0.445909 0.172607
+
+
+0.354371 -0.336505 0.109132
+0.356424 -0.334239 0.108851
+
+
+0.259301 -0.430353 0.0889878
+0.262238 -0.427356 0.0921979
+
+
+0.334198 -0.375885 -0.0779176
+0.332103 -0.377634 -0.0730896
+
+
+0.344661 -0.315423 0.182519
+0.319882 -0.304039 0.235874
+0.262368 -0.357907 0.237757
+0.258675 -0.356465 0.244434
+0.258477 -0.356381 0.2448
+
+
+0.281654 -0.407305 0.113262
+0.278605 -0.410504 0.109901
+
+
+0.269128 -0.420302 0.0996559
+0.265722 -0.423811 0.0959213
+
+
+0.232522 -0.445456 0.0870429
+0.226184 -0.448984 0.0865439
+
+
+0.0149202 -0.531437 0.12016
+-0.176814 -0.420902 0.204888
+-0.0474967 -0.512961 0.109291
+-0.0685835 -0.500582 0.119029
+-0.100936 -0.481449 0.134277
+
+
+0.0149202 -0.531437 0.12016
+0.0150224 -0.531665 0.119747
+0.00233019 -0.535395 0.101207
+
+
+0.0149202 -0.531437 0.12016
+0.00921081 -0.518397 0.143794
+0.141621 -0.397458 0.269018
+-0.0194747 -0.451273 0.261687
+
+
+0.204766 -0.412256 0.19543
+0.200208 -0.408691 0.207143
+
+
+0.202257 -0.412794 0.196825
+0.181183 -0.424888 0.192264
+0.181356 -0.424734 0.192419
+0.186374 -0.420521 0.196327
+0.200695 -0.413035 0.197875
+
+
+0.363614 -0.286881 0.19331
+0.319882 -0.304039 0.235874
+0.266059 -0.359338 0.231035
+0.262554 -0.357985 0.237411
+0.262368 -0.357907 0.237757
+
+
+0.219566 -0.402516 0.199841
+0.205911 -0.403563 0.21158
+
+
+0.252414 -0.321508 0.296989
+0.252711 -0.324176 0.293329
+
+
+-0.00869252 -0.538456 0.083107
+-0.0056061 -0.537668 0.0896043
+-0.0474967 -0.512961 0.109291
+
+
+-0.00869252 -0.538456 0.083107
+-0.208416 -0.429931 0.148736
+-0.165656 -0.481979 0.0411477
+
+
+-0.00869252 -0.538456 0.083107
+-0.00944802 -0.538648 0.0814953
+
+
+-0.244638 -0.43894 0.0588527
+-0.244237 -0.440043 0.0558702
+
+
+-0.256356 -0.440952 0.0197513
+-0.259549 -0.439219 0.0174103
+
+
+0.221859 -0.425601 -0.220623
+0.246306 -0.434405 -0.0320329
+0.21542 -0.450302 -0.0322588
+
+
+0.23744 -0.415001 -0.235619
+0.246306 -0.434405 -0.0320329
+0.215313 -0.449828 -0.0391308
+0.215243 -0.449756 -0.0404284
+0.183592 -0.464325 -0.0331205
+0.211972 -0.438727 -0.156647
+0.210887 -0.434807 -0.19492
+0.21038 -0.433341 -0.209597
+
+
+0.0633589 -0.499254 -0.118398
+0.0725105 -0.495434 -0.124087
+
+
+0.266277 -0.395511 -0.260568
+0.264729 -0.39624 -0.261912
+
+
+0.266277 -0.395511 -0.260568
+0.357451 -0.188396 -0.294958
+
+
+0.266277 -0.395511 -0.260568
+0.275058 -0.391384 -0.252861
+
+
+0.323071 -0.385114 -0.0518984
+0.321658 -0.386268 -0.0486849
+
+
+0.343728 -0.364776 -0.130431
+0.344784 -0.364363 -0.128281
+
+
+0.329239 -0.370403 -0.159353
+0.330445 -0.369951 -0.156935
+
+
+0.288943 -0.385073 -0.238192
+0.291041 -0.384344 -0.234096
+
+
+-0.280307 -0.407407 -0.0947386
+-0.279391 -0.410862 -0.0857236
+
+
+0.213895 -0.444795 -0.0954395
+0.213669 -0.444265 -0.101135
+0.183592 -0.464325 -0.0331205
+0.213043 -0.442214 -0.121864
+0.212523 -0.440218 -0.14143
+0.211972 -0.438727 -0.156647
+
+
+0.213895 -0.444795 -0.0954395
+0.246306 -0.434405 -0.0320329
+0.215248 -0.449562 -0.0427248
+0.215175 -0.44948 -0.0440892
+
+
+0.213895 -0.444795 -0.0954395
+0.214079 -0.445627 -0.0871503
+0.183592 -0.464325 -0.0331205
+0.21437 -0.446605 -0.0769096
+0.21425 -0.445994 -0.0830628
+0.214079 -0.445627 -0.0871503
+
+
+-0.247838 -0.429444 0.0848046
+-0.247599 -0.430106 0.0830485
+
+
+0.272358 -0.416987 0.103114
+0.275548 -0.413671 0.106621
+
+
+0.393285 -0.291866 0.102126
+0.394586 -0.290253 0.101931
+
+
+0.383992 -0.303076 0.103923
+0.384852 -0.302028 0.103829
+
+
+0.318983 -0.352217 0.167934
+0.319882 -0.304039 0.235874
+0.269629 -0.360708 0.224489
+0.266236 -0.359412 0.2307
+0.266059 -0.359338 0.231035
+
+
+0.302194 -0.385439 0.13569
+0.299333 -0.388517 0.13259
+0.21793 -0.405418 0.19583
+
+
+0.189942 -0.417507 0.199118
+0.186485 -0.420417 0.196435
+0.190813 -0.412036 0.209397
+
+
+0.288377 -0.367655 0.189407
+0.288169 -0.367574 0.189813
+0.319882 -0.304039 0.235874
+0.273151 -0.362043 0.217991
+0.269803 -0.36078 0.22416
+0.269629 -0.360708 0.224489
+
+
+0.288377 -0.367655 0.189407
+0.219317 -0.403336 0.198497
+
+
+0.288377 -0.367655 0.189407
+0.292598 -0.36916 0.181377
+0.319882 -0.304039 0.235874
+0.297559 -0.370917 0.171874
+0.292829 -0.369248 0.180926
+0.292598 -0.36916 0.181377
+
+
+0.137683 -0.485945 0.103552
+0.209153 -0.410913 0.193756
+
+
+0.181356 -0.424734 0.192419
+0.190039 -0.41156 0.211067
+0.189433 -0.411099 0.212544
+0.189122 -0.41069 0.213641
+0.200171 -0.408717 0.207127
+
+
+0.262554 -0.357985 0.237411
+0.21949 -0.400442 0.20391
+
+
+0.207234 -0.411584 0.194325
+0.101943 -0.499612 0.111566
+0.116802 -0.493966 0.108215
+
+
+0.215578 -0.453594 0.0452108
+0.215657 -0.453186 0.0337899
+
+
+0.033772 -0.411384 -0.282746
+0.0337113 -0.411389 -0.282745
+
+
+0.0754679 -0.406072 -0.284535
+0.075616 -0.406054 -0.284537
+
+
+0.120313 -0.474838 -0.153897
+0.128009 -0.471431 -0.158649
+
+
+-0.0586984 -0.458517 -0.208757
+-0.0572131 -0.460131 -0.205738
+
+
+-0.000684082 -0.41482 -0.28063
+-0.00058386 -0.414813 -0.280634
+
+
+0.0263416 -0.412201 -0.282344
+0.0264023 -0.412197 -0.282345
+
+
+-0.191297 -0.425249 -0.182477
+-0.225451 -0.420597 -0.150567
+-0.192179 -0.416956 -0.202371
+-0.19186 -0.419807 -0.195607
+
+
+0.153641 -0.459846 -0.174566
+0.162403 -0.455832 -0.179959
+
+
+0.246306 -0.434405 -0.0320329
+0.215086 -0.448934 -0.0506442
+0.215003 -0.448822 -0.0522539
+0.183592 -0.464325 -0.0331205
+0.214588 -0.447347 -0.0689519
+0.214507 -0.446875 -0.0737817
+0.21437 -0.446605 -0.0769096
+
+
+0.246306 -0.434405 -0.0320329
+0.214982 -0.44855 -0.0552006
+0.214892 -0.448416 -0.0570136
+0.183592 -0.464325 -0.0331205
+0.214757 -0.447935 -0.0624785
+0.214702 -0.447554 -0.0664386
+0.214588 -0.447347 -0.0689519
+
+
+0.246306 -0.434405 -0.0320329
+0.214857 -0.448099 -0.0603784
+0.214757 -0.447935 -0.0624785
+
+
+0.246306 -0.434405 -0.0320329
+0.214702 -0.447554 -0.0664386
+
+
+0.246306 -0.434405 -0.0320329
+0.214507 -0.446875 -0.0737817
+
+
+0.246306 -0.434405 -0.0320329
+0.21425 -0.445994 -0.0830628
+
+
+0.246306 -0.434405 -0.0320329
+0.213373 -0.443045 -0.11318
+0.213043 -0.442214 -0.121864
+
+
+0.246306 -0.434405 -0.0320329
+0.212523 -0.440218 -0.14143
+
+
+0.246306 -0.434405 -0.0320329
+0.210887 -0.434807 -0.19492
+
+
+0.246306 -0.434405 -0.0320329
+0.255705 -0.402477 -0.253196
+
+
+0.427004 -0.115492 -0.249079
+0.428226 -0.120979 -0.244179
+
+
+0.427004 -0.115492 -0.249079
+0.360838 -0.183064 -0.294233
+
+
+0.427004 -0.115492 -0.249079
+0.426503 -0.113161 -0.251114
+
+
+0.430385 -0.131069 -0.235211
+0.431576 -0.13663 -0.230204
+
+
+0.430385 -0.131069 -0.235211
+0.360753 -0.183631 -0.293999
+
+
+0.430385 -0.131069 -0.235211
+0.429907 -0.128752 -0.237253
+
+
+0.451278 -0.0281487 -0.21585
+0.467061 -0.0515947 -0.172025
+0.466262 -0.0887187 -0.158466
+
+
+0.409251 0.0667591 -0.285708
+0.410852 0.0667538 -0.283141
+
+
+0.465476 0.0288952 -0.190863
+0.467061 -0.0515947 -0.172025
+0.462471 -0.101447 -0.163636
+
+
+0.361871 -0.0512587 -0.35862
+0.365801 -0.0557301 -0.35238
+
+
+0.361871 -0.0512587 -0.35862
+0.340088 -0.171738 -0.324235
+
+
+0.361871 -0.0512587 -0.35862
+0.358498 -0.0473409 -0.363978
+0.429296 -0.00494892 -0.257062
+0.402 -0.0944374 -0.293128
+0.403833 -0.0958421 -0.290053
+0.406697 -0.0979548 -0.285254
+
+
+0.334645 -0.206707 -0.309064
+0.336921 -0.202498 -0.309203
+
+
+0.334645 -0.206707 -0.309064
+0.353609 -0.189764 -0.298498
+
+
+0.334645 -0.206707 -0.309064
+0.333849 -0.208046 -0.309096
+
+
+0.456302 -0.00883578 -0.207487
+0.467061 -0.0515947 -0.172025
+0.455184 -0.125528 -0.173395
+
+
+0.482825 -0.160883 -0.0373563
+0.480992 -0.166254 -0.0410189
+
+
+0.479269 -0.0395237 -0.138081
+0.47989 -0.0369452 -0.136918
+
+
+0.474968 -0.109666 0.148842
+0.475486 -0.109448 0.146558
+
+
+0.472671 -0.0661293 -0.149224
+0.473036 -0.064873 -0.148612
+
+
+0.474944 -0.0575213 -0.145558
+0.474585 -0.0588244 -0.146192
+
+
+0.478267 -0.0437941 -0.139883
+0.478795 -0.0416468 -0.138902
+
+
+0.480464 -0.0343613 -0.135899
+0.481224 -0.0311422 -0.134463
+
+
+0.512211 0.0407533 -0.041675
+0.463273 0.170171 -0.0822769
+
+
+0.507263 -0.0522934 -0.00859199
+0.506721 -0.0592884 -0.00633066
+
+
+0.503553 -0.0965552 0.00588781
+0.502457 -0.0971393 0.0120772
+
+
+0.481951 -0.0278565 -0.133147
+0.482932 -0.0236374 -0.131283
+
+
+0.445974 -0.0473349 -0.224018
+0.467061 -0.0515947 -0.172025
+0.431377 -0.0967087 -0.244618
+0.435046 -0.0845331 -0.239577
+
+
+0.452498 -0.0235665 -0.213878
+0.467061 -0.0515947 -0.172025
+0.438139 -0.0741984 -0.235274
+0.44048 -0.0662813 -0.231979
+
+
+0.45926 0.00305138 -0.20228
+0.467061 -0.0515947 -0.172025
+0.440563 -0.0660104 -0.231859
+
+
+0.0980544 0.00360326 -0.498403
+0.0977335 0.00718531 -0.49834
+-0.0112878 0.011464 -0.500142
+0.0565871 0.127083 -0.493659
+0.0622157 0.115085 -0.494341
+0.182225 0.0994352 -0.45531
+0.18653 0.0630999 -0.459904
+0.188668 0.0634567 -0.458975
+0.189789 0.0637183 -0.458474
+
+
+0.0980544 0.00360326 -0.498403
+0.197417 0.0278293 -0.458969
+0.226372 0.0705634 -0.441551
+0.228921 0.0710945 -0.440324
+
+
+0.0980544 0.00360326 -0.498403
+0.0986275 -0.00372439 -0.498536
+-0.0112878 0.011464 -0.500142
+0.0629455 0.11349 -0.494431
+0.0679804 0.10274 -0.495
+0.182225 0.0994352 -0.45531
+0.183192 0.0624657 -0.461352
+0.185388 0.0628344 -0.460407
+0.18653 0.0630999 -0.459904
+
+
+0.385113 -0.0781817 -0.321119
+0.382952 -0.075612 -0.324681
+
+
+0.353869 -0.0420925 -0.37127
+0.358498 -0.0473409 -0.363978
+
+
+0.353869 -0.0420925 -0.37127
+0.339845 -0.171941 -0.324391
+
+
+0.353869 -0.0420925 -0.37127
+0.350759 -0.0384979 -0.376173
+
+
+0.176643 -0.0317329 -0.468736
+0.175289 -0.0322294 -0.469303
+0.223301 -0.0667773 -0.442807
+0.294372 -0.11943 -0.394477
+0.294431 -0.119348 -0.394459
+0.300077 -0.111393 -0.392761
+
+
+0.176643 -0.0317329 -0.468736
+0.197417 0.0278293 -0.458969
+0.234313 0.0720522 -0.437744
+
+
+0.176643 -0.0317329 -0.468736
+0.182026 -0.029901 -0.466465
+0.223301 -0.0667773 -0.442807
+0.288718 -0.127355 -0.39614
+0.288777 -0.127274 -0.396123
+0.294372 -0.11943 -0.394477
+
+
+0.448764 -0.0373803 -0.219797
+0.467061 -0.0515947 -0.172025
+0.447419 -0.0422141 -0.221851
+
+
+0.454984 -0.0140152 -0.209743
+0.467061 -0.0515947 -0.172025
+0.453725 -0.0188877 -0.211856
+
+
+0.461004 0.0102024 -0.199132
+0.467061 -0.0515947 -0.172025
+0.463031 0.0186218 -0.195413
+
+
+0.398952 0.066577 -0.302123
+0.400983 0.0665794 -0.298913
+
+
+0.417678 0.066895 -0.272064
+0.419061 0.0668851 -0.269809
+
+
+0.375407 0.0661207 -0.338999
+0.379068 0.0661513 -0.333314
+
+
+0.438139 -0.0741984 -0.235274
+0.43804 -0.0745216 -0.235415
+
+
+0.467061 -0.0515947 -0.172025
+0.468558 0.0419913 -0.185048
+
+
+0.467061 -0.0515947 -0.172025
+0.472676 0.0596495 -0.17719
+
+
+-0.0764972 0.383207 -0.358524
+-0.0766314 0.383288 -0.358464
+-0.0769618 0.384813 -0.356693
+-0.0782318 0.390431 -0.350127
+
+
+-0.13827 0.388018 -0.307462
+-0.147354 0.388976 -0.297971
+-0.252797 0.342379 -0.262704
+
+
+-0.251367 0.350467 -0.252991
+-0.256215 0.350452 -0.248085
+
+
+-0.225144 0.401015 -0.203496
+-0.221311 0.40014 -0.209199
+-0.164923 0.436861 -0.17987
+-0.0789755 0.432483 -0.256504
+-0.0837549 0.434321 -0.248628
+-0.093052 0.43774 -0.23366
+
+
+-0.225144 0.401015 -0.203496
+-0.263835 0.355597 -0.232587
+-0.264499 0.355368 -0.232201
+-0.264734 0.355274 -0.232083
+-0.261981 0.346241 -0.248025
+
+
+-0.225144 0.401015 -0.203496
+-0.225319 0.401059 -0.203227
+-0.164923 0.436861 -0.17987
+-0.075606 0.393575 -0.345446
+-0.0728924 0.396641 -0.340835
+
+
+-0.218591 0.440362 -0.112575
+-0.224704 0.446302 -0.0268837
+-0.226771 0.446169 0.0319272
+-0.229911 0.44444 0.0232739
+-0.230622 0.444046 0.0211174
+
+
+-0.147354 0.388976 -0.297971
+-0.151112 0.389402 -0.293982
+-0.164923 0.436861 -0.17987
+-0.0981095 0.389761 -0.335949
+
+
+0.130754 0.426334 -0.235186
+0.13528 0.423951 -0.236586
+
+
+0.198541 0.389559 -0.255182
+0.205093 0.385856 -0.257099
+
+
+0.27469 0.346142 -0.276862
+0.274539 0.345468 -0.277769
+
+
+0.0720364 0.300466 -0.410925
+0.0623142 0.298046 -0.416949
+
+
+0.0720364 0.300466 -0.410925
+0.112594 0.380998 -0.304242
+0.146534 0.318328 -0.364051
+
+
+0.0720364 0.300466 -0.410925
+0.0760675 0.301431 -0.408452
+0.198312 0.245013 -0.388641
+0.260208 0.2302 -0.362864
+0.258879 0.226028 -0.36624
+0.306299 0.180405 -0.352186
+0.270915 0.110859 -0.412971
+0.26901 0.113916 -0.413131
+
+
+0.356351 0.193693 -0.297574
+0.358726 0.189526 -0.297591
+
+
+0.227297 0.335816 -0.310258
+0.224198 0.335199 -0.312351
+
+
+0.252029 0.205253 -0.382847
+0.250655 0.201065 -0.386118
+0.306299 0.180405 -0.352186
+0.265608 0.119489 -0.413363
+
+
+0.252029 0.205253 -0.382847
+0.198312 0.245013 -0.388641
+0.258536 0.225041 -0.367054
+0.25725 0.221025 -0.370281
+0.306299 0.180405 -0.352186
+0.260595 0.127602 -0.413702
+
+
+0.252029 0.205253 -0.382847
+0.252379 0.206242 -0.382053
+
+
+0.100633 0.307454 -0.393147
+0.0909656 0.30508 -0.399199
+0.198312 0.245013 -0.388641
+0.256915 0.220067 -0.371066
+0.255644 0.216124 -0.374212
+0.306299 0.180405 -0.352186
+0.255763 0.135384 -0.413998
+
+
+0.100633 0.307454 -0.393147
+0.112594 0.380998 -0.304242
+0.138732 0.316522 -0.369065
+
+
+0.100633 0.307454 -0.393147
+0.103435 0.30811 -0.391414
+
+
+0.130488 0.314592 -0.374329
+0.112594 0.380998 -0.304242
+0.121589 0.312487 -0.379974
+
+
+-0.0915982 0.364137 -0.366449
+-0.0973471 0.356809 -0.369469
+
+
+-0.509427 0.00490699 -0.123327
+-0.508571 0.00535534 -0.125432
+
+
+-0.266092 0.33303 -0.261553
+-0.267229 0.342189 -0.248041
+
+
+0.112594 0.380998 -0.304242
+0.111762 0.310139 -0.38617
+
+
+0.112594 0.380998 -0.304242
+0.0876634 0.304298 -0.401232
+0.0760675 0.301431 -0.408452
+
+
+0.112594 0.380998 -0.304242
+-0.0769618 0.384813 -0.356693
+
+
+0.112594 0.380998 -0.304242
+-0.0638418 0.406935 -0.325262
+
+
+-0.0113336 -0.339239 -0.373208
+-0.00753627 -0.339701 -0.372474
+
+
+-0.180762 -0.267973 -0.439782
+-0.177802 -0.274184 -0.435102
+
+
+-0.199669 -0.239964 -0.454593
+-0.190264 -0.24815 -0.454614
+
+
+-0.0563968 -0.202232 -0.474407
+-0.0473256 -0.199113 -0.475632
+
+
+-0.459446 0.030827 -0.241036
+-0.445457 0.167217 -0.154943
+-0.433302 0.291645 -0.0330804
+
+
+-0.374952 0.254455 -0.244927
+-0.374734 0.252757 -0.247319
+-0.268359 0.332856 -0.25938
+
+
+-0.201175 -0.177187 -0.462069
+-0.198903 -0.158999 -0.464474
+-0.296119 -0.00157042 -0.403375
+-0.409174 -0.0216262 -0.313066
+-0.413504 -0.0118493 -0.309696
+-0.433806 -0.126861 -0.214754
+-0.435833 0.0395137 -0.291874
+-0.436848 0.0418944 -0.291051
+-0.436913 0.041864 -0.290909
+-0.444269 0.03828 -0.274788
+
+
+-0.201175 -0.177187 -0.462069
+-0.0433918 -0.0459736 -0.496391
+-0.171213 -0.241625 -0.457558
+
+
+-0.201175 -0.177187 -0.462069
+-0.202552 -0.187813 -0.460628
+-0.296119 -0.00157042 -0.403375
+-0.415344 -0.00761826 -0.308266
+-0.420075 0.00314702 -0.304531
+-0.433806 -0.126861 -0.214754
+-0.42741 0.020013 -0.298681
+-0.429723 0.0254042 -0.296829
+-0.435833 0.0395137 -0.291874
+
+
+-0.374969 0.220824 -0.279975
+-0.445457 0.167217 -0.154943
+-0.427199 0.290272 -0.0539611
+
+
+-0.231764 0.0253557 -0.446656
+-0.296119 -0.00157042 -0.403375
+-0.42211 0.00786067 -0.302924
+-0.42741 0.020013 -0.298681
+
+
+0.198347 0.174511 -0.428894
+0.198312 0.245013 -0.388641
+0.25531 0.215174 -0.374985
+0.254031 0.211228 -0.378111
+
+
+0.345516 0.00625887 -0.385252
+0.429296 -0.00494892 -0.257062
+0.397179 -0.0908432 -0.301134
+0.399071 -0.0922865 -0.297989
+0.402 -0.0944374 -0.293128
+
+
+0.147826 -0.0416539 -0.480677
+0.145202 -0.0425911 -0.481751
+0.223301 -0.0667773 -0.442807
+0.283005 -0.135322 -0.397784
+0.283065 -0.13524 -0.397766
+0.288718 -0.127355 -0.39614
+
+
+0.147826 -0.0416539 -0.480677
+0.197417 0.0278293 -0.458969
+0.259025 0.0766777 -0.425791
+0.2655 0.0779598 -0.422633
+
+
+0.147826 -0.0416539 -0.480677
+0.157621 -0.0383197 -0.476646
+0.223301 -0.0667773 -0.442807
+0.27712 -0.143485 -0.399438
+0.277183 -0.1434 -0.39942
+0.283005 -0.135322 -0.397784
+
+
+0.342941 0.027757 -0.389348
+0.342913 0.0272747 -0.389391
+
+
+-0.0194343 0.118347 -0.493212
+-0.0175665 0.118729 -0.493239
+
+
+-0.139373 0.149714 -0.464366
+-0.135262 0.147346 -0.466029
+
+
+-0.100607 0.000752037 -0.492739
+-0.0972532 0.00513734 -0.493422
+-0.156562 0.0450098 -0.473141
+-0.24294 0.1823 -0.424344
+-0.238 0.184996 -0.425741
+-0.250076 0.305099 -0.307859
+-0.223882 0.192603 -0.429723
+-0.21944 0.194974 -0.430965
+
+
+-0.100607 0.000752037 -0.492739
+-0.0433918 -0.0459736 -0.496391
+-0.205368 -0.210491 -0.457569
+-0.202552 -0.187813 -0.460628
+
+
+-0.100607 0.000752037 -0.492739
+-0.101663 -0.000578721 -0.492521
+-0.156562 0.0450098 -0.473141
+-0.228768 0.18995 -0.428364
+-0.223882 0.192603 -0.429723
+
+
+0.150239 0.187128 -0.444834
+0.198312 0.245013 -0.388641
+0.250285 0.200026 -0.386946
+0.248817 0.195581 -0.390395
+
+
+-0.10588 0.130672 -0.477549
+-0.102199 0.128539 -0.478967
+
+
+-0.20724 0.211622 -0.425155
+-0.211775 0.205485 -0.427294
+
+
+-0.237601 0.0494731 -0.44223
+-0.296119 -0.00157042 -0.403375
+-0.429723 0.0254042 -0.296829
+
+
+-0.136498 -0.0460069 -0.48447
+-0.131446 -0.0393583 -0.485722
+-0.156562 0.0450098 -0.473141
+-0.0669067 0.108366 -0.492075
+-0.0714209 0.110989 -0.490424
+
+
+-0.136498 -0.0460069 -0.48447
+-0.0433918 -0.0459736 -0.496391
+-0.197763 -0.150298 -0.465631
+-0.195855 -0.135126 -0.467594
+
+
+-0.136498 -0.0460069 -0.48447
+-0.138206 -0.0481947 -0.484043
+-0.156562 0.0450098 -0.473141
+-0.0697933 0.0945107 -0.492843
+
+
+-0.24848 -0.219111 -0.426406
+-0.26703 -0.212842 -0.413329
+
+
+-0.221509 -0.0157423 -0.453581
+-0.296119 -0.00157042 -0.403375
+-0.435395 0.0448198 -0.292188
+-0.429108 0.0575587 -0.29704
+
+
+-0.197763 -0.150298 -0.465631
+-0.198903 -0.158999 -0.464474
+
+
+-0.227939 0.00984918 -0.449357
+-0.296119 -0.00157042 -0.403375
+-0.412812 0.0900808 -0.309364
+-0.406819 0.101925 -0.313784
+
+
+-0.159403 0.161065 -0.456199
+-0.154475 0.158237 -0.458236
+
+
+-0.0977701 0.126048 -0.48064
+-0.0940121 0.123868 -0.482069
+
+
+-0.0844464 0.0148328 -0.49548
+-0.0881413 0.0169237 -0.495193
+-0.0916489 0.0123514 -0.494525
+-0.0433918 -0.0459736 -0.496391
+-0.18002 -0.103052 -0.473126
+-0.168018 -0.0872427 -0.476323
+-0.156562 0.0450098 -0.473141
+-0.0726488 0.0825564 -0.49336
+
+
+-0.0576011 -0.000298485 -0.497453
+-0.0433918 -0.0459736 -0.496391
+-0.164799 -0.0830814 -0.477172
+-0.15578 -0.0712017 -0.479539
+-0.156562 0.0450098 -0.473141
+-0.0751203 0.0721837 -0.493775
+
+
+-0.0916489 0.0123514 -0.494525
+-0.092753 0.0109625 -0.494311
+-0.156562 0.0450098 -0.473141
+-0.0773188 0.0629325 -0.494114
+
+
+-0.109467 -0.0107494 -0.490854
+-0.106069 -0.00629657 -0.491591
+-0.156562 0.0450098 -0.473141
+-0.0793225 0.0544771 -0.494392
+
+
+-0.109467 -0.0107494 -0.490854
+-0.0433918 -0.0459736 -0.496391
+-0.153285 -0.0679862 -0.480186
+-0.146138 -0.0585736 -0.482031
+-0.156562 0.0450098 -0.473141
+-0.0829664 0.0390332 -0.494812
+
+
+-0.109467 -0.0107494 -0.490854
+-0.110557 -0.0121272 -0.490615
+-0.156562 0.0450098 -0.473141
+-0.0863963 0.0244061 -0.495094
+
+
+-0.185003 0.175544 -0.445543
+-0.178443 0.171793 -0.448305
+
+
+-0.12209 0.139899 -0.471251
+-0.11835 0.137737 -0.472728
+
+
+-0.0835533 0.0364067 -0.494877
+-0.0846905 0.0316919 -0.494968
+
+
+0.159595 0.184715 -0.441822
+0.198312 0.245013 -0.388641
+0.246381 0.188419 -0.395954
+0.244593 0.183069 -0.400054
+0.306299 0.180405 -0.352186
+0.251012 0.142996 -0.41426
+
+
+-0.0281588 -0.0168624 -0.499091
+-0.0278955 -0.0169873 -0.499102
+-0.0112878 0.011464 -0.500142
+0.0686406 0.101292 -0.495077
+0.0732531 0.0914262 -0.495561
+0.182225 0.0994352 -0.45531
+0.179705 0.0618024 -0.462849
+0.182007 0.0621918 -0.461869
+0.183192 0.0624657 -0.461352
+
+
+-0.0281588 -0.0168624 -0.499091
+-0.0433918 -0.0459736 -0.496391
+-0.144112 -0.0559706 -0.482547
+-0.138206 -0.0481947 -0.484043
+
+
+-0.0281588 -0.0168624 -0.499091
+-0.0307277 -0.0153971 -0.498993
+-0.0112878 0.011464 -0.500142
+0.0738641 0.0900825 -0.495626
+0.0781831 0.0808264 -0.496042
+0.182225 0.0994352 -0.45531
+0.175986 0.0610942 -0.464429
+0.178449 0.0615149 -0.463391
+0.179705 0.0618024 -0.462849
+
+
+0.366884 0.139757 -0.315687
+0.367181 0.132134 -0.319173
+
+
+0.0869994 -0.150288 -0.491402
+0.0873673 -0.146895 -0.491816
+0.223301 -0.0667773 -0.442807
+0.270939 -0.152017 -0.401137
+0.271005 -0.151927 -0.401119
+0.27712 -0.143485 -0.399438
+
+
+0.413626 0.0668314 -0.278652
+0.415099 0.0668235 -0.276272
+
+
+0.24743 -0.00689994 -0.43674
+0.197417 0.0278293 -0.458969
+0.280854 0.0807592 -0.415164
+
+
+0.25531 0.215174 -0.374985
+0.255644 0.216124 -0.374212
+
+
+0.188948 -0.0274762 -0.46352
+0.187911 -0.027863 -0.463963
+0.223301 -0.0667773 -0.442807
+0.23948 -0.194907 -0.409303
+0.239586 -0.194766 -0.409276
+0.248889 -0.182156 -0.406929
+
+
+0.188948 -0.0274762 -0.46352
+0.197417 0.0278293 -0.458969
+0.294727 0.0758942 -0.408995
+
+
+0.188948 -0.0274762 -0.46352
+0.193189 -0.0260312 -0.461696
+0.223301 -0.0667773 -0.442807
+0.228287 -0.210019 -0.412074
+0.228415 -0.20985 -0.412042
+0.23948 -0.194907 -0.409303
+
+
+-0.0310625 -0.336967 -0.376815
+-0.0364904 -0.336293 -0.377833
+
+
+0.339539 -0.183461 -0.318044
+0.346929 -0.184045 -0.309469
+
+
+-0.0433918 -0.0459736 -0.496391
+-0.129959 -0.0374605 -0.486085
+-0.125509 -0.0316068 -0.487163
+-0.156562 0.0450098 -0.473141
+-0.0881166 0.0170353 -0.495192
+-0.0881413 0.0169237 -0.495193
+
+
+-0.0433918 -0.0459736 -0.496391
+-0.12418 -0.0299148 -0.48748
+-0.120157 -0.0246264 -0.488431
+-0.156562 0.0450098 -0.473141
+-0.115217 -0.0181908 -0.48957
+-0.114077 -0.0167465 -0.489828
+-0.110557 -0.0121272 -0.490615
+
+
+-0.0433918 -0.0459736 -0.496391
+-0.11894 -0.0230805 -0.488714
+-0.115217 -0.0181908 -0.48957
+
+
+-0.0433918 -0.0459736 -0.496391
+-0.114077 -0.0167465 -0.489828
+
+
+-0.0433918 -0.0459736 -0.496391
+-0.105007 -0.00495554 -0.491818
+-0.101663 -0.000578721 -0.492521
+
+
+-0.0433918 -0.0459736 -0.496391
+-0.0961837 0.00648363 -0.493636
+-0.092753 0.0109625 -0.494311
+
+
+-0.0433918 -0.0459736 -0.496391
+-0.0727675 0.00824861 -0.496362
+
+
+-0.0433918 -0.0459736 -0.496391
+-0.0642285 0.00343587 -0.496986
+
+
+-0.0433918 -0.0459736 -0.496391
+-0.0522148 -0.00333252 -0.497815
+
+
+-0.0433918 -0.0459736 -0.496391
+-0.0476711 -0.00589105 -0.498105
+
+
+-0.0433918 -0.0459736 -0.496391
+-0.0437162 -0.00811716 -0.498342
+
+
+-0.0433918 -0.0459736 -0.496391
+-0.0401789 -0.0101074 -0.498541
+
+
+-0.0433918 -0.0459736 -0.496391
+-0.0369374 -0.0119304 -0.49871
+
+
+-0.0433918 -0.0459736 -0.496391
+-0.0339001 -0.0136377 -0.498855
+
+
+-0.0433918 -0.0459736 -0.496391
+-0.0309944 -0.0152702 -0.498981
+-0.0307277 -0.0153971 -0.498993
+
+
+-0.0433918 -0.0459736 -0.496391
+-0.0253372 -0.0184459 -0.499188
+-0.0250726 -0.0185715 -0.499198
+-0.0112878 0.011464 -0.500142
+0.0787608 0.0795522 -0.496099
+0.0828886 0.070688 -0.496459
+0.182225 0.0994352 -0.45531
+0.171933 0.0603215 -0.466133
+0.174627 0.0607868 -0.465009
+0.175986 0.0610942 -0.464429
+
+
+-0.0433918 -0.0459736 -0.496391
+-0.022475 -0.0200513 -0.499274
+-0.022204 -0.0201805 -0.499282
+-0.0112878 0.011464 -0.500142
+0.083446 0.0694554 -0.496509
+0.0874692 0.0607977 -0.496824
+0.182225 0.0994352 -0.45531
+0.167408 0.059458 -0.468018
+0.170427 0.0599856 -0.466769
+0.171933 0.0603215 -0.466133
+
+
+-0.0433918 -0.0459736 -0.496391
+-0.0195143 -0.021711 -0.49935
+-0.0192314 -0.021847 -0.499357
+-0.0112878 0.011464 -0.500142
+0.0880176 0.0595821 -0.496868
+0.0920146 0.0509623 -0.497144
+0.182225 0.0994352 -0.45531
+0.162219 0.0584671 -0.470159
+0.165696 0.059082 -0.468733
+0.167408 0.059458 -0.468018
+
+
+-0.0433918 -0.0459736 -0.496391
+-0.016389 -0.0234621 -0.499416
+-0.0160877 -0.0236086 -0.499422
+-0.0112878 0.011464 -0.500142
+0.0925647 0.0497404 -0.497183
+0.0945522 0.0454448 -0.497302
+0.0975339 0.0460055 -0.496122
+0.106624 0.0478272 -0.492501
+0.182225 0.0994352 -0.45531
+0.156085 0.0572948 -0.472668
+0.160216 0.0580341 -0.470987
+0.162219 0.0584671 -0.470159
+
+
+-0.0433918 -0.0459736 -0.496391
+-0.0130187 -0.0253495 -0.499473
+-0.0126908 -0.0255111 -0.499479
+-0.0112878 0.011464 -0.500142
+0.0950608 0.0391898 -0.497513
+0.0945522 0.0454448 -0.497302
+
+
+-0.0433918 -0.0459736 -0.496391
+-0.00929961 -0.0274314 -0.499521
+-0.00893402 -0.0276141 -0.499526
+-0.0112878 0.011464 -0.500142
+0.0959672 0.0284366 -0.497833
+0.0953915 0.0355905 -0.49762
+0.0950608 0.0391898 -0.497513
+
+
+-0.0433918 -0.0459736 -0.496391
+-0.00508967 -0.029787 -0.499559
+-0.00467102 -0.0299993 -0.499563
+-0.0112878 0.011464 -0.500142
+0.0968524 0.0178364 -0.498106
+0.0962887 0.0249112 -0.497923
+0.0959672 0.0284366 -0.497833
+
+
+-0.0433918 -0.0459736 -0.496391
+-0.000184572 -0.0325306 -0.499586
+0.000309987 -0.0327849 -0.499589
+
+
+-0.0433918 -0.0459736 -0.496391
+0.0131462 -0.0399832 -0.499595
+0.0139239 -0.0403937 -0.499595
+-0.0112878 0.011464 -0.500142
+0.0995527 -0.015121 -0.498697
+0.098957 -0.00744126 -0.498588
+0.0986275 -0.00372439 -0.498536
+
+
+-0.0433918 -0.0459736 -0.496391
+0.0229514 -0.0454626 -0.499563
+0.0240098 -0.0460278 -0.49956
+-0.0112878 0.011464 -0.500142
+0.10053 -0.0272734 -0.498824
+0.0998977 -0.0190563 -0.498738
+0.0995527 -0.015121 -0.498697
+
+
+-0.0433918 -0.0459736 -0.496391
+0.0368291 -0.0532161 -0.499487
+0.0383904 -0.0540586 -0.499479
+-0.0112878 0.011464 -0.500142
+0.101586 -0.0405193 -0.498914
+0.100899 -0.03153 -0.498852
+0.10053 -0.0272734 -0.498824
+
+
+-0.0433918 -0.0459736 -0.496391
+0.0585043 -0.0653238 -0.499328
+0.0611026 -0.0667392 -0.499309
+-0.0112878 0.011464 -0.500142
+0.102755 -0.0553069 -0.498965
+0.101989 -0.0452311 -0.49893
+0.101586 -0.0405193 -0.498914
+
+
+-0.0433918 -0.0459736 -0.496391
+0.0935124 -0.0861126 -0.498896
+0.0923505 -0.0978804 -0.497594
+
+
+-0.0433918 -0.0459736 -0.496391
+0.0905336 -0.115703 -0.49556
+0.0891898 -0.129091 -0.493977
+0.223301 -0.0667773 -0.442807
+0.214469 -0.22861 -0.415437
+0.214629 -0.228397 -0.415397
+0.228287 -0.210019 -0.412074
+
+
+-0.0433918 -0.0459736 -0.496391
+0.0888612 -0.13213 -0.493616
+0.0873673 -0.146895 -0.491816
+
+
+-0.319214 0.287946 0.267217
+-0.377121 0.208972 0.25399
+-0.368106 0.120291 0.331066
+-0.365915 0.121441 0.3333
+-0.361072 0.00364482 0.34643
+-0.320695 0.034003 0.384544
+-0.321478 0.0316646 0.383865
+-0.32363 0.0256149 0.381986
+
+
+-0.214505 0.276644 0.368579
+-0.218674 0.276113 0.366989
+
+
+-0.00213614 0.461304 0.196841
+0.0566727 0.45453 0.201473
+0.156643 0.447645 0.178689
+0.155173 0.450785 0.171997
+
+
+-0.302409 0.397771 0.104415
+-0.29675 0.401357 0.105713
+
+
+-0.302409 0.397771 0.104415
+-0.263681 0.425199 -0.00886505
+-0.312852 0.391095 0.102059
+-0.306943 0.394872 0.103423
+-0.272468 0.359184 0.217136
+-0.174521 0.473625 0.134942
+-0.188042 0.466935 0.129882
+-0.224704 0.446302 -0.0268837
+-0.220719 0.449472 0.0488745
+-0.225687 0.446763 0.0351393
+-0.226771 0.446169 0.0319272
+
+
+-0.302409 0.397771 0.104415
+-0.306943 0.394872 0.103423
+
+
+-0.211548 -0.0728612 0.460017
+-0.143539 -0.180191 0.444216
+-0.143711 -0.0788782 0.480417
+-0.154382 -0.0724029 0.479312
+
+
+-0.257768 0.425431 -0.0592439
+-0.258467 0.424839 -0.0616085
+-0.224704 0.446302 -0.0268837
+-0.209548 0.455521 0.0800943
+-0.21885 0.450487 0.0543056
+-0.220719 0.449472 0.0488745
+
+
+-0.257768 0.425431 -0.0592439
+-0.263681 0.425199 -0.00886505
+-0.282512 0.410329 0.108857
+-0.277008 0.413755 0.110102
+-0.272468 0.359184 0.217136
+-0.191415 0.465253 0.128645
+-0.19232 0.4648 0.128305
+-0.205549 0.457679 0.0915348
+-0.209548 0.455521 0.0800943
+
+
+-0.257768 0.425431 -0.0592439
+-0.255612 0.427191 -0.0526746
+-0.224704 0.446302 -0.0268837
+-0.150177 0.485585 0.14395
+-0.154802 0.483317 0.142263
+
+
+-0.242957 -0.116735 0.432499
+-0.143539 -0.180191 0.444216
+-0.154398 -0.0723936 0.47931
+
+
+-0.32149 -0.370309 0.0990276
+-0.320927 -0.370241 0.100847
+
+
+-0.293348 0.110213 0.407725
+-0.293593 0.110393 0.407537
+-0.303174 0.0835903 0.399469
+
+
+-0.293348 0.110213 0.407725
+-0.310123 -0.0280028 0.391714
+-0.195857 0.00521306 0.477082
+
+
+-0.293348 0.110213 0.407725
+-0.290679 0.10829 0.40976
+-0.178942 0.188749 0.427498
+-0.275592 0.266342 0.345844
+-0.27459 0.269051 0.345004
+-0.271009 0.269531 0.346418
+
+
+-0.175705 0.0540562 0.481535
+-0.179596 0.0515146 0.480924
+
+
+-0.331392 0.00301689 0.374993
+-0.310123 -0.0280028 0.391714
+-0.196362 0.0203006 0.477555
+
+
+-0.0370989 0.1624 0.491124
+-0.0371077 0.167787 0.488831
+
+
+-0.203405 0.0449319 0.473603
+-0.196983 0.0402803 0.478107
+
+
+-0.194306 -0.0373158 0.475434
+-0.193965 -0.0453372 0.475081
+
+
+-0.100434 -0.104959 0.484363
+-0.100423 -0.104965 0.484364
+
+
+-0.145936 0.284367 0.39411
+-0.149674 0.283954 0.392782
+
+
+0.113428 0.247125 0.420038
+0.145377 0.224646 0.422847
+0.235126 0.194809 0.403278
+0.23302 0.18823 0.407516
+0.232652 0.187137 0.408227
+
+
+0.282358 0.128244 0.392477
+0.281975 0.128271 0.39276
+0.282127 0.128 0.392731
+
+
+0.282358 0.128244 0.392477
+0.296304 0.123013 0.383511
+0.295706 0.124941 0.383343
+
+
+0.282358 0.128244 0.392477
+0.288636 0.12831 0.387656
+
+
+0.0380188 0.406703 0.289938
+0.0379466 0.407556 0.288693
+
+
+0.0386555 0.39161 0.311677
+0.0385584 0.393025 0.309667
+
+
+-0.245811 0.434857 -0.0222902
+-0.263681 0.425199 -0.00886505
+-0.27266 0.416464 0.111032
+-0.267075 0.419911 0.112286
+-0.272468 0.359184 0.217136
+-0.207705 0.455724 0.125058
+-0.200803 0.459813 0.126485
+-0.19232 0.4648 0.128305
+
+
+0.0375362 0.417426 0.273994
+0.0374675 0.418162 0.272885
+
+
+0.037021 0.428112 0.257547
+0.0369423 0.428981 0.256192
+
+
+-0.1021 0.441095 -0.218954
+-0.104121 0.441877 -0.215574
+-0.108508 0.443451 -0.208522
+
+
+0.0364095 0.498687 0.000589382
+0.0352024 0.49878 -0.000517745
+
+
+0.0233988 0.464902 -0.222498
+0.0301128 0.468627 -0.215197
+
+
+0.0167079 0.499897 -0.0209294
+0.0192349 0.499764 -0.0182399
+
+
+-0.128035 0.445763 0.219312
+-0.12969 0.447729 0.216062
+-0.00934473 0.41695 0.276524
+-0.00195534 0.449396 0.223315
+
+
+-0.128035 0.445763 0.219312
+-0.156068 0.355593 0.31559
+-0.0806156 0.29075 0.41697
+
+
+-0.128035 0.445763 0.219312
+-0.121543 0.43824 0.231765
+
+
+-0.0455617 0.346288 0.372819
+-0.156068 0.355593 0.31559
+-0.0604929 0.292606 0.423848
+
+
+-0.247383 0.433711 -0.0270513
+-0.263681 0.425199 -0.00886505
+-0.26262 0.422662 0.113233
+-0.256842 0.426197 0.114521
+
+
+0.067923 0.488895 -0.136074
+0.0611698 0.489426 -0.141385
+0.057554 0.490388 -0.13149
+
+
+-0.344765 0.313704 -0.195466
+-0.336998 0.321247 -0.193789
+-0.310534 0.370612 -0.128901
+-0.300663 0.397763 -0.0635373
+-0.305238 0.394929 -0.0604427
+-0.306031 0.394432 -0.0599272
+
+
+-0.344765 0.313704 -0.195466
+-0.274449 0.347441 -0.23263
+-0.274556 0.34725 -0.232782
+-0.266438 0.342838 -0.248001
+
+
+-0.344765 0.313704 -0.195466
+-0.346776 0.311767 -0.195862
+-0.310534 0.370612 -0.128901
+-0.295466 0.400956 -0.0670175
+-0.299902 0.398236 -0.0640296
+-0.300663 0.397763 -0.0635373
+
+
+0.0402282 0.480195 -0.18613
+0.0388171 0.475518 -0.199473
+
+
+-0.0464544 0.424346 -0.297982
+-0.0506319 0.421847 -0.302429
+
+
+-0.24507 0.435379 -0.0200712
+-0.263681 0.425199 -0.00886505
+-0.229153 0.44296 0.120462
+-0.221912 0.447281 0.122039
+-0.272468 0.359184 0.217136
+-0.402649 0.32652 0.0908528
+
+
+-0.222615 0.356969 0.276233
+-0.156068 0.355593 0.31559
+-0.0497107 0.302206 0.418381
+
+
+-0.408383 0.328101 0.0626645
+-0.410392 0.326713 0.0559613
+
+
+-0.274841 0.278094 0.33511
+-0.272602 0.281579 0.332541
+
+
+-0.26262 0.422662 0.113233
+-0.267075 0.419911 0.112286
+
+
+-0.0446071 0.137526 0.498837
+-0.0435224 0.138644 0.498775
+
+
+-0.317897 0.0418532 0.386959
+-0.320695 0.034003 0.384544
+
+
+-0.317897 0.0418532 0.386959
+-0.310123 -0.0280028 0.391714
+-0.196877 0.0363965 0.478003
+
+
+-0.317897 0.0418532 0.386959
+-0.31684 0.0449658 0.387865
+-0.361072 0.00364482 0.34643
+-0.295499 0.113136 0.405509
+-0.293593 0.110393 0.407537
+
+
+-0.301549 0.282817 0.296479
+-0.377121 0.208972 0.25399
+-0.360105 0.124566 0.339171
+-0.357774 0.125782 0.341529
+-0.361072 0.00364482 0.34643
+-0.302299 0.123031 0.398194
+-0.29837 0.117357 0.402419
+-0.295499 0.113136 0.405509
+
+
+-0.156068 0.355593 0.31559
+-0.0374166 0.324211 0.400186
+
+
+-0.156068 0.355593 0.31559
+-0.058277 0.362155 0.349978
+
+
+-0.156068 0.355593 0.31559
+-0.0788035 0.38745 0.312607
+
+
+-0.156068 0.355593 0.31559
+-0.0821862 0.391562 0.306361
+
+
+-0.156068 0.355593 0.31559
+-0.0855203 0.395597 0.300175
+
+
+-0.156068 0.355593 0.31559
+-0.103879 0.417496 0.265623
+
+
+-0.156068 0.355593 0.31559
+-0.108539 0.422985 0.256744
+-0.109462 0.424102 0.254937
+
+
+-0.156068 0.355593 0.31559
+-0.138087 0.457437 0.199901
+-0.140294 0.460042 0.19557
+
+
+-0.156068 0.355593 0.31559
+-0.152544 0.45379 0.196932
+-0.163207 0.439449 0.208965
+
+
+-0.156068 0.355593 0.31559
+-0.165353 0.436518 0.211442
+
+
+-0.156068 0.355593 0.31559
+-0.189162 0.404119 0.238404
+-0.193666 0.397942 0.243468
+
+
+-0.156068 0.355593 0.31559
+-0.194643 0.396567 0.244608
+
+
+-0.156068 0.355593 0.31559
+-0.203844 0.383765 0.255018
+-0.207145 0.379148 0.25872
+
+
+-0.156068 0.355593 0.31559
+-0.207885 0.378082 0.259588
+
+
+-0.156068 0.355593 0.31559
+-0.211702 0.372673 0.263903
+
+
+-0.156068 0.355593 0.31559
+-0.21538 0.36742 0.26806
+
+
+-0.156068 0.355593 0.31559
+-0.226313 0.351566 0.280407
+
+
+-0.156068 0.355593 0.31559
+-0.238712 0.333171 0.294397
+-0.242691 0.32722 0.298849
+
+
+-0.156068 0.355593 0.31559
+-0.243674 0.325711 0.299991
+
+
+-0.156068 0.355593 0.31559
+-0.249353 0.317117 0.306394
+
+
+-0.250652 -0.420702 0.108268
+-0.250504 -0.421122 0.107189
+
+
+-0.248946 -0.426064 0.0939425
+-0.248749 -0.426614 0.0924984
+
+
+-0.25407 -0.408854 0.138796
+-0.253966 -0.409183 0.138003
+
+
+-0.253065 -0.412549 0.129471
+-0.252956 -0.412879 0.128662
+
+
+-0.508061 -0.0480142 0.165726
+-0.504108 -0.0459336 0.179748
+
+
+-0.210105 -0.414771 0.184915
+-0.209034 -0.41547 0.184482
+
+
+0.0272128 -0.121618 0.493457
+0.024162 -0.122059 0.493586
+
+
+-0.0180676 0.00573142 0.500292
+-0.0188853 0.00960632 0.500306
+
+
+0.0380328 -0.395349 0.318148
+0.0434305 -0.390481 0.32268
+
+
+0.041599 -0.288981 0.409733
+0.0527917 -0.222753 0.444966
+-0.0401611 -0.246505 0.439788
+-0.0324426 -0.250635 0.437073
+
+
+-0.509797 -0.0488965 0.15953
+-0.513642 -0.0509456 0.145667
+
+
+-0.379843 -0.233315 0.238752
+-0.327379 -0.209631 0.315085
+-0.302835 -0.133475 0.384533
+
+
+-0.203654 -0.419099 0.18198
+-0.202774 -0.41966 0.181633
+
+
+-0.249697 -0.423676 0.100387
+-0.249866 -0.423203 0.101616
+
+
+-0.246452 -0.433594 0.0735031
+-0.246151 -0.434426 0.0712752
+
+
+-0.257074 -0.382219 -0.201015
+-0.252308 -0.383125 -0.205507
+
+
+-0.0187331 -0.540646 0.056706
+-0.0158754 -0.538439 0.0350617
+
+
+0.0168875 -0.530996 0.119864
+0.141621 -0.397458 0.269018
+-0.0160222 -0.459557 0.247572
+
+
+-0.284008 -0.425702 -0.000330076
+-0.287546 -0.423717 -0.00294531
+
+
+0.0225833 -0.412597 -0.282128
+0.0226457 -0.412593 -0.282128
+
+
+-0.0535499 -0.527472 0.0562355
+-0.208416 -0.429931 0.148736
+-0.104235 -0.50719 0.0494469
+
+
+0.161837 -0.408564 0.239165
+0.159575 -0.410791 0.236964
+
+
+0.127864 -0.441007 0.206146
+0.127474 -0.441365 0.205781
+
+
+0.127864 -0.441007 0.206146
+0.188299 -0.407946 0.219728
+
+
+0.127864 -0.441007 0.206146
+0.135842 -0.433484 0.213925
+
+
+-0.00496186 -0.485677 0.202202
+0.141621 -0.397458 0.269018
+-0.00884287 -0.47658 0.218147
+
+
+-0.208416 -0.429931 0.148736
+-0.0817685 -0.516219 0.0524604
+
+
+-0.208416 -0.429931 0.148736
+-0.0685835 -0.500582 0.119029
+
+
+0.243743 -0.247195 0.364782
+0.239972 -0.250472 0.365794
+
+
+0.25869 -0.307349 0.30665
+0.253108 -0.311011 0.309028
+
+
+0.338077 -0.253793 0.270561
+0.30802 -0.229117 0.320982
+0.315184 -0.26983 0.281487
+
+
+0.376499 -0.311841 0.105311
+0.377308 -0.310883 0.105236
+
+
+0.302453 -0.385232 0.135479
+0.306544 -0.381936 0.132211
+
+
+0.269212 -0.300494 0.30208
+0.264834 -0.303385 0.303952
+
+
+0.369514 -0.19207 0.283367
+0.365271 -0.189046 0.289883
+
+
+0.353246 -0.180439 0.308113
+0.350099 -0.178212 0.312794
+
+
+0.374844 -0.195892 0.275115
+0.369977 -0.192418 0.282644
+
+
+0.388897 -0.205989 0.253149
+0.381801 -0.200907 0.264262
+
+
+0.328323 -0.260695 0.275276
+0.30802 -0.229117 0.320982
+0.343621 -0.249831 0.267847
+
+
+0.252986 -0.327284 0.289116
+0.253252 -0.329724 0.285746
+
+
+0.357101 -0.24011 0.26117
+0.30802 -0.229117 0.320982
+0.349864 -0.245342 0.264767
+
+
+0.388189 -0.298052 0.103121
+0.389195 -0.296815 0.102991
+
+
+0.252099 -0.318072 0.301619
+0.251762 -0.315084 0.305689
+
+
+0.219606 -0.400913 0.202893
+0.266236 -0.359412 0.2307
+
+
+0.219575 -0.400843 0.203058
+0.206875 -0.402673 0.212326
+
+
+0.410484 -0.264947 0.11199
+0.41208 -0.261624 0.114667
+0.419658 -0.262625 0.0705015
+
+
+0.410484 -0.264947 0.11199
+0.375883 -0.302347 0.133038
+0.404735 -0.27676 0.102256
+0.406017 -0.27418 0.104354
+
+
+0.410484 -0.264947 0.11199
+0.409884 -0.26622 0.110906
+0.41893 -0.263704 0.0707584
+
+
+0.492143 0.138446 0.0462469
+0.495541 0.129309 0.0474115
+
+
+0.492143 0.138446 0.0462469
+0.463122 0.171021 -0.0813485
+
+
+0.492143 0.138446 0.0462469
+0.490384 0.143141 0.045691
+
+
+0.460679 -0.160225 -0.129095
+0.459691 -0.158757 -0.133951
+
+
+0.473675 0.186799 0.0401839
+0.476543 0.179435 0.0411408
+
+
+0.473675 0.186799 0.0401839
+0.462967 0.171552 -0.0810559
+
+
+0.473675 0.186799 0.0401839
+0.472127 0.190741 0.0397115
+
+
+0.482582 0.163764 0.0430852
+0.485577 0.15589 0.0440989
+
+
+0.482582 0.163764 0.0430852
+0.463053 0.171265 -0.0812038
+
+
+0.482582 0.163764 0.0430852
+0.480997 0.167897 0.0425935
+
+
+0.464699 0.209468 0.0373036
+0.462853 0.171902 -0.0809167
+
+
+0.45493 0.233576 0.0342141
+0.462701 0.172338 -0.0807961
+
+
+0.330538 0.333943 0.20512
+0.314707 0.343679 0.206265
+
+
+0.330538 0.333943 0.20512
+0.219585 0.354976 0.275998
+0.350095 0.320694 0.205221
+0.33988 0.328183 0.204417
+0.322378 0.345909 0.187055
+
+
+0.330538 0.333943 0.20512
+0.332305 0.332863 0.204975
+0.245333 0.413089 0.139891
+0.242712 0.386863 0.211086
+0.242135 0.387192 0.211129
+0.23628 0.390575 0.211454
+
+
+0.407265 0.332484 0.0113582
+0.400626 0.340463 -0.00201021
+
+
+0.152604 0.456084 0.160637
+0.0566727 0.45453 0.201473
+0.154645 0.451852 0.169735
+
+
+0.278773 0.365526 0.20881
+0.270981 0.370206 0.209321
+0.245333 0.413089 0.139891
+0.249253 0.383057 0.210698
+0.248661 0.383397 0.210744
+0.242712 0.386863 0.211086
+
+
+0.278773 0.365526 0.20881
+0.219585 0.354976 0.275998
+0.299705 0.352843 0.207356
+0.289359 0.359138 0.208072
+0.245333 0.413089 0.139891
+0.279582 0.365045 0.208745
+0.278773 0.365526 0.20881
+
+
+0.447166 0.198798 -0.104186
+0.393111 0.349371 -0.0170405
+0.393509 0.348903 -0.0162389
+0.270737 0.406813 0.107727
+0.36528 0.366419 -0.00574485
+0.36757 0.365242 -0.00763697
+0.389029 0.354146 -0.025131
+0.393111 0.349371 -0.0170405
+
+
+0.484713 -0.105727 0.10418
+0.485084 -0.105552 0.102428
+
+
+0.477754 -0.10858 0.136383
+0.478215 -0.10838 0.134315
+
+
+0.463967 -0.0822286 0.201
+0.46433 -0.0754189 0.200287
+
+
+0.470266 -0.174619 -0.0797222
+0.468901 -0.17246 -0.0870852
+
+
+0.511791 0.0194568 -0.0320372
+0.49032 -0.00243348 0.0999044
+0.512538 0.034509 -0.0369451
+
+
+0.473317 -0.0637019 -0.14822
+0.473674 -0.0624559 -0.14761
+
+
+0.509467 0.0597739 -0.0198378
+0.509782 0.0579912 -0.0215577
+
+
+0.509467 0.0597739 -0.0198378
+0.463264 0.170305 -0.0820576
+
+
+0.509467 0.0597739 -0.0198378
+0.508036 0.0677589 -0.0119964
+
+
+0.452891 0.197749 -0.0765836
+0.452592 0.19912 -0.0749847
+0.448623 0.197667 -0.0993371
+
+
+0.452891 0.197749 -0.0765836
+0.46069 0.177027 -0.0813436
+0.460072 0.178329 -0.0817812
+0.45928 0.179931 -0.0824786
+0.45829 0.181835 -0.0835464
+0.458064 0.182241 -0.0838469
+0.454932 0.186797 -0.0902463
+
+
+0.452891 0.197749 -0.0765836
+0.453102 0.196477 -0.0784101
+0.449066 0.197112 -0.0982814
+
+
+0.402786 0.321569 0.0676633
+0.434716 0.190815 0.158152
+0.415687 0.322204 0.0284814
+0.415683 0.322212 0.0284814
+0.409683 0.321946 0.0467619
+
+
+0.26153 0.419092 0.0783452
+0.261426 0.419138 0.0784389
+
+
+0.248661 0.383397 0.210744
+0.219585 0.354976 0.275998
+0.288428 0.359696 0.208148
+0.279582 0.365045 0.208745
+
+
+0.156643 0.447645 0.178689
+0.157167 0.446572 0.180942
+
+
+0.150391 0.464348 0.139599
+0.0451587 0.471195 0.162285
+0.0468818 0.462944 0.183008
+0.0464416 0.46288 0.183282
+0.0446869 0.462909 0.183651
+
+
+0.150072 0.471473 0.118271
+0.150013 0.473075 0.11338
+
+
+0.150072 0.471473 0.118271
+0.0451587 0.471195 0.162285
+0.0489937 0.462967 0.18239
+0.0485735 0.462899 0.182676
+0.0468818 0.462944 0.183008
+
+
+0.150072 0.471473 0.118271
+0.150174 0.469944 0.122863
+
+
+0.259127 0.420211 0.0802398
+0.259026 0.420255 0.0803312
+
+
+0.309565 0.26178 0.314476
+0.304756 0.261672 0.318584
+
+
+0.309565 0.26178 0.314476
+0.306795 0.147283 0.366469
+
+
+0.309565 0.26178 0.314476
+0.315342 0.26196 0.309479
+
+
+0.434716 0.190815 0.158152
+0.408829 0.32189 0.0493903
+
+
+0.434716 0.190815 0.158152
+0.397316 0.321243 0.084053
+
+
+0.434716 0.190815 0.158152
+0.392243 0.320906 0.099105
+
+
+0.434716 0.190815 0.158152
+0.382782 0.32018 0.126763
+0.378797 0.319846 0.138217
+
+
+0.216691 -0.386087 -0.289223
+0.215157 -0.386301 -0.289181
+
+
+0.179479 -0.4479 -0.190542
+0.190126 -0.442922 -0.197083
+
+
+0.0759644 -0.493971 -0.126273
+0.0844557 -0.490385 -0.131544
+
+
+0.215086 -0.448934 -0.0506442
+0.215096 -0.449172 -0.0479944
+
+
+0.215248 -0.449562 -0.0427248
+0.215243 -0.449756 -0.0404284
+
+
+0.0988395 -0.484216 -0.140538
+0.106616 -0.480854 -0.145353
+
+
+0.00480079 -0.523178 -0.0817001
+0.00327124 -0.521672 -0.0847503
+
+
+-0.285245 -0.38616 -0.148067
+-0.285775 -0.38346 -0.154562
+
+
+-0.239102 -0.430585 -0.0944348
+-0.188258 -0.456482 -0.0811385
+-0.254268 -0.425605 -0.0837323
+
+
+-0.19539 -0.443791 -0.124681
+-0.188258 -0.456482 -0.0811385
+-0.245865 -0.428377 -0.089669
+
+
+-0.177451 -0.477007 0.0395389
+-0.187703 -0.47264 0.0381264
+
+
+0.189164 -0.465646 0.0918556
+0.212186 -0.409569 0.193403
+
+
+0.101943 -0.499612 0.111566
+0.0967371 -0.501588 0.1127
+
+
+-0.182761 -0.448445 -0.127452
+-0.179913 -0.449826 -0.126467
+
+
+-0.182761 -0.448445 -0.127452
+-0.188258 -0.456482 -0.0811385
+-0.233441 -0.432412 -0.098413
+
+
+-0.182761 -0.448445 -0.127452
+-0.183997 -0.447827 -0.127934
+
+
+-0.209532 -0.439785 -0.115034
+-0.188258 -0.456482 -0.0811385
+-0.228545 -0.433973 -0.101844
+
+
+-0.267035 -0.380266 -0.19154
+-0.262365 -0.381198 -0.195986
+
+
+-0.277471 -0.417845 -0.0673104
+-0.27828 -0.41494 -0.0750047
+
+
+-0.178734 -0.450409 -0.126005
+-0.188258 -0.456482 -0.0811385
+-0.224188 -0.435342 -0.104886
+
+
+-0.190305 -0.391847 -0.265134
+-0.189201 -0.391582 -0.26675
+
+
+-0.0600667 -0.419726 -0.276289
+-0.0596627 -0.419697 -0.276316
+
+
+-0.0155504 -0.416107 -0.279583
+-0.015402 -0.416096 -0.27959
+
+
+0.00502026 -0.414305 -0.281017
+0.00510697 -0.414299 -0.28102
+
+
+0.255479 -0.387196 -0.279222
+0.249527 -0.381373 -0.290272
+
+
+0.255479 -0.387196 -0.279222
+0.357095 -0.188616 -0.295231
+
+
+0.255479 -0.387196 -0.279222
+0.256402 -0.388114 -0.277483
+
+
+0.0339636 -0.431711 -0.250744
+-0.0805285 -0.434616 -0.252121
+-0.0838066 -0.430972 -0.25855
+
+
+0.0339636 -0.431711 -0.250744
+-0.0856939 -0.428813 -0.262356
+
+
+-0.149602 0.457785 0.193545
+-0.152544 0.45379 0.196932
+
+
+-0.0126571 -0.440089 0.275351
+-0.00262124 -0.431278 0.283913
+
+
+-0.284547 -0.140884 0.397974
+-0.282594 -0.14165 0.399405
+
+
+-0.10847 -0.100141 0.483705
+-0.108459 -0.100147 0.483706
+
+
+-0.251235 -0.188723 0.400716
+-0.143539 -0.180191 0.444216
+-0.166523 -0.065021 0.478009
+
+
+-0.259744 0.270955 0.35091
+-0.253666 0.271762 0.353291
+
+
+-0.162072 -0.445182 0.16277
+-0.16015 -0.446314 0.161931
+
+
+-0.356891 -0.110945 0.343304
+-0.36383 -0.107961 0.337847
+-0.310123 -0.0280028 0.391714
+-0.217994 0.0554327 0.4633
+
+
+-0.356891 -0.110945 0.343304
+-0.327379 -0.209631 0.315085
+-0.318699 -0.126969 0.372685
+-0.324779 -0.124435 0.368097
+-0.310123 -0.0280028 0.391714
+-0.228372 0.0629375 0.455892
+
+
+-0.356891 -0.110945 0.343304
+-0.355308 -0.1116 0.344552
+-0.310123 -0.0280028 0.391714
+-0.238073 0.069962 0.448904
+
+
+-0.202555 -0.318961 0.361109
+-0.143539 -0.180191 0.444216
+-0.204087 -0.0625104 0.46635
+-0.204151 -0.0625968 0.466297
+
+
+-0.182547 -0.432693 0.172286
+-0.181644 -0.433233 0.171923
+
+
+-0.14016 0.0769155 0.486915
+-0.143381 0.074823 0.486453
+
+
+-0.295705 0.211227 0.362353
+-0.29433 0.215013 0.361262
+-0.178942 0.188749 0.427498
+-0.280695 0.252534 0.350062
+-0.277259 0.2619 0.347189
+-0.275592 0.266342 0.345844
+
+
+-0.295705 0.211227 0.362353
+-0.377121 0.208972 0.25399
+-0.351527 0.129118 0.347792
+-0.348994 0.130432 0.350334
+-0.361072 0.00364482 0.34643
+-0.309345 0.133319 0.390532
+-0.305257 0.127394 0.394975
+-0.302299 0.123031 0.398194
+
+
+-0.295705 0.211227 0.362353
+-0.298646 0.20292 0.364782
+-0.178942 0.188749 0.427498
+-0.285446 0.239572 0.353977
+-0.282237 0.248394 0.351301
+-0.280695 0.252534 0.350062
+
+
+-0.265255 0.0897078 0.428949
+-0.310123 -0.0280028 0.391714
+-0.256328 0.0832129 0.435566
+
+
+-0.0564141 -0.131147 0.487364
+-0.0564285 -0.131139 0.487363
+
+
+-0.276097 0.273768 0.339099
+-0.377121 0.208972 0.25399
+-0.342128 0.134074 0.357167
+-0.339311 0.135527 0.359973
+
+
+-0.276097 0.273768 0.339099
+-0.27459 0.269051 0.345004
+
+
+-0.276097 0.273768 0.339099
+-0.276594 0.275395 0.337076
+
+
+-0.203859 0.277921 0.37266
+-0.207723 0.277437 0.371201
+
+
+-0.328991 0.290713 0.25073
+-0.377121 0.208972 0.25399
+-0.319423 0.145936 0.379569
+-0.318322 0.146499 0.380651
+-0.316795 0.144234 0.382347
+-0.361072 0.00364482 0.34643
+-0.450419 0.0744977 0.243708
+-0.441835 0.0794264 0.253093
+
+
+-0.313876 0.286412 0.276123
+-0.377121 0.208972 0.25399
+-0.313651 0.160105 0.376891
+-0.312108 0.164512 0.375682
+-0.178942 0.188749 0.427498
+-0.289959 0.227152 0.357684
+-0.286901 0.235632 0.355142
+-0.285446 0.239572 0.353977
+
+
+-0.294096 0.280616 0.308675
+-0.377121 0.208972 0.25399
+-0.308899 0.173815 0.373062
+-0.307444 0.177932 0.371919
+-0.178942 0.188749 0.427498
+-0.302989 0.190642 0.368312
+-0.300021 0.199101 0.365869
+-0.298646 0.20292 0.364782
+
+
+-0.229911 0.44444 0.0232739
+-0.263681 0.425199 -0.00886505
+-0.215883 0.45088 0.12329
+-0.207705 0.455724 0.125058
+
+
+-0.203844 0.383765 0.255018
+-0.203051 0.384899 0.254089
+
+
+-0.282512 0.410329 0.108857
+-0.286837 0.40761 0.107925
+
+
+-0.215883 0.45088 0.12329
+-0.221912 0.447281 0.122039
+
+
+-0.27266 0.416464 0.111032
+-0.277008 0.413755 0.110102
+
+
+-0.17455 0.46341 -0.0968031
+-0.176164 0.462594 -0.0973679
+-0.180047 0.460605 -0.098798
+
+
+-0.17455 0.46341 -0.0968031
+-0.174485 0.463448 -0.0967343
+
+
+-0.17455 0.46341 -0.0968031
+-0.171947 0.462715 -0.101427
+
+
+-0.264285 0.294322 0.32322
+-0.262579 0.296972 0.321255
+
+
+-0.241264 0.418147 -0.145806
+-0.241763 0.416606 -0.149131
+
+
+-0.351645 0.365137 -0.0288039
+-0.34996 0.366244 -0.0299391
+-0.263681 0.425199 -0.00886505
+-0.200803 0.459813 0.126485
+
+
+-0.284418 0.407641 -0.0743504
+-0.285175 0.407185 -0.0738672
+-0.310534 0.370612 -0.128901
+-0.290337 0.404077 -0.0704388
+-0.294721 0.401415 -0.0674973
+-0.295466 0.400956 -0.0670175
+
+
+-0.284418 0.407641 -0.0743504
+-0.263681 0.425199 -0.00886505
+-0.205549 0.457679 0.0915348
+
+
+-0.284418 0.407641 -0.0743504
+-0.279879 0.410342 -0.0773698
+-0.310534 0.370612 -0.128901
+-0.274339 0.413612 -0.0810193
+-0.279095 0.41081 -0.0778692
+-0.279879 0.410342 -0.0773698
+
+
+-0.440916 0.285525 -0.0168528
+-0.441407 0.284234 -0.0169477
+
+
+-0.403264 0.101104 0.294612
+-0.397824 0.104135 0.30034
+
+
+0.0992733 0.435977 0.226127
+0.0985803 0.435954 0.226412
+
+
+-0.445195 0.0378418 -0.272748
+-0.445457 0.167217 -0.154943
+-0.421929 0.289063 -0.0718191
+
+
+-0.517134 0.00072693 -0.104274
+-0.51618 0.00123238 -0.106644
+
+
+-0.463654 0.0489582 0.229698
+-0.361072 0.00364482 0.34643
+-0.457878 0.0626759 0.235771
+
+
+-0.33363 -0.120766 0.361345
+-0.339673 -0.118214 0.356708
+-0.310123 -0.0280028 0.391714
+-0.274277 0.0962826 0.422198
+
+
+-0.33363 -0.120766 0.361345
+-0.327379 -0.209631 0.315085
+-0.326205 -0.123861 0.367009
+-0.332209 -0.121342 0.362439
+-0.310123 -0.0280028 0.391714
+-0.283574 0.103068 0.415176
+-0.290679 0.10829 0.40976
+
+
+-0.33363 -0.120766 0.361345
+-0.332209 -0.121342 0.362439
+
+
+-0.42304 -0.151298 0.246156
+-0.327379 -0.209631 0.315085
+-0.341118 -0.117625 0.355587
+-0.347319 -0.11499 0.350788
+-0.310123 -0.0280028 0.391714
+-0.312973 0.0557996 0.39117
+-0.31684 0.0449658 0.387865
+
+
+-0.347928 -0.208247 -0.325085
+-0.349237 -0.209487 -0.321923
+
+
+-0.491563 -0.202126 -0.0346805
+-0.48568 -0.214968 -0.0389765
+
+
+-0.387883 -0.247363 -0.224291
+-0.388683 -0.248133 -0.222201
+
+
+-0.525859 -0.00404957 -0.0824868
+-0.524766 -0.0034637 -0.0852293
+
+
+-0.39258 -0.0587019 -0.325579
+-0.391046 -0.0621219 -0.326697
+
+
+-0.528354 0.0325679 -0.0364423
+-0.528849 0.030997 -0.0365517
+
+
+-0.1631 0.0621806 0.483498
+-0.166676 0.0598485 0.482952
+
+
+-0.398497 -0.107248 0.301354
+-0.407978 -0.107228 0.291064
+-0.361072 0.00364482 0.34643
+-0.469684 0.0344852 0.223263
+
+
+-0.398497 -0.107248 0.301354
+-0.327379 -0.209631 0.315085
+-0.348816 -0.114375 0.349617
+-0.355308 -0.1116 0.344552
+
+
+-0.398497 -0.107248 0.301354
+-0.398065 -0.107243 0.301823
+-0.361072 0.00364482 0.34643
+-0.476118 0.0188911 0.216303
+
+
+-0.342128 0.134074 0.357167
+-0.348994 0.130432 0.350334
+
+
+-0.31122 -0.369791 0.128079
+-0.311095 -0.369642 0.128813
+
+
+-0.377121 0.208972 0.25399
+-0.304389 0.186715 0.369415
+-0.302989 0.190642 0.368312
+
+
+-0.377121 0.208972 0.25399
+-0.300021 0.199101 0.365869
+
+
+-0.377121 0.208972 0.25399
+-0.29136 0.223326 0.3588
+-0.289959 0.227152 0.357684
+
+
+-0.377121 0.208972 0.25399
+-0.286901 0.235632 0.355142
+
+
+-0.377121 0.208972 0.25399
+-0.282237 0.248394 0.351301
+
+
+-0.377121 0.208972 0.25399
+-0.277259 0.2619 0.347189
+
+
+-0.377121 0.208972 0.25399
+-0.308052 0.284722 0.285773
+
+
+-0.377121 0.208972 0.25399
+-0.324213 0.289368 0.258817
+
+
+-0.377121 0.208972 0.25399
+-0.333648 0.29201 0.242789
+
+
+-0.377121 0.208972 0.25399
+-0.347797 0.295859 0.2183
+
+
+-0.377121 0.208972 0.25399
+-0.358385 0.298656 0.199637
+-0.363443 0.299989 0.190615
+-0.272468 0.359184 0.217136
+-0.402298 0.31673 0.108379
+-0.402283 0.316238 0.109248
+
+
+-0.377121 0.208972 0.25399
+-0.364439 0.300229 0.18886
+-0.37015 0.301716 0.178607
+-0.272468 0.359184 0.217136
+-0.398946 0.308979 0.126424
+-0.401059 0.309481 0.122599
+
+
+-0.377121 0.208972 0.25399
+-0.371289 0.301989 0.176585
+-0.377931 0.3037 0.164593
+
+
+-0.377121 0.208972 0.25399
+-0.388916 0.306449 0.144717
+-0.398946 0.308979 0.126424
+
+
+-0.377121 0.208972 0.25399
+-0.407456 0.288069 0.132197
+
+
+-0.377121 0.208972 0.25399
+-0.412001 0.269828 0.141714
+-0.41336 0.264388 0.14451
+
+
+-0.377121 0.208972 0.25399
+-0.415656 0.254981 0.149433
+
+
+-0.377121 0.208972 0.25399
+-0.418702 0.242438 0.155931
+
+
+-0.377121 0.208972 0.25399
+-0.421319 0.231505 0.161572
+
+
+-0.377121 0.208972 0.25399
+-0.423626 0.221713 0.166603
+
+
+-0.377121 0.208972 0.25399
+-0.425708 0.212729 0.171198
+
+
+-0.377121 0.208972 0.25399
+-0.427627 0.2043 0.175489
+
+
+-0.377121 0.208972 0.25399
+-0.429431 0.196228 0.179579
+
+
+-0.377121 0.208972 0.25399
+-0.43116 0.188342 0.183555
+
+
+-0.377121 0.208972 0.25399
+-0.432849 0.180489 0.187496
+
+
+-0.377121 0.208972 0.25399
+-0.43453 0.172516 0.191476
+
+
+-0.377121 0.208972 0.25399
+-0.436235 0.164265 0.195575
+
+
+-0.377121 0.208972 0.25399
+-0.438001 0.155552 0.199884
+
+
+-0.377121 0.208972 0.25399
+-0.439868 0.146155 0.204509
+
+
+-0.377121 0.208972 0.25399
+-0.44189 0.135787 0.209588
+
+
+-0.377121 0.208972 0.25399
+-0.444136 0.124058 0.215311
+
+
+-0.377121 0.208972 0.25399
+-0.446705 0.110405 0.221947
+
+
+-0.377121 0.208972 0.25399
+-0.449746 0.0939775 0.229901
+
+
+-0.377121 0.208972 0.25399
+-0.453498 0.0734066 0.239828
+
+
+-0.180607 0.24767 -0.412239
+-0.184127 0.242976 -0.413939
+
+
+-0.311225 0.166482 -0.384528
+-0.308018 0.166758 -0.386887
+-0.250076 0.305099 -0.307859
+-0.281118 0.168848 -0.406566
+-0.270557 0.169623 -0.414214
+-0.267159 0.169895 -0.416653
+
+
+-0.311225 0.166482 -0.384528
+-0.296119 -0.00157042 -0.403375
+-0.397809 0.11952 -0.320346
+-0.391423 0.131932 -0.324916
+
+
+-0.311225 0.166482 -0.384528
+-0.321481 0.165674 -0.376917
+-0.250076 0.305099 -0.307859
+-0.294649 0.167809 -0.396707
+-0.284387 0.16858 -0.404199
+-0.281118 0.168848 -0.406566
+
+
+-0.275772 0.336828 -0.245968
+-0.27573 0.336972 -0.245818
+
+
+-0.276594 0.340208 -0.2404
+-0.276586 0.340258 -0.240339
+
+
+-0.27611 0.343914 -0.235761
+-0.275798 0.344738 -0.234951
+
+
+-0.274449 0.347441 -0.23263
+-0.274086 0.348013 -0.232218
+-0.335391 0.322787 -0.193475
+-0.329058 0.328908 -0.192098
+-0.310534 0.370612 -0.128901
+-0.268423 0.417069 -0.0849012
+-0.273509 0.414102 -0.0815463
+-0.274339 0.413612 -0.0810193
+
+
+-0.274086 0.348013 -0.232218
+-0.2737 0.348561 -0.231867
+-0.327719 0.330181 -0.191838
+-0.32236 0.335333 -0.190665
+-0.310534 0.370612 -0.128901
+-0.263082 0.419655 -0.090036
+-0.264303 0.419146 -0.0885946
+-0.266356 0.41827 -0.086238
+-0.267526 0.417594 -0.0854694
+-0.268423 0.417069 -0.0849012
+
+
+-0.2737 0.348561 -0.231867
+-0.273296 0.349082 -0.231574
+-0.321207 0.336423 -0.190442
+-0.316528 0.340895 -0.18941
+-0.310534 0.370612 -0.128901
+-0.258011 0.421772 -0.0958733
+-0.259292 0.421246 -0.0943678
+-0.263082 0.419655 -0.090036
+
+
+-0.273296 0.349082 -0.231574
+-0.272877 0.349577 -0.231334
+-0.315506 0.341853 -0.189214
+-0.311308 0.345841 -0.188282
+-0.310534 0.370612 -0.128901
+-0.252622 0.423988 -0.102052
+-0.253995 0.423433 -0.100447
+-0.258011 0.421772 -0.0958733
+
+
+-0.272877 0.349577 -0.231334
+-0.27272 0.349749 -0.231264
+-0.26531 0.343708 -0.248012
+
+
+-0.2703 0.352086 -0.230591
+-0.288539 0.366951 -0.183294
+-0.285079 0.3701 -0.182496
+
+
+-0.269848 0.352451 -0.230562
+-0.269382 0.352803 -0.230568
+-0.279821 0.374823 -0.181335
+-0.276021 0.37823 -0.180451
+-0.310534 0.370612 -0.128901
+-0.244885 0.406086 -0.171722
+-0.244403 0.407675 -0.168387
+
+
+-0.269382 0.352803 -0.230568
+-0.268903 0.353139 -0.230609
+-0.275109 0.379032 -0.180267
+-0.271001 0.38269 -0.179309
+-0.310534 0.370612 -0.128901
+-0.251889 0.399436 -0.174916
+-0.250372 0.400741 -0.174592
+-0.245093 0.405323 -0.173349
+-0.244885 0.406086 -0.171722
+
+
+-0.268903 0.353139 -0.230609
+-0.268411 0.35346 -0.230688
+-0.270004 0.38356 -0.179105
+-0.265459 0.387578 -0.178041
+-0.310534 0.370612 -0.128901
+-0.259189 0.393076 -0.1766
+-0.257908 0.394182 -0.176331
+-0.251889 0.399436 -0.174916
+
+
+-0.268411 0.35346 -0.230688
+-0.267907 0.353764 -0.230803
+-0.264344 0.388546 -0.17781
+-0.259189 0.393076 -0.1766
+
+
+-0.267907 0.353764 -0.230803
+-0.267623 0.353922 -0.230888
+
+
+-0.264499 0.355368 -0.232201
+-0.229237 0.401934 -0.197367
+-0.225319 0.401059 -0.203227
+
+
+-0.263835 0.355597 -0.232587
+-0.263148 0.355795 -0.233043
+-0.221138 0.400095 -0.209463
+-0.217316 0.399204 -0.215121
+-0.164923 0.436861 -0.17987
+-0.187912 0.393103 -0.255069
+-0.185998 0.392905 -0.257143
+-0.180706 0.39242 -0.26274
+
+
+-0.263148 0.355795 -0.233043
+-0.262442 0.355955 -0.233574
+-0.217143 0.399158 -0.215386
+-0.213257 0.398233 -0.221108
+-0.164923 0.436861 -0.17987
+-0.199811 0.394887 -0.240741
+-0.199592 0.394827 -0.241066
+-0.195551 0.39379 -0.246905
+
+
+-0.262442 0.355955 -0.233574
+-0.261909 0.356038 -0.234027
+-0.260816 0.347116 -0.248021
+
+
+-0.260428 0.34737 -0.248072
+-0.252004 0.344091 -0.261173
+
+
+-0.259227 0.356252 -0.236584
+-0.199592 0.394827 -0.241066
+
+
+-0.25736 0.356058 -0.238839
+-0.257104 0.35596 -0.239251
+
+
+-0.254317 0.35493 -0.24364
+-0.253886 0.35438 -0.244875
+
+
+-0.257632 0.336836 -0.265265
+-0.263853 0.344792 -0.248064
+
+
+-0.25325 0.354225 -0.245749
+-0.252887 0.353236 -0.247536
+-0.252976 0.353056 -0.247701
+
+
+-0.255401 0.355433 -0.241793
+-0.255284 0.355323 -0.242073
+
+
+-0.259161 0.348308 -0.248072
+-0.251292 0.346483 -0.258606
+
+
+-0.260063 0.356267 -0.23567
+-0.260889 0.356209 -0.234872
+-0.261702 0.356085 -0.234182
+-0.261909 0.356038 -0.234027
+
+
+-0.260063 0.356267 -0.23567
+-0.204408 0.396047 -0.234068
+-0.199811 0.394887 -0.240741
+
+
+-0.260063 0.356267 -0.23567
+-0.259327 0.356245 -0.236488
+
+
+-0.260889 0.356209 -0.234872
+-0.208865 0.397157 -0.227561
+-0.204608 0.396102 -0.233769
+-0.164923 0.436861 -0.17987
+-0.209052 0.397207 -0.227279
+-0.208865 0.397157 -0.227561
+
+
+-0.261702 0.356085 -0.234182
+-0.213079 0.398186 -0.221379
+-0.209052 0.397207 -0.227279
+
+
+-0.265121 0.355139 -0.231857
+-0.265714 0.354901 -0.231555
+-0.266291 0.35464 -0.231304
+
+
+-0.265121 0.355139 -0.231857
+-0.233504 0.402871 -0.190945
+-0.229418 0.401978 -0.197087
+-0.164923 0.436861 -0.17987
+-0.233694 0.402917 -0.19065
+-0.233504 0.402871 -0.190945
+
+
+-0.265121 0.355139 -0.231857
+-0.264734 0.355274 -0.232083
+
+
+-0.265714 0.354901 -0.231555
+-0.238045 0.403847 -0.184078
+-0.233694 0.402917 -0.19065
+
+
+-0.266849 0.35436 -0.2311
+-0.250372 0.400741 -0.174592
+
+
+-0.267388 0.354063 -0.230941
+-0.257908 0.394182 -0.176331
+
+
+-0.270752 0.351714 -0.230624
+-0.271198 0.351324 -0.23069
+-0.271633 0.350916 -0.230793
+-0.272057 0.350489 -0.230936
+-0.272468 0.350044 -0.23112
+-0.27272 0.349749 -0.231264
+
+
+-0.270752 0.351714 -0.230624
+-0.292734 0.363121 -0.184228
+-0.289333 0.36624 -0.183449
+-0.310534 0.370612 -0.128901
+-0.293521 0.362411 -0.184381
+-0.292734 0.363121 -0.184228
+
+
+-0.270752 0.351714 -0.230624
+-0.270356 0.352036 -0.2306
+
+
+-0.271198 0.351324 -0.23069
+-0.296929 0.359263 -0.185158
+-0.293521 0.362411 -0.184381
+
+
+-0.271633 0.350916 -0.230793
+-0.301206 0.355299 -0.1861
+-0.297725 0.358538 -0.185311
+-0.310534 0.370612 -0.128901
+-0.302028 0.354546 -0.186258
+-0.301206 0.355299 -0.1861
+
+
+-0.272057 0.350489 -0.230936
+-0.305655 0.351146 -0.187074
+-0.302028 0.354546 -0.186258
+
+
+-0.272468 0.350044 -0.23112
+-0.310379 0.346706 -0.188103
+-0.30652 0.350348 -0.18724
+-0.310534 0.370612 -0.128901
+-0.359394 0.299477 -0.198527
+-0.356747 0.302042 -0.198001
+-0.346776 0.311767 -0.195862
+
+
+-0.274827 0.34682 -0.233089
+-0.275194 0.346156 -0.23362
+-0.275522 0.34546 -0.234238
+-0.275798 0.344738 -0.234951
+
+
+-0.274827 0.34682 -0.233089
+-0.356747 0.302042 -0.198001
+
+
+-0.274827 0.34682 -0.233089
+-0.274556 0.34725 -0.232782
+
+
+-0.275194 0.346156 -0.23362
+-0.372975 0.286182 -0.201423
+-0.359394 0.299477 -0.198527
+
+
+-0.275522 0.34546 -0.234238
+-0.379782 0.274423 -0.210323
+-0.380758 0.278571 -0.203029
+-0.376705 0.28255 -0.20217
+-0.310534 0.370612 -0.128901
+-0.384384 0.279589 -0.192053
+-0.381667 0.278809 -0.200321
+-0.380758 0.278571 -0.203029
+
+
+-0.276494 0.342179 -0.237766
+-0.276441 0.342369 -0.23756
+
+
+-0.252887 0.353236 -0.247536
+-0.250937 0.35416 -0.248201
+
+
+-0.251328 0.346145 -0.259035
+-0.19266 0.393519 -0.250027
+-0.187912 0.393103 -0.255069
+
+
+-0.211393 0.444227 -0.110001
+-0.224704 0.446302 -0.0268837
+-0.137369 0.491461 0.13128
+-0.135279 0.492383 0.12821
+0.0451587 0.471195 0.162285
+0.0510678 0.462981 0.181785
+0.0506551 0.462912 0.182076
+0.0489937 0.462967 0.18239
+
+
+-0.251532 0.345305 -0.259983
+-0.185998 0.392905 -0.257143
+
+
+-0.0534068 0.422884 -0.297952
+-0.0626868 0.426436 -0.282755
+-0.0789755 0.432483 -0.256504
+
+
+-0.159829 0.390295 -0.284852
+-0.151112 0.389402 -0.293982
+
+
+-0.159829 0.390295 -0.284852
+-0.252442 0.343042 -0.26216
+
+
+-0.159829 0.390295 -0.284852
+-0.162841 0.390631 -0.281639
+
+
+0.00266621 0.453155 -0.245091
+-0.00369489 0.449521 -0.25195
+
+
+-0.035331 0.430982 -0.286066
+-0.0431059 0.42637 -0.294361
+
+
+0.0380805 0.473038 -0.206462
+0.0329363 0.470211 -0.212073
+
+
+0.0291881 0.46248 0.188136
+0.0566727 0.45453 0.201473
+0.116753 0.461381 0.161949
+0.102775 0.461852 0.166176
+0.0451587 0.471195 0.162285
+0.0652449 0.462858 0.177625
+0.0646022 0.462838 0.177897
+0.0623989 0.462904 0.178474
+
+
+-0.253185 0.341749 -0.263169
+-0.157399 0.377503 -0.303739
+-0.179859 0.365022 -0.299493
+
+
+-0.176164 0.462594 -0.0973679
+-0.224704 0.446302 -0.0268837
+-0.127067 0.496004 0.115985
+-0.12675 0.496142 0.115519
+
+
+-0.253555 0.341168 -0.263582
+-0.186145 0.36159 -0.298226
+
+
+-0.213769 0.346239 -0.292884
+-0.219728 0.342873 -0.29176
+
+
+-0.213769 0.346239 -0.292884
+-0.254329 0.340097 -0.264245
+
+
+-0.213769 0.346239 -0.292884
+-0.211095 0.347691 -0.29345
+
+
+-0.0766314 0.383288 -0.358464
+-0.0834398 0.374635 -0.362066
+
+
+-0.376268 0.161012 -0.33557
+-0.376208 0.165264 -0.331653
+-0.445457 0.167217 -0.154943
+-0.417241 0.287967 -0.0875416
+
+
+-0.254742 0.3396 -0.264497
+-0.221714 0.341797 -0.291328
+
+
+-0.115188 0.333781 -0.37892
+-0.119554 0.328176 -0.381179
+
+
+-0.255168 0.339129 -0.2647
+-0.227821 0.338368 -0.290121
+
+
+-0.243601 0.329394 -0.286915
+-0.256868 0.337447 -0.265225
+
+
+-0.255576 0.338681 -0.264888
+-0.232744 0.33559 -0.289137
+
+
+-0.165153 0.268332 -0.404578
+-0.168458 0.26397 -0.406202
+
+
+-0.255994 0.338251 -0.265039
+-0.236867 0.33325 -0.288303
+
+
+-0.142081 0.298795 -0.392888
+-0.14555 0.294282 -0.394638
+
+
+-0.256425 0.33784 -0.265151
+-0.240432 0.331214 -0.287573
+
+
+-0.157595 0.278362 -0.400782
+-0.16089 0.274034 -0.402415
+
+
+-0.157399 0.377503 -0.303739
+-0.14519 0.384186 -0.306151
+
+
+-0.258241 0.336358 -0.265279
+-0.251734 0.324657 -0.285181
+-0.253525 0.323559 -0.284834
+
+
+-0.324748 0.165388 -0.374494
+-0.321481 0.165674 -0.376917
+
+
+-0.324748 0.165388 -0.374494
+-0.296119 -0.00157042 -0.403375
+-0.353367 0.16299 -0.353003
+-0.349769 0.163318 -0.355715
+-0.250076 0.305099 -0.307859
+-0.3353 0.164536 -0.366601
+-0.324748 0.165388 -0.374494
+
+
+-0.258716 0.336017 -0.265245
+-0.254216 0.323189 -0.284636
+
+
+-0.259206 0.335692 -0.265176
+-0.256672 0.321726 -0.28409
+
+
+-0.264372 0.317069 -0.282329
+-0.260762 0.334799 -0.264764
+
+
+-0.25971 0.335384 -0.265069
+-0.259149 0.320239 -0.283531
+
+
+-0.260228 0.335093 -0.264925
+-0.261697 0.318698 -0.282949
+
+
+-0.418666 0.320902 0.0277051
+-0.420684 0.319437 0.0208041
+
+
+-0.284387 0.16858 -0.404199
+-0.296119 -0.00157042 -0.403375
+-0.338695 0.164232 -0.364063
+-0.3353 0.164536 -0.366601
+
+
+-0.261318 0.334512 -0.264569
+-0.267239 0.315311 -0.281656
+
+
+-0.267526 0.417594 -0.0854694
+-0.263681 0.425199 -0.00886505
+-0.21885 0.450487 0.0543056
+
+
+-0.261894 0.334245 -0.264328
+-0.270385 0.313369 -0.280908
+
+
+-0.262489 0.333999 -0.264036
+-0.273923 0.311171 -0.280057
+
+
+-0.360377 -0.220341 -0.294526
+-0.361395 -0.221307 -0.292026
+
+
+-0.263102 0.333779 -0.263691
+-0.278018 0.308613 -0.279061
+
+
+-0.263757 0.333553 -0.263308
+-0.282916 0.305538 -0.277857
+
+
+-0.264445 0.333344 -0.262864
+-0.289011 0.301692 -0.276345
+
+
+-0.265157 0.333173 -0.262345
+-0.296984 0.29664 -0.274352
+
+
+-0.265886 0.333049 -0.261744
+-0.308117 0.28956 -0.271549
+
+
+-0.266683 0.332926 -0.261064
+-0.325179 0.278676 -0.267229
+
+
+0.344352 -0.189472 -0.309068
+0.346184 -0.18891 -0.307369
+
+
+0.341766 -0.17074 -0.322925
+0.341353 -0.170931 -0.323279
+
+
+0.417953 -0.106483 -0.266068
+0.360878 -0.182426 -0.29456
+
+
+0.390339 -0.0952393 -0.307097
+0.393723 -0.0883043 -0.306818
+0.394126 -0.0886102 -0.306155
+0.397179 -0.0908432 -0.301134
+
+
+0.348618 -0.180863 -0.30945
+0.337452 -0.176397 -0.324506
+
+
+0.36032 -0.185045 -0.293669
+0.36026 -0.185176 -0.29366
+
+
+0.360865 -0.182755 -0.294383
+0.422915 -0.110257 -0.257479
+
+
+0.360875 -0.182076 -0.294767
+0.413183 -0.102872 -0.274246
+0.416084 -0.105032 -0.269293
+
+
+0.35976 -0.177894 -0.298459
+0.359651 -0.177633 -0.298733
+
+
+0.357656 -0.174915 -0.302565
+0.357438 -0.174594 -0.302995
+
+
+0.355048 -0.172795 -0.306744
+0.354096 -0.17148 -0.308564
+
+
+0.355139 -0.189425 -0.296968
+0.354528 -0.189559 -0.297582
+
+
+0.348387 -0.189468 -0.304563
+0.347504 -0.189026 -0.305822
+
+
+0.351489 -0.18987 -0.300829
+0.352616 -0.189877 -0.299552
+
+
+0.351489 -0.18987 -0.300829
+0.339698 -0.197577 -0.309218
+
+
+0.351489 -0.18987 -0.300829
+0.350837 -0.189767 -0.301627
+
+
+0.347794 -0.182429 -0.309458
+0.337819 -0.180136 -0.321918
+
+
+0.358047 -0.18797 -0.294534
+0.357955 -0.188034 -0.294601
+
+
+0.349424 -0.179313 -0.309444
+0.338858 -0.17301 -0.324888
+
+
+0.360818 -0.18128 -0.295295
+0.360762 -0.180803 -0.295634
+0.360669 -0.18028 -0.296043
+0.360527 -0.179708 -0.296535
+
+
+0.360818 -0.18128 -0.295295
+0.403833 -0.0958421 -0.290053
+
+
+0.360818 -0.18128 -0.295295
+0.360832 -0.181519 -0.295141
+
+
+0.360762 -0.180803 -0.295634
+0.399071 -0.0922865 -0.297989
+
+
+0.360669 -0.18028 -0.296043
+0.394126 -0.0886102 -0.306155
+
+
+0.236039 -0.360037 -0.318788
+0.237101 -0.361469 -0.316857
+
+
+0.318773 -0.0847762 -0.386888
+0.32594 -0.0744728 -0.384549
+
+
+0.318773 -0.0847762 -0.386888
+0.33907 -0.172738 -0.324806
+
+
+0.318773 -0.0847762 -0.386888
+0.318701 -0.0848769 -0.386911
+
+
+0.0998977 -0.0190563 -0.498738
+0.197417 0.0278293 -0.458969
+0.316561 0.0178616 -0.402569
+
+
+0.384948 0.0663104 -0.324132
+0.387843 0.0663276 -0.319613
+
+
+0.337367 -0.177757 -0.323808
+0.22962 -0.325671 -0.345608
+
+
+0.221308 -0.282059 -0.379076
+0.33741 -0.176706 -0.324372
+
+
+0.337365 -0.177381 -0.324029
+0.226673 -0.310084 -0.357653
+
+
+0.337381 -0.177031 -0.324215
+0.223925 -0.295672 -0.368709
+
+
+0.337451 -0.176403 -0.324504
+0.218764 -0.268936 -0.388993
+
+
+0.337487 -0.176127 -0.324622
+0.216243 -0.256038 -0.398665
+
+
+0.337533 -0.175864 -0.324723
+0.213696 -0.243116 -0.408278
+0.211738 -0.233364 -0.415496
+0.0542157 -0.290746 -0.403643
+0.199001 -0.224393 -0.42404
+0.188048 -0.217305 -0.430885
+0.186642 -0.216411 -0.431753
+
+
+0.294431 -0.119348 -0.394459
+0.3385 -0.173497 -0.325007
+
+
+0.337587 -0.175612 -0.324807
+0.214629 -0.228397 -0.415397
+
+
+0.216265 -0.0179422 -0.451457
+0.215459 -0.0182515 -0.451824
+0.223301 -0.0667773 -0.442807
+0.200519 -0.225357 -0.423095
+0.199001 -0.224393 -0.42404
+
+
+0.216265 -0.0179422 -0.451457
+0.197417 0.0278293 -0.458969
+0.264614 -0.000763066 -0.428351
+
+
+0.216265 -0.0179422 -0.451457
+0.219772 -0.0167339 -0.449847
+0.223301 -0.0667773 -0.442807
+0.188048 -0.217305 -0.430885
+
+
+0.337649 -0.175371 -0.324878
+0.228415 -0.20985 -0.412042
+
+
+0.198916 -0.0240129 -0.459209
+0.198038 -0.024345 -0.459591
+0.223301 -0.0667773 -0.442807
+0.176394 -0.209768 -0.438102
+
+
+0.198916 -0.0240129 -0.459209
+0.197417 0.0278293 -0.458969
+0.255172 -0.0041378 -0.432976
+
+
+0.198916 -0.0240129 -0.459209
+0.202589 -0.0227585 -0.457595
+0.223301 -0.0667773 -0.442807
+0.154451 -0.195547 -0.451505
+0.153189 -0.194741 -0.452263
+
+
+0.337717 -0.175139 -0.324935
+0.239586 -0.194766 -0.409276
+
+
+0.0905336 -0.115703 -0.49556
+0.0908338 -0.112915 -0.495881
+
+
+-0.0130187 -0.0253495 -0.499473
+-0.0160877 -0.0236086 -0.499422
+
+
+0.337962 -0.174486 -0.325038
+0.264383 -0.161025 -0.402899
+0.270939 -0.152017 -0.401137
+
+
+0.0880176 0.0595821 -0.496868
+0.0874692 0.0607977 -0.496824
+
+
+0.338056 -0.17428 -0.325052
+0.271005 -0.151927 -0.401119
+
+
+0.0975339 0.0460055 -0.496122
+0.197417 0.0278293 -0.458969
+0.240849 -0.00924327 -0.439914
+
+
+0.338157 -0.174078 -0.325055
+0.277183 -0.1434 -0.39942
+
+
+0.154451 -0.195547 -0.451505
+0.16399 -0.201749 -0.445703
+
+
+0.338264 -0.173881 -0.325049
+0.283065 -0.13524 -0.397766
+
+
+0.225107 -0.0148252 -0.447373
+0.224239 -0.0151583 -0.447777
+0.223301 -0.0667773 -0.442807
+0.143714 -0.188572 -0.457971
+
+
+0.225107 -0.0148252 -0.447373
+0.197417 0.0278293 -0.458969
+0.235081 -0.0112926 -0.442671
+
+
+0.225107 -0.0148252 -0.447373
+0.228961 -0.0134888 -0.445567
+0.223301 -0.0667773 -0.442807
+0.121668 -0.174216 -0.47106
+0.12032 -0.173352 -0.471847
+
+
+0.338378 -0.173688 -0.325033
+0.288777 -0.127274 -0.396123
+
+
+0.338768 -0.173122 -0.324924
+0.306006 -0.102996 -0.390938
+0.312101 -0.0943184 -0.389025
+
+
+0.0787608 0.0795522 -0.496099
+0.0781831 0.0808264 -0.496042
+
+
+0.339239 -0.172541 -0.324729
+0.326019 -0.0743604 -0.384522
+
+
+0.339423 -0.172343 -0.324635
+0.334172 -0.0625887 -0.381813
+
+
+0.339625 -0.172143 -0.324524
+0.343612 -0.0489026 -0.378624
+
+
+0.421509 0.0669519 -0.265781
+0.422834 0.0669402 -0.263602
+
+
+0.40442 0.0666756 -0.293439
+0.4062 0.0666735 -0.290605
+
+
+0.365911 0.161209 -0.30575
+0.366236 0.154473 -0.308896
+
+
+0.219695 -0.401332 0.201995
+0.269803 -0.36078 0.22416
+
+
+0.292829 -0.369248 0.180926
+0.21914 -0.403704 0.19796
+
+
+0.280502 -0.364789 0.204278
+0.284115 -0.366106 0.197488
+
+
+0.273323 -0.362114 0.217661
+0.273151 -0.362043 0.217991
+
+
+0.273323 -0.362114 0.217661
+0.219707 -0.401756 0.201166
+
+
+0.273323 -0.362114 0.217661
+0.276691 -0.363371 0.211414
+
+
+0.221131 -0.389008 0.223356
+0.225878 -0.384393 0.226997
+
+
+0.221131 -0.389008 0.223356
+0.207293 -0.397091 0.222213
+0.208852 -0.396985 0.22091
+
+
+0.221131 -0.389008 0.223356
+0.221027 -0.389121 0.223254
+
+
+0.215214 -0.39474 0.218796
+0.21767 -0.392384 0.220659
+
+
+0.215214 -0.39474 0.218796
+0.210734 -0.396859 0.219317
+0.211285 -0.39707 0.218397
+0.211566 -0.398239 0.215982
+
+
+0.215214 -0.39474 0.218796
+0.215165 -0.394816 0.218706
+
+
+0.233993 -0.37645 0.233272
+0.248903 -0.361854 0.244742
+
+
+0.233993 -0.37645 0.233272
+0.204334 -0.397587 0.224131
+0.205719 -0.397338 0.223268
+
+
+0.233993 -0.37645 0.233272
+0.233707 -0.376741 0.233032
+
+
+0.219276 -0.399972 0.205024
+0.258675 -0.356465 0.244434
+
+
+0.213155 -0.396681 0.217279
+0.211285 -0.39707 0.218397
+
+
+0.207293 -0.397091 0.222213
+0.206189 -0.397299 0.222892
+
+
+0.20074 -0.39854 0.225784
+0.199814 -0.398868 0.226054
+
+
+0.193507 -0.40186 0.22641
+0.19346 -0.401892 0.226394
+
+
+0.190331 -0.404383 0.224625
+0.166257 -0.404185 0.243424
+
+
+0.190025 -0.404708 0.224294
+0.164142 -0.406293 0.241381
+0.164052 -0.406375 0.241306
+
+
+0.189488 -0.405372 0.223537
+0.18926 -0.40571 0.22311
+0.157006 -0.413294 0.234476
+
+
+0.18926 -0.40571 0.22311
+0.189222 -0.405774 0.223024
+
+
+0.202219 -0.406909 0.208711
+0.211365 -0.409957 0.193455
+
+
+0.188242 -0.408368 0.218968
+0.188251 -0.408793 0.21814
+0.0958316 -0.471018 0.174939
+
+
+0.188251 -0.408793 0.21814
+0.188338 -0.409216 0.217243
+0.0557459 -0.50845 0.135868
+0.0533307 -0.510686 0.133544
+0.141621 -0.397458 0.269018
+-0.000756805 -0.495459 0.184899
+0.00353556 -0.505397 0.167174
+-0.176814 -0.420902 0.204888
+0.00878485 -0.517445 0.145512
+0.00921081 -0.518397 0.143794
+
+
+0.188338 -0.409216 0.217243
+0.188386 -0.409329 0.21698
+
+
+0.189433 -0.411099 0.212544
+0.173037 -0.431713 0.185905
+0.181183 -0.424888 0.192264
+
+
+0.190039 -0.41156 0.211067
+0.190412 -0.411717 0.210409
+
+
+0.193098 -0.412863 0.20558
+0.194045 -0.412809 0.204788
+
+
+0.302615 -0.382688 0.14107
+0.21821 -0.405088 0.196194
+
+
+0.191838 -0.412423 0.20766
+0.192018 -0.412438 0.20746
+
+
+0.189009 -0.410599 0.213924
+0.189122 -0.41069 0.213641
+
+
+0.188665 -0.410151 0.215118
+0.109061 -0.485183 0.135805
+
+
+0.188456 -0.409679 0.216232
+0.06384 -0.513885 0.118276
+
+
+0.188392 -0.407542 0.220419
+0.188375 -0.407663 0.220203
+
+
+0.188492 -0.407163 0.22105
+0.142212 -0.427465 0.22011
+0.141998 -0.427661 0.219914
+
+
+0.188814 -0.406421 0.222167
+0.150852 -0.41923 0.228507
+
+
+0.203155 -0.406072 0.209439
+0.214425 -0.408286 0.193705
+
+
+0.191006 -0.403746 0.225202
+0.191356 -0.403428 0.225473
+0.191732 -0.403111 0.225717
+
+
+0.191006 -0.403746 0.225202
+0.170379 -0.400031 0.247397
+0.170293 -0.400112 0.247325
+0.141621 -0.397458 0.269018
+0.00390597 -0.506229 0.165685
+0.00878485 -0.517445 0.145512
+
+
+0.191006 -0.403746 0.225202
+0.190955 -0.403796 0.225155
+
+
+0.191356 -0.403428 0.225473
+0.172466 -0.397905 0.249404
+
+
+0.204982 -0.404415 0.210859
+0.218699 -0.404408 0.197033
+
+
+0.197178 -0.399894 0.226633
+0.196508 -0.400215 0.226669
+
+
+0.204334 -0.397587 0.224131
+0.203107 -0.397897 0.22473
+
+
+0.210734 -0.396859 0.219317
+0.208914 -0.396994 0.220834
+
+
+0.186485 -0.420417 0.196435
+0.186374 -0.420521 0.196327
+
+
+0.173037 -0.431713 0.185905
+0.172731 -0.431978 0.185646
+
+
+0.208251 -0.411233 0.194016
+0.121182 -0.492287 0.10726
+
+
+0.215516 -0.45444 0.0715911
+0.215629 -0.453827 0.0533801
+
+
+0.21079 -0.410231 0.193483
+0.165423 -0.475119 0.097277
+0.174735 -0.471433 0.0951348
+
+
+0.211247 -0.45663 0.0867622
+0.213397 -0.408919 0.193479
+
+
+0.236539 -0.443219 0.0873124
+0.242787 -0.439709 0.0878008
+
+
+0.214857 -0.448099 -0.0603784
+0.214892 -0.448416 -0.0570136
+
+
+0.22207 -0.451254 0.0862649
+0.215562 -0.454843 0.0857489
+
+
+0.296344 -0.391744 0.129269
+0.299333 -0.388517 0.13259
+
+
+0.284605 -0.404219 0.116435
+0.287576 -0.401071 0.11972
+
+
+0.329707 -0.337033 0.174022
+0.331181 -0.334954 0.174818
+
+
+0.329707 -0.337033 0.174022
+0.319882 -0.304039 0.235874
+0.31188 -0.362187 0.163904
+
+
+0.329707 -0.337033 0.174022
+0.326492 -0.34163 0.172154
+
+
+0.218465 -0.404755 0.196589
+0.303367 -0.377677 0.150782
+0.303477 -0.376999 0.152071
+
+
+0.297821 -0.371016 0.171358
+0.297559 -0.370917 0.171874
+
+
+0.297821 -0.371016 0.171358
+0.21893 -0.404066 0.197468
+
+
+0.297821 -0.371016 0.171358
+0.303275 -0.37292 0.160866
+
+
+0.434785 -0.233908 0.0814063
+0.434634 -0.234011 0.0819785
+
+
+0.37043 -0.318748 0.106394
+0.371381 -0.317652 0.106294
+
+
+0.0659433 -0.301164 0.400051
+0.0527917 -0.222753 0.444966
+-0.0300847 -0.251855 0.436265
+
+
+-0.0203086 0.0168556 0.50031
+-0.021377 0.0219714 0.500295
+
+
+-0.143711 -0.0788782 0.480417
+-0.143697 -0.0788865 0.480418
+
+
+-0.230976 -0.0999369 0.443177
+-0.231025 -0.100004 0.443134
+
+
+-0.230976 -0.0999369 0.443177
+-0.143539 -0.180191 0.444216
+-0.236982 -0.108347 0.437854
+
+
+-0.230976 -0.0999369 0.443177
+-0.224875 -0.0914118 0.448526
+
+
+-0.243771 -0.209369 0.394796
+-0.143539 -0.180191 0.444216
+-0.249018 -0.125264 0.427007
+
+
+-0.259034 -0.16682 0.406825
+-0.255752 -0.176121 0.404242
+
+
+-0.259034 -0.16682 0.406825
+-0.143539 -0.180191 0.444216
+-0.261901 -0.143458 0.415143
+
+
+-0.259034 -0.16682 0.406825
+-0.25977 -0.16478 0.407377
+
+
+-0.346617 -0.0443529 0.359017
+-0.310123 -0.0280028 0.391714
+-0.321478 0.0316646 0.383865
+
+
+-0.0283583 0.0568932 0.499995
+-0.0313252 0.0713933 0.499811
+
+
+-0.0808425 -0.256252 0.429136
+-0.078832 -0.255038 0.430264
+
+
+-0.0808425 -0.256252 0.429136
+-0.143539 -0.180191 0.444216
+-0.255054 -0.17804 0.403717
+
+
+-0.0808425 -0.256252 0.429136
+-0.0863251 -0.259653 0.425986
+
+
+0.000700244 -0.428397 0.286694
+0.00907043 -0.421013 0.293817
+
+
+0.0945318 -0.343566 0.364562
+0.100702 -0.337745 0.369569
+
+
+-0.0401611 -0.246505 0.439788
+-0.042964 -0.245046 0.440742
+
+
+0.015703 -0.275829 0.419671
+0.011382 -0.273578 0.421305
+0.0527917 -0.222753 0.444966
+-0.01382 -0.260442 0.430503
+
+
+-0.131851 -0.375066 0.324592
+-0.0213985 -0.321575 0.382795
+-0.121521 -0.382038 0.31946
+
+
+0.176724 -0.266995 0.401895
+0.176874 -0.269797 0.400401
+
+
+0.175114 -0.23307 0.419654
+0.174981 -0.230794 0.420837
+
+
+0.173996 -0.21135 0.430785
+0.173861 -0.209156 0.431905
+
+
+0.177464 -0.283004 0.393372
+0.177376 -0.2813 0.394287
+
+
+0.0527917 -0.222753 0.444966
+-0.00691621 -0.264064 0.42802
+
+
+0.0527917 -0.222753 0.444966
+0.00553457 -0.270552 0.423474
+
+
+0.0527917 -0.222753 0.444966
+0.0171407 -0.276543 0.419146
+
+
+0.0527917 -0.222753 0.444966
+0.0229222 -0.279505 0.416956
+
+
+0.0527917 -0.222753 0.444966
+0.0288394 -0.282522 0.414691
+
+
+0.0527917 -0.222753 0.444966
+0.0487699 -0.292587 0.406907
+
+
+0.0527917 -0.222753 0.444966
+0.0567716 -0.296592 0.403726
+
+
+0.0527917 -0.222753 0.444966
+0.0767853 -0.306548 0.395673
+
+
+0.0527917 -0.222753 0.444966
+0.0900795 -0.313127 0.390268
+
+
+0.0527917 -0.222753 0.444966
+0.107131 -0.321538 0.383294
+
+
+0.472846 -0.178642 -0.0657348
+0.471269 -0.176122 -0.074377
+
+
+0.486771 -0.104835 0.0942842
+0.487129 -0.104662 0.0925589
+
+
+0.482558 -0.106635 0.114344
+0.482949 -0.106456 0.11253
+
+
+0.46314 -0.0965513 0.202589
+0.463427 -0.0998787 0.200928
+
+
+0.508987 0.0430324 -0.0566173
+0.463273 0.170111 -0.0823954
+
+
+0.475343 -0.182561 -0.0520148
+0.474023 -0.180432 -0.0593583
+
+
+0.462374 -0.162695 -0.120716
+0.461366 -0.161178 -0.125768
+
+
+0.477397 -0.0474491 -0.141422
+0.477861 -0.045602 -0.140568
+
+
+0.468016 -0.171155 -0.0917109
+0.466797 -0.169249 -0.0981721
+
+
+0.511592 0.0475454 -0.0317741
+0.512811 0.0403086 -0.0388673
+
+
+-0.239443 0.439001 -0.00388821
+-0.24028 0.438497 -0.00610042
+-0.240439 0.438395 -0.00676215
+
+
+-0.243601 0.436381 -0.0157221
+-0.263681 0.425199 -0.00886505
+-0.225687 0.446763 0.0351393
+
+
+-0.480641 0.177438 -0.0253928
+-0.480893 0.176719 -0.0254424
+
+
+-0.498226 0.125995 -0.0293625
+-0.498496 0.125185 -0.0294179
+
+
+-0.387269 0.306057 0.14768
+-0.388916 0.306449 0.144717
+
+
+-0.355735 0.363154 0.0922641
+-0.349304 0.367397 0.0937173
+
+
+-0.364439 0.300229 0.18886
+-0.363443 0.299989 0.190615
+
+
+-0.335953 0.376139 0.096791
+-0.341638 0.372416 0.0955166
+
+
+-0.312852 0.391095 0.102059
+-0.317635 0.388011 0.101004
+
+
+-0.229153 0.44296 0.120462
+-0.234559 0.439707 0.119334
+
+
+-0.234986 0.4416 0.00896582
+-0.263681 0.425199 -0.00886505
+-0.232823 0.44282 0.0150734
+
+
+-0.189162 0.404119 0.238404
+-0.188034 0.405694 0.237091
+
+
+0.0419119 0.485764 -0.170018
+0.0493562 0.487211 -0.158982
+
+
+0.0419119 0.485764 -0.170018
+0.0417423 0.485211 -0.171637
+
+
+0.0419119 0.485764 -0.170018
+0.0401629 0.485847 -0.168782
+
+
+0.128049 0.483766 -0.076718
+0.128 0.483755 -0.0771729
+
+
+-0.132264 0.479811 0.164748
+-0.00934473 0.41695 0.276524
+-0.00800716 0.451788 0.21919
+
+
+0.116102 0.484543 -0.0978453
+0.109164 0.485247 -0.103357
+
+
+-0.136008 0.45298 -0.163105
+-0.104262 0.466121 -0.149203
+-0.0886242 0.489069 -0.0782301
+-0.0834404 0.489139 -0.0819073
+-0.0248719 0.498374 -0.0374832
+-0.00869316 0.487899 -0.134663
+-0.00658721 0.487814 -0.136168
+0.0036621 0.487422 -0.143304
+
+
+-0.129878 0.450988 -0.173434
+-0.130411 0.451192 -0.17247
+-0.13181 0.45162 -0.170216
+
+
+-0.305655 0.351146 -0.187074
+-0.30652 0.350348 -0.18724
+
+
+-0.242332 0.414666 -0.15338
+-0.242816 0.413139 -0.156645
+
+
+-0.310848 0.39142 -0.0566572
+-0.263681 0.425199 -0.00886505
+-0.236683 0.440628 0.00415913
+
+
+-0.259292 0.421246 -0.0943678
+-0.224704 0.446302 -0.0268837
+-0.124483 0.49663 0.0929608
+-0.125369 0.495589 0.0710514
+
+
+-0.19065 0.455151 -0.10257
+-0.224704 0.446302 -0.0268837
+-0.126756 0.493779 0.0360868
+
+
+-0.24067 0.420123 -0.141438
+-0.240147 0.421708 -0.137986
+
+
+-0.253151 0.429207 -0.0448364
+-0.253514 0.428901 -0.0461333
+-0.224704 0.446302 -0.0268837
+-0.127288 0.492992 0.0221973
+
+
+-0.253151 0.429207 -0.0448364
+-0.263681 0.425199 -0.00886505
+-0.238072 0.439819 0.000209597
+
+
+-0.253151 0.429207 -0.0448364
+-0.251877 0.430218 -0.0410511
+-0.224704 0.446302 -0.0268837
+-0.127756 0.49224 0.00967674
+
+
+-0.24385 0.409655 -0.164128
+-0.243371 0.411198 -0.160859
+
+
+-0.448744 0.264827 -0.018504
+-0.449159 0.263726 -0.0185841
+
+
+-0.432076 0.302277 -0.00349481
+-0.434054 0.299195 -0.00760007
+
+
+-0.40896 0.285974 -0.114866
+-0.445457 0.167217 -0.154943
+-0.41296 0.286947 -0.101742
+
+
+-0.31687 0.387616 -0.0525767
+-0.263681 0.425199 -0.00886505
+-0.24028 0.438497 -0.00610042
+
+
+-0.273509 0.414102 -0.0815463
+-0.263681 0.425199 -0.00886505
+-0.241203 0.437926 -0.00875471
+
+
+-0.40514 0.285026 -0.127256
+-0.445457 0.167217 -0.154943
+-0.401417 0.284085 -0.139192
+
+
+-0.264303 0.419146 -0.0885946
+-0.224704 0.446302 -0.0268837
+-0.128177 0.491505 -0.00187677
+
+
+-0.323486 0.3834 -0.0480764
+-0.263681 0.425199 -0.00886505
+-0.242843 0.436881 -0.0135059
+
+
+-0.372975 0.286182 -0.201423
+-0.376705 0.28255 -0.20217
+
+
+-0.248274 0.42576 -0.106985
+-0.252622 0.423988 -0.102052
+
+
+-0.248274 0.42576 -0.106985
+-0.224704 0.446302 -0.0268837
+-0.128564 0.490772 -0.0127699
+
+
+-0.248274 0.42576 -0.106985
+-0.24677 0.426359 -0.108735
+
+
+-0.263681 0.425199 -0.00886505
+-0.244339 0.435883 -0.0178961
+
+
+-0.263681 0.425199 -0.00886505
+-0.246576 0.434305 -0.0245991
+
+
+-0.263681 0.425199 -0.00886505
+-0.248254 0.433057 -0.0297125
+
+
+-0.263681 0.425199 -0.00886505
+-0.249218 0.43232 -0.0326693
+-0.249403 0.432165 -0.0334283
+-0.224704 0.446302 -0.0268837
+-0.128925 0.490026 -0.0232509
+
+
+-0.263681 0.425199 -0.00886505
+-0.250313 0.431469 -0.0360422
+-0.250539 0.431279 -0.0369174
+-0.224704 0.446302 -0.0268837
+-0.129604 0.488444 -0.0438186
+-0.129756 0.488041 -0.0486951
+
+
+-0.263681 0.425199 -0.00886505
+-0.251595 0.430455 -0.040007
+-0.251877 0.430218 -0.0410511
+
+
+-0.263681 0.425199 -0.00886505
+-0.255123 0.427605 -0.0509803
+-0.255612 0.427191 -0.0526746
+
+
+-0.263681 0.425199 -0.00886505
+-0.261595 0.422256 -0.0712318
+-0.262686 0.42133 -0.0748528
+-0.224704 0.446302 -0.0268837
+-0.183568 0.458808 -0.100028
+
+
+-0.263681 0.425199 -0.00886505
+-0.279095 0.41081 -0.0778692
+
+
+-0.263681 0.425199 -0.00886505
+-0.289593 0.40453 -0.0709155
+-0.290337 0.404077 -0.0704388
+
+
+-0.263681 0.425199 -0.00886505
+-0.294721 0.401415 -0.0674973
+
+
+-0.263681 0.425199 -0.00886505
+-0.299902 0.398236 -0.0640296
+
+
+-0.263681 0.425199 -0.00886505
+-0.305238 0.394929 -0.0604427
+
+
+-0.263681 0.425199 -0.00886505
+-0.330943 0.378609 -0.0429868
+
+
+0.0605383 0.148443 -0.487374
+0.0627926 0.153062 -0.4855
+
+
+0.258536 0.225041 -0.367054
+0.258879 0.226028 -0.36624
+
+
+0.393723 -0.0883043 -0.306818
+0.39234 -0.0866406 -0.309144
+
+
+0.413183 -0.102872 -0.274246
+0.411362 -0.101464 -0.27736
+
+
+0.431377 -0.0967087 -0.244618
+0.431216 -0.0972288 -0.244841
+
+
+0.213696 -0.243116 -0.408278
+0.214336 -0.246462 -0.405807
+
+
+0.194133 -0.0256766 -0.461289
+0.193189 -0.0260312 -0.461696
+
+
+0.194133 -0.0256766 -0.461289
+0.197417 0.0278293 -0.458969
+0.229891 -0.0131329 -0.44513
+0.228961 -0.0134888 -0.445567
+
+
+0.194133 -0.0256766 -0.461289
+0.198038 -0.024345 -0.459591
+
+
+0.276659 0.101475 -0.412513
+0.280706 0.0947878 -0.412187
+
+
+0.0711456 0.264322 -0.434329
+0.0698688 0.269324 -0.431775
+
+
+0.0862801 0.205554 -0.463456
+0.0849745 0.210793 -0.460913
+
+
+0.264383 -0.161025 -0.402899
+0.264311 -0.161121 -0.402919
+
+
+0.367821 0.113808 -0.327461
+0.368142 0.103288 -0.332181
+
+
+0.429296 -0.00494892 -0.257062
+0.350605 -0.0371072 -0.376462
+
+
+0.429296 -0.00494892 -0.257062
+0.347311 -0.00869649 -0.382265
+
+
+0.429296 -0.00494892 -0.257062
+0.343565 0.0221571 -0.38838
+
+
+0.429296 -0.00494892 -0.257062
+0.348532 0.0358269 -0.380804
+0.353099 0.0425131 -0.373765
+
+
+0.429296 -0.00494892 -0.257062
+0.355973 0.0466519 -0.369334
+
+
+0.429296 -0.00494892 -0.257062
+0.362558 0.0562811 -0.359087
+
+
+0.0686406 0.101292 -0.495077
+0.0679804 0.10274 -0.495
+
+
+0.1852 0.177995 -0.43338
+0.191048 0.176462 -0.431392
+0.198312 0.245013 -0.388641
+0.244101 0.181691 -0.401126
+0.242053 0.175597 -0.405769
+0.306299 0.180405 -0.352186
+0.24625 0.150588 -0.414491
+
+
+0.0831429 0.217854 -0.457482
+0.081893 0.222848 -0.455033
+
+
+0.0766499 0.181915 -0.473608
+0.0789276 0.18658 -0.471645
+
+
+0.0646379 0.289163 -0.421573
+0.0631839 0.294798 -0.418641
+
+
+0.0771519 0.241172 -0.445982
+0.0759365 0.245984 -0.443575
+
+
+0.0876634 0.304298 -0.401232
+0.0909656 0.30508 -0.399199
+
+
+0.209966 0.0674811 -0.449308
+0.207216 0.0670117 -0.45058
+
+
+0.195178 0.0646902 -0.456084
+0.193033 0.064333 -0.457036
+
+
+0.185388 0.0628344 -0.460407
+0.197417 0.0278293 -0.458969
+0.2206 -0.016416 -0.449466
+0.219772 -0.0167339 -0.449847
+
+
+0.368155 0.102931 -0.332336
+0.368503 0.0905538 -0.337858
+
+
+0.260208 0.2302 -0.362864
+0.260565 0.231235 -0.362005
+
+
+0.250285 0.200026 -0.386946
+0.250655 0.201065 -0.386118
+
+
+0.256915 0.220067 -0.371066
+0.25725 0.221025 -0.370281
+
+
+0.214609 0.0683546 -0.447132
+0.211508 0.0678201 -0.44858
+
+
+0.366249 0.154259 -0.308992
+0.366559 0.147378 -0.312184
+
+
+0.36496 0.178628 -0.297522
+0.365147 0.17541 -0.299056
+
+
+0.367193 0.131885 -0.319283
+0.36749 0.123603 -0.323046
+
+
+0.367503 0.123329 -0.323167
+0.367808 0.114116 -0.327325
+
+
+0.165696 0.059082 -0.468733
+0.197417 0.0278293 -0.458969
+0.212012 -0.0194358 -0.453389
+0.211213 -0.0197421 -0.453749
+
+
+0.244101 0.181691 -0.401126
+0.244593 0.183069 -0.400054
+
+
+0.219972 0.0693623 -0.444598
+0.216373 0.0687358 -0.446293
+
+
+0.261967 0.235659 -0.358401
+0.262346 0.236769 -0.357474
+
+
+-0.168811 -0.292813 -0.421022
+-0.171498 -0.287206 -0.425281
+
+
+-0.0589897 0.109787 -0.492433
+-0.0609345 0.109381 -0.492375
+
+
+0.0368291 -0.0532161 -0.499487
+0.0240098 -0.0460278 -0.49956
+
+
+0.0925647 0.0497404 -0.497183
+0.0920146 0.0509623 -0.497144
+
+
+0.0549883 0.136908 -0.492001
+0.057322 0.141692 -0.490084
+
+
+0.0565871 0.127083 -0.493659
+0.0557597 0.128885 -0.493551
+
+
+0.0712651 0.17073 -0.478265
+0.0734922 0.175291 -0.476368
+
+
+0.0821893 0.193419 -0.46876
+0.0845642 0.198284 -0.466688
+
+
+0.198312 0.245013 -0.388641
+0.241485 0.174005 -0.407
+0.23907 0.166858 -0.412416
+0.306299 0.180405 -0.352186
+0.241386 0.158304 -0.414697
+
+
+0.198312 0.245013 -0.388641
+0.238392 0.164958 -0.413875
+0.237962 0.16369 -0.414831
+
+
+0.198312 0.245013 -0.388641
+0.229818 0.165946 -0.417784
+
+
+0.198312 0.245013 -0.388641
+0.221271 0.168295 -0.420852
+
+
+0.198312 0.245013 -0.388641
+0.213303 0.170471 -0.423679
+
+
+0.198312 0.245013 -0.388641
+0.183679 0.178417 -0.433883
+
+
+0.198312 0.245013 -0.388641
+0.176094 0.180415 -0.436415
+
+
+0.198312 0.245013 -0.388641
+0.168131 0.182498 -0.439041
+
+
+0.198312 0.245013 -0.388641
+0.139731 0.189822 -0.448178
+
+
+0.198312 0.245013 -0.388641
+0.127602 0.192913 -0.451998
+
+
+0.198312 0.245013 -0.388641
+0.113151 0.196574 -0.456504
+0.0992866 0.200043 -0.460803
+0.182225 0.0994352 -0.45531
+0.148566 0.0558569 -0.47572
+0.153661 0.0567791 -0.473662
+0.156085 0.0572948 -0.472668
+
+
+0.198312 0.245013 -0.388641
+0.0952704 0.201082 -0.462029
+0.0868955 0.20317 -0.464603
+
+
+0.296086 0.372402 0.161247
+0.245333 0.413089 0.139891
+0.314725 0.353588 0.179657
+
+
+-0.108539 0.422985 0.256744
+-0.104691 0.418485 0.264037
+
+
+0.11462 0.385484 0.298544
+0.110773 0.384889 0.300692
+
+
+0.0716545 0.378329 0.321806
+0.0647817 0.377082 0.325449
+
+
+0.0384652 0.396208 0.305115
+0.038378 0.397404 0.303406
+
+
+0.0381534 0.40359 0.294476
+0.0380779 0.404521 0.293126
+
+
+0.0378927 0.409574 0.28572
+0.0378227 0.410372 0.284546
+
+
+0.0376539 0.414879 0.277831
+0.0375855 0.41562 0.276722
+
+
+-0.174521 0.473625 0.134942
+-0.170633 0.475548 0.136364
+
+
+-0.138087 0.457437 0.199901
+-0.12969 0.447729 0.216062
+
+
+0.0781027 0.379474 0.318385
+0.0722523 0.378426 0.321502
+
+
+0.0935079 0.382124 0.310127
+0.0892512 0.381396 0.312435
+
+
+0.128637 0.387529 0.29067
+0.12404 0.386864 0.293278
+
+
+0.102136 0.383539 0.305435
+0.0982824 0.382905 0.307549
+
+
+0.270259 0.370632 0.209379
+0.263215 0.374832 0.209828
+
+
+0.270259 0.370632 0.209379
+0.219585 0.354976 0.275998
+0.255417 0.379437 0.210331
+0.249253 0.383057 0.210698
+
+
+0.270259 0.370632 0.209379
+0.270981 0.370206 0.209321
+
+
+0.106276 0.384198 0.303163
+0.102499 0.383588 0.305248
+
+
+0.039388 0.372421 0.338755
+0.0393704 0.372733 0.338318
+
+
+0.0367812 0.432168 0.251177
+0.0367383 0.433349 0.249305
+
+
+0.0837169 0.435608 0.232087
+0.0842298 0.435632 0.231874
+
+
+0.113237 0.436194 0.220729
+0.112262 0.43617 0.221127
+
+
+0.151235 0.436544 0.205891
+0.161768 0.436599 0.201773
+
+
+-0.0179965 0.494417 0.101245
+0.0451587 0.471195 0.162285
+0.0684961 0.462796 0.176648
+0.0677483 0.462784 0.176944
+0.0652449 0.462858 0.177625
+
+
+0.0815093 0.462457 0.172754
+0.0769996 0.462599 0.17407
+0.0451587 0.471195 0.162285
+0.0723249 0.462713 0.17549
+0.0714283 0.462708 0.175826
+0.0684961 0.462796 0.176648
+
+
+0.0815093 0.462457 0.172754
+0.0566727 0.45453 0.201473
+0.0997233 0.461922 0.167177
+0.0910203 0.462209 0.169785
+0.0451587 0.471195 0.162285
+0.0829646 0.46244 0.172251
+0.0815093 0.462457 0.172754
+
+
+-0.00632034 0.447988 -0.254824
+-0.0128109 0.444243 -0.261803
+
+
+-0.0473243 0.489006 -0.10756
+-0.0421066 0.488909 -0.111213
+-0.0248719 0.498374 -0.0374832
+-0.018879 0.488259 -0.12753
+-0.017117 0.488193 -0.128793
+-0.00869316 0.487899 -0.134663
+
+
+-0.0473243 0.489006 -0.10756
+-0.104262 0.466121 -0.149203
+-0.0823001 0.489146 -0.0827462
+-0.0774092 0.489191 -0.0862083
+-0.0248719 0.498374 -0.0374832
+-0.0275722 0.488534 -0.121432
+-0.0260499 0.488483 -0.122528
+-0.018879 0.488259 -0.12753
+
+
+-0.0473243 0.489006 -0.10756
+-0.0484711 0.489031 -0.106726
+-0.0248719 0.498374 -0.0374832
+-0.0352136 0.488746 -0.116064
+-0.0338613 0.488705 -0.117041
+-0.0275722 0.488534 -0.121432
+
+
+-0.146178 0.479259 -0.0663005
+-0.147578 0.478504 -0.0677696
+
+
+-0.158051 0.472745 -0.079046
+-0.159303 0.472054 -0.0803605
+
+
+-0.146278 0.455995 -0.145667
+-0.145605 0.455779 -0.146897
+
+
+-0.117232 0.446612 -0.194275
+-0.118182 0.446982 -0.19264
+-0.120444 0.447753 -0.18901
+
+
+-0.00934473 0.41695 0.276524
+-0.015031 0.454539 0.214389
+
+
+-0.00934473 0.41695 0.276524
+-0.023456 0.457811 0.208618
+
+
+-0.00934473 0.41695 0.276524
+-0.0334726 0.460954 0.202919
+
+
+-0.00934473 0.41695 0.276524
+-0.0583912 0.465827 0.193346
+
+
+-0.00934473 0.41695 0.276524
+-0.0757118 0.469149 0.186662
+
+
+-0.00934473 0.41695 0.276524
+-0.0988888 0.473544 0.177693
+
+
+-0.379782 0.274423 -0.210323
+-0.379515 0.273228 -0.212386
+
+
+-0.379366 -0.238941 -0.246537
+-0.380169 -0.239709 -0.244485
+
+
+-0.435395 0.0448198 -0.292188
+-0.436848 0.0418944 -0.291051
+
+
+-0.388556 0.280727 -0.179332
+-0.386035 0.280013 -0.187086
+-0.384384 0.279589 -0.192053
+
+
+-0.212721 -0.0500348 -0.458894
+-0.296119 -0.00157042 -0.403375
+-0.297856 0.16754 -0.394367
+-0.294649 0.167809 -0.396707
+
+
+-0.240154 0.0602665 -0.44018
+-0.242057 0.0682224 -0.438624
+-0.296119 -0.00157042 -0.403375
+-0.270557 0.169623 -0.414214
+
+
+-0.11894 -0.0230805 -0.488714
+-0.120157 -0.0246264 -0.488431
+
+
+-0.18002 -0.103052 -0.473126
+-0.184431 -0.108772 -0.471947
+
+
+-0.218966 -0.0257327 -0.455162
+-0.296119 -0.00157042 -0.403375
+-0.260957 0.149686 -0.422027
+-0.256348 0.12976 -0.426185
+
+
+-0.244642 0.0792084 -0.436458
+-0.296119 -0.00157042 -0.403375
+-0.255408 0.125561 -0.427039
+
+
+-0.229869 0.0176467 -0.448013
+-0.296119 -0.00157042 -0.403375
+-0.251104 0.106939 -0.430865
+
+
+-0.205368 -0.210491 -0.457569
+-0.207107 -0.224045 -0.455701
+
+
+-0.227471 -0.226155 -0.441109
+-0.248197 -0.219205 -0.426606
+
+
+-0.193564 0.180334 -0.441953
+-0.201516 0.184871 -0.438578
+
+
+-0.374649 0.252053 -0.248296
+-0.445457 0.167217 -0.154943
+-0.397718 0.283132 -0.150915
+-0.396274 0.282782 -0.155401
+
+
+-0.374649 0.252053 -0.248296
+-0.374734 0.252757 -0.247319
+
+
+-0.374649 0.252053 -0.248296
+-0.374029 0.247387 -0.254834
+
+
+-0.228768 0.18995 -0.428364
+-0.238 0.184996 -0.425741
+
+
+-0.188819 0.236609 -0.416258
+-0.192564 0.23159 -0.418051
+
+
+-0.374176 0.243702 -0.258353
+-0.374224 0.242637 -0.259354
+-0.374566 0.233061 -0.268445
+
+
+-0.144112 -0.0559706 -0.482547
+-0.146138 -0.0585736 -0.482031
+
+
+-0.239737 0.0584257 -0.440524
+-0.296119 -0.00157042 -0.403375
+-0.235591 0.0411072 -0.443794
+
+
+-0.242518 0.0702648 -0.438234
+-0.242057 0.0682224 -0.438624
+
+
+-0.260957 0.149686 -0.422027
+-0.262215 0.155304 -0.42087
+
+
+-0.12418 -0.0299148 -0.48748
+-0.125509 -0.0316068 -0.487163
+
+
+-0.153285 -0.0679862 -0.480186
+-0.15578 -0.0712017 -0.479539
+
+
+-0.203615 -0.085105 -0.464088
+-0.296119 -0.00157042 -0.403375
+-0.233659 0.0331248 -0.445259
+
+
+-0.223808 -0.00665224 -0.452111
+-0.296119 -0.00157042 -0.403375
+-0.225933 0.00180789 -0.450714
+
+
+-0.216082 -0.0369895 -0.456909
+-0.296119 -0.00157042 -0.403375
+-0.208676 -0.0656545 -0.461229
+
+
+-0.312454 0.137919 0.387114
+-0.309345 0.133319 0.390532
+
+
+-0.312454 0.137919 0.387114
+-0.178942 0.188749 0.427498
+-0.317093 0.15004 0.379691
+-0.313651 0.160105 0.376891
+
+
+-0.312454 0.137919 0.387114
+-0.316795 0.144234 0.382347
+
+
+-0.216871 -0.281504 0.372948
+-0.143539 -0.180191 0.444216
+-0.247499 -0.199098 0.397761
+
+
+-0.0334004 -0.145397 0.488356
+-0.0332695 -0.144808 0.488619
+-0.0453264 -0.137699 0.487986
+
+
+-0.0169345 -6.53028e-05 0.500248
+-0.0162418 -0.00331851 0.500213
+
+
+-0.319423 0.145936 0.379569
+-0.328368 0.141252 0.370789
+
+
+-0.264063 -0.152575 0.410706
+-0.265474 -0.148521 0.411802
+
+
+-0.236052 -0.230397 0.388601
+-0.143539 -0.180191 0.444216
+-0.239981 -0.219734 0.391763
+
+
+-0.184535 -0.431429 0.173261
+-0.185376 -0.430924 0.173594
+
+
+-0.318699 -0.126969 0.372685
+-0.317241 -0.127552 0.373789
+
+
+-0.388392 0.10929 0.310211
+-0.38312 0.112186 0.315671
+
+
+-0.204087 -0.0625104 0.46635
+-0.195842 -0.0510921 0.473281
+
+
+0.052311 -0.382493 0.330032
+0.0572715 -0.377966 0.334164
+
+
+-0.348816 -0.114375 0.349617
+-0.347319 -0.11499 0.350788
+
+
+-0.381119 -0.107247 0.320024
+-0.389081 -0.107247 0.311505
+-0.361072 0.00364482 0.34643
+-0.483139 0.00170441 0.208602
+
+
+-0.381119 -0.107247 0.320024
+-0.327379 -0.209631 0.315085
+-0.365541 -0.107248 0.336488
+-0.365631 -0.107209 0.336417
+-0.372849 -0.107226 0.32881
+-0.361072 0.00364482 0.34643
+-0.491 -0.0177164 0.199869
+
+
+-0.381119 -0.107247 0.320024
+-0.380748 -0.107241 0.320421
+-0.361072 0.00364482 0.34643
+-0.500057 -0.0402908 0.189684
+
+
+-0.231898 -0.241588 0.385239
+-0.143539 -0.180191 0.444216
+-0.227415 -0.253582 0.381592
+
+
+-0.142119 -0.457074 0.153519
+-0.145615 -0.455021 0.155086
+
+
+-0.331285 -0.370489 0.0701597
+-0.329601 -0.370407 0.0753384
+
+
+-0.52747 -0.121426 -0.0075762
+-0.534749 -0.104616 -0.00197242
+
+
+-0.305257 0.127394 0.394975
+-0.178942 0.188749 0.427498
+-0.29837 0.117357 0.402419
+
+
+-0.135437 0.285445 0.397862
+-0.139418 0.285015 0.396461
+
+
+-0.0370474 0.17694 0.48492
+-0.037055 0.182058 0.482717
+
+
+-0.326205 -0.123861 0.367009
+-0.324779 -0.124435 0.368097
+
+
+-0.0841286 -0.114697 0.485588
+-0.0841171 -0.114704 0.485589
+
+
+-0.34875 -0.0513231 0.356547
+-0.310123 -0.0280028 0.391714
+-0.324242 0.0237621 0.381449
+
+
+0.0657603 -0.370241 0.341131
+0.0706877 -0.365691 0.345201
+
+
+0.00993268 -0.272854 0.421828
+0.011382 -0.273578 0.421305
+
+
+-0.095865 -0.265478 0.420502
+-0.143539 -0.180191 0.444216
+-0.210365 -0.298578 0.367579
+-0.204061 -0.31509 0.36233
+
+
+-0.143539 -0.180191 0.444216
+-0.185363 -0.319456 0.366799
+
+
+-0.143539 -0.180191 0.444216
+-0.167353 -0.308682 0.377805
+-0.163185 -0.306219 0.380322
+
+
+-0.143539 -0.180191 0.444216
+-0.152777 -0.29994 0.386665
+
+
+-0.143539 -0.180191 0.444216
+-0.140521 -0.29257 0.394068
+
+
+-0.143539 -0.180191 0.444216
+-0.129884 -0.286155 0.400451
+
+
+-0.143539 -0.180191 0.444216
+-0.120395 -0.280414 0.406105
+
+
+-0.143539 -0.180191 0.444216
+-0.111719 -0.275148 0.411236
+
+
+-0.143539 -0.180191 0.444216
+-0.0654591 -0.246738 0.437828
+
+
+0.11899 0.386136 0.296103
+0.114993 0.385531 0.298348
+
+
+0.110411 0.384842 0.300881
+0.106635 0.384246 0.302977
+
+
+0.140528 0.389176 0.283902
+0.134713 0.388369 0.287233
+
+
+0.222644 0.398339 0.212202
+0.216378 0.401871 0.212513
+
+
+0.222644 0.398339 0.212202
+0.219585 0.354976 0.275998
+0.242135 0.387192 0.211129
+
+
+0.222644 0.398339 0.212202
+0.223244 0.398006 0.212161
+
+
+0.0890019 0.462246 0.170462
+0.0829646 0.46244 0.172251
+
+
+0.0890019 0.462246 0.170462
+0.0566727 0.45453 0.201473
+0.0758837 0.462604 0.17447
+0.0723249 0.462713 0.17549
+
+
+0.0890019 0.462246 0.170462
+0.0910203 0.462209 0.169785
+
+
+0.208396 0.406322 0.212915
+0.219585 0.354976 0.275998
+0.235707 0.390899 0.211496
+
+
+0.297524 0.143505 0.375446
+0.304926 0.128306 0.375005
+
+
+0.000565964 0.244153 0.447646
+0.0130635 0.24373 0.445252
+
+
+0.124986 0.31534 0.3687
+0.121617 0.316469 0.368821
+
+
+0.122153 0.216453 0.433908
+0.122803 0.21589 0.434
+
+
+0.138967 0.198834 0.437332
+0.139774 0.198066 0.437438
+
+
+0.0845615 0.328729 0.369451
+0.0891816 0.327265 0.369387
+
+
+0.153395 0.266443 0.395494
+0.145377 0.224646 0.422847
+0.245876 0.228594 0.38105
+0.243362 0.220582 0.386371
+0.242941 0.219303 0.387227
+
+
+0.199717 0.288602 0.365328
+0.188056 0.292816 0.365968
+
+
+0.246334 0.229995 0.380105
+0.245876 0.228594 0.38105
+
+
+0.246334 0.229995 0.380105
+0.301308 0.146784 0.371183
+0.300939 0.146569 0.371563
+0.300665 0.146453 0.371829
+0.300017 0.146073 0.372494
+
+
+0.246334 0.229995 0.380105
+0.249113 0.238888 0.374158
+0.145377 0.224646 0.422847
+0.191988 0.284622 0.370602
+0.178812 0.278463 0.379121
+
+
+0.215746 0.40222 0.212554
+0.219585 0.354976 0.275998
+0.200392 0.410754 0.213294
+
+
+0.249625 0.240465 0.373089
+0.249113 0.238888 0.374158
+
+
+0.249625 0.240465 0.373089
+0.301956 0.14706 0.37055
+0.301308 0.146784 0.371183
+
+
+0.249625 0.240465 0.373089
+0.252778 0.250599 0.366267
+
+
+0.293564 0.109473 0.389681
+0.293645 0.109259 0.38968
+
+
+0.293564 0.109473 0.389681
+0.301801 0.113681 0.382178
+0.300977 0.11462 0.382536
+0.300491 0.115305 0.382705
+0.303866 0.128301 0.375855
+
+
+0.293564 0.109473 0.389681
+0.292421 0.111285 0.390031
+0.28047 0.0950224 0.403371
+0.291132 0.113408 0.390392
+0.292332 0.111505 0.390035
+0.292421 0.111285 0.390031
+
+
+0.281908 0.128339 0.392788
+0.281975 0.128271 0.39276
+
+
+0.281908 0.128339 0.392788
+0.294576 0.133703 0.381259
+
+
+0.281908 0.128339 0.392788
+0.279234 0.130799 0.393968
+
+
+0.231462 0.274956 0.360971
+0.228439 0.276791 0.36111
+
+
+0.0824585 0.329433 0.369442
+0.0771637 0.331101 0.369499
+
+
+0.28941 0.261181 0.33169
+0.305371 0.14747 0.367585
+
+
+0.345481 0.262622 0.283283
+0.309016 0.146517 0.364894
+
+
+0.354337 0.30514 0.221751
+0.354487 0.310085 0.215209
+
+
+0.207614 0.454833 0.02901
+0.206901 0.455152 0.0294935
+
+
+0.181253 0.421235 0.214149
+0.219585 0.354976 0.275998
+0.191468 0.41566 0.2137
+
+
+0.154858 0.391085 0.275679
+0.148661 0.390259 0.279255
+
+
+-0.405418 0.0999328 0.292324
+-0.41111 0.0967404 0.286282
+
+
+-0.359799 -0.0878969 0.343431
+-0.310123 -0.0280028 0.391714
+-0.328343 0.0119323 0.377794
+-0.329596 0.00837827 0.376655
+
+
+-0.211604 -0.295382 0.368577
+-0.210365 -0.298578 0.367579
+
+
+-0.340656 -0.0252078 0.365689
+-0.310123 -0.0280028 0.391714
+-0.329959 0.00722485 0.376321
+
+
+-0.365541 -0.107248 0.336488
+-0.36383 -0.107961 0.337847
+
+
+0.167086 0.272912 0.386713
+0.145377 0.224646 0.422847
+0.159439 0.269303 0.391629
+0.154066 0.266786 0.39505
+
+
+-0.335051 -0.00789664 0.371483
+-0.310123 -0.0280028 0.391714
+-0.332695 -0.000837047 0.373765
+
+
+-0.339478 -0.0215082 0.36695
+-0.310123 -0.0280028 0.391714
+-0.333904 -0.00444603 0.372604
+
+
+-0.341118 -0.117625 0.355587
+-0.339673 -0.118214 0.356708
+
+
+-0.336161 -0.011262 0.370378
+-0.310123 -0.0280028 0.391714
+-0.337254 -0.0146086 0.36927
+
+
+-0.41976 -0.107203 0.278188
+-0.432303 -0.107152 0.264402
+-0.361072 0.00364482 0.34643
+-0.466804 -0.0838513 0.226641
+
+
+-0.41976 -0.107203 0.278188
+-0.327379 -0.209631 0.315085
+-0.373205 -0.107232 0.328432
+-0.380748 -0.107241 0.320421
+
+
+-0.41976 -0.107203 0.278188
+-0.419206 -0.107199 0.278798
+-0.361072 0.00364482 0.34643
+-0.446952 -0.105591 0.248254
+
+
+-0.479798 -0.227609 -0.0433176
+-0.479842 -0.22759 -0.0432333
+-0.483603 -0.219472 -0.040515
+
+
+-0.477939 -0.0715253 0.214355
+-0.488987 -0.0592274 0.202061
+
+
+-0.373813 -0.349668 0.010535
+-0.368408 -0.354831 0.0103695
+
+
+-0.317173 -0.370168 0.111525
+-0.316882 -0.370087 0.112575
+
+
+-0.284379 -0.336331 0.266426
+-0.279604 -0.339565 0.269021
+
+
+-0.316133 -0.370122 0.114486
+-0.31589 -0.370032 0.11542
+
+
+-0.314335 -0.370028 0.119533
+-0.314163 -0.369913 0.12033
+
+
+-0.537848 0.00225703 -0.0387191
+-0.538467 0.000272481 -0.0388582
+
+
+-0.415344 -0.00761826 -0.308266
+-0.413504 -0.0118493 -0.309696
+
+
+-0.514013 0.0776955 -0.0330378
+-0.514369 0.076589 -0.033114
+
+
+-0.312742 -0.369923 0.123925
+-0.312615 -0.369781 0.124665
+
+
+-0.364474 -0.358576 0.0101988
+-0.359244 -0.363532 0.0100394
+
+
+-0.311979 -0.369862 0.12601
+-0.31186 -0.369713 0.126741
+
+
+-0.319766 -0.37026 0.104048
+-0.319327 -0.37019 0.105506
+
+
+-0.351672 -0.370667 0.00975897
+-0.348395 -0.370594 0.0196481
+
+
+-0.152526 -0.450876 0.158376
+-0.155036 -0.4494 0.159487
+
+
+-0.17089 -0.439833 0.166931
+-0.172182 -0.439069 0.167479
+
+
+-0.327379 -0.209631 0.315085
+-0.389477 -0.107252 0.311078
+-0.398065 -0.107243 0.301823
+
+
+-0.327379 -0.209631 0.315085
+-0.408461 -0.107233 0.290536
+-0.419206 -0.107199 0.278798
+
+
+-0.327379 -0.209631 0.315085
+-0.443049 -0.112049 0.249358
+
+
+-0.327379 -0.209631 0.315085
+-0.431941 -0.133894 0.24759
+
+
+-0.327379 -0.209631 0.315085
+-0.415611 -0.165735 0.244942
+
+
+-0.327379 -0.209631 0.315085
+-0.409196 -0.178115 0.243879
+
+
+-0.327379 -0.209631 0.315085
+-0.398293 -0.198929 0.24203
+
+
+-0.327379 -0.209631 0.315085
+-0.393439 -0.208084 0.241187
+
+
+-0.327379 -0.209631 0.315085
+-0.388812 -0.216743 0.240371
+
+
+-0.327379 -0.209631 0.315085
+-0.38431 -0.225096 0.239564
+
+
+-0.327379 -0.209631 0.315085
+-0.370673 -0.249979 0.237045
+
+
+-0.327379 -0.209631 0.315085
+-0.36578 -0.258762 0.236114
+
+
+-0.327379 -0.209631 0.315085
+-0.360532 -0.268111 0.235103
+
+
+-0.327379 -0.209631 0.315085
+-0.348317 -0.289622 0.232706
+
+
+-0.327379 -0.209631 0.315085
+-0.322425 -0.310033 0.245684
+
+
+-0.327379 -0.209631 0.315085
+-0.312993 -0.316616 0.250887
+
+
+-0.327379 -0.209631 0.315085
+-0.279444 -0.339544 0.269203
+
+
+-0.327379 -0.209631 0.315085
+-0.269991 -0.338361 0.27985
+
+
+-0.327379 -0.209631 0.315085
+-0.260495 -0.337138 0.290481
+
+
+-0.327379 -0.209631 0.315085
+-0.250772 -0.335851 0.301298
+
+
+-0.237656 0.429391 -0.120887
+-0.238268 0.427606 -0.124845
+
+
+-0.403414 -0.0345969 -0.317477
+-0.401802 -0.0382485 -0.318691
+
+
+-0.349923 -0.150044 -0.355118
+-0.347509 -0.15513 -0.356693
+
+
+-0.370596 -0.106401 -0.341216
+-0.368844 -0.110179 -0.342412
+
+
+-0.484974 0.16501 -0.0263579
+-0.485224 0.164291 -0.0264074
+
+
+-0.403134 0.331641 0.0801896
+-0.405195 0.330251 0.073393
+
+
+-0.425376 0.312627 0.0104509
+-0.427412 0.309498 0.00626404
+
+
+-0.412001 0.269828 0.141714
+-0.409164 0.2813 0.135693
+
+
+-0.327719 0.330181 -0.191838
+-0.329058 0.328908 -0.192098
+
+
+-0.245093 0.405323 -0.173349
+-0.243213 0.404938 -0.176216
+
+
+-0.253995 0.423433 -0.100447
+-0.224704 0.446302 -0.0268837
+-0.197559 0.451548 -0.105047
+
+
+-0.403828 0.330642 0.00728321
+-0.382851 0.344563 -0.00727078
+
+
+-0.374611 0.231963 -0.269473
+-0.445457 0.167217 -0.154943
+-0.390104 0.281117 -0.174625
+
+
+-0.354553 -0.214676 -0.308891
+-0.355693 -0.215756 -0.306116
+
+
+-0.412812 0.0900808 -0.309364
+-0.414212 0.0873324 -0.308314
+
+
+-0.397809 0.11952 -0.320346
+-0.399273 0.116694 -0.319282
+
+
+-0.381443 0.151112 -0.331972
+-0.383095 0.147969 -0.330806
+
+
+-0.376208 0.165264 -0.331653
+-0.376171 0.167042 -0.330027
+
+
+-0.375304 0.208962 -0.291098
+-0.445457 0.167217 -0.154943
+-0.386035 0.280013 -0.187086
+
+
+-0.37562 0.196058 -0.303137
+-0.445457 0.167217 -0.154943
+-0.381667 0.278809 -0.200321
+
+
+-0.353367 0.16299 -0.353003
+-0.365235 0.161988 -0.343989
+
+
+-0.338695 0.164232 -0.364063
+-0.349769 0.163318 -0.355715
+
+
+-0.374224 0.242637 -0.259354
+-0.445457 0.167217 -0.154943
+-0.436913 0.041864 -0.290909
+
+
+-0.357562 -0.134024 -0.350052
+-0.355444 -0.138519 -0.351454
+
+
+-0.501649 0.00906981 -0.142345
+-0.502436 0.00866214 -0.14043
+
+
+-0.471943 0.0245524 -0.212621
+-0.445457 0.167217 -0.154943
+-0.452626 0.0342004 -0.256293
+
+
+-0.52101 0.0557965 -0.0346845
+-0.520598 0.0570927 -0.0345948
+
+
+-0.532217 -0.060946 0.0764563
+-0.464303 0.153517 0.106091
+-0.538303 -0.0643192 0.0529703
+
+
+-0.445457 0.167217 -0.154943
+-0.465836 0.0276346 -0.226585
+
+
+-0.445457 0.167217 -0.154943
+-0.477892 0.0215183 -0.198862
+
+
+-0.445457 0.167217 -0.154943
+-0.483799 0.0184742 -0.185045
+
+
+-0.445457 0.167217 -0.154943
+-0.489775 0.0153615 -0.170904
+
+
+-0.00698288 -0.531011 -0.0327056
+-0.00477167 -0.52904 -0.0493959
+
+
+-0.287148 -0.376048 -0.172121
+-0.283306 -0.376885 -0.175852
+
+
+-0.188643 -0.444009 -0.134092
+-0.188669 -0.443728 -0.134894
+
+
+-0.220214 -0.436574 -0.107652
+-0.188258 -0.456482 -0.0811385
+-0.216505 -0.437706 -0.110224
+
+
+-0.262058 -0.381254 -0.196287
+-0.257385 -0.382164 -0.200713
+
+
+-0.138295 -0.4691 -0.111357
+-0.188258 -0.456482 -0.0811385
+-0.21297 -0.438769 -0.112667
+
+
+-0.189687 -0.437491 -0.151671
+-0.189678 -0.437701 -0.151088
+
+
+-0.286341 -0.380491 -0.161636
+-0.286925 -0.377297 -0.169191
+
+
+-0.246695 -0.384157 -0.210788
+-0.241434 -0.385109 -0.215697
+
+
+-0.251988 -0.383181 -0.205816
+-0.247031 -0.3841 -0.210465
+
+
+-0.283636 -0.393752 -0.129478
+-0.283079 -0.396209 -0.123347
+
+
+-0.272104 -0.379237 -0.186682
+-0.267345 -0.380208 -0.191235
+
+
+-0.0949427 -0.488051 -0.0955208
+-0.188258 -0.456482 -0.0811385
+-0.202677 -0.441761 -0.119728
+
+
+0.0495056 -0.504996 -0.109735
+0.0595943 -0.50083 -0.116015
+
+
+-0.280317 -0.407371 -0.0948277
+-0.281111 -0.404293 -0.102795
+
+
+-0.181652 -0.389656 -0.277967
+-0.180359 -0.38934 -0.279855
+
+
+-0.192179 -0.416956 -0.202371
+-0.192211 -0.416373 -0.203785
+
+
+-0.188323 -0.445691 -0.129485
+-0.188324 -0.445685 -0.129503
+
+
+-0.171 -0.454125 -0.123221
+-0.188258 -0.456482 -0.0811385
+-0.199125 -0.442759 -0.122147
+
+
+-0.14446 -0.466349 -0.113602
+-0.188258 -0.456482 -0.0811385
+-0.187013 -0.446351 -0.128977
+
+
+-0.0719395 -0.497979 -0.0871025
+-0.188258 -0.456482 -0.0811385
+-0.17484 -0.45229 -0.124604
+
+
+0.0407489 -0.522419 0.121275
+0.0533307 -0.510686 0.133544
+
+
+0.165423 -0.475119 0.097277
+0.162327 -0.476343 0.0979574
+
+
+-0.188258 -0.456482 -0.0811385
+-0.167141 -0.455951 -0.121828
+
+
+-0.188258 -0.456482 -0.0811385
+-0.163186 -0.457803 -0.120398
+
+
+-0.188258 -0.456482 -0.0811385
+-0.159053 -0.459719 -0.118902
+
+
+-0.188258 -0.456482 -0.0811385
+-0.149833 -0.463929 -0.115556
+-0.146132 -0.465588 -0.11425
+
+
+-0.188258 -0.456482 -0.0811385
+-0.12205 -0.476262 -0.10543
+
+
+-0.188258 -0.456482 -0.0811385
+-0.110564 -0.481275 -0.101233
+
+
+0.157115 -0.383294 0.280028
+0.157324 -0.383392 0.279774
+
+
+0.0947794 -0.47199 0.173935
+0.0557459 -0.50845 0.135868
+
+
+0.0301842 -0.402357 0.311576
+0.0359921 -0.397149 0.316471
+
+
+-0.000756805 -0.495459 0.184899
+-0.00108767 -0.494712 0.186225
+
+
+-0.167353 -0.308682 0.377805
+-0.180138 -0.316371 0.369973
+
+
+-0.132042 -0.463083 0.148739
+-0.126714 -0.466211 0.146323
+
+
+0.142212 -0.427465 0.22011
+0.146797 -0.423099 0.224579
+
+
+0.154139 -0.416069 0.231696
+0.156895 -0.413395 0.23438
+
+
+0.165204 -0.390747 0.264668
+0.164995 -0.390638 0.264956
+
+
+0.164142 -0.406293 0.241381
+0.166171 -0.404265 0.243352
+
+
+0.166402 -0.391845 0.262312
+0.166183 -0.391717 0.262637
+
+
+0.170379 -0.400031 0.247397
+0.172378 -0.397988 0.249331
+
+
+0.168323 -0.402111 0.245416
+0.170293 -0.400112 0.247325
+
+
+-0.00886636 0.120604 -0.49332
+-0.00692602 0.120999 -0.49334
+
+
+0.0131462 -0.0399832 -0.499595
+0.00633268 -0.0361517 -0.499602
+
+
+0.182007 0.0621918 -0.461869
+0.197417 0.0278293 -0.458969
+0.203424 -0.0224412 -0.457227
+0.202589 -0.0227585 -0.457595
+
+
+0.134866 0.0531754 -0.481242
+0.138928 0.0540128 -0.479604
+0.182225 0.0994352 -0.45531
+0.125844 0.051508 -0.484844
+0.134866 0.0531754 -0.481242
+0.197417 0.0278293 -0.458969
+0.183195 -0.0294687 -0.465972
+0.182026 -0.029901 -0.466465
+
+
+0.109407 -0.0548341 -0.496333
+0.1039 -0.0567696 -0.498563
+0.223301 -0.0667773 -0.442807
+0.0972784 -0.158288 -0.485272
+0.0957225 -0.157286 -0.486164
+
+
+0.109407 -0.0548341 -0.496333
+0.197417 0.0278293 -0.458969
+0.168961 -0.034383 -0.471949
+0.167341 -0.0349717 -0.472621
+0.223301 -0.0667773 -0.442807
+0.0940972 -0.0835683 -0.499025
+0.0944763 -0.0824042 -0.499029
+-0.0112878 0.011464 -0.500142
+0.0990698 -0.0686248 -0.499019
+0.102907 -0.0571083 -0.498965
+0.102755 -0.0553069 -0.498965
+
+
+0.109407 -0.0548341 -0.496333
+0.128414 -0.0483582 -0.488607
+0.223301 -0.0667773 -0.442807
+0.0987188 -0.069707 -0.499019
+0.0990698 -0.0686248 -0.499019
+
+
+0.168961 -0.034383 -0.471949
+0.175289 -0.0322294 -0.469303
+
+
+0.212012 -0.0194358 -0.453389
+0.215459 -0.0182515 -0.451824
+
+
+0.238392 0.164958 -0.413875
+0.23907 0.166858 -0.412416
+
+
+0.365162 0.175191 -0.299157
+0.365537 0.168354 -0.302396
+
+
+0.368518 0.0901274 -0.338044
+0.368907 0.0750417 -0.344739
+
+
+0.2206 -0.016416 -0.449466
+0.224239 -0.0151583 -0.447777
+
+
+0.203424 -0.0224412 -0.457227
+0.206951 -0.0212347 -0.45566
+
+
+0.183195 -0.0294687 -0.465972
+0.187911 -0.027863 -0.463963
+
+
+0.306006 -0.102996 -0.390938
+0.305944 -0.103083 -0.390958
+
+
+0.120062 0.0503332 -0.48716
+0.125844 0.051508 -0.484844
+
+
+0.120062 0.0503332 -0.48716
+0.197417 0.0278293 -0.458969
+0.159634 -0.0375943 -0.475817
+0.157621 -0.0383197 -0.476646
+
+
+0.120062 0.0503332 -0.48716
+0.106624 0.0478272 -0.492501
+
+
+0.0658492 -0.347178 -0.357782
+0.0631018 -0.346911 -0.358396
+
+
+0.0888612 -0.13213 -0.493616
+0.0891898 -0.129091 -0.493977
+
+
+0.178449 0.0615149 -0.463391
+0.197417 0.0278293 -0.458969
+0.132053 -0.0470688 -0.487126
+0.128414 -0.0483582 -0.488607
+
+
+0.0585043 -0.0653238 -0.499328
+0.0383904 -0.0540586 -0.499479
+
+
+0.101989 -0.0452311 -0.49893
+0.197417 0.0278293 -0.458969
+0.100899 -0.03153 -0.498852
+
+
+0.00220354 0.122958 -0.493391
+0.00426029 0.123376 -0.493404
+
+
+-0.022475 -0.0200513 -0.499274
+-0.0250726 -0.0185715 -0.499198
+
+
+-0.00508967 -0.029787 -0.499559
+-0.00893402 -0.0276141 -0.499526
+
+
+0.0940972 -0.0835683 -0.499025
+0.0936371 -0.0849417 -0.499021
+0.0935124 -0.0861126 -0.498896
+
+
+0.0962887 0.0249112 -0.497923
+0.197417 0.0278293 -0.458969
+0.098957 -0.00744126 -0.498588
+
+
+0.113151 0.196574 -0.456504
+0.116345 0.195741 -0.455522
+
+
+0.153661 0.0567791 -0.473662
+0.197417 0.0278293 -0.458969
+0.0971707 0.0143165 -0.498183
+0.0968524 0.0178364 -0.498106
+
+
+0.174627 0.0607868 -0.465009
+0.197417 0.0278293 -0.458969
+0.0953915 0.0355905 -0.49762
+
+
+0.083446 0.0694554 -0.496509
+0.0828886 0.070688 -0.496459
+
+
+0.20206 0.0659908 -0.452964
+0.199733 0.0655999 -0.454019
+
+
+0.197417 0.0278293 -0.458969
+0.145508 0.0552167 -0.476963
+0.148566 0.0558569 -0.47572
+
+
+0.197417 0.0278293 -0.458969
+0.160216 0.0580341 -0.470987
+
+
+0.197417 0.0278293 -0.458969
+0.170427 0.0599856 -0.466769
+
+
+0.197417 0.0278293 -0.458969
+0.188668 0.0634567 -0.458975
+
+
+-0.261595 0.422256 -0.0712318
+-0.258467 0.424839 -0.0616085
+
+
+-0.251595 0.430455 -0.040007
+-0.250539 0.431279 -0.0369174
+
+
+-0.188042 0.466935 0.129882
+-0.191415 0.465253 0.128645
+
+
+0.000239549 0.500349 -0.0066201
+0.0272388 0.499148 0.0225842
+0.0160244 0.499925 -0.0203082
+
+
+-0.132225 0.486735 -0.0513512
+-0.133934 0.485834 -0.0531457
+
+
+-0.226183 0.436247 -0.115288
+-0.224704 0.446302 -0.0268837
+-0.234364 0.431774 -0.118208
+
+
+-0.163597 0.469645 -0.0850093
+-0.164817 0.468964 -0.0862908
+
+
+0.131002 0.484472 -0.0458646
+0.131037 0.484477 -0.0455483
+
+
+0.126827 0.483406 -0.0892516
+0.125833 0.483516 -0.0900448
+
+
+0.0371197 0.495626 -0.0761288
+0.039913 0.494922 -0.0838472
+
+
+0.100428 0.48609 -0.110309
+0.107646 0.485393 -0.104588
+
+
+-0.037781 0.499916 0.026375
+-0.0347448 0.499996 0.023668
+
+
+0.0260111 0.498199 -0.0460392
+0.0273227 0.497909 -0.0497127
+
+
+-0.00658721 0.487814 -0.136168
+-0.104262 0.466121 -0.149203
+-0.0763225 0.489192 -0.0870071
+-0.0716131 0.489213 -0.0903337
+-0.0248719 0.498374 -0.0374832
+-0.0544756 0.48912 -0.102485
+-0.0533848 0.489101 -0.103281
+-0.0484711 0.489031 -0.106726
+
+
+0.0416749 0.484971 -0.172334
+0.0402966 0.480441 -0.185427
+
+
+0.0116178 0.458252 -0.235369
+0.00526384 0.454657 -0.24224
+
+
+-0.130411 0.451192 -0.17247
+-0.104262 0.466121 -0.149203
+-0.0705567 0.48921 -0.0911094
+-0.0659325 0.489209 -0.0943693
+-0.0248719 0.498374 -0.0374832
+-0.0602566 0.489178 -0.0983937
+-0.0591981 0.489165 -0.0991679
+-0.0544756 0.48912 -0.102485
+
+
+-0.152007 0.457564 -0.13583
+-0.151101 0.457292 -0.13747
+
+
+-0.315506 0.341853 -0.189214
+-0.316528 0.340895 -0.18941
+
+
+-0.32236 0.335333 -0.190665
+-0.321207 0.336423 -0.190442
+
+
+-0.217143 0.399158 -0.215386
+-0.217316 0.399204 -0.215121
+
+
+-0.297725 0.358538 -0.185311
+-0.296929 0.359263 -0.185158
+
+
+-0.229237 0.401934 -0.197367
+-0.229418 0.401978 -0.197087
+
+
+-0.19266 0.393519 -0.250027
+-0.194397 0.393693 -0.248135
+
+
+-0.238045 0.403847 -0.184078
+-0.23825 0.403895 -0.183758
+
+
+-0.279821 0.374823 -0.181335
+-0.280674 0.374068 -0.181505
+
+
+-0.160271 0.459748 -0.121563
+-0.158866 0.459352 -0.124081
+
+
+-0.104121 0.441877 -0.215574
+-0.104262 0.466121 -0.149203
+-0.0648851 0.489201 -0.095137
+-0.0602566 0.489178 -0.0983937
+
+
+-0.255123 0.427605 -0.0509803
+-0.253514 0.428901 -0.0461333
+
+
+-0.104262 0.466121 -0.149203
+-0.0591981 0.489165 -0.0991679
+
+
+-0.104262 0.466121 -0.149203
+-0.0533848 0.489101 -0.103281
+
+
+-0.104262 0.466121 -0.149203
+-0.0408752 0.488877 -0.112106
+-0.0352136 0.488746 -0.116064
+
+
+-0.104262 0.466121 -0.149203
+-0.0338613 0.488705 -0.117041
+
+
+-0.104262 0.466121 -0.149203
+-0.0260499 0.488483 -0.122528
+
+
+-0.104262 0.466121 -0.149203
+-0.017117 0.488193 -0.128793
+
+
+-0.104262 0.466121 -0.149203
+0.00627778 0.487309 -0.145165
+
+
+-0.104262 0.466121 -0.149203
+-0.0626868 0.426436 -0.282755
+
+
+-0.104262 0.466121 -0.149203
+-0.0837549 0.434321 -0.248628
+
+
+-0.104262 0.466121 -0.149203
+-0.110001 0.444031 -0.206002
+
+
+-0.104262 0.466121 -0.149203
+-0.118182 0.446982 -0.19264
+
+
+-0.104262 0.466121 -0.149203
+-0.121246 0.448066 -0.187616
+
+
+-0.104262 0.466121 -0.149203
+-0.126256 0.4498 -0.179362
+-0.127836 0.450307 -0.176822
+
+
+-0.104262 0.466121 -0.149203
+-0.132319 0.451814 -0.169288
+
+
+-0.104262 0.466121 -0.149203
+-0.134173 0.452406 -0.166187
+
+
+-0.104262 0.466121 -0.149203
+-0.137861 0.453549 -0.159982
+
+
+-0.104262 0.466121 -0.149203
+-0.139768 0.454121 -0.156757
+
+
+-0.104262 0.466121 -0.149203
+-0.141771 0.45471 -0.153357
+
+
+-0.238712 0.333171 0.294397
+-0.237841 0.334502 0.293381
+
+
+-0.143353 0.472368 0.175667
+-0.14206 0.481654 0.160911
+
+
+-0.371289 0.301989 0.176585
+-0.37015 0.301716 0.178607
+
+
+-0.358385 0.298656 0.199637
+-0.357491 0.298439 0.201202
+
+
+-0.413527 0.324544 0.0452798
+-0.415522 0.323131 0.0385427
+
+
+-0.308899 0.173815 0.373062
+-0.312108 0.164512 0.375682
+
+
+-0.032421 0.0771216 0.499737
+-0.0370331 0.0997637 0.499413
+
+
+-0.037149 0.146881 0.497675
+-0.037159 0.152668 0.495238
+
+
+-0.23895 0.273626 0.35908
+-0.244163 0.272942 0.357055
+
+
+-0.193844 0.279098 0.376462
+-0.197504 0.278647 0.375094
+
+
+-0.304389 0.186715 0.369415
+-0.307444 0.177932 0.371919
+
+
+-0.283574 0.103068 0.415176
+-0.281054 0.101256 0.41708
+
+
+-0.0923723 -0.10978 0.484987
+-0.0923611 -0.109786 0.484988
+
+
+-0.413387 0.0954925 0.283844
+-0.41947 0.0920593 0.277337
+
+
+-0.312973 0.0557996 0.39117
+-0.311444 0.0602491 0.39247
+
+
+-0.360105 0.124566 0.339171
+-0.365915 0.121441 0.3333
+
+
+-0.318322 0.146499 0.380651
+-0.317093 0.15004 0.379691
+
+
+-0.351407 -0.060063 0.353431
+-0.310123 -0.0280028 0.391714
+-0.338353 -0.0180011 0.368135
+
+
+-0.343289 -0.0335909 0.362794
+-0.310123 -0.0280028 0.391714
+-0.341913 -0.0291946 0.364318
+
+
+-0.351527 0.129118 0.347792
+-0.357774 0.125782 0.341529
+
+
+-0.365631 -0.107209 0.336417
+-0.365147 -0.105557 0.337004
+
+
+-0.354895 -0.0715982 0.349298
+-0.310123 -0.0280028 0.391714
+-0.344833 -0.0385637 0.361055
+
+
+-0.39044 0.108192 0.308071
+-0.395744 0.105258 0.302532
+
+
+-0.516073 -0.147454 -0.0163246
+-0.509792 -0.161647 -0.0210613
+
+
+-0.50824 0.0955571 -0.0316833
+-0.508557 0.0945845 -0.03175
+
+
+-0.453631 0.072685 0.240172
+-0.450419 0.0744977 0.243708
+
+
+-0.548502 -0.0628234 0.00278
+-0.54934 -0.0705655 0.00944699
+-0.544866 -0.0680019 0.0272331
+
+
+-0.365624 -0.225459 -0.28146
+-0.366554 -0.226343 -0.279154
+
+
+-0.375005 -0.234648 -0.257744
+-0.375832 -0.235437 -0.255653
+
+
+-0.383632 -0.243153 -0.235457
+-0.384426 -0.243914 -0.233405
+
+
+-0.33081 -0.191696 -0.366398
+-0.332707 -0.193493 -0.361881
+
+
+-0.364376 -0.119636 -0.345467
+-0.362471 -0.12371 -0.346747
+
+
+-0.376398 -0.093961 -0.337188
+-0.374752 -0.0975395 -0.338329
+
+
+-0.38728 -0.0703477 -0.329446
+-0.385739 -0.0737541 -0.33055
+
+
+-0.409174 -0.0216262 -0.313066
+-0.40747 -0.0255146 -0.314369
+
+
+-0.42211 0.00786067 -0.302924
+-0.420075 0.00314702 -0.304531
+
+
+0.159634 -0.0375943 -0.475817
+0.167341 -0.0349717 -0.472621
+
+
+0.229891 -0.0131329 -0.44513
+0.234063 -0.0116812 -0.443155
+
+
+0.132053 -0.0470688 -0.487126
+0.145202 -0.0425911 -0.481751
+
+
+0.214469 -0.22861 -0.415437
+0.211571 -0.232498 -0.416131
+0.200519 -0.225357 -0.423095
+
+
+0.0987188 -0.069707 -0.499019
+0.0944763 -0.0824042 -0.499029
+
+
+0.0971707 0.0143165 -0.498183
+0.0977335 0.00718531 -0.49834
+
+
+0.1039 -0.0567696 -0.498563
+0.102907 -0.0571083 -0.498965
+
+
+0.353326 0.240459 0.28596
+0.352364 0.244164 0.28522
+
+
+-0.0258393 0.334152 0.390557
+-0.0279594 0.333318 0.391621
+
+
+0.294753 0.107499 0.38933
+0.302631 0.112857 0.381776
+
+
+0.275601 0.13418 0.395538
+0.275901 0.133881 0.395415
+
+
+0.275601 0.13418 0.395538
+0.294937 0.137056 0.379805
+
+
+0.275601 0.13418 0.395538
+0.271947 0.137523 0.397115
+0.28047 0.0950224 0.403371
+0.289746 0.11568 0.390771
+0.291033 0.113637 0.3904
+0.291132 0.113408 0.390392
+
+
+0.299567 0.0993803 0.387825
+0.305799 0.11042 0.379992
+
+
+0.341631 0.054601 0.361016
+0.34196 0.0549358 0.360652
+
+
+0.363047 0.0733463 0.336423
+0.362908 0.0739342 0.336436
+
+
+0.351064 0.126512 0.334933
+0.351908 0.122925 0.335086
+
+
+0.351064 0.126512 0.334933
+0.351068 0.126591 0.334903
+0.321114 0.120232 0.363937
+0.320839 0.118702 0.364692
+
+
+0.351064 0.126512 0.334933
+0.347395 0.12273 0.339487
+
+
+0.329197 0.12787 0.354087
+0.328789 0.127928 0.354432
+
+
+0.329197 0.12787 0.354087
+0.321355 0.123785 0.362512
+0.321242 0.123362 0.362757
+0.316703 0.128141 0.365102
+
+
+0.329197 0.12787 0.354087
+0.33665 0.127746 0.347454
+0.319351 0.134101 0.360616
+
+
+0.337353 0.127688 0.346843
+0.33665 0.127746 0.347454
+
+
+0.337353 0.127688 0.346843
+0.321314 0.121931 0.363184
+0.321107 0.120867 0.363729
+0.315189 0.128173 0.366418
+
+
+0.337353 0.127688 0.346843
+0.351121 0.127413 0.334578
+0.351068 0.126591 0.334903
+
+
+0.359666 0.172104 0.309169
+0.36155 0.182483 0.303206
+
+
+0.356171 0.153371 0.319913
+0.357436 0.160208 0.316025
+
+
+0.353803 0.114982 0.335366
+0.353559 0.115937 0.335352
+
+
+0.35993 0.088048 0.336181
+0.359791 0.0886025 0.336189
+
+
+0.292332 0.111505 0.390035
+0.300977 0.11462 0.382536
+
+
+0.321551 0.0407658 0.381481
+0.322669 0.0415976 0.380355
+
+
+0.271583 0.13788 0.397263
+0.271947 0.137523 0.397115
+
+
+0.271583 0.13788 0.397263
+0.295242 0.138495 0.379057
+
+
+0.271583 0.13788 0.397263
+0.267083 0.141989 0.399186
+
+
+0.362258 0.0771467 0.336376
+0.362122 0.0777092 0.336387
+
+
+0.334448 0.0496244 0.368473
+0.334934 0.0500364 0.367965
+
+
+0.308194 0.0844735 0.384845
+0.309526 0.109017 0.377392
+
+
+0.289632 0.115924 0.390784
+0.289746 0.11568 0.390771
+
+
+0.289632 0.115924 0.390784
+0.299329 0.116852 0.38313
+0.298875 0.117691 0.383221
+0.302755 0.128302 0.376735
+
+
+0.289632 0.115924 0.390784
+0.288221 0.118166 0.391178
+
+
+0.240011 -0.0468485 0.45714
+0.241034 -0.0467801 0.456443
+
+
+0.307086 0.0716837 0.388456
+0.307228 0.073667 0.387935
+
+
+0.310806 0.0869342 0.382078
+0.310239 0.108898 0.376842
+
+
+0.314893 0.0908444 0.377689
+0.311632 0.108885 0.375696
+0.311512 0.108892 0.375793
+0.30832 0.128276 0.372248
+
+
+0.318114 0.0939479 0.374174
+0.312998 0.109046 0.374507
+0.312322 0.108925 0.375109
+0.311632 0.108885 0.375696
+
+
+0.324849 0.100488 0.366599
+0.316241 0.110571 0.371298
+
+
+0.319544 0.0953324 0.372593
+0.313656 0.109248 0.373895
+0.312998 0.109046 0.374507
+
+
+0.332089 0.047999 0.370878
+0.332657 0.0484618 0.370291
+
+
+0.343148 0.0556609 0.359406
+0.343464 0.0559919 0.359052
+
+
+0.346099 0.0577375 0.356235
+0.346414 0.0580684 0.355876
+
+
+0.340816 0.116261 0.347527
+0.320514 0.117324 0.365434
+0.320075 0.116091 0.366225
+0.319988 0.115929 0.366354
+0.312786 0.128217 0.368489
+
+
+0.359116 0.0917544 0.336095
+0.358971 0.0923283 0.336101
+
+
+0.327634 0.103205 0.363369
+0.317442 0.111687 0.369922
+0.316863 0.111076 0.370609
+
+
+0.305932 0.0884111 0.385651
+0.308804 0.109178 0.377934
+0.308068 0.109381 0.378472
+0.307326 0.109671 0.378987
+
+
+0.32353 0.099205 0.368108
+0.315604 0.110147 0.371973
+0.314977 0.109761 0.372623
+
+
+0.360715 0.0844252 0.336256
+0.360579 0.0849716 0.336265
+
+
+0.358255 0.0956222 0.335995
+0.358101 0.0962283 0.335998
+
+
+0.3563 0.104232 0.335738
+0.356116 0.104954 0.335735
+
+
+0.353568 0.139761 0.327639
+0.354547 0.144935 0.324731
+
+
+0.357709 0.223181 0.289487
+0.35692 0.226244 0.288883
+
+
+0.312306 0.14435 0.362921
+0.310908 0.128254 0.370084
+
+
+0.314336 0.142372 0.361922
+0.311839 0.128241 0.369294
+
+
+0.357761 0.161841 0.315067
+0.359272 0.170093 0.31035
+
+
+0.352445 0.134005 0.330878
+0.353342 0.138691 0.328262
+
+
+0.351391 0.128681 0.333856
+0.352234 0.133025 0.331446
+
+
+0.230535 0.180555 0.412432
+0.297637 0.143706 0.375282
+
+
+0.351121 0.127413 0.334578
+0.35119 0.127763 0.334385
+
+
+0.317615 0.137664 0.360831
+0.313981 0.12821 0.367458
+
+
+-0.150177 0.485585 0.14395
+-0.14674 0.48726 0.145226
+
+
+0.133954 0.484804 -0.0139708
+0.133926 0.484805 -0.0142384
+
+
+-0.155687 0.458546 -0.129485
+-0.154582 0.458224 -0.131476
+
+
+-0.288539 0.366951 -0.183294
+-0.289333 0.36624 -0.183449
+
+
+-0.250313 0.431469 -0.0360422
+-0.249403 0.432165 -0.0334283
+
+
+-0.249218 0.43232 -0.0326693
+-0.248408 0.432928 -0.0303902
+
+
+-0.148933 0.456729 -0.141116
+-0.148163 0.456491 -0.142516
+
+
+-0.166272 0.461299 -0.111167
+-0.164387 0.460783 -0.11453
+
+
+-0.276021 0.37823 -0.180451
+-0.275109 0.379032 -0.180267
+
+
+-0.34996 0.366244 -0.0299391
+-0.340966 0.37211 -0.0361422
+
+
+-0.262686 0.42133 -0.0748528
+-0.266356 0.41827 -0.086238
+
+
+0.320903 0.0966522 0.371076
+0.314324 0.109466 0.373266
+
+
+0.316579 0.0924658 0.375857
+0.312322 0.108925 0.375109
+
+
+0.336507 0.0510461 0.366358
+0.336933 0.0514242 0.365907
+
+
+0.286346 0.121255 0.391652
+0.286501 0.120954 0.391626
+
+
+0.286346 0.121255 0.391652
+0.297749 0.119625 0.383483
+
+
+0.286346 0.121255 0.391652
+0.284509 0.12417 0.392135
+
+
+0.291033 0.113637 0.3904
+0.300162 0.115675 0.382848
+0.299329 0.116852 0.38313
+
+
+0.307127 0.0309018 0.395821
+0.309471 0.0325777 0.393488
+
+
+0.329305 0.046084 0.373699
+0.329989 0.0466224 0.372998
+
+
+0.338352 0.0523229 0.364449
+0.338735 0.0526789 0.364038
+
+
+0.337543 0.112998 0.351517
+0.320075 0.116091 0.366225
+
+
+0.315679 0.0367474 0.387333
+0.317232 0.0378776 0.385779
+
+
+0.253594 -0.0460484 0.447839
+0.25453 -0.0459848 0.447195
+
+
+-0.101604 -0.395339 0.309488
+-0.0213985 -0.321575 0.382795
+-0.0813838 -0.408651 0.299256
+
+
+-0.195622 -0.424383 0.178308
+-0.194852 -0.424859 0.178011
+
+
+0.0867314 -0.350855 0.358249
+0.0923811 -0.345552 0.362853
+
+
+0.0725091 -0.364039 0.346664
+0.0775637 -0.359345 0.35082
+
+
+0.0590704 -0.376353 0.335623
+0.0639673 -0.371858 0.339684
+
+
+0.0453484 -0.388781 0.324249
+0.0504715 -0.384133 0.328535
+
+
+0.0118917 -0.418558 0.296169
+0.0191042 -0.412162 0.302288
+
+
+-0.27136 -0.363494 0.230152
+-0.271377 -0.363497 0.23011
+
+
+-0.20671 -0.417056 0.183372
+-0.205752 -0.417675 0.182989
+
+
+-0.167233 -0.35086 0.341988
+-0.179872 -0.342124 0.348131
+
+
+-0.190602 -0.427616 0.176003
+-0.189827 -0.428087 0.175702
+
+
+-0.200835 -0.420968 0.180693
+-0.200011 -0.421488 0.180372
+
+
+-0.179477 -0.434597 0.170865
+-0.178485 -0.435187 0.170459
+
+
+-0.0325985 -0.440091 0.274194
+-0.0213985 -0.321575 0.382795
+-0.0591794 -0.423065 0.287907
+
+
+-0.204937 -0.329381 0.351525
+-0.210929 -0.330286 0.344987
+
+
+-0.198178 -0.422715 0.179479
+-0.197389 -0.423208 0.179174
+
+
+-0.193113 -0.426006 0.177157
+-0.192347 -0.426475 0.176862
+
+
+-0.075606 0.393575 -0.345446
+-0.0782534 0.390531 -0.35001
+
+
+-0.126256 0.4498 -0.179362
+-0.125633 0.449559 -0.180467
+
+
+-0.204608 0.396102 -0.233769
+-0.204408 0.396047 -0.234068
+
+
+-0.221138 0.400095 -0.209463
+-0.221311 0.40014 -0.209199
+
+
+-0.213079 0.398186 -0.221379
+-0.213257 0.398233 -0.221108
+
+
+0.301956 0.14706 0.37055
+0.302626 0.147251 0.369931
+
+
+0.347634 0.262673 0.281388
+0.349313 0.265552 0.276389
+
+
+0.300939 0.146569 0.371563
+0.306714 0.128296 0.373562
+
+
+0.300665 0.146453 0.371829
+0.243362 0.220582 0.386371
+
+
+0.299076 0.145266 0.373555
+0.305846 0.128301 0.374266
+
+
+0.298797 0.145051 0.373858
+0.235496 0.195912 0.402554
+0.235126 0.194809 0.403278
+
+
+0.298188 0.144436 0.374572
+0.23302 0.18823 0.407516
+
+
+0.297066 0.142903 0.376029
+0.238301 0.168288 0.411224
+
+
+0.260213 0.148302 0.402078
+0.296069 0.140947 0.377528
+
+
+0.295623 0.139789 0.378296
+0.266624 0.142433 0.399373
+
+
+0.146895 0.307681 0.3679
+0.142508 0.309206 0.368103
+
+
+0.307442 0.0754936 0.387385
+0.307566 0.0773373 0.386898
+
+
+0.313656 0.109248 0.373895
+0.313747 0.109289 0.373807
+
+
+0.317442 0.111687 0.369922
+0.317511 0.111782 0.369833
+
+
+0.319645 0.114979 0.366962
+0.319988 0.115929 0.366354
+
+
+0.321114 0.120232 0.363937
+0.321107 0.120867 0.363729
+
+
+0.321355 0.123785 0.362512
+0.321191 0.125749 0.361975
+
+
+0.321314 0.121931 0.363184
+0.321242 0.123362 0.362757
+
+
+0.320514 0.117324 0.365434
+0.320709 0.118352 0.364924
+
+
+0.318603 0.113122 0.368465
+0.318919 0.113712 0.368003
+
+
+0.315604 0.110147 0.371973
+0.315769 0.11028 0.371792
+
+
+0.308371 0.128282 0.372204
+0.305355 0.147469 0.367599
+
+
+0.310941 0.108858 0.376275
+0.311512 0.108892 0.375793
+
+
+0.306576 0.110027 0.379487
+0.306786 0.109945 0.379341
+
+
+0.305024 0.110911 0.380465
+0.298307 0.101524 0.388233
+
+
+0.300491 0.115305 0.382705
+0.300162 0.115675 0.382848
+
+
+0.298875 0.117691 0.383221
+0.298531 0.118167 0.383339
+
+
+0.297548 0.120195 0.383457
+0.296968 0.121247 0.383569
+
+
+0.296495 0.122702 0.383465
+0.296304 0.123013 0.383511
+
+
+0.295731 0.125194 0.383241
+0.295066 0.127115 0.383118
+
+
+0.308804 0.109178 0.377934
+0.309157 0.109119 0.377664
+
+
+0.30755 0.128289 0.37288
+0.30306 0.14732 0.36955
+
+
+0.308068 0.109381 0.378472
+0.304033 0.0917047 0.386317
+
+
+0.304241 0.11148 0.380918
+0.304498 0.111318 0.380762
+
+
+0.301801 0.113681 0.382178
+0.302379 0.113143 0.381888
+
+
+0.321008 0.127999 0.361346
+0.324004 0.128072 0.358654
+
+
+0.279726 0.260855 0.339875
+0.304668 0.14752 0.368147
+
+
+0.19612 0.137235 0.446924
+0.1858 0.14848 0.445204
+
+
+0.306076 0.147417 0.367018
+0.299289 0.261487 0.323282
+
+
+-0.326748 -0.370419 0.0835753
+-0.325671 -0.370346 0.0869302
+
+
+-0.339007 -0.370585 0.0472502
+-0.335962 -0.370482 0.0565211
+
+
+-0.315197 -0.370075 0.117124
+-0.314993 -0.369974 0.117977
+
+
+-0.313522 -0.369978 0.121782
+-0.313377 -0.369848 0.122543
+
+
+-0.323709 -0.370361 0.0925257
+-0.322954 -0.370292 0.0949148
+
+
+-0.394133 -0.33006 0.0112669
+-0.387994 -0.336015 0.0110763
+
+
+-0.218531 -0.40904 0.188735
+-0.217073 -0.410013 0.188129
+
+
+-0.343475 -0.295162 0.233897
+-0.34632 -0.293116 0.232299
+
+
+-0.520861 -0.054767 0.119227
+-0.524709 -0.0568693 0.104885
+
+
+-0.515346 -0.0518225 0.139483
+-0.519156 -0.0538786 0.125516
+
+
+-0.397797 -0.306948 0.0695218
+-0.32754 -0.35453 0.132009
+-0.383077 -0.303528 0.119613
+-0.384984 -0.303974 0.11332
+-0.413046 -0.239792 0.149308
+-0.387488 -0.304572 0.104918
+-0.387977 -0.304709 0.103221
+-0.39025 -0.305219 0.0955559
+
+
+-0.385431 -0.304102 0.111781
+-0.387488 -0.304572 0.104918
+
+
+-0.385431 -0.304102 0.111781
+-0.32754 -0.35453 0.132009
+-0.387977 -0.304709 0.103221
+
+
+-0.385431 -0.304102 0.111781
+-0.384984 -0.303974 0.11332
+
+
+-0.376585 -0.301877 0.140751
+-0.376196 -0.301755 0.142039
+
+
+-0.525028 -0.127029 -0.00947872
+-0.518342 -0.142305 -0.0145735
+
+
+-0.410992 -0.313589 0.0119082
+-0.414182 -0.310452 0.0120094
+
+
+-0.32754 -0.35453 0.132009
+-0.394014 -0.306102 0.0826089
+-0.397039 -0.306756 0.072209
+
+
+-0.32754 -0.35453 0.132009
+-0.408332 -0.309239 0.0326134
+
+
+0.221099 0.281309 0.361374
+0.218292 0.283002 0.361494
+
+
+0.352839 0.271498 0.265927
+0.352927 0.27333 0.263561
+
+
+0.222224 0.448099 0.0196534
+0.221659 0.448364 0.0200461
+
+
+0.167515 0.41683 0.231169
+0.165764 0.413209 0.23754
+
+
+0.162787 0.40724 0.248016
+0.161371 0.404298 0.253109
+
+
+0.0715005 0.435195 0.236673
+0.071963 0.435223 0.236483
+
+
+0.27329 0.395292 0.138675
+0.272517 0.396025 0.138015
+0.270583 0.39797 0.13601
+
+
+0.249391 0.424605 0.0878438
+0.249279 0.424652 0.0879424
+
+
+0.354648 0.314359 0.209475
+0.354724 0.317291 0.205572
+
+
+0.353992 0.296076 0.233746
+0.354161 0.300959 0.227325
+
+
+0.353169 0.277717 0.257819
+0.353389 0.282758 0.25127
+
+
+0.235496 0.195912 0.402554
+0.23763 0.202617 0.398202
+
+
+0.30005 0.399978 0.0473486
+0.311463 0.394138 0.038088
+0.270737 0.406813 0.107727
+0.330196 0.384513 0.0228427
+0.331284 0.383955 0.021937
+0.36528 0.366419 -0.00574485
+
+
+0.30005 0.399978 0.0473486
+0.242498 0.434148 0.0557766
+0.272601 0.413777 0.0695309
+0.275984 0.412109 0.0668267
+0.270737 0.406813 0.107727
+0.29962 0.400195 0.0477118
+0.30005 0.399978 0.0473486
+
+
+0.255417 0.379437 0.210331
+0.256036 0.379077 0.210282
+
+
+0.218832 0.449691 0.0218342
+0.218251 0.44996 0.0222358
+
+
+0.288428 0.359696 0.208148
+0.289359 0.359138 0.208072
+
+
+0.299705 0.352843 0.207356
+0.300812 0.352175 0.207265
+
+
+0.172157 0.426174 0.214525
+0.171393 0.424602 0.21733
+
+
+0.14278 0.479026 0.0979524
+0.0451587 0.471195 0.162285
+0.147381 0.47525 0.10779
+
+
+-0.190284 -0.433334 -0.162432
+-0.190278 -0.433547 -0.161864
+-0.190091 -0.43473 -0.158858
+
+
+-0.191071 -0.427229 -0.177644
+-0.190869 -0.42874 -0.173953
+
+
+-0.191071 -0.427229 -0.177644
+-0.225451 -0.420597 -0.150567
+-0.191836 -0.42027 -0.194472
+
+
+-0.191071 -0.427229 -0.177644
+-0.191081 -0.426944 -0.17837
+
+
+-0.278294 -0.414893 -0.0751256
+-0.279379 -0.410902 -0.0856213
+
+
+-0.28112 -0.404261 -0.102875
+-0.281825 -0.401446 -0.110097
+
+
+-0.201181 -0.391837 -0.252787
+-0.211423 -0.390183 -0.243424
+
+
+-0.190861 -0.428996 -0.173292
+-0.225451 -0.420597 -0.150567
+-0.190469 -0.432114 -0.1655
+
+
+-0.188947 -0.442239 -0.13893
+-0.188966 -0.441987 -0.139645
+
+
+-0.045436 -0.472493 -0.182319
+-0.0437121 -0.474312 -0.178812
+
+
+-0.0805285 -0.434616 -0.252121
+-0.0788081 -0.43657 -0.248645
+
+
+-0.22048 -0.388696 -0.235106
+-0.212036 -0.390089 -0.242853
+
+
+-0.12784 -0.396091 -0.307774
+-0.132868 -0.392396 -0.312496
+
+
+-0.0713231 -0.444828 -0.233858
+-0.0697954 -0.446535 -0.230761
+
+
+-0.0544629 -0.463023 -0.200321
+-0.0529333 -0.46467 -0.19721
+
+
+-0.189214 -0.440629 -0.143286
+-0.18923 -0.440397 -0.14394
+
+
+-0.189456 -0.43913 -0.147303
+-0.189468 -0.438911 -0.147914
+
+
+-0.225451 -0.420597 -0.150567
+-0.190278 -0.433547 -0.161864
+
+
+-0.225451 -0.420597 -0.150567
+-0.190085 -0.434937 -0.158296
+
+
+-0.164799 -0.0830814 -0.477172
+-0.168018 -0.0872427 -0.476323
+
+
+-0.171248 0.167768 -0.451294
+-0.165646 0.164558 -0.453632
+
+
+-0.130508 0.144682 -0.467918
+-0.126626 0.142442 -0.46947
+
+
+-0.113935 0.13526 -0.47444
+-0.11026 0.133133 -0.475873
+
+
+-0.0869743 0.0218015 -0.495137
+-0.0881166 0.0170353 -0.495192
+
+
+-0.129959 -0.0374605 -0.486085
+-0.131446 -0.0393583 -0.485722
+
+
+-0.105007 -0.00495554 -0.491818
+-0.106069 -0.00629657 -0.491591
+
+
+-0.0961837 0.00648363 -0.493636
+-0.0972532 0.00513734 -0.493422
+
+
+-0.0894462 0.121296 -0.483772
+-0.0855334 0.119025 -0.48524
+
+
+-0.172774 0.258169 -0.408373
+-0.176151 0.253688 -0.410018
+
+
+-0.0669067 0.108366 -0.492075
+-0.0665238 0.10815 -0.492213
+
+
+-0.0399389 0.113937 -0.492881
+-0.0381047 0.114316 -0.492921
+
+
+-0.0297245 0.116139 -0.493066
+-0.0278911 0.116515 -0.493099
+
+
+-0.251027 0.325033 -0.285379
+-0.251734 0.324657 -0.285181
+
+
+-0.133806 0.309614 -0.388625
+-0.137472 0.304867 -0.39049
+
+
+-0.149954 0.288451 -0.396911
+-0.153303 0.284074 -0.398585
+
+
+-0.197612 0.22471 -0.420523
+-0.201684 0.219226 -0.422458
+
+
+-0.24294 0.1823 -0.424344
+-0.252362 0.177217 -0.421625
+
+
+-0.297856 0.16754 -0.394367
+-0.308018 0.166758 -0.386887
+
+
+0.0392601 0.46276 0.185309
+0.0370316 0.462739 0.185857
+
+
+0.0392601 0.46276 0.185309
+0.0566727 0.45453 0.201473
+0.0714283 0.462708 0.175826
+
+
+0.0392601 0.46276 0.185309
+0.0398331 0.462809 0.185056
+
+
+0.0363802 0.46269 0.186119
+0.0566727 0.45453 0.201473
+0.0677483 0.462784 0.176944
+
+
+0.0244192 0.462321 0.189467
+0.0566727 0.45453 0.201473
+0.0646022 0.462838 0.177897
+
+
+0.0330824 0.4626 0.187045
+0.0566727 0.45453 0.201473
+0.0593304 0.462901 0.179491
+
+
+0.0506551 0.462912 0.182076
+0.0566727 0.45453 0.201473
+0.0570177 0.462915 0.180189
+0.0552714 0.462977 0.180567
+
+
+0.057486 0.462962 0.179922
+0.0570177 0.462915 0.180189
+
+
+0.0468231 0.497663 0.0120008
+0.0457279 0.497784 0.011166
+
+
+0.0396395 0.498415 0.00408717
+0.0385351 0.49851 0.00320438
+
+
+0.252686 0.414798 0.118741
+0.245333 0.413089 0.139891
+0.286252 0.382302 0.151541
+
+
+0.192391 0.461585 0.03868
+0.1913 0.46206 0.0394034
+
+
+0.251167 0.416149 0.117254
+0.245333 0.413089 0.139891
+0.272517 0.396025 0.138015
+
+
+0.138019 0.482878 0.0877917
+0.0451587 0.471195 0.162285
+0.112364 0.487468 0.0834161
+0.111022 0.487658 0.0833264
+
+
+0.0015441 0.493886 0.0986315
+0.0451587 0.471195 0.162285
+0.0991283 0.48856 0.0850491
+0.0977172 0.488668 0.0852347
+
+
+0.0997233 0.461922 0.167177
+0.102775 0.461852 0.166176
+
+
+0.0223477 0.498937 -0.0361191
+0.0234257 0.498721 -0.039155
+
+
+0.0249551 0.493044 0.0954594
+0.0451587 0.471195 0.162285
+0.0877571 0.489393 0.0866739
+
+
+-0.135279 0.492383 0.12821
+-0.127067 0.496004 0.115985
+
+
+0.0758837 0.462604 0.17447
+0.0769996 0.462599 0.17407
+
+
+0.00987517 0.493616 0.0975085
+0.0451587 0.471195 0.162285
+0.0778691 0.490085 0.0880805
+
+
+0.0425574 0.498136 0.00724176
+0.0414571 0.498239 0.00648931
+
+
+-0.0693116 0.498945 0.053656
+-0.0778975 0.498652 0.06121
+
+
+0.0481025 0.49285 -0.105883
+0.0536467 0.491395 -0.121101
+
+
+0.137486 0.484517 0.0263722
+0.137452 0.484524 0.0260332
+
+
+0.0485735 0.462899 0.182676
+0.0566727 0.45453 0.201473
+0.0527276 0.462919 0.18147
+0.0510678 0.462981 0.181785
+
+
+0.0183121 0.462102 0.191168
+0.0566727 0.45453 0.201473
+0.0464416 0.46288 0.183282
+
+
+0.0671545 0.494746 0.0345981
+0.0641021 0.495214 0.0313463
+
+
+0.0442151 0.462852 0.183912
+0.0566727 0.45453 0.201473
+0.0100273 0.461788 0.19347
+
+
+0.0527276 0.462919 0.18147
+0.0531466 0.462984 0.181182
+
+
+0.276867 -0.363442 0.211077
+0.28032 -0.364716 0.204629
+
+
+0.284308 -0.366182 0.197114
+0.288169 -0.367574 0.189813
+
+
+0.368078 -0.321386 0.106804
+0.369127 -0.32019 0.106687
+
+
+0.37836 -0.30969 0.104972
+0.379157 -0.308738 0.104897
+
+
+0.390582 -0.295157 0.102656
+0.39171 -0.293764 0.102498
+
+
+0.375809 -0.267856 0.200267
+0.319882 -0.304039 0.235874
+0.337839 -0.325362 0.178641
+
+
+0.353946 -0.301618 0.187802
+0.319882 -0.304039 0.235874
+0.341361 -0.320249 0.180643
+
+
+0.35089 -0.306199 0.186063
+0.319882 -0.304039 0.235874
+0.357042 -0.296938 0.189565
+
+
+0.360241 -0.292063 0.191388
+0.319882 -0.304039 0.235874
+0.36725 -0.281253 0.195384
+
+
+0.371263 -0.274995 0.197672
+0.319882 -0.304039 0.235874
+0.387534 -0.249262 0.206961
+
+
+0.43238 -0.235254 0.0910994
+0.432571 -0.235134 0.0903847
+
+
+0.386014 -0.300664 0.103539
+0.386934 -0.299538 0.103429
+
+
+0.382069 -0.305351 0.104285
+0.382892 -0.304356 0.104201
+
+
+0.374585 -0.314036 0.105656
+0.375422 -0.313054 0.105577
+
+
+0.362407 -0.327684 0.107778
+0.363783 -0.326142 0.107606
+
+
+0.395636 -0.23631 0.211588
+0.319882 -0.304039 0.235874
+0.406437 -0.21896 0.217759
+
+
+0.323052 -0.368631 0.118737
+0.325546 -0.366595 0.116741
+
+
+0.372578 -0.31632 0.106014
+0.373462 -0.315294 0.105927
+
+
+0.380204 -0.307541 0.104632
+0.381006 -0.306577 0.104555
+
+
+0.402774 -0.285474 0.0811339
+0.40426 -0.283969 0.0783185
+0.409209 -0.280172 0.0636865
+0.409805 -0.279087 0.0645968
+0.412531 -0.275409 0.0631065
+
+
+0.0451587 0.471195 0.162285
+0.0690334 0.490674 0.0893314
+
+
+0.0451587 0.471195 0.162285
+0.0609436 0.491184 0.090471
+
+
+0.0451587 0.471195 0.162285
+0.0533705 0.491633 0.0915322
+
+
+0.0451587 0.471195 0.162285
+0.0461323 0.492035 0.0925409
+
+
+0.0451587 0.471195 0.162285
+0.0390756 0.492399 0.0935189
+
+
+0.0451587 0.471195 0.162285
+0.0320616 0.492733 0.0944856
+
+
+0.0451587 0.471195 0.162285
+-0.00763206 0.494152 0.0998619
+
+
+0.0451587 0.471195 0.162285
+-0.0300411 0.494688 0.102845
+
+
+0.0451587 0.471195 0.162285
+-0.0445101 0.494972 0.104758
+
+
+0.0451587 0.471195 0.162285
+-0.0626004 0.49528 0.107141
+
+
+0.0451587 0.471195 0.162285
+-0.0863835 0.49563 0.110263
+
+
+0.0451587 0.471195 0.162285
+-0.119804 0.496056 0.114638
+
+
+0.116753 0.461381 0.161949
+0.12202 0.461239 0.160255
+
+
+0.224888 0.43584 0.101556
+0.245333 0.413089 0.139891
+0.264375 0.403976 0.13008
+
+
+0.219822 0.43843 0.102375
+0.245333 0.413089 0.139891
+0.262905 0.405375 0.128678
+
+
+0.251834 0.42352 0.0859584
+0.25194 0.423476 0.0858642
+
+
+0.124375 0.48367 -0.0912331
+0.117576 0.484395 -0.0966473
+
+
+0.135299 0.484786 0.00110436
+0.13527 0.484789 0.000827527
+
+
+0.119084 0.486521 0.0837848
+0.112364 0.487468 0.0834161
+
+
+0.140385 0.483794 0.061019
+0.140337 0.483808 0.0604996
+
+
+-0.00896365 0.500402 0.00136332
+0.0272388 0.499148 0.0225842
+0.0125203 0.500053 -0.0172701
+
+
+0.0345806 0.498827 -0.00140405
+0.0332605 0.498922 -0.00267112
+
+
+0.0380798 0.498551 0.00240221
+0.0369415 0.498643 0.00141956
+
+
+0.0602246 0.495806 0.0270583
+0.0625558 0.495457 0.0295085
+
+
+0.0411235 0.498277 0.00568709
+0.0400274 0.498376 0.004883
+
+
+0.0281502 0.497736 -0.0518325
+0.0296544 0.49739 -0.0560319
+
+
+0.0357071 0.495962 -0.0724413
+0.0335268 0.496497 -0.0663958
+
+
+0.0562063 0.496405 0.0224748
+0.0546278 0.496627 0.0208811
+
+
+0.0439644 0.497989 0.00879046
+0.0428623 0.498097 0.00805067
+
+
+-0.137369 0.491461 0.13128
+-0.146219 0.487494 0.144459
+
+
+-0.0266733 -0.191886 -0.478381
+-0.0186482 -0.189105 -0.479402
+
+
+0.000372883 -0.18239 -0.481784
+0.00806148 -0.179704 -0.482701
+
+
+0.211571 -0.232498 -0.416131
+0.211738 -0.233364 -0.415496
+
+
+0.121668 -0.174216 -0.47106
+0.131564 -0.18068 -0.46521
+
+
+0.0972784 -0.158288 -0.485272
+0.108472 -0.165618 -0.478776
+
+
+0.0708809 -0.157252 -0.489646
+0.0806 -0.153779 -0.490618
+
+
+0.0407922 -0.168044 -0.48646
+0.0491158 -0.165096 -0.487354
+
+
+0.0136091 -0.177713 -0.483369
+0.0213529 -0.174995 -0.484262
+
+
+0.241485 0.174005 -0.407
+0.242053 0.175597 -0.405769
+
+
+0.246381 0.188419 -0.395954
+0.246818 0.189644 -0.394993
+
+
+0.270915 0.110859 -0.412971
+0.274583 0.104824 -0.412698
+
+
+0.205833 0.0667025 -0.451227
+0.203332 0.0662793 -0.452373
+
+
+0.348532 0.0358269 -0.380804
+0.345227 0.0310853 -0.385856
+
+
+0.360168 0.187047 -0.297558
+0.362659 0.182649 -0.297565
+
+
+0.290439 0.0801752 -0.410676
+0.288348 0.0822208 -0.411498
+
+
+0.0952704 0.201082 -0.462029
+0.0992866 0.200043 -0.460803
+
+
+0.192543 0.176044 -0.430891
+0.191048 0.176462 -0.431392
+
+
+0.29962 0.400195 0.0477118
+0.291629 0.404262 0.0541805
+0.242498 0.434148 0.0557766
+0.276149 0.41203 0.0666831
+0.280097 0.410065 0.0635159
+0.270737 0.406813 0.107727
+0.291316 0.404418 0.0544468
+0.291629 0.404262 0.0541805
+
+
+0.235949 0.441465 0.010773
+0.23533 0.44177 0.0112045
+
+
+0.248624 0.435099 0.00250053
+0.247792 0.435522 0.00307579
+
+
+0.214045 0.44136 0.103304
+0.245333 0.413089 0.139891
+0.261533 0.406663 0.127393
+
+
+0.332305 0.332863 0.204975
+0.33988 0.328183 0.204417
+
+
+0.400237 0.340927 -0.00280012
+0.393509 0.348903 -0.0162389
+
+
+0.276149 0.41203 0.0666831
+0.275984 0.412109 0.0668267
+
+
+0.240399 0.428493 0.0947775
+0.240246 0.428555 0.094906
+
+
+0.36757 0.365242 -0.00763697
+0.242498 0.434148 0.0557766
+0.280293 0.40997 0.0633465
+0.285063 0.407576 0.0595072
+0.270737 0.406813 0.107727
+0.236426 0.430171 0.0978329
+0.236604 0.430098 0.0976851
+
+
+0.415683 0.322212 0.0284814
+0.414722 0.323398 0.026516
+
+
+0.268189 0.424998 -0.0103508
+0.266724 0.425761 -0.00935124
+
+
+0.260352 0.429072 -0.00519446
+0.259184 0.429676 -0.00439413
+
+
+0.272601 0.413777 0.0695309
+0.272459 0.413845 0.0696565
+
+
+0.229448 0.433489 0.100813
+0.245333 0.413089 0.139891
+0.260226 0.407872 0.126193
+
+
+0.207261 0.444774 0.104388
+0.245333 0.413089 0.139891
+0.258969 0.409025 0.12504
+
+
+0.176627 0.46842 0.0486467
+0.174896 0.469162 0.0497762
+
+
+0.198206 0.459029 0.0349932
+0.197287 0.459433 0.0356074
+
+
+0.215321 0.45132 0.0240857
+0.214713 0.451598 0.0245044
+
+
+0.228922 0.4449 0.0153308
+0.228354 0.445173 0.0157273
+
+
+0.243955 0.437466 0.00555431
+0.24322 0.437836 0.00606457
+
+
+0.278305 0.419703 -0.0170173
+0.276371 0.420717 -0.0157036
+
+
+0.378546 0.363384 -0.0520927
+0.242498 0.434148 0.0557766
+0.285305 0.407457 0.0592997
+0.291316 0.404418 0.0544468
+
+
+0.199012 0.448898 0.1057
+0.245333 0.413089 0.139891
+0.25776 0.410141 0.123877
+
+
+0.188545 0.454096 0.107356
+0.245333 0.413089 0.139891
+0.256574 0.411247 0.122667
+
+
+0.255357 0.412375 0.121414
+0.245333 0.413089 0.139891
+0.254071 0.413551 0.120114
+
+
+0.233365 0.431455 0.100163
+0.236426 0.430171 0.0978329
+
+
+0.233365 0.431455 0.100163
+0.232303 0.432016 0.100307
+
+
+0.233365 0.431455 0.100163
+0.23378 0.431101 0.100567
+0.245333 0.413089 0.139891
+0.249465 0.417648 0.115603
+
+
+0.243574 0.427133 0.0923486
+0.243709 0.427077 0.0922337
+
+
+0.246673 0.425795 0.0899477
+0.246551 0.425845 0.090053
+
+
+0.245333 0.413089 0.139891
+0.24751 0.419354 0.113715
+
+
+0.245333 0.413089 0.139891
+0.245195 0.421358 0.11149
+
+
+0.245333 0.413089 0.139891
+0.174527 0.461021 0.109566
+
+
+0.245333 0.413089 0.139891
+0.154328 0.470952 0.112737
+
+
+-0.184229 0.280204 0.380077
+-0.187766 0.279777 0.378768
+
+
+-0.165417 0.282297 0.387043
+-0.168915 0.281892 0.385775
+
+
+-0.226074 0.275229 0.364104
+-0.230677 0.274633 0.362332
+
+
+-0.29136 0.223326 0.3588
+-0.29433 0.215013 0.361262
+
+
+0.137027 0.258639 0.405819
+0.145377 0.224646 0.422847
+0.148411 0.264077 0.398665
+
+
+0.125293 0.25296 0.413005
+0.145377 0.224646 0.422847
+0.144154 0.26205 0.401356
+
+
+-0.0369368 0.204398 0.47301
+-0.0369417 0.209298 0.470855
+
+
+-0.125098 -0.0901339 0.48223
+-0.125086 -0.0901409 0.482231
+
+
+-0.0755318 -0.119813 0.486177
+-0.0755197 -0.11982 0.486178
+
+
+-0.0368791 0.222804 0.464876
+-0.0368759 0.21787 0.46707
+
+
+0.106098 0.243482 0.424285
+0.106591 0.243753 0.423986
+
+
+-0.155855 0.283325 0.390529
+-0.159436 0.28292 0.389245
+
+
+-0.431297 0.0854121 0.26456
+-0.438746 0.0811577 0.256472
+
+
+-0.328343 0.0119323 0.377794
+-0.327925 0.0132417 0.378173
+
+
+-0.368106 0.120291 0.331066
+-0.373622 0.117303 0.325447
+
+
+-0.476209 0.189984 -0.0244143
+-0.476469 0.189252 -0.0244652
+
+
+-0.432962 -0.107156 0.263674
+-0.432303 -0.107152 0.264402
+
+
+-0.408461 -0.107233 0.290536
+-0.407978 -0.107228 0.291064
+
+
+-0.389477 -0.107252 0.311078
+-0.389081 -0.107247 0.311505
+
+
+-0.373205 -0.107232 0.328432
+-0.372849 -0.107226 0.32881
+
+
+-0.466542 -0.244709 -0.0319038
+-0.463169 -0.249028 -0.0290092
+
+
+0.23378 0.431101 0.100567
+0.235207 0.429917 0.101835
+
+
+0.254379 0.422382 0.0839629
+0.254277 0.422425 0.0840546
+
+
+0.269345 0.415362 0.0721472
+0.269472 0.415303 0.0720343
+
+
+0.35935 0.317841 0.192868
+0.358629 0.317745 0.194879
+
+
+0.386282 0.356597 -0.03227
+0.447137 0.19877 -0.104378
+
+
+0.386282 0.356597 -0.03227
+0.38491 0.357814 -0.0357701
+
+
+0.386282 0.356597 -0.03227
+0.389029 0.354146 -0.025131
+
+
+0.232359 0.44323 0.0131044
+0.231772 0.443515 0.0135141
+
+
+0.225566 0.446512 0.0174995
+0.225005 0.446779 0.0178905
+
+
+0.211613 0.45302 0.0264576
+0.210962 0.453315 0.0269027
+
+
+0.2032 0.456812 0.0318201
+0.202402 0.457166 0.0323579
+
+
+0.185393 0.464633 0.0431088
+0.184049 0.465214 0.0439925
+
+
+0.292184 0.412397 -0.026176
+0.289451 0.413837 -0.0243283
+
+
+0.348113 0.382734 -0.06315
+0.340413 0.386827 -0.0579911
+
+
+0.455842 0.178821 -0.101157
+0.456101 0.179025 -0.0996162
+0.454919 0.181629 -0.100324
+
+
+0.447085 0.198649 -0.104869
+0.447076 0.198599 -0.10501
+
+
+0.451902 0.187088 -0.104224
+0.455454 0.181971 -0.0972075
+
+
+0.242498 0.434148 0.0557766
+0.312106 0.393811 0.0375494
+0.330196 0.384513 0.0228427
+
+
+0.242498 0.434148 0.0557766
+0.331284 0.383955 0.021937
+
+
+0.0453741 0.497833 0.0103675
+0.0442772 0.497946 0.00959718
+
+
+0.0735615 0.493735 0.0416871
+0.0692789 0.494407 0.0370762
+
+
+0.0207075 0.49924 -0.0316788
+0.0217191 0.499049 -0.0345333
+
+
+-0.0160939 0.500355 0.00755006
+0.0272388 0.499148 0.0225842
+0.00926591 0.500155 -0.0144482
+
+
+0.110923 0.487666 0.0833396
+0.0991283 0.48856 0.0850491
+
+
+0.0767141 0.493227 0.0453107
+0.0833381 0.492169 0.0525028
+
+
+0.137976 0.483851 0.0808911
+0.139951 0.483665 0.0747679
+
+
+0.139283 0.484108 0.0477301
+0.139242 0.484119 0.0472929
+
+
+0.13599 0.484732 0.00899121
+0.13596 0.484736 0.00870126
+
+
+0.134625 0.484809 -0.00649803
+0.134596 0.484811 -0.00676761
+
+
+0.0238117 0.499513 -0.0132116
+0.0210905 0.499665 -0.0160756
+
+
+-0.0823001 0.489146 -0.0827462
+-0.0834404 0.489139 -0.0819073
+
+
+-0.111614 0.488583 -0.0617549
+-0.113353 0.488542 -0.0604767
+
+
+0.0792651 0.487966 -0.127111
+0.0700361 0.48873 -0.134381
+
+
+0.132572 0.484706 -0.0291072
+0.132542 0.484705 -0.0293867
+
+
+0.138332 0.484343 0.036371
+0.138295 0.484351 0.0359912
+
+
+0.129182 0.484068 -0.0650056
+0.129139 0.484059 -0.0653978
+
+
+0.0894566 0.487087 -0.11904
+0.0811441 0.487812 -0.125601
+
+
+-0.0898464 0.489055 -0.0773306
+-0.0886242 0.489069 -0.0782301
+
+
+-0.00272932 0.500382 -0.00404494
+0.0272388 0.499148 0.0225842
+0.00617849 0.500237 -0.0117709
+
+
+-0.0705567 0.48921 -0.0911094
+-0.0716131 0.489213 -0.0903337
+
+
+-0.046855 0.49966 0.0342535
+-0.0428672 0.499776 0.0307147
+
+
+0.0949922 0.240172 0.429183
+0.0973589 0.240085 0.428659
+
+
+0.112775 0.226056 0.431707
+0.113742 0.225157 0.431897
+
+
+0.242786 0.267973 0.360496
+0.239457 0.270008 0.360658
+
+
+0.105798 0.321821 0.369162
+0.102233 0.322975 0.369246
+
+
+0.119611 0.250177 0.416401
+0.145377 0.224646 0.422847
+0.140409 0.260261 0.403709
+
+
+0.21105 0.287431 0.361733
+0.207666 0.287728 0.362859
+
+
+0.255469 0.260111 0.359926
+0.251706 0.262424 0.360118
+
+
+0.100668 0.323517 0.369247
+0.096868 0.324737 0.369324
+
+
+-0.0117812 0.339563 0.383578
+-0.0136153 0.338846 0.384505
+
+
+0.110694 0.320189 0.369067
+0.10728 0.321302 0.369158
+
+
+0.116615 0.248701 0.41817
+0.145377 0.224646 0.422847
+0.1339 0.257134 0.407756
+
+
+0.000577519 0.344288 0.377407
+-0.00105352 0.343653 0.378237
+
+
+0.0541712 0.338421 0.36953
+0.0443519 0.341473 0.369558
+
+
+0.0951816 0.325315 0.369322
+0.0910413 0.326635 0.369392
+
+
+0.112128 0.319682 0.369058
+0.115462 0.318585 0.368959
+
+
+0.145377 0.224646 0.422847
+0.128096 0.254324 0.411309
+0.125628 0.253147 0.412788
+
+
+0.145377 0.224646 0.422847
+0.122483 0.251586 0.414691
+
+
+0.358805 -0.331649 0.108388
+0.360454 -0.329816 0.108172
+
+
+0.365442 -0.324324 0.10726
+0.366627 -0.322984 0.107119
+
+
+0.303367 -0.377677 0.150782
+0.302734 -0.381977 0.142433
+
+
+0.314063 -0.375899 0.126057
+0.31718 -0.373372 0.123565
+
+
+0.40426 -0.283969 0.0783185
+0.406164 -0.281942 0.0750969
+0.412143 -0.274661 0.0685731
+
+
+0.415328 -0.254725 0.120332
+0.417429 -0.250259 0.123917
+0.421019 -0.260657 0.0697593
+
+
+0.415328 -0.254725 0.120332
+0.375883 -0.302347 0.133038
+0.408434 -0.269205 0.108495
+0.409884 -0.26622 0.110906
+
+
+0.415328 -0.254725 0.120332
+0.414555 -0.256392 0.118933
+0.420352 -0.261608 0.0701848
+
+
+0.422371 -0.258777 0.0686395
+0.417333 -0.270212 0.0541436
+
+
+0.375883 -0.302347 0.133038
+0.412752 -0.260187 0.115881
+0.414555 -0.256392 0.118933
+
+
+0.375883 -0.302347 0.133038
+0.418348 -0.248261 0.125581
+0.420885 -0.242819 0.129943
+
+
+0.425467 0.3015 0.0284505
+0.432326 0.286873 0.0284056
+
+
+0.453355 0.195342 -0.0796693
+0.453102 0.196477 -0.0784101
+
+
+0.453355 0.195342 -0.0796693
+0.460072 0.178329 -0.0817812
+
+
+0.453355 0.195342 -0.0796693
+0.453504 0.194331 -0.0811973
+0.449646 0.196321 -0.0970268
+
+
+0.452297 0.200771 -0.0726867
+0.45192 0.202529 -0.070569
+0.448284 0.198054 -0.100219
+
+
+0.452297 0.200771 -0.0726867
+0.461158 0.176013 -0.0810693
+
+
+0.452297 0.200771 -0.0726867
+0.452592 0.19912 -0.0749847
+
+
+0.454067 0.191594 -0.0843835
+0.453828 0.192528 -0.0835602
+0.450495 0.195135 -0.0952278
+
+
+0.454067 0.191594 -0.0843835
+0.45829 0.181835 -0.0835464
+
+
+0.454067 0.191594 -0.0843835
+0.454086 0.190976 -0.0856536
+0.451663 0.193384 -0.0930015
+
+
+0.449877 0.19598 -0.0965793
+0.454798 0.186621 -0.0912849
+
+
+0.453736 0.193338 -0.082215
+0.453504 0.194331 -0.0811973
+
+
+0.453736 0.193338 -0.082215
+0.45928 0.179931 -0.0824786
+
+
+0.453736 0.193338 -0.082215
+0.453828 0.192528 -0.0835602
+
+
+0.454392 0.189968 -0.0862649
+0.454086 0.190976 -0.0856536
+
+
+0.454392 0.189968 -0.0862649
+0.456727 0.184815 -0.0852636
+0.455239 0.187368 -0.0874846
+0.455059 0.187607 -0.0879049
+
+
+0.454392 0.189968 -0.0862649
+0.454229 0.18969 -0.0877211
+0.453429 0.190625 -0.0898395
+
+
+0.448488 0.219526 -0.0483466
+0.447146 0.225874 -0.0402763
+
+
+0.448488 0.219526 -0.0483466
+0.462013 0.174085 -0.0807017
+
+
+0.448488 0.219526 -0.0483466
+0.449567 0.21414 -0.0555116
+
+
+0.451497 0.20478 -0.0674995
+0.450983 0.207195 -0.0645204
+
+
+0.451497 0.20478 -0.0674995
+0.461503 0.175257 -0.0808779
+
+
+0.451497 0.20478 -0.0674995
+0.45192 0.202529 -0.070569
+
+
+0.436232 0.278481 0.028403
+0.441978 0.250713 -0.00800523
+
+
+0.447631 0.198647 -0.102236
+0.454999 0.185411 -0.0927372
+
+
+0.382782 0.32018 0.126763
+0.383391 0.320242 0.124974
+
+
+0.415687 0.322204 0.0284814
+0.423737 0.305177 0.0284343
+
+
+0.454229 0.18969 -0.0877211
+0.455239 0.187368 -0.0874846
+
+
+0.456727 0.184815 -0.0852636
+0.458064 0.182241 -0.0838469
+
+
+0.463013 0.171402 -0.0811302
+0.463039 0.171311 -0.0811809
+
+
+0.455173 0.184253 -0.0941828
+0.447196 0.197701 -0.106207
+
+
+0.461221 0.171578 -0.0894716
+0.460803 0.172162 -0.0903606
+
+
+0.456647 0.178401 -0.0982369
+0.456101 0.179025 -0.0996162
+
+
+0.458544 0.175454 -0.0948467
+0.457964 0.176454 -0.0957052
+
+
+0.455328 0.18311 -0.0956524
+0.448969 0.19308 -0.10668
+
+
+0.462968 0.169812 -0.0844696
+0.462889 0.169852 -0.0847775
+
+
+0.463255 0.169952 -0.0827967
+0.500248 0.0489744 -0.0957045
+
+
+0.463264 0.170001 -0.0826544
+0.503075 0.0470916 -0.083297
+
+
+0.46069 0.177027 -0.0813436
+0.461047 0.176248 -0.0811475
+
+
+0.256759 0.4213 0.0821003
+0.256658 0.421344 0.082191
+
+
+0.285305 0.407457 0.0592997
+0.285063 0.407576 0.0595072
+
+
+0.368842 0.318871 0.166487
+0.369478 0.318948 0.164678
+
+
+0.350095 0.320694 0.205221
+0.351119 0.319947 0.205292
+
+
+0.312106 0.393811 0.0375494
+0.311463 0.394138 0.038088
+
+
+0.280293 0.40997 0.0633465
+0.280097 0.410065 0.0635159
+
+
+0.264015 0.41792 0.0763777
+0.263907 0.41797 0.0764755
+
+
+0.0538422 0.496743 0.0198507
+0.0524644 0.496929 0.0185013
+
+
+0.0499929 0.497266 0.0155619
+0.0488341 0.497408 0.0145301
+
+
+0.0590356 0.495989 0.0256106
+0.0571584 0.496261 0.0236715
+
+
+0.10054 0.489378 0.0715313
+0.0885944 0.491312 0.0584737
+
+
+0.0483494 0.497476 0.0137194
+0.0472372 0.497606 0.0127969
+
+
+-0.0250597 0.500215 0.0153314
+0.0272388 0.499148 0.0225842
+0.00318977 0.500301 -0.00917888
+
+
+-0.0202626 0.5003 0.0111678
+0.0272388 0.499148 0.0225842
+-0.00577545 0.5004 -0.00140256
+
+
+-0.124447 0.496667 0.0937133
+-0.124483 0.49663 0.0929608
+
+
+0.0442936 0.131805 -0.493333
+0.0534786 0.13374 -0.493258
+
+
+0.0229514 -0.0454626 -0.499563
+0.0139239 -0.0403937 -0.499595
+
+
+-0.0195143 -0.021711 -0.49935
+-0.022204 -0.0201805 -0.499282
+
+
+-0.0253372 -0.0184459 -0.499188
+-0.0278955 -0.0169873 -0.499102
+
+
+-0.0309944 -0.0152702 -0.498981
+-0.0336248 -0.0137697 -0.498868
+
+
+-0.016389 -0.0234621 -0.499416
+-0.0192314 -0.021847 -0.499357
+
+
+-0.00929961 -0.0274314 -0.499521
+-0.0126908 -0.0255111 -0.499479
+
+
+-0.000184572 -0.0325306 -0.499586
+-0.00467102 -0.0299993 -0.499563
+
+
+0.0936371 -0.0849417 -0.499021
+0.0611026 -0.0667392 -0.499309
+
+
+0.145508 0.0552167 -0.476963
+0.138928 0.0540128 -0.479604
+
+
+-0.336998 0.321247 -0.193789
+-0.335391 0.322787 -0.193475
+
+
+-0.461356 0.230985 -0.0211903
+-0.461678 0.230112 -0.0212525
+
+
+-0.49368 0.139549 -0.0283229
+-0.493938 0.138786 -0.028375
+
+
+-0.289593 0.40453 -0.0709155
+-0.285175 0.407185 -0.0738672
+
+
+-0.270004 0.38356 -0.179105
+-0.271001 0.38269 -0.179309
+
+
+-0.264344 0.388546 -0.17781
+-0.265459 0.387578 -0.178041
+
+
+-0.310379 0.346706 -0.188103
+-0.311308 0.345841 -0.188282
+
+
+-0.397718 0.283132 -0.150915
+-0.399983 0.283745 -0.1437
+
+
+-0.149833 -0.463929 -0.115556
+-0.151315 -0.463247 -0.116134
+
+
+-0.0757818 -0.439904 -0.242707
+-0.0741777 -0.441712 -0.239461
+
+
+-0.0670477 -0.449507 -0.225365
+-0.0655634 -0.451151 -0.222352
+
+
+-0.0500746 -0.467649 -0.191574
+-0.0484677 -0.469361 -0.188305
+
+
+0.306688 0.0675119 0.389616
+0.306853 0.0696945 0.389046
+
+
+0.304224 0.0430496 0.396241
+0.304618 0.0473287 0.395135
+
+
+0.306231 0.0628305 0.390905
+0.306428 0.0652932 0.390264
+
+
+0.305042 0.0510014 0.394112
+0.305345 0.0544302 0.393225
+
+
+0.303148 0.0327402 0.398979
+0.303684 0.0383523 0.397531
+
+
+0.296144 0.0137633 0.407504
+0.298374 0.0186959 0.405016
+
+
+0.266154 -0.0453018 0.439168
+0.26703 -0.0452415 0.438562
+
+
+0.207937 -0.0487132 0.47885
+0.209251 -0.0486279 0.477968
+
+
+-0.0171192 0.00102877 0.50026
+-0.0178633 0.00453852 0.500285
+
+
+-0.0154126 -0.00742486 0.500154
+-0.0160706 -0.00434427 0.500199
+
+
+-0.0217022 0.0237802 0.500289
+-0.0229836 0.0299483 0.500253
+
+
+-0.118537 0.0907379 0.489932
+-0.121677 0.0887077 0.489512
+
+
+-0.151348 0.0697378 0.485275
+-0.154707 0.067551 0.484778
+
+
+-0.0332695 -0.144808 0.488619
+-0.0327522 -0.144552 0.488694
+
+
+-0.50186 -0.0447962 0.187634
+-0.502307 -0.0450286 0.186074
+
+
+-0.402298 0.31673 0.108379
+-0.402635 0.325975 0.0918204
+
+
+-0.546272 -0.0430518 -0.0142864
+-0.54559 -0.0372213 -0.0193508
+
+
+-0.543404 -0.0189844 -0.0350794
+-0.544082 -0.0245227 -0.0302709
+
+
+-0.434774 -0.284972 -0.00511218
+-0.432217 -0.288164 -0.00295012
+
+
+0.465995 -0.168085 -0.102287
+0.464878 -0.166358 -0.108105
+
+
+0.427002 -0.253254 0.0600885
+0.41879 -0.268521 0.0512451
+
+
+0.426139 -0.254089 0.0626769
+0.418429 -0.268948 0.0519717
+
+
+0.425051 -0.255324 0.0650107
+0.418071 -0.269367 0.0526876
+
+
+0.423781 -0.256903 0.0670215
+0.417708 -0.269785 0.0534068
+
+
+0.413705 -0.27204 0.0696587
+0.414185 -0.273633 0.0601732
+
+
+0.403038 -0.283293 0.0879606
+0.403018 -0.283646 0.0867541
+
+
+0.408256 -0.279862 0.0709329
+0.406164 -0.281942 0.0750969
+
+
+0.408256 -0.279862 0.0709329
+0.409825 -0.278906 0.0652404
+0.410668 -0.277472 0.0660479
+0.410831 -0.277258 0.0659306
+
+
+0.408256 -0.279862 0.0709329
+0.40952 -0.27844 0.0690857
+0.411115 -0.276422 0.0676506
+
+
+0.409209 -0.280172 0.0636865
+0.409072 -0.280564 0.0628501
+
+
+0.403212 -0.281741 0.0927383
+0.40319 -0.282151 0.091364
+
+
+0.412567 -0.274003 0.0686706
+0.413281 -0.274579 0.0618905
+
+
+0.404735 -0.27676 0.102256
+0.404238 -0.277779 0.101372
+
+
+0.41635 -0.267703 0.0708243
+0.41552 -0.272209 0.0576379
+
+
+0.412752 -0.260187 0.115881
+0.41208 -0.261624 0.114667
+
+
+0.408434 -0.269205 0.108495
+0.407883 -0.270361 0.107504
+
+
+0.420872 -0.260873 0.0698278
+0.416938 -0.270656 0.0549137
+
+
+0.418348 -0.248261 0.125581
+0.417429 -0.250259 0.123917
+
+
+0.40952 -0.27844 0.0690857
+0.410668 -0.277472 0.0660479
+
+
+0.409825 -0.278906 0.0652404
+0.409805 -0.279087 0.0645968
+
+
+0.408696 -0.281271 0.062151
+0.408422 -0.28196 0.0608512
+
+
+0.407461 -0.285168 0.0520153
+0.407565 -0.285265 0.0507152
+
+
+0.408267 -0.285092 0.0459882
+0.408501 -0.284895 0.0451599
+
+
+0.41035 -0.282982 0.0402411
+0.410393 -0.282929 0.0401715
+
+
+0.412828 -0.279835 0.0366399
+0.413042 -0.27954 0.0364559
+
+
+0.41916 -0.268078 0.050493
+0.427622 -0.252826 0.057345
+
+
+0.416019 -0.275316 0.0344023
+0.416062 -0.275252 0.0343956
+
+
+0.418307 -0.271853 0.033916
+0.419063 -0.270661 0.034036
+
+
+0.421696 -0.266377 0.0350318
+0.42174 -0.266298 0.0350941
+
+
+0.423559 -0.263196 0.0364474
+0.423909 -0.262499 0.0373744
+
+
+0.424621 -0.261348 0.0373512
+0.425573 -0.259936 0.0364104
+0.424877 -0.260665 0.0391668
+
+
+0.422624 -0.264813 0.0356382
+0.422897 -0.264307 0.0361221
+
+
+0.419972 -0.269219 0.0341669
+0.420458 -0.268417 0.0344495
+
+
+0.417507 -0.273082 0.0340107
+0.417588 -0.272955 0.0340216
+
+
+0.419548 -0.267606 0.0496984
+0.42799 -0.2528 0.0545415
+
+
+0.414015 -0.278205 0.0355333
+0.414531 -0.277471 0.0352082
+
+
+0.411252 -0.281889 0.0386483
+0.411645 -0.281384 0.0381216
+
+
+0.40918 -0.284275 0.042917
+0.409337 -0.284105 0.0425505
+
+
+0.407838 -0.285318 0.048259
+0.407913 -0.285272 0.0479161
+
+
+0.407465 -0.28463 0.0547423
+0.407472 -0.284871 0.0534809
+
+
+0.407968 -0.283 0.0590986
+0.407932 -0.28316 0.0585993
+
+
+0.425573 -0.259936 0.0364104
+0.42668 -0.25839 0.0346218
+
+
+-0.0648851 0.489201 -0.095137
+-0.0659325 0.489209 -0.0943693
+
+
+-0.0408752 0.488877 -0.112106
+-0.0421066 0.488909 -0.111213
+
+
+-0.0954606 0.488955 -0.0733396
+-0.0968002 0.488934 -0.0723537
+
+
+-0.0763225 0.489192 -0.0870071
+-0.0774092 0.489191 -0.0862083
+
+
+0.0611698 0.489426 -0.141385
+0.0583436 0.488912 -0.145591
+
+
+-0.109445 0.497541 0.0886075
+-0.0942321 0.498084 0.075275
+
+
+0.024099 0.498593 -0.0408612
+0.0252738 0.498346 -0.0441612
+
+
+0.0306094 0.497181 -0.0584933
+0.032388 0.496757 -0.0634421
+
+
+0.0417542 0.494471 -0.0886839
+0.0455409 0.493495 -0.0991121
+
+
+0.0575795 0.488766 -0.146748
+0.050184 0.487374 -0.157732
+
+
+-0.121658 0.488297 -0.0545358
+-0.123732 0.488239 -0.0530127
+
+
+-0.129604 0.488444 -0.0438186
+-0.129591 0.48847 -0.0435095
+
+
+-0.53744 -0.0983761 0.000143071
+-0.545565 -0.0794172 0.00646013
+
+
+-0.499523 -0.184577 -0.0287832
+-0.493626 -0.197601 -0.0331363
+
+
+-0.479842 -0.22759 -0.0432333
+-0.475987 -0.232563 -0.0399121
+
+
+-0.454881 -0.259604 -0.0220193
+-0.451879 -0.263416 -0.0194555
+
+
+-0.394014 -0.306102 0.0826089
+-0.393381 -0.305935 0.0848433
+
+
+-0.383077 -0.303528 0.119613
+-0.382659 -0.303405 0.121041
+
+
+-0.378702 -0.302427 0.133936
+-0.378311 -0.302307 0.135243
+
+
+-0.425709 -0.296257 0.00244404
+-0.423271 -0.299273 0.00449431
+
+
+-0.444409 -0.27287 -0.0131905
+-0.44167 -0.276319 -0.0108625
+
+
+-0.507637 -0.166482 -0.0227077
+-0.501611 -0.179945 -0.0272039
+
+
+-0.54934 -0.0705655 0.00944699
+-0.54861 -0.0722859 0.00887394
+
+
+-0.0154305 -0.538074 0.0315537
+-0.0128354 -0.535997 0.0119168
+
+
+-0.00963475 -0.533312 -0.0125466
+-0.00734887 -0.531346 -0.0298142
+
+
+0.165986 -0.454169 -0.182204
+0.17553 -0.449751 -0.188072
+
+
+0.142091 -0.465099 -0.167411
+0.150315 -0.461374 -0.172478
+
+
+0.215313 -0.449828 -0.0391308
+0.215303 -0.450008 -0.0369248
+
+
+0.214982 -0.44855 -0.0552006
+0.215003 -0.448822 -0.0522539
+
+
+0.213373 -0.443045 -0.11318
+0.213669 -0.444265 -0.101135
+
+
+0.13106 -0.47006 -0.16057
+0.138937 -0.466532 -0.165429
+
+
+0.0876943 -0.488998 -0.133592
+0.0957401 -0.48556 -0.13858
+
+
+0.0339011 -0.511395 -0.0999656
+0.0453041 -0.506735 -0.107074
+
+
+0.0156664 -0.531435 0.119785
+0.0150224 -0.531665 0.119747
+
+
+-0.213978 -0.412146 0.186672
+-0.212748 -0.412958 0.186168
+
+
+-0.188041 -0.429244 0.174823
+-0.187241 -0.429727 0.17451
+
+
+-0.176068 -0.436695 0.169284
+-0.174952 -0.437357 0.168819
+
+
+0.00390597 -0.506229 0.165685
+0.00353556 -0.505397 0.167174
+
+
+-0.0056061 -0.537668 0.0896043
+0.00226024 -0.535415 0.101106
+
+
+0.198537 0.0653255 -0.454569
+0.196325 0.064956 -0.455561
+
+
+0.226372 0.0705634 -0.441551
+0.222054 0.0698042 -0.443601
+
+
+0.0659286 0.159643 -0.482825
+0.0681482 0.16419 -0.480957
+
+
+0.0629455 0.11349 -0.494431
+0.0622157 0.115085 -0.494341
+
+
+0.0738641 0.0900825 -0.495626
+0.0732531 0.0914262 -0.495561
+
+
+0.259025 0.0766777 -0.425791
+0.249078 0.0748789 -0.430607
+
+
+0.0117265 0.348518 0.371805
+0.01024 0.347943 0.372567
+
+
+0.10168 0.241276 0.426818
+0.102253 0.241587 0.426476
+
+
+0.128433 0.254513 0.411089
+0.128096 0.254324 0.411309
+
+
+0.159439 0.269303 0.391629
+0.160273 0.269723 0.391077
+
+
+0.191988 0.284622 0.370602
+0.194273 0.28573 0.369096
+
+
+0.0684606 0.333872 0.369535
+0.0747171 0.331912 0.369485
+
+
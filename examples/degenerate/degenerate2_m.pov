@@ -0,0 +1,22286 @@
+mesh2 {
+vertex_vectors {
+7427
+,<-0.252004,0.344091,-0.261173>
+,<0.389392,0.0185887,0.31492>
+,<0.266572,0.420205,-0.101389>
+,<0.363494,-0.0444946,0.345712>
+,<-0.132444,0.0818279,0.48802>
+,<0.430987,-0.235997,0.0966334>
+,<0.0979089,0.382853,0.307741>
+,<0.478094,0.175438,0.041618>
+,<0.0418429,0.462813,0.184581>
+,<0.384466,-0.0357471,0.323658>
+,<0.441415,0.151669,0.181162>
+,<0.424773,-0.202364,0.202417>
+,<0.403372,0.181669,-0.234621>
+,<-0.12927,0.489255,-0.0335342>
+,<0.458323,0.154602,-0.130324>
+,<0.39186,-0.309099,0.0370347>
+,<0.446811,-0.22562,0.0261924>
+,<0.473951,-0.0612827,-0.147215>
+,<0.33003,-0.147545,0.348415>
+,<0.326852,0.102282,0.364325>
+,<0.369231,0.063132,0.331677>
+,<0.389795,0.0275192,0.31368>
+,<0.421004,-0.0623426,0.269793>
+,<0.0788181,0.0954353,0.493737>
+,<0.284321,0.124518,0.392169>
+,<-0.123897,0.44899,-0.183254>
+,<0.29859,-0.199347,0.34868>
+,<0.21159,0.155556,0.43224>
+,<0.296611,-0.282417,0.28998>
+,<0.224721,-0.263493,0.369993>
+,<0.276488,-0.048736,0.430311>
+,<0.288553,-0.0543768,0.419236>
+,<0.298035,-0.0588039,0.410466>
+,<0.0466209,0.109339,0.495473>
+,<-0.413056,-0.254464,-0.168497>
+,<0.402464,-0.28622,0.079853>
+,<0.417745,-0.282084,-0.0613746>
+,<0.475991,0.084382,0.151899>
+,<0.50637,-0.0637158,-0.00485048>
+,<0.424137,-0.212246,0.184284>
+,<0.386972,-0.0222289,0.320298>
+,<0.426619,-0.257322,0.0422962>
+,<0.44325,-0.228364,0.0437502>
+,<0.356853,-0.183012,0.302695>
+,<0.291086,-0.286099,0.292452>
+,<0.326539,-0.130814,0.358654>
+,<-0.328868,-0.33453,-0.179872>
+,<-0.229811,-0.332967,0.324409>
+,<0.354076,-0.346137,0.0725017>
+,<0.337001,-0.358174,0.101264>
+,<0.258715,-0.234404,0.360571>
+,<0.331127,-0.152948,0.345064>
+,<0.422296,-0.236413,0.139592>
+,<0.183763,0.294414,0.366157>
+,<0.388687,0.00577155,0.316696>
+,<0.386242,-0.0330759,0.321656>
+,<0.454511,0.188019,-0.0898303>
+,<0.485226,0.0669062,-0.143941>
+,<0.438879,-0.231444,0.0639217>
+,<0.399641,-0.292982,0.0675614>
+,<0.444326,-0.227549,0.0385357>
+,<0.346391,-0.17556,0.318282>
+,<0.38115,-0.20042,0.265291>
+,<-0.0233895,0.0321689,0.500239>
+,<0.322149,-0.110549,0.370816>
+,<0.172873,0.403804,-0.247738>
+,<0.209723,-0.276203,0.374141>
+,<-0.116637,-0.0952323,0.482999>
+,<0.300913,0.0970782,0.387381>
+,<0.40512,-0.0497709,0.294039>
+,<0.504281,0.0877653,0.00759096>
+,<0.437559,0.0741709,0.235052>
+,<0.430825,0.0786936,0.245337>
+,<0.429317,-0.236868,0.103196>
+,<0.374129,-0.116155,0.311345>
+,<0.295925,0.105542,0.388977>
+,<0.40028,-0.291498,0.0702806>
+,<0.429035,-0.264619,-0.0574011>
+,<0.393265,-0.317414,-0.0537248>
+,<0.417816,-0.265413,0.0708933>
+,<0.400951,-0.289909,0.0731775>
+,<0.440451,-0.230391,0.0568413>
+,<0.421618,-0.0628145,0.268842>
+,<0.385893,-0.320336,0.0151213>
+,<0.445568,-0.226587,0.0324366>
+,<0.474382,-0.184662,-0.0515984>
+,<0.437054,-0.172767,0.205932>
+,<0.339558,-0.17071,0.328249>
+,<0.349783,-0.177972,0.313271>
+,<0.364862,-0.188738,0.290518>
+,<0.365774,-0.233805,0.256831>
+,<0.178742,-0.283153,0.392407>
+,<-0.332027,-0.387682,0.00419519>
+,<0.320267,-0.102044,0.375862>
+,<0.325224,-0.12467,0.362366>
+,<0.328915,-0.142127,0.351753>
+,<0.301652,-0.279035,0.287705>
+,<-0.290748,-0.420371,-0.015194>
+,<0.21,-0.410576,0.193582>
+,<0.345925,-0.351955,0.0863121>
+,<0.359782,-0.341914,0.0626635>
+,<0.361457,-0.34064,0.0597388>
+,<0.366319,-0.336841,0.0511308>
+,<0.369752,-0.334067,0.0449516>
+,<0.37164,-0.332512,0.0415193>
+,<0.368054,-0.33545,0.0480069>
+,<0.367993,-0.335497,0.0481279>
+,<0.364694,-0.338129,0.0540283>
+,<0.358024,-0.343233,0.0657144>
+,<0.349093,-0.349716,0.080969>
+,<0.342024,-0.354687,0.0928625>
+,<0.330147,-0.362896,0.112686>
+,<0.315275,-0.0797952,0.388959>
+,<-0.273798,-0.145203,0.405789>
+,<0.191221,-0.0203406,0.484335>
+,<0.236259,-0.304505,0.329527>
+,<0.32479,-0.344019,0.17123>
+,<0.31299,0.359488,-0.202594>
+,<0.316118,0.140116,0.361224>
+,<0.305914,-0.398728,-0.0124384>
+,<0.495686,0.0540845,-0.111463>
+,<0.385481,-0.326486,-0.0793944>
+,<0.388542,-0.31539,0.0248029>
+,<0.385965,-0.320317,0.0144788>
+,<0.378778,-0.326488,0.0283822>
+,<0.373716,-0.330782,0.0377232>
+,<0.363083,-0.339387,0.0568791>
+,<0.35614,-0.344628,0.0689638>
+,<0.35176,-0.34781,0.0764477>
+,<0.376057,-0.328807,0.0334154>
+,<0.457752,-0.117171,-0.169923>
+,<0.45901,-0.157828,-0.137181>
+,<0.389646,0.0238182,0.314184>
+,<0.35239,-0.0490503,0.357106>
+,<0.347815,-0.310771,0.184313>
+,<-0.455544,-0.0962327,0.238944>
+,<0.346268,-0.0515424,0.363314>
+,<0.318817,0.135127,0.360711>
+,<0.358085,-0.0467198,0.351285>
+,<0.431535,-0.0707854,0.253289>
+,<0.445004,0.069089,0.223481>
+,<0.380791,-0.315481,0.0766182>
+,<0.215993,-0.397707,0.212585>
+,<0.267466,-0.42516,0.0716174>
+,<0.369816,-0.334016,0.0448227>
+,<0.371711,-0.332455,0.0413787>
+,<0.36475,-0.338086,0.0539154>
+,<0.366377,-0.336796,0.0510151>
+,<0.36314,-0.339345,0.0567671>
+,<0.361515,-0.340598,0.0596254>
+,<0.359843,-0.34187,0.0625466>
+,<0.358088,-0.343187,0.0655915>
+,<0.35621,-0.344579,0.0688319>
+,<0.354154,-0.346083,0.0723569>
+,<0.351849,-0.347749,0.0762848>
+,<0.349198,-0.349644,0.0807803>
+,<0.346052,-0.351868,0.0860864>
+,<0.342185,-0.354577,0.0925813>
+,<0.337213,-0.358029,0.100896>
+,<0.330448,-0.362692,0.112171>
+,<0.333997,-0.330897,0.176458>
+,<0.190018,-0.417429,0.199205>
+,<0.31803,-0.0920256,0.381775>
+,<0.0993931,0.0864797,0.49241>
+,<-0.394064,-0.265514,-0.191226>
+,<0.333701,-0.166764,0.336533>
+,<0.319031,-0.0966552,0.379079>
+,<-0.0210376,0.138273,0.497968>
+,<-0.313881,-0.403127,-0.000915437>
+,<-0.0351884,-0.153856,0.484569>
+,<0.215401,-0.450464,-0.0300997>
+,<0.106329,-0.487484,0.133624>
+,<0.156224,-0.382354,0.281817>
+,<-0.181699,-0.340845,0.349034>
+,<-0.267286,-0.212757,-0.413146>
+,<0.194746,-0.413463,0.20279>
+,<0.0383634,-0.120086,0.492937>
+,<0.0215735,-0.410004,0.304337>
+,<-0.0497321,-0.221491,0.453141>
+,<0.244017,-0.36125,0.250252>
+,<0.400551,-0.201219,-0.22944>
+,<0.479443,-0.17077,-0.0440339>
+,<0.386777,-0.320056,0.00736761>
+,<0.382051,-0.323671,0.0222971>
+,<0.394956,-0.303024,0.0487279>
+,<0.397141,-0.29851,0.0572874>
+,<0.360045,-0.352513,-0.1066>
+,<-0.188602,-0.472254,0.038012>
+,<0.419337,-0.263113,0.0705719>
+,<0.411981,0.240064,-0.161817>
+,<0.498606,-0.11252,-0.00479076>
+,<0.459908,-0.123666,0.196238>
+,<0.464431,0.116562,0.15594>
+,<0.267817,0.400647,0.133415>
+,<0.405789,0.181823,-0.230429>
+,<0.0325272,0.498973,-0.00364926>
+,<0.47424,0.0883082,-0.162838>
+,<0.411061,0.18214,-0.221171>
+,<0.405248,-0.301087,-0.0656992>
+,<0.370445,-0.341966,-0.0955244>
+,<0.461175,-0.213188,-0.0456911>
+,<0.393057,-0.306782,0.0415136>
+,<0.451709,-0.228587,-0.0492073>
+,<0.398152,-0.311748,-0.0681261>
+,<0.382185,-0.323558,0.0220353>
+,<0.378886,-0.326397,0.0281691>
+,<0.376148,-0.328732,0.0332353>
+,<0.373795,-0.330717,0.0375662>
+,<0.344351,-0.361304,0.035808>
+,<0.454023,0.0628394,0.209232>
+,<0.468569,0.0285651,0.188194>
+,<0.362521,0.258788,0.256901>
+,<0.444989,0.236441,-0.0263328>
+,<0.291783,-0.205514,0.350835>
+,<0.168955,-0.099491,0.484222>
+,<0.11161,0.0811557,0.491544>
+,<-0.23593,0.365114,-0.247655>
+,<0.17342,-0.200614,0.43621>
+,<0.423764,0.0833494,0.255922>
+,<0.436194,0.0671367,-0.24116>
+,<-0.526447,-0.057787,0.0983651>
+,<0.333351,-0.164136,0.338055>
+,<0.248165,-0.310433,0.314071>
+,<-0.225366,0.372635,-0.247456>
+,<0.38029,0.167611,0.284976>
+,<0.312727,-0.0650271,0.396698>
+,<0.408849,0.113526,0.266645>
+,<0.368734,-0.0423271,0.34027>
+,<0.323197,-0.0608413,0.386365>
+,<0.390098,0.0341447,0.312692>
+,<0.320468,0.130239,0.361027>
+,<0.39804,-0.0442368,0.304556>
+,<0.387381,-0.0156243,0.319489>
+,<0.365092,0.0684909,0.335241>
+,<0.288089,0.118433,0.391197>
+,<0.141514,0.196121,0.437796>
+,<-0.19577,-0.0509948,0.473341>
+,<0.4184,0.0943711,0.259876>
+,<0.453945,-0.13666,0.198832>
+,<0.33954,-0.0542677,0.370087>
+,<0.373909,-0.0401747,0.33485>
+,<0.453502,-0.0886381,0.218174>
+,<0.409421,-0.0531309,0.287564>
+,<0.4633,-0.093695,0.202291>
+,<0.44493,-0.234246,-0.00560526>
+,<0.420328,-0.201966,0.215009>
+,<0.394072,-0.304789,0.0453481>
+,<0.328066,-0.380997,-0.0635521>
+,<0.187679,0.457238,-0.0947639>
+,<0.414884,0.189217,0.20783>
+,<0.363898,0.318342,0.1803>
+,<0.327047,0.364153,-0.174585>
+,<0.436972,0.158224,0.185853>
+,<0.0227021,0.486616,-0.156639>
+,<0.364716,-0.261126,-0.234237>
+,<0.361959,-0.350585,-0.104548>
+,<0.442452,0.162415,-0.177607>
+,<0.190322,0.456063,-0.094965>
+,<0.394858,-0.316666,-0.0692328>
+,<0.289098,-0.410889,0.0249688>
+,<0.392416,-0.319241,-0.0718827>
+,<0.474553,0.0774942,0.15909>
+,<0.468764,0.0383414,0.186977>
+,<0.439124,0.155063,0.183591>
+,<0.472793,0.103587,0.146601>
+,<0.488774,-0.103943,0.0844616>
+,<0.417456,0.182495,-0.209769>
+,<-0.0662686,0.404212,-0.329391>
+,<0.360424,0.374013,-0.107533>
+,<0.421401,0.182702,-0.202664>
+,<0.475231,-0.0562767,-0.145128>
+,<0.458369,0.125922,0.162674>
+,<0.21542,0.444606,-0.0971632>
+,<0.426136,0.138953,0.222487>
+,<0.295768,0.128566,0.382091>
+,<0.160747,0.403096,0.255208>
+,<0.40833,0.181979,-0.225984>
+,<0.44391,0.147944,0.178492>
+,<0.365682,0.3726,-0.0883174>
+,<0.456685,0.172215,-0.108761>
+,<0.165312,0.467056,-0.0927776>
+,<0.319893,0.361794,-0.18889>
+,<0.362157,0.373544,-0.10129>
+,<-0.0366012,0.245563,0.45463>
+,<0.158638,0.443384,0.18767>
+,<0.486663,-0.00691485,-0.124272>
+,<0.436489,0.277873,0.028479>
+,<0.392606,-0.307686,0.0396567>
+,<0.445749,-0.238179,-0.0513881>
+,<0.378214,-0.334004,-0.0872148>
+,<0.278068,-0.418291,0.0488893>
+,<0.311836,-0.394146,-0.0259344>
+,<0.429886,-0.149214,-0.224553>
+,<0.352469,-0.36014,-0.114581>
+,<0.273261,-0.421427,0.0592171>
+,<0.300449,-0.402819,-0.000132673>
+,<0.395745,-0.301421,0.0517842>
+,<0.399413,-0.293549,0.0664003>
+,<0.473725,0.0897604,-0.162968>
+,<0.432057,-0.139008,-0.2281>
+,<0.349893,-0.285096,-0.235957>
+,<0.435169,-0.0841327,-0.239404>
+,<0.408507,-0.0993482,-0.282189>
+,<0.357973,-0.272066,-0.235031>
+,<0.492273,-0.132399,-0.0181568>
+,<0.426114,0.200132,-0.177359>
+,<0.387673,-0.319744,-0.000666084>
+,<0.38704,-0.319948,0.00521754>
+,<0.464133,-0.165293,-0.111856>
+,<0.458917,-0.215596,-0.035824>
+,<0.404313,0.0548027,0.289894>
+,<0.479042,0.0748672,-0.161494>
+,<0.44261,-0.0590222,-0.228935>
+,<0.343747,-0.189917,-0.309469>
+,<0.418079,-0.170416,-0.226606>
+,<0.215173,-0.449267,-0.0465291>
+,<0.396634,-0.207963,-0.230028>
+,<0.35495,-0.168619,-0.309163>
+,<0.311895,-0.376858,-0.193517>
+,<0.510346,-0.00667079,-0.0235105>
+,<0.0996468,-0.402728,-0.285392>
+,<0.365097,-0.147759,-0.308661>
+,<0.353898,-0.170929,-0.309096>
+,<0.345437,-0.169849,-0.319301>
+,<0.368706,-0.0591238,-0.347726>
+,<0.317416,0.258935,-0.296795>
+,<0.209875,0.289658,0.35999>
+,<0.262554,0.375219,0.20988>
+,<0.414981,0.182396,-0.214174>
+,<0.404045,0.181746,-0.233432>
+,<0.351855,0.372113,-0.124276>
+,<0.381044,0.234334,0.239671>
+,<0.414065,0.18231,-0.215836>
+,<0.426151,0.182942,-0.194057>
+,<0.352702,0.37237,-0.122559>
+,<0.201383,0.451063,-0.0959583>
+,<0.293039,0.407248,-0.103591>
+,<0.238717,0.426906,0.105285>
+,<0.0359407,0.369096,0.343417>
+,<-0.255286,-0.134105,0.421266>
+,<0.412428,0.136992,-0.248066>
+,<0.359267,0.0671759,0.341501>
+,<0.164986,0.0694076,0.482647>
+,<-0.0486629,0.277079,0.435657>
+,<0.300392,0.0229857,0.40278>
+,<0.0383004,0.400136,0.299472>
+,<0.261554,0.422634,-0.101017>
+,<0.0780927,0.0957418,0.493782>
+,<-0.251962,-0.416382,0.119605>
+,<-0.212098,0.190794,-0.434103>
+,<0.0573174,0.104729,0.494943>
+,<-0.00314564,0.130661,0.497422>
+,<0.010394,0.124872,0.496965>
+,<0.0354247,0.114152,0.495981>
+,<-0.250075,0.355032,-0.247832>
+,<-0.542778,-0.0668544,0.0354543>
+,<0.381116,-0.259467,0.203296>
+,<0.137947,0.422568,-0.237362>
+,<0.161931,-0.408478,0.239245>
+,<-0.241577,-0.448892,0.0303777>
+,<-0.286933,-0.37726,-0.169275>
+,<-0.190475,-0.431893,-0.166086>
+,<-0.206644,0.0472374,0.471329>
+,<-0.34502,-0.317763,-0.182743>
+,<-0.37446,-0.301313,0.147519>
+,<-0.298715,0.316838,-0.247182>
+,<-0.27396,0.334802,-0.250718>
+,<0.0140419,0.125464,-0.493422>
+,<-0.289668,0.324215,-0.247441>
+,<-0.280039,0.332059,-0.247667>
+,<-0.113697,-0.221975,-0.466218>
+,<-0.389884,0.134882,-0.326019>
+,<0.343005,-0.173155,0.323242>
+,<0.308066,0.0824448,0.385397>
+,<0.172179,-0.178344,0.447306>
+,<0.147162,-0.302193,0.387889>
+,<0.249539,-0.361218,0.245256>
+,<-0.0883261,-0.260856,0.424853>
+,<0.178248,-0.0854005,0.483896>
+,<0.316525,-0.0855029,0.385645>
+,<0.355143,0.10924,0.335571>
+,<0.296796,-0.0582087,0.411619>
+,<0.313369,-0.0715685,0.393812>
+,<-0.167619,-0.441837,0.165355>
+,<-0.241073,-0.385168,-0.216042>
+,<0.165966,-0.290304,0.391331>
+,<0.170718,-0.153345,0.459535>
+,<0.316061,0.395899,-0.10546>
+,<0.11557,0.223208,0.432377>
+,<0.323778,-0.117988,0.366377>
+,<0.197988,-0.0381802,0.483381>
+,<0.404212,0.122589,0.269789>
+,<0.208291,0.447901,-0.0965536>
+,<0.413452,0.104374,0.26343>
+,<0.387435,0.320553,0.113232>
+,<0.0677401,0.100226,0.494383>
+,<0.20068,0.142623,0.442639>
+,<0.401346,-0.0468241,0.299665>
+,<0.409644,0.062451,0.280894>
+,<0.364217,0.197112,0.294737>
+,<0.394746,0.0414539,0.305345>
+,<0.392332,0.0381452,0.309132>
+,<0.379119,-0.0379959,0.32935>
+,<0.331964,-0.0573222,0.37766>
+,<0.20676,-0.289604,0.367088>
+,<0.0256701,-0.00678241,0.499695>
+,<0.255704,0.259964,0.359916>
+,<0.30479,-0.193696,0.346632>
+,<0.362399,0.0694405,0.337907>
+,<0.124633,0.214002,0.434404>
+,<0.0885741,0.09119,0.493129>
+,<0.294697,0.131575,0.381898>
+,<-0.403799,0.302686,0.124509>
+,<-0.375724,0.116193,0.323286>
+,<0.130945,0.255706,0.409572>
+,<0.123936,0.0757624,0.49062>
+,<0.134669,0.203388,0.436524>
+,<0.308203,0.0844558,0.384842>
+,<0.313863,0.0897347,0.378831>
+,<0.253366,0.252422,0.365024>
+,<0.134198,0.388308,0.287513>
+,<-0.00422821,0.131113,0.497459>
+,<-0.0528384,0.288033,0.428942>
+,<0.206274,0.14925,0.437331>
+,<0.290783,0.00216701,0.413413>
+,<0.216743,0.161676,0.427259>
+,<0.217741,-0.392299,0.220742>
+,<0.332227,-0.158441,0.341634>
+,<0.327759,-0.136588,0.355143>
+,<0.33598,-0.168177,0.333402>
+,<0.242315,-0.307528,0.32169>
+,<0.383953,-0.220549,0.247627>
+,<0.183378,-0.392506,0.24997>
+,<0.314685,-0.064221,0.394774>
+,<0.324814,-0.0601707,0.384767>
+,<0.333345,-0.0567452,0.376287>
+,<0.340753,-0.0537568,0.368872>
+,<0.347361,-0.0510785,0.362212>
+,<0.353398,-0.0486194,0.356081>
+,<0.359034,-0.0463112,0.350312>
+,<0.364406,-0.0440994,0.34477>
+,<0.369628,-0.0419376,0.339339>
+,<0.374802,-0.0397835,0.333913>
+,<0.380027,-0.0375957,0.328388>
+,<0.385409,-0.0353298,0.322652>
+,<0.427357,-0.252951,0.0587885>
+,<0.426302,-0.0665697,0.261528>
+,<0.388208,0.0377601,0.314376>
+,<0.394071,-0.0411669,0.310374>
+,<0.386758,-0.0250729,0.320686>
+,<0.38804,-0.00552022,0.318161>
+,<0.389556,0.0223554,0.314416>
+,<0.421676,0.0801908,0.259695>
+,<0.326207,0.101812,0.36503>
+,<0.365243,0.195244,0.294118>
+,<0.402565,0.05233,0.29278>
+,<0.418595,0.0756011,0.265211>
+,<0.382216,0.0458931,0.319984>
+,<0.305694,0.0574308,0.392376>
+,<0.379723,0.0492488,0.322284>
+,<0.389297,0.0170853,0.315154>
+,<0.38789,-0.00759267,0.318456>
+,<0.388319,-0.000556727,0.317537>
+,<0.375294,0.0551613,0.326311>
+,<0.350766,0.0610599,0.351108>
+,<0.319755,0.132629,0.360796>
+,<0.0888308,0.381334,0.312649>
+,<0.0655184,0.334836,0.369516>
+,<0.354795,0.146133,0.324033>
+,<0.324329,0.12797,0.3584>
+,<0.357325,0.099743,0.335878>
+,<0.349135,0.0598947,0.352914>
+,<0.353916,0.0348819,0.352033>
+,<0.391363,-0.318261,-0.035262>
+,<0.368718,-0.343722,-0.0973888>
+,<0.456129,0.177766,-0.101726>
+,<0.492198,0.0584238,-0.122452>
+,<0.433745,-0.234492,0.0856527>
+,<0.417018,0.226168,-0.167286>
+,<0.396914,0.0444423,0.301911>
+,<0.457705,0.161468,-0.121945>
+,<0.406534,-0.273106,0.105279>
+,<0.424222,0.0830555,0.255242>
+,<0.429586,-0.236711,0.102194>
+,<0.347884,0.261715,0.281581>
+,<0.396467,-0.299929,0.0546129>
+,<0.401671,-0.28817,0.0763326>
+,<0.396896,-0.299066,0.0561225>
+,<0.397782,-0.297134,0.0598682>
+,<0.38606,-0.320023,0.0157516>
+,<0.423477,-0.273255,-0.0593658>
+,<0.434529,-0.256006,-0.0554421>
+,<0.411717,-0.291289,-0.0634693>
+,<0.45809,-0.218229,-0.0468528>
+,<0.389892,-0.318883,-0.0212261>
+,<0.440064,-0.247251,-0.0534511>
+,<0.39097,-0.320753,-0.0734755>
+,<0.383977,-0.328043,-0.0810394>
+,<0.376619,-0.33564,-0.0889478>
+,<0.350403,-0.362096,-0.116961>
+,<0.282187,-0.415566,0.039998>
+,<0.29499,-0.406768,0.0120115>
+,<0.303154,-0.400811,-0.00620596>
+,<0.375671,-0.243185,-0.232892>
+,<0.496934,0.0525425,-0.107484>
+,<0.488733,0.0626703,-0.133209>
+,<0.380126,-0.0723563,-0.329289>
+,<0.413209,-0.179067,-0.227424>
+,<0.380339,-0.235457,-0.232292>
+,<0.308485,-0.351164,-0.240474>
+,<0.389807,-0.083694,-0.313354>
+,<0.457713,-0.00320875,-0.205027>
+,<0.466299,0.0673736,-0.188379>
+,<0.392733,-0.214627,-0.230597>
+,<-0.0182909,-0.338463,-0.374472>
+,<0.33059,-0.214005,-0.308917>
+,<0.356197,-0.16605,-0.309135>
+,<0.341785,-0.170733,-0.322908>
+,<-0.126137,0.494623,0.0518998>
+,<0.204493,0.331059,-0.32575>
+,<0.423526,-0.160671,-0.22567>
+,<0.40456,-0.194261,-0.22882>
+,<0.388771,-0.22134,-0.231156>
+,<0.370526,-0.251641,-0.233533>
+,<0.339837,-0.301227,-0.237082>
+,<0.305023,-0.399404,-0.0104827>
+,<0.058582,-0.346529,-0.359338>
+,<0.21564,-0.451807,-0.00357062>
+,<0.326713,-0.32218,-0.238518>
+,<0.38467,-0.228234,-0.231717>
+,<0.408745,-0.186938,-0.228154>
+,<0.429794,-0.149382,-0.224567>
+,<0.484312,0.106166,0.110155>
+,<0.493421,0.0569347,-0.118607>
+,<0.457336,-0.155456,-0.145136>
+,<0.265941,0.2481,-0.348128>
+,<0.428711,-0.123281,-0.242159>
+,<0.43958,-0.144004,-0.206991>
+,<0.472,-0.0686127,-0.150248>
+,<0.415805,-0.23012,-0.156689>
+,<0.088214,0.435728,0.230379>
+,<0.149376,0.187783,0.439142>
+,<0.035126,0.315114,-0.405963>
+,<-0.0817992,0.0438597,-0.494699>
+,<0.396337,0.137669,0.274944>
+,<0.0193853,0.349319,0.369476>
+,<-0.0640818,0.369391,0.339447>
+,<0.0395091,0.343028,0.369521>
+,<0.190557,0.326755,0.330471>
+,<0.156667,0.470777,-0.0919995>
+,<0.165017,0.411764,0.2401>
+,<0.170223,0.364295,0.299276>
+,<0.136522,0.070234,0.489632>
+,<0.140733,0.309859,0.36815>
+,<0.324146,0.0996225,0.367454>
+,<0.150522,0.460936,0.149623>
+,<0.310078,0.145919,0.364224>
+,<0.230998,0.437298,-0.09848>
+,<0.180617,0.46037,-0.0941415>
+,<0.320509,0.36199,-0.187677>
+,<0.424435,0.176089,0.198582>
+,<0.401026,0.181514,-0.238657>
+,<0.469608,0.101178,-0.1641>
+,<0.319493,-0.266855,0.279469>
+,<0.334615,0.366615,-0.159347>
+,<0.40908,0.182057,-0.22464>
+,<0.397026,0.181269,-0.245435>
+,<-0.39249,0.281783,-0.167201>
+,<-0.241129,0.435755,0.117892>
+,<0.271666,0.266129,-0.333038>
+,<0.306198,0.357189,-0.215979>
+,<0.328609,0.240569,-0.297163>
+,<0.378603,0.179781,-0.275744>
+,<0.292425,0.352435,-0.242827>
+,<0.0741793,0.252657,-0.44023>
+,<0.339326,0.0313679,-0.390859>
+,<0.38871,0.18061,-0.25931>
+,<0.401683,0.181591,-0.237504>
+,<0.427701,0.183059,-0.191204>
+,<0.468426,0.0228577,0.188925>
+,<0.465118,0.113538,-0.165285>
+,<0.398703,0.181355,-0.242619>
+,<0.392149,0.18091,-0.253601>
+,<0.433011,-0.143553,-0.223991>
+,<0.368502,0.178909,-0.291915>
+,<0.253692,0.210268,-0.378887>
+,<0.300137,-0.111309,-0.392742>
+,<0.0238071,0.322158,-0.401313>
+,<0.277462,0.347142,-0.271581>
+,<0.299387,0.354853,-0.229305>
+,<0.385746,0.180373,-0.264166>
+,<0.374072,0.179393,-0.283021>
+,<-0.324116,-0.339393,-0.179014>
+,<0.1631,-0.388801,0.268781>
+,<-0.379417,-0.281241,-0.188714>
+,<0.168174,0.273453,0.385994>
+,<-0.144391,0.46477,0.187659>
+,<0.0372928,0.422563,0.266157>
+,<0.067989,0.2764,-0.428158>
+,<0.169807,0.365,0.298679>
+,<0.313341,0.344508,0.206377>
+,<-0.0251116,0.437026,-0.275089>
+,<-0.233466,0.341027,0.288447>
+,<-0.37653,0.260856,-0.233904>
+,<-0.124928,0.321166,-0.384015>
+,<-0.369133,0.161627,-0.341029>
+,<0.181842,0.434736,-0.16834>
+,<0.495887,0.128374,0.047522>
+,<0.412087,-0.275802,0.0642279>
+,<0.452159,-0.0875674,0.220334>
+,<0.43755,-0.0756514,0.243749>
+,<0.440114,-0.166331,0.204651>
+,<0.200107,0.288457,0.36531>
+,<0.463139,-0.0965507,0.202591>
+,<0.407602,-0.209299,0.228069>
+,<0.463328,-0.116191,0.194708>
+,<0.427785,-0.252732,0.0565041>
+,<0.441405,-0.229709,0.0524882>
+,<0.440576,-0.23029,0.056323>
+,<0.448903,-0.22392,0.0157335>
+,<0.481168,0.10045,0.126014>
+,<0.422258,-0.258926,0.0687699>
+,<0.423146,-0.226179,0.158594>
+,<0.396429,-0.288014,0.101503>
+,<0.411562,-0.275794,0.067499>
+,<0.422336,-0.236028,0.140289>
+,<0.414972,-0.26992,0.0704268>
+,<0.402871,-0.284658,0.0837307>
+,<0.403469,-0.279309,0.100124>
+,<0.401392,-0.288894,0.0749111>
+,<0.40215,-0.287044,0.0782604>
+,<0.400042,-0.2921,0.0690644>
+,<0.400696,-0.290562,0.0718772>
+,<0.398404,-0.295771,0.0624077>
+,<0.39902,-0.294397,0.0649554>
+,<0.398796,-0.294942,0.0638252>
+,<0.398179,-0.296308,0.061287>
+,<0.39755,-0.297674,0.0587362>
+,<0.395454,-0.302048,0.0504753>
+,<0.396203,-0.300512,0.0533906>
+,<0.393692,-0.305568,0.0437392>
+,<0.394627,-0.303715,0.0472945>
+,<0.390399,-0.311889,0.0316215>
+,<0.389699,-0.31324,0.0288776>
+,<0.391308,-0.310183,0.0348209>
+,<0.386207,-0.320223,0.0125573>
+,<0.387613,-0.317156,0.0212331>
+,<0.388692,-0.319362,-0.0100045>
+,<0.389032,-0.319211,-0.0129362>
+,<0.387967,-0.319618,-0.00313796>
+,<0.391873,-0.318016,-0.0399099>
+,<0.390298,-0.318695,-0.0248343>
+,<0.399727,-0.309393,-0.067567>
+,<0.393945,-0.31708,-0.0600757>
+,<0.413033,-0.289291,-0.062993>
+,<0.406672,-0.298942,-0.0651889>
+,<0.424672,-0.271409,-0.0589251>
+,<0.418987,-0.280182,-0.0609209>
+,<0.435701,-0.254163,-0.0550021>
+,<0.430207,-0.262792,-0.0569648>
+,<0.446992,-0.236191,-0.0509147>
+,<0.441259,-0.245356,-0.052999>
+,<0.463911,-0.207342,-0.0469221>
+,<0.453027,-0.226458,-0.0487014>
+,<0.459521,-0.215899,-0.0463005>
+,<0.469031,-0.196311,-0.0492008>
+,<0.427256,-0.255932,0.0443269>
+,<0.475822,-0.181197,-0.0510834>
+,<0.479199,0.0969768,0.135656>
+,<0.423608,-0.21993,0.170138>
+,<0.45628,0.176203,-0.103776>
+,<0.405968,0.256276,-0.155366>
+,<0.461445,0.12353,-0.166242>
+,<0.456466,0.174382,-0.106071>
+,<0.390018,0.0326772,0.312932>
+,<0.389009,0.0115997,0.315909>
+,<0.415969,0.0717108,0.269873>
+,<0.37324,0.0578781,0.328149>
+,<0.377438,0.0523083,0.324372>
+,<0.371232,0.0605175,0.329925>
+,<0.389879,0.0289703,0.313446>
+,<0.389114,0.0131759,0.315668>
+,<0.388802,0.00745904,0.316444>
+,<0.388449,0.00129064,0.317267>
+,<0.387557,-0.0132346,0.319156>
+,<0.397501,-0.043837,0.305346>
+,<0.412744,-0.0557726,0.282511>
+,<0.430772,-0.0701901,0.254491>
+,<0.44362,-0.0806055,0.234052>
+,<0.507729,0.0694471,-0.0103671>
+,<0.431384,-0.184653,0.208234>
+,<0.425046,-0.197814,0.210757>
+,<0.31606,-0.183286,0.342778>
+,<0.471625,0.0639795,0.173145>
+,<0.436662,-0.0749538,0.245158>
+,<0.425626,-0.0660466,0.262584>
+,<0.416749,-0.05895,0.276372>
+,<0.408895,-0.0527344,0.288358>
+,<0.393506,-0.0407497,0.311194>
+,<0.389273,-0.0374943,0.317337>
+,<0.386092,-0.0350437,0.321918>
+,<0.389877,-0.0379387,0.316467>
+,<0.401871,-0.0472151,0.298889>
+,<0.405641,-0.0501609,0.293261>
+,<0.417321,-0.0593858,0.275495>
+,<0.413287,-0.0561841,0.281685>
+,<0.44469,-0.0814519,0.232343>
+,<0.46618,-0.039605,0.196257>
+,<0.465582,-0.0519033,0.197642>
+,<0.442633,-0.160958,0.203628>
+,<0.283448,-0.212875,0.353425>
+,<0.438098,-0.231944,0.0673534>
+,<0.392841,0.29079,-0.141468>
+,<0.464515,-0.113393,0.194257>
+,<0.459579,0.0589506,0.200358>
+,<0.449242,0.0661636,0.216813>
+,<0.441149,0.0717303,0.229497>
+,<0.434142,0.0764746,0.240293>
+,<0.427539,0.0808732,0.250288>
+,<0.411575,0.0652579,0.277566>
+,<0.466263,0.0542436,0.189612>
+,<0.496542,0.125386,0.0445698>
+,<0.468187,0.0136081,0.190054>
+,<0.438997,0.16923,-0.17963>
+,<0.471796,-0.110874,0.162807>
+,<0.500653,0.105926,0.0254261>
+,<0.468414,0.0526863,0.186152>
+,<0.461323,0.057691,0.197572>
+,<0.455493,0.0617811,0.206901>
+,<0.450521,0.0652459,0.214799>
+,<0.446149,0.0682712,0.221693>
+,<0.4422,0.0709837,0.22787>
+,<0.438546,0.0734742,0.233539>
+,<0.435089,0.0758111,0.238855>
+,<0.43175,0.0780494,0.243943>
+,<0.428462,0.0802358,0.248911>
+,<0.42516,0.082413,0.253854>
+,<0.41366,0.0683105,0.273933>
+,<0.406052,0.0572808,0.28699>
+,<0.398906,0.0472051,0.298725>
+,<0.420272,0.0202432,0.270855>
+,<0.0273247,0.499308,-0.00935394>
+,<0.461814,0.122518,-0.166157>
+,<0.31359,0.359681,-0.201421>
+,<0.306794,0.357383,-0.214823>
+,<0.342797,0.369242,-0.14276>
+,<0.327693,0.364355,-0.173305>
+,<0.343552,0.369473,-0.141239>
+,<0.335306,0.366829,-0.157967>
+,<0.13585,0.479613,-0.0901081>
+,<0.276747,0.391852,0.142079>
+,<-0.0958854,0.408021,0.280762>
+,<0.146986,0.474906,-0.0911227>
+,<0.433577,-0.234601,0.0862842>
+,<0.46552,0.112425,-0.16519>
+,<0.459327,0.143202,-0.144215>
+,<0.474586,0.0675676,-0.173444>
+,<0.475903,-0.0535821,-0.143999>
+,<0.469238,0.198071,0.0387549>
+,<0.426688,0.172945,0.196348>
+,<0.238009,0.203752,0.397452>
+,<0.46088,0.12505,-0.166388>
+,<0.422655,0.182804,-0.200367>
+,<0.418511,0.182587,-0.207846>
+,<0.411879,0.182221,-0.219695>
+,<0.406492,0.1819,-0.229178>
+,<0.399359,0.181433,-0.241479>
+,<0.389499,0.180706,-0.257987>
+,<0.391419,0.180821,-0.254837>
+,<0.132858,-0.181508,-0.464448>
+,<-0.0852673,0.0291013,-0.495022>
+,<0.140632,0.316944,-0.367865>
+,<-0.0136801,0.345242,-0.385606>
+,<-0.0570522,0.371519,-0.36699>
+,<0.285172,0.349885,-0.256816>
+,<0.155847,0.320436,-0.358039>
+,<0.310329,0.270471,-0.296527>
+,<0.382425,0.180101,-0.26957>
+,<0.393948,0.181012,-0.250628>
+,<0.396359,0.181189,-0.246583>
+,<0.394639,0.181096,-0.249448>
+,<0.386617,0.180478,-0.262718>
+,<0.38341,0.180218,-0.267945>
+,<0.37975,0.179914,-0.27387>
+,<0.375449,0.17955,-0.280787>
+,<0.37022,0.179099,-0.289147>
+,<0.345292,0.212666,-0.297516>
+,<0.337518,0.225764,-0.297387>
+,<0.307323,0.275299,-0.296441>
+,<0.199845,0.17409,-0.428386>
+,<0.368528,0.0650587,-0.349704>
+,<0.0150267,-0.342181,-0.368207>
+,<-0.292364,0.404138,0.106666>
+,<-0.169979,0.391338,-0.274142>
+,<0.232858,-0.342931,-0.332179>
+,<0.176536,0.32507,-0.344443>
+,<-0.0502737,0.1117,-0.492653>
+,<0.202148,0.330584,-0.327314>
+,<0.0465061,0.307995,-0.410594>
+,<0.000474451,0.336562,-0.391595>
+,<-0.0272896,0.353532,-0.379807>
+,<0.095557,0.444376,-0.224383>
+,<0.16557,0.407792,-0.245595>
+,<0.278162,0.347383,-0.27026>
+,<0.285824,0.350106,-0.255576>
+,<0.293046,0.352643,-0.241639>
+,<0.299989,0.355052,-0.228144>
+,<0.38169,0.223987,-0.233544>
+,<0.400604,-0.201125,-0.229434>
+,<-0.27843,-0.418037,-0.0636676>
+,<0.509619,-0.018508,-0.0196436>
+,<0.48038,0.0990933,0.129865>
+,<0.479411,0.0738207,-0.161399>
+,<0.479206,0.0735559,-0.161914>
+,<0.469074,0.0673482,-0.183426>
+,<0.392591,0.066458,-0.312156>
+,<0.430125,0.0670364,-0.251449>
+,<0.0920703,-0.100495,-0.497303>
+,<0.423605,-0.160528,-0.225658>
+,<0.418148,-0.170291,-0.226596>
+,<0.413272,-0.178954,-0.227415>
+,<0.408803,-0.186834,-0.228146>
+,<0.404615,-0.194163,-0.228813>
+,<0.396687,-0.207871,-0.230022>
+,<0.392786,-0.214536,-0.230591>
+,<0.388825,-0.221247,-0.23115>
+,<0.384726,-0.228138,-0.231711>
+,<0.3804,-0.235355,-0.232285>
+,<0.375737,-0.243075,-0.232885>
+,<0.3706,-0.251519,-0.233526>
+,<0.3648,-0.260988,-0.234229>
+,<0.358072,-0.271903,-0.235021>
+,<0.350014,-0.284899,-0.235945>
+,<0.339991,-0.300978,-0.237067>
+,<0.326919,-0.321849,-0.238498>
+,<0.308782,-0.35069,-0.240445>
+,<-0.0398712,-0.41811,-0.277801>
+,<0.260937,-0.398858,-0.258273>
+,<-0.007388,-0.415409,-0.280164>
+,<-0.259999,-0.382948,0.200575>
+,<-0.285782,-0.383429,-0.154633>
+,<-0.341132,-0.168358,-0.360867>
+,<-0.276269,0.337929,-0.243906>
+,<-0.0396038,-0.418091,-0.277817>
+,<0.285817,-0.413127,0.0321224>
+,<-0.352895,0.297214,0.209347>
+,<0.104849,0.436062,0.223997>
+,<0.259895,0.342481,-0.287895>
+,<0.369921,-0.13778,-0.308359>
+,<-0.154643,-0.461743,-0.117302>
+,<0.350585,-0.362023,-0.116589>
+,<-0.33959,0.373009,-0.0370641>
+,<-0.249176,0.326158,-0.285734>
+,<-0.0959957,0.438875,-0.228774>
+,<0.0801207,0.229645,-0.451696>
+,<0.0254163,0.438202,0.241786>
+,<-0.503035,0.11147,-0.0304722>
+,<-0.342959,0.294558,0.226735>
+,<-0.0254878,0.352423,-0.380588>
+,<0.144888,0.418902,-0.23945>
+,<0.366571,0.147157,-0.312282>
+,<-0.420186,0.0754277,-0.303841>
+,<0.312167,-0.094226,-0.389004>
+,<0.378129,-0.120761,-0.307826>
+,<0.359508,-0.159267,-0.308983>
+,<0.348977,-0.170071,-0.315176>
+,<0.352099,-0.171206,-0.310996>
+,<0.357681,-0.163012,-0.309074>
+,<0.361865,-0.154423,-0.308853>
+,<0.42645,-0.112925,-0.251324>
+,<0.450041,-0.0327237,-0.21781>
+,<0.482899,0.0697072,-0.150966>
+,<0.489955,0.0612041,-0.129421>
+,<0.504302,-0.0882095,0.00318068>
+,<0.356086,-0.173272,-0.305288>
+,<0.110458,0.196023,0.446961>
+,<-0.0663817,-0.125244,0.486764>
+,<-0.375921,0.181688,-0.316478>
+,<-0.0923009,0.403744,0.287506>
+,<0.131832,0.48461,-0.0370754>
+,<0.444389,-0.0528786,-0.226355>
+,<-0.489293,0.152463,-0.0273283>
+,<-0.0888699,0.399631,0.293931>
+,<-0.134045,-0.0847298,0.481378>
+,<-0.037,0.195803,0.476765>
+,<-0.0368096,0.231516,0.460987>
+,<-0.0197767,0.137747,0.49793>
+,<0.0243281,0.118919,0.496439>
+,<0.0234616,0.119282,0.496475>
+,<0.0113504,0.124472,0.496929>
+,<0.0473812,0.10902,0.495435>
+,<0.0362279,0.113815,0.495944>
+,<0.068463,0.0999215,0.494341>
+,<0.0580517,0.104421,0.494903>
+,<0.12304,0.0761461,0.490691>
+,<0.110786,0.0815071,0.491605>
+,<0.089316,0.0908756,0.49308>
+,<0.100167,0.0861507,0.492355>
+,<0.151733,0.0635494,0.488382>
+,<0.152876,0.0630567,0.488285>
+,<0.137521,0.069805,0.48955>
+,<0.182398,0.107216,0.46297>
+,<0.302384,0.0945502,0.386885>
+,<0.312997,0.0890272,0.379733>
+,<0.220844,0.16658,0.42325>
+,<0.142435,0.195225,0.437921>
+,<0.295457,0.139033,0.378698>
+,<0.345115,0.120558,0.342258>
+,<0.158838,0.399213,0.26189>
+,<0.173439,0.0262057,0.486471>
+,<0.251417,0.156335,0.405763>
+,<0.332732,0.108222,0.357327>
+,<0.322223,0.0979346,0.369591>
+,<0.340045,0.0534971,0.362684>
+,<0.389606,0.150322,0.279208>
+,<0.361486,0.0808148,0.33632>
+,<0.361369,0.208603,0.292431>
+,<0.399165,0.132294,0.273117>
+,<0.154233,0.18256,0.439974>
+,<0.123621,0.386812,0.293502>
+,<0.0518021,0.497025,0.0175813>
+,<0.179922,0.154722,0.444292>
+,<0.239881,0.433073,-0.0992228>
+,<0.0754526,0.435343,0.235198>
+,<-0.0468077,-0.335094,-0.379672>
+,<0.122583,0.436303,0.217094>
+,<-0.04389,0.264492,0.443304>
+,<0.0212946,0.439935,0.239028>
+,<0.37194,0.369063,-0.0688841>
+,<-0.256061,0.306907,0.313954>
+,<0.173221,0.463618,-0.0934847>
+,<0.275543,0.415823,-0.102164>
+,<0.222926,0.441102,-0.0978001>
+,<-0.0222684,0.438716,-0.271996>
+,<0.294923,0.136555,0.379994>
+,<0.348473,0.379843,-0.10808>
+,<-0.103025,0.488797,-0.0679193>
+,<-0.0434019,0.313521,0.409064>
+,<-0.199476,0.389866,0.250076>
+,<0.0500016,-0.409431,-0.283523>
+,<-0.178544,0.39219,-0.265069>
+,<0.136121,-0.433228,0.214184>
+,<0.336728,-0.367525,-0.144454>
+,<-0.323934,0.38395,0.0995406>
+,<0.147953,0.390175,0.279649>
+,<0.353605,0.286994,0.245692>
+,<-0.0122292,-0.0231608,0.499769>
+,<-0.0163186,0.244866,0.450786>
+,<0.00828435,0.44529,0.230265>
+,<0.0233209,0.356976,0.360241>
+,<-0.0753042,0.383177,0.319039>
+,<-0.0861276,0.396358,0.299008>
+,<-0.153599,0.475212,-0.0742317>
+,<-0.239251,0.439119,-0.00315212>
+,<0.10996,0.245405,0.422055>
+,<-0.24205,0.437392,-0.0112013>
+,<0.160669,0.438983,0.196853>
+,<0.332318,0.262343,0.294782>
+,<0.0341311,0.367403,0.345791>
+,<0.162991,0.37704,0.288161>
+,<-0.0217484,-0.139111,0.490248>
+,<0.182557,0.341796,0.318229>
+,<0.127513,0.210894,0.435082>
+,<0.400504,0.208518,0.221466>
+,<0.396126,0.2143,0.225618>
+,<0.411074,0.194364,0.21147>
+,<0.144479,0.192952,0.438325>
+,<0.30773,0.146984,0.365801>
+,<0.0300742,0.363475,0.351253>
+,<0.463083,-0.163692,-0.11722>
+,<0.470079,0.0570911,0.180281>
+,<0.498959,0.0485939,-0.100707>
+,<0.464859,-0.0658773,0.199199>
+,<0.41931,0.183154,0.203594>
+,<0.487229,0.151531,0.0446161>
+,<0.242356,0.423798,0.108767>
+,<0.289006,0.128252,0.387391>
+,<0.359341,0.374454,-0.108912>
+,<0.327021,0.39049,-0.106292>
+,<0.368807,0.371713,-0.0768098>
+,<0.281728,0.412807,-0.102626>
+,<0.301027,0.403328,-0.104193>
+,<0.249908,0.428264,-0.100056>
+,<0.243556,0.431323,-0.0994938>
+,<0.254134,0.426234,-0.100368>
+,<0.225933,0.439696,-0.0980215>
+,<0.234282,0.435748,-0.0987217>
+,<0.210983,0.446668,-0.0967532>
+,<0.218235,0.443302,-0.097371>
+,<0.194556,0.454155,-0.0953656>
+,<0.204007,0.449872,-0.0961542>
+,<0.197165,0.452984,-0.0955619>
+,<0.176098,0.462365,-0.0937092>
+,<0.183348,0.459169,-0.0943516>
+,<0.160075,0.469321,-0.0922735>
+,<0.168408,0.465721,-0.0930228>
+,<0.140311,0.477739,-0.0904787>
+,<0.150831,0.473277,-0.0914369>
+,<0.125642,0.485574,0.0842163>
+,<0.127981,0.482925,-0.0893491>
+,<0.130163,0.484299,-0.0547569>
+,<-0.13956,0.482826,-0.0592068>
+,<0.0301554,0.499131,-0.00624809>
+,<-0.202767,0.352364,-0.295021>
+,<-0.141089,0.482011,-0.0608111>
+,<0.204528,0.456279,-0.0194397>
+,<0.257772,0.355888,-0.272041>
+,<0.379953,0.362157,-0.0485339>
+,<0.447201,0.198818,-0.103975>
+,<0.239778,0.439563,0.00828001>
+,<0.312905,0.401433,-0.0398667>
+,<0.28828,0.380297,0.153439>
+,<0.265991,0.402421,0.131639>
+,<0.170396,0.422665,0.220808>
+,<0.167549,0.369002,0.295211>
+,<0.101959,0.237094,0.429007>
+,<0.392548,0.219098,0.228929>
+,<0.416264,0.187307,0.206537>
+,<0.422,0.179459,0.200974>
+,<0.449893,0.138903,0.172003>
+,<0.432887,0.164149,0.190084>
+,<0.451947,-0.148028,-0.169781>
+,<0.506011,0.0787134,-0.00128689>
+,<0.505967,0.0451262,-0.0703674>
+,<0.459965,0.221218,0.035801>
+,<0.443394,0.261437,0.0306143>
+,<0.45034,0.210493,-0.0600875>
+,<0.449463,0.246851,0.0325025>
+,<0.43087,0.167037,0.192143>
+,<0.434908,0.161231,0.188001>
+,<0.428817,0.16995,0.194217>
+,<0.453688,0.133111,0.167842>
+,<0.422728,-0.231448,0.148821>
+,<0.446695,0.143752,0.175485>
+,<0.485117,0.107603,0.106048>
+,<0.425511,-0.19685,0.210577>
+,<0.465375,0.0284833,-0.191053>
+,<0.477039,-0.0490361,-0.142011>
+,<0.49074,0.118269,0.0761416>
+,<0.48647,0.0654346,-0.140139>
+,<0.508091,-0.0410955,-0.0122575>
+,<0.481608,0.0712131,-0.154856>
+,<0.475954,0.0842106,0.152082>
+,<0.474516,0.0773276,0.159268>
+,<0.449387,-0.144574,-0.18107>
+,<0.446831,-0.144445,-0.187895>
+,<0.469159,0.102432,-0.164209>
+,<0.428452,0.193225,-0.179993>
+,<0.456947,0.169551,-0.112045>
+,<0.445959,0.155433,-0.175527>
+,<0.419342,0.219639,-0.169834>
+,<0.430914,0.185863,-0.182785>
+,<0.360583,0.373972,-0.106955>
+,<0.457273,0.166127,-0.116245>
+,<0.453424,0.14036,-0.171009>
+,<0.431801,0.18322,-0.183757>
+,<0.40914,0.247767,-0.15876>
+,<0.364649,0.363219,-0.111975>
+,<0.447245,0.198829,-0.103744>
+,<0.26664,0.416669,0.0742925>
+,<0.398057,0.277183,-0.146968>
+,<0.414329,0.32388,0.0257042>
+,<0.386219,0.307935,-0.134513>
+,<0.402337,0.265922,-0.151501>
+,<0.414583,0.232926,-0.164633>
+,<0.421603,0.213207,-0.17233>
+,<0.431972,0.182893,-0.183661>
+,<0.449589,0.148139,-0.173345>
+,<0.453798,0.183462,-0.10213>
+,<0.457568,0.131882,-0.168454>
+,<0.377361,0.330716,-0.125241>
+,<0.423846,0.206746,-0.174822>
+,<0.435526,0.176012,-0.181635>
+,<0.447098,0.198695,-0.104717>
+,<0.308785,-0.396525,-0.0189622>
+,<0.136713,0.484644,0.0173408>
+,<0.318844,-0.388556,-0.0420835>
+,<0.283941,-0.387152,-0.245103>
+,<-0.14884,-0.377218,-0.331603>
+,<-0.0807325,0.116316,-0.487009>
+,<-0.380852,-0.302974,0.12694>
+,<0.260883,-0.232494,0.359986>
+,<0.064069,0.376964,0.325812>
+,<-0.208161,-0.232581,-0.454529>
+,<-0.283643,-0.393725,-0.129542>
+,<-0.127269,0.493016,0.0225902>
+,<0.0387463,0.475263,-0.200196>
+,<0.412717,0.192111,0.209937>
+,<0.270049,0.260504,0.347997>
+,<-0.099709,0.412564,0.273537>
+,<-0.019117,0.0109386,0.50031>
+,<0.253989,0.432355,-0.00101576>
+,<0.0503086,0.434168,0.244439>
+,<0.0618323,0.462876,0.178735>
+,<0.141202,0.483532,0.0710089>
+,<0.193985,0.320232,0.335713>
+,<-0.0965629,0.408857,0.279445>
+,<0.378192,0.319781,0.139979>
+,<-0.182765,0.412878,0.231162>
+,<-0.338275,0.293283,0.234842>
+,<-0.47159,0.202897,-0.0234032>
+,<-0.379275,0.30402,0.162191>
+,<-0.391464,0.339434,0.0839493>
+,<-0.0403122,0.361414,-0.374227>
+,<-0.285296,0.277997,0.322995>
+,<0.325648,0.0450865,-0.39651>
+,<0.21508,0.33328,-0.318578>
+,<0.161483,0.321728,-0.354347>
+,<0.0123328,0.32926,-0.396556>
+,<0.151718,0.415265,-0.241491>
+,<0.365551,0.168141,-0.302493>
+,<0.271043,0.264235,-0.334648>
+,<0.123147,0.430284,-0.232871>
+,<0.209343,0.383481,-0.258282>
+,<0.105851,0.439155,-0.227564>
+,<-0.125398,0.495558,0.0704438>
+,<-0.246777,0.357373,-0.247824>
+,<-0.0556273,0.416213,-0.311099>
+,<-0.204222,0.387664,-0.247036>
+,<0.344647,-0.187652,-0.309848>
+,<-0.0832038,0.0141595,-0.495575>
+,<-0.194877,-0.127742,-0.468555>
+,<-0.19131,-0.424923,-0.183295>
+,<-0.268562,-0.434285,0.0108773>
+,<0.324289,-0.225318,-0.308674>
+,<0.288429,-0.287892,0.293606>
+,<0.215504,-0.450729,-0.0253528>
+,<0.39845,-0.211013,0.238911>
+,<-0.204429,0.44793,-0.107509>
+,<-0.406629,-0.256841,-0.18008>
+,<-0.151377,-0.353768,-0.360331>
+,<0.246702,-0.376165,-0.297195>
+,<-0.0192555,-0.541057,0.0608116>
+,<-0.217926,-0.278772,0.373791>
+,<0.0368658,0.431211,0.252682>
+,<-0.30041,-0.363112,-0.174643>
+,<0.0126288,-0.123629,0.494067>
+,<0.16985,-0.138969,0.466478>
+,<-0.25331,0.341568,-0.263288>
+,<-0.228199,-0.387402,-0.227989>
+,<0.315152,-0.391521,-0.0335532>
+,<0.248957,-0.31081,0.313051>
+,<-0.252531,-0.414429,0.124656>
+,<0.226041,-0.384224,0.227141>
+,<0.190818,-0.388886,0.250054>
+,<0.213953,-0.397344,0.215277>
+,<-0.0125021,-0.467937,0.233157>
+,<0.218856,-0.399474,0.206397>
+,<-0.0572392,-0.241628,0.442414>
+,<0.187718,-0.0709945,0.483497>
+,<-0.225679,0.061018,0.457815>
+,<-0.218044,-0.33129,0.337273>
+,<-0.326474,0.0173436,0.379473>
+,<-0.351576,-0.310869,-0.183893>
+,<-0.0439822,-0.194744,0.465848>
+,<-0.310249,-0.353374,-0.176476>
+,<0.198973,-0.413138,0.199356>
+,<-0.175047,0.423386,0.222422>
+,<0.0607194,-0.116981,0.491763>
+,<-0.0549479,-0.240229,0.443669>
+,<0.161924,-0.387829,0.270881>
+,<-0.284264,0.370826,-0.182336>
+,<0.00404539,-0.269805,0.424006>
+,<0.0377719,0.412279,0.281714>
+,<-0.224824,-0.0913423,0.44857>
+,<-0.218995,0.362219,0.272144>
+,<-0.403493,-0.189041,0.242919>
+,<-0.419506,-0.252035,-0.156774>
+,<0.0391666,0.379033,0.329461>
+,<-0.206123,-0.440776,-0.117373>
+,<-0.291809,-0.331232,0.262437>
+,<-0.318362,-0.370214,0.108111>
+,<-0.333849,-0.329397,-0.180764>
+,<-0.363469,0.263905,-0.245206>
+,<-0.284,0.32883,-0.247588>
+,<-0.277013,0.334586,-0.247628>
+,<-0.272579,0.333914,-0.253422>
+,<-0.270813,0.33322,-0.256266>
+,<-0.455451,0.246919,-0.0199279>
+,<-0.104242,0.347898,-0.373153>
+,<-0.428577,0.0869257,0.267516>
+,<-0.0410345,-0.196895,-0.476489>
+,<-0.0731975,-0.208044,-0.472068>
+,<-0.251109,0.348629,-0.255819>
+,<-0.150081,-0.365868,-0.345563>
+,<-0.122861,-0.499642,0.0469413>
+,<0.272571,-0.31764,-0.306664>
+,<0.339215,-0.198332,-0.30928>
+,<0.257125,-0.170947,-0.404808>
+,<0.0882309,-0.349044,-0.352901>
+,<0.0690557,0.457676,-0.216135>
+,<-0.20468,-0.235626,-0.454553>
+,<-0.15276,-0.340592,-0.376293>
+,<-0.154271,-0.32591,-0.393954>
+,<-0.193167,-0.406957,-0.225972>
+,<-0.0213171,-0.497107,-0.134104>
+,<0.0607704,-0.408044,-0.283969>
+,<-0.265322,-0.436063,0.0132594>
+,<0.36069,-0.185753,0.296886>
+,<0.010022,-0.413839,-0.281347>
+,<0.241811,-0.412,-0.239864>
+,<0.292129,-0.408786,0.0183212>
+,<0.321054,-0.373482,-0.175531>
+,<-0.290413,-0.331313,-0.237261>
+,<0.114012,-0.32283,0.381608>
+,<0.0350164,-0.285657,0.412302>
+,<0.3259,0.0437463,0.377127>
+,<0.197557,-0.0559772,0.483015>
+,<0.305618,-0.0623347,0.403404>
+,<0.287192,-0.0537247,0.420494>
+,<0.311983,-0.0653216,0.397429>
+,<0.30677,-0.0628899,0.402324>
+,<0.278022,-0.0494681,0.428905>
+,<0.224984,-0.047726,0.467351>
+,<0.278978,0.131058,0.394073>
+,<0.187065,0.117391,0.457582>
+,<0.252283,0.155519,0.40541>
+,<0.307765,0.0790517,0.386373>
+,<0.195106,-0.0597598,0.483134>
+,<0.185377,-0.0745967,0.483595>
+,<0.175967,-0.0888987,0.483975>
+,<0.170529,-0.150528,0.460908>
+,<0.149923,-0.376373,0.293331>
+,<-0.0706529,-0.415641,0.293785>
+,<0.158842,-0.294837,0.390025>
+,<0.124969,-0.316049,0.383721>
+,<0.115166,-0.452915,0.193796>
+,<-0.174815,0.281264,0.383581>
+,<-0.466681,0.216453,-0.0223374>
+,<0.00148853,-0.0906325,0.496306>
+,<-0.0104914,-0.0317335,0.499457>
+,<0.200659,-0.28399,0.376572>
+,<0.164114,-0.389742,0.266802>
+,<-0.0965154,0.104747,0.492796>
+,<-0.235535,0.0681519,0.450733>
+,<0.0794499,-0.357624,0.35233>
+,<-0.300215,-0.414597,-0.00477292>
+,<-0.294991,-0.36842,-0.173623>
+,<-0.400104,-0.259211,-0.191745>
+,<0.3043,-0.277276,0.286475>
+,<0.253448,-0.238883,0.362078>
+,<0.251475,-0.312062,0.30974>
+,<0.191482,-0.284666,0.382711>
+,<0.129034,-0.107252,0.487235>
+,<-0.194839,-0.0233074,0.47603>
+,<0.0846527,-0.113609,0.49032>
+,<0.175677,-0.24449,0.413722>
+,<0.21536,-0.293973,0.356225>
+,<0.28974,-0.207299,0.351496>
+,<0.213209,-0.396659,0.217267>
+,<0.323844,-0.263831,0.277413>
+,<0.333028,-0.257377,0.273012>
+,<0.229863,-0.301297,0.33775>
+,<0.292709,-0.204647,0.350566>
+,<0.320866,-0.178806,0.341096>
+,<0.333816,-0.166656,0.336491>
+,<0.336319,-0.168431,0.332909>
+,<0.319263,-0.180345,0.341635>
+,<0.300654,-0.197511,0.347982>
+,<0.308183,-0.190579,0.345488>
+,<0.332689,-0.160919,0.340107>
+,<0.331582,-0.155352,0.343593>
+,<0.330486,-0.149922,0.34697>
+,<0.329381,-0.144523,0.350306>
+,<0.328246,-0.139051,0.353666>
+,<0.327057,-0.133395,0.357115>
+,<0.325788,-0.127432,0.360728>
+,<0.324403,-0.121009,0.364594>
+,<0.322861,-0.113934,0.368828>
+,<0.321099,-0.105942,0.373583>
+,<0.27822,-0.176201,0.376759>
+,<-0.304321,-0.411164,-0.00359426>
+,<-0.40567,-0.318806,0.0116828>
+,<0.253063,-0.433902,0.0885531>
+,<0.115762,-0.452366,0.194359>
+,<0.21537,-0.450073,-0.0356658>
+,<0.174557,-0.222099,0.425302>
+,<0.142437,-0.305131,0.387035>
+,<0.167521,-0.101683,0.484262>
+,<0.230245,-0.258722,0.368511>
+,<0.346988,-0.247444,0.26616>
+,<0.198828,-0.285541,0.377075>
+,<0.276156,-0.219267,0.355594>
+,<-0.111505,-0.38875,0.314458>
+,<-0.0712115,-0.250329,0.434579>
+,<-0.0214451,-0.256425,0.433218>
+,<0.153665,-0.379918,0.286544>
+,<-0.305623,0.0765401,0.397403>
+,<-0.26275,-0.376659,0.212155>
+,<0.135948,-0.309214,0.385802>
+,<0.168596,-0.119,0.476044>
+,<-0.26327,-0.15479,0.410115>
+,<-0.0376566,-0.165331,0.479388>
+,<-0.240267,0.428956,-0.116134>
+,<-0.364532,0.357353,0.0901904>
+,<-0.0386492,0.33767,0.385129>
+,<0.0711405,0.241304,0.434076>
+,<-0.0716111,0.378648,0.325797>
+,<0.134658,0.436418,0.212381>
+,<-0.180688,-0.0563908,0.476437>
+,<-0.234259,0.339822,0.289375>
+,<-0.252188,0.429045,0.115503>
+,<-0.0259277,-0.416972,-0.27883>
+,<-0.231369,-0.453521,0.032098>
+,<-0.378195,0.267731,-0.221991>
+,<-0.319489,-0.344093,-0.178173>
+,<-0.302264,-0.361305,-0.174958>
+,<-0.384195,-0.276142,-0.189488>
+,<-0.339181,-0.323863,-0.181712>
+,<-0.0255201,0.0427676,0.500148>
+,<-0.284519,-0.206886,-0.400901>
+,<-0.337276,-0.383166,0.0056508>
+,<-0.490355,-0.0576867,0.200539>
+,<-0.138828,-0.493112,0.0447866>
+,<-0.286902,-0.419693,-0.0304556>
+,<-0.294156,-0.419642,-0.00643367>
+,<-0.0466389,-0.431125,0.281452>
+,<-0.358734,-0.296855,0.195669>
+,<-0.390799,-0.305367,0.0936356>
+,<-0.316068,-0.196,-0.378209>
+,<-0.375327,-0.241555,0.237917>
+,<-0.314896,-0.348724,-0.177333>
+,<-0.359149,-0.302858,-0.185213>
+,<-0.289037,-0.374211,-0.172496>
+,<-0.131001,-0.47233,-0.108697>
+,<-0.310964,-0.130151,0.378486>
+,<0.155019,-0.38121,0.284048>
+,<0.215586,-0.45174,-0.0056309>
+,<-0.0124275,-0.53565,0.00869657>
+,<0.144435,-0.371053,0.303325>
+,<-0.230464,-0.453927,0.0322151>
+,<-0.256692,-0.398155,0.16487>
+,<0.0859812,-0.404631,-0.284912>
+,<0.205402,-0.381474,0.250262>
+,<0.175782,-0.396189,0.249738>
+,<-0.295876,-0.38485,0.121445>
+,<-0.284194,-0.419178,-0.0412042>
+,<-0.152913,-0.487295,0.0428793>
+,<0.260196,-0.429786,0.0871129>
+,<0.109641,-0.479526,-0.147262>
+,<0.303583,-0.373034,0.160259>
+,<0.167652,-0.103586,0.483357>
+,<-0.340976,-0.37997,0.00672832>
+,<-0.199325,-0.328571,0.357579>
+,<0.119704,-0.399908,-0.286072>
+,<-0.189886,-0.436313,-0.154727>
+,<-0.194476,-0.392895,-0.258909>
+,<0.0374664,-0.410956,-0.282937>
+,<-0.220994,-0.388616,-0.234624>
+,<-0.116387,-0.404406,-0.297108>
+,<0.168924,0.32339,-0.349468>
+,<0.28183,0.322295,-0.289543>
+,<-0.241955,0.428293,-0.114181>
+,<0.00715656,-0.341323,-0.369722>
+,<0.0868772,-0.151486,-0.491251>
+,<0.342913,-0.191786,-0.309248>
+,<0.341375,-0.185628,-0.31471>
+,<0.312875,-0.245767,-0.308213>
+,<0.337824,-0.180157,-0.321899>
+,<0.20776,-0.0209258,-0.4553>
+,<-0.260396,0.335007,-0.264867>
+,<-0.315952,0.302761,-0.246665>
+,<0.189109,0.39483,-0.252461>
+,<-0.393971,0.282149,-0.16265>
+,<0.0186743,-0.412996,-0.281893>
+,<-0.0628666,-0.45404,-0.217052>
+,<0.0673453,-0.407169,-0.28423>
+,<-0.19409,-0.396875,-0.249633>
+,<-0.156658,-0.383201,-0.314778>
+,<-0.192652,-0.411938,-0.21428>
+,<-0.0915265,-0.422208,-0.273903>
+,<-0.149518,-0.370803,-0.339519>
+,<-0.150786,-0.35906,-0.3539>
+,<-0.152126,-0.34639,-0.369297>
+,<-0.153575,-0.332414,-0.38616>
+,<-0.136613,-0.324107,-0.395633>
+,<0.0249315,-0.343255,-0.366244>
+,<0.187214,-0.356537,-0.330182>
+,<-0.28802,-0.366324,0.187866>
+,<-0.24294,0.436808,-0.0140581>
+,<-0.268636,0.332892,-0.259037>
+,<-0.0920222,-0.214532,-0.469382>
+,<0.186446,0.327207,-0.337872>
+,<0.303869,0.0668217,-0.405355>
+,<0.2496,0.360545,-0.269775>
+,<0.348995,-0.0230534,-0.379354>
+,<0.29289,0.00936662,-0.414364>
+,<0.222101,0.376258,-0.261925>
+,<0.049188,-0.345638,-0.361339>
+,<-0.123902,-0.225508,-0.464692>
+,<0.109904,-0.166539,-0.477947>
+,<0.337518,-0.201521,-0.309158>
+,<0.341977,-0.185984,-0.313827>
+,<0.342502,-0.19229,-0.309395>
+,<0.341021,-0.195028,-0.30934>
+,<0.339422,-0.183335,-0.318249>
+,<0.285035,-0.295566,-0.307053>
+,<0.329431,-0.215993,-0.308934>
+,<0.337647,-0.179595,-0.322425>
+,<0.0101541,-0.341677,-0.369124>
+,<0.00572645,-0.0358357,-0.4996>
+,<0.244558,-0.372289,-0.302354>
+,<0.0259521,-0.389689,-0.312841>
+,<0.347592,0.0587954,0.35461>
+,<0.330842,0.106356,0.359583>
+,<0.390134,0.0351871,0.312545>
+,<0.354473,0.0637201,0.346953>
+,<0.385397,0.158158,0.281829>
+,<0.393192,0.143602,0.276949>
+,<0.373835,0.179497,0.288917>
+,<0.401767,0.12731,0.271413>
+,<0.406557,0.118025,0.268211>
+,<0.411132,0.109006,0.265062>
+,<0.415856,0.099534,0.261715>
+,<0.421151,0.0887411,0.257859>
+,<0.407817,0.0598126,0.284011>
+,<0.400775,0.0498146,0.295704>
+,<0.385003,0.0421206,0.317388>
+,<0.367198,0.0657722,0.333437>
+,<0.329164,0.104704,0.361572>
+,<0.344628,0.0566995,0.357823>
+,<0.334921,0.110391,0.354694>
+,<0.352526,0.0623217,0.349143>
+,<0.356682,0.0653111,0.344449>
+,<0.364232,0.0696568,0.335961>
+,<0.36638,0.0668903,0.334129>
+,<0.368437,0.0642251,0.332355>
+,<0.370446,0.0616064,0.330604>
+,<0.372446,0.0589831,0.328842>
+,<0.374477,0.0563041,0.327033>
+,<0.376579,0.0535137,0.325141>
+,<0.3788,0.050547,0.323119>
+,<0.381201,0.0473234,0.320913>
+,<0.383857,0.0437366,0.318448>
+,<0.386876,0.0396389,0.315621>
+,<0.390342,0.0354836,0.312221>
+,<0.392996,0.0391048,0.308085>
+,<0.395336,0.0423156,0.304405>
+,<0.397451,0.0452347,0.301047>
+,<0.399405,0.0479495,0.297913>
+,<0.401249,0.0505282,0.294924>
+,<0.403024,0.0530272,0.292016>
+,<0.404766,0.0554967,0.28913>
+,<0.406509,0.0579843,0.286212>
+,<0.408287,0.0605395,0.283203>
+,<0.410137,0.0632169,0.280037>
+,<0.412104,0.0660819,0.276637>
+,<0.414242,0.0692173,0.272903>
+,<0.416625,0.0727342,0.2687>
+,<0.419357,0.0767897,0.263838>
+,<0.422593,0.0816187,0.258032>
+,<0.421658,0.0876686,0.257497>
+,<0.418861,0.0934,0.259551>
+,<0.416287,0.0986344,0.261418>
+,<0.413862,0.103523,0.263151>
+,<0.411531,0.108184,0.264794>
+,<0.409244,0.112718,0.266384>
+,<0.406957,0.117214,0.26795>
+,<0.404626,0.12176,0.269525>
+,<0.402202,0.126446,0.271138>
+,<0.399632,0.131374,0.272825>
+,<0.39685,0.136669,0.274627>
+,<0.393769,0.142489,0.276596>
+,<0.390272,0.149048,0.278804>
+,<0.38619,0.156654,0.281352>
+,<0.381268,0.165772,0.284391>
+,<0.375095,0.177144,0.288167>
+,<0.366963,0.192056,0.293099>
+,<0.178178,0.349884,0.311521>
+,<0.384719,0.088236,0.307581>
+,<-0.335423,-0.353515,-0.113662>
+,<0.152818,-0.395212,-0.287159>
+,<0.177625,-0.470277,0.0944972>
+,<0.215443,-0.450676,-0.0266446>
+,<0.121897,-0.349096,0.344061>
+,<-0.251342,-0.418454,0.114194>
+,<-0.281174,-0.418595,-0.0530179>
+,<-0.242116,-0.446267,0.0386585>
+,<-0.271453,-0.419855,-0.0716289>
+,<-0.277367,-0.378143,-0.181611>
+,<-0.274477,-0.431016,0.0066118>
+,<-0.309995,-0.406402,-0.00203511>
+,<-0.323053,-0.395352,0.00166354>
+,<-0.328338,-0.390843,0.00312415>
+,<-0.319303,-0.398538,0.000578803>
+,<-0.350072,-0.372066,0.00931186>
+,<-0.383618,-0.340244,0.0108881>
+,<-0.34629,-0.375361,0.00820718>
+,<-0.476726,-0.0728827,0.215693>
+,<-0.445577,-0.107093,0.24973>
+,<-0.536382,-0.0632777,0.0604142>
+,<-0.354777,-0.278283,0.233981>
+,<-0.331408,-0.303714,0.240691>
+,<-0.302884,-0.323617,0.25642>
+,<-0.340132,-0.297528,0.235802>
+,<-0.536045,-0.00967371,-0.0568153>
+,<-0.442649,0.131916,0.211448>
+,<-0.306859,-0.369249,0.13977>
+,<-0.302687,-0.368646,0.150597>
+,<-0.381921,-0.0820254,-0.333291>
+,<-0.438159,0.292752,-0.0162717>
+,<-0.33158,0.139601,0.367612>
+,<-0.0525033,0.354963,0.360369>
+,<-0.402417,-0.307963,0.0534018>
+,<-0.243688,0.436312,-0.0162622>
+,<-0.440337,-0.243906,-0.118273>
+,<-0.426105,-0.249505,-0.144678>
+,<-0.362909,0.357742,-0.0210169>
+,<-0.399865,-0.259295,-0.19217>
+,<-0.409654,-0.255707,-0.17467>
+,<-0.36819,-0.293242,-0.186779>
+,<-0.362201,-0.299638,-0.185703>
+,<-0.371923,-0.28928,-0.187381>
+,<-0.347283,-0.315406,-0.183106>
+,<-0.354164,-0.308156,-0.184308>
+,<-0.335722,-0.327475,-0.181065>
+,<-0.341215,-0.32176,-0.182038>
+,<-0.325809,-0.337682,-0.179289>
+,<-0.330631,-0.332735,-0.180156>
+,<-0.316553,-0.347073,-0.177605>
+,<-0.321148,-0.342428,-0.178444>
+,<-0.305455,-0.358137,-0.175586>
+,<-0.311936,-0.351707,-0.176756>
+,<-0.307205,-0.356418,-0.17588>
+,<-0.291254,-0.372076,-0.172882>
+,<-0.296995,-0.366478,-0.173968>
+,<-0.282946,-0.376957,-0.17621>
+,<-0.234973,-0.38624,-0.221717>
+,<-0.19138,-0.444881,-0.127392>
+,<-0.189037,-0.445496,-0.129022>
+,<-0.171355,-0.387011,-0.293179>
+,<-0.241091,-0.44915,0.0307319>
+,<-0.209935,-0.463013,0.0350738>
+,<-0.137594,-0.49362,0.0449431>
+,<0.0455812,-0.409984,-0.283322>
+,<0.0549873,-0.408796,-0.283736>
+,<0.0413696,-0.410494,-0.283128>
+,<0.445747,0.0671962,-0.224698>
+,<0.483906,-0.0192191,-0.129489>
+,<0.477449,0.0915417,0.144404>
+,<0.473107,0.070737,0.166127>
+,<0.464526,-0.113537,0.194186>
+,<0.483128,0.103968,0.11621>
+,<0.470038,0.0569195,0.180462>
+,<0.467608,-0.00481254,0.19226>
+,<0.468088,-0.112256,0.178897>
+,<0.511263,0.0494679,-0.0299197>
+,<0.468638,0.0323751,0.187749>
+,<0.457172,-0.129673,0.19741>
+,<0.448226,-0.149002,0.201277>
+,<0.445688,-0.15447,0.202327>
+,<0.451336,-0.142334,0.19993>
+,<0.434507,-0.178147,0.206949>
+,<0.42876,-0.190144,0.209263>
+,<0.398329,-0.211034,0.239055>
+,<0.396396,-0.211391,0.24133>
+,<0.421653,-0.259755,0.0693226>
+,<0.371458,-0.229694,0.25394>
+,<0.390799,-0.215483,0.244197>
+,<0.301618,-0.196594,0.347687>
+,<0.4034,-0.279926,0.0982916>
+,<0.42196,-0.240118,0.132637>
+,<0.43647,-0.232944,0.0743379>
+,<0.4373,-0.232441,0.0708028>
+,<0.436601,-0.232849,0.073835>
+,<0.435728,-0.233366,0.0775029>
+,<0.43822,-0.231851,0.0668736>
+,<0.427077,-0.25318,0.0598593>
+,<0.428118,-0.253143,0.0517699>
+,<0.439658,-0.230929,0.0604411>
+,<0.42771,-0.254783,0.0466106>
+,<0.45134,-0.22192,0.00332983>
+,<0.425857,-0.258853,0.0405405>
+,<0.442288,-0.229074,0.048341>
+,<0.428326,-0.256273,0.0306691>
+,<0.447052,-0.225413,0.0250531>
+,<0.426093,-0.254133,0.0628136>
+,<0.43978,-0.230832,0.0599459>
+,<0.427578,-0.23774,0.110019>
+,<0.424537,-0.23929,0.121696>
+,<0.428015,-0.253823,0.0491049>
+,<0.439,-0.231349,0.063439>
+,<0.454793,-0.219047,-0.0143969>
+,<0.428113,-0.253491,0.0499981>
+,<0.460134,-0.214291,-0.0410739>
+,<0.433053,-0.25001,0.0203866>
+,<0.470605,-0.192904,-0.0498774>
+,<0.465428,-0.204092,-0.0475692>
+,<0.508872,-0.0299056,-0.0159178>
+,<0.511065,0.00587404,-0.0276058>
+,<0.486048,-0.151319,-0.0309028>
+,<0.478183,0.0952441,0.140521>
+,<0.471289,-0.0712043,-0.151314>
+,<0.443336,-0.144237,-0.197153>
+,<0.49868,0.115392,0.0347342>
+,<0.478397,0.09562,0.139496>
+,<0.433785,0.0670793,-0.245267>
+,<0.477411,0.0913617,0.144597>
+,<0.464611,-0.0942933,-0.160732>
+,<0.435458,-0.14374,-0.217679>
+,<0.493246,0.12315,0.062342>
+,<0.502507,0.0967786,0.0164387>
+,<0.480258,-0.107579,0.124992>
+,<0.452817,-0.199577,0.0743398>
+,<-0.26752,0.33285,-0.260279>
+,<-0.340177,-0.200744,-0.34387>
+,<-0.245165,0.081534,-0.436007>
+,<-0.263606,0.317498,-0.28255>
+,<-0.405401,0.104685,-0.314831>
+,<-0.248439,0.32655,-0.285936>
+,<-0.136418,0.388112,-0.308769>
+,<-0.255214,0.339083,-0.264716>
+,<-0.246488,0.327724,-0.286308>
+,<-0.212676,0.381575,-0.247325>
+,<0.0988323,0.486235,-0.111599>
+,<-0.128406,0.450527,-0.175801>
+,<-0.251964,0.351979,-0.250257>
+,<-0.229259,0.369793,-0.247634>
+,<-0.119414,0.388868,-0.320857>
+,<-0.35544,0.259328,-0.259533>
+,<-0.263288,0.333723,-0.263573>
+,<-0.315852,-0.196074,-0.378366>
+,<-0.265598,0.170006,-0.417775>
+,<-0.242366,0.360523,-0.247765>
+,<0.148355,0.318727,-0.362893>
+,<0.19506,0.329057,-0.332104>
+,<0.237734,0.367357,-0.266368>
+,<0.114931,0.434515,-0.230357>
+,<0.020706,0.463376,-0.225471>
+,<-0.16904,0.466566,-0.0908677>
+,<-0.242987,0.404886,-0.176569>
+,<-0.114528,0.445672,-0.198616>
+,<0.0835472,0.450424,-0.220653>
+,<0.120143,0.431817,-0.231984>
+,<0.158567,0.411586,-0.243526>
+,<0.185832,0.396633,-0.251544>
+,<0.314934,0.262939,-0.296735>
+,<0.123789,0.312989,-0.3786>
+,<0.241858,0.338809,-0.300293>
+,<0.180648,0.399524,-0.250007>
+,<0.0581689,0.300661,-0.415296>
+,<0.282616,0.31982,-0.29078>
+,<0.284114,0.306052,-0.299275>
+,<0.0294544,0.128692,-0.493407>
+,<-0.237434,0.430078,-0.119328>
+,<-0.396676,-0.256116,-0.200809>
+,<0.165274,-0.202567,-0.444926>
+,<-0.163019,-0.304701,-0.411983>
+,<0.026994,-0.172962,-0.484918>
+,<0.276651,0.00354561,-0.422416>
+,<0.342957,-0.187075,-0.312078>
+,<0.337439,-0.178602,-0.323235>
+,<0.374713,-0.0660681,-0.338069>
+,<0.24842,0.194465,-0.391277>
+,<0.314035,0.0566948,-0.401254>
+,<-0.0398673,-0.0102605,-0.498559>
+,<0.244659,0.0739896,-0.432755>
+,<-0.148909,0.155121,-0.460501>
+,<0.0269858,0.128193,-0.49341>
+,<-0.196967,-0.110545,-0.467771>
+,<-0.422158,0.228014,0.163338>
+,<-0.370458,-0.230187,-0.269301>
+,<0.0706913,-0.347575,-0.356758>
+,<-0.108362,-0.327549,-0.390692>
+,<0.248979,-0.182035,-0.406905>
+,<0.0553016,-0.16285,-0.488025>
+,<-0.0129675,-0.187084,-0.480132>
+,<-0.238954,0.425426,-0.129748>
+,<-0.432994,-0.246818,-0.13195>
+,<-0.427664,0.0604434,-0.298155>
+,<-0.0533786,0.210915,-0.450628>
+,<0.0837512,0.380461,0.315373>
+,<0.182512,0.107459,0.462841>
+,<-0.128418,0.286127,0.400368>
+,<-0.0794267,0.388238,0.311421>
+,<-0.193869,0.0422877,0.478622>
+,<-0.0367369,0.245568,0.454655>
+,<0.058974,0.496872,-0.00641194>
+,<-0.253939,0.0815038,0.437321>
+,<0.180315,0.345951,0.314795>
+,<-0.0929409,0.404538,0.286266>
+,<0.0374166,0.419971,0.270128>
+,<0.144719,0.477457,0.102028>
+,<-0.397923,-0.0468644,-0.321617>
+,<-0.0723039,0.379529,0.324493>
+,<0.038883,0.386045,0.31957>
+,<-0.120233,0.436675,0.234335>
+,<0.293559,0.128047,0.383966>
+,<0.0842827,0.240701,0.431418>
+,<0.117999,0.220724,0.432951>
+,<-0.0391853,0.252067,0.450781>
+,<-0.0535993,0.290079,0.427684>
+,<0.0209059,0.354689,0.363397>
+,<0.0442056,0.373308,0.33625>
+,<-0.0431771,0.262568,0.444465>
+,<0.296318,0.141385,0.377174>
+,<0.132772,0.205387,0.436155>
+,<0.120195,0.31698,0.368838>
+,<0.240611,0.211912,0.392099>
+,<0.320476,0.262064,0.305063>
+,<0.171955,0.361165,0.301976>
+,<0.0548243,0.375278,0.330672>
+,<0.371351,0.247076,0.24875>
+,<0.0280142,0.361536,0.35395>
+,<0.297102,0.103563,0.388613>
+,<0.155233,0.391869,0.274368>
+,<0.150242,0.467835,0.129225>
+,<0.38634,0.227274,0.234777>
+,<0.198086,0.312385,0.341981>
+,<0.203192,0.302567,0.349782>
+,<0.187594,0.332359,0.325939>
+,<0.174038,0.357416,0.305173>
+,<0.165126,0.373268,0.291488>
+,<0.269946,0.398562,0.135494>
+,<0.0675626,0.435033,0.238134>
+,<0.121358,0.436279,0.217592>
+,<-0.0447249,0.463172,0.198605>
+,<0.0598407,0.462938,0.179231>
+,<-0.0123708,0.500388,0.00431943>
+,<0.0548335,0.46292,0.180844>
+,<0.0176135,0.493337,0.0964598>
+,<0.148857,0.460324,0.15208>
+,<0.229252,0.394591,0.211851>
+,<0.275758,0.392806,0.141201>
+,<0.0508888,0.43421,0.244211>
+,<0.037162,0.425256,0.261997>
+,<-0.0676302,0.373745,0.333048>
+,<-0.0368764,0.335402,0.388347>
+,<-0.218397,-0.0823861,0.454141>
+,<-0.308802,-0.369508,0.134618>
+,<-0.425076,0.289819,-0.0611118>
+,<-0.059308,0.499273,0.0450669>
+,<-0.245907,0.434775,-0.0228468>
+,<-0.113891,0.429263,0.246508>
+,<-0.247326,0.0766735,0.442175>
+,<-0.244887,0.0749317,0.443949>
+,<-0.215074,0.0533532,0.465367>
+,<0.0840644,0.412413,0.270646>
+,<0.184449,-0.283863,0.388047>
+,<0.19661,-0.285293,0.378768>
+,<0.172819,-0.189686,0.441681>
+,<0.176118,-0.254065,0.408717>
+,<0.0023795,-0.0952642,0.496025>
+,<-0.129295,0.0838696,0.488457>
+,<0.168846,-0.122651,0.474294>
+,<0.112508,-0.109633,0.488436>
+,<-0.257336,-0.395311,0.171632>
+,<0.160051,-0.386084,0.274461>
+,<0.206135,-0.411921,0.194742>
+,<0.201693,-0.412848,0.197274>
+,<0.192643,-0.415192,0.201277>
+,<0.280939,-0.416398,0.0426316>
+,<0.195112,-0.386708,0.250167>
+,<0.167752,-0.393076,0.259647>
+,<0.167515,-0.392924,0.260022>
+,<0.227609,-0.369889,0.250326>
+,<0.250557,-0.357737,0.250304>
+,<0.230763,-0.301734,0.336612>
+,<0.185024,-0.391738,0.249951>
+,<0.180378,-0.393957,0.249903>
+,<-0.0916288,-0.40193,0.304453>
+,<0.299587,-0.403452,0.00173523>
+,<0.342084,-0.369243,-0.0964669>
+,<0.211514,-0.432574,-0.2107>
+,<0.158139,-0.384271,0.278096>
+,<-0.266942,-0.370263,0.22093>
+,<0.160983,-0.386957,0.272682>
+,<0.124338,-0.107957,0.487575>
+,<-0.00842929,-0.0418921,0.499013>
+,<-0.25807,-0.391988,0.179471>
+,<-0.25557,-0.402919,0.153408>
+,<0.146969,-0.422942,0.224734>
+,<0.215664,-0.452366,0.0105026>
+,<0.307852,-0.397244,-0.0169004>
+,<0.212812,-0.409245,0.193419>
+,<0.030027,-0.411801,-0.282549>
+,<0.169051,-0.394312,0.256989>
+,<-0.25611,-0.400659,0.158869>
+,<0.173855,-0.397072,0.249737>
+,<0.219557,-0.402586,0.199713>
+,<0.219654,-0.402177,0.200406>
+,<0.29048,-0.398005,0.12285>
+,<0.291184,-0.409447,0.0203381>
+,<0.19662,-0.413073,0.201778>
+,<-0.255058,-0.405003,0.148324>
+,<-0.103608,-0.270209,0.415995>
+,<0.162136,-0.3879,0.270653>
+,<0.171196,-0.396191,0.252813>
+,<0.182078,-0.393169,0.249889>
+,<0.186294,-0.391083,0.250029>
+,<0.192104,-0.388213,0.250126>
+,<0.200146,-0.384195,0.25017>
+,<0.224177,-0.37173,0.25027>
+,<0.253497,-0.332598,0.281824>
+,<0.217574,-0.39844,0.209636>
+,<0.198275,-0.385112,0.250203>
+,<0.159324,-0.385268,0.276029>
+,<0.159474,-0.410883,0.236878>
+,<0.134631,-0.361451,0.321158>
+,<0.177229,-0.395467,0.249826>
+,<0.189184,-0.389661,0.25008>
+,<0.201671,-0.383386,0.250235>
+,<0.208005,-0.29022,0.365536>
+,<0.265092,-0.228907,0.358765>
+,<0.179438,-0.375372,0.278026>
+,<0.220322,-0.373719,0.250319>
+,<0.209606,-0.379304,0.250286>
+,<0.255012,-0.349169,0.258705>
+,<0.237165,-0.364841,0.250323>
+,<0.21645,-0.294509,0.354861>
+,<0.222966,-0.297823,0.346563>
+,<0.255198,-0.351743,0.255094>
+,<0.232593,-0.367296,0.250269>
+,<0.21448,-0.376772,0.250305>
+,<0.212237,-0.377973,0.250247>
+,<0.217605,-0.375175,0.250262>
+,<0.203714,-0.382373,0.2502>
+,<0.207689,-0.380328,0.250226>
+,<0.196865,-0.385858,0.250136>
+,<0.17902,-0.394642,0.249819>
+,<0.168237,-0.402191,0.245345>
+,<0.19378,-0.38741,0.250097>
+,<0.154014,-0.416183,0.231587>
+,<0.187919,-0.390319,0.250006>
+,<0.140826,-0.367489,0.309944>
+,<0.144948,-0.371498,0.302464>
+,<-0.110278,-0.475966,0.138553>
+,<-0.253574,-0.410703,0.134154>
+,<0.296873,-0.405422,0.00778023>
+,<0.216947,-0.406386,0.194921>
+,<-0.0210771,-0.44741,0.268208>
+,<0.21562,-0.451571,-0.00893837>
+,<0.199122,-0.413156,0.199174>
+,<0.217299,-0.406065,0.195195>
+,<-0.209067,-0.463394,0.035185>
+,<0.0145244,-0.413407,-0.281636>
+,<0.0494611,-0.11855,0.492376>
+,<-0.258936,-0.387979,0.188863>
+,<-0.0162848,-0.458948,0.248614>
+,<0.310839,-0.394927,-0.023714>
+,<0.284705,-0.41388,0.0344758>
+,<-0.0185714,-0.540889,0.0622723>
+,<0.19724,-0.413278,0.200758>
+,<-0.254561,-0.406967,0.143488>
+,<0.30138,-0.380659,-0.214045>
+,<0.215605,-0.453029,0.0283531>
+,<0.15677,-0.445325,0.173167>
+,<0.265357,-0.42651,0.076039>
+,<0.288083,-0.411586,0.0271235>
+,<0.297745,-0.404792,0.005901>
+,<0.302286,-0.401459,-0.00431323>
+,<0.294091,-0.407407,0.0139391>
+,<0.354371,-0.336505,0.109132>
+,<0.276629,-0.419237,0.0519175>
+,<0.271551,-0.422536,0.0628091>
+,<0.259301,-0.430353,0.0889878>
+,<0.334198,-0.375885,-0.0779176>
+,<0.344661,-0.315423,0.182519>
+,<0.281654,-0.407305,0.113262>
+,<0.269128,-0.420302,0.0996559>
+,<0.232522,-0.445456,0.0870429>
+,<0.0149202,-0.531437,0.12016>
+,<0.208056,-0.411294,0.19409>
+,<0.204766,-0.412256,0.19543>
+,<0.192591,-0.415261,0.201186>
+,<0.202257,-0.412794,0.196825>
+,<0.211519,-0.409889,0.193436>
+,<0.363614,-0.286881,0.19331>
+,<0.219566,-0.402516,0.199841>
+,<0.274143,-0.297301,0.299896>
+,<0.252414,-0.321508,0.296989>
+,<0.211681,-0.398181,0.215975>
+,<-0.00869252,-0.538456,0.083107>
+,<-0.244638,-0.43894,0.0588527>
+,<-0.256356,-0.440952,0.0197513>
+,<0.221859,-0.425601,-0.220623>
+,<0.23744,-0.415001,-0.235619>
+,<0.0633589,-0.499254,-0.118398>
+,<0.266277,-0.395511,-0.260568>
+,<0.323071,-0.385114,-0.0518984>
+,<0.343728,-0.364776,-0.130431>
+,<0.329239,-0.370403,-0.159353>
+,<0.288943,-0.385073,-0.238192>
+,<0.28656,-0.385908,-0.242791>
+,<-0.280307,-0.407407,-0.0947386>
+,<0.213895,-0.444795,-0.0954395>
+,<-0.247838,-0.429444,0.0848046>
+,<0.272358,-0.416987,0.103114>
+,<0.393285,-0.291866,0.102126>
+,<0.383992,-0.303076,0.103923>
+,<0.318983,-0.352217,0.167934>
+,<0.302194,-0.385439,0.13569>
+,<0.194683,-0.413487,0.202802>
+,<0.189942,-0.417507,0.199118>
+,<0.288377,-0.367655,0.189407>
+,<0.137683,-0.485945,0.103552>
+,<0.181356,-0.424734,0.192419>
+,<0.25374,-0.334878,0.278652>
+,<0.262554,-0.357985,0.237411>
+,<0.207234,-0.411584,0.194325>
+,<0.215578,-0.453594,0.0452108>
+,<0.215479,-0.450882,-0.0230693>
+,<-0.251209,-0.418836,0.113223>
+,<-0.244237,-0.440043,0.0558702>
+,<0.033772,-0.411384,-0.282746>
+,<0.0754679,-0.406072,-0.284535>
+,<0.215512,-0.451088,-0.0192937>
+,<0.120313,-0.474838,-0.153897>
+,<-0.00441441,-0.528701,-0.0522179>
+,<0.215655,-0.452067,0.00276058>
+,<-0.291573,-0.420494,-0.0119879>
+,<-0.199358,-0.46762,0.0365335>
+,<-0.265235,-0.421954,-0.0759666>
+,<-0.0586984,-0.458517,-0.208757>
+,<-0.000684082,-0.41482,-0.28063>
+,<0.0263416,-0.412201,-0.282344>
+,<0.15212,-0.395308,-0.287142>
+,<-0.228644,-0.387331,-0.227569>
+,<-0.191297,-0.425249,-0.182477>
+,<-0.0125045,-0.505939,-0.116459>
+,<-0.247403,-0.445779,0.0262138>
+,<0.153641,-0.459846,-0.174566>
+,<0.215657,-0.453186,0.0337899>
+,<0.275058,-0.391384,-0.252861>
+,<0.291041,-0.384344,-0.234096>
+,<0.30313,-0.380041,-0.210608>
+,<0.313401,-0.376316,-0.19054>
+,<0.322385,-0.372994,-0.172881>
+,<0.330445,-0.369951,-0.156935>
+,<0.337845,-0.367098,-0.142197>
+,<0.344784,-0.364363,-0.128281>
+,<0.349048,-0.363331,-0.113002>
+,<0.339349,-0.37155,-0.0901214>
+,<0.332103,-0.377634,-0.0730896>
+,<0.32638,-0.38239,-0.0596909>
+,<0.321658,-0.386268,-0.0486849>
+,<0.31762,-0.389542,-0.0393193>
+,<0.314061,-0.392388,-0.0311067>
+,<0.246306,-0.434405,-0.0320329>
+,<0.427004,-0.115492,-0.249079>
+,<0.430385,-0.131069,-0.235211>
+,<0.451278,-0.0281487,-0.21585>
+,<0.341442,-0.194421,-0.309251>
+,<0.409251,0.0667591,-0.285708>
+,<0.465476,0.0288952,-0.190863>
+,<0.361871,-0.0512587,-0.35862>
+,<0.334645,-0.206707,-0.309064>
+,<0.456302,-0.00883578,-0.207487>
+,<0.505391,-0.0755971,-0.000956084>
+,<0.482825,-0.160883,-0.0373563>
+,<0.479269,-0.0395237,-0.138081>
+,<0.497017,-0.0999919,0.0418967>
+,<0.473069,0.070572,0.166302>
+,<0.482339,0.102586,0.120149>
+,<0.488462,0.113906,0.0884399>
+,<0.486338,0.109909,0.09967>
+,<0.471587,0.0638129,0.173322>
+,<0.474968,-0.109666,0.148842>
+,<0.501963,-0.0974214,0.0148104>
+,<0.501977,-0.101683,0.00248477>
+,<0.468226,-0.0820887,-0.155691>
+,<0.472671,-0.0661293,-0.149224>
+,<0.474944,-0.0575213,-0.145558>
+,<0.478267,-0.0437941,-0.139883>
+,<0.480464,-0.0343613,-0.135899>
+,<0.490978,0.012489,-0.116038>
+,<0.512211,0.0407533,-0.041675>
+,<0.507263,-0.0522934,-0.00859199>
+,<0.503553,-0.0965552,0.00588781>
+,<0.453841,-0.150605,-0.161274>
+,<0.459538,-0.111178,-0.167582>
+,<0.481951,-0.0278565,-0.133147>
+,<0.47052,-0.0739653,-0.152446>
+,<0.448855,-0.144532,-0.182511>
+,<0.445475,-0.144336,-0.191525>
+,<0.441887,-0.144118,-0.200986>
+,<0.438,-0.143873,-0.211127>
+,<0.433695,-0.143591,-0.222245>
+,<0.431576,-0.13663,-0.230204>
+,<0.429907,-0.128752,-0.237253>
+,<0.428226,-0.120979,-0.244179>
+,<0.426503,-0.113161,-0.251114>
+,<0.445974,-0.0473349,-0.224018>
+,<0.452498,-0.0235665,-0.213878>
+,<0.45926,0.00305138,-0.20228>
+,<0.0980544,0.00360326,-0.498403>
+,<0.385113,-0.0781817,-0.321119>
+,<0.353869,-0.0420925,-0.37127>
+,<0.34025,-0.184491,-0.316638>
+,<0.176643,-0.0317329,-0.468736>
+,<0.448764,-0.0373803,-0.219797>
+,<0.454984,-0.0140152,-0.209743>
+,<0.461004,0.0102024,-0.199132>
+,<0.461752,0.0673082,-0.196498>
+,<0.455658,0.0672703,-0.207308>
+,<0.432475,0.067095,-0.247478>
+,<0.441504,0.0671587,-0.232053>
+,<0.450406,0.0672332,-0.216556>
+,<0.468429,0.0414532,-0.185295>
+,<0.447419,-0.0422141,-0.221851>
+,<0.398952,0.066577,-0.302123>
+,<0.417678,0.066895,-0.272064>
+,<0.375407,0.0661207,-0.338999>
+,<0.438139,-0.0741984,-0.235274>
+,<0.477426,0.0712034,-0.166381>
+,<0.467061,-0.0515947,-0.172025>
+,<-0.0764972,0.383207,-0.358524>
+,<-0.13827,0.388018,-0.307462>
+,<-0.251367,0.350467,-0.252991>
+,<-0.251055,0.349076,-0.25525>
+,<-0.225144,0.401015,-0.203496>
+,<-0.238187,0.363432,-0.247799>
+,<-0.218591,0.440362,-0.112575>
+,<-0.147354,0.388976,-0.297971>
+,<0.133037,0.436392,0.213038>
+,<0.0627471,0.460797,-0.214204>
+,<0.0508431,0.466736,-0.210434>
+,<0.0426568,0.470768,-0.207913>
+,<0.0912822,0.446513,-0.223093>
+,<0.0784515,0.452958,-0.219105>
+,<0.111637,0.436184,-0.229378>
+,<0.102149,0.441018,-0.226455>
+,<0.130754,0.426334,-0.235186>
+,<0.13528,0.423951,-0.236586>
+,<0.127952,0.427775,-0.234365>
+,<0.149154,0.416617,-0.240756>
+,<0.142298,0.420257,-0.238702>
+,<0.16291,0.40922,-0.24484>
+,<0.155981,0.412962,-0.242789>
+,<0.177657,0.401156,-0.249166>
+,<0.170082,0.405315,-0.24695>
+,<0.198541,0.389559,-0.255182>
+,<0.205093,0.385856,-0.257099>
+,<0.194861,0.3916,-0.254155>
+,<0.231451,0.370916,-0.264625>
+,<0.217033,0.37911,-0.260517>
+,<0.27469,0.346142,-0.276862>
+,<0.0720364,0.300466,-0.410925>
+,<0.273683,0.346719,-0.276583>
+,<0.333261,0.232861,-0.297289>
+,<0.356351,0.193693,-0.297574>
+,<0.170724,0.32377,-0.3483>
+,<0.163256,0.322106,-0.353205>
+,<0.178399,0.325458,-0.343226>
+,<0.13251,0.315047,-0.373059>
+,<0.154067,0.320051,-0.359177>
+,<0.227297,0.335816,-0.310258>
+,<0.252029,0.205253,-0.382847>
+,<0.285481,0.310326,-0.295613>
+,<0.25519,0.341554,-0.291108>
+,<0.100633,0.307454,-0.393147>
+,<0.138732,0.316522,-0.369065>
+,<0.0623142,0.298046,-0.416949>
+,<0.224198,0.335199,-0.312351>
+,<0.184477,0.326801,-0.339166>
+,<0.130488,0.314592,-0.374329>
+,<0.146534,0.318328,-0.364051>
+,<0.0450472,0.308922,-0.409993>
+,<0.056661,0.301624,-0.414681>
+,<0.0223603,0.323068,-0.400706>
+,<0.0336869,0.316024,-0.405364>
+,<-0.0120274,0.34422,-0.386318>
+,<0.0108502,0.330188,-0.395928>
+,<-0.00107495,0.337526,-0.390933>
+,<-0.0423241,0.362645,-0.373349>
+,<-0.059359,0.372924,-0.365976>
+,<-0.0915982,0.364137,-0.366449>
+,<-0.509427,0.00490699,-0.123327>
+,<-0.266092,0.33303,-0.261553>
+,<-0.226314,0.00340858,-0.450456>
+,<-0.304594,0.291761,-0.272485>
+,<-0.251048,0.348048,-0.256686>
+,<0.112594,0.380998,-0.304242>
+,<-0.0113336,-0.339239,-0.373208>
+,<-0.180762,-0.267973,-0.439782>
+,<0.0789729,-0.348279,-0.354948>
+,<0.0292527,-0.343677,-0.365408>
+,<-0.199669,-0.239964,-0.454593>
+,<-0.0563968,-0.202232,-0.474407>
+,<-0.300653,-0.201343,-0.389343>
+,<-0.448343,-0.240679,-0.103245>
+,<-0.459446,0.030827,-0.241036>
+,<-0.374952,0.254455,-0.244927>
+,<-0.201175,-0.177187,-0.462069>
+,<-0.374969,0.220824,-0.279975>
+,<-0.231764,0.0253557,-0.446656>
+,<0.212423,0.332747,-0.320361>
+,<0.198347,0.174511,-0.428894>
+,<0.345516,0.00625887,-0.385252>
+,<0.275125,0.277148,-0.323753>
+,<0.147826,-0.0416539,-0.480677>
+,<0.333849,-0.208046,-0.309096>
+,<0.342941,0.027757,-0.389348>
+,<-0.0780182,0.0598484,-0.494224>
+,<-0.0194343,0.118347,-0.493212>
+,<-0.139373,0.149714,-0.464366>
+,<-0.100607,0.000752037,-0.492739>
+,<0.150239,0.187128,-0.444834>
+,<-0.10588,0.130672,-0.477549>
+,<-0.20724,0.211622,-0.425155>
+,<-0.237601,0.0494731,-0.44223>
+,<-0.136498,-0.0460069,-0.48447>
+,<-0.24848,-0.219111,-0.426406>
+,<-0.27124,0.339016,-0.248007>
+,<-0.221509,-0.0157423,-0.453581>
+,<-0.197763,-0.150298,-0.465631>
+,<-0.227939,0.00984918,-0.449357>
+,<-0.159403,0.161065,-0.456199>
+,<-0.0977701,0.126048,-0.48064>
+,<-0.0844464,0.0148328,-0.49548>
+,<-0.0576011,-0.000298485,-0.497453>
+,<-0.0916489,0.0123514,-0.494525>
+,<-0.109467,-0.0107494,-0.490854>
+,<-0.185003,0.175544,-0.445543>
+,<-0.12209,0.139899,-0.471251>
+,<-0.0718839,0.0077754,-0.496428>
+,<-0.0517665,-0.00356295,-0.497845>
+,<-0.0433735,-0.008288,-0.498363>
+,<-0.0570632,-0.000579035,-0.49749>
+,<-0.0835533,0.0364067,-0.494877>
+,<-0.0758956,0.0687849,-0.493909>
+,<0.159595,0.184715,-0.441822>
+,<0.274358,0.274794,-0.325761>
+,<-0.0281588,-0.0168624,-0.499091>
+,<0.192937,0.328623,-0.33351>
+,<0.238118,0.338068,-0.302834>
+,<0.366884,0.139757,-0.315687>
+,<0.0869994,-0.150288,-0.491402>
+,<0.413626,0.0668314,-0.278652>
+,<0.448692,0.0672536,-0.21955>
+,<0.111762,0.310139,-0.38617>
+,<0.24743,-0.00689994,-0.43674>
+,<0.25531,0.215174,-0.374985>
+,<0.188948,-0.0274762,-0.46352>
+,<-0.0310625,-0.336967,-0.376815>
+,<0.224596,-0.299296,-0.365949>
+,<0.322376,-0.228645,-0.308664>
+,<0.339539,-0.183461,-0.318044>
+,<0.0822737,-0.34858,-0.354196>
+,<-0.0433918,-0.0459736,-0.496391>
+,<-0.319214,0.287946,0.267217>
+,<-0.214505,0.276644,0.368579>
+,<-0.00213614,0.461304,0.196841>
+,<-0.302409,0.397771,0.104415>
+,<-0.211548,-0.0728612,0.460017>
+,<-0.257768,0.425431,-0.0592439>
+,<-0.242957,-0.116735,0.432499>
+,<-0.32149,-0.370309,0.0990276>
+,<-0.293348,0.110213,0.407725>
+,<-0.292819,0.280257,0.310735>
+,<-0.175705,0.0540562,0.481535>
+,<-0.331392,0.00301689,0.374993>
+,<-0.403191,-0.258074,-0.186269>
+,<-0.0370989,0.1624,0.491124>
+,<-0.194513,-0.0312534,0.475709>
+,<-0.0369937,0.190843,0.478923>
+,<-0.203405,0.0449319,0.473603>
+,<-0.262869,0.0879985,0.430718>
+,<-0.194306,-0.0373158,0.475434>
+,<-0.100434,-0.104959,0.484363>
+,<-0.145936,0.284367,0.39411>
+,<0.113428,0.247125,0.420038>
+,<-0.189533,0.0451238,0.479322>
+,<0.00340887,0.447255,0.226961>
+,<0.0531007,0.242076,0.437623>
+,<-0.0683847,0.374707,0.331637>
+,<-0.0592403,0.363387,0.348198>
+,<-0.0759546,0.384002,0.317809>
+,<0.043059,0.373108,0.336834>
+,<-0.0827955,0.392329,0.305196>
+,<-0.0384748,0.250147,0.451928>
+,<0.282358,0.128244,0.392477>
+,<-0.0469509,0.348065,0.370283>
+,<0.0380188,0.406703,0.289938>
+,<0.0386555,0.39161,0.311677>
+,<-0.245811,0.434857,-0.0222902>
+,<0.0375362,0.417426,0.273994>
+,<0.0931131,0.435843,0.22851>
+,<0.037021,0.428112,0.257547>
+,<-0.1021,0.441095,-0.218954>
+,<0.0364095,0.498687,0.000589382>
+,<0.0635624,0.434855,0.239609>
+,<0.0233988,0.464902,-0.222498>
+,<0.0167079,0.499897,-0.0209294>
+,<-0.128035,0.445763,0.219312>
+,<-0.0455617,0.346288,0.372819>
+,<-0.19232,0.4648,0.128305>
+,<-0.247383,0.433711,-0.0270513>
+,<0.067923,0.488895,-0.136074>
+,<-0.344765,0.313704,-0.195466>
+,<0.0402282,0.480195,-0.18613>
+,<-0.0464544,0.424346,-0.297982>
+,<-0.24507,0.435379,-0.0200712>
+,<-0.222615,0.356969,0.276233>
+,<-0.416077,-0.253311,-0.163049>
+,<-0.230164,0.345896,0.284754>
+,<-0.408383,0.328101,0.0626645>
+,<-0.274841,0.278094,0.33511>
+,<-0.26262,0.422662,0.113233>
+,<-0.0446071,0.137526,0.498837>
+,<-0.00162277,-0.0753546,0.497213>
+,<-0.317897,0.0418532,0.386959>
+,<-0.301549,0.282817,0.296479>
+,<-0.037159,0.145136,0.498405>
+,<-0.249068,-0.125333,0.426962>
+,<-0.195352,-0.00922238,0.476576>
+,<-0.156068,0.355593,0.31559>
+,<-0.250652,-0.420702,0.108268>
+,<-0.248946,-0.426064,0.0939425>
+,<-0.25407,-0.408854,0.138796>
+,<-0.253065,-0.412549,0.129471>
+,<-0.508061,-0.0480142,0.165726>
+,<-0.210105,-0.414771,0.184915>
+,<0.156012,-0.382238,0.282095>
+,<0.133495,-0.360406,0.32313>
+,<0.150241,-0.376625,0.292822>
+,<0.158349,-0.384355,0.27786>
+,<0.152103,-0.378419,0.289414>
+,<0.154796,-0.381072,0.284358>
+,<-0.292357,-0.137711,0.392266>
+,<-0.0146126,-0.0113834,0.500081>
+,<0.0272128,-0.121618,0.493457>
+,<0.0723641,-0.115346,0.491084>
+,<-0.00571689,-0.0552364,0.49834>
+,<-0.0180676,0.00573142,0.500292>
+,<-0.0399034,-0.175776,0.474626>
+,<0.0380328,-0.395349,0.318148>
+,<0.041599,-0.288981,0.409733>
+,<-0.0465661,-0.206634,0.460245>
+,<-0.509797,-0.0488965,0.15953>
+,<-0.379843,-0.233315,0.238752>
+,<-0.254546,-0.384112,0.204985>
+,<-0.203654,-0.419099,0.18198>
+,<-0.259772,-0.383919,0.198358>
+,<-0.258752,-0.388741,0.187118>
+,<-0.257914,-0.392612,0.178036>
+,<-0.257199,-0.39584,0.17041>
+,<-0.256568,-0.398618,0.163798>
+,<-0.255995,-0.401073,0.157904>
+,<-0.255461,-0.403298,0.152518>
+,<-0.254952,-0.405358,0.147484>
+,<-0.254457,-0.407306,0.14268>
+,<-0.253966,-0.409183,0.138003>
+,<-0.253469,-0.411029,0.13336>
+,<-0.252956,-0.412879,0.128662>
+,<-0.252417,-0.414769,0.123814>
+,<-0.25184,-0.416739,0.11871>
+,<-0.249697,-0.423676,0.100387>
+,<-0.249866,-0.423203,0.101616>
+,<-0.250504,-0.421122,0.107189>
+,<-0.246452,-0.433594,0.0735031>
+,<-0.248749,-0.426614,0.0924984>
+,<-0.247599,-0.430106,0.0830485>
+,<-0.246151,-0.434426,0.0712752>
+,<-0.241543,-0.447841,0.0343666>
+,<-0.257074,-0.382219,-0.201015>
+,<-0.176509,-0.477407,0.0396584>
+,<-0.0796979,-0.517049,0.0527249>
+,<-0.0187331,-0.540646,0.056706>
+,<0.0168875,-0.530996,0.119864>
+,<-0.284008,-0.425702,-0.000330076>
+,<0.0225833,-0.412597,-0.282128>
+,<-0.00726839,-0.415401,-0.280169>
+,<-0.211092,-0.439313,-0.11401>
+,<0.21038,-0.433341,-0.209597>
+,<-0.124941,-0.474983,-0.106532>
+,<-0.219659,-0.458733,0.0337178>
+,<-0.165656,-0.481979,0.0411477>
+,<-0.0535499,-0.527472,0.0562355>
+,<0.18641,-0.466761,0.0924658>
+,<0.161837,-0.408564,0.239165>
+,<0.127864,-0.441007,0.206146>
+,<-0.00496186,-0.485677,0.202202>
+,<-0.208416,-0.429931,0.148736>
+,<0.279976,-0.215927,0.354465>
+,<0.27185,-0.223015,0.35685>
+,<0.339881,-0.170954,0.327774>
+,<0.343319,-0.173393,0.322775>
+,<0.32466,-0.1753,0.339731>
+,<0.326596,-0.173441,0.33907>
+,<0.331264,-0.169104,0.337379>
+,<0.311895,-0.187151,0.344219>
+,<0.310683,-0.188312,0.344612>
+,<0.314687,-0.184604,0.343232>
+,<0.303773,-0.194667,0.346949>
+,<0.307085,-0.191629,0.345837>
+,<0.295639,-0.202013,0.349633>
+,<0.294719,-0.20288,0.349905>
+,<0.297658,-0.20023,0.34896>
+,<0.286676,-0.210022,0.352443>
+,<0.285682,-0.210941,0.352723>
+,<0.288791,-0.208183,0.351768>
+,<0.278815,-0.216983,0.354786>
+,<0.282386,-0.213849,0.353721>
+,<0.266858,-0.227339,0.358286>
+,<0.274858,-0.220439,0.35595>
+,<0.270359,-0.22435,0.357256>
+,<0.243743,-0.247195,0.364782>
+,<0.239972,-0.250472,0.365794>
+,<0.250669,-0.241314,0.362826>
+,<0.223945,-0.298301,0.345331>
+,<0.237104,-0.304912,0.328452>
+,<0.243125,-0.307916,0.320654>
+,<0.25869,-0.307349,0.30665>
+,<0.338077,-0.253793,0.270561>
+,<0.361705,-0.2368,0.258839>
+,<0.376499,-0.311841,0.105311>
+,<0.302453,-0.385232,0.135479>
+,<0.269212,-0.300494,0.30208>
+,<0.369514,-0.19207,0.283367>
+,<0.353246,-0.180439,0.308113>
+,<0.374844,-0.195892,0.275115>
+,<0.388897,-0.205989,0.253149>
+,<0.328323,-0.260695,0.275276>
+,<0.252986,-0.327284,0.289116>
+,<0.357101,-0.24011,0.26117>
+,<0.388189,-0.298052,0.103121>
+,<0.252099,-0.318072,0.301619>
+,<0.219606,-0.400913,0.202893>
+,<0.21949,-0.400442,0.20391>
+,<0.219575,-0.400843,0.203058>
+,<0.410484,-0.264947,0.11199>
+,<0.376595,-0.225901,0.251384>
+,<0.343621,-0.249831,0.267847>
+,<0.315184,-0.26983,0.281487>
+,<0.284884,-0.290207,0.295205>
+,<0.251762,-0.315084,0.305689>
+,<0.277729,-0.294918,0.298356>
+,<0.310833,-0.272811,0.283505>
+,<0.349864,-0.245342,0.264767>
+,<0.389717,-0.206599,0.251847>
+,<0.381801,-0.200907,0.264262>
+,<0.375384,-0.196297,0.274267>
+,<0.369977,-0.192418,0.282644>
+,<0.365271,-0.189046,0.289883>
+,<0.36106,-0.186033,0.296314>
+,<0.357197,-0.183273,0.302167>
+,<0.353573,-0.180686,0.307616>
+,<0.350099,-0.178212,0.312794>
+,<0.346704,-0.175796,0.317814>
+,<0.30802,-0.229117,0.320982>
+,<0.494526,0.0283571,-0.109181>
+,<0.492767,-0.102085,0.0642728>
+,<0.492143,0.138446,0.0462469>
+,<0.460679,-0.160225,-0.129095>
+,<0.473675,0.186799,0.0401839>
+,<0.482582,0.163764,0.0430852>
+,<0.464699,0.209468,0.0373036>
+,<0.45493,0.233576,0.0342141>
+,<0.330538,0.333943,0.20512>
+,<0.407265,0.332484,0.0113582>
+,<0.152604,0.456084,0.160637>
+,<0.278773,0.365526,0.20881>
+,<0.447166,0.198798,-0.104186>
+,<0.468791,-0.111976,0.175881>
+,<0.408452,0.197851,0.213997>
+,<0.403121,0.204985,0.219039>
+,<0.406425,0.200609,0.215882>
+,<0.418115,0.184823,0.20472>
+,<0.420937,0.180958,0.201982>
+,<0.423466,0.177468,0.199506>
+,<0.425786,0.174242,0.197215>
+,<0.42796,0.171194,0.195048>
+,<0.430038,0.168254,0.192955>
+,<0.432065,0.165363,0.190895>
+,<0.43408,0.162464,0.188827>
+,<0.436122,0.159501,0.18671>
+,<0.438232,0.156411,0.184501>
+,<0.440459,0.153124,0.182148>
+,<0.442861,0.149549,0.179586>
+,<0.445514,0.145569,0.176731>
+,<0.448525,0.141018,0.173464>
+,<0.452048,0.135658,0.169611>
+,<0.456321,0.129114,0.164904>
+,<0.461737,0.120773,0.1589>
+,<0.469,0.10953,0.150801>
+,<0.484713,-0.105727,0.10418>
+,<0.477754,-0.10858,0.136383>
+,<0.463967,-0.0822286,0.201>
+,<0.470266,-0.174619,-0.0797222>
+,<0.511791,0.0194568,-0.0320372>
+,<0.489177,-0.141884,-0.0245437>
+,<0.473317,-0.0637019,-0.14822>
+,<0.509467,0.0597739,-0.0198378>
+,<0.495541,0.129309,0.0474115>
+,<0.490384,0.143141,0.045691>
+,<0.485577,0.15589,0.0440989>
+,<0.480997,0.167897,0.0425935>
+,<0.476543,0.179435,0.0411408>
+,<0.472127,0.190741,0.0397115>
+,<0.467664,0.202031,0.038278>
+,<0.463068,0.213525,0.0368126>
+,<0.458242,0.225457,0.0352851>
+,<0.453072,0.238097,0.0336604>
+,<0.447417,0.251779,0.0318949>
+,<0.441086,0.266942,0.0299311>
+,<0.452891,0.197749,-0.0765836>
+,<0.447298,0.198827,-0.103488>
+,<0.402786,0.321569,0.0676633>
+,<0.26153,0.419092,0.0783452>
+,<0.248661,0.383397,0.210744>
+,<0.156643,0.447645,0.178689>
+,<0.150391,0.464348,0.139599>
+,<0.150072,0.471473,0.118271>
+,<0.259127,0.420211,0.0802398>
+,<0.309565,0.26178,0.314476>
+,<0.157013,0.395497,0.268231>
+,<0.434716,0.190815,0.158152>
+,<0.216691,-0.386087,-0.289223>
+,<0.215157,-0.386301,-0.289181>
+,<0.179479,-0.4479,-0.190542>
+,<0.225632,-0.42303,-0.22429>
+,<0.0158291,-0.518731,-0.0886407>
+,<0.0759644,-0.493971,-0.126273>
+,<0.215539,-0.450935,-0.0217141>
+,<0.215597,-0.451352,-0.0136303>
+,<0.215464,-0.450519,-0.0288434>
+,<0.215666,-0.452725,0.0203986>
+,<0.21557,-0.451141,-0.017842>
+,<0.21542,-0.450302,-0.0322588>
+,<0.215086,-0.448934,-0.0506442>
+,<0.214702,-0.447554,-0.0664386>
+,<0.215248,-0.449562,-0.0427248>
+,<0.0988395,-0.484216,-0.140538>
+,<0.00480079,-0.523178,-0.0817001>
+,<-0.292863,-0.420715,-0.00680336>
+,<-0.285245,-0.38616,-0.148067>
+,<-0.239102,-0.430585,-0.0944348>
+,<-0.19539,-0.443791,-0.124681>
+,<-0.220537,-0.458344,0.0336049>
+,<-0.177451,-0.477007,0.0395389>
+,<-0.151811,-0.487753,0.043019>
+,<0.189164,-0.465646,0.0918556>
+,<0.101943,-0.499612,0.111566>
+,<-0.0817685,-0.516219,0.0524604>
+,<-0.182761,-0.448445,-0.127452>
+,<-0.209532,-0.439785,-0.115034>
+,<-0.267035,-0.380266,-0.19154>
+,<-0.277471,-0.417845,-0.0673104>
+,<-0.178734,-0.450409,-0.126005>
+,<-0.190305,-0.391847,-0.265134>
+,<-0.191566,-0.422588,-0.188938>
+,<-0.0600667,-0.419726,-0.276289>
+,<-0.0596627,-0.419697,-0.276316>
+,<-0.100581,-0.415756,-0.282388>
+,<-0.0155504,-0.416107,-0.279583>
+,<-0.015402,-0.416096,-0.27959>
+,<-0.0257346,-0.416959,-0.278841>
+,<0.00502026,-0.414305,-0.281017>
+,<0.00510697,-0.414299,-0.28102>
+,<-0.00058386,-0.414813,-0.280634>
+,<0.0145947,-0.413402,-0.281638>
+,<0.0100991,-0.413834,-0.28135>
+,<0.0226457,-0.412593,-0.282128>
+,<0.0187399,-0.412992,-0.281895>
+,<0.0337113,-0.411389,-0.282745>
+,<0.0264023,-0.412197,-0.282345>
+,<0.0300871,-0.411796,-0.28255>
+,<0.045511,-0.409991,-0.283322>
+,<0.0375288,-0.410951,-0.282938>
+,<0.0414352,-0.410488,-0.283129>
+,<0.0606703,-0.408056,-0.283968>
+,<0.0500786,-0.409423,-0.283523>
+,<0.0550739,-0.408786,-0.283737>
+,<0.0857884,-0.404656,-0.284908>
+,<0.0674648,-0.407155,-0.284231>
+,<0.075616,-0.406054,-0.284537>
+,<0.120108,-0.399854,-0.286081>
+,<0.099914,-0.402693,-0.285398>
+,<0.255705,-0.402477,-0.253196>
+,<0.264729,-0.39624,-0.261912>
+,<0.255479,-0.387196,-0.279222>
+,<0.249527,-0.381373,-0.290272>
+,<0.256402,-0.388114,-0.277483>
+,<0.0339636,-0.431711,-0.250744>
+,<-0.103879,0.417496,0.265623>
+,<-0.149602,0.457785,0.193545>
+,<-0.305695,-0.369086,0.142815>
+,<-0.299852,-0.368153,0.158012>
+,<-0.0126571,-0.440089,0.275351>
+,<-0.284547,-0.140884,0.397974>
+,<-0.196983,0.0402803,0.478107>
+,<-0.038878,0.109283,0.499275>
+,<-0.10847,-0.100141,0.483705>
+,<-0.251235,-0.188723,0.400716>
+,<-0.259744,0.270955,0.35091>
+,<-0.162072,-0.445182,0.16277>
+,<-0.356891,-0.110945,0.343304>
+,<-0.202555,-0.318961,0.361109>
+,<-0.182547,-0.432693,0.172286>
+,<-0.14016,0.0769155,0.486915>
+,<-0.099819,0.102622,0.492384>
+,<-0.295705,0.211227,0.362353>
+,<-0.421929,0.090701,0.274683>
+,<-0.228372,0.0629375,0.455892>
+,<-0.265255,0.0897078,0.428949>
+,<-0.0130363,-0.0191754,0.49989>
+,<-0.0393113,0.142922,0.498538>
+,<-0.0564141,-0.131147,0.487364>
+,<-0.276097,0.273768,0.339099>
+,<-0.203859,0.277921,0.37266>
+,<-0.300452,0.282513,0.298258>
+,<-0.332921,0.291824,0.244015>
+,<-0.328991,0.290713,0.25073>
+,<-0.313876,0.286412,0.276123>
+,<-0.243674,0.325711,0.299991>
+,<-0.294096,0.280616,0.308675>
+,<-0.229911,0.44444,0.0232739>
+,<-0.203844,0.383765,0.255018>
+,<-0.282512,0.410329,0.108857>
+,<-0.215883,0.45088,0.12329>
+,<-0.165353,0.436518,0.211442>
+,<-0.207885,0.378082,0.259588>
+,<-0.27266,0.416464,0.111032>
+,<-0.17455,0.46341,-0.0968031>
+,<-0.264285,0.294322,0.32322>
+,<-0.241264,0.418147,-0.145806>
+,<-0.351645,0.365137,-0.0288039>
+,<-0.284418,0.407641,-0.0743504>
+,<-0.440916,0.285525,-0.0168528>
+,<-0.403264,0.101104,0.294612>
+,<0.0992733,0.435977,0.226127>
+,<-0.445195,0.0378418,-0.272748>
+,<-0.517134,0.00072693,-0.104274>
+,<-0.402009,0.309719,0.12086>
+,<-0.463654,0.0489582,0.229698>
+,<-0.33363,-0.120766,0.361345>
+,<-0.42304,-0.151298,0.246156>
+,<-0.33107,0.00405937,0.375294>
+,<-0.30211,-0.368499,0.152238>
+,<-0.347928,-0.208247,-0.325085>
+,<-0.491563,-0.202126,-0.0346805>
+,<-0.387883,-0.247363,-0.224291>
+,<-0.525859,-0.00404957,-0.0824868>
+,<-0.39258,-0.0587019,-0.325579>
+,<-0.528354,0.0325679,-0.0364423>
+,<-0.1631,0.0621806,0.483498>
+,<-0.398497,-0.107248,0.301354>
+,<-0.342128,0.134074,0.357167>
+,<-0.461118,0.055036,0.232362>
+,<-0.31122,-0.369791,0.128079>
+,<-0.377121,0.208972,0.25399>
+,<-0.0472847,-0.00608664,-0.498129>
+,<-0.180607,0.24767,-0.412239>
+,<-0.268359,0.332856,-0.25938>
+,<-0.311225,0.166482,-0.384528>
+,<-0.269283,0.332893,-0.258343>
+,<-0.324971,0.29529,-0.246524>
+,<-0.270228,0.333024,-0.257155>
+,<-0.302709,0.313499,-0.247169>
+,<-0.271189,0.333264,-0.255799>
+,<-0.291941,0.322288,-0.247477>
+,<-0.2722,0.333615,-0.254235>
+,<-0.285484,0.327541,-0.247661>
+,<-0.273239,0.334112,-0.252435>
+,<-0.281099,0.331089,-0.247791>
+,<-0.274191,0.334823,-0.250435>
+,<-0.277844,0.333693,-0.24791>
+,<-0.275008,0.335774,-0.248249>
+,<-0.27503,0.335769,-0.248231>
+,<-0.275772,0.336828,-0.245968>
+,<-0.272917,0.337653,-0.248014>
+,<-0.276531,0.339066,-0.242049>
+,<-0.276594,0.340208,-0.2404>
+,<-0.269775,0.340186,-0.248017>
+,<-0.276341,0.343064,-0.236696>
+,<-0.27611,0.343914,-0.235761>
+,<-0.267229,0.342189,-0.248041>
+,<-0.274449,0.347441,-0.23263>
+,<-0.274086,0.348013,-0.232218>
+,<-0.2737,0.348561,-0.231867>
+,<-0.273296,0.349082,-0.231574>
+,<-0.272877,0.349577,-0.231334>
+,<-0.264954,0.34395,-0.248058>
+,<-0.2703,0.352086,-0.230591>
+,<-0.269848,0.352451,-0.230562>
+,<-0.269382,0.352803,-0.230568>
+,<-0.268903,0.353139,-0.230609>
+,<-0.268411,0.35346,-0.230688>
+,<-0.267907,0.353764,-0.230803>
+,<-0.262747,0.345631,-0.248068>
+,<-0.264499,0.355368,-0.232201>
+,<-0.263835,0.355597,-0.232587>
+,<-0.263148,0.355795,-0.233043>
+,<-0.262442,0.355955,-0.233574>
+,<-0.260428,0.34737,-0.248072>
+,<-0.259227,0.356252,-0.236584>
+,<-0.258273,0.356219,-0.23764>
+,<-0.25736,0.356058,-0.238839>
+,<-0.257776,0.349323,-0.248074>
+,<-0.254317,0.35493,-0.24364>
+,<-0.254347,0.35175,-0.248158>
+,<-0.257632,0.336836,-0.265265>
+,<-0.25325,0.354225,-0.245749>
+,<-0.256215,0.350452,-0.248085>
+,<-0.255401,0.355433,-0.241793>
+,<-0.256345,0.35583,-0.240234>
+,<-0.259161,0.348308,-0.248072>
+,<-0.260063,0.356267,-0.23567>
+,<-0.260889,0.356209,-0.234872>
+,<-0.261702,0.356085,-0.234182>
+,<-0.261613,0.346485,-0.24807>
+,<-0.265121,0.355139,-0.231857>
+,<-0.265714,0.354901,-0.231555>
+,<-0.266291,0.35464,-0.231304>
+,<-0.266849,0.35436,-0.2311>
+,<-0.267388,0.354063,-0.230941>
+,<-0.263853,0.344792,-0.248064>
+,<-0.270752,0.351714,-0.230624>
+,<-0.271198,0.351324,-0.23069>
+,<-0.271633,0.350916,-0.230793>
+,<-0.272057,0.350489,-0.230936>
+,<-0.272468,0.350044,-0.23112>
+,<-0.266072,0.343088,-0.24805>
+,<-0.274827,0.34682,-0.233089>
+,<-0.275194,0.346156,-0.23362>
+,<-0.275522,0.34546,-0.234238>
+,<-0.275798,0.344738,-0.234951>
+,<-0.268452,0.341231,-0.248029>
+,<-0.276494,0.342179,-0.237766>
+,<-0.276632,0.341177,-0.239008>
+,<-0.273653,0.337271,-0.247719>
+,<-0.27573,0.336972,-0.245818>
+,<-0.271782,0.338677,-0.247872>
+,<-0.276263,0.338458,-0.243188>
+,<-0.270239,0.33988,-0.247928>
+,<-0.276586,0.340258,-0.240339>
+,<-0.268869,0.34095,-0.247961>
+,<-0.276441,0.342369,-0.23756>
+,<-0.267615,0.341926,-0.247984>
+,<-0.275798,0.344738,-0.234951>
+,<-0.266438,0.342838,-0.248001>
+,<-0.274556,0.34725,-0.232782>
+,<-0.26531,0.343708,-0.248012>
+,<-0.27272,0.349749,-0.231264>
+,<-0.264205,0.344553,-0.24802>
+,<-0.270356,0.352036,-0.2306>
+,<-0.263103,0.345392,-0.248024>
+,<-0.267623,0.353922,-0.230888>
+,<-0.261981,0.346241,-0.248025>
+,<-0.264734,0.355274,-0.232083>
+,<-0.260816,0.347116,-0.248021>
+,<-0.261909,0.356038,-0.234027>
+,<-0.259582,0.348039,-0.248013>
+,<-0.259327,0.356245,-0.236488>
+,<-0.258244,0.349034,-0.247998>
+,<-0.257104,0.35596,-0.239251>
+,<-0.25676,0.350136,-0.247973>
+,<-0.255284,0.355323,-0.242073>
+,<-0.255061,0.351403,-0.247921>
+,<-0.253886,0.35438,-0.244875>
+,<-0.252976,0.353056,-0.247701>
+,<-0.252887,0.353236,-0.247536>
+,<-0.251847,0.352639,-0.249441>
+,<-0.250937,0.35416,-0.248201>
+,<-0.251438,0.35134,-0.251692>
+,<-0.247849,0.35649,-0.248003>
+,<-0.251189,0.350154,-0.253609>
+,<-0.243856,0.359375,-0.247908>
+,<-0.251292,0.346483,-0.258606>
+,<-0.251144,0.347072,-0.257941>
+,<-0.251328,0.346145,-0.259035>
+,<-0.211393,0.444227,-0.110001>
+,<-0.251532,0.345305,-0.259983>
+,<-0.0534068,0.422884,-0.297952>
+,<-0.251823,0.344488,-0.260811>
+,<-0.0506319,0.421847,-0.302429>
+,<-0.257453,0.174424,-0.420162>
+,<-0.159829,0.390295,-0.284852>
+,<0.00266621,0.453155,-0.245091>
+,<-0.015516,0.442649,-0.264755>
+,<-0.25213,0.343735,-0.26153>
+,<-0.035331,0.430982,-0.286066>
+,<-0.252442,0.343042,-0.26216>
+,<0.0380805,0.473038,-0.206462>
+,<-0.252797,0.342379,-0.262704>
+,<0.0291881,0.46248,0.188136>
+,<-0.253185,0.341749,-0.263169>
+,<-0.176164,0.462594,-0.0973679>
+,<-0.253555,0.341168,-0.263582>
+,<-0.213769,0.346239,-0.292884>
+,<-0.253932,0.340619,-0.263942>
+,<-0.0766314,0.383288,-0.358464>
+,<-0.254329,0.340097,-0.264245>
+,<-0.376268,0.161012,-0.33557>
+,<-0.254742,0.3396,-0.264497>
+,<-0.115188,0.333781,-0.37892>
+,<-0.255168,0.339129,-0.2647>
+,<-0.243601,0.329394,-0.286915>
+,<-0.255576,0.338681,-0.264888>
+,<-0.165153,0.268332,-0.404578>
+,<-0.255994,0.338251,-0.265039>
+,<-0.142081,0.298795,-0.392888>
+,<-0.256425,0.33784,-0.265151>
+,<-0.157595,0.278362,-0.400782>
+,<-0.256868,0.337447,-0.265225>
+,<-0.0769618,0.384813,-0.356693>
+,<-0.257321,0.337074,-0.265264>
+,<-0.157399,0.377503,-0.303739>
+,<-0.257779,0.336714,-0.265277>
+,<-0.0981095,0.389761,-0.335949>
+,<-0.258241,0.336358,-0.265279>
+,<-0.324748,0.165388,-0.374494>
+,<-0.258716,0.336017,-0.265245>
+,<-0.260973,0.319098,-0.283159>
+,<-0.259206,0.335692,-0.265176>
+,<-0.264372,0.317069,-0.282329>
+,<-0.25971,0.335384,-0.265069>
+,<-0.114077,-0.0167465,-0.489828>
+,<-0.260228,0.335093,-0.264925>
+,<-0.418666,0.320902,0.0277051>
+,<-0.260762,0.334799,-0.264764>
+,<-0.284387,0.16858,-0.404199>
+,<-0.261318,0.334512,-0.264569>
+,<-0.267526,0.417594,-0.0854694>
+,<-0.261894,0.334245,-0.264328>
+,<-0.439868,0.146155,0.204509>
+,<-0.262489,0.333999,-0.264036>
+,<-0.360377,-0.220341,-0.294526>
+,<-0.263102,0.333779,-0.263691>
+,<-0.467579,-0.232747,-0.0667339>
+,<-0.263757,0.333553,-0.263308>
+,<-0.300429,-0.201419,-0.389505>
+,<-0.264445,0.333344,-0.262864>
+,<-0.296811,-0.367676,0.165758>
+,<-0.265157,0.333173,-0.262345>
+,<-0.392202,-0.251655,-0.212823>
+,<-0.265886,0.333049,-0.261744>
+,<-0.273923,0.311171,-0.280057>
+,<-0.266683,0.332926,-0.261064>
+,<-0.209509,-0.062349,-0.460751>
+,<0.338047,-0.180859,-0.321238>
+,<0.344352,-0.189472,-0.309068>
+,<0.341766,-0.17074,-0.322925>
+,<0.417953,-0.106483,-0.266068>
+,<0.342262,-0.170511,-0.322497>
+,<0.390339,-0.0952393,-0.307097>
+,<0.342834,-0.170292,-0.321978>
+,<0.375842,-0.125384,-0.30804>
+,<0.343492,-0.170095,-0.321349>
+,<0.368638,-0.14033,-0.308497>
+,<0.344248,-0.169938,-0.320587>
+,<0.364254,-0.149394,-0.308767>
+,<0.345112,-0.169846,-0.319667>
+,<0.361252,-0.155575,-0.308947>
+,<0.34621,-0.169762,-0.318476>
+,<0.359024,-0.160134,-0.309076>
+,<0.347522,-0.169787,-0.31698>
+,<0.35727,-0.163697,-0.309177>
+,<0.348943,-0.170056,-0.315222>
+,<0.355814,-0.166609,-0.30927>
+,<0.350955,-0.170442,-0.312722>
+,<0.354516,-0.16909,-0.309402>
+,<0.348618,-0.180863,-0.30945>
+,<0.36032,-0.185045,-0.293669>
+,<0.360407,-0.184832,-0.293693>
+,<0.360489,-0.184611,-0.293729>
+,<0.360565,-0.184382,-0.293776>
+,<0.360635,-0.184143,-0.293835>
+,<0.360698,-0.183893,-0.293909>
+,<0.360753,-0.183631,-0.293999>
+,<0.360801,-0.183355,-0.294106>
+,<0.360838,-0.183064,-0.294233>
+,<0.360865,-0.182755,-0.294383>
+,<0.360878,-0.182426,-0.29456>
+,<0.360875,-0.182076,-0.294767>
+,<0.360853,-0.181702,-0.29501>
+,<0.350227,-0.177747,-0.309438>
+,<0.350951,-0.176535,-0.30931>
+,<0.35976,-0.177894,-0.298459>
+,<0.351041,-0.176131,-0.309438>
+,<0.351816,-0.17487,-0.309271>
+,<0.357656,-0.174915,-0.302565>
+,<0.351877,-0.174411,-0.309461>
+,<0.352773,-0.173085,-0.309182>
+,<0.355048,-0.172795,-0.306744>
+,<0.352629,-0.172272,-0.309801>
+,<0.354096,-0.17148,-0.308564>
+,<0.359129,-0.176675,-0.299875>
+,<0.359651,-0.177633,-0.298733>
+,<0.355725,-0.189246,-0.296411>
+,<0.355139,-0.189425,-0.296968>
+,<0.346929,-0.184045,-0.309469>
+,<0.350076,-0.189772,-0.302481>
+,<0.348387,-0.189468,-0.304563>
+,<0.344838,-0.187617,-0.309658>
+,<0.346184,-0.18891,-0.307369>
+,<0.345992,-0.18575,-0.309497>
+,<0.351489,-0.18987,-0.300829>
+,<0.352616,-0.189877,-0.299552>
+,<0.353609,-0.189764,-0.298498>
+,<0.354467,-0.189578,-0.297639>
+,<0.347794,-0.182429,-0.309458>
+,<0.358047,-0.18797,-0.294534>
+,<0.358297,-0.187778,-0.294363>
+,<0.358525,-0.187585,-0.294217>
+,<0.358734,-0.187393,-0.294092>
+,<0.358926,-0.187201,-0.293986>
+,<0.359104,-0.187009,-0.293898>
+,<0.359268,-0.186817,-0.293824>
+,<0.35942,-0.186625,-0.293763>
+,<0.359561,-0.186433,-0.293715>
+,<0.359693,-0.186241,-0.293679>
+,<0.359816,-0.186047,-0.293653>
+,<0.35993,-0.185851,-0.293638>
+,<0.360037,-0.185654,-0.293633>
+,<0.360137,-0.185454,-0.293637>
+,<0.360229,-0.185251,-0.293652>
+,<0.349424,-0.179313,-0.309444>
+,<0.360818,-0.18128,-0.295295>
+,<0.360762,-0.180803,-0.295634>
+,<0.360669,-0.18028,-0.296043>
+,<0.360527,-0.179708,-0.296535>
+,<0.360322,-0.179083,-0.29713>
+,<0.360036,-0.178406,-0.297847>
+,<0.357438,-0.174594,-0.302995>
+,<0.358411,-0.175676,-0.301267>
+,<0.357767,-0.188178,-0.294729>
+,<0.357095,-0.188616,-0.295231>
+,<0.357451,-0.188396,-0.294958>
+,<0.35624,-0.189045,-0.295945>
+,<0.356694,-0.188834,-0.295556>
+,<0.350127,-0.178128,-0.309333>
+,<0.360832,-0.181519,-0.295141>
+,<0.349321,-0.179684,-0.309345>
+,<0.36026,-0.185176,-0.29366>
+,<0.348515,-0.181237,-0.309348>
+,<0.357955,-0.188034,-0.294601>
+,<0.347694,-0.182818,-0.30934>
+,<0.354528,-0.189559,-0.297582>
+,<0.346844,-0.184469,-0.309311>
+,<0.350837,-0.189767,-0.301627>
+,<0.345971,-0.186282,-0.3092>
+,<0.347504,-0.189026,-0.305822>
+,<0.339698,-0.197577,-0.309218>
+,<0.338813,-0.182463,-0.31944>
+,<0.338367,-0.18163,-0.320428>
+,<0.336921,-0.202498,-0.309203>
+,<0.308981,-0.252607,-0.308135>
+,<0.337819,-0.180136,-0.321918>
+,<0.236039,-0.360037,-0.318788>
+,<0.337522,-0.179079,-0.322865>
+,<-0.154672,-0.321819,-0.398856>
+,<0.337452,-0.176397,-0.324506>
+,<-0.0369374,-0.0119304,-0.49871>
+,<0.318773,-0.0847762,-0.386888>
+,<0.0998977,-0.0190563,-0.498738>
+,<-0.160524,-0.309877,-0.408018>
+,<0.384948,0.0663104,-0.324132>
+,<0.440563,-0.0660104,-0.231859>
+,<0.453709,0.0672921,-0.210739>
+,<0.425203,0.0670035,-0.25967>
+,<0.141996,0.18922,-0.44747>
+,<0.43755,0.0671199,-0.23885>
+,<0.243304,-0.369978,-0.305402>
+,<0.338858,-0.17301,-0.324888>
+,<0.237101,-0.361469,-0.316857>
+,<0.133741,-0.352611,-0.342559>
+,<0.33739,-0.178163,-0.323546>
+,<0.174208,-0.355552,-0.333247>
+,<0.337367,-0.177757,-0.323808>
+,<0.221308,-0.282059,-0.379076>
+,<0.337365,-0.177381,-0.324029>
+,<0.226673,-0.310084,-0.357653>
+,<0.337381,-0.177031,-0.324215>
+,<0.10327,-0.350275,-0.349504>
+,<0.33741,-0.176706,-0.324372>
+,<0.0383989,-0.344621,-0.363541>
+,<0.337451,-0.176403,-0.324504>
+,<-0.00753627,-0.339701,-0.372474>
+,<0.337487,-0.176127,-0.324622>
+,<-0.0671399,-0.33264,-0.383323>
+,<0.337533,-0.175864,-0.324723>
+,<0.294431,-0.119348,-0.394459>
+,<0.337587,-0.175612,-0.324807>
+,<0.216265,-0.0179422,-0.451457>
+,<0.337649,-0.175371,-0.324878>
+,<0.198916,-0.0240129,-0.459209>
+,<0.337717,-0.175139,-0.324935>
+,<0.0905336,-0.115703,-0.49556>
+,<0.337792,-0.174914,-0.32498>
+,<0.176394,-0.209768,-0.438102>
+,<0.337874,-0.174697,-0.325014>
+,<-0.0130187,-0.0253495,-0.499473>
+,<0.337962,-0.174486,-0.325038>
+,<0.0880176,0.0595821,-0.496868>
+,<0.338056,-0.17428,-0.325052>
+,<0.0975339,0.0460055,-0.496122>
+,<0.338157,-0.174078,-0.325055>
+,<0.154451,-0.195547,-0.451505>
+,<0.338264,-0.173881,-0.325049>
+,<0.225107,-0.0148252,-0.447373>
+,<0.338378,-0.173688,-0.325033>
+,<0.0317532,-0.343956,-0.364885>
+,<0.3385,-0.173497,-0.325007>
+,<0.253596,-0.00473079,-0.433743>
+,<0.33863,-0.173309,-0.324971>
+,<0.251012,0.142996,-0.41426>
+,<0.338768,-0.173122,-0.324924>
+,<0.121589,0.312487,-0.379974>
+,<0.338914,-0.172934,-0.324868>
+,<0.0787608,0.0795522,-0.496099>
+,<0.399071,-0.0922865,-0.297989>
+,<0.33907,-0.172738,-0.324806>
+,<0.44007,0.0671766,-0.234516>
+,<0.339239,-0.172541,-0.324729>
+,<0.459469,0.0673317,-0.200547>
+,<0.339423,-0.172343,-0.324635>
+,<0.444198,0.0672154,-0.227382>
+,<0.339625,-0.172143,-0.324524>
+,<0.428835,0.0670509,-0.253608>
+,<0.339845,-0.171941,-0.324391>
+,<0.421509,0.0669519,-0.265781>
+,<0.340088,-0.171738,-0.324235>
+,<0.40442,0.0666756,-0.293439>
+,<0.340357,-0.171534,-0.324051>
+,<0.365911,0.161209,-0.30575>
+,<0.340654,-0.171331,-0.323834>
+,<0.341353,-0.170931,-0.323279>
+,<0.340984,-0.171129,-0.323579>
+,<0.253252,-0.329724,0.285746>
+,<0.219695,-0.401332,0.201995>
+,<0.292829,-0.369248,0.180926>
+,<0.254611,-0.344501,0.265269>
+,<0.280502,-0.364789,0.204278>
+,<0.273323,-0.362114,0.217661>
+,<0.219707,-0.401756,0.201166>
+,<0.269803,-0.36078,0.22416>
+,<0.221131,-0.389008,0.223356>
+,<0.215214,-0.39474,0.218796>
+,<0.353739,-0.242576,0.262815>
+,<0.233993,-0.37645,0.233272>
+,<0.335783,-0.255452,0.27165>
+,<0.31758,-0.268206,0.280342>
+,<0.219276,-0.399972,0.205024>
+,<0.255489,-0.355136,0.250259>
+,<0.218928,-0.39953,0.206218>
+,<0.248903,-0.361854,0.244742>
+,<0.218504,-0.399022,0.207606>
+,<0.233707,-0.376741,0.233032>
+,<0.217891,-0.398567,0.209079>
+,<0.225878,-0.384393,0.226997>
+,<0.217115,-0.398083,0.210762>
+,<0.221027,-0.389121,0.223254>
+,<0.216082,-0.397712,0.212486>
+,<0.21767,-0.392384,0.220659>
+,<0.214814,-0.397267,0.214568>
+,<0.215165,-0.394816,0.218706>
+,<0.213155,-0.396681,0.217279>
+,<0.210232,-0.399527,0.214914>
+,<0.208852,-0.396985,0.22091>
+,<0.207293,-0.397091,0.222213>
+,<0.207895,-0.401722,0.213116>
+,<0.202992,-0.397918,0.2248>
+,<0.201839,-0.398206,0.225362>
+,<0.20074,-0.39854,0.225784>
+,<0.205911,-0.403563,0.21158>
+,<0.196446,-0.400242,0.226677>
+,<0.195777,-0.400559,0.226711>
+,<0.19515,-0.400881,0.226697>
+,<0.194564,-0.401207,0.226639>
+,<0.194017,-0.401533,0.226542>
+,<0.193507,-0.40186,0.22641>
+,<0.20407,-0.405245,0.21015>
+,<0.190659,-0.404062,0.224926>
+,<0.190331,-0.404383,0.224625>
+,<0.190025,-0.404708,0.224294>
+,<0.189744,-0.405038,0.223931>
+,<0.189488,-0.405372,0.223537>
+,<0.18926,-0.40571,0.22311>
+,<0.202219,-0.406909,0.208711>
+,<0.188299,-0.407946,0.219728>
+,<0.188242,-0.408368,0.218968>
+,<0.188251,-0.408793,0.21814>
+,<0.188338,-0.409216,0.217243>
+,<0.189433,-0.411099,0.212544>
+,<0.190039,-0.41156,0.211067>
+,<0.193098,-0.412863,0.20558>
+,<0.302615,-0.382688,0.14107>
+,<0.191838,-0.412423,0.20766>
+,<0.190813,-0.412036,0.209397>
+,<0.199037,-0.409707,0.206246>
+,<0.189009,-0.410599,0.213924>
+,<0.188665,-0.410151,0.215118>
+,<0.188456,-0.409679,0.216232>
+,<0.200208,-0.408691,0.207143>
+,<0.201211,-0.4078,0.207936>
+,<0.188386,-0.409329,0.21698>
+,<0.201245,-0.407776,0.207952>
+,<0.188392,-0.407542,0.220419>
+,<0.188492,-0.407163,0.22105>
+,<0.188634,-0.406789,0.221632>
+,<0.188814,-0.406421,0.222167>
+,<0.189026,-0.40606,0.222658>
+,<0.203155,-0.406072,0.209439>
+,<0.191006,-0.403746,0.225202>
+,<0.191356,-0.403428,0.225473>
+,<0.191732,-0.403111,0.225717>
+,<0.192135,-0.402796,0.225934>
+,<0.192565,-0.402482,0.226122>
+,<0.193022,-0.40217,0.22628>
+,<0.204982,-0.404415,0.210859>
+,<0.197178,-0.399894,0.226633>
+,<0.197968,-0.399549,0.22653>
+,<0.198815,-0.399215,0.226353>
+,<0.199718,-0.398898,0.226091>
+,<0.206875,-0.402673,0.212326>
+,<0.204334,-0.397587,0.224131>
+,<0.205719,-0.397338,0.223268>
+,<0.209002,-0.400686,0.21397>
+,<0.210734,-0.396859,0.219317>
+,<0.211566,-0.398239,0.215982>
+,<0.211285,-0.39707,0.218397>
+,<0.210179,-0.399562,0.214901>
+,<0.208914,-0.396994,0.220834>
+,<0.20896,-0.400716,0.213955>
+,<0.206189,-0.397299,0.222892>
+,<0.207859,-0.40175,0.213101>
+,<0.203107,-0.397897,0.22473>
+,<0.206841,-0.402698,0.212311>
+,<0.199814,-0.398868,0.226054>
+,<0.205879,-0.403587,0.211565>
+,<0.196508,-0.400215,0.226669>
+,<0.204952,-0.404438,0.210845>
+,<0.19346,-0.401892,0.226394>
+,<0.204039,-0.405268,0.210136>
+,<0.190955,-0.403796,0.225155>
+,<0.203124,-0.406095,0.209424>
+,<0.189222,-0.405774,0.223024>
+,<0.202188,-0.406933,0.208696>
+,<0.188375,-0.407663,0.220203>
+,<0.200171,-0.408717,0.207127>
+,<0.189122,-0.41069,0.213641>
+,<0.190412,-0.411717,0.210409>
+,<0.199081,-0.409679,0.206262>
+,<0.192018,-0.412438,0.20746>
+,<0.197826,-0.410771,0.20528>
+,<0.196391,-0.412014,0.204151>
+,<0.197771,-0.410804,0.205266>
+,<0.196267,-0.41207,0.204157>
+,<0.194045,-0.412809,0.204788>
+,<0.186485,-0.420417,0.196435>
+,<0.181183,-0.424888,0.192264>
+,<0.200695,-0.413035,0.197875>
+,<0.186374,-0.420521,0.196327>
+,<0.173037,-0.431713,0.185905>
+,<0.109061,-0.485183,0.135805>
+,<0.203648,-0.412538,0.195967>
+,<0.172731,-0.431978,0.185646>
+,<0.204981,-0.412214,0.1953>
+,<0.156086,-0.445909,0.172607>
+,<0.215541,-0.451296,-0.0152205>
+,<0.215602,-0.451991,0.000306008>
+,<0.208251,-0.411233,0.194016>
+,<0.215566,-0.451511,-0.0107237>
+,<0.215612,-0.452274,0.0074649>
+,<0.215614,-0.452609,0.0164577>
+,<0.215516,-0.45444,0.0715911>
+,<0.209153,-0.410913,0.193756>
+,<0.21079,-0.410231,0.193483>
+,<0.215629,-0.453827,0.0533801>
+,<0.211247,-0.45663,0.0867622>
+,<0.211365,-0.409957,0.193455>
+,<0.25712,-0.431601,0.0888202>
+,<0.236539,-0.443219,0.0873124>
+,<-0.00162104,-0.526699,-0.0657178>
+,<0.19459,-0.440811,-0.19987>
+,<0.214857,-0.448099,-0.0603784>
+,<0.212186,-0.409569,0.193403>
+,<0.213397,-0.408919,0.193479>
+,<0.210887,-0.434807,-0.19492>
+,<0.22207,-0.451254,0.0862649>
+,<0.226184,-0.448984,0.0865439>
+,<0.214425,-0.408286,0.193705>
+,<0.213944,-0.408593,0.193578>
+,<0.246786,-0.437462,0.0880664>
+,<0.214454,-0.408269,0.193711>
+,<0.214938,-0.407958,0.193838>
+,<0.242787,-0.439709,0.0878008>
+,<0.265722,-0.423811,0.0959213>
+,<0.215394,-0.407645,0.193997>
+,<0.215823,-0.407331,0.194187>
+,<0.262238,-0.427356,0.0921979>
+,<0.278605,-0.410504,0.109901>
+,<0.216225,-0.407015,0.194405>
+,<0.216601,-0.406699,0.194651>
+,<0.275548,-0.413671,0.106621>
+,<0.296344,-0.391744,0.129269>
+,<0.284605,-0.404219,0.116435>
+,<0.287576,-0.401071,0.11972>
+,<0.21695,-0.406383,0.194923>
+,<0.217626,-0.405743,0.195497>
+,<0.293432,-0.394848,0.126121>
+,<0.21793,-0.405418,0.19583>
+,<0.299333,-0.388517,0.13259>
+,<0.21821,-0.405088,0.196194>
+,<0.329707,-0.337033,0.174022>
+,<0.218465,-0.404755,0.196589>
+,<0.297821,-0.371016,0.171358>
+,<0.218692,-0.40442,0.197018>
+,<0.266236,-0.359412,0.2307>
+,<0.254805,-0.347072,0.261688>
+,<0.218699,-0.404408,0.197033>
+,<0.434785,-0.233908,0.0814063>
+,<0.21893,-0.404066,0.197468>
+,<0.37043,-0.318748,0.106394>
+,<0.21914,-0.403704,0.19796>
+,<0.219458,-0.402963,0.19908>
+,<0.219317,-0.403336,0.198497>
+,<0.0659433,-0.301164,0.400051>
+,<0.120403,-0.318854,0.382866>
+,<0.172023,-0.175948,0.448495>
+,<0.171485,-0.166335,0.453208>
+,<0.169636,-0.135806,0.468006>
+,<0.171315,-0.163765,0.454472>
+,<0.142745,-0.105297,0.486194>
+,<0.148273,-0.104466,0.485777>
+,<0.164691,-0.102109,0.484484>
+,<0.097899,-0.111724,0.489448>
+,<0.094203,-0.112276,0.48969>
+,<0.108397,-0.110249,0.488719>
+,<0.0691646,-0.11582,0.491269>
+,<0.081251,-0.114115,0.49053>
+,<0.0464547,-0.11899,0.492527>
+,<0.0576481,-0.117433,0.491929>
+,<0.0157923,-0.123176,0.493945>
+,<0.0353636,-0.120522,0.493076>
+,<0.024162,-0.122059,0.493586>
+,<-0.00392044,-0.0640667,0.497858>
+,<-0.0203086,0.0168556,0.50031>
+,<-0.143711,-0.0788782,0.480417>
+,<-0.196877,0.0363965,0.478003>
+,<-0.0459091,-0.203706,0.461634>
+,<-0.230976,-0.0999369,0.443177>
+,<-0.058512,0.12878,0.497299>
+,<-0.271569,-0.146074,0.407409>
+,<-0.243771,-0.209369,0.394796>
+,<-0.259034,-0.16682,0.406825>
+,<-0.0138256,-0.015275,0.499993>
+,<0.00604364,-0.112991,0.494938>
+,<-0.346617,-0.0443529,0.359017>
+,<-0.0283583,0.0568932,0.499995>
+,<-0.0722523,0.120109,0.495727>
+,<-0.0484712,-0.215496,0.456021>
+,<-0.199184,-0.327745,0.358293>
+,<-0.0478136,-0.212565,0.457426>
+,<0.0334408,-0.284884,0.412897>
+,<-0.0808425,-0.256252,0.429136>
+,<0.000700244,-0.428397,0.286694>
+,<0.0945318,-0.343566,0.364562>
+,<0.147545,-0.374071,0.297671>
+,<-0.00884287,-0.47658,0.218147>
+,<0.147937,-0.374397,0.297027>
+,<-0.0401611,-0.246505,0.439788>
+,<0.140102,-0.36684,0.311181>
+,<-0.240622,-0.334472,0.312523>
+,<0.015703,-0.275829,0.419671>
+,<-0.131851,-0.375066,0.324592>
+,<-0.277239,-0.346532,0.257753>
+,<0.131348,-0.312058,0.384955>
+,<0.153893,-0.297933,0.389146>
+,<0.171258,-0.286973,0.392255>
+,<0.176724,-0.266995,0.401895>
+,<0.176259,-0.256623,0.407364>
+,<0.175114,-0.23307,0.419654>
+,<0.173996,-0.21135,0.430785>
+,<0.176874,-0.269797,0.400401>
+,<0.177464,-0.283004,0.393372>
+,<0.177376,-0.2813,0.394287>
+,<0.175542,-0.242102,0.414974>
+,<0.174981,-0.230794,0.420837>
+,<0.174424,-0.219886,0.426442>
+,<0.173861,-0.209156,0.431905>
+,<0.173281,-0.198399,0.43733>
+,<0.172673,-0.187404,0.442824>
+,<0.0527917,-0.222753,0.444966>
+,<0.467595,-0.084173,-0.156615>
+,<0.472846,-0.178642,-0.0657348>
+,<0.499366,-0.0987875,0.0291595>
+,<0.506405,0.0448107,-0.0683959>
+,<0.46685,-0.0243536,0.194542>
+,<0.462471,-0.101447,-0.163636>
+,<0.465819,-0.0468684,0.197108>
+,<0.46433,-0.0754189,0.200287>
+,<0.465149,-0.0601106,0.198591>
+,<0.466377,-0.0350906,0.195774>
+,<0.467256,-0.0143431,0.19338>
+,<0.467916,0.00444342,0.191159>
+,<0.468824,0.0423646,0.186501>
+,<0.468976,0.0522912,0.185241>
+,<0.468936,0.0487317,0.185669>
+,<0.468346,0.0191765,0.189348>
+,<0.468095,0.00998166,0.190465>
+,<0.46781,0.000802021,0.191566>
+,<0.467486,-0.00853974,0.192672>
+,<0.467114,-0.0182337,0.193805>
+,<0.466684,-0.028499,0.19499>
+,<0.494837,-0.10108,0.0534866>
+,<0.49076,-0.103032,0.0745236>
+,<0.486771,-0.104835,0.0942842>
+,<0.482558,-0.106635,0.114344>
+,<0.464223,-0.10984,0.196037>
+,<0.46314,-0.0965513,0.202589>
+,<0.463427,-0.0998787,0.200928>
+,<0.472391,-0.11063,0.16022>
+,<0.475486,-0.109448,0.146558>
+,<0.478215,-0.10838,0.134315>
+,<0.480679,-0.107392,0.123076>
+,<0.482949,-0.106456,0.11253>
+,<0.485084,-0.105552,0.102428>
+,<0.487129,-0.104662,0.0925589>
+,<0.489127,-0.103767,0.0827298>
+,<0.491114,-0.102851,0.0727516>
+,<0.493129,-0.101895,0.0624238>
+,<0.495215,-0.100877,0.0515174>
+,<0.49742,-0.099771,0.0397534>
+,<0.499806,-0.098541,0.0267709>
+,<0.502457,-0.0971393,0.0120772>
+,<0.508987,0.0430324,-0.0566173>
+,<0.493673,-0.128052,-0.015267>
+,<0.503498,0.0467924,-0.0814266>
+,<0.495395,-0.122679,-0.0116179>
+,<0.475343,-0.182561,-0.0520148>
+,<0.462374,-0.162695,-0.120716>
+,<0.455624,-0.153064,-0.153115>
+,<0.455184,-0.125528,-0.173395>
+,<0.46871,-0.0803277,-0.155047>
+,<0.477397,-0.0474491,-0.141422>
+,<0.468016,-0.171155,-0.0917109>
+,<0.511592,0.0475454,-0.0317741>
+,<0.509782,0.0579912,-0.0215577>
+,<0.508036,0.0677589,-0.0119964>
+,<0.506317,0.0770826,-0.00286165>
+,<0.504592,0.0861595,0.00603911>
+,<0.502827,0.0951671,0.0148799>
+,<0.50099,0.104278,0.02383>
+,<0.499042,0.113673,0.0330675>
+,<0.496937,0.123556,0.0427933>
+,<0.494336,0.125248,0.0562989>
+,<0.491714,0.120108,0.0708529>
+,<0.489354,0.115561,0.0836888>
+,<0.487176,0.111435,0.0953004>
+,<0.49032,-0.00243348,0.0999044>
+,<-0.239443,0.439001,-0.00388821>
+,<-0.243601,0.436381,-0.0157221>
+,<-0.427627,0.2043,0.175489>
+,<-0.436848,0.161318,0.197006>
+,<-0.480641,0.177438,-0.0253928>
+,<-0.498226,0.125995,-0.0293625>
+,<-0.387269,0.306057,0.14768>
+,<-0.355735,0.363154,0.0922641>
+,<-0.347797,0.295859,0.2183>
+,<-0.364439,0.300229,0.18886>
+,<-0.152544,0.45379,0.196932>
+,<-0.333648,0.29201,0.242789>
+,<-0.249353,0.317117,0.306394>
+,<-0.335953,0.376139,0.096791>
+,<-0.248213,0.318875,0.305072>
+,<-0.312852,0.391095,0.102059>
+,<-0.203051,0.384899,0.254089>
+,<-0.221932,0.357985,0.275431>
+,<-0.200803,0.459813,0.126485>
+,<-0.229153,0.44296,0.120462>
+,<-0.234986,0.4416,0.00896582>
+,<-0.189162,0.404119,0.238404>
+,<-0.211702,0.372673,0.263903>
+,<-0.306943,0.394872,0.103423>
+,<-0.0821862,0.391562,0.306361>
+,<-0.0894872,0.400401,0.29274>
+,<-0.0788035,0.38745,0.312607>
+,<-0.0632404,0.368316,0.341011>
+,<-0.0855203,0.395597,0.300175>
+,<-0.058277,0.362155,0.349978>
+,<0.0419119,0.485764,-0.170018>
+,<0.128049,0.483766,-0.076718>
+,<-0.225687,0.446763,0.0351393>
+,<-0.226771,0.446169,0.0319272>
+,<-0.132264,0.479811,0.164748>
+,<-0.14392,0.455329,-0.149697>
+,<0.116102,0.484543,-0.0978453>
+,<0.0301128,0.468627,-0.215197>
+,<-0.136008,0.45298,-0.163105>
+,<-0.129878,0.450988,-0.173434>
+,<-0.305655,0.351146,-0.187074>
+,<-0.279879,0.410342,-0.0773698>
+,<-0.258011,0.421772,-0.0958733>
+,<-0.242332,0.414666,-0.15338>
+,<-0.310848,0.39142,-0.0566572>
+,<-0.259292,0.421246,-0.0943678>
+,<-0.427199,0.290272,-0.0539611>
+,<-0.437614,0.292638,-0.0181431>
+,<-0.295466,0.400956,-0.0670175>
+,<-0.19065,0.455151,-0.10257>
+,<-0.139243,0.453937,-0.157723>
+,<-0.24067,0.420123,-0.141438>
+,<-0.253151,0.429207,-0.0448364>
+,<-0.24385,0.409655,-0.164128>
+,<-0.317786,0.387032,-0.0519741>
+,<-0.448744,0.264827,-0.018504>
+,<-0.432076,0.302277,-0.00349481>
+,<-0.40896,0.285974,-0.114866>
+,<-0.31687,0.387616,-0.0525767>
+,<-0.273509,0.414102,-0.0815463>
+,<-0.40514,0.285026,-0.127256>
+,<-0.264303,0.419146,-0.0885946>
+,<-0.323486,0.3834,-0.0480764>
+,<-0.372975,0.286182,-0.201423>
+,<-0.248274,0.42576,-0.106985>
+,<-0.431758,0.185633,0.184889>
+,<-0.263681,0.425199,-0.00886505>
+,<0.0605383,0.148443,-0.487374>
+,<0.258536,0.225041,-0.367054>
+,<0.394126,-0.0886102,-0.306155>
+,<0.393723,-0.0883043,-0.306818>
+,<0.413183,-0.102872,-0.274246>
+,<0.403833,-0.0958421,-0.290053>
+,<0.422915,-0.110257,-0.257479>
+,<0.431377,-0.0967087,-0.244618>
+,<0.453725,-0.0188877,-0.211856>
+,<0.463031,0.0186218,-0.195413>
+,<0.468558,0.0419913,-0.185048>
+,<0.472676,0.0596495,-0.17719>
+,<0.474471,0.0674164,-0.173731>
+,<0.472498,0.0589006,-0.177532>
+,<0.462949,0.0182909,-0.195566>
+,<0.460934,0.00992602,-0.19926>
+,<0.459199,0.00281297,-0.202391>
+,<0.457657,-0.00342028,-0.205125>
+,<0.456251,-0.00902819,-0.207576>
+,<0.454935,-0.0141942,-0.209826>
+,<0.453678,-0.0190578,-0.211936>
+,<0.452452,-0.0237315,-0.213955>
+,<0.451232,-0.0283119,-0.215925>
+,<0.449994,-0.0328883,-0.217886>
+,<0.448714,-0.0375497,-0.219875>
+,<0.447366,-0.0423918,-0.221932>
+,<0.445917,-0.0475254,-0.224104>
+,<0.444326,-0.0530873,-0.226449>
+,<0.442539,-0.0592568,-0.229039>
+,<0.44048,-0.0662813,-0.231979>
+,<0.43804,-0.0745216,-0.235415>
+,<0.435046,-0.0845331,-0.239577>
+,<0.431216,-0.0972288,-0.244841>
+,<0.426095,-0.112647,-0.251948>
+,<0.420959,-0.108732,-0.260887>
+,<0.416084,-0.105032,-0.269293>
+,<0.411362,-0.101464,-0.27736>
+,<0.406697,-0.0979548,-0.285254>
+,<0.402,-0.0944374,-0.293128>
+,<0.397179,-0.0908432,-0.301134>
+,<0.39234,-0.0866406,-0.309144>
+,<0.387763,-0.0812477,-0.316759>
+,<0.382952,-0.075612,-0.324681>
+,<0.377794,-0.0696007,-0.333094>
+,<0.372142,-0.0630471,-0.342226>
+,<0.365801,-0.0557301,-0.35238>
+,<0.358498,-0.0473409,-0.363978>
+,<0.213696,-0.243116,-0.408278>
+,<0.194133,-0.0256766,-0.461289>
+,<0.276659,0.101475,-0.412513>
+,<0.214897,0.170017,-0.423125>
+,<0.0711456,0.264322,-0.434329>
+,<0.0862801,0.205554,-0.463456>
+,<0.264383,-0.161025,-0.402899>
+,<0.341496,0.219084,-0.297462>
+,<0.367821,0.113808,-0.327461>
+,<0.379068,0.0661513,-0.333314>
+,<0.387843,0.0663276,-0.319613>
+,<0.394975,0.0664665,-0.308412>
+,<0.400983,0.0665794,-0.298913>
+,<0.4062,0.0666735,-0.290605>
+,<0.410852,0.0667538,-0.283141>
+,<0.415099,0.0668235,-0.276272>
+,<0.419061,0.0668851,-0.269809>
+,<0.422834,0.0669402,-0.263602>
+,<0.426498,0.0669903,-0.257521>
+,<0.429296,-0.00494892,-0.257062>
+,<0.0686406,0.101292,-0.495077>
+,<0.1852,0.177995,-0.43338>
+,<0.0831429,0.217854,-0.457482>
+,<0.0766499,0.181915,-0.473608>
+,<0.0646379,0.289163,-0.421573>
+,<0.0771519,0.241172,-0.445982>
+,<0.0876634,0.304298,-0.401232>
+,<0.209966,0.0674811,-0.449308>
+,<0.195178,0.0646902,-0.456084>
+,<0.185388,0.0628344,-0.460407>
+,<0.271005,-0.151927,-0.401119>
+,<0.27854,0.288165,-0.314456>
+,<0.368155,0.102931,-0.332336>
+,<0.364185,0.180006,-0.297524>
+,<0.294727,0.0758942,-0.408995>
+,<0.260208,0.2302,-0.362864>
+,<0.222966,0.16781,-0.420254>
+,<0.277479,0.336196,-0.282485>
+,<0.274539,0.345468,-0.277769>
+,<0.27656,0.339067,-0.281039>
+,<0.250285,0.200026,-0.386946>
+,<0.256915,0.220067,-0.371066>
+,<0.214609,0.0683546,-0.447132>
+,<0.177671,0.179981,-0.4359>
+,<0.355973,0.0466519,-0.369334>
+,<0.366249,0.154259,-0.308992>
+,<0.36496,0.178628,-0.297522>
+,<0.323401,0.249142,-0.297002>
+,<0.279532,0.291238,-0.311829>
+,<0.268823,0.257116,-0.340595>
+,<0.266401,0.24947,-0.346972>
+,<0.352648,0.200092,-0.297572>
+,<0.367193,0.131885,-0.319283>
+,<0.367503,0.123329,-0.323167>
+,<0.165696,0.059082,-0.468733>
+,<-0.0522148,-0.00333252,-0.497815>
+,<0.240849,-0.00924327,-0.439914>
+,<0.348985,0.206376,-0.297552>
+,<0.244101,0.181691,-0.401126>
+,<0.249344,0.145616,-0.414359>
+,<0.219972,0.0693623,-0.444598>
+,<0.261967,0.235659,-0.358401>
+,<0.368924,0.0745122,-0.344969>
+,<0.288777,-0.127274,-0.396123>
+,<-0.168811,-0.292813,-0.421022>
+,<-0.0589897,0.109787,-0.492433>
+,<0.0368291,-0.0532161,-0.499487>
+,<0.0925647,0.0497404,-0.497183>
+,<0.311247,0.0159069,-0.40522>
+,<0.268297,0.255531,-0.341937>
+,<0.0549883,0.136908,-0.492001>
+,<0.0565871,0.127083,-0.493659>
+,<0.0712651,0.17073,-0.478265>
+,<0.0821893,0.193419,-0.46876>
+,<0.0849745,0.210793,-0.460913>
+,<0.081893,0.222848,-0.455033>
+,<0.0789001,0.234501,-0.449291>
+,<0.0759365,0.245984,-0.443575>
+,<0.0729456,0.257517,-0.437774>
+,<0.0698688,0.269324,-0.431775>
+,<0.0666408,0.281654,-0.425449>
+,<0.0631839,0.294798,-0.418641>
+,<0.0760675,0.301431,-0.408452>
+,<0.0909656,0.30508,-0.399199>
+,<0.103435,0.30811,-0.391414>
+,<0.114213,0.310705,-0.384647>
+,<0.198312,0.245013,-0.388641>
+,<-0.0536399,0.356417,0.358282>
+,<0.296086,0.372402,0.161247>
+,<-0.0479336,0.275114,0.436854>
+,<-0.108539,0.422985,0.256744>
+,<0.11462,0.385484,0.298544>
+,<0.0716545,0.378329,0.321806>
+,<0.0384652,0.396208,0.305115>
+,<0.0381534,0.40359,0.294476>
+,<0.0378927,0.409574,0.28572>
+,<0.0376539,0.414879,0.277831>
+,<0.0457296,0.433912,0.246072>
+,<-0.174521,0.473625,0.134942>
+,<-0.138087,0.457437,0.199901>
+,<-0.143365,0.47227,0.175823>
+,<0.0781027,0.379474,0.318385>
+,<0.15602,0.389076,0.277484>
+,<0.0935079,0.382124,0.310127>
+,<0.128637,0.387529,0.29067>
+,<0.150475,0.46293,0.143752>
+,<0.102136,0.383539,0.305435>
+,<0.270259,0.370632,0.209379>
+,<0.106276,0.384198,0.303163>
+,<0.039388,0.372421,0.338755>
+,<0.0393704,0.372733,0.338318>
+,<0.0390331,0.381251,0.326344>
+,<0.0387715,0.387779,0.317121>
+,<0.0385584,0.393025,0.309667>
+,<0.038378,0.397404,0.303406>
+,<0.0382201,0.401178,0.297973>
+,<0.0380779,0.404521,0.293126>
+,<0.0379466,0.407556,0.288693>
+,<0.0378227,0.410372,0.284546>
+,<0.0377031,0.413041,0.280584>
+,<0.0375855,0.41562,0.276722>
+,<0.0374675,0.418162,0.272885>
+,<0.0373469,0.420715,0.268996>
+,<0.0372211,0.42333,0.26498>
+,<0.0370874,0.426063,0.260747>
+,<0.0369423,0.428981,0.256192>
+,<0.0367812,0.432168,0.251177>
+,<0.0128177,0.443443,0.233328>
+,<0.0594188,0.434655,0.241128>
+,<0.0338305,0.434606,0.247387>
+,<0.0837169,0.435608,0.232087>
+,<-0.00800716,0.451788,0.21919>
+,<0.113237,0.436194,0.220729>
+,<0.151235,0.436544,0.205891>
+,<0.397316,0.321243,0.084053>
+,<-0.0179965,0.494417,0.101245>
+,<0.0815093,0.462457,0.172754>
+,<-0.00632034,0.447988,-0.254824>
+,<-0.0473243,0.489006,-0.10756>
+,<-0.146178,0.479259,-0.0663005>
+,<-0.135512,0.452798,-0.164016>
+,<-0.158051,0.472745,-0.079046>
+,<-0.146278,0.455995,-0.145667>
+,<-0.117232,0.446612,-0.194275>
+,<-0.349304,0.367397,0.0937173>
+,<-0.382437,0.345464,0.0860199>
+,<-0.140294,0.460042,0.19557>
+,<-0.12969,0.447729,0.216062>
+,<-0.121543,0.43824,0.231765>
+,<-0.114972,0.430562,0.24439>
+,<-0.109462,0.424102,0.254937>
+,<-0.104691,0.418485,0.264037>
+,<-0.100442,0.413462,0.272108>
+,<-0.00934473,0.41695,0.276524>
+,<-0.379782,0.274423,-0.210323>
+,<-0.379366,-0.238941,-0.246537>
+,<-0.421929,0.289063,-0.0718191>
+,<-0.279095,0.41081,-0.0778692>
+,<-0.354841,-0.295699,0.207233>
+,<-0.250372,0.400741,-0.174592>
+,<-0.51618,0.00123238,-0.106644>
+,<-0.435395,0.0448198,-0.292188>
+,<-0.401417,0.284085,-0.139192>
+,<-0.388556,0.280727,-0.179332>
+,<-0.219466,-0.0236923,-0.454852>
+,<-0.212721,-0.0500348,-0.458894>
+,<-0.240154,0.0602665,-0.44018>
+,<-0.374927,0.22198,-0.278898>
+,<-0.11894,-0.0230805,-0.488714>
+,<-0.18002,-0.103052,-0.473126>
+,<-0.218966,-0.0257327,-0.455162>
+,<-0.244642,0.0792084,-0.436458>
+,<-0.247603,0.0918715,-0.433923>
+,<-0.229869,0.0176467,-0.448013>
+,<-0.213401,-0.0473116,-0.458495>
+,<-0.205368,-0.210491,-0.457569>
+,<-0.227471,-0.226155,-0.441109>
+,<-0.193564,0.180334,-0.441953>
+,<-0.0799684,0.051614,-0.494484>
+,<-0.344899,0.266011,-0.262284>
+,<-0.281453,0.306423,-0.278258>
+,<-0.374649,0.252053,-0.248296>
+,<-0.379515,0.273228,-0.212386>
+,<-0.376235,0.259591,-0.236063>
+,<-0.228768,0.18995,-0.428364>
+,<-0.188819,0.236609,-0.416258>
+,<-0.282916,0.305538,-0.277857>
+,<-0.319579,0.282203,-0.268703>
+,<-0.374176,0.243702,-0.258353>
+,<-0.144112,-0.0559706,-0.482547>
+,<-0.374566,0.233061,-0.268445>
+,<-0.239737,0.0584257,-0.440524>
+,<-0.221955,-0.0139027,-0.453296>
+,<-0.216657,-0.0346669,-0.456562>
+,<-0.204679,-0.0809196,-0.46349>
+,<-0.224216,-0.0049546,-0.451843>
+,<-0.235958,0.0427083,-0.443507>
+,<-0.242518,0.0702648,-0.438234>
+,<-0.260957,0.149686,-0.422027>
+,<-0.12418,-0.0299148,-0.48748>
+,<-0.153285,-0.0679862,-0.480186>
+,<-0.194085,-0.121487,-0.469344>
+,<-0.203615,-0.085105,-0.464088>
+,<-0.223808,-0.00665224,-0.452111>
+,<-0.235591,0.0411072,-0.443794>
+,<-0.251104,0.106939,-0.430865>
+,<-0.255408,0.125561,-0.427039>
+,<-0.242057,0.0682224,-0.438624>
+,<-0.233659,0.0331248,-0.445259>
+,<-0.225933,0.00180789,-0.450714>
+,<-0.216082,-0.0369895,-0.456909>
+,<-0.208676,-0.0656545,-0.461229>
+,<-0.195855,-0.135126,-0.467594>
+,<-0.198903,-0.158999,-0.464474>
+,<-0.202552,-0.187813,-0.460628>
+,<-0.207107,-0.224045,-0.455701>
+,<-0.227151,-0.22626,-0.441333>
+,<-0.248197,-0.219205,-0.426606>
+,<-0.26703,-0.212842,-0.413329>
+,<-0.284281,-0.206966,-0.401071>
+,<-0.296119,-0.00157042,-0.403375>
+,<-0.312454,0.137919,0.387114>
+,<-0.216871,-0.281504,0.372948>
+,<-0.0523999,-0.233773,0.447173>
+,<-0.0517025,-0.230659,0.448695>
+,<-0.0419946,-0.1855,0.470148>
+,<-0.0504028,-0.224482,0.451693>
+,<-0.0446508,-0.197725,0.464448>
+,<-0.0406369,-0.179054,0.473119>
+,<-0.0426881,-0.188595,0.46871>
+,<-0.0360634,-0.157783,0.482799>
+,<-0.0384488,-0.168877,0.477774>
+,<0.00827513,-0.124206,0.494237>
+,<-0.0334004,-0.145397,0.488356>
+,<-0.00863773,-0.132637,0.492031>
+,<-0.166523,-0.065021,0.478009>
+,<-0.195857,0.00521306,0.477082>
+,<-0.0113875,-0.0273145,0.499626>
+,<-0.0152501,-0.00840658,0.500136>
+,<-0.0144547,-0.0123416,0.500059>
+,<-0.255338,-0.134177,0.421219>
+,<-0.282594,-0.14165,0.399405>
+,<-0.0169345,-6.53028e-05,0.500248>
+,<-0.319423,0.145936,0.379569>
+,<-0.264063,-0.152575,0.410706>
+,<-0.236052,-0.230397,0.388601>
+,<-0.302835,-0.133475,0.384533>
+,<-0.222467,-0.266729,0.377545>
+,<-0.184535,-0.431429,0.173261>
+,<-0.247499,-0.199098,0.397761>
+,<-0.318699,-0.126969,0.372685>
+,<-0.34445,-0.0372228,0.361496>
+,<-0.388392,0.10929,0.310211>
+,<-0.204087,-0.0625104,0.46635>
+,<0.103077,-0.335538,0.371451>
+,<0.052311,-0.382493,0.330032>
+,<0.108594,-0.328915,0.377091>
+,<-0.348816,-0.114375,0.349617>
+,<-0.381119,-0.107247,0.320024>
+,<-0.231898,-0.241588,0.385239>
+,<-0.142119,-0.457074,0.153519>
+,<-0.331285,-0.370489,0.0701597>
+,<-0.2924,-0.366966,0.176957>
+,<-0.52747,-0.121426,-0.0075762>
+,<-0.239981,-0.219734,0.391763>
+,<-0.255054,-0.17804,0.403717>
+,<-0.305257,0.127394,0.394975>
+,<-0.135437,0.285445,0.397862>
+,<-0.0370474,0.17694,0.48492>
+,<-0.326205,-0.123861,0.367009>
+,<-0.0841286,-0.114697,0.485588>
+,<-0.34875,-0.0513231,0.356547>
+,<0.106524,-0.331868,0.374578>
+,<0.0657603,-0.370241,0.341131>
+,<0.00993268,-0.272854,0.421828>
+,<0.0214684,-0.278787,0.417492>
+,<-0.0156465,-0.259509,0.431138>
+,<-0.109504,-0.273828,0.412523>
+,<0.0487699,-0.292587,0.406907>
+,<0.0767853,-0.306548,0.395673>
+,<0.0567716,-0.296592,0.403726>
+,<0.0738909,-0.305144,0.396823>
+,<-0.00858594,-0.263216,0.428606>
+,<-0.0523183,-0.240029,0.444003>
+,<-0.095865,-0.265478,0.420502>
+,<0.0273409,-0.281785,0.41525>
+,<-0.224081,-0.405233,0.191245>
+,<-0.143539,-0.180191,0.444216>
+,<0.11899,0.386136,0.296103>
+,<0.110411,0.384842,0.300881>
+,<0.159476,0.383111,0.2828>
+,<0.140528,0.389176,0.283902>
+,<0.222644,0.398339,0.212202>
+,<0.0890019,0.462246,0.170462>
+,<0.208396,0.406322,0.212915>
+,<0.297524,0.143505,0.375446>
+,<0.128113,0.210388,0.43515>
+,<0.000565964,0.244153,0.447646>
+,<0.0581082,0.24191,0.436623>
+,<0.0130635,0.24373,0.445252>
+,<0.116411,0.222438,0.432532>
+,<0.124986,0.31534,0.3687>
+,<0.105372,0.233563,0.429896>
+,<0.122153,0.216453,0.433908>
+,<0.158445,0.177934,0.440725>
+,<0.152528,0.18431,0.439722>
+,<0.138967,0.198834,0.437332>
+,<0.12401,0.214533,0.434323>
+,<0.109458,0.229425,0.430901>
+,<0.161929,0.30231,0.36723>
+,<-0.0495694,0.302455,0.418177>
+,<0.0845615,0.328729,0.369451>
+,<-0.0374166,0.324211,0.400186>
+,<0.153395,0.266443,0.395494>
+,<0.199717,0.288602,0.365328>
+,<0.246334,0.229995,0.380105>
+,<0.215746,0.40222,0.212554>
+,<0.215747,0.160522,0.428214>
+,<0.249625,0.240465,0.373089>
+,<0.195126,0.135054,0.448111>
+,<0.293564,0.109473,0.389681>
+,<0.281908,0.128339,0.392788>
+,<0.231462,0.274956,0.360971>
+,<0.294675,0.134053,0.381061>
+,<0.0824585,0.329433,0.369442>
+,<0.260192,0.260122,0.356212>
+,<0.28941,0.261181,0.33169>
+,<0.345481,0.262622,0.283283>
+,<0.354337,0.30514,0.221751>
+,<0.207614,0.454833,0.02901>
+,<0.161215,0.437833,0.199221>
+,<0.181253,0.421235,0.214149>
+,<0.154858,0.391085,0.275679>
+,<0.162466,0.377917,0.287399>
+,<0.176099,0.35368,0.308335>
+,<0.184959,0.337311,0.321907>
+,<0.148661,0.390259,0.279255>
+,<0.141122,0.389247,0.283576>
+,<0.134713,0.388369,0.287233>
+,<0.129095,0.387585,0.290422>
+,<0.12404,0.386864,0.293278>
+,<0.119381,0.386185,0.295896>
+,<0.114993,0.385531,0.298348>
+,<0.110773,0.384889,0.300692>
+,<0.106635,0.384246,0.302977>
+,<0.102499,0.383588,0.305248>
+,<0.0982824,0.382905,0.307549>
+,<0.0939,0.38218,0.309927>
+,<0.0892512,0.381396,0.312435>
+,<0.084212,0.380531,0.315138>
+,<0.0786204,0.379555,0.318121>
+,<0.0722523,0.378426,0.321502>
+,<0.0647817,0.377082,0.325449>
+,<0.0557071,0.375428,0.330223>
+,<0.127516,0.351781,0.332251>
+,<-0.405418,0.0999328,0.292324>
+,<-0.359799,-0.0878969,0.343431>
+,<-0.0020804,-0.266617,0.426249>
+,<-0.185376,-0.430924,0.173594>
+,<-0.211604,-0.295382,0.368577>
+,<-0.210365,-0.298578,0.367579>
+,<-0.204061,-0.31509,0.36233>
+,<-0.227415,-0.253582,0.381592>
+,<-0.228245,-0.251409,0.382246>
+,<-0.223391,-0.264324,0.378279>
+,<-0.236769,-0.228499,0.389158>
+,<-0.232662,-0.239579,0.385837>
+,<-0.244441,-0.207569,0.39531>
+,<-0.240667,-0.217903,0.392293>
+,<-0.251911,-0.18688,0.401227>
+,<-0.248165,-0.197294,0.398269>
+,<-0.25977,-0.16478,0.407377>
+,<-0.255752,-0.176121,0.404242>
+,<-0.217994,0.0554327,0.4633>
+,<-0.340656,-0.0252078,0.365689>
+,<-0.365541,-0.107248,0.336488>
+,<0.167086,0.272912,0.386713>
+,<-0.335051,-0.00789664,0.371483>
+,<-0.438001,0.155552,0.199884>
+,<-0.339478,-0.0215082,0.36695>
+,<-0.341118,-0.117625,0.355587>
+,<-0.294114,-0.137019,0.390969>
+,<-0.336161,-0.011262,0.370378>
+,<-0.41976,-0.107203,0.278188>
+,<-0.479798,-0.227609,-0.0433176>
+,<-0.477939,-0.0715253,0.214355>
+,<-0.154397,-0.359694,0.335707>
+,<-0.373813,-0.349668,0.010535>
+,<-0.317173,-0.370168,0.111525>
+,<-0.284379,-0.336331,0.266426>
+,<-0.30388,-0.36876,0.147689>
+,<-0.307882,-0.369387,0.137071>
+,<-0.306559,-0.369132,0.140761>
+,<-0.316133,-0.370122,0.114486>
+,<-0.309651,-0.369614,0.132338>
+,<-0.457291,-0.237017,-0.0863233>
+,<-0.314335,-0.370028,0.119533>
+,<-0.537848,0.00225703,-0.0387191>
+,<-0.415344,-0.00761826,-0.308266>
+,<-0.514013,0.0776955,-0.0330378>
+,<-0.31045,-0.369708,0.130174>
+,<-0.312742,-0.369923,0.123925>
+,<-0.364474,-0.358576,0.0101988>
+,<-0.277181,-0.364554,0.215221>
+,<-0.432849,0.180489,0.187496>
+,<-0.30533,-0.368966,0.143948>
+,<-0.307633,-0.369269,0.137963>
+,<-0.309479,-0.369481,0.133115>
+,<-0.308596,-0.369383,0.135441>
+,<-0.304334,-0.36889,0.146351>
+,<-0.300617,-0.368331,0.155903>
+,<-0.294019,-0.367292,0.172687>
+,<-0.279604,-0.339565,0.269021>
+,<-0.311979,-0.369862,0.12601>
+,<-0.319766,-0.37026,0.104048>
+,<-0.351672,-0.370667,0.00975897>
+,<-0.483603,-0.219472,-0.040515>
+,<-0.436235,0.164265,0.195575>
+,<-0.0160222,-0.459557,0.247572>
+,<-0.152526,-0.450876,0.158376>
+,<-0.17089,-0.439833,0.166931>
+,<-0.327379,-0.209631,0.315085>
+,<-0.417241,0.287967,-0.0875416>
+,<-0.237656,0.429391,-0.120887>
+,<-0.403414,-0.0345969,-0.317477>
+,<-0.429723,0.0254042,-0.296829>
+,<-0.330708,-0.189941,-0.367596>
+,<-0.349923,-0.150044,-0.355118>
+,<-0.370596,-0.106401,-0.341216>
+,<-0.349937,-0.28681,0.233003>
+,<-0.469684,0.0344852,0.223263>
+,<-0.41111,0.0967404,0.286282>
+,<-0.484974,0.16501,-0.0263579>
+,<-0.397824,0.104135,0.30034>
+,<-0.403134,0.331641,0.0801896>
+,<-0.402649,0.32652,0.0908528>
+,<-0.425376,0.312627,0.0104509>
+,<-0.43116,0.188342,0.183555>
+,<-0.423626,0.221713,0.166603>
+,<-0.447707,0.105105,0.22448>
+,<-0.455415,0.0685207,0.238322>
+,<-0.450961,0.0874418,0.233019>
+,<-0.425708,0.212729,0.171198>
+,<-0.412001,0.269828,0.141714>
+,<-0.327719,0.330181,-0.191838>
+,<-0.245093,0.405323,-0.173349>
+,<-0.253995,0.423433,-0.100447>
+,<-0.299902,0.398236,-0.0640296>
+,<-0.403828,0.330642,0.00728321>
+,<-0.41296,0.286947,-0.101742>
+,<-0.377917,0.266514,-0.224081>
+,<-0.374734,0.252757,-0.247319>
+,<-0.374611,0.231963,-0.269473>
+,<-0.374029,0.247387,-0.254834>
+,<-0.325179,0.278676,-0.267229>
+,<-0.436376,-0.245461,-0.125696>
+,<-0.508571,0.00535534,-0.125432>
+,<-0.483102,0.0188233,-0.186685>
+,<-0.354553,-0.214676,-0.308891>
+,<-0.412812,0.0900808,-0.309364>
+,<-0.397809,0.11952,-0.320346>
+,<-0.381443,0.151112,-0.331972>
+,<-0.376208,0.165264,-0.331653>
+,<-0.375304,0.208962,-0.291098>
+,<-0.308117,0.28956,-0.271549>
+,<-0.278018,0.308613,-0.279061>
+,<-0.289011,0.301692,-0.276345>
+,<-0.37562,0.196058,-0.303137>
+,<-0.353367,0.16299,-0.353003>
+,<-0.338695,0.164232,-0.364063>
+,<-0.374224,0.242637,-0.259354>
+,<-0.383095,0.147969,-0.330806>
+,<-0.391423,0.131932,-0.324916>
+,<-0.399273,0.116694,-0.319282>
+,<-0.406819,0.101925,-0.313784>
+,<-0.414212,0.0873324,-0.308314>
+,<-0.421595,0.0726389,-0.302769>
+,<-0.429108,0.0575587,-0.29704>
+,<-0.357562,-0.134024,-0.350052>
+,<-0.501649,0.00906981,-0.142345>
+,<-0.471943,0.0245524,-0.212621>
+,<-0.502436,0.00866214,-0.14043>
+,<-0.52101,0.0557965,-0.0346845>
+,<-0.532217,-0.060946,0.0764563>
+,<-0.473029,-0.230436,-0.0563494>
+,<-0.452408,-0.238999,-0.0956088>
+,<-0.397539,-0.256952,-0.198507>
+,<-0.422581,-0.250841,-0.151181>
+,<-0.445457,0.167217,-0.154943>
+,<-0.197119,-0.443302,-0.123557>
+,<-0.242007,-0.429626,-0.0924447>
+,<0.06384,-0.513885,0.118276>
+,<-0.00698288,-0.531011,-0.0327056>
+,<0.121182,-0.492287,0.10726>
+,<0.215563,-0.454837,0.0855695>
+,<0.0834261,-0.506602,0.115688>
+,<-0.050885,-0.528532,0.0565772>
+,<0.152244,-0.480291,0.100265>
+,<-0.104235,-0.50719,0.0494469>
+,<-0.121442,-0.50022,0.0471216>
+,<-0.102552,-0.50787,0.0496612>
+,<-0.198483,-0.468,0.0366452>
+,<-0.164648,-0.482402,0.0412754>
+,<-0.187703,-0.47264,0.0381264>
+,<-0.250611,-0.444057,0.0238691>
+,<-0.259549,-0.439219,0.0174103>
+,<-0.277828,-0.429155,0.00414071>
+,<-0.287546,-0.423717,-0.00294531>
+,<-0.287148,-0.376048,-0.172121>
+,<-0.287604,-0.419803,-0.0277558>
+,<-0.188643,-0.444009,-0.134092>
+,<-0.28248,-0.398754,-0.116937>
+,<-0.221984,-0.436015,-0.106471>
+,<-0.220214,-0.436574,-0.107652>
+,<-0.279391,-0.410862,-0.0857236>
+,<-0.262058,-0.381254,-0.196287>
+,<-0.138295,-0.4691,-0.111357>
+,<-0.189687,-0.437491,-0.151671>
+,<-0.280619,-0.418499,-0.0551114>
+,<-0.283578,-0.419077,-0.0435496>
+,<-0.286341,-0.380491,-0.161636>
+,<-0.277917,-0.417944,-0.0655819>
+,<-0.246695,-0.384157,-0.210788>
+,<-0.251988,-0.383181,-0.205816>
+,<-0.286333,-0.380524,-0.16156>
+,<-0.283636,-0.393752,-0.129478>
+,<-0.0348948,-0.483352,-0.161264>
+,<-0.228545,-0.433973,-0.101844>
+,<-0.284716,-0.38875,-0.141783>
+,<-0.272104,-0.379237,-0.186682>
+,<-0.0949427,-0.488051,-0.0955208>
+,<-0.190662,-0.430609,-0.169281>
+,<-0.202677,-0.441761,-0.119728>
+,<0.0495056,-0.504996,-0.109735>
+,<-0.0286261,-0.489729,-0.148729>
+,<-0.281833,-0.401416,-0.110171>
+,<-0.224188,-0.435342,-0.104886>
+,<-0.189893,-0.436106,-0.155294>
+,<-0.247031,-0.3841,-0.210465>
+,<-0.252308,-0.383125,-0.205507>
+,<-0.262365,-0.381198,-0.195986>
+,<-0.257385,-0.382164,-0.200713>
+,<-0.245865,-0.428377,-0.089669>
+,<-0.280317,-0.407371,-0.0948277>
+,<-0.283079,-0.396209,-0.123347>
+,<-0.181652,-0.389656,-0.277967>
+,<-0.192179,-0.416956,-0.202371>
+,<-0.188323,-0.445691,-0.129485>
+,<-0.171,-0.454125,-0.123221>
+,<-0.14446,-0.466349,-0.113602>
+,<-0.0719395,-0.497979,-0.0871025>
+,<0.0407489,-0.522419,0.121275>
+,<-0.0183868,-0.500087,-0.128155>
+,<0.165423,-0.475119,0.097277>
+,<-0.15599,-0.461117,-0.11783>
+,<-0.188258,-0.456482,-0.0811385>
+,<0.161198,-0.387023,0.272461>
+,<0.157115,-0.383294,0.280028>
+,<0.160267,-0.386151,0.274242>
+,<0.153424,-0.379752,0.286899>
+,<0.124014,-0.351086,0.340341>
+,<0.151832,-0.378217,0.289832>
+,<0.15911,-0.385195,0.276254>
+,<0.157324,-0.383392,0.279774>
+,<-0.01382,-0.260442,0.430503>
+,<-0.042964,-0.245046,0.440742>
+,<-0.240678,-0.393757,0.198736>
+,<0.0947794,-0.47199,0.173935>
+,<0.0301842,-0.402357,0.311576>
+,<-0.000756805,-0.495459,0.184899>
+,<-0.0801381,-0.409475,0.29861>
+,<-0.0324426,-0.250635,0.437073>
+,<0.0469123,-0.291681,0.407623>
+,<-0.00691621,-0.264064,0.42802>
+,<-0.000519753,-0.267405,0.425697>
+,<0.0229222,-0.279505,0.416956>
+,<0.011382,-0.273578,0.421305>
+,<0.0171407,-0.276543,0.419146>
+,<0.00553457,-0.270552,0.423474>
+,<-0.0732703,-0.251577,0.433433>
+,<-0.0654591,-0.246738,0.437828>
+,<-0.0234922,-0.255372,0.433924>
+,<-0.0300847,-0.251855,0.436265>
+,<-0.163185,-0.306219,0.380322>
+,<-0.185363,-0.319456,0.366799>
+,<-0.167353,-0.308682,0.377805>
+,<-0.132042,-0.463083,0.148739>
+,<-0.140521,-0.29257,0.394068>
+,<-0.121521,-0.382038,0.31946>
+,<0.0958316,-0.471018,0.174939>
+,<0.142212,-0.427465,0.22011>
+,<0.150852,-0.41923,0.228507>
+,<0.159575,-0.410791,0.236964>
+,<0.154139,-0.416069,0.231696>
+,<0.157006,-0.413294,0.234476>
+,<0.165204,-0.390747,0.264668>
+,<0.164142,-0.406293,0.241381>
+,<0.166171,-0.404265,0.243352>
+,<0.0557459,-0.50845,0.135868>
+,<0.197619,-0.462223,0.0898901>
+,<0.0533307,-0.510686,0.133544>
+,<0.127474,-0.441365,0.205781>
+,<0.135842,-0.433484,0.213925>
+,<0.141998,-0.427661,0.219914>
+,<0.146797,-0.423099,0.224579>
+,<0.150708,-0.419361,0.228378>
+,<0.166402,-0.391845,0.262312>
+,<0.169318,-0.394496,0.256545>
+,<0.156895,-0.413395,0.23438>
+,<0.172741,-0.397621,0.249671>
+,<0.172466,-0.397905,0.249404>
+,<0.164052,-0.406375,0.241306>
+,<0.170379,-0.400031,0.247397>
+,<0.166257,-0.404185,0.243424>
+,<0.168323,-0.402111,0.245416>
+,<0.170293,-0.400112,0.247325>
+,<0.172378,-0.397988,0.249331>
+,<0.170882,-0.395961,0.253357>
+,<0.166183,-0.391717,0.262637>
+,<0.164995,-0.390638,0.264956>
+,<0.163908,-0.389648,0.267064>
+,<0.162893,-0.38872,0.269022>
+,<0.141621,-0.397458,0.269018>
+,<-0.00886636,0.120604,-0.49332>
+,<0.0131462,-0.0399832,-0.499595>
+,<0.127602,0.192913,-0.451998>
+,<0.1614,0.184227,-0.441245>
+,<0.182007,0.0621918,-0.461869>
+,<0.134866,0.0531754,-0.481242>
+,<0.214629,-0.228397,-0.415397>
+,<0.264614,-0.000763066,-0.428351>
+,<0.289373,0.00806523,-0.41611>
+,<0.109407,-0.0548341,-0.496333>
+,<0.168961,-0.034383,-0.471949>
+,<0.212012,-0.0194358,-0.453389>
+,<0.238392,0.164958,-0.413875>
+,<0.152235,0.186593,-0.444203>
+,<0.369128,0.0659541,-0.348749>
+,<0.265608,0.119489,-0.413363>
+,<0.263858,0.241562,-0.353541>
+,<0.365162,0.175191,-0.299157>
+,<0.368518,0.0901274,-0.338044>
+,<0.2206,-0.016416,-0.449466>
+,<0.203424,-0.0224412,-0.457227>
+,<0.183195,-0.0294687,-0.465972>
+,<0.218764,-0.268936,-0.388993>
+,<0.091988,-0.349376,-0.352038>
+,<0.239586,-0.194766,-0.409276>
+,<0.306006,-0.102996,-0.390938>
+,<0.334172,-0.0625887,-0.381813>
+,<0.316561,0.0178616,-0.402569>
+,<0.274111,0.00260021,-0.42367>
+,<0.246108,-0.00739968,-0.437378>
+,<0.346886,-0.00525817,-0.382971>
+,<0.345059,0.00988491,-0.385985>
+,<0.326019,-0.0743604,-0.384522>
+,<0.283065,-0.13524,-0.397766>
+,<0.277183,-0.1434,-0.39942>
+,<0.228415,-0.20985,-0.412042>
+,<0.155981,-0.354262,-0.337431>
+,<0.120062,0.0503332,-0.48716>
+,<0.235081,-0.0112926,-0.442671>
+,<0.255172,-0.0041378,-0.432976>
+,<0.262661,-0.00149414,-0.429309>
+,<0.0658492,-0.347178,-0.357782>
+,<0.00180909,-0.340755,-0.370716>
+,<0.0888612,-0.13213,-0.493616>
+,<0.178449,0.0615149,-0.463391>
+,<0.0585043,-0.0653238,-0.499328>
+,<0.101989,-0.0452311,-0.49893>
+,<0.041486,0.131238,-0.493346>
+,<0.00220354,0.122958,-0.493391>
+,<-0.0437162,-0.00811716,-0.498342>
+,<-0.0339001,-0.0136377,-0.498855>
+,<-0.022475,-0.0200513,-0.499274>
+,<-0.00508967,-0.029787,-0.499559>
+,<0.0940972,-0.0835683,-0.499025>
+,<0.0962887,0.0249112,-0.497923>
+,<-0.00692602,0.120999,-0.49334>
+,<-0.0708247,0.0900436,-0.493047>
+,<0.213303,0.170471,-0.423679>
+,<0.098957,-0.00744126,-0.498588>
+,<0.113151,0.196574,-0.456504>
+,<0.0945522,0.0454448,-0.497302>
+,<0.153661,0.0567791,-0.473662>
+,<0.174627,0.0607868,-0.465009>
+,<0.083446,0.0694554,-0.496509>
+,<0.19191,0.0640714,-0.457543>
+,<0.20206,0.0659908,-0.452964>
+,<0.197417,0.0278293,-0.458969>
+,<-0.185998,0.392905,-0.257143>
+,<-0.240432,0.331214,-0.287573>
+,<-0.261595,0.422256,-0.0712318>
+,<-0.251595,0.430455,-0.040007>
+,<-0.24028,0.438497,-0.00610042>
+,<-0.248254,0.433057,-0.0297125>
+,<0.0171229,0.441671,0.236228>
+,<-0.128161,0.491528,-0.00154258>
+,<-0.241203,0.437926,-0.00875471>
+,<-0.244422,0.435814,-0.018433>
+,<-0.244339,0.435883,-0.0178961>
+,<-0.242162,0.437313,-0.0117759>
+,<-0.235364,0.441384,0.00774298>
+,<-0.188042,0.466935,0.129882>
+,<0.0550388,0.434428,0.242725>
+,<0.000239549,0.500349,-0.0066201>
+,<-0.132225,0.486735,-0.0513512>
+,<-0.147578,0.478504,-0.0677696>
+,<-0.226183,0.436247,-0.115288>
+,<-0.022236,0.460477,0.202402>
+,<-0.174485,0.463448,-0.0967343>
+,<-0.163597,0.469645,-0.0850093>
+,<0.105657,0.436085,0.223665>
+,<0.112262,0.43617,0.221127>
+,<0.131002,0.484472,-0.0458646>
+,<0.126827,0.483406,-0.0892516>
+,<-0.127739,0.492264,0.010035>
+,<0.0371197,0.495626,-0.0761288>
+,<0.100428,0.48609,-0.110309>
+,<-0.037781,0.499916,0.026375>
+,<-0.129256,0.489279,-0.033228>
+,<0.0260111,0.498199,-0.0460392>
+,<-0.0537188,0.499451,0.0401288>
+,<-0.00658721,0.487814,-0.136168>
+,<0.0416749,0.484971,-0.172334>
+,<0.0402966,0.480441,-0.185427>
+,<0.0417423,0.485211,-0.171637>
+,<0.0329363,0.470211,-0.212073>
+,<0.0388171,0.475518,-0.199473>
+,<0.0116178,0.458252,-0.235369>
+,<0.00526384,0.454657,-0.24224>
+,<0.0142373,0.459752,-0.232485>
+,<-0.0128109,0.444243,-0.261803>
+,<-0.00369489,0.449521,-0.25195>
+,<-0.0322798,0.432811,-0.282757>
+,<-0.0431059,0.42637,-0.294361>
+,<-0.130411,0.451192,-0.17247>
+,<-0.152007,0.457564,-0.13583>
+,<-0.315506,0.341853,-0.189214>
+,<-0.32236,0.335333,-0.190665>
+,<-0.209052,0.397207,-0.227279>
+,<-0.217143,0.399158,-0.215386>
+,<-0.0728924,0.396641,-0.340835>
+,<-0.297725,0.358538,-0.185311>
+,<-0.229237,0.401934,-0.197367>
+,<-0.19266,0.393519,-0.250027>
+,<-0.162841,0.390631,-0.281639>
+,<-0.197559,0.451548,-0.105047>
+,<-0.180706,0.39242,-0.26274>
+,<-0.238045,0.403847,-0.184078>
+,<-0.279821,0.374823,-0.181335>
+,<-0.268423,0.417069,-0.0849012>
+,<-0.160271,0.459748,-0.121563>
+,<-0.104121,0.441877,-0.215574>
+,<-0.232744,0.33559,-0.289137>
+,<-0.255123,0.427605,-0.0509803>
+,<-0.104262,0.466121,-0.149203>
+,<-0.317635,0.388011,0.101004>
+,<-0.329088,0.3806,0.0983942>
+,<-0.337546,0.293099,0.236079>
+,<-0.342215,0.294372,0.228007>
+,<-0.323445,0.289167,0.260093>
+,<-0.324213,0.289368,0.258817>
+,<-0.328251,0.290522,0.251968>
+,<-0.308052,0.284722,0.285773>
+,<-0.318401,0.28773,0.268558>
+,<-0.312998,0.286175,0.277562>
+,<-0.307083,0.284456,0.287353>
+,<-0.276594,0.275395,0.337076>
+,<-0.272602,0.281579,0.332541>
+,<-0.283761,0.27756,0.325461>
+,<-0.254694,0.309023,0.312374>
+,<-0.262579,0.296972,0.321255>
+,<-0.238712,0.333171,0.294397>
+,<-0.237841,0.334502,0.293381>
+,<-0.242691,0.32722,0.298849>
+,<-0.226313,0.351566,0.280407>
+,<-0.225609,0.35262,0.279582>
+,<-0.229425,0.347012,0.283888>
+,<-0.21538,0.36742,0.26806>
+,<-0.214697,0.368422,0.267257>
+,<-0.218318,0.363219,0.271349>
+,<-0.207145,0.379148,0.25872>
+,<-0.210998,0.373696,0.263076>
+,<-0.194643,0.396567,0.244608>
+,<-0.193666,0.397942,0.243468>
+,<-0.198606,0.3911,0.249059>
+,<-0.181421,0.414739,0.229602>
+,<-0.188034,0.405694,0.237091>
+,<-0.163207,0.439449,0.208965>
+,<-0.173387,0.425669,0.2205>
+,<-0.029568,0.460178,0.204403>
+,<-0.0334726,0.460954,0.202919>
+,<-0.143353,0.472368,0.175667>
+,<0.148939,0.436514,0.206817>
+,<-0.236683,0.440628,0.00415913>
+,<-0.207705,0.455724,0.125058>
+,<-0.191415,0.465253,0.128645>
+,<-0.234559,0.439707,0.119334>
+,<-0.221912,0.447281,0.122039>
+,<-0.256842,0.426197,0.114521>
+,<-0.246091,0.432744,0.116851>
+,<-0.277008,0.413755,0.110102>
+,<-0.267075,0.419911,0.112286>
+,<-0.29675,0.401357,0.105713>
+,<-0.286837,0.40761,0.107925>
+,<-0.341638,0.372416,0.0955166>
+,<-0.372022,0.352379,0.0884846>
+,<-0.421128,0.319115,0.0192563>
+,<-0.398946,0.308979,0.126424>
+,<-0.388916,0.306449,0.144717>
+,<-0.371289,0.301989,0.176585>
+,<-0.358385,0.298656,0.199637>
+,<-0.401059,0.309481,0.122599>
+,<-0.402814,0.331851,0.0812545>
+,<-0.503324,0.110593,-0.0305322>
+,<-0.413527,0.324544,0.0452798>
+,<-0.377931,0.3037,0.164593>
+,<-0.37015,0.301716,0.178607>
+,<-0.363443,0.299989,0.190615>
+,<-0.357491,0.298439,0.201202>
+,<-0.352072,0.297012,0.210776>
+,<-0.347022,0.295667,0.219635>
+,<-0.272468,0.359184,0.217136>
+,<-0.308899,0.173815,0.373062>
+,<-0.274277,0.0962826,0.422198>
+,<-0.236982,-0.108347,0.437854>
+,<-0.277259,0.2619,0.347189>
+,<-0.261901,-0.143458,0.415143>
+,<-0.249018,-0.125264,0.427007>
+,<-0.265474,-0.148521,0.411802>
+,<-0.261956,-0.143535,0.415092>
+,<-0.243006,-0.116802,0.432455>
+,<-0.23703,-0.108413,0.437811>
+,<-0.231025,-0.100004,0.443134>
+,<-0.224875,-0.0914118,0.448526>
+,<-0.218451,-0.0824592,0.454095>
+,<-0.211605,-0.0729398,0.459968>
+,<-0.204151,-0.0625968,0.466297>
+,<-0.195842,-0.0510921,0.473281>
+,<-0.107682,0.0976519,0.49137>
+,<-0.032421,0.0771216,0.499737>
+,<-0.0200383,0.0153271,0.500311>
+,<-0.0848001,0.112173,0.494238>
+,<-0.037149,0.146881,0.497675>
+,<-0.23895,0.273626,0.35908>
+,<-0.193844,0.279098,0.376462>
+,<-0.139418,0.285015,0.396461>
+,<-0.102796,0.288629,0.409338>
+,<0.144639,0.262305,0.401036>
+,<-0.286901,0.235632,0.355142>
+,<-0.304389,0.186715,0.369415>
+,<-0.38312,0.112186,0.315671>
+,<-0.283574,0.103068,0.415176>
+,<-0.154398,-0.0723936,0.47931>
+,<-0.0923723,-0.10978,0.484987>
+,<-0.238073,0.069962,0.448904>
+,<-0.256328,0.0832129,0.435566>
+,<-0.413387,0.0954925,0.283844>
+,<-0.312973,0.0557996,0.39117>
+,<-0.329959,0.00722485,0.376321>
+,<-0.381065,0.113279,0.317801>
+,<-0.360105,0.124566,0.339171>
+,<-0.318322,0.146499,0.380651>
+,<-0.311444,0.0602491,0.39247>
+,<-0.324242,0.0237621,0.381449>
+,<-0.334792,-0.00701822,0.37174>
+,<-0.340378,-0.0242325,0.365994>
+,<-0.351407,-0.060063,0.353431>
+,<-0.343289,-0.0335909,0.362794>
+,<-0.333904,-0.00444603,0.372604>
+,<-0.29837,0.117357,0.402419>
+,<-0.351527,0.129118,0.347792>
+,<-0.365631,-0.107209,0.336417>
+,<-0.354895,-0.0715982,0.349298>
+,<-0.344833,-0.0385637,0.361055>
+,<-0.337254,-0.0146086,0.36927>
+,<-0.321478,0.0316646,0.383865>
+,<-0.39044,0.108192,0.308071>
+,<-0.441835,0.0794264,0.253093>
+,<-0.421319,0.231505,0.161572>
+,<-0.36383,-0.107961,0.337847>
+,<-0.355308,-0.1116,0.344552>
+,<-0.347319,-0.11499,0.350788>
+,<-0.339673,-0.118214,0.356708>
+,<-0.332209,-0.121342,0.362439>
+,<-0.324779,-0.124435,0.368097>
+,<-0.317241,-0.127552,0.373789>
+,<-0.309444,-0.130756,0.379627>
+,<-0.301219,-0.134115,0.385736>
+,<-0.310123,-0.0280028,0.391714>
+,<-0.444,-0.242413,-0.111444>
+,<-0.429297,-0.248245,-0.138825>
+,<-0.516073,-0.147454,-0.0163246>
+,<-0.461926,-0.235076,-0.0775534>
+,<-0.322425,-0.310033,0.245684>
+,<-0.297882,-0.367905,0.162879>
+,<-0.50824,0.0955571,-0.0316833>
+,<-0.415611,-0.165735,0.244942>
+,<-0.453631,0.072685,0.240172>
+,<-0.483799,0.0184742,-0.185045>
+,<-0.548502,-0.0628234,0.00278>
+,<-0.534751,-0.00897247,-0.060092>
+,<-0.524766,-0.0034637,-0.0852293>
+,<-0.489064,0.0157216,-0.172597>
+,<-0.365624,-0.225459,-0.28146>
+,<-0.375005,-0.234648,-0.257744>
+,<-0.383632,-0.243153,-0.235457>
+,<-0.33081,-0.191696,-0.366398>
+,<-0.330165,-0.191071,-0.367942>
+,<-0.364376,-0.119636,-0.345467>
+,<-0.376398,-0.093961,-0.337188>
+,<-0.38728,-0.0703477,-0.329446>
+,<-0.409174,-0.0216262,-0.313066>
+,<-0.42211,0.00786067,-0.302924>
+,<-0.436848,0.0418944,-0.291051>
+,<-0.436913,0.041864,-0.290909>
+,<-0.452626,0.0342004,-0.256293>
+,<-0.465836,0.0276346,-0.226585>
+,<-0.477892,0.0215183,-0.198862>
+,<-0.489775,0.0153615,-0.170904>
+,<-0.495942,0.0121158,-0.156147>
+,<-0.495201,0.0124949,-0.157929>
+,<-0.477196,0.0218632,-0.200481>
+,<-0.471234,0.0248998,-0.214251>
+,<-0.4651,0.0279915,-0.228257>
+,<-0.458668,0.031201,-0.242785>
+,<-0.451787,0.0346007,-0.258161>
+,<-0.444269,0.03828,-0.274788>
+,<-0.435833,0.0395137,-0.291874>
+,<-0.42741,0.020013,-0.298681>
+,<-0.420075,0.00314702,-0.304531>
+,<-0.413504,-0.0118493,-0.309696>
+,<-0.40747,-0.0255146,-0.314369>
+,<-0.401802,-0.0382485,-0.318691>
+,<-0.396366,-0.050364,-0.32277>
+,<-0.391046,-0.0621219,-0.326697>
+,<-0.385739,-0.0737541,-0.33055>
+,<-0.380343,-0.0854832,-0.334402>
+,<-0.374752,-0.0975395,-0.338329>
+,<-0.368844,-0.110179,-0.342412>
+,<-0.362471,-0.12371,-0.346747>
+,<-0.355444,-0.138519,-0.351454>
+,<-0.347509,-0.15513,-0.356693>
+,<-0.338301,-0.17428,-0.362691>
+,<-0.332707,-0.193493,-0.361881>
+,<-0.341726,-0.202211,-0.340157>
+,<-0.349237,-0.209487,-0.321923>
+,<-0.355693,-0.215756,-0.306116>
+,<-0.361395,-0.221307,-0.292026>
+,<-0.366554,-0.226343,-0.279154>
+,<-0.371326,-0.231014,-0.267127>
+,<-0.375832,-0.235437,-0.255653>
+,<-0.380169,-0.239709,-0.244485>
+,<-0.384426,-0.243914,-0.233405>
+,<-0.388683,-0.248133,-0.222201>
+,<-0.393024,-0.252449,-0.210651>
+,<-0.433806,-0.126861,-0.214754>
+,<0.159634,-0.0375943,-0.475817>
+,<0.229891,-0.0131329,-0.44513>
+,<0.0935124,-0.0861126,-0.498896>
+,<0.132053,-0.0470688,-0.487126>
+,<0.350759,-0.0384979,-0.376173>
+,<0.343612,-0.0489026,-0.378624>
+,<0.350605,-0.0371072,-0.376462>
+,<0.347311,-0.00869649,-0.382265>
+,<0.343565,0.0221571,-0.38838>
+,<0.342913,0.0272747,-0.389391>
+,<0.343063,0.0260623,-0.389158>
+,<0.348593,-0.0197276,-0.380047>
+,<0.350217,-0.0338275,-0.377155>
+,<0.343505,-0.0490546,-0.378661>
+,<0.334082,-0.0627175,-0.381844>
+,<0.32594,-0.0744728,-0.384549>
+,<0.318701,-0.0848769,-0.386911>
+,<0.312101,-0.0943184,-0.389025>
+,<0.305944,-0.103083,-0.390958>
+,<0.300077,-0.111393,-0.392761>
+,<0.294372,-0.11943,-0.394477>
+,<0.288718,-0.127355,-0.39614>
+,<0.283005,-0.135322,-0.397784>
+,<0.27712,-0.143485,-0.399438>
+,<0.270939,-0.152017,-0.401137>
+,<0.264311,-0.161121,-0.402919>
+,<0.257046,-0.171054,-0.404829>
+,<0.248889,-0.182156,-0.406929>
+,<0.23948,-0.194907,-0.409303>
+,<0.228287,-0.210019,-0.412074>
+,<0.214469,-0.22861,-0.415437>
+,<0.0516827,-0.345895,-0.360795>
+,<-0.177802,-0.274184,-0.435102>
+,<-0.0950269,-0.329235,-0.388287>
+,<0.0177892,-0.342502,-0.367646>
+,<0.0449996,-0.345263,-0.362186>
+,<0.116816,-0.351327,-0.346432>
+,<0.235443,-0.359995,-0.318927>
+,<0.188048,-0.217305,-0.430885>
+,<0.216243,-0.256038,-0.398665>
+,<0.223925,-0.295672,-0.368709>
+,<0.0873673,-0.146895,-0.491816>
+,<0.0891898,-0.129091,-0.493977>
+,<0.0908338,-0.112915,-0.495881>
+,<0.0923505,-0.0978804,-0.497594>
+,<0.0987188,-0.069707,-0.499019>
+,<0.0971707,0.0143165,-0.498183>
+,<0.1039,-0.0567696,-0.498563>
+,<0.128414,-0.0483582,-0.488607>
+,<0.145202,-0.0425911,-0.481751>
+,<0.157621,-0.0383197,-0.476646>
+,<0.167341,-0.0349717,-0.472621>
+,<0.175289,-0.0322294,-0.469303>
+,<0.182026,-0.029901,-0.466465>
+,<0.187911,-0.027863,-0.463963>
+,<0.193189,-0.0260312,-0.461696>
+,<0.198038,-0.024345,-0.459591>
+,<0.202589,-0.0227585,-0.457595>
+,<0.206951,-0.0212347,-0.45566>
+,<0.211213,-0.0197421,-0.453749>
+,<0.215459,-0.0182515,-0.451824>
+,<0.219772,-0.0167339,-0.449847>
+,<0.224239,-0.0151583,-0.447777>
+,<0.228961,-0.0134888,-0.445567>
+,<0.234063,-0.0116812,-0.443155>
+,<0.239705,-0.00967802,-0.440462>
+,<0.223301,-0.0667773,-0.442807>
+,<0.353326,0.240459,0.28596>
+,<-0.0258393,0.334152,0.390557>
+,<0.294753,0.107499,0.38933>
+,<0.275601,0.13418,0.395538>
+,<0.20521,0.14802,0.438333>
+,<0.299567,0.0993803,0.387825>
+,<0.341631,0.054601,0.361016>
+,<0.363047,0.0733463,0.336423>
+,<0.351064,0.126512,0.334933>
+,<0.329197,0.12787,0.354087>
+,<0.337353,0.127688,0.346843>
+,<0.359666,0.172104,0.309169>
+,<0.356171,0.153371,0.319913>
+,<0.353803,0.114982,0.335366>
+,<0.35993,0.088048,0.336181>
+,<0.318782,0.0944332,0.373478>
+,<0.185041,-0.00410662,0.485143>
+,<0.292332,0.111505,0.390035>
+,<0.321551,0.0407658,0.381481>
+,<0.195219,0.135251,0.448002>
+,<0.177462,0.0964665,0.468611>
+,<0.271583,0.13788,0.397263>
+,<0.362258,0.0771467,0.336376>
+,<0.334448,0.0496244,0.368473>
+,<0.308194,0.0844735,0.384845>
+,<0.268733,-0.0451405,0.437376>
+,<0.289632,0.115924,0.390784>
+,<0.240011,-0.0468485,0.45714>
+,<0.307086,0.0716837,0.388456>
+,<0.311803,0.0877735,0.38104>
+,<0.310806,0.0869342,0.382078>
+,<0.314893,0.0908444,0.377689>
+,<0.318114,0.0939479,0.374174>
+,<0.324849,0.100488,0.366599>
+,<0.319544,0.0953324,0.372593>
+,<0.332089,0.047999,0.370878>
+,<0.343148,0.0556609,0.359406>
+,<0.346099,0.0577375,0.356235>
+,<0.340816,0.116261,0.347527>
+,<0.363636,0.0703943,0.33647>
+,<0.359116,0.0917544,0.336095>
+,<0.327634,0.103205,0.363369>
+,<0.305932,0.0884111,0.385651>
+,<0.191263,0.126576,0.452677>
+,<0.32353,0.099205,0.368108>
+,<0.360715,0.0844252,0.336256>
+,<0.358255,0.0956222,0.335995>
+,<0.3563,0.104232,0.335738>
+,<0.351068,0.126591,0.334903>
+,<0.353568,0.139761,0.327639>
+,<0.178579,0.349184,0.312094>
+,<0.167989,0.368261,0.295844>
+,<0.160069,0.38212,0.283668>
+,<0.357709,0.223181,0.289487>
+,<0.362049,0.185075,0.301682>
+,<0.165601,0.37247,0.292174>
+,<0.312306,0.14435,0.362921>
+,<0.314336,0.142372,0.361922>
+,<0.357761,0.161841,0.315067>
+,<0.352445,0.134005,0.330878>
+,<0.351391,0.128681,0.333856>
+,<0.230535,0.180555,0.412432>
+,<0.351121,0.127413,0.334578>
+,<0.317615,0.137664,0.360831>
+,<0.180732,0.345218,0.315392>
+,<0.303976,0.147494,0.368729>
+,<0.295706,0.124941,0.383343>
+,<-0.139768,0.454121,-0.156757>
+,<-0.164817,0.468964,-0.0862908>
+,<-0.246686,0.434211,-0.0251811>
+,<-0.246576,0.434305,-0.0245991>
+,<-0.245157,0.435305,-0.0206134>
+,<-0.242843,0.436881,-0.0135059>
+,<-0.205549,0.457679,0.0915348>
+,<0.0260136,0.43796,0.242164>
+,<-0.152288,0.475926,-0.0728563>
+,<-0.240439,0.438395,-0.00676215>
+,<-0.241336,0.437837,-0.00936458>
+,<-0.238072,0.439819,0.000209597>
+,<-0.236977,0.440456,0.00316365>
+,<-0.238308,0.439677,-0.000632618>
+,<-0.232823,0.44282,0.0150734>
+,<-0.230622,0.444046,0.0211174>
+,<-0.233327,0.442536,0.0134984>
+,<-0.21885,0.450487,0.0543056>
+,<-0.209548,0.455521,0.0800943>
+,<-0.220719,0.449472,0.0488745>
+,<-0.154802,0.483317,0.142263>
+,<-0.150177,0.485585,0.14395>
+,<-0.170633,0.475548,0.136364>
+,<0.0295676,0.436437,0.244554>
+,<0.133954,0.484804,-0.0139708>
+,<0.133246,0.48477,-0.0217294>
+,<-0.127756,0.49224,0.00967674>
+,<-0.0591981,0.489165,-0.0991679>
+,<-0.133934,0.485834,-0.0531457>
+,<-0.128564,0.490772,-0.0127699>
+,<-0.159303,0.472054,-0.0803605>
+,<-0.170252,0.465881,-0.0921414>
+,<-0.134173,0.452406,-0.166187>
+,<-0.234364,0.431774,-0.118208>
+,<-0.121246,0.448066,-0.187616>
+,<-0.141771,0.45471,-0.153357>
+,<-0.221714,0.341797,-0.291328>
+,<-0.155687,0.458546,-0.129485>
+,<-0.288539,0.366951,-0.183294>
+,<-0.250313,0.431469,-0.0360422>
+,<-0.249218,0.43232,-0.0326693>
+,<-0.257908,0.394182,-0.176331>
+,<-0.148933,0.456729,-0.141116>
+,<-0.166272,0.461299,-0.111167>
+,<-0.118182,0.446982,-0.19264>
+,<-0.0638418,0.406935,-0.325262>
+,<-0.0626868,0.426436,-0.282755>
+,<-0.183568,0.458808,-0.100028>
+,<-0.276021,0.37823,-0.180451>
+,<-0.34996,0.366244,-0.0299391>
+,<-0.262686,0.42133,-0.0748528>
+,<-0.258467,0.424839,-0.0616085>
+,<-0.255612,0.427191,-0.0526746>
+,<-0.253514,0.428901,-0.0461333>
+,<-0.251877,0.430218,-0.0410511>
+,<-0.250539,0.431279,-0.0369174>
+,<-0.249403,0.432165,-0.0334283>
+,<-0.248408,0.432928,-0.0303902>
+,<-0.247512,0.433602,-0.0276722>
+,<-0.224704,0.446302,-0.0268837>
+,<0.322839,0.0983473,0.368944>
+,<0.325474,0.100925,0.365925>
+,<0.321527,0.0970746,0.370424>
+,<0.320903,0.0966522,0.371076>
+,<0.316579,0.0924658,0.375857>
+,<0.320184,0.0957792,0.371926>
+,<0.31729,0.0930049,0.375116>
+,<0.315668,0.0914554,0.376882>
+,<0.309382,0.0854716,0.383618>
+,<0.302589,0.0278429,0.400307>
+,<0.352201,0.121773,0.33511>
+,<0.336507,0.0510461,0.366358>
+,<0.286346,0.121255,0.391652>
+,<0.291033,0.113637,0.3904>
+,<0.307127,0.0309018,0.395821>
+,<0.329305,0.046084,0.373699>
+,<0.338352,0.0523229,0.364449>
+,<0.337543,0.112998,0.351517>
+,<0.315679,0.0367474,0.387333>
+,<0.239655,0.167025,0.410671>
+,<0.221836,0.16773,0.422289>
+,<0.226967,0.173836,0.417236>
+,<0.225959,0.172667,0.41822>
+,<0.253594,-0.0460484,0.447839>
+,<0.309471,0.0325777,0.393488>
+,<0.317232,0.0378776,0.385779>
+,<0.322669,0.0415976,0.380355>
+,<0.326754,0.044399,0.376259>
+,<0.329989,0.0466224,0.372998>
+,<0.332657,0.0484618,0.370291>
+,<0.334934,0.0500364,0.367965>
+,<0.336933,0.0514242,0.365907>
+,<0.338735,0.0526789,0.364038>
+,<0.340396,0.0538395,0.362301>
+,<0.34196,0.0549358,0.360652>
+,<0.343464,0.0559919,0.359052>
+,<0.344939,0.0570294,0.357471>
+,<0.346414,0.0580684,0.355876>
+,<0.347917,0.05913,0.354236>
+,<0.34948,0.0602371,0.352517>
+,<0.35114,0.0614164,0.350676>
+,<0.352941,0.0627011,0.348663>
+,<0.354944,0.0641348,0.346407>
+,<0.357232,0.0657784,0.343811>
+,<0.359929,0.0677221,0.340731>
+,<0.363227,0.0701063,0.336941>
+,<0.362908,0.0739342,0.336436>
+,<0.362122,0.0777092,0.336387>
+,<0.361351,0.0813638,0.336331>
+,<0.360579,0.0849716,0.336265>
+,<0.359791,0.0886025,0.336189>
+,<0.358971,0.0923283,0.336101>
+,<0.358101,0.0962283,0.335998>
+,<0.357158,0.100397,0.335878>
+,<0.356116,0.104954,0.335735>
+,<0.354934,0.110059,0.335563>
+,<0.353559,0.115937,0.335352>
+,<0.351908,0.122925,0.335086>
+,<0.347395,0.12273,0.339487>
+,<0.342488,0.117825,0.345513>
+,<0.338848,0.114193,0.349961>
+,<0.335989,0.111345,0.353434>
+,<0.333642,0.10901,0.356267>
+,<0.331645,0.107026,0.358662>
+,<0.329892,0.105288,0.360749>
+,<0.328311,0.103723,0.362616>
+,<0.335115,0.0786323,0.363201>
+,<0.112102,-0.323996,0.381243>
+,<0.107131,-0.321538,0.383294>
+,<0.102434,-0.319261,0.385194>
+,<0.0900795,-0.313127,0.390268>
+,<0.0635228,-0.299989,0.401004>
+,<0.0864807,-0.311382,0.391712>
+,<0.0546806,-0.295575,0.404541>
+,<0.0288394,-0.282522,0.414691>
+,<0.0399073,-0.288155,0.410378>
+,<-0.101604,-0.395339,0.309488>
+,<-0.195622,-0.424383,0.178308>
+,<0.0867314,-0.350855,0.358249>
+,<0.0725091,-0.364039,0.346664>
+,<0.0590704,-0.376353,0.335623>
+,<0.0453484,-0.388781,0.324249>
+,<0.0118917,-0.418558,0.296169>
+,<-0.27136,-0.363494,0.230152>
+,<-0.165631,-0.351977,0.341192>
+,<-0.20671,-0.417056,0.183372>
+,<-0.172182,-0.439069,0.167479>
+,<-0.129884,-0.286155,0.400451>
+,<-0.111719,-0.275148,0.411236>
+,<-0.053578,-0.239369,0.44443>
+,<-0.0633092,-0.24543,0.439015>
+,<-0.0863251,-0.259653,0.425986>
+,<-0.078832,-0.255038,0.430264>
+,<-0.101508,-0.268955,0.417205>
+,<-0.0938352,-0.264262,0.421661>
+,<-0.120395,-0.280414,0.406105>
+,<-0.127252,-0.284593,0.402005>
+,<-0.118008,-0.278995,0.407504>
+,<-0.152777,-0.29994,0.386665>
+,<-0.137545,-0.290807,0.395839>
+,<-0.149313,-0.297891,0.388742>
+,<-0.167233,-0.35086,0.341988>
+,<-0.180138,-0.316371,0.369973>
+,<-0.190602,-0.427616,0.176003>
+,<-0.200835,-0.420968,0.180693>
+,<-0.179477,-0.434597,0.170865>
+,<-0.264708,-0.337708,0.285743>
+,<-0.222284,-0.406443,0.190489>
+,<-0.0325985,-0.440091,0.274194>
+,<-0.0813838,-0.408651,0.299256>
+,<-0.0194747,-0.451273,0.261687>
+,<-0.204937,-0.329381,0.351525>
+,<-0.198469,-0.32917,0.357167>
+,<-0.198178,-0.422715,0.179479>
+,<-0.193113,-0.426006,0.177157>
+,<-0.267558,-0.369339,0.222178>
+,<-0.0167085,-0.443592,0.271944>
+,<-0.145615,-0.455021,0.155086>
+,<0.00907043,-0.421013,0.293817>
+,<-0.00262124,-0.431278,0.283913>
+,<0.0279657,-0.404304,0.309743>
+,<0.0191042,-0.412162,0.302288>
+,<0.0434305,-0.390481,0.32268>
+,<0.0359921,-0.397149,0.316471>
+,<0.0572715,-0.377966,0.334164>
+,<0.0504715,-0.384133,0.328535>
+,<0.0706877,-0.365691,0.345201>
+,<0.0639673,-0.371858,0.339684>
+,<0.0847386,-0.352685,0.356659>
+,<0.0775637,-0.359345,0.35082>
+,<0.100702,-0.337745,0.369569>
+,<0.0923811,-0.345552,0.362853>
+,<-0.0213985,-0.321575,0.382795>
+,<0.105621,-0.333127,0.373506>
+,<-0.075606,0.393575,-0.345446>
+,<-0.227821,0.338368,-0.290121>
+,<-0.244403,0.407675,-0.168387>
+,<-0.294721,0.401415,-0.0674973>
+,<-0.292734,0.363121,-0.184228>
+,<-0.266356,0.41827,-0.086238>
+,<-0.329058,0.328908,-0.192098>
+,<-0.240147,0.421708,-0.137986>
+,<-0.243371,0.411198,-0.160859>
+,<-0.230332,0.433975,-0.116805>
+,<-0.222462,0.438261,-0.113993>
+,<-0.215081,0.442243,-0.111355>
+,<-0.208014,0.44602,-0.108826>
+,<-0.201112,0.449674,-0.106354>
+,<-0.19424,0.453276,-0.103891>
+,<-0.187265,0.456896,-0.101389>
+,<-0.180047,0.460605,-0.098798>
+,<-0.171947,0.462715,-0.101427>
+,<-0.164387,0.460783,-0.11453>
+,<-0.158866,0.459352,-0.124081>
+,<-0.151101,0.457292,-0.13747>
+,<-0.154582,0.458224,-0.131476>
+,<-0.145605,0.455779,-0.146897>
+,<-0.148163,0.456491,-0.142516>
+,<-0.141214,0.45452,-0.154381>
+,<-0.143315,0.455129,-0.150807>
+,<-0.137356,0.453367,-0.160911>
+,<-0.137861,0.453549,-0.159982>
+,<-0.132319,0.451814,-0.169288>
+,<-0.13181,0.45162,-0.170216>
+,<-0.133675,0.45222,-0.167098>
+,<-0.126256,0.4498,-0.179362>
+,<-0.125633,0.449559,-0.180467>
+,<-0.127836,0.450307,-0.176822>
+,<-0.120444,0.447753,-0.18901>
+,<-0.123199,0.448719,-0.184479>
+,<-0.110001,0.444031,-0.206002>
+,<-0.108508,0.443451,-0.208522>
+,<-0.113362,0.445219,-0.200602>
+,<-0.0837549,0.434321,-0.248628>
+,<-0.0789755,0.432483,-0.256504>
+,<-0.093052,0.43774,-0.23366>
+,<-0.0578502,0.413738,-0.314887>
+,<-0.236867,0.33325,-0.288303>
+,<-0.186145,0.36159,-0.298226>
+,<-0.151112,0.389402,-0.293982>
+,<-0.17249,0.391612,-0.27145>
+,<-0.187912,0.393103,-0.255069>
+,<-0.194397,0.393693,-0.248135>
+,<-0.204608,0.396102,-0.233769>
+,<-0.208865,0.397157,-0.227561>
+,<-0.233504,0.402871,-0.190945>
+,<-0.221138,0.400095,-0.209463>
+,<-0.213079,0.398186,-0.221379>
+,<-0.204408,0.396047,-0.234068>
+,<-0.199592,0.394827,-0.241066>
+,<-0.195551,0.39379,-0.246905>
+,<-0.199811,0.394887,-0.240741>
+,<-0.213257,0.398233,-0.221108>
+,<-0.217316,0.399204,-0.215121>
+,<-0.221311,0.40014,-0.209199>
+,<-0.225319,0.401059,-0.203227>
+,<-0.229418,0.401978,-0.197087>
+,<-0.233694,0.402917,-0.19065>
+,<-0.23825,0.403895,-0.183758>
+,<-0.243213,0.404938,-0.176216>
+,<-0.164923,0.436861,-0.17987>
+,<0.301956,0.14706,0.37055>
+,<0.155173,0.450785,0.171997>
+,<0.301308,0.146784,0.371183>
+,<0.347634,0.262673,0.281388>
+,<0.170293,0.165239,0.442657>
+,<0.300939,0.146569,0.371563>
+,<0.145563,0.191875,0.438478>
+,<0.300665,0.146453,0.371829>
+,<0.136713,0.201226,0.436913>
+,<0.300017,0.146073,0.372494>
+,<0.299076,0.145266,0.373555>
+,<0.299403,0.145597,0.373168>
+,<0.298797,0.145051,0.373858>
+,<0.125784,0.212693,0.434712>
+,<0.298188,0.144436,0.374572>
+,<0.129834,0.208588,0.435508>
+,<0.297637,0.143706,0.375282>
+,<0.135344,0.202777,0.436605>
+,<0.297066,0.142903,0.376029>
+,<0.148049,0.189125,0.438951>
+,<0.296551,0.141982,0.376773>
+,<0.260213,0.148302,0.402078>
+,<0.296069,0.140947,0.377528>
+,<0.243362,0.220582,0.386371>
+,<0.295623,0.139789,0.378296>
+,<0.0771637,0.331101,0.369499>
+,<0.295242,0.138495,0.379057>
+,<0.146895,0.307681,0.3679>
+,<0.294937,0.137056,0.379805>
+,<0.307442,0.0754936,0.387385>
+,<0.294675,0.135453,0.380572>
+,<0.18696,0.11717,0.457701>
+,<0.294576,0.133703,0.381259>
+,<0.281975,0.128271,0.39276>
+,<0.294606,0.131795,0.381892>
+,<0.288636,0.12831,0.387656>
+,<0.294672,0.12964,0.382575>
+,<0.29297,0.128334,0.384323>
+,<0.312998,0.109046,0.374507>
+,<0.313656,0.109248,0.373895>
+,<0.309193,0.128274,0.371522>
+,<0.316241,0.110571,0.371298>
+,<0.316863,0.111076,0.370609>
+,<0.317442,0.111687,0.369922>
+,<0.310908,0.128254,0.370084>
+,<0.319127,0.114,0.367729>
+,<0.319645,0.114979,0.366962>
+,<0.312852,0.128227,0.368429>
+,<0.320839,0.118702,0.364692>
+,<0.321114,0.120232,0.363937>
+,<0.315275,0.12819,0.366336>
+,<0.321355,0.123785,0.362512>
+,<0.31872,0.128172,0.363313>
+,<0.320999,0.127991,0.361357>
+,<0.321199,0.125764,0.361963>
+,<0.316809,0.128169,0.364999>
+,<0.321314,0.121931,0.363184>
+,<0.313981,0.12821,0.367458>
+,<0.320514,0.117324,0.365434>
+,<0.320075,0.116091,0.366225>
+,<0.311839,0.128241,0.369294>
+,<0.318603,0.113122,0.368465>
+,<0.318046,0.112347,0.369192>
+,<0.310033,0.128264,0.37082>
+,<0.315604,0.110147,0.371973>
+,<0.314977,0.109761,0.372623>
+,<0.314324,0.109466,0.373266>
+,<0.308371,0.128282,0.372204>
+,<0.310941,0.108858,0.376275>
+,<0.310239,0.108898,0.376842>
+,<0.309526,0.109017,0.377392>
+,<0.306714,0.128296,0.373562>
+,<0.306576,0.110027,0.379487>
+,<0.305799,0.11042,0.379992>
+,<0.305024,0.110911,0.380465>
+,<0.304926,0.128306,0.375005>
+,<0.304867,0.128298,0.375055>
+,<0.303931,0.12831,0.3758>
+,<0.303866,0.128301,0.375855>
+,<0.300491,0.115305,0.382705>
+,<0.302828,0.128314,0.376674>
+,<0.302755,0.128302,0.376735>
+,<0.298875,0.117691,0.383221>
+,<0.301574,0.128317,0.377661>
+,<0.30149,0.128302,0.377732>
+,<0.297548,0.120195,0.383457>
+,<0.300107,0.128321,0.378809>
+,<0.300005,0.128297,0.378896>
+,<0.296495,0.122702,0.383465>
+,<0.298327,0.128326,0.380192>
+,<0.298194,0.128279,0.38031>
+,<0.295731,0.125194,0.383241>
+,<0.296062,0.128345,0.381938>
+,<0.295066,0.127115,0.383118>
+,<0.296968,0.121247,0.383569>
+,<0.299329,0.116852,0.38313>
+,<0.300162,0.115675,0.382848>
+,<0.300977,0.11462,0.382536>
+,<0.298531,0.118167,0.383339>
+,<0.297749,0.119625,0.383483>
+,<0.296304,0.123013,0.383511>
+,<0.311632,0.108885,0.375696>
+,<0.312322,0.108925,0.375109>
+,<0.308804,0.109178,0.377934>
+,<0.30755,0.128289,0.37288>
+,<0.307326,0.109671,0.378987>
+,<0.308068,0.109381,0.378472>
+,<0.304241,0.11148,0.380918>
+,<0.305846,0.128301,0.374266>
+,<0.301801,0.113681,0.382178>
+,<0.303426,0.11211,0.381374>
+,<0.302379,0.113143,0.381888>
+,<0.302631,0.112857,0.381776>
+,<0.30579,0.128294,0.374313>
+,<0.304498,0.111318,0.380762>
+,<0.306661,0.128289,0.373608>
+,<0.306786,0.109945,0.379341>
+,<0.307499,0.128283,0.372924>
+,<0.309157,0.109119,0.377664>
+,<0.30832,0.128276,0.372248>
+,<0.311512,0.108892,0.375793>
+,<0.309142,0.128268,0.371567>
+,<0.313747,0.109289,0.373807>
+,<0.30998,0.128258,0.370867>
+,<0.315769,0.11028,0.371792>
+,<0.310853,0.128247,0.370133>
+,<0.317511,0.111782,0.369833>
+,<0.311779,0.128233,0.369348>
+,<0.318919,0.113712,0.368003>
+,<0.312786,0.128217,0.368489>
+,<0.319988,0.115929,0.366354>
+,<0.313907,0.128198,0.367526>
+,<0.320709,0.118352,0.364924>
+,<0.315189,0.128173,0.366418>
+,<0.321107,0.120867,0.363729>
+,<0.316703,0.128141,0.365102>
+,<0.321242,0.123362,0.362757>
+,<0.318564,0.128095,0.363478>
+,<0.321191,0.125749,0.361975>
+,<0.321008,0.127999,0.361346>
+,<0.176493,0.352998,0.308897>
+,<0.320471,0.130246,0.361022>
+,<0.324004,0.128072,0.358654>
+,<0.319991,0.132232,0.36073>
+,<0.328789,0.127928,0.354432>
+,<0.319351,0.134101,0.360616>
+,<0.33665,0.127746,0.347454>
+,<0.318601,0.13582,0.360646>
+,<0.35119,0.127763,0.334385>
+,<0.317818,0.137371,0.360761>
+,<0.352234,0.133025,0.331446>
+,<0.317049,0.138768,0.360915>
+,<0.353342,0.138691,0.328262>
+,<0.316199,0.140021,0.361189>
+,<0.354547,0.144935,0.324731>
+,<0.31541,0.141152,0.36145>
+,<0.355891,0.151995,0.320718>
+,<0.314566,0.14215,0.361807>
+,<0.357436,0.160208,0.316025>
+,<0.313758,0.143049,0.362164>
+,<0.359272,0.170093,0.31035>
+,<0.312942,0.14384,0.362567>
+,<0.36155,0.182483,0.303206>
+,<0.312123,0.144525,0.363011>
+,<0.363937,0.19822,0.294524>
+,<0.31134,0.145149,0.363441>
+,<0.3607,0.211223,0.291922>
+,<0.310549,0.14567,0.363918>
+,<0.35692,0.226244,0.288883>
+,<0.309773,0.146118,0.364407>
+,<0.352364,0.244164,0.28522>
+,<0.309016,0.146517,0.364894>
+,<0.279726,0.260855,0.339875>
+,<0.308263,0.146825,0.365412>
+,<0.19612,0.137235,0.446924>
+,<0.307522,0.147068,0.365943>
+,<0.204291,0.3005,0.351404>
+,<0.306795,0.147283,0.366469>
+,<0.174432,0.35674,0.305736>
+,<0.306076,0.147417,0.367018>
+,<0.156711,0.387925,0.2785>
+,<0.305355,0.147469,0.367599>
+,<0.305371,0.14747,0.367585>
+,<0.172355,0.360481,0.302549>
+,<0.304668,0.14752,0.368147>
+,<0.303301,0.147388,0.369325>
+,<0.191161,0.325651,0.331348>
+,<0.302626,0.147251,0.369931>
+,<0.30306,0.14732,0.36955>
+,<-0.271377,-0.363497,0.23011>
+,<-0.285261,-0.365798,0.195032>
+,<-0.326748,-0.370419,0.0835753>
+,<-0.339007,-0.370585,0.0472502>
+,<-0.315197,-0.370075,0.117124>
+,<-0.313522,-0.369978,0.121782>
+,<-0.323709,-0.370361,0.0925257>
+,<-0.3554,-0.367162,0.00987233>
+,<-0.394133,-0.33006,0.0112669>
+,<-0.417002,-0.306997,0.00965892>
+,<-0.446952,-0.105591,0.248254>
+,<-0.312993,-0.316616,0.250887>
+,<-0.218531,-0.40904,0.188735>
+,<-0.269991,-0.338361,0.27985>
+,<-0.279444,-0.339544,0.269203>
+,<-0.260626,-0.379858,0.207758>
+,<-0.260495,-0.337138,0.290481>
+,<-0.296229,-0.328218,0.260016>
+,<-0.306891,-0.320866,0.254208>
+,<-0.316708,-0.314047,0.24882>
+,<-0.325942,-0.307583,0.243712>
+,<-0.334804,-0.30133,0.238771>
+,<-0.343475,-0.295162,0.233897>
+,<-0.366978,-0.256641,0.236321>
+,<-0.350128,-0.294283,0.221124>
+,<-0.370014,-0.3001,0.16144>
+,<-0.36578,-0.258762,0.236114>
+,<-0.393439,-0.208084,0.241187>
+,<-0.431941,-0.133894,0.24759>
+,<-0.466804,-0.0838513,0.226641>
+,<-0.520861,-0.054767,0.119227>
+,<-0.538303,-0.0643192,0.0529703>
+,<-0.515346,-0.0518225,0.139483>
+,<-0.45657,-0.0950988,0.237833>
+,<-0.520598,0.0570927,-0.0345948>
+,<-0.415656,0.254981,0.149433>
+,<-0.488987,-0.0592274,0.202061>
+,<-0.524709,-0.0568693,0.104885>
+,<-0.544866,-0.0680019,0.0272331>
+,<-0.397797,-0.306948,0.0695218>
+,<-0.385431,-0.304102,0.111781>
+,<-0.376585,-0.301877,0.140751>
+,<-0.525028,-0.127029,-0.00947872>
+,<-0.410992,-0.313589,0.0119082>
+,<-0.3989,-0.325419,0.0114706>
+,<-0.387994,-0.336015,0.0110763>
+,<-0.377919,-0.34573,0.0107125>
+,<-0.368408,-0.354831,0.0103695>
+,<-0.359244,-0.363532,0.0100394>
+,<-0.348395,-0.370594,0.0196481>
+,<-0.335962,-0.370482,0.0565211>
+,<-0.329601,-0.370407,0.0753384>
+,<-0.325671,-0.370346,0.0869302>
+,<-0.322954,-0.370292,0.0949148>
+,<-0.320927,-0.370241,0.100847>
+,<-0.319327,-0.37019,0.105506>
+,<-0.318008,-0.370139,0.109327>
+,<-0.316882,-0.370087,0.112575>
+,<-0.31589,-0.370032,0.11542>
+,<-0.314993,-0.369974,0.117977>
+,<-0.314163,-0.369913,0.12033>
+,<-0.313377,-0.369848,0.122543>
+,<-0.312615,-0.369781,0.124665>
+,<-0.31186,-0.369713,0.126741>
+,<-0.311095,-0.369642,0.128813>
+,<-0.310306,-0.369566,0.130923>
+,<-0.32754,-0.35453,0.132009>
+,<0.185438,0.336453,0.322596>
+,<0.182999,0.341011,0.318863>
+,<0.194694,0.318922,0.336748>
+,<0.188125,0.331399,0.326706>
+,<0.221099,0.281309,0.361374>
+,<0.19895,0.310776,0.343248>
+,<0.1858,0.14848,0.445204>
+,<0.351818,0.269737,0.269006>
+,<0.352839,0.271498,0.265927>
+,<0.222224,0.448099,0.0196534>
+,<0.167515,0.41683,0.231169>
+,<0.162787,0.40724,0.248016>
+,<0.0715005,0.435195,0.236673>
+,<0.171393,0.426954,0.213577>
+,<0.27329,0.395292,0.138675>
+,<0.249391,0.424605,0.0878438>
+,<0.251647,0.41578,0.117528>
+,<0.354648,0.314359,0.209475>
+,<0.353992,0.296076,0.233746>
+,<0.353169,0.277717,0.257819>
+,<0.299289,0.261487,0.323282>
+,<0.21057,0.154376,0.433209>
+,<0.16481,0.0690362,0.48284>
+,<0.199548,0.141313,0.443696>
+,<0.235496,0.195912,0.402554>
+,<0.265532,0.260357,0.35175>
+,<0.275268,0.260722,0.343605>
+,<0.284926,0.261058,0.335468>
+,<0.294691,0.261373,0.327183>
+,<0.304756,0.261672,0.318584>
+,<0.315342,0.26196,0.309479>
+,<0.326713,0.262242,0.299634>
+,<0.339211,0.262522,0.288747>
+,<0.349313,0.265552,0.276389>
+,<0.352927,0.27333,0.263561>
+,<0.353389,0.282758,0.25127>
+,<0.353798,0.291908,0.23927>
+,<0.354161,0.300959,0.227325>
+,<0.354487,0.310085,0.215209>
+,<0.30005,0.399978,0.0473486>
+,<0.235707,0.390899,0.211496>
+,<0.255417,0.379437,0.210331>
+,<0.165081,0.473372,0.0559302>
+,<0.218832,0.449691,0.0218342>
+,<0.281427,0.387175,0.146687>
+,<0.288428,0.359696,0.208148>
+,<0.242135,0.387192,0.211129>
+,<0.299705,0.352843,0.207356>
+,<0.191468,0.41566,0.2137>
+,<0.159168,0.442283,0.189957>
+,<0.151049,0.459309,0.153627>
+,<0.157167,0.446572,0.180942>
+,<0.182229,0.42071,0.214095>
+,<0.172157,0.426174,0.214525>
+,<0.0985803,0.435954,0.226412>
+,<0.0794964,0.43548,0.23368>
+,<0.14278,0.479026,0.0979524>
+,<0.195871,0.450472,0.106151>
+,<0.171393,0.424602,0.21733>
+,<0.168365,0.418477,0.22823>
+,<0.165764,0.413209,0.23754>
+,<0.163462,0.408542,0.245725>
+,<0.161371,0.404298,0.253109>
+,<0.159427,0.400348,0.259926>
+,<0.157581,0.396591,0.266353>
+,<0.155791,0.392944,0.272538>
+,<0.219585,0.354976,0.275998>
+,<-0.277702,-0.378077,-0.181279>
+,<-0.272423,-0.379175,-0.186366>
+,<-0.159053,-0.459719,-0.118902>
+,<-0.190284,-0.433334,-0.162432>
+,<-0.191071,-0.427229,-0.177644>
+,<-0.19397,-0.398554,-0.245665>
+,<-0.193246,-0.444362,-0.126181>
+,<-0.21297,-0.438769,-0.112667>
+,<-0.200762,-0.442288,-0.121082>
+,<-0.199125,-0.442759,-0.122147>
+,<-0.207678,-0.440313,-0.116356>
+,<-0.204257,-0.441299,-0.118698>
+,<-0.216505,-0.437706,-0.110224>
+,<-0.218168,-0.437188,-0.109121>
+,<-0.214565,-0.438279,-0.111615>
+,<-0.226114,-0.434726,-0.103592>
+,<-0.233441,-0.432412,-0.098413>
+,<-0.2359,-0.431608,-0.0967396>
+,<-0.230692,-0.433278,-0.100392>
+,<-0.254268,-0.425605,-0.0837323>
+,<-0.258837,-0.424072,-0.0805627>
+,<-0.249426,-0.427191,-0.0872137>
+,<-0.278294,-0.414893,-0.0751256>
+,<-0.279379,-0.410902,-0.0856213>
+,<-0.27828,-0.41494,-0.0750047>
+,<-0.28112,-0.404261,-0.102875>
+,<-0.281825,-0.401446,-0.110097>
+,<-0.281111,-0.404293,-0.102795>
+,<-0.283071,-0.396236,-0.123281>
+,<-0.282472,-0.398782,-0.116868>
+,<-0.284185,-0.391255,-0.135648>
+,<-0.284709,-0.388777,-0.141719>
+,<-0.284178,-0.391282,-0.135585>
+,<-0.285775,-0.38346,-0.154562>
+,<-0.285238,-0.386188,-0.148>
+,<-0.286925,-0.377297,-0.169191>
+,<-0.283306,-0.376885,-0.175852>
+,<-0.267345,-0.380208,-0.191235>
+,<-0.235369,-0.386176,-0.22134>
+,<-0.241434,-0.385109,-0.215697>
+,<-0.201181,-0.391837,-0.252787>
+,<-0.200424,-0.391952,-0.25349>
+,<-0.190861,-0.428996,-0.173292>
+,<-0.192605,-0.412709,-0.212428>
+,<-0.168294,-0.455398,-0.122282>
+,<-0.188947,-0.442239,-0.13893>
+,<-0.045436,-0.472493,-0.182319>
+,<-0.0805285,-0.434616,-0.252121>
+,<-0.0917704,-0.422033,-0.274135>
+,<-0.211423,-0.390183,-0.243424>
+,<-0.22048,-0.388696,-0.235106>
+,<-0.212036,-0.390089,-0.242853>
+,<-0.191549,-0.422971,-0.18799>
+,<-0.193239,-0.40587,-0.228561>
+,<-0.169788,-0.386621,-0.295462>
+,<-0.12784,-0.396091,-0.307774>
+,<-0.0713231,-0.444828,-0.233858>
+,<-0.0544629,-0.463023,-0.200321>
+,<-0.0404276,-0.477676,-0.172319>
+,<-0.0337643,-0.514389,-0.0731235>
+,<-0.12205,-0.476262,-0.10543>
+,<-0.167141,-0.455951,-0.121828>
+,<-0.189214,-0.440629,-0.143286>
+,<-0.179913,-0.449826,-0.126467>
+,<-0.189456,-0.43913,-0.147303>
+,<-0.190469,-0.432114,-0.1655>
+,<-0.225451,-0.420597,-0.150567>
+,<-0.230223,0.0191577,-0.447759>
+,<-0.228302,0.0113893,-0.449104>
+,<-0.234014,0.0346652,-0.444988>
+,<-0.232115,0.0268669,-0.446396>
+,<-0.164799,-0.0830814,-0.477172>
+,<-0.237988,0.0511715,-0.441918>
+,<-0.248215,0.0945994,-0.433385>
+,<-0.251846,0.110252,-0.430201>
+,<-0.262215,0.155304,-0.42087>
+,<-0.256348,0.12976,-0.426185>
+,<-0.171248,0.167768,-0.451294>
+,<-0.201516,0.184871,-0.438578>
+,<-0.130508,0.144682,-0.467918>
+,<-0.113935,0.13526,-0.47444>
+,<-0.0869743,0.0218015,-0.495137>
+,<-0.0697933,0.0945107,-0.492843>
+,<-0.129959,-0.0374605,-0.486085>
+,<-0.105007,-0.00495554,-0.491818>
+,<-0.0961837,0.00648363,-0.493636>
+,<-0.0863963,0.0244061,-0.495094>
+,<-0.0714209,0.110989,-0.490424>
+,<-0.0894462,0.121296,-0.483772>
+,<-0.172774,0.258169,-0.408373>
+,<-0.267239,0.315311,-0.281656>
+,<-0.276809,0.309335,-0.279396>
+,<-0.375264,0.210205,-0.289947>
+,<-0.294523,0.298163,-0.275012>
+,<-0.296984,0.29664,-0.274352>
+,<-0.178443,0.171793,-0.448305>
+,<-0.165646,0.164558,-0.453632>
+,<-0.154475,0.158237,-0.458236>
+,<-0.14446,0.152563,-0.46232>
+,<-0.135262,0.147346,-0.466029>
+,<-0.126626,0.142442,-0.46947>
+,<-0.11835,0.137737,-0.472728>
+,<-0.11026,0.133133,-0.475873>
+,<-0.102199,0.128539,-0.478967>
+,<-0.0940121,0.123868,-0.482069>
+,<-0.0855334,0.119025,-0.48524>
+,<-0.0765749,0.113902,-0.488549>
+,<-0.0669067,0.108366,-0.492075>
+,<-0.0399389,0.113937,-0.492881>
+,<-0.0751203,0.0721837,-0.493775>
+,<-0.0175665,0.118729,-0.493239>
+,<-0.0297245,0.116139,-0.493066>
+,<-0.0829664,0.0390332,-0.494812>
+,<-0.0727675,0.00824861,-0.496362>
+,<-0.0476711,-0.00589105,-0.498105>
+,<-0.0401789,-0.0101074,-0.498541>
+,<-0.0793225,0.0544771,-0.494392>
+,<-0.0881166,0.0170353,-0.495192>
+,<-0.092753,0.0109625,-0.494311>
+,<-0.0972532,0.00513734,-0.493422>
+,<-0.101663,-0.000578721,-0.492521>
+,<-0.106069,-0.00629657,-0.491591>
+,<-0.110557,-0.0121272,-0.490615>
+,<-0.115217,-0.0181908,-0.48957>
+,<-0.120157,-0.0246264,-0.488431>
+,<-0.125509,-0.0316068,-0.487163>
+,<-0.131446,-0.0393583,-0.485722>
+,<-0.138206,-0.0481947,-0.484043>
+,<-0.146138,-0.0585736,-0.482031>
+,<-0.15578,-0.0712017,-0.479539>
+,<-0.168018,-0.0872427,-0.476323>
+,<-0.184431,-0.108772,-0.471947>
+,<-0.1984,-0.104953,-0.466981>
+,<-0.156562,0.0450098,-0.473141>
+,<-0.269472,0.313897,-0.281167>
+,<-0.270385,0.313369,-0.280908>
+,<-0.251027,0.325033,-0.285379>
+,<-0.258449,0.320621,-0.283735>
+,<-0.133806,0.309614,-0.388625>
+,<-0.0782534,0.390531,-0.35001>
+,<-0.149954,0.288451,-0.396911>
+,<-0.197612,0.22471,-0.420523>
+,<-0.218047,0.196868,-0.430312>
+,<-0.21944,0.194974,-0.430965>
+,<-0.24294,0.1823,-0.424344>
+,<-0.287164,0.302822,-0.276846>
+,<-0.270557,0.169623,-0.414214>
+,<-0.297856,0.16754,-0.394367>
+,<-0.272888,0.31178,-0.280347>
+,<-0.251734,0.324657,-0.285181>
+,<-0.266413,0.315781,-0.281892>
+,<-0.254216,0.323189,-0.284636>
+,<-0.261697,0.318698,-0.282949>
+,<-0.259149,0.320239,-0.283531>
+,<-0.256672,0.321726,-0.28409>
+,<-0.255983,0.322098,-0.284289>
+,<-0.253525,0.323559,-0.284834>
+,<-0.245703,0.328142,-0.286516>
+,<-0.242748,0.329849,-0.287134>
+,<-0.239483,0.331722,-0.287809>
+,<-0.235782,0.333832,-0.288563>
+,<-0.231467,0.336277,-0.289433>
+,<-0.226263,0.33921,-0.290471>
+,<-0.219728,0.342873,-0.29176>
+,<-0.211095,0.347691,-0.29345>
+,<-0.198887,0.354477,-0.295821>
+,<-0.179859,0.365022,-0.299493>
+,<-0.14519,0.384186,-0.306151>
+,<-0.124076,0.388645,-0.317577>
+,<-0.104043,0.389495,-0.331783>
+,<-0.0782318,0.390431,-0.350127>
+,<-0.0834398,0.374635,-0.362066>
+,<-0.0973471,0.356809,-0.369469>
+,<-0.109182,0.341579,-0.375729>
+,<-0.119554,0.328176,-0.381179>
+,<-0.128884,0.316066,-0.386045>
+,<-0.137472,0.304867,-0.39049>
+,<-0.14555,0.294282,-0.394638>
+,<-0.153303,0.284074,-0.398585>
+,<-0.16089,0.274034,-0.402415>
+,<-0.168458,0.26397,-0.406202>
+,<-0.176151,0.253688,-0.410018>
+,<-0.184127,0.242976,-0.413939>
+,<-0.192564,0.23159,-0.418051>
+,<-0.201684,0.219226,-0.422458>
+,<-0.211775,0.205485,-0.427294>
+,<-0.223882,0.192603,-0.429723>
+,<-0.238,0.184996,-0.425741>
+,<-0.252362,0.177217,-0.421625>
+,<-0.267159,0.169895,-0.416653>
+,<-0.281118,0.168848,-0.406566>
+,<-0.294649,0.167809,-0.396707>
+,<-0.308018,0.166758,-0.386887>
+,<-0.321481,0.165674,-0.376917>
+,<-0.3353,0.164536,-0.366601>
+,<-0.349769,0.163318,-0.355715>
+,<-0.365235,0.161988,-0.343989>
+,<-0.376171,0.167042,-0.330027>
+,<-0.375883,0.183225,-0.315066>
+,<-0.375581,0.197423,-0.301878>
+,<-0.250076,0.305099,-0.307859>
+,<0.0392601,0.46276,0.185309>
+,<0.0363802,0.46269,0.186119>
+,<0.0244192,0.462321,0.189467>
+,<-0.089654,0.495679,0.110669>
+,<0.0330824,0.4626,0.187045>
+,<-0.023456,0.457811,0.208618>
+,<-0.00708351,0.451437,0.219796>
+,<-0.00195534,0.449396,0.223315>
+,<-0.0221378,0.457315,0.209495>
+,<-0.015031,0.454539,0.214389>
+,<-0.00114467,0.449086,0.223844>
+,<-0.0139467,0.454129,0.215107>
+,<0.00413917,0.446974,0.227435>
+,<0.00895781,0.445029,0.230699>
+,<0.0134522,0.443195,0.233735>
+,<0.017733,0.44143,0.236617>
+,<0.0218926,0.439696,0.239408>
+,<0.0344616,0.434345,0.247784>
+,<0.0301757,0.436188,0.244937>
+,<0.045081,0.433863,0.246324>
+,<0.0391539,0.433499,0.24845>
+,<0.0367383,0.433349,0.249305>
+,<0.0398989,0.433556,0.248164>
+,<0.0555703,0.434466,0.242514>
+,<0.0599167,0.434689,0.240928>
+,<0.0640387,0.434886,0.239416>
+,<0.0680273,0.435063,0.237944>
+,<0.071963,0.435223,0.236483>
+,<0.0759218,0.435369,0.235005>
+,<0.079982,0.435505,0.233479>
+,<0.0842298,0.435632,0.231874>
+,<0.0887676,0.435752,0.230151>
+,<0.0937245,0.435866,0.228257>
+,<0.0506551,0.462912,0.182076>
+,<-0.0757118,0.469149,0.186662>
+,<0.057486,0.462962,0.179922>
+,<0.0468231,0.497663,0.0120008>
+,<0.0396395,0.498415,0.00408717>
+,<0.00437372,0.500277,-0.0102676>
+,<0.252686,0.414798,0.118741>
+,<0.192391,0.461585,0.03868>
+,<0.251167,0.416149,0.117254>
+,<0.138019,0.482878,0.0877917>
+,<0.200392,0.410754,0.213294>
+,<0.0015441,0.493886,0.0986315>
+,<0.153147,0.455003,0.162952>
+,<0.0997233,0.461922,0.167177>
+,<0.0223477,0.498937,-0.0361191>
+,<0.0677483,0.462784,0.176944>
+,<0.0593304,0.462901,0.179491>
+,<0.0249551,0.493044,0.0954594>
+,<-0.135279,0.492383,0.12821>
+,<0.0758837,0.462604,0.17447>
+,<0.00987517,0.493616,0.0975085>
+,<0.0425574,0.498136,0.00724176>
+,<-0.0693116,0.498945,0.053656>
+,<0.136655,0.483977,0.0848519>
+,<0.0192349,0.499764,-0.0182399>
+,<0.0910203,0.462209,0.169785>
+,<0.0481025,0.49285,-0.105883>
+,<0.137486,0.484517,0.0263722>
+,<0.0714283,0.462708,0.175826>
+,<-0.0583912,0.465827,0.193346>
+,<0.0485735,0.462899,0.182676>
+,<0.0183121,0.462102,0.191168>
+,<0.0464416,0.46288,0.183282>
+,<-0.127067,0.496004,0.115985>
+,<0.0671545,0.494746,0.0345981>
+,<0.0442151,0.462852,0.183912>
+,<0.0100273,0.461788,0.19347>
+,<0.0527276,0.462919,0.18147>
+,<-0.0606226,0.466268,0.192463>
+,<0.0566727,0.45453,0.201473>
+,<0.330903,-0.258905,0.274011>
+,<0.341085,-0.251675,0.269063>
+,<0.321901,-0.265211,0.278307>
+,<0.326312,-0.262132,0.276212>
+,<0.252711,-0.324176,0.293329>
+,<0.313262,-0.271176,0.282355>
+,<0.306354,-0.275858,0.285563>
+,<0.308865,-0.27418,0.284386>
+,<0.299462,-0.280535,0.288669>
+,<0.294227,-0.284038,0.291022>
+,<0.281843,-0.292243,0.296518>
+,<0.264834,-0.303385,0.303952>
+,<0.253108,-0.311011,0.309028>
+,<0.255619,-0.355255,0.249936>
+,<0.276867,-0.363442,0.211077>
+,<0.284308,-0.366182,0.197114>
+,<0.423558,-0.220537,0.169043>
+,<0.424079,-0.213004,0.182917>
+,<0.389973,-0.245403,0.208303>
+,<0.368078,-0.321386,0.106804>
+,<0.340865,-0.351187,0.11137>
+,<0.37836,-0.30969,0.104972>
+,<0.390582,-0.295157,0.102656>
+,<0.417002,-0.204848,0.218027>
+,<0.375809,-0.267856,0.200267>
+,<0.353946,-0.301618,0.187802>
+,<0.337839,-0.325362,0.178641>
+,<0.258675,-0.356465,0.244434>
+,<0.254396,-0.342386,0.268255>
+,<0.253963,-0.337594,0.274922>
+,<0.25419,-0.339769,0.271874>
+,<0.255401,-0.353864,0.252057>
+,<0.258477,-0.356381,0.2448>
+,<0.262368,-0.357907,0.237757>
+,<0.266059,-0.359338,0.231035>
+,<0.269629,-0.360708,0.224489>
+,<0.273151,-0.362043,0.217991>
+,<0.276691,-0.363371,0.211414>
+,<0.28032,-0.364716,0.204629>
+,<0.284115,-0.366106,0.197488>
+,<0.288169,-0.367574,0.189813>
+,<0.292598,-0.36916,0.181377>
+,<0.297559,-0.370917,0.171874>
+,<0.303275,-0.37292,0.160866>
+,<0.35089,-0.306199,0.186063>
+,<0.360241,-0.292063,0.191388>
+,<0.371263,-0.274995,0.197672>
+,<0.387534,-0.249262,0.206961>
+,<0.357042,-0.296938,0.189565>
+,<0.400213,-0.283352,0.100746>
+,<0.43238,-0.235254,0.0910994>
+,<0.386014,-0.300664,0.103539>
+,<0.382069,-0.305351,0.104285>
+,<0.374585,-0.314036,0.105656>
+,<0.362407,-0.327684,0.107778>
+,<0.304015,-0.373184,0.159423>
+,<0.398813,-0.231251,0.213347>
+,<0.422686,-0.231882,0.148035>
+,<0.423101,-0.226684,0.157681>
+,<0.424703,-0.203359,0.200623>
+,<0.395636,-0.23631,0.211588>
+,<0.323052,-0.368631,0.118737>
+,<0.372578,-0.31632,0.106014>
+,<0.380204,-0.307541,0.104632>
+,<0.402774,-0.285474,0.0811339>
+,<0.407739,-0.209275,0.227905>
+,<0.319882,-0.304039,0.235874>
+,<-0.14206,0.481654,0.160911>
+,<-0.138381,0.480971,0.162338>
+,<0.0451587,0.471195,0.162285>
+,<-0.102926,0.474319,0.176099>
+,<-0.0988888,0.473544,0.177693>
+,<-0.0465209,0.463533,0.197894>
+,<-0.0786205,0.469716,0.185512>
+,<-0.0349751,0.461262,0.202324>
+,<-0.0167111,0.460736,0.200801>
+,<0.00103074,0.461458,0.195901>
+,<0.0121075,0.461892,0.192833>
+,<0.0198046,0.46218,0.190695>
+,<0.0255593,0.462384,0.18909>
+,<0.0301014,0.462535,0.187817>
+,<0.033842,0.462649,0.186762>
+,<0.0370316,0.462739,0.185857>
+,<0.0398331,0.462809,0.185056>
+,<0.0423579,0.462865,0.184328>
+,<0.0446869,0.462909,0.183651>
+,<0.0468818,0.462944,0.183008>
+,<0.0489937,0.462967,0.18239>
+,<0.0510678,0.462981,0.181785>
+,<0.0531466,0.462984,0.181182>
+,<0.0570177,0.462915,0.180189>
+,<0.0552714,0.462977,0.180567>
+,<0.0646022,0.462838,0.177897>
+,<0.0652449,0.462858,0.177625>
+,<0.0623989,0.462904,0.178474>
+,<0.0723249,0.462713,0.17549>
+,<0.0684961,0.462796,0.176648>
+,<0.0829646,0.46244,0.172251>
+,<0.0769996,0.462599,0.17407>
+,<0.116753,0.461381,0.161949>
+,<0.12202,0.461239,0.160255>
+,<0.102775,0.461852,0.166176>
+,<0.224888,0.43584,0.101556>
+,<0.266487,0.401988,0.131975>
+,<0.154645,0.451852,0.169735>
+,<0.219822,0.43843,0.102375>
+,<0.251834,0.42352,0.0859584>
+,<0.150558,0.460273,0.151541>
+,<0.124375,0.48367,-0.0912331>
+,<0.140036,0.481268,0.092026>
+,<0.135299,0.484786,0.00110436>
+,<0.119084,0.486521,0.0837848>
+,<0.140385,0.483794,0.061019>
+,<0.140337,0.483808,0.0604996>
+,<0.0320616,0.492733,0.0944856>
+,<-0.0626004,0.49528,0.107141>
+,<-0.00896365,0.500402,0.00136332>
+,<-0.06501,0.495321,0.107438>
+,<0.0345806,0.498827,-0.00140405>
+,<0.0380798,0.498551,0.00240221>
+,<0.0602246,0.495806,0.0270583>
+,<0.0461323,0.492035,0.0925409>
+,<0.0641021,0.495214,0.0313463>
+,<0.0411235,0.498277,0.00568709>
+,<0.0281502,0.497736,-0.0518325>
+,<0.0609436,0.491184,0.090471>
+,<-0.0445101,0.494972,0.104758>
+,<0.0357071,0.495962,-0.0724413>
+,<0.0562063,0.496405,0.0224748>
+,<0.0877571,0.489393,0.0866739>
+,<0.0439644,0.497989,0.00879046>
+,<-0.137369,0.491461,0.13128>
+,<-0.146219,0.487494,0.144459>
+,<-0.143305,0.48312,0.156812>
+,<-0.14674,0.48726,0.145226>
+,<0.146928,-0.353557,-0.339559>
+,<0.126968,-0.352068,-0.344145>
+,<0.221952,-0.285509,-0.376468>
+,<0.219395,-0.272287,-0.38648>
+,<0.230399,-0.329935,-0.342312>
+,<0.22962,-0.325671,-0.345608>
+,<0.227387,-0.31397,-0.35467>
+,<0.214691,-0.358462,-0.323826>
+,<0.233728,-0.347726,-0.328447>
+,<0.111468,-0.350884,-0.347677>
+,<0.0988651,-0.349898,-0.350523>
+,<0.0736677,-0.347856,-0.356086>
+,<0.0631018,-0.346911,-0.358396>
+,<0.0559906,-0.34627,-0.35991>
+,<0.0425506,-0.345003,-0.362714>
+,<0.035948,-0.344354,-0.364061>
+,<0.02233,-0.342959,-0.36678>
+,<-0.00152096,-0.340356,-0.37137>
+,<-0.022752,-0.337914,-0.375321>
+,<-0.0537001,-0.334231,-0.380946>
+,<-0.0364904,-0.336293,-0.377833>
+,<-0.0763816,-0.331477,-0.38501>
+,<-0.155084,-0.320969,-0.399512>
+,<-0.171498,-0.287206,-0.425281>
+,<-0.18779,-0.253367,-0.450713>
+,<-0.151883,-0.235074,-0.460487>
+,<-0.139448,-0.230788,-0.46238>
+,<-0.0266733,-0.191886,-0.478381>
+,<0.000372883,-0.18239,-0.481784>
+,<0.200519,-0.225357,-0.423095>
+,<0.211571,-0.232498,-0.416131>
+,<0.143714,-0.188572,-0.457971>
+,<0.121668,-0.174216,-0.47106>
+,<0.0972784,-0.158288,-0.485272>
+,<0.0708809,-0.157252,-0.489646>
+,<0.0407922,-0.168044,-0.48646>
+,<0.0136091,-0.177713,-0.483369>
+,<-0.171213,-0.241625,-0.457558>
+,<-0.190264,-0.24815,-0.454614>
+,<-0.187029,-0.247056,-0.455112>
+,<-0.100699,-0.217549,-0.46811>
+,<-0.0807978,-0.210699,-0.470979>
+,<-0.0632308,-0.20463,-0.473451>
+,<-0.0473256,-0.199113,-0.475632>
+,<-0.032591,-0.193981,-0.477597>
+,<-0.0186482,-0.189105,-0.479402>
+,<-0.00518759,-0.184377,-0.481092>
+,<0.00806148,-0.179704,-0.482701>
+,<0.0213529,-0.174995,-0.484262>
+,<0.0349441,-0.17016,-0.485803>
+,<0.0491158,-0.165096,-0.487354>
+,<0.0641975,-0.159686,-0.488947>
+,<0.0806,-0.153779,-0.490618>
+,<0.0957225,-0.157286,-0.486164>
+,<0.108472,-0.165618,-0.478776>
+,<0.12032,-0.173352,-0.471847>
+,<0.131564,-0.18068,-0.46521>
+,<0.142448,-0.187763,-0.458724>
+,<0.153189,-0.194741,-0.452263>
+,<0.16399,-0.201749,-0.445703>
+,<0.175064,-0.208922,-0.438915>
+,<0.186642,-0.216411,-0.431753>
+,<0.199001,-0.224393,-0.42404>
+,<0.211738,-0.233364,-0.415496>
+,<0.214336,-0.246462,-0.405807>
+,<0.216872,-0.259355,-0.396196>
+,<0.0542157,-0.290746,-0.403643>
+,<0.241485,0.174005,-0.407>
+,<0.246381,0.188419,-0.395954>
+,<0.270915,0.110859,-0.412971>
+,<0.205833,0.0667025,-0.451227>
+,<0.362558,0.0562811,-0.359087>
+,<0.348532,0.0358269,-0.380804>
+,<0.360168,0.187047,-0.297558>
+,<0.301629,0.284559,-0.296172>
+,<0.29047,0.30255,-0.295686>
+,<0.28552,0.310453,-0.295505>
+,<0.297839,0.290628,-0.296047>
+,<0.321281,0.252577,-0.29696>
+,<0.326746,0.243603,-0.297135>
+,<0.331583,0.23561,-0.297272>
+,<0.33597,0.228314,-0.297379>
+,<0.340039,0.2215,-0.297462>
+,<0.343893,0.215001,-0.297523>
+,<0.347615,0.208679,-0.297566>
+,<0.351281,0.202406,-0.297591>
+,<0.35496,0.196064,-0.2976>
+,<0.358726,0.189526,-0.297591>
+,<0.362659,0.182649,-0.297565>
+,<0.365147,0.17541,-0.299056>
+,<0.365537,0.168354,-0.302396>
+,<0.365897,0.16142,-0.305654>
+,<0.366236,0.154473,-0.308896>
+,<0.366559,0.147378,-0.312184>
+,<0.366872,0.139989,-0.315584>
+,<0.367181,0.132134,-0.319173>
+,<0.36749,0.123603,-0.323046>
+,<0.367808,0.114116,-0.327325>
+,<0.368142,0.103288,-0.332181>
+,<0.368503,0.0905538,-0.337858>
+,<0.368907,0.0750417,-0.344739>
+,<0.366185,0.0616545,-0.353384>
+,<0.359993,0.0525717,-0.363077>
+,<0.353099,0.0425131,-0.373765>
+,<0.345227,0.0310853,-0.385856>
+,<0.332167,0.0386002,-0.393813>
+,<0.319619,0.0511612,-0.398969>
+,<0.308795,0.0619605,-0.403365>
+,<0.299186,0.0715124,-0.407216>
+,<0.290439,0.0801752,-0.410676>
+,<0.255763,0.135384,-0.413998>
+,<0.0868955,0.20317,-0.464603>
+,<0.288348,0.0822208,-0.411498>
+,<0.0952704,0.201082,-0.462029>
+,<0.23166,0.165417,-0.417127>
+,<0.1698,0.182042,-0.438502>
+,<0.192543,0.176044,-0.430891>
+,<0.229818,0.165946,-0.417784>
+,<0.244557,0.153234,-0.414582>
+,<0.23907,0.166858,-0.412416>
+,<0.242053,0.175597,-0.405769>
+,<0.244593,0.183069,-0.400054>
+,<0.246818,0.189644,-0.394993>
+,<0.248817,0.195581,-0.390395>
+,<0.250655,0.201065,-0.386118>
+,<0.252379,0.206242,-0.382053>
+,<0.254031,0.211228,-0.378111>
+,<0.255644,0.216124,-0.374212>
+,<0.25725,0.221025,-0.370281>
+,<0.258879,0.226028,-0.36624>
+,<0.260565,0.231235,-0.362005>
+,<0.262346,0.236769,-0.357474>
+,<0.264271,0.24278,-0.352519>
+,<0.306299,0.180405,-0.352186>
+,<0.29962,0.400195,0.0477118>
+,<0.184429,0.456145,0.107955>
+,<0.235949,0.441465,0.010773>
+,<0.367201,0.372165,-0.0827889>
+,<0.248624,0.435099,0.00250053>
+,<0.214045,0.44136,0.103304>
+,<0.392243,0.320906,0.099105>
+,<0.264842,0.403586,0.130349>
+,<0.169552,0.428791,0.211358>
+,<0.164013,0.43435,0.204556>
+,<0.161768,0.436599,0.201773>
+,<0.165877,0.432505,0.206803>
+,<0.192311,0.415204,0.213652>
+,<0.201139,0.410348,0.213249>
+,<0.209075,0.40595,0.212872>
+,<0.216378,0.401871,0.212513>
+,<0.223244,0.398006,0.212161>
+,<0.229833,0.394265,0.21181>
+,<0.23628,0.390575,0.211454>
+,<0.242712,0.386863,0.211086>
+,<0.249253,0.383057,0.210698>
+,<0.256036,0.379077,0.210282>
+,<0.263215,0.374832,0.209828>
+,<0.270981,0.370206,0.209321>
+,<0.279582,0.365045,0.208745>
+,<0.289359,0.359138,0.208072>
+,<0.300812,0.352175,0.207265>
+,<0.314707,0.343679,0.206265>
+,<0.332305,0.332863,0.204975>
+,<0.400237,0.340927,-0.00280012>
+,<0.276149,0.41203,0.0666831>
+,<0.240399,0.428493,0.0947775>
+,<0.36757,0.365242,-0.00763697>
+,<0.314725,0.353588,0.179657>
+,<0.286252,0.382302,0.151541>
+,<0.415683,0.322212,0.0284814>
+,<0.268367,0.400149,0.133829>
+,<0.272517,0.396025,0.138015>
+,<0.268189,0.424998,-0.0103508>
+,<0.260352,0.429072,-0.00519446>
+,<0.272601,0.413777,0.0695309>
+,<0.229448,0.433489,0.100813>
+,<0.207261,0.444774,0.104388>
+,<0.148824,0.4803,0.066173>
+,<0.176627,0.46842,0.0486467>
+,<0.198206,0.459029,0.0349932>
+,<0.215321,0.45132,0.0240857>
+,<0.228922,0.4449,0.0153308>
+,<0.243955,0.437466,0.00555431>
+,<0.278305,0.419703,-0.0170173>
+,<0.378546,0.363384,-0.0520927>
+,<0.447651,0.196235,-0.106864>
+,<0.258969,0.409025,0.12504>
+,<0.199012,0.448898,0.1057>
+,<0.14928,0.473692,0.11179>
+,<0.145334,0.48178,0.0684178>
+,<0.147381,0.47525,0.10779>
+,<0.188545,0.454096,0.107356>
+,<0.255357,0.412375,0.121414>
+,<0.233365,0.431455,0.100163>
+,<0.322378,0.345909,0.187055>
+,<0.259544,0.408677,0.124986>
+,<0.243574,0.427133,0.0923486>
+,<0.246673,0.425795,0.0899477>
+,<0.150174,0.469944,0.122863>
+,<0.150334,0.466378,0.133548>
+,<0.245333,0.413089,0.139891>
+,<-0.0095162,-0.0365393,0.499256>
+,<-0.00718515,-0.048015,0.498714>
+,<-0.0972683,0.289184,0.411234>
+,<-0.0604929,0.292606,0.423848>
+,<-0.184229,0.280204,0.380077>
+,<-0.165417,0.282297,0.387043>
+,<-0.226074,0.275229,0.364104>
+,<-0.313651,0.160105,0.376891>
+,<-0.38431,-0.225096,0.239564>
+,<-0.34632,-0.293116,0.232299>
+,<-0.300021,0.199101,0.365869>
+,<-0.29136,0.223326,0.3588>
+,<-0.282237,0.248394,0.351301>
+,<-0.27459,0.269051,0.345004>
+,<-0.271009,0.269531,0.346418>
+,<0.137027,0.258639,0.405819>
+,<0.125293,0.25296,0.413005>
+,<-0.0369368,0.204398,0.47301>
+,<-0.0564285,-0.131139,0.487363>
+,<-0.125098,-0.0901339,0.48223>
+,<-0.0755318,-0.119813,0.486177>
+,<-0.0435224,0.138644,0.498775>
+,<-0.037159,0.152668,0.495238>
+,<-0.0371077,0.167787,0.488831>
+,<-0.037055,0.182058,0.482717>
+,<-0.0368791,0.222804,0.464876>
+,<-0.0368759,0.21787,0.46707>
+,<-0.0369417,0.209298,0.470855>
+,<0.131292,0.255899,0.409344>
+,<-0.0368109,0.236579,0.458711>
+,<0.144154,0.26205,0.401356>
+,<0.106098,0.243482,0.424285>
+,<-0.0806156,0.29075,0.41697>
+,<-0.0871339,0.290111,0.414751>
+,<-0.0684572,0.291844,0.421154>
+,<-0.124084,0.286583,0.401879>
+,<-0.111523,0.287815,0.406282>
+,<-0.116354,0.287319,0.404612>
+,<-0.155855,0.283325,0.390529>
+,<-0.159436,0.28292,0.389245>
+,<-0.149674,0.283954,0.392782>
+,<-0.178299,0.280851,0.382305>
+,<-0.168915,0.281892,0.385775>
+,<-0.197504,0.278647,0.375094>
+,<-0.187766,0.279777,0.378768>
+,<-0.218674,0.276113,0.366989>
+,<-0.207723,0.277437,0.371201>
+,<-0.253666,0.271762,0.353291>
+,<-0.230677,0.274633,0.362332>
+,<-0.244163,0.272942,0.357055>
+,<-0.275592,0.266342,0.345844>
+,<-0.280695,0.252534,0.350062>
+,<-0.285446,0.239572,0.353977>
+,<-0.289959,0.227152,0.357684>
+,<-0.29433,0.215013,0.361262>
+,<-0.298646,0.20292,0.364782>
+,<-0.302989,0.190642,0.368312>
+,<-0.307444,0.177932,0.371919>
+,<-0.312108,0.164512,0.375682>
+,<-0.317093,0.15004,0.379691>
+,<-0.453498,0.0734066,0.239828>
+,<-0.487456,-0.00889462,0.203806>
+,<-0.431297,0.0854121,0.26456>
+,<-0.290679,0.10829,0.40976>
+,<-0.281054,0.101256,0.41708>
+,<-0.271849,0.0945399,0.424016>
+,<-0.178942,0.188749,0.427498>
+,<-0.41947,0.0920593,0.277337>
+,<-0.395744,0.105258,0.302532>
+,<-0.350702,-0.0576197,0.354271>
+,<-0.353942,-0.0683107,0.350441>
+,<-0.348197,-0.049403,0.357198>
+,<-0.346165,-0.0427767,0.359543>
+,<-0.341913,-0.0291946,0.364318>
+,<-0.341612,-0.0281363,0.364654>
+,<-0.342954,-0.0324153,0.363173>
+,<-0.338353,-0.0180011,0.368135>
+,<-0.338099,-0.0171186,0.368402>
+,<-0.339216,-0.0205898,0.367233>
+,<-0.335909,-0.0103987,0.370634>
+,<-0.337004,-0.0137439,0.369528>
+,<-0.332695,-0.000837047,0.373765>
+,<-0.332401,0.000127245,0.374044>
+,<-0.333632,-0.00353486,0.372869>
+,<-0.328343,0.0119323,0.377794>
+,<-0.327925,0.0132417,0.378173>
+,<-0.329596,0.00837827,0.376655>
+,<-0.32363,0.0256149,0.381986>
+,<-0.325976,0.0188745,0.379916>
+,<-0.31684,0.0449658,0.387865>
+,<-0.320695,0.034003,0.384544>
+,<-0.293593,0.110393,0.407537>
+,<-0.295499,0.113136,0.405509>
+,<-0.303174,0.0835903,0.399469>
+,<-0.309345,0.133319,0.390532>
+,<-0.302299,0.123031,0.398194>
+,<-0.328368,0.141252,0.370789>
+,<-0.316795,0.144234,0.382347>
+,<-0.348994,0.130432,0.350334>
+,<-0.339311,0.135527,0.359973>
+,<-0.368106,0.120291,0.331066>
+,<-0.357774,0.125782,0.341529>
+,<-0.365915,0.121441,0.3333>
+,<-0.373622,0.117303,0.325447>
+,<-0.438746,0.0811577,0.256472>
+,<-0.450419,0.0744977,0.243708>
+,<-0.476118,0.0188911,0.216303>
+,<-0.491,-0.0177164,0.199869>
+,<-0.407456,0.288069,0.132197>
+,<-0.398293,-0.198929,0.24203>
+,<-0.483139,0.00170441,0.208602>
+,<-0.476209,0.189984,-0.0244143>
+,<-0.364974,-0.298674,0.176897>
+,<-0.432962,-0.107156,0.263674>
+,<-0.408461,-0.107233,0.290536>
+,<-0.389477,-0.107252,0.311078>
+,<-0.373205,-0.107232,0.328432>
+,<-0.370673,-0.249979,0.237045>
+,<-0.372284,-0.300725,0.154369>
+,<-0.466542,-0.244709,-0.0319038>
+,<-0.367599,-0.299422,0.168886>
+,<-0.443049,-0.112049,0.249358>
+,<-0.388812,-0.216743,0.240371>
+,<-0.504108,-0.0459336,0.179748>
+,<-0.432303,-0.107152,0.264402>
+,<-0.419206,-0.107199,0.278798>
+,<-0.407978,-0.107228,0.291064>
+,<-0.398065,-0.107243,0.301823>
+,<-0.389081,-0.107247,0.311505>
+,<-0.380748,-0.107241,0.320421>
+,<-0.372849,-0.107226,0.32881>
+,<-0.365147,-0.105557,0.337004>
+,<-0.35841,-0.0831263,0.345109>
+,<-0.361072,0.00364482,0.34643>
+,<0.232303,0.432016,0.100307>
+,<0.23378,0.431101,0.100567>
+,<0.25776,0.410141,0.123877>
+,<0.24751,0.419354,0.113715>
+,<0.249465,0.417648,0.115603>
+,<0.245195,0.421358,0.11149>
+,<0.174527,0.461021,0.109566>
+,<0.154328,0.470952,0.112737>
+,<0.150013,0.473075,0.11338>
+,<0.168773,0.463868,0.110412>
+,<0.204745,0.446045,0.104745>
+,<0.211949,0.442427,0.103598>
+,<0.218017,0.439358,0.102626>
+,<0.22329,0.436669,0.101775>
+,<0.227998,0.434249,0.101011>
+,<0.262905,0.405375,0.128678>
+,<0.254071,0.413551,0.120114>
+,<0.236604,0.430098,0.0976851>
+,<0.254379,0.422382,0.0839629>
+,<0.269345,0.415362,0.0721472>
+,<0.393111,0.349371,-0.0170405>
+,<0.35935,0.317841,0.192868>
+,<0.386282,0.356597,-0.03227>
+,<0.232359,0.44323,0.0131044>
+,<0.225566,0.446512,0.0174995>
+,<0.211613,0.45302,0.0264576>
+,<0.2032,0.456812,0.0318201>
+,<0.185393,0.464633,0.0431088>
+,<0.292184,0.412397,-0.026176>
+,<0.348113,0.382734,-0.06315>
+,<0.455842,0.178821,-0.101157>
+,<0.408829,0.32189,0.0493903>
+,<0.364568,0.318427,0.178412>
+,<0.280073,0.388498,0.14545>
+,<0.270583,0.39797,0.13601>
+,<0.447137,0.19877,-0.104378>
+,<0.447115,0.198735,-0.104554>
+,<0.38491,0.357814,-0.0357701>
+,<0.373411,0.367803,-0.0651953>
+,<0.447085,0.198649,-0.104869>
+,<0.451902,0.187088,-0.104224>
+,<0.340413,0.386827,-0.0579911>
+,<0.308654,0.403685,-0.0370053>
+,<0.289451,0.413837,-0.0243283>
+,<0.276371,0.420717,-0.0157036>
+,<0.266724,0.425761,-0.00935124>
+,<0.259184,0.429676,-0.00439413>
+,<0.25302,0.432852,-0.000348473>
+,<0.247792,0.435522,0.00307579>
+,<0.24322,0.437836,0.00606457>
+,<0.239112,0.439895,0.00874405>
+,<0.23533,0.44177,0.0112045>
+,<0.231772,0.443515,0.0135141>
+,<0.228354,0.445173,0.0157273>
+,<0.225005,0.446779,0.0178905>
+,<0.221659,0.448364,0.0200461>
+,<0.218251,0.44996,0.0222358>
+,<0.214713,0.451598,0.0245044>
+,<0.210962,0.453315,0.0269027>
+,<0.206901,0.455152,0.0294935>
+,<0.202402,0.457166,0.0323579>
+,<0.197287,0.459433,0.0356074>
+,<0.1913,0.46206,0.0394034>
+,<0.184049,0.465214,0.0439925>
+,<0.174896,0.469162,0.0497762>
+,<0.162719,0.474379,0.0574603>
+,<0.242498,0.434148,0.0557766>
+,<-0.00763206,0.494152,0.0998619>
+,<0.0390756,0.492399,0.0935189>
+,<0.0453741,0.497833,0.0103675>
+,<0.0735615,0.493735,0.0416871>
+,<0.0207075,0.49924,-0.0316788>
+,<-0.0160939,0.500355,0.00755006>
+,<0.110923,0.487666,0.0833396>
+,<0.0625558,0.495457,0.0295085>
+,<0.0767141,0.493227,0.0453107>
+,<0.0991283,0.48856,0.0850491>
+,<0.112364,0.487468,0.0834161>
+,<0.137976,0.483851,0.0808911>
+,<0.139283,0.484108,0.0477301>
+,<0.13599,0.484732,0.00899121>
+,<0.134625,0.484809,-0.00649803>
+,<0.107646,0.485393,-0.104588>
+,<0.0238117,0.499513,-0.0132116>
+,<-0.0823001,0.489146,-0.0827462>
+,<-0.128177,0.491505,-0.00187677>
+,<0.0176093,0.499762,-0.0232933>
+,<-0.111614,0.488583,-0.0617549>
+,<0.0792651,0.487966,-0.127111>
+,<0.131037,0.484477,-0.0455483>
+,<0.132572,0.484706,-0.0291072>
+,<0.139951,0.483665,0.0747679>
+,<0.133505,0.484441,0.0846479>
+,<0.138332,0.484343,0.036371>
+,<0.138295,0.484351,0.0359912>
+,<0.139242,0.484119,0.0472929>
+,<0.136681,0.484649,0.0170307>
+,<0.137452,0.484524,0.0260332>
+,<0.13527,0.484789,0.000827527>
+,<0.13596,0.484736,0.00870126>
+,<0.133275,0.48477,-0.0214586>
+,<0.134596,0.484811,-0.00676761>
+,<0.133926,0.484805,-0.0142384>
+,<0.1318,0.484607,-0.0373696>
+,<0.132542,0.484705,-0.0293867>
+,<0.129182,0.484068,-0.0650056>
+,<0.129139,0.484059,-0.0653978>
+,<0.130125,0.484293,-0.0551048>
+,<0.125833,0.483516,-0.0900448>
+,<0.128,0.483755,-0.0771729>
+,<0.109164,0.485247,-0.103357>
+,<0.117576,0.484395,-0.0966473>
+,<0.0894566,0.487087,-0.11904>
+,<0.0811441,0.487812,-0.125601>
+,<0.0911689,0.486939,-0.11766>
+,<-0.0533848,0.489101,-0.103281>
+,<0.0700361,0.48873,-0.134381>
+,<0.0335268,0.496497,-0.0663958>
+,<0.0493562,0.487211,-0.158982>
+,<-0.127288,0.492992,0.0221973>
+,<0.0160244,0.499925,-0.0203082>
+,<-0.0248719,0.498374,-0.0374832>
+,<-0.128925,0.490026,-0.0232509>
+,<-0.0898464,0.489055,-0.0773306>
+,<-0.113353,0.488542,-0.0604767>
+,<-0.00272932,0.500382,-0.00404494>
+,<-0.0705567,0.48921,-0.0911094>
+,<0.00926591,0.500155,-0.0144482>
+,<-0.128549,0.490795,-0.0124516>
+,<-0.125369,0.495589,0.0710514>
+,<-0.0863835,0.49563,0.110263>
+,<-0.046855,0.49966,0.0342535>
+,<-0.126756,0.493779,0.0360868>
+,<0.0217191,0.499049,-0.0345333>
+,<0.118752,0.220047,0.433079>
+,<0.126391,0.212181,0.434785>
+,<0.100105,0.238883,0.428587>
+,<0.0949922,0.240172,0.429183>
+,<0.112775,0.226056,0.431707>
+,<0.106796,0.232203,0.430207>
+,<0.113742,0.225157,0.431897>
+,<0.110607,0.228341,0.43114>
+,<0.120168,0.218497,0.433455>
+,<0.120861,0.217887,0.433563>
+,<0.122803,0.21589,0.434>
+,<0.129231,0.2091,0.435441>
+,<0.130972,0.207277,0.435797>
+,<0.131587,0.206747,0.435865>
+,<0.13341,0.204825,0.436228>
+,<0.137443,0.200549,0.437004>
+,<0.139774,0.198066,0.437438>
+,<0.160776,0.17551,0.441076>
+,<0.166823,0.168889,0.442126>
+,<0.23302,0.18823,0.407516>
+,<0.242786,0.267973,0.360496>
+,<0.105798,0.321821,0.369162>
+,<-0.0547577,0.293114,0.425806>
+,<0.119611,0.250177,0.416401>
+,<0.21105,0.287431,0.361733>
+,<0.211403,0.287219,0.361719>
+,<0.255469,0.260111,0.359926>
+,<0.177333,0.096195,0.468755>
+,<0.229218,0.176535,0.414993>
+,<0.266624,0.142433,0.399373>
+,<0.238301,0.168288,0.411224>
+,<0.191166,0.126369,0.45279>
+,<0.171567,0.0836758,0.475274>
+,<0.179267,0.0110017,0.485837>
+,<0.230162,0.179451,0.413144>
+,<0.232652,0.187137,0.408227>
+,<0.235126,0.194809,0.403278>
+,<0.23763,0.202617,0.398202>
+,<0.240216,0.21072,0.392893>
+,<0.242941,0.219303,0.387227>
+,<0.245876,0.228594,0.38105>
+,<0.249113,0.238888,0.374158>
+,<0.252778,0.250599,0.366267>
+,<0.251706,0.262424,0.360118>
+,<0.239457,0.270008,0.360658>
+,<0.228439,0.276791,0.36111>
+,<0.218292,0.283002,0.361494>
+,<0.207666,0.287728,0.362859>
+,<0.135134,0.311823,0.368361>
+,<0.100668,0.323517,0.369247>
+,<-0.0117812,0.339563,0.383578>
+,<0.110694,0.320189,0.369067>
+,<0.122821,0.251776,0.414474>
+,<0.116615,0.248701,0.41817>
+,<0.0990455,0.239972,0.428311>
+,<-0.0497107,0.302206,0.418381>
+,<-0.0334986,0.331177,0.394349>
+,<0.000577519,0.344288,0.377407>
+,<0.0541712,0.338421,0.36953>
+,<0.0163559,0.350256,0.369472>
+,<0.0951816,0.325315,0.369322>
+,<0.112128,0.319682,0.369058>
+,<0.129929,0.313634,0.368543>
+,<0.164635,0.301305,0.367129>
+,<-0.0432691,0.313754,0.408872>
+,<0.0470382,0.242372,0.438771>
+,<0.145377,0.224646,0.422847>
+,<0.358805,-0.331649,0.108388>
+,<0.365442,-0.324324,0.10726>
+,<0.329845,-0.363103,0.113188>
+,<0.34866,-0.342728,0.110082>
+,<0.303367,-0.377677,0.150782>
+,<0.314063,-0.375899,0.126057>
+,<0.31188,-0.362187,0.163904>
+,<0.341361,-0.320249,0.180643>
+,<0.36725,-0.281253,0.195384>
+,<0.406437,-0.21896,0.217759>
+,<0.4131,-0.208255,0.221516>
+,<0.410854,-0.211888,0.220219>
+,<0.383083,-0.256377,0.204372>
+,<0.377459,-0.265282,0.201165>
+,<0.372694,-0.272781,0.198447>
+,<0.368526,-0.279293,0.196072>
+,<0.364781,-0.285104,0.193937>
+,<0.361333,-0.290414,0.191972>
+,<0.358085,-0.295376,0.190122>
+,<0.354963,-0.300108,0.188344>
+,<0.3519,-0.304711,0.186601>
+,<0.348838,-0.309277,0.184858>
+,<0.345716,-0.313892,0.183082>
+,<0.342472,-0.318651,0.181237>
+,<0.339033,-0.323657,0.179281>
+,<0.335308,-0.329037,0.177163>
+,<0.331181,-0.334954,0.174818>
+,<0.326492,-0.34163,0.172154>
+,<0.321012,-0.349383,0.169041>
+,<0.31439,-0.358697,0.16528>
+,<0.30606,-0.370351,0.16055>
+,<0.303477,-0.376999,0.152071>
+,<0.302734,-0.381977,0.142433>
+,<0.306544,-0.381936,0.132211>
+,<0.31718,-0.373372,0.123565>
+,<0.325546,-0.366595,0.116741>
+,<0.334984,-0.357527,0.112415>
+,<0.344591,-0.347125,0.110825>
+,<0.351341,-0.339788,0.109702>
+,<0.356424,-0.334239,0.108851>
+,<0.360454,-0.329816,0.108172>
+,<0.363783,-0.326142,0.107606>
+,<0.366627,-0.322984,0.107119>
+,<0.369127,-0.32019,0.106687>
+,<0.371381,-0.317652,0.106294>
+,<0.373462,-0.315294,0.105927>
+,<0.375422,-0.313054,0.105577>
+,<0.377308,-0.310883,0.105236>
+,<0.379157,-0.308738,0.104897>
+,<0.381006,-0.306577,0.104555>
+,<0.382892,-0.304356,0.104201>
+,<0.384852,-0.302028,0.103829>
+,<0.386934,-0.299538,0.103429>
+,<0.389195,-0.296815,0.102991>
+,<0.39171,-0.293764,0.102498>
+,<0.394586,-0.290253,0.101931>
+,<0.397979,-0.286086,0.101256>
+,<0.402133,-0.280955,0.100423>
+,<0.40426,-0.283969,0.0783185>
+,<0.415328,-0.254725,0.120332>
+,<0.423901,-0.256742,0.066882>
+,<0.424862,-0.255539,0.0653927>
+,<0.435588,-0.233463,0.0780336>
+,<0.43121,-0.235861,0.0958009>
+,<0.422371,-0.258777,0.0686395>
+,<0.421922,-0.240466,0.132004>
+,<0.375883,-0.302347,0.133038>
+,<0.425467,0.3015,0.0284505>
+,<0.291629,0.404262,0.0541805>
+,<0.453355,0.195342,-0.0796693>
+,<0.452297,0.200771,-0.0726867>
+,<0.454067,0.191594,-0.0843835>
+,<0.449877,0.19598,-0.0965793>
+,<0.45829,0.181835,-0.0835464>
+,<0.452696,0.191657,-0.0913983>
+,<0.453736,0.193338,-0.082215>
+,<0.454392,0.189968,-0.0862649>
+,<0.448488,0.219526,-0.0483466>
+,<0.451497,0.20478,-0.0674995>
+,<0.436232,0.278481,0.028403>
+,<0.447631,0.198647,-0.102236>
+,<0.393509,0.348903,-0.0162389>
+,<0.433822,0.283665,0.0284206>
+,<0.382782,0.32018,0.126763>
+,<0.415687,0.322204,0.0284814>
+,<0.447364,0.19881,-0.103202>
+,<0.423737,0.305177,0.0284343>
+,<0.447446,0.198773,-0.102882>
+,<0.432326,0.286873,0.0284056>
+,<0.447545,0.198712,-0.102521>
+,<0.441978,0.250713,-0.00800523>
+,<0.447669,0.198623,-0.102097>
+,<0.447146,0.225874,-0.0402763>
+,<0.447825,0.198503,-0.101574>
+,<0.449567,0.21414,-0.0555116>
+,<0.448025,0.198321,-0.100955>
+,<0.450983,0.207195,-0.0645204>
+,<0.448284,0.198054,-0.100219>
+,<0.45192,0.202529,-0.070569>
+,<0.448623,0.197667,-0.0993371>
+,<0.452592,0.19912,-0.0749847>
+,<0.449066,0.197112,-0.0982814>
+,<0.453102,0.196477,-0.0784101>
+,<0.449646,0.196321,-0.0970268>
+,<0.453504,0.194331,-0.0811973>
+,<0.450495,0.195135,-0.0952278>
+,<0.453828,0.192528,-0.0835602>
+,<0.451663,0.193384,-0.0930015>
+,<0.454086,0.190976,-0.0856536>
+,<0.453429,0.190625,-0.0898395>
+,<0.454229,0.18969,-0.0877211>
+,<0.455059,0.187607,-0.0879049>
+,<0.455239,0.187368,-0.0874846>
+,<0.456727,0.184815,-0.0852636>
+,<0.454798,0.186621,-0.0912849>
+,<0.461158,0.176013,-0.0810693>
+,<0.461503,0.175257,-0.0808779>
+,<0.461783,0.174622,-0.0807628>
+,<0.462013,0.174085,-0.0807017>
+,<0.462203,0.173627,-0.0806788>
+,<0.462361,0.173235,-0.0806834>
+,<0.462494,0.172895,-0.0807078>
+,<0.462606,0.172598,-0.0807467>
+,<0.462701,0.172338,-0.0807961>
+,<0.462783,0.172107,-0.0808535>
+,<0.462853,0.171902,-0.0809167>
+,<0.462914,0.171718,-0.0809845>
+,<0.462967,0.171552,-0.0810559>
+,<0.463013,0.171402,-0.0811302>
+,<0.455173,0.184253,-0.0941828>
+,<0.462886,0.169853,-0.0847906>
+,<0.462785,0.169902,-0.0851817>
+,<0.462657,0.169986,-0.0856352>
+,<0.462494,0.170116,-0.0861657>
+,<0.462286,0.17031,-0.086791>
+,<0.462019,0.170592,-0.0875331>
+,<0.461672,0.170999,-0.0884176>
+,<0.461221,0.171578,-0.0894716>
+,<0.455454,0.181971,-0.0972075>
+,<0.456647,0.178401,-0.0982369>
+,<0.455399,0.181004,-0.0992488>
+,<0.458544,0.175454,-0.0948467>
+,<0.459708,0.173663,-0.0927109>
+,<0.460608,0.172409,-0.0908173>
+,<0.455328,0.18311,-0.0956524>
+,<0.462968,0.169812,-0.0844696>
+,<0.463035,0.169791,-0.0841838>
+,<0.46309,0.169786,-0.0839271>
+,<0.463134,0.169793,-0.083695>
+,<0.463171,0.169811,-0.083484>
+,<0.4632,0.169837,-0.0832909>
+,<0.463223,0.169869,-0.0831133>
+,<0.463241,0.169908,-0.0829492>
+,<0.463255,0.169952,-0.0827967>
+,<0.463264,0.170001,-0.0826544>
+,<0.46327,0.170054,-0.082521>
+,<0.463273,0.170111,-0.0823954>
+,<0.463273,0.170171,-0.0822769>
+,<0.46327,0.170236,-0.0821645>
+,<0.463264,0.170305,-0.0820576>
+,<0.463256,0.170377,-0.0819556>
+,<0.463245,0.170454,-0.0818581>
+,<0.463232,0.170535,-0.0817646>
+,<0.463216,0.17062,-0.0816749>
+,<0.463197,0.170711,-0.0815886>
+,<0.463175,0.170808,-0.0815055>
+,<0.46315,0.170911,-0.0814255>
+,<0.463122,0.171021,-0.0813485>
+,<0.46309,0.171138,-0.0812746>
+,<0.463053,0.171265,-0.0812038>
+,<0.454999,0.185411,-0.0927372>
+,<0.46069,0.177027,-0.0813436>
+,<0.460072,0.178329,-0.0817812>
+,<0.45928,0.179931,-0.0824786>
+,<0.454932,0.186797,-0.0902463>
+,<0.458064,0.182241,-0.0838469>
+,<0.455078,0.185671,-0.0918264>
+,<0.461047,0.176248,-0.0811475>
+,<0.455241,0.184533,-0.0933043>
+,<0.463039,0.171311,-0.0811809>
+,<0.455409,0.183377,-0.0947503>
+,<0.462889,0.169852,-0.0847775>
+,<0.455589,0.18217,-0.0961973>
+,<0.460803,0.172162,-0.0903606>
+,<0.455824,0.180804,-0.0976498>
+,<0.457964,0.176454,-0.0957052>
+,<0.454919,0.181629,-0.100324>
+,<0.456101,0.179025,-0.0996162>
+,<0.452233,0.186416,-0.103928>
+,<0.456086,0.177156,-0.102986>
+,<0.451157,0.188496,-0.105059>
+,<0.456298,0.175389,-0.105092>
+,<0.450359,0.190091,-0.105797>
+,<0.45652,0.173363,-0.107553>
+,<0.449732,0.1914,-0.106268>
+,<0.456771,0.170934,-0.110519>
+,<0.449244,0.192461,-0.106558>
+,<0.45707,0.167892,-0.114239>
+,<0.457449,0.163876,-0.119149>
+,<0.448969,0.19308,-0.10668>
+,<0.457966,0.158197,-0.126088>
+,<0.44887,0.193295,-0.106738>
+,<0.45875,0.149337,-0.136904>
+,<0.448585,0.193932,-0.106863>
+,<0.460151,0.13316,-0.156641>
+,<0.448352,0.194471,-0.106933>
+,<0.45769,0.131635,-0.168376>
+,<0.448159,0.194932,-0.106963>
+,<0.453535,0.140137,-0.170938>
+,<0.447998,0.195328,-0.106964>
+,<0.449693,0.147931,-0.173279>
+,<0.447863,0.195671,-0.106945>
+,<0.446059,0.155237,-0.175464>
+,<0.447749,0.195971,-0.10691>
+,<0.447568,0.196469,-0.106809>
+,<0.44255,0.162225,-0.177547>
+,<0.447496,0.196678,-0.106748>
+,<0.439094,0.169043,-0.179571>
+,<0.447434,0.196865,-0.106682>
+,<0.435624,0.175825,-0.181576>
+,<0.44738,0.197034,-0.106612>
+,<0.432073,0.1827,-0.183601>
+,<0.447334,0.197187,-0.106539>
+,<0.429468,0.190237,-0.181097>
+,<0.447293,0.197327,-0.106463>
+,<0.427085,0.19731,-0.178406>
+,<0.447258,0.197455,-0.106385>
+,<0.424794,0.204028,-0.175836>
+,<0.447227,0.197573,-0.106305>
+,<0.422546,0.210537,-0.173331>
+,<0.4472,0.197681,-0.106223>
+,<0.420298,0.216966,-0.170842>
+,<0.418005,0.22344,-0.168322>
+,<0.447196,0.197701,-0.106207>
+,<0.415623,0.230086,-0.165719>
+,<0.447175,0.197784,-0.106143>
+,<0.413097,0.237046,-0.162978>
+,<0.447152,0.197881,-0.106062>
+,<0.410366,0.244489,-0.16003>
+,<0.447132,0.197972,-0.105977>
+,<0.407345,0.252631,-0.156789>
+,<0.447115,0.198058,-0.105889>
+,<0.403923,0.261758,-0.153137>
+,<0.447101,0.198139,-0.105797>
+,<0.39994,0.272279,-0.148907>
+,<0.44709,0.198217,-0.105701>
+,<0.395157,0.284803,-0.143851>
+,<0.44708,0.19829,-0.1056>
+,<0.389194,0.300294,-0.137571>
+,<0.447074,0.198359,-0.105495>
+,<0.3814,0.320396,-0.129395>
+,<0.44707,0.198425,-0.105384>
+,<0.370568,0.348164,-0.118066>
+,<0.447069,0.198486,-0.105266>
+,<0.447076,0.198599,-0.10501>
+,<0.447071,0.198545,-0.105142>
+,<0.260226,0.407872,0.126193>
+,<0.373575,0.319347,0.153137>
+,<0.24586,0.420814,0.112018>
+,<0.243166,0.423131,0.109443>
+,<0.248081,0.418893,0.114138>
+,<0.249978,0.417242,0.115945>
+,<0.253157,0.41445,0.118948>
+,<0.254557,0.413213,0.120246>
+,<0.256574,0.411247,0.122667>
+,<0.257152,0.410902,0.122613>
+,<0.255884,0.412037,0.121455>
+,<0.261533,0.406663,0.127393>
+,<0.258363,0.409791,0.123778>
+,<0.260748,0.407526,0.126233>
+,<0.263366,0.405012,0.128882>
+,<0.262013,0.406314,0.127523>
+,<0.264375,0.403976,0.13008>
+,<0.299575,0.368925,0.164571>
+,<0.389029,0.354146,-0.025131>
+,<0.256759,0.4213,0.0821003>
+,<0.269472,0.415303,0.0720343>
+,<0.285305,0.407457,0.0592997>
+,<0.331284,0.383955,0.021937>
+,<0.368842,0.318871,0.166487>
+,<0.358629,0.317745,0.194879>
+,<0.354724,0.317291,0.205572>
+,<0.350095,0.320694,0.205221>
+,<0.33988,0.328183,0.204417>
+,<0.351119,0.319947,0.205292>
+,<0.369478,0.318948,0.164678>
+,<0.374189,0.319418,0.151368>
+,<0.378797,0.319846,0.138217>
+,<0.383391,0.320242,0.124974>
+,<0.388059,0.320612,0.11138>
+,<0.392895,0.320963,0.0971501>
+,<0.398013,0.321298,0.0819452>
+,<0.403548,0.321624,0.0653387>
+,<0.409683,0.321946,0.0467619>
+,<0.414722,0.323398,0.026516>
+,<0.407652,0.332015,0.0121515>
+,<0.400626,0.340463,-0.00201021>
+,<0.312106,0.393811,0.0375494>
+,<0.36528,0.366419,-0.00574485>
+,<0.311463,0.394138,0.038088>
+,<0.330196,0.384513,0.0228427>
+,<0.291316,0.404418,0.0544468>
+,<0.280293,0.40997,0.0633465>
+,<0.280097,0.410065,0.0635159>
+,<0.285063,0.407576,0.0595072>
+,<0.272459,0.413845,0.0696565>
+,<0.275984,0.412109,0.0668267>
+,<0.264015,0.41792,0.0763777>
+,<0.263907,0.41797,0.0764755>
+,<0.266524,0.416722,0.0743964>
+,<0.259026,0.420255,0.0803312>
+,<0.261426,0.419138,0.0784389>
+,<0.25194,0.423476,0.0858642>
+,<0.256658,0.421344,0.082191>
+,<0.254277,0.422425,0.0840546>
+,<0.243709,0.427077,0.0922337>
+,<0.249279,0.424652,0.0879424>
+,<0.246551,0.425845,0.090053>
+,<0.240246,0.428555,0.094906>
+,<0.236426,0.430171,0.0978329>
+,<0.235207,0.429917,0.101835>
+,<0.239757,0.426046,0.106184>
+,<0.270737,0.406813,0.107727>
+,<0.0538422,0.496743,0.0198507>
+,<0.0499929,0.497266,0.0155619>
+,<0.0778691,0.490085,0.0880805>
+,<0.0767983,0.490161,0.0882176>
+,<0.0533705,0.491633,0.0915322>
+,<0.0690334,0.490674,0.0893314>
+,<-0.0300411,0.494688,0.102845>
+,<-0.119804,0.496056,0.114638>
+,<-0.12675,0.496142,0.115519>
+,<-0.124605,0.496118,0.115238>
+,<-0.0463903,0.495009,0.104988>
+,<-0.031575,0.494723,0.103031>
+,<-0.0192942,0.494451,0.101402>
+,<-0.00876413,0.494185,0.0999982>
+,<0.000529808,0.49392,0.0987532>
+,<0.00894442,0.493651,0.0976201>
+,<0.0167405,0.493372,0.0965646>
+,<0.0241193,0.493081,0.0955599>
+,<0.0312454,0.492773,0.0945841>
+,<0.0382631,0.492441,0.0936176>
+,<0.0453079,0.492081,0.0926418>
+,<0.0525177,0.491684,0.0916375>
+,<0.0600434,0.491241,0.0905834>
+,<0.0680628,0.490739,0.0894541>
+,<0.0977172,0.488668,0.0852347>
+,<0.0865454,0.489482,0.0868311>
+,<0.0590356,0.495989,0.0256106>
+,<0.0833381,0.492169,0.0525028>
+,<0.10054,0.489378,0.0715313>
+,<0.111022,0.487658,0.0833264>
+,<0.0885944,0.491312,0.0584737>
+,<0.0692789,0.494407,0.0370762>
+,<0.0571584,0.496261,0.0236715>
+,<0.0546278,0.496627,0.0208811>
+,<0.0524644,0.496929,0.0185013>
+,<0.0505584,0.497185,0.0164118>
+,<0.0483494,0.497476,0.0137194>
+,<0.0472372,0.497606,0.0127969>
+,<0.0488341,0.497408,0.0145301>
+,<0.0442772,0.497946,0.00959718>
+,<0.0457279,0.497784,0.011166>
+,<0.0414571,0.498239,0.00648931>
+,<0.0428623,0.498097,0.00805067>
+,<0.0400274,0.498376,0.004883>
+,<0.0385351,0.49851,0.00320438>
+,<0.0369415,0.498643,0.00141956>
+,<0.0352024,0.49878,-0.000517745>
+,<0.0332605,0.498922,-0.00267112>
+,<0.0310356,0.499074,-0.00512995>
+,<0.0284093,0.499242,-0.00802545>
+,<0.0251968,0.499434,-0.0115614>
+,<0.0210905,0.499665,-0.0160756>
+,<-0.0260499,0.488483,-0.122528>
+,<-0.0250597,0.500215,0.0153314>
+,<-0.018879,0.488259,-0.12753>
+,<0.0536467,0.491395,-0.121101>
+,<0.0273227,0.497909,-0.0497127>
+,<0.0170342,0.499847,-0.0218518>
+,<-0.00153962,0.50037,-0.00513887>
+,<0.00318977,0.500301,-0.00917888>
+,<-0.0202626,0.5003,0.0111678>
+,<-0.124447,0.496667,0.0937133>
+,<-0.128911,0.49005,-0.0229417>
+,<-0.126735,0.493804,0.0365281>
+,<-0.126113,0.494651,0.0524095>
+,<-0.124483,0.49663,0.0929608>
+,<0.0272388,0.499148,0.0225842>
+,<-0.0642285,0.00343587,-0.496986>
+,<-0.0635565,0.00308048,-0.497035>
+,<-0.0846905,0.0316919,-0.494968>
+,<-0.0881413,0.0169237,-0.495193>
+,<-0.0773188,0.0629325,-0.494114>
+,<-0.0811898,0.0465746,-0.494622>
+,<-0.0726488,0.0825564,-0.49336>
+,<-0.0665238,0.10815,-0.492213>
+,<-0.0609345,0.109381,-0.492375>
+,<-0.0735302,0.0787151,-0.493524>
+,<-0.0676361,0.103362,-0.492445>
+,<-0.0484033,0.112088,-0.492701>
+,<-0.0381047,0.114316,-0.492921>
+,<-0.0278911,0.116515,-0.493099>
+,<0.0162692,0.125916,-0.493428>
+,<0.00426029,0.123376,-0.493404>
+,<0.207247,0.172094,-0.425814>
+,<0.0442936,0.131805,-0.493333>
+,<0.221271,0.168295,-0.420852>
+,<0.0229514,-0.0454626,-0.499563>
+,<-0.0195143,-0.021711,-0.49935>
+,<-0.0253372,-0.0184459,-0.499188>
+,<-0.0309944,-0.0152702,-0.498981>
+,<-0.016389,-0.0234621,-0.499416>
+,<-0.00929961,-0.0274314,-0.499521>
+,<-0.000184572,-0.0325306,-0.499586>
+,<0.0936371,-0.0849417,-0.499021>
+,<0.102907,-0.0571083,-0.498965>
+,<0.100899,-0.03153,-0.498852>
+,<0.0953915,0.0355905,-0.49762>
+,<0.183679,0.178417,-0.433883>
+,<0.205717,0.172528,-0.42634>
+,<0.176094,0.180415,-0.436415>
+,<0.139731,0.189822,-0.448178>
+,<0.191048,0.176462,-0.431392>
+,<0.168131,0.182498,-0.439041>
+,<0.170427,0.0599856,-0.466769>
+,<0.145508,0.0552167,-0.476963>
+,<0.0950608,0.0391898,-0.497513>
+,<0.0959672,0.0284366,-0.497833>
+,<0.0968524,0.0178364,-0.498106>
+,<0.0977335,0.00718531,-0.49834>
+,<0.0986275,-0.00372439,-0.498536>
+,<0.0995527,-0.015121,-0.498697>
+,<0.10053,-0.0272734,-0.498824>
+,<0.101586,-0.0405193,-0.498914>
+,<0.102755,-0.0553069,-0.498965>
+,<0.0990698,-0.0686248,-0.499019>
+,<0.0944763,-0.0824042,-0.499029>
+,<0.0611026,-0.0667392,-0.499309>
+,<0.0383904,-0.0540586,-0.499479>
+,<0.0240098,-0.0460278,-0.49956>
+,<0.0139239,-0.0403937,-0.499595>
+,<0.00633268,-0.0361517,-0.499602>
+,<0.000309987,-0.0327849,-0.499589>
+,<-0.00467102,-0.0299993,-0.499563>
+,<-0.00893402,-0.0276141,-0.499526>
+,<-0.0126908,-0.0255111,-0.499479>
+,<-0.0160877,-0.0236086,-0.499422>
+,<-0.0192314,-0.021847,-0.499357>
+,<-0.022204,-0.0201805,-0.499282>
+,<-0.0250726,-0.0185715,-0.499198>
+,<-0.0278955,-0.0169873,-0.499102>
+,<-0.0307277,-0.0153971,-0.498993>
+,<-0.0336248,-0.0137697,-0.498868>
+,<-0.0366475,-0.0120709,-0.498725>
+,<-0.0112878,0.011464,-0.500142>
+,<-0.336998,0.321247,-0.193789>
+,<-0.346776,0.311767,-0.195862>
+,<-0.411382,0.286593,-0.106882>
+,<-0.407462,0.285632,-0.119688>
+,<-0.415541,0.287593,-0.0931404>
+,<-0.420054,0.288657,-0.0780636>
+,<-0.433302,0.291645,-0.0330804>
+,<-0.461356,0.230985,-0.0211903>
+,<-0.430822,0.291124,-0.0415199>
+,<-0.49368,0.139549,-0.0283229>
+,<-0.408135,0.327772,0.0102308>
+,<-0.379921,0.346507,-0.00926602>
+,<-0.365067,0.356316,-0.019555>
+,<-0.382851,0.344563,-0.00727078>
+,<-0.340966,0.37211,-0.0361422>
+,<-0.330943,0.378609,-0.0429868>
+,<-0.324506,0.382744,-0.0474015>
+,<-0.332109,0.377853,-0.0422101>
+,<-0.31169,0.390886,-0.0561061>
+,<-0.305238,0.394929,-0.0604427>
+,<-0.300663,0.397763,-0.0635373>
+,<-0.306031,0.394432,-0.0599272>
+,<-0.289593,0.40453,-0.0709155>
+,<-0.285175,0.407185,-0.0738672>
+,<-0.290337,0.404077,-0.0704388>
+,<-0.274339,0.413612,-0.0810193>
+,<-0.24677,0.426359,-0.108735>
+,<-0.263082,0.419655,-0.090036>
+,<-0.252622,0.423988,-0.102052>
+,<-0.238268,0.427606,-0.124845>
+,<-0.239515,0.423763,-0.133405>
+,<-0.241763,0.416606,-0.149131>
+,<-0.242816,0.413139,-0.156645>
+,<-0.244885,0.406086,-0.171722>
+,<-0.356747,0.302042,-0.198001>
+,<-0.270004,0.38356,-0.179105>
+,<-0.275109,0.379032,-0.180267>
+,<-0.259189,0.393076,-0.1766>
+,<-0.264344,0.388546,-0.17781>
+,<-0.301206,0.355299,-0.1861>
+,<-0.310379,0.346706,-0.188103>
+,<-0.251889,0.399436,-0.174916>
+,<-0.335391,0.322787,-0.193475>
+,<-0.265459,0.387578,-0.178041>
+,<-0.271001,0.38269,-0.179309>
+,<-0.285079,0.3701,-0.182496>
+,<-0.280674,0.374068,-0.181505>
+,<-0.296929,0.359263,-0.185158>
+,<-0.289333,0.36624,-0.183449>
+,<-0.293521,0.362411,-0.184381>
+,<-0.30652,0.350348,-0.18724>
+,<-0.302028,0.354546,-0.186258>
+,<-0.321207,0.336423,-0.190442>
+,<-0.311308,0.345841,-0.188282>
+,<-0.316528,0.340895,-0.18941>
+,<-0.359394,0.299477,-0.198527>
+,<-0.376705,0.28255,-0.20217>
+,<-0.390104,0.281117,-0.174625>
+,<-0.397718,0.283132,-0.150915>
+,<-0.386035,0.280013,-0.187086>
+,<-0.381667,0.278809,-0.200321>
+,<-0.380758,0.278571,-0.203029>
+,<-0.384384,0.279589,-0.192053>
+,<-0.396274,0.282782,-0.155401>
+,<-0.399983,0.283745,-0.1437>
+,<-0.403689,0.284689,-0.131874>
+,<-0.310534,0.370612,-0.128901>
+,<-0.190669,-0.430373,-0.169896>
+,<-0.190869,-0.42874,-0.173953>
+,<-0.0261693,-0.49225,-0.143738>
+,<-0.0327687,-0.485553,-0.156941>
+,<0.00327124,-0.521672,-0.0847503>
+,<-0.00143953,-0.516956,-0.0942928>
+,<-0.008875,-0.5096,-0.109099>
+,<-0.0476653,-0.508399,-0.0782959>
+,<-0.0799252,-0.494521,-0.0900911>
+,<-0.110564,-0.481275,-0.101233>
+,<-0.11434,-0.479617,-0.102664>
+,<-0.100197,-0.485761,-0.0974991>
+,<-0.133323,-0.471293,-0.109588>
+,<-0.140234,-0.468227,-0.112105>
+,<-0.149833,-0.463929,-0.115556>
+,<-0.151315,-0.463247,-0.116134>
+,<-0.146132,-0.465588,-0.11425>
+,<-0.163186,-0.457803,-0.120398>
+,<-0.164376,-0.457238,-0.120867>
+,<-0.160306,-0.45913,-0.119394>
+,<-0.17484,-0.45229,-0.124604>
+,<-0.175987,-0.451727,-0.125056>
+,<-0.172139,-0.453572,-0.123669>
+,<-0.187013,-0.446351,-0.128977>
+,<-0.188324,-0.445685,-0.129503>
+,<-0.183997,-0.447827,-0.127934>
+,<-0.188966,-0.441987,-0.139645>
+,<-0.188669,-0.443728,-0.134894>
+,<-0.189678,-0.437701,-0.151088>
+,<-0.18923,-0.440397,-0.14394>
+,<-0.189468,-0.438911,-0.147914>
+,<-0.190278,-0.433547,-0.161864>
+,<-0.190085,-0.434937,-0.158296>
+,<-0.190091,-0.43473,-0.158858>
+,<-0.191081,-0.426944,-0.17837>
+,<-0.191836,-0.42027,-0.194472>
+,<-0.19186,-0.419807,-0.195607>
+,<-0.192211,-0.416373,-0.203785>
+,<-0.189201,-0.391582,-0.26675>
+,<-0.180359,-0.38934,-0.279855>
+,<-0.158637,-0.383703,-0.3119>
+,<-0.120758,-0.401213,-0.301225>
+,<-0.0856939,-0.428813,-0.262356>
+,<-0.0757818,-0.439904,-0.242707>
+,<-0.0670477,-0.449507,-0.225365>
+,<-0.0500746,-0.467649,-0.191574>
+,<-0.0914514,-0.422293,-0.273756>
+,<-0.11014,-0.408893,-0.291322>
+,<-0.132868,-0.392396,-0.312496>
+,<-0.147099,-0.381968,-0.325717>
+,<-0.148397,-0.381016,-0.326914>
+,<-0.141131,-0.386377,-0.320128>
+,<-0.106234,-0.411727,-0.287634>
+,<-0.0970063,-0.418331,-0.279003>
+,<-0.0893289,-0.424737,-0.269484>
+,<-0.0838066,-0.430972,-0.25855>
+,<-0.0788081,-0.43657,-0.248645>
+,<-0.0741777,-0.441712,-0.239461>
+,<-0.0697954,-0.446535,-0.230761>
+,<-0.0655634,-0.451151,-0.222352>
+,<-0.061396,-0.455654,-0.214064>
+,<-0.0572131,-0.460131,-0.205738>
+,<-0.0529333,-0.46467,-0.19721>
+,<-0.0484677,-0.469361,-0.188305>
+,<-0.0437121,-0.474312,-0.178812>
+,<-0.0385364,-0.479652,-0.168473>
+,<-0.153551,-0.446874,-0.1647>
+,<0.168084,0.0401055,0.486996>
+,<0.171715,0.0839885,0.47511>
+,<0.273517,-0.034984,0.432215>
+,<0.168397,0.0392763,0.486968>
+,<0.306688,0.0675119,0.389616>
+,<0.304224,0.0430496,0.396241>
+,<0.298307,0.101524,0.388233>
+,<0.304033,0.0917047,0.386317>
+,<0.306231,0.0628305,0.390905>
+,<0.305042,0.0510014,0.394112>
+,<0.303148,0.0327402,0.398979>
+,<0.296144,0.0137633,0.407504>
+,<0.283658,-0.0131897,0.421203>
+,<0.266154,-0.0453018,0.439168>
+,<0.207937,-0.0487132,0.47885>
+,<0.2021,-0.0490454,0.482762>
+,<0.173758,0.0253592,0.48644>
+,<0.163079,0.0530287,0.487434>
+,<0.160493,0.0596975,0.487633>
+,<0.162765,0.0538563,0.487458>
+,<0.178936,0.011883,0.485873>
+,<0.18469,-0.00317045,0.485185>
+,<0.190842,-0.0193246,0.484384>
+,<0.197568,-0.0370515,0.48344>
+,<0.209251,-0.0486279,0.477968>
+,<0.226129,-0.0476506,0.466577>
+,<0.241034,-0.0467801,0.456443>
+,<0.25453,-0.0459848,0.447195>
+,<0.26703,-0.0452415,0.438562>
+,<0.279103,-0.0228568,0.426141>
+,<0.287505,-0.00479067,0.416989>
+,<0.293633,0.00842993,0.410263>
+,<0.298374,0.0186959,0.405016>
+,<0.302212,0.0270407,0.400728>
+,<0.303684,0.0383523,0.397531>
+,<0.304618,0.0473287,0.395135>
+,<0.305345,0.0544302,0.393225>
+,<0.305935,0.0602892,0.391635>
+,<0.306428,0.0652932,0.390264>
+,<0.306853,0.0696945,0.389046>
+,<0.307228,0.073667,0.387935>
+,<0.307566,0.0773373,0.386898>
+,<0.307876,0.080802,0.385907>
+,<0.308167,0.08414,0.384941>
+,<0.30611,0.0880542,0.3856>
+,<0.304181,0.091398,0.386279>
+,<0.30251,0.0942781,0.386856>
+,<0.301023,0.0968301,0.38736>
+,<0.299664,0.0991484,0.387812>
+,<0.298394,0.101303,0.388225>
+,<0.297182,0.103348,0.38861>
+,<0.296002,0.10533,0.388976>
+,<0.29483,0.107287,0.38933>
+,<0.293645,0.109259,0.38968>
+,<0.292421,0.111285,0.390031>
+,<0.291132,0.113408,0.390392>
+,<0.289746,0.11568,0.390771>
+,<0.288221,0.118166,0.391178>
+,<0.286501,0.120954,0.391626>
+,<0.284509,0.12417,0.392135>
+,<0.282127,0.128,0.392731>
+,<0.279234,0.130799,0.393968>
+,<0.275901,0.133881,0.395415>
+,<0.271947,0.137523,0.397115>
+,<0.267083,0.141989,0.399186>
+,<0.260823,0.14772,0.401829>
+,<0.28047,0.0950224,0.403371>
+,<-0.0111705,-0.13387,0.491697>
+,<-0.0453264,-0.137699,0.487986>
+,<-0.000801737,-0.12872,0.493073>
+,<0.00171085,-0.127494,0.493393>
+,<-0.00100082,-0.0786375,0.49702>
+,<0.00744702,-0.120184,0.49449>
+,<-0.00345644,-0.066556,0.497717>
+,<-0.00535295,-0.0572226,0.498233>
+,<-0.00688806,-0.0496653,0.49863>
+,<-0.00817853,-0.0433099,0.498945>
+,<-0.00929828,-0.037793,0.4992>
+,<-0.0102969,-0.0328705,0.49941>
+,<-0.0112096,-0.0283695,0.499586>
+,<-0.0120625,-0.0241608,0.499735>
+,<-0.0128763,-0.0201424,0.499861>
+,<-0.0136685,-0.0162285,0.499968>
+,<-0.0171192,0.00102877,0.50026>
+,<-0.0162418,-0.00331851,0.500213>
+,<-0.0154126,-0.00742486,0.500154>
+,<-0.0160706,-0.00434427,0.500199>
+,<-0.0188853,0.00960632,0.500306>
+,<-0.0178633,0.00453852,0.500285>
+,<-0.0217022,0.0237802,0.500289>
+,<-0.0229836,0.0299483,0.500253>
+,<-0.021377,0.0219714,0.500295>
+,<-0.0276259,0.0530095,0.500038>
+,<-0.0249903,0.0399154,0.500173>
+,<-0.0370331,0.0997637,0.499413>
+,<-0.0313252,0.0713933,0.499811>
+,<-0.0626716,0.126126,0.496835>
+,<-0.0478058,0.135491,0.498492>
+,<-0.088291,0.109934,0.493819>
+,<-0.0760198,0.117699,0.495291>
+,<-0.118537,0.0907379,0.489932>
+,<-0.121677,0.0887077,0.489512>
+,<-0.110871,0.0955946,0.490958>
+,<-0.151348,0.0697378,0.485275>
+,<-0.154707,0.067551,0.484778>
+,<-0.143381,0.074823,0.486453>
+,<-0.179596,0.0515146,0.480924>
+,<-0.166676,0.0598485,0.482952>
+,<-0.196362,0.0203006,0.477555>
+,<-0.196048,0.0116348,0.477301>
+,<-0.196555,0.0271102,0.477763>
+,<-0.195036,-0.0172447,0.476282>
+,<-0.195545,-0.00304294,0.47681>
+,<-0.193858,-0.0483519,0.474933>
+,<-0.180666,-0.0564035,0.47644>
+,<-0.193965,-0.0453372,0.475081>
+,<-0.154382,-0.0724029,0.479312>
+,<-0.166505,-0.0650317,0.478011>
+,<-0.134033,-0.0847374,0.481379>
+,<-0.143697,-0.0788865,0.480418>
+,<-0.116625,-0.095239,0.483>
+,<-0.125086,-0.0901409,0.482231>
+,<-0.100423,-0.104965,0.484364>
+,<-0.108459,-0.100147,0.483706>
+,<-0.0841171,-0.114704,0.485589>
+,<-0.0923611,-0.109786,0.484988>
+,<-0.0663686,-0.125252,0.486765>
+,<-0.0755197,-0.11982,0.486178>
+,<-0.0453426,-0.137689,0.487985>
+,<-0.0191458,-0.137847,0.490603>
+,<-0.0300249,-0.143229,0.489077>
+,<-0.0332695,-0.144808,0.488619>
+,<-0.0327522,-0.144552,0.488694>
+,<-0.0534567,-0.0227233,0.497018>
+,<-0.528849,0.030997,-0.0365517>
+,<-0.514369,0.076589,-0.033114>
+,<-0.348317,-0.289622,0.232706>
+,<-0.362057,-0.29783,0.185714>
+,<-0.409196,-0.178115,0.243879>
+,<-0.500057,-0.0402908,0.189684>
+,<-0.50186,-0.0447962,0.187634>
+,<-0.495938,-0.0299536,0.194316>
+,<-0.473259,0.0258799,0.219395>
+,<-0.479998,0.0094563,0.212047>
+,<-0.449746,0.0939775,0.229901>
+,<-0.467021,0.0409335,0.226103>
+,<-0.457878,0.0626759,0.235771>
+,<-0.44189,0.135787,0.209588>
+,<-0.444136,0.124058,0.215311>
+,<-0.446705,0.110405,0.221947>
+,<-0.444994,0.119598,0.217448>
+,<-0.438644,0.152397,0.20141>
+,<-0.440559,0.142702,0.206173>
+,<-0.43453,0.172516,0.191476>
+,<-0.43344,0.177756,0.188835>
+,<-0.435126,0.169706,0.192846>
+,<-0.429431,0.196228,0.179579>
+,<-0.428272,0.201481,0.176892>
+,<-0.430046,0.193491,0.180934>
+,<-0.424379,0.218533,0.168203>
+,<-0.426398,0.209766,0.172681>
+,<-0.418702,0.242438,0.155931>
+,<-0.416779,0.250432,0.151759>
+,<-0.41966,0.238509,0.15793>
+,<-0.409164,0.2813,0.135693>
+,<-0.41336,0.264388,0.14451>
+,<-0.402298,0.31673,0.108379>
+,<-0.402635,0.325975,0.0918204>
+,<-0.402283,0.316238,0.109248>
+,<-0.410392,0.326713,0.0559613>
+,<-0.405195,0.330251,0.073393>
+,<-0.420684,0.319437,0.0208041>
+,<-0.415522,0.323131,0.0385427>
+,<-0.434054,0.299195,-0.00760007>
+,<-0.427412,0.309498,0.00626404>
+,<-0.449159,0.263726,-0.0185841>
+,<-0.441407,0.284234,-0.0169477>
+,<-0.461678,0.230112,-0.0212525>
+,<-0.455812,0.245951,-0.0199975>
+,<-0.471864,0.202136,-0.0234564>
+,<-0.466975,0.215646,-0.0223943>
+,<-0.480893,0.176719,-0.0254424>
+,<-0.476469,0.189252,-0.0244652>
+,<-0.489544,0.151729,-0.0273786>
+,<-0.485224,0.164291,-0.0264074>
+,<-0.498496,0.125185,-0.0294179>
+,<-0.493938,0.138786,-0.028375>
+,<-0.508557,0.0945845,-0.03175>
+,<-0.538467,0.000272481,-0.0388582>
+,<-0.546272,-0.0430518,-0.0142864>
+,<-0.547803,-0.0565566,-0.00266504>
+,<-0.385381,-0.223138,0.239736>
+,<-0.54559,-0.0372213,-0.0193508>
+,<-0.543404,-0.0189844,-0.0350794>
+,<-0.542709,-0.0133918,-0.0398855>
+,<-0.544082,-0.0245227,-0.0302709>
+,<-0.513642,-0.0509456,0.145667>
+,<-0.3995,-0.196665,0.242215>
+,<-0.434353,-0.129194,0.247946>
+,<-0.434774,-0.284972,-0.00511218>
+,<-0.464303,0.153517,0.106091>
+,<0.512811,0.0403086,-0.0388673>
+,<0.512538,0.034509,-0.0369451>
+,<0.499195,0.0496564,-0.10025>
+,<0.500248,0.0489744,-0.0957045>
+,<0.500665,0.048685,-0.0938944>
+,<0.503075,0.0470916,-0.083297>
+,<0.50945,0.042693,-0.0544952>
+,<0.512711,0.04038,-0.0393387>
+,<0.512073,0.0250371,-0.03389>
+,<0.511341,0.0109476,-0.029293>
+,<0.510621,-0.00195273,-0.0250816>
+,<0.509899,-0.0140276,-0.0211374>
+,<0.509161,-0.0255653,-0.0173664>
+,<0.508395,-0.036809,-0.0136893>
+,<0.507587,-0.0479786,-0.010034>
+,<0.506721,-0.0592884,-0.00633066>
+,<0.505778,-0.0709636,-0.00250528>
+,<0.504735,-0.0832592,0.00152579>
+,<0.50356,-0.0964839,0.00586398>
+,<0.500101,-0.10773,-0.00161053>
+,<0.496827,-0.118161,-0.00861689>
+,<0.490573,-0.13762,-0.0217062>
+,<0.487466,-0.147055,-0.0280628>
+,<0.484294,-0.156538,-0.0344587>
+,<0.480992,-0.166254,-0.0410189>
+,<0.477489,-0.176408,-0.0478817>
+,<0.474023,-0.180432,-0.0593583>
+,<0.471269,-0.176122,-0.074377>
+,<0.468901,-0.17246,-0.0870852>
+,<0.465995,-0.168085,-0.102287>
+,<0.464878,-0.166358,-0.108105>
+,<0.466797,-0.169249,-0.0981721>
+,<0.461366,-0.161178,-0.125768>
+,<0.459691,-0.158757,-0.133951>
+,<0.458022,-0.156381,-0.14194>
+,<0.45633,-0.154003,-0.149891>
+,<0.45458,-0.151577,-0.157958>
+,<0.452735,-0.149053,-0.166303>
+,<0.449895,-0.145269,-0.178838>
+,<0.452315,-0.135059,-0.177152>
+,<0.450754,-0.146374,-0.175113>
+,<0.461239,-0.105631,-0.165254>
+,<0.463698,-0.097434,-0.161932>
+,<0.466262,-0.0887187,-0.158466>
+,<0.467018,-0.0862299,-0.157379>
+,<0.465551,-0.0912069,-0.159404>
+,<0.469671,-0.0769726,-0.153677>
+,<0.47015,-0.0753715,-0.152941>
+,<0.469252,-0.0785259,-0.154234>
+,<0.471691,-0.0698459,-0.150667>
+,<0.470955,-0.0725072,-0.151764>
+,<0.473036,-0.064873,-0.148612>
+,<0.47238,-0.0673198,-0.149624>
+,<0.474585,-0.0588244,-0.146192>
+,<0.473674,-0.0624559,-0.14761>
+,<0.474306,-0.0600214,-0.146599>
+,<0.476618,-0.05067,-0.142777>
+,<0.475602,-0.0549021,-0.144466>
+,<0.476294,-0.0521004,-0.143295>
+,<0.478795,-0.0416468,-0.138902>
+,<0.477861,-0.045602,-0.140568>
+,<0.47989,-0.0369452,-0.136918>
+,<0.481224,-0.0311422,-0.134463>
+,<0.482932,-0.0236374,-0.131283>
+,<0.485255,-0.0133233,-0.126905>
+,<0.488701,0.00210254,-0.12035>
+,<0.479066,-0.0747935,-0.1237>
+,<0.437426,-0.232348,0.0703164>
+,<0.427002,-0.253254,0.0600885>
+,<0.432571,-0.235134,0.0903847>
+,<0.426788,-0.253424,0.0608932>
+,<0.426139,-0.254089,0.0626769>
+,<0.42646,-0.253741,0.0618809>
+,<0.434634,-0.234011,0.0819785>
+,<0.425719,-0.254531,0.0637286>
+,<0.425051,-0.255324,0.0650107>
+,<0.425302,-0.255014,0.0645801>
+,<0.423781,-0.256903,0.0670215>
+,<0.4244,-0.256102,0.0661763>
+,<0.423384,-0.257407,0.0675791>
+,<0.424984,-0.239046,0.120037>
+,<0.422836,-0.258135,0.0682116>
+,<0.42724,-0.237931,0.111277>
+,<0.413705,-0.27204,0.0696587>
+,<0.403038,-0.283293,0.0879606>
+,<0.408256,-0.279862,0.0709329>
+,<0.409209,-0.280172,0.0636865>
+,<0.403212,-0.281741,0.0927383>
+,<0.412567,-0.274003,0.0686706>
+,<0.404735,-0.27676,0.102256>
+,<0.41635,-0.267703,0.0708243>
+,<0.412752,-0.260187,0.115881>
+,<0.408434,-0.269205,0.108495>
+,<0.421911,-0.240573,0.131802>
+,<0.420872,-0.260873,0.0698278>
+,<0.420885,-0.242819,0.129943>
+,<0.418348,-0.248261,0.125581>
+,<0.421019,-0.260657,0.0697593>
+,<0.417429,-0.250259,0.123917>
+,<0.420352,-0.261608,0.0701848>
+,<0.414555,-0.256392,0.118933>
+,<0.419658,-0.262625,0.0705015>
+,<0.41208,-0.261624,0.114667>
+,<0.41893,-0.263704,0.0707584>
+,<0.409884,-0.26622,0.110906>
+,<0.418174,-0.264847,0.0709164>
+,<0.407883,-0.270361,0.107504>
+,<0.417385,-0.266058,0.0709865>
+,<0.406017,-0.27418,0.104354>
+,<0.416576,-0.267328,0.0709224>
+,<0.404238,-0.277779,0.101372>
+,<0.415721,-0.26868,0.0707809>
+,<0.403374,-0.280417,0.0966785>
+,<0.414881,-0.270059,0.0704249>
+,<0.40319,-0.282151,0.091364>
+,<0.413979,-0.27154,0.0699931>
+,<0.403018,-0.283646,0.0867541>
+,<0.413061,-0.273081,0.069386>
+,<0.402853,-0.28497,0.0826433>
+,<0.412143,-0.274661,0.0685731>
+,<0.406164,-0.281942,0.0750969>
+,<0.411115,-0.276422,0.0676506>
+,<0.40952,-0.27844,0.0690857>
+,<0.410831,-0.277258,0.0659306>
+,<0.410668,-0.277472,0.0660479>
+,<0.409825,-0.278906,0.0652404>
+,<0.413281,-0.274579,0.0618905>
+,<0.408696,-0.281271,0.062151>
+,<0.414912,-0.272862,0.0587949>
+,<0.40772,-0.283671,0.0576269>
+,<0.416046,-0.271639,0.0566333>
+,<0.407459,-0.284917,0.0533366>
+,<0.407461,-0.285168,0.0520153>
+,<0.416938,-0.270656,0.0549137>
+,<0.408031,-0.285243,0.0471019>
+,<0.408267,-0.285092,0.0459882>
+,<0.417708,-0.269785,0.0534068>
+,<0.409537,-0.283904,0.0419761>
+,<0.409921,-0.283482,0.0410748>
+,<0.41035,-0.282982,0.0402411>
+,<0.418429,-0.268948,0.0519717>
+,<0.411754,-0.281248,0.0379433>
+,<0.412271,-0.280578,0.0372465>
+,<0.412828,-0.279835,0.0366399>
+,<0.41916,-0.268078,0.050493>
+,<0.414654,-0.277299,0.0351012>
+,<0.415323,-0.276339,0.0346784>
+,<0.416019,-0.275316,0.0344023>
+,<0.419964,-0.267095,0.0488406>
+,<0.418307,-0.271853,0.033916>
+,<0.420934,-0.265881,0.0468179>
+,<0.420838,-0.267809,0.034498>
+,<0.421696,-0.266377,0.0350318>
+,<0.422253,-0.264194,0.0440429>
+,<0.423559,-0.263196,0.0364474>
+,<0.424524,-0.2612,0.0394431>
+,<0.424621,-0.261348,0.0373512>
+,<0.423172,-0.262998,0.0421173>
+,<0.422624,-0.264813,0.0356382>
+,<0.421531,-0.265121,0.0455624>
+,<0.419972,-0.269219,0.0341669>
+,<0.41911,-0.270589,0.0340278>
+,<0.42042,-0.266528,0.0478927>
+,<0.417507,-0.273082,0.0340107>
+,<0.416754,-0.274226,0.0341186>
+,<0.419548,-0.267606,0.0496984>
+,<0.414015,-0.278205,0.0355333>
+,<0.413406,-0.279049,0.036056>
+,<0.41879,-0.268521,0.0512451>
+,<0.411252,-0.281889,0.0386483>
+,<0.410781,-0.282471,0.0394125>
+,<0.418071,-0.269367,0.0526876>
+,<0.40918,-0.284275,0.042917>
+,<0.408838,-0.284614,0.0438923>
+,<0.408551,-0.284862,0.0449231>
+,<0.417333,-0.270212,0.0541436>
+,<0.407838,-0.285318,0.048259>
+,<0.40766,-0.285357,0.0494669>
+,<0.407565,-0.285267,0.0507043>
+,<0.416513,-0.271127,0.0557357>
+,<0.407465,-0.28463,0.0547423>
+,<0.40759,-0.284171,0.0561271>
+,<0.41552,-0.272209,0.0576379>
+,<0.407968,-0.283,0.0590986>
+,<0.4083,-0.282196,0.0605875>
+,<0.414185,-0.273633,0.0601732>
+,<0.412531,-0.275409,0.0631065>
+,<0.409805,-0.279087,0.0645968>
+,<0.413619,-0.274254,0.0611316>
+,<0.409072,-0.280564,0.0628501>
+,<0.414457,-0.273363,0.0595833>
+,<0.408422,-0.28196,0.0608512>
+,<0.415139,-0.272632,0.0583092>
+,<0.407932,-0.28316,0.0585993>
+,<0.415716,-0.272008,0.0572221>
+,<0.416219,-0.271458,0.0562658>
+,<0.407472,-0.284871,0.0534809>
+,<0.416669,-0.270961,0.0554022>
+,<0.407565,-0.285265,0.0507152>
+,<0.417082,-0.2705,0.0546038>
+,<0.407913,-0.285272,0.0479161>
+,<0.417469,-0.270063,0.0538492>
+,<0.408501,-0.284895,0.0451599>
+,<0.417839,-0.26964,0.0531213>
+,<0.409337,-0.284105,0.0425505>
+,<0.418199,-0.269222,0.0524051>
+,<0.410393,-0.282929,0.0401715>
+,<0.418557,-0.268802,0.0516866>
+,<0.411645,-0.281384,0.0381216>
+,<0.418921,-0.26837,0.0509515>
+,<0.413042,-0.27954,0.0364559>
+,<0.419296,-0.267918,0.0501845>
+,<0.414531,-0.277471,0.0352082>
+,<0.419692,-0.267436,0.0493671>
+,<0.416062,-0.275252,0.0343956>
+,<0.42012,-0.266908,0.0484763>
+,<0.417588,-0.272955,0.0340216>
+,<0.420594,-0.266318,0.0474816>
+,<0.419063,-0.270661,0.034036>
+,<0.421132,-0.26564,0.0463394>
+,<0.420458,-0.268417,0.0344495>
+,<0.421764,-0.264837,0.0449841>
+,<0.42174,-0.266298,0.0350941>
+,<0.422536,-0.263848,0.0433053>
+,<0.422897,-0.264307,0.0361221>
+,<0.423532,-0.262572,0.0410601>
+,<0.423909,-0.262499,0.0373744>
+,<0.424877,-0.260665,0.0391668>
+,<0.425573,-0.259936,0.0364104>
+,<0.425679,-0.259316,0.0394219>
+,<0.42668,-0.25839,0.0346218>
+,<0.426301,-0.258045,0.0410433>
+,<0.429845,-0.254219,0.0276694>
+,<0.426819,-0.25694,0.0426108>
+,<0.436191,-0.245807,0.0138197>
+,<0.427239,-0.25599,0.0441497>
+,<0.456458,-0.218865,-0.0304166>
+,<0.427596,-0.255149,0.0456068>
+,<0.454199,-0.219562,-0.0114284>
+,<0.427835,-0.254485,0.047117>
+,<0.450933,-0.222274,0.00533494>
+,<0.428006,-0.253935,0.0485791>
+,<0.448598,-0.224183,0.0172014>
+,<0.42814,-0.253178,0.051399>
+,<0.445368,-0.226758,0.033362>
+,<0.428132,-0.252928,0.0527343>
+,<0.444154,-0.227695,0.0393156>
+,<0.428054,-0.252795,0.0540412>
+,<0.443096,-0.228493,0.0444281>
+,<0.442147,-0.229191,0.0489464>
+,<0.42799,-0.2528,0.0545415>
+,<0.441274,-0.229817,0.0530422>
+,<0.427942,-0.252724,0.0552944>
+,<0.427578,-0.252828,0.0576693>
+,<0.427622,-0.252826,0.057345>
+,<-0.0648851,0.489201,-0.095137>
+,<-0.0408752,0.488877,-0.112106>
+,<-0.0954606,0.488955,-0.0733396>
+,<-0.0763225,0.489192,-0.0870071>
+,<0.00627778,0.487309,-0.145165>
+,<-0.017117,0.488193,-0.128793>
+,<0.0611698,0.489426,-0.141385>
+,<0.057554,0.490388,-0.13149>
+,<-0.00577545,0.5004,-0.00140256>
+,<-0.0307565,0.500093,0.0202766>
+,<-0.0778975,0.498652,0.06121>
+,<-0.109445,0.497541,0.0886075>
+,<-0.124136,0.497008,0.101291>
+,<-0.0942321,0.498084,0.075275>
+,<-0.0428672,0.499776,0.0307147>
+,<-0.0347448,0.499996,0.023668>
+,<-0.0283278,0.500148,0.0181009>
+,<-0.0230387,0.500253,0.0135122>
+,<-0.0185246,0.500325,0.00959594>
+,<-0.0145563,0.500371,0.00615309>
+,<-0.0109757,0.500396,0.00304674>
+,<-0.00766842,0.500403,0.000177585>
+,<-0.00454678,0.500394,-0.00253039>
+,<0.00617849,0.500237,-0.0117709>
+,<0.00141472,0.500331,-0.00770134>
+,<0.0073952,0.500206,-0.012888>
+,<0.0125203,0.500053,-0.0172701>
+,<0.0138873,0.500003,-0.0185176>
+,<0.010542,0.500116,-0.0156168>
+,<0.0191392,0.499513,-0.0274335>
+,<0.0201087,0.499341,-0.030173>
+,<0.0185576,0.499605,-0.0259746>
+,<0.024099,0.498593,-0.0408612>
+,<0.0252738,0.498346,-0.0441612>
+,<0.0234257,0.498721,-0.039155>
+,<0.0306094,0.497181,-0.0584933>
+,<0.032388,0.496757,-0.0634421>
+,<0.0296544,0.49739,-0.0560319>
+,<0.0417542,0.494471,-0.0886839>
+,<0.0455409,0.493495,-0.0991121>
+,<0.039913,0.494922,-0.0838472>
+,<0.0575795,0.488766,-0.146748>
+,<0.050184,0.487374,-0.157732>
+,<0.0583436,0.488912,-0.145591>
+,<0.0192943,0.486771,-0.154222>
+,<0.0401629,0.485847,-0.168782>
+,<-0.00869316,0.487899,-0.134663>
+,<0.0036621,0.487422,-0.143304>
+,<-0.0338613,0.488705,-0.117041>
+,<-0.0352136,0.488746,-0.116064>
+,<-0.0275722,0.488534,-0.121432>
+,<-0.0484711,0.489031,-0.106726>
+,<-0.0421066,0.488909,-0.111213>
+,<-0.0602566,0.489178,-0.0983937>
+,<-0.0544756,0.48912,-0.102485>
+,<-0.0716131,0.489213,-0.0903337>
+,<-0.0659325,0.489209,-0.0943693>
+,<-0.0886242,0.489069,-0.0782301>
+,<-0.0774092,0.489191,-0.0862083>
+,<-0.0834404,0.489139,-0.0819073>
+,<-0.10453,0.488767,-0.0668119>
+,<-0.0968002,0.488934,-0.0723537>
+,<-0.121658,0.488297,-0.0545358>
+,<-0.123732,0.488239,-0.0530127>
+,<-0.129604,0.488444,-0.0438186>
+,<-0.129756,0.488041,-0.0486951>
+,<-0.129591,0.48847,-0.0435095>
+,<-0.380914,-0.231374,0.238926>
+,<-0.376417,-0.239595,0.238098>
+,<-0.369581,-0.299959,0.162823>
+,<-0.371874,-0.300593,0.155694>
+,<-0.367131,-0.299269,0.170361>
+,<-0.364458,-0.298505,0.178504>
+,<-0.358058,-0.296632,0.197728>
+,<-0.361474,-0.297638,0.187509>
+,<-0.349127,-0.293953,0.224115>
+,<-0.354033,-0.295432,0.209669>
+,<-0.360532,-0.268111,0.235103>
+,<-0.361826,-0.265835,0.235331>
+,<-0.356208,-0.275785,0.234238>
+,<-0.371804,-0.247961,0.237236>
+,<-0.389904,-0.214728,0.240543>
+,<-0.394576,-0.205971,0.241364>
+,<-0.404804,-0.186562,0.243118>
+,<-0.417279,-0.16253,0.24519>
+,<-0.410654,-0.175335,0.244097>
+,<-0.425009,-0.147489,0.246447>
+,<-0.445976,-0.106662,0.249301>
+,<-0.465701,-0.0850779,0.227847>
+,<-0.530409,-0.0599787,0.0833504>
+,<-0.502307,-0.0450286,0.186074>
+,<-0.519156,-0.0538786,0.125516>
+,<-0.53744,-0.0983761,0.000143071>
+,<-0.534749,-0.104616,-0.00197242>
+,<-0.499523,-0.184577,-0.0287832>
+,<-0.479842,-0.22759,-0.0432333>
+,<-0.454881,-0.259604,-0.0220193>
+,<-0.394014,-0.306102,0.0826089>
+,<-0.387977,-0.304709,0.103221>
+,<-0.383077,-0.303528,0.119613>
+,<-0.378702,-0.302427,0.133936>
+,<-0.408332,-0.309239,0.0326134>
+,<-0.414182,-0.310452,0.0120094>
+,<-0.425709,-0.296257,0.00244404>
+,<-0.444409,-0.27287,-0.0131905>
+,<-0.507637,-0.166482,-0.0227077>
+,<-0.545565,-0.0794172,0.00646013>
+,<-0.54934,-0.0705655,0.00944699>
+,<-0.54861,-0.0722859,0.00887394>
+,<-0.518342,-0.142305,-0.0145735>
+,<-0.509792,-0.161647,-0.0210613>
+,<-0.501611,-0.179945,-0.0272039>
+,<-0.493626,-0.197601,-0.0331363>
+,<-0.48568,-0.214968,-0.0389765>
+,<-0.475987,-0.232563,-0.0399121>
+,<-0.463169,-0.249028,-0.0290092>
+,<-0.451879,-0.263416,-0.0194555>
+,<-0.44167,-0.276319,-0.0108625>
+,<-0.432217,-0.288164,-0.00295012>
+,<-0.423271,-0.299273,0.00449431>
+,<-0.414631,-0.309904,0.011642>
+,<-0.407097,-0.308945,0.0370385>
+,<-0.401474,-0.307731,0.056765>
+,<-0.397039,-0.306756,0.072209>
+,<-0.393381,-0.305935,0.0848433>
+,<-0.39025,-0.305219,0.0955559>
+,<-0.387488,-0.304572,0.104918>
+,<-0.384984,-0.303974,0.11332>
+,<-0.382659,-0.303405,0.121041>
+,<-0.380451,-0.302853,0.128292>
+,<-0.378311,-0.302307,0.135243>
+,<-0.376196,-0.301755,0.142039>
+,<-0.374064,-0.301187,0.148812>
+,<-0.413046,-0.239792,0.149308>
+,<-0.0154305,-0.538074,0.0315537>
+,<-0.0474967,-0.512961,0.109291>
+,<-0.00312122,-0.527508,-0.0619718>
+,<-0.00963475,-0.533312,-0.0125466>
+,<0.165986,-0.454169,-0.182204>
+,<0.142091,-0.465099,-0.167411>
+,<0.212523,-0.440218,-0.14143>
+,<0.214507,-0.446875,-0.0737817>
+,<0.215313,-0.449828,-0.0391308>
+,<0.214982,-0.44855,-0.0552006>
+,<0.21425,-0.445994,-0.0830628>
+,<0.213373,-0.443045,-0.11318>
+,<0.13106,-0.47006,-0.16057>
+,<0.0876943,-0.488998,-0.133592>
+,<0.0339011,-0.511395,-0.0999656>
+,<0.200297,-0.461127,0.0892943>
+,<0.215562,-0.454843,0.0857489>
+,<0.208594,-0.457729,0.0873555>
+,<0.174735,-0.471433,0.0951348>
+,<0.162327,-0.476343,0.0979574>
+,<0.148855,-0.481617,0.101008>
+,<0.133881,-0.487417,0.104382>
+,<0.116802,-0.493966,0.108215>
+,<0.0967371,-0.501588,0.1127>
+,<0.0731515,-0.510437,0.117017>
+,<0.045253,-0.520764,0.120672>
+,<0.0156664,-0.531435,0.119785>
+,<-0.100936,-0.481449,0.134277>
+,<-0.00944802,-0.538648,0.0814953>
+,<-0.01923,-0.541038,0.0606186>
+,<-0.0158754,-0.538439,0.0350617>
+,<-0.0128354,-0.535997,0.0119168>
+,<-0.0100172,-0.53365,-0.00952594>
+,<-0.00734887,-0.531346,-0.0298142>
+,<-0.00477167,-0.52904,-0.0493959>
+,<-0.000552172,-0.526125,-0.0683407>
+,<0.0101418,-0.521036,-0.0850383>
+,<0.0290863,-0.513367,-0.0969157>
+,<0.0453041,-0.506735,-0.107074>
+,<0.0595943,-0.50083,-0.116015>
+,<0.0725105,-0.495434,-0.124087>
+,<0.0844557,-0.490385,-0.131544>
+,<0.0957401,-0.48556,-0.13858>
+,<0.106616,-0.480854,-0.145353>
+,<0.117304,-0.476174,-0.152>
+,<0.128009,-0.471431,-0.158649>
+,<0.138937,-0.466532,-0.165429>
+,<0.150315,-0.461374,-0.172478>
+,<0.162403,-0.455832,-0.179959>
+,<0.17553,-0.449751,-0.188072>
+,<0.190126,-0.442922,-0.197083>
+,<0.20679,-0.435053,-0.20736>
+,<0.211972,-0.438727,-0.156647>
+,<0.213043,-0.442214,-0.121864>
+,<0.213669,-0.444265,-0.101135>
+,<0.214079,-0.445627,-0.0871503>
+,<0.21437,-0.446605,-0.0769096>
+,<0.214588,-0.447347,-0.0689519>
+,<0.214757,-0.447935,-0.0624785>
+,<0.214892,-0.448416,-0.0570136>
+,<0.215003,-0.448822,-0.0522539>
+,<0.215096,-0.449172,-0.0479944>
+,<0.215175,-0.44948,-0.0440892>
+,<0.215243,-0.449756,-0.0404284>
+,<0.215303,-0.450008,-0.0369248>
+,<0.215355,-0.450243,-0.0335044>
+,<0.183592,-0.464325,-0.0331205>
+,<-0.0685835,-0.500582,0.119029>
+,<-0.126714,-0.466211,0.146323>
+,<-0.012772,-0.467315,0.23423>
+,<-0.00912583,-0.475933,0.219275>
+,<-0.0308012,-0.441247,0.273247>
+,<-0.019735,-0.450665,0.262717>
+,<-0.045057,-0.432148,0.280622>
+,<-0.0591794,-0.423065,0.287907>
+,<-0.0693332,-0.416508,0.293097>
+,<-0.0577511,-0.423996,0.28716>
+,<-0.0904291,-0.402729,0.303834>
+,<-0.100426,-0.396129,0.308882>
+,<-0.110326,-0.389547,0.313856>
+,<-0.120318,-0.382856,0.318849>
+,<-0.130599,-0.375924,0.32396>
+,<-0.142719,-0.367682,0.329964>
+,<-0.152955,-0.360694,0.334986>
+,<-0.14139,-0.368598,0.329296>
+,<-0.179872,-0.342124,0.348131>
+,<-0.196322,-0.330681,0.356112>
+,<-0.210929,-0.330286,0.344987>
+,<-0.223387,-0.332081,0.331411>
+,<-0.234689,-0.333675,0.319025>
+,<-0.250772,-0.335851,0.301298>
+,<-0.25511,-0.336453,0.296452>
+,<-0.245176,-0.335119,0.307467>
+,<-0.274163,-0.338911,0.27513>
+,<-0.277949,-0.344401,0.261231>
+,<-0.274049,-0.35579,0.242727>
+,<-0.271856,-0.362034,0.232566>
+,<-0.274633,-0.354054,0.245579>
+,<-0.262228,-0.377433,0.211105>
+,<-0.249777,-0.387401,0.202908>
+,<-0.23115,-0.400357,0.194438>
+,<-0.22883,-0.401934,0.193449>
+,<-0.23749,-0.39594,0.197362>
+,<-0.213978,-0.412146,0.186672>
+,<-0.212748,-0.412958,0.186168>
+,<-0.217073,-0.410013,0.188129>
+,<-0.205752,-0.417675,0.182989>
+,<-0.209034,-0.41547,0.184482>
+,<-0.200011,-0.421488,0.180372>
+,<-0.202774,-0.41966,0.181633>
+,<-0.194852,-0.424859,0.178011>
+,<-0.197389,-0.423208,0.179174>
+,<-0.188041,-0.429244,0.174823>
+,<-0.192347,-0.426475,0.176862>
+,<-0.189827,-0.428087,0.175702>
+,<-0.187241,-0.429727,0.17451>
+,<-0.176068,-0.436695,0.169284>
+,<-0.181644,-0.433233,0.171923>
+,<-0.178485,-0.435187,0.170459>
+,<-0.174952,-0.437357,0.168819>
+,<-0.155036,-0.4494,0.159487>
+,<-0.166074,-0.442749,0.164691>
+,<-0.16015,-0.446314,0.161931>
+,<0.00878485,-0.517445,0.145512>
+,<0.00921081,-0.518397,0.143794>
+,<0.00390597,-0.506229,0.165685>
+,<0.0150224,-0.531665,0.119747>
+,<0.00233019,-0.535395,0.101207>
+,<-0.0056061,-0.537668,0.0896043>
+,<0.00226024,-0.535415,0.101106>
+,<0.00353556,-0.505397,0.167174>
+,<-0.00108767,-0.494712,0.186225>
+,<-0.00526453,-0.484989,0.203412>
+,<-0.176814,-0.420902,0.204888>
+,<0.280854,0.0807592,-0.415164>
+,<0.24625,0.150588,-0.414491>
+,<0.198537,0.0653255,-0.454569>
+,<0.226372,0.0705634,-0.441551>
+,<0.0659286,0.159643,-0.482825>
+,<0.160216,0.0580341,-0.470987>
+,<0.0534786,0.13374,-0.493258>
+,<0.0629455,0.11349,-0.494431>
+,<0.0738641,0.0900825,-0.495626>
+,<0.188668,0.0634567,-0.458975>
+,<0.234313,0.0720522,-0.437744>
+,<0.259025,0.0766777,-0.425791>
+,<0.283024,0.0910289,-0.411968>
+,<0.260595,0.127602,-0.413702>
+,<0.241386,0.158304,-0.414697>
+,<0.237962,0.16369,-0.414831>
+,<0.239634,0.16103,-0.41478>
+,<0.254088,0.138027,-0.414109>
+,<0.258882,0.130321,-0.413826>
+,<0.263819,0.122343,-0.413503>
+,<0.26901,0.113916,-0.413131>
+,<0.274583,0.104824,-0.412698>
+,<0.280706,0.0947878,-0.412187>
+,<0.287608,0.0834269,-0.411572>
+,<0.2655,0.0779598,-0.422633>
+,<0.249078,0.0748789,-0.430607>
+,<0.237575,0.0727198,-0.436166>
+,<0.228921,0.0710945,-0.440324>
+,<0.222054,0.0698042,-0.443601>
+,<0.216373,0.0687358,-0.446293>
+,<0.211508,0.0678201,-0.44858>
+,<0.207216,0.0670117,-0.45058>
+,<0.203332,0.0662793,-0.452373>
+,<0.199733,0.0655999,-0.454019>
+,<0.196325,0.064956,-0.455561>
+,<0.193033,0.064333,-0.457036>
+,<0.189789,0.0637183,-0.458474>
+,<0.18653,0.0630999,-0.459904>
+,<0.183192,0.0624657,-0.461352>
+,<0.179705,0.0618024,-0.462849>
+,<0.175986,0.0610942,-0.464429>
+,<0.171933,0.0603215,-0.466133>
+,<0.167408,0.059458,-0.468018>
+,<0.162219,0.0584671,-0.470159>
+,<0.156085,0.0572948,-0.472668>
+,<0.148566,0.0558569,-0.47572>
+,<0.138928,0.0540128,-0.479604>
+,<0.125844,0.051508,-0.484844>
+,<0.106624,0.0478272,-0.492501>
+,<0.0920146,0.0509623,-0.497144>
+,<0.0874692,0.0607977,-0.496824>
+,<0.0828886,0.070688,-0.496459>
+,<0.0781831,0.0808264,-0.496042>
+,<0.0732531,0.0914262,-0.495561>
+,<0.0679804,0.10274,-0.495>
+,<0.0622157,0.115085,-0.494341>
+,<0.0557597,0.128885,-0.493551>
+,<0.057322,0.141692,-0.490084>
+,<0.0627926,0.153062,-0.4855>
+,<0.0681482,0.16419,-0.480957>
+,<0.0734922,0.175291,-0.476368>
+,<0.0789276,0.18658,-0.471645>
+,<0.0845642,0.198284,-0.466688>
+,<0.0992866,0.200043,-0.460803>
+,<0.116345,0.195741,-0.455522>
+,<0.130247,0.192216,-0.451178>
+,<0.182225,0.0994352,-0.45531>
+,<0.171632,0.298811,0.366765>
+,<0.0117265,0.348518,0.371805>
+,<0.148411,0.264077,0.398665>
+,<0.177303,0.277722,0.380117>
+,<0.122483,0.251586,0.414691>
+,<0.1339,0.257134,0.407756>
+,<0.10168,0.241276,0.426818>
+,<0.089846,0.240431,0.430266>
+,<0.0781275,0.240989,0.432673>
+,<0.062975,0.24166,0.435693>
+,<0.0406551,0.242584,0.440027>
+,<0.0241238,0.243241,0.443186>
+,<0.0327253,0.242952,0.441517>
+,<0.0670778,0.241524,0.434861>
+,<0.0746236,0.241188,0.433357>
+,<0.0811748,0.240886,0.432033>
+,<0.08702,0.240607,0.430833>
+,<0.0923637,0.240342,0.429718>
+,<0.0973589,0.240085,0.428659>
+,<0.102253,0.241587,0.426476>
+,<0.106591,0.243753,0.423986>
+,<0.110397,0.245646,0.421787>
+,<0.113824,0.247346,0.419792>
+,<0.116983,0.248907,0.417939>
+,<0.11996,0.250373,0.416179>
+,<0.128433,0.254513,0.411089>
+,<0.128096,0.254324,0.411309>
+,<0.125628,0.253147,0.412788>
+,<0.134264,0.257334,0.407516>
+,<0.140409,0.260261,0.403709>
+,<0.140839,0.260491,0.403425>
+,<0.137418,0.258851,0.405561>
+,<0.148972,0.264368,0.398294>
+,<0.159439,0.269303,0.391629>
+,<0.160273,0.269723,0.391077>
+,<0.154066,0.266786,0.39505>
+,<0.191988,0.284622,0.370602>
+,<0.194273,0.28573,0.369096>
+,<0.178812,0.278463,0.379121>
+,<0.174963,0.297573,0.366628>
+,<0.188056,0.292816,0.365968>
+,<0.15385,0.305205,0.3676>
+,<0.14888,0.306948,0.36784>
+,<0.156132,0.30436,0.367522>
+,<0.13676,0.311227,0.368325>
+,<0.142508,0.309206,0.368103>
+,<0.126442,0.314813,0.368678>
+,<0.131452,0.313079,0.368514>
+,<0.115462,0.318585,0.368959>
+,<0.121617,0.316469,0.368821>
+,<0.116876,0.318081,0.368947>
+,<0.102233,0.322975,0.369246>
+,<0.10728,0.321302,0.369158>
+,<0.0891816,0.327265,0.369387>
+,<0.096868,0.324737,0.369324>
+,<0.0910413,0.326635,0.369392>
+,<0.0684606,0.333872,0.369535>
+,<0.0747171,0.331912,0.369485>
+,<0.0443519,0.341473,0.369558>
+,<0.0578529,0.337228,0.369557>
+,<0.01024,0.347943,0.372567>
+,<0.026189,0.347155,0.36953>
+,<-0.00105352,0.343653,0.378237>
+,<-0.0136153,0.338846,0.384505>
+,<-0.0279594,0.333318,0.391621>
+,<-0.0372893,0.324433,0.4>
+,<0.105038,0.280323,0.400982>
+}
+face_indices {
+14850
+,<1,740,681>
+,<1,681,460>
+,<1,451,132>
+,<1,132,740>
+,<1,460,472>
+,<1,472,451>
+,<2,1005,984>
+,<2,984,346>
+,<2,931,980>
+,<2,980,1005>
+,<2,346,606>
+,<2,606,931>
+,<3,439,472>
+,<3,472,440>
+,<3,74,138>
+,<3,138,439>
+,<3,440,227>
+,<3,227,74>
+,<4,6702,6674>
+,<4,6674,2490>
+,<4,1743,6670>
+,<4,6670,6702>
+,<4,2490,5709>
+,<4,5709,1743>
+,<5,6038,6847>
+,<5,6847,6849>
+,<5,6849,73>
+,<5,73,483>
+,<5,6041,5357>
+,<5,5357,6848>
+,<5,6848,6038>
+,<5,483,1603>
+,<5,1603,6041>
+,<6,3703,3711>
+,<6,3711,3704>
+,<6,1737,3463>
+,<6,3463,3703>
+,<6,3704,3460>
+,<6,3460,1737>
+,<7,2387,2407>
+,<7,2407,2388>
+,<7,6106,6157>
+,<7,6157,6147>
+,<7,6147,2346>
+,<7,2346,2387>
+,<7,2388,2345>
+,<7,2345,6105>
+,<7,6105,6106>
+,<8,5390,5376>
+,<8,5376,5391>
+,<8,5306,5234>
+,<8,5234,5390>
+,<8,5391,5302>
+,<8,5302,5306>
+,<9,443,472>
+,<9,472,444>
+,<9,74,402>
+,<9,402,443>
+,<9,444,700>
+,<9,700,699>
+,<9,699,74>
+,<10,2368,2407>
+,<10,2407,2369>
+,<10,273,263>
+,<10,263,2368>
+,<10,2369,277>
+,<10,277,273>
+,<11,5366,6044>
+,<11,6044,245>
+,<11,245,691>
+,<11,1603,39>
+,<11,39,5366>
+,<11,691,1035>
+,<11,1035,1553>
+,<11,1553,1603>
+,<12,329,807>
+,<12,807,577>
+,<12,340,194>
+,<12,194,329>
+,<12,577,561>
+,<12,561,340>
+,<13,7091,5898>
+,<13,5898,4077>
+,<13,4508,7089>
+,<13,7089,7091>
+,<13,4077,5899>
+,<13,5899,4508>
+,<14,6178,6181>
+,<14,6181,6183>
+,<14,6183,6180>
+,<14,6111,6112>
+,<14,6112,480>
+,<14,480,6178>
+,<14,6180,755>
+,<14,755,6110>
+,<14,6110,6111>
+,<15,287,6944>
+,<15,6944,6943>
+,<15,6943,644>
+,<15,141,201>
+,<15,201,287>
+,<15,644,642>
+,<15,642,141>
+,<16,1583,7013>
+,<16,7013,7014>
+,<16,7014,84>
+,<16,1575,7012>
+,<16,7012,7011>
+,<16,7011,1580>
+,<16,1580,1583>
+,<16,84,1603>
+,<16,1603,1575>
+,<17,6824,6836>
+,<17,6836,6825>
+,<17,2005,2382>
+,<17,2382,6824>
+,<17,6825,6823>
+,<17,6823,2005>
+,<18,1262,1270>
+,<18,1270,1263>
+,<18,74,51>
+,<18,51,1262>
+,<18,1263,95>
+,<18,95,74>
+,<19,4575,4510>
+,<19,4510,453>
+,<19,4423,4574>
+,<19,4574,4575>
+,<19,453,4752>
+,<19,4752,4753>
+,<19,4753,4423>
+,<20,1426,1469>
+,<20,1469,1427>
+,<20,472,1418>
+,<20,1418,1426>
+,<20,1427,679>
+,<20,679,472>
+,<21,680,740>
+,<21,740,132>
+,<21,472,674>
+,<21,674,680>
+,<21,132,451>
+,<21,451,472>
+,<22,704,740>
+,<22,740,82>
+,<22,74,696>
+,<22,696,704>
+,<22,82,695>
+,<22,695,74>
+,<23,875,896>
+,<23,896,410>
+,<23,347,892>
+,<23,892,875>
+,<23,410,405>
+,<23,405,347>
+,<24,6628,6635>
+,<24,6635,6629>
+,<24,4804,4795>
+,<24,4795,4809>
+,<24,4809,4521>
+,<24,4521,6628>
+,<24,6629,4743>
+,<24,4743,2171>
+,<24,2171,4810>
+,<24,4810,4798>
+,<24,4798,4804>
+,<25,4675,4709>
+,<25,4709,4678>
+,<25,4113,4674>
+,<25,4674,4675>
+,<25,4678,4483>
+,<25,4483,4113>
+,<26,1258,2340>
+,<26,2340,2288>
+,<26,1270,1559>
+,<26,1559,1258>
+,<26,2288,2286>
+,<26,2286,1270>
+,<27,6635,423>
+,<27,423,4987>
+,<27,3674,425>
+,<27,425,6635>
+,<27,4987,5977>
+,<27,5977,3674>
+,<28,5315,5373>
+,<28,5373,5316>
+,<28,2340,96>
+,<28,96,5315>
+,<28,5316,44>
+,<28,44,2340>
+,<29,2340,1231>
+,<29,1231,66>
+,<29,1279,2298>
+,<29,2298,2340>
+,<29,66,1270>
+,<29,1270,1279>
+,<30,1212,1270>
+,<30,1270,6582>
+,<30,6582,6597>
+,<30,6597,4407>
+,<30,472,1209>
+,<30,1209,1212>
+,<30,4407,6571>
+,<30,6571,472>
+,<31,1270,1212>
+,<31,1212,1209>
+,<31,381,32>
+,<31,32,1270>
+,<31,1209,472>
+,<31,472,381>
+,<32,1208,1211>
+,<32,1211,1270>
+,<32,381,472>
+,<32,472,1208>
+,<33,891,875>
+,<33,875,890>
+,<33,405,353>
+,<33,353,891>
+,<33,890,350>
+,<33,350,405>
+,<34,1509,4314>
+,<34,4314,2194>
+,<34,1470,1129>
+,<34,1129,1509>
+,<34,2194,1167>
+,<34,1167,1470>
+,<35,5371,6036>
+,<35,6036,6856>
+,<35,6856,6959>
+,<35,6959,6897>
+,<35,6897,630>
+,<35,141,627>
+,<35,627,6888>
+,<35,6888,5371>
+,<35,630,486>
+,<35,486,141>
+,<36,654,6915>
+,<36,6915,6916>
+,<36,6916,657>
+,<36,539,492>
+,<36,492,654>
+,<36,657,490>
+,<36,490,539>
+,<37,3242,261>
+,<37,261,1042>
+,<37,1597,1539>
+,<37,1539,3242>
+,<37,1042,273>
+,<37,273,1597>
+,<38,6785,6836>
+,<38,6836,6786>
+,<38,3242,1967>
+,<38,1967,6785>
+,<38,6786,1948>
+,<38,1948,3242>
+,<39,5324,6044>
+,<39,6044,5366>
+,<39,1603,669>
+,<39,669,5324>
+,<40,740,55>
+,<40,55,449>
+,<40,232,684>
+,<40,684,740>
+,<40,449,472>
+,<40,472,232>
+,<41,7003,7004>
+,<41,7004,1585>
+,<41,1585,7002>
+,<41,7002,7001>
+,<41,6923,6991>
+,<41,6991,6929>
+,<41,6929,666>
+,<41,666,7005>
+,<41,7005,7003>
+,<41,7001,1572>
+,<41,1572,6927>
+,<41,6927,6993>
+,<41,6993,6923>
+,<42,7016,7015>
+,<42,7015,7017>
+,<42,7017,7018>
+,<42,1603,60>
+,<42,60,7016>
+,<42,7018,1573>
+,<42,1573,1603>
+,<43,2336,2340>
+,<43,2340,2337>
+,<43,74,1198>
+,<43,1198,2336>
+,<43,2337,2310>
+,<43,2310,74>
+,<44,5316,5373>
+,<44,5373,1125>
+,<44,1125,2325>
+,<44,2325,2340>
+,<45,1265,1270>
+,<45,1270,1266>
+,<45,74,428>
+,<45,428,1265>
+,<45,1266,94>
+,<45,94,74>
+,<46,1518,1470>
+,<46,1470,1517>
+,<46,1203,1172>
+,<46,1172,1518>
+,<46,1517,592>
+,<46,592,1203>
+,<47,7247,7292>
+,<47,7292,7248>
+,<47,3778,1151>
+,<47,1151,7247>
+,<47,7248,3155>
+,<47,3155,3778>
+,<48,153,208>
+,<48,208,154>
+,<48,141,127>
+,<48,127,153>
+,<48,154,128>
+,<48,128,141>
+,<49,158,208>
+,<49,208,159>
+,<49,141,110>
+,<49,110,158>
+,<49,159,111>
+,<49,111,141>
+,<50,2340,2299>
+,<50,2299,1240>
+,<50,1081,1803>
+,<50,1803,2340>
+,<50,1240,1270>
+,<50,1270,1081>
+,<51,1261,1270>
+,<51,1270,1262>
+,<51,74,427>
+,<51,427,1261>
+,<52,6044,5364>
+,<52,5364,625>
+,<52,1561,6043>
+,<52,6043,6044>
+,<52,625,1603>
+,<52,1603,1561>
+,<53,7400,7426>
+,<53,7426,7399>
+,<53,3711,3671>
+,<53,3671,7400>
+,<53,7399,7360>
+,<53,7360,3711>
+,<54,682,740>
+,<54,740,683>
+,<54,472,675>
+,<54,675,682>
+,<54,683,462>
+,<54,462,472>
+,<55,740,701>
+,<55,701,699>
+,<55,699,700>
+,<55,700,444>
+,<55,444,472>
+,<55,472,449>
+,<56,6152,6153>
+,<56,6153,6091>
+,<56,6091,6090>
+,<56,6090,6089>
+,<56,6052,6085>
+,<56,6085,6083>
+,<56,6083,6050>
+,<56,6050,6092>
+,<56,6092,6152>
+,<56,6089,6087>
+,<56,6087,6052>
+,<57,2005,505>
+,<57,505,1039>
+,<57,871,1041>
+,<57,1041,2005>
+,<57,1039,6127>
+,<57,6127,6126>
+,<57,6126,871>
+,<58,1567,6838>
+,<58,6838,6840>
+,<58,6840,711>
+,<58,711,1566>
+,<58,1581,1569>
+,<58,1569,445>
+,<58,445,1567>
+,<58,1566,1603>
+,<58,1603,1581>
+,<59,631,6899>
+,<59,6899,6951>
+,<59,6951,297>
+,<59,141,76>
+,<59,76,631>
+,<59,297,634>
+,<59,634,141>
+,<60,7014,7013>
+,<60,7013,1568>
+,<60,1568,7015>
+,<60,7015,7016>
+,<60,1603,84>
+,<60,84,7014>
+,<61,2339,2340>
+,<61,2340,2277>
+,<61,74,88>
+,<61,88,2339>
+,<61,2277,372>
+,<61,372,74>
+,<62,2331,2340>
+,<62,2340,2332>
+,<62,74,2312>
+,<62,2312,2331>
+,<62,2332,2311>
+,<62,2311,74>
+,<63,6659,6702>
+,<63,6702,6662>
+,<63,405,6658>
+,<63,6658,6659>
+,<63,6662,1309>
+,<63,1309,405>
+,<64,1268,1270>
+,<64,1270,1269>
+,<64,74,389>
+,<64,389,1268>
+,<64,1269,93>
+,<64,93,74>
+,<65,2030,2072>
+,<65,2072,2029>
+,<65,606,802>
+,<65,802,2030>
+,<65,2029,1639>
+,<65,1639,606>
+,<66,1231,1281>
+,<66,1281,1739>
+,<66,1739,1242>
+,<66,1242,1270>
+,<67,6690,6702>
+,<67,6702,6689>
+,<67,3644,5662>
+,<67,5662,6690>
+,<67,6689,2483>
+,<67,2483,3644>
+,<68,6616,6635>
+,<68,6635,6617>
+,<68,4782,4826>
+,<68,4826,4815>
+,<68,4815,902>
+,<68,902,6616>
+,<68,6617,4387>
+,<68,4387,4783>
+,<68,4783,4782>
+,<69,702,740>
+,<69,740,703>
+,<69,74,397>
+,<69,397,702>
+,<69,703,697>
+,<69,697,74>
+,<70,3233,3242>
+,<70,3242,3234>
+,<70,6140,6139>
+,<70,6139,1022>
+,<70,1022,3233>
+,<70,3234,1601>
+,<70,1601,6141>
+,<70,6141,6140>
+,<71,732,740>
+,<71,740,733>
+,<71,273,716>
+,<71,716,732>
+,<71,733,717>
+,<71,717,273>
+,<72,734,740>
+,<72,740,735>
+,<72,273,717>
+,<72,717,734>
+,<72,735,718>
+,<72,718,273>
+,<73,6849,6851>
+,<73,6851,6852>
+,<73,6852,1578>
+,<73,1578,1603>
+,<73,1603,483>
+,<74,698,448>
+,<74,448,685>
+,<74,699,701>
+,<74,701,698>
+,<74,240,442>
+,<74,442,402>
+,<74,227,441>
+,<74,441,240>
+,<74,133,438>
+,<74,438,138>
+,<74,136,437>
+,<74,437,133>
+,<74,239,436>
+,<74,436,136>
+,<74,403,435>
+,<74,435,239>
+,<74,228,434>
+,<74,434,403>
+,<74,225,433>
+,<74,433,228>
+,<74,112,382>
+,<74,382,1210>
+,<74,1210,225>
+,<74,162,379>
+,<74,379,112>
+,<74,93,166>
+,<74,166,162>
+,<74,94,1267>
+,<74,1267,389>
+,<74,95,1264>
+,<74,1264,428>
+,<74,221,1260>
+,<74,1260,427>
+,<74,429,1255>
+,<74,1255,221>
+,<74,87,1256>
+,<74,1256,429>
+,<74,372,2276>
+,<74,2276,87>
+,<74,2310,2338>
+,<74,2338,88>
+,<74,89,2335>
+,<74,2335,1198>
+,<74,2309,2334>
+,<74,2334,89>
+,<74,2311,2333>
+,<74,2333,2309>
+,<74,1554,1555>
+,<74,1555,2330>
+,<74,2330,2312>
+,<74,614,1127>
+,<74,1127,1554>
+,<74,5330,5988>
+,<74,5988,5372>
+,<74,5372,614>
+,<74,1035,691>
+,<74,691,245>
+,<74,245,5330>
+,<74,690,1553>
+,<74,1553,1035>
+,<74,86,1552>
+,<74,1552,690>
+,<74,709,611>
+,<74,611,86>
+,<74,1549,1550>
+,<74,1550,709>
+,<74,238,1551>
+,<74,1551,1549>
+,<74,191,1548>
+,<74,1548,238>
+,<74,3201,713>
+,<74,713,1541>
+,<74,1541,615>
+,<74,615,191>
+,<74,613,3202>
+,<74,3202,3203>
+,<74,3203,3201>
+,<74,609,241>
+,<74,241,613>
+,<74,688,706>
+,<74,706,609>
+,<74,694,610>
+,<74,610,688>
+,<74,687,139>
+,<74,139,694>
+,<74,695,446>
+,<74,446,687>
+,<74,686,705>
+,<74,705,696>
+,<74,697,242>
+,<74,242,686>
+,<74,685,231>
+,<74,231,397>
+,<75,6620,6635>
+,<75,6635,6621>
+,<75,4820,4817>
+,<75,4817,1704>
+,<75,1704,6620>
+,<75,6621,4384>
+,<75,4384,4822>
+,<75,4822,4820>
+,<76,632,6953>
+,<76,6953,6963>
+,<76,6963,6899>
+,<76,6899,631>
+,<76,141,80>
+,<76,80,632>
+,<77,656,6917>
+,<77,6917,6984>
+,<77,6984,6934>
+,<77,6934,659>
+,<77,539,490>
+,<77,490,656>
+,<77,659,491>
+,<77,491,539>
+,<78,650,6912>
+,<78,6912,6913>
+,<78,6913,653>
+,<78,208,473>
+,<78,473,650>
+,<78,653,258>
+,<78,258,260>
+,<78,260,208>
+,<79,6877,6878>
+,<79,6878,481>
+,<79,481,6876>
+,<79,6876,6875>
+,<79,6900,6964>
+,<79,6964,6952>
+,<79,6952,6860>
+,<79,6860,6879>
+,<79,6879,6877>
+,<79,6875,6873>
+,<79,6873,188>
+,<79,188,6949>
+,<79,6949,6965>
+,<79,6965,6900>
+,<80,629,6954>
+,<80,6954,6953>
+,<80,6953,632>
+,<80,141,486>
+,<80,486,629>
+,<81,618,7021>
+,<81,7021,616>
+,<81,616,7024>
+,<81,7024,7023>
+,<81,1577,1603>
+,<81,1603,618>
+,<81,7023,445>
+,<81,445,1569>
+,<81,1569,1577>
+,<82,740,446>
+,<82,446,695>
+,<83,489,646>
+,<83,646,6907>
+,<83,6907,6908>
+,<83,6908,645>
+,<83,645,123>
+,<83,204,183>
+,<83,183,141>
+,<83,141,489>
+,<83,123,208>
+,<83,208,204>
+,<85,1586,1603>
+,<85,1603,667>
+,<85,667,3222>
+,<85,539,665>
+,<85,665,1586>
+,<85,3222,6796>
+,<85,6796,3177>
+,<85,3177,539>
+,<86,611,1603>
+,<86,1603,1552>
+,<87,2276,2340>
+,<87,2340,1256>
+,<88,2338,2340>
+,<88,2340,2339>
+,<89,2334,2340>
+,<89,2340,2335>
+,<90,1557,5373>
+,<90,5373,2305>
+,<90,2340,2322>
+,<90,2322,1557>
+,<90,2305,2315>
+,<90,2315,2340>
+,<91,1738,1804>
+,<91,1804,3161>
+,<91,3161,3167>
+,<91,1270,1242>
+,<91,1242,1738>
+,<91,3167,3168>
+,<91,3168,3166>
+,<91,3166,1270>
+,<92,1483,1470>
+,<92,1470,1311>
+,<92,1335,1482>
+,<92,1482,1483>
+,<92,1311,1342>
+,<92,1342,1335>
+,<93,1269,1270>
+,<93,1270,166>
+,<94,1266,1270>
+,<94,1270,1267>
+,<95,1263,1270>
+,<95,1270,1264>
+,<96,1239,5373>
+,<96,5373,5315>
+,<96,2340,5313>
+,<96,5313,1239>
+,<97,3912,1314>
+,<97,1314,3866>
+,<97,1910,2425>
+,<97,2425,3864>
+,<97,3864,3912>
+,<97,3866,1470>
+,<97,1470,1910>
+,<98,3059,3910>
+,<98,3910,7178>
+,<98,7178,3854>
+,<98,3058,3053>
+,<98,3053,1862>
+,<98,1862,2988>
+,<98,2988,3029>
+,<98,3029,2970>
+,<98,2970,3062>
+,<98,3062,3059>
+,<98,3854,7179>
+,<98,7179,1895>
+,<98,1895,3058>
+,<99,156,208>
+,<99,208,157>
+,<99,141,109>
+,<99,109,156>
+,<99,157,110>
+,<99,110,141>
+,<100,150,208>
+,<100,208,151>
+,<100,141,101>
+,<100,101,150>
+,<100,151,108>
+,<100,108,141>
+,<101,149,208>
+,<101,208,150>
+,<101,141,126>
+,<101,126,149>
+,<102,147,208>
+,<102,208,146>
+,<102,141,106>
+,<102,106,147>
+,<102,146,107>
+,<102,107,141>
+,<103,144,208>
+,<103,208,105>
+,<103,141,104>
+,<103,104,144>
+,<103,105,106>
+,<103,106,141>
+,<104,145,208>
+,<104,208,144>
+,<104,141,125>
+,<104,125,145>
+,<105,208,147>
+,<105,147,106>
+,<107,146,208>
+,<107,208,148>
+,<107,148,126>
+,<107,126,141>
+,<108,151,208>
+,<108,208,152>
+,<108,152,127>
+,<108,127,141>
+,<109,155,208>
+,<109,208,156>
+,<109,141,128>
+,<109,128,155>
+,<110,157,208>
+,<110,208,158>
+,<111,159,208>
+,<111,208,5368>
+,<111,5368,6013>
+,<111,6013,5980>
+,<111,5980,6014>
+,<111,6014,5327>
+,<111,5327,141>
+,<112,379,1270>
+,<112,1270,382>
+,<113,3598,4247>
+,<113,4247,3135>
+,<113,3778,2480>
+,<113,2480,3598>
+,<113,3135,4187>
+,<113,4187,3601>
+,<113,3601,3778>
+,<114,6591,6635>
+,<114,6635,6592>
+,<114,405,4398>
+,<114,4398,6591>
+,<114,6592,390>
+,<114,390,405>
+,<115,1757,2340>
+,<115,2340,2301>
+,<115,1804,1252>
+,<115,1252,1757>
+,<115,2301,430>
+,<115,430,1804>
+,<116,6005,6044>
+,<116,6044,6006>
+,<116,5373,3096>
+,<116,3096,6005>
+,<116,6006,1890>
+,<116,1890,5373>
+,<117,744,807>
+,<117,807,743>
+,<117,606,570>
+,<117,570,744>
+,<117,743,281>
+,<117,281,606>
+,<118,4865,4866>
+,<118,4866,468>
+,<118,468,4864>
+,<118,4864,4863>
+,<118,4757,4839>
+,<118,4839,4770>
+,<118,4770,4439>
+,<118,4439,4867>
+,<118,4867,4865>
+,<118,4863,4861>
+,<118,4861,4445>
+,<118,4445,4767>
+,<118,4767,4841>
+,<118,4841,4757>
+,<119,1773,1938>
+,<119,1938,525>
+,<119,208,1074>
+,<119,1074,1773>
+,<119,525,502>
+,<119,502,208>
+,<120,2005,971>
+,<120,971,6772>
+,<120,6772,504>
+,<120,533,476>
+,<120,476,2005>
+,<120,504,6130>
+,<120,6130,6129>
+,<120,6129,533>
+,<121,496,539>
+,<121,539,497>
+,<121,208,260>
+,<121,260,496>
+,<121,497,289>
+,<121,289,208>
+,<122,643,6942>
+,<122,6942,6974>
+,<122,6974,6907>
+,<122,6907,646>
+,<122,141,642>
+,<122,642,643>
+,<122,646,489>
+,<122,489,141>
+,<123,645,182>
+,<123,182,208>
+,<124,205,208>
+,<124,208,206>
+,<124,141,183>
+,<124,183,205>
+,<124,206,129>
+,<124,129,141>
+,<125,207,208>
+,<125,208,145>
+,<125,141,129>
+,<125,129,207>
+,<126,148,208>
+,<126,208,149>
+,<127,152,208>
+,<127,208,153>
+,<128,154,208>
+,<128,208,155>
+,<129,206,208>
+,<129,208,207>
+,<130,6836,6811>
+,<130,6811,1970>
+,<130,3225,6809>
+,<130,6809,6836>
+,<130,1970,2005>
+,<130,2005,3225>
+,<131,6803,6836>
+,<131,6836,6804>
+,<131,539,2344>
+,<131,2344,6803>
+,<131,6804,534>
+,<131,534,539>
+,<133,437,472>
+,<133,472,438>
+,<134,5999,6044>
+,<134,6044,6000>
+,<134,5373,5351>
+,<134,5351,5999>
+,<134,6000,1857>
+,<134,1857,5373>
+,<135,7158,7113>
+,<135,7113,4932>
+,<135,4909,7112>
+,<135,7112,7158>
+,<135,4932,5776>
+,<135,5776,4909>
+,<136,436,472>
+,<136,472,437>
+,<137,4857,4858>
+,<137,4858,4444>
+,<137,4444,4392>
+,<137,4392,4856>
+,<137,4856,4855>
+,<137,4760,4843>
+,<137,4843,4767>
+,<137,4767,4445>
+,<137,4445,4859>
+,<137,4859,4857>
+,<137,4855,465>
+,<137,465,4765>
+,<137,4765,4845>
+,<137,4845,4760>
+,<138,438,472>
+,<138,472,439>
+,<139,740,610>
+,<139,610,694>
+,<139,687,446>
+,<139,446,740>
+,<140,730,740>
+,<140,740,731>
+,<140,273,715>
+,<140,715,730>
+,<140,731,716>
+,<140,716,273>
+,<141,6854,6886>
+,<141,6886,627>
+,<141,6857,6884>
+,<141,6884,6854>
+,<141,1560,6882>
+,<141,6882,6857>
+,<141,5356,6035>
+,<141,6035,628>
+,<141,628,1560>
+,<141,623,6034>
+,<141,6034,5356>
+,<141,1888,6033>
+,<141,6033,623>
+,<141,5329,6032>
+,<141,6032,1888>
+,<141,2316,6031>
+,<141,6031,5329>
+,<141,5358,6030>
+,<141,6030,2316>
+,<141,1889,6029>
+,<141,6029,5358>
+,<141,5359,6028>
+,<141,6028,1889>
+,<141,5370,6027>
+,<141,6027,5359>
+,<141,5328,6026>
+,<141,6026,5370>
+,<141,2306,6025>
+,<141,6025,5328>
+,<141,5360,6024>
+,<141,6024,2306>
+,<141,5369,6023>
+,<141,6023,5360>
+,<141,3105,6022>
+,<141,6022,5369>
+,<141,5326,6021>
+,<141,6021,3105>
+,<141,5979,6020>
+,<141,6020,5326>
+,<141,5361,6019>
+,<141,6019,5979>
+,<141,5978,6018>
+,<141,6018,5361>
+,<141,1852,6017>
+,<141,6017,5978>
+,<141,5981,6016>
+,<141,6016,1852>
+,<141,5327,6015>
+,<141,6015,5981>
+,<141,246,640>
+,<141,640,201>
+,<141,184,641>
+,<141,641,246>
+,<141,296,638>
+,<141,638,184>
+,<141,485,639>
+,<141,639,296>
+,<141,185,487>
+,<141,487,485>
+,<141,488,637>
+,<141,637,185>
+,<141,633,636>
+,<141,636,488>
+,<141,634,635>
+,<141,635,633>
+,<142,2946,2947>
+,<142,2947,2929>
+,<142,2929,2945>
+,<142,2945,2944>
+,<142,2949,3011>
+,<142,3011,1871>
+,<142,1871,1145>
+,<142,1145,2946>
+,<142,2944,2942>
+,<142,2942,1794>
+,<142,1794,3009>
+,<142,3009,3013>
+,<142,3013,2949>
+,<143,1854,1938>
+,<143,1938,1847>
+,<143,208,294>
+,<143,294,1854>
+,<143,1847,1338>
+,<143,1338,208>
+,<160,6003,6044>
+,<160,6044,6004>
+,<160,5373,5333>
+,<160,5333,6003>
+,<160,6004,3096>
+,<160,3096,5373>
+,<161,1864,1842>
+,<161,1842,1156>
+,<161,1156,1832>
+,<161,1832,1893>
+,<161,2979,3035>
+,<161,3035,2977>
+,<161,2977,1750>
+,<161,1750,1864>
+,<161,1893,3041>
+,<161,3041,2980>
+,<161,2980,2979>
+,<162,166,1270>
+,<162,1270,379>
+,<163,896,875>
+,<163,875,897>
+,<163,405,410>
+,<163,410,896>
+,<163,897,895>
+,<163,895,405>
+,<164,1508,1238>
+,<164,1238,1470>
+,<164,1470,1307>
+,<164,1203,1645>
+,<164,1645,3843>
+,<164,3843,1508>
+,<164,1307,594>
+,<164,594,1203>
+,<165,1255,429>
+,<165,429,1256>
+,<165,1256,2340>
+,<165,2340,2280>
+,<165,1270,1260>
+,<165,1260,221>
+,<165,221,1255>
+,<165,2280,2279>
+,<165,2279,1270>
+,<167,2203,4201>
+,<167,4201,875>
+,<167,875,886>
+,<167,405,2497>
+,<167,2497,2203>
+,<167,886,421>
+,<167,421,405>
+,<168,1481,1470>
+,<168,1470,1484>
+,<168,1335,1271>
+,<168,1271,1481>
+,<168,1484,1482>
+,<168,1482,1335>
+,<169,3587,3644>
+,<169,3644,3590>
+,<169,3175,1292>
+,<169,1292,3587>
+,<169,3590,6700>
+,<169,6700,6701>
+,<169,6701,6699>
+,<169,6699,3175>
+,<170,7225,1473>
+,<170,1473,2416>
+,<170,2419,7224>
+,<170,7224,7225>
+,<170,2416,1938>
+,<170,1938,2419>
+,<171,1748,1899>
+,<171,1899,2433>
+,<171,2433,7182>
+,<171,7182,3852>
+,<171,3046,3050>
+,<171,3050,3049>
+,<171,3049,1748>
+,<171,3852,7183>
+,<171,7183,3848>
+,<171,3848,2984>
+,<171,2984,2983>
+,<171,2983,3046>
+,<172,3914,3979>
+,<172,3979,2213>
+,<172,1804,3920>
+,<172,3920,3914>
+,<172,2213,1326>
+,<172,1326,1804>
+,<173,7244,7292>
+,<173,7292,7245>
+,<173,4641,4610>
+,<173,4610,7244>
+,<173,7245,4621>
+,<173,4621,4641>
+,<174,3575,3577>
+,<174,3577,3576>
+,<174,1203,2102>
+,<174,2102,3575>
+,<174,3576,1310>
+,<174,1310,1203>
+,<175,1783,1842>
+,<175,1842,1864>
+,<175,1864,1750>
+,<175,1750,1892>
+,<175,3039,3037>
+,<175,3037,1783>
+,<175,1892,3040>
+,<175,3040,3039>
+,<176,3123,3175>
+,<176,3175,3126>
+,<176,405,1836>
+,<176,1836,3123>
+,<176,3126,2221>
+,<176,2221,405>
+,<177,4630,4641>
+,<177,4641,4629>
+,<177,3979,4591>
+,<177,4591,4630>
+,<177,4629,3925>
+,<177,3925,3979>
+,<178,3583,3644>
+,<178,3644,3143>
+,<178,3175,3581>
+,<178,3581,3583>
+,<178,3143,3145>
+,<178,3145,3175>
+,<179,2954,2955>
+,<179,2955,1812>
+,<179,1812,1808>
+,<179,1756,2935>
+,<179,2935,5320>
+,<179,5320,376>
+,<179,376,2953>
+,<179,2953,2954>
+,<179,1808,1804>
+,<179,1804,1756>
+,<180,808,2806>
+,<180,2806,2805>
+,<180,2805,823>
+,<180,539,521>
+,<180,521,808>
+,<180,823,316>
+,<180,316,539>
+,<181,6794,6836>
+,<181,6836,6795>
+,<181,1603,1949>
+,<181,1949,6794>
+,<181,6795,667>
+,<181,667,1603>
+,<182,645,6908>
+,<182,6908,6909>
+,<182,6909,307>
+,<182,307,306>
+,<182,306,208>
+,<183,204,208>
+,<183,208,205>
+,<184,638,6946>
+,<184,6946,6970>
+,<184,6970,6904>
+,<184,6904,641>
+,<185,637,6902>
+,<185,6902,6968>
+,<185,6968,6948>
+,<185,6948,487>
+,<186,539,499>
+,<186,499,850>
+,<186,850,293>
+,<186,255,474>
+,<186,474,539>
+,<186,293,208>
+,<186,208,255>
+,<187,3860,3912>
+,<187,3912,3858>
+,<187,2273,2430>
+,<187,2430,3860>
+,<187,3858,1911>
+,<187,1911,2273>
+,<188,6873,6874>
+,<188,6874,2321>
+,<188,2321,6872>
+,<188,6872,6871>
+,<188,6871,6869>
+,<188,6869,6864>
+,<188,6864,6903>
+,<188,6903,6967>
+,<188,6967,6949>
+,<189,6214,6217>
+,<189,6217,6219>
+,<189,6219,6216>
+,<189,807,1064>
+,<189,1064,6214>
+,<189,6216,1056>
+,<189,1056,807>
+,<190,6789,6836>
+,<190,6836,6790>
+,<190,1603,1959>
+,<190,1959,6789>
+,<190,6790,3221>
+,<190,3221,1603>
+,<191,615,1603>
+,<191,1603,1548>
+,<192,2374,2407>
+,<192,2407,2375>
+,<192,273,271>
+,<192,271,2374>
+,<192,2375,264>
+,<192,264,273>
+,<193,5410,6300>
+,<193,6300,5612>
+,<193,5642,1012>
+,<193,1012,5410>
+,<193,5612,1713>
+,<193,1713,5642>
+,<194,765,807>
+,<194,807,329>
+,<194,340,276>
+,<194,276,765>
+,<195,6348,6367>
+,<195,6367,6349>
+,<195,1677,5425>
+,<195,5425,6348>
+,<195,6349,1002>
+,<195,1002,1677>
+,<196,311,6125>
+,<196,6125,6124>
+,<196,6124,298>
+,<196,340,813>
+,<196,813,812>
+,<196,812,311>
+,<196,298,562>
+,<196,562,340>
+,<197,764,807>
+,<197,807,565>
+,<197,340,332>
+,<197,332,764>
+,<197,565,276>
+,<197,276,340>
+,<198,652,6937>
+,<198,6937,6936>
+,<198,6936,655>
+,<198,539,203>
+,<198,203,652>
+,<198,655,492>
+,<198,492,539>
+,<199,498,539>
+,<199,539,474>
+,<199,208,289>
+,<199,289,498>
+,<199,474,255>
+,<199,255,208>
+,<200,1584,1603>
+,<200,1603,1587>
+,<200,1587,662>
+,<200,664,6921>
+,<200,6921,6922>
+,<200,6922,244>
+,<200,244,7006>
+,<200,7006,309>
+,<200,309,1584>
+,<200,662,539>
+,<200,539,493>
+,<200,493,664>
+,<201,640,6905>
+,<201,6905,6972>
+,<201,6972,6944>
+,<201,6944,287>
+,<202,660,6931>
+,<202,6931,6930>
+,<202,6930,663>
+,<202,539,288>
+,<202,288,660>
+,<202,663,493>
+,<202,493,539>
+,<203,258,653>
+,<203,653,6913>
+,<203,6913,6980>
+,<203,6980,6937>
+,<203,6937,652>
+,<203,539,496>
+,<203,496,260>
+,<203,260,258>
+,<208,5983,6012>
+,<208,6012,5368>
+,<208,2307,6011>
+,<208,6011,5983>
+,<208,3087,3094>
+,<208,3094,1891>
+,<208,1891,2307>
+,<208,1781,3092>
+,<208,3092,3087>
+,<208,3088,3089>
+,<208,3089,1781>
+,<208,3083,1858>
+,<208,1858,3088>
+,<208,1887,3086>
+,<208,3086,3083>
+,<208,3079,1859>
+,<208,1859,1887>
+,<208,1338,1855>
+,<208,1855,3082>
+,<208,3082,3079>
+,<208,290,1853>
+,<208,1853,294>
+,<208,500,1751>
+,<208,1751,290>
+,<208,844,1840>
+,<208,1840,500>
+,<208,259,1848>
+,<208,1848,844>
+,<208,1201,1782>
+,<208,1782,259>
+,<208,501,1851>
+,<208,1851,1201>
+,<208,1849,1828>
+,<208,1828,501>
+,<208,295,1761>
+,<208,1761,1849>
+,<208,502,1850>
+,<208,1850,295>
+,<208,291,1839>
+,<208,1839,1074>
+,<208,1140,1937>
+,<208,1937,291>
+,<208,1076,1936>
+,<208,1936,1140>
+,<208,1879,1935>
+,<208,1935,1076>
+,<208,247,1934>
+,<208,1934,1879>
+,<208,1856,1933>
+,<208,1933,247>
+,<208,1762,1932>
+,<208,1932,1856>
+,<208,293,850>
+,<208,850,1931>
+,<208,1931,1762>
+,<208,494,651>
+,<208,651,473>
+,<208,647,648>
+,<208,648,494>
+,<208,306,649>
+,<208,649,647>
+,<209,728,740>
+,<209,740,729>
+,<209,273,714>
+,<209,714,728>
+,<209,729,715>
+,<209,715,273>
+,<210,3242,3191>
+,<210,3191,579>
+,<210,1547,262>
+,<210,262,3242>
+,<210,579,740>
+,<210,740,1547>
+,<211,2407,331>
+,<211,331,1702>
+,<211,4974,5000>
+,<211,5000,4985>
+,<211,4985,2407>
+,<211,1702,273>
+,<211,273,4973>
+,<211,4973,4974>
+,<212,6068,6067>
+,<212,6067,6058>
+,<212,6058,6069>
+,<212,6069,6070>
+,<212,6097,6098>
+,<212,6098,286>
+,<212,286,6057>
+,<212,6057,6068>
+,<212,6070,6055>
+,<212,6055,6096>
+,<212,6096,6097>
+,<213,2340,2291>
+,<213,2291,1248>
+,<213,1253,2287>
+,<213,2287,2340>
+,<213,1248,1270>
+,<213,1270,1253>
+,<214,1220,1270>
+,<214,1270,1341>
+,<214,1341,1278>
+,<214,405,378>
+,<214,378,1220>
+,<214,1278,3117>
+,<214,3117,3116>
+,<214,3116,405>
+,<215,875,415>
+,<215,415,894>
+,<215,895,897>
+,<215,897,875>
+,<215,894,405>
+,<215,405,895>
+,<216,2011,2009>
+,<216,2009,1183>
+,<216,1183,2071>
+,<216,2071,1617>
+,<216,2596,2595>
+,<216,2595,1623>
+,<216,1623,2011>
+,<216,1617,223>
+,<216,223,2588>
+,<216,2588,2646>
+,<216,2646,2596>
+,<217,3172,3175>
+,<217,3175,3173>
+,<217,1270,3165>
+,<217,3165,3172>
+,<217,3173,1740>
+,<217,1740,1270>
+,<218,1450,1469>
+,<218,1469,1451>
+,<218,482,736>
+,<218,736,740>
+,<218,740,452>
+,<218,452,1450>
+,<218,1451,1414>
+,<218,1414,273>
+,<218,273,482>
+,<219,1596,3376>
+,<219,3376,2853>
+,<219,340,1995>
+,<219,1995,1596>
+,<219,2853,2904>
+,<219,2904,340>
+,<220,4936,7158>
+,<220,7158,7114>
+,<220,6769,4929>
+,<220,4929,4936>
+,<220,7114,3840>
+,<220,3840,6769>
+,<222,2302,2340>
+,<222,2340,1141>
+,<222,1804,430>
+,<222,430,2302>
+,<222,1141,1241>
+,<222,1241,2326>
+,<222,2326,1804>
+,<223,1617,2071>
+,<223,2071,2660>
+,<223,2660,1613>
+,<223,1613,1118>
+,<223,1118,2587>
+,<223,2587,2588>
+,<224,1465,1469>
+,<224,1469,1466>
+,<224,273,1407>
+,<224,1407,1465>
+,<224,1466,1409>
+,<224,1409,273>
+,<225,1210,1211>
+,<225,1211,1208>
+,<225,1208,472>
+,<225,472,433>
+,<226,1456,1469>
+,<226,1469,1457>
+,<226,273,1412>
+,<226,1412,1456>
+,<226,1457,1411>
+,<226,1411,273>
+,<227,440,472>
+,<227,472,441>
+,<228,433,472>
+,<228,472,434>
+,<229,740,680>
+,<229,680,674>
+,<229,1405,1435>
+,<229,1435,401>
+,<229,401,740>
+,<229,674,472>
+,<229,472,447>
+,<229,447,1405>
+,<230,4851,4852>
+,<230,4852,4849>
+,<230,4762,4847>
+,<230,4847,4765>
+,<230,4765,465>
+,<230,465,4853>
+,<230,4853,4851>
+,<230,4849,4763>
+,<230,4763,4762>
+,<231,740,702>
+,<231,702,397>
+,<231,685,448>
+,<231,448,740>
+,<232,472,461>
+,<232,461,684>
+,<233,1424,1469>
+,<233,1469,1425>
+,<233,472,408>
+,<233,408,4554>
+,<233,4554,4421>
+,<233,4421,1424>
+,<233,1425,1418>
+,<233,1418,472>
+,<234,6626,6635>
+,<234,6635,6627>
+,<234,4808,4792>
+,<234,4792,4805>
+,<234,4805,4408>
+,<234,4408,6626>
+,<234,6627,4521>
+,<234,4521,4809>
+,<234,4809,4808>
+,<235,5927,5977>
+,<235,5977,905>
+,<235,875,3663>
+,<235,3663,5927>
+,<235,905,966>
+,<235,966,875>
+,<236,4196,4247>
+,<236,4247,2158>
+,<236,2158,6684>
+,<236,6684,6682>
+,<236,3644,3610>
+,<236,3610,4196>
+,<236,6682,1299>
+,<236,1299,3644>
+,<237,1452,1469>
+,<237,1469,1453>
+,<237,273,1414>
+,<237,1414,1452>
+,<237,1453,1413>
+,<237,1413,273>
+,<238,1548,1603>
+,<238,1603,1551>
+,<239,435,472>
+,<239,472,436>
+,<240,441,472>
+,<240,472,442>
+,<241,740,243>
+,<241,243,3202>
+,<241,3202,613>
+,<241,609,706>
+,<241,706,740>
+,<242,740,705>
+,<242,705,686>
+,<242,697,703>
+,<242,703,740>
+,<243,2378,3242>
+,<243,3242,3203>
+,<243,3203,3202>
+,<243,740,3183>
+,<243,3183,2378>
+,<244,7004,7003>
+,<244,7003,7005>
+,<244,7005,7006>
+,<244,6922,6992>
+,<244,6992,6928>
+,<244,6928,1585>
+,<244,1585,7004>
+,<245,6044,5989>
+,<245,5989,5988>
+,<245,5988,5330>
+,<246,641,6904>
+,<246,6904,6905>
+,<246,6905,640>
+,<247,1933,1938>
+,<247,1938,1934>
+,<248,257,1005>
+,<248,1005,993>
+,<248,606,989>
+,<248,989,257>
+,<248,993,558>
+,<248,558,606>
+,<249,2407,2358>
+,<249,2358,1017>
+,<249,1087,965>
+,<249,965,2407>
+,<249,1017,273>
+,<249,273,1087>
+,<250,5798,6300>
+,<250,6300,5809>
+,<250,2407,6258>
+,<250,6258,5798>
+,<250,5809,6257>
+,<250,6257,2407>
+,<251,559,807>
+,<251,807,746>
+,<251,606,281>
+,<251,281,559>
+,<251,746,564>
+,<251,564,606>
+,<252,2366,2407>
+,<252,2407,2367>
+,<252,273,1029>
+,<252,1029,2366>
+,<252,2367,263>
+,<252,263,273>
+,<253,7070,5898>
+,<253,5898,7069>
+,<253,4113,4083>
+,<253,4083,3273>
+,<253,3273,7070>
+,<253,7069,7029>
+,<253,7029,4113>
+,<254,830,2798>
+,<254,2798,2797>
+,<254,2797,831>
+,<254,539,523>
+,<254,523,830>
+,<254,831,303>
+,<254,303,539>
+,<256,6193,6192>
+,<256,6192,6194>
+,<256,6194,6195>
+,<256,340,1049>
+,<256,1049,6193>
+,<256,6195,723>
+,<256,723,340>
+,<257,989,991>
+,<257,991,1005>
+,<259,1782,1938>
+,<259,1938,1848>
+,<261,3242,1540>
+,<261,1540,1043>
+,<261,1043,273>
+,<261,273,1042>
+,<262,3188,3190>
+,<262,3190,3242>
+,<262,1547,740>
+,<262,740,3188>
+,<263,2367,2407>
+,<263,2407,2368>
+,<264,2375,2407>
+,<264,2407,1595>
+,<264,1595,1591>
+,<264,1591,1539>
+,<264,1539,1597>
+,<264,1597,273>
+,<265,3210,3242>
+,<265,3242,3211>
+,<265,1603,3199>
+,<265,3199,3210>
+,<265,3211,3198>
+,<265,3198,1603>
+,<266,763,807>
+,<266,807,328>
+,<266,340,269>
+,<266,269,763>
+,<266,328,332>
+,<266,332,340>
+,<267,4709,4643>
+,<267,4643,4099>
+,<267,4494,4685>
+,<267,4685,4709>
+,<267,4099,2072>
+,<267,2072,4494>
+,<268,1057,6230>
+,<268,6230,6233>
+,<268,6233,6232>
+,<268,6232,282>
+,<268,282,1052>
+,<268,977,334>
+,<268,334,807>
+,<268,807,1057>
+,<268,1052,1005>
+,<268,1005,978>
+,<268,978,935>
+,<268,935,977>
+,<269,762,807>
+,<269,807,763>
+,<269,340,333>
+,<269,333,762>
+,<270,1962,6836>
+,<270,6836,6827>
+,<270,2005,6823>
+,<270,6823,1962>
+,<270,6827,757>
+,<270,757,2005>
+,<271,2373,2407>
+,<271,2407,2374>
+,<271,273,1031>
+,<271,1031,2373>
+,<272,988,1005>
+,<272,1005,987>
+,<272,606,932>
+,<272,932,988>
+,<272,987,392>
+,<272,392,606>
+,<273,2356,2357>
+,<273,2357,2355>
+,<273,964,963>
+,<273,963,2356>
+,<273,1707,1016>
+,<273,1016,964>
+,<273,1702,331>
+,<273,331,1707>
+,<273,484,4713>
+,<273,4713,4999>
+,<273,4999,4973>
+,<273,4382,4880>
+,<273,4880,484>
+,<273,4435,4878>
+,<273,4878,4382>
+,<273,916,4876>
+,<273,4876,4435>
+,<273,454,399>
+,<273,399,4874>
+,<273,4874,916>
+,<273,1409,1467>
+,<273,1467,454>
+,<273,914,1464>
+,<273,1464,1407>
+,<273,1408,1463>
+,<273,1463,914>
+,<273,544,1462>
+,<273,1462,1408>
+,<273,917,1461>
+,<273,1461,544>
+,<273,1410,1460>
+,<273,1460,917>
+,<273,391,1459>
+,<273,1459,1410>
+,<273,1411,1458>
+,<273,1458,391>
+,<273,393,1455>
+,<273,1455,1412>
+,<273,1413,1454>
+,<273,1454,393>
+,<273,718,736>
+,<273,736,482>
+,<273,720,727>
+,<273,727,714>
+,<273,1543,3189>
+,<273,3189,726>
+,<273,726,720>
+,<273,1956,970>
+,<273,970,1543>
+,<273,1952,693>
+,<273,693,1956>
+,<273,1043,1540>
+,<273,1540,1952>
+,<273,1019,2372>
+,<273,2372,1031>
+,<273,1033,2371>
+,<273,2371,1019>
+,<273,277,2370>
+,<273,2370,1033>
+,<273,1020,2365>
+,<273,2365,1029>
+,<273,1028,2364>
+,<273,2364,1020>
+,<273,1030,2363>
+,<273,2363,1028>
+,<273,759,2362>
+,<273,2362,1030>
+,<273,560,2361>
+,<273,2361,759>
+,<273,1018,2360>
+,<273,2360,560>
+,<273,973,2359>
+,<273,2359,1018>
+,<273,1017,2358>
+,<273,2358,973>
+,<273,2355,965>
+,<273,965,1087>
+,<274,1687,4747>
+,<274,4747,4746>
+,<274,4802,4803>
+,<274,4803,1687>
+,<274,4746,411>
+,<274,411,4799>
+,<274,4799,4800>
+,<274,4800,4802>
+,<275,5028,5032>
+,<275,5032,5029>
+,<275,1737,4977>
+,<275,4977,5028>
+,<275,5029,908>
+,<275,908,1737>
+,<276,565,807>
+,<276,807,765>
+,<277,2369,2407>
+,<277,2407,2370>
+,<278,282,6232>
+,<278,6232,5816>
+,<278,5816,5579>
+,<278,1005,1052>
+,<278,1052,282>
+,<278,5579,979>
+,<278,979,5806>
+,<278,5806,1005>
+,<279,6171,6170>
+,<279,6170,6172>
+,<279,6172,6173>
+,<279,6115,6161>
+,<279,6161,6121>
+,<279,6121,673>
+,<279,673,6171>
+,<279,6173,1048>
+,<279,1048,6114>
+,<279,6114,6115>
+,<280,995,1005>
+,<280,1005,994>
+,<280,606,930>
+,<280,930,995>
+,<280,994,549>
+,<280,549,606>
+,<281,743,807>
+,<281,807,559>
+,<283,1676,2170>
+,<283,2170,1690>
+,<283,1690,7426>
+,<283,7426,947>
+,<283,875,885>
+,<283,885,5672>
+,<283,5672,1676>
+,<283,947,3654>
+,<283,3654,875>
+,<284,5017,5642>
+,<284,5642,5015>
+,<284,5306,2401>
+,<284,2401,5017>
+,<284,5015,956>
+,<284,956,5306>
+,<285,6834,6836>
+,<285,6836,6835>
+,<285,2005,1538>
+,<285,1538,6834>
+,<285,6835,1965>
+,<285,1965,2005>
+,<286,2395,2407>
+,<286,2407,6060>
+,<286,6060,6057>
+,<286,6098,6099>
+,<286,6099,1025>
+,<286,1025,2395>
+,<288,661,6919>
+,<288,6919,6988>
+,<288,6988,6931>
+,<288,6931,660>
+,<288,539,495>
+,<288,495,661>
+,<289,497,539>
+,<289,539,498>
+,<290,1751,1938>
+,<290,1938,1853>
+,<291,1937,1938>
+,<291,1938,1839>
+,<292,2758,2757>
+,<292,2757,818>
+,<292,818,531>
+,<292,583,299>
+,<292,299,2759>
+,<292,2759,2758>
+,<292,531,539>
+,<292,539,1599>
+,<292,1599,1977>
+,<292,1977,583>
+,<294,1853,1938>
+,<294,1938,1854>
+,<295,1850,1938>
+,<295,1938,1761>
+,<296,639,6947>
+,<296,6947,6946>
+,<296,6946,638>
+,<297,6951,6950>
+,<297,6950,635>
+,<297,635,634>
+,<298,6124,6123>
+,<298,6123,1046>
+,<298,1046,562>
+,<299,583,1977>
+,<299,1977,2005>
+,<299,2005,1978>
+,<299,1978,1940>
+,<299,1940,2760>
+,<299,2760,2759>
+,<300,832,2796>
+,<300,2796,2795>
+,<300,2795,833>
+,<300,539,303>
+,<300,303,832>
+,<300,833,524>
+,<300,524,539>
+,<301,3340,3376>
+,<301,3376,3341>
+,<301,2005,2003>
+,<301,2003,3340>
+,<301,3341,3317>
+,<301,3317,2005>
+,<302,3346,3376>
+,<302,3376,3347>
+,<302,2766,2765>
+,<302,2765,3314>
+,<302,3314,3346>
+,<302,3347,3315>
+,<302,3315,2809>
+,<302,2809,2823>
+,<302,2823,2766>
+,<303,831,2797>
+,<303,2797,2796>
+,<303,2796,832>
+,<304,3219,6836>
+,<304,6836,6791>
+,<304,1603,3221>
+,<304,3221,3219>
+,<304,6791,2381>
+,<304,2381,1603>
+,<305,6203,6202>
+,<305,6202,6204>
+,<305,6204,6205>
+,<305,807,1047>
+,<305,1047,6203>
+,<305,6205,1071>
+,<305,1071,807>
+,<306,307,6909>
+,<306,6909,6976>
+,<306,6976,6940>
+,<306,6940,649>
+,<308,6800,6836>
+,<308,6836,969>
+,<308,539,6799>
+,<308,6799,6800>
+,<308,969,3223>
+,<308,3223,539>
+,<309,7006,7005>
+,<309,7005,666>
+,<309,666,7007>
+,<309,7007,7008>
+,<309,7008,1582>
+,<309,1582,1603>
+,<309,1603,1584>
+,<310,1441,1469>
+,<310,1469,1442>
+,<310,740,455>
+,<310,455,1441>
+,<310,1442,738>
+,<310,738,740>
+,<311,812,1041>
+,<311,1041,871>
+,<311,871,6126>
+,<311,6126,6125>
+,<312,3337,3376>
+,<312,3376,3338>
+,<312,2005,880>
+,<312,880,3337>
+,<312,3338,2849>
+,<312,2849,2005>
+,<313,1650,1392>
+,<313,1392,1356>
+,<313,1356,1393>
+,<313,1393,1355>
+,<313,2732,1119>
+,<313,1119,1650>
+,<313,1355,2784>
+,<313,2784,2833>
+,<313,2833,2786>
+,<313,2786,2732>
+,<314,819,2756>
+,<314,2756,2755>
+,<314,2755,820>
+,<314,539,520>
+,<314,520,819>
+,<314,820,507>
+,<314,507,539>
+,<315,7220,7225>
+,<315,7225,7221>
+,<315,1938,2420>
+,<315,2420,7220>
+,<315,7221,2422>
+,<315,2422,1938>
+,<316,823,2805>
+,<316,2805,2804>
+,<316,2804,824>
+,<316,824,513>
+,<316,513,539>
+,<317,2750,2749>
+,<317,2749,865>
+,<317,865,2751>
+,<317,2751,2752>
+,<317,874,2815>
+,<317,2815,516>
+,<317,516,2750>
+,<317,2752,322>
+,<317,322,2777>
+,<317,2777,2775>
+,<317,2775,874>
+,<318,1925,1938>
+,<318,1938,1926>
+,<318,539,1844>
+,<318,1844,1925>
+,<318,1926,1202>
+,<318,1202,539>
+,<319,6780,6836>
+,<319,6836,6781>
+,<319,3242,1589>
+,<319,1589,6780>
+,<319,6781,810>
+,<319,810,3242>
+,<320,1332,2474>
+,<320,2474,2468>
+,<320,1402,2464>
+,<320,2464,1332>
+,<320,2468,1344>
+,<320,1344,1402>
+,<321,2740,2739>
+,<321,2739,2741>
+,<321,2741,2742>
+,<321,2814,2813>
+,<321,2813,848>
+,<321,848,2740>
+,<321,2742,868>
+,<321,868,2779>
+,<321,2779,2769>
+,<321,2769,2814>
+,<322,2752,2751>
+,<322,2751,866>
+,<322,866,2776>
+,<322,2776,2777>
+,<323,2745,2746>
+,<323,2746,864>
+,<323,864,2744>
+,<323,2744,2743>
+,<323,2770,2771>
+,<323,2771,2773>
+,<323,2773,865>
+,<323,865,2749>
+,<323,2749,2747>
+,<323,2747,2745>
+,<323,2743,2741>
+,<323,2741,2739>
+,<323,2739,2737>
+,<323,2737,2735>
+,<323,2735,517>
+,<323,517,2767>
+,<323,2767,2768>
+,<323,2768,2770>
+,<324,3354,3376>
+,<324,3376,3355>
+,<324,2915,2917>
+,<324,2917,1652>
+,<324,1652,3354>
+,<324,3355,1945>
+,<324,1945,2913>
+,<324,2913,2915>
+,<325,1636,5575>
+,<325,5575,5520>
+,<325,807,776>
+,<325,776,1636>
+,<325,5520,3404>
+,<325,3404,807>
+,<326,4886,5032>
+,<326,5032,5936>
+,<326,5936,5935>
+,<326,3711,1709>
+,<326,1709,4886>
+,<326,5935,5958>
+,<326,5958,612>
+,<326,612,3671>
+,<326,3671,3711>
+,<327,5597,5642>
+,<327,5642,5598>
+,<327,5032,5007>
+,<327,5007,5597>
+,<327,5598,3464>
+,<327,3464,5032>
+,<328,807,764>
+,<328,764,332>
+,<330,747,807>
+,<330,807,334>
+,<330,606,745>
+,<330,745,747>
+,<330,334,977>
+,<330,977,935>
+,<330,935,606>
+,<331,2407,1016>
+,<331,1016,1707>
+,<333,578,807>
+,<333,807,762>
+,<333,340,1066>
+,<333,1066,1055>
+,<333,1055,578>
+,<335,990,1005>
+,<335,1005,991>
+,<335,606,392>
+,<335,392,990>
+,<335,991,989>
+,<335,989,606>
+,<336,981,1005>
+,<336,1005,980>
+,<336,606,387>
+,<336,387,981>
+,<336,980,931>
+,<336,931,606>
+,<337,6298,6300>
+,<337,6300,6299>
+,<337,5642,5778>
+,<337,5778,6298>
+,<337,6299,975>
+,<337,975,5642>
+,<338,3711,968>
+,<338,968,958>
+,<338,3466,2168>
+,<338,2168,1693>
+,<338,1693,3711>
+,<338,958,3510>
+,<338,3510,3467>
+,<338,3467,3466>
+,<339,3597,4247>
+,<339,4247,2204>
+,<339,3644,4185>
+,<339,4185,3597>
+,<339,2204,4186>
+,<339,4186,3644>
+,<340,779,780>
+,<340,780,778>
+,<340,581,566>
+,<340,566,779>
+,<340,561,766>
+,<340,766,581>
+,<340,1072,6199>
+,<340,6199,1066>
+,<340,723,6197>
+,<340,6197,1072>
+,<340,1067,6190>
+,<340,6190,1049>
+,<340,1054,6188>
+,<340,6188,1067>
+,<340,1069,6186>
+,<340,6186,1054>
+,<340,742,672>
+,<340,672,761>
+,<340,761,6184>
+,<340,6184,1069>
+,<340,754,580>
+,<340,580,742>
+,<340,562,1046>
+,<340,1046,754>
+,<340,756,2004>
+,<340,2004,813>
+,<340,512,814>
+,<340,814,3322>
+,<340,3322,756>
+,<340,2906,1993>
+,<340,1993,512>
+,<340,2850,1994>
+,<340,1994,2906>
+,<340,2129,1997>
+,<340,1997,2850>
+,<340,2908,1537>
+,<340,1537,2129>
+,<340,2904,1996>
+,<340,1996,2908>
+,<340,2910,816>
+,<340,816,1995>
+,<340,2851,3375>
+,<340,3375,2910>
+,<340,2912,3374>
+,<340,3374,2851>
+,<340,2001,3373>
+,<340,3373,2912>
+,<340,2128,3372>
+,<340,3372,2001>
+,<340,1943,3371>
+,<340,3371,2128>
+,<340,2914,3370>
+,<340,3370,1943>
+,<340,2000,3369>
+,<340,3369,2914>
+,<340,815,3368>
+,<340,3368,2000>
+,<340,2848,3367>
+,<340,3367,815>
+,<340,2002,3366>
+,<340,3366,2848>
+,<340,3419,3994>
+,<340,3994,2002>
+,<340,3998,5542>
+,<340,5542,3419>
+,<340,3389,5541>
+,<340,5541,3998>
+,<340,3365,5540>
+,<340,5540,3389>
+,<340,3410,5539>
+,<340,5539,3365>
+,<340,3409,5538>
+,<340,5538,3410>
+,<340,2126,5537>
+,<340,5537,3409>
+,<340,860,5536>
+,<340,5536,2126>
+,<340,3402,5535>
+,<340,5535,860>
+,<340,2916,5534>
+,<340,5534,3402>
+,<340,1110,5533>
+,<340,5533,2916>
+,<340,3997,5532>
+,<340,5532,1110>
+,<340,584,3403>
+,<340,3403,5531>
+,<340,5531,3997>
+,<340,591,785>
+,<340,785,584>
+,<340,572,784>
+,<340,784,591>
+,<340,777,783>
+,<340,783,572>
+,<340,590,782>
+,<340,782,777>
+,<340,576,781>
+,<340,781,590>
+,<340,768,767>
+,<340,767,576>
+,<340,778,582>
+,<340,582,768>
+,<341,4552,4575>
+,<341,4575,4553>
+,<341,472,1423>
+,<341,1423,4552>
+,<341,4553,408>
+,<341,408,472>
+,<342,6635,6588>
+,<342,6588,6587>
+,<342,6587,4988>
+,<342,5943,6570>
+,<342,6570,6635>
+,<342,4988,875>
+,<342,875,5943>
+,<343,7426,926>
+,<343,926,3446>
+,<343,422,1691>
+,<343,1691,7426>
+,<343,3446,5709>
+,<343,5709,422>
+,<344,6601,6635>
+,<344,6635,6602>
+,<344,472,6580>
+,<344,6580,6601>
+,<344,6602,4518>
+,<344,4518,4523>
+,<344,4523,472>
+,<345,3471,3510>
+,<345,3510,3472>
+,<345,1737,3450>
+,<345,3450,3471>
+,<345,3472,3451>
+,<345,3451,1737>
+,<346,984,982>
+,<346,982,606>
+,<347,405,395>
+,<347,395,892>
+,<348,2245,2273>
+,<348,2273,2246>
+,<348,1335,1142>
+,<348,1142,2245>
+,<348,2246,1475>
+,<348,1475,1335>
+,<349,5166,3534>
+,<349,3534,5111>
+,<349,5176,5219>
+,<349,5219,3541>
+,<349,3541,5166>
+,<349,5111,1670>
+,<349,1670,5175>
+,<349,5175,5176>
+,<350,890,875>
+,<350,875,893>
+,<350,893,395>
+,<350,395,405>
+,<351,875,889>
+,<351,889,352>
+,<351,421,886>
+,<351,886,875>
+,<351,352,405>
+,<351,405,421>
+,<352,889,888>
+,<352,888,405>
+,<353,887,875>
+,<353,875,891>
+,<353,405,888>
+,<353,888,887>
+,<354,2654,2653>
+,<354,2653,1616>
+,<354,1616,2655>
+,<354,2655,2656>
+,<354,2593,2652>
+,<354,2652,2654>
+,<354,2656,1116>
+,<354,1116,2590>
+,<354,2590,2650>
+,<354,2650,2593>
+,<355,7158,7133>
+,<355,7133,7132>
+,<355,7132,4937>
+,<355,4930,1490>
+,<355,1490,7158>
+,<355,4937,6769>
+,<355,6769,4930>
+,<356,5990,6044>
+,<356,6044,5991>
+,<356,5373,5354>
+,<356,5354,5990>
+,<356,5991,5331>
+,<356,5331,5373>
+,<357,2023,2072>
+,<357,2072,2026>
+,<357,606,2022>
+,<357,2022,2023>
+,<357,2026,859>
+,<357,859,606>
+,<358,2270,3979>
+,<358,3979,3968>
+,<358,2967,2968>
+,<358,2968,3949>
+,<358,3949,2270>
+,<358,3968,3953>
+,<358,3953,2966>
+,<358,2966,2967>
+,<359,3912,3861>
+,<359,3861,1920>
+,<359,1531,1303>
+,<359,1303,1330>
+,<359,1330,3912>
+,<359,1920,1335>
+,<359,1335,1477>
+,<359,1477,2254>
+,<359,2254,1531>
+,<360,5068,5099>
+,<360,5099,5069>
+,<360,5069,3865>
+,<360,1470,3877>
+,<360,3877,5068>
+,<360,3865,1323>
+,<360,1323,1524>
+,<360,1524,1470>
+,<361,6568,6502>
+,<361,6502,3888>
+,<361,5098,5036>
+,<361,5036,6568>
+,<361,3888,5099>
+,<361,5099,5098>
+,<362,1736,5709>
+,<362,5709,2156>
+,<362,4247,3730>
+,<362,3730,1736>
+,<362,2156,2481>
+,<362,2481,3131>
+,<362,3131,4247>
+,<363,1513,1470>
+,<363,1470,1516>
+,<363,1203,1153>
+,<363,1153,1513>
+,<363,1516,1308>
+,<363,1308,1203>
+,<364,7156,7158>
+,<364,7158,7157>
+,<364,4965,4940>
+,<364,4940,7156>
+,<364,7157,5761>
+,<364,5761,4965>
+,<365,2549,2548>
+,<365,2548,1177>
+,<365,1177,2550>
+,<365,2550,2551>
+,<365,2620,2619>
+,<365,2619,1361>
+,<365,1361,2549>
+,<365,2551,368>
+,<365,368,2563>
+,<365,2563,2626>
+,<365,2626,2620>
+,<366,2556,2557>
+,<366,2557,369>
+,<366,369,2555>
+,<366,2555,2554>
+,<366,2561,2621>
+,<366,2621,2558>
+,<366,2558,2556>
+,<366,2554,1176>
+,<366,1176,2103>
+,<366,2103,2623>
+,<366,2623,2561>
+,<367,6383,6434>
+,<367,6434,6382>
+,<367,1670,4028>
+,<367,4028,6383>
+,<367,6382,1658>
+,<367,1658,1670>
+,<368,2551,2550>
+,<368,2550,2552>
+,<368,2552,2553>
+,<368,2553,1174>
+,<368,1174,2562>
+,<368,2562,2563>
+,<369,842,2624>
+,<369,2624,2562>
+,<369,2562,1174>
+,<369,1174,2555>
+,<369,2557,1175>
+,<369,1175,2560>
+,<369,2560,2622>
+,<369,2622,842>
+,<370,1389,5508>
+,<370,5508,5482>
+,<370,2139,5468>
+,<370,5468,1389>
+,<370,5482,1381>
+,<370,1381,2139>
+,<371,3828,3845>
+,<371,3845,3829>
+,<371,3577,3818>
+,<371,3818,3828>
+,<371,3829,3817>
+,<371,3817,3577>
+,<372,2277,2340>
+,<372,2340,2276>
+,<373,6611,6635>
+,<373,6635,6612>
+,<373,4575,1217>
+,<373,1217,6611>
+,<373,6612,417>
+,<373,417,4517>
+,<373,4517,4575>
+,<374,3174,3175>
+,<374,3175,3111>
+,<374,1270,1740>
+,<374,1740,3174>
+,<374,3111,3112>
+,<374,3112,1270>
+,<375,1277,3175>
+,<375,3175,3160>
+,<375,1804,1289>
+,<375,1289,1277>
+,<375,3160,1224>
+,<375,1224,1804>
+,<376,5320,5339>
+,<376,5339,5334>
+,<376,5334,2934>
+,<376,2934,2936>
+,<376,2936,2937>
+,<376,2937,2931>
+,<376,2931,3007>
+,<376,3007,3018>
+,<376,3018,2953>
+,<377,4600,4641>
+,<377,4641,4603>
+,<377,3644,3147>
+,<377,3147,4600>
+,<377,4603,3641>
+,<377,3641,3644>
+,<378,1219,1270>
+,<378,1270,1220>
+,<378,405,1149>
+,<378,1149,1219>
+,<380,4563,4575>
+,<380,4575,4564>
+,<380,1469,4429>
+,<380,4429,4563>
+,<380,4564,4395>
+,<380,4395,1469>
+,<382,1270,1211>
+,<382,1211,1210>
+,<383,3777,7292>
+,<383,7292,7280>
+,<383,2273,4595>
+,<383,4595,3777>
+,<383,7280,2486>
+,<383,2486,2273>
+,<384,5072,5099>
+,<384,5099,5071>
+,<384,1203,3879>
+,<384,3879,5072>
+,<384,5071,1527>
+,<384,1527,1203>
+,<385,3175,3168>
+,<385,3168,3167>
+,<385,3167,3161>
+,<385,1224,3160>
+,<385,3160,3175>
+,<385,3161,1804>
+,<385,1804,1224>
+,<386,3114,3175>
+,<386,3175,1221>
+,<386,1270,3112>
+,<386,3112,3114>
+,<386,1221,1137>
+,<386,1137,1270>
+,<387,978,1005>
+,<387,1005,981>
+,<387,606,935>
+,<387,935,978>
+,<388,5917,5977>
+,<388,5977,3657>
+,<388,875,5915>
+,<388,5915,5917>
+,<388,3657,1689>
+,<388,1689,875>
+,<389,1267,1270>
+,<389,1270,1268>
+,<390,6592,6635>
+,<390,6635,6593>
+,<390,6593,6583>
+,<390,6583,6584>
+,<390,6584,1207>
+,<390,1207,405>
+,<391,1458,1469>
+,<391,1469,1459>
+,<392,987,1005>
+,<392,1005,990>
+,<393,1454,1469>
+,<393,1469,1455>
+,<394,6266,6300>
+,<394,6300,6267>
+,<394,2407,6061>
+,<394,6061,6266>
+,<394,6267,5582>
+,<394,5582,2407>
+,<395,893,875>
+,<395,875,892>
+,<396,6635,4401>
+,<396,4401,4884>
+,<396,4884,4989>
+,<396,4386,423>
+,<396,423,6635>
+,<396,4989,5977>
+,<396,5977,4386>
+,<398,1444,1469>
+,<398,1469,1445>
+,<398,740,1415>
+,<398,1415,1444>
+,<398,1445,719>
+,<398,719,740>
+,<399,4436,4872>
+,<399,4872,4871>
+,<399,4871,4438>
+,<399,4438,4873>
+,<399,4873,4874>
+,<399,454,1467>
+,<399,1467,1469>
+,<399,1469,4436>
+,<400,1436,1469>
+,<400,1469,1437>
+,<400,740,401>
+,<400,401,1436>
+,<400,1437,479>
+,<400,479,740>
+,<401,1435,1469>
+,<401,1469,1436>
+,<402,442,472>
+,<402,472,443>
+,<403,434,472>
+,<403,472,435>
+,<404,1281,1231>
+,<404,1231,2340>
+,<404,2340,1802>
+,<404,1804,1739>
+,<404,1739,1281>
+,<404,1802,1247>
+,<404,1247,1804>
+,<405,2482,2199>
+,<405,2199,5664>
+,<405,5664,2497>
+,<405,4198,6663>
+,<405,6663,2482>
+,<405,3141,6664>
+,<405,6664,4198>
+,<405,1309,6661>
+,<405,6661,3141>
+,<405,3129,6660>
+,<405,6660,6658>
+,<405,1090,4199>
+,<405,4199,3129>
+,<405,2224,6656>
+,<405,6656,1090>
+,<405,6652,6657>
+,<405,6657,2224>
+,<405,6653,3599>
+,<405,3599,6652>
+,<405,6654,6655>
+,<405,6655,6653>
+,<405,2220,3595>
+,<405,3595,6654>
+,<405,3138,3596>
+,<405,3596,2220>
+,<405,2496,6651>
+,<405,6651,3138>
+,<405,946,6650>
+,<405,6650,2496>
+,<405,3594,6649>
+,<405,6649,946>
+,<405,1230,6648>
+,<405,6648,3594>
+,<405,5643,6647>
+,<405,6647,1230>
+,<405,1768,6646>
+,<405,6646,5643>
+,<405,5644,6645>
+,<405,6645,1768>
+,<405,2223,6644>
+,<405,6644,5644>
+,<405,3128,6643>
+,<405,6643,2223>
+,<405,2200,6642>
+,<405,6642,3128>
+,<405,1229,6640>
+,<405,6640,2200>
+,<405,3139,1742>
+,<405,1742,1229>
+,<405,3125,1136>
+,<405,1136,3589>
+,<405,3589,6641>
+,<405,6641,3139>
+,<405,2221,3127>
+,<405,3127,3125>
+,<405,1158,3124>
+,<405,3124,1836>
+,<405,2222,3121>
+,<405,3121,1158>
+,<405,1245,3122>
+,<405,3122,2222>
+,<405,3118,3119>
+,<405,3119,1245>
+,<405,1745,3120>
+,<405,3120,3118>
+,<405,1243,1767>
+,<405,1767,1745>
+,<405,3116,3115>
+,<405,3115,1243>
+,<405,1207,1218>
+,<405,1218,1149>
+,<405,5944,6590>
+,<405,6590,4398>
+,<405,6585,6589>
+,<405,6589,5944>
+,<405,6572,909>
+,<405,909,6585>
+,<405,6586,6569>
+,<405,6569,6572>
+,<405,898,899>
+,<405,899,6587>
+,<405,6587,6588>
+,<405,6588,6586>
+,<405,552,900>
+,<405,900,898>
+,<405,894,415>
+,<405,415,552>
+,<406,419,5953>
+,<406,5953,5977>
+,<406,5977,5954>
+,<406,5954,5937>
+,<406,3682,4895>
+,<406,4895,4898>
+,<406,4898,4897>
+,<406,4897,419>
+,<406,5937,5032>
+,<406,5032,4991>
+,<406,4991,3682>
+,<407,2285,2340>
+,<407,2340,2284>
+,<407,1270,1259>
+,<407,1259,2285>
+,<407,2284,1559>
+,<407,1559,1270>
+,<408,4553,4575>
+,<408,4575,4554>
+,<409,5977,5912>
+,<409,5912,4723>
+,<409,3664,5921>
+,<409,5921,5977>
+,<409,4723,875>
+,<409,875,3664>
+,<411,4746,4747>
+,<411,4747,976>
+,<411,976,4745>
+,<411,4745,4744>
+,<411,4744,4742>
+,<411,4742,3680>
+,<411,3680,4796>
+,<411,4796,4797>
+,<411,4797,4799>
+,<412,6769,6737>
+,<412,6737,2524>
+,<412,5751,6733>
+,<412,6733,6769>
+,<412,2524,4170>
+,<412,4170,2541>
+,<412,2541,5751>
+,<413,5746,5776>
+,<413,5776,4218>
+,<413,2541,5743>
+,<413,5743,5746>
+,<413,4218,4209>
+,<413,4209,2541>
+,<414,7385,7426>
+,<414,7426,5671>
+,<414,5977,7386>
+,<414,7386,7385>
+,<414,5671,7365>
+,<414,7365,5977>
+,<415,875,900>
+,<415,900,552>
+,<416,5925,5977>
+,<416,5977,4727>
+,<416,875,1696>
+,<416,1696,5925>
+,<416,4727,4718>
+,<416,4718,875>
+,<417,6612,6635>
+,<417,6635,6613>
+,<417,6613,4406>
+,<417,4406,4780>
+,<417,4780,4779>
+,<417,4779,4412>
+,<417,4412,4517>
+,<418,4575,4411>
+,<418,4411,903>
+,<418,4413,4516>
+,<418,4516,4575>
+,<418,903,4778>
+,<418,4778,4830>
+,<418,4830,4811>
+,<418,4811,4413>
+,<419,4897,4710>
+,<419,4710,3675>
+,<419,3675,5953>
+,<420,3695,3711>
+,<420,3711,3696>
+,<420,1737,3648>
+,<420,3648,3695>
+,<420,3696,3461>
+,<420,3461,1737>
+,<422,5709,5677>
+,<422,5677,5646>
+,<422,5646,5933>
+,<422,5933,1691>
+,<423,4386,5977>
+,<423,5977,4987>
+,<424,6599,6635>
+,<424,6635,6600>
+,<424,472,6581>
+,<424,6581,6599>
+,<424,6600,6580>
+,<424,6580,472>
+,<425,904,4529>
+,<425,4529,6635>
+,<425,3674,5977>
+,<425,5977,904>
+,<426,2943,2942>
+,<426,2942,2944>
+,<426,2944,2945>
+,<426,2950,2951>
+,<426,2951,2928>
+,<426,2928,2943>
+,<426,2945,2929>
+,<426,2929,3010>
+,<426,3010,3014>
+,<426,3014,2950>
+,<427,1260,1270>
+,<427,1270,1261>
+,<428,1264,1270>
+,<428,1270,1265>
+,<430,2301,2340>
+,<430,2340,2302>
+,<431,5373,1557>
+,<431,1557,2322>
+,<431,1558,1555>
+,<431,1555,1554>
+,<431,1554,1127>
+,<431,1127,5373>
+,<431,2322,2340>
+,<431,2340,1558>
+,<432,1758,3000>
+,<432,3000,2999>
+,<432,2999,1788>
+,<432,1804,1789>
+,<432,1789,1758>
+,<432,1788,1759>
+,<432,1759,1804>
+,<445,7023,7024>
+,<445,7024,6914>
+,<445,6914,6979>
+,<445,6979,6938>
+,<445,6938,6838>
+,<445,6838,1567>
+,<447,1434,1469>
+,<447,1469,1435>
+,<447,1435,1405>
+,<447,472,1417>
+,<447,1417,1434>
+,<448,698,701>
+,<448,701,740>
+,<450,740,684>
+,<450,684,461>
+,<450,462,683>
+,<450,683,740>
+,<450,461,472>
+,<450,472,462>
+,<452,1449,1469>
+,<452,1469,1450>
+,<452,740,456>
+,<452,456,1449>
+,<453,4510,4415>
+,<453,4415,4751>
+,<453,4751,4752>
+,<455,1440,1469>
+,<455,1469,1441>
+,<455,740,1416>
+,<455,1416,1440>
+,<456,1448,1469>
+,<456,1469,1449>
+,<456,740,676>
+,<456,676,1448>
+,<457,1432,1469>
+,<457,1469,1433>
+,<457,472,459>
+,<457,459,1432>
+,<457,1433,1417>
+,<457,1417,472>
+,<458,6605,6635>
+,<458,6635,6606>
+,<458,4575,6578>
+,<458,6578,6605>
+,<458,6606,6577>
+,<458,6577,4575>
+,<459,1431,1469>
+,<459,1469,1432>
+,<459,472,678>
+,<459,678,1431>
+,<460,681,675>
+,<460,675,472>
+,<463,1429,1469>
+,<463,1469,1430>
+,<463,472,677>
+,<463,677,1429>
+,<463,1430,678>
+,<463,678,472>
+,<464,4548,4575>
+,<464,4575,4549>
+,<464,472,471>
+,<464,471,4548>
+,<464,4549,1422>
+,<464,1422,472>
+,<465,4855,4856>
+,<465,4856,4391>
+,<465,4391,4854>
+,<465,4854,4853>
+,<466,3705,3711>
+,<466,3711,3706>
+,<466,1737,3460>
+,<466,3460,3705>
+,<466,3706,1671>
+,<466,1671,1737>
+,<467,7416,7426>
+,<467,7426,7419>
+,<467,3711,7417>
+,<467,7417,7416>
+,<467,7419,5969>
+,<467,5969,3711>
+,<468,1469,4431>
+,<468,4431,4864>
+,<468,4866,4394>
+,<468,4394,1469>
+,<469,4852,4851>
+,<469,4851,4853>
+,<469,4853,4854>
+,<469,4764,4763>
+,<469,4763,4849>
+,<469,4849,4852>
+,<469,4854,4391>
+,<469,4391,4761>
+,<469,4761,4848>
+,<469,4848,4764>
+,<470,4561,4575>
+,<470,4575,4562>
+,<470,1469,4428>
+,<470,4428,4561>
+,<470,4562,4429>
+,<470,4429,1469>
+,<471,4547,4575>
+,<471,4575,4548>
+,<471,472,1403>
+,<471,1403,4547>
+,<472,4419,4546>
+,<472,4546,1403>
+,<472,1420,4545>
+,<472,4545,4419>
+,<472,4418,4544>
+,<472,4544,1420>
+,<472,4388,4543>
+,<472,4543,4418>
+,<472,913,4542>
+,<472,4542,4388>
+,<472,4525,4541>
+,<472,4541,913>
+,<472,4520,4540>
+,<472,4540,4525>
+,<472,4405,4539>
+,<472,4539,4520>
+,<472,4417,4538>
+,<472,4538,4405>
+,<472,4524,4537>
+,<472,4537,4417>
+,<472,1206,4536>
+,<472,4536,4524>
+,<472,4400,4535>
+,<472,4535,1206>
+,<472,4527,4534>
+,<472,4534,4400>
+,<472,4523,4533>
+,<472,4533,4527>
+,<472,6571,6598>
+,<472,6598,6581>
+,<472,679,1428>
+,<472,1428,677>
+,<472,1406,4551>
+,<472,4551,1423>
+,<472,1422,4550>
+,<472,4550,1406>
+,<473,651,6911>
+,<473,6911,6912>
+,<473,6912,650>
+,<475,5807,1068>
+,<475,1068,6166>
+,<475,6166,6167>
+,<475,6119,6163>
+,<475,6163,6117>
+,<475,6117,6165>
+,<475,6165,5807>
+,<475,6167,670>
+,<475,670,6120>
+,<475,6120,6119>
+,<476,872,505>
+,<476,505,2005>
+,<476,533,6129>
+,<476,6129,6128>
+,<476,6128,872>
+,<477,6843,6846>
+,<477,6846,6845>
+,<477,6845,6039>
+,<477,6039,753>
+,<477,1603,3103>
+,<477,3103,6843>
+,<477,753,6839>
+,<477,6839,1603>
+,<478,6210,6213>
+,<478,6213,6215>
+,<478,6215,6212>
+,<478,807,1050>
+,<478,1050,6210>
+,<478,6212,1064>
+,<478,1064,807>
+,<479,1437,1469>
+,<479,1469,1438>
+,<479,1438,739>
+,<479,739,740>
+,<480,6176,6179>
+,<480,6179,6181>
+,<480,6181,6178>
+,<480,6112,6113>
+,<480,6113,1053>
+,<480,1053,6176>
+,<481,6044,6862>
+,<481,6862,6876>
+,<481,6878,6859>
+,<481,6859,6044>
+,<484,4880,4879>
+,<484,4879,4881>
+,<484,4881,3684>
+,<484,3684,4713>
+,<485,487,6948>
+,<485,6948,6947>
+,<485,6947,639>
+,<486,630,6897>
+,<486,6897,6961>
+,<486,6961,6954>
+,<486,6954,629>
+,<488,636,6901>
+,<488,6901,6902>
+,<488,6902,637>
+,<490,657,6916>
+,<490,6916,6917>
+,<490,6917,656>
+,<491,659,6934>
+,<491,6934,6933>
+,<491,6933,658>
+,<491,658,495>
+,<491,495,539>
+,<492,655,6936>
+,<492,6936,6982>
+,<492,6982,6915>
+,<492,6915,654>
+,<493,663,6930>
+,<493,6930,6990>
+,<493,6990,6921>
+,<493,6921,664>
+,<494,648,6939>
+,<494,6939,6978>
+,<494,6978,6911>
+,<494,6911,651>
+,<495,658,6933>
+,<495,6933,6986>
+,<495,6986,6919>
+,<495,6919,661>
+,<499,1930,1938>
+,<499,1938,1931>
+,<499,1931,850>
+,<499,539,1880>
+,<499,1880,1930>
+,<500,1840,1938>
+,<500,1938,1751>
+,<501,1828,1938>
+,<501,1938,1851>
+,<502,525,1938>
+,<502,1938,1850>
+,<503,828,2800>
+,<503,2800,2799>
+,<503,2799,829>
+,<503,539,508>
+,<503,508,828>
+,<503,829,523>
+,<503,523,539>
+,<504,6772,6773>
+,<504,6773,6131>
+,<504,6131,6130>
+,<505,872,6128>
+,<505,6128,6127>
+,<505,6127,1039>
+,<506,3352,3376>
+,<506,3376,3353>
+,<506,2919,2918>
+,<506,2918,1986>
+,<506,1986,3352>
+,<506,3353,1652>
+,<506,1652,2917>
+,<506,2917,2919>
+,<507,820,2755>
+,<507,2755,2754>
+,<507,2754,821>
+,<507,821,530>
+,<507,530,539>
+,<508,827,2801>
+,<508,2801,2800>
+,<508,2800,828>
+,<508,539,529>
+,<508,529,827>
+,<509,835,2793>
+,<509,2793,2827>
+,<509,2827,2817>
+,<509,2817,1077>
+,<509,1077,1883>
+,<509,539,528>
+,<509,528,835>
+,<509,1883,1882>
+,<509,1882,539>
+,<510,3350,3376>
+,<510,3376,3351>
+,<510,2733,517>
+,<510,517,2735>
+,<510,2735,2736>
+,<510,2736,3313>
+,<510,3313,3350>
+,<510,3351,1986>
+,<510,1986,2918>
+,<510,2918,2733>
+,<511,3326,3376>
+,<511,3376,3327>
+,<511,2005,1984>
+,<511,1984,3326>
+,<511,3327,1947>
+,<511,1947,2005>
+,<512,1993,3376>
+,<512,3376,814>
+,<513,824,2804>
+,<513,2804,2803>
+,<513,2803,825>
+,<513,825,522>
+,<513,522,539>
+,<514,2073,5508>
+,<514,5508,5460>
+,<514,1402,2869>
+,<514,2869,2073>
+,<514,5460,2134>
+,<514,2134,1402>
+,<515,2091,2836>
+,<515,2836,2731>
+,<515,2731,1397>
+,<515,2791,2790>
+,<515,2790,1946>
+,<515,1946,2091>
+,<515,1397,1124>
+,<515,1124,2781>
+,<515,2781,2829>
+,<515,2829,2791>
+,<516,2748,2747>
+,<516,2747,2749>
+,<516,2749,2750>
+,<516,2815,2772>
+,<516,2772,2816>
+,<516,2816,867>
+,<516,867,2748>
+,<517,2733,2918>
+,<517,2918,2919>
+,<517,2919,2917>
+,<517,2917,2915>
+,<517,2915,2913>
+,<517,2913,2911>
+,<517,2911,2909>
+,<517,2909,2907>
+,<517,2907,2905>
+,<517,2905,2903>
+,<517,2903,2900>
+,<517,2900,2855>
+,<517,2855,2808>
+,<517,2808,2822>
+,<517,2822,2767>
+,<518,6364,5898>
+,<518,5898,6365>
+,<518,4508,5909>
+,<518,5909,6364>
+,<518,6365,1115>
+,<518,1115,4508>
+,<519,3443,1106>
+,<519,1106,2086>
+,<519,797,1625>
+,<519,1625,3443>
+,<519,2086,2072>
+,<519,2072,797>
+,<520,818,2757>
+,<520,2757,2756>
+,<520,2756,819>
+,<520,539,531>
+,<520,531,818>
+,<521,822,2807>
+,<521,2807,2806>
+,<521,2806,808>
+,<521,539,530>
+,<521,530,822>
+,<522,825,2803>
+,<522,2803,2802>
+,<522,2802,826>
+,<522,826,529>
+,<522,529,539>
+,<523,829,2799>
+,<523,2799,2798>
+,<523,2798,830>
+,<524,833,2795>
+,<524,2795,2794>
+,<524,2794,834>
+,<524,834,528>
+,<524,528,539>
+,<526,5454,5508>
+,<526,5508,5455>
+,<526,1402,4021>
+,<526,4021,5454>
+,<526,5455,4346>
+,<526,4346,1402>
+,<527,1327,7225>
+,<527,7225,3052>
+,<527,1938,1831>
+,<527,1831,1327>
+,<527,3052,1909>
+,<527,1909,1938>
+,<528,834,2794>
+,<528,2794,2793>
+,<528,2793,835>
+,<529,826,2802>
+,<529,2802,2801>
+,<529,2801,827>
+,<530,821,2754>
+,<530,2754,2825>
+,<530,2825,2807>
+,<530,2807,822>
+,<532,1034,3242>
+,<532,3242,1542>
+,<532,2407,1955>
+,<532,1955,1034>
+,<532,1542,1953>
+,<532,1953,2407>
+,<534,6804,6836>
+,<534,6836,6805>
+,<534,6805,3224>
+,<534,3224,539>
+,<535,5574,5575>
+,<535,5575,3407>
+,<535,3443,3996>
+,<535,3996,5574>
+,<535,3407,3426>
+,<535,3426,3443>
+,<536,1979,2005>
+,<536,2005,1980>
+,<536,2761,2760>
+,<536,2760,1940>
+,<536,1940,1979>
+,<536,1980,1939>
+,<536,1939,2762>
+,<536,2762,2761>
+,<537,1975,2005>
+,<537,2005,1976>
+,<537,539,1593>
+,<537,1593,1975>
+,<537,1976,1599>
+,<537,1599,539>
+,<538,6819,6836>
+,<538,6836,6822>
+,<538,2005,1592>
+,<538,1592,6819>
+,<538,6822,1961>
+,<538,1961,2005>
+,<539,3224,6806>
+,<539,6806,1969>
+,<539,3223,6802>
+,<539,6802,2344>
+,<539,3228,6801>
+,<539,6801,6799>
+,<539,2379,6798>
+,<539,6798,3228>
+,<539,3177,6797>
+,<539,6797,2379>
+,<539,662,1587>
+,<539,1587,665>
+,<539,942,1929>
+,<539,1929,1880>
+,<539,1881,1928>
+,<539,1928,942>
+,<539,1202,1927>
+,<539,1927,1881>
+,<539,1882,1924>
+,<539,1924,1844>
+,<539,1045,1974>
+,<539,1974,1593>
+,<539,6808,1044>
+,<539,1044,1973>
+,<539,1973,1045>
+,<539,1021,6810>
+,<539,6810,6808>
+,<539,1969,6807>
+,<539,6807,1021>
+,<540,5264,5306>
+,<540,5306,5265>
+,<540,1737,3487>
+,<540,3487,5264>
+,<540,5265,2177>
+,<540,2177,1737>
+,<541,5977,918>
+,<541,918,3662>
+,<541,4729,4716>
+,<541,4716,5977>
+,<541,3662,875>
+,<541,875,4729>
+,<542,2057,2072>
+,<542,2072,2060>
+,<542,1670,798>
+,<542,798,2057>
+,<542,2060,587>
+,<542,587,1670>
+,<543,6434,3535>
+,<543,3535,6373>
+,<543,5145,2119>
+,<543,2119,6434>
+,<543,6373,5166>
+,<543,5166,5145>
+,<544,1461,1469>
+,<544,1469,1462>
+,<545,7421,7426>
+,<545,7426,7420>
+,<545,7420,7361>
+,<545,7361,5970>
+,<545,3711,547>
+,<545,547,7421>
+,<545,5970,1692>
+,<545,1692,949>
+,<545,949,3711>
+,<546,3510,2166>
+,<546,2166,3270>
+,<546,1726,2165>
+,<546,2165,3510>
+,<546,3270,2206>
+,<546,2206,1726>
+,<547,7418,7426>
+,<547,7426,7421>
+,<547,3711,5969>
+,<547,5969,7418>
+,<548,4969,5032>
+,<548,5032,4896>
+,<548,3711,1710>
+,<548,1710,4969>
+,<548,4896,1095>
+,<548,1095,3711>
+,<549,994,1005>
+,<549,1005,997>
+,<549,997,752>
+,<549,752,606>
+,<550,5026,5032>
+,<550,5032,5027>
+,<550,1737,4976>
+,<550,4976,5026>
+,<550,5027,4977>
+,<550,4977,1737>
+,<551,5032,4893>
+,<551,4893,1700>
+,<551,599,4433>
+,<551,4433,5032>
+,<551,1700,3711>
+,<551,3711,599>
+,<553,7405,7426>
+,<553,7426,7404>
+,<553,3711,4737>
+,<553,4737,7405>
+,<553,7404,5959>
+,<553,5959,3711>
+,<554,4575,4509>
+,<554,4509,4426>
+,<554,4415,4510>
+,<554,4510,4575>
+,<554,4426,4774>
+,<554,4774,4834>
+,<554,4834,4751>
+,<554,4751,4415>
+,<555,3462,5642>
+,<555,5642,5016>
+,<555,5016,5414>
+,<555,5376,2402>
+,<555,2402,3462>
+,<555,5414,1721>
+,<555,1721,5407>
+,<555,5407,5376>
+,<556,4879,4880>
+,<556,4880,4382>
+,<556,4382,4878>
+,<556,4878,4877>
+,<556,4773,4833>
+,<556,4833,4750>
+,<556,4750,967>
+,<556,967,4883>
+,<556,4883,4881>
+,<556,4881,4879>
+,<556,4877,4875>
+,<556,4875,4873>
+,<556,4873,4438>
+,<556,4438,4754>
+,<556,4754,4835>
+,<556,4835,4773>
+,<557,986,1005>
+,<557,1005,985>
+,<557,606,922>
+,<557,922,986>
+,<557,985,932>
+,<557,932,606>
+,<558,993,1005>
+,<558,1005,992>
+,<558,992,930>
+,<558,930,606>
+,<560,2360,2407>
+,<560,2407,2361>
+,<561,577,807>
+,<561,807,766>
+,<563,5309,5373>
+,<563,5373,2933>
+,<563,2340,1250>
+,<563,1250,5309>
+,<563,2933,2324>
+,<563,2324,2340>
+,<564,746,807>
+,<564,807,748>
+,<564,748,745>
+,<564,745,606>
+,<566,807,780>
+,<566,780,779>
+,<566,581,766>
+,<566,766,807>
+,<567,6501,6498>
+,<567,6498,1363>
+,<567,6492,3520>
+,<567,3520,6501>
+,<567,1363,3845>
+,<567,3845,6492>
+,<568,4155,4180>
+,<568,4180,4158>
+,<568,3309,3262>
+,<568,3262,4155>
+,<568,4158,1301>
+,<568,1301,3309>
+,<569,5575,2089>
+,<569,2089,2122>
+,<569,1111,3406>
+,<569,3406,5575>
+,<569,2122,3443>
+,<569,3443,1111>
+,<570,806,807>
+,<570,807,744>
+,<570,606,589>
+,<570,589,806>
+,<571,5521,5575>
+,<571,5575,5522>
+,<571,807,3404>
+,<571,3404,5521>
+,<571,5522,2039>
+,<571,2039,807>
+,<572,783,807>
+,<572,807,784>
+,<573,804,807>
+,<573,807,805>
+,<573,606,774>
+,<573,774,804>
+,<573,805,589>
+,<573,589,606>
+,<574,3434,3443>
+,<574,3443,3435>
+,<574,1670,3382>
+,<574,3382,3434>
+,<574,3435,3361>
+,<574,3361,1670>
+,<575,2092,5546>
+,<575,5546,5575>
+,<575,5575,5547>
+,<575,4046,4007>
+,<575,4007,4324>
+,<575,4324,2092>
+,<575,5547,1105>
+,<575,1105,4046>
+,<576,767,807>
+,<576,807,781>
+,<578,1055,1051>
+,<578,1051,807>
+,<579,3191,722>
+,<579,722,740>
+,<580,6108,6109>
+,<580,6109,672>
+,<580,672,742>
+,<580,754,1046>
+,<580,1046,6123>
+,<580,6123,6159>
+,<580,6159,6108>
+,<582,807,767>
+,<582,767,768>
+,<582,778,780>
+,<582,780,807>
+,<584,785,807>
+,<584,807,3390>
+,<584,3390,3403>
+,<585,5567,5575>
+,<585,5575,5568>
+,<585,3443,2047>
+,<585,2047,5567>
+,<585,5568,2132>
+,<585,2132,3443>
+,<586,4333,4381>
+,<586,4381,4334>
+,<586,2896,2898>
+,<586,2898,4005>
+,<586,4005,4333>
+,<586,4334,2873>
+,<586,2873,2894>
+,<586,2894,2896>
+,<587,2060,2072>
+,<587,2072,2059>
+,<587,2059,1108>
+,<587,1108,1670>
+,<588,2036,3395>
+,<588,3395,3396>
+,<588,3396,3394>
+,<588,3394,807>
+,<588,807,803>
+,<588,606,1006>
+,<588,1006,2038>
+,<588,2038,2036>
+,<588,803,774>
+,<588,774,606>
+,<589,805,807>
+,<589,807,806>
+,<590,781,807>
+,<590,807,782>
+,<591,784,807>
+,<591,807,785>
+,<592,1517,1470>
+,<592,1470,1520>
+,<592,1520,1305>
+,<592,1305,1203>
+,<593,3977,3979>
+,<593,3979,3978>
+,<593,1804,1232>
+,<593,1232,3977>
+,<593,3978,1786>
+,<593,1786,1804>
+,<594,1307,1470>
+,<594,1470,1512>
+,<594,1512,1510>
+,<594,1510,1203>
+,<595,7426,7398>
+,<595,7398,7363>
+,<595,3733,7394>
+,<595,7394,7426>
+,<595,7363,5977>
+,<595,5977,3733>
+,<596,2476,4180>
+,<596,4180,4150>
+,<596,4150,3457>
+,<596,3503,3456>
+,<596,3456,2206>
+,<596,2206,3253>
+,<596,3253,2476>
+,<596,3457,3510>
+,<596,3510,3503>
+,<597,3479,3510>
+,<597,3510,3480>
+,<597,1737,1681>
+,<597,1681,3479>
+,<597,3480,1725>
+,<597,1725,1737>
+,<598,3436,3443>
+,<598,3443,3437>
+,<598,1670,3361>
+,<598,3361,3436>
+,<598,3437,3381>
+,<598,3381,1670>
+,<599,3711,1014>
+,<599,1014,4433>
+,<600,5602,5642>
+,<600,5642,5603>
+,<600,5032,5013>
+,<600,5013,5602>
+,<600,5603,2349>
+,<600,2349,5032>
+,<601,933,4113>
+,<601,4113,4091>
+,<601,2072,2670>
+,<601,2670,933>
+,<601,4091,2672>
+,<601,2672,2072>
+,<602,4180,4135>
+,<602,4135,2195>
+,<602,1300,4131>
+,<602,4131,4180>
+,<602,2195,2206>
+,<602,2206,1300>
+,<603,3807,3845>
+,<603,3845,3540>
+,<603,2566,2630>
+,<603,2630,2617>
+,<603,2617,1304>
+,<603,1304,3807>
+,<603,3540,2082>
+,<603,2082,1173>
+,<603,1173,2565>
+,<603,2565,2566>
+,<604,5207,5233>
+,<604,5233,5208>
+,<604,1670,2686>
+,<604,2686,5207>
+,<604,5208,5171>
+,<604,5171,1670>
+,<605,5229,5233>
+,<605,5233,5230>
+,<605,5230,3819>
+,<605,3819,2684>
+,<605,3577,3825>
+,<605,3825,5229>
+,<605,2684,3818>
+,<605,3818,3577>
+,<606,4081,4082>
+,<606,4082,2190>
+,<606,5895,3273>
+,<606,3273,4083>
+,<606,4083,4081>
+,<606,7066,7067>
+,<606,7067,5895>
+,<606,2188,7031>
+,<606,7031,7068>
+,<606,7068,7066>
+,<606,5865,5893>
+,<606,5893,2188>
+,<606,5889,5890>
+,<606,5890,5865>
+,<606,1614,5891>
+,<606,5891,5889>
+,<606,5859,4075>
+,<606,4075,1614>
+,<606,3279,5887>
+,<606,5887,5859>
+,<606,5415,5888>
+,<606,5888,3279>
+,<606,749,999>
+,<606,999,4072>
+,<606,4072,5885>
+,<606,5885,5415>
+,<606,752,996>
+,<606,996,749>
+,<606,982,983>
+,<606,983,922>
+,<606,1626,1384>
+,<606,1384,1006>
+,<606,1387,2034>
+,<606,2034,1626>
+,<606,1113,2035>
+,<606,2035,1387>
+,<606,2031,2032>
+,<606,2032,1113>
+,<606,1362,2033>
+,<606,2033,2031>
+,<606,1639,1635>
+,<606,1635,1362>
+,<606,1634,2027>
+,<606,2027,802>
+,<606,1109,2028>
+,<606,2028,1634>
+,<606,859,2025>
+,<606,2025,1109>
+,<606,1112,2024>
+,<606,2024,2022>
+,<606,1627,1633>
+,<606,1633,1112>
+,<606,1114,2020>
+,<606,2020,1627>
+,<606,801,2021>
+,<606,2021,1114>
+,<606,1632,2018>
+,<606,2018,801>
+,<606,1190,2019>
+,<606,2019,1632>
+,<606,2016,2015>
+,<606,2015,1190>
+,<606,1086,2674>
+,<606,2674,2017>
+,<606,2017,2016>
+,<606,2190,4085>
+,<606,4085,1086>
+,<607,721,3237>
+,<607,3237,3242>
+,<607,3242,3238>
+,<607,2384,2343>
+,<607,2343,6145>
+,<607,6145,6144>
+,<607,6144,721>
+,<607,3238,1600>
+,<607,1600,2407>
+,<607,2407,2384>
+,<608,6956,6957>
+,<608,6957,6895>
+,<608,6895,6894>
+,<608,6894,6893>
+,<608,624,6889>
+,<608,6889,6858>
+,<608,6858,6896>
+,<608,6896,6956>
+,<608,6893,6891>
+,<608,6891,624>
+,<610,740,706>
+,<610,706,688>
+,<611,709,1550>
+,<611,1550,1603>
+,<612,7397,7426>
+,<612,7426,7400>
+,<612,7400,3671>
+,<612,5958,5977>
+,<612,5977,7396>
+,<612,7396,7397>
+,<614,5372,5373>
+,<614,5373,1127>
+,<615,1541,1545>
+,<615,1545,1603>
+,<616,7022,7020>
+,<616,7020,6935>
+,<616,6935,6981>
+,<616,6981,6914>
+,<616,6914,7024>
+,<616,7021,617>
+,<616,617,7019>
+,<616,7019,7022>
+,<617,1603,1573>
+,<617,1573,7019>
+,<617,7021,618>
+,<617,618,1603>
+,<619,7010,7009>
+,<619,7009,7011>
+,<619,7011,7012>
+,<619,1603,1571>
+,<619,1571,7010>
+,<619,7012,1575>
+,<619,1575,1603>
+,<620,3242,668>
+,<620,668,811>
+,<620,1953,1542>
+,<620,1542,3242>
+,<620,811,2407>
+,<620,2407,1953>
+,<621,1556,6865>
+,<621,6865,6863>
+,<621,6863,1579>
+,<621,6042,6945>
+,<621,6945,6969>
+,<621,6969,6903>
+,<621,6903,6864>
+,<621,6864,6867>
+,<621,6867,1556>
+,<621,1579,6850>
+,<621,6850,6852>
+,<621,6852,6851>
+,<621,6851,6042>
+,<622,5365,6044>
+,<622,6044,5323>
+,<622,1603,1032>
+,<622,1032,5365>
+,<622,5323,669>
+,<622,669,1603>
+,<623,6033,6044>
+,<623,6044,6034>
+,<624,6891,6892>
+,<624,6892,6855>
+,<624,6855,6890>
+,<624,6890,6889>
+,<625,5364,1032>
+,<625,1032,1603>
+,<626,6883,6884>
+,<626,6884,6857>
+,<626,6857,6882>
+,<626,6882,6881>
+,<626,6898,6960>
+,<626,6960,6955>
+,<626,6955,6853>
+,<626,6853,6885>
+,<626,6885,6883>
+,<626,6881,6860>
+,<626,6860,6952>
+,<626,6952,6962>
+,<626,6962,6898>
+,<627,6886,6885>
+,<627,6885,6853>
+,<627,6853,6887>
+,<627,6887,6888>
+,<628,6880,6879>
+,<628,6879,6860>
+,<628,6860,6881>
+,<628,6881,6882>
+,<628,6882,1560>
+,<628,6035,6044>
+,<628,6044,6859>
+,<628,6859,6880>
+,<633,635,6950>
+,<633,6950,6966>
+,<633,6966,6901>
+,<633,6901,636>
+,<642,644,6943>
+,<642,6943,6942>
+,<642,6942,643>
+,<647,649,6940>
+,<647,6940,6939>
+,<647,6939,648>
+,<665,1587,1603>
+,<665,1603,1586>
+,<666,6929,6989>
+,<666,6989,6920>
+,<666,6920,1570>
+,<666,1570,7007>
+,<667,6795,6836>
+,<667,6836,6796>
+,<667,6796,3222>
+,<668,3242,1539>
+,<668,1539,1591>
+,<668,1591,1595>
+,<668,1595,2407>
+,<668,2407,811>
+,<669,5323,6044>
+,<669,6044,5324>
+,<670,6167,6166>
+,<670,6166,5817>
+,<670,5817,6168>
+,<670,6168,6169>
+,<670,6169,673>
+,<670,673,6121>
+,<670,6121,6120>
+,<671,6218,6221>
+,<671,6221,6223>
+,<671,6223,6220>
+,<671,807,1056>
+,<671,1056,6218>
+,<671,6220,1063>
+,<671,1063,807>
+,<672,6109,6110>
+,<672,6110,755>
+,<672,755,6182>
+,<672,6182,761>
+,<673,6169,6168>
+,<673,6168,6170>
+,<673,6170,6171>
+,<675,681,740>
+,<675,740,682>
+,<676,1447,1469>
+,<676,1469,1448>
+,<676,740,737>
+,<676,737,1447>
+,<677,1428,1469>
+,<677,1469,1429>
+,<678,1430,1469>
+,<678,1469,1431>
+,<679,1427,1469>
+,<679,1469,1428>
+,<689,3231,3242>
+,<689,3242,3232>
+,<689,6138,6137>
+,<689,6137,2383>
+,<689,2383,3231>
+,<689,3232,1022>
+,<689,1022,6139>
+,<689,6139,6138>
+,<690,1552,1603>
+,<690,1603,1553>
+,<692,1257,2340>
+,<692,2340,2283>
+,<692,1270,1254>
+,<692,1254,1257>
+,<692,2283,2281>
+,<692,2281,1270>
+,<693,3242,970>
+,<693,970,1956>
+,<693,1952,1540>
+,<693,1540,3242>
+,<696,705,740>
+,<696,740,704>
+,<707,3242,708>
+,<707,708,3182>
+,<707,3185,3196>
+,<707,3196,3242>
+,<707,3182,740>
+,<707,740,3185>
+,<708,3242,972>
+,<708,972,3184>
+,<708,3184,740>
+,<708,740,3182>
+,<710,2290,2340>
+,<710,2340,2293>
+,<710,1270,2289>
+,<710,2289,2290>
+,<710,2293,2274>
+,<710,2274,1270>
+,<711,6840,6842>
+,<711,6842,1563>
+,<711,1563,6837>
+,<711,6837,1603>
+,<711,1603,1566>
+,<712,6224,6227>
+,<712,6227,6229>
+,<712,6229,6226>
+,<712,807,1060>
+,<712,1060,6224>
+,<712,6226,1062>
+,<712,1062,807>
+,<713,3242,2354>
+,<713,2354,1545>
+,<713,1545,1541>
+,<713,3201,3203>
+,<713,3203,3242>
+,<714,727,740>
+,<714,740,728>
+,<715,729,740>
+,<715,740,730>
+,<716,731,740>
+,<716,740,732>
+,<717,733,740>
+,<717,740,734>
+,<718,735,740>
+,<718,740,736>
+,<719,1445,1469>
+,<719,1469,1446>
+,<719,1446,737>
+,<719,737,740>
+,<720,726,740>
+,<720,740,727>
+,<721,6144,6143>
+,<721,6143,1594>
+,<721,1594,3237>
+,<722,3191,3242>
+,<722,3242,3192>
+,<722,3192,3187>
+,<722,3187,740>
+,<723,6195,6194>
+,<723,6194,6196>
+,<723,6196,6197>
+,<724,2354,3242>
+,<724,3242,3204>
+,<724,1603,1545>
+,<724,1545,2354>
+,<724,3204,1957>
+,<724,1957,1603>
+,<725,3235,3242>
+,<725,3242,3236>
+,<725,6142,6141>
+,<725,6141,1601>
+,<725,1601,3235>
+,<725,3236,1594>
+,<725,1594,6143>
+,<725,6143,6142>
+,<726,3189,3190>
+,<726,3190,3188>
+,<726,3188,740>
+,<737,1446,1469>
+,<737,1469,1447>
+,<738,1442,1469>
+,<738,1469,1443>
+,<738,1443,1415>
+,<738,1415,740>
+,<739,1438,1469>
+,<739,1469,1439>
+,<739,1439,1416>
+,<739,1416,740>
+,<740,3184,972>
+,<740,972,3183>
+,<740,3180,3196>
+,<740,3196,3185>
+,<740,3186,3195>
+,<740,3195,3180>
+,<740,1544,3194>
+,<740,3194,3186>
+,<740,3187,3193>
+,<740,3193,1544>
+,<741,6350,6367>
+,<741,6367,6351>
+,<741,1677,1002>
+,<741,1002,6350>
+,<741,6351,5860>
+,<741,5860,1677>
+,<745,748,807>
+,<745,807,747>
+,<749,996,1005>
+,<749,1005,999>
+,<750,6300,5010>
+,<750,5010,5810>
+,<750,1723,4980>
+,<750,4980,6300>
+,<750,5810,5642>
+,<750,5642,1723>
+,<751,1096,3510>
+,<751,3510,1680>
+,<751,2206,1089>
+,<751,1089,1096>
+,<751,1680,878>
+,<751,878,2206>
+,<752,997,1005>
+,<752,1005,996>
+,<753,6039,6848>
+,<753,6848,5357>
+,<753,5357,6839>
+,<755,6180,6183>
+,<755,6183,6185>
+,<755,6185,6182>
+,<756,3322,3321>
+,<756,3321,2005>
+,<756,2005,2004>
+,<757,6827,6836>
+,<757,6836,6828>
+,<757,6828,6826>
+,<757,6826,2005>
+,<758,2389,2407>
+,<758,2407,2390>
+,<758,6104,6105>
+,<758,6105,2345>
+,<758,2345,2389>
+,<758,2390,2347>
+,<758,2347,6103>
+,<758,6103,6104>
+,<759,2361,2407>
+,<759,2407,2362>
+,<760,5948,5977>
+,<760,5977,5949>
+,<760,4721,4720>
+,<760,4720,4722>
+,<760,4722,4990>
+,<760,4990,5948>
+,<760,5949,1698>
+,<760,1698,4719>
+,<760,4719,4721>
+,<761,6182,6185>
+,<761,6185,6187>
+,<761,6187,6184>
+,<769,5498,5508>
+,<769,5508,5499>
+,<769,4381,5474>
+,<769,5474,5498>
+,<769,5499,5473>
+,<769,5473,4381>
+,<770,6434,2119>
+,<770,2119,6370>
+,<770,5119,5114>
+,<770,5114,6434>
+,<770,6370,5166>
+,<770,5166,5119>
+,<771,3443,1624>
+,<771,1624,2056>
+,<771,2051,2044>
+,<771,2044,3443>
+,<771,2056,2072>
+,<771,2072,2051>
+,<772,2072,800>
+,<772,800,858>
+,<772,2061,2063>
+,<772,2063,2072>
+,<772,858,1670>
+,<772,1670,2061>
+,<773,2064,2072>
+,<773,2072,2065>
+,<773,1670,1103>
+,<773,1103,2064>
+,<773,2065,2006>
+,<773,2006,1670>
+,<774,803,807>
+,<774,807,804>
+,<775,3443,2042>
+,<775,2042,1107>
+,<775,2045,1624>
+,<775,1624,3443>
+,<775,1107,2072>
+,<775,2072,2045>
+,<776,788,5575>
+,<776,5575,1636>
+,<776,807,5516>
+,<776,5516,788>
+,<777,782,807>
+,<777,807,783>
+,<786,5525,5575>
+,<786,5575,5526>
+,<786,807,3364>
+,<786,3364,5525>
+,<786,5526,3414>
+,<786,3414,807>
+,<787,5523,5575>
+,<787,5575,5524>
+,<787,807,2039>
+,<787,2039,5523>
+,<787,5524,3364>
+,<787,3364,807>
+,<788,5516,5519>
+,<788,5519,5575>
+,<789,7359,6384>
+,<789,6384,6399>
+,<789,2087,5558>
+,<789,5558,7359>
+,<789,6399,3443>
+,<789,3443,2087>
+,<790,3994,3419>
+,<790,3419,5542>
+,<790,5542,5575>
+,<790,5575,5543>
+,<790,3376,3366>
+,<790,3366,2002>
+,<790,2002,3994>
+,<790,5543,5513>
+,<790,5513,3376>
+,<791,5508,1353>
+,<791,1353,1399>
+,<791,4349,5458>
+,<791,5458,5508>
+,<791,1399,1402>
+,<791,1402,4349>
+,<792,4162,4180>
+,<792,4180,4161>
+,<792,3309,2509>
+,<792,2509,4162>
+,<792,4161,2143>
+,<792,2143,3309>
+,<793,4103,4709>
+,<793,4709,4689>
+,<793,2671,2673>
+,<793,2673,2668>
+,<793,2668,4103>
+,<793,4689,940>
+,<793,940,2665>
+,<793,2665,0>
+,<793,0,2671>
+,<794,5446,5508>
+,<794,5508,5450>
+,<794,2858,2860>
+,<794,2860,5447>
+,<794,5447,5446>
+,<794,5450,2840>
+,<794,2840,2856>
+,<794,2856,1651>
+,<794,1651,2858>
+,<795,2041,3443>
+,<795,3443,2043>
+,<795,2072,1350>
+,<795,1350,2041>
+,<795,2043,2054>
+,<795,2054,2072>
+,<796,3422,6434>
+,<796,6434,6379>
+,<796,1670,6376>
+,<796,6376,3422>
+,<796,6379,5141>
+,<796,5141,1670>
+,<797,2072,2124>
+,<797,2124,1625>
+,<798,2058,2072>
+,<798,2072,2057>
+,<798,1670,1640>
+,<798,1640,2058>
+,<799,2062,2072>
+,<799,2072,2063>
+,<799,1670,1108>
+,<799,1108,2062>
+,<799,2063,2061>
+,<799,2061,1670>
+,<800,2072,2064>
+,<800,2064,1103>
+,<800,1103,1670>
+,<800,1670,858>
+,<801,2018,2072>
+,<801,2072,2021>
+,<802,2027,2072>
+,<802,2072,2030>
+,<807,1070,6230>
+,<807,6230,1057>
+,<807,1062,6228>
+,<807,6228,1070>
+,<807,1063,6222>
+,<807,6222,1060>
+,<807,1065,6209>
+,<807,6209,1050>
+,<807,1071,6207>
+,<807,6207,1065>
+,<807,1051,6201>
+,<807,6201,1047>
+,<807,5515,5530>
+,<807,5530,3390>
+,<807,2040,5529>
+,<807,5529,5515>
+,<807,3408,5528>
+,<807,5528,2040>
+,<807,3414,5527>
+,<807,5527,3408>
+,<807,5517,5519>
+,<807,5519,5516>
+,<807,1641,5518>
+,<807,5518,5517>
+,<807,3394,1351>
+,<807,1351,1641>
+,<809,3875,3912>
+,<809,3912,3878>
+,<809,1470,1476>
+,<809,1476,3875>
+,<809,3878,2438>
+,<809,2438,5057>
+,<809,5057,5055>
+,<809,5055,1470>
+,<810,6781,6836>
+,<810,6836,6782>
+,<810,6782,1588>
+,<810,1588,3242>
+,<812,813,2004>
+,<812,2004,2005>
+,<812,2005,1041>
+,<814,3376,3323>
+,<814,3323,3321>
+,<814,3321,3322>
+,<815,3367,3376>
+,<815,3376,3368>
+,<816,3376,1596>
+,<816,1596,1995>
+,<816,2910,3375>
+,<816,3375,3376>
+,<817,4358,4381>
+,<817,4381,4359>
+,<817,2139,2879>
+,<817,2879,4358>
+,<817,4359,4317>
+,<817,4317,2139>
+,<836,2443,2474>
+,<836,2474,843>
+,<836,1402,2442>
+,<836,2442,2443>
+,<836,843,1302>
+,<836,1302,1402>
+,<837,2474,1200>
+,<837,1200,2469>
+,<837,2470,2473>
+,<837,2473,2474>
+,<837,2469,1938>
+,<837,1938,1923>
+,<837,1923,1878>
+,<837,1878,2470>
+,<838,2446,2474>
+,<838,2474,2262>
+,<838,1402,2445>
+,<838,2445,2446>
+,<838,2262,1914>
+,<838,1914,1402>
+,<839,4914,2231>
+,<839,2231,2273>
+,<839,2273,2233>
+,<839,1335,1288>
+,<839,1288,7257>
+,<839,7257,4914>
+,<839,2233,1837>
+,<839,1837,1335>
+,<840,5066,5099>
+,<840,5099,3881>
+,<840,1470,2426>
+,<840,2426,5066>
+,<840,3881,3877>
+,<840,3877,1470>
+,<841,4300,4314>
+,<841,4314,4301>
+,<841,3577,3784>
+,<841,3784,4300>
+,<841,4301,3783>
+,<841,3783,3577>
+,<842,2622,2621>
+,<842,2621,2561>
+,<842,2561,2623>
+,<842,2623,2624>
+,<843,2474,2447>
+,<843,2447,1302>
+,<844,1848,1938>
+,<844,1938,1840>
+,<845,4177,4180>
+,<845,4180,4178>
+,<845,2541,4169>
+,<845,4169,4177>
+,<845,4178,3251>
+,<845,3251,2541>
+,<846,2521,5306>
+,<846,5306,4069>
+,<846,1737,5020>
+,<846,5020,2521>
+,<846,4069,4070>
+,<846,4070,1737>
+,<847,3443,3396>
+,<847,3396,3395>
+,<847,2049,1638>
+,<847,1638,3443>
+,<847,3395,2036>
+,<847,2036,2038>
+,<847,2038,2072>
+,<847,2072,2049>
+,<848,2738,2737>
+,<848,2737,2739>
+,<848,2739,2740>
+,<848,2813,2812>
+,<848,2812,863>
+,<848,863,2738>
+,<849,6517,6568>
+,<849,6568,3911>
+,<849,3912,6516>
+,<849,6516,6517>
+,<849,3911,5035>
+,<849,5035,3912>
+,<851,6449,6501>
+,<851,6501,6452>
+,<851,3309,4498>
+,<851,4498,6449>
+,<851,6452,6450>
+,<851,6450,3309>
+,<852,5169,5233>
+,<852,5233,1609>
+,<852,2699,2701>
+,<852,2701,5182>
+,<852,5182,5169>
+,<852,1609,1612>
+,<852,1612,2697>
+,<852,2697,2592>
+,<852,2592,2699>
+,<853,2179,4709>
+,<853,4709,4684>
+,<853,4113,4110>
+,<853,4110,2179>
+,<853,4684,4682>
+,<853,4682,4113>
+,<854,3432,3443>
+,<854,3443,3433>
+,<854,1670,3379>
+,<854,3379,3432>
+,<854,3433,3382>
+,<854,3382,1670>
+,<855,5250,5306>
+,<855,5306,4456>
+,<855,3510,927>
+,<855,927,5250>
+,<855,4456,4472>
+,<855,4472,3510>
+,<856,6754,6769>
+,<856,6769,4172>
+,<856,3845,3248>
+,<856,3248,6754>
+,<856,4172,4254>
+,<856,4254,3845>
+,<857,4179,4180>
+,<857,4180,4117>
+,<857,2541,3251>
+,<857,3251,4179>
+,<857,4117,1099>
+,<857,1099,2541>
+,<859,2026,2072>
+,<859,2072,2025>
+,<860,5535,5575>
+,<860,5575,5536>
+,<861,3832,3845>
+,<861,3845,3833>
+,<861,3577,3816>
+,<861,3816,3832>
+,<861,3833,1669>
+,<861,1669,3577>
+,<862,4331,4381>
+,<862,4381,4332>
+,<862,2900,2903>
+,<862,2903,2845>
+,<862,2845,4331>
+,<862,4332,4005>
+,<862,4005,2898>
+,<862,2898,2855>
+,<862,2855,2900>
+,<863,2736,2735>
+,<863,2735,2737>
+,<863,2737,2738>
+,<863,2812,2811>
+,<863,2811,3312>
+,<863,3312,3313>
+,<863,3313,2736>
+,<864,2778,2779>
+,<864,2779,868>
+,<864,868,2744>
+,<864,2746,867>
+,<864,867,2816>
+,<864,2816,2778>
+,<865,2773,2774>
+,<865,2774,2776>
+,<865,2776,866>
+,<865,866,2751>
+,<867,2746,2745>
+,<867,2745,2747>
+,<867,2747,2748>
+,<868,2742,2741>
+,<868,2741,2743>
+,<868,2743,2744>
+,<869,3342,3376>
+,<869,3376,3343>
+,<869,1981,2005>
+,<869,2005,3317>
+,<869,3317,3342>
+,<869,3343,3316>
+,<869,3316,2763>
+,<869,2763,2762>
+,<869,2762,1939>
+,<869,1939,1981>
+,<870,3332,3376>
+,<870,3376,3333>
+,<870,2005,1941>
+,<870,1941,3332>
+,<870,3333,1990>
+,<870,1990,2005>
+,<873,6787,6836>
+,<873,6836,6788>
+,<873,3242,1948>
+,<873,1948,6787>
+,<873,6788,1968>
+,<873,1968,3217>
+,<873,3217,3242>
+,<874,2775,2774>
+,<874,2774,2773>
+,<874,2773,2771>
+,<874,2771,2772>
+,<874,2772,2815>
+,<875,7371,7372>
+,<875,7372,7370>
+,<875,3654,3656>
+,<875,3656,7371>
+,<875,5669,5668>
+,<875,5668,885>
+,<875,5660,5670>
+,<875,5670,5669>
+,<875,2155,884>
+,<875,884,5660>
+,<875,3625,5667>
+,<875,5667,2155>
+,<875,2153,5666>
+,<875,5666,3625>
+,<875,4201,5665>
+,<875,5665,2153>
+,<875,887,888>
+,<875,888,889>
+,<875,899,898>
+,<875,898,900>
+,<875,4988,6587>
+,<875,6587,899>
+,<875,5938,6570>
+,<875,6570,5943>
+,<875,901,4402>
+,<875,4402,5938>
+,<875,4741,1672>
+,<875,1672,901>
+,<875,5942,1215>
+,<875,1215,4741>
+,<875,3676,4425>
+,<875,4425,5942>
+,<875,921,4972>
+,<875,4972,4884>
+,<875,4884,4401>
+,<875,4401,3676>
+,<875,5929,4714>
+,<875,4714,921>
+,<875,3661,5928>
+,<875,5928,5929>
+,<875,3662,918>
+,<875,918,3661>
+,<875,966,4716>
+,<875,4716,4729>
+,<875,4718,5926>
+,<875,5926,3663>
+,<875,5923,5924>
+,<875,5924,1696>
+,<875,5922,4725>
+,<875,4725,5923>
+,<875,962,3653>
+,<875,3653,5922>
+,<875,4723,5912>
+,<875,5912,962>
+,<875,3660,5921>
+,<875,5921,3664>
+,<875,5919,5920>
+,<875,5920,3660>
+,<875,1689,5911>
+,<875,5911,5919>
+,<875,3665,5918>
+,<875,5918,5915>
+,<875,3659,5916>
+,<875,5916,3665>
+,<875,5913,1015>
+,<875,1015,3659>
+,<875,5914,7378>
+,<875,7378,5965>
+,<875,5965,5913>
+,<875,7367,7377>
+,<875,7377,5914>
+,<875,1688,7376>
+,<875,7376,7367>
+,<875,7368,7375>
+,<875,7375,1688>
+,<875,1296,7374>
+,<875,7374,7368>
+,<875,7369,7373>
+,<875,7373,1296>
+,<875,2164,3655>
+,<875,3655,7369>
+,<875,7370,5976>
+,<875,5976,2164>
+,<876,6696,6702>
+,<876,6702,6695>
+,<876,3644,5663>
+,<876,5663,6696>
+,<876,6695,5661>
+,<876,5661,3644>
+,<877,5230,5233>
+,<877,5233,5231>
+,<877,3845,3819>
+,<877,3819,5230>
+,<877,5231,3824>
+,<877,3824,3845>
+,<878,1680,3510>
+,<878,3510,3268>
+,<878,3268,882>
+,<878,882,2206>
+,<879,5881,1677>
+,<879,1677,5880>
+,<879,1005,5867>
+,<879,5867,5881>
+,<879,5880,5866>
+,<879,5866,1005>
+,<880,3336,3376>
+,<880,3376,3337>
+,<880,2005,1982>
+,<880,1982,3336>
+,<881,6753,6769>
+,<881,6769,6752>
+,<881,3845,3789>
+,<881,3789,6753>
+,<881,6752,6444>
+,<881,6444,3845>
+,<882,3268,3510>
+,<882,3510,951>
+,<882,951,3271>
+,<882,3271,2206>
+,<883,6688,6702>
+,<883,6702,6687>
+,<883,3644,3130>
+,<883,3130,6688>
+,<883,6687,5662>
+,<883,5662,3644>
+,<884,5709,5670>
+,<884,5670,5660>
+,<884,2155,5667>
+,<884,5667,5709>
+,<885,5668,5709>
+,<885,5709,5672>
+,<901,1672,6635>
+,<901,6635,4402>
+,<902,6615,6635>
+,<902,6635,6616>
+,<902,4815,4816>
+,<902,4816,6576>
+,<902,6576,6615>
+,<903,4411,4412>
+,<903,4412,4779>
+,<903,4779,4778>
+,<904,5977,4531>
+,<904,4531,4529>
+,<905,5977,4716>
+,<905,4716,966>
+,<906,4736,4403>
+,<906,4403,6633>
+,<906,6633,5940>
+,<906,5940,4734>
+,<906,4790,4791>
+,<906,4791,4793>
+,<906,4793,934>
+,<906,934,4738>
+,<906,4738,4736>
+,<906,4734,4732>
+,<906,4732,1695>
+,<906,1695,4787>
+,<906,4787,4788>
+,<906,4788,4790>
+,<907,4567,4575>
+,<907,4575,4568>
+,<907,4758,4759>
+,<907,4759,4430>
+,<907,4430,4390>
+,<907,4390,4567>
+,<907,4568,4420>
+,<907,4420,4768>
+,<907,4768,4842>
+,<907,4842,4758>
+,<908,5029,5032>
+,<908,5032,5030>
+,<908,5030,2406>
+,<908,2406,1737>
+,<909,6635,6589>
+,<909,6589,6585>
+,<909,6572,6569>
+,<909,6569,6635>
+,<910,1216,6635>
+,<910,6635,4528>
+,<910,4730,1695>
+,<910,1695,4732>
+,<910,4732,4731>
+,<910,4731,1216>
+,<910,4528,5941>
+,<910,5941,4728>
+,<910,4728,4730>
+,<911,4571,4575>
+,<911,4575,4572>
+,<911,4755,4756>
+,<911,4756,1421>
+,<911,1421,4571>
+,<911,4572,1404>
+,<911,1404,4771>
+,<911,4771,4838>
+,<911,4838,4755>
+,<912,4509,4575>
+,<912,4575,4511>
+,<912,4775,4774>
+,<912,4774,4426>
+,<912,4426,4509>
+,<912,4511,4512>
+,<912,4512,4776>
+,<912,4776,4775>
+,<913,4541,4575>
+,<913,4575,4542>
+,<914,1463,1469>
+,<914,1469,1464>
+,<915,4556,4575>
+,<915,4575,4557>
+,<915,1469,4404>
+,<915,4404,4556>
+,<915,4557,4427>
+,<915,4427,1469>
+,<916,4874,4873>
+,<916,4873,4875>
+,<916,4875,4876>
+,<917,1460,1469>
+,<917,1469,1461>
+,<918,5977,5928>
+,<918,5928,3661>
+,<919,3697,3711>
+,<919,3711,3698>
+,<919,1737,3461>
+,<919,3461,3697>
+,<919,3698,3645>
+,<919,3645,1737>
+,<920,6335,6367>
+,<920,6367,6336>
+,<920,1677,6301>
+,<920,6301,6335>
+,<920,6336,6302>
+,<920,6302,1677>
+,<921,4714,5977>
+,<921,5977,4972>
+,<922,983,1005>
+,<922,1005,986>
+,<923,5261,5306>
+,<923,5306,5262>
+,<923,1737,4978>
+,<923,4978,5261>
+,<923,5262,5021>
+,<923,5021,1737>
+,<924,5462,5508>
+,<924,5508,5461>
+,<924,1402,2134>
+,<924,2134,5462>
+,<924,5461,2871>
+,<924,2871,1402>
+,<925,5306,1298>
+,<925,1298,2014>
+,<925,1715,3489>
+,<925,3489,5306>
+,<925,2014,1737>
+,<925,1737,1715>
+,<926,7426,1690>
+,<926,1690,1694>
+,<926,1694,5709>
+,<926,5709,3446>
+,<927,5249,5306>
+,<927,5306,5250>
+,<927,3510,4053>
+,<927,4053,5249>
+,<928,979,5579>
+,<928,5579,5816>
+,<928,5816,1073>
+,<928,1073,5815>
+,<928,5843,5818>
+,<928,5818,5806>
+,<928,5806,979>
+,<928,5815,5626>
+,<928,5626,5843>
+,<929,4129,4180>
+,<929,4180,4128>
+,<929,2206,2515>
+,<929,2515,4129>
+,<929,4128,3255>
+,<929,3255,2206>
+,<930,992,1005>
+,<930,1005,995>
+,<932,985,1005>
+,<932,1005,988>
+,<933,2670,4089>
+,<933,4089,4113>
+,<934,4740,1214>
+,<934,1214,6631>
+,<934,6631,4385>
+,<934,4385,4738>
+,<934,4793,4794>
+,<934,4794,4796>
+,<934,4796,3680>
+,<934,3680,4740>
+,<936,7086,5898>
+,<936,5898,7085>
+,<936,4113,7027>
+,<936,7027,7086>
+,<936,7085,5864>
+,<936,5864,4113>
+,<937,5975,7426>
+,<937,7426,3667>
+,<937,2206,3669>
+,<937,3669,5975>
+,<937,3667,5966>
+,<937,5966,2206>
+,<938,3259,4180>
+,<938,4180,4143>
+,<938,2206,2508>
+,<938,2508,3259>
+,<938,4143,4141>
+,<938,4141,2206>
+,<939,1534,2474>
+,<939,2474,2462>
+,<939,1402,2458>
+,<939,2458,1534>
+,<939,2462,1535>
+,<939,1535,1402>
+,<940,4689,4709>
+,<940,4709,4105>
+,<940,4105,4047>
+,<940,4047,2663>
+,<940,2663,2665>
+,<941,3959,3979>
+,<941,3979,3960>
+,<941,2989,3030>
+,<941,3030,2971>
+,<941,2971,2271>
+,<941,2271,3959>
+,<941,3960,3947>
+,<941,3947,2990>
+,<941,2990,2989>
+,<942,1928,1938>
+,<942,1938,1929>
+,<943,4114,4180>
+,<943,4180,4115>
+,<943,3309,3258>
+,<943,3258,4114>
+,<943,4115,3256>
+,<943,3256,3309>
+,<944,3693,3711>
+,<944,3711,3694>
+,<944,1737,1705>
+,<944,1705,3689>
+,<944,3689,3693>
+,<944,3694,3648>
+,<944,3648,1737>
+,<945,5001,5032>
+,<945,5032,5002>
+,<945,2407,4985>
+,<945,4985,5001>
+,<945,5002,4984>
+,<945,4984,2407>
+,<946,6649,6702>
+,<946,6702,6650>
+,<947,7426,3656>
+,<947,3656,3654>
+,<948,5246,5306>
+,<948,5306,5247>
+,<948,3510,2163>
+,<948,2163,5246>
+,<948,5247,3484>
+,<948,3484,3510>
+,<949,1703,968>
+,<949,968,3711>
+,<949,1692,3510>
+,<949,3510,1703>
+,<950,2167,3510>
+,<950,3510,1684>
+,<950,2206,3269>
+,<950,3269,2167>
+,<950,1684,1297>
+,<950,1297,2206>
+,<951,3510,2169>
+,<951,2169,3271>
+,<952,4508,4479>
+,<952,4479,3498>
+,<952,4457,4064>
+,<952,4064,4508>
+,<952,3498,4113>
+,<952,4113,4457>
+,<953,3243,4508>
+,<953,4508,4462>
+,<953,3309,4051>
+,<953,4051,3243>
+,<953,4462,4460>
+,<953,4460,3309>
+,<954,7380,7426>
+,<954,7426,7381>
+,<954,5977,5674>
+,<954,5674,7380>
+,<954,7381,2161>
+,<954,2161,5977>
+,<955,4058,4508>
+,<955,4508,4459>
+,<955,3309,4454>
+,<955,4454,4058>
+,<955,4459,4055>
+,<955,4055,3309>
+,<956,5015,5642>
+,<956,5642,3687>
+,<956,3687,5586>
+,<956,5586,3490>
+,<956,3490,5306>
+,<957,4997,5032>
+,<957,5032,4998>
+,<957,4883,967>
+,<957,967,4885>
+,<957,4885,1699>
+,<957,1699,4997>
+,<957,4998,3684>
+,<957,3684,4881>
+,<957,4881,4883>
+,<958,968,1703>
+,<958,1703,3510>
+,<959,5032,4437>
+,<959,4437,1712>
+,<959,3690,4434>
+,<959,4434,5032>
+,<959,1712,3711>
+,<959,3711,3690>
+,<960,6702,6636>
+,<960,6636,6698>
+,<960,6699,6701>
+,<960,6701,6702>
+,<960,6698,3175>
+,<960,3175,6699>
+,<961,4446,5032>
+,<961,5032,4967>
+,<961,3711,1679>
+,<961,1679,4446>
+,<961,4967,3692>
+,<961,3692,3711>
+,<962,5912,5977>
+,<962,5977,3653>
+,<963,2407,2357>
+,<963,2357,2356>
+,<963,964,1016>
+,<963,1016,2407>
+,<965,2355,2357>
+,<965,2357,2407>
+,<967,4750,4831>
+,<967,4831,4777>
+,<967,4777,4891>
+,<967,4891,4892>
+,<967,4892,4889>
+,<967,4889,4887>
+,<967,4887,4885>
+,<969,6836,6802>
+,<969,6802,3223>
+,<970,3242,3190>
+,<970,3190,3189>
+,<970,3189,1543>
+,<971,2341,6836>
+,<971,6836,6774>
+,<971,6774,6773>
+,<971,6773,6772>
+,<971,2005,1965>
+,<971,1965,2341>
+,<972,3242,2378>
+,<972,2378,3183>
+,<973,2358,2407>
+,<973,2407,2359>
+,<974,2385,2407>
+,<974,2407,2386>
+,<974,6146,6145>
+,<974,6145,2343>
+,<974,2343,2385>
+,<974,2386,2346>
+,<974,2346,6147>
+,<974,6147,6146>
+,<975,6299,6300>
+,<975,6300,6237>
+,<975,6237,5782>
+,<975,5782,5642>
+,<976,4448,4810>
+,<976,4810,2171>
+,<976,2171,4745>
+,<976,4747,1687>
+,<976,1687,4803>
+,<976,4803,4801>
+,<976,4801,4448>
+,<982,984,1005>
+,<982,1005,983>
+,<998,5418,1677>
+,<998,1677,5869>
+,<998,5376,5854>
+,<998,5854,5418>
+,<998,5869,5290>
+,<998,5290,5276>
+,<998,5276,5376>
+,<999,1005,3274>
+,<999,3274,5886>
+,<999,5886,4072>
+,<1000,4071,1677>
+,<1000,1677,5884>
+,<1000,1005,5866>
+,<1000,5866,4071>
+,<1000,5884,5882>
+,<1000,5882,1005>
+,<1001,4477,4508>
+,<1001,4508,1004>
+,<1001,4113,4063>
+,<1001,4063,4477>
+,<1001,1004,3496>
+,<1001,3496,4113>
+,<1002,6349,6367>
+,<1002,6367,6350>
+,<1003,5197,5233>
+,<1003,5233,5198>
+,<1003,2681,2683>
+,<1003,2683,2680>
+,<1003,2680,5197>
+,<1003,5198,4687>
+,<1003,4687,2679>
+,<1003,2679,2681>
+,<1004,4508,4064>
+,<1004,4064,3496>
+,<1005,5877,4474>
+,<1005,4474,5867>
+,<1005,4473,5879>
+,<1005,5879,5877>
+,<1005,5858,5878>
+,<1005,5878,4473>
+,<1005,5417,5875>
+,<1005,5875,5858>
+,<1005,5857,5876>
+,<1005,5876,5417>
+,<1005,1075,5873>
+,<1005,5873,5857>
+,<1005,5294,5874>
+,<1005,5874,1075>
+,<1005,5870,5871>
+,<1005,5871,5294>
+,<1005,5856,5872>
+,<1005,5872,5870>
+,<1005,5419,5420>
+,<1005,5420,5856>
+,<1005,5619,5631>
+,<1005,5631,1094>
+,<1005,1094,5419>
+,<1005,5008,5842>
+,<1005,5842,5619>
+,<1005,5620,5841>
+,<1005,5841,5008>
+,<1005,5804,5840>
+,<1005,5840,5620>
+,<1005,5274,5839>
+,<1005,5839,5804>
+,<1005,5621,5838>
+,<1005,5838,5274>
+,<1005,5803,5837>
+,<1005,5837,5621>
+,<1005,3686,5836>
+,<1005,5836,5803>
+,<1005,5802,5835>
+,<1005,5835,3686>
+,<1005,5622,5834>
+,<1005,5834,5802>
+,<1005,5009,5833>
+,<1005,5833,5622>
+,<1005,4975,5832>
+,<1005,5832,5009>
+,<1005,5801,5831>
+,<1005,5831,4975>
+,<1005,5623,5830>
+,<1005,5830,5801>
+,<1005,5800,5829>
+,<1005,5829,5623>
+,<1005,5578,5828>
+,<1005,5828,5800>
+,<1005,1009,5827>
+,<1005,5827,5578>
+,<1005,5624,5826>
+,<1005,5826,1009>
+,<1005,5580,5825>
+,<1005,5825,5624>
+,<1005,1091,5824>
+,<1005,5824,5580>
+,<1005,5615,5823>
+,<1005,5823,1091>
+,<1005,5614,5822>
+,<1005,5822,5615>
+,<1005,5625,5821>
+,<1005,5821,5614>
+,<1005,5805,5820>
+,<1005,5820,5625>
+,<1005,1010,5819>
+,<1005,5819,5805>
+,<1005,5806,5818>
+,<1005,5818,1010>
+,<1005,5882,5883>
+,<1005,5883,3274>
+,<1006,1384,2072>
+,<1006,2072,2038>
+,<1007,5813,5812>
+,<1007,5812,5799>
+,<1007,5799,5814>
+,<1007,5626,5815>
+,<1007,5815,1073>
+,<1007,1073,5813>
+,<1007,5814,5843>
+,<1007,5843,5626>
+,<1008,1058,2350>
+,<1008,2350,6274>
+,<1008,6274,5605>
+,<1008,2353,5812>
+,<1008,5812,5813>
+,<1008,5813,1073>
+,<1008,1073,5816>
+,<1008,5816,6232>
+,<1008,6232,6233>
+,<1008,6233,6231>
+,<1008,6231,6229>
+,<1008,6229,6227>
+,<1008,6227,6225>
+,<1008,6225,6223>
+,<1008,6223,6221>
+,<1008,6221,6219>
+,<1008,6219,6217>
+,<1008,6217,6215>
+,<1008,6215,6213>
+,<1008,6213,6211>
+,<1008,6211,6107>
+,<1008,6107,6156>
+,<1008,6156,6148>
+,<1008,6148,6058>
+,<1008,6058,6067>
+,<1008,6067,6065>
+,<1008,6065,6063>
+,<1008,6063,2397>
+,<1008,2397,1058>
+,<1008,5605,6059>
+,<1008,6059,5797>
+,<1008,5797,2353>
+,<1009,5826,5843>
+,<1009,5843,5827>
+,<1010,5818,5843>
+,<1010,5843,5819>
+,<1011,6300,6251>
+,<1011,6251,3445>
+,<1011,5610,5010>
+,<1011,5010,6300>
+,<1011,3445,5642>
+,<1011,5642,5610>
+,<1012,5583,6300>
+,<1012,6300,5410>
+,<1012,5642,6250>
+,<1012,6250,5583>
+,<1013,5024,5032>
+,<1013,5032,5025>
+,<1013,1737,5584>
+,<1013,5584,4979>
+,<1013,4979,5019>
+,<1013,5019,5024>
+,<1013,5025,4976>
+,<1013,4976,1737>
+,<1014,4437,5032>
+,<1014,5032,4433>
+,<1014,3711,1712>
+,<1014,1712,4437>
+,<1015,5977,5916>
+,<1015,5916,3659>
+,<1015,5913,5965>
+,<1015,5965,7366>
+,<1015,7366,5977>
+,<1018,2359,2407>
+,<1018,2407,2360>
+,<1019,2371,2407>
+,<1019,2407,2372>
+,<1020,2364,2407>
+,<1020,2407,2365>
+,<1021,6807,6836>
+,<1021,6836,6810>
+,<1022,3232,3242>
+,<1022,3242,3233>
+,<1023,3220,6836>
+,<1023,6836,3179>
+,<1023,6133,6132>
+,<1023,6132,6775>
+,<1023,6775,3220>
+,<1023,3179,3218>
+,<1023,3218,6134>
+,<1023,6134,6133>
+,<1024,2391,2407>
+,<1024,2407,2392>
+,<1024,6102,6103>
+,<1024,6103,2347>
+,<1024,2347,2391>
+,<1024,2392,2348>
+,<1024,2348,6101>
+,<1024,6101,6102>
+,<1025,2394,2407>
+,<1025,2407,2395>
+,<1025,6099,6100>
+,<1025,6100,1027>
+,<1025,1027,2394>
+,<1026,6072,6071>
+,<1026,6071,6073>
+,<1026,6073,6074>
+,<1026,6095,6096>
+,<1026,6096,6055>
+,<1026,6055,6072>
+,<1026,6074,6056>
+,<1026,6056,6094>
+,<1026,6094,6095>
+,<1027,2393,2407>
+,<1027,2407,2394>
+,<1027,6100,6101>
+,<1027,6101,2348>
+,<1027,2348,2393>
+,<1028,2363,2407>
+,<1028,2407,2364>
+,<1029,2365,2407>
+,<1029,2407,2366>
+,<1030,2362,2407>
+,<1030,2407,2363>
+,<1031,2372,2407>
+,<1031,2407,2373>
+,<1032,5364,6044>
+,<1032,6044,5365>
+,<1033,2370,2407>
+,<1033,2407,2371>
+,<1034,1955,3241>
+,<1034,3241,3242>
+,<1036,3376,3324>
+,<1036,3324,3319>
+,<1036,1944,1998>
+,<1036,1998,3376>
+,<1036,3319,2005>
+,<1036,2005,1944>
+,<1037,6836,6830>
+,<1037,6830,3227>
+,<1037,6826,6828>
+,<1037,6828,6836>
+,<1037,3227,2005>
+,<1037,2005,6826>
+,<1038,3239,3242>
+,<1038,3242,3240>
+,<1038,2407,1600>
+,<1038,1600,3239>
+,<1038,3240,1954>
+,<1038,1954,2407>
+,<1040,6783,6836>
+,<1040,6836,6784>
+,<1040,3242,1588>
+,<1040,1588,6783>
+,<1040,6784,1967>
+,<1040,1967,3242>
+,<1044,6808,6810>
+,<1044,6810,6836>
+,<1044,6836,6809>
+,<1044,6809,3225>
+,<1044,3225,2005>
+,<1044,2005,1973>
+,<1045,1973,2005>
+,<1045,2005,1974>
+,<1047,6201,6200>
+,<1047,6200,6202>
+,<1047,6202,6203>
+,<1048,6173,6172>
+,<1048,6172,6174>
+,<1048,6174,6175>
+,<1048,6175,1053>
+,<1048,1053,6113>
+,<1048,6113,6114>
+,<1049,6190,5627>
+,<1049,5627,6192>
+,<1049,6192,6193>
+,<1050,6209,6208>
+,<1050,6208,6211>
+,<1050,6211,6213>
+,<1050,6213,6210>
+,<1051,1055,1066>
+,<1051,1066,6199>
+,<1051,6199,6198>
+,<1051,6198,6200>
+,<1051,6200,6201>
+,<1053,6175,6174>
+,<1053,6174,6177>
+,<1053,6177,6179>
+,<1053,6179,6176>
+,<1054,6186,6189>
+,<1054,6189,6191>
+,<1054,6191,6188>
+,<1056,6216,6219>
+,<1056,6219,6221>
+,<1056,6221,6218>
+,<1058,2397,1061>
+,<1058,1061,6273>
+,<1058,6273,2350>
+,<1059,5796,6300>
+,<1059,6300,6287>
+,<1059,5843,6254>
+,<1059,6254,5796>
+,<1059,6287,6285>
+,<1059,6285,5843>
+,<1060,6222,6225>
+,<1060,6225,6227>
+,<1060,6227,6224>
+,<1061,6272,6300>
+,<1061,6300,6273>
+,<1061,2397,6063>
+,<1061,6063,6064>
+,<1061,6064,6062>
+,<1061,6062,5611>
+,<1061,5611,6272>
+,<1062,6226,6229>
+,<1062,6229,6231>
+,<1062,6231,6228>
+,<1063,6220,6223>
+,<1063,6223,6225>
+,<1063,6225,6222>
+,<1064,6212,6215>
+,<1064,6215,6217>
+,<1064,6217,6214>
+,<1065,6207,6206>
+,<1065,6206,6208>
+,<1065,6208,6209>
+,<1067,6188,6191>
+,<1067,6191,5627>
+,<1067,5627,6190>
+,<1068,6164,6118>
+,<1068,6118,6162>
+,<1068,6162,6116>
+,<1068,6116,5817>
+,<1068,5817,6166>
+,<1068,5807,6165>
+,<1068,6165,6164>
+,<1069,6184,6187>
+,<1069,6187,6189>
+,<1069,6189,6186>
+,<1070,6228,6231>
+,<1070,6231,6233>
+,<1070,6233,6230>
+,<1071,6205,6204>
+,<1071,6204,6206>
+,<1071,6206,6207>
+,<1072,6197,6196>
+,<1072,6196,6198>
+,<1072,6198,6199>
+,<1074,1839,1938>
+,<1074,1938,1773>
+,<1075,5874,1677>
+,<1075,1677,5873>
+,<1076,1935,1938>
+,<1076,1938,1936>
+,<1077,1923,1938>
+,<1077,1938,1924>
+,<1077,1924,1882>
+,<1077,1882,1883>
+,<1077,2817,2819>
+,<1077,2819,1878>
+,<1077,1878,1923>
+,<1078,6552,6551>
+,<1078,6551,1402>
+,<1078,1402,1371>
+,<1078,1203,6542>
+,<1078,6542,1368>
+,<1078,1368,6552>
+,<1078,1371,1184>
+,<1078,1184,1203>
+,<1079,5138,5166>
+,<1079,5166,5139>
+,<1079,1670,5121>
+,<1079,5121,5138>
+,<1079,5139,5120>
+,<1079,5120,1670>
+,<1080,7153,7158>
+,<1080,7158,7154>
+,<1080,4965,7124>
+,<1080,7124,7153>
+,<1080,7154,7125>
+,<1080,7125,4965>
+,<1081,1270,2294>
+,<1081,2294,1803>
+,<1082,3709,3711>
+,<1082,3711,3710>
+,<1082,1737,3449>
+,<1082,3449,3709>
+,<1082,3710,1701>
+,<1082,1701,1737>
+,<1083,3572,3577>
+,<1083,3577,3573>
+,<1083,1191,2077>
+,<1083,2077,2139>
+,<1083,2139,3532>
+,<1083,3532,3572>
+,<1083,3573,3533>
+,<1083,3533,1203>
+,<1083,1203,1191>
+,<1084,3882,5099>
+,<1084,5099,5065>
+,<1084,1470,3901>
+,<1084,3901,3882>
+,<1084,5065,5063>
+,<1084,5063,1470>
+,<1085,5898,6364>
+,<1085,6364,5909>
+,<1085,5896,4073>
+,<1085,4073,5898>
+,<1085,5909,4508>
+,<1085,4508,5896>
+,<1086,4085,4113>
+,<1086,4113,4084>
+,<1086,4084,2674>
+,<1088,4991,5032>
+,<1088,5032,4992>
+,<1088,4447,4895>
+,<1088,4895,3682>
+,<1088,3682,4991>
+,<1088,4992,4882>
+,<1088,4882,4894>
+,<1088,4894,4447>
+,<1089,3509,3510>
+,<1089,3510,1096>
+,<1089,2206,2475>
+,<1089,2475,3509>
+,<1090,6656,6702>
+,<1090,6702,4199>
+,<1091,5823,5843>
+,<1091,5843,5824>
+,<1092,3454,5306>
+,<1092,5306,1724>
+,<1092,1737,5253>
+,<1092,5253,3454>
+,<1092,1724,4061>
+,<1092,4061,1737>
+,<1093,1717,5376>
+,<1093,5376,5401>
+,<1093,5306,5283>
+,<1093,5283,1717>
+,<1093,5401,5399>
+,<1093,5399,5306>
+,<1094,5868,1677>
+,<1094,1677,5420>
+,<1094,5420,5419>
+,<1094,5631,5843>
+,<1094,5843,5855>
+,<1094,5855,5868>
+,<1095,4896,5032>
+,<1095,5032,4968>
+,<1095,4968,1708>
+,<1095,1708,3711>
+,<1097,6264,6300>
+,<1097,6300,6265>
+,<1097,2407,6235>
+,<1097,6235,6264>
+,<1097,6265,6061>
+,<1097,6061,2407>
+,<1098,4145,4180>
+,<1098,4180,4144>
+,<1098,2206,3264>
+,<1098,3264,4145>
+,<1098,4144,1157>
+,<1098,1157,2206>
+,<1099,4117,4180>
+,<1099,4180,4116>
+,<1099,4116,3254>
+,<1099,3254,2541>
+,<1100,6749,6769>
+,<1100,6769,6748>
+,<1100,3845,1228>
+,<1100,1228,6749>
+,<1100,6748,5754>
+,<1100,5754,3845>
+,<1101,3249,4180>
+,<1101,4180,4174>
+,<1101,2541,4167>
+,<1101,4167,3249>
+,<1101,4174,4168>
+,<1101,4168,2541>
+,<1102,4180,3792>
+,<1102,3792,4171>
+,<1102,3502,4164>
+,<1102,4164,4180>
+,<1102,4171,3791>
+,<1102,3791,3309>
+,<1102,3309,3502>
+,<1104,2149,4180>
+,<1104,4180,4127>
+,<1104,2541,2506>
+,<1104,2506,2149>
+,<1104,4127,4125>
+,<1104,4125,2499>
+,<1104,2499,2541>
+,<1105,5547,5575>
+,<1105,5575,5548>
+,<1105,5548,1654>
+,<1105,1654,4046>
+,<1106,3443,2046>
+,<1106,2046,2053>
+,<1106,2053,2072>
+,<1106,2072,2086>
+,<1107,2042,1350>
+,<1107,1350,2072>
+,<1108,2059,2072>
+,<1108,2072,2062>
+,<1109,2025,2072>
+,<1109,2072,2028>
+,<1110,5532,5575>
+,<1110,5575,5533>
+,<1111,3443,3426>
+,<1111,3426,3406>
+,<1112,1633,2072>
+,<1112,2072,2024>
+,<1113,2032,2072>
+,<1113,2072,2035>
+,<1114,2021,2072>
+,<1114,2072,2020>
+,<1115,6365,5898>
+,<1115,5898,5906>
+,<1115,5906,6366>
+,<1115,6366,4508>
+,<1116,2656,2655>
+,<1116,2655,2008>
+,<1116,2008,2657>
+,<1116,2657,2658>
+,<1116,2658,1623>
+,<1116,1623,2595>
+,<1116,2595,2648>
+,<1116,2648,2590>
+,<1117,2666,2664>
+,<1117,2664,4709>
+,<1117,4709,4685>
+,<1117,2072,2191>
+,<1117,2191,2666>
+,<1117,4685,4494>
+,<1117,4494,2072>
+,<1118,1613,2660>
+,<1118,2660,2659>
+,<1118,2659,2661>
+,<1118,2661,4102>
+,<1118,4102,4691>
+,<1118,4691,4699>
+,<1118,4699,4698>
+,<1118,4698,2586>
+,<1118,2586,2587>
+,<1119,2785,2832>
+,<1119,2832,2787>
+,<1119,2787,1392>
+,<1119,1392,1650>
+,<1119,2732,2786>
+,<1119,2786,2785>
+,<1120,6434,5114>
+,<1120,5114,5150>
+,<1120,5150,6371>
+,<1120,6371,2109>
+,<1120,5146,2115>
+,<1120,2115,6434>
+,<1120,2109,2139>
+,<1120,2139,5146>
+,<1121,3558,1659>
+,<1121,1659,3577>
+,<1121,3577,3569>
+,<1121,2139,3526>
+,<1121,3526,5164>
+,<1121,5164,3558>
+,<1121,3569,2105>
+,<1121,2105,2139>
+,<1122,6568,2441>
+,<1122,2441,5085>
+,<1122,1918,6536>
+,<1122,6536,6568>
+,<1122,5085,5099>
+,<1122,5099,1918>
+,<1123,3912,3863>
+,<1123,3863,1480>
+,<1123,1197,3862>
+,<1123,3862,3912>
+,<1123,1480,1335>
+,<1123,1335,1197>
+,<1124,1397,2731>
+,<1124,2731,1358>
+,<1124,1358,2136>
+,<1124,2136,1357>
+,<1124,1357,2780>
+,<1124,2780,2781>
+,<1125,5373,5317>
+,<1125,5317,2325>
+,<1126,1473,7225>
+,<1126,7225,1901>
+,<1126,1938,2416>
+,<1126,2416,1473>
+,<1126,1901,2414>
+,<1126,2414,1938>
+,<1128,4655,4709>
+,<1128,4709,4656>
+,<1128,4508,2662>
+,<1128,2662,4655>
+,<1128,4656,4104>
+,<1128,4104,4508>
+,<1129,2152,4314>
+,<1129,4314,1509>
+,<1129,1470,1238>
+,<1129,1238,2152>
+,<1130,1372,1402>
+,<1130,1402,1373>
+,<1130,1203,1184>
+,<1130,1184,1372>
+,<1130,1373,1192>
+,<1130,1192,1203>
+,<1131,1401,1402>
+,<1131,1402,2409>
+,<1131,2409,2408>
+,<1131,2408,2472>
+,<1131,2821,2820>
+,<1131,2820,1396>
+,<1131,1396,1186>
+,<1131,1186,2854>
+,<1131,2854,1401>
+,<1131,2472,2471>
+,<1131,2471,2818>
+,<1131,2818,2821>
+,<1132,1841,7187>
+,<1132,7187,7225>
+,<1132,7225,7188>
+,<1132,3853,2268>
+,<1132,2268,2273>
+,<1132,2273,1841>
+,<1132,7188,2258>
+,<1132,2258,3912>
+,<1132,3912,3853>
+,<1133,3778,3721>
+,<1133,3721,3604>
+,<1133,3579,3716>
+,<1133,3716,3778>
+,<1133,3604,3644>
+,<1133,3644,3579>
+,<1134,3482,3510>
+,<1134,3510,3483>
+,<1134,1737,2178>
+,<1134,2178,3482>
+,<1134,3483,5255>
+,<1134,5255,5254>
+,<1134,5254,1737>
+,<1135,1306,1470>
+,<1135,1470,1525>
+,<1135,1203,1521>
+,<1135,1521,1306>
+,<1135,1525,1237>
+,<1135,1237,1203>
+,<1136,3175,6639>
+,<1136,6639,3589>
+,<1136,3125,3127>
+,<1136,3127,3175>
+,<1137,1221,3175>
+,<1137,3175,3113>
+,<1137,3113,1744>
+,<1137,1744,1270>
+,<1138,2679,4687>
+,<1138,4687,5199>
+,<1138,5199,2698>
+,<1138,2698,2677>
+,<1138,2601,2639>
+,<1138,2639,2580>
+,<1138,2580,1611>
+,<1138,1611,2687>
+,<1138,2687,2685>
+,<1138,2685,2683>
+,<1138,2683,2681>
+,<1138,2681,2679>
+,<1138,2677,2675>
+,<1138,2675,2673>
+,<1138,2673,2671>
+,<1138,2671,0>
+,<1138,0,2585>
+,<1138,2585,2641>
+,<1138,2641,2601>
+,<1139,1917,5099>
+,<1139,5099,1348>
+,<1139,1203,1527>
+,<1139,1527,1917>
+,<1139,1348,5083>
+,<1139,5083,1203>
+,<1140,1936,1938>
+,<1140,1938,1937>
+,<1141,2340,2303>
+,<1141,2303,5319>
+,<1141,5319,1241>
+,<1142,2244,2273>
+,<1142,2273,2245>
+,<1142,1335,2210>
+,<1142,2210,2244>
+,<1143,2939,2938>
+,<1143,2938,2940>
+,<1143,2940,2941>
+,<1143,3008,3007>
+,<1143,3007,2931>
+,<1143,2931,2939>
+,<1143,2941,2928>
+,<1143,2928,2951>
+,<1143,2951,3016>
+,<1143,3016,3008>
+,<1144,2961,2962>
+,<1144,2962,1823>
+,<1144,1823,1800>
+,<1144,1790,1821>
+,<1144,1821,2960>
+,<1144,2960,2961>
+,<1144,1800,1804>
+,<1144,1804,1790>
+,<1145,1249,2947>
+,<1145,2947,2946>
+,<1145,1871,2948>
+,<1145,2948,1249>
+,<1146,7229,7292>
+,<1146,7292,7228>
+,<1146,3979,3151>
+,<1146,3151,7229>
+,<1146,7228,3775>
+,<1146,3775,3979>
+,<1147,2938,2939>
+,<1147,2939,2931>
+,<1147,2931,2937>
+,<1147,2937,2936>
+,<1147,2952,3015>
+,<1147,3015,3009>
+,<1147,3009,1794>
+,<1147,1794,2940>
+,<1147,2940,2938>
+,<1147,2936,2934>
+,<1147,2934,2319>
+,<1147,2319,2320>
+,<1147,2320,3006>
+,<1147,3006,3017>
+,<1147,3017,2952>
+,<1148,1159,4641>
+,<1148,4641,4599>
+,<1148,3644,3580>
+,<1148,3580,4598>
+,<1148,4598,1159>
+,<1148,4599,3937>
+,<1148,3937,3644>
+,<1149,1218,1270>
+,<1149,1270,1219>
+,<1150,5709,1736>
+,<1150,1736,3730>
+,<1150,2494,1234>
+,<1150,1234,5709>
+,<1150,3730,4247>
+,<1150,4247,2494>
+,<1151,7246,7292>
+,<1151,7292,7247>
+,<1151,3778,4620>
+,<1151,4620,7246>
+,<1152,5728,5776>
+,<1152,5776,5731>
+,<1152,4247,5727>
+,<1152,5727,5728>
+,<1152,5731,4222>
+,<1152,4222,4247>
+,<1153,1514,1470>
+,<1153,1470,1513>
+,<1153,1203,1322>
+,<1153,1322,1514>
+,<1154,3584,3644>
+,<1154,3644,3586>
+,<1154,3175,3132>
+,<1154,3132,3584>
+,<1154,3586,3582>
+,<1154,3582,3175>
+,<1155,1522,1470>
+,<1155,1470,1523>
+,<1155,1203,1321>
+,<1155,1321,1522>
+,<1155,1523,1521>
+,<1155,1521,1203>
+,<1156,3036,2981>
+,<1156,2981,3034>
+,<1156,3034,1749>
+,<1156,1749,3043>
+,<1156,3043,1832>
+,<1156,1842,1783>
+,<1156,1783,3037>
+,<1156,3037,3038>
+,<1156,3038,3036>
+,<1157,4144,4180>
+,<1157,4180,4147>
+,<1157,4147,2511>
+,<1157,2511,2206>
+,<1158,3121,3175>
+,<1158,3175,3124>
+,<1159,4598,3640>
+,<1159,3640,3922>
+,<1159,3922,4641>
+,<1160,3979,1766>
+,<1160,1766,3913>
+,<1160,1786,3978>
+,<1160,3978,3979>
+,<1160,3913,1804>
+,<1160,1804,1786>
+,<1161,6481,6501>
+,<1161,6501,6480>
+,<1161,2575,2576>
+,<1161,2576,4107>
+,<1161,4107,6481>
+,<1161,6480,4487>
+,<1161,4487,2574>
+,<1161,2574,2575>
+,<1162,4641,3714>
+,<1162,3714,3931>
+,<1162,3935,3631>
+,<1162,3631,4641>
+,<1162,3931,3175>
+,<1162,3175,3935>
+,<1163,3475,3510>
+,<1163,3510,3476>
+,<1163,1737,3452>
+,<1163,3452,3475>
+,<1163,3476,3453>
+,<1163,3453,1737>
+,<1164,4192,4247>
+,<1164,4247,4193>
+,<1164,3644,3133>
+,<1164,3133,4192>
+,<1164,4193,1728>
+,<1164,1728,3644>
+,<1165,3260,4180>
+,<1165,4180,4138>
+,<1165,2206,2193>
+,<1165,2193,3260>
+,<1165,4138,4136>
+,<1165,4136,2206>
+,<1166,6766,7158>
+,<1166,7158,7108>
+,<1166,3778,5752>
+,<1166,5752,6766>
+,<1166,7108,6707>
+,<1166,6707,3778>
+,<1167,2194,4314>
+,<1167,4314,3844>
+,<1167,3844,1506>
+,<1167,1506,1470>
+,<1168,3467,3510>
+,<1168,3510,3468>
+,<1168,1737,2168>
+,<1168,2168,3466>
+,<1168,3466,3467>
+,<1168,3468,1685>
+,<1168,1685,1737>
+,<1169,5044,5099>
+,<1169,5099,5043>
+,<1169,3912,3889>
+,<1169,3889,5044>
+,<1169,5043,2436>
+,<1169,2436,3912>
+,<1170,3746,4965>
+,<1170,4965,4916>
+,<1170,3778,4913>
+,<1170,4913,3769>
+,<1170,3769,3746>
+,<1170,4916,1493>
+,<1170,1493,3778>
+,<1171,4954,4965>
+,<1171,4965,4955>
+,<1171,1335,3771>
+,<1171,3771,4954>
+,<1171,4955,3745>
+,<1171,3745,1335>
+,<1172,1515,1470>
+,<1172,1470,1518>
+,<1172,1203,1308>
+,<1172,1308,1515>
+,<1173,2082,3808>
+,<1173,3808,2544>
+,<1173,2544,1380>
+,<1173,1380,2546>
+,<1173,2546,2547>
+,<1173,2547,1361>
+,<1173,1361,2619>
+,<1173,2619,2628>
+,<1173,2628,2565>
+,<1174,2553,2552>
+,<1174,2552,1176>
+,<1174,1176,2554>
+,<1174,2554,2555>
+,<1175,2557,2556>
+,<1175,2556,2558>
+,<1175,2558,2559>
+,<1175,2559,2560>
+,<1176,2552,2550>
+,<1176,2550,1177>
+,<1176,1177,2564>
+,<1176,2564,2625>
+,<1176,2625,2103>
+,<1177,2548,2546>
+,<1177,2546,1380>
+,<1177,1380,2618>
+,<1177,2618,2627>
+,<1177,2627,2564>
+,<1178,6744,6769>
+,<1178,6769,6747>
+,<1178,3845,3298>
+,<1178,3298,6744>
+,<1178,6747,6442>
+,<1178,6442,3845>
+,<1179,5205,5233>
+,<1179,5233,5206>
+,<1179,1670,2066>
+,<1179,2066,5205>
+,<1179,5206,2686>
+,<1179,2686,1670>
+,<1180,5776,5747>
+,<1180,5747,5705>
+,<1180,2493,5710>
+,<1180,5710,5776>
+,<1180,5705,2541>
+,<1180,2541,2493>
+,<1181,5485,5508>
+,<1181,5508,5486>
+,<1181,2139,2078>
+,<1181,2078,5485>
+,<1181,5486,5469>
+,<1181,5469,2139>
+,<1182,5483,5508>
+,<1182,5508,5484>
+,<1182,2139,1381>
+,<1182,1381,5483>
+,<1182,5484,2078>
+,<1182,2078,2139>
+,<1183,2589,2645>
+,<1183,2645,2597>
+,<1183,2597,2659>
+,<1183,2659,2660>
+,<1183,2660,2071>
+,<1183,2009,2657>
+,<1183,2657,2008>
+,<1183,2008,2594>
+,<1183,2594,2647>
+,<1183,2647,2589>
+,<1184,1371,1402>
+,<1184,1402,1372>
+,<1185,3856,3912>
+,<1185,3912,1533>
+,<1185,2273,3855>
+,<1185,3855,3856>
+,<1185,1533,1313>
+,<1185,1313,2273>
+,<1186,2841,1651>
+,<1186,1651,2856>
+,<1186,2856,2854>
+,<1186,1396,2838>
+,<1186,2838,1398>
+,<1186,1398,2841>
+,<1187,1395,2835>
+,<1187,2835,2837>
+,<1187,2837,1391>
+,<1187,2834,1394>
+,<1187,1394,1988>
+,<1187,1988,2137>
+,<1187,2137,1395>
+,<1187,1391,2789>
+,<1187,2789,2788>
+,<1187,2788,2834>
+,<1188,4340,4381>
+,<1188,4381,4341>
+,<1188,2882,2884>
+,<1188,2884,3363>
+,<1188,3363,4340>
+,<1188,4341,1664>
+,<1188,1664,2880>
+,<1188,2880,2882>
+,<1189,5508,2075>
+,<1189,2075,2138>
+,<1189,4003,5452>
+,<1189,5452,5508>
+,<1189,2138,1402>
+,<1189,1402,4003>
+,<1190,2015,2072>
+,<1190,2072,2019>
+,<1191,1203,5466>
+,<1191,5466,5480>
+,<1191,5480,2077>
+,<1192,1373,1402>
+,<1192,1402,1374>
+,<1192,1374,1193>
+,<1192,1193,1203>
+,<1193,1374,1402>
+,<1193,1402,1375>
+,<1193,1375,2842>
+,<1193,2842,5464>
+,<1193,5464,2847>
+,<1193,2847,1203>
+,<1194,1369,6568>
+,<1194,6568,5086>
+,<1194,5099,5076>
+,<1194,5076,1369>
+,<1194,5086,5038>
+,<1194,5038,5099>
+,<1195,6504,6568>
+,<1195,6568,3909>
+,<1195,2474,3891>
+,<1195,3891,6504>
+,<1195,3909,1919>
+,<1195,1919,2474>
+,<1196,2474,2465>
+,<1196,2465,1366>
+,<1196,2461,2463>
+,<1196,2463,2474>
+,<1196,1366,1402>
+,<1196,1402,2461>
+,<1197,1335,1874>
+,<1197,1874,3862>
+,<1198,2335,2340>
+,<1198,2340,2336>
+,<1199,2449,2474>
+,<1199,2474,2452>
+,<1199,1402,2448>
+,<1199,2448,2449>
+,<1199,2452,1835>
+,<1199,1835,1402>
+,<1200,1876,1938>
+,<1200,1938,2469>
+,<1200,2474,2411>
+,<1200,2411,1876>
+,<1201,1851,1938>
+,<1201,1938,1782>
+,<1202,1926,1938>
+,<1202,1938,1927>
+,<1203,5083,5084>
+,<1203,5084,5082>
+,<1203,3880,3895>
+,<1203,3895,3879>
+,<1203,2255,3896>
+,<1203,3896,3880>
+,<1203,3872,3898>
+,<1203,3898,2255>
+,<1203,2437,3897>
+,<1203,3897,3872>
+,<1203,3886,5070>
+,<1203,5070,2437>
+,<1203,1479,5034>
+,<1203,5034,3886>
+,<1203,1526,5033>
+,<1203,5033,1479>
+,<1203,1323,3865>
+,<1203,3865,5069>
+,<1203,5069,1526>
+,<1203,1237,1524>
+,<1203,1524,1323>
+,<1203,1305,1519>
+,<1203,1519,1321>
+,<1203,1510,1511>
+,<1203,1511,1322>
+,<1203,2726,4313>
+,<1203,4313,1645>
+,<1203,2532,4312>
+,<1203,4312,2726>
+,<1203,4264,4311>
+,<1203,4311,2532>
+,<1203,3512,4310>
+,<1203,4310,4264>
+,<1203,4263,4309>
+,<1203,4309,3512>
+,<1203,1661,4308>
+,<1203,4308,4263>
+,<1203,4262,4307>
+,<1203,4307,1661>
+,<1203,2718,4306>
+,<1203,4306,4262>
+,<1203,3815,4305>
+,<1203,4305,2718>
+,<1203,2530,4304>
+,<1203,4304,3815>
+,<1203,1605,4303>
+,<1203,4303,2530>
+,<1203,4265,4302>
+,<1203,4302,1605>
+,<1203,1319,4266>
+,<1203,4266,4265>
+,<1203,2079,1621>
+,<1203,1621,1319>
+,<1203,1310,2722>
+,<1203,2722,2079>
+,<1203,3533,3574>
+,<1203,3574,2102>
+,<1203,4347,2074>
+,<1203,2074,5466>
+,<1203,3421,5465>
+,<1203,5465,4347>
+,<1203,2847,1647>
+,<1203,1647,3421>
+,<1203,1530,5087>
+,<1203,5087,6542>
+,<1203,3902,6541>
+,<1203,6541,1530>
+,<1203,2440,6540>
+,<1203,6540,3902>
+,<1203,5074,1346>
+,<1203,1346,2440>
+,<1203,5082,5073>
+,<1203,5073,5074>
+,<1204,4576,4577>
+,<1204,4577,3175>
+,<1204,3175,3110>
+,<1204,1804,3629>
+,<1204,3629,3613>
+,<1204,3613,4576>
+,<1204,3110,1225>
+,<1204,1225,1804>
+,<1205,4584,4641>
+,<1205,4641,3146>
+,<1205,3175,2227>
+,<1205,2227,4584>
+,<1205,3146,4583>
+,<1205,4583,3175>
+,<1206,4535,4575>
+,<1206,4575,4536>
+,<1207,6584,6583>
+,<1207,6583,1270>
+,<1207,1270,1218>
+,<1213,6593,6635>
+,<1213,6635,6594>
+,<1213,1270,6583>
+,<1213,6583,6593>
+,<1213,6594,4409>
+,<1213,4409,1270>
+,<1214,6630,6635>
+,<1214,6635,6631>
+,<1214,4740,3680>
+,<1214,3680,4742>
+,<1214,4742,3678>
+,<1214,3678,6630>
+,<1215,6635,1672>
+,<1215,1672,4741>
+,<1215,5942,4425>
+,<1215,4425,6635>
+,<1216,4731,6634>
+,<1216,6634,6635>
+,<1217,6610,6635>
+,<1217,6635,6611>
+,<1217,4575,4739>
+,<1217,4739,6610>
+,<1222,3979,3150>
+,<1222,3150,3152>
+,<1222,2215,3918>
+,<1222,3918,3979>
+,<1222,3152,1804>
+,<1222,1804,2215>
+,<1223,7234,7292>
+,<1223,7292,3927>
+,<1223,4641,7233>
+,<1223,7233,7234>
+,<1223,3927,4618>
+,<1223,4618,4641>
+,<1225,3110,3175>
+,<1225,3175,3159>
+,<1225,3159,1289>
+,<1225,1289,1804>
+,<1226,3979,3958>
+,<1226,3958,1274>
+,<1226,3946,3924>
+,<1226,3924,3979>
+,<1226,1274,2972>
+,<1226,2972,2973>
+,<1226,2973,3946>
+,<1227,5685,5709>
+,<1227,5709,5684>
+,<1227,2206,5648>
+,<1227,5648,5685>
+,<1227,5684,5647>
+,<1227,5647,2206>
+,<1228,6746,6769>
+,<1228,6769,6749>
+,<1228,3845,6442>
+,<1228,6442,6746>
+,<1229,1742,6702>
+,<1229,6702,6640>
+,<1230,6647,6702>
+,<1230,6702,6648>
+,<1232,3976,3979>
+,<1232,3979,3977>
+,<1232,1804,3952>
+,<1232,3952,3976>
+,<1233,6667,6702>
+,<1233,6702,2491>
+,<1233,5709,4200>
+,<1233,4200,6667>
+,<1233,2491,4197>
+,<1233,4197,5709>
+,<1234,4213,1735>
+,<1234,1735,5709>
+,<1234,2494,4247>
+,<1234,4247,4213>
+,<1235,4638,4641>
+,<1235,4641,4637>
+,<1235,3979,4588>
+,<1235,4588,4638>
+,<1235,4637,4587>
+,<1235,4587,3979>
+,<1236,1470,1481>
+,<1236,1481,1271>
+,<1236,1315,2425>
+,<1236,2425,1910>
+,<1236,1910,1470>
+,<1236,1271,1335>
+,<1236,1335,1315>
+,<1237,1525,1470>
+,<1237,1470,1524>
+,<1238,1508,3843>
+,<1238,3843,4314>
+,<1238,4314,2152>
+,<1239,5313,5314>
+,<1239,5314,5373>
+,<1240,2299,2297>
+,<1240,2297,1270>
+,<1241,5319,5373>
+,<1241,5373,2317>
+,<1241,2317,2326>
+,<1242,1739,1804>
+,<1242,1804,1738>
+,<1243,3115,3175>
+,<1243,3175,1767>
+,<1244,6680,6702>
+,<1244,6702,2154>
+,<1244,4247,2205>
+,<1244,2205,6680>
+,<1244,2154,2158>
+,<1244,2158,4247>
+,<1245,3119,3175>
+,<1245,3175,3122>
+,<1246,1741,3175>
+,<1246,3175,3169>
+,<1246,1270,3163>
+,<1246,3163,1741>
+,<1246,3169,3164>
+,<1246,3164,1270>
+,<1247,1802,2340>
+,<1247,2340,1809>
+,<1247,1809,1810>
+,<1247,1810,1804>
+,<1248,2291,2289>
+,<1248,2289,1270>
+,<1249,2948,3012>
+,<1249,3012,3010>
+,<1249,3010,2929>
+,<1249,2929,2947>
+,<1250,5310,5373>
+,<1250,5373,5309>
+,<1250,2340,2313>
+,<1250,2313,5310>
+,<1251,2932,5373>
+,<1251,5373,5307>
+,<1251,2340,2304>
+,<1251,2304,2932>
+,<1251,5307,2313>
+,<1251,2313,2340>
+,<1252,2300,2340>
+,<1252,2340,1757>
+,<1252,1804,1810>
+,<1252,1810,2300>
+,<1253,1270,2286>
+,<1253,2286,2287>
+,<1254,2278,2340>
+,<1254,2340,1257>
+,<1254,1270,2279>
+,<1254,2279,2278>
+,<1258,1559,2284>
+,<1258,2284,2340>
+,<1259,2282,2340>
+,<1259,2340,2285>
+,<1259,1270,2281>
+,<1259,2281,2282>
+,<1270,4532,6596>
+,<1270,6596,6582>
+,<1270,4409,6595>
+,<1270,6595,4532>
+,<1270,1744,1290>
+,<1270,1290,1341>
+,<1270,1276,3171>
+,<1270,3171,3165>
+,<1270,3164,3170>
+,<1270,3170,1276>
+,<1270,3166,3162>
+,<1270,3162,3163>
+,<1270,2297,2298>
+,<1270,2298,1279>
+,<1270,2275,2296>
+,<1270,2296,2294>
+,<1270,1282,2295>
+,<1270,2295,2275>
+,<1270,2274,2292>
+,<1270,2292,1282>
+,<1272,4942,4965>
+,<1272,4965,4943>
+,<1272,1470,4908>
+,<1272,4908,7145>
+,<1272,7145,7127>
+,<1272,7127,4942>
+,<1272,4943,4907>
+,<1272,4907,1470>
+,<1273,3080,3081>
+,<1273,3081,3082>
+,<1273,3082,1855>
+,<1273,1855,3063>
+,<1273,3075,3078>
+,<1273,3078,3077>
+,<1273,3077,3080>
+,<1273,3063,1938>
+,<1273,1938,3075>
+,<1274,3958,2271>
+,<1274,2271,2971>
+,<1274,2971,2972>
+,<1275,7223,7225>
+,<1275,7225,7224>
+,<1275,1938,7167>
+,<1275,7167,7223>
+,<1275,7224,2419>
+,<1275,2419,1938>
+,<1276,3170,3175>
+,<1276,3175,3171>
+,<1277,1289,3159>
+,<1277,3159,3175>
+,<1278,1341,1290>
+,<1278,1290,3175>
+,<1278,3175,3117>
+,<1280,5373,5308>
+,<1280,5308,2323>
+,<1280,2329,2930>
+,<1280,2930,5373>
+,<1280,2323,2340>
+,<1280,2340,2329>
+,<1282,2292,2340>
+,<1282,2340,2295>
+,<1283,7238,7292>
+,<1283,7292,7239>
+,<1283,4641,4585>
+,<1283,4585,7238>
+,<1283,7239,3945>
+,<1283,3945,4641>
+,<1284,4641,4601>
+,<1284,4601,3936>
+,<1284,3937,4599>
+,<1284,4599,4641>
+,<1284,3936,3644>
+,<1284,3644,3937>
+,<1285,3633,4641>
+,<1285,4641,3938>
+,<1285,3175,3921>
+,<1285,3921,3633>
+,<1285,3938,3939>
+,<1285,3939,3175>
+,<1286,2218,3979>
+,<1286,3979,3916>
+,<1286,1804,1326>
+,<1286,1326,2218>
+,<1286,3916,2217>
+,<1286,2217,1804>
+,<1287,4221,5776>
+,<1287,5776,5736>
+,<1287,4247,4216>
+,<1287,4216,4221>
+,<1287,5736,5734>
+,<1287,5734,2148>
+,<1287,2148,4247>
+,<1288,1765,7292>
+,<1288,7292,7257>
+,<1288,1335,4624>
+,<1288,4624,1765>
+,<1290,1744,3113>
+,<1290,3113,3175>
+,<1291,3728,3778>
+,<1291,3778,3601>
+,<1291,3644,3137>
+,<1291,3137,3728>
+,<1291,3601,4187>
+,<1291,4187,4188>
+,<1291,4188,4185>
+,<1291,4185,3644>
+,<1292,3588,3644>
+,<1292,3644,3587>
+,<1292,3175,2225>
+,<1292,2225,3588>
+,<1293,6501,6464>
+,<1293,6464,3780>
+,<1293,3780,1644>
+,<1293,1352,6461>
+,<1293,6461,6501>
+,<1293,1644,4482>
+,<1293,4482,4508>
+,<1293,4508,1352>
+,<1294,3250,4180>
+,<1294,4180,4164>
+,<1294,3309,3501>
+,<1294,3501,3250>
+,<1294,4164,3502>
+,<1294,3502,3309>
+,<1295,3510,4383>
+,<1295,4383,7424>
+,<1295,7424,5967>
+,<1295,5967,1727>
+,<1295,2185,2172>
+,<1295,2172,3510>
+,<1295,1727,2206>
+,<1295,2206,2185>
+,<1296,7373,7426>
+,<1296,7426,7374>
+,<1297,1684,3510>
+,<1297,3510,2165>
+,<1297,2165,1726>
+,<1297,1726,2206>
+,<1298,5306,3490>
+,<1298,3490,4151>
+,<1298,4151,1737>
+,<1298,1737,2014>
+,<1299,6682,6684>
+,<1299,6684,6702>
+,<1299,6702,6683>
+,<1299,6683,3592>
+,<1299,3592,3644>
+,<1300,2206,4130>
+,<1300,4130,4131>
+,<1301,4158,4180>
+,<1301,4180,4157>
+,<1301,4157,2198>
+,<1301,2198,3309>
+,<1302,2447,2445>
+,<1302,2445,1402>
+,<1303,2273,2429>
+,<1303,2429,1330>
+,<1303,1531,2254>
+,<1303,2254,2273>
+,<1304,3539,3845>
+,<1304,3845,3807>
+,<1304,2617,2616>
+,<1304,2616,3511>
+,<1304,3511,3539>
+,<1305,1520,1470>
+,<1305,1470,1519>
+,<1306,1521,1523>
+,<1306,1523,1470>
+,<1308,1516,1470>
+,<1308,1470,1515>
+,<1309,6662,6702>
+,<1309,6702,6661>
+,<1310,3576,3577>
+,<1310,3577,2722>
+,<1311,1470,1487>
+,<1311,1487,1342>
+,<1312,4935,7158>
+,<1312,7158,7115>
+,<1312,7115,6709>
+,<1312,5776,3742>
+,<1312,3742,4935>
+,<1312,6709,6708>
+,<1312,6708,5776>
+,<1313,1533,3912>
+,<1313,3912,2431>
+,<1313,2431,1337>
+,<1313,1337,2273>
+,<1314,3912,3876>
+,<1314,3876,1336>
+,<1314,1336,1470>
+,<1314,1470,3866>
+,<1315,1335,2260>
+,<1315,2260,3864>
+,<1315,3864,2425>
+,<1316,7232,7292>
+,<1316,7292,7235>
+,<1316,4641,4617>
+,<1316,4617,7232>
+,<1316,7235,7233>
+,<1316,7233,4641>
+,<1317,7099,7158>
+,<1317,7158,7098>
+,<1317,4965,6706>
+,<1317,6706,7099>
+,<1317,7098,3515>
+,<1317,3515,4965>
+,<1318,7149,7158>
+,<1318,7158,7150>
+,<1318,4965,7122>
+,<1318,7122,7149>
+,<1318,7150,7123>
+,<1318,7123,4965>
+,<1319,1621,3577>
+,<1319,3577,3783>
+,<1319,3783,4266>
+,<1320,7105,7158>
+,<1320,7158,7093>
+,<1320,3778,5760>
+,<1320,5760,7105>
+,<1320,7093,2230>
+,<1320,2230,3778>
+,<1321,1519,1470>
+,<1321,1470,1522>
+,<1322,1511,1470>
+,<1322,1470,1514>
+,<1324,2265,6568>
+,<1324,6568,6514>
+,<1324,3912,5093>
+,<1324,5093,2265>
+,<1324,6514,3873>
+,<1324,3873,3912>
+,<1325,4244,4247>
+,<1325,4247,4245>
+,<1325,3778,3607>
+,<1325,3607,4244>
+,<1325,4245,3603>
+,<1325,3603,3778>
+,<1326,2213,3979>
+,<1326,3979,2218>
+,<1327,1831,3054>
+,<1327,3054,7225>
+,<1328,7190,7225>
+,<1328,7225,7191>
+,<1328,3912,7159>
+,<1328,7159,7190>
+,<1328,7191,7162>
+,<1328,7162,3912>
+,<1329,3979,3154>
+,<1329,3154,1824>
+,<1329,1825,3150>
+,<1329,3150,3979>
+,<1329,1824,1804>
+,<1329,1804,1825>
+,<1330,2429,2266>
+,<1330,2266,3912>
+,<1331,2236,2273>
+,<1331,2273,2237>
+,<1331,1335,1746>
+,<1331,1746,2236>
+,<1331,2237,1777>
+,<1331,1777,1335>
+,<1332,2464,2466>
+,<1332,2466,2474>
+,<1333,1817,3002>
+,<1333,3002,3022>
+,<1333,3022,2957>
+,<1333,2957,1816>
+,<1333,1804,1806>
+,<1333,1806,1817>
+,<1333,1816,1801>
+,<1333,1801,1804>
+,<1334,2997,2996>
+,<1334,2996,3967>
+,<1334,3967,3966>
+,<1334,3966,1778>
+,<1334,1799,1819>
+,<1334,1819,2998>
+,<1334,2998,2997>
+,<1334,1778,1804>
+,<1334,1804,1799>
+,<1335,1827,2243>
+,<1335,2243,2210>
+,<1335,2209,2242>
+,<1335,2242,1827>
+,<1335,1843,2241>
+,<1335,2241,2209>
+,<1335,1784,2240>
+,<1335,2240,1843>
+,<1335,1770,2239>
+,<1335,2239,1784>
+,<1335,1777,2238>
+,<1335,2238,1770>
+,<1335,1769,2235>
+,<1335,2235,1746>
+,<1335,1837,2234>
+,<1335,2234,1769>
+,<1335,3760,4899>
+,<1335,4899,4592>
+,<1335,4592,4624>
+,<1335,1378,4900>
+,<1335,4900,3760>
+,<1335,3768,3619>
+,<1335,3619,1378>
+,<1335,4253,2724>
+,<1335,2724,3768>
+,<1335,3767,2478>
+,<1335,2478,4253>
+,<1335,1498,2529>
+,<1335,2529,3767>
+,<1335,3766,3747>
+,<1335,3747,1498>
+,<1335,2477,3762>
+,<1335,3762,3766>
+,<1335,1497,3749>
+,<1335,3749,2477>
+,<1335,3748,3763>
+,<1335,3763,1497>
+,<1335,1729,3765>
+,<1335,3765,3748>
+,<1335,3751,3764>
+,<1335,3764,1729>
+,<1335,3757,4964>
+,<1335,4964,3751>
+,<1335,2540,4963>
+,<1335,4963,3757>
+,<1335,3770,4962>
+,<1335,4962,2540>
+,<1335,3758,4961>
+,<1335,4961,3770>
+,<1335,4904,4960>
+,<1335,4960,3758>
+,<1335,3753,4959>
+,<1335,4959,4904>
+,<1335,4903,4958>
+,<1335,4958,3753>
+,<1335,3750,4957>
+,<1335,4957,4903>
+,<1335,3745,4956>
+,<1335,4956,3750>
+,<1335,2147,4953>
+,<1335,4953,3771>
+,<1335,4905,4952>
+,<1335,4952,2147>
+,<1335,4901,4951>
+,<1335,4951,4905>
+,<1335,3618,4950>
+,<1335,4950,4901>
+,<1335,4902,4949>
+,<1335,4949,3618>
+,<1335,1485,3772>
+,<1335,3772,4948>
+,<1335,4948,4902>
+,<1335,1342,1487>
+,<1335,1487,1485>
+,<1335,1480,3863>
+,<1335,3863,2260>
+,<1335,1920,3861>
+,<1335,3861,1874>
+,<1335,1873,1903>
+,<1335,1903,1477>
+,<1335,2250,2253>
+,<1335,2253,1873>
+,<1335,1886,2252>
+,<1335,2252,2250>
+,<1335,2208,2251>
+,<1335,2251,1886>
+,<1335,2248,2247>
+,<1335,2247,2208>
+,<1335,2207,2249>
+,<1335,2249,2248>
+,<1335,1475,1902>
+,<1335,1902,2207>
+,<1336,3876,1476>
+,<1336,1476,1470>
+,<1337,2431,3912>
+,<1337,3912,3859>
+,<1337,3859,2267>
+,<1337,2267,2273>
+,<1338,1847,1938>
+,<1338,1938,3063>
+,<1338,3063,1855>
+,<1339,7202,7225>
+,<1339,7225,7203>
+,<1339,2474,2423>
+,<1339,2423,7202>
+,<1339,7203,1907>
+,<1339,1907,2474>
+,<1340,5350,5373>
+,<1340,5373,5984>
+,<1340,5984,6008>
+,<1340,6008,5362>
+,<1340,3099,3102>
+,<1340,3102,3104>
+,<1340,3104,3098>
+,<1340,3098,5350>
+,<1340,5362,6009>
+,<1340,6009,5982>
+,<1340,5982,3097>
+,<1340,3097,3099>
+,<1343,4621,7245>
+,<1343,7245,7292>
+,<1343,7292,7246>
+,<1343,7246,4620>
+,<1343,3144,3941>
+,<1343,3941,4611>
+,<1343,4611,4641>
+,<1343,4641,4621>
+,<1343,4620,3778>
+,<1343,3778,3718>
+,<1343,3718,2488>
+,<1343,2488,3144>
+,<1344,2468,2474>
+,<1344,2474,2467>
+,<1344,2467,1916>
+,<1344,1916,1402>
+,<1345,3874,6568>
+,<1345,6568,3894>
+,<1345,5099,6530>
+,<1345,6530,3874>
+,<1345,3894,6534>
+,<1345,6534,5099>
+,<1346,1367,6568>
+,<1346,6568,6540>
+,<1346,6540,2440>
+,<1346,5074,5073>
+,<1346,5073,5099>
+,<1346,5099,5038>
+,<1346,5038,1367>
+,<1347,1904,2474>
+,<1347,2474,2459>
+,<1347,1402,2455>
+,<1347,2455,1904>
+,<1347,2459,1536>
+,<1347,1536,1402>
+,<1348,5099,5084>
+,<1348,5084,5083>
+,<1349,6568,6554>
+,<1349,6554,6549>
+,<1349,6543,5088>
+,<1349,5088,6568>
+,<1349,6549,1402>
+,<1349,1402,6543>
+,<1350,2042,3443>
+,<1350,3443,2041>
+,<1351,3443,1642>
+,<1351,1642,2048>
+,<1351,2048,5518>
+,<1351,5518,1641>
+,<1351,3394,3396>
+,<1351,3396,3443>
+,<1352,4508,3307>
+,<1352,3307,6461>
+,<1353,5508,5459>
+,<1353,5459,4022>
+,<1353,4022,1402>
+,<1353,1402,1399>
+,<1354,5494,5508>
+,<1354,5508,5495>
+,<1354,2127,2139>
+,<1354,2139,5476>
+,<1354,5476,5494>
+,<1354,5495,5475>
+,<1354,5475,4381>
+,<1354,4381,4356>
+,<1354,4356,2127>
+,<1355,1393,1942>
+,<1355,1942,2783>
+,<1355,2783,2784>
+,<1356,1988,1394>
+,<1356,1394,1942>
+,<1356,1942,1393>
+,<1356,1392,2787>
+,<1356,2787,2830>
+,<1356,2830,2782>
+,<1356,2782,2137>
+,<1356,2137,1988>
+,<1357,2136,1358>
+,<1357,1358,2839>
+,<1357,2839,1398>
+,<1357,1398,2838>
+,<1357,2838,1396>
+,<1357,1396,2820>
+,<1357,2820,2780>
+,<1358,2731,2836>
+,<1358,2836,2835>
+,<1358,2835,1395>
+,<1358,1395,2137>
+,<1358,2137,2782>
+,<1358,2782,2828>
+,<1358,2828,2792>
+,<1358,2792,2839>
+,<1359,4373,4381>
+,<1359,4381,4374>
+,<1359,4046,4000>
+,<1359,4000,4373>
+,<1359,4374,3991>
+,<1359,3991,4046>
+,<1360,2711,2706>
+,<1360,2706,1607>
+,<1360,1607,5185>
+,<1360,5185,2709>
+,<1360,2573,2633>
+,<1360,2633,2613>
+,<1360,2613,1620>
+,<1360,1620,2719>
+,<1360,2719,2717>
+,<1360,2717,2715>
+,<1360,2715,2713>
+,<1360,2713,2711>
+,<1360,2709,2707>
+,<1360,2707,2705>
+,<1360,2705,2703>
+,<1360,2703,2701>
+,<1360,2701,2699>
+,<1360,2699,2592>
+,<1360,2592,2607>
+,<1360,2607,2635>
+,<1360,2635,2573>
+,<1361,2547,2546>
+,<1361,2546,2548>
+,<1361,2548,2549>
+,<1362,1635,2072>
+,<1362,2072,2033>
+,<1363,6498,6493>
+,<1363,6493,3845>
+,<1364,2451,2474>
+,<1364,2474,2454>
+,<1364,1402,1835>
+,<1364,1835,2451>
+,<1364,2454,2261>
+,<1364,2261,1402>
+,<1365,6561,6568>
+,<1365,6568,6562>
+,<1365,2474,6546>
+,<1365,6546,6561>
+,<1365,6562,1913>
+,<1365,1913,2474>
+,<1366,2465,1905>
+,<1366,1905,1402>
+,<1367,5038,5086>
+,<1367,5086,6568>
+,<1368,6568,6553>
+,<1368,6553,6551>
+,<1368,6551,6552>
+,<1368,6542,5087>
+,<1368,5087,6568>
+,<1369,5076,6539>
+,<1369,6539,6568>
+,<1370,5081,6555>
+,<1370,6555,6568>
+,<1370,6568,6556>
+,<1370,6556,6548>
+,<1370,2442,1402>
+,<1370,1402,5081>
+,<1370,6548,2474>
+,<1370,2474,2443>
+,<1370,2443,2442>
+,<1375,1663,5508>
+,<1375,5508,5464>
+,<1375,5464,2842>
+,<1375,1402,4348>
+,<1375,4348,1663>
+,<1376,2076,5508>
+,<1376,5508,5458>
+,<1376,1402,2893>
+,<1376,2893,2076>
+,<1376,5458,4349>
+,<1376,4349,1402>
+,<1377,5449,5508>
+,<1377,5508,2859>
+,<1377,1402,4352>
+,<1377,4352,5449>
+,<1377,2859,4016>
+,<1377,4016,1402>
+,<1378,3619,4965>
+,<1378,4965,4900>
+,<1379,4508,4058>
+,<1379,4058,4454>
+,<1379,3244,1504>
+,<1379,1504,4508>
+,<1379,4454,3309>
+,<1379,3309,3244>
+,<1380,2544,1604>
+,<1380,1604,2729>
+,<1380,2729,2068>
+,<1380,2068,2567>
+,<1380,2567,2629>
+,<1380,2629,2618>
+,<1381,5482,5508>
+,<1381,5508,5483>
+,<1382,3443,1625>
+,<1382,1625,2124>
+,<1382,2054,2043>
+,<1382,2043,3443>
+,<1382,2124,2072>
+,<1382,2072,2054>
+,<1383,5549,5575>
+,<1383,5575,5550>
+,<1383,4046,1654>
+,<1383,1654,5549>
+,<1383,5550,3391>
+,<1383,3391,4046>
+,<1384,1626,2034>
+,<1384,2034,2072>
+,<1385,4326,4381>
+,<1385,4381,4327>
+,<1385,3376,4322>
+,<1385,4322,4326>
+,<1385,4327,4321>
+,<1385,4321,3376>
+,<1386,3988,4381>
+,<1386,4381,3425>
+,<1386,4046,1649>
+,<1386,1649,3988>
+,<1386,3425,4007>
+,<1386,4007,4046>
+,<1387,2035,2072>
+,<1387,2072,2034>
+,<1388,5508,5456>
+,<1388,5456,4350>
+,<1388,4346,5455>
+,<1388,5455,5508>
+,<1388,4350,1402>
+,<1388,1402,4346>
+,<1389,5468,5467>
+,<1389,5467,5508>
+,<1390,5496,5508>
+,<1390,5508,5497>
+,<1390,4381,5475>
+,<1390,5475,5496>
+,<1390,5497,5474>
+,<1390,5474,4381>
+,<1391,2837,1946>
+,<1391,1946,2790>
+,<1391,2790,2789>
+,<1394,2834,2788>
+,<1394,2788,2831>
+,<1394,2831,2783>
+,<1394,2783,1942>
+,<1398,2839,2792>
+,<1398,2792,2826>
+,<1398,2826,2753>
+,<1398,2753,2843>
+,<1398,2843,2868>
+,<1398,2868,2866>
+,<1398,2866,2864>
+,<1398,2864,2862>
+,<1398,2862,2860>
+,<1398,2860,2858>
+,<1398,2858,1651>
+,<1398,1651,2841>
+,<1400,6421,6434>
+,<1400,6434,6422>
+,<1400,2139,3981>
+,<1400,3981,6421>
+,<1400,6422,6393>
+,<1400,6393,2139>
+,<1401,2854,2856>
+,<1401,2856,2840>
+,<1401,2840,4352>
+,<1401,4352,1402>
+,<1402,1916,1471>
+,<1402,1471,2409>
+,<1402,1905,2466>
+,<1402,2466,2464>
+,<1402,1535,2463>
+,<1402,2463,2461>
+,<1402,1536,2460>
+,<1402,2460,2458>
+,<1402,1775,2457>
+,<1402,2457,2455>
+,<1402,1915,2456>
+,<1402,2456,1775>
+,<1402,2261,2453>
+,<1402,2453,1915>
+,<1402,1914,2450>
+,<1402,2450,2448>
+,<1402,2444,6555>
+,<1402,6555,5081>
+,<1402,6549,6554>
+,<1402,6554,2444>
+,<1402,6550,5088>
+,<1402,5088,6543>
+,<1402,6551,6553>
+,<1402,6553,6550>
+,<1402,2871,5463>
+,<1402,5463,4348>
+,<1402,4022,5459>
+,<1402,5459,2869>
+,<1402,2867,5457>
+,<1402,5457,2893>
+,<1402,4350,5456>
+,<1402,5456,2867>
+,<1402,5453,1662>
+,<1402,1662,4021>
+,<1402,2138,2075>
+,<1402,2075,5453>
+,<1402,2865,5452>
+,<1402,5452,4003>
+,<1402,4351,5451>
+,<1402,5451,2865>
+,<1402,2857,5443>
+,<1402,5443,4351>
+,<1402,4016,5442>
+,<1402,5442,2857>
+,<1403,4546,4575>
+,<1403,4575,4547>
+,<1404,4572,4575>
+,<1404,4575,4573>
+,<1404,4573,1419>
+,<1404,1419,4772>
+,<1404,4772,4771>
+,<1406,4550,4575>
+,<1406,4575,4551>
+,<1407,1464,1469>
+,<1407,1469,1465>
+,<1408,1462,1469>
+,<1408,1469,1463>
+,<1409,1466,1469>
+,<1409,1469,1467>
+,<1410,1459,1469>
+,<1410,1469,1460>
+,<1411,1457,1469>
+,<1411,1469,1458>
+,<1412,1455,1469>
+,<1412,1469,1456>
+,<1413,1453,1469>
+,<1413,1469,1454>
+,<1414,1451,1469>
+,<1414,1469,1452>
+,<1415,1443,1469>
+,<1415,1469,1444>
+,<1416,1439,1469>
+,<1416,1469,1440>
+,<1417,1433,1469>
+,<1417,1469,1434>
+,<1418,1425,1469>
+,<1418,1469,1426>
+,<1419,4573,4575>
+,<1419,4575,4574>
+,<1419,4574,4423>
+,<1419,4423,4753>
+,<1419,4753,4836>
+,<1419,4836,4772>
+,<1420,4544,4575>
+,<1420,4575,4545>
+,<1421,4570,4575>
+,<1421,4575,4571>
+,<1421,4756,4840>
+,<1421,4840,4769>
+,<1421,4769,4526>
+,<1421,4526,4570>
+,<1422,4549,4575>
+,<1422,4575,4550>
+,<1423,4551,4575>
+,<1423,4575,4552>
+,<1424,4421,4389>
+,<1424,4389,1469>
+,<1468,4850,5032>
+,<1468,5032,4432>
+,<1468,3711,3691>
+,<1468,3691,4850>
+,<1468,4432,1679>
+,<1468,1679,3711>
+,<1469,4393,4872>
+,<1469,4872,4436>
+,<1469,4440,4870>
+,<1469,4870,4393>
+,<1469,4394,4868>
+,<1469,4868,4440>
+,<1469,4441,4862>
+,<1469,4862,4431>
+,<1469,4442,4860>
+,<1469,4860,4441>
+,<1469,4519,4566>
+,<1469,4566,4390>
+,<1469,4390,4430>
+,<1469,4430,4444>
+,<1469,4444,4858>
+,<1469,4858,4442>
+,<1469,4395,4565>
+,<1469,4565,4519>
+,<1469,4422,4560>
+,<1469,4560,4428>
+,<1469,4396,4559>
+,<1469,4559,4422>
+,<1469,4427,4558>
+,<1469,4558,4396>
+,<1469,4389,4555>
+,<1469,4555,4404>
+,<1470,3892,5062>
+,<1470,5062,3868>
+,<1470,5058,5059>
+,<1470,5059,3892>
+,<1470,3900,5060>
+,<1470,5060,5058>
+,<1470,3871,1884>
+,<1470,1884,3900>
+,<1470,5055,5056>
+,<1470,5056,3871>
+,<1470,1483,1482>
+,<1470,1482,1484>
+,<1470,4906,3772>
+,<1470,3772,1485>
+,<1470,1485,1487>
+,<1470,3759,4947>
+,<1470,4947,4906>
+,<1470,3744,4946>
+,<1470,4946,3759>
+,<1470,1486,4945>
+,<1470,4945,3744>
+,<1470,4907,4944>
+,<1470,4944,1486>
+,<1470,7128,7144>
+,<1470,7144,4908>
+,<1470,6768,7143>
+,<1470,7143,7128>
+,<1470,7129,7142>
+,<1470,7142,6768>
+,<1470,7121,7141>
+,<1470,7141,7129>
+,<1470,5762,7140>
+,<1470,7140,7121>
+,<1470,3741,7120>
+,<1470,7120,7139>
+,<1470,7139,5762>
+,<1470,2720,3841>
+,<1470,3841,3741>
+,<1470,3752,4251>
+,<1470,4251,2720>
+,<1470,2080,3842>
+,<1470,3842,3752>
+,<1470,1505,4248>
+,<1470,4248,2080>
+,<1470,1668,3812>
+,<1470,3812,1505>
+,<1470,1506,4249>
+,<1470,4249,1668>
+,<1470,1511,1510>
+,<1470,1510,1512>
+,<1470,3885,5067>
+,<1470,5067,2426>
+,<1470,5063,5064>
+,<1470,5064,3885>
+,<1470,3868,5061>
+,<1470,5061,3901>
+,<1471,2474,2408>
+,<1471,2408,2409>
+,<1471,1916,2467>
+,<1471,2467,2474>
+,<1472,2269,7225>
+,<1472,7225,7177>
+,<1472,1866,3068>
+,<1472,3068,2432>
+,<1472,2432,2269>
+,<1472,7177,3910>
+,<1472,3910,3059>
+,<1472,3059,3062>
+,<1472,3062,1866>
+,<1474,3979,3611>
+,<1474,3611,4642>
+,<1474,3917,2214>
+,<1474,2214,3979>
+,<1474,4642,3629>
+,<1474,3629,1804>
+,<1474,1804,3917>
+,<1475,2246,2273>
+,<1475,2273,1902>
+,<1476,3876,3912>
+,<1476,3912,3875>
+,<1477,1903,2273>
+,<1477,2273,2254>
+,<1478,5099,5057>
+,<1478,5057,2438>
+,<1478,1912,5053>
+,<1478,5053,5099>
+,<1478,2438,3878>
+,<1478,3878,3912>
+,<1478,3912,1912>
+,<1479,5033,5099>
+,<1479,5099,5034>
+,<1486,4944,4965>
+,<1486,4965,4945>
+,<1488,7158,4935>
+,<1488,4935,3742>
+,<1488,4928,7113>
+,<1488,7113,7158>
+,<1488,3742,5776>
+,<1488,5776,4928>
+,<1489,5764,6767>
+,<1489,6767,7158>
+,<1489,7158,7112>
+,<1489,5756,3778>
+,<1489,3778,5764>
+,<1489,7112,4909>
+,<1489,4909,5776>
+,<1489,5776,5767>
+,<1489,5767,5756>
+,<1490,3840,7114>
+,<1490,7114,7158>
+,<1490,4930,6769>
+,<1490,6769,3840>
+,<1491,3786,7158>
+,<1491,7158,7104>
+,<1491,3778,6705>
+,<1491,6705,3786>
+,<1491,7104,7102>
+,<1491,7102,3778>
+,<1492,4919,4965>
+,<1492,4965,4920>
+,<1492,3778,4252>
+,<1492,4252,4919>
+,<1492,4920,1494>
+,<1492,1494,3778>
+,<1493,4916,4965>
+,<1493,4965,4917>
+,<1493,4917,4910>
+,<1493,4910,3778>
+,<1494,4920,4965>
+,<1494,4965,4921>
+,<1494,4921,5652>
+,<1494,5652,6705>
+,<1494,6705,3778>
+,<1495,6763,6762>
+,<1495,6762,4314>
+,<1495,4314,4259>
+,<1495,3845,3754>
+,<1495,3754,6757>
+,<1495,6757,6763>
+,<1495,4259,2533>
+,<1495,2533,3845>
+,<1496,6769,6721>
+,<1496,6721,6716>
+,<1496,6717,6719>
+,<1496,6719,6769>
+,<1496,6716,2541>
+,<1496,2541,6717>
+,<1497,3763,4965>
+,<1497,4965,3749>
+,<1498,3747,4965>
+,<1498,4965,2529>
+,<1499,4294,4314>
+,<1499,4314,4295>
+,<1499,3577,4269>
+,<1499,4269,4294>
+,<1499,4295,4268>
+,<1499,4268,3577>
+,<1500,6742,6769>
+,<1500,6769,6745>
+,<1500,6745,2519>
+,<1500,3290,6501>
+,<1500,6501,3299>
+,<1500,3299,6742>
+,<1500,2519,3845>
+,<1500,3845,6441>
+,<1500,6441,3290>
+,<1501,5739,5776>
+,<1501,5776,5742>
+,<1501,2541,3600>
+,<1501,3600,5739>
+,<1501,5742,2538>
+,<1501,2538,2541>
+,<1502,3444,3510>
+,<1502,3510,2172>
+,<1502,2206,3272>
+,<1502,3272,3444>
+,<1502,2172,2185>
+,<1502,2185,2206>
+,<1503,7146,7158>
+,<1503,7158,7147>
+,<1503,4965,7126>
+,<1503,7126,7146>
+,<1503,7147,4938>
+,<1503,4938,4965>
+,<1504,4057,4056>
+,<1504,4056,4508>
+,<1504,3244,3309>
+,<1504,3309,4057>
+,<1505,3812,4314>
+,<1505,4314,4248>
+,<1506,3844,4314>
+,<1506,4314,4249>
+,<1507,6447,6501>
+,<1507,6501,2517>
+,<1507,3309,6446>
+,<1507,6446,6447>
+,<1507,2517,4498>
+,<1507,4498,3309>
+,<1526,5069,5099>
+,<1526,5099,5033>
+,<1527,5071,5099>
+,<1527,5099,1917>
+,<1528,1529,5099>
+,<1528,5099,5039>
+,<1528,3912,6525>
+,<1528,6525,3904>
+,<1528,3904,1529>
+,<1528,5039,2428>
+,<1528,2428,3912>
+,<1529,3904,6526>
+,<1529,6526,3867>
+,<1529,3867,5099>
+,<1530,6541,6568>
+,<1530,6568,5087>
+,<1532,1834,3912>
+,<1532,3912,2266>
+,<1532,2273,1911>
+,<1532,1911,1834>
+,<1532,2266,2429>
+,<1532,2429,2273>
+,<1534,2458,2460>
+,<1534,2460,2474>
+,<1535,2462,2474>
+,<1535,2474,2463>
+,<1536,2459,2474>
+,<1536,2474,2460>
+,<1537,3376,1997>
+,<1537,1997,2129>
+,<1537,2908,1996>
+,<1537,1996,3376>
+,<1538,6833,6836>
+,<1538,6836,6834>
+,<1538,2005,1971>
+,<1538,1971,6833>
+,<1544,3193,3242>
+,<1544,3242,3194>
+,<1546,3229,3242>
+,<1546,3242,3230>
+,<1546,6136,6135>
+,<1546,6135,1966>
+,<1546,1966,6777>
+,<1546,6777,6770>
+,<1546,6770,3229>
+,<1546,3230,2383>
+,<1546,2383,6137>
+,<1546,6137,6136>
+,<1549,1551,1603>
+,<1549,1603,1550>
+,<1555,1558,2340>
+,<1555,2340,2330>
+,<1556,6867,6868>
+,<1556,6868,6866>
+,<1556,6866,6865>
+,<1561,1603,6850>
+,<1561,6850,1579>
+,<1561,1579,6863>
+,<1561,6863,6043>
+,<1562,1576,6844>
+,<1562,6844,6040>
+,<1562,6040,1565>
+,<1562,1564,1563>
+,<1562,1563,6842>
+,<1562,6842,6841>
+,<1562,6841,1576>
+,<1562,1565,1603>
+,<1562,1603,1564>
+,<1563,1564,1603>
+,<1563,1603,6837>
+,<1565,6040,3103>
+,<1565,3103,1603>
+,<1568,6918,6983>
+,<1568,6983,6935>
+,<1568,6935,7020>
+,<1568,7020,7017>
+,<1568,7017,7015>
+,<1568,7013,1583>
+,<1568,1583,1580>
+,<1568,1580,6932>
+,<1568,6932,6985>
+,<1568,6985,6918>
+,<1569,1581,1603>
+,<1569,1603,1577>
+,<1570,7009,7010>
+,<1570,7010,1571>
+,<1570,1571,7008>
+,<1570,7008,7007>
+,<1570,6920,6987>
+,<1570,6987,6932>
+,<1570,6932,1580>
+,<1570,1580,7011>
+,<1570,7011,7009>
+,<1571,1603,1582>
+,<1571,1582,7008>
+,<1572,7001,7002>
+,<1572,7002,1574>
+,<1572,1574,7000>
+,<1572,7000,6999>
+,<1572,6999,6997>
+,<1572,6997,6925>
+,<1572,6925,6995>
+,<1572,6995,6927>
+,<1573,7018,7017>
+,<1573,7017,7020>
+,<1573,7020,7022>
+,<1573,7022,7019>
+,<1574,6924,6996>
+,<1574,6996,6926>
+,<1574,6926,6998>
+,<1574,6998,7000>
+,<1574,7002,1585>
+,<1574,1585,6928>
+,<1574,6928,6994>
+,<1574,6994,6924>
+,<1576,6841,6910>
+,<1576,6910,6975>
+,<1576,6975,6941>
+,<1576,6941,6845>
+,<1576,6845,6846>
+,<1576,6846,6844>
+,<1578,6852,6850>
+,<1578,6850,1603>
+,<1588,6782,6836>
+,<1588,6836,6783>
+,<1589,6779,6836>
+,<1589,6836,6780>
+,<1589,3242,2380>
+,<1589,2380,6779>
+,<1590,6792,6836>
+,<1590,6836,6793>
+,<1590,1603,2381>
+,<1590,2381,6792>
+,<1590,6793,1949>
+,<1590,1949,1603>
+,<1592,6820,6836>
+,<1592,6836,6819>
+,<1592,2005,1972>
+,<1592,1972,6820>
+,<1593,1974,2005>
+,<1593,2005,1975>
+,<1594,3236,3242>
+,<1594,3242,3237>
+,<1598,6812,6836>
+,<1598,6836,6815>
+,<1598,2005,3181>
+,<1598,3181,6812>
+,<1598,6815,6813>
+,<1598,6813,2005>
+,<1599,1976,2005>
+,<1599,2005,1977>
+,<1600,3238,3242>
+,<1600,3242,3239>
+,<1601,3234,3242>
+,<1601,3242,3235>
+,<1602,3206,3242>
+,<1602,3242,3207>
+,<1602,1603,2377>
+,<1602,2377,3206>
+,<1602,3207,3200>
+,<1602,3200,1603>
+,<1603,3198,3212>
+,<1603,3212,2342>
+,<1603,2376,3209>
+,<1603,3209,3199>
+,<1603,3200,3208>
+,<1603,3208,2376>
+,<1603,1957,3205>
+,<1603,3205,2377>
+,<1603,6839,5357>
+,<1603,5357,6041>
+,<1603,1958,3217>
+,<1603,3217,1968>
+,<1603,1968,1959>
+,<1603,3178,3216>
+,<1603,3216,1958>
+,<1603,1951,3215>
+,<1603,3215,3178>
+,<1603,3197,3214>
+,<1603,3214,1951>
+,<1603,2342,3213>
+,<1603,3213,3197>
+,<1604,1619,3536>
+,<1604,3536,3811>
+,<1604,3811,2729>
+,<1604,2544,3808>
+,<1604,3808,3538>
+,<1604,3538,3810>
+,<1604,3810,1619>
+,<1605,4302,4314>
+,<1605,4314,4303>
+,<1606,5166,5106>
+,<1606,5106,3529>
+,<1606,3528,3554>
+,<1606,3554,5166>
+,<1606,3529,3577>
+,<1606,3577,3528>
+,<1607,5233,2704>
+,<1607,2704,5185>
+,<1607,2706,5183>
+,<1607,5183,5233>
+,<1608,3830,3845>
+,<1608,3845,3831>
+,<1608,3577,3817>
+,<1608,3817,3830>
+,<1608,3831,3816>
+,<1608,3816,3577>
+,<1609,5233,5190>
+,<1609,5190,1612>
+,<1610,2007,5200>
+,<1610,5200,5233>
+,<1610,5233,5201>
+,<1610,4709,4688>
+,<1610,4688,2013>
+,<1610,2013,2007>
+,<1610,5201,1618>
+,<1610,1618,4709>
+,<1611,2689,4111>
+,<1611,4111,5194>
+,<1611,5194,4644>
+,<1611,4644,2687>
+,<1611,2580,2637>
+,<1611,2637,2607>
+,<1611,2607,2592>
+,<1611,2592,2697>
+,<1611,2697,2695>
+,<1611,2695,2693>
+,<1611,2693,2691>
+,<1611,2691,2689>
+,<1612,5190,2688>
+,<1612,2688,2695>
+,<1612,2695,2697>
+,<1614,4075,1677>
+,<1614,1677,5891>
+,<1615,3282,4709>
+,<1615,4709,4676>
+,<1615,4113,4093>
+,<1615,4093,3282>
+,<1615,4676,4674>
+,<1615,4674,4113>
+,<1616,2591,2649>
+,<1616,2649,2594>
+,<1616,2594,2008>
+,<1616,2008,2655>
+,<1616,2653,2651>
+,<1616,2651,2591>
+,<1618,5201,5233>
+,<1618,5233,5202>
+,<1618,5202,2700>
+,<1618,2700,4709>
+,<1619,3810,3545>
+,<1619,3545,5233>
+,<1619,5233,3536>
+,<1620,2721,3543>
+,<1620,3543,3537>
+,<1620,3537,3822>
+,<1620,3822,2719>
+,<1620,2613,2631>
+,<1620,2631,2567>
+,<1620,2567,2068>
+,<1620,2068,2727>
+,<1620,2727,2725>
+,<1620,2725,2723>
+,<1620,2723,2721>
+,<1621,2079,2722>
+,<1621,2722,3577>
+,<1622,2667,5221>
+,<1622,5221,5233>
+,<1622,5233,5222>
+,<1622,5108,5166>
+,<1622,5166,2667>
+,<1622,5222,5179>
+,<1622,5179,3577>
+,<1622,3577,3555>
+,<1622,3555,5108>
+,<1623,2658,2657>
+,<1623,2657,2009>
+,<1623,2009,2011>
+,<1624,2045,2072>
+,<1624,2072,2056>
+,<1627,2020,2072>
+,<1627,2072,1633>
+,<1628,2182,4113>
+,<1628,4113,4088>
+,<1628,2072,3280>
+,<1628,3280,2182>
+,<1628,4088,4086>
+,<1628,4086,2072>
+,<1629,4450,4508>
+,<1629,4508,4480>
+,<1629,4113,4068>
+,<1629,4068,4450>
+,<1629,4480,4067>
+,<1629,4067,4113>
+,<1630,4707,4709>
+,<1630,4709,4708>
+,<1630,2604,2603>
+,<1630,2603,4106>
+,<1630,4106,4707>
+,<1630,4708,3802>
+,<1630,3802,3516>
+,<1630,3516,2605>
+,<1630,2605,2604>
+,<1631,3500,4709>
+,<1631,4709,4681>
+,<1631,4113,4493>
+,<1631,4493,3500>
+,<1631,4681,4679>
+,<1631,4679,4113>
+,<1632,2019,2072>
+,<1632,2072,2018>
+,<1634,2028,2072>
+,<1634,2072,2027>
+,<1635,1639,2029>
+,<1635,2029,2072>
+,<1637,3443,2044>
+,<1637,2044,2055>
+,<1637,2899,3442>
+,<1637,3442,3443>
+,<1637,2055,2072>
+,<1637,2072,2899>
+,<1638,2125,2046>
+,<1638,2046,3443>
+,<1638,2049,2072>
+,<1638,2072,2125>
+,<1640,2052,2037>
+,<1640,2037,2072>
+,<1640,2072,2058>
+,<1640,1670,3381>
+,<1640,3381,3438>
+,<1640,3438,2052>
+,<1642,3405,5575>
+,<1642,5575,2048>
+,<1642,3443,3388>
+,<1642,3388,3405>
+,<1643,6434,6385>
+,<1643,6385,4027>
+,<1643,1658,6382>
+,<1643,6382,6434>
+,<1643,4027,1670>
+,<1643,1670,1658>
+,<1644,3780,4709>
+,<1644,4709,4652>
+,<1644,4652,4482>
+,<1645,4313,4314>
+,<1645,4314,3843>
+,<1646,5501,5508>
+,<1646,5508,5502>
+,<1646,4381,2889>
+,<1646,2889,5501>
+,<1646,5502,2881>
+,<1646,2881,4381>
+,<1647,5508,5465>
+,<1647,5465,3421>
+,<1647,2847,5464>
+,<1647,5464,5508>
+,<1648,5490,5508>
+,<1648,5508,5491>
+,<1648,2139,5478>
+,<1648,5478,5490>
+,<1648,5491,5477>
+,<1648,5477,2139>
+,<1649,4008,4381>
+,<1649,4381,3988>
+,<1649,4046,3987>
+,<1649,3987,4008>
+,<1652,3353,3376>
+,<1652,3376,3354>
+,<1653,5564,5575>
+,<1653,5575,5565>
+,<1653,3443,5510>
+,<1653,5510,5564>
+,<1653,5565,3397>
+,<1653,3397,3443>
+,<1654,5548,5575>
+,<1654,5575,5549>
+,<1655,6434,2117>
+,<1655,2117,5148>
+,<1655,2844,6433>
+,<1655,6433,6434>
+,<1655,5148,2139>
+,<1655,2139,2844>
+,<1656,7318,7359>
+,<1656,7359,7319>
+,<1656,4046,7304>
+,<1656,7304,7318>
+,<1656,7319,7303>
+,<1656,7303,4046>
+,<1657,5130,5166>
+,<1657,5166,5131>
+,<1657,1670,2107>
+,<1657,2107,5130>
+,<1657,5131,2095>
+,<1657,2095,1670>
+,<1659,3558,5164>
+,<1659,5164,5166>
+,<1659,5166,5165>
+,<1659,5165,3559>
+,<1659,3559,3577>
+,<1660,6769,6732>
+,<1660,6732,4237>
+,<1660,3795,6728>
+,<1660,6728,6769>
+,<1660,4237,2541>
+,<1660,2541,3795>
+,<1661,4307,4314>
+,<1661,4314,4308>
+,<1662,5508,5454>
+,<1662,5454,4021>
+,<1662,5453,2075>
+,<1662,2075,5508>
+,<1663,4348,5463>
+,<1663,5463,5508>
+,<1664,4341,4381>
+,<1664,4381,4342>
+,<1664,4342,4004>
+,<1664,4004,2878>
+,<1664,2878,2880>
+,<1665,5492,5508>
+,<1665,5508,5493>
+,<1665,2139,5477>
+,<1665,5477,5492>
+,<1665,5493,5476>
+,<1665,5476,2139>
+,<1666,5487,5508>
+,<1666,5508,5488>
+,<1666,2139,5469>
+,<1666,5469,5487>
+,<1666,5488,5470>
+,<1666,5470,2139>
+,<1667,6464,6501>
+,<1667,6501,6465>
+,<1667,4709,3780>
+,<1667,3780,6464>
+,<1667,6465,4650>
+,<1667,4650,4709>
+,<1668,4249,4314>
+,<1668,4314,3812>
+,<1669,3833,3845>
+,<1669,3845,3834>
+,<1669,3834,3518>
+,<1669,3518,3577>
+,<1670,2113,5128>
+,<1670,5128,5110>
+,<1670,5111,3534>
+,<1670,3534,2113>
+,<1670,2099,5218>
+,<1670,5218,5175>
+,<1670,5174,5217>
+,<1670,5217,2099>
+,<1670,3542,5216>
+,<1670,5216,5174>
+,<1670,2543,5215>
+,<1670,5215,3542>
+,<1670,5122,5214>
+,<1670,5214,2543>
+,<1670,2690,5213>
+,<1670,5213,5122>
+,<1670,2694,5212>
+,<1670,5212,2690>
+,<1670,5173,5211>
+,<1670,5211,2694>
+,<1670,2692,5210>
+,<1670,5210,5173>
+,<1670,5171,5209>
+,<1670,5209,2692>
+,<1670,2006,2682>
+,<1670,2682,5204>
+,<1670,5204,2066>
+,<1670,3362,3431>
+,<1670,3431,3379>
+,<1670,3430,7355>
+,<1670,7355,5553>
+,<1670,5553,3362>
+,<1670,3380,7354>
+,<1670,7354,3430>
+,<1670,3429,7353>
+,<1670,7353,3380>
+,<1670,7297,7352>
+,<1670,7352,3429>
+,<1670,3310,7351>
+,<1670,7351,7297>
+,<1670,3427,7350>
+,<1670,7350,3310>
+,<1670,4027,6385>
+,<1670,6385,7299>
+,<1670,7299,3427>
+,<1670,3980,4035>
+,<1670,4035,4028>
+,<1670,2094,5143>
+,<1670,5143,3980>
+,<1670,5144,6381>
+,<1670,6381,2094>
+,<1670,5141,6380>
+,<1670,6380,5144>
+,<1670,5120,5140>
+,<1670,5140,6375>
+,<1670,6375,6376>
+,<1670,2108,5137>
+,<1670,5137,5121>
+,<1670,2098,5136>
+,<1670,5136,2108>
+,<1670,5113,5135>
+,<1670,5135,2098>
+,<1670,2114,5134>
+,<1670,5134,5113>
+,<1670,5112,5133>
+,<1670,5133,2114>
+,<1670,2095,5132>
+,<1670,5132,5112>
+,<1670,5110,5129>
+,<1670,5129,2107>
+,<1671,3706,3711>
+,<1671,3711,3707>
+,<1671,3707,3458>
+,<1671,3458,1737>
+,<1673,5709,4204>
+,<1673,4204,3624>
+,<1673,5678,5680>
+,<1673,5680,5709>
+,<1673,3624,2206>
+,<1673,2206,5678>
+,<1674,3510,2167>
+,<1674,2167,3269>
+,<1674,3267,2169>
+,<1674,2169,3510>
+,<1674,3269,2206>
+,<1674,2206,3267>
+,<1675,6702,6679>
+,<1675,6679,3131>
+,<1675,3131,2481>
+,<1675,2162,6675>
+,<1675,6675,6702>
+,<1675,2481,2156>
+,<1675,2156,5709>
+,<1675,5709,2162>
+,<1676,5672,5709>
+,<1676,5709,2170>
+,<1677,2180,6347>
+,<1677,6347,5425>
+,<1677,5426,6346>
+,<1677,6346,2180>
+,<1677,5271,6345>
+,<1677,6345,5426>
+,<1677,5430,6344>
+,<1677,6344,5271>
+,<1677,5288,6342>
+,<1677,6342,5430>
+,<1677,5437,6343>
+,<1677,6343,5288>
+,<1677,5846,6340>
+,<1677,6340,5437>
+,<1677,5270,6341>
+,<1677,6341,5846>
+,<1677,6337,6338>
+,<1677,6338,5270>
+,<1677,6302,6339>
+,<1677,6339,6337>
+,<1677,5435,6334>
+,<1677,6334,6301>
+,<1677,6327,6333>
+,<1677,6333,5435>
+,<1677,5851,5427>
+,<1677,5427,6327>
+,<1677,5301,5429>
+,<1677,5429,5851>
+,<1677,5847,6332>
+,<1677,6332,5301>
+,<1677,6328,5852>
+,<1677,5852,5847>
+,<1677,6329,6331>
+,<1677,6331,6328>
+,<1677,5418,5854>
+,<1677,5854,6330>
+,<1677,6330,6329>
+,<1677,5868,5855>
+,<1677,5855,5290>
+,<1677,5290,5869>
+,<1677,5872,5856>
+,<1677,5856,5420>
+,<1677,5871,5870>
+,<1677,5870,5872>
+,<1677,5874,5294>
+,<1677,5294,5871>
+,<1677,5876,5857>
+,<1677,5857,5873>
+,<1677,5875,5417>
+,<1677,5417,5876>
+,<1677,5878,5858>
+,<1677,5858,5875>
+,<1677,5879,4473>
+,<1677,4473,5878>
+,<1677,4474,5877>
+,<1677,5877,5879>
+,<1677,5881,5867>
+,<1677,5867,4474>
+,<1677,4071,5866>
+,<1677,5866,5880>
+,<1677,5883,5882>
+,<1677,5882,5884>
+,<1677,5886,3274>
+,<1677,3274,5883>
+,<1677,5885,4072>
+,<1677,4072,5886>
+,<1677,5888,5415>
+,<1677,5415,5885>
+,<1677,5887,3279>
+,<1677,3279,5888>
+,<1677,4075,5859>
+,<1677,5859,5887>
+,<1677,5890,5889>
+,<1677,5889,5891>
+,<1677,5893,5865>
+,<1677,5865,5890>
+,<1677,7032,7031>
+,<1677,7031,2188>
+,<1677,2188,5893>
+,<1677,5293,6356>
+,<1677,6356,7032>
+,<1677,7063,7064>
+,<1677,7064,5293>
+,<1677,4074,7065>
+,<1677,7065,7063>
+,<1677,5894,5434>
+,<1677,5434,4074>
+,<1677,7060,7061>
+,<1677,7061,5894>
+,<1677,5431,7062>
+,<1677,7062,7060>
+,<1677,4078,6357>
+,<1677,6357,5431>
+,<1677,7057,7058>
+,<1677,7058,4078>
+,<1677,5281,7059>
+,<1677,7059,7057>
+,<1677,5848,5910>
+,<1677,5910,5281>
+,<1677,7054,7055>
+,<1677,7055,5848>
+,<1677,5863,7056>
+,<1677,7056,7054>
+,<1677,5291,2183>
+,<1677,2183,6358>
+,<1677,6358,5863>
+,<1677,5860,6352>
+,<1677,6352,5291>
+,<1678,5709,1735>
+,<1678,1735,1734>
+,<1678,4214,2157>
+,<1678,2157,5709>
+,<1678,1734,4247>
+,<1678,4247,4214>
+,<1679,4432,5032>
+,<1679,5032,4446>
+,<1681,3478,3510>
+,<1681,3510,3479>
+,<1681,1737,2176>
+,<1681,2176,3478>
+,<1682,5843,5630>
+,<1682,5630,5632>
+,<1682,5022,5416>
+,<1682,5416,5843>
+,<1682,5632,5376>
+,<1682,5376,5022>
+,<1683,4291,4314>
+,<1683,4314,4292>
+,<1683,3577,3781>
+,<1683,3781,4291>
+,<1683,4292,2534>
+,<1683,2534,3577>
+,<1685,3468,3510>
+,<1685,3510,3469>
+,<1685,3469,2174>
+,<1685,2174,1737>
+,<1686,3505,3510>
+,<1686,3510,3506>
+,<1686,2206,2184>
+,<1686,2184,3505>
+,<1686,3506,1733>
+,<1686,1733,2206>
+,<1688,7375,7426>
+,<1688,7426,7376>
+,<1689,3657,5977>
+,<1689,5977,5911>
+,<1690,2170,5709>
+,<1690,5709,1694>
+,<1691,5933,5966>
+,<1691,5966,3667>
+,<1691,3667,7426>
+,<1692,5970,7361>
+,<1692,7361,3510>
+,<1693,1701,3710>
+,<1693,3710,3711>
+,<1693,2168,1737>
+,<1693,1737,1701>
+,<1695,4730,4728>
+,<1695,4728,3652>
+,<1695,3652,4785>
+,<1695,4785,4786>
+,<1695,4786,4787>
+,<1696,5924,5977>
+,<1696,5977,5925>
+,<1697,7409,7426>
+,<1697,7426,7410>
+,<1697,3711,3658>
+,<1697,3658,7409>
+,<1697,7410,7408>
+,<1697,7408,3711>
+,<1698,5949,5977>
+,<1698,5977,5950>
+,<1698,5950,4733>
+,<1698,4733,4717>
+,<1698,4717,4719>
+,<1699,4996,5032>
+,<1699,5032,4997>
+,<1699,4885,4887>
+,<1699,4887,2405>
+,<1699,2405,4996>
+,<1700,4893,1711>
+,<1700,1711,3711>
+,<1704,6619,6635>
+,<1704,6635,6620>
+,<1704,4817,4824>
+,<1704,4824,4784>
+,<1704,4784,6575>
+,<1704,6575,6619>
+,<1705,5031,5032>
+,<1705,5032,4890>
+,<1705,4890,3459>
+,<1705,3459,3689>
+,<1705,1737,2406>
+,<1705,2406,5031>
+,<1706,5640,5642>
+,<1706,5642,5641>
+,<1706,5376,2403>
+,<1706,2403,5640>
+,<1706,5641,2402>
+,<1706,2402,5376>
+,<1708,4968,5032>
+,<1708,5032,4971>
+,<1708,4971,1709>
+,<1708,1709,3711>
+,<1709,4971,5032>
+,<1709,5032,4886>
+,<1710,4966,5032>
+,<1710,5032,4969>
+,<1710,3711,3692>
+,<1710,3692,4966>
+,<1711,4893,5032>
+,<1711,5032,4888>
+,<1711,4888,3691>
+,<1711,3691,3711>
+,<1713,5612,6300>
+,<1713,6300,5811>
+,<1713,5811,5613>
+,<1713,5613,5642>
+,<1714,5259,5306>
+,<1714,5306,5260>
+,<1714,1737,2181>
+,<1714,2181,5259>
+,<1714,5260,4978>
+,<1714,4978,1737>
+,<1715,1737,4070>
+,<1715,4070,3489>
+,<1716,5379,5376>
+,<1716,5376,5381>
+,<1716,3510,5296>
+,<1716,5296,5379>
+,<1716,5381,4149>
+,<1716,4149,3510>
+,<1717,5283,5269>
+,<1717,5269,5376>
+,<1718,7044,5898>
+,<1718,5898,7045>
+,<1718,6367,5849>
+,<1718,5849,7044>
+,<1718,7045,5423>
+,<1718,5423,6367>
+,<1719,5396,5376>
+,<1719,5376,5398>
+,<1719,5306,5304>
+,<1719,5304,5396>
+,<1719,5398,5397>
+,<1719,5397,5306>
+,<1720,6317,6367>
+,<1720,6367,6318>
+,<1720,5376,5287>
+,<1720,5287,6317>
+,<1720,6318,5284>
+,<1720,5284,5376>
+,<1721,5306,5406>
+,<1721,5406,5407>
+,<1721,5414,5016>
+,<1721,5016,2351>
+,<1721,2351,5306>
+,<1722,5592,5642>
+,<1722,5642,5593>
+,<1722,5032,3649>
+,<1722,3649,5592>
+,<1722,5593,5006>
+,<1722,5006,5032>
+,<1723,5642,5613>
+,<1723,5613,4980>
+,<1724,5306,5257>
+,<1724,5257,4061>
+,<1725,3480,3510>
+,<1725,3510,3481>
+,<1725,3481,2178>
+,<1725,2178,1737>
+,<1727,5967,7425>
+,<1727,7425,3669>
+,<1727,3669,2206>
+,<1728,4193,4247>
+,<1728,4247,4194>
+,<1728,4194,2144>
+,<1728,2144,3644>
+,<1729,3764,4965>
+,<1729,4965,3765>
+,<1730,6501,6443>
+,<1730,6443,3289>
+,<1730,3513,6440>
+,<1730,6440,6501>
+,<1730,3289,3845>
+,<1730,3845,3513>
+,<1731,5289,5898>
+,<1731,5898,4079>
+,<1731,6367,7035>
+,<1731,7035,5289>
+,<1731,4079,5908>
+,<1731,5908,6367>
+,<1732,4508,4453>
+,<1732,4453,2175>
+,<1732,4452,4451>
+,<1732,4451,4508>
+,<1732,2175,3309>
+,<1732,3309,4452>
+,<1733,3506,3510>
+,<1733,3510,3507>
+,<1733,3507,3447>
+,<1733,3447,2206>
+,<1734,1735,4213>
+,<1734,4213,4247>
+,<1737,3453,3477>
+,<1737,3477,2176>
+,<1737,2173,3474>
+,<1737,3474,3452>
+,<1737,3451,3473>
+,<1737,3473,2173>
+,<1737,2174,3470>
+,<1737,3470,3450>
+,<1737,3458,3708>
+,<1737,3708,3449>
+,<1737,3465,3702>
+,<1737,3702,3463>
+,<1737,3646,3701>
+,<1737,3701,3465>
+,<1737,3448,3700>
+,<1737,3700,3646>
+,<1737,3645,3699>
+,<1737,3699,3448>
+,<1737,5585,5587>
+,<1737,5587,5584>
+,<1737,4151,3490>
+,<1737,3490,5586>
+,<1737,5586,5585>
+,<1737,2177,5266>
+,<1737,5266,5020>
+,<1737,5021,5263>
+,<1737,5263,3487>
+,<1737,3485,5258>
+,<1737,5258,2181>
+,<1737,4061,5257>
+,<1737,5257,3485>
+,<1737,5254,5256>
+,<1737,5256,5253>
+,<1740,3173,3175>
+,<1740,3175,3174>
+,<1741,3163,3162>
+,<1741,3162,3175>
+,<1742,3139,6641>
+,<1742,6641,6702>
+,<1743,5709,6669>
+,<1743,6669,6670>
+,<1745,1767,3175>
+,<1745,3175,3120>
+,<1746,2235,2273>
+,<1746,2273,2236>
+,<1747,3979,3919>
+,<1747,3919,1796>
+,<1747,3915,1766>
+,<1747,1766,3979>
+,<1747,1796,1804>
+,<1747,1804,3915>
+,<1748,3049,1863>
+,<1748,1863,2985>
+,<1748,2985,2986>
+,<1748,2986,2988>
+,<1748,2988,1862>
+,<1748,1862,1899>
+,<1749,1865,3042>
+,<1749,3042,1896>
+,<1749,1896,3044>
+,<1749,3044,3043>
+,<1749,3034,3031>
+,<1749,3031,2985>
+,<1749,2985,1863>
+,<1749,1863,3047>
+,<1749,3047,1865>
+,<1750,2977,3040>
+,<1750,3040,1892>
+,<1752,1818,2959>
+,<1752,2959,2960>
+,<1752,2960,1821>
+,<1752,1804,1795>
+,<1752,1795,1818>
+,<1752,1821,1790>
+,<1752,1790,1804>
+,<1753,1776,3979>
+,<1753,3979,1754>
+,<1753,1804,3964>
+,<1753,3964,1776>
+,<1753,1754,3963>
+,<1753,3963,1804>
+,<1754,3979,3975>
+,<1754,3975,3963>
+,<1755,1812,2955>
+,<1755,2955,3020>
+,<1755,3020,3005>
+,<1755,3005,1792>
+,<1755,1804,1808>
+,<1755,1808,1812>
+,<1755,1792,1805>
+,<1755,1805,1804>
+,<1756,1804,1811>
+,<1756,1811,5338>
+,<1756,5338,2935>
+,<1758,1789,1823>
+,<1758,1823,2962>
+,<1758,2962,3024>
+,<1758,3024,3000>
+,<1759,1788,2999>
+,<1759,2999,2998>
+,<1759,2998,1819>
+,<1759,1819,1799>
+,<1759,1799,1804>
+,<1760,7236,7292>
+,<1760,7292,7237>
+,<1760,4641,4618>
+,<1760,4618,7236>
+,<1760,7237,4585>
+,<1760,4585,4641>
+,<1761,1938,1828>
+,<1761,1828,1849>
+,<1762,1931,1938>
+,<1762,1938,1932>
+,<1763,2474,3066>
+,<1763,3066,7210>
+,<1763,7210,2264>
+,<1763,1875,2411>
+,<1763,2411,2474>
+,<1763,2264,3070>
+,<1763,3070,1938>
+,<1763,1938,1875>
+,<1764,3979,3914>
+,<1764,3914,3920>
+,<1764,2216,3919>
+,<1764,3919,3979>
+,<1764,3920,1804>
+,<1764,1804,2216>
+,<1765,4624,4592>
+,<1765,4592,7255>
+,<1765,7255,7292>
+,<1766,3915,1804>
+,<1766,1804,3913>
+,<1768,6645,6702>
+,<1768,6702,6646>
+,<1769,2234,2273>
+,<1769,2273,2235>
+,<1770,2238,2273>
+,<1770,2273,2239>
+,<1771,3961,3979>
+,<1771,3979,3962>
+,<1771,2991,2990>
+,<1771,2990,3947>
+,<1771,3947,3961>
+,<1771,3962,3948>
+,<1771,3948,2992>
+,<1771,2992,2991>
+,<1772,3055,7225>
+,<1772,7225,3056>
+,<1772,1938,1909>
+,<1772,1909,3055>
+,<1772,3056,2417>
+,<1772,2417,1938>
+,<1774,3069,3061>
+,<1774,3061,7176>
+,<1774,7176,7174>
+,<1774,3068,1866>
+,<1774,1866,3062>
+,<1774,3062,2970>
+,<1774,2970,3027>
+,<1774,3027,2994>
+,<1774,2994,3073>
+,<1774,3073,3074>
+,<1774,3074,3069>
+,<1774,7174,3956>
+,<1774,3956,2432>
+,<1774,2432,3068>
+,<1775,2456,2474>
+,<1775,2474,2457>
+,<1776,3964,3974>
+,<1776,3974,3979>
+,<1777,2237,2273>
+,<1777,2273,2238>
+,<1778,3966,1787>
+,<1778,1787,1804>
+,<1779,1868,1780>
+,<1779,1780,5321>
+,<1779,5321,5345>
+,<1779,5345,2924>
+,<1779,3107,3108>
+,<1779,3108,3106>
+,<1779,3106,3104>
+,<1779,3104,3102>
+,<1779,3102,3001>
+,<1779,3001,3021>
+,<1779,3021,2956>
+,<1779,2956,1868>
+,<1779,2924,5346>
+,<1779,5346,5322>
+,<1779,5322,3107>
+,<1780,2926,2925>
+,<1780,2925,5344>
+,<1780,5344,5321>
+,<1780,1868,2956>
+,<1780,2956,3019>
+,<1780,3019,3006>
+,<1780,3006,2320>
+,<1780,2320,2318>
+,<1780,2318,2921>
+,<1780,2921,2926>
+,<1781,3089,1833>
+,<1781,1833,3091>
+,<1781,3091,3092>
+,<1784,2239,2273>
+,<1784,2273,2240>
+,<1785,4602,4641>
+,<1785,4641,3634>
+,<1785,3644,3641>
+,<1785,3641,4602>
+,<1785,3634,4597>
+,<1785,4597,3644>
+,<1787,3966,3967>
+,<1787,3967,3973>
+,<1787,3973,3979>
+,<1787,3979,3974>
+,<1787,3974,3964>
+,<1787,3964,1804>
+,<1789,1804,1800>
+,<1789,1800,1823>
+,<1791,2958,2959>
+,<1791,2959,1818>
+,<1791,1818,1795>
+,<1791,1801,1816>
+,<1791,1816,2957>
+,<1791,2957,2958>
+,<1791,1795,1804>
+,<1791,1804,1801>
+,<1792,3005,3004>
+,<1792,3004,1815>
+,<1792,1815,1805>
+,<1793,2920,5373>
+,<1793,5373,1897>
+,<1793,1804,2314>
+,<1793,2314,2920>
+,<1793,1897,5336>
+,<1793,5336,1804>
+,<1794,2942,2943>
+,<1794,2943,2928>
+,<1794,2928,2941>
+,<1794,2941,2940>
+,<1796,3919,2216>
+,<1796,2216,1804>
+,<1797,3979,2270>
+,<1797,2270,3949>
+,<1797,3951,3965>
+,<1797,3965,3979>
+,<1797,3949,2968>
+,<1797,2968,2969>
+,<1797,2969,3951>
+,<1798,3154,3979>
+,<1798,3979,2214>
+,<1798,1804,1824>
+,<1798,1824,3154>
+,<1798,2214,3917>
+,<1798,3917,1804>
+,<1803,2294,2296>
+,<1803,2296,2340>
+,<1804,5336,5337>
+,<1804,5337,5335>
+,<1804,1870,5311>
+,<1804,5311,2314>
+,<1804,2326,2317>
+,<1804,2317,1870>
+,<1804,3152,3150>
+,<1804,3150,1825>
+,<1804,2217,3918>
+,<1804,3918,2215>
+,<1804,3963,3975>
+,<1804,3975,3952>
+,<1804,1813,1814>
+,<1804,1814,1806>
+,<1804,1805,1815>
+,<1804,1815,1813>
+,<1804,3101,1807>
+,<1804,1807,1811>
+,<1804,5335,2923>
+,<1804,2923,3101>
+,<1806,1814,3003>
+,<1806,3003,3002>
+,<1806,3002,1817>
+,<1807,5373,5338>
+,<1807,5338,1811>
+,<1807,3101,2923>
+,<1807,2923,5373>
+,<1809,2340,2300>
+,<1809,2300,1810>
+,<1813,1815,3004>
+,<1813,3004,3003>
+,<1813,3003,1814>
+,<1820,3979,3972>
+,<1820,3972,3971>
+,<1820,3970,3954>
+,<1820,3954,3979>
+,<1820,3971,2964>
+,<1820,2964,2965>
+,<1820,2965,3970>
+,<1822,3979,3965>
+,<1822,3965,3950>
+,<1822,3948,3962>
+,<1822,3962,3979>
+,<1822,3950,2993>
+,<1822,2993,2992>
+,<1822,2992,3948>
+,<1826,7227,7292>
+,<1826,7292,7186>
+,<1826,2273,3943>
+,<1826,3943,7227>
+,<1826,7186,7226>
+,<1826,7226,2273>
+,<1827,2242,2273>
+,<1827,2273,2243>
+,<1829,3090,1858>
+,<1829,1858,3083>
+,<1829,3083,3086>
+,<1829,3086,3085>
+,<1829,2963,3023>
+,<1829,3023,3001>
+,<1829,3001,3102>
+,<1829,3102,3099>
+,<1829,3099,3097>
+,<1829,3097,3095>
+,<1829,3095,3093>
+,<1829,3093,3091>
+,<1829,3091,1833>
+,<1829,1833,3090>
+,<1829,3085,3084>
+,<1829,3084,3081>
+,<1829,3081,3080>
+,<1829,3080,3077>
+,<1829,3077,3076>
+,<1829,3076,3073>
+,<1829,3073,2994>
+,<1829,2994,3025>
+,<1829,3025,2963>
+,<1830,7231,7292>
+,<1830,7292,7230>
+,<1830,4625,2479>
+,<1830,2479,3979>
+,<1830,3979,4619>
+,<1830,4619,7231>
+,<1830,7230,4617>
+,<1830,4617,4641>
+,<1830,4641,4625>
+,<1831,1938,2415>
+,<1831,2415,3054>
+,<1832,3043,3044>
+,<1832,3044,3041>
+,<1832,3041,1893>
+,<1833,3089,3088>
+,<1833,3088,1858>
+,<1833,1858,3090>
+,<1834,1911,3858>
+,<1834,3858,3912>
+,<1835,2452,2474>
+,<1835,2474,2451>
+,<1836,3124,3175>
+,<1836,3175,3123>
+,<1837,2233,2273>
+,<1837,2273,2234>
+,<1838,7292,7231>
+,<1838,7231,4619>
+,<1838,3775,7228>
+,<1838,7228,7292>
+,<1838,4619,3979>
+,<1838,3979,3775>
+,<1841,2273,1872>
+,<1841,1872,7187>
+,<1843,2240,2273>
+,<1843,2273,2241>
+,<1844,1924,1938>
+,<1844,1938,1925>
+,<1845,7225,1900>
+,<1845,1900,1922>
+,<1845,2417,3056>
+,<1845,3056,7225>
+,<1845,1922,1938>
+,<1845,1938,2417>
+,<1846,3048,3047>
+,<1846,3047,1863>
+,<1846,1863,3049>
+,<1846,3049,3050>
+,<1846,2982,3032>
+,<1846,3032,2975>
+,<1846,2975,3045>
+,<1846,3045,3048>
+,<1846,3050,3046>
+,<1846,3046,2983>
+,<1846,2983,2982>
+,<1852,6016,6044>
+,<1852,6044,6017>
+,<1856,1932,1938>
+,<1856,1938,1933>
+,<1857,6000,6044>
+,<1857,6044,6001>
+,<1857,6001,5985>
+,<1857,5985,5373>
+,<1859,3084,3085>
+,<1859,3085,3086>
+,<1859,3086,1887>
+,<1859,3079,3082>
+,<1859,3082,3081>
+,<1859,3081,3084>
+,<1860,3076,3077>
+,<1860,3077,3078>
+,<1860,3078,3064>
+,<1860,3072,3071>
+,<1860,3071,3074>
+,<1860,3074,3073>
+,<1860,3073,3076>
+,<1860,3064,1938>
+,<1860,1938,3072>
+,<1861,7292,7282>
+,<1861,7282,7283>
+,<1861,7285,7286>
+,<1861,7286,7288>
+,<1861,7288,7292>
+,<1861,7283,3979>
+,<1861,3979,2259>
+,<1861,2259,7185>
+,<1861,7185,7285>
+,<1862,3053,3850>
+,<1862,3850,7181>
+,<1862,7181,2433>
+,<1862,2433,1899>
+,<1865,3047,3048>
+,<1865,3048,3045>
+,<1865,3045,3042>
+,<1867,5994,6044>
+,<1867,6044,5995>
+,<1867,5373,5986>
+,<1867,5986,5994>
+,<1867,5995,5352>
+,<1867,5352,5373>
+,<1869,5373,5318>
+,<1869,5318,2308>
+,<1869,2327,5317>
+,<1869,5317,5373>
+,<1869,2308,2340>
+,<1869,2340,2327>
+,<1870,2317,5373>
+,<1870,5373,5311>
+,<1871,3011,3012>
+,<1871,3012,2948>
+,<1872,7287,7288>
+,<1872,7288,7286>
+,<1872,7286,7225>
+,<1872,7225,7187>
+,<1872,2273,7226>
+,<1872,7226,7160>
+,<1872,7160,7287>
+,<1873,2253,2273>
+,<1873,2273,1903>
+,<1874,3861,3912>
+,<1874,3912,3862>
+,<1875,1938,1876>
+,<1875,1876,2411>
+,<1877,7198,7225>
+,<1877,7225,7199>
+,<1877,2474,3890>
+,<1877,3890,7198>
+,<1877,7199,2413>
+,<1877,2413,2474>
+,<1878,2819,2818>
+,<1878,2818,2471>
+,<1878,2471,2473>
+,<1878,2473,2470>
+,<1879,1934,1938>
+,<1879,1938,1935>
+,<1880,1929,1938>
+,<1880,1938,1930>
+,<1881,1927,1938>
+,<1881,1938,1928>
+,<1884,5099,5060>
+,<1884,5060,3900>
+,<1884,3871,5056>
+,<1884,5056,5099>
+,<1885,7213,7225>
+,<1885,7225,7214>
+,<1885,1938,7170>
+,<1885,7170,7213>
+,<1885,7214,7169>
+,<1885,7169,1938>
+,<1886,2251,2273>
+,<1886,2273,2252>
+,<1888,6032,6044>
+,<1888,6044,6033>
+,<1889,6028,6044>
+,<1889,6044,6029>
+,<1890,6006,6044>
+,<1890,6044,6007>
+,<1890,6007,5984>
+,<1890,5984,5373>
+,<1891,2978,6010>
+,<1891,6010,6044>
+,<1891,6044,6011>
+,<1891,6011,2307>
+,<1891,3094,3093>
+,<1891,3093,3095>
+,<1891,3095,2978>
+,<1894,5347,5373>
+,<1894,5373,5348>
+,<1894,3108,3107>
+,<1894,3107,5322>
+,<1894,5322,5347>
+,<1894,5348,2922>
+,<1894,2922,3106>
+,<1894,3106,3108>
+,<1895,7179,7225>
+,<1895,7225,7180>
+,<1895,7180,3850>
+,<1895,3850,3053>
+,<1895,3053,3058>
+,<1896,2976,3033>
+,<1896,3033,2980>
+,<1896,2980,3041>
+,<1896,3041,3044>
+,<1896,3042,3045>
+,<1896,3045,2975>
+,<1896,2975,2976>
+,<1897,5373,5337>
+,<1897,5337,5336>
+,<1898,5340,5373>
+,<1898,5373,5341>
+,<1898,2319,2934>
+,<1898,2934,5334>
+,<1898,5334,5340>
+,<1898,5341,3100>
+,<1898,3100,2318>
+,<1898,2318,2320>
+,<1898,2320,2319>
+,<1900,7225,3057>
+,<1900,3057,3060>
+,<1900,3060,1938>
+,<1900,1938,1922>
+,<1901,7225,1906>
+,<1901,1906,2414>
+,<1902,2273,2249>
+,<1902,2249,2207>
+,<1904,2455,2457>
+,<1904,2457,2474>
+,<1905,2465,2474>
+,<1905,2474,2466>
+,<1906,7225,3051>
+,<1906,3051,2418>
+,<1906,2418,1938>
+,<1906,1938,2414>
+,<1907,7203,7225>
+,<1907,7225,7204>
+,<1907,7204,7171>
+,<1907,7171,2474>
+,<1908,7193,7225>
+,<1908,7225,7194>
+,<1908,7194,3065>
+,<1908,3065,7161>
+,<1908,3912,3849>
+,<1908,3849,7193>
+,<1908,7161,5092>
+,<1908,5092,3912>
+,<1909,3052,7225>
+,<1909,7225,3055>
+,<1912,3912,5052>
+,<1912,5052,5053>
+,<1913,6562,6568>
+,<1913,6568,6563>
+,<1913,6563,5090>
+,<1913,5090,2474>
+,<1914,2262,2474>
+,<1914,2474,2450>
+,<1915,2453,2474>
+,<1915,2474,2456>
+,<1918,5099,5037>
+,<1918,5037,6536>
+,<1919,3909,6568>
+,<1919,6568,6508>
+,<1919,6508,6507>
+,<1919,6507,2474>
+,<1921,7206,7225>
+,<1921,7225,7207>
+,<1921,2474,7164>
+,<1921,7164,7206>
+,<1921,7207,7163>
+,<1921,7163,2474>
+,<1938,3064,3078>
+,<1938,3078,3075>
+,<1938,3851,7175>
+,<1938,7175,3071>
+,<1938,3071,3072>
+,<1938,3060,3057>
+,<1938,3057,3851>
+,<1938,2418,3051>
+,<1938,3051,2415>
+,<1938,2422,7222>
+,<1938,7222,7167>
+,<1938,7168,7219>
+,<1938,7219,2420>
+,<1938,3067,7218>
+,<1938,7218,7168>
+,<1938,2421,7217>
+,<1938,7217,3067>
+,<1938,7166,7216>
+,<1938,7216,2421>
+,<1938,7169,7215>
+,<1938,7215,7166>
+,<1938,7165,7212>
+,<1938,7212,7170>
+,<1938,3070,7211>
+,<1938,7211,7165>
+,<1939,1980,2005>
+,<1939,2005,1981>
+,<1940,1978,2005>
+,<1940,2005,1979>
+,<1941,3331,3376>
+,<1941,3376,3332>
+,<1941,2005,1983>
+,<1941,1983,3331>
+,<1943,3370,3376>
+,<1943,3376,3371>
+,<1944,2005,3320>
+,<1944,3320,1998>
+,<1945,3355,3376>
+,<1945,3376,3356>
+,<1945,3356,1987>
+,<1945,1987,2911>
+,<1945,2911,2913>
+,<1946,2837,2835>
+,<1946,2835,2836>
+,<1946,2836,2091>
+,<1947,3327,3376>
+,<1947,3376,3328>
+,<1947,3328,1991>
+,<1947,1991,2005>
+,<1948,6786,6836>
+,<1948,6836,6787>
+,<1949,6793,6836>
+,<1949,6836,6794>
+,<1950,6829,6836>
+,<1950,6836,6831>
+,<1950,2005,1963>
+,<1950,1963,6829>
+,<1950,6831,1964>
+,<1950,1964,2005>
+,<1951,3214,3242>
+,<1951,3242,3215>
+,<1954,3240,3242>
+,<1954,3242,3241>
+,<1954,3241,1955>
+,<1954,1955,2407>
+,<1957,3204,3242>
+,<1957,3242,3205>
+,<1958,3216,3242>
+,<1958,3242,3217>
+,<1959,1968,6788>
+,<1959,6788,6836>
+,<1959,6836,6789>
+,<1960,6836,6818>
+,<1960,6818,3226>
+,<1960,3176,6814>
+,<1960,6814,6836>
+,<1960,3226,2005>
+,<1960,2005,3176>
+,<1961,6822,6836>
+,<1961,6836,6821>
+,<1961,6821,2382>
+,<1961,2382,2005>
+,<1962,6823,6825>
+,<1962,6825,6836>
+,<1963,6830,6836>
+,<1963,6836,6829>
+,<1963,2005,3227>
+,<1963,3227,6830>
+,<1964,6831,6836>
+,<1964,6836,6832>
+,<1964,6832,1971>
+,<1964,1971,2005>
+,<1965,6835,6836>
+,<1965,6836,2341>
+,<1966,6776,6836>
+,<1966,6836,6777>
+,<1966,6135,6134>
+,<1966,6134,3218>
+,<1966,3218,6776>
+,<1967,6784,6836>
+,<1967,6836,6785>
+,<1969,6806,6836>
+,<1969,6836,6807>
+,<1970,6811,3181>
+,<1970,3181,2005>
+,<1971,6832,6836>
+,<1971,6836,6833>
+,<1972,6817,6836>
+,<1972,6836,6820>
+,<1972,2005,6816>
+,<1972,6816,6817>
+,<1982,3335,3376>
+,<1982,3376,3336>
+,<1982,2005,1999>
+,<1982,1999,3335>
+,<1983,3330,3376>
+,<1983,3376,3331>
+,<1983,2005,3318>
+,<1983,3318,3330>
+,<1984,3325,3376>
+,<1984,3376,3326>
+,<1984,2005,1992>
+,<1984,1992,3325>
+,<1985,6409,6434>
+,<1985,6434,6410>
+,<1985,4046,4361>
+,<1985,4361,6409>
+,<1985,6410,4038>
+,<1985,4038,4046>
+,<1986,3351,3376>
+,<1986,3376,3352>
+,<1987,3356,3376>
+,<1987,3376,4321>
+,<1987,4321,4319>
+,<1987,4319,4320>
+,<1987,4320,2909>
+,<1987,2909,2911>
+,<1989,4367,4381>
+,<1989,4381,4368>
+,<1989,4046,3990>
+,<1989,3990,4367>
+,<1989,4368,4001>
+,<1989,4001,4046>
+,<1990,3333,3376>
+,<1990,3376,3334>
+,<1990,3334,1999>
+,<1990,1999,2005>
+,<1991,3328,3376>
+,<1991,3376,3329>
+,<1991,3329,3318>
+,<1991,3318,2005>
+,<1992,3324,3376>
+,<1992,3376,3325>
+,<1992,2005,3319>
+,<1992,3319,3324>
+,<1993,2906,1994>
+,<1993,1994,3376>
+,<1994,2850,1997>
+,<1994,1997,3376>
+,<1996,2904,2853>
+,<1996,2853,3376>
+,<1998,3320,3323>
+,<1998,3323,3376>
+,<1999,3334,3376>
+,<1999,3376,3335>
+,<2000,3368,3376>
+,<2000,3376,3369>
+,<2001,3372,3376>
+,<2001,3376,3373>
+,<2003,3339,3376>
+,<2003,3376,3340>
+,<2003,2005,2849>
+,<2003,2849,3339>
+,<2005,3226,6818>
+,<2005,6818,6816>
+,<2005,6813,6814>
+,<2005,6814,3176>
+,<2005,3321,3323>
+,<2005,3323,3320>
+,<2006,2065,2072>
+,<2006,2072,2696>
+,<2006,2696,2682>
+,<2007,2013,2675>
+,<2007,2675,2677>
+,<2007,2677,2698>
+,<2007,2698,5200>
+,<2010,4703,4709>
+,<2010,4709,4704>
+,<2010,2582,2583>
+,<2010,2583,4695>
+,<2010,4695,4703>
+,<2010,4704,4101>
+,<2010,4101,2581>
+,<2010,2581,2582>
+,<2012,4653,4709>
+,<2012,4709,4654>
+,<2012,4508,4065>
+,<2012,4065,4653>
+,<2012,4654,2662>
+,<2012,2662,4508>
+,<2013,4688,2668>
+,<2013,2668,2673>
+,<2013,2673,2675>
+,<2015,2016,2017>
+,<2015,2017,2072>
+,<2017,2674,4084>
+,<2017,4084,3280>
+,<2017,3280,2072>
+,<2022,2024,2072>
+,<2022,2072,2023>
+,<2031,2033,2072>
+,<2031,2072,2032>
+,<2037,2052,3438>
+,<2037,3438,3443>
+,<2037,3443,3439>
+,<2037,3439,3383>
+,<2037,3383,2072>
+,<2039,5522,5575>
+,<2039,5575,5523>
+,<2040,5528,5575>
+,<2040,5575,5529>
+,<2044,2051,2072>
+,<2044,2072,2055>
+,<2046,2125,2072>
+,<2046,2072,2053>
+,<2047,5566,5575>
+,<2047,5575,5567>
+,<2047,3443,3397>
+,<2047,3397,5566>
+,<2048,5575,5519>
+,<2048,5519,5517>
+,<2048,5517,5518>
+,<2050,3440,3443>
+,<2050,3443,3441>
+,<2050,2072,3383>
+,<2050,3383,3440>
+,<2050,3441,2130>
+,<2050,2130,2072>
+,<2066,5204,5233>
+,<2066,5233,5205>
+,<2067,3517,4314>
+,<2067,4314,3813>
+,<2067,3845,2523>
+,<2067,2523,3517>
+,<2067,3813,3838>
+,<2067,3838,3845>
+,<2068,2729,3811>
+,<2068,3811,3544>
+,<2068,3544,3821>
+,<2068,3821,2727>
+,<2069,5166,5101>
+,<2069,5101,2106>
+,<2069,3566,3552>
+,<2069,3552,5166>
+,<2069,2106,3577>
+,<2069,3577,3566>
+,<2070,5233,5126>
+,<2070,5126,5127>
+,<2070,3821,3544>
+,<2070,3544,5233>
+,<2070,5127,2725>
+,<2070,2725,2727>
+,<2070,2727,3821>
+,<2072,2672,4092>
+,<2072,4092,2191>
+,<2072,3494,4089>
+,<2072,4089,2670>
+,<2072,2669,4090>
+,<2072,4090,3494>
+,<2072,4086,4087>
+,<2072,4087,2669>
+,<2072,2130,3442>
+,<2072,3442,2899>
+,<2072,4099,4643>
+,<2072,4643,5172>
+,<2072,5172,5203>
+,<2072,5203,2696>
+,<2073,2869,5459>
+,<2073,5459,5508>
+,<2074,5508,5481>
+,<2074,5481,5480>
+,<2074,5480,5466>
+,<2074,4347,5465>
+,<2074,5465,5508>
+,<2076,2893,5457>
+,<2076,5457,5508>
+,<2077,5480,5481>
+,<2077,5481,5479>
+,<2077,5479,2139>
+,<2078,5484,5508>
+,<2078,5508,5485>
+,<2080,4248,4314>
+,<2080,4314,3842>
+,<2081,4282,4314>
+,<2081,4314,4283>
+,<2081,3845,4275>
+,<2081,4275,4282>
+,<2081,4283,4274>
+,<2081,4274,3845>
+,<2082,3540,3845>
+,<2082,3845,3538>
+,<2082,3538,3808>
+,<2083,3570,3577>
+,<2083,3577,3571>
+,<2083,2139,2105>
+,<2083,2105,3570>
+,<2083,3571,3532>
+,<2083,3532,2139>
+,<2084,5125,5233>
+,<2084,5233,3524>
+,<2084,3845,3820>
+,<2084,3820,5125>
+,<2084,3524,3809>
+,<2084,3809,3845>
+,<2085,5100,5166>
+,<2085,5166,5103>
+,<2085,3577,3530>
+,<2085,3530,5100>
+,<2085,5103,3565>
+,<2085,3565,3577>
+,<2087,3443,6402>
+,<2087,6402,5558>
+,<2088,4011,4381>
+,<2088,4381,4010>
+,<2088,3376,4323>
+,<2088,4323,4011>
+,<2088,4010,4322>
+,<2088,4322,3376>
+,<2089,5575,3405>
+,<2089,3405,3388>
+,<2089,3388,3443>
+,<2089,3443,2122>
+,<2090,4364,4381>
+,<2090,4381,4365>
+,<2090,4046,4318>
+,<2090,4318,4364>
+,<2090,4365,4315>
+,<2090,4315,4046>
+,<2092,4324,4325>
+,<2092,4325,4323>
+,<2092,4323,3376>
+,<2092,3376,5514>
+,<2092,5514,5546>
+,<2093,6434,2120>
+,<2093,2120,6372>
+,<2093,5149,3535>
+,<2093,3535,6434>
+,<2093,6372,5166>
+,<2093,5166,5149>
+,<2094,6381,6434>
+,<2094,6434,5143>
+,<2095,5131,5166>
+,<2095,5166,5132>
+,<2096,5152,5166>
+,<2096,5166,5153>
+,<2096,2139,5118>
+,<2096,5118,5152>
+,<2096,5153,5117>
+,<2096,5117,2139>
+,<2097,2852,7359>
+,<2097,7359,3993>
+,<2097,3443,6401>
+,<2097,6401,2852>
+,<2097,3993,2121>
+,<2097,2121,3443>
+,<2098,5135,5166>
+,<2098,5166,5136>
+,<2099,5217,5233>
+,<2099,5233,5218>
+,<2100,3553,5166>
+,<2100,5166,5105>
+,<2100,3577,3561>
+,<2100,3561,3553>
+,<2100,5105,3548>
+,<2100,3548,3577>
+,<2101,5159,5166>
+,<2101,5166,5160>
+,<2101,2139,5116>
+,<2101,5116,5159>
+,<2101,5160,3546>
+,<2101,3546,2139>
+,<2102,3574,3577>
+,<2102,3577,3575>
+,<2103,2625,2626>
+,<2103,2626,2563>
+,<2103,2563,2562>
+,<2103,2562,2624>
+,<2103,2624,2623>
+,<2104,3521,5166>
+,<2104,5166,3549>
+,<2104,3577,3527>
+,<2104,3527,3521>
+,<2104,3549,3560>
+,<2104,3560,3577>
+,<2105,3569,3577>
+,<2105,3577,3570>
+,<2106,5101,3530>
+,<2106,3530,3577>
+,<2107,5129,5166>
+,<2107,5166,5130>
+,<2108,5136,5166>
+,<2108,5166,5137>
+,<2109,6371,2111>
+,<2109,2111,2139>
+,<2110,2118,6434>
+,<2110,6434,6369>
+,<2110,2139,3412>
+,<2110,3412,2118>
+,<2110,6369,6368>
+,<2110,6368,2139>
+,<2111,6371,5150>
+,<2111,5150,5166>
+,<2111,5166,5151>
+,<2111,5151,5118>
+,<2111,5118,2139>
+,<2112,5154,5166>
+,<2112,5166,5155>
+,<2112,2139,5117>
+,<2112,5117,5154>
+,<2112,5155,2708>
+,<2112,2708,2139>
+,<2113,3534,5166>
+,<2113,5166,5128>
+,<2114,5133,5166>
+,<2114,5166,5134>
+,<2115,6368,6369>
+,<2115,6369,6434>
+,<2115,5146,2139>
+,<2115,2139,6368>
+,<2116,6434,2118>
+,<2116,2118,3412>
+,<2116,5147,2542>
+,<2116,2542,6434>
+,<2116,3412,2139>
+,<2116,2139,5147>
+,<2117,6434,2542>
+,<2117,2542,4029>
+,<2117,4029,2139>
+,<2117,2139,5148>
+,<2119,5145,5166>
+,<2119,5166,6370>
+,<2120,6434,6377>
+,<2120,6377,5142>
+,<2120,5142,5166>
+,<2120,5166,6372>
+,<2121,3993,7359>
+,<2121,7359,3983>
+,<2121,3983,6403>
+,<2121,6403,3443>
+,<2123,6430,6434>
+,<2123,6434,6431>
+,<2123,2139,6389>
+,<2123,6389,6430>
+,<2123,6431,6390>
+,<2123,6390,2139>
+,<2126,5536,5575>
+,<2126,5575,5537>
+,<2127,4356,4023>
+,<2127,4023,2139>
+,<2128,3371,3376>
+,<2128,3376,3372>
+,<2130,3441,3443>
+,<2130,3443,3442>
+,<2131,4009,4381>
+,<2131,4381,2895>
+,<2131,4046,3413>
+,<2131,3413,4009>
+,<2131,2895,4019>
+,<2131,4019,4046>
+,<2132,5568,5575>
+,<2132,5575,5569>
+,<2132,5569,3398>
+,<2132,3398,3443>
+,<2133,4369,4381>
+,<2133,4381,4370>
+,<2133,4046,4001>
+,<2133,4001,4369>
+,<2133,4370,3358>
+,<2133,3358,4046>
+,<2134,5460,5508>
+,<2134,5508,5462>
+,<2135,5508,5448>
+,<2135,5448,2863>
+,<2135,4355,5444>
+,<2135,5444,5508>
+,<2135,2863,2862>
+,<2135,2862,2864>
+,<2135,2864,4355>
+,<2139,5470,5489>
+,<2139,5489,5478>
+,<2139,5479,5467>
+,<2139,5467,5468>
+,<2139,5104,5163>
+,<2139,5163,3526>
+,<2139,3557,5162>
+,<2139,5162,5104>
+,<2139,3546,5161>
+,<2139,5161,3557>
+,<2139,3556,5158>
+,<2139,5158,5116>
+,<2139,3525,5157>
+,<2139,5157,3556>
+,<2139,2708,5156>
+,<2139,5156,3525>
+,<2139,4029,2542>
+,<2139,2542,5147>
+,<2139,4030,6433>
+,<2139,6433,2844>
+,<2139,6390,6432>
+,<2139,6432,4030>
+,<2139,4031,6429>
+,<2139,6429,6389>
+,<2139,6388,6428>
+,<2139,6428,4031>
+,<2139,6391,6427>
+,<2139,6427,6388>
+,<2139,2883,6426>
+,<2139,6426,6391>
+,<2139,6392,6425>
+,<2139,6425,2883>
+,<2139,4032,6424>
+,<2139,6424,6392>
+,<2139,6393,6423>
+,<2139,6423,4032>
+,<2139,6387,6420>
+,<2139,6420,3981>
+,<2139,3423,6419>
+,<2139,6419,6387>
+,<2139,4025,6418>
+,<2139,6418,3423>
+,<2139,4317,6394>
+,<2139,6394,6417>
+,<2139,6417,4025>
+,<2139,4023,4357>
+,<2139,4357,2879>
+,<2140,4118,4180>
+,<2140,4180,4122>
+,<2140,2541,4119>
+,<2140,4119,4118>
+,<2140,4122,2504>
+,<2140,2504,2541>
+,<2141,5689,5709>
+,<2141,5709,5688>
+,<2141,2206,2500>
+,<2141,2500,5689>
+,<2141,5688,5649>
+,<2141,5649,2206>
+,<2142,5382,5376>
+,<2142,5376,5383>
+,<2142,5306,4066>
+,<2142,4066,5382>
+,<2142,5383,5303>
+,<2142,5303,5306>
+,<2143,4161,4180>
+,<2143,4180,3266>
+,<2143,3266,3258>
+,<2143,3258,3309>
+,<2144,4194,4247>
+,<2144,4247,4195>
+,<2144,4195,3610>
+,<2144,3610,3644>
+,<2145,4500,4508>
+,<2145,4508,4501>
+,<2145,3309,4049>
+,<2145,4049,4500>
+,<2145,4501,4112>
+,<2145,4112,3309>
+,<2146,4189,4247>
+,<2146,4247,4190>
+,<2146,3644,4186>
+,<2146,4186,4189>
+,<2146,4190,4183>
+,<2146,4183,3644>
+,<2147,4952,4965>
+,<2147,4965,4953>
+,<2148,5734,5735>
+,<2148,5735,4228>
+,<2148,4228,5709>
+,<2148,5709,5706>
+,<2148,5706,4210>
+,<2148,4210,4247>
+,<2149,2506,2501>
+,<2149,2501,4180>
+,<2150,6676,6702>
+,<2150,6702,6675>
+,<2150,5709,2536>
+,<2150,2536,6676>
+,<2150,6675,2162>
+,<2150,2162,5709>
+,<2151,5725,5776>
+,<2151,5776,2528>
+,<2151,4247,5724>
+,<2151,5724,5725>
+,<2151,2528,4217>
+,<2151,4217,4247>
+,<2153,5665,5709>
+,<2153,5709,5666>
+,<2154,6702,6684>
+,<2154,6684,2158>
+,<2157,2495,5708>
+,<2157,5708,5709>
+,<2157,4214,4247>
+,<2157,4247,2495>
+,<2159,6692,6702>
+,<2159,6702,6691>
+,<2159,3644,2483>
+,<2159,2483,6692>
+,<2159,6691,4212>
+,<2159,4212,3644>
+,<2160,4204,5709>
+,<2160,5709,5683>
+,<2160,2206,3624>
+,<2160,3624,4204>
+,<2160,5683,5681>
+,<2160,5681,2206>
+,<2161,7381,7426>
+,<2161,7426,7382>
+,<2161,7382,5964>
+,<2161,5964,5977>
+,<2163,5244,5306>
+,<2163,5306,5246>
+,<2163,3510,5241>
+,<2163,5241,5244>
+,<2164,5976,7426>
+,<2164,7426,3655>
+,<2166,3510,3444>
+,<2166,3444,3272>
+,<2166,3272,2206>
+,<2166,2206,3270>
+,<2169,3267,2206>
+,<2169,2206,3271>
+,<2171,4743,3678>
+,<2171,3678,4742>
+,<2171,4742,4744>
+,<2171,4744,4745>
+,<2173,3473,3510>
+,<2173,3510,3474>
+,<2174,3469,3510>
+,<2174,3510,3470>
+,<2175,4453,2192>
+,<2175,2192,3309>
+,<2176,3477,3510>
+,<2176,3510,3478>
+,<2177,5265,5306>
+,<2177,5306,5266>
+,<2178,3481,3510>
+,<2178,3510,3482>
+,<2179,4110,4680>
+,<2179,4680,4709>
+,<2180,6346,6367>
+,<2180,6367,6347>
+,<2181,5258,5306>
+,<2181,5306,5259>
+,<2182,3280,4084>
+,<2182,4084,4113>
+,<2183,5897,7052>
+,<2183,7052,5898>
+,<2183,5898,6358>
+,<2183,5291,6352>
+,<2183,6352,6367>
+,<2183,6367,5897>
+,<2184,3504,3510>
+,<2184,3510,3505>
+,<2184,2206,3456>
+,<2184,3456,3504>
+,<2186,4455,4467>
+,<2186,4467,4508>
+,<2186,4508,4060>
+,<2186,4060,4154>
+,<2186,3261,3309>
+,<2186,3309,4455>
+,<2186,4154,4180>
+,<2186,4180,4153>
+,<2186,4153,3261>
+,<2187,4507,4508>
+,<2187,4508,4451>
+,<2187,3309,4052>
+,<2187,4052,4507>
+,<2187,4451,4452>
+,<2187,4452,3309>
+,<2189,6435,6501>
+,<2189,6501,6436>
+,<2189,2568,2569>
+,<2189,2569,6477>
+,<2189,6477,6435>
+,<2189,6436,6469>
+,<2189,6469,2614>
+,<2189,2614,2632>
+,<2189,2632,2568>
+,<2190,4082,4113>
+,<2190,4113,4085>
+,<2191,4092,4113>
+,<2191,4113,4495>
+,<2191,4495,2664>
+,<2191,2664,2666>
+,<2192,4453,4508>
+,<2192,4508,4056>
+,<2192,4056,4057>
+,<2192,4057,3309>
+,<2193,4134,4180>
+,<2193,4180,3260>
+,<2193,2206,4133>
+,<2193,4133,4134>
+,<2195,4135,4133>
+,<2195,4133,2206>
+,<2196,6739,6769>
+,<2196,6769,6738>
+,<2196,3309,3791>
+,<2196,3791,6739>
+,<2196,6738,4173>
+,<2196,4173,3309>
+,<2197,4125,4127>
+,<2197,4127,4180>
+,<2197,4180,4126>
+,<2197,2206,5657>
+,<2197,5657,5656>
+,<2197,5656,2499>
+,<2197,2499,4125>
+,<2197,4126,2515>
+,<2197,2515,2206>
+,<2198,4157,4180>
+,<2198,4180,4160>
+,<2198,4160,2513>
+,<2198,2513,3309>
+,<2199,2482,6663>
+,<2199,6663,6702>
+,<2199,6702,6666>
+,<2199,6666,3134>
+,<2199,3134,5709>
+,<2199,5709,5664>
+,<2200,6640,6702>
+,<2200,6702,6642>
+,<2201,5733,5776>
+,<2201,5776,5732>
+,<2201,4247,4234>
+,<2201,4234,5733>
+,<2201,5732,4216>
+,<2201,4216,4247>
+,<2202,4124,4180>
+,<2202,4180,2501>
+,<2202,2541,4121>
+,<2202,4121,4124>
+,<2202,2501,2506>
+,<2202,2506,2541>
+,<2203,2497,5664>
+,<2203,5664,5709>
+,<2203,5709,5665>
+,<2203,5665,4201>
+,<2204,4247,4189>
+,<2204,4189,4186>
+,<2205,6681,6702>
+,<2205,6702,6680>
+,<2205,4247,3593>
+,<2205,3593,6681>
+,<2206,5690,2485>
+,<2206,2485,5657>
+,<2206,4202,5692>
+,<2206,5692,5690>
+,<2206,5649,5691>
+,<2206,5691,4202>
+,<2206,4203,5686>
+,<2206,5686,2500>
+,<2206,5647,5687>
+,<2206,5687,4203>
+,<2206,5681,5682>
+,<2206,5682,5648>
+,<2206,5679,5680>
+,<2206,5680,5678>
+,<2206,5645,4205>
+,<2206,4205,5679>
+,<2206,5675,5676>
+,<2206,5676,5645>
+,<2206,5646,5677>
+,<2206,5677,5675>
+,<2206,5966,5933>
+,<2206,5933,5646>
+,<2206,3447,3508>
+,<2206,3508,2475>
+,<2206,2511,4146>
+,<2206,4146,3253>
+,<2206,4141,4142>
+,<2206,4142,3264>
+,<2206,2512,4139>
+,<2206,4139,2508>
+,<2206,3265,4140>
+,<2206,4140,2512>
+,<2206,4136,4137>
+,<2206,4137,3265>
+,<2206,2505,4132>
+,<2206,4132,4130>
+,<2206,3255,3257>
+,<2206,3257,2505>
+,<2208,2247,2273>
+,<2208,2273,2251>
+,<2209,2241,2273>
+,<2209,2273,2242>
+,<2210,2243,2273>
+,<2210,2273,2244>
+,<2211,7158,6765>
+,<2211,6765,2229>
+,<2211,5766,7115>
+,<2211,7115,7158>
+,<2211,2229,6769>
+,<2211,6769,5766>
+,<2212,7263,7292>
+,<2212,7292,7266>
+,<2212,2273,7262>
+,<2212,7262,7263>
+,<2212,7266,4594>
+,<2212,4594,2273>
+,<2217,3916,3979>
+,<2217,3979,3918>
+,<2219,4247,3598>
+,<2219,3598,2480>
+,<2219,3738,4246>
+,<2219,4246,4247>
+,<2219,2480,3778>
+,<2219,3778,3738>
+,<2220,3596,6702>
+,<2220,6702,3595>
+,<2221,3126,3175>
+,<2221,3175,3127>
+,<2222,3122,3175>
+,<2222,3175,3121>
+,<2223,6643,6702>
+,<2223,6702,6644>
+,<2224,6657,6702>
+,<2224,6702,6656>
+,<2225,3585,3644>
+,<2225,3644,3588>
+,<2225,3175,3582>
+,<2225,3582,3585>
+,<2226,4632,4641>
+,<2226,4641,4631>
+,<2226,3979,3925>
+,<2226,3925,4632>
+,<2226,4631,4590>
+,<2226,4590,3979>
+,<2227,3929,4641>
+,<2227,4641,4584>
+,<2227,3175,3635>
+,<2227,3635,3929>
+,<2228,3644,3584>
+,<2228,3584,3132>
+,<2228,3145,3143>
+,<2228,3143,3644>
+,<2228,3132,3175>
+,<2228,3175,3145>
+,<2229,6765,4931>
+,<2229,4931,6769>
+,<2230,7093,7158>
+,<2230,7158,7092>
+,<2230,7092,5651>
+,<2230,5651,3778>
+,<2231,4914,7257>
+,<2231,7257,7292>
+,<2231,7292,7258>
+,<2231,7258,3923>
+,<2231,3923,2273>
+,<2232,7265,7292>
+,<2232,7292,7268>
+,<2232,2273,4594>
+,<2232,4594,7265>
+,<2232,7268,4613>
+,<2232,4613,2273>
+,<2247,2248,2249>
+,<2247,2249,2273>
+,<2250,2252,2273>
+,<2250,2273,2253>
+,<2255,3898,5099>
+,<2255,5099,3896>
+,<2256,3912,3860>
+,<2256,3860,2430>
+,<2256,2267,3859>
+,<2256,3859,3912>
+,<2256,2430,2273>
+,<2256,2273,2267>
+,<2257,3912,3857>
+,<2257,3857,2434>
+,<2257,2268,3853>
+,<2257,3853,3912>
+,<2257,2434,2273>
+,<2257,2273,2268>
+,<2258,7188,7225>
+,<2258,7225,7189>
+,<2258,7189,7159>
+,<2258,7159,3912>
+,<2259,3908,7184>
+,<2259,7184,7225>
+,<2259,7225,7185>
+,<2259,3979,3957>
+,<2259,3957,3908>
+,<2260,3863,3912>
+,<2260,3912,3864>
+,<2261,2454,2474>
+,<2261,2474,2453>
+,<2263,5099,5047>
+,<2263,5047,5040>
+,<2263,2436,5043>
+,<2263,5043,5099>
+,<2263,5040,3912>
+,<2263,3912,2436>
+,<2264,7210,7225>
+,<2264,7225,7211>
+,<2264,7211,3070>
+,<2265,5093,6512>
+,<2265,6512,6568>
+,<2269,2432,3956>
+,<2269,3956,7225>
+,<2271,3958,3979>
+,<2271,3979,3959>
+,<2272,7290,7292>
+,<2272,7292,7291>
+,<2272,3979,3926>
+,<2272,3926,7290>
+,<2272,7291,3151>
+,<2272,3151,3979>
+,<2273,4626,3617>
+,<2273,3617,3943>
+,<2273,7279,3776>
+,<2273,3776,4626>
+,<2273,2486,7281>
+,<2273,7281,7279>
+,<2273,7275,7278>
+,<2273,7278,4595>
+,<2273,4614,7277>
+,<2273,7277,7275>
+,<2273,2489,7276>
+,<2273,7276,4614>
+,<2273,3715,3605>
+,<2273,3605,2489>
+,<2273,7271,7274>
+,<2273,7274,3715>
+,<2273,4612,7273>
+,<2273,7273,7271>
+,<2273,4623,7272>
+,<2273,7272,4612>
+,<2273,4586,7269>
+,<2273,7269,4623>
+,<2273,4622,7270>
+,<2273,7270,4586>
+,<2273,4613,7267>
+,<2273,7267,4622>
+,<2273,4911,7264>
+,<2273,7264,7262>
+,<2273,3643,4616>
+,<2273,4616,4911>
+,<2273,7259,7260>
+,<2273,7260,3643>
+,<2273,3923,7261>
+,<2273,7261,7259>
+,<2273,2434,3857>
+,<2273,3857,3855>
+,<2274,2293,2340>
+,<2274,2340,2292>
+,<2275,2295,2340>
+,<2275,2340,2296>
+,<2278,2279,2280>
+,<2278,2280,2340>
+,<2281,2283,2340>
+,<2281,2340,2282>
+,<2286,2288,2340>
+,<2286,2340,2287>
+,<2289,2291,2340>
+,<2289,2340,2290>
+,<2297,2299,2340>
+,<2297,2340,2298>
+,<2303,5318,5373>
+,<2303,5373,5319>
+,<2303,2340,2308>
+,<2303,2308,5318>
+,<2304,5308,5373>
+,<2304,5373,2932>
+,<2304,2340,2323>
+,<2304,2323,5308>
+,<2305,5373,2930>
+,<2305,2930,2315>
+,<2306,6024,6044>
+,<2306,6044,6025>
+,<2309,2333,2340>
+,<2309,2340,2334>
+,<2310,2337,2340>
+,<2310,2340,2338>
+,<2311,2332,2340>
+,<2311,2340,2333>
+,<2312,2330,2340>
+,<2312,2340,2331>
+,<2313,5307,5373>
+,<2313,5373,5310>
+,<2314,5311,5373>
+,<2314,5373,2920>
+,<2315,2930,2329>
+,<2315,2329,2340>
+,<2316,6030,6044>
+,<2316,6044,6031>
+,<2318,3100,5342>
+,<2318,5342,2927>
+,<2318,2927,2921>
+,<2321,6044,6861>
+,<2321,6861,6872>
+,<2321,6874,6862>
+,<2321,6862,6044>
+,<2324,2933,5373>
+,<2324,5373,5312>
+,<2324,5312,2328>
+,<2324,2328,2340>
+,<2325,5317,2327>
+,<2325,2327,2340>
+,<2328,5312,5373>
+,<2328,5373,5314>
+,<2328,5314,5313>
+,<2328,5313,2340>
+,<2342,3212,3242>
+,<2342,3242,3213>
+,<2343,2384,2407>
+,<2343,2407,2385>
+,<2344,6802,6836>
+,<2344,6836,6803>
+,<2345,2388,2407>
+,<2345,2407,2389>
+,<2346,2386,2407>
+,<2346,2407,2387>
+,<2347,2390,2407>
+,<2347,2407,2391>
+,<2348,2392,2407>
+,<2348,2407,2393>
+,<2349,5603,5642>
+,<2349,5642,5604>
+,<2349,5604,6261>
+,<2349,6261,6260>
+,<2349,6260,5032>
+,<2350,6273,6300>
+,<2350,6300,6274>
+,<2351,5016,5642>
+,<2351,5642,5279>
+,<2351,5279,5411>
+,<2351,5411,5306>
+,<2352,5599,5642>
+,<2352,5642,5600>
+,<2352,5032,3464>
+,<2352,3464,5599>
+,<2352,5600,5011>
+,<2352,5011,5032>
+,<2353,5797,6252>
+,<2353,6252,5799>
+,<2353,5799,5812>
+,<2376,3208,3242>
+,<2376,3242,3209>
+,<2377,3205,3242>
+,<2377,3242,3206>
+,<2379,6797,6836>
+,<2379,6836,6798>
+,<2380,6778,6836>
+,<2380,6836,6779>
+,<2380,3242,6771>
+,<2380,6771,6778>
+,<2381,6791,6836>
+,<2381,6836,6792>
+,<2382,6821,6836>
+,<2382,6836,6824>
+,<2383,3230,3242>
+,<2383,3242,3231>
+,<2396,6078,6077>
+,<2396,6077,6079>
+,<2396,6079,6080>
+,<2396,6149,6155>
+,<2396,6155,6093>
+,<2396,6093,6048>
+,<2396,6048,6078>
+,<2396,6080,6047>
+,<2396,6047,6150>
+,<2396,6150,6149>
+,<2398,6269,6300>
+,<2398,6300,6270>
+,<2398,2407,3491>
+,<2398,3491,6269>
+,<2398,6270,5808>
+,<2398,5808,2407>
+,<2399,6286,6300>
+,<2399,6300,6289>
+,<2399,5843,6285>
+,<2399,6285,6286>
+,<2399,6289,2404>
+,<2399,2404,5843>
+,<2400,5595,5642>
+,<2400,5642,5596>
+,<2400,5032,5012>
+,<2400,5012,5595>
+,<2400,5596,5007>
+,<2400,5007,5032>
+,<2401,4711,5642>
+,<2401,5642,5017>
+,<2401,5306,5411>
+,<2401,5411,4711>
+,<2402,5641,5642>
+,<2402,5642,3462>
+,<2403,5785,5784>
+,<2403,5784,5642>
+,<2403,5642,5640>
+,<2403,5376,5632>
+,<2403,5632,5630>
+,<2403,5630,5785>
+,<2404,6289,6300>
+,<2404,6300,6288>
+,<2404,6288,6253>
+,<2404,6253,5843>
+,<2405,4995,5032>
+,<2405,5032,4996>
+,<2405,4887,4889>
+,<2405,4889,4986>
+,<2405,4986,4995>
+,<2406,5030,5032>
+,<2406,5032,5031>
+,<2407,6257,6263>
+,<2407,6263,6235>
+,<2407,4983,6259>
+,<2407,6259,6258>
+,<2407,3685,5004>
+,<2407,5004,4983>
+,<2407,4984,5003>
+,<2407,5003,3685>
+,<2407,6045,6066>
+,<2407,6066,6060>
+,<2407,6062,6064>
+,<2407,6064,6045>
+,<2407,5808,6271>
+,<2407,6271,5611>
+,<2407,5611,6062>
+,<2407,5582,6268>
+,<2407,6268,3491>
+,<2408,2474,2473>
+,<2408,2473,2471>
+,<2408,2471,2472>
+,<2410,7208,7225>
+,<2410,7225,7209>
+,<2410,2474,7163>
+,<2410,7163,7208>
+,<2410,7209,3066>
+,<2410,3066,2474>
+,<2412,7195,7225>
+,<2412,7225,7196>
+,<2412,2474,6507>
+,<2412,6507,6506>
+,<2412,6506,2424>
+,<2412,2424,7195>
+,<2412,7196,7173>
+,<2412,7173,2474>
+,<2413,7199,7225>
+,<2413,7225,7200>
+,<2413,7200,7172>
+,<2413,7172,2474>
+,<2415,3051,7225>
+,<2415,7225,3054>
+,<2420,7219,7225>
+,<2420,7225,7220>
+,<2421,7216,7225>
+,<2421,7225,7217>
+,<2422,7221,7225>
+,<2422,7225,7222>
+,<2423,7201,7225>
+,<2423,7225,7202>
+,<2423,2474,7172>
+,<2423,7172,7201>
+,<2424,7194,7225>
+,<2424,7225,7195>
+,<2424,6506,6568>
+,<2424,6568,3065>
+,<2424,3065,7194>
+,<2426,5067,5099>
+,<2426,5099,5066>
+,<2427,5050,5099>
+,<2427,5099,3847>
+,<2427,3912,5049>
+,<2427,5049,5050>
+,<2427,3847,3899>
+,<2427,3899,3912>
+,<2428,5039,5099>
+,<2428,5099,3846>
+,<2428,3846,5042>
+,<2428,5042,3912>
+,<2433,7181,7225>
+,<2433,7225,7182>
+,<2435,5096,6568>
+,<2435,6568,6527>
+,<2435,3912,2439>
+,<2435,2439,5096>
+,<2435,6527,6525>
+,<2435,6525,3912>
+,<2437,5070,5099>
+,<2437,5099,3897>
+,<2439,6523,6568>
+,<2439,6568,5096>
+,<2439,3912,6522>
+,<2439,6522,6523>
+,<2441,6568,6538>
+,<2441,6538,6537>
+,<2441,6537,5099>
+,<2441,5099,5085>
+,<2444,6554,6568>
+,<2444,6568,6555>
+,<2445,2447,2474>
+,<2445,2474,2446>
+,<2448,2450,2474>
+,<2448,2474,2449>
+,<2474,7171,7205>
+,<2474,7205,7164>
+,<2474,7173,7197>
+,<2474,7197,3890>
+,<2474,3883,6505>
+,<2474,6505,3891>
+,<2474,5091,6567>
+,<2474,6567,3883>
+,<2474,5079,6566>
+,<2474,6566,5091>
+,<2474,6547,6565>
+,<2474,6565,5079>
+,<2474,5090,6564>
+,<2474,6564,6547>
+,<2474,5089,6560>
+,<2474,6560,6546>
+,<2474,6545,6559>
+,<2474,6559,5089>
+,<2474,5080,6558>
+,<2474,6558,6545>
+,<2474,6544,6557>
+,<2474,6557,5080>
+,<2474,6548,6556>
+,<2474,6556,6544>
+,<2475,3508,3510>
+,<2475,3510,3509>
+,<2476,3253,4146>
+,<2476,4146,4180>
+,<2477,3749,4965>
+,<2477,4965,3762>
+,<2478,4965,2724>
+,<2478,2724,4253>
+,<2478,3767,2529>
+,<2478,2529,4965>
+,<2479,4625,4641>
+,<2479,4641,4628>
+,<2479,4628,3148>
+,<2479,3148,3979>
+,<2483,6689,6702>
+,<2483,6702,6692>
+,<2484,3727,3778>
+,<2484,3778,3726>
+,<2484,3644,3606>
+,<2484,3606,3727>
+,<2484,3726,3622>
+,<2484,3622,3644>
+,<2485,5709,5693>
+,<2485,5693,5656>
+,<2485,5656,5657>
+,<2485,5690,5692>
+,<2485,5692,5709>
+,<2486,7280,7292>
+,<2486,7292,7281>
+,<2487,4238,4247>
+,<2487,4247,4239>
+,<2487,3778,3732>
+,<2487,3732,4238>
+,<2487,4239,3614>
+,<2487,3614,3778>
+,<2488,3644,3941>
+,<2488,3941,3144>
+,<2488,3718,3717>
+,<2488,3717,3644>
+,<2489,3605,7292>
+,<2489,7292,7276>
+,<2490,6674,6672>
+,<2490,6672,5709>
+,<2491,6702,6671>
+,<2491,6671,4197>
+,<2492,5697,5709>
+,<2492,5709,5698>
+,<2492,2541,5654>
+,<2492,5654,5697>
+,<2492,5698,5653>
+,<2492,5653,2541>
+,<2493,2541,4215>
+,<2493,4215,5710>
+,<2495,4247,4182>
+,<2495,4182,5708>
+,<2496,6650,6702>
+,<2496,6702,6651>
+,<2498,6702,6637>
+,<2498,6637,6697>
+,<2498,5661,6695>
+,<2498,6695,6702>
+,<2498,6697,3644>
+,<2498,3644,5661>
+,<2499,5656,5693>
+,<2499,5693,4184>
+,<2499,4184,2541>
+,<2500,5686,5709>
+,<2500,5709,5689>
+,<2502,4180,4120>
+,<2502,4120,2503>
+,<2502,3254,4116>
+,<2502,4116,4180>
+,<2502,2503,2541>
+,<2502,2541,3254>
+,<2503,4120,4119>
+,<2503,4119,2541>
+,<2504,4122,4180>
+,<2504,4180,4123>
+,<2504,4123,4121>
+,<2504,4121,2541>
+,<2505,3257,4180>
+,<2505,4180,4132>
+,<2507,4464,4508>
+,<2507,4508,3276>
+,<2507,3309,4463>
+,<2507,4463,4464>
+,<2507,3276,3275>
+,<2507,3275,3309>
+,<2508,4139,4180>
+,<2508,4180,3259>
+,<2509,4159,4180>
+,<2509,4180,4162>
+,<2509,3309,2513>
+,<2509,2513,4159>
+,<2510,4153,4180>
+,<2510,4180,4156>
+,<2510,3309,3261>
+,<2510,3261,4153>
+,<2510,4156,3262>
+,<2510,3262,3309>
+,<2511,4147,4180>
+,<2511,4180,4146>
+,<2512,4140,4180>
+,<2512,4180,4139>
+,<2513,4160,4180>
+,<2513,4180,4159>
+,<2514,2678,4659>
+,<2514,4659,4709>
+,<2514,4709,4660>
+,<2514,4067,4480>
+,<2514,4480,4508>
+,<2514,4508,2678>
+,<2514,4660,4492>
+,<2514,4492,4113>
+,<2514,4113,4067>
+,<2515,4126,4180>
+,<2515,4180,4129>
+,<2516,3294,6501>
+,<2516,6501,6466>
+,<2516,4709,4650>
+,<2516,4650,3294>
+,<2516,6466,3286>
+,<2516,3286,4709>
+,<2517,6501,6449>
+,<2517,6449,4498>
+,<2518,6458,6501>
+,<2518,6501,3284>
+,<2518,3309,6457>
+,<2518,6457,6458>
+,<2518,3284,3514>
+,<2518,3514,3309>
+,<2519,6745,3298>
+,<2519,3298,3845>
+,<2520,5776,3788>
+,<2520,3788,3712>
+,<2520,3790,5711>
+,<2520,5711,5776>
+,<2520,3712,2541>
+,<2520,2541,3790>
+,<2521,5020,5266>
+,<2521,5266,5306>
+,<2522,4284,4314>
+,<2522,4314,4285>
+,<2522,3845,4274>
+,<2522,4274,4284>
+,<2522,4285,4273>
+,<2522,4273,3845>
+,<2523,4260,4314>
+,<2523,4314,3517>
+,<2523,3845,2533>
+,<2523,2533,4260>
+,<2524,6737,6735>
+,<2524,6735,4180>
+,<2524,4180,4166>
+,<2524,4166,4170>
+,<2525,6714,6769>
+,<2525,6769,2539>
+,<2525,5776,3787>
+,<2525,3787,6714>
+,<2525,2539,6715>
+,<2525,6715,5776>
+,<2526,4241,4247>
+,<2526,4247,4242>
+,<2526,3778,3737>
+,<2526,3737,4241>
+,<2526,4242,3626>
+,<2526,3626,3778>
+,<2527,7109,7158>
+,<2527,7158,7111>
+,<2527,3778,4255>
+,<2527,4255,7109>
+,<2527,7111,4927>
+,<2527,4927,3778>
+,<2528,5776,5729>
+,<2528,5729,4217>
+,<2530,4303,4314>
+,<2530,4314,4304>
+,<2531,7137,7158>
+,<2531,7158,7138>
+,<2531,4314,7119>
+,<2531,7119,7137>
+,<2531,7138,3773>
+,<2531,3773,4314>
+,<2532,4311,4314>
+,<2532,4314,4312>
+,<2533,4259,4314>
+,<2533,4314,4260>
+,<2534,4292,4314>
+,<2534,4314,4293>
+,<2534,4293,4269>
+,<2534,4269,3577>
+,<2535,3839,6769>
+,<2535,6769,6703>
+,<2535,3845,4933>
+,<2535,4933,3839>
+,<2535,6703,3754>
+,<2535,3754,3845>
+,<2536,6673,6702>
+,<2536,6702,6676>
+,<2536,5709,6672>
+,<2536,6672,6673>
+,<2537,5769,5776>
+,<2537,5776,5770>
+,<2537,3778,5757>
+,<2537,5757,5769>
+,<2537,5770,5758>
+,<2537,5758,3778>
+,<2538,5742,5776>
+,<2538,5776,5741>
+,<2538,5741,4229>
+,<2538,4229,2541>
+,<2539,6769,3797>
+,<2539,3797,6715>
+,<2540,4962,4965>
+,<2540,4965,4963>
+,<2541,4236,5748>
+,<2541,5748,4256>
+,<2541,4256,5703>
+,<2541,5705,5747>
+,<2541,5747,4236>
+,<2541,3712,3788>
+,<2541,3788,4215>
+,<2541,4235,5711>
+,<2541,5711,3790>
+,<2541,4209,3609>
+,<2541,3609,4235>
+,<2541,4219,5745>
+,<2541,5745,5743>
+,<2541,4229,5744>
+,<2541,5744,4219>
+,<2541,5650,5702>
+,<2541,5702,4220>
+,<2541,4220,3600>
+,<2541,4181,5701>
+,<2541,5701,5650>
+,<2541,4208,5700>
+,<2541,5700,4181>
+,<2541,5653,5699>
+,<2541,5699,4208>
+,<2541,4207,5696>
+,<2541,5696,5654>
+,<2541,5655,5695>
+,<2541,5695,4207>
+,<2541,4184,5694>
+,<2541,5694,5655>
+,<2541,3252,4176>
+,<2541,4176,4169>
+,<2541,4168,4175>
+,<2541,4175,3252>
+,<2541,4170,4166>
+,<2541,4166,4167>
+,<2541,3800,6733>
+,<2541,6733,5751>
+,<2541,4934,6734>
+,<2541,6734,3800>
+,<2541,6730,6731>
+,<2541,6731,4934>
+,<2541,4237,6732>
+,<2541,6732,6730>
+,<2541,3799,6728>
+,<2541,6728,3795>
+,<2541,3245,6729>
+,<2541,6729,3799>
+,<2541,6725,6726>
+,<2541,6726,3245>
+,<2541,3794,6727>
+,<2541,6727,6725>
+,<2541,3761,3308>
+,<2541,3308,3794>
+,<2541,6722,6723>
+,<2541,6723,3761>
+,<2541,3774,6724>
+,<2541,6724,6722>
+,<2541,3735,3246>
+,<2541,3246,3774>
+,<2541,2716,6720>
+,<2541,6720,3735>
+,<2541,6716,6721>
+,<2541,6721,2716>
+,<2541,6718,6719>
+,<2541,6719,6717>
+,<2541,6713,3796>
+,<2541,3796,6718>
+,<2541,5703,3798>
+,<2541,3798,6713>
+,<2543,5214,5233>
+,<2543,5233,5215>
+,<2545,5225,5233>
+,<2545,5233,5226>
+,<2545,3577,5180>
+,<2545,5180,5225>
+,<2545,5226,2702>
+,<2545,2702,3577>
+,<2558,2621,2622>
+,<2558,2622,2560>
+,<2558,2560,2559>
+,<2564,2627,2628>
+,<2564,2628,2619>
+,<2564,2619,2620>
+,<2564,2620,2626>
+,<2564,2626,2625>
+,<2565,2628,2627>
+,<2565,2627,2618>
+,<2565,2618,2629>
+,<2565,2629,2630>
+,<2565,2630,2566>
+,<2567,2631,2632>
+,<2567,2632,2614>
+,<2567,2614,2615>
+,<2567,2615,2616>
+,<2567,2616,2617>
+,<2567,2617,2630>
+,<2567,2630,2629>
+,<2568,2632,2631>
+,<2568,2631,2613>
+,<2568,2613,2633>
+,<2568,2633,2634>
+,<2568,2634,2572>
+,<2568,2572,2571>
+,<2568,2571,2570>
+,<2568,2570,2569>
+,<2569,2570,3801>
+,<2569,3801,4649>
+,<2569,4649,6477>
+,<2570,2571,6487>
+,<2570,6487,4096>
+,<2570,4096,3801>
+,<2571,2572,4095>
+,<2571,4095,6489>
+,<2571,6489,6487>
+,<2572,2634,2612>
+,<2572,2612,6475>
+,<2572,6475,6488>
+,<2572,6488,4095>
+,<2573,2635,2636>
+,<2573,2636,2608>
+,<2573,2608,2609>
+,<2573,2609,2610>
+,<2573,2610,2611>
+,<2573,2611,2612>
+,<2573,2612,2634>
+,<2573,2634,2633>
+,<2574,2636,2635>
+,<2574,2635,2607>
+,<2574,2607,2637>
+,<2574,2637,2638>
+,<2574,2638,2579>
+,<2574,2579,2578>
+,<2574,2578,2577>
+,<2574,2577,2576>
+,<2574,2576,2575>
+,<2574,4487,6483>
+,<2574,6483,4647>
+,<2574,4647,2608>
+,<2574,2608,2636>
+,<2576,2577,6471>
+,<2576,6471,4497>
+,<2576,4497,4107>
+,<2577,2578,6470>
+,<2577,6470,6479>
+,<2577,6479,6471>
+,<2578,2579,6473>
+,<2578,6473,6478>
+,<2578,6478,6470>
+,<2579,2638,2606>
+,<2579,2606,4490>
+,<2579,4490,6472>
+,<2579,6472,6473>
+,<2580,2639,2640>
+,<2580,2640,2602>
+,<2580,2602,2603>
+,<2580,2603,2604>
+,<2580,2604,2605>
+,<2580,2605,2606>
+,<2580,2606,2638>
+,<2580,2638,2637>
+,<2581,2640,2639>
+,<2581,2639,2601>
+,<2581,2601,2641>
+,<2581,2641,2642>
+,<2581,2642,2584>
+,<2581,2584,2583>
+,<2581,2583,2582>
+,<2581,4101,4705>
+,<2581,4705,4694>
+,<2581,4694,2602>
+,<2581,2602,2640>
+,<2583,2584,4098>
+,<2583,4098,4702>
+,<2583,4702,4695>
+,<2584,2642,2600>
+,<2584,2600,4696>
+,<2584,4696,4701>
+,<2584,4701,4098>
+,<2585,2643,2644>
+,<2585,2644,2598>
+,<2585,2598,2599>
+,<2585,2599,2600>
+,<2585,2600,2642>
+,<2585,2642,2641>
+,<2585,0,2665>
+,<2585,2665,2663>
+,<2585,2663,2661>
+,<2585,2661,2659>
+,<2585,2659,2597>
+,<2585,2597,2643>
+,<2586,2644,2643>
+,<2586,2643,2597>
+,<2586,2597,2645>
+,<2586,2645,2646>
+,<2586,2646,2588>
+,<2586,2588,2587>
+,<2586,4698,4700>
+,<2586,4700,4697>
+,<2586,4697,2598>
+,<2586,2598,2644>
+,<2589,2647,2648>
+,<2589,2648,2595>
+,<2589,2595,2596>
+,<2589,2596,2646>
+,<2589,2646,2645>
+,<2590,2648,2647>
+,<2590,2647,2594>
+,<2590,2594,2649>
+,<2590,2649,2650>
+,<2591,2651,2652>
+,<2591,2652,2593>
+,<2591,2593,2650>
+,<2591,2650,2649>
+,<2598,4697,4692>
+,<2598,4692,4693>
+,<2598,4693,2599>
+,<2599,4693,4097>
+,<2599,4097,4696>
+,<2599,4696,2600>
+,<2602,4694,4706>
+,<2602,4706,4106>
+,<2602,4106,2603>
+,<2605,3516,6476>
+,<2605,6476,4490>
+,<2605,4490,2606>
+,<2608,4647,6484>
+,<2608,6484,6482>
+,<2608,6482,2609>
+,<2609,6482,4100>
+,<2609,4100,6474>
+,<2609,6474,2610>
+,<2610,6474,6486>
+,<2610,6486,3283>
+,<2610,3283,2611>
+,<2611,3283,6485>
+,<2611,6485,6475>
+,<2611,6475,2612>
+,<2614,6469,6490>
+,<2614,6490,3306>
+,<2614,3306,2615>
+,<2615,3306,6491>
+,<2615,6491,6496>
+,<2615,6496,3511>
+,<2615,3511,2616>
+,<2651,2653,2654>
+,<2651,2654,2652>
+,<2661,2663,4047>
+,<2661,4047,4690>
+,<2661,4690,4102>
+,<2662,4654,4709>
+,<2662,4709,4655>
+,<2664,4495,4683>
+,<2664,4683,4709>
+,<2667,5166,5177>
+,<2667,5177,5221>
+,<2668,4688,4709>
+,<2668,4709,4103>
+,<2669,4087,4113>
+,<2669,4113,4090>
+,<2672,4091,4113>
+,<2672,4113,4092>
+,<2676,5386,5376>
+,<2676,5376,5387>
+,<2676,5306,5236>
+,<2676,5236,5386>
+,<2676,5387,5238>
+,<2676,5238,5306>
+,<2678,4508,4496>
+,<2678,4496,4659>
+,<2680,5196,5233>
+,<2680,5233,5197>
+,<2680,2683,2685>
+,<2680,2685,4485>
+,<2680,4485,5196>
+,<2682,2696,5203>
+,<2682,5203,5233>
+,<2682,5233,5204>
+,<2684,3819,3845>
+,<2684,3845,3828>
+,<2684,3828,3818>
+,<2685,2687,4644>
+,<2685,4644,5195>
+,<2685,5195,4485>
+,<2686,5206,5233>
+,<2686,5233,5207>
+,<2688,5190,5233>
+,<2688,5233,5191>
+,<2688,5191,4048>
+,<2688,4048,2693>
+,<2688,2693,2695>
+,<2689,2691,4686>
+,<2689,4686,5193>
+,<2689,5193,4111>
+,<2690,5212,5233>
+,<2690,5233,5213>
+,<2691,2693,4048>
+,<2691,4048,5192>
+,<2691,5192,4686>
+,<2692,5209,5233>
+,<2692,5233,5210>
+,<2694,5211,5233>
+,<2694,5233,5212>
+,<2698,5199,5233>
+,<2698,5233,5200>
+,<2700,5202,5233>
+,<2700,5233,5203>
+,<2700,5203,5172>
+,<2700,5172,4643>
+,<2700,4643,4709>
+,<2701,2703,5184>
+,<2701,5184,5189>
+,<2701,5189,5182>
+,<2702,5226,5233>
+,<2702,5233,5227>
+,<2702,5227,3826>
+,<2702,3826,3577>
+,<2703,2705,5187>
+,<2703,5187,5188>
+,<2703,5188,5184>
+,<2704,5233,5170>
+,<2704,5170,5186>
+,<2704,5186,2707>
+,<2704,2707,2709>
+,<2704,2709,5185>
+,<2705,2707,5186>
+,<2705,5186,5170>
+,<2705,5170,5187>
+,<2706,2711,2713>
+,<2706,2713,5123>
+,<2706,5123,5183>
+,<2708,5155,5166>
+,<2708,5166,5156>
+,<2710,6741,6769>
+,<2710,6769,6740>
+,<2710,3309,4173>
+,<2710,4173,6741>
+,<2710,6740,4165>
+,<2710,4165,6445>
+,<2710,6445,3805>
+,<2710,3805,3309>
+,<2712,5223,5233>
+,<2712,5233,5224>
+,<2712,3577,5179>
+,<2712,5179,5223>
+,<2712,5224,5180>
+,<2712,5180,3577>
+,<2713,2715,5168>
+,<2713,5168,5167>
+,<2713,5167,5123>
+,<2714,4108,6501>
+,<2714,6501,6462>
+,<2714,6462,3304>
+,<2714,3304,4648>
+,<2714,3309,3302>
+,<2714,3302,4108>
+,<2714,4648,4499>
+,<2714,4499,4049>
+,<2714,4049,3309>
+,<2715,2717,2728>
+,<2715,2728,5181>
+,<2715,5181,5168>
+,<2716,6721,6769>
+,<2716,6769,6720>
+,<2717,2719,3822>
+,<2717,3822,5124>
+,<2717,5124,2728>
+,<2718,4305,4314>
+,<2718,4314,4306>
+,<2720,4251,4314>
+,<2720,4314,3841>
+,<2721,2723,3823>
+,<2721,3823,5178>
+,<2721,5178,3543>
+,<2723,2725,5127>
+,<2723,5127,5126>
+,<2723,5126,3823>
+,<2724,4965,3619>
+,<2724,3619,3768>
+,<2726,4312,4314>
+,<2726,4314,4313>
+,<2728,5124,5233>
+,<2728,5233,5181>
+,<2730,5166,3531>
+,<2730,3531,3522>
+,<2730,3568,3551>
+,<2730,3551,5166>
+,<2730,3522,3577>
+,<2730,3577,3568>
+,<2734,3344,3376>
+,<2734,3376,3345>
+,<2734,2764,2763>
+,<2734,2763,3316>
+,<2734,3316,3344>
+,<2734,3345,3314>
+,<2734,3314,2765>
+,<2734,2765,2764>
+,<2753,2826,2827>
+,<2753,2827,2793>
+,<2753,2793,2794>
+,<2753,2794,2795>
+,<2753,2795,2796>
+,<2753,2796,2797>
+,<2753,2797,2798>
+,<2753,2798,2799>
+,<2753,2799,2800>
+,<2753,2800,2801>
+,<2753,2801,2802>
+,<2753,2802,2803>
+,<2753,2803,2804>
+,<2753,2804,2805>
+,<2753,2805,2806>
+,<2753,2806,2807>
+,<2753,2807,2825>
+,<2753,2825,2824>
+,<2753,2824,2808>
+,<2753,2808,2855>
+,<2753,2855,2898>
+,<2753,2898,2896>
+,<2753,2896,2894>
+,<2753,2894,2892>
+,<2753,2892,2890>
+,<2753,2890,2888>
+,<2753,2888,2886>
+,<2753,2886,2884>
+,<2753,2884,2882>
+,<2753,2882,2880>
+,<2753,2880,2878>
+,<2753,2878,2876>
+,<2753,2876,2874>
+,<2753,2874,2872>
+,<2753,2872,2870>
+,<2753,2870,2843>
+,<2754,2755,2756>
+,<2754,2756,2757>
+,<2754,2757,2758>
+,<2754,2758,2759>
+,<2754,2759,2760>
+,<2754,2760,2761>
+,<2754,2761,2762>
+,<2754,2762,2763>
+,<2754,2763,2764>
+,<2754,2764,2765>
+,<2754,2765,2766>
+,<2754,2766,2823>
+,<2754,2823,2822>
+,<2754,2822,2808>
+,<2754,2808,2824>
+,<2754,2824,2825>
+,<2767,2822,2823>
+,<2767,2823,2809>
+,<2767,2809,2810>
+,<2767,2810,2811>
+,<2767,2811,2812>
+,<2767,2812,2813>
+,<2767,2813,2814>
+,<2767,2814,2769>
+,<2767,2769,2768>
+,<2768,2769,2779>
+,<2768,2779,2778>
+,<2768,2778,2816>
+,<2768,2816,2772>
+,<2768,2772,2771>
+,<2768,2771,2770>
+,<2774,2775,2777>
+,<2774,2777,2776>
+,<2780,2820,2821>
+,<2780,2821,2818>
+,<2780,2818,2819>
+,<2780,2819,2817>
+,<2780,2817,2827>
+,<2780,2827,2826>
+,<2780,2826,2792>
+,<2780,2792,2828>
+,<2780,2828,2829>
+,<2780,2829,2781>
+,<2782,2830,2831>
+,<2782,2831,2788>
+,<2782,2788,2789>
+,<2782,2789,2790>
+,<2782,2790,2791>
+,<2782,2791,2829>
+,<2782,2829,2828>
+,<2783,2831,2830>
+,<2783,2830,2787>
+,<2783,2787,2832>
+,<2783,2832,2833>
+,<2783,2833,2784>
+,<2785,2786,2833>
+,<2785,2833,2832>
+,<2809,3315,3348>
+,<2809,3348,2902>
+,<2809,2902,2810>
+,<2810,2902,3349>
+,<2810,3349,3312>
+,<2810,3312,2811>
+,<2840,5450,5508>
+,<2840,5508,5449>
+,<2840,5449,4352>
+,<2843,2870,4354>
+,<2843,4354,5507>
+,<2843,5507,4002>
+,<2843,4002,2868>
+,<2845,4330,4381>
+,<2845,4381,4331>
+,<2845,2903,2905>
+,<2845,2905,4012>
+,<2845,4012,4330>
+,<2846,6411,6434>
+,<2846,6434,6412>
+,<2846,4046,4038>
+,<2846,4038,6411>
+,<2846,6412,6396>
+,<2846,6396,4046>
+,<2848,3366,3376>
+,<2848,3376,3367>
+,<2849,3338,3376>
+,<2849,3376,3339>
+,<2851,3374,3376>
+,<2851,3376,3375>
+,<2852,6401,7358>
+,<2852,7358,7359>
+,<2857,5442,5508>
+,<2857,5508,5443>
+,<2859,5508,5442>
+,<2859,5442,4016>
+,<2860,2862,2863>
+,<2860,2863,5448>
+,<2860,5448,5447>
+,<2861,5445,5508>
+,<2861,5508,5444>
+,<2861,2866,2868>
+,<2861,2868,4002>
+,<2861,4002,5445>
+,<2861,5444,4355>
+,<2861,4355,2864>
+,<2861,2864,2866>
+,<2865,5451,5508>
+,<2865,5508,5452>
+,<2867,5456,5508>
+,<2867,5508,5457>
+,<2870,2872,3357>
+,<2870,3357,5506>
+,<2870,5506,4354>
+,<2871,5461,5508>
+,<2871,5508,5463>
+,<2872,2874,3986>
+,<2872,3986,4345>
+,<2872,4345,5472>
+,<2872,5472,5505>
+,<2872,5505,3357>
+,<2873,4334,4381>
+,<2873,4381,4335>
+,<2873,4335,3420>
+,<2873,3420,2892>
+,<2873,2892,2894>
+,<2874,2876,4015>
+,<2874,4015,4344>
+,<2874,4344,3986>
+,<2875,4375,4381>
+,<2875,4381,4376>
+,<2875,4046,3991>
+,<2875,3991,4375>
+,<2875,4376,3999>
+,<2875,3999,4046>
+,<2876,2878,4004>
+,<2876,4004,4343>
+,<2876,4343,4015>
+,<2877,4371,4381>
+,<2877,4381,4372>
+,<2877,4046,3358>
+,<2877,3358,4371>
+,<2877,4372,4000>
+,<2877,4000,4046>
+,<2879,4357,4381>
+,<2879,4381,4358>
+,<2881,5502,5508>
+,<2881,5508,5503>
+,<2881,5503,4353>
+,<2881,4353,4381>
+,<2883,6425,6434>
+,<2883,6434,6426>
+,<2884,2886,3387>
+,<2884,3387,4339>
+,<2884,4339,3363>
+,<2885,7342,7359>
+,<2885,7359,7343>
+,<2885,6434,3424>
+,<2885,3424,7342>
+,<2885,7343,4043>
+,<2885,4043,6434>
+,<2886,2888,4014>
+,<2886,4014,4338>
+,<2886,4338,3387>
+,<2887,7341,7359>
+,<2887,7359,7342>
+,<2887,7342,3424>
+,<2887,3424,4040>
+,<2887,4046,4017>
+,<2887,4017,7341>
+,<2887,4040,6406>
+,<2887,6406,6397>
+,<2887,6397,4046>
+,<2888,2890,4013>
+,<2888,4013,4337>
+,<2888,4337,4014>
+,<2889,5500,5508>
+,<2889,5508,5501>
+,<2889,4381,5473>
+,<2889,5473,5500>
+,<2890,2892,3420>
+,<2890,3420,4336>
+,<2890,4336,4013>
+,<2891,4377,4381>
+,<2891,4381,4378>
+,<2891,4046,3999>
+,<2891,3999,4377>
+,<2891,4378,4316>
+,<2891,4316,4046>
+,<2895,4381,4020>
+,<2895,4020,4019>
+,<2897,3416,7359>
+,<2897,7359,7310>
+,<2897,5575,7294>
+,<2897,7294,3416>
+,<2897,7310,5552>
+,<2897,5552,5575>
+,<2901,7344,7359>
+,<2901,7359,7345>
+,<2901,6434,4043>
+,<2901,4043,7344>
+,<2901,7345,7301>
+,<2901,7301,6434>
+,<2902,3348,3376>
+,<2902,3376,3349>
+,<2905,2907,4006>
+,<2905,4006,4329>
+,<2905,4329,4012>
+,<2907,2909,4320>
+,<2907,4320,4328>
+,<2907,4328,4006>
+,<2912,3373,3376>
+,<2912,3376,3374>
+,<2914,3369,3376>
+,<2914,3376,3370>
+,<2916,5533,5575>
+,<2916,5575,5534>
+,<2921,2927,5343>
+,<2921,5343,2925>
+,<2921,2925,2926>
+,<2922,5348,5373>
+,<2922,5373,5349>
+,<2922,5349,3098>
+,<2922,3098,3104>
+,<2922,3104,3106>
+,<2923,5335,5337>
+,<2923,5337,5373>
+,<2924,5345,5373>
+,<2924,5373,5346>
+,<2925,5343,5373>
+,<2925,5373,5344>
+,<2927,5342,5373>
+,<2927,5373,5343>
+,<2935,5338,5373>
+,<2935,5373,5339>
+,<2935,5339,5320>
+,<2949,3013,3014>
+,<2949,3014,3010>
+,<2949,3010,3012>
+,<2949,3012,3011>
+,<2950,3014,3013>
+,<2950,3013,3009>
+,<2950,3009,3015>
+,<2950,3015,3016>
+,<2950,3016,2951>
+,<2952,3017,3018>
+,<2952,3018,3007>
+,<2952,3007,3008>
+,<2952,3008,3016>
+,<2952,3016,3015>
+,<2953,3018,3017>
+,<2953,3017,3006>
+,<2953,3006,3019>
+,<2953,3019,3020>
+,<2953,3020,2955>
+,<2953,2955,2954>
+,<2956,3021,3022>
+,<2956,3022,3002>
+,<2956,3002,3003>
+,<2956,3003,3004>
+,<2956,3004,3005>
+,<2956,3005,3020>
+,<2956,3020,3019>
+,<2957,3022,3021>
+,<2957,3021,3001>
+,<2957,3001,3023>
+,<2957,3023,3024>
+,<2957,3024,2962>
+,<2957,2962,2961>
+,<2957,2961,2960>
+,<2957,2960,2959>
+,<2957,2959,2958>
+,<2963,3025,3026>
+,<2963,3026,2995>
+,<2963,2995,2996>
+,<2963,2996,2997>
+,<2963,2997,2998>
+,<2963,2998,2999>
+,<2963,2999,3000>
+,<2963,3000,3024>
+,<2963,3024,3023>
+,<2964,3026,3025>
+,<2964,3025,2994>
+,<2964,2994,3027>
+,<2964,3027,3028>
+,<2964,3028,2969>
+,<2964,2969,2968>
+,<2964,2968,2967>
+,<2964,2967,2966>
+,<2964,2966,2965>
+,<2964,3971,3972>
+,<2964,3972,3969>
+,<2964,3969,2995>
+,<2964,2995,3026>
+,<2965,2966,3953>
+,<2965,3953,3954>
+,<2965,3954,3970>
+,<2969,3028,2993>
+,<2969,2993,3950>
+,<2969,3950,3965>
+,<2969,3965,3951>
+,<2970,3029,3030>
+,<2970,3030,2989>
+,<2970,2989,2990>
+,<2970,2990,2991>
+,<2970,2991,2992>
+,<2970,2992,2993>
+,<2970,2993,3028>
+,<2970,3028,3027>
+,<2971,3030,3029>
+,<2971,3029,2988>
+,<2971,2988,2986>
+,<2971,2986,2987>
+,<2971,2987,2974>
+,<2971,2974,2973>
+,<2971,2973,2972>
+,<2973,2974,3955>
+,<2973,3955,3924>
+,<2973,3924,3946>
+,<2974,2987,2984>
+,<2974,2984,3848>
+,<2974,3848,7184>
+,<2974,7184,3908>
+,<2974,3908,3957>
+,<2974,3957,3955>
+,<2975,3032,3031>
+,<2975,3031,3034>
+,<2975,3034,2981>
+,<2975,2981,3033>
+,<2975,3033,2976>
+,<2977,3035,3038>
+,<2977,3038,3037>
+,<2977,3037,3039>
+,<2977,3039,3040>
+,<2978,3095,3097>
+,<2978,3097,5982>
+,<2978,5982,6010>
+,<2979,2980,3033>
+,<2979,3033,2981>
+,<2979,2981,3036>
+,<2979,3036,3038>
+,<2979,3038,3035>
+,<2982,2983,2984>
+,<2982,2984,2987>
+,<2982,2987,2986>
+,<2982,2986,2985>
+,<2982,2985,3031>
+,<2982,3031,3032>
+,<2995,3969,3973>
+,<2995,3973,3967>
+,<2995,3967,2996>
+,<3057,7225,7176>
+,<3057,7176,3061>
+,<3057,3061,7175>
+,<3057,7175,3851>
+,<3061,3069,3074>
+,<3061,3074,3071>
+,<3061,3071,7175>
+,<3065,6568,6509>
+,<3065,6509,5092>
+,<3065,5092,7161>
+,<3066,7209,7225>
+,<3066,7225,7210>
+,<3067,7217,7225>
+,<3067,7225,7218>
+,<3087,3092,3091>
+,<3087,3091,3093>
+,<3087,3093,3094>
+,<3096,6004,6044>
+,<3096,6044,6005>
+,<3098,5349,5373>
+,<3098,5373,5350>
+,<3100,5341,5373>
+,<3100,5373,5342>
+,<3103,6040,6844>
+,<3103,6844,6846>
+,<3103,6846,6843>
+,<3105,6021,6044>
+,<3105,6044,6022>
+,<3109,3638,4641>
+,<3109,4641,4580>
+,<3109,3175,3636>
+,<3109,3636,3638>
+,<3109,4580,3637>
+,<3109,3637,3175>
+,<3111,3175,3114>
+,<3111,3114,3112>
+,<3115,3116,3117>
+,<3115,3117,3175>
+,<3118,3120,3175>
+,<3118,3175,3119>
+,<3128,6642,6702>
+,<3128,6702,6643>
+,<3129,4199,6702>
+,<3129,6702,6660>
+,<3130,6685,6702>
+,<3130,6702,6688>
+,<3130,3644,4211>
+,<3130,4211,6685>
+,<3131,6679,6677>
+,<3131,6677,4247>
+,<3133,4191,4247>
+,<3133,4247,4192>
+,<3133,3644,4183>
+,<3133,4183,4191>
+,<3134,6666,6702>
+,<3134,6702,6665>
+,<3134,6665,3142>
+,<3134,3142,5709>
+,<3135,4247,4188>
+,<3135,4188,4187>
+,<3136,3725,3778>
+,<3136,3778,3724>
+,<3136,3644,3621>
+,<3136,3621,3725>
+,<3136,3724,3606>
+,<3136,3606,3644>
+,<3137,3729,3778>
+,<3137,3778,3728>
+,<3137,3644,3622>
+,<3137,3622,3729>
+,<3138,6651,6702>
+,<3138,6702,3596>
+,<3140,5714,5776>
+,<3140,5776,5715>
+,<3140,4247,3628>
+,<3140,3628,5714>
+,<3140,5715,4232>
+,<3140,4232,4247>
+,<3141,6661,6702>
+,<3141,6702,6664>
+,<3142,6665,6702>
+,<3142,6702,6668>
+,<3142,6668,4200>
+,<3142,4200,5709>
+,<3146,4641,3642>
+,<3146,3642,4583>
+,<3147,4601,4641>
+,<3147,4641,4600>
+,<3147,3644,3936>
+,<3147,3936,4601>
+,<3148,4628,4641>
+,<3148,4641,4627>
+,<3148,4627,4591>
+,<3148,4591,3979>
+,<3149,4640,4641>
+,<3149,4641,4639>
+,<3149,3979,4587>
+,<3149,4587,4640>
+,<3149,4639,3611>
+,<3149,3611,3979>
+,<3151,7291,7292>
+,<3151,7292,7229>
+,<3153,3928,4641>
+,<3153,4641,3922>
+,<3153,3175,3939>
+,<3153,3939,3928>
+,<3153,3922,3640>
+,<3153,3640,3175>
+,<3155,7248,7292>
+,<3155,7292,7251>
+,<3155,7251,7249>
+,<3155,7249,3778>
+,<3156,4641,3631>
+,<3156,3631,3933>
+,<3156,3934,3632>
+,<3156,3632,4641>
+,<3156,3933,3175>
+,<3156,3175,3934>
+,<3157,7240,7292>
+,<3157,7292,7243>
+,<3157,4641,3945>
+,<3157,3945,7240>
+,<3157,7243,7241>
+,<3157,7241,4641>
+,<3158,7253,7292>
+,<3158,7292,7256>
+,<3158,4965,3746>
+,<3158,3746,3769>
+,<3158,3769,7253>
+,<3158,7256,7254>
+,<3158,7254,4965>
+,<3162,3166,3168>
+,<3162,3168,3175>
+,<3164,3169,3175>
+,<3164,3175,3170>
+,<3165,3171,3175>
+,<3165,3175,3172>
+,<3175,3591,6638>
+,<3175,6638,6639>
+,<3175,6698,6636>
+,<3175,6636,3591>
+,<3175,3640,4598>
+,<3175,4598,3580>
+,<3175,3580,3581>
+,<3175,3930,3639>
+,<3175,3639,3921>
+,<3175,3931,3714>
+,<3175,3714,3930>
+,<3175,3933,3631>
+,<3175,3631,3935>
+,<3175,3932,3632>
+,<3175,3632,3934>
+,<3175,4583,3642>
+,<3175,3642,3932>
+,<3175,3637,4582>
+,<3175,4582,3635>
+,<3175,4579,4581>
+,<3175,4581,3636>
+,<3175,4577,4578>
+,<3175,4578,4579>
+,<3177,6796,6836>
+,<3177,6836,6797>
+,<3178,3215,3242>
+,<3178,3242,3216>
+,<3179,6836,6776>
+,<3179,6776,3218>
+,<3180,3195,3242>
+,<3180,3242,3196>
+,<3181,6811,6836>
+,<3181,6836,6812>
+,<3186,3194,3242>
+,<3186,3242,3195>
+,<3187,3192,3242>
+,<3187,3242,3193>
+,<3197,3213,3242>
+,<3197,3242,3214>
+,<3198,3211,3242>
+,<3198,3242,3212>
+,<3199,3209,3242>
+,<3199,3242,3210>
+,<3200,3207,3242>
+,<3200,3242,3208>
+,<3219,3221,6790>
+,<3219,6790,6836>
+,<3220,6775,6774>
+,<3220,6774,6836>
+,<3224,6805,6836>
+,<3224,6836,6806>
+,<3228,6798,6836>
+,<3228,6836,6801>
+,<3229,6770,6771>
+,<3229,6771,3242>
+,<3243,4051,4458>
+,<3243,4458,4508>
+,<3245,6726,6769>
+,<3245,6769,6729>
+,<3246,6769,6724>
+,<3246,6724,3774>
+,<3246,3735,6720>
+,<3246,6720,6769>
+,<3247,6751,6769>
+,<3247,6769,6750>
+,<3247,3845,5754>
+,<3247,5754,6751>
+,<3247,6750,3789>
+,<3247,3789,3845>
+,<3248,6755,6769>
+,<3248,6769,6754>
+,<3248,3845,6444>
+,<3248,6444,6755>
+,<3249,4167,4166>
+,<3249,4166,4180>
+,<3250,3501,4163>
+,<3250,4163,4180>
+,<3251,4178,4180>
+,<3251,4180,4179>
+,<3252,4175,4180>
+,<3252,4180,4176>
+,<3255,4128,4180>
+,<3255,4180,3257>
+,<3256,4115,4180>
+,<3256,4180,4163>
+,<3256,4163,3501>
+,<3256,3501,3309>
+,<3258,3266,4180>
+,<3258,4180,4114>
+,<3262,4156,4180>
+,<3262,4180,4155>
+,<3263,4059,4508>
+,<3263,4508,4465>
+,<3263,3309,4152>
+,<3263,4152,4059>
+,<3263,4465,4463>
+,<3263,4463,3309>
+,<3264,4142,4180>
+,<3264,4180,4145>
+,<3265,4137,4180>
+,<3265,4180,4140>
+,<3273,5895,7067>
+,<3273,7067,5898>
+,<3273,5898,7070>
+,<3275,3276,4508>
+,<3275,4508,4468>
+,<3275,4468,4466>
+,<3275,4466,3309>
+,<3277,5375,5376>
+,<3277,5376,5377>
+,<3277,3510,3457>
+,<3277,3457,4150>
+,<3277,4150,5374>
+,<3277,5374,5375>
+,<3277,5377,5378>
+,<3277,5378,3510>
+,<3278,4665,4709>
+,<3278,4709,4668>
+,<3278,4113,3499>
+,<3278,3499,4665>
+,<3278,4668,4484>
+,<3278,4484,4113>
+,<3281,4669,4709>
+,<3281,4709,3497>
+,<3281,4113,4670>
+,<3281,4670,4669>
+,<3281,3497,4481>
+,<3281,4481,4113>
+,<3282,4093,4672>
+,<3282,4672,4709>
+,<3283,6486,6501>
+,<3283,6501,6485>
+,<3284,6501,6460>
+,<3284,6460,3514>
+,<3285,6501,6463>
+,<3285,6463,3803>
+,<3285,3288,6462>
+,<3285,6462,6501>
+,<3285,3803,4508>
+,<3285,4508,3288>
+,<3286,6466,6501>
+,<3286,6501,6467>
+,<3286,6467,4651>
+,<3286,4651,4709>
+,<3287,6453,6501>
+,<3287,6501,6456>
+,<3287,3309,3301>
+,<3287,3301,6453>
+,<3287,6456,6454>
+,<3287,6454,3309>
+,<3288,4508,3304>
+,<3288,3304,6462>
+,<3289,6443,6441>
+,<3289,6441,3845>
+,<3290,6441,6443>
+,<3290,6443,6501>
+,<3291,6501,6459>
+,<3291,6459,4646>
+,<3291,3804,6455>
+,<3291,6455,6501>
+,<3291,4646,3309>
+,<3291,3309,3804>
+,<3292,4657,4709>
+,<3292,4709,4658>
+,<3292,4508,4104>
+,<3292,4104,4657>
+,<3292,4658,4496>
+,<3292,4496,4508>
+,<3293,4709,4669>
+,<3293,4669,4670>
+,<3293,4449,4667>
+,<3293,4667,4709>
+,<3293,4670,4113>
+,<3293,4113,4449>
+,<3294,4650,6465>
+,<3294,6465,6501>
+,<3295,4502,4508>
+,<3295,4508,4503>
+,<3295,3309,4112>
+,<3295,4112,4502>
+,<3295,4503,4050>
+,<3295,4050,3309>
+,<3296,6501,6468>
+,<3296,6468,4645>
+,<3296,4651,6467>
+,<3296,6467,6501>
+,<3296,4645,4709>
+,<3296,4709,4651>
+,<3297,6501,6453>
+,<3297,6453,3301>
+,<3297,3305,6451>
+,<3297,6451,6501>
+,<3297,3301,3309>
+,<3297,3309,3305>
+,<3298,6745,6769>
+,<3298,6769,6744>
+,<3299,6743,6769>
+,<3299,6769,6742>
+,<3299,6501,3793>
+,<3299,3793,6743>
+,<3300,6438,6501>
+,<3300,6501,6437>
+,<3300,3845,3303>
+,<3300,3303,6438>
+,<3300,6437,3806>
+,<3300,3806,3845>
+,<3302,6460,6501>
+,<3302,6501,4108>
+,<3302,3309,3514>
+,<3302,3514,6460>
+,<3303,6500,6501>
+,<3303,6501,6438>
+,<3303,3845,3519>
+,<3303,3519,6500>
+,<3304,4508,4499>
+,<3304,4499,4648>
+,<3305,3309,6450>
+,<3305,6450,6451>
+,<3306,6490,6501>
+,<3306,6501,6491>
+,<3307,6463,6501>
+,<3307,6501,6461>
+,<3307,4508,3803>
+,<3307,3803,6463>
+,<3308,6769,6727>
+,<3308,6727,3794>
+,<3308,3761,6723>
+,<3308,6723,6769>
+,<3309,3805,6448>
+,<3309,6448,6446>
+,<3309,4466,4467>
+,<3309,4467,4455>
+,<3309,4460,4461>
+,<3309,4461,4152>
+,<3309,4055,4458>
+,<3309,4458,4051>
+,<3309,4489,4506>
+,<3309,4506,4052>
+,<3309,4488,4505>
+,<3309,4505,4489>
+,<3309,4050,4504>
+,<3309,4504,4488>
+,<3309,4646,6459>
+,<3309,6459,6457>
+,<3309,6454,6455>
+,<3309,6455,3804>
+,<3310,7350,7359>
+,<3310,7359,7351>
+,<3311,5570,5575>
+,<3311,5575,5571>
+,<3311,3443,3398>
+,<3311,3398,5570>
+,<3311,5571,3392>
+,<3311,3392,3443>
+,<3312,3349,3376>
+,<3312,3376,3350>
+,<3312,3350,3313>
+,<3314,3345,3376>
+,<3314,3376,3346>
+,<3315,3347,3376>
+,<3315,3376,3348>
+,<3316,3343,3376>
+,<3316,3376,3344>
+,<3317,3341,3376>
+,<3317,3376,3342>
+,<3318,3329,3376>
+,<3318,3376,3330>
+,<3357,5505,5508>
+,<3357,5508,5506>
+,<3358,4370,4381>
+,<3358,4381,4371>
+,<3359,7314,7359>
+,<3359,7359,7315>
+,<3359,5575,5511>
+,<3359,5511,7314>
+,<3359,7315,7305>
+,<3359,7305,5575>
+,<3360,7359,3393>
+,<3360,3393,6386>
+,<3360,4037,6384>
+,<3360,6384,7359>
+,<3360,6386,3443>
+,<3360,3443,4037>
+,<3361,3435,3443>
+,<3361,3443,3436>
+,<3362,5553,5555>
+,<3362,5555,3443>
+,<3362,3443,3431>
+,<3363,4339,4381>
+,<3363,4381,4340>
+,<3364,5524,5575>
+,<3364,5575,5525>
+,<3365,5539,5575>
+,<3365,5575,5540>
+,<3376,3401,5545>
+,<3376,5545,5514>
+,<3376,5513,5544>
+,<3376,5544,3401>
+,<3377,7346,7359>
+,<3377,7359,7347>
+,<3377,6434,7301>
+,<3377,7301,7346>
+,<3377,7347,7300>
+,<3377,7300,6434>
+,<3378,7359,5558>
+,<3378,5558,6402>
+,<3378,6398,3400>
+,<3378,3400,7359>
+,<3378,6402,3443>
+,<3378,3443,6398>
+,<3379,3431,3443>
+,<3379,3443,3432>
+,<3380,7353,7359>
+,<3380,7359,7354>
+,<3381,3437,3443>
+,<3381,3443,3438>
+,<3382,3433,3443>
+,<3382,3443,3434>
+,<3383,3439,3443>
+,<3383,3443,3440>
+,<3384,7323,7359>
+,<3384,7359,7324>
+,<3384,4046,3399>
+,<3384,3399,7323>
+,<3384,7324,5512>
+,<3384,5512,4046>
+,<3385,7327,7359>
+,<3385,7359,7328>
+,<3385,4046,7295>
+,<3385,7295,7327>
+,<3385,7328,4044>
+,<3385,4044,4046>
+,<3386,7330,7359>
+,<3386,7359,7331>
+,<3386,4046,7302>
+,<3386,7302,7330>
+,<3386,7331,3984>
+,<3386,3984,4046>
+,<3387,4338,4381>
+,<3387,4381,4339>
+,<3389,5540,5575>
+,<3389,5575,5541>
+,<3390,5530,5575>
+,<3390,5575,5531>
+,<3390,5531,3403>
+,<3391,5550,5575>
+,<3391,5575,5551>
+,<3391,5551,5554>
+,<3391,5554,7293>
+,<3391,7293,4046>
+,<3392,5571,5575>
+,<3392,5575,5572>
+,<3392,5572,3418>
+,<3392,3418,3443>
+,<3393,7359,5556>
+,<3393,5556,5559>
+,<3393,5559,3443>
+,<3393,3443,6386>
+,<3397,5565,5575>
+,<3397,5575,5566>
+,<3398,5569,5575>
+,<3398,5575,5570>
+,<3399,7322,7359>
+,<3399,7359,7323>
+,<3399,4046,3417>
+,<3399,3417,7322>
+,<3400,6400,5557>
+,<3400,5557,7359>
+,<3400,6398,3443>
+,<3400,3443,6400>
+,<3401,5544,5575>
+,<3401,5575,5545>
+,<3402,5534,5575>
+,<3402,5575,5535>
+,<3404,5520,5575>
+,<3404,5575,5521>
+,<3406,3426,3407>
+,<3406,3407,5575>
+,<3408,5527,5575>
+,<3408,5575,5528>
+,<3409,5537,5575>
+,<3409,5575,5538>
+,<3410,5538,5575>
+,<3410,5575,5539>
+,<3411,7335,7359>
+,<3411,7359,7336>
+,<3411,4046,6404>
+,<3411,6404,7335>
+,<3411,7336,7298>
+,<3411,7298,4046>
+,<3413,4380,4381>
+,<3413,4381,4009>
+,<3413,4046,4018>
+,<3413,4018,4380>
+,<3414,5526,5575>
+,<3414,5575,5527>
+,<3415,5562,5575>
+,<3415,5575,5563>
+,<3415,3443,5509>
+,<3415,5509,5562>
+,<3415,5563,5510>
+,<3415,5510,3443>
+,<3416,7294,5560>
+,<3416,5560,7359>
+,<3417,7321,7359>
+,<3417,7359,7322>
+,<3417,4046,7296>
+,<3417,7296,7321>
+,<3418,5572,5575>
+,<3418,5575,5573>
+,<3418,5573,3996>
+,<3418,3996,3443>
+,<3420,4335,4381>
+,<3420,4381,4336>
+,<3422,6376,6375>
+,<3422,6375,6378>
+,<3422,6378,6434>
+,<3423,6418,6434>
+,<3423,6434,6419>
+,<3424,6434,6406>
+,<3424,6406,4040>
+,<3425,4381,4325>
+,<3425,4325,4324>
+,<3425,4324,4007>
+,<3427,7299,7349>
+,<3427,7349,7359>
+,<3427,7359,7350>
+,<3428,7348,7359>
+,<3428,7359,7349>
+,<3428,6434,7300>
+,<3428,7300,7348>
+,<3428,7349,7299>
+,<3428,7299,6385>
+,<3428,6385,6434>
+,<3429,7352,7359>
+,<3429,7359,7353>
+,<3430,7354,7359>
+,<3430,7359,7355>
+,<3443,3992,5561>
+,<3443,5561,5509>
+,<3443,5559,5556>
+,<3443,5556,7308>
+,<3443,7308,3992>
+,<3443,6399,6384>
+,<3443,6384,4037>
+,<3443,6403,5557>
+,<3443,5557,6400>
+,<3443,3982,7358>
+,<3443,7358,6401>
+,<3443,4039,7357>
+,<3443,7357,3982>
+,<3443,5555,7356>
+,<3443,7356,4039>
+,<3445,6251,5609>
+,<3445,5609,5642>
+,<3447,3507,3510>
+,<3447,3510,3508>
+,<3448,3699,3711>
+,<3448,3711,3700>
+,<3449,3708,3711>
+,<3449,3711,3709>
+,<3450,3470,3510>
+,<3450,3510,3471>
+,<3451,3472,3510>
+,<3451,3510,3473>
+,<3452,3474,3510>
+,<3452,3510,3475>
+,<3453,3476,3510>
+,<3453,3510,3477>
+,<3454,5253,5256>
+,<3454,5256,5306>
+,<3455,4060,4508>
+,<3455,4508,4471>
+,<3455,4180,4154>
+,<3455,4154,4060>
+,<3455,4471,4469>
+,<3455,4469,4180>
+,<3456,3503,3510>
+,<3456,3510,3504>
+,<3458,3707,3711>
+,<3458,3711,3708>
+,<3459,3711,3693>
+,<3459,3693,3689>
+,<3459,4890,3647>
+,<3459,3647,3711>
+,<3460,3704,3711>
+,<3460,3711,3705>
+,<3461,3696,3711>
+,<3461,3711,3697>
+,<3463,3702,3711>
+,<3463,3711,3703>
+,<3464,5598,5642>
+,<3464,5642,5599>
+,<3465,3701,3711>
+,<3465,3711,3702>
+,<3483,3510,3486>
+,<3483,3486,5251>
+,<3483,5251,5255>
+,<3484,5247,5306>
+,<3484,5306,5248>
+,<3484,5248,4053>
+,<3484,4053,3510>
+,<3485,5257,5306>
+,<3485,5306,5258>
+,<3486,5252,5306>
+,<3486,5306,5251>
+,<3486,3510,4472>
+,<3486,4472,5252>
+,<3487,5263,5306>
+,<3487,5306,5264>
+,<3488,5245,5306>
+,<3488,5306,5240>
+,<3488,3510,5243>
+,<3488,5243,5245>
+,<3488,5240,5241>
+,<3488,5241,3510>
+,<3489,4070,4069>
+,<3489,4069,5306>
+,<3491,6268,6300>
+,<3491,6300,6269>
+,<3492,6313,6367>
+,<3492,6367,6314>
+,<3492,5376,6307>
+,<3492,6307,6313>
+,<3492,6314,5844>
+,<3492,5844,5376>
+,<3493,5405,5376>
+,<3493,5376,5404>
+,<3493,5306,5286>
+,<3493,5286,5405>
+,<3493,5404,3650>
+,<3493,3650,5306>
+,<3494,4090,4113>
+,<3494,4113,4089>
+,<3495,7077,5898>
+,<3495,5898,7076>
+,<3495,4113,7026>
+,<3495,7026,7077>
+,<3495,7076,5892>
+,<3495,5892,4113>
+,<3496,4064,4457>
+,<3496,4457,4113>
+,<3497,4709,4673>
+,<3497,4673,4481>
+,<3498,4479,4068>
+,<3498,4068,4113>
+,<3499,4666,4709>
+,<3499,4709,4665>
+,<3499,4113,4491>
+,<3499,4491,4666>
+,<3500,4493,4677>
+,<3500,4677,4709>
+,<3510,5961,7423>
+,<3510,7423,4383>
+,<3510,5968,7422>
+,<3510,7422,5961>
+,<3510,7361,7420>
+,<3510,7420,5968>
+,<3510,5239,5242>
+,<3510,5242,5243>
+,<3510,4149,4148>
+,<3510,4148,5239>
+,<3510,5268,5305>
+,<3510,5305,5296>
+,<3510,5378,5380>
+,<3510,5380,5268>
+,<3511,6496,6495>
+,<3511,6495,3845>
+,<3511,3845,3539>
+,<3512,4309,4314>
+,<3512,4314,4310>
+,<3513,3845,3779>
+,<3513,3779,6440>
+,<3515,7098,7158>
+,<3515,7158,7101>
+,<3515,7101,4923>
+,<3515,4923,4965>
+,<3516,3802,6468>
+,<3516,6468,6501>
+,<3516,6501,6476>
+,<3518,3834,3845>
+,<3518,3845,4273>
+,<3518,4273,4272>
+,<3518,4272,4286>
+,<3518,4286,3782>
+,<3518,3782,3577>
+,<3519,6499,6501>
+,<3519,6501,6500>
+,<3519,3845,6493>
+,<3519,6493,6499>
+,<3520,6494,6497>
+,<3520,6497,6501>
+,<3520,6492,3845>
+,<3520,3845,6494>
+,<3521,3527,3550>
+,<3521,3550,5166>
+,<3522,3531,3567>
+,<3522,3567,3577>
+,<3523,5166,3554>
+,<3523,3554,3564>
+,<3523,3548,5105>
+,<3523,5105,5166>
+,<3523,3564,3577>
+,<3523,3577,3548>
+,<3524,5233,3547>
+,<3524,3547,3809>
+,<3525,5156,5166>
+,<3525,5166,5157>
+,<3526,5163,5166>
+,<3526,5166,5164>
+,<3527,3577,3567>
+,<3527,3567,3550>
+,<3528,3577,3564>
+,<3528,3564,3554>
+,<3529,5106,3562>
+,<3529,3562,3577>
+,<3530,5101,5166>
+,<3530,5166,5100>
+,<3531,5166,3550>
+,<3531,3550,3567>
+,<3532,3571,3577>
+,<3532,3577,3572>
+,<3533,3573,3577>
+,<3533,3577,3574>
+,<3535,5149,5166>
+,<3535,5166,6373>
+,<3536,5233,3544>
+,<3536,3544,3811>
+,<3537,5233,5124>
+,<3537,5124,3822>
+,<3537,3543,5178>
+,<3537,5178,5233>
+,<3538,3845,3827>
+,<3538,3827,3545>
+,<3538,3545,3810>
+,<3541,5219,5233>
+,<3541,5233,5220>
+,<3541,5220,5177>
+,<3541,5177,5166>
+,<3542,5215,5233>
+,<3542,5233,5216>
+,<3545,3827,3547>
+,<3545,3547,5233>
+,<3546,5160,5166>
+,<3546,5166,5161>
+,<3547,3827,3845>
+,<3547,3845,3809>
+,<3549,5166,3552>
+,<3549,3552,3560>
+,<3551,3559,5165>
+,<3551,5165,5166>
+,<3551,3568,3577>
+,<3551,3577,3559>
+,<3552,3566,3577>
+,<3552,3577,3560>
+,<3553,3561,5102>
+,<3553,5102,5166>
+,<3555,5109,5166>
+,<3555,5166,5108>
+,<3555,3577,3563>
+,<3555,3563,5109>
+,<3556,5157,5166>
+,<3556,5166,5158>
+,<3557,5161,5166>
+,<3557,5166,5162>
+,<3561,3577,3565>
+,<3561,3565,5102>
+,<3562,5106,5166>
+,<3562,5166,5107>
+,<3562,5107,3563>
+,<3562,3563,3577>
+,<3563,5107,5166>
+,<3563,5166,5109>
+,<3565,5103,5166>
+,<3565,5166,5102>
+,<3577,3835,4299>
+,<3577,4299,3784>
+,<3577,4267,4298>
+,<3577,4298,3835>
+,<3577,3785,4297>
+,<3577,4297,4267>
+,<3577,4268,4296>
+,<3577,4296,3785>
+,<3577,4270,4290>
+,<3577,4290,3781>
+,<3577,3755,4289>
+,<3577,4289,4270>
+,<3577,4271,4288>
+,<3577,4288,3755>
+,<3577,3782,4287>
+,<3577,4287,4271>
+,<3577,3826,5228>
+,<3577,5228,3825>
+,<3578,5737,5776>
+,<3578,5776,5740>
+,<3578,5709,3623>
+,<3578,3623,5737>
+,<3578,5740,4220>
+,<3578,4220,5702>
+,<3578,5702,5709>
+,<3579,3644,3717>
+,<3579,3717,3716>
+,<3580,3644,3583>
+,<3580,3583,3581>
+,<3582,3586,3644>
+,<3582,3644,3585>
+,<3589,6639,6638>
+,<3589,6638,6702>
+,<3589,6702,6641>
+,<3590,3644,6697>
+,<3590,6697,6637>
+,<3590,6637,6700>
+,<3591,6636,6702>
+,<3591,6702,6638>
+,<3592,6683,6702>
+,<3592,6702,6686>
+,<3592,6686,4211>
+,<3592,4211,3644>
+,<3593,6678,6702>
+,<3593,6702,6681>
+,<3593,4247,6677>
+,<3593,6677,6678>
+,<3594,6648,6702>
+,<3594,6702,6649>
+,<3595,6702,6655>
+,<3595,6655,6654>
+,<3597,4185,4188>
+,<3597,4188,4247>
+,<3599,6702,6657>
+,<3599,6657,6652>
+,<3599,6653,6655>
+,<3599,6655,6702>
+,<3600,4220,5740>
+,<3600,5740,5776>
+,<3600,5776,5739>
+,<3602,3723,3778>
+,<3602,3778,3722>
+,<3602,3644,3616>
+,<3602,3616,3723>
+,<3602,3722,3621>
+,<3602,3621,3644>
+,<3603,4245,4247>
+,<3603,4247,4246>
+,<3603,4246,3738>
+,<3603,3738,3778>
+,<3604,3721,3719>
+,<3604,3719,3644>
+,<3605,3715,7274>
+,<3605,7274,7292>
+,<3606,3724,3778>
+,<3606,3778,3727>
+,<3607,4243,4247>
+,<3607,4247,4244>
+,<3607,3778,3626>
+,<3607,3626,4243>
+,<3608,5776,5718>
+,<3608,5718,4226>
+,<3608,4232,5715>
+,<3608,5715,5776>
+,<3608,4226,4247>
+,<3608,4247,4232>
+,<3609,5776,5711>
+,<3609,5711,4235>
+,<3609,4209,4218>
+,<3609,4218,5776>
+,<3610,4195,4247>
+,<3610,4247,4196>
+,<3611,4639,4641>
+,<3611,4641,3613>
+,<3611,3613,3629>
+,<3611,3629,4642>
+,<3612,4634,4641>
+,<3612,4641,4633>
+,<3612,3979,4590>
+,<3612,4590,4634>
+,<3612,4633,4589>
+,<3612,4589,3979>
+,<3613,4641,4578>
+,<3613,4578,4577>
+,<3613,4577,4576>
+,<3614,4239,4247>
+,<3614,4247,4240>
+,<3614,4240,3737>
+,<3614,3737,3778>
+,<3615,5771,5776>
+,<3615,5776,5772>
+,<3615,3778,5758>
+,<3615,5758,5771>
+,<3615,5772,5759>
+,<3615,5759,3778>
+,<3616,3720,3778>
+,<3616,3778,3723>
+,<3616,3644,3719>
+,<3616,3719,3720>
+,<3617,7292,7227>
+,<3617,7227,3943>
+,<3617,4626,3776>
+,<3617,3776,7292>
+,<3618,4949,4965>
+,<3618,4965,4950>
+,<3620,7158,7134>
+,<3620,7134,4941>
+,<3620,7118,7117>
+,<3620,7117,7158>
+,<3620,4941,4314>
+,<3620,4314,7118>
+,<3621,3722,3778>
+,<3621,3778,3725>
+,<3622,3726,3778>
+,<3622,3778,3729>
+,<3623,5738,5776>
+,<3623,5776,5737>
+,<3623,5709,4228>
+,<3623,4228,5738>
+,<3625,5666,5709>
+,<3625,5709,5667>
+,<3626,4242,4247>
+,<3626,4247,4243>
+,<3627,6694,6702>
+,<3627,6702,6693>
+,<3627,3644,4212>
+,<3627,4212,6694>
+,<3627,6693,5663>
+,<3627,5663,3644>
+,<3628,5712,5776>
+,<3628,5776,5714>
+,<3628,4247,4225>
+,<3628,4225,5712>
+,<3630,4636,4641>
+,<3630,4641,4635>
+,<3630,3979,4589>
+,<3630,4589,4636>
+,<3630,4635,4588>
+,<3630,4588,3979>
+,<3632,3932,3642>
+,<3632,3642,4641>
+,<3633,3921,3639>
+,<3633,3639,4641>
+,<3634,4641,4606>
+,<3634,4606,4597>
+,<3635,4582,4641>
+,<3635,4641,3929>
+,<3636,4581,4641>
+,<3636,4641,3638>
+,<3637,4580,4641>
+,<3637,4641,4582>
+,<3639,3930,3714>
+,<3639,3714,4641>
+,<3641,4603,4641>
+,<3641,4641,4602>
+,<3643,7260,7292>
+,<3643,7292,4616>
+,<3644,3942,4611>
+,<3644,4611,3941>
+,<3644,4607,3940>
+,<3644,3940,3942>
+,<3644,3944,4609>
+,<3644,4609,4607>
+,<3644,4596,4608>
+,<3644,4608,3944>
+,<3644,4604,4605>
+,<3644,4605,4596>
+,<3644,4597,4606>
+,<3644,4606,4604>
+,<3645,3698,3711>
+,<3645,3711,3699>
+,<3646,3700,3711>
+,<3646,3711,3701>
+,<3647,4890,5032>
+,<3647,5032,4434>
+,<3647,4434,3690>
+,<3647,3690,3711>
+,<3648,3694,3711>
+,<3648,3711,3695>
+,<3649,5591,5642>
+,<3649,5642,5592>
+,<3649,5032,3673>
+,<3649,3673,5591>
+,<3650,5404,5376>
+,<3650,5376,5292>
+,<3650,5292,5280>
+,<3650,5280,5306>
+,<3651,5589,5642>
+,<3651,5642,5590>
+,<3651,5032,5277>
+,<3651,5277,5589>
+,<3651,5590,3673>
+,<3651,3673,5032>
+,<3652,4728,5941>
+,<3652,5941,5939>
+,<3652,5939,5945>
+,<3652,5945,4443>
+,<3652,4443,4726>
+,<3652,4726,4724>
+,<3652,4724,4722>
+,<3652,4722,4720>
+,<3652,4720,4818>
+,<3652,4818,4823>
+,<3652,4823,4785>
+,<3653,5977,4725>
+,<3653,4725,5922>
+,<3655,7426,7373>
+,<3655,7373,7369>
+,<3656,7426,7372>
+,<3656,7372,7371>
+,<3658,7406,7426>
+,<3658,7426,7409>
+,<3658,3711,5973>
+,<3658,5973,7406>
+,<3660,5920,5977>
+,<3660,5977,5921>
+,<3663,5926,5977>
+,<3663,5977,5927>
+,<3665,5916,5977>
+,<3665,5977,5918>
+,<3666,5974,7426>
+,<3666,7426,7403>
+,<3666,3711,7360>
+,<3666,7360,5974>
+,<3666,7403,7401>
+,<3666,7401,3711>
+,<3668,7426,4735>
+,<3668,4735,3681>
+,<3668,7413,7415>
+,<3668,7415,7426>
+,<3668,3681,3711>
+,<3668,3711,7413>
+,<3669,7425,7426>
+,<3669,7426,5975>
+,<3670,7392,7426>
+,<3670,7426,7395>
+,<3670,5977,7362>
+,<3670,7362,7392>
+,<3670,7395,7393>
+,<3670,7393,5977>
+,<3672,5951,5977>
+,<3672,5977,5952>
+,<3672,4712,4715>
+,<3672,4715,4717>
+,<3672,4717,4733>
+,<3672,4733,5951>
+,<3672,5952,3675>
+,<3672,3675,4710>
+,<3672,4710,4712>
+,<3673,5590,5642>
+,<3673,5642,5591>
+,<3675,5952,5977>
+,<3675,5977,5953>
+,<3676,4401,6635>
+,<3676,6635,4425>
+,<3677,6622,6635>
+,<3677,6635,6623>
+,<3677,4819,4821>
+,<3677,4821,4822>
+,<3677,4822,4384>
+,<3677,4384,6622>
+,<3677,6623,4399>
+,<3677,4399,4807>
+,<3677,4807,4819>
+,<3678,4743,6629>
+,<3678,6629,6635>
+,<3678,6635,6630>
+,<3679,5955,5977>
+,<3679,5977,5956>
+,<3679,5032,5931>
+,<3679,5931,5955>
+,<3679,5956,4970>
+,<3679,4970,5032>
+,<3681,4735,7417>
+,<3681,7417,3711>
+,<3683,4993,5032>
+,<3683,5032,4994>
+,<3683,4892,4891>
+,<3683,4891,4894>
+,<3683,4894,4882>
+,<3683,4882,4993>
+,<3683,4994,4986>
+,<3683,4986,4889>
+,<3683,4889,4892>
+,<3684,4998,5032>
+,<3684,5032,4999>
+,<3684,4999,4713>
+,<3685,5003,5032>
+,<3685,5032,5004>
+,<3686,5835,5843>
+,<3686,5843,5836>
+,<3687,5642,5587>
+,<3687,5587,5585>
+,<3687,5585,5586>
+,<3688,5019,4979>
+,<3688,4979,5642>
+,<3688,5642,5018>
+,<3688,5032,5024>
+,<3688,5024,5019>
+,<3688,5018,5014>
+,<3688,5014,5032>
+,<3691,4888,5032>
+,<3691,5032,4850>
+,<3692,4967,5032>
+,<3692,5032,4966>
+,<3711,5971,7415>
+,<3711,7415,7413>
+,<3711,5960,7414>
+,<3711,7414,5971>
+,<3711,5932,7411>
+,<3711,7411,5960>
+,<3711,5962,7412>
+,<3711,7412,5932>
+,<3711,7408,5972>
+,<3711,5972,5962>
+,<3711,5959,7407>
+,<3711,7407,5973>
+,<3711,7401,7402>
+,<3711,7402,4737>
+,<3713,5774,5776>
+,<3713,5776,5775>
+,<3713,4247,4238>
+,<3713,4238,3732>
+,<3713,3732,4230>
+,<3713,4230,5774>
+,<3713,5775,4231>
+,<3713,4231,4247>
+,<3716,3717,3718>
+,<3716,3718,3778>
+,<3719,3721,3778>
+,<3719,3778,3720>
+,<3731,5717,5776>
+,<3731,5776,4224>
+,<3731,4247,5716>
+,<3731,5716,5717>
+,<3731,4224,3736>
+,<3731,3736,4247>
+,<3732,3778,5759>
+,<3732,5759,5773>
+,<3732,5773,4230>
+,<3733,5977,7393>
+,<3733,7393,7394>
+,<3734,5722,5776>
+,<3734,5776,4223>
+,<3734,4247,3739>
+,<3734,3739,5722>
+,<3734,4223,4227>
+,<3734,4227,4247>
+,<3736,4224,5776>
+,<3736,5776,5721>
+,<3736,5721,5719>
+,<3736,5719,4247>
+,<3737,4240,4247>
+,<3737,4247,4241>
+,<3739,5723,5776>
+,<3739,5776,5722>
+,<3739,4247,4233>
+,<3739,4233,5723>
+,<3740,5767,5776>
+,<3740,5776,5768>
+,<3740,3778,5756>
+,<3740,5756,5767>
+,<3740,5768,5757>
+,<3740,5757,3778>
+,<3741,3841,4314>
+,<3741,4314,3773>
+,<3741,3773,7120>
+,<3743,7242,7292>
+,<3743,7292,4593>
+,<3743,4641,7241>
+,<3743,7241,7242>
+,<3743,4593,4610>
+,<3743,4610,4641>
+,<3744,4945,4965>
+,<3744,4965,4946>
+,<3745,4955,4965>
+,<3745,4965,4956>
+,<3747,3766,3762>
+,<3747,3762,4965>
+,<3748,3765,4965>
+,<3748,4965,3763>
+,<3750,4956,4965>
+,<3750,4965,4957>
+,<3751,4964,4965>
+,<3751,4965,3764>
+,<3752,3842,4314>
+,<3752,4314,4251>
+,<3753,4958,4965>
+,<3753,4965,4959>
+,<3754,6703,6769>
+,<3754,6769,6757>
+,<3755,4288,4314>
+,<3755,4314,4289>
+,<3756,6756,6769>
+,<3756,6769,6704>
+,<3756,3845,4254>
+,<3756,4254,6756>
+,<3756,6704,4933>
+,<3756,4933,3845>
+,<3757,4963,4965>
+,<3757,4965,4964>
+,<3758,4960,4965>
+,<3758,4965,4961>
+,<3759,4946,4965>
+,<3759,4965,4947>
+,<3760,4900,4965>
+,<3760,4965,4899>
+,<3769,4913,7252>
+,<3769,7252,7292>
+,<3769,7292,7253>
+,<3770,4961,4965>
+,<3770,4965,4962>
+,<3771,4953,4965>
+,<3771,4965,4954>
+,<3772,4906,4947>
+,<3772,4947,4965>
+,<3772,4965,4948>
+,<3773,7138,7158>
+,<3773,7158,7139>
+,<3773,7139,7120>
+,<3776,7279,7281>
+,<3776,7281,7292>
+,<3777,4595,7278>
+,<3777,7278,7292>
+,<3778,4927,6767>
+,<3778,6767,5764>
+,<3778,6707,7110>
+,<3778,7110,4255>
+,<3778,4926,7107>
+,<3778,7107,5752>
+,<3778,5765,7106>
+,<3778,7106,4926>
+,<3778,5651,6760>
+,<3778,6760,5765>
+,<3778,4925,4922>
+,<3778,4922,5760>
+,<3778,7102,7103>
+,<3778,7103,4925>
+,<3778,4910,4918>
+,<3778,4918,4252>
+,<3778,4912,7252>
+,<3778,7252,4913>
+,<3778,4915,4615>
+,<3778,4615,4912>
+,<3778,7249,7250>
+,<3778,7250,4915>
+,<3779,6439,6501>
+,<3779,6501,6440>
+,<3779,3845,3806>
+,<3779,3806,6439>
+,<3781,4290,4314>
+,<3781,4314,4291>
+,<3782,4286,4314>
+,<3782,4314,4287>
+,<3783,4301,4314>
+,<3783,4314,4302>
+,<3783,4302,4265>
+,<3783,4265,4266>
+,<3784,4299,4314>
+,<3784,4314,4300>
+,<3785,4296,4314>
+,<3785,4314,4297>
+,<3786,6705,5652>
+,<3786,5652,7100>
+,<3786,7100,7158>
+,<3787,6711,6769>
+,<3787,6769,6714>
+,<3787,5776,5749>
+,<3787,5749,6711>
+,<3788,5776,5710>
+,<3788,5710,4215>
+,<3789,6750,6769>
+,<3789,6769,6753>
+,<3791,4171,3792>
+,<3791,3792,6736>
+,<3791,6736,6769>
+,<3791,6769,6739>
+,<3792,4180,6735>
+,<3792,6735,6736>
+,<3793,4165,6740>
+,<3793,6740,6769>
+,<3793,6769,6743>
+,<3793,6501,6445>
+,<3793,6445,4165>
+,<3796,6769,6719>
+,<3796,6719,6718>
+,<3796,6713,3798>
+,<3796,3798,6769>
+,<3797,6769,3798>
+,<3797,3798,5703>
+,<3797,5703,4256>
+,<3797,4256,5748>
+,<3797,5748,5776>
+,<3797,5776,6715>
+,<3799,6729,6769>
+,<3799,6769,6728>
+,<3800,6734,6769>
+,<3800,6769,6733>
+,<3801,4096,6501>
+,<3801,6501,4649>
+,<3802,4708,4709>
+,<3802,4709,4645>
+,<3802,4645,6468>
+,<3805,6445,6501>
+,<3805,6501,6448>
+,<3806,6437,6501>
+,<3806,6501,6439>
+,<3813,4314,3836>
+,<3813,3836,3838>
+,<3814,4314,4280>
+,<3814,4280,4276>
+,<3814,4257,4261>
+,<3814,4261,4314>
+,<3814,4276,3845>
+,<3814,3845,4257>
+,<3815,4304,4314>
+,<3815,4314,4305>
+,<3816,3831,3845>
+,<3816,3845,3832>
+,<3817,3829,3845>
+,<3817,3845,3830>
+,<3820,5232,5233>
+,<3820,5233,5125>
+,<3820,3845,3824>
+,<3820,3824,5232>
+,<3823,5126,5233>
+,<3823,5233,5178>
+,<3824,5231,5233>
+,<3824,5233,5232>
+,<3825,5228,5233>
+,<3825,5233,5229>
+,<3826,5227,5233>
+,<3826,5233,5228>
+,<3835,4298,4314>
+,<3835,4314,4299>
+,<3836,4314,4279>
+,<3836,4279,4278>
+,<3836,4278,3845>
+,<3836,3845,3838>
+,<3837,4280,4314>
+,<3837,4314,4281>
+,<3837,3845,4276>
+,<3837,4276,4280>
+,<3837,4281,4275>
+,<3837,4275,3845>
+,<3839,4933,6704>
+,<3839,6704,6769>
+,<3845,4278,4279>
+,<3845,4279,4277>
+,<3845,6495,6497>
+,<3845,6497,6494>
+,<3845,4277,4261>
+,<3845,4261,4257>
+,<3846,5099,5041>
+,<3846,5041,5042>
+,<3847,5099,5054>
+,<3847,5054,3899>
+,<3848,7183,7225>
+,<3848,7225,7184>
+,<3849,7192,7225>
+,<3849,7225,7193>
+,<3849,3912,7162>
+,<3849,7162,7192>
+,<3850,7180,7225>
+,<3850,7225,7181>
+,<3852,7182,7225>
+,<3852,7225,7183>
+,<3854,7178,7225>
+,<3854,7225,7179>
+,<3855,3857,3912>
+,<3855,3912,3856>
+,<3867,6526,6568>
+,<3867,6568,6529>
+,<3867,6529,5078>
+,<3867,5078,5099>
+,<3868,5062,5099>
+,<3868,5099,5061>
+,<3869,5099,5048>
+,<3869,5048,3893>
+,<3869,3870,5046>
+,<3869,5046,5099>
+,<3869,3893,3912>
+,<3869,3912,3870>
+,<3870,3912,5045>
+,<3870,5045,5046>
+,<3872,3897,5099>
+,<3872,5099,3898>
+,<3873,6514,6568>
+,<3873,6568,6515>
+,<3873,6515,3906>
+,<3873,3906,3912>
+,<3874,6530,6532>
+,<3874,6532,6568>
+,<3877,3881,5099>
+,<3877,5099,5068>
+,<3879,3895,5099>
+,<3879,5099,5072>
+,<3880,3896,5099>
+,<3880,5099,3895>
+,<3882,3901,5061>
+,<3882,5061,5099>
+,<3883,6567,6568>
+,<3883,6568,6505>
+,<3884,5048,5099>
+,<3884,5099,5051>
+,<3884,3912,3893>
+,<3884,3893,5048>
+,<3884,5051,5049>
+,<3884,5049,3912>
+,<3885,5064,5099>
+,<3885,5099,5067>
+,<3886,5034,5099>
+,<3886,5099,5070>
+,<3887,6510,6568>
+,<3887,6568,6513>
+,<3887,3912,3907>
+,<3887,3907,6510>
+,<3887,6513,6511>
+,<3887,6511,3912>
+,<3888,6502,5075>
+,<3888,5075,5099>
+,<3889,5041,5099>
+,<3889,5099,5044>
+,<3889,3912,5042>
+,<3889,5042,5041>
+,<3890,7197,7225>
+,<3890,7225,7198>
+,<3891,6505,6568>
+,<3891,6568,6504>
+,<3892,5059,5099>
+,<3892,5099,5062>
+,<3894,6568,6535>
+,<3894,6535,6534>
+,<3899,5054,5052>
+,<3899,5052,3912>
+,<3902,6540,6568>
+,<3902,6568,6541>
+,<3903,6538,6568>
+,<3903,6568,6539>
+,<3903,5099,6537>
+,<3903,6537,6538>
+,<3903,6539,5076>
+,<3903,5076,5099>
+,<3904,6525,6527>
+,<3904,6527,6568>
+,<3904,6568,6526>
+,<3905,5077,6568>
+,<3905,6568,6524>
+,<3905,3912,5094>
+,<3905,5094,5077>
+,<3905,6524,6522>
+,<3905,6522,3912>
+,<3906,6515,6568>
+,<3906,6568,6518>
+,<3906,6518,6516>
+,<3906,6516,3912>
+,<3907,6509,6568>
+,<3907,6568,6510>
+,<3907,3912,5092>
+,<3907,5092,6509>
+,<3910,7177,7225>
+,<3910,7225,7178>
+,<3911,6568,6521>
+,<3911,6521,5035>
+,<3912,5040,5047>
+,<3912,5047,5045>
+,<3912,6519,6520>
+,<3912,6520,5094>
+,<3912,5035,6521>
+,<3912,6521,6519>
+,<3912,6511,6512>
+,<3912,6512,5093>
+,<3923,7258,7292>
+,<3923,7292,7261>
+,<3924,3955,3957>
+,<3924,3957,3979>
+,<3925,4629,4641>
+,<3925,4641,4632>
+,<3926,7289,7292>
+,<3926,7292,7290>
+,<3926,3979,7284>
+,<3926,7284,7289>
+,<3927,7292,7236>
+,<3927,7236,4618>
+,<3928,3939,3938>
+,<3928,3938,4641>
+,<3940,4641,4611>
+,<3940,4611,3942>
+,<3940,4607,4609>
+,<3940,4609,4641>
+,<3944,4608,4641>
+,<3944,4641,4609>
+,<3945,7239,7292>
+,<3945,7292,7240>
+,<3947,3960,3979>
+,<3947,3979,3961>
+,<3952,3975,3979>
+,<3952,3979,3976>
+,<3953,3968,3979>
+,<3953,3979,3954>
+,<3956,7174,7176>
+,<3956,7176,7225>
+,<3969,3972,3979>
+,<3969,3979,3973>
+,<3979,7283,7282>
+,<3979,7282,7284>
+,<3980,5143,6434>
+,<3980,6434,4035>
+,<3981,6420,6434>
+,<3981,6434,6421>
+,<3982,7357,7359>
+,<3982,7359,7358>
+,<3983,7359,5557>
+,<3983,5557,6403>
+,<3984,7331,7359>
+,<3984,7359,7332>
+,<3984,7332,4024>
+,<3984,4024,4046>
+,<3985,7339,7359>
+,<3985,7359,7340>
+,<3985,4046,6405>
+,<3985,6405,7339>
+,<3985,7340,4017>
+,<3985,4017,4046>
+,<3986,4344,4381>
+,<3986,4381,4345>
+,<3987,4020,4381>
+,<3987,4381,4008>
+,<3987,4046,4019>
+,<3987,4019,4020>
+,<3989,4362,4381>
+,<3989,4381,4363>
+,<3989,4046,4026>
+,<3989,4026,6414>
+,<3989,6414,6395>
+,<3989,6395,4362>
+,<3989,4363,4318>
+,<3989,4318,4046>
+,<3990,4366,4381>
+,<3990,4381,4367>
+,<3990,4046,4315>
+,<3990,4315,4366>
+,<3991,4374,4381>
+,<3991,4381,4375>
+,<3992,7308,7309>
+,<3992,7309,7307>
+,<3992,7307,5575>
+,<3992,5575,5561>
+,<3995,7312,7359>
+,<3995,7359,7313>
+,<3995,5575,7306>
+,<3995,7306,7312>
+,<3995,7313,5511>
+,<3995,5511,5575>
+,<3996,5573,5575>
+,<3996,5575,5574>
+,<3997,5531,5575>
+,<3997,5575,5532>
+,<3998,5541,5575>
+,<3998,5575,5542>
+,<3999,4376,4381>
+,<3999,4381,4377>
+,<4000,4372,4381>
+,<4000,4381,4373>
+,<4001,4368,4381>
+,<4001,4381,4369>
+,<4002,5507,5508>
+,<4002,5508,5445>
+,<4004,4342,4381>
+,<4004,4381,4343>
+,<4005,4332,4381>
+,<4005,4381,4333>
+,<4006,4328,4381>
+,<4006,4381,4329>
+,<4010,4381,4326>
+,<4010,4326,4322>
+,<4011,4323,4325>
+,<4011,4325,4381>
+,<4012,4329,4381>
+,<4012,4381,4330>
+,<4013,4336,4381>
+,<4013,4381,4337>
+,<4014,4337,4381>
+,<4014,4381,4338>
+,<4015,4343,4381>
+,<4015,4381,4344>
+,<4017,7340,7359>
+,<4017,7359,7341>
+,<4018,4379,4381>
+,<4018,4381,4380>
+,<4018,4046,4316>
+,<4018,4316,4379>
+,<4023,4356,4381>
+,<4023,4381,4357>
+,<4024,7332,7359>
+,<4024,7359,7333>
+,<4024,7333,4042>
+,<4024,4042,4046>
+,<4025,6417,6434>
+,<4025,6434,6418>
+,<4026,6413,6434>
+,<4026,6434,6414>
+,<4026,4046,6396>
+,<4026,6396,6413>
+,<4028,4035,6434>
+,<4028,6434,6383>
+,<4030,6432,6434>
+,<4030,6434,6433>
+,<4031,6428,6434>
+,<4031,6434,6429>
+,<4032,6423,6434>
+,<4032,6434,6424>
+,<4033,6416,6434>
+,<4033,6434,6417>
+,<4033,6417,6394>
+,<4033,4381,4360>
+,<4033,4360,6416>
+,<4033,6394,4317>
+,<4033,4317,4359>
+,<4033,4359,4381>
+,<4034,6407,6434>
+,<4034,6434,6408>
+,<4034,4046,6397>
+,<4034,6397,6407>
+,<4034,6408,4361>
+,<4034,4361,4046>
+,<4036,6434,6378>
+,<4036,6378,5115>
+,<4036,6374,6377>
+,<4036,6377,6434>
+,<4036,5115,5166>
+,<4036,5166,6374>
+,<4038,6410,6434>
+,<4038,6434,6411>
+,<4039,7356,7359>
+,<4039,7359,7357>
+,<4041,7337,7359>
+,<4041,7359,7338>
+,<4041,4046,7298>
+,<4041,7298,7337>
+,<4041,7338,6405>
+,<4041,6405,4046>
+,<4042,7333,7359>
+,<4042,7359,7334>
+,<4042,7334,6404>
+,<4042,6404,4046>
+,<4043,7343,7359>
+,<4043,7359,7344>
+,<4044,7328,7359>
+,<4044,7359,7329>
+,<4044,7329,7302>
+,<4044,7302,4046>
+,<4045,7325,7359>
+,<4045,7359,7326>
+,<4045,4046,5512>
+,<4045,5512,7325>
+,<4045,7326,7295>
+,<4045,7295,4046>
+,<4046,7303,7320>
+,<4046,7320,7296>
+,<4046,7293,7317>
+,<4046,7317,7304>
+,<4047,4105,4709>
+,<4047,4709,4690>
+,<4048,5191,5233>
+,<4048,5233,5192>
+,<4049,4499,4508>
+,<4049,4508,4500>
+,<4050,4503,4508>
+,<4050,4508,4504>
+,<4052,4506,4508>
+,<4052,4508,4507>
+,<4053,5248,5306>
+,<4053,5306,5249>
+,<4054,5898,4073>
+,<4054,4073,4475>
+,<4054,5862,5905>
+,<4054,5905,5898>
+,<4054,4475,4508>
+,<4054,4508,5862>
+,<4055,4459,4508>
+,<4055,4508,4458>
+,<4059,4152,4461>
+,<4059,4461,4508>
+,<4062,6359,5898>
+,<4062,5898,7049>
+,<4062,6367,5902>
+,<4062,5902,6359>
+,<4062,7049,6360>
+,<4062,6360,6367>
+,<4063,7090,7089>
+,<4063,7089,4508>
+,<4063,4508,4477>
+,<4063,4113,7087>
+,<4063,7087,7088>
+,<4063,7088,7090>
+,<4065,4652,4709>
+,<4065,4709,4653>
+,<4065,4508,4482>
+,<4065,4482,4652>
+,<4066,4148,4149>
+,<4066,4149,5381>
+,<4066,5381,5376>
+,<4066,5376,5382>
+,<4066,5306,5242>
+,<4066,5242,5239>
+,<4066,5239,4148>
+,<4068,4479,4508>
+,<4068,4508,4450>
+,<4073,5896,4508>
+,<4073,4508,4475>
+,<4074,5434,5898>
+,<4074,5898,7065>
+,<4076,7039,5898>
+,<4076,5898,7040>
+,<4076,6367,5908>
+,<4076,5908,7039>
+,<4076,7040,7034>
+,<4076,7034,6367>
+,<4077,5898,6363>
+,<4077,6363,5899>
+,<4078,7058,5898>
+,<4078,5898,6357>
+,<4079,5898,7039>
+,<4079,7039,5908>
+,<4080,7072,5898>
+,<4080,5898,7071>
+,<4080,4113,7029>
+,<4080,7029,7072>
+,<4080,7071,7030>
+,<4080,7030,4113>
+,<4081,4083,4113>
+,<4081,4113,4082>
+,<4086,4088,4113>
+,<4086,4113,4087>
+,<4093,4113,4671>
+,<4093,4671,4672>
+,<4094,4664,4709>
+,<4094,4709,4663>
+,<4094,4113,4486>
+,<4094,4486,4664>
+,<4094,4663,4491>
+,<4094,4491,4113>
+,<4095,6488,6501>
+,<4095,6501,6489>
+,<4096,6487,6489>
+,<4096,6489,6501>
+,<4097,4709,4701>
+,<4097,4701,4696>
+,<4097,4693,4692>
+,<4097,4692,4709>
+,<4098,4701,4709>
+,<4098,4709,4702>
+,<4100,6501,6486>
+,<4100,6486,6474>
+,<4100,6482,6484>
+,<4100,6484,6501>
+,<4101,4704,4709>
+,<4101,4709,4705>
+,<4102,4690,4709>
+,<4102,4709,4691>
+,<4104,4656,4709>
+,<4104,4709,4657>
+,<4106,4706,4709>
+,<4106,4709,4707>
+,<4107,4497,6501>
+,<4107,6501,6481>
+,<4109,4661,4709>
+,<4109,4709,4662>
+,<4109,4113,4492>
+,<4109,4492,4661>
+,<4109,4662,4486>
+,<4109,4486,4113>
+,<4110,4113,4679>
+,<4110,4679,4680>
+,<4111,5193,5233>
+,<4111,5233,5194>
+,<4112,4501,4508>
+,<4112,4508,4502>
+,<4113,5864,5901>
+,<4113,5901,7087>
+,<4113,7082,5900>
+,<4113,5900,7027>
+,<4113,5861,7084>
+,<4113,7084,7082>
+,<4113,7028,7083>
+,<4113,7083,5861>
+,<4113,5903,7080>
+,<4113,7080,7028>
+,<4113,7025,7081>
+,<4113,7081,5903>
+,<4113,4476,7078>
+,<4113,7078,7025>
+,<4113,5892,7079>
+,<4113,7079,4476>
+,<4113,7073,7074>
+,<4113,7074,7026>
+,<4113,6353,7075>
+,<4113,7075,7073>
+,<4113,7030,6355>
+,<4113,6355,6353>
+,<4113,4682,4683>
+,<4113,4683,4495>
+,<4113,4483,4677>
+,<4113,4677,4493>
+,<4113,4481,4673>
+,<4113,4673,4671>
+,<4113,4484,4667>
+,<4113,4667,4449>
+,<4118,4119,4120>
+,<4118,4120,4180>
+,<4121,4123,4180>
+,<4121,4180,4124>
+,<4130,4132,4180>
+,<4130,4180,4131>
+,<4133,4135,4180>
+,<4133,4180,4134>
+,<4136,4138,4180>
+,<4136,4180,4137>
+,<4141,4143,4180>
+,<4141,4180,4142>
+,<4150,4180,5440>
+,<4150,5440,5374>
+,<4168,4174,4180>
+,<4168,4180,4175>
+,<4169,4176,4180>
+,<4169,4180,4177>
+,<4172,6769,6756>
+,<4172,6756,4254>
+,<4173,6738,6769>
+,<4173,6769,6741>
+,<4180,4469,4470>
+,<4180,4470,5441>
+,<4180,5441,5440>
+,<4181,5700,5709>
+,<4181,5709,5701>
+,<4182,5707,5709>
+,<4182,5709,5708>
+,<4182,4247,4210>
+,<4182,4210,5707>
+,<4183,4190,4247>
+,<4183,4247,4191>
+,<4184,5693,5709>
+,<4184,5709,5694>
+,<4197,6671,6669>
+,<4197,6669,5709>
+,<4198,6664,6702>
+,<4198,6702,6663>
+,<4200,6668,6702>
+,<4200,6702,6667>
+,<4202,5691,5709>
+,<4202,5709,5692>
+,<4203,5687,5709>
+,<4203,5709,5686>
+,<4205,5709,5680>
+,<4205,5680,5679>
+,<4205,5645,5676>
+,<4205,5676,5709>
+,<4206,7426,7392>
+,<4206,7392,7362>
+,<4206,5673,7390>
+,<4206,7390,7426>
+,<4206,7362,5977>
+,<4206,5977,5673>
+,<4207,5695,5709>
+,<4207,5709,5696>
+,<4208,5699,5709>
+,<4208,5709,5700>
+,<4210,5706,5709>
+,<4210,5709,5707>
+,<4211,6686,6702>
+,<4211,6702,6685>
+,<4212,6691,6702>
+,<4212,6702,6694>
+,<4216,5732,5776>
+,<4216,5776,4221>
+,<4217,5729,5727>
+,<4217,5727,4247>
+,<4219,5744,5776>
+,<4219,5776,5745>
+,<4222,5731,5776>
+,<4222,5776,5730>
+,<4222,5730,4234>
+,<4222,4234,4247>
+,<4223,5776,5726>
+,<4223,5726,4227>
+,<4225,5713,5776>
+,<4225,5776,5712>
+,<4225,4247,4231>
+,<4225,4231,5713>
+,<4226,5718,5716>
+,<4226,5716,4247>
+,<4227,5726,5724>
+,<4227,5724,4247>
+,<4228,5735,5776>
+,<4228,5776,5738>
+,<4229,5741,5776>
+,<4229,5776,5744>
+,<4230,5773,5776>
+,<4230,5776,5774>
+,<4231,5775,5776>
+,<4231,5776,5713>
+,<4233,5720,5776>
+,<4233,5776,5723>
+,<4233,4247,5719>
+,<4233,5719,5720>
+,<4234,5730,5776>
+,<4234,5776,5733>
+,<4236,5747,5776>
+,<4236,5776,5748>
+,<4250,7134,7158>
+,<4250,7158,7135>
+,<4250,4314,4941>
+,<4250,4941,7134>
+,<4250,7135,7130>
+,<4250,7130,4314>
+,<4252,4918,4965>
+,<4252,4965,4919>
+,<4255,7110,7158>
+,<4255,7158,7109>
+,<4258,6769,4937>
+,<4258,4937,7132>
+,<4258,6759,6758>
+,<4258,6758,6769>
+,<4258,7132,7133>
+,<4258,7133,7131>
+,<4258,7131,4314>
+,<4258,4314,6759>
+,<4261,4277,4279>
+,<4261,4279,4314>
+,<4262,4306,4314>
+,<4262,4314,4307>
+,<4263,4308,4314>
+,<4263,4314,4309>
+,<4264,4310,4314>
+,<4264,4314,4311>
+,<4267,4297,4314>
+,<4267,4314,4298>
+,<4268,4295,4314>
+,<4268,4314,4296>
+,<4269,4293,4314>
+,<4269,4314,4294>
+,<4270,4289,4314>
+,<4270,4314,4290>
+,<4271,4287,4314>
+,<4271,4314,4288>
+,<4272,4273,4285>
+,<4272,4285,4314>
+,<4272,4314,4286>
+,<4274,4283,4314>
+,<4274,4314,4284>
+,<4275,4281,4314>
+,<4275,4314,4282>
+,<4314,7130,7136>
+,<4314,7136,7119>
+,<4314,7131,7117>
+,<4314,7117,7118>
+,<4314,6761,6758>
+,<4314,6758,6759>
+,<4314,6762,6764>
+,<4314,6764,6761>
+,<4315,4365,4381>
+,<4315,4381,4366>
+,<4316,4378,4381>
+,<4316,4381,4379>
+,<4318,4363,4381>
+,<4318,4381,4364>
+,<4319,4321,4327>
+,<4319,4327,4381>
+,<4319,4381,4328>
+,<4319,4328,4320>
+,<4345,4381,5471>
+,<4345,5471,5472>
+,<4351,5443,5508>
+,<4351,5508,5451>
+,<4353,5503,5508>
+,<4353,5508,5504>
+,<4353,5504,5471>
+,<4353,5471,4381>
+,<4354,5506,5508>
+,<4354,5508,5507>
+,<4360,6415,6434>
+,<4360,6434,6416>
+,<4360,4381,4362>
+,<4360,4362,6395>
+,<4360,6395,6415>
+,<4361,6408,6434>
+,<4361,6434,6409>
+,<4383,7423,7426>
+,<4383,7426,7424>
+,<4384,6621,6635>
+,<4384,6635,6622>
+,<4385,6631,6635>
+,<4385,6635,6632>
+,<4385,6632,4403>
+,<4385,4403,4736>
+,<4385,4736,4738>
+,<4387,6617,6635>
+,<4387,6635,6618>
+,<4387,6618,6575>
+,<4387,6575,4784>
+,<4387,4784,4783>
+,<4388,4542,4575>
+,<4388,4575,4543>
+,<4389,4421,4554>
+,<4389,4554,4575>
+,<4389,4575,4555>
+,<4390,4566,4575>
+,<4390,4575,4567>
+,<4391,4856,4392>
+,<4391,4392,4766>
+,<4391,4766,4846>
+,<4391,4846,4761>
+,<4392,4444,4430>
+,<4392,4430,4759>
+,<4392,4759,4844>
+,<4392,4844,4766>
+,<4393,4870,4869>
+,<4393,4869,4871>
+,<4393,4871,4872>
+,<4394,4866,4865>
+,<4394,4865,4867>
+,<4394,4867,4868>
+,<4395,4564,4575>
+,<4395,4575,4565>
+,<4396,4558,4575>
+,<4396,4575,4559>
+,<4397,4575,4515>
+,<4397,4515,4414>
+,<4397,4416,4514>
+,<4397,4514,4575>
+,<4397,4414,4748>
+,<4397,4748,4749>
+,<4397,4749,4416>
+,<4398,6590,6635>
+,<4398,6635,6591>
+,<4399,6623,6635>
+,<4399,6635,6624>
+,<4399,6624,4522>
+,<4399,4522,4806>
+,<4399,4806,4789>
+,<4399,4789,4807>
+,<4400,4534,4575>
+,<4400,4575,4535>
+,<4402,6635,6570>
+,<4402,6570,5938>
+,<4403,6632,6635>
+,<4403,6635,6633>
+,<4404,4555,4575>
+,<4404,4575,4556>
+,<4405,4538,4575>
+,<4405,4575,4539>
+,<4406,6613,4424>
+,<4406,4424,4813>
+,<4406,4813,4828>
+,<4406,4828,4780>
+,<4407,6597,6635>
+,<4407,6635,6598>
+,<4407,6598,6571>
+,<4408,6625,6635>
+,<4408,6635,6626>
+,<4408,4805,4806>
+,<4408,4806,4522>
+,<4408,4522,6625>
+,<4409,6594,6635>
+,<4409,6635,6595>
+,<4410,6608,6635>
+,<4410,6635,6609>
+,<4410,4575,6573>
+,<4410,6573,6608>
+,<4410,6609,4739>
+,<4410,4739,4575>
+,<4411,4575,4517>
+,<4411,4517,4412>
+,<4413,4811,4812>
+,<4413,4812,4513>
+,<4413,4513,4516>
+,<4414,4515,4513>
+,<4414,4513,4812>
+,<4414,4812,4748>
+,<4416,4749,4832>
+,<4416,4832,4776>
+,<4416,4776,4512>
+,<4416,4512,4514>
+,<4417,4537,4575>
+,<4417,4575,4538>
+,<4418,4543,4575>
+,<4418,4575,4544>
+,<4419,4545,4575>
+,<4419,4575,4546>
+,<4420,4568,4575>
+,<4420,4575,4569>
+,<4420,4569,4526>
+,<4420,4526,4769>
+,<4420,4769,4768>
+,<4422,4559,4575>
+,<4422,4575,4560>
+,<4424,6613,6635>
+,<4424,6635,6614>
+,<4424,6614,6576>
+,<4424,6576,4816>
+,<4424,4816,4813>
+,<4427,4557,4575>
+,<4427,4575,4558>
+,<4428,4560,4575>
+,<4428,4575,4561>
+,<4429,4562,4575>
+,<4429,4575,4563>
+,<4431,4862,4861>
+,<4431,4861,4863>
+,<4431,4863,4864>
+,<4435,4876,4875>
+,<4435,4875,4877>
+,<4435,4877,4878>
+,<4438,4871,4869>
+,<4438,4869,4439>
+,<4438,4439,4770>
+,<4438,4770,4837>
+,<4438,4837,4754>
+,<4439,4869,4870>
+,<4439,4870,4440>
+,<4439,4440,4868>
+,<4439,4868,4867>
+,<4441,4860,4859>
+,<4441,4859,4445>
+,<4441,4445,4861>
+,<4441,4861,4862>
+,<4442,4858,4857>
+,<4442,4857,4859>
+,<4442,4859,4860>
+,<4443,5945,5977>
+,<4443,5977,5946>
+,<4443,5946,5930>
+,<4443,5930,4724>
+,<4443,4724,4726>
+,<4447,4894,4891>
+,<4447,4891,4777>
+,<4447,4777,4829>
+,<4447,4829,4814>
+,<4447,4814,4898>
+,<4447,4898,4895>
+,<4448,4801,4800>
+,<4448,4800,4799>
+,<4448,4799,4797>
+,<4448,4797,4798>
+,<4448,4798,4810>
+,<4456,5306,5252>
+,<4456,5252,4472>
+,<4460,4462,4508>
+,<4460,4508,4461>
+,<4463,4465,4508>
+,<4463,4508,4464>
+,<4466,4468,4508>
+,<4466,4508,4467>
+,<4469,4471,4508>
+,<4469,4508,4470>
+,<4470,4508,5438>
+,<4470,5438,5439>
+,<4470,5439,5441>
+,<4476,7079,5898>
+,<4476,5898,7078>
+,<4478,6363,5898>
+,<4478,5898,5905>
+,<4478,4508,5899>
+,<4478,5899,6363>
+,<4478,5905,5862>
+,<4478,5862,4508>
+,<4483,4678,4709>
+,<4483,4709,4677>
+,<4484,4668,4709>
+,<4484,4709,4667>
+,<4485,5195,5233>
+,<4485,5233,5196>
+,<4486,4662,4709>
+,<4486,4709,4664>
+,<4487,6480,6501>
+,<4487,6501,6483>
+,<4488,4504,4508>
+,<4488,4508,4505>
+,<4489,4505,4508>
+,<4489,4508,4506>
+,<4490,6476,6501>
+,<4490,6501,6472>
+,<4491,4663,4709>
+,<4491,4709,4666>
+,<4492,4660,4709>
+,<4492,4709,4661>
+,<4496,4658,4709>
+,<4496,4709,4659>
+,<4497,6471,6479>
+,<4497,6479,6501>
+,<4508,5300,5285>
+,<4508,5285,5438>
+,<4508,6366,6362>
+,<4508,6362,7037>
+,<4508,7037,6309>
+,<4508,6309,5300>
+,<4511,4575,4514>
+,<4511,4514,4512>
+,<4513,4515,4575>
+,<4513,4575,4516>
+,<4518,6602,6635>
+,<4518,6635,6603>
+,<4518,6603,6579>
+,<4518,6579,4575>
+,<4518,4575,4533>
+,<4518,4533,4523>
+,<4519,4565,4575>
+,<4519,4575,4566>
+,<4520,4539,4575>
+,<4520,4575,4540>
+,<4521,6627,6635>
+,<4521,6635,6628>
+,<4522,6624,6635>
+,<4522,6635,6625>
+,<4524,4536,4575>
+,<4524,4575,4537>
+,<4525,4540,4575>
+,<4525,4575,4541>
+,<4526,4569,4575>
+,<4526,4575,4570>
+,<4527,4533,4575>
+,<4527,4575,4534>
+,<4528,6635,4530>
+,<4528,4530,5939>
+,<4528,5939,5941>
+,<4529,4531,4530>
+,<4529,4530,6635>
+,<4530,4531,5977>
+,<4530,5977,5945>
+,<4530,5945,5939>
+,<4532,6595,6635>
+,<4532,6635,6596>
+,<4575,6577,6607>
+,<4575,6607,6573>
+,<4575,6574,6604>
+,<4575,6604,6578>
+,<4575,6579,6603>
+,<4575,6603,6574>
+,<4578,4641,4581>
+,<4578,4581,4579>
+,<4585,7237,7292>
+,<4585,7292,7238>
+,<4586,7270,7292>
+,<4586,7292,7269>
+,<4587,4637,4641>
+,<4587,4641,4640>
+,<4588,4635,4641>
+,<4588,4641,4638>
+,<4589,4633,4641>
+,<4589,4641,4636>
+,<4590,4631,4641>
+,<4590,4641,4634>
+,<4591,4627,4641>
+,<4591,4641,4630>
+,<4592,4899,4965>
+,<4592,4965,7254>
+,<4592,7254,7255>
+,<4593,7292,7244>
+,<4593,7244,4610>
+,<4594,7266,7292>
+,<4594,7292,7265>
+,<4596,4605,4641>
+,<4596,4641,4608>
+,<4604,4606,4641>
+,<4604,4641,4605>
+,<4612,7272,7292>
+,<4612,7292,7273>
+,<4613,7268,7292>
+,<4613,7292,7267>
+,<4614,7276,7292>
+,<4614,7292,7277>
+,<4615,7292,7252>
+,<4615,7252,4912>
+,<4615,4915,7250>
+,<4615,7250,7292>
+,<4616,7292,7264>
+,<4616,7264,4911>
+,<4617,7230,7292>
+,<4617,7292,7232>
+,<4622,7267,7292>
+,<4622,7292,7270>
+,<4623,7269,7292>
+,<4623,7292,7272>
+,<4644,5194,5233>
+,<4644,5233,5195>
+,<4647,6483,6501>
+,<4647,6501,6484>
+,<4649,6501,6435>
+,<4649,6435,6477>
+,<4671,4673,4709>
+,<4671,4709,4672>
+,<4674,4676,4709>
+,<4674,4709,4675>
+,<4679,4681,4709>
+,<4679,4709,4680>
+,<4682,4684,4709>
+,<4682,4709,4683>
+,<4686,5192,5233>
+,<4686,5233,5193>
+,<4687,5198,5233>
+,<4687,5233,5199>
+,<4691,4709,4700>
+,<4691,4700,4698>
+,<4691,4698,4699>
+,<4692,4697,4700>
+,<4692,4700,4709>
+,<4694,4705,4709>
+,<4694,4709,4706>
+,<4695,4702,4709>
+,<4695,4709,4703>
+,<4710,4897,4898>
+,<4710,4898,4814>
+,<4710,4814,4827>
+,<4710,4827,4781>
+,<4710,4781,4715>
+,<4710,4715,4712>
+,<4711,5411,5279>
+,<4711,5279,5642>
+,<4714,5929,5928>
+,<4714,5928,5977>
+,<4715,4781,4825>
+,<4715,4825,4818>
+,<4715,4818,4720>
+,<4715,4720,4721>
+,<4715,4721,4719>
+,<4715,4719,4717>
+,<4718,4727,5977>
+,<4718,5977,5926>
+,<4722,4724,5930>
+,<4722,5930,5947>
+,<4722,5947,4990>
+,<4725,5977,5924>
+,<4725,5924,5923>
+,<4731,4732,4734>
+,<4731,4734,5940>
+,<4731,5940,6634>
+,<4733,5950,5977>
+,<4733,5977,5951>
+,<4735,7426,7416>
+,<4735,7416,7417>
+,<4737,7402,7426>
+,<4737,7426,7405>
+,<4739,6609,6635>
+,<4739,6635,6610>
+,<4748,4812,4811>
+,<4748,4811,4830>
+,<4748,4830,4829>
+,<4748,4829,4777>
+,<4748,4777,4831>
+,<4748,4831,4832>
+,<4748,4832,4749>
+,<4750,4833,4834>
+,<4750,4834,4774>
+,<4750,4774,4775>
+,<4750,4775,4776>
+,<4750,4776,4832>
+,<4750,4832,4831>
+,<4751,4834,4833>
+,<4751,4833,4773>
+,<4751,4773,4835>
+,<4751,4835,4836>
+,<4751,4836,4753>
+,<4751,4753,4752>
+,<4754,4837,4838>
+,<4754,4838,4771>
+,<4754,4771,4772>
+,<4754,4772,4836>
+,<4754,4836,4835>
+,<4755,4838,4837>
+,<4755,4837,4770>
+,<4755,4770,4839>
+,<4755,4839,4840>
+,<4755,4840,4756>
+,<4757,4841,4842>
+,<4757,4842,4768>
+,<4757,4768,4769>
+,<4757,4769,4840>
+,<4757,4840,4839>
+,<4758,4842,4841>
+,<4758,4841,4767>
+,<4758,4767,4843>
+,<4758,4843,4844>
+,<4758,4844,4759>
+,<4760,4845,4846>
+,<4760,4846,4766>
+,<4760,4766,4844>
+,<4760,4844,4843>
+,<4761,4846,4845>
+,<4761,4845,4765>
+,<4761,4765,4847>
+,<4761,4847,4848>
+,<4762,4763,4764>
+,<4762,4764,4848>
+,<4762,4848,4847>
+,<4778,4779,4780>
+,<4778,4780,4828>
+,<4778,4828,4827>
+,<4778,4827,4814>
+,<4778,4814,4829>
+,<4778,4829,4830>
+,<4781,4827,4828>
+,<4781,4828,4813>
+,<4781,4813,4816>
+,<4781,4816,4815>
+,<4781,4815,4826>
+,<4781,4826,4825>
+,<4782,4783,4784>
+,<4782,4784,4824>
+,<4782,4824,4823>
+,<4782,4823,4818>
+,<4782,4818,4825>
+,<4782,4825,4826>
+,<4785,4823,4824>
+,<4785,4824,4817>
+,<4785,4817,4820>
+,<4785,4820,4822>
+,<4785,4822,4821>
+,<4785,4821,4786>
+,<4786,4821,4819>
+,<4786,4819,4807>
+,<4786,4807,4789>
+,<4786,4789,4788>
+,<4786,4788,4787>
+,<4788,4789,4806>
+,<4788,4806,4805>
+,<4788,4805,4792>
+,<4788,4792,4791>
+,<4788,4791,4790>
+,<4791,4792,4808>
+,<4791,4808,4809>
+,<4791,4809,4795>
+,<4791,4795,4794>
+,<4791,4794,4793>
+,<4794,4795,4804>
+,<4794,4804,4798>
+,<4794,4798,4797>
+,<4794,4797,4796>
+,<4800,4801,4803>
+,<4800,4803,4802>
+,<4882,4992,5032>
+,<4882,5032,4993>
+,<4884,4972,5977>
+,<4884,5977,4989>
+,<4901,4950,4965>
+,<4901,4965,4951>
+,<4902,4948,4965>
+,<4902,4965,4949>
+,<4903,4957,4965>
+,<4903,4965,4958>
+,<4904,4959,4965>
+,<4904,4965,4960>
+,<4905,4951,4965>
+,<4905,4965,4952>
+,<4907,4943,4965>
+,<4907,4965,4944>
+,<4908,7144,7158>
+,<4908,7158,7145>
+,<4910,4917,4965>
+,<4910,4965,4918>
+,<4921,4965,4923>
+,<4921,4923,7100>
+,<4921,7100,5652>
+,<4922,7158,7105>
+,<4922,7105,5760>
+,<4922,4925,7103>
+,<4922,7103,7158>
+,<4923,7101,7158>
+,<4923,7158,7100>
+,<4924,7095,7158>
+,<4924,7158,7094>
+,<4924,4965,5761>
+,<4924,5761,7095>
+,<4924,7094,5763>
+,<4924,5763,4965>
+,<4926,7106,7158>
+,<4926,7158,7107>
+,<4927,7111,7158>
+,<4927,7158,6767>
+,<4928,5776,4932>
+,<4928,4932,7113>
+,<4929,7116,7158>
+,<4929,7158,4936>
+,<4929,6769,4931>
+,<4929,4931,7116>
+,<4931,6765,7158>
+,<4931,7158,7116>
+,<4934,6731,6769>
+,<4934,6769,6734>
+,<4938,7147,7158>
+,<4938,7158,7148>
+,<4938,7148,7122>
+,<4938,7122,4965>
+,<4939,7151,7158>
+,<4939,7158,7152>
+,<4939,4965,7123>
+,<4939,7123,7151>
+,<4939,7152,7124>
+,<4939,7124,4965>
+,<4940,7155,7158>
+,<4940,7158,7156>
+,<4940,4965,7125>
+,<4940,7125,7155>
+,<4942,7127,7126>
+,<4942,7126,4965>
+,<4965,5755,7097>
+,<4965,7097,6706>
+,<4965,5763,7096>
+,<4965,7096,5755>
+,<4970,5956,5977>
+,<4970,5977,5957>
+,<4970,5957,5936>
+,<4970,5936,5032>
+,<4973,4999,5032>
+,<4973,5032,5000>
+,<4973,5000,4974>
+,<4975,5831,5843>
+,<4975,5843,5832>
+,<4976,5025,5032>
+,<4976,5032,5026>
+,<4977,5027,5032>
+,<4977,5032,5028>
+,<4978,5260,5306>
+,<4978,5306,5261>
+,<4979,5584,5587>
+,<4979,5587,5642>
+,<4980,5613,5811>
+,<4980,5811,6300>
+,<4981,5413,6300>
+,<4981,6300,6294>
+,<4981,5843,6290>
+,<4981,6290,5413>
+,<4981,6294,5639>
+,<4981,5639,5843>
+,<4982,6300,6240>
+,<4982,6240,5273>
+,<4982,5275,6239>
+,<4982,6239,6300>
+,<4982,5273,5642>
+,<4982,5642,5275>
+,<4983,5004,5032>
+,<4983,5032,6260>
+,<4983,6260,6262>
+,<4983,6262,6259>
+,<4984,5002,5032>
+,<4984,5032,5003>
+,<4985,5000,5032>
+,<4985,5032,5001>
+,<4986,4994,5032>
+,<4986,5032,4995>
+,<4990,5947,5977>
+,<4990,5977,5948>
+,<5005,6277,6300>
+,<5005,6300,5576>
+,<5005,5843,6275>
+,<5005,6275,6277>
+,<5005,5576,6046>
+,<5005,6046,5843>
+,<5006,5593,5642>
+,<5006,5642,5594>
+,<5006,5594,5012>
+,<5006,5012,5032>
+,<5007,5596,5642>
+,<5007,5642,5597>
+,<5008,5841,5843>
+,<5008,5843,5842>
+,<5009,5832,5843>
+,<5009,5843,5833>
+,<5010,5610,5642>
+,<5010,5642,5810>
+,<5011,5600,5642>
+,<5011,5642,5601>
+,<5011,5601,5013>
+,<5011,5013,5032>
+,<5012,5594,5642>
+,<5012,5642,5595>
+,<5013,5601,5642>
+,<5013,5642,5602>
+,<5014,5018,5642>
+,<5014,5642,5588>
+,<5014,5588,5277>
+,<5014,5277,5032>
+,<5021,5262,5306>
+,<5021,5306,5263>
+,<5022,5376,5276>
+,<5022,5276,5416>
+,<5023,5843,5787>
+,<5023,5787,5629>
+,<5023,5633,5577>
+,<5023,5577,5843>
+,<5023,5629,5642>
+,<5023,5642,5633>
+,<5032,5937,5954>
+,<5032,5954,5931>
+,<5036,6533,6535>
+,<5036,6535,6568>
+,<5036,5098,5099>
+,<5036,5099,6533>
+,<5037,6503,6568>
+,<5037,6568,6536>
+,<5037,5099,5075>
+,<5037,5075,6503>
+,<5045,5047,5099>
+,<5045,5099,5046>
+,<5049,5051,5099>
+,<5049,5099,5050>
+,<5052,5054,5099>
+,<5052,5099,5053>
+,<5055,5057,5099>
+,<5055,5099,5056>
+,<5058,5060,5099>
+,<5058,5099,5059>
+,<5063,5065,5099>
+,<5063,5099,5064>
+,<5073,5082,5084>
+,<5073,5084,5099>
+,<5075,6502,6568>
+,<5075,6568,6503>
+,<5077,5094,6520>
+,<5077,6520,6568>
+,<5078,6529,6568>
+,<5078,6568,6528>
+,<5078,6528,5095>
+,<5078,5095,5099>
+,<5079,6565,6568>
+,<5079,6568,6566>
+,<5080,6557,6568>
+,<5080,6568,6558>
+,<5088,6550,6553>
+,<5088,6553,6568>
+,<5089,6559,6568>
+,<5089,6568,6560>
+,<5090,6563,6568>
+,<5090,6568,6564>
+,<5091,6566,6568>
+,<5091,6568,6567>
+,<5095,6528,6568>
+,<5095,6568,6531>
+,<5095,6531,5097>
+,<5095,5097,5099>
+,<5097,6531,6568>
+,<5097,6568,6532>
+,<5097,6532,6530>
+,<5097,6530,5099>
+,<5099,6534,6535>
+,<5099,6535,6533>
+,<5104,5162,5166>
+,<5104,5166,5163>
+,<5110,5128,5166>
+,<5110,5166,5129>
+,<5112,5132,5166>
+,<5112,5166,5133>
+,<5113,5134,5166>
+,<5113,5166,5135>
+,<5114,5119,5166>
+,<5114,5166,5150>
+,<5115,6378,6375>
+,<5115,6375,5140>
+,<5115,5140,5166>
+,<5116,5158,5166>
+,<5116,5166,5159>
+,<5117,5153,5166>
+,<5117,5166,5154>
+,<5118,5151,5166>
+,<5118,5166,5152>
+,<5120,5139,5166>
+,<5120,5166,5140>
+,<5121,5137,5166>
+,<5121,5166,5138>
+,<5122,5213,5233>
+,<5122,5233,5214>
+,<5123,5167,5233>
+,<5123,5233,5183>
+,<5141,6379,6434>
+,<5141,6434,6380>
+,<5142,6377,6374>
+,<5142,6374,5166>
+,<5144,6380,6434>
+,<5144,6434,6381>
+,<5167,5168,5181>
+,<5167,5181,5233>
+,<5169,5182,5189>
+,<5169,5189,5233>
+,<5170,5233,5188>
+,<5170,5188,5187>
+,<5171,5208,5233>
+,<5171,5233,5209>
+,<5173,5210,5233>
+,<5173,5233,5211>
+,<5174,5216,5233>
+,<5174,5233,5217>
+,<5175,5218,5233>
+,<5175,5233,5219>
+,<5175,5219,5176>
+,<5177,5220,5233>
+,<5177,5233,5221>
+,<5179,5222,5233>
+,<5179,5233,5223>
+,<5180,5224,5233>
+,<5180,5233,5225>
+,<5184,5188,5233>
+,<5184,5233,5189>
+,<5234,5389,5376>
+,<5234,5376,5390>
+,<5234,5306,5235>
+,<5234,5235,5389>
+,<5235,5388,5376>
+,<5235,5376,5389>
+,<5235,5306,5238>
+,<5235,5238,5388>
+,<5236,5385,5376>
+,<5236,5376,5386>
+,<5236,5306,5298>
+,<5236,5298,5385>
+,<5237,6367,5424>
+,<5237,5424,5907>
+,<5237,6308,6310>
+,<5237,6310,6367>
+,<5237,5907,5376>
+,<5237,5376,6308>
+,<5238,5387,5376>
+,<5238,5376,5388>
+,<5240,5306,5244>
+,<5240,5244,5241>
+,<5242,5306,5245>
+,<5242,5245,5243>
+,<5251,5306,5256>
+,<5251,5256,5254>
+,<5251,5254,5255>
+,<5267,5394,5376>
+,<5267,5376,5395>
+,<5267,5306,5297>
+,<5267,5297,5394>
+,<5267,5395,5304>
+,<5267,5304,5306>
+,<5268,5380,5376>
+,<5268,5376,5305>
+,<5269,5397,5398>
+,<5269,5398,5376>
+,<5269,5283,5306>
+,<5269,5306,5397>
+,<5270,6338,6367>
+,<5270,6367,6341>
+,<5271,6344,6367>
+,<5271,6367,6345>
+,<5272,5898,7050>
+,<5272,7050,7048>
+,<5272,6360,7049>
+,<5272,7049,5898>
+,<5272,7048,6367>
+,<5272,6367,6360>
+,<5273,6240,5793>
+,<5273,5793,5642>
+,<5274,5838,5843>
+,<5274,5843,5839>
+,<5275,5642,5781>
+,<5275,5781,6239>
+,<5276,5290,5855>
+,<5276,5855,5843>
+,<5276,5843,5416>
+,<5277,5588,5642>
+,<5277,5642,5589>
+,<5278,6315,6367>
+,<5278,6367,6316>
+,<5278,5376,5844>
+,<5278,5844,6315>
+,<5278,6316,5287>
+,<5278,5287,5376>
+,<5280,5292,5376>
+,<5280,5376,5408>
+,<5280,5408,5406>
+,<5280,5406,5306>
+,<5281,5910,5898>
+,<5281,5898,7059>
+,<5282,5400,5376>
+,<5282,5376,5403>
+,<5282,5306,5399>
+,<5282,5399,5400>
+,<5282,5403,5295>
+,<5282,5295,5306>
+,<5284,6318,6367>
+,<5284,6367,6319>
+,<5284,6319,5421>
+,<5284,5421,5376>
+,<5285,5376,5439>
+,<5285,5439,5438>
+,<5285,5300,6309>
+,<5285,6309,6310>
+,<5285,6310,6308>
+,<5285,6308,5376>
+,<5286,5402,5376>
+,<5286,5376,5405>
+,<5286,5306,5295>
+,<5286,5295,5402>
+,<5287,6316,6367>
+,<5287,6367,6317>
+,<5288,6343,6367>
+,<5288,6367,6342>
+,<5289,7035,7038>
+,<5289,7038,5898>
+,<5293,7064,5898>
+,<5293,5898,6356>
+,<5295,5403,5376>
+,<5295,5376,5402>
+,<5296,5305,5376>
+,<5296,5376,5379>
+,<5297,5393,5376>
+,<5297,5376,5394>
+,<5297,5306,5299>
+,<5297,5299,5393>
+,<5298,5384,5376>
+,<5298,5376,5385>
+,<5298,5306,5303>
+,<5298,5303,5384>
+,<5299,5392,5376>
+,<5299,5376,5393>
+,<5299,5306,5302>
+,<5299,5302,5392>
+,<5301,6332,6367>
+,<5301,6367,5429>
+,<5302,5391,5376>
+,<5302,5376,5392>
+,<5303,5383,5376>
+,<5303,5376,5384>
+,<5304,5395,5376>
+,<5304,5376,5396>
+,<5321,5344,5373>
+,<5321,5373,5345>
+,<5322,5346,5373>
+,<5322,5373,5347>
+,<5325,6044,5990>
+,<5325,5990,5354>
+,<5325,5367,5363>
+,<5325,5363,6044>
+,<5325,5354,5373>
+,<5325,5373,5367>
+,<5326,6020,6044>
+,<5326,6044,6021>
+,<5327,6014,6044>
+,<5327,6044,6015>
+,<5328,6025,6044>
+,<5328,6044,6026>
+,<5329,6031,6044>
+,<5329,6044,6032>
+,<5331,5991,6044>
+,<5331,6044,5992>
+,<5331,5992,5353>
+,<5331,5353,5373>
+,<5332,5997,6044>
+,<5332,6044,5998>
+,<5332,5373,5355>
+,<5332,5355,5997>
+,<5332,5998,5351>
+,<5332,5351,5373>
+,<5333,6002,6044>
+,<5333,6044,6003>
+,<5333,5373,5985>
+,<5333,5985,6002>
+,<5334,5339,5373>
+,<5334,5373,5340>
+,<5351,5998,6044>
+,<5351,6044,5999>
+,<5352,5995,6044>
+,<5352,6044,5996>
+,<5352,5996,5355>
+,<5352,5355,5373>
+,<5353,5992,6044>
+,<5353,6044,5993>
+,<5353,5993,5986>
+,<5353,5986,5373>
+,<5355,5996,6044>
+,<5355,6044,5997>
+,<5356,6034,6044>
+,<5356,6044,6035>
+,<5358,6029,6044>
+,<5358,6044,6030>
+,<5359,6027,6044>
+,<5359,6044,6028>
+,<5360,6023,6044>
+,<5360,6044,6024>
+,<5361,6018,6044>
+,<5361,6044,6019>
+,<5362,6008,6044>
+,<5362,6044,6009>
+,<5363,5987,5989>
+,<5363,5989,6044>
+,<5363,5367,5373>
+,<5363,5373,5987>
+,<5368,6012,6044>
+,<5368,6044,6013>
+,<5369,6022,6044>
+,<5369,6044,6023>
+,<5370,6026,6044>
+,<5370,6044,6027>
+,<5371,6888,6887>
+,<5371,6887,6858>
+,<5371,6858,6889>
+,<5371,6889,6890>
+,<5371,6890,6036>
+,<5372,5988,5989>
+,<5372,5989,5987>
+,<5372,5987,5373>
+,<5374,5440,5441>
+,<5374,5441,5439>
+,<5374,5439,5376>
+,<5374,5376,5375>
+,<5376,5380,5378>
+,<5376,5378,5377>
+,<5376,5400,5399>
+,<5376,5399,5401>
+,<5376,5407,5406>
+,<5376,5406,5408>
+,<5376,5853,5850>
+,<5376,5850,6330>
+,<5376,6330,5854>
+,<5376,5436,6325>
+,<5376,6325,5853>
+,<5376,6303,6326>
+,<5376,6326,5436>
+,<5376,6306,6304>
+,<5376,6304,6303>
+,<5376,5432,6324>
+,<5376,6324,6306>
+,<5376,6305,6323>
+,<5376,6323,5432>
+,<5376,5428,6322>
+,<5376,6322,6305>
+,<5376,5845,6321>
+,<5376,6321,5428>
+,<5376,5421,6320>
+,<5376,6320,5845>
+,<5376,5433,6312>
+,<5376,6312,6307>
+,<5376,5422,6311>
+,<5376,6311,5433>
+,<5376,5907,5424>
+,<5376,5424,5422>
+,<5409,5790,5843>
+,<5409,5843,5791>
+,<5409,5642,5412>
+,<5409,5412,5790>
+,<5409,5791,5617>
+,<5409,5617,5642>
+,<5412,5789,5843>
+,<5412,5843,5790>
+,<5412,5642,5581>
+,<5412,5581,5789>
+,<5413,6290,6292>
+,<5413,6292,6300>
+,<5421,6319,6367>
+,<5421,6367,6320>
+,<5422,5424,6367>
+,<5422,6367,6311>
+,<5423,7045,5898>
+,<5423,5898,7046>
+,<5423,7046,7033>
+,<5423,7033,6367>
+,<5425,6347,6367>
+,<5425,6367,6348>
+,<5426,6345,6367>
+,<5426,6367,6346>
+,<5427,6367,6333>
+,<5427,6333,6327>
+,<5427,5851,5429>
+,<5427,5429,6367>
+,<5428,6321,6367>
+,<5428,6367,6322>
+,<5430,6342,6367>
+,<5430,6367,6344>
+,<5431,6357,5898>
+,<5431,5898,7062>
+,<5432,6323,6367>
+,<5432,6367,6324>
+,<5433,6311,6367>
+,<5433,6367,6312>
+,<5434,5894,7061>
+,<5434,7061,5898>
+,<5435,6333,6367>
+,<5435,6367,6334>
+,<5436,6326,6367>
+,<5436,6367,6325>
+,<5437,6340,6367>
+,<5437,6367,6343>
+,<5446,5447,5448>
+,<5446,5448,5508>
+,<5467,5479,5481>
+,<5467,5481,5508>
+,<5469,5486,5508>
+,<5469,5508,5487>
+,<5470,5488,5508>
+,<5470,5508,5489>
+,<5471,5504,5508>
+,<5471,5508,5505>
+,<5471,5505,5472>
+,<5473,5499,5508>
+,<5473,5508,5500>
+,<5474,5497,5508>
+,<5474,5508,5498>
+,<5475,5495,5508>
+,<5475,5508,5496>
+,<5476,5493,5508>
+,<5476,5508,5494>
+,<5477,5491,5508>
+,<5477,5508,5492>
+,<5478,5489,5508>
+,<5478,5508,5490>
+,<5509,5561,5575>
+,<5509,5575,5562>
+,<5510,5563,5575>
+,<5510,5575,5564>
+,<5511,7313,7359>
+,<5511,7359,7314>
+,<5512,7324,7359>
+,<5512,7359,7325>
+,<5513,5543,5575>
+,<5513,5575,5544>
+,<5514,5545,5575>
+,<5514,5575,5546>
+,<5515,5529,5575>
+,<5515,5575,5530>
+,<5551,5575,7305>
+,<5551,7305,7316>
+,<5551,7316,5554>
+,<5552,7310,7359>
+,<5552,7359,7311>
+,<5552,7311,7306>
+,<5552,7306,5575>
+,<5553,7355,7359>
+,<5553,7359,7356>
+,<5553,7356,5555>
+,<5554,7316,7359>
+,<5554,7359,7317>
+,<5554,7317,7293>
+,<5556,7359,7309>
+,<5556,7309,7308>
+,<5560,7307,7309>
+,<5560,7309,7359>
+,<5560,7294,5575>
+,<5560,5575,7307>
+,<5576,6300,6279>
+,<5576,6279,6046>
+,<5577,5783,5786>
+,<5577,5786,5843>
+,<5577,5633,5642>
+,<5577,5642,5783>
+,<5578,5827,5843>
+,<5578,5843,5828>
+,<5580,5824,5843>
+,<5580,5843,5825>
+,<5581,5788,5843>
+,<5581,5843,5789>
+,<5581,5642,5618>
+,<5581,5618,5788>
+,<5582,6267,6300>
+,<5582,6300,6268>
+,<5583,6250,6248>
+,<5583,6248,6300>
+,<5604,5642,5609>
+,<5604,5609,5636>
+,<5604,5636,6261>
+,<5605,6274,6300>
+,<5605,6300,6059>
+,<5606,6281,6300>
+,<5606,6300,6284>
+,<5606,5843,6280>
+,<5606,6280,6281>
+,<5606,6284,5616>
+,<5606,5616,5843>
+,<5607,5638,6300>
+,<5607,6300,6296>
+,<5607,5843,6293>
+,<5607,6293,5638>
+,<5607,6296,5794>
+,<5607,5794,5843>
+,<5608,6252,5797>
+,<5608,5797,6059>
+,<5608,6059,6300>
+,<5608,6300,6276>
+,<5608,5843,5814>
+,<5608,5814,5799>
+,<5608,5799,6252>
+,<5608,6276,6256>
+,<5608,6256,5843>
+,<5609,6251,6300>
+,<5609,6300,5636>
+,<5611,6271,6300>
+,<5611,6300,6272>
+,<5614,5821,5843>
+,<5614,5843,5822>
+,<5615,5822,5843>
+,<5615,5843,5823>
+,<5616,6284,6300>
+,<5616,6300,6283>
+,<5616,6283,6254>
+,<5616,6254,5843>
+,<5617,5791,5843>
+,<5617,5843,5777>
+,<5617,5777,5635>
+,<5617,5635,5778>
+,<5617,5778,5642>
+,<5618,5787,5843>
+,<5618,5843,5788>
+,<5618,5642,5629>
+,<5618,5629,5787>
+,<5619,5842,5843>
+,<5619,5843,5631>
+,<5620,5840,5843>
+,<5620,5843,5841>
+,<5621,5837,5843>
+,<5621,5843,5838>
+,<5622,5833,5843>
+,<5622,5843,5834>
+,<5623,5829,5843>
+,<5623,5843,5830>
+,<5624,5825,5843>
+,<5624,5843,5826>
+,<5625,5820,5843>
+,<5625,5843,5821>
+,<5627,6191,6189>
+,<5627,6189,6187>
+,<5627,6187,6185>
+,<5627,6185,6183>
+,<5627,6183,6181>
+,<5627,6181,6179>
+,<5627,6179,6177>
+,<5627,6177,6122>
+,<5627,6122,6158>
+,<5627,6158,6107>
+,<5627,6107,6211>
+,<5627,6211,6208>
+,<5627,6208,6206>
+,<5627,6206,6204>
+,<5627,6204,6202>
+,<5627,6202,6200>
+,<5627,6200,6198>
+,<5627,6198,6196>
+,<5627,6196,6194>
+,<5627,6194,6192>
+,<5628,6246,6300>
+,<5628,6300,5637>
+,<5628,5642,5779>
+,<5628,5779,6246>
+,<5628,5637,6234>
+,<5628,6234,5642>
+,<5630,5843,5786>
+,<5630,5786,5784>
+,<5630,5784,5785>
+,<5634,6241,6300>
+,<5634,6300,6244>
+,<5634,5642,5793>
+,<5634,5793,6241>
+,<5634,6244,6242>
+,<5634,6242,5642>
+,<5635,6297,6300>
+,<5635,6300,6298>
+,<5635,6298,5778>
+,<5635,5777,5843>
+,<5635,5843,5794>
+,<5635,5794,6297>
+,<5636,6300,6262>
+,<5636,6262,6260>
+,<5636,6260,6261>
+,<5637,6300,6247>
+,<5637,6247,6234>
+,<5638,6293,6295>
+,<5638,6295,6300>
+,<5639,6294,6300>
+,<5639,6300,6295>
+,<5639,6295,6293>
+,<5639,6293,5843>
+,<5642,5792,6248>
+,<5642,6248,6250>
+,<5642,6245,6249>
+,<5642,6249,5792>
+,<5642,6234,6247>
+,<5642,6247,6245>
+,<5642,6242,6243>
+,<5642,6243,5779>
+,<5642,5780,6238>
+,<5642,6238,5781>
+,<5642,5782,6236>
+,<5642,6236,5780>
+,<5642,5784,5786>
+,<5642,5786,5783>
+,<5643,6646,6702>
+,<5643,6702,6647>
+,<5644,6644,6702>
+,<5644,6702,6645>
+,<5647,5684,5709>
+,<5647,5709,5687>
+,<5648,5682,5709>
+,<5648,5709,5685>
+,<5649,5688,5709>
+,<5649,5709,5691>
+,<5650,5701,5709>
+,<5650,5709,5702>
+,<5651,7092,7158>
+,<5651,7158,6760>
+,<5653,5698,5709>
+,<5653,5709,5699>
+,<5654,5696,5709>
+,<5654,5709,5697>
+,<5655,5694,5709>
+,<5655,5709,5695>
+,<5658,7388,7426>
+,<5658,7426,7391>
+,<5658,5977,7365>
+,<5658,7365,7388>
+,<5658,7391,7389>
+,<5658,7389,5977>
+,<5659,5963,7426>
+,<5659,7426,7387>
+,<5659,5977,7364>
+,<5659,7364,5963>
+,<5659,7387,7386>
+,<5659,7386,5977>
+,<5662,6687,6702>
+,<5662,6702,6690>
+,<5663,6693,6702>
+,<5663,6702,6696>
+,<5668,5669,5670>
+,<5668,5670,5709>
+,<5671,7426,7388>
+,<5671,7388,7365>
+,<5673,5977,7389>
+,<5673,7389,7390>
+,<5674,7379,7426>
+,<5674,7426,7380>
+,<5674,5977,7366>
+,<5674,7366,7379>
+,<5675,5677,5709>
+,<5675,5709,5676>
+,<5681,5683,5709>
+,<5681,5709,5682>
+,<5704,6769,6712>
+,<5704,6712,5753>
+,<5704,5750,6710>
+,<5704,6710,6769>
+,<5704,5753,5776>
+,<5704,5776,5750>
+,<5716,5718,5776>
+,<5716,5776,5717>
+,<5719,5721,5776>
+,<5719,5776,5720>
+,<5724,5726,5776>
+,<5724,5776,5725>
+,<5727,5729,5776>
+,<5727,5776,5728>
+,<5734,5736,5776>
+,<5734,5776,5735>
+,<5743,5745,5776>
+,<5743,5776,5746>
+,<5749,6712,6769>
+,<5749,6769,6711>
+,<5749,5776,5753>
+,<5749,5753,6712>
+,<5750,5776,6708>
+,<5750,6708,6710>
+,<5752,7107,7158>
+,<5752,7158,6766>
+,<5754,6748,6769>
+,<5754,6769,6751>
+,<5755,7096,7158>
+,<5755,7158,7097>
+,<5757,5768,5776>
+,<5757,5776,5769>
+,<5758,5770,5776>
+,<5758,5776,5771>
+,<5759,5772,5776>
+,<5759,5776,5773>
+,<5761,7157,7158>
+,<5761,7158,7095>
+,<5762,7139,7158>
+,<5762,7158,7140>
+,<5763,7094,7158>
+,<5763,7158,7096>
+,<5765,6760,7158>
+,<5765,7158,7106>
+,<5766,6769,6710>
+,<5766,6710,6708>
+,<5766,6708,6709>
+,<5766,6709,7115>
+,<5779,6243,6300>
+,<5779,6300,6246>
+,<5780,6236,6300>
+,<5780,6300,6238>
+,<5781,6238,6300>
+,<5781,6300,6239>
+,<5782,6237,6300>
+,<5782,6300,6236>
+,<5792,6249,6300>
+,<5792,6300,6248>
+,<5793,6240,6300>
+,<5793,6300,6241>
+,<5794,6296,6300>
+,<5794,6300,6297>
+,<5795,6291,6300>
+,<5795,6300,6292>
+,<5795,5843,6253>
+,<5795,6253,6291>
+,<5795,6292,6290>
+,<5795,6290,5843>
+,<5796,6254,6283>
+,<5796,6283,6300>
+,<5798,6258,6259>
+,<5798,6259,6262>
+,<5798,6262,6300>
+,<5800,5828,5843>
+,<5800,5843,5829>
+,<5801,5830,5843>
+,<5801,5843,5831>
+,<5802,5834,5843>
+,<5802,5843,5835>
+,<5803,5836,5843>
+,<5803,5843,5837>
+,<5804,5839,5843>
+,<5804,5843,5840>
+,<5805,5819,5843>
+,<5805,5843,5820>
+,<5808,6270,6300>
+,<5808,6300,6271>
+,<5809,6300,6263>
+,<5809,6263,6257>
+,<5817,6116,6160>
+,<5817,6160,6122>
+,<5817,6122,6177>
+,<5817,6177,6174>
+,<5817,6174,6172>
+,<5817,6172,6170>
+,<5817,6170,6168>
+,<5843,6255,6282>
+,<5843,6282,6280>
+,<5843,6046,6279>
+,<5843,6279,6255>
+,<5843,6256,6278>
+,<5843,6278,6275>
+,<5844,6314,6367>
+,<5844,6367,6315>
+,<5845,6320,6367>
+,<5845,6367,6321>
+,<5846,6341,6367>
+,<5846,6367,6340>
+,<5847,5852,6367>
+,<5847,6367,6332>
+,<5848,7055,5898>
+,<5848,5898,5910>
+,<5849,7043,5898>
+,<5849,5898,7044>
+,<5849,6367,6361>
+,<5849,6361,7043>
+,<5850,6367,6331>
+,<5850,6331,6329>
+,<5850,6329,6330>
+,<5850,5853,6325>
+,<5850,6325,6367>
+,<5852,6328,6331>
+,<5852,6331,6367>
+,<5860,6351,6367>
+,<5860,6367,6352>
+,<5861,7083,5898>
+,<5861,5898,7084>
+,<5863,6358,5898>
+,<5863,5898,7056>
+,<5864,7085,5898>
+,<5864,5898,5901>
+,<5892,7076,5898>
+,<5892,5898,7079>
+,<5897,6367,7051>
+,<5897,7051,7052>
+,<5898,6362,6366>
+,<5898,6366,5906>
+,<5898,7038,7036>
+,<5898,7036,7037>
+,<5898,7037,6362>
+,<5898,7041,7034>
+,<5898,7034,7040>
+,<5898,7042,6354>
+,<5898,6354,7041>
+,<5898,7043,6361>
+,<5898,6361,7042>
+,<5898,7047,7033>
+,<5898,7033,7046>
+,<5898,6359,5902>
+,<5898,5902,7047>
+,<5898,7053,5904>
+,<5898,5904,7050>
+,<5898,7052,7051>
+,<5898,7051,7053>
+,<5898,7055,7054>
+,<5898,7054,7056>
+,<5898,7058,7057>
+,<5898,7057,7059>
+,<5898,7061,7060>
+,<5898,7060,7062>
+,<5898,7064,7063>
+,<5898,7063,7065>
+,<5898,7068,7031>
+,<5898,7031,7032>
+,<5898,7032,6356>
+,<5898,7067,7066>
+,<5898,7066,7068>
+,<5898,7072,7029>
+,<5898,7029,7069>
+,<5898,6355,7030>
+,<5898,7030,7071>
+,<5898,7075,6353>
+,<5898,6353,6355>
+,<5898,7074,7073>
+,<5898,7073,7075>
+,<5898,7077,7026>
+,<5898,7026,7074>
+,<5898,7081,7025>
+,<5898,7025,7078>
+,<5898,7080,5903>
+,<5898,5903,7081>
+,<5898,7083,7028>
+,<5898,7028,7080>
+,<5898,5900,7082>
+,<5898,7082,7084>
+,<5898,7086,7027>
+,<5898,7027,5900>
+,<5898,7088,7087>
+,<5898,7087,5901>
+,<5898,7091,7089>
+,<5898,7089,7090>
+,<5898,7090,7088>
+,<5902,6367,7033>
+,<5902,7033,7047>
+,<5904,6367,7048>
+,<5904,7048,7050>
+,<5904,7053,7051>
+,<5904,7051,6367>
+,<5911,5977,5920>
+,<5911,5920,5919>
+,<5914,7377,7426>
+,<5914,7426,7378>
+,<5915,5918,5977>
+,<5915,5977,5917>
+,<5930,5946,5977>
+,<5930,5977,5947>
+,<5931,5954,5977>
+,<5931,5977,5955>
+,<5932,7412,7426>
+,<5932,7426,7411>
+,<5934,7383,7426>
+,<5934,7426,7384>
+,<5934,5977,5964>
+,<5934,5964,7383>
+,<5934,7384,7364>
+,<5934,7364,5977>
+,<5935,5936,5957>
+,<5935,5957,5977>
+,<5935,5977,5958>
+,<5940,6633,6635>
+,<5940,6635,6634>
+,<5944,6589,6635>
+,<5944,6635,6590>
+,<5959,7404,7426>
+,<5959,7426,7407>
+,<5960,7411,7426>
+,<5960,7426,7414>
+,<5961,7422,7426>
+,<5961,7426,7423>
+,<5962,5972,7426>
+,<5962,7426,7412>
+,<5963,7364,7384>
+,<5963,7384,7426>
+,<5964,7382,7426>
+,<5964,7426,7383>
+,<5965,7378,7426>
+,<5965,7426,7379>
+,<5965,7379,7366>
+,<5967,7424,7426>
+,<5967,7426,7425>
+,<5968,7420,7426>
+,<5968,7426,7422>
+,<5969,7419,7426>
+,<5969,7426,7418>
+,<5971,7414,7426>
+,<5971,7426,7415>
+,<5972,7408,7410>
+,<5972,7410,7426>
+,<5973,7407,7426>
+,<5973,7426,7406>
+,<5974,7360,7399>
+,<5974,7399,7426>
+,<5976,7370,7372>
+,<5976,7372,7426>
+,<5977,7363,7398>
+,<5977,7398,7396>
+,<5978,6017,6044>
+,<5978,6044,6018>
+,<5979,6019,6044>
+,<5979,6044,6020>
+,<5980,6013,6044>
+,<5980,6044,6014>
+,<5981,6015,6044>
+,<5981,6044,6016>
+,<5982,6009,6044>
+,<5982,6044,6010>
+,<5983,6011,6044>
+,<5983,6044,6012>
+,<5984,6007,6044>
+,<5984,6044,6008>
+,<5985,6001,6044>
+,<5985,6044,6002>
+,<5986,5993,6044>
+,<5986,6044,5994>
+,<6036,6890,6855>
+,<6036,6855,6895>
+,<6036,6895,6957>
+,<6036,6957,6856>
+,<6037,6868,6867>
+,<6037,6867,6864>
+,<6037,6864,6869>
+,<6037,6869,6870>
+,<6037,6044,6866>
+,<6037,6866,6868>
+,<6037,6870,6861>
+,<6037,6861,6044>
+,<6038,6848,6039>
+,<6038,6039,6845>
+,<6038,6845,6941>
+,<6038,6941,6973>
+,<6038,6973,6906>
+,<6038,6906,6847>
+,<6042,6851,6849>
+,<6042,6849,6847>
+,<6042,6847,6906>
+,<6042,6906,6971>
+,<6042,6971,6945>
+,<6043,6863,6865>
+,<6043,6865,6866>
+,<6043,6866,6044>
+,<6045,6064,6063>
+,<6045,6063,6065>
+,<6045,6065,6066>
+,<6047,6080,6079>
+,<6047,6079,6081>
+,<6047,6081,6082>
+,<6047,6082,6053>
+,<6047,6053,6151>
+,<6047,6151,6150>
+,<6048,6076,6075>
+,<6048,6075,6077>
+,<6048,6077,6078>
+,<6048,6093,6094>
+,<6048,6094,6056>
+,<6048,6056,6076>
+,<6049,6084,6083>
+,<6049,6083,6085>
+,<6049,6085,6086>
+,<6049,6051,6151>
+,<6049,6151,6053>
+,<6049,6053,6084>
+,<6049,6086,6054>
+,<6049,6054,6091>
+,<6049,6091,6153>
+,<6049,6153,6051>
+,<6050,6083,6084>
+,<6050,6084,6053>
+,<6050,6053,6082>
+,<6050,6082,6081>
+,<6050,6081,6079>
+,<6050,6079,6077>
+,<6050,6077,6075>
+,<6050,6075,6073>
+,<6050,6073,6071>
+,<6050,6071,6069>
+,<6050,6069,6058>
+,<6050,6058,6148>
+,<6050,6148,6154>
+,<6050,6154,6092>
+,<6051,6153,6152>
+,<6051,6152,6092>
+,<6051,6092,6154>
+,<6051,6154,6155>
+,<6051,6155,6149>
+,<6051,6149,6150>
+,<6051,6150,6151>
+,<6052,6087,6088>
+,<6052,6088,6054>
+,<6052,6054,6086>
+,<6052,6086,6085>
+,<6054,6088,6090>
+,<6054,6090,6091>
+,<6055,6070,6069>
+,<6055,6069,6071>
+,<6055,6071,6072>
+,<6056,6074,6073>
+,<6056,6073,6075>
+,<6056,6075,6076>
+,<6057,6060,6066>
+,<6057,6066,6065>
+,<6057,6065,6067>
+,<6057,6067,6068>
+,<6061,6265,6300>
+,<6061,6300,6266>
+,<6087,6089,6090>
+,<6087,6090,6088>
+,<6093,6155,6154>
+,<6093,6154,6148>
+,<6093,6148,6156>
+,<6093,6156,6157>
+,<6093,6157,6106>
+,<6093,6106,6105>
+,<6093,6105,6104>
+,<6093,6104,6103>
+,<6093,6103,6102>
+,<6093,6102,6101>
+,<6093,6101,6100>
+,<6093,6100,6099>
+,<6093,6099,6098>
+,<6093,6098,6097>
+,<6093,6097,6096>
+,<6093,6096,6095>
+,<6093,6095,6094>
+,<6107,6158,6159>
+,<6107,6159,6123>
+,<6107,6123,6124>
+,<6107,6124,6125>
+,<6107,6125,6126>
+,<6107,6126,6127>
+,<6107,6127,6128>
+,<6107,6128,6129>
+,<6107,6129,6130>
+,<6107,6130,6131>
+,<6107,6131,6132>
+,<6107,6132,6133>
+,<6107,6133,6134>
+,<6107,6134,6135>
+,<6107,6135,6136>
+,<6107,6136,6137>
+,<6107,6137,6138>
+,<6107,6138,6139>
+,<6107,6139,6140>
+,<6107,6140,6141>
+,<6107,6141,6142>
+,<6107,6142,6143>
+,<6107,6143,6144>
+,<6107,6144,6145>
+,<6107,6145,6146>
+,<6107,6146,6147>
+,<6107,6147,6157>
+,<6107,6157,6156>
+,<6108,6159,6158>
+,<6108,6158,6122>
+,<6108,6122,6160>
+,<6108,6160,6161>
+,<6108,6161,6115>
+,<6108,6115,6114>
+,<6108,6114,6113>
+,<6108,6113,6112>
+,<6108,6112,6111>
+,<6108,6111,6110>
+,<6108,6110,6109>
+,<6116,6162,6163>
+,<6116,6163,6119>
+,<6116,6119,6120>
+,<6116,6120,6121>
+,<6116,6121,6161>
+,<6116,6161,6160>
+,<6117,6163,6162>
+,<6117,6162,6118>
+,<6117,6118,6164>
+,<6117,6164,6165>
+,<6131,6773,6774>
+,<6131,6774,6775>
+,<6131,6775,6132>
+,<6235,6263,6300>
+,<6235,6300,6264>
+,<6242,6244,6300>
+,<6242,6300,6243>
+,<6245,6247,6300>
+,<6245,6300,6249>
+,<6253,6288,6300>
+,<6253,6300,6291>
+,<6255,6279,6300>
+,<6255,6300,6282>
+,<6256,6276,6300>
+,<6256,6300,6278>
+,<6275,6278,6300>
+,<6275,6300,6277>
+,<6280,6282,6300>
+,<6280,6300,6281>
+,<6285,6287,6300>
+,<6285,6300,6286>
+,<6301,6334,6367>
+,<6301,6367,6335>
+,<6302,6336,6367>
+,<6302,6367,6339>
+,<6303,6304,6367>
+,<6303,6367,6326>
+,<6304,6306,6324>
+,<6304,6324,6367>
+,<6305,6322,6367>
+,<6305,6367,6323>
+,<6307,6312,6367>
+,<6307,6367,6313>
+,<6309,7037,7036>
+,<6309,7036,6367>
+,<6309,6367,6310>
+,<6337,6339,6367>
+,<6337,6367,6338>
+,<6354,6367,7034>
+,<6354,7034,7041>
+,<6354,7042,6361>
+,<6354,6361,6367>
+,<6367,7036,7038>
+,<6367,7038,7035>
+,<6387,6419,6434>
+,<6387,6434,6420>
+,<6388,6427,6434>
+,<6388,6434,6428>
+,<6389,6429,6434>
+,<6389,6434,6430>
+,<6390,6431,6434>
+,<6390,6434,6432>
+,<6391,6426,6434>
+,<6391,6434,6427>
+,<6392,6424,6434>
+,<6392,6434,6425>
+,<6393,6422,6434>
+,<6393,6434,6423>
+,<6395,6414,6434>
+,<6395,6434,6415>
+,<6396,6412,6434>
+,<6396,6434,6413>
+,<6397,6406,6434>
+,<6397,6434,6407>
+,<6404,7334,7359>
+,<6404,7359,7335>
+,<6405,7338,7359>
+,<6405,7359,7339>
+,<6436,6501,6490>
+,<6436,6490,6469>
+,<6442,6747,6769>
+,<6442,6769,6746>
+,<6444,6752,6769>
+,<6444,6769,6755>
+,<6446,6448,6501>
+,<6446,6501,6447>
+,<6450,6452,6501>
+,<6450,6501,6451>
+,<6454,6456,6501>
+,<6454,6501,6455>
+,<6457,6459,6501>
+,<6457,6501,6458>
+,<6470,6478,6501>
+,<6470,6501,6479>
+,<6472,6501,6478>
+,<6472,6478,6473>
+,<6475,6485,6501>
+,<6475,6501,6488>
+,<6491,6501,6497>
+,<6491,6497,6495>
+,<6491,6495,6496>
+,<6493,6498,6501>
+,<6493,6501,6499>
+,<6506,6507,6508>
+,<6506,6508,6568>
+,<6511,6513,6568>
+,<6511,6568,6512>
+,<6516,6518,6568>
+,<6516,6568,6517>
+,<6519,6521,6568>
+,<6519,6568,6520>
+,<6522,6524,6568>
+,<6522,6568,6523>
+,<6544,6556,6568>
+,<6544,6568,6557>
+,<6545,6558,6568>
+,<6545,6568,6559>
+,<6546,6560,6568>
+,<6546,6568,6561>
+,<6547,6564,6568>
+,<6547,6568,6565>
+,<6569,6586,6588>
+,<6569,6588,6635>
+,<6573,6607,6635>
+,<6573,6635,6608>
+,<6574,6603,6635>
+,<6574,6635,6604>
+,<6575,6618,6635>
+,<6575,6635,6619>
+,<6576,6614,6635>
+,<6576,6635,6615>
+,<6577,6606,6635>
+,<6577,6635,6607>
+,<6578,6604,6635>
+,<6578,6635,6605>
+,<6580,6600,6635>
+,<6580,6635,6601>
+,<6581,6598,6635>
+,<6581,6635,6599>
+,<6582,6596,6635>
+,<6582,6635,6597>
+,<6637,6702,6701>
+,<6637,6701,6700>
+,<6658,6660,6702>
+,<6658,6702,6659>
+,<6669,6671,6702>
+,<6669,6702,6670>
+,<6672,6674,6702>
+,<6672,6702,6673>
+,<6677,6679,6702>
+,<6677,6702,6678>
+,<6706,7097,7158>
+,<6706,7158,7099>
+,<6707,7108,7158>
+,<6707,7158,7110>
+,<6722,6724,6769>
+,<6722,6769,6723>
+,<6725,6727,6769>
+,<6725,6769,6726>
+,<6730,6732,6769>
+,<6730,6769,6731>
+,<6735,6737,6769>
+,<6735,6769,6736>
+,<6757,6769,6764>
+,<6757,6764,6762>
+,<6757,6762,6763>
+,<6758,6761,6764>
+,<6758,6764,6769>
+,<6768,7142,7158>
+,<6768,7158,7143>
+,<6770,6777,6836>
+,<6770,6836,6778>
+,<6770,6778,6771>
+,<6799,6801,6836>
+,<6799,6836,6800>
+,<6813,6815,6836>
+,<6813,6836,6814>
+,<6816,6818,6836>
+,<6816,6836,6817>
+,<6838,6938,6977>
+,<6838,6977,6910>
+,<6838,6910,6841>
+,<6838,6841,6842>
+,<6838,6842,6840>
+,<6853,6955,6958>
+,<6853,6958,6896>
+,<6853,6896,6858>
+,<6853,6858,6887>
+,<6854,6884,6883>
+,<6854,6883,6885>
+,<6854,6885,6886>
+,<6855,6892,6894>
+,<6855,6894,6895>
+,<6856,6957,6956>
+,<6856,6956,6896>
+,<6856,6896,6958>
+,<6856,6958,6959>
+,<6859,6878,6877>
+,<6859,6877,6879>
+,<6859,6879,6880>
+,<6861,6870,6869>
+,<6861,6869,6871>
+,<6861,6871,6872>
+,<6862,6874,6873>
+,<6862,6873,6875>
+,<6862,6875,6876>
+,<6891,6893,6894>
+,<6891,6894,6892>
+,<6897,6959,6958>
+,<6897,6958,6955>
+,<6897,6955,6960>
+,<6897,6960,6961>
+,<6898,6962,6963>
+,<6898,6963,6953>
+,<6898,6953,6954>
+,<6898,6954,6961>
+,<6898,6961,6960>
+,<6899,6963,6962>
+,<6899,6962,6952>
+,<6899,6952,6964>
+,<6899,6964,6951>
+,<6900,6965,6966>
+,<6900,6966,6950>
+,<6900,6950,6951>
+,<6900,6951,6964>
+,<6901,6966,6965>
+,<6901,6965,6949>
+,<6901,6949,6967>
+,<6901,6967,6968>
+,<6901,6968,6902>
+,<6903,6969,6970>
+,<6903,6970,6946>
+,<6903,6946,6947>
+,<6903,6947,6948>
+,<6903,6948,6968>
+,<6903,6968,6967>
+,<6904,6970,6969>
+,<6904,6969,6945>
+,<6904,6945,6971>
+,<6904,6971,6972>
+,<6904,6972,6905>
+,<6906,6973,6974>
+,<6906,6974,6942>
+,<6906,6942,6943>
+,<6906,6943,6944>
+,<6906,6944,6972>
+,<6906,6972,6971>
+,<6907,6974,6973>
+,<6907,6973,6941>
+,<6907,6941,6975>
+,<6907,6975,6976>
+,<6907,6976,6909>
+,<6907,6909,6908>
+,<6910,6977,6978>
+,<6910,6978,6939>
+,<6910,6939,6940>
+,<6910,6940,6976>
+,<6910,6976,6975>
+,<6911,6978,6977>
+,<6911,6977,6938>
+,<6911,6938,6979>
+,<6911,6979,6980>
+,<6911,6980,6913>
+,<6911,6913,6912>
+,<6914,6981,6982>
+,<6914,6982,6936>
+,<6914,6936,6937>
+,<6914,6937,6980>
+,<6914,6980,6979>
+,<6915,6982,6981>
+,<6915,6981,6935>
+,<6915,6935,6983>
+,<6915,6983,6984>
+,<6915,6984,6917>
+,<6915,6917,6916>
+,<6918,6985,6986>
+,<6918,6986,6933>
+,<6918,6933,6934>
+,<6918,6934,6984>
+,<6918,6984,6983>
+,<6919,6986,6985>
+,<6919,6985,6932>
+,<6919,6932,6987>
+,<6919,6987,6988>
+,<6920,6989,6990>
+,<6920,6990,6930>
+,<6920,6930,6931>
+,<6920,6931,6988>
+,<6920,6988,6987>
+,<6921,6990,6989>
+,<6921,6989,6929>
+,<6921,6929,6991>
+,<6921,6991,6992>
+,<6921,6992,6922>
+,<6923,6993,6994>
+,<6923,6994,6928>
+,<6923,6928,6992>
+,<6923,6992,6991>
+,<6924,6994,6993>
+,<6924,6993,6927>
+,<6924,6927,6995>
+,<6924,6995,6996>
+,<6925,6926,6996>
+,<6925,6996,6995>
+,<6925,6997,6998>
+,<6925,6998,6926>
+,<6997,6999,7000>
+,<6997,7000,6998>
+,<7102,7104,7158>
+,<7102,7158,7103>
+,<7117,7131,7133>
+,<7117,7133,7158>
+,<7119,7136,7158>
+,<7119,7158,7137>
+,<7121,7140,7158>
+,<7121,7158,7141>
+,<7122,7148,7158>
+,<7122,7158,7149>
+,<7123,7150,7158>
+,<7123,7158,7151>
+,<7124,7152,7158>
+,<7124,7158,7153>
+,<7125,7154,7158>
+,<7125,7158,7155>
+,<7126,7127,7145>
+,<7126,7145,7158>
+,<7126,7158,7146>
+,<7128,7143,7158>
+,<7128,7158,7144>
+,<7129,7141,7158>
+,<7129,7158,7142>
+,<7130,7135,7158>
+,<7130,7158,7136>
+,<7159,7189,7225>
+,<7159,7225,7190>
+,<7160,7292,7288>
+,<7160,7288,7287>
+,<7160,7226,7186>
+,<7160,7186,7292>
+,<7162,7191,7225>
+,<7162,7225,7192>
+,<7163,7207,7225>
+,<7163,7225,7208>
+,<7164,7205,7225>
+,<7164,7225,7206>
+,<7165,7211,7225>
+,<7165,7225,7212>
+,<7166,7215,7225>
+,<7166,7225,7216>
+,<7167,7222,7225>
+,<7167,7225,7223>
+,<7168,7218,7225>
+,<7168,7225,7219>
+,<7169,7214,7225>
+,<7169,7225,7215>
+,<7170,7212,7225>
+,<7170,7225,7213>
+,<7171,7204,7225>
+,<7171,7225,7205>
+,<7172,7200,7225>
+,<7172,7225,7201>
+,<7173,7196,7225>
+,<7173,7225,7197>
+,<7185,7225,7286>
+,<7185,7286,7285>
+,<7233,7235,7292>
+,<7233,7292,7234>
+,<7241,7243,7292>
+,<7241,7292,7242>
+,<7249,7251,7292>
+,<7249,7292,7250>
+,<7254,7256,7292>
+,<7254,7292,7255>
+,<7259,7261,7292>
+,<7259,7292,7260>
+,<7262,7264,7292>
+,<7262,7292,7263>
+,<7271,7273,7292>
+,<7271,7292,7274>
+,<7275,7277,7292>
+,<7275,7292,7278>
+,<7282,7292,7289>
+,<7282,7289,7284>
+,<7295,7326,7359>
+,<7295,7359,7327>
+,<7296,7320,7359>
+,<7296,7359,7321>
+,<7297,7351,7359>
+,<7297,7359,7352>
+,<7298,7336,7359>
+,<7298,7359,7337>
+,<7300,7347,7359>
+,<7300,7359,7348>
+,<7301,7345,7359>
+,<7301,7359,7346>
+,<7302,7329,7359>
+,<7302,7359,7330>
+,<7303,7319,7359>
+,<7303,7359,7320>
+,<7304,7317,7359>
+,<7304,7359,7318>
+,<7305,7315,7359>
+,<7305,7359,7316>
+,<7306,7311,7359>
+,<7306,7359,7312>
+,<7367,7376,7426>
+,<7367,7426,7377>
+,<7368,7374,7426>
+,<7368,7426,7375>
+,<7385,7386,7387>
+,<7385,7387,7426>
+,<7389,7391,7426>
+,<7389,7426,7390>
+,<7393,7395,7426>
+,<7393,7426,7394>
+,<7396,7398,7426>
+,<7396,7426,7397>
+,<7401,7403,7426>
+,<7401,7426,7402>
+}
+inside_vector <0,0,1>
+}
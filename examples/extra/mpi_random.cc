@@ -0,0 +1,77 @@
+// Distributed Voronoi calculation example code
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+#include "voro++.hh"
+#include "domain_mpi.hh"
+using namespace voro;
+
+// Set up constants for the container geometry
+const double x_min=-1,x_max=1;
+const double y_min=-1,y_max=1;
+const double z_min=-1,z_max=1;
+const double cvol=(x_max-x_min)*(y_max-y_min)*(z_max-z_min);
+
+// Set the number of particles that are going to be randomly introduced
+const int particles=100000;
+
+// This function returns a random double between 0 and 1
+double rnd() {return double(rand())/RAND_MAX;}
+
+// A class that is passed each owned Voronoi cell, which saves the volume and
+// neighbors to a file and sums up the volumes
+struct cell_output {
+	FILE *fp;
+	double vol;
+	std::vector<voro_id> neigh;
+	void operator()(voronoicell_neighbor &c,voro_id n,double x,double y,double z) {
+		double v=c.volume();
+		vol+=v;
+		c.neighbors(neigh);
+		fprintf(fp,"%ld %g %g %g %g",long(n),x,y,z,v);
+		for(unsigned int i=0;i<neigh.size();i++) fprintf(fp," %ld",long(neigh[i]));
+		fputs("\n",fp);
+	}
+};
+
+int main(int argc,char **argv) {
+	int i,rank;
+	double x,y,z;
+	char buf[64];
+	MPI_Init(&argc,&argv);
+	MPI_Comm_rank(MPI_COMM_WORLD,&rank);
+
+	// Set up the decomposition, with one sub-box per process
+	domain_mpi dm(x_min,x_max,y_min,y_max,z_min,z_max,MPI_COMM_WORLD);
+
+	// Generate the same random particles on every process, but only store
+	// those that are in this process's sub-box. In a real application,
+	// each process would read part of the input and call distribute() to
+	// send the particles to the right processes.
+	for(i=0;i<particles;i++) {
+		x=x_min+rnd()*(x_max-x_min);
+		y=y_min+rnd()*(y_max-y_min);
+		z=z_min+rnd()*(z_max-z_min);
+		if(dm.owner(x,y,z)==rank) dm.put(i,x,y,z);
+	}
+	dm.distribute();
+
+	// Compute the owned cells, saving them to a file for each process
+	cell_output co;
+	sprintf(buf,"mpi_random_%d.vol",rank);
+	co.fp=safe_fopen(buf,"w");co.vol=0;
+	int rounds=dm.compute_all_cells(co);
+	fclose(co.fp);
+
+	// Sum up the volumes, and check that this matches the container volume
+	double vvol;
+	MPI_Reduce(&co.vol,&vvol,1,MPI_DOUBLE,MPI_SUM,0,MPI_COMM_WORLD);
+	if(rank==0) printf("Sub-boxes        : %d x %d x %d\n"
+			   "Exchange rounds  : %d\n"
+			   "Container volume : %g\n"
+			   "Voronoi volume   : %g\n"
+			   "Difference       : %g\n",dm.dx,dm.dy,dm.dz,rounds,cvol,vvol,vvol-cvol);
+	MPI_Finalize();
+}
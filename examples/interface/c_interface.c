@@ -0,0 +1,62 @@
+/* C interface example code
+ *
+ * Author   : Chris H. Rycroft (LBL / UC Berkeley)
+ * Email    : chr@alum.mit.edu
+ * Date     : August 30th 2011 */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "voro_c.h"
+
+/* The number of particles, and the number of timesteps to simulate */
+#define N 20000
+#define STEPS 10
+
+/* This function returns a random double between 0 and 1 */
+double rnd() {return ((double) rand())/RAND_MAX;}
+
+int main() {
+	double *p=malloc(3*N*sizeof(double)),*vol=malloc(N*sizeof(double));
+	int *off=malloc((N+1)*sizeof(int)),cap=0,*nb=NULL,i,s,st;
+	double vsum;
+	voro_c_tess *t;
+
+	/* Create a handle for a periodic unit cube, which is reused for every
+	 * timestep, and randomly position the particles. The coordinates are
+	 * stored in interleaved form, as in a typical simulation code. */
+	t=voro_c_create(0,1,0,1,0,1,1,1,1);
+	for(i=0;i<3*N;i++) p[i]=rnd();
+
+	for(s=0;s<STEPS;s++) {
+
+		/* Compute the volumes and the neighbor lists directly from the
+		 * coordinate array. If the neighbor buffer is too small, then
+		 * enlarge it to the size reported in the last offset and try
+		 * again. */
+		st=voro_c_compute(t,N,p,p+1,p+2,3,NULL,0,vol,off,nb,cap,NULL,0);
+		if(st==VORO_C_SHORT_BUFFER) {
+			free(nb);
+			cap=off[N]+off[N]/8;
+			nb=malloc(cap*sizeof(int));
+			st=voro_c_compute(t,N,p,p+1,p+2,3,NULL,0,vol,off,nb,cap,NULL,0);
+		}
+		if(st!=VORO_C_OK) {
+			fputs("Tessellation failed\n",stderr);
+			return 1;
+		}
+
+		/* Print the total volume, which should be one, and the mean
+		 * number of neighbors */
+		for(vsum=0,i=0;i<N;i++) vsum+=vol[i];
+		printf("Step %d: total volume %g, mean neighbors %g, first neighbor of particle 0: %d\n",
+		       s,vsum,((double) off[N])/N,nb[off[0]]);
+
+		/* Move the particles slightly */
+		for(i=0;i<3*N;i++) p[i]+=0.01*(rnd()-0.5);
+	}
+
+	voro_c_destroy(t);
+	free(nb);free(off);free(vol);free(p);
+	return 0;
+}
@@ -0,0 +1,56 @@
+// Example code demonstrating the delaunay_graph class
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+#include "voro++.hh"
+using namespace voro;
+
+#include <cmath>
+#include <vector>
+using namespace std;
+
+// Set the number of particles that are going to be randomly introduced
+const int particles=1000;
+
+// This function returns a random double between 0 and 1
+double rnd() {return double(rand())/RAND_MAX;}
+
+// This function returns the periodic image of a displacement in the unit box
+// that is closest to the origin
+double min_image(double d) {return d-floor(d+0.5);}
+
+int main() {
+	int i,j,k;
+	double a[9],vol=0;
+	vector<double> p(3*particles);
+
+	// Create a periodic unit box, and randomly add particles into it
+	container_periodic con(1,0,1,0,0,1,6,6,6,8);
+	for(i=0;i<particles;i++) {
+		p[3*i]=rnd();p[3*i+1]=rnd();p[3*i+2]=rnd();
+		con.put(i,p[3*i],p[3*i+1],p[3*i+2]);
+	}
+
+	// Compute the Delaunay tetrahedra and the edges of the Delaunay graph,
+	// and save them to files
+	delaunay_graph dg;
+	dg.compute(con);
+	dg.print_tetrahedra("delaunay_t.dat");
+	dg.print_edges("delaunay_e.dat");
+
+	// Sum the volumes of the tetrahedra, using the periodic images of
+	// the particles that are closest to the first one. Since the
+	// tetrahedra fill the box, this should equal its volume.
+	for(i=0;i<dg.total_tetrahedra();i++) {
+		voro_id *tp=&dg.tets[4*i];
+		for(j=0;j<3;j++) for(k=0;k<3;k++)
+			a[3*j+k]=min_image(p[3*tp[j+1]+k]-p[3*(*tp)+k]);
+		vol+=fabs(a[0]*(a[4]*a[8]-a[5]*a[7])+a[1]*(a[5]*a[6]-a[3]*a[8])
+			 +a[2]*(a[3]*a[7]-a[4]*a[6]))/6;
+	}
+	printf("Tetrahedra         : %d\n"
+	       "Edges              : %d\n"
+	       "Tetrahedron volume : %g\n",dg.total_tetrahedra(),dg.total_edges(),vol);
+}
@@ -21,7 +21,7 @@ const int particles=20;
 double rnd() {return double(rand())/RAND_MAX;}
 
 int main() {
-	int i;
+	voro_id i;
 	double x,y,z,r,rx,ry,rz;
 
 	// Create a container with the geometry given above, and make it
@@ -79,7 +79,7 @@ int main() {
 		// Save and entry to the .vol file, storing both the computed
 		// Voronoi cell volume, and the sampled volume based on the
 		// number of grid points that were inside the cell
-		fprintf(f1,"%d %g %g %g %g %g\n",i,x,y,z,c.volume(),samp_v[i]*hcube);
+		fprintf(f1,"%ld %g %g %g %g %g\n",long(i),x,y,z,c.volume(),samp_v[i]*hcube);
 
 		// Draw the Voronoi cell
 		c.draw_gnuplot(x,y,z,f2);
@@ -0,0 +1,20 @@
+18 0.890233 0.348893 0.0641713
+8 0.156679 0.400944 0.12979
+19 0.020023 0.457702 0.0630958
+6 0.141603 0.606969 0.0163006
+1 0.79844 0.911647 0.197551
+2 0.335223 0.76823 0.277775
+9 0.108809 0.998925 0.218257
+12 0.493583 0.972775 0.292517
+14 0.400229 0.891529 0.283315
+11 0.296032 0.637552 0.524287
+16 0.0697553 0.949327 0.525995
+17 0.0860558 0.192214 0.663227
+0 0.840188 0.394383 0.783099
+3 0.55397 0.477397 0.628871
+13 0.771358 0.526745 0.769914
+5 0.916195 0.635712 0.717297
+10 0.512932 0.839112 0.61264
+7 0.242887 0.137232 0.804177
+4 0.364784 0.513401 0.95223
+15 0.352458 0.807725 0.919026
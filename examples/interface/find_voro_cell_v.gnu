@@ -0,0 +1,942 @@
+1 0 0
+1 0.686677 0
+1 0.606908 0.336558
+1 0.389884 0.431864
+0.851076 0.433214 0.418755
+0.805685 0.569487 0.360715
+1 0.606908 0.336558
+
+
+1 0 0
+1 0 0.456533
+0.715734 0 0.436745
+0.51664 0 0.318191
+0.539603 0.429623 0.234099
+0.657828 0.566052 0.273452
+0.805685 0.569487 0.360715
+
+
+1 0 0
+0.488177 0 0
+0.523023 0.491079 0
+0.545749 0.557003 0
+0.528177 0.513428 0.0398866
+0.523023 0.491079 0
+
+
+0.545749 0.557003 0
+0.593645 0.620395 0
+0.657828 0.566052 0.273452
+
+
+1 0.686677 0
+0.593645 0.620395 0
+
+
+1 0.389884 0.431864
+1 0 0.456533
+
+
+0.715734 0 0.436745
+0.851076 0.433214 0.418755
+
+
+0.539603 0.429623 0.234099
+0.528177 0.513428 0.0398866
+
+
+0.51664 0 0.318191
+0.488177 0 0
+
+
+0.528177 0.513428 0.0398866
+0.523023 0.491079 0
+0.488177 0 0
+0.51664 0 0.318191
+0.539603 0.429623 0.234099
+0.528177 0.513428 0.0398866
+0.0666999 0.628726 0.310499
+0.149723 0.463762 0
+0.523023 0.491079 0
+
+
+0.0666999 0.628726 0.310499
+0.0612261 0.627343 0.320537
+0.470492 0.441804 0.287248
+0.539603 0.429623 0.234099
+
+
+0.325899 0.298435 0.424313
+0.470492 0.441804 0.287248
+
+
+0.325899 0.298435 0.424313
+0 0.45813 0.443654
+0 0.555779 0.385087
+0.0612261 0.627343 0.320537
+
+
+0.325899 0.298435 0.424313
+0.472264 0.0488574 0.346033
+0.512056 0 0.321841
+0.472311 0 0.326921
+0.472264 0.0488574 0.346033
+
+
+0 0.555779 0.385087
+2.77556e-17 0.103269 0
+0.149723 0.463762 0
+
+
+2.77556e-17 0.103269 0
+0 0 0
+0.488177 0 0
+
+
+0.51664 0 0.318191
+0.512056 0 0.321841
+
+
+0 0.45813 0.443654
+0 0 0.264391
+0 0 0
+
+
+0 0 0.264391
+0.472311 0 0.326921
+
+
+0 0.555779 0.385087
+0 0.661695 0.343783
+0 0.685547 0.318451
+0.00697921 0.681106 0.322417
+0.0103306 0.669243 0.334657
+0 0.661695 0.343783
+
+
+0 0.555779 0.385087
+0 0.103269 0
+0 0.585713 0
+0.149723 0.463762 0
+0.0666999 0.628726 0.310499
+0.0612261 0.627343 0.320537
+0 0.555779 0.385087
+
+
+0 0.585713 0
+0 0.685547 0.318451
+
+
+0 0.103269 0
+0.149723 0.463762 0
+
+
+0.0666999 0.628726 0.310499
+0.00697921 0.681106 0.322417
+
+
+0.0612261 0.627343 0.320537
+0.0103306 0.669243 0.334657
+
+
+0.528177 0.513428 0.0398866
+0.545749 0.557003 0
+0.523023 0.491079 0
+0.528177 0.513428 0.0398866
+0.0666999 0.628726 0.310499
+0.00697921 0.681106 0.322417
+-2.77556e-17 0.685547 0.318451
+-2.77556e-17 0.690547 0.315092
+0.0075758 0.690675 0.316074
+0.00697921 0.681106 0.322417
+
+
+0 0.852899 0
+0.279808 0.87631 0
+0.0075758 0.690675 0.316074
+
+
+0 0.852899 0
+-2.77556e-17 0.585713 0
+-2.77556e-17 0.685547 0.318451
+
+
+0 0.852899 0
+-2.77556e-17 0.690547 0.315092
+
+
+0.279808 0.87631 0
+0.545749 0.557003 0
+
+
+-2.77556e-17 0.585713 0
+0.149723 0.463762 0
+0.523023 0.491079 0
+
+
+0.149723 0.463762 0
+0.0666999 0.628726 0.310499
+
+
+1 0.606908 0.336558
+1 0.686677 0
+0.593645 0.620395 0
+0.657828 0.566052 0.273452
+0.643882 0.659045 0.359173
+0.743291 0.673505 0.430075
+0.805685 0.569487 0.360715
+0.657828 0.566052 0.273452
+
+
+1 0.606908 0.336558
+1 1 0.545252
+1 1 0
+0.581269 1 0
+0.730211 1 0.478132
+0.870463 1 0.574601
+0.743291 0.673505 0.430075
+
+
+1 0.606908 0.336558
+0.805685 0.569487 0.360715
+
+
+0.581269 1 0
+0.550366 0.845882 0
+0.635261 0.707369 0.361688
+0.730211 1 0.478132
+
+
+1 1 0
+1 0.686677 0
+
+
+0.55554 0.743466 0
+0.635597 0.685171 0.358039
+0.635261 0.707369 0.361688
+
+
+0.55554 0.743466 0
+0.550366 0.845882 0
+
+
+0.55554 0.743466 0
+0.593645 0.620395 0
+
+
+1 1 0.545252
+0.870463 1 0.574601
+
+
+0.635597 0.685171 0.358039
+0.643882 0.659045 0.359173
+
+
+0.0103306 0.669243 0.334657
+0.0612261 0.627343 0.320537
+0.0666999 0.628726 0.310499
+0.00697921 0.681106 0.322417
+0.0103306 0.669243 0.334657
+0.282331 0.865844 0.48212
+0.365469 0.822452 0.472335
+0.635597 0.685171 0.358039
+0.643882 0.659045 0.359173
+0.657828 0.566052 0.273452
+0.593645 0.620395 0
+0.545749 0.557003 0
+0.528177 0.513428 0.0398866
+0.539603 0.429623 0.234099
+0.657828 0.566052 0.273452
+
+
+0.279808 0.87631 0
+0.0075758 0.690675 0.316074
+0.212412 0.90743 0.377003
+0.282331 0.865844 0.48212
+
+
+0.279808 0.87631 0
+0.288111 0.884459 0
+0.212412 0.90743 0.377003
+
+
+0.279808 0.87631 0
+0.545749 0.557003 0
+
+
+0.643882 0.659045 0.359173
+0.550171 0.650724 0.410666
+0.365469 0.822452 0.472335
+
+
+0.55554 0.743466 0
+0.593645 0.620395 0
+
+
+0.55554 0.743466 0
+0.288111 0.884459 0
+
+
+0.55554 0.743466 0
+0.635597 0.685171 0.358039
+
+
+0.0666999 0.628726 0.310499
+0.528177 0.513428 0.0398866
+
+
+0.0075758 0.690675 0.316074
+0.00697921 0.681106 0.322417
+
+
+0.550171 0.650724 0.410666
+0.470492 0.441804 0.287248
+0.0612261 0.627343 0.320537
+
+
+0.470492 0.441804 0.287248
+0.539603 0.429623 0.234099
+
+
+0.279808 0.87631 -2.77556e-17
+0.0075758 0.690675 0.316074
+0.212412 0.90743 0.377003
+0.242348 1 0.395721
+0.33069 1 -2.77556e-17
+0.288111 0.884459 -2.77556e-17
+0.212412 0.90743 0.377003
+
+
+0.279808 0.87631 -2.77556e-17
+0 0.852899 -2.77556e-17
+0 0.690547 0.315092
+0.0075758 0.690675 0.316074
+
+
+0.279808 0.87631 -2.77556e-17
+0.288111 0.884459 -2.77556e-17
+
+
+0 1 0
+0 0.852899 -2.77556e-17
+
+
+0 1 0
+0 1 0.364966
+0.242348 1 0.395721
+
+
+0 1 0
+0.33069 1 -2.77556e-17
+
+
+0 0.690547 0.315092
+0 1 0.364966
+
+
+0.730211 1 0.478132
+0.635261 0.707369 0.361688
+0.366944 1 0.500089
+0.730211 1 0.478132
+0.581269 1 0
+0.550366 0.845882 0
+0.635261 0.707369 0.361688
+
+
+0.366944 1 0.500089
+0.416239 1 0
+0.581269 1 0
+
+
+0.550366 0.845882 0
+0.416239 1 0
+
+
+0.300363 0.878814 0.503587
+0.328621 1 0.513205
+0.366944 1 0.500089
+0.635261 0.707369 0.361688
+0.635597 0.685171 0.358039
+0.365469 0.822452 0.472335
+0.300363 0.878814 0.503587
+0.282331 0.865844 0.48212
+0.212412 0.90743 0.377003
+0.242348 1 0.395721
+0.328621 1 0.513205
+
+
+0.242348 1 0.395721
+0.33069 1 0
+0.416239 1 0
+0.550366 0.845882 0
+0.55554 0.743466 0
+0.635597 0.685171 0.358039
+
+
+0.416239 1 0
+0.366944 1 0.500089
+
+
+0.55554 0.743466 0
+0.288111 0.884459 0
+0.33069 1 0
+
+
+0.550366 0.845882 0
+0.635261 0.707369 0.361688
+
+
+0.365469 0.822452 0.472335
+0.282331 0.865844 0.48212
+
+
+0.212412 0.90743 0.377003
+0.288111 0.884459 0
+
+
+0 0.56572 0.788511
+0.281315 0.404377 0.696508
+0.325899 0.298435 0.424313
+5.55112e-17 0.45813 0.443654
+0 0.56572 0.788511
+0 0.631087 0.807475
+-5.55112e-17 0.659221 0.795346
+0.258666 0.8476 0.67716
+0.416538 0.650325 0.739638
+0.408768 0.641125 0.744715
+0 0.631087 0.807475
+
+
+0.0612261 0.627343 0.320537
+0.0103306 0.669243 0.334657
+5.55112e-17 0.661695 0.343783
+5.55112e-17 0.555779 0.385087
+0.0612261 0.627343 0.320537
+0.470492 0.441804 0.287248
+0.550171 0.650724 0.410666
+0.416538 0.650325 0.739638
+
+
+0.550171 0.650724 0.410666
+0.365469 0.822452 0.472335
+0.300363 0.878814 0.503587
+0.282331 0.865844 0.48212
+0.365469 0.822452 0.472335
+
+
+0.281315 0.404377 0.696508
+0.408768 0.641125 0.744715
+
+
+0.258666 0.8476 0.67716
+0.300363 0.878814 0.503587
+
+
+0.470492 0.441804 0.287248
+0.325899 0.298435 0.424313
+
+
+5.55112e-17 0.555779 0.385087
+5.55112e-17 0.45813 0.443654
+
+
+0.0103306 0.669243 0.334657
+0.282331 0.865844 0.48212
+
+
+-5.55112e-17 0.659221 0.795346
+5.55112e-17 0.661695 0.343783
+
+
+0.242348 1 0.395721
+0.212412 0.90743 0.377003
+0.282331 0.865844 0.48212
+0.300363 0.878814 0.503587
+0.328621 1 0.513205
+0.242348 1 0.395721
+0 1 0.364966
+0 0.690547 0.315092
+0 0.685547 0.318451
+0 0.661695 0.343783
+0.0103306 0.669243 0.334657
+0.00697921 0.681106 0.322417
+0 0.685547 0.318451
+
+
+0 1 0.364966
+0 1 0.918123
+0.290277 1 0.70933
+0.328621 1 0.513205
+
+
+0.212412 0.90743 0.377003
+0.0075758 0.690675 0.316074
+0 0.690547 0.315092
+
+
+-1.38778e-17 0.659221 0.795346
+0 1 0.918123
+
+
+-1.38778e-17 0.659221 0.795346
+0 0.661695 0.343783
+
+
+-1.38778e-17 0.659221 0.795346
+0.258666 0.8476 0.67716
+0.290277 1 0.70933
+
+
+0.0103306 0.669243 0.334657
+0.282331 0.865844 0.48212
+
+
+0.258666 0.8476 0.67716
+0.300363 0.878814 0.503587
+
+
+0.0075758 0.690675 0.316074
+0.00697921 0.681106 0.322417
+
+
+-1.38778e-17 0.376159 0.999182
+-1.38778e-17 0.56572 0.788511
+-1.38778e-17 0.45813 0.443654
+0 0 0.264391
+0.472311 2.77556e-17 0.326921
+0.472264 0.0488574 0.346033
+0.325899 0.298435 0.424313
+-1.38778e-17 0.45813 0.443654
+
+
+-1.38778e-17 0.376159 0.999182
+0 0 0.852449
+0 0 0.264391
+
+
+-1.38778e-17 0.376159 0.999182
+0.281586 0.403957 0.696713
+0.281315 0.404377 0.696508
+0.325899 0.298435 0.424313
+
+
+0.472311 2.77556e-17 0.326921
+0 0 0.852449
+
+
+-1.38778e-17 0.56572 0.788511
+0.281315 0.404377 0.696508
+
+
+0.281586 0.403957 0.696713
+0.472264 0.0488574 0.346033
+
+
+1 0 0.456533
+1 0.389884 0.431864
+0.851076 0.433214 0.418755
+0.715734 -5.55112e-17 0.436745
+1 0 0.456533
+1 0 1
+0.663255 0 1
+0.647826 -5.55112e-17 0.562768
+0.552454 0.246929 0.872672
+0.582749 0.186998 1
+0.663255 0 1
+
+
+0.634515 0.393771 1
+0.582749 0.186998 1
+
+
+0.634515 0.393771 1
+0.953253 0.559519 1
+0.838818 0.445009 0.447853
+0.580858 0.353656 0.877406
+0.634515 0.393771 1
+
+
+1 0.544796 1
+0.953253 0.559519 1
+
+
+1 0.544796 1
+1 0 1
+
+
+1 0.544796 1
+1 0.389884 0.431864
+
+
+0.580858 0.353656 0.877406
+0.552454 0.246929 0.872672
+
+
+0.838818 0.445009 0.447853
+0.851076 0.433214 0.418755
+
+
+0.647826 -5.55112e-17 0.562768
+0.715734 -5.55112e-17 0.436745
+
+
+0.805685 0.569487 0.360715
+0.743291 0.673505 0.430075
+0.643882 0.659045 0.359173
+0.657828 0.566052 0.273452
+0.805685 0.569487 0.360715
+0.851076 0.433214 0.418755
+0.838818 0.445009 0.447853
+0.708729 0.675756 0.567625
+0.551562 0.668903 0.812262
+0.546958 0.655849 0.823925
+0.408768 0.641125 0.744715
+0.416538 0.650325 0.739638
+0.551562 0.668903 0.812262
+
+
+0.715734 5.55112e-17 0.436745
+0.851076 0.433214 0.418755
+
+
+0.715734 5.55112e-17 0.436745
+0.647826 5.55112e-17 0.562768
+0.512056 0 0.321841
+0.51664 5.55112e-17 0.318191
+0.539603 0.429623 0.234099
+0.470492 0.441804 0.287248
+0.325899 0.298435 0.424313
+0.472264 0.0488574 0.346033
+0.512056 0 0.321841
+
+
+0.715734 5.55112e-17 0.436745
+0.51664 5.55112e-17 0.318191
+
+
+0.552454 0.246929 0.872672
+0.647826 5.55112e-17 0.562768
+
+
+0.552454 0.246929 0.872672
+0.580858 0.353656 0.877406
+0.838818 0.445009 0.447853
+
+
+0.552454 0.246929 0.872672
+0.281586 0.403957 0.696713
+0.281315 0.404377 0.696508
+0.408768 0.641125 0.744715
+
+
+0.470492 0.441804 0.287248
+0.550171 0.650724 0.410666
+0.643882 0.659045 0.359173
+
+
+0.550171 0.650724 0.410666
+0.416538 0.650325 0.739638
+
+
+0.657828 0.566052 0.273452
+0.539603 0.429623 0.234099
+
+
+0.580858 0.353656 0.877406
+0.546958 0.655849 0.823925
+
+
+0.281315 0.404377 0.696508
+0.325899 0.298435 0.424313
+
+
+0.708729 0.675756 0.567625
+0.743291 0.673505 0.430075
+
+
+0.281586 0.403957 0.696713
+0.472264 0.0488574 0.346033
+
+
+0.580858 0.353656 0.877406
+0.546958 0.655849 0.823925
+0.551562 0.668903 0.812262
+0.705445 0.845924 0.910995
+0.737435 0.846382 1
+0.625154 0.678987 1
+0.546958 0.655849 0.823925
+
+
+0.580858 0.353656 0.877406
+0.838818 0.445009 0.447853
+0.708729 0.675756 0.567625
+0.705445 0.845924 0.910995
+
+
+0.580858 0.353656 0.877406
+0.634515 0.393771 1
+0.953253 0.559519 1
+0.838818 0.445009 0.447853
+
+
+0.634515 0.393771 1
+0.625154 0.678987 1
+
+
+0.708729 0.675756 0.567625
+0.551562 0.668903 0.812262
+
+
+0.953253 0.559519 1
+0.737435 0.846382 1
+
+
+0.838818 0.445009 0.447853
+0.851076 0.433214 0.418755
+1 0.389884 0.431864
+1 0.606908 0.336558
+1 1 0.545252
+0.870463 1 0.574601
+0.743291 0.673505 0.430075
+0.805685 0.569487 0.360715
+1 0.606908 0.336558
+
+
+0.838818 0.445009 0.447853
+0.953253 0.559519 1
+1 0.544796 1
+1 0.389884 0.431864
+
+
+0.838818 0.445009 0.447853
+0.708729 0.675756 0.567625
+0.743291 0.673505 0.430075
+
+
+0.870463 1 0.574601
+0.770254 1 0.960724
+0.784308 1 1
+0.737435 0.846382 1
+0.705445 0.845924 0.910995
+0.770254 1 0.960724
+
+
+1 0.544796 1
+1 1 1
+1 1 0.545252
+
+
+1 1 1
+0.784308 1 1
+
+
+0.953253 0.559519 1
+0.737435 0.846382 1
+
+
+0.851076 0.433214 0.418755
+0.805685 0.569487 0.360715
+
+
+0.708729 0.675756 0.567625
+0.705445 0.845924 0.910995
+
+
+0.416538 0.650325 0.739638
+0.551562 0.668903 0.812262
+0.705445 0.845924 0.910995
+0.770254 1 0.960724
+0.870463 1 0.574601
+0.730211 1 0.478132
+0.635261 0.707369 0.361688
+0.635597 0.685171 0.358039
+0.643882 0.659045 0.359173
+0.743291 0.673505 0.430075
+0.870463 1 0.574601
+
+
+0.416538 0.650325 0.739638
+0.258666 0.8476 0.67716
+0.300363 0.878814 0.503587
+0.328621 1 0.513205
+0.290277 1 0.70933
+0.258666 0.8476 0.67716
+
+
+0.416538 0.650325 0.739638
+0.550171 0.650724 0.410666
+0.643882 0.659045 0.359173
+
+
+0.708729 0.675756 0.567625
+0.705445 0.845924 0.910995
+
+
+0.708729 0.675756 0.567625
+0.551562 0.668903 0.812262
+
+
+0.708729 0.675756 0.567625
+0.743291 0.673505 0.430075
+
+
+0.328621 1 0.513205
+0.366944 1 0.500089
+0.730211 1 0.478132
+
+
+0.770254 1 0.960724
+0.290277 1 0.70933
+
+
+0.365469 0.822452 0.472335
+0.550171 0.650724 0.410666
+
+
+0.365469 0.822452 0.472335
+0.300363 0.878814 0.503587
+
+
+0.365469 0.822452 0.472335
+0.635597 0.685171 0.358039
+
+
+0.366944 1 0.500089
+0.635261 0.707369 0.361688
+
+
+0.647826 0 0.562768
+0.663255 0 1
+0.582749 0.186998 1
+0.552454 0.246929 0.872672
+0.647826 0 0.562768
+0.512056 0 0.321841
+0.472264 0.0488574 0.346033
+0.472311 0 0.326921
+0.512056 0 0.321841
+
+
+0 0.375837 1
+0 0.376159 0.999182
+0.281586 0.403957 0.696713
+0.472264 0.0488574 0.346033
+
+
+0 0.375837 1
+0 0 1
+0 0 0.852449
+0.472311 0 0.326921
+
+
+0 0.375837 1
+0.582749 0.186998 1
+
+
+0 0 1
+0.663255 0 1
+
+
+0 0 0.852449
+0 0.376159 0.999182
+
+
+0.281586 0.403957 0.696713
+0.552454 0.246929 0.872672
+
+
+0.546958 0.655849 0.823925
+0.625154 0.678987 1
+0 0.652806 1
+0 0.631087 0.807475
+0 0.56572 0.788511
+0 0.376159 0.999182
+0.281586 0.403957 0.696713
+0.281315 0.404377 0.696508
+0 0.56572 0.788511
+
+
+0.546958 0.655849 0.823925
+0.580858 0.353656 0.877406
+0.552454 0.246929 0.872672
+0.582749 0.186998 1
+0.634515 0.393771 1
+0.580858 0.353656 0.877406
+
+
+0.546958 0.655849 0.823925
+0.408768 0.641125 0.744715
+0 0.631087 0.807475
+
+
+0 0.376159 0.999182
+0 0.375837 1
+0.582749 0.186998 1
+
+
+0.281586 0.403957 0.696713
+0.552454 0.246929 0.872672
+
+
+0 0.375837 1
+0 0.652806 1
+
+
+0.625154 0.678987 1
+0.634515 0.393771 1
+
+
+0.408768 0.641125 0.744715
+0.281315 0.404377 0.696508
+
+
+0.408768 0.641125 0.744715
+0.416538 0.650325 0.739638
+0.258666 0.8476 0.67716
+0.290277 1 0.70933
+-5.55112e-17 1 0.918123
+0 0.659221 0.795346
+0.258666 0.8476 0.67716
+
+
+0.408768 0.641125 0.744715
+0.546958 0.655849 0.823925
+0.625154 0.678987 1
+0.737435 0.846382 1
+0.784308 1 1
+0.770254 1 0.960724
+0.705445 0.845924 0.910995
+0.737435 0.846382 1
+
+
+0.408768 0.641125 0.744715
+0 0.631087 0.807475
+0 0.652806 1
+0.625154 0.678987 1
+
+
+0.416538 0.650325 0.739638
+0.551562 0.668903 0.812262
+0.546958 0.655849 0.823925
+
+
+0 0.652806 1
+0 1 1
+0.784308 1 1
+
+
+0 0.631087 0.807475
+0 0.659221 0.795346
+
+
+0.551562 0.668903 0.812262
+0.705445 0.845924 0.910995
+
+
+0.770254 1 0.960724
+0.290277 1 0.70933
+
+
+-5.55112e-17 1 0.918123
+0 1 1
+
+
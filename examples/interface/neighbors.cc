@@ -0,0 +1,54 @@
+// Example code demonstrating the neighbor_query class
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+#include "voro++.hh"
+using namespace voro;
+
+#include <vector>
+using namespace std;
+
+// Set the number of particles that are going to be randomly introduced, and
+// the number of test positions
+const int particles=10000;
+const int tests=1000;
+
+// This function returns a random double between 0 and 1
+double rnd() {return double(rand())/RAND_MAX;}
+
+int main() {
+	int i,j;
+	vector<double> t(3*tests);
+
+	// Create a container and randomly add particles into it
+	container con(0,1,0,1,0,1,12,12,12,false,false,false,8);
+	for(i=0;i<particles;i++) con.put(i,rnd(),rnd(),rnd());
+
+	// Find the particles that are near to a single position
+	neighbor_query<container> nq(con);
+	vector<voro_id> pid;vector<double> rs;
+	nq.nearest(0.5,0.5,0.5,5,pid,&rs);
+	printf("Five nearest particles to (0.5,0.5,0.5):\n");
+	for(j=0;j<(int) pid.size();j++) printf("%ld %g\n",long(pid[j]),sqrt(rs[j]));
+	nq.within(0.5,0.5,0.5,0.05,pid);
+	printf("Particles within 0.05: %d\n",(int) pid.size());
+
+	// Find the eight nearest particles and the particles within a radius
+	// of 0.1 for a list of random positions, using two threads
+	for(i=0;i<3*tests;i++) t[i]=rnd();
+	vector<voro_id> knn(8*tests),nb;vector<int> off;
+	nq.nearest(tests,&t[0],8,&knn[0],NULL,2);
+	nq.within(tests,&t[0],0.1,off,nb,NULL,2);
+	printf("Average number of particles within 0.1: %g\n",double(nb.size())/tests);
+
+	// Save the nearest neighbors of each position
+	FILE *fp=safe_fopen("neighbors.dat","w");
+	for(i=0;i<tests;i++) {
+		fprintf(fp,"%g %g %g",t[3*i],t[3*i+1],t[3*i+2]);
+		for(j=0;j<8;j++) fprintf(fp," %ld",long(knn[8*i+j]));
+		fputc('\n',fp);
+	}
+	fclose(fp);
+}
@@ -14,10 +14,10 @@ void draw_polygon(FILE *fp,vector<int> &f_vert,vector<double> &v,int j);
 
 int main() {
 	unsigned int i,j;
-	int id,nx,ny,nz;
+	voro_id id;int nx,ny,nz;
 	double x,y,z;
 	voronoicell_neighbor c;
-	vector<int> neigh,f_vert;
+	vector<voro_id> neigh;vector<int> f_vert;
 	vector<double> v;
 
 	// Create a pre-container class to import the input file and guess the
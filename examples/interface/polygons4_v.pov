@@ -0,0 +1,4880 @@
+union{
+	triangle{<-2.20875,-1.99708,0>,<-2.2084,-1.99708,0.723851>,<-3,-2.00116,1.03375>}
+	triangle{<-2.20875,-1.99708,0>,<-3,-2.00116,1.03375>,<-3,-2.00116,0>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.20875,-1.99708,0>,<-2.2084,-1.99708,0.723851>,r}
+	sphere{<-2.2084,-1.99708,0.723851>,r}
+	cylinder{<-2.2084,-1.99708,0.723851>,<-3,-2.00116,1.03375>,r}
+	sphere{<-3,-2.00116,1.03375>,r}
+	cylinder{<-3,-2.00116,1.03375>,<-3,-2.00116,0>,r}
+	sphere{<-3,-2.00116,0>,r}
+	cylinder{<-3,-2.00116,0>,<-2.20875,-1.99708,0>,r}
+	sphere{<-2.20875,-1.99708,0>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.04445,-2.94257,1.29797>,<-2.04445,-3,1.29794>,<-3,-3,1.29461>}
+	triangle{<-2.04445,-2.94257,1.29797>,<-3,-3,1.29461>,<-3,-2.38834,1.2949>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.04445,-2.94257,1.29797>,<-2.04445,-3,1.29794>,r}
+	sphere{<-2.04445,-3,1.29794>,r}
+	cylinder{<-2.04445,-3,1.29794>,<-3,-3,1.29461>,r}
+	sphere{<-3,-3,1.29461>,r}
+	cylinder{<-3,-3,1.29461>,<-3,-2.38834,1.2949>,r}
+	sphere{<-3,-2.38834,1.2949>,r}
+	cylinder{<-3,-2.38834,1.2949>,<-2.04445,-2.94257,1.29797>,r}
+	sphere{<-2.04445,-2.94257,1.29797>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.63103,-3,0>,<-1.63103,-3,1.03095>,<-1.63103,-2.98712,1.03096>}
+	triangle{<-1.63103,-3,0>,<-1.63103,-2.98712,1.03096>,<-1.63103,-2.98796,0>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.63103,-3,0>,<-1.63103,-3,1.03095>,r}
+	sphere{<-1.63103,-3,1.03095>,r}
+	cylinder{<-1.63103,-3,1.03095>,<-1.63103,-2.98712,1.03096>,r}
+	sphere{<-1.63103,-2.98712,1.03096>,r}
+	cylinder{<-1.63103,-2.98712,1.03096>,<-1.63103,-2.98796,0>,r}
+	sphere{<-1.63103,-2.98796,0>,r}
+	cylinder{<-1.63103,-2.98796,0>,<-1.63103,-3,0>,r}
+	sphere{<-1.63103,-3,0>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.08412,-1.38468,1.71334>,<-2.02205,-1.98735,2.02622>,<-3,-1.93596,1.63512>}
+	triangle{<-2.08412,-1.38468,1.71334>,<-3,-1.93596,1.63512>,<-3,-1.70042,1.52193>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.08412,-1.38468,1.71334>,<-2.02205,-1.98735,2.02622>,r}
+	sphere{<-2.02205,-1.98735,2.02622>,r}
+	cylinder{<-2.02205,-1.98735,2.02622>,<-3,-1.93596,1.63512>,r}
+	sphere{<-3,-1.93596,1.63512>,r}
+	cylinder{<-3,-1.93596,1.63512>,<-3,-1.70042,1.52193>,r}
+	sphere{<-3,-1.70042,1.52193>,r}
+	cylinder{<-3,-1.70042,1.52193>,<-2.08412,-1.38468,1.71334>,r}
+	sphere{<-2.08412,-1.38468,1.71334>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.77833,-1.26666,1.35881>,<-1.7829,-1.26406,1.21931>,<-1.5921,-1.49001,1.08825>}
+	triangle{<-1.77833,-1.26666,1.35881>,<-1.5921,-1.49001,1.08825>,<-1.58636,-1.49214,1.32023>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.77833,-1.26666,1.35881>,<-1.7829,-1.26406,1.21931>,r}
+	sphere{<-1.7829,-1.26406,1.21931>,r}
+	cylinder{<-1.7829,-1.26406,1.21931>,<-1.5921,-1.49001,1.08825>,r}
+	sphere{<-1.5921,-1.49001,1.08825>,r}
+	cylinder{<-1.5921,-1.49001,1.08825>,<-1.58636,-1.49214,1.32023>,r}
+	sphere{<-1.58636,-1.49214,1.32023>,r}
+	cylinder{<-1.58636,-1.49214,1.32023>,<-1.77833,-1.26666,1.35881>,r}
+	sphere{<-1.77833,-1.26666,1.35881>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.63103,-2.98712,1.03096>,<-1.72753,-2.82154,1.09336>,<-1.64563,-2.67398,1.13498>}
+	triangle{<-1.63103,-2.98712,1.03096>,<-1.64563,-2.67398,1.13498>,<-1.55108,-2.85031,1.06921>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.63103,-2.98712,1.03096>,<-1.72753,-2.82154,1.09336>,r}
+	sphere{<-1.72753,-2.82154,1.09336>,r}
+	cylinder{<-1.72753,-2.82154,1.09336>,<-1.64563,-2.67398,1.13498>,r}
+	sphere{<-1.64563,-2.67398,1.13498>,r}
+	cylinder{<-1.64563,-2.67398,1.13498>,<-1.55108,-2.85031,1.06921>,r}
+	sphere{<-1.55108,-2.85031,1.06921>,r}
+	cylinder{<-1.55108,-2.85031,1.06921>,<-1.63103,-2.98712,1.03096>,r}
+	sphere{<-1.63103,-2.98712,1.03096>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.92213,-1.49703,0.870491>,<-2.2084,-1.99708,0.723851>,<-2.20875,-1.99708,-5.55112e-17>}
+	triangle{<-1.92213,-1.49703,0.870491>,<-2.20875,-1.99708,-5.55112e-17>,<-1.92234,-1.49668,0>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.92213,-1.49703,0.870491>,<-2.2084,-1.99708,0.723851>,r}
+	sphere{<-2.2084,-1.99708,0.723851>,r}
+	cylinder{<-2.2084,-1.99708,0.723851>,<-2.20875,-1.99708,-5.55112e-17>,r}
+	sphere{<-2.20875,-1.99708,-5.55112e-17>,r}
+	cylinder{<-2.20875,-1.99708,-5.55112e-17>,<-1.92234,-1.49668,0>,r}
+	sphere{<-1.92234,-1.49668,0>,r}
+	cylinder{<-1.92234,-1.49668,0>,<-1.92213,-1.49703,0.870491>,r}
+	sphere{<-1.92213,-1.49703,0.870491>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.0457,-1.9859,0.694749>,<-1.32069,-1.49412,0.886294>,<-1.32054,-1.49376,0>}
+	triangle{<-1.0457,-1.9859,0.694749>,<-1.32054,-1.49376,0>,<-1.0454,-1.98595,0>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.0457,-1.9859,0.694749>,<-1.32069,-1.49412,0.886294>,r}
+	sphere{<-1.32069,-1.49412,0.886294>,r}
+	cylinder{<-1.32069,-1.49412,0.886294>,<-1.32054,-1.49376,0>,r}
+	sphere{<-1.32054,-1.49376,0>,r}
+	cylinder{<-1.32054,-1.49376,0>,<-1.0454,-1.98595,0>,r}
+	sphere{<-1.0454,-1.98595,0>,r}
+	cylinder{<-1.0454,-1.98595,0>,<-1.0457,-1.9859,0.694749>,r}
+	sphere{<-1.0457,-1.9859,0.694749>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.55108,-2.85031,1.06921>,<-1.0457,-1.9859,0.694749>,<-0.4553,-2.00683,0.911534>}
+	triangle{<-1.55108,-2.85031,1.06921>,<-0.4553,-2.00683,0.911534>,<-1.04699,-2.95643,1.31032>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.55108,-2.85031,1.06921>,<-1.0457,-1.9859,0.694749>,r}
+	sphere{<-1.0457,-1.9859,0.694749>,r}
+	cylinder{<-1.0457,-1.9859,0.694749>,<-0.4553,-2.00683,0.911534>,r}
+	sphere{<-0.4553,-2.00683,0.911534>,r}
+	cylinder{<-0.4553,-2.00683,0.911534>,<-1.04699,-2.95643,1.31032>,r}
+	sphere{<-1.04699,-2.95643,1.31032>,r}
+	cylinder{<-1.04699,-2.95643,1.31032>,<-1.55108,-2.85031,1.06921>,r}
+	sphere{<-1.55108,-2.85031,1.06921>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.641057,-2.96745,2.09053>,<-0.81803,-2.53876,1.75042>,<-0.440292,-1.9237,1.60043>}
+	triangle{<-0.641057,-2.96745,2.09053>,<-0.440292,-1.9237,1.60043>,<-0.0348803,-1.94883,1.83174>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.641057,-2.96745,2.09053>,<-0.81803,-2.53876,1.75042>,r}
+	sphere{<-0.81803,-2.53876,1.75042>,r}
+	cylinder{<-0.81803,-2.53876,1.75042>,<-0.440292,-1.9237,1.60043>,r}
+	sphere{<-0.440292,-1.9237,1.60043>,r}
+	cylinder{<-0.440292,-1.9237,1.60043>,<-0.0348803,-1.94883,1.83174>,r}
+	sphere{<-0.0348803,-1.94883,1.83174>,r}
+	cylinder{<-0.0348803,-1.94883,1.83174>,<-0.641057,-2.96745,2.09053>,r}
+	sphere{<-0.641057,-2.96745,2.09053>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.66261,-1.48315,1.62103>,<-0.619836,-1.55977,1.68014>,<-0.861112,-1.49196,1.78185>}
+	triangle{<-0.66261,-1.48315,1.62103>,<-0.861112,-1.49196,1.78185>,<-0.862929,-1.48721,1.77755>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.66261,-1.48315,1.62103>,<-0.619836,-1.55977,1.68014>,r}
+	sphere{<-0.619836,-1.55977,1.68014>,r}
+	cylinder{<-0.619836,-1.55977,1.68014>,<-0.861112,-1.49196,1.78185>,r}
+	sphere{<-0.861112,-1.49196,1.78185>,r}
+	cylinder{<-0.861112,-1.49196,1.78185>,<-0.862929,-1.48721,1.77755>,r}
+	sphere{<-0.862929,-1.48721,1.77755>,r}
+	cylinder{<-0.862929,-1.48721,1.77755>,<-0.66261,-1.48315,1.62103>,r}
+	sphere{<-0.66261,-1.48315,1.62103>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.372917,-2.89846,0.818318>,<0.32674,-2.06288,1.17699>,<0.461096,-1.95676,1.12791>}
+	triangle{<0.372917,-2.89846,0.818318>,<0.461096,-1.95676,1.12791>,<0.694345,-2.12619,0.904081>}
+	texture{t1}
+}
+union{
+	cylinder{<0.372917,-2.89846,0.818318>,<0.32674,-2.06288,1.17699>,r}
+	sphere{<0.32674,-2.06288,1.17699>,r}
+	cylinder{<0.32674,-2.06288,1.17699>,<0.461096,-1.95676,1.12791>,r}
+	sphere{<0.461096,-1.95676,1.12791>,r}
+	cylinder{<0.461096,-1.95676,1.12791>,<0.694345,-2.12619,0.904081>,r}
+	sphere{<0.694345,-2.12619,0.904081>,r}
+	cylinder{<0.694345,-2.12619,0.904081>,<0.372917,-2.89846,0.818318>,r}
+	sphere{<0.372917,-2.89846,0.818318>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.430876,-2.0077,0.895066>,<-0.0157998,-3,0.615021>,<-0.0159063,-3,0>}
+	triangle{<-0.430876,-2.0077,0.895066>,<-0.0159063,-3,0>,<-0.431011,-2.00775,0>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.430876,-2.0077,0.895066>,<-0.0157998,-3,0.615021>,r}
+	sphere{<-0.0157998,-3,0.615021>,r}
+	cylinder{<-0.0157998,-3,0.615021>,<-0.0159063,-3,0>,r}
+	sphere{<-0.0159063,-3,0>,r}
+	cylinder{<-0.0159063,-3,0>,<-0.431011,-2.00775,0>,r}
+	sphere{<-0.431011,-2.00775,0>,r}
+	cylinder{<-0.431011,-2.00775,0>,<-0.430876,-2.0077,0.895066>,r}
+	sphere{<-0.430876,-2.0077,0.895066>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.461096,-1.95676,1.12791>,<0.510208,-1.89274,1.22859>,<0.284029,-2.01526,1.57517>}
+	triangle{<0.461096,-1.95676,1.12791>,<0.284029,-2.01526,1.57517>,<0.32674,-2.06288,1.17699>}
+	texture{t1}
+}
+union{
+	cylinder{<0.461096,-1.95676,1.12791>,<0.510208,-1.89274,1.22859>,r}
+	sphere{<0.510208,-1.89274,1.22859>,r}
+	cylinder{<0.510208,-1.89274,1.22859>,<0.284029,-2.01526,1.57517>,r}
+	sphere{<0.284029,-2.01526,1.57517>,r}
+	cylinder{<0.284029,-2.01526,1.57517>,<0.32674,-2.06288,1.17699>,r}
+	sphere{<0.32674,-2.06288,1.17699>,r}
+	cylinder{<0.32674,-2.06288,1.17699>,<0.461096,-1.95676,1.12791>,r}
+	sphere{<0.461096,-1.95676,1.12791>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.78382,-3,2.06892>,<0.280672,-3,1.697>,<0.271081,-2.05795,1.70111>}
+	triangle{<0.78382,-3,2.06892>,<0.271081,-2.05795,1.70111>,<0.781438,-2.17082,2.07702>}
+	texture{t1}
+}
+union{
+	cylinder{<0.78382,-3,2.06892>,<0.280672,-3,1.697>,r}
+	sphere{<0.280672,-3,1.697>,r}
+	cylinder{<0.280672,-3,1.697>,<0.271081,-2.05795,1.70111>,r}
+	sphere{<0.271081,-2.05795,1.70111>,r}
+	cylinder{<0.271081,-2.05795,1.70111>,<0.781438,-2.17082,2.07702>,r}
+	sphere{<0.781438,-2.17082,2.07702>,r}
+	cylinder{<0.781438,-2.17082,2.07702>,<0.78382,-3,2.06892>,r}
+	sphere{<0.78382,-3,2.06892>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.83427,-1.83462,1.32474>,<1.33981,-1.86939,1.29235>,<1.42385,-1.85545,1.14489>}
+	triangle{<1.83427,-1.83462,1.32474>,<1.42385,-1.85545,1.14489>,<1.82691,-1.82719,1.17289>}
+	texture{t1}
+}
+union{
+	cylinder{<1.83427,-1.83462,1.32474>,<1.33981,-1.86939,1.29235>,r}
+	sphere{<1.33981,-1.86939,1.29235>,r}
+	cylinder{<1.33981,-1.86939,1.29235>,<1.42385,-1.85545,1.14489>,r}
+	sphere{<1.42385,-1.85545,1.14489>,r}
+	cylinder{<1.42385,-1.85545,1.14489>,<1.82691,-1.82719,1.17289>,r}
+	sphere{<1.82691,-1.82719,1.17289>,r}
+	cylinder{<1.82691,-1.82719,1.17289>,<1.83427,-1.83462,1.32474>,r}
+	sphere{<1.83427,-1.83462,1.32474>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.71285,-2.69137,1.99345>,<1.71283,-3,1.99344>,<1.42682,-3,1.85969>}
+	triangle{<1.71285,-2.69137,1.99345>,<1.42682,-3,1.85969>,<1.43161,-2.56939,1.86194>}
+	texture{t1}
+}
+union{
+	cylinder{<1.71285,-2.69137,1.99345>,<1.71283,-3,1.99344>,r}
+	sphere{<1.71283,-3,1.99344>,r}
+	cylinder{<1.71283,-3,1.99344>,<1.42682,-3,1.85969>,r}
+	sphere{<1.42682,-3,1.85969>,r}
+	cylinder{<1.42682,-3,1.85969>,<1.43161,-2.56939,1.86194>,r}
+	sphere{<1.43161,-2.56939,1.86194>,r}
+	cylinder{<1.43161,-2.56939,1.86194>,<1.71285,-2.69137,1.99345>,r}
+	sphere{<1.71285,-2.69137,1.99345>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.14585,-2.14711,0.854063>,<1.82691,-1.82719,1.17289>,<2.11902,-1.41491,0.880633>}
+	triangle{<2.14585,-2.14711,0.854063>,<2.11902,-1.41491,0.880633>,<2.49697,-1.79456,0.502824>}
+	texture{t1}
+}
+union{
+	cylinder{<2.14585,-2.14711,0.854063>,<1.82691,-1.82719,1.17289>,r}
+	sphere{<1.82691,-1.82719,1.17289>,r}
+	cylinder{<1.82691,-1.82719,1.17289>,<2.11902,-1.41491,0.880633>,r}
+	sphere{<2.11902,-1.41491,0.880633>,r}
+	cylinder{<2.11902,-1.41491,0.880633>,<2.49697,-1.79456,0.502824>,r}
+	sphere{<2.49697,-1.79456,0.502824>,r}
+	cylinder{<2.49697,-1.79456,0.502824>,<2.14585,-2.14711,0.854063>,r}
+	sphere{<2.14585,-2.14711,0.854063>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.79138,-2.50322,0.499455>,<1.79139,-2.50335,0>,<1.0845,-1.79317,0>}
+	triangle{<1.79138,-2.50322,0.499455>,<1.0845,-1.79317,0>,<1.31456,-2.02406,0.976969>}
+	texture{t1}
+}
+union{
+	cylinder{<1.79138,-2.50322,0.499455>,<1.79139,-2.50335,0>,r}
+	sphere{<1.79139,-2.50335,0>,r}
+	cylinder{<1.79139,-2.50335,0>,<1.0845,-1.79317,0>,r}
+	sphere{<1.0845,-1.79317,0>,r}
+	cylinder{<1.0845,-1.79317,0>,<1.31456,-2.02406,0.976969>,r}
+	sphere{<1.31456,-2.02406,0.976969>,r}
+	cylinder{<1.31456,-2.02406,0.976969>,<1.79138,-2.50322,0.499455>,r}
+	sphere{<1.79138,-2.50322,0.499455>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.24627,-1.31005,0>,<1.83598,-1.13068,0>,<1.83606,-1.13072,0.618444>}
+	triangle{<1.24627,-1.31005,0>,<1.83606,-1.13072,0.618444>,<1.4776,-1.23975,0.660474>}
+	texture{t1}
+}
+union{
+	cylinder{<1.24627,-1.31005,0>,<1.83598,-1.13068,0>,r}
+	sphere{<1.83598,-1.13068,0>,r}
+	cylinder{<1.83598,-1.13068,0>,<1.83606,-1.13072,0.618444>,r}
+	sphere{<1.83606,-1.13072,0.618444>,r}
+	cylinder{<1.83606,-1.13072,0.618444>,<1.4776,-1.23975,0.660474>,r}
+	sphere{<1.4776,-1.23975,0.660474>,r}
+	cylinder{<1.4776,-1.23975,0.660474>,<1.24627,-1.31005,0>,r}
+	sphere{<1.24627,-1.31005,0>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.79136,-3,0.499348>,<1.79137,-3,0>,<1.79139,-2.50335,-5.55112e-17>}
+	triangle{<1.79136,-3,0.499348>,<1.79139,-2.50335,-5.55112e-17>,<1.79138,-2.50322,0.499455>}
+	texture{t1}
+}
+union{
+	cylinder{<1.79136,-3,0.499348>,<1.79137,-3,0>,r}
+	sphere{<1.79137,-3,0>,r}
+	cylinder{<1.79137,-3,0>,<1.79139,-2.50335,-5.55112e-17>,r}
+	sphere{<1.79139,-2.50335,-5.55112e-17>,r}
+	cylinder{<1.79139,-2.50335,-5.55112e-17>,<1.79138,-2.50322,0.499455>,r}
+	sphere{<1.79138,-2.50322,0.499455>,r}
+	cylinder{<1.79138,-2.50322,0.499455>,<1.79136,-3,0.499348>,r}
+	sphere{<1.79136,-3,0.499348>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.4999,-3,1.20804>,<2.49988,-2.50244,1.20811>,<3,-2.50301,1.2087>}
+	triangle{<2.4999,-3,1.20804>,<3,-2.50301,1.2087>,<3,-3,1.20864>}
+	texture{t1}
+}
+union{
+	cylinder{<2.4999,-3,1.20804>,<2.49988,-2.50244,1.20811>,r}
+	sphere{<2.49988,-2.50244,1.20811>,r}
+	cylinder{<2.49988,-2.50244,1.20811>,<3,-2.50301,1.2087>,r}
+	sphere{<3,-2.50301,1.2087>,r}
+	cylinder{<3,-2.50301,1.2087>,<3,-3,1.20864>,r}
+	sphere{<3,-3,1.20864>,r}
+	cylinder{<3,-3,1.20864>,<2.4999,-3,1.20804>,r}
+	sphere{<2.4999,-3,1.20804>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.83427,-1.83462,1.32474>,<2.09956,-1.52432,1.63253>,<2.3325,-1.8737,1.83471>}
+	triangle{<1.83427,-1.83462,1.32474>,<2.3325,-1.8737,1.83471>,<2.11945,-2.12084,1.58776>}
+	texture{t1}
+}
+union{
+	cylinder{<1.83427,-1.83462,1.32474>,<2.09956,-1.52432,1.63253>,r}
+	sphere{<2.09956,-1.52432,1.63253>,r}
+	cylinder{<2.09956,-1.52432,1.63253>,<2.3325,-1.8737,1.83471>,r}
+	sphere{<2.3325,-1.8737,1.83471>,r}
+	cylinder{<2.3325,-1.8737,1.83471>,<2.11945,-2.12084,1.58776>,r}
+	sphere{<2.11945,-2.12084,1.58776>,r}
+	cylinder{<2.11945,-2.12084,1.58776>,<1.83427,-1.83462,1.32474>,r}
+	sphere{<1.83427,-1.83462,1.32474>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.21319,-0.995817,5.55112e-17>,<-3,-0.996043,5.55112e-17>,<-3,-0.995951,0.78877>}
+	triangle{<-2.21319,-0.995817,5.55112e-17>,<-3,-0.995951,0.78877>,<-2.21323,-0.995725,0.788784>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.21319,-0.995817,5.55112e-17>,<-3,-0.996043,5.55112e-17>,r}
+	sphere{<-3,-0.996043,5.55112e-17>,r}
+	cylinder{<-3,-0.996043,5.55112e-17>,<-3,-0.995951,0.78877>,r}
+	sphere{<-3,-0.995951,0.78877>,r}
+	cylinder{<-3,-0.995951,0.78877>,<-2.21323,-0.995725,0.788784>,r}
+	sphere{<-2.21323,-0.995725,0.788784>,r}
+	cylinder{<-2.21323,-0.995725,0.788784>,<-2.21319,-0.995817,5.55112e-17>,r}
+	sphere{<-2.21319,-0.995817,5.55112e-17>,r}
+	texture{t2}
+}
+union{
+	triangle{<-3,0.00782139,5.55112e-17>,<-2.21346,0.00781314,5.55112e-17>,<-2.21343,0.00783496,0.784157>}
+	triangle{<-3,0.00782139,5.55112e-17>,<-2.21343,0.00783496,0.784157>,<-3,0.00784346,0.793193>}
+	texture{t1}
+}
+union{
+	cylinder{<-3,0.00782139,5.55112e-17>,<-2.21346,0.00781314,5.55112e-17>,r}
+	sphere{<-2.21346,0.00781314,5.55112e-17>,r}
+	cylinder{<-2.21346,0.00781314,5.55112e-17>,<-2.21343,0.00783496,0.784157>,r}
+	sphere{<-2.21343,0.00783496,0.784157>,r}
+	cylinder{<-2.21343,0.00783496,0.784157>,<-3,0.00784346,0.793193>,r}
+	sphere{<-3,0.00784346,0.793193>,r}
+	cylinder{<-3,0.00784346,0.793193>,<-3,0.00782139,5.55112e-17>,r}
+	sphere{<-3,0.00782139,5.55112e-17>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.93672,-0.469043,1.05835>,<-1.92231,-0.493879,1.05036>,<-1.93882,-0.522359,1.05941>}
+	triangle{<-1.93672,-0.469043,1.05835>,<-1.93882,-0.522359,1.05941>,<-1.96598,-0.496097,1.07443>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.93672,-0.469043,1.05835>,<-1.92231,-0.493879,1.05036>,r}
+	sphere{<-1.92231,-0.493879,1.05036>,r}
+	cylinder{<-1.92231,-0.493879,1.05036>,<-1.93882,-0.522359,1.05941>,r}
+	sphere{<-1.93882,-0.522359,1.05941>,r}
+	cylinder{<-1.93882,-0.522359,1.05941>,<-1.96598,-0.496097,1.07443>,r}
+	sphere{<-1.96598,-0.496097,1.07443>,r}
+	cylinder{<-1.96598,-0.496097,1.07443>,<-1.93672,-0.469043,1.05835>,r}
+	sphere{<-1.93672,-0.469043,1.05835>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.01427,-1.33835,0.989153>,<-3,-1.69057,1.19492>,<-3,-0.995951,0.78877>}
+	triangle{<-2.01427,-1.33835,0.989153>,<-3,-0.995951,0.78877>,<-2.21323,-0.995725,0.788784>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.01427,-1.33835,0.989153>,<-3,-1.69057,1.19492>,r}
+	sphere{<-3,-1.69057,1.19492>,r}
+	cylinder{<-3,-1.69057,1.19492>,<-3,-0.995951,0.78877>,r}
+	sphere{<-3,-0.995951,0.78877>,r}
+	cylinder{<-3,-0.995951,0.78877>,<-2.21323,-0.995725,0.788784>,r}
+	sphere{<-2.21323,-0.995725,0.788784>,r}
+	cylinder{<-2.21323,-0.995725,0.788784>,<-2.01427,-1.33835,0.989153>,r}
+	sphere{<-2.01427,-1.33835,0.989153>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.34847,-0.493858,0>,<-1.05173,-1.0052,0>,<-1.05154,-1.00492,0.703022>}
+	triangle{<-1.34847,-0.493858,0>,<-1.05154,-1.00492,0.703022>,<-1.34809,-0.493727,0.904746>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.34847,-0.493858,0>,<-1.05173,-1.0052,0>,r}
+	sphere{<-1.05173,-1.0052,0>,r}
+	cylinder{<-1.05173,-1.0052,0>,<-1.05154,-1.00492,0.703022>,r}
+	sphere{<-1.05154,-1.00492,0.703022>,r}
+	cylinder{<-1.05154,-1.00492,0.703022>,<-1.34809,-0.493727,0.904746>,r}
+	sphere{<-1.34809,-0.493727,0.904746>,r}
+	cylinder{<-1.34809,-0.493727,0.904746>,<-1.34847,-0.493858,0>,r}
+	sphere{<-1.34847,-0.493858,0>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.92231,-0.493879,1.05036>,<-1.60044,-0.493777,1.08178>,<-1.78425,-0.899733,1.21575>}
+	triangle{<-1.92231,-0.493879,1.05036>,<-1.78425,-0.899733,1.21575>,<-1.93882,-0.522359,1.05941>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.92231,-0.493879,1.05036>,<-1.60044,-0.493777,1.08178>,r}
+	sphere{<-1.60044,-0.493777,1.08178>,r}
+	cylinder{<-1.60044,-0.493777,1.08178>,<-1.78425,-0.899733,1.21575>,r}
+	sphere{<-1.78425,-0.899733,1.21575>,r}
+	cylinder{<-1.78425,-0.899733,1.21575>,<-1.93882,-0.522359,1.05941>,r}
+	sphere{<-1.93882,-0.522359,1.05941>,r}
+	cylinder{<-1.93882,-0.522359,1.05941>,<-1.92231,-0.493879,1.05036>,r}
+	sphere{<-1.92231,-0.493879,1.05036>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.31545,-1.48461,0.8941>,<-1.32069,-1.49412,0.886294>,<-1.59252,-1.49552,1.08183>}
+	triangle{<-1.31545,-1.48461,0.8941>,<-1.59252,-1.49552,1.08183>,<-1.5921,-1.49001,1.08825>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.31545,-1.48461,0.8941>,<-1.32069,-1.49412,0.886294>,r}
+	sphere{<-1.32069,-1.49412,0.886294>,r}
+	cylinder{<-1.32069,-1.49412,0.886294>,<-1.59252,-1.49552,1.08183>,r}
+	sphere{<-1.59252,-1.49552,1.08183>,r}
+	cylinder{<-1.59252,-1.49552,1.08183>,<-1.5921,-1.49001,1.08825>,r}
+	sphere{<-1.5921,-1.49001,1.08825>,r}
+	cylinder{<-1.5921,-1.49001,1.08825>,<-1.31545,-1.48461,0.8941>,r}
+	sphere{<-1.31545,-1.48461,0.8941>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.7757,-1.13578,1.45274>,<-1.78425,-0.899733,1.21575>,<-1.7829,-1.26406,1.21931>}
+	triangle{<-1.7757,-1.13578,1.45274>,<-1.7829,-1.26406,1.21931>,<-1.77833,-1.26666,1.35881>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.7757,-1.13578,1.45274>,<-1.78425,-0.899733,1.21575>,r}
+	sphere{<-1.78425,-0.899733,1.21575>,r}
+	cylinder{<-1.78425,-0.899733,1.21575>,<-1.7829,-1.26406,1.21931>,r}
+	sphere{<-1.7829,-1.26406,1.21931>,r}
+	cylinder{<-1.7829,-1.26406,1.21931>,<-1.77833,-1.26666,1.35881>,r}
+	sphere{<-1.77833,-1.26666,1.35881>,r}
+	cylinder{<-1.77833,-1.26666,1.35881>,<-1.7757,-1.13578,1.45274>,r}
+	sphere{<-1.7757,-1.13578,1.45274>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.7757,-1.13578,1.45274>,<-1.77833,-1.26666,1.35881>,<-2.08412,-1.38468,1.71334>}
+	triangle{<-1.7757,-1.13578,1.45274>,<-2.08412,-1.38468,1.71334>,<-2.05797,-1.1152,1.87674>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.7757,-1.13578,1.45274>,<-1.77833,-1.26666,1.35881>,r}
+	sphere{<-1.77833,-1.26666,1.35881>,r}
+	cylinder{<-1.77833,-1.26666,1.35881>,<-2.08412,-1.38468,1.71334>,r}
+	sphere{<-2.08412,-1.38468,1.71334>,r}
+	cylinder{<-2.08412,-1.38468,1.71334>,<-2.05797,-1.1152,1.87674>,r}
+	sphere{<-2.05797,-1.1152,1.87674>,r}
+	cylinder{<-2.05797,-1.1152,1.87674>,<-1.7757,-1.13578,1.45274>,r}
+	sphere{<-1.7757,-1.13578,1.45274>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.44674,-0.48984,1.82713>,<-3,-0.484414,1.82214>,<-3,-0.485925,1.08039>}
+	triangle{<-2.44674,-0.48984,1.82713>,<-3,-0.485925,1.08039>,<-1.96598,-0.496097,1.07443>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.44674,-0.48984,1.82713>,<-3,-0.484414,1.82214>,r}
+	sphere{<-3,-0.484414,1.82214>,r}
+	cylinder{<-3,-0.484414,1.82214>,<-3,-0.485925,1.08039>,r}
+	sphere{<-3,-0.485925,1.08039>,r}
+	cylinder{<-3,-0.485925,1.08039>,<-1.96598,-0.496097,1.07443>,r}
+	sphere{<-1.96598,-0.496097,1.07443>,r}
+	cylinder{<-1.96598,-0.496097,1.07443>,<-2.44674,-0.48984,1.82713>,r}
+	sphere{<-2.44674,-0.48984,1.82713>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.44674,-0.48984,1.82713>,<-2.42076,-0.77158,2.08509>,<-3,-0.771611,2.08509>}
+	triangle{<-2.44674,-0.48984,1.82713>,<-3,-0.771611,2.08509>,<-3,-0.484414,1.82214>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.44674,-0.48984,1.82713>,<-2.42076,-0.77158,2.08509>,r}
+	sphere{<-2.42076,-0.77158,2.08509>,r}
+	cylinder{<-2.42076,-0.77158,2.08509>,<-3,-0.771611,2.08509>,r}
+	sphere{<-3,-0.771611,2.08509>,r}
+	cylinder{<-3,-0.771611,2.08509>,<-3,-0.484414,1.82214>,r}
+	sphere{<-3,-0.484414,1.82214>,r}
+	cylinder{<-3,-0.484414,1.82214>,<-2.44674,-0.48984,1.82713>,r}
+	sphere{<-2.44674,-0.48984,1.82713>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.448645,-1.99494,0.921333>,<-0.425468,-1.99998,0.900742>,<-0.430876,-2.0077,0.895066>}
+	triangle{<-0.448645,-1.99494,0.921333>,<-0.430876,-2.0077,0.895066>,<-0.4553,-2.00683,0.911534>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.448645,-1.99494,0.921333>,<-0.425468,-1.99998,0.900742>,r}
+	sphere{<-0.425468,-1.99998,0.900742>,r}
+	cylinder{<-0.425468,-1.99998,0.900742>,<-0.430876,-2.0077,0.895066>,r}
+	sphere{<-0.430876,-2.0077,0.895066>,r}
+	cylinder{<-0.430876,-2.0077,0.895066>,<-0.4553,-2.00683,0.911534>,r}
+	sphere{<-0.4553,-2.00683,0.911534>,r}
+	cylinder{<-0.4553,-2.00683,0.911534>,<-0.448645,-1.99494,0.921333>,r}
+	sphere{<-0.448645,-1.99494,0.921333>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.05815,0.00666559,0.718807>,<-0.535166,0.00576369,0.91726>,<-0.797485,-0.461559,1.11786>}
+	triangle{<-1.05815,0.00666559,0.718807>,<-0.797485,-0.461559,1.11786>,<-1.33606,-0.472971,0.921412>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.05815,0.00666559,0.718807>,<-0.535166,0.00576369,0.91726>,r}
+	sphere{<-0.535166,0.00576369,0.91726>,r}
+	cylinder{<-0.535166,0.00576369,0.91726>,<-0.797485,-0.461559,1.11786>,r}
+	sphere{<-0.797485,-0.461559,1.11786>,r}
+	cylinder{<-0.797485,-0.461559,1.11786>,<-1.33606,-0.472971,0.921412>,r}
+	sphere{<-1.33606,-0.472971,0.921412>,r}
+	cylinder{<-1.33606,-0.472971,0.921412>,<-1.05815,0.00666559,0.718807>,r}
+	sphere{<-1.05815,0.00666559,0.718807>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.134839,0.00548164,0>,<-0.085936,-0.124597,0>,<-0.086097,-0.124601,0.623973>}
+	triangle{<-0.134839,0.00548164,0>,<-0.086097,-0.124601,0.623973>,<-0.134915,0.00523367,0.649625>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.134839,0.00548164,0>,<-0.085936,-0.124597,0>,r}
+	sphere{<-0.085936,-0.124597,0>,r}
+	cylinder{<-0.085936,-0.124597,0>,<-0.086097,-0.124601,0.623973>,r}
+	sphere{<-0.086097,-0.124601,0.623973>,r}
+	cylinder{<-0.086097,-0.124601,0.623973>,<-0.134915,0.00523367,0.649625>,r}
+	sphere{<-0.134915,0.00523367,0.649625>,r}
+	cylinder{<-0.134915,0.00523367,0.649625>,<-0.134839,0.00548164,0>,r}
+	sphere{<-0.134839,0.00548164,0>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.274058,-0.411224,1.97968>,<-0.761264,-0.404631,1.84403>,<-0.398829,0.24347,1.3263>}
+	triangle{<-0.274058,-0.411224,1.97968>,<-0.398829,0.24347,1.3263>,<0.0708343,-0.0487173,1.72786>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.274058,-0.411224,1.97968>,<-0.761264,-0.404631,1.84403>,r}
+	sphere{<-0.761264,-0.404631,1.84403>,r}
+	cylinder{<-0.761264,-0.404631,1.84403>,<-0.398829,0.24347,1.3263>,r}
+	sphere{<-0.398829,0.24347,1.3263>,r}
+	cylinder{<-0.398829,0.24347,1.3263>,<0.0708343,-0.0487173,1.72786>,r}
+	sphere{<0.0708343,-0.0487173,1.72786>,r}
+	cylinder{<0.0708343,-0.0487173,1.72786>,<-0.274058,-0.411224,1.97968>,r}
+	sphere{<-0.274058,-0.411224,1.97968>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.108834,0.0873227,0.726719>,<-0.397098,0.248775,1.10488>,<-0.535166,0.00576369,0.91726>}
+	triangle{<-0.108834,0.0873227,0.726719>,<-0.535166,0.00576369,0.91726>,<-0.134915,0.00523367,0.649625>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.108834,0.0873227,0.726719>,<-0.397098,0.248775,1.10488>,r}
+	sphere{<-0.397098,0.248775,1.10488>,r}
+	cylinder{<-0.397098,0.248775,1.10488>,<-0.535166,0.00576369,0.91726>,r}
+	sphere{<-0.535166,0.00576369,0.91726>,r}
+	cylinder{<-0.535166,0.00576369,0.91726>,<-0.134915,0.00523367,0.649625>,r}
+	sphere{<-0.134915,0.00523367,0.649625>,r}
+	cylinder{<-0.134915,0.00523367,0.649625>,<-0.108834,0.0873227,0.726719>,r}
+	sphere{<-0.108834,0.0873227,0.726719>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.462536,-0.985459,0.926481>,<-0.696386,-1.47899,1.13814>,<-0.66261,-1.48315,1.62103>}
+	triangle{<-0.462536,-0.985459,0.926481>,<-0.66261,-1.48315,1.62103>,<-0.442448,-1.02623,1.4743>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.462536,-0.985459,0.926481>,<-0.696386,-1.47899,1.13814>,r}
+	sphere{<-0.696386,-1.47899,1.13814>,r}
+	cylinder{<-0.696386,-1.47899,1.13814>,<-0.66261,-1.48315,1.62103>,r}
+	sphere{<-0.66261,-1.48315,1.62103>,r}
+	cylinder{<-0.66261,-1.48315,1.62103>,<-0.442448,-1.02623,1.4743>,r}
+	sphere{<-0.442448,-1.02623,1.4743>,r}
+	cylinder{<-0.442448,-1.02623,1.4743>,<-0.462536,-0.985459,0.926481>,r}
+	sphere{<-0.462536,-0.985459,0.926481>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.0808264,-1.83151,1.91715>,<0.0276185,-1.83382,1.92878>,<-0.0766957,-1.64786,1.96193>}
+	triangle{<0.0808264,-1.83151,1.91715>,<-0.0766957,-1.64786,1.96193>,<0.0944892,-1.45627,1.93455>}
+	texture{t1}
+}
+union{
+	cylinder{<0.0808264,-1.83151,1.91715>,<0.0276185,-1.83382,1.92878>,r}
+	sphere{<0.0276185,-1.83382,1.92878>,r}
+	cylinder{<0.0276185,-1.83382,1.92878>,<-0.0766957,-1.64786,1.96193>,r}
+	sphere{<-0.0766957,-1.64786,1.96193>,r}
+	cylinder{<-0.0766957,-1.64786,1.96193>,<0.0944892,-1.45627,1.93455>,r}
+	sphere{<0.0944892,-1.45627,1.93455>,r}
+	cylinder{<0.0944892,-1.45627,1.93455>,<0.0808264,-1.83151,1.91715>,r}
+	sphere{<0.0808264,-1.83151,1.91715>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.0808264,-1.83151,1.91715>,<0.183055,-1.98547,1.7387>,<-0.0348803,-1.94883,1.83174>}
+	triangle{<0.0808264,-1.83151,1.91715>,<-0.0348803,-1.94883,1.83174>,<0.0276185,-1.83382,1.92878>}
+	texture{t1}
+}
+union{
+	cylinder{<0.0808264,-1.83151,1.91715>,<0.183055,-1.98547,1.7387>,r}
+	sphere{<0.183055,-1.98547,1.7387>,r}
+	cylinder{<0.183055,-1.98547,1.7387>,<-0.0348803,-1.94883,1.83174>,r}
+	sphere{<-0.0348803,-1.94883,1.83174>,r}
+	cylinder{<-0.0348803,-1.94883,1.83174>,<0.0276185,-1.83382,1.92878>,r}
+	sphere{<0.0276185,-1.83382,1.92878>,r}
+	cylinder{<0.0276185,-1.83382,1.92878>,<0.0808264,-1.83151,1.91715>,r}
+	sphere{<0.0808264,-1.83151,1.91715>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.234711,-0.942488,1.64031>,<0.287898,-0.993533,1.67549>,<0.221398,-1.05155,1.77509>}
+	triangle{<0.234711,-0.942488,1.64031>,<0.221398,-1.05155,1.77509>,<0.154492,-0.958479,1.69682>}
+	texture{t1}
+}
+union{
+	cylinder{<0.234711,-0.942488,1.64031>,<0.287898,-0.993533,1.67549>,r}
+	sphere{<0.287898,-0.993533,1.67549>,r}
+	cylinder{<0.287898,-0.993533,1.67549>,<0.221398,-1.05155,1.77509>,r}
+	sphere{<0.221398,-1.05155,1.77509>,r}
+	cylinder{<0.221398,-1.05155,1.77509>,<0.154492,-0.958479,1.69682>,r}
+	sphere{<0.154492,-0.958479,1.69682>,r}
+	cylinder{<0.154492,-0.958479,1.69682>,<0.234711,-0.942488,1.64031>,r}
+	sphere{<0.234711,-0.942488,1.64031>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.816661,-0.843368,0.625721>,<0.768309,-0.605469,0.586321>,<0.768351,-0.605404,0>}
+	triangle{<0.816661,-0.843368,0.625721>,<0.768351,-0.605404,0>,<0.863614,-1.07407,0>}
+	texture{t1}
+}
+union{
+	cylinder{<0.816661,-0.843368,0.625721>,<0.768309,-0.605469,0.586321>,r}
+	sphere{<0.768309,-0.605469,0.586321>,r}
+	cylinder{<0.768309,-0.605469,0.586321>,<0.768351,-0.605404,0>,r}
+	sphere{<0.768351,-0.605404,0>,r}
+	cylinder{<0.768351,-0.605404,0>,<0.863614,-1.07407,0>,r}
+	sphere{<0.863614,-1.07407,0>,r}
+	cylinder{<0.863614,-1.07407,0>,<0.816661,-0.843368,0.625721>,r}
+	sphere{<0.816661,-0.843368,0.625721>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.425521,-0.980721,0>,<-0.425615,-0.980382,0.893585>,<-0.0665192,-1.48754,0.577613>}
+	triangle{<-0.425521,-0.980721,0>,<-0.0665192,-1.48754,0.577613>,<-0.0665987,-1.48756,0>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.425521,-0.980721,0>,<-0.425615,-0.980382,0.893585>,r}
+	sphere{<-0.425615,-0.980382,0.893585>,r}
+	cylinder{<-0.425615,-0.980382,0.893585>,<-0.0665192,-1.48754,0.577613>,r}
+	sphere{<-0.0665192,-1.48754,0.577613>,r}
+	cylinder{<-0.0665192,-1.48754,0.577613>,<-0.0665987,-1.48756,0>,r}
+	sphere{<-0.0665987,-1.48756,0>,r}
+	cylinder{<-0.0665987,-1.48756,0>,<-0.425521,-0.980721,0>,r}
+	sphere{<-0.425521,-0.980721,0>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.0665192,-1.48754,0.577613>,<0.239667,-1.48843,0.66933>,<0.503361,-1.48922,5.55112e-17>}
+	triangle{<-0.0665192,-1.48754,0.577613>,<0.503361,-1.48922,5.55112e-17>,<-0.0665987,-1.48756,0>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.0665192,-1.48754,0.577613>,<0.239667,-1.48843,0.66933>,r}
+	sphere{<0.239667,-1.48843,0.66933>,r}
+	cylinder{<0.239667,-1.48843,0.66933>,<0.503361,-1.48922,5.55112e-17>,r}
+	sphere{<0.503361,-1.48922,5.55112e-17>,r}
+	cylinder{<0.503361,-1.48922,5.55112e-17>,<-0.0665987,-1.48756,0>,r}
+	sphere{<-0.0665987,-1.48756,0>,r}
+	cylinder{<-0.0665987,-1.48756,0>,<-0.0665192,-1.48754,0.577613>,r}
+	sphere{<-0.0665192,-1.48754,0.577613>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.278993,-0.33012,0.891036>,<0.201854,-0.907642,1.14393>,<-0.424514,-0.977605,0.896242>}
+	triangle{<0.278993,-0.33012,0.891036>,<-0.424514,-0.977605,0.896242>,<-0.086097,-0.124601,0.623973>}
+	texture{t1}
+}
+union{
+	cylinder{<0.278993,-0.33012,0.891036>,<0.201854,-0.907642,1.14393>,r}
+	sphere{<0.201854,-0.907642,1.14393>,r}
+	cylinder{<0.201854,-0.907642,1.14393>,<-0.424514,-0.977605,0.896242>,r}
+	sphere{<-0.424514,-0.977605,0.896242>,r}
+	cylinder{<-0.424514,-0.977605,0.896242>,<-0.086097,-0.124601,0.623973>,r}
+	sphere{<-0.086097,-0.124601,0.623973>,r}
+	cylinder{<-0.086097,-0.124601,0.623973>,<0.278993,-0.33012,0.891036>,r}
+	sphere{<0.278993,-0.33012,0.891036>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.3496,-0.209883,1.538>,<0.315359,-0.174678,1.0231>,<0.942535,0.0980355,1.18279>}
+	triangle{<0.3496,-0.209883,1.538>,<0.942535,0.0980355,1.18279>,<0.906622,0.0260303,1.74343>}
+	texture{t1}
+}
+union{
+	cylinder{<0.3496,-0.209883,1.538>,<0.315359,-0.174678,1.0231>,r}
+	sphere{<0.315359,-0.174678,1.0231>,r}
+	cylinder{<0.315359,-0.174678,1.0231>,<0.942535,0.0980355,1.18279>,r}
+	sphere{<0.942535,0.0980355,1.18279>,r}
+	cylinder{<0.942535,0.0980355,1.18279>,<0.906622,0.0260303,1.74343>,r}
+	sphere{<0.906622,0.0260303,1.74343>,r}
+	cylinder{<0.906622,0.0260303,1.74343>,<0.3496,-0.209883,1.538>,r}
+	sphere{<0.3496,-0.209883,1.538>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.969008,-0.0924176,1.79709>,<1.35885,-0.673828,1.46251>,<1.12823,-1.05081,1.55748>}
+	triangle{<0.969008,-0.0924176,1.79709>,<1.12823,-1.05081,1.55748>,<0.712651,-0.890841,1.84848>}
+	texture{t1}
+}
+union{
+	cylinder{<0.969008,-0.0924176,1.79709>,<1.35885,-0.673828,1.46251>,r}
+	sphere{<1.35885,-0.673828,1.46251>,r}
+	cylinder{<1.35885,-0.673828,1.46251>,<1.12823,-1.05081,1.55748>,r}
+	sphere{<1.12823,-1.05081,1.55748>,r}
+	cylinder{<1.12823,-1.05081,1.55748>,<0.712651,-0.890841,1.84848>,r}
+	sphere{<0.712651,-0.890841,1.84848>,r}
+	cylinder{<0.712651,-0.890841,1.84848>,<0.969008,-0.0924176,1.79709>,r}
+	sphere{<0.969008,-0.0924176,1.79709>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.08138,-0.589139,0.788478>,<2.00896,-0.438506,0.87545>,<1.9251,-0.593323,0.981835>}
+	triangle{<2.08138,-0.589139,0.788478>,<1.9251,-0.593323,0.981835>,<2.02525,-0.713092,0.860041>}
+	texture{t1}
+}
+union{
+	cylinder{<2.08138,-0.589139,0.788478>,<2.00896,-0.438506,0.87545>,r}
+	sphere{<2.00896,-0.438506,0.87545>,r}
+	cylinder{<2.00896,-0.438506,0.87545>,<1.9251,-0.593323,0.981835>,r}
+	sphere{<1.9251,-0.593323,0.981835>,r}
+	cylinder{<1.9251,-0.593323,0.981835>,<2.02525,-0.713092,0.860041>,r}
+	sphere{<2.02525,-0.713092,0.860041>,r}
+	cylinder{<2.02525,-0.713092,0.860041>,<2.08138,-0.589139,0.788478>,r}
+	sphere{<2.08138,-0.589139,0.788478>,r}
+	texture{t2}
+}
+union{
+	triangle{<3,-0.0892172,1.07702>,<3,-0.0892755,1.65979>,<2.20607,-0.0893575,1.6597>}
+	triangle{<3,-0.0892172,1.07702>,<2.20607,-0.0893575,1.6597>,<2.20156,-0.0892997,1.07704>}
+	texture{t1}
+}
+union{
+	cylinder{<3,-0.0892172,1.07702>,<3,-0.0892755,1.65979>,r}
+	sphere{<3,-0.0892755,1.65979>,r}
+	cylinder{<3,-0.0892755,1.65979>,<2.20607,-0.0893575,1.6597>,r}
+	sphere{<2.20607,-0.0893575,1.6597>,r}
+	cylinder{<2.20607,-0.0893575,1.6597>,<2.20156,-0.0892997,1.07704>,r}
+	sphere{<2.20156,-0.0892997,1.07704>,r}
+	cylinder{<2.20156,-0.0892997,1.07704>,<3,-0.0892172,1.07702>,r}
+	sphere{<3,-0.0892172,1.07702>,r}
+	texture{t2}
+}
+union{
+	triangle{<3,-1.21342,1.45241>,<3,-1.17053,1.12392>,<2.32812,-1.17042,1.12398>}
+	triangle{<3,-1.21342,1.45241>,<2.32812,-1.17042,1.12398>,<2.3234,-1.21331,1.45247>}
+	texture{t1}
+}
+union{
+	cylinder{<3,-1.21342,1.45241>,<3,-1.17053,1.12392>,r}
+	sphere{<3,-1.17053,1.12392>,r}
+	cylinder{<3,-1.17053,1.12392>,<2.32812,-1.17042,1.12398>,r}
+	sphere{<2.32812,-1.17042,1.12398>,r}
+	cylinder{<2.32812,-1.17042,1.12398>,<2.3234,-1.21331,1.45247>,r}
+	sphere{<2.3234,-1.21331,1.45247>,r}
+	cylinder{<2.3234,-1.21331,1.45247>,<3,-1.21342,1.45241>,r}
+	sphere{<3,-1.21342,1.45241>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.99284,-0.816349,1.84367>,<1.89413,-0.66035,1.71143>,<1.98235,-0.501619,1.88902>}
+	triangle{<1.99284,-0.816349,1.84367>,<1.98235,-0.501619,1.88902>,<2.06079,-0.673376,1.98459>}
+	texture{t1}
+}
+union{
+	cylinder{<1.99284,-0.816349,1.84367>,<1.89413,-0.66035,1.71143>,r}
+	sphere{<1.89413,-0.66035,1.71143>,r}
+	cylinder{<1.89413,-0.66035,1.71143>,<1.98235,-0.501619,1.88902>,r}
+	sphere{<1.98235,-0.501619,1.88902>,r}
+	cylinder{<1.98235,-0.501619,1.88902>,<2.06079,-0.673376,1.98459>,r}
+	sphere{<2.06079,-0.673376,1.98459>,r}
+	cylinder{<2.06079,-0.673376,1.98459>,<1.99284,-0.816349,1.84367>,r}
+	sphere{<1.99284,-0.816349,1.84367>,r}
+	texture{t2}
+}
+union{
+	triangle{<3,-1.79466,5.55112e-17>,<2.49702,-1.79465,5.55112e-17>,<2.49697,-1.79456,0.502824>}
+	triangle{<3,-1.79466,5.55112e-17>,<2.49697,-1.79456,0.502824>,<3,-1.79457,0.502855>}
+	texture{t1}
+}
+union{
+	cylinder{<3,-1.79466,5.55112e-17>,<2.49702,-1.79465,5.55112e-17>,r}
+	sphere{<2.49702,-1.79465,5.55112e-17>,r}
+	cylinder{<2.49702,-1.79465,5.55112e-17>,<2.49697,-1.79456,0.502824>,r}
+	sphere{<2.49697,-1.79456,0.502824>,r}
+	cylinder{<2.49697,-1.79456,0.502824>,<3,-1.79457,0.502855>,r}
+	sphere{<3,-1.79457,0.502855>,r}
+	cylinder{<3,-1.79457,0.502855>,<3,-1.79466,5.55112e-17>,r}
+	sphere{<3,-1.79466,5.55112e-17>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.32812,-1.17042,1.12398>,<2.11902,-1.41491,0.880633>,<1.83606,-1.13072,0.618444>}
+	triangle{<2.32812,-1.17042,1.12398>,<1.83606,-1.13072,0.618444>,<2.02525,-0.713092,0.860041>}
+	texture{t1}
+}
+union{
+	cylinder{<2.32812,-1.17042,1.12398>,<2.11902,-1.41491,0.880633>,r}
+	sphere{<2.11902,-1.41491,0.880633>,r}
+	cylinder{<2.11902,-1.41491,0.880633>,<1.83606,-1.13072,0.618444>,r}
+	sphere{<1.83606,-1.13072,0.618444>,r}
+	cylinder{<1.83606,-1.13072,0.618444>,<2.02525,-0.713092,0.860041>,r}
+	sphere{<2.02525,-0.713092,0.860041>,r}
+	cylinder{<2.02525,-0.713092,0.860041>,<2.32812,-1.17042,1.12398>,r}
+	sphere{<2.32812,-1.17042,1.12398>,r}
+	texture{t2}
+}
+union{
+	triangle{<3,-0.589182,5.55112e-17>,<3,-0.589214,0.788352>,<2.08138,-0.589139,0.788478>}
+	triangle{<3,-0.589182,5.55112e-17>,<2.08138,-0.589139,0.788478>,<2.08128,-0.589107,5.55112e-17>}
+	texture{t1}
+}
+union{
+	cylinder{<3,-0.589182,5.55112e-17>,<3,-0.589214,0.788352>,r}
+	sphere{<3,-0.589214,0.788352>,r}
+	cylinder{<3,-0.589214,0.788352>,<2.08138,-0.589139,0.788478>,r}
+	sphere{<2.08138,-0.589139,0.788478>,r}
+	cylinder{<2.08138,-0.589139,0.788478>,<2.08128,-0.589107,5.55112e-17>,r}
+	sphere{<2.08128,-0.589107,5.55112e-17>,r}
+	cylinder{<2.08128,-0.589107,5.55112e-17>,<3,-0.589182,5.55112e-17>,r}
+	sphere{<3,-0.589182,5.55112e-17>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.05379,-1.18421,1.32323>,<1.12823,-1.05081,1.55748>,<1.39005,-1.32631,1.83291>}
+	triangle{<1.05379,-1.18421,1.32323>,<1.39005,-1.32631,1.83291>,<1.31648,-1.84598,1.31576>}
+	texture{t1}
+}
+union{
+	cylinder{<1.05379,-1.18421,1.32323>,<1.12823,-1.05081,1.55748>,r}
+	sphere{<1.12823,-1.05081,1.55748>,r}
+	cylinder{<1.12823,-1.05081,1.55748>,<1.39005,-1.32631,1.83291>,r}
+	sphere{<1.39005,-1.32631,1.83291>,r}
+	cylinder{<1.39005,-1.32631,1.83291>,<1.31648,-1.84598,1.31576>,r}
+	sphere{<1.31648,-1.84598,1.31576>,r}
+	cylinder{<1.31648,-1.84598,1.31576>,<1.05379,-1.18421,1.32323>,r}
+	sphere{<1.05379,-1.18421,1.32323>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.38686,-0.642267,1.12902>,<1.9251,-0.593323,0.981835>,<1.89413,-0.66035,1.71143>}
+	triangle{<1.38686,-0.642267,1.12902>,<1.89413,-0.66035,1.71143>,<1.35885,-0.673828,1.46251>}
+	texture{t1}
+}
+union{
+	cylinder{<1.38686,-0.642267,1.12902>,<1.9251,-0.593323,0.981835>,r}
+	sphere{<1.9251,-0.593323,0.981835>,r}
+	cylinder{<1.9251,-0.593323,0.981835>,<1.89413,-0.66035,1.71143>,r}
+	sphere{<1.89413,-0.66035,1.71143>,r}
+	cylinder{<1.89413,-0.66035,1.71143>,<1.35885,-0.673828,1.46251>,r}
+	sphere{<1.35885,-0.673828,1.46251>,r}
+	cylinder{<1.35885,-0.673828,1.46251>,<1.38686,-0.642267,1.12902>,r}
+	sphere{<1.38686,-0.642267,1.12902>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.81819,-1.19201,1.96471>,<1.99284,-0.816349,1.84367>,<2.3234,-1.21331,1.45247>}
+	triangle{<1.81819,-1.19201,1.96471>,<2.3234,-1.21331,1.45247>,<2.09956,-1.52432,1.63253>}
+	texture{t1}
+}
+union{
+	cylinder{<1.81819,-1.19201,1.96471>,<1.99284,-0.816349,1.84367>,r}
+	sphere{<1.99284,-0.816349,1.84367>,r}
+	cylinder{<1.99284,-0.816349,1.84367>,<2.3234,-1.21331,1.45247>,r}
+	sphere{<2.3234,-1.21331,1.45247>,r}
+	cylinder{<2.3234,-1.21331,1.45247>,<2.09956,-1.52432,1.63253>,r}
+	sphere{<2.09956,-1.52432,1.63253>,r}
+	cylinder{<2.09956,-1.52432,1.63253>,<1.81819,-1.19201,1.96471>,r}
+	sphere{<1.81819,-1.19201,1.96471>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.88557,-0.181912,0.757347>,<2.05994,0.147814,0.940181>,<2.20156,-0.0892997,1.07704>}
+	triangle{<1.88557,-0.181912,0.757347>,<2.20156,-0.0892997,1.07704>,<2.00896,-0.438506,0.87545>}
+	texture{t1}
+}
+union{
+	cylinder{<1.88557,-0.181912,0.757347>,<2.05994,0.147814,0.940181>,r}
+	sphere{<2.05994,0.147814,0.940181>,r}
+	cylinder{<2.05994,0.147814,0.940181>,<2.20156,-0.0892997,1.07704>,r}
+	sphere{<2.20156,-0.0892997,1.07704>,r}
+	cylinder{<2.20156,-0.0892997,1.07704>,<2.00896,-0.438506,0.87545>,r}
+	sphere{<2.00896,-0.438506,0.87545>,r}
+	cylinder{<2.00896,-0.438506,0.87545>,<1.88557,-0.181912,0.757347>,r}
+	sphere{<1.88557,-0.181912,0.757347>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.06247,0.41464,1.46334>,<1.30431,0.563655,1.50356>,<1.3346,0.550154,1.5675>}
+	triangle{<1.06247,0.41464,1.46334>,<1.3346,0.550154,1.5675>,<0.952946,0.146905,1.8118>}
+	texture{t1}
+}
+union{
+	cylinder{<1.06247,0.41464,1.46334>,<1.30431,0.563655,1.50356>,r}
+	sphere{<1.30431,0.563655,1.50356>,r}
+	cylinder{<1.30431,0.563655,1.50356>,<1.3346,0.550154,1.5675>,r}
+	sphere{<1.3346,0.550154,1.5675>,r}
+	cylinder{<1.3346,0.550154,1.5675>,<0.952946,0.146905,1.8118>,r}
+	sphere{<0.952946,0.146905,1.8118>,r}
+	cylinder{<0.952946,0.146905,1.8118>,<1.06247,0.41464,1.46334>,r}
+	sphere{<1.06247,0.41464,1.46334>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.906622,0.0260303,1.74343>,<0.939392,0.112961,1.83209>,<1.00637,0.00250093,1.89646>}
+	triangle{<0.906622,0.0260303,1.74343>,<1.00637,0.00250093,1.89646>,<0.969008,-0.0924176,1.79709>}
+	texture{t1}
+}
+union{
+	cylinder{<0.906622,0.0260303,1.74343>,<0.939392,0.112961,1.83209>,r}
+	sphere{<0.939392,0.112961,1.83209>,r}
+	cylinder{<0.939392,0.112961,1.83209>,<1.00637,0.00250093,1.89646>,r}
+	sphere{<1.00637,0.00250093,1.89646>,r}
+	cylinder{<1.00637,0.00250093,1.89646>,<0.969008,-0.0924176,1.79709>,r}
+	sphere{<0.969008,-0.0924176,1.79709>,r}
+	cylinder{<0.969008,-0.0924176,1.79709>,<0.906622,0.0260303,1.74343>,r}
+	sphere{<0.906622,0.0260303,1.74343>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.98235,-0.501619,1.88902>,<1.83399,-0.256319,2.03732>,<2.06876,0.144048,1.7969>}
+	triangle{<1.98235,-0.501619,1.88902>,<2.06876,0.144048,1.7969>,<2.20607,-0.0893575,1.6597>}
+	texture{t1}
+}
+union{
+	cylinder{<1.98235,-0.501619,1.88902>,<1.83399,-0.256319,2.03732>,r}
+	sphere{<1.83399,-0.256319,2.03732>,r}
+	cylinder{<1.83399,-0.256319,2.03732>,<2.06876,0.144048,1.7969>,r}
+	sphere{<2.06876,0.144048,1.7969>,r}
+	cylinder{<2.06876,0.144048,1.7969>,<2.20607,-0.0893575,1.6597>,r}
+	sphere{<2.20607,-0.0893575,1.6597>,r}
+	cylinder{<2.20607,-0.0893575,1.6597>,<1.98235,-0.501619,1.88902>,r}
+	sphere{<1.98235,-0.501619,1.88902>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.71816,1.85607,-5.55112e-17>,<-2.04673,1.29629,0.950267>,<-2.21305,1.01307,0.785067>}
+	triangle{<-1.71816,1.85607,-5.55112e-17>,<-2.21305,1.01307,0.785067>,<-2.21312,1.0131,0>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.71816,1.85607,-5.55112e-17>,<-2.04673,1.29629,0.950267>,r}
+	sphere{<-2.04673,1.29629,0.950267>,r}
+	cylinder{<-2.04673,1.29629,0.950267>,<-2.21305,1.01307,0.785067>,r}
+	sphere{<-2.21305,1.01307,0.785067>,r}
+	cylinder{<-2.21305,1.01307,0.785067>,<-2.21312,1.0131,0>,r}
+	sphere{<-2.21312,1.0131,0>,r}
+	cylinder{<-2.21312,1.0131,0>,<-1.71816,1.85607,-5.55112e-17>,r}
+	sphere{<-1.71816,1.85607,-5.55112e-17>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.96123,0.575321,1.04022>,<-2.21305,1.01307,0.785067>,<-2.04673,1.29629,0.950267>}
+	triangle{<-1.96123,0.575321,1.04022>,<-2.04673,1.29629,0.950267>,<-1.95132,1.25031,1.04624>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.96123,0.575321,1.04022>,<-2.21305,1.01307,0.785067>,r}
+	sphere{<-2.21305,1.01307,0.785067>,r}
+	cylinder{<-2.21305,1.01307,0.785067>,<-2.04673,1.29629,0.950267>,r}
+	sphere{<-2.04673,1.29629,0.950267>,r}
+	cylinder{<-2.04673,1.29629,0.950267>,<-1.95132,1.25031,1.04624>,r}
+	sphere{<-1.95132,1.25031,1.04624>,r}
+	cylinder{<-1.95132,1.25031,1.04624>,<-1.96123,0.575321,1.04022>,r}
+	sphere{<-1.96123,0.575321,1.04022>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.05815,0.00666559,0.718807>,<-1.34615,0.507442,0.887647>,<-1.34603,0.507398,-5.55112e-17>}
+	triangle{<-1.05815,0.00666559,0.718807>,<-1.34603,0.507398,-5.55112e-17>,<-1.05823,0.00694024,-5.55112e-17>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.05815,0.00666559,0.718807>,<-1.34615,0.507442,0.887647>,r}
+	sphere{<-1.34615,0.507442,0.887647>,r}
+	cylinder{<-1.34615,0.507442,0.887647>,<-1.34603,0.507398,-5.55112e-17>,r}
+	sphere{<-1.34603,0.507398,-5.55112e-17>,r}
+	cylinder{<-1.34603,0.507398,-5.55112e-17>,<-1.05823,0.00694024,-5.55112e-17>,r}
+	sphere{<-1.05823,0.00694024,-5.55112e-17>,r}
+	cylinder{<-1.05823,0.00694024,-5.55112e-17>,<-1.05815,0.00666559,0.718807>,r}
+	sphere{<-1.05815,0.00666559,0.718807>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.93529,0.487085,1.05768>,<-1.92283,0.508558,1.03466>,<-1.48606,0.507716,0.979685>}
+	triangle{<-1.93529,0.487085,1.05768>,<-1.48606,0.507716,0.979685>,<-1.7989,0.334352,1.19265>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.93529,0.487085,1.05768>,<-1.92283,0.508558,1.03466>,r}
+	sphere{<-1.92283,0.508558,1.03466>,r}
+	cylinder{<-1.92283,0.508558,1.03466>,<-1.48606,0.507716,0.979685>,r}
+	sphere{<-1.48606,0.507716,0.979685>,r}
+	cylinder{<-1.48606,0.507716,0.979685>,<-1.7989,0.334352,1.19265>,r}
+	sphere{<-1.7989,0.334352,1.19265>,r}
+	cylinder{<-1.7989,0.334352,1.19265>,<-1.93529,0.487085,1.05768>,r}
+	sphere{<-1.93529,0.487085,1.05768>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.33606,-0.472971,0.921412>,<-1.34809,-0.493727,0.904746>,<-1.60044,-0.493777,1.08178>}
+	triangle{<-1.33606,-0.472971,0.921412>,<-1.60044,-0.493777,1.08178>,<-1.58799,-0.481806,1.08753>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.33606,-0.472971,0.921412>,<-1.34809,-0.493727,0.904746>,r}
+	sphere{<-1.34809,-0.493727,0.904746>,r}
+	cylinder{<-1.34809,-0.493727,0.904746>,<-1.60044,-0.493777,1.08178>,r}
+	sphere{<-1.60044,-0.493777,1.08178>,r}
+	cylinder{<-1.60044,-0.493777,1.08178>,<-1.58799,-0.481806,1.08753>,r}
+	sphere{<-1.58799,-0.481806,1.08753>,r}
+	cylinder{<-1.58799,-0.481806,1.08753>,<-1.33606,-0.472971,0.921412>,r}
+	sphere{<-1.33606,-0.472971,0.921412>,r}
+	texture{t2}
+}
+union{
+	triangle{<-3,1.01345,0.784876>,<-3,1.01349,-1.11022e-16>,<-2.21312,1.0131,0>}
+	triangle{<-3,1.01345,0.784876>,<-2.21312,1.0131,0>,<-2.21305,1.01307,0.785067>}
+	texture{t1}
+}
+union{
+	cylinder{<-3,1.01345,0.784876>,<-3,1.01349,-1.11022e-16>,r}
+	sphere{<-3,1.01349,-1.11022e-16>,r}
+	cylinder{<-3,1.01349,-1.11022e-16>,<-2.21312,1.0131,0>,r}
+	sphere{<-2.21312,1.0131,0>,r}
+	cylinder{<-2.21312,1.0131,0>,<-2.21305,1.01307,0.785067>,r}
+	sphere{<-2.21305,1.01307,0.785067>,r}
+	cylinder{<-2.21305,1.01307,0.785067>,<-3,1.01345,0.784876>,r}
+	sphere{<-3,1.01345,0.784876>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.96123,0.575321,1.04022>,<-1.92283,0.508558,1.03466>,<-1.93529,0.487085,1.05768>}
+	triangle{<-1.96123,0.575321,1.04022>,<-1.93529,0.487085,1.05768>,<-1.96663,0.516049,1.07477>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.96123,0.575321,1.04022>,<-1.92283,0.508558,1.03466>,r}
+	sphere{<-1.92283,0.508558,1.03466>,r}
+	cylinder{<-1.92283,0.508558,1.03466>,<-1.93529,0.487085,1.05768>,r}
+	sphere{<-1.93529,0.487085,1.05768>,r}
+	cylinder{<-1.93529,0.487085,1.05768>,<-1.96663,0.516049,1.07477>,r}
+	sphere{<-1.96663,0.516049,1.07477>,r}
+	cylinder{<-1.96663,0.516049,1.07477>,<-1.96123,0.575321,1.04022>,r}
+	sphere{<-1.96123,0.575321,1.04022>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.06228,0.728427,1.84175>,<-2.06062,1.04894,1.86822>,<-1.86625,1.06469,2.09129>}
+	triangle{<-2.06228,0.728427,1.84175>,<-1.86625,1.06469,2.09129>,<-1.8544,1.0253,2.10179>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.06228,0.728427,1.84175>,<-2.06062,1.04894,1.86822>,r}
+	sphere{<-2.06062,1.04894,1.86822>,r}
+	cylinder{<-2.06062,1.04894,1.86822>,<-1.86625,1.06469,2.09129>,r}
+	sphere{<-1.86625,1.06469,2.09129>,r}
+	cylinder{<-1.86625,1.06469,2.09129>,<-1.8544,1.0253,2.10179>,r}
+	sphere{<-1.8544,1.0253,2.10179>,r}
+	cylinder{<-1.8544,1.0253,2.10179>,<-2.06228,0.728427,1.84175>,r}
+	sphere{<-2.06228,0.728427,1.84175>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.8544,1.0253,2.10179>,<-1.86625,1.06469,2.09129>,<-1.54933,1.32239,2.0634>}
+	triangle{<-1.8544,1.0253,2.10179>,<-1.54933,1.32239,2.0634>,<-1.29902,1.00489,2.164>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.8544,1.0253,2.10179>,<-1.86625,1.06469,2.09129>,r}
+	sphere{<-1.86625,1.06469,2.09129>,r}
+	cylinder{<-1.86625,1.06469,2.09129>,<-1.54933,1.32239,2.0634>,r}
+	sphere{<-1.54933,1.32239,2.0634>,r}
+	cylinder{<-1.54933,1.32239,2.0634>,<-1.29902,1.00489,2.164>,r}
+	sphere{<-1.29902,1.00489,2.164>,r}
+	cylinder{<-1.29902,1.00489,2.164>,<-1.8544,1.0253,2.10179>,r}
+	sphere{<-1.8544,1.0253,2.10179>,r}
+	texture{t2}
+}
+union{
+	triangle{<-3,0.4247,1.90027>,<-3,0.50739,1.82366>,<-2.19537,0.515335,1.82418>}
+	triangle{<-3,0.4247,1.90027>,<-2.19537,0.515335,1.82418>,<-2.24332,0.424641,1.90773>}
+	texture{t1}
+}
+union{
+	cylinder{<-3,0.4247,1.90027>,<-3,0.50739,1.82366>,r}
+	sphere{<-3,0.50739,1.82366>,r}
+	cylinder{<-3,0.50739,1.82366>,<-2.19537,0.515335,1.82418>,r}
+	sphere{<-2.19537,0.515335,1.82418>,r}
+	cylinder{<-2.19537,0.515335,1.82418>,<-2.24332,0.424641,1.90773>,r}
+	sphere{<-2.24332,0.424641,1.90773>,r}
+	cylinder{<-2.24332,0.424641,1.90773>,<-3,0.4247,1.90027>,r}
+	sphere{<-3,0.4247,1.90027>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.7878,0.208445,1.56151>,<-1.79014,0.282239,1.53312>,<-1.7989,0.334352,1.19265>}
+	triangle{<-1.7878,0.208445,1.56151>,<-1.7989,0.334352,1.19265>,<-1.78809,-0.121555,1.20432>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.7878,0.208445,1.56151>,<-1.79014,0.282239,1.53312>,r}
+	sphere{<-1.79014,0.282239,1.53312>,r}
+	cylinder{<-1.79014,0.282239,1.53312>,<-1.7989,0.334352,1.19265>,r}
+	sphere{<-1.7989,0.334352,1.19265>,r}
+	cylinder{<-1.7989,0.334352,1.19265>,<-1.78809,-0.121555,1.20432>,r}
+	sphere{<-1.78809,-0.121555,1.20432>,r}
+	cylinder{<-1.78809,-0.121555,1.20432>,<-1.7878,0.208445,1.56151>,r}
+	sphere{<-1.7878,0.208445,1.56151>,r}
+	texture{t2}
+}
+union{
+	triangle{<-3,1.7724,1.22733>,<-2.43335,1.77236,1.22761>,<-2.42486,1.77115,1.24275>}
+	triangle{<-3,1.7724,1.22733>,<-2.42486,1.77115,1.24275>,<-3,1.73009,1.75529>}
+	texture{t1}
+}
+union{
+	cylinder{<-3,1.7724,1.22733>,<-2.43335,1.77236,1.22761>,r}
+	sphere{<-2.43335,1.77236,1.22761>,r}
+	cylinder{<-2.43335,1.77236,1.22761>,<-2.42486,1.77115,1.24275>,r}
+	sphere{<-2.42486,1.77115,1.24275>,r}
+	cylinder{<-2.42486,1.77115,1.24275>,<-3,1.73009,1.75529>,r}
+	sphere{<-3,1.73009,1.75529>,r}
+	cylinder{<-3,1.73009,1.75529>,<-3,1.7724,1.22733>,r}
+	sphere{<-3,1.7724,1.22733>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.404275,0.27521,1.11685>,<-1.06878,0.674732,1.08617>,<-0.965292,0.606829,1.77737>}
+	triangle{<-0.404275,0.27521,1.11685>,<-0.965292,0.606829,1.77737>,<-0.407257,0.275269,1.32614>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.404275,0.27521,1.11685>,<-1.06878,0.674732,1.08617>,r}
+	sphere{<-1.06878,0.674732,1.08617>,r}
+	cylinder{<-1.06878,0.674732,1.08617>,<-0.965292,0.606829,1.77737>,r}
+	sphere{<-0.965292,0.606829,1.77737>,r}
+	cylinder{<-0.965292,0.606829,1.77737>,<-0.407257,0.275269,1.32614>,r}
+	sphere{<-0.407257,0.275269,1.32614>,r}
+	cylinder{<-0.407257,0.275269,1.32614>,<-0.404275,0.27521,1.11685>,r}
+	sphere{<-0.404275,0.27521,1.11685>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.101644,0.718748,1.7556>,<-0.761168,0.88678,2.04661>,<-0.343476,1.55777,1.7129>}
+	triangle{<-0.101644,0.718748,1.7556>,<-0.343476,1.55777,1.7129>,<0.0822352,0.977396,1.61574>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.101644,0.718748,1.7556>,<-0.761168,0.88678,2.04661>,r}
+	sphere{<-0.761168,0.88678,2.04661>,r}
+	cylinder{<-0.761168,0.88678,2.04661>,<-0.343476,1.55777,1.7129>,r}
+	sphere{<-0.343476,1.55777,1.7129>,r}
+	cylinder{<-0.343476,1.55777,1.7129>,<0.0822352,0.977396,1.61574>,r}
+	sphere{<0.0822352,0.977396,1.61574>,r}
+	cylinder{<0.0822352,0.977396,1.61574>,<-0.101644,0.718748,1.7556>,r}
+	sphere{<-0.101644,0.718748,1.7556>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.398829,0.24347,1.3263>,<-0.407257,0.275269,1.32614>,<-0.404275,0.27521,1.11685>}
+	triangle{<-0.398829,0.24347,1.3263>,<-0.404275,0.27521,1.11685>,<-0.397098,0.248775,1.10488>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.398829,0.24347,1.3263>,<-0.407257,0.275269,1.32614>,r}
+	sphere{<-0.407257,0.275269,1.32614>,r}
+	cylinder{<-0.407257,0.275269,1.32614>,<-0.404275,0.27521,1.11685>,r}
+	sphere{<-0.404275,0.27521,1.11685>,r}
+	cylinder{<-0.404275,0.27521,1.11685>,<-0.397098,0.248775,1.10488>,r}
+	sphere{<-0.397098,0.248775,1.10488>,r}
+	cylinder{<-0.397098,0.248775,1.10488>,<-0.398829,0.24347,1.3263>,r}
+	sphere{<-0.398829,0.24347,1.3263>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.102157,0.996166,1.15028>,<-0.22047,0.532513,0.916717>,<-0.462862,1.00551,0.719907>}
+	triangle{<0.102157,0.996166,1.15028>,<-0.462862,1.00551,0.719907>,<-0.198477,1.4368,0.909974>}
+	texture{t1}
+}
+union{
+	cylinder{<0.102157,0.996166,1.15028>,<-0.22047,0.532513,0.916717>,r}
+	sphere{<-0.22047,0.532513,0.916717>,r}
+	cylinder{<-0.22047,0.532513,0.916717>,<-0.462862,1.00551,0.719907>,r}
+	sphere{<-0.462862,1.00551,0.719907>,r}
+	cylinder{<-0.462862,1.00551,0.719907>,<-0.198477,1.4368,0.909974>,r}
+	sphere{<-0.198477,1.4368,0.909974>,r}
+	cylinder{<-0.198477,1.4368,0.909974>,<0.102157,0.996166,1.15028>,r}
+	sphere{<0.102157,0.996166,1.15028>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.11781,0.289047,1.02629>,<0.929811,0.826881,0.0651549>,<0.547406,0.596372,0.799421>}
+	triangle{<1.11781,0.289047,1.02629>,<0.547406,0.596372,0.799421>,<1.01034,0.269907,1.13997>}
+	texture{t1}
+}
+union{
+	cylinder{<1.11781,0.289047,1.02629>,<0.929811,0.826881,0.0651549>,r}
+	sphere{<0.929811,0.826881,0.0651549>,r}
+	cylinder{<0.929811,0.826881,0.0651549>,<0.547406,0.596372,0.799421>,r}
+	sphere{<0.547406,0.596372,0.799421>,r}
+	cylinder{<0.547406,0.596372,0.799421>,<1.01034,0.269907,1.13997>,r}
+	sphere{<1.01034,0.269907,1.13997>,r}
+	cylinder{<1.01034,0.269907,1.13997>,<1.11781,0.289047,1.02629>,r}
+	sphere{<1.11781,0.289047,1.02629>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.0822352,0.977396,1.61574>,<0.25591,0.975584,1.69301>,<0.280005,0.519016,2.09191>}
+	triangle{<0.0822352,0.977396,1.61574>,<0.280005,0.519016,2.09191>,<-0.101644,0.718748,1.7556>}
+	texture{t1}
+}
+union{
+	cylinder{<0.0822352,0.977396,1.61574>,<0.25591,0.975584,1.69301>,r}
+	sphere{<0.25591,0.975584,1.69301>,r}
+	cylinder{<0.25591,0.975584,1.69301>,<0.280005,0.519016,2.09191>,r}
+	sphere{<0.280005,0.519016,2.09191>,r}
+	cylinder{<0.280005,0.519016,2.09191>,<-0.101644,0.718748,1.7556>,r}
+	sphere{<-0.101644,0.718748,1.7556>,r}
+	cylinder{<-0.101644,0.718748,1.7556>,<0.0822352,0.977396,1.61574>,r}
+	sphere{<0.0822352,0.977396,1.61574>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.83644,0.527626,1.15404>,<2.00414,0.733602,0.97523>,<2.19891,0.410501,0.788568>}
+	triangle{<1.83644,0.527626,1.15404>,<2.19891,0.410501,0.788568>,<2.05994,0.147814,0.940181>}
+	texture{t1}
+}
+union{
+	cylinder{<1.83644,0.527626,1.15404>,<2.00414,0.733602,0.97523>,r}
+	sphere{<2.00414,0.733602,0.97523>,r}
+	cylinder{<2.00414,0.733602,0.97523>,<2.19891,0.410501,0.788568>,r}
+	sphere{<2.19891,0.410501,0.788568>,r}
+	cylinder{<2.19891,0.410501,0.788568>,<2.05994,0.147814,0.940181>,r}
+	sphere{<2.05994,0.147814,0.940181>,r}
+	cylinder{<2.05994,0.147814,0.940181>,<1.83644,0.527626,1.15404>,r}
+	sphere{<1.83644,0.527626,1.15404>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.88557,-0.181912,0.757347>,<1.88558,-0.182103,5.55112e-17>,<1.23903,-0.0590588,0>}
+	triangle{<1.88557,-0.181912,0.757347>,<1.23903,-0.0590588,0>,<1.2392,-0.0588833,0.831019>}
+	texture{t1}
+}
+union{
+	cylinder{<1.88557,-0.181912,0.757347>,<1.88558,-0.182103,5.55112e-17>,r}
+	sphere{<1.88558,-0.182103,5.55112e-17>,r}
+	cylinder{<1.88558,-0.182103,5.55112e-17>,<1.23903,-0.0590588,0>,r}
+	sphere{<1.23903,-0.0590588,0>,r}
+	cylinder{<1.23903,-0.0590588,0>,<1.2392,-0.0588833,0.831019>,r}
+	sphere{<1.2392,-0.0588833,0.831019>,r}
+	cylinder{<1.2392,-0.0588833,0.831019>,<1.88557,-0.181912,0.757347>,r}
+	sphere{<1.88557,-0.181912,0.757347>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.06662,1.00942,5.55112e-17>,<1.87567,0.947144,5.55112e-17>,<1.87561,0.946903,0.848142>}
+	triangle{<1.06662,1.00942,5.55112e-17>,<1.87561,0.946903,0.848142>,<1.68884,0.961273,0.873814>}
+	texture{t1}
+}
+union{
+	cylinder{<1.06662,1.00942,5.55112e-17>,<1.87567,0.947144,5.55112e-17>,r}
+	sphere{<1.87567,0.947144,5.55112e-17>,r}
+	cylinder{<1.87567,0.947144,5.55112e-17>,<1.87561,0.946903,0.848142>,r}
+	sphere{<1.87561,0.946903,0.848142>,r}
+	cylinder{<1.87561,0.946903,0.848142>,<1.68884,0.961273,0.873814>,r}
+	sphere{<1.68884,0.961273,0.873814>,r}
+	cylinder{<1.68884,0.961273,0.873814>,<1.06662,1.00942,5.55112e-17>,r}
+	sphere{<1.06662,1.00942,5.55112e-17>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.19906,0.410563,0>,<2.19891,0.410501,0.788568>,<3,0.410882,0.788371>}
+	triangle{<2.19906,0.410563,0>,<3,0.410882,0.788371>,<3,0.410945,5.55112e-17>}
+	texture{t1}
+}
+union{
+	cylinder{<2.19906,0.410563,0>,<2.19891,0.410501,0.788568>,r}
+	sphere{<2.19891,0.410501,0.788568>,r}
+	cylinder{<2.19891,0.410501,0.788568>,<3,0.410882,0.788371>,r}
+	sphere{<3,0.410882,0.788371>,r}
+	cylinder{<3,0.410882,0.788371>,<3,0.410945,5.55112e-17>,r}
+	sphere{<3,0.410945,5.55112e-17>,r}
+	cylinder{<3,0.410945,5.55112e-17>,<2.19906,0.410563,0>,r}
+	sphere{<2.19906,0.410563,0>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.36795,1.04118,1.15264>,<2.00414,0.733602,0.97523>,<1.87561,0.946903,0.848142>}
+	triangle{<2.36795,1.04118,1.15264>,<1.87561,0.946903,0.848142>,<2.08597,1.20835,0.933989>}
+	texture{t1}
+}
+union{
+	cylinder{<2.36795,1.04118,1.15264>,<2.00414,0.733602,0.97523>,r}
+	sphere{<2.00414,0.733602,0.97523>,r}
+	cylinder{<2.00414,0.733602,0.97523>,<1.87561,0.946903,0.848142>,r}
+	sphere{<1.87561,0.946903,0.848142>,r}
+	cylinder{<1.87561,0.946903,0.848142>,<2.08597,1.20835,0.933989>,r}
+	sphere{<2.08597,1.20835,0.933989>,r}
+	cylinder{<2.08597,1.20835,0.933989>,<2.36795,1.04118,1.15264>,r}
+	sphere{<2.36795,1.04118,1.15264>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.09357,0.609993,1.82742>,<2.21577,0.398661,1.94659>,<2.06876,0.144048,1.7969>}
+	triangle{<2.09357,0.609993,1.82742>,<2.06876,0.144048,1.7969>,<1.88142,0.457715,1.61407>}
+	texture{t1}
+}
+union{
+	cylinder{<2.09357,0.609993,1.82742>,<2.21577,0.398661,1.94659>,r}
+	sphere{<2.21577,0.398661,1.94659>,r}
+	cylinder{<2.21577,0.398661,1.94659>,<2.06876,0.144048,1.7969>,r}
+	sphere{<2.06876,0.144048,1.7969>,r}
+	cylinder{<2.06876,0.144048,1.7969>,<1.88142,0.457715,1.61407>,r}
+	sphere{<1.88142,0.457715,1.61407>,r}
+	cylinder{<1.88142,0.457715,1.61407>,<2.09357,0.609993,1.82742>,r}
+	sphere{<2.09357,0.609993,1.82742>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.84923,3,1.09521>,<-1.70498,3,0.987495>,<-1.70497,2.68196,0.987495>}
+	triangle{<-1.84923,3,1.09521>,<-1.70497,2.68196,0.987495>,<-1.84929,2.62433,1.09525>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.84923,3,1.09521>,<-1.70498,3,0.987495>,r}
+	sphere{<-1.70498,3,0.987495>,r}
+	cylinder{<-1.70498,3,0.987495>,<-1.70497,2.68196,0.987495>,r}
+	sphere{<-1.70497,2.68196,0.987495>,r}
+	cylinder{<-1.70497,2.68196,0.987495>,<-1.84929,2.62433,1.09525>,r}
+	sphere{<-1.84929,2.62433,1.09525>,r}
+	cylinder{<-1.84929,2.62433,1.09525>,<-1.84923,3,1.09521>,r}
+	sphere{<-1.84923,3,1.09521>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.73026,1.88269,0>,<-3,2.11795,0>,<-3,2.11801,0.881562>}
+	triangle{<-1.73026,1.88269,0>,<-3,2.11801,0.881562>,<-2.39614,2.00613,0.993753>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.73026,1.88269,0>,<-3,2.11795,0>,r}
+	sphere{<-3,2.11795,0>,r}
+	cylinder{<-3,2.11795,0>,<-3,2.11801,0.881562>,r}
+	sphere{<-3,2.11801,0.881562>,r}
+	cylinder{<-3,2.11801,0.881562>,<-2.39614,2.00613,0.993753>,r}
+	sphere{<-2.39614,2.00613,0.993753>,r}
+	cylinder{<-2.39614,2.00613,0.993753>,<-1.73026,1.88269,0>,r}
+	sphere{<-1.73026,1.88269,0>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.70489,3,0>,<-1.70489,1.90767,0>,<-1.70497,2.68196,0.987495>}
+	triangle{<-1.70489,3,0>,<-1.70497,2.68196,0.987495>,<-1.70498,3,0.987495>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.70489,3,0>,<-1.70489,1.90767,0>,r}
+	sphere{<-1.70489,1.90767,0>,r}
+	cylinder{<-1.70489,1.90767,0>,<-1.70497,2.68196,0.987495>,r}
+	sphere{<-1.70497,2.68196,0.987495>,r}
+	cylinder{<-1.70497,2.68196,0.987495>,<-1.70498,3,0.987495>,r}
+	sphere{<-1.70498,3,0.987495>,r}
+	cylinder{<-1.70498,3,0.987495>,<-1.70489,3,0>,r}
+	sphere{<-1.70489,3,0>,r}
+	texture{t2}
+}
+union{
+	triangle{<-3,2.11801,0.881562>,<-2.39614,2.00613,0.993753>,<-2.43335,1.77236,1.22761>}
+	triangle{<-3,2.11801,0.881562>,<-2.43335,1.77236,1.22761>,<-3,1.7724,1.22733>}
+	texture{t1}
+}
+union{
+	cylinder{<-3,2.11801,0.881562>,<-2.39614,2.00613,0.993753>,r}
+	sphere{<-2.39614,2.00613,0.993753>,r}
+	cylinder{<-2.39614,2.00613,0.993753>,<-2.43335,1.77236,1.22761>,r}
+	sphere{<-2.43335,1.77236,1.22761>,r}
+	cylinder{<-2.43335,1.77236,1.22761>,<-3,1.7724,1.22733>,r}
+	sphere{<-3,1.7724,1.22733>,r}
+	cylinder{<-3,1.7724,1.22733>,<-3,2.11801,0.881562>,r}
+	sphere{<-3,2.11801,0.881562>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.4456,1.82018,1.62099>,<-1.21165,1.88255,1.47292>,<-1.11753,1.60278,1.33726>}
+	triangle{<-1.4456,1.82018,1.62099>,<-1.11753,1.60278,1.33726>,<-1.45609,1.6729,1.59156>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.4456,1.82018,1.62099>,<-1.21165,1.88255,1.47292>,r}
+	sphere{<-1.21165,1.88255,1.47292>,r}
+	cylinder{<-1.21165,1.88255,1.47292>,<-1.11753,1.60278,1.33726>,r}
+	sphere{<-1.11753,1.60278,1.33726>,r}
+	cylinder{<-1.11753,1.60278,1.33726>,<-1.45609,1.6729,1.59156>,r}
+	sphere{<-1.45609,1.6729,1.59156>,r}
+	cylinder{<-1.45609,1.6729,1.59156>,<-1.4456,1.82018,1.62099>,r}
+	sphere{<-1.4456,1.82018,1.62099>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.03722,2.40217,1.98266>,<-3,1.85631,1.98234>,<-3,3,1.98333>}
+	triangle{<-2.03722,2.40217,1.98266>,<-3,3,1.98333>,<-2.03726,3,1.98318>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.03722,2.40217,1.98266>,<-3,1.85631,1.98234>,r}
+	sphere{<-3,1.85631,1.98234>,r}
+	cylinder{<-3,1.85631,1.98234>,<-3,3,1.98333>,r}
+	sphere{<-3,3,1.98333>,r}
+	cylinder{<-3,3,1.98333>,<-2.03726,3,1.98318>,r}
+	sphere{<-2.03726,3,1.98318>,r}
+	cylinder{<-2.03726,3,1.98318>,<-2.03722,2.40217,1.98266>,r}
+	sphere{<-2.03722,2.40217,1.98266>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.590328,3,1.06961>,<-0.590355,2.11428,0.628044>,<-0.590316,2.11432,0>}
+	triangle{<-0.590328,3,1.06961>,<-0.590316,2.11432,0>,<-0.590263,3,0>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.590328,3,1.06961>,<-0.590355,2.11428,0.628044>,r}
+	sphere{<-0.590355,2.11428,0.628044>,r}
+	cylinder{<-0.590355,2.11428,0.628044>,<-0.590316,2.11432,0>,r}
+	sphere{<-0.590316,2.11432,0>,r}
+	cylinder{<-0.590316,2.11432,0>,<-0.590263,3,0>,r}
+	sphere{<-0.590263,3,0>,r}
+	cylinder{<-0.590263,3,0>,<-0.590328,3,1.06961>,r}
+	sphere{<-0.590328,3,1.06961>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.0842946,1.76898,0.753389>,<-0.105826,1.78367,0.777611>,<0.0600476,2.11391,1.04987>}
+	triangle{<-0.0842946,1.76898,0.753389>,<0.0600476,2.11391,1.04987>,<0.180503,2.05174,0.935062>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.0842946,1.76898,0.753389>,<-0.105826,1.78367,0.777611>,r}
+	sphere{<-0.105826,1.78367,0.777611>,r}
+	cylinder{<-0.105826,1.78367,0.777611>,<0.0600476,2.11391,1.04987>,r}
+	sphere{<0.0600476,2.11391,1.04987>,r}
+	cylinder{<0.0600476,2.11391,1.04987>,<0.180503,2.05174,0.935062>,r}
+	sphere{<0.180503,2.05174,0.935062>,r}
+	cylinder{<0.180503,2.05174,0.935062>,<-0.0842946,1.76898,0.753389>,r}
+	sphere{<-0.0842946,1.76898,0.753389>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.64196,2.54593,0>,<0.642002,2.54541,0.494318>,<0.641993,3,0.49378>}
+	triangle{<0.64196,2.54593,0>,<0.641993,3,0.49378>,<0.641951,3,0>}
+	texture{t1}
+}
+union{
+	cylinder{<0.64196,2.54593,0>,<0.642002,2.54541,0.494318>,r}
+	sphere{<0.642002,2.54541,0.494318>,r}
+	cylinder{<0.642002,2.54541,0.494318>,<0.641993,3,0.49378>,r}
+	sphere{<0.641993,3,0.49378>,r}
+	cylinder{<0.641993,3,0.49378>,<0.641951,3,0>,r}
+	sphere{<0.641951,3,0>,r}
+	cylinder{<0.641951,3,0>,<0.64196,2.54593,0>,r}
+	sphere{<0.64196,2.54593,0>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.11753,1.60278,1.33726>,<-1.02035,1.52158,1.33062>,<-1.0398,1.51262,1.2027>}
+	triangle{<-1.11753,1.60278,1.33726>,<-1.0398,1.51262,1.2027>,<-1.06555,1.53198,1.19335>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.11753,1.60278,1.33726>,<-1.02035,1.52158,1.33062>,r}
+	sphere{<-1.02035,1.52158,1.33062>,r}
+	cylinder{<-1.02035,1.52158,1.33062>,<-1.0398,1.51262,1.2027>,r}
+	sphere{<-1.0398,1.51262,1.2027>,r}
+	cylinder{<-1.0398,1.51262,1.2027>,<-1.06555,1.53198,1.19335>,r}
+	sphere{<-1.06555,1.53198,1.19335>,r}
+	cylinder{<-1.06555,1.53198,1.19335>,<-1.11753,1.60278,1.33726>,r}
+	sphere{<-1.11753,1.60278,1.33726>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.35987,1.58377,1.68004>,<-0.285067,1.54747,1.00385>,<-1.0398,1.51262,1.2027>}
+	triangle{<-0.35987,1.58377,1.68004>,<-1.0398,1.51262,1.2027>,<-1.02035,1.52158,1.33062>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.35987,1.58377,1.68004>,<-0.285067,1.54747,1.00385>,r}
+	sphere{<-0.285067,1.54747,1.00385>,r}
+	cylinder{<-0.285067,1.54747,1.00385>,<-1.0398,1.51262,1.2027>,r}
+	sphere{<-1.0398,1.51262,1.2027>,r}
+	cylinder{<-1.0398,1.51262,1.2027>,<-1.02035,1.52158,1.33062>,r}
+	sphere{<-1.02035,1.52158,1.33062>,r}
+	cylinder{<-1.02035,1.52158,1.33062>,<-0.35987,1.58377,1.68004>,r}
+	sphere{<-0.35987,1.58377,1.68004>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.20777,2.29467,1.11824>,<-1.70497,2.68196,0.987495>,<-1.70498,3,0.987495>}
+	triangle{<-1.20777,2.29467,1.11824>,<-1.70498,3,0.987495>,<-0.821869,3,1.21971>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.20777,2.29467,1.11824>,<-1.70497,2.68196,0.987495>,r}
+	sphere{<-1.70497,2.68196,0.987495>,r}
+	cylinder{<-1.70497,2.68196,0.987495>,<-1.70498,3,0.987495>,r}
+	sphere{<-1.70498,3,0.987495>,r}
+	cylinder{<-1.70498,3,0.987495>,<-0.821869,3,1.21971>,r}
+	sphere{<-0.821869,3,1.21971>,r}
+	cylinder{<-0.821869,3,1.21971>,<-1.20777,2.29467,1.11824>,r}
+	sphere{<-1.20777,2.29467,1.11824>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.08634,1.05925,0.935324>,<-1.25664,1.35576,0.959953>,<-1.06555,1.53198,1.19335>}
+	triangle{<-1.08634,1.05925,0.935324>,<-1.06555,1.53198,1.19335>,<-1.0398,1.51262,1.2027>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.08634,1.05925,0.935324>,<-1.25664,1.35576,0.959953>,r}
+	sphere{<-1.25664,1.35576,0.959953>,r}
+	cylinder{<-1.25664,1.35576,0.959953>,<-1.06555,1.53198,1.19335>,r}
+	sphere{<-1.06555,1.53198,1.19335>,r}
+	cylinder{<-1.06555,1.53198,1.19335>,<-1.0398,1.51262,1.2027>,r}
+	sphere{<-1.0398,1.51262,1.2027>,r}
+	cylinder{<-1.0398,1.51262,1.2027>,<-1.08634,1.05925,0.935324>,r}
+	sphere{<-1.08634,1.05925,0.935324>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.05626,1.00688,0.894083>,<-0.462862,1.00551,0.719907>,<-0.462868,1.00548,0>}
+	triangle{<-1.05626,1.00688,0.894083>,<-0.462868,1.00548,0>,<-1.05613,1.00685,0>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.05626,1.00688,0.894083>,<-0.462862,1.00551,0.719907>,r}
+	sphere{<-0.462862,1.00551,0.719907>,r}
+	cylinder{<-0.462862,1.00551,0.719907>,<-0.462868,1.00548,0>,r}
+	sphere{<-0.462868,1.00548,0>,r}
+	cylinder{<-0.462868,1.00548,0>,<-1.05613,1.00685,0>,r}
+	sphere{<-1.05613,1.00685,0>,r}
+	cylinder{<-1.05613,1.00685,0>,<-1.05626,1.00688,0.894083>,r}
+	sphere{<-1.05626,1.00688,0.894083>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.51756,1.81025,0.111117>,<-1.07003,1.95698,0.860582>,<-1.06555,1.53198,1.19335>}
+	triangle{<-1.51756,1.81025,0.111117>,<-1.06555,1.53198,1.19335>,<-1.25664,1.35576,0.959953>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.51756,1.81025,0.111117>,<-1.07003,1.95698,0.860582>,r}
+	sphere{<-1.07003,1.95698,0.860582>,r}
+	cylinder{<-1.07003,1.95698,0.860582>,<-1.06555,1.53198,1.19335>,r}
+	sphere{<-1.06555,1.53198,1.19335>,r}
+	cylinder{<-1.06555,1.53198,1.19335>,<-1.25664,1.35576,0.959953>,r}
+	sphere{<-1.25664,1.35576,0.959953>,r}
+	cylinder{<-1.25664,1.35576,0.959953>,<-1.51756,1.81025,0.111117>,r}
+	sphere{<-1.51756,1.81025,0.111117>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.953845,1.03624,0>,<-0.061112,1.66087,0>,<-0.0608504,1.66131,0.733303>}
+	triangle{<0.953845,1.03624,0>,<-0.0608504,1.66131,0.733303>,<0.478631,1.3294,0.85594>}
+	texture{t1}
+}
+union{
+	cylinder{<0.953845,1.03624,0>,<-0.061112,1.66087,0>,r}
+	sphere{<-0.061112,1.66087,0>,r}
+	cylinder{<-0.061112,1.66087,0>,<-0.0608504,1.66131,0.733303>,r}
+	sphere{<-0.0608504,1.66131,0.733303>,r}
+	cylinder{<-0.0608504,1.66131,0.733303>,<0.478631,1.3294,0.85594>,r}
+	sphere{<0.478631,1.3294,0.85594>,r}
+	cylinder{<0.478631,1.3294,0.85594>,<0.953845,1.03624,0>,r}
+	sphere{<0.953845,1.03624,0>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.061112,1.66087,0>,<-0.0847446,1.76936,-5.55112e-17>,<-0.0842946,1.76898,0.753389>}
+	triangle{<-0.061112,1.66087,0>,<-0.0842946,1.76898,0.753389>,<-0.0608504,1.66131,0.733303>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.061112,1.66087,0>,<-0.0847446,1.76936,-5.55112e-17>,r}
+	sphere{<-0.0847446,1.76936,-5.55112e-17>,r}
+	cylinder{<-0.0847446,1.76936,-5.55112e-17>,<-0.0842946,1.76898,0.753389>,r}
+	sphere{<-0.0842946,1.76898,0.753389>,r}
+	cylinder{<-0.0842946,1.76898,0.753389>,<-0.0608504,1.66131,0.733303>,r}
+	sphere{<-0.0608504,1.66131,0.733303>,r}
+	cylinder{<-0.0608504,1.66131,0.733303>,<-0.061112,1.66087,0>,r}
+	sphere{<-0.061112,1.66087,0>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.23509,1.91745,0>,<1.02276,1.06669,0>,<1.18734,1.72908,1.00323>}
+	triangle{<1.23509,1.91745,0>,<1.18734,1.72908,1.00323>,<1.23434,1.91731,0.971534>}
+	texture{t1}
+}
+union{
+	cylinder{<1.23509,1.91745,0>,<1.02276,1.06669,0>,r}
+	sphere{<1.02276,1.06669,0>,r}
+	cylinder{<1.02276,1.06669,0>,<1.18734,1.72908,1.00323>,r}
+	sphere{<1.18734,1.72908,1.00323>,r}
+	cylinder{<1.18734,1.72908,1.00323>,<1.23434,1.91731,0.971534>,r}
+	sphere{<1.23434,1.91731,0.971534>,r}
+	cylinder{<1.23434,1.91731,0.971534>,<1.23509,1.91745,0>,r}
+	sphere{<1.23509,1.91745,0>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.642002,2.54541,0.494318>,<1.12858,2.02933,1.01291>,<0.847338,1.86862,1.14856>}
+	triangle{<0.642002,2.54541,0.494318>,<0.847338,1.86862,1.14856>,<0.180503,2.05174,0.935062>}
+	texture{t1}
+}
+union{
+	cylinder{<0.642002,2.54541,0.494318>,<1.12858,2.02933,1.01291>,r}
+	sphere{<1.12858,2.02933,1.01291>,r}
+	cylinder{<1.12858,2.02933,1.01291>,<0.847338,1.86862,1.14856>,r}
+	sphere{<0.847338,1.86862,1.14856>,r}
+	cylinder{<0.847338,1.86862,1.14856>,<0.180503,2.05174,0.935062>,r}
+	sphere{<0.180503,2.05174,0.935062>,r}
+	cylinder{<0.180503,2.05174,0.935062>,<0.642002,2.54541,0.494318>,r}
+	sphere{<0.642002,2.54541,0.494318>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.9359,3,0>,<1.93593,2.1636,0>,<1.93586,2.16367,0.721027>}
+	triangle{<1.9359,3,0>,<1.93586,2.16367,0.721027>,<1.93583,3,0.720905>}
+	texture{t1}
+}
+union{
+	cylinder{<1.9359,3,0>,<1.93593,2.1636,0>,r}
+	sphere{<1.93593,2.1636,0>,r}
+	cylinder{<1.93593,2.1636,0>,<1.93586,2.16367,0.721027>,r}
+	sphere{<1.93586,2.16367,0.721027>,r}
+	cylinder{<1.93586,2.16367,0.721027>,<1.93583,3,0.720905>,r}
+	sphere{<1.93583,3,0.720905>,r}
+	cylinder{<1.93583,3,0.720905>,<1.9359,3,0>,r}
+	sphere{<1.9359,3,0>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.23434,1.91731,0.971534>,<1.12858,2.02933,1.01291>,<1.27644,2.30175,1.17>}
+	triangle{<1.23434,1.91731,0.971534>,<1.27644,2.30175,1.17>,<1.46236,1.99741,1.04346>}
+	texture{t1}
+}
+union{
+	cylinder{<1.23434,1.91731,0.971534>,<1.12858,2.02933,1.01291>,r}
+	sphere{<1.12858,2.02933,1.01291>,r}
+	cylinder{<1.12858,2.02933,1.01291>,<1.27644,2.30175,1.17>,r}
+	sphere{<1.27644,2.30175,1.17>,r}
+	cylinder{<1.27644,2.30175,1.17>,<1.46236,1.99741,1.04346>,r}
+	sphere{<1.46236,1.99741,1.04346>,r}
+	cylinder{<1.46236,1.99741,1.04346>,<1.23434,1.91731,0.971534>,r}
+	sphere{<1.23434,1.91731,0.971534>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.06489,2.67715,1.87523>,<1.01688,3,1.92578>,<1.23632,3,1.69559>}
+	triangle{<1.06489,2.67715,1.87523>,<1.23632,3,1.69559>,<1.23616,2.69518,1.69558>}
+	texture{t1}
+}
+union{
+	cylinder{<1.06489,2.67715,1.87523>,<1.01688,3,1.92578>,r}
+	sphere{<1.01688,3,1.92578>,r}
+	cylinder{<1.01688,3,1.92578>,<1.23632,3,1.69559>,r}
+	sphere{<1.23632,3,1.69559>,r}
+	cylinder{<1.23632,3,1.69559>,<1.23616,2.69518,1.69558>,r}
+	sphere{<1.23616,2.69518,1.69558>,r}
+	cylinder{<1.23616,2.69518,1.69558>,<1.06489,2.67715,1.87523>,r}
+	sphere{<1.06489,2.67715,1.87523>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.06489,2.67715,1.87523>,<0.619034,2.24844,1.87888>,<0.72654,3,1.9661>}
+	triangle{<1.06489,2.67715,1.87523>,<0.72654,3,1.9661>,<1.01688,3,1.92578>}
+	texture{t1}
+}
+union{
+	cylinder{<1.06489,2.67715,1.87523>,<0.619034,2.24844,1.87888>,r}
+	sphere{<0.619034,2.24844,1.87888>,r}
+	cylinder{<0.619034,2.24844,1.87888>,<0.72654,3,1.9661>,r}
+	sphere{<0.72654,3,1.9661>,r}
+	cylinder{<0.72654,3,1.9661>,<1.01688,3,1.92578>,r}
+	sphere{<1.01688,3,1.92578>,r}
+	cylinder{<1.01688,3,1.92578>,<1.06489,2.67715,1.87523>,r}
+	sphere{<1.06489,2.67715,1.87523>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.27644,2.30175,1.17>,<1.23616,2.69518,1.69558>,<1.23632,3,1.69559>}
+	triangle{<1.27644,2.30175,1.17>,<1.23632,3,1.69559>,<1.27684,3,1.16961>}
+	texture{t1}
+}
+union{
+	cylinder{<1.27644,2.30175,1.17>,<1.23616,2.69518,1.69558>,r}
+	sphere{<1.23616,2.69518,1.69558>,r}
+	cylinder{<1.23616,2.69518,1.69558>,<1.23632,3,1.69559>,r}
+	sphere{<1.23632,3,1.69559>,r}
+	cylinder{<1.23632,3,1.69559>,<1.27684,3,1.16961>,r}
+	sphere{<1.27684,3,1.16961>,r}
+	cylinder{<1.27684,3,1.16961>,<1.27644,2.30175,1.17>,r}
+	sphere{<1.27644,2.30175,1.17>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.254164,1.79728,1.86675>,<-0.251375,1.79469,1.87222>,<-0.343476,1.55777,1.7129>}
+	triangle{<-0.254164,1.79728,1.86675>,<-0.343476,1.55777,1.7129>,<-0.35987,1.58377,1.68004>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.254164,1.79728,1.86675>,<-0.251375,1.79469,1.87222>,r}
+	sphere{<-0.251375,1.79469,1.87222>,r}
+	cylinder{<-0.251375,1.79469,1.87222>,<-0.343476,1.55777,1.7129>,r}
+	sphere{<-0.343476,1.55777,1.7129>,r}
+	cylinder{<-0.343476,1.55777,1.7129>,<-0.35987,1.58377,1.68004>,r}
+	sphere{<-0.35987,1.58377,1.68004>,r}
+	cylinder{<-0.35987,1.58377,1.68004>,<-0.254164,1.79728,1.86675>,r}
+	sphere{<-0.254164,1.79728,1.86675>,r}
+	texture{t2}
+}
+union{
+	triangle{<3,1.32553,1.68729>,<3,1.1187,1.54026>,<2.54723,1.11876,1.54033>}
+	triangle{<3,1.32553,1.68729>,<2.54723,1.11876,1.54033>,<2.46318,1.3254,1.68724>}
+	texture{t1}
+}
+union{
+	cylinder{<3,1.32553,1.68729>,<3,1.1187,1.54026>,r}
+	sphere{<3,1.1187,1.54026>,r}
+	cylinder{<3,1.1187,1.54026>,<2.54723,1.11876,1.54033>,r}
+	sphere{<2.54723,1.11876,1.54033>,r}
+	cylinder{<2.54723,1.11876,1.54033>,<2.46318,1.3254,1.68724>,r}
+	sphere{<2.46318,1.3254,1.68724>,r}
+	cylinder{<2.46318,1.3254,1.68724>,<3,1.32553,1.68729>,r}
+	sphere{<3,1.32553,1.68729>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.76488,1.78374,1.20575>,<2.02764,2.08717,0.783716>,<2.9997,2.59484,1.44747>}
+	triangle{<1.76488,1.78374,1.20575>,<2.9997,2.59484,1.44747>,<1.97423,1.82567,1.59266>}
+	texture{t1}
+}
+union{
+	cylinder{<1.76488,1.78374,1.20575>,<2.02764,2.08717,0.783716>,r}
+	sphere{<2.02764,2.08717,0.783716>,r}
+	cylinder{<2.02764,2.08717,0.783716>,<2.9997,2.59484,1.44747>,r}
+	sphere{<2.9997,2.59484,1.44747>,r}
+	cylinder{<2.9997,2.59484,1.44747>,<1.97423,1.82567,1.59266>,r}
+	sphere{<1.97423,1.82567,1.59266>,r}
+	cylinder{<1.97423,1.82567,1.59266>,<1.76488,1.78374,1.20575>,r}
+	sphere{<1.76488,1.78374,1.20575>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.76488,1.78374,1.20575>,<2.08597,1.20835,0.933989>,<2.4857,1.70533,0.282835>}
+	triangle{<1.76488,1.78374,1.20575>,<2.4857,1.70533,0.282835>,<2.02764,2.08717,0.783716>}
+	texture{t1}
+}
+union{
+	cylinder{<1.76488,1.78374,1.20575>,<2.08597,1.20835,0.933989>,r}
+	sphere{<2.08597,1.20835,0.933989>,r}
+	cylinder{<2.08597,1.20835,0.933989>,<2.4857,1.70533,0.282835>,r}
+	sphere{<2.4857,1.70533,0.282835>,r}
+	cylinder{<2.4857,1.70533,0.282835>,<2.02764,2.08717,0.783716>,r}
+	sphere{<2.02764,2.08717,0.783716>,r}
+	cylinder{<2.02764,2.08717,0.783716>,<1.76488,1.78374,1.20575>,r}
+	sphere{<1.76488,1.78374,1.20575>,r}
+	texture{t2}
+}
+union{
+	triangle{<3,1.04104,1.15223>,<2.36795,1.04118,1.15264>,<2.54723,1.11876,1.54033>}
+	triangle{<3,1.04104,1.15223>,<2.54723,1.11876,1.54033>,<3,1.1187,1.54026>}
+	texture{t1}
+}
+union{
+	cylinder{<3,1.04104,1.15223>,<2.36795,1.04118,1.15264>,r}
+	sphere{<2.36795,1.04118,1.15264>,r}
+	cylinder{<2.36795,1.04118,1.15264>,<2.54723,1.11876,1.54033>,r}
+	sphere{<2.54723,1.11876,1.54033>,r}
+	cylinder{<2.54723,1.11876,1.54033>,<3,1.1187,1.54026>,r}
+	sphere{<3,1.1187,1.54026>,r}
+	cylinder{<3,1.1187,1.54026>,<3,1.04104,1.15223>,r}
+	sphere{<3,1.04104,1.15223>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.4857,1.70533,0.282835>,<3,1.70543,0.282236>,<3,1.70545,0>}
+	triangle{<2.4857,1.70533,0.282835>,<3,1.70545,0>,<2.48567,1.70535,0>}
+	texture{t1}
+}
+union{
+	cylinder{<2.4857,1.70533,0.282835>,<3,1.70543,0.282236>,r}
+	sphere{<3,1.70543,0.282236>,r}
+	cylinder{<3,1.70543,0.282236>,<3,1.70545,0>,r}
+	sphere{<3,1.70545,0>,r}
+	cylinder{<3,1.70545,0>,<2.48567,1.70535,0>,r}
+	sphere{<2.48567,1.70535,0>,r}
+	cylinder{<2.48567,1.70535,0>,<2.4857,1.70533,0.282835>,r}
+	sphere{<2.4857,1.70533,0.282835>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.97423,1.82567,1.59266>,<1.76488,1.78374,1.20575>,<1.73137,1.7874,1.21081>}
+	triangle{<1.97423,1.82567,1.59266>,<1.73137,1.7874,1.21081>,<1.92566,1.83679,1.63752>}
+	texture{t1}
+}
+union{
+	cylinder{<1.97423,1.82567,1.59266>,<1.76488,1.78374,1.20575>,r}
+	sphere{<1.76488,1.78374,1.20575>,r}
+	cylinder{<1.76488,1.78374,1.20575>,<1.73137,1.7874,1.21081>,r}
+	sphere{<1.73137,1.7874,1.21081>,r}
+	cylinder{<1.73137,1.7874,1.21081>,<1.92566,1.83679,1.63752>,r}
+	sphere{<1.92566,1.83679,1.63752>,r}
+	cylinder{<1.92566,1.83679,1.63752>,<1.97423,1.82567,1.59266>,r}
+	sphere{<1.97423,1.82567,1.59266>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.97592,-2.18051,2.51493>,<-1.9784,-2.04551,2.47097>,<-1.9375,-2.0099,2.50056>}
+	triangle{<-1.97592,-2.18051,2.51493>,<-1.9375,-2.0099,2.50056>,<-1.92029,-2.00985,2.51761>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.97592,-2.18051,2.51493>,<-1.9784,-2.04551,2.47097>,r}
+	sphere{<-1.9784,-2.04551,2.47097>,r}
+	cylinder{<-1.9784,-2.04551,2.47097>,<-1.9375,-2.0099,2.50056>,r}
+	sphere{<-1.9375,-2.0099,2.50056>,r}
+	cylinder{<-1.9375,-2.0099,2.50056>,<-1.92029,-2.00985,2.51761>,r}
+	sphere{<-1.92029,-2.00985,2.51761>,r}
+	cylinder{<-1.92029,-2.00985,2.51761>,<-1.97592,-2.18051,2.51493>,r}
+	sphere{<-1.97592,-2.18051,2.51493>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.661023,-2.99011,2.23396>,<-0.641057,-2.96745,2.09053>,<-0.641056,-3,2.09052>}
+	triangle{<-0.661023,-2.99011,2.23396>,<-0.641056,-3,2.09052>,<-0.661023,-3,2.23396>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.661023,-2.99011,2.23396>,<-0.641057,-2.96745,2.09053>,r}
+	sphere{<-0.641057,-2.96745,2.09053>,r}
+	cylinder{<-0.641057,-2.96745,2.09053>,<-0.641056,-3,2.09052>,r}
+	sphere{<-0.641056,-3,2.09052>,r}
+	cylinder{<-0.641056,-3,2.09052>,<-0.661023,-3,2.23396>,r}
+	sphere{<-0.661023,-3,2.23396>,r}
+	cylinder{<-0.661023,-3,2.23396>,<-0.661023,-2.99011,2.23396>,r}
+	sphere{<-0.661023,-2.99011,2.23396>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.661023,-2.99011,2.23396>,<-0.661023,-3,2.23396>,<-1.02289,-3,2.56038>}
+	triangle{<-0.661023,-2.99011,2.23396>,<-1.02289,-3,2.56038>,<-1.02302,-2.51259,2.56043>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.661023,-2.99011,2.23396>,<-0.661023,-3,2.23396>,r}
+	sphere{<-0.661023,-3,2.23396>,r}
+	cylinder{<-0.661023,-3,2.23396>,<-1.02289,-3,2.56038>,r}
+	sphere{<-1.02289,-3,2.56038>,r}
+	cylinder{<-1.02289,-3,2.56038>,<-1.02302,-2.51259,2.56043>,r}
+	sphere{<-1.02302,-2.51259,2.56043>,r}
+	cylinder{<-1.02302,-2.51259,2.56043>,<-0.661023,-2.99011,2.23396>,r}
+	sphere{<-0.661023,-2.99011,2.23396>,r}
+	texture{t2}
+}
+union{
+	triangle{<-3,-0.837926,2.74867>,<-2.93346,-0.837923,2.74867>,<-2.13816,-1.55756,2.87613>}
+	triangle{<-3,-0.837926,2.74867>,<-2.13816,-1.55756,2.87613>,<-3,-1.55727,2.87607>}
+	texture{t1}
+}
+union{
+	cylinder{<-3,-0.837926,2.74867>,<-2.93346,-0.837923,2.74867>,r}
+	sphere{<-2.93346,-0.837923,2.74867>,r}
+	cylinder{<-2.93346,-0.837923,2.74867>,<-2.13816,-1.55756,2.87613>,r}
+	sphere{<-2.13816,-1.55756,2.87613>,r}
+	cylinder{<-2.13816,-1.55756,2.87613>,<-3,-1.55727,2.87607>,r}
+	sphere{<-3,-1.55727,2.87607>,r}
+	cylinder{<-3,-1.55727,2.87607>,<-3,-0.837926,2.74867>,r}
+	sphere{<-3,-0.837926,2.74867>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.18147,-1.99335,1.90931>,<-0.861112,-1.49196,1.78185>,<-0.944914,-1.38933,2.44305>}
+	triangle{<-1.18147,-1.99335,1.90931>,<-0.944914,-1.38933,2.44305>,<-1.3148,-2.00155,2.50074>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.18147,-1.99335,1.90931>,<-0.861112,-1.49196,1.78185>,r}
+	sphere{<-0.861112,-1.49196,1.78185>,r}
+	cylinder{<-0.861112,-1.49196,1.78185>,<-0.944914,-1.38933,2.44305>,r}
+	sphere{<-0.944914,-1.38933,2.44305>,r}
+	cylinder{<-0.944914,-1.38933,2.44305>,<-1.3148,-2.00155,2.50074>,r}
+	sphere{<-1.3148,-2.00155,2.50074>,r}
+	cylinder{<-1.3148,-2.00155,2.50074>,<-1.18147,-1.99335,1.90931>,r}
+	sphere{<-1.18147,-1.99335,1.90931>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.439585,-1.48203,2.6202>,<-0.439112,-1.75697,2.92938>,<-0.581953,-1.74859,2.95253>}
+	triangle{<-0.439585,-1.48203,2.6202>,<-0.581953,-1.74859,2.95253>,<-0.754167,-1.41136,2.61246>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.439585,-1.48203,2.6202>,<-0.439112,-1.75697,2.92938>,r}
+	sphere{<-0.439112,-1.75697,2.92938>,r}
+	cylinder{<-0.439112,-1.75697,2.92938>,<-0.581953,-1.74859,2.95253>,r}
+	sphere{<-0.581953,-1.74859,2.95253>,r}
+	cylinder{<-0.581953,-1.74859,2.95253>,<-0.754167,-1.41136,2.61246>,r}
+	sphere{<-0.754167,-1.41136,2.61246>,r}
+	cylinder{<-0.754167,-1.41136,2.61246>,<-0.439585,-1.48203,2.6202>,r}
+	sphere{<-0.439585,-1.48203,2.6202>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.01711,-1.34961,2.53217>,<1.24654,-1.41807,2.31938>,<1.12785,-1.63224,2.49748>}
+	triangle{<1.01711,-1.34961,2.53217>,<1.12785,-1.63224,2.49748>,<1.0306,-1.42514,2.53914>}
+	texture{t1}
+}
+union{
+	cylinder{<1.01711,-1.34961,2.53217>,<1.24654,-1.41807,2.31938>,r}
+	sphere{<1.24654,-1.41807,2.31938>,r}
+	cylinder{<1.24654,-1.41807,2.31938>,<1.12785,-1.63224,2.49748>,r}
+	sphere{<1.12785,-1.63224,2.49748>,r}
+	cylinder{<1.12785,-1.63224,2.49748>,<1.0306,-1.42514,2.53914>,r}
+	sphere{<1.0306,-1.42514,2.53914>,r}
+	cylinder{<1.0306,-1.42514,2.53914>,<1.01711,-1.34961,2.53217>,r}
+	sphere{<1.01711,-1.34961,2.53217>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.12785,-1.63224,2.49748>,<1.10256,-1.70346,2.49393>,<0.996365,-1.73276,2.51003>}
+	triangle{<1.12785,-1.63224,2.49748>,<0.996365,-1.73276,2.51003>,<1.0306,-1.42514,2.53914>}
+	texture{t1}
+}
+union{
+	cylinder{<1.12785,-1.63224,2.49748>,<1.10256,-1.70346,2.49393>,r}
+	sphere{<1.10256,-1.70346,2.49393>,r}
+	cylinder{<1.10256,-1.70346,2.49393>,<0.996365,-1.73276,2.51003>,r}
+	sphere{<0.996365,-1.73276,2.51003>,r}
+	cylinder{<0.996365,-1.73276,2.51003>,<1.0306,-1.42514,2.53914>,r}
+	sphere{<1.0306,-1.42514,2.53914>,r}
+	cylinder{<1.0306,-1.42514,2.53914>,<1.12785,-1.63224,2.49748>,r}
+	sphere{<1.12785,-1.63224,2.49748>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.59952,-3,2.69278>,<-0.00581297,-3,2.83856>,<-0.00577534,-2.16686,2.83849>}
+	triangle{<0.59952,-3,2.69278>,<-0.00577534,-2.16686,2.83849>,<0.599552,-2.13566,2.6927>}
+	texture{t1}
+}
+union{
+	cylinder{<0.59952,-3,2.69278>,<-0.00581297,-3,2.83856>,r}
+	sphere{<-0.00581297,-3,2.83856>,r}
+	cylinder{<-0.00581297,-3,2.83856>,<-0.00577534,-2.16686,2.83849>,r}
+	sphere{<-0.00577534,-2.16686,2.83849>,r}
+	cylinder{<-0.00577534,-2.16686,2.83849>,<0.599552,-2.13566,2.6927>,r}
+	sphere{<0.599552,-2.13566,2.6927>,r}
+	cylinder{<0.599552,-2.13566,2.6927>,<0.59952,-3,2.69278>,r}
+	sphere{<0.59952,-3,2.69278>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.996365,-1.73276,2.51003>,<0.700094,-2.04353,2.79846>,<0.599552,-2.13566,2.6927>}
+	triangle{<0.996365,-1.73276,2.51003>,<0.599552,-2.13566,2.6927>,<0.70993,-2.00245,2.31908>}
+	texture{t1}
+}
+union{
+	cylinder{<0.996365,-1.73276,2.51003>,<0.700094,-2.04353,2.79846>,r}
+	sphere{<0.700094,-2.04353,2.79846>,r}
+	cylinder{<0.700094,-2.04353,2.79846>,<0.599552,-2.13566,2.6927>,r}
+	sphere{<0.599552,-2.13566,2.6927>,r}
+	cylinder{<0.599552,-2.13566,2.6927>,<0.70993,-2.00245,2.31908>,r}
+	sphere{<0.70993,-2.00245,2.31908>,r}
+	cylinder{<0.70993,-2.00245,2.31908>,<0.996365,-1.73276,2.51003>,r}
+	sphere{<0.996365,-1.73276,2.51003>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.24654,-1.41807,2.31938>,<1.39005,-1.32631,1.83291>,<1.81819,-1.19201,1.96471>}
+	triangle{<1.24654,-1.41807,2.31938>,<1.81819,-1.19201,1.96471>,<1.8132,-1.20479,2.09058>}
+	texture{t1}
+}
+union{
+	cylinder{<1.24654,-1.41807,2.31938>,<1.39005,-1.32631,1.83291>,r}
+	sphere{<1.39005,-1.32631,1.83291>,r}
+	cylinder{<1.39005,-1.32631,1.83291>,<1.81819,-1.19201,1.96471>,r}
+	sphere{<1.81819,-1.19201,1.96471>,r}
+	cylinder{<1.81819,-1.19201,1.96471>,<1.8132,-1.20479,2.09058>,r}
+	sphere{<1.8132,-1.20479,2.09058>,r}
+	cylinder{<1.8132,-1.20479,2.09058>,<1.24654,-1.41807,2.31938>,r}
+	sphere{<1.24654,-1.41807,2.31938>,r}
+	texture{t2}
+}
+union{
+	triangle{<3,-1.87477,1.83521>,<3,-1.91769,2.15649>,<2.3273,-1.91678,2.15724>}
+	triangle{<3,-1.87477,1.83521>,<2.3273,-1.91678,2.15724>,<2.3325,-1.8737,1.83471>}
+	texture{t1}
+}
+union{
+	cylinder{<3,-1.87477,1.83521>,<3,-1.91769,2.15649>,r}
+	sphere{<3,-1.91769,2.15649>,r}
+	cylinder{<3,-1.91769,2.15649>,<2.3273,-1.91678,2.15724>,r}
+	sphere{<2.3273,-1.91678,2.15724>,r}
+	cylinder{<2.3273,-1.91678,2.15724>,<2.3325,-1.8737,1.83471>,r}
+	sphere{<2.3325,-1.8737,1.83471>,r}
+	cylinder{<2.3325,-1.8737,1.83471>,<3,-1.87477,1.83521>,r}
+	sphere{<3,-1.87477,1.83521>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.39371,-2.13978,3.45599>,<3,-2.13984,3.45592>,<3,-3,3.11507>}
+	triangle{<2.39371,-2.13978,3.45599>,<3,-3,3.11507>,<2.75353,-3,3.11508>}
+	texture{t1}
+}
+union{
+	cylinder{<2.39371,-2.13978,3.45599>,<3,-2.13984,3.45592>,r}
+	sphere{<3,-2.13984,3.45592>,r}
+	cylinder{<3,-2.13984,3.45592>,<3,-3,3.11507>,r}
+	sphere{<3,-3,3.11507>,r}
+	cylinder{<3,-3,3.11507>,<2.75353,-3,3.11508>,r}
+	sphere{<2.75353,-3,3.11508>,r}
+	cylinder{<2.75353,-3,3.11508>,<2.39371,-2.13978,3.45599>,r}
+	sphere{<2.39371,-2.13978,3.45599>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.39068,-0.776077,2.1301>,<-2.01663,-1.05417,2.11302>,<-2.05797,-1.1152,1.87674>}
+	triangle{<-2.39068,-0.776077,2.1301>,<-2.05797,-1.1152,1.87674>,<-2.42076,-0.77158,2.08509>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.39068,-0.776077,2.1301>,<-2.01663,-1.05417,2.11302>,r}
+	sphere{<-2.01663,-1.05417,2.11302>,r}
+	cylinder{<-2.01663,-1.05417,2.11302>,<-2.05797,-1.1152,1.87674>,r}
+	sphere{<-2.05797,-1.1152,1.87674>,r}
+	cylinder{<-2.05797,-1.1152,1.87674>,<-2.42076,-0.77158,2.08509>,r}
+	sphere{<-2.42076,-0.77158,2.08509>,r}
+	cylinder{<-2.42076,-0.77158,2.08509>,<-2.39068,-0.776077,2.1301>,r}
+	sphere{<-2.39068,-0.776077,2.1301>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.9375,-2.0099,2.50056>,<-1.91595,-1.85245,2.63131>,<-1.88582,-1.90689,2.62325>}
+	triangle{<-1.9375,-2.0099,2.50056>,<-1.88582,-1.90689,2.62325>,<-1.92029,-2.00985,2.51761>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.9375,-2.0099,2.50056>,<-1.91595,-1.85245,2.63131>,r}
+	sphere{<-1.91595,-1.85245,2.63131>,r}
+	cylinder{<-1.91595,-1.85245,2.63131>,<-1.88582,-1.90689,2.62325>,r}
+	sphere{<-1.88582,-1.90689,2.62325>,r}
+	cylinder{<-1.88582,-1.90689,2.62325>,<-1.92029,-2.00985,2.51761>,r}
+	sphere{<-1.92029,-2.00985,2.51761>,r}
+	cylinder{<-1.92029,-2.00985,2.51761>,<-1.9375,-2.0099,2.50056>,r}
+	sphere{<-1.9375,-2.0099,2.50056>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.42863,-0.863014,2.32028>,<-1.15445,-0.85433,2.04207>,<-1.07825,-1.08857,2.48062>}
+	triangle{<-1.42863,-0.863014,2.32028>,<-1.07825,-1.08857,2.48062>,<-1.3156,-1.00955,2.53282>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.42863,-0.863014,2.32028>,<-1.15445,-0.85433,2.04207>,r}
+	sphere{<-1.15445,-0.85433,2.04207>,r}
+	cylinder{<-1.15445,-0.85433,2.04207>,<-1.07825,-1.08857,2.48062>,r}
+	sphere{<-1.07825,-1.08857,2.48062>,r}
+	cylinder{<-1.07825,-1.08857,2.48062>,<-1.3156,-1.00955,2.53282>,r}
+	sphere{<-1.3156,-1.00955,2.53282>,r}
+	cylinder{<-1.3156,-1.00955,2.53282>,<-1.42863,-0.863014,2.32028>,r}
+	sphere{<-1.42863,-0.863014,2.32028>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.42863,-0.863014,2.32028>,<-1.3156,-1.00955,2.53282>,<-1.91743,-1.54566,2.64149>}
+	triangle{<-1.42863,-0.863014,2.32028>,<-1.91743,-1.54566,2.64149>,<-2.01663,-1.05417,2.11302>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.42863,-0.863014,2.32028>,<-1.3156,-1.00955,2.53282>,r}
+	sphere{<-1.3156,-1.00955,2.53282>,r}
+	cylinder{<-1.3156,-1.00955,2.53282>,<-1.91743,-1.54566,2.64149>,r}
+	sphere{<-1.91743,-1.54566,2.64149>,r}
+	cylinder{<-1.91743,-1.54566,2.64149>,<-2.01663,-1.05417,2.11302>,r}
+	sphere{<-2.01663,-1.05417,2.11302>,r}
+	cylinder{<-2.01663,-1.05417,2.11302>,<-1.42863,-0.863014,2.32028>,r}
+	sphere{<-1.42863,-0.863014,2.32028>,r}
+	texture{t2}
+}
+union{
+	triangle{<-3,-0.837926,2.74867>,<-3,-0.837772,2.74884>,<-2.93336,-0.837776,2.74883>}
+	triangle{<-3,-0.837926,2.74867>,<-2.93336,-0.837776,2.74883>,<-2.93346,-0.837923,2.74867>}
+	texture{t1}
+}
+union{
+	cylinder{<-3,-0.837926,2.74867>,<-3,-0.837772,2.74884>,r}
+	sphere{<-3,-0.837772,2.74884>,r}
+	cylinder{<-3,-0.837772,2.74884>,<-2.93336,-0.837776,2.74883>,r}
+	sphere{<-2.93336,-0.837776,2.74883>,r}
+	cylinder{<-2.93336,-0.837776,2.74883>,<-2.93346,-0.837923,2.74867>,r}
+	sphere{<-2.93346,-0.837923,2.74867>,r}
+	cylinder{<-2.93346,-0.837923,2.74867>,<-3,-0.837926,2.74867>,r}
+	sphere{<-3,-0.837926,2.74867>,r}
+	texture{t2}
+}
+union{
+	triangle{<-3,0.4247,1.90027>,<-2.24332,0.424641,1.90773>,<-2.15914,0.42953,2.75867>}
+	triangle{<-3,0.4247,1.90027>,<-2.15914,0.42953,2.75867>,<-3,0.429644,2.75868>}
+	texture{t1}
+}
+union{
+	cylinder{<-3,0.4247,1.90027>,<-2.24332,0.424641,1.90773>,r}
+	sphere{<-2.24332,0.424641,1.90773>,r}
+	cylinder{<-2.24332,0.424641,1.90773>,<-2.15914,0.42953,2.75867>,r}
+	sphere{<-2.15914,0.42953,2.75867>,r}
+	cylinder{<-2.15914,0.42953,2.75867>,<-3,0.429644,2.75868>,r}
+	sphere{<-3,0.429644,2.75868>,r}
+	cylinder{<-3,0.429644,2.75868>,<-3,0.4247,1.90027>,r}
+	sphere{<-3,0.4247,1.90027>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.13337,0.387226,2.79293>,<-1.87433,-0.115095,2.73998>,<-2.01779,-0.136726,2.89295>}
+	triangle{<-2.13337,0.387226,2.79293>,<-2.01779,-0.136726,2.89295>,<-2.21438,0.182597,2.95866>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.13337,0.387226,2.79293>,<-1.87433,-0.115095,2.73998>,r}
+	sphere{<-1.87433,-0.115095,2.73998>,r}
+	cylinder{<-1.87433,-0.115095,2.73998>,<-2.01779,-0.136726,2.89295>,r}
+	sphere{<-2.01779,-0.136726,2.89295>,r}
+	cylinder{<-2.01779,-0.136726,2.89295>,<-2.21438,0.182597,2.95866>,r}
+	sphere{<-2.21438,0.182597,2.95866>,r}
+	cylinder{<-2.21438,0.182597,2.95866>,<-2.13337,0.387226,2.79293>,r}
+	sphere{<-2.13337,0.387226,2.79293>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.00374,-0.78727,3.45125>,<-2.93336,-0.837776,2.74883>,<-2.01779,-0.136726,2.89295>}
+	triangle{<-2.00374,-0.78727,3.45125>,<-2.01779,-0.136726,2.89295>,<-1.85025,-0.330827,3.19041>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.00374,-0.78727,3.45125>,<-2.93336,-0.837776,2.74883>,r}
+	sphere{<-2.93336,-0.837776,2.74883>,r}
+	cylinder{<-2.93336,-0.837776,2.74883>,<-2.01779,-0.136726,2.89295>,r}
+	sphere{<-2.01779,-0.136726,2.89295>,r}
+	cylinder{<-2.01779,-0.136726,2.89295>,<-1.85025,-0.330827,3.19041>,r}
+	sphere{<-1.85025,-0.330827,3.19041>,r}
+	cylinder{<-1.85025,-0.330827,3.19041>,<-2.00374,-0.78727,3.45125>,r}
+	sphere{<-2.00374,-0.78727,3.45125>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.754167,-1.41136,2.61246>,<-0.944914,-1.38933,2.44305>,<-1.07825,-1.08857,2.48062>}
+	triangle{<-0.754167,-1.41136,2.61246>,<-1.07825,-1.08857,2.48062>,<-0.961343,-1.07053,2.60169>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.754167,-1.41136,2.61246>,<-0.944914,-1.38933,2.44305>,r}
+	sphere{<-0.944914,-1.38933,2.44305>,r}
+	cylinder{<-0.944914,-1.38933,2.44305>,<-1.07825,-1.08857,2.48062>,r}
+	sphere{<-1.07825,-1.08857,2.48062>,r}
+	cylinder{<-1.07825,-1.08857,2.48062>,<-0.961343,-1.07053,2.60169>,r}
+	sphere{<-0.961343,-1.07053,2.60169>,r}
+	cylinder{<-0.961343,-1.07053,2.60169>,<-0.754167,-1.41136,2.61246>,r}
+	sphere{<-0.754167,-1.41136,2.61246>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.798807,-0.470622,1.78419>,<-0.761264,-0.404631,1.84403>,<-0.776993,-0.403364,1.85885>}
+	triangle{<-0.798807,-0.470622,1.78419>,<-0.776993,-0.403364,1.85885>,<-0.871986,-0.473308,1.8413>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.798807,-0.470622,1.78419>,<-0.761264,-0.404631,1.84403>,r}
+	sphere{<-0.761264,-0.404631,1.84403>,r}
+	cylinder{<-0.761264,-0.404631,1.84403>,<-0.776993,-0.403364,1.85885>,r}
+	sphere{<-0.776993,-0.403364,1.85885>,r}
+	cylinder{<-0.776993,-0.403364,1.85885>,<-0.871986,-0.473308,1.8413>,r}
+	sphere{<-0.871986,-0.473308,1.8413>,r}
+	cylinder{<-0.871986,-0.473308,1.8413>,<-0.798807,-0.470622,1.78419>,r}
+	sphere{<-0.798807,-0.470622,1.78419>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.394065,-0.582538,2.60377>,<-0.35405,-0.387528,2.36914>,<-0.308166,-0.389651,2.35456>}
+	triangle{<-0.394065,-0.582538,2.60377>,<-0.308166,-0.389651,2.35456>,<-0.0938173,-0.688252,2.61188>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.394065,-0.582538,2.60377>,<-0.35405,-0.387528,2.36914>,r}
+	sphere{<-0.35405,-0.387528,2.36914>,r}
+	cylinder{<-0.35405,-0.387528,2.36914>,<-0.308166,-0.389651,2.35456>,r}
+	sphere{<-0.308166,-0.389651,2.35456>,r}
+	cylinder{<-0.308166,-0.389651,2.35456>,<-0.0938173,-0.688252,2.61188>,r}
+	sphere{<-0.0938173,-0.688252,2.61188>,r}
+	cylinder{<-0.0938173,-0.688252,2.61188>,<-0.394065,-0.582538,2.60377>,r}
+	sphere{<-0.394065,-0.582538,2.60377>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.394065,-0.582538,2.60377>,<-0.961343,-1.07053,2.60169>,<-1.08928,-0.913651,2.92432>}
+	triangle{<-0.394065,-0.582538,2.60377>,<-1.08928,-0.913651,2.92432>,<-0.723943,-0.361722,3.21332>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.394065,-0.582538,2.60377>,<-0.961343,-1.07053,2.60169>,r}
+	sphere{<-0.961343,-1.07053,2.60169>,r}
+	cylinder{<-0.961343,-1.07053,2.60169>,<-1.08928,-0.913651,2.92432>,r}
+	sphere{<-1.08928,-0.913651,2.92432>,r}
+	cylinder{<-1.08928,-0.913651,2.92432>,<-0.723943,-0.361722,3.21332>,r}
+	sphere{<-0.723943,-0.361722,3.21332>,r}
+	cylinder{<-0.723943,-0.361722,3.21332>,<-0.394065,-0.582538,2.60377>,r}
+	sphere{<-0.394065,-0.582538,2.60377>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.04712,-0.0942936,3.19199>,<-0.953958,0.103815,3.0827>,<-0.791213,0.079693,3.05045>}
+	triangle{<-1.04712,-0.0942936,3.19199>,<-0.791213,0.079693,3.05045>,<-0.730576,-0.344699,3.21645>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.04712,-0.0942936,3.19199>,<-0.953958,0.103815,3.0827>,r}
+	sphere{<-0.953958,0.103815,3.0827>,r}
+	cylinder{<-0.953958,0.103815,3.0827>,<-0.791213,0.079693,3.05045>,r}
+	sphere{<-0.791213,0.079693,3.05045>,r}
+	cylinder{<-0.791213,0.079693,3.05045>,<-0.730576,-0.344699,3.21645>,r}
+	sphere{<-0.730576,-0.344699,3.21645>,r}
+	cylinder{<-0.730576,-0.344699,3.21645>,<-1.04712,-0.0942936,3.19199>,r}
+	sphere{<-1.04712,-0.0942936,3.19199>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.0655666,0.206774,3.56236>,<0.235412,0.176286,3.50502>,<0.212813,0.0550446,3.55145>}
+	triangle{<-0.0655666,0.206774,3.56236>,<0.212813,0.0550446,3.55145>,<-0.0557612,0.040329,3.61692>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.0655666,0.206774,3.56236>,<0.235412,0.176286,3.50502>,r}
+	sphere{<0.235412,0.176286,3.50502>,r}
+	cylinder{<0.235412,0.176286,3.50502>,<0.212813,0.0550446,3.55145>,r}
+	sphere{<0.212813,0.0550446,3.55145>,r}
+	cylinder{<0.212813,0.0550446,3.55145>,<-0.0557612,0.040329,3.61692>,r}
+	sphere{<-0.0557612,0.040329,3.61692>,r}
+	cylinder{<-0.0557612,0.040329,3.61692>,<-0.0655666,0.206774,3.56236>,r}
+	sphere{<-0.0655666,0.206774,3.56236>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.0938173,-0.688252,2.61188>,<0.0554648,-0.72365,2.71733>,<0.0787716,-0.858101,2.65521>}
+	triangle{<-0.0938173,-0.688252,2.61188>,<0.0787716,-0.858101,2.65521>,<0.043504,-0.869656,2.61816>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.0938173,-0.688252,2.61188>,<0.0554648,-0.72365,2.71733>,r}
+	sphere{<0.0554648,-0.72365,2.71733>,r}
+	cylinder{<0.0554648,-0.72365,2.71733>,<0.0787716,-0.858101,2.65521>,r}
+	sphere{<0.0787716,-0.858101,2.65521>,r}
+	cylinder{<0.0787716,-0.858101,2.65521>,<0.043504,-0.869656,2.61816>,r}
+	sphere{<0.043504,-0.869656,2.61816>,r}
+	cylinder{<0.043504,-0.869656,2.61816>,<-0.0938173,-0.688252,2.61188>,r}
+	sphere{<-0.0938173,-0.688252,2.61188>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.01421,-1.33961,2.54194>,<1.01711,-1.34961,2.53217>,<0.689471,-1.05816,2.32747>}
+	triangle{<1.01421,-1.33961,2.54194>,<0.689471,-1.05816,2.32747>,<0.692489,-1.05202,2.34312>}
+	texture{t1}
+}
+union{
+	cylinder{<1.01421,-1.33961,2.54194>,<1.01711,-1.34961,2.53217>,r}
+	sphere{<1.01711,-1.34961,2.53217>,r}
+	cylinder{<1.01711,-1.34961,2.53217>,<0.689471,-1.05816,2.32747>,r}
+	sphere{<0.689471,-1.05816,2.32747>,r}
+	cylinder{<0.689471,-1.05816,2.32747>,<0.692489,-1.05202,2.34312>,r}
+	sphere{<0.692489,-1.05202,2.34312>,r}
+	cylinder{<0.692489,-1.05202,2.34312>,<1.01421,-1.33961,2.54194>,r}
+	sphere{<1.01421,-1.33961,2.54194>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.0095,-0.0173004,2.04332>,<1.20471,-0.118388,2.38786>,<0.98856,-0.337638,2.5654>}
+	triangle{<1.0095,-0.0173004,2.04332>,<0.98856,-0.337638,2.5654>,<0.934636,-0.345033,2.52985>}
+	texture{t1}
+}
+union{
+	cylinder{<1.0095,-0.0173004,2.04332>,<1.20471,-0.118388,2.38786>,r}
+	sphere{<1.20471,-0.118388,2.38786>,r}
+	cylinder{<1.20471,-0.118388,2.38786>,<0.98856,-0.337638,2.5654>,r}
+	sphere{<0.98856,-0.337638,2.5654>,r}
+	cylinder{<0.98856,-0.337638,2.5654>,<0.934636,-0.345033,2.52985>,r}
+	sphere{<0.934636,-0.345033,2.52985>,r}
+	cylinder{<0.934636,-0.345033,2.52985>,<1.0095,-0.0173004,2.04332>,r}
+	sphere{<1.0095,-0.0173004,2.04332>,r}
+	texture{t2}
+}
+union{
+	triangle{<3,-0.734173,2.43184>,<3,-1.2878,2.79109>,<2.501,-1.28776,2.79101>}
+	triangle{<3,-0.734173,2.43184>,<2.501,-1.28776,2.79101>,<2.1632,-0.734237,2.43179>}
+	texture{t1}
+}
+union{
+	cylinder{<3,-0.734173,2.43184>,<3,-1.2878,2.79109>,r}
+	sphere{<3,-1.2878,2.79109>,r}
+	cylinder{<3,-1.2878,2.79109>,<2.501,-1.28776,2.79101>,r}
+	sphere{<2.501,-1.28776,2.79101>,r}
+	cylinder{<2.501,-1.28776,2.79101>,<2.1632,-0.734237,2.43179>,r}
+	sphere{<2.1632,-0.734237,2.43179>,r}
+	cylinder{<2.1632,-0.734237,2.43179>,<3,-0.734173,2.43184>,r}
+	sphere{<3,-0.734173,2.43184>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.04999,-0.636588,2.49358>,<2.1632,-0.734237,2.43179>,<2.04271,-0.717536,2.30902>}
+	triangle{<2.04999,-0.636588,2.49358>,<2.04271,-0.717536,2.30902>,<1.98693,-0.636425,2.41078>}
+	texture{t1}
+}
+union{
+	cylinder{<2.04999,-0.636588,2.49358>,<2.1632,-0.734237,2.43179>,r}
+	sphere{<2.1632,-0.734237,2.43179>,r}
+	cylinder{<2.1632,-0.734237,2.43179>,<2.04271,-0.717536,2.30902>,r}
+	sphere{<2.04271,-0.717536,2.30902>,r}
+	cylinder{<2.04271,-0.717536,2.30902>,<1.98693,-0.636425,2.41078>,r}
+	sphere{<1.98693,-0.636425,2.41078>,r}
+	cylinder{<1.98693,-0.636425,2.41078>,<2.04999,-0.636588,2.49358>,r}
+	sphere{<2.04999,-0.636588,2.49358>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.0306,-1.42514,2.53914>,<1.01711,-1.34961,2.53217>,<1.01421,-1.33961,2.54194>}
+	triangle{<1.0306,-1.42514,2.53914>,<1.01421,-1.33961,2.54194>,<1.01395,-1.35649,2.57513>}
+	texture{t1}
+}
+union{
+	cylinder{<1.0306,-1.42514,2.53914>,<1.01711,-1.34961,2.53217>,r}
+	sphere{<1.01711,-1.34961,2.53217>,r}
+	cylinder{<1.01711,-1.34961,2.53217>,<1.01421,-1.33961,2.54194>,r}
+	sphere{<1.01421,-1.33961,2.54194>,r}
+	cylinder{<1.01421,-1.33961,2.54194>,<1.01395,-1.35649,2.57513>,r}
+	sphere{<1.01395,-1.35649,2.57513>,r}
+	cylinder{<1.01395,-1.35649,2.57513>,<1.0306,-1.42514,2.53914>,r}
+	sphere{<1.0306,-1.42514,2.53914>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.13337,0.387226,2.79293>,<-2.15914,0.42953,2.75867>,<-2.00312,0.6739,2.81441>}
+	triangle{<-2.13337,0.387226,2.79293>,<-2.00312,0.6739,2.81441>,<-2.0023,0.673521,2.81521>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.13337,0.387226,2.79293>,<-2.15914,0.42953,2.75867>,r}
+	sphere{<-2.15914,0.42953,2.75867>,r}
+	cylinder{<-2.15914,0.42953,2.75867>,<-2.00312,0.6739,2.81441>,r}
+	sphere{<-2.00312,0.6739,2.81441>,r}
+	cylinder{<-2.00312,0.6739,2.81441>,<-2.0023,0.673521,2.81521>,r}
+	sphere{<-2.0023,0.673521,2.81521>,r}
+	cylinder{<-2.0023,0.673521,2.81521>,<-2.13337,0.387226,2.79293>,r}
+	sphere{<-2.13337,0.387226,2.79293>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.69854,-0.26674,2.48>,<-1.84086,-0.232971,2.45966>,<-1.87433,-0.115095,2.73998>}
+	triangle{<-1.69854,-0.26674,2.48>,<-1.87433,-0.115095,2.73998>,<-1.70095,-0.169591,2.73013>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.69854,-0.26674,2.48>,<-1.84086,-0.232971,2.45966>,r}
+	sphere{<-1.84086,-0.232971,2.45966>,r}
+	cylinder{<-1.84086,-0.232971,2.45966>,<-1.87433,-0.115095,2.73998>,r}
+	sphere{<-1.87433,-0.115095,2.73998>,r}
+	cylinder{<-1.87433,-0.115095,2.73998>,<-1.70095,-0.169591,2.73013>,r}
+	sphere{<-1.70095,-0.169591,2.73013>,r}
+	cylinder{<-1.70095,-0.169591,2.73013>,<-1.69854,-0.26674,2.48>,r}
+	sphere{<-1.69854,-0.26674,2.48>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.07132,0.0559691,2.02283>,<-1.03599,0.562468,1.85701>,<-0.973409,0.778082,2.03344>}
+	triangle{<-1.07132,0.0559691,2.02283>,<-0.973409,0.778082,2.03344>,<-0.977897,0.265917,2.36338>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.07132,0.0559691,2.02283>,<-1.03599,0.562468,1.85701>,r}
+	sphere{<-1.03599,0.562468,1.85701>,r}
+	cylinder{<-1.03599,0.562468,1.85701>,<-0.973409,0.778082,2.03344>,r}
+	sphere{<-0.973409,0.778082,2.03344>,r}
+	cylinder{<-0.973409,0.778082,2.03344>,<-0.977897,0.265917,2.36338>,r}
+	sphere{<-0.977897,0.265917,2.36338>,r}
+	cylinder{<-0.977897,0.265917,2.36338>,<-1.07132,0.0559691,2.02283>,r}
+	sphere{<-1.07132,0.0559691,2.02283>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.0671471,0.5594,2.64086>,<0.0643369,0.501834,2.54225>,<-0.140831,0.556187,2.62254>}
+	triangle{<0.0671471,0.5594,2.64086>,<-0.140831,0.556187,2.62254>,<-0.120234,0.581941,2.66785>}
+	texture{t1}
+}
+union{
+	cylinder{<0.0671471,0.5594,2.64086>,<0.0643369,0.501834,2.54225>,r}
+	sphere{<0.0643369,0.501834,2.54225>,r}
+	cylinder{<0.0643369,0.501834,2.54225>,<-0.140831,0.556187,2.62254>,r}
+	sphere{<-0.140831,0.556187,2.62254>,r}
+	cylinder{<-0.140831,0.556187,2.62254>,<-0.120234,0.581941,2.66785>,r}
+	sphere{<-0.120234,0.581941,2.66785>,r}
+	cylinder{<-0.120234,0.581941,2.66785>,<0.0671471,0.5594,2.64086>,r}
+	sphere{<0.0671471,0.5594,2.64086>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.16253,0.889196,3.45424>,<-0.66351,0.918845,3.48501>,<-0.664265,0.823417,3.50643>}
+	triangle{<-1.16253,0.889196,3.45424>,<-0.664265,0.823417,3.50643>,<-1.05671,0.741025,3.49553>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.16253,0.889196,3.45424>,<-0.66351,0.918845,3.48501>,r}
+	sphere{<-0.66351,0.918845,3.48501>,r}
+	cylinder{<-0.66351,0.918845,3.48501>,<-0.664265,0.823417,3.50643>,r}
+	sphere{<-0.664265,0.823417,3.50643>,r}
+	cylinder{<-0.664265,0.823417,3.50643>,<-1.05671,0.741025,3.49553>,r}
+	sphere{<-1.05671,0.741025,3.49553>,r}
+	cylinder{<-1.05671,0.741025,3.49553>,<-1.16253,0.889196,3.45424>,r}
+	sphere{<-1.16253,0.889196,3.45424>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.22576,0.875701,2.56236>,<1.19931,0.843467,2.5703>,<1.1643,0.87467,2.59342>}
+	triangle{<1.22576,0.875701,2.56236>,<1.1643,0.87467,2.59342>,<1.19513,0.906764,2.58324>}
+	texture{t1}
+}
+union{
+	cylinder{<1.22576,0.875701,2.56236>,<1.19931,0.843467,2.5703>,r}
+	sphere{<1.19931,0.843467,2.5703>,r}
+	cylinder{<1.19931,0.843467,2.5703>,<1.1643,0.87467,2.59342>,r}
+	sphere{<1.1643,0.87467,2.59342>,r}
+	cylinder{<1.1643,0.87467,2.59342>,<1.19513,0.906764,2.58324>,r}
+	sphere{<1.19513,0.906764,2.58324>,r}
+	cylinder{<1.19513,0.906764,2.58324>,<1.22576,0.875701,2.56236>,r}
+	sphere{<1.22576,0.875701,2.56236>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.1643,0.87467,2.59342>,<0.763151,0.761353,3.27801>,<0.324329,0.846029,2.69722>}
+	triangle{<1.1643,0.87467,2.59342>,<0.324329,0.846029,2.69722>,<0.467186,0.878904,2.50109>}
+	texture{t1}
+}
+union{
+	cylinder{<1.1643,0.87467,2.59342>,<0.763151,0.761353,3.27801>,r}
+	sphere{<0.763151,0.761353,3.27801>,r}
+	cylinder{<0.763151,0.761353,3.27801>,<0.324329,0.846029,2.69722>,r}
+	sphere{<0.324329,0.846029,2.69722>,r}
+	cylinder{<0.324329,0.846029,2.69722>,<0.467186,0.878904,2.50109>,r}
+	sphere{<0.467186,0.878904,2.50109>,r}
+	cylinder{<0.467186,0.878904,2.50109>,<1.1643,0.87467,2.59342>,r}
+	sphere{<1.1643,0.87467,2.59342>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.21412,1.83563,2.74832>,<1.39115,1.44414,3.12341>,<1.34098,1.4483,3.2423>}
+	triangle{<1.21412,1.83563,2.74832>,<1.34098,1.4483,3.2423>,<0.910098,1.99441,3.18699>}
+	texture{t1}
+}
+union{
+	cylinder{<1.21412,1.83563,2.74832>,<1.39115,1.44414,3.12341>,r}
+	sphere{<1.39115,1.44414,3.12341>,r}
+	cylinder{<1.39115,1.44414,3.12341>,<1.34098,1.4483,3.2423>,r}
+	sphere{<1.34098,1.4483,3.2423>,r}
+	cylinder{<1.34098,1.4483,3.2423>,<0.910098,1.99441,3.18699>,r}
+	sphere{<0.910098,1.99441,3.18699>,r}
+	cylinder{<0.910098,1.99441,3.18699>,<1.21412,1.83563,2.74832>,r}
+	sphere{<1.21412,1.83563,2.74832>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.426589,1.81811,3.31078>,<0.461535,1.81024,3.34214>,<0.435901,1.35946,3.47542>}
+	triangle{<0.426589,1.81811,3.31078>,<0.435901,1.35946,3.47542>,<0.194247,1.47555,3.23746>}
+	texture{t1}
+}
+union{
+	cylinder{<0.426589,1.81811,3.31078>,<0.461535,1.81024,3.34214>,r}
+	sphere{<0.461535,1.81024,3.34214>,r}
+	cylinder{<0.461535,1.81024,3.34214>,<0.435901,1.35946,3.47542>,r}
+	sphere{<0.435901,1.35946,3.47542>,r}
+	cylinder{<0.435901,1.35946,3.47542>,<0.194247,1.47555,3.23746>,r}
+	sphere{<0.194247,1.47555,3.23746>,r}
+	cylinder{<0.194247,1.47555,3.23746>,<0.426589,1.81811,3.31078>,r}
+	sphere{<0.426589,1.81811,3.31078>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.426589,1.81811,3.31078>,<0.539308,1.97496,3.07511>,<0.875611,1.99828,3.19382>}
+	triangle{<0.426589,1.81811,3.31078>,<0.875611,1.99828,3.19382>,<0.461535,1.81024,3.34214>}
+	texture{t1}
+}
+union{
+	cylinder{<0.426589,1.81811,3.31078>,<0.539308,1.97496,3.07511>,r}
+	sphere{<0.539308,1.97496,3.07511>,r}
+	cylinder{<0.539308,1.97496,3.07511>,<0.875611,1.99828,3.19382>,r}
+	sphere{<0.875611,1.99828,3.19382>,r}
+	cylinder{<0.875611,1.99828,3.19382>,<0.461535,1.81024,3.34214>,r}
+	sphere{<0.461535,1.81024,3.34214>,r}
+	cylinder{<0.461535,1.81024,3.34214>,<0.426589,1.81811,3.31078>,r}
+	sphere{<0.426589,1.81811,3.31078>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.08748,0.938608,2.83252>,<2.08836,0.937582,2.83329>,<2.00969,0.747708,2.72338>}
+	triangle{<2.08748,0.938608,2.83252>,<2.00969,0.747708,2.72338>,<1.96956,0.81704,2.69217>}
+	texture{t1}
+}
+union{
+	cylinder{<2.08748,0.938608,2.83252>,<2.08836,0.937582,2.83329>,r}
+	sphere{<2.08836,0.937582,2.83329>,r}
+	cylinder{<2.08836,0.937582,2.83329>,<2.00969,0.747708,2.72338>,r}
+	sphere{<2.00969,0.747708,2.72338>,r}
+	cylinder{<2.00969,0.747708,2.72338>,<1.96956,0.81704,2.69217>,r}
+	sphere{<1.96956,0.81704,2.69217>,r}
+	cylinder{<1.96956,0.81704,2.69217>,<2.08748,0.938608,2.83252>,r}
+	sphere{<2.08748,0.938608,2.83252>,r}
+	texture{t2}
+}
+union{
+	triangle{<3,0.40007,2.52605>,<3,0.398457,1.94652>,<2.21577,0.398661,1.94659>}
+	triangle{<3,0.40007,2.52605>,<2.21577,0.398661,1.94659>,<2.21232,0.400268,2.52346>}
+	texture{t1}
+}
+union{
+	cylinder{<3,0.40007,2.52605>,<3,0.398457,1.94652>,r}
+	sphere{<3,0.398457,1.94652>,r}
+	cylinder{<3,0.398457,1.94652>,<2.21577,0.398661,1.94659>,r}
+	sphere{<2.21577,0.398661,1.94659>,r}
+	cylinder{<2.21577,0.398661,1.94659>,<2.21232,0.400268,2.52346>,r}
+	sphere{<2.21232,0.400268,2.52346>,r}
+	cylinder{<2.21232,0.400268,2.52346>,<3,0.40007,2.52605>,r}
+	sphere{<3,0.40007,2.52605>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.96956,0.81704,2.69217>,<1.22576,0.875701,2.56236>,<1.48395,0.988805,2.06172>}
+	triangle{<1.96956,0.81704,2.69217>,<1.48395,0.988805,2.06172>,<1.8911,0.956357,2.13415>}
+	texture{t1}
+}
+union{
+	cylinder{<1.96956,0.81704,2.69217>,<1.22576,0.875701,2.56236>,r}
+	sphere{<1.22576,0.875701,2.56236>,r}
+	cylinder{<1.22576,0.875701,2.56236>,<1.48395,0.988805,2.06172>,r}
+	sphere{<1.48395,0.988805,2.06172>,r}
+	cylinder{<1.48395,0.988805,2.06172>,<1.8911,0.956357,2.13415>,r}
+	sphere{<1.8911,0.956357,2.13415>,r}
+	cylinder{<1.8911,0.956357,2.13415>,<1.96956,0.81704,2.69217>,r}
+	sphere{<1.96956,0.81704,2.69217>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.00969,0.747708,2.72338>,<2.21232,0.400268,2.52346>,<2.04408,0.113312,2.69076>}
+	triangle{<2.00969,0.747708,2.72338>,<2.04408,0.113312,2.69076>,<1.86885,0.307473,2.8639>}
+	texture{t1}
+}
+union{
+	cylinder{<2.00969,0.747708,2.72338>,<2.21232,0.400268,2.52346>,r}
+	sphere{<2.21232,0.400268,2.52346>,r}
+	cylinder{<2.21232,0.400268,2.52346>,<2.04408,0.113312,2.69076>,r}
+	sphere{<2.04408,0.113312,2.69076>,r}
+	cylinder{<2.04408,0.113312,2.69076>,<1.86885,0.307473,2.8639>,r}
+	sphere{<1.86885,0.307473,2.8639>,r}
+	cylinder{<1.86885,0.307473,2.8639>,<2.00969,0.747708,2.72338>,r}
+	sphere{<2.00969,0.747708,2.72338>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.01375,1.84661,2.5924>,<-2.20699,1.48649,2.49954>,<-2.89776,1.72942,2.23841>}
+	triangle{<-2.01375,1.84661,2.5924>,<-2.89776,1.72942,2.23841>,<-2.0917,1.94978,2.56644>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.01375,1.84661,2.5924>,<-2.20699,1.48649,2.49954>,r}
+	sphere{<-2.20699,1.48649,2.49954>,r}
+	cylinder{<-2.20699,1.48649,2.49954>,<-2.89776,1.72942,2.23841>,r}
+	sphere{<-2.89776,1.72942,2.23841>,r}
+	cylinder{<-2.89776,1.72942,2.23841>,<-2.0917,1.94978,2.56644>,r}
+	sphere{<-2.0917,1.94978,2.56644>,r}
+	cylinder{<-2.0917,1.94978,2.56644>,<-2.01375,1.84661,2.5924>,r}
+	sphere{<-2.01375,1.84661,2.5924>,r}
+	texture{t2}
+}
+union{
+	triangle{<-3,3,3.03803>,<-2.11464,3,3.03813>,<-2.3282,2.26727,3.03859>}
+	triangle{<-3,3,3.03803>,<-2.3282,2.26727,3.03859>,<-3,2.26738,3.03851>}
+	texture{t1}
+}
+union{
+	cylinder{<-3,3,3.03803>,<-2.11464,3,3.03813>,r}
+	sphere{<-2.11464,3,3.03813>,r}
+	cylinder{<-2.11464,3,3.03813>,<-2.3282,2.26727,3.03859>,r}
+	sphere{<-2.3282,2.26727,3.03859>,r}
+	cylinder{<-2.3282,2.26727,3.03859>,<-3,2.26738,3.03851>,r}
+	sphere{<-3,2.26738,3.03851>,r}
+	cylinder{<-3,2.26738,3.03851>,<-3,3,3.03803>,r}
+	sphere{<-3,3,3.03803>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.282725,1.84514,2.1612>,<0.310072,1.82424,2.19316>,<0.338843,1.81532,2.14813>}
+	triangle{<-0.282725,1.84514,2.1612>,<0.338843,1.81532,2.14813>,<-0.251375,1.79469,1.87222>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.282725,1.84514,2.1612>,<0.310072,1.82424,2.19316>,r}
+	sphere{<0.310072,1.82424,2.19316>,r}
+	cylinder{<0.310072,1.82424,2.19316>,<0.338843,1.81532,2.14813>,r}
+	sphere{<0.338843,1.81532,2.14813>,r}
+	cylinder{<0.338843,1.81532,2.14813>,<-0.251375,1.79469,1.87222>,r}
+	sphere{<-0.251375,1.79469,1.87222>,r}
+	cylinder{<-0.251375,1.79469,1.87222>,<-0.282725,1.84514,2.1612>,r}
+	sphere{<-0.282725,1.84514,2.1612>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.0787577,2.84046,2.8347>,<-0.0787587,3,2.83471>,<0.192644,3,2.74776>}
+	triangle{<-0.0787577,2.84046,2.8347>,<0.192644,3,2.74776>,<0.114215,2.72435,2.77287>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.0787577,2.84046,2.8347>,<-0.0787587,3,2.83471>,r}
+	sphere{<-0.0787587,3,2.83471>,r}
+	cylinder{<-0.0787587,3,2.83471>,<0.192644,3,2.74776>,r}
+	sphere{<0.192644,3,2.74776>,r}
+	cylinder{<0.192644,3,2.74776>,<0.114215,2.72435,2.77287>,r}
+	sphere{<0.114215,2.72435,2.77287>,r}
+	cylinder{<0.114215,2.72435,2.77287>,<-0.0787577,2.84046,2.8347>,r}
+	sphere{<-0.0787577,2.84046,2.8347>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.448769,2.02577,2.26775>,<-0.282725,1.84514,2.1612>,<-0.594891,1.44239,2.66906>}
+	triangle{<-0.448769,2.02577,2.26775>,<-0.594891,1.44239,2.66906>,<-0.756296,1.82695,2.68605>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.448769,2.02577,2.26775>,<-0.282725,1.84514,2.1612>,r}
+	sphere{<-0.282725,1.84514,2.1612>,r}
+	cylinder{<-0.282725,1.84514,2.1612>,<-0.594891,1.44239,2.66906>,r}
+	sphere{<-0.594891,1.44239,2.66906>,r}
+	cylinder{<-0.594891,1.44239,2.66906>,<-0.756296,1.82695,2.68605>,r}
+	sphere{<-0.756296,1.82695,2.68605>,r}
+	cylinder{<-0.756296,1.82695,2.68605>,<-0.448769,2.02577,2.26775>,r}
+	sphere{<-0.448769,2.02577,2.26775>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.51173,2.05981,2.32901>,<-1.46253,2.09126,2.34532>,<-1.19522,1.8677,2.69725>}
+	triangle{<-1.51173,2.05981,2.32901>,<-1.19522,1.8677,2.69725>,<-1.53052,1.94581,2.39088>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.51173,2.05981,2.32901>,<-1.46253,2.09126,2.34532>,r}
+	sphere{<-1.46253,2.09126,2.34532>,r}
+	cylinder{<-1.46253,2.09126,2.34532>,<-1.19522,1.8677,2.69725>,r}
+	sphere{<-1.19522,1.8677,2.69725>,r}
+	cylinder{<-1.19522,1.8677,2.69725>,<-1.53052,1.94581,2.39088>,r}
+	sphere{<-1.53052,1.94581,2.39088>,r}
+	cylinder{<-1.53052,1.94581,2.39088>,<-1.51173,2.05981,2.32901>,r}
+	sphere{<-1.51173,2.05981,2.32901>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.761168,0.88678,2.04661>,<-0.928375,0.820495,2.00254>,<-0.944606,0.813779,2.02568>}
+	triangle{<-0.761168,0.88678,2.04661>,<-0.944606,0.813779,2.02568>,<-0.768417,0.883599,2.07457>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.761168,0.88678,2.04661>,<-0.928375,0.820495,2.00254>,r}
+	sphere{<-0.928375,0.820495,2.00254>,r}
+	cylinder{<-0.928375,0.820495,2.00254>,<-0.944606,0.813779,2.02568>,r}
+	sphere{<-0.944606,0.813779,2.02568>,r}
+	cylinder{<-0.944606,0.813779,2.02568>,<-0.768417,0.883599,2.07457>,r}
+	sphere{<-0.768417,0.883599,2.07457>,r}
+	cylinder{<-0.768417,0.883599,2.07457>,<-0.761168,0.88678,2.04661>,r}
+	sphere{<-0.761168,0.88678,2.04661>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.03726,3,1.98318>,<-1.70611,3,2.45169>,<-1.80871,2.29843,2.30586>}
+	triangle{<-2.03726,3,1.98318>,<-1.80871,2.29843,2.30586>,<-2.03722,2.40217,1.98266>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.03726,3,1.98318>,<-1.70611,3,2.45169>,r}
+	sphere{<-1.70611,3,2.45169>,r}
+	cylinder{<-1.70611,3,2.45169>,<-1.80871,2.29843,2.30586>,r}
+	sphere{<-1.80871,2.29843,2.30586>,r}
+	cylinder{<-1.80871,2.29843,2.30586>,<-2.03722,2.40217,1.98266>,r}
+	sphere{<-2.03722,2.40217,1.98266>,r}
+	cylinder{<-2.03722,2.40217,1.98266>,<-2.03726,3,1.98318>,r}
+	sphere{<-2.03726,3,1.98318>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.0787577,2.84046,2.8347>,<-0.0895464,2.83375,2.84988>,<-0.0895384,3,2.84988>}
+	triangle{<-0.0787577,2.84046,2.8347>,<-0.0895384,3,2.84988>,<-0.0787587,3,2.83471>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.0787577,2.84046,2.8347>,<-0.0895464,2.83375,2.84988>,r}
+	sphere{<-0.0895464,2.83375,2.84988>,r}
+	cylinder{<-0.0895464,2.83375,2.84988>,<-0.0895384,3,2.84988>,r}
+	sphere{<-0.0895384,3,2.84988>,r}
+	cylinder{<-0.0895384,3,2.84988>,<-0.0787587,3,2.83471>,r}
+	sphere{<-0.0787587,3,2.83471>,r}
+	cylinder{<-0.0787587,3,2.83471>,<-0.0787577,2.84046,2.8347>,r}
+	sphere{<-0.0787577,2.84046,2.8347>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.395699,1.92949,3.38157>,<-0.682716,2.11364,3.03068>,<-0.0895464,2.83375,2.84988>}
+	triangle{<-0.395699,1.92949,3.38157>,<-0.0895464,2.83375,2.84988>,<-0.061335,2.16227,3.42216>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.395699,1.92949,3.38157>,<-0.682716,2.11364,3.03068>,r}
+	sphere{<-0.682716,2.11364,3.03068>,r}
+	cylinder{<-0.682716,2.11364,3.03068>,<-0.0895464,2.83375,2.84988>,r}
+	sphere{<-0.0895464,2.83375,2.84988>,r}
+	cylinder{<-0.0895464,2.83375,2.84988>,<-0.061335,2.16227,3.42216>,r}
+	sphere{<-0.061335,2.16227,3.42216>,r}
+	cylinder{<-0.061335,2.16227,3.42216>,<-0.395699,1.92949,3.38157>,r}
+	sphere{<-0.395699,1.92949,3.38157>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.8733,2.02158,1.82387>,<1.92566,1.83679,1.63752>,<1.8586,1.72069,1.88433>}
+	triangle{<1.8733,2.02158,1.82387>,<1.8586,1.72069,1.88433>,<1.82248,1.89097,2.01191>}
+	texture{t1}
+}
+union{
+	cylinder{<1.8733,2.02158,1.82387>,<1.92566,1.83679,1.63752>,r}
+	sphere{<1.92566,1.83679,1.63752>,r}
+	cylinder{<1.92566,1.83679,1.63752>,<1.8586,1.72069,1.88433>,r}
+	sphere{<1.8586,1.72069,1.88433>,r}
+	cylinder{<1.8586,1.72069,1.88433>,<1.82248,1.89097,2.01191>,r}
+	sphere{<1.82248,1.89097,2.01191>,r}
+	cylinder{<1.82248,1.89097,2.01191>,<1.8733,2.02158,1.82387>,r}
+	sphere{<1.8733,2.02158,1.82387>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.21412,1.83563,2.74832>,<1.38112,2.01282,2.59592>,<1.32962,1.98023,2.37709>}
+	triangle{<1.21412,1.83563,2.74832>,<1.32962,1.98023,2.37709>,<1.06808,1.72207,2.38277>}
+	texture{t1}
+}
+union{
+	cylinder{<1.21412,1.83563,2.74832>,<1.38112,2.01282,2.59592>,r}
+	sphere{<1.38112,2.01282,2.59592>,r}
+	cylinder{<1.38112,2.01282,2.59592>,<1.32962,1.98023,2.37709>,r}
+	sphere{<1.32962,1.98023,2.37709>,r}
+	cylinder{<1.32962,1.98023,2.37709>,<1.06808,1.72207,2.38277>,r}
+	sphere{<1.06808,1.72207,2.38277>,r}
+	cylinder{<1.06808,1.72207,2.38277>,<1.21412,1.83563,2.74832>,r}
+	sphere{<1.21412,1.83563,2.74832>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.338843,1.81532,2.14813>,<0.310072,1.82424,2.19316>,<0.390356,1.73073,2.31247>}
+	triangle{<0.338843,1.81532,2.14813>,<0.390356,1.73073,2.31247>,<0.522273,1.67452,2.16064>}
+	texture{t1}
+}
+union{
+	cylinder{<0.338843,1.81532,2.14813>,<0.310072,1.82424,2.19316>,r}
+	sphere{<0.310072,1.82424,2.19316>,r}
+	cylinder{<0.310072,1.82424,2.19316>,<0.390356,1.73073,2.31247>,r}
+	sphere{<0.390356,1.73073,2.31247>,r}
+	cylinder{<0.390356,1.73073,2.31247>,<0.522273,1.67452,2.16064>,r}
+	sphere{<0.522273,1.67452,2.16064>,r}
+	cylinder{<0.522273,1.67452,2.16064>,<0.338843,1.81532,2.14813>,r}
+	sphere{<0.338843,1.81532,2.14813>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.539308,1.97496,3.07511>,<0.390356,1.73073,2.31247>,<0.310072,1.82424,2.19316>}
+	triangle{<0.539308,1.97496,3.07511>,<0.310072,1.82424,2.19316>,<0.114215,2.72435,2.77287>}
+	texture{t1}
+}
+union{
+	cylinder{<0.539308,1.97496,3.07511>,<0.390356,1.73073,2.31247>,r}
+	sphere{<0.390356,1.73073,2.31247>,r}
+	cylinder{<0.390356,1.73073,2.31247>,<0.310072,1.82424,2.19316>,r}
+	sphere{<0.310072,1.82424,2.19316>,r}
+	cylinder{<0.310072,1.82424,2.19316>,<0.114215,2.72435,2.77287>,r}
+	sphere{<0.114215,2.72435,2.77287>,r}
+	cylinder{<0.114215,2.72435,2.77287>,<0.539308,1.97496,3.07511>,r}
+	sphere{<0.539308,1.97496,3.07511>,r}
+	texture{t2}
+}
+union{
+	triangle{<3,1.4406,2.45906>,<2.29107,1.44043,2.45895>,<2.09352,1.97131,2.67801>}
+	triangle{<3,1.4406,2.45906>,<2.09352,1.97131,2.67801>,<3,1.9712,2.67802>}
+	texture{t1}
+}
+union{
+	cylinder{<3,1.4406,2.45906>,<2.29107,1.44043,2.45895>,r}
+	sphere{<2.29107,1.44043,2.45895>,r}
+	cylinder{<2.29107,1.44043,2.45895>,<2.09352,1.97131,2.67801>,r}
+	sphere{<2.09352,1.97131,2.67801>,r}
+	cylinder{<2.09352,1.97131,2.67801>,<3,1.9712,2.67802>,r}
+	sphere{<3,1.9712,2.67802>,r}
+	cylinder{<3,1.9712,2.67802>,<3,1.4406,2.45906>,r}
+	sphere{<3,1.4406,2.45906>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.66858,2.95941,1.98386>,<2.08332,1.98261,2.67007>,<1.82248,1.89097,2.01191>}
+	triangle{<2.66858,2.95941,1.98386>,<1.82248,1.89097,2.01191>,<1.8733,2.02158,1.82387>}
+	texture{t1}
+}
+union{
+	cylinder{<2.66858,2.95941,1.98386>,<2.08332,1.98261,2.67007>,r}
+	sphere{<2.08332,1.98261,2.67007>,r}
+	cylinder{<2.08332,1.98261,2.67007>,<1.82248,1.89097,2.01191>,r}
+	sphere{<1.82248,1.89097,2.01191>,r}
+	cylinder{<1.82248,1.89097,2.01191>,<1.8733,2.02158,1.82387>,r}
+	sphere{<1.8733,2.02158,1.82387>,r}
+	cylinder{<1.8733,2.02158,1.82387>,<2.66858,2.95941,1.98386>,r}
+	sphere{<2.66858,2.95941,1.98386>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.08118,1.98315,2.6726>,<1.38112,2.01282,2.59592>,<1.30591,3,3.02196>}
+	triangle{<2.08118,1.98315,2.6726>,<1.30591,3,3.02196>,<1.74062,3,3.07771>}
+	texture{t1}
+}
+union{
+	cylinder{<2.08118,1.98315,2.6726>,<1.38112,2.01282,2.59592>,r}
+	sphere{<1.38112,2.01282,2.59592>,r}
+	cylinder{<1.38112,2.01282,2.59592>,<1.30591,3,3.02196>,r}
+	sphere{<1.30591,3,3.02196>,r}
+	cylinder{<1.30591,3,3.02196>,<1.74062,3,3.07771>,r}
+	sphere{<1.74062,3,3.07771>,r}
+	cylinder{<1.74062,3,3.07771>,<2.08118,1.98315,2.6726>,r}
+	sphere{<2.08118,1.98315,2.6726>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.08332,1.98261,2.67007>,<2.08118,1.98315,2.6726>,<2.08965,1.97179,2.68372>}
+	triangle{<2.08332,1.98261,2.67007>,<2.08965,1.97179,2.68372>,<2.09352,1.97131,2.67801>}
+	texture{t1}
+}
+union{
+	cylinder{<2.08332,1.98261,2.67007>,<2.08118,1.98315,2.6726>,r}
+	sphere{<2.08118,1.98315,2.6726>,r}
+	cylinder{<2.08118,1.98315,2.6726>,<2.08965,1.97179,2.68372>,r}
+	sphere{<2.08965,1.97179,2.68372>,r}
+	cylinder{<2.08965,1.97179,2.68372>,<2.09352,1.97131,2.67801>,r}
+	sphere{<2.09352,1.97131,2.67801>,r}
+	cylinder{<2.09352,1.97131,2.67801>,<2.08332,1.98261,2.67007>,r}
+	sphere{<2.08332,1.98261,2.67007>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.74275,-1.93342,3.50333>,<-1.05818,-2.10499,3.19615>,<-1.08115,-3,3.6169>}
+	triangle{<-1.74275,-1.93342,3.50333>,<-1.08115,-3,3.6169>,<-1.32731,-3,3.75547>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.74275,-1.93342,3.50333>,<-1.05818,-2.10499,3.19615>,r}
+	sphere{<-1.05818,-2.10499,3.19615>,r}
+	cylinder{<-1.05818,-2.10499,3.19615>,<-1.08115,-3,3.6169>,r}
+	sphere{<-1.08115,-3,3.6169>,r}
+	cylinder{<-1.08115,-3,3.6169>,<-1.32731,-3,3.75547>,r}
+	sphere{<-1.32731,-3,3.75547>,r}
+	cylinder{<-1.32731,-3,3.75547>,<-1.74275,-1.93342,3.50333>,r}
+	sphere{<-1.74275,-1.93342,3.50333>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.74275,-1.93342,3.50333>,<-1.32731,-3,3.75547>,<-2.23699,-3,3.20419>}
+	triangle{<-1.74275,-1.93342,3.50333>,<-2.23699,-3,3.20419>,<-1.87704,-1.90116,3.42194>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.74275,-1.93342,3.50333>,<-1.32731,-3,3.75547>,r}
+	sphere{<-1.32731,-3,3.75547>,r}
+	cylinder{<-1.32731,-3,3.75547>,<-2.23699,-3,3.20419>,r}
+	sphere{<-2.23699,-3,3.20419>,r}
+	cylinder{<-2.23699,-3,3.20419>,<-1.87704,-1.90116,3.42194>,r}
+	sphere{<-1.87704,-1.90116,3.42194>,r}
+	cylinder{<-1.87704,-1.90116,3.42194>,<-1.74275,-1.93342,3.50333>,r}
+	sphere{<-1.74275,-1.93342,3.50333>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.82172,-3,4.80901>,<-1.83383,-2.00045,4.33305>,<-1.66636,-2.04318,4.25236>}
+	triangle{<-2.82172,-3,4.80901>,<-1.66636,-2.04318,4.25236>,<-1.31213,-3,4.08168>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.82172,-3,4.80901>,<-1.83383,-2.00045,4.33305>,r}
+	sphere{<-1.83383,-2.00045,4.33305>,r}
+	cylinder{<-1.83383,-2.00045,4.33305>,<-1.66636,-2.04318,4.25236>,r}
+	sphere{<-1.66636,-2.04318,4.25236>,r}
+	cylinder{<-1.66636,-2.04318,4.25236>,<-1.31213,-3,4.08168>,r}
+	sphere{<-1.31213,-3,4.08168>,r}
+	cylinder{<-1.31213,-3,4.08168>,<-2.82172,-3,4.80901>,r}
+	sphere{<-2.82172,-3,4.80901>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.77035,-1.71069,4.77935>,<-3,-2.82018,5.65658>,<-3,-2.17917,5.69057>}
+	triangle{<-1.77035,-1.71069,4.77935>,<-3,-2.17917,5.69057>,<-1.78448,-1.67321,4.7921>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.77035,-1.71069,4.77935>,<-3,-2.82018,5.65658>,r}
+	sphere{<-3,-2.82018,5.65658>,r}
+	cylinder{<-3,-2.82018,5.65658>,<-3,-2.17917,5.69057>,r}
+	sphere{<-3,-2.17917,5.69057>,r}
+	cylinder{<-3,-2.17917,5.69057>,<-1.78448,-1.67321,4.7921>,r}
+	sphere{<-1.78448,-1.67321,4.7921>,r}
+	cylinder{<-1.78448,-1.67321,4.7921>,<-1.77035,-1.71069,4.77935>,r}
+	sphere{<-1.77035,-1.71069,4.77935>,r}
+	texture{t2}
+}
+union{
+	triangle{<-3,-2.17917,5.69057>,<-3,-1.20264,4.78953>,<-2.15236,-1.24226,4.5251>}
+	triangle{<-3,-2.17917,5.69057>,<-2.15236,-1.24226,4.5251>,<-1.78448,-1.67321,4.7921>}
+	texture{t1}
+}
+union{
+	cylinder{<-3,-2.17917,5.69057>,<-3,-1.20264,4.78953>,r}
+	sphere{<-3,-1.20264,4.78953>,r}
+	cylinder{<-3,-1.20264,4.78953>,<-2.15236,-1.24226,4.5251>,r}
+	sphere{<-2.15236,-1.24226,4.5251>,r}
+	cylinder{<-2.15236,-1.24226,4.5251>,<-1.78448,-1.67321,4.7921>,r}
+	sphere{<-1.78448,-1.67321,4.7921>,r}
+	cylinder{<-1.78448,-1.67321,4.7921>,<-3,-2.17917,5.69057>,r}
+	sphere{<-3,-2.17917,5.69057>,r}
+	texture{t2}
+}
+union{
+	triangle{<-3,-1.30725,4.09055>,<-2.33271,-1.30729,4.09051>,<-2.15236,-1.24226,4.5251>}
+	triangle{<-3,-1.30725,4.09055>,<-2.15236,-1.24226,4.5251>,<-3,-1.20264,4.78953>}
+	texture{t1}
+}
+union{
+	cylinder{<-3,-1.30725,4.09055>,<-2.33271,-1.30729,4.09051>,r}
+	sphere{<-2.33271,-1.30729,4.09051>,r}
+	cylinder{<-2.33271,-1.30729,4.09051>,<-2.15236,-1.24226,4.5251>,r}
+	sphere{<-2.15236,-1.24226,4.5251>,r}
+	cylinder{<-2.15236,-1.24226,4.5251>,<-3,-1.20264,4.78953>,r}
+	sphere{<-3,-1.20264,4.78953>,r}
+	cylinder{<-3,-1.20264,4.78953>,<-3,-1.30725,4.09055>,r}
+	sphere{<-3,-1.30725,4.09055>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.618632,-1.75152,3.33933>,<-0.581953,-1.74859,2.95253>,<-1.0361,-2.11438,2.79581>}
+	triangle{<-0.618632,-1.75152,3.33933>,<-1.0361,-2.11438,2.79581>,<-1.05818,-2.10499,3.19615>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.618632,-1.75152,3.33933>,<-0.581953,-1.74859,2.95253>,r}
+	sphere{<-0.581953,-1.74859,2.95253>,r}
+	cylinder{<-0.581953,-1.74859,2.95253>,<-1.0361,-2.11438,2.79581>,r}
+	sphere{<-1.0361,-2.11438,2.79581>,r}
+	cylinder{<-1.0361,-2.11438,2.79581>,<-1.05818,-2.10499,3.19615>,r}
+	sphere{<-1.05818,-2.10499,3.19615>,r}
+	cylinder{<-1.05818,-2.10499,3.19615>,<-0.618632,-1.75152,3.33933>,r}
+	sphere{<-0.618632,-1.75152,3.33933>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.87704,-1.90116,3.42194>,<-1.90782,-1.8448,3.45824>,<-1.75209,-1.90598,3.52595>}
+	triangle{<-1.87704,-1.90116,3.42194>,<-1.75209,-1.90598,3.52595>,<-1.74275,-1.93342,3.50333>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.87704,-1.90116,3.42194>,<-1.90782,-1.8448,3.45824>,r}
+	sphere{<-1.90782,-1.8448,3.45824>,r}
+	cylinder{<-1.90782,-1.8448,3.45824>,<-1.75209,-1.90598,3.52595>,r}
+	sphere{<-1.75209,-1.90598,3.52595>,r}
+	cylinder{<-1.75209,-1.90598,3.52595>,<-1.74275,-1.93342,3.50333>,r}
+	sphere{<-1.74275,-1.93342,3.50333>,r}
+	cylinder{<-1.74275,-1.93342,3.50333>,<-1.87704,-1.90116,3.42194>,r}
+	sphere{<-1.87704,-1.90116,3.42194>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.20276,-1.27652,3.62822>,<-0.972824,-1.19267,3.46743>,<-0.707811,-1.62458,3.45614>}
+	triangle{<-1.20276,-1.27652,3.62822>,<-0.707811,-1.62458,3.45614>,<-1.16522,-1.48931,3.67654>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.20276,-1.27652,3.62822>,<-0.972824,-1.19267,3.46743>,r}
+	sphere{<-0.972824,-1.19267,3.46743>,r}
+	cylinder{<-0.972824,-1.19267,3.46743>,<-0.707811,-1.62458,3.45614>,r}
+	sphere{<-0.707811,-1.62458,3.45614>,r}
+	cylinder{<-0.707811,-1.62458,3.45614>,<-1.16522,-1.48931,3.67654>,r}
+	sphere{<-1.16522,-1.48931,3.67654>,r}
+	cylinder{<-1.16522,-1.48931,3.67654>,<-1.20276,-1.27652,3.62822>,r}
+	sphere{<-1.20276,-1.27652,3.62822>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.06475,-1.57701,2.91705>,<-1.80675,-1.14664,3.3704>,<-1.80259,-1.15454,3.38578>}
+	triangle{<-2.06475,-1.57701,2.91705>,<-1.80259,-1.15454,3.38578>,<-1.91517,-1.83171,3.45339>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.06475,-1.57701,2.91705>,<-1.80675,-1.14664,3.3704>,r}
+	sphere{<-1.80675,-1.14664,3.3704>,r}
+	cylinder{<-1.80675,-1.14664,3.3704>,<-1.80259,-1.15454,3.38578>,r}
+	sphere{<-1.80259,-1.15454,3.38578>,r}
+	cylinder{<-1.80259,-1.15454,3.38578>,<-1.91517,-1.83171,3.45339>,r}
+	sphere{<-1.91517,-1.83171,3.45339>,r}
+	cylinder{<-1.91517,-1.83171,3.45339>,<-2.06475,-1.57701,2.91705>,r}
+	sphere{<-2.06475,-1.57701,2.91705>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.103338,-3,3.45781>,<-0.879659,-3,3.7617>,<-0.45251,-2.0295,3.59451>}
+	triangle{<-0.103338,-3,3.45781>,<-0.45251,-2.0295,3.59451>,<-0.103315,-2.21448,3.45782>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.103338,-3,3.45781>,<-0.879659,-3,3.7617>,r}
+	sphere{<-0.879659,-3,3.7617>,r}
+	cylinder{<-0.879659,-3,3.7617>,<-0.45251,-2.0295,3.59451>,r}
+	sphere{<-0.45251,-2.0295,3.59451>,r}
+	cylinder{<-0.45251,-2.0295,3.59451>,<-0.103315,-2.21448,3.45782>,r}
+	sphere{<-0.103315,-2.21448,3.45782>,r}
+	cylinder{<-0.103315,-2.21448,3.45782>,<-0.103338,-3,3.45781>,r}
+	sphere{<-0.103338,-3,3.45781>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.841862,-2.51456,4.53931>,<-0.83528,-2.52129,4.55188>,<-0.835293,-3,4.55189>}
+	triangle{<-0.841862,-2.51456,4.53931>,<-0.835293,-3,4.55189>,<-0.983325,-3,4.26938>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.841862,-2.51456,4.53931>,<-0.83528,-2.52129,4.55188>,r}
+	sphere{<-0.83528,-2.52129,4.55188>,r}
+	cylinder{<-0.83528,-2.52129,4.55188>,<-0.835293,-3,4.55189>,r}
+	sphere{<-0.835293,-3,4.55189>,r}
+	cylinder{<-0.835293,-3,4.55189>,<-0.983325,-3,4.26938>,r}
+	sphere{<-0.983325,-3,4.26938>,r}
+	cylinder{<-0.983325,-3,4.26938>,<-0.841862,-2.51456,4.53931>,r}
+	sphere{<-0.841862,-2.51456,4.53931>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.450412,-2.20737,3.89458>,<0.450377,-3,3.89457>,<0.465347,-3,4.56027>}
+	triangle{<0.450412,-2.20737,3.89458>,<0.465347,-3,4.56027>,<0.451261,-2.19032,3.93233>}
+	texture{t1}
+}
+union{
+	cylinder{<0.450412,-2.20737,3.89458>,<0.450377,-3,3.89457>,r}
+	sphere{<0.450377,-3,3.89457>,r}
+	cylinder{<0.450377,-3,3.89457>,<0.465347,-3,4.56027>,r}
+	sphere{<0.465347,-3,4.56027>,r}
+	cylinder{<0.465347,-3,4.56027>,<0.451261,-2.19032,3.93233>,r}
+	sphere{<0.451261,-2.19032,3.93233>,r}
+	cylinder{<0.451261,-2.19032,3.93233>,<0.450412,-2.20737,3.89458>,r}
+	sphere{<0.450412,-2.20737,3.89458>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.198842,-1.78447,4.3205>,<-0.289062,-1.90273,4.51309>,<-0.343237,-1.81023,4.37561>}
+	triangle{<-0.198842,-1.78447,4.3205>,<-0.343237,-1.81023,4.37561>,<-0.252271,-1.77204,4.30689>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.198842,-1.78447,4.3205>,<-0.289062,-1.90273,4.51309>,r}
+	sphere{<-0.289062,-1.90273,4.51309>,r}
+	cylinder{<-0.289062,-1.90273,4.51309>,<-0.343237,-1.81023,4.37561>,r}
+	sphere{<-0.343237,-1.81023,4.37561>,r}
+	cylinder{<-0.343237,-1.81023,4.37561>,<-0.252271,-1.77204,4.30689>,r}
+	sphere{<-0.252271,-1.77204,4.30689>,r}
+	cylinder{<-0.252271,-1.77204,4.30689>,<-0.198842,-1.78447,4.3205>,r}
+	sphere{<-0.198842,-1.78447,4.3205>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.458685,-1.84752,3.98564>,<-0.252271,-1.77204,4.30689>,<-0.343237,-1.81023,4.37561>}
+	triangle{<-0.458685,-1.84752,3.98564>,<-0.343237,-1.81023,4.37561>,<-0.529136,-1.88232,4.26165>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.458685,-1.84752,3.98564>,<-0.252271,-1.77204,4.30689>,r}
+	sphere{<-0.252271,-1.77204,4.30689>,r}
+	cylinder{<-0.252271,-1.77204,4.30689>,<-0.343237,-1.81023,4.37561>,r}
+	sphere{<-0.343237,-1.81023,4.37561>,r}
+	cylinder{<-0.343237,-1.81023,4.37561>,<-0.529136,-1.88232,4.26165>,r}
+	sphere{<-0.529136,-1.88232,4.26165>,r}
+	cylinder{<-0.529136,-1.88232,4.26165>,<-0.458685,-1.84752,3.98564>,r}
+	sphere{<-0.458685,-1.84752,3.98564>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.841862,-2.51456,4.53931>,<-1.48051,-1.93905,4.39903>,<-1.14087,-1.62871,4.24007>}
+	triangle{<-0.841862,-2.51456,4.53931>,<-1.14087,-1.62871,4.24007>,<-0.529136,-1.88232,4.26165>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.841862,-2.51456,4.53931>,<-1.48051,-1.93905,4.39903>,r}
+	sphere{<-1.48051,-1.93905,4.39903>,r}
+	cylinder{<-1.48051,-1.93905,4.39903>,<-1.14087,-1.62871,4.24007>,r}
+	sphere{<-1.14087,-1.62871,4.24007>,r}
+	cylinder{<-1.14087,-1.62871,4.24007>,<-0.529136,-1.88232,4.26165>,r}
+	sphere{<-0.529136,-1.88232,4.26165>,r}
+	cylinder{<-0.529136,-1.88232,4.26165>,<-0.841862,-2.51456,4.53931>,r}
+	sphere{<-0.841862,-2.51456,4.53931>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.450412,-2.20737,3.89458>,<0.450377,-3,3.89457>,<-0.103338,-3,3.45781>}
+	triangle{<0.450412,-2.20737,3.89458>,<-0.103338,-3,3.45781>,<-0.103315,-2.21448,3.45782>}
+	texture{t1}
+}
+union{
+	cylinder{<0.450412,-2.20737,3.89458>,<0.450377,-3,3.89457>,r}
+	sphere{<0.450377,-3,3.89457>,r}
+	cylinder{<0.450377,-3,3.89457>,<-0.103338,-3,3.45781>,r}
+	sphere{<-0.103338,-3,3.45781>,r}
+	cylinder{<-0.103338,-3,3.45781>,<-0.103315,-2.21448,3.45782>,r}
+	sphere{<-0.103315,-2.21448,3.45782>,r}
+	cylinder{<-0.103315,-2.21448,3.45782>,<0.450412,-2.20737,3.89458>,r}
+	sphere{<0.450412,-2.20737,3.89458>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.12746,-3,3.24817>,<1.12431,-3,3.31239>,<1.12352,-2.41028,3.3131>}
+	triangle{<1.12746,-3,3.24817>,<1.12352,-2.41028,3.3131>,<1.12675,-2.40884,3.24735>}
+	texture{t1}
+}
+union{
+	cylinder{<1.12746,-3,3.24817>,<1.12431,-3,3.31239>,r}
+	sphere{<1.12431,-3,3.31239>,r}
+	cylinder{<1.12431,-3,3.31239>,<1.12352,-2.41028,3.3131>,r}
+	sphere{<1.12352,-2.41028,3.3131>,r}
+	cylinder{<1.12352,-2.41028,3.3131>,<1.12675,-2.40884,3.24735>,r}
+	sphere{<1.12675,-2.40884,3.24735>,r}
+	cylinder{<1.12675,-2.40884,3.24735>,<1.12746,-3,3.24817>,r}
+	sphere{<1.12746,-3,3.24817>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.458685,-1.84752,3.98564>,<-0.45251,-2.0295,3.59451>,<-0.609493,-1.75217,3.34622>}
+	triangle{<-0.458685,-1.84752,3.98564>,<-0.609493,-1.75217,3.34622>,<-0.62471,-1.66177,3.471>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.458685,-1.84752,3.98564>,<-0.45251,-2.0295,3.59451>,r}
+	sphere{<-0.45251,-2.0295,3.59451>,r}
+	cylinder{<-0.45251,-2.0295,3.59451>,<-0.609493,-1.75217,3.34622>,r}
+	sphere{<-0.609493,-1.75217,3.34622>,r}
+	cylinder{<-0.609493,-1.75217,3.34622>,<-0.62471,-1.66177,3.471>,r}
+	sphere{<-0.62471,-1.66177,3.471>,r}
+	cylinder{<-0.62471,-1.66177,3.471>,<-0.458685,-1.84752,3.98564>,r}
+	sphere{<-0.458685,-1.84752,3.98564>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.213418,-1.48486,4.29493>,<0.716039,-1.88091,3.96224>,<0.451261,-2.19032,3.93233>}
+	triangle{<0.213418,-1.48486,4.29493>,<0.451261,-2.19032,3.93233>,<-0.198842,-1.78447,4.3205>}
+	texture{t1}
+}
+union{
+	cylinder{<0.213418,-1.48486,4.29493>,<0.716039,-1.88091,3.96224>,r}
+	sphere{<0.716039,-1.88091,3.96224>,r}
+	cylinder{<0.716039,-1.88091,3.96224>,<0.451261,-2.19032,3.93233>,r}
+	sphere{<0.451261,-2.19032,3.93233>,r}
+	cylinder{<0.451261,-2.19032,3.93233>,<-0.198842,-1.78447,4.3205>,r}
+	sphere{<-0.198842,-1.78447,4.3205>,r}
+	cylinder{<-0.198842,-1.78447,4.3205>,<0.213418,-1.48486,4.29493>,r}
+	sphere{<0.213418,-1.48486,4.29493>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.79505,-3,4.01806>,<1.78919,-3,4.23088>,<1.78913,-2.52314,4.23083>}
+	triangle{<1.79505,-3,4.01806>,<1.78913,-2.52314,4.23083>,<1.79495,-2.46323,4.01935>}
+	texture{t1}
+}
+union{
+	cylinder{<1.79505,-3,4.01806>,<1.78919,-3,4.23088>,r}
+	sphere{<1.78919,-3,4.23088>,r}
+	cylinder{<1.78919,-3,4.23088>,<1.78913,-2.52314,4.23083>,r}
+	sphere{<1.78913,-2.52314,4.23083>,r}
+	cylinder{<1.78913,-2.52314,4.23083>,<1.79495,-2.46323,4.01935>,r}
+	sphere{<1.79495,-2.46323,4.01935>,r}
+	cylinder{<1.79495,-2.46323,4.01935>,<1.79505,-3,4.01806>,r}
+	sphere{<1.79505,-3,4.01806>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.10441,-1.80555,3.98163>,<1.06006,-1.85916,4.2894>,<0.716039,-1.88091,3.96224>}
+	triangle{<1.10441,-1.80555,3.98163>,<0.716039,-1.88091,3.96224>,<0.738381,-1.8712,3.92633>}
+	texture{t1}
+}
+union{
+	cylinder{<1.10441,-1.80555,3.98163>,<1.06006,-1.85916,4.2894>,r}
+	sphere{<1.06006,-1.85916,4.2894>,r}
+	cylinder{<1.06006,-1.85916,4.2894>,<0.716039,-1.88091,3.96224>,r}
+	sphere{<0.716039,-1.88091,3.96224>,r}
+	cylinder{<0.716039,-1.88091,3.96224>,<0.738381,-1.8712,3.92633>,r}
+	sphere{<0.738381,-1.8712,3.92633>,r}
+	cylinder{<0.738381,-1.8712,3.92633>,<1.10441,-1.80555,3.98163>,r}
+	sphere{<1.10441,-1.80555,3.98163>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.47471,-2.05985,3.6835>,<1.8043,-1.74576,3.45923>,<2.12546,-2.03883,3.70893>}
+	triangle{<1.47471,-2.05985,3.6835>,<2.12546,-2.03883,3.70893>,<1.79495,-2.46323,4.01935>}
+	texture{t1}
+}
+union{
+	cylinder{<1.47471,-2.05985,3.6835>,<1.8043,-1.74576,3.45923>,r}
+	sphere{<1.8043,-1.74576,3.45923>,r}
+	cylinder{<1.8043,-1.74576,3.45923>,<2.12546,-2.03883,3.70893>,r}
+	sphere{<2.12546,-2.03883,3.70893>,r}
+	cylinder{<2.12546,-2.03883,3.70893>,<1.79495,-2.46323,4.01935>,r}
+	sphere{<1.79495,-2.46323,4.01935>,r}
+	cylinder{<1.79495,-2.46323,4.01935>,<1.47471,-2.05985,3.6835>,r}
+	sphere{<1.47471,-2.05985,3.6835>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.06169,-3,4.54175>,<1.78919,-3,4.23088>,<1.78913,-2.52314,4.23083>}
+	triangle{<2.06169,-3,4.54175>,<1.78913,-2.52314,4.23083>,<2.0617,-2.31745,4.54178>}
+	texture{t1}
+}
+union{
+	cylinder{<2.06169,-3,4.54175>,<1.78919,-3,4.23088>,r}
+	sphere{<1.78919,-3,4.23088>,r}
+	cylinder{<1.78919,-3,4.23088>,<1.78913,-2.52314,4.23083>,r}
+	sphere{<1.78913,-2.52314,4.23083>,r}
+	cylinder{<1.78913,-2.52314,4.23083>,<2.0617,-2.31745,4.54178>,r}
+	sphere{<2.0617,-2.31745,4.54178>,r}
+	cylinder{<2.0617,-2.31745,4.54178>,<2.06169,-3,4.54175>,r}
+	sphere{<2.06169,-3,4.54175>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.31566,-2.05207,4.5418>,<2.44824,-1.8329,4.22507>,<3,-1.83291,4.22512>}
+	triangle{<2.31566,-2.05207,4.5418>,<3,-1.83291,4.22512>,<3,-2.05208,4.54185>}
+	texture{t1}
+}
+union{
+	cylinder{<2.31566,-2.05207,4.5418>,<2.44824,-1.8329,4.22507>,r}
+	sphere{<2.44824,-1.8329,4.22507>,r}
+	cylinder{<2.44824,-1.8329,4.22507>,<3,-1.83291,4.22512>,r}
+	sphere{<3,-1.83291,4.22512>,r}
+	cylinder{<3,-1.83291,4.22512>,<3,-2.05208,4.54185>,r}
+	sphere{<3,-2.05208,4.54185>,r}
+	cylinder{<3,-2.05208,4.54185>,<2.31566,-2.05207,4.5418>,r}
+	sphere{<2.31566,-2.05207,4.5418>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.06006,-1.85916,4.2894>,<1.09022,-1.80433,4.41837>,<1.16488,-2.01626,4.53111>}
+	triangle{<1.06006,-1.85916,4.2894>,<1.16488,-2.01626,4.53111>,<1.16324,-2.02682,4.51958>}
+	texture{t1}
+}
+union{
+	cylinder{<1.06006,-1.85916,4.2894>,<1.09022,-1.80433,4.41837>,r}
+	sphere{<1.09022,-1.80433,4.41837>,r}
+	cylinder{<1.09022,-1.80433,4.41837>,<1.16488,-2.01626,4.53111>,r}
+	sphere{<1.16488,-2.01626,4.53111>,r}
+	cylinder{<1.16488,-2.01626,4.53111>,<1.16324,-2.02682,4.51958>,r}
+	sphere{<1.16324,-2.02682,4.51958>,r}
+	cylinder{<1.16324,-2.02682,4.51958>,<1.06006,-1.85916,4.2894>,r}
+	sphere{<1.06006,-1.85916,4.2894>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.85169,-0.227303,3.64931>,<-1.95182,-0.518949,3.8453>,<-2.14103,-0.246293,3.97774>}
+	triangle{<-1.85169,-0.227303,3.64931>,<-2.14103,-0.246293,3.97774>,<-2.03052,0.0747705,3.76167>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.85169,-0.227303,3.64931>,<-1.95182,-0.518949,3.8453>,r}
+	sphere{<-1.95182,-0.518949,3.8453>,r}
+	cylinder{<-1.95182,-0.518949,3.8453>,<-2.14103,-0.246293,3.97774>,r}
+	sphere{<-2.14103,-0.246293,3.97774>,r}
+	cylinder{<-2.14103,-0.246293,3.97774>,<-2.03052,0.0747705,3.76167>,r}
+	sphere{<-2.03052,0.0747705,3.76167>,r}
+	cylinder{<-2.03052,0.0747705,3.76167>,<-1.85169,-0.227303,3.64931>,r}
+	sphere{<-1.85169,-0.227303,3.64931>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.77035,-1.71069,4.77935>,<-1.78448,-1.67321,4.7921>,<-1.75768,-1.64689,4.80028>}
+	triangle{<-1.77035,-1.71069,4.77935>,<-1.75768,-1.64689,4.80028>,<-1.76938,-1.71065,4.77935>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.77035,-1.71069,4.77935>,<-1.78448,-1.67321,4.7921>,r}
+	sphere{<-1.78448,-1.67321,4.7921>,r}
+	cylinder{<-1.78448,-1.67321,4.7921>,<-1.75768,-1.64689,4.80028>,r}
+	sphere{<-1.75768,-1.64689,4.80028>,r}
+	cylinder{<-1.75768,-1.64689,4.80028>,<-1.76938,-1.71065,4.77935>,r}
+	sphere{<-1.76938,-1.71065,4.77935>,r}
+	cylinder{<-1.76938,-1.71065,4.77935>,<-1.77035,-1.71069,4.77935>,r}
+	sphere{<-1.77035,-1.71069,4.77935>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.89854,-0.541773,4.55037>,<-1.79459,-0.704627,4.298>,<-1.95445,-1.01202,4.57849>}
+	triangle{<-1.89854,-0.541773,4.55037>,<-1.95445,-1.01202,4.57849>,<-2.00041,-0.718924,4.73271>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.89854,-0.541773,4.55037>,<-1.79459,-0.704627,4.298>,r}
+	sphere{<-1.79459,-0.704627,4.298>,r}
+	cylinder{<-1.79459,-0.704627,4.298>,<-1.95445,-1.01202,4.57849>,r}
+	sphere{<-1.95445,-1.01202,4.57849>,r}
+	cylinder{<-1.95445,-1.01202,4.57849>,<-2.00041,-0.718924,4.73271>,r}
+	sphere{<-2.00041,-0.718924,4.73271>,r}
+	cylinder{<-2.00041,-0.718924,4.73271>,<-1.89854,-0.541773,4.55037>,r}
+	sphere{<-1.89854,-0.541773,4.55037>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.445188,-0.420509,3.45342>,<-0.606816,-0.578059,3.67864>,<-0.61567,-0.578709,3.6762>}
+	triangle{<-0.445188,-0.420509,3.45342>,<-0.61567,-0.578709,3.6762>,<-0.715382,-0.361497,3.23269>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.445188,-0.420509,3.45342>,<-0.606816,-0.578059,3.67864>,r}
+	sphere{<-0.606816,-0.578059,3.67864>,r}
+	cylinder{<-0.606816,-0.578059,3.67864>,<-0.61567,-0.578709,3.6762>,r}
+	sphere{<-0.61567,-0.578709,3.6762>,r}
+	cylinder{<-0.61567,-0.578709,3.6762>,<-0.715382,-0.361497,3.23269>,r}
+	sphere{<-0.715382,-0.361497,3.23269>,r}
+	cylinder{<-0.715382,-0.361497,3.23269>,<-0.445188,-0.420509,3.45342>,r}
+	sphere{<-0.445188,-0.420509,3.45342>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.707811,-1.62458,3.45614>,<-0.62471,-1.66177,3.471>,<-0.609493,-1.75217,3.34622>}
+	triangle{<-0.707811,-1.62458,3.45614>,<-0.609493,-1.75217,3.34622>,<-0.618632,-1.75152,3.33933>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.707811,-1.62458,3.45614>,<-0.62471,-1.66177,3.471>,r}
+	sphere{<-0.62471,-1.66177,3.471>,r}
+	cylinder{<-0.62471,-1.66177,3.471>,<-0.609493,-1.75217,3.34622>,r}
+	sphere{<-0.609493,-1.75217,3.34622>,r}
+	cylinder{<-0.609493,-1.75217,3.34622>,<-0.618632,-1.75152,3.33933>,r}
+	sphere{<-0.618632,-1.75152,3.33933>,r}
+	cylinder{<-0.618632,-1.75152,3.33933>,<-0.707811,-1.62458,3.45614>,r}
+	sphere{<-0.707811,-1.62458,3.45614>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.01583,-0.769833,3.72604>,<-2.01703,-0.767604,3.72452>,<-1.95182,-0.518949,3.8453>}
+	triangle{<-2.01583,-0.769833,3.72604>,<-1.95182,-0.518949,3.8453>,<-1.8479,-0.653477,3.98195>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.01583,-0.769833,3.72604>,<-2.01703,-0.767604,3.72452>,r}
+	sphere{<-2.01703,-0.767604,3.72452>,r}
+	cylinder{<-2.01703,-0.767604,3.72452>,<-1.95182,-0.518949,3.8453>,r}
+	sphere{<-1.95182,-0.518949,3.8453>,r}
+	cylinder{<-1.95182,-0.518949,3.8453>,<-1.8479,-0.653477,3.98195>,r}
+	sphere{<-1.8479,-0.653477,3.98195>,r}
+	cylinder{<-1.8479,-0.653477,3.98195>,<-2.01583,-0.769833,3.72604>,r}
+	sphere{<-2.01583,-0.769833,3.72604>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.46388,-1.32328,2.9513>,<3,-1.32329,2.95121>,<3,-1.2878,2.79109>}
+	triangle{<2.46388,-1.32328,2.9513>,<3,-1.2878,2.79109>,<2.501,-1.28776,2.79101>}
+	texture{t1}
+}
+union{
+	cylinder{<2.46388,-1.32328,2.9513>,<3,-1.32329,2.95121>,r}
+	sphere{<3,-1.32329,2.95121>,r}
+	cylinder{<3,-1.32329,2.95121>,<3,-1.2878,2.79109>,r}
+	sphere{<3,-1.2878,2.79109>,r}
+	cylinder{<3,-1.2878,2.79109>,<2.501,-1.28776,2.79101>,r}
+	sphere{<2.501,-1.28776,2.79101>,r}
+	cylinder{<2.501,-1.28776,2.79101>,<2.46388,-1.32328,2.9513>,r}
+	sphere{<2.46388,-1.32328,2.9513>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.15413,-0.499402,3.62891>,<1.98392,-0.440217,3.43023>,<2.12833,-0.121563,3.24393>}
+	triangle{<2.15413,-0.499402,3.62891>,<2.12833,-0.121563,3.24393>,<2.58285,-0.127081,3.62775>}
+	texture{t1}
+}
+union{
+	cylinder{<2.15413,-0.499402,3.62891>,<1.98392,-0.440217,3.43023>,r}
+	sphere{<1.98392,-0.440217,3.43023>,r}
+	cylinder{<1.98392,-0.440217,3.43023>,<2.12833,-0.121563,3.24393>,r}
+	sphere{<2.12833,-0.121563,3.24393>,r}
+	cylinder{<2.12833,-0.121563,3.24393>,<2.58285,-0.127081,3.62775>,r}
+	sphere{<2.58285,-0.127081,3.62775>,r}
+	cylinder{<2.58285,-0.127081,3.62775>,<2.15413,-0.499402,3.62891>,r}
+	sphere{<2.15413,-0.499402,3.62891>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.78764,-1.62402,3.44327>,<1.78067,-1.64091,3.48499>,<1.8043,-1.74576,3.45923>}
+	triangle{<1.78764,-1.62402,3.44327>,<1.8043,-1.74576,3.45923>,<1.81827,-1.73396,3.3913>}
+	texture{t1}
+}
+union{
+	cylinder{<1.78764,-1.62402,3.44327>,<1.78067,-1.64091,3.48499>,r}
+	sphere{<1.78067,-1.64091,3.48499>,r}
+	cylinder{<1.78067,-1.64091,3.48499>,<1.8043,-1.74576,3.45923>,r}
+	sphere{<1.8043,-1.74576,3.45923>,r}
+	cylinder{<1.8043,-1.74576,3.45923>,<1.81827,-1.73396,3.3913>,r}
+	sphere{<1.81827,-1.73396,3.3913>,r}
+	cylinder{<1.81827,-1.73396,3.3913>,<1.78764,-1.62402,3.44327>,r}
+	sphere{<1.78764,-1.62402,3.44327>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.44824,-1.8329,4.22507>,<2.18173,-1.24573,4.2001>,<3,-1.24577,4.20017>}
+	triangle{<2.44824,-1.8329,4.22507>,<3,-1.24577,4.20017>,<3,-1.83291,4.22512>}
+	texture{t1}
+}
+union{
+	cylinder{<2.44824,-1.8329,4.22507>,<2.18173,-1.24573,4.2001>,r}
+	sphere{<2.18173,-1.24573,4.2001>,r}
+	cylinder{<2.18173,-1.24573,4.2001>,<3,-1.24577,4.20017>,r}
+	sphere{<3,-1.24577,4.20017>,r}
+	cylinder{<3,-1.24577,4.20017>,<3,-1.83291,4.22512>,r}
+	sphere{<3,-1.83291,4.22512>,r}
+	cylinder{<3,-1.83291,4.22512>,<2.44824,-1.8329,4.22507>,r}
+	sphere{<2.44824,-1.8329,4.22507>,r}
+	texture{t2}
+}
+union{
+	triangle{<3,-0.837419,4.72969>,<2.07269,-0.837408,4.72956>,<2.13265,-0.208876,4.59343>}
+	triangle{<3,-0.837419,4.72969>,<2.13265,-0.208876,4.59343>,<3,-0.208826,4.59354>}
+	texture{t1}
+}
+union{
+	cylinder{<3,-0.837419,4.72969>,<2.07269,-0.837408,4.72956>,r}
+	sphere{<2.07269,-0.837408,4.72956>,r}
+	cylinder{<2.07269,-0.837408,4.72956>,<2.13265,-0.208876,4.59343>,r}
+	sphere{<2.13265,-0.208876,4.59343>,r}
+	cylinder{<2.13265,-0.208876,4.59343>,<3,-0.208826,4.59354>,r}
+	sphere{<3,-0.208826,4.59354>,r}
+	cylinder{<3,-0.208826,4.59354>,<3,-0.837419,4.72969>,r}
+	sphere{<3,-0.837419,4.72969>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.91799,-1.06566,4.43356>,<2.18173,-1.24573,4.2001>,<2.12317,-1.21029,4.14503>}
+	triangle{<1.91799,-1.06566,4.43356>,<2.12317,-1.21029,4.14503>,<1.91565,-1.06444,4.42693>}
+	texture{t1}
+}
+union{
+	cylinder{<1.91799,-1.06566,4.43356>,<2.18173,-1.24573,4.2001>,r}
+	sphere{<2.18173,-1.24573,4.2001>,r}
+	cylinder{<2.18173,-1.24573,4.2001>,<2.12317,-1.21029,4.14503>,r}
+	sphere{<2.12317,-1.21029,4.14503>,r}
+	cylinder{<2.12317,-1.21029,4.14503>,<1.91565,-1.06444,4.42693>,r}
+	sphere{<1.91565,-1.06444,4.42693>,r}
+	cylinder{<1.91565,-1.06444,4.42693>,<1.91799,-1.06566,4.43356>,r}
+	sphere{<1.91799,-1.06566,4.43356>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.44364,0.690603,2.80094>,<-1.31307,0.957292,3.26454>,<-1.87915,0.888319,3.18717>}
+	triangle{<-1.44364,0.690603,2.80094>,<-1.87915,0.888319,3.18717>,<-2.0023,0.673521,2.81521>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.44364,0.690603,2.80094>,<-1.31307,0.957292,3.26454>,r}
+	sphere{<-1.31307,0.957292,3.26454>,r}
+	cylinder{<-1.31307,0.957292,3.26454>,<-1.87915,0.888319,3.18717>,r}
+	sphere{<-1.87915,0.888319,3.18717>,r}
+	cylinder{<-1.87915,0.888319,3.18717>,<-2.0023,0.673521,2.81521>,r}
+	sphere{<-2.0023,0.673521,2.81521>,r}
+	cylinder{<-2.0023,0.673521,2.81521>,<-1.44364,0.690603,2.80094>,r}
+	sphere{<-1.44364,0.690603,2.80094>,r}
+	texture{t2}
+}
+union{
+	triangle{<-3,0.228824,3.6579>,<-2.14464,0.228822,3.65798>,<-2.21438,0.182597,2.95866>}
+	triangle{<-3,0.228824,3.6579>,<-2.21438,0.182597,2.95866>,<-3,0.182609,2.95875>}
+	texture{t1}
+}
+union{
+	cylinder{<-3,0.228824,3.6579>,<-2.14464,0.228822,3.65798>,r}
+	sphere{<-2.14464,0.228822,3.65798>,r}
+	cylinder{<-2.14464,0.228822,3.65798>,<-2.21438,0.182597,2.95866>,r}
+	sphere{<-2.21438,0.182597,2.95866>,r}
+	cylinder{<-2.21438,0.182597,2.95866>,<-3,0.182609,2.95875>,r}
+	sphere{<-3,0.182609,2.95875>,r}
+	cylinder{<-3,0.182609,2.95875>,<-3,0.228824,3.6579>,r}
+	sphere{<-3,0.228824,3.6579>,r}
+	texture{t2}
+}
+union{
+	triangle{<-3,0.998939,4.03188>,<-3,1.32883,3.65582>,<-2.46673,1.3289,3.65576>}
+	triangle{<-3,0.998939,4.03188>,<-2.46673,1.3289,3.65576>,<-2.3967,0.99892,4.03192>}
+	texture{t1}
+}
+union{
+	cylinder{<-3,0.998939,4.03188>,<-3,1.32883,3.65582>,r}
+	sphere{<-3,1.32883,3.65582>,r}
+	cylinder{<-3,1.32883,3.65582>,<-2.46673,1.3289,3.65576>,r}
+	sphere{<-2.46673,1.3289,3.65576>,r}
+	cylinder{<-2.46673,1.3289,3.65576>,<-2.3967,0.99892,4.03192>,r}
+	sphere{<-2.3967,0.99892,4.03192>,r}
+	cylinder{<-2.3967,0.99892,4.03192>,<-3,0.998939,4.03188>,r}
+	sphere{<-3,0.998939,4.03188>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.3967,0.99892,4.03192>,<-2.34038,0.999216,4.11025>,<-1.87348,0.566068,3.92295>}
+	triangle{<-2.3967,0.99892,4.03192>,<-1.87348,0.566068,3.92295>,<-1.96984,0.588261,3.83254>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.3967,0.99892,4.03192>,<-2.34038,0.999216,4.11025>,r}
+	sphere{<-2.34038,0.999216,4.11025>,r}
+	cylinder{<-2.34038,0.999216,4.11025>,<-1.87348,0.566068,3.92295>,r}
+	sphere{<-1.87348,0.566068,3.92295>,r}
+	cylinder{<-1.87348,0.566068,3.92295>,<-1.96984,0.588261,3.83254>,r}
+	sphere{<-1.96984,0.588261,3.83254>,r}
+	cylinder{<-1.96984,0.588261,3.83254>,<-2.3967,0.99892,4.03192>,r}
+	sphere{<-2.3967,0.99892,4.03192>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.98001,1.98725,3.65665>,<-2.01734,1.97248,3.73958>,<-2.15443,1.87965,3.62667>}
+	triangle{<-1.98001,1.98725,3.65665>,<-2.15443,1.87965,3.62667>,<-2.06733,1.92555,3.55702>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.98001,1.98725,3.65665>,<-2.01734,1.97248,3.73958>,r}
+	sphere{<-2.01734,1.97248,3.73958>,r}
+	cylinder{<-2.01734,1.97248,3.73958>,<-2.15443,1.87965,3.62667>,r}
+	sphere{<-2.15443,1.87965,3.62667>,r}
+	cylinder{<-2.15443,1.87965,3.62667>,<-2.06733,1.92555,3.55702>,r}
+	sphere{<-2.06733,1.92555,3.55702>,r}
+	cylinder{<-2.06733,1.92555,3.55702>,<-1.98001,1.98725,3.65665>,r}
+	sphere{<-1.98001,1.98725,3.65665>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.30755,1.83203,3.8769>,<-1.20813,1.63116,3.94897>,<-1.38087,1.57878,4.25>}
+	triangle{<-1.30755,1.83203,3.8769>,<-1.38087,1.57878,4.25>,<-1.45734,1.79174,4.13248>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.30755,1.83203,3.8769>,<-1.20813,1.63116,3.94897>,r}
+	sphere{<-1.20813,1.63116,3.94897>,r}
+	cylinder{<-1.20813,1.63116,3.94897>,<-1.38087,1.57878,4.25>,r}
+	sphere{<-1.38087,1.57878,4.25>,r}
+	cylinder{<-1.38087,1.57878,4.25>,<-1.45734,1.79174,4.13248>,r}
+	sphere{<-1.45734,1.79174,4.13248>,r}
+	cylinder{<-1.45734,1.79174,4.13248>,<-1.30755,1.83203,3.8769>,r}
+	sphere{<-1.30755,1.83203,3.8769>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.53052,1.00055,4.4616>,<-2.43496,0.566177,4.96655>,<-3,0.415767,5.14146>}
+	triangle{<-2.53052,1.00055,4.4616>,<-3,0.415767,5.14146>,<-3,1.00057,4.46164>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.53052,1.00055,4.4616>,<-2.43496,0.566177,4.96655>,r}
+	sphere{<-2.43496,0.566177,4.96655>,r}
+	cylinder{<-2.43496,0.566177,4.96655>,<-3,0.415767,5.14146>,r}
+	sphere{<-3,0.415767,5.14146>,r}
+	cylinder{<-3,0.415767,5.14146>,<-3,1.00057,4.46164>,r}
+	sphere{<-3,1.00057,4.46164>,r}
+	cylinder{<-3,1.00057,4.46164>,<-2.53052,1.00055,4.4616>,r}
+	sphere{<-2.53052,1.00055,4.4616>,r}
+	texture{t2}
+}
+union{
+	triangle{<-3,-0.246393,3.97773>,<-3,-0.190437,4.82443>,<-2.13892,-0.216786,4.42422>}
+	triangle{<-3,-0.246393,3.97773>,<-2.13892,-0.216786,4.42422>,<-2.14103,-0.246293,3.97774>}
+	texture{t1}
+}
+union{
+	cylinder{<-3,-0.246393,3.97773>,<-3,-0.190437,4.82443>,r}
+	sphere{<-3,-0.190437,4.82443>,r}
+	cylinder{<-3,-0.190437,4.82443>,<-2.13892,-0.216786,4.42422>,r}
+	sphere{<-2.13892,-0.216786,4.42422>,r}
+	cylinder{<-2.13892,-0.216786,4.42422>,<-2.14103,-0.246293,3.97774>,r}
+	sphere{<-2.14103,-0.246293,3.97774>,r}
+	cylinder{<-2.14103,-0.246293,3.97774>,<-3,-0.246393,3.97773>,r}
+	sphere{<-3,-0.246393,3.97773>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.61567,-0.578709,3.6762>,<-0.836757,-0.504807,3.97726>,<-0.580491,-0.5226,3.90099>}
+	triangle{<-0.61567,-0.578709,3.6762>,<-0.580491,-0.5226,3.90099>,<-0.606816,-0.578059,3.67864>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.61567,-0.578709,3.6762>,<-0.836757,-0.504807,3.97726>,r}
+	sphere{<-0.836757,-0.504807,3.97726>,r}
+	cylinder{<-0.836757,-0.504807,3.97726>,<-0.580491,-0.5226,3.90099>,r}
+	sphere{<-0.580491,-0.5226,3.90099>,r}
+	cylinder{<-0.580491,-0.5226,3.90099>,<-0.606816,-0.578059,3.67864>,r}
+	sphere{<-0.606816,-0.578059,3.67864>,r}
+	cylinder{<-0.606816,-0.578059,3.67864>,<-0.61567,-0.578709,3.6762>,r}
+	sphere{<-0.61567,-0.578709,3.6762>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.574484,0.400128,4.43993>,<-0.574113,0.397353,4.44045>,<-0.912189,0.160091,4.38771>}
+	triangle{<-0.574484,0.400128,4.43993>,<-0.912189,0.160091,4.38771>,<-0.985881,0.356372,4.33876>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.574484,0.400128,4.43993>,<-0.574113,0.397353,4.44045>,r}
+	sphere{<-0.574113,0.397353,4.44045>,r}
+	cylinder{<-0.574113,0.397353,4.44045>,<-0.912189,0.160091,4.38771>,r}
+	sphere{<-0.912189,0.160091,4.38771>,r}
+	cylinder{<-0.912189,0.160091,4.38771>,<-0.985881,0.356372,4.33876>,r}
+	sphere{<-0.985881,0.356372,4.33876>,r}
+	cylinder{<-0.985881,0.356372,4.33876>,<-0.574484,0.400128,4.43993>,r}
+	sphere{<-0.574484,0.400128,4.43993>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.369772,0.734323,4.73462>,<-0.428647,0.794102,4.7718>,<-0.31878,0.889703,4.74604>}
+	triangle{<-0.369772,0.734323,4.73462>,<-0.31878,0.889703,4.74604>,<-0.305498,0.833881,4.72874>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.369772,0.734323,4.73462>,<-0.428647,0.794102,4.7718>,r}
+	sphere{<-0.428647,0.794102,4.7718>,r}
+	cylinder{<-0.428647,0.794102,4.7718>,<-0.31878,0.889703,4.74604>,r}
+	sphere{<-0.31878,0.889703,4.74604>,r}
+	cylinder{<-0.31878,0.889703,4.74604>,<-0.305498,0.833881,4.72874>,r}
+	sphere{<-0.305498,0.833881,4.72874>,r}
+	cylinder{<-0.305498,0.833881,4.72874>,<-0.369772,0.734323,4.73462>,r}
+	sphere{<-0.369772,0.734323,4.73462>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.25071,1.50231,4.51119>,<-1.34972,1.39141,4.54228>,<-1.46745,1.43947,4.33472>}
+	triangle{<-1.25071,1.50231,4.51119>,<-1.46745,1.43947,4.33472>,<-1.38087,1.57878,4.25>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.25071,1.50231,4.51119>,<-1.34972,1.39141,4.54228>,r}
+	sphere{<-1.34972,1.39141,4.54228>,r}
+	cylinder{<-1.34972,1.39141,4.54228>,<-1.46745,1.43947,4.33472>,r}
+	sphere{<-1.46745,1.43947,4.33472>,r}
+	cylinder{<-1.46745,1.43947,4.33472>,<-1.38087,1.57878,4.25>,r}
+	sphere{<-1.38087,1.57878,4.25>,r}
+	cylinder{<-1.38087,1.57878,4.25>,<-1.25071,1.50231,4.51119>,r}
+	sphere{<-1.25071,1.50231,4.51119>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.0655666,0.206774,3.56236>,<-0.437823,0.412014,3.22314>,<-0.664265,0.823417,3.50643>}
+	triangle{<-0.0655666,0.206774,3.56236>,<-0.664265,0.823417,3.50643>,<-0.354914,0.711217,3.88805>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.0655666,0.206774,3.56236>,<-0.437823,0.412014,3.22314>,r}
+	sphere{<-0.437823,0.412014,3.22314>,r}
+	cylinder{<-0.437823,0.412014,3.22314>,<-0.664265,0.823417,3.50643>,r}
+	sphere{<-0.664265,0.823417,3.50643>,r}
+	cylinder{<-0.664265,0.823417,3.50643>,<-0.354914,0.711217,3.88805>,r}
+	sphere{<-0.354914,0.711217,3.88805>,r}
+	cylinder{<-0.354914,0.711217,3.88805>,<-0.0655666,0.206774,3.56236>,r}
+	sphere{<-0.0655666,0.206774,3.56236>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.250581,1.43064,3.24952>,<-0.457568,1.17624,3.66151>,<-0.66351,0.918845,3.48501>}
+	triangle{<-0.250581,1.43064,3.24952>,<-0.66351,0.918845,3.48501>,<-0.370292,1.27943,2.92926>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.250581,1.43064,3.24952>,<-0.457568,1.17624,3.66151>,r}
+	sphere{<-0.457568,1.17624,3.66151>,r}
+	cylinder{<-0.457568,1.17624,3.66151>,<-0.66351,0.918845,3.48501>,r}
+	sphere{<-0.66351,0.918845,3.48501>,r}
+	cylinder{<-0.66351,0.918845,3.48501>,<-0.370292,1.27943,2.92926>,r}
+	sphere{<-0.370292,1.27943,2.92926>,r}
+	cylinder{<-0.370292,1.27943,2.92926>,<-0.250581,1.43064,3.24952>,r}
+	sphere{<-0.250581,1.43064,3.24952>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.564916,0.901911,3.87443>,<0.044242,1.01877,4.01015>,<0.428154,1.1482,3.84195>}
+	triangle{<0.564916,0.901911,3.87443>,<0.428154,1.1482,3.84195>,<0.58713,0.961652,3.84818>}
+	texture{t1}
+}
+union{
+	cylinder{<0.564916,0.901911,3.87443>,<0.044242,1.01877,4.01015>,r}
+	sphere{<0.044242,1.01877,4.01015>,r}
+	cylinder{<0.044242,1.01877,4.01015>,<0.428154,1.1482,3.84195>,r}
+	sphere{<0.428154,1.1482,3.84195>,r}
+	cylinder{<0.428154,1.1482,3.84195>,<0.58713,0.961652,3.84818>,r}
+	sphere{<0.58713,0.961652,3.84818>,r}
+	cylinder{<0.58713,0.961652,3.84818>,<0.564916,0.901911,3.87443>,r}
+	sphere{<0.564916,0.901911,3.87443>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.827094,0.217453,4.51437>,<0.986893,0.15665,4.60571>,<0.952171,0.0839524,4.39922>}
+	triangle{<0.827094,0.217453,4.51437>,<0.952171,0.0839524,4.39922>,<0.855745,0.138657,4.38324>}
+	texture{t1}
+}
+union{
+	cylinder{<0.827094,0.217453,4.51437>,<0.986893,0.15665,4.60571>,r}
+	sphere{<0.986893,0.15665,4.60571>,r}
+	cylinder{<0.986893,0.15665,4.60571>,<0.952171,0.0839524,4.39922>,r}
+	sphere{<0.952171,0.0839524,4.39922>,r}
+	cylinder{<0.952171,0.0839524,4.39922>,<0.855745,0.138657,4.38324>,r}
+	sphere{<0.855745,0.138657,4.38324>,r}
+	cylinder{<0.855745,0.138657,4.38324>,<0.827094,0.217453,4.51437>,r}
+	sphere{<0.827094,0.217453,4.51437>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.19387,0.249461,4.77548>,<1.22669,0.354611,4.82952>,<1.71027,0.391698,4.74873>}
+	triangle{<1.19387,0.249461,4.77548>,<1.71027,0.391698,4.74873>,<1.70096,0.322539,4.71059>}
+	texture{t1}
+}
+union{
+	cylinder{<1.19387,0.249461,4.77548>,<1.22669,0.354611,4.82952>,r}
+	sphere{<1.22669,0.354611,4.82952>,r}
+	cylinder{<1.22669,0.354611,4.82952>,<1.71027,0.391698,4.74873>,r}
+	sphere{<1.71027,0.391698,4.74873>,r}
+	cylinder{<1.71027,0.391698,4.74873>,<1.70096,0.322539,4.71059>,r}
+	sphere{<1.70096,0.322539,4.71059>,r}
+	cylinder{<1.70096,0.322539,4.71059>,<1.19387,0.249461,4.77548>,r}
+	sphere{<1.19387,0.249461,4.77548>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.574484,0.400128,4.43993>,<-0.369772,0.734323,4.73462>,<-0.272193,0.353487,4.87216>}
+	triangle{<-0.574484,0.400128,4.43993>,<-0.272193,0.353487,4.87216>,<-0.574113,0.397353,4.44045>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.574484,0.400128,4.43993>,<-0.369772,0.734323,4.73462>,r}
+	sphere{<-0.369772,0.734323,4.73462>,r}
+	cylinder{<-0.369772,0.734323,4.73462>,<-0.272193,0.353487,4.87216>,r}
+	sphere{<-0.272193,0.353487,4.87216>,r}
+	cylinder{<-0.272193,0.353487,4.87216>,<-0.574113,0.397353,4.44045>,r}
+	sphere{<-0.574113,0.397353,4.44045>,r}
+	cylinder{<-0.574113,0.397353,4.44045>,<-0.574484,0.400128,4.43993>,r}
+	sphere{<-0.574484,0.400128,4.43993>,r}
+	texture{t2}
+}
+union{
+	triangle{<3,0.935449,2.83519>,<2.08836,0.937582,2.83329>,<2.13559,0.959378,3.20919>}
+	triangle{<3,0.935449,2.83519>,<2.13559,0.959378,3.20919>,<3,0.977247,3.55223>}
+	texture{t1}
+}
+union{
+	cylinder{<3,0.935449,2.83519>,<2.08836,0.937582,2.83329>,r}
+	sphere{<2.08836,0.937582,2.83329>,r}
+	cylinder{<2.08836,0.937582,2.83329>,<2.13559,0.959378,3.20919>,r}
+	sphere{<2.13559,0.959378,3.20919>,r}
+	cylinder{<2.13559,0.959378,3.20919>,<3,0.977247,3.55223>,r}
+	sphere{<3,0.977247,3.55223>,r}
+	cylinder{<3,0.977247,3.55223>,<3,0.935449,2.83519>,r}
+	sphere{<3,0.935449,2.83519>,r}
+	texture{t2}
+}
+union{
+	triangle{<3,1.35197,3.75172>,<2.04327,1.65162,3.54209>,<2.24475,2.02295,3.28241>}
+	triangle{<3,1.35197,3.75172>,<2.24475,2.02295,3.28241>,<3,2.02287,3.28252>}
+	texture{t1}
+}
+union{
+	cylinder{<3,1.35197,3.75172>,<2.04327,1.65162,3.54209>,r}
+	sphere{<2.04327,1.65162,3.54209>,r}
+	cylinder{<2.04327,1.65162,3.54209>,<2.24475,2.02295,3.28241>,r}
+	sphere{<2.24475,2.02295,3.28241>,r}
+	cylinder{<2.24475,2.02295,3.28241>,<3,2.02287,3.28252>,r}
+	sphere{<3,2.02287,3.28252>,r}
+	cylinder{<3,2.02287,3.28252>,<3,1.35197,3.75172>,r}
+	sphere{<3,1.35197,3.75172>,r}
+	texture{t2}
+}
+union{
+	triangle{<3,-0.125994,3.62772>,<2.58285,-0.127081,3.62775>,<2.7017,0.0723714,3.82035>}
+	triangle{<3,-0.125994,3.62772>,<2.7017,0.0723714,3.82035>,<3,0.0726016,3.8198>}
+	texture{t1}
+}
+union{
+	cylinder{<3,-0.125994,3.62772>,<2.58285,-0.127081,3.62775>,r}
+	sphere{<2.58285,-0.127081,3.62775>,r}
+	cylinder{<2.58285,-0.127081,3.62775>,<2.7017,0.0723714,3.82035>,r}
+	sphere{<2.7017,0.0723714,3.82035>,r}
+	cylinder{<2.7017,0.0723714,3.82035>,<3,0.0726016,3.8198>,r}
+	sphere{<3,0.0726016,3.8198>,r}
+	cylinder{<3,0.0726016,3.8198>,<3,-0.125994,3.62772>,r}
+	sphere{<3,-0.125994,3.62772>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.7017,0.0723714,3.82035>,<2.5188,0.419638,3.82432>,<3,0.653598,3.82588>}
+	triangle{<2.7017,0.0723714,3.82035>,<3,0.653598,3.82588>,<3,0.0726016,3.8198>}
+	texture{t1}
+}
+union{
+	cylinder{<2.7017,0.0723714,3.82035>,<2.5188,0.419638,3.82432>,r}
+	sphere{<2.5188,0.419638,3.82432>,r}
+	cylinder{<2.5188,0.419638,3.82432>,<3,0.653598,3.82588>,r}
+	sphere{<3,0.653598,3.82588>,r}
+	cylinder{<3,0.653598,3.82588>,<3,0.0726016,3.8198>,r}
+	sphere{<3,0.0726016,3.8198>,r}
+	cylinder{<3,0.0726016,3.8198>,<2.7017,0.0723714,3.82035>,r}
+	sphere{<2.7017,0.0723714,3.82035>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.03132,0.582433,3.4847>,<2.5188,0.419638,3.82432>,<1.90271,0.578303,4.27799>}
+	triangle{<2.03132,0.582433,3.4847>,<1.90271,0.578303,4.27799>,<1.71027,0.662039,3.77879>}
+	texture{t1}
+}
+union{
+	cylinder{<2.03132,0.582433,3.4847>,<2.5188,0.419638,3.82432>,r}
+	sphere{<2.5188,0.419638,3.82432>,r}
+	cylinder{<2.5188,0.419638,3.82432>,<1.90271,0.578303,4.27799>,r}
+	sphere{<1.90271,0.578303,4.27799>,r}
+	cylinder{<1.90271,0.578303,4.27799>,<1.71027,0.662039,3.77879>,r}
+	sphere{<1.71027,0.662039,3.77879>,r}
+	cylinder{<1.71027,0.662039,3.77879>,<2.03132,0.582433,3.4847>,r}
+	sphere{<2.03132,0.582433,3.4847>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.93624,0.91669,4.59839>,<2.34757,1.56764,4.32446>,<3,1.35874,4.17942>}
+	triangle{<1.93624,0.91669,4.59839>,<3,1.35874,4.17942>,<3,1.07553,4.24545>}
+	texture{t1}
+}
+union{
+	cylinder{<1.93624,0.91669,4.59839>,<2.34757,1.56764,4.32446>,r}
+	sphere{<2.34757,1.56764,4.32446>,r}
+	cylinder{<2.34757,1.56764,4.32446>,<3,1.35874,4.17942>,r}
+	sphere{<3,1.35874,4.17942>,r}
+	cylinder{<3,1.35874,4.17942>,<3,1.07553,4.24545>,r}
+	sphere{<3,1.07553,4.24545>,r}
+	cylinder{<3,1.07553,4.24545>,<1.93624,0.91669,4.59839>,r}
+	sphere{<1.93624,0.91669,4.59839>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.19208,2.18774,3.5156>,<-1.27802,3,3.32973>,<-1.21954,3,3.19431>}
+	triangle{<-1.19208,2.18774,3.5156>,<-1.21954,3,3.19431>,<-1.03503,2.21692,3.13807>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.19208,2.18774,3.5156>,<-1.27802,3,3.32973>,r}
+	sphere{<-1.27802,3,3.32973>,r}
+	cylinder{<-1.27802,3,3.32973>,<-1.21954,3,3.19431>,r}
+	sphere{<-1.21954,3,3.19431>,r}
+	cylinder{<-1.21954,3,3.19431>,<-1.03503,2.21692,3.13807>,r}
+	sphere{<-1.03503,2.21692,3.13807>,r}
+	cylinder{<-1.03503,2.21692,3.13807>,<-1.19208,2.18774,3.5156>,r}
+	sphere{<-1.19208,2.18774,3.5156>,r}
+	texture{t2}
+}
+union{
+	triangle{<-3,1.87965,3.62676>,<-2.15443,1.87965,3.62667>,<-2.46673,1.3289,3.65576>}
+	triangle{<-3,1.87965,3.62676>,<-2.46673,1.3289,3.65576>,<-3,1.32883,3.65582>}
+	texture{t1}
+}
+union{
+	cylinder{<-3,1.87965,3.62676>,<-2.15443,1.87965,3.62667>,r}
+	sphere{<-2.15443,1.87965,3.62667>,r}
+	cylinder{<-2.15443,1.87965,3.62667>,<-2.46673,1.3289,3.65576>,r}
+	sphere{<-2.46673,1.3289,3.65576>,r}
+	cylinder{<-2.46673,1.3289,3.65576>,<-3,1.32883,3.65582>,r}
+	sphere{<-3,1.32883,3.65582>,r}
+	cylinder{<-3,1.32883,3.65582>,<-3,1.87965,3.62676>,r}
+	sphere{<-3,1.87965,3.62676>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.34038,0.999216,4.11025>,<-2.53052,1.00055,4.4616>,<-2.10474,1.43413,4.64727>}
+	triangle{<-2.34038,0.999216,4.11025>,<-2.10474,1.43413,4.64727>,<-1.88922,1.47328,4.33958>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.34038,0.999216,4.11025>,<-2.53052,1.00055,4.4616>,r}
+	sphere{<-2.53052,1.00055,4.4616>,r}
+	cylinder{<-2.53052,1.00055,4.4616>,<-2.10474,1.43413,4.64727>,r}
+	sphere{<-2.10474,1.43413,4.64727>,r}
+	cylinder{<-2.10474,1.43413,4.64727>,<-1.88922,1.47328,4.33958>,r}
+	sphere{<-1.88922,1.47328,4.33958>,r}
+	cylinder{<-1.88922,1.47328,4.33958>,<-2.34038,0.999216,4.11025>,r}
+	sphere{<-2.34038,0.999216,4.11025>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.331292,2.20857,4.03223>,<-0.782958,3,4.3597>,<-0.0415544,3,3.82215>}
+	triangle{<-0.331292,2.20857,4.03223>,<-0.0415544,3,3.82215>,<-0.0415858,2.32091,3.82218>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.331292,2.20857,4.03223>,<-0.782958,3,4.3597>,r}
+	sphere{<-0.782958,3,4.3597>,r}
+	cylinder{<-0.782958,3,4.3597>,<-0.0415544,3,3.82215>,r}
+	sphere{<-0.0415544,3,3.82215>,r}
+	cylinder{<-0.0415544,3,3.82215>,<-0.0415858,2.32091,3.82218>,r}
+	sphere{<-0.0415858,2.32091,3.82218>,r}
+	cylinder{<-0.0415858,2.32091,3.82218>,<-0.331292,2.20857,4.03223>,r}
+	sphere{<-0.331292,2.20857,4.03223>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.19208,2.18774,3.5156>,<-1.27802,3,3.32973>,<-0.804798,3,4.35349>}
+	triangle{<-1.19208,2.18774,3.5156>,<-0.804798,3,4.35349>,<-1.08242,2.09384,3.75282>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.19208,2.18774,3.5156>,<-1.27802,3,3.32973>,r}
+	sphere{<-1.27802,3,3.32973>,r}
+	cylinder{<-1.27802,3,3.32973>,<-0.804798,3,4.35349>,r}
+	sphere{<-0.804798,3,4.35349>,r}
+	cylinder{<-0.804798,3,4.35349>,<-1.08242,2.09384,3.75282>,r}
+	sphere{<-1.08242,2.09384,3.75282>,r}
+	cylinder{<-1.08242,2.09384,3.75282>,<-1.19208,2.18774,3.5156>,r}
+	sphere{<-1.19208,2.18774,3.5156>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.19208,2.18774,3.5156>,<-1.08242,2.09384,3.75282>,<-1.30755,1.83203,3.8769>}
+	triangle{<-1.19208,2.18774,3.5156>,<-1.30755,1.83203,3.8769>,<-1.45408,1.91937,3.61117>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.19208,2.18774,3.5156>,<-1.08242,2.09384,3.75282>,r}
+	sphere{<-1.08242,2.09384,3.75282>,r}
+	cylinder{<-1.08242,2.09384,3.75282>,<-1.30755,1.83203,3.8769>,r}
+	sphere{<-1.30755,1.83203,3.8769>,r}
+	cylinder{<-1.30755,1.83203,3.8769>,<-1.45408,1.91937,3.61117>,r}
+	sphere{<-1.45408,1.91937,3.61117>,r}
+	cylinder{<-1.45408,1.91937,3.61117>,<-1.19208,2.18774,3.5156>,r}
+	sphere{<-1.19208,2.18774,3.5156>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.08725,1.93259,4.95169>,<-0.732993,1.94128,5.03354>,<-0.39044,1.38981,4.58373>}
+	triangle{<-1.08725,1.93259,4.95169>,<-0.39044,1.38981,4.58373>,<-1.25071,1.50231,4.51119>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.08725,1.93259,4.95169>,<-0.732993,1.94128,5.03354>,r}
+	sphere{<-0.732993,1.94128,5.03354>,r}
+	cylinder{<-0.732993,1.94128,5.03354>,<-0.39044,1.38981,4.58373>,r}
+	sphere{<-0.39044,1.38981,4.58373>,r}
+	cylinder{<-0.39044,1.38981,4.58373>,<-1.25071,1.50231,4.51119>,r}
+	sphere{<-1.25071,1.50231,4.51119>,r}
+	cylinder{<-1.25071,1.50231,4.51119>,<-1.08725,1.93259,4.95169>,r}
+	sphere{<-1.08725,1.93259,4.95169>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.00975,1.97101,4.46891>,<0.920008,1.8398,4.56126>,<0.65223,1.97116,4.44987>}
+	triangle{<1.00975,1.97101,4.46891>,<0.65223,1.97116,4.44987>,<0.739683,2.1487,4.32313>}
+	texture{t1}
+}
+union{
+	cylinder{<1.00975,1.97101,4.46891>,<0.920008,1.8398,4.56126>,r}
+	sphere{<0.920008,1.8398,4.56126>,r}
+	cylinder{<0.920008,1.8398,4.56126>,<0.65223,1.97116,4.44987>,r}
+	sphere{<0.65223,1.97116,4.44987>,r}
+	cylinder{<0.65223,1.97116,4.44987>,<0.739683,2.1487,4.32313>,r}
+	sphere{<0.739683,2.1487,4.32313>,r}
+	cylinder{<0.739683,2.1487,4.32313>,<1.00975,1.97101,4.46891>,r}
+	sphere{<1.00975,1.97101,4.46891>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.69873,1.61076,3.76813>,<1.62039,1.42027,3.53227>,<1.51434,1.22037,3.73049>}
+	triangle{<1.69873,1.61076,3.76813>,<1.51434,1.22037,3.73049>,<1.54835,1.31319,3.92333>}
+	texture{t1}
+}
+union{
+	cylinder{<1.69873,1.61076,3.76813>,<1.62039,1.42027,3.53227>,r}
+	sphere{<1.62039,1.42027,3.53227>,r}
+	cylinder{<1.62039,1.42027,3.53227>,<1.51434,1.22037,3.73049>,r}
+	sphere{<1.51434,1.22037,3.73049>,r}
+	cylinder{<1.51434,1.22037,3.73049>,<1.54835,1.31319,3.92333>,r}
+	sphere{<1.54835,1.31319,3.92333>,r}
+	cylinder{<1.54835,1.31319,3.92333>,<1.69873,1.61076,3.76813>,r}
+	sphere{<1.69873,1.61076,3.76813>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.25643,3,3.26904>,<1.0646,2.24796,3.55699>,<0.690396,2.24044,4.11811>}
+	triangle{<1.25643,3,3.26904>,<0.690396,2.24044,4.11811>,<0.690258,3,4.11801>}
+	texture{t1}
+}
+union{
+	cylinder{<1.25643,3,3.26904>,<1.0646,2.24796,3.55699>,r}
+	sphere{<1.0646,2.24796,3.55699>,r}
+	cylinder{<1.0646,2.24796,3.55699>,<0.690396,2.24044,4.11811>,r}
+	sphere{<0.690396,2.24044,4.11811>,r}
+	cylinder{<0.690396,2.24044,4.11811>,<0.690258,3,4.11801>,r}
+	sphere{<0.690258,3,4.11801>,r}
+	cylinder{<0.690258,3,4.11801>,<1.25643,3,3.26904>,r}
+	sphere{<1.25643,3,3.26904>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.690258,3,4.11801>,<0.739609,3,4.32335>,<0.739683,2.1487,4.32313>}
+	triangle{<0.690258,3,4.11801>,<0.739683,2.1487,4.32313>,<0.690396,2.24044,4.11811>}
+	texture{t1}
+}
+union{
+	cylinder{<0.690258,3,4.11801>,<0.739609,3,4.32335>,r}
+	sphere{<0.739609,3,4.32335>,r}
+	cylinder{<0.739609,3,4.32335>,<0.739683,2.1487,4.32313>,r}
+	sphere{<0.739683,2.1487,4.32313>,r}
+	cylinder{<0.739683,2.1487,4.32313>,<0.690396,2.24044,4.11811>,r}
+	sphere{<0.690396,2.24044,4.11811>,r}
+	cylinder{<0.690396,2.24044,4.11811>,<0.690258,3,4.11801>,r}
+	sphere{<0.690258,3,4.11801>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.93092,2.15722,4.18562>,<1.51181,2.27678,4.74013>,<1.51185,3,4.74037>}
+	triangle{<1.93092,2.15722,4.18562>,<1.51185,3,4.74037>,<2.18099,3,3.85514>}
+	texture{t1}
+}
+union{
+	cylinder{<1.93092,2.15722,4.18562>,<1.51181,2.27678,4.74013>,r}
+	sphere{<1.51181,2.27678,4.74013>,r}
+	cylinder{<1.51181,2.27678,4.74013>,<1.51185,3,4.74037>,r}
+	sphere{<1.51185,3,4.74037>,r}
+	cylinder{<1.51185,3,4.74037>,<2.18099,3,3.85514>,r}
+	sphere{<2.18099,3,3.85514>,r}
+	cylinder{<2.18099,3,3.85514>,<1.93092,2.15722,4.18562>,r}
+	sphere{<1.93092,2.15722,4.18562>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.78412,3,4.40445>,<-0.0162187,3,5.41896>,<-0.016221,2.87945,5.41894>}
+	triangle{<-0.78412,3,4.40445>,<-0.016221,2.87945,5.41894>,<-0.442368,2.36875,4.8559>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.78412,3,4.40445>,<-0.0162187,3,5.41896>,r}
+	sphere{<-0.0162187,3,5.41896>,r}
+	cylinder{<-0.0162187,3,5.41896>,<-0.016221,2.87945,5.41894>,r}
+	sphere{<-0.016221,2.87945,5.41894>,r}
+	cylinder{<-0.016221,2.87945,5.41894>,<-0.442368,2.36875,4.8559>,r}
+	sphere{<-0.442368,2.36875,4.8559>,r}
+	cylinder{<-0.442368,2.36875,4.8559>,<-0.78412,3,4.40445>,r}
+	sphere{<-0.78412,3,4.40445>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.486549,1.95163,4.69003>,<0.65223,1.97116,4.44987>,<0.480568,1.90312,4.29446>}
+	triangle{<0.486549,1.95163,4.69003>,<0.480568,1.90312,4.29446>,<0.110804,1.81833,4.48217>}
+	texture{t1}
+}
+union{
+	cylinder{<0.486549,1.95163,4.69003>,<0.65223,1.97116,4.44987>,r}
+	sphere{<0.65223,1.97116,4.44987>,r}
+	cylinder{<0.65223,1.97116,4.44987>,<0.480568,1.90312,4.29446>,r}
+	sphere{<0.480568,1.90312,4.29446>,r}
+	cylinder{<0.480568,1.90312,4.29446>,<0.110804,1.81833,4.48217>,r}
+	sphere{<0.110804,1.81833,4.48217>,r}
+	cylinder{<0.110804,1.81833,4.48217>,<0.486549,1.95163,4.69003>,r}
+	sphere{<0.486549,1.95163,4.69003>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.905582,2.01864,3.20083>,<1.224,3,3.12581>,<1.25643,3,3.26904>}
+	triangle{<0.905582,2.01864,3.20083>,<1.25643,3,3.26904>,<1.0646,2.24796,3.55699>}
+	texture{t1}
+}
+union{
+	cylinder{<0.905582,2.01864,3.20083>,<1.224,3,3.12581>,r}
+	sphere{<1.224,3,3.12581>,r}
+	cylinder{<1.224,3,3.12581>,<1.25643,3,3.26904>,r}
+	sphere{<1.25643,3,3.26904>,r}
+	cylinder{<1.25643,3,3.26904>,<1.0646,2.24796,3.55699>,r}
+	sphere{<1.0646,2.24796,3.55699>,r}
+	cylinder{<1.0646,2.24796,3.55699>,<0.905582,2.01864,3.20083>,r}
+	sphere{<0.905582,2.01864,3.20083>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.5964,1.88916,3.87088>,<1.79749,1.96932,3.89134>,<1.85747,1.71452,3.79864>}
+	triangle{<1.5964,1.88916,3.87088>,<1.85747,1.71452,3.79864>,<1.69873,1.61076,3.76813>}
+	texture{t1}
+}
+union{
+	cylinder{<1.5964,1.88916,3.87088>,<1.79749,1.96932,3.89134>,r}
+	sphere{<1.79749,1.96932,3.89134>,r}
+	cylinder{<1.79749,1.96932,3.89134>,<1.85747,1.71452,3.79864>,r}
+	sphere{<1.85747,1.71452,3.79864>,r}
+	cylinder{<1.85747,1.71452,3.79864>,<1.69873,1.61076,3.76813>,r}
+	sphere{<1.69873,1.61076,3.76813>,r}
+	cylinder{<1.69873,1.61076,3.76813>,<1.5964,1.88916,3.87088>,r}
+	sphere{<1.5964,1.88916,3.87088>,r}
+	texture{t2}
+}
+union{
+	triangle{<3,1.35874,4.17942>,<2.34757,1.56764,4.32446>,<2.35417,1.83987,4.51337>}
+	triangle{<3,1.35874,4.17942>,<2.35417,1.83987,4.51337>,<3,2.05095,4.65976>}
+	texture{t1}
+}
+union{
+	cylinder{<3,1.35874,4.17942>,<2.34757,1.56764,4.32446>,r}
+	sphere{<2.34757,1.56764,4.32446>,r}
+	cylinder{<2.34757,1.56764,4.32446>,<2.35417,1.83987,4.51337>,r}
+	sphere{<2.35417,1.83987,4.51337>,r}
+	cylinder{<2.35417,1.83987,4.51337>,<3,2.05095,4.65976>,r}
+	sphere{<3,2.05095,4.65976>,r}
+	cylinder{<3,2.05095,4.65976>,<3,1.35874,4.17942>,r}
+	sphere{<3,1.35874,4.17942>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.83528,-2.52129,4.55188>,<-0.835293,-3,4.55189>,<-1.44903,-3,5.86767>}
+	triangle{<-0.83528,-2.52129,4.55188>,<-1.44903,-3,5.86767>,<-1.172,-2.27508,5.27378>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.83528,-2.52129,4.55188>,<-0.835293,-3,4.55189>,r}
+	sphere{<-0.835293,-3,4.55189>,r}
+	cylinder{<-0.835293,-3,4.55189>,<-1.44903,-3,5.86767>,r}
+	sphere{<-1.44903,-3,5.86767>,r}
+	cylinder{<-1.44903,-3,5.86767>,<-1.172,-2.27508,5.27378>,r}
+	sphere{<-1.172,-2.27508,5.27378>,r}
+	cylinder{<-1.172,-2.27508,5.27378>,<-0.83528,-2.52129,4.55188>,r}
+	sphere{<-0.83528,-2.52129,4.55188>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.838707,-1.14716,5.76655>,<-0.689699,-1.28095,5.89093>,<-0.695413,-1.27335,6>}
+	triangle{<-0.838707,-1.14716,5.76655>,<-0.695413,-1.27335,6>,<-1.09497,-0.90736,6>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.838707,-1.14716,5.76655>,<-0.689699,-1.28095,5.89093>,r}
+	sphere{<-0.689699,-1.28095,5.89093>,r}
+	cylinder{<-0.689699,-1.28095,5.89093>,<-0.695413,-1.27335,6>,r}
+	sphere{<-0.695413,-1.27335,6>,r}
+	cylinder{<-0.695413,-1.27335,6>,<-1.09497,-0.90736,6>,r}
+	sphere{<-1.09497,-0.90736,6>,r}
+	cylinder{<-1.09497,-0.90736,6>,<-0.838707,-1.14716,5.76655>,r}
+	sphere{<-0.838707,-1.14716,5.76655>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.642719,-1.59095,6>,<-0.695413,-1.27335,6>,<-0.689699,-1.28095,5.89093>}
+	triangle{<-0.642719,-1.59095,6>,<-0.689699,-1.28095,5.89093>,<-0.64449,-1.55412,5.8937>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.642719,-1.59095,6>,<-0.695413,-1.27335,6>,r}
+	sphere{<-0.695413,-1.27335,6>,r}
+	cylinder{<-0.695413,-1.27335,6>,<-0.689699,-1.28095,5.89093>,r}
+	sphere{<-0.689699,-1.28095,5.89093>,r}
+	cylinder{<-0.689699,-1.28095,5.89093>,<-0.64449,-1.55412,5.8937>,r}
+	sphere{<-0.64449,-1.55412,5.8937>,r}
+	cylinder{<-0.64449,-1.55412,5.8937>,<-0.642719,-1.59095,6>,r}
+	sphere{<-0.642719,-1.59095,6>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.689699,-1.28095,5.89093>,<-0.669842,-1.27419,5.85375>,<-0.455517,-1.63251,5.58314>}
+	triangle{<-0.689699,-1.28095,5.89093>,<-0.455517,-1.63251,5.58314>,<-0.64449,-1.55412,5.8937>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.689699,-1.28095,5.89093>,<-0.669842,-1.27419,5.85375>,r}
+	sphere{<-0.669842,-1.27419,5.85375>,r}
+	cylinder{<-0.669842,-1.27419,5.85375>,<-0.455517,-1.63251,5.58314>,r}
+	sphere{<-0.455517,-1.63251,5.58314>,r}
+	cylinder{<-0.455517,-1.63251,5.58314>,<-0.64449,-1.55412,5.8937>,r}
+	sphere{<-0.64449,-1.55412,5.8937>,r}
+	cylinder{<-0.64449,-1.55412,5.8937>,<-0.689699,-1.28095,5.89093>,r}
+	sphere{<-0.689699,-1.28095,5.89093>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.689699,-1.28095,5.89093>,<-0.838707,-1.14716,5.76655>,<-0.762187,-1.11645,5.61309>}
+	triangle{<-0.689699,-1.28095,5.89093>,<-0.762187,-1.11645,5.61309>,<-0.669842,-1.27419,5.85375>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.689699,-1.28095,5.89093>,<-0.838707,-1.14716,5.76655>,r}
+	sphere{<-0.838707,-1.14716,5.76655>,r}
+	cylinder{<-0.838707,-1.14716,5.76655>,<-0.762187,-1.11645,5.61309>,r}
+	sphere{<-0.762187,-1.11645,5.61309>,r}
+	cylinder{<-0.762187,-1.11645,5.61309>,<-0.669842,-1.27419,5.85375>,r}
+	sphere{<-0.669842,-1.27419,5.85375>,r}
+	cylinder{<-0.669842,-1.27419,5.85375>,<-0.689699,-1.28095,5.89093>,r}
+	sphere{<-0.689699,-1.28095,5.89093>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.744135,-1.94776,5.23363>,<0.0207597,-1.97155,5.22845>,<-0.0304858,-1.91207,5.19703>}
+	triangle{<0.744135,-1.94776,5.23363>,<-0.0304858,-1.91207,5.19703>,<0.557417,-1.43007,4.96632>}
+	texture{t1}
+}
+union{
+	cylinder{<0.744135,-1.94776,5.23363>,<0.0207597,-1.97155,5.22845>,r}
+	sphere{<0.0207597,-1.97155,5.22845>,r}
+	cylinder{<0.0207597,-1.97155,5.22845>,<-0.0304858,-1.91207,5.19703>,r}
+	sphere{<-0.0304858,-1.91207,5.19703>,r}
+	cylinder{<-0.0304858,-1.91207,5.19703>,<0.557417,-1.43007,4.96632>,r}
+	sphere{<0.557417,-1.43007,4.96632>,r}
+	cylinder{<0.557417,-1.43007,4.96632>,<0.744135,-1.94776,5.23363>,r}
+	sphere{<0.744135,-1.94776,5.23363>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.94003,-2.15821,5.11873>,<1.16488,-2.01626,4.53111>,<1.16324,-2.02682,4.51958>}
+	triangle{<0.94003,-2.15821,5.11873>,<1.16324,-2.02682,4.51958>,<0.713756,-2.89283,4.72715>}
+	texture{t1}
+}
+union{
+	cylinder{<0.94003,-2.15821,5.11873>,<1.16488,-2.01626,4.53111>,r}
+	sphere{<1.16488,-2.01626,4.53111>,r}
+	cylinder{<1.16488,-2.01626,4.53111>,<1.16324,-2.02682,4.51958>,r}
+	sphere{<1.16324,-2.02682,4.51958>,r}
+	cylinder{<1.16324,-2.02682,4.51958>,<0.713756,-2.89283,4.72715>,r}
+	sphere{<0.713756,-2.89283,4.72715>,r}
+	cylinder{<0.713756,-2.89283,4.72715>,<0.94003,-2.15821,5.11873>,r}
+	sphere{<0.94003,-2.15821,5.11873>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.09855,-1.19019,5.66877>,<0.684872,-1.03791,5.11784>,<1.03901,-0.815092,5.05466>}
+	triangle{<1.09855,-1.19019,5.66877>,<1.03901,-0.815092,5.05466>,<1.207,-0.803018,5.16647>}
+	texture{t1}
+}
+union{
+	cylinder{<1.09855,-1.19019,5.66877>,<0.684872,-1.03791,5.11784>,r}
+	sphere{<0.684872,-1.03791,5.11784>,r}
+	cylinder{<0.684872,-1.03791,5.11784>,<1.03901,-0.815092,5.05466>,r}
+	sphere{<1.03901,-0.815092,5.05466>,r}
+	cylinder{<1.03901,-0.815092,5.05466>,<1.207,-0.803018,5.16647>,r}
+	sphere{<1.207,-0.803018,5.16647>,r}
+	cylinder{<1.207,-0.803018,5.16647>,<1.09855,-1.19019,5.66877>,r}
+	sphere{<1.09855,-1.19019,5.66877>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.66623,-1.59734,5.56568>,<1.92525,-1.46953,5.19314>,<1.92922,-1.871,5.04175>}
+	triangle{<1.66623,-1.59734,5.56568>,<1.92922,-1.871,5.04175>,<1.76276,-1.94994,5.28231>}
+	texture{t1}
+}
+union{
+	cylinder{<1.66623,-1.59734,5.56568>,<1.92525,-1.46953,5.19314>,r}
+	sphere{<1.92525,-1.46953,5.19314>,r}
+	cylinder{<1.92525,-1.46953,5.19314>,<1.92922,-1.871,5.04175>,r}
+	sphere{<1.92922,-1.871,5.04175>,r}
+	cylinder{<1.92922,-1.871,5.04175>,<1.76276,-1.94994,5.28231>,r}
+	sphere{<1.76276,-1.94994,5.28231>,r}
+	cylinder{<1.76276,-1.94994,5.28231>,<1.66623,-1.59734,5.56568>,r}
+	sphere{<1.66623,-1.59734,5.56568>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.744135,-1.94776,5.23363>,<0.867854,-1.96633,5.39728>,<1.00621,-2.15508,5.23324>}
+	triangle{<0.744135,-1.94776,5.23363>,<1.00621,-2.15508,5.23324>,<0.94003,-2.15821,5.11873>}
+	texture{t1}
+}
+union{
+	cylinder{<0.744135,-1.94776,5.23363>,<0.867854,-1.96633,5.39728>,r}
+	sphere{<0.867854,-1.96633,5.39728>,r}
+	cylinder{<0.867854,-1.96633,5.39728>,<1.00621,-2.15508,5.23324>,r}
+	sphere{<1.00621,-2.15508,5.23324>,r}
+	cylinder{<1.00621,-2.15508,5.23324>,<0.94003,-2.15821,5.11873>,r}
+	sphere{<0.94003,-2.15821,5.11873>,r}
+	cylinder{<0.94003,-2.15821,5.11873>,<0.744135,-1.94776,5.23363>,r}
+	sphere{<0.744135,-1.94776,5.23363>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.18687,-1.38897,5.79331>,<0.867854,-1.96633,5.39728>,<0.683009,-2.05642,6>}
+	triangle{<1.18687,-1.38897,5.79331>,<0.683009,-2.05642,6>,<1.17266,-1.34879,6>}
+	texture{t1}
+}
+union{
+	cylinder{<1.18687,-1.38897,5.79331>,<0.867854,-1.96633,5.39728>,r}
+	sphere{<0.867854,-1.96633,5.39728>,r}
+	cylinder{<0.867854,-1.96633,5.39728>,<0.683009,-2.05642,6>,r}
+	sphere{<0.683009,-2.05642,6>,r}
+	cylinder{<0.683009,-2.05642,6>,<1.17266,-1.34879,6>,r}
+	sphere{<1.17266,-1.34879,6>,r}
+	cylinder{<1.17266,-1.34879,6>,<1.18687,-1.38897,5.79331>,r}
+	sphere{<1.18687,-1.38897,5.79331>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.1708,-2.77034,6>,<2.0986,-3,6>,<1.90622,-3,5.71958>}
+	triangle{<2.1708,-2.77034,6>,<1.90622,-3,5.71958>,<1.93929,-2.34817,5.46908>}
+	texture{t1}
+}
+union{
+	cylinder{<2.1708,-2.77034,6>,<2.0986,-3,6>,r}
+	sphere{<2.0986,-3,6>,r}
+	cylinder{<2.0986,-3,6>,<1.90622,-3,5.71958>,r}
+	sphere{<1.90622,-3,5.71958>,r}
+	cylinder{<1.90622,-3,5.71958>,<1.93929,-2.34817,5.46908>,r}
+	sphere{<1.93929,-2.34817,5.46908>,r}
+	cylinder{<1.93929,-2.34817,5.46908>,<2.1708,-2.77034,6>,r}
+	sphere{<2.1708,-2.77034,6>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.92922,-1.871,5.04175>,<1.99703,-1.93479,5.03172>,<1.93929,-2.34817,5.46908>}
+	triangle{<1.92922,-1.871,5.04175>,<1.93929,-2.34817,5.46908>,<1.76276,-1.94994,5.28231>}
+	texture{t1}
+}
+union{
+	cylinder{<1.92922,-1.871,5.04175>,<1.99703,-1.93479,5.03172>,r}
+	sphere{<1.99703,-1.93479,5.03172>,r}
+	cylinder{<1.99703,-1.93479,5.03172>,<1.93929,-2.34817,5.46908>,r}
+	sphere{<1.93929,-2.34817,5.46908>,r}
+	cylinder{<1.93929,-2.34817,5.46908>,<1.76276,-1.94994,5.28231>,r}
+	sphere{<1.76276,-1.94994,5.28231>,r}
+	cylinder{<1.76276,-1.94994,5.28231>,<1.92922,-1.871,5.04175>,r}
+	sphere{<1.92922,-1.871,5.04175>,r}
+	texture{t2}
+}
+union{
+	triangle{<-3,-0.453208,6>,<-3,-0.55781,5.09955>,<-2.00041,-0.718924,4.73271>}
+	triangle{<-3,-0.453208,6>,<-2.00041,-0.718924,4.73271>,<-1.55743,-0.624224,6>}
+	texture{t1}
+}
+union{
+	cylinder{<-3,-0.453208,6>,<-3,-0.55781,5.09955>,r}
+	sphere{<-3,-0.55781,5.09955>,r}
+	cylinder{<-3,-0.55781,5.09955>,<-2.00041,-0.718924,4.73271>,r}
+	sphere{<-2.00041,-0.718924,4.73271>,r}
+	cylinder{<-2.00041,-0.718924,4.73271>,<-1.55743,-0.624224,6>,r}
+	sphere{<-1.55743,-0.624224,6>,r}
+	cylinder{<-1.55743,-0.624224,6>,<-3,-0.453208,6>,r}
+	sphere{<-3,-0.453208,6>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.175048,0.273533,4.94006>,<-0.178016,0.292254,4.92057>,<-0.00291725,0.100865,4.86991>}
+	triangle{<-0.175048,0.273533,4.94006>,<-0.00291725,0.100865,4.86991>,<-0.0100323,0.0824058,4.90647>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.175048,0.273533,4.94006>,<-0.178016,0.292254,4.92057>,r}
+	sphere{<-0.178016,0.292254,4.92057>,r}
+	cylinder{<-0.178016,0.292254,4.92057>,<-0.00291725,0.100865,4.86991>,r}
+	sphere{<-0.00291725,0.100865,4.86991>,r}
+	cylinder{<-0.00291725,0.100865,4.86991>,<-0.0100323,0.0824058,4.90647>,r}
+	sphere{<-0.0100323,0.0824058,4.90647>,r}
+	cylinder{<-0.0100323,0.0824058,4.90647>,<-0.175048,0.273533,4.94006>,r}
+	sphere{<-0.175048,0.273533,4.94006>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.175048,0.273533,4.94006>,<-0.302265,0.256881,4.98101>,<-0.272193,0.353487,4.87216>}
+	triangle{<-0.175048,0.273533,4.94006>,<-0.272193,0.353487,4.87216>,<-0.178016,0.292254,4.92057>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.175048,0.273533,4.94006>,<-0.302265,0.256881,4.98101>,r}
+	sphere{<-0.302265,0.256881,4.98101>,r}
+	cylinder{<-0.302265,0.256881,4.98101>,<-0.272193,0.353487,4.87216>,r}
+	sphere{<-0.272193,0.353487,4.87216>,r}
+	cylinder{<-0.272193,0.353487,4.87216>,<-0.178016,0.292254,4.92057>,r}
+	sphere{<-0.178016,0.292254,4.92057>,r}
+	cylinder{<-0.178016,0.292254,4.92057>,<-0.175048,0.273533,4.94006>,r}
+	sphere{<-0.175048,0.273533,4.94006>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.621245,-1.10414,5.03683>,<0.633798,-1.13415,4.90092>,<0.590882,-1.36796,4.83018>}
+	triangle{<0.621245,-1.10414,5.03683>,<0.590882,-1.36796,4.83018>,<0.557417,-1.43007,4.96632>}
+	texture{t1}
+}
+union{
+	cylinder{<0.621245,-1.10414,5.03683>,<0.633798,-1.13415,4.90092>,r}
+	sphere{<0.633798,-1.13415,4.90092>,r}
+	cylinder{<0.633798,-1.13415,4.90092>,<0.590882,-1.36796,4.83018>,r}
+	sphere{<0.590882,-1.36796,4.83018>,r}
+	cylinder{<0.590882,-1.36796,4.83018>,<0.557417,-1.43007,4.96632>,r}
+	sphere{<0.557417,-1.43007,4.96632>,r}
+	cylinder{<0.557417,-1.43007,4.96632>,<0.621245,-1.10414,5.03683>,r}
+	sphere{<0.621245,-1.10414,5.03683>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.711108,-0.984586,4.70831>,<-0.659755,-0.808938,5.18963>,<-0.762187,-1.11645,5.61309>}
+	triangle{<-0.711108,-0.984586,4.70831>,<-0.762187,-1.11645,5.61309>,<-0.754825,-1.12061,4.73475>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.711108,-0.984586,4.70831>,<-0.659755,-0.808938,5.18963>,r}
+	sphere{<-0.659755,-0.808938,5.18963>,r}
+	cylinder{<-0.659755,-0.808938,5.18963>,<-0.762187,-1.11645,5.61309>,r}
+	sphere{<-0.762187,-1.11645,5.61309>,r}
+	cylinder{<-0.762187,-1.11645,5.61309>,<-0.754825,-1.12061,4.73475>,r}
+	sphere{<-0.754825,-1.12061,4.73475>,r}
+	cylinder{<-0.754825,-1.12061,4.73475>,<-0.711108,-0.984586,4.70831>,r}
+	sphere{<-0.711108,-0.984586,4.70831>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.49975,-0.786852,6>,<-1.09497,-0.90736,6>,<-0.838707,-1.14716,5.76655>}
+	triangle{<-1.49975,-0.786852,6>,<-0.838707,-1.14716,5.76655>,<-1.65326,-1.49442,4.92446>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.49975,-0.786852,6>,<-1.09497,-0.90736,6>,r}
+	sphere{<-1.09497,-0.90736,6>,r}
+	cylinder{<-1.09497,-0.90736,6>,<-0.838707,-1.14716,5.76655>,r}
+	sphere{<-0.838707,-1.14716,5.76655>,r}
+	cylinder{<-0.838707,-1.14716,5.76655>,<-1.65326,-1.49442,4.92446>,r}
+	sphere{<-1.65326,-1.49442,4.92446>,r}
+	cylinder{<-1.65326,-1.49442,4.92446>,<-1.49975,-0.786852,6>,r}
+	sphere{<-1.49975,-0.786852,6>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.03901,-0.815092,5.05466>,<1.05716,-0.360622,5.10905>,<1.27963,-0.611727,5.23218>}
+	triangle{<1.03901,-0.815092,5.05466>,<1.27963,-0.611727,5.23218>,<1.207,-0.803018,5.16647>}
+	texture{t1}
+}
+union{
+	cylinder{<1.03901,-0.815092,5.05466>,<1.05716,-0.360622,5.10905>,r}
+	sphere{<1.05716,-0.360622,5.10905>,r}
+	cylinder{<1.05716,-0.360622,5.10905>,<1.27963,-0.611727,5.23218>,r}
+	sphere{<1.27963,-0.611727,5.23218>,r}
+	cylinder{<1.27963,-0.611727,5.23218>,<1.207,-0.803018,5.16647>,r}
+	sphere{<1.207,-0.803018,5.16647>,r}
+	cylinder{<1.207,-0.803018,5.16647>,<1.03901,-0.815092,5.05466>,r}
+	sphere{<1.03901,-0.815092,5.05466>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.213466,-0.770159,5.27536>,<-0.075572,-0.603211,4.98972>,<-0.0100323,0.0824058,4.90647>}
+	triangle{<0.213466,-0.770159,5.27536>,<-0.0100323,0.0824058,4.90647>,<0.394103,-0.16005,5.30771>}
+	texture{t1}
+}
+union{
+	cylinder{<0.213466,-0.770159,5.27536>,<-0.075572,-0.603211,4.98972>,r}
+	sphere{<-0.075572,-0.603211,4.98972>,r}
+	cylinder{<-0.075572,-0.603211,4.98972>,<-0.0100323,0.0824058,4.90647>,r}
+	sphere{<-0.0100323,0.0824058,4.90647>,r}
+	cylinder{<-0.0100323,0.0824058,4.90647>,<0.394103,-0.16005,5.30771>,r}
+	sphere{<0.394103,-0.16005,5.30771>,r}
+	cylinder{<0.394103,-0.16005,5.30771>,<0.213466,-0.770159,5.27536>,r}
+	sphere{<0.213466,-0.770159,5.27536>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.70375,-0.907305,6>,<3,-0.949311,6>,<3,-1.13507,5.54442>}
+	triangle{<2.70375,-0.907305,6>,<3,-1.13507,5.54442>,<2.4774,-1.10006,5.44855>}
+	texture{t1}
+}
+union{
+	cylinder{<2.70375,-0.907305,6>,<3,-0.949311,6>,r}
+	sphere{<3,-0.949311,6>,r}
+	cylinder{<3,-0.949311,6>,<3,-1.13507,5.54442>,r}
+	sphere{<3,-1.13507,5.54442>,r}
+	cylinder{<3,-1.13507,5.54442>,<2.4774,-1.10006,5.44855>,r}
+	sphere{<2.4774,-1.10006,5.44855>,r}
+	cylinder{<2.4774,-1.10006,5.44855>,<2.70375,-0.907305,6>,r}
+	sphere{<2.70375,-0.907305,6>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.07539,0.121968,5.03544>,<2.18374,-0.236842,5.92565>,<1.83351,-0.478684,5.1328>}
+	triangle{<2.07539,0.121968,5.03544>,<1.83351,-0.478684,5.1328>,<1.96943,-0.00153298,4.87044>}
+	texture{t1}
+}
+union{
+	cylinder{<2.07539,0.121968,5.03544>,<2.18374,-0.236842,5.92565>,r}
+	sphere{<2.18374,-0.236842,5.92565>,r}
+	cylinder{<2.18374,-0.236842,5.92565>,<1.83351,-0.478684,5.1328>,r}
+	sphere{<1.83351,-0.478684,5.1328>,r}
+	cylinder{<1.83351,-0.478684,5.1328>,<1.96943,-0.00153298,4.87044>,r}
+	sphere{<1.96943,-0.00153298,4.87044>,r}
+	cylinder{<1.96943,-0.00153298,4.87044>,<2.07539,0.121968,5.03544>,r}
+	sphere{<2.07539,0.121968,5.03544>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.99703,-1.93479,5.03172>,<2.01635,-1.96983,4.88535>,<1.91139,-1.86454,4.95661>}
+	triangle{<1.99703,-1.93479,5.03172>,<1.91139,-1.86454,4.95661>,<1.92922,-1.871,5.04175>}
+	texture{t1}
+}
+union{
+	cylinder{<1.99703,-1.93479,5.03172>,<2.01635,-1.96983,4.88535>,r}
+	sphere{<2.01635,-1.96983,4.88535>,r}
+	cylinder{<2.01635,-1.96983,4.88535>,<1.91139,-1.86454,4.95661>,r}
+	sphere{<1.91139,-1.86454,4.95661>,r}
+	cylinder{<1.91139,-1.86454,4.95661>,<1.92922,-1.871,5.04175>,r}
+	sphere{<1.92922,-1.871,5.04175>,r}
+	cylinder{<1.92922,-1.871,5.04175>,<1.99703,-1.93479,5.03172>,r}
+	sphere{<1.99703,-1.93479,5.03172>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.8247,-1.06727,4.86873>,<1.97719,-0.899895,4.90059>,<2.4774,-1.10006,5.44855>}
+	triangle{<1.8247,-1.06727,4.86873>,<2.4774,-1.10006,5.44855>,<1.92525,-1.46953,5.19314>}
+	texture{t1}
+}
+union{
+	cylinder{<1.8247,-1.06727,4.86873>,<1.97719,-0.899895,4.90059>,r}
+	sphere{<1.97719,-0.899895,4.90059>,r}
+	cylinder{<1.97719,-0.899895,4.90059>,<2.4774,-1.10006,5.44855>,r}
+	sphere{<2.4774,-1.10006,5.44855>,r}
+	cylinder{<2.4774,-1.10006,5.44855>,<1.92525,-1.46953,5.19314>,r}
+	sphere{<1.92525,-1.46953,5.19314>,r}
+	cylinder{<1.92525,-1.46953,5.19314>,<1.8247,-1.06727,4.86873>,r}
+	sphere{<1.8247,-1.06727,4.86873>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.17266,-1.34879,6>,<1.7006,-1.53566,6>,<1.66623,-1.59734,5.56568>}
+	triangle{<1.17266,-1.34879,6>,<1.66623,-1.59734,5.56568>,<1.18687,-1.38897,5.79331>}
+	texture{t1}
+}
+union{
+	cylinder{<1.17266,-1.34879,6>,<1.7006,-1.53566,6>,r}
+	sphere{<1.7006,-1.53566,6>,r}
+	cylinder{<1.7006,-1.53566,6>,<1.66623,-1.59734,5.56568>,r}
+	sphere{<1.66623,-1.59734,5.56568>,r}
+	cylinder{<1.66623,-1.59734,5.56568>,<1.18687,-1.38897,5.79331>,r}
+	sphere{<1.18687,-1.38897,5.79331>,r}
+	cylinder{<1.18687,-1.38897,5.79331>,<1.17266,-1.34879,6>,r}
+	sphere{<1.17266,-1.34879,6>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.17266,-1.34879,6>,<1.18687,-1.38897,5.79331>,<1.09855,-1.19019,5.66877>}
+	triangle{<1.17266,-1.34879,6>,<1.09855,-1.19019,5.66877>,<1.11191,-1.20898,6>}
+	texture{t1}
+}
+union{
+	cylinder{<1.17266,-1.34879,6>,<1.18687,-1.38897,5.79331>,r}
+	sphere{<1.18687,-1.38897,5.79331>,r}
+	cylinder{<1.18687,-1.38897,5.79331>,<1.09855,-1.19019,5.66877>,r}
+	sphere{<1.09855,-1.19019,5.66877>,r}
+	cylinder{<1.09855,-1.19019,5.66877>,<1.11191,-1.20898,6>,r}
+	sphere{<1.11191,-1.20898,6>,r}
+	cylinder{<1.11191,-1.20898,6>,<1.17266,-1.34879,6>,r}
+	sphere{<1.17266,-1.34879,6>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.71391,0.863319,5.66186>,<-1.72333,1.28549,5.28154>,<-1.34972,1.39141,4.54228>}
+	triangle{<-1.71391,0.863319,5.66186>,<-1.34972,1.39141,4.54228>,<-1.16699,0.874638,4.71464>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.71391,0.863319,5.66186>,<-1.72333,1.28549,5.28154>,r}
+	sphere{<-1.72333,1.28549,5.28154>,r}
+	cylinder{<-1.72333,1.28549,5.28154>,<-1.34972,1.39141,4.54228>,r}
+	sphere{<-1.34972,1.39141,4.54228>,r}
+	cylinder{<-1.34972,1.39141,4.54228>,<-1.16699,0.874638,4.71464>,r}
+	sphere{<-1.16699,0.874638,4.71464>,r}
+	cylinder{<-1.16699,0.874638,4.71464>,<-1.71391,0.863319,5.66186>,r}
+	sphere{<-1.71391,0.863319,5.66186>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.98287,0.261776,4.60447>,<-2.43496,0.566177,4.96655>,<-1.84849,0.669822,5.65236>}
+	triangle{<-1.98287,0.261776,4.60447>,<-1.84849,0.669822,5.65236>,<-1.67653,0.255845,4.82346>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.98287,0.261776,4.60447>,<-2.43496,0.566177,4.96655>,r}
+	sphere{<-2.43496,0.566177,4.96655>,r}
+	cylinder{<-2.43496,0.566177,4.96655>,<-1.84849,0.669822,5.65236>,r}
+	sphere{<-1.84849,0.669822,5.65236>,r}
+	cylinder{<-1.84849,0.669822,5.65236>,<-1.67653,0.255845,4.82346>,r}
+	sphere{<-1.67653,0.255845,4.82346>,r}
+	cylinder{<-1.67653,0.255845,4.82346>,<-1.98287,0.261776,4.60447>,r}
+	sphere{<-1.98287,0.261776,4.60447>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.72333,1.28549,5.28154>,<-1.70153,1.67442,6>,<-1.70435,0.838076,6>}
+	triangle{<-1.72333,1.28549,5.28154>,<-1.70435,0.838076,6>,<-1.71391,0.863319,5.66186>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.72333,1.28549,5.28154>,<-1.70153,1.67442,6>,r}
+	sphere{<-1.70153,1.67442,6>,r}
+	cylinder{<-1.70153,1.67442,6>,<-1.70435,0.838076,6>,r}
+	sphere{<-1.70435,0.838076,6>,r}
+	cylinder{<-1.70435,0.838076,6>,<-1.71391,0.863319,5.66186>,r}
+	sphere{<-1.71391,0.863319,5.66186>,r}
+	cylinder{<-1.71391,0.863319,5.66186>,<-1.72333,1.28549,5.28154>,r}
+	sphere{<-1.72333,1.28549,5.28154>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.60837,1.79347,6>,<-1.08725,1.93259,4.95169>,<-0.732993,1.94128,5.03354>}
+	triangle{<-1.60837,1.79347,6>,<-0.732993,1.94128,5.03354>,<-0.709181,1.83799,6>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.60837,1.79347,6>,<-1.08725,1.93259,4.95169>,r}
+	sphere{<-1.08725,1.93259,4.95169>,r}
+	cylinder{<-1.08725,1.93259,4.95169>,<-0.732993,1.94128,5.03354>,r}
+	sphere{<-0.732993,1.94128,5.03354>,r}
+	cylinder{<-0.732993,1.94128,5.03354>,<-0.709181,1.83799,6>,r}
+	sphere{<-0.709181,1.83799,6>,r}
+	cylinder{<-0.709181,1.83799,6>,<-1.60837,1.79347,6>,r}
+	sphere{<-1.60837,1.79347,6>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.986562,0.121281,6>,<-0.302265,0.256881,4.98101>,<-0.889835,-0.376135,5.22119>}
+	triangle{<-0.986562,0.121281,6>,<-0.889835,-0.376135,5.22119>,<-1.34818,-0.388602,6>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.986562,0.121281,6>,<-0.302265,0.256881,4.98101>,r}
+	sphere{<-0.302265,0.256881,4.98101>,r}
+	cylinder{<-0.302265,0.256881,4.98101>,<-0.889835,-0.376135,5.22119>,r}
+	sphere{<-0.889835,-0.376135,5.22119>,r}
+	cylinder{<-0.889835,-0.376135,5.22119>,<-1.34818,-0.388602,6>,r}
+	sphere{<-1.34818,-0.388602,6>,r}
+	cylinder{<-1.34818,-0.388602,6>,<-0.986562,0.121281,6>,r}
+	sphere{<-0.986562,0.121281,6>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.84849,0.669822,5.65236>,<-1.71391,0.863319,5.66186>,<-1.70435,0.838076,6>}
+	triangle{<-1.84849,0.669822,5.65236>,<-1.70435,0.838076,6>,<-1.83253,0.65274,6>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.84849,0.669822,5.65236>,<-1.71391,0.863319,5.66186>,r}
+	sphere{<-1.71391,0.863319,5.66186>,r}
+	cylinder{<-1.71391,0.863319,5.66186>,<-1.70435,0.838076,6>,r}
+	sphere{<-1.70435,0.838076,6>,r}
+	cylinder{<-1.70435,0.838076,6>,<-1.83253,0.65274,6>,r}
+	sphere{<-1.83253,0.65274,6>,r}
+	cylinder{<-1.83253,0.65274,6>,<-1.84849,0.669822,5.65236>,r}
+	sphere{<-1.84849,0.669822,5.65236>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.175048,0.273533,4.94006>,<-0.302265,0.256881,4.98101>,<-0.986562,0.121281,6>}
+	triangle{<-0.175048,0.273533,4.94006>,<-0.986562,0.121281,6>,<0.297666,0.265549,6>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.175048,0.273533,4.94006>,<-0.302265,0.256881,4.98101>,r}
+	sphere{<-0.302265,0.256881,4.98101>,r}
+	cylinder{<-0.302265,0.256881,4.98101>,<-0.986562,0.121281,6>,r}
+	sphere{<-0.986562,0.121281,6>,r}
+	cylinder{<-0.986562,0.121281,6>,<0.297666,0.265549,6>,r}
+	sphere{<0.297666,0.265549,6>,r}
+	cylinder{<0.297666,0.265549,6>,<-0.175048,0.273533,4.94006>,r}
+	sphere{<-0.175048,0.273533,4.94006>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.936083,0.819302,4.76962>,<1.12517,1.24694,4.64602>,<1.03619,1.53679,4.88043>}
+	triangle{<0.936083,0.819302,4.76962>,<1.03619,1.53679,4.88043>,<0.728918,1.12586,5.18322>}
+	texture{t1}
+}
+union{
+	cylinder{<0.936083,0.819302,4.76962>,<1.12517,1.24694,4.64602>,r}
+	sphere{<1.12517,1.24694,4.64602>,r}
+	cylinder{<1.12517,1.24694,4.64602>,<1.03619,1.53679,4.88043>,r}
+	sphere{<1.03619,1.53679,4.88043>,r}
+	cylinder{<1.03619,1.53679,4.88043>,<0.728918,1.12586,5.18322>,r}
+	sphere{<0.728918,1.12586,5.18322>,r}
+	cylinder{<0.728918,1.12586,5.18322>,<0.936083,0.819302,4.76962>,r}
+	sphere{<0.936083,0.819302,4.76962>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.394103,-0.16005,5.30771>,<0.378389,0.179721,6>,<0.867542,0.265375,6>}
+	triangle{<0.394103,-0.16005,5.30771>,<0.867542,0.265375,6>,<0.91111,-0.134442,5.17648>}
+	texture{t1}
+}
+union{
+	cylinder{<0.394103,-0.16005,5.30771>,<0.378389,0.179721,6>,r}
+	sphere{<0.378389,0.179721,6>,r}
+	cylinder{<0.378389,0.179721,6>,<0.867542,0.265375,6>,r}
+	sphere{<0.867542,0.265375,6>,r}
+	cylinder{<0.867542,0.265375,6>,<0.91111,-0.134442,5.17648>,r}
+	sphere{<0.91111,-0.134442,5.17648>,r}
+	cylinder{<0.91111,-0.134442,5.17648>,<0.394103,-0.16005,5.30771>,r}
+	sphere{<0.394103,-0.16005,5.30771>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.90472,0.895724,4.59268>,<1.93624,0.91669,4.59839>,<1.91607,0.904189,4.62615>}
+	triangle{<1.90472,0.895724,4.59268>,<1.91607,0.904189,4.62615>,<1.89902,0.892433,4.60889>}
+	texture{t1}
+}
+union{
+	cylinder{<1.90472,0.895724,4.59268>,<1.93624,0.91669,4.59839>,r}
+	sphere{<1.93624,0.91669,4.59839>,r}
+	cylinder{<1.93624,0.91669,4.59839>,<1.91607,0.904189,4.62615>,r}
+	sphere{<1.91607,0.904189,4.62615>,r}
+	cylinder{<1.91607,0.904189,4.62615>,<1.89902,0.892433,4.60889>,r}
+	sphere{<1.89902,0.892433,4.60889>,r}
+	cylinder{<1.89902,0.892433,4.60889>,<1.90472,0.895724,4.59268>,r}
+	sphere{<1.90472,0.895724,4.59268>,r}
+	texture{t2}
+}
+union{
+	triangle{<3,2.05095,4.65976>,<3,2.27435,5.68115>,<2.14499,1.87079,4.91991>}
+	triangle{<3,2.05095,4.65976>,<2.14499,1.87079,4.91991>,<2.35417,1.83987,4.51337>}
+	texture{t1}
+}
+union{
+	cylinder{<3,2.05095,4.65976>,<3,2.27435,5.68115>,r}
+	sphere{<3,2.27435,5.68115>,r}
+	cylinder{<3,2.27435,5.68115>,<2.14499,1.87079,4.91991>,r}
+	sphere{<2.14499,1.87079,4.91991>,r}
+	cylinder{<2.14499,1.87079,4.91991>,<2.35417,1.83987,4.51337>,r}
+	sphere{<2.35417,1.83987,4.51337>,r}
+	cylinder{<2.35417,1.83987,4.51337>,<3,2.05095,4.65976>,r}
+	sphere{<3,2.05095,4.65976>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.03954,0.752699,4.96245>,<1.91607,0.904189,4.62615>,<1.87136,1.43663,5.1013>}
+	triangle{<2.03954,0.752699,4.96245>,<1.87136,1.43663,5.1013>,<2.05946,1.24382,5.66114>}
+	texture{t1}
+}
+union{
+	cylinder{<2.03954,0.752699,4.96245>,<1.91607,0.904189,4.62615>,r}
+	sphere{<1.91607,0.904189,4.62615>,r}
+	cylinder{<1.91607,0.904189,4.62615>,<1.87136,1.43663,5.1013>,r}
+	sphere{<1.87136,1.43663,5.1013>,r}
+	cylinder{<1.87136,1.43663,5.1013>,<2.05946,1.24382,5.66114>,r}
+	sphere{<2.05946,1.24382,5.66114>,r}
+	cylinder{<2.05946,1.24382,5.66114>,<2.03954,0.752699,4.96245>,r}
+	sphere{<2.03954,0.752699,4.96245>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.51181,2.27678,4.74013>,<1.53211,2.24436,4.83347>,<1.66188,3,5.43008>}
+	triangle{<1.51181,2.27678,4.74013>,<1.66188,3,5.43008>,<1.51185,3,4.74037>}
+	texture{t1}
+}
+union{
+	cylinder{<1.51181,2.27678,4.74013>,<1.53211,2.24436,4.83347>,r}
+	sphere{<1.53211,2.24436,4.83347>,r}
+	cylinder{<1.53211,2.24436,4.83347>,<1.66188,3,5.43008>,r}
+	sphere{<1.66188,3,5.43008>,r}
+	cylinder{<1.66188,3,5.43008>,<1.51185,3,4.74037>,r}
+	sphere{<1.51185,3,4.74037>,r}
+	cylinder{<1.51185,3,4.74037>,<1.51181,2.27678,4.74013>,r}
+	sphere{<1.51181,2.27678,4.74013>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.0612618,3,6>,<0.0612613,2.90481,6>,<-0.016221,2.87945,5.41894>}
+	triangle{<0.0612618,3,6>,<-0.016221,2.87945,5.41894>,<-0.0162187,3,5.41896>}
+	texture{t1}
+}
+union{
+	cylinder{<0.0612618,3,6>,<0.0612613,2.90481,6>,r}
+	sphere{<0.0612613,2.90481,6>,r}
+	cylinder{<0.0612613,2.90481,6>,<-0.016221,2.87945,5.41894>,r}
+	sphere{<-0.016221,2.87945,5.41894>,r}
+	cylinder{<-0.016221,2.87945,5.41894>,<-0.0162187,3,5.41896>,r}
+	sphere{<-0.0162187,3,5.41896>,r}
+	cylinder{<-0.0162187,3,5.41896>,<0.0612618,3,6>,r}
+	sphere{<0.0612618,3,6>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.27646,1.64755,5.07292>,<1.47896,1.36572,6>,<1.10856,2.60426,6>}
+	triangle{<1.27646,1.64755,5.07292>,<1.10856,2.60426,6>,<1.20473,1.85718,5.00207>}
+	texture{t1}
+}
+union{
+	cylinder{<1.27646,1.64755,5.07292>,<1.47896,1.36572,6>,r}
+	sphere{<1.47896,1.36572,6>,r}
+	cylinder{<1.47896,1.36572,6>,<1.10856,2.60426,6>,r}
+	sphere{<1.10856,2.60426,6>,r}
+	cylinder{<1.10856,2.60426,6>,<1.20473,1.85718,5.00207>,r}
+	sphere{<1.20473,1.85718,5.00207>,r}
+	cylinder{<1.20473,1.85718,5.00207>,<1.27646,1.64755,5.07292>,r}
+	sphere{<1.27646,1.64755,5.07292>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.03619,1.53679,4.88043>,<0.962717,1.74407,4.80826>,<1.20473,1.85718,5.00207>}
+	triangle{<1.03619,1.53679,4.88043>,<1.20473,1.85718,5.00207>,<1.27646,1.64755,5.07292>}
+	texture{t1}
+}
+union{
+	cylinder{<1.03619,1.53679,4.88043>,<0.962717,1.74407,4.80826>,r}
+	sphere{<0.962717,1.74407,4.80826>,r}
+	cylinder{<0.962717,1.74407,4.80826>,<1.20473,1.85718,5.00207>,r}
+	sphere{<1.20473,1.85718,5.00207>,r}
+	cylinder{<1.20473,1.85718,5.00207>,<1.27646,1.64755,5.07292>,r}
+	sphere{<1.27646,1.64755,5.07292>,r}
+	cylinder{<1.27646,1.64755,5.07292>,<1.03619,1.53679,4.88043>,r}
+	sphere{<1.03619,1.53679,4.88043>,r}
+	texture{t2}
+}
@@ -0,0 +1,9348 @@
+union{
+	triangle{<-2.20875,-1.99708,0>,<-1.63103,-2.98796,0>,<-1.63103,-2.98712,1.03096>}
+	triangle{<-2.20875,-1.99708,0>,<-1.63103,-2.98712,1.03096>,<-1.72753,-2.82154,1.09336>}
+	triangle{<-2.20875,-1.99708,0>,<-1.72753,-2.82154,1.09336>,<-2.2084,-1.99708,0.723851>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.20875,-1.99708,0>,<-1.63103,-2.98796,0>,r}
+	sphere{<-1.63103,-2.98796,0>,r}
+	cylinder{<-1.63103,-2.98796,0>,<-1.63103,-2.98712,1.03096>,r}
+	sphere{<-1.63103,-2.98712,1.03096>,r}
+	cylinder{<-1.63103,-2.98712,1.03096>,<-1.72753,-2.82154,1.09336>,r}
+	sphere{<-1.72753,-2.82154,1.09336>,r}
+	cylinder{<-1.72753,-2.82154,1.09336>,<-2.2084,-1.99708,0.723851>,r}
+	sphere{<-2.2084,-1.99708,0.723851>,r}
+	cylinder{<-2.2084,-1.99708,0.723851>,<-2.20875,-1.99708,0>,r}
+	sphere{<-2.20875,-1.99708,0>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.04445,-2.94257,1.29797>,<-1.72753,-2.82154,1.09336>,<-1.63103,-2.98712,1.03096>}
+	triangle{<-2.04445,-2.94257,1.29797>,<-1.63103,-2.98712,1.03096>,<-1.63103,-3,1.03095>}
+	triangle{<-2.04445,-2.94257,1.29797>,<-1.63103,-3,1.03095>,<-2.04445,-3,1.29794>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.04445,-2.94257,1.29797>,<-1.72753,-2.82154,1.09336>,r}
+	sphere{<-1.72753,-2.82154,1.09336>,r}
+	cylinder{<-1.72753,-2.82154,1.09336>,<-1.63103,-2.98712,1.03096>,r}
+	sphere{<-1.63103,-2.98712,1.03096>,r}
+	cylinder{<-1.63103,-2.98712,1.03096>,<-1.63103,-3,1.03095>,r}
+	sphere{<-1.63103,-3,1.03095>,r}
+	cylinder{<-1.63103,-3,1.03095>,<-2.04445,-3,1.29794>,r}
+	sphere{<-2.04445,-3,1.29794>,r}
+	cylinder{<-2.04445,-3,1.29794>,<-2.04445,-2.94257,1.29797>,r}
+	sphere{<-2.04445,-2.94257,1.29797>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.04445,-2.94257,1.29797>,<-3,-2.38834,1.2949>,<-3,-2.00116,1.03375>}
+	triangle{<-2.04445,-2.94257,1.29797>,<-3,-2.00116,1.03375>,<-2.2084,-1.99708,0.723851>}
+	triangle{<-2.04445,-2.94257,1.29797>,<-2.2084,-1.99708,0.723851>,<-1.72753,-2.82154,1.09336>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.04445,-2.94257,1.29797>,<-3,-2.38834,1.2949>,r}
+	sphere{<-3,-2.38834,1.2949>,r}
+	cylinder{<-3,-2.38834,1.2949>,<-3,-2.00116,1.03375>,r}
+	sphere{<-3,-2.00116,1.03375>,r}
+	cylinder{<-3,-2.00116,1.03375>,<-2.2084,-1.99708,0.723851>,r}
+	sphere{<-2.2084,-1.99708,0.723851>,r}
+	cylinder{<-2.2084,-1.99708,0.723851>,<-1.72753,-2.82154,1.09336>,r}
+	sphere{<-1.72753,-2.82154,1.09336>,r}
+	cylinder{<-1.72753,-2.82154,1.09336>,<-2.04445,-2.94257,1.29797>,r}
+	sphere{<-2.04445,-2.94257,1.29797>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.00376,-2.00558,2.02054>,<-2.04445,-2.94257,1.29797>,<-3,-2.38834,1.2949>}
+	triangle{<-2.00376,-2.00558,2.02054>,<-3,-2.38834,1.2949>,<-3,-1.93596,1.63512>}
+	triangle{<-2.00376,-2.00558,2.02054>,<-3,-1.93596,1.63512>,<-2.02205,-1.98735,2.02622>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.00376,-2.00558,2.02054>,<-2.04445,-2.94257,1.29797>,r}
+	sphere{<-2.04445,-2.94257,1.29797>,r}
+	cylinder{<-2.04445,-2.94257,1.29797>,<-3,-2.38834,1.2949>,r}
+	sphere{<-3,-2.38834,1.2949>,r}
+	cylinder{<-3,-2.38834,1.2949>,<-3,-1.93596,1.63512>,r}
+	sphere{<-3,-1.93596,1.63512>,r}
+	cylinder{<-3,-1.93596,1.63512>,<-2.02205,-1.98735,2.02622>,r}
+	sphere{<-2.02205,-1.98735,2.02622>,r}
+	cylinder{<-2.02205,-1.98735,2.02622>,<-2.00376,-2.00558,2.02054>,r}
+	sphere{<-2.00376,-2.00558,2.02054>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.00376,-2.00558,2.02054>,<-1.60151,-1.9961,1.6437>,<-1.64563,-2.67398,1.13498>}
+	triangle{<-2.00376,-2.00558,2.02054>,<-1.64563,-2.67398,1.13498>,<-1.72753,-2.82154,1.09336>}
+	triangle{<-2.00376,-2.00558,2.02054>,<-1.72753,-2.82154,1.09336>,<-2.04445,-2.94257,1.29797>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.00376,-2.00558,2.02054>,<-1.60151,-1.9961,1.6437>,r}
+	sphere{<-1.60151,-1.9961,1.6437>,r}
+	cylinder{<-1.60151,-1.9961,1.6437>,<-1.64563,-2.67398,1.13498>,r}
+	sphere{<-1.64563,-2.67398,1.13498>,r}
+	cylinder{<-1.64563,-2.67398,1.13498>,<-1.72753,-2.82154,1.09336>,r}
+	sphere{<-1.72753,-2.82154,1.09336>,r}
+	cylinder{<-1.72753,-2.82154,1.09336>,<-2.04445,-2.94257,1.29797>,r}
+	sphere{<-2.04445,-2.94257,1.29797>,r}
+	cylinder{<-2.04445,-2.94257,1.29797>,<-2.00376,-2.00558,2.02054>,r}
+	sphere{<-2.00376,-2.00558,2.02054>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.72753,-2.82154,1.09336>,<-1.64563,-2.67398,1.13498>,<-1.59252,-1.49552,1.08183>}
+	triangle{<-1.72753,-2.82154,1.09336>,<-1.59252,-1.49552,1.08183>,<-1.92213,-1.49703,0.870491>}
+	triangle{<-1.72753,-2.82154,1.09336>,<-1.92213,-1.49703,0.870491>,<-2.2084,-1.99708,0.723851>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.72753,-2.82154,1.09336>,<-1.64563,-2.67398,1.13498>,r}
+	sphere{<-1.64563,-2.67398,1.13498>,r}
+	cylinder{<-1.64563,-2.67398,1.13498>,<-1.59252,-1.49552,1.08183>,r}
+	sphere{<-1.59252,-1.49552,1.08183>,r}
+	cylinder{<-1.59252,-1.49552,1.08183>,<-1.92213,-1.49703,0.870491>,r}
+	sphere{<-1.92213,-1.49703,0.870491>,r}
+	cylinder{<-1.92213,-1.49703,0.870491>,<-2.2084,-1.99708,0.723851>,r}
+	sphere{<-2.2084,-1.99708,0.723851>,r}
+	cylinder{<-2.2084,-1.99708,0.723851>,<-1.72753,-2.82154,1.09336>,r}
+	sphere{<-1.72753,-2.82154,1.09336>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.92213,-1.49703,0.870491>,<-1.59252,-1.49552,1.08183>,<-1.5921,-1.49001,1.08825>}
+	triangle{<-1.92213,-1.49703,0.870491>,<-1.5921,-1.49001,1.08825>,<-1.7829,-1.26406,1.21931>}
+	triangle{<-1.92213,-1.49703,0.870491>,<-1.7829,-1.26406,1.21931>,<-2.01427,-1.33835,0.989153>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.92213,-1.49703,0.870491>,<-1.59252,-1.49552,1.08183>,r}
+	sphere{<-1.59252,-1.49552,1.08183>,r}
+	cylinder{<-1.59252,-1.49552,1.08183>,<-1.5921,-1.49001,1.08825>,r}
+	sphere{<-1.5921,-1.49001,1.08825>,r}
+	cylinder{<-1.5921,-1.49001,1.08825>,<-1.7829,-1.26406,1.21931>,r}
+	sphere{<-1.7829,-1.26406,1.21931>,r}
+	cylinder{<-1.7829,-1.26406,1.21931>,<-2.01427,-1.33835,0.989153>,r}
+	sphere{<-2.01427,-1.33835,0.989153>,r}
+	cylinder{<-2.01427,-1.33835,0.989153>,<-1.92213,-1.49703,0.870491>,r}
+	sphere{<-1.92213,-1.49703,0.870491>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.92213,-1.49703,0.870491>,<-2.01427,-1.33835,0.989153>,<-3,-1.69057,1.19492>}
+	triangle{<-1.92213,-1.49703,0.870491>,<-3,-1.69057,1.19492>,<-3,-2.00116,1.03375>}
+	triangle{<-1.92213,-1.49703,0.870491>,<-3,-2.00116,1.03375>,<-2.2084,-1.99708,0.723851>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.92213,-1.49703,0.870491>,<-2.01427,-1.33835,0.989153>,r}
+	sphere{<-2.01427,-1.33835,0.989153>,r}
+	cylinder{<-2.01427,-1.33835,0.989153>,<-3,-1.69057,1.19492>,r}
+	sphere{<-3,-1.69057,1.19492>,r}
+	cylinder{<-3,-1.69057,1.19492>,<-3,-2.00116,1.03375>,r}
+	sphere{<-3,-2.00116,1.03375>,r}
+	cylinder{<-3,-2.00116,1.03375>,<-2.2084,-1.99708,0.723851>,r}
+	sphere{<-2.2084,-1.99708,0.723851>,r}
+	cylinder{<-2.2084,-1.99708,0.723851>,<-1.92213,-1.49703,0.870491>,r}
+	sphere{<-1.92213,-1.49703,0.870491>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.59252,-1.49552,1.08183>,<-1.64563,-2.67398,1.13498>,<-1.60151,-1.9961,1.6437>}
+	triangle{<-1.59252,-1.49552,1.08183>,<-1.60151,-1.9961,1.6437>,<-1.58636,-1.49214,1.32023>}
+	triangle{<-1.59252,-1.49552,1.08183>,<-1.58636,-1.49214,1.32023>,<-1.5921,-1.49001,1.08825>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.59252,-1.49552,1.08183>,<-1.64563,-2.67398,1.13498>,r}
+	sphere{<-1.64563,-2.67398,1.13498>,r}
+	cylinder{<-1.64563,-2.67398,1.13498>,<-1.60151,-1.9961,1.6437>,r}
+	sphere{<-1.60151,-1.9961,1.6437>,r}
+	cylinder{<-1.60151,-1.9961,1.6437>,<-1.58636,-1.49214,1.32023>,r}
+	sphere{<-1.58636,-1.49214,1.32023>,r}
+	cylinder{<-1.58636,-1.49214,1.32023>,<-1.5921,-1.49001,1.08825>,r}
+	sphere{<-1.5921,-1.49001,1.08825>,r}
+	cylinder{<-1.5921,-1.49001,1.08825>,<-1.59252,-1.49552,1.08183>,r}
+	sphere{<-1.59252,-1.49552,1.08183>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.92213,-1.49703,0.870491>,<-1.92234,-1.49668,0>,<-1.32054,-1.49376,0>}
+	triangle{<-1.92213,-1.49703,0.870491>,<-1.32054,-1.49376,0>,<-1.32069,-1.49412,0.886294>}
+	triangle{<-1.92213,-1.49703,0.870491>,<-1.32069,-1.49412,0.886294>,<-1.59252,-1.49552,1.08183>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.92213,-1.49703,0.870491>,<-1.92234,-1.49668,0>,r}
+	sphere{<-1.92234,-1.49668,0>,r}
+	cylinder{<-1.92234,-1.49668,0>,<-1.32054,-1.49376,0>,r}
+	sphere{<-1.32054,-1.49376,0>,r}
+	cylinder{<-1.32054,-1.49376,0>,<-1.32069,-1.49412,0.886294>,r}
+	sphere{<-1.32069,-1.49412,0.886294>,r}
+	cylinder{<-1.32069,-1.49412,0.886294>,<-1.59252,-1.49552,1.08183>,r}
+	sphere{<-1.59252,-1.49552,1.08183>,r}
+	cylinder{<-1.59252,-1.49552,1.08183>,<-1.92213,-1.49703,0.870491>,r}
+	sphere{<-1.92213,-1.49703,0.870491>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.0457,-1.9859,0.694749>,<-1.55108,-2.85031,1.06921>,<-1.64563,-2.67398,1.13498>}
+	triangle{<-1.0457,-1.9859,0.694749>,<-1.64563,-2.67398,1.13498>,<-1.59252,-1.49552,1.08183>}
+	triangle{<-1.0457,-1.9859,0.694749>,<-1.59252,-1.49552,1.08183>,<-1.32069,-1.49412,0.886294>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.0457,-1.9859,0.694749>,<-1.55108,-2.85031,1.06921>,r}
+	sphere{<-1.55108,-2.85031,1.06921>,r}
+	cylinder{<-1.55108,-2.85031,1.06921>,<-1.64563,-2.67398,1.13498>,r}
+	sphere{<-1.64563,-2.67398,1.13498>,r}
+	cylinder{<-1.64563,-2.67398,1.13498>,<-1.59252,-1.49552,1.08183>,r}
+	sphere{<-1.59252,-1.49552,1.08183>,r}
+	cylinder{<-1.59252,-1.49552,1.08183>,<-1.32069,-1.49412,0.886294>,r}
+	sphere{<-1.32069,-1.49412,0.886294>,r}
+	cylinder{<-1.32069,-1.49412,0.886294>,<-1.0457,-1.9859,0.694749>,r}
+	sphere{<-1.0457,-1.9859,0.694749>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.0157998,-3,0.615021>,<-1.047,-3,1.31031>,<-1.04699,-2.95643,1.31032>}
+	triangle{<-0.0157998,-3,0.615021>,<-1.04699,-2.95643,1.31032>,<-0.4553,-2.00683,0.911534>}
+	triangle{<-0.0157998,-3,0.615021>,<-0.4553,-2.00683,0.911534>,<-0.430876,-2.0077,0.895066>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.0157998,-3,0.615021>,<-1.047,-3,1.31031>,r}
+	sphere{<-1.047,-3,1.31031>,r}
+	cylinder{<-1.047,-3,1.31031>,<-1.04699,-2.95643,1.31032>,r}
+	sphere{<-1.04699,-2.95643,1.31032>,r}
+	cylinder{<-1.04699,-2.95643,1.31032>,<-0.4553,-2.00683,0.911534>,r}
+	sphere{<-0.4553,-2.00683,0.911534>,r}
+	cylinder{<-0.4553,-2.00683,0.911534>,<-0.430876,-2.0077,0.895066>,r}
+	sphere{<-0.430876,-2.0077,0.895066>,r}
+	cylinder{<-0.430876,-2.0077,0.895066>,<-0.0157998,-3,0.615021>,r}
+	sphere{<-0.0157998,-3,0.615021>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.431011,-2.00775,0>,<-0.430876,-2.0077,0.895066>,<-0.4553,-2.00683,0.911534>}
+	triangle{<-0.431011,-2.00775,0>,<-0.4553,-2.00683,0.911534>,<-1.0457,-1.9859,0.694749>}
+	triangle{<-0.431011,-2.00775,0>,<-1.0457,-1.9859,0.694749>,<-1.0454,-1.98595,0>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.431011,-2.00775,0>,<-0.430876,-2.0077,0.895066>,r}
+	sphere{<-0.430876,-2.0077,0.895066>,r}
+	cylinder{<-0.430876,-2.0077,0.895066>,<-0.4553,-2.00683,0.911534>,r}
+	sphere{<-0.4553,-2.00683,0.911534>,r}
+	cylinder{<-0.4553,-2.00683,0.911534>,<-1.0457,-1.9859,0.694749>,r}
+	sphere{<-1.0457,-1.9859,0.694749>,r}
+	cylinder{<-1.0457,-1.9859,0.694749>,<-1.0454,-1.98595,0>,r}
+	sphere{<-1.0454,-1.98595,0>,r}
+	cylinder{<-1.0454,-1.98595,0>,<-0.431011,-2.00775,0>,r}
+	sphere{<-0.431011,-2.00775,0>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.55108,-2.85031,1.06921>,<-1.04699,-2.95643,1.31032>,<-1.047,-3,1.31031>}
+	triangle{<-1.55108,-2.85031,1.06921>,<-1.047,-3,1.31031>,<-1.63103,-3,1.03095>}
+	triangle{<-1.55108,-2.85031,1.06921>,<-1.63103,-3,1.03095>,<-1.63103,-2.98712,1.03096>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.55108,-2.85031,1.06921>,<-1.04699,-2.95643,1.31032>,r}
+	sphere{<-1.04699,-2.95643,1.31032>,r}
+	cylinder{<-1.04699,-2.95643,1.31032>,<-1.047,-3,1.31031>,r}
+	sphere{<-1.047,-3,1.31031>,r}
+	cylinder{<-1.047,-3,1.31031>,<-1.63103,-3,1.03095>,r}
+	sphere{<-1.63103,-3,1.03095>,r}
+	cylinder{<-1.63103,-3,1.03095>,<-1.63103,-2.98712,1.03096>,r}
+	sphere{<-1.63103,-2.98712,1.03096>,r}
+	cylinder{<-1.63103,-2.98712,1.03096>,<-1.55108,-2.85031,1.06921>,r}
+	sphere{<-1.55108,-2.85031,1.06921>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.55108,-2.85031,1.06921>,<-1.63103,-2.98712,1.03096>,<-1.63103,-2.98796,0>}
+	triangle{<-1.55108,-2.85031,1.06921>,<-1.63103,-2.98796,0>,<-1.0454,-1.98595,0>}
+	triangle{<-1.55108,-2.85031,1.06921>,<-1.0454,-1.98595,0>,<-1.0457,-1.9859,0.694749>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.55108,-2.85031,1.06921>,<-1.63103,-2.98712,1.03096>,r}
+	sphere{<-1.63103,-2.98712,1.03096>,r}
+	cylinder{<-1.63103,-2.98712,1.03096>,<-1.63103,-2.98796,0>,r}
+	sphere{<-1.63103,-2.98796,0>,r}
+	cylinder{<-1.63103,-2.98796,0>,<-1.0454,-1.98595,0>,r}
+	sphere{<-1.0454,-1.98595,0>,r}
+	cylinder{<-1.0454,-1.98595,0>,<-1.0457,-1.9859,0.694749>,r}
+	sphere{<-1.0457,-1.9859,0.694749>,r}
+	cylinder{<-1.0457,-1.9859,0.694749>,<-1.55108,-2.85031,1.06921>,r}
+	sphere{<-1.55108,-2.85031,1.06921>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.641056,-3,2.09052>,<-1.047,-3,1.31031>,<-1.04699,-2.95643,1.31032>}
+	triangle{<-0.641056,-3,2.09052>,<-1.04699,-2.95643,1.31032>,<-0.81803,-2.53876,1.75042>}
+	triangle{<-0.641056,-3,2.09052>,<-0.81803,-2.53876,1.75042>,<-0.641057,-2.96745,2.09053>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.641056,-3,2.09052>,<-1.047,-3,1.31031>,r}
+	sphere{<-1.047,-3,1.31031>,r}
+	cylinder{<-1.047,-3,1.31031>,<-1.04699,-2.95643,1.31032>,r}
+	sphere{<-1.04699,-2.95643,1.31032>,r}
+	cylinder{<-1.04699,-2.95643,1.31032>,<-0.81803,-2.53876,1.75042>,r}
+	sphere{<-0.81803,-2.53876,1.75042>,r}
+	cylinder{<-0.81803,-2.53876,1.75042>,<-0.641057,-2.96745,2.09053>,r}
+	sphere{<-0.641057,-2.96745,2.09053>,r}
+	cylinder{<-0.641057,-2.96745,2.09053>,<-0.641056,-3,2.09052>,r}
+	sphere{<-0.641056,-3,2.09052>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.81803,-2.53876,1.75042>,<-1.04699,-2.95643,1.31032>,<-0.4553,-2.00683,0.911534>}
+	triangle{<-0.81803,-2.53876,1.75042>,<-0.4553,-2.00683,0.911534>,<-0.448645,-1.99494,0.921333>}
+	triangle{<-0.81803,-2.53876,1.75042>,<-0.448645,-1.99494,0.921333>,<-0.440292,-1.9237,1.60043>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.81803,-2.53876,1.75042>,<-1.04699,-2.95643,1.31032>,r}
+	sphere{<-1.04699,-2.95643,1.31032>,r}
+	cylinder{<-1.04699,-2.95643,1.31032>,<-0.4553,-2.00683,0.911534>,r}
+	sphere{<-0.4553,-2.00683,0.911534>,r}
+	cylinder{<-0.4553,-2.00683,0.911534>,<-0.448645,-1.99494,0.921333>,r}
+	sphere{<-0.448645,-1.99494,0.921333>,r}
+	cylinder{<-0.448645,-1.99494,0.921333>,<-0.440292,-1.9237,1.60043>,r}
+	sphere{<-0.440292,-1.9237,1.60043>,r}
+	cylinder{<-0.440292,-1.9237,1.60043>,<-0.81803,-2.53876,1.75042>,r}
+	sphere{<-0.81803,-2.53876,1.75042>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.18147,-1.99335,1.90931>,<-1.60151,-1.9961,1.6437>,<-1.58636,-1.49214,1.32023>}
+	triangle{<-1.18147,-1.99335,1.90931>,<-1.58636,-1.49214,1.32023>,<-0.862929,-1.48721,1.77755>}
+	triangle{<-1.18147,-1.99335,1.90931>,<-0.862929,-1.48721,1.77755>,<-0.861112,-1.49196,1.78185>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.18147,-1.99335,1.90931>,<-1.60151,-1.9961,1.6437>,r}
+	sphere{<-1.60151,-1.9961,1.6437>,r}
+	cylinder{<-1.60151,-1.9961,1.6437>,<-1.58636,-1.49214,1.32023>,r}
+	sphere{<-1.58636,-1.49214,1.32023>,r}
+	cylinder{<-1.58636,-1.49214,1.32023>,<-0.862929,-1.48721,1.77755>,r}
+	sphere{<-0.862929,-1.48721,1.77755>,r}
+	cylinder{<-0.862929,-1.48721,1.77755>,<-0.861112,-1.49196,1.78185>,r}
+	sphere{<-0.861112,-1.49196,1.78185>,r}
+	cylinder{<-0.861112,-1.49196,1.78185>,<-1.18147,-1.99335,1.90931>,r}
+	sphere{<-1.18147,-1.99335,1.90931>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.18147,-1.99335,1.90931>,<-0.861112,-1.49196,1.78185>,<-0.619836,-1.55977,1.68014>}
+	triangle{<-1.18147,-1.99335,1.90931>,<-0.619836,-1.55977,1.68014>,<-0.440292,-1.9237,1.60043>}
+	triangle{<-1.18147,-1.99335,1.90931>,<-0.440292,-1.9237,1.60043>,<-0.81803,-2.53876,1.75042>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.18147,-1.99335,1.90931>,<-0.861112,-1.49196,1.78185>,r}
+	sphere{<-0.861112,-1.49196,1.78185>,r}
+	cylinder{<-0.861112,-1.49196,1.78185>,<-0.619836,-1.55977,1.68014>,r}
+	sphere{<-0.619836,-1.55977,1.68014>,r}
+	cylinder{<-0.619836,-1.55977,1.68014>,<-0.440292,-1.9237,1.60043>,r}
+	sphere{<-0.440292,-1.9237,1.60043>,r}
+	cylinder{<-0.440292,-1.9237,1.60043>,<-0.81803,-2.53876,1.75042>,r}
+	sphere{<-0.81803,-2.53876,1.75042>,r}
+	cylinder{<-0.81803,-2.53876,1.75042>,<-1.18147,-1.99335,1.90931>,r}
+	sphere{<-1.18147,-1.99335,1.90931>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.440292,-1.9237,1.60043>,<-0.619836,-1.55977,1.68014>,<-0.66261,-1.48315,1.62103>}
+	triangle{<-0.440292,-1.9237,1.60043>,<-0.66261,-1.48315,1.62103>,<-0.696386,-1.47899,1.13814>}
+	triangle{<-0.440292,-1.9237,1.60043>,<-0.696386,-1.47899,1.13814>,<-0.448645,-1.99494,0.921333>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.440292,-1.9237,1.60043>,<-0.619836,-1.55977,1.68014>,r}
+	sphere{<-0.619836,-1.55977,1.68014>,r}
+	cylinder{<-0.619836,-1.55977,1.68014>,<-0.66261,-1.48315,1.62103>,r}
+	sphere{<-0.66261,-1.48315,1.62103>,r}
+	cylinder{<-0.66261,-1.48315,1.62103>,<-0.696386,-1.47899,1.13814>,r}
+	sphere{<-0.696386,-1.47899,1.13814>,r}
+	cylinder{<-0.696386,-1.47899,1.13814>,<-0.448645,-1.99494,0.921333>,r}
+	sphere{<-0.448645,-1.99494,0.921333>,r}
+	cylinder{<-0.448645,-1.99494,0.921333>,<-0.440292,-1.9237,1.60043>,r}
+	sphere{<-0.440292,-1.9237,1.60043>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.330777,-3,0>,<0.330662,-3,0.755345>,<0.372917,-2.89846,0.818318>}
+	triangle{<0.330777,-3,0>,<0.372917,-2.89846,0.818318>,<0.694345,-2.12619,0.904081>}
+	triangle{<0.330777,-3,0>,<0.694345,-2.12619,0.904081>,<0.810524,-1.8474,-5.55112e-17>}
+	texture{t1}
+}
+union{
+	cylinder{<0.330777,-3,0>,<0.330662,-3,0.755345>,r}
+	sphere{<0.330662,-3,0.755345>,r}
+	cylinder{<0.330662,-3,0.755345>,<0.372917,-2.89846,0.818318>,r}
+	sphere{<0.372917,-2.89846,0.818318>,r}
+	cylinder{<0.372917,-2.89846,0.818318>,<0.694345,-2.12619,0.904081>,r}
+	sphere{<0.694345,-2.12619,0.904081>,r}
+	cylinder{<0.694345,-2.12619,0.904081>,<0.810524,-1.8474,-5.55112e-17>,r}
+	sphere{<0.810524,-1.8474,-5.55112e-17>,r}
+	cylinder{<0.810524,-1.8474,-5.55112e-17>,<0.330777,-3,0>,r}
+	sphere{<0.330777,-3,0>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.239667,-1.48843,0.66933>,<0.461096,-1.95676,1.12791>,<0.32674,-2.06288,1.17699>}
+	triangle{<0.239667,-1.48843,0.66933>,<0.32674,-2.06288,1.17699>,<-0.425468,-1.99998,0.900742>}
+	triangle{<0.239667,-1.48843,0.66933>,<-0.425468,-1.99998,0.900742>,<-0.0665192,-1.48754,0.577613>}
+	texture{t1}
+}
+union{
+	cylinder{<0.239667,-1.48843,0.66933>,<0.461096,-1.95676,1.12791>,r}
+	sphere{<0.461096,-1.95676,1.12791>,r}
+	cylinder{<0.461096,-1.95676,1.12791>,<0.32674,-2.06288,1.17699>,r}
+	sphere{<0.32674,-2.06288,1.17699>,r}
+	cylinder{<0.32674,-2.06288,1.17699>,<-0.425468,-1.99998,0.900742>,r}
+	sphere{<-0.425468,-1.99998,0.900742>,r}
+	cylinder{<-0.425468,-1.99998,0.900742>,<-0.0665192,-1.48754,0.577613>,r}
+	sphere{<-0.0665192,-1.48754,0.577613>,r}
+	cylinder{<-0.0665192,-1.48754,0.577613>,<0.239667,-1.48843,0.66933>,r}
+	sphere{<0.239667,-1.48843,0.66933>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.239667,-1.48843,0.66933>,<0.503361,-1.48922,-5.55112e-17>,<0.810524,-1.8474,-5.55112e-17>}
+	triangle{<0.239667,-1.48843,0.66933>,<0.810524,-1.8474,-5.55112e-17>,<0.694345,-2.12619,0.904081>}
+	triangle{<0.239667,-1.48843,0.66933>,<0.694345,-2.12619,0.904081>,<0.461096,-1.95676,1.12791>}
+	texture{t1}
+}
+union{
+	cylinder{<0.239667,-1.48843,0.66933>,<0.503361,-1.48922,-5.55112e-17>,r}
+	sphere{<0.503361,-1.48922,-5.55112e-17>,r}
+	cylinder{<0.503361,-1.48922,-5.55112e-17>,<0.810524,-1.8474,-5.55112e-17>,r}
+	sphere{<0.810524,-1.8474,-5.55112e-17>,r}
+	cylinder{<0.810524,-1.8474,-5.55112e-17>,<0.694345,-2.12619,0.904081>,r}
+	sphere{<0.694345,-2.12619,0.904081>,r}
+	cylinder{<0.694345,-2.12619,0.904081>,<0.461096,-1.95676,1.12791>,r}
+	sphere{<0.461096,-1.95676,1.12791>,r}
+	cylinder{<0.461096,-1.95676,1.12791>,<0.239667,-1.48843,0.66933>,r}
+	sphere{<0.239667,-1.48843,0.66933>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.430876,-2.0077,0.895066>,<-0.431011,-2.00775,0>,<-0.0665987,-1.48756,0>}
+	triangle{<-0.430876,-2.0077,0.895066>,<-0.0665987,-1.48756,0>,<-0.0665192,-1.48754,0.577613>}
+	triangle{<-0.430876,-2.0077,0.895066>,<-0.0665192,-1.48754,0.577613>,<-0.425468,-1.99998,0.900742>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.430876,-2.0077,0.895066>,<-0.431011,-2.00775,0>,r}
+	sphere{<-0.431011,-2.00775,0>,r}
+	cylinder{<-0.431011,-2.00775,0>,<-0.0665987,-1.48756,0>,r}
+	sphere{<-0.0665987,-1.48756,0>,r}
+	cylinder{<-0.0665987,-1.48756,0>,<-0.0665192,-1.48754,0.577613>,r}
+	sphere{<-0.0665192,-1.48754,0.577613>,r}
+	cylinder{<-0.0665192,-1.48754,0.577613>,<-0.425468,-1.99998,0.900742>,r}
+	sphere{<-0.425468,-1.99998,0.900742>,r}
+	cylinder{<-0.425468,-1.99998,0.900742>,<-0.430876,-2.0077,0.895066>,r}
+	sphere{<-0.430876,-2.0077,0.895066>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.22457,-3,1.06682>,<0.37377,-3,0.819571>,<0.372917,-2.89846,0.818318>}
+	triangle{<1.22457,-3,1.06682>,<0.372917,-2.89846,0.818318>,<0.694345,-2.12619,0.904081>}
+	triangle{<1.22457,-3,1.06682>,<0.694345,-2.12619,0.904081>,<1.23193,-2.06382,1.05969>}
+	texture{t1}
+}
+union{
+	cylinder{<1.22457,-3,1.06682>,<0.37377,-3,0.819571>,r}
+	sphere{<0.37377,-3,0.819571>,r}
+	cylinder{<0.37377,-3,0.819571>,<0.372917,-2.89846,0.818318>,r}
+	sphere{<0.372917,-2.89846,0.818318>,r}
+	cylinder{<0.372917,-2.89846,0.818318>,<0.694345,-2.12619,0.904081>,r}
+	sphere{<0.694345,-2.12619,0.904081>,r}
+	cylinder{<0.694345,-2.12619,0.904081>,<1.23193,-2.06382,1.05969>,r}
+	sphere{<1.23193,-2.06382,1.05969>,r}
+	cylinder{<1.23193,-2.06382,1.05969>,<1.22457,-3,1.06682>,r}
+	sphere{<1.22457,-3,1.06682>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.0845,-1.79317,5.55112e-17>,<1.31456,-2.02406,0.976969>,<1.23193,-2.06382,1.05969>}
+	triangle{<1.0845,-1.79317,5.55112e-17>,<1.23193,-2.06382,1.05969>,<0.694345,-2.12619,0.904081>}
+	triangle{<1.0845,-1.79317,5.55112e-17>,<0.694345,-2.12619,0.904081>,<0.810524,-1.8474,5.55112e-17>}
+	texture{t1}
+}
+union{
+	cylinder{<1.0845,-1.79317,5.55112e-17>,<1.31456,-2.02406,0.976969>,r}
+	sphere{<1.31456,-2.02406,0.976969>,r}
+	cylinder{<1.31456,-2.02406,0.976969>,<1.23193,-2.06382,1.05969>,r}
+	sphere{<1.23193,-2.06382,1.05969>,r}
+	cylinder{<1.23193,-2.06382,1.05969>,<0.694345,-2.12619,0.904081>,r}
+	sphere{<0.694345,-2.12619,0.904081>,r}
+	cylinder{<0.694345,-2.12619,0.904081>,<0.810524,-1.8474,5.55112e-17>,r}
+	sphere{<0.810524,-1.8474,5.55112e-17>,r}
+	cylinder{<0.810524,-1.8474,5.55112e-17>,<1.0845,-1.79317,5.55112e-17>,r}
+	sphere{<1.0845,-1.79317,5.55112e-17>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.0597,-2.13312,1.98681>,<1.43161,-2.56939,1.86194>,<1.42682,-3,1.85969>}
+	triangle{<1.0597,-2.13312,1.98681>,<1.42682,-3,1.85969>,<0.78382,-3,2.06892>}
+	triangle{<1.0597,-2.13312,1.98681>,<0.78382,-3,2.06892>,<0.781438,-2.17082,2.07702>}
+	texture{t1}
+}
+union{
+	cylinder{<1.0597,-2.13312,1.98681>,<1.43161,-2.56939,1.86194>,r}
+	sphere{<1.43161,-2.56939,1.86194>,r}
+	cylinder{<1.43161,-2.56939,1.86194>,<1.42682,-3,1.85969>,r}
+	sphere{<1.42682,-3,1.85969>,r}
+	cylinder{<1.42682,-3,1.85969>,<0.78382,-3,2.06892>,r}
+	sphere{<0.78382,-3,2.06892>,r}
+	cylinder{<0.78382,-3,2.06892>,<0.781438,-2.17082,2.07702>,r}
+	sphere{<0.781438,-2.17082,2.07702>,r}
+	cylinder{<0.781438,-2.17082,2.07702>,<1.0597,-2.13312,1.98681>,r}
+	sphere{<1.0597,-2.13312,1.98681>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.49988,-2.50244,1.20811>,<2.4999,-3,1.20804>,<1.71283,-3,1.99344>}
+	triangle{<2.49988,-2.50244,1.20811>,<1.71283,-3,1.99344>,<1.71285,-2.69137,1.99345>}
+	triangle{<2.49988,-2.50244,1.20811>,<1.71285,-2.69137,1.99345>,<2.11945,-2.12084,1.58776>}
+	texture{t1}
+}
+union{
+	cylinder{<2.49988,-2.50244,1.20811>,<2.4999,-3,1.20804>,r}
+	sphere{<2.4999,-3,1.20804>,r}
+	cylinder{<2.4999,-3,1.20804>,<1.71283,-3,1.99344>,r}
+	sphere{<1.71283,-3,1.99344>,r}
+	cylinder{<1.71283,-3,1.99344>,<1.71285,-2.69137,1.99345>,r}
+	sphere{<1.71285,-2.69137,1.99345>,r}
+	cylinder{<1.71285,-2.69137,1.99345>,<2.11945,-2.12084,1.58776>,r}
+	sphere{<2.11945,-2.12084,1.58776>,r}
+	cylinder{<2.11945,-2.12084,1.58776>,<2.49988,-2.50244,1.20811>,r}
+	sphere{<2.49988,-2.50244,1.20811>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.49988,-2.50244,1.20811>,<2.14585,-2.14711,0.854063>,<1.79138,-2.50322,0.499455>}
+	triangle{<2.49988,-2.50244,1.20811>,<1.79138,-2.50322,0.499455>,<1.79136,-3,0.499348>}
+	triangle{<2.49988,-2.50244,1.20811>,<1.79136,-3,0.499348>,<2.4999,-3,1.20804>}
+	texture{t1}
+}
+union{
+	cylinder{<2.49988,-2.50244,1.20811>,<2.14585,-2.14711,0.854063>,r}
+	sphere{<2.14585,-2.14711,0.854063>,r}
+	cylinder{<2.14585,-2.14711,0.854063>,<1.79138,-2.50322,0.499455>,r}
+	sphere{<1.79138,-2.50322,0.499455>,r}
+	cylinder{<1.79138,-2.50322,0.499455>,<1.79136,-3,0.499348>,r}
+	sphere{<1.79136,-3,0.499348>,r}
+	cylinder{<1.79136,-3,0.499348>,<2.4999,-3,1.20804>,r}
+	sphere{<2.4999,-3,1.20804>,r}
+	cylinder{<2.4999,-3,1.20804>,<2.49988,-2.50244,1.20811>,r}
+	sphere{<2.49988,-2.50244,1.20811>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.49988,-2.50244,1.20811>,<2.11945,-2.12084,1.58776>,<1.83427,-1.83462,1.32474>}
+	triangle{<2.49988,-2.50244,1.20811>,<1.83427,-1.83462,1.32474>,<1.82691,-1.82719,1.17289>}
+	triangle{<2.49988,-2.50244,1.20811>,<1.82691,-1.82719,1.17289>,<2.14585,-2.14711,0.854063>}
+	texture{t1}
+}
+union{
+	cylinder{<2.49988,-2.50244,1.20811>,<2.11945,-2.12084,1.58776>,r}
+	sphere{<2.11945,-2.12084,1.58776>,r}
+	cylinder{<2.11945,-2.12084,1.58776>,<1.83427,-1.83462,1.32474>,r}
+	sphere{<1.83427,-1.83462,1.32474>,r}
+	cylinder{<1.83427,-1.83462,1.32474>,<1.82691,-1.82719,1.17289>,r}
+	sphere{<1.82691,-1.82719,1.17289>,r}
+	cylinder{<1.82691,-1.82719,1.17289>,<2.14585,-2.14711,0.854063>,r}
+	sphere{<2.14585,-2.14711,0.854063>,r}
+	cylinder{<2.14585,-2.14711,0.854063>,<2.49988,-2.50244,1.20811>,r}
+	sphere{<2.49988,-2.50244,1.20811>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.14585,-2.14711,0.854063>,<1.82691,-1.82719,1.17289>,<1.42385,-1.85545,1.14489>}
+	triangle{<2.14585,-2.14711,0.854063>,<1.42385,-1.85545,1.14489>,<1.31456,-2.02406,0.976969>}
+	triangle{<2.14585,-2.14711,0.854063>,<1.31456,-2.02406,0.976969>,<1.79138,-2.50322,0.499455>}
+	texture{t1}
+}
+union{
+	cylinder{<2.14585,-2.14711,0.854063>,<1.82691,-1.82719,1.17289>,r}
+	sphere{<1.82691,-1.82719,1.17289>,r}
+	cylinder{<1.82691,-1.82719,1.17289>,<1.42385,-1.85545,1.14489>,r}
+	sphere{<1.42385,-1.85545,1.14489>,r}
+	cylinder{<1.42385,-1.85545,1.14489>,<1.31456,-2.02406,0.976969>,r}
+	sphere{<1.31456,-2.02406,0.976969>,r}
+	cylinder{<1.31456,-2.02406,0.976969>,<1.79138,-2.50322,0.499455>,r}
+	sphere{<1.79138,-2.50322,0.499455>,r}
+	cylinder{<1.79138,-2.50322,0.499455>,<2.14585,-2.14711,0.854063>,r}
+	sphere{<2.14585,-2.14711,0.854063>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.79138,-2.50322,0.499455>,<1.31456,-2.02406,0.976969>,<1.23193,-2.06382,1.05969>}
+	triangle{<1.79138,-2.50322,0.499455>,<1.23193,-2.06382,1.05969>,<1.22457,-3,1.06682>}
+	triangle{<1.79138,-2.50322,0.499455>,<1.22457,-3,1.06682>,<1.79136,-3,0.499348>}
+	texture{t1}
+}
+union{
+	cylinder{<1.79138,-2.50322,0.499455>,<1.31456,-2.02406,0.976969>,r}
+	sphere{<1.31456,-2.02406,0.976969>,r}
+	cylinder{<1.31456,-2.02406,0.976969>,<1.23193,-2.06382,1.05969>,r}
+	sphere{<1.23193,-2.06382,1.05969>,r}
+	cylinder{<1.23193,-2.06382,1.05969>,<1.22457,-3,1.06682>,r}
+	sphere{<1.22457,-3,1.06682>,r}
+	cylinder{<1.22457,-3,1.06682>,<1.79136,-3,0.499348>,r}
+	sphere{<1.79136,-3,0.499348>,r}
+	cylinder{<1.79136,-3,0.499348>,<1.79138,-2.50322,0.499455>,r}
+	sphere{<1.79138,-2.50322,0.499455>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.14585,-2.14711,0.854063>,<2.49697,-1.79456,0.502824>,<2.49702,-1.79465,0>}
+	triangle{<2.14585,-2.14711,0.854063>,<2.49702,-1.79465,0>,<1.79139,-2.50335,0>}
+	triangle{<2.14585,-2.14711,0.854063>,<1.79139,-2.50335,0>,<1.79138,-2.50322,0.499455>}
+	texture{t1}
+}
+union{
+	cylinder{<2.14585,-2.14711,0.854063>,<2.49697,-1.79456,0.502824>,r}
+	sphere{<2.49697,-1.79456,0.502824>,r}
+	cylinder{<2.49697,-1.79456,0.502824>,<2.49702,-1.79465,0>,r}
+	sphere{<2.49702,-1.79465,0>,r}
+	cylinder{<2.49702,-1.79465,0>,<1.79139,-2.50335,0>,r}
+	sphere{<1.79139,-2.50335,0>,r}
+	cylinder{<1.79139,-2.50335,0>,<1.79138,-2.50322,0.499455>,r}
+	sphere{<1.79138,-2.50322,0.499455>,r}
+	cylinder{<1.79138,-2.50322,0.499455>,<2.14585,-2.14711,0.854063>,r}
+	sphere{<2.14585,-2.14711,0.854063>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.82691,-1.82719,1.17289>,<1.42385,-1.85545,1.14489>,<1.4776,-1.23975,0.660474>}
+	triangle{<1.82691,-1.82719,1.17289>,<1.4776,-1.23975,0.660474>,<1.83606,-1.13072,0.618444>}
+	triangle{<1.82691,-1.82719,1.17289>,<1.83606,-1.13072,0.618444>,<2.11902,-1.41491,0.880633>}
+	texture{t1}
+}
+union{
+	cylinder{<1.82691,-1.82719,1.17289>,<1.42385,-1.85545,1.14489>,r}
+	sphere{<1.42385,-1.85545,1.14489>,r}
+	cylinder{<1.42385,-1.85545,1.14489>,<1.4776,-1.23975,0.660474>,r}
+	sphere{<1.4776,-1.23975,0.660474>,r}
+	cylinder{<1.4776,-1.23975,0.660474>,<1.83606,-1.13072,0.618444>,r}
+	sphere{<1.83606,-1.13072,0.618444>,r}
+	cylinder{<1.83606,-1.13072,0.618444>,<2.11902,-1.41491,0.880633>,r}
+	sphere{<2.11902,-1.41491,0.880633>,r}
+	cylinder{<2.11902,-1.41491,0.880633>,<1.82691,-1.82719,1.17289>,r}
+	sphere{<1.82691,-1.82719,1.17289>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.24627,-1.31005,0>,<1.4776,-1.23975,0.660474>,<1.42385,-1.85545,1.14489>}
+	triangle{<1.24627,-1.31005,0>,<1.42385,-1.85545,1.14489>,<1.31456,-2.02406,0.976969>}
+	triangle{<1.24627,-1.31005,0>,<1.31456,-2.02406,0.976969>,<1.0845,-1.79317,0>}
+	texture{t1}
+}
+union{
+	cylinder{<1.24627,-1.31005,0>,<1.4776,-1.23975,0.660474>,r}
+	sphere{<1.4776,-1.23975,0.660474>,r}
+	cylinder{<1.4776,-1.23975,0.660474>,<1.42385,-1.85545,1.14489>,r}
+	sphere{<1.42385,-1.85545,1.14489>,r}
+	cylinder{<1.42385,-1.85545,1.14489>,<1.31456,-2.02406,0.976969>,r}
+	sphere{<1.31456,-2.02406,0.976969>,r}
+	cylinder{<1.31456,-2.02406,0.976969>,<1.0845,-1.79317,0>,r}
+	sphere{<1.0845,-1.79317,0>,r}
+	cylinder{<1.0845,-1.79317,0>,<1.24627,-1.31005,0>,r}
+	sphere{<1.24627,-1.31005,0>,r}
+	texture{t2}
+}
+union{
+	triangle{<3,-1.79457,0.502855>,<3,-2.50301,1.2087>,<2.49988,-2.50244,1.20811>}
+	triangle{<3,-1.79457,0.502855>,<2.49988,-2.50244,1.20811>,<2.14585,-2.14711,0.854063>}
+	triangle{<3,-1.79457,0.502855>,<2.14585,-2.14711,0.854063>,<2.49697,-1.79456,0.502824>}
+	texture{t1}
+}
+union{
+	cylinder{<3,-1.79457,0.502855>,<3,-2.50301,1.2087>,r}
+	sphere{<3,-2.50301,1.2087>,r}
+	cylinder{<3,-2.50301,1.2087>,<2.49988,-2.50244,1.20811>,r}
+	sphere{<2.49988,-2.50244,1.20811>,r}
+	cylinder{<2.49988,-2.50244,1.20811>,<2.14585,-2.14711,0.854063>,r}
+	sphere{<2.14585,-2.14711,0.854063>,r}
+	cylinder{<2.14585,-2.14711,0.854063>,<2.49697,-1.79456,0.502824>,r}
+	sphere{<2.49697,-1.79456,0.502824>,r}
+	cylinder{<2.49697,-1.79456,0.502824>,<3,-1.79457,0.502855>,r}
+	sphere{<3,-1.79457,0.502855>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.49988,-2.50244,1.20811>,<2.11945,-2.12084,1.58776>,<2.3325,-1.8737,1.83471>}
+	triangle{<2.49988,-2.50244,1.20811>,<2.3325,-1.8737,1.83471>,<3,-1.87477,1.83521>}
+	triangle{<2.49988,-2.50244,1.20811>,<3,-1.87477,1.83521>,<3,-2.50301,1.2087>}
+	texture{t1}
+}
+union{
+	cylinder{<2.49988,-2.50244,1.20811>,<2.11945,-2.12084,1.58776>,r}
+	sphere{<2.11945,-2.12084,1.58776>,r}
+	cylinder{<2.11945,-2.12084,1.58776>,<2.3325,-1.8737,1.83471>,r}
+	sphere{<2.3325,-1.8737,1.83471>,r}
+	cylinder{<2.3325,-1.8737,1.83471>,<3,-1.87477,1.83521>,r}
+	sphere{<3,-1.87477,1.83521>,r}
+	cylinder{<3,-1.87477,1.83521>,<3,-2.50301,1.2087>,r}
+	sphere{<3,-2.50301,1.2087>,r}
+	cylinder{<3,-2.50301,1.2087>,<2.49988,-2.50244,1.20811>,r}
+	sphere{<2.49988,-2.50244,1.20811>,r}
+	texture{t2}
+}
+union{
+	triangle{<3,-1.87477,1.83521>,<2.3325,-1.8737,1.83471>,<2.09956,-1.52432,1.63253>}
+	triangle{<3,-1.87477,1.83521>,<2.09956,-1.52432,1.63253>,<2.3234,-1.21331,1.45247>}
+	triangle{<3,-1.87477,1.83521>,<2.3234,-1.21331,1.45247>,<3,-1.21342,1.45241>}
+	texture{t1}
+}
+union{
+	cylinder{<3,-1.87477,1.83521>,<2.3325,-1.8737,1.83471>,r}
+	sphere{<2.3325,-1.8737,1.83471>,r}
+	cylinder{<2.3325,-1.8737,1.83471>,<2.09956,-1.52432,1.63253>,r}
+	sphere{<2.09956,-1.52432,1.63253>,r}
+	cylinder{<2.09956,-1.52432,1.63253>,<2.3234,-1.21331,1.45247>,r}
+	sphere{<2.3234,-1.21331,1.45247>,r}
+	cylinder{<2.3234,-1.21331,1.45247>,<3,-1.21342,1.45241>,r}
+	sphere{<3,-1.21342,1.45241>,r}
+	cylinder{<3,-1.21342,1.45241>,<3,-1.87477,1.83521>,r}
+	sphere{<3,-1.87477,1.83521>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.21319,-0.995817,5.55112e-17>,<-2.21323,-0.995725,0.788784>,<-1.93882,-0.522359,1.05941>}
+	triangle{<-2.21319,-0.995817,5.55112e-17>,<-1.93882,-0.522359,1.05941>,<-1.92231,-0.493879,1.05036>}
+	triangle{<-2.21319,-0.995817,5.55112e-17>,<-1.92231,-0.493879,1.05036>,<-1.92228,-0.494031,5.55112e-17>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.21319,-0.995817,5.55112e-17>,<-2.21323,-0.995725,0.788784>,r}
+	sphere{<-2.21323,-0.995725,0.788784>,r}
+	cylinder{<-2.21323,-0.995725,0.788784>,<-1.93882,-0.522359,1.05941>,r}
+	sphere{<-1.93882,-0.522359,1.05941>,r}
+	cylinder{<-1.93882,-0.522359,1.05941>,<-1.92231,-0.493879,1.05036>,r}
+	sphere{<-1.92231,-0.493879,1.05036>,r}
+	cylinder{<-1.92231,-0.493879,1.05036>,<-1.92228,-0.494031,5.55112e-17>,r}
+	sphere{<-1.92228,-0.494031,5.55112e-17>,r}
+	cylinder{<-1.92228,-0.494031,5.55112e-17>,<-2.21319,-0.995817,5.55112e-17>,r}
+	sphere{<-2.21319,-0.995817,5.55112e-17>,r}
+	texture{t2}
+}
+union{
+	triangle{<-3,0.00784346,0.793193>,<-2.21343,0.00783496,0.784157>,<-1.93672,-0.469043,1.05835>}
+	triangle{<-3,0.00784346,0.793193>,<-1.93672,-0.469043,1.05835>,<-1.96598,-0.496097,1.07443>}
+	triangle{<-3,0.00784346,0.793193>,<-1.96598,-0.496097,1.07443>,<-3,-0.485925,1.08039>}
+	texture{t1}
+}
+union{
+	cylinder{<-3,0.00784346,0.793193>,<-2.21343,0.00783496,0.784157>,r}
+	sphere{<-2.21343,0.00783496,0.784157>,r}
+	cylinder{<-2.21343,0.00783496,0.784157>,<-1.93672,-0.469043,1.05835>,r}
+	sphere{<-1.93672,-0.469043,1.05835>,r}
+	cylinder{<-1.93672,-0.469043,1.05835>,<-1.96598,-0.496097,1.07443>,r}
+	sphere{<-1.96598,-0.496097,1.07443>,r}
+	cylinder{<-1.96598,-0.496097,1.07443>,<-3,-0.485925,1.08039>,r}
+	sphere{<-3,-0.485925,1.08039>,r}
+	cylinder{<-3,-0.485925,1.08039>,<-3,0.00784346,0.793193>,r}
+	sphere{<-3,0.00784346,0.793193>,r}
+	texture{t2}
+}
+union{
+	triangle{<-3,-0.995951,0.78877>,<-3,-0.485925,1.08039>,<-1.96598,-0.496097,1.07443>}
+	triangle{<-3,-0.995951,0.78877>,<-1.96598,-0.496097,1.07443>,<-1.93882,-0.522359,1.05941>}
+	triangle{<-3,-0.995951,0.78877>,<-1.93882,-0.522359,1.05941>,<-2.21323,-0.995725,0.788784>}
+	texture{t1}
+}
+union{
+	cylinder{<-3,-0.995951,0.78877>,<-3,-0.485925,1.08039>,r}
+	sphere{<-3,-0.485925,1.08039>,r}
+	cylinder{<-3,-0.485925,1.08039>,<-1.96598,-0.496097,1.07443>,r}
+	sphere{<-1.96598,-0.496097,1.07443>,r}
+	cylinder{<-1.96598,-0.496097,1.07443>,<-1.93882,-0.522359,1.05941>,r}
+	sphere{<-1.93882,-0.522359,1.05941>,r}
+	cylinder{<-1.93882,-0.522359,1.05941>,<-2.21323,-0.995725,0.788784>,r}
+	sphere{<-2.21323,-0.995725,0.788784>,r}
+	cylinder{<-2.21323,-0.995725,0.788784>,<-3,-0.995951,0.78877>,r}
+	sphere{<-3,-0.995951,0.78877>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.92213,-1.49703,0.870491>,<-2.01427,-1.33835,0.989153>,<-2.21323,-0.995725,0.788784>}
+	triangle{<-1.92213,-1.49703,0.870491>,<-2.21323,-0.995725,0.788784>,<-2.21319,-0.995817,0>}
+	triangle{<-1.92213,-1.49703,0.870491>,<-2.21319,-0.995817,0>,<-1.92234,-1.49668,0>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.92213,-1.49703,0.870491>,<-2.01427,-1.33835,0.989153>,r}
+	sphere{<-2.01427,-1.33835,0.989153>,r}
+	cylinder{<-2.01427,-1.33835,0.989153>,<-2.21323,-0.995725,0.788784>,r}
+	sphere{<-2.21323,-0.995725,0.788784>,r}
+	cylinder{<-2.21323,-0.995725,0.788784>,<-2.21319,-0.995817,0>,r}
+	sphere{<-2.21319,-0.995817,0>,r}
+	cylinder{<-2.21319,-0.995817,0>,<-1.92234,-1.49668,0>,r}
+	sphere{<-1.92234,-1.49668,0>,r}
+	cylinder{<-1.92234,-1.49668,0>,<-1.92213,-1.49703,0.870491>,r}
+	sphere{<-1.92213,-1.49703,0.870491>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.21323,-0.995725,0.788784>,<-1.93882,-0.522359,1.05941>,<-1.78425,-0.899733,1.21575>}
+	triangle{<-2.21323,-0.995725,0.788784>,<-1.78425,-0.899733,1.21575>,<-1.7829,-1.26406,1.21931>}
+	triangle{<-2.21323,-0.995725,0.788784>,<-1.7829,-1.26406,1.21931>,<-2.01427,-1.33835,0.989153>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.21323,-0.995725,0.788784>,<-1.93882,-0.522359,1.05941>,r}
+	sphere{<-1.93882,-0.522359,1.05941>,r}
+	cylinder{<-1.93882,-0.522359,1.05941>,<-1.78425,-0.899733,1.21575>,r}
+	sphere{<-1.78425,-0.899733,1.21575>,r}
+	cylinder{<-1.78425,-0.899733,1.21575>,<-1.7829,-1.26406,1.21931>,r}
+	sphere{<-1.7829,-1.26406,1.21931>,r}
+	cylinder{<-1.7829,-1.26406,1.21931>,<-2.01427,-1.33835,0.989153>,r}
+	sphere{<-2.01427,-1.33835,0.989153>,r}
+	cylinder{<-2.01427,-1.33835,0.989153>,<-2.21323,-0.995725,0.788784>,r}
+	sphere{<-2.21323,-0.995725,0.788784>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.05154,-1.00492,0.703022>,<-1.05173,-1.0052,0>,<-1.32054,-1.49376,0>}
+	triangle{<-1.05154,-1.00492,0.703022>,<-1.32054,-1.49376,0>,<-1.32069,-1.49412,0.886294>}
+	triangle{<-1.05154,-1.00492,0.703022>,<-1.32069,-1.49412,0.886294>,<-1.31545,-1.48461,0.8941>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.05154,-1.00492,0.703022>,<-1.05173,-1.0052,0>,r}
+	sphere{<-1.05173,-1.0052,0>,r}
+	cylinder{<-1.05173,-1.0052,0>,<-1.32054,-1.49376,0>,r}
+	sphere{<-1.32054,-1.49376,0>,r}
+	cylinder{<-1.32054,-1.49376,0>,<-1.32069,-1.49412,0.886294>,r}
+	sphere{<-1.32069,-1.49412,0.886294>,r}
+	cylinder{<-1.32069,-1.49412,0.886294>,<-1.31545,-1.48461,0.8941>,r}
+	sphere{<-1.31545,-1.48461,0.8941>,r}
+	cylinder{<-1.31545,-1.48461,0.8941>,<-1.05154,-1.00492,0.703022>,r}
+	sphere{<-1.05154,-1.00492,0.703022>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.05797,-1.1152,1.87674>,<-2.08412,-1.38468,1.71334>,<-3,-1.70042,1.52193>}
+	triangle{<-2.05797,-1.1152,1.87674>,<-3,-1.70042,1.52193>,<-3,-0.771611,2.08509>}
+	triangle{<-2.05797,-1.1152,1.87674>,<-3,-0.771611,2.08509>,<-2.42076,-0.77158,2.08509>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.05797,-1.1152,1.87674>,<-2.08412,-1.38468,1.71334>,r}
+	sphere{<-2.08412,-1.38468,1.71334>,r}
+	cylinder{<-2.08412,-1.38468,1.71334>,<-3,-1.70042,1.52193>,r}
+	sphere{<-3,-1.70042,1.52193>,r}
+	cylinder{<-3,-1.70042,1.52193>,<-3,-0.771611,2.08509>,r}
+	sphere{<-3,-0.771611,2.08509>,r}
+	cylinder{<-3,-0.771611,2.08509>,<-2.42076,-0.77158,2.08509>,r}
+	sphere{<-2.42076,-0.77158,2.08509>,r}
+	cylinder{<-2.42076,-0.77158,2.08509>,<-2.05797,-1.1152,1.87674>,r}
+	sphere{<-2.05797,-1.1152,1.87674>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.464765,-0.981901,0.92339>,<-0.462536,-0.985459,0.926481>,<-0.696386,-1.47899,1.13814>}
+	triangle{<-0.464765,-0.981901,0.92339>,<-0.696386,-1.47899,1.13814>,<-1.31545,-1.48461,0.8941>}
+	triangle{<-0.464765,-0.981901,0.92339>,<-1.31545,-1.48461,0.8941>,<-1.05154,-1.00492,0.703022>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.464765,-0.981901,0.92339>,<-0.462536,-0.985459,0.926481>,r}
+	sphere{<-0.462536,-0.985459,0.926481>,r}
+	cylinder{<-0.462536,-0.985459,0.926481>,<-0.696386,-1.47899,1.13814>,r}
+	sphere{<-0.696386,-1.47899,1.13814>,r}
+	cylinder{<-0.696386,-1.47899,1.13814>,<-1.31545,-1.48461,0.8941>,r}
+	sphere{<-1.31545,-1.48461,0.8941>,r}
+	cylinder{<-1.31545,-1.48461,0.8941>,<-1.05154,-1.00492,0.703022>,r}
+	sphere{<-1.05154,-1.00492,0.703022>,r}
+	cylinder{<-1.05154,-1.00492,0.703022>,<-0.464765,-0.981901,0.92339>,r}
+	sphere{<-0.464765,-0.981901,0.92339>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.05815,0.00666559,0.718807>,<-1.05823,0.00694024,0>,<-0.134839,0.00548164,0>}
+	triangle{<-1.05815,0.00666559,0.718807>,<-0.134839,0.00548164,0>,<-0.134915,0.00523367,0.649625>}
+	triangle{<-1.05815,0.00666559,0.718807>,<-0.134915,0.00523367,0.649625>,<-0.535166,0.00576369,0.91726>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.05815,0.00666559,0.718807>,<-1.05823,0.00694024,0>,r}
+	sphere{<-1.05823,0.00694024,0>,r}
+	cylinder{<-1.05823,0.00694024,0>,<-0.134839,0.00548164,0>,r}
+	sphere{<-0.134839,0.00548164,0>,r}
+	cylinder{<-0.134839,0.00548164,0>,<-0.134915,0.00523367,0.649625>,r}
+	sphere{<-0.134915,0.00523367,0.649625>,r}
+	cylinder{<-0.134915,0.00523367,0.649625>,<-0.535166,0.00576369,0.91726>,r}
+	sphere{<-0.535166,0.00576369,0.91726>,r}
+	cylinder{<-0.535166,0.00576369,0.91726>,<-1.05815,0.00666559,0.718807>,r}
+	sphere{<-1.05815,0.00666559,0.718807>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.33606,-0.472971,0.921412>,<-0.797485,-0.461559,1.11786>,<-0.464765,-0.981901,0.92339>}
+	triangle{<-1.33606,-0.472971,0.921412>,<-0.464765,-0.981901,0.92339>,<-1.05154,-1.00492,0.703022>}
+	triangle{<-1.33606,-0.472971,0.921412>,<-1.05154,-1.00492,0.703022>,<-1.34809,-0.493727,0.904746>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.33606,-0.472971,0.921412>,<-0.797485,-0.461559,1.11786>,r}
+	sphere{<-0.797485,-0.461559,1.11786>,r}
+	cylinder{<-0.797485,-0.461559,1.11786>,<-0.464765,-0.981901,0.92339>,r}
+	sphere{<-0.464765,-0.981901,0.92339>,r}
+	cylinder{<-0.464765,-0.981901,0.92339>,<-1.05154,-1.00492,0.703022>,r}
+	sphere{<-1.05154,-1.00492,0.703022>,r}
+	cylinder{<-1.05154,-1.00492,0.703022>,<-1.34809,-0.493727,0.904746>,r}
+	sphere{<-1.34809,-0.493727,0.904746>,r}
+	cylinder{<-1.34809,-0.493727,0.904746>,<-1.33606,-0.472971,0.921412>,r}
+	sphere{<-1.33606,-0.472971,0.921412>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.462536,-0.985459,0.926481>,<-0.464765,-0.981901,0.92339>,<-0.797485,-0.461559,1.11786>}
+	triangle{<-0.462536,-0.985459,0.926481>,<-0.797485,-0.461559,1.11786>,<-0.798807,-0.470622,1.78419>}
+	triangle{<-0.462536,-0.985459,0.926481>,<-0.798807,-0.470622,1.78419>,<-0.442448,-1.02623,1.4743>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.462536,-0.985459,0.926481>,<-0.464765,-0.981901,0.92339>,r}
+	sphere{<-0.464765,-0.981901,0.92339>,r}
+	cylinder{<-0.464765,-0.981901,0.92339>,<-0.797485,-0.461559,1.11786>,r}
+	sphere{<-0.797485,-0.461559,1.11786>,r}
+	cylinder{<-0.797485,-0.461559,1.11786>,<-0.798807,-0.470622,1.78419>,r}
+	sphere{<-0.798807,-0.470622,1.78419>,r}
+	cylinder{<-0.798807,-0.470622,1.78419>,<-0.442448,-1.02623,1.4743>,r}
+	sphere{<-0.442448,-1.02623,1.4743>,r}
+	cylinder{<-0.442448,-1.02623,1.4743>,<-0.462536,-0.985459,0.926481>,r}
+	sphere{<-0.462536,-0.985459,0.926481>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.278993,-0.33012,0.891036>,<0.315359,-0.174678,1.0231>,<-0.108834,0.0873227,0.726719>}
+	triangle{<0.278993,-0.33012,0.891036>,<-0.108834,0.0873227,0.726719>,<-0.134915,0.00523367,0.649625>}
+	triangle{<0.278993,-0.33012,0.891036>,<-0.134915,0.00523367,0.649625>,<-0.086097,-0.124601,0.623973>}
+	texture{t1}
+}
+union{
+	cylinder{<0.278993,-0.33012,0.891036>,<0.315359,-0.174678,1.0231>,r}
+	sphere{<0.315359,-0.174678,1.0231>,r}
+	cylinder{<0.315359,-0.174678,1.0231>,<-0.108834,0.0873227,0.726719>,r}
+	sphere{<-0.108834,0.0873227,0.726719>,r}
+	cylinder{<-0.108834,0.0873227,0.726719>,<-0.134915,0.00523367,0.649625>,r}
+	sphere{<-0.134915,0.00523367,0.649625>,r}
+	cylinder{<-0.134915,0.00523367,0.649625>,<-0.086097,-0.124601,0.623973>,r}
+	sphere{<-0.086097,-0.124601,0.623973>,r}
+	cylinder{<-0.086097,-0.124601,0.623973>,<0.278993,-0.33012,0.891036>,r}
+	sphere{<0.278993,-0.33012,0.891036>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.278993,-0.33012,0.891036>,<0.201854,-0.907642,1.14393>,<0.234711,-0.942488,1.64031>}
+	triangle{<0.278993,-0.33012,0.891036>,<0.234711,-0.942488,1.64031>,<0.3496,-0.209883,1.538>}
+	triangle{<0.278993,-0.33012,0.891036>,<0.3496,-0.209883,1.538>,<0.315359,-0.174678,1.0231>}
+	texture{t1}
+}
+union{
+	cylinder{<0.278993,-0.33012,0.891036>,<0.201854,-0.907642,1.14393>,r}
+	sphere{<0.201854,-0.907642,1.14393>,r}
+	cylinder{<0.201854,-0.907642,1.14393>,<0.234711,-0.942488,1.64031>,r}
+	sphere{<0.234711,-0.942488,1.64031>,r}
+	cylinder{<0.234711,-0.942488,1.64031>,<0.3496,-0.209883,1.538>,r}
+	sphere{<0.3496,-0.209883,1.538>,r}
+	cylinder{<0.3496,-0.209883,1.538>,<0.315359,-0.174678,1.0231>,r}
+	sphere{<0.315359,-0.174678,1.0231>,r}
+	cylinder{<0.315359,-0.174678,1.0231>,<0.278993,-0.33012,0.891036>,r}
+	sphere{<0.278993,-0.33012,0.891036>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.798807,-0.470622,1.78419>,<-0.761264,-0.404631,1.84403>,<-0.274058,-0.411224,1.97968>}
+	triangle{<-0.798807,-0.470622,1.78419>,<-0.274058,-0.411224,1.97968>,<0.154492,-0.958479,1.69682>}
+	triangle{<-0.798807,-0.470622,1.78419>,<0.154492,-0.958479,1.69682>,<-0.442448,-1.02623,1.4743>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.798807,-0.470622,1.78419>,<-0.761264,-0.404631,1.84403>,r}
+	sphere{<-0.761264,-0.404631,1.84403>,r}
+	cylinder{<-0.761264,-0.404631,1.84403>,<-0.274058,-0.411224,1.97968>,r}
+	sphere{<-0.274058,-0.411224,1.97968>,r}
+	cylinder{<-0.274058,-0.411224,1.97968>,<0.154492,-0.958479,1.69682>,r}
+	sphere{<0.154492,-0.958479,1.69682>,r}
+	cylinder{<0.154492,-0.958479,1.69682>,<-0.442448,-1.02623,1.4743>,r}
+	sphere{<-0.442448,-1.02623,1.4743>,r}
+	cylinder{<-0.442448,-1.02623,1.4743>,<-0.798807,-0.470622,1.78419>,r}
+	sphere{<-0.798807,-0.470622,1.78419>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.274058,-0.411224,1.97968>,<0.0708343,-0.0487173,1.72786>,<0.3496,-0.209883,1.538>}
+	triangle{<-0.274058,-0.411224,1.97968>,<0.3496,-0.209883,1.538>,<0.234711,-0.942488,1.64031>}
+	triangle{<-0.274058,-0.411224,1.97968>,<0.234711,-0.942488,1.64031>,<0.154492,-0.958479,1.69682>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.274058,-0.411224,1.97968>,<0.0708343,-0.0487173,1.72786>,r}
+	sphere{<0.0708343,-0.0487173,1.72786>,r}
+	cylinder{<0.0708343,-0.0487173,1.72786>,<0.3496,-0.209883,1.538>,r}
+	sphere{<0.3496,-0.209883,1.538>,r}
+	cylinder{<0.3496,-0.209883,1.538>,<0.234711,-0.942488,1.64031>,r}
+	sphere{<0.234711,-0.942488,1.64031>,r}
+	cylinder{<0.234711,-0.942488,1.64031>,<0.154492,-0.958479,1.69682>,r}
+	sphere{<0.154492,-0.958479,1.69682>,r}
+	cylinder{<0.154492,-0.958479,1.69682>,<-0.274058,-0.411224,1.97968>,r}
+	sphere{<-0.274058,-0.411224,1.97968>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.862929,-1.48721,1.77755>,<-1.58636,-1.49214,1.32023>,<-1.77833,-1.26666,1.35881>}
+	triangle{<-0.862929,-1.48721,1.77755>,<-1.77833,-1.26666,1.35881>,<-1.7757,-1.13578,1.45274>}
+	triangle{<-0.862929,-1.48721,1.77755>,<-1.7757,-1.13578,1.45274>,<-1.15429,-0.854543,2.04089>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.862929,-1.48721,1.77755>,<-1.58636,-1.49214,1.32023>,r}
+	sphere{<-1.58636,-1.49214,1.32023>,r}
+	cylinder{<-1.58636,-1.49214,1.32023>,<-1.77833,-1.26666,1.35881>,r}
+	sphere{<-1.77833,-1.26666,1.35881>,r}
+	cylinder{<-1.77833,-1.26666,1.35881>,<-1.7757,-1.13578,1.45274>,r}
+	sphere{<-1.7757,-1.13578,1.45274>,r}
+	cylinder{<-1.7757,-1.13578,1.45274>,<-1.15429,-0.854543,2.04089>,r}
+	sphere{<-1.15429,-0.854543,2.04089>,r}
+	cylinder{<-1.15429,-0.854543,2.04089>,<-0.862929,-1.48721,1.77755>,r}
+	sphere{<-0.862929,-1.48721,1.77755>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.619836,-1.55977,1.68014>,<-0.0766957,-1.64786,1.96193>,<0.0276185,-1.83382,1.92878>}
+	triangle{<-0.619836,-1.55977,1.68014>,<0.0276185,-1.83382,1.92878>,<-0.0348803,-1.94883,1.83174>}
+	triangle{<-0.619836,-1.55977,1.68014>,<-0.0348803,-1.94883,1.83174>,<-0.440292,-1.9237,1.60043>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.619836,-1.55977,1.68014>,<-0.0766957,-1.64786,1.96193>,r}
+	sphere{<-0.0766957,-1.64786,1.96193>,r}
+	cylinder{<-0.0766957,-1.64786,1.96193>,<0.0276185,-1.83382,1.92878>,r}
+	sphere{<0.0276185,-1.83382,1.92878>,r}
+	cylinder{<0.0276185,-1.83382,1.92878>,<-0.0348803,-1.94883,1.83174>,r}
+	sphere{<-0.0348803,-1.94883,1.83174>,r}
+	cylinder{<-0.0348803,-1.94883,1.83174>,<-0.440292,-1.9237,1.60043>,r}
+	sphere{<-0.440292,-1.9237,1.60043>,r}
+	cylinder{<-0.440292,-1.9237,1.60043>,<-0.619836,-1.55977,1.68014>,r}
+	sphere{<-0.619836,-1.55977,1.68014>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.816661,-0.843368,0.625721>,<0.863614,-1.07407,0>,<0.503361,-1.48922,5.55112e-17>}
+	triangle{<0.816661,-0.843368,0.625721>,<0.503361,-1.48922,5.55112e-17>,<0.239667,-1.48843,0.66933>}
+	triangle{<0.816661,-0.843368,0.625721>,<0.239667,-1.48843,0.66933>,<0.41917,-1.11445,1.03649>}
+	texture{t1}
+}
+union{
+	cylinder{<0.816661,-0.843368,0.625721>,<0.863614,-1.07407,0>,r}
+	sphere{<0.863614,-1.07407,0>,r}
+	cylinder{<0.863614,-1.07407,0>,<0.503361,-1.48922,5.55112e-17>,r}
+	sphere{<0.503361,-1.48922,5.55112e-17>,r}
+	cylinder{<0.503361,-1.48922,5.55112e-17>,<0.239667,-1.48843,0.66933>,r}
+	sphere{<0.239667,-1.48843,0.66933>,r}
+	cylinder{<0.239667,-1.48843,0.66933>,<0.41917,-1.11445,1.03649>,r}
+	sphere{<0.41917,-1.11445,1.03649>,r}
+	cylinder{<0.41917,-1.11445,1.03649>,<0.816661,-0.843368,0.625721>,r}
+	sphere{<0.816661,-0.843368,0.625721>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.816661,-0.843368,0.625721>,<0.41917,-1.11445,1.03649>,<0.201854,-0.907642,1.14393>}
+	triangle{<0.816661,-0.843368,0.625721>,<0.201854,-0.907642,1.14393>,<0.278993,-0.33012,0.891036>}
+	triangle{<0.816661,-0.843368,0.625721>,<0.278993,-0.33012,0.891036>,<0.768309,-0.605469,0.586321>}
+	texture{t1}
+}
+union{
+	cylinder{<0.816661,-0.843368,0.625721>,<0.41917,-1.11445,1.03649>,r}
+	sphere{<0.41917,-1.11445,1.03649>,r}
+	cylinder{<0.41917,-1.11445,1.03649>,<0.201854,-0.907642,1.14393>,r}
+	sphere{<0.201854,-0.907642,1.14393>,r}
+	cylinder{<0.201854,-0.907642,1.14393>,<0.278993,-0.33012,0.891036>,r}
+	sphere{<0.278993,-0.33012,0.891036>,r}
+	cylinder{<0.278993,-0.33012,0.891036>,<0.768309,-0.605469,0.586321>,r}
+	sphere{<0.768309,-0.605469,0.586321>,r}
+	cylinder{<0.768309,-0.605469,0.586321>,<0.816661,-0.843368,0.625721>,r}
+	sphere{<0.816661,-0.843368,0.625721>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.425521,-0.980721,0>,<-0.085936,-0.124597,-5.55112e-17>,<-0.086097,-0.124601,0.623973>}
+	triangle{<-0.425521,-0.980721,0>,<-0.086097,-0.124601,0.623973>,<-0.424514,-0.977605,0.896242>}
+	triangle{<-0.425521,-0.980721,0>,<-0.424514,-0.977605,0.896242>,<-0.425615,-0.980382,0.893585>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.425521,-0.980721,0>,<-0.085936,-0.124597,-5.55112e-17>,r}
+	sphere{<-0.085936,-0.124597,-5.55112e-17>,r}
+	cylinder{<-0.085936,-0.124597,-5.55112e-17>,<-0.086097,-0.124601,0.623973>,r}
+	sphere{<-0.086097,-0.124601,0.623973>,r}
+	cylinder{<-0.086097,-0.124601,0.623973>,<-0.424514,-0.977605,0.896242>,r}
+	sphere{<-0.424514,-0.977605,0.896242>,r}
+	cylinder{<-0.424514,-0.977605,0.896242>,<-0.425615,-0.980382,0.893585>,r}
+	sphere{<-0.425615,-0.980382,0.893585>,r}
+	cylinder{<-0.425615,-0.980382,0.893585>,<-0.425521,-0.980721,0>,r}
+	sphere{<-0.425521,-0.980721,0>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.768309,-0.605469,0.586321>,<0.278993,-0.33012,0.891036>,<-0.086097,-0.124601,0.623973>}
+	triangle{<0.768309,-0.605469,0.586321>,<-0.086097,-0.124601,0.623973>,<-0.085936,-0.124597,-5.55112e-17>}
+	triangle{<0.768309,-0.605469,0.586321>,<-0.085936,-0.124597,-5.55112e-17>,<0.768351,-0.605404,0>}
+	texture{t1}
+}
+union{
+	cylinder{<0.768309,-0.605469,0.586321>,<0.278993,-0.33012,0.891036>,r}
+	sphere{<0.278993,-0.33012,0.891036>,r}
+	cylinder{<0.278993,-0.33012,0.891036>,<-0.086097,-0.124601,0.623973>,r}
+	sphere{<-0.086097,-0.124601,0.623973>,r}
+	cylinder{<-0.086097,-0.124601,0.623973>,<-0.085936,-0.124597,-5.55112e-17>,r}
+	sphere{<-0.085936,-0.124597,-5.55112e-17>,r}
+	cylinder{<-0.085936,-0.124597,-5.55112e-17>,<0.768351,-0.605404,0>,r}
+	sphere{<0.768351,-0.605404,0>,r}
+	cylinder{<0.768351,-0.605404,0>,<0.768309,-0.605469,0.586321>,r}
+	sphere{<0.768309,-0.605469,0.586321>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.38686,-0.642267,1.12902>,<1.19349,-0.969576,0.955006>,<0.816661,-0.843368,0.625721>}
+	triangle{<1.38686,-0.642267,1.12902>,<0.816661,-0.843368,0.625721>,<0.768309,-0.605469,0.586321>}
+	triangle{<1.38686,-0.642267,1.12902>,<0.768309,-0.605469,0.586321>,<1.14003,-0.173996,0.918291>}
+	texture{t1}
+}
+union{
+	cylinder{<1.38686,-0.642267,1.12902>,<1.19349,-0.969576,0.955006>,r}
+	sphere{<1.19349,-0.969576,0.955006>,r}
+	cylinder{<1.19349,-0.969576,0.955006>,<0.816661,-0.843368,0.625721>,r}
+	sphere{<0.816661,-0.843368,0.625721>,r}
+	cylinder{<0.816661,-0.843368,0.625721>,<0.768309,-0.605469,0.586321>,r}
+	sphere{<0.768309,-0.605469,0.586321>,r}
+	cylinder{<0.768309,-0.605469,0.586321>,<1.14003,-0.173996,0.918291>,r}
+	sphere{<1.14003,-0.173996,0.918291>,r}
+	cylinder{<1.14003,-0.173996,0.918291>,<1.38686,-0.642267,1.12902>,r}
+	sphere{<1.38686,-0.642267,1.12902>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.768351,-0.605404,-5.55112e-17>,<1.23903,-0.0590588,-5.55112e-17>,<1.2392,-0.0588833,0.831019>}
+	triangle{<0.768351,-0.605404,-5.55112e-17>,<1.2392,-0.0588833,0.831019>,<1.14003,-0.173996,0.918291>}
+	triangle{<0.768351,-0.605404,-5.55112e-17>,<1.14003,-0.173996,0.918291>,<0.768309,-0.605469,0.586321>}
+	texture{t1}
+}
+union{
+	cylinder{<0.768351,-0.605404,-5.55112e-17>,<1.23903,-0.0590588,-5.55112e-17>,r}
+	sphere{<1.23903,-0.0590588,-5.55112e-17>,r}
+	cylinder{<1.23903,-0.0590588,-5.55112e-17>,<1.2392,-0.0588833,0.831019>,r}
+	sphere{<1.2392,-0.0588833,0.831019>,r}
+	cylinder{<1.2392,-0.0588833,0.831019>,<1.14003,-0.173996,0.918291>,r}
+	sphere{<1.14003,-0.173996,0.918291>,r}
+	cylinder{<1.14003,-0.173996,0.918291>,<0.768309,-0.605469,0.586321>,r}
+	sphere{<0.768309,-0.605469,0.586321>,r}
+	cylinder{<0.768309,-0.605469,0.586321>,<0.768351,-0.605404,-5.55112e-17>,r}
+	sphere{<0.768351,-0.605404,-5.55112e-17>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.00896,-0.438506,0.87545>,<1.88557,-0.181912,0.757347>,<1.88558,-0.182103,0>}
+	triangle{<2.00896,-0.438506,0.87545>,<1.88558,-0.182103,0>,<2.08128,-0.589107,0>}
+	triangle{<2.00896,-0.438506,0.87545>,<2.08128,-0.589107,0>,<2.08138,-0.589139,0.788478>}
+	texture{t1}
+}
+union{
+	cylinder{<2.00896,-0.438506,0.87545>,<1.88557,-0.181912,0.757347>,r}
+	sphere{<1.88557,-0.181912,0.757347>,r}
+	cylinder{<1.88557,-0.181912,0.757347>,<1.88558,-0.182103,0>,r}
+	sphere{<1.88558,-0.182103,0>,r}
+	cylinder{<1.88558,-0.182103,0>,<2.08128,-0.589107,0>,r}
+	sphere{<2.08128,-0.589107,0>,r}
+	cylinder{<2.08128,-0.589107,0>,<2.08138,-0.589139,0.788478>,r}
+	sphere{<2.08138,-0.589139,0.788478>,r}
+	cylinder{<2.08138,-0.589139,0.788478>,<2.00896,-0.438506,0.87545>,r}
+	sphere{<2.00896,-0.438506,0.87545>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.816661,-0.843368,0.625721>,<1.19349,-0.969576,0.955006>,<1.4776,-1.23975,0.660474>}
+	triangle{<0.816661,-0.843368,0.625721>,<1.4776,-1.23975,0.660474>,<1.24627,-1.31005,-5.55112e-17>}
+	triangle{<0.816661,-0.843368,0.625721>,<1.24627,-1.31005,-5.55112e-17>,<0.863614,-1.07407,-5.55112e-17>}
+	texture{t1}
+}
+union{
+	cylinder{<0.816661,-0.843368,0.625721>,<1.19349,-0.969576,0.955006>,r}
+	sphere{<1.19349,-0.969576,0.955006>,r}
+	cylinder{<1.19349,-0.969576,0.955006>,<1.4776,-1.23975,0.660474>,r}
+	sphere{<1.4776,-1.23975,0.660474>,r}
+	cylinder{<1.4776,-1.23975,0.660474>,<1.24627,-1.31005,-5.55112e-17>,r}
+	sphere{<1.24627,-1.31005,-5.55112e-17>,r}
+	cylinder{<1.24627,-1.31005,-5.55112e-17>,<0.863614,-1.07407,-5.55112e-17>,r}
+	sphere{<0.863614,-1.07407,-5.55112e-17>,r}
+	cylinder{<0.863614,-1.07407,-5.55112e-17>,<0.816661,-0.843368,0.625721>,r}
+	sphere{<0.816661,-0.843368,0.625721>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.816661,-0.843368,0.625721>,<0.41917,-1.11445,1.03649>,<0.530483,-1.22237,1.26624>}
+	triangle{<0.816661,-0.843368,0.625721>,<0.530483,-1.22237,1.26624>,<1.05379,-1.18421,1.32323>}
+	triangle{<0.816661,-0.843368,0.625721>,<1.05379,-1.18421,1.32323>,<1.19349,-0.969576,0.955006>}
+	texture{t1}
+}
+union{
+	cylinder{<0.816661,-0.843368,0.625721>,<0.41917,-1.11445,1.03649>,r}
+	sphere{<0.41917,-1.11445,1.03649>,r}
+	cylinder{<0.41917,-1.11445,1.03649>,<0.530483,-1.22237,1.26624>,r}
+	sphere{<0.530483,-1.22237,1.26624>,r}
+	cylinder{<0.530483,-1.22237,1.26624>,<1.05379,-1.18421,1.32323>,r}
+	sphere{<1.05379,-1.18421,1.32323>,r}
+	cylinder{<1.05379,-1.18421,1.32323>,<1.19349,-0.969576,0.955006>,r}
+	sphere{<1.19349,-0.969576,0.955006>,r}
+	cylinder{<1.19349,-0.969576,0.955006>,<0.816661,-0.843368,0.625721>,r}
+	sphere{<0.816661,-0.843368,0.625721>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.201854,-0.907642,1.14393>,<0.234711,-0.942488,1.64031>,<0.287898,-0.993533,1.67549>}
+	triangle{<0.201854,-0.907642,1.14393>,<0.287898,-0.993533,1.67549>,<0.530483,-1.22237,1.26624>}
+	triangle{<0.201854,-0.907642,1.14393>,<0.530483,-1.22237,1.26624>,<0.41917,-1.11445,1.03649>}
+	texture{t1}
+}
+union{
+	cylinder{<0.201854,-0.907642,1.14393>,<0.234711,-0.942488,1.64031>,r}
+	sphere{<0.234711,-0.942488,1.64031>,r}
+	cylinder{<0.234711,-0.942488,1.64031>,<0.287898,-0.993533,1.67549>,r}
+	sphere{<0.287898,-0.993533,1.67549>,r}
+	cylinder{<0.287898,-0.993533,1.67549>,<0.530483,-1.22237,1.26624>,r}
+	sphere{<0.530483,-1.22237,1.26624>,r}
+	cylinder{<0.530483,-1.22237,1.26624>,<0.41917,-1.11445,1.03649>,r}
+	sphere{<0.41917,-1.11445,1.03649>,r}
+	cylinder{<0.41917,-1.11445,1.03649>,<0.201854,-0.907642,1.14393>,r}
+	sphere{<0.201854,-0.907642,1.14393>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.287898,-0.993533,1.67549>,<0.712651,-0.890841,1.84848>,<1.12823,-1.05081,1.55748>}
+	triangle{<0.287898,-0.993533,1.67549>,<1.12823,-1.05081,1.55748>,<1.05379,-1.18421,1.32323>}
+	triangle{<0.287898,-0.993533,1.67549>,<1.05379,-1.18421,1.32323>,<0.530483,-1.22237,1.26624>}
+	texture{t1}
+}
+union{
+	cylinder{<0.287898,-0.993533,1.67549>,<0.712651,-0.890841,1.84848>,r}
+	sphere{<0.712651,-0.890841,1.84848>,r}
+	cylinder{<0.712651,-0.890841,1.84848>,<1.12823,-1.05081,1.55748>,r}
+	sphere{<1.12823,-1.05081,1.55748>,r}
+	cylinder{<1.12823,-1.05081,1.55748>,<1.05379,-1.18421,1.32323>,r}
+	sphere{<1.05379,-1.18421,1.32323>,r}
+	cylinder{<1.05379,-1.18421,1.32323>,<0.530483,-1.22237,1.26624>,r}
+	sphere{<0.530483,-1.22237,1.26624>,r}
+	cylinder{<0.530483,-1.22237,1.26624>,<0.287898,-0.993533,1.67549>,r}
+	sphere{<0.287898,-0.993533,1.67549>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.942535,0.0980355,1.18279>,<0.315359,-0.174678,1.0231>,<0.278993,-0.33012,0.891036>}
+	triangle{<0.942535,0.0980355,1.18279>,<0.278993,-0.33012,0.891036>,<0.768309,-0.605469,0.586321>}
+	triangle{<0.942535,0.0980355,1.18279>,<0.768309,-0.605469,0.586321>,<1.14003,-0.173996,0.918291>}
+	texture{t1}
+}
+union{
+	cylinder{<0.942535,0.0980355,1.18279>,<0.315359,-0.174678,1.0231>,r}
+	sphere{<0.315359,-0.174678,1.0231>,r}
+	cylinder{<0.315359,-0.174678,1.0231>,<0.278993,-0.33012,0.891036>,r}
+	sphere{<0.278993,-0.33012,0.891036>,r}
+	cylinder{<0.278993,-0.33012,0.891036>,<0.768309,-0.605469,0.586321>,r}
+	sphere{<0.768309,-0.605469,0.586321>,r}
+	cylinder{<0.768309,-0.605469,0.586321>,<1.14003,-0.173996,0.918291>,r}
+	sphere{<1.14003,-0.173996,0.918291>,r}
+	cylinder{<1.14003,-0.173996,0.918291>,<0.942535,0.0980355,1.18279>,r}
+	sphere{<0.942535,0.0980355,1.18279>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.23193,-2.06382,1.05969>,<0.694345,-2.12619,0.904081>,<0.461096,-1.95676,1.12791>}
+	triangle{<1.23193,-2.06382,1.05969>,<0.461096,-1.95676,1.12791>,<0.510208,-1.89274,1.22859>}
+	triangle{<1.23193,-2.06382,1.05969>,<0.510208,-1.89274,1.22859>,<1.29763,-1.89957,1.31094>}
+	texture{t1}
+}
+union{
+	cylinder{<1.23193,-2.06382,1.05969>,<0.694345,-2.12619,0.904081>,r}
+	sphere{<0.694345,-2.12619,0.904081>,r}
+	cylinder{<0.694345,-2.12619,0.904081>,<0.461096,-1.95676,1.12791>,r}
+	sphere{<0.461096,-1.95676,1.12791>,r}
+	cylinder{<0.461096,-1.95676,1.12791>,<0.510208,-1.89274,1.22859>,r}
+	sphere{<0.510208,-1.89274,1.22859>,r}
+	cylinder{<0.510208,-1.89274,1.22859>,<1.29763,-1.89957,1.31094>,r}
+	sphere{<1.29763,-1.89957,1.31094>,r}
+	cylinder{<1.29763,-1.89957,1.31094>,<1.23193,-2.06382,1.05969>,r}
+	sphere{<1.23193,-2.06382,1.05969>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.510208,-1.89274,1.22859>,<0.461096,-1.95676,1.12791>,<0.239667,-1.48843,0.66933>}
+	triangle{<0.510208,-1.89274,1.22859>,<0.239667,-1.48843,0.66933>,<0.41917,-1.11445,1.03649>}
+	triangle{<0.510208,-1.89274,1.22859>,<0.41917,-1.11445,1.03649>,<0.530483,-1.22237,1.26624>}
+	texture{t1}
+}
+union{
+	cylinder{<0.510208,-1.89274,1.22859>,<0.461096,-1.95676,1.12791>,r}
+	sphere{<0.461096,-1.95676,1.12791>,r}
+	cylinder{<0.461096,-1.95676,1.12791>,<0.239667,-1.48843,0.66933>,r}
+	sphere{<0.239667,-1.48843,0.66933>,r}
+	cylinder{<0.239667,-1.48843,0.66933>,<0.41917,-1.11445,1.03649>,r}
+	sphere{<0.41917,-1.11445,1.03649>,r}
+	cylinder{<0.41917,-1.11445,1.03649>,<0.530483,-1.22237,1.26624>,r}
+	sphere{<0.530483,-1.22237,1.26624>,r}
+	cylinder{<0.530483,-1.22237,1.26624>,<0.510208,-1.89274,1.22859>,r}
+	sphere{<0.510208,-1.89274,1.22859>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.08138,-0.589139,0.788478>,<3,-0.589214,0.788352>,<3,-0.0892172,1.07702>}
+	triangle{<2.08138,-0.589139,0.788478>,<3,-0.0892172,1.07702>,<2.20156,-0.0892997,1.07704>}
+	triangle{<2.08138,-0.589139,0.788478>,<2.20156,-0.0892997,1.07704>,<2.00896,-0.438506,0.87545>}
+	texture{t1}
+}
+union{
+	cylinder{<2.08138,-0.589139,0.788478>,<3,-0.589214,0.788352>,r}
+	sphere{<3,-0.589214,0.788352>,r}
+	cylinder{<3,-0.589214,0.788352>,<3,-0.0892172,1.07702>,r}
+	sphere{<3,-0.0892172,1.07702>,r}
+	cylinder{<3,-0.0892172,1.07702>,<2.20156,-0.0892997,1.07704>,r}
+	sphere{<2.20156,-0.0892997,1.07704>,r}
+	cylinder{<2.20156,-0.0892997,1.07704>,<2.00896,-0.438506,0.87545>,r}
+	sphere{<2.00896,-0.438506,0.87545>,r}
+	cylinder{<2.00896,-0.438506,0.87545>,<2.08138,-0.589139,0.788478>,r}
+	sphere{<2.08138,-0.589139,0.788478>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.08138,-0.589139,0.788478>,<2.02525,-0.713092,0.860041>,<2.32812,-1.17042,1.12398>}
+	triangle{<2.08138,-0.589139,0.788478>,<2.32812,-1.17042,1.12398>,<3,-1.17053,1.12392>}
+	triangle{<2.08138,-0.589139,0.788478>,<3,-1.17053,1.12392>,<3,-0.589214,0.788352>}
+	texture{t1}
+}
+union{
+	cylinder{<2.08138,-0.589139,0.788478>,<2.02525,-0.713092,0.860041>,r}
+	sphere{<2.02525,-0.713092,0.860041>,r}
+	cylinder{<2.02525,-0.713092,0.860041>,<2.32812,-1.17042,1.12398>,r}
+	sphere{<2.32812,-1.17042,1.12398>,r}
+	cylinder{<2.32812,-1.17042,1.12398>,<3,-1.17053,1.12392>,r}
+	sphere{<3,-1.17053,1.12392>,r}
+	cylinder{<3,-1.17053,1.12392>,<3,-0.589214,0.788352>,r}
+	sphere{<3,-0.589214,0.788352>,r}
+	cylinder{<3,-0.589214,0.788352>,<2.08138,-0.589139,0.788478>,r}
+	sphere{<2.08138,-0.589139,0.788478>,r}
+	texture{t2}
+}
+union{
+	triangle{<3,-1.21342,1.45241>,<2.3234,-1.21331,1.45247>,<1.99284,-0.816349,1.84367>}
+	triangle{<3,-1.21342,1.45241>,<1.99284,-0.816349,1.84367>,<2.06079,-0.673376,1.98459>}
+	triangle{<3,-1.21342,1.45241>,<2.06079,-0.673376,1.98459>,<3,-0.673316,1.98472>}
+	texture{t1}
+}
+union{
+	cylinder{<3,-1.21342,1.45241>,<2.3234,-1.21331,1.45247>,r}
+	sphere{<2.3234,-1.21331,1.45247>,r}
+	cylinder{<2.3234,-1.21331,1.45247>,<1.99284,-0.816349,1.84367>,r}
+	sphere{<1.99284,-0.816349,1.84367>,r}
+	cylinder{<1.99284,-0.816349,1.84367>,<2.06079,-0.673376,1.98459>,r}
+	sphere{<2.06079,-0.673376,1.98459>,r}
+	cylinder{<2.06079,-0.673376,1.98459>,<3,-0.673316,1.98472>,r}
+	sphere{<3,-0.673316,1.98472>,r}
+	cylinder{<3,-0.673316,1.98472>,<3,-1.21342,1.45241>,r}
+	sphere{<3,-1.21342,1.45241>,r}
+	texture{t2}
+}
+union{
+	triangle{<3,-0.673316,1.98472>,<2.06079,-0.673376,1.98459>,<1.98235,-0.501619,1.88902>}
+	triangle{<3,-0.673316,1.98472>,<1.98235,-0.501619,1.88902>,<2.20607,-0.0893575,1.6597>}
+	triangle{<3,-0.673316,1.98472>,<2.20607,-0.0893575,1.6597>,<3,-0.0892755,1.65979>}
+	texture{t1}
+}
+union{
+	cylinder{<3,-0.673316,1.98472>,<2.06079,-0.673376,1.98459>,r}
+	sphere{<2.06079,-0.673376,1.98459>,r}
+	cylinder{<2.06079,-0.673376,1.98459>,<1.98235,-0.501619,1.88902>,r}
+	sphere{<1.98235,-0.501619,1.88902>,r}
+	cylinder{<1.98235,-0.501619,1.88902>,<2.20607,-0.0893575,1.6597>,r}
+	sphere{<2.20607,-0.0893575,1.6597>,r}
+	cylinder{<2.20607,-0.0893575,1.6597>,<3,-0.0892755,1.65979>,r}
+	sphere{<3,-0.0892755,1.65979>,r}
+	cylinder{<3,-0.0892755,1.65979>,<3,-0.673316,1.98472>,r}
+	sphere{<3,-0.673316,1.98472>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.32812,-1.17042,1.12398>,<3,-1.17053,1.12392>,<3,-1.79457,0.502855>}
+	triangle{<2.32812,-1.17042,1.12398>,<3,-1.79457,0.502855>,<2.49697,-1.79456,0.502824>}
+	triangle{<2.32812,-1.17042,1.12398>,<2.49697,-1.79456,0.502824>,<2.11902,-1.41491,0.880633>}
+	texture{t1}
+}
+union{
+	cylinder{<2.32812,-1.17042,1.12398>,<3,-1.17053,1.12392>,r}
+	sphere{<3,-1.17053,1.12392>,r}
+	cylinder{<3,-1.17053,1.12392>,<3,-1.79457,0.502855>,r}
+	sphere{<3,-1.79457,0.502855>,r}
+	cylinder{<3,-1.79457,0.502855>,<2.49697,-1.79456,0.502824>,r}
+	sphere{<2.49697,-1.79456,0.502824>,r}
+	cylinder{<2.49697,-1.79456,0.502824>,<2.11902,-1.41491,0.880633>,r}
+	sphere{<2.11902,-1.41491,0.880633>,r}
+	cylinder{<2.11902,-1.41491,0.880633>,<2.32812,-1.17042,1.12398>,r}
+	sphere{<2.32812,-1.17042,1.12398>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.08138,-0.589139,0.788478>,<2.02525,-0.713092,0.860041>,<1.83606,-1.13072,0.618444>}
+	triangle{<2.08138,-0.589139,0.788478>,<1.83606,-1.13072,0.618444>,<1.83598,-1.13068,5.55112e-17>}
+	triangle{<2.08138,-0.589139,0.788478>,<1.83598,-1.13068,5.55112e-17>,<2.08128,-0.589107,5.55112e-17>}
+	texture{t1}
+}
+union{
+	cylinder{<2.08138,-0.589139,0.788478>,<2.02525,-0.713092,0.860041>,r}
+	sphere{<2.02525,-0.713092,0.860041>,r}
+	cylinder{<2.02525,-0.713092,0.860041>,<1.83606,-1.13072,0.618444>,r}
+	sphere{<1.83606,-1.13072,0.618444>,r}
+	cylinder{<1.83606,-1.13072,0.618444>,<1.83598,-1.13068,5.55112e-17>,r}
+	sphere{<1.83598,-1.13068,5.55112e-17>,r}
+	cylinder{<1.83598,-1.13068,5.55112e-17>,<2.08128,-0.589107,5.55112e-17>,r}
+	sphere{<2.08128,-0.589107,5.55112e-17>,r}
+	cylinder{<2.08128,-0.589107,5.55112e-17>,<2.08138,-0.589139,0.788478>,r}
+	sphere{<2.08138,-0.589139,0.788478>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.11902,-1.41491,0.880633>,<2.49697,-1.79456,0.502824>,<2.49702,-1.79465,5.55112e-17>}
+	triangle{<2.11902,-1.41491,0.880633>,<2.49702,-1.79465,5.55112e-17>,<1.83598,-1.13068,5.55112e-17>}
+	triangle{<2.11902,-1.41491,0.880633>,<1.83598,-1.13068,5.55112e-17>,<1.83606,-1.13072,0.618444>}
+	texture{t1}
+}
+union{
+	cylinder{<2.11902,-1.41491,0.880633>,<2.49697,-1.79456,0.502824>,r}
+	sphere{<2.49697,-1.79456,0.502824>,r}
+	cylinder{<2.49697,-1.79456,0.502824>,<2.49702,-1.79465,5.55112e-17>,r}
+	sphere{<2.49702,-1.79465,5.55112e-17>,r}
+	cylinder{<2.49702,-1.79465,5.55112e-17>,<1.83598,-1.13068,5.55112e-17>,r}
+	sphere{<1.83598,-1.13068,5.55112e-17>,r}
+	cylinder{<1.83598,-1.13068,5.55112e-17>,<1.83606,-1.13072,0.618444>,r}
+	sphere{<1.83606,-1.13072,0.618444>,r}
+	cylinder{<1.83606,-1.13072,0.618444>,<2.11902,-1.41491,0.880633>,r}
+	sphere{<2.11902,-1.41491,0.880633>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.05379,-1.18421,1.32323>,<1.19349,-0.969576,0.955006>,<1.38686,-0.642267,1.12902>}
+	triangle{<1.05379,-1.18421,1.32323>,<1.38686,-0.642267,1.12902>,<1.35885,-0.673828,1.46251>}
+	triangle{<1.05379,-1.18421,1.32323>,<1.35885,-0.673828,1.46251>,<1.12823,-1.05081,1.55748>}
+	texture{t1}
+}
+union{
+	cylinder{<1.05379,-1.18421,1.32323>,<1.19349,-0.969576,0.955006>,r}
+	sphere{<1.19349,-0.969576,0.955006>,r}
+	cylinder{<1.19349,-0.969576,0.955006>,<1.38686,-0.642267,1.12902>,r}
+	sphere{<1.38686,-0.642267,1.12902>,r}
+	cylinder{<1.38686,-0.642267,1.12902>,<1.35885,-0.673828,1.46251>,r}
+	sphere{<1.35885,-0.673828,1.46251>,r}
+	cylinder{<1.35885,-0.673828,1.46251>,<1.12823,-1.05081,1.55748>,r}
+	sphere{<1.12823,-1.05081,1.55748>,r}
+	cylinder{<1.12823,-1.05081,1.55748>,<1.05379,-1.18421,1.32323>,r}
+	sphere{<1.05379,-1.18421,1.32323>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.34603,0.507398,0>,<-1.92288,0.508507,0>,<-1.92283,0.508558,1.03466>}
+	triangle{<-1.34603,0.507398,0>,<-1.92283,0.508558,1.03466>,<-1.48606,0.507716,0.979685>}
+	triangle{<-1.34603,0.507398,0>,<-1.48606,0.507716,0.979685>,<-1.34615,0.507442,0.887647>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.34603,0.507398,0>,<-1.92288,0.508507,0>,r}
+	sphere{<-1.92288,0.508507,0>,r}
+	cylinder{<-1.92288,0.508507,0>,<-1.92283,0.508558,1.03466>,r}
+	sphere{<-1.92283,0.508558,1.03466>,r}
+	cylinder{<-1.92283,0.508558,1.03466>,<-1.48606,0.507716,0.979685>,r}
+	sphere{<-1.48606,0.507716,0.979685>,r}
+	cylinder{<-1.48606,0.507716,0.979685>,<-1.34615,0.507442,0.887647>,r}
+	sphere{<-1.34615,0.507442,0.887647>,r}
+	cylinder{<-1.34615,0.507442,0.887647>,<-1.34603,0.507398,0>,r}
+	sphere{<-1.34603,0.507398,0>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.96123,0.575321,1.04022>,<-1.92283,0.508558,1.03466>,<-1.92288,0.508507,0>}
+	triangle{<-1.96123,0.575321,1.04022>,<-1.92288,0.508507,0>,<-2.21312,1.0131,0>}
+	triangle{<-1.96123,0.575321,1.04022>,<-2.21312,1.0131,0>,<-2.21305,1.01307,0.785067>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.96123,0.575321,1.04022>,<-1.92283,0.508558,1.03466>,r}
+	sphere{<-1.92283,0.508558,1.03466>,r}
+	cylinder{<-1.92283,0.508558,1.03466>,<-1.92288,0.508507,0>,r}
+	sphere{<-1.92288,0.508507,0>,r}
+	cylinder{<-1.92288,0.508507,0>,<-2.21312,1.0131,0>,r}
+	sphere{<-2.21312,1.0131,0>,r}
+	cylinder{<-2.21312,1.0131,0>,<-2.21305,1.01307,0.785067>,r}
+	sphere{<-2.21305,1.01307,0.785067>,r}
+	cylinder{<-2.21305,1.01307,0.785067>,<-1.96123,0.575321,1.04022>,r}
+	sphere{<-1.96123,0.575321,1.04022>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.05815,0.00666559,0.718807>,<-1.05823,0.00694024,-5.55112e-17>,<-1.34847,-0.493858,0>}
+	triangle{<-1.05815,0.00666559,0.718807>,<-1.34847,-0.493858,0>,<-1.34809,-0.493727,0.904746>}
+	triangle{<-1.05815,0.00666559,0.718807>,<-1.34809,-0.493727,0.904746>,<-1.33606,-0.472971,0.921412>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.05815,0.00666559,0.718807>,<-1.05823,0.00694024,-5.55112e-17>,r}
+	sphere{<-1.05823,0.00694024,-5.55112e-17>,r}
+	cylinder{<-1.05823,0.00694024,-5.55112e-17>,<-1.34847,-0.493858,0>,r}
+	sphere{<-1.34847,-0.493858,0>,r}
+	cylinder{<-1.34847,-0.493858,0>,<-1.34809,-0.493727,0.904746>,r}
+	sphere{<-1.34809,-0.493727,0.904746>,r}
+	cylinder{<-1.34809,-0.493727,0.904746>,<-1.33606,-0.472971,0.921412>,r}
+	sphere{<-1.33606,-0.472971,0.921412>,r}
+	cylinder{<-1.33606,-0.472971,0.921412>,<-1.05815,0.00666559,0.718807>,r}
+	sphere{<-1.05815,0.00666559,0.718807>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.21343,0.00783496,0.784157>,<-1.93672,-0.469043,1.05835>,<-1.92231,-0.493879,1.05036>}
+	triangle{<-2.21343,0.00783496,0.784157>,<-1.92231,-0.493879,1.05036>,<-1.92228,-0.494031,5.55112e-17>}
+	triangle{<-2.21343,0.00783496,0.784157>,<-1.92228,-0.494031,5.55112e-17>,<-2.21346,0.00781314,0>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.21343,0.00783496,0.784157>,<-1.93672,-0.469043,1.05835>,r}
+	sphere{<-1.93672,-0.469043,1.05835>,r}
+	cylinder{<-1.93672,-0.469043,1.05835>,<-1.92231,-0.493879,1.05036>,r}
+	sphere{<-1.92231,-0.493879,1.05036>,r}
+	cylinder{<-1.92231,-0.493879,1.05036>,<-1.92228,-0.494031,5.55112e-17>,r}
+	sphere{<-1.92228,-0.494031,5.55112e-17>,r}
+	cylinder{<-1.92228,-0.494031,5.55112e-17>,<-2.21346,0.00781314,0>,r}
+	sphere{<-2.21346,0.00781314,0>,r}
+	cylinder{<-2.21346,0.00781314,0>,<-2.21343,0.00783496,0.784157>,r}
+	sphere{<-2.21343,0.00783496,0.784157>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.21343,0.00783496,0.784157>,<-1.93529,0.487085,1.05768>,<-1.7989,0.334352,1.19265>}
+	triangle{<-2.21343,0.00783496,0.784157>,<-1.7989,0.334352,1.19265>,<-1.78809,-0.121555,1.20432>}
+	triangle{<-2.21343,0.00783496,0.784157>,<-1.78809,-0.121555,1.20432>,<-1.93672,-0.469043,1.05835>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.21343,0.00783496,0.784157>,<-1.93529,0.487085,1.05768>,r}
+	sphere{<-1.93529,0.487085,1.05768>,r}
+	cylinder{<-1.93529,0.487085,1.05768>,<-1.7989,0.334352,1.19265>,r}
+	sphere{<-1.7989,0.334352,1.19265>,r}
+	cylinder{<-1.7989,0.334352,1.19265>,<-1.78809,-0.121555,1.20432>,r}
+	sphere{<-1.78809,-0.121555,1.20432>,r}
+	cylinder{<-1.78809,-0.121555,1.20432>,<-1.93672,-0.469043,1.05835>,r}
+	sphere{<-1.93672,-0.469043,1.05835>,r}
+	cylinder{<-1.93672,-0.469043,1.05835>,<-2.21343,0.00783496,0.784157>,r}
+	sphere{<-2.21343,0.00783496,0.784157>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.21343,0.00783496,0.784157>,<-2.21346,0.00781314,0>,<-1.92288,0.508507,0>}
+	triangle{<-2.21343,0.00783496,0.784157>,<-1.92288,0.508507,0>,<-1.92283,0.508558,1.03466>}
+	triangle{<-2.21343,0.00783496,0.784157>,<-1.92283,0.508558,1.03466>,<-1.93529,0.487085,1.05768>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.21343,0.00783496,0.784157>,<-2.21346,0.00781314,0>,r}
+	sphere{<-2.21346,0.00781314,0>,r}
+	cylinder{<-2.21346,0.00781314,0>,<-1.92288,0.508507,0>,r}
+	sphere{<-1.92288,0.508507,0>,r}
+	cylinder{<-1.92288,0.508507,0>,<-1.92283,0.508558,1.03466>,r}
+	sphere{<-1.92283,0.508558,1.03466>,r}
+	cylinder{<-1.92283,0.508558,1.03466>,<-1.93529,0.487085,1.05768>,r}
+	sphere{<-1.93529,0.487085,1.05768>,r}
+	cylinder{<-1.93529,0.487085,1.05768>,<-2.21343,0.00783496,0.784157>,r}
+	sphere{<-2.21343,0.00783496,0.784157>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.58799,-0.481806,1.08753>,<-1.60044,-0.493777,1.08178>,<-1.92231,-0.493879,1.05036>}
+	triangle{<-1.58799,-0.481806,1.08753>,<-1.92231,-0.493879,1.05036>,<-1.93672,-0.469043,1.05835>}
+	triangle{<-1.58799,-0.481806,1.08753>,<-1.93672,-0.469043,1.05835>,<-1.78809,-0.121555,1.20432>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.58799,-0.481806,1.08753>,<-1.60044,-0.493777,1.08178>,r}
+	sphere{<-1.60044,-0.493777,1.08178>,r}
+	cylinder{<-1.60044,-0.493777,1.08178>,<-1.92231,-0.493879,1.05036>,r}
+	sphere{<-1.92231,-0.493879,1.05036>,r}
+	cylinder{<-1.92231,-0.493879,1.05036>,<-1.93672,-0.469043,1.05835>,r}
+	sphere{<-1.93672,-0.469043,1.05835>,r}
+	cylinder{<-1.93672,-0.469043,1.05835>,<-1.78809,-0.121555,1.20432>,r}
+	sphere{<-1.78809,-0.121555,1.20432>,r}
+	cylinder{<-1.78809,-0.121555,1.20432>,<-1.58799,-0.481806,1.08753>,r}
+	sphere{<-1.58799,-0.481806,1.08753>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.34847,-0.493858,0>,<-1.92228,-0.494031,5.55112e-17>,<-1.92231,-0.493879,1.05036>}
+	triangle{<-1.34847,-0.493858,0>,<-1.92231,-0.493879,1.05036>,<-1.60044,-0.493777,1.08178>}
+	triangle{<-1.34847,-0.493858,0>,<-1.60044,-0.493777,1.08178>,<-1.34809,-0.493727,0.904746>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.34847,-0.493858,0>,<-1.92228,-0.494031,5.55112e-17>,r}
+	sphere{<-1.92228,-0.494031,5.55112e-17>,r}
+	cylinder{<-1.92228,-0.494031,5.55112e-17>,<-1.92231,-0.493879,1.05036>,r}
+	sphere{<-1.92231,-0.493879,1.05036>,r}
+	cylinder{<-1.92231,-0.493879,1.05036>,<-1.60044,-0.493777,1.08178>,r}
+	sphere{<-1.60044,-0.493777,1.08178>,r}
+	cylinder{<-1.60044,-0.493777,1.08178>,<-1.34809,-0.493727,0.904746>,r}
+	sphere{<-1.34809,-0.493727,0.904746>,r}
+	cylinder{<-1.34809,-0.493727,0.904746>,<-1.34847,-0.493858,0>,r}
+	sphere{<-1.34847,-0.493858,0>,r}
+	texture{t2}
+}
+union{
+	triangle{<-3,1.01345,0.784876>,<-2.21305,1.01307,0.785067>,<-1.96123,0.575321,1.04022>}
+	triangle{<-3,1.01345,0.784876>,<-1.96123,0.575321,1.04022>,<-1.96663,0.516049,1.07477>}
+	triangle{<-3,1.01345,0.784876>,<-1.96663,0.516049,1.07477>,<-3,0.505858,1.08075>}
+	texture{t1}
+}
+union{
+	cylinder{<-3,1.01345,0.784876>,<-2.21305,1.01307,0.785067>,r}
+	sphere{<-2.21305,1.01307,0.785067>,r}
+	cylinder{<-2.21305,1.01307,0.785067>,<-1.96123,0.575321,1.04022>,r}
+	sphere{<-1.96123,0.575321,1.04022>,r}
+	cylinder{<-1.96123,0.575321,1.04022>,<-1.96663,0.516049,1.07477>,r}
+	sphere{<-1.96663,0.516049,1.07477>,r}
+	cylinder{<-1.96663,0.516049,1.07477>,<-3,0.505858,1.08075>,r}
+	sphere{<-3,0.505858,1.08075>,r}
+	cylinder{<-3,0.505858,1.08075>,<-3,1.01345,0.784876>,r}
+	sphere{<-3,1.01345,0.784876>,r}
+	texture{t2}
+}
+union{
+	triangle{<-3,0.00784346,0.793193>,<-3,0.505858,1.08075>,<-1.96663,0.516049,1.07477>}
+	triangle{<-3,0.00784346,0.793193>,<-1.96663,0.516049,1.07477>,<-1.93529,0.487085,1.05768>}
+	triangle{<-3,0.00784346,0.793193>,<-1.93529,0.487085,1.05768>,<-2.21343,0.00783496,0.784157>}
+	texture{t1}
+}
+union{
+	cylinder{<-3,0.00784346,0.793193>,<-3,0.505858,1.08075>,r}
+	sphere{<-3,0.505858,1.08075>,r}
+	cylinder{<-3,0.505858,1.08075>,<-1.96663,0.516049,1.07477>,r}
+	sphere{<-1.96663,0.516049,1.07477>,r}
+	cylinder{<-1.96663,0.516049,1.07477>,<-1.93529,0.487085,1.05768>,r}
+	sphere{<-1.93529,0.487085,1.05768>,r}
+	cylinder{<-1.93529,0.487085,1.05768>,<-2.21343,0.00783496,0.784157>,r}
+	sphere{<-2.21343,0.00783496,0.784157>,r}
+	cylinder{<-2.21343,0.00783496,0.784157>,<-3,0.00784346,0.793193>,r}
+	sphere{<-3,0.00784346,0.793193>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.04469,0.516525,1.67948>,<-1.79014,0.282239,1.53312>,<-1.7989,0.334352,1.19265>}
+	triangle{<-2.04469,0.516525,1.67948>,<-1.7989,0.334352,1.19265>,<-1.93529,0.487085,1.05768>}
+	triangle{<-2.04469,0.516525,1.67948>,<-1.93529,0.487085,1.05768>,<-1.96663,0.516049,1.07477>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.04469,0.516525,1.67948>,<-1.79014,0.282239,1.53312>,r}
+	sphere{<-1.79014,0.282239,1.53312>,r}
+	cylinder{<-1.79014,0.282239,1.53312>,<-1.7989,0.334352,1.19265>,r}
+	sphere{<-1.7989,0.334352,1.19265>,r}
+	cylinder{<-1.7989,0.334352,1.19265>,<-1.93529,0.487085,1.05768>,r}
+	sphere{<-1.93529,0.487085,1.05768>,r}
+	cylinder{<-1.93529,0.487085,1.05768>,<-1.96663,0.516049,1.07477>,r}
+	sphere{<-1.96663,0.516049,1.07477>,r}
+	cylinder{<-1.96663,0.516049,1.07477>,<-2.04469,0.516525,1.67948>,r}
+	sphere{<-2.04469,0.516525,1.67948>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.973409,0.778082,2.03344>,<-0.944606,0.813779,2.02568>,<-0.928375,0.820495,2.00254>}
+	triangle{<-0.973409,0.778082,2.03344>,<-0.928375,0.820495,2.00254>,<-0.965292,0.606829,1.77737>}
+	triangle{<-0.973409,0.778082,2.03344>,<-0.965292,0.606829,1.77737>,<-1.03599,0.562468,1.85701>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.973409,0.778082,2.03344>,<-0.944606,0.813779,2.02568>,r}
+	sphere{<-0.944606,0.813779,2.02568>,r}
+	cylinder{<-0.944606,0.813779,2.02568>,<-0.928375,0.820495,2.00254>,r}
+	sphere{<-0.928375,0.820495,2.00254>,r}
+	cylinder{<-0.928375,0.820495,2.00254>,<-0.965292,0.606829,1.77737>,r}
+	sphere{<-0.965292,0.606829,1.77737>,r}
+	cylinder{<-0.965292,0.606829,1.77737>,<-1.03599,0.562468,1.85701>,r}
+	sphere{<-1.03599,0.562468,1.85701>,r}
+	cylinder{<-1.03599,0.562468,1.85701>,<-0.973409,0.778082,2.03344>,r}
+	sphere{<-0.973409,0.778082,2.03344>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.98744,1.41396,1.34614>,<-1.45609,1.6729,1.59156>,<-1.54933,1.32239,2.0634>}
+	triangle{<-1.98744,1.41396,1.34614>,<-1.54933,1.32239,2.0634>,<-1.86625,1.06469,2.09129>}
+	triangle{<-1.98744,1.41396,1.34614>,<-1.86625,1.06469,2.09129>,<-2.06062,1.04894,1.86822>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.98744,1.41396,1.34614>,<-1.45609,1.6729,1.59156>,r}
+	sphere{<-1.45609,1.6729,1.59156>,r}
+	cylinder{<-1.45609,1.6729,1.59156>,<-1.54933,1.32239,2.0634>,r}
+	sphere{<-1.54933,1.32239,2.0634>,r}
+	cylinder{<-1.54933,1.32239,2.0634>,<-1.86625,1.06469,2.09129>,r}
+	sphere{<-1.86625,1.06469,2.09129>,r}
+	cylinder{<-1.86625,1.06469,2.09129>,<-2.06062,1.04894,1.86822>,r}
+	sphere{<-2.06062,1.04894,1.86822>,r}
+	cylinder{<-2.06062,1.04894,1.86822>,<-1.98744,1.41396,1.34614>,r}
+	sphere{<-1.98744,1.41396,1.34614>,r}
+	texture{t2}
+}
+union{
+	triangle{<-3,0.4247,1.90027>,<-2.24332,0.424641,1.90773>,<-2.07273,0.0954326,1.88112>}
+	triangle{<-3,0.4247,1.90027>,<-2.07273,0.0954326,1.88112>,<-2.44674,-0.48984,1.82713>}
+	triangle{<-3,0.4247,1.90027>,<-2.44674,-0.48984,1.82713>,<-3,-0.484414,1.82214>}
+	texture{t1}
+}
+union{
+	cylinder{<-3,0.4247,1.90027>,<-2.24332,0.424641,1.90773>,r}
+	sphere{<-2.24332,0.424641,1.90773>,r}
+	cylinder{<-2.24332,0.424641,1.90773>,<-2.07273,0.0954326,1.88112>,r}
+	sphere{<-2.07273,0.0954326,1.88112>,r}
+	cylinder{<-2.07273,0.0954326,1.88112>,<-2.44674,-0.48984,1.82713>,r}
+	sphere{<-2.44674,-0.48984,1.82713>,r}
+	cylinder{<-2.44674,-0.48984,1.82713>,<-3,-0.484414,1.82214>,r}
+	sphere{<-3,-0.484414,1.82214>,r}
+	cylinder{<-3,-0.484414,1.82214>,<-3,0.4247,1.90027>,r}
+	sphere{<-3,0.4247,1.90027>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.19537,0.515335,1.82418>,<-3,0.50739,1.82366>,<-3,0.505858,1.08075>}
+	triangle{<-2.19537,0.515335,1.82418>,<-3,0.505858,1.08075>,<-1.96663,0.516049,1.07477>}
+	triangle{<-2.19537,0.515335,1.82418>,<-1.96663,0.516049,1.07477>,<-2.04469,0.516525,1.67948>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.19537,0.515335,1.82418>,<-3,0.50739,1.82366>,r}
+	sphere{<-3,0.50739,1.82366>,r}
+	cylinder{<-3,0.50739,1.82366>,<-3,0.505858,1.08075>,r}
+	sphere{<-3,0.505858,1.08075>,r}
+	cylinder{<-3,0.505858,1.08075>,<-1.96663,0.516049,1.07477>,r}
+	sphere{<-1.96663,0.516049,1.07477>,r}
+	cylinder{<-1.96663,0.516049,1.07477>,<-2.04469,0.516525,1.67948>,r}
+	sphere{<-2.04469,0.516525,1.67948>,r}
+	cylinder{<-2.04469,0.516525,1.67948>,<-2.19537,0.515335,1.82418>,r}
+	sphere{<-2.19537,0.515335,1.82418>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.06062,1.04894,1.86822>,<-2.06228,0.728427,1.84175>,<-2.19537,0.515335,1.82418>}
+	triangle{<-2.06062,1.04894,1.86822>,<-2.19537,0.515335,1.82418>,<-3,0.50739,1.82366>}
+	triangle{<-2.06062,1.04894,1.86822>,<-3,0.50739,1.82366>,<-3,1.60487,1.9143>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.06062,1.04894,1.86822>,<-2.06228,0.728427,1.84175>,r}
+	sphere{<-2.06228,0.728427,1.84175>,r}
+	cylinder{<-2.06228,0.728427,1.84175>,<-2.19537,0.515335,1.82418>,r}
+	sphere{<-2.19537,0.515335,1.82418>,r}
+	cylinder{<-2.19537,0.515335,1.82418>,<-3,0.50739,1.82366>,r}
+	sphere{<-3,0.50739,1.82366>,r}
+	cylinder{<-3,0.50739,1.82366>,<-3,1.60487,1.9143>,r}
+	sphere{<-3,1.60487,1.9143>,r}
+	cylinder{<-3,1.60487,1.9143>,<-2.06062,1.04894,1.86822>,r}
+	sphere{<-2.06062,1.04894,1.86822>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.064257,0.227637,-5.55112e-17>,<-0.134839,0.00548164,-5.55112e-17>,<-0.134915,0.00523367,0.649625>}
+	triangle{<-0.064257,0.227637,-5.55112e-17>,<-0.134915,0.00523367,0.649625>,<-0.108834,0.0873227,0.726719>}
+	triangle{<-0.064257,0.227637,-5.55112e-17>,<-0.108834,0.0873227,0.726719>,<-0.0642487,0.227653,0.68704>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.064257,0.227637,-5.55112e-17>,<-0.134839,0.00548164,-5.55112e-17>,r}
+	sphere{<-0.134839,0.00548164,-5.55112e-17>,r}
+	cylinder{<-0.134839,0.00548164,-5.55112e-17>,<-0.134915,0.00523367,0.649625>,r}
+	sphere{<-0.134915,0.00523367,0.649625>,r}
+	cylinder{<-0.134915,0.00523367,0.649625>,<-0.108834,0.0873227,0.726719>,r}
+	sphere{<-0.108834,0.0873227,0.726719>,r}
+	cylinder{<-0.108834,0.0873227,0.726719>,<-0.0642487,0.227653,0.68704>,r}
+	sphere{<-0.0642487,0.227653,0.68704>,r}
+	cylinder{<-0.0642487,0.227653,0.68704>,<-0.064257,0.227637,-5.55112e-17>,r}
+	sphere{<-0.064257,0.227637,-5.55112e-17>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.0642487,0.227653,0.68704>,<-0.108834,0.0873227,0.726719>,<-0.397098,0.248775,1.10488>}
+	triangle{<-0.0642487,0.227653,0.68704>,<-0.397098,0.248775,1.10488>,<-0.404275,0.27521,1.11685>}
+	triangle{<-0.0642487,0.227653,0.68704>,<-0.404275,0.27521,1.11685>,<-0.22047,0.532513,0.916717>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.0642487,0.227653,0.68704>,<-0.108834,0.0873227,0.726719>,r}
+	sphere{<-0.108834,0.0873227,0.726719>,r}
+	cylinder{<-0.108834,0.0873227,0.726719>,<-0.397098,0.248775,1.10488>,r}
+	sphere{<-0.397098,0.248775,1.10488>,r}
+	cylinder{<-0.397098,0.248775,1.10488>,<-0.404275,0.27521,1.11685>,r}
+	sphere{<-0.404275,0.27521,1.11685>,r}
+	cylinder{<-0.404275,0.27521,1.11685>,<-0.22047,0.532513,0.916717>,r}
+	sphere{<-0.22047,0.532513,0.916717>,r}
+	cylinder{<-0.22047,0.532513,0.916717>,<-0.0642487,0.227653,0.68704>,r}
+	sphere{<-0.0642487,0.227653,0.68704>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.101644,0.718748,1.7556>,<-0.407257,0.275269,1.32614>,<-0.965292,0.606829,1.77737>}
+	triangle{<-0.101644,0.718748,1.7556>,<-0.965292,0.606829,1.77737>,<-0.928375,0.820495,2.00254>}
+	triangle{<-0.101644,0.718748,1.7556>,<-0.928375,0.820495,2.00254>,<-0.761168,0.88678,2.04661>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.101644,0.718748,1.7556>,<-0.407257,0.275269,1.32614>,r}
+	sphere{<-0.407257,0.275269,1.32614>,r}
+	cylinder{<-0.407257,0.275269,1.32614>,<-0.965292,0.606829,1.77737>,r}
+	sphere{<-0.965292,0.606829,1.77737>,r}
+	cylinder{<-0.965292,0.606829,1.77737>,<-0.928375,0.820495,2.00254>,r}
+	sphere{<-0.928375,0.820495,2.00254>,r}
+	cylinder{<-0.928375,0.820495,2.00254>,<-0.761168,0.88678,2.04661>,r}
+	sphere{<-0.761168,0.88678,2.04661>,r}
+	cylinder{<-0.761168,0.88678,2.04661>,<-0.101644,0.718748,1.7556>,r}
+	sphere{<-0.101644,0.718748,1.7556>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.343476,1.55777,1.7129>,<-0.761168,0.88678,2.04661>,<-0.928375,0.820495,2.00254>}
+	triangle{<-0.343476,1.55777,1.7129>,<-0.928375,0.820495,2.00254>,<-1.02035,1.52158,1.33062>}
+	triangle{<-0.343476,1.55777,1.7129>,<-1.02035,1.52158,1.33062>,<-0.35987,1.58377,1.68004>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.343476,1.55777,1.7129>,<-0.761168,0.88678,2.04661>,r}
+	sphere{<-0.761168,0.88678,2.04661>,r}
+	cylinder{<-0.761168,0.88678,2.04661>,<-0.928375,0.820495,2.00254>,r}
+	sphere{<-0.928375,0.820495,2.00254>,r}
+	cylinder{<-0.928375,0.820495,2.00254>,<-1.02035,1.52158,1.33062>,r}
+	sphere{<-1.02035,1.52158,1.33062>,r}
+	cylinder{<-1.02035,1.52158,1.33062>,<-0.35987,1.58377,1.68004>,r}
+	sphere{<-0.35987,1.58377,1.68004>,r}
+	cylinder{<-0.35987,1.58377,1.68004>,<-0.343476,1.55777,1.7129>,r}
+	sphere{<-0.343476,1.55777,1.7129>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.23844,-0.0939489,1.98326>,<-1.7878,0.208445,1.56151>,<-1.79014,0.282239,1.53312>}
+	triangle{<-1.23844,-0.0939489,1.98326>,<-1.79014,0.282239,1.53312>,<-1.03599,0.562468,1.85701>}
+	triangle{<-1.23844,-0.0939489,1.98326>,<-1.03599,0.562468,1.85701>,<-1.07132,0.0559691,2.02283>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.23844,-0.0939489,1.98326>,<-1.7878,0.208445,1.56151>,r}
+	sphere{<-1.7878,0.208445,1.56151>,r}
+	cylinder{<-1.7878,0.208445,1.56151>,<-1.79014,0.282239,1.53312>,r}
+	sphere{<-1.79014,0.282239,1.53312>,r}
+	cylinder{<-1.79014,0.282239,1.53312>,<-1.03599,0.562468,1.85701>,r}
+	sphere{<-1.03599,0.562468,1.85701>,r}
+	cylinder{<-1.03599,0.562468,1.85701>,<-1.07132,0.0559691,2.02283>,r}
+	sphere{<-1.07132,0.0559691,2.02283>,r}
+	cylinder{<-1.07132,0.0559691,2.02283>,<-1.23844,-0.0939489,1.98326>,r}
+	sphere{<-1.23844,-0.0939489,1.98326>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.23844,-0.0939489,1.98326>,<-1.033,-0.477612,1.84844>,<-1.58799,-0.481806,1.08753>}
+	triangle{<-1.23844,-0.0939489,1.98326>,<-1.58799,-0.481806,1.08753>,<-1.78809,-0.121555,1.20432>}
+	triangle{<-1.23844,-0.0939489,1.98326>,<-1.78809,-0.121555,1.20432>,<-1.7878,0.208445,1.56151>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.23844,-0.0939489,1.98326>,<-1.033,-0.477612,1.84844>,r}
+	sphere{<-1.033,-0.477612,1.84844>,r}
+	cylinder{<-1.033,-0.477612,1.84844>,<-1.58799,-0.481806,1.08753>,r}
+	sphere{<-1.58799,-0.481806,1.08753>,r}
+	cylinder{<-1.58799,-0.481806,1.08753>,<-1.78809,-0.121555,1.20432>,r}
+	sphere{<-1.78809,-0.121555,1.20432>,r}
+	cylinder{<-1.78809,-0.121555,1.20432>,<-1.7878,0.208445,1.56151>,r}
+	sphere{<-1.7878,0.208445,1.56151>,r}
+	cylinder{<-1.7878,0.208445,1.56151>,<-1.23844,-0.0939489,1.98326>,r}
+	sphere{<-1.23844,-0.0939489,1.98326>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.23844,-0.0939489,1.98326>,<-1.07132,0.0559691,2.02283>,<-0.776993,-0.403364,1.85885>}
+	triangle{<-1.23844,-0.0939489,1.98326>,<-0.776993,-0.403364,1.85885>,<-0.871986,-0.473308,1.8413>}
+	triangle{<-1.23844,-0.0939489,1.98326>,<-0.871986,-0.473308,1.8413>,<-1.033,-0.477612,1.84844>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.23844,-0.0939489,1.98326>,<-1.07132,0.0559691,2.02283>,r}
+	sphere{<-1.07132,0.0559691,2.02283>,r}
+	cylinder{<-1.07132,0.0559691,2.02283>,<-0.776993,-0.403364,1.85885>,r}
+	sphere{<-0.776993,-0.403364,1.85885>,r}
+	cylinder{<-0.776993,-0.403364,1.85885>,<-0.871986,-0.473308,1.8413>,r}
+	sphere{<-0.871986,-0.473308,1.8413>,r}
+	cylinder{<-0.871986,-0.473308,1.8413>,<-1.033,-0.477612,1.84844>,r}
+	sphere{<-1.033,-0.477612,1.84844>,r}
+	cylinder{<-1.033,-0.477612,1.84844>,<-1.23844,-0.0939489,1.98326>,r}
+	sphere{<-1.23844,-0.0939489,1.98326>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.929811,0.826881,0.0651549>,<0.929796,0.826871,-5.55112e-17>,<-0.064257,0.227637,-5.55112e-17>}
+	triangle{<0.929811,0.826881,0.0651549>,<-0.064257,0.227637,-5.55112e-17>,<-0.0642487,0.227653,0.68704>}
+	triangle{<0.929811,0.826881,0.0651549>,<-0.0642487,0.227653,0.68704>,<0.547406,0.596372,0.799421>}
+	texture{t1}
+}
+union{
+	cylinder{<0.929811,0.826881,0.0651549>,<0.929796,0.826871,-5.55112e-17>,r}
+	sphere{<0.929796,0.826871,-5.55112e-17>,r}
+	cylinder{<0.929796,0.826871,-5.55112e-17>,<-0.064257,0.227637,-5.55112e-17>,r}
+	sphere{<-0.064257,0.227637,-5.55112e-17>,r}
+	cylinder{<-0.064257,0.227637,-5.55112e-17>,<-0.0642487,0.227653,0.68704>,r}
+	sphere{<-0.0642487,0.227653,0.68704>,r}
+	cylinder{<-0.0642487,0.227653,0.68704>,<0.547406,0.596372,0.799421>,r}
+	sphere{<0.547406,0.596372,0.799421>,r}
+	cylinder{<0.547406,0.596372,0.799421>,<0.929811,0.826881,0.0651549>,r}
+	sphere{<0.929811,0.826881,0.0651549>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.478631,1.3294,0.85594>,<0.365591,1.00018,1.09846>,<0.102157,0.996166,1.15028>}
+	triangle{<0.478631,1.3294,0.85594>,<0.102157,0.996166,1.15028>,<-0.198477,1.4368,0.909974>}
+	triangle{<0.478631,1.3294,0.85594>,<-0.198477,1.4368,0.909974>,<-0.0608504,1.66131,0.733303>}
+	texture{t1}
+}
+union{
+	cylinder{<0.478631,1.3294,0.85594>,<0.365591,1.00018,1.09846>,r}
+	sphere{<0.365591,1.00018,1.09846>,r}
+	cylinder{<0.365591,1.00018,1.09846>,<0.102157,0.996166,1.15028>,r}
+	sphere{<0.102157,0.996166,1.15028>,r}
+	cylinder{<0.102157,0.996166,1.15028>,<-0.198477,1.4368,0.909974>,r}
+	sphere{<-0.198477,1.4368,0.909974>,r}
+	cylinder{<-0.198477,1.4368,0.909974>,<-0.0608504,1.66131,0.733303>,r}
+	sphere{<-0.0608504,1.66131,0.733303>,r}
+	cylinder{<-0.0608504,1.66131,0.733303>,<0.478631,1.3294,0.85594>,r}
+	sphere{<0.478631,1.3294,0.85594>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.0642487,0.227653,0.68704>,<-0.064257,0.227637,-5.55112e-17>,<-0.462868,1.00548,-5.55112e-17>}
+	triangle{<-0.0642487,0.227653,0.68704>,<-0.462868,1.00548,-5.55112e-17>,<-0.462862,1.00551,0.719907>}
+	triangle{<-0.0642487,0.227653,0.68704>,<-0.462862,1.00551,0.719907>,<-0.22047,0.532513,0.916717>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.0642487,0.227653,0.68704>,<-0.064257,0.227637,-5.55112e-17>,r}
+	sphere{<-0.064257,0.227637,-5.55112e-17>,r}
+	cylinder{<-0.064257,0.227637,-5.55112e-17>,<-0.462868,1.00548,-5.55112e-17>,r}
+	sphere{<-0.462868,1.00548,-5.55112e-17>,r}
+	cylinder{<-0.462868,1.00548,-5.55112e-17>,<-0.462862,1.00551,0.719907>,r}
+	sphere{<-0.462862,1.00551,0.719907>,r}
+	cylinder{<-0.462862,1.00551,0.719907>,<-0.22047,0.532513,0.916717>,r}
+	sphere{<-0.22047,0.532513,0.916717>,r}
+	cylinder{<-0.22047,0.532513,0.916717>,<-0.0642487,0.227653,0.68704>,r}
+	sphere{<-0.0642487,0.227653,0.68704>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.0642487,0.227653,0.68704>,<-0.22047,0.532513,0.916717>,<0.102157,0.996166,1.15028>}
+	triangle{<-0.0642487,0.227653,0.68704>,<0.102157,0.996166,1.15028>,<0.365591,1.00018,1.09846>}
+	triangle{<-0.0642487,0.227653,0.68704>,<0.365591,1.00018,1.09846>,<0.547406,0.596372,0.799421>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.0642487,0.227653,0.68704>,<-0.22047,0.532513,0.916717>,r}
+	sphere{<-0.22047,0.532513,0.916717>,r}
+	cylinder{<-0.22047,0.532513,0.916717>,<0.102157,0.996166,1.15028>,r}
+	sphere{<0.102157,0.996166,1.15028>,r}
+	cylinder{<0.102157,0.996166,1.15028>,<0.365591,1.00018,1.09846>,r}
+	sphere{<0.365591,1.00018,1.09846>,r}
+	cylinder{<0.365591,1.00018,1.09846>,<0.547406,0.596372,0.799421>,r}
+	sphere{<0.547406,0.596372,0.799421>,r}
+	cylinder{<0.547406,0.596372,0.799421>,<-0.0642487,0.227653,0.68704>,r}
+	sphere{<-0.0642487,0.227653,0.68704>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.895015,1.38366,1.47758>,<0.919402,1.68315,1.12648>,<1.18734,1.72908,1.00323>}
+	triangle{<0.895015,1.38366,1.47758>,<1.18734,1.72908,1.00323>,<1.41906,1.55179,1.14641>}
+	triangle{<0.895015,1.38366,1.47758>,<1.41906,1.55179,1.14641>,<1.19809,1.28057,1.5166>}
+	texture{t1}
+}
+union{
+	cylinder{<0.895015,1.38366,1.47758>,<0.919402,1.68315,1.12648>,r}
+	sphere{<0.919402,1.68315,1.12648>,r}
+	cylinder{<0.919402,1.68315,1.12648>,<1.18734,1.72908,1.00323>,r}
+	sphere{<1.18734,1.72908,1.00323>,r}
+	cylinder{<1.18734,1.72908,1.00323>,<1.41906,1.55179,1.14641>,r}
+	sphere{<1.41906,1.55179,1.14641>,r}
+	cylinder{<1.41906,1.55179,1.14641>,<1.19809,1.28057,1.5166>,r}
+	sphere{<1.19809,1.28057,1.5166>,r}
+	cylinder{<1.19809,1.28057,1.5166>,<0.895015,1.38366,1.47758>,r}
+	sphere{<0.895015,1.38366,1.47758>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.895015,1.38366,1.47758>,<0.545504,0.988944,1.41241>,<0.365591,1.00018,1.09846>}
+	triangle{<0.895015,1.38366,1.47758>,<0.365591,1.00018,1.09846>,<0.478631,1.3294,0.85594>}
+	triangle{<0.895015,1.38366,1.47758>,<0.478631,1.3294,0.85594>,<0.919402,1.68315,1.12648>}
+	texture{t1}
+}
+union{
+	cylinder{<0.895015,1.38366,1.47758>,<0.545504,0.988944,1.41241>,r}
+	sphere{<0.545504,0.988944,1.41241>,r}
+	cylinder{<0.545504,0.988944,1.41241>,<0.365591,1.00018,1.09846>,r}
+	sphere{<0.365591,1.00018,1.09846>,r}
+	cylinder{<0.365591,1.00018,1.09846>,<0.478631,1.3294,0.85594>,r}
+	sphere{<0.478631,1.3294,0.85594>,r}
+	cylinder{<0.478631,1.3294,0.85594>,<0.919402,1.68315,1.12648>,r}
+	sphere{<0.919402,1.68315,1.12648>,r}
+	cylinder{<0.919402,1.68315,1.12648>,<0.895015,1.38366,1.47758>,r}
+	sphere{<0.895015,1.38366,1.47758>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.895015,1.38366,1.47758>,<1.19809,1.28057,1.5166>,<1.30431,0.563655,1.50356>}
+	triangle{<0.895015,1.38366,1.47758>,<1.30431,0.563655,1.50356>,<1.06247,0.41464,1.46334>}
+	triangle{<0.895015,1.38366,1.47758>,<1.06247,0.41464,1.46334>,<0.545504,0.988944,1.41241>}
+	texture{t1}
+}
+union{
+	cylinder{<0.895015,1.38366,1.47758>,<1.19809,1.28057,1.5166>,r}
+	sphere{<1.19809,1.28057,1.5166>,r}
+	cylinder{<1.19809,1.28057,1.5166>,<1.30431,0.563655,1.50356>,r}
+	sphere{<1.30431,0.563655,1.50356>,r}
+	cylinder{<1.30431,0.563655,1.50356>,<1.06247,0.41464,1.46334>,r}
+	sphere{<1.06247,0.41464,1.46334>,r}
+	cylinder{<1.06247,0.41464,1.46334>,<0.545504,0.988944,1.41241>,r}
+	sphere{<0.545504,0.988944,1.41241>,r}
+	cylinder{<0.545504,0.988944,1.41241>,<0.895015,1.38366,1.47758>,r}
+	sphere{<0.895015,1.38366,1.47758>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.11781,0.289047,1.02629>,<1.01034,0.269907,1.13997>,<1.06247,0.41464,1.46334>}
+	triangle{<1.11781,0.289047,1.02629>,<1.06247,0.41464,1.46334>,<1.30431,0.563655,1.50356>}
+	triangle{<1.11781,0.289047,1.02629>,<1.30431,0.563655,1.50356>,<1.52731,0.572538,1.1815>}
+	texture{t1}
+}
+union{
+	cylinder{<1.11781,0.289047,1.02629>,<1.01034,0.269907,1.13997>,r}
+	sphere{<1.01034,0.269907,1.13997>,r}
+	cylinder{<1.01034,0.269907,1.13997>,<1.06247,0.41464,1.46334>,r}
+	sphere{<1.06247,0.41464,1.46334>,r}
+	cylinder{<1.06247,0.41464,1.46334>,<1.30431,0.563655,1.50356>,r}
+	sphere{<1.30431,0.563655,1.50356>,r}
+	cylinder{<1.30431,0.563655,1.50356>,<1.52731,0.572538,1.1815>,r}
+	sphere{<1.52731,0.572538,1.1815>,r}
+	cylinder{<1.52731,0.572538,1.1815>,<1.11781,0.289047,1.02629>,r}
+	sphere{<1.11781,0.289047,1.02629>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.52731,0.572538,1.1815>,<1.30431,0.563655,1.50356>,<1.19809,1.28057,1.5166>}
+	triangle{<1.52731,0.572538,1.1815>,<1.19809,1.28057,1.5166>,<1.41906,1.55179,1.14641>}
+	triangle{<1.52731,0.572538,1.1815>,<1.41906,1.55179,1.14641>,<1.68884,0.961273,0.873814>}
+	texture{t1}
+}
+union{
+	cylinder{<1.52731,0.572538,1.1815>,<1.30431,0.563655,1.50356>,r}
+	sphere{<1.30431,0.563655,1.50356>,r}
+	cylinder{<1.30431,0.563655,1.50356>,<1.19809,1.28057,1.5166>,r}
+	sphere{<1.19809,1.28057,1.5166>,r}
+	cylinder{<1.19809,1.28057,1.5166>,<1.41906,1.55179,1.14641>,r}
+	sphere{<1.41906,1.55179,1.14641>,r}
+	cylinder{<1.41906,1.55179,1.14641>,<1.68884,0.961273,0.873814>,r}
+	sphere{<1.68884,0.961273,0.873814>,r}
+	cylinder{<1.68884,0.961273,0.873814>,<1.52731,0.572538,1.1815>,r}
+	sphere{<1.52731,0.572538,1.1815>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.365591,1.00018,1.09846>,<0.545504,0.988944,1.41241>,<1.06247,0.41464,1.46334>}
+	triangle{<0.365591,1.00018,1.09846>,<1.06247,0.41464,1.46334>,<1.01034,0.269907,1.13997>}
+	triangle{<0.365591,1.00018,1.09846>,<1.01034,0.269907,1.13997>,<0.547406,0.596372,0.799421>}
+	texture{t1}
+}
+union{
+	cylinder{<0.365591,1.00018,1.09846>,<0.545504,0.988944,1.41241>,r}
+	sphere{<0.545504,0.988944,1.41241>,r}
+	cylinder{<0.545504,0.988944,1.41241>,<1.06247,0.41464,1.46334>,r}
+	sphere{<1.06247,0.41464,1.46334>,r}
+	cylinder{<1.06247,0.41464,1.46334>,<1.01034,0.269907,1.13997>,r}
+	sphere{<1.01034,0.269907,1.13997>,r}
+	cylinder{<1.01034,0.269907,1.13997>,<0.547406,0.596372,0.799421>,r}
+	sphere{<0.547406,0.596372,0.799421>,r}
+	cylinder{<0.547406,0.596372,0.799421>,<0.365591,1.00018,1.09846>,r}
+	sphere{<0.365591,1.00018,1.09846>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.01034,0.269907,1.13997>,<1.11781,0.289047,1.02629>,<1.2392,-0.0588833,0.831019>}
+	triangle{<1.01034,0.269907,1.13997>,<1.2392,-0.0588833,0.831019>,<1.14003,-0.173996,0.918291>}
+	triangle{<1.01034,0.269907,1.13997>,<1.14003,-0.173996,0.918291>,<0.942535,0.0980355,1.18279>}
+	texture{t1}
+}
+union{
+	cylinder{<1.01034,0.269907,1.13997>,<1.11781,0.289047,1.02629>,r}
+	sphere{<1.11781,0.289047,1.02629>,r}
+	cylinder{<1.11781,0.289047,1.02629>,<1.2392,-0.0588833,0.831019>,r}
+	sphere{<1.2392,-0.0588833,0.831019>,r}
+	cylinder{<1.2392,-0.0588833,0.831019>,<1.14003,-0.173996,0.918291>,r}
+	sphere{<1.14003,-0.173996,0.918291>,r}
+	cylinder{<1.14003,-0.173996,0.918291>,<0.942535,0.0980355,1.18279>,r}
+	sphere{<0.942535,0.0980355,1.18279>,r}
+	cylinder{<0.942535,0.0980355,1.18279>,<1.01034,0.269907,1.13997>,r}
+	sphere{<1.01034,0.269907,1.13997>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.83644,0.527626,1.15404>,<1.52731,0.572538,1.1815>,<1.68884,0.961273,0.873814>}
+	triangle{<1.83644,0.527626,1.15404>,<1.68884,0.961273,0.873814>,<1.87561,0.946903,0.848142>}
+	triangle{<1.83644,0.527626,1.15404>,<1.87561,0.946903,0.848142>,<2.00414,0.733602,0.97523>}
+	texture{t1}
+}
+union{
+	cylinder{<1.83644,0.527626,1.15404>,<1.52731,0.572538,1.1815>,r}
+	sphere{<1.52731,0.572538,1.1815>,r}
+	cylinder{<1.52731,0.572538,1.1815>,<1.68884,0.961273,0.873814>,r}
+	sphere{<1.68884,0.961273,0.873814>,r}
+	cylinder{<1.68884,0.961273,0.873814>,<1.87561,0.946903,0.848142>,r}
+	sphere{<1.87561,0.946903,0.848142>,r}
+	cylinder{<1.87561,0.946903,0.848142>,<2.00414,0.733602,0.97523>,r}
+	sphere{<2.00414,0.733602,0.97523>,r}
+	cylinder{<2.00414,0.733602,0.97523>,<1.83644,0.527626,1.15404>,r}
+	sphere{<1.83644,0.527626,1.15404>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.929796,0.826871,5.55112e-17>,<0.929811,0.826881,0.0651549>,<1.11781,0.289047,1.02629>}
+	triangle{<0.929796,0.826871,5.55112e-17>,<1.11781,0.289047,1.02629>,<1.2392,-0.0588833,0.831019>}
+	triangle{<0.929796,0.826871,5.55112e-17>,<1.2392,-0.0588833,0.831019>,<1.23903,-0.0590588,0>}
+	texture{t1}
+}
+union{
+	cylinder{<0.929796,0.826871,5.55112e-17>,<0.929811,0.826881,0.0651549>,r}
+	sphere{<0.929811,0.826881,0.0651549>,r}
+	cylinder{<0.929811,0.826881,0.0651549>,<1.11781,0.289047,1.02629>,r}
+	sphere{<1.11781,0.289047,1.02629>,r}
+	cylinder{<1.11781,0.289047,1.02629>,<1.2392,-0.0588833,0.831019>,r}
+	sphere{<1.2392,-0.0588833,0.831019>,r}
+	cylinder{<1.2392,-0.0588833,0.831019>,<1.23903,-0.0590588,0>,r}
+	sphere{<1.23903,-0.0590588,0>,r}
+	cylinder{<1.23903,-0.0590588,0>,<0.929796,0.826871,5.55112e-17>,r}
+	sphere{<0.929796,0.826871,5.55112e-17>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.19906,0.410563,5.55112e-17>,<1.88558,-0.182103,5.55112e-17>,<1.88557,-0.181912,0.757347>}
+	triangle{<2.19906,0.410563,5.55112e-17>,<1.88557,-0.181912,0.757347>,<2.05994,0.147814,0.940181>}
+	triangle{<2.19906,0.410563,5.55112e-17>,<2.05994,0.147814,0.940181>,<2.19891,0.410501,0.788568>}
+	texture{t1}
+}
+union{
+	cylinder{<2.19906,0.410563,5.55112e-17>,<1.88558,-0.182103,5.55112e-17>,r}
+	sphere{<1.88558,-0.182103,5.55112e-17>,r}
+	cylinder{<1.88558,-0.182103,5.55112e-17>,<1.88557,-0.181912,0.757347>,r}
+	sphere{<1.88557,-0.181912,0.757347>,r}
+	cylinder{<1.88557,-0.181912,0.757347>,<2.05994,0.147814,0.940181>,r}
+	sphere{<2.05994,0.147814,0.940181>,r}
+	cylinder{<2.05994,0.147814,0.940181>,<2.19891,0.410501,0.788568>,r}
+	sphere{<2.19891,0.410501,0.788568>,r}
+	cylinder{<2.19891,0.410501,0.788568>,<2.19906,0.410563,5.55112e-17>,r}
+	sphere{<2.19906,0.410563,5.55112e-17>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.19906,0.410563,5.55112e-17>,<2.19891,0.410501,0.788568>,<2.00414,0.733602,0.97523>}
+	triangle{<2.19906,0.410563,5.55112e-17>,<2.00414,0.733602,0.97523>,<1.87561,0.946903,0.848142>}
+	triangle{<2.19906,0.410563,5.55112e-17>,<1.87561,0.946903,0.848142>,<1.87567,0.947144,5.55112e-17>}
+	texture{t1}
+}
+union{
+	cylinder{<2.19906,0.410563,5.55112e-17>,<2.19891,0.410501,0.788568>,r}
+	sphere{<2.19891,0.410501,0.788568>,r}
+	cylinder{<2.19891,0.410501,0.788568>,<2.00414,0.733602,0.97523>,r}
+	sphere{<2.00414,0.733602,0.97523>,r}
+	cylinder{<2.00414,0.733602,0.97523>,<1.87561,0.946903,0.848142>,r}
+	sphere{<1.87561,0.946903,0.848142>,r}
+	cylinder{<1.87561,0.946903,0.848142>,<1.87567,0.947144,5.55112e-17>,r}
+	sphere{<1.87567,0.947144,5.55112e-17>,r}
+	cylinder{<1.87567,0.947144,5.55112e-17>,<2.19906,0.410563,5.55112e-17>,r}
+	sphere{<2.19906,0.410563,5.55112e-17>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.4857,1.70533,0.282835>,<2.08597,1.20835,0.933989>,<1.87561,0.946903,0.848142>}
+	triangle{<2.4857,1.70533,0.282835>,<1.87561,0.946903,0.848142>,<1.87567,0.947144,0>}
+	triangle{<2.4857,1.70533,0.282835>,<1.87567,0.947144,0>,<2.48567,1.70535,0>}
+	texture{t1}
+}
+union{
+	cylinder{<2.4857,1.70533,0.282835>,<2.08597,1.20835,0.933989>,r}
+	sphere{<2.08597,1.20835,0.933989>,r}
+	cylinder{<2.08597,1.20835,0.933989>,<1.87561,0.946903,0.848142>,r}
+	sphere{<1.87561,0.946903,0.848142>,r}
+	cylinder{<1.87561,0.946903,0.848142>,<1.87567,0.947144,0>,r}
+	sphere{<1.87567,0.947144,0>,r}
+	cylinder{<1.87567,0.947144,0>,<2.48567,1.70535,0>,r}
+	sphere{<2.48567,1.70535,0>,r}
+	cylinder{<2.48567,1.70535,0>,<2.4857,1.70533,0.282835>,r}
+	sphere{<2.4857,1.70533,0.282835>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.36795,1.04118,1.15264>,<3,1.04104,1.15223>,<3,0.410882,0.788371>}
+	triangle{<2.36795,1.04118,1.15264>,<3,0.410882,0.788371>,<2.19891,0.410501,0.788568>}
+	triangle{<2.36795,1.04118,1.15264>,<2.19891,0.410501,0.788568>,<2.00414,0.733602,0.97523>}
+	texture{t1}
+}
+union{
+	cylinder{<2.36795,1.04118,1.15264>,<3,1.04104,1.15223>,r}
+	sphere{<3,1.04104,1.15223>,r}
+	cylinder{<3,1.04104,1.15223>,<3,0.410882,0.788371>,r}
+	sphere{<3,0.410882,0.788371>,r}
+	cylinder{<3,0.410882,0.788371>,<2.19891,0.410501,0.788568>,r}
+	sphere{<2.19891,0.410501,0.788568>,r}
+	cylinder{<2.19891,0.410501,0.788568>,<2.00414,0.733602,0.97523>,r}
+	sphere{<2.00414,0.733602,0.97523>,r}
+	cylinder{<2.00414,0.733602,0.97523>,<2.36795,1.04118,1.15264>,r}
+	sphere{<2.36795,1.04118,1.15264>,r}
+	texture{t2}
+}
+union{
+	triangle{<3,0.410882,0.788371>,<2.19891,0.410501,0.788568>,<2.05994,0.147814,0.940181>}
+	triangle{<3,0.410882,0.788371>,<2.05994,0.147814,0.940181>,<2.20156,-0.0892997,1.07704>}
+	triangle{<3,0.410882,0.788371>,<2.20156,-0.0892997,1.07704>,<3,-0.0892172,1.07702>}
+	texture{t1}
+}
+union{
+	cylinder{<3,0.410882,0.788371>,<2.19891,0.410501,0.788568>,r}
+	sphere{<2.19891,0.410501,0.788568>,r}
+	cylinder{<2.19891,0.410501,0.788568>,<2.05994,0.147814,0.940181>,r}
+	sphere{<2.05994,0.147814,0.940181>,r}
+	cylinder{<2.05994,0.147814,0.940181>,<2.20156,-0.0892997,1.07704>,r}
+	sphere{<2.20156,-0.0892997,1.07704>,r}
+	cylinder{<2.20156,-0.0892997,1.07704>,<3,-0.0892172,1.07702>,r}
+	sphere{<3,-0.0892172,1.07702>,r}
+	cylinder{<3,-0.0892172,1.07702>,<3,0.410882,0.788371>,r}
+	sphere{<3,0.410882,0.788371>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.09357,0.609993,1.82742>,<2.54723,1.11876,1.54033>,<3,1.1187,1.54026>}
+	triangle{<2.09357,0.609993,1.82742>,<3,1.1187,1.54026>,<3,0.398457,1.94652>}
+	triangle{<2.09357,0.609993,1.82742>,<3,0.398457,1.94652>,<2.21577,0.398661,1.94659>}
+	texture{t1}
+}
+union{
+	cylinder{<2.09357,0.609993,1.82742>,<2.54723,1.11876,1.54033>,r}
+	sphere{<2.54723,1.11876,1.54033>,r}
+	cylinder{<2.54723,1.11876,1.54033>,<3,1.1187,1.54026>,r}
+	sphere{<3,1.1187,1.54026>,r}
+	cylinder{<3,1.1187,1.54026>,<3,0.398457,1.94652>,r}
+	sphere{<3,0.398457,1.94652>,r}
+	cylinder{<3,0.398457,1.94652>,<2.21577,0.398661,1.94659>,r}
+	sphere{<2.21577,0.398661,1.94659>,r}
+	cylinder{<2.21577,0.398661,1.94659>,<2.09357,0.609993,1.82742>,r}
+	sphere{<2.09357,0.609993,1.82742>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.06876,0.144048,1.7969>,<2.21577,0.398661,1.94659>,<3,0.398457,1.94652>}
+	triangle{<2.06876,0.144048,1.7969>,<3,0.398457,1.94652>,<3,-0.0892755,1.65979>}
+	triangle{<2.06876,0.144048,1.7969>,<3,-0.0892755,1.65979>,<2.20607,-0.0893575,1.6597>}
+	texture{t1}
+}
+union{
+	cylinder{<2.06876,0.144048,1.7969>,<2.21577,0.398661,1.94659>,r}
+	sphere{<2.21577,0.398661,1.94659>,r}
+	cylinder{<2.21577,0.398661,1.94659>,<3,0.398457,1.94652>,r}
+	sphere{<3,0.398457,1.94652>,r}
+	cylinder{<3,0.398457,1.94652>,<3,-0.0892755,1.65979>,r}
+	sphere{<3,-0.0892755,1.65979>,r}
+	cylinder{<3,-0.0892755,1.65979>,<2.20607,-0.0893575,1.6597>,r}
+	sphere{<2.20607,-0.0893575,1.6597>,r}
+	cylinder{<2.20607,-0.0893575,1.6597>,<2.06876,0.144048,1.7969>,r}
+	sphere{<2.06876,0.144048,1.7969>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.84923,3,1.09521>,<-1.84929,2.62433,1.09525>,<-2.39614,2.00613,0.993753>}
+	triangle{<-1.84923,3,1.09521>,<-2.39614,2.00613,0.993753>,<-3,2.11801,0.881562>}
+	triangle{<-1.84923,3,1.09521>,<-3,2.11801,0.881562>,<-3,3,0.881439>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.84923,3,1.09521>,<-1.84929,2.62433,1.09525>,r}
+	sphere{<-1.84929,2.62433,1.09525>,r}
+	cylinder{<-1.84929,2.62433,1.09525>,<-2.39614,2.00613,0.993753>,r}
+	sphere{<-2.39614,2.00613,0.993753>,r}
+	cylinder{<-2.39614,2.00613,0.993753>,<-3,2.11801,0.881562>,r}
+	sphere{<-3,2.11801,0.881562>,r}
+	cylinder{<-3,2.11801,0.881562>,<-3,3,0.881439>,r}
+	sphere{<-3,3,0.881439>,r}
+	cylinder{<-3,3,0.881439>,<-1.84923,3,1.09521>,r}
+	sphere{<-1.84923,3,1.09521>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.73026,1.88269,0>,<-2.39614,2.00613,0.993753>,<-1.84929,2.62433,1.09525>}
+	triangle{<-1.73026,1.88269,0>,<-1.84929,2.62433,1.09525>,<-1.70497,2.68196,0.987495>}
+	triangle{<-1.73026,1.88269,0>,<-1.70497,2.68196,0.987495>,<-1.70489,1.90767,0>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.73026,1.88269,0>,<-2.39614,2.00613,0.993753>,r}
+	sphere{<-2.39614,2.00613,0.993753>,r}
+	cylinder{<-2.39614,2.00613,0.993753>,<-1.84929,2.62433,1.09525>,r}
+	sphere{<-1.84929,2.62433,1.09525>,r}
+	cylinder{<-1.84929,2.62433,1.09525>,<-1.70497,2.68196,0.987495>,r}
+	sphere{<-1.70497,2.68196,0.987495>,r}
+	cylinder{<-1.70497,2.68196,0.987495>,<-1.70489,1.90767,0>,r}
+	sphere{<-1.70489,1.90767,0>,r}
+	cylinder{<-1.70489,1.90767,0>,<-1.73026,1.88269,0>,r}
+	sphere{<-1.73026,1.88269,0>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.73026,1.88269,0>,<-1.71816,1.85607,0>,<-2.04673,1.29629,0.950267>}
+	triangle{<-1.73026,1.88269,0>,<-2.04673,1.29629,0.950267>,<-2.43335,1.77236,1.22761>}
+	triangle{<-1.73026,1.88269,0>,<-2.43335,1.77236,1.22761>,<-2.39614,2.00613,0.993753>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.73026,1.88269,0>,<-1.71816,1.85607,0>,r}
+	sphere{<-1.71816,1.85607,0>,r}
+	cylinder{<-1.71816,1.85607,0>,<-2.04673,1.29629,0.950267>,r}
+	sphere{<-2.04673,1.29629,0.950267>,r}
+	cylinder{<-2.04673,1.29629,0.950267>,<-2.43335,1.77236,1.22761>,r}
+	sphere{<-2.43335,1.77236,1.22761>,r}
+	cylinder{<-2.43335,1.77236,1.22761>,<-2.39614,2.00613,0.993753>,r}
+	sphere{<-2.39614,2.00613,0.993753>,r}
+	cylinder{<-2.39614,2.00613,0.993753>,<-1.73026,1.88269,0>,r}
+	sphere{<-1.73026,1.88269,0>,r}
+	texture{t2}
+}
+union{
+	triangle{<-3,1.7724,1.22733>,<-2.43335,1.77236,1.22761>,<-2.04673,1.29629,0.950267>}
+	triangle{<-3,1.7724,1.22733>,<-2.04673,1.29629,0.950267>,<-2.21305,1.01307,0.785067>}
+	triangle{<-3,1.7724,1.22733>,<-2.21305,1.01307,0.785067>,<-3,1.01345,0.784876>}
+	texture{t1}
+}
+union{
+	cylinder{<-3,1.7724,1.22733>,<-2.43335,1.77236,1.22761>,r}
+	sphere{<-2.43335,1.77236,1.22761>,r}
+	cylinder{<-2.43335,1.77236,1.22761>,<-2.04673,1.29629,0.950267>,r}
+	sphere{<-2.04673,1.29629,0.950267>,r}
+	cylinder{<-2.04673,1.29629,0.950267>,<-2.21305,1.01307,0.785067>,r}
+	sphere{<-2.21305,1.01307,0.785067>,r}
+	cylinder{<-2.21305,1.01307,0.785067>,<-3,1.01345,0.784876>,r}
+	sphere{<-3,1.01345,0.784876>,r}
+	cylinder{<-3,1.01345,0.784876>,<-3,1.7724,1.22733>,r}
+	sphere{<-3,1.7724,1.22733>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.93514,2.19196,1.50044>,<-2.42486,1.77115,1.24275>,<-2.43335,1.77236,1.22761>}
+	triangle{<-1.93514,2.19196,1.50044>,<-2.43335,1.77236,1.22761>,<-2.39614,2.00613,0.993753>}
+	triangle{<-1.93514,2.19196,1.50044>,<-2.39614,2.00613,0.993753>,<-1.84929,2.62433,1.09525>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.93514,2.19196,1.50044>,<-2.42486,1.77115,1.24275>,r}
+	sphere{<-2.42486,1.77115,1.24275>,r}
+	cylinder{<-2.42486,1.77115,1.24275>,<-2.43335,1.77236,1.22761>,r}
+	sphere{<-2.43335,1.77236,1.22761>,r}
+	cylinder{<-2.43335,1.77236,1.22761>,<-2.39614,2.00613,0.993753>,r}
+	sphere{<-2.39614,2.00613,0.993753>,r}
+	cylinder{<-2.39614,2.00613,0.993753>,<-1.84929,2.62433,1.09525>,r}
+	sphere{<-1.84929,2.62433,1.09525>,r}
+	cylinder{<-1.84929,2.62433,1.09525>,<-1.93514,2.19196,1.50044>,r}
+	sphere{<-1.93514,2.19196,1.50044>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.93514,2.19196,1.50044>,<-1.4456,1.82018,1.62099>,<-1.45609,1.6729,1.59156>}
+	triangle{<-1.93514,2.19196,1.50044>,<-1.45609,1.6729,1.59156>,<-1.98744,1.41396,1.34614>}
+	triangle{<-1.93514,2.19196,1.50044>,<-1.98744,1.41396,1.34614>,<-2.42486,1.77115,1.24275>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.93514,2.19196,1.50044>,<-1.4456,1.82018,1.62099>,r}
+	sphere{<-1.4456,1.82018,1.62099>,r}
+	cylinder{<-1.4456,1.82018,1.62099>,<-1.45609,1.6729,1.59156>,r}
+	sphere{<-1.45609,1.6729,1.59156>,r}
+	cylinder{<-1.45609,1.6729,1.59156>,<-1.98744,1.41396,1.34614>,r}
+	sphere{<-1.98744,1.41396,1.34614>,r}
+	cylinder{<-1.98744,1.41396,1.34614>,<-2.42486,1.77115,1.24275>,r}
+	sphere{<-2.42486,1.77115,1.24275>,r}
+	cylinder{<-2.42486,1.77115,1.24275>,<-1.93514,2.19196,1.50044>,r}
+	sphere{<-1.93514,2.19196,1.50044>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.42486,1.77115,1.24275>,<-1.98744,1.41396,1.34614>,<-1.95132,1.25031,1.04624>}
+	triangle{<-2.42486,1.77115,1.24275>,<-1.95132,1.25031,1.04624>,<-2.04673,1.29629,0.950267>}
+	triangle{<-2.42486,1.77115,1.24275>,<-2.04673,1.29629,0.950267>,<-2.43335,1.77236,1.22761>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.42486,1.77115,1.24275>,<-1.98744,1.41396,1.34614>,r}
+	sphere{<-1.98744,1.41396,1.34614>,r}
+	cylinder{<-1.98744,1.41396,1.34614>,<-1.95132,1.25031,1.04624>,r}
+	sphere{<-1.95132,1.25031,1.04624>,r}
+	cylinder{<-1.95132,1.25031,1.04624>,<-2.04673,1.29629,0.950267>,r}
+	sphere{<-2.04673,1.29629,0.950267>,r}
+	cylinder{<-2.04673,1.29629,0.950267>,<-2.43335,1.77236,1.22761>,r}
+	sphere{<-2.43335,1.77236,1.22761>,r}
+	cylinder{<-2.43335,1.77236,1.22761>,<-2.42486,1.77115,1.24275>,r}
+	sphere{<-2.42486,1.77115,1.24275>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.03722,2.40217,1.98266>,<-2.03726,3,1.98318>,<-1.84923,3,1.09521>}
+	triangle{<-2.03722,2.40217,1.98266>,<-1.84923,3,1.09521>,<-1.84929,2.62433,1.09525>}
+	triangle{<-2.03722,2.40217,1.98266>,<-1.84929,2.62433,1.09525>,<-1.93514,2.19196,1.50044>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.03722,2.40217,1.98266>,<-2.03726,3,1.98318>,r}
+	sphere{<-2.03726,3,1.98318>,r}
+	cylinder{<-2.03726,3,1.98318>,<-1.84923,3,1.09521>,r}
+	sphere{<-1.84923,3,1.09521>,r}
+	cylinder{<-1.84923,3,1.09521>,<-1.84929,2.62433,1.09525>,r}
+	sphere{<-1.84929,2.62433,1.09525>,r}
+	cylinder{<-1.84929,2.62433,1.09525>,<-1.93514,2.19196,1.50044>,r}
+	sphere{<-1.93514,2.19196,1.50044>,r}
+	cylinder{<-1.93514,2.19196,1.50044>,<-2.03722,2.40217,1.98266>,r}
+	sphere{<-2.03722,2.40217,1.98266>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.0847446,1.76936,0>,<-0.0842946,1.76898,0.753389>,<0.180503,2.05174,0.935062>}
+	triangle{<-0.0847446,1.76936,0>,<0.180503,2.05174,0.935062>,<0.642002,2.54541,0.494318>}
+	triangle{<-0.0847446,1.76936,0>,<0.642002,2.54541,0.494318>,<0.64196,2.54593,0>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.0847446,1.76936,0>,<-0.0842946,1.76898,0.753389>,r}
+	sphere{<-0.0842946,1.76898,0.753389>,r}
+	cylinder{<-0.0842946,1.76898,0.753389>,<0.180503,2.05174,0.935062>,r}
+	sphere{<0.180503,2.05174,0.935062>,r}
+	cylinder{<0.180503,2.05174,0.935062>,<0.642002,2.54541,0.494318>,r}
+	sphere{<0.642002,2.54541,0.494318>,r}
+	cylinder{<0.642002,2.54541,0.494318>,<0.64196,2.54593,0>,r}
+	sphere{<0.64196,2.54593,0>,r}
+	cylinder{<0.64196,2.54593,0>,<-0.0847446,1.76936,0>,r}
+	sphere{<-0.0847446,1.76936,0>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.0847446,1.76936,0>,<-0.590316,2.11432,0>,<-0.590355,2.11428,0.628044>}
+	triangle{<-0.0847446,1.76936,0>,<-0.590355,2.11428,0.628044>,<-0.105826,1.78367,0.777611>}
+	triangle{<-0.0847446,1.76936,0>,<-0.105826,1.78367,0.777611>,<-0.0842946,1.76898,0.753389>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.0847446,1.76936,0>,<-0.590316,2.11432,0>,r}
+	sphere{<-0.590316,2.11432,0>,r}
+	cylinder{<-0.590316,2.11432,0>,<-0.590355,2.11428,0.628044>,r}
+	sphere{<-0.590355,2.11428,0.628044>,r}
+	cylinder{<-0.590355,2.11428,0.628044>,<-0.105826,1.78367,0.777611>,r}
+	sphere{<-0.105826,1.78367,0.777611>,r}
+	cylinder{<-0.105826,1.78367,0.777611>,<-0.0842946,1.76898,0.753389>,r}
+	sphere{<-0.0842946,1.76898,0.753389>,r}
+	cylinder{<-0.0842946,1.76898,0.753389>,<-0.0847446,1.76936,0>,r}
+	sphere{<-0.0847446,1.76936,0>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.590328,3,1.06961>,<-0.821869,3,1.21971>,<-1.20777,2.29467,1.11824>}
+	triangle{<-0.590328,3,1.06961>,<-1.20777,2.29467,1.11824>,<-1.07003,1.95698,0.860582>}
+	triangle{<-0.590328,3,1.06961>,<-1.07003,1.95698,0.860582>,<-0.590355,2.11428,0.628044>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.590328,3,1.06961>,<-0.821869,3,1.21971>,r}
+	sphere{<-0.821869,3,1.21971>,r}
+	cylinder{<-0.821869,3,1.21971>,<-1.20777,2.29467,1.11824>,r}
+	sphere{<-1.20777,2.29467,1.11824>,r}
+	cylinder{<-1.20777,2.29467,1.11824>,<-1.07003,1.95698,0.860582>,r}
+	sphere{<-1.07003,1.95698,0.860582>,r}
+	cylinder{<-1.07003,1.95698,0.860582>,<-0.590355,2.11428,0.628044>,r}
+	sphere{<-0.590355,2.11428,0.628044>,r}
+	cylinder{<-0.590355,2.11428,0.628044>,<-0.590328,3,1.06961>,r}
+	sphere{<-0.590328,3,1.06961>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.11753,1.60278,1.33726>,<-1.06555,1.53198,1.19335>,<-1.07003,1.95698,0.860582>}
+	triangle{<-1.11753,1.60278,1.33726>,<-1.07003,1.95698,0.860582>,<-1.20777,2.29467,1.11824>}
+	triangle{<-1.11753,1.60278,1.33726>,<-1.20777,2.29467,1.11824>,<-1.21165,1.88255,1.47292>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.11753,1.60278,1.33726>,<-1.06555,1.53198,1.19335>,r}
+	sphere{<-1.06555,1.53198,1.19335>,r}
+	cylinder{<-1.06555,1.53198,1.19335>,<-1.07003,1.95698,0.860582>,r}
+	sphere{<-1.07003,1.95698,0.860582>,r}
+	cylinder{<-1.07003,1.95698,0.860582>,<-1.20777,2.29467,1.11824>,r}
+	sphere{<-1.20777,2.29467,1.11824>,r}
+	cylinder{<-1.20777,2.29467,1.11824>,<-1.21165,1.88255,1.47292>,r}
+	sphere{<-1.21165,1.88255,1.47292>,r}
+	cylinder{<-1.21165,1.88255,1.47292>,<-1.11753,1.60278,1.33726>,r}
+	sphere{<-1.11753,1.60278,1.33726>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.590316,2.11432,5.55112e-17>,<-1.51755,1.81026,-5.55112e-17>,<-1.51756,1.81025,0.111117>}
+	triangle{<-0.590316,2.11432,5.55112e-17>,<-1.51756,1.81025,0.111117>,<-1.07003,1.95698,0.860582>}
+	triangle{<-0.590316,2.11432,5.55112e-17>,<-1.07003,1.95698,0.860582>,<-0.590355,2.11428,0.628044>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.590316,2.11432,5.55112e-17>,<-1.51755,1.81026,-5.55112e-17>,r}
+	sphere{<-1.51755,1.81026,-5.55112e-17>,r}
+	cylinder{<-1.51755,1.81026,-5.55112e-17>,<-1.51756,1.81025,0.111117>,r}
+	sphere{<-1.51756,1.81025,0.111117>,r}
+	cylinder{<-1.51756,1.81025,0.111117>,<-1.07003,1.95698,0.860582>,r}
+	sphere{<-1.07003,1.95698,0.860582>,r}
+	cylinder{<-1.07003,1.95698,0.860582>,<-0.590355,2.11428,0.628044>,r}
+	sphere{<-0.590355,2.11428,0.628044>,r}
+	cylinder{<-0.590355,2.11428,0.628044>,<-0.590316,2.11432,5.55112e-17>,r}
+	sphere{<-0.590316,2.11432,5.55112e-17>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.0608504,1.66131,0.733303>,<-0.061112,1.66087,0>,<-0.462868,1.00548,0>}
+	triangle{<-0.0608504,1.66131,0.733303>,<-0.462868,1.00548,0>,<-0.462862,1.00551,0.719907>}
+	triangle{<-0.0608504,1.66131,0.733303>,<-0.462862,1.00551,0.719907>,<-0.198477,1.4368,0.909974>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.0608504,1.66131,0.733303>,<-0.061112,1.66087,0>,r}
+	sphere{<-0.061112,1.66087,0>,r}
+	cylinder{<-0.061112,1.66087,0>,<-0.462868,1.00548,0>,r}
+	sphere{<-0.462868,1.00548,0>,r}
+	cylinder{<-0.462868,1.00548,0>,<-0.462862,1.00551,0.719907>,r}
+	sphere{<-0.462862,1.00551,0.719907>,r}
+	cylinder{<-0.462862,1.00551,0.719907>,<-0.198477,1.4368,0.909974>,r}
+	sphere{<-0.198477,1.4368,0.909974>,r}
+	cylinder{<-0.198477,1.4368,0.909974>,<-0.0608504,1.66131,0.733303>,r}
+	sphere{<-0.0608504,1.66131,0.733303>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.0608504,1.66131,0.733303>,<-0.198477,1.4368,0.909974>,<-0.285067,1.54747,1.00385>}
+	triangle{<-0.0608504,1.66131,0.733303>,<-0.285067,1.54747,1.00385>,<-0.105826,1.78367,0.777611>}
+	triangle{<-0.0608504,1.66131,0.733303>,<-0.105826,1.78367,0.777611>,<-0.0842946,1.76898,0.753389>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.0608504,1.66131,0.733303>,<-0.198477,1.4368,0.909974>,r}
+	sphere{<-0.198477,1.4368,0.909974>,r}
+	cylinder{<-0.198477,1.4368,0.909974>,<-0.285067,1.54747,1.00385>,r}
+	sphere{<-0.285067,1.54747,1.00385>,r}
+	cylinder{<-0.285067,1.54747,1.00385>,<-0.105826,1.78367,0.777611>,r}
+	sphere{<-0.105826,1.78367,0.777611>,r}
+	cylinder{<-0.105826,1.78367,0.777611>,<-0.0842946,1.76898,0.753389>,r}
+	sphere{<-0.0842946,1.76898,0.753389>,r}
+	cylinder{<-0.0842946,1.76898,0.753389>,<-0.0608504,1.66131,0.733303>,r}
+	sphere{<-0.0608504,1.66131,0.733303>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.953845,1.03624,0>,<0.478631,1.3294,0.85594>,<0.919402,1.68315,1.12648>}
+	triangle{<0.953845,1.03624,0>,<0.919402,1.68315,1.12648>,<1.18734,1.72908,1.00323>}
+	triangle{<0.953845,1.03624,0>,<1.18734,1.72908,1.00323>,<1.02276,1.06669,0>}
+	texture{t1}
+}
+union{
+	cylinder{<0.953845,1.03624,0>,<0.478631,1.3294,0.85594>,r}
+	sphere{<0.478631,1.3294,0.85594>,r}
+	cylinder{<0.478631,1.3294,0.85594>,<0.919402,1.68315,1.12648>,r}
+	sphere{<0.919402,1.68315,1.12648>,r}
+	cylinder{<0.919402,1.68315,1.12648>,<1.18734,1.72908,1.00323>,r}
+	sphere{<1.18734,1.72908,1.00323>,r}
+	cylinder{<1.18734,1.72908,1.00323>,<1.02276,1.06669,0>,r}
+	sphere{<1.02276,1.06669,0>,r}
+	cylinder{<1.02276,1.06669,0>,<0.953845,1.03624,0>,r}
+	sphere{<0.953845,1.03624,0>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.64196,2.54593,0>,<1.23509,1.91745,0>,<1.23434,1.91731,0.971534>}
+	triangle{<0.64196,2.54593,0>,<1.23434,1.91731,0.971534>,<1.12858,2.02933,1.01291>}
+	triangle{<0.64196,2.54593,0>,<1.12858,2.02933,1.01291>,<0.642002,2.54541,0.494318>}
+	texture{t1}
+}
+union{
+	cylinder{<0.64196,2.54593,0>,<1.23509,1.91745,0>,r}
+	sphere{<1.23509,1.91745,0>,r}
+	cylinder{<1.23509,1.91745,0>,<1.23434,1.91731,0.971534>,r}
+	sphere{<1.23434,1.91731,0.971534>,r}
+	cylinder{<1.23434,1.91731,0.971534>,<1.12858,2.02933,1.01291>,r}
+	sphere{<1.12858,2.02933,1.01291>,r}
+	cylinder{<1.12858,2.02933,1.01291>,<0.642002,2.54541,0.494318>,r}
+	sphere{<0.642002,2.54541,0.494318>,r}
+	cylinder{<0.642002,2.54541,0.494318>,<0.64196,2.54593,0>,r}
+	sphere{<0.64196,2.54593,0>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.18734,1.72908,1.00323>,<0.919402,1.68315,1.12648>,<0.847338,1.86862,1.14856>}
+	triangle{<1.18734,1.72908,1.00323>,<0.847338,1.86862,1.14856>,<1.12858,2.02933,1.01291>}
+	triangle{<1.18734,1.72908,1.00323>,<1.12858,2.02933,1.01291>,<1.23434,1.91731,0.971534>}
+	texture{t1}
+}
+union{
+	cylinder{<1.18734,1.72908,1.00323>,<0.919402,1.68315,1.12648>,r}
+	sphere{<0.919402,1.68315,1.12648>,r}
+	cylinder{<0.919402,1.68315,1.12648>,<0.847338,1.86862,1.14856>,r}
+	sphere{<0.847338,1.86862,1.14856>,r}
+	cylinder{<0.847338,1.86862,1.14856>,<1.12858,2.02933,1.01291>,r}
+	sphere{<1.12858,2.02933,1.01291>,r}
+	cylinder{<1.12858,2.02933,1.01291>,<1.23434,1.91731,0.971534>,r}
+	sphere{<1.23434,1.91731,0.971534>,r}
+	cylinder{<1.23434,1.91731,0.971534>,<1.18734,1.72908,1.00323>,r}
+	sphere{<1.18734,1.72908,1.00323>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.23509,1.91745,5.55112e-17>,<1.23434,1.91731,0.971534>,<1.46236,1.99741,1.04346>}
+	triangle{<1.23509,1.91745,5.55112e-17>,<1.46236,1.99741,1.04346>,<1.93586,2.16367,0.721027>}
+	triangle{<1.23509,1.91745,5.55112e-17>,<1.93586,2.16367,0.721027>,<1.93593,2.1636,0>}
+	texture{t1}
+}
+union{
+	cylinder{<1.23509,1.91745,5.55112e-17>,<1.23434,1.91731,0.971534>,r}
+	sphere{<1.23434,1.91731,0.971534>,r}
+	cylinder{<1.23434,1.91731,0.971534>,<1.46236,1.99741,1.04346>,r}
+	sphere{<1.46236,1.99741,1.04346>,r}
+	cylinder{<1.46236,1.99741,1.04346>,<1.93586,2.16367,0.721027>,r}
+	sphere{<1.93586,2.16367,0.721027>,r}
+	cylinder{<1.93586,2.16367,0.721027>,<1.93593,2.1636,0>,r}
+	sphere{<1.93593,2.1636,0>,r}
+	cylinder{<1.93593,2.1636,0>,<1.23509,1.91745,5.55112e-17>,r}
+	sphere{<1.23509,1.91745,5.55112e-17>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.641993,3,0.49378>,<1.27684,3,1.16961>,<1.27644,2.30175,1.17>}
+	triangle{<0.641993,3,0.49378>,<1.27644,2.30175,1.17>,<1.12858,2.02933,1.01291>}
+	triangle{<0.641993,3,0.49378>,<1.12858,2.02933,1.01291>,<0.642002,2.54541,0.494318>}
+	texture{t1}
+}
+union{
+	cylinder{<0.641993,3,0.49378>,<1.27684,3,1.16961>,r}
+	sphere{<1.27684,3,1.16961>,r}
+	cylinder{<1.27684,3,1.16961>,<1.27644,2.30175,1.17>,r}
+	sphere{<1.27644,2.30175,1.17>,r}
+	cylinder{<1.27644,2.30175,1.17>,<1.12858,2.02933,1.01291>,r}
+	sphere{<1.12858,2.02933,1.01291>,r}
+	cylinder{<1.12858,2.02933,1.01291>,<0.642002,2.54541,0.494318>,r}
+	sphere{<0.642002,2.54541,0.494318>,r}
+	cylinder{<0.642002,2.54541,0.494318>,<0.641993,3,0.49378>,r}
+	sphere{<0.641993,3,0.49378>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.27684,3,1.16961>,<1.93583,3,0.720905>,<1.93586,2.16367,0.721027>}
+	triangle{<1.27684,3,1.16961>,<1.93586,2.16367,0.721027>,<1.46236,1.99741,1.04346>}
+	triangle{<1.27684,3,1.16961>,<1.46236,1.99741,1.04346>,<1.27644,2.30175,1.17>}
+	texture{t1}
+}
+union{
+	cylinder{<1.27684,3,1.16961>,<1.93583,3,0.720905>,r}
+	sphere{<1.93583,3,0.720905>,r}
+	cylinder{<1.93583,3,0.720905>,<1.93586,2.16367,0.721027>,r}
+	sphere{<1.93586,2.16367,0.721027>,r}
+	cylinder{<1.93586,2.16367,0.721027>,<1.46236,1.99741,1.04346>,r}
+	sphere{<1.46236,1.99741,1.04346>,r}
+	cylinder{<1.46236,1.99741,1.04346>,<1.27644,2.30175,1.17>,r}
+	sphere{<1.27644,2.30175,1.17>,r}
+	cylinder{<1.27644,2.30175,1.17>,<1.27684,3,1.16961>,r}
+	sphere{<1.27684,3,1.16961>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.847338,1.86862,1.14856>,<0.180503,2.05174,0.935062>,<0.0600476,2.11391,1.04987>}
+	triangle{<0.847338,1.86862,1.14856>,<0.0600476,2.11391,1.04987>,<0.0519754,2.1873,1.42251>}
+	triangle{<0.847338,1.86862,1.14856>,<0.0519754,2.1873,1.42251>,<0.528229,2.10027,1.80567>}
+	texture{t1}
+}
+union{
+	cylinder{<0.847338,1.86862,1.14856>,<0.180503,2.05174,0.935062>,r}
+	sphere{<0.180503,2.05174,0.935062>,r}
+	cylinder{<0.180503,2.05174,0.935062>,<0.0600476,2.11391,1.04987>,r}
+	sphere{<0.0600476,2.11391,1.04987>,r}
+	cylinder{<0.0600476,2.11391,1.04987>,<0.0519754,2.1873,1.42251>,r}
+	sphere{<0.0519754,2.1873,1.42251>,r}
+	cylinder{<0.0519754,2.1873,1.42251>,<0.528229,2.10027,1.80567>,r}
+	sphere{<0.528229,2.10027,1.80567>,r}
+	cylinder{<0.528229,2.10027,1.80567>,<0.847338,1.86862,1.14856>,r}
+	sphere{<0.847338,1.86862,1.14856>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.0822352,0.977396,1.61574>,<0.25591,0.975584,1.69301>,<0.545504,0.988944,1.41241>}
+	triangle{<0.0822352,0.977396,1.61574>,<0.545504,0.988944,1.41241>,<0.365591,1.00018,1.09846>}
+	triangle{<0.0822352,0.977396,1.61574>,<0.365591,1.00018,1.09846>,<0.102157,0.996166,1.15028>}
+	texture{t1}
+}
+union{
+	cylinder{<0.0822352,0.977396,1.61574>,<0.25591,0.975584,1.69301>,r}
+	sphere{<0.25591,0.975584,1.69301>,r}
+	cylinder{<0.25591,0.975584,1.69301>,<0.545504,0.988944,1.41241>,r}
+	sphere{<0.545504,0.988944,1.41241>,r}
+	cylinder{<0.545504,0.988944,1.41241>,<0.365591,1.00018,1.09846>,r}
+	sphere{<0.365591,1.00018,1.09846>,r}
+	cylinder{<0.365591,1.00018,1.09846>,<0.102157,0.996166,1.15028>,r}
+	sphere{<0.102157,0.996166,1.15028>,r}
+	cylinder{<0.102157,0.996166,1.15028>,<0.0822352,0.977396,1.61574>,r}
+	sphere{<0.0822352,0.977396,1.61574>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.530114,1.67331,2.15806>,<0.522273,1.67452,2.16064>,<0.338843,1.81532,2.14813>}
+	triangle{<0.530114,1.67331,2.15806>,<0.338843,1.81532,2.14813>,<0.509032,1.99565,1.95766>}
+	triangle{<0.530114,1.67331,2.15806>,<0.509032,1.99565,1.95766>,<0.549722,1.68002,2.14525>}
+	texture{t1}
+}
+union{
+	cylinder{<0.530114,1.67331,2.15806>,<0.522273,1.67452,2.16064>,r}
+	sphere{<0.522273,1.67452,2.16064>,r}
+	cylinder{<0.522273,1.67452,2.16064>,<0.338843,1.81532,2.14813>,r}
+	sphere{<0.338843,1.81532,2.14813>,r}
+	cylinder{<0.338843,1.81532,2.14813>,<0.509032,1.99565,1.95766>,r}
+	sphere{<0.509032,1.99565,1.95766>,r}
+	cylinder{<0.509032,1.99565,1.95766>,<0.549722,1.68002,2.14525>,r}
+	sphere{<0.549722,1.68002,2.14525>,r}
+	cylinder{<0.549722,1.68002,2.14525>,<0.530114,1.67331,2.15806>,r}
+	sphere{<0.530114,1.67331,2.15806>,r}
+	texture{t2}
+}
+union{
+	triangle{<3,1.32553,1.68729>,<2.46318,1.3254,1.68724>,<1.97423,1.82567,1.59266>}
+	triangle{<3,1.32553,1.68729>,<1.97423,1.82567,1.59266>,<2.9997,2.59484,1.44747>}
+	triangle{<3,1.32553,1.68729>,<2.9997,2.59484,1.44747>,<3,2.59484,1.44747>}
+	texture{t1}
+}
+union{
+	cylinder{<3,1.32553,1.68729>,<2.46318,1.3254,1.68724>,r}
+	sphere{<2.46318,1.3254,1.68724>,r}
+	cylinder{<2.46318,1.3254,1.68724>,<1.97423,1.82567,1.59266>,r}
+	sphere{<1.97423,1.82567,1.59266>,r}
+	cylinder{<1.97423,1.82567,1.59266>,<2.9997,2.59484,1.44747>,r}
+	sphere{<2.9997,2.59484,1.44747>,r}
+	cylinder{<2.9997,2.59484,1.44747>,<3,2.59484,1.44747>,r}
+	sphere{<3,2.59484,1.44747>,r}
+	cylinder{<3,2.59484,1.44747>,<3,1.32553,1.68729>,r}
+	sphere{<3,1.32553,1.68729>,r}
+	texture{t2}
+}
+union{
+	triangle{<3,1.70543,0.282236>,<2.4857,1.70533,0.282835>,<2.08597,1.20835,0.933989>}
+	triangle{<3,1.70543,0.282236>,<2.08597,1.20835,0.933989>,<2.36795,1.04118,1.15264>}
+	triangle{<3,1.70543,0.282236>,<2.36795,1.04118,1.15264>,<3,1.04104,1.15223>}
+	texture{t1}
+}
+union{
+	cylinder{<3,1.70543,0.282236>,<2.4857,1.70533,0.282835>,r}
+	sphere{<2.4857,1.70533,0.282835>,r}
+	cylinder{<2.4857,1.70533,0.282835>,<2.08597,1.20835,0.933989>,r}
+	sphere{<2.08597,1.20835,0.933989>,r}
+	cylinder{<2.08597,1.20835,0.933989>,<2.36795,1.04118,1.15264>,r}
+	sphere{<2.36795,1.04118,1.15264>,r}
+	cylinder{<2.36795,1.04118,1.15264>,<3,1.04104,1.15223>,r}
+	sphere{<3,1.04104,1.15223>,r}
+	cylinder{<3,1.04104,1.15223>,<3,1.70543,0.282236>,r}
+	sphere{<3,1.70543,0.282236>,r}
+	texture{t2}
+}
+union{
+	triangle{<3,1.70543,0.282236>,<3,2.59484,1.44747>,<2.9997,2.59484,1.44747>}
+	triangle{<3,1.70543,0.282236>,<2.9997,2.59484,1.44747>,<2.02764,2.08717,0.783716>}
+	triangle{<3,1.70543,0.282236>,<2.02764,2.08717,0.783716>,<2.4857,1.70533,0.282835>}
+	texture{t1}
+}
+union{
+	cylinder{<3,1.70543,0.282236>,<3,2.59484,1.44747>,r}
+	sphere{<3,2.59484,1.44747>,r}
+	cylinder{<3,2.59484,1.44747>,<2.9997,2.59484,1.44747>,r}
+	sphere{<2.9997,2.59484,1.44747>,r}
+	cylinder{<2.9997,2.59484,1.44747>,<2.02764,2.08717,0.783716>,r}
+	sphere{<2.02764,2.08717,0.783716>,r}
+	cylinder{<2.02764,2.08717,0.783716>,<2.4857,1.70533,0.282835>,r}
+	sphere{<2.4857,1.70533,0.282835>,r}
+	cylinder{<2.4857,1.70533,0.282835>,<3,1.70543,0.282236>,r}
+	sphere{<3,1.70543,0.282236>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.4857,1.70533,0.282835>,<2.48567,1.70535,0>,<1.93593,2.1636,0>}
+	triangle{<2.4857,1.70533,0.282835>,<1.93593,2.1636,0>,<1.93586,2.16367,0.721027>}
+	triangle{<2.4857,1.70533,0.282835>,<1.93586,2.16367,0.721027>,<2.02764,2.08717,0.783716>}
+	texture{t1}
+}
+union{
+	cylinder{<2.4857,1.70533,0.282835>,<2.48567,1.70535,0>,r}
+	sphere{<2.48567,1.70535,0>,r}
+	cylinder{<2.48567,1.70535,0>,<1.93593,2.1636,0>,r}
+	sphere{<1.93593,2.1636,0>,r}
+	cylinder{<1.93593,2.1636,0>,<1.93586,2.16367,0.721027>,r}
+	sphere{<1.93586,2.16367,0.721027>,r}
+	cylinder{<1.93586,2.16367,0.721027>,<2.02764,2.08717,0.783716>,r}
+	sphere{<2.02764,2.08717,0.783716>,r}
+	cylinder{<2.02764,2.08717,0.783716>,<2.4857,1.70533,0.282835>,r}
+	sphere{<2.4857,1.70533,0.282835>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.46236,1.99741,1.04346>,<1.73137,1.7874,1.21081>,<1.41906,1.55179,1.14641>}
+	triangle{<1.46236,1.99741,1.04346>,<1.41906,1.55179,1.14641>,<1.18734,1.72908,1.00323>}
+	triangle{<1.46236,1.99741,1.04346>,<1.18734,1.72908,1.00323>,<1.23434,1.91731,0.971534>}
+	texture{t1}
+}
+union{
+	cylinder{<1.46236,1.99741,1.04346>,<1.73137,1.7874,1.21081>,r}
+	sphere{<1.73137,1.7874,1.21081>,r}
+	cylinder{<1.73137,1.7874,1.21081>,<1.41906,1.55179,1.14641>,r}
+	sphere{<1.41906,1.55179,1.14641>,r}
+	cylinder{<1.41906,1.55179,1.14641>,<1.18734,1.72908,1.00323>,r}
+	sphere{<1.18734,1.72908,1.00323>,r}
+	cylinder{<1.18734,1.72908,1.00323>,<1.23434,1.91731,0.971534>,r}
+	sphere{<1.23434,1.91731,0.971534>,r}
+	cylinder{<1.23434,1.91731,0.971534>,<1.46236,1.99741,1.04346>,r}
+	sphere{<1.46236,1.99741,1.04346>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.46236,1.99741,1.04346>,<1.93586,2.16367,0.721027>,<2.02764,2.08717,0.783716>}
+	triangle{<1.46236,1.99741,1.04346>,<2.02764,2.08717,0.783716>,<1.76488,1.78374,1.20575>}
+	triangle{<1.46236,1.99741,1.04346>,<1.76488,1.78374,1.20575>,<1.73137,1.7874,1.21081>}
+	texture{t1}
+}
+union{
+	cylinder{<1.46236,1.99741,1.04346>,<1.93586,2.16367,0.721027>,r}
+	sphere{<1.93586,2.16367,0.721027>,r}
+	cylinder{<1.93586,2.16367,0.721027>,<2.02764,2.08717,0.783716>,r}
+	sphere{<2.02764,2.08717,0.783716>,r}
+	cylinder{<2.02764,2.08717,0.783716>,<1.76488,1.78374,1.20575>,r}
+	sphere{<1.76488,1.78374,1.20575>,r}
+	cylinder{<1.76488,1.78374,1.20575>,<1.73137,1.7874,1.21081>,r}
+	sphere{<1.73137,1.7874,1.21081>,r}
+	cylinder{<1.73137,1.7874,1.21081>,<1.46236,1.99741,1.04346>,r}
+	sphere{<1.46236,1.99741,1.04346>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.06662,1.00942,-5.55112e-17>,<1.02276,1.06669,-5.55112e-17>,<1.18734,1.72908,1.00323>}
+	triangle{<1.06662,1.00942,-5.55112e-17>,<1.18734,1.72908,1.00323>,<1.41906,1.55179,1.14641>}
+	triangle{<1.06662,1.00942,-5.55112e-17>,<1.41906,1.55179,1.14641>,<1.68884,0.961273,0.873814>}
+	texture{t1}
+}
+union{
+	cylinder{<1.06662,1.00942,-5.55112e-17>,<1.02276,1.06669,-5.55112e-17>,r}
+	sphere{<1.02276,1.06669,-5.55112e-17>,r}
+	cylinder{<1.02276,1.06669,-5.55112e-17>,<1.18734,1.72908,1.00323>,r}
+	sphere{<1.18734,1.72908,1.00323>,r}
+	cylinder{<1.18734,1.72908,1.00323>,<1.41906,1.55179,1.14641>,r}
+	sphere{<1.41906,1.55179,1.14641>,r}
+	cylinder{<1.41906,1.55179,1.14641>,<1.68884,0.961273,0.873814>,r}
+	sphere{<1.68884,0.961273,0.873814>,r}
+	cylinder{<1.68884,0.961273,0.873814>,<1.06662,1.00942,-5.55112e-17>,r}
+	sphere{<1.06662,1.00942,-5.55112e-17>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.66869,3,1.98388>,<2.66858,2.95941,1.98386>,<1.8733,2.02158,1.82387>}
+	triangle{<2.66869,3,1.98388>,<1.8733,2.02158,1.82387>,<1.23616,2.69518,1.69558>}
+	triangle{<2.66869,3,1.98388>,<1.23616,2.69518,1.69558>,<1.23632,3,1.69559>}
+	texture{t1}
+}
+union{
+	cylinder{<2.66869,3,1.98388>,<2.66858,2.95941,1.98386>,r}
+	sphere{<2.66858,2.95941,1.98386>,r}
+	cylinder{<2.66858,2.95941,1.98386>,<1.8733,2.02158,1.82387>,r}
+	sphere{<1.8733,2.02158,1.82387>,r}
+	cylinder{<1.8733,2.02158,1.82387>,<1.23616,2.69518,1.69558>,r}
+	sphere{<1.23616,2.69518,1.69558>,r}
+	cylinder{<1.23616,2.69518,1.69558>,<1.23632,3,1.69559>,r}
+	sphere{<1.23632,3,1.69559>,r}
+	cylinder{<1.23632,3,1.69559>,<2.66869,3,1.98388>,r}
+	sphere{<2.66869,3,1.98388>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.99491,-2.00716,2.17772>,<-1.9784,-2.04551,2.47097>,<-3,-2.04523,2.47085>}
+	triangle{<-1.99491,-2.00716,2.17772>,<-3,-2.04523,2.47085>,<-3,-1.93596,1.63512>}
+	triangle{<-1.99491,-2.00716,2.17772>,<-3,-1.93596,1.63512>,<-2.02205,-1.98735,2.02622>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.99491,-2.00716,2.17772>,<-1.9784,-2.04551,2.47097>,r}
+	sphere{<-1.9784,-2.04551,2.47097>,r}
+	cylinder{<-1.9784,-2.04551,2.47097>,<-3,-2.04523,2.47085>,r}
+	sphere{<-3,-2.04523,2.47085>,r}
+	cylinder{<-3,-2.04523,2.47085>,<-3,-1.93596,1.63512>,r}
+	sphere{<-3,-1.93596,1.63512>,r}
+	cylinder{<-3,-1.93596,1.63512>,<-2.02205,-1.98735,2.02622>,r}
+	sphere{<-2.02205,-1.98735,2.02622>,r}
+	cylinder{<-2.02205,-1.98735,2.02622>,<-1.99491,-2.00716,2.17772>,r}
+	sphere{<-1.99491,-2.00716,2.17772>,r}
+	texture{t2}
+}
+union{
+	triangle{<-3,-3,2.78174>,<-3,-2.04523,2.47085>,<-1.9784,-2.04551,2.47097>}
+	triangle{<-3,-3,2.78174>,<-1.9784,-2.04551,2.47097>,<-1.97592,-2.18051,2.51493>}
+	triangle{<-3,-3,2.78174>,<-1.97592,-2.18051,2.51493>,<-2.24065,-3,2.78176>}
+	texture{t1}
+}
+union{
+	cylinder{<-3,-3,2.78174>,<-3,-2.04523,2.47085>,r}
+	sphere{<-3,-2.04523,2.47085>,r}
+	cylinder{<-3,-2.04523,2.47085>,<-1.9784,-2.04551,2.47097>,r}
+	sphere{<-1.9784,-2.04551,2.47097>,r}
+	cylinder{<-1.9784,-2.04551,2.47097>,<-1.97592,-2.18051,2.51493>,r}
+	sphere{<-1.97592,-2.18051,2.51493>,r}
+	cylinder{<-1.97592,-2.18051,2.51493>,<-2.24065,-3,2.78176>,r}
+	sphere{<-2.24065,-3,2.78176>,r}
+	cylinder{<-2.24065,-3,2.78176>,<-3,-3,2.78174>,r}
+	sphere{<-3,-3,2.78174>,r}
+	texture{t2}
+}
+union{
+	triangle{<-3,-0.837926,2.74867>,<-3,-0.771611,2.08509>,<-2.42076,-0.77158,2.08509>}
+	triangle{<-3,-0.837926,2.74867>,<-2.42076,-0.77158,2.08509>,<-2.39068,-0.776077,2.1301>}
+	triangle{<-3,-0.837926,2.74867>,<-2.39068,-0.776077,2.1301>,<-2.93346,-0.837923,2.74867>}
+	texture{t1}
+}
+union{
+	cylinder{<-3,-0.837926,2.74867>,<-3,-0.771611,2.08509>,r}
+	sphere{<-3,-0.771611,2.08509>,r}
+	cylinder{<-3,-0.771611,2.08509>,<-2.42076,-0.77158,2.08509>,r}
+	sphere{<-2.42076,-0.77158,2.08509>,r}
+	cylinder{<-2.42076,-0.77158,2.08509>,<-2.39068,-0.776077,2.1301>,r}
+	sphere{<-2.39068,-0.776077,2.1301>,r}
+	cylinder{<-2.39068,-0.776077,2.1301>,<-2.93346,-0.837923,2.74867>,r}
+	sphere{<-2.93346,-0.837923,2.74867>,r}
+	cylinder{<-2.93346,-0.837923,2.74867>,<-3,-0.837926,2.74867>,r}
+	sphere{<-3,-0.837926,2.74867>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.0348803,-1.94883,1.83174>,<-0.641057,-2.96745,2.09053>,<-0.661023,-2.99011,2.23396>}
+	triangle{<-0.0348803,-1.94883,1.83174>,<-0.661023,-2.99011,2.23396>,<-0.167035,-2.10622,2.68967>}
+	triangle{<-0.0348803,-1.94883,1.83174>,<-0.167035,-2.10622,2.68967>,<0.0276185,-1.83382,1.92878>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.0348803,-1.94883,1.83174>,<-0.641057,-2.96745,2.09053>,r}
+	sphere{<-0.641057,-2.96745,2.09053>,r}
+	cylinder{<-0.641057,-2.96745,2.09053>,<-0.661023,-2.99011,2.23396>,r}
+	sphere{<-0.661023,-2.99011,2.23396>,r}
+	cylinder{<-0.661023,-2.99011,2.23396>,<-0.167035,-2.10622,2.68967>,r}
+	sphere{<-0.167035,-2.10622,2.68967>,r}
+	cylinder{<-0.167035,-2.10622,2.68967>,<0.0276185,-1.83382,1.92878>,r}
+	sphere{<0.0276185,-1.83382,1.92878>,r}
+	cylinder{<0.0276185,-1.83382,1.92878>,<-0.0348803,-1.94883,1.83174>,r}
+	sphere{<-0.0348803,-1.94883,1.83174>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.0276185,-1.83382,1.92878>,<-0.167035,-2.10622,2.68967>,<-0.439112,-1.75697,2.92938>}
+	triangle{<0.0276185,-1.83382,1.92878>,<-0.439112,-1.75697,2.92938>,<-0.439585,-1.48203,2.6202>}
+	triangle{<0.0276185,-1.83382,1.92878>,<-0.439585,-1.48203,2.6202>,<-0.0766957,-1.64786,1.96193>}
+	texture{t1}
+}
+union{
+	cylinder{<0.0276185,-1.83382,1.92878>,<-0.167035,-2.10622,2.68967>,r}
+	sphere{<-0.167035,-2.10622,2.68967>,r}
+	cylinder{<-0.167035,-2.10622,2.68967>,<-0.439112,-1.75697,2.92938>,r}
+	sphere{<-0.439112,-1.75697,2.92938>,r}
+	cylinder{<-0.439112,-1.75697,2.92938>,<-0.439585,-1.48203,2.6202>,r}
+	sphere{<-0.439585,-1.48203,2.6202>,r}
+	cylinder{<-0.439585,-1.48203,2.6202>,<-0.0766957,-1.64786,1.96193>,r}
+	sphere{<-0.0766957,-1.64786,1.96193>,r}
+	cylinder{<-0.0766957,-1.64786,1.96193>,<0.0276185,-1.83382,1.92878>,r}
+	sphere{<0.0276185,-1.83382,1.92878>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.689471,-1.05816,2.32747>,<0.26535,-1.12678,2.0523>,<0.221398,-1.05155,1.77509>}
+	triangle{<0.689471,-1.05816,2.32747>,<0.221398,-1.05155,1.77509>,<0.287898,-0.993533,1.67549>}
+	triangle{<0.689471,-1.05816,2.32747>,<0.287898,-0.993533,1.67549>,<0.712651,-0.890841,1.84848>}
+	texture{t1}
+}
+union{
+	cylinder{<0.689471,-1.05816,2.32747>,<0.26535,-1.12678,2.0523>,r}
+	sphere{<0.26535,-1.12678,2.0523>,r}
+	cylinder{<0.26535,-1.12678,2.0523>,<0.221398,-1.05155,1.77509>,r}
+	sphere{<0.221398,-1.05155,1.77509>,r}
+	cylinder{<0.221398,-1.05155,1.77509>,<0.287898,-0.993533,1.67549>,r}
+	sphere{<0.287898,-0.993533,1.67549>,r}
+	cylinder{<0.287898,-0.993533,1.67549>,<0.712651,-0.890841,1.84848>,r}
+	sphere{<0.712651,-0.890841,1.84848>,r}
+	cylinder{<0.712651,-0.890841,1.84848>,<0.689471,-1.05816,2.32747>,r}
+	sphere{<0.689471,-1.05816,2.32747>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.0808264,-1.83151,1.91715>,<0.70993,-2.00245,2.31908>,<0.781438,-2.17082,2.07702>}
+	triangle{<0.0808264,-1.83151,1.91715>,<0.781438,-2.17082,2.07702>,<0.271081,-2.05795,1.70111>}
+	triangle{<0.0808264,-1.83151,1.91715>,<0.271081,-2.05795,1.70111>,<0.183055,-1.98547,1.7387>}
+	texture{t1}
+}
+union{
+	cylinder{<0.0808264,-1.83151,1.91715>,<0.70993,-2.00245,2.31908>,r}
+	sphere{<0.70993,-2.00245,2.31908>,r}
+	cylinder{<0.70993,-2.00245,2.31908>,<0.781438,-2.17082,2.07702>,r}
+	sphere{<0.781438,-2.17082,2.07702>,r}
+	cylinder{<0.781438,-2.17082,2.07702>,<0.271081,-2.05795,1.70111>,r}
+	sphere{<0.271081,-2.05795,1.70111>,r}
+	cylinder{<0.271081,-2.05795,1.70111>,<0.183055,-1.98547,1.7387>,r}
+	sphere{<0.183055,-1.98547,1.7387>,r}
+	cylinder{<0.183055,-1.98547,1.7387>,<0.0808264,-1.83151,1.91715>,r}
+	sphere{<0.0808264,-1.83151,1.91715>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.781438,-2.17082,2.07702>,<0.70993,-2.00245,2.31908>,<0.996365,-1.73276,2.51003>}
+	triangle{<0.781438,-2.17082,2.07702>,<0.996365,-1.73276,2.51003>,<1.10256,-1.70346,2.49393>}
+	triangle{<0.781438,-2.17082,2.07702>,<1.10256,-1.70346,2.49393>,<1.0597,-2.13312,1.98681>}
+	texture{t1}
+}
+union{
+	cylinder{<0.781438,-2.17082,2.07702>,<0.70993,-2.00245,2.31908>,r}
+	sphere{<0.70993,-2.00245,2.31908>,r}
+	cylinder{<0.70993,-2.00245,2.31908>,<0.996365,-1.73276,2.51003>,r}
+	sphere{<0.996365,-1.73276,2.51003>,r}
+	cylinder{<0.996365,-1.73276,2.51003>,<1.10256,-1.70346,2.49393>,r}
+	sphere{<1.10256,-1.70346,2.49393>,r}
+	cylinder{<1.10256,-1.70346,2.49393>,<1.0597,-2.13312,1.98681>,r}
+	sphere{<1.0597,-2.13312,1.98681>,r}
+	cylinder{<1.0597,-2.13312,1.98681>,<0.781438,-2.17082,2.07702>,r}
+	sphere{<0.781438,-2.17082,2.07702>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.661023,-3,2.23396>,<-0.661023,-2.99011,2.23396>,<-0.167035,-2.10622,2.68967>}
+	triangle{<-0.661023,-3,2.23396>,<-0.167035,-2.10622,2.68967>,<-0.00577534,-2.16686,2.83849>}
+	triangle{<-0.661023,-3,2.23396>,<-0.00577534,-2.16686,2.83849>,<-0.00581297,-3,2.83856>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.661023,-3,2.23396>,<-0.661023,-2.99011,2.23396>,r}
+	sphere{<-0.661023,-2.99011,2.23396>,r}
+	cylinder{<-0.661023,-2.99011,2.23396>,<-0.167035,-2.10622,2.68967>,r}
+	sphere{<-0.167035,-2.10622,2.68967>,r}
+	cylinder{<-0.167035,-2.10622,2.68967>,<-0.00577534,-2.16686,2.83849>,r}
+	sphere{<-0.00577534,-2.16686,2.83849>,r}
+	cylinder{<-0.00577534,-2.16686,2.83849>,<-0.00581297,-3,2.83856>,r}
+	sphere{<-0.00581297,-3,2.83856>,r}
+	cylinder{<-0.00581297,-3,2.83856>,<-0.661023,-3,2.23396>,r}
+	sphere{<-0.661023,-3,2.23396>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.78382,-3,2.06892>,<0.59952,-3,2.69278>,<0.599552,-2.13566,2.6927>}
+	triangle{<0.78382,-3,2.06892>,<0.599552,-2.13566,2.6927>,<0.70993,-2.00245,2.31908>}
+	triangle{<0.78382,-3,2.06892>,<0.70993,-2.00245,2.31908>,<0.781438,-2.17082,2.07702>}
+	texture{t1}
+}
+union{
+	cylinder{<0.78382,-3,2.06892>,<0.59952,-3,2.69278>,r}
+	sphere{<0.59952,-3,2.69278>,r}
+	cylinder{<0.59952,-3,2.69278>,<0.599552,-2.13566,2.6927>,r}
+	sphere{<0.599552,-2.13566,2.6927>,r}
+	cylinder{<0.599552,-2.13566,2.6927>,<0.70993,-2.00245,2.31908>,r}
+	sphere{<0.70993,-2.00245,2.31908>,r}
+	cylinder{<0.70993,-2.00245,2.31908>,<0.781438,-2.17082,2.07702>,r}
+	sphere{<0.781438,-2.17082,2.07702>,r}
+	cylinder{<0.781438,-2.17082,2.07702>,<0.78382,-3,2.06892>,r}
+	sphere{<0.78382,-3,2.06892>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.700094,-2.04353,2.79846>,<1.12675,-2.40884,3.24735>,<1.12746,-3,3.24817>}
+	triangle{<0.700094,-2.04353,2.79846>,<1.12746,-3,3.24817>,<0.59952,-3,2.69278>}
+	triangle{<0.700094,-2.04353,2.79846>,<0.59952,-3,2.69278>,<0.599552,-2.13566,2.6927>}
+	texture{t1}
+}
+union{
+	cylinder{<0.700094,-2.04353,2.79846>,<1.12675,-2.40884,3.24735>,r}
+	sphere{<1.12675,-2.40884,3.24735>,r}
+	cylinder{<1.12675,-2.40884,3.24735>,<1.12746,-3,3.24817>,r}
+	sphere{<1.12746,-3,3.24817>,r}
+	cylinder{<1.12746,-3,3.24817>,<0.59952,-3,2.69278>,r}
+	sphere{<0.59952,-3,2.69278>,r}
+	cylinder{<0.59952,-3,2.69278>,<0.599552,-2.13566,2.6927>,r}
+	sphere{<0.599552,-2.13566,2.6927>,r}
+	cylinder{<0.599552,-2.13566,2.6927>,<0.700094,-2.04353,2.79846>,r}
+	sphere{<0.700094,-2.04353,2.79846>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.00577534,-2.16686,2.83849>,<-0.0423708,-2.01918,3.07088>,<0.453054,-1.86842,3.13876>}
+	triangle{<-0.00577534,-2.16686,2.83849>,<0.453054,-1.86842,3.13876>,<0.700094,-2.04353,2.79846>}
+	triangle{<-0.00577534,-2.16686,2.83849>,<0.700094,-2.04353,2.79846>,<0.599552,-2.13566,2.6927>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.00577534,-2.16686,2.83849>,<-0.0423708,-2.01918,3.07088>,r}
+	sphere{<-0.0423708,-2.01918,3.07088>,r}
+	cylinder{<-0.0423708,-2.01918,3.07088>,<0.453054,-1.86842,3.13876>,r}
+	sphere{<0.453054,-1.86842,3.13876>,r}
+	cylinder{<0.453054,-1.86842,3.13876>,<0.700094,-2.04353,2.79846>,r}
+	sphere{<0.700094,-2.04353,2.79846>,r}
+	cylinder{<0.700094,-2.04353,2.79846>,<0.599552,-2.13566,2.6927>,r}
+	sphere{<0.599552,-2.13566,2.6927>,r}
+	cylinder{<0.599552,-2.13566,2.6927>,<-0.00577534,-2.16686,2.83849>,r}
+	sphere{<-0.00577534,-2.16686,2.83849>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.0423708,-2.01918,3.07088>,<-0.357396,-1.76359,3.0527>,<0.181806,-1.17484,3.15675>}
+	triangle{<-0.0423708,-2.01918,3.07088>,<0.181806,-1.17484,3.15675>,<0.511678,-1.37727,3.18042>}
+	triangle{<-0.0423708,-2.01918,3.07088>,<0.511678,-1.37727,3.18042>,<0.453054,-1.86842,3.13876>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.0423708,-2.01918,3.07088>,<-0.357396,-1.76359,3.0527>,r}
+	sphere{<-0.357396,-1.76359,3.0527>,r}
+	cylinder{<-0.357396,-1.76359,3.0527>,<0.181806,-1.17484,3.15675>,r}
+	sphere{<0.181806,-1.17484,3.15675>,r}
+	cylinder{<0.181806,-1.17484,3.15675>,<0.511678,-1.37727,3.18042>,r}
+	sphere{<0.511678,-1.37727,3.18042>,r}
+	cylinder{<0.511678,-1.37727,3.18042>,<0.453054,-1.86842,3.13876>,r}
+	sphere{<0.453054,-1.86842,3.13876>,r}
+	cylinder{<0.453054,-1.86842,3.13876>,<-0.0423708,-2.01918,3.07088>,r}
+	sphere{<-0.0423708,-2.01918,3.07088>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.93964,-2.45198,2.46651>,<2.3273,-1.91678,2.15724>,<2.3325,-1.8737,1.83471>}
+	triangle{<1.93964,-2.45198,2.46651>,<2.3325,-1.8737,1.83471>,<2.11945,-2.12084,1.58776>}
+	triangle{<1.93964,-2.45198,2.46651>,<2.11945,-2.12084,1.58776>,<1.71285,-2.69137,1.99345>}
+	texture{t1}
+}
+union{
+	cylinder{<1.93964,-2.45198,2.46651>,<2.3273,-1.91678,2.15724>,r}
+	sphere{<2.3273,-1.91678,2.15724>,r}
+	cylinder{<2.3273,-1.91678,2.15724>,<2.3325,-1.8737,1.83471>,r}
+	sphere{<2.3325,-1.8737,1.83471>,r}
+	cylinder{<2.3325,-1.8737,1.83471>,<2.11945,-2.12084,1.58776>,r}
+	sphere{<2.11945,-2.12084,1.58776>,r}
+	cylinder{<2.11945,-2.12084,1.58776>,<1.71285,-2.69137,1.99345>,r}
+	sphere{<1.71285,-2.69137,1.99345>,r}
+	cylinder{<1.71285,-2.69137,1.99345>,<1.93964,-2.45198,2.46651>,r}
+	sphere{<1.93964,-2.45198,2.46651>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.93964,-2.45198,2.46651>,<1.77161,-2.10169,2.68939>,<1.74524,-2.02431,2.72779>}
+	triangle{<1.93964,-2.45198,2.46651>,<1.74524,-2.02431,2.72779>,<2.11455,-1.66578,2.41007>}
+	triangle{<1.93964,-2.45198,2.46651>,<2.11455,-1.66578,2.41007>,<2.3273,-1.91678,2.15724>}
+	texture{t1}
+}
+union{
+	cylinder{<1.93964,-2.45198,2.46651>,<1.77161,-2.10169,2.68939>,r}
+	sphere{<1.77161,-2.10169,2.68939>,r}
+	cylinder{<1.77161,-2.10169,2.68939>,<1.74524,-2.02431,2.72779>,r}
+	sphere{<1.74524,-2.02431,2.72779>,r}
+	cylinder{<1.74524,-2.02431,2.72779>,<2.11455,-1.66578,2.41007>,r}
+	sphere{<2.11455,-1.66578,2.41007>,r}
+	cylinder{<2.11455,-1.66578,2.41007>,<2.3273,-1.91678,2.15724>,r}
+	sphere{<2.3273,-1.91678,2.15724>,r}
+	cylinder{<2.3273,-1.91678,2.15724>,<1.93964,-2.45198,2.46651>,r}
+	sphere{<1.93964,-2.45198,2.46651>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.71285,-2.69137,1.99345>,<1.93964,-2.45198,2.46651>,<1.96634,-2.54871,2.52222>}
+	triangle{<1.71285,-2.69137,1.99345>,<1.96634,-2.54871,2.52222>,<1.9667,-3,2.52301>}
+	triangle{<1.71285,-2.69137,1.99345>,<1.9667,-3,2.52301>,<1.71283,-3,1.99344>}
+	texture{t1}
+}
+union{
+	cylinder{<1.71285,-2.69137,1.99345>,<1.93964,-2.45198,2.46651>,r}
+	sphere{<1.93964,-2.45198,2.46651>,r}
+	cylinder{<1.93964,-2.45198,2.46651>,<1.96634,-2.54871,2.52222>,r}
+	sphere{<1.96634,-2.54871,2.52222>,r}
+	cylinder{<1.96634,-2.54871,2.52222>,<1.9667,-3,2.52301>,r}
+	sphere{<1.9667,-3,2.52301>,r}
+	cylinder{<1.9667,-3,2.52301>,<1.71283,-3,1.99344>,r}
+	sphere{<1.71283,-3,1.99344>,r}
+	cylinder{<1.71283,-3,1.99344>,<1.71285,-2.69137,1.99345>,r}
+	sphere{<1.71285,-2.69137,1.99345>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.39371,-2.13978,3.45599>,<1.97842,-1.79507,3.24299>,<2.46388,-1.32328,2.9513>}
+	triangle{<2.39371,-2.13978,3.45599>,<2.46388,-1.32328,2.9513>,<3,-1.32329,2.95121>}
+	triangle{<2.39371,-2.13978,3.45599>,<3,-1.32329,2.95121>,<3,-2.13984,3.45592>}
+	texture{t1}
+}
+union{
+	cylinder{<2.39371,-2.13978,3.45599>,<1.97842,-1.79507,3.24299>,r}
+	sphere{<1.97842,-1.79507,3.24299>,r}
+	cylinder{<1.97842,-1.79507,3.24299>,<2.46388,-1.32328,2.9513>,r}
+	sphere{<2.46388,-1.32328,2.9513>,r}
+	cylinder{<2.46388,-1.32328,2.9513>,<3,-1.32329,2.95121>,r}
+	sphere{<3,-1.32329,2.95121>,r}
+	cylinder{<3,-1.32329,2.95121>,<3,-2.13984,3.45592>,r}
+	sphere{<3,-2.13984,3.45592>,r}
+	cylinder{<3,-2.13984,3.45592>,<2.39371,-2.13978,3.45599>,r}
+	sphere{<2.39371,-2.13978,3.45599>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.44674,-0.48984,1.82713>,<-2.07273,0.0954326,1.88112>,<-1.84086,-0.232971,2.45966>}
+	triangle{<-2.44674,-0.48984,1.82713>,<-1.84086,-0.232971,2.45966>,<-2.39068,-0.776077,2.1301>}
+	triangle{<-2.44674,-0.48984,1.82713>,<-2.39068,-0.776077,2.1301>,<-2.42076,-0.77158,2.08509>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.44674,-0.48984,1.82713>,<-2.07273,0.0954326,1.88112>,r}
+	sphere{<-2.07273,0.0954326,1.88112>,r}
+	cylinder{<-2.07273,0.0954326,1.88112>,<-1.84086,-0.232971,2.45966>,r}
+	sphere{<-1.84086,-0.232971,2.45966>,r}
+	cylinder{<-1.84086,-0.232971,2.45966>,<-2.39068,-0.776077,2.1301>,r}
+	sphere{<-2.39068,-0.776077,2.1301>,r}
+	cylinder{<-2.39068,-0.776077,2.1301>,<-2.42076,-0.77158,2.08509>,r}
+	sphere{<-2.42076,-0.77158,2.08509>,r}
+	cylinder{<-2.42076,-0.77158,2.08509>,<-2.44674,-0.48984,1.82713>,r}
+	sphere{<-2.44674,-0.48984,1.82713>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.39068,-0.776077,2.1301>,<-1.84086,-0.232971,2.45966>,<-1.69854,-0.26674,2.48>}
+	triangle{<-2.39068,-0.776077,2.1301>,<-1.69854,-0.26674,2.48>,<-1.42863,-0.863014,2.32028>}
+	triangle{<-2.39068,-0.776077,2.1301>,<-1.42863,-0.863014,2.32028>,<-2.01663,-1.05417,2.11302>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.39068,-0.776077,2.1301>,<-1.84086,-0.232971,2.45966>,r}
+	sphere{<-1.84086,-0.232971,2.45966>,r}
+	cylinder{<-1.84086,-0.232971,2.45966>,<-1.69854,-0.26674,2.48>,r}
+	sphere{<-1.69854,-0.26674,2.48>,r}
+	cylinder{<-1.69854,-0.26674,2.48>,<-1.42863,-0.863014,2.32028>,r}
+	sphere{<-1.42863,-0.863014,2.32028>,r}
+	cylinder{<-1.42863,-0.863014,2.32028>,<-2.01663,-1.05417,2.11302>,r}
+	sphere{<-2.01663,-1.05417,2.11302>,r}
+	cylinder{<-2.01663,-1.05417,2.11302>,<-2.39068,-0.776077,2.1301>,r}
+	sphere{<-2.39068,-0.776077,2.1301>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.23844,-0.0939489,1.98326>,<-1.69854,-0.26674,2.48>,<-1.84086,-0.232971,2.45966>}
+	triangle{<-1.23844,-0.0939489,1.98326>,<-1.84086,-0.232971,2.45966>,<-2.07273,0.0954326,1.88112>}
+	triangle{<-1.23844,-0.0939489,1.98326>,<-2.07273,0.0954326,1.88112>,<-1.7878,0.208445,1.56151>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.23844,-0.0939489,1.98326>,<-1.69854,-0.26674,2.48>,r}
+	sphere{<-1.69854,-0.26674,2.48>,r}
+	cylinder{<-1.69854,-0.26674,2.48>,<-1.84086,-0.232971,2.45966>,r}
+	sphere{<-1.84086,-0.232971,2.45966>,r}
+	cylinder{<-1.84086,-0.232971,2.45966>,<-2.07273,0.0954326,1.88112>,r}
+	sphere{<-2.07273,0.0954326,1.88112>,r}
+	cylinder{<-2.07273,0.0954326,1.88112>,<-1.7878,0.208445,1.56151>,r}
+	sphere{<-1.7878,0.208445,1.56151>,r}
+	cylinder{<-1.7878,0.208445,1.56151>,<-1.23844,-0.0939489,1.98326>,r}
+	sphere{<-1.23844,-0.0939489,1.98326>,r}
+	texture{t2}
+}
+union{
+	triangle{<-3,-0.837772,2.74884>,<-3,0.182609,2.95875>,<-2.21438,0.182597,2.95866>}
+	triangle{<-3,-0.837772,2.74884>,<-2.21438,0.182597,2.95866>,<-2.01779,-0.136726,2.89295>}
+	triangle{<-3,-0.837772,2.74884>,<-2.01779,-0.136726,2.89295>,<-2.93336,-0.837776,2.74883>}
+	texture{t1}
+}
+union{
+	cylinder{<-3,-0.837772,2.74884>,<-3,0.182609,2.95875>,r}
+	sphere{<-3,0.182609,2.95875>,r}
+	cylinder{<-3,0.182609,2.95875>,<-2.21438,0.182597,2.95866>,r}
+	sphere{<-2.21438,0.182597,2.95866>,r}
+	cylinder{<-2.21438,0.182597,2.95866>,<-2.01779,-0.136726,2.89295>,r}
+	sphere{<-2.01779,-0.136726,2.89295>,r}
+	cylinder{<-2.01779,-0.136726,2.89295>,<-2.93336,-0.837776,2.74883>,r}
+	sphere{<-2.93336,-0.837776,2.74883>,r}
+	cylinder{<-2.93336,-0.837776,2.74883>,<-3,-0.837772,2.74884>,r}
+	sphere{<-3,-0.837772,2.74884>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.13337,0.387226,2.79293>,<-2.21438,0.182597,2.95866>,<-3,0.182609,2.95875>}
+	triangle{<-2.13337,0.387226,2.79293>,<-3,0.182609,2.95875>,<-3,0.429644,2.75868>}
+	triangle{<-2.13337,0.387226,2.79293>,<-3,0.429644,2.75868>,<-2.15914,0.42953,2.75867>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.13337,0.387226,2.79293>,<-2.21438,0.182597,2.95866>,r}
+	sphere{<-2.21438,0.182597,2.95866>,r}
+	cylinder{<-2.21438,0.182597,2.95866>,<-3,0.182609,2.95875>,r}
+	sphere{<-3,0.182609,2.95875>,r}
+	cylinder{<-3,0.182609,2.95875>,<-3,0.429644,2.75868>,r}
+	sphere{<-3,0.429644,2.75868>,r}
+	cylinder{<-3,0.429644,2.75868>,<-2.15914,0.42953,2.75867>,r}
+	sphere{<-2.15914,0.42953,2.75867>,r}
+	cylinder{<-2.15914,0.42953,2.75867>,<-2.13337,0.387226,2.79293>,r}
+	sphere{<-2.13337,0.387226,2.79293>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.80675,-1.14664,3.3704>,<-2.00374,-0.78727,3.45125>,<-1.85025,-0.330827,3.19041>}
+	triangle{<-1.80675,-1.14664,3.3704>,<-1.85025,-0.330827,3.19041>,<-1.59021,-0.308745,2.9503>}
+	triangle{<-1.80675,-1.14664,3.3704>,<-1.59021,-0.308745,2.9503>,<-1.31914,-0.881668,2.86009>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.80675,-1.14664,3.3704>,<-2.00374,-0.78727,3.45125>,r}
+	sphere{<-2.00374,-0.78727,3.45125>,r}
+	cylinder{<-2.00374,-0.78727,3.45125>,<-1.85025,-0.330827,3.19041>,r}
+	sphere{<-1.85025,-0.330827,3.19041>,r}
+	cylinder{<-1.85025,-0.330827,3.19041>,<-1.59021,-0.308745,2.9503>,r}
+	sphere{<-1.59021,-0.308745,2.9503>,r}
+	cylinder{<-1.59021,-0.308745,2.9503>,<-1.31914,-0.881668,2.86009>,r}
+	sphere{<-1.31914,-0.881668,2.86009>,r}
+	cylinder{<-1.31914,-0.881668,2.86009>,<-1.80675,-1.14664,3.3704>,r}
+	sphere{<-1.80675,-1.14664,3.3704>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.26535,-1.12678,2.0523>,<0.0944892,-1.45627,1.93455>,<-0.0766957,-1.64786,1.96193>}
+	triangle{<0.26535,-1.12678,2.0523>,<-0.0766957,-1.64786,1.96193>,<-0.439585,-1.48203,2.6202>}
+	triangle{<0.26535,-1.12678,2.0523>,<-0.439585,-1.48203,2.6202>,<0.043504,-0.869656,2.61816>}
+	texture{t1}
+}
+union{
+	cylinder{<0.26535,-1.12678,2.0523>,<0.0944892,-1.45627,1.93455>,r}
+	sphere{<0.0944892,-1.45627,1.93455>,r}
+	cylinder{<0.0944892,-1.45627,1.93455>,<-0.0766957,-1.64786,1.96193>,r}
+	sphere{<-0.0766957,-1.64786,1.96193>,r}
+	cylinder{<-0.0766957,-1.64786,1.96193>,<-0.439585,-1.48203,2.6202>,r}
+	sphere{<-0.439585,-1.48203,2.6202>,r}
+	cylinder{<-0.439585,-1.48203,2.6202>,<0.043504,-0.869656,2.61816>,r}
+	sphere{<0.043504,-0.869656,2.61816>,r}
+	cylinder{<0.043504,-0.869656,2.61816>,<0.26535,-1.12678,2.0523>,r}
+	sphere{<0.26535,-1.12678,2.0523>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.274058,-0.411224,1.97968>,<-0.308166,-0.389651,2.35456>,<-0.35405,-0.387528,2.36914>}
+	triangle{<-0.274058,-0.411224,1.97968>,<-0.35405,-0.387528,2.36914>,<-0.776993,-0.403364,1.85885>}
+	triangle{<-0.274058,-0.411224,1.97968>,<-0.776993,-0.403364,1.85885>,<-0.761264,-0.404631,1.84403>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.274058,-0.411224,1.97968>,<-0.308166,-0.389651,2.35456>,r}
+	sphere{<-0.308166,-0.389651,2.35456>,r}
+	cylinder{<-0.308166,-0.389651,2.35456>,<-0.35405,-0.387528,2.36914>,r}
+	sphere{<-0.35405,-0.387528,2.36914>,r}
+	cylinder{<-0.35405,-0.387528,2.36914>,<-0.776993,-0.403364,1.85885>,r}
+	sphere{<-0.776993,-0.403364,1.85885>,r}
+	cylinder{<-0.776993,-0.403364,1.85885>,<-0.761264,-0.404631,1.84403>,r}
+	sphere{<-0.761264,-0.404631,1.84403>,r}
+	cylinder{<-0.761264,-0.404631,1.84403>,<-0.274058,-0.411224,1.97968>,r}
+	sphere{<-0.274058,-0.411224,1.97968>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.07132,0.0559691,2.02283>,<-0.776993,-0.403364,1.85885>,<-0.35405,-0.387528,2.36914>}
+	triangle{<-1.07132,0.0559691,2.02283>,<-0.35405,-0.387528,2.36914>,<-0.630159,0.140795,2.63048>}
+	triangle{<-1.07132,0.0559691,2.02283>,<-0.630159,0.140795,2.63048>,<-0.977897,0.265917,2.36338>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.07132,0.0559691,2.02283>,<-0.776993,-0.403364,1.85885>,r}
+	sphere{<-0.776993,-0.403364,1.85885>,r}
+	cylinder{<-0.776993,-0.403364,1.85885>,<-0.35405,-0.387528,2.36914>,r}
+	sphere{<-0.35405,-0.387528,2.36914>,r}
+	cylinder{<-0.35405,-0.387528,2.36914>,<-0.630159,0.140795,2.63048>,r}
+	sphere{<-0.630159,0.140795,2.63048>,r}
+	cylinder{<-0.630159,0.140795,2.63048>,<-0.977897,0.265917,2.36338>,r}
+	sphere{<-0.977897,0.265917,2.36338>,r}
+	cylinder{<-0.977897,0.265917,2.36338>,<-1.07132,0.0559691,2.02283>,r}
+	sphere{<-1.07132,0.0559691,2.02283>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.630159,0.140795,2.63048>,<-0.791213,0.079693,3.05045>,<-0.953958,0.103815,3.0827>}
+	triangle{<-0.630159,0.140795,2.63048>,<-0.953958,0.103815,3.0827>,<-1.21846,0.226815,2.75246>}
+	triangle{<-0.630159,0.140795,2.63048>,<-1.21846,0.226815,2.75246>,<-0.977897,0.265917,2.36338>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.630159,0.140795,2.63048>,<-0.791213,0.079693,3.05045>,r}
+	sphere{<-0.791213,0.079693,3.05045>,r}
+	cylinder{<-0.791213,0.079693,3.05045>,<-0.953958,0.103815,3.0827>,r}
+	sphere{<-0.953958,0.103815,3.0827>,r}
+	cylinder{<-0.953958,0.103815,3.0827>,<-1.21846,0.226815,2.75246>,r}
+	sphere{<-1.21846,0.226815,2.75246>,r}
+	cylinder{<-1.21846,0.226815,2.75246>,<-0.977897,0.265917,2.36338>,r}
+	sphere{<-0.977897,0.265917,2.36338>,r}
+	cylinder{<-0.977897,0.265917,2.36338>,<-0.630159,0.140795,2.63048>,r}
+	sphere{<-0.630159,0.140795,2.63048>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.04712,-0.0942936,3.19199>,<-1.59021,-0.308745,2.9503>,<-1.70095,-0.169591,2.73013>}
+	triangle{<-1.04712,-0.0942936,3.19199>,<-1.70095,-0.169591,2.73013>,<-1.21846,0.226815,2.75246>}
+	triangle{<-1.04712,-0.0942936,3.19199>,<-1.21846,0.226815,2.75246>,<-0.953958,0.103815,3.0827>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.04712,-0.0942936,3.19199>,<-1.59021,-0.308745,2.9503>,r}
+	sphere{<-1.59021,-0.308745,2.9503>,r}
+	cylinder{<-1.59021,-0.308745,2.9503>,<-1.70095,-0.169591,2.73013>,r}
+	sphere{<-1.70095,-0.169591,2.73013>,r}
+	cylinder{<-1.70095,-0.169591,2.73013>,<-1.21846,0.226815,2.75246>,r}
+	sphere{<-1.21846,0.226815,2.75246>,r}
+	cylinder{<-1.21846,0.226815,2.75246>,<-0.953958,0.103815,3.0827>,r}
+	sphere{<-0.953958,0.103815,3.0827>,r}
+	cylinder{<-0.953958,0.103815,3.0827>,<-1.04712,-0.0942936,3.19199>,r}
+	sphere{<-1.04712,-0.0942936,3.19199>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.08928,-0.913651,2.92432>,<-0.961343,-1.07053,2.60169>,<-1.07825,-1.08857,2.48062>}
+	triangle{<-1.08928,-0.913651,2.92432>,<-1.07825,-1.08857,2.48062>,<-1.3156,-1.00955,2.53282>}
+	triangle{<-1.08928,-0.913651,2.92432>,<-1.3156,-1.00955,2.53282>,<-1.31914,-0.881668,2.86009>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.08928,-0.913651,2.92432>,<-0.961343,-1.07053,2.60169>,r}
+	sphere{<-0.961343,-1.07053,2.60169>,r}
+	cylinder{<-0.961343,-1.07053,2.60169>,<-1.07825,-1.08857,2.48062>,r}
+	sphere{<-1.07825,-1.08857,2.48062>,r}
+	cylinder{<-1.07825,-1.08857,2.48062>,<-1.3156,-1.00955,2.53282>,r}
+	sphere{<-1.3156,-1.00955,2.53282>,r}
+	cylinder{<-1.3156,-1.00955,2.53282>,<-1.31914,-0.881668,2.86009>,r}
+	sphere{<-1.31914,-0.881668,2.86009>,r}
+	cylinder{<-1.31914,-0.881668,2.86009>,<-1.08928,-0.913651,2.92432>,r}
+	sphere{<-1.08928,-0.913651,2.92432>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.383541,0.243885,3.27456>,<0.508774,-0.141173,3.12467>,<0.390346,-0.262469,3.31575>}
+	triangle{<0.383541,0.243885,3.27456>,<0.390346,-0.262469,3.31575>,<0.212813,0.0550446,3.55145>}
+	triangle{<0.383541,0.243885,3.27456>,<0.212813,0.0550446,3.55145>,<0.235412,0.176286,3.50502>}
+	texture{t1}
+}
+union{
+	cylinder{<0.383541,0.243885,3.27456>,<0.508774,-0.141173,3.12467>,r}
+	sphere{<0.508774,-0.141173,3.12467>,r}
+	cylinder{<0.508774,-0.141173,3.12467>,<0.390346,-0.262469,3.31575>,r}
+	sphere{<0.390346,-0.262469,3.31575>,r}
+	cylinder{<0.390346,-0.262469,3.31575>,<0.212813,0.0550446,3.55145>,r}
+	sphere{<0.212813,0.0550446,3.55145>,r}
+	cylinder{<0.212813,0.0550446,3.55145>,<0.235412,0.176286,3.50502>,r}
+	sphere{<0.235412,0.176286,3.50502>,r}
+	cylinder{<0.235412,0.176286,3.50502>,<0.383541,0.243885,3.27456>,r}
+	sphere{<0.383541,0.243885,3.27456>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.445188,-0.420509,3.45342>,<-0.0557612,0.040329,3.61692>,<0.212813,0.0550446,3.55145>}
+	triangle{<-0.445188,-0.420509,3.45342>,<0.212813,0.0550446,3.55145>,<0.390346,-0.262469,3.31575>}
+	triangle{<-0.445188,-0.420509,3.45342>,<0.390346,-0.262469,3.31575>,<0.0747274,-0.653405,3.17299>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.445188,-0.420509,3.45342>,<-0.0557612,0.040329,3.61692>,r}
+	sphere{<-0.0557612,0.040329,3.61692>,r}
+	cylinder{<-0.0557612,0.040329,3.61692>,<0.212813,0.0550446,3.55145>,r}
+	sphere{<0.212813,0.0550446,3.55145>,r}
+	cylinder{<0.212813,0.0550446,3.55145>,<0.390346,-0.262469,3.31575>,r}
+	sphere{<0.390346,-0.262469,3.31575>,r}
+	cylinder{<0.390346,-0.262469,3.31575>,<0.0747274,-0.653405,3.17299>,r}
+	sphere{<0.0747274,-0.653405,3.17299>,r}
+	cylinder{<0.0747274,-0.653405,3.17299>,<-0.445188,-0.420509,3.45342>,r}
+	sphere{<-0.445188,-0.420509,3.45342>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.630159,0.140795,2.63048>,<-0.140831,0.556187,2.62254>,<-0.120234,0.581941,2.66785>}
+	triangle{<-0.630159,0.140795,2.63048>,<-0.120234,0.581941,2.66785>,<-0.437823,0.412014,3.22314>}
+	triangle{<-0.630159,0.140795,2.63048>,<-0.437823,0.412014,3.22314>,<-0.791213,0.079693,3.05045>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.630159,0.140795,2.63048>,<-0.140831,0.556187,2.62254>,r}
+	sphere{<-0.140831,0.556187,2.62254>,r}
+	cylinder{<-0.140831,0.556187,2.62254>,<-0.120234,0.581941,2.66785>,r}
+	sphere{<-0.120234,0.581941,2.66785>,r}
+	cylinder{<-0.120234,0.581941,2.66785>,<-0.437823,0.412014,3.22314>,r}
+	sphere{<-0.437823,0.412014,3.22314>,r}
+	cylinder{<-0.437823,0.412014,3.22314>,<-0.791213,0.079693,3.05045>,r}
+	sphere{<-0.791213,0.079693,3.05045>,r}
+	cylinder{<-0.791213,0.079693,3.05045>,<-0.630159,0.140795,2.63048>,r}
+	sphere{<-0.630159,0.140795,2.63048>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.0554648,-0.72365,2.71733>,<0.0747274,-0.653405,3.17299>,<0.390346,-0.262469,3.31575>}
+	triangle{<0.0554648,-0.72365,2.71733>,<0.390346,-0.262469,3.31575>,<0.508774,-0.141173,3.12467>}
+	triangle{<0.0554648,-0.72365,2.71733>,<0.508774,-0.141173,3.12467>,<0.450748,-0.248844,2.75349>}
+	texture{t1}
+}
+union{
+	cylinder{<0.0554648,-0.72365,2.71733>,<0.0747274,-0.653405,3.17299>,r}
+	sphere{<0.0747274,-0.653405,3.17299>,r}
+	cylinder{<0.0747274,-0.653405,3.17299>,<0.390346,-0.262469,3.31575>,r}
+	sphere{<0.390346,-0.262469,3.31575>,r}
+	cylinder{<0.390346,-0.262469,3.31575>,<0.508774,-0.141173,3.12467>,r}
+	sphere{<0.508774,-0.141173,3.12467>,r}
+	cylinder{<0.508774,-0.141173,3.12467>,<0.450748,-0.248844,2.75349>,r}
+	sphere{<0.450748,-0.248844,2.75349>,r}
+	cylinder{<0.450748,-0.248844,2.75349>,<0.0554648,-0.72365,2.71733>,r}
+	sphere{<0.0554648,-0.72365,2.71733>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.274058,-0.411224,1.97968>,<0.0708343,-0.0487173,1.72786>,<0.332574,0.3175,2.09205>}
+	triangle{<-0.274058,-0.411224,1.97968>,<0.332574,0.3175,2.09205>,<0.166967,0.174275,2.40094>}
+	triangle{<-0.274058,-0.411224,1.97968>,<0.166967,0.174275,2.40094>,<-0.308166,-0.389651,2.35456>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.274058,-0.411224,1.97968>,<0.0708343,-0.0487173,1.72786>,r}
+	sphere{<0.0708343,-0.0487173,1.72786>,r}
+	cylinder{<0.0708343,-0.0487173,1.72786>,<0.332574,0.3175,2.09205>,r}
+	sphere{<0.332574,0.3175,2.09205>,r}
+	cylinder{<0.332574,0.3175,2.09205>,<0.166967,0.174275,2.40094>,r}
+	sphere{<0.166967,0.174275,2.40094>,r}
+	cylinder{<0.166967,0.174275,2.40094>,<-0.308166,-0.389651,2.35456>,r}
+	sphere{<-0.308166,-0.389651,2.35456>,r}
+	cylinder{<-0.308166,-0.389651,2.35456>,<-0.274058,-0.411224,1.97968>,r}
+	sphere{<-0.274058,-0.411224,1.97968>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.916906,0.140749,1.90191>,<0.926968,0.130295,1.85119>,<0.939392,0.112961,1.83209>}
+	triangle{<0.916906,0.140749,1.90191>,<0.939392,0.112961,1.83209>,<1.00637,0.00250093,1.89646>}
+	triangle{<0.916906,0.140749,1.90191>,<1.00637,0.00250093,1.89646>,<1.0095,-0.0173004,2.04332>}
+	texture{t1}
+}
+union{
+	cylinder{<0.916906,0.140749,1.90191>,<0.926968,0.130295,1.85119>,r}
+	sphere{<0.926968,0.130295,1.85119>,r}
+	cylinder{<0.926968,0.130295,1.85119>,<0.939392,0.112961,1.83209>,r}
+	sphere{<0.939392,0.112961,1.83209>,r}
+	cylinder{<0.939392,0.112961,1.83209>,<1.00637,0.00250093,1.89646>,r}
+	sphere{<1.00637,0.00250093,1.89646>,r}
+	cylinder{<1.00637,0.00250093,1.89646>,<1.0095,-0.0173004,2.04332>,r}
+	sphere{<1.0095,-0.0173004,2.04332>,r}
+	cylinder{<1.0095,-0.0173004,2.04332>,<0.916906,0.140749,1.90191>,r}
+	sphere{<0.916906,0.140749,1.90191>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.450748,-0.248844,2.75349>,<0.934636,-0.345033,2.52985>,<0.692489,-1.05202,2.34312>}
+	triangle{<0.450748,-0.248844,2.75349>,<0.692489,-1.05202,2.34312>,<0.0787716,-0.858101,2.65521>}
+	triangle{<0.450748,-0.248844,2.75349>,<0.0787716,-0.858101,2.65521>,<0.0554648,-0.72365,2.71733>}
+	texture{t1}
+}
+union{
+	cylinder{<0.450748,-0.248844,2.75349>,<0.934636,-0.345033,2.52985>,r}
+	sphere{<0.934636,-0.345033,2.52985>,r}
+	cylinder{<0.934636,-0.345033,2.52985>,<0.692489,-1.05202,2.34312>,r}
+	sphere{<0.692489,-1.05202,2.34312>,r}
+	cylinder{<0.692489,-1.05202,2.34312>,<0.0787716,-0.858101,2.65521>,r}
+	sphere{<0.0787716,-0.858101,2.65521>,r}
+	cylinder{<0.0787716,-0.858101,2.65521>,<0.0554648,-0.72365,2.71733>,r}
+	sphere{<0.0554648,-0.72365,2.71733>,r}
+	cylinder{<0.0554648,-0.72365,2.71733>,<0.450748,-0.248844,2.75349>,r}
+	sphere{<0.450748,-0.248844,2.75349>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.450748,-0.248844,2.75349>,<0.0554648,-0.72365,2.71733>,<-0.0938173,-0.688252,2.61188>}
+	triangle{<0.450748,-0.248844,2.75349>,<-0.0938173,-0.688252,2.61188>,<-0.308166,-0.389651,2.35456>}
+	triangle{<0.450748,-0.248844,2.75349>,<-0.308166,-0.389651,2.35456>,<0.166967,0.174275,2.40094>}
+	texture{t1}
+}
+union{
+	cylinder{<0.450748,-0.248844,2.75349>,<0.0554648,-0.72365,2.71733>,r}
+	sphere{<0.0554648,-0.72365,2.71733>,r}
+	cylinder{<0.0554648,-0.72365,2.71733>,<-0.0938173,-0.688252,2.61188>,r}
+	sphere{<-0.0938173,-0.688252,2.61188>,r}
+	cylinder{<-0.0938173,-0.688252,2.61188>,<-0.308166,-0.389651,2.35456>,r}
+	sphere{<-0.308166,-0.389651,2.35456>,r}
+	cylinder{<-0.308166,-0.389651,2.35456>,<0.166967,0.174275,2.40094>,r}
+	sphere{<0.166967,0.174275,2.40094>,r}
+	cylinder{<0.166967,0.174275,2.40094>,<0.450748,-0.248844,2.75349>,r}
+	sphere{<0.450748,-0.248844,2.75349>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.0787716,-0.858101,2.65521>,<0.692489,-1.05202,2.34312>,<0.689471,-1.05816,2.32747>}
+	triangle{<0.0787716,-0.858101,2.65521>,<0.689471,-1.05816,2.32747>,<0.26535,-1.12678,2.0523>}
+	triangle{<0.0787716,-0.858101,2.65521>,<0.26535,-1.12678,2.0523>,<0.043504,-0.869656,2.61816>}
+	texture{t1}
+}
+union{
+	cylinder{<0.0787716,-0.858101,2.65521>,<0.692489,-1.05202,2.34312>,r}
+	sphere{<0.692489,-1.05202,2.34312>,r}
+	cylinder{<0.692489,-1.05202,2.34312>,<0.689471,-1.05816,2.32747>,r}
+	sphere{<0.689471,-1.05816,2.32747>,r}
+	cylinder{<0.689471,-1.05816,2.32747>,<0.26535,-1.12678,2.0523>,r}
+	sphere{<0.26535,-1.12678,2.0523>,r}
+	cylinder{<0.26535,-1.12678,2.0523>,<0.043504,-0.869656,2.61816>,r}
+	sphere{<0.043504,-0.869656,2.61816>,r}
+	cylinder{<0.043504,-0.869656,2.61816>,<0.0787716,-0.858101,2.65521>,r}
+	sphere{<0.0787716,-0.858101,2.65521>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.98693,-0.636425,2.41078>,<1.28089,-0.85049,2.73596>,<0.98856,-0.337638,2.5654>}
+	triangle{<1.98693,-0.636425,2.41078>,<0.98856,-0.337638,2.5654>,<1.20471,-0.118388,2.38786>}
+	triangle{<1.98693,-0.636425,2.41078>,<1.20471,-0.118388,2.38786>,<1.81662,-0.282953,2.28367>}
+	texture{t1}
+}
+union{
+	cylinder{<1.98693,-0.636425,2.41078>,<1.28089,-0.85049,2.73596>,r}
+	sphere{<1.28089,-0.85049,2.73596>,r}
+	cylinder{<1.28089,-0.85049,2.73596>,<0.98856,-0.337638,2.5654>,r}
+	sphere{<0.98856,-0.337638,2.5654>,r}
+	cylinder{<0.98856,-0.337638,2.5654>,<1.20471,-0.118388,2.38786>,r}
+	sphere{<1.20471,-0.118388,2.38786>,r}
+	cylinder{<1.20471,-0.118388,2.38786>,<1.81662,-0.282953,2.28367>,r}
+	sphere{<1.81662,-0.282953,2.28367>,r}
+	cylinder{<1.81662,-0.282953,2.28367>,<1.98693,-0.636425,2.41078>,r}
+	sphere{<1.98693,-0.636425,2.41078>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.01421,-1.33961,2.54194>,<0.692489,-1.05202,2.34312>,<0.934636,-0.345033,2.52985>}
+	triangle{<1.01421,-1.33961,2.54194>,<0.934636,-0.345033,2.52985>,<0.98856,-0.337638,2.5654>}
+	triangle{<1.01421,-1.33961,2.54194>,<0.98856,-0.337638,2.5654>,<1.28089,-0.85049,2.73596>}
+	texture{t1}
+}
+union{
+	cylinder{<1.01421,-1.33961,2.54194>,<0.692489,-1.05202,2.34312>,r}
+	sphere{<0.692489,-1.05202,2.34312>,r}
+	cylinder{<0.692489,-1.05202,2.34312>,<0.934636,-0.345033,2.52985>,r}
+	sphere{<0.934636,-0.345033,2.52985>,r}
+	cylinder{<0.934636,-0.345033,2.52985>,<0.98856,-0.337638,2.5654>,r}
+	sphere{<0.98856,-0.337638,2.5654>,r}
+	cylinder{<0.98856,-0.337638,2.5654>,<1.28089,-0.85049,2.73596>,r}
+	sphere{<1.28089,-0.85049,2.73596>,r}
+	cylinder{<1.28089,-0.85049,2.73596>,<1.01421,-1.33961,2.54194>,r}
+	sphere{<1.01421,-1.33961,2.54194>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.0095,-0.0173004,2.04332>,<1.00637,0.00250093,1.89646>,<1.83399,-0.256319,2.03732>}
+	triangle{<1.0095,-0.0173004,2.04332>,<1.83399,-0.256319,2.03732>,<1.81662,-0.282953,2.28367>}
+	triangle{<1.0095,-0.0173004,2.04332>,<1.81662,-0.282953,2.28367>,<1.20471,-0.118388,2.38786>}
+	texture{t1}
+}
+union{
+	cylinder{<1.0095,-0.0173004,2.04332>,<1.00637,0.00250093,1.89646>,r}
+	sphere{<1.00637,0.00250093,1.89646>,r}
+	cylinder{<1.00637,0.00250093,1.89646>,<1.83399,-0.256319,2.03732>,r}
+	sphere{<1.83399,-0.256319,2.03732>,r}
+	cylinder{<1.83399,-0.256319,2.03732>,<1.81662,-0.282953,2.28367>,r}
+	sphere{<1.81662,-0.282953,2.28367>,r}
+	cylinder{<1.81662,-0.282953,2.28367>,<1.20471,-0.118388,2.38786>,r}
+	sphere{<1.20471,-0.118388,2.38786>,r}
+	cylinder{<1.20471,-0.118388,2.38786>,<1.0095,-0.0173004,2.04332>,r}
+	sphere{<1.0095,-0.0173004,2.04332>,r}
+	texture{t2}
+}
+union{
+	triangle{<3,-0.673316,1.98472>,<3,-0.734173,2.43184>,<2.1632,-0.734237,2.43179>}
+	triangle{<3,-0.673316,1.98472>,<2.1632,-0.734237,2.43179>,<2.04271,-0.717536,2.30902>}
+	triangle{<3,-0.673316,1.98472>,<2.04271,-0.717536,2.30902>,<2.06079,-0.673376,1.98459>}
+	texture{t1}
+}
+union{
+	cylinder{<3,-0.673316,1.98472>,<3,-0.734173,2.43184>,r}
+	sphere{<3,-0.734173,2.43184>,r}
+	cylinder{<3,-0.734173,2.43184>,<2.1632,-0.734237,2.43179>,r}
+	sphere{<2.1632,-0.734237,2.43179>,r}
+	cylinder{<2.1632,-0.734237,2.43179>,<2.04271,-0.717536,2.30902>,r}
+	sphere{<2.04271,-0.717536,2.30902>,r}
+	cylinder{<2.04271,-0.717536,2.30902>,<2.06079,-0.673376,1.98459>,r}
+	sphere{<2.06079,-0.673376,1.98459>,r}
+	cylinder{<2.06079,-0.673376,1.98459>,<3,-0.673316,1.98472>,r}
+	sphere{<3,-0.673316,1.98472>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.3273,-1.91678,2.15724>,<2.11455,-1.66578,2.41007>,<2.501,-1.28776,2.79101>}
+	triangle{<2.3273,-1.91678,2.15724>,<2.501,-1.28776,2.79101>,<3,-1.2878,2.79109>}
+	triangle{<2.3273,-1.91678,2.15724>,<3,-1.2878,2.79109>,<3,-1.91769,2.15649>}
+	texture{t1}
+}
+union{
+	cylinder{<2.3273,-1.91678,2.15724>,<2.11455,-1.66578,2.41007>,r}
+	sphere{<2.11455,-1.66578,2.41007>,r}
+	cylinder{<2.11455,-1.66578,2.41007>,<2.501,-1.28776,2.79101>,r}
+	sphere{<2.501,-1.28776,2.79101>,r}
+	cylinder{<2.501,-1.28776,2.79101>,<3,-1.2878,2.79109>,r}
+	sphere{<3,-1.2878,2.79109>,r}
+	cylinder{<3,-1.2878,2.79109>,<3,-1.91769,2.15649>,r}
+	sphere{<3,-1.91769,2.15649>,r}
+	cylinder{<3,-1.91769,2.15649>,<2.3273,-1.91678,2.15724>,r}
+	sphere{<2.3273,-1.91678,2.15724>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.81819,-1.19201,1.96471>,<1.99284,-0.816349,1.84367>,<2.06079,-0.673376,1.98459>}
+	triangle{<1.81819,-1.19201,1.96471>,<2.06079,-0.673376,1.98459>,<2.04271,-0.717536,2.30902>}
+	triangle{<1.81819,-1.19201,1.96471>,<2.04271,-0.717536,2.30902>,<1.8132,-1.20479,2.09058>}
+	texture{t1}
+}
+union{
+	cylinder{<1.81819,-1.19201,1.96471>,<1.99284,-0.816349,1.84367>,r}
+	sphere{<1.99284,-0.816349,1.84367>,r}
+	cylinder{<1.99284,-0.816349,1.84367>,<2.06079,-0.673376,1.98459>,r}
+	sphere{<2.06079,-0.673376,1.98459>,r}
+	cylinder{<2.06079,-0.673376,1.98459>,<2.04271,-0.717536,2.30902>,r}
+	sphere{<2.04271,-0.717536,2.30902>,r}
+	cylinder{<2.04271,-0.717536,2.30902>,<1.8132,-1.20479,2.09058>,r}
+	sphere{<1.8132,-1.20479,2.09058>,r}
+	cylinder{<1.8132,-1.20479,2.09058>,<1.81819,-1.19201,1.96471>,r}
+	sphere{<1.81819,-1.19201,1.96471>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.1632,-0.734237,2.43179>,<2.501,-1.28776,2.79101>,<2.11455,-1.66578,2.41007>}
+	triangle{<2.1632,-0.734237,2.43179>,<2.11455,-1.66578,2.41007>,<1.8132,-1.20479,2.09058>}
+	triangle{<2.1632,-0.734237,2.43179>,<1.8132,-1.20479,2.09058>,<2.04271,-0.717536,2.30902>}
+	texture{t1}
+}
+union{
+	cylinder{<2.1632,-0.734237,2.43179>,<2.501,-1.28776,2.79101>,r}
+	sphere{<2.501,-1.28776,2.79101>,r}
+	cylinder{<2.501,-1.28776,2.79101>,<2.11455,-1.66578,2.41007>,r}
+	sphere{<2.11455,-1.66578,2.41007>,r}
+	cylinder{<2.11455,-1.66578,2.41007>,<1.8132,-1.20479,2.09058>,r}
+	sphere{<1.8132,-1.20479,2.09058>,r}
+	cylinder{<1.8132,-1.20479,2.09058>,<2.04271,-0.717536,2.30902>,r}
+	sphere{<2.04271,-0.717536,2.30902>,r}
+	cylinder{<2.04271,-0.717536,2.30902>,<2.1632,-0.734237,2.43179>,r}
+	sphere{<2.1632,-0.734237,2.43179>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.04408,0.113312,2.69076>,<2.21232,0.400268,2.52346>,<3,0.40007,2.52605>}
+	triangle{<2.04408,0.113312,2.69076>,<3,0.40007,2.52605>,<3,-0.111988,2.82554>}
+	triangle{<2.04408,0.113312,2.69076>,<3,-0.111988,2.82554>,<2.19299,-0.114066,2.82422>}
+	texture{t1}
+}
+union{
+	cylinder{<2.04408,0.113312,2.69076>,<2.21232,0.400268,2.52346>,r}
+	sphere{<2.21232,0.400268,2.52346>,r}
+	cylinder{<2.21232,0.400268,2.52346>,<3,0.40007,2.52605>,r}
+	sphere{<3,0.40007,2.52605>,r}
+	cylinder{<3,0.40007,2.52605>,<3,-0.111988,2.82554>,r}
+	sphere{<3,-0.111988,2.82554>,r}
+	cylinder{<3,-0.111988,2.82554>,<2.19299,-0.114066,2.82422>,r}
+	sphere{<2.19299,-0.114066,2.82422>,r}
+	cylinder{<2.19299,-0.114066,2.82422>,<2.04408,0.113312,2.69076>,r}
+	sphere{<2.04408,0.113312,2.69076>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.04408,0.113312,2.69076>,<2.19299,-0.114066,2.82422>,<2.04999,-0.636588,2.49358>}
+	triangle{<2.04408,0.113312,2.69076>,<2.04999,-0.636588,2.49358>,<1.98693,-0.636425,2.41078>}
+	triangle{<2.04408,0.113312,2.69076>,<1.98693,-0.636425,2.41078>,<1.81662,-0.282953,2.28367>}
+	texture{t1}
+}
+union{
+	cylinder{<2.04408,0.113312,2.69076>,<2.19299,-0.114066,2.82422>,r}
+	sphere{<2.19299,-0.114066,2.82422>,r}
+	cylinder{<2.19299,-0.114066,2.82422>,<2.04999,-0.636588,2.49358>,r}
+	sphere{<2.04999,-0.636588,2.49358>,r}
+	cylinder{<2.04999,-0.636588,2.49358>,<1.98693,-0.636425,2.41078>,r}
+	sphere{<1.98693,-0.636425,2.41078>,r}
+	cylinder{<1.98693,-0.636425,2.41078>,<1.81662,-0.282953,2.28367>,r}
+	sphere{<1.81662,-0.282953,2.28367>,r}
+	cylinder{<1.81662,-0.282953,2.28367>,<2.04408,0.113312,2.69076>,r}
+	sphere{<2.04408,0.113312,2.69076>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.19299,-0.114066,2.82422>,<3,-0.111988,2.82554>,<3,-0.734173,2.43184>}
+	triangle{<2.19299,-0.114066,2.82422>,<3,-0.734173,2.43184>,<2.1632,-0.734237,2.43179>}
+	triangle{<2.19299,-0.114066,2.82422>,<2.1632,-0.734237,2.43179>,<2.04999,-0.636588,2.49358>}
+	texture{t1}
+}
+union{
+	cylinder{<2.19299,-0.114066,2.82422>,<3,-0.111988,2.82554>,r}
+	sphere{<3,-0.111988,2.82554>,r}
+	cylinder{<3,-0.111988,2.82554>,<3,-0.734173,2.43184>,r}
+	sphere{<3,-0.734173,2.43184>,r}
+	cylinder{<3,-0.734173,2.43184>,<2.1632,-0.734237,2.43179>,r}
+	sphere{<2.1632,-0.734237,2.43179>,r}
+	cylinder{<2.1632,-0.734237,2.43179>,<2.04999,-0.636588,2.49358>,r}
+	sphere{<2.04999,-0.636588,2.49358>,r}
+	cylinder{<2.04999,-0.636588,2.49358>,<2.19299,-0.114066,2.82422>,r}
+	sphere{<2.19299,-0.114066,2.82422>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.89822,-0.784519,3.15454>,<2.11527,-1.09731,3.29646>,<1.78764,-1.62402,3.44327>}
+	triangle{<1.89822,-0.784519,3.15454>,<1.78764,-1.62402,3.44327>,<1.27341,-1.08513,3.18011>}
+	triangle{<1.89822,-0.784519,3.15454>,<1.27341,-1.08513,3.18011>,<1.34375,-0.903288,3.12374>}
+	texture{t1}
+}
+union{
+	cylinder{<1.89822,-0.784519,3.15454>,<2.11527,-1.09731,3.29646>,r}
+	sphere{<2.11527,-1.09731,3.29646>,r}
+	cylinder{<2.11527,-1.09731,3.29646>,<1.78764,-1.62402,3.44327>,r}
+	sphere{<1.78764,-1.62402,3.44327>,r}
+	cylinder{<1.78764,-1.62402,3.44327>,<1.27341,-1.08513,3.18011>,r}
+	sphere{<1.27341,-1.08513,3.18011>,r}
+	cylinder{<1.27341,-1.08513,3.18011>,<1.34375,-0.903288,3.12374>,r}
+	sphere{<1.34375,-0.903288,3.12374>,r}
+	cylinder{<1.34375,-0.903288,3.12374>,<1.89822,-0.784519,3.15454>,r}
+	sphere{<1.89822,-0.784519,3.15454>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.89822,-0.784519,3.15454>,<1.34375,-0.903288,3.12374>,<1.28089,-0.85049,2.73596>}
+	triangle{<1.89822,-0.784519,3.15454>,<1.28089,-0.85049,2.73596>,<1.98693,-0.636425,2.41078>}
+	triangle{<1.89822,-0.784519,3.15454>,<1.98693,-0.636425,2.41078>,<2.04999,-0.636588,2.49358>}
+	texture{t1}
+}
+union{
+	cylinder{<1.89822,-0.784519,3.15454>,<1.34375,-0.903288,3.12374>,r}
+	sphere{<1.34375,-0.903288,3.12374>,r}
+	cylinder{<1.34375,-0.903288,3.12374>,<1.28089,-0.85049,2.73596>,r}
+	sphere{<1.28089,-0.85049,2.73596>,r}
+	cylinder{<1.28089,-0.85049,2.73596>,<1.98693,-0.636425,2.41078>,r}
+	sphere{<1.98693,-0.636425,2.41078>,r}
+	cylinder{<1.98693,-0.636425,2.41078>,<2.04999,-0.636588,2.49358>,r}
+	sphere{<2.04999,-0.636588,2.49358>,r}
+	cylinder{<2.04999,-0.636588,2.49358>,<1.89822,-0.784519,3.15454>,r}
+	sphere{<1.89822,-0.784519,3.15454>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.28089,-0.85049,2.73596>,<1.34375,-0.903288,3.12374>,<1.27341,-1.08513,3.18011>}
+	triangle{<1.28089,-0.85049,2.73596>,<1.27341,-1.08513,3.18011>,<1.01395,-1.35649,2.57513>}
+	triangle{<1.28089,-0.85049,2.73596>,<1.01395,-1.35649,2.57513>,<1.01421,-1.33961,2.54194>}
+	texture{t1}
+}
+union{
+	cylinder{<1.28089,-0.85049,2.73596>,<1.34375,-0.903288,3.12374>,r}
+	sphere{<1.34375,-0.903288,3.12374>,r}
+	cylinder{<1.34375,-0.903288,3.12374>,<1.27341,-1.08513,3.18011>,r}
+	sphere{<1.27341,-1.08513,3.18011>,r}
+	cylinder{<1.27341,-1.08513,3.18011>,<1.01395,-1.35649,2.57513>,r}
+	sphere{<1.01395,-1.35649,2.57513>,r}
+	cylinder{<1.01395,-1.35649,2.57513>,<1.01421,-1.33961,2.54194>,r}
+	sphere{<1.01421,-1.33961,2.54194>,r}
+	cylinder{<1.01421,-1.33961,2.54194>,<1.28089,-0.85049,2.73596>,r}
+	sphere{<1.28089,-0.85049,2.73596>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.46388,-1.32328,2.9513>,<1.97842,-1.79507,3.24299>,<1.81827,-1.73396,3.3913>}
+	triangle{<2.46388,-1.32328,2.9513>,<1.81827,-1.73396,3.3913>,<1.78764,-1.62402,3.44327>}
+	triangle{<2.46388,-1.32328,2.9513>,<1.78764,-1.62402,3.44327>,<2.11527,-1.09731,3.29646>}
+	texture{t1}
+}
+union{
+	cylinder{<2.46388,-1.32328,2.9513>,<1.97842,-1.79507,3.24299>,r}
+	sphere{<1.97842,-1.79507,3.24299>,r}
+	cylinder{<1.97842,-1.79507,3.24299>,<1.81827,-1.73396,3.3913>,r}
+	sphere{<1.81827,-1.73396,3.3913>,r}
+	cylinder{<1.81827,-1.73396,3.3913>,<1.78764,-1.62402,3.44327>,r}
+	sphere{<1.78764,-1.62402,3.44327>,r}
+	cylinder{<1.78764,-1.62402,3.44327>,<2.11527,-1.09731,3.29646>,r}
+	sphere{<2.11527,-1.09731,3.29646>,r}
+	cylinder{<2.11527,-1.09731,3.29646>,<2.46388,-1.32328,2.9513>,r}
+	sphere{<2.46388,-1.32328,2.9513>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.46388,-1.32328,2.9513>,<2.501,-1.28776,2.79101>,<2.11455,-1.66578,2.41007>}
+	triangle{<2.46388,-1.32328,2.9513>,<2.11455,-1.66578,2.41007>,<1.74524,-2.02431,2.72779>}
+	triangle{<2.46388,-1.32328,2.9513>,<1.74524,-2.02431,2.72779>,<1.97842,-1.79507,3.24299>}
+	texture{t1}
+}
+union{
+	cylinder{<2.46388,-1.32328,2.9513>,<2.501,-1.28776,2.79101>,r}
+	sphere{<2.501,-1.28776,2.79101>,r}
+	cylinder{<2.501,-1.28776,2.79101>,<2.11455,-1.66578,2.41007>,r}
+	sphere{<2.11455,-1.66578,2.41007>,r}
+	cylinder{<2.11455,-1.66578,2.41007>,<1.74524,-2.02431,2.72779>,r}
+	sphere{<1.74524,-2.02431,2.72779>,r}
+	cylinder{<1.74524,-2.02431,2.72779>,<1.97842,-1.79507,3.24299>,r}
+	sphere{<1.97842,-1.79507,3.24299>,r}
+	cylinder{<1.97842,-1.79507,3.24299>,<2.46388,-1.32328,2.9513>,r}
+	sphere{<2.46388,-1.32328,2.9513>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.97842,-1.79507,3.24299>,<1.74524,-2.02431,2.72779>,<1.72461,-2.02387,2.72981>}
+	triangle{<1.97842,-1.79507,3.24299>,<1.72461,-2.02387,2.72981>,<1.58495,-1.97439,2.85037>}
+	triangle{<1.97842,-1.79507,3.24299>,<1.58495,-1.97439,2.85037>,<1.81827,-1.73396,3.3913>}
+	texture{t1}
+}
+union{
+	cylinder{<1.97842,-1.79507,3.24299>,<1.74524,-2.02431,2.72779>,r}
+	sphere{<1.74524,-2.02431,2.72779>,r}
+	cylinder{<1.74524,-2.02431,2.72779>,<1.72461,-2.02387,2.72981>,r}
+	sphere{<1.72461,-2.02387,2.72981>,r}
+	cylinder{<1.72461,-2.02387,2.72981>,<1.58495,-1.97439,2.85037>,r}
+	sphere{<1.58495,-1.97439,2.85037>,r}
+	cylinder{<1.58495,-1.97439,2.85037>,<1.81827,-1.73396,3.3913>,r}
+	sphere{<1.81827,-1.73396,3.3913>,r}
+	cylinder{<1.81827,-1.73396,3.3913>,<1.97842,-1.79507,3.24299>,r}
+	sphere{<1.97842,-1.79507,3.24299>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.45558,-0.339513,3.57865>,<1.45262,0.151105,3.3732>,<1.87472,0.227472,3.18861>}
+	triangle{<1.45558,-0.339513,3.57865>,<1.87472,0.227472,3.18861>,<2.12833,-0.121563,3.24393>}
+	triangle{<1.45558,-0.339513,3.57865>,<2.12833,-0.121563,3.24393>,<1.98392,-0.440217,3.43023>}
+	texture{t1}
+}
+union{
+	cylinder{<1.45558,-0.339513,3.57865>,<1.45262,0.151105,3.3732>,r}
+	sphere{<1.45262,0.151105,3.3732>,r}
+	cylinder{<1.45262,0.151105,3.3732>,<1.87472,0.227472,3.18861>,r}
+	sphere{<1.87472,0.227472,3.18861>,r}
+	cylinder{<1.87472,0.227472,3.18861>,<2.12833,-0.121563,3.24393>,r}
+	sphere{<2.12833,-0.121563,3.24393>,r}
+	cylinder{<2.12833,-0.121563,3.24393>,<1.98392,-0.440217,3.43023>,r}
+	sphere{<1.98392,-0.440217,3.43023>,r}
+	cylinder{<1.98392,-0.440217,3.43023>,<1.45558,-0.339513,3.57865>,r}
+	sphere{<1.45558,-0.339513,3.57865>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.45558,-0.339513,3.57865>,<1.18996,-0.570446,3.41923>,<0.9528,-0.194393,3.03645>}
+	triangle{<1.45558,-0.339513,3.57865>,<0.9528,-0.194393,3.03645>,<1.21437,0.194889,3.12658>}
+	triangle{<1.45558,-0.339513,3.57865>,<1.21437,0.194889,3.12658>,<1.45262,0.151105,3.3732>}
+	texture{t1}
+}
+union{
+	cylinder{<1.45558,-0.339513,3.57865>,<1.18996,-0.570446,3.41923>,r}
+	sphere{<1.18996,-0.570446,3.41923>,r}
+	cylinder{<1.18996,-0.570446,3.41923>,<0.9528,-0.194393,3.03645>,r}
+	sphere{<0.9528,-0.194393,3.03645>,r}
+	cylinder{<0.9528,-0.194393,3.03645>,<1.21437,0.194889,3.12658>,r}
+	sphere{<1.21437,0.194889,3.12658>,r}
+	cylinder{<1.21437,0.194889,3.12658>,<1.45262,0.151105,3.3732>,r}
+	sphere{<1.45262,0.151105,3.3732>,r}
+	cylinder{<1.45262,0.151105,3.3732>,<1.45558,-0.339513,3.57865>,r}
+	sphere{<1.45558,-0.339513,3.57865>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.45558,-0.339513,3.57865>,<1.98392,-0.440217,3.43023>,<1.89822,-0.784519,3.15454>}
+	triangle{<1.45558,-0.339513,3.57865>,<1.89822,-0.784519,3.15454>,<1.34375,-0.903288,3.12374>}
+	triangle{<1.45558,-0.339513,3.57865>,<1.34375,-0.903288,3.12374>,<1.18996,-0.570446,3.41923>}
+	texture{t1}
+}
+union{
+	cylinder{<1.45558,-0.339513,3.57865>,<1.98392,-0.440217,3.43023>,r}
+	sphere{<1.98392,-0.440217,3.43023>,r}
+	cylinder{<1.98392,-0.440217,3.43023>,<1.89822,-0.784519,3.15454>,r}
+	sphere{<1.89822,-0.784519,3.15454>,r}
+	cylinder{<1.89822,-0.784519,3.15454>,<1.34375,-0.903288,3.12374>,r}
+	sphere{<1.34375,-0.903288,3.12374>,r}
+	cylinder{<1.34375,-0.903288,3.12374>,<1.18996,-0.570446,3.41923>,r}
+	sphere{<1.18996,-0.570446,3.41923>,r}
+	cylinder{<1.18996,-0.570446,3.41923>,<1.45558,-0.339513,3.57865>,r}
+	sphere{<1.45558,-0.339513,3.57865>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.86885,0.307473,2.8639>,<1.87472,0.227472,3.18861>,<1.45262,0.151105,3.3732>}
+	triangle{<1.86885,0.307473,2.8639>,<1.45262,0.151105,3.3732>,<1.21437,0.194889,3.12658>}
+	triangle{<1.86885,0.307473,2.8639>,<1.21437,0.194889,3.12658>,<1.38179,0.28791,2.8001>}
+	texture{t1}
+}
+union{
+	cylinder{<1.86885,0.307473,2.8639>,<1.87472,0.227472,3.18861>,r}
+	sphere{<1.87472,0.227472,3.18861>,r}
+	cylinder{<1.87472,0.227472,3.18861>,<1.45262,0.151105,3.3732>,r}
+	sphere{<1.45262,0.151105,3.3732>,r}
+	cylinder{<1.45262,0.151105,3.3732>,<1.21437,0.194889,3.12658>,r}
+	sphere{<1.21437,0.194889,3.12658>,r}
+	cylinder{<1.21437,0.194889,3.12658>,<1.38179,0.28791,2.8001>,r}
+	sphere{<1.38179,0.28791,2.8001>,r}
+	cylinder{<1.38179,0.28791,2.8001>,<1.86885,0.307473,2.8639>,r}
+	sphere{<1.86885,0.307473,2.8639>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.98856,-0.337638,2.5654>,<0.9528,-0.194393,3.03645>,<1.18996,-0.570446,3.41923>}
+	triangle{<0.98856,-0.337638,2.5654>,<1.18996,-0.570446,3.41923>,<1.34375,-0.903288,3.12374>}
+	triangle{<0.98856,-0.337638,2.5654>,<1.34375,-0.903288,3.12374>,<1.28089,-0.85049,2.73596>}
+	texture{t1}
+}
+union{
+	cylinder{<0.98856,-0.337638,2.5654>,<0.9528,-0.194393,3.03645>,r}
+	sphere{<0.9528,-0.194393,3.03645>,r}
+	cylinder{<0.9528,-0.194393,3.03645>,<1.18996,-0.570446,3.41923>,r}
+	sphere{<1.18996,-0.570446,3.41923>,r}
+	cylinder{<1.18996,-0.570446,3.41923>,<1.34375,-0.903288,3.12374>,r}
+	sphere{<1.34375,-0.903288,3.12374>,r}
+	cylinder{<1.34375,-0.903288,3.12374>,<1.28089,-0.85049,2.73596>,r}
+	sphere{<1.28089,-0.85049,2.73596>,r}
+	cylinder{<1.28089,-0.85049,2.73596>,<0.98856,-0.337638,2.5654>,r}
+	sphere{<0.98856,-0.337638,2.5654>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.00312,0.6739,2.81441>,<-2.15914,0.42953,2.75867>,<-3,0.429644,2.75868>}
+	triangle{<-2.00312,0.6739,2.81441>,<-3,0.429644,2.75868>,<-3,1.10224,2.91208>}
+	triangle{<-2.00312,0.6739,2.81441>,<-3,1.10224,2.91208>,<-2.21901,1.10239,2.91213>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.00312,0.6739,2.81441>,<-2.15914,0.42953,2.75867>,r}
+	sphere{<-2.15914,0.42953,2.75867>,r}
+	cylinder{<-2.15914,0.42953,2.75867>,<-3,0.429644,2.75868>,r}
+	sphere{<-3,0.429644,2.75868>,r}
+	cylinder{<-3,0.429644,2.75868>,<-3,1.10224,2.91208>,r}
+	sphere{<-3,1.10224,2.91208>,r}
+	cylinder{<-3,1.10224,2.91208>,<-2.21901,1.10239,2.91213>,r}
+	sphere{<-2.21901,1.10239,2.91213>,r}
+	cylinder{<-2.21901,1.10239,2.91213>,<-2.00312,0.6739,2.81441>,r}
+	sphere{<-2.00312,0.6739,2.81441>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.00312,0.6739,2.81441>,<-2.21901,1.10239,2.91213>,<-2.20699,1.48649,2.49954>}
+	triangle{<-2.00312,0.6739,2.81441>,<-2.20699,1.48649,2.49954>,<-1.86625,1.06469,2.09129>}
+	triangle{<-2.00312,0.6739,2.81441>,<-1.86625,1.06469,2.09129>,<-1.8544,1.0253,2.10179>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.00312,0.6739,2.81441>,<-2.21901,1.10239,2.91213>,r}
+	sphere{<-2.21901,1.10239,2.91213>,r}
+	cylinder{<-2.21901,1.10239,2.91213>,<-2.20699,1.48649,2.49954>,r}
+	sphere{<-2.20699,1.48649,2.49954>,r}
+	cylinder{<-2.20699,1.48649,2.49954>,<-1.86625,1.06469,2.09129>,r}
+	sphere{<-1.86625,1.06469,2.09129>,r}
+	cylinder{<-1.86625,1.06469,2.09129>,<-1.8544,1.0253,2.10179>,r}
+	sphere{<-1.8544,1.0253,2.10179>,r}
+	cylinder{<-1.8544,1.0253,2.10179>,<-2.00312,0.6739,2.81441>,r}
+	sphere{<-2.00312,0.6739,2.81441>,r}
+	texture{t2}
+}
+union{
+	triangle{<-3,1.10224,2.91208>,<-3,1.72942,2.23838>,<-2.89776,1.72942,2.23841>}
+	triangle{<-3,1.10224,2.91208>,<-2.89776,1.72942,2.23841>,<-2.20699,1.48649,2.49954>}
+	triangle{<-3,1.10224,2.91208>,<-2.20699,1.48649,2.49954>,<-2.21901,1.10239,2.91213>}
+	texture{t1}
+}
+union{
+	cylinder{<-3,1.10224,2.91208>,<-3,1.72942,2.23838>,r}
+	sphere{<-3,1.72942,2.23838>,r}
+	cylinder{<-3,1.72942,2.23838>,<-2.89776,1.72942,2.23841>,r}
+	sphere{<-2.89776,1.72942,2.23841>,r}
+	cylinder{<-2.89776,1.72942,2.23841>,<-2.20699,1.48649,2.49954>,r}
+	sphere{<-2.20699,1.48649,2.49954>,r}
+	cylinder{<-2.20699,1.48649,2.49954>,<-2.21901,1.10239,2.91213>,r}
+	sphere{<-2.21901,1.10239,2.91213>,r}
+	cylinder{<-2.21901,1.10239,2.91213>,<-3,1.10224,2.91208>,r}
+	sphere{<-3,1.10224,2.91208>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.01375,1.84661,2.5924>,<-1.86962,1.66035,3.18779>,<-2.09304,1.17721,3.15766>}
+	triangle{<-2.01375,1.84661,2.5924>,<-2.09304,1.17721,3.15766>,<-2.21901,1.10239,2.91213>}
+	triangle{<-2.01375,1.84661,2.5924>,<-2.21901,1.10239,2.91213>,<-2.20699,1.48649,2.49954>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.01375,1.84661,2.5924>,<-1.86962,1.66035,3.18779>,r}
+	sphere{<-1.86962,1.66035,3.18779>,r}
+	cylinder{<-1.86962,1.66035,3.18779>,<-2.09304,1.17721,3.15766>,r}
+	sphere{<-2.09304,1.17721,3.15766>,r}
+	cylinder{<-2.09304,1.17721,3.15766>,<-2.21901,1.10239,2.91213>,r}
+	sphere{<-2.21901,1.10239,2.91213>,r}
+	cylinder{<-2.21901,1.10239,2.91213>,<-2.20699,1.48649,2.49954>,r}
+	sphere{<-2.20699,1.48649,2.49954>,r}
+	cylinder{<-2.20699,1.48649,2.49954>,<-2.01375,1.84661,2.5924>,r}
+	sphere{<-2.01375,1.84661,2.5924>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.29204,0.988466,3.26739>,<-1.53589,1.66799,3.23344>,<-1.18617,1.86381,2.71093>}
+	triangle{<-1.29204,0.988466,3.26739>,<-1.18617,1.86381,2.71093>,<-1.182,1.86068,2.70738>}
+	triangle{<-1.29204,0.988466,3.26739>,<-1.182,1.86068,2.70738>,<-0.966848,1.36793,2.6852>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.29204,0.988466,3.26739>,<-1.53589,1.66799,3.23344>,r}
+	sphere{<-1.53589,1.66799,3.23344>,r}
+	cylinder{<-1.53589,1.66799,3.23344>,<-1.18617,1.86381,2.71093>,r}
+	sphere{<-1.18617,1.86381,2.71093>,r}
+	cylinder{<-1.18617,1.86381,2.71093>,<-1.182,1.86068,2.70738>,r}
+	sphere{<-1.182,1.86068,2.70738>,r}
+	cylinder{<-1.182,1.86068,2.70738>,<-0.966848,1.36793,2.6852>,r}
+	sphere{<-0.966848,1.36793,2.6852>,r}
+	cylinder{<-0.966848,1.36793,2.6852>,<-1.29204,0.988466,3.26739>,r}
+	sphere{<-1.29204,0.988466,3.26739>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.29204,0.988466,3.26739>,<-0.966848,1.36793,2.6852>,<-1.19465,0.964102,2.25122>}
+	triangle{<-1.29204,0.988466,3.26739>,<-1.19465,0.964102,2.25122>,<-1.44364,0.690603,2.80094>}
+	triangle{<-1.29204,0.988466,3.26739>,<-1.44364,0.690603,2.80094>,<-1.31307,0.957292,3.26454>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.29204,0.988466,3.26739>,<-0.966848,1.36793,2.6852>,r}
+	sphere{<-0.966848,1.36793,2.6852>,r}
+	cylinder{<-0.966848,1.36793,2.6852>,<-1.19465,0.964102,2.25122>,r}
+	sphere{<-1.19465,0.964102,2.25122>,r}
+	cylinder{<-1.19465,0.964102,2.25122>,<-1.44364,0.690603,2.80094>,r}
+	sphere{<-1.44364,0.690603,2.80094>,r}
+	cylinder{<-1.44364,0.690603,2.80094>,<-1.31307,0.957292,3.26454>,r}
+	sphere{<-1.31307,0.957292,3.26454>,r}
+	cylinder{<-1.31307,0.957292,3.26454>,<-1.29204,0.988466,3.26739>,r}
+	sphere{<-1.29204,0.988466,3.26739>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.00312,0.6739,2.81441>,<-2.21901,1.10239,2.91213>,<-2.09304,1.17721,3.15766>}
+	triangle{<-2.00312,0.6739,2.81441>,<-2.09304,1.17721,3.15766>,<-1.87915,0.888319,3.18717>}
+	triangle{<-2.00312,0.6739,2.81441>,<-1.87915,0.888319,3.18717>,<-2.0023,0.673521,2.81521>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.00312,0.6739,2.81441>,<-2.21901,1.10239,2.91213>,r}
+	sphere{<-2.21901,1.10239,2.91213>,r}
+	cylinder{<-2.21901,1.10239,2.91213>,<-2.09304,1.17721,3.15766>,r}
+	sphere{<-2.09304,1.17721,3.15766>,r}
+	cylinder{<-2.09304,1.17721,3.15766>,<-1.87915,0.888319,3.18717>,r}
+	sphere{<-1.87915,0.888319,3.18717>,r}
+	cylinder{<-1.87915,0.888319,3.18717>,<-2.0023,0.673521,2.81521>,r}
+	sphere{<-2.0023,0.673521,2.81521>,r}
+	cylinder{<-2.0023,0.673521,2.81521>,<-2.00312,0.6739,2.81441>,r}
+	sphere{<-2.00312,0.6739,2.81441>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.332574,0.3175,2.09205>,<0.166967,0.174275,2.40094>,<0.0643369,0.501834,2.54225>}
+	triangle{<0.332574,0.3175,2.09205>,<0.0643369,0.501834,2.54225>,<0.291476,0.504919,2.14187>}
+	triangle{<0.332574,0.3175,2.09205>,<0.291476,0.504919,2.14187>,<0.311864,0.466816,2.11055>}
+	texture{t1}
+}
+union{
+	cylinder{<0.332574,0.3175,2.09205>,<0.166967,0.174275,2.40094>,r}
+	sphere{<0.166967,0.174275,2.40094>,r}
+	cylinder{<0.166967,0.174275,2.40094>,<0.0643369,0.501834,2.54225>,r}
+	sphere{<0.0643369,0.501834,2.54225>,r}
+	cylinder{<0.0643369,0.501834,2.54225>,<0.291476,0.504919,2.14187>,r}
+	sphere{<0.291476,0.504919,2.14187>,r}
+	cylinder{<0.291476,0.504919,2.14187>,<0.311864,0.466816,2.11055>,r}
+	sphere{<0.311864,0.466816,2.11055>,r}
+	cylinder{<0.311864,0.466816,2.11055>,<0.332574,0.3175,2.09205>,r}
+	sphere{<0.332574,0.3175,2.09205>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.291476,0.504919,2.14187>,<0.0643369,0.501834,2.54225>,<0.0671471,0.5594,2.64086>}
+	triangle{<0.291476,0.504919,2.14187>,<0.0671471,0.5594,2.64086>,<0.324329,0.846029,2.69722>}
+	triangle{<0.291476,0.504919,2.14187>,<0.324329,0.846029,2.69722>,<0.467186,0.878904,2.50109>}
+	texture{t1}
+}
+union{
+	cylinder{<0.291476,0.504919,2.14187>,<0.0643369,0.501834,2.54225>,r}
+	sphere{<0.0643369,0.501834,2.54225>,r}
+	cylinder{<0.0643369,0.501834,2.54225>,<0.0671471,0.5594,2.64086>,r}
+	sphere{<0.0671471,0.5594,2.64086>,r}
+	cylinder{<0.0671471,0.5594,2.64086>,<0.324329,0.846029,2.69722>,r}
+	sphere{<0.324329,0.846029,2.69722>,r}
+	cylinder{<0.324329,0.846029,2.69722>,<0.467186,0.878904,2.50109>,r}
+	sphere{<0.467186,0.878904,2.50109>,r}
+	cylinder{<0.467186,0.878904,2.50109>,<0.291476,0.504919,2.14187>,r}
+	sphere{<0.291476,0.504919,2.14187>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.0827516,1.29928,2.85677>,<0.324329,0.846029,2.69722>,<0.0671471,0.5594,2.64086>}
+	triangle{<0.0827516,1.29928,2.85677>,<0.0671471,0.5594,2.64086>,<-0.120234,0.581941,2.66785>}
+	triangle{<0.0827516,1.29928,2.85677>,<-0.120234,0.581941,2.66785>,<-0.347068,1.26686,2.89394>}
+	texture{t1}
+}
+union{
+	cylinder{<0.0827516,1.29928,2.85677>,<0.324329,0.846029,2.69722>,r}
+	sphere{<0.324329,0.846029,2.69722>,r}
+	cylinder{<0.324329,0.846029,2.69722>,<0.0671471,0.5594,2.64086>,r}
+	sphere{<0.0671471,0.5594,2.64086>,r}
+	cylinder{<0.0671471,0.5594,2.64086>,<-0.120234,0.581941,2.66785>,r}
+	sphere{<-0.120234,0.581941,2.66785>,r}
+	cylinder{<-0.120234,0.581941,2.66785>,<-0.347068,1.26686,2.89394>,r}
+	sphere{<-0.347068,1.26686,2.89394>,r}
+	cylinder{<-0.347068,1.26686,2.89394>,<0.0827516,1.29928,2.85677>,r}
+	sphere{<0.0827516,1.29928,2.85677>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.791213,0.079693,3.05045>,<-0.953958,0.103815,3.0827>,<-1.05671,0.741025,3.49553>}
+	triangle{<-0.791213,0.079693,3.05045>,<-1.05671,0.741025,3.49553>,<-0.664265,0.823417,3.50643>}
+	triangle{<-0.791213,0.079693,3.05045>,<-0.664265,0.823417,3.50643>,<-0.437823,0.412014,3.22314>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.791213,0.079693,3.05045>,<-0.953958,0.103815,3.0827>,r}
+	sphere{<-0.953958,0.103815,3.0827>,r}
+	cylinder{<-0.953958,0.103815,3.0827>,<-1.05671,0.741025,3.49553>,r}
+	sphere{<-1.05671,0.741025,3.49553>,r}
+	cylinder{<-1.05671,0.741025,3.49553>,<-0.664265,0.823417,3.50643>,r}
+	sphere{<-0.664265,0.823417,3.50643>,r}
+	cylinder{<-0.664265,0.823417,3.50643>,<-0.437823,0.412014,3.22314>,r}
+	sphere{<-0.437823,0.412014,3.22314>,r}
+	cylinder{<-0.437823,0.412014,3.22314>,<-0.791213,0.079693,3.05045>,r}
+	sphere{<-0.791213,0.079693,3.05045>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.22576,0.875701,2.56236>,<1.19513,0.906764,2.58324>,<1.0378,1.53351,2.28574>}
+	triangle{<1.22576,0.875701,2.56236>,<1.0378,1.53351,2.28574>,<1.37847,1.31967,1.93965>}
+	triangle{<1.22576,0.875701,2.56236>,<1.37847,1.31967,1.93965>,<1.48395,0.988805,2.06172>}
+	texture{t1}
+}
+union{
+	cylinder{<1.22576,0.875701,2.56236>,<1.19513,0.906764,2.58324>,r}
+	sphere{<1.19513,0.906764,2.58324>,r}
+	cylinder{<1.19513,0.906764,2.58324>,<1.0378,1.53351,2.28574>,r}
+	sphere{<1.0378,1.53351,2.28574>,r}
+	cylinder{<1.0378,1.53351,2.28574>,<1.37847,1.31967,1.93965>,r}
+	sphere{<1.37847,1.31967,1.93965>,r}
+	cylinder{<1.37847,1.31967,1.93965>,<1.48395,0.988805,2.06172>,r}
+	sphere{<1.48395,0.988805,2.06172>,r}
+	cylinder{<1.48395,0.988805,2.06172>,<1.22576,0.875701,2.56236>,r}
+	sphere{<1.22576,0.875701,2.56236>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.467186,0.878904,2.50109>,<0.291476,0.504919,2.14187>,<0.280005,0.519016,2.09191>}
+	triangle{<0.467186,0.878904,2.50109>,<0.280005,0.519016,2.09191>,<0.25591,0.975584,1.69301>}
+	triangle{<0.467186,0.878904,2.50109>,<0.25591,0.975584,1.69301>,<0.524795,1.66926,2.15916>}
+	texture{t1}
+}
+union{
+	cylinder{<0.467186,0.878904,2.50109>,<0.291476,0.504919,2.14187>,r}
+	sphere{<0.291476,0.504919,2.14187>,r}
+	cylinder{<0.291476,0.504919,2.14187>,<0.280005,0.519016,2.09191>,r}
+	sphere{<0.280005,0.519016,2.09191>,r}
+	cylinder{<0.280005,0.519016,2.09191>,<0.25591,0.975584,1.69301>,r}
+	sphere{<0.25591,0.975584,1.69301>,r}
+	cylinder{<0.25591,0.975584,1.69301>,<0.524795,1.66926,2.15916>,r}
+	sphere{<0.524795,1.66926,2.15916>,r}
+	cylinder{<0.524795,1.66926,2.15916>,<0.467186,0.878904,2.50109>,r}
+	sphere{<0.467186,0.878904,2.50109>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.98856,-0.337638,2.5654>,<0.9528,-0.194393,3.03645>,<1.21437,0.194889,3.12658>}
+	triangle{<0.98856,-0.337638,2.5654>,<1.21437,0.194889,3.12658>,<1.38179,0.28791,2.8001>}
+	triangle{<0.98856,-0.337638,2.5654>,<1.38179,0.28791,2.8001>,<1.20471,-0.118388,2.38786>}
+	texture{t1}
+}
+union{
+	cylinder{<0.98856,-0.337638,2.5654>,<0.9528,-0.194393,3.03645>,r}
+	sphere{<0.9528,-0.194393,3.03645>,r}
+	cylinder{<0.9528,-0.194393,3.03645>,<1.21437,0.194889,3.12658>,r}
+	sphere{<1.21437,0.194889,3.12658>,r}
+	cylinder{<1.21437,0.194889,3.12658>,<1.38179,0.28791,2.8001>,r}
+	sphere{<1.38179,0.28791,2.8001>,r}
+	cylinder{<1.38179,0.28791,2.8001>,<1.20471,-0.118388,2.38786>,r}
+	sphere{<1.20471,-0.118388,2.38786>,r}
+	cylinder{<1.20471,-0.118388,2.38786>,<0.98856,-0.337638,2.5654>,r}
+	sphere{<0.98856,-0.337638,2.5654>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.98856,-0.337638,2.5654>,<0.934636,-0.345033,2.52985>,<0.450748,-0.248844,2.75349>}
+	triangle{<0.98856,-0.337638,2.5654>,<0.450748,-0.248844,2.75349>,<0.508774,-0.141173,3.12467>}
+	triangle{<0.98856,-0.337638,2.5654>,<0.508774,-0.141173,3.12467>,<0.9528,-0.194393,3.03645>}
+	texture{t1}
+}
+union{
+	cylinder{<0.98856,-0.337638,2.5654>,<0.934636,-0.345033,2.52985>,r}
+	sphere{<0.934636,-0.345033,2.52985>,r}
+	cylinder{<0.934636,-0.345033,2.52985>,<0.450748,-0.248844,2.75349>,r}
+	sphere{<0.450748,-0.248844,2.75349>,r}
+	cylinder{<0.450748,-0.248844,2.75349>,<0.508774,-0.141173,3.12467>,r}
+	sphere{<0.508774,-0.141173,3.12467>,r}
+	cylinder{<0.508774,-0.141173,3.12467>,<0.9528,-0.194393,3.03645>,r}
+	sphere{<0.9528,-0.194393,3.03645>,r}
+	cylinder{<0.9528,-0.194393,3.03645>,<0.98856,-0.337638,2.5654>,r}
+	sphere{<0.98856,-0.337638,2.5654>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.508774,-0.141173,3.12467>,<0.383541,0.243885,3.27456>,<0.764802,0.669065,3.35788>}
+	triangle{<0.508774,-0.141173,3.12467>,<0.764802,0.669065,3.35788>,<1.21437,0.194889,3.12658>}
+	triangle{<0.508774,-0.141173,3.12467>,<1.21437,0.194889,3.12658>,<0.9528,-0.194393,3.03645>}
+	texture{t1}
+}
+union{
+	cylinder{<0.508774,-0.141173,3.12467>,<0.383541,0.243885,3.27456>,r}
+	sphere{<0.383541,0.243885,3.27456>,r}
+	cylinder{<0.383541,0.243885,3.27456>,<0.764802,0.669065,3.35788>,r}
+	sphere{<0.764802,0.669065,3.35788>,r}
+	cylinder{<0.764802,0.669065,3.35788>,<1.21437,0.194889,3.12658>,r}
+	sphere{<1.21437,0.194889,3.12658>,r}
+	cylinder{<1.21437,0.194889,3.12658>,<0.9528,-0.194393,3.03645>,r}
+	sphere{<0.9528,-0.194393,3.03645>,r}
+	cylinder{<0.9528,-0.194393,3.03645>,<0.508774,-0.141173,3.12467>,r}
+	sphere{<0.508774,-0.141173,3.12467>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.763151,0.761353,3.27801>,<0.764802,0.669065,3.35788>,<0.383541,0.243885,3.27456>}
+	triangle{<0.763151,0.761353,3.27801>,<0.383541,0.243885,3.27456>,<0.0671471,0.5594,2.64086>}
+	triangle{<0.763151,0.761353,3.27801>,<0.0671471,0.5594,2.64086>,<0.324329,0.846029,2.69722>}
+	texture{t1}
+}
+union{
+	cylinder{<0.763151,0.761353,3.27801>,<0.764802,0.669065,3.35788>,r}
+	sphere{<0.764802,0.669065,3.35788>,r}
+	cylinder{<0.764802,0.669065,3.35788>,<0.383541,0.243885,3.27456>,r}
+	sphere{<0.383541,0.243885,3.27456>,r}
+	cylinder{<0.383541,0.243885,3.27456>,<0.0671471,0.5594,2.64086>,r}
+	sphere{<0.0671471,0.5594,2.64086>,r}
+	cylinder{<0.0671471,0.5594,2.64086>,<0.324329,0.846029,2.69722>,r}
+	sphere{<0.324329,0.846029,2.69722>,r}
+	cylinder{<0.324329,0.846029,2.69722>,<0.763151,0.761353,3.27801>,r}
+	sphere{<0.763151,0.761353,3.27801>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.21412,1.83563,2.74832>,<1.06808,1.72207,2.38277>,<1.0378,1.53351,2.28574>}
+	triangle{<1.21412,1.83563,2.74832>,<1.0378,1.53351,2.28574>,<1.19513,0.906764,2.58324>}
+	triangle{<1.21412,1.83563,2.74832>,<1.19513,0.906764,2.58324>,<1.39115,1.44414,3.12341>}
+	texture{t1}
+}
+union{
+	cylinder{<1.21412,1.83563,2.74832>,<1.06808,1.72207,2.38277>,r}
+	sphere{<1.06808,1.72207,2.38277>,r}
+	cylinder{<1.06808,1.72207,2.38277>,<1.0378,1.53351,2.28574>,r}
+	sphere{<1.0378,1.53351,2.28574>,r}
+	cylinder{<1.0378,1.53351,2.28574>,<1.19513,0.906764,2.58324>,r}
+	sphere{<1.19513,0.906764,2.58324>,r}
+	cylinder{<1.19513,0.906764,2.58324>,<1.39115,1.44414,3.12341>,r}
+	sphere{<1.39115,1.44414,3.12341>,r}
+	cylinder{<1.39115,1.44414,3.12341>,<1.21412,1.83563,2.74832>,r}
+	sphere{<1.21412,1.83563,2.74832>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.3346,0.550154,1.5675>,<1.88142,0.457715,1.61407>,<1.83644,0.527626,1.15404>}
+	triangle{<1.3346,0.550154,1.5675>,<1.83644,0.527626,1.15404>,<1.52731,0.572538,1.1815>}
+	triangle{<1.3346,0.550154,1.5675>,<1.52731,0.572538,1.1815>,<1.30431,0.563655,1.50356>}
+	texture{t1}
+}
+union{
+	cylinder{<1.3346,0.550154,1.5675>,<1.88142,0.457715,1.61407>,r}
+	sphere{<1.88142,0.457715,1.61407>,r}
+	cylinder{<1.88142,0.457715,1.61407>,<1.83644,0.527626,1.15404>,r}
+	sphere{<1.83644,0.527626,1.15404>,r}
+	cylinder{<1.83644,0.527626,1.15404>,<1.52731,0.572538,1.1815>,r}
+	sphere{<1.52731,0.572538,1.1815>,r}
+	cylinder{<1.52731,0.572538,1.1815>,<1.30431,0.563655,1.50356>,r}
+	sphere{<1.30431,0.563655,1.50356>,r}
+	cylinder{<1.30431,0.563655,1.50356>,<1.3346,0.550154,1.5675>,r}
+	sphere{<1.3346,0.550154,1.5675>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.3346,0.550154,1.5675>,<1.48395,0.988805,2.06172>,<1.8911,0.956357,2.13415>}
+	triangle{<1.3346,0.550154,1.5675>,<1.8911,0.956357,2.13415>,<2.09357,0.609993,1.82742>}
+	triangle{<1.3346,0.550154,1.5675>,<2.09357,0.609993,1.82742>,<1.88142,0.457715,1.61407>}
+	texture{t1}
+}
+union{
+	cylinder{<1.3346,0.550154,1.5675>,<1.48395,0.988805,2.06172>,r}
+	sphere{<1.48395,0.988805,2.06172>,r}
+	cylinder{<1.48395,0.988805,2.06172>,<1.8911,0.956357,2.13415>,r}
+	sphere{<1.8911,0.956357,2.13415>,r}
+	cylinder{<1.8911,0.956357,2.13415>,<2.09357,0.609993,1.82742>,r}
+	sphere{<2.09357,0.609993,1.82742>,r}
+	cylinder{<2.09357,0.609993,1.82742>,<1.88142,0.457715,1.61407>,r}
+	sphere{<1.88142,0.457715,1.61407>,r}
+	cylinder{<1.88142,0.457715,1.61407>,<1.3346,0.550154,1.5675>,r}
+	sphere{<1.3346,0.550154,1.5675>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.3346,0.550154,1.5675>,<1.30431,0.563655,1.50356>,<1.19809,1.28057,1.5166>}
+	triangle{<1.3346,0.550154,1.5675>,<1.19809,1.28057,1.5166>,<1.37847,1.31967,1.93965>}
+	triangle{<1.3346,0.550154,1.5675>,<1.37847,1.31967,1.93965>,<1.48395,0.988805,2.06172>}
+	texture{t1}
+}
+union{
+	cylinder{<1.3346,0.550154,1.5675>,<1.30431,0.563655,1.50356>,r}
+	sphere{<1.30431,0.563655,1.50356>,r}
+	cylinder{<1.30431,0.563655,1.50356>,<1.19809,1.28057,1.5166>,r}
+	sphere{<1.19809,1.28057,1.5166>,r}
+	cylinder{<1.19809,1.28057,1.5166>,<1.37847,1.31967,1.93965>,r}
+	sphere{<1.37847,1.31967,1.93965>,r}
+	cylinder{<1.37847,1.31967,1.93965>,<1.48395,0.988805,2.06172>,r}
+	sphere{<1.48395,0.988805,2.06172>,r}
+	cylinder{<1.48395,0.988805,2.06172>,<1.3346,0.550154,1.5675>,r}
+	sphere{<1.3346,0.550154,1.5675>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.46318,1.3254,1.68724>,<2.12547,1.37719,2.03504>,<1.8586,1.72069,1.88433>}
+	triangle{<2.46318,1.3254,1.68724>,<1.8586,1.72069,1.88433>,<1.92566,1.83679,1.63752>}
+	triangle{<2.46318,1.3254,1.68724>,<1.92566,1.83679,1.63752>,<1.97423,1.82567,1.59266>}
+	texture{t1}
+}
+union{
+	cylinder{<2.46318,1.3254,1.68724>,<2.12547,1.37719,2.03504>,r}
+	sphere{<2.12547,1.37719,2.03504>,r}
+	cylinder{<2.12547,1.37719,2.03504>,<1.8586,1.72069,1.88433>,r}
+	sphere{<1.8586,1.72069,1.88433>,r}
+	cylinder{<1.8586,1.72069,1.88433>,<1.92566,1.83679,1.63752>,r}
+	sphere{<1.92566,1.83679,1.63752>,r}
+	cylinder{<1.92566,1.83679,1.63752>,<1.97423,1.82567,1.59266>,r}
+	sphere{<1.97423,1.82567,1.59266>,r}
+	cylinder{<1.97423,1.82567,1.59266>,<2.46318,1.3254,1.68724>,r}
+	sphere{<2.46318,1.3254,1.68724>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.46318,1.3254,1.68724>,<2.54723,1.11876,1.54033>,<2.09357,0.609993,1.82742>}
+	triangle{<2.46318,1.3254,1.68724>,<2.09357,0.609993,1.82742>,<1.8911,0.956357,2.13415>}
+	triangle{<2.46318,1.3254,1.68724>,<1.8911,0.956357,2.13415>,<2.12547,1.37719,2.03504>}
+	texture{t1}
+}
+union{
+	cylinder{<2.46318,1.3254,1.68724>,<2.54723,1.11876,1.54033>,r}
+	sphere{<2.54723,1.11876,1.54033>,r}
+	cylinder{<2.54723,1.11876,1.54033>,<2.09357,0.609993,1.82742>,r}
+	sphere{<2.09357,0.609993,1.82742>,r}
+	cylinder{<2.09357,0.609993,1.82742>,<1.8911,0.956357,2.13415>,r}
+	sphere{<1.8911,0.956357,2.13415>,r}
+	cylinder{<1.8911,0.956357,2.13415>,<2.12547,1.37719,2.03504>,r}
+	sphere{<2.12547,1.37719,2.03504>,r}
+	cylinder{<2.12547,1.37719,2.03504>,<2.46318,1.3254,1.68724>,r}
+	sphere{<2.46318,1.3254,1.68724>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.12547,1.37719,2.03504>,<1.8911,0.956357,2.13415>,<1.48395,0.988805,2.06172>}
+	triangle{<2.12547,1.37719,2.03504>,<1.48395,0.988805,2.06172>,<1.37847,1.31967,1.93965>}
+	triangle{<2.12547,1.37719,2.03504>,<1.37847,1.31967,1.93965>,<1.8586,1.72069,1.88433>}
+	texture{t1}
+}
+union{
+	cylinder{<2.12547,1.37719,2.03504>,<1.8911,0.956357,2.13415>,r}
+	sphere{<1.8911,0.956357,2.13415>,r}
+	cylinder{<1.8911,0.956357,2.13415>,<1.48395,0.988805,2.06172>,r}
+	sphere{<1.48395,0.988805,2.06172>,r}
+	cylinder{<1.48395,0.988805,2.06172>,<1.37847,1.31967,1.93965>,r}
+	sphere{<1.37847,1.31967,1.93965>,r}
+	cylinder{<1.37847,1.31967,1.93965>,<1.8586,1.72069,1.88433>,r}
+	sphere{<1.8586,1.72069,1.88433>,r}
+	cylinder{<1.8586,1.72069,1.88433>,<2.12547,1.37719,2.03504>,r}
+	sphere{<2.12547,1.37719,2.03504>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.8911,0.956357,2.13415>,<2.12547,1.37719,2.03504>,<2.29107,1.44043,2.45895>}
+	triangle{<1.8911,0.956357,2.13415>,<2.29107,1.44043,2.45895>,<2.08748,0.938608,2.83252>}
+	triangle{<1.8911,0.956357,2.13415>,<2.08748,0.938608,2.83252>,<1.96956,0.81704,2.69217>}
+	texture{t1}
+}
+union{
+	cylinder{<1.8911,0.956357,2.13415>,<2.12547,1.37719,2.03504>,r}
+	sphere{<2.12547,1.37719,2.03504>,r}
+	cylinder{<2.12547,1.37719,2.03504>,<2.29107,1.44043,2.45895>,r}
+	sphere{<2.29107,1.44043,2.45895>,r}
+	cylinder{<2.29107,1.44043,2.45895>,<2.08748,0.938608,2.83252>,r}
+	sphere{<2.08748,0.938608,2.83252>,r}
+	cylinder{<2.08748,0.938608,2.83252>,<1.96956,0.81704,2.69217>,r}
+	sphere{<1.96956,0.81704,2.69217>,r}
+	cylinder{<1.96956,0.81704,2.69217>,<1.8911,0.956357,2.13415>,r}
+	sphere{<1.8911,0.956357,2.13415>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.29107,1.44043,2.45895>,<3,1.4406,2.45906>,<3,0.935449,2.83519>}
+	triangle{<2.29107,1.44043,2.45895>,<3,0.935449,2.83519>,<2.08836,0.937582,2.83329>}
+	triangle{<2.29107,1.44043,2.45895>,<2.08836,0.937582,2.83329>,<2.08748,0.938608,2.83252>}
+	texture{t1}
+}
+union{
+	cylinder{<2.29107,1.44043,2.45895>,<3,1.4406,2.45906>,r}
+	sphere{<3,1.4406,2.45906>,r}
+	cylinder{<3,1.4406,2.45906>,<3,0.935449,2.83519>,r}
+	sphere{<3,0.935449,2.83519>,r}
+	cylinder{<3,0.935449,2.83519>,<2.08836,0.937582,2.83329>,r}
+	sphere{<2.08836,0.937582,2.83329>,r}
+	cylinder{<2.08836,0.937582,2.83329>,<2.08748,0.938608,2.83252>,r}
+	sphere{<2.08748,0.938608,2.83252>,r}
+	cylinder{<2.08748,0.938608,2.83252>,<2.29107,1.44043,2.45895>,r}
+	sphere{<2.29107,1.44043,2.45895>,r}
+	texture{t2}
+}
+union{
+	triangle{<3,0.935449,2.83519>,<3,0.40007,2.52605>,<2.21232,0.400268,2.52346>}
+	triangle{<3,0.935449,2.83519>,<2.21232,0.400268,2.52346>,<2.00969,0.747708,2.72338>}
+	triangle{<3,0.935449,2.83519>,<2.00969,0.747708,2.72338>,<2.08836,0.937582,2.83329>}
+	texture{t1}
+}
+union{
+	cylinder{<3,0.935449,2.83519>,<3,0.40007,2.52605>,r}
+	sphere{<3,0.40007,2.52605>,r}
+	cylinder{<3,0.40007,2.52605>,<2.21232,0.400268,2.52346>,r}
+	sphere{<2.21232,0.400268,2.52346>,r}
+	cylinder{<2.21232,0.400268,2.52346>,<2.00969,0.747708,2.72338>,r}
+	sphere{<2.00969,0.747708,2.72338>,r}
+	cylinder{<2.00969,0.747708,2.72338>,<2.08836,0.937582,2.83329>,r}
+	sphere{<2.08836,0.937582,2.83329>,r}
+	cylinder{<2.08836,0.937582,2.83329>,<3,0.935449,2.83519>,r}
+	sphere{<3,0.935449,2.83519>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.0095,-0.0173004,2.04332>,<0.916906,0.140749,1.90191>,<1.19931,0.843467,2.5703>}
+	triangle{<1.0095,-0.0173004,2.04332>,<1.19931,0.843467,2.5703>,<1.38179,0.28791,2.8001>}
+	triangle{<1.0095,-0.0173004,2.04332>,<1.38179,0.28791,2.8001>,<1.20471,-0.118388,2.38786>}
+	texture{t1}
+}
+union{
+	cylinder{<1.0095,-0.0173004,2.04332>,<0.916906,0.140749,1.90191>,r}
+	sphere{<0.916906,0.140749,1.90191>,r}
+	cylinder{<0.916906,0.140749,1.90191>,<1.19931,0.843467,2.5703>,r}
+	sphere{<1.19931,0.843467,2.5703>,r}
+	cylinder{<1.19931,0.843467,2.5703>,<1.38179,0.28791,2.8001>,r}
+	sphere{<1.38179,0.28791,2.8001>,r}
+	cylinder{<1.38179,0.28791,2.8001>,<1.20471,-0.118388,2.38786>,r}
+	sphere{<1.20471,-0.118388,2.38786>,r}
+	cylinder{<1.20471,-0.118388,2.38786>,<1.0095,-0.0173004,2.04332>,r}
+	sphere{<1.0095,-0.0173004,2.04332>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.20471,-0.118388,2.38786>,<1.38179,0.28791,2.8001>,<1.86885,0.307473,2.8639>}
+	triangle{<1.20471,-0.118388,2.38786>,<1.86885,0.307473,2.8639>,<2.04408,0.113312,2.69076>}
+	triangle{<1.20471,-0.118388,2.38786>,<2.04408,0.113312,2.69076>,<1.81662,-0.282953,2.28367>}
+	texture{t1}
+}
+union{
+	cylinder{<1.20471,-0.118388,2.38786>,<1.38179,0.28791,2.8001>,r}
+	sphere{<1.38179,0.28791,2.8001>,r}
+	cylinder{<1.38179,0.28791,2.8001>,<1.86885,0.307473,2.8639>,r}
+	sphere{<1.86885,0.307473,2.8639>,r}
+	cylinder{<1.86885,0.307473,2.8639>,<2.04408,0.113312,2.69076>,r}
+	sphere{<2.04408,0.113312,2.69076>,r}
+	cylinder{<2.04408,0.113312,2.69076>,<1.81662,-0.282953,2.28367>,r}
+	sphere{<1.81662,-0.282953,2.28367>,r}
+	cylinder{<1.81662,-0.282953,2.28367>,<1.20471,-0.118388,2.38786>,r}
+	sphere{<1.20471,-0.118388,2.38786>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.98744,1.41396,1.34614>,<-2.42486,1.77115,1.24275>,<-3,1.73009,1.75529>}
+	triangle{<-1.98744,1.41396,1.34614>,<-3,1.73009,1.75529>,<-3,1.60487,1.9143>}
+	triangle{<-1.98744,1.41396,1.34614>,<-3,1.60487,1.9143>,<-2.06062,1.04894,1.86822>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.98744,1.41396,1.34614>,<-2.42486,1.77115,1.24275>,r}
+	sphere{<-2.42486,1.77115,1.24275>,r}
+	cylinder{<-2.42486,1.77115,1.24275>,<-3,1.73009,1.75529>,r}
+	sphere{<-3,1.73009,1.75529>,r}
+	cylinder{<-3,1.73009,1.75529>,<-3,1.60487,1.9143>,r}
+	sphere{<-3,1.60487,1.9143>,r}
+	cylinder{<-3,1.60487,1.9143>,<-2.06062,1.04894,1.86822>,r}
+	sphere{<-2.06062,1.04894,1.86822>,r}
+	cylinder{<-2.06062,1.04894,1.86822>,<-1.98744,1.41396,1.34614>,r}
+	sphere{<-1.98744,1.41396,1.34614>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.86625,1.06469,2.09129>,<-2.20699,1.48649,2.49954>,<-2.01375,1.84661,2.5924>}
+	triangle{<-1.86625,1.06469,2.09129>,<-2.01375,1.84661,2.5924>,<-1.53052,1.94581,2.39088>}
+	triangle{<-1.86625,1.06469,2.09129>,<-1.53052,1.94581,2.39088>,<-1.54933,1.32239,2.0634>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.86625,1.06469,2.09129>,<-2.20699,1.48649,2.49954>,r}
+	sphere{<-2.20699,1.48649,2.49954>,r}
+	cylinder{<-2.20699,1.48649,2.49954>,<-2.01375,1.84661,2.5924>,r}
+	sphere{<-2.01375,1.84661,2.5924>,r}
+	cylinder{<-2.01375,1.84661,2.5924>,<-1.53052,1.94581,2.39088>,r}
+	sphere{<-1.53052,1.94581,2.39088>,r}
+	cylinder{<-1.53052,1.94581,2.39088>,<-1.54933,1.32239,2.0634>,r}
+	sphere{<-1.54933,1.32239,2.0634>,r}
+	cylinder{<-1.54933,1.32239,2.0634>,<-1.86625,1.06469,2.09129>,r}
+	sphere{<-1.86625,1.06469,2.09129>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.03722,2.40217,1.98266>,<-3,1.85631,1.98234>,<-3,1.73009,1.75529>}
+	triangle{<-2.03722,2.40217,1.98266>,<-3,1.73009,1.75529>,<-2.42486,1.77115,1.24275>}
+	triangle{<-2.03722,2.40217,1.98266>,<-2.42486,1.77115,1.24275>,<-1.93514,2.19196,1.50044>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.03722,2.40217,1.98266>,<-3,1.85631,1.98234>,r}
+	sphere{<-3,1.85631,1.98234>,r}
+	cylinder{<-3,1.85631,1.98234>,<-3,1.73009,1.75529>,r}
+	sphere{<-3,1.73009,1.75529>,r}
+	cylinder{<-3,1.73009,1.75529>,<-2.42486,1.77115,1.24275>,r}
+	sphere{<-2.42486,1.77115,1.24275>,r}
+	cylinder{<-2.42486,1.77115,1.24275>,<-1.93514,2.19196,1.50044>,r}
+	sphere{<-1.93514,2.19196,1.50044>,r}
+	cylinder{<-1.93514,2.19196,1.50044>,<-2.03722,2.40217,1.98266>,r}
+	sphere{<-2.03722,2.40217,1.98266>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.03722,2.40217,1.98266>,<-1.93514,2.19196,1.50044>,<-1.4456,1.82018,1.62099>}
+	triangle{<-2.03722,2.40217,1.98266>,<-1.4456,1.82018,1.62099>,<-1.51173,2.05981,2.32901>}
+	triangle{<-2.03722,2.40217,1.98266>,<-1.51173,2.05981,2.32901>,<-1.80871,2.29843,2.30586>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.03722,2.40217,1.98266>,<-1.93514,2.19196,1.50044>,r}
+	sphere{<-1.93514,2.19196,1.50044>,r}
+	cylinder{<-1.93514,2.19196,1.50044>,<-1.4456,1.82018,1.62099>,r}
+	sphere{<-1.4456,1.82018,1.62099>,r}
+	cylinder{<-1.4456,1.82018,1.62099>,<-1.51173,2.05981,2.32901>,r}
+	sphere{<-1.51173,2.05981,2.32901>,r}
+	cylinder{<-1.51173,2.05981,2.32901>,<-1.80871,2.29843,2.30586>,r}
+	sphere{<-1.80871,2.29843,2.30586>,r}
+	cylinder{<-1.80871,2.29843,2.30586>,<-2.03722,2.40217,1.98266>,r}
+	sphere{<-2.03722,2.40217,1.98266>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.80871,2.29843,2.30586>,<-1.51173,2.05981,2.32901>,<-1.53052,1.94581,2.39088>}
+	triangle{<-1.80871,2.29843,2.30586>,<-1.53052,1.94581,2.39088>,<-2.01375,1.84661,2.5924>}
+	triangle{<-1.80871,2.29843,2.30586>,<-2.01375,1.84661,2.5924>,<-2.0917,1.94978,2.56644>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.80871,2.29843,2.30586>,<-1.51173,2.05981,2.32901>,r}
+	sphere{<-1.51173,2.05981,2.32901>,r}
+	cylinder{<-1.51173,2.05981,2.32901>,<-1.53052,1.94581,2.39088>,r}
+	sphere{<-1.53052,1.94581,2.39088>,r}
+	cylinder{<-1.53052,1.94581,2.39088>,<-2.01375,1.84661,2.5924>,r}
+	sphere{<-2.01375,1.84661,2.5924>,r}
+	cylinder{<-2.01375,1.84661,2.5924>,<-2.0917,1.94978,2.56644>,r}
+	sphere{<-2.0917,1.94978,2.56644>,r}
+	cylinder{<-2.0917,1.94978,2.56644>,<-1.80871,2.29843,2.30586>,r}
+	sphere{<-1.80871,2.29843,2.30586>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.51173,2.05981,2.32901>,<-1.4456,1.82018,1.62099>,<-1.45609,1.6729,1.59156>}
+	triangle{<-1.51173,2.05981,2.32901>,<-1.45609,1.6729,1.59156>,<-1.54933,1.32239,2.0634>}
+	triangle{<-1.51173,2.05981,2.32901>,<-1.54933,1.32239,2.0634>,<-1.53052,1.94581,2.39088>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.51173,2.05981,2.32901>,<-1.4456,1.82018,1.62099>,r}
+	sphere{<-1.4456,1.82018,1.62099>,r}
+	cylinder{<-1.4456,1.82018,1.62099>,<-1.45609,1.6729,1.59156>,r}
+	sphere{<-1.45609,1.6729,1.59156>,r}
+	cylinder{<-1.45609,1.6729,1.59156>,<-1.54933,1.32239,2.0634>,r}
+	sphere{<-1.54933,1.32239,2.0634>,r}
+	cylinder{<-1.54933,1.32239,2.0634>,<-1.53052,1.94581,2.39088>,r}
+	sphere{<-1.53052,1.94581,2.39088>,r}
+	cylinder{<-1.53052,1.94581,2.39088>,<-1.51173,2.05981,2.32901>,r}
+	sphere{<-1.51173,2.05981,2.32901>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.70611,3,2.45169>,<-1.80871,2.29843,2.30586>,<-2.0917,1.94978,2.56644>}
+	triangle{<-1.70611,3,2.45169>,<-2.0917,1.94978,2.56644>,<-2.3282,2.26727,3.03859>}
+	triangle{<-1.70611,3,2.45169>,<-2.3282,2.26727,3.03859>,<-2.11464,3,3.03813>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.70611,3,2.45169>,<-1.80871,2.29843,2.30586>,r}
+	sphere{<-1.80871,2.29843,2.30586>,r}
+	cylinder{<-1.80871,2.29843,2.30586>,<-2.0917,1.94978,2.56644>,r}
+	sphere{<-2.0917,1.94978,2.56644>,r}
+	cylinder{<-2.0917,1.94978,2.56644>,<-2.3282,2.26727,3.03859>,r}
+	sphere{<-2.3282,2.26727,3.03859>,r}
+	cylinder{<-2.3282,2.26727,3.03859>,<-2.11464,3,3.03813>,r}
+	sphere{<-2.11464,3,3.03813>,r}
+	cylinder{<-2.11464,3,3.03813>,<-1.70611,3,2.45169>,r}
+	sphere{<-1.70611,3,2.45169>,r}
+	texture{t2}
+}
+union{
+	triangle{<-3,2.26738,3.03851>,<-2.3282,2.26727,3.03859>,<-2.0917,1.94978,2.56644>}
+	triangle{<-3,2.26738,3.03851>,<-2.0917,1.94978,2.56644>,<-2.89776,1.72942,2.23841>}
+	triangle{<-3,2.26738,3.03851>,<-2.89776,1.72942,2.23841>,<-3,1.72942,2.23838>}
+	texture{t1}
+}
+union{
+	cylinder{<-3,2.26738,3.03851>,<-2.3282,2.26727,3.03859>,r}
+	sphere{<-2.3282,2.26727,3.03859>,r}
+	cylinder{<-2.3282,2.26727,3.03859>,<-2.0917,1.94978,2.56644>,r}
+	sphere{<-2.0917,1.94978,2.56644>,r}
+	cylinder{<-2.0917,1.94978,2.56644>,<-2.89776,1.72942,2.23841>,r}
+	sphere{<-2.89776,1.72942,2.23841>,r}
+	cylinder{<-2.89776,1.72942,2.23841>,<-3,1.72942,2.23838>,r}
+	sphere{<-3,1.72942,2.23838>,r}
+	cylinder{<-3,1.72942,2.23838>,<-3,2.26738,3.03851>,r}
+	sphere{<-3,2.26738,3.03851>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.282725,1.84514,2.1612>,<-0.448769,2.02577,2.26775>,<-0.0787577,2.84046,2.8347>}
+	triangle{<-0.282725,1.84514,2.1612>,<-0.0787577,2.84046,2.8347>,<0.114215,2.72435,2.77287>}
+	triangle{<-0.282725,1.84514,2.1612>,<0.114215,2.72435,2.77287>,<0.310072,1.82424,2.19316>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.282725,1.84514,2.1612>,<-0.448769,2.02577,2.26775>,r}
+	sphere{<-0.448769,2.02577,2.26775>,r}
+	cylinder{<-0.448769,2.02577,2.26775>,<-0.0787577,2.84046,2.8347>,r}
+	sphere{<-0.0787577,2.84046,2.8347>,r}
+	cylinder{<-0.0787577,2.84046,2.8347>,<0.114215,2.72435,2.77287>,r}
+	sphere{<0.114215,2.72435,2.77287>,r}
+	cylinder{<0.114215,2.72435,2.77287>,<0.310072,1.82424,2.19316>,r}
+	sphere{<0.310072,1.82424,2.19316>,r}
+	cylinder{<0.310072,1.82424,2.19316>,<-0.282725,1.84514,2.1612>,r}
+	sphere{<-0.282725,1.84514,2.1612>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.282725,1.84514,2.1612>,<-0.251375,1.79469,1.87222>,<-0.254164,1.79728,1.86675>}
+	triangle{<-0.282725,1.84514,2.1612>,<-0.254164,1.79728,1.86675>,<-0.654643,2.22252,1.95234>}
+	triangle{<-0.282725,1.84514,2.1612>,<-0.654643,2.22252,1.95234>,<-0.448769,2.02577,2.26775>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.282725,1.84514,2.1612>,<-0.251375,1.79469,1.87222>,r}
+	sphere{<-0.251375,1.79469,1.87222>,r}
+	cylinder{<-0.251375,1.79469,1.87222>,<-0.254164,1.79728,1.86675>,r}
+	sphere{<-0.254164,1.79728,1.86675>,r}
+	cylinder{<-0.254164,1.79728,1.86675>,<-0.654643,2.22252,1.95234>,r}
+	sphere{<-0.654643,2.22252,1.95234>,r}
+	cylinder{<-0.654643,2.22252,1.95234>,<-0.448769,2.02577,2.26775>,r}
+	sphere{<-0.448769,2.02577,2.26775>,r}
+	cylinder{<-0.448769,2.02577,2.26775>,<-0.282725,1.84514,2.1612>,r}
+	sphere{<-0.282725,1.84514,2.1612>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.51173,2.05981,2.32901>,<-1.4456,1.82018,1.62099>,<-1.21165,1.88255,1.47292>}
+	triangle{<-1.51173,2.05981,2.32901>,<-1.21165,1.88255,1.47292>,<-0.79965,2.26172,1.90959>}
+	triangle{<-1.51173,2.05981,2.32901>,<-0.79965,2.26172,1.90959>,<-1.46253,2.09126,2.34532>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.51173,2.05981,2.32901>,<-1.4456,1.82018,1.62099>,r}
+	sphere{<-1.4456,1.82018,1.62099>,r}
+	cylinder{<-1.4456,1.82018,1.62099>,<-1.21165,1.88255,1.47292>,r}
+	sphere{<-1.21165,1.88255,1.47292>,r}
+	cylinder{<-1.21165,1.88255,1.47292>,<-0.79965,2.26172,1.90959>,r}
+	sphere{<-0.79965,2.26172,1.90959>,r}
+	cylinder{<-0.79965,2.26172,1.90959>,<-1.46253,2.09126,2.34532>,r}
+	sphere{<-1.46253,2.09126,2.34532>,r}
+	cylinder{<-1.46253,2.09126,2.34532>,<-1.51173,2.05981,2.32901>,r}
+	sphere{<-1.51173,2.05981,2.32901>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.756296,1.82695,2.68605>,<-0.594891,1.44239,2.66906>,<-0.610881,1.41184,2.6691>}
+	triangle{<-0.756296,1.82695,2.68605>,<-0.610881,1.41184,2.6691>,<-0.966848,1.36793,2.6852>}
+	triangle{<-0.756296,1.82695,2.68605>,<-0.966848,1.36793,2.6852>,<-1.182,1.86068,2.70738>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.756296,1.82695,2.68605>,<-0.594891,1.44239,2.66906>,r}
+	sphere{<-0.594891,1.44239,2.66906>,r}
+	cylinder{<-0.594891,1.44239,2.66906>,<-0.610881,1.41184,2.6691>,r}
+	sphere{<-0.610881,1.41184,2.6691>,r}
+	cylinder{<-0.610881,1.41184,2.6691>,<-0.966848,1.36793,2.6852>,r}
+	sphere{<-0.966848,1.36793,2.6852>,r}
+	cylinder{<-0.966848,1.36793,2.6852>,<-1.182,1.86068,2.70738>,r}
+	sphere{<-1.182,1.86068,2.70738>,r}
+	cylinder{<-1.182,1.86068,2.70738>,<-0.756296,1.82695,2.68605>,r}
+	sphere{<-0.756296,1.82695,2.68605>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.79965,2.26172,1.90959>,<-1.46253,2.09126,2.34532>,<-1.64484,3,2.46512>}
+	triangle{<-0.79965,2.26172,1.90959>,<-1.64484,3,2.46512>,<-0.717746,3,1.85572>}
+	triangle{<-0.79965,2.26172,1.90959>,<-0.717746,3,1.85572>,<-0.71772,2.49733,1.85572>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.79965,2.26172,1.90959>,<-1.46253,2.09126,2.34532>,r}
+	sphere{<-1.46253,2.09126,2.34532>,r}
+	cylinder{<-1.46253,2.09126,2.34532>,<-1.64484,3,2.46512>,r}
+	sphere{<-1.64484,3,2.46512>,r}
+	cylinder{<-1.64484,3,2.46512>,<-0.717746,3,1.85572>,r}
+	sphere{<-0.717746,3,1.85572>,r}
+	cylinder{<-0.717746,3,1.85572>,<-0.71772,2.49733,1.85572>,r}
+	sphere{<-0.71772,2.49733,1.85572>,r}
+	cylinder{<-0.71772,2.49733,1.85572>,<-0.79965,2.26172,1.90959>,r}
+	sphere{<-0.79965,2.26172,1.90959>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.70611,3,2.45169>,<-1.64484,3,2.46512>,<-1.46253,2.09126,2.34532>}
+	triangle{<-1.70611,3,2.45169>,<-1.46253,2.09126,2.34532>,<-1.51173,2.05981,2.32901>}
+	triangle{<-1.70611,3,2.45169>,<-1.51173,2.05981,2.32901>,<-1.80871,2.29843,2.30586>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.70611,3,2.45169>,<-1.64484,3,2.46512>,r}
+	sphere{<-1.64484,3,2.46512>,r}
+	cylinder{<-1.64484,3,2.46512>,<-1.46253,2.09126,2.34532>,r}
+	sphere{<-1.46253,2.09126,2.34532>,r}
+	cylinder{<-1.46253,2.09126,2.34532>,<-1.51173,2.05981,2.32901>,r}
+	sphere{<-1.51173,2.05981,2.32901>,r}
+	cylinder{<-1.51173,2.05981,2.32901>,<-1.80871,2.29843,2.30586>,r}
+	sphere{<-1.80871,2.29843,2.30586>,r}
+	cylinder{<-1.80871,2.29843,2.30586>,<-1.70611,3,2.45169>,r}
+	sphere{<-1.70611,3,2.45169>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.03503,2.21692,3.13807>,<-0.682716,2.11364,3.03068>,<-0.756296,1.82695,2.68605>}
+	triangle{<-1.03503,2.21692,3.13807>,<-0.756296,1.82695,2.68605>,<-1.182,1.86068,2.70738>}
+	triangle{<-1.03503,2.21692,3.13807>,<-1.182,1.86068,2.70738>,<-1.18617,1.86381,2.71093>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.03503,2.21692,3.13807>,<-0.682716,2.11364,3.03068>,r}
+	sphere{<-0.682716,2.11364,3.03068>,r}
+	cylinder{<-0.682716,2.11364,3.03068>,<-0.756296,1.82695,2.68605>,r}
+	sphere{<-0.756296,1.82695,2.68605>,r}
+	cylinder{<-0.756296,1.82695,2.68605>,<-1.182,1.86068,2.70738>,r}
+	sphere{<-1.182,1.86068,2.70738>,r}
+	cylinder{<-1.182,1.86068,2.70738>,<-1.18617,1.86381,2.71093>,r}
+	sphere{<-1.18617,1.86381,2.71093>,r}
+	cylinder{<-1.18617,1.86381,2.71093>,<-1.03503,2.21692,3.13807>,r}
+	sphere{<-1.03503,2.21692,3.13807>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.03503,2.21692,3.13807>,<-1.21954,3,3.19431>,<-0.0895384,3,2.84988>}
+	triangle{<-1.03503,2.21692,3.13807>,<-0.0895384,3,2.84988>,<-0.0895464,2.83375,2.84988>}
+	triangle{<-1.03503,2.21692,3.13807>,<-0.0895464,2.83375,2.84988>,<-0.682716,2.11364,3.03068>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.03503,2.21692,3.13807>,<-1.21954,3,3.19431>,r}
+	sphere{<-1.21954,3,3.19431>,r}
+	cylinder{<-1.21954,3,3.19431>,<-0.0895384,3,2.84988>,r}
+	sphere{<-0.0895384,3,2.84988>,r}
+	cylinder{<-0.0895384,3,2.84988>,<-0.0895464,2.83375,2.84988>,r}
+	sphere{<-0.0895464,2.83375,2.84988>,r}
+	cylinder{<-0.0895464,2.83375,2.84988>,<-0.682716,2.11364,3.03068>,r}
+	sphere{<-0.682716,2.11364,3.03068>,r}
+	cylinder{<-0.682716,2.11364,3.03068>,<-1.03503,2.21692,3.13807>,r}
+	sphere{<-1.03503,2.21692,3.13807>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.756296,1.82695,2.68605>,<-0.682716,2.11364,3.03068>,<-0.0895464,2.83375,2.84988>}
+	triangle{<-0.756296,1.82695,2.68605>,<-0.0895464,2.83375,2.84988>,<-0.0787577,2.84046,2.8347>}
+	triangle{<-0.756296,1.82695,2.68605>,<-0.0787577,2.84046,2.8347>,<-0.448769,2.02577,2.26775>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.756296,1.82695,2.68605>,<-0.682716,2.11364,3.03068>,r}
+	sphere{<-0.682716,2.11364,3.03068>,r}
+	cylinder{<-0.682716,2.11364,3.03068>,<-0.0895464,2.83375,2.84988>,r}
+	sphere{<-0.0895464,2.83375,2.84988>,r}
+	cylinder{<-0.0895464,2.83375,2.84988>,<-0.0787577,2.84046,2.8347>,r}
+	sphere{<-0.0787577,2.84046,2.8347>,r}
+	cylinder{<-0.0787577,2.84046,2.8347>,<-0.448769,2.02577,2.26775>,r}
+	sphere{<-0.448769,2.02577,2.26775>,r}
+	cylinder{<-0.448769,2.02577,2.26775>,<-0.756296,1.82695,2.68605>,r}
+	sphere{<-0.756296,1.82695,2.68605>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.539308,1.97496,3.07511>,<0.390356,1.73073,2.31247>,<0.0827516,1.29928,2.85677>}
+	triangle{<0.539308,1.97496,3.07511>,<0.0827516,1.29928,2.85677>,<0.194247,1.47555,3.23746>}
+	triangle{<0.539308,1.97496,3.07511>,<0.194247,1.47555,3.23746>,<0.426589,1.81811,3.31078>}
+	texture{t1}
+}
+union{
+	cylinder{<0.539308,1.97496,3.07511>,<0.390356,1.73073,2.31247>,r}
+	sphere{<0.390356,1.73073,2.31247>,r}
+	cylinder{<0.390356,1.73073,2.31247>,<0.0827516,1.29928,2.85677>,r}
+	sphere{<0.0827516,1.29928,2.85677>,r}
+	cylinder{<0.0827516,1.29928,2.85677>,<0.194247,1.47555,3.23746>,r}
+	sphere{<0.194247,1.47555,3.23746>,r}
+	cylinder{<0.194247,1.47555,3.23746>,<0.426589,1.81811,3.31078>,r}
+	sphere{<0.426589,1.81811,3.31078>,r}
+	cylinder{<0.426589,1.81811,3.31078>,<0.539308,1.97496,3.07511>,r}
+	sphere{<0.539308,1.97496,3.07511>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.395699,1.92949,3.38157>,<-0.061335,2.16227,3.42216>,<0.426589,1.81811,3.31078>}
+	triangle{<-0.395699,1.92949,3.38157>,<0.426589,1.81811,3.31078>,<0.194247,1.47555,3.23746>}
+	triangle{<-0.395699,1.92949,3.38157>,<0.194247,1.47555,3.23746>,<-0.250581,1.43064,3.24952>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.395699,1.92949,3.38157>,<-0.061335,2.16227,3.42216>,r}
+	sphere{<-0.061335,2.16227,3.42216>,r}
+	cylinder{<-0.061335,2.16227,3.42216>,<0.426589,1.81811,3.31078>,r}
+	sphere{<0.426589,1.81811,3.31078>,r}
+	cylinder{<0.426589,1.81811,3.31078>,<0.194247,1.47555,3.23746>,r}
+	sphere{<0.194247,1.47555,3.23746>,r}
+	cylinder{<0.194247,1.47555,3.23746>,<-0.250581,1.43064,3.24952>,r}
+	sphere{<-0.250581,1.43064,3.24952>,r}
+	cylinder{<-0.250581,1.43064,3.24952>,<-0.395699,1.92949,3.38157>,r}
+	sphere{<-0.395699,1.92949,3.38157>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.370292,1.27943,2.92926>,<-0.250581,1.43064,3.24952>,<0.194247,1.47555,3.23746>}
+	triangle{<-0.370292,1.27943,2.92926>,<0.194247,1.47555,3.23746>,<0.0827516,1.29928,2.85677>}
+	triangle{<-0.370292,1.27943,2.92926>,<0.0827516,1.29928,2.85677>,<-0.347068,1.26686,2.89394>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.370292,1.27943,2.92926>,<-0.250581,1.43064,3.24952>,r}
+	sphere{<-0.250581,1.43064,3.24952>,r}
+	cylinder{<-0.250581,1.43064,3.24952>,<0.194247,1.47555,3.23746>,r}
+	sphere{<0.194247,1.47555,3.23746>,r}
+	cylinder{<0.194247,1.47555,3.23746>,<0.0827516,1.29928,2.85677>,r}
+	sphere{<0.0827516,1.29928,2.85677>,r}
+	cylinder{<0.0827516,1.29928,2.85677>,<-0.347068,1.26686,2.89394>,r}
+	sphere{<-0.347068,1.26686,2.89394>,r}
+	cylinder{<-0.347068,1.26686,2.89394>,<-0.370292,1.27943,2.92926>,r}
+	sphere{<-0.370292,1.27943,2.92926>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.23616,2.69518,1.69558>,<1.8733,2.02158,1.82387>,<1.82248,1.89097,2.01191>}
+	triangle{<1.23616,2.69518,1.69558>,<1.82248,1.89097,2.01191>,<1.32962,1.98023,2.37709>}
+	triangle{<1.23616,2.69518,1.69558>,<1.32962,1.98023,2.37709>,<1.06489,2.67715,1.87523>}
+	texture{t1}
+}
+union{
+	cylinder{<1.23616,2.69518,1.69558>,<1.8733,2.02158,1.82387>,r}
+	sphere{<1.8733,2.02158,1.82387>,r}
+	cylinder{<1.8733,2.02158,1.82387>,<1.82248,1.89097,2.01191>,r}
+	sphere{<1.82248,1.89097,2.01191>,r}
+	cylinder{<1.82248,1.89097,2.01191>,<1.32962,1.98023,2.37709>,r}
+	sphere{<1.32962,1.98023,2.37709>,r}
+	cylinder{<1.32962,1.98023,2.37709>,<1.06489,2.67715,1.87523>,r}
+	sphere{<1.06489,2.67715,1.87523>,r}
+	cylinder{<1.06489,2.67715,1.87523>,<1.23616,2.69518,1.69558>,r}
+	sphere{<1.23616,2.69518,1.69558>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.30591,3,3.02196>,<1.01688,3,1.92578>,<1.06489,2.67715,1.87523>}
+	triangle{<1.30591,3,3.02196>,<1.06489,2.67715,1.87523>,<1.32962,1.98023,2.37709>}
+	triangle{<1.30591,3,3.02196>,<1.32962,1.98023,2.37709>,<1.38112,2.01282,2.59592>}
+	texture{t1}
+}
+union{
+	cylinder{<1.30591,3,3.02196>,<1.01688,3,1.92578>,r}
+	sphere{<1.01688,3,1.92578>,r}
+	cylinder{<1.01688,3,1.92578>,<1.06489,2.67715,1.87523>,r}
+	sphere{<1.06489,2.67715,1.87523>,r}
+	cylinder{<1.06489,2.67715,1.87523>,<1.32962,1.98023,2.37709>,r}
+	sphere{<1.32962,1.98023,2.37709>,r}
+	cylinder{<1.32962,1.98023,2.37709>,<1.38112,2.01282,2.59592>,r}
+	sphere{<1.38112,2.01282,2.59592>,r}
+	cylinder{<1.38112,2.01282,2.59592>,<1.30591,3,3.02196>,r}
+	sphere{<1.30591,3,3.02196>,r}
+	texture{t2}
+}
+union{
+	triangle{<3,1.4406,2.45906>,<3,1.32553,1.68729>,<2.46318,1.3254,1.68724>}
+	triangle{<3,1.4406,2.45906>,<2.46318,1.3254,1.68724>,<2.12547,1.37719,2.03504>}
+	triangle{<3,1.4406,2.45906>,<2.12547,1.37719,2.03504>,<2.29107,1.44043,2.45895>}
+	texture{t1}
+}
+union{
+	cylinder{<3,1.4406,2.45906>,<3,1.32553,1.68729>,r}
+	sphere{<3,1.32553,1.68729>,r}
+	cylinder{<3,1.32553,1.68729>,<2.46318,1.3254,1.68724>,r}
+	sphere{<2.46318,1.3254,1.68724>,r}
+	cylinder{<2.46318,1.3254,1.68724>,<2.12547,1.37719,2.03504>,r}
+	sphere{<2.12547,1.37719,2.03504>,r}
+	cylinder{<2.12547,1.37719,2.03504>,<2.29107,1.44043,2.45895>,r}
+	sphere{<2.29107,1.44043,2.45895>,r}
+	cylinder{<2.29107,1.44043,2.45895>,<3,1.4406,2.45906>,r}
+	sphere{<3,1.4406,2.45906>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.08118,1.98315,2.6726>,<2.08332,1.98261,2.67007>,<1.82248,1.89097,2.01191>}
+	triangle{<2.08118,1.98315,2.6726>,<1.82248,1.89097,2.01191>,<1.32962,1.98023,2.37709>}
+	triangle{<2.08118,1.98315,2.6726>,<1.32962,1.98023,2.37709>,<1.38112,2.01282,2.59592>}
+	texture{t1}
+}
+union{
+	cylinder{<2.08118,1.98315,2.6726>,<2.08332,1.98261,2.67007>,r}
+	sphere{<2.08332,1.98261,2.67007>,r}
+	cylinder{<2.08332,1.98261,2.67007>,<1.82248,1.89097,2.01191>,r}
+	sphere{<1.82248,1.89097,2.01191>,r}
+	cylinder{<1.82248,1.89097,2.01191>,<1.32962,1.98023,2.37709>,r}
+	sphere{<1.32962,1.98023,2.37709>,r}
+	cylinder{<1.32962,1.98023,2.37709>,<1.38112,2.01282,2.59592>,r}
+	sphere{<1.38112,2.01282,2.59592>,r}
+	cylinder{<1.38112,2.01282,2.59592>,<2.08118,1.98315,2.6726>,r}
+	sphere{<2.08118,1.98315,2.6726>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.08118,1.98315,2.6726>,<1.74062,3,3.07771>,<2.66869,3,1.98388>}
+	triangle{<2.08118,1.98315,2.6726>,<2.66869,3,1.98388>,<2.66858,2.95941,1.98386>}
+	triangle{<2.08118,1.98315,2.6726>,<2.66858,2.95941,1.98386>,<2.08332,1.98261,2.67007>}
+	texture{t1}
+}
+union{
+	cylinder{<2.08118,1.98315,2.6726>,<1.74062,3,3.07771>,r}
+	sphere{<1.74062,3,3.07771>,r}
+	cylinder{<1.74062,3,3.07771>,<2.66869,3,1.98388>,r}
+	sphere{<2.66869,3,1.98388>,r}
+	cylinder{<2.66869,3,1.98388>,<2.66858,2.95941,1.98386>,r}
+	sphere{<2.66858,2.95941,1.98386>,r}
+	cylinder{<2.66858,2.95941,1.98386>,<2.08332,1.98261,2.67007>,r}
+	sphere{<2.08332,1.98261,2.67007>,r}
+	cylinder{<2.08332,1.98261,2.67007>,<2.08118,1.98315,2.6726>,r}
+	sphere{<2.08118,1.98315,2.6726>,r}
+	texture{t2}
+}
+union{
+	triangle{<3,3,3.7423>,<3,2.02287,3.28252>,<2.24475,2.02295,3.28241>}
+	triangle{<3,3,3.7423>,<2.24475,2.02295,3.28241>,<2.025,2.72403,3.61227>}
+	triangle{<3,3,3.7423>,<2.025,2.72403,3.61227>,<2.15714,3,3.74215>}
+	texture{t1}
+}
+union{
+	cylinder{<3,3,3.7423>,<3,2.02287,3.28252>,r}
+	sphere{<3,2.02287,3.28252>,r}
+	cylinder{<3,2.02287,3.28252>,<2.24475,2.02295,3.28241>,r}
+	sphere{<2.24475,2.02295,3.28241>,r}
+	cylinder{<2.24475,2.02295,3.28241>,<2.025,2.72403,3.61227>,r}
+	sphere{<2.025,2.72403,3.61227>,r}
+	cylinder{<2.025,2.72403,3.61227>,<2.15714,3,3.74215>,r}
+	sphere{<2.15714,3,3.74215>,r}
+	cylinder{<2.15714,3,3.74215>,<3,3,3.7423>,r}
+	sphere{<3,3,3.7423>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.31213,-3,4.08168>,<-1.66636,-2.04318,4.25236>,<-1.75209,-1.90598,3.52595>}
+	triangle{<-1.31213,-3,4.08168>,<-1.75209,-1.90598,3.52595>,<-1.74275,-1.93342,3.50333>}
+	triangle{<-1.31213,-3,4.08168>,<-1.74275,-1.93342,3.50333>,<-1.32731,-3,3.75547>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.31213,-3,4.08168>,<-1.66636,-2.04318,4.25236>,r}
+	sphere{<-1.66636,-2.04318,4.25236>,r}
+	cylinder{<-1.66636,-2.04318,4.25236>,<-1.75209,-1.90598,3.52595>,r}
+	sphere{<-1.75209,-1.90598,3.52595>,r}
+	cylinder{<-1.75209,-1.90598,3.52595>,<-1.74275,-1.93342,3.50333>,r}
+	sphere{<-1.74275,-1.93342,3.50333>,r}
+	cylinder{<-1.74275,-1.93342,3.50333>,<-1.32731,-3,3.75547>,r}
+	sphere{<-1.32731,-3,3.75547>,r}
+	cylinder{<-1.32731,-3,3.75547>,<-1.31213,-3,4.08168>,r}
+	sphere{<-1.31213,-3,4.08168>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.103338,-3,3.45781>,<-0.103315,-2.21448,3.45782>,<-0.0423708,-2.01918,3.07088>}
+	triangle{<-0.103338,-3,3.45781>,<-0.0423708,-2.01918,3.07088>,<-0.00577534,-2.16686,2.83849>}
+	triangle{<-0.103338,-3,3.45781>,<-0.00577534,-2.16686,2.83849>,<-0.00581297,-3,2.83856>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.103338,-3,3.45781>,<-0.103315,-2.21448,3.45782>,r}
+	sphere{<-0.103315,-2.21448,3.45782>,r}
+	cylinder{<-0.103315,-2.21448,3.45782>,<-0.0423708,-2.01918,3.07088>,r}
+	sphere{<-0.0423708,-2.01918,3.07088>,r}
+	cylinder{<-0.0423708,-2.01918,3.07088>,<-0.00577534,-2.16686,2.83849>,r}
+	sphere{<-0.00577534,-2.16686,2.83849>,r}
+	cylinder{<-0.00577534,-2.16686,2.83849>,<-0.00581297,-3,2.83856>,r}
+	sphere{<-0.00581297,-3,2.83856>,r}
+	cylinder{<-0.00581297,-3,2.83856>,<-0.103338,-3,3.45781>,r}
+	sphere{<-0.103338,-3,3.45781>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.45251,-2.0295,3.59451>,<-0.609493,-1.75217,3.34622>,<-0.357396,-1.76359,3.0527>}
+	triangle{<-0.45251,-2.0295,3.59451>,<-0.357396,-1.76359,3.0527>,<-0.0423708,-2.01918,3.07088>}
+	triangle{<-0.45251,-2.0295,3.59451>,<-0.0423708,-2.01918,3.07088>,<-0.103315,-2.21448,3.45782>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.45251,-2.0295,3.59451>,<-0.609493,-1.75217,3.34622>,r}
+	sphere{<-0.609493,-1.75217,3.34622>,r}
+	cylinder{<-0.609493,-1.75217,3.34622>,<-0.357396,-1.76359,3.0527>,r}
+	sphere{<-0.357396,-1.76359,3.0527>,r}
+	cylinder{<-0.357396,-1.76359,3.0527>,<-0.0423708,-2.01918,3.07088>,r}
+	sphere{<-0.0423708,-2.01918,3.07088>,r}
+	cylinder{<-0.0423708,-2.01918,3.07088>,<-0.103315,-2.21448,3.45782>,r}
+	sphere{<-0.103315,-2.21448,3.45782>,r}
+	cylinder{<-0.103315,-2.21448,3.45782>,<-0.45251,-2.0295,3.59451>,r}
+	sphere{<-0.45251,-2.0295,3.59451>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.581953,-1.74859,2.95253>,<-0.439112,-1.75697,2.92938>,<-0.357396,-1.76359,3.0527>}
+	triangle{<-0.581953,-1.74859,2.95253>,<-0.357396,-1.76359,3.0527>,<-0.609493,-1.75217,3.34622>}
+	triangle{<-0.581953,-1.74859,2.95253>,<-0.609493,-1.75217,3.34622>,<-0.618632,-1.75152,3.33933>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.581953,-1.74859,2.95253>,<-0.439112,-1.75697,2.92938>,r}
+	sphere{<-0.439112,-1.75697,2.92938>,r}
+	cylinder{<-0.439112,-1.75697,2.92938>,<-0.357396,-1.76359,3.0527>,r}
+	sphere{<-0.357396,-1.76359,3.0527>,r}
+	cylinder{<-0.357396,-1.76359,3.0527>,<-0.609493,-1.75217,3.34622>,r}
+	sphere{<-0.609493,-1.75217,3.34622>,r}
+	cylinder{<-0.609493,-1.75217,3.34622>,<-0.618632,-1.75152,3.33933>,r}
+	sphere{<-0.618632,-1.75152,3.33933>,r}
+	cylinder{<-0.618632,-1.75152,3.33933>,<-0.581953,-1.74859,2.95253>,r}
+	sphere{<-0.581953,-1.74859,2.95253>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.357396,-1.76359,3.0527>,<-0.439112,-1.75697,2.92938>,<-0.167035,-2.10622,2.68967>}
+	triangle{<-0.357396,-1.76359,3.0527>,<-0.167035,-2.10622,2.68967>,<-0.00577534,-2.16686,2.83849>}
+	triangle{<-0.357396,-1.76359,3.0527>,<-0.00577534,-2.16686,2.83849>,<-0.0423708,-2.01918,3.07088>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.357396,-1.76359,3.0527>,<-0.439112,-1.75697,2.92938>,r}
+	sphere{<-0.439112,-1.75697,2.92938>,r}
+	cylinder{<-0.439112,-1.75697,2.92938>,<-0.167035,-2.10622,2.68967>,r}
+	sphere{<-0.167035,-2.10622,2.68967>,r}
+	cylinder{<-0.167035,-2.10622,2.68967>,<-0.00577534,-2.16686,2.83849>,r}
+	sphere{<-0.00577534,-2.16686,2.83849>,r}
+	cylinder{<-0.00577534,-2.16686,2.83849>,<-0.0423708,-2.01918,3.07088>,r}
+	sphere{<-0.0423708,-2.01918,3.07088>,r}
+	cylinder{<-0.0423708,-2.01918,3.07088>,<-0.357396,-1.76359,3.0527>,r}
+	sphere{<-0.357396,-1.76359,3.0527>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.0361,-2.11438,2.79581>,<-1.05818,-2.10499,3.19615>,<-1.08115,-3,3.6169>}
+	triangle{<-1.0361,-2.11438,2.79581>,<-1.08115,-3,3.6169>,<-1.02289,-3,2.56038>}
+	triangle{<-1.0361,-2.11438,2.79581>,<-1.02289,-3,2.56038>,<-1.02302,-2.51259,2.56043>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.0361,-2.11438,2.79581>,<-1.05818,-2.10499,3.19615>,r}
+	sphere{<-1.05818,-2.10499,3.19615>,r}
+	cylinder{<-1.05818,-2.10499,3.19615>,<-1.08115,-3,3.6169>,r}
+	sphere{<-1.08115,-3,3.6169>,r}
+	cylinder{<-1.08115,-3,3.6169>,<-1.02289,-3,2.56038>,r}
+	sphere{<-1.02289,-3,2.56038>,r}
+	cylinder{<-1.02289,-3,2.56038>,<-1.02302,-2.51259,2.56043>,r}
+	sphere{<-1.02302,-2.51259,2.56043>,r}
+	cylinder{<-1.02302,-2.51259,2.56043>,<-1.0361,-2.11438,2.79581>,r}
+	sphere{<-1.0361,-2.11438,2.79581>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.30113,-2.10342,4.68573>,<0.105832,-2.7917,4.78775>,<0.105834,-3,4.78776>}
+	triangle{<-0.30113,-2.10342,4.68573>,<0.105834,-3,4.78776>,<-0.835293,-3,4.55189>}
+	triangle{<-0.30113,-2.10342,4.68573>,<-0.835293,-3,4.55189>,<-0.83528,-2.52129,4.55188>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.30113,-2.10342,4.68573>,<0.105832,-2.7917,4.78775>,r}
+	sphere{<0.105832,-2.7917,4.78775>,r}
+	cylinder{<0.105832,-2.7917,4.78775>,<0.105834,-3,4.78776>,r}
+	sphere{<0.105834,-3,4.78776>,r}
+	cylinder{<0.105834,-3,4.78776>,<-0.835293,-3,4.55189>,r}
+	sphere{<-0.835293,-3,4.55189>,r}
+	cylinder{<-0.835293,-3,4.55189>,<-0.83528,-2.52129,4.55188>,r}
+	sphere{<-0.83528,-2.52129,4.55188>,r}
+	cylinder{<-0.83528,-2.52129,4.55188>,<-0.30113,-2.10342,4.68573>,r}
+	sphere{<-0.30113,-2.10342,4.68573>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.75209,-1.90598,3.52595>,<-1.16522,-1.48931,3.67654>,<-1.14087,-1.62871,4.24007>}
+	triangle{<-1.75209,-1.90598,3.52595>,<-1.14087,-1.62871,4.24007>,<-1.48051,-1.93905,4.39903>}
+	triangle{<-1.75209,-1.90598,3.52595>,<-1.48051,-1.93905,4.39903>,<-1.66636,-2.04318,4.25236>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.75209,-1.90598,3.52595>,<-1.16522,-1.48931,3.67654>,r}
+	sphere{<-1.16522,-1.48931,3.67654>,r}
+	cylinder{<-1.16522,-1.48931,3.67654>,<-1.14087,-1.62871,4.24007>,r}
+	sphere{<-1.14087,-1.62871,4.24007>,r}
+	cylinder{<-1.14087,-1.62871,4.24007>,<-1.48051,-1.93905,4.39903>,r}
+	sphere{<-1.48051,-1.93905,4.39903>,r}
+	cylinder{<-1.48051,-1.93905,4.39903>,<-1.66636,-2.04318,4.25236>,r}
+	sphere{<-1.66636,-2.04318,4.25236>,r}
+	cylinder{<-1.66636,-2.04318,4.25236>,<-1.75209,-1.90598,3.52595>,r}
+	sphere{<-1.75209,-1.90598,3.52595>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.31213,-3,4.08168>,<-1.66636,-2.04318,4.25236>,<-1.48051,-1.93905,4.39903>}
+	triangle{<-1.31213,-3,4.08168>,<-1.48051,-1.93905,4.39903>,<-0.841862,-2.51456,4.53931>}
+	triangle{<-1.31213,-3,4.08168>,<-0.841862,-2.51456,4.53931>,<-0.983325,-3,4.26938>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.31213,-3,4.08168>,<-1.66636,-2.04318,4.25236>,r}
+	sphere{<-1.66636,-2.04318,4.25236>,r}
+	cylinder{<-1.66636,-2.04318,4.25236>,<-1.48051,-1.93905,4.39903>,r}
+	sphere{<-1.48051,-1.93905,4.39903>,r}
+	cylinder{<-1.48051,-1.93905,4.39903>,<-0.841862,-2.51456,4.53931>,r}
+	sphere{<-0.841862,-2.51456,4.53931>,r}
+	cylinder{<-0.841862,-2.51456,4.53931>,<-0.983325,-3,4.26938>,r}
+	sphere{<-0.983325,-3,4.26938>,r}
+	cylinder{<-0.983325,-3,4.26938>,<-1.31213,-3,4.08168>,r}
+	sphere{<-1.31213,-3,4.08168>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.01649,-1.08041,3.54378>,<1.27341,-1.08513,3.18011>,<1.78764,-1.62402,3.44327>}
+	triangle{<1.01649,-1.08041,3.54378>,<1.78764,-1.62402,3.44327>,<1.78067,-1.64091,3.48499>}
+	triangle{<1.01649,-1.08041,3.54378>,<1.78067,-1.64091,3.48499>,<1.31742,-1.47516,3.84638>}
+	texture{t1}
+}
+union{
+	cylinder{<1.01649,-1.08041,3.54378>,<1.27341,-1.08513,3.18011>,r}
+	sphere{<1.27341,-1.08513,3.18011>,r}
+	cylinder{<1.27341,-1.08513,3.18011>,<1.78764,-1.62402,3.44327>,r}
+	sphere{<1.78764,-1.62402,3.44327>,r}
+	cylinder{<1.78764,-1.62402,3.44327>,<1.78067,-1.64091,3.48499>,r}
+	sphere{<1.78067,-1.64091,3.48499>,r}
+	cylinder{<1.78067,-1.64091,3.48499>,<1.31742,-1.47516,3.84638>,r}
+	sphere{<1.31742,-1.47516,3.84638>,r}
+	cylinder{<1.31742,-1.47516,3.84638>,<1.01649,-1.08041,3.54378>,r}
+	sphere{<1.01649,-1.08041,3.54378>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.01649,-1.08041,3.54378>,<1.31742,-1.47516,3.84638>,<1.10441,-1.80555,3.98163>}
+	triangle{<1.01649,-1.08041,3.54378>,<1.10441,-1.80555,3.98163>,<0.738381,-1.8712,3.92633>}
+	triangle{<1.01649,-1.08041,3.54378>,<0.738381,-1.8712,3.92633>,<0.653266,-1.22277,3.53316>}
+	texture{t1}
+}
+union{
+	cylinder{<1.01649,-1.08041,3.54378>,<1.31742,-1.47516,3.84638>,r}
+	sphere{<1.31742,-1.47516,3.84638>,r}
+	cylinder{<1.31742,-1.47516,3.84638>,<1.10441,-1.80555,3.98163>,r}
+	sphere{<1.10441,-1.80555,3.98163>,r}
+	cylinder{<1.10441,-1.80555,3.98163>,<0.738381,-1.8712,3.92633>,r}
+	sphere{<0.738381,-1.8712,3.92633>,r}
+	cylinder{<0.738381,-1.8712,3.92633>,<0.653266,-1.22277,3.53316>,r}
+	sphere{<0.653266,-1.22277,3.53316>,r}
+	cylinder{<0.653266,-1.22277,3.53316>,<1.01649,-1.08041,3.54378>,r}
+	sphere{<1.01649,-1.08041,3.54378>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.653266,-1.22277,3.53316>,<0.738381,-1.8712,3.92633>,<0.648287,-2.0586,3.72366>}
+	triangle{<0.653266,-1.22277,3.53316>,<0.648287,-2.0586,3.72366>,<0.453054,-1.86842,3.13876>}
+	triangle{<0.653266,-1.22277,3.53316>,<0.453054,-1.86842,3.13876>,<0.511678,-1.37727,3.18042>}
+	texture{t1}
+}
+union{
+	cylinder{<0.653266,-1.22277,3.53316>,<0.738381,-1.8712,3.92633>,r}
+	sphere{<0.738381,-1.8712,3.92633>,r}
+	cylinder{<0.738381,-1.8712,3.92633>,<0.648287,-2.0586,3.72366>,r}
+	sphere{<0.648287,-2.0586,3.72366>,r}
+	cylinder{<0.648287,-2.0586,3.72366>,<0.453054,-1.86842,3.13876>,r}
+	sphere{<0.453054,-1.86842,3.13876>,r}
+	cylinder{<0.453054,-1.86842,3.13876>,<0.511678,-1.37727,3.18042>,r}
+	sphere{<0.511678,-1.37727,3.18042>,r}
+	cylinder{<0.511678,-1.37727,3.18042>,<0.653266,-1.22277,3.53316>,r}
+	sphere{<0.653266,-1.22277,3.53316>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.10441,-1.80555,3.98163>,<1.31742,-1.47516,3.84638>,<1.78067,-1.64091,3.48499>}
+	triangle{<1.10441,-1.80555,3.98163>,<1.78067,-1.64091,3.48499>,<1.8043,-1.74576,3.45923>}
+	triangle{<1.10441,-1.80555,3.98163>,<1.8043,-1.74576,3.45923>,<1.47471,-2.05985,3.6835>}
+	texture{t1}
+}
+union{
+	cylinder{<1.10441,-1.80555,3.98163>,<1.31742,-1.47516,3.84638>,r}
+	sphere{<1.31742,-1.47516,3.84638>,r}
+	cylinder{<1.31742,-1.47516,3.84638>,<1.78067,-1.64091,3.48499>,r}
+	sphere{<1.78067,-1.64091,3.48499>,r}
+	cylinder{<1.78067,-1.64091,3.48499>,<1.8043,-1.74576,3.45923>,r}
+	sphere{<1.8043,-1.74576,3.45923>,r}
+	cylinder{<1.8043,-1.74576,3.45923>,<1.47471,-2.05985,3.6835>,r}
+	sphere{<1.47471,-2.05985,3.6835>,r}
+	cylinder{<1.47471,-2.05985,3.6835>,<1.10441,-1.80555,3.98163>,r}
+	sphere{<1.10441,-1.80555,3.98163>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.10441,-1.80555,3.98163>,<1.47471,-2.05985,3.6835>,<1.12352,-2.41028,3.3131>}
+	triangle{<1.10441,-1.80555,3.98163>,<1.12352,-2.41028,3.3131>,<0.648287,-2.0586,3.72366>}
+	triangle{<1.10441,-1.80555,3.98163>,<0.648287,-2.0586,3.72366>,<0.738381,-1.8712,3.92633>}
+	texture{t1}
+}
+union{
+	cylinder{<1.10441,-1.80555,3.98163>,<1.47471,-2.05985,3.6835>,r}
+	sphere{<1.47471,-2.05985,3.6835>,r}
+	cylinder{<1.47471,-2.05985,3.6835>,<1.12352,-2.41028,3.3131>,r}
+	sphere{<1.12352,-2.41028,3.3131>,r}
+	cylinder{<1.12352,-2.41028,3.3131>,<0.648287,-2.0586,3.72366>,r}
+	sphere{<0.648287,-2.0586,3.72366>,r}
+	cylinder{<0.648287,-2.0586,3.72366>,<0.738381,-1.8712,3.92633>,r}
+	sphere{<0.738381,-1.8712,3.92633>,r}
+	cylinder{<0.738381,-1.8712,3.92633>,<1.10441,-1.80555,3.98163>,r}
+	sphere{<1.10441,-1.80555,3.98163>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.648287,-2.0586,3.72366>,<1.12352,-2.41028,3.3131>,<1.12675,-2.40884,3.24735>}
+	triangle{<0.648287,-2.0586,3.72366>,<1.12675,-2.40884,3.24735>,<0.700094,-2.04353,2.79846>}
+	triangle{<0.648287,-2.0586,3.72366>,<0.700094,-2.04353,2.79846>,<0.453054,-1.86842,3.13876>}
+	texture{t1}
+}
+union{
+	cylinder{<0.648287,-2.0586,3.72366>,<1.12352,-2.41028,3.3131>,r}
+	sphere{<1.12352,-2.41028,3.3131>,r}
+	cylinder{<1.12352,-2.41028,3.3131>,<1.12675,-2.40884,3.24735>,r}
+	sphere{<1.12675,-2.40884,3.24735>,r}
+	cylinder{<1.12675,-2.40884,3.24735>,<0.700094,-2.04353,2.79846>,r}
+	sphere{<0.700094,-2.04353,2.79846>,r}
+	cylinder{<0.700094,-2.04353,2.79846>,<0.453054,-1.86842,3.13876>,r}
+	sphere{<0.453054,-1.86842,3.13876>,r}
+	cylinder{<0.453054,-1.86842,3.13876>,<0.648287,-2.0586,3.72366>,r}
+	sphere{<0.648287,-2.0586,3.72366>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.450412,-2.20737,3.89458>,<0.648287,-2.0586,3.72366>,<1.12352,-2.41028,3.3131>}
+	triangle{<0.450412,-2.20737,3.89458>,<1.12352,-2.41028,3.3131>,<1.12431,-3,3.31239>}
+	triangle{<0.450412,-2.20737,3.89458>,<1.12431,-3,3.31239>,<0.450377,-3,3.89457>}
+	texture{t1}
+}
+union{
+	cylinder{<0.450412,-2.20737,3.89458>,<0.648287,-2.0586,3.72366>,r}
+	sphere{<0.648287,-2.0586,3.72366>,r}
+	cylinder{<0.648287,-2.0586,3.72366>,<1.12352,-2.41028,3.3131>,r}
+	sphere{<1.12352,-2.41028,3.3131>,r}
+	cylinder{<1.12352,-2.41028,3.3131>,<1.12431,-3,3.31239>,r}
+	sphere{<1.12431,-3,3.31239>,r}
+	cylinder{<1.12431,-3,3.31239>,<0.450377,-3,3.89457>,r}
+	sphere{<0.450377,-3,3.89457>,r}
+	cylinder{<0.450377,-3,3.89457>,<0.450412,-2.20737,3.89458>,r}
+	sphere{<0.450412,-2.20737,3.89458>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.450412,-2.20737,3.89458>,<-0.103315,-2.21448,3.45782>,<-0.0423708,-2.01918,3.07088>}
+	triangle{<0.450412,-2.20737,3.89458>,<-0.0423708,-2.01918,3.07088>,<0.453054,-1.86842,3.13876>}
+	triangle{<0.450412,-2.20737,3.89458>,<0.453054,-1.86842,3.13876>,<0.648287,-2.0586,3.72366>}
+	texture{t1}
+}
+union{
+	cylinder{<0.450412,-2.20737,3.89458>,<-0.103315,-2.21448,3.45782>,r}
+	sphere{<-0.103315,-2.21448,3.45782>,r}
+	cylinder{<-0.103315,-2.21448,3.45782>,<-0.0423708,-2.01918,3.07088>,r}
+	sphere{<-0.0423708,-2.01918,3.07088>,r}
+	cylinder{<-0.0423708,-2.01918,3.07088>,<0.453054,-1.86842,3.13876>,r}
+	sphere{<0.453054,-1.86842,3.13876>,r}
+	cylinder{<0.453054,-1.86842,3.13876>,<0.648287,-2.0586,3.72366>,r}
+	sphere{<0.648287,-2.0586,3.72366>,r}
+	cylinder{<0.648287,-2.0586,3.72366>,<0.450412,-2.20737,3.89458>,r}
+	sphere{<0.450412,-2.20737,3.89458>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.458685,-1.84752,3.98564>,<-0.62471,-1.66177,3.471>,<-0.217945,-1.10681,3.68174>}
+	triangle{<-0.458685,-1.84752,3.98564>,<-0.217945,-1.10681,3.68174>,<-0.0162321,-1.18702,4.15577>}
+	triangle{<-0.458685,-1.84752,3.98564>,<-0.0162321,-1.18702,4.15577>,<-0.252271,-1.77204,4.30689>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.458685,-1.84752,3.98564>,<-0.62471,-1.66177,3.471>,r}
+	sphere{<-0.62471,-1.66177,3.471>,r}
+	cylinder{<-0.62471,-1.66177,3.471>,<-0.217945,-1.10681,3.68174>,r}
+	sphere{<-0.217945,-1.10681,3.68174>,r}
+	cylinder{<-0.217945,-1.10681,3.68174>,<-0.0162321,-1.18702,4.15577>,r}
+	sphere{<-0.0162321,-1.18702,4.15577>,r}
+	cylinder{<-0.0162321,-1.18702,4.15577>,<-0.252271,-1.77204,4.30689>,r}
+	sphere{<-0.252271,-1.77204,4.30689>,r}
+	cylinder{<-0.252271,-1.77204,4.30689>,<-0.458685,-1.84752,3.98564>,r}
+	sphere{<-0.458685,-1.84752,3.98564>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.252271,-1.77204,4.30689>,<-0.0162321,-1.18702,4.15577>,<0.12327,-1.19005,4.18158>}
+	triangle{<-0.252271,-1.77204,4.30689>,<0.12327,-1.19005,4.18158>,<0.213418,-1.48486,4.29493>}
+	triangle{<-0.252271,-1.77204,4.30689>,<0.213418,-1.48486,4.29493>,<-0.198842,-1.78447,4.3205>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.252271,-1.77204,4.30689>,<-0.0162321,-1.18702,4.15577>,r}
+	sphere{<-0.0162321,-1.18702,4.15577>,r}
+	cylinder{<-0.0162321,-1.18702,4.15577>,<0.12327,-1.19005,4.18158>,r}
+	sphere{<0.12327,-1.19005,4.18158>,r}
+	cylinder{<0.12327,-1.19005,4.18158>,<0.213418,-1.48486,4.29493>,r}
+	sphere{<0.213418,-1.48486,4.29493>,r}
+	cylinder{<0.213418,-1.48486,4.29493>,<-0.198842,-1.78447,4.3205>,r}
+	sphere{<-0.198842,-1.78447,4.3205>,r}
+	cylinder{<-0.198842,-1.78447,4.3205>,<-0.252271,-1.77204,4.30689>,r}
+	sphere{<-0.252271,-1.77204,4.30689>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.648287,-2.0586,3.72366>,<0.450412,-2.20737,3.89458>,<0.451261,-2.19032,3.93233>}
+	triangle{<0.648287,-2.0586,3.72366>,<0.451261,-2.19032,3.93233>,<0.716039,-1.88091,3.96224>}
+	triangle{<0.648287,-2.0586,3.72366>,<0.716039,-1.88091,3.96224>,<0.738381,-1.8712,3.92633>}
+	texture{t1}
+}
+union{
+	cylinder{<0.648287,-2.0586,3.72366>,<0.450412,-2.20737,3.89458>,r}
+	sphere{<0.450412,-2.20737,3.89458>,r}
+	cylinder{<0.450412,-2.20737,3.89458>,<0.451261,-2.19032,3.93233>,r}
+	sphere{<0.451261,-2.19032,3.93233>,r}
+	cylinder{<0.451261,-2.19032,3.93233>,<0.716039,-1.88091,3.96224>,r}
+	sphere{<0.716039,-1.88091,3.96224>,r}
+	cylinder{<0.716039,-1.88091,3.96224>,<0.738381,-1.8712,3.92633>,r}
+	sphere{<0.738381,-1.8712,3.92633>,r}
+	cylinder{<0.738381,-1.8712,3.92633>,<0.648287,-2.0586,3.72366>,r}
+	sphere{<0.648287,-2.0586,3.72366>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.167201,-1.04199,3.33152>,<0.516811,-1.08498,3.60007>,<0.12327,-1.19005,4.18158>}
+	triangle{<0.167201,-1.04199,3.33152>,<0.12327,-1.19005,4.18158>,<-0.0162321,-1.18702,4.15577>}
+	triangle{<0.167201,-1.04199,3.33152>,<-0.0162321,-1.18702,4.15577>,<-0.217945,-1.10681,3.68174>}
+	texture{t1}
+}
+union{
+	cylinder{<0.167201,-1.04199,3.33152>,<0.516811,-1.08498,3.60007>,r}
+	sphere{<0.516811,-1.08498,3.60007>,r}
+	cylinder{<0.516811,-1.08498,3.60007>,<0.12327,-1.19005,4.18158>,r}
+	sphere{<0.12327,-1.19005,4.18158>,r}
+	cylinder{<0.12327,-1.19005,4.18158>,<-0.0162321,-1.18702,4.15577>,r}
+	sphere{<-0.0162321,-1.18702,4.15577>,r}
+	cylinder{<-0.0162321,-1.18702,4.15577>,<-0.217945,-1.10681,3.68174>,r}
+	sphere{<-0.217945,-1.10681,3.68174>,r}
+	cylinder{<-0.217945,-1.10681,3.68174>,<0.167201,-1.04199,3.33152>,r}
+	sphere{<0.167201,-1.04199,3.33152>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.713767,-3,4.72717>,<0.713756,-2.89283,4.72715>,<1.16324,-2.02682,4.51958>}
+	triangle{<0.713767,-3,4.72717>,<1.16324,-2.02682,4.51958>,<1.78913,-2.52314,4.23083>}
+	triangle{<0.713767,-3,4.72717>,<1.78913,-2.52314,4.23083>,<1.78919,-3,4.23088>}
+	texture{t1}
+}
+union{
+	cylinder{<0.713767,-3,4.72717>,<0.713756,-2.89283,4.72715>,r}
+	sphere{<0.713756,-2.89283,4.72715>,r}
+	cylinder{<0.713756,-2.89283,4.72715>,<1.16324,-2.02682,4.51958>,r}
+	sphere{<1.16324,-2.02682,4.51958>,r}
+	cylinder{<1.16324,-2.02682,4.51958>,<1.78913,-2.52314,4.23083>,r}
+	sphere{<1.78913,-2.52314,4.23083>,r}
+	cylinder{<1.78913,-2.52314,4.23083>,<1.78919,-3,4.23088>,r}
+	sphere{<1.78919,-3,4.23088>,r}
+	cylinder{<1.78919,-3,4.23088>,<0.713767,-3,4.72717>,r}
+	sphere{<0.713767,-3,4.72717>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.12352,-2.41028,3.3131>,<1.47471,-2.05985,3.6835>,<1.79495,-2.46323,4.01935>}
+	triangle{<1.12352,-2.41028,3.3131>,<1.79495,-2.46323,4.01935>,<1.79505,-3,4.01806>}
+	triangle{<1.12352,-2.41028,3.3131>,<1.79505,-3,4.01806>,<1.12431,-3,3.31239>}
+	texture{t1}
+}
+union{
+	cylinder{<1.12352,-2.41028,3.3131>,<1.47471,-2.05985,3.6835>,r}
+	sphere{<1.47471,-2.05985,3.6835>,r}
+	cylinder{<1.47471,-2.05985,3.6835>,<1.79495,-2.46323,4.01935>,r}
+	sphere{<1.79495,-2.46323,4.01935>,r}
+	cylinder{<1.79495,-2.46323,4.01935>,<1.79505,-3,4.01806>,r}
+	sphere{<1.79505,-3,4.01806>,r}
+	cylinder{<1.79505,-3,4.01806>,<1.12431,-3,3.31239>,r}
+	sphere{<1.12431,-3,3.31239>,r}
+	cylinder{<1.12431,-3,3.31239>,<1.12352,-2.41028,3.3131>,r}
+	sphere{<1.12352,-2.41028,3.3131>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.79505,-3,4.01806>,<1.79495,-2.46323,4.01935>,<2.12546,-2.03883,3.70893>}
+	triangle{<1.79505,-3,4.01806>,<2.12546,-2.03883,3.70893>,<2.39371,-2.13978,3.45599>}
+	triangle{<1.79505,-3,4.01806>,<2.39371,-2.13978,3.45599>,<2.75353,-3,3.11508>}
+	texture{t1}
+}
+union{
+	cylinder{<1.79505,-3,4.01806>,<1.79495,-2.46323,4.01935>,r}
+	sphere{<1.79495,-2.46323,4.01935>,r}
+	cylinder{<1.79495,-2.46323,4.01935>,<2.12546,-2.03883,3.70893>,r}
+	sphere{<2.12546,-2.03883,3.70893>,r}
+	cylinder{<2.12546,-2.03883,3.70893>,<2.39371,-2.13978,3.45599>,r}
+	sphere{<2.39371,-2.13978,3.45599>,r}
+	cylinder{<2.39371,-2.13978,3.45599>,<2.75353,-3,3.11508>,r}
+	sphere{<2.75353,-3,3.11508>,r}
+	cylinder{<2.75353,-3,3.11508>,<1.79505,-3,4.01806>,r}
+	sphere{<1.79505,-3,4.01806>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.06169,-3,4.54175>,<2.0617,-2.31745,4.54178>,<2.31566,-2.05207,4.5418>}
+	triangle{<2.06169,-3,4.54175>,<2.31566,-2.05207,4.5418>,<3,-2.05208,4.54185>}
+	triangle{<2.06169,-3,4.54175>,<3,-2.05208,4.54185>,<3,-3,4.54181>}
+	texture{t1}
+}
+union{
+	cylinder{<2.06169,-3,4.54175>,<2.0617,-2.31745,4.54178>,r}
+	sphere{<2.0617,-2.31745,4.54178>,r}
+	cylinder{<2.0617,-2.31745,4.54178>,<2.31566,-2.05207,4.5418>,r}
+	sphere{<2.31566,-2.05207,4.5418>,r}
+	cylinder{<2.31566,-2.05207,4.5418>,<3,-2.05208,4.54185>,r}
+	sphere{<3,-2.05208,4.54185>,r}
+	cylinder{<3,-2.05208,4.54185>,<3,-3,4.54181>,r}
+	sphere{<3,-3,4.54181>,r}
+	cylinder{<3,-3,4.54181>,<2.06169,-3,4.54175>,r}
+	sphere{<2.06169,-3,4.54175>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.78935,-1.15095,4.65886>,<1.91139,-1.86454,4.95661>,<1.16488,-2.01626,4.53111>}
+	triangle{<1.78935,-1.15095,4.65886>,<1.16488,-2.01626,4.53111>,<1.09022,-1.80433,4.41837>}
+	triangle{<1.78935,-1.15095,4.65886>,<1.09022,-1.80433,4.41837>,<1.49081,-1.16611,4.47463>}
+	texture{t1}
+}
+union{
+	cylinder{<1.78935,-1.15095,4.65886>,<1.91139,-1.86454,4.95661>,r}
+	sphere{<1.91139,-1.86454,4.95661>,r}
+	cylinder{<1.91139,-1.86454,4.95661>,<1.16488,-2.01626,4.53111>,r}
+	sphere{<1.16488,-2.01626,4.53111>,r}
+	cylinder{<1.16488,-2.01626,4.53111>,<1.09022,-1.80433,4.41837>,r}
+	sphere{<1.09022,-1.80433,4.41837>,r}
+	cylinder{<1.09022,-1.80433,4.41837>,<1.49081,-1.16611,4.47463>,r}
+	sphere{<1.49081,-1.16611,4.47463>,r}
+	cylinder{<1.49081,-1.16611,4.47463>,<1.78935,-1.15095,4.65886>,r}
+	sphere{<1.78935,-1.15095,4.65886>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.01703,-0.767604,3.72452>,<-3,-0.767555,3.7246>,<-3,-0.246393,3.97773>}
+	triangle{<-2.01703,-0.767604,3.72452>,<-3,-0.246393,3.97773>,<-2.14103,-0.246293,3.97774>}
+	triangle{<-2.01703,-0.767604,3.72452>,<-2.14103,-0.246293,3.97774>,<-1.95182,-0.518949,3.8453>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.01703,-0.767604,3.72452>,<-3,-0.767555,3.7246>,r}
+	sphere{<-3,-0.767555,3.7246>,r}
+	cylinder{<-3,-0.767555,3.7246>,<-3,-0.246393,3.97773>,r}
+	sphere{<-3,-0.246393,3.97773>,r}
+	cylinder{<-3,-0.246393,3.97773>,<-2.14103,-0.246293,3.97774>,r}
+	sphere{<-2.14103,-0.246293,3.97774>,r}
+	cylinder{<-2.14103,-0.246293,3.97774>,<-1.95182,-0.518949,3.8453>,r}
+	sphere{<-1.95182,-0.518949,3.8453>,r}
+	cylinder{<-1.95182,-0.518949,3.8453>,<-2.01703,-0.767604,3.72452>,r}
+	sphere{<-2.01703,-0.767604,3.72452>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.01703,-0.767604,3.72452>,<-2.00374,-0.78727,3.45125>,<-2.93336,-0.837776,2.74883>}
+	triangle{<-2.01703,-0.767604,3.72452>,<-2.93336,-0.837776,2.74883>,<-3,-0.837772,2.74884>}
+	triangle{<-2.01703,-0.767604,3.72452>,<-3,-0.837772,2.74884>,<-3,-0.767555,3.7246>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.01703,-0.767604,3.72452>,<-2.00374,-0.78727,3.45125>,r}
+	sphere{<-2.00374,-0.78727,3.45125>,r}
+	cylinder{<-2.00374,-0.78727,3.45125>,<-2.93336,-0.837776,2.74883>,r}
+	sphere{<-2.93336,-0.837776,2.74883>,r}
+	cylinder{<-2.93336,-0.837776,2.74883>,<-3,-0.837772,2.74884>,r}
+	sphere{<-3,-0.837772,2.74884>,r}
+	cylinder{<-3,-0.837772,2.74884>,<-3,-0.767555,3.7246>,r}
+	sphere{<-3,-0.767555,3.7246>,r}
+	cylinder{<-3,-0.767555,3.7246>,<-2.01703,-0.767604,3.72452>,r}
+	sphere{<-2.01703,-0.767604,3.72452>,r}
+	texture{t2}
+}
+union{
+	triangle{<-3,0.228824,3.6579>,<-2.14464,0.228822,3.65798>,<-2.03052,0.0747705,3.76167>}
+	triangle{<-3,0.228824,3.6579>,<-2.03052,0.0747705,3.76167>,<-2.14103,-0.246293,3.97774>}
+	triangle{<-3,0.228824,3.6579>,<-2.14103,-0.246293,3.97774>,<-3,-0.246393,3.97773>}
+	texture{t1}
+}
+union{
+	cylinder{<-3,0.228824,3.6579>,<-2.14464,0.228822,3.65798>,r}
+	sphere{<-2.14464,0.228822,3.65798>,r}
+	cylinder{<-2.14464,0.228822,3.65798>,<-2.03052,0.0747705,3.76167>,r}
+	sphere{<-2.03052,0.0747705,3.76167>,r}
+	cylinder{<-2.03052,0.0747705,3.76167>,<-2.14103,-0.246293,3.97774>,r}
+	sphere{<-2.14103,-0.246293,3.97774>,r}
+	cylinder{<-2.14103,-0.246293,3.97774>,<-3,-0.246393,3.97773>,r}
+	sphere{<-3,-0.246393,3.97773>,r}
+	cylinder{<-3,-0.246393,3.97773>,<-3,0.228824,3.6579>,r}
+	sphere{<-3,0.228824,3.6579>,r}
+	texture{t2}
+}
+union{
+	triangle{<-3,-0.767555,3.7246>,<-2.01703,-0.767604,3.72452>,<-2.01583,-0.769833,3.72604>}
+	triangle{<-3,-0.767555,3.7246>,<-2.01583,-0.769833,3.72604>,<-2.33271,-1.30729,4.09051>}
+	triangle{<-3,-0.767555,3.7246>,<-2.33271,-1.30729,4.09051>,<-3,-1.30725,4.09055>}
+	texture{t1}
+}
+union{
+	cylinder{<-3,-0.767555,3.7246>,<-2.01703,-0.767604,3.72452>,r}
+	sphere{<-2.01703,-0.767604,3.72452>,r}
+	cylinder{<-2.01703,-0.767604,3.72452>,<-2.01583,-0.769833,3.72604>,r}
+	sphere{<-2.01583,-0.769833,3.72604>,r}
+	cylinder{<-2.01583,-0.769833,3.72604>,<-2.33271,-1.30729,4.09051>,r}
+	sphere{<-2.33271,-1.30729,4.09051>,r}
+	cylinder{<-2.33271,-1.30729,4.09051>,<-3,-1.30725,4.09055>,r}
+	sphere{<-3,-1.30725,4.09055>,r}
+	cylinder{<-3,-1.30725,4.09055>,<-3,-0.767555,3.7246>,r}
+	sphere{<-3,-0.767555,3.7246>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.18852,-1.80867,3.82973>,<-2.56095,-1.9703,3.74567>,<-3,-1.9702,3.74574>}
+	triangle{<-2.18852,-1.80867,3.82973>,<-3,-1.9702,3.74574>,<-3,-1.30725,4.09055>}
+	triangle{<-2.18852,-1.80867,3.82973>,<-3,-1.30725,4.09055>,<-2.33271,-1.30729,4.09051>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.18852,-1.80867,3.82973>,<-2.56095,-1.9703,3.74567>,r}
+	sphere{<-2.56095,-1.9703,3.74567>,r}
+	cylinder{<-2.56095,-1.9703,3.74567>,<-3,-1.9702,3.74574>,r}
+	sphere{<-3,-1.9702,3.74574>,r}
+	cylinder{<-3,-1.9702,3.74574>,<-3,-1.30725,4.09055>,r}
+	sphere{<-3,-1.30725,4.09055>,r}
+	cylinder{<-3,-1.30725,4.09055>,<-2.33271,-1.30729,4.09051>,r}
+	sphere{<-2.33271,-1.30729,4.09051>,r}
+	cylinder{<-2.33271,-1.30729,4.09051>,<-2.18852,-1.80867,3.82973>,r}
+	sphere{<-2.18852,-1.80867,3.82973>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.48051,-1.93905,4.39903>,<-1.66636,-2.04318,4.25236>,<-1.83383,-2.00045,4.33305>}
+	triangle{<-1.48051,-1.93905,4.39903>,<-1.83383,-2.00045,4.33305>,<-1.77035,-1.71069,4.77935>}
+	triangle{<-1.48051,-1.93905,4.39903>,<-1.77035,-1.71069,4.77935>,<-1.76938,-1.71065,4.77935>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.48051,-1.93905,4.39903>,<-1.66636,-2.04318,4.25236>,r}
+	sphere{<-1.66636,-2.04318,4.25236>,r}
+	cylinder{<-1.66636,-2.04318,4.25236>,<-1.83383,-2.00045,4.33305>,r}
+	sphere{<-1.83383,-2.00045,4.33305>,r}
+	cylinder{<-1.83383,-2.00045,4.33305>,<-1.77035,-1.71069,4.77935>,r}
+	sphere{<-1.77035,-1.71069,4.77935>,r}
+	cylinder{<-1.77035,-1.71069,4.77935>,<-1.76938,-1.71065,4.77935>,r}
+	sphere{<-1.76938,-1.71065,4.77935>,r}
+	cylinder{<-1.76938,-1.71065,4.77935>,<-1.48051,-1.93905,4.39903>,r}
+	sphere{<-1.48051,-1.93905,4.39903>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.16522,-1.48931,3.67654>,<-1.14087,-1.62871,4.24007>,<-1.19758,-1.30792,4.45211>}
+	triangle{<-1.16522,-1.48931,3.67654>,<-1.19758,-1.30792,4.45211>,<-1.28452,-0.814623,4.15147>}
+	triangle{<-1.16522,-1.48931,3.67654>,<-1.28452,-0.814623,4.15147>,<-1.20276,-1.27652,3.62822>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.16522,-1.48931,3.67654>,<-1.14087,-1.62871,4.24007>,r}
+	sphere{<-1.14087,-1.62871,4.24007>,r}
+	cylinder{<-1.14087,-1.62871,4.24007>,<-1.19758,-1.30792,4.45211>,r}
+	sphere{<-1.19758,-1.30792,4.45211>,r}
+	cylinder{<-1.19758,-1.30792,4.45211>,<-1.28452,-0.814623,4.15147>,r}
+	sphere{<-1.28452,-0.814623,4.15147>,r}
+	cylinder{<-1.28452,-0.814623,4.15147>,<-1.20276,-1.27652,3.62822>,r}
+	sphere{<-1.20276,-1.27652,3.62822>,r}
+	cylinder{<-1.20276,-1.27652,3.62822>,<-1.16522,-1.48931,3.67654>,r}
+	sphere{<-1.16522,-1.48931,3.67654>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.15236,-1.24226,4.5251>,<-1.95445,-1.01202,4.57849>,<-1.69153,-1.51138,4.80669>}
+	triangle{<-2.15236,-1.24226,4.5251>,<-1.69153,-1.51138,4.80669>,<-1.75768,-1.64689,4.80028>}
+	triangle{<-2.15236,-1.24226,4.5251>,<-1.75768,-1.64689,4.80028>,<-1.78448,-1.67321,4.7921>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.15236,-1.24226,4.5251>,<-1.95445,-1.01202,4.57849>,r}
+	sphere{<-1.95445,-1.01202,4.57849>,r}
+	cylinder{<-1.95445,-1.01202,4.57849>,<-1.69153,-1.51138,4.80669>,r}
+	sphere{<-1.69153,-1.51138,4.80669>,r}
+	cylinder{<-1.69153,-1.51138,4.80669>,<-1.75768,-1.64689,4.80028>,r}
+	sphere{<-1.75768,-1.64689,4.80028>,r}
+	cylinder{<-1.75768,-1.64689,4.80028>,<-1.78448,-1.67321,4.7921>,r}
+	sphere{<-1.78448,-1.67321,4.7921>,r}
+	cylinder{<-1.78448,-1.67321,4.7921>,<-2.15236,-1.24226,4.5251>,r}
+	sphere{<-2.15236,-1.24226,4.5251>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.05274,-0.557901,4.15262>,<-1.0818,-0.589775,4.21656>,<-1.12766,-0.23004,4.71338>}
+	triangle{<-1.05274,-0.557901,4.15262>,<-1.12766,-0.23004,4.71338>,<-0.912189,0.160091,4.38771>}
+	triangle{<-1.05274,-0.557901,4.15262>,<-0.912189,0.160091,4.38771>,<-0.98499,-0.419241,4.06565>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.05274,-0.557901,4.15262>,<-1.0818,-0.589775,4.21656>,r}
+	sphere{<-1.0818,-0.589775,4.21656>,r}
+	cylinder{<-1.0818,-0.589775,4.21656>,<-1.12766,-0.23004,4.71338>,r}
+	sphere{<-1.12766,-0.23004,4.71338>,r}
+	cylinder{<-1.12766,-0.23004,4.71338>,<-0.912189,0.160091,4.38771>,r}
+	sphere{<-0.912189,0.160091,4.38771>,r}
+	cylinder{<-0.912189,0.160091,4.38771>,<-0.98499,-0.419241,4.06565>,r}
+	sphere{<-0.98499,-0.419241,4.06565>,r}
+	cylinder{<-0.98499,-0.419241,4.06565>,<-1.05274,-0.557901,4.15262>,r}
+	sphere{<-1.05274,-0.557901,4.15262>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.89854,-0.541773,4.55037>,<-2.13892,-0.216786,4.42422>,<-1.98287,0.261776,4.60447>}
+	triangle{<-1.89854,-0.541773,4.55037>,<-1.98287,0.261776,4.60447>,<-1.67653,0.255845,4.82346>}
+	triangle{<-1.89854,-0.541773,4.55037>,<-1.67653,0.255845,4.82346>,<-1.4768,-0.172462,4.9057>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.89854,-0.541773,4.55037>,<-2.13892,-0.216786,4.42422>,r}
+	sphere{<-2.13892,-0.216786,4.42422>,r}
+	cylinder{<-2.13892,-0.216786,4.42422>,<-1.98287,0.261776,4.60447>,r}
+	sphere{<-1.98287,0.261776,4.60447>,r}
+	cylinder{<-1.98287,0.261776,4.60447>,<-1.67653,0.255845,4.82346>,r}
+	sphere{<-1.67653,0.255845,4.82346>,r}
+	cylinder{<-1.67653,0.255845,4.82346>,<-1.4768,-0.172462,4.9057>,r}
+	sphere{<-1.4768,-0.172462,4.9057>,r}
+	cylinder{<-1.4768,-0.172462,4.9057>,<-1.89854,-0.541773,4.55037>,r}
+	sphere{<-1.89854,-0.541773,4.55037>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.985881,0.356372,4.33876>,<-1.25603,0.525431,4.42703>,<-1.51901,0.639448,3.96565>}
+	triangle{<-0.985881,0.356372,4.33876>,<-1.51901,0.639448,3.96565>,<-1.50553,0.628435,3.93333>}
+	triangle{<-0.985881,0.356372,4.33876>,<-1.50553,0.628435,3.93333>,<-1.30272,0.502848,3.88146>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.985881,0.356372,4.33876>,<-1.25603,0.525431,4.42703>,r}
+	sphere{<-1.25603,0.525431,4.42703>,r}
+	cylinder{<-1.25603,0.525431,4.42703>,<-1.51901,0.639448,3.96565>,r}
+	sphere{<-1.51901,0.639448,3.96565>,r}
+	cylinder{<-1.51901,0.639448,3.96565>,<-1.50553,0.628435,3.93333>,r}
+	sphere{<-1.50553,0.628435,3.93333>,r}
+	cylinder{<-1.50553,0.628435,3.93333>,<-1.30272,0.502848,3.88146>,r}
+	sphere{<-1.30272,0.502848,3.88146>,r}
+	cylinder{<-1.30272,0.502848,3.88146>,<-0.985881,0.356372,4.33876>,r}
+	sphere{<-0.985881,0.356372,4.33876>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.89854,-0.541773,4.55037>,<-2.00041,-0.718924,4.73271>,<-3,-0.55781,5.09955>}
+	triangle{<-1.89854,-0.541773,4.55037>,<-3,-0.55781,5.09955>,<-3,-0.190437,4.82443>}
+	triangle{<-1.89854,-0.541773,4.55037>,<-3,-0.190437,4.82443>,<-2.13892,-0.216786,4.42422>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.89854,-0.541773,4.55037>,<-2.00041,-0.718924,4.73271>,r}
+	sphere{<-2.00041,-0.718924,4.73271>,r}
+	cylinder{<-2.00041,-0.718924,4.73271>,<-3,-0.55781,5.09955>,r}
+	sphere{<-3,-0.55781,5.09955>,r}
+	cylinder{<-3,-0.55781,5.09955>,<-3,-0.190437,4.82443>,r}
+	sphere{<-3,-0.190437,4.82443>,r}
+	cylinder{<-3,-0.190437,4.82443>,<-2.13892,-0.216786,4.42422>,r}
+	sphere{<-2.13892,-0.216786,4.42422>,r}
+	cylinder{<-2.13892,-0.216786,4.42422>,<-1.89854,-0.541773,4.55037>,r}
+	sphere{<-1.89854,-0.541773,4.55037>,r}
+	texture{t2}
+}
+union{
+	triangle{<-3,-1.20264,4.78953>,<-3,-0.55781,5.09955>,<-2.00041,-0.718924,4.73271>}
+	triangle{<-3,-1.20264,4.78953>,<-2.00041,-0.718924,4.73271>,<-1.95445,-1.01202,4.57849>}
+	triangle{<-3,-1.20264,4.78953>,<-1.95445,-1.01202,4.57849>,<-2.15236,-1.24226,4.5251>}
+	texture{t1}
+}
+union{
+	cylinder{<-3,-1.20264,4.78953>,<-3,-0.55781,5.09955>,r}
+	sphere{<-3,-0.55781,5.09955>,r}
+	cylinder{<-3,-0.55781,5.09955>,<-2.00041,-0.718924,4.73271>,r}
+	sphere{<-2.00041,-0.718924,4.73271>,r}
+	cylinder{<-2.00041,-0.718924,4.73271>,<-1.95445,-1.01202,4.57849>,r}
+	sphere{<-1.95445,-1.01202,4.57849>,r}
+	cylinder{<-1.95445,-1.01202,4.57849>,<-2.15236,-1.24226,4.5251>,r}
+	sphere{<-2.15236,-1.24226,4.5251>,r}
+	cylinder{<-2.15236,-1.24226,4.5251>,<-3,-1.20264,4.78953>,r}
+	sphere{<-3,-1.20264,4.78953>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.445188,-0.420509,3.45342>,<0.0747274,-0.653405,3.17299>,<0.167201,-1.04199,3.33152>}
+	triangle{<-0.445188,-0.420509,3.45342>,<0.167201,-1.04199,3.33152>,<-0.217945,-1.10681,3.68174>}
+	triangle{<-0.445188,-0.420509,3.45342>,<-0.217945,-1.10681,3.68174>,<-0.606816,-0.578059,3.67864>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.445188,-0.420509,3.45342>,<0.0747274,-0.653405,3.17299>,r}
+	sphere{<0.0747274,-0.653405,3.17299>,r}
+	cylinder{<0.0747274,-0.653405,3.17299>,<0.167201,-1.04199,3.33152>,r}
+	sphere{<0.167201,-1.04199,3.33152>,r}
+	cylinder{<0.167201,-1.04199,3.33152>,<-0.217945,-1.10681,3.68174>,r}
+	sphere{<-0.217945,-1.10681,3.68174>,r}
+	cylinder{<-0.217945,-1.10681,3.68174>,<-0.606816,-0.578059,3.67864>,r}
+	sphere{<-0.606816,-0.578059,3.67864>,r}
+	cylinder{<-0.606816,-0.578059,3.67864>,<-0.445188,-0.420509,3.45342>,r}
+	sphere{<-0.445188,-0.420509,3.45342>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.972824,-1.19267,3.46743>,<-1.08928,-0.913651,2.92432>,<-0.723943,-0.361722,3.21332>}
+	triangle{<-0.972824,-1.19267,3.46743>,<-0.723943,-0.361722,3.21332>,<-0.715382,-0.361497,3.23269>}
+	triangle{<-0.972824,-1.19267,3.46743>,<-0.715382,-0.361497,3.23269>,<-0.61567,-0.578709,3.6762>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.972824,-1.19267,3.46743>,<-1.08928,-0.913651,2.92432>,r}
+	sphere{<-1.08928,-0.913651,2.92432>,r}
+	cylinder{<-1.08928,-0.913651,2.92432>,<-0.723943,-0.361722,3.21332>,r}
+	sphere{<-0.723943,-0.361722,3.21332>,r}
+	cylinder{<-0.723943,-0.361722,3.21332>,<-0.715382,-0.361497,3.23269>,r}
+	sphere{<-0.715382,-0.361497,3.23269>,r}
+	cylinder{<-0.715382,-0.361497,3.23269>,<-0.61567,-0.578709,3.6762>,r}
+	sphere{<-0.61567,-0.578709,3.6762>,r}
+	cylinder{<-0.61567,-0.578709,3.6762>,<-0.972824,-1.19267,3.46743>,r}
+	sphere{<-0.972824,-1.19267,3.46743>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.85025,-0.330827,3.19041>,<-1.85169,-0.227303,3.64931>,<-1.95182,-0.518949,3.8453>}
+	triangle{<-1.85025,-0.330827,3.19041>,<-1.95182,-0.518949,3.8453>,<-2.01703,-0.767604,3.72452>}
+	triangle{<-1.85025,-0.330827,3.19041>,<-2.01703,-0.767604,3.72452>,<-2.00374,-0.78727,3.45125>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.85025,-0.330827,3.19041>,<-1.85169,-0.227303,3.64931>,r}
+	sphere{<-1.85169,-0.227303,3.64931>,r}
+	cylinder{<-1.85169,-0.227303,3.64931>,<-1.95182,-0.518949,3.8453>,r}
+	sphere{<-1.95182,-0.518949,3.8453>,r}
+	cylinder{<-1.95182,-0.518949,3.8453>,<-2.01703,-0.767604,3.72452>,r}
+	sphere{<-2.01703,-0.767604,3.72452>,r}
+	cylinder{<-2.01703,-0.767604,3.72452>,<-2.00374,-0.78727,3.45125>,r}
+	sphere{<-2.00374,-0.78727,3.45125>,r}
+	cylinder{<-2.00374,-0.78727,3.45125>,<-1.85025,-0.330827,3.19041>,r}
+	sphere{<-1.85025,-0.330827,3.19041>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.01583,-0.769833,3.72604>,<-1.80259,-1.15454,3.38578>,<-1.80675,-1.14664,3.3704>}
+	triangle{<-2.01583,-0.769833,3.72604>,<-1.80675,-1.14664,3.3704>,<-2.00374,-0.78727,3.45125>}
+	triangle{<-2.01583,-0.769833,3.72604>,<-2.00374,-0.78727,3.45125>,<-2.01703,-0.767604,3.72452>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.01583,-0.769833,3.72604>,<-1.80259,-1.15454,3.38578>,r}
+	sphere{<-1.80259,-1.15454,3.38578>,r}
+	cylinder{<-1.80259,-1.15454,3.38578>,<-1.80675,-1.14664,3.3704>,r}
+	sphere{<-1.80675,-1.14664,3.3704>,r}
+	cylinder{<-1.80675,-1.14664,3.3704>,<-2.00374,-0.78727,3.45125>,r}
+	sphere{<-2.00374,-0.78727,3.45125>,r}
+	cylinder{<-2.00374,-0.78727,3.45125>,<-2.01703,-0.767604,3.72452>,r}
+	sphere{<-2.01703,-0.767604,3.72452>,r}
+	cylinder{<-2.01703,-0.767604,3.72452>,<-2.01583,-0.769833,3.72604>,r}
+	sphere{<-2.01583,-0.769833,3.72604>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.343237,-1.81023,4.37561>,<-0.529136,-1.88232,4.26165>,<-1.14087,-1.62871,4.24007>}
+	triangle{<-0.343237,-1.81023,4.37561>,<-1.14087,-1.62871,4.24007>,<-1.19758,-1.30792,4.45211>}
+	triangle{<-0.343237,-1.81023,4.37561>,<-1.19758,-1.30792,4.45211>,<-0.754825,-1.12061,4.73475>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.343237,-1.81023,4.37561>,<-0.529136,-1.88232,4.26165>,r}
+	sphere{<-0.529136,-1.88232,4.26165>,r}
+	cylinder{<-0.529136,-1.88232,4.26165>,<-1.14087,-1.62871,4.24007>,r}
+	sphere{<-1.14087,-1.62871,4.24007>,r}
+	cylinder{<-1.14087,-1.62871,4.24007>,<-1.19758,-1.30792,4.45211>,r}
+	sphere{<-1.19758,-1.30792,4.45211>,r}
+	cylinder{<-1.19758,-1.30792,4.45211>,<-0.754825,-1.12061,4.73475>,r}
+	sphere{<-0.754825,-1.12061,4.73475>,r}
+	cylinder{<-0.754825,-1.12061,4.73475>,<-0.343237,-1.81023,4.37561>,r}
+	sphere{<-0.343237,-1.81023,4.37561>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.979224,-0.722762,3.6807>,<1.18996,-0.570446,3.41923>,<1.34375,-0.903288,3.12374>}
+	triangle{<0.979224,-0.722762,3.6807>,<1.34375,-0.903288,3.12374>,<1.27341,-1.08513,3.18011>}
+	triangle{<0.979224,-0.722762,3.6807>,<1.27341,-1.08513,3.18011>,<1.01649,-1.08041,3.54378>}
+	texture{t1}
+}
+union{
+	cylinder{<0.979224,-0.722762,3.6807>,<1.18996,-0.570446,3.41923>,r}
+	sphere{<1.18996,-0.570446,3.41923>,r}
+	cylinder{<1.18996,-0.570446,3.41923>,<1.34375,-0.903288,3.12374>,r}
+	sphere{<1.34375,-0.903288,3.12374>,r}
+	cylinder{<1.34375,-0.903288,3.12374>,<1.27341,-1.08513,3.18011>,r}
+	sphere{<1.27341,-1.08513,3.18011>,r}
+	cylinder{<1.27341,-1.08513,3.18011>,<1.01649,-1.08041,3.54378>,r}
+	sphere{<1.01649,-1.08041,3.54378>,r}
+	cylinder{<1.01649,-1.08041,3.54378>,<0.979224,-0.722762,3.6807>,r}
+	sphere{<0.979224,-0.722762,3.6807>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.979224,-0.722762,3.6807>,<1.01649,-1.08041,3.54378>,<0.653266,-1.22277,3.53316>}
+	triangle{<0.979224,-0.722762,3.6807>,<0.653266,-1.22277,3.53316>,<0.516811,-1.08498,3.60007>}
+	triangle{<0.979224,-0.722762,3.6807>,<0.516811,-1.08498,3.60007>,<0.790972,-0.695725,3.71256>}
+	texture{t1}
+}
+union{
+	cylinder{<0.979224,-0.722762,3.6807>,<1.01649,-1.08041,3.54378>,r}
+	sphere{<1.01649,-1.08041,3.54378>,r}
+	cylinder{<1.01649,-1.08041,3.54378>,<0.653266,-1.22277,3.53316>,r}
+	sphere{<0.653266,-1.22277,3.53316>,r}
+	cylinder{<0.653266,-1.22277,3.53316>,<0.516811,-1.08498,3.60007>,r}
+	sphere{<0.516811,-1.08498,3.60007>,r}
+	cylinder{<0.516811,-1.08498,3.60007>,<0.790972,-0.695725,3.71256>,r}
+	sphere{<0.790972,-0.695725,3.71256>,r}
+	cylinder{<0.790972,-0.695725,3.71256>,<0.979224,-0.722762,3.6807>,r}
+	sphere{<0.979224,-0.722762,3.6807>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.790972,-0.695725,3.71256>,<0.516811,-1.08498,3.60007>,<0.167201,-1.04199,3.33152>}
+	triangle{<0.790972,-0.695725,3.71256>,<0.167201,-1.04199,3.33152>,<0.0747274,-0.653405,3.17299>}
+	triangle{<0.790972,-0.695725,3.71256>,<0.0747274,-0.653405,3.17299>,<0.390346,-0.262469,3.31575>}
+	texture{t1}
+}
+union{
+	cylinder{<0.790972,-0.695725,3.71256>,<0.516811,-1.08498,3.60007>,r}
+	sphere{<0.516811,-1.08498,3.60007>,r}
+	cylinder{<0.516811,-1.08498,3.60007>,<0.167201,-1.04199,3.33152>,r}
+	sphere{<0.167201,-1.04199,3.33152>,r}
+	cylinder{<0.167201,-1.04199,3.33152>,<0.0747274,-0.653405,3.17299>,r}
+	sphere{<0.0747274,-0.653405,3.17299>,r}
+	cylinder{<0.0747274,-0.653405,3.17299>,<0.390346,-0.262469,3.31575>,r}
+	sphere{<0.390346,-0.262469,3.31575>,r}
+	cylinder{<0.390346,-0.262469,3.31575>,<0.790972,-0.695725,3.71256>,r}
+	sphere{<0.790972,-0.695725,3.71256>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.0787716,-0.858101,2.65521>,<0.0554648,-0.72365,2.71733>,<0.0747274,-0.653405,3.17299>}
+	triangle{<0.0787716,-0.858101,2.65521>,<0.0747274,-0.653405,3.17299>,<0.167201,-1.04199,3.33152>}
+	triangle{<0.0787716,-0.858101,2.65521>,<0.167201,-1.04199,3.33152>,<0.181806,-1.17484,3.15675>}
+	texture{t1}
+}
+union{
+	cylinder{<0.0787716,-0.858101,2.65521>,<0.0554648,-0.72365,2.71733>,r}
+	sphere{<0.0554648,-0.72365,2.71733>,r}
+	cylinder{<0.0554648,-0.72365,2.71733>,<0.0747274,-0.653405,3.17299>,r}
+	sphere{<0.0747274,-0.653405,3.17299>,r}
+	cylinder{<0.0747274,-0.653405,3.17299>,<0.167201,-1.04199,3.33152>,r}
+	sphere{<0.167201,-1.04199,3.33152>,r}
+	cylinder{<0.167201,-1.04199,3.33152>,<0.181806,-1.17484,3.15675>,r}
+	sphere{<0.181806,-1.17484,3.15675>,r}
+	cylinder{<0.181806,-1.17484,3.15675>,<0.0787716,-0.858101,2.65521>,r}
+	sphere{<0.0787716,-0.858101,2.65521>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.516811,-1.08498,3.60007>,<0.653266,-1.22277,3.53316>,<0.511678,-1.37727,3.18042>}
+	triangle{<0.516811,-1.08498,3.60007>,<0.511678,-1.37727,3.18042>,<0.181806,-1.17484,3.15675>}
+	triangle{<0.516811,-1.08498,3.60007>,<0.181806,-1.17484,3.15675>,<0.167201,-1.04199,3.33152>}
+	texture{t1}
+}
+union{
+	cylinder{<0.516811,-1.08498,3.60007>,<0.653266,-1.22277,3.53316>,r}
+	sphere{<0.653266,-1.22277,3.53316>,r}
+	cylinder{<0.653266,-1.22277,3.53316>,<0.511678,-1.37727,3.18042>,r}
+	sphere{<0.511678,-1.37727,3.18042>,r}
+	cylinder{<0.511678,-1.37727,3.18042>,<0.181806,-1.17484,3.15675>,r}
+	sphere{<0.181806,-1.17484,3.15675>,r}
+	cylinder{<0.181806,-1.17484,3.15675>,<0.167201,-1.04199,3.33152>,r}
+	sphere{<0.167201,-1.04199,3.33152>,r}
+	cylinder{<0.167201,-1.04199,3.33152>,<0.516811,-1.08498,3.60007>,r}
+	sphere{<0.516811,-1.08498,3.60007>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.01395,-1.35649,2.57513>,<0.511678,-1.37727,3.18042>,<0.653266,-1.22277,3.53316>}
+	triangle{<1.01395,-1.35649,2.57513>,<0.653266,-1.22277,3.53316>,<1.01649,-1.08041,3.54378>}
+	triangle{<1.01395,-1.35649,2.57513>,<1.01649,-1.08041,3.54378>,<1.27341,-1.08513,3.18011>}
+	texture{t1}
+}
+union{
+	cylinder{<1.01395,-1.35649,2.57513>,<0.511678,-1.37727,3.18042>,r}
+	sphere{<0.511678,-1.37727,3.18042>,r}
+	cylinder{<0.511678,-1.37727,3.18042>,<0.653266,-1.22277,3.53316>,r}
+	sphere{<0.653266,-1.22277,3.53316>,r}
+	cylinder{<0.653266,-1.22277,3.53316>,<1.01649,-1.08041,3.54378>,r}
+	sphere{<1.01649,-1.08041,3.54378>,r}
+	cylinder{<1.01649,-1.08041,3.54378>,<1.27341,-1.08513,3.18011>,r}
+	sphere{<1.27341,-1.08513,3.18011>,r}
+	cylinder{<1.27341,-1.08513,3.18011>,<1.01395,-1.35649,2.57513>,r}
+	sphere{<1.01395,-1.35649,2.57513>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.790972,-0.695725,3.71256>,<0.746152,-0.519525,4.08695>,<0.900777,-0.498287,4.15464>}
+	triangle{<0.790972,-0.695725,3.71256>,<0.900777,-0.498287,4.15464>,<1.10967,-0.59154,3.98261>}
+	triangle{<0.790972,-0.695725,3.71256>,<1.10967,-0.59154,3.98261>,<0.979224,-0.722762,3.6807>}
+	texture{t1}
+}
+union{
+	cylinder{<0.790972,-0.695725,3.71256>,<0.746152,-0.519525,4.08695>,r}
+	sphere{<0.746152,-0.519525,4.08695>,r}
+	cylinder{<0.746152,-0.519525,4.08695>,<0.900777,-0.498287,4.15464>,r}
+	sphere{<0.900777,-0.498287,4.15464>,r}
+	cylinder{<0.900777,-0.498287,4.15464>,<1.10967,-0.59154,3.98261>,r}
+	sphere{<1.10967,-0.59154,3.98261>,r}
+	cylinder{<1.10967,-0.59154,3.98261>,<0.979224,-0.722762,3.6807>,r}
+	sphere{<0.979224,-0.722762,3.6807>,r}
+	cylinder{<0.979224,-0.722762,3.6807>,<0.790972,-0.695725,3.71256>,r}
+	sphere{<0.790972,-0.695725,3.71256>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.790972,-0.695725,3.71256>,<0.390346,-0.262469,3.31575>,<0.212813,0.0550446,3.55145>}
+	triangle{<0.790972,-0.695725,3.71256>,<0.212813,0.0550446,3.55145>,<0.516319,-0.189665,4.12588>}
+	triangle{<0.790972,-0.695725,3.71256>,<0.516319,-0.189665,4.12588>,<0.746152,-0.519525,4.08695>}
+	texture{t1}
+}
+union{
+	cylinder{<0.790972,-0.695725,3.71256>,<0.390346,-0.262469,3.31575>,r}
+	sphere{<0.390346,-0.262469,3.31575>,r}
+	cylinder{<0.390346,-0.262469,3.31575>,<0.212813,0.0550446,3.55145>,r}
+	sphere{<0.212813,0.0550446,3.55145>,r}
+	cylinder{<0.212813,0.0550446,3.55145>,<0.516319,-0.189665,4.12588>,r}
+	sphere{<0.516319,-0.189665,4.12588>,r}
+	cylinder{<0.516319,-0.189665,4.12588>,<0.746152,-0.519525,4.08695>,r}
+	sphere{<0.746152,-0.519525,4.08695>,r}
+	cylinder{<0.746152,-0.519525,4.08695>,<0.790972,-0.695725,3.71256>,r}
+	sphere{<0.790972,-0.695725,3.71256>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.18996,-0.570446,3.41923>,<0.979224,-0.722762,3.6807>,<1.10967,-0.59154,3.98261>}
+	triangle{<1.18996,-0.570446,3.41923>,<1.10967,-0.59154,3.98261>,<1.39458,-0.362704,3.91677>}
+	triangle{<1.18996,-0.570446,3.41923>,<1.39458,-0.362704,3.91677>,<1.45558,-0.339513,3.57865>}
+	texture{t1}
+}
+union{
+	cylinder{<1.18996,-0.570446,3.41923>,<0.979224,-0.722762,3.6807>,r}
+	sphere{<0.979224,-0.722762,3.6807>,r}
+	cylinder{<0.979224,-0.722762,3.6807>,<1.10967,-0.59154,3.98261>,r}
+	sphere{<1.10967,-0.59154,3.98261>,r}
+	cylinder{<1.10967,-0.59154,3.98261>,<1.39458,-0.362704,3.91677>,r}
+	sphere{<1.39458,-0.362704,3.91677>,r}
+	cylinder{<1.39458,-0.362704,3.91677>,<1.45558,-0.339513,3.57865>,r}
+	sphere{<1.45558,-0.339513,3.57865>,r}
+	cylinder{<1.45558,-0.339513,3.57865>,<1.18996,-0.570446,3.41923>,r}
+	sphere{<1.18996,-0.570446,3.41923>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.45262,0.151105,3.3732>,<1.45558,-0.339513,3.57865>,<1.39458,-0.362704,3.91677>}
+	triangle{<1.45262,0.151105,3.3732>,<1.39458,-0.362704,3.91677>,<1.30865,0.079253,4.17887>}
+	triangle{<1.45262,0.151105,3.3732>,<1.30865,0.079253,4.17887>,<1.37249,0.393,3.69442>}
+	texture{t1}
+}
+union{
+	cylinder{<1.45262,0.151105,3.3732>,<1.45558,-0.339513,3.57865>,r}
+	sphere{<1.45558,-0.339513,3.57865>,r}
+	cylinder{<1.45558,-0.339513,3.57865>,<1.39458,-0.362704,3.91677>,r}
+	sphere{<1.39458,-0.362704,3.91677>,r}
+	cylinder{<1.39458,-0.362704,3.91677>,<1.30865,0.079253,4.17887>,r}
+	sphere{<1.30865,0.079253,4.17887>,r}
+	cylinder{<1.30865,0.079253,4.17887>,<1.37249,0.393,3.69442>,r}
+	sphere{<1.37249,0.393,3.69442>,r}
+	cylinder{<1.37249,0.393,3.69442>,<1.45262,0.151105,3.3732>,r}
+	sphere{<1.45262,0.151105,3.3732>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.39458,-0.362704,3.91677>,<1.10967,-0.59154,3.98261>,<0.900777,-0.498287,4.15464>}
+	triangle{<1.39458,-0.362704,3.91677>,<0.900777,-0.498287,4.15464>,<0.952171,0.0839524,4.39922>}
+	triangle{<1.39458,-0.362704,3.91677>,<0.952171,0.0839524,4.39922>,<1.30865,0.079253,4.17887>}
+	texture{t1}
+}
+union{
+	cylinder{<1.39458,-0.362704,3.91677>,<1.10967,-0.59154,3.98261>,r}
+	sphere{<1.10967,-0.59154,3.98261>,r}
+	cylinder{<1.10967,-0.59154,3.98261>,<0.900777,-0.498287,4.15464>,r}
+	sphere{<0.900777,-0.498287,4.15464>,r}
+	cylinder{<0.900777,-0.498287,4.15464>,<0.952171,0.0839524,4.39922>,r}
+	sphere{<0.952171,0.0839524,4.39922>,r}
+	cylinder{<0.952171,0.0839524,4.39922>,<1.30865,0.079253,4.17887>,r}
+	sphere{<1.30865,0.079253,4.17887>,r}
+	cylinder{<1.30865,0.079253,4.17887>,<1.39458,-0.362704,3.91677>,r}
+	sphere{<1.39458,-0.362704,3.91677>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.212813,0.0550446,3.55145>,<0.235412,0.176286,3.50502>,<0.64463,0.687293,3.74163>}
+	triangle{<0.212813,0.0550446,3.55145>,<0.64463,0.687293,3.74163>,<0.855745,0.138657,4.38324>}
+	triangle{<0.212813,0.0550446,3.55145>,<0.855745,0.138657,4.38324>,<0.516319,-0.189665,4.12588>}
+	texture{t1}
+}
+union{
+	cylinder{<0.212813,0.0550446,3.55145>,<0.235412,0.176286,3.50502>,r}
+	sphere{<0.235412,0.176286,3.50502>,r}
+	cylinder{<0.235412,0.176286,3.50502>,<0.64463,0.687293,3.74163>,r}
+	sphere{<0.64463,0.687293,3.74163>,r}
+	cylinder{<0.64463,0.687293,3.74163>,<0.855745,0.138657,4.38324>,r}
+	sphere{<0.855745,0.138657,4.38324>,r}
+	cylinder{<0.855745,0.138657,4.38324>,<0.516319,-0.189665,4.12588>,r}
+	sphere{<0.516319,-0.189665,4.12588>,r}
+	cylinder{<0.516319,-0.189665,4.12588>,<0.212813,0.0550446,3.55145>,r}
+	sphere{<0.212813,0.0550446,3.55145>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.952171,0.0839524,4.39922>,<0.900777,-0.498287,4.15464>,<0.746152,-0.519525,4.08695>}
+	triangle{<0.952171,0.0839524,4.39922>,<0.746152,-0.519525,4.08695>,<0.516319,-0.189665,4.12588>}
+	triangle{<0.952171,0.0839524,4.39922>,<0.516319,-0.189665,4.12588>,<0.855745,0.138657,4.38324>}
+	texture{t1}
+}
+union{
+	cylinder{<0.952171,0.0839524,4.39922>,<0.900777,-0.498287,4.15464>,r}
+	sphere{<0.900777,-0.498287,4.15464>,r}
+	cylinder{<0.900777,-0.498287,4.15464>,<0.746152,-0.519525,4.08695>,r}
+	sphere{<0.746152,-0.519525,4.08695>,r}
+	cylinder{<0.746152,-0.519525,4.08695>,<0.516319,-0.189665,4.12588>,r}
+	sphere{<0.516319,-0.189665,4.12588>,r}
+	cylinder{<0.516319,-0.189665,4.12588>,<0.855745,0.138657,4.38324>,r}
+	sphere{<0.855745,0.138657,4.38324>,r}
+	cylinder{<0.855745,0.138657,4.38324>,<0.952171,0.0839524,4.39922>,r}
+	sphere{<0.952171,0.0839524,4.39922>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.746152,-0.519525,4.08695>,<0.246304,-0.933685,4.36583>,<7.23375e-05,-0.743421,4.43554>}
+	triangle{<0.746152,-0.519525,4.08695>,<7.23375e-05,-0.743421,4.43554>,<0.054503,-0.251235,4.32844>}
+	triangle{<0.746152,-0.519525,4.08695>,<0.054503,-0.251235,4.32844>,<0.516319,-0.189665,4.12588>}
+	texture{t1}
+}
+union{
+	cylinder{<0.746152,-0.519525,4.08695>,<0.246304,-0.933685,4.36583>,r}
+	sphere{<0.246304,-0.933685,4.36583>,r}
+	cylinder{<0.246304,-0.933685,4.36583>,<7.23375e-05,-0.743421,4.43554>,r}
+	sphere{<7.23375e-05,-0.743421,4.43554>,r}
+	cylinder{<7.23375e-05,-0.743421,4.43554>,<0.054503,-0.251235,4.32844>,r}
+	sphere{<0.054503,-0.251235,4.32844>,r}
+	cylinder{<0.054503,-0.251235,4.32844>,<0.516319,-0.189665,4.12588>,r}
+	sphere{<0.516319,-0.189665,4.12588>,r}
+	cylinder{<0.516319,-0.189665,4.12588>,<0.746152,-0.519525,4.08695>,r}
+	sphere{<0.746152,-0.519525,4.08695>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.746152,-0.519525,4.08695>,<0.790972,-0.695725,3.71256>,<0.516811,-1.08498,3.60007>}
+	triangle{<0.746152,-0.519525,4.08695>,<0.516811,-1.08498,3.60007>,<0.12327,-1.19005,4.18158>}
+	triangle{<0.746152,-0.519525,4.08695>,<0.12327,-1.19005,4.18158>,<0.246304,-0.933685,4.36583>}
+	texture{t1}
+}
+union{
+	cylinder{<0.746152,-0.519525,4.08695>,<0.790972,-0.695725,3.71256>,r}
+	sphere{<0.790972,-0.695725,3.71256>,r}
+	cylinder{<0.790972,-0.695725,3.71256>,<0.516811,-1.08498,3.60007>,r}
+	sphere{<0.516811,-1.08498,3.60007>,r}
+	cylinder{<0.516811,-1.08498,3.60007>,<0.12327,-1.19005,4.18158>,r}
+	sphere{<0.12327,-1.19005,4.18158>,r}
+	cylinder{<0.12327,-1.19005,4.18158>,<0.246304,-0.933685,4.36583>,r}
+	sphere{<0.246304,-0.933685,4.36583>,r}
+	cylinder{<0.246304,-0.933685,4.36583>,<0.746152,-0.519525,4.08695>,r}
+	sphere{<0.746152,-0.519525,4.08695>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.445188,-0.420509,3.45342>,<-0.0557612,0.040329,3.61692>,<-0.245525,-0.12541,4.0486>}
+	triangle{<-0.445188,-0.420509,3.45342>,<-0.245525,-0.12541,4.0486>,<-0.580491,-0.5226,3.90099>}
+	triangle{<-0.445188,-0.420509,3.45342>,<-0.580491,-0.5226,3.90099>,<-0.606816,-0.578059,3.67864>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.445188,-0.420509,3.45342>,<-0.0557612,0.040329,3.61692>,r}
+	sphere{<-0.0557612,0.040329,3.61692>,r}
+	cylinder{<-0.0557612,0.040329,3.61692>,<-0.245525,-0.12541,4.0486>,r}
+	sphere{<-0.245525,-0.12541,4.0486>,r}
+	cylinder{<-0.245525,-0.12541,4.0486>,<-0.580491,-0.5226,3.90099>,r}
+	sphere{<-0.580491,-0.5226,3.90099>,r}
+	cylinder{<-0.580491,-0.5226,3.90099>,<-0.606816,-0.578059,3.67864>,r}
+	sphere{<-0.606816,-0.578059,3.67864>,r}
+	cylinder{<-0.606816,-0.578059,3.67864>,<-0.445188,-0.420509,3.45342>,r}
+	sphere{<-0.445188,-0.420509,3.45342>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.212813,0.0550446,3.55145>,<0.516319,-0.189665,4.12588>,<0.054503,-0.251235,4.32844>}
+	triangle{<0.212813,0.0550446,3.55145>,<0.054503,-0.251235,4.32844>,<-0.245525,-0.12541,4.0486>}
+	triangle{<0.212813,0.0550446,3.55145>,<-0.245525,-0.12541,4.0486>,<-0.0557612,0.040329,3.61692>}
+	texture{t1}
+}
+union{
+	cylinder{<0.212813,0.0550446,3.55145>,<0.516319,-0.189665,4.12588>,r}
+	sphere{<0.516319,-0.189665,4.12588>,r}
+	cylinder{<0.516319,-0.189665,4.12588>,<0.054503,-0.251235,4.32844>,r}
+	sphere{<0.054503,-0.251235,4.32844>,r}
+	cylinder{<0.054503,-0.251235,4.32844>,<-0.245525,-0.12541,4.0486>,r}
+	sphere{<-0.245525,-0.12541,4.0486>,r}
+	cylinder{<-0.245525,-0.12541,4.0486>,<-0.0557612,0.040329,3.61692>,r}
+	sphere{<-0.0557612,0.040329,3.61692>,r}
+	cylinder{<-0.0557612,0.040329,3.61692>,<0.212813,0.0550446,3.55145>,r}
+	sphere{<0.212813,0.0550446,3.55145>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.198642,-0.872817,4.31541>,<7.23375e-05,-0.743421,4.43554>,<0.246304,-0.933685,4.36583>}
+	triangle{<-0.198642,-0.872817,4.31541>,<0.246304,-0.933685,4.36583>,<0.12327,-1.19005,4.18158>}
+	triangle{<-0.198642,-0.872817,4.31541>,<0.12327,-1.19005,4.18158>,<-0.0162321,-1.18702,4.15577>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.198642,-0.872817,4.31541>,<7.23375e-05,-0.743421,4.43554>,r}
+	sphere{<7.23375e-05,-0.743421,4.43554>,r}
+	cylinder{<7.23375e-05,-0.743421,4.43554>,<0.246304,-0.933685,4.36583>,r}
+	sphere{<0.246304,-0.933685,4.36583>,r}
+	cylinder{<0.246304,-0.933685,4.36583>,<0.12327,-1.19005,4.18158>,r}
+	sphere{<0.12327,-1.19005,4.18158>,r}
+	cylinder{<0.12327,-1.19005,4.18158>,<-0.0162321,-1.18702,4.15577>,r}
+	sphere{<-0.0162321,-1.18702,4.15577>,r}
+	cylinder{<-0.0162321,-1.18702,4.15577>,<-0.198642,-0.872817,4.31541>,r}
+	sphere{<-0.198642,-0.872817,4.31541>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.198642,-0.872817,4.31541>,<-0.580491,-0.5226,3.90099>,<-0.245525,-0.12541,4.0486>}
+	triangle{<-0.198642,-0.872817,4.31541>,<-0.245525,-0.12541,4.0486>,<0.054503,-0.251235,4.32844>}
+	triangle{<-0.198642,-0.872817,4.31541>,<0.054503,-0.251235,4.32844>,<7.23375e-05,-0.743421,4.43554>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.198642,-0.872817,4.31541>,<-0.580491,-0.5226,3.90099>,r}
+	sphere{<-0.580491,-0.5226,3.90099>,r}
+	cylinder{<-0.580491,-0.5226,3.90099>,<-0.245525,-0.12541,4.0486>,r}
+	sphere{<-0.245525,-0.12541,4.0486>,r}
+	cylinder{<-0.245525,-0.12541,4.0486>,<0.054503,-0.251235,4.32844>,r}
+	sphere{<0.054503,-0.251235,4.32844>,r}
+	cylinder{<0.054503,-0.251235,4.32844>,<7.23375e-05,-0.743421,4.43554>,r}
+	sphere{<7.23375e-05,-0.743421,4.43554>,r}
+	cylinder{<7.23375e-05,-0.743421,4.43554>,<-0.198642,-0.872817,4.31541>,r}
+	sphere{<-0.198642,-0.872817,4.31541>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.198642,-0.872817,4.31541>,<-0.0162321,-1.18702,4.15577>,<-0.217945,-1.10681,3.68174>}
+	triangle{<-0.198642,-0.872817,4.31541>,<-0.217945,-1.10681,3.68174>,<-0.606816,-0.578059,3.67864>}
+	triangle{<-0.198642,-0.872817,4.31541>,<-0.606816,-0.578059,3.67864>,<-0.580491,-0.5226,3.90099>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.198642,-0.872817,4.31541>,<-0.0162321,-1.18702,4.15577>,r}
+	sphere{<-0.0162321,-1.18702,4.15577>,r}
+	cylinder{<-0.0162321,-1.18702,4.15577>,<-0.217945,-1.10681,3.68174>,r}
+	sphere{<-0.217945,-1.10681,3.68174>,r}
+	cylinder{<-0.217945,-1.10681,3.68174>,<-0.606816,-0.578059,3.67864>,r}
+	sphere{<-0.606816,-0.578059,3.67864>,r}
+	cylinder{<-0.606816,-0.578059,3.67864>,<-0.580491,-0.5226,3.90099>,r}
+	sphere{<-0.580491,-0.5226,3.90099>,r}
+	cylinder{<-0.580491,-0.5226,3.90099>,<-0.198642,-0.872817,4.31541>,r}
+	sphere{<-0.198642,-0.872817,4.31541>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.900777,-0.498287,4.15464>,<0.997981,-0.91178,4.81208>,<0.633798,-1.13415,4.90092>}
+	triangle{<0.900777,-0.498287,4.15464>,<0.633798,-1.13415,4.90092>,<0.246304,-0.933685,4.36583>}
+	triangle{<0.900777,-0.498287,4.15464>,<0.246304,-0.933685,4.36583>,<0.746152,-0.519525,4.08695>}
+	texture{t1}
+}
+union{
+	cylinder{<0.900777,-0.498287,4.15464>,<0.997981,-0.91178,4.81208>,r}
+	sphere{<0.997981,-0.91178,4.81208>,r}
+	cylinder{<0.997981,-0.91178,4.81208>,<0.633798,-1.13415,4.90092>,r}
+	sphere{<0.633798,-1.13415,4.90092>,r}
+	cylinder{<0.633798,-1.13415,4.90092>,<0.246304,-0.933685,4.36583>,r}
+	sphere{<0.246304,-0.933685,4.36583>,r}
+	cylinder{<0.246304,-0.933685,4.36583>,<0.746152,-0.519525,4.08695>,r}
+	sphere{<0.746152,-0.519525,4.08695>,r}
+	cylinder{<0.746152,-0.519525,4.08695>,<0.900777,-0.498287,4.15464>,r}
+	sphere{<0.900777,-0.498287,4.15464>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.900777,-0.498287,4.15464>,<1.10967,-0.59154,3.98261>,<1.51267,-1.13668,4.37853>}
+	triangle{<0.900777,-0.498287,4.15464>,<1.51267,-1.13668,4.37853>,<1.49081,-1.16611,4.47463>}
+	triangle{<0.900777,-0.498287,4.15464>,<1.49081,-1.16611,4.47463>,<0.997981,-0.91178,4.81208>}
+	texture{t1}
+}
+union{
+	cylinder{<0.900777,-0.498287,4.15464>,<1.10967,-0.59154,3.98261>,r}
+	sphere{<1.10967,-0.59154,3.98261>,r}
+	cylinder{<1.10967,-0.59154,3.98261>,<1.51267,-1.13668,4.37853>,r}
+	sphere{<1.51267,-1.13668,4.37853>,r}
+	cylinder{<1.51267,-1.13668,4.37853>,<1.49081,-1.16611,4.47463>,r}
+	sphere{<1.49081,-1.16611,4.47463>,r}
+	cylinder{<1.49081,-1.16611,4.47463>,<0.997981,-0.91178,4.81208>,r}
+	sphere{<0.997981,-0.91178,4.81208>,r}
+	cylinder{<0.997981,-0.91178,4.81208>,<0.900777,-0.498287,4.15464>,r}
+	sphere{<0.900777,-0.498287,4.15464>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.213418,-1.48486,4.29493>,<0.12327,-1.19005,4.18158>,<0.246304,-0.933685,4.36583>}
+	triangle{<0.213418,-1.48486,4.29493>,<0.246304,-0.933685,4.36583>,<0.633798,-1.13415,4.90092>}
+	triangle{<0.213418,-1.48486,4.29493>,<0.633798,-1.13415,4.90092>,<0.590882,-1.36796,4.83018>}
+	texture{t1}
+}
+union{
+	cylinder{<0.213418,-1.48486,4.29493>,<0.12327,-1.19005,4.18158>,r}
+	sphere{<0.12327,-1.19005,4.18158>,r}
+	cylinder{<0.12327,-1.19005,4.18158>,<0.246304,-0.933685,4.36583>,r}
+	sphere{<0.246304,-0.933685,4.36583>,r}
+	cylinder{<0.246304,-0.933685,4.36583>,<0.633798,-1.13415,4.90092>,r}
+	sphere{<0.633798,-1.13415,4.90092>,r}
+	cylinder{<0.633798,-1.13415,4.90092>,<0.590882,-1.36796,4.83018>,r}
+	sphere{<0.590882,-1.36796,4.83018>,r}
+	cylinder{<0.590882,-1.36796,4.83018>,<0.213418,-1.48486,4.29493>,r}
+	sphere{<0.213418,-1.48486,4.29493>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.213418,-1.48486,4.29493>,<0.590882,-1.36796,4.83018>,<1.09022,-1.80433,4.41837>}
+	triangle{<0.213418,-1.48486,4.29493>,<1.09022,-1.80433,4.41837>,<1.06006,-1.85916,4.2894>}
+	triangle{<0.213418,-1.48486,4.29493>,<1.06006,-1.85916,4.2894>,<0.716039,-1.88091,3.96224>}
+	texture{t1}
+}
+union{
+	cylinder{<0.213418,-1.48486,4.29493>,<0.590882,-1.36796,4.83018>,r}
+	sphere{<0.590882,-1.36796,4.83018>,r}
+	cylinder{<0.590882,-1.36796,4.83018>,<1.09022,-1.80433,4.41837>,r}
+	sphere{<1.09022,-1.80433,4.41837>,r}
+	cylinder{<1.09022,-1.80433,4.41837>,<1.06006,-1.85916,4.2894>,r}
+	sphere{<1.06006,-1.85916,4.2894>,r}
+	cylinder{<1.06006,-1.85916,4.2894>,<0.716039,-1.88091,3.96224>,r}
+	sphere{<0.716039,-1.88091,3.96224>,r}
+	cylinder{<0.716039,-1.88091,3.96224>,<0.213418,-1.48486,4.29493>,r}
+	sphere{<0.213418,-1.48486,4.29493>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.633798,-1.13415,4.90092>,<0.997981,-0.91178,4.81208>,<1.49081,-1.16611,4.47463>}
+	triangle{<0.633798,-1.13415,4.90092>,<1.49081,-1.16611,4.47463>,<1.09022,-1.80433,4.41837>}
+	triangle{<0.633798,-1.13415,4.90092>,<1.09022,-1.80433,4.41837>,<0.590882,-1.36796,4.83018>}
+	texture{t1}
+}
+union{
+	cylinder{<0.633798,-1.13415,4.90092>,<0.997981,-0.91178,4.81208>,r}
+	sphere{<0.997981,-0.91178,4.81208>,r}
+	cylinder{<0.997981,-0.91178,4.81208>,<1.49081,-1.16611,4.47463>,r}
+	sphere{<1.49081,-1.16611,4.47463>,r}
+	cylinder{<1.49081,-1.16611,4.47463>,<1.09022,-1.80433,4.41837>,r}
+	sphere{<1.09022,-1.80433,4.41837>,r}
+	cylinder{<1.09022,-1.80433,4.41837>,<0.590882,-1.36796,4.83018>,r}
+	sphere{<0.590882,-1.36796,4.83018>,r}
+	cylinder{<0.590882,-1.36796,4.83018>,<0.633798,-1.13415,4.90092>,r}
+	sphere{<0.633798,-1.13415,4.90092>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.04999,-0.636588,2.49358>,<2.19299,-0.114066,2.82422>,<2.12833,-0.121563,3.24393>}
+	triangle{<2.04999,-0.636588,2.49358>,<2.12833,-0.121563,3.24393>,<1.98392,-0.440217,3.43023>}
+	triangle{<2.04999,-0.636588,2.49358>,<1.98392,-0.440217,3.43023>,<1.89822,-0.784519,3.15454>}
+	texture{t1}
+}
+union{
+	cylinder{<2.04999,-0.636588,2.49358>,<2.19299,-0.114066,2.82422>,r}
+	sphere{<2.19299,-0.114066,2.82422>,r}
+	cylinder{<2.19299,-0.114066,2.82422>,<2.12833,-0.121563,3.24393>,r}
+	sphere{<2.12833,-0.121563,3.24393>,r}
+	cylinder{<2.12833,-0.121563,3.24393>,<1.98392,-0.440217,3.43023>,r}
+	sphere{<1.98392,-0.440217,3.43023>,r}
+	cylinder{<1.98392,-0.440217,3.43023>,<1.89822,-0.784519,3.15454>,r}
+	sphere{<1.89822,-0.784519,3.15454>,r}
+	cylinder{<1.89822,-0.784519,3.15454>,<2.04999,-0.636588,2.49358>,r}
+	sphere{<2.04999,-0.636588,2.49358>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.2889,-0.878848,3.63006>,<2.15413,-0.499402,3.62891>,<2.58285,-0.127081,3.62775>}
+	triangle{<2.2889,-0.878848,3.63006>,<2.58285,-0.127081,3.62775>,<3,-0.125994,3.62772>}
+	triangle{<2.2889,-0.878848,3.63006>,<3,-0.125994,3.62772>,<3,-0.878809,3.63002>}
+	texture{t1}
+}
+union{
+	cylinder{<2.2889,-0.878848,3.63006>,<2.15413,-0.499402,3.62891>,r}
+	sphere{<2.15413,-0.499402,3.62891>,r}
+	cylinder{<2.15413,-0.499402,3.62891>,<2.58285,-0.127081,3.62775>,r}
+	sphere{<2.58285,-0.127081,3.62775>,r}
+	cylinder{<2.58285,-0.127081,3.62775>,<3,-0.125994,3.62772>,r}
+	sphere{<3,-0.125994,3.62772>,r}
+	cylinder{<3,-0.125994,3.62772>,<3,-0.878809,3.63002>,r}
+	sphere{<3,-0.878809,3.63002>,r}
+	cylinder{<3,-0.878809,3.63002>,<2.2889,-0.878848,3.63006>,r}
+	sphere{<2.2889,-0.878848,3.63006>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.2889,-0.878848,3.63006>,<2.11527,-1.09731,3.29646>,<1.89822,-0.784519,3.15454>}
+	triangle{<2.2889,-0.878848,3.63006>,<1.89822,-0.784519,3.15454>,<1.98392,-0.440217,3.43023>}
+	triangle{<2.2889,-0.878848,3.63006>,<1.98392,-0.440217,3.43023>,<2.15413,-0.499402,3.62891>}
+	texture{t1}
+}
+union{
+	cylinder{<2.2889,-0.878848,3.63006>,<2.11527,-1.09731,3.29646>,r}
+	sphere{<2.11527,-1.09731,3.29646>,r}
+	cylinder{<2.11527,-1.09731,3.29646>,<1.89822,-0.784519,3.15454>,r}
+	sphere{<1.89822,-0.784519,3.15454>,r}
+	cylinder{<1.89822,-0.784519,3.15454>,<1.98392,-0.440217,3.43023>,r}
+	sphere{<1.98392,-0.440217,3.43023>,r}
+	cylinder{<1.98392,-0.440217,3.43023>,<2.15413,-0.499402,3.62891>,r}
+	sphere{<2.15413,-0.499402,3.62891>,r}
+	cylinder{<2.15413,-0.499402,3.62891>,<2.2889,-0.878848,3.63006>,r}
+	sphere{<2.2889,-0.878848,3.63006>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.2889,-0.878848,3.63006>,<3,-0.878809,3.63002>,<3,-1.32329,2.95121>}
+	triangle{<2.2889,-0.878848,3.63006>,<3,-1.32329,2.95121>,<2.46388,-1.32328,2.9513>}
+	triangle{<2.2889,-0.878848,3.63006>,<2.46388,-1.32328,2.9513>,<2.11527,-1.09731,3.29646>}
+	texture{t1}
+}
+union{
+	cylinder{<2.2889,-0.878848,3.63006>,<3,-0.878809,3.63002>,r}
+	sphere{<3,-0.878809,3.63002>,r}
+	cylinder{<3,-0.878809,3.63002>,<3,-1.32329,2.95121>,r}
+	sphere{<3,-1.32329,2.95121>,r}
+	cylinder{<3,-1.32329,2.95121>,<2.46388,-1.32328,2.9513>,r}
+	sphere{<2.46388,-1.32328,2.9513>,r}
+	cylinder{<2.46388,-1.32328,2.9513>,<2.11527,-1.09731,3.29646>,r}
+	sphere{<2.11527,-1.09731,3.29646>,r}
+	cylinder{<2.11527,-1.09731,3.29646>,<2.2889,-0.878848,3.63006>,r}
+	sphere{<2.2889,-0.878848,3.63006>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.19299,-0.114066,2.82422>,<3,-0.111988,2.82554>,<3,-0.125994,3.62772>}
+	triangle{<2.19299,-0.114066,2.82422>,<3,-0.125994,3.62772>,<2.58285,-0.127081,3.62775>}
+	triangle{<2.19299,-0.114066,2.82422>,<2.58285,-0.127081,3.62775>,<2.12833,-0.121563,3.24393>}
+	texture{t1}
+}
+union{
+	cylinder{<2.19299,-0.114066,2.82422>,<3,-0.111988,2.82554>,r}
+	sphere{<3,-0.111988,2.82554>,r}
+	cylinder{<3,-0.111988,2.82554>,<3,-0.125994,3.62772>,r}
+	sphere{<3,-0.125994,3.62772>,r}
+	cylinder{<3,-0.125994,3.62772>,<2.58285,-0.127081,3.62775>,r}
+	sphere{<2.58285,-0.127081,3.62775>,r}
+	cylinder{<2.58285,-0.127081,3.62775>,<2.12833,-0.121563,3.24393>,r}
+	sphere{<2.12833,-0.121563,3.24393>,r}
+	cylinder{<2.12833,-0.121563,3.24393>,<2.19299,-0.114066,2.82422>,r}
+	sphere{<2.19299,-0.114066,2.82422>,r}
+	texture{t2}
+}
+union{
+	triangle{<3,-2.13984,3.45592>,<2.39371,-2.13978,3.45599>,<2.12546,-2.03883,3.70893>}
+	triangle{<3,-2.13984,3.45592>,<2.12546,-2.03883,3.70893>,<2.44824,-1.8329,4.22507>}
+	triangle{<3,-2.13984,3.45592>,<2.44824,-1.8329,4.22507>,<3,-1.83291,4.22512>}
+	texture{t1}
+}
+union{
+	cylinder{<3,-2.13984,3.45592>,<2.39371,-2.13978,3.45599>,r}
+	sphere{<2.39371,-2.13978,3.45599>,r}
+	cylinder{<2.39371,-2.13978,3.45599>,<2.12546,-2.03883,3.70893>,r}
+	sphere{<2.12546,-2.03883,3.70893>,r}
+	cylinder{<2.12546,-2.03883,3.70893>,<2.44824,-1.8329,4.22507>,r}
+	sphere{<2.44824,-1.8329,4.22507>,r}
+	cylinder{<2.44824,-1.8329,4.22507>,<3,-1.83291,4.22512>,r}
+	sphere{<3,-1.83291,4.22512>,r}
+	cylinder{<3,-1.83291,4.22512>,<3,-2.13984,3.45592>,r}
+	sphere{<3,-2.13984,3.45592>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.12546,-2.03883,3.70893>,<2.39371,-2.13978,3.45599>,<1.97842,-1.79507,3.24299>}
+	triangle{<2.12546,-2.03883,3.70893>,<1.97842,-1.79507,3.24299>,<1.81827,-1.73396,3.3913>}
+	triangle{<2.12546,-2.03883,3.70893>,<1.81827,-1.73396,3.3913>,<1.8043,-1.74576,3.45923>}
+	texture{t1}
+}
+union{
+	cylinder{<2.12546,-2.03883,3.70893>,<2.39371,-2.13978,3.45599>,r}
+	sphere{<2.39371,-2.13978,3.45599>,r}
+	cylinder{<2.39371,-2.13978,3.45599>,<1.97842,-1.79507,3.24299>,r}
+	sphere{<1.97842,-1.79507,3.24299>,r}
+	cylinder{<1.97842,-1.79507,3.24299>,<1.81827,-1.73396,3.3913>,r}
+	sphere{<1.81827,-1.73396,3.3913>,r}
+	cylinder{<1.81827,-1.73396,3.3913>,<1.8043,-1.74576,3.45923>,r}
+	sphere{<1.8043,-1.74576,3.45923>,r}
+	cylinder{<1.8043,-1.74576,3.45923>,<2.12546,-2.03883,3.70893>,r}
+	sphere{<2.12546,-2.03883,3.70893>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.2889,-0.878848,3.63006>,<3,-0.878809,3.63002>,<3,-1.24577,4.20017>}
+	triangle{<2.2889,-0.878848,3.63006>,<3,-1.24577,4.20017>,<2.18173,-1.24573,4.2001>}
+	triangle{<2.2889,-0.878848,3.63006>,<2.18173,-1.24573,4.2001>,<2.12317,-1.21029,4.14503>}
+	texture{t1}
+}
+union{
+	cylinder{<2.2889,-0.878848,3.63006>,<3,-0.878809,3.63002>,r}
+	sphere{<3,-0.878809,3.63002>,r}
+	cylinder{<3,-0.878809,3.63002>,<3,-1.24577,4.20017>,r}
+	sphere{<3,-1.24577,4.20017>,r}
+	cylinder{<3,-1.24577,4.20017>,<2.18173,-1.24573,4.2001>,r}
+	sphere{<2.18173,-1.24573,4.2001>,r}
+	cylinder{<2.18173,-1.24573,4.2001>,<2.12317,-1.21029,4.14503>,r}
+	sphere{<2.12317,-1.21029,4.14503>,r}
+	cylinder{<2.12317,-1.21029,4.14503>,<2.2889,-0.878848,3.63006>,r}
+	sphere{<2.2889,-0.878848,3.63006>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.2889,-0.878848,3.63006>,<2.12317,-1.21029,4.14503>,<1.78067,-1.64091,3.48499>}
+	triangle{<2.2889,-0.878848,3.63006>,<1.78067,-1.64091,3.48499>,<1.78764,-1.62402,3.44327>}
+	triangle{<2.2889,-0.878848,3.63006>,<1.78764,-1.62402,3.44327>,<2.11527,-1.09731,3.29646>}
+	texture{t1}
+}
+union{
+	cylinder{<2.2889,-0.878848,3.63006>,<2.12317,-1.21029,4.14503>,r}
+	sphere{<2.12317,-1.21029,4.14503>,r}
+	cylinder{<2.12317,-1.21029,4.14503>,<1.78067,-1.64091,3.48499>,r}
+	sphere{<1.78067,-1.64091,3.48499>,r}
+	cylinder{<1.78067,-1.64091,3.48499>,<1.78764,-1.62402,3.44327>,r}
+	sphere{<1.78764,-1.62402,3.44327>,r}
+	cylinder{<1.78764,-1.62402,3.44327>,<2.11527,-1.09731,3.29646>,r}
+	sphere{<2.11527,-1.09731,3.29646>,r}
+	cylinder{<2.11527,-1.09731,3.29646>,<2.2889,-0.878848,3.63006>,r}
+	sphere{<2.2889,-0.878848,3.63006>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.78067,-1.64091,3.48499>,<1.31742,-1.47516,3.84638>,<1.51267,-1.13668,4.37853>}
+	triangle{<1.78067,-1.64091,3.48499>,<1.51267,-1.13668,4.37853>,<1.91565,-1.06444,4.42693>}
+	triangle{<1.78067,-1.64091,3.48499>,<1.91565,-1.06444,4.42693>,<2.12317,-1.21029,4.14503>}
+	texture{t1}
+}
+union{
+	cylinder{<1.78067,-1.64091,3.48499>,<1.31742,-1.47516,3.84638>,r}
+	sphere{<1.31742,-1.47516,3.84638>,r}
+	cylinder{<1.31742,-1.47516,3.84638>,<1.51267,-1.13668,4.37853>,r}
+	sphere{<1.51267,-1.13668,4.37853>,r}
+	cylinder{<1.51267,-1.13668,4.37853>,<1.91565,-1.06444,4.42693>,r}
+	sphere{<1.91565,-1.06444,4.42693>,r}
+	cylinder{<1.91565,-1.06444,4.42693>,<2.12317,-1.21029,4.14503>,r}
+	sphere{<2.12317,-1.21029,4.14503>,r}
+	cylinder{<2.12317,-1.21029,4.14503>,<1.78067,-1.64091,3.48499>,r}
+	sphere{<1.78067,-1.64091,3.48499>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.2889,-0.878848,3.63006>,<2.12317,-1.21029,4.14503>,<1.91565,-1.06444,4.42693>}
+	triangle{<2.2889,-0.878848,3.63006>,<1.91565,-1.06444,4.42693>,<1.89199,-0.492525,4.09978>}
+	triangle{<2.2889,-0.878848,3.63006>,<1.89199,-0.492525,4.09978>,<2.15413,-0.499402,3.62891>}
+	texture{t1}
+}
+union{
+	cylinder{<2.2889,-0.878848,3.63006>,<2.12317,-1.21029,4.14503>,r}
+	sphere{<2.12317,-1.21029,4.14503>,r}
+	cylinder{<2.12317,-1.21029,4.14503>,<1.91565,-1.06444,4.42693>,r}
+	sphere{<1.91565,-1.06444,4.42693>,r}
+	cylinder{<1.91565,-1.06444,4.42693>,<1.89199,-0.492525,4.09978>,r}
+	sphere{<1.89199,-0.492525,4.09978>,r}
+	cylinder{<1.89199,-0.492525,4.09978>,<2.15413,-0.499402,3.62891>,r}
+	sphere{<2.15413,-0.499402,3.62891>,r}
+	cylinder{<2.15413,-0.499402,3.62891>,<2.2889,-0.878848,3.63006>,r}
+	sphere{<2.2889,-0.878848,3.63006>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.979224,-0.722762,3.6807>,<1.10967,-0.59154,3.98261>,<1.51267,-1.13668,4.37853>}
+	triangle{<0.979224,-0.722762,3.6807>,<1.51267,-1.13668,4.37853>,<1.31742,-1.47516,3.84638>}
+	triangle{<0.979224,-0.722762,3.6807>,<1.31742,-1.47516,3.84638>,<1.01649,-1.08041,3.54378>}
+	texture{t1}
+}
+union{
+	cylinder{<0.979224,-0.722762,3.6807>,<1.10967,-0.59154,3.98261>,r}
+	sphere{<1.10967,-0.59154,3.98261>,r}
+	cylinder{<1.10967,-0.59154,3.98261>,<1.51267,-1.13668,4.37853>,r}
+	sphere{<1.51267,-1.13668,4.37853>,r}
+	cylinder{<1.51267,-1.13668,4.37853>,<1.31742,-1.47516,3.84638>,r}
+	sphere{<1.31742,-1.47516,3.84638>,r}
+	cylinder{<1.31742,-1.47516,3.84638>,<1.01649,-1.08041,3.54378>,r}
+	sphere{<1.01649,-1.08041,3.54378>,r}
+	cylinder{<1.01649,-1.08041,3.54378>,<0.979224,-0.722762,3.6807>,r}
+	sphere{<0.979224,-0.722762,3.6807>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.91565,-1.06444,4.42693>,<1.51267,-1.13668,4.37853>,<1.10967,-0.59154,3.98261>}
+	triangle{<1.91565,-1.06444,4.42693>,<1.10967,-0.59154,3.98261>,<1.39458,-0.362704,3.91677>}
+	triangle{<1.91565,-1.06444,4.42693>,<1.39458,-0.362704,3.91677>,<1.89199,-0.492525,4.09978>}
+	texture{t1}
+}
+union{
+	cylinder{<1.91565,-1.06444,4.42693>,<1.51267,-1.13668,4.37853>,r}
+	sphere{<1.51267,-1.13668,4.37853>,r}
+	cylinder{<1.51267,-1.13668,4.37853>,<1.10967,-0.59154,3.98261>,r}
+	sphere{<1.10967,-0.59154,3.98261>,r}
+	cylinder{<1.10967,-0.59154,3.98261>,<1.39458,-0.362704,3.91677>,r}
+	sphere{<1.39458,-0.362704,3.91677>,r}
+	cylinder{<1.39458,-0.362704,3.91677>,<1.89199,-0.492525,4.09978>,r}
+	sphere{<1.89199,-0.492525,4.09978>,r}
+	cylinder{<1.89199,-0.492525,4.09978>,<1.91565,-1.06444,4.42693>,r}
+	sphere{<1.91565,-1.06444,4.42693>,r}
+	texture{t2}
+}
+union{
+	triangle{<3,0.0726016,3.8198>,<3,-0.208826,4.59354>,<2.13265,-0.208876,4.59343>}
+	triangle{<3,0.0726016,3.8198>,<2.13265,-0.208876,4.59343>,<2.08445,-0.154057,4.44271>}
+	triangle{<3,0.0726016,3.8198>,<2.08445,-0.154057,4.44271>,<2.7017,0.0723714,3.82035>}
+	texture{t1}
+}
+union{
+	cylinder{<3,0.0726016,3.8198>,<3,-0.208826,4.59354>,r}
+	sphere{<3,-0.208826,4.59354>,r}
+	cylinder{<3,-0.208826,4.59354>,<2.13265,-0.208876,4.59343>,r}
+	sphere{<2.13265,-0.208876,4.59343>,r}
+	cylinder{<2.13265,-0.208876,4.59343>,<2.08445,-0.154057,4.44271>,r}
+	sphere{<2.08445,-0.154057,4.44271>,r}
+	cylinder{<2.08445,-0.154057,4.44271>,<2.7017,0.0723714,3.82035>,r}
+	sphere{<2.7017,0.0723714,3.82035>,r}
+	cylinder{<2.7017,0.0723714,3.82035>,<3,0.0726016,3.8198>,r}
+	sphere{<3,0.0726016,3.8198>,r}
+	texture{t2}
+}
+union{
+	triangle{<3,-0.837419,4.72969>,<3,-1.24577,4.20017>,<2.18173,-1.24573,4.2001>}
+	triangle{<3,-0.837419,4.72969>,<2.18173,-1.24573,4.2001>,<1.91799,-1.06566,4.43356>}
+	triangle{<3,-0.837419,4.72969>,<1.91799,-1.06566,4.43356>,<2.07269,-0.837408,4.72956>}
+	texture{t1}
+}
+union{
+	cylinder{<3,-0.837419,4.72969>,<3,-1.24577,4.20017>,r}
+	sphere{<3,-1.24577,4.20017>,r}
+	cylinder{<3,-1.24577,4.20017>,<2.18173,-1.24573,4.2001>,r}
+	sphere{<2.18173,-1.24573,4.2001>,r}
+	cylinder{<2.18173,-1.24573,4.2001>,<1.91799,-1.06566,4.43356>,r}
+	sphere{<1.91799,-1.06566,4.43356>,r}
+	cylinder{<1.91799,-1.06566,4.43356>,<2.07269,-0.837408,4.72956>,r}
+	sphere{<2.07269,-0.837408,4.72956>,r}
+	cylinder{<2.07269,-0.837408,4.72956>,<3,-0.837419,4.72969>,r}
+	sphere{<3,-0.837419,4.72969>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.14464,0.228822,3.65798>,<-1.96984,0.588261,3.83254>,<-1.87348,0.566068,3.92295>}
+	triangle{<-2.14464,0.228822,3.65798>,<-1.87348,0.566068,3.92295>,<-1.87125,0.562152,3.92495>}
+	triangle{<-2.14464,0.228822,3.65798>,<-1.87125,0.562152,3.92495>,<-2.03052,0.0747705,3.76167>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.14464,0.228822,3.65798>,<-1.96984,0.588261,3.83254>,r}
+	sphere{<-1.96984,0.588261,3.83254>,r}
+	cylinder{<-1.96984,0.588261,3.83254>,<-1.87348,0.566068,3.92295>,r}
+	sphere{<-1.87348,0.566068,3.92295>,r}
+	cylinder{<-1.87348,0.566068,3.92295>,<-1.87125,0.562152,3.92495>,r}
+	sphere{<-1.87125,0.562152,3.92495>,r}
+	cylinder{<-1.87125,0.562152,3.92495>,<-2.03052,0.0747705,3.76167>,r}
+	sphere{<-2.03052,0.0747705,3.76167>,r}
+	cylinder{<-2.03052,0.0747705,3.76167>,<-2.14464,0.228822,3.65798>,r}
+	sphere{<-2.14464,0.228822,3.65798>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.85169,-0.227303,3.64931>,<-1.30074,-0.0568596,3.68651>,<-1.04712,-0.0942936,3.19199>}
+	triangle{<-1.85169,-0.227303,3.64931>,<-1.04712,-0.0942936,3.19199>,<-1.59021,-0.308745,2.9503>}
+	triangle{<-1.85169,-0.227303,3.64931>,<-1.59021,-0.308745,2.9503>,<-1.85025,-0.330827,3.19041>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.85169,-0.227303,3.64931>,<-1.30074,-0.0568596,3.68651>,r}
+	sphere{<-1.30074,-0.0568596,3.68651>,r}
+	cylinder{<-1.30074,-0.0568596,3.68651>,<-1.04712,-0.0942936,3.19199>,r}
+	sphere{<-1.04712,-0.0942936,3.19199>,r}
+	cylinder{<-1.04712,-0.0942936,3.19199>,<-1.59021,-0.308745,2.9503>,r}
+	sphere{<-1.59021,-0.308745,2.9503>,r}
+	cylinder{<-1.59021,-0.308745,2.9503>,<-1.85025,-0.330827,3.19041>,r}
+	sphere{<-1.85025,-0.330827,3.19041>,r}
+	cylinder{<-1.85025,-0.330827,3.19041>,<-1.85169,-0.227303,3.64931>,r}
+	sphere{<-1.85169,-0.227303,3.64931>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.30272,0.502848,3.88146>,<-1.05671,0.741025,3.49553>,<-0.953958,0.103815,3.0827>}
+	triangle{<-1.30272,0.502848,3.88146>,<-0.953958,0.103815,3.0827>,<-1.04712,-0.0942936,3.19199>}
+	triangle{<-1.30272,0.502848,3.88146>,<-1.04712,-0.0942936,3.19199>,<-1.30074,-0.0568596,3.68651>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.30272,0.502848,3.88146>,<-1.05671,0.741025,3.49553>,r}
+	sphere{<-1.05671,0.741025,3.49553>,r}
+	cylinder{<-1.05671,0.741025,3.49553>,<-0.953958,0.103815,3.0827>,r}
+	sphere{<-0.953958,0.103815,3.0827>,r}
+	cylinder{<-0.953958,0.103815,3.0827>,<-1.04712,-0.0942936,3.19199>,r}
+	sphere{<-1.04712,-0.0942936,3.19199>,r}
+	cylinder{<-1.04712,-0.0942936,3.19199>,<-1.30074,-0.0568596,3.68651>,r}
+	sphere{<-1.30074,-0.0568596,3.68651>,r}
+	cylinder{<-1.30074,-0.0568596,3.68651>,<-1.30272,0.502848,3.88146>,r}
+	sphere{<-1.30272,0.502848,3.88146>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.30272,0.502848,3.88146>,<-1.50553,0.628435,3.93333>,<-1.17671,0.896685,3.45893>}
+	triangle{<-1.30272,0.502848,3.88146>,<-1.17671,0.896685,3.45893>,<-1.16253,0.889196,3.45424>}
+	triangle{<-1.30272,0.502848,3.88146>,<-1.16253,0.889196,3.45424>,<-1.05671,0.741025,3.49553>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.30272,0.502848,3.88146>,<-1.50553,0.628435,3.93333>,r}
+	sphere{<-1.50553,0.628435,3.93333>,r}
+	cylinder{<-1.50553,0.628435,3.93333>,<-1.17671,0.896685,3.45893>,r}
+	sphere{<-1.17671,0.896685,3.45893>,r}
+	cylinder{<-1.17671,0.896685,3.45893>,<-1.16253,0.889196,3.45424>,r}
+	sphere{<-1.16253,0.889196,3.45424>,r}
+	cylinder{<-1.16253,0.889196,3.45424>,<-1.05671,0.741025,3.49553>,r}
+	sphere{<-1.05671,0.741025,3.49553>,r}
+	cylinder{<-1.05671,0.741025,3.49553>,<-1.30272,0.502848,3.88146>,r}
+	sphere{<-1.30272,0.502848,3.88146>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.70095,-0.169591,2.73013>,<-1.87433,-0.115095,2.73998>,<-2.01779,-0.136726,2.89295>}
+	triangle{<-1.70095,-0.169591,2.73013>,<-2.01779,-0.136726,2.89295>,<-1.85025,-0.330827,3.19041>}
+	triangle{<-1.70095,-0.169591,2.73013>,<-1.85025,-0.330827,3.19041>,<-1.59021,-0.308745,2.9503>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.70095,-0.169591,2.73013>,<-1.87433,-0.115095,2.73998>,r}
+	sphere{<-1.87433,-0.115095,2.73998>,r}
+	cylinder{<-1.87433,-0.115095,2.73998>,<-2.01779,-0.136726,2.89295>,r}
+	sphere{<-2.01779,-0.136726,2.89295>,r}
+	cylinder{<-2.01779,-0.136726,2.89295>,<-1.85025,-0.330827,3.19041>,r}
+	sphere{<-1.85025,-0.330827,3.19041>,r}
+	cylinder{<-1.85025,-0.330827,3.19041>,<-1.59021,-0.308745,2.9503>,r}
+	sphere{<-1.59021,-0.308745,2.9503>,r}
+	cylinder{<-1.59021,-0.308745,2.9503>,<-1.70095,-0.169591,2.73013>,r}
+	sphere{<-1.70095,-0.169591,2.73013>,r}
+	texture{t2}
+}
+union{
+	triangle{<-3,0.228824,3.6579>,<-3,0.998939,4.03188>,<-2.3967,0.99892,4.03192>}
+	triangle{<-3,0.228824,3.6579>,<-2.3967,0.99892,4.03192>,<-1.96984,0.588261,3.83254>}
+	triangle{<-3,0.228824,3.6579>,<-1.96984,0.588261,3.83254>,<-2.14464,0.228822,3.65798>}
+	texture{t1}
+}
+union{
+	cylinder{<-3,0.228824,3.6579>,<-3,0.998939,4.03188>,r}
+	sphere{<-3,0.998939,4.03188>,r}
+	cylinder{<-3,0.998939,4.03188>,<-2.3967,0.99892,4.03192>,r}
+	sphere{<-2.3967,0.99892,4.03192>,r}
+	cylinder{<-2.3967,0.99892,4.03192>,<-1.96984,0.588261,3.83254>,r}
+	sphere{<-1.96984,0.588261,3.83254>,r}
+	cylinder{<-1.96984,0.588261,3.83254>,<-2.14464,0.228822,3.65798>,r}
+	sphere{<-2.14464,0.228822,3.65798>,r}
+	cylinder{<-2.14464,0.228822,3.65798>,<-3,0.228824,3.6579>,r}
+	sphere{<-3,0.228824,3.6579>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.96984,0.588261,3.83254>,<-2.3967,0.99892,4.03192>,<-2.46673,1.3289,3.65576>}
+	triangle{<-1.96984,0.588261,3.83254>,<-2.46673,1.3289,3.65576>,<-2.09304,1.17721,3.15766>}
+	triangle{<-1.96984,0.588261,3.83254>,<-2.09304,1.17721,3.15766>,<-1.87915,0.888319,3.18717>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.96984,0.588261,3.83254>,<-2.3967,0.99892,4.03192>,r}
+	sphere{<-2.3967,0.99892,4.03192>,r}
+	cylinder{<-2.3967,0.99892,4.03192>,<-2.46673,1.3289,3.65576>,r}
+	sphere{<-2.46673,1.3289,3.65576>,r}
+	cylinder{<-2.46673,1.3289,3.65576>,<-2.09304,1.17721,3.15766>,r}
+	sphere{<-2.09304,1.17721,3.15766>,r}
+	cylinder{<-2.09304,1.17721,3.15766>,<-1.87915,0.888319,3.18717>,r}
+	sphere{<-1.87915,0.888319,3.18717>,r}
+	cylinder{<-1.87915,0.888319,3.18717>,<-1.96984,0.588261,3.83254>,r}
+	sphere{<-1.96984,0.588261,3.83254>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.21901,1.10239,2.91213>,<-2.09304,1.17721,3.15766>,<-2.46673,1.3289,3.65576>}
+	triangle{<-2.21901,1.10239,2.91213>,<-2.46673,1.3289,3.65576>,<-3,1.32883,3.65582>}
+	triangle{<-2.21901,1.10239,2.91213>,<-3,1.32883,3.65582>,<-3,1.10224,2.91208>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.21901,1.10239,2.91213>,<-2.09304,1.17721,3.15766>,r}
+	sphere{<-2.09304,1.17721,3.15766>,r}
+	cylinder{<-2.09304,1.17721,3.15766>,<-2.46673,1.3289,3.65576>,r}
+	sphere{<-2.46673,1.3289,3.65576>,r}
+	cylinder{<-2.46673,1.3289,3.65576>,<-3,1.32883,3.65582>,r}
+	sphere{<-3,1.32883,3.65582>,r}
+	cylinder{<-3,1.32883,3.65582>,<-3,1.10224,2.91208>,r}
+	sphere{<-3,1.10224,2.91208>,r}
+	cylinder{<-3,1.10224,2.91208>,<-2.21901,1.10239,2.91213>,r}
+	sphere{<-2.21901,1.10239,2.91213>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.88922,1.47328,4.33958>,<-1.81899,1.84906,4.12043>,<-1.45734,1.79174,4.13248>}
+	triangle{<-1.88922,1.47328,4.33958>,<-1.45734,1.79174,4.13248>,<-1.38087,1.57878,4.25>}
+	triangle{<-1.88922,1.47328,4.33958>,<-1.38087,1.57878,4.25>,<-1.46745,1.43947,4.33472>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.88922,1.47328,4.33958>,<-1.81899,1.84906,4.12043>,r}
+	sphere{<-1.81899,1.84906,4.12043>,r}
+	cylinder{<-1.81899,1.84906,4.12043>,<-1.45734,1.79174,4.13248>,r}
+	sphere{<-1.45734,1.79174,4.13248>,r}
+	cylinder{<-1.45734,1.79174,4.13248>,<-1.38087,1.57878,4.25>,r}
+	sphere{<-1.38087,1.57878,4.25>,r}
+	cylinder{<-1.38087,1.57878,4.25>,<-1.46745,1.43947,4.33472>,r}
+	sphere{<-1.46745,1.43947,4.33472>,r}
+	cylinder{<-1.46745,1.43947,4.33472>,<-1.88922,1.47328,4.33958>,r}
+	sphere{<-1.88922,1.47328,4.33958>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.87125,0.562152,3.92495>,<-2.03052,0.0747705,3.76167>,<-2.14103,-0.246293,3.97774>}
+	triangle{<-1.87125,0.562152,3.92495>,<-2.14103,-0.246293,3.97774>,<-2.13892,-0.216786,4.42422>}
+	triangle{<-1.87125,0.562152,3.92495>,<-2.13892,-0.216786,4.42422>,<-1.98287,0.261776,4.60447>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.87125,0.562152,3.92495>,<-2.03052,0.0747705,3.76167>,r}
+	sphere{<-2.03052,0.0747705,3.76167>,r}
+	cylinder{<-2.03052,0.0747705,3.76167>,<-2.14103,-0.246293,3.97774>,r}
+	sphere{<-2.14103,-0.246293,3.97774>,r}
+	cylinder{<-2.14103,-0.246293,3.97774>,<-2.13892,-0.216786,4.42422>,r}
+	sphere{<-2.13892,-0.216786,4.42422>,r}
+	cylinder{<-2.13892,-0.216786,4.42422>,<-1.98287,0.261776,4.60447>,r}
+	sphere{<-1.98287,0.261776,4.60447>,r}
+	cylinder{<-1.98287,0.261776,4.60447>,<-1.87125,0.562152,3.92495>,r}
+	sphere{<-1.87125,0.562152,3.92495>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.53052,1.00055,4.4616>,<-3,1.00057,4.46164>,<-3,0.998939,4.03188>}
+	triangle{<-2.53052,1.00055,4.4616>,<-3,0.998939,4.03188>,<-2.3967,0.99892,4.03192>}
+	triangle{<-2.53052,1.00055,4.4616>,<-2.3967,0.99892,4.03192>,<-2.34038,0.999216,4.11025>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.53052,1.00055,4.4616>,<-3,1.00057,4.46164>,r}
+	sphere{<-3,1.00057,4.46164>,r}
+	cylinder{<-3,1.00057,4.46164>,<-3,0.998939,4.03188>,r}
+	sphere{<-3,0.998939,4.03188>,r}
+	cylinder{<-3,0.998939,4.03188>,<-2.3967,0.99892,4.03192>,r}
+	sphere{<-2.3967,0.99892,4.03192>,r}
+	cylinder{<-2.3967,0.99892,4.03192>,<-2.34038,0.999216,4.11025>,r}
+	sphere{<-2.34038,0.999216,4.11025>,r}
+	cylinder{<-2.34038,0.999216,4.11025>,<-2.53052,1.00055,4.4616>,r}
+	sphere{<-2.53052,1.00055,4.4616>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.13892,-0.216786,4.42422>,<-3,-0.190437,4.82443>,<-3,0.415767,5.14146>}
+	triangle{<-2.13892,-0.216786,4.42422>,<-3,0.415767,5.14146>,<-2.43496,0.566177,4.96655>}
+	triangle{<-2.13892,-0.216786,4.42422>,<-2.43496,0.566177,4.96655>,<-1.98287,0.261776,4.60447>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.13892,-0.216786,4.42422>,<-3,-0.190437,4.82443>,r}
+	sphere{<-3,-0.190437,4.82443>,r}
+	cylinder{<-3,-0.190437,4.82443>,<-3,0.415767,5.14146>,r}
+	sphere{<-3,0.415767,5.14146>,r}
+	cylinder{<-3,0.415767,5.14146>,<-2.43496,0.566177,4.96655>,r}
+	sphere{<-2.43496,0.566177,4.96655>,r}
+	cylinder{<-2.43496,0.566177,4.96655>,<-1.98287,0.261776,4.60447>,r}
+	sphere{<-1.98287,0.261776,4.60447>,r}
+	cylinder{<-1.98287,0.261776,4.60447>,<-2.13892,-0.216786,4.42422>,r}
+	sphere{<-2.13892,-0.216786,4.42422>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.912189,0.160091,4.38771>,<-0.98499,-0.419241,4.06565>,<-1.30074,-0.0568596,3.68651>}
+	triangle{<-0.912189,0.160091,4.38771>,<-1.30074,-0.0568596,3.68651>,<-1.30272,0.502848,3.88146>}
+	triangle{<-0.912189,0.160091,4.38771>,<-1.30272,0.502848,3.88146>,<-0.985881,0.356372,4.33876>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.912189,0.160091,4.38771>,<-0.98499,-0.419241,4.06565>,r}
+	sphere{<-0.98499,-0.419241,4.06565>,r}
+	cylinder{<-0.98499,-0.419241,4.06565>,<-1.30074,-0.0568596,3.68651>,r}
+	sphere{<-1.30074,-0.0568596,3.68651>,r}
+	cylinder{<-1.30074,-0.0568596,3.68651>,<-1.30272,0.502848,3.88146>,r}
+	sphere{<-1.30272,0.502848,3.88146>,r}
+	cylinder{<-1.30272,0.502848,3.88146>,<-0.985881,0.356372,4.33876>,r}
+	sphere{<-0.985881,0.356372,4.33876>,r}
+	cylinder{<-0.985881,0.356372,4.33876>,<-0.912189,0.160091,4.38771>,r}
+	sphere{<-0.912189,0.160091,4.38771>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.34972,1.39141,4.54228>,<-1.16699,0.874638,4.71464>,<-1.25603,0.525431,4.42703>}
+	triangle{<-1.34972,1.39141,4.54228>,<-1.25603,0.525431,4.42703>,<-1.51901,0.639448,3.96565>}
+	triangle{<-1.34972,1.39141,4.54228>,<-1.51901,0.639448,3.96565>,<-1.46745,1.43947,4.33472>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.34972,1.39141,4.54228>,<-1.16699,0.874638,4.71464>,r}
+	sphere{<-1.16699,0.874638,4.71464>,r}
+	cylinder{<-1.16699,0.874638,4.71464>,<-1.25603,0.525431,4.42703>,r}
+	sphere{<-1.25603,0.525431,4.42703>,r}
+	cylinder{<-1.25603,0.525431,4.42703>,<-1.51901,0.639448,3.96565>,r}
+	sphere{<-1.51901,0.639448,3.96565>,r}
+	cylinder{<-1.51901,0.639448,3.96565>,<-1.46745,1.43947,4.33472>,r}
+	sphere{<-1.46745,1.43947,4.33472>,r}
+	cylinder{<-1.46745,1.43947,4.33472>,<-1.34972,1.39141,4.54228>,r}
+	sphere{<-1.34972,1.39141,4.54228>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.354914,0.711217,3.88805>,<-0.664265,0.823417,3.50643>,<-0.66351,0.918845,3.48501>}
+	triangle{<-0.354914,0.711217,3.88805>,<-0.66351,0.918845,3.48501>,<-0.457568,1.17624,3.66151>}
+	triangle{<-0.354914,0.711217,3.88805>,<-0.457568,1.17624,3.66151>,<-0.179314,0.991529,4.02433>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.354914,0.711217,3.88805>,<-0.664265,0.823417,3.50643>,r}
+	sphere{<-0.664265,0.823417,3.50643>,r}
+	cylinder{<-0.664265,0.823417,3.50643>,<-0.66351,0.918845,3.48501>,r}
+	sphere{<-0.66351,0.918845,3.48501>,r}
+	cylinder{<-0.66351,0.918845,3.48501>,<-0.457568,1.17624,3.66151>,r}
+	sphere{<-0.457568,1.17624,3.66151>,r}
+	cylinder{<-0.457568,1.17624,3.66151>,<-0.179314,0.991529,4.02433>,r}
+	sphere{<-0.179314,0.991529,4.02433>,r}
+	cylinder{<-0.179314,0.991529,4.02433>,<-0.354914,0.711217,3.88805>,r}
+	sphere{<-0.354914,0.711217,3.88805>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.792646,0.90419,3.55045>,<0.58713,0.961652,3.84818>,<0.428154,1.1482,3.84195>}
+	triangle{<0.792646,0.90419,3.55045>,<0.428154,1.1482,3.84195>,<0.435901,1.35946,3.47542>}
+	triangle{<0.792646,0.90419,3.55045>,<0.435901,1.35946,3.47542>,<0.79104,0.926663,3.51611>}
+	texture{t1}
+}
+union{
+	cylinder{<0.792646,0.90419,3.55045>,<0.58713,0.961652,3.84818>,r}
+	sphere{<0.58713,0.961652,3.84818>,r}
+	cylinder{<0.58713,0.961652,3.84818>,<0.428154,1.1482,3.84195>,r}
+	sphere{<0.428154,1.1482,3.84195>,r}
+	cylinder{<0.428154,1.1482,3.84195>,<0.435901,1.35946,3.47542>,r}
+	sphere{<0.435901,1.35946,3.47542>,r}
+	cylinder{<0.435901,1.35946,3.47542>,<0.79104,0.926663,3.51611>,r}
+	sphere{<0.79104,0.926663,3.51611>,r}
+	cylinder{<0.79104,0.926663,3.51611>,<0.792646,0.90419,3.55045>,r}
+	sphere{<0.792646,0.90419,3.55045>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.792646,0.90419,3.55045>,<0.784999,0.760697,3.54842>,<0.64463,0.687293,3.74163>}
+	triangle{<0.792646,0.90419,3.55045>,<0.64463,0.687293,3.74163>,<0.564916,0.901911,3.87443>}
+	triangle{<0.792646,0.90419,3.55045>,<0.564916,0.901911,3.87443>,<0.58713,0.961652,3.84818>}
+	texture{t1}
+}
+union{
+	cylinder{<0.792646,0.90419,3.55045>,<0.784999,0.760697,3.54842>,r}
+	sphere{<0.784999,0.760697,3.54842>,r}
+	cylinder{<0.784999,0.760697,3.54842>,<0.64463,0.687293,3.74163>,r}
+	sphere{<0.64463,0.687293,3.74163>,r}
+	cylinder{<0.64463,0.687293,3.74163>,<0.564916,0.901911,3.87443>,r}
+	sphere{<0.564916,0.901911,3.87443>,r}
+	cylinder{<0.564916,0.901911,3.87443>,<0.58713,0.961652,3.84818>,r}
+	sphere{<0.58713,0.961652,3.84818>,r}
+	cylinder{<0.58713,0.961652,3.84818>,<0.792646,0.90419,3.55045>,r}
+	sphere{<0.792646,0.90419,3.55045>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.792646,0.90419,3.55045>,<0.79104,0.926663,3.51611>,<0.763151,0.761353,3.27801>}
+	triangle{<0.792646,0.90419,3.55045>,<0.763151,0.761353,3.27801>,<0.764802,0.669065,3.35788>}
+	triangle{<0.792646,0.90419,3.55045>,<0.764802,0.669065,3.35788>,<0.784999,0.760697,3.54842>}
+	texture{t1}
+}
+union{
+	cylinder{<0.792646,0.90419,3.55045>,<0.79104,0.926663,3.51611>,r}
+	sphere{<0.79104,0.926663,3.51611>,r}
+	cylinder{<0.79104,0.926663,3.51611>,<0.763151,0.761353,3.27801>,r}
+	sphere{<0.763151,0.761353,3.27801>,r}
+	cylinder{<0.763151,0.761353,3.27801>,<0.764802,0.669065,3.35788>,r}
+	sphere{<0.764802,0.669065,3.35788>,r}
+	cylinder{<0.764802,0.669065,3.35788>,<0.784999,0.760697,3.54842>,r}
+	sphere{<0.784999,0.760697,3.54842>,r}
+	cylinder{<0.784999,0.760697,3.54842>,<0.792646,0.90419,3.55045>,r}
+	sphere{<0.792646,0.90419,3.55045>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.764802,0.669065,3.35788>,<0.383541,0.243885,3.27456>,<0.235412,0.176286,3.50502>}
+	triangle{<0.764802,0.669065,3.35788>,<0.235412,0.176286,3.50502>,<0.64463,0.687293,3.74163>}
+	triangle{<0.764802,0.669065,3.35788>,<0.64463,0.687293,3.74163>,<0.784999,0.760697,3.54842>}
+	texture{t1}
+}
+union{
+	cylinder{<0.764802,0.669065,3.35788>,<0.383541,0.243885,3.27456>,r}
+	sphere{<0.383541,0.243885,3.27456>,r}
+	cylinder{<0.383541,0.243885,3.27456>,<0.235412,0.176286,3.50502>,r}
+	sphere{<0.235412,0.176286,3.50502>,r}
+	cylinder{<0.235412,0.176286,3.50502>,<0.64463,0.687293,3.74163>,r}
+	sphere{<0.64463,0.687293,3.74163>,r}
+	cylinder{<0.64463,0.687293,3.74163>,<0.784999,0.760697,3.54842>,r}
+	sphere{<0.784999,0.760697,3.54842>,r}
+	cylinder{<0.784999,0.760697,3.54842>,<0.764802,0.669065,3.35788>,r}
+	sphere{<0.764802,0.669065,3.35788>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.784999,0.760697,3.54842>,<1.37249,0.393,3.69442>,<1.45262,0.151105,3.3732>}
+	triangle{<0.784999,0.760697,3.54842>,<1.45262,0.151105,3.3732>,<1.21437,0.194889,3.12658>}
+	triangle{<0.784999,0.760697,3.54842>,<1.21437,0.194889,3.12658>,<0.764802,0.669065,3.35788>}
+	texture{t1}
+}
+union{
+	cylinder{<0.784999,0.760697,3.54842>,<1.37249,0.393,3.69442>,r}
+	sphere{<1.37249,0.393,3.69442>,r}
+	cylinder{<1.37249,0.393,3.69442>,<1.45262,0.151105,3.3732>,r}
+	sphere{<1.45262,0.151105,3.3732>,r}
+	cylinder{<1.45262,0.151105,3.3732>,<1.21437,0.194889,3.12658>,r}
+	sphere{<1.21437,0.194889,3.12658>,r}
+	cylinder{<1.21437,0.194889,3.12658>,<0.764802,0.669065,3.35788>,r}
+	sphere{<0.764802,0.669065,3.35788>,r}
+	cylinder{<0.764802,0.669065,3.35788>,<0.784999,0.760697,3.54842>,r}
+	sphere{<0.784999,0.760697,3.54842>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.784999,0.760697,3.54842>,<0.792646,0.90419,3.55045>,<1.51434,1.22037,3.73049>}
+	triangle{<0.784999,0.760697,3.54842>,<1.51434,1.22037,3.73049>,<1.71027,0.662039,3.77879>}
+	triangle{<0.784999,0.760697,3.54842>,<1.71027,0.662039,3.77879>,<1.37249,0.393,3.69442>}
+	texture{t1}
+}
+union{
+	cylinder{<0.784999,0.760697,3.54842>,<0.792646,0.90419,3.55045>,r}
+	sphere{<0.792646,0.90419,3.55045>,r}
+	cylinder{<0.792646,0.90419,3.55045>,<1.51434,1.22037,3.73049>,r}
+	sphere{<1.51434,1.22037,3.73049>,r}
+	cylinder{<1.51434,1.22037,3.73049>,<1.71027,0.662039,3.77879>,r}
+	sphere{<1.71027,0.662039,3.77879>,r}
+	cylinder{<1.71027,0.662039,3.77879>,<1.37249,0.393,3.69442>,r}
+	sphere{<1.37249,0.393,3.69442>,r}
+	cylinder{<1.37249,0.393,3.69442>,<0.784999,0.760697,3.54842>,r}
+	sphere{<0.784999,0.760697,3.54842>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.51434,1.22037,3.73049>,<0.792646,0.90419,3.55045>,<0.79104,0.926663,3.51611>}
+	triangle{<1.51434,1.22037,3.73049>,<0.79104,0.926663,3.51611>,<1.34098,1.4483,3.2423>}
+	triangle{<1.51434,1.22037,3.73049>,<1.34098,1.4483,3.2423>,<1.62039,1.42027,3.53227>}
+	texture{t1}
+}
+union{
+	cylinder{<1.51434,1.22037,3.73049>,<0.792646,0.90419,3.55045>,r}
+	sphere{<0.792646,0.90419,3.55045>,r}
+	cylinder{<0.792646,0.90419,3.55045>,<0.79104,0.926663,3.51611>,r}
+	sphere{<0.79104,0.926663,3.51611>,r}
+	cylinder{<0.79104,0.926663,3.51611>,<1.34098,1.4483,3.2423>,r}
+	sphere{<1.34098,1.4483,3.2423>,r}
+	cylinder{<1.34098,1.4483,3.2423>,<1.62039,1.42027,3.53227>,r}
+	sphere{<1.62039,1.42027,3.53227>,r}
+	cylinder{<1.62039,1.42027,3.53227>,<1.51434,1.22037,3.73049>,r}
+	sphere{<1.51434,1.22037,3.73049>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.45262,0.151105,3.3732>,<1.37249,0.393,3.69442>,<1.71027,0.662039,3.77879>}
+	triangle{<1.45262,0.151105,3.3732>,<1.71027,0.662039,3.77879>,<2.03132,0.582433,3.4847>}
+	triangle{<1.45262,0.151105,3.3732>,<2.03132,0.582433,3.4847>,<1.87472,0.227472,3.18861>}
+	texture{t1}
+}
+union{
+	cylinder{<1.45262,0.151105,3.3732>,<1.37249,0.393,3.69442>,r}
+	sphere{<1.37249,0.393,3.69442>,r}
+	cylinder{<1.37249,0.393,3.69442>,<1.71027,0.662039,3.77879>,r}
+	sphere{<1.71027,0.662039,3.77879>,r}
+	cylinder{<1.71027,0.662039,3.77879>,<2.03132,0.582433,3.4847>,r}
+	sphere{<2.03132,0.582433,3.4847>,r}
+	cylinder{<2.03132,0.582433,3.4847>,<1.87472,0.227472,3.18861>,r}
+	sphere{<1.87472,0.227472,3.18861>,r}
+	cylinder{<1.87472,0.227472,3.18861>,<1.45262,0.151105,3.3732>,r}
+	sphere{<1.45262,0.151105,3.3732>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.82913,1.4015,3.32632>,<1.62039,1.42027,3.53227>,<1.34098,1.4483,3.2423>}
+	triangle{<1.82913,1.4015,3.32632>,<1.34098,1.4483,3.2423>,<1.39115,1.44414,3.12341>}
+	triangle{<1.82913,1.4015,3.32632>,<1.39115,1.44414,3.12341>,<1.8037,1.40462,3.18901>}
+	texture{t1}
+}
+union{
+	cylinder{<1.82913,1.4015,3.32632>,<1.62039,1.42027,3.53227>,r}
+	sphere{<1.62039,1.42027,3.53227>,r}
+	cylinder{<1.62039,1.42027,3.53227>,<1.34098,1.4483,3.2423>,r}
+	sphere{<1.34098,1.4483,3.2423>,r}
+	cylinder{<1.34098,1.4483,3.2423>,<1.39115,1.44414,3.12341>,r}
+	sphere{<1.39115,1.44414,3.12341>,r}
+	cylinder{<1.39115,1.44414,3.12341>,<1.8037,1.40462,3.18901>,r}
+	sphere{<1.8037,1.40462,3.18901>,r}
+	cylinder{<1.8037,1.40462,3.18901>,<1.82913,1.4015,3.32632>,r}
+	sphere{<1.82913,1.4015,3.32632>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.564916,0.901911,3.87443>,<0.688855,0.585369,4.52993>,<0.827094,0.217453,4.51437>}
+	triangle{<0.564916,0.901911,3.87443>,<0.827094,0.217453,4.51437>,<0.855745,0.138657,4.38324>}
+	triangle{<0.564916,0.901911,3.87443>,<0.855745,0.138657,4.38324>,<0.64463,0.687293,3.74163>}
+	texture{t1}
+}
+union{
+	cylinder{<0.564916,0.901911,3.87443>,<0.688855,0.585369,4.52993>,r}
+	sphere{<0.688855,0.585369,4.52993>,r}
+	cylinder{<0.688855,0.585369,4.52993>,<0.827094,0.217453,4.51437>,r}
+	sphere{<0.827094,0.217453,4.51437>,r}
+	cylinder{<0.827094,0.217453,4.51437>,<0.855745,0.138657,4.38324>,r}
+	sphere{<0.855745,0.138657,4.38324>,r}
+	cylinder{<0.855745,0.138657,4.38324>,<0.64463,0.687293,3.74163>,r}
+	sphere{<0.64463,0.687293,3.74163>,r}
+	cylinder{<0.64463,0.687293,3.74163>,<0.564916,0.901911,3.87443>,r}
+	sphere{<0.564916,0.901911,3.87443>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.90271,0.578303,4.27799>,<1.90472,0.895724,4.59268>,<1.54835,1.31319,3.92333>}
+	triangle{<1.90271,0.578303,4.27799>,<1.54835,1.31319,3.92333>,<1.51434,1.22037,3.73049>}
+	triangle{<1.90271,0.578303,4.27799>,<1.51434,1.22037,3.73049>,<1.71027,0.662039,3.77879>}
+	texture{t1}
+}
+union{
+	cylinder{<1.90271,0.578303,4.27799>,<1.90472,0.895724,4.59268>,r}
+	sphere{<1.90472,0.895724,4.59268>,r}
+	cylinder{<1.90472,0.895724,4.59268>,<1.54835,1.31319,3.92333>,r}
+	sphere{<1.54835,1.31319,3.92333>,r}
+	cylinder{<1.54835,1.31319,3.92333>,<1.51434,1.22037,3.73049>,r}
+	sphere{<1.51434,1.22037,3.73049>,r}
+	cylinder{<1.51434,1.22037,3.73049>,<1.71027,0.662039,3.77879>,r}
+	sphere{<1.71027,0.662039,3.77879>,r}
+	cylinder{<1.71027,0.662039,3.77879>,<1.90271,0.578303,4.27799>,r}
+	sphere{<1.90271,0.578303,4.27799>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.936083,0.819302,4.76962>,<1.12517,1.24694,4.64602>,<1.89902,0.892433,4.60889>}
+	triangle{<0.936083,0.819302,4.76962>,<1.89902,0.892433,4.60889>,<1.71027,0.391698,4.74873>}
+	triangle{<0.936083,0.819302,4.76962>,<1.71027,0.391698,4.74873>,<1.22669,0.354611,4.82952>}
+	texture{t1}
+}
+union{
+	cylinder{<0.936083,0.819302,4.76962>,<1.12517,1.24694,4.64602>,r}
+	sphere{<1.12517,1.24694,4.64602>,r}
+	cylinder{<1.12517,1.24694,4.64602>,<1.89902,0.892433,4.60889>,r}
+	sphere{<1.89902,0.892433,4.60889>,r}
+	cylinder{<1.89902,0.892433,4.60889>,<1.71027,0.391698,4.74873>,r}
+	sphere{<1.71027,0.391698,4.74873>,r}
+	cylinder{<1.71027,0.391698,4.74873>,<1.22669,0.354611,4.82952>,r}
+	sphere{<1.22669,0.354611,4.82952>,r}
+	cylinder{<1.22669,0.354611,4.82952>,<0.936083,0.819302,4.76962>,r}
+	sphere{<0.936083,0.819302,4.76962>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.90472,0.895724,4.59268>,<1.89902,0.892433,4.60889>,<1.12517,1.24694,4.64602>}
+	triangle{<1.90472,0.895724,4.59268>,<1.12517,1.24694,4.64602>,<1.07693,1.35951,4.40402>}
+	triangle{<1.90472,0.895724,4.59268>,<1.07693,1.35951,4.40402>,<1.54835,1.31319,3.92333>}
+	texture{t1}
+}
+union{
+	cylinder{<1.90472,0.895724,4.59268>,<1.89902,0.892433,4.60889>,r}
+	sphere{<1.89902,0.892433,4.60889>,r}
+	cylinder{<1.89902,0.892433,4.60889>,<1.12517,1.24694,4.64602>,r}
+	sphere{<1.12517,1.24694,4.64602>,r}
+	cylinder{<1.12517,1.24694,4.64602>,<1.07693,1.35951,4.40402>,r}
+	sphere{<1.07693,1.35951,4.40402>,r}
+	cylinder{<1.07693,1.35951,4.40402>,<1.54835,1.31319,3.92333>,r}
+	sphere{<1.54835,1.31319,3.92333>,r}
+	cylinder{<1.54835,1.31319,3.92333>,<1.90472,0.895724,4.59268>,r}
+	sphere{<1.90472,0.895724,4.59268>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.054503,-0.251235,4.32844>,<-0.00291725,0.100865,4.86991>,<0.827094,0.217453,4.51437>}
+	triangle{<0.054503,-0.251235,4.32844>,<0.827094,0.217453,4.51437>,<0.855745,0.138657,4.38324>}
+	triangle{<0.054503,-0.251235,4.32844>,<0.855745,0.138657,4.38324>,<0.516319,-0.189665,4.12588>}
+	texture{t1}
+}
+union{
+	cylinder{<0.054503,-0.251235,4.32844>,<-0.00291725,0.100865,4.86991>,r}
+	sphere{<-0.00291725,0.100865,4.86991>,r}
+	cylinder{<-0.00291725,0.100865,4.86991>,<0.827094,0.217453,4.51437>,r}
+	sphere{<0.827094,0.217453,4.51437>,r}
+	cylinder{<0.827094,0.217453,4.51437>,<0.855745,0.138657,4.38324>,r}
+	sphere{<0.855745,0.138657,4.38324>,r}
+	cylinder{<0.855745,0.138657,4.38324>,<0.516319,-0.189665,4.12588>,r}
+	sphere{<0.516319,-0.189665,4.12588>,r}
+	cylinder{<0.516319,-0.189665,4.12588>,<0.054503,-0.251235,4.32844>,r}
+	sphere{<0.054503,-0.251235,4.32844>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.272193,0.353487,4.87216>,<-0.369772,0.734323,4.73462>,<-0.305498,0.833881,4.72874>}
+	triangle{<-0.272193,0.353487,4.87216>,<-0.305498,0.833881,4.72874>,<-0.0858316,0.716035,4.83477>}
+	triangle{<-0.272193,0.353487,4.87216>,<-0.0858316,0.716035,4.83477>,<-0.178016,0.292254,4.92057>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.272193,0.353487,4.87216>,<-0.369772,0.734323,4.73462>,r}
+	sphere{<-0.369772,0.734323,4.73462>,r}
+	cylinder{<-0.369772,0.734323,4.73462>,<-0.305498,0.833881,4.72874>,r}
+	sphere{<-0.305498,0.833881,4.72874>,r}
+	cylinder{<-0.305498,0.833881,4.72874>,<-0.0858316,0.716035,4.83477>,r}
+	sphere{<-0.0858316,0.716035,4.83477>,r}
+	cylinder{<-0.0858316,0.716035,4.83477>,<-0.178016,0.292254,4.92057>,r}
+	sphere{<-0.178016,0.292254,4.92057>,r}
+	cylinder{<-0.178016,0.292254,4.92057>,<-0.272193,0.353487,4.87216>,r}
+	sphere{<-0.272193,0.353487,4.87216>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.827094,0.217453,4.51437>,<-0.00291725,0.100865,4.86991>,<-0.178016,0.292254,4.92057>}
+	triangle{<0.827094,0.217453,4.51437>,<-0.178016,0.292254,4.92057>,<-0.0858316,0.716035,4.83477>}
+	triangle{<0.827094,0.217453,4.51437>,<-0.0858316,0.716035,4.83477>,<0.688855,0.585369,4.52993>}
+	texture{t1}
+}
+union{
+	cylinder{<0.827094,0.217453,4.51437>,<-0.00291725,0.100865,4.86991>,r}
+	sphere{<-0.00291725,0.100865,4.86991>,r}
+	cylinder{<-0.00291725,0.100865,4.86991>,<-0.178016,0.292254,4.92057>,r}
+	sphere{<-0.178016,0.292254,4.92057>,r}
+	cylinder{<-0.178016,0.292254,4.92057>,<-0.0858316,0.716035,4.83477>,r}
+	sphere{<-0.0858316,0.716035,4.83477>,r}
+	cylinder{<-0.0858316,0.716035,4.83477>,<0.688855,0.585369,4.52993>,r}
+	sphere{<0.688855,0.585369,4.52993>,r}
+	cylinder{<0.688855,0.585369,4.52993>,<0.827094,0.217453,4.51437>,r}
+	sphere{<0.827094,0.217453,4.51437>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.8037,1.40462,3.18901>,<1.82913,1.4015,3.32632>,<2.13559,0.959378,3.20919>}
+	triangle{<1.8037,1.40462,3.18901>,<2.13559,0.959378,3.20919>,<2.08836,0.937582,2.83329>}
+	triangle{<1.8037,1.40462,3.18901>,<2.08836,0.937582,2.83329>,<2.08748,0.938608,2.83252>}
+	texture{t1}
+}
+union{
+	cylinder{<1.8037,1.40462,3.18901>,<1.82913,1.4015,3.32632>,r}
+	sphere{<1.82913,1.4015,3.32632>,r}
+	cylinder{<1.82913,1.4015,3.32632>,<2.13559,0.959378,3.20919>,r}
+	sphere{<2.13559,0.959378,3.20919>,r}
+	cylinder{<2.13559,0.959378,3.20919>,<2.08836,0.937582,2.83329>,r}
+	sphere{<2.08836,0.937582,2.83329>,r}
+	cylinder{<2.08836,0.937582,2.83329>,<2.08748,0.938608,2.83252>,r}
+	sphere{<2.08748,0.938608,2.83252>,r}
+	cylinder{<2.08748,0.938608,2.83252>,<1.8037,1.40462,3.18901>,r}
+	sphere{<1.8037,1.40462,3.18901>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.8037,1.40462,3.18901>,<2.08965,1.97179,2.68372>,<2.24475,2.02295,3.28241>}
+	triangle{<1.8037,1.40462,3.18901>,<2.24475,2.02295,3.28241>,<2.04327,1.65162,3.54209>}
+	triangle{<1.8037,1.40462,3.18901>,<2.04327,1.65162,3.54209>,<1.82913,1.4015,3.32632>}
+	texture{t1}
+}
+union{
+	cylinder{<1.8037,1.40462,3.18901>,<2.08965,1.97179,2.68372>,r}
+	sphere{<2.08965,1.97179,2.68372>,r}
+	cylinder{<2.08965,1.97179,2.68372>,<2.24475,2.02295,3.28241>,r}
+	sphere{<2.24475,2.02295,3.28241>,r}
+	cylinder{<2.24475,2.02295,3.28241>,<2.04327,1.65162,3.54209>,r}
+	sphere{<2.04327,1.65162,3.54209>,r}
+	cylinder{<2.04327,1.65162,3.54209>,<1.82913,1.4015,3.32632>,r}
+	sphere{<1.82913,1.4015,3.32632>,r}
+	cylinder{<1.82913,1.4015,3.32632>,<1.8037,1.40462,3.18901>,r}
+	sphere{<1.8037,1.40462,3.18901>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.8037,1.40462,3.18901>,<2.08748,0.938608,2.83252>,<2.29107,1.44043,2.45895>}
+	triangle{<1.8037,1.40462,3.18901>,<2.29107,1.44043,2.45895>,<2.09352,1.97131,2.67801>}
+	triangle{<1.8037,1.40462,3.18901>,<2.09352,1.97131,2.67801>,<2.08965,1.97179,2.68372>}
+	texture{t1}
+}
+union{
+	cylinder{<1.8037,1.40462,3.18901>,<2.08748,0.938608,2.83252>,r}
+	sphere{<2.08748,0.938608,2.83252>,r}
+	cylinder{<2.08748,0.938608,2.83252>,<2.29107,1.44043,2.45895>,r}
+	sphere{<2.29107,1.44043,2.45895>,r}
+	cylinder{<2.29107,1.44043,2.45895>,<2.09352,1.97131,2.67801>,r}
+	sphere{<2.09352,1.97131,2.67801>,r}
+	cylinder{<2.09352,1.97131,2.67801>,<2.08965,1.97179,2.68372>,r}
+	sphere{<2.08965,1.97179,2.68372>,r}
+	cylinder{<2.08965,1.97179,2.68372>,<1.8037,1.40462,3.18901>,r}
+	sphere{<1.8037,1.40462,3.18901>,r}
+	texture{t2}
+}
+union{
+	triangle{<3,1.9712,2.67802>,<3,2.02287,3.28252>,<2.24475,2.02295,3.28241>}
+	triangle{<3,1.9712,2.67802>,<2.24475,2.02295,3.28241>,<2.08965,1.97179,2.68372>}
+	triangle{<3,1.9712,2.67802>,<2.08965,1.97179,2.68372>,<2.09352,1.97131,2.67801>}
+	texture{t1}
+}
+union{
+	cylinder{<3,1.9712,2.67802>,<3,2.02287,3.28252>,r}
+	sphere{<3,2.02287,3.28252>,r}
+	cylinder{<3,2.02287,3.28252>,<2.24475,2.02295,3.28241>,r}
+	sphere{<2.24475,2.02295,3.28241>,r}
+	cylinder{<2.24475,2.02295,3.28241>,<2.08965,1.97179,2.68372>,r}
+	sphere{<2.08965,1.97179,2.68372>,r}
+	cylinder{<2.08965,1.97179,2.68372>,<2.09352,1.97131,2.67801>,r}
+	sphere{<2.09352,1.97131,2.67801>,r}
+	cylinder{<2.09352,1.97131,2.67801>,<3,1.9712,2.67802>,r}
+	sphere{<3,1.9712,2.67802>,r}
+	texture{t2}
+}
+union{
+	triangle{<3,0.977247,3.55223>,<2.13559,0.959378,3.20919>,<1.82913,1.4015,3.32632>}
+	triangle{<3,0.977247,3.55223>,<1.82913,1.4015,3.32632>,<2.04327,1.65162,3.54209>}
+	triangle{<3,0.977247,3.55223>,<2.04327,1.65162,3.54209>,<3,1.35197,3.75172>}
+	texture{t1}
+}
+union{
+	cylinder{<3,0.977247,3.55223>,<2.13559,0.959378,3.20919>,r}
+	sphere{<2.13559,0.959378,3.20919>,r}
+	cylinder{<2.13559,0.959378,3.20919>,<1.82913,1.4015,3.32632>,r}
+	sphere{<1.82913,1.4015,3.32632>,r}
+	cylinder{<1.82913,1.4015,3.32632>,<2.04327,1.65162,3.54209>,r}
+	sphere{<2.04327,1.65162,3.54209>,r}
+	cylinder{<2.04327,1.65162,3.54209>,<3,1.35197,3.75172>,r}
+	sphere{<3,1.35197,3.75172>,r}
+	cylinder{<3,1.35197,3.75172>,<3,0.977247,3.55223>,r}
+	sphere{<3,0.977247,3.55223>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.13559,0.959378,3.20919>,<3,0.977247,3.55223>,<3,0.653598,3.82588>}
+	triangle{<2.13559,0.959378,3.20919>,<3,0.653598,3.82588>,<2.5188,0.419638,3.82432>}
+	triangle{<2.13559,0.959378,3.20919>,<2.5188,0.419638,3.82432>,<2.03132,0.582433,3.4847>}
+	texture{t1}
+}
+union{
+	cylinder{<2.13559,0.959378,3.20919>,<3,0.977247,3.55223>,r}
+	sphere{<3,0.977247,3.55223>,r}
+	cylinder{<3,0.977247,3.55223>,<3,0.653598,3.82588>,r}
+	sphere{<3,0.653598,3.82588>,r}
+	cylinder{<3,0.653598,3.82588>,<2.5188,0.419638,3.82432>,r}
+	sphere{<2.5188,0.419638,3.82432>,r}
+	cylinder{<2.5188,0.419638,3.82432>,<2.03132,0.582433,3.4847>,r}
+	sphere{<2.03132,0.582433,3.4847>,r}
+	cylinder{<2.03132,0.582433,3.4847>,<2.13559,0.959378,3.20919>,r}
+	sphere{<2.13559,0.959378,3.20919>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.19299,-0.114066,2.82422>,<2.04408,0.113312,2.69076>,<1.86885,0.307473,2.8639>}
+	triangle{<2.19299,-0.114066,2.82422>,<1.86885,0.307473,2.8639>,<1.87472,0.227472,3.18861>}
+	triangle{<2.19299,-0.114066,2.82422>,<1.87472,0.227472,3.18861>,<2.12833,-0.121563,3.24393>}
+	texture{t1}
+}
+union{
+	cylinder{<2.19299,-0.114066,2.82422>,<2.04408,0.113312,2.69076>,r}
+	sphere{<2.04408,0.113312,2.69076>,r}
+	cylinder{<2.04408,0.113312,2.69076>,<1.86885,0.307473,2.8639>,r}
+	sphere{<1.86885,0.307473,2.8639>,r}
+	cylinder{<1.86885,0.307473,2.8639>,<1.87472,0.227472,3.18861>,r}
+	sphere{<1.87472,0.227472,3.18861>,r}
+	cylinder{<1.87472,0.227472,3.18861>,<2.12833,-0.121563,3.24393>,r}
+	sphere{<2.12833,-0.121563,3.24393>,r}
+	cylinder{<2.12833,-0.121563,3.24393>,<2.19299,-0.114066,2.82422>,r}
+	sphere{<2.19299,-0.114066,2.82422>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.89199,-0.492525,4.09978>,<1.39458,-0.362704,3.91677>,<1.30865,0.079253,4.17887>}
+	triangle{<1.89199,-0.492525,4.09978>,<1.30865,0.079253,4.17887>,<1.73397,0.277774,4.55204>}
+	triangle{<1.89199,-0.492525,4.09978>,<1.73397,0.277774,4.55204>,<2.08445,-0.154057,4.44271>}
+	texture{t1}
+}
+union{
+	cylinder{<1.89199,-0.492525,4.09978>,<1.39458,-0.362704,3.91677>,r}
+	sphere{<1.39458,-0.362704,3.91677>,r}
+	cylinder{<1.39458,-0.362704,3.91677>,<1.30865,0.079253,4.17887>,r}
+	sphere{<1.30865,0.079253,4.17887>,r}
+	cylinder{<1.30865,0.079253,4.17887>,<1.73397,0.277774,4.55204>,r}
+	sphere{<1.73397,0.277774,4.55204>,r}
+	cylinder{<1.73397,0.277774,4.55204>,<2.08445,-0.154057,4.44271>,r}
+	sphere{<2.08445,-0.154057,4.44271>,r}
+	cylinder{<2.08445,-0.154057,4.44271>,<1.89199,-0.492525,4.09978>,r}
+	sphere{<1.89199,-0.492525,4.09978>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.89199,-0.492525,4.09978>,<2.15413,-0.499402,3.62891>,<1.98392,-0.440217,3.43023>}
+	triangle{<1.89199,-0.492525,4.09978>,<1.98392,-0.440217,3.43023>,<1.45558,-0.339513,3.57865>}
+	triangle{<1.89199,-0.492525,4.09978>,<1.45558,-0.339513,3.57865>,<1.39458,-0.362704,3.91677>}
+	texture{t1}
+}
+union{
+	cylinder{<1.89199,-0.492525,4.09978>,<2.15413,-0.499402,3.62891>,r}
+	sphere{<2.15413,-0.499402,3.62891>,r}
+	cylinder{<2.15413,-0.499402,3.62891>,<1.98392,-0.440217,3.43023>,r}
+	sphere{<1.98392,-0.440217,3.43023>,r}
+	cylinder{<1.98392,-0.440217,3.43023>,<1.45558,-0.339513,3.57865>,r}
+	sphere{<1.45558,-0.339513,3.57865>,r}
+	cylinder{<1.45558,-0.339513,3.57865>,<1.39458,-0.362704,3.91677>,r}
+	sphere{<1.39458,-0.362704,3.91677>,r}
+	cylinder{<1.39458,-0.362704,3.91677>,<1.89199,-0.492525,4.09978>,r}
+	sphere{<1.89199,-0.492525,4.09978>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.89199,-0.492525,4.09978>,<2.08445,-0.154057,4.44271>,<2.7017,0.0723714,3.82035>}
+	triangle{<1.89199,-0.492525,4.09978>,<2.7017,0.0723714,3.82035>,<2.58285,-0.127081,3.62775>}
+	triangle{<1.89199,-0.492525,4.09978>,<2.58285,-0.127081,3.62775>,<2.15413,-0.499402,3.62891>}
+	texture{t1}
+}
+union{
+	cylinder{<1.89199,-0.492525,4.09978>,<2.08445,-0.154057,4.44271>,r}
+	sphere{<2.08445,-0.154057,4.44271>,r}
+	cylinder{<2.08445,-0.154057,4.44271>,<2.7017,0.0723714,3.82035>,r}
+	sphere{<2.7017,0.0723714,3.82035>,r}
+	cylinder{<2.7017,0.0723714,3.82035>,<2.58285,-0.127081,3.62775>,r}
+	sphere{<2.58285,-0.127081,3.62775>,r}
+	cylinder{<2.58285,-0.127081,3.62775>,<2.15413,-0.499402,3.62891>,r}
+	sphere{<2.15413,-0.499402,3.62891>,r}
+	cylinder{<2.15413,-0.499402,3.62891>,<1.89199,-0.492525,4.09978>,r}
+	sphere{<1.89199,-0.492525,4.09978>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.37249,0.393,3.69442>,<1.71027,0.662039,3.77879>,<1.90271,0.578303,4.27799>}
+	triangle{<1.37249,0.393,3.69442>,<1.90271,0.578303,4.27799>,<1.73397,0.277774,4.55204>}
+	triangle{<1.37249,0.393,3.69442>,<1.73397,0.277774,4.55204>,<1.30865,0.079253,4.17887>}
+	texture{t1}
+}
+union{
+	cylinder{<1.37249,0.393,3.69442>,<1.71027,0.662039,3.77879>,r}
+	sphere{<1.71027,0.662039,3.77879>,r}
+	cylinder{<1.71027,0.662039,3.77879>,<1.90271,0.578303,4.27799>,r}
+	sphere{<1.90271,0.578303,4.27799>,r}
+	cylinder{<1.90271,0.578303,4.27799>,<1.73397,0.277774,4.55204>,r}
+	sphere{<1.73397,0.277774,4.55204>,r}
+	cylinder{<1.73397,0.277774,4.55204>,<1.30865,0.079253,4.17887>,r}
+	sphere{<1.30865,0.079253,4.17887>,r}
+	cylinder{<1.30865,0.079253,4.17887>,<1.37249,0.393,3.69442>,r}
+	sphere{<1.37249,0.393,3.69442>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.08445,-0.154057,4.44271>,<1.73397,0.277774,4.55204>,<1.90271,0.578303,4.27799>}
+	triangle{<2.08445,-0.154057,4.44271>,<1.90271,0.578303,4.27799>,<2.5188,0.419638,3.82432>}
+	triangle{<2.08445,-0.154057,4.44271>,<2.5188,0.419638,3.82432>,<2.7017,0.0723714,3.82035>}
+	texture{t1}
+}
+union{
+	cylinder{<2.08445,-0.154057,4.44271>,<1.73397,0.277774,4.55204>,r}
+	sphere{<1.73397,0.277774,4.55204>,r}
+	cylinder{<1.73397,0.277774,4.55204>,<1.90271,0.578303,4.27799>,r}
+	sphere{<1.90271,0.578303,4.27799>,r}
+	cylinder{<1.90271,0.578303,4.27799>,<2.5188,0.419638,3.82432>,r}
+	sphere{<2.5188,0.419638,3.82432>,r}
+	cylinder{<2.5188,0.419638,3.82432>,<2.7017,0.0723714,3.82035>,r}
+	sphere{<2.7017,0.0723714,3.82035>,r}
+	cylinder{<2.7017,0.0723714,3.82035>,<2.08445,-0.154057,4.44271>,r}
+	sphere{<2.08445,-0.154057,4.44271>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.98001,1.98725,3.65665>,<-1.45408,1.91937,3.61117>,<-1.53589,1.66799,3.23344>}
+	triangle{<-1.98001,1.98725,3.65665>,<-1.53589,1.66799,3.23344>,<-1.86962,1.66035,3.18779>}
+	triangle{<-1.98001,1.98725,3.65665>,<-1.86962,1.66035,3.18779>,<-2.06733,1.92555,3.55702>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.98001,1.98725,3.65665>,<-1.45408,1.91937,3.61117>,r}
+	sphere{<-1.45408,1.91937,3.61117>,r}
+	cylinder{<-1.45408,1.91937,3.61117>,<-1.53589,1.66799,3.23344>,r}
+	sphere{<-1.53589,1.66799,3.23344>,r}
+	cylinder{<-1.53589,1.66799,3.23344>,<-1.86962,1.66035,3.18779>,r}
+	sphere{<-1.86962,1.66035,3.18779>,r}
+	cylinder{<-1.86962,1.66035,3.18779>,<-2.06733,1.92555,3.55702>,r}
+	sphere{<-2.06733,1.92555,3.55702>,r}
+	cylinder{<-2.06733,1.92555,3.55702>,<-1.98001,1.98725,3.65665>,r}
+	sphere{<-1.98001,1.98725,3.65665>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.98001,1.98725,3.65665>,<-1.86386,3,3.39865>,<-1.27802,3,3.32973>}
+	triangle{<-1.98001,1.98725,3.65665>,<-1.27802,3,3.32973>,<-1.19208,2.18774,3.5156>}
+	triangle{<-1.98001,1.98725,3.65665>,<-1.19208,2.18774,3.5156>,<-1.45408,1.91937,3.61117>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.98001,1.98725,3.65665>,<-1.86386,3,3.39865>,r}
+	sphere{<-1.86386,3,3.39865>,r}
+	cylinder{<-1.86386,3,3.39865>,<-1.27802,3,3.32973>,r}
+	sphere{<-1.27802,3,3.32973>,r}
+	cylinder{<-1.27802,3,3.32973>,<-1.19208,2.18774,3.5156>,r}
+	sphere{<-1.19208,2.18774,3.5156>,r}
+	cylinder{<-1.19208,2.18774,3.5156>,<-1.45408,1.91937,3.61117>,r}
+	sphere{<-1.45408,1.91937,3.61117>,r}
+	cylinder{<-1.45408,1.91937,3.61117>,<-1.98001,1.98725,3.65665>,r}
+	sphere{<-1.98001,1.98725,3.65665>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.98001,1.98725,3.65665>,<-2.06733,1.92555,3.55702>,<-2.3282,2.26727,3.03859>}
+	triangle{<-1.98001,1.98725,3.65665>,<-2.3282,2.26727,3.03859>,<-2.11464,3,3.03813>}
+	triangle{<-1.98001,1.98725,3.65665>,<-2.11464,3,3.03813>,<-1.86386,3,3.39865>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.98001,1.98725,3.65665>,<-2.06733,1.92555,3.55702>,r}
+	sphere{<-2.06733,1.92555,3.55702>,r}
+	cylinder{<-2.06733,1.92555,3.55702>,<-2.3282,2.26727,3.03859>,r}
+	sphere{<-2.3282,2.26727,3.03859>,r}
+	cylinder{<-2.3282,2.26727,3.03859>,<-2.11464,3,3.03813>,r}
+	sphere{<-2.11464,3,3.03813>,r}
+	cylinder{<-2.11464,3,3.03813>,<-1.86386,3,3.39865>,r}
+	sphere{<-1.86386,3,3.39865>,r}
+	cylinder{<-1.86386,3,3.39865>,<-1.98001,1.98725,3.65665>,r}
+	sphere{<-1.98001,1.98725,3.65665>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.19208,2.18774,3.5156>,<-1.03503,2.21692,3.13807>,<-1.18617,1.86381,2.71093>}
+	triangle{<-1.19208,2.18774,3.5156>,<-1.18617,1.86381,2.71093>,<-1.53589,1.66799,3.23344>}
+	triangle{<-1.19208,2.18774,3.5156>,<-1.53589,1.66799,3.23344>,<-1.45408,1.91937,3.61117>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.19208,2.18774,3.5156>,<-1.03503,2.21692,3.13807>,r}
+	sphere{<-1.03503,2.21692,3.13807>,r}
+	cylinder{<-1.03503,2.21692,3.13807>,<-1.18617,1.86381,2.71093>,r}
+	sphere{<-1.18617,1.86381,2.71093>,r}
+	cylinder{<-1.18617,1.86381,2.71093>,<-1.53589,1.66799,3.23344>,r}
+	sphere{<-1.53589,1.66799,3.23344>,r}
+	cylinder{<-1.53589,1.66799,3.23344>,<-1.45408,1.91937,3.61117>,r}
+	sphere{<-1.45408,1.91937,3.61117>,r}
+	cylinder{<-1.45408,1.91937,3.61117>,<-1.19208,2.18774,3.5156>,r}
+	sphere{<-1.19208,2.18774,3.5156>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.3282,2.26727,3.03859>,<-2.06733,1.92555,3.55702>,<-1.86962,1.66035,3.18779>}
+	triangle{<-2.3282,2.26727,3.03859>,<-1.86962,1.66035,3.18779>,<-2.01375,1.84661,2.5924>}
+	triangle{<-2.3282,2.26727,3.03859>,<-2.01375,1.84661,2.5924>,<-2.0917,1.94978,2.56644>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.3282,2.26727,3.03859>,<-2.06733,1.92555,3.55702>,r}
+	sphere{<-2.06733,1.92555,3.55702>,r}
+	cylinder{<-2.06733,1.92555,3.55702>,<-1.86962,1.66035,3.18779>,r}
+	sphere{<-1.86962,1.66035,3.18779>,r}
+	cylinder{<-1.86962,1.66035,3.18779>,<-2.01375,1.84661,2.5924>,r}
+	sphere{<-2.01375,1.84661,2.5924>,r}
+	cylinder{<-2.01375,1.84661,2.5924>,<-2.0917,1.94978,2.56644>,r}
+	sphere{<-2.0917,1.94978,2.56644>,r}
+	cylinder{<-2.0917,1.94978,2.56644>,<-2.3282,2.26727,3.03859>,r}
+	sphere{<-2.3282,2.26727,3.03859>,r}
+	texture{t2}
+}
+union{
+	triangle{<-3,1.87965,3.62676>,<-3,2.26738,3.03851>,<-2.3282,2.26727,3.03859>}
+	triangle{<-3,1.87965,3.62676>,<-2.3282,2.26727,3.03859>,<-2.06733,1.92555,3.55702>}
+	triangle{<-3,1.87965,3.62676>,<-2.06733,1.92555,3.55702>,<-2.15443,1.87965,3.62667>}
+	texture{t1}
+}
+union{
+	cylinder{<-3,1.87965,3.62676>,<-3,2.26738,3.03851>,r}
+	sphere{<-3,2.26738,3.03851>,r}
+	cylinder{<-3,2.26738,3.03851>,<-2.3282,2.26727,3.03859>,r}
+	sphere{<-2.3282,2.26727,3.03859>,r}
+	cylinder{<-2.3282,2.26727,3.03859>,<-2.06733,1.92555,3.55702>,r}
+	sphere{<-2.06733,1.92555,3.55702>,r}
+	cylinder{<-2.06733,1.92555,3.55702>,<-2.15443,1.87965,3.62667>,r}
+	sphere{<-2.15443,1.87965,3.62667>,r}
+	cylinder{<-2.15443,1.87965,3.62667>,<-3,1.87965,3.62676>,r}
+	sphere{<-3,1.87965,3.62676>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.46673,1.3289,3.65576>,<-2.15443,1.87965,3.62667>,<-2.06733,1.92555,3.55702>}
+	triangle{<-2.46673,1.3289,3.65576>,<-2.06733,1.92555,3.55702>,<-1.86962,1.66035,3.18779>}
+	triangle{<-2.46673,1.3289,3.65576>,<-1.86962,1.66035,3.18779>,<-2.09304,1.17721,3.15766>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.46673,1.3289,3.65576>,<-2.15443,1.87965,3.62667>,r}
+	sphere{<-2.15443,1.87965,3.62667>,r}
+	cylinder{<-2.15443,1.87965,3.62667>,<-2.06733,1.92555,3.55702>,r}
+	sphere{<-2.06733,1.92555,3.55702>,r}
+	cylinder{<-2.06733,1.92555,3.55702>,<-1.86962,1.66035,3.18779>,r}
+	sphere{<-1.86962,1.66035,3.18779>,r}
+	cylinder{<-1.86962,1.66035,3.18779>,<-2.09304,1.17721,3.15766>,r}
+	sphere{<-2.09304,1.17721,3.15766>,r}
+	cylinder{<-2.09304,1.17721,3.15766>,<-2.46673,1.3289,3.65576>,r}
+	sphere{<-2.46673,1.3289,3.65576>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.43896,2.74239,4.67608>,<-2.01734,1.97248,3.73958>,<-1.98001,1.98725,3.65665>}
+	triangle{<-2.43896,2.74239,4.67608>,<-1.98001,1.98725,3.65665>,<-1.86386,3,3.39865>}
+	triangle{<-2.43896,2.74239,4.67608>,<-1.86386,3,3.39865>,<-2.51776,3,4.85113>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.43896,2.74239,4.67608>,<-2.01734,1.97248,3.73958>,r}
+	sphere{<-2.01734,1.97248,3.73958>,r}
+	cylinder{<-2.01734,1.97248,3.73958>,<-1.98001,1.98725,3.65665>,r}
+	sphere{<-1.98001,1.98725,3.65665>,r}
+	cylinder{<-1.98001,1.98725,3.65665>,<-1.86386,3,3.39865>,r}
+	sphere{<-1.86386,3,3.39865>,r}
+	cylinder{<-1.86386,3,3.39865>,<-2.51776,3,4.85113>,r}
+	sphere{<-2.51776,3,4.85113>,r}
+	cylinder{<-2.51776,3,4.85113>,<-2.43896,2.74239,4.67608>,r}
+	sphere{<-2.43896,2.74239,4.67608>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.53052,1.00055,4.4616>,<-3,1.00057,4.46164>,<-3,3,5.31798>}
+	triangle{<-2.53052,1.00055,4.4616>,<-3,3,5.31798>,<-2.96979,3,5.31797>}
+	triangle{<-2.53052,1.00055,4.4616>,<-2.96979,3,5.31797>,<-2.10474,1.43413,4.64727>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.53052,1.00055,4.4616>,<-3,1.00057,4.46164>,r}
+	sphere{<-3,1.00057,4.46164>,r}
+	cylinder{<-3,1.00057,4.46164>,<-3,3,5.31798>,r}
+	sphere{<-3,3,5.31798>,r}
+	cylinder{<-3,3,5.31798>,<-2.96979,3,5.31797>,r}
+	sphere{<-2.96979,3,5.31797>,r}
+	cylinder{<-2.96979,3,5.31797>,<-2.10474,1.43413,4.64727>,r}
+	sphere{<-2.10474,1.43413,4.64727>,r}
+	cylinder{<-2.10474,1.43413,4.64727>,<-2.53052,1.00055,4.4616>,r}
+	sphere{<-2.53052,1.00055,4.4616>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.630059,1.92292,3.78288>,<-1.08242,2.09384,3.75282>,<-0.804798,3,4.35349>}
+	triangle{<-0.630059,1.92292,3.78288>,<-0.804798,3,4.35349>,<-0.782958,3,4.3597>}
+	triangle{<-0.630059,1.92292,3.78288>,<-0.782958,3,4.3597>,<-0.331292,2.20857,4.03223>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.630059,1.92292,3.78288>,<-1.08242,2.09384,3.75282>,r}
+	sphere{<-1.08242,2.09384,3.75282>,r}
+	cylinder{<-1.08242,2.09384,3.75282>,<-0.804798,3,4.35349>,r}
+	sphere{<-0.804798,3,4.35349>,r}
+	cylinder{<-0.804798,3,4.35349>,<-0.782958,3,4.3597>,r}
+	sphere{<-0.782958,3,4.3597>,r}
+	cylinder{<-0.782958,3,4.3597>,<-0.331292,2.20857,4.03223>,r}
+	sphere{<-0.331292,2.20857,4.03223>,r}
+	cylinder{<-0.331292,2.20857,4.03223>,<-0.630059,1.92292,3.78288>,r}
+	sphere{<-0.630059,1.92292,3.78288>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.630059,1.92292,3.78288>,<-0.331292,2.20857,4.03223>,<-0.0415858,2.32091,3.82218>}
+	triangle{<-0.630059,1.92292,3.78288>,<-0.0415858,2.32091,3.82218>,<-0.061335,2.16227,3.42216>}
+	triangle{<-0.630059,1.92292,3.78288>,<-0.061335,2.16227,3.42216>,<-0.395699,1.92949,3.38157>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.630059,1.92292,3.78288>,<-0.331292,2.20857,4.03223>,r}
+	sphere{<-0.331292,2.20857,4.03223>,r}
+	cylinder{<-0.331292,2.20857,4.03223>,<-0.0415858,2.32091,3.82218>,r}
+	sphere{<-0.0415858,2.32091,3.82218>,r}
+	cylinder{<-0.0415858,2.32091,3.82218>,<-0.061335,2.16227,3.42216>,r}
+	sphere{<-0.061335,2.16227,3.42216>,r}
+	cylinder{<-0.061335,2.16227,3.42216>,<-0.395699,1.92949,3.38157>,r}
+	sphere{<-0.395699,1.92949,3.38157>,r}
+	cylinder{<-0.395699,1.92949,3.38157>,<-0.630059,1.92292,3.78288>,r}
+	sphere{<-0.630059,1.92292,3.78288>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.20813,1.63116,3.94897>,<-1.30755,1.83203,3.8769>,<-1.08242,2.09384,3.75282>}
+	triangle{<-1.20813,1.63116,3.94897>,<-1.08242,2.09384,3.75282>,<-0.630059,1.92292,3.78288>}
+	triangle{<-1.20813,1.63116,3.94897>,<-0.630059,1.92292,3.78288>,<-0.666201,1.57693,3.92464>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.20813,1.63116,3.94897>,<-1.30755,1.83203,3.8769>,r}
+	sphere{<-1.30755,1.83203,3.8769>,r}
+	cylinder{<-1.30755,1.83203,3.8769>,<-1.08242,2.09384,3.75282>,r}
+	sphere{<-1.08242,2.09384,3.75282>,r}
+	cylinder{<-1.08242,2.09384,3.75282>,<-0.630059,1.92292,3.78288>,r}
+	sphere{<-0.630059,1.92292,3.78288>,r}
+	cylinder{<-0.630059,1.92292,3.78288>,<-0.666201,1.57693,3.92464>,r}
+	sphere{<-0.666201,1.57693,3.92464>,r}
+	cylinder{<-0.666201,1.57693,3.92464>,<-1.20813,1.63116,3.94897>,r}
+	sphere{<-1.20813,1.63116,3.94897>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.666201,1.57693,3.92464>,<-0.630059,1.92292,3.78288>,<-0.395699,1.92949,3.38157>}
+	triangle{<-0.666201,1.57693,3.92464>,<-0.395699,1.92949,3.38157>,<-0.250581,1.43064,3.24952>}
+	triangle{<-0.666201,1.57693,3.92464>,<-0.250581,1.43064,3.24952>,<-0.457568,1.17624,3.66151>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.666201,1.57693,3.92464>,<-0.630059,1.92292,3.78288>,r}
+	sphere{<-0.630059,1.92292,3.78288>,r}
+	cylinder{<-0.630059,1.92292,3.78288>,<-0.395699,1.92949,3.38157>,r}
+	sphere{<-0.395699,1.92949,3.38157>,r}
+	cylinder{<-0.395699,1.92949,3.38157>,<-0.250581,1.43064,3.24952>,r}
+	sphere{<-0.250581,1.43064,3.24952>,r}
+	cylinder{<-0.250581,1.43064,3.24952>,<-0.457568,1.17624,3.66151>,r}
+	sphere{<-0.457568,1.17624,3.66151>,r}
+	cylinder{<-0.457568,1.17624,3.66151>,<-0.666201,1.57693,3.92464>,r}
+	sphere{<-0.666201,1.57693,3.92464>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.457568,1.17624,3.66151>,<-0.666201,1.57693,3.92464>,<-0.317933,1.40281,4.49524>}
+	triangle{<-0.457568,1.17624,3.66151>,<-0.317933,1.40281,4.49524>,<-0.160131,1.02821,4.15021>}
+	triangle{<-0.457568,1.17624,3.66151>,<-0.160131,1.02821,4.15021>,<-0.179314,0.991529,4.02433>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.457568,1.17624,3.66151>,<-0.666201,1.57693,3.92464>,r}
+	sphere{<-0.666201,1.57693,3.92464>,r}
+	cylinder{<-0.666201,1.57693,3.92464>,<-0.317933,1.40281,4.49524>,r}
+	sphere{<-0.317933,1.40281,4.49524>,r}
+	cylinder{<-0.317933,1.40281,4.49524>,<-0.160131,1.02821,4.15021>,r}
+	sphere{<-0.160131,1.02821,4.15021>,r}
+	cylinder{<-0.160131,1.02821,4.15021>,<-0.179314,0.991529,4.02433>,r}
+	sphere{<-0.179314,0.991529,4.02433>,r}
+	cylinder{<-0.179314,0.991529,4.02433>,<-0.457568,1.17624,3.66151>,r}
+	sphere{<-0.457568,1.17624,3.66151>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.08725,1.93259,4.95169>,<-1.25071,1.50231,4.51119>,<-1.38087,1.57878,4.25>}
+	triangle{<-1.08725,1.93259,4.95169>,<-1.38087,1.57878,4.25>,<-1.45734,1.79174,4.13248>}
+	triangle{<-1.08725,1.93259,4.95169>,<-1.45734,1.79174,4.13248>,<-1.29451,2.42382,4.61477>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.08725,1.93259,4.95169>,<-1.25071,1.50231,4.51119>,r}
+	sphere{<-1.25071,1.50231,4.51119>,r}
+	cylinder{<-1.25071,1.50231,4.51119>,<-1.38087,1.57878,4.25>,r}
+	sphere{<-1.38087,1.57878,4.25>,r}
+	cylinder{<-1.38087,1.57878,4.25>,<-1.45734,1.79174,4.13248>,r}
+	sphere{<-1.45734,1.79174,4.13248>,r}
+	cylinder{<-1.45734,1.79174,4.13248>,<-1.29451,2.42382,4.61477>,r}
+	sphere{<-1.29451,2.42382,4.61477>,r}
+	cylinder{<-1.29451,2.42382,4.61477>,<-1.08725,1.93259,4.95169>,r}
+	sphere{<-1.08725,1.93259,4.95169>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.480568,1.90312,4.29446>,<0.428154,1.1482,3.84195>,<0.435901,1.35946,3.47542>}
+	triangle{<0.480568,1.90312,4.29446>,<0.435901,1.35946,3.47542>,<0.461535,1.81024,3.34214>}
+	triangle{<0.480568,1.90312,4.29446>,<0.461535,1.81024,3.34214>,<0.488356,2.09011,4.03644>}
+	texture{t1}
+}
+union{
+	cylinder{<0.480568,1.90312,4.29446>,<0.428154,1.1482,3.84195>,r}
+	sphere{<0.428154,1.1482,3.84195>,r}
+	cylinder{<0.428154,1.1482,3.84195>,<0.435901,1.35946,3.47542>,r}
+	sphere{<0.435901,1.35946,3.47542>,r}
+	cylinder{<0.435901,1.35946,3.47542>,<0.461535,1.81024,3.34214>,r}
+	sphere{<0.461535,1.81024,3.34214>,r}
+	cylinder{<0.461535,1.81024,3.34214>,<0.488356,2.09011,4.03644>,r}
+	sphere{<0.488356,2.09011,4.03644>,r}
+	cylinder{<0.488356,2.09011,4.03644>,<0.480568,1.90312,4.29446>,r}
+	sphere{<0.480568,1.90312,4.29446>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.480568,1.90312,4.29446>,<0.488356,2.09011,4.03644>,<0.690396,2.24044,4.11811>}
+	triangle{<0.480568,1.90312,4.29446>,<0.690396,2.24044,4.11811>,<0.739683,2.1487,4.32313>}
+	triangle{<0.480568,1.90312,4.29446>,<0.739683,2.1487,4.32313>,<0.65223,1.97116,4.44987>}
+	texture{t1}
+}
+union{
+	cylinder{<0.480568,1.90312,4.29446>,<0.488356,2.09011,4.03644>,r}
+	sphere{<0.488356,2.09011,4.03644>,r}
+	cylinder{<0.488356,2.09011,4.03644>,<0.690396,2.24044,4.11811>,r}
+	sphere{<0.690396,2.24044,4.11811>,r}
+	cylinder{<0.690396,2.24044,4.11811>,<0.739683,2.1487,4.32313>,r}
+	sphere{<0.739683,2.1487,4.32313>,r}
+	cylinder{<0.739683,2.1487,4.32313>,<0.65223,1.97116,4.44987>,r}
+	sphere{<0.65223,1.97116,4.44987>,r}
+	cylinder{<0.65223,1.97116,4.44987>,<0.480568,1.90312,4.29446>,r}
+	sphere{<0.480568,1.90312,4.29446>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.792646,0.90419,3.55045>,<0.58713,0.961652,3.84818>,<1.07693,1.35951,4.40402>}
+	triangle{<0.792646,0.90419,3.55045>,<1.07693,1.35951,4.40402>,<1.54835,1.31319,3.92333>}
+	triangle{<0.792646,0.90419,3.55045>,<1.54835,1.31319,3.92333>,<1.51434,1.22037,3.73049>}
+	texture{t1}
+}
+union{
+	cylinder{<0.792646,0.90419,3.55045>,<0.58713,0.961652,3.84818>,r}
+	sphere{<0.58713,0.961652,3.84818>,r}
+	cylinder{<0.58713,0.961652,3.84818>,<1.07693,1.35951,4.40402>,r}
+	sphere{<1.07693,1.35951,4.40402>,r}
+	cylinder{<1.07693,1.35951,4.40402>,<1.54835,1.31319,3.92333>,r}
+	sphere{<1.54835,1.31319,3.92333>,r}
+	cylinder{<1.54835,1.31319,3.92333>,<1.51434,1.22037,3.73049>,r}
+	sphere{<1.51434,1.22037,3.73049>,r}
+	cylinder{<1.51434,1.22037,3.73049>,<0.792646,0.90419,3.55045>,r}
+	sphere{<0.792646,0.90419,3.55045>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.00975,1.97101,4.46891>,<0.739683,2.1487,4.32313>,<0.690396,2.24044,4.11811>}
+	triangle{<1.00975,1.97101,4.46891>,<0.690396,2.24044,4.11811>,<1.0646,2.24796,3.55699>}
+	triangle{<1.00975,1.97101,4.46891>,<1.0646,2.24796,3.55699>,<1.5964,1.88916,3.87088>}
+	texture{t1}
+}
+union{
+	cylinder{<1.00975,1.97101,4.46891>,<0.739683,2.1487,4.32313>,r}
+	sphere{<0.739683,2.1487,4.32313>,r}
+	cylinder{<0.739683,2.1487,4.32313>,<0.690396,2.24044,4.11811>,r}
+	sphere{<0.690396,2.24044,4.11811>,r}
+	cylinder{<0.690396,2.24044,4.11811>,<1.0646,2.24796,3.55699>,r}
+	sphere{<1.0646,2.24796,3.55699>,r}
+	cylinder{<1.0646,2.24796,3.55699>,<1.5964,1.88916,3.87088>,r}
+	sphere{<1.5964,1.88916,3.87088>,r}
+	cylinder{<1.5964,1.88916,3.87088>,<1.00975,1.97101,4.46891>,r}
+	sphere{<1.00975,1.97101,4.46891>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.0895464,2.83375,2.84988>,<-0.0895384,3,2.84988>,<-0.0415544,3,3.82215>}
+	triangle{<-0.0895464,2.83375,2.84988>,<-0.0415544,3,3.82215>,<-0.0415858,2.32091,3.82218>}
+	triangle{<-0.0895464,2.83375,2.84988>,<-0.0415858,2.32091,3.82218>,<-0.061335,2.16227,3.42216>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.0895464,2.83375,2.84988>,<-0.0895384,3,2.84988>,r}
+	sphere{<-0.0895384,3,2.84988>,r}
+	cylinder{<-0.0895384,3,2.84988>,<-0.0415544,3,3.82215>,r}
+	sphere{<-0.0415544,3,3.82215>,r}
+	cylinder{<-0.0415544,3,3.82215>,<-0.0415858,2.32091,3.82218>,r}
+	sphere{<-0.0415858,2.32091,3.82218>,r}
+	cylinder{<-0.0415858,2.32091,3.82218>,<-0.061335,2.16227,3.42216>,r}
+	sphere{<-0.061335,2.16227,3.42216>,r}
+	cylinder{<-0.061335,2.16227,3.42216>,<-0.0895464,2.83375,2.84988>,r}
+	sphere{<-0.0895464,2.83375,2.84988>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.061335,2.16227,3.42216>,<-0.0415858,2.32091,3.82218>,<0.488356,2.09011,4.03644>}
+	triangle{<-0.061335,2.16227,3.42216>,<0.488356,2.09011,4.03644>,<0.461535,1.81024,3.34214>}
+	triangle{<-0.061335,2.16227,3.42216>,<0.461535,1.81024,3.34214>,<0.426589,1.81811,3.31078>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.061335,2.16227,3.42216>,<-0.0415858,2.32091,3.82218>,r}
+	sphere{<-0.0415858,2.32091,3.82218>,r}
+	cylinder{<-0.0415858,2.32091,3.82218>,<0.488356,2.09011,4.03644>,r}
+	sphere{<0.488356,2.09011,4.03644>,r}
+	cylinder{<0.488356,2.09011,4.03644>,<0.461535,1.81024,3.34214>,r}
+	sphere{<0.461535,1.81024,3.34214>,r}
+	cylinder{<0.461535,1.81024,3.34214>,<0.426589,1.81811,3.31078>,r}
+	sphere{<0.426589,1.81811,3.31078>,r}
+	cylinder{<0.426589,1.81811,3.31078>,<-0.061335,2.16227,3.42216>,r}
+	sphere{<-0.061335,2.16227,3.42216>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.690258,3,4.11801>,<0.690396,2.24044,4.11811>,<0.488356,2.09011,4.03644>}
+	triangle{<0.690258,3,4.11801>,<0.488356,2.09011,4.03644>,<-0.0415858,2.32091,3.82218>}
+	triangle{<0.690258,3,4.11801>,<-0.0415858,2.32091,3.82218>,<-0.0415544,3,3.82215>}
+	texture{t1}
+}
+union{
+	cylinder{<0.690258,3,4.11801>,<0.690396,2.24044,4.11811>,r}
+	sphere{<0.690396,2.24044,4.11811>,r}
+	cylinder{<0.690396,2.24044,4.11811>,<0.488356,2.09011,4.03644>,r}
+	sphere{<0.488356,2.09011,4.03644>,r}
+	cylinder{<0.488356,2.09011,4.03644>,<-0.0415858,2.32091,3.82218>,r}
+	sphere{<-0.0415858,2.32091,3.82218>,r}
+	cylinder{<-0.0415858,2.32091,3.82218>,<-0.0415544,3,3.82215>,r}
+	sphere{<-0.0415544,3,3.82215>,r}
+	cylinder{<-0.0415544,3,3.82215>,<0.690258,3,4.11801>,r}
+	sphere{<0.690258,3,4.11801>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.5964,1.88916,3.87088>,<1.00975,1.97101,4.46891>,<1.51181,2.27678,4.74013>}
+	triangle{<1.5964,1.88916,3.87088>,<1.51181,2.27678,4.74013>,<1.93092,2.15722,4.18562>}
+	triangle{<1.5964,1.88916,3.87088>,<1.93092,2.15722,4.18562>,<1.79749,1.96932,3.89134>}
+	texture{t1}
+}
+union{
+	cylinder{<1.5964,1.88916,3.87088>,<1.00975,1.97101,4.46891>,r}
+	sphere{<1.00975,1.97101,4.46891>,r}
+	cylinder{<1.00975,1.97101,4.46891>,<1.51181,2.27678,4.74013>,r}
+	sphere{<1.51181,2.27678,4.74013>,r}
+	cylinder{<1.51181,2.27678,4.74013>,<1.93092,2.15722,4.18562>,r}
+	sphere{<1.93092,2.15722,4.18562>,r}
+	cylinder{<1.93092,2.15722,4.18562>,<1.79749,1.96932,3.89134>,r}
+	sphere{<1.79749,1.96932,3.89134>,r}
+	cylinder{<1.79749,1.96932,3.89134>,<1.5964,1.88916,3.87088>,r}
+	sphere{<1.5964,1.88916,3.87088>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.739683,2.1487,4.32313>,<0.739609,3,4.32335>,<1.51185,3,4.74037>}
+	triangle{<0.739683,2.1487,4.32313>,<1.51185,3,4.74037>,<1.51181,2.27678,4.74013>}
+	triangle{<0.739683,2.1487,4.32313>,<1.51181,2.27678,4.74013>,<1.00975,1.97101,4.46891>}
+	texture{t1}
+}
+union{
+	cylinder{<0.739683,2.1487,4.32313>,<0.739609,3,4.32335>,r}
+	sphere{<0.739609,3,4.32335>,r}
+	cylinder{<0.739609,3,4.32335>,<1.51185,3,4.74037>,r}
+	sphere{<1.51185,3,4.74037>,r}
+	cylinder{<1.51185,3,4.74037>,<1.51181,2.27678,4.74013>,r}
+	sphere{<1.51181,2.27678,4.74013>,r}
+	cylinder{<1.51181,2.27678,4.74013>,<1.00975,1.97101,4.46891>,r}
+	sphere{<1.00975,1.97101,4.46891>,r}
+	cylinder{<1.00975,1.97101,4.46891>,<0.739683,2.1487,4.32313>,r}
+	sphere{<0.739683,2.1487,4.32313>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.331292,2.20857,4.03223>,<-0.782958,3,4.3597>,<-0.78412,3,4.40445>}
+	triangle{<-0.331292,2.20857,4.03223>,<-0.78412,3,4.40445>,<-0.442368,2.36875,4.8559>}
+	triangle{<-0.331292,2.20857,4.03223>,<-0.442368,2.36875,4.8559>,<-0.15126,1.86695,4.46609>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.331292,2.20857,4.03223>,<-0.782958,3,4.3597>,r}
+	sphere{<-0.782958,3,4.3597>,r}
+	cylinder{<-0.782958,3,4.3597>,<-0.78412,3,4.40445>,r}
+	sphere{<-0.78412,3,4.40445>,r}
+	cylinder{<-0.78412,3,4.40445>,<-0.442368,2.36875,4.8559>,r}
+	sphere{<-0.442368,2.36875,4.8559>,r}
+	cylinder{<-0.442368,2.36875,4.8559>,<-0.15126,1.86695,4.46609>,r}
+	sphere{<-0.15126,1.86695,4.46609>,r}
+	cylinder{<-0.15126,1.86695,4.46609>,<-0.331292,2.20857,4.03223>,r}
+	sphere{<-0.331292,2.20857,4.03223>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.15126,1.86695,4.46609>,<-0.442368,2.36875,4.8559>,<-0.016221,2.87945,5.41894>}
+	triangle{<-0.15126,1.86695,4.46609>,<-0.016221,2.87945,5.41894>,<0.486549,1.95163,4.69003>}
+	triangle{<-0.15126,1.86695,4.46609>,<0.486549,1.95163,4.69003>,<0.110804,1.81833,4.48217>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.15126,1.86695,4.46609>,<-0.442368,2.36875,4.8559>,r}
+	sphere{<-0.442368,2.36875,4.8559>,r}
+	cylinder{<-0.442368,2.36875,4.8559>,<-0.016221,2.87945,5.41894>,r}
+	sphere{<-0.016221,2.87945,5.41894>,r}
+	cylinder{<-0.016221,2.87945,5.41894>,<0.486549,1.95163,4.69003>,r}
+	sphere{<0.486549,1.95163,4.69003>,r}
+	cylinder{<0.486549,1.95163,4.69003>,<0.110804,1.81833,4.48217>,r}
+	sphere{<0.110804,1.81833,4.48217>,r}
+	cylinder{<0.110804,1.81833,4.48217>,<-0.15126,1.86695,4.46609>,r}
+	sphere{<-0.15126,1.86695,4.46609>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.025,2.72403,3.61227>,<2.24475,2.02295,3.28241>,<2.04327,1.65162,3.54209>}
+	triangle{<2.025,2.72403,3.61227>,<2.04327,1.65162,3.54209>,<1.85747,1.71452,3.79864>}
+	triangle{<2.025,2.72403,3.61227>,<1.85747,1.71452,3.79864>,<1.79749,1.96932,3.89134>}
+	texture{t1}
+}
+union{
+	cylinder{<2.025,2.72403,3.61227>,<2.24475,2.02295,3.28241>,r}
+	sphere{<2.24475,2.02295,3.28241>,r}
+	cylinder{<2.24475,2.02295,3.28241>,<2.04327,1.65162,3.54209>,r}
+	sphere{<2.04327,1.65162,3.54209>,r}
+	cylinder{<2.04327,1.65162,3.54209>,<1.85747,1.71452,3.79864>,r}
+	sphere{<1.85747,1.71452,3.79864>,r}
+	cylinder{<1.85747,1.71452,3.79864>,<1.79749,1.96932,3.89134>,r}
+	sphere{<1.79749,1.96932,3.89134>,r}
+	cylinder{<1.79749,1.96932,3.89134>,<2.025,2.72403,3.61227>,r}
+	sphere{<2.025,2.72403,3.61227>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.62039,1.42027,3.53227>,<1.69873,1.61076,3.76813>,<1.85747,1.71452,3.79864>}
+	triangle{<1.62039,1.42027,3.53227>,<1.85747,1.71452,3.79864>,<2.04327,1.65162,3.54209>}
+	triangle{<1.62039,1.42027,3.53227>,<2.04327,1.65162,3.54209>,<1.82913,1.4015,3.32632>}
+	texture{t1}
+}
+union{
+	cylinder{<1.62039,1.42027,3.53227>,<1.69873,1.61076,3.76813>,r}
+	sphere{<1.69873,1.61076,3.76813>,r}
+	cylinder{<1.69873,1.61076,3.76813>,<1.85747,1.71452,3.79864>,r}
+	sphere{<1.85747,1.71452,3.79864>,r}
+	cylinder{<1.85747,1.71452,3.79864>,<2.04327,1.65162,3.54209>,r}
+	sphere{<2.04327,1.65162,3.54209>,r}
+	cylinder{<2.04327,1.65162,3.54209>,<1.82913,1.4015,3.32632>,r}
+	sphere{<1.82913,1.4015,3.32632>,r}
+	cylinder{<1.82913,1.4015,3.32632>,<1.62039,1.42027,3.53227>,r}
+	sphere{<1.62039,1.42027,3.53227>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.04327,1.65162,3.54209>,<1.85747,1.71452,3.79864>,<2.34757,1.56764,4.32446>}
+	triangle{<2.04327,1.65162,3.54209>,<2.34757,1.56764,4.32446>,<3,1.35874,4.17942>}
+	triangle{<2.04327,1.65162,3.54209>,<3,1.35874,4.17942>,<3,1.35197,3.75172>}
+	texture{t1}
+}
+union{
+	cylinder{<2.04327,1.65162,3.54209>,<1.85747,1.71452,3.79864>,r}
+	sphere{<1.85747,1.71452,3.79864>,r}
+	cylinder{<1.85747,1.71452,3.79864>,<2.34757,1.56764,4.32446>,r}
+	sphere{<2.34757,1.56764,4.32446>,r}
+	cylinder{<2.34757,1.56764,4.32446>,<3,1.35874,4.17942>,r}
+	sphere{<3,1.35874,4.17942>,r}
+	cylinder{<3,1.35874,4.17942>,<3,1.35197,3.75172>,r}
+	sphere{<3,1.35197,3.75172>,r}
+	cylinder{<3,1.35197,3.75172>,<2.04327,1.65162,3.54209>,r}
+	sphere{<2.04327,1.65162,3.54209>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.93092,2.15722,4.18562>,<1.79749,1.96932,3.89134>,<2.025,2.72403,3.61227>}
+	triangle{<1.93092,2.15722,4.18562>,<2.025,2.72403,3.61227>,<2.15714,3,3.74215>}
+	triangle{<1.93092,2.15722,4.18562>,<2.15714,3,3.74215>,<2.18099,3,3.85514>}
+	texture{t1}
+}
+union{
+	cylinder{<1.93092,2.15722,4.18562>,<1.79749,1.96932,3.89134>,r}
+	sphere{<1.79749,1.96932,3.89134>,r}
+	cylinder{<1.79749,1.96932,3.89134>,<2.025,2.72403,3.61227>,r}
+	sphere{<2.025,2.72403,3.61227>,r}
+	cylinder{<2.025,2.72403,3.61227>,<2.15714,3,3.74215>,r}
+	sphere{<2.15714,3,3.74215>,r}
+	cylinder{<2.15714,3,3.74215>,<2.18099,3,3.85514>,r}
+	sphere{<2.18099,3,3.85514>,r}
+	cylinder{<2.18099,3,3.85514>,<1.93092,2.15722,4.18562>,r}
+	sphere{<1.93092,2.15722,4.18562>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.93092,2.15722,4.18562>,<2.35417,1.83987,4.51337>,<2.34757,1.56764,4.32446>}
+	triangle{<1.93092,2.15722,4.18562>,<2.34757,1.56764,4.32446>,<1.85747,1.71452,3.79864>}
+	triangle{<1.93092,2.15722,4.18562>,<1.85747,1.71452,3.79864>,<1.79749,1.96932,3.89134>}
+	texture{t1}
+}
+union{
+	cylinder{<1.93092,2.15722,4.18562>,<2.35417,1.83987,4.51337>,r}
+	sphere{<2.35417,1.83987,4.51337>,r}
+	cylinder{<2.35417,1.83987,4.51337>,<2.34757,1.56764,4.32446>,r}
+	sphere{<2.34757,1.56764,4.32446>,r}
+	cylinder{<2.34757,1.56764,4.32446>,<1.85747,1.71452,3.79864>,r}
+	sphere{<1.85747,1.71452,3.79864>,r}
+	cylinder{<1.85747,1.71452,3.79864>,<1.79749,1.96932,3.89134>,r}
+	sphere{<1.79749,1.96932,3.89134>,r}
+	cylinder{<1.79749,1.96932,3.89134>,<1.93092,2.15722,4.18562>,r}
+	sphere{<1.93092,2.15722,4.18562>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.93092,2.15722,4.18562>,<2.18099,3,3.85514>,<3,3,4.17697>}
+	triangle{<1.93092,2.15722,4.18562>,<3,3,4.17697>,<3,2.05095,4.65976>}
+	triangle{<1.93092,2.15722,4.18562>,<3,2.05095,4.65976>,<2.35417,1.83987,4.51337>}
+	texture{t1}
+}
+union{
+	cylinder{<1.93092,2.15722,4.18562>,<2.18099,3,3.85514>,r}
+	sphere{<2.18099,3,3.85514>,r}
+	cylinder{<2.18099,3,3.85514>,<3,3,4.17697>,r}
+	sphere{<3,3,4.17697>,r}
+	cylinder{<3,3,4.17697>,<3,2.05095,4.65976>,r}
+	sphere{<3,2.05095,4.65976>,r}
+	cylinder{<3,2.05095,4.65976>,<2.35417,1.83987,4.51337>,r}
+	sphere{<2.35417,1.83987,4.51337>,r}
+	cylinder{<2.35417,1.83987,4.51337>,<1.93092,2.15722,4.18562>,r}
+	sphere{<1.93092,2.15722,4.18562>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.83528,-2.52129,4.55188>,<-1.172,-2.27508,5.27378>,<-1.76938,-1.71065,4.77935>}
+	triangle{<-0.83528,-2.52129,4.55188>,<-1.76938,-1.71065,4.77935>,<-1.48051,-1.93905,4.39903>}
+	triangle{<-0.83528,-2.52129,4.55188>,<-1.48051,-1.93905,4.39903>,<-0.841862,-2.51456,4.53931>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.83528,-2.52129,4.55188>,<-1.172,-2.27508,5.27378>,r}
+	sphere{<-1.172,-2.27508,5.27378>,r}
+	cylinder{<-1.172,-2.27508,5.27378>,<-1.76938,-1.71065,4.77935>,r}
+	sphere{<-1.76938,-1.71065,4.77935>,r}
+	cylinder{<-1.76938,-1.71065,4.77935>,<-1.48051,-1.93905,4.39903>,r}
+	sphere{<-1.48051,-1.93905,4.39903>,r}
+	cylinder{<-1.48051,-1.93905,4.39903>,<-0.841862,-2.51456,4.53931>,r}
+	sphere{<-0.841862,-2.51456,4.53931>,r}
+	cylinder{<-0.841862,-2.51456,4.53931>,<-0.83528,-2.52129,4.55188>,r}
+	sphere{<-0.83528,-2.52129,4.55188>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.82172,-3,4.80901>,<-1.83383,-2.00045,4.33305>,<-1.77035,-1.71069,4.77935>}
+	triangle{<-2.82172,-3,4.80901>,<-1.77035,-1.71069,4.77935>,<-3,-2.82018,5.65658>}
+	triangle{<-2.82172,-3,4.80901>,<-3,-2.82018,5.65658>,<-3,-3,5.27634>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.82172,-3,4.80901>,<-1.83383,-2.00045,4.33305>,r}
+	sphere{<-1.83383,-2.00045,4.33305>,r}
+	cylinder{<-1.83383,-2.00045,4.33305>,<-1.77035,-1.71069,4.77935>,r}
+	sphere{<-1.77035,-1.71069,4.77935>,r}
+	cylinder{<-1.77035,-1.71069,4.77935>,<-3,-2.82018,5.65658>,r}
+	sphere{<-3,-2.82018,5.65658>,r}
+	cylinder{<-3,-2.82018,5.65658>,<-3,-3,5.27634>,r}
+	sphere{<-3,-3,5.27634>,r}
+	cylinder{<-3,-3,5.27634>,<-2.82172,-3,4.80901>,r}
+	sphere{<-2.82172,-3,4.80901>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.642719,-1.59095,6>,<-1.42148,-3,6>,<-1.44903,-3,5.86767>}
+	triangle{<-0.642719,-1.59095,6>,<-1.44903,-3,5.86767>,<-1.172,-2.27508,5.27378>}
+	triangle{<-0.642719,-1.59095,6>,<-1.172,-2.27508,5.27378>,<-0.64449,-1.55412,5.8937>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.642719,-1.59095,6>,<-1.42148,-3,6>,r}
+	sphere{<-1.42148,-3,6>,r}
+	cylinder{<-1.42148,-3,6>,<-1.44903,-3,5.86767>,r}
+	sphere{<-1.44903,-3,5.86767>,r}
+	cylinder{<-1.44903,-3,5.86767>,<-1.172,-2.27508,5.27378>,r}
+	sphere{<-1.172,-2.27508,5.27378>,r}
+	cylinder{<-1.172,-2.27508,5.27378>,<-0.64449,-1.55412,5.8937>,r}
+	sphere{<-0.64449,-1.55412,5.8937>,r}
+	cylinder{<-0.64449,-1.55412,5.8937>,<-0.642719,-1.59095,6>,r}
+	sphere{<-0.642719,-1.59095,6>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.105832,-2.7917,4.78775>,<0.105834,-3,4.78776>,<-0.128145,-3,6>}
+	triangle{<0.105832,-2.7917,4.78775>,<-0.128145,-3,6>,<-0.128158,-2.0839,6>}
+	triangle{<0.105832,-2.7917,4.78775>,<-0.128158,-2.0839,6>,<0.0207597,-1.97155,5.22845>}
+	texture{t1}
+}
+union{
+	cylinder{<0.105832,-2.7917,4.78775>,<0.105834,-3,4.78776>,r}
+	sphere{<0.105834,-3,4.78776>,r}
+	cylinder{<0.105834,-3,4.78776>,<-0.128145,-3,6>,r}
+	sphere{<-0.128145,-3,6>,r}
+	cylinder{<-0.128145,-3,6>,<-0.128158,-2.0839,6>,r}
+	sphere{<-0.128158,-2.0839,6>,r}
+	cylinder{<-0.128158,-2.0839,6>,<0.0207597,-1.97155,5.22845>,r}
+	sphere{<0.0207597,-1.97155,5.22845>,r}
+	cylinder{<0.0207597,-1.97155,5.22845>,<0.105832,-2.7917,4.78775>,r}
+	sphere{<0.105832,-2.7917,4.78775>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.251001,-1.96995,4.84741>,<-0.0304858,-1.91207,5.19703>,<0.0207597,-1.97155,5.22845>}
+	triangle{<-0.251001,-1.96995,4.84741>,<0.0207597,-1.97155,5.22845>,<0.105832,-2.7917,4.78775>}
+	triangle{<-0.251001,-1.96995,4.84741>,<0.105832,-2.7917,4.78775>,<-0.30113,-2.10342,4.68573>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.251001,-1.96995,4.84741>,<-0.0304858,-1.91207,5.19703>,r}
+	sphere{<-0.0304858,-1.91207,5.19703>,r}
+	cylinder{<-0.0304858,-1.91207,5.19703>,<0.0207597,-1.97155,5.22845>,r}
+	sphere{<0.0207597,-1.97155,5.22845>,r}
+	cylinder{<0.0207597,-1.97155,5.22845>,<0.105832,-2.7917,4.78775>,r}
+	sphere{<0.105832,-2.7917,4.78775>,r}
+	cylinder{<0.105832,-2.7917,4.78775>,<-0.30113,-2.10342,4.68573>,r}
+	sphere{<-0.30113,-2.10342,4.68573>,r}
+	cylinder{<-0.30113,-2.10342,4.68573>,<-0.251001,-1.96995,4.84741>,r}
+	sphere{<-0.251001,-1.96995,4.84741>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.8247,-1.06727,4.86873>,<1.78935,-1.15095,4.65886>,<1.91139,-1.86454,4.95661>}
+	triangle{<1.8247,-1.06727,4.86873>,<1.91139,-1.86454,4.95661>,<1.92922,-1.871,5.04175>}
+	triangle{<1.8247,-1.06727,4.86873>,<1.92922,-1.871,5.04175>,<1.92525,-1.46953,5.19314>}
+	texture{t1}
+}
+union{
+	cylinder{<1.8247,-1.06727,4.86873>,<1.78935,-1.15095,4.65886>,r}
+	sphere{<1.78935,-1.15095,4.65886>,r}
+	cylinder{<1.78935,-1.15095,4.65886>,<1.91139,-1.86454,4.95661>,r}
+	sphere{<1.91139,-1.86454,4.95661>,r}
+	cylinder{<1.91139,-1.86454,4.95661>,<1.92922,-1.871,5.04175>,r}
+	sphere{<1.92922,-1.871,5.04175>,r}
+	cylinder{<1.92922,-1.871,5.04175>,<1.92525,-1.46953,5.19314>,r}
+	sphere{<1.92525,-1.46953,5.19314>,r}
+	cylinder{<1.92525,-1.46953,5.19314>,<1.8247,-1.06727,4.86873>,r}
+	sphere{<1.8247,-1.06727,4.86873>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.66623,-1.59734,5.56568>,<1.76276,-1.94994,5.28231>,<1.00621,-2.15508,5.23324>}
+	triangle{<1.66623,-1.59734,5.56568>,<1.00621,-2.15508,5.23324>,<0.867854,-1.96633,5.39728>}
+	triangle{<1.66623,-1.59734,5.56568>,<0.867854,-1.96633,5.39728>,<1.18687,-1.38897,5.79331>}
+	texture{t1}
+}
+union{
+	cylinder{<1.66623,-1.59734,5.56568>,<1.76276,-1.94994,5.28231>,r}
+	sphere{<1.76276,-1.94994,5.28231>,r}
+	cylinder{<1.76276,-1.94994,5.28231>,<1.00621,-2.15508,5.23324>,r}
+	sphere{<1.00621,-2.15508,5.23324>,r}
+	cylinder{<1.00621,-2.15508,5.23324>,<0.867854,-1.96633,5.39728>,r}
+	sphere{<0.867854,-1.96633,5.39728>,r}
+	cylinder{<0.867854,-1.96633,5.39728>,<1.18687,-1.38897,5.79331>,r}
+	sphere{<1.18687,-1.38897,5.79331>,r}
+	cylinder{<1.18687,-1.38897,5.79331>,<1.66623,-1.59734,5.56568>,r}
+	sphere{<1.66623,-1.59734,5.56568>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.744135,-1.94776,5.23363>,<0.0207597,-1.97155,5.22845>,<-0.128158,-2.0839,6>}
+	triangle{<0.744135,-1.94776,5.23363>,<-0.128158,-2.0839,6>,<0.683009,-2.05642,6>}
+	triangle{<0.744135,-1.94776,5.23363>,<0.683009,-2.05642,6>,<0.867854,-1.96633,5.39728>}
+	texture{t1}
+}
+union{
+	cylinder{<0.744135,-1.94776,5.23363>,<0.0207597,-1.97155,5.22845>,r}
+	sphere{<0.0207597,-1.97155,5.22845>,r}
+	cylinder{<0.0207597,-1.97155,5.22845>,<-0.128158,-2.0839,6>,r}
+	sphere{<-0.128158,-2.0839,6>,r}
+	cylinder{<-0.128158,-2.0839,6>,<0.683009,-2.05642,6>,r}
+	sphere{<0.683009,-2.05642,6>,r}
+	cylinder{<0.683009,-2.05642,6>,<0.867854,-1.96633,5.39728>,r}
+	sphere{<0.867854,-1.96633,5.39728>,r}
+	cylinder{<0.867854,-1.96633,5.39728>,<0.744135,-1.94776,5.23363>,r}
+	sphere{<0.744135,-1.94776,5.23363>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.0543288,-0.882008,6>,<-0.695413,-1.27335,6>,<-0.689699,-1.28095,5.89093>}
+	triangle{<0.0543288,-0.882008,6>,<-0.689699,-1.28095,5.89093>,<-0.669842,-1.27419,5.85375>}
+	triangle{<0.0543288,-0.882008,6>,<-0.669842,-1.27419,5.85375>,<0.150866,-0.886717,5.43202>}
+	texture{t1}
+}
+union{
+	cylinder{<0.0543288,-0.882008,6>,<-0.695413,-1.27335,6>,r}
+	sphere{<-0.695413,-1.27335,6>,r}
+	cylinder{<-0.695413,-1.27335,6>,<-0.689699,-1.28095,5.89093>,r}
+	sphere{<-0.689699,-1.28095,5.89093>,r}
+	cylinder{<-0.689699,-1.28095,5.89093>,<-0.669842,-1.27419,5.85375>,r}
+	sphere{<-0.669842,-1.27419,5.85375>,r}
+	cylinder{<-0.669842,-1.27419,5.85375>,<0.150866,-0.886717,5.43202>,r}
+	sphere{<0.150866,-0.886717,5.43202>,r}
+	cylinder{<0.150866,-0.886717,5.43202>,<0.0543288,-0.882008,6>,r}
+	sphere{<0.0543288,-0.882008,6>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.867854,-1.96633,5.39728>,<1.00621,-2.15508,5.23324>,<1.21924,-3,5.60181>}
+	triangle{<0.867854,-1.96633,5.39728>,<1.21924,-3,5.60181>,<1.07255,-3,6>}
+	triangle{<0.867854,-1.96633,5.39728>,<1.07255,-3,6>,<0.683009,-2.05642,6>}
+	texture{t1}
+}
+union{
+	cylinder{<0.867854,-1.96633,5.39728>,<1.00621,-2.15508,5.23324>,r}
+	sphere{<1.00621,-2.15508,5.23324>,r}
+	cylinder{<1.00621,-2.15508,5.23324>,<1.21924,-3,5.60181>,r}
+	sphere{<1.21924,-3,5.60181>,r}
+	cylinder{<1.21924,-3,5.60181>,<1.07255,-3,6>,r}
+	sphere{<1.07255,-3,6>,r}
+	cylinder{<1.07255,-3,6>,<0.683009,-2.05642,6>,r}
+	sphere{<0.683009,-2.05642,6>,r}
+	cylinder{<0.683009,-2.05642,6>,<0.867854,-1.96633,5.39728>,r}
+	sphere{<0.867854,-1.96633,5.39728>,r}
+	texture{t2}
+}
+union{
+	triangle{<3,-2.05208,4.54185>,<3,-1.87966,5.2621>,<1.99703,-1.93479,5.03172>}
+	triangle{<3,-2.05208,4.54185>,<1.99703,-1.93479,5.03172>,<2.01635,-1.96983,4.88535>}
+	triangle{<3,-2.05208,4.54185>,<2.01635,-1.96983,4.88535>,<2.31566,-2.05207,4.5418>}
+	texture{t1}
+}
+union{
+	cylinder{<3,-2.05208,4.54185>,<3,-1.87966,5.2621>,r}
+	sphere{<3,-1.87966,5.2621>,r}
+	cylinder{<3,-1.87966,5.2621>,<1.99703,-1.93479,5.03172>,r}
+	sphere{<1.99703,-1.93479,5.03172>,r}
+	cylinder{<1.99703,-1.93479,5.03172>,<2.01635,-1.96983,4.88535>,r}
+	sphere{<2.01635,-1.96983,4.88535>,r}
+	cylinder{<2.01635,-1.96983,4.88535>,<2.31566,-2.05207,4.5418>,r}
+	sphere{<2.31566,-2.05207,4.5418>,r}
+	cylinder{<2.31566,-2.05207,4.5418>,<3,-2.05208,4.54185>,r}
+	sphere{<3,-2.05208,4.54185>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.1708,-2.77034,6>,<1.93929,-2.34817,5.46908>,<1.99703,-1.93479,5.03172>}
+	triangle{<2.1708,-2.77034,6>,<1.99703,-1.93479,5.03172>,<3,-1.87966,5.2621>}
+	triangle{<2.1708,-2.77034,6>,<3,-1.87966,5.2621>,<3,-2.55138,6>}
+	texture{t1}
+}
+union{
+	cylinder{<2.1708,-2.77034,6>,<1.93929,-2.34817,5.46908>,r}
+	sphere{<1.93929,-2.34817,5.46908>,r}
+	cylinder{<1.93929,-2.34817,5.46908>,<1.99703,-1.93479,5.03172>,r}
+	sphere{<1.99703,-1.93479,5.03172>,r}
+	cylinder{<1.99703,-1.93479,5.03172>,<3,-1.87966,5.2621>,r}
+	sphere{<3,-1.87966,5.2621>,r}
+	cylinder{<3,-1.87966,5.2621>,<3,-2.55138,6>,r}
+	sphere{<3,-2.55138,6>,r}
+	cylinder{<3,-2.55138,6>,<2.1708,-2.77034,6>,r}
+	sphere{<2.1708,-2.77034,6>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.713767,-3,4.72717>,<0.713756,-2.89283,4.72715>,<0.94003,-2.15821,5.11873>}
+	triangle{<0.713767,-3,4.72717>,<0.94003,-2.15821,5.11873>,<1.00621,-2.15508,5.23324>}
+	triangle{<0.713767,-3,4.72717>,<1.00621,-2.15508,5.23324>,<1.21924,-3,5.60181>}
+	texture{t1}
+}
+union{
+	cylinder{<0.713767,-3,4.72717>,<0.713756,-2.89283,4.72715>,r}
+	sphere{<0.713756,-2.89283,4.72715>,r}
+	cylinder{<0.713756,-2.89283,4.72715>,<0.94003,-2.15821,5.11873>,r}
+	sphere{<0.94003,-2.15821,5.11873>,r}
+	cylinder{<0.94003,-2.15821,5.11873>,<1.00621,-2.15508,5.23324>,r}
+	sphere{<1.00621,-2.15508,5.23324>,r}
+	cylinder{<1.00621,-2.15508,5.23324>,<1.21924,-3,5.60181>,r}
+	sphere{<1.21924,-3,5.60181>,r}
+	cylinder{<1.21924,-3,5.60181>,<0.713767,-3,4.72717>,r}
+	sphere{<0.713767,-3,4.72717>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.21924,-3,5.60181>,<1.00621,-2.15508,5.23324>,<1.76276,-1.94994,5.28231>}
+	triangle{<1.21924,-3,5.60181>,<1.76276,-1.94994,5.28231>,<1.93929,-2.34817,5.46908>}
+	triangle{<1.21924,-3,5.60181>,<1.93929,-2.34817,5.46908>,<1.90622,-3,5.71958>}
+	texture{t1}
+}
+union{
+	cylinder{<1.21924,-3,5.60181>,<1.00621,-2.15508,5.23324>,r}
+	sphere{<1.00621,-2.15508,5.23324>,r}
+	cylinder{<1.00621,-2.15508,5.23324>,<1.76276,-1.94994,5.28231>,r}
+	sphere{<1.76276,-1.94994,5.28231>,r}
+	cylinder{<1.76276,-1.94994,5.28231>,<1.93929,-2.34817,5.46908>,r}
+	sphere{<1.93929,-2.34817,5.46908>,r}
+	cylinder{<1.93929,-2.34817,5.46908>,<1.90622,-3,5.71958>,r}
+	sphere{<1.90622,-3,5.71958>,r}
+	cylinder{<1.90622,-3,5.71958>,<1.21924,-3,5.60181>,r}
+	sphere{<1.21924,-3,5.60181>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.93929,-2.34817,5.46908>,<1.76276,-1.94994,5.28231>,<1.66623,-1.59734,5.56568>}
+	triangle{<1.93929,-2.34817,5.46908>,<1.66623,-1.59734,5.56568>,<1.7006,-1.53566,6>}
+	triangle{<1.93929,-2.34817,5.46908>,<1.7006,-1.53566,6>,<2.1708,-2.77034,6>}
+	texture{t1}
+}
+union{
+	cylinder{<1.93929,-2.34817,5.46908>,<1.76276,-1.94994,5.28231>,r}
+	sphere{<1.76276,-1.94994,5.28231>,r}
+	cylinder{<1.76276,-1.94994,5.28231>,<1.66623,-1.59734,5.56568>,r}
+	sphere{<1.66623,-1.59734,5.56568>,r}
+	cylinder{<1.66623,-1.59734,5.56568>,<1.7006,-1.53566,6>,r}
+	sphere{<1.7006,-1.53566,6>,r}
+	cylinder{<1.7006,-1.53566,6>,<2.1708,-2.77034,6>,r}
+	sphere{<2.1708,-2.77034,6>,r}
+	cylinder{<2.1708,-2.77034,6>,<1.93929,-2.34817,5.46908>,r}
+	sphere{<1.93929,-2.34817,5.46908>,r}
+	texture{t2}
+}
+union{
+	triangle{<-3,0.415767,5.14146>,<-2.43496,0.566177,4.96655>,<-1.84849,0.669822,5.65236>}
+	triangle{<-3,0.415767,5.14146>,<-1.84849,0.669822,5.65236>,<-1.83253,0.65274,6>}
+	triangle{<-3,0.415767,5.14146>,<-1.83253,0.65274,6>,<-3,0.36383,6>}
+	texture{t1}
+}
+union{
+	cylinder{<-3,0.415767,5.14146>,<-2.43496,0.566177,4.96655>,r}
+	sphere{<-2.43496,0.566177,4.96655>,r}
+	cylinder{<-2.43496,0.566177,4.96655>,<-1.84849,0.669822,5.65236>,r}
+	sphere{<-1.84849,0.669822,5.65236>,r}
+	cylinder{<-1.84849,0.669822,5.65236>,<-1.83253,0.65274,6>,r}
+	sphere{<-1.83253,0.65274,6>,r}
+	cylinder{<-1.83253,0.65274,6>,<-3,0.36383,6>,r}
+	sphere{<-3,0.36383,6>,r}
+	cylinder{<-3,0.36383,6>,<-3,0.415767,5.14146>,r}
+	sphere{<-3,0.415767,5.14146>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.198642,-0.872817,4.31541>,<-0.711108,-0.984586,4.70831>,<-0.659755,-0.808938,5.18963>}
+	triangle{<-0.198642,-0.872817,4.31541>,<-0.659755,-0.808938,5.18963>,<-0.075572,-0.603211,4.98972>}
+	triangle{<-0.198642,-0.872817,4.31541>,<-0.075572,-0.603211,4.98972>,<7.23375e-05,-0.743421,4.43554>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.198642,-0.872817,4.31541>,<-0.711108,-0.984586,4.70831>,r}
+	sphere{<-0.711108,-0.984586,4.70831>,r}
+	cylinder{<-0.711108,-0.984586,4.70831>,<-0.659755,-0.808938,5.18963>,r}
+	sphere{<-0.659755,-0.808938,5.18963>,r}
+	cylinder{<-0.659755,-0.808938,5.18963>,<-0.075572,-0.603211,4.98972>,r}
+	sphere{<-0.075572,-0.603211,4.98972>,r}
+	cylinder{<-0.075572,-0.603211,4.98972>,<7.23375e-05,-0.743421,4.43554>,r}
+	sphere{<7.23375e-05,-0.743421,4.43554>,r}
+	cylinder{<7.23375e-05,-0.743421,4.43554>,<-0.198642,-0.872817,4.31541>,r}
+	sphere{<-0.198642,-0.872817,4.31541>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.659755,-0.808938,5.18963>,<-0.711108,-0.984586,4.70831>,<-1.0818,-0.589775,4.21656>}
+	triangle{<-0.659755,-0.808938,5.18963>,<-1.0818,-0.589775,4.21656>,<-1.12766,-0.23004,4.71338>}
+	triangle{<-0.659755,-0.808938,5.18963>,<-1.12766,-0.23004,4.71338>,<-0.889835,-0.376135,5.22119>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.659755,-0.808938,5.18963>,<-0.711108,-0.984586,4.70831>,r}
+	sphere{<-0.711108,-0.984586,4.70831>,r}
+	cylinder{<-0.711108,-0.984586,4.70831>,<-1.0818,-0.589775,4.21656>,r}
+	sphere{<-1.0818,-0.589775,4.21656>,r}
+	cylinder{<-1.0818,-0.589775,4.21656>,<-1.12766,-0.23004,4.71338>,r}
+	sphere{<-1.12766,-0.23004,4.71338>,r}
+	cylinder{<-1.12766,-0.23004,4.71338>,<-0.889835,-0.376135,5.22119>,r}
+	sphere{<-0.889835,-0.376135,5.22119>,r}
+	cylinder{<-0.889835,-0.376135,5.22119>,<-0.659755,-0.808938,5.18963>,r}
+	sphere{<-0.659755,-0.808938,5.18963>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.35204,-0.38761,6>,<-1.55743,-0.624224,6>,<-2.00041,-0.718924,4.73271>}
+	triangle{<-1.35204,-0.38761,6>,<-2.00041,-0.718924,4.73271>,<-1.89854,-0.541773,4.55037>}
+	triangle{<-1.35204,-0.38761,6>,<-1.89854,-0.541773,4.55037>,<-1.4768,-0.172462,4.9057>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.35204,-0.38761,6>,<-1.55743,-0.624224,6>,r}
+	sphere{<-1.55743,-0.624224,6>,r}
+	cylinder{<-1.55743,-0.624224,6>,<-2.00041,-0.718924,4.73271>,r}
+	sphere{<-2.00041,-0.718924,4.73271>,r}
+	cylinder{<-2.00041,-0.718924,4.73271>,<-1.89854,-0.541773,4.55037>,r}
+	sphere{<-1.89854,-0.541773,4.55037>,r}
+	cylinder{<-1.89854,-0.541773,4.55037>,<-1.4768,-0.172462,4.9057>,r}
+	sphere{<-1.4768,-0.172462,4.9057>,r}
+	cylinder{<-1.4768,-0.172462,4.9057>,<-1.35204,-0.38761,6>,r}
+	sphere{<-1.35204,-0.38761,6>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.8247,-1.06727,4.86873>,<1.97719,-0.899895,4.90059>,<2.07269,-0.837408,4.72956>}
+	triangle{<1.8247,-1.06727,4.86873>,<2.07269,-0.837408,4.72956>,<1.91799,-1.06566,4.43356>}
+	triangle{<1.8247,-1.06727,4.86873>,<1.91799,-1.06566,4.43356>,<1.78935,-1.15095,4.65886>}
+	texture{t1}
+}
+union{
+	cylinder{<1.8247,-1.06727,4.86873>,<1.97719,-0.899895,4.90059>,r}
+	sphere{<1.97719,-0.899895,4.90059>,r}
+	cylinder{<1.97719,-0.899895,4.90059>,<2.07269,-0.837408,4.72956>,r}
+	sphere{<2.07269,-0.837408,4.72956>,r}
+	cylinder{<2.07269,-0.837408,4.72956>,<1.91799,-1.06566,4.43356>,r}
+	sphere{<1.91799,-1.06566,4.43356>,r}
+	cylinder{<1.91799,-1.06566,4.43356>,<1.78935,-1.15095,4.65886>,r}
+	sphere{<1.78935,-1.15095,4.65886>,r}
+	cylinder{<1.78935,-1.15095,4.65886>,<1.8247,-1.06727,4.86873>,r}
+	sphere{<1.8247,-1.06727,4.86873>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.8247,-1.06727,4.86873>,<1.207,-0.803018,5.16647>,<1.27963,-0.611727,5.23218>}
+	triangle{<1.8247,-1.06727,4.86873>,<1.27963,-0.611727,5.23218>,<1.83351,-0.478684,5.1328>}
+	triangle{<1.8247,-1.06727,4.86873>,<1.83351,-0.478684,5.1328>,<1.97719,-0.899895,4.90059>}
+	texture{t1}
+}
+union{
+	cylinder{<1.8247,-1.06727,4.86873>,<1.207,-0.803018,5.16647>,r}
+	sphere{<1.207,-0.803018,5.16647>,r}
+	cylinder{<1.207,-0.803018,5.16647>,<1.27963,-0.611727,5.23218>,r}
+	sphere{<1.27963,-0.611727,5.23218>,r}
+	cylinder{<1.27963,-0.611727,5.23218>,<1.83351,-0.478684,5.1328>,r}
+	sphere{<1.83351,-0.478684,5.1328>,r}
+	cylinder{<1.83351,-0.478684,5.1328>,<1.97719,-0.899895,4.90059>,r}
+	sphere{<1.97719,-0.899895,4.90059>,r}
+	cylinder{<1.97719,-0.899895,4.90059>,<1.8247,-1.06727,4.86873>,r}
+	sphere{<1.8247,-1.06727,4.86873>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.97719,-0.899895,4.90059>,<1.83351,-0.478684,5.1328>,<1.96943,-0.00153298,4.87044>}
+	triangle{<1.97719,-0.899895,4.90059>,<1.96943,-0.00153298,4.87044>,<2.13265,-0.208876,4.59343>}
+	triangle{<1.97719,-0.899895,4.90059>,<2.13265,-0.208876,4.59343>,<2.07269,-0.837408,4.72956>}
+	texture{t1}
+}
+union{
+	cylinder{<1.97719,-0.899895,4.90059>,<1.83351,-0.478684,5.1328>,r}
+	sphere{<1.83351,-0.478684,5.1328>,r}
+	cylinder{<1.83351,-0.478684,5.1328>,<1.96943,-0.00153298,4.87044>,r}
+	sphere{<1.96943,-0.00153298,4.87044>,r}
+	cylinder{<1.96943,-0.00153298,4.87044>,<2.13265,-0.208876,4.59343>,r}
+	sphere{<2.13265,-0.208876,4.59343>,r}
+	cylinder{<2.13265,-0.208876,4.59343>,<2.07269,-0.837408,4.72956>,r}
+	sphere{<2.07269,-0.837408,4.72956>,r}
+	cylinder{<2.07269,-0.837408,4.72956>,<1.97719,-0.899895,4.90059>,r}
+	sphere{<1.97719,-0.899895,4.90059>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.91799,-1.06566,4.43356>,<1.91565,-1.06444,4.42693>,<1.51267,-1.13668,4.37853>}
+	triangle{<1.91799,-1.06566,4.43356>,<1.51267,-1.13668,4.37853>,<1.49081,-1.16611,4.47463>}
+	triangle{<1.91799,-1.06566,4.43356>,<1.49081,-1.16611,4.47463>,<1.78935,-1.15095,4.65886>}
+	texture{t1}
+}
+union{
+	cylinder{<1.91799,-1.06566,4.43356>,<1.91565,-1.06444,4.42693>,r}
+	sphere{<1.91565,-1.06444,4.42693>,r}
+	cylinder{<1.91565,-1.06444,4.42693>,<1.51267,-1.13668,4.37853>,r}
+	sphere{<1.51267,-1.13668,4.37853>,r}
+	cylinder{<1.51267,-1.13668,4.37853>,<1.49081,-1.16611,4.47463>,r}
+	sphere{<1.49081,-1.16611,4.47463>,r}
+	cylinder{<1.49081,-1.16611,4.47463>,<1.78935,-1.15095,4.65886>,r}
+	sphere{<1.78935,-1.15095,4.65886>,r}
+	cylinder{<1.78935,-1.15095,4.65886>,<1.91799,-1.06566,4.43356>,r}
+	sphere{<1.91799,-1.06566,4.43356>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.075572,-0.603211,4.98972>,<7.23375e-05,-0.743421,4.43554>,<0.054503,-0.251235,4.32844>}
+	triangle{<-0.075572,-0.603211,4.98972>,<0.054503,-0.251235,4.32844>,<-0.00291725,0.100865,4.86991>}
+	triangle{<-0.075572,-0.603211,4.98972>,<-0.00291725,0.100865,4.86991>,<-0.0100323,0.0824058,4.90647>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.075572,-0.603211,4.98972>,<7.23375e-05,-0.743421,4.43554>,r}
+	sphere{<7.23375e-05,-0.743421,4.43554>,r}
+	cylinder{<7.23375e-05,-0.743421,4.43554>,<0.054503,-0.251235,4.32844>,r}
+	sphere{<0.054503,-0.251235,4.32844>,r}
+	cylinder{<0.054503,-0.251235,4.32844>,<-0.00291725,0.100865,4.86991>,r}
+	sphere{<-0.00291725,0.100865,4.86991>,r}
+	cylinder{<-0.00291725,0.100865,4.86991>,<-0.0100323,0.0824058,4.90647>,r}
+	sphere{<-0.0100323,0.0824058,4.90647>,r}
+	cylinder{<-0.0100323,0.0824058,4.90647>,<-0.075572,-0.603211,4.98972>,r}
+	sphere{<-0.075572,-0.603211,4.98972>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.633798,-1.13415,4.90092>,<0.621245,-1.10414,5.03683>,<0.684872,-1.03791,5.11784>}
+	triangle{<0.633798,-1.13415,4.90092>,<0.684872,-1.03791,5.11784>,<1.03901,-0.815092,5.05466>}
+	triangle{<0.633798,-1.13415,4.90092>,<1.03901,-0.815092,5.05466>,<0.997981,-0.91178,4.81208>}
+	texture{t1}
+}
+union{
+	cylinder{<0.633798,-1.13415,4.90092>,<0.621245,-1.10414,5.03683>,r}
+	sphere{<0.621245,-1.10414,5.03683>,r}
+	cylinder{<0.621245,-1.10414,5.03683>,<0.684872,-1.03791,5.11784>,r}
+	sphere{<0.684872,-1.03791,5.11784>,r}
+	cylinder{<0.684872,-1.03791,5.11784>,<1.03901,-0.815092,5.05466>,r}
+	sphere{<1.03901,-0.815092,5.05466>,r}
+	cylinder{<1.03901,-0.815092,5.05466>,<0.997981,-0.91178,4.81208>,r}
+	sphere{<0.997981,-0.91178,4.81208>,r}
+	cylinder{<0.997981,-0.91178,4.81208>,<0.633798,-1.13415,4.90092>,r}
+	sphere{<0.633798,-1.13415,4.90092>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.394103,-0.16005,5.30771>,<0.378389,0.179721,6>,<0.0543288,-0.882008,6>}
+	triangle{<0.394103,-0.16005,5.30771>,<0.0543288,-0.882008,6>,<0.150866,-0.886717,5.43202>}
+	triangle{<0.394103,-0.16005,5.30771>,<0.150866,-0.886717,5.43202>,<0.213466,-0.770159,5.27536>}
+	texture{t1}
+}
+union{
+	cylinder{<0.394103,-0.16005,5.30771>,<0.378389,0.179721,6>,r}
+	sphere{<0.378389,0.179721,6>,r}
+	cylinder{<0.378389,0.179721,6>,<0.0543288,-0.882008,6>,r}
+	sphere{<0.0543288,-0.882008,6>,r}
+	cylinder{<0.0543288,-0.882008,6>,<0.150866,-0.886717,5.43202>,r}
+	sphere{<0.150866,-0.886717,5.43202>,r}
+	cylinder{<0.150866,-0.886717,5.43202>,<0.213466,-0.770159,5.27536>,r}
+	sphere{<0.213466,-0.770159,5.27536>,r}
+	cylinder{<0.213466,-0.770159,5.27536>,<0.394103,-0.16005,5.30771>,r}
+	sphere{<0.394103,-0.16005,5.30771>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.07269,-0.837408,4.72956>,<1.97719,-0.899895,4.90059>,<2.4774,-1.10006,5.44855>}
+	triangle{<2.07269,-0.837408,4.72956>,<2.4774,-1.10006,5.44855>,<3,-1.13507,5.54442>}
+	triangle{<2.07269,-0.837408,4.72956>,<3,-1.13507,5.54442>,<3,-0.837419,4.72969>}
+	texture{t1}
+}
+union{
+	cylinder{<2.07269,-0.837408,4.72956>,<1.97719,-0.899895,4.90059>,r}
+	sphere{<1.97719,-0.899895,4.90059>,r}
+	cylinder{<1.97719,-0.899895,4.90059>,<2.4774,-1.10006,5.44855>,r}
+	sphere{<2.4774,-1.10006,5.44855>,r}
+	cylinder{<2.4774,-1.10006,5.44855>,<3,-1.13507,5.54442>,r}
+	sphere{<3,-1.13507,5.54442>,r}
+	cylinder{<3,-1.13507,5.54442>,<3,-0.837419,4.72969>,r}
+	sphere{<3,-0.837419,4.72969>,r}
+	cylinder{<3,-0.837419,4.72969>,<2.07269,-0.837408,4.72956>,r}
+	sphere{<2.07269,-0.837408,4.72956>,r}
+	texture{t2}
+}
+union{
+	triangle{<3,-0.174993,6>,<2.24908,-0.260407,6>,<2.18374,-0.236842,5.92565>}
+	triangle{<3,-0.174993,6>,<2.18374,-0.236842,5.92565>,<2.07539,0.121968,5.03544>}
+	triangle{<3,-0.174993,6>,<2.07539,0.121968,5.03544>,<3,0.189505,5.12571>}
+	texture{t1}
+}
+union{
+	cylinder{<3,-0.174993,6>,<2.24908,-0.260407,6>,r}
+	sphere{<2.24908,-0.260407,6>,r}
+	cylinder{<2.24908,-0.260407,6>,<2.18374,-0.236842,5.92565>,r}
+	sphere{<2.18374,-0.236842,5.92565>,r}
+	cylinder{<2.18374,-0.236842,5.92565>,<2.07539,0.121968,5.03544>,r}
+	sphere{<2.07539,0.121968,5.03544>,r}
+	cylinder{<2.07539,0.121968,5.03544>,<3,0.189505,5.12571>,r}
+	sphere{<3,0.189505,5.12571>,r}
+	cylinder{<3,0.189505,5.12571>,<3,-0.174993,6>,r}
+	sphere{<3,-0.174993,6>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.207,-0.803018,5.16647>,<1.27963,-0.611727,5.23218>,<1.38761,-0.440698,6>}
+	triangle{<1.207,-0.803018,5.16647>,<1.38761,-0.440698,6>,<1.11191,-1.20898,6>}
+	triangle{<1.207,-0.803018,5.16647>,<1.11191,-1.20898,6>,<1.09855,-1.19019,5.66877>}
+	texture{t1}
+}
+union{
+	cylinder{<1.207,-0.803018,5.16647>,<1.27963,-0.611727,5.23218>,r}
+	sphere{<1.27963,-0.611727,5.23218>,r}
+	cylinder{<1.27963,-0.611727,5.23218>,<1.38761,-0.440698,6>,r}
+	sphere{<1.38761,-0.440698,6>,r}
+	cylinder{<1.38761,-0.440698,6>,<1.11191,-1.20898,6>,r}
+	sphere{<1.11191,-1.20898,6>,r}
+	cylinder{<1.11191,-1.20898,6>,<1.09855,-1.19019,5.66877>,r}
+	sphere{<1.09855,-1.19019,5.66877>,r}
+	cylinder{<1.09855,-1.19019,5.66877>,<1.207,-0.803018,5.16647>,r}
+	sphere{<1.207,-0.803018,5.16647>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.70375,-0.907305,6>,<2.4774,-1.10006,5.44855>,<1.92525,-1.46953,5.19314>}
+	triangle{<2.70375,-0.907305,6>,<1.92525,-1.46953,5.19314>,<1.66623,-1.59734,5.56568>}
+	triangle{<2.70375,-0.907305,6>,<1.66623,-1.59734,5.56568>,<1.7006,-1.53566,6>}
+	texture{t1}
+}
+union{
+	cylinder{<2.70375,-0.907305,6>,<2.4774,-1.10006,5.44855>,r}
+	sphere{<2.4774,-1.10006,5.44855>,r}
+	cylinder{<2.4774,-1.10006,5.44855>,<1.92525,-1.46953,5.19314>,r}
+	sphere{<1.92525,-1.46953,5.19314>,r}
+	cylinder{<1.92525,-1.46953,5.19314>,<1.66623,-1.59734,5.56568>,r}
+	sphere{<1.66623,-1.59734,5.56568>,r}
+	cylinder{<1.66623,-1.59734,5.56568>,<1.7006,-1.53566,6>,r}
+	sphere{<1.7006,-1.53566,6>,r}
+	cylinder{<1.7006,-1.53566,6>,<2.70375,-0.907305,6>,r}
+	sphere{<2.70375,-0.907305,6>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.71391,0.863319,5.66186>,<-1.16699,0.874638,4.71464>,<-1.25603,0.525431,4.42703>}
+	triangle{<-1.71391,0.863319,5.66186>,<-1.25603,0.525431,4.42703>,<-1.67653,0.255845,4.82346>}
+	triangle{<-1.71391,0.863319,5.66186>,<-1.67653,0.255845,4.82346>,<-1.84849,0.669822,5.65236>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.71391,0.863319,5.66186>,<-1.16699,0.874638,4.71464>,r}
+	sphere{<-1.16699,0.874638,4.71464>,r}
+	cylinder{<-1.16699,0.874638,4.71464>,<-1.25603,0.525431,4.42703>,r}
+	sphere{<-1.25603,0.525431,4.42703>,r}
+	cylinder{<-1.25603,0.525431,4.42703>,<-1.67653,0.255845,4.82346>,r}
+	sphere{<-1.67653,0.255845,4.82346>,r}
+	cylinder{<-1.67653,0.255845,4.82346>,<-1.84849,0.669822,5.65236>,r}
+	sphere{<-1.84849,0.669822,5.65236>,r}
+	cylinder{<-1.84849,0.669822,5.65236>,<-1.71391,0.863319,5.66186>,r}
+	sphere{<-1.71391,0.863319,5.66186>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.88922,1.47328,4.33958>,<-1.46745,1.43947,4.33472>,<-1.34972,1.39141,4.54228>}
+	triangle{<-1.88922,1.47328,4.33958>,<-1.34972,1.39141,4.54228>,<-1.72333,1.28549,5.28154>}
+	triangle{<-1.88922,1.47328,4.33958>,<-1.72333,1.28549,5.28154>,<-2.10474,1.43413,4.64727>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.88922,1.47328,4.33958>,<-1.46745,1.43947,4.33472>,r}
+	sphere{<-1.46745,1.43947,4.33472>,r}
+	cylinder{<-1.46745,1.43947,4.33472>,<-1.34972,1.39141,4.54228>,r}
+	sphere{<-1.34972,1.39141,4.54228>,r}
+	cylinder{<-1.34972,1.39141,4.54228>,<-1.72333,1.28549,5.28154>,r}
+	sphere{<-1.72333,1.28549,5.28154>,r}
+	cylinder{<-1.72333,1.28549,5.28154>,<-2.10474,1.43413,4.64727>,r}
+	sphere{<-2.10474,1.43413,4.64727>,r}
+	cylinder{<-2.10474,1.43413,4.64727>,<-1.88922,1.47328,4.33958>,r}
+	sphere{<-1.88922,1.47328,4.33958>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.34249,0.800614,6>,<-0.575069,1.61062,6>,<-0.237008,1.10823,4.91327>}
+	triangle{<-1.34249,0.800614,6>,<-0.237008,1.10823,4.91327>,<-0.31878,0.889703,4.74604>}
+	triangle{<-1.34249,0.800614,6>,<-0.31878,0.889703,4.74604>,<-0.428647,0.794102,4.7718>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.34249,0.800614,6>,<-0.575069,1.61062,6>,r}
+	sphere{<-0.575069,1.61062,6>,r}
+	cylinder{<-0.575069,1.61062,6>,<-0.237008,1.10823,4.91327>,r}
+	sphere{<-0.237008,1.10823,4.91327>,r}
+	cylinder{<-0.237008,1.10823,4.91327>,<-0.31878,0.889703,4.74604>,r}
+	sphere{<-0.31878,0.889703,4.74604>,r}
+	cylinder{<-0.31878,0.889703,4.74604>,<-0.428647,0.794102,4.7718>,r}
+	sphere{<-0.428647,0.794102,4.7718>,r}
+	cylinder{<-0.428647,0.794102,4.7718>,<-1.34249,0.800614,6>,r}
+	sphere{<-1.34249,0.800614,6>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.34249,0.800614,6>,<-0.428647,0.794102,4.7718>,<-1.16699,0.874638,4.71464>}
+	triangle{<-1.34249,0.800614,6>,<-1.16699,0.874638,4.71464>,<-1.71391,0.863319,5.66186>}
+	triangle{<-1.34249,0.800614,6>,<-1.71391,0.863319,5.66186>,<-1.70435,0.838076,6>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.34249,0.800614,6>,<-0.428647,0.794102,4.7718>,r}
+	sphere{<-0.428647,0.794102,4.7718>,r}
+	cylinder{<-0.428647,0.794102,4.7718>,<-1.16699,0.874638,4.71464>,r}
+	sphere{<-1.16699,0.874638,4.71464>,r}
+	cylinder{<-1.16699,0.874638,4.71464>,<-1.71391,0.863319,5.66186>,r}
+	sphere{<-1.71391,0.863319,5.66186>,r}
+	cylinder{<-1.71391,0.863319,5.66186>,<-1.70435,0.838076,6>,r}
+	sphere{<-1.70435,0.838076,6>,r}
+	cylinder{<-1.70435,0.838076,6>,<-1.34249,0.800614,6>,r}
+	sphere{<-1.34249,0.800614,6>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.889835,-0.376135,5.22119>,<-1.12766,-0.23004,4.71338>,<-1.4768,-0.172462,4.9057>}
+	triangle{<-0.889835,-0.376135,5.22119>,<-1.4768,-0.172462,4.9057>,<-1.35204,-0.38761,6>}
+	triangle{<-0.889835,-0.376135,5.22119>,<-1.35204,-0.38761,6>,<-1.34818,-0.388602,6>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.889835,-0.376135,5.22119>,<-1.12766,-0.23004,4.71338>,r}
+	sphere{<-1.12766,-0.23004,4.71338>,r}
+	cylinder{<-1.12766,-0.23004,4.71338>,<-1.4768,-0.172462,4.9057>,r}
+	sphere{<-1.4768,-0.172462,4.9057>,r}
+	cylinder{<-1.4768,-0.172462,4.9057>,<-1.35204,-0.38761,6>,r}
+	sphere{<-1.35204,-0.38761,6>,r}
+	cylinder{<-1.35204,-0.38761,6>,<-1.34818,-0.388602,6>,r}
+	sphere{<-1.34818,-0.388602,6>,r}
+	cylinder{<-1.34818,-0.388602,6>,<-0.889835,-0.376135,5.22119>,r}
+	sphere{<-0.889835,-0.376135,5.22119>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.84849,0.669822,5.65236>,<-1.83253,0.65274,6>,<-1.35204,-0.38761,6>}
+	triangle{<-1.84849,0.669822,5.65236>,<-1.35204,-0.38761,6>,<-1.4768,-0.172462,4.9057>}
+	triangle{<-1.84849,0.669822,5.65236>,<-1.4768,-0.172462,4.9057>,<-1.67653,0.255845,4.82346>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.84849,0.669822,5.65236>,<-1.83253,0.65274,6>,r}
+	sphere{<-1.83253,0.65274,6>,r}
+	cylinder{<-1.83253,0.65274,6>,<-1.35204,-0.38761,6>,r}
+	sphere{<-1.35204,-0.38761,6>,r}
+	cylinder{<-1.35204,-0.38761,6>,<-1.4768,-0.172462,4.9057>,r}
+	sphere{<-1.4768,-0.172462,4.9057>,r}
+	cylinder{<-1.4768,-0.172462,4.9057>,<-1.67653,0.255845,4.82346>,r}
+	sphere{<-1.67653,0.255845,4.82346>,r}
+	cylinder{<-1.67653,0.255845,4.82346>,<-1.84849,0.669822,5.65236>,r}
+	sphere{<-1.84849,0.669822,5.65236>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.47896,1.36572,6>,<0.874884,0.849857,6>,<0.728918,1.12586,5.18322>}
+	triangle{<1.47896,1.36572,6>,<0.728918,1.12586,5.18322>,<1.03619,1.53679,4.88043>}
+	triangle{<1.47896,1.36572,6>,<1.03619,1.53679,4.88043>,<1.27646,1.64755,5.07292>}
+	texture{t1}
+}
+union{
+	cylinder{<1.47896,1.36572,6>,<0.874884,0.849857,6>,r}
+	sphere{<0.874884,0.849857,6>,r}
+	cylinder{<0.874884,0.849857,6>,<0.728918,1.12586,5.18322>,r}
+	sphere{<0.728918,1.12586,5.18322>,r}
+	cylinder{<0.728918,1.12586,5.18322>,<1.03619,1.53679,4.88043>,r}
+	sphere{<1.03619,1.53679,4.88043>,r}
+	cylinder{<1.03619,1.53679,4.88043>,<1.27646,1.64755,5.07292>,r}
+	sphere{<1.27646,1.64755,5.07292>,r}
+	cylinder{<1.27646,1.64755,5.07292>,<1.47896,1.36572,6>,r}
+	sphere{<1.47896,1.36572,6>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.47896,1.36572,6>,<1.27646,1.64755,5.07292>,<1.87136,1.43663,5.1013>}
+	triangle{<1.47896,1.36572,6>,<1.87136,1.43663,5.1013>,<2.05946,1.24382,5.66114>}
+	triangle{<1.47896,1.36572,6>,<2.05946,1.24382,5.66114>,<1.93374,1.20945,6>}
+	texture{t1}
+}
+union{
+	cylinder{<1.47896,1.36572,6>,<1.27646,1.64755,5.07292>,r}
+	sphere{<1.27646,1.64755,5.07292>,r}
+	cylinder{<1.27646,1.64755,5.07292>,<1.87136,1.43663,5.1013>,r}
+	sphere{<1.87136,1.43663,5.1013>,r}
+	cylinder{<1.87136,1.43663,5.1013>,<2.05946,1.24382,5.66114>,r}
+	sphere{<2.05946,1.24382,5.66114>,r}
+	cylinder{<2.05946,1.24382,5.66114>,<1.93374,1.20945,6>,r}
+	sphere{<1.93374,1.20945,6>,r}
+	cylinder{<1.93374,1.20945,6>,<1.47896,1.36572,6>,r}
+	sphere{<1.47896,1.36572,6>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.93374,1.20945,6>,<2.05946,1.24382,5.66114>,<2.03954,0.752699,4.96245>}
+	triangle{<1.93374,1.20945,6>,<2.03954,0.752699,4.96245>,<1.8932,0.468255,4.9782>}
+	triangle{<1.93374,1.20945,6>,<1.8932,0.468255,4.9782>,<1.67494,0.688437,6>}
+	texture{t1}
+}
+union{
+	cylinder{<1.93374,1.20945,6>,<2.05946,1.24382,5.66114>,r}
+	sphere{<2.05946,1.24382,5.66114>,r}
+	cylinder{<2.05946,1.24382,5.66114>,<2.03954,0.752699,4.96245>,r}
+	sphere{<2.03954,0.752699,4.96245>,r}
+	cylinder{<2.03954,0.752699,4.96245>,<1.8932,0.468255,4.9782>,r}
+	sphere{<1.8932,0.468255,4.9782>,r}
+	cylinder{<1.8932,0.468255,4.9782>,<1.67494,0.688437,6>,r}
+	sphere{<1.67494,0.688437,6>,r}
+	cylinder{<1.67494,0.688437,6>,<1.93374,1.20945,6>,r}
+	sphere{<1.93374,1.20945,6>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.22669,0.354611,4.82952>,<1.02442,0.612412,6>,<1.67494,0.688437,6>}
+	triangle{<1.22669,0.354611,4.82952>,<1.67494,0.688437,6>,<1.8932,0.468255,4.9782>}
+	triangle{<1.22669,0.354611,4.82952>,<1.8932,0.468255,4.9782>,<1.71027,0.391698,4.74873>}
+	texture{t1}
+}
+union{
+	cylinder{<1.22669,0.354611,4.82952>,<1.02442,0.612412,6>,r}
+	sphere{<1.02442,0.612412,6>,r}
+	cylinder{<1.02442,0.612412,6>,<1.67494,0.688437,6>,r}
+	sphere{<1.67494,0.688437,6>,r}
+	cylinder{<1.67494,0.688437,6>,<1.8932,0.468255,4.9782>,r}
+	sphere{<1.8932,0.468255,4.9782>,r}
+	cylinder{<1.8932,0.468255,4.9782>,<1.71027,0.391698,4.74873>,r}
+	sphere{<1.71027,0.391698,4.74873>,r}
+	cylinder{<1.71027,0.391698,4.74873>,<1.22669,0.354611,4.82952>,r}
+	sphere{<1.22669,0.354611,4.82952>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.22669,0.354611,4.82952>,<0.936083,0.819302,4.76962>,<0.728918,1.12586,5.18322>}
+	triangle{<1.22669,0.354611,4.82952>,<0.728918,1.12586,5.18322>,<0.874884,0.849857,6>}
+	triangle{<1.22669,0.354611,4.82952>,<0.874884,0.849857,6>,<1.02442,0.612412,6>}
+	texture{t1}
+}
+union{
+	cylinder{<1.22669,0.354611,4.82952>,<0.936083,0.819302,4.76962>,r}
+	sphere{<0.936083,0.819302,4.76962>,r}
+	cylinder{<0.936083,0.819302,4.76962>,<0.728918,1.12586,5.18322>,r}
+	sphere{<0.728918,1.12586,5.18322>,r}
+	cylinder{<0.728918,1.12586,5.18322>,<0.874884,0.849857,6>,r}
+	sphere{<0.874884,0.849857,6>,r}
+	cylinder{<0.874884,0.849857,6>,<1.02442,0.612412,6>,r}
+	sphere{<1.02442,0.612412,6>,r}
+	cylinder{<1.02442,0.612412,6>,<1.22669,0.354611,4.82952>,r}
+	sphere{<1.22669,0.354611,4.82952>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.728918,1.12586,5.18322>,<0.273936,1.17023,5.32267>,<0.586682,1.85073,4.8904>}
+	triangle{<0.728918,1.12586,5.18322>,<0.586682,1.85073,4.8904>,<0.962717,1.74407,4.80826>}
+	triangle{<0.728918,1.12586,5.18322>,<0.962717,1.74407,4.80826>,<1.03619,1.53679,4.88043>}
+	texture{t1}
+}
+union{
+	cylinder{<0.728918,1.12586,5.18322>,<0.273936,1.17023,5.32267>,r}
+	sphere{<0.273936,1.17023,5.32267>,r}
+	cylinder{<0.273936,1.17023,5.32267>,<0.586682,1.85073,4.8904>,r}
+	sphere{<0.586682,1.85073,4.8904>,r}
+	cylinder{<0.586682,1.85073,4.8904>,<0.962717,1.74407,4.80826>,r}
+	sphere{<0.962717,1.74407,4.80826>,r}
+	cylinder{<0.962717,1.74407,4.80826>,<1.03619,1.53679,4.88043>,r}
+	sphere{<1.03619,1.53679,4.88043>,r}
+	cylinder{<1.03619,1.53679,4.88043>,<0.728918,1.12586,5.18322>,r}
+	sphere{<0.728918,1.12586,5.18322>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.237008,1.10823,4.91327>,<0.272409,1.16948,5.32205>,<-0.0858316,0.716035,4.83477>}
+	triangle{<-0.237008,1.10823,4.91327>,<-0.0858316,0.716035,4.83477>,<-0.305498,0.833881,4.72874>}
+	triangle{<-0.237008,1.10823,4.91327>,<-0.305498,0.833881,4.72874>,<-0.31878,0.889703,4.74604>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.237008,1.10823,4.91327>,<0.272409,1.16948,5.32205>,r}
+	sphere{<0.272409,1.16948,5.32205>,r}
+	cylinder{<0.272409,1.16948,5.32205>,<-0.0858316,0.716035,4.83477>,r}
+	sphere{<-0.0858316,0.716035,4.83477>,r}
+	cylinder{<-0.0858316,0.716035,4.83477>,<-0.305498,0.833881,4.72874>,r}
+	sphere{<-0.305498,0.833881,4.72874>,r}
+	cylinder{<-0.305498,0.833881,4.72874>,<-0.31878,0.889703,4.74604>,r}
+	sphere{<-0.31878,0.889703,4.74604>,r}
+	cylinder{<-0.31878,0.889703,4.74604>,<-0.237008,1.10823,4.91327>,r}
+	sphere{<-0.237008,1.10823,4.91327>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.273936,1.17023,5.32267>,<0.728918,1.12586,5.18322>,<0.874884,0.849857,6>}
+	triangle{<0.273936,1.17023,5.32267>,<0.874884,0.849857,6>,<0.499845,0.921353,6>}
+	triangle{<0.273936,1.17023,5.32267>,<0.499845,0.921353,6>,<0.273356,1.16999,5.3238>}
+	texture{t1}
+}
+union{
+	cylinder{<0.273936,1.17023,5.32267>,<0.728918,1.12586,5.18322>,r}
+	sphere{<0.728918,1.12586,5.18322>,r}
+	cylinder{<0.728918,1.12586,5.18322>,<0.874884,0.849857,6>,r}
+	sphere{<0.874884,0.849857,6>,r}
+	cylinder{<0.874884,0.849857,6>,<0.499845,0.921353,6>,r}
+	sphere{<0.499845,0.921353,6>,r}
+	cylinder{<0.499845,0.921353,6>,<0.273356,1.16999,5.3238>,r}
+	sphere{<0.273356,1.16999,5.3238>,r}
+	cylinder{<0.273356,1.16999,5.3238>,<0.273936,1.17023,5.32267>,r}
+	sphere{<0.273936,1.17023,5.32267>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.0100323,0.0824058,4.90647>,<-0.175048,0.273533,4.94006>,<0.297666,0.265549,6>}
+	triangle{<-0.0100323,0.0824058,4.90647>,<0.297666,0.265549,6>,<0.378389,0.179721,6>}
+	triangle{<-0.0100323,0.0824058,4.90647>,<0.378389,0.179721,6>,<0.394103,-0.16005,5.30771>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.0100323,0.0824058,4.90647>,<-0.175048,0.273533,4.94006>,r}
+	sphere{<-0.175048,0.273533,4.94006>,r}
+	cylinder{<-0.175048,0.273533,4.94006>,<0.297666,0.265549,6>,r}
+	sphere{<0.297666,0.265549,6>,r}
+	cylinder{<0.297666,0.265549,6>,<0.378389,0.179721,6>,r}
+	sphere{<0.378389,0.179721,6>,r}
+	cylinder{<0.378389,0.179721,6>,<0.394103,-0.16005,5.30771>,r}
+	sphere{<0.394103,-0.16005,5.30771>,r}
+	cylinder{<0.394103,-0.16005,5.30771>,<-0.0100323,0.0824058,4.90647>,r}
+	sphere{<-0.0100323,0.0824058,4.90647>,r}
+	texture{t2}
+}
+union{
+	triangle{<3,0.189505,5.12571>,<3,-0.208826,4.59354>,<2.13265,-0.208876,4.59343>}
+	triangle{<3,0.189505,5.12571>,<2.13265,-0.208876,4.59343>,<1.96943,-0.00153298,4.87044>}
+	triangle{<3,0.189505,5.12571>,<1.96943,-0.00153298,4.87044>,<2.07539,0.121968,5.03544>}
+	texture{t1}
+}
+union{
+	cylinder{<3,0.189505,5.12571>,<3,-0.208826,4.59354>,r}
+	sphere{<3,-0.208826,4.59354>,r}
+	cylinder{<3,-0.208826,4.59354>,<2.13265,-0.208876,4.59343>,r}
+	sphere{<2.13265,-0.208876,4.59343>,r}
+	cylinder{<2.13265,-0.208876,4.59343>,<1.96943,-0.00153298,4.87044>,r}
+	sphere{<1.96943,-0.00153298,4.87044>,r}
+	cylinder{<1.96943,-0.00153298,4.87044>,<2.07539,0.121968,5.03544>,r}
+	sphere{<2.07539,0.121968,5.03544>,r}
+	cylinder{<2.07539,0.121968,5.03544>,<3,0.189505,5.12571>,r}
+	sphere{<3,0.189505,5.12571>,r}
+	texture{t2}
+}
+union{
+	triangle{<3,0.189505,5.12571>,<2.07539,0.121968,5.03544>,<1.8932,0.468255,4.9782>}
+	triangle{<3,0.189505,5.12571>,<1.8932,0.468255,4.9782>,<2.03954,0.752699,4.96245>}
+	triangle{<3,0.189505,5.12571>,<2.03954,0.752699,4.96245>,<3,0.704493,5.06921>}
+	texture{t1}
+}
+union{
+	cylinder{<3,0.189505,5.12571>,<2.07539,0.121968,5.03544>,r}
+	sphere{<2.07539,0.121968,5.03544>,r}
+	cylinder{<2.07539,0.121968,5.03544>,<1.8932,0.468255,4.9782>,r}
+	sphere{<1.8932,0.468255,4.9782>,r}
+	cylinder{<1.8932,0.468255,4.9782>,<2.03954,0.752699,4.96245>,r}
+	sphere{<2.03954,0.752699,4.96245>,r}
+	cylinder{<2.03954,0.752699,4.96245>,<3,0.704493,5.06921>,r}
+	sphere{<3,0.704493,5.06921>,r}
+	cylinder{<3,0.704493,5.06921>,<3,0.189505,5.12571>,r}
+	sphere{<3,0.189505,5.12571>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.93624,0.91669,4.59839>,<3,1.07553,4.24545>,<3,0.704493,5.06921>}
+	triangle{<1.93624,0.91669,4.59839>,<3,0.704493,5.06921>,<2.03954,0.752699,4.96245>}
+	triangle{<1.93624,0.91669,4.59839>,<2.03954,0.752699,4.96245>,<1.91607,0.904189,4.62615>}
+	texture{t1}
+}
+union{
+	cylinder{<1.93624,0.91669,4.59839>,<3,1.07553,4.24545>,r}
+	sphere{<3,1.07553,4.24545>,r}
+	cylinder{<3,1.07553,4.24545>,<3,0.704493,5.06921>,r}
+	sphere{<3,0.704493,5.06921>,r}
+	cylinder{<3,0.704493,5.06921>,<2.03954,0.752699,4.96245>,r}
+	sphere{<2.03954,0.752699,4.96245>,r}
+	cylinder{<2.03954,0.752699,4.96245>,<1.91607,0.904189,4.62615>,r}
+	sphere{<1.91607,0.904189,4.62615>,r}
+	cylinder{<1.91607,0.904189,4.62615>,<1.93624,0.91669,4.59839>,r}
+	sphere{<1.93624,0.91669,4.59839>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.07539,0.121968,5.03544>,<1.96943,-0.00153298,4.87044>,<1.70096,0.322539,4.71059>}
+	triangle{<2.07539,0.121968,5.03544>,<1.70096,0.322539,4.71059>,<1.71027,0.391698,4.74873>}
+	triangle{<2.07539,0.121968,5.03544>,<1.71027,0.391698,4.74873>,<1.8932,0.468255,4.9782>}
+	texture{t1}
+}
+union{
+	cylinder{<2.07539,0.121968,5.03544>,<1.96943,-0.00153298,4.87044>,r}
+	sphere{<1.96943,-0.00153298,4.87044>,r}
+	cylinder{<1.96943,-0.00153298,4.87044>,<1.70096,0.322539,4.71059>,r}
+	sphere{<1.70096,0.322539,4.71059>,r}
+	cylinder{<1.70096,0.322539,4.71059>,<1.71027,0.391698,4.74873>,r}
+	sphere{<1.71027,0.391698,4.74873>,r}
+	cylinder{<1.71027,0.391698,4.74873>,<1.8932,0.468255,4.9782>,r}
+	sphere{<1.8932,0.468255,4.9782>,r}
+	cylinder{<1.8932,0.468255,4.9782>,<2.07539,0.121968,5.03544>,r}
+	sphere{<2.07539,0.121968,5.03544>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.70096,0.322539,4.71059>,<1.96943,-0.00153298,4.87044>,<2.13265,-0.208876,4.59343>}
+	triangle{<1.70096,0.322539,4.71059>,<2.13265,-0.208876,4.59343>,<2.08445,-0.154057,4.44271>}
+	triangle{<1.70096,0.322539,4.71059>,<2.08445,-0.154057,4.44271>,<1.73397,0.277774,4.55204>}
+	texture{t1}
+}
+union{
+	cylinder{<1.70096,0.322539,4.71059>,<1.96943,-0.00153298,4.87044>,r}
+	sphere{<1.96943,-0.00153298,4.87044>,r}
+	cylinder{<1.96943,-0.00153298,4.87044>,<2.13265,-0.208876,4.59343>,r}
+	sphere{<2.13265,-0.208876,4.59343>,r}
+	cylinder{<2.13265,-0.208876,4.59343>,<2.08445,-0.154057,4.44271>,r}
+	sphere{<2.08445,-0.154057,4.44271>,r}
+	cylinder{<2.08445,-0.154057,4.44271>,<1.73397,0.277774,4.55204>,r}
+	sphere{<1.73397,0.277774,4.55204>,r}
+	cylinder{<1.73397,0.277774,4.55204>,<1.70096,0.322539,4.71059>,r}
+	sphere{<1.70096,0.322539,4.71059>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.8932,0.468255,4.9782>,<1.71027,0.391698,4.74873>,<1.89902,0.892433,4.60889>}
+	triangle{<1.8932,0.468255,4.9782>,<1.89902,0.892433,4.60889>,<1.91607,0.904189,4.62615>}
+	triangle{<1.8932,0.468255,4.9782>,<1.91607,0.904189,4.62615>,<2.03954,0.752699,4.96245>}
+	texture{t1}
+}
+union{
+	cylinder{<1.8932,0.468255,4.9782>,<1.71027,0.391698,4.74873>,r}
+	sphere{<1.71027,0.391698,4.74873>,r}
+	cylinder{<1.71027,0.391698,4.74873>,<1.89902,0.892433,4.60889>,r}
+	sphere{<1.89902,0.892433,4.60889>,r}
+	cylinder{<1.89902,0.892433,4.60889>,<1.91607,0.904189,4.62615>,r}
+	sphere{<1.91607,0.904189,4.62615>,r}
+	cylinder{<1.91607,0.904189,4.62615>,<2.03954,0.752699,4.96245>,r}
+	sphere{<2.03954,0.752699,4.96245>,r}
+	cylinder{<2.03954,0.752699,4.96245>,<1.8932,0.468255,4.9782>,r}
+	sphere{<1.8932,0.468255,4.9782>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.03954,0.752699,4.96245>,<2.05946,1.24382,5.66114>,<2.44879,1.43315,6>}
+	triangle{<2.03954,0.752699,4.96245>,<2.44879,1.43315,6>,<3,1.36219,6>}
+	triangle{<2.03954,0.752699,4.96245>,<3,1.36219,6>,<3,0.704493,5.06921>}
+	texture{t1}
+}
+union{
+	cylinder{<2.03954,0.752699,4.96245>,<2.05946,1.24382,5.66114>,r}
+	sphere{<2.05946,1.24382,5.66114>,r}
+	cylinder{<2.05946,1.24382,5.66114>,<2.44879,1.43315,6>,r}
+	sphere{<2.44879,1.43315,6>,r}
+	cylinder{<2.44879,1.43315,6>,<3,1.36219,6>,r}
+	sphere{<3,1.36219,6>,r}
+	cylinder{<3,1.36219,6>,<3,0.704493,5.06921>,r}
+	sphere{<3,0.704493,5.06921>,r}
+	cylinder{<3,0.704493,5.06921>,<2.03954,0.752699,4.96245>,r}
+	sphere{<2.03954,0.752699,4.96245>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.67494,0.688437,6>,<1.8932,0.468255,4.9782>,<2.07539,0.121968,5.03544>}
+	triangle{<1.67494,0.688437,6>,<2.07539,0.121968,5.03544>,<2.18374,-0.236842,5.92565>}
+	triangle{<1.67494,0.688437,6>,<2.18374,-0.236842,5.92565>,<2.171,-0.226619,6>}
+	texture{t1}
+}
+union{
+	cylinder{<1.67494,0.688437,6>,<1.8932,0.468255,4.9782>,r}
+	sphere{<1.8932,0.468255,4.9782>,r}
+	cylinder{<1.8932,0.468255,4.9782>,<2.07539,0.121968,5.03544>,r}
+	sphere{<2.07539,0.121968,5.03544>,r}
+	cylinder{<2.07539,0.121968,5.03544>,<2.18374,-0.236842,5.92565>,r}
+	sphere{<2.18374,-0.236842,5.92565>,r}
+	cylinder{<2.18374,-0.236842,5.92565>,<2.171,-0.226619,6>,r}
+	sphere{<2.171,-0.226619,6>,r}
+	cylinder{<2.171,-0.226619,6>,<1.67494,0.688437,6>,r}
+	sphere{<1.67494,0.688437,6>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.38761,-0.440698,6>,<1.27963,-0.611727,5.23218>,<1.05716,-0.360622,5.10905>}
+	triangle{<1.38761,-0.440698,6>,<1.05716,-0.360622,5.10905>,<0.91111,-0.134442,5.17648>}
+	triangle{<1.38761,-0.440698,6>,<0.91111,-0.134442,5.17648>,<0.867542,0.265375,6>}
+	texture{t1}
+}
+union{
+	cylinder{<1.38761,-0.440698,6>,<1.27963,-0.611727,5.23218>,r}
+	sphere{<1.27963,-0.611727,5.23218>,r}
+	cylinder{<1.27963,-0.611727,5.23218>,<1.05716,-0.360622,5.10905>,r}
+	sphere{<1.05716,-0.360622,5.10905>,r}
+	cylinder{<1.05716,-0.360622,5.10905>,<0.91111,-0.134442,5.17648>,r}
+	sphere{<0.91111,-0.134442,5.17648>,r}
+	cylinder{<0.91111,-0.134442,5.17648>,<0.867542,0.265375,6>,r}
+	sphere{<0.867542,0.265375,6>,r}
+	cylinder{<0.867542,0.265375,6>,<1.38761,-0.440698,6>,r}
+	sphere{<1.38761,-0.440698,6>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.38761,-0.440698,6>,<2.171,-0.226619,6>,<2.18374,-0.236842,5.92565>}
+	triangle{<1.38761,-0.440698,6>,<2.18374,-0.236842,5.92565>,<1.83351,-0.478684,5.1328>}
+	triangle{<1.38761,-0.440698,6>,<1.83351,-0.478684,5.1328>,<1.27963,-0.611727,5.23218>}
+	texture{t1}
+}
+union{
+	cylinder{<1.38761,-0.440698,6>,<2.171,-0.226619,6>,r}
+	sphere{<2.171,-0.226619,6>,r}
+	cylinder{<2.171,-0.226619,6>,<2.18374,-0.236842,5.92565>,r}
+	sphere{<2.18374,-0.236842,5.92565>,r}
+	cylinder{<2.18374,-0.236842,5.92565>,<1.83351,-0.478684,5.1328>,r}
+	sphere{<1.83351,-0.478684,5.1328>,r}
+	cylinder{<1.83351,-0.478684,5.1328>,<1.27963,-0.611727,5.23218>,r}
+	sphere{<1.27963,-0.611727,5.23218>,r}
+	cylinder{<1.27963,-0.611727,5.23218>,<1.38761,-0.440698,6>,r}
+	sphere{<1.38761,-0.440698,6>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.70153,1.67442,6>,<-1.72333,1.28549,5.28154>,<-2.10474,1.43413,4.64727>}
+	triangle{<-1.70153,1.67442,6>,<-2.10474,1.43413,4.64727>,<-2.96979,3,5.31797>}
+	triangle{<-1.70153,1.67442,6>,<-2.96979,3,5.31797>,<-2.67732,3,6>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.70153,1.67442,6>,<-1.72333,1.28549,5.28154>,r}
+	sphere{<-1.72333,1.28549,5.28154>,r}
+	cylinder{<-1.72333,1.28549,5.28154>,<-2.10474,1.43413,4.64727>,r}
+	sphere{<-2.10474,1.43413,4.64727>,r}
+	cylinder{<-2.10474,1.43413,4.64727>,<-2.96979,3,5.31797>,r}
+	sphere{<-2.96979,3,5.31797>,r}
+	cylinder{<-2.96979,3,5.31797>,<-2.67732,3,6>,r}
+	sphere{<-2.67732,3,6>,r}
+	cylinder{<-2.67732,3,6>,<-1.70153,1.67442,6>,r}
+	sphere{<-1.70153,1.67442,6>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.08725,1.93259,4.95169>,<-1.60837,1.79347,6>,<-2.62095,3,6>}
+	triangle{<-1.08725,1.93259,4.95169>,<-2.62095,3,6>,<-1.97117,3,4.93213>}
+	triangle{<-1.08725,1.93259,4.95169>,<-1.97117,3,4.93213>,<-1.29451,2.42382,4.61477>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.08725,1.93259,4.95169>,<-1.60837,1.79347,6>,r}
+	sphere{<-1.60837,1.79347,6>,r}
+	cylinder{<-1.60837,1.79347,6>,<-2.62095,3,6>,r}
+	sphere{<-2.62095,3,6>,r}
+	cylinder{<-2.62095,3,6>,<-1.97117,3,4.93213>,r}
+	sphere{<-1.97117,3,4.93213>,r}
+	cylinder{<-1.97117,3,4.93213>,<-1.29451,2.42382,4.61477>,r}
+	sphere{<-1.29451,2.42382,4.61477>,r}
+	cylinder{<-1.29451,2.42382,4.61477>,<-1.08725,1.93259,4.95169>,r}
+	sphere{<-1.08725,1.93259,4.95169>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.237008,1.10823,4.91327>,<-0.575069,1.61062,6>,<-0.00158112,1.49555,6>}
+	triangle{<-0.237008,1.10823,4.91327>,<-0.00158112,1.49555,6>,<0.273356,1.16999,5.3238>}
+	triangle{<-0.237008,1.10823,4.91327>,<0.273356,1.16999,5.3238>,<0.272409,1.16948,5.32205>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.237008,1.10823,4.91327>,<-0.575069,1.61062,6>,r}
+	sphere{<-0.575069,1.61062,6>,r}
+	cylinder{<-0.575069,1.61062,6>,<-0.00158112,1.49555,6>,r}
+	sphere{<-0.00158112,1.49555,6>,r}
+	cylinder{<-0.00158112,1.49555,6>,<0.273356,1.16999,5.3238>,r}
+	sphere{<0.273356,1.16999,5.3238>,r}
+	cylinder{<0.273356,1.16999,5.3238>,<0.272409,1.16948,5.32205>,r}
+	sphere{<0.272409,1.16948,5.32205>,r}
+	cylinder{<0.272409,1.16948,5.32205>,<-0.237008,1.10823,4.91327>,r}
+	sphere{<-0.237008,1.10823,4.91327>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.709181,1.83799,6>,<-0.732993,1.94128,5.03354>,<-0.442368,2.36875,4.8559>}
+	triangle{<-0.709181,1.83799,6>,<-0.442368,2.36875,4.8559>,<-0.016221,2.87945,5.41894>}
+	triangle{<-0.709181,1.83799,6>,<-0.016221,2.87945,5.41894>,<0.0612613,2.90481,6>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.709181,1.83799,6>,<-0.732993,1.94128,5.03354>,r}
+	sphere{<-0.732993,1.94128,5.03354>,r}
+	cylinder{<-0.732993,1.94128,5.03354>,<-0.442368,2.36875,4.8559>,r}
+	sphere{<-0.442368,2.36875,4.8559>,r}
+	cylinder{<-0.442368,2.36875,4.8559>,<-0.016221,2.87945,5.41894>,r}
+	sphere{<-0.016221,2.87945,5.41894>,r}
+	cylinder{<-0.016221,2.87945,5.41894>,<0.0612613,2.90481,6>,r}
+	sphere{<0.0612613,2.90481,6>,r}
+	cylinder{<0.0612613,2.90481,6>,<-0.709181,1.83799,6>,r}
+	sphere{<-0.709181,1.83799,6>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.586682,1.85073,4.8904>,<0.273936,1.17023,5.32267>,<0.273356,1.16999,5.3238>}
+	triangle{<0.586682,1.85073,4.8904>,<0.273356,1.16999,5.3238>,<-0.00158112,1.49555,6>}
+	triangle{<0.586682,1.85073,4.8904>,<-0.00158112,1.49555,6>,<0.186769,2.71737,6>}
+	texture{t1}
+}
+union{
+	cylinder{<0.586682,1.85073,4.8904>,<0.273936,1.17023,5.32267>,r}
+	sphere{<0.273936,1.17023,5.32267>,r}
+	cylinder{<0.273936,1.17023,5.32267>,<0.273356,1.16999,5.3238>,r}
+	sphere{<0.273356,1.16999,5.3238>,r}
+	cylinder{<0.273356,1.16999,5.3238>,<-0.00158112,1.49555,6>,r}
+	sphere{<-0.00158112,1.49555,6>,r}
+	cylinder{<-0.00158112,1.49555,6>,<0.186769,2.71737,6>,r}
+	sphere{<0.186769,2.71737,6>,r}
+	cylinder{<0.186769,2.71737,6>,<0.586682,1.85073,4.8904>,r}
+	sphere{<0.586682,1.85073,4.8904>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.486549,1.95163,4.69003>,<0.586682,1.85073,4.8904>,<0.962717,1.74407,4.80826>}
+	triangle{<0.486549,1.95163,4.69003>,<0.962717,1.74407,4.80826>,<0.920008,1.8398,4.56126>}
+	triangle{<0.486549,1.95163,4.69003>,<0.920008,1.8398,4.56126>,<0.65223,1.97116,4.44987>}
+	texture{t1}
+}
+union{
+	cylinder{<0.486549,1.95163,4.69003>,<0.586682,1.85073,4.8904>,r}
+	sphere{<0.586682,1.85073,4.8904>,r}
+	cylinder{<0.586682,1.85073,4.8904>,<0.962717,1.74407,4.80826>,r}
+	sphere{<0.962717,1.74407,4.80826>,r}
+	cylinder{<0.962717,1.74407,4.80826>,<0.920008,1.8398,4.56126>,r}
+	sphere{<0.920008,1.8398,4.56126>,r}
+	cylinder{<0.920008,1.8398,4.56126>,<0.65223,1.97116,4.44987>,r}
+	sphere{<0.65223,1.97116,4.44987>,r}
+	cylinder{<0.65223,1.97116,4.44987>,<0.486549,1.95163,4.69003>,r}
+	sphere{<0.486549,1.95163,4.69003>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.486549,1.95163,4.69003>,<-0.016221,2.87945,5.41894>,<0.0612613,2.90481,6>}
+	triangle{<0.486549,1.95163,4.69003>,<0.0612613,2.90481,6>,<0.186769,2.71737,6>}
+	triangle{<0.486549,1.95163,4.69003>,<0.186769,2.71737,6>,<0.586682,1.85073,4.8904>}
+	texture{t1}
+}
+union{
+	cylinder{<0.486549,1.95163,4.69003>,<-0.016221,2.87945,5.41894>,r}
+	sphere{<-0.016221,2.87945,5.41894>,r}
+	cylinder{<-0.016221,2.87945,5.41894>,<0.0612613,2.90481,6>,r}
+	sphere{<0.0612613,2.90481,6>,r}
+	cylinder{<0.0612613,2.90481,6>,<0.186769,2.71737,6>,r}
+	sphere{<0.186769,2.71737,6>,r}
+	cylinder{<0.186769,2.71737,6>,<0.586682,1.85073,4.8904>,r}
+	sphere{<0.586682,1.85073,4.8904>,r}
+	cylinder{<0.586682,1.85073,4.8904>,<0.486549,1.95163,4.69003>,r}
+	sphere{<0.486549,1.95163,4.69003>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.186769,2.71737,6>,<1.10856,2.60426,6>,<1.20473,1.85718,5.00207>}
+	triangle{<0.186769,2.71737,6>,<1.20473,1.85718,5.00207>,<0.962717,1.74407,4.80826>}
+	triangle{<0.186769,2.71737,6>,<0.962717,1.74407,4.80826>,<0.586682,1.85073,4.8904>}
+	texture{t1}
+}
+union{
+	cylinder{<0.186769,2.71737,6>,<1.10856,2.60426,6>,r}
+	sphere{<1.10856,2.60426,6>,r}
+	cylinder{<1.10856,2.60426,6>,<1.20473,1.85718,5.00207>,r}
+	sphere{<1.20473,1.85718,5.00207>,r}
+	cylinder{<1.20473,1.85718,5.00207>,<0.962717,1.74407,4.80826>,r}
+	sphere{<0.962717,1.74407,4.80826>,r}
+	cylinder{<0.962717,1.74407,4.80826>,<0.586682,1.85073,4.8904>,r}
+	sphere{<0.586682,1.85073,4.8904>,r}
+	cylinder{<0.586682,1.85073,4.8904>,<0.186769,2.71737,6>,r}
+	sphere{<0.186769,2.71737,6>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.10856,2.60426,6>,<1.34838,3,6>,<1.66188,3,5.43008>}
+	triangle{<1.10856,2.60426,6>,<1.66188,3,5.43008>,<1.53211,2.24436,4.83347>}
+	triangle{<1.10856,2.60426,6>,<1.53211,2.24436,4.83347>,<1.20473,1.85718,5.00207>}
+	texture{t1}
+}
+union{
+	cylinder{<1.10856,2.60426,6>,<1.34838,3,6>,r}
+	sphere{<1.34838,3,6>,r}
+	cylinder{<1.34838,3,6>,<1.66188,3,5.43008>,r}
+	sphere{<1.66188,3,5.43008>,r}
+	cylinder{<1.66188,3,5.43008>,<1.53211,2.24436,4.83347>,r}
+	sphere{<1.53211,2.24436,4.83347>,r}
+	cylinder{<1.53211,2.24436,4.83347>,<1.20473,1.85718,5.00207>,r}
+	sphere{<1.20473,1.85718,5.00207>,r}
+	cylinder{<1.20473,1.85718,5.00207>,<1.10856,2.60426,6>,r}
+	sphere{<1.10856,2.60426,6>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.53211,2.24436,4.83347>,<2.14499,1.87079,4.91991>,<1.87136,1.43663,5.1013>}
+	triangle{<1.53211,2.24436,4.83347>,<1.87136,1.43663,5.1013>,<1.27646,1.64755,5.07292>}
+	triangle{<1.53211,2.24436,4.83347>,<1.27646,1.64755,5.07292>,<1.20473,1.85718,5.00207>}
+	texture{t1}
+}
+union{
+	cylinder{<1.53211,2.24436,4.83347>,<2.14499,1.87079,4.91991>,r}
+	sphere{<2.14499,1.87079,4.91991>,r}
+	cylinder{<2.14499,1.87079,4.91991>,<1.87136,1.43663,5.1013>,r}
+	sphere{<1.87136,1.43663,5.1013>,r}
+	cylinder{<1.87136,1.43663,5.1013>,<1.27646,1.64755,5.07292>,r}
+	sphere{<1.27646,1.64755,5.07292>,r}
+	cylinder{<1.27646,1.64755,5.07292>,<1.20473,1.85718,5.00207>,r}
+	sphere{<1.20473,1.85718,5.00207>,r}
+	cylinder{<1.20473,1.85718,5.00207>,<1.53211,2.24436,4.83347>,r}
+	sphere{<1.53211,2.24436,4.83347>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.53211,2.24436,4.83347>,<1.51181,2.27678,4.74013>,<1.93092,2.15722,4.18562>}
+	triangle{<1.53211,2.24436,4.83347>,<1.93092,2.15722,4.18562>,<2.35417,1.83987,4.51337>}
+	triangle{<1.53211,2.24436,4.83347>,<2.35417,1.83987,4.51337>,<2.14499,1.87079,4.91991>}
+	texture{t1}
+}
+union{
+	cylinder{<1.53211,2.24436,4.83347>,<1.51181,2.27678,4.74013>,r}
+	sphere{<1.51181,2.27678,4.74013>,r}
+	cylinder{<1.51181,2.27678,4.74013>,<1.93092,2.15722,4.18562>,r}
+	sphere{<1.93092,2.15722,4.18562>,r}
+	cylinder{<1.93092,2.15722,4.18562>,<2.35417,1.83987,4.51337>,r}
+	sphere{<2.35417,1.83987,4.51337>,r}
+	cylinder{<2.35417,1.83987,4.51337>,<2.14499,1.87079,4.91991>,r}
+	sphere{<2.14499,1.87079,4.91991>,r}
+	cylinder{<2.14499,1.87079,4.91991>,<1.53211,2.24436,4.83347>,r}
+	sphere{<1.53211,2.24436,4.83347>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.03619,1.53679,4.88043>,<1.12517,1.24694,4.64602>,<1.07693,1.35951,4.40402>}
+	triangle{<1.03619,1.53679,4.88043>,<1.07693,1.35951,4.40402>,<0.920008,1.8398,4.56126>}
+	triangle{<1.03619,1.53679,4.88043>,<0.920008,1.8398,4.56126>,<0.962717,1.74407,4.80826>}
+	texture{t1}
+}
+union{
+	cylinder{<1.03619,1.53679,4.88043>,<1.12517,1.24694,4.64602>,r}
+	sphere{<1.12517,1.24694,4.64602>,r}
+	cylinder{<1.12517,1.24694,4.64602>,<1.07693,1.35951,4.40402>,r}
+	sphere{<1.07693,1.35951,4.40402>,r}
+	cylinder{<1.07693,1.35951,4.40402>,<0.920008,1.8398,4.56126>,r}
+	sphere{<0.920008,1.8398,4.56126>,r}
+	cylinder{<0.920008,1.8398,4.56126>,<0.962717,1.74407,4.80826>,r}
+	sphere{<0.962717,1.74407,4.80826>,r}
+	cylinder{<0.962717,1.74407,4.80826>,<1.03619,1.53679,4.88043>,r}
+	sphere{<1.03619,1.53679,4.88043>,r}
+	texture{t2}
+}
@@ -0,0 +1,4906 @@
+union{
+	triangle{<-2.00376,-2.00558,2.02054>,<-2.02205,-1.98735,2.02622>,<-2.08412,-1.38468,1.71334>}
+	triangle{<-2.00376,-2.00558,2.02054>,<-2.08412,-1.38468,1.71334>,<-1.77833,-1.26666,1.35881>}
+	triangle{<-2.00376,-2.00558,2.02054>,<-1.77833,-1.26666,1.35881>,<-1.58636,-1.49214,1.32023>}
+	triangle{<-2.00376,-2.00558,2.02054>,<-1.58636,-1.49214,1.32023>,<-1.60151,-1.9961,1.6437>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.00376,-2.00558,2.02054>,<-2.02205,-1.98735,2.02622>,r}
+	sphere{<-2.02205,-1.98735,2.02622>,r}
+	cylinder{<-2.02205,-1.98735,2.02622>,<-2.08412,-1.38468,1.71334>,r}
+	sphere{<-2.08412,-1.38468,1.71334>,r}
+	cylinder{<-2.08412,-1.38468,1.71334>,<-1.77833,-1.26666,1.35881>,r}
+	sphere{<-1.77833,-1.26666,1.35881>,r}
+	cylinder{<-1.77833,-1.26666,1.35881>,<-1.58636,-1.49214,1.32023>,r}
+	sphere{<-1.58636,-1.49214,1.32023>,r}
+	cylinder{<-1.58636,-1.49214,1.32023>,<-1.60151,-1.9961,1.6437>,r}
+	sphere{<-1.60151,-1.9961,1.6437>,r}
+	cylinder{<-1.60151,-1.9961,1.6437>,<-2.00376,-2.00558,2.02054>,r}
+	sphere{<-2.00376,-2.00558,2.02054>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.08412,-1.38468,1.71334>,<-3,-1.70042,1.52193>,<-3,-1.69057,1.19492>}
+	triangle{<-2.08412,-1.38468,1.71334>,<-3,-1.69057,1.19492>,<-2.01427,-1.33835,0.989153>}
+	triangle{<-2.08412,-1.38468,1.71334>,<-2.01427,-1.33835,0.989153>,<-1.7829,-1.26406,1.21931>}
+	triangle{<-2.08412,-1.38468,1.71334>,<-1.7829,-1.26406,1.21931>,<-1.77833,-1.26666,1.35881>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.08412,-1.38468,1.71334>,<-3,-1.70042,1.52193>,r}
+	sphere{<-3,-1.70042,1.52193>,r}
+	cylinder{<-3,-1.70042,1.52193>,<-3,-1.69057,1.19492>,r}
+	sphere{<-3,-1.69057,1.19492>,r}
+	cylinder{<-3,-1.69057,1.19492>,<-2.01427,-1.33835,0.989153>,r}
+	sphere{<-2.01427,-1.33835,0.989153>,r}
+	cylinder{<-2.01427,-1.33835,0.989153>,<-1.7829,-1.26406,1.21931>,r}
+	sphere{<-1.7829,-1.26406,1.21931>,r}
+	cylinder{<-1.7829,-1.26406,1.21931>,<-1.77833,-1.26666,1.35881>,r}
+	sphere{<-1.77833,-1.26666,1.35881>,r}
+	cylinder{<-1.77833,-1.26666,1.35881>,<-2.08412,-1.38468,1.71334>,r}
+	sphere{<-2.08412,-1.38468,1.71334>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.271081,-2.05795,1.70111>,<0.280672,-3,1.697>,<-0.641056,-3,2.09052>}
+	triangle{<0.271081,-2.05795,1.70111>,<-0.641056,-3,2.09052>,<-0.641057,-2.96745,2.09053>}
+	triangle{<0.271081,-2.05795,1.70111>,<-0.641057,-2.96745,2.09053>,<-0.0348803,-1.94883,1.83174>}
+	triangle{<0.271081,-2.05795,1.70111>,<-0.0348803,-1.94883,1.83174>,<0.183055,-1.98547,1.7387>}
+	texture{t1}
+}
+union{
+	cylinder{<0.271081,-2.05795,1.70111>,<0.280672,-3,1.697>,r}
+	sphere{<0.280672,-3,1.697>,r}
+	cylinder{<0.280672,-3,1.697>,<-0.641056,-3,2.09052>,r}
+	sphere{<-0.641056,-3,2.09052>,r}
+	cylinder{<-0.641056,-3,2.09052>,<-0.641057,-2.96745,2.09053>,r}
+	sphere{<-0.641057,-2.96745,2.09053>,r}
+	cylinder{<-0.641057,-2.96745,2.09053>,<-0.0348803,-1.94883,1.83174>,r}
+	sphere{<-0.0348803,-1.94883,1.83174>,r}
+	cylinder{<-0.0348803,-1.94883,1.83174>,<0.183055,-1.98547,1.7387>,r}
+	sphere{<0.183055,-1.98547,1.7387>,r}
+	cylinder{<0.183055,-1.98547,1.7387>,<0.271081,-2.05795,1.70111>,r}
+	sphere{<0.271081,-2.05795,1.70111>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.271081,-2.05795,1.70111>,<0.284029,-2.01526,1.57517>,<0.32674,-2.06288,1.17699>}
+	triangle{<0.271081,-2.05795,1.70111>,<0.32674,-2.06288,1.17699>,<0.372917,-2.89846,0.818318>}
+	triangle{<0.271081,-2.05795,1.70111>,<0.372917,-2.89846,0.818318>,<0.37377,-3,0.819571>}
+	triangle{<0.271081,-2.05795,1.70111>,<0.37377,-3,0.819571>,<0.280672,-3,1.697>}
+	texture{t1}
+}
+union{
+	cylinder{<0.271081,-2.05795,1.70111>,<0.284029,-2.01526,1.57517>,r}
+	sphere{<0.284029,-2.01526,1.57517>,r}
+	cylinder{<0.284029,-2.01526,1.57517>,<0.32674,-2.06288,1.17699>,r}
+	sphere{<0.32674,-2.06288,1.17699>,r}
+	cylinder{<0.32674,-2.06288,1.17699>,<0.372917,-2.89846,0.818318>,r}
+	sphere{<0.372917,-2.89846,0.818318>,r}
+	cylinder{<0.372917,-2.89846,0.818318>,<0.37377,-3,0.819571>,r}
+	sphere{<0.37377,-3,0.819571>,r}
+	cylinder{<0.37377,-3,0.819571>,<0.280672,-3,1.697>,r}
+	sphere{<0.280672,-3,1.697>,r}
+	cylinder{<0.280672,-3,1.697>,<0.271081,-2.05795,1.70111>,r}
+	sphere{<0.271081,-2.05795,1.70111>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.55108,-2.85031,1.06921>,<-1.64563,-2.67398,1.13498>,<-1.60151,-1.9961,1.6437>}
+	triangle{<-1.55108,-2.85031,1.06921>,<-1.60151,-1.9961,1.6437>,<-1.18147,-1.99335,1.90931>}
+	triangle{<-1.55108,-2.85031,1.06921>,<-1.18147,-1.99335,1.90931>,<-0.81803,-2.53876,1.75042>}
+	triangle{<-1.55108,-2.85031,1.06921>,<-0.81803,-2.53876,1.75042>,<-1.04699,-2.95643,1.31032>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.55108,-2.85031,1.06921>,<-1.64563,-2.67398,1.13498>,r}
+	sphere{<-1.64563,-2.67398,1.13498>,r}
+	cylinder{<-1.64563,-2.67398,1.13498>,<-1.60151,-1.9961,1.6437>,r}
+	sphere{<-1.60151,-1.9961,1.6437>,r}
+	cylinder{<-1.60151,-1.9961,1.6437>,<-1.18147,-1.99335,1.90931>,r}
+	sphere{<-1.18147,-1.99335,1.90931>,r}
+	cylinder{<-1.18147,-1.99335,1.90931>,<-0.81803,-2.53876,1.75042>,r}
+	sphere{<-0.81803,-2.53876,1.75042>,r}
+	cylinder{<-0.81803,-2.53876,1.75042>,<-1.04699,-2.95643,1.31032>,r}
+	sphere{<-1.04699,-2.95643,1.31032>,r}
+	cylinder{<-1.04699,-2.95643,1.31032>,<-1.55108,-2.85031,1.06921>,r}
+	sphere{<-1.55108,-2.85031,1.06921>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.5921,-1.49001,1.08825>,<-1.31545,-1.48461,0.8941>,<-0.696386,-1.47899,1.13814>}
+	triangle{<-1.5921,-1.49001,1.08825>,<-0.696386,-1.47899,1.13814>,<-0.66261,-1.48315,1.62103>}
+	triangle{<-1.5921,-1.49001,1.08825>,<-0.66261,-1.48315,1.62103>,<-0.862929,-1.48721,1.77755>}
+	triangle{<-1.5921,-1.49001,1.08825>,<-0.862929,-1.48721,1.77755>,<-1.58636,-1.49214,1.32023>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.5921,-1.49001,1.08825>,<-1.31545,-1.48461,0.8941>,r}
+	sphere{<-1.31545,-1.48461,0.8941>,r}
+	cylinder{<-1.31545,-1.48461,0.8941>,<-0.696386,-1.47899,1.13814>,r}
+	sphere{<-0.696386,-1.47899,1.13814>,r}
+	cylinder{<-0.696386,-1.47899,1.13814>,<-0.66261,-1.48315,1.62103>,r}
+	sphere{<-0.66261,-1.48315,1.62103>,r}
+	cylinder{<-0.66261,-1.48315,1.62103>,<-0.862929,-1.48721,1.77755>,r}
+	sphere{<-0.862929,-1.48721,1.77755>,r}
+	cylinder{<-0.862929,-1.48721,1.77755>,<-1.58636,-1.49214,1.32023>,r}
+	sphere{<-1.58636,-1.49214,1.32023>,r}
+	cylinder{<-1.58636,-1.49214,1.32023>,<-1.5921,-1.49001,1.08825>,r}
+	sphere{<-1.5921,-1.49001,1.08825>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.372917,-2.89846,0.818318>,<0.330662,-3,0.755345>,<-0.0157998,-3,0.615021>}
+	triangle{<0.372917,-2.89846,0.818318>,<-0.0157998,-3,0.615021>,<-0.430876,-2.0077,0.895066>}
+	triangle{<0.372917,-2.89846,0.818318>,<-0.430876,-2.0077,0.895066>,<-0.425468,-1.99998,0.900742>}
+	triangle{<0.372917,-2.89846,0.818318>,<-0.425468,-1.99998,0.900742>,<0.32674,-2.06288,1.17699>}
+	texture{t1}
+}
+union{
+	cylinder{<0.372917,-2.89846,0.818318>,<0.330662,-3,0.755345>,r}
+	sphere{<0.330662,-3,0.755345>,r}
+	cylinder{<0.330662,-3,0.755345>,<-0.0157998,-3,0.615021>,r}
+	sphere{<-0.0157998,-3,0.615021>,r}
+	cylinder{<-0.0157998,-3,0.615021>,<-0.430876,-2.0077,0.895066>,r}
+	sphere{<-0.430876,-2.0077,0.895066>,r}
+	cylinder{<-0.430876,-2.0077,0.895066>,<-0.425468,-1.99998,0.900742>,r}
+	sphere{<-0.425468,-1.99998,0.900742>,r}
+	cylinder{<-0.425468,-1.99998,0.900742>,<0.32674,-2.06288,1.17699>,r}
+	sphere{<0.32674,-2.06288,1.17699>,r}
+	cylinder{<0.32674,-2.06288,1.17699>,<0.372917,-2.89846,0.818318>,r}
+	sphere{<0.372917,-2.89846,0.818318>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.22457,-3,1.06682>,<1.23193,-2.06382,1.05969>,<1.29763,-1.89957,1.31094>}
+	triangle{<1.22457,-3,1.06682>,<1.29763,-1.89957,1.31094>,<1.29776,-1.89974,1.31145>}
+	triangle{<1.22457,-3,1.06682>,<1.29776,-1.89974,1.31145>,<1.43161,-2.56939,1.86194>}
+	triangle{<1.22457,-3,1.06682>,<1.43161,-2.56939,1.86194>,<1.42682,-3,1.85969>}
+	texture{t1}
+}
+union{
+	cylinder{<1.22457,-3,1.06682>,<1.23193,-2.06382,1.05969>,r}
+	sphere{<1.23193,-2.06382,1.05969>,r}
+	cylinder{<1.23193,-2.06382,1.05969>,<1.29763,-1.89957,1.31094>,r}
+	sphere{<1.29763,-1.89957,1.31094>,r}
+	cylinder{<1.29763,-1.89957,1.31094>,<1.29776,-1.89974,1.31145>,r}
+	sphere{<1.29776,-1.89974,1.31145>,r}
+	cylinder{<1.29776,-1.89974,1.31145>,<1.43161,-2.56939,1.86194>,r}
+	sphere{<1.43161,-2.56939,1.86194>,r}
+	cylinder{<1.43161,-2.56939,1.86194>,<1.42682,-3,1.85969>,r}
+	sphere{<1.42682,-3,1.85969>,r}
+	cylinder{<1.42682,-3,1.85969>,<1.22457,-3,1.06682>,r}
+	sphere{<1.22457,-3,1.06682>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.42385,-1.85545,1.14489>,<1.33981,-1.86939,1.29235>,<1.29808,-1.89914,1.31101>}
+	triangle{<1.42385,-1.85545,1.14489>,<1.29808,-1.89914,1.31101>,<1.29763,-1.89957,1.31094>}
+	triangle{<1.42385,-1.85545,1.14489>,<1.29763,-1.89957,1.31094>,<1.23193,-2.06382,1.05969>}
+	triangle{<1.42385,-1.85545,1.14489>,<1.23193,-2.06382,1.05969>,<1.31456,-2.02406,0.976969>}
+	texture{t1}
+}
+union{
+	cylinder{<1.42385,-1.85545,1.14489>,<1.33981,-1.86939,1.29235>,r}
+	sphere{<1.33981,-1.86939,1.29235>,r}
+	cylinder{<1.33981,-1.86939,1.29235>,<1.29808,-1.89914,1.31101>,r}
+	sphere{<1.29808,-1.89914,1.31101>,r}
+	cylinder{<1.29808,-1.89914,1.31101>,<1.29763,-1.89957,1.31094>,r}
+	sphere{<1.29763,-1.89957,1.31094>,r}
+	cylinder{<1.29763,-1.89957,1.31094>,<1.23193,-2.06382,1.05969>,r}
+	sphere{<1.23193,-2.06382,1.05969>,r}
+	cylinder{<1.23193,-2.06382,1.05969>,<1.31456,-2.02406,0.976969>,r}
+	sphere{<1.31456,-2.02406,0.976969>,r}
+	cylinder{<1.31456,-2.02406,0.976969>,<1.42385,-1.85545,1.14489>,r}
+	sphere{<1.42385,-1.85545,1.14489>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.83427,-1.83462,1.32474>,<1.82691,-1.82719,1.17289>,<2.11902,-1.41491,0.880633>}
+	triangle{<1.83427,-1.83462,1.32474>,<2.11902,-1.41491,0.880633>,<2.32812,-1.17042,1.12398>}
+	triangle{<1.83427,-1.83462,1.32474>,<2.32812,-1.17042,1.12398>,<2.3234,-1.21331,1.45247>}
+	triangle{<1.83427,-1.83462,1.32474>,<2.3234,-1.21331,1.45247>,<2.09956,-1.52432,1.63253>}
+	texture{t1}
+}
+union{
+	cylinder{<1.83427,-1.83462,1.32474>,<1.82691,-1.82719,1.17289>,r}
+	sphere{<1.82691,-1.82719,1.17289>,r}
+	cylinder{<1.82691,-1.82719,1.17289>,<2.11902,-1.41491,0.880633>,r}
+	sphere{<2.11902,-1.41491,0.880633>,r}
+	cylinder{<2.11902,-1.41491,0.880633>,<2.32812,-1.17042,1.12398>,r}
+	sphere{<2.32812,-1.17042,1.12398>,r}
+	cylinder{<2.32812,-1.17042,1.12398>,<2.3234,-1.21331,1.45247>,r}
+	sphere{<2.3234,-1.21331,1.45247>,r}
+	cylinder{<2.3234,-1.21331,1.45247>,<2.09956,-1.52432,1.63253>,r}
+	sphere{<2.09956,-1.52432,1.63253>,r}
+	cylinder{<2.09956,-1.52432,1.63253>,<1.83427,-1.83462,1.32474>,r}
+	sphere{<1.83427,-1.83462,1.32474>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.425521,-0.980721,-5.55112e-17>,<-0.425615,-0.980382,0.893585>,<-0.441759,-0.981008,0.907958>}
+	triangle{<-0.425521,-0.980721,-5.55112e-17>,<-0.441759,-0.981008,0.907958>,<-0.464765,-0.981901,0.92339>}
+	triangle{<-0.425521,-0.980721,-5.55112e-17>,<-0.464765,-0.981901,0.92339>,<-1.05154,-1.00492,0.703022>}
+	triangle{<-0.425521,-0.980721,-5.55112e-17>,<-1.05154,-1.00492,0.703022>,<-1.05173,-1.0052,-5.55112e-17>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.425521,-0.980721,-5.55112e-17>,<-0.425615,-0.980382,0.893585>,r}
+	sphere{<-0.425615,-0.980382,0.893585>,r}
+	cylinder{<-0.425615,-0.980382,0.893585>,<-0.441759,-0.981008,0.907958>,r}
+	sphere{<-0.441759,-0.981008,0.907958>,r}
+	cylinder{<-0.441759,-0.981008,0.907958>,<-0.464765,-0.981901,0.92339>,r}
+	sphere{<-0.464765,-0.981901,0.92339>,r}
+	cylinder{<-0.464765,-0.981901,0.92339>,<-1.05154,-1.00492,0.703022>,r}
+	sphere{<-1.05154,-1.00492,0.703022>,r}
+	cylinder{<-1.05154,-1.00492,0.703022>,<-1.05173,-1.0052,-5.55112e-17>,r}
+	sphere{<-1.05173,-1.0052,-5.55112e-17>,r}
+	cylinder{<-1.05173,-1.0052,-5.55112e-17>,<-0.425521,-0.980721,-5.55112e-17>,r}
+	sphere{<-0.425521,-0.980721,-5.55112e-17>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.448645,-1.99494,0.921333>,<-0.4553,-2.00683,0.911534>,<-1.0457,-1.9859,0.694749>}
+	triangle{<-0.448645,-1.99494,0.921333>,<-1.0457,-1.9859,0.694749>,<-1.32069,-1.49412,0.886294>}
+	triangle{<-0.448645,-1.99494,0.921333>,<-1.32069,-1.49412,0.886294>,<-1.31545,-1.48461,0.8941>}
+	triangle{<-0.448645,-1.99494,0.921333>,<-1.31545,-1.48461,0.8941>,<-0.696386,-1.47899,1.13814>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.448645,-1.99494,0.921333>,<-0.4553,-2.00683,0.911534>,r}
+	sphere{<-0.4553,-2.00683,0.911534>,r}
+	cylinder{<-0.4553,-2.00683,0.911534>,<-1.0457,-1.9859,0.694749>,r}
+	sphere{<-1.0457,-1.9859,0.694749>,r}
+	cylinder{<-1.0457,-1.9859,0.694749>,<-1.32069,-1.49412,0.886294>,r}
+	sphere{<-1.32069,-1.49412,0.886294>,r}
+	cylinder{<-1.32069,-1.49412,0.886294>,<-1.31545,-1.48461,0.8941>,r}
+	sphere{<-1.31545,-1.48461,0.8941>,r}
+	cylinder{<-1.31545,-1.48461,0.8941>,<-0.696386,-1.47899,1.13814>,r}
+	sphere{<-0.696386,-1.47899,1.13814>,r}
+	cylinder{<-0.696386,-1.47899,1.13814>,<-0.448645,-1.99494,0.921333>,r}
+	sphere{<-0.448645,-1.99494,0.921333>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.798807,-0.470622,1.78419>,<-0.797485,-0.461559,1.11786>,<-0.535166,0.00576369,0.91726>}
+	triangle{<-0.798807,-0.470622,1.78419>,<-0.535166,0.00576369,0.91726>,<-0.397098,0.248775,1.10488>}
+	triangle{<-0.798807,-0.470622,1.78419>,<-0.397098,0.248775,1.10488>,<-0.398829,0.24347,1.3263>}
+	triangle{<-0.798807,-0.470622,1.78419>,<-0.398829,0.24347,1.3263>,<-0.761264,-0.404631,1.84403>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.798807,-0.470622,1.78419>,<-0.797485,-0.461559,1.11786>,r}
+	sphere{<-0.797485,-0.461559,1.11786>,r}
+	cylinder{<-0.797485,-0.461559,1.11786>,<-0.535166,0.00576369,0.91726>,r}
+	sphere{<-0.535166,0.00576369,0.91726>,r}
+	cylinder{<-0.535166,0.00576369,0.91726>,<-0.397098,0.248775,1.10488>,r}
+	sphere{<-0.397098,0.248775,1.10488>,r}
+	cylinder{<-0.397098,0.248775,1.10488>,<-0.398829,0.24347,1.3263>,r}
+	sphere{<-0.398829,0.24347,1.3263>,r}
+	cylinder{<-0.398829,0.24347,1.3263>,<-0.761264,-0.404631,1.84403>,r}
+	sphere{<-0.761264,-0.404631,1.84403>,r}
+	cylinder{<-0.761264,-0.404631,1.84403>,<-0.798807,-0.470622,1.78419>,r}
+	sphere{<-0.798807,-0.470622,1.78419>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.3496,-0.209883,1.538>,<0.0708343,-0.0487173,1.72786>,<-0.398829,0.24347,1.3263>}
+	triangle{<0.3496,-0.209883,1.538>,<-0.398829,0.24347,1.3263>,<-0.397098,0.248775,1.10488>}
+	triangle{<0.3496,-0.209883,1.538>,<-0.397098,0.248775,1.10488>,<-0.108834,0.0873227,0.726719>}
+	triangle{<0.3496,-0.209883,1.538>,<-0.108834,0.0873227,0.726719>,<0.315359,-0.174678,1.0231>}
+	texture{t1}
+}
+union{
+	cylinder{<0.3496,-0.209883,1.538>,<0.0708343,-0.0487173,1.72786>,r}
+	sphere{<0.0708343,-0.0487173,1.72786>,r}
+	cylinder{<0.0708343,-0.0487173,1.72786>,<-0.398829,0.24347,1.3263>,r}
+	sphere{<-0.398829,0.24347,1.3263>,r}
+	cylinder{<-0.398829,0.24347,1.3263>,<-0.397098,0.248775,1.10488>,r}
+	sphere{<-0.397098,0.248775,1.10488>,r}
+	cylinder{<-0.397098,0.248775,1.10488>,<-0.108834,0.0873227,0.726719>,r}
+	sphere{<-0.108834,0.0873227,0.726719>,r}
+	cylinder{<-0.108834,0.0873227,0.726719>,<0.315359,-0.174678,1.0231>,r}
+	sphere{<0.315359,-0.174678,1.0231>,r}
+	cylinder{<0.315359,-0.174678,1.0231>,<0.3496,-0.209883,1.538>,r}
+	sphere{<0.3496,-0.209883,1.538>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.871986,-0.473308,1.8413>,<-1.033,-0.477612,1.84844>,<-1.58799,-0.481806,1.08753>}
+	triangle{<-0.871986,-0.473308,1.8413>,<-1.58799,-0.481806,1.08753>,<-1.33606,-0.472971,0.921412>}
+	triangle{<-0.871986,-0.473308,1.8413>,<-1.33606,-0.472971,0.921412>,<-0.797485,-0.461559,1.11786>}
+	triangle{<-0.871986,-0.473308,1.8413>,<-0.797485,-0.461559,1.11786>,<-0.798807,-0.470622,1.78419>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.871986,-0.473308,1.8413>,<-1.033,-0.477612,1.84844>,r}
+	sphere{<-1.033,-0.477612,1.84844>,r}
+	cylinder{<-1.033,-0.477612,1.84844>,<-1.58799,-0.481806,1.08753>,r}
+	sphere{<-1.58799,-0.481806,1.08753>,r}
+	cylinder{<-1.58799,-0.481806,1.08753>,<-1.33606,-0.472971,0.921412>,r}
+	sphere{<-1.33606,-0.472971,0.921412>,r}
+	cylinder{<-1.33606,-0.472971,0.921412>,<-0.797485,-0.461559,1.11786>,r}
+	sphere{<-0.797485,-0.461559,1.11786>,r}
+	cylinder{<-0.797485,-0.461559,1.11786>,<-0.798807,-0.470622,1.78419>,r}
+	sphere{<-0.798807,-0.470622,1.78419>,r}
+	cylinder{<-0.798807,-0.470622,1.78419>,<-0.871986,-0.473308,1.8413>,r}
+	sphere{<-0.871986,-0.473308,1.8413>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.425615,-0.980382,0.893585>,<-0.424514,-0.977605,0.896242>,<0.201854,-0.907642,1.14393>}
+	triangle{<-0.425615,-0.980382,0.893585>,<0.201854,-0.907642,1.14393>,<0.41917,-1.11445,1.03649>}
+	triangle{<-0.425615,-0.980382,0.893585>,<0.41917,-1.11445,1.03649>,<0.239667,-1.48843,0.66933>}
+	triangle{<-0.425615,-0.980382,0.893585>,<0.239667,-1.48843,0.66933>,<-0.0665192,-1.48754,0.577613>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.425615,-0.980382,0.893585>,<-0.424514,-0.977605,0.896242>,r}
+	sphere{<-0.424514,-0.977605,0.896242>,r}
+	cylinder{<-0.424514,-0.977605,0.896242>,<0.201854,-0.907642,1.14393>,r}
+	sphere{<0.201854,-0.907642,1.14393>,r}
+	cylinder{<0.201854,-0.907642,1.14393>,<0.41917,-1.11445,1.03649>,r}
+	sphere{<0.41917,-1.11445,1.03649>,r}
+	cylinder{<0.41917,-1.11445,1.03649>,<0.239667,-1.48843,0.66933>,r}
+	sphere{<0.239667,-1.48843,0.66933>,r}
+	cylinder{<0.239667,-1.48843,0.66933>,<-0.0665192,-1.48754,0.577613>,r}
+	sphere{<-0.0665192,-1.48754,0.577613>,r}
+	cylinder{<-0.0665192,-1.48754,0.577613>,<-0.425615,-0.980382,0.893585>,r}
+	sphere{<-0.425615,-0.980382,0.893585>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.38686,-0.642267,1.12902>,<1.14003,-0.173996,0.918291>,<1.2392,-0.0588833,0.831019>}
+	triangle{<1.38686,-0.642267,1.12902>,<1.2392,-0.0588833,0.831019>,<1.88557,-0.181912,0.757347>}
+	triangle{<1.38686,-0.642267,1.12902>,<1.88557,-0.181912,0.757347>,<2.00896,-0.438506,0.87545>}
+	triangle{<1.38686,-0.642267,1.12902>,<2.00896,-0.438506,0.87545>,<1.9251,-0.593323,0.981835>}
+	texture{t1}
+}
+union{
+	cylinder{<1.38686,-0.642267,1.12902>,<1.14003,-0.173996,0.918291>,r}
+	sphere{<1.14003,-0.173996,0.918291>,r}
+	cylinder{<1.14003,-0.173996,0.918291>,<1.2392,-0.0588833,0.831019>,r}
+	sphere{<1.2392,-0.0588833,0.831019>,r}
+	cylinder{<1.2392,-0.0588833,0.831019>,<1.88557,-0.181912,0.757347>,r}
+	sphere{<1.88557,-0.181912,0.757347>,r}
+	cylinder{<1.88557,-0.181912,0.757347>,<2.00896,-0.438506,0.87545>,r}
+	sphere{<2.00896,-0.438506,0.87545>,r}
+	cylinder{<2.00896,-0.438506,0.87545>,<1.9251,-0.593323,0.981835>,r}
+	sphere{<1.9251,-0.593323,0.981835>,r}
+	cylinder{<1.9251,-0.593323,0.981835>,<1.38686,-0.642267,1.12902>,r}
+	sphere{<1.38686,-0.642267,1.12902>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.38686,-0.642267,1.12902>,<1.9251,-0.593323,0.981835>,<2.02525,-0.713092,0.860041>}
+	triangle{<1.38686,-0.642267,1.12902>,<2.02525,-0.713092,0.860041>,<1.83606,-1.13072,0.618444>}
+	triangle{<1.38686,-0.642267,1.12902>,<1.83606,-1.13072,0.618444>,<1.4776,-1.23975,0.660474>}
+	triangle{<1.38686,-0.642267,1.12902>,<1.4776,-1.23975,0.660474>,<1.19349,-0.969576,0.955006>}
+	texture{t1}
+}
+union{
+	cylinder{<1.38686,-0.642267,1.12902>,<1.9251,-0.593323,0.981835>,r}
+	sphere{<1.9251,-0.593323,0.981835>,r}
+	cylinder{<1.9251,-0.593323,0.981835>,<2.02525,-0.713092,0.860041>,r}
+	sphere{<2.02525,-0.713092,0.860041>,r}
+	cylinder{<2.02525,-0.713092,0.860041>,<1.83606,-1.13072,0.618444>,r}
+	sphere{<1.83606,-1.13072,0.618444>,r}
+	cylinder{<1.83606,-1.13072,0.618444>,<1.4776,-1.23975,0.660474>,r}
+	sphere{<1.4776,-1.23975,0.660474>,r}
+	cylinder{<1.4776,-1.23975,0.660474>,<1.19349,-0.969576,0.955006>,r}
+	sphere{<1.19349,-0.969576,0.955006>,r}
+	cylinder{<1.19349,-0.969576,0.955006>,<1.38686,-0.642267,1.12902>,r}
+	sphere{<1.38686,-0.642267,1.12902>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.3496,-0.209883,1.538>,<0.906622,0.0260303,1.74343>,<0.969008,-0.0924176,1.79709>}
+	triangle{<0.3496,-0.209883,1.538>,<0.969008,-0.0924176,1.79709>,<0.712651,-0.890841,1.84848>}
+	triangle{<0.3496,-0.209883,1.538>,<0.712651,-0.890841,1.84848>,<0.287898,-0.993533,1.67549>}
+	triangle{<0.3496,-0.209883,1.538>,<0.287898,-0.993533,1.67549>,<0.234711,-0.942488,1.64031>}
+	texture{t1}
+}
+union{
+	cylinder{<0.3496,-0.209883,1.538>,<0.906622,0.0260303,1.74343>,r}
+	sphere{<0.906622,0.0260303,1.74343>,r}
+	cylinder{<0.906622,0.0260303,1.74343>,<0.969008,-0.0924176,1.79709>,r}
+	sphere{<0.969008,-0.0924176,1.79709>,r}
+	cylinder{<0.969008,-0.0924176,1.79709>,<0.712651,-0.890841,1.84848>,r}
+	sphere{<0.712651,-0.890841,1.84848>,r}
+	cylinder{<0.712651,-0.890841,1.84848>,<0.287898,-0.993533,1.67549>,r}
+	sphere{<0.287898,-0.993533,1.67549>,r}
+	cylinder{<0.287898,-0.993533,1.67549>,<0.234711,-0.942488,1.64031>,r}
+	sphere{<0.234711,-0.942488,1.64031>,r}
+	cylinder{<0.234711,-0.942488,1.64031>,<0.3496,-0.209883,1.538>,r}
+	sphere{<0.3496,-0.209883,1.538>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.906622,0.0260303,1.74343>,<0.942535,0.0980355,1.18279>,<1.14003,-0.173996,0.918291>}
+	triangle{<0.906622,0.0260303,1.74343>,<1.14003,-0.173996,0.918291>,<1.38686,-0.642267,1.12902>}
+	triangle{<0.906622,0.0260303,1.74343>,<1.38686,-0.642267,1.12902>,<1.35885,-0.673828,1.46251>}
+	triangle{<0.906622,0.0260303,1.74343>,<1.35885,-0.673828,1.46251>,<0.969008,-0.0924176,1.79709>}
+	texture{t1}
+}
+union{
+	cylinder{<0.906622,0.0260303,1.74343>,<0.942535,0.0980355,1.18279>,r}
+	sphere{<0.942535,0.0980355,1.18279>,r}
+	cylinder{<0.942535,0.0980355,1.18279>,<1.14003,-0.173996,0.918291>,r}
+	sphere{<1.14003,-0.173996,0.918291>,r}
+	cylinder{<1.14003,-0.173996,0.918291>,<1.38686,-0.642267,1.12902>,r}
+	sphere{<1.38686,-0.642267,1.12902>,r}
+	cylinder{<1.38686,-0.642267,1.12902>,<1.35885,-0.673828,1.46251>,r}
+	sphere{<1.35885,-0.673828,1.46251>,r}
+	cylinder{<1.35885,-0.673828,1.46251>,<0.969008,-0.0924176,1.79709>,r}
+	sphere{<0.969008,-0.0924176,1.79709>,r}
+	cylinder{<0.969008,-0.0924176,1.79709>,<0.906622,0.0260303,1.74343>,r}
+	sphere{<0.906622,0.0260303,1.74343>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.510208,-1.89274,1.22859>,<0.530483,-1.22237,1.26624>,<1.05379,-1.18421,1.32323>}
+	triangle{<0.510208,-1.89274,1.22859>,<1.05379,-1.18421,1.32323>,<1.31648,-1.84598,1.31576>}
+	triangle{<0.510208,-1.89274,1.22859>,<1.31648,-1.84598,1.31576>,<1.29808,-1.89914,1.31101>}
+	triangle{<0.510208,-1.89274,1.22859>,<1.29808,-1.89914,1.31101>,<1.29763,-1.89957,1.31094>}
+	texture{t1}
+}
+union{
+	cylinder{<0.510208,-1.89274,1.22859>,<0.530483,-1.22237,1.26624>,r}
+	sphere{<0.530483,-1.22237,1.26624>,r}
+	cylinder{<0.530483,-1.22237,1.26624>,<1.05379,-1.18421,1.32323>,r}
+	sphere{<1.05379,-1.18421,1.32323>,r}
+	cylinder{<1.05379,-1.18421,1.32323>,<1.31648,-1.84598,1.31576>,r}
+	sphere{<1.31648,-1.84598,1.31576>,r}
+	cylinder{<1.31648,-1.84598,1.31576>,<1.29808,-1.89914,1.31101>,r}
+	sphere{<1.29808,-1.89914,1.31101>,r}
+	cylinder{<1.29808,-1.89914,1.31101>,<1.29763,-1.89957,1.31094>,r}
+	sphere{<1.29763,-1.89957,1.31094>,r}
+	cylinder{<1.29763,-1.89957,1.31094>,<0.510208,-1.89274,1.22859>,r}
+	sphere{<0.510208,-1.89274,1.22859>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.02525,-0.713092,0.860041>,<1.9251,-0.593323,0.981835>,<1.89413,-0.66035,1.71143>}
+	triangle{<2.02525,-0.713092,0.860041>,<1.89413,-0.66035,1.71143>,<1.99284,-0.816349,1.84367>}
+	triangle{<2.02525,-0.713092,0.860041>,<1.99284,-0.816349,1.84367>,<2.3234,-1.21331,1.45247>}
+	triangle{<2.02525,-0.713092,0.860041>,<2.3234,-1.21331,1.45247>,<2.32812,-1.17042,1.12398>}
+	texture{t1}
+}
+union{
+	cylinder{<2.02525,-0.713092,0.860041>,<1.9251,-0.593323,0.981835>,r}
+	sphere{<1.9251,-0.593323,0.981835>,r}
+	cylinder{<1.9251,-0.593323,0.981835>,<1.89413,-0.66035,1.71143>,r}
+	sphere{<1.89413,-0.66035,1.71143>,r}
+	cylinder{<1.89413,-0.66035,1.71143>,<1.99284,-0.816349,1.84367>,r}
+	sphere{<1.99284,-0.816349,1.84367>,r}
+	cylinder{<1.99284,-0.816349,1.84367>,<2.3234,-1.21331,1.45247>,r}
+	sphere{<2.3234,-1.21331,1.45247>,r}
+	cylinder{<2.3234,-1.21331,1.45247>,<2.32812,-1.17042,1.12398>,r}
+	sphere{<2.32812,-1.17042,1.12398>,r}
+	cylinder{<2.32812,-1.17042,1.12398>,<2.02525,-0.713092,0.860041>,r}
+	sphere{<2.02525,-0.713092,0.860041>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.20156,-0.0892997,1.07704>,<2.20607,-0.0893575,1.6597>,<1.98235,-0.501619,1.88902>}
+	triangle{<2.20156,-0.0892997,1.07704>,<1.98235,-0.501619,1.88902>,<1.89413,-0.66035,1.71143>}
+	triangle{<2.20156,-0.0892997,1.07704>,<1.89413,-0.66035,1.71143>,<1.9251,-0.593323,0.981835>}
+	triangle{<2.20156,-0.0892997,1.07704>,<1.9251,-0.593323,0.981835>,<2.00896,-0.438506,0.87545>}
+	texture{t1}
+}
+union{
+	cylinder{<2.20156,-0.0892997,1.07704>,<2.20607,-0.0893575,1.6597>,r}
+	sphere{<2.20607,-0.0893575,1.6597>,r}
+	cylinder{<2.20607,-0.0893575,1.6597>,<1.98235,-0.501619,1.88902>,r}
+	sphere{<1.98235,-0.501619,1.88902>,r}
+	cylinder{<1.98235,-0.501619,1.88902>,<1.89413,-0.66035,1.71143>,r}
+	sphere{<1.89413,-0.66035,1.71143>,r}
+	cylinder{<1.89413,-0.66035,1.71143>,<1.9251,-0.593323,0.981835>,r}
+	sphere{<1.9251,-0.593323,0.981835>,r}
+	cylinder{<1.9251,-0.593323,0.981835>,<2.00896,-0.438506,0.87545>,r}
+	sphere{<2.00896,-0.438506,0.87545>,r}
+	cylinder{<2.00896,-0.438506,0.87545>,<2.20156,-0.0892997,1.07704>,r}
+	sphere{<2.20156,-0.0892997,1.07704>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.42385,-1.85545,1.14489>,<1.4776,-1.23975,0.660474>,<1.19349,-0.969576,0.955006>}
+	triangle{<1.42385,-1.85545,1.14489>,<1.19349,-0.969576,0.955006>,<1.05379,-1.18421,1.32323>}
+	triangle{<1.42385,-1.85545,1.14489>,<1.05379,-1.18421,1.32323>,<1.31648,-1.84598,1.31576>}
+	triangle{<1.42385,-1.85545,1.14489>,<1.31648,-1.84598,1.31576>,<1.33981,-1.86939,1.29235>}
+	texture{t1}
+}
+union{
+	cylinder{<1.42385,-1.85545,1.14489>,<1.4776,-1.23975,0.660474>,r}
+	sphere{<1.4776,-1.23975,0.660474>,r}
+	cylinder{<1.4776,-1.23975,0.660474>,<1.19349,-0.969576,0.955006>,r}
+	sphere{<1.19349,-0.969576,0.955006>,r}
+	cylinder{<1.19349,-0.969576,0.955006>,<1.05379,-1.18421,1.32323>,r}
+	sphere{<1.05379,-1.18421,1.32323>,r}
+	cylinder{<1.05379,-1.18421,1.32323>,<1.31648,-1.84598,1.31576>,r}
+	sphere{<1.31648,-1.84598,1.31576>,r}
+	cylinder{<1.31648,-1.84598,1.31576>,<1.33981,-1.86939,1.29235>,r}
+	sphere{<1.33981,-1.86939,1.29235>,r}
+	cylinder{<1.33981,-1.86939,1.29235>,<1.42385,-1.85545,1.14489>,r}
+	sphere{<1.42385,-1.85545,1.14489>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.33981,-1.86939,1.29235>,<1.31648,-1.84598,1.31576>,<1.39005,-1.32631,1.83291>}
+	triangle{<1.33981,-1.86939,1.29235>,<1.39005,-1.32631,1.83291>,<1.81819,-1.19201,1.96471>}
+	triangle{<1.33981,-1.86939,1.29235>,<1.81819,-1.19201,1.96471>,<2.09956,-1.52432,1.63253>}
+	triangle{<1.33981,-1.86939,1.29235>,<2.09956,-1.52432,1.63253>,<1.83427,-1.83462,1.32474>}
+	texture{t1}
+}
+union{
+	cylinder{<1.33981,-1.86939,1.29235>,<1.31648,-1.84598,1.31576>,r}
+	sphere{<1.31648,-1.84598,1.31576>,r}
+	cylinder{<1.31648,-1.84598,1.31576>,<1.39005,-1.32631,1.83291>,r}
+	sphere{<1.39005,-1.32631,1.83291>,r}
+	cylinder{<1.39005,-1.32631,1.83291>,<1.81819,-1.19201,1.96471>,r}
+	sphere{<1.81819,-1.19201,1.96471>,r}
+	cylinder{<1.81819,-1.19201,1.96471>,<2.09956,-1.52432,1.63253>,r}
+	sphere{<2.09956,-1.52432,1.63253>,r}
+	cylinder{<2.09956,-1.52432,1.63253>,<1.83427,-1.83462,1.32474>,r}
+	sphere{<1.83427,-1.83462,1.32474>,r}
+	cylinder{<1.83427,-1.83462,1.32474>,<1.33981,-1.86939,1.29235>,r}
+	sphere{<1.33981,-1.86939,1.29235>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.89413,-0.66035,1.71143>,<1.99284,-0.816349,1.84367>,<1.81819,-1.19201,1.96471>}
+	triangle{<1.89413,-0.66035,1.71143>,<1.81819,-1.19201,1.96471>,<1.39005,-1.32631,1.83291>}
+	triangle{<1.89413,-0.66035,1.71143>,<1.39005,-1.32631,1.83291>,<1.12823,-1.05081,1.55748>}
+	triangle{<1.89413,-0.66035,1.71143>,<1.12823,-1.05081,1.55748>,<1.35885,-0.673828,1.46251>}
+	texture{t1}
+}
+union{
+	cylinder{<1.89413,-0.66035,1.71143>,<1.99284,-0.816349,1.84367>,r}
+	sphere{<1.99284,-0.816349,1.84367>,r}
+	cylinder{<1.99284,-0.816349,1.84367>,<1.81819,-1.19201,1.96471>,r}
+	sphere{<1.81819,-1.19201,1.96471>,r}
+	cylinder{<1.81819,-1.19201,1.96471>,<1.39005,-1.32631,1.83291>,r}
+	sphere{<1.39005,-1.32631,1.83291>,r}
+	cylinder{<1.39005,-1.32631,1.83291>,<1.12823,-1.05081,1.55748>,r}
+	sphere{<1.12823,-1.05081,1.55748>,r}
+	cylinder{<1.12823,-1.05081,1.55748>,<1.35885,-0.673828,1.46251>,r}
+	sphere{<1.35885,-0.673828,1.46251>,r}
+	cylinder{<1.35885,-0.673828,1.46251>,<1.89413,-0.66035,1.71143>,r}
+	sphere{<1.89413,-0.66035,1.71143>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.06247,0.41464,1.46334>,<0.952946,0.146905,1.8118>,<0.939392,0.112961,1.83209>}
+	triangle{<1.06247,0.41464,1.46334>,<0.939392,0.112961,1.83209>,<0.906622,0.0260303,1.74343>}
+	triangle{<1.06247,0.41464,1.46334>,<0.906622,0.0260303,1.74343>,<0.942535,0.0980355,1.18279>}
+	triangle{<1.06247,0.41464,1.46334>,<0.942535,0.0980355,1.18279>,<1.01034,0.269907,1.13997>}
+	texture{t1}
+}
+union{
+	cylinder{<1.06247,0.41464,1.46334>,<0.952946,0.146905,1.8118>,r}
+	sphere{<0.952946,0.146905,1.8118>,r}
+	cylinder{<0.952946,0.146905,1.8118>,<0.939392,0.112961,1.83209>,r}
+	sphere{<0.939392,0.112961,1.83209>,r}
+	cylinder{<0.939392,0.112961,1.83209>,<0.906622,0.0260303,1.74343>,r}
+	sphere{<0.906622,0.0260303,1.74343>,r}
+	cylinder{<0.906622,0.0260303,1.74343>,<0.942535,0.0980355,1.18279>,r}
+	sphere{<0.942535,0.0980355,1.18279>,r}
+	cylinder{<0.942535,0.0980355,1.18279>,<1.01034,0.269907,1.13997>,r}
+	sphere{<1.01034,0.269907,1.13997>,r}
+	cylinder{<1.01034,0.269907,1.13997>,<1.06247,0.41464,1.46334>,r}
+	sphere{<1.06247,0.41464,1.46334>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.00637,0.00250093,1.89646>,<1.83399,-0.256319,2.03732>,<1.98235,-0.501619,1.88902>}
+	triangle{<1.00637,0.00250093,1.89646>,<1.98235,-0.501619,1.88902>,<1.89413,-0.66035,1.71143>}
+	triangle{<1.00637,0.00250093,1.89646>,<1.89413,-0.66035,1.71143>,<1.35885,-0.673828,1.46251>}
+	triangle{<1.00637,0.00250093,1.89646>,<1.35885,-0.673828,1.46251>,<0.969008,-0.0924176,1.79709>}
+	texture{t1}
+}
+union{
+	cylinder{<1.00637,0.00250093,1.89646>,<1.83399,-0.256319,2.03732>,r}
+	sphere{<1.83399,-0.256319,2.03732>,r}
+	cylinder{<1.83399,-0.256319,2.03732>,<1.98235,-0.501619,1.88902>,r}
+	sphere{<1.98235,-0.501619,1.88902>,r}
+	cylinder{<1.98235,-0.501619,1.88902>,<1.89413,-0.66035,1.71143>,r}
+	sphere{<1.89413,-0.66035,1.71143>,r}
+	cylinder{<1.89413,-0.66035,1.71143>,<1.35885,-0.673828,1.46251>,r}
+	sphere{<1.35885,-0.673828,1.46251>,r}
+	cylinder{<1.35885,-0.673828,1.46251>,<0.969008,-0.0924176,1.79709>,r}
+	sphere{<0.969008,-0.0924176,1.79709>,r}
+	cylinder{<0.969008,-0.0924176,1.79709>,<1.00637,0.00250093,1.89646>,r}
+	sphere{<1.00637,0.00250093,1.89646>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.34603,0.507398,0>,<-1.34615,0.507442,0.887647>,<-1.29467,0.596157,0.956551>}
+	triangle{<-1.34603,0.507398,0>,<-1.29467,0.596157,0.956551>,<-1.08794,0.952315,0.934372>}
+	triangle{<-1.34603,0.507398,0>,<-1.08794,0.952315,0.934372>,<-1.05626,1.00688,0.894083>}
+	triangle{<-1.34603,0.507398,0>,<-1.05626,1.00688,0.894083>,<-1.05613,1.00685,0>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.34603,0.507398,0>,<-1.34615,0.507442,0.887647>,r}
+	sphere{<-1.34615,0.507442,0.887647>,r}
+	cylinder{<-1.34615,0.507442,0.887647>,<-1.29467,0.596157,0.956551>,r}
+	sphere{<-1.29467,0.596157,0.956551>,r}
+	cylinder{<-1.29467,0.596157,0.956551>,<-1.08794,0.952315,0.934372>,r}
+	sphere{<-1.08794,0.952315,0.934372>,r}
+	cylinder{<-1.08794,0.952315,0.934372>,<-1.05626,1.00688,0.894083>,r}
+	sphere{<-1.05626,1.00688,0.894083>,r}
+	cylinder{<-1.05626,1.00688,0.894083>,<-1.05613,1.00685,0>,r}
+	sphere{<-1.05613,1.00685,0>,r}
+	cylinder{<-1.05613,1.00685,0>,<-1.34603,0.507398,0>,r}
+	sphere{<-1.34603,0.507398,0>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.71816,1.85607,-5.55112e-17>,<-1.65756,1.86105,0>,<-1.51756,1.81025,0.111117>}
+	triangle{<-1.71816,1.85607,-5.55112e-17>,<-1.51756,1.81025,0.111117>,<-1.25664,1.35576,0.959953>}
+	triangle{<-1.71816,1.85607,-5.55112e-17>,<-1.25664,1.35576,0.959953>,<-1.95132,1.25031,1.04624>}
+	triangle{<-1.71816,1.85607,-5.55112e-17>,<-1.95132,1.25031,1.04624>,<-2.04673,1.29629,0.950267>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.71816,1.85607,-5.55112e-17>,<-1.65756,1.86105,0>,r}
+	sphere{<-1.65756,1.86105,0>,r}
+	cylinder{<-1.65756,1.86105,0>,<-1.51756,1.81025,0.111117>,r}
+	sphere{<-1.51756,1.81025,0.111117>,r}
+	cylinder{<-1.51756,1.81025,0.111117>,<-1.25664,1.35576,0.959953>,r}
+	sphere{<-1.25664,1.35576,0.959953>,r}
+	cylinder{<-1.25664,1.35576,0.959953>,<-1.95132,1.25031,1.04624>,r}
+	sphere{<-1.95132,1.25031,1.04624>,r}
+	cylinder{<-1.95132,1.25031,1.04624>,<-2.04673,1.29629,0.950267>,r}
+	sphere{<-2.04673,1.29629,0.950267>,r}
+	cylinder{<-2.04673,1.29629,0.950267>,<-1.71816,1.85607,-5.55112e-17>,r}
+	sphere{<-1.71816,1.85607,-5.55112e-17>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.05613,1.00685,0>,<-1.05626,1.00688,0.894083>,<-1.08634,1.05925,0.935324>}
+	triangle{<-1.05613,1.00685,0>,<-1.08634,1.05925,0.935324>,<-1.25664,1.35576,0.959953>}
+	triangle{<-1.05613,1.00685,0>,<-1.25664,1.35576,0.959953>,<-1.51756,1.81025,0.111117>}
+	triangle{<-1.05613,1.00685,0>,<-1.51756,1.81025,0.111117>,<-1.51755,1.81026,0>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.05613,1.00685,0>,<-1.05626,1.00688,0.894083>,r}
+	sphere{<-1.05626,1.00688,0.894083>,r}
+	cylinder{<-1.05626,1.00688,0.894083>,<-1.08634,1.05925,0.935324>,r}
+	sphere{<-1.08634,1.05925,0.935324>,r}
+	cylinder{<-1.08634,1.05925,0.935324>,<-1.25664,1.35576,0.959953>,r}
+	sphere{<-1.25664,1.35576,0.959953>,r}
+	cylinder{<-1.25664,1.35576,0.959953>,<-1.51756,1.81025,0.111117>,r}
+	sphere{<-1.51756,1.81025,0.111117>,r}
+	cylinder{<-1.51756,1.81025,0.111117>,<-1.51755,1.81026,0>,r}
+	sphere{<-1.51755,1.81026,0>,r}
+	cylinder{<-1.51755,1.81026,0>,<-1.05613,1.00685,0>,r}
+	sphere{<-1.05613,1.00685,0>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.25664,1.35576,0.959953>,<-1.06555,1.53198,1.19335>,<-1.11753,1.60278,1.33726>}
+	triangle{<-1.25664,1.35576,0.959953>,<-1.11753,1.60278,1.33726>,<-1.45609,1.6729,1.59156>}
+	triangle{<-1.25664,1.35576,0.959953>,<-1.45609,1.6729,1.59156>,<-1.98744,1.41396,1.34614>}
+	triangle{<-1.25664,1.35576,0.959953>,<-1.98744,1.41396,1.34614>,<-1.95132,1.25031,1.04624>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.25664,1.35576,0.959953>,<-1.06555,1.53198,1.19335>,r}
+	sphere{<-1.06555,1.53198,1.19335>,r}
+	cylinder{<-1.06555,1.53198,1.19335>,<-1.11753,1.60278,1.33726>,r}
+	sphere{<-1.11753,1.60278,1.33726>,r}
+	cylinder{<-1.11753,1.60278,1.33726>,<-1.45609,1.6729,1.59156>,r}
+	sphere{<-1.45609,1.6729,1.59156>,r}
+	cylinder{<-1.45609,1.6729,1.59156>,<-1.98744,1.41396,1.34614>,r}
+	sphere{<-1.98744,1.41396,1.34614>,r}
+	cylinder{<-1.98744,1.41396,1.34614>,<-1.95132,1.25031,1.04624>,r}
+	sphere{<-1.95132,1.25031,1.04624>,r}
+	cylinder{<-1.95132,1.25031,1.04624>,<-1.25664,1.35576,0.959953>,r}
+	sphere{<-1.25664,1.35576,0.959953>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.19537,0.515335,1.82418>,<-2.04469,0.516525,1.67948>,<-1.79014,0.282239,1.53312>}
+	triangle{<-2.19537,0.515335,1.82418>,<-1.79014,0.282239,1.53312>,<-1.7878,0.208445,1.56151>}
+	triangle{<-2.19537,0.515335,1.82418>,<-1.7878,0.208445,1.56151>,<-2.07273,0.0954326,1.88112>}
+	triangle{<-2.19537,0.515335,1.82418>,<-2.07273,0.0954326,1.88112>,<-2.24332,0.424641,1.90773>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.19537,0.515335,1.82418>,<-2.04469,0.516525,1.67948>,r}
+	sphere{<-2.04469,0.516525,1.67948>,r}
+	cylinder{<-2.04469,0.516525,1.67948>,<-1.79014,0.282239,1.53312>,r}
+	sphere{<-1.79014,0.282239,1.53312>,r}
+	cylinder{<-1.79014,0.282239,1.53312>,<-1.7878,0.208445,1.56151>,r}
+	sphere{<-1.7878,0.208445,1.56151>,r}
+	cylinder{<-1.7878,0.208445,1.56151>,<-2.07273,0.0954326,1.88112>,r}
+	sphere{<-2.07273,0.0954326,1.88112>,r}
+	cylinder{<-2.07273,0.0954326,1.88112>,<-2.24332,0.424641,1.90773>,r}
+	sphere{<-2.24332,0.424641,1.90773>,r}
+	cylinder{<-2.24332,0.424641,1.90773>,<-2.19537,0.515335,1.82418>,r}
+	sphere{<-2.19537,0.515335,1.82418>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.07273,0.0954326,1.88112>,<-1.7878,0.208445,1.56151>,<-1.78809,-0.121555,1.20432>}
+	triangle{<-2.07273,0.0954326,1.88112>,<-1.78809,-0.121555,1.20432>,<-1.93672,-0.469043,1.05835>}
+	triangle{<-2.07273,0.0954326,1.88112>,<-1.93672,-0.469043,1.05835>,<-1.96598,-0.496097,1.07443>}
+	triangle{<-2.07273,0.0954326,1.88112>,<-1.96598,-0.496097,1.07443>,<-2.44674,-0.48984,1.82713>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.07273,0.0954326,1.88112>,<-1.7878,0.208445,1.56151>,r}
+	sphere{<-1.7878,0.208445,1.56151>,r}
+	cylinder{<-1.7878,0.208445,1.56151>,<-1.78809,-0.121555,1.20432>,r}
+	sphere{<-1.78809,-0.121555,1.20432>,r}
+	cylinder{<-1.78809,-0.121555,1.20432>,<-1.93672,-0.469043,1.05835>,r}
+	sphere{<-1.93672,-0.469043,1.05835>,r}
+	cylinder{<-1.93672,-0.469043,1.05835>,<-1.96598,-0.496097,1.07443>,r}
+	sphere{<-1.96598,-0.496097,1.07443>,r}
+	cylinder{<-1.96598,-0.496097,1.07443>,<-2.44674,-0.48984,1.82713>,r}
+	sphere{<-2.44674,-0.48984,1.82713>,r}
+	cylinder{<-2.44674,-0.48984,1.82713>,<-2.07273,0.0954326,1.88112>,r}
+	sphere{<-2.07273,0.0954326,1.88112>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.05626,1.00688,0.894083>,<-0.462862,1.00551,0.719907>,<-0.22047,0.532513,0.916717>}
+	triangle{<-1.05626,1.00688,0.894083>,<-0.22047,0.532513,0.916717>,<-0.404275,0.27521,1.11685>}
+	triangle{<-1.05626,1.00688,0.894083>,<-0.404275,0.27521,1.11685>,<-1.06878,0.674732,1.08617>}
+	triangle{<-1.05626,1.00688,0.894083>,<-1.06878,0.674732,1.08617>,<-1.08794,0.952315,0.934372>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.05626,1.00688,0.894083>,<-0.462862,1.00551,0.719907>,r}
+	sphere{<-0.462862,1.00551,0.719907>,r}
+	cylinder{<-0.462862,1.00551,0.719907>,<-0.22047,0.532513,0.916717>,r}
+	sphere{<-0.22047,0.532513,0.916717>,r}
+	cylinder{<-0.22047,0.532513,0.916717>,<-0.404275,0.27521,1.11685>,r}
+	sphere{<-0.404275,0.27521,1.11685>,r}
+	cylinder{<-0.404275,0.27521,1.11685>,<-1.06878,0.674732,1.08617>,r}
+	sphere{<-1.06878,0.674732,1.08617>,r}
+	cylinder{<-1.06878,0.674732,1.08617>,<-1.08794,0.952315,0.934372>,r}
+	sphere{<-1.08794,0.952315,0.934372>,r}
+	cylinder{<-1.08794,0.952315,0.934372>,<-1.05626,1.00688,0.894083>,r}
+	sphere{<-1.05626,1.00688,0.894083>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.404275,0.27521,1.11685>,<-0.407257,0.275269,1.32614>,<-0.101644,0.718748,1.7556>}
+	triangle{<-0.404275,0.27521,1.11685>,<-0.101644,0.718748,1.7556>,<0.0822352,0.977396,1.61574>}
+	triangle{<-0.404275,0.27521,1.11685>,<0.0822352,0.977396,1.61574>,<0.102157,0.996166,1.15028>}
+	triangle{<-0.404275,0.27521,1.11685>,<0.102157,0.996166,1.15028>,<-0.22047,0.532513,0.916717>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.404275,0.27521,1.11685>,<-0.407257,0.275269,1.32614>,r}
+	sphere{<-0.407257,0.275269,1.32614>,r}
+	cylinder{<-0.407257,0.275269,1.32614>,<-0.101644,0.718748,1.7556>,r}
+	sphere{<-0.101644,0.718748,1.7556>,r}
+	cylinder{<-0.101644,0.718748,1.7556>,<0.0822352,0.977396,1.61574>,r}
+	sphere{<0.0822352,0.977396,1.61574>,r}
+	cylinder{<0.0822352,0.977396,1.61574>,<0.102157,0.996166,1.15028>,r}
+	sphere{<0.102157,0.996166,1.15028>,r}
+	cylinder{<0.102157,0.996166,1.15028>,<-0.22047,0.532513,0.916717>,r}
+	sphere{<-0.22047,0.532513,0.916717>,r}
+	cylinder{<-0.22047,0.532513,0.916717>,<-0.404275,0.27521,1.11685>,r}
+	sphere{<-0.404275,0.27521,1.11685>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.343476,1.55777,1.7129>,<-0.35987,1.58377,1.68004>,<-0.285067,1.54747,1.00385>}
+	triangle{<-0.343476,1.55777,1.7129>,<-0.285067,1.54747,1.00385>,<-0.198477,1.4368,0.909974>}
+	triangle{<-0.343476,1.55777,1.7129>,<-0.198477,1.4368,0.909974>,<0.102157,0.996166,1.15028>}
+	triangle{<-0.343476,1.55777,1.7129>,<0.102157,0.996166,1.15028>,<0.0822352,0.977396,1.61574>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.343476,1.55777,1.7129>,<-0.35987,1.58377,1.68004>,r}
+	sphere{<-0.35987,1.58377,1.68004>,r}
+	cylinder{<-0.35987,1.58377,1.68004>,<-0.285067,1.54747,1.00385>,r}
+	sphere{<-0.285067,1.54747,1.00385>,r}
+	cylinder{<-0.285067,1.54747,1.00385>,<-0.198477,1.4368,0.909974>,r}
+	sphere{<-0.198477,1.4368,0.909974>,r}
+	cylinder{<-0.198477,1.4368,0.909974>,<0.102157,0.996166,1.15028>,r}
+	sphere{<0.102157,0.996166,1.15028>,r}
+	cylinder{<0.102157,0.996166,1.15028>,<0.0822352,0.977396,1.61574>,r}
+	sphere{<0.0822352,0.977396,1.61574>,r}
+	cylinder{<0.0822352,0.977396,1.61574>,<-0.343476,1.55777,1.7129>,r}
+	sphere{<-0.343476,1.55777,1.7129>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.929811,0.826881,0.0651549>,<0.547406,0.596372,0.799421>,<0.365591,1.00018,1.09846>}
+	triangle{<0.929811,0.826881,0.0651549>,<0.365591,1.00018,1.09846>,<0.478631,1.3294,0.85594>}
+	triangle{<0.929811,0.826881,0.0651549>,<0.478631,1.3294,0.85594>,<0.953845,1.03624,-5.55112e-17>}
+	triangle{<0.929811,0.826881,0.0651549>,<0.953845,1.03624,-5.55112e-17>,<0.960673,0.905935,-5.55112e-17>}
+	texture{t1}
+}
+union{
+	cylinder{<0.929811,0.826881,0.0651549>,<0.547406,0.596372,0.799421>,r}
+	sphere{<0.547406,0.596372,0.799421>,r}
+	cylinder{<0.547406,0.596372,0.799421>,<0.365591,1.00018,1.09846>,r}
+	sphere{<0.365591,1.00018,1.09846>,r}
+	cylinder{<0.365591,1.00018,1.09846>,<0.478631,1.3294,0.85594>,r}
+	sphere{<0.478631,1.3294,0.85594>,r}
+	cylinder{<0.478631,1.3294,0.85594>,<0.953845,1.03624,-5.55112e-17>,r}
+	sphere{<0.953845,1.03624,-5.55112e-17>,r}
+	cylinder{<0.953845,1.03624,-5.55112e-17>,<0.960673,0.905935,-5.55112e-17>,r}
+	sphere{<0.960673,0.905935,-5.55112e-17>,r}
+	cylinder{<0.960673,0.905935,-5.55112e-17>,<0.929811,0.826881,0.0651549>,r}
+	sphere{<0.929811,0.826881,0.0651549>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.01034,0.269907,1.13997>,<0.942535,0.0980355,1.18279>,<0.315359,-0.174678,1.0231>}
+	triangle{<1.01034,0.269907,1.13997>,<0.315359,-0.174678,1.0231>,<-0.108834,0.0873227,0.726719>}
+	triangle{<1.01034,0.269907,1.13997>,<-0.108834,0.0873227,0.726719>,<-0.0642487,0.227653,0.68704>}
+	triangle{<1.01034,0.269907,1.13997>,<-0.0642487,0.227653,0.68704>,<0.547406,0.596372,0.799421>}
+	texture{t1}
+}
+union{
+	cylinder{<1.01034,0.269907,1.13997>,<0.942535,0.0980355,1.18279>,r}
+	sphere{<0.942535,0.0980355,1.18279>,r}
+	cylinder{<0.942535,0.0980355,1.18279>,<0.315359,-0.174678,1.0231>,r}
+	sphere{<0.315359,-0.174678,1.0231>,r}
+	cylinder{<0.315359,-0.174678,1.0231>,<-0.108834,0.0873227,0.726719>,r}
+	sphere{<-0.108834,0.0873227,0.726719>,r}
+	cylinder{<-0.108834,0.0873227,0.726719>,<-0.0642487,0.227653,0.68704>,r}
+	sphere{<-0.0642487,0.227653,0.68704>,r}
+	cylinder{<-0.0642487,0.227653,0.68704>,<0.547406,0.596372,0.799421>,r}
+	sphere{<0.547406,0.596372,0.799421>,r}
+	cylinder{<0.547406,0.596372,0.799421>,<1.01034,0.269907,1.13997>,r}
+	sphere{<1.01034,0.269907,1.13997>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.83644,0.527626,1.15404>,<2.05994,0.147814,0.940181>,<1.88557,-0.181912,0.757347>}
+	triangle{<1.83644,0.527626,1.15404>,<1.88557,-0.181912,0.757347>,<1.2392,-0.0588833,0.831019>}
+	triangle{<1.83644,0.527626,1.15404>,<1.2392,-0.0588833,0.831019>,<1.11781,0.289047,1.02629>}
+	triangle{<1.83644,0.527626,1.15404>,<1.11781,0.289047,1.02629>,<1.52731,0.572538,1.1815>}
+	texture{t1}
+}
+union{
+	cylinder{<1.83644,0.527626,1.15404>,<2.05994,0.147814,0.940181>,r}
+	sphere{<2.05994,0.147814,0.940181>,r}
+	cylinder{<2.05994,0.147814,0.940181>,<1.88557,-0.181912,0.757347>,r}
+	sphere{<1.88557,-0.181912,0.757347>,r}
+	cylinder{<1.88557,-0.181912,0.757347>,<1.2392,-0.0588833,0.831019>,r}
+	sphere{<1.2392,-0.0588833,0.831019>,r}
+	cylinder{<1.2392,-0.0588833,0.831019>,<1.11781,0.289047,1.02629>,r}
+	sphere{<1.11781,0.289047,1.02629>,r}
+	cylinder{<1.11781,0.289047,1.02629>,<1.52731,0.572538,1.1815>,r}
+	sphere{<1.52731,0.572538,1.1815>,r}
+	cylinder{<1.52731,0.572538,1.1815>,<1.83644,0.527626,1.15404>,r}
+	sphere{<1.83644,0.527626,1.15404>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.929811,0.826881,0.0651549>,<0.960673,0.905935,5.55112e-17>,<1.06662,1.00942,5.55112e-17>}
+	triangle{<0.929811,0.826881,0.0651549>,<1.06662,1.00942,5.55112e-17>,<1.68884,0.961273,0.873814>}
+	triangle{<0.929811,0.826881,0.0651549>,<1.68884,0.961273,0.873814>,<1.52731,0.572538,1.1815>}
+	triangle{<0.929811,0.826881,0.0651549>,<1.52731,0.572538,1.1815>,<1.11781,0.289047,1.02629>}
+	texture{t1}
+}
+union{
+	cylinder{<0.929811,0.826881,0.0651549>,<0.960673,0.905935,5.55112e-17>,r}
+	sphere{<0.960673,0.905935,5.55112e-17>,r}
+	cylinder{<0.960673,0.905935,5.55112e-17>,<1.06662,1.00942,5.55112e-17>,r}
+	sphere{<1.06662,1.00942,5.55112e-17>,r}
+	cylinder{<1.06662,1.00942,5.55112e-17>,<1.68884,0.961273,0.873814>,r}
+	sphere{<1.68884,0.961273,0.873814>,r}
+	cylinder{<1.68884,0.961273,0.873814>,<1.52731,0.572538,1.1815>,r}
+	sphere{<1.52731,0.572538,1.1815>,r}
+	cylinder{<1.52731,0.572538,1.1815>,<1.11781,0.289047,1.02629>,r}
+	sphere{<1.11781,0.289047,1.02629>,r}
+	cylinder{<1.11781,0.289047,1.02629>,<0.929811,0.826881,0.0651549>,r}
+	sphere{<0.929811,0.826881,0.0651549>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.36795,1.04118,1.15264>,<2.54723,1.11876,1.54033>,<2.09357,0.609993,1.82742>}
+	triangle{<2.36795,1.04118,1.15264>,<2.09357,0.609993,1.82742>,<1.88142,0.457715,1.61407>}
+	triangle{<2.36795,1.04118,1.15264>,<1.88142,0.457715,1.61407>,<1.83644,0.527626,1.15404>}
+	triangle{<2.36795,1.04118,1.15264>,<1.83644,0.527626,1.15404>,<2.00414,0.733602,0.97523>}
+	texture{t1}
+}
+union{
+	cylinder{<2.36795,1.04118,1.15264>,<2.54723,1.11876,1.54033>,r}
+	sphere{<2.54723,1.11876,1.54033>,r}
+	cylinder{<2.54723,1.11876,1.54033>,<2.09357,0.609993,1.82742>,r}
+	sphere{<2.09357,0.609993,1.82742>,r}
+	cylinder{<2.09357,0.609993,1.82742>,<1.88142,0.457715,1.61407>,r}
+	sphere{<1.88142,0.457715,1.61407>,r}
+	cylinder{<1.88142,0.457715,1.61407>,<1.83644,0.527626,1.15404>,r}
+	sphere{<1.83644,0.527626,1.15404>,r}
+	cylinder{<1.83644,0.527626,1.15404>,<2.00414,0.733602,0.97523>,r}
+	sphere{<2.00414,0.733602,0.97523>,r}
+	cylinder{<2.00414,0.733602,0.97523>,<2.36795,1.04118,1.15264>,r}
+	sphere{<2.36795,1.04118,1.15264>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.05994,0.147814,0.940181>,<1.83644,0.527626,1.15404>,<1.88142,0.457715,1.61407>}
+	triangle{<2.05994,0.147814,0.940181>,<1.88142,0.457715,1.61407>,<2.06876,0.144048,1.7969>}
+	triangle{<2.05994,0.147814,0.940181>,<2.06876,0.144048,1.7969>,<2.20607,-0.0893575,1.6597>}
+	triangle{<2.05994,0.147814,0.940181>,<2.20607,-0.0893575,1.6597>,<2.20156,-0.0892997,1.07704>}
+	texture{t1}
+}
+union{
+	cylinder{<2.05994,0.147814,0.940181>,<1.83644,0.527626,1.15404>,r}
+	sphere{<1.83644,0.527626,1.15404>,r}
+	cylinder{<1.83644,0.527626,1.15404>,<1.88142,0.457715,1.61407>,r}
+	sphere{<1.88142,0.457715,1.61407>,r}
+	cylinder{<1.88142,0.457715,1.61407>,<2.06876,0.144048,1.7969>,r}
+	sphere{<2.06876,0.144048,1.7969>,r}
+	cylinder{<2.06876,0.144048,1.7969>,<2.20607,-0.0893575,1.6597>,r}
+	sphere{<2.20607,-0.0893575,1.6597>,r}
+	cylinder{<2.20607,-0.0893575,1.6597>,<2.20156,-0.0892997,1.07704>,r}
+	sphere{<2.20156,-0.0892997,1.07704>,r}
+	cylinder{<2.20156,-0.0892997,1.07704>,<2.05994,0.147814,0.940181>,r}
+	sphere{<2.05994,0.147814,0.940181>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.93514,2.19196,1.50044>,<-1.84929,2.62433,1.09525>,<-1.70497,2.68196,0.987495>}
+	triangle{<-1.93514,2.19196,1.50044>,<-1.70497,2.68196,0.987495>,<-1.20777,2.29467,1.11824>}
+	triangle{<-1.93514,2.19196,1.50044>,<-1.20777,2.29467,1.11824>,<-1.21165,1.88255,1.47292>}
+	triangle{<-1.93514,2.19196,1.50044>,<-1.21165,1.88255,1.47292>,<-1.4456,1.82018,1.62099>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.93514,2.19196,1.50044>,<-1.84929,2.62433,1.09525>,r}
+	sphere{<-1.84929,2.62433,1.09525>,r}
+	cylinder{<-1.84929,2.62433,1.09525>,<-1.70497,2.68196,0.987495>,r}
+	sphere{<-1.70497,2.68196,0.987495>,r}
+	cylinder{<-1.70497,2.68196,0.987495>,<-1.20777,2.29467,1.11824>,r}
+	sphere{<-1.20777,2.29467,1.11824>,r}
+	cylinder{<-1.20777,2.29467,1.11824>,<-1.21165,1.88255,1.47292>,r}
+	sphere{<-1.21165,1.88255,1.47292>,r}
+	cylinder{<-1.21165,1.88255,1.47292>,<-1.4456,1.82018,1.62099>,r}
+	sphere{<-1.4456,1.82018,1.62099>,r}
+	cylinder{<-1.4456,1.82018,1.62099>,<-1.93514,2.19196,1.50044>,r}
+	sphere{<-1.93514,2.19196,1.50044>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.590328,3,1.06961>,<-0.294948,3,1.26127>,<-0.156366,2.80794,1.25544>}
+	triangle{<-0.590328,3,1.06961>,<-0.156366,2.80794,1.25544>,<0.0600476,2.11391,1.04987>}
+	triangle{<-0.590328,3,1.06961>,<0.0600476,2.11391,1.04987>,<-0.105826,1.78367,0.777611>}
+	triangle{<-0.590328,3,1.06961>,<-0.105826,1.78367,0.777611>,<-0.590355,2.11428,0.628044>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.590328,3,1.06961>,<-0.294948,3,1.26127>,r}
+	sphere{<-0.294948,3,1.26127>,r}
+	cylinder{<-0.294948,3,1.26127>,<-0.156366,2.80794,1.25544>,r}
+	sphere{<-0.156366,2.80794,1.25544>,r}
+	cylinder{<-0.156366,2.80794,1.25544>,<0.0600476,2.11391,1.04987>,r}
+	sphere{<0.0600476,2.11391,1.04987>,r}
+	cylinder{<0.0600476,2.11391,1.04987>,<-0.105826,1.78367,0.777611>,r}
+	sphere{<-0.105826,1.78367,0.777611>,r}
+	cylinder{<-0.105826,1.78367,0.777611>,<-0.590355,2.11428,0.628044>,r}
+	sphere{<-0.590355,2.11428,0.628044>,r}
+	cylinder{<-0.590355,2.11428,0.628044>,<-0.590328,3,1.06961>,r}
+	sphere{<-0.590328,3,1.06961>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.642002,2.54541,0.494318>,<0.180503,2.05174,0.935062>,<0.0600476,2.11391,1.04987>}
+	triangle{<0.642002,2.54541,0.494318>,<0.0600476,2.11391,1.04987>,<-0.156366,2.80794,1.25544>}
+	triangle{<0.642002,2.54541,0.494318>,<-0.156366,2.80794,1.25544>,<-0.156601,3,1.25543>}
+	triangle{<0.642002,2.54541,0.494318>,<-0.156601,3,1.25543>,<0.641993,3,0.49378>}
+	texture{t1}
+}
+union{
+	cylinder{<0.642002,2.54541,0.494318>,<0.180503,2.05174,0.935062>,r}
+	sphere{<0.180503,2.05174,0.935062>,r}
+	cylinder{<0.180503,2.05174,0.935062>,<0.0600476,2.11391,1.04987>,r}
+	sphere{<0.0600476,2.11391,1.04987>,r}
+	cylinder{<0.0600476,2.11391,1.04987>,<-0.156366,2.80794,1.25544>,r}
+	sphere{<-0.156366,2.80794,1.25544>,r}
+	cylinder{<-0.156366,2.80794,1.25544>,<-0.156601,3,1.25543>,r}
+	sphere{<-0.156601,3,1.25543>,r}
+	cylinder{<-0.156601,3,1.25543>,<0.641993,3,0.49378>,r}
+	sphere{<0.641993,3,0.49378>,r}
+	cylinder{<0.641993,3,0.49378>,<0.642002,2.54541,0.494318>,r}
+	sphere{<0.642002,2.54541,0.494318>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.0600476,2.11391,1.04987>,<-0.105826,1.78367,0.777611>,<-0.285067,1.54747,1.00385>}
+	triangle{<0.0600476,2.11391,1.04987>,<-0.285067,1.54747,1.00385>,<-0.35987,1.58377,1.68004>}
+	triangle{<0.0600476,2.11391,1.04987>,<-0.35987,1.58377,1.68004>,<-0.254164,1.79728,1.86675>}
+	triangle{<0.0600476,2.11391,1.04987>,<-0.254164,1.79728,1.86675>,<0.0519754,2.1873,1.42251>}
+	texture{t1}
+}
+union{
+	cylinder{<0.0600476,2.11391,1.04987>,<-0.105826,1.78367,0.777611>,r}
+	sphere{<-0.105826,1.78367,0.777611>,r}
+	cylinder{<-0.105826,1.78367,0.777611>,<-0.285067,1.54747,1.00385>,r}
+	sphere{<-0.285067,1.54747,1.00385>,r}
+	cylinder{<-0.285067,1.54747,1.00385>,<-0.35987,1.58377,1.68004>,r}
+	sphere{<-0.35987,1.58377,1.68004>,r}
+	cylinder{<-0.35987,1.58377,1.68004>,<-0.254164,1.79728,1.86675>,r}
+	sphere{<-0.254164,1.79728,1.86675>,r}
+	cylinder{<-0.254164,1.79728,1.86675>,<0.0519754,2.1873,1.42251>,r}
+	sphere{<0.0519754,2.1873,1.42251>,r}
+	cylinder{<0.0519754,2.1873,1.42251>,<0.0600476,2.11391,1.04987>,r}
+	sphere{<0.0600476,2.11391,1.04987>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.590355,2.11428,0.628044>,<-1.07003,1.95698,0.860582>,<-1.06555,1.53198,1.19335>}
+	triangle{<-0.590355,2.11428,0.628044>,<-1.06555,1.53198,1.19335>,<-1.0398,1.51262,1.2027>}
+	triangle{<-0.590355,2.11428,0.628044>,<-1.0398,1.51262,1.2027>,<-0.285067,1.54747,1.00385>}
+	triangle{<-0.590355,2.11428,0.628044>,<-0.285067,1.54747,1.00385>,<-0.105826,1.78367,0.777611>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.590355,2.11428,0.628044>,<-1.07003,1.95698,0.860582>,r}
+	sphere{<-1.07003,1.95698,0.860582>,r}
+	cylinder{<-1.07003,1.95698,0.860582>,<-1.06555,1.53198,1.19335>,r}
+	sphere{<-1.06555,1.53198,1.19335>,r}
+	cylinder{<-1.06555,1.53198,1.19335>,<-1.0398,1.51262,1.2027>,r}
+	sphere{<-1.0398,1.51262,1.2027>,r}
+	cylinder{<-1.0398,1.51262,1.2027>,<-0.285067,1.54747,1.00385>,r}
+	sphere{<-0.285067,1.54747,1.00385>,r}
+	cylinder{<-0.285067,1.54747,1.00385>,<-0.105826,1.78367,0.777611>,r}
+	sphere{<-0.105826,1.78367,0.777611>,r}
+	cylinder{<-0.105826,1.78367,0.777611>,<-0.590355,2.11428,0.628044>,r}
+	sphere{<-0.590355,2.11428,0.628044>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.821869,3,1.21971>,<-0.65148,3,1.53801>,<-0.71772,2.49733,1.85572>}
+	triangle{<-0.821869,3,1.21971>,<-0.71772,2.49733,1.85572>,<-0.79965,2.26172,1.90959>}
+	triangle{<-0.821869,3,1.21971>,<-0.79965,2.26172,1.90959>,<-1.21165,1.88255,1.47292>}
+	triangle{<-0.821869,3,1.21971>,<-1.21165,1.88255,1.47292>,<-1.20777,2.29467,1.11824>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.821869,3,1.21971>,<-0.65148,3,1.53801>,r}
+	sphere{<-0.65148,3,1.53801>,r}
+	cylinder{<-0.65148,3,1.53801>,<-0.71772,2.49733,1.85572>,r}
+	sphere{<-0.71772,2.49733,1.85572>,r}
+	cylinder{<-0.71772,2.49733,1.85572>,<-0.79965,2.26172,1.90959>,r}
+	sphere{<-0.79965,2.26172,1.90959>,r}
+	cylinder{<-0.79965,2.26172,1.90959>,<-1.21165,1.88255,1.47292>,r}
+	sphere{<-1.21165,1.88255,1.47292>,r}
+	cylinder{<-1.21165,1.88255,1.47292>,<-1.20777,2.29467,1.11824>,r}
+	sphere{<-1.20777,2.29467,1.11824>,r}
+	cylinder{<-1.20777,2.29467,1.11824>,<-0.821869,3,1.21971>,r}
+	sphere{<-0.821869,3,1.21971>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.70489,1.90767,0>,<-1.70497,2.68196,0.987495>,<-1.20777,2.29467,1.11824>}
+	triangle{<-1.70489,1.90767,0>,<-1.20777,2.29467,1.11824>,<-1.07003,1.95698,0.860582>}
+	triangle{<-1.70489,1.90767,0>,<-1.07003,1.95698,0.860582>,<-1.51756,1.81025,0.111117>}
+	triangle{<-1.70489,1.90767,0>,<-1.51756,1.81025,0.111117>,<-1.65756,1.86105,-5.55112e-17>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.70489,1.90767,0>,<-1.70497,2.68196,0.987495>,r}
+	sphere{<-1.70497,2.68196,0.987495>,r}
+	cylinder{<-1.70497,2.68196,0.987495>,<-1.20777,2.29467,1.11824>,r}
+	sphere{<-1.20777,2.29467,1.11824>,r}
+	cylinder{<-1.20777,2.29467,1.11824>,<-1.07003,1.95698,0.860582>,r}
+	sphere{<-1.07003,1.95698,0.860582>,r}
+	cylinder{<-1.07003,1.95698,0.860582>,<-1.51756,1.81025,0.111117>,r}
+	sphere{<-1.51756,1.81025,0.111117>,r}
+	cylinder{<-1.51756,1.81025,0.111117>,<-1.65756,1.86105,-5.55112e-17>,r}
+	sphere{<-1.65756,1.86105,-5.55112e-17>,r}
+	cylinder{<-1.65756,1.86105,-5.55112e-17>,<-1.70489,1.90767,0>,r}
+	sphere{<-1.70489,1.90767,0>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.08634,1.05925,0.935324>,<-1.0398,1.51262,1.2027>,<-0.285067,1.54747,1.00385>}
+	triangle{<-1.08634,1.05925,0.935324>,<-0.285067,1.54747,1.00385>,<-0.198477,1.4368,0.909974>}
+	triangle{<-1.08634,1.05925,0.935324>,<-0.198477,1.4368,0.909974>,<-0.462862,1.00551,0.719907>}
+	triangle{<-1.08634,1.05925,0.935324>,<-0.462862,1.00551,0.719907>,<-1.05626,1.00688,0.894083>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.08634,1.05925,0.935324>,<-1.0398,1.51262,1.2027>,r}
+	sphere{<-1.0398,1.51262,1.2027>,r}
+	cylinder{<-1.0398,1.51262,1.2027>,<-0.285067,1.54747,1.00385>,r}
+	sphere{<-0.285067,1.54747,1.00385>,r}
+	cylinder{<-0.285067,1.54747,1.00385>,<-0.198477,1.4368,0.909974>,r}
+	sphere{<-0.198477,1.4368,0.909974>,r}
+	cylinder{<-0.198477,1.4368,0.909974>,<-0.462862,1.00551,0.719907>,r}
+	sphere{<-0.462862,1.00551,0.719907>,r}
+	cylinder{<-0.462862,1.00551,0.719907>,<-1.05626,1.00688,0.894083>,r}
+	sphere{<-1.05626,1.00688,0.894083>,r}
+	cylinder{<-1.05626,1.00688,0.894083>,<-1.08634,1.05925,0.935324>,r}
+	sphere{<-1.08634,1.05925,0.935324>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.478631,1.3294,0.85594>,<-0.0608504,1.66131,0.733303>,<-0.0842946,1.76898,0.753389>}
+	triangle{<0.478631,1.3294,0.85594>,<-0.0842946,1.76898,0.753389>,<0.180503,2.05174,0.935062>}
+	triangle{<0.478631,1.3294,0.85594>,<0.180503,2.05174,0.935062>,<0.847338,1.86862,1.14856>}
+	triangle{<0.478631,1.3294,0.85594>,<0.847338,1.86862,1.14856>,<0.919402,1.68315,1.12648>}
+	texture{t1}
+}
+union{
+	cylinder{<0.478631,1.3294,0.85594>,<-0.0608504,1.66131,0.733303>,r}
+	sphere{<-0.0608504,1.66131,0.733303>,r}
+	cylinder{<-0.0608504,1.66131,0.733303>,<-0.0842946,1.76898,0.753389>,r}
+	sphere{<-0.0842946,1.76898,0.753389>,r}
+	cylinder{<-0.0842946,1.76898,0.753389>,<0.180503,2.05174,0.935062>,r}
+	sphere{<0.180503,2.05174,0.935062>,r}
+	cylinder{<0.180503,2.05174,0.935062>,<0.847338,1.86862,1.14856>,r}
+	sphere{<0.847338,1.86862,1.14856>,r}
+	cylinder{<0.847338,1.86862,1.14856>,<0.919402,1.68315,1.12648>,r}
+	sphere{<0.919402,1.68315,1.12648>,r}
+	cylinder{<0.919402,1.68315,1.12648>,<0.478631,1.3294,0.85594>,r}
+	sphere{<0.478631,1.3294,0.85594>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.528229,2.10027,1.80567>,<0.0519754,2.1873,1.42251>,<-0.156366,2.80794,1.25544>}
+	triangle{<0.528229,2.10027,1.80567>,<-0.156366,2.80794,1.25544>,<-0.156601,3,1.25543>}
+	triangle{<0.528229,2.10027,1.80567>,<-0.156601,3,1.25543>,<0.72654,3,1.9661>}
+	triangle{<0.528229,2.10027,1.80567>,<0.72654,3,1.9661>,<0.619034,2.24844,1.87888>}
+	texture{t1}
+}
+union{
+	cylinder{<0.528229,2.10027,1.80567>,<0.0519754,2.1873,1.42251>,r}
+	sphere{<0.0519754,2.1873,1.42251>,r}
+	cylinder{<0.0519754,2.1873,1.42251>,<-0.156366,2.80794,1.25544>,r}
+	sphere{<-0.156366,2.80794,1.25544>,r}
+	cylinder{<-0.156366,2.80794,1.25544>,<-0.156601,3,1.25543>,r}
+	sphere{<-0.156601,3,1.25543>,r}
+	cylinder{<-0.156601,3,1.25543>,<0.72654,3,1.9661>,r}
+	sphere{<0.72654,3,1.9661>,r}
+	cylinder{<0.72654,3,1.9661>,<0.619034,2.24844,1.87888>,r}
+	sphere{<0.619034,2.24844,1.87888>,r}
+	cylinder{<0.619034,2.24844,1.87888>,<0.528229,2.10027,1.80567>,r}
+	sphere{<0.528229,2.10027,1.80567>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.528229,2.10027,1.80567>,<0.509032,1.99565,1.95766>,<0.338843,1.81532,2.14813>}
+	triangle{<0.528229,2.10027,1.80567>,<0.338843,1.81532,2.14813>,<-0.251375,1.79469,1.87222>}
+	triangle{<0.528229,2.10027,1.80567>,<-0.251375,1.79469,1.87222>,<-0.254164,1.79728,1.86675>}
+	triangle{<0.528229,2.10027,1.80567>,<-0.254164,1.79728,1.86675>,<0.0519754,2.1873,1.42251>}
+	texture{t1}
+}
+union{
+	cylinder{<0.528229,2.10027,1.80567>,<0.509032,1.99565,1.95766>,r}
+	sphere{<0.509032,1.99565,1.95766>,r}
+	cylinder{<0.509032,1.99565,1.95766>,<0.338843,1.81532,2.14813>,r}
+	sphere{<0.338843,1.81532,2.14813>,r}
+	cylinder{<0.338843,1.81532,2.14813>,<-0.251375,1.79469,1.87222>,r}
+	sphere{<-0.251375,1.79469,1.87222>,r}
+	cylinder{<-0.251375,1.79469,1.87222>,<-0.254164,1.79728,1.86675>,r}
+	sphere{<-0.254164,1.79728,1.86675>,r}
+	cylinder{<-0.254164,1.79728,1.86675>,<0.0519754,2.1873,1.42251>,r}
+	sphere{<0.0519754,2.1873,1.42251>,r}
+	cylinder{<0.0519754,2.1873,1.42251>,<0.528229,2.10027,1.80567>,r}
+	sphere{<0.528229,2.10027,1.80567>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.528229,2.10027,1.80567>,<0.847338,1.86862,1.14856>,<0.919402,1.68315,1.12648>}
+	triangle{<0.528229,2.10027,1.80567>,<0.919402,1.68315,1.12648>,<0.895015,1.38366,1.47758>}
+	triangle{<0.528229,2.10027,1.80567>,<0.895015,1.38366,1.47758>,<0.549722,1.68002,2.14525>}
+	triangle{<0.528229,2.10027,1.80567>,<0.549722,1.68002,2.14525>,<0.509032,1.99565,1.95766>}
+	texture{t1}
+}
+union{
+	cylinder{<0.528229,2.10027,1.80567>,<0.847338,1.86862,1.14856>,r}
+	sphere{<0.847338,1.86862,1.14856>,r}
+	cylinder{<0.847338,1.86862,1.14856>,<0.919402,1.68315,1.12648>,r}
+	sphere{<0.919402,1.68315,1.12648>,r}
+	cylinder{<0.919402,1.68315,1.12648>,<0.895015,1.38366,1.47758>,r}
+	sphere{<0.895015,1.38366,1.47758>,r}
+	cylinder{<0.895015,1.38366,1.47758>,<0.549722,1.68002,2.14525>,r}
+	sphere{<0.549722,1.68002,2.14525>,r}
+	cylinder{<0.549722,1.68002,2.14525>,<0.509032,1.99565,1.95766>,r}
+	sphere{<0.509032,1.99565,1.95766>,r}
+	cylinder{<0.509032,1.99565,1.95766>,<0.528229,2.10027,1.80567>,r}
+	sphere{<0.528229,2.10027,1.80567>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.530114,1.67331,2.15806>,<0.549722,1.68002,2.14525>,<0.895015,1.38366,1.47758>}
+	triangle{<0.530114,1.67331,2.15806>,<0.895015,1.38366,1.47758>,<0.545504,0.988944,1.41241>}
+	triangle{<0.530114,1.67331,2.15806>,<0.545504,0.988944,1.41241>,<0.25591,0.975584,1.69301>}
+	triangle{<0.530114,1.67331,2.15806>,<0.25591,0.975584,1.69301>,<0.524795,1.66926,2.15916>}
+	texture{t1}
+}
+union{
+	cylinder{<0.530114,1.67331,2.15806>,<0.549722,1.68002,2.14525>,r}
+	sphere{<0.549722,1.68002,2.14525>,r}
+	cylinder{<0.549722,1.68002,2.14525>,<0.895015,1.38366,1.47758>,r}
+	sphere{<0.895015,1.38366,1.47758>,r}
+	cylinder{<0.895015,1.38366,1.47758>,<0.545504,0.988944,1.41241>,r}
+	sphere{<0.545504,0.988944,1.41241>,r}
+	cylinder{<0.545504,0.988944,1.41241>,<0.25591,0.975584,1.69301>,r}
+	sphere{<0.25591,0.975584,1.69301>,r}
+	cylinder{<0.25591,0.975584,1.69301>,<0.524795,1.66926,2.15916>,r}
+	sphere{<0.524795,1.66926,2.15916>,r}
+	cylinder{<0.524795,1.66926,2.15916>,<0.530114,1.67331,2.15806>,r}
+	sphere{<0.530114,1.67331,2.15806>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.76488,1.78374,1.20575>,<1.97423,1.82567,1.59266>,<2.46318,1.3254,1.68724>}
+	triangle{<1.76488,1.78374,1.20575>,<2.46318,1.3254,1.68724>,<2.54723,1.11876,1.54033>}
+	triangle{<1.76488,1.78374,1.20575>,<2.54723,1.11876,1.54033>,<2.36795,1.04118,1.15264>}
+	triangle{<1.76488,1.78374,1.20575>,<2.36795,1.04118,1.15264>,<2.08597,1.20835,0.933989>}
+	texture{t1}
+}
+union{
+	cylinder{<1.76488,1.78374,1.20575>,<1.97423,1.82567,1.59266>,r}
+	sphere{<1.97423,1.82567,1.59266>,r}
+	cylinder{<1.97423,1.82567,1.59266>,<2.46318,1.3254,1.68724>,r}
+	sphere{<2.46318,1.3254,1.68724>,r}
+	cylinder{<2.46318,1.3254,1.68724>,<2.54723,1.11876,1.54033>,r}
+	sphere{<2.54723,1.11876,1.54033>,r}
+	cylinder{<2.54723,1.11876,1.54033>,<2.36795,1.04118,1.15264>,r}
+	sphere{<2.36795,1.04118,1.15264>,r}
+	cylinder{<2.36795,1.04118,1.15264>,<2.08597,1.20835,0.933989>,r}
+	sphere{<2.08597,1.20835,0.933989>,r}
+	cylinder{<2.08597,1.20835,0.933989>,<1.76488,1.78374,1.20575>,r}
+	sphere{<1.76488,1.78374,1.20575>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.93586,2.16367,0.721027>,<1.93583,3,0.720905>,<3,3,1.44763>}
+	triangle{<1.93586,2.16367,0.721027>,<3,3,1.44763>,<3,2.59538,1.44768>}
+	triangle{<1.93586,2.16367,0.721027>,<3,2.59538,1.44768>,<2.9997,2.59484,1.44747>}
+	triangle{<1.93586,2.16367,0.721027>,<2.9997,2.59484,1.44747>,<2.02764,2.08717,0.783716>}
+	texture{t1}
+}
+union{
+	cylinder{<1.93586,2.16367,0.721027>,<1.93583,3,0.720905>,r}
+	sphere{<1.93583,3,0.720905>,r}
+	cylinder{<1.93583,3,0.720905>,<3,3,1.44763>,r}
+	sphere{<3,3,1.44763>,r}
+	cylinder{<3,3,1.44763>,<3,2.59538,1.44768>,r}
+	sphere{<3,2.59538,1.44768>,r}
+	cylinder{<3,2.59538,1.44768>,<2.9997,2.59484,1.44747>,r}
+	sphere{<2.9997,2.59484,1.44747>,r}
+	cylinder{<2.9997,2.59484,1.44747>,<2.02764,2.08717,0.783716>,r}
+	sphere{<2.02764,2.08717,0.783716>,r}
+	cylinder{<2.02764,2.08717,0.783716>,<1.93586,2.16367,0.721027>,r}
+	sphere{<1.93586,2.16367,0.721027>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.08597,1.20835,0.933989>,<1.87561,0.946903,0.848142>,<1.68884,0.961273,0.873814>}
+	triangle{<2.08597,1.20835,0.933989>,<1.68884,0.961273,0.873814>,<1.41906,1.55179,1.14641>}
+	triangle{<2.08597,1.20835,0.933989>,<1.41906,1.55179,1.14641>,<1.73137,1.7874,1.21081>}
+	triangle{<2.08597,1.20835,0.933989>,<1.73137,1.7874,1.21081>,<1.76488,1.78374,1.20575>}
+	texture{t1}
+}
+union{
+	cylinder{<2.08597,1.20835,0.933989>,<1.87561,0.946903,0.848142>,r}
+	sphere{<1.87561,0.946903,0.848142>,r}
+	cylinder{<1.87561,0.946903,0.848142>,<1.68884,0.961273,0.873814>,r}
+	sphere{<1.68884,0.961273,0.873814>,r}
+	cylinder{<1.68884,0.961273,0.873814>,<1.41906,1.55179,1.14641>,r}
+	sphere{<1.41906,1.55179,1.14641>,r}
+	cylinder{<1.41906,1.55179,1.14641>,<1.73137,1.7874,1.21081>,r}
+	sphere{<1.73137,1.7874,1.21081>,r}
+	cylinder{<1.73137,1.7874,1.21081>,<1.76488,1.78374,1.20575>,r}
+	sphere{<1.76488,1.78374,1.20575>,r}
+	cylinder{<1.76488,1.78374,1.20575>,<2.08597,1.20835,0.933989>,r}
+	sphere{<2.08597,1.20835,0.933989>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.46236,1.99741,1.04346>,<1.27644,2.30175,1.17>,<1.23616,2.69518,1.69558>}
+	triangle{<1.46236,1.99741,1.04346>,<1.23616,2.69518,1.69558>,<1.8733,2.02158,1.82387>}
+	triangle{<1.46236,1.99741,1.04346>,<1.8733,2.02158,1.82387>,<1.92566,1.83679,1.63752>}
+	triangle{<1.46236,1.99741,1.04346>,<1.92566,1.83679,1.63752>,<1.73137,1.7874,1.21081>}
+	texture{t1}
+}
+union{
+	cylinder{<1.46236,1.99741,1.04346>,<1.27644,2.30175,1.17>,r}
+	sphere{<1.27644,2.30175,1.17>,r}
+	cylinder{<1.27644,2.30175,1.17>,<1.23616,2.69518,1.69558>,r}
+	sphere{<1.23616,2.69518,1.69558>,r}
+	cylinder{<1.23616,2.69518,1.69558>,<1.8733,2.02158,1.82387>,r}
+	sphere{<1.8733,2.02158,1.82387>,r}
+	cylinder{<1.8733,2.02158,1.82387>,<1.92566,1.83679,1.63752>,r}
+	sphere{<1.92566,1.83679,1.63752>,r}
+	cylinder{<1.92566,1.83679,1.63752>,<1.73137,1.7874,1.21081>,r}
+	sphere{<1.73137,1.7874,1.21081>,r}
+	cylinder{<1.73137,1.7874,1.21081>,<1.46236,1.99741,1.04346>,r}
+	sphere{<1.46236,1.99741,1.04346>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.01663,-1.05417,2.11302>,<-1.91743,-1.54566,2.64149>,<-2.05478,-1.59693,2.84346>}
+	triangle{<-2.01663,-1.05417,2.11302>,<-2.05478,-1.59693,2.84346>,<-2.13816,-1.55756,2.87613>}
+	triangle{<-2.01663,-1.05417,2.11302>,<-2.13816,-1.55756,2.87613>,<-2.93346,-0.837923,2.74867>}
+	triangle{<-2.01663,-1.05417,2.11302>,<-2.93346,-0.837923,2.74867>,<-2.39068,-0.776077,2.1301>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.01663,-1.05417,2.11302>,<-1.91743,-1.54566,2.64149>,r}
+	sphere{<-1.91743,-1.54566,2.64149>,r}
+	cylinder{<-1.91743,-1.54566,2.64149>,<-2.05478,-1.59693,2.84346>,r}
+	sphere{<-2.05478,-1.59693,2.84346>,r}
+	cylinder{<-2.05478,-1.59693,2.84346>,<-2.13816,-1.55756,2.87613>,r}
+	sphere{<-2.13816,-1.55756,2.87613>,r}
+	cylinder{<-2.13816,-1.55756,2.87613>,<-2.93346,-0.837923,2.74867>,r}
+	sphere{<-2.93346,-0.837923,2.74867>,r}
+	cylinder{<-2.93346,-0.837923,2.74867>,<-2.39068,-0.776077,2.1301>,r}
+	sphere{<-2.39068,-0.776077,2.1301>,r}
+	cylinder{<-2.39068,-0.776077,2.1301>,<-2.01663,-1.05417,2.11302>,r}
+	sphere{<-2.01663,-1.05417,2.11302>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.0361,-2.11438,2.79581>,<-0.581953,-1.74859,2.95253>,<-0.439112,-1.75697,2.92938>}
+	triangle{<-1.0361,-2.11438,2.79581>,<-0.439112,-1.75697,2.92938>,<-0.167035,-2.10622,2.68967>}
+	triangle{<-1.0361,-2.11438,2.79581>,<-0.167035,-2.10622,2.68967>,<-0.661023,-2.99011,2.23396>}
+	triangle{<-1.0361,-2.11438,2.79581>,<-0.661023,-2.99011,2.23396>,<-1.02302,-2.51259,2.56043>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.0361,-2.11438,2.79581>,<-0.581953,-1.74859,2.95253>,r}
+	sphere{<-0.581953,-1.74859,2.95253>,r}
+	cylinder{<-0.581953,-1.74859,2.95253>,<-0.439112,-1.75697,2.92938>,r}
+	sphere{<-0.439112,-1.75697,2.92938>,r}
+	cylinder{<-0.439112,-1.75697,2.92938>,<-0.167035,-2.10622,2.68967>,r}
+	sphere{<-0.167035,-2.10622,2.68967>,r}
+	cylinder{<-0.167035,-2.10622,2.68967>,<-0.661023,-2.99011,2.23396>,r}
+	sphere{<-0.661023,-2.99011,2.23396>,r}
+	cylinder{<-0.661023,-2.99011,2.23396>,<-1.02302,-2.51259,2.56043>,r}
+	sphere{<-1.02302,-2.51259,2.56043>,r}
+	cylinder{<-1.02302,-2.51259,2.56043>,<-1.0361,-2.11438,2.79581>,r}
+	sphere{<-1.0361,-2.11438,2.79581>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.0361,-2.11438,2.79581>,<-1.29487,-2.05312,2.54749>,<-1.3148,-2.00155,2.50074>}
+	triangle{<-1.0361,-2.11438,2.79581>,<-1.3148,-2.00155,2.50074>,<-0.944914,-1.38933,2.44305>}
+	triangle{<-1.0361,-2.11438,2.79581>,<-0.944914,-1.38933,2.44305>,<-0.754167,-1.41136,2.61246>}
+	triangle{<-1.0361,-2.11438,2.79581>,<-0.754167,-1.41136,2.61246>,<-0.581953,-1.74859,2.95253>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.0361,-2.11438,2.79581>,<-1.29487,-2.05312,2.54749>,r}
+	sphere{<-1.29487,-2.05312,2.54749>,r}
+	cylinder{<-1.29487,-2.05312,2.54749>,<-1.3148,-2.00155,2.50074>,r}
+	sphere{<-1.3148,-2.00155,2.50074>,r}
+	cylinder{<-1.3148,-2.00155,2.50074>,<-0.944914,-1.38933,2.44305>,r}
+	sphere{<-0.944914,-1.38933,2.44305>,r}
+	cylinder{<-0.944914,-1.38933,2.44305>,<-0.754167,-1.41136,2.61246>,r}
+	sphere{<-0.754167,-1.41136,2.61246>,r}
+	cylinder{<-0.754167,-1.41136,2.61246>,<-0.581953,-1.74859,2.95253>,r}
+	sphere{<-0.581953,-1.74859,2.95253>,r}
+	cylinder{<-0.581953,-1.74859,2.95253>,<-1.0361,-2.11438,2.79581>,r}
+	sphere{<-1.0361,-2.11438,2.79581>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.01711,-1.34961,2.53217>,<0.689471,-1.05816,2.32747>,<0.712651,-0.890841,1.84848>}
+	triangle{<1.01711,-1.34961,2.53217>,<0.712651,-0.890841,1.84848>,<1.12823,-1.05081,1.55748>}
+	triangle{<1.01711,-1.34961,2.53217>,<1.12823,-1.05081,1.55748>,<1.39005,-1.32631,1.83291>}
+	triangle{<1.01711,-1.34961,2.53217>,<1.39005,-1.32631,1.83291>,<1.24654,-1.41807,2.31938>}
+	texture{t1}
+}
+union{
+	cylinder{<1.01711,-1.34961,2.53217>,<0.689471,-1.05816,2.32747>,r}
+	sphere{<0.689471,-1.05816,2.32747>,r}
+	cylinder{<0.689471,-1.05816,2.32747>,<0.712651,-0.890841,1.84848>,r}
+	sphere{<0.712651,-0.890841,1.84848>,r}
+	cylinder{<0.712651,-0.890841,1.84848>,<1.12823,-1.05081,1.55748>,r}
+	sphere{<1.12823,-1.05081,1.55748>,r}
+	cylinder{<1.12823,-1.05081,1.55748>,<1.39005,-1.32631,1.83291>,r}
+	sphere{<1.39005,-1.32631,1.83291>,r}
+	cylinder{<1.39005,-1.32631,1.83291>,<1.24654,-1.41807,2.31938>,r}
+	sphere{<1.24654,-1.41807,2.31938>,r}
+	cylinder{<1.24654,-1.41807,2.31938>,<1.01711,-1.34961,2.53217>,r}
+	sphere{<1.01711,-1.34961,2.53217>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.0808264,-1.83151,1.91715>,<0.70993,-2.00245,2.31908>,<0.599552,-2.13566,2.6927>}
+	triangle{<0.0808264,-1.83151,1.91715>,<0.599552,-2.13566,2.6927>,<-0.00577534,-2.16686,2.83849>}
+	triangle{<0.0808264,-1.83151,1.91715>,<-0.00577534,-2.16686,2.83849>,<-0.167035,-2.10622,2.68967>}
+	triangle{<0.0808264,-1.83151,1.91715>,<-0.167035,-2.10622,2.68967>,<0.0276185,-1.83382,1.92878>}
+	texture{t1}
+}
+union{
+	cylinder{<0.0808264,-1.83151,1.91715>,<0.70993,-2.00245,2.31908>,r}
+	sphere{<0.70993,-2.00245,2.31908>,r}
+	cylinder{<0.70993,-2.00245,2.31908>,<0.599552,-2.13566,2.6927>,r}
+	sphere{<0.599552,-2.13566,2.6927>,r}
+	cylinder{<0.599552,-2.13566,2.6927>,<-0.00577534,-2.16686,2.83849>,r}
+	sphere{<-0.00577534,-2.16686,2.83849>,r}
+	cylinder{<-0.00577534,-2.16686,2.83849>,<-0.167035,-2.10622,2.68967>,r}
+	sphere{<-0.167035,-2.10622,2.68967>,r}
+	cylinder{<-0.167035,-2.10622,2.68967>,<0.0276185,-1.83382,1.92878>,r}
+	sphere{<0.0276185,-1.83382,1.92878>,r}
+	cylinder{<0.0276185,-1.83382,1.92878>,<0.0808264,-1.83151,1.91715>,r}
+	sphere{<0.0808264,-1.83151,1.91715>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.996365,-1.73276,2.51003>,<1.10256,-1.70346,2.49393>,<1.26969,-1.76543,2.58351>}
+	triangle{<0.996365,-1.73276,2.51003>,<1.26969,-1.76543,2.58351>,<1.58495,-1.97439,2.85037>}
+	triangle{<0.996365,-1.73276,2.51003>,<1.58495,-1.97439,2.85037>,<1.12675,-2.40884,3.24735>}
+	triangle{<0.996365,-1.73276,2.51003>,<1.12675,-2.40884,3.24735>,<0.700094,-2.04353,2.79846>}
+	texture{t1}
+}
+union{
+	cylinder{<0.996365,-1.73276,2.51003>,<1.10256,-1.70346,2.49393>,r}
+	sphere{<1.10256,-1.70346,2.49393>,r}
+	cylinder{<1.10256,-1.70346,2.49393>,<1.26969,-1.76543,2.58351>,r}
+	sphere{<1.26969,-1.76543,2.58351>,r}
+	cylinder{<1.26969,-1.76543,2.58351>,<1.58495,-1.97439,2.85037>,r}
+	sphere{<1.58495,-1.97439,2.85037>,r}
+	cylinder{<1.58495,-1.97439,2.85037>,<1.12675,-2.40884,3.24735>,r}
+	sphere{<1.12675,-2.40884,3.24735>,r}
+	cylinder{<1.12675,-2.40884,3.24735>,<0.700094,-2.04353,2.79846>,r}
+	sphere{<0.700094,-2.04353,2.79846>,r}
+	cylinder{<0.700094,-2.04353,2.79846>,<0.996365,-1.73276,2.51003>,r}
+	sphere{<0.996365,-1.73276,2.51003>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.0787716,-0.858101,2.65521>,<0.181806,-1.17484,3.15675>,<-0.357396,-1.76359,3.0527>}
+	triangle{<0.0787716,-0.858101,2.65521>,<-0.357396,-1.76359,3.0527>,<-0.439112,-1.75697,2.92938>}
+	triangle{<0.0787716,-0.858101,2.65521>,<-0.439112,-1.75697,2.92938>,<-0.439585,-1.48203,2.6202>}
+	triangle{<0.0787716,-0.858101,2.65521>,<-0.439585,-1.48203,2.6202>,<0.043504,-0.869656,2.61816>}
+	texture{t1}
+}
+union{
+	cylinder{<0.0787716,-0.858101,2.65521>,<0.181806,-1.17484,3.15675>,r}
+	sphere{<0.181806,-1.17484,3.15675>,r}
+	cylinder{<0.181806,-1.17484,3.15675>,<-0.357396,-1.76359,3.0527>,r}
+	sphere{<-0.357396,-1.76359,3.0527>,r}
+	cylinder{<-0.357396,-1.76359,3.0527>,<-0.439112,-1.75697,2.92938>,r}
+	sphere{<-0.439112,-1.75697,2.92938>,r}
+	cylinder{<-0.439112,-1.75697,2.92938>,<-0.439585,-1.48203,2.6202>,r}
+	sphere{<-0.439585,-1.48203,2.6202>,r}
+	cylinder{<-0.439585,-1.48203,2.6202>,<0.043504,-0.869656,2.61816>,r}
+	sphere{<0.043504,-0.869656,2.61816>,r}
+	cylinder{<0.043504,-0.869656,2.61816>,<0.0787716,-0.858101,2.65521>,r}
+	sphere{<0.0787716,-0.858101,2.65521>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.0787716,-0.858101,2.65521>,<0.692489,-1.05202,2.34312>,<1.01421,-1.33961,2.54194>}
+	triangle{<0.0787716,-0.858101,2.65521>,<1.01421,-1.33961,2.54194>,<1.01395,-1.35649,2.57513>}
+	triangle{<0.0787716,-0.858101,2.65521>,<1.01395,-1.35649,2.57513>,<0.511678,-1.37727,3.18042>}
+	triangle{<0.0787716,-0.858101,2.65521>,<0.511678,-1.37727,3.18042>,<0.181806,-1.17484,3.15675>}
+	texture{t1}
+}
+union{
+	cylinder{<0.0787716,-0.858101,2.65521>,<0.692489,-1.05202,2.34312>,r}
+	sphere{<0.692489,-1.05202,2.34312>,r}
+	cylinder{<0.692489,-1.05202,2.34312>,<1.01421,-1.33961,2.54194>,r}
+	sphere{<1.01421,-1.33961,2.54194>,r}
+	cylinder{<1.01421,-1.33961,2.54194>,<1.01395,-1.35649,2.57513>,r}
+	sphere{<1.01395,-1.35649,2.57513>,r}
+	cylinder{<1.01395,-1.35649,2.57513>,<0.511678,-1.37727,3.18042>,r}
+	sphere{<0.511678,-1.37727,3.18042>,r}
+	cylinder{<0.511678,-1.37727,3.18042>,<0.181806,-1.17484,3.15675>,r}
+	sphere{<0.181806,-1.17484,3.15675>,r}
+	cylinder{<0.181806,-1.17484,3.15675>,<0.0787716,-0.858101,2.65521>,r}
+	sphere{<0.0787716,-0.858101,2.65521>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.01395,-1.35649,2.57513>,<1.0306,-1.42514,2.53914>,<0.996365,-1.73276,2.51003>}
+	triangle{<1.01395,-1.35649,2.57513>,<0.996365,-1.73276,2.51003>,<0.700094,-2.04353,2.79846>}
+	triangle{<1.01395,-1.35649,2.57513>,<0.700094,-2.04353,2.79846>,<0.453054,-1.86842,3.13876>}
+	triangle{<1.01395,-1.35649,2.57513>,<0.453054,-1.86842,3.13876>,<0.511678,-1.37727,3.18042>}
+	texture{t1}
+}
+union{
+	cylinder{<1.01395,-1.35649,2.57513>,<1.0306,-1.42514,2.53914>,r}
+	sphere{<1.0306,-1.42514,2.53914>,r}
+	cylinder{<1.0306,-1.42514,2.53914>,<0.996365,-1.73276,2.51003>,r}
+	sphere{<0.996365,-1.73276,2.51003>,r}
+	cylinder{<0.996365,-1.73276,2.51003>,<0.700094,-2.04353,2.79846>,r}
+	sphere{<0.700094,-2.04353,2.79846>,r}
+	cylinder{<0.700094,-2.04353,2.79846>,<0.453054,-1.86842,3.13876>,r}
+	sphere{<0.453054,-1.86842,3.13876>,r}
+	cylinder{<0.453054,-1.86842,3.13876>,<0.511678,-1.37727,3.18042>,r}
+	sphere{<0.511678,-1.37727,3.18042>,r}
+	cylinder{<0.511678,-1.37727,3.18042>,<1.01395,-1.35649,2.57513>,r}
+	sphere{<1.01395,-1.35649,2.57513>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.11455,-1.66578,2.41007>,<1.8132,-1.20479,2.09058>,<1.81819,-1.19201,1.96471>}
+	triangle{<2.11455,-1.66578,2.41007>,<1.81819,-1.19201,1.96471>,<2.09956,-1.52432,1.63253>}
+	triangle{<2.11455,-1.66578,2.41007>,<2.09956,-1.52432,1.63253>,<2.3325,-1.8737,1.83471>}
+	triangle{<2.11455,-1.66578,2.41007>,<2.3325,-1.8737,1.83471>,<2.3273,-1.91678,2.15724>}
+	texture{t1}
+}
+union{
+	cylinder{<2.11455,-1.66578,2.41007>,<1.8132,-1.20479,2.09058>,r}
+	sphere{<1.8132,-1.20479,2.09058>,r}
+	cylinder{<1.8132,-1.20479,2.09058>,<1.81819,-1.19201,1.96471>,r}
+	sphere{<1.81819,-1.19201,1.96471>,r}
+	cylinder{<1.81819,-1.19201,1.96471>,<2.09956,-1.52432,1.63253>,r}
+	sphere{<2.09956,-1.52432,1.63253>,r}
+	cylinder{<2.09956,-1.52432,1.63253>,<2.3325,-1.8737,1.83471>,r}
+	sphere{<2.3325,-1.8737,1.83471>,r}
+	cylinder{<2.3325,-1.8737,1.83471>,<2.3273,-1.91678,2.15724>,r}
+	sphere{<2.3273,-1.91678,2.15724>,r}
+	cylinder{<2.3273,-1.91678,2.15724>,<2.11455,-1.66578,2.41007>,r}
+	sphere{<2.11455,-1.66578,2.41007>,r}
+	texture{t2}
+}
+union{
+	triangle{<3,-3,2.78041>,<2.49475,-3,2.78137>,<1.96634,-2.54871,2.52222>}
+	triangle{<3,-3,2.78041>,<1.96634,-2.54871,2.52222>,<1.93964,-2.45198,2.46651>}
+	triangle{<3,-3,2.78041>,<1.93964,-2.45198,2.46651>,<2.3273,-1.91678,2.15724>}
+	triangle{<3,-3,2.78041>,<2.3273,-1.91678,2.15724>,<3,-1.91769,2.15649>}
+	texture{t1}
+}
+union{
+	cylinder{<3,-3,2.78041>,<2.49475,-3,2.78137>,r}
+	sphere{<2.49475,-3,2.78137>,r}
+	cylinder{<2.49475,-3,2.78137>,<1.96634,-2.54871,2.52222>,r}
+	sphere{<1.96634,-2.54871,2.52222>,r}
+	cylinder{<1.96634,-2.54871,2.52222>,<1.93964,-2.45198,2.46651>,r}
+	sphere{<1.93964,-2.45198,2.46651>,r}
+	cylinder{<1.93964,-2.45198,2.46651>,<2.3273,-1.91678,2.15724>,r}
+	sphere{<2.3273,-1.91678,2.15724>,r}
+	cylinder{<2.3273,-1.91678,2.15724>,<3,-1.91769,2.15649>,r}
+	sphere{<3,-1.91769,2.15649>,r}
+	cylinder{<3,-1.91769,2.15649>,<3,-3,2.78041>,r}
+	sphere{<3,-3,2.78041>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.033,-0.477612,1.84844>,<-1.15288,-0.851522,2.03995>,<-1.15445,-0.85433,2.04207>}
+	triangle{<-1.033,-0.477612,1.84844>,<-1.15445,-0.85433,2.04207>,<-1.42863,-0.863014,2.32028>}
+	triangle{<-1.033,-0.477612,1.84844>,<-1.42863,-0.863014,2.32028>,<-1.69854,-0.26674,2.48>}
+	triangle{<-1.033,-0.477612,1.84844>,<-1.69854,-0.26674,2.48>,<-1.23844,-0.0939489,1.98326>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.033,-0.477612,1.84844>,<-1.15288,-0.851522,2.03995>,r}
+	sphere{<-1.15288,-0.851522,2.03995>,r}
+	cylinder{<-1.15288,-0.851522,2.03995>,<-1.15445,-0.85433,2.04207>,r}
+	sphere{<-1.15445,-0.85433,2.04207>,r}
+	cylinder{<-1.15445,-0.85433,2.04207>,<-1.42863,-0.863014,2.32028>,r}
+	sphere{<-1.42863,-0.863014,2.32028>,r}
+	cylinder{<-1.42863,-0.863014,2.32028>,<-1.69854,-0.26674,2.48>,r}
+	sphere{<-1.69854,-0.26674,2.48>,r}
+	cylinder{<-1.69854,-0.26674,2.48>,<-1.23844,-0.0939489,1.98326>,r}
+	sphere{<-1.23844,-0.0939489,1.98326>,r}
+	cylinder{<-1.23844,-0.0939489,1.98326>,<-1.033,-0.477612,1.84844>,r}
+	sphere{<-1.033,-0.477612,1.84844>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.7757,-1.13578,1.45274>,<-2.05797,-1.1152,1.87674>,<-2.01663,-1.05417,2.11302>}
+	triangle{<-1.7757,-1.13578,1.45274>,<-2.01663,-1.05417,2.11302>,<-1.42863,-0.863014,2.32028>}
+	triangle{<-1.7757,-1.13578,1.45274>,<-1.42863,-0.863014,2.32028>,<-1.15445,-0.85433,2.04207>}
+	triangle{<-1.7757,-1.13578,1.45274>,<-1.15445,-0.85433,2.04207>,<-1.15429,-0.854543,2.04089>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.7757,-1.13578,1.45274>,<-2.05797,-1.1152,1.87674>,r}
+	sphere{<-2.05797,-1.1152,1.87674>,r}
+	cylinder{<-2.05797,-1.1152,1.87674>,<-2.01663,-1.05417,2.11302>,r}
+	sphere{<-2.01663,-1.05417,2.11302>,r}
+	cylinder{<-2.01663,-1.05417,2.11302>,<-1.42863,-0.863014,2.32028>,r}
+	sphere{<-1.42863,-0.863014,2.32028>,r}
+	cylinder{<-1.42863,-0.863014,2.32028>,<-1.15445,-0.85433,2.04207>,r}
+	sphere{<-1.15445,-0.85433,2.04207>,r}
+	cylinder{<-1.15445,-0.85433,2.04207>,<-1.15429,-0.854543,2.04089>,r}
+	sphere{<-1.15429,-0.854543,2.04089>,r}
+	cylinder{<-1.15429,-0.854543,2.04089>,<-1.7757,-1.13578,1.45274>,r}
+	sphere{<-1.7757,-1.13578,1.45274>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.84086,-0.232971,2.45966>,<-1.87433,-0.115095,2.73998>,<-2.13337,0.387226,2.79293>}
+	triangle{<-1.84086,-0.232971,2.45966>,<-2.13337,0.387226,2.79293>,<-2.15914,0.42953,2.75867>}
+	triangle{<-1.84086,-0.232971,2.45966>,<-2.15914,0.42953,2.75867>,<-2.24332,0.424641,1.90773>}
+	triangle{<-1.84086,-0.232971,2.45966>,<-2.24332,0.424641,1.90773>,<-2.07273,0.0954326,1.88112>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.84086,-0.232971,2.45966>,<-1.87433,-0.115095,2.73998>,r}
+	sphere{<-1.87433,-0.115095,2.73998>,r}
+	cylinder{<-1.87433,-0.115095,2.73998>,<-2.13337,0.387226,2.79293>,r}
+	sphere{<-2.13337,0.387226,2.79293>,r}
+	cylinder{<-2.13337,0.387226,2.79293>,<-2.15914,0.42953,2.75867>,r}
+	sphere{<-2.15914,0.42953,2.75867>,r}
+	cylinder{<-2.15914,0.42953,2.75867>,<-2.24332,0.424641,1.90773>,r}
+	sphere{<-2.24332,0.424641,1.90773>,r}
+	cylinder{<-2.24332,0.424641,1.90773>,<-2.07273,0.0954326,1.88112>,r}
+	sphere{<-2.07273,0.0954326,1.88112>,r}
+	cylinder{<-2.07273,0.0954326,1.88112>,<-1.84086,-0.232971,2.45966>,r}
+	sphere{<-1.84086,-0.232971,2.45966>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.84086,-0.232971,2.45966>,<-2.39068,-0.776077,2.1301>,<-2.93346,-0.837923,2.74867>}
+	triangle{<-1.84086,-0.232971,2.45966>,<-2.93346,-0.837923,2.74867>,<-2.93336,-0.837776,2.74883>}
+	triangle{<-1.84086,-0.232971,2.45966>,<-2.93336,-0.837776,2.74883>,<-2.01779,-0.136726,2.89295>}
+	triangle{<-1.84086,-0.232971,2.45966>,<-2.01779,-0.136726,2.89295>,<-1.87433,-0.115095,2.73998>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.84086,-0.232971,2.45966>,<-2.39068,-0.776077,2.1301>,r}
+	sphere{<-2.39068,-0.776077,2.1301>,r}
+	cylinder{<-2.39068,-0.776077,2.1301>,<-2.93346,-0.837923,2.74867>,r}
+	sphere{<-2.93346,-0.837923,2.74867>,r}
+	cylinder{<-2.93346,-0.837923,2.74867>,<-2.93336,-0.837776,2.74883>,r}
+	sphere{<-2.93336,-0.837776,2.74883>,r}
+	cylinder{<-2.93336,-0.837776,2.74883>,<-2.01779,-0.136726,2.89295>,r}
+	sphere{<-2.01779,-0.136726,2.89295>,r}
+	cylinder{<-2.01779,-0.136726,2.89295>,<-1.87433,-0.115095,2.73998>,r}
+	sphere{<-1.87433,-0.115095,2.73998>,r}
+	cylinder{<-1.87433,-0.115095,2.73998>,<-1.84086,-0.232971,2.45966>,r}
+	sphere{<-1.84086,-0.232971,2.45966>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.80675,-1.14664,3.3704>,<-2.06475,-1.57701,2.91705>,<-2.13816,-1.55756,2.87613>}
+	triangle{<-1.80675,-1.14664,3.3704>,<-2.13816,-1.55756,2.87613>,<-2.93346,-0.837923,2.74867>}
+	triangle{<-1.80675,-1.14664,3.3704>,<-2.93346,-0.837923,2.74867>,<-2.93336,-0.837776,2.74883>}
+	triangle{<-1.80675,-1.14664,3.3704>,<-2.93336,-0.837776,2.74883>,<-2.00374,-0.78727,3.45125>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.80675,-1.14664,3.3704>,<-2.06475,-1.57701,2.91705>,r}
+	sphere{<-2.06475,-1.57701,2.91705>,r}
+	cylinder{<-2.06475,-1.57701,2.91705>,<-2.13816,-1.55756,2.87613>,r}
+	sphere{<-2.13816,-1.55756,2.87613>,r}
+	cylinder{<-2.13816,-1.55756,2.87613>,<-2.93346,-0.837923,2.74867>,r}
+	sphere{<-2.93346,-0.837923,2.74867>,r}
+	cylinder{<-2.93346,-0.837923,2.74867>,<-2.93336,-0.837776,2.74883>,r}
+	sphere{<-2.93336,-0.837776,2.74883>,r}
+	cylinder{<-2.93336,-0.837776,2.74883>,<-2.00374,-0.78727,3.45125>,r}
+	sphere{<-2.00374,-0.78727,3.45125>,r}
+	cylinder{<-2.00374,-0.78727,3.45125>,<-1.80675,-1.14664,3.3704>,r}
+	sphere{<-1.80675,-1.14664,3.3704>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.754167,-1.41136,2.61246>,<-0.439585,-1.48203,2.6202>,<-0.0766957,-1.64786,1.96193>}
+	triangle{<-0.754167,-1.41136,2.61246>,<-0.0766957,-1.64786,1.96193>,<-0.619836,-1.55977,1.68014>}
+	triangle{<-0.754167,-1.41136,2.61246>,<-0.619836,-1.55977,1.68014>,<-0.861112,-1.49196,1.78185>}
+	triangle{<-0.754167,-1.41136,2.61246>,<-0.861112,-1.49196,1.78185>,<-0.944914,-1.38933,2.44305>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.754167,-1.41136,2.61246>,<-0.439585,-1.48203,2.6202>,r}
+	sphere{<-0.439585,-1.48203,2.6202>,r}
+	cylinder{<-0.439585,-1.48203,2.6202>,<-0.0766957,-1.64786,1.96193>,r}
+	sphere{<-0.0766957,-1.64786,1.96193>,r}
+	cylinder{<-0.0766957,-1.64786,1.96193>,<-0.619836,-1.55977,1.68014>,r}
+	sphere{<-0.619836,-1.55977,1.68014>,r}
+	cylinder{<-0.619836,-1.55977,1.68014>,<-0.861112,-1.49196,1.78185>,r}
+	sphere{<-0.861112,-1.49196,1.78185>,r}
+	cylinder{<-0.861112,-1.49196,1.78185>,<-0.944914,-1.38933,2.44305>,r}
+	sphere{<-0.944914,-1.38933,2.44305>,r}
+	cylinder{<-0.944914,-1.38933,2.44305>,<-0.754167,-1.41136,2.61246>,r}
+	sphere{<-0.754167,-1.41136,2.61246>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.754167,-1.41136,2.61246>,<-0.961343,-1.07053,2.60169>,<-0.394065,-0.582538,2.60377>}
+	triangle{<-0.754167,-1.41136,2.61246>,<-0.394065,-0.582538,2.60377>,<-0.0938173,-0.688252,2.61188>}
+	triangle{<-0.754167,-1.41136,2.61246>,<-0.0938173,-0.688252,2.61188>,<0.043504,-0.869656,2.61816>}
+	triangle{<-0.754167,-1.41136,2.61246>,<0.043504,-0.869656,2.61816>,<-0.439585,-1.48203,2.6202>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.754167,-1.41136,2.61246>,<-0.961343,-1.07053,2.60169>,r}
+	sphere{<-0.961343,-1.07053,2.60169>,r}
+	cylinder{<-0.961343,-1.07053,2.60169>,<-0.394065,-0.582538,2.60377>,r}
+	sphere{<-0.394065,-0.582538,2.60377>,r}
+	cylinder{<-0.394065,-0.582538,2.60377>,<-0.0938173,-0.688252,2.61188>,r}
+	sphere{<-0.0938173,-0.688252,2.61188>,r}
+	cylinder{<-0.0938173,-0.688252,2.61188>,<0.043504,-0.869656,2.61816>,r}
+	sphere{<0.043504,-0.869656,2.61816>,r}
+	cylinder{<0.043504,-0.869656,2.61816>,<-0.439585,-1.48203,2.6202>,r}
+	sphere{<-0.439585,-1.48203,2.6202>,r}
+	cylinder{<-0.439585,-1.48203,2.6202>,<-0.754167,-1.41136,2.61246>,r}
+	sphere{<-0.754167,-1.41136,2.61246>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.07825,-1.08857,2.48062>,<-0.944914,-1.38933,2.44305>,<-0.861112,-1.49196,1.78185>}
+	triangle{<-1.07825,-1.08857,2.48062>,<-0.861112,-1.49196,1.78185>,<-0.862929,-1.48721,1.77755>}
+	triangle{<-1.07825,-1.08857,2.48062>,<-0.862929,-1.48721,1.77755>,<-1.15429,-0.854543,2.04089>}
+	triangle{<-1.07825,-1.08857,2.48062>,<-1.15429,-0.854543,2.04089>,<-1.15445,-0.85433,2.04207>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.07825,-1.08857,2.48062>,<-0.944914,-1.38933,2.44305>,r}
+	sphere{<-0.944914,-1.38933,2.44305>,r}
+	cylinder{<-0.944914,-1.38933,2.44305>,<-0.861112,-1.49196,1.78185>,r}
+	sphere{<-0.861112,-1.49196,1.78185>,r}
+	cylinder{<-0.861112,-1.49196,1.78185>,<-0.862929,-1.48721,1.77755>,r}
+	sphere{<-0.862929,-1.48721,1.77755>,r}
+	cylinder{<-0.862929,-1.48721,1.77755>,<-1.15429,-0.854543,2.04089>,r}
+	sphere{<-1.15429,-0.854543,2.04089>,r}
+	cylinder{<-1.15429,-0.854543,2.04089>,<-1.15445,-0.85433,2.04207>,r}
+	sphere{<-1.15445,-0.85433,2.04207>,r}
+	cylinder{<-1.15445,-0.85433,2.04207>,<-1.07825,-1.08857,2.48062>,r}
+	sphere{<-1.07825,-1.08857,2.48062>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.07132,0.0559691,2.02283>,<-0.977897,0.265917,2.36338>,<-1.21846,0.226815,2.75246>}
+	triangle{<-1.07132,0.0559691,2.02283>,<-1.21846,0.226815,2.75246>,<-1.70095,-0.169591,2.73013>}
+	triangle{<-1.07132,0.0559691,2.02283>,<-1.70095,-0.169591,2.73013>,<-1.69854,-0.26674,2.48>}
+	triangle{<-1.07132,0.0559691,2.02283>,<-1.69854,-0.26674,2.48>,<-1.23844,-0.0939489,1.98326>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.07132,0.0559691,2.02283>,<-0.977897,0.265917,2.36338>,r}
+	sphere{<-0.977897,0.265917,2.36338>,r}
+	cylinder{<-0.977897,0.265917,2.36338>,<-1.21846,0.226815,2.75246>,r}
+	sphere{<-1.21846,0.226815,2.75246>,r}
+	cylinder{<-1.21846,0.226815,2.75246>,<-1.70095,-0.169591,2.73013>,r}
+	sphere{<-1.70095,-0.169591,2.73013>,r}
+	cylinder{<-1.70095,-0.169591,2.73013>,<-1.69854,-0.26674,2.48>,r}
+	sphere{<-1.69854,-0.26674,2.48>,r}
+	cylinder{<-1.69854,-0.26674,2.48>,<-1.23844,-0.0939489,1.98326>,r}
+	sphere{<-1.23844,-0.0939489,1.98326>,r}
+	cylinder{<-1.23844,-0.0939489,1.98326>,<-1.07132,0.0559691,2.02283>,r}
+	sphere{<-1.07132,0.0559691,2.02283>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.630159,0.140795,2.63048>,<-0.35405,-0.387528,2.36914>,<-0.394065,-0.582538,2.60377>}
+	triangle{<-0.630159,0.140795,2.63048>,<-0.394065,-0.582538,2.60377>,<-0.723943,-0.361722,3.21332>}
+	triangle{<-0.630159,0.140795,2.63048>,<-0.723943,-0.361722,3.21332>,<-0.730576,-0.344699,3.21645>}
+	triangle{<-0.630159,0.140795,2.63048>,<-0.730576,-0.344699,3.21645>,<-0.791213,0.079693,3.05045>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.630159,0.140795,2.63048>,<-0.35405,-0.387528,2.36914>,r}
+	sphere{<-0.35405,-0.387528,2.36914>,r}
+	cylinder{<-0.35405,-0.387528,2.36914>,<-0.394065,-0.582538,2.60377>,r}
+	sphere{<-0.394065,-0.582538,2.60377>,r}
+	cylinder{<-0.394065,-0.582538,2.60377>,<-0.723943,-0.361722,3.21332>,r}
+	sphere{<-0.723943,-0.361722,3.21332>,r}
+	cylinder{<-0.723943,-0.361722,3.21332>,<-0.730576,-0.344699,3.21645>,r}
+	sphere{<-0.730576,-0.344699,3.21645>,r}
+	cylinder{<-0.730576,-0.344699,3.21645>,<-0.791213,0.079693,3.05045>,r}
+	sphere{<-0.791213,0.079693,3.05045>,r}
+	cylinder{<-0.791213,0.079693,3.05045>,<-0.630159,0.140795,2.63048>,r}
+	sphere{<-0.630159,0.140795,2.63048>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.04712,-0.0942936,3.19199>,<-0.730576,-0.344699,3.21645>,<-0.723943,-0.361722,3.21332>}
+	triangle{<-1.04712,-0.0942936,3.19199>,<-0.723943,-0.361722,3.21332>,<-1.08928,-0.913651,2.92432>}
+	triangle{<-1.04712,-0.0942936,3.19199>,<-1.08928,-0.913651,2.92432>,<-1.31914,-0.881668,2.86009>}
+	triangle{<-1.04712,-0.0942936,3.19199>,<-1.31914,-0.881668,2.86009>,<-1.59021,-0.308745,2.9503>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.04712,-0.0942936,3.19199>,<-0.730576,-0.344699,3.21645>,r}
+	sphere{<-0.730576,-0.344699,3.21645>,r}
+	cylinder{<-0.730576,-0.344699,3.21645>,<-0.723943,-0.361722,3.21332>,r}
+	sphere{<-0.723943,-0.361722,3.21332>,r}
+	cylinder{<-0.723943,-0.361722,3.21332>,<-1.08928,-0.913651,2.92432>,r}
+	sphere{<-1.08928,-0.913651,2.92432>,r}
+	cylinder{<-1.08928,-0.913651,2.92432>,<-1.31914,-0.881668,2.86009>,r}
+	sphere{<-1.31914,-0.881668,2.86009>,r}
+	cylinder{<-1.31914,-0.881668,2.86009>,<-1.59021,-0.308745,2.9503>,r}
+	sphere{<-1.59021,-0.308745,2.9503>,r}
+	cylinder{<-1.59021,-0.308745,2.9503>,<-1.04712,-0.0942936,3.19199>,r}
+	sphere{<-1.04712,-0.0942936,3.19199>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.42863,-0.863014,2.32028>,<-1.69854,-0.26674,2.48>,<-1.70095,-0.169591,2.73013>}
+	triangle{<-1.42863,-0.863014,2.32028>,<-1.70095,-0.169591,2.73013>,<-1.59021,-0.308745,2.9503>}
+	triangle{<-1.42863,-0.863014,2.32028>,<-1.59021,-0.308745,2.9503>,<-1.31914,-0.881668,2.86009>}
+	triangle{<-1.42863,-0.863014,2.32028>,<-1.31914,-0.881668,2.86009>,<-1.3156,-1.00955,2.53282>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.42863,-0.863014,2.32028>,<-1.69854,-0.26674,2.48>,r}
+	sphere{<-1.69854,-0.26674,2.48>,r}
+	cylinder{<-1.69854,-0.26674,2.48>,<-1.70095,-0.169591,2.73013>,r}
+	sphere{<-1.70095,-0.169591,2.73013>,r}
+	cylinder{<-1.70095,-0.169591,2.73013>,<-1.59021,-0.308745,2.9503>,r}
+	sphere{<-1.59021,-0.308745,2.9503>,r}
+	cylinder{<-1.59021,-0.308745,2.9503>,<-1.31914,-0.881668,2.86009>,r}
+	sphere{<-1.31914,-0.881668,2.86009>,r}
+	cylinder{<-1.31914,-0.881668,2.86009>,<-1.3156,-1.00955,2.53282>,r}
+	sphere{<-1.3156,-1.00955,2.53282>,r}
+	cylinder{<-1.3156,-1.00955,2.53282>,<-1.42863,-0.863014,2.32028>,r}
+	sphere{<-1.42863,-0.863014,2.32028>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.383541,0.243885,3.27456>,<0.235412,0.176286,3.50502>,<-0.0655666,0.206774,3.56236>}
+	triangle{<0.383541,0.243885,3.27456>,<-0.0655666,0.206774,3.56236>,<-0.437823,0.412014,3.22314>}
+	triangle{<0.383541,0.243885,3.27456>,<-0.437823,0.412014,3.22314>,<-0.120234,0.581941,2.66785>}
+	triangle{<0.383541,0.243885,3.27456>,<-0.120234,0.581941,2.66785>,<0.0671471,0.5594,2.64086>}
+	texture{t1}
+}
+union{
+	cylinder{<0.383541,0.243885,3.27456>,<0.235412,0.176286,3.50502>,r}
+	sphere{<0.235412,0.176286,3.50502>,r}
+	cylinder{<0.235412,0.176286,3.50502>,<-0.0655666,0.206774,3.56236>,r}
+	sphere{<-0.0655666,0.206774,3.56236>,r}
+	cylinder{<-0.0655666,0.206774,3.56236>,<-0.437823,0.412014,3.22314>,r}
+	sphere{<-0.437823,0.412014,3.22314>,r}
+	cylinder{<-0.437823,0.412014,3.22314>,<-0.120234,0.581941,2.66785>,r}
+	sphere{<-0.120234,0.581941,2.66785>,r}
+	cylinder{<-0.120234,0.581941,2.66785>,<0.0671471,0.5594,2.64086>,r}
+	sphere{<0.0671471,0.5594,2.64086>,r}
+	cylinder{<0.0671471,0.5594,2.64086>,<0.383541,0.243885,3.27456>,r}
+	sphere{<0.383541,0.243885,3.27456>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.06876,0.144048,1.7969>,<2.21577,0.398661,1.94659>,<2.21232,0.400268,2.52346>}
+	triangle{<2.06876,0.144048,1.7969>,<2.21232,0.400268,2.52346>,<2.04408,0.113312,2.69076>}
+	triangle{<2.06876,0.144048,1.7969>,<2.04408,0.113312,2.69076>,<1.81662,-0.282953,2.28367>}
+	triangle{<2.06876,0.144048,1.7969>,<1.81662,-0.282953,2.28367>,<1.83399,-0.256319,2.03732>}
+	texture{t1}
+}
+union{
+	cylinder{<2.06876,0.144048,1.7969>,<2.21577,0.398661,1.94659>,r}
+	sphere{<2.21577,0.398661,1.94659>,r}
+	cylinder{<2.21577,0.398661,1.94659>,<2.21232,0.400268,2.52346>,r}
+	sphere{<2.21232,0.400268,2.52346>,r}
+	cylinder{<2.21232,0.400268,2.52346>,<2.04408,0.113312,2.69076>,r}
+	sphere{<2.04408,0.113312,2.69076>,r}
+	cylinder{<2.04408,0.113312,2.69076>,<1.81662,-0.282953,2.28367>,r}
+	sphere{<1.81662,-0.282953,2.28367>,r}
+	cylinder{<1.81662,-0.282953,2.28367>,<1.83399,-0.256319,2.03732>,r}
+	sphere{<1.83399,-0.256319,2.03732>,r}
+	cylinder{<1.83399,-0.256319,2.03732>,<2.06876,0.144048,1.7969>,r}
+	sphere{<2.06876,0.144048,1.7969>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.04271,-0.717536,2.30902>,<2.06079,-0.673376,1.98459>,<1.98235,-0.501619,1.88902>}
+	triangle{<2.04271,-0.717536,2.30902>,<1.98235,-0.501619,1.88902>,<1.83399,-0.256319,2.03732>}
+	triangle{<2.04271,-0.717536,2.30902>,<1.83399,-0.256319,2.03732>,<1.81662,-0.282953,2.28367>}
+	triangle{<2.04271,-0.717536,2.30902>,<1.81662,-0.282953,2.28367>,<1.98693,-0.636425,2.41078>}
+	texture{t1}
+}
+union{
+	cylinder{<2.04271,-0.717536,2.30902>,<2.06079,-0.673376,1.98459>,r}
+	sphere{<2.06079,-0.673376,1.98459>,r}
+	cylinder{<2.06079,-0.673376,1.98459>,<1.98235,-0.501619,1.88902>,r}
+	sphere{<1.98235,-0.501619,1.88902>,r}
+	cylinder{<1.98235,-0.501619,1.88902>,<1.83399,-0.256319,2.03732>,r}
+	sphere{<1.83399,-0.256319,2.03732>,r}
+	cylinder{<1.83399,-0.256319,2.03732>,<1.81662,-0.282953,2.28367>,r}
+	sphere{<1.81662,-0.282953,2.28367>,r}
+	cylinder{<1.81662,-0.282953,2.28367>,<1.98693,-0.636425,2.41078>,r}
+	sphere{<1.98693,-0.636425,2.41078>,r}
+	cylinder{<1.98693,-0.636425,2.41078>,<2.04271,-0.717536,2.30902>,r}
+	sphere{<2.04271,-0.717536,2.30902>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.24332,0.424641,1.90773>,<-2.15914,0.42953,2.75867>,<-2.00312,0.6739,2.81441>}
+	triangle{<-2.24332,0.424641,1.90773>,<-2.00312,0.6739,2.81441>,<-1.8544,1.0253,2.10179>}
+	triangle{<-2.24332,0.424641,1.90773>,<-1.8544,1.0253,2.10179>,<-2.06228,0.728427,1.84175>}
+	triangle{<-2.24332,0.424641,1.90773>,<-2.06228,0.728427,1.84175>,<-2.19537,0.515335,1.82418>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.24332,0.424641,1.90773>,<-2.15914,0.42953,2.75867>,r}
+	sphere{<-2.15914,0.42953,2.75867>,r}
+	cylinder{<-2.15914,0.42953,2.75867>,<-2.00312,0.6739,2.81441>,r}
+	sphere{<-2.00312,0.6739,2.81441>,r}
+	cylinder{<-2.00312,0.6739,2.81441>,<-1.8544,1.0253,2.10179>,r}
+	sphere{<-1.8544,1.0253,2.10179>,r}
+	cylinder{<-1.8544,1.0253,2.10179>,<-2.06228,0.728427,1.84175>,r}
+	sphere{<-2.06228,0.728427,1.84175>,r}
+	cylinder{<-2.06228,0.728427,1.84175>,<-2.19537,0.515335,1.82418>,r}
+	sphere{<-2.19537,0.515335,1.82418>,r}
+	cylinder{<-2.19537,0.515335,1.82418>,<-2.24332,0.424641,1.90773>,r}
+	sphere{<-2.24332,0.424641,1.90773>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.8544,1.0253,2.10179>,<-1.29902,1.00489,2.164>,<-1.19465,0.964102,2.25122>}
+	triangle{<-1.8544,1.0253,2.10179>,<-1.19465,0.964102,2.25122>,<-1.44364,0.690603,2.80094>}
+	triangle{<-1.8544,1.0253,2.10179>,<-1.44364,0.690603,2.80094>,<-2.0023,0.673521,2.81521>}
+	triangle{<-1.8544,1.0253,2.10179>,<-2.0023,0.673521,2.81521>,<-2.00312,0.6739,2.81441>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.8544,1.0253,2.10179>,<-1.29902,1.00489,2.164>,r}
+	sphere{<-1.29902,1.00489,2.164>,r}
+	cylinder{<-1.29902,1.00489,2.164>,<-1.19465,0.964102,2.25122>,r}
+	sphere{<-1.19465,0.964102,2.25122>,r}
+	cylinder{<-1.19465,0.964102,2.25122>,<-1.44364,0.690603,2.80094>,r}
+	sphere{<-1.44364,0.690603,2.80094>,r}
+	cylinder{<-1.44364,0.690603,2.80094>,<-2.0023,0.673521,2.81521>,r}
+	sphere{<-2.0023,0.673521,2.81521>,r}
+	cylinder{<-2.0023,0.673521,2.81521>,<-2.00312,0.6739,2.81441>,r}
+	sphere{<-2.00312,0.6739,2.81441>,r}
+	cylinder{<-2.00312,0.6739,2.81441>,<-1.8544,1.0253,2.10179>,r}
+	sphere{<-1.8544,1.0253,2.10179>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.13337,0.387226,2.79293>,<-2.0023,0.673521,2.81521>,<-1.44364,0.690603,2.80094>}
+	triangle{<-2.13337,0.387226,2.79293>,<-1.44364,0.690603,2.80094>,<-1.21846,0.226815,2.75246>}
+	triangle{<-2.13337,0.387226,2.79293>,<-1.21846,0.226815,2.75246>,<-1.70095,-0.169591,2.73013>}
+	triangle{<-2.13337,0.387226,2.79293>,<-1.70095,-0.169591,2.73013>,<-1.87433,-0.115095,2.73998>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.13337,0.387226,2.79293>,<-2.0023,0.673521,2.81521>,r}
+	sphere{<-2.0023,0.673521,2.81521>,r}
+	cylinder{<-2.0023,0.673521,2.81521>,<-1.44364,0.690603,2.80094>,r}
+	sphere{<-1.44364,0.690603,2.80094>,r}
+	cylinder{<-1.44364,0.690603,2.80094>,<-1.21846,0.226815,2.75246>,r}
+	sphere{<-1.21846,0.226815,2.75246>,r}
+	cylinder{<-1.21846,0.226815,2.75246>,<-1.70095,-0.169591,2.73013>,r}
+	sphere{<-1.70095,-0.169591,2.73013>,r}
+	cylinder{<-1.70095,-0.169591,2.73013>,<-1.87433,-0.115095,2.73998>,r}
+	sphere{<-1.87433,-0.115095,2.73998>,r}
+	cylinder{<-1.87433,-0.115095,2.73998>,<-2.13337,0.387226,2.79293>,r}
+	sphere{<-2.13337,0.387226,2.79293>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.977897,0.265917,2.36338>,<-1.21846,0.226815,2.75246>,<-1.44364,0.690603,2.80094>}
+	triangle{<-0.977897,0.265917,2.36338>,<-1.44364,0.690603,2.80094>,<-1.19465,0.964102,2.25122>}
+	triangle{<-0.977897,0.265917,2.36338>,<-1.19465,0.964102,2.25122>,<-1.02847,0.842795,2.07602>}
+	triangle{<-0.977897,0.265917,2.36338>,<-1.02847,0.842795,2.07602>,<-0.973409,0.778082,2.03344>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.977897,0.265917,2.36338>,<-1.21846,0.226815,2.75246>,r}
+	sphere{<-1.21846,0.226815,2.75246>,r}
+	cylinder{<-1.21846,0.226815,2.75246>,<-1.44364,0.690603,2.80094>,r}
+	sphere{<-1.44364,0.690603,2.80094>,r}
+	cylinder{<-1.44364,0.690603,2.80094>,<-1.19465,0.964102,2.25122>,r}
+	sphere{<-1.19465,0.964102,2.25122>,r}
+	cylinder{<-1.19465,0.964102,2.25122>,<-1.02847,0.842795,2.07602>,r}
+	sphere{<-1.02847,0.842795,2.07602>,r}
+	cylinder{<-1.02847,0.842795,2.07602>,<-0.973409,0.778082,2.03344>,r}
+	sphere{<-0.973409,0.778082,2.03344>,r}
+	cylinder{<-0.973409,0.778082,2.03344>,<-0.977897,0.265917,2.36338>,r}
+	sphere{<-0.977897,0.265917,2.36338>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.01375,1.84661,2.5924>,<-1.53052,1.94581,2.39088>,<-1.19522,1.8677,2.69725>}
+	triangle{<-2.01375,1.84661,2.5924>,<-1.19522,1.8677,2.69725>,<-1.18617,1.86381,2.71093>}
+	triangle{<-2.01375,1.84661,2.5924>,<-1.18617,1.86381,2.71093>,<-1.53589,1.66799,3.23344>}
+	triangle{<-2.01375,1.84661,2.5924>,<-1.53589,1.66799,3.23344>,<-1.86962,1.66035,3.18779>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.01375,1.84661,2.5924>,<-1.53052,1.94581,2.39088>,r}
+	sphere{<-1.53052,1.94581,2.39088>,r}
+	cylinder{<-1.53052,1.94581,2.39088>,<-1.19522,1.8677,2.69725>,r}
+	sphere{<-1.19522,1.8677,2.69725>,r}
+	cylinder{<-1.19522,1.8677,2.69725>,<-1.18617,1.86381,2.71093>,r}
+	sphere{<-1.18617,1.86381,2.71093>,r}
+	cylinder{<-1.18617,1.86381,2.71093>,<-1.53589,1.66799,3.23344>,r}
+	sphere{<-1.53589,1.66799,3.23344>,r}
+	cylinder{<-1.53589,1.66799,3.23344>,<-1.86962,1.66035,3.18779>,r}
+	sphere{<-1.86962,1.66035,3.18779>,r}
+	cylinder{<-1.86962,1.66035,3.18779>,<-2.01375,1.84661,2.5924>,r}
+	sphere{<-2.01375,1.84661,2.5924>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.29204,0.988466,3.26739>,<-1.31307,0.957292,3.26454>,<-1.87915,0.888319,3.18717>}
+	triangle{<-1.29204,0.988466,3.26739>,<-1.87915,0.888319,3.18717>,<-2.09304,1.17721,3.15766>}
+	triangle{<-1.29204,0.988466,3.26739>,<-2.09304,1.17721,3.15766>,<-1.86962,1.66035,3.18779>}
+	triangle{<-1.29204,0.988466,3.26739>,<-1.86962,1.66035,3.18779>,<-1.53589,1.66799,3.23344>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.29204,0.988466,3.26739>,<-1.31307,0.957292,3.26454>,r}
+	sphere{<-1.31307,0.957292,3.26454>,r}
+	cylinder{<-1.31307,0.957292,3.26454>,<-1.87915,0.888319,3.18717>,r}
+	sphere{<-1.87915,0.888319,3.18717>,r}
+	cylinder{<-1.87915,0.888319,3.18717>,<-2.09304,1.17721,3.15766>,r}
+	sphere{<-2.09304,1.17721,3.15766>,r}
+	cylinder{<-2.09304,1.17721,3.15766>,<-1.86962,1.66035,3.18779>,r}
+	sphere{<-1.86962,1.66035,3.18779>,r}
+	cylinder{<-1.86962,1.66035,3.18779>,<-1.53589,1.66799,3.23344>,r}
+	sphere{<-1.53589,1.66799,3.23344>,r}
+	cylinder{<-1.53589,1.66799,3.23344>,<-1.29204,0.988466,3.26739>,r}
+	sphere{<-1.29204,0.988466,3.26739>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.308166,-0.389651,2.35456>,<-0.35405,-0.387528,2.36914>,<-0.630159,0.140795,2.63048>}
+	triangle{<-0.308166,-0.389651,2.35456>,<-0.630159,0.140795,2.63048>,<-0.140831,0.556187,2.62254>}
+	triangle{<-0.308166,-0.389651,2.35456>,<-0.140831,0.556187,2.62254>,<0.0643369,0.501834,2.54225>}
+	triangle{<-0.308166,-0.389651,2.35456>,<0.0643369,0.501834,2.54225>,<0.166967,0.174275,2.40094>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.308166,-0.389651,2.35456>,<-0.35405,-0.387528,2.36914>,r}
+	sphere{<-0.35405,-0.387528,2.36914>,r}
+	cylinder{<-0.35405,-0.387528,2.36914>,<-0.630159,0.140795,2.63048>,r}
+	sphere{<-0.630159,0.140795,2.63048>,r}
+	cylinder{<-0.630159,0.140795,2.63048>,<-0.140831,0.556187,2.62254>,r}
+	sphere{<-0.140831,0.556187,2.62254>,r}
+	cylinder{<-0.140831,0.556187,2.62254>,<0.0643369,0.501834,2.54225>,r}
+	sphere{<0.0643369,0.501834,2.54225>,r}
+	cylinder{<0.0643369,0.501834,2.54225>,<0.166967,0.174275,2.40094>,r}
+	sphere{<0.166967,0.174275,2.40094>,r}
+	cylinder{<0.166967,0.174275,2.40094>,<-0.308166,-0.389651,2.35456>,r}
+	sphere{<-0.308166,-0.389651,2.35456>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.140831,0.556187,2.62254>,<-0.630159,0.140795,2.63048>,<-0.977897,0.265917,2.36338>}
+	triangle{<-0.140831,0.556187,2.62254>,<-0.977897,0.265917,2.36338>,<-0.973409,0.778082,2.03344>}
+	triangle{<-0.140831,0.556187,2.62254>,<-0.973409,0.778082,2.03344>,<-0.944606,0.813779,2.02568>}
+	triangle{<-0.140831,0.556187,2.62254>,<-0.944606,0.813779,2.02568>,<-0.768417,0.883599,2.07457>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.140831,0.556187,2.62254>,<-0.630159,0.140795,2.63048>,r}
+	sphere{<-0.630159,0.140795,2.63048>,r}
+	cylinder{<-0.630159,0.140795,2.63048>,<-0.977897,0.265917,2.36338>,r}
+	sphere{<-0.977897,0.265917,2.36338>,r}
+	cylinder{<-0.977897,0.265917,2.36338>,<-0.973409,0.778082,2.03344>,r}
+	sphere{<-0.973409,0.778082,2.03344>,r}
+	cylinder{<-0.973409,0.778082,2.03344>,<-0.944606,0.813779,2.02568>,r}
+	sphere{<-0.944606,0.813779,2.02568>,r}
+	cylinder{<-0.944606,0.813779,2.02568>,<-0.768417,0.883599,2.07457>,r}
+	sphere{<-0.768417,0.883599,2.07457>,r}
+	cylinder{<-0.768417,0.883599,2.07457>,<-0.140831,0.556187,2.62254>,r}
+	sphere{<-0.140831,0.556187,2.62254>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.467186,0.878904,2.50109>,<0.324329,0.846029,2.69722>,<0.0827516,1.29928,2.85677>}
+	triangle{<0.467186,0.878904,2.50109>,<0.0827516,1.29928,2.85677>,<0.390356,1.73073,2.31247>}
+	triangle{<0.467186,0.878904,2.50109>,<0.390356,1.73073,2.31247>,<0.522273,1.67452,2.16064>}
+	triangle{<0.467186,0.878904,2.50109>,<0.522273,1.67452,2.16064>,<0.524795,1.66926,2.15916>}
+	texture{t1}
+}
+union{
+	cylinder{<0.467186,0.878904,2.50109>,<0.324329,0.846029,2.69722>,r}
+	sphere{<0.324329,0.846029,2.69722>,r}
+	cylinder{<0.324329,0.846029,2.69722>,<0.0827516,1.29928,2.85677>,r}
+	sphere{<0.0827516,1.29928,2.85677>,r}
+	cylinder{<0.0827516,1.29928,2.85677>,<0.390356,1.73073,2.31247>,r}
+	sphere{<0.390356,1.73073,2.31247>,r}
+	cylinder{<0.390356,1.73073,2.31247>,<0.522273,1.67452,2.16064>,r}
+	sphere{<0.522273,1.67452,2.16064>,r}
+	cylinder{<0.522273,1.67452,2.16064>,<0.524795,1.66926,2.15916>,r}
+	sphere{<0.524795,1.66926,2.15916>,r}
+	cylinder{<0.524795,1.66926,2.15916>,<0.467186,0.878904,2.50109>,r}
+	sphere{<0.467186,0.878904,2.50109>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.347068,1.26686,2.89394>,<-0.120234,0.581941,2.66785>,<-0.140831,0.556187,2.62254>}
+	triangle{<-0.347068,1.26686,2.89394>,<-0.140831,0.556187,2.62254>,<-0.768417,0.883599,2.07457>}
+	triangle{<-0.347068,1.26686,2.89394>,<-0.768417,0.883599,2.07457>,<-0.610881,1.41184,2.6691>}
+	triangle{<-0.347068,1.26686,2.89394>,<-0.610881,1.41184,2.6691>,<-0.496089,1.35956,2.77501>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.347068,1.26686,2.89394>,<-0.120234,0.581941,2.66785>,r}
+	sphere{<-0.120234,0.581941,2.66785>,r}
+	cylinder{<-0.120234,0.581941,2.66785>,<-0.140831,0.556187,2.62254>,r}
+	sphere{<-0.140831,0.556187,2.62254>,r}
+	cylinder{<-0.140831,0.556187,2.62254>,<-0.768417,0.883599,2.07457>,r}
+	sphere{<-0.768417,0.883599,2.07457>,r}
+	cylinder{<-0.768417,0.883599,2.07457>,<-0.610881,1.41184,2.6691>,r}
+	sphere{<-0.610881,1.41184,2.6691>,r}
+	cylinder{<-0.610881,1.41184,2.6691>,<-0.496089,1.35956,2.77501>,r}
+	sphere{<-0.496089,1.35956,2.77501>,r}
+	cylinder{<-0.496089,1.35956,2.77501>,<-0.347068,1.26686,2.89394>,r}
+	sphere{<-0.347068,1.26686,2.89394>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.1643,0.87467,2.59342>,<1.19931,0.843467,2.5703>,<1.38179,0.28791,2.8001>}
+	triangle{<1.1643,0.87467,2.59342>,<1.38179,0.28791,2.8001>,<1.21437,0.194889,3.12658>}
+	triangle{<1.1643,0.87467,2.59342>,<1.21437,0.194889,3.12658>,<0.764802,0.669065,3.35788>}
+	triangle{<1.1643,0.87467,2.59342>,<0.764802,0.669065,3.35788>,<0.763151,0.761353,3.27801>}
+	texture{t1}
+}
+union{
+	cylinder{<1.1643,0.87467,2.59342>,<1.19931,0.843467,2.5703>,r}
+	sphere{<1.19931,0.843467,2.5703>,r}
+	cylinder{<1.19931,0.843467,2.5703>,<1.38179,0.28791,2.8001>,r}
+	sphere{<1.38179,0.28791,2.8001>,r}
+	cylinder{<1.38179,0.28791,2.8001>,<1.21437,0.194889,3.12658>,r}
+	sphere{<1.21437,0.194889,3.12658>,r}
+	cylinder{<1.21437,0.194889,3.12658>,<0.764802,0.669065,3.35788>,r}
+	sphere{<0.764802,0.669065,3.35788>,r}
+	cylinder{<0.764802,0.669065,3.35788>,<0.763151,0.761353,3.27801>,r}
+	sphere{<0.763151,0.761353,3.27801>,r}
+	cylinder{<0.763151,0.761353,3.27801>,<1.1643,0.87467,2.59342>,r}
+	sphere{<1.1643,0.87467,2.59342>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.508774,-0.141173,3.12467>,<0.450748,-0.248844,2.75349>,<0.166967,0.174275,2.40094>}
+	triangle{<0.508774,-0.141173,3.12467>,<0.166967,0.174275,2.40094>,<0.0643369,0.501834,2.54225>}
+	triangle{<0.508774,-0.141173,3.12467>,<0.0643369,0.501834,2.54225>,<0.0671471,0.5594,2.64086>}
+	triangle{<0.508774,-0.141173,3.12467>,<0.0671471,0.5594,2.64086>,<0.383541,0.243885,3.27456>}
+	texture{t1}
+}
+union{
+	cylinder{<0.508774,-0.141173,3.12467>,<0.450748,-0.248844,2.75349>,r}
+	sphere{<0.450748,-0.248844,2.75349>,r}
+	cylinder{<0.450748,-0.248844,2.75349>,<0.166967,0.174275,2.40094>,r}
+	sphere{<0.166967,0.174275,2.40094>,r}
+	cylinder{<0.166967,0.174275,2.40094>,<0.0643369,0.501834,2.54225>,r}
+	sphere{<0.0643369,0.501834,2.54225>,r}
+	cylinder{<0.0643369,0.501834,2.54225>,<0.0671471,0.5594,2.64086>,r}
+	sphere{<0.0671471,0.5594,2.64086>,r}
+	cylinder{<0.0671471,0.5594,2.64086>,<0.383541,0.243885,3.27456>,r}
+	sphere{<0.383541,0.243885,3.27456>,r}
+	cylinder{<0.383541,0.243885,3.27456>,<0.508774,-0.141173,3.12467>,r}
+	sphere{<0.508774,-0.141173,3.12467>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.1643,0.87467,2.59342>,<0.763151,0.761353,3.27801>,<0.79104,0.926663,3.51611>}
+	triangle{<1.1643,0.87467,2.59342>,<0.79104,0.926663,3.51611>,<1.34098,1.4483,3.2423>}
+	triangle{<1.1643,0.87467,2.59342>,<1.34098,1.4483,3.2423>,<1.39115,1.44414,3.12341>}
+	triangle{<1.1643,0.87467,2.59342>,<1.39115,1.44414,3.12341>,<1.19513,0.906764,2.58324>}
+	texture{t1}
+}
+union{
+	cylinder{<1.1643,0.87467,2.59342>,<0.763151,0.761353,3.27801>,r}
+	sphere{<0.763151,0.761353,3.27801>,r}
+	cylinder{<0.763151,0.761353,3.27801>,<0.79104,0.926663,3.51611>,r}
+	sphere{<0.79104,0.926663,3.51611>,r}
+	cylinder{<0.79104,0.926663,3.51611>,<1.34098,1.4483,3.2423>,r}
+	sphere{<1.34098,1.4483,3.2423>,r}
+	cylinder{<1.34098,1.4483,3.2423>,<1.39115,1.44414,3.12341>,r}
+	sphere{<1.39115,1.44414,3.12341>,r}
+	cylinder{<1.39115,1.44414,3.12341>,<1.19513,0.906764,2.58324>,r}
+	sphere{<1.19513,0.906764,2.58324>,r}
+	cylinder{<1.19513,0.906764,2.58324>,<1.1643,0.87467,2.59342>,r}
+	sphere{<1.1643,0.87467,2.59342>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.763151,0.761353,3.27801>,<0.324329,0.846029,2.69722>,<0.0827516,1.29928,2.85677>}
+	triangle{<0.763151,0.761353,3.27801>,<0.0827516,1.29928,2.85677>,<0.194247,1.47555,3.23746>}
+	triangle{<0.763151,0.761353,3.27801>,<0.194247,1.47555,3.23746>,<0.435901,1.35946,3.47542>}
+	triangle{<0.763151,0.761353,3.27801>,<0.435901,1.35946,3.47542>,<0.79104,0.926663,3.51611>}
+	texture{t1}
+}
+union{
+	cylinder{<0.763151,0.761353,3.27801>,<0.324329,0.846029,2.69722>,r}
+	sphere{<0.324329,0.846029,2.69722>,r}
+	cylinder{<0.324329,0.846029,2.69722>,<0.0827516,1.29928,2.85677>,r}
+	sphere{<0.0827516,1.29928,2.85677>,r}
+	cylinder{<0.0827516,1.29928,2.85677>,<0.194247,1.47555,3.23746>,r}
+	sphere{<0.194247,1.47555,3.23746>,r}
+	cylinder{<0.194247,1.47555,3.23746>,<0.435901,1.35946,3.47542>,r}
+	sphere{<0.435901,1.35946,3.47542>,r}
+	cylinder{<0.435901,1.35946,3.47542>,<0.79104,0.926663,3.51611>,r}
+	sphere{<0.79104,0.926663,3.51611>,r}
+	cylinder{<0.79104,0.926663,3.51611>,<0.763151,0.761353,3.27801>,r}
+	sphere{<0.763151,0.761353,3.27801>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.79104,0.926663,3.51611>,<0.435901,1.35946,3.47542>,<0.461535,1.81024,3.34214>}
+	triangle{<0.79104,0.926663,3.51611>,<0.461535,1.81024,3.34214>,<0.875611,1.99828,3.19382>}
+	triangle{<0.79104,0.926663,3.51611>,<0.875611,1.99828,3.19382>,<0.910098,1.99441,3.18699>}
+	triangle{<0.79104,0.926663,3.51611>,<0.910098,1.99441,3.18699>,<1.34098,1.4483,3.2423>}
+	texture{t1}
+}
+union{
+	cylinder{<0.79104,0.926663,3.51611>,<0.435901,1.35946,3.47542>,r}
+	sphere{<0.435901,1.35946,3.47542>,r}
+	cylinder{<0.435901,1.35946,3.47542>,<0.461535,1.81024,3.34214>,r}
+	sphere{<0.461535,1.81024,3.34214>,r}
+	cylinder{<0.461535,1.81024,3.34214>,<0.875611,1.99828,3.19382>,r}
+	sphere{<0.875611,1.99828,3.19382>,r}
+	cylinder{<0.875611,1.99828,3.19382>,<0.910098,1.99441,3.18699>,r}
+	sphere{<0.910098,1.99441,3.18699>,r}
+	cylinder{<0.910098,1.99441,3.18699>,<1.34098,1.4483,3.2423>,r}
+	sphere{<1.34098,1.4483,3.2423>,r}
+	cylinder{<1.34098,1.4483,3.2423>,<0.79104,0.926663,3.51611>,r}
+	sphere{<0.79104,0.926663,3.51611>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.41906,1.55179,1.14641>,<1.73137,1.7874,1.21081>,<1.92566,1.83679,1.63752>}
+	triangle{<1.41906,1.55179,1.14641>,<1.92566,1.83679,1.63752>,<1.8586,1.72069,1.88433>}
+	triangle{<1.41906,1.55179,1.14641>,<1.8586,1.72069,1.88433>,<1.37847,1.31967,1.93965>}
+	triangle{<1.41906,1.55179,1.14641>,<1.37847,1.31967,1.93965>,<1.19809,1.28057,1.5166>}
+	texture{t1}
+}
+union{
+	cylinder{<1.41906,1.55179,1.14641>,<1.73137,1.7874,1.21081>,r}
+	sphere{<1.73137,1.7874,1.21081>,r}
+	cylinder{<1.73137,1.7874,1.21081>,<1.92566,1.83679,1.63752>,r}
+	sphere{<1.92566,1.83679,1.63752>,r}
+	cylinder{<1.92566,1.83679,1.63752>,<1.8586,1.72069,1.88433>,r}
+	sphere{<1.8586,1.72069,1.88433>,r}
+	cylinder{<1.8586,1.72069,1.88433>,<1.37847,1.31967,1.93965>,r}
+	sphere{<1.37847,1.31967,1.93965>,r}
+	cylinder{<1.37847,1.31967,1.93965>,<1.19809,1.28057,1.5166>,r}
+	sphere{<1.19809,1.28057,1.5166>,r}
+	cylinder{<1.19809,1.28057,1.5166>,<1.41906,1.55179,1.14641>,r}
+	sphere{<1.41906,1.55179,1.14641>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.8911,0.956357,2.13415>,<1.96956,0.81704,2.69217>,<2.00969,0.747708,2.72338>}
+	triangle{<1.8911,0.956357,2.13415>,<2.00969,0.747708,2.72338>,<2.21232,0.400268,2.52346>}
+	triangle{<1.8911,0.956357,2.13415>,<2.21232,0.400268,2.52346>,<2.21577,0.398661,1.94659>}
+	triangle{<1.8911,0.956357,2.13415>,<2.21577,0.398661,1.94659>,<2.09357,0.609993,1.82742>}
+	texture{t1}
+}
+union{
+	cylinder{<1.8911,0.956357,2.13415>,<1.96956,0.81704,2.69217>,r}
+	sphere{<1.96956,0.81704,2.69217>,r}
+	cylinder{<1.96956,0.81704,2.69217>,<2.00969,0.747708,2.72338>,r}
+	sphere{<2.00969,0.747708,2.72338>,r}
+	cylinder{<2.00969,0.747708,2.72338>,<2.21232,0.400268,2.52346>,r}
+	sphere{<2.21232,0.400268,2.52346>,r}
+	cylinder{<2.21232,0.400268,2.52346>,<2.21577,0.398661,1.94659>,r}
+	sphere{<2.21577,0.398661,1.94659>,r}
+	cylinder{<2.21577,0.398661,1.94659>,<2.09357,0.609993,1.82742>,r}
+	sphere{<2.09357,0.609993,1.82742>,r}
+	cylinder{<2.09357,0.609993,1.82742>,<1.8911,0.956357,2.13415>,r}
+	sphere{<1.8911,0.956357,2.13415>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.96956,0.81704,2.69217>,<2.00969,0.747708,2.72338>,<1.86885,0.307473,2.8639>}
+	triangle{<1.96956,0.81704,2.69217>,<1.86885,0.307473,2.8639>,<1.38179,0.28791,2.8001>}
+	triangle{<1.96956,0.81704,2.69217>,<1.38179,0.28791,2.8001>,<1.19931,0.843467,2.5703>}
+	triangle{<1.96956,0.81704,2.69217>,<1.19931,0.843467,2.5703>,<1.22576,0.875701,2.56236>}
+	texture{t1}
+}
+union{
+	cylinder{<1.96956,0.81704,2.69217>,<2.00969,0.747708,2.72338>,r}
+	sphere{<2.00969,0.747708,2.72338>,r}
+	cylinder{<2.00969,0.747708,2.72338>,<1.86885,0.307473,2.8639>,r}
+	sphere{<1.86885,0.307473,2.8639>,r}
+	cylinder{<1.86885,0.307473,2.8639>,<1.38179,0.28791,2.8001>,r}
+	sphere{<1.38179,0.28791,2.8001>,r}
+	cylinder{<1.38179,0.28791,2.8001>,<1.19931,0.843467,2.5703>,r}
+	sphere{<1.19931,0.843467,2.5703>,r}
+	cylinder{<1.19931,0.843467,2.5703>,<1.22576,0.875701,2.56236>,r}
+	sphere{<1.22576,0.875701,2.56236>,r}
+	cylinder{<1.22576,0.875701,2.56236>,<1.96956,0.81704,2.69217>,r}
+	sphere{<1.96956,0.81704,2.69217>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.21412,1.83563,2.74832>,<1.38112,2.01282,2.59592>,<2.08118,1.98315,2.6726>}
+	triangle{<1.21412,1.83563,2.74832>,<2.08118,1.98315,2.6726>,<2.08965,1.97179,2.68372>}
+	triangle{<1.21412,1.83563,2.74832>,<2.08965,1.97179,2.68372>,<1.8037,1.40462,3.18901>}
+	triangle{<1.21412,1.83563,2.74832>,<1.8037,1.40462,3.18901>,<1.39115,1.44414,3.12341>}
+	texture{t1}
+}
+union{
+	cylinder{<1.21412,1.83563,2.74832>,<1.38112,2.01282,2.59592>,r}
+	sphere{<1.38112,2.01282,2.59592>,r}
+	cylinder{<1.38112,2.01282,2.59592>,<2.08118,1.98315,2.6726>,r}
+	sphere{<2.08118,1.98315,2.6726>,r}
+	cylinder{<2.08118,1.98315,2.6726>,<2.08965,1.97179,2.68372>,r}
+	sphere{<2.08965,1.97179,2.68372>,r}
+	cylinder{<2.08965,1.97179,2.68372>,<1.8037,1.40462,3.18901>,r}
+	sphere{<1.8037,1.40462,3.18901>,r}
+	cylinder{<1.8037,1.40462,3.18901>,<1.39115,1.44414,3.12341>,r}
+	sphere{<1.39115,1.44414,3.12341>,r}
+	cylinder{<1.39115,1.44414,3.12341>,<1.21412,1.83563,2.74832>,r}
+	sphere{<1.21412,1.83563,2.74832>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.86625,1.06469,2.09129>,<-2.06062,1.04894,1.86822>,<-3,1.60487,1.9143>}
+	triangle{<-1.86625,1.06469,2.09129>,<-3,1.60487,1.9143>,<-3,1.73646,2.14834>}
+	triangle{<-1.86625,1.06469,2.09129>,<-3,1.73646,2.14834>,<-2.89776,1.72942,2.23841>}
+	triangle{<-1.86625,1.06469,2.09129>,<-2.89776,1.72942,2.23841>,<-2.20699,1.48649,2.49954>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.86625,1.06469,2.09129>,<-2.06062,1.04894,1.86822>,r}
+	sphere{<-2.06062,1.04894,1.86822>,r}
+	cylinder{<-2.06062,1.04894,1.86822>,<-3,1.60487,1.9143>,r}
+	sphere{<-3,1.60487,1.9143>,r}
+	cylinder{<-3,1.60487,1.9143>,<-3,1.73646,2.14834>,r}
+	sphere{<-3,1.73646,2.14834>,r}
+	cylinder{<-3,1.73646,2.14834>,<-2.89776,1.72942,2.23841>,r}
+	sphere{<-2.89776,1.72942,2.23841>,r}
+	cylinder{<-2.89776,1.72942,2.23841>,<-2.20699,1.48649,2.49954>,r}
+	sphere{<-2.20699,1.48649,2.49954>,r}
+	cylinder{<-2.20699,1.48649,2.49954>,<-1.86625,1.06469,2.09129>,r}
+	sphere{<-1.86625,1.06469,2.09129>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.03722,2.40217,1.98266>,<-1.80871,2.29843,2.30586>,<-2.0917,1.94978,2.56644>}
+	triangle{<-2.03722,2.40217,1.98266>,<-2.0917,1.94978,2.56644>,<-2.89776,1.72942,2.23841>}
+	triangle{<-2.03722,2.40217,1.98266>,<-2.89776,1.72942,2.23841>,<-3,1.73646,2.14834>}
+	triangle{<-2.03722,2.40217,1.98266>,<-3,1.73646,2.14834>,<-3,1.85631,1.98234>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.03722,2.40217,1.98266>,<-1.80871,2.29843,2.30586>,r}
+	sphere{<-1.80871,2.29843,2.30586>,r}
+	cylinder{<-1.80871,2.29843,2.30586>,<-2.0917,1.94978,2.56644>,r}
+	sphere{<-2.0917,1.94978,2.56644>,r}
+	cylinder{<-2.0917,1.94978,2.56644>,<-2.89776,1.72942,2.23841>,r}
+	sphere{<-2.89776,1.72942,2.23841>,r}
+	cylinder{<-2.89776,1.72942,2.23841>,<-3,1.73646,2.14834>,r}
+	sphere{<-3,1.73646,2.14834>,r}
+	cylinder{<-3,1.73646,2.14834>,<-3,1.85631,1.98234>,r}
+	sphere{<-3,1.85631,1.98234>,r}
+	cylinder{<-3,1.85631,1.98234>,<-2.03722,2.40217,1.98266>,r}
+	sphere{<-2.03722,2.40217,1.98266>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.0787577,2.84046,2.8347>,<-0.448769,2.02577,2.26775>,<-0.654643,2.22252,1.95234>}
+	triangle{<-0.0787577,2.84046,2.8347>,<-0.654643,2.22252,1.95234>,<-0.71772,2.49733,1.85572>}
+	triangle{<-0.0787577,2.84046,2.8347>,<-0.71772,2.49733,1.85572>,<-0.717746,3,1.85572>}
+	triangle{<-0.0787577,2.84046,2.8347>,<-0.717746,3,1.85572>,<-0.0787587,3,2.83471>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.0787577,2.84046,2.8347>,<-0.448769,2.02577,2.26775>,r}
+	sphere{<-0.448769,2.02577,2.26775>,r}
+	cylinder{<-0.448769,2.02577,2.26775>,<-0.654643,2.22252,1.95234>,r}
+	sphere{<-0.654643,2.22252,1.95234>,r}
+	cylinder{<-0.654643,2.22252,1.95234>,<-0.71772,2.49733,1.85572>,r}
+	sphere{<-0.71772,2.49733,1.85572>,r}
+	cylinder{<-0.71772,2.49733,1.85572>,<-0.717746,3,1.85572>,r}
+	sphere{<-0.717746,3,1.85572>,r}
+	cylinder{<-0.717746,3,1.85572>,<-0.0787587,3,2.83471>,r}
+	sphere{<-0.0787587,3,2.83471>,r}
+	cylinder{<-0.0787587,3,2.83471>,<-0.0787577,2.84046,2.8347>,r}
+	sphere{<-0.0787577,2.84046,2.8347>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.768417,0.883599,2.07457>,<-0.944606,0.813779,2.02568>,<-1.02847,0.842795,2.07602>}
+	triangle{<-0.768417,0.883599,2.07457>,<-1.02847,0.842795,2.07602>,<-1.19465,0.964102,2.25122>}
+	triangle{<-0.768417,0.883599,2.07457>,<-1.19465,0.964102,2.25122>,<-0.966848,1.36793,2.6852>}
+	triangle{<-0.768417,0.883599,2.07457>,<-0.966848,1.36793,2.6852>,<-0.610881,1.41184,2.6691>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.768417,0.883599,2.07457>,<-0.944606,0.813779,2.02568>,r}
+	sphere{<-0.944606,0.813779,2.02568>,r}
+	cylinder{<-0.944606,0.813779,2.02568>,<-1.02847,0.842795,2.07602>,r}
+	sphere{<-1.02847,0.842795,2.07602>,r}
+	cylinder{<-1.02847,0.842795,2.07602>,<-1.19465,0.964102,2.25122>,r}
+	sphere{<-1.19465,0.964102,2.25122>,r}
+	cylinder{<-1.19465,0.964102,2.25122>,<-0.966848,1.36793,2.6852>,r}
+	sphere{<-0.966848,1.36793,2.6852>,r}
+	cylinder{<-0.966848,1.36793,2.6852>,<-0.610881,1.41184,2.6691>,r}
+	sphere{<-0.610881,1.41184,2.6691>,r}
+	cylinder{<-0.610881,1.41184,2.6691>,<-0.768417,0.883599,2.07457>,r}
+	sphere{<-0.768417,0.883599,2.07457>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.64484,3,2.46512>,<-1.21954,3,3.19431>,<-1.03503,2.21692,3.13807>}
+	triangle{<-1.64484,3,2.46512>,<-1.03503,2.21692,3.13807>,<-1.18617,1.86381,2.71093>}
+	triangle{<-1.64484,3,2.46512>,<-1.18617,1.86381,2.71093>,<-1.19522,1.8677,2.69725>}
+	triangle{<-1.64484,3,2.46512>,<-1.19522,1.8677,2.69725>,<-1.46253,2.09126,2.34532>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.64484,3,2.46512>,<-1.21954,3,3.19431>,r}
+	sphere{<-1.21954,3,3.19431>,r}
+	cylinder{<-1.21954,3,3.19431>,<-1.03503,2.21692,3.13807>,r}
+	sphere{<-1.03503,2.21692,3.13807>,r}
+	cylinder{<-1.03503,2.21692,3.13807>,<-1.18617,1.86381,2.71093>,r}
+	sphere{<-1.18617,1.86381,2.71093>,r}
+	cylinder{<-1.18617,1.86381,2.71093>,<-1.19522,1.8677,2.69725>,r}
+	sphere{<-1.19522,1.8677,2.69725>,r}
+	cylinder{<-1.19522,1.8677,2.69725>,<-1.46253,2.09126,2.34532>,r}
+	sphere{<-1.46253,2.09126,2.34532>,r}
+	cylinder{<-1.46253,2.09126,2.34532>,<-1.64484,3,2.46512>,r}
+	sphere{<-1.64484,3,2.46512>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.539308,1.97496,3.07511>,<0.426589,1.81811,3.31078>,<-0.061335,2.16227,3.42216>}
+	triangle{<0.539308,1.97496,3.07511>,<-0.061335,2.16227,3.42216>,<-0.0895464,2.83375,2.84988>}
+	triangle{<0.539308,1.97496,3.07511>,<-0.0895464,2.83375,2.84988>,<-0.0787577,2.84046,2.8347>}
+	triangle{<0.539308,1.97496,3.07511>,<-0.0787577,2.84046,2.8347>,<0.114215,2.72435,2.77287>}
+	texture{t1}
+}
+union{
+	cylinder{<0.539308,1.97496,3.07511>,<0.426589,1.81811,3.31078>,r}
+	sphere{<0.426589,1.81811,3.31078>,r}
+	cylinder{<0.426589,1.81811,3.31078>,<-0.061335,2.16227,3.42216>,r}
+	sphere{<-0.061335,2.16227,3.42216>,r}
+	cylinder{<-0.061335,2.16227,3.42216>,<-0.0895464,2.83375,2.84988>,r}
+	sphere{<-0.0895464,2.83375,2.84988>,r}
+	cylinder{<-0.0895464,2.83375,2.84988>,<-0.0787577,2.84046,2.8347>,r}
+	sphere{<-0.0787577,2.84046,2.8347>,r}
+	cylinder{<-0.0787577,2.84046,2.8347>,<0.114215,2.72435,2.77287>,r}
+	sphere{<0.114215,2.72435,2.77287>,r}
+	cylinder{<0.114215,2.72435,2.77287>,<0.539308,1.97496,3.07511>,r}
+	sphere{<0.539308,1.97496,3.07511>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.549722,1.68002,2.14525>,<0.581432,1.67312,2.1648>,<1.0378,1.53351,2.28574>}
+	triangle{<0.549722,1.68002,2.14525>,<1.0378,1.53351,2.28574>,<1.37847,1.31967,1.93965>}
+	triangle{<0.549722,1.68002,2.14525>,<1.37847,1.31967,1.93965>,<1.19809,1.28057,1.5166>}
+	triangle{<0.549722,1.68002,2.14525>,<1.19809,1.28057,1.5166>,<0.895015,1.38366,1.47758>}
+	texture{t1}
+}
+union{
+	cylinder{<0.549722,1.68002,2.14525>,<0.581432,1.67312,2.1648>,r}
+	sphere{<0.581432,1.67312,2.1648>,r}
+	cylinder{<0.581432,1.67312,2.1648>,<1.0378,1.53351,2.28574>,r}
+	sphere{<1.0378,1.53351,2.28574>,r}
+	cylinder{<1.0378,1.53351,2.28574>,<1.37847,1.31967,1.93965>,r}
+	sphere{<1.37847,1.31967,1.93965>,r}
+	cylinder{<1.37847,1.31967,1.93965>,<1.19809,1.28057,1.5166>,r}
+	sphere{<1.19809,1.28057,1.5166>,r}
+	cylinder{<1.19809,1.28057,1.5166>,<0.895015,1.38366,1.47758>,r}
+	sphere{<0.895015,1.38366,1.47758>,r}
+	cylinder{<0.895015,1.38366,1.47758>,<0.549722,1.68002,2.14525>,r}
+	sphere{<0.549722,1.68002,2.14525>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.0378,1.53351,2.28574>,<1.06808,1.72207,2.38277>,<1.32962,1.98023,2.37709>}
+	triangle{<1.0378,1.53351,2.28574>,<1.32962,1.98023,2.37709>,<1.82248,1.89097,2.01191>}
+	triangle{<1.0378,1.53351,2.28574>,<1.82248,1.89097,2.01191>,<1.8586,1.72069,1.88433>}
+	triangle{<1.0378,1.53351,2.28574>,<1.8586,1.72069,1.88433>,<1.37847,1.31967,1.93965>}
+	texture{t1}
+}
+union{
+	cylinder{<1.0378,1.53351,2.28574>,<1.06808,1.72207,2.38277>,r}
+	sphere{<1.06808,1.72207,2.38277>,r}
+	cylinder{<1.06808,1.72207,2.38277>,<1.32962,1.98023,2.37709>,r}
+	sphere{<1.32962,1.98023,2.37709>,r}
+	cylinder{<1.32962,1.98023,2.37709>,<1.82248,1.89097,2.01191>,r}
+	sphere{<1.82248,1.89097,2.01191>,r}
+	cylinder{<1.82248,1.89097,2.01191>,<1.8586,1.72069,1.88433>,r}
+	sphere{<1.8586,1.72069,1.88433>,r}
+	cylinder{<1.8586,1.72069,1.88433>,<1.37847,1.31967,1.93965>,r}
+	sphere{<1.37847,1.31967,1.93965>,r}
+	cylinder{<1.37847,1.31967,1.93965>,<1.0378,1.53351,2.28574>,r}
+	sphere{<1.0378,1.53351,2.28574>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.30591,3,3.02196>,<1.38112,2.01282,2.59592>,<1.21412,1.83563,2.74832>}
+	triangle{<1.30591,3,3.02196>,<1.21412,1.83563,2.74832>,<0.910098,1.99441,3.18699>}
+	triangle{<1.30591,3,3.02196>,<0.910098,1.99441,3.18699>,<0.905582,2.01864,3.20083>}
+	triangle{<1.30591,3,3.02196>,<0.905582,2.01864,3.20083>,<1.224,3,3.12581>}
+	texture{t1}
+}
+union{
+	cylinder{<1.30591,3,3.02196>,<1.38112,2.01282,2.59592>,r}
+	sphere{<1.38112,2.01282,2.59592>,r}
+	cylinder{<1.38112,2.01282,2.59592>,<1.21412,1.83563,2.74832>,r}
+	sphere{<1.21412,1.83563,2.74832>,r}
+	cylinder{<1.21412,1.83563,2.74832>,<0.910098,1.99441,3.18699>,r}
+	sphere{<0.910098,1.99441,3.18699>,r}
+	cylinder{<0.910098,1.99441,3.18699>,<0.905582,2.01864,3.20083>,r}
+	sphere{<0.905582,2.01864,3.20083>,r}
+	cylinder{<0.905582,2.01864,3.20083>,<1.224,3,3.12581>,r}
+	sphere{<1.224,3,3.12581>,r}
+	cylinder{<1.224,3,3.12581>,<1.30591,3,3.02196>,r}
+	sphere{<1.30591,3,3.02196>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.192644,3,2.74776>,<1.224,3,3.12581>,<0.905582,2.01864,3.20083>}
+	triangle{<0.192644,3,2.74776>,<0.905582,2.01864,3.20083>,<0.875611,1.99828,3.19382>}
+	triangle{<0.192644,3,2.74776>,<0.875611,1.99828,3.19382>,<0.539308,1.97496,3.07511>}
+	triangle{<0.192644,3,2.74776>,<0.539308,1.97496,3.07511>,<0.114215,2.72435,2.77287>}
+	texture{t1}
+}
+union{
+	cylinder{<0.192644,3,2.74776>,<1.224,3,3.12581>,r}
+	sphere{<1.224,3,3.12581>,r}
+	cylinder{<1.224,3,3.12581>,<0.905582,2.01864,3.20083>,r}
+	sphere{<0.905582,2.01864,3.20083>,r}
+	cylinder{<0.905582,2.01864,3.20083>,<0.875611,1.99828,3.19382>,r}
+	sphere{<0.875611,1.99828,3.19382>,r}
+	cylinder{<0.875611,1.99828,3.19382>,<0.539308,1.97496,3.07511>,r}
+	sphere{<0.539308,1.97496,3.07511>,r}
+	cylinder{<0.539308,1.97496,3.07511>,<0.114215,2.72435,2.77287>,r}
+	sphere{<0.114215,2.72435,2.77287>,r}
+	cylinder{<0.114215,2.72435,2.77287>,<0.192644,3,2.74776>,r}
+	sphere{<0.192644,3,2.74776>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.66858,2.95941,1.98386>,<2.75087,3,1.95534>,<3,3,1.95532>}
+	triangle{<2.66858,2.95941,1.98386>,<3,3,1.95532>,<3,1.9712,2.67802>}
+	triangle{<2.66858,2.95941,1.98386>,<3,1.9712,2.67802>,<2.09352,1.97131,2.67801>}
+	triangle{<2.66858,2.95941,1.98386>,<2.09352,1.97131,2.67801>,<2.08332,1.98261,2.67007>}
+	texture{t1}
+}
+union{
+	cylinder{<2.66858,2.95941,1.98386>,<2.75087,3,1.95534>,r}
+	sphere{<2.75087,3,1.95534>,r}
+	cylinder{<2.75087,3,1.95534>,<3,3,1.95532>,r}
+	sphere{<3,3,1.95532>,r}
+	cylinder{<3,3,1.95532>,<3,1.9712,2.67802>,r}
+	sphere{<3,1.9712,2.67802>,r}
+	cylinder{<3,1.9712,2.67802>,<2.09352,1.97131,2.67801>,r}
+	sphere{<2.09352,1.97131,2.67801>,r}
+	cylinder{<2.09352,1.97131,2.67801>,<2.08332,1.98261,2.67007>,r}
+	sphere{<2.08332,1.98261,2.67007>,r}
+	cylinder{<2.08332,1.98261,2.67007>,<2.66858,2.95941,1.98386>,r}
+	sphere{<2.66858,2.95941,1.98386>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.82248,1.89097,2.01191>,<2.08332,1.98261,2.67007>,<2.09352,1.97131,2.67801>}
+	triangle{<1.82248,1.89097,2.01191>,<2.09352,1.97131,2.67801>,<2.29107,1.44043,2.45895>}
+	triangle{<1.82248,1.89097,2.01191>,<2.29107,1.44043,2.45895>,<2.12547,1.37719,2.03504>}
+	triangle{<1.82248,1.89097,2.01191>,<2.12547,1.37719,2.03504>,<1.8586,1.72069,1.88433>}
+	texture{t1}
+}
+union{
+	cylinder{<1.82248,1.89097,2.01191>,<2.08332,1.98261,2.67007>,r}
+	sphere{<2.08332,1.98261,2.67007>,r}
+	cylinder{<2.08332,1.98261,2.67007>,<2.09352,1.97131,2.67801>,r}
+	sphere{<2.09352,1.97131,2.67801>,r}
+	cylinder{<2.09352,1.97131,2.67801>,<2.29107,1.44043,2.45895>,r}
+	sphere{<2.29107,1.44043,2.45895>,r}
+	cylinder{<2.29107,1.44043,2.45895>,<2.12547,1.37719,2.03504>,r}
+	sphere{<2.12547,1.37719,2.03504>,r}
+	cylinder{<2.12547,1.37719,2.03504>,<1.8586,1.72069,1.88433>,r}
+	sphere{<1.8586,1.72069,1.88433>,r}
+	cylinder{<1.8586,1.72069,1.88433>,<1.82248,1.89097,2.01191>,r}
+	sphere{<1.82248,1.89097,2.01191>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.74062,3,3.07771>,<1.84744,3,3.43639>,<2.025,2.72403,3.61227>}
+	triangle{<1.74062,3,3.07771>,<2.025,2.72403,3.61227>,<2.24475,2.02295,3.28241>}
+	triangle{<1.74062,3,3.07771>,<2.24475,2.02295,3.28241>,<2.08965,1.97179,2.68372>}
+	triangle{<1.74062,3,3.07771>,<2.08965,1.97179,2.68372>,<2.08118,1.98315,2.6726>}
+	texture{t1}
+}
+union{
+	cylinder{<1.74062,3,3.07771>,<1.84744,3,3.43639>,r}
+	sphere{<1.84744,3,3.43639>,r}
+	cylinder{<1.84744,3,3.43639>,<2.025,2.72403,3.61227>,r}
+	sphere{<2.025,2.72403,3.61227>,r}
+	cylinder{<2.025,2.72403,3.61227>,<2.24475,2.02295,3.28241>,r}
+	sphere{<2.24475,2.02295,3.28241>,r}
+	cylinder{<2.24475,2.02295,3.28241>,<2.08965,1.97179,2.68372>,r}
+	sphere{<2.08965,1.97179,2.68372>,r}
+	cylinder{<2.08965,1.97179,2.68372>,<2.08118,1.98315,2.6726>,r}
+	sphere{<2.08118,1.98315,2.6726>,r}
+	cylinder{<2.08118,1.98315,2.6726>,<1.74062,3,3.07771>,r}
+	sphere{<1.74062,3,3.07771>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.23699,-3,3.20419>,<-1.87704,-1.90116,3.42194>,<-1.88582,-1.90689,2.62325>}
+	triangle{<-2.23699,-3,3.20419>,<-1.88582,-1.90689,2.62325>,<-1.92029,-2.00985,2.51761>}
+	triangle{<-2.23699,-3,3.20419>,<-1.92029,-2.00985,2.51761>,<-1.97592,-2.18051,2.51493>}
+	triangle{<-2.23699,-3,3.20419>,<-1.97592,-2.18051,2.51493>,<-2.24065,-3,2.78176>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.23699,-3,3.20419>,<-1.87704,-1.90116,3.42194>,r}
+	sphere{<-1.87704,-1.90116,3.42194>,r}
+	cylinder{<-1.87704,-1.90116,3.42194>,<-1.88582,-1.90689,2.62325>,r}
+	sphere{<-1.88582,-1.90689,2.62325>,r}
+	cylinder{<-1.88582,-1.90689,2.62325>,<-1.92029,-2.00985,2.51761>,r}
+	sphere{<-1.92029,-2.00985,2.51761>,r}
+	cylinder{<-1.92029,-2.00985,2.51761>,<-1.97592,-2.18051,2.51493>,r}
+	sphere{<-1.97592,-2.18051,2.51493>,r}
+	cylinder{<-1.97592,-2.18051,2.51493>,<-2.24065,-3,2.78176>,r}
+	sphere{<-2.24065,-3,2.78176>,r}
+	cylinder{<-2.24065,-3,2.78176>,<-2.23699,-3,3.20419>,r}
+	sphere{<-2.23699,-3,3.20419>,r}
+	texture{t2}
+}
+union{
+	triangle{<-3,-2.32031,3.84185>,<-2.56095,-1.9703,3.74567>,<-2.18852,-1.80867,3.82973>}
+	triangle{<-3,-2.32031,3.84185>,<-2.18852,-1.80867,3.82973>,<-1.83383,-2.00045,4.33305>}
+	triangle{<-3,-2.32031,3.84185>,<-1.83383,-2.00045,4.33305>,<-2.82172,-3,4.80901>}
+	triangle{<-3,-2.32031,3.84185>,<-2.82172,-3,4.80901>,<-3,-3,4.67405>}
+	texture{t1}
+}
+union{
+	cylinder{<-3,-2.32031,3.84185>,<-2.56095,-1.9703,3.74567>,r}
+	sphere{<-2.56095,-1.9703,3.74567>,r}
+	cylinder{<-2.56095,-1.9703,3.74567>,<-2.18852,-1.80867,3.82973>,r}
+	sphere{<-2.18852,-1.80867,3.82973>,r}
+	cylinder{<-2.18852,-1.80867,3.82973>,<-1.83383,-2.00045,4.33305>,r}
+	sphere{<-1.83383,-2.00045,4.33305>,r}
+	cylinder{<-1.83383,-2.00045,4.33305>,<-2.82172,-3,4.80901>,r}
+	sphere{<-2.82172,-3,4.80901>,r}
+	cylinder{<-2.82172,-3,4.80901>,<-3,-3,4.67405>,r}
+	sphere{<-3,-3,4.67405>,r}
+	cylinder{<-3,-3,4.67405>,<-3,-2.32031,3.84185>,r}
+	sphere{<-3,-2.32031,3.84185>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.83383,-2.00045,4.33305>,<-2.18852,-1.80867,3.82973>,<-1.92853,-1.83988,3.4706>}
+	triangle{<-1.83383,-2.00045,4.33305>,<-1.92853,-1.83988,3.4706>,<-1.90782,-1.8448,3.45824>}
+	triangle{<-1.83383,-2.00045,4.33305>,<-1.90782,-1.8448,3.45824>,<-1.75209,-1.90598,3.52595>}
+	triangle{<-1.83383,-2.00045,4.33305>,<-1.75209,-1.90598,3.52595>,<-1.66636,-2.04318,4.25236>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.83383,-2.00045,4.33305>,<-2.18852,-1.80867,3.82973>,r}
+	sphere{<-2.18852,-1.80867,3.82973>,r}
+	cylinder{<-2.18852,-1.80867,3.82973>,<-1.92853,-1.83988,3.4706>,r}
+	sphere{<-1.92853,-1.83988,3.4706>,r}
+	cylinder{<-1.92853,-1.83988,3.4706>,<-1.90782,-1.8448,3.45824>,r}
+	sphere{<-1.90782,-1.8448,3.45824>,r}
+	cylinder{<-1.90782,-1.8448,3.45824>,<-1.75209,-1.90598,3.52595>,r}
+	sphere{<-1.75209,-1.90598,3.52595>,r}
+	cylinder{<-1.75209,-1.90598,3.52595>,<-1.66636,-2.04318,4.25236>,r}
+	sphere{<-1.66636,-2.04318,4.25236>,r}
+	cylinder{<-1.66636,-2.04318,4.25236>,<-1.83383,-2.00045,4.33305>,r}
+	sphere{<-1.83383,-2.00045,4.33305>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.08928,-0.913651,2.92432>,<-0.972824,-1.19267,3.46743>,<-1.20276,-1.27652,3.62822>}
+	triangle{<-1.08928,-0.913651,2.92432>,<-1.20276,-1.27652,3.62822>,<-1.80259,-1.15454,3.38578>}
+	triangle{<-1.08928,-0.913651,2.92432>,<-1.80259,-1.15454,3.38578>,<-1.80675,-1.14664,3.3704>}
+	triangle{<-1.08928,-0.913651,2.92432>,<-1.80675,-1.14664,3.3704>,<-1.31914,-0.881668,2.86009>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.08928,-0.913651,2.92432>,<-0.972824,-1.19267,3.46743>,r}
+	sphere{<-0.972824,-1.19267,3.46743>,r}
+	cylinder{<-0.972824,-1.19267,3.46743>,<-1.20276,-1.27652,3.62822>,r}
+	sphere{<-1.20276,-1.27652,3.62822>,r}
+	cylinder{<-1.20276,-1.27652,3.62822>,<-1.80259,-1.15454,3.38578>,r}
+	sphere{<-1.80259,-1.15454,3.38578>,r}
+	cylinder{<-1.80259,-1.15454,3.38578>,<-1.80675,-1.14664,3.3704>,r}
+	sphere{<-1.80675,-1.14664,3.3704>,r}
+	cylinder{<-1.80675,-1.14664,3.3704>,<-1.31914,-0.881668,2.86009>,r}
+	sphere{<-1.31914,-0.881668,2.86009>,r}
+	cylinder{<-1.31914,-0.881668,2.86009>,<-1.08928,-0.913651,2.92432>,r}
+	sphere{<-1.08928,-0.913651,2.92432>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.618632,-1.75152,3.33933>,<-1.05818,-2.10499,3.19615>,<-1.74275,-1.93342,3.50333>}
+	triangle{<-0.618632,-1.75152,3.33933>,<-1.74275,-1.93342,3.50333>,<-1.75209,-1.90598,3.52595>}
+	triangle{<-0.618632,-1.75152,3.33933>,<-1.75209,-1.90598,3.52595>,<-1.16522,-1.48931,3.67654>}
+	triangle{<-0.618632,-1.75152,3.33933>,<-1.16522,-1.48931,3.67654>,<-0.707811,-1.62458,3.45614>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.618632,-1.75152,3.33933>,<-1.05818,-2.10499,3.19615>,r}
+	sphere{<-1.05818,-2.10499,3.19615>,r}
+	cylinder{<-1.05818,-2.10499,3.19615>,<-1.74275,-1.93342,3.50333>,r}
+	sphere{<-1.74275,-1.93342,3.50333>,r}
+	cylinder{<-1.74275,-1.93342,3.50333>,<-1.75209,-1.90598,3.52595>,r}
+	sphere{<-1.75209,-1.90598,3.52595>,r}
+	cylinder{<-1.75209,-1.90598,3.52595>,<-1.16522,-1.48931,3.67654>,r}
+	sphere{<-1.16522,-1.48931,3.67654>,r}
+	cylinder{<-1.16522,-1.48931,3.67654>,<-0.707811,-1.62458,3.45614>,r}
+	sphere{<-0.707811,-1.62458,3.45614>,r}
+	cylinder{<-0.707811,-1.62458,3.45614>,<-0.618632,-1.75152,3.33933>,r}
+	sphere{<-0.618632,-1.75152,3.33933>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.20276,-1.27652,3.62822>,<-1.16522,-1.48931,3.67654>,<-1.75209,-1.90598,3.52595>}
+	triangle{<-1.20276,-1.27652,3.62822>,<-1.75209,-1.90598,3.52595>,<-1.90782,-1.8448,3.45824>}
+	triangle{<-1.20276,-1.27652,3.62822>,<-1.90782,-1.8448,3.45824>,<-1.91517,-1.83171,3.45339>}
+	triangle{<-1.20276,-1.27652,3.62822>,<-1.91517,-1.83171,3.45339>,<-1.80259,-1.15454,3.38578>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.20276,-1.27652,3.62822>,<-1.16522,-1.48931,3.67654>,r}
+	sphere{<-1.16522,-1.48931,3.67654>,r}
+	cylinder{<-1.16522,-1.48931,3.67654>,<-1.75209,-1.90598,3.52595>,r}
+	sphere{<-1.75209,-1.90598,3.52595>,r}
+	cylinder{<-1.75209,-1.90598,3.52595>,<-1.90782,-1.8448,3.45824>,r}
+	sphere{<-1.90782,-1.8448,3.45824>,r}
+	cylinder{<-1.90782,-1.8448,3.45824>,<-1.91517,-1.83171,3.45339>,r}
+	sphere{<-1.91517,-1.83171,3.45339>,r}
+	cylinder{<-1.91517,-1.83171,3.45339>,<-1.80259,-1.15454,3.38578>,r}
+	sphere{<-1.80259,-1.15454,3.38578>,r}
+	cylinder{<-1.80259,-1.15454,3.38578>,<-1.20276,-1.27652,3.62822>,r}
+	sphere{<-1.20276,-1.27652,3.62822>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.31914,-0.881668,2.86009>,<-1.80675,-1.14664,3.3704>,<-2.06475,-1.57701,2.91705>}
+	triangle{<-1.31914,-0.881668,2.86009>,<-2.06475,-1.57701,2.91705>,<-2.05478,-1.59693,2.84346>}
+	triangle{<-1.31914,-0.881668,2.86009>,<-2.05478,-1.59693,2.84346>,<-1.91743,-1.54566,2.64149>}
+	triangle{<-1.31914,-0.881668,2.86009>,<-1.91743,-1.54566,2.64149>,<-1.3156,-1.00955,2.53282>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.31914,-0.881668,2.86009>,<-1.80675,-1.14664,3.3704>,r}
+	sphere{<-1.80675,-1.14664,3.3704>,r}
+	cylinder{<-1.80675,-1.14664,3.3704>,<-2.06475,-1.57701,2.91705>,r}
+	sphere{<-2.06475,-1.57701,2.91705>,r}
+	cylinder{<-2.06475,-1.57701,2.91705>,<-2.05478,-1.59693,2.84346>,r}
+	sphere{<-2.05478,-1.59693,2.84346>,r}
+	cylinder{<-2.05478,-1.59693,2.84346>,<-1.91743,-1.54566,2.64149>,r}
+	sphere{<-1.91743,-1.54566,2.64149>,r}
+	cylinder{<-1.91743,-1.54566,2.64149>,<-1.3156,-1.00955,2.53282>,r}
+	sphere{<-1.3156,-1.00955,2.53282>,r}
+	cylinder{<-1.3156,-1.00955,2.53282>,<-1.31914,-0.881668,2.86009>,r}
+	sphere{<-1.31914,-0.881668,2.86009>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.45251,-2.0295,3.59451>,<-0.879659,-3,3.7617>,<-1.08115,-3,3.6169>}
+	triangle{<-0.45251,-2.0295,3.59451>,<-1.08115,-3,3.6169>,<-1.05818,-2.10499,3.19615>}
+	triangle{<-0.45251,-2.0295,3.59451>,<-1.05818,-2.10499,3.19615>,<-0.618632,-1.75152,3.33933>}
+	triangle{<-0.45251,-2.0295,3.59451>,<-0.618632,-1.75152,3.33933>,<-0.609493,-1.75217,3.34622>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.45251,-2.0295,3.59451>,<-0.879659,-3,3.7617>,r}
+	sphere{<-0.879659,-3,3.7617>,r}
+	cylinder{<-0.879659,-3,3.7617>,<-1.08115,-3,3.6169>,r}
+	sphere{<-1.08115,-3,3.6169>,r}
+	cylinder{<-1.08115,-3,3.6169>,<-1.05818,-2.10499,3.19615>,r}
+	sphere{<-1.05818,-2.10499,3.19615>,r}
+	cylinder{<-1.05818,-2.10499,3.19615>,<-0.618632,-1.75152,3.33933>,r}
+	sphere{<-0.618632,-1.75152,3.33933>,r}
+	cylinder{<-0.618632,-1.75152,3.33933>,<-0.609493,-1.75217,3.34622>,r}
+	sphere{<-0.609493,-1.75217,3.34622>,r}
+	cylinder{<-0.609493,-1.75217,3.34622>,<-0.45251,-2.0295,3.59451>,r}
+	sphere{<-0.45251,-2.0295,3.59451>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.30113,-2.10342,4.68573>,<-0.83528,-2.52129,4.55188>,<-0.841862,-2.51456,4.53931>}
+	triangle{<-0.30113,-2.10342,4.68573>,<-0.841862,-2.51456,4.53931>,<-0.529136,-1.88232,4.26165>}
+	triangle{<-0.30113,-2.10342,4.68573>,<-0.529136,-1.88232,4.26165>,<-0.343237,-1.81023,4.37561>}
+	triangle{<-0.30113,-2.10342,4.68573>,<-0.343237,-1.81023,4.37561>,<-0.289062,-1.90273,4.51309>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.30113,-2.10342,4.68573>,<-0.83528,-2.52129,4.55188>,r}
+	sphere{<-0.83528,-2.52129,4.55188>,r}
+	cylinder{<-0.83528,-2.52129,4.55188>,<-0.841862,-2.51456,4.53931>,r}
+	sphere{<-0.841862,-2.51456,4.53931>,r}
+	cylinder{<-0.841862,-2.51456,4.53931>,<-0.529136,-1.88232,4.26165>,r}
+	sphere{<-0.529136,-1.88232,4.26165>,r}
+	cylinder{<-0.529136,-1.88232,4.26165>,<-0.343237,-1.81023,4.37561>,r}
+	sphere{<-0.343237,-1.81023,4.37561>,r}
+	cylinder{<-0.343237,-1.81023,4.37561>,<-0.289062,-1.90273,4.51309>,r}
+	sphere{<-0.289062,-1.90273,4.51309>,r}
+	cylinder{<-0.289062,-1.90273,4.51309>,<-0.30113,-2.10342,4.68573>,r}
+	sphere{<-0.30113,-2.10342,4.68573>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.879659,-3,3.7617>,<-0.45251,-2.0295,3.59451>,<-0.458685,-1.84752,3.98564>}
+	triangle{<-0.879659,-3,3.7617>,<-0.458685,-1.84752,3.98564>,<-0.529136,-1.88232,4.26165>}
+	triangle{<-0.879659,-3,3.7617>,<-0.529136,-1.88232,4.26165>,<-0.841862,-2.51456,4.53931>}
+	triangle{<-0.879659,-3,3.7617>,<-0.841862,-2.51456,4.53931>,<-0.983325,-3,4.26938>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.879659,-3,3.7617>,<-0.45251,-2.0295,3.59451>,r}
+	sphere{<-0.45251,-2.0295,3.59451>,r}
+	cylinder{<-0.45251,-2.0295,3.59451>,<-0.458685,-1.84752,3.98564>,r}
+	sphere{<-0.458685,-1.84752,3.98564>,r}
+	cylinder{<-0.458685,-1.84752,3.98564>,<-0.529136,-1.88232,4.26165>,r}
+	sphere{<-0.529136,-1.88232,4.26165>,r}
+	cylinder{<-0.529136,-1.88232,4.26165>,<-0.841862,-2.51456,4.53931>,r}
+	sphere{<-0.841862,-2.51456,4.53931>,r}
+	cylinder{<-0.841862,-2.51456,4.53931>,<-0.983325,-3,4.26938>,r}
+	sphere{<-0.983325,-3,4.26938>,r}
+	cylinder{<-0.983325,-3,4.26938>,<-0.879659,-3,3.7617>,r}
+	sphere{<-0.879659,-3,3.7617>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.16522,-1.48931,3.67654>,<-0.707811,-1.62458,3.45614>,<-0.62471,-1.66177,3.471>}
+	triangle{<-1.16522,-1.48931,3.67654>,<-0.62471,-1.66177,3.471>,<-0.458685,-1.84752,3.98564>}
+	triangle{<-1.16522,-1.48931,3.67654>,<-0.458685,-1.84752,3.98564>,<-0.529136,-1.88232,4.26165>}
+	triangle{<-1.16522,-1.48931,3.67654>,<-0.529136,-1.88232,4.26165>,<-1.14087,-1.62871,4.24007>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.16522,-1.48931,3.67654>,<-0.707811,-1.62458,3.45614>,r}
+	sphere{<-0.707811,-1.62458,3.45614>,r}
+	cylinder{<-0.707811,-1.62458,3.45614>,<-0.62471,-1.66177,3.471>,r}
+	sphere{<-0.62471,-1.66177,3.471>,r}
+	cylinder{<-0.62471,-1.66177,3.471>,<-0.458685,-1.84752,3.98564>,r}
+	sphere{<-0.458685,-1.84752,3.98564>,r}
+	cylinder{<-0.458685,-1.84752,3.98564>,<-0.529136,-1.88232,4.26165>,r}
+	sphere{<-0.529136,-1.88232,4.26165>,r}
+	cylinder{<-0.529136,-1.88232,4.26165>,<-1.14087,-1.62871,4.24007>,r}
+	sphere{<-1.14087,-1.62871,4.24007>,r}
+	cylinder{<-1.14087,-1.62871,4.24007>,<-1.16522,-1.48931,3.67654>,r}
+	sphere{<-1.16522,-1.48931,3.67654>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.58495,-1.97439,2.85037>,<1.12675,-2.40884,3.24735>,<1.12352,-2.41028,3.3131>}
+	triangle{<1.58495,-1.97439,2.85037>,<1.12352,-2.41028,3.3131>,<1.47471,-2.05985,3.6835>}
+	triangle{<1.58495,-1.97439,2.85037>,<1.47471,-2.05985,3.6835>,<1.8043,-1.74576,3.45923>}
+	triangle{<1.58495,-1.97439,2.85037>,<1.8043,-1.74576,3.45923>,<1.81827,-1.73396,3.3913>}
+	texture{t1}
+}
+union{
+	cylinder{<1.58495,-1.97439,2.85037>,<1.12675,-2.40884,3.24735>,r}
+	sphere{<1.12675,-2.40884,3.24735>,r}
+	cylinder{<1.12675,-2.40884,3.24735>,<1.12352,-2.41028,3.3131>,r}
+	sphere{<1.12352,-2.41028,3.3131>,r}
+	cylinder{<1.12352,-2.41028,3.3131>,<1.47471,-2.05985,3.6835>,r}
+	sphere{<1.47471,-2.05985,3.6835>,r}
+	cylinder{<1.47471,-2.05985,3.6835>,<1.8043,-1.74576,3.45923>,r}
+	sphere{<1.8043,-1.74576,3.45923>,r}
+	cylinder{<1.8043,-1.74576,3.45923>,<1.81827,-1.73396,3.3913>,r}
+	sphere{<1.81827,-1.73396,3.3913>,r}
+	cylinder{<1.81827,-1.73396,3.3913>,<1.58495,-1.97439,2.85037>,r}
+	sphere{<1.58495,-1.97439,2.85037>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.213418,-1.48486,4.29493>,<0.12327,-1.19005,4.18158>,<0.516811,-1.08498,3.60007>}
+	triangle{<0.213418,-1.48486,4.29493>,<0.516811,-1.08498,3.60007>,<0.653266,-1.22277,3.53316>}
+	triangle{<0.213418,-1.48486,4.29493>,<0.653266,-1.22277,3.53316>,<0.738381,-1.8712,3.92633>}
+	triangle{<0.213418,-1.48486,4.29493>,<0.738381,-1.8712,3.92633>,<0.716039,-1.88091,3.96224>}
+	texture{t1}
+}
+union{
+	cylinder{<0.213418,-1.48486,4.29493>,<0.12327,-1.19005,4.18158>,r}
+	sphere{<0.12327,-1.19005,4.18158>,r}
+	cylinder{<0.12327,-1.19005,4.18158>,<0.516811,-1.08498,3.60007>,r}
+	sphere{<0.516811,-1.08498,3.60007>,r}
+	cylinder{<0.516811,-1.08498,3.60007>,<0.653266,-1.22277,3.53316>,r}
+	sphere{<0.653266,-1.22277,3.53316>,r}
+	cylinder{<0.653266,-1.22277,3.53316>,<0.738381,-1.8712,3.92633>,r}
+	sphere{<0.738381,-1.8712,3.92633>,r}
+	cylinder{<0.738381,-1.8712,3.92633>,<0.716039,-1.88091,3.96224>,r}
+	sphere{<0.716039,-1.88091,3.96224>,r}
+	cylinder{<0.716039,-1.88091,3.96224>,<0.213418,-1.48486,4.29493>,r}
+	sphere{<0.213418,-1.48486,4.29493>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.10441,-1.80555,3.98163>,<1.47471,-2.05985,3.6835>,<1.79495,-2.46323,4.01935>}
+	triangle{<1.10441,-1.80555,3.98163>,<1.79495,-2.46323,4.01935>,<1.78913,-2.52314,4.23083>}
+	triangle{<1.10441,-1.80555,3.98163>,<1.78913,-2.52314,4.23083>,<1.16324,-2.02682,4.51958>}
+	triangle{<1.10441,-1.80555,3.98163>,<1.16324,-2.02682,4.51958>,<1.06006,-1.85916,4.2894>}
+	texture{t1}
+}
+union{
+	cylinder{<1.10441,-1.80555,3.98163>,<1.47471,-2.05985,3.6835>,r}
+	sphere{<1.47471,-2.05985,3.6835>,r}
+	cylinder{<1.47471,-2.05985,3.6835>,<1.79495,-2.46323,4.01935>,r}
+	sphere{<1.79495,-2.46323,4.01935>,r}
+	cylinder{<1.79495,-2.46323,4.01935>,<1.78913,-2.52314,4.23083>,r}
+	sphere{<1.78913,-2.52314,4.23083>,r}
+	cylinder{<1.78913,-2.52314,4.23083>,<1.16324,-2.02682,4.51958>,r}
+	sphere{<1.16324,-2.02682,4.51958>,r}
+	cylinder{<1.16324,-2.02682,4.51958>,<1.06006,-1.85916,4.2894>,r}
+	sphere{<1.06006,-1.85916,4.2894>,r}
+	cylinder{<1.06006,-1.85916,4.2894>,<1.10441,-1.80555,3.98163>,r}
+	sphere{<1.10441,-1.80555,3.98163>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.79495,-2.46323,4.01935>,<2.12546,-2.03883,3.70893>,<2.44824,-1.8329,4.22507>}
+	triangle{<1.79495,-2.46323,4.01935>,<2.44824,-1.8329,4.22507>,<2.31566,-2.05207,4.5418>}
+	triangle{<1.79495,-2.46323,4.01935>,<2.31566,-2.05207,4.5418>,<2.0617,-2.31745,4.54178>}
+	triangle{<1.79495,-2.46323,4.01935>,<2.0617,-2.31745,4.54178>,<1.78913,-2.52314,4.23083>}
+	texture{t1}
+}
+union{
+	cylinder{<1.79495,-2.46323,4.01935>,<2.12546,-2.03883,3.70893>,r}
+	sphere{<2.12546,-2.03883,3.70893>,r}
+	cylinder{<2.12546,-2.03883,3.70893>,<2.44824,-1.8329,4.22507>,r}
+	sphere{<2.44824,-1.8329,4.22507>,r}
+	cylinder{<2.44824,-1.8329,4.22507>,<2.31566,-2.05207,4.5418>,r}
+	sphere{<2.31566,-2.05207,4.5418>,r}
+	cylinder{<2.31566,-2.05207,4.5418>,<2.0617,-2.31745,4.54178>,r}
+	sphere{<2.0617,-2.31745,4.54178>,r}
+	cylinder{<2.0617,-2.31745,4.54178>,<1.78913,-2.52314,4.23083>,r}
+	sphere{<1.78913,-2.52314,4.23083>,r}
+	cylinder{<1.78913,-2.52314,4.23083>,<1.79495,-2.46323,4.01935>,r}
+	sphere{<1.79495,-2.46323,4.01935>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.78913,-2.52314,4.23083>,<1.16324,-2.02682,4.51958>,<1.16488,-2.01626,4.53111>}
+	triangle{<1.78913,-2.52314,4.23083>,<1.16488,-2.01626,4.53111>,<1.91139,-1.86454,4.95661>}
+	triangle{<1.78913,-2.52314,4.23083>,<1.91139,-1.86454,4.95661>,<2.01635,-1.96983,4.88535>}
+	triangle{<1.78913,-2.52314,4.23083>,<2.01635,-1.96983,4.88535>,<2.0617,-2.31745,4.54178>}
+	texture{t1}
+}
+union{
+	cylinder{<1.78913,-2.52314,4.23083>,<1.16324,-2.02682,4.51958>,r}
+	sphere{<1.16324,-2.02682,4.51958>,r}
+	cylinder{<1.16324,-2.02682,4.51958>,<1.16488,-2.01626,4.53111>,r}
+	sphere{<1.16488,-2.01626,4.53111>,r}
+	cylinder{<1.16488,-2.01626,4.53111>,<1.91139,-1.86454,4.95661>,r}
+	sphere{<1.91139,-1.86454,4.95661>,r}
+	cylinder{<1.91139,-1.86454,4.95661>,<2.01635,-1.96983,4.88535>,r}
+	sphere{<2.01635,-1.96983,4.88535>,r}
+	cylinder{<2.01635,-1.96983,4.88535>,<2.0617,-2.31745,4.54178>,r}
+	sphere{<2.0617,-2.31745,4.54178>,r}
+	cylinder{<2.0617,-2.31745,4.54178>,<1.78913,-2.52314,4.23083>,r}
+	sphere{<1.78913,-2.52314,4.23083>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.92853,-1.83988,3.4706>,<-2.18852,-1.80867,3.82973>,<-2.33271,-1.30729,4.09051>}
+	triangle{<-1.92853,-1.83988,3.4706>,<-2.33271,-1.30729,4.09051>,<-2.01583,-0.769833,3.72604>}
+	triangle{<-1.92853,-1.83988,3.4706>,<-2.01583,-0.769833,3.72604>,<-1.80259,-1.15454,3.38578>}
+	triangle{<-1.92853,-1.83988,3.4706>,<-1.80259,-1.15454,3.38578>,<-1.91517,-1.83171,3.45339>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.92853,-1.83988,3.4706>,<-2.18852,-1.80867,3.82973>,r}
+	sphere{<-2.18852,-1.80867,3.82973>,r}
+	cylinder{<-2.18852,-1.80867,3.82973>,<-2.33271,-1.30729,4.09051>,r}
+	sphere{<-2.33271,-1.30729,4.09051>,r}
+	cylinder{<-2.33271,-1.30729,4.09051>,<-2.01583,-0.769833,3.72604>,r}
+	sphere{<-2.01583,-0.769833,3.72604>,r}
+	cylinder{<-2.01583,-0.769833,3.72604>,<-1.80259,-1.15454,3.38578>,r}
+	sphere{<-1.80259,-1.15454,3.38578>,r}
+	cylinder{<-1.80259,-1.15454,3.38578>,<-1.91517,-1.83171,3.45339>,r}
+	sphere{<-1.91517,-1.83171,3.45339>,r}
+	cylinder{<-1.91517,-1.83171,3.45339>,<-1.92853,-1.83988,3.4706>,r}
+	sphere{<-1.92853,-1.83988,3.4706>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.48051,-1.93905,4.39903>,<-1.76938,-1.71065,4.77935>,<-1.75768,-1.64689,4.80028>}
+	triangle{<-1.48051,-1.93905,4.39903>,<-1.75768,-1.64689,4.80028>,<-1.69153,-1.51138,4.80669>}
+	triangle{<-1.48051,-1.93905,4.39903>,<-1.69153,-1.51138,4.80669>,<-1.19758,-1.30792,4.45211>}
+	triangle{<-1.48051,-1.93905,4.39903>,<-1.19758,-1.30792,4.45211>,<-1.14087,-1.62871,4.24007>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.48051,-1.93905,4.39903>,<-1.76938,-1.71065,4.77935>,r}
+	sphere{<-1.76938,-1.71065,4.77935>,r}
+	cylinder{<-1.76938,-1.71065,4.77935>,<-1.75768,-1.64689,4.80028>,r}
+	sphere{<-1.75768,-1.64689,4.80028>,r}
+	cylinder{<-1.75768,-1.64689,4.80028>,<-1.69153,-1.51138,4.80669>,r}
+	sphere{<-1.69153,-1.51138,4.80669>,r}
+	cylinder{<-1.69153,-1.51138,4.80669>,<-1.19758,-1.30792,4.45211>,r}
+	sphere{<-1.19758,-1.30792,4.45211>,r}
+	cylinder{<-1.19758,-1.30792,4.45211>,<-1.14087,-1.62871,4.24007>,r}
+	sphere{<-1.14087,-1.62871,4.24007>,r}
+	cylinder{<-1.14087,-1.62871,4.24007>,<-1.48051,-1.93905,4.39903>,r}
+	sphere{<-1.48051,-1.93905,4.39903>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.83383,-2.00045,4.33305>,<-2.18852,-1.80867,3.82973>,<-2.33271,-1.30729,4.09051>}
+	triangle{<-1.83383,-2.00045,4.33305>,<-2.33271,-1.30729,4.09051>,<-2.15236,-1.24226,4.5251>}
+	triangle{<-1.83383,-2.00045,4.33305>,<-2.15236,-1.24226,4.5251>,<-1.78448,-1.67321,4.7921>}
+	triangle{<-1.83383,-2.00045,4.33305>,<-1.78448,-1.67321,4.7921>,<-1.77035,-1.71069,4.77935>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.83383,-2.00045,4.33305>,<-2.18852,-1.80867,3.82973>,r}
+	sphere{<-2.18852,-1.80867,3.82973>,r}
+	cylinder{<-2.18852,-1.80867,3.82973>,<-2.33271,-1.30729,4.09051>,r}
+	sphere{<-2.33271,-1.30729,4.09051>,r}
+	cylinder{<-2.33271,-1.30729,4.09051>,<-2.15236,-1.24226,4.5251>,r}
+	sphere{<-2.15236,-1.24226,4.5251>,r}
+	cylinder{<-2.15236,-1.24226,4.5251>,<-1.78448,-1.67321,4.7921>,r}
+	sphere{<-1.78448,-1.67321,4.7921>,r}
+	cylinder{<-1.78448,-1.67321,4.7921>,<-1.77035,-1.71069,4.77935>,r}
+	sphere{<-1.77035,-1.71069,4.77935>,r}
+	cylinder{<-1.77035,-1.71069,4.77935>,<-1.83383,-2.00045,4.33305>,r}
+	sphere{<-1.83383,-2.00045,4.33305>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.19758,-1.30792,4.45211>,<-1.69153,-1.51138,4.80669>,<-1.95445,-1.01202,4.57849>}
+	triangle{<-1.19758,-1.30792,4.45211>,<-1.95445,-1.01202,4.57849>,<-1.79459,-0.704627,4.298>}
+	triangle{<-1.19758,-1.30792,4.45211>,<-1.79459,-0.704627,4.298>,<-1.44727,-0.722674,4.15921>}
+	triangle{<-1.19758,-1.30792,4.45211>,<-1.44727,-0.722674,4.15921>,<-1.28452,-0.814623,4.15147>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.19758,-1.30792,4.45211>,<-1.69153,-1.51138,4.80669>,r}
+	sphere{<-1.69153,-1.51138,4.80669>,r}
+	cylinder{<-1.69153,-1.51138,4.80669>,<-1.95445,-1.01202,4.57849>,r}
+	sphere{<-1.95445,-1.01202,4.57849>,r}
+	cylinder{<-1.95445,-1.01202,4.57849>,<-1.79459,-0.704627,4.298>,r}
+	sphere{<-1.79459,-0.704627,4.298>,r}
+	cylinder{<-1.79459,-0.704627,4.298>,<-1.44727,-0.722674,4.15921>,r}
+	sphere{<-1.44727,-0.722674,4.15921>,r}
+	cylinder{<-1.44727,-0.722674,4.15921>,<-1.28452,-0.814623,4.15147>,r}
+	sphere{<-1.28452,-0.814623,4.15147>,r}
+	cylinder{<-1.28452,-0.814623,4.15147>,<-1.19758,-1.30792,4.45211>,r}
+	sphere{<-1.19758,-1.30792,4.45211>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.01583,-0.769833,3.72604>,<-1.8479,-0.653477,3.98195>,<-1.79459,-0.704627,4.298>}
+	triangle{<-2.01583,-0.769833,3.72604>,<-1.79459,-0.704627,4.298>,<-1.95445,-1.01202,4.57849>}
+	triangle{<-2.01583,-0.769833,3.72604>,<-1.95445,-1.01202,4.57849>,<-2.15236,-1.24226,4.5251>}
+	triangle{<-2.01583,-0.769833,3.72604>,<-2.15236,-1.24226,4.5251>,<-2.33271,-1.30729,4.09051>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.01583,-0.769833,3.72604>,<-1.8479,-0.653477,3.98195>,r}
+	sphere{<-1.8479,-0.653477,3.98195>,r}
+	cylinder{<-1.8479,-0.653477,3.98195>,<-1.79459,-0.704627,4.298>,r}
+	sphere{<-1.79459,-0.704627,4.298>,r}
+	cylinder{<-1.79459,-0.704627,4.298>,<-1.95445,-1.01202,4.57849>,r}
+	sphere{<-1.95445,-1.01202,4.57849>,r}
+	cylinder{<-1.95445,-1.01202,4.57849>,<-2.15236,-1.24226,4.5251>,r}
+	sphere{<-2.15236,-1.24226,4.5251>,r}
+	cylinder{<-2.15236,-1.24226,4.5251>,<-2.33271,-1.30729,4.09051>,r}
+	sphere{<-2.33271,-1.30729,4.09051>,r}
+	cylinder{<-2.33271,-1.30729,4.09051>,<-2.01583,-0.769833,3.72604>,r}
+	sphere{<-2.01583,-0.769833,3.72604>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.8479,-0.653477,3.98195>,<-1.95182,-0.518949,3.8453>,<-2.14103,-0.246293,3.97774>}
+	triangle{<-1.8479,-0.653477,3.98195>,<-2.14103,-0.246293,3.97774>,<-2.13892,-0.216786,4.42422>}
+	triangle{<-1.8479,-0.653477,3.98195>,<-2.13892,-0.216786,4.42422>,<-1.89854,-0.541773,4.55037>}
+	triangle{<-1.8479,-0.653477,3.98195>,<-1.89854,-0.541773,4.55037>,<-1.79459,-0.704627,4.298>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.8479,-0.653477,3.98195>,<-1.95182,-0.518949,3.8453>,r}
+	sphere{<-1.95182,-0.518949,3.8453>,r}
+	cylinder{<-1.95182,-0.518949,3.8453>,<-2.14103,-0.246293,3.97774>,r}
+	sphere{<-2.14103,-0.246293,3.97774>,r}
+	cylinder{<-2.14103,-0.246293,3.97774>,<-2.13892,-0.216786,4.42422>,r}
+	sphere{<-2.13892,-0.216786,4.42422>,r}
+	cylinder{<-2.13892,-0.216786,4.42422>,<-1.89854,-0.541773,4.55037>,r}
+	sphere{<-1.89854,-0.541773,4.55037>,r}
+	cylinder{<-1.89854,-0.541773,4.55037>,<-1.79459,-0.704627,4.298>,r}
+	sphere{<-1.79459,-0.704627,4.298>,r}
+	cylinder{<-1.79459,-0.704627,4.298>,<-1.8479,-0.653477,3.98195>,r}
+	sphere{<-1.8479,-0.653477,3.98195>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.98287,0.261776,4.60447>,<-1.87125,0.562152,3.92495>,<-1.83098,0.572105,3.9268>}
+	triangle{<-1.98287,0.261776,4.60447>,<-1.83098,0.572105,3.9268>,<-1.51901,0.639448,3.96565>}
+	triangle{<-1.98287,0.261776,4.60447>,<-1.51901,0.639448,3.96565>,<-1.25603,0.525431,4.42703>}
+	triangle{<-1.98287,0.261776,4.60447>,<-1.25603,0.525431,4.42703>,<-1.67653,0.255845,4.82346>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.98287,0.261776,4.60447>,<-1.87125,0.562152,3.92495>,r}
+	sphere{<-1.87125,0.562152,3.92495>,r}
+	cylinder{<-1.87125,0.562152,3.92495>,<-1.83098,0.572105,3.9268>,r}
+	sphere{<-1.83098,0.572105,3.9268>,r}
+	cylinder{<-1.83098,0.572105,3.9268>,<-1.51901,0.639448,3.96565>,r}
+	sphere{<-1.51901,0.639448,3.96565>,r}
+	cylinder{<-1.51901,0.639448,3.96565>,<-1.25603,0.525431,4.42703>,r}
+	sphere{<-1.25603,0.525431,4.42703>,r}
+	cylinder{<-1.25603,0.525431,4.42703>,<-1.67653,0.255845,4.82346>,r}
+	sphere{<-1.67653,0.255845,4.82346>,r}
+	cylinder{<-1.67653,0.255845,4.82346>,<-1.98287,0.261776,4.60447>,r}
+	sphere{<-1.98287,0.261776,4.60447>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.985881,0.356372,4.33876>,<-0.912189,0.160091,4.38771>,<-1.12766,-0.23004,4.71338>}
+	triangle{<-0.985881,0.356372,4.33876>,<-1.12766,-0.23004,4.71338>,<-1.4768,-0.172462,4.9057>}
+	triangle{<-0.985881,0.356372,4.33876>,<-1.4768,-0.172462,4.9057>,<-1.67653,0.255845,4.82346>}
+	triangle{<-0.985881,0.356372,4.33876>,<-1.67653,0.255845,4.82346>,<-1.25603,0.525431,4.42703>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.985881,0.356372,4.33876>,<-0.912189,0.160091,4.38771>,r}
+	sphere{<-0.912189,0.160091,4.38771>,r}
+	cylinder{<-0.912189,0.160091,4.38771>,<-1.12766,-0.23004,4.71338>,r}
+	sphere{<-1.12766,-0.23004,4.71338>,r}
+	cylinder{<-1.12766,-0.23004,4.71338>,<-1.4768,-0.172462,4.9057>,r}
+	sphere{<-1.4768,-0.172462,4.9057>,r}
+	cylinder{<-1.4768,-0.172462,4.9057>,<-1.67653,0.255845,4.82346>,r}
+	sphere{<-1.67653,0.255845,4.82346>,r}
+	cylinder{<-1.67653,0.255845,4.82346>,<-1.25603,0.525431,4.42703>,r}
+	sphere{<-1.25603,0.525431,4.42703>,r}
+	cylinder{<-1.25603,0.525431,4.42703>,<-0.985881,0.356372,4.33876>,r}
+	sphere{<-0.985881,0.356372,4.33876>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.972824,-1.19267,3.46743>,<-0.61567,-0.578709,3.6762>,<-0.606816,-0.578059,3.67864>}
+	triangle{<-0.972824,-1.19267,3.46743>,<-0.606816,-0.578059,3.67864>,<-0.217945,-1.10681,3.68174>}
+	triangle{<-0.972824,-1.19267,3.46743>,<-0.217945,-1.10681,3.68174>,<-0.62471,-1.66177,3.471>}
+	triangle{<-0.972824,-1.19267,3.46743>,<-0.62471,-1.66177,3.471>,<-0.707811,-1.62458,3.45614>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.972824,-1.19267,3.46743>,<-0.61567,-0.578709,3.6762>,r}
+	sphere{<-0.61567,-0.578709,3.6762>,r}
+	cylinder{<-0.61567,-0.578709,3.6762>,<-0.606816,-0.578059,3.67864>,r}
+	sphere{<-0.606816,-0.578059,3.67864>,r}
+	cylinder{<-0.606816,-0.578059,3.67864>,<-0.217945,-1.10681,3.68174>,r}
+	sphere{<-0.217945,-1.10681,3.68174>,r}
+	cylinder{<-0.217945,-1.10681,3.68174>,<-0.62471,-1.66177,3.471>,r}
+	sphere{<-0.62471,-1.66177,3.471>,r}
+	cylinder{<-0.62471,-1.66177,3.471>,<-0.707811,-1.62458,3.45614>,r}
+	sphere{<-0.707811,-1.62458,3.45614>,r}
+	cylinder{<-0.707811,-1.62458,3.45614>,<-0.972824,-1.19267,3.46743>,r}
+	sphere{<-0.972824,-1.19267,3.46743>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.357396,-1.76359,3.0527>,<-0.609493,-1.75217,3.34622>,<-0.62471,-1.66177,3.471>}
+	triangle{<-0.357396,-1.76359,3.0527>,<-0.62471,-1.66177,3.471>,<-0.217945,-1.10681,3.68174>}
+	triangle{<-0.357396,-1.76359,3.0527>,<-0.217945,-1.10681,3.68174>,<0.167201,-1.04199,3.33152>}
+	triangle{<-0.357396,-1.76359,3.0527>,<0.167201,-1.04199,3.33152>,<0.181806,-1.17484,3.15675>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.357396,-1.76359,3.0527>,<-0.609493,-1.75217,3.34622>,r}
+	sphere{<-0.609493,-1.75217,3.34622>,r}
+	cylinder{<-0.609493,-1.75217,3.34622>,<-0.62471,-1.66177,3.471>,r}
+	sphere{<-0.62471,-1.66177,3.471>,r}
+	cylinder{<-0.62471,-1.66177,3.471>,<-0.217945,-1.10681,3.68174>,r}
+	sphere{<-0.217945,-1.10681,3.68174>,r}
+	cylinder{<-0.217945,-1.10681,3.68174>,<0.167201,-1.04199,3.33152>,r}
+	sphere{<0.167201,-1.04199,3.33152>,r}
+	cylinder{<0.167201,-1.04199,3.33152>,<0.181806,-1.17484,3.15675>,r}
+	sphere{<0.181806,-1.17484,3.15675>,r}
+	cylinder{<0.181806,-1.17484,3.15675>,<-0.357396,-1.76359,3.0527>,r}
+	sphere{<-0.357396,-1.76359,3.0527>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.01583,-0.769833,3.72604>,<-1.8479,-0.653477,3.98195>,<-1.44727,-0.722674,4.15921>}
+	triangle{<-2.01583,-0.769833,3.72604>,<-1.44727,-0.722674,4.15921>,<-1.28452,-0.814623,4.15147>}
+	triangle{<-2.01583,-0.769833,3.72604>,<-1.28452,-0.814623,4.15147>,<-1.20276,-1.27652,3.62822>}
+	triangle{<-2.01583,-0.769833,3.72604>,<-1.20276,-1.27652,3.62822>,<-1.80259,-1.15454,3.38578>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.01583,-0.769833,3.72604>,<-1.8479,-0.653477,3.98195>,r}
+	sphere{<-1.8479,-0.653477,3.98195>,r}
+	cylinder{<-1.8479,-0.653477,3.98195>,<-1.44727,-0.722674,4.15921>,r}
+	sphere{<-1.44727,-0.722674,4.15921>,r}
+	cylinder{<-1.44727,-0.722674,4.15921>,<-1.28452,-0.814623,4.15147>,r}
+	sphere{<-1.28452,-0.814623,4.15147>,r}
+	cylinder{<-1.28452,-0.814623,4.15147>,<-1.20276,-1.27652,3.62822>,r}
+	sphere{<-1.20276,-1.27652,3.62822>,r}
+	cylinder{<-1.20276,-1.27652,3.62822>,<-1.80259,-1.15454,3.38578>,r}
+	sphere{<-1.80259,-1.15454,3.38578>,r}
+	cylinder{<-1.80259,-1.15454,3.38578>,<-2.01583,-0.769833,3.72604>,r}
+	sphere{<-2.01583,-0.769833,3.72604>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.252271,-1.77204,4.30689>,<-0.343237,-1.81023,4.37561>,<-0.754825,-1.12061,4.73475>}
+	triangle{<-0.252271,-1.77204,4.30689>,<-0.754825,-1.12061,4.73475>,<-0.711108,-0.984586,4.70831>}
+	triangle{<-0.252271,-1.77204,4.30689>,<-0.711108,-0.984586,4.70831>,<-0.198642,-0.872817,4.31541>}
+	triangle{<-0.252271,-1.77204,4.30689>,<-0.198642,-0.872817,4.31541>,<-0.0162321,-1.18702,4.15577>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.252271,-1.77204,4.30689>,<-0.343237,-1.81023,4.37561>,r}
+	sphere{<-0.343237,-1.81023,4.37561>,r}
+	cylinder{<-0.343237,-1.81023,4.37561>,<-0.754825,-1.12061,4.73475>,r}
+	sphere{<-0.754825,-1.12061,4.73475>,r}
+	cylinder{<-0.754825,-1.12061,4.73475>,<-0.711108,-0.984586,4.70831>,r}
+	sphere{<-0.711108,-0.984586,4.70831>,r}
+	cylinder{<-0.711108,-0.984586,4.70831>,<-0.198642,-0.872817,4.31541>,r}
+	sphere{<-0.198642,-0.872817,4.31541>,r}
+	cylinder{<-0.198642,-0.872817,4.31541>,<-0.0162321,-1.18702,4.15577>,r}
+	sphere{<-0.0162321,-1.18702,4.15577>,r}
+	cylinder{<-0.0162321,-1.18702,4.15577>,<-0.252271,-1.77204,4.30689>,r}
+	sphere{<-0.252271,-1.77204,4.30689>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.711108,-0.984586,4.70831>,<-0.754825,-1.12061,4.73475>,<-1.19758,-1.30792,4.45211>}
+	triangle{<-0.711108,-0.984586,4.70831>,<-1.19758,-1.30792,4.45211>,<-1.28452,-0.814623,4.15147>}
+	triangle{<-0.711108,-0.984586,4.70831>,<-1.28452,-0.814623,4.15147>,<-1.14772,-0.63237,4.18128>}
+	triangle{<-0.711108,-0.984586,4.70831>,<-1.14772,-0.63237,4.18128>,<-1.0818,-0.589775,4.21656>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.711108,-0.984586,4.70831>,<-0.754825,-1.12061,4.73475>,r}
+	sphere{<-0.754825,-1.12061,4.73475>,r}
+	cylinder{<-0.754825,-1.12061,4.73475>,<-1.19758,-1.30792,4.45211>,r}
+	sphere{<-1.19758,-1.30792,4.45211>,r}
+	cylinder{<-1.19758,-1.30792,4.45211>,<-1.28452,-0.814623,4.15147>,r}
+	sphere{<-1.28452,-0.814623,4.15147>,r}
+	cylinder{<-1.28452,-0.814623,4.15147>,<-1.14772,-0.63237,4.18128>,r}
+	sphere{<-1.14772,-0.63237,4.18128>,r}
+	cylinder{<-1.14772,-0.63237,4.18128>,<-1.0818,-0.589775,4.21656>,r}
+	sphere{<-1.0818,-0.589775,4.21656>,r}
+	cylinder{<-1.0818,-0.589775,4.21656>,<-0.711108,-0.984586,4.70831>,r}
+	sphere{<-0.711108,-0.984586,4.70831>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.711108,-0.984586,4.70831>,<-1.0818,-0.589775,4.21656>,<-1.05274,-0.557901,4.15262>}
+	triangle{<-0.711108,-0.984586,4.70831>,<-1.05274,-0.557901,4.15262>,<-0.836757,-0.504807,3.97726>}
+	triangle{<-0.711108,-0.984586,4.70831>,<-0.836757,-0.504807,3.97726>,<-0.580491,-0.5226,3.90099>}
+	triangle{<-0.711108,-0.984586,4.70831>,<-0.580491,-0.5226,3.90099>,<-0.198642,-0.872817,4.31541>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.711108,-0.984586,4.70831>,<-1.0818,-0.589775,4.21656>,r}
+	sphere{<-1.0818,-0.589775,4.21656>,r}
+	cylinder{<-1.0818,-0.589775,4.21656>,<-1.05274,-0.557901,4.15262>,r}
+	sphere{<-1.05274,-0.557901,4.15262>,r}
+	cylinder{<-1.05274,-0.557901,4.15262>,<-0.836757,-0.504807,3.97726>,r}
+	sphere{<-0.836757,-0.504807,3.97726>,r}
+	cylinder{<-0.836757,-0.504807,3.97726>,<-0.580491,-0.5226,3.90099>,r}
+	sphere{<-0.580491,-0.5226,3.90099>,r}
+	cylinder{<-0.580491,-0.5226,3.90099>,<-0.198642,-0.872817,4.31541>,r}
+	sphere{<-0.198642,-0.872817,4.31541>,r}
+	cylinder{<-0.198642,-0.872817,4.31541>,<-0.711108,-0.984586,4.70831>,r}
+	sphere{<-0.711108,-0.984586,4.70831>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.508774,-0.141173,3.12467>,<0.9528,-0.194393,3.03645>,<1.18996,-0.570446,3.41923>}
+	triangle{<0.508774,-0.141173,3.12467>,<1.18996,-0.570446,3.41923>,<0.979224,-0.722762,3.6807>}
+	triangle{<0.508774,-0.141173,3.12467>,<0.979224,-0.722762,3.6807>,<0.790972,-0.695725,3.71256>}
+	triangle{<0.508774,-0.141173,3.12467>,<0.790972,-0.695725,3.71256>,<0.390346,-0.262469,3.31575>}
+	texture{t1}
+}
+union{
+	cylinder{<0.508774,-0.141173,3.12467>,<0.9528,-0.194393,3.03645>,r}
+	sphere{<0.9528,-0.194393,3.03645>,r}
+	cylinder{<0.9528,-0.194393,3.03645>,<1.18996,-0.570446,3.41923>,r}
+	sphere{<1.18996,-0.570446,3.41923>,r}
+	cylinder{<1.18996,-0.570446,3.41923>,<0.979224,-0.722762,3.6807>,r}
+	sphere{<0.979224,-0.722762,3.6807>,r}
+	cylinder{<0.979224,-0.722762,3.6807>,<0.790972,-0.695725,3.71256>,r}
+	sphere{<0.790972,-0.695725,3.71256>,r}
+	cylinder{<0.790972,-0.695725,3.71256>,<0.390346,-0.262469,3.31575>,r}
+	sphere{<0.390346,-0.262469,3.31575>,r}
+	cylinder{<0.390346,-0.262469,3.31575>,<0.508774,-0.141173,3.12467>,r}
+	sphere{<0.508774,-0.141173,3.12467>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.37249,0.393,3.69442>,<1.30865,0.079253,4.17887>,<0.952171,0.0839524,4.39922>}
+	triangle{<1.37249,0.393,3.69442>,<0.952171,0.0839524,4.39922>,<0.855745,0.138657,4.38324>}
+	triangle{<1.37249,0.393,3.69442>,<0.855745,0.138657,4.38324>,<0.64463,0.687293,3.74163>}
+	triangle{<1.37249,0.393,3.69442>,<0.64463,0.687293,3.74163>,<0.784999,0.760697,3.54842>}
+	texture{t1}
+}
+union{
+	cylinder{<1.37249,0.393,3.69442>,<1.30865,0.079253,4.17887>,r}
+	sphere{<1.30865,0.079253,4.17887>,r}
+	cylinder{<1.30865,0.079253,4.17887>,<0.952171,0.0839524,4.39922>,r}
+	sphere{<0.952171,0.0839524,4.39922>,r}
+	cylinder{<0.952171,0.0839524,4.39922>,<0.855745,0.138657,4.38324>,r}
+	sphere{<0.855745,0.138657,4.38324>,r}
+	cylinder{<0.855745,0.138657,4.38324>,<0.64463,0.687293,3.74163>,r}
+	sphere{<0.64463,0.687293,3.74163>,r}
+	cylinder{<0.64463,0.687293,3.74163>,<0.784999,0.760697,3.54842>,r}
+	sphere{<0.784999,0.760697,3.54842>,r}
+	cylinder{<0.784999,0.760697,3.54842>,<1.37249,0.393,3.69442>,r}
+	sphere{<1.37249,0.393,3.69442>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.10441,-1.80555,3.98163>,<1.06006,-1.85916,4.2894>,<1.09022,-1.80433,4.41837>}
+	triangle{<1.10441,-1.80555,3.98163>,<1.09022,-1.80433,4.41837>,<1.49081,-1.16611,4.47463>}
+	triangle{<1.10441,-1.80555,3.98163>,<1.49081,-1.16611,4.47463>,<1.51267,-1.13668,4.37853>}
+	triangle{<1.10441,-1.80555,3.98163>,<1.51267,-1.13668,4.37853>,<1.31742,-1.47516,3.84638>}
+	texture{t1}
+}
+union{
+	cylinder{<1.10441,-1.80555,3.98163>,<1.06006,-1.85916,4.2894>,r}
+	sphere{<1.06006,-1.85916,4.2894>,r}
+	cylinder{<1.06006,-1.85916,4.2894>,<1.09022,-1.80433,4.41837>,r}
+	sphere{<1.09022,-1.80433,4.41837>,r}
+	cylinder{<1.09022,-1.80433,4.41837>,<1.49081,-1.16611,4.47463>,r}
+	sphere{<1.49081,-1.16611,4.47463>,r}
+	cylinder{<1.49081,-1.16611,4.47463>,<1.51267,-1.13668,4.37853>,r}
+	sphere{<1.51267,-1.13668,4.37853>,r}
+	cylinder{<1.51267,-1.13668,4.37853>,<1.31742,-1.47516,3.84638>,r}
+	sphere{<1.31742,-1.47516,3.84638>,r}
+	cylinder{<1.31742,-1.47516,3.84638>,<1.10441,-1.80555,3.98163>,r}
+	sphere{<1.10441,-1.80555,3.98163>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.1632,-0.734237,2.43179>,<2.04999,-0.636588,2.49358>,<1.89822,-0.784519,3.15454>}
+	triangle{<2.1632,-0.734237,2.43179>,<1.89822,-0.784519,3.15454>,<2.11527,-1.09731,3.29646>}
+	triangle{<2.1632,-0.734237,2.43179>,<2.11527,-1.09731,3.29646>,<2.46388,-1.32328,2.9513>}
+	triangle{<2.1632,-0.734237,2.43179>,<2.46388,-1.32328,2.9513>,<2.501,-1.28776,2.79101>}
+	texture{t1}
+}
+union{
+	cylinder{<2.1632,-0.734237,2.43179>,<2.04999,-0.636588,2.49358>,r}
+	sphere{<2.04999,-0.636588,2.49358>,r}
+	cylinder{<2.04999,-0.636588,2.49358>,<1.89822,-0.784519,3.15454>,r}
+	sphere{<1.89822,-0.784519,3.15454>,r}
+	cylinder{<1.89822,-0.784519,3.15454>,<2.11527,-1.09731,3.29646>,r}
+	sphere{<2.11527,-1.09731,3.29646>,r}
+	cylinder{<2.11527,-1.09731,3.29646>,<2.46388,-1.32328,2.9513>,r}
+	sphere{<2.46388,-1.32328,2.9513>,r}
+	cylinder{<2.46388,-1.32328,2.9513>,<2.501,-1.28776,2.79101>,r}
+	sphere{<2.501,-1.28776,2.79101>,r}
+	cylinder{<2.501,-1.28776,2.79101>,<2.1632,-0.734237,2.43179>,r}
+	sphere{<2.1632,-0.734237,2.43179>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.12546,-2.03883,3.70893>,<1.8043,-1.74576,3.45923>,<1.78067,-1.64091,3.48499>}
+	triangle{<2.12546,-2.03883,3.70893>,<1.78067,-1.64091,3.48499>,<2.12317,-1.21029,4.14503>}
+	triangle{<2.12546,-2.03883,3.70893>,<2.12317,-1.21029,4.14503>,<2.18173,-1.24573,4.2001>}
+	triangle{<2.12546,-2.03883,3.70893>,<2.18173,-1.24573,4.2001>,<2.44824,-1.8329,4.22507>}
+	texture{t1}
+}
+union{
+	cylinder{<2.12546,-2.03883,3.70893>,<1.8043,-1.74576,3.45923>,r}
+	sphere{<1.8043,-1.74576,3.45923>,r}
+	cylinder{<1.8043,-1.74576,3.45923>,<1.78067,-1.64091,3.48499>,r}
+	sphere{<1.78067,-1.64091,3.48499>,r}
+	cylinder{<1.78067,-1.64091,3.48499>,<2.12317,-1.21029,4.14503>,r}
+	sphere{<2.12317,-1.21029,4.14503>,r}
+	cylinder{<2.12317,-1.21029,4.14503>,<2.18173,-1.24573,4.2001>,r}
+	sphere{<2.18173,-1.24573,4.2001>,r}
+	cylinder{<2.18173,-1.24573,4.2001>,<2.44824,-1.8329,4.22507>,r}
+	sphere{<2.44824,-1.8329,4.22507>,r}
+	cylinder{<2.44824,-1.8329,4.22507>,<2.12546,-2.03883,3.70893>,r}
+	sphere{<2.12546,-2.03883,3.70893>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.91799,-1.06566,4.43356>,<1.91565,-1.06444,4.42693>,<1.89199,-0.492525,4.09978>}
+	triangle{<1.91799,-1.06566,4.43356>,<1.89199,-0.492525,4.09978>,<2.08445,-0.154057,4.44271>}
+	triangle{<1.91799,-1.06566,4.43356>,<2.08445,-0.154057,4.44271>,<2.13265,-0.208876,4.59343>}
+	triangle{<1.91799,-1.06566,4.43356>,<2.13265,-0.208876,4.59343>,<2.07269,-0.837408,4.72956>}
+	texture{t1}
+}
+union{
+	cylinder{<1.91799,-1.06566,4.43356>,<1.91565,-1.06444,4.42693>,r}
+	sphere{<1.91565,-1.06444,4.42693>,r}
+	cylinder{<1.91565,-1.06444,4.42693>,<1.89199,-0.492525,4.09978>,r}
+	sphere{<1.89199,-0.492525,4.09978>,r}
+	cylinder{<1.89199,-0.492525,4.09978>,<2.08445,-0.154057,4.44271>,r}
+	sphere{<2.08445,-0.154057,4.44271>,r}
+	cylinder{<2.08445,-0.154057,4.44271>,<2.13265,-0.208876,4.59343>,r}
+	sphere{<2.13265,-0.208876,4.59343>,r}
+	cylinder{<2.13265,-0.208876,4.59343>,<2.07269,-0.837408,4.72956>,r}
+	sphere{<2.07269,-0.837408,4.72956>,r}
+	cylinder{<2.07269,-0.837408,4.72956>,<1.91799,-1.06566,4.43356>,r}
+	sphere{<1.91799,-1.06566,4.43356>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.21438,0.182597,2.95866>,<-2.14464,0.228822,3.65798>,<-2.03052,0.0747705,3.76167>}
+	triangle{<-2.21438,0.182597,2.95866>,<-2.03052,0.0747705,3.76167>,<-1.85169,-0.227303,3.64931>}
+	triangle{<-2.21438,0.182597,2.95866>,<-1.85169,-0.227303,3.64931>,<-1.85025,-0.330827,3.19041>}
+	triangle{<-2.21438,0.182597,2.95866>,<-1.85025,-0.330827,3.19041>,<-2.01779,-0.136726,2.89295>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.21438,0.182597,2.95866>,<-2.14464,0.228822,3.65798>,r}
+	sphere{<-2.14464,0.228822,3.65798>,r}
+	cylinder{<-2.14464,0.228822,3.65798>,<-2.03052,0.0747705,3.76167>,r}
+	sphere{<-2.03052,0.0747705,3.76167>,r}
+	cylinder{<-2.03052,0.0747705,3.76167>,<-1.85169,-0.227303,3.64931>,r}
+	sphere{<-1.85169,-0.227303,3.64931>,r}
+	cylinder{<-1.85169,-0.227303,3.64931>,<-1.85025,-0.330827,3.19041>,r}
+	sphere{<-1.85025,-0.330827,3.19041>,r}
+	cylinder{<-1.85025,-0.330827,3.19041>,<-2.01779,-0.136726,2.89295>,r}
+	sphere{<-2.01779,-0.136726,2.89295>,r}
+	cylinder{<-2.01779,-0.136726,2.89295>,<-2.21438,0.182597,2.95866>,r}
+	sphere{<-2.21438,0.182597,2.95866>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.21438,0.182597,2.95866>,<-2.13337,0.387226,2.79293>,<-2.0023,0.673521,2.81521>}
+	triangle{<-2.21438,0.182597,2.95866>,<-2.0023,0.673521,2.81521>,<-1.87915,0.888319,3.18717>}
+	triangle{<-2.21438,0.182597,2.95866>,<-1.87915,0.888319,3.18717>,<-1.96984,0.588261,3.83254>}
+	triangle{<-2.21438,0.182597,2.95866>,<-1.96984,0.588261,3.83254>,<-2.14464,0.228822,3.65798>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.21438,0.182597,2.95866>,<-2.13337,0.387226,2.79293>,r}
+	sphere{<-2.13337,0.387226,2.79293>,r}
+	cylinder{<-2.13337,0.387226,2.79293>,<-2.0023,0.673521,2.81521>,r}
+	sphere{<-2.0023,0.673521,2.81521>,r}
+	cylinder{<-2.0023,0.673521,2.81521>,<-1.87915,0.888319,3.18717>,r}
+	sphere{<-1.87915,0.888319,3.18717>,r}
+	cylinder{<-1.87915,0.888319,3.18717>,<-1.96984,0.588261,3.83254>,r}
+	sphere{<-1.96984,0.588261,3.83254>,r}
+	cylinder{<-1.96984,0.588261,3.83254>,<-2.14464,0.228822,3.65798>,r}
+	sphere{<-2.14464,0.228822,3.65798>,r}
+	cylinder{<-2.14464,0.228822,3.65798>,<-2.21438,0.182597,2.95866>,r}
+	sphere{<-2.21438,0.182597,2.95866>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.88922,1.47328,4.33958>,<-1.46745,1.43947,4.33472>,<-1.51901,0.639448,3.96565>}
+	triangle{<-1.88922,1.47328,4.33958>,<-1.51901,0.639448,3.96565>,<-1.83098,0.572105,3.9268>}
+	triangle{<-1.88922,1.47328,4.33958>,<-1.83098,0.572105,3.9268>,<-1.87348,0.566068,3.92295>}
+	triangle{<-1.88922,1.47328,4.33958>,<-1.87348,0.566068,3.92295>,<-2.34038,0.999216,4.11025>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.88922,1.47328,4.33958>,<-1.46745,1.43947,4.33472>,r}
+	sphere{<-1.46745,1.43947,4.33472>,r}
+	cylinder{<-1.46745,1.43947,4.33472>,<-1.51901,0.639448,3.96565>,r}
+	sphere{<-1.51901,0.639448,3.96565>,r}
+	cylinder{<-1.51901,0.639448,3.96565>,<-1.83098,0.572105,3.9268>,r}
+	sphere{<-1.83098,0.572105,3.9268>,r}
+	cylinder{<-1.83098,0.572105,3.9268>,<-1.87348,0.566068,3.92295>,r}
+	sphere{<-1.87348,0.566068,3.92295>,r}
+	cylinder{<-1.87348,0.566068,3.92295>,<-2.34038,0.999216,4.11025>,r}
+	sphere{<-2.34038,0.999216,4.11025>,r}
+	cylinder{<-2.34038,0.999216,4.11025>,<-1.88922,1.47328,4.33958>,r}
+	sphere{<-1.88922,1.47328,4.33958>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.98001,1.98725,3.65665>,<-1.45408,1.91937,3.61117>,<-1.30755,1.83203,3.8769>}
+	triangle{<-1.98001,1.98725,3.65665>,<-1.30755,1.83203,3.8769>,<-1.45734,1.79174,4.13248>}
+	triangle{<-1.98001,1.98725,3.65665>,<-1.45734,1.79174,4.13248>,<-1.81899,1.84906,4.12043>}
+	triangle{<-1.98001,1.98725,3.65665>,<-1.81899,1.84906,4.12043>,<-2.01734,1.97248,3.73958>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.98001,1.98725,3.65665>,<-1.45408,1.91937,3.61117>,r}
+	sphere{<-1.45408,1.91937,3.61117>,r}
+	cylinder{<-1.45408,1.91937,3.61117>,<-1.30755,1.83203,3.8769>,r}
+	sphere{<-1.30755,1.83203,3.8769>,r}
+	cylinder{<-1.30755,1.83203,3.8769>,<-1.45734,1.79174,4.13248>,r}
+	sphere{<-1.45734,1.79174,4.13248>,r}
+	cylinder{<-1.45734,1.79174,4.13248>,<-1.81899,1.84906,4.12043>,r}
+	sphere{<-1.81899,1.84906,4.12043>,r}
+	cylinder{<-1.81899,1.84906,4.12043>,<-2.01734,1.97248,3.73958>,r}
+	sphere{<-2.01734,1.97248,3.73958>,r}
+	cylinder{<-2.01734,1.97248,3.73958>,<-1.98001,1.98725,3.65665>,r}
+	sphere{<-1.98001,1.98725,3.65665>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.17671,0.896685,3.45893>,<-1.50553,0.628435,3.93333>,<-1.51901,0.639448,3.96565>}
+	triangle{<-1.17671,0.896685,3.45893>,<-1.51901,0.639448,3.96565>,<-1.46745,1.43947,4.33472>}
+	triangle{<-1.17671,0.896685,3.45893>,<-1.46745,1.43947,4.33472>,<-1.38087,1.57878,4.25>}
+	triangle{<-1.17671,0.896685,3.45893>,<-1.38087,1.57878,4.25>,<-1.20813,1.63116,3.94897>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.17671,0.896685,3.45893>,<-1.50553,0.628435,3.93333>,r}
+	sphere{<-1.50553,0.628435,3.93333>,r}
+	cylinder{<-1.50553,0.628435,3.93333>,<-1.51901,0.639448,3.96565>,r}
+	sphere{<-1.51901,0.639448,3.96565>,r}
+	cylinder{<-1.51901,0.639448,3.96565>,<-1.46745,1.43947,4.33472>,r}
+	sphere{<-1.46745,1.43947,4.33472>,r}
+	cylinder{<-1.46745,1.43947,4.33472>,<-1.38087,1.57878,4.25>,r}
+	sphere{<-1.38087,1.57878,4.25>,r}
+	cylinder{<-1.38087,1.57878,4.25>,<-1.20813,1.63116,3.94897>,r}
+	sphere{<-1.20813,1.63116,3.94897>,r}
+	cylinder{<-1.20813,1.63116,3.94897>,<-1.17671,0.896685,3.45893>,r}
+	sphere{<-1.17671,0.896685,3.45893>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.87125,0.562152,3.92495>,<-1.98287,0.261776,4.60447>,<-2.43496,0.566177,4.96655>}
+	triangle{<-1.87125,0.562152,3.92495>,<-2.43496,0.566177,4.96655>,<-2.53052,1.00055,4.4616>}
+	triangle{<-1.87125,0.562152,3.92495>,<-2.53052,1.00055,4.4616>,<-2.34038,0.999216,4.11025>}
+	triangle{<-1.87125,0.562152,3.92495>,<-2.34038,0.999216,4.11025>,<-1.87348,0.566068,3.92295>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.87125,0.562152,3.92495>,<-1.98287,0.261776,4.60447>,r}
+	sphere{<-1.98287,0.261776,4.60447>,r}
+	cylinder{<-1.98287,0.261776,4.60447>,<-2.43496,0.566177,4.96655>,r}
+	sphere{<-2.43496,0.566177,4.96655>,r}
+	cylinder{<-2.43496,0.566177,4.96655>,<-2.53052,1.00055,4.4616>,r}
+	sphere{<-2.53052,1.00055,4.4616>,r}
+	cylinder{<-2.53052,1.00055,4.4616>,<-2.34038,0.999216,4.11025>,r}
+	sphere{<-2.34038,0.999216,4.11025>,r}
+	cylinder{<-2.34038,0.999216,4.11025>,<-1.87348,0.566068,3.92295>,r}
+	sphere{<-1.87348,0.566068,3.92295>,r}
+	cylinder{<-1.87348,0.566068,3.92295>,<-1.87125,0.562152,3.92495>,r}
+	sphere{<-1.87125,0.562152,3.92495>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.574484,0.400128,4.43993>,<-0.354914,0.711217,3.88805>,<-0.0655666,0.206774,3.56236>}
+	triangle{<-0.574484,0.400128,4.43993>,<-0.0655666,0.206774,3.56236>,<-0.0557612,0.040329,3.61692>}
+	triangle{<-0.574484,0.400128,4.43993>,<-0.0557612,0.040329,3.61692>,<-0.245525,-0.12541,4.0486>}
+	triangle{<-0.574484,0.400128,4.43993>,<-0.245525,-0.12541,4.0486>,<-0.574113,0.397353,4.44045>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.574484,0.400128,4.43993>,<-0.354914,0.711217,3.88805>,r}
+	sphere{<-0.354914,0.711217,3.88805>,r}
+	cylinder{<-0.354914,0.711217,3.88805>,<-0.0655666,0.206774,3.56236>,r}
+	sphere{<-0.0655666,0.206774,3.56236>,r}
+	cylinder{<-0.0655666,0.206774,3.56236>,<-0.0557612,0.040329,3.61692>,r}
+	sphere{<-0.0557612,0.040329,3.61692>,r}
+	cylinder{<-0.0557612,0.040329,3.61692>,<-0.245525,-0.12541,4.0486>,r}
+	sphere{<-0.245525,-0.12541,4.0486>,r}
+	cylinder{<-0.245525,-0.12541,4.0486>,<-0.574113,0.397353,4.44045>,r}
+	sphere{<-0.574113,0.397353,4.44045>,r}
+	cylinder{<-0.574113,0.397353,4.44045>,<-0.574484,0.400128,4.43993>,r}
+	sphere{<-0.574484,0.400128,4.43993>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.574484,0.400128,4.43993>,<-0.985881,0.356372,4.33876>,<-1.30272,0.502848,3.88146>}
+	triangle{<-0.574484,0.400128,4.43993>,<-1.30272,0.502848,3.88146>,<-1.05671,0.741025,3.49553>}
+	triangle{<-0.574484,0.400128,4.43993>,<-1.05671,0.741025,3.49553>,<-0.664265,0.823417,3.50643>}
+	triangle{<-0.574484,0.400128,4.43993>,<-0.664265,0.823417,3.50643>,<-0.354914,0.711217,3.88805>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.574484,0.400128,4.43993>,<-0.985881,0.356372,4.33876>,r}
+	sphere{<-0.985881,0.356372,4.33876>,r}
+	cylinder{<-0.985881,0.356372,4.33876>,<-1.30272,0.502848,3.88146>,r}
+	sphere{<-1.30272,0.502848,3.88146>,r}
+	cylinder{<-1.30272,0.502848,3.88146>,<-1.05671,0.741025,3.49553>,r}
+	sphere{<-1.05671,0.741025,3.49553>,r}
+	cylinder{<-1.05671,0.741025,3.49553>,<-0.664265,0.823417,3.50643>,r}
+	sphere{<-0.664265,0.823417,3.50643>,r}
+	cylinder{<-0.664265,0.823417,3.50643>,<-0.354914,0.711217,3.88805>,r}
+	sphere{<-0.354914,0.711217,3.88805>,r}
+	cylinder{<-0.354914,0.711217,3.88805>,<-0.574484,0.400128,4.43993>,r}
+	sphere{<-0.574484,0.400128,4.43993>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.574113,0.397353,4.44045>,<-0.245525,-0.12541,4.0486>,<-0.580491,-0.5226,3.90099>}
+	triangle{<-0.574113,0.397353,4.44045>,<-0.580491,-0.5226,3.90099>,<-0.836757,-0.504807,3.97726>}
+	triangle{<-0.574113,0.397353,4.44045>,<-0.836757,-0.504807,3.97726>,<-0.98499,-0.419241,4.06565>}
+	triangle{<-0.574113,0.397353,4.44045>,<-0.98499,-0.419241,4.06565>,<-0.912189,0.160091,4.38771>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.574113,0.397353,4.44045>,<-0.245525,-0.12541,4.0486>,r}
+	sphere{<-0.245525,-0.12541,4.0486>,r}
+	cylinder{<-0.245525,-0.12541,4.0486>,<-0.580491,-0.5226,3.90099>,r}
+	sphere{<-0.580491,-0.5226,3.90099>,r}
+	cylinder{<-0.580491,-0.5226,3.90099>,<-0.836757,-0.504807,3.97726>,r}
+	sphere{<-0.836757,-0.504807,3.97726>,r}
+	cylinder{<-0.836757,-0.504807,3.97726>,<-0.98499,-0.419241,4.06565>,r}
+	sphere{<-0.98499,-0.419241,4.06565>,r}
+	cylinder{<-0.98499,-0.419241,4.06565>,<-0.912189,0.160091,4.38771>,r}
+	sphere{<-0.912189,0.160091,4.38771>,r}
+	cylinder{<-0.912189,0.160091,4.38771>,<-0.574113,0.397353,4.44045>,r}
+	sphere{<-0.574113,0.397353,4.44045>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.369772,0.734323,4.73462>,<-0.305498,0.833881,4.72874>,<-0.160131,1.02821,4.15021>}
+	triangle{<-0.369772,0.734323,4.73462>,<-0.160131,1.02821,4.15021>,<-0.179314,0.991529,4.02433>}
+	triangle{<-0.369772,0.734323,4.73462>,<-0.179314,0.991529,4.02433>,<-0.354914,0.711217,3.88805>}
+	triangle{<-0.369772,0.734323,4.73462>,<-0.354914,0.711217,3.88805>,<-0.574484,0.400128,4.43993>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.369772,0.734323,4.73462>,<-0.305498,0.833881,4.72874>,r}
+	sphere{<-0.305498,0.833881,4.72874>,r}
+	cylinder{<-0.305498,0.833881,4.72874>,<-0.160131,1.02821,4.15021>,r}
+	sphere{<-0.160131,1.02821,4.15021>,r}
+	cylinder{<-0.160131,1.02821,4.15021>,<-0.179314,0.991529,4.02433>,r}
+	sphere{<-0.179314,0.991529,4.02433>,r}
+	cylinder{<-0.179314,0.991529,4.02433>,<-0.354914,0.711217,3.88805>,r}
+	sphere{<-0.354914,0.711217,3.88805>,r}
+	cylinder{<-0.354914,0.711217,3.88805>,<-0.574484,0.400128,4.43993>,r}
+	sphere{<-0.574484,0.400128,4.43993>,r}
+	cylinder{<-0.574484,0.400128,4.43993>,<-0.369772,0.734323,4.73462>,r}
+	sphere{<-0.369772,0.734323,4.73462>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.369772,0.734323,4.73462>,<-0.574484,0.400128,4.43993>,<-0.985881,0.356372,4.33876>}
+	triangle{<-0.369772,0.734323,4.73462>,<-0.985881,0.356372,4.33876>,<-1.25603,0.525431,4.42703>}
+	triangle{<-0.369772,0.734323,4.73462>,<-1.25603,0.525431,4.42703>,<-1.16699,0.874638,4.71464>}
+	triangle{<-0.369772,0.734323,4.73462>,<-1.16699,0.874638,4.71464>,<-0.428647,0.794102,4.7718>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.369772,0.734323,4.73462>,<-0.574484,0.400128,4.43993>,r}
+	sphere{<-0.574484,0.400128,4.43993>,r}
+	cylinder{<-0.574484,0.400128,4.43993>,<-0.985881,0.356372,4.33876>,r}
+	sphere{<-0.985881,0.356372,4.33876>,r}
+	cylinder{<-0.985881,0.356372,4.33876>,<-1.25603,0.525431,4.42703>,r}
+	sphere{<-1.25603,0.525431,4.42703>,r}
+	cylinder{<-1.25603,0.525431,4.42703>,<-1.16699,0.874638,4.71464>,r}
+	sphere{<-1.16699,0.874638,4.71464>,r}
+	cylinder{<-1.16699,0.874638,4.71464>,<-0.428647,0.794102,4.7718>,r}
+	sphere{<-0.428647,0.794102,4.7718>,r}
+	cylinder{<-0.428647,0.794102,4.7718>,<-0.369772,0.734323,4.73462>,r}
+	sphere{<-0.369772,0.734323,4.73462>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.338828,1.30031,4.61443>,<-0.325713,1.39682,4.52407>,<-0.317933,1.40281,4.49524>}
+	triangle{<-0.338828,1.30031,4.61443>,<-0.317933,1.40281,4.49524>,<-0.160131,1.02821,4.15021>}
+	triangle{<-0.338828,1.30031,4.61443>,<-0.160131,1.02821,4.15021>,<-0.305498,0.833881,4.72874>}
+	triangle{<-0.338828,1.30031,4.61443>,<-0.305498,0.833881,4.72874>,<-0.31878,0.889703,4.74604>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.338828,1.30031,4.61443>,<-0.325713,1.39682,4.52407>,r}
+	sphere{<-0.325713,1.39682,4.52407>,r}
+	cylinder{<-0.325713,1.39682,4.52407>,<-0.317933,1.40281,4.49524>,r}
+	sphere{<-0.317933,1.40281,4.49524>,r}
+	cylinder{<-0.317933,1.40281,4.49524>,<-0.160131,1.02821,4.15021>,r}
+	sphere{<-0.160131,1.02821,4.15021>,r}
+	cylinder{<-0.160131,1.02821,4.15021>,<-0.305498,0.833881,4.72874>,r}
+	sphere{<-0.305498,0.833881,4.72874>,r}
+	cylinder{<-0.305498,0.833881,4.72874>,<-0.31878,0.889703,4.74604>,r}
+	sphere{<-0.31878,0.889703,4.74604>,r}
+	cylinder{<-0.31878,0.889703,4.74604>,<-0.338828,1.30031,4.61443>,r}
+	sphere{<-0.338828,1.30031,4.61443>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.120234,0.581941,2.66785>,<-0.347068,1.26686,2.89394>,<-0.370292,1.27943,2.92926>}
+	triangle{<-0.120234,0.581941,2.66785>,<-0.370292,1.27943,2.92926>,<-0.66351,0.918845,3.48501>}
+	triangle{<-0.120234,0.581941,2.66785>,<-0.66351,0.918845,3.48501>,<-0.664265,0.823417,3.50643>}
+	triangle{<-0.120234,0.581941,2.66785>,<-0.664265,0.823417,3.50643>,<-0.437823,0.412014,3.22314>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.120234,0.581941,2.66785>,<-0.347068,1.26686,2.89394>,r}
+	sphere{<-0.347068,1.26686,2.89394>,r}
+	cylinder{<-0.347068,1.26686,2.89394>,<-0.370292,1.27943,2.92926>,r}
+	sphere{<-0.370292,1.27943,2.92926>,r}
+	cylinder{<-0.370292,1.27943,2.92926>,<-0.66351,0.918845,3.48501>,r}
+	sphere{<-0.66351,0.918845,3.48501>,r}
+	cylinder{<-0.66351,0.918845,3.48501>,<-0.664265,0.823417,3.50643>,r}
+	sphere{<-0.664265,0.823417,3.50643>,r}
+	cylinder{<-0.664265,0.823417,3.50643>,<-0.437823,0.412014,3.22314>,r}
+	sphere{<-0.437823,0.412014,3.22314>,r}
+	cylinder{<-0.437823,0.412014,3.22314>,<-0.120234,0.581941,2.66785>,r}
+	sphere{<-0.120234,0.581941,2.66785>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.51434,1.22037,3.73049>,<1.62039,1.42027,3.53227>,<1.82913,1.4015,3.32632>}
+	triangle{<1.51434,1.22037,3.73049>,<1.82913,1.4015,3.32632>,<2.13559,0.959378,3.20919>}
+	triangle{<1.51434,1.22037,3.73049>,<2.13559,0.959378,3.20919>,<2.03132,0.582433,3.4847>}
+	triangle{<1.51434,1.22037,3.73049>,<2.03132,0.582433,3.4847>,<1.71027,0.662039,3.77879>}
+	texture{t1}
+}
+union{
+	cylinder{<1.51434,1.22037,3.73049>,<1.62039,1.42027,3.53227>,r}
+	sphere{<1.62039,1.42027,3.53227>,r}
+	cylinder{<1.62039,1.42027,3.53227>,<1.82913,1.4015,3.32632>,r}
+	sphere{<1.82913,1.4015,3.32632>,r}
+	cylinder{<1.82913,1.4015,3.32632>,<2.13559,0.959378,3.20919>,r}
+	sphere{<2.13559,0.959378,3.20919>,r}
+	cylinder{<2.13559,0.959378,3.20919>,<2.03132,0.582433,3.4847>,r}
+	sphere{<2.03132,0.582433,3.4847>,r}
+	cylinder{<2.03132,0.582433,3.4847>,<1.71027,0.662039,3.77879>,r}
+	sphere{<1.71027,0.662039,3.77879>,r}
+	cylinder{<1.71027,0.662039,3.77879>,<1.51434,1.22037,3.73049>,r}
+	sphere{<1.51434,1.22037,3.73049>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.08748,0.938608,2.83252>,<1.8037,1.40462,3.18901>,<1.39115,1.44414,3.12341>}
+	triangle{<2.08748,0.938608,2.83252>,<1.39115,1.44414,3.12341>,<1.19513,0.906764,2.58324>}
+	triangle{<2.08748,0.938608,2.83252>,<1.19513,0.906764,2.58324>,<1.22576,0.875701,2.56236>}
+	triangle{<2.08748,0.938608,2.83252>,<1.22576,0.875701,2.56236>,<1.96956,0.81704,2.69217>}
+	texture{t1}
+}
+union{
+	cylinder{<2.08748,0.938608,2.83252>,<1.8037,1.40462,3.18901>,r}
+	sphere{<1.8037,1.40462,3.18901>,r}
+	cylinder{<1.8037,1.40462,3.18901>,<1.39115,1.44414,3.12341>,r}
+	sphere{<1.39115,1.44414,3.12341>,r}
+	cylinder{<1.39115,1.44414,3.12341>,<1.19513,0.906764,2.58324>,r}
+	sphere{<1.19513,0.906764,2.58324>,r}
+	cylinder{<1.19513,0.906764,2.58324>,<1.22576,0.875701,2.56236>,r}
+	sphere{<1.22576,0.875701,2.56236>,r}
+	cylinder{<1.22576,0.875701,2.56236>,<1.96956,0.81704,2.69217>,r}
+	sphere{<1.96956,0.81704,2.69217>,r}
+	cylinder{<1.96956,0.81704,2.69217>,<2.08748,0.938608,2.83252>,r}
+	sphere{<2.08748,0.938608,2.83252>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.564916,0.901911,3.87443>,<0.58713,0.961652,3.84818>,<1.07693,1.35951,4.40402>}
+	triangle{<0.564916,0.901911,3.87443>,<1.07693,1.35951,4.40402>,<1.12517,1.24694,4.64602>}
+	triangle{<0.564916,0.901911,3.87443>,<1.12517,1.24694,4.64602>,<0.936083,0.819302,4.76962>}
+	triangle{<0.564916,0.901911,3.87443>,<0.936083,0.819302,4.76962>,<0.688855,0.585369,4.52993>}
+	texture{t1}
+}
+union{
+	cylinder{<0.564916,0.901911,3.87443>,<0.58713,0.961652,3.84818>,r}
+	sphere{<0.58713,0.961652,3.84818>,r}
+	cylinder{<0.58713,0.961652,3.84818>,<1.07693,1.35951,4.40402>,r}
+	sphere{<1.07693,1.35951,4.40402>,r}
+	cylinder{<1.07693,1.35951,4.40402>,<1.12517,1.24694,4.64602>,r}
+	sphere{<1.12517,1.24694,4.64602>,r}
+	cylinder{<1.12517,1.24694,4.64602>,<0.936083,0.819302,4.76962>,r}
+	sphere{<0.936083,0.819302,4.76962>,r}
+	cylinder{<0.936083,0.819302,4.76962>,<0.688855,0.585369,4.52993>,r}
+	sphere{<0.688855,0.585369,4.52993>,r}
+	cylinder{<0.688855,0.585369,4.52993>,<0.564916,0.901911,3.87443>,r}
+	sphere{<0.564916,0.901911,3.87443>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.827094,0.217453,4.51437>,<0.688855,0.585369,4.52993>,<0.936083,0.819302,4.76962>}
+	triangle{<0.827094,0.217453,4.51437>,<0.936083,0.819302,4.76962>,<1.22669,0.354611,4.82952>}
+	triangle{<0.827094,0.217453,4.51437>,<1.22669,0.354611,4.82952>,<1.19387,0.249461,4.77548>}
+	triangle{<0.827094,0.217453,4.51437>,<1.19387,0.249461,4.77548>,<0.986893,0.15665,4.60571>}
+	texture{t1}
+}
+union{
+	cylinder{<0.827094,0.217453,4.51437>,<0.688855,0.585369,4.52993>,r}
+	sphere{<0.688855,0.585369,4.52993>,r}
+	cylinder{<0.688855,0.585369,4.52993>,<0.936083,0.819302,4.76962>,r}
+	sphere{<0.936083,0.819302,4.76962>,r}
+	cylinder{<0.936083,0.819302,4.76962>,<1.22669,0.354611,4.82952>,r}
+	sphere{<1.22669,0.354611,4.82952>,r}
+	cylinder{<1.22669,0.354611,4.82952>,<1.19387,0.249461,4.77548>,r}
+	sphere{<1.19387,0.249461,4.77548>,r}
+	cylinder{<1.19387,0.249461,4.77548>,<0.986893,0.15665,4.60571>,r}
+	sphere{<0.986893,0.15665,4.60571>,r}
+	cylinder{<0.986893,0.15665,4.60571>,<0.827094,0.217453,4.51437>,r}
+	sphere{<0.827094,0.217453,4.51437>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.90271,0.578303,4.27799>,<1.73397,0.277774,4.55204>,<1.70096,0.322539,4.71059>}
+	triangle{<1.90271,0.578303,4.27799>,<1.70096,0.322539,4.71059>,<1.71027,0.391698,4.74873>}
+	triangle{<1.90271,0.578303,4.27799>,<1.71027,0.391698,4.74873>,<1.89902,0.892433,4.60889>}
+	triangle{<1.90271,0.578303,4.27799>,<1.89902,0.892433,4.60889>,<1.90472,0.895724,4.59268>}
+	texture{t1}
+}
+union{
+	cylinder{<1.90271,0.578303,4.27799>,<1.73397,0.277774,4.55204>,r}
+	sphere{<1.73397,0.277774,4.55204>,r}
+	cylinder{<1.73397,0.277774,4.55204>,<1.70096,0.322539,4.71059>,r}
+	sphere{<1.70096,0.322539,4.71059>,r}
+	cylinder{<1.70096,0.322539,4.71059>,<1.71027,0.391698,4.74873>,r}
+	sphere{<1.71027,0.391698,4.74873>,r}
+	cylinder{<1.71027,0.391698,4.74873>,<1.89902,0.892433,4.60889>,r}
+	sphere{<1.89902,0.892433,4.60889>,r}
+	cylinder{<1.89902,0.892433,4.60889>,<1.90472,0.895724,4.59268>,r}
+	sphere{<1.90472,0.895724,4.59268>,r}
+	cylinder{<1.90472,0.895724,4.59268>,<1.90271,0.578303,4.27799>,r}
+	sphere{<1.90271,0.578303,4.27799>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.19387,0.249461,4.77548>,<1.70096,0.322539,4.71059>,<1.73397,0.277774,4.55204>}
+	triangle{<1.19387,0.249461,4.77548>,<1.73397,0.277774,4.55204>,<1.30865,0.079253,4.17887>}
+	triangle{<1.19387,0.249461,4.77548>,<1.30865,0.079253,4.17887>,<0.952171,0.0839524,4.39922>}
+	triangle{<1.19387,0.249461,4.77548>,<0.952171,0.0839524,4.39922>,<0.986893,0.15665,4.60571>}
+	texture{t1}
+}
+union{
+	cylinder{<1.19387,0.249461,4.77548>,<1.70096,0.322539,4.71059>,r}
+	sphere{<1.70096,0.322539,4.71059>,r}
+	cylinder{<1.70096,0.322539,4.71059>,<1.73397,0.277774,4.55204>,r}
+	sphere{<1.73397,0.277774,4.55204>,r}
+	cylinder{<1.73397,0.277774,4.55204>,<1.30865,0.079253,4.17887>,r}
+	sphere{<1.30865,0.079253,4.17887>,r}
+	cylinder{<1.30865,0.079253,4.17887>,<0.952171,0.0839524,4.39922>,r}
+	sphere{<0.952171,0.0839524,4.39922>,r}
+	cylinder{<0.952171,0.0839524,4.39922>,<0.986893,0.15665,4.60571>,r}
+	sphere{<0.986893,0.15665,4.60571>,r}
+	cylinder{<0.986893,0.15665,4.60571>,<1.19387,0.249461,4.77548>,r}
+	sphere{<1.19387,0.249461,4.77548>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.245525,-0.12541,4.0486>,<-0.574113,0.397353,4.44045>,<-0.272193,0.353487,4.87216>}
+	triangle{<-0.245525,-0.12541,4.0486>,<-0.272193,0.353487,4.87216>,<-0.178016,0.292254,4.92057>}
+	triangle{<-0.245525,-0.12541,4.0486>,<-0.178016,0.292254,4.92057>,<-0.00291725,0.100865,4.86991>}
+	triangle{<-0.245525,-0.12541,4.0486>,<-0.00291725,0.100865,4.86991>,<0.054503,-0.251235,4.32844>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.245525,-0.12541,4.0486>,<-0.574113,0.397353,4.44045>,r}
+	sphere{<-0.574113,0.397353,4.44045>,r}
+	cylinder{<-0.574113,0.397353,4.44045>,<-0.272193,0.353487,4.87216>,r}
+	sphere{<-0.272193,0.353487,4.87216>,r}
+	cylinder{<-0.272193,0.353487,4.87216>,<-0.178016,0.292254,4.92057>,r}
+	sphere{<-0.178016,0.292254,4.92057>,r}
+	cylinder{<-0.178016,0.292254,4.92057>,<-0.00291725,0.100865,4.86991>,r}
+	sphere{<-0.00291725,0.100865,4.86991>,r}
+	cylinder{<-0.00291725,0.100865,4.86991>,<0.054503,-0.251235,4.32844>,r}
+	sphere{<0.054503,-0.251235,4.32844>,r}
+	cylinder{<0.054503,-0.251235,4.32844>,<-0.245525,-0.12541,4.0486>,r}
+	sphere{<-0.245525,-0.12541,4.0486>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.160131,1.02821,4.15021>,<0.044242,1.01877,4.01015>,<0.564916,0.901911,3.87443>}
+	triangle{<-0.160131,1.02821,4.15021>,<0.564916,0.901911,3.87443>,<0.688855,0.585369,4.52993>}
+	triangle{<-0.160131,1.02821,4.15021>,<0.688855,0.585369,4.52993>,<-0.0858316,0.716035,4.83477>}
+	triangle{<-0.160131,1.02821,4.15021>,<-0.0858316,0.716035,4.83477>,<-0.305498,0.833881,4.72874>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.160131,1.02821,4.15021>,<0.044242,1.01877,4.01015>,r}
+	sphere{<0.044242,1.01877,4.01015>,r}
+	cylinder{<0.044242,1.01877,4.01015>,<0.564916,0.901911,3.87443>,r}
+	sphere{<0.564916,0.901911,3.87443>,r}
+	cylinder{<0.564916,0.901911,3.87443>,<0.688855,0.585369,4.52993>,r}
+	sphere{<0.688855,0.585369,4.52993>,r}
+	cylinder{<0.688855,0.585369,4.52993>,<-0.0858316,0.716035,4.83477>,r}
+	sphere{<-0.0858316,0.716035,4.83477>,r}
+	cylinder{<-0.0858316,0.716035,4.83477>,<-0.305498,0.833881,4.72874>,r}
+	sphere{<-0.305498,0.833881,4.72874>,r}
+	cylinder{<-0.305498,0.833881,4.72874>,<-0.160131,1.02821,4.15021>,r}
+	sphere{<-0.160131,1.02821,4.15021>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.13559,0.959378,3.20919>,<2.03132,0.582433,3.4847>,<1.87472,0.227472,3.18861>}
+	triangle{<2.13559,0.959378,3.20919>,<1.87472,0.227472,3.18861>,<1.86885,0.307473,2.8639>}
+	triangle{<2.13559,0.959378,3.20919>,<1.86885,0.307473,2.8639>,<2.00969,0.747708,2.72338>}
+	triangle{<2.13559,0.959378,3.20919>,<2.00969,0.747708,2.72338>,<2.08836,0.937582,2.83329>}
+	texture{t1}
+}
+union{
+	cylinder{<2.13559,0.959378,3.20919>,<2.03132,0.582433,3.4847>,r}
+	sphere{<2.03132,0.582433,3.4847>,r}
+	cylinder{<2.03132,0.582433,3.4847>,<1.87472,0.227472,3.18861>,r}
+	sphere{<1.87472,0.227472,3.18861>,r}
+	cylinder{<1.87472,0.227472,3.18861>,<1.86885,0.307473,2.8639>,r}
+	sphere{<1.86885,0.307473,2.8639>,r}
+	cylinder{<1.86885,0.307473,2.8639>,<2.00969,0.747708,2.72338>,r}
+	sphere{<2.00969,0.747708,2.72338>,r}
+	cylinder{<2.00969,0.747708,2.72338>,<2.08836,0.937582,2.83329>,r}
+	sphere{<2.08836,0.937582,2.83329>,r}
+	cylinder{<2.08836,0.937582,2.83329>,<2.13559,0.959378,3.20919>,r}
+	sphere{<2.13559,0.959378,3.20919>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.03132,0.582433,3.4847>,<2.5188,0.419638,3.82432>,<2.7017,0.0723714,3.82035>}
+	triangle{<2.03132,0.582433,3.4847>,<2.7017,0.0723714,3.82035>,<2.58285,-0.127081,3.62775>}
+	triangle{<2.03132,0.582433,3.4847>,<2.58285,-0.127081,3.62775>,<2.12833,-0.121563,3.24393>}
+	triangle{<2.03132,0.582433,3.4847>,<2.12833,-0.121563,3.24393>,<1.87472,0.227472,3.18861>}
+	texture{t1}
+}
+union{
+	cylinder{<2.03132,0.582433,3.4847>,<2.5188,0.419638,3.82432>,r}
+	sphere{<2.5188,0.419638,3.82432>,r}
+	cylinder{<2.5188,0.419638,3.82432>,<2.7017,0.0723714,3.82035>,r}
+	sphere{<2.7017,0.0723714,3.82035>,r}
+	cylinder{<2.7017,0.0723714,3.82035>,<2.58285,-0.127081,3.62775>,r}
+	sphere{<2.58285,-0.127081,3.62775>,r}
+	cylinder{<2.58285,-0.127081,3.62775>,<2.12833,-0.121563,3.24393>,r}
+	sphere{<2.12833,-0.121563,3.24393>,r}
+	cylinder{<2.12833,-0.121563,3.24393>,<1.87472,0.227472,3.18861>,r}
+	sphere{<1.87472,0.227472,3.18861>,r}
+	cylinder{<1.87472,0.227472,3.18861>,<2.03132,0.582433,3.4847>,r}
+	sphere{<2.03132,0.582433,3.4847>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.93624,0.91669,4.59839>,<1.90472,0.895724,4.59268>,<1.54835,1.31319,3.92333>}
+	triangle{<1.93624,0.91669,4.59839>,<1.54835,1.31319,3.92333>,<1.69873,1.61076,3.76813>}
+	triangle{<1.93624,0.91669,4.59839>,<1.69873,1.61076,3.76813>,<1.85747,1.71452,3.79864>}
+	triangle{<1.93624,0.91669,4.59839>,<1.85747,1.71452,3.79864>,<2.34757,1.56764,4.32446>}
+	texture{t1}
+}
+union{
+	cylinder{<1.93624,0.91669,4.59839>,<1.90472,0.895724,4.59268>,r}
+	sphere{<1.90472,0.895724,4.59268>,r}
+	cylinder{<1.90472,0.895724,4.59268>,<1.54835,1.31319,3.92333>,r}
+	sphere{<1.54835,1.31319,3.92333>,r}
+	cylinder{<1.54835,1.31319,3.92333>,<1.69873,1.61076,3.76813>,r}
+	sphere{<1.69873,1.61076,3.76813>,r}
+	cylinder{<1.69873,1.61076,3.76813>,<1.85747,1.71452,3.79864>,r}
+	sphere{<1.85747,1.71452,3.79864>,r}
+	cylinder{<1.85747,1.71452,3.79864>,<2.34757,1.56764,4.32446>,r}
+	sphere{<2.34757,1.56764,4.32446>,r}
+	cylinder{<2.34757,1.56764,4.32446>,<1.93624,0.91669,4.59839>,r}
+	sphere{<1.93624,0.91669,4.59839>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.93624,0.91669,4.59839>,<3,1.07553,4.24545>,<3,0.653598,3.82588>}
+	triangle{<1.93624,0.91669,4.59839>,<3,0.653598,3.82588>,<2.5188,0.419638,3.82432>}
+	triangle{<1.93624,0.91669,4.59839>,<2.5188,0.419638,3.82432>,<1.90271,0.578303,4.27799>}
+	triangle{<1.93624,0.91669,4.59839>,<1.90271,0.578303,4.27799>,<1.90472,0.895724,4.59268>}
+	texture{t1}
+}
+union{
+	cylinder{<1.93624,0.91669,4.59839>,<3,1.07553,4.24545>,r}
+	sphere{<3,1.07553,4.24545>,r}
+	cylinder{<3,1.07553,4.24545>,<3,0.653598,3.82588>,r}
+	sphere{<3,0.653598,3.82588>,r}
+	cylinder{<3,0.653598,3.82588>,<2.5188,0.419638,3.82432>,r}
+	sphere{<2.5188,0.419638,3.82432>,r}
+	cylinder{<2.5188,0.419638,3.82432>,<1.90271,0.578303,4.27799>,r}
+	sphere{<1.90271,0.578303,4.27799>,r}
+	cylinder{<1.90271,0.578303,4.27799>,<1.90472,0.895724,4.59268>,r}
+	sphere{<1.90472,0.895724,4.59268>,r}
+	cylinder{<1.90472,0.895724,4.59268>,<1.93624,0.91669,4.59839>,r}
+	sphere{<1.93624,0.91669,4.59839>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.30755,1.83203,3.8769>,<-1.45734,1.79174,4.13248>,<-1.29451,2.42382,4.61477>}
+	triangle{<-1.30755,1.83203,3.8769>,<-1.29451,2.42382,4.61477>,<-0.824755,3,4.39448>}
+	triangle{<-1.30755,1.83203,3.8769>,<-0.824755,3,4.39448>,<-0.804798,3,4.35349>}
+	triangle{<-1.30755,1.83203,3.8769>,<-0.804798,3,4.35349>,<-1.08242,2.09384,3.75282>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.30755,1.83203,3.8769>,<-1.45734,1.79174,4.13248>,r}
+	sphere{<-1.45734,1.79174,4.13248>,r}
+	cylinder{<-1.45734,1.79174,4.13248>,<-1.29451,2.42382,4.61477>,r}
+	sphere{<-1.29451,2.42382,4.61477>,r}
+	cylinder{<-1.29451,2.42382,4.61477>,<-0.824755,3,4.39448>,r}
+	sphere{<-0.824755,3,4.39448>,r}
+	cylinder{<-0.824755,3,4.39448>,<-0.804798,3,4.35349>,r}
+	sphere{<-0.804798,3,4.35349>,r}
+	cylinder{<-0.804798,3,4.35349>,<-1.08242,2.09384,3.75282>,r}
+	sphere{<-1.08242,2.09384,3.75282>,r}
+	cylinder{<-1.08242,2.09384,3.75282>,<-1.30755,1.83203,3.8769>,r}
+	sphere{<-1.30755,1.83203,3.8769>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.43896,2.74239,4.67608>,<-2.51776,3,4.85113>,<-1.97117,3,4.93213>}
+	triangle{<-2.43896,2.74239,4.67608>,<-1.97117,3,4.93213>,<-1.29451,2.42382,4.61477>}
+	triangle{<-2.43896,2.74239,4.67608>,<-1.29451,2.42382,4.61477>,<-1.45734,1.79174,4.13248>}
+	triangle{<-2.43896,2.74239,4.67608>,<-1.45734,1.79174,4.13248>,<-1.81899,1.84906,4.12043>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.43896,2.74239,4.67608>,<-2.51776,3,4.85113>,r}
+	sphere{<-2.51776,3,4.85113>,r}
+	cylinder{<-2.51776,3,4.85113>,<-1.97117,3,4.93213>,r}
+	sphere{<-1.97117,3,4.93213>,r}
+	cylinder{<-1.97117,3,4.93213>,<-1.29451,2.42382,4.61477>,r}
+	sphere{<-1.29451,2.42382,4.61477>,r}
+	cylinder{<-1.29451,2.42382,4.61477>,<-1.45734,1.79174,4.13248>,r}
+	sphere{<-1.45734,1.79174,4.13248>,r}
+	cylinder{<-1.45734,1.79174,4.13248>,<-1.81899,1.84906,4.12043>,r}
+	sphere{<-1.81899,1.84906,4.12043>,r}
+	cylinder{<-1.81899,1.84906,4.12043>,<-2.43896,2.74239,4.67608>,r}
+	sphere{<-2.43896,2.74239,4.67608>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.01734,1.97248,3.73958>,<-2.15443,1.87965,3.62667>,<-3,1.87965,3.62676>}
+	triangle{<-2.01734,1.97248,3.73958>,<-3,1.87965,3.62676>,<-3,3,4.98947>}
+	triangle{<-2.01734,1.97248,3.73958>,<-3,3,4.98947>,<-2.72966,3,4.98944>}
+	triangle{<-2.01734,1.97248,3.73958>,<-2.72966,3,4.98944>,<-2.43896,2.74239,4.67608>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.01734,1.97248,3.73958>,<-2.15443,1.87965,3.62667>,r}
+	sphere{<-2.15443,1.87965,3.62667>,r}
+	cylinder{<-2.15443,1.87965,3.62667>,<-3,1.87965,3.62676>,r}
+	sphere{<-3,1.87965,3.62676>,r}
+	cylinder{<-3,1.87965,3.62676>,<-3,3,4.98947>,r}
+	sphere{<-3,3,4.98947>,r}
+	cylinder{<-3,3,4.98947>,<-2.72966,3,4.98944>,r}
+	sphere{<-2.72966,3,4.98944>,r}
+	cylinder{<-2.72966,3,4.98944>,<-2.43896,2.74239,4.67608>,r}
+	sphere{<-2.43896,2.74239,4.67608>,r}
+	cylinder{<-2.43896,2.74239,4.67608>,<-2.01734,1.97248,3.73958>,r}
+	sphere{<-2.01734,1.97248,3.73958>,r}
+	texture{t2}
+}
+union{
+	triangle{<-2.43896,2.74239,4.67608>,<-1.81899,1.84906,4.12043>,<-1.88922,1.47328,4.33958>}
+	triangle{<-2.43896,2.74239,4.67608>,<-1.88922,1.47328,4.33958>,<-2.10474,1.43413,4.64727>}
+	triangle{<-2.43896,2.74239,4.67608>,<-2.10474,1.43413,4.64727>,<-2.96979,3,5.31797>}
+	triangle{<-2.43896,2.74239,4.67608>,<-2.96979,3,5.31797>,<-2.72966,3,4.98944>}
+	texture{t1}
+}
+union{
+	cylinder{<-2.43896,2.74239,4.67608>,<-1.81899,1.84906,4.12043>,r}
+	sphere{<-1.81899,1.84906,4.12043>,r}
+	cylinder{<-1.81899,1.84906,4.12043>,<-1.88922,1.47328,4.33958>,r}
+	sphere{<-1.88922,1.47328,4.33958>,r}
+	cylinder{<-1.88922,1.47328,4.33958>,<-2.10474,1.43413,4.64727>,r}
+	sphere{<-2.10474,1.43413,4.64727>,r}
+	cylinder{<-2.10474,1.43413,4.64727>,<-2.96979,3,5.31797>,r}
+	sphere{<-2.96979,3,5.31797>,r}
+	cylinder{<-2.96979,3,5.31797>,<-2.72966,3,4.98944>,r}
+	sphere{<-2.72966,3,4.98944>,r}
+	cylinder{<-2.72966,3,4.98944>,<-2.43896,2.74239,4.67608>,r}
+	sphere{<-2.43896,2.74239,4.67608>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.630059,1.92292,3.78288>,<-0.395699,1.92949,3.38157>,<-0.682716,2.11364,3.03068>}
+	triangle{<-0.630059,1.92292,3.78288>,<-0.682716,2.11364,3.03068>,<-1.03503,2.21692,3.13807>}
+	triangle{<-0.630059,1.92292,3.78288>,<-1.03503,2.21692,3.13807>,<-1.19208,2.18774,3.5156>}
+	triangle{<-0.630059,1.92292,3.78288>,<-1.19208,2.18774,3.5156>,<-1.08242,2.09384,3.75282>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.630059,1.92292,3.78288>,<-0.395699,1.92949,3.38157>,r}
+	sphere{<-0.395699,1.92949,3.38157>,r}
+	cylinder{<-0.395699,1.92949,3.38157>,<-0.682716,2.11364,3.03068>,r}
+	sphere{<-0.682716,2.11364,3.03068>,r}
+	cylinder{<-0.682716,2.11364,3.03068>,<-1.03503,2.21692,3.13807>,r}
+	sphere{<-1.03503,2.21692,3.13807>,r}
+	cylinder{<-1.03503,2.21692,3.13807>,<-1.19208,2.18774,3.5156>,r}
+	sphere{<-1.19208,2.18774,3.5156>,r}
+	cylinder{<-1.19208,2.18774,3.5156>,<-1.08242,2.09384,3.75282>,r}
+	sphere{<-1.08242,2.09384,3.75282>,r}
+	cylinder{<-1.08242,2.09384,3.75282>,<-0.630059,1.92292,3.78288>,r}
+	sphere{<-0.630059,1.92292,3.78288>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.20813,1.63116,3.94897>,<-0.666201,1.57693,3.92464>,<-0.457568,1.17624,3.66151>}
+	triangle{<-1.20813,1.63116,3.94897>,<-0.457568,1.17624,3.66151>,<-0.66351,0.918845,3.48501>}
+	triangle{<-1.20813,1.63116,3.94897>,<-0.66351,0.918845,3.48501>,<-1.16253,0.889196,3.45424>}
+	triangle{<-1.20813,1.63116,3.94897>,<-1.16253,0.889196,3.45424>,<-1.17671,0.896685,3.45893>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.20813,1.63116,3.94897>,<-0.666201,1.57693,3.92464>,r}
+	sphere{<-0.666201,1.57693,3.92464>,r}
+	cylinder{<-0.666201,1.57693,3.92464>,<-0.457568,1.17624,3.66151>,r}
+	sphere{<-0.457568,1.17624,3.66151>,r}
+	cylinder{<-0.457568,1.17624,3.66151>,<-0.66351,0.918845,3.48501>,r}
+	sphere{<-0.66351,0.918845,3.48501>,r}
+	cylinder{<-0.66351,0.918845,3.48501>,<-1.16253,0.889196,3.45424>,r}
+	sphere{<-1.16253,0.889196,3.45424>,r}
+	cylinder{<-1.16253,0.889196,3.45424>,<-1.17671,0.896685,3.45893>,r}
+	sphere{<-1.17671,0.896685,3.45893>,r}
+	cylinder{<-1.17671,0.896685,3.45893>,<-1.20813,1.63116,3.94897>,r}
+	sphere{<-1.20813,1.63116,3.94897>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.331292,2.20857,4.03223>,<-0.0415858,2.32091,3.82218>,<0.488356,2.09011,4.03644>}
+	triangle{<-0.331292,2.20857,4.03223>,<0.488356,2.09011,4.03644>,<0.480568,1.90312,4.29446>}
+	triangle{<-0.331292,2.20857,4.03223>,<0.480568,1.90312,4.29446>,<0.110804,1.81833,4.48217>}
+	triangle{<-0.331292,2.20857,4.03223>,<0.110804,1.81833,4.48217>,<-0.15126,1.86695,4.46609>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.331292,2.20857,4.03223>,<-0.0415858,2.32091,3.82218>,r}
+	sphere{<-0.0415858,2.32091,3.82218>,r}
+	cylinder{<-0.0415858,2.32091,3.82218>,<0.488356,2.09011,4.03644>,r}
+	sphere{<0.488356,2.09011,4.03644>,r}
+	cylinder{<0.488356,2.09011,4.03644>,<0.480568,1.90312,4.29446>,r}
+	sphere{<0.480568,1.90312,4.29446>,r}
+	cylinder{<0.480568,1.90312,4.29446>,<0.110804,1.81833,4.48217>,r}
+	sphere{<0.110804,1.81833,4.48217>,r}
+	cylinder{<0.110804,1.81833,4.48217>,<-0.15126,1.86695,4.46609>,r}
+	sphere{<-0.15126,1.86695,4.46609>,r}
+	cylinder{<-0.15126,1.86695,4.46609>,<-0.331292,2.20857,4.03223>,r}
+	sphere{<-0.331292,2.20857,4.03223>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.331292,2.20857,4.03223>,<-0.15126,1.86695,4.46609>,<-0.294962,1.44153,4.50516>}
+	triangle{<-0.331292,2.20857,4.03223>,<-0.294962,1.44153,4.50516>,<-0.317933,1.40281,4.49524>}
+	triangle{<-0.331292,2.20857,4.03223>,<-0.317933,1.40281,4.49524>,<-0.666201,1.57693,3.92464>}
+	triangle{<-0.331292,2.20857,4.03223>,<-0.666201,1.57693,3.92464>,<-0.630059,1.92292,3.78288>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.331292,2.20857,4.03223>,<-0.15126,1.86695,4.46609>,r}
+	sphere{<-0.15126,1.86695,4.46609>,r}
+	cylinder{<-0.15126,1.86695,4.46609>,<-0.294962,1.44153,4.50516>,r}
+	sphere{<-0.294962,1.44153,4.50516>,r}
+	cylinder{<-0.294962,1.44153,4.50516>,<-0.317933,1.40281,4.49524>,r}
+	sphere{<-0.317933,1.40281,4.49524>,r}
+	cylinder{<-0.317933,1.40281,4.49524>,<-0.666201,1.57693,3.92464>,r}
+	sphere{<-0.666201,1.57693,3.92464>,r}
+	cylinder{<-0.666201,1.57693,3.92464>,<-0.630059,1.92292,3.78288>,r}
+	sphere{<-0.630059,1.92292,3.78288>,r}
+	cylinder{<-0.630059,1.92292,3.78288>,<-0.331292,2.20857,4.03223>,r}
+	sphere{<-0.331292,2.20857,4.03223>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.824755,3,4.39448>,<-0.78412,3,4.40445>,<-0.442368,2.36875,4.8559>}
+	triangle{<-0.824755,3,4.39448>,<-0.442368,2.36875,4.8559>,<-0.732993,1.94128,5.03354>}
+	triangle{<-0.824755,3,4.39448>,<-0.732993,1.94128,5.03354>,<-1.08725,1.93259,4.95169>}
+	triangle{<-0.824755,3,4.39448>,<-1.08725,1.93259,4.95169>,<-1.29451,2.42382,4.61477>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.824755,3,4.39448>,<-0.78412,3,4.40445>,r}
+	sphere{<-0.78412,3,4.40445>,r}
+	cylinder{<-0.78412,3,4.40445>,<-0.442368,2.36875,4.8559>,r}
+	sphere{<-0.442368,2.36875,4.8559>,r}
+	cylinder{<-0.442368,2.36875,4.8559>,<-0.732993,1.94128,5.03354>,r}
+	sphere{<-0.732993,1.94128,5.03354>,r}
+	cylinder{<-0.732993,1.94128,5.03354>,<-1.08725,1.93259,4.95169>,r}
+	sphere{<-1.08725,1.93259,4.95169>,r}
+	cylinder{<-1.08725,1.93259,4.95169>,<-1.29451,2.42382,4.61477>,r}
+	sphere{<-1.29451,2.42382,4.61477>,r}
+	cylinder{<-1.29451,2.42382,4.61477>,<-0.824755,3,4.39448>,r}
+	sphere{<-0.824755,3,4.39448>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.39044,1.38981,4.58373>,<-0.732993,1.94128,5.03354>,<-0.442368,2.36875,4.8559>}
+	triangle{<-0.39044,1.38981,4.58373>,<-0.442368,2.36875,4.8559>,<-0.15126,1.86695,4.46609>}
+	triangle{<-0.39044,1.38981,4.58373>,<-0.15126,1.86695,4.46609>,<-0.294962,1.44153,4.50516>}
+	triangle{<-0.39044,1.38981,4.58373>,<-0.294962,1.44153,4.50516>,<-0.325713,1.39682,4.52407>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.39044,1.38981,4.58373>,<-0.732993,1.94128,5.03354>,r}
+	sphere{<-0.732993,1.94128,5.03354>,r}
+	cylinder{<-0.732993,1.94128,5.03354>,<-0.442368,2.36875,4.8559>,r}
+	sphere{<-0.442368,2.36875,4.8559>,r}
+	cylinder{<-0.442368,2.36875,4.8559>,<-0.15126,1.86695,4.46609>,r}
+	sphere{<-0.15126,1.86695,4.46609>,r}
+	cylinder{<-0.15126,1.86695,4.46609>,<-0.294962,1.44153,4.50516>,r}
+	sphere{<-0.294962,1.44153,4.50516>,r}
+	cylinder{<-0.294962,1.44153,4.50516>,<-0.325713,1.39682,4.52407>,r}
+	sphere{<-0.325713,1.39682,4.52407>,r}
+	cylinder{<-0.325713,1.39682,4.52407>,<-0.39044,1.38981,4.58373>,r}
+	sphere{<-0.39044,1.38981,4.58373>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.480568,1.90312,4.29446>,<0.65223,1.97116,4.44987>,<0.920008,1.8398,4.56126>}
+	triangle{<0.480568,1.90312,4.29446>,<0.920008,1.8398,4.56126>,<1.07693,1.35951,4.40402>}
+	triangle{<0.480568,1.90312,4.29446>,<1.07693,1.35951,4.40402>,<0.58713,0.961652,3.84818>}
+	triangle{<0.480568,1.90312,4.29446>,<0.58713,0.961652,3.84818>,<0.428154,1.1482,3.84195>}
+	texture{t1}
+}
+union{
+	cylinder{<0.480568,1.90312,4.29446>,<0.65223,1.97116,4.44987>,r}
+	sphere{<0.65223,1.97116,4.44987>,r}
+	cylinder{<0.65223,1.97116,4.44987>,<0.920008,1.8398,4.56126>,r}
+	sphere{<0.920008,1.8398,4.56126>,r}
+	cylinder{<0.920008,1.8398,4.56126>,<1.07693,1.35951,4.40402>,r}
+	sphere{<1.07693,1.35951,4.40402>,r}
+	cylinder{<1.07693,1.35951,4.40402>,<0.58713,0.961652,3.84818>,r}
+	sphere{<0.58713,0.961652,3.84818>,r}
+	cylinder{<0.58713,0.961652,3.84818>,<0.428154,1.1482,3.84195>,r}
+	sphere{<0.428154,1.1482,3.84195>,r}
+	cylinder{<0.428154,1.1482,3.84195>,<0.480568,1.90312,4.29446>,r}
+	sphere{<0.480568,1.90312,4.29446>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.00975,1.97101,4.46891>,<1.5964,1.88916,3.87088>,<1.69873,1.61076,3.76813>}
+	triangle{<1.00975,1.97101,4.46891>,<1.69873,1.61076,3.76813>,<1.54835,1.31319,3.92333>}
+	triangle{<1.00975,1.97101,4.46891>,<1.54835,1.31319,3.92333>,<1.07693,1.35951,4.40402>}
+	triangle{<1.00975,1.97101,4.46891>,<1.07693,1.35951,4.40402>,<0.920008,1.8398,4.56126>}
+	texture{t1}
+}
+union{
+	cylinder{<1.00975,1.97101,4.46891>,<1.5964,1.88916,3.87088>,r}
+	sphere{<1.5964,1.88916,3.87088>,r}
+	cylinder{<1.5964,1.88916,3.87088>,<1.69873,1.61076,3.76813>,r}
+	sphere{<1.69873,1.61076,3.76813>,r}
+	cylinder{<1.69873,1.61076,3.76813>,<1.54835,1.31319,3.92333>,r}
+	sphere{<1.54835,1.31319,3.92333>,r}
+	cylinder{<1.54835,1.31319,3.92333>,<1.07693,1.35951,4.40402>,r}
+	sphere{<1.07693,1.35951,4.40402>,r}
+	cylinder{<1.07693,1.35951,4.40402>,<0.920008,1.8398,4.56126>,r}
+	sphere{<0.920008,1.8398,4.56126>,r}
+	cylinder{<0.920008,1.8398,4.56126>,<1.00975,1.97101,4.46891>,r}
+	sphere{<1.00975,1.97101,4.46891>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.875611,1.99828,3.19382>,<0.905582,2.01864,3.20083>,<1.0646,2.24796,3.55699>}
+	triangle{<0.875611,1.99828,3.19382>,<1.0646,2.24796,3.55699>,<0.690396,2.24044,4.11811>}
+	triangle{<0.875611,1.99828,3.19382>,<0.690396,2.24044,4.11811>,<0.488356,2.09011,4.03644>}
+	triangle{<0.875611,1.99828,3.19382>,<0.488356,2.09011,4.03644>,<0.461535,1.81024,3.34214>}
+	texture{t1}
+}
+union{
+	cylinder{<0.875611,1.99828,3.19382>,<0.905582,2.01864,3.20083>,r}
+	sphere{<0.905582,2.01864,3.20083>,r}
+	cylinder{<0.905582,2.01864,3.20083>,<1.0646,2.24796,3.55699>,r}
+	sphere{<1.0646,2.24796,3.55699>,r}
+	cylinder{<1.0646,2.24796,3.55699>,<0.690396,2.24044,4.11811>,r}
+	sphere{<0.690396,2.24044,4.11811>,r}
+	cylinder{<0.690396,2.24044,4.11811>,<0.488356,2.09011,4.03644>,r}
+	sphere{<0.488356,2.09011,4.03644>,r}
+	cylinder{<0.488356,2.09011,4.03644>,<0.461535,1.81024,3.34214>,r}
+	sphere{<0.461535,1.81024,3.34214>,r}
+	cylinder{<0.461535,1.81024,3.34214>,<0.875611,1.99828,3.19382>,r}
+	sphere{<0.875611,1.99828,3.19382>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.739683,2.1487,4.32313>,<0.65223,1.97116,4.44987>,<0.486549,1.95163,4.69003>}
+	triangle{<0.739683,2.1487,4.32313>,<0.486549,1.95163,4.69003>,<-0.016221,2.87945,5.41894>}
+	triangle{<0.739683,2.1487,4.32313>,<-0.016221,2.87945,5.41894>,<-0.0162187,3,5.41896>}
+	triangle{<0.739683,2.1487,4.32313>,<-0.0162187,3,5.41896>,<0.739609,3,4.32335>}
+	texture{t1}
+}
+union{
+	cylinder{<0.739683,2.1487,4.32313>,<0.65223,1.97116,4.44987>,r}
+	sphere{<0.65223,1.97116,4.44987>,r}
+	cylinder{<0.65223,1.97116,4.44987>,<0.486549,1.95163,4.69003>,r}
+	sphere{<0.486549,1.95163,4.69003>,r}
+	cylinder{<0.486549,1.95163,4.69003>,<-0.016221,2.87945,5.41894>,r}
+	sphere{<-0.016221,2.87945,5.41894>,r}
+	cylinder{<-0.016221,2.87945,5.41894>,<-0.0162187,3,5.41896>,r}
+	sphere{<-0.0162187,3,5.41896>,r}
+	cylinder{<-0.0162187,3,5.41896>,<0.739609,3,4.32335>,r}
+	sphere{<0.739609,3,4.32335>,r}
+	cylinder{<0.739609,3,4.32335>,<0.739683,2.1487,4.32313>,r}
+	sphere{<0.739683,2.1487,4.32313>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.5964,1.88916,3.87088>,<1.0646,2.24796,3.55699>,<1.25643,3,3.26904>}
+	triangle{<1.5964,1.88916,3.87088>,<1.25643,3,3.26904>,<1.84744,3,3.43639>}
+	triangle{<1.5964,1.88916,3.87088>,<1.84744,3,3.43639>,<2.025,2.72403,3.61227>}
+	triangle{<1.5964,1.88916,3.87088>,<2.025,2.72403,3.61227>,<1.79749,1.96932,3.89134>}
+	texture{t1}
+}
+union{
+	cylinder{<1.5964,1.88916,3.87088>,<1.0646,2.24796,3.55699>,r}
+	sphere{<1.0646,2.24796,3.55699>,r}
+	cylinder{<1.0646,2.24796,3.55699>,<1.25643,3,3.26904>,r}
+	sphere{<1.25643,3,3.26904>,r}
+	cylinder{<1.25643,3,3.26904>,<1.84744,3,3.43639>,r}
+	sphere{<1.84744,3,3.43639>,r}
+	cylinder{<1.84744,3,3.43639>,<2.025,2.72403,3.61227>,r}
+	sphere{<2.025,2.72403,3.61227>,r}
+	cylinder{<2.025,2.72403,3.61227>,<1.79749,1.96932,3.89134>,r}
+	sphere{<1.79749,1.96932,3.89134>,r}
+	cylinder{<1.79749,1.96932,3.89134>,<1.5964,1.88916,3.87088>,r}
+	sphere{<1.5964,1.88916,3.87088>,r}
+	texture{t2}
+}
+union{
+	triangle{<-3,-3,5.8066>,<-3,-2.82018,5.65658>,<-1.77035,-1.71069,4.77935>}
+	triangle{<-3,-3,5.8066>,<-1.77035,-1.71069,4.77935>,<-1.76938,-1.71065,4.77935>}
+	triangle{<-3,-3,5.8066>,<-1.76938,-1.71065,4.77935>,<-1.172,-2.27508,5.27378>}
+	triangle{<-3,-3,5.8066>,<-1.172,-2.27508,5.27378>,<-1.44903,-3,5.86767>}
+	texture{t1}
+}
+union{
+	cylinder{<-3,-3,5.8066>,<-3,-2.82018,5.65658>,r}
+	sphere{<-3,-2.82018,5.65658>,r}
+	cylinder{<-3,-2.82018,5.65658>,<-1.77035,-1.71069,4.77935>,r}
+	sphere{<-1.77035,-1.71069,4.77935>,r}
+	cylinder{<-1.77035,-1.71069,4.77935>,<-1.76938,-1.71065,4.77935>,r}
+	sphere{<-1.76938,-1.71065,4.77935>,r}
+	cylinder{<-1.76938,-1.71065,4.77935>,<-1.172,-2.27508,5.27378>,r}
+	sphere{<-1.172,-2.27508,5.27378>,r}
+	cylinder{<-1.172,-2.27508,5.27378>,<-1.44903,-3,5.86767>,r}
+	sphere{<-1.44903,-3,5.86767>,r}
+	cylinder{<-1.44903,-3,5.86767>,<-3,-3,5.8066>,r}
+	sphere{<-3,-3,5.8066>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.19758,-1.30792,4.45211>,<-0.754825,-1.12061,4.73475>,<-0.762187,-1.11645,5.61309>}
+	triangle{<-1.19758,-1.30792,4.45211>,<-0.762187,-1.11645,5.61309>,<-0.838707,-1.14716,5.76655>}
+	triangle{<-1.19758,-1.30792,4.45211>,<-0.838707,-1.14716,5.76655>,<-1.65326,-1.49442,4.92446>}
+	triangle{<-1.19758,-1.30792,4.45211>,<-1.65326,-1.49442,4.92446>,<-1.69153,-1.51138,4.80669>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.19758,-1.30792,4.45211>,<-0.754825,-1.12061,4.73475>,r}
+	sphere{<-0.754825,-1.12061,4.73475>,r}
+	cylinder{<-0.754825,-1.12061,4.73475>,<-0.762187,-1.11645,5.61309>,r}
+	sphere{<-0.762187,-1.11645,5.61309>,r}
+	cylinder{<-0.762187,-1.11645,5.61309>,<-0.838707,-1.14716,5.76655>,r}
+	sphere{<-0.838707,-1.14716,5.76655>,r}
+	cylinder{<-0.838707,-1.14716,5.76655>,<-1.65326,-1.49442,4.92446>,r}
+	sphere{<-1.65326,-1.49442,4.92446>,r}
+	cylinder{<-1.65326,-1.49442,4.92446>,<-1.69153,-1.51138,4.80669>,r}
+	sphere{<-1.69153,-1.51138,4.80669>,r}
+	cylinder{<-1.69153,-1.51138,4.80669>,<-1.19758,-1.30792,4.45211>,r}
+	sphere{<-1.19758,-1.30792,4.45211>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.83528,-2.52129,4.55188>,<-1.172,-2.27508,5.27378>,<-0.64449,-1.55412,5.8937>}
+	triangle{<-0.83528,-2.52129,4.55188>,<-0.64449,-1.55412,5.8937>,<-0.455517,-1.63251,5.58314>}
+	triangle{<-0.83528,-2.52129,4.55188>,<-0.455517,-1.63251,5.58314>,<-0.251001,-1.96995,4.84741>}
+	triangle{<-0.83528,-2.52129,4.55188>,<-0.251001,-1.96995,4.84741>,<-0.30113,-2.10342,4.68573>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.83528,-2.52129,4.55188>,<-1.172,-2.27508,5.27378>,r}
+	sphere{<-1.172,-2.27508,5.27378>,r}
+	cylinder{<-1.172,-2.27508,5.27378>,<-0.64449,-1.55412,5.8937>,r}
+	sphere{<-0.64449,-1.55412,5.8937>,r}
+	cylinder{<-0.64449,-1.55412,5.8937>,<-0.455517,-1.63251,5.58314>,r}
+	sphere{<-0.455517,-1.63251,5.58314>,r}
+	cylinder{<-0.455517,-1.63251,5.58314>,<-0.251001,-1.96995,4.84741>,r}
+	sphere{<-0.251001,-1.96995,4.84741>,r}
+	cylinder{<-0.251001,-1.96995,4.84741>,<-0.30113,-2.10342,4.68573>,r}
+	sphere{<-0.30113,-2.10342,4.68573>,r}
+	cylinder{<-0.30113,-2.10342,4.68573>,<-0.83528,-2.52129,4.55188>,r}
+	sphere{<-0.83528,-2.52129,4.55188>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.642719,-1.59095,6>,<-0.64449,-1.55412,5.8937>,<-0.455517,-1.63251,5.58314>}
+	triangle{<-0.642719,-1.59095,6>,<-0.455517,-1.63251,5.58314>,<-0.0304858,-1.91207,5.19703>}
+	triangle{<-0.642719,-1.59095,6>,<-0.0304858,-1.91207,5.19703>,<0.0207597,-1.97155,5.22845>}
+	triangle{<-0.642719,-1.59095,6>,<0.0207597,-1.97155,5.22845>,<-0.128158,-2.0839,6>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.642719,-1.59095,6>,<-0.64449,-1.55412,5.8937>,r}
+	sphere{<-0.64449,-1.55412,5.8937>,r}
+	cylinder{<-0.64449,-1.55412,5.8937>,<-0.455517,-1.63251,5.58314>,r}
+	sphere{<-0.455517,-1.63251,5.58314>,r}
+	cylinder{<-0.455517,-1.63251,5.58314>,<-0.0304858,-1.91207,5.19703>,r}
+	sphere{<-0.0304858,-1.91207,5.19703>,r}
+	cylinder{<-0.0304858,-1.91207,5.19703>,<0.0207597,-1.97155,5.22845>,r}
+	sphere{<0.0207597,-1.97155,5.22845>,r}
+	cylinder{<0.0207597,-1.97155,5.22845>,<-0.128158,-2.0839,6>,r}
+	sphere{<-0.128158,-2.0839,6>,r}
+	cylinder{<-0.128158,-2.0839,6>,<-0.642719,-1.59095,6>,r}
+	sphere{<-0.642719,-1.59095,6>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.744135,-1.94776,5.23363>,<0.557417,-1.43007,4.96632>,<0.590882,-1.36796,4.83018>}
+	triangle{<0.744135,-1.94776,5.23363>,<0.590882,-1.36796,4.83018>,<1.09022,-1.80433,4.41837>}
+	triangle{<0.744135,-1.94776,5.23363>,<1.09022,-1.80433,4.41837>,<1.16488,-2.01626,4.53111>}
+	triangle{<0.744135,-1.94776,5.23363>,<1.16488,-2.01626,4.53111>,<0.94003,-2.15821,5.11873>}
+	texture{t1}
+}
+union{
+	cylinder{<0.744135,-1.94776,5.23363>,<0.557417,-1.43007,4.96632>,r}
+	sphere{<0.557417,-1.43007,4.96632>,r}
+	cylinder{<0.557417,-1.43007,4.96632>,<0.590882,-1.36796,4.83018>,r}
+	sphere{<0.590882,-1.36796,4.83018>,r}
+	cylinder{<0.590882,-1.36796,4.83018>,<1.09022,-1.80433,4.41837>,r}
+	sphere{<1.09022,-1.80433,4.41837>,r}
+	cylinder{<1.09022,-1.80433,4.41837>,<1.16488,-2.01626,4.53111>,r}
+	sphere{<1.16488,-2.01626,4.53111>,r}
+	cylinder{<1.16488,-2.01626,4.53111>,<0.94003,-2.15821,5.11873>,r}
+	sphere{<0.94003,-2.15821,5.11873>,r}
+	cylinder{<0.94003,-2.15821,5.11873>,<0.744135,-1.94776,5.23363>,r}
+	sphere{<0.744135,-1.94776,5.23363>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.09855,-1.19019,5.66877>,<1.207,-0.803018,5.16647>,<1.8247,-1.06727,4.86873>}
+	triangle{<1.09855,-1.19019,5.66877>,<1.8247,-1.06727,4.86873>,<1.92525,-1.46953,5.19314>}
+	triangle{<1.09855,-1.19019,5.66877>,<1.92525,-1.46953,5.19314>,<1.66623,-1.59734,5.56568>}
+	triangle{<1.09855,-1.19019,5.66877>,<1.66623,-1.59734,5.56568>,<1.18687,-1.38897,5.79331>}
+	texture{t1}
+}
+union{
+	cylinder{<1.09855,-1.19019,5.66877>,<1.207,-0.803018,5.16647>,r}
+	sphere{<1.207,-0.803018,5.16647>,r}
+	cylinder{<1.207,-0.803018,5.16647>,<1.8247,-1.06727,4.86873>,r}
+	sphere{<1.8247,-1.06727,4.86873>,r}
+	cylinder{<1.8247,-1.06727,4.86873>,<1.92525,-1.46953,5.19314>,r}
+	sphere{<1.92525,-1.46953,5.19314>,r}
+	cylinder{<1.92525,-1.46953,5.19314>,<1.66623,-1.59734,5.56568>,r}
+	sphere{<1.66623,-1.59734,5.56568>,r}
+	cylinder{<1.66623,-1.59734,5.56568>,<1.18687,-1.38897,5.79331>,r}
+	sphere{<1.18687,-1.38897,5.79331>,r}
+	cylinder{<1.18687,-1.38897,5.79331>,<1.09855,-1.19019,5.66877>,r}
+	sphere{<1.09855,-1.19019,5.66877>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.16488,-2.01626,4.53111>,<0.94003,-2.15821,5.11873>,<1.00621,-2.15508,5.23324>}
+	triangle{<1.16488,-2.01626,4.53111>,<1.00621,-2.15508,5.23324>,<1.76276,-1.94994,5.28231>}
+	triangle{<1.16488,-2.01626,4.53111>,<1.76276,-1.94994,5.28231>,<1.92922,-1.871,5.04175>}
+	triangle{<1.16488,-2.01626,4.53111>,<1.92922,-1.871,5.04175>,<1.91139,-1.86454,4.95661>}
+	texture{t1}
+}
+union{
+	cylinder{<1.16488,-2.01626,4.53111>,<0.94003,-2.15821,5.11873>,r}
+	sphere{<0.94003,-2.15821,5.11873>,r}
+	cylinder{<0.94003,-2.15821,5.11873>,<1.00621,-2.15508,5.23324>,r}
+	sphere{<1.00621,-2.15508,5.23324>,r}
+	cylinder{<1.00621,-2.15508,5.23324>,<1.76276,-1.94994,5.28231>,r}
+	sphere{<1.76276,-1.94994,5.28231>,r}
+	cylinder{<1.76276,-1.94994,5.28231>,<1.92922,-1.871,5.04175>,r}
+	sphere{<1.92922,-1.871,5.04175>,r}
+	cylinder{<1.92922,-1.871,5.04175>,<1.91139,-1.86454,4.95661>,r}
+	sphere{<1.91139,-1.86454,4.95661>,r}
+	cylinder{<1.91139,-1.86454,4.95661>,<1.16488,-2.01626,4.53111>,r}
+	sphere{<1.16488,-2.01626,4.53111>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.684872,-1.03791,5.11784>,<1.09855,-1.19019,5.66877>,<1.11191,-1.20898,6>}
+	triangle{<0.684872,-1.03791,5.11784>,<1.11191,-1.20898,6>,<0.0543288,-0.882008,6>}
+	triangle{<0.684872,-1.03791,5.11784>,<0.0543288,-0.882008,6>,<0.150866,-0.886717,5.43202>}
+	triangle{<0.684872,-1.03791,5.11784>,<0.150866,-0.886717,5.43202>,<0.475758,-0.976024,5.18032>}
+	texture{t1}
+}
+union{
+	cylinder{<0.684872,-1.03791,5.11784>,<1.09855,-1.19019,5.66877>,r}
+	sphere{<1.09855,-1.19019,5.66877>,r}
+	cylinder{<1.09855,-1.19019,5.66877>,<1.11191,-1.20898,6>,r}
+	sphere{<1.11191,-1.20898,6>,r}
+	cylinder{<1.11191,-1.20898,6>,<0.0543288,-0.882008,6>,r}
+	sphere{<0.0543288,-0.882008,6>,r}
+	cylinder{<0.0543288,-0.882008,6>,<0.150866,-0.886717,5.43202>,r}
+	sphere{<0.150866,-0.886717,5.43202>,r}
+	cylinder{<0.150866,-0.886717,5.43202>,<0.475758,-0.976024,5.18032>,r}
+	sphere{<0.475758,-0.976024,5.18032>,r}
+	cylinder{<0.475758,-0.976024,5.18032>,<0.684872,-1.03791,5.11784>,r}
+	sphere{<0.684872,-1.03791,5.11784>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.93929,-2.34817,5.46908>,<1.90622,-3,5.71958>,<2.06169,-3,4.54175>}
+	triangle{<1.93929,-2.34817,5.46908>,<2.06169,-3,4.54175>,<2.0617,-2.31745,4.54178>}
+	triangle{<1.93929,-2.34817,5.46908>,<2.0617,-2.31745,4.54178>,<2.01635,-1.96983,4.88535>}
+	triangle{<1.93929,-2.34817,5.46908>,<2.01635,-1.96983,4.88535>,<1.99703,-1.93479,5.03172>}
+	texture{t1}
+}
+union{
+	cylinder{<1.93929,-2.34817,5.46908>,<1.90622,-3,5.71958>,r}
+	sphere{<1.90622,-3,5.71958>,r}
+	cylinder{<1.90622,-3,5.71958>,<2.06169,-3,4.54175>,r}
+	sphere{<2.06169,-3,4.54175>,r}
+	cylinder{<2.06169,-3,4.54175>,<2.0617,-2.31745,4.54178>,r}
+	sphere{<2.0617,-2.31745,4.54178>,r}
+	cylinder{<2.0617,-2.31745,4.54178>,<2.01635,-1.96983,4.88535>,r}
+	sphere{<2.01635,-1.96983,4.88535>,r}
+	cylinder{<2.01635,-1.96983,4.88535>,<1.99703,-1.93479,5.03172>,r}
+	sphere{<1.99703,-1.93479,5.03172>,r}
+	cylinder{<1.99703,-1.93479,5.03172>,<1.93929,-2.34817,5.46908>,r}
+	sphere{<1.93929,-2.34817,5.46908>,r}
+	texture{t2}
+}
+union{
+	triangle{<-3,-2.01166,6>,<-1.49975,-0.786852,6>,<-1.65326,-1.49442,4.92446>}
+	triangle{<-3,-2.01166,6>,<-1.65326,-1.49442,4.92446>,<-1.75768,-1.64689,4.80028>}
+	triangle{<-3,-2.01166,6>,<-1.75768,-1.64689,4.80028>,<-1.78448,-1.67321,4.7921>}
+	triangle{<-3,-2.01166,6>,<-1.78448,-1.67321,4.7921>,<-3,-2.17917,5.69057>}
+	texture{t1}
+}
+union{
+	cylinder{<-3,-2.01166,6>,<-1.49975,-0.786852,6>,r}
+	sphere{<-1.49975,-0.786852,6>,r}
+	cylinder{<-1.49975,-0.786852,6>,<-1.65326,-1.49442,4.92446>,r}
+	sphere{<-1.65326,-1.49442,4.92446>,r}
+	cylinder{<-1.65326,-1.49442,4.92446>,<-1.75768,-1.64689,4.80028>,r}
+	sphere{<-1.75768,-1.64689,4.80028>,r}
+	cylinder{<-1.75768,-1.64689,4.80028>,<-1.78448,-1.67321,4.7921>,r}
+	sphere{<-1.78448,-1.67321,4.7921>,r}
+	cylinder{<-1.78448,-1.67321,4.7921>,<-3,-2.17917,5.69057>,r}
+	sphere{<-3,-2.17917,5.69057>,r}
+	cylinder{<-3,-2.17917,5.69057>,<-3,-2.01166,6>,r}
+	sphere{<-3,-2.01166,6>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.95445,-1.01202,4.57849>,<-1.69153,-1.51138,4.80669>,<-1.65326,-1.49442,4.92446>}
+	triangle{<-1.95445,-1.01202,4.57849>,<-1.65326,-1.49442,4.92446>,<-1.49975,-0.786852,6>}
+	triangle{<-1.95445,-1.01202,4.57849>,<-1.49975,-0.786852,6>,<-1.55743,-0.624224,6>}
+	triangle{<-1.95445,-1.01202,4.57849>,<-1.55743,-0.624224,6>,<-2.00041,-0.718924,4.73271>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.95445,-1.01202,4.57849>,<-1.69153,-1.51138,4.80669>,r}
+	sphere{<-1.69153,-1.51138,4.80669>,r}
+	cylinder{<-1.69153,-1.51138,4.80669>,<-1.65326,-1.49442,4.92446>,r}
+	sphere{<-1.65326,-1.49442,4.92446>,r}
+	cylinder{<-1.65326,-1.49442,4.92446>,<-1.49975,-0.786852,6>,r}
+	sphere{<-1.49975,-0.786852,6>,r}
+	cylinder{<-1.49975,-0.786852,6>,<-1.55743,-0.624224,6>,r}
+	sphere{<-1.55743,-0.624224,6>,r}
+	cylinder{<-1.55743,-0.624224,6>,<-2.00041,-0.718924,4.73271>,r}
+	sphere{<-2.00041,-0.718924,4.73271>,r}
+	cylinder{<-2.00041,-0.718924,4.73271>,<-1.95445,-1.01202,4.57849>,r}
+	sphere{<-1.95445,-1.01202,4.57849>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.912189,0.160091,4.38771>,<-0.574113,0.397353,4.44045>,<-0.272193,0.353487,4.87216>}
+	triangle{<-0.912189,0.160091,4.38771>,<-0.272193,0.353487,4.87216>,<-0.302265,0.256881,4.98101>}
+	triangle{<-0.912189,0.160091,4.38771>,<-0.302265,0.256881,4.98101>,<-0.889835,-0.376135,5.22119>}
+	triangle{<-0.912189,0.160091,4.38771>,<-0.889835,-0.376135,5.22119>,<-1.12766,-0.23004,4.71338>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.912189,0.160091,4.38771>,<-0.574113,0.397353,4.44045>,r}
+	sphere{<-0.574113,0.397353,4.44045>,r}
+	cylinder{<-0.574113,0.397353,4.44045>,<-0.272193,0.353487,4.87216>,r}
+	sphere{<-0.272193,0.353487,4.87216>,r}
+	cylinder{<-0.272193,0.353487,4.87216>,<-0.302265,0.256881,4.98101>,r}
+	sphere{<-0.302265,0.256881,4.98101>,r}
+	cylinder{<-0.302265,0.256881,4.98101>,<-0.889835,-0.376135,5.22119>,r}
+	sphere{<-0.889835,-0.376135,5.22119>,r}
+	cylinder{<-0.889835,-0.376135,5.22119>,<-1.12766,-0.23004,4.71338>,r}
+	sphere{<-1.12766,-0.23004,4.71338>,r}
+	cylinder{<-1.12766,-0.23004,4.71338>,<-0.912189,0.160091,4.38771>,r}
+	sphere{<-0.912189,0.160091,4.38771>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.175048,0.273533,4.94006>,<-0.0100323,0.0824058,4.90647>,<-0.075572,-0.603211,4.98972>}
+	triangle{<-0.175048,0.273533,4.94006>,<-0.075572,-0.603211,4.98972>,<-0.659755,-0.808938,5.18963>}
+	triangle{<-0.175048,0.273533,4.94006>,<-0.659755,-0.808938,5.18963>,<-0.889835,-0.376135,5.22119>}
+	triangle{<-0.175048,0.273533,4.94006>,<-0.889835,-0.376135,5.22119>,<-0.302265,0.256881,4.98101>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.175048,0.273533,4.94006>,<-0.0100323,0.0824058,4.90647>,r}
+	sphere{<-0.0100323,0.0824058,4.90647>,r}
+	cylinder{<-0.0100323,0.0824058,4.90647>,<-0.075572,-0.603211,4.98972>,r}
+	sphere{<-0.075572,-0.603211,4.98972>,r}
+	cylinder{<-0.075572,-0.603211,4.98972>,<-0.659755,-0.808938,5.18963>,r}
+	sphere{<-0.659755,-0.808938,5.18963>,r}
+	cylinder{<-0.659755,-0.808938,5.18963>,<-0.889835,-0.376135,5.22119>,r}
+	sphere{<-0.889835,-0.376135,5.22119>,r}
+	cylinder{<-0.889835,-0.376135,5.22119>,<-0.302265,0.256881,4.98101>,r}
+	sphere{<-0.302265,0.256881,4.98101>,r}
+	cylinder{<-0.302265,0.256881,4.98101>,<-0.175048,0.273533,4.94006>,r}
+	sphere{<-0.175048,0.273533,4.94006>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.150866,-0.886717,5.43202>,<-0.669842,-1.27419,5.85375>,<-0.762187,-1.11645,5.61309>}
+	triangle{<0.150866,-0.886717,5.43202>,<-0.762187,-1.11645,5.61309>,<-0.659755,-0.808938,5.18963>}
+	triangle{<0.150866,-0.886717,5.43202>,<-0.659755,-0.808938,5.18963>,<-0.075572,-0.603211,4.98972>}
+	triangle{<0.150866,-0.886717,5.43202>,<-0.075572,-0.603211,4.98972>,<0.213466,-0.770159,5.27536>}
+	texture{t1}
+}
+union{
+	cylinder{<0.150866,-0.886717,5.43202>,<-0.669842,-1.27419,5.85375>,r}
+	sphere{<-0.669842,-1.27419,5.85375>,r}
+	cylinder{<-0.669842,-1.27419,5.85375>,<-0.762187,-1.11645,5.61309>,r}
+	sphere{<-0.762187,-1.11645,5.61309>,r}
+	cylinder{<-0.762187,-1.11645,5.61309>,<-0.659755,-0.808938,5.18963>,r}
+	sphere{<-0.659755,-0.808938,5.18963>,r}
+	cylinder{<-0.659755,-0.808938,5.18963>,<-0.075572,-0.603211,4.98972>,r}
+	sphere{<-0.075572,-0.603211,4.98972>,r}
+	cylinder{<-0.075572,-0.603211,4.98972>,<0.213466,-0.770159,5.27536>,r}
+	sphere{<0.213466,-0.770159,5.27536>,r}
+	cylinder{<0.213466,-0.770159,5.27536>,<0.150866,-0.886717,5.43202>,r}
+	sphere{<0.150866,-0.886717,5.43202>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.889835,-0.376135,5.22119>,<-0.659755,-0.808938,5.18963>,<-0.762187,-1.11645,5.61309>}
+	triangle{<-0.889835,-0.376135,5.22119>,<-0.762187,-1.11645,5.61309>,<-0.838707,-1.14716,5.76655>}
+	triangle{<-0.889835,-0.376135,5.22119>,<-0.838707,-1.14716,5.76655>,<-1.09497,-0.90736,6>}
+	triangle{<-0.889835,-0.376135,5.22119>,<-1.09497,-0.90736,6>,<-1.34818,-0.388602,6>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.889835,-0.376135,5.22119>,<-0.659755,-0.808938,5.18963>,r}
+	sphere{<-0.659755,-0.808938,5.18963>,r}
+	cylinder{<-0.659755,-0.808938,5.18963>,<-0.762187,-1.11645,5.61309>,r}
+	sphere{<-0.762187,-1.11645,5.61309>,r}
+	cylinder{<-0.762187,-1.11645,5.61309>,<-0.838707,-1.14716,5.76655>,r}
+	sphere{<-0.838707,-1.14716,5.76655>,r}
+	cylinder{<-0.838707,-1.14716,5.76655>,<-1.09497,-0.90736,6>,r}
+	sphere{<-1.09497,-0.90736,6>,r}
+	cylinder{<-1.09497,-0.90736,6>,<-1.34818,-0.388602,6>,r}
+	sphere{<-1.34818,-0.388602,6>,r}
+	cylinder{<-1.34818,-0.388602,6>,<-0.889835,-0.376135,5.22119>,r}
+	sphere{<-0.889835,-0.376135,5.22119>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.03901,-0.815092,5.05466>,<1.207,-0.803018,5.16647>,<1.8247,-1.06727,4.86873>}
+	triangle{<1.03901,-0.815092,5.05466>,<1.8247,-1.06727,4.86873>,<1.78935,-1.15095,4.65886>}
+	triangle{<1.03901,-0.815092,5.05466>,<1.78935,-1.15095,4.65886>,<1.49081,-1.16611,4.47463>}
+	triangle{<1.03901,-0.815092,5.05466>,<1.49081,-1.16611,4.47463>,<0.997981,-0.91178,4.81208>}
+	texture{t1}
+}
+union{
+	cylinder{<1.03901,-0.815092,5.05466>,<1.207,-0.803018,5.16647>,r}
+	sphere{<1.207,-0.803018,5.16647>,r}
+	cylinder{<1.207,-0.803018,5.16647>,<1.8247,-1.06727,4.86873>,r}
+	sphere{<1.8247,-1.06727,4.86873>,r}
+	cylinder{<1.8247,-1.06727,4.86873>,<1.78935,-1.15095,4.65886>,r}
+	sphere{<1.78935,-1.15095,4.65886>,r}
+	cylinder{<1.78935,-1.15095,4.65886>,<1.49081,-1.16611,4.47463>,r}
+	sphere{<1.49081,-1.16611,4.47463>,r}
+	cylinder{<1.49081,-1.16611,4.47463>,<0.997981,-0.91178,4.81208>,r}
+	sphere{<0.997981,-0.91178,4.81208>,r}
+	cylinder{<0.997981,-0.91178,4.81208>,<1.03901,-0.815092,5.05466>,r}
+	sphere{<1.03901,-0.815092,5.05466>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.24908,-0.260407,6>,<2.70375,-0.907305,6>,<2.4774,-1.10006,5.44855>}
+	triangle{<2.24908,-0.260407,6>,<2.4774,-1.10006,5.44855>,<1.97719,-0.899895,4.90059>}
+	triangle{<2.24908,-0.260407,6>,<1.97719,-0.899895,4.90059>,<1.83351,-0.478684,5.1328>}
+	triangle{<2.24908,-0.260407,6>,<1.83351,-0.478684,5.1328>,<2.18374,-0.236842,5.92565>}
+	texture{t1}
+}
+union{
+	cylinder{<2.24908,-0.260407,6>,<2.70375,-0.907305,6>,r}
+	sphere{<2.70375,-0.907305,6>,r}
+	cylinder{<2.70375,-0.907305,6>,<2.4774,-1.10006,5.44855>,r}
+	sphere{<2.4774,-1.10006,5.44855>,r}
+	cylinder{<2.4774,-1.10006,5.44855>,<1.97719,-0.899895,4.90059>,r}
+	sphere{<1.97719,-0.899895,4.90059>,r}
+	cylinder{<1.97719,-0.899895,4.90059>,<1.83351,-0.478684,5.1328>,r}
+	sphere{<1.83351,-0.478684,5.1328>,r}
+	cylinder{<1.83351,-0.478684,5.1328>,<2.18374,-0.236842,5.92565>,r}
+	sphere{<2.18374,-0.236842,5.92565>,r}
+	cylinder{<2.18374,-0.236842,5.92565>,<2.24908,-0.260407,6>,r}
+	sphere{<2.24908,-0.260407,6>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.99703,-1.93479,5.03172>,<1.92922,-1.871,5.04175>,<1.92525,-1.46953,5.19314>}
+	triangle{<1.99703,-1.93479,5.03172>,<1.92525,-1.46953,5.19314>,<2.4774,-1.10006,5.44855>}
+	triangle{<1.99703,-1.93479,5.03172>,<2.4774,-1.10006,5.44855>,<3,-1.13507,5.54442>}
+	triangle{<1.99703,-1.93479,5.03172>,<3,-1.13507,5.54442>,<3,-1.87966,5.2621>}
+	texture{t1}
+}
+union{
+	cylinder{<1.99703,-1.93479,5.03172>,<1.92922,-1.871,5.04175>,r}
+	sphere{<1.92922,-1.871,5.04175>,r}
+	cylinder{<1.92922,-1.871,5.04175>,<1.92525,-1.46953,5.19314>,r}
+	sphere{<1.92525,-1.46953,5.19314>,r}
+	cylinder{<1.92525,-1.46953,5.19314>,<2.4774,-1.10006,5.44855>,r}
+	sphere{<2.4774,-1.10006,5.44855>,r}
+	cylinder{<2.4774,-1.10006,5.44855>,<3,-1.13507,5.54442>,r}
+	sphere{<3,-1.13507,5.54442>,r}
+	cylinder{<3,-1.13507,5.54442>,<3,-1.87966,5.2621>,r}
+	sphere{<3,-1.87966,5.2621>,r}
+	cylinder{<3,-1.87966,5.2621>,<1.99703,-1.93479,5.03172>,r}
+	sphere{<1.99703,-1.93479,5.03172>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.71391,0.863319,5.66186>,<-1.84849,0.669822,5.65236>,<-2.43496,0.566177,4.96655>}
+	triangle{<-1.71391,0.863319,5.66186>,<-2.43496,0.566177,4.96655>,<-2.53052,1.00055,4.4616>}
+	triangle{<-1.71391,0.863319,5.66186>,<-2.53052,1.00055,4.4616>,<-2.10474,1.43413,4.64727>}
+	triangle{<-1.71391,0.863319,5.66186>,<-2.10474,1.43413,4.64727>,<-1.72333,1.28549,5.28154>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.71391,0.863319,5.66186>,<-1.84849,0.669822,5.65236>,r}
+	sphere{<-1.84849,0.669822,5.65236>,r}
+	cylinder{<-1.84849,0.669822,5.65236>,<-2.43496,0.566177,4.96655>,r}
+	sphere{<-2.43496,0.566177,4.96655>,r}
+	cylinder{<-2.43496,0.566177,4.96655>,<-2.53052,1.00055,4.4616>,r}
+	sphere{<-2.53052,1.00055,4.4616>,r}
+	cylinder{<-2.53052,1.00055,4.4616>,<-2.10474,1.43413,4.64727>,r}
+	sphere{<-2.10474,1.43413,4.64727>,r}
+	cylinder{<-2.10474,1.43413,4.64727>,<-1.72333,1.28549,5.28154>,r}
+	sphere{<-1.72333,1.28549,5.28154>,r}
+	cylinder{<-1.72333,1.28549,5.28154>,<-1.71391,0.863319,5.66186>,r}
+	sphere{<-1.71391,0.863319,5.66186>,r}
+	texture{t2}
+}
+union{
+	triangle{<-1.25071,1.50231,4.51119>,<-1.08725,1.93259,4.95169>,<-1.60837,1.79347,6>}
+	triangle{<-1.25071,1.50231,4.51119>,<-1.60837,1.79347,6>,<-1.70153,1.67442,6>}
+	triangle{<-1.25071,1.50231,4.51119>,<-1.70153,1.67442,6>,<-1.72333,1.28549,5.28154>}
+	triangle{<-1.25071,1.50231,4.51119>,<-1.72333,1.28549,5.28154>,<-1.34972,1.39141,4.54228>}
+	texture{t1}
+}
+union{
+	cylinder{<-1.25071,1.50231,4.51119>,<-1.08725,1.93259,4.95169>,r}
+	sphere{<-1.08725,1.93259,4.95169>,r}
+	cylinder{<-1.08725,1.93259,4.95169>,<-1.60837,1.79347,6>,r}
+	sphere{<-1.60837,1.79347,6>,r}
+	cylinder{<-1.60837,1.79347,6>,<-1.70153,1.67442,6>,r}
+	sphere{<-1.70153,1.67442,6>,r}
+	cylinder{<-1.70153,1.67442,6>,<-1.72333,1.28549,5.28154>,r}
+	sphere{<-1.72333,1.28549,5.28154>,r}
+	cylinder{<-1.72333,1.28549,5.28154>,<-1.34972,1.39141,4.54228>,r}
+	sphere{<-1.34972,1.39141,4.54228>,r}
+	cylinder{<-1.34972,1.39141,4.54228>,<-1.25071,1.50231,4.51119>,r}
+	sphere{<-1.25071,1.50231,4.51119>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.986562,0.121281,6>,<-1.34249,0.800614,6>,<-0.428647,0.794102,4.7718>}
+	triangle{<-0.986562,0.121281,6>,<-0.428647,0.794102,4.7718>,<-0.369772,0.734323,4.73462>}
+	triangle{<-0.986562,0.121281,6>,<-0.369772,0.734323,4.73462>,<-0.272193,0.353487,4.87216>}
+	triangle{<-0.986562,0.121281,6>,<-0.272193,0.353487,4.87216>,<-0.302265,0.256881,4.98101>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.986562,0.121281,6>,<-1.34249,0.800614,6>,r}
+	sphere{<-1.34249,0.800614,6>,r}
+	cylinder{<-1.34249,0.800614,6>,<-0.428647,0.794102,4.7718>,r}
+	sphere{<-0.428647,0.794102,4.7718>,r}
+	cylinder{<-0.428647,0.794102,4.7718>,<-0.369772,0.734323,4.73462>,r}
+	sphere{<-0.369772,0.734323,4.73462>,r}
+	cylinder{<-0.369772,0.734323,4.73462>,<-0.272193,0.353487,4.87216>,r}
+	sphere{<-0.272193,0.353487,4.87216>,r}
+	cylinder{<-0.272193,0.353487,4.87216>,<-0.302265,0.256881,4.98101>,r}
+	sphere{<-0.302265,0.256881,4.98101>,r}
+	cylinder{<-0.302265,0.256881,4.98101>,<-0.986562,0.121281,6>,r}
+	sphere{<-0.986562,0.121281,6>,r}
+	texture{t2}
+}
+union{
+	triangle{<0.936083,0.819302,4.76962>,<0.688855,0.585369,4.52993>,<-0.0858316,0.716035,4.83477>}
+	triangle{<0.936083,0.819302,4.76962>,<-0.0858316,0.716035,4.83477>,<0.272409,1.16948,5.32205>}
+	triangle{<0.936083,0.819302,4.76962>,<0.272409,1.16948,5.32205>,<0.273936,1.17023,5.32267>}
+	triangle{<0.936083,0.819302,4.76962>,<0.273936,1.17023,5.32267>,<0.728918,1.12586,5.18322>}
+	texture{t1}
+}
+union{
+	cylinder{<0.936083,0.819302,4.76962>,<0.688855,0.585369,4.52993>,r}
+	sphere{<0.688855,0.585369,4.52993>,r}
+	cylinder{<0.688855,0.585369,4.52993>,<-0.0858316,0.716035,4.83477>,r}
+	sphere{<-0.0858316,0.716035,4.83477>,r}
+	cylinder{<-0.0858316,0.716035,4.83477>,<0.272409,1.16948,5.32205>,r}
+	sphere{<0.272409,1.16948,5.32205>,r}
+	cylinder{<0.272409,1.16948,5.32205>,<0.273936,1.17023,5.32267>,r}
+	sphere{<0.273936,1.17023,5.32267>,r}
+	cylinder{<0.273936,1.17023,5.32267>,<0.728918,1.12586,5.18322>,r}
+	sphere{<0.728918,1.12586,5.18322>,r}
+	cylinder{<0.728918,1.12586,5.18322>,<0.936083,0.819302,4.76962>,r}
+	sphere{<0.936083,0.819302,4.76962>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.22669,0.354611,4.82952>,<1.19387,0.249461,4.77548>,<1.03461,-0.0132298,4.92422>}
+	triangle{<1.22669,0.354611,4.82952>,<1.03461,-0.0132298,4.92422>,<0.91111,-0.134442,5.17648>}
+	triangle{<1.22669,0.354611,4.82952>,<0.91111,-0.134442,5.17648>,<0.867542,0.265375,6>}
+	triangle{<1.22669,0.354611,4.82952>,<0.867542,0.265375,6>,<1.02442,0.612412,6>}
+	texture{t1}
+}
+union{
+	cylinder{<1.22669,0.354611,4.82952>,<1.19387,0.249461,4.77548>,r}
+	sphere{<1.19387,0.249461,4.77548>,r}
+	cylinder{<1.19387,0.249461,4.77548>,<1.03461,-0.0132298,4.92422>,r}
+	sphere{<1.03461,-0.0132298,4.92422>,r}
+	cylinder{<1.03461,-0.0132298,4.92422>,<0.91111,-0.134442,5.17648>,r}
+	sphere{<0.91111,-0.134442,5.17648>,r}
+	cylinder{<0.91111,-0.134442,5.17648>,<0.867542,0.265375,6>,r}
+	sphere{<0.867542,0.265375,6>,r}
+	cylinder{<0.867542,0.265375,6>,<1.02442,0.612412,6>,r}
+	sphere{<1.02442,0.612412,6>,r}
+	cylinder{<1.02442,0.612412,6>,<1.22669,0.354611,4.82952>,r}
+	sphere{<1.22669,0.354611,4.82952>,r}
+	texture{t2}
+}
+union{
+	triangle{<3,2.27435,5.68115>,<3,2.04551,6>,<2.44879,1.43315,6>}
+	triangle{<3,2.27435,5.68115>,<2.44879,1.43315,6>,<2.05946,1.24382,5.66114>}
+	triangle{<3,2.27435,5.68115>,<2.05946,1.24382,5.66114>,<1.87136,1.43663,5.1013>}
+	triangle{<3,2.27435,5.68115>,<1.87136,1.43663,5.1013>,<2.14499,1.87079,4.91991>}
+	texture{t1}
+}
+union{
+	cylinder{<3,2.27435,5.68115>,<3,2.04551,6>,r}
+	sphere{<3,2.04551,6>,r}
+	cylinder{<3,2.04551,6>,<2.44879,1.43315,6>,r}
+	sphere{<2.44879,1.43315,6>,r}
+	cylinder{<2.44879,1.43315,6>,<2.05946,1.24382,5.66114>,r}
+	sphere{<2.05946,1.24382,5.66114>,r}
+	cylinder{<2.05946,1.24382,5.66114>,<1.87136,1.43663,5.1013>,r}
+	sphere{<1.87136,1.43663,5.1013>,r}
+	cylinder{<1.87136,1.43663,5.1013>,<2.14499,1.87079,4.91991>,r}
+	sphere{<2.14499,1.87079,4.91991>,r}
+	cylinder{<2.14499,1.87079,4.91991>,<3,2.27435,5.68115>,r}
+	sphere{<3,2.27435,5.68115>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.14499,1.87079,4.91991>,<1.87136,1.43663,5.1013>,<1.91607,0.904189,4.62615>}
+	triangle{<2.14499,1.87079,4.91991>,<1.91607,0.904189,4.62615>,<1.93624,0.91669,4.59839>}
+	triangle{<2.14499,1.87079,4.91991>,<1.93624,0.91669,4.59839>,<2.34757,1.56764,4.32446>}
+	triangle{<2.14499,1.87079,4.91991>,<2.34757,1.56764,4.32446>,<2.35417,1.83987,4.51337>}
+	texture{t1}
+}
+union{
+	cylinder{<2.14499,1.87079,4.91991>,<1.87136,1.43663,5.1013>,r}
+	sphere{<1.87136,1.43663,5.1013>,r}
+	cylinder{<1.87136,1.43663,5.1013>,<1.91607,0.904189,4.62615>,r}
+	sphere{<1.91607,0.904189,4.62615>,r}
+	cylinder{<1.91607,0.904189,4.62615>,<1.93624,0.91669,4.59839>,r}
+	sphere{<1.93624,0.91669,4.59839>,r}
+	cylinder{<1.93624,0.91669,4.59839>,<2.34757,1.56764,4.32446>,r}
+	sphere{<2.34757,1.56764,4.32446>,r}
+	cylinder{<2.34757,1.56764,4.32446>,<2.35417,1.83987,4.51337>,r}
+	sphere{<2.35417,1.83987,4.51337>,r}
+	cylinder{<2.35417,1.83987,4.51337>,<2.14499,1.87079,4.91991>,r}
+	sphere{<2.14499,1.87079,4.91991>,r}
+	texture{t2}
+}
+union{
+	triangle{<-0.237008,1.10823,4.91327>,<-0.338828,1.30031,4.61443>,<-0.39044,1.38981,4.58373>}
+	triangle{<-0.237008,1.10823,4.91327>,<-0.39044,1.38981,4.58373>,<-0.732993,1.94128,5.03354>}
+	triangle{<-0.237008,1.10823,4.91327>,<-0.732993,1.94128,5.03354>,<-0.709181,1.83799,6>}
+	triangle{<-0.237008,1.10823,4.91327>,<-0.709181,1.83799,6>,<-0.575069,1.61062,6>}
+	texture{t1}
+}
+union{
+	cylinder{<-0.237008,1.10823,4.91327>,<-0.338828,1.30031,4.61443>,r}
+	sphere{<-0.338828,1.30031,4.61443>,r}
+	cylinder{<-0.338828,1.30031,4.61443>,<-0.39044,1.38981,4.58373>,r}
+	sphere{<-0.39044,1.38981,4.58373>,r}
+	cylinder{<-0.39044,1.38981,4.58373>,<-0.732993,1.94128,5.03354>,r}
+	sphere{<-0.732993,1.94128,5.03354>,r}
+	cylinder{<-0.732993,1.94128,5.03354>,<-0.709181,1.83799,6>,r}
+	sphere{<-0.709181,1.83799,6>,r}
+	cylinder{<-0.709181,1.83799,6>,<-0.575069,1.61062,6>,r}
+	sphere{<-0.575069,1.61062,6>,r}
+	cylinder{<-0.575069,1.61062,6>,<-0.237008,1.10823,4.91327>,r}
+	sphere{<-0.237008,1.10823,4.91327>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.91607,0.904189,4.62615>,<1.89902,0.892433,4.60889>,<1.12517,1.24694,4.64602>}
+	triangle{<1.91607,0.904189,4.62615>,<1.12517,1.24694,4.64602>,<1.03619,1.53679,4.88043>}
+	triangle{<1.91607,0.904189,4.62615>,<1.03619,1.53679,4.88043>,<1.27646,1.64755,5.07292>}
+	triangle{<1.91607,0.904189,4.62615>,<1.27646,1.64755,5.07292>,<1.87136,1.43663,5.1013>}
+	texture{t1}
+}
+union{
+	cylinder{<1.91607,0.904189,4.62615>,<1.89902,0.892433,4.60889>,r}
+	sphere{<1.89902,0.892433,4.60889>,r}
+	cylinder{<1.89902,0.892433,4.60889>,<1.12517,1.24694,4.64602>,r}
+	sphere{<1.12517,1.24694,4.64602>,r}
+	cylinder{<1.12517,1.24694,4.64602>,<1.03619,1.53679,4.88043>,r}
+	sphere{<1.03619,1.53679,4.88043>,r}
+	cylinder{<1.03619,1.53679,4.88043>,<1.27646,1.64755,5.07292>,r}
+	sphere{<1.27646,1.64755,5.07292>,r}
+	cylinder{<1.27646,1.64755,5.07292>,<1.87136,1.43663,5.1013>,r}
+	sphere{<1.87136,1.43663,5.1013>,r}
+	cylinder{<1.87136,1.43663,5.1013>,<1.91607,0.904189,4.62615>,r}
+	sphere{<1.91607,0.904189,4.62615>,r}
+	texture{t2}
+}
+union{
+	triangle{<1.53211,2.24436,4.83347>,<1.20473,1.85718,5.00207>,<0.962717,1.74407,4.80826>}
+	triangle{<1.53211,2.24436,4.83347>,<0.962717,1.74407,4.80826>,<0.920008,1.8398,4.56126>}
+	triangle{<1.53211,2.24436,4.83347>,<0.920008,1.8398,4.56126>,<1.00975,1.97101,4.46891>}
+	triangle{<1.53211,2.24436,4.83347>,<1.00975,1.97101,4.46891>,<1.51181,2.27678,4.74013>}
+	texture{t1}
+}
+union{
+	cylinder{<1.53211,2.24436,4.83347>,<1.20473,1.85718,5.00207>,r}
+	sphere{<1.20473,1.85718,5.00207>,r}
+	cylinder{<1.20473,1.85718,5.00207>,<0.962717,1.74407,4.80826>,r}
+	sphere{<0.962717,1.74407,4.80826>,r}
+	cylinder{<0.962717,1.74407,4.80826>,<0.920008,1.8398,4.56126>,r}
+	sphere{<0.920008,1.8398,4.56126>,r}
+	cylinder{<0.920008,1.8398,4.56126>,<1.00975,1.97101,4.46891>,r}
+	sphere{<1.00975,1.97101,4.46891>,r}
+	cylinder{<1.00975,1.97101,4.46891>,<1.51181,2.27678,4.74013>,r}
+	sphere{<1.51181,2.27678,4.74013>,r}
+	cylinder{<1.51181,2.27678,4.74013>,<1.53211,2.24436,4.83347>,r}
+	sphere{<1.53211,2.24436,4.83347>,r}
+	texture{t2}
+}
+union{
+	triangle{<2.67358,3,6>,<3,2.73458,6>,<3,2.27435,5.68115>}
+	triangle{<2.67358,3,6>,<3,2.27435,5.68115>,<2.14499,1.87079,4.91991>}
+	triangle{<2.67358,3,6>,<2.14499,1.87079,4.91991>,<1.53211,2.24436,4.83347>}
+	triangle{<2.67358,3,6>,<1.53211,2.24436,4.83347>,<1.66188,3,5.43008>}
+	texture{t1}
+}
+union{
+	cylinder{<2.67358,3,6>,<3,2.73458,6>,r}
+	sphere{<3,2.73458,6>,r}
+	cylinder{<3,2.73458,6>,<3,2.27435,5.68115>,r}
+	sphere{<3,2.27435,5.68115>,r}
+	cylinder{<3,2.27435,5.68115>,<2.14499,1.87079,4.91991>,r}
+	sphere{<2.14499,1.87079,4.91991>,r}
+	cylinder{<2.14499,1.87079,4.91991>,<1.53211,2.24436,4.83347>,r}
+	sphere{<1.53211,2.24436,4.83347>,r}
+	cylinder{<1.53211,2.24436,4.83347>,<1.66188,3,5.43008>,r}
+	sphere{<1.66188,3,5.43008>,r}
+	cylinder{<1.66188,3,5.43008>,<2.67358,3,6>,r}
+	sphere{<2.67358,3,6>,r}
+	texture{t2}
+}
@@ -0,0 +1,20 @@
+cylinder{<-3,-3,0>,<3,-3,0>,rr}
+cylinder{<-3,3,0>,<3,3,0>,rr}
+cylinder{<-3,3,6>,<3,3,6>,rr}
+cylinder{<-3,-3,6>,<3,-3,6>,rr}
+cylinder{<-3,-3,0>,<-3,3,0>,rr}
+cylinder{<3,-3,0>,<3,3,0>,rr}
+cylinder{<3,-3,6>,<3,3,6>,rr}
+cylinder{<-3,-3,6>,<-3,3,6>,rr}
+cylinder{<-3,-3,0>,<-3,-3,6>,rr}
+cylinder{<3,-3,0>,<3,-3,6>,rr}
+cylinder{<3,3,0>,<3,3,6>,rr}
+cylinder{<-3,3,0>,<-3,3,6>,rr}
+sphere{<-3,-3,0>,rr}
+sphere{<3,-3,0>,rr}
+sphere{<-3,3,0>,rr}
+sphere{<3,3,0>,rr}
+sphere{<-3,-3,6>,rr}
+sphere{<3,-3,6>,rr}
+sphere{<-3,3,6>,rr}
+sphere{<3,3,6>,rr}
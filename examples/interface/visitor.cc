@@ -0,0 +1,78 @@
+// Example code demonstrating the for_each_cell routines
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+#include "voro++.hh"
+using namespace voro;
+
+#include <vector>
+using namespace std;
+
+// Set the number of particles that are going to be randomly introduced
+const int particles=20000;
+
+// This function returns a random double between 0 and 1
+double rnd() {return double(rand())/RAND_MAX;}
+
+// A function object that stores the volume and the number of faces of each
+// cell. Since each particle is visited once, and the results are stored by
+// particle ID, it can safely be called from several threads at once.
+struct cell_recorder {
+	vector<double> vol;
+	vector<int> faces;
+	cell_recorder() : vol(particles,0), faces(particles,0) {}
+	inline void operator()(voronoicell_neighbor &c,int id,double x,double y,double z) {
+		vol[id]=c.volume();
+		faces[id]=c.number_of_faces();
+	}
+};
+
+// A function object that finds the cell whose particle is furthest from the
+// center of the container, for use with a loop over a subset of particles
+struct furthest_cell {
+	int id;
+	double rsq;
+	furthest_cell() : id(-1), rsq(-1) {}
+	inline void operator()(voronoicell &c,int id_,double x,double y,double z) {
+		double r=(x-0.5)*(x-0.5)+(y-0.5)*(y-0.5)+(z-0.5)*(z-0.5);
+		if(r>rsq) {rsq=r;id=id_;}
+	}
+};
+
+int main() {
+	int i;
+	double vt=0;
+
+	// Create a container and randomly add particles into it
+	container con(0,1,0,1,0,1,16,16,16,false,false,false,8);
+	for(i=0;i<particles;i++) con.put(i,rnd(),rnd(),rnd());
+
+	// Compute all of the cells in serial, and then with two threads, and
+	// check that the results agree
+	cell_recorder cs,cp;
+	for_each_cell<voronoicell_neighbor>(con,cs);
+	for_each_cell<voronoicell_neighbor>(con,cp,exec_parallel(2));
+	int diff=0;
+	for(i=0;i<particles;i++) {
+		vt+=cs.vol[i];
+		if(cs.faces[i]!=cp.faces[i]||fabs(cs.vol[i]-cp.vol[i])>1e-12) diff++;
+	}
+	printf("Total volume: %g\nCells that differ: %d\n",vt,diff);
+
+	// Visit the cells in a sphere using a loop class
+	furthest_cell fc;
+	c_loop_subset vl(con);
+	vl.setup_sphere(0.5,0.5,0.5,0.1,true);
+	for_each_cell<voronoicell>(con,vl,fc);
+	printf("Furthest particle from the center within the sphere: %d at %g\n",fc.id,sqrt(fc.rsq));
+
+	// Compute the cells in a larger sphere with two threads, sharing out
+	// the blocks that the subset loop visits
+	cell_recorder cr;
+	vl.setup_sphere(0.5,0.5,0.5,0.3,true);
+	for_each_cell<voronoicell_neighbor>(con,vl,cr,exec_parallel(2));
+	for(vt=0,i=0;i<particles;i++) vt+=cr.vol[i];
+	printf("Volume of the cells within the larger sphere: %g\n",vt);
+}
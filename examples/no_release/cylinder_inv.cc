@@ -15,36 +15,6 @@ const double z_min=-6,z_max=6;
 // Set the computational grid size
 const int n_x=6,n_y=6,n_z=6;
 
-struct wall_cylinder_inv : public wall {
-	public:
-		wall_cylinder_inv(double xc_,double yc_,double zc_,double xa_,double ya_,double za_,double rc_,int w_id_=-99)
-			: w_id(w_id_), xc(xc_), yc(yc_), zc(zc_), xa(xa_), ya(ya_), za(za_),
-			asi(1/(xa_*xa_+ya_*ya_+za_*za_)), rc(rc_) {}
-		bool point_inside(double x,double y,double z) {
-			double xd=x-xc,yd=y-yc,zd=z-zc;
-			double pa=(xd*xa+yd*ya+zd*za)*asi;
-			xd-=xa*pa;yd-=ya*pa;zd-=za*pa;
-			return xd*xd+yd*yd+zd*zd>rc*rc;
-		}
-		template<class v_cell>
-		bool cut_cell_base(v_cell &c,double x,double y,double z) {
-			double xd=x-xc,yd=y-yc,zd=z-zc;
-			double pa=(xd*xa+yd*ya+zd*za)*asi;
-			xd-=xa*pa;yd-=ya*pa;zd-=za*pa;
-			pa=xd*xd+yd*yd+zd*zd;
-			if(pa>1e-5) {
-				pa=2*(sqrt(pa)*rc-pa);
-				return c.nplane(-xd,-yd,-zd,-pa,w_id);
-			}
-			return true;
-		}
-		bool cut_cell(voronoicell &c,double x,double y,double z) {return cut_cell_base(c,x,y,z);}
-		bool cut_cell(voronoicell_neighbor &c,double x,double y,double z) {return cut_cell_base(c,x,y,z);}
-	private:
-		const int w_id;
-		const double xc,yc,zc,xa,ya,za,asi,rc;
-};
-
 int main() {
 	int i;double x,y,z;
 
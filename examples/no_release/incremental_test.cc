@@ -0,0 +1,49 @@
+// Incremental Voronoi ID test code
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+#include <cstdio>
+using namespace std;
+
+#include "voro++.hh"
+using namespace voro;
+
+// Set the number of particles that are going to be randomly introduced
+const int particles=100;
+
+// This function returns a random double between 0 and 1
+double rnd() {return double(rand())/RAND_MAX;}
+
+int main() {
+	int i,fails=0;
+	vector<voro_id> changed;
+
+	// Create a container with some random particles, and keep its
+	// tessellation up to date incrementally
+	container con(0,1,0,1,0,1,4,4,4,false,false,false,8);
+	for(i=0;i<particles;i++) con.put(i,rnd(),rnd(),rnd());
+	incremental_voronoi iv(con);
+
+	// Check that negative IDs are rejected without changing the container
+	if(iv.insert(-1,0.5,0.5,0.5,changed)||!changed.empty()) {
+		puts("Insertion of ID -1 was not rejected");fails++;
+	}
+	if(iv.insert(-1000,0.5,0.5,0.5,changed)) {
+		puts("Insertion of ID -1000 was not rejected");fails++;
+	}
+	if(iv.contains(-1)) {
+		puts("ID -1 is reported as stored");fails++;
+	}
+	if(con.total_particles()!=particles) {
+		printf("Container holds %ld particles\n",long(con.total_particles()));fails++;
+	}
+
+	// Check that a valid insertion still works afterwards
+	if(!iv.insert(particles,0.5,0.5,0.5,changed)||!iv.contains(particles)) {
+		puts("Insertion of a new ID failed");fails++;
+	}
+	printf("%d failures\n",fails);
+	return fails==0?0:1;
+}
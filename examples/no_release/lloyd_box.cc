@@ -22,14 +22,21 @@ const int particles=4000;
 // Set the number of Voronoi faces to bin
 const int nface=40;
 
+// Set the maximum number of iterations, and the distance below which the
+// largest particle move is taken to have converged
+const int max_iter=200;
+const double tol=1e-5;
+
+// Set the number of threads to use
+const int threads=4;
+
 // This function returns a random double between 0 and 1
 double rnd() {return double(rand())/RAND_MAX;}
 
 int main() {
 	int i,l;
-	double x,y,z,r,dx,dy,dz;
+	double x,y,z,r;
 	int faces[nface],*fp;
-	double p[3*particles];
 
 	// Create a container with the geometry given above, and make it
 	// non-periodic in each of the three coordinates. Allocate space for
@@ -44,28 +51,26 @@ int main() {
 		con.put(i,x,y,z);
 	}
 
-	for(l=0;l<=200;l++) {
-		c_loop_all vl(con);
-		voronoicell c;
-		for(fp=faces;fp<faces+nface;fp++) *fp=0;
-		if(vl.start()) do if(con.compute_cell(c,vl)) {
-			vl.pos(i,x,y,z,r);
-			c.centroid(dx,dy,dz);
-			p[3*i]=x+dx;
-			p[3*i+1]=y+dy;
-			p[3*i+2]=z+dz;
-
-			i=c.number_of_faces()-4;
-			if(i<0) i=0;if(i>=nface) i=nface-1;
-			faces[i]++;
-		} while (vl.inc());
-		con.clear();
-		for(i=0;i<particles;i++) con.put(i,p[3*i],p[3*i+1],p[3*i+2]);
-		printf("%d",l);
-		for(fp=faces;fp<faces+nface;fp++) printf(" %d",*fp);
-		puts("");
+	// Carry out Lloyd's algorithm, printing the largest distance that a
+	// particle moved in each iteration
+	lloyd_relax<container> lr(con);
+	for(l=0;l<max_iter;l++) {
+		printf("%d %g\n",l,lr.step(threads));
+		if(lr.max_move<tol) break;
 	}
 
+	// Bin the number of faces of the relaxed cells
+	voronoicell c;
+	c_loop_all vl(con);
+	for(fp=faces;fp<faces+nface;fp++) *fp=0;
+	if(vl.start()) do if(con.compute_cell(c,vl)) {
+		i=c.number_of_faces()-4;
+		if(i<0) i=0;if(i>=nface) i=nface-1;
+		faces[i]++;
+	} while (vl.inc());
+	for(fp=faces;fp<faces+nface;fp++) printf(" %d",*fp);
+	puts("");
+
 	// Output the particle positions in gnuplot format
 	con.draw_particles("sphere_mesh_p.gnu");
 
@@ -75,11 +80,15 @@ int main() {
 	// Output the neighbor mesh in gnuplot format
 	FILE *ff=safe_fopen("sphere_mesh.net","w");
 	vector<int> vi;
-	voronoicell_neighbor c;
-	c_loop_all vl(con);
-	if(vl.start()) do if(con.compute_cell(c,vl)) {
+	vector<double> p(3*particles);
+	voronoicell_neighbor cn;
+	if(vl.start()) do {
+		vl.pos(i,x,y,z,r);
+		p[3*i]=x;p[3*i+1]=y;p[3*i+2]=z;
+	} while(vl.inc());
+	if(vl.start()) do if(con.compute_cell(cn,vl)) {
 		i=vl.pid();
-		c.neighbors(vi);
+		cn.neighbors(vi);
 		for(l=0;l<(signed int) vi.size();l++) if(vi[l]>i)
 			fprintf(ff,"%g %g %g\n%g %g %g\n\n\n",
 				p[3*i],p[3*i+1],p[3*i+2],
@@ -0,0 +1,93 @@
+// Radical Voronoi search bound test code
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+#include <cmath>
+#include <cstdio>
+using namespace std;
+
+#include "voro++.hh"
+using namespace voro;
+
+// Set up the number of blocks that the container is divided into
+const int n_x=6,n_y=6,n_z=6;
+
+// Set the number of particles that are going to be randomly introduced, and
+// the radii to use. One particle in every hundred is much larger than the
+// rest, so that the cell searches use the largest radius near each cell
+// rather than the largest radius in the container.
+const int particles=2000;
+const double r_small=0.0008,r_large=0.1;
+
+// The tolerances for the volume and the vertex positions, which may differ
+// by roundoff from the direct computation
+const double diff_tol=1e-10;
+
+// This function returns a random double between 0 and 1
+double rnd() {return double(rand())/RAND_MAX;}
+
+// Computes the radical Voronoi cell of a particle directly, by cutting a cell
+// that fills the container with the plane of every other particle.
+bool direct_cell(voronoicell &c,int i,double *px,double *r) {
+	double *pp=px+3*i;
+	c.init(-pp[0],1-pp[0],-pp[1],1-pp[1],-pp[2],1-pp[2]);
+	for(int j=0;j<particles;j++) if(j!=i) {
+		double *qp=px+3*j,dx=qp[0]-pp[0],dy=qp[1]-pp[1],dz=qp[2]-pp[2];
+		if(!c.nplane(dx,dy,dz,dx*dx+dy*dy+dz*dz+r[i]*r[i]-r[j]*r[j],j)) return false;
+	}
+	return true;
+}
+
+// Finds the largest distance from a vertex of one cell to the nearest vertex
+// of another cell.
+double vertex_distance(vector<double> &v,vector<double> &w) {
+	double dm=0;
+	for(unsigned int i=0;i<v.size();i+=3) {
+		double d,dmin=1e30;
+		for(unsigned int j=0;j<w.size();j+=3) {
+			d=(v[i]-w[j])*(v[i]-w[j])+(v[i+1]-w[j+1])*(v[i+1]-w[j+1])+(v[i+2]-w[j+2])*(v[i+2]-w[j+2]);
+			if(d<dmin) dmin=d;
+		}
+		if(dmin>dm) dm=dmin;
+	}
+	return sqrt(dm);
+}
+
+int main() {
+	int i,id,fails=0;
+	double x,y,z,rr,px[3*particles],r[particles];
+	vector<double> v,w;
+	voronoicell c,d;
+
+	// Create a container with the random polydisperse particles
+	container_poly con(0,1,0,1,0,1,n_x,n_y,n_z,false,false,false,8);
+	for(i=0;i<particles;i++) {
+		px[3*i]=rnd();px[3*i+1]=rnd();px[3*i+2]=rnd();
+		r[i]=i%100==0?r_large:r_small;
+		con.put(i,px[3*i],px[3*i+1],px[3*i+2],r[i]);
+	}
+
+	// Compare each cell with the direct computation
+	c_loop_all vl(con);
+	if(vl.start()) do {
+		vl.pos(id,x,y,z,rr);
+		bool found=con.compute_cell(c,vl),dfound=direct_cell(d,id,px,r);
+		if(found!=dfound) {
+			printf("Particle %d: cell %s only in the direct computation\n",id,dfound?"found":"removed");
+			fails++;
+		} else if(found) {
+			c.vertices(v);v.resize(3*c.p);
+			d.vertices(w);w.resize(3*d.p);
+			double dv=fabs(c.volume()-d.volume()),dp=vertex_distance(v,w);
+			if(dv>diff_tol||dp>diff_tol||v.size()!=w.size()) {
+				printf("Particle %d: volume difference %g, vertex difference %g, vertices %d and %d\n",
+				       id,dv,dp,int(v.size()/3),int(w.size()/3));
+				fails++;
+			}
+		}
+	} while(vl.inc());
+	printf("%d failures\n",fails);
+	return fails==0?0:1;
+}
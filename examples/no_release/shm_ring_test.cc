@@ -0,0 +1,43 @@
+// Ring buffer wrap-around test code
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+#include <cstdio>
+using namespace std;
+
+#include "voro++.hh"
+using namespace voro;
+
+// The number of records to write. Each record holds a cell without its
+// neighbors or vertices, and is 56 bytes long, so that 73 of them fill 4088
+// bytes of the 4096-byte ring, leaving an eight-byte gap before each wrap.
+const int records=200;
+
+int main() {
+	const char *fn="shm_ring_test.rb";
+	int i,read=0,ex=0;
+	voronoicell c;
+	c.init(-1,1,-1,1,-1,1);
+
+	// Set up a minimum-sized ring buffer, and a reader that drains it after
+	// every record, so that no records should ever be lost
+	shm_ring ring(fn,4096);
+	shm_ring_reader rd(fn);
+	ring_output ro(ring,false,false,1);
+	ring_cell rc;
+	for(i=0;i<records;i++) {
+		ro(c,i,0,0,0);
+		while(rd.next(rc)) {
+			if(rc.id!=ex) printf("Expected ID %d, found %ld\n",ex,long(rc.id));
+			ex=rc.id+1;read++;
+		}
+	}
+	ring.close();
+	remove(fn);
+
+	// Print the totals, and return an error status if any records were lost
+	printf("Written %d, read %d, overruns %lu\n",records,read,rd.overruns);
+	return read==records&&rd.overruns==0?0:1;
+}
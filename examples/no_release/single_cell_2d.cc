@@ -12,11 +12,10 @@ double rnd() {return double(rand())/RAND_MAX;}
 
 int main() {
 	double x,y,rsq,r;
-	voronoicell v;
+	voronoicell_2d v;
 
-	// Initialize the Voronoi cell to be a square of side length 2 in the xy-plane. Set the
-	// cell to be 1 high in the z-direction.
-	v.init(-1,1,-1,1,-0.5,0.5);
+	// Initialize the Voronoi cell to be a square of side length 2
+	v.init(-1,1,-1,1);
 
 	// Cut the cell by 250 random planes which are all a distance 1 away
 	// from the origin, to make an approximation to a sphere
@@ -26,10 +25,10 @@ int main() {
 		rsq=x*x+y*y;
 		if(rsq>0.01&&rsq<1) {
 			r=1/sqrt(rsq);x*=r;y*=r;
-			v.plane(x,y,0,1);
+			v.plane(x,y,1);
 		}
 	}
 
 	// Output the Voronoi cell to a file, in the gnuplot format
-	v.draw_gnuplot(0,0,0,"single_cell_2d.gnu");
+	v.draw_gnuplot(0,0,"single_cell_2d.gnu");
 }
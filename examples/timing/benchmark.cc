@@ -0,0 +1,283 @@
+// Benchmark suite example code
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+#include <cstring>
+#include <vector>
+using namespace std;
+
+#include "voro++.hh"
+using namespace voro;
+
+// The number of particles, the number of repetitions of each timing, and an
+// optional string that the names of the benchmarks to run must contain
+int particles=100000,reps=3;
+const char *filter=NULL;
+
+// The particle distributions that are tested
+enum distribution {uniform,clustered,lattice,polydisperse};
+const char *dist_name[4]={"uniform","clustered","lattice","poly"};
+
+// The particle positions and radii, in groups of four
+vector<double> pts;
+
+// This function returns a random double between 0 and 1
+double rnd() {return double(rand())/RAND_MAX;}
+
+// Sets up the particles in the unit cube for a given distribution. Clustered
+// particles are placed in 100 clusters of roughly Gaussian shape, wrapped
+// back into the cube. The lattice is simple cubic, so that every vertex is
+// degenerate, and the number of particles is rounded to a cube. The radii are
+// only used by the radical Voronoi containers, and are spread by a factor of
+// three for the polydisperse distribution.
+void setup_particles(distribution d) {
+	int i,j,k,m=particles;
+	double r=0.3*pow(1./particles,1/3.0),x,y,z,cx[300];
+	srand(1);
+	if(d==lattice) {
+		m=int(pow(particles,1/3.0)+0.5);
+		particles=m*m*m;
+	}
+	pts.resize(4*particles);
+	if(d==clustered) for(i=0;i<300;i++) cx[i]=rnd();
+	for(i=0;i<particles;i++) {
+		if(d==lattice) {
+			x=(i%m+0.5)/m;y=((i/m)%m+0.5)/m;z=(i/(m*m)+0.5)/m;
+		} else if(d==clustered) {
+			j=3*(i%100);x=y=z=0;
+			for(k=0;k<4;k++) {x+=rnd();y+=rnd();z+=rnd();}
+			x=cx[j]+0.02*(x-2);x-=floor(x);
+			y=cx[j+1]+0.02*(y-2);y-=floor(y);
+			z=cx[j+2]+0.02*(z-2);z-=floor(z);
+		} else {x=rnd();y=rnd();z=rnd();}
+		pts[4*i]=x;pts[4*i+1]=y;pts[4*i+2]=z;
+		pts[4*i+3]=d==polydisperse?r*(0.5+rnd()):r;
+	}
+}
+
+// Returns whether a benchmark should be run
+bool selected(const char *name) {
+	return filter==NULL||strstr(name,filter)!=NULL;
+}
+
+// A class that records the wall-clock time of each repetition
+class bench_timer {
+	public:
+		vector<double> t;
+		double t0;
+		inline void start() {t0=voro_wtime();}
+		inline void stop() {t.push_back(voro_wtime()-t0);}
+		// Prints a line of results, with the minimum, mean, and
+		// standard deviation of the times, and a checksum of the
+		// output that should not change between releases
+		void report(const char *name,const char *cname,const char *dname,const char *vname,int nb,double check) {
+			double mi=t[0],me=0,sd=0;
+			unsigned int i;
+			for(i=0;i<t.size();i++) {me+=t[i];if(t[i]<mi) mi=t[i];}
+			me/=t.size();
+			for(i=0;i<t.size();i++) sd+=(t[i]-me)*(t[i]-me);
+			sd=t.size()>1?sqrt(sd/(t.size()-1)):0;
+			printf("%s %s %s %s %d %d %d %.6f %.6f %.6f %.12g\n",name,cname,dname,vname,
+			       particles,nb,int(t.size()),mi,me,sd,check);
+			fflush(stdout);
+		}
+};
+
+// Functions to create each type of container in the unit cube with a given
+// number of blocks in each direction, and to add the particles to it
+container* new_container(container*,int nb) {
+	return new container(0,1,0,1,0,1,nb,nb,nb,false,false,false,8);
+}
+container_poly* new_container(container_poly*,int nb) {
+	return new container_poly(0,1,0,1,0,1,nb,nb,nb,false,false,false,8);
+}
+container_periodic* new_container(container_periodic*,int nb) {
+	return new container_periodic(1,0,1,0,0,1,nb,nb,nb,8);
+}
+void put_particles(container_poly &con) {
+	for(int i=0;i<particles;i++) con.put(i,pts[4*i],pts[4*i+1],pts[4*i+2],pts[4*i+3]);
+}
+template<class c_class>
+void put_particles(c_class &con) {
+	for(int i=0;i<particles;i++) con.put(i,pts[4*i],pts[4*i+1],pts[4*i+2]);
+}
+
+// Returns the number of blocks in each direction that gives a mean number of
+// particles per block
+int blocks(double ppb) {
+	return int(pow(particles/ppb,1/3.0))+1;
+}
+
+// Computes all the cells in a container, returning the total number of faces
+// as a checksum that is sensitive to changes in the cell topology
+template<class c_class,class v_cell>
+double compute_cells(c_class &con,v_cell &c) {
+	c_loop_all vl(con);
+	double faces=0;
+	if(vl.start()) do if(con.compute_cell(c,vl)) faces+=c.number_of_faces();
+	while(vl.inc());
+	return faces;
+}
+template<class v_cell>
+double compute_cells(container_periodic &con,v_cell &c) {
+	c_loop_all_periodic vl(con);
+	double faces=0;
+	if(vl.start()) do if(con.compute_cell(c,vl)) faces+=c.number_of_faces();
+	while(vl.inc());
+	return faces;
+}
+
+// Times the computation of all the cells in a container
+template<class c_class,class v_cell>
+void bench_cells(const char *name,const char *cname,distribution d,const char *vname,double ppb) {
+	if(!selected(name)) return;
+	setup_particles(d);
+	int nb=blocks(ppb);
+	c_class *con=new_container((c_class*) NULL,nb);
+	put_particles(*con);
+	v_cell c(*con);
+	bench_timer bt;
+	double faces=0;
+	for(int l=0;l<reps;l++) {
+		bt.start();
+		faces=compute_cells(*con,c);
+		bt.stop();
+	}
+	bt.report(name,cname,dist_name[d],vname,nb,faces);
+	delete con;
+}
+
+// Runs the cell computation benchmarks for both Voronoi cell classes
+template<class c_class>
+void bench_cells(const char *cname,distribution d) {
+	bench_cells<c_class,voronoicell>("cells",cname,d,"voronoicell",5);
+	bench_cells<c_class,voronoicell_neighbor>("cells",cname,d,"voronoicell_neighbor",5);
+}
+
+// Times the print_custom routine, returning the number of bytes written as the
+// checksum
+void bench_print_custom() {
+	if(!selected("print_custom")) return;
+	setup_particles(uniform);
+	int nb=blocks(5);
+	container con(0,1,0,1,0,1,nb,nb,nb,false,false,false,8);
+	put_particles(con);
+	bench_timer bt;
+	long bytes=0;
+	for(int l=0;l<reps;l++) {
+		FILE *fp=tmpfile();
+		if(fp==NULL) voro_fatal_error("Unable to open temporary file",VOROPP_FILE_ERROR);
+		bt.start();
+		con.print_custom("%i %q %v %s %n",fp);
+		fflush(fp);
+		bt.stop();
+		bytes=ftell(fp);
+		fclose(fp);
+	}
+	bt.report("print_custom","container","uniform","-",nb,bytes);
+}
+
+// Times the creation of a container and the import of the particles from a
+// text file, returning the total number of particles as the checksum
+void bench_import() {
+	if(!selected("import")) return;
+	setup_particles(uniform);
+	int nb=blocks(5),i;
+	FILE *fp=tmpfile();
+	if(fp==NULL) voro_fatal_error("Unable to open temporary file",VOROPP_FILE_ERROR);
+	for(i=0;i<particles;i++) fprintf(fp,"%d %.12g %.12g %.12g\n",i,pts[4*i],pts[4*i+1],pts[4*i+2]);
+	bench_timer bt;
+	double tot=0;
+	for(int l=0;l<reps;l++) {
+		rewind(fp);
+		bt.start();
+		container con(0,1,0,1,0,1,nb,nb,nb,false,false,false,8);
+		con.import(fp);
+		bt.stop();
+		tot=con.total_particles();
+	}
+	fclose(fp);
+	bt.report("import","container","uniform","-",nb,tot);
+}
+
+// Times the computation of ghost cells and the location of the cells that
+// contain random positions, returning the total ghost cell volume and the sum
+// of the particle IDs that are found as the checksums
+void bench_queries() {
+	if(!selected("ghost")&&!selected("find")) return;
+	setup_particles(uniform);
+	int nb=blocks(5),i,q=particles/10;voro_id pid;
+	container con(0,1,0,1,0,1,nb,nb,nb,false,false,false,8);
+	put_particles(con);
+	vector<double> qp(3*particles);
+	srand(2);
+	for(i=0;i<3*particles;i++) qp[i]=rnd();
+	double rx,ry,rz,check=0;
+	if(selected("ghost")) {
+		voronoicell c;
+		bench_timer bt;
+		for(int l=0;l<reps;l++) {
+			check=0;
+			bt.start();
+			for(i=0;i<q;i++) if(con.compute_ghost_cell(c,qp[3*i],qp[3*i+1],qp[3*i+2])) check+=c.volume();
+			bt.stop();
+		}
+		bt.report("ghost","container","uniform","voronoicell",nb,check);
+	}
+	if(selected("find")) {
+		bench_timer bt;
+		for(int l=0;l<reps;l++) {
+			check=0;
+			bt.start();
+			for(i=0;i<particles;i++) if(con.find_voronoi_cell(qp[3*i],qp[3*i+1],qp[3*i+2],rx,ry,rz,pid)) check+=pid;
+			bt.stop();
+		}
+		bt.report("find","container","uniform","-",nb,check);
+	}
+}
+
+int main(int argc,char **argv) {
+	int i,n;
+
+	// Read the command-line options
+	for(i=1;i<argc;i++) {
+		if(i+1<argc&&strcmp(argv[i],"-n")==0) particles=atoi(argv[++i]);
+		else if(i+1<argc&&strcmp(argv[i],"-r")==0) reps=atoi(argv[++i]);
+		else if(i+1<argc&&strcmp(argv[i],"-f")==0) filter=argv[++i];
+		else {
+			fputs("Usage: benchmark [-n particles] [-r repetitions] [-f filter]\n",stderr);
+			return VOROPP_CMD_LINE_ERROR;
+		}
+	}
+	if(particles<1||reps<1) {
+		fputs("The number of particles and repetitions must be positive\n",stderr);
+		return VOROPP_CMD_LINE_ERROR;
+	}
+	n=particles;
+	puts("# name container distribution cell particles blocks reps min mean stddev checksum");
+
+	// Time the cell computation for each container and distribution. The
+	// number of particles is restored after the lattice, which rounds it.
+	for(i=uniform;i<=lattice;i++) {
+		bench_cells<container>("container",distribution(i));particles=n;
+		bench_cells<container_periodic>("container_periodic",distribution(i));particles=n;
+	}
+	for(i=uniform;i<=polydisperse;i++) {
+		bench_cells<container_poly>("container_poly",distribution(i));particles=n;
+	}
+
+	// Time the cell computation for a range of block sizes
+	double ppb[5]={1,2,5,10,20};
+	char buf[32];
+	for(i=0;i<5;i++) {
+		sprintf(buf,"grid_%g",ppb[i]);
+		bench_cells<container,voronoicell>(buf,"container",uniform,"voronoicell",ppb[i]);
+	}
+
+	// Time the output, input, and query routines
+	bench_print_custom();
+	bench_import();
+	bench_queries();
+}
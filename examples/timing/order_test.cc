@@ -0,0 +1,49 @@
+// Traversal order timing test example code
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+#include <ctime>
+using namespace std;
+
+#include "voro++.cc"
+using namespace voro;
+
+// This function returns a random double between 0 and 1
+double rnd() {return double(rand())/RAND_MAX;}
+
+// Computes all of the Voronoi cells in the container using a given loop
+// class, and prints the time taken and the total volume
+template<class c_loop>
+void time_loop(container &con,c_loop &vl,const char *name) {
+	voronoicell c(con);
+	double vol=0;
+	clock_t start=clock();
+	if(vl.start()) do if(con.compute_cell(c,vl)) vol+=c.volume();while(vl.inc());
+	double runtime=double(clock()-start)/CLOCKS_PER_SEC;
+	printf("%-26s %8.3f s   volume %.12g\n",name,runtime,vol);
+}
+
+int main(int argc,char **argv) {
+
+	// Read the optional number of particles, and set up a cubic grid with
+	// about five particles per block
+	int i,particles=argc>1?atoi(argv[1]):1000000;
+	int n=int(pow(particles/5.0,1/3.0))+1;
+
+	// Create a periodic unit cube and add the particles in a random order
+	container con(0,1,0,1,0,1,n,n,n,true,true,true,8);
+	for(i=0;i<particles;i++) con.put(i,rnd(),rnd(),rnd());
+	printf("%d particles, %d^3 blocks\n",particles,n);
+
+	// Time the block index order and the Morton block order, before and
+	// after the particle memory is rearranged along the Morton curve
+	c_loop_all vla(con);
+	c_loop_morton vlm(con);
+	time_loop(con,vla,"Index order");
+	time_loop(con,vlm,"Morton order");
+	con.sort_morton();
+	time_loop(con,vla,"Index order, sorted");
+	time_loop(con,vlm,"Morton order, sorted");
+}
@@ -0,0 +1,136 @@
+// Plane cutting micro-benchmark example code
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+#include <cstring>
+#include <vector>
+#include <algorithm>
+using namespace std;
+
+#include "voro++.hh"
+using namespace voro;
+
+// The number of cells to construct in each timing, the number of repetitions
+// of each timing, and an optional string that the names of the benchmarks to
+// run must contain
+int iters=20000,reps=5;
+const char *filter=NULL;
+
+// A plane cut, given by the position of the neighboring particle relative to
+// the cell's particle, which is sorted by distance
+struct cut {
+	double x,y,z,rsq;
+	bool operator<(const cut &c) const {return rsq<c.rsq;}
+};
+
+// The sets of planes that are tested
+vector<cut> planes;
+
+// This function returns a random double between 0 and 1
+double rnd() {return double(rand())/RAND_MAX;}
+
+// Adds a plane to the current set, if it is within a given distance
+void add_plane(double x,double y,double z,double rmax) {
+	cut c;
+	c.x=x;c.y=y;c.z=z;c.rsq=x*x+y*y+z*z;
+	if(c.rsq>1e-12&&c.rsq<rmax*rmax) planes.push_back(c);
+}
+
+// Sets up the planes from randomly positioned particles in the cube [-1,1]^3.
+// These make mostly order three vertices, as in a typical computation.
+void setup_random() {
+	planes.clear();
+	srand(1);
+	for(int i=0;i<200;i++) add_plane(2*rnd()-1,2*rnd()-1,2*rnd()-1,2);
+}
+
+// Sets up the planes from the particles of a face-centered cubic lattice with
+// unit lattice constant, whose Voronoi cell is a rhombic dodecahedron with
+// order four vertices. If the perturbation is non-zero, then each particle is
+// displaced by a random amount of that size, so that the vertices are near to
+// degenerate and the cuts have to decide which side of the plane they are on.
+void setup_fcc(double pert) {
+	planes.clear();
+	srand(2);
+	for(int k=-4;k<=4;k++) for(int j=-4;j<=4;j++) for(int i=-4;i<=4;i++)
+		if(((i+j+k)&1)==0) add_plane(0.5*i+pert*(2*rnd()-1),0.5*j+pert*(2*rnd()-1),0.5*k+pert*(2*rnd()-1),1.8);
+}
+
+// Sets up the planes from the particles of a body-centered cubic lattice with
+// unit lattice constant, whose Voronoi cell is a truncated octahedron
+void setup_bcc() {
+	planes.clear();
+	for(int k=-4;k<=4;k++) for(int j=-4;j<=4;j++) for(int i=-4;i<=4;i++)
+		if((i&1)==(j&1)&&(j&1)==(k&1)) add_plane(0.5*i,0.5*j,0.5*k,1.8);
+}
+
+// Returns whether a benchmark should be run
+bool selected(const char *name) {
+	return filter==NULL||strstr(name,filter)!=NULL;
+}
+
+// Times the construction of a cell from a given starting shape, cut by the
+// current set of planes in order of distance. The timings are reported in
+// nanoseconds per cut and per cell, and the volume of the cell is given as a
+// checksum.
+template<class v_cell>
+void bench_planes(const char *pname,const char *vname,bool octahedron) {
+	char name[64];
+	sprintf(name,"%s_%s",pname,octahedron?"octahedron":"cube");
+	if(!selected(name)) return;
+	v_cell c;
+	int i,l,np=planes.size();
+	double t0,t,tmin=large_number,tsum=0,ncut=double(iters)*np;
+	for(l=0;l<reps;l++) {
+		t0=voro_wtime();
+		for(i=0;i<iters;i++) {
+			if(octahedron) c.init_octahedron(2);
+			else c.init(-1,1,-1,1,-1,1);
+			for(vector<cut>::iterator cp=planes.begin();cp!=planes.end();cp++)
+				c.nplane(cp->x,cp->y,cp->z,cp->rsq,0);
+		}
+		t=voro_wtime()-t0;
+		tsum+=t;
+		if(t<tmin) tmin=t;
+	}
+	printf("%s %s %d %d %d %.3f %.3f %.3f %.12g\n",name,vname,np,iters,reps,
+	       1e9*tmin/ncut,1e9*tsum/(reps*ncut),1e9*tmin/iters,c.volume());
+	fflush(stdout);
+}
+
+// Runs the benchmarks for the current set of planes, using both starting
+// shapes and both Voronoi cell classes
+void bench_set(const char *pname) {
+	sort(planes.begin(),planes.end());
+	for(int o=0;o<2;o++) {
+		bench_planes<voronoicell>(pname,"voronoicell",o==1);
+		bench_planes<voronoicell_neighbor>(pname,"voronoicell_neighbor",o==1);
+	}
+}
+
+int main(int argc,char **argv) {
+
+	// Read the command-line options
+	for(int i=1;i<argc;i++) {
+		if(i+1<argc&&strcmp(argv[i],"-i")==0) iters=atoi(argv[++i]);
+		else if(i+1<argc&&strcmp(argv[i],"-r")==0) reps=atoi(argv[++i]);
+		else if(i+1<argc&&strcmp(argv[i],"-f")==0) filter=argv[++i];
+		else {
+			fputs("Usage: plane_bench [-i iterations] [-r repetitions] [-f filter]\n",stderr);
+			return VOROPP_CMD_LINE_ERROR;
+		}
+	}
+	if(iters<1||reps<1) {
+		fputs("The number of iterations and repetitions must be positive\n",stderr);
+		return VOROPP_CMD_LINE_ERROR;
+	}
+	puts("# name cell planes iterations reps min_ns_per_cut mean_ns_per_cut min_ns_per_cell volume");
+
+	// Time each set of planes
+	setup_random();bench_set("random");
+	setup_fcc(0);bench_set("fcc");
+	setup_bcc();bench_set("bcc");
+	setup_fcc(1e-11);bench_set("near_degenerate");
+}
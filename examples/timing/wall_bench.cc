@@ -0,0 +1,63 @@
+// Wall dispatch timing test example code
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+#include <ctime>
+using namespace std;
+
+#include "voro++.hh"
+using namespace voro;
+
+// The number of repetitions of each timing
+const int reps=5;
+
+// This function returns a random double between 0 and 1
+double rnd() {return double(rand())/RAND_MAX;}
+
+// Computes all of the Voronoi cells in the container several times, and
+// prints the minimum time taken and the total volume
+void time_cells(container &con,const char *name) {
+	voronoicell c(con);
+	double vol=0,t,tmin=1e30;
+	for(int r=0;r<reps;r++) {
+		vol=0;
+		clock_t start=clock();
+		c_loop_all vl(con);
+		if(vl.start()) do if(con.compute_cell(c,vl)) vol+=c.volume();while(vl.inc());
+		t=double(clock()-start)/CLOCKS_PER_SEC;
+		if(t<tmin) tmin=t;
+	}
+	printf("%-22s %8.3f s   volume %.12g\n",name,tmin,vol);
+}
+
+// Adds the particles to a container, using the same random sequence each time
+void fill(container &con,int particles) {
+	srand(1);
+	for(int i=0;i<particles;i++) {
+		double x=2*rnd()-1,y=2*rnd()-1,z=2*rnd()-1;
+		if(x*x+y*y<1&&z*z<0.81) con.put(i,x,y,z);
+	}
+}
+
+int main(int argc,char **argv) {
+	int particles=argc>1?atoi(argv[1]):200000,n=int(pow(particles/5.0,1/3.0))+1;
+
+	// A cylinder along the z axis, capped by two planes
+	wall_cylinder cyl(0,0,0,0,0,1,1);
+	wall_plane pl(0,0,1,0.9),pu(0,0,-1,0.9);
+
+	// Apply the walls through the virtual wall interface, one at a time
+	container con(-1,1,-1,1,-1,1,n,n,n,false,false,false,8);
+	con.add_wall(cyl);con.add_wall(pl);con.add_wall(pu);
+	fill(con,particles);
+	time_cells(con,"Wall list");
+
+	// Apply the same walls as a single statically dispatched set
+	container con2(-1,1,-1,1,-1,1,n,n,n,false,false,false,8);
+	wall_set<wall_cylinder,wall_plane,wall_plane> ws(cyl,pl,pu);
+	con2.add_wall(ws);
+	fill(con2,particles);
+	time_cells(con2,"Wall set");
+}
@@ -0,0 +1,68 @@
+// Worklist timing test example code
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+#include <ctime>
+using namespace std;
+
+#include "voro++.cc"
+using namespace voro;
+
+// Set the number of particles that are going to be randomly introduced
+const int particles=100000;
+
+// This function returns a random double between 0 and 1
+double rnd() {return double(rand())/RAND_MAX;}
+
+// Computes all of the Voronoi cells in the container using a given set of
+// worklists, and prints the time taken and the total volume. Since the
+// container is periodic, the search mask must cover 2n+1 blocks in each
+// direction.
+template<class w_class>
+void time_worklist(container &con,const char *name) {
+	voro_compute<container,w_class> vcl(con,2*con.nx+1,2*con.ny+1,2*con.nz+1);
+	voronoicell c(con);
+	c_loop_all vl(con);
+	double vol=0;
+	clock_t start=clock();
+	if(vl.start()) do if(con.compute_cell(c,vl,vcl)) vol+=c.volume();
+	while(vl.inc());
+	double runtime=double(clock()-start)/CLOCKS_PER_SEC;
+	printf("%-24s %8.4f s  (volume %.8f)\n",name,runtime,vol);
+}
+
+int main(int argc,char **argv) {
+	int i;double x,y,z;
+
+	// Read the block aspect ratio and the number of particles per block
+	// from the command line
+	double asp=argc>1?atof(argv[1]):1,ppb=argc>2?atof(argv[2]):5.6;
+	if(asp<=0||ppb<=0) {
+		fputs("Syntax: ./worklist_test [aspect] [particles_per_block]\n",stderr);
+		return 1;
+	}
+
+	// Create a periodic unit cube, divided into blocks that are elongated
+	// in the z direction by the given aspect ratio
+	double bs=pow(ppb/(particles*asp),1/3.0);
+	int n_xy=int(1/bs+0.5),n_z=int(1/(bs*asp)+0.5);
+	if(n_xy<1) n_xy=1;
+	if(n_z<1) n_z=1;
+	container con(0,1,0,1,0,1,n_xy,n_xy,n_z,true,true,true,8);
+	printf("Grid %d x %d x %d, %g particles per block\n",
+	       n_xy,n_xy,n_z,double(particles)/(n_xy*n_xy*n_z));
+
+	// Randomly add particles into the container
+	for(i=0;i<particles;i++) {
+		x=rnd();y=rnd();z=rnd();
+		con.put(i,x,y,z);
+	}
+
+	// Time each of the sets of worklists
+	time_worklist<worklist_variant<4,64> >(con,"worklist_variant<4,64>");
+	time_worklist<worklist_variant<2,32> >(con,"worklist_variant<2,32>");
+	time_worklist<worklist_variant<4,128> >(con,"worklist_variant<4,128>");
+	time_worklist<worklist_variant<8,64> >(con,"worklist_variant<8,64>");
+}
@@ -0,0 +1,4600 @@
+// id 15
+sphere{<-2.37703,-4.95994,0.49996>,s}
+// id 16
+sphere{<-1.1347,-5.38168,0.499961>,s}
+// id 47
+sphere{<-1.76846,-5.20793,1.2537>,s}
+// id 49
+sphere{<0.855995,-5.4331,0.499546>,s}
+// id 63
+sphere{<-0.602787,-5.14796,1.31423>,s}
+// id 89
+sphere{<-0.141563,-5.4986,0.499466>,s}
+// id 45
+sphere{<1.82546,-5.18862,0.499553>,s}
+// id 54
+sphere{<2.69509,-4.69494,0.499821>,s}
+// id 3
+sphere{<-4.28658,-3.44618,0.499778>,s}
+// id 41
+sphere{<-3.28664,-3.44952,0.499464>,s}
+// id 74
+sphere{<-3.23586,-4.44796,0.49898>,s}
+// id 86
+sphere{<-3.79381,-3.98232,1.18476>,s}
+// id 103
+sphere{<-3.36125,-2.86864,1.30942>,s}
+// id 6
+sphere{<-1.51359,-4.45588,0.499597>,s}
+// id 115
+sphere{<-2.42896,-2.93541,0.499513>,s}
+// id 112
+sphere{<-2.37235,-3.94375,0.499431>,s}
+// id 116
+sphere{<-0.964098,-4.0676,1.23937>,s}
+// id 127
+sphere{<-1.49924,-3.45604,0.499746>,s}
+// id 1
+sphere{<-0.521073,-4.57394,0.499544>,s}
+// id 31
+sphere{<0.171862,-4.51742,1.2177>,s}
+// id 68
+sphere{<0.862767,-4.43313,0.49987>,s}
+// id 77
+sphere{<0.5027,-3.49672,0.499573>,s}
+// id 113
+sphere{<-0.506294,-3.57452,0.499605>,s}
+// id 123
+sphere{<-0.872995,-3.05694,1.27225>,s}
+// id 7
+sphere{<1.50869,-3.2433,0.49969>,s}
+// id 12
+sphere{<2.69722,-3.68791,0.498977>,s}
+// id 69
+sphere{<2.29679,-2.94798,1.03904>,s}
+// id 140
+sphere{<1.83249,-4.18907,0.499471>,s}
+// id 11
+sphere{<3.56009,-4.19273,0.499775>,s}
+// id 25
+sphere{<4.55951,-3.07613,0.499766>,s}
+// id 61
+sphere{<4.09863,-3.66926,1.15971>,s}
+// id 99
+sphere{<3.54678,-3.16065,0.499376>,s}
+// id 46
+sphere{<-4.84011,-2.61355,0.499391>,s}
+// id 70
+sphere{<-5.34931,-1.27904,0.499779>,s}
+// id 104
+sphere{<-5.12793,-1.9905,1.22593>,s}
+// id 33
+sphere{<-4.44095,-1.69688,0.499854>,s}
+// id 29
+sphere{<-3.02487,-1.96459,0.499717>,s}
+// id 44
+sphere{<-3.60426,-1.14955,0.499457>,s}
+// id 107
+sphere{<-3.84361,-2.53846,0.499269>,s}
+// id 180
+sphere{<-3.85159,-1.91193,1.2785>,s}
+// id 217
+sphere{<-3.02441,-1.35009,1.28827>,s}
+// id 137
+sphere{<-1.18773,-2.5059,0.499661>,s}
+// id 155
+sphere{<-2.02512,-1.9599,0.499284>,s}
+// id 183
+sphere{<-1.03396,-1.51752,0.499707>,s}
+// id 186
+sphere{<-2.52265,-2.32509,1.2859>,s}
+// id 198
+sphere{<-1.87184,-0.971737,0.499917>,s}
+// id 59
+sphere{<-0.195097,-2.62459,0.499695>,s}
+// id 26
+sphere{<0.00459518,-1.64505,0.499049>,s}
+// id 148
+sphere{<0.800728,-2.5376,0.499521>,s}
+// id 179
+sphere{<0.41693,-2.07803,1.30014>,s}
+// id 219
+sphere{<0.857345,-0.960962,1.27829>,s}
+// id 236
+sphere{<-0.589495,-2.0521,1.21835>,s}
+// id 52
+sphere{<1.02718,-1.56384,0.49951>,s}
+// id 93
+sphere{<2.43303,-1.08116,0.499731>,s}
+// id 110
+sphere{<1.77486,-1.35103,1.20246>,s}
+// id 152
+sphere{<1.98334,-2.03112,0.499785>,s}
+// id 207
+sphere{<2.70371,-1.7205,1.2191>,s}
+// id 223
+sphere{<1.45936,-2.4422,1.2456>,s}
+// id 40
+sphere{<3.35432,-1.48103,0.499423>,s}
+// id 23
+sphere{<2.91987,-2.38163,0.499845>,s}
+// id 28
+sphere{<4.45847,-1.3819,0.49914>,s}
+// id 91
+sphere{<3.98143,-2.26035,0.498906>,s}
+// id 201
+sphere{<3.92746,-1.6628,1.29833>,s}
+// id 5
+sphere{<5.0443,-2.1923,0.499238>,s}
+// id 10
+sphere{<5.40035,-1.03689,0.499974>,s}
+// id 105
+sphere{<5.25365,-1.62763,1.29715>,s}
+// id 13
+sphere{<-5.49711,-0.174843,0.499597>,s}
+// id 64
+sphere{<-5.43787,0.827002,0.499642>,s}
+// id 18
+sphere{<-4.58189,0.310654,0.498659>,s}
+// id 20
+sphere{<-3.69692,-0.154072,0.498971>,s}
+// id 71
+sphere{<-2.78825,-0.571577,0.499853>,s}
+// id 81
+sphere{<-4.54156,-0.689513,0.499675>,s}
+// id 83
+sphere{<-2.91173,0.464715,0.499622>,s}
+// id 172
+sphere{<-3.64964,0.534825,1.22199>,s}
+// id 79
+sphere{<-1.24225,-0.194837,0.499907>,s}
+// id 173
+sphere{<-1.94452,0.470277,0.753188>,s}
+// id 258
+sphere{<-1.90399,-0.368201,1.29654>,s}
+// id 78
+sphere{<-0.397436,-0.729649,0.499659>,s}
+// id 114
+sphere{<0.910792,0.519158,0.499699>,s}
+// id 130
+sphere{<-0.872997,0.779134,1.17351>,s}
+// id 142
+sphere{<0.551349,-0.413952,0.499532>,s}
+// id 178
+sphere{<-0.308973,0.303098,0.499143>,s}
+// id 192
+sphere{<-0.645365,-0.187632,1.3023>,s}
+// id 234
+sphere{<0.206848,0.875366,1.13611>,s}
+// id 121
+sphere{<1.51258,-0.68956,0.499931>,s}
+// id 134
+sphere{<2.68964,0.837457,0.498534>,s}
+// id 144
+sphere{<1.89074,0.236133,0.499746>,s}
+// id 181
+sphere{<2.17081,-0.432935,1.216>,s}
+// id 202
+sphere{<1.31575,0.0782367,1.30216>,s}
+// id 56
+sphere{<3.65234,0.384218,0.499724>,s}
+// id 92
+sphere{<3.82739,-0.600439,0.499593>,s}
+// id 117
+sphere{<3.90344,0.927548,1.31151>,s}
+// id 128
+sphere{<2.81076,-0.155433,0.499686>,s}
+// id 204
+sphere{<3.11004,-0.807072,1.1966>,s}
+// id 209
+sphere{<3.05794,0.379957,1.30709>,s}
+// id 36
+sphere{<5.47091,0.563443,0.4997>,s}
+// id 38
+sphere{<5.49558,-0.237634,1.09708>,s}
+// id 88
+sphere{<4.70319,-0.118489,0.499211>,s}
+// id 101
+sphere{<4.80271,0.448941,1.31595>,s}
+// id 177
+sphere{<4.6631,-0.766684,1.25936>,s}
+// id 75
+sphere{<-5.04754,2.18498,0.499631>,s}
+// id 118
+sphere{<-5.28653,1.51865,1.20533>,s}
+// id 19
+sphere{<-3.56664,1.22117,0.499818>,s}
+// id 22
+sphere{<-4.04774,2.20147,0.499356>,s}
+// id 55
+sphere{<-4.56258,1.3105,0.499844>,s}
+// id 129
+sphere{<-3.05518,2.08031,0.499607>,s}
+// id 8
+sphere{<-2.40006,1.32343,0.499272>,s}
+// id 106
+sphere{<-1.44024,2.29588,0.498391>,s}
+// id 145
+sphere{<-1.40061,1.29608,0.499649>,s}
+// id 168
+sphere{<-2.16166,2.04846,1.14425>,s}
+// id 100
+sphere{<0.083243,1.86534,1.20283>,s}
+// id 131
+sphere{<0.697119,1.49608,0.499974>,s}
+// id 139
+sphere{<-0.43878,2.3476,0.499598>,s}
+// id 166
+sphere{<0.551607,2.48544,0.499958>,s}
+// id 164
+sphere{<-0.402103,1.34731,0.499002>,s}
+// id 171
+sphere{<-0.915929,1.82887,1.20844>,s}
+// id 96
+sphere{<1.50816,2.19415,0.499608>,s}
+// id 156
+sphere{<1.76854,1.22864,0.499974>,s}
+// id 175
+sphere{<2.57737,1.83345,0.499381>,s}
+// id 222
+sphere{<1.17495,1.06846,1.29207>,s}
+// id 233
+sphere{<2.00897,1.78345,1.32017>,s}
+// id 53
+sphere{<4.48767,0.933718,0.499959>,s}
+// id 51
+sphere{<4.35939,1.93603,0.499296>,s}
+// id 98
+sphere{<3.42072,2.37057,0.499275>,s}
+// id 95
+sphere{<3.78273,1.92218,1.31538>,s}
+// id 120
+sphere{<3.53125,1.37676,0.499328>,s}
+// id 151
+sphere{<2.80632,2.40475,1.28751>,s}
+// id 147
+sphere{<2.94514,1.3763,1.30878>,s}
+// id 62
+sphere{<5.27921,1.54462,0.49951>,s}
+// id 125
+sphere{<5.02767,2.23054,1.18212>,s}
+// id 30
+sphere{<-4.56859,3.06249,0.4996>,s}
+// id 67
+sphere{<-3.29813,4.40155,0.499707>,s}
+// id 82
+sphere{<-3.44349,3.0018,0.499358>,s}
+// id 146
+sphere{<-3.98999,3.78561,0.875543>,s}
+// id 165
+sphere{<-3.01799,3.51862,1.24177>,s}
+// id 21
+sphere{<-2.44959,3.8727,0.499562>,s}
+// id 43
+sphere{<-2.44599,2.87286,0.499691>,s}
+// id 57
+sphere{<-1.5408,4.28952,0.499684>,s}
+// id 109
+sphere{<-1.53752,3.29037,0.499478>,s}
+// id 191
+sphere{<-1.01085,2.83924,1.21957>,s}
+// id 203
+sphere{<-1.01582,3.83908,1.22154>,s}
+// id 37
+sphere{<0.447697,4.48069,0.499409>,s}
+// id 9
+sphere{<-0.54241,4.34259,0.499268>,s}
+// id 76
+sphere{<-0.534808,3.34276,0.499094>,s}
+// id 135
+sphere{<0.455587,3.48077,0.499929>,s}
+// id 14
+sphere{<1.43187,4.30573,0.499423>,s}
+// id 17
+sphere{<2.3065,2.79606,0.499979>,s}
+// id 58
+sphere{<2.36843,3.95564,0.499022>,s}
+// id 66
+sphere{<1.44016,3.30584,0.499889>,s}
+// id 169
+sphere{<1.72134,2.79328,1.31104>,s}
+// id 239
+sphere{<2.53883,3.3683,1.2893>,s}
+// id 35
+sphere{<4.08695,3.68136,0.49981>,s}
+// id 34
+sphere{<3.15015,3.33264,0.499367>,s}
+// id 48
+sphere{<3.24714,4.4394,0.499143>,s}
+// id 157
+sphere{<3.92733,2.93755,1.14863>,s}
+// id 195
+sphere{<3.48735,3.86286,1.27916>,s}
+// id 50
+sphere{<4.68586,2.88067,0.49982>,s}
+// id 32
+sphere{<-1.51527,5.28822,0.499741>,s}
+// id 65
+sphere{<-2.44687,4.92591,0.499485>,s}
+// id 72
+sphere{<-1.00567,4.83883,1.23327>,s}
+// id 2
+sphere{<-0.533211,5.47426,0.49974>,s}
+// id 24
+sphere{<0.466431,5.4804,0.499476>,s}
+// id 39
+sphere{<1.45078,5.30543,0.499476>,s}
+// id 60
+sphere{<2.38727,4.95514,0.499809>,s}
+// id 102
+sphere{<-2.81967,-4.72231,1.36506>,s}
+// id 185
+sphere{<-1.21674,-5.36394,2.07317>,s}
+// id 221
+sphere{<-2.23856,-5.02398,2.12001>,s}
+// id 119
+sphere{<0.358411,-5.48857,1.36496>,s}
+// id 208
+sphere{<-0.228725,-5.49525,2.17413>,s}
+// id 240
+sphere{<0.855589,-5.43338,2.23041>,s}
+// id 4
+sphere{<2.29265,-4.99948,1.36302>,s}
+// id 73
+sphere{<1.34612,-5.33294,1.36498>,s}
+// id 252
+sphere{<2.73439,-4.77281,2.23077>,s}
+// id 269
+sphere{<1.82513,-5.18879,2.23034>,s}
+// id 133
+sphere{<-4.69291,-2.86912,2.53529>,s}
+// id 174
+sphere{<-4.20615,-3.54473,1.98275>,s}
+// id 235
+sphere{<-2.84314,-3.72268,1.35296>,s}
+// id 267
+sphere{<-3.41776,-4.30917,2.05178>,s}
+// id 200
+sphere{<-1.95501,-4.22011,1.36496>,s}
+// id 250
+sphere{<-1.97841,-3.22061,1.34504>,s}
+// id 276
+sphere{<-2.44233,-4.02781,2.21639>,s}
+// id 278
+sphere{<-1.45407,-4.4025,2.21078>,s}
+// id 281
+sphere{<-2.76063,-3.04934,2.08726>,s}
+// id 332
+sphere{<-1.81361,-3.259,2.3301>,s}
+// id 90
+sphere{<-0.00115515,-3.54328,1.36184>,s}
+// id 232
+sphere{<-0.470311,-4.48638,2.0522>,s}
+// id 243
+sphere{<-0.890131,-3.58154,2.12308>,s}
+// id 273
+sphere{<0.671292,-4.46206,2.08181>,s}
+// id 341
+sphere{<0.0770345,-3.70271,2.34568>,s}
+// id 182
+sphere{<2.29847,-3.9949,1.36292>,s}
+// id 211
+sphere{<1.35757,-4.33327,1.36684>,s}
+// id 224
+sphere{<1.01188,-3.39528,1.354>,s}
+// id 285
+sphere{<1.84217,-4.18924,2.2311>,s}
+// id 292
+sphere{<1.0674,-3.5664,2.33753>,s}
+// id 295
+sphere{<1.91387,-3.24349,1.91424>,s}
+// id 325
+sphere{<2.7514,-3.77366,2.22725>,s}
+// id 372
+sphere{<2.54843,-2.87004,2.60292>,s}
+// id 97
+sphere{<3.16082,-4.5011,1.36317>,s}
+// id 184
+sphere{<3.14299,-3.45944,1.36359>,s}
+// id 205
+sphere{<3.74461,-4.0284,2.02316>,s}
+// id 262
+sphere{<4.41778,-3.27694,2.02221>,s}
+// id 271
+sphere{<3.48462,-3.10257,2.33463>,s}
+// id 237
+sphere{<-5.3116,-1.42767,2.0317>,s}
+// id 87
+sphere{<-4.51653,-2.03368,2.01554>,s}
+// id 126
+sphere{<-4.35587,-2.7778,1.35873>,s}
+// id 143
+sphere{<-4.54882,-1.18814,1.36625>,s}
+// id 256
+sphere{<-3.81307,-1.32734,2.08875>,s}
+// id 286
+sphere{<-3.76951,-2.6722,2.20036>,s}
+// id 304
+sphere{<-3.05731,-1.98499,2.05924>,s}
+// id 242
+sphere{<-2.03359,-1.45653,1.36265>,s}
+// id 246
+sphere{<-1.06227,-2.60378,2.25535>,s}
+// id 247
+sphere{<-1.53178,-2.31943,1.41969>,s}
+// id 296
+sphere{<-2.10733,-2.30769,2.23727>,s}
+// id 306
+sphere{<-1.11458,-1.06576,1.38801>,s}
+// id 329
+sphere{<-1.35795,-1.6502,2.16186>,s}
+// id 359
+sphere{<-2.29159,-1.32847,2.31966>,s}
+// id 218
+sphere{<-0.119608,-1.15488,1.36092>,s}
+// id 245
+sphere{<-0.149934,-2.68639,1.85492>,s}
+// id 277
+sphere{<0.839082,-2.65295,2.00089>,s}
+// id 293
+sphere{<0.408519,-1.10093,2.20768>,s}
+// id 289
+sphere{<-0.361965,-1.73458,2.1387>,s}
+// id 255
+sphere{<2.41979,-1.10673,1.95567>,s}
+// id 257
+sphere{<2.07534,-2.04498,1.92558>,s}
+// id 317
+sphere{<1.13634,-1.7052,1.88537>,s}
+// id 149
+sphere{<3.8267,-2.72999,1.36726>,s}
+// id 194
+sphere{<4.0426,-2.2791,2.23267>,s}
+// id 238
+sphere{<2.90965,-2.5574,1.72523>,s}
+// id 313
+sphere{<4.52476,-1.36985,2.04438>,s}
+// id 336
+sphere{<3.26437,-1.67956,2.04608>,s}
+// id 108
+sphere{<4.82277,-2.64458,1.36248>,s}
+// id 260
+sphere{<5.03966,-2.20511,2.2336>,s}
+// id 80
+sphere{<-5.45196,-0.730625,1.32933>,s}
+// id 84
+sphere{<-5.49027,0.327129,1.36432>,s}
+// id 132
+sphere{<-5.49566,-0.230856,2.19414>,s}
+// id 228
+sphere{<-4.65545,0.309335,2.22774>,s}
+// id 94
+sphere{<-4.60061,0.809143,1.3641>,s}
+// id 167
+sphere{<-3.7166,-0.634412,1.37479>,s}
+// id 176
+sphere{<-4.61191,-0.190322,1.36314>,s}
+// id 196
+sphere{<-4.60783,-0.689468,2.23085>,s}
+// id 214
+sphere{<-2.85159,-0.0532938,1.35256>,s}
+// id 280
+sphere{<-3.03091,-0.69299,2.09952>,s}
+// id 375
+sphere{<-3.69414,0.0551836,2.09801>,s}
+// id 311
+sphere{<-1.5588,-0.661034,2.18817>,s}
+// id 312
+sphere{<-2.27062,0.37924,2.04193>,s}
+// id 323
+sphere{<-1.28442,0.26368,1.92472>,s}
+// id 226
+sphere{<0.343692,-0.116951,1.43137>,s}
+// id 248
+sphere{<-0.270672,0.49568,1.92795>,s}
+// id 283
+sphere{<0.841348,0.520981,2.06272>,s}
+// id 315
+sphere{<-0.56359,-0.754608,2.16229>,s}
+// id 322
+sphere{<0.24044,-0.156324,2.48694>,s}
+// id 206
+sphere{<1.52898,-0.652494,1.95061>,s}
+// id 215
+sphere{<2.73558,0.846698,2.13011>,s}
+// id 287
+sphere{<2.13461,0.791441,1.32774>,s}
+// id 308
+sphere{<1.91921,0.269837,2.15203>,s}
+// id 159
+sphere{<4.62404,-0.22467,2.09833>,s}
+// id 189
+sphere{<3.94945,-0.0710126,1.33878>,s}
+// id 251
+sphere{<3.71344,-0.788035,1.99377>,s}
+// id 279
+sphere{<3.6352,0.392542,2.16721>,s}
+// id 288
+sphere{<4.56189,0.763987,2.23371>,s}
+// id 340
+sphere{<2.84056,-0.20894,2.08502>,s}
+// id 163
+sphere{<5.43529,-0.843301,1.88981>,s}
+// id 220
+sphere{<5.49389,0.261205,2.01374>,s}
+// id 27
+sphere{<-4.82757,2.6359,1.36596>,s}
+// id 158
+sphere{<-5.12672,1.99237,2.07084>,s}
+// id 266
+sphere{<-5.40268,1.03009,2.06999>,s}
+// id 138
+sphere{<-4.32711,1.77063,1.35756>,s}
+// id 161
+sphere{<-3.89698,2.12527,2.21074>,s}
+// id 188
+sphere{<-3.80006,2.64251,1.36123>,s}
+// id 199
+sphere{<-2.83516,2.61189,1.62135>,s}
+// id 210
+sphere{<-4.43767,1.28498,2.22735>,s}
+// id 254
+sphere{<-3.43724,1.02102,2.06954>,s}
+// id 264
+sphere{<-3.32857,1.76145,1.40666>,s}
+// id 294
+sphere{<-3.01262,2.4057,2.58344>,s}
+// id 197
+sphere{<-2.73697,0.942909,1.36024>,s}
+// id 225
+sphere{<-1.75195,1.18185,1.42877>,s}
+// id 274
+sphere{<-1.57273,2.35653,1.89076>,s}
+// id 324
+sphere{<-1.80018,1.19754,2.42729>,s}
+// id 344
+sphere{<-2.53651,1.73423,2.01617>,s}
+// id 213
+sphere{<0.34547,2.66726,1.73908>,s}
+// id 298
+sphere{<-0.882121,1.27787,2.03995>,s}
+// id 319
+sphere{<0.534959,1.47077,2.00297>,s}
+// id 320
+sphere{<-0.580296,2.40229,2.00875>,s}
+// id 328
+sphere{<-0.203588,1.71615,2.63042>,s}
+// id 122
+sphere{<1.04891,2.05648,1.37673>,s}
+// id 326
+sphere{<1.54791,2.22722,2.22614>,s}
+// id 330
+sphere{<1.7168,1.24832,2.11268>,s}
+// id 399
+sphere{<2.59878,1.83698,2.12563>,s}
+// id 124
+sphere{<4.56605,1.70539,1.89686>,s}
+// id 249
+sphere{<3.90423,2.38425,2.21321>,s}
+// id 358
+sphere{<3.57482,1.39018,2.1351>,s}
+// id 190
+sphere{<5.35198,1.27137,1.4581>,s}
+// id 263
+sphere{<5.32676,1.36995,2.45234>,s}
+// id 301
+sphere{<4.99387,2.30506,2.57283>,s}
+// id 303
+sphere{<-4.71955,2.82446,2.44624>,s}
+// id 150
+sphere{<-4.31691,3.40871,1.74212>,s}
+// id 244
+sphere{<-3.41766,3.2345,2.14315>,s}
+// id 300
+sphere{<-3.62865,4.13357,1.74012>,s}
+// id 154
+sphere{<-2.00129,4.09366,1.3654>,s}
+// id 162
+sphere{<-1.9972,3.09375,1.36526>,s}
+// id 284
+sphere{<-1.70199,4.47105,2.24144>,s}
+// id 314
+sphere{<-2.63466,3.85498,2.10167>,s}
+// id 334
+sphere{<-1.4349,3.52265,2.072>,s}
+// id 357
+sphere{<-2.22774,2.97078,2.33023>,s}
+// id 153
+sphere{<-0.0598664,4.50124,1.36022>,s}
+// id 231
+sphere{<-0.73394,4.29117,2.06762>,s}
+// id 230
+sphere{<-0.0550007,3.50171,1.36137>,s}
+// id 310
+sphere{<0.469655,3.92689,2.09878>,s}
+// id 349
+sphere{<-0.439923,3.35794,2.27278>,s}
+// id 371
+sphere{<0.511578,3.08276,2.63281>,s}
+// id 42
+sphere{<2.77513,4.62302,1.361>,s}
+// id 136
+sphere{<1.90213,4.13539,1.36468>,s}
+// id 193
+sphere{<0.941239,3.41594,1.37161>,s}
+// id 216
+sphere{<2.47316,3.88097,2.14481>,s}
+// id 212
+sphere{<0.942379,4.4159,1.36589>,s}
+// id 261
+sphere{<2.35266,2.80544,2.09399>,s}
+// id 265
+sphere{<1.5981,4.35086,2.29194>,s}
+// id 299
+sphere{<1.52496,3.35967,2.18157>,s}
+// id 241
+sphere{<3.28648,3.10376,1.8976>,s}
+// id 272
+sphere{<3.35116,4.36136,2.13516>,s}
+// id 282
+sphere{<4.08842,3.6794,2.05661>,s}
+// id 187
+sphere{<4.67365,2.89955,1.83536>,s}
+// id 170
+sphere{<-2.88231,4.68283,1.36545>,s}
+// id 85
+sphere{<-1.98712,5.12849,1.3668>,s}
+// id 229
+sphere{<-1.26973,5.3519,2.04968>,s}
+// id 253
+sphere{<-2.63162,4.83013,2.32179>,s}
+// id 111
+sphere{<-0.0336744,5.50035,1.36517>,s}
+// id 338
+sphere{<-0.318093,5.49085,2.3234>,s}
+// id 353
+sphere{<0.476657,4.9267,2.08848>,s}
+// id 141
+sphere{<1.92663,5.15175,1.3651>,s}
+// id 160
+sphere{<0.962473,5.41557,1.36482>,s}
+// id 259
+sphere{<1.3756,5.32539,2.27077>,s}
+// id 302
+sphere{<2.39467,4.95155,2.22528>,s}
+// id 396
+sphere{<-2.86352,-4.69635,2.82849>,s}
+// id 420
+sphere{<-1.70178,-5.23042,2.93723>,s}
+// id 486
+sphere{<-1.32084,-5.33917,3.85517>,s}
+// id 504
+sphere{<-2.35667,-4.96965,3.6459>,s}
+// id 376
+sphere{<-0.708132,-5.12958,2.97162>,s}
+// id 381
+sphere{<0.335564,-5.49012,3.08219>,s}
+// id 457
+sphere{<-0.333233,-5.4906,3.82497>,s}
+// id 510
+sphere{<0.650872,-4.76993,3.69999>,s}
+// id 352
+sphere{<1.34567,-5.33257,3.09578>,s}
+// id 384
+sphere{<2.28907,-5.00188,3.09597>,s}
+// id 275
+sphere{<-4.09596,-3.67174,3.81183>,s}
+// id 297
+sphere{<-3.87894,-3.89994,2.85778>,s}
+// id 339
+sphere{<-2.94693,-3.5471,2.93328>,s}
+// id 388
+sphere{<-3.90987,-2.94482,3.15195>,s}
+// id 475
+sphere{<-3.3814,-4.33924,3.60558>,s}
+// id 518
+sphere{<-3.05769,-3.01374,3.77164>,s}
+// id 318
+sphere{<-1.96103,-4.26177,3.06095>,s}
+// id 442
+sphere{<-2.18759,-2.95683,3.20661>,s}
+// id 459
+sphere{<-1.64198,-3.40809,3.91207>,s}
+// id 473
+sphere{<-1.14489,-3.19802,3.07069>,s}
+// id 522
+sphere{<-2.52383,-3.85915,3.78265>,s}
+// id 533
+sphere{<-1.29834,-4.34088,3.80546>,s}
+// id 397
+sphere{<-0.226384,-2.88393,2.83192>,s}
+// id 402
+sphere{<0.75214,-2.92219,3.03433>,s}
+// id 422
+sphere{<0.0943171,-4.53831,2.89441>,s}
+// id 443
+sphere{<-0.819278,-4.13604,2.95207>,s}
+// id 478
+sphere{<-0.654943,-3.56275,3.94184>,s}
+// id 489
+sphere{<0.149761,-3.65278,3.35535>,s}
+// id 514
+sphere{<-0.309844,-4.4914,3.80768>,s}
+// id 369
+sphere{<2.45417,-4.0177,3.14977>,s}
+// id 404
+sphere{<1.16404,-4.36075,2.94559>,s}
+// id 423
+sphere{<1.7553,-3.31492,3.01813>,s}
+// id 503
+sphere{<1.75422,-4.46267,3.74598>,s}
+// id 505
+sphere{<1.09694,-3.68059,3.67542>,s}
+// id 525
+sphere{<2.08769,-3.5427,3.94894>,s}
+// id 373
+sphere{<3.36111,-4.3535,2.88756>,s}
+// id 393
+sphere{<4.09436,-3.67237,2.88963>,s}
+// id 447
+sphere{<3.1963,-3.35639,3.25734>,s}
+// id 458
+sphere{<3.74235,-4.03068,3.75428>,s}
+// id 494
+sphere{<2.95084,-4.64149,3.75313>,s}
+// id 502
+sphere{<4.4101,-3.28658,3.75816>,s}
+// id 327
+sphere{<4.69159,-2.87038,2.89378>,s}
+// id 291
+sphere{<-5.42024,-0.935899,2.89913>,s}
+// id 309
+sphere{<-5.11916,-2.01111,2.8201>,s}
+// id 363
+sphere{<-4.80783,-2.6711,3.50853>,s}
+// id 424
+sphere{<-5.26224,-1.60055,3.71994>,s}
+// id 290
+sphere{<-3.93241,-1.97758,2.90058>,s}
+// id 333
+sphere{<-4.46727,-1.15789,3.10295>,s}
+// id 392
+sphere{<-3.03682,-2.53072,2.89632>,s}
+// id 407
+sphere{<-3.14853,-1.36057,2.83447>,s}
+// id 449
+sphere{<-4.29908,-1.84858,3.82189>,s}
+// id 454
+sphere{<-3.64288,-1.10541,3.66593>,s}
+// id 461
+sphere{<-3.32484,-2.05142,3.72514>,s}
+// id 370
+sphere{<-1.59485,-1.20733,3.02633>,s}
+// id 406
+sphere{<-2.34743,-1.85829,3.16535>,s}
+// id 456
+sphere{<-1.53537,-2.28672,3.56021>,s}
+// id 470
+sphere{<-1.88587,-1.43739,3.95469>,s}
+// id 365
+sphere{<0.456406,-1.99616,2.64992>,s}
+// id 378
+sphere{<-0.20895,-1.19188,2.98865>,s}
+// id 410
+sphere{<-0.734077,-2.04222,3.01438>,s}
+// id 433
+sphere{<0.907557,-1.01419,3.06967>,s}
+// id 446
+sphere{<0.147831,-2.29931,3.55098>,s}
+// id 476
+sphere{<0.332242,-1.35307,3.81393>,s}
+// id 491
+sphere{<-0.881151,-1.34293,3.71338>,s}
+// id 342
+sphere{<1.52948,-2.40004,2.68399>,s}
+// id 351
+sphere{<1.72061,-1.41931,2.64483>,s}
+// id 345
+sphere{<2.59799,-1.88445,2.76234>,s}
+// id 440
+sphere{<2.77822,-1.04986,3.28203>,s}
+// id 453
+sphere{<2.50846,-2.71078,3.58856>,s}
+// id 465
+sphere{<1.06955,-1.92952,3.43669>,s}
+// id 484
+sphere{<1.47662,-2.76469,3.8055>,s}
+// id 512
+sphere{<2.0505,-1.82241,3.59622>,s}
+// id 368
+sphere{<4.51389,-1.88663,3.02206>,s}
+// id 380
+sphere{<3.6586,-1.37898,2.91451>,s}
+// id 419
+sphere{<3.4313,-2.37455,3.01791>,s}
+// id 496
+sphere{<4.00301,-1.60161,3.83265>,s}
+// id 534
+sphere{<3.74792,-2.56165,3.9478>,s}
+// id 548
+sphere{<3.04112,-1.87035,3.78787>,s}
+// id 350
+sphere{<5.32394,-1.38195,2.72423>,s}
+// id 436
+sphere{<4.97113,-1.25774,3.65059>,s}
+// id 535
+sphere{<4.93827,-2.42151,3.75265>,s}
+// id 268
+sphere{<-4.70006,-0.185654,3.09456>,s}
+// id 337
+sphere{<-5.47924,0.47743,2.89985>,s}
+// id 395
+sphere{<-5.49355,-0.27266,3.69633>,s}
+// id 418
+sphere{<-4.70956,0.892537,3.46112>,s}
+// id 346
+sphere{<-3.4855,-0.426297,2.94905>,s}
+// id 360
+sphere{<-3.95517,0.663956,2.84652>,s}
+// id 394
+sphere{<-2.99312,0.416583,2.73211>,s}
+// id 480
+sphere{<-3.93468,0.0988683,3.67115>,s}
+// id 508
+sphere{<-2.99458,0.464791,3.73092>,s}
+// id 374
+sphere{<-1.67084,0.298995,2.84596>,s}
+// id 389
+sphere{<-2.66228,-0.923481,3.59015>,s}
+// id 408
+sphere{<-2.34003,-0.440351,2.77644>,s}
+// id 451
+sphere{<-2.13181,-0.0367933,3.66737>,s}
+// id 498
+sphere{<-1.16558,-0.417461,3.46388>,s}
+// id 511
+sphere{<-1.28827,0.535948,3.73841>,s}
+// id 356
+sphere{<0.144096,0.792137,2.78785>,s}
+// id 364
+sphere{<-0.707228,0.0644749,2.71738>,s}
+// id 427
+sphere{<-0.0926381,-0.297004,3.41887>,s}
+// id 450
+sphere{<0.697968,0.315726,3.4748>,s}
+// id 455
+sphere{<-0.21358,0.651439,3.71074>,s}
+// id 569
+sphere{<0.892345,-0.53788,3.95791>,s}
+// id 355
+sphere{<1.20827,-0.121809,2.73498>,s}
+// id 377
+sphere{<2.14014,-0.51559,2.72916>,s}
+// id 429
+sphere{<2.70323,0.279558,2.95218>,s}
+// id 482
+sphere{<1.77937,0.513103,3.25472>,s}
+// id 513
+sphere{<2.50505,-0.232007,3.78808>,s}
+// id 519
+sphere{<2.6128,0.80212,3.79954>,s}
+// id 527
+sphere{<1.75938,-0.866189,3.58412>,s}
+// id 270
+sphere{<4.49307,-0.82879,2.88418>,s}
+// id 361
+sphere{<3.42496,-0.407607,2.87161>,s}
+// id 366
+sphere{<4.25707,0.140524,2.95365>,s}
+// id 382
+sphere{<3.63178,0.921907,3.01606>,s}
+// id 463
+sphere{<3.98535,-0.608781,3.71667>,s}
+// id 520
+sphere{<3.39889,0.19916,3.66547>,s}
+// id 307
+sphere{<5.48596,-0.396388,2.78256>,s}
+// id 347
+sphere{<5.47044,0.570734,3.03569>,s}
+// id 411
+sphere{<4.91424,-0.261244,3.59131>,s}
+// id 479
+sphere{<4.6657,0.80191,3.58219>,s}
+// id 321
+sphere{<-5.28685,1.51696,2.93562>,s}
+// id 426
+sphere{<-4.94387,2.41078,3.32822>,s}
+// id 472
+sphere{<-5.24212,1.66479,3.92346>,s}
+// id 331
+sphere{<-4.25993,1.7146,3.11201>,s}
+// id 412
+sphere{<-3.29952,1.49848,2.93703>,s}
+// id 432
+sphere{<-3.07677,2.24178,3.56746>,s}
+// id 474
+sphere{<-3.85523,2.62818,3.07309>,s}
+// id 490
+sphere{<-3.76798,1.09864,3.72669>,s}
+// id 516
+sphere{<-3.99607,2.18079,3.95612>,s}
+// id 379
+sphere{<-1.17046,1.95729,2.71381>,s}
+// id 401
+sphere{<-2.15193,2.00616,2.89886>,s}
+// id 421
+sphere{<-2.42466,1.09262,3.2009>,s}
+// id 485
+sphere{<-1.54425,1.47716,3.50681>,s}
+// id 499
+sphere{<-1.38397,2.43856,3.74352>,s}
+// id 398
+sphere{<-0.814799,1.01705,3.0014>,s}
+// id 416
+sphere{<-0.421866,2.63926,2.96724>,s}
+// id 448
+sphere{<-0.612401,1.83841,3.53428>,s}
+// id 460
+sphere{<0.707157,2.10974,2.75417>,s}
+// id 481
+sphere{<0.328789,1.50989,3.45893>,s}
+// id 495
+sphere{<0.39774,2.67548,3.5389>,s}
+// id 316
+sphere{<1.08341,1.12313,2.87614>,s}
+// id 343
+sphere{<2.24789,2.29041,2.94453>,s}
+// id 385
+sphere{<2.30848,1.29129,2.91725>,s}
+// id 430
+sphere{<1.44578,1.8979,3.39402>,s}
+// id 488
+sphere{<1.12297,1.10722,3.91355>,s}
+// id 608
+sphere{<2.35271,1.76757,3.79496>,s}
+// id 414
+sphere{<3.16612,1.80417,2.94823>,s}
+// id 415
+sphere{<3.93628,2.38448,3.21217>,s}
+// id 428
+sphere{<4.41703,1.52273,2.86828>,s}
+// id 468
+sphere{<4.32652,1.7043,3.84693>,s}
+// id 501
+sphere{<3.35513,1.46819,3.87056>,s}
+// id 506
+sphere{<3.10168,2.42893,3.76041>,s}
+// id 400
+sphere{<5.24838,1.64601,3.40968>,s}
+// id 445
+sphere{<4.86667,2.56353,3.53022>,s}
+// id 362
+sphere{<-4.15369,3.60562,2.70867>,s}
+// id 383
+sphere{<-3.40525,4.31916,2.6962>,s}
+// id 435
+sphere{<-3.0549,3.45168,3.04933>,s}
+// id 434
+sphere{<-3.78891,3.987,3.55735>,s}
+// id 509
+sphere{<-4.44804,3.23653,3.59934>,s}
+// id 551
+sphere{<-3.50255,3.08772,3.88787>,s}
+// id 348
+sphere{<-1.37714,2.923,2.86945>,s}
+// id 386
+sphere{<-2.01992,3.77557,2.88622>,s}
+// id 405
+sphere{<-1.02393,3.85697,2.92008>,s}
+// id 417
+sphere{<-1.59054,4.41586,3.5252>,s}
+// id 441
+sphere{<-2.26617,2.90318,3.32683>,s}
+// id 444
+sphere{<-1.51548,3.4371,3.71591>,s}
+// id 500
+sphere{<-2.45544,3.92642,3.7736>,s}
+// id 227
+sphere{<-0.055133,4.44633,2.78534>,s}
+// id 431
+sphere{<0.917292,4.53813,2.99946>,s}
+// id 439
+sphere{<-0.12475,3.55851,3.23948>,s}
+// id 477
+sphere{<0.908921,3.61427,3.38056>,s}
+// id 521
+sphere{<-0.549332,2.96023,3.91831>,s}
+// id 560
+sphere{<-0.565219,4.37448,3.64235>,s}
+// id 335
+sphere{<2.26124,3.32128,2.94557>,s}
+// id 409
+sphere{<2.76895,4.38286,2.95702>,s}
+// id 425
+sphere{<1.3978,2.82213,3.01564>,s}
+// id 507
+sphere{<1.82798,4.17003,3.24783>,s}
+// id 526
+sphere{<1.16537,4.39363,3.96248>,s}
+// id 554
+sphere{<2.17684,2.80575,3.79811>,s}
+// id 354
+sphere{<4.50822,3.15061,2.79399>,s}
+// id 367
+sphere{<3.51201,3.70647,2.87316>,s}
+// id 403
+sphere{<3.10348,2.795,2.83036>,s}
+// id 413
+sphere{<4.16445,3.59292,3.62218>,s}
+// id 471
+sphere{<3.44672,4.2864,3.68499>,s}
+// id 483
+sphere{<2.96075,3.41308,3.65409>,s}
+// id 387
+sphere{<-0.965151,4.85354,2.86113>,s}
+// id 391
+sphere{<-1.91476,5.15653,2.93741>,s}
+// id 438
+sphere{<-2.75357,4.76138,3.31159>,s}
+// id 464
+sphere{<-1.27134,5.3512,3.67759>,s}
+// id 390
+sphere{<-0.347032,5.48951,3.32257>,s}
+// id 452
+sphere{<0.568339,5.47138,2.92142>,s}
+// id 517
+sphere{<0.308708,4.85284,3.72773>,s}
+// id 305
+sphere{<1.92734,5.15151,3.08622>,s}
+// id 487
+sphere{<1.17663,5.37276,3.70836>,s}
+// id 492
+sphere{<2.62408,4.8338,3.83745>,s}
+// id 544
+sphere{<-2.90884,-4.66843,4.42274>,s}
+// id 565
+sphere{<-1.99298,-5.12658,4.56396>,s}
+// id 528
+sphere{<-0.483922,-5.4788,4.81337>,s}
+// id 542
+sphere{<0.458111,-5.48175,4.43458>,s}
+// id 635
+sphere{<0.13538,-4.71262,4.9841>,s}
+// id 462
+sphere{<1.38428,-5.32351,4.09446>,s}
+// id 553
+sphere{<2.28111,-5.00476,4.40053>,s}
+// id 643
+sphere{<1.55663,-5.27561,5.07812>,s}
+// id 538
+sphere{<-3.29668,-3.74731,4.40758>,s}
+// id 601
+sphere{<-4.25531,-3.48476,4.78077>,s}
+// id 680
+sphere{<-3.38181,-2.92036,4.9627>,s}
+// id 702
+sphere{<-3.65258,-4.11215,5.27371>,s}
+// id 574
+sphere{<-2.41567,-3.19018,4.51771>,s}
+// id 581
+sphere{<-1.93703,-4.12864,4.5449>,s}
+// id 595
+sphere{<-1.18603,-3.51786,4.79434>,s}
+// id 654
+sphere{<-2.68306,-3.88387,5.18614>,s}
+// id 573
+sphere{<0.410368,-4.02097,4.3172>,s}
+// id 606
+sphere{<0.168244,-3.05824,4.20091>,s}
+// id 610
+sphere{<-0.826661,-4.55171,4.66164>,s}
+// id 641
+sphere{<0.501712,-2.82706,5.11431>,s}
+// id 642
+sphere{<-0.255276,-3.79387,5.03192>,s}
+// id 640
+sphere{<-0.486822,-2.82378,4.96334>,s}
+// id 716
+sphere{<0.701868,-3.94195,5.27935>,s}
+// id 594
+sphere{<1.26883,-4.43499,4.61962>,s}
+// id 593
+sphere{<1.18805,-3.3582,4.61756>,s}
+// id 618
+sphere{<2.39931,-4.07112,4.73856>,s}
+// id 682
+sphere{<2.12946,-3.11442,4.85057>,s}
+// id 530
+sphere{<3.04444,-3.49508,4.23556>,s}
+// id 557
+sphere{<3.34921,-4.363,4.62702>,s}
+// id 648
+sphere{<4.08421,-3.68365,4.62758>,s}
+// id 703
+sphere{<3.73829,-2.79853,4.93961>,s}
+// id 768
+sphere{<3.10627,-3.51506,5.23329>,s}
+// id 541
+sphere{<4.68469,-2.88404,4.63117>,s}
+// id 536
+sphere{<-5.00533,-2.27971,4.40712>,s}
+// id 568
+sphere{<-5.4209,-0.931534,4.44505>,s}
+// id 644
+sphere{<-5.18436,-1.83674,5.28558>,s}
+// id 742
+sphere{<-4.75835,-2.75867,5.2491>,s}
+// id 529
+sphere{<-3.94918,-2.7348,4.12863>,s}
+// id 540
+sphere{<-3.02495,-1.37993,4.40256>,s}
+// id 602
+sphere{<-4.54327,-1.33218,4.70748>,s}
+// id 629
+sphere{<-4.02426,-2.15452,4.93919>,s}
+// id 650
+sphere{<-3.62649,-1.27547,5.20186>,s}
+// id 687
+sphere{<-2.9828,-2.04038,5.21902>,s}
+// id 497
+sphere{<-2.41609,-2.30242,4.05814>,s}
+// id 575
+sphere{<-1.59293,-2.62192,4.52724>,s}
+// id 613
+sphere{<-1.11514,-1.7467,4.59748>,s}
+// id 639
+sphere{<-2.07731,-1.8129,4.86123>,s}
+// id 690
+sphere{<-2.641,-1.10298,5.28316>,s}
+// id 515
+sphere{<-0.693376,-2.56665,4.01992>,s}
+// id 580
+sphere{<0.776715,-2.27483,4.32787>,s}
+// id 596
+sphere{<-0.130367,-1.89754,4.51353>,s}
+// id 622
+sphere{<-0.49171,-1.20067,5.15681>,s}
+// id 626
+sphere{<0.462177,-1.1335,4.78447>,s}
+// id 651
+sphere{<0.873425,-1.91046,5.26015>,s}
+// id 549
+sphere{<1.2735,-1.40901,4.26899>,s}
+// id 576
+sphere{<2.38784,-1.48359,4.4737>,s}
+// id 655
+sphere{<1.73432,-2.22765,4.61158>,s}
+// id 681
+sphere{<1.71016,-1.36636,5.19927>,s}
+// id 693
+sphere{<2.47529,-2.06488,5.28259>,s}
+// id 545
+sphere{<3.31923,-1.69164,4.76994>,s}
+// id 587
+sphere{<2.87517,-2.54697,4.50388>,s}
+// id 628
+sphere{<4.51309,-1.02803,4.5085>,s}
+// id 685
+sphere{<4.27575,-1.97619,4.71841>,s}
+// id 562
+sphere{<5.21963,-1.73524,4.49306>,s}
+// id 636
+sphere{<5.41536,-0.961292,5.27631>,s}
+// id 523
+sphere{<-5.45549,0.703788,4.09889>,s}
+// id 603
+sphere{<-5.50008,-0.00258655,4.80464>,s}
+// id 466
+sphere{<-3.22515,-0.38038,4.21299>,s}
+// id 467
+sphere{<-4.58573,-0.664482,3.96454>,s}
+// id 561
+sphere{<-4.61172,0.253797,4.39041>,s}
+// id 637
+sphere{<-4.043,-0.46965,4.78127>,s}
+// id 656
+sphere{<-3.62621,0.514751,4.52583>,s}
+// id 532
+sphere{<-1.3034,-0.7658,4.41241>,s}
+// id 572
+sphere{<-2.65964,0.304813,4.67125>,s}
+// id 578
+sphere{<-1.67734,0.147502,4.57319>,s}
+// id 666
+sphere{<-2.29263,-0.63388,4.47225>,s}
+// id 662
+sphere{<-1.06568,-0.247651,5.27212>,s}
+// id 558
+sphere{<-0.686183,0.162892,4.44361>,s}
+// id 571
+sphere{<-0.312267,-0.749714,4.28264>,s}
+// id 609
+sphere{<0.312504,0.148579,4.39595>,s}
+// id 616
+sphere{<-0.413756,0.836166,5.13013>,s}
+// id 653
+sphere{<-0.0690039,-0.295776,5.20647>,s}
+// id 734
+sphere{<0.549288,0.599582,5.25592>,s}
+// id 437
+sphere{<1.50708,0.221163,4.1711>,s}
+// id 649
+sphere{<1.8787,-0.626921,4.54741>,s}
+// id 658
+sphere{<2.37702,0.232139,4.66423>,s}
+// id 670
+sphere{<1.01347,-0.313834,4.93886>,s}
+// id 697
+sphere{<2.77622,-0.590111,5.06946>,s}
+// id 696
+sphere{<1.53717,0.517178,5.12544>,s}
+// id 543
+sphere{<3.15398,-0.890868,4.19448>,s}
+// id 564
+sphere{<3.94625,0.771328,4.27594>,s}
+// id 567
+sphere{<4.51129,-0.0288112,4.47615>,s}
+// id 647
+sphere{<3.49547,-0.0557464,4.62641>,s}
+// id 663
+sphere{<3.75603,-0.871484,5.14153>,s}
+// id 715
+sphere{<3.78164,0.640211,5.28391>,s}
+// id 469
+sphere{<5.45673,-0.690052,4.31472>,s}
+// id 493
+sphere{<5.48326,0.43584,4.02641>,s}
+// id 607
+sphere{<4.69588,0.840732,4.93372>,s}
+// id 625
+sphere{<5.49955,0.0736311,4.95831>,s}
+// id 537
+sphere{<-4.83008,2.63083,4.29673>,s}
+// id 615
+sphere{<-5.1619,1.89954,4.89201>,s}
+// id 721
+sphere{<-5.41687,0.952767,5.08729>,s}
+// id 583
+sphere{<-4.47902,1.24465,4.41448>,s}
+// id 586
+sphere{<-2.99079,1.39229,4.28165>,s}
+// id 600
+sphere{<-2.97693,2.39272,4.55127>,s}
+// id 652
+sphere{<-3.88278,2.75711,4.76513>,s}
+// id 668
+sphere{<-3.73617,1.77038,4.83006>,s}
+// id 737
+sphere{<-3.1447,1.06003,5.21131>,s}
+// id 546
+sphere{<-2.22796,1.98609,4.02901>,s}
+// id 585
+sphere{<-2.10819,0.945263,4.13772>,s}
+// id 599
+sphere{<-1.41486,1.93755,4.6082>,s}
+// id 665
+sphere{<-2.11645,2.48018,5.07267>,s}
+// id 671
+sphere{<-2.2607,1.49776,4.9567>,s}
+// id 722
+sphere{<-1.40867,0.983083,5.0516>,s}
+// id 550
+sphere{<-0.148467,2.15786,4.35945>,s}
+// id 563
+sphere{<0.187826,1.21893,4.42917>,s}
+// id 566
+sphere{<-0.802922,1.21355,4.29051>,s}
+// id 589
+sphere{<0.824007,2.02634,4.16874>,s}
+// id 604
+sphere{<0.478321,2.12922,5.13737>,s}
+// id 688
+sphere{<-0.604537,1.8159,5.18041>,s}
+// id 624
+sphere{<1.75725,2.12443,4.51427>,s}
+// id 638
+sphere{<1.06902,1.36536,4.87797>,s}
+// id 634
+sphere{<1.95395,1.14512,4.46835>,s}
+// id 588
+sphere{<3.867,2.39651,4.40226>,s}
+// id 590
+sphere{<3.05381,0.967708,4.68188>,s}
+// id 614
+sphere{<3.9866,1.54525,4.91229>,s}
+// id 621
+sphere{<2.89474,1.95245,4.61458>,s}
+// id 579
+sphere{<5.32894,1.36362,4.36479>,s}
+// id 598
+sphere{<4.87857,2.24838,4.4785>,s}
+// id 661
+sphere{<5.21325,1.75278,5.27983>,s}
+// id 756
+sphere{<-4.73951,2.79093,5.27934>,s}
+// id 570
+sphere{<-3.18104,4.48711,4.17272>,s}
+// id 620
+sphere{<-4.07955,3.69005,4.46653>,s}
+// id 633
+sphere{<-3.09844,3.60712,4.64002>,s}
+// id 676
+sphere{<-3.39273,4.32916,5.26582>,s}
+// id 584
+sphere{<-2.30734,3.09408,4.30722>,s}
+// id 591
+sphere{<-1.3644,2.94565,4.60486>,s}
+// id 617
+sphere{<-1.71585,4.28774,4.50852>,s}
+// id 672
+sphere{<-0.929645,4.53556,5.07406>,s}
+// id 683
+sphere{<-2.22228,3.67659,5.11551>,s}
+// id 577
+sphere{<0.268329,3.91982,4.08476>,s}
+// id 611
+sphere{<-0.104746,3.75414,5.04642>,s}
+// id 627
+sphere{<-0.860535,3.78342,4.39269>,s}
+// id 659
+sphere{<-0.479546,2.80284,5.0481>,s}
+// id 691
+sphere{<0.336528,3.01861,4.51227>,s}
+// id 524
+sphere{<1.21803,2.93709,4.04744>,s}
+// id 547
+sphere{<1.88029,3.70123,4.12892>,s}
+// id 582
+sphere{<2.78091,4.00524,4.43951>,s}
+// id 619
+sphere{<1.04448,3.70512,4.67752>,s}
+// id 664
+sphere{<1.22237,2.78866,5.03577>,s}
+// id 675
+sphere{<2.16606,2.99767,4.77939>,s}
+// id 717
+sphere{<1.85112,4.20673,4.99073>,s}
+// id 555
+sphere{<4.49449,3.17143,4.46648>,s}
+// id 592
+sphere{<3.84738,3.93083,4.52835>,s}
+// id 630
+sphere{<3.14236,3.06403,4.57339>,s}
+// id 552
+sphere{<-2.15235,5.06189,4.05118>,s}
+// id 559
+sphere{<-1.4195,5.31402,4.68271>,s}
+// id 645
+sphere{<-2.61041,4.84163,4.91217>,s}
+// id 531
+sphere{<-0.0271457,4.6761,4.66796>,s}
+// id 556
+sphere{<-0.50648,5.47678,4.30913>,s}
+// id 669
+sphere{<0.543314,5.47388,4.47545>,s}
+// id 678
+sphere{<-0.117487,5.49895,5.2295>,s}
+// id 539
+sphere{<1.86846,5.16807,4.4001>,s}
+// id 605
+sphere{<2.63338,4.82905,4.98674>,s}
+// id 684
+sphere{<0.974527,4.67907,4.90161>,s}
+// id 632
+sphere{<-2.56561,-4.86473,5.34044>,s}
+// id 673
+sphere{<-1.34619,-5.33286,5.29817>,s}
+// id 783
+sphere{<-2.025,-5.11399,6.14295>,s}
+// id 841
+sphere{<-1.07379,-5.39492,6.26742>,s}
+// id 623
+sphere{<0.63388,-5.46349,5.41817>,s}
+// id 758
+sphere{<0.402007,-4.64584,5.94465>,s}
+// id 770
+sphere{<-0.596944,-4.75739,5.66279>,s}
+// id 811
+sphere{<-0.0931348,-5.49978,6.10348>,s}
+// id 709
+sphere{<2.44274,-4.92691,5.38405>,s}
+// id 724
+sphere{<1.37639,-5.32536,6.07285>,s}
+// id 790
+sphere{<2.2768,-5.00693,6.36673>,s}
+// id 726
+sphere{<-3.16032,-4.50146,6.0572>,s}
+// id 736
+sphere{<-3.98894,-3.20706,5.70351>,s}
+// id 767
+sphere{<-4.52675,-3.12493,6.54248>,s}
+// id 782
+sphere{<-2.81437,-3.08266,5.76993>,s}
+// id 813
+sphere{<-3.87661,-3.90181,6.41328>,s}
+// id 853
+sphere{<-3.53966,-2.97045,6.56942>,s}
+// id 694
+sphere{<-1.46908,-4.34591,5.40052>,s}
+// id 711
+sphere{<-1.89839,-3.11747,5.37024>,s}
+// id 784
+sphere{<-2.10551,-3.86412,6.00206>,s}
+// id 794
+sphere{<-1.88527,-2.96717,6.38496>,s}
+// id 819
+sphere{<-1.03548,-3.5191,5.78248>,s}
+// id 839
+sphere{<-1.2444,-4.41546,6.37219>,s}
+// id 744
+sphere{<-0.11628,-3.12498,5.8416>,s}
+// id 760
+sphere{<0.834464,-2.898,6.05393>,s}
+// id 866
+sphere{<-0.309015,-4.01097,6.26221>,s}
+// id 686
+sphere{<2.3797,-3.98406,5.73453>,s}
+// id 708
+sphere{<1.51816,-3.44256,5.56896>,s}
+// id 735
+sphere{<1.49715,-4.44042,5.62387>,s}
+// id 773
+sphere{<2.45856,-2.98278,5.78518>,s}
+// id 807
+sphere{<0.970532,-3.89226,6.2734>,s}
+// id 834
+sphere{<1.89035,-4.11384,6.59651>,s}
+// id 925
+sphere{<1.69412,-3.1377,6.50475>,s}
+// id 699
+sphere{<4.40091,-3.29945,5.49586>,s}
+// id 723
+sphere{<3.9104,-3.86768,6.15651>,s}
+// id 754
+sphere{<3.27187,-4.42125,5.62209>,s}
+// id 776
+sphere{<3.56514,-2.95478,5.92283>,s}
+// id 816
+sphere{<3.12137,-4.52893,6.60458>,s}
+// id 857
+sphere{<2.9542,-3.55791,6.43554>,s}
+// id 719
+sphere{<-4.97937,-2.33581,6.12749>,s}
+// id 780
+sphere{<-5.31783,-1.40539,6.26726>,s}
+// id 739
+sphere{<-4.4501,-1.35459,5.76343>,s}
+// id 751
+sphere{<-3.70004,-2.26603,5.87826>,s}
+// id 787
+sphere{<-3.10248,-1.4906,6.08068>,s}
+// id 692
+sphere{<-1.23363,-2.33587,5.41521>,s}
+// id 727
+sphere{<-1.47734,-1.15727,5.31905>,s}
+// id 749
+sphere{<-2.16649,-2.23757,5.76181>,s}
+// id 798
+sphere{<-2.07681,-1.30313,6.10562>,s}
+// id 864
+sphere{<-1.59473,-2.03271,6.59023>,s}
+// id 881
+sphere{<-2.78358,-2.31711,6.54425>,s}
+// id 677
+sphere{<0.299018,-1.20425,5.76844>,s}
+// id 698
+sphere{<-0.0781984,-2.09221,5.50782>,s}
+// id 725
+sphere{<-0.817729,-1.6617,6.02524>,s}
+// id 808
+sphere{<-0.885731,-2.67103,6.29068>,s}
+// id 850
+sphere{<0.0911993,-2.36369,6.45568>,s}
+// id 765
+sphere{<1.62496,-2.45074,5.63764>,s}
+// id 796
+sphere{<2.14804,-1.29497,6.09724>,s}
+// id 818
+sphere{<1.08559,-1.85826,6.23593>,s}
+// id 875
+sphere{<1.99584,-2.1847,6.52729>,s}
+// id 714
+sphere{<3.78159,-2.03731,5.58631>,s}
+// id 753
+sphere{<3.04922,-1.34302,5.66726>,s}
+// id 766
+sphere{<4.53712,-1.38945,5.48925>,s}
+// id 835
+sphere{<2.9533,-2.2029,6.16774>,s}
+// id 840
+sphere{<3.87351,-1.2766,6.2285>,s}
+// id 845
+sphere{<3.99212,-2.21684,6.54719>,s}
+// id 695
+sphere{<5.01992,-2.2493,5.32696>,s}
+// id 750
+sphere{<4.79333,-2.69752,6.19111>,s}
+// id 806
+sphere{<5.29768,-1.47835,6.13228>,s}
+// id 612
+sphere{<-5.43384,-0.853708,5.44173>,s}
+// id 801
+sphere{<-5.49599,0.21606,5.77979>,s}
+// id 855
+sphere{<-5.13855,-0.438123,6.44581>,s}
+// id 705
+sphere{<-3.22982,-0.217084,5.30498>,s}
+// id 710
+sphere{<-4.26888,0.519217,5.29143>,s}
+// id 762
+sphere{<-4.57627,-0.372797,5.62151>,s}
+// id 786
+sphere{<-3.72413,-0.709957,6.02075>,s}
+// id 785
+sphere{<-3.27644,0.4832,6.01695>,s}
+// id 793
+sphere{<-4.63558,0.493263,6.2212>,s}
+// id 679
+sphere{<-2.05999,-0.295474,5.38382>,s}
+// id 757
+sphere{<-1.37903,0.460732,5.90363>,s}
+// id 771
+sphere{<-2.27699,0.671234,5.51894>,s}
+// id 789
+sphere{<-1.67408,-0.408753,6.29908>,s}
+// id 799
+sphere{<-2.71496,-0.533643,6.1015>,s}
+// id 805
+sphere{<-2.32026,0.337226,6.45996>,s}
+// id 718
+sphere{<-0.626927,-0.680833,6.05927>,s}
+// id 812
+sphere{<-0.396271,0.287504,5.96483>,s}
+// id 833
+sphere{<0.288222,-0.358563,6.30109>,s}
+// id 860
+sphere{<0.434684,0.665865,6.3715>,s}
+// id 743
+sphere{<1.09743,0.0779238,5.90875>,s}
+// id 748
+sphere{<1.91347,-0.329542,5.50086>,s}
+// id 788
+sphere{<1.97875,0.533643,6.03307>,s}
+// id 814
+sphere{<1.23646,-0.911118,5.95286>,s}
+// id 837
+sphere{<2.74138,-0.477563,6.06246>,s}
+// id 876
+sphere{<1.85156,-0.342249,6.49823>,s}
+// id 738
+sphere{<4.62465,-0.000741661,5.46915>,s}
+// id 745
+sphere{<2.83862,0.418061,5.53158>,s}
+// id 752
+sphere{<3.70823,-0.175204,5.85686>,s}
+// id 828
+sphere{<3.58082,0.765698,6.25482>,s}
+// id 830
+sphere{<4.36221,0.197767,6.51451>,s}
+// id 674
+sphere{<5.43692,0.833845,5.6044>,s}
+// id 795
+sphere{<4.68333,-0.691411,6.18966>,s}
+// id 797
+sphere{<5.28747,0.574388,6.5578>,s}
+// id 847
+sphere{<5.4973,-0.173172,5.92733>,s}
+// id 803
+sphere{<-5.37474,1.16713,6.06312>,s}
+// id 804
+sphere{<-5.07825,2.11271,5.93097>,s}
+// id 660
+sphere{<-2.95043,2.00533,5.47264>,s}
+// id 728
+sphere{<-4.45446,1.48601,5.46433>,s}
+// id 740
+sphere{<-3.94377,2.32242,5.66316>,s}
+// id 779
+sphere{<-3.6143,1.44293,6.00624>,s}
+// id 896
+sphere{<-3.11079,2.5394,6.30224>,s}
+// id 916
+sphere{<-4.504,1.4548,6.46203>,s}
+// id 706
+sphere{<-1.25483,2.46172,5.57949>,s}
+// id 730
+sphere{<-1.72072,1.56478,5.80222>,s}
+// id 774
+sphere{<-2.63028,1.3529,6.15964>,s}
+// id 854
+sphere{<-2.1552,2.22313,6.41643>,s}
+// id 858
+sphere{<-1.18055,2.01985,6.50988>,s}
+// id 746
+sphere{<0.170882,1.39069,5.73611>,s}
+// id 775
+sphere{<-0.786734,1.2611,5.99169>,s}
+// id 792
+sphere{<-0.21456,2.35248,5.92774>,s}
+// id 849
+sphere{<0.781322,1.84869,6.38654>,s}
+// id 731
+sphere{<2.29133,1.24524,5.40414>,s}
+// id 764
+sphere{<2.51271,2.3436,5.45151>,s}
+// id 761
+sphere{<1.59258,1.95493,5.49232>,s}
+// id 772
+sphere{<1.17843,1.10461,5.85011>,s}
+// id 809
+sphere{<1.18842,2.69097,6.03453>,s}
+// id 825
+sphere{<2.62171,1.2928,6.34677>,s}
+// id 859
+sphere{<2.09481,2.14377,6.33746>,s}
+// id 657
+sphere{<3.50491,2.36901,5.33319>,s}
+// id 667
+sphere{<3.25581,1.43472,5.58667>,s}
+// id 733
+sphere{<4.2898,1.94929,5.78869>,s}
+// id 781
+sphere{<4.49361,0.977435,5.90315>,s}
+// id 791
+sphere{<3.12264,2.18166,6.23797>,s}
+// id 689
+sphere{<4.79028,2.70321,5.3636>,s}
+// id 777
+sphere{<5.27131,1.56953,6.26115>,s}
+// id 920
+sphere{<4.88196,2.53348,6.34414>,s}
+// id 741
+sphere{<-3.27694,3.09982,5.48308>,s}
+// id 759
+sphere{<-4.16623,3.59051,5.45767>,s}
+// id 829
+sphere{<-3.68934,4.07995,6.18754>,s}
+// id 861
+sphere{<-4.61628,2.99014,6.25134>,s}
+// id 926
+sphere{<-2.94908,3.5002,6.52587>,s}
+// id 700
+sphere{<-1.24731,3.62314,5.33067>,s}
+// id 720
+sphere{<-1.0271,4.50625,6.06874>,s}
+// id 802
+sphere{<-2.35682,3.03442,5.86919>,s}
+// id 815
+sphere{<-2.12283,4.0008,6.05583>,s}
+// id 848
+sphere{<-1.43659,3.20744,6.22>,s}
+// id 631
+sphere{<0.710379,3.98972,5.57587>,s}
+// id 707
+sphere{<0.39542,3.04165,5.53731>,s}
+// id 712
+sphere{<-0.49256,3.31266,5.90811>,s}
+// id 732
+sphere{<-0.116544,4.547,5.65554>,s}
+// id 882
+sphere{<0.160049,3.88524,6.40408>,s}
+// id 877
+sphere{<0.350579,2.91246,6.53282>,s}
+// id 729
+sphere{<1.55667,4.38865,5.92875>,s}
+// id 769
+sphere{<2.53379,3.98585,5.68709>,s}
+// id 778
+sphere{<1.69562,3.44624,5.62068>,s}
+// id 800
+sphere{<2.48459,3.08494,6.1218>,s}
+// id 817
+sphere{<1.12695,3.63218,6.42148>,s}
+// id 823
+sphere{<2.11811,3.88818,6.59125>,s}
+// id 597
+sphere{<3.4128,4.31375,5.34307>,s}
+// id 646
+sphere{<4.22255,3.52551,5.36113>,s}
+// id 701
+sphere{<3.2611,3.31681,5.53674>,s}
+// id 821
+sphere{<3.9788,2.85851,6.06463>,s}
+// id 868
+sphere{<3.83008,3.94806,6.17719>,s}
+// id 704
+sphere{<-1.0393,5.40108,5.60345>,s}
+// id 713
+sphere{<-1.80493,4.76713,5.49811>,s}
+// id 831
+sphere{<-1.97712,5.1327,6.41261>,s}
+// id 851
+sphere{<-2.75103,4.76269,5.89877>,s}
+// id 957
+sphere{<-1.03331,5.40211,6.60324>,s}
+// id 747
+sphere{<0.825119,5.43798,5.55591>,s}
+// id 822
+sphere{<0.669234,4.73104,6.24544>,s}
+// id 838
+sphere{<-0.111164,5.49881,6.22923>,s}
+// id 755
+sphere{<1.78323,5.20327,5.39522>,s}
+// id 763
+sphere{<2.47407,4.91267,6.05605>,s}
+// id 867
+sphere{<1.48898,5.29467,6.34653>,s}
+// id 820
+sphere{<-2.65503,-4.81711,6.86019>,s}
+// id 950
+sphere{<-1.76797,-5.20846,7.10417>,s}
+// id 1096
+sphere{<-1.01013,-5.40664,7.72525>,s}
+// id 836
+sphere{<0.661449,-5.46038,6.75799>,s}
+// id 887
+sphere{<-0.419061,-4.85141,6.79184>,s}
+// id 923
+sphere{<-0.051743,-5.50072,7.45705>,s}
+// id 960
+sphere{<0.828687,-5.07576,7.66544>,s}
+// id 870
+sphere{<1.59632,-5.26338,7.0529>,s}
+// id 933
+sphere{<2.48529,-4.90655,7.33955>,s}
+// id 892
+sphere{<-4.72884,-2.80892,7.46944>,s}
+// id 824
+sphere{<-2.87804,-3.71829,6.61949>,s}
+// id 890
+sphere{<-3.43198,-4.29843,7.21614>,s}
+// id 913
+sphere{<-2.85956,-2.98692,7.30224>,s}
+// id 930
+sphere{<-4.14888,-3.61108,7.33022>,s}
+// id 863
+sphere{<-1.1403,-3.50711,6.77654>,s}
+// id 906
+sphere{<-1.97836,-4.08917,6.96778>,s}
+// id 937
+sphere{<-1.87963,-3.17619,7.36276>,s}
+// id 949
+sphere{<-2.57734,-4.32019,7.73427>,s}
+// id 1018
+sphere{<-1.14478,-4.47199,7.36547>,s}
+// id 1071
+sphere{<-1.03823,-3.5416,7.77042>,s}
+// id 893
+sphere{<0.502499,-4.48751,6.92608>,s}
+// id 905
+sphere{<0.271209,-3.3532,6.74173>,s}
+// id 944
+sphere{<-0.479103,-2.91081,7.23127>,s}
+// id 963
+sphere{<-0.277364,-3.98069,7.2929>,s}
+// id 987
+sphere{<0.357991,-3.15919,7.71839>,s}
+// id 1070
+sphere{<0.597429,-4.12088,7.85091>,s}
+// id 961
+sphere{<1.12894,-3.57089,7.2068>,s}
+// id 959
+sphere{<2.57954,-3.91221,7.29229>,s}
+// id 965
+sphere{<2.17743,-2.99987,7.36905>,s}
+// id 977
+sphere{<1.62306,-4.38074,7.52205>,s}
+// id 1010
+sphere{<1.33623,-2.87666,7.89551>,s}
+// id 844
+sphere{<4.38149,-3.32468,6.85151>,s}
+// id 910
+sphere{<3.47488,-2.93238,7.01641>,s}
+// id 1004
+sphere{<3.2667,-3.44563,7.84889>,s}
+// id 1016
+sphere{<3.75149,-4.02234,7.19145>,s}
+// id 1034
+sphere{<3.19866,-4.47437,7.89105>,s}
+// id 1037
+sphere{<4.27219,-3.46368,7.83572>,s}
+// id 843
+sphere{<-5.12698,-1.9915,7.05432>,s}
+// id 921
+sphere{<-5.40093,-1.04096,7.19899>,s}
+// id 826
+sphere{<-4.2005,-2.20091,6.74149>,s}
+// id 856
+sphere{<-4.49899,-1.24971,6.81914>,s}
+// id 904
+sphere{<-3.53176,-1.03215,6.94734>,s}
+// id 952
+sphere{<-3.772,-1.12092,7.91358>,s}
+// id 947
+sphere{<-3.38135,-1.96799,7.26586>,s}
+// id 966
+sphere{<-3.7458,-2.7822,7.71764>,s}
+// id 989
+sphere{<-4.33341,-1.9178,7.69127>,s}
+// id 1114
+sphere{<-2.81545,-1.41211,7.9238>,s}
+// id 852
+sphere{<-1.15816,-1.11123,6.78898>,s}
+// id 924
+sphere{<-2.60764,-1.4129,6.94571>,s}
+// id 935
+sphere{<-2.20647,-2.2311,7.35586>,s}
+// id 929
+sphere{<-1.81685,-1.23502,7.53109>,s}
+// id 998
+sphere{<-1.26439,-2.43219,7.622>,s}
+// id 810
+sphere{<0.121869,-1.40322,6.73205>,s}
+// id 884
+sphere{<-0.670691,-1.96599,6.96625>,s}
+// id 967
+sphere{<-0.847019,-1.35899,7.74057>,s}
+// id 971
+sphere{<0.183879,-2.188,7.43573>,s}
+// id 986
+sphere{<0.137251,-1.15842,7.70148>,s}
+// id 911
+sphere{<1.00002,-2.60226,6.99463>,s}
+// id 934
+sphere{<1.85727,-1.17817,7.04675>,s}
+// id 978
+sphere{<0.97614,-1.62439,7.20194>,s}
+// id 990
+sphere{<2.77605,-2.22931,7.15106>,s}
+// id 1000
+sphere{<1.82052,-2.06641,7.50465>,s}
+// id 1008
+sphere{<2.62038,-1.38272,7.6594>,s}
+// id 883
+sphere{<2.97083,-1.33461,6.66392>,s}
+// id 898
+sphere{<4.50178,-1.31512,7.0049>,s}
+// id 945
+sphere{<4.28231,-2.53067,7.45112>,s}
+// id 955
+sphere{<3.62517,-1.64804,7.35161>,s}
+// id 1019
+sphere{<3.39515,-2.44839,7.90467>,s}
+// id 874
+sphere{<5.06782,-2.13831,6.97282>,s}
+// id 938
+sphere{<5.3419,-1.31061,7.54673>,s}
+// id 842
+sphere{<-5.48203,0.449828,6.75158>,s}
+// id 964
+sphere{<-5.49879,-0.118946,7.57327>,s}
+// id 1028
+sphere{<-5.43586,0.837594,7.85773>,s}
+// id 878
+sphere{<-4.20991,-0.236419,6.75621>,s}
+// id 895
+sphere{<-3.22468,-0.0873546,6.83626>,s}
+// id 914
+sphere{<-4.63239,0.692907,7.21887>,s}
+// id 940
+sphere{<-3.73457,0.870018,6.81667>,s}
+// id 958
+sphere{<-4.5824,-0.627735,7.5976>,s}
+// id 1027
+sphere{<-3.04498,-0.454794,7.74869>,s}
+// id 1031
+sphere{<-3.79218,0.231978,7.59498>,s}
+// id 832
+sphere{<-0.979729,0.141329,6.76263>,s}
+// id 943
+sphere{<-2.32003,-0.462291,7.06024>,s}
+// id 946
+sphere{<-1.79118,0.349478,7.30817>,s}
+// id 954
+sphere{<-1.20225,-0.446265,7.53999>,s}
+// id 996
+sphere{<-2.74468,0.650426,7.30935>,s}
+// id 879
+sphere{<-0.342625,-0.575349,7.04593>,s}
+// id 927
+sphere{<0.40367,0.0894009,7.18748>,s}
+// id 953
+sphere{<-0.815084,0.538438,7.66502>,s}
+// id 1052
+sphere{<0.135008,0.79515,7.84277>,s}
+// id 1069
+sphere{<0.838039,-0.471032,7.89222>,s}
+// id 871
+sphere{<2.75647,0.343976,6.63235>,s}
+// id 869
+sphere{<1.28302,0.408697,6.83336>,s}
+// id 897
+sphere{<1.00687,-0.663905,6.9257>,s}
+// id 932
+sphere{<2.61316,-0.520164,7.12036>,s}
+// id 981
+sphere{<2.11239,0.694836,7.31206>,s}
+// id 984
+sphere{<1.72326,-0.246634,7.48511>,s}
+// id 1017
+sphere{<1.10314,0.538284,7.80797>,s}
+// id 908
+sphere{<4.55805,0.596477,7.54943>,s}
+// id 928
+sphere{<3.55558,-0.510103,6.78601>,s}
+// id 999
+sphere{<3.64847,0.402644,7.18354>,s}
+// id 1002
+sphere{<4.63014,-0.367117,7.29433>,s}
+// id 1005
+sphere{<3.3674,-0.722383,7.74419>,s}
+// id 1045
+sphere{<2.85851,0.205851,7.76253>,s}
+// id 915
+sphere{<5.46281,-0.641449,6.81367>,s}
+// id 948
+sphere{<5.49835,0.14404,7.435>,s}
+// id 903
+sphere{<-4.98389,2.32665,6.90289>,s}
+// id 939
+sphere{<-5.32063,1.39464,7.03543>,s}
+// id 1122
+sphere{<-5.13296,1.97566,7.8272>,s}
+// id 872
+sphere{<-4.01417,2.30447,6.66019>,s}
+// id 894
+sphere{<-3.22418,1.73146,6.88049>,s}
+// id 973
+sphere{<-4.27236,1.6904,7.40536>,s}
+// id 1006
+sphere{<-3.48316,1.17255,7.73546>,s}
+// id 1029
+sphere{<-3.11525,2.11499,7.79748>,s}
+// id 862
+sphere{<-1.47806,1.07174,6.6887>,s}
+// id 899
+sphere{<-1.58142,2.68038,7.14421>,s}
+// id 901
+sphere{<-2.27547,1.50869,7.10457>,s}
+// id 902
+sphere{<-2.61006,2.73448,7.14547>,s}
+// id 1007
+sphere{<-1.47788,1.28687,7.66498>,s}
+// id 1082
+sphere{<-2.11798,2.18311,7.82565>,s}
+// id 865
+sphere{<-0.118862,1.90648,6.81701>,s}
+// id 880
+sphere{<0.751817,1.20521,7.15119>,s}
+// id 912
+sphere{<-0.393901,0.946238,6.85543>,s}
+// id 951
+sphere{<-0.869835,2.05314,7.45977>,s}
+// id 972
+sphere{<0.075038,2.73984,7.47799>,s}
+// id 993
+sphere{<0.20814,1.78843,7.75428>,s}
+// id 827
+sphere{<1.63845,1.33484,6.7075>,s}
+// id 917
+sphere{<2.66586,2.57839,7.03405>,s}
+// id 979
+sphere{<2.45852,1.63213,7.28079>,s}
+// id 976
+sphere{<0.9789,2.45159,7.15943>,s}
+// id 1015
+sphere{<1.87085,2.37513,7.60488>,s}
+// id 1023
+sphere{<1.55703,1.43056,7.69948>,s}
+// id 846
+sphere{<4.02891,2.18474,6.80181>,s}
+// id 873
+sphere{<4.50501,1.30655,6.84734>,s}
+// id 886
+sphere{<3.38905,1.43534,6.97199>,s}
+// id 969
+sphere{<3.64695,1.11619,7.8839>,s}
+// id 1084
+sphere{<4.2929,1.87101,7.77084>,s}
+// id 1092
+sphere{<3.33234,2.13506,7.68389>,s}
+// id 970
+sphere{<5.09294,2.07696,7.20759>,s}
+// id 1030
+sphere{<5.38216,1.13566,7.37963>,s}
+// id 885
+sphere{<-4.16803,3.58869,6.91508>,s}
+// id 900
+sphere{<-2.94948,4.64234,6.8712>,s}
+// id 936
+sphere{<-3.57793,2.89932,7.33525>,s}
+// id 962
+sphere{<-3.32553,3.86601,7.37656>,s}
+// id 1032
+sphere{<-4.62225,2.98104,7.56642>,s}
+// id 888
+sphere{<-1.42599,4.529,6.98807>,s}
+// id 1014
+sphere{<-2.04105,3.54426,6.9411>,s}
+// id 1024
+sphere{<-1.30798,3.74075,7.59161>,s}
+// id 1065
+sphere{<-2.4047,4.11166,7.67857>,s}
+// id 1083
+sphere{<-2.08807,3.18152,7.87174>,s}
+// id 918
+sphere{<-0.803655,3.79021,6.72965>,s}
+// id 922
+sphere{<-0.619351,2.808,6.76191>,s}
+// id 968
+sphere{<-0.0465725,3.72729,7.37969>,s}
+// id 985
+sphere{<0.483177,4.57473,7.35324>,s}
+// id 995
+sphere{<-0.701522,4.53107,7.67733>,s}
+// id 889
+sphere{<1.76445,2.96394,6.80425>,s}
+// id 907
+sphere{<1.37275,4.47474,6.90775>,s}
+// id 983
+sphere{<0.974292,3.70532,7.40686>,s}
+// id 982
+sphere{<1.95472,4.36556,7.71309>,s}
+// id 997
+sphere{<1.86549,3.36965,7.71191>,s}
+// id 1003
+sphere{<2.73356,3.72034,7.36125>,s}
+// id 909
+sphere{<4.42991,3.26,6.8614>,s}
+// id 919
+sphere{<3.80858,3.96809,7.19642>,s}
+// id 942
+sphere{<3.29845,3.26353,6.6747>,s}
+// id 941
+sphere{<3.15613,4.50457,6.66174>,s}
+// id 1001
+sphere{<3.7435,3.0374,7.55578>,s}
+// id 1059
+sphere{<4.70927,2.84154,7.7253>,s}
+// id 931
+sphere{<-2.1926,5.04415,7.38647>,s}
+// id 988
+sphere{<-1.26078,5.35367,7.57548>,s}
+// id 956
+sphere{<-0.328313,4.68045,6.76175>,s}
+// id 980
+sphere{<0.610981,5.46656,6.91997>,s}
+// id 1043
+sphere{<-0.298128,5.49244,7.34346>,s}
+// id 891
+sphere{<2.196,5.04271,7.00726>,s}
+// id 974
+sphere{<1.39038,5.32175,7.52898>,s}
+// id 1021
+sphere{<2.90054,4.67344,7.61288>,s}
+// id 1098
+sphere{<-2.04851,-5.10439,8.05825>,s}
+// id 1112
+sphere{<-1.30246,-5.34404,8.67921>,s}
+// id 1042
+sphere{<0.28935,-5.49252,8.39675>,s}
+// id 1060
+sphere{<-0.326889,-4.69902,7.98627>,s}
+// id 1118
+sphere{<-0.411114,-5.48468,9.10994>,s}
+// id 1153
+sphere{<0.909817,-5.42447,9.17766>,s}
+// id 1187
+sphere{<0.0907994,-4.64743,8.89296>,s}
+// id 1058
+sphere{<1.7382,-5.21911,8.0539>,s}
+// id 1137
+sphere{<1.06625,-4.66572,8.54571>,s}
+// id 1147
+sphere{<1.86811,-5.17271,9.04391>,s}
+// id 1074
+sphere{<-3.73414,-4.03873,8.13294>,s}
+// id 1110
+sphere{<-3.57184,-2.92706,8.69254>,s}
+// id 1123
+sphere{<-3.03178,-4.58945,8.58316>,s}
+// id 1125
+sphere{<-4.3973,-3.30381,8.27236>,s}
+// id 1149
+sphere{<-4.59665,-3.0203,9.21015>,s}
+// id 1208
+sphere{<-2.88593,-3.61038,8.44271>,s}
+// id 1212
+sphere{<-3.98111,-3.79545,9.07058>,s}
+// id 1011
+sphere{<-1.92303,-3.7237,8.19872>,s}
+// id 1026
+sphere{<-2.36287,-2.80799,8.15688>,s}
+// id 1120
+sphere{<-1.20449,-4.40144,8.36059>,s}
+// id 1128
+sphere{<-1.38458,-2.9302,8.48167>,s}
+// id 1126
+sphere{<-1.42684,-3.73675,9.07275>,s}
+// id 1143
+sphere{<-2.07511,-4.46949,8.84711>,s}
+// id 1195
+sphere{<-2.25236,-3.17334,9.08083>,s}
+// id 1095
+sphere{<-0.217655,-3.75584,8.29978>,s}
+// id 1139
+sphere{<0.49685,-2.84687,8.65755>,s}
+// id 1171
+sphere{<-0.555204,-3.2477,9.09161>,s}
+// id 1200
+sphere{<0.3312,-3.70822,9.13761>,s}
+// id 1033
+sphere{<2.55354,-2.83557,8.28085>,s}
+// id 1061
+sphere{<2.36632,-4.54434,8.44029>,s}
+// id 1088
+sphere{<1.12378,-3.61594,8.53449>,s}
+// id 1107
+sphere{<2.02672,-3.66896,8.09655>,s}
+// id 1161
+sphere{<1.91832,-3.19178,8.9684>,s}
+// id 1151
+sphere{<1.72552,-4.16942,9.10999>,s}
+// id 1053
+sphere{<3.78758,-3.98869,8.53681>,s}
+// id 1086
+sphere{<3.58025,-3.02465,8.69979>,s}
+// id 1134
+sphere{<2.8244,-3.69726,8.70972>,s}
+// id 1222
+sphere{<3.07359,-4.56146,9.14664>,s}
+// id 1080
+sphere{<4.66819,-2.90926,8.56656>,s}
+// id 1040
+sphere{<-5.24935,-1.64247,7.98308>,s}
+// id 1116
+sphere{<-4.91617,-2.46605,8.44166>,s}
+// id 1192
+sphere{<-5.20528,-1.77744,9.10917>,s}
+// id 1022
+sphere{<-3.52297,-2.00582,8.30695>,s}
+// id 1050
+sphere{<-3.56692,-1.19436,8.88952>,s}
+// id 1127
+sphere{<-4.50432,-1.31751,8.56497>,s}
+// id 1253
+sphere{<-4.17722,-2.12627,9.05352>,s}
+// id 1055
+sphere{<-2.00369,-1.88176,8.27052>,s}
+// id 1077
+sphere{<-1.49067,-1.04395,8.45682>,s}
+// id 1142
+sphere{<-2.72704,-2.21515,8.87507>,s}
+// id 1155
+sphere{<-1.03469,-1.99371,8.48987>,s}
+// id 1216
+sphere{<-1.76825,-2.29382,9.1507>,s}
+// id 1272
+sphere{<-2.19072,-1.35493,9.09963>,s}
+// id 1036
+sphere{<-0.431399,-2.74269,8.21586>,s}
+// id 1067
+sphere{<0.892965,-2.00384,8.12312>,s}
+// id 1085
+sphere{<-0.0503496,-1.83874,8.40997>,s}
+// id 1121
+sphere{<0.574224,-1.08998,8.63161>,s}
+// id 1144
+sphere{<0.662456,-1.96744,9.10288>,s}
+// id 1209
+sphere{<-0.424505,-2.26695,9.23347>,s}
+// id 1046
+sphere{<1.79382,-2.22256,8.49715>,s}
+// id 1054
+sphere{<1.49584,-1.21929,7.97821>,s}
+// id 1102
+sphere{<2.41266,-1.45111,8.64235>,s}
+// id 1152
+sphere{<2.48694,-2.40141,9.19513>,s}
+// id 1170
+sphere{<1.46784,-1.39148,8.96394>,s}
+// id 1009
+sphere{<4.24578,-1.15016,7.95736>,s}
+// id 1066
+sphere{<3.35455,-1.53957,8.31962>,s}
+// id 1177
+sphere{<4.21264,-2.02285,8.48944>,s}
+// id 1169
+sphere{<3.44601,-2.12868,9.12223>,s}
+// id 1068
+sphere{<5.05511,-2.16867,7.97219>,s}
+// id 1119
+sphere{<5.31979,-1.39768,8.55265>,s}
+// id 1223
+sphere{<5.05271,-2.17353,9.12323>,s}
+// id 975
+sphere{<-4.65207,0.230803,8.10519>,s}
+// id 1079
+sphere{<-5.45016,-0.737316,8.35702>,s}
+// id 1159
+sphere{<-5.49564,0.220116,8.64201>,s}
+// id 1173
+sphere{<-4.66918,-0.386994,8.89113>,s}
+// id 1057
+sphere{<-3.71564,-0.296155,8.47595>,s}
+// id 1101
+sphere{<-3.72682,0.698049,8.58124>,s}
+// id 1135
+sphere{<-4.61906,0.601353,9.03309>,s}
+// id 1156
+sphere{<-2.83506,0.37465,8.26578>,s}
+// id 1258
+sphere{<-3.09382,0.146684,9.20376>,s}
+// id 1025
+sphere{<-1.12406,0.904406,8.87636>,s}
+// id 1039
+sphere{<-2.07242,-0.350617,8.02252>,s}
+// id 1041
+sphere{<-1.85973,0.593188,8.27514>,s}
+// id 1091
+sphere{<-1.09299,-0.0264623,8.4409>,s}
+// id 1150
+sphere{<-1.87342,-0.299798,9.00415>,s}
+// id 1164
+sphere{<-2.75852,-0.641773,8.68855>,s}
+// id 991
+sphere{<-0.182466,-0.181214,7.95086>,s}
+// id 1047
+sphere{<-0.240579,0.467444,8.70954>,s}
+// id 1103
+sphere{<-0.506425,-0.902767,8.56235>,s}
+// id 1106
+sphere{<0.711839,0.16946,8.65052>,s}
+// id 1234
+sphere{<0.0557023,-0.360702,9.18696>,s}
+// id 1062
+sphere{<2.37938,-0.564821,8.18124>,s}
+// id 1100
+sphere{<1.49996,-0.445578,8.64121>,s}
+// id 1105
+sphere{<1.98414,0.351641,8.24248>,s}
+// id 1146
+sphere{<2.31605,-0.621124,9.19168>,s}
+// id 1168
+sphere{<2.20481,0.780563,9.11814>,s}
+// id 1013
+sphere{<4.07257,-0.0982369,8.07987>,s}
+// id 1115
+sphere{<3.51241,-0.641014,8.72959>,s}
+// id 1133
+sphere{<3.71492,0.602922,8.73942>,s}
+// id 1158
+sphere{<4.55666,-0.823933,8.85003>,s}
+// id 1180
+sphere{<2.84767,0.105449,8.75678>,s}
+// id 992
+sphere{<5.17568,-0.508565,8.11979>,s}
+// id 1064
+sphere{<5.45684,0.690208,8.27158>,s}
+// id 1136
+sphere{<4.76886,0.148517,8.7537>,s}
+// id 1117
+sphere{<5.47776,-0.495553,9.07254>,s}
+// id 1145
+sphere{<-5.36352,1.21955,8.779>,s}
+// id 1166
+sphere{<-5.05067,2.17848,8.8027>,s}
+// id 1012
+sphere{<-4.51701,1.21133,8.24758>,s}
+// id 1089
+sphere{<-4.26165,2.29689,8.2>,s}
+// id 1157
+sphere{<-2.86471,1.09087,8.96838>,s}
+// id 1175
+sphere{<-4.36114,1.55711,9.17371>,s}
+// id 1205
+sphere{<-3.56453,1.69272,8.58493>,s}
+// id 1246
+sphere{<-3.90586,2.46456,9.12048>,s}
+// id 1038
+sphere{<-2.54222,1.30511,8.04646>,s}
+// id 1051
+sphere{<-1.74924,1.62097,8.56721>,s}
+// id 1138
+sphere{<-1.81962,2.62348,8.67212>,s}
+// id 1206
+sphere{<-2.76153,2.29053,8.71618>,s}
+// id 1020
+sphere{<-0.612948,1.38473,8.15775>,s}
+// id 1087
+sphere{<0.624202,1.71638,8.66018>,s}
+// id 1081
+sphere{<0.820551,2.61678,8.13286>,s}
+// id 1097
+sphere{<-0.170939,2.7712,8.44632>,s}
+// id 1167
+sphere{<-0.920467,2.16268,8.70559>,s}
+// id 1198
+sphere{<-0.278311,1.48446,9.09477>,s}
+// id 1063
+sphere{<2.52679,2.00298,8.26129>,s}
+// id 1072
+sphere{<1.3836,1.06162,8.6124>,s}
+// id 1129
+sphere{<1.55466,2.04081,8.49208>,s}
+// id 1160
+sphere{<2.75042,1.03006,8.31824>,s}
+// id 1163
+sphere{<2.22345,1.77802,9.18719>,s}
+// id 1056
+sphere{<3.90989,2.54039,8.40734>,s}
+// id 1073
+sphere{<4.54464,1.0677,8.43045>,s}
+// id 1140
+sphere{<2.81876,2.56673,9.03384>,s}
+// id 1188
+sphere{<4.40322,1.78478,9.11166>,s}
+// id 1190
+sphere{<3.40222,1.71323,8.64775>,s}
+// id 1048
+sphere{<5.21254,1.75534,8.14634>,s}
+// id 1148
+sphere{<4.87751,2.54239,8.66426>,s}
+// id 1162
+sphere{<5.32163,1.38972,9.07024>,s}
+// id 1075
+sphere{<-4.07759,3.69153,8.01134>,s}
+// id 1090
+sphere{<-3.13779,3.83142,8.35797>,s}
+// id 1108
+sphere{<-3.46458,2.88683,8.32869>,s}
+// id 1185
+sphere{<-4.52908,3.12165,8.69765>,s}
+// id 1194
+sphere{<-3.91736,3.86074,8.98341>,s}
+// id 1263
+sphere{<-3.17208,3.23692,9.21853>,s}
+// id 1262
+sphere{<-3.17742,4.48954,9.22065>,s}
+// id 1078
+sphere{<-1.10847,2.85404,8.00801>,s}
+// id 1104
+sphere{<-1.70757,4.18955,8.39077>,s}
+// id 1186
+sphere{<-1.02075,3.16054,8.95532>,s}
+// id 1213
+sphere{<-2.30376,3.49637,8.79582>,s}
+// id 994
+sphere{<0.438001,3.53513,8.23331>,s}
+// id 1076
+sphere{<0.100272,4.49771,8.27371>,s}
+// id 1124
+sphere{<-0.551031,3.67957,8.24168>,s}
+// id 1172
+sphere{<0.856105,3.04385,9.03636>,s}
+// id 1184
+sphere{<-0.815337,4.54201,8.67268>,s}
+// id 1035
+sphere{<1.087,4.60041,8.15077>,s}
+// id 1093
+sphere{<2.51264,3.81304,8.33199>,s}
+// id 1131
+sphere{<1.9944,2.93217,8.60169>,s}
+// id 1130
+sphere{<1.38017,3.71633,8.51384>,s}
+// id 1165
+sphere{<1.9568,4.38188,8.98729>,s}
+// id 1214
+sphere{<0.972442,4.47344,9.13579>,s}
+// id 1049
+sphere{<3.58158,4.17403,8.14824>,s}
+// id 1099
+sphere{<2.78596,2.92411,7.96461>,s}
+// id 1111
+sphere{<4.26404,3.47419,8.3589>,s}
+// id 1179
+sphere{<4.20922,3.00992,9.24287>,s}
+// id 1193
+sphere{<3.32727,3.35511,8.68773>,s}
+// id 1203
+sphere{<3.50407,4.23949,9.14302>,s}
+// id 1044
+sphere{<-1.85415,5.17818,8.3607>,s}
+// id 1196
+sphere{<-1.19383,5.3694,9.08664>,s}
+// id 1201
+sphere{<-2.76106,4.7576,8.35246>,s}
+// id 1247
+sphere{<-2.16745,4.6501,9.14998>,s}
+// id 1094
+sphere{<0.496738,5.47765,7.94939>,s}
+// id 1141
+sphere{<-0.582987,5.46905,8.30149>,s}
+// id 1217
+sphere{<0.11024,5.27413,8.99526>,s}
+// id 1132
+sphere{<1.94683,5.14417,8.34036>,s}
+// id 1176
+sphere{<1.07485,5.39431,8.76074>,s}
+// id 1113
+sphere{<2.81479,4.7257,8.60688>,s}
+// id 1202
+sphere{<-2.74794,-4.76468,9.52543>,s}
+// id 1268
+sphere{<-1.84019,-5.18323,9.50664>,s}
+// id 1342
+sphere{<-0.967967,-5.41417,9.93723>,s}
+// id 1415
+sphere{<-2.28901,-5.00145,10.3814>,s}
+// id 1306
+sphere{<0.213131,-5.49602,9.89107>,s}
+// id 1400
+sphere{<0.642855,-4.65059,10.4674>,s}
+// id 1343
+sphere{<1.45551,-5.30433,10.0068>,s}
+// id 1336
+sphere{<2.40667,-4.94588,9.85481>,s}
+// id 1250
+sphere{<-3.04068,-3.8158,9.40892>,s}
+// id 1269
+sphere{<-3.68667,-3.05738,9.67728>,s}
+// id 1411
+sphere{<-3.30406,-4.39701,10.2705>,s}
+// id 1360
+sphere{<-4.04444,-3.72738,10.3276>,s}
+// id 1199
+sphere{<-0.975062,-4.63668,9.30501>,s}
+// id 1255
+sphere{<-1.57254,-3.0743,9.80745>,s}
+// id 1346
+sphere{<-1.41215,-4.55675,10.2008>,s}
+// id 1279
+sphere{<-2.1184,-4.01734,9.73789>,s}
+// id 1410
+sphere{<-2.75645,-3.51094,10.3178>,s}
+// id 1204
+sphere{<0.86208,-4.48059,9.50682>,s}
+// id 1227
+sphere{<0.444811,-2.81293,9.65532>,s}
+// id 1276
+sphere{<-0.146937,-4.5637,9.86044>,s}
+// id 1330
+sphere{<-0.822693,-3.82249,9.86477>,s}
+// id 1277
+sphere{<0.125803,-3.63788,10.1216>,s}
+// id 1326
+sphere{<-0.529095,-2.87964,10.0208>,s}
+// id 1241
+sphere{<1.19075,-3.47598,9.59272>,s}
+// id 1270
+sphere{<2.50109,-3.96198,9.70554>,s}
+// id 1321
+sphere{<2.09288,-3.03103,9.93967>,s}
+// id 1397
+sphere{<1.65651,-4.32915,10.0946>,s}
+// id 1492
+sphere{<1.01471,-3.72818,10.5704>,s}
+// id 1221
+sphere{<4.25733,-3.48293,9.27482>,s}
+// id 1261
+sphere{<3.05574,-3.14699,9.54173>,s}
+// id 1287
+sphere{<3.66968,-4.09704,9.80125>,s}
+// id 1332
+sphere{<3.85795,-3.17465,10.1379>,s}
+// id 1354
+sphere{<2.9804,-3.52346,10.4654>,s}
+// id 1366
+sphere{<3.08644,-4.55243,10.4735>,s}
+// id 1314
+sphere{<4.73315,-2.80211,9.83153>,s}
+// id 1331
+sphere{<-4.96307,-2.37117,9.87614>,s}
+// id 1353
+sphere{<-5.30257,-1.46131,10.1161>,s}
+// id 1178
+sphere{<-4.33335,-1.08587,9.52261>,s}
+// id 1273
+sphere{<-3.35936,-1.88915,9.57769>,s}
+// id 1356
+sphere{<-4.02514,-2.2829,10.2113>,s}
+// id 1393
+sphere{<-3.72231,-1.33781,10.3301>,s}
+// id 1303
+sphere{<-3.08837,-2.08757,10.5194>,s}
+// id 1226
+sphere{<-1.06917,-1.42342,9.30913>,s}
+// id 1294
+sphere{<-1.21623,-2.15494,9.97353>,s}
+// id 1328
+sphere{<-2.76917,-2.67202,9.77396>,s}
+// id 1329
+sphere{<-2.17967,-1.88773,9.96657>,s}
+// id 1350
+sphere{<-2.58757,-1.05509,10.3405>,s}
+// id 1231
+sphere{<-0.0738356,-1.33838,9.35127>,s}
+// id 1283
+sphere{<0.231605,-1.93842,10.0905>,s}
+// id 1239
+sphere{<-0.614392,-1.30711,10.1918>,s}
+// id 1219
+sphere{<1.49869,-2.40427,9.43486>,s}
+// id 1243
+sphere{<2.40967,-1.50973,9.64043>,s}
+// id 1265
+sphere{<1.14627,-1.58708,9.89079>,s}
+// id 1390
+sphere{<1.91547,-2.08384,10.2926>,s}
+// id 1335
+sphere{<1.19888,-2.78059,10.3112>,s}
+// id 1235
+sphere{<4.26383,-1.62888,9.40676>,s}
+// id 1257
+sphere{<3.35985,-1.21988,9.52995>,s}
+// id 1352
+sphere{<3.08185,-2.28134,10.0405>,s}
+// id 1349
+sphere{<4.05962,-2.17342,10.2202>,s}
+// id 1376
+sphere{<3.81964,-1.21921,10.4175>,s}
+// id 1267
+sphere{<5.33519,-1.33738,9.59293>,s}
+// id 1319
+sphere{<5.11993,-2.00935,10.302>,s}
+// id 1183
+sphere{<-4.93783,-0.16781,9.90827>,s}
+// id 1215
+sphere{<-5.43725,-0.831341,9.352>,s}
+// id 1232
+sphere{<-5.46663,0.607379,9.56348>,s}
+// id 1381
+sphere{<-5.48705,0.379233,10.5397>,s}
+// id 1245
+sphere{<-3.6834,0.92766,9.55322>,s}
+// id 1259
+sphere{<-3.27351,-0.698309,9.70655>,s}
+// id 1369
+sphere{<-4.6037,0.886683,9.99095>,s}
+// id 1286
+sphere{<-4.01625,-0.0152103,9.55288>,s}
+// id 1384
+sphere{<-3.80313,0.501523,10.4495>,s}
+// id 1421
+sphere{<-4.14253,-0.438753,10.4502>,s}
+// id 1174
+sphere{<-0.929856,-0.434622,9.33788>,s}
+// id 1237
+sphere{<-2.0132,0.656441,9.26089>,s}
+// id 1289
+sphere{<-1.70097,-0.845102,9.82463>,s}
+// id 1288
+sphere{<-2.76349,0.77034,9.91205>,s}
+// id 1309
+sphere{<-1.4906,0.136787,9.93639>,s}
+// id 1320
+sphere{<-2.44044,-0.175477,9.8884>,s}
+// id 1256
+sphere{<-0.601333,0.486552,9.64184>,s}
+// id 1305
+sphere{<-0.642795,-0.28009,10.2824>,s}
+// id 1311
+sphere{<0.353348,0.216851,9.947>,s}
+// id 1307
+sphere{<0.217868,-0.75941,10.112>,s}
+// id 1291
+sphere{<0.9256,0.900245,10.3999>,s}
+// id 1154
+sphere{<1.38838,0.23242,9.38387>,s}
+// id 1210
+sphere{<0.966306,-0.677966,9.4541>,s}
+// id 1278
+sphere{<2.76638,-0.68289,10.1293>,s}
+// id 1290
+sphere{<2.24832,0.136552,9.88475>,s}
+// id 1297
+sphere{<1.78296,-0.825731,10.0125>,s}
+// id 1373
+sphere{<1.92774,0.916097,10.4226>,s}
+// id 1251
+sphere{<1.25441,-0.0415785,10.3362>,s}
+// id 1218
+sphere{<4.03197,-0.0926042,9.38417>,s}
+// id 1252
+sphere{<4.56132,0.851595,9.43377>,s}
+// id 1249
+sphere{<3.19163,0.375783,9.65542>,s}
+// id 1308
+sphere{<4.54604,-0.793865,9.87788>,s}
+// id 1334
+sphere{<4.61187,0.163497,10.1572>,s}
+// id 1361
+sphere{<3.64839,-0.241879,10.2952>,s}
+// id 1351
+sphere{<3.81801,0.742282,10.3433>,s}
+// id 1240
+sphere{<5.48145,0.454232,9.38485>,s}
+// id 1285
+sphere{<5.49157,-0.303566,10.0536>,s}
+// id 1337
+sphere{<5.46239,0.645736,10.3659>,s}
+// id 1238
+sphere{<-5.26951,1.57678,9.70806>,s}
+// id 1284
+sphere{<-4.70892,2.40434,9.71479>,s}
+// id 1228
+sphere{<-3.24932,1.82787,9.52425>,s}
+// id 1298
+sphere{<-3.60726,2.77492,10.0225>,s}
+// id 1382
+sphere{<-4.05879,1.75345,10.1063>,s}
+// id 1271
+sphere{<-2.2587,1.74669,9.41798>,s}
+// id 1254
+sphere{<-2.65512,2.59043,9.7795>,s}
+// id 1281
+sphere{<-1.26572,1.66959,9.50398>,s}
+// id 1316
+sphere{<-1.81052,1.11014,10.1284>,s}
+// id 1341
+sphere{<-1.77885,2.25945,10.1296>,s}
+// id 1293
+sphere{<-2.63727,1.66502,10.3397>,s}
+// id 1109
+sphere{<0.176355,2.35431,9.28616>,s}
+// id 1189
+sphere{<0.535869,0.931912,9.27304>,s}
+// id 1312
+sphere{<-0.739684,2.50582,9.6565>,s}
+// id 1318
+sphere{<-0.490387,1.38463,10.0673>,s}
+// id 1233
+sphere{<0.46259,1.6639,9.95027>,s}
+// id 1181
+sphere{<1.14671,2.14189,9.39922>,s}
+// id 1197
+sphere{<1.97888,2.6703,9.56659>,s}
+// id 1248
+sphere{<2.70073,1.22081,9.86629>,s}
+// id 1229
+sphere{<1.43989,1.20745,9.59981>,s}
+// id 1315
+sphere{<2.7479,2.2092,10.0087>,s}
+// id 1357
+sphere{<1.8116,1.91512,10.2005>,s}
+// id 1242
+sphere{<3.64749,1.25195,9.50016>,s}
+// id 1230
+sphere{<3.62594,2.25104,9.53247>,s}
+// id 1295
+sphere{<4.28497,1.73916,10.1033>,s}
+// id 1338
+sphere{<3.76135,2.49702,10.4922>,s}
+// id 1395
+sphere{<3.33442,1.59435,10.5433>,s}
+// id 1211
+sphere{<5.26987,1.57489,10.0513>,s}
+// id 1220
+sphere{<4.93186,2.43492,9.65697>,s}
+// id 1296
+sphere{<-4.3677,3.34375,9.7107>,s}
+// id 1325
+sphere{<-3.71111,4.05933,9.94852>,s}
+// id 1358
+sphere{<-3.06194,3.49229,10.4555>,s}
+// id 1207
+sphere{<-1.4451,3.98325,9.33306>,s}
+// id 1266
+sphere{<-1.81201,3.0812,9.56089>,s}
+// id 1310
+sphere{<-2.54129,3.87277,9.69119>,s}
+// id 1317
+sphere{<-1.26382,4.41296,10.2172>,s}
+// id 1387
+sphere{<-1.6169,3.42117,10.4801>,s}
+// id 1191
+sphere{<-0.00795946,4.3146,9.25076>,s}
+// id 1274
+sphere{<0.657058,3.76871,9.77033>,s}
+// id 1300
+sphere{<-0.0879857,3.31846,9.27884>,s}
+// id 1333
+sphere{<-0.779091,3.57224,9.95552>,s}
+// id 1313
+sphere{<0.115109,2.86218,10.1453>,s}
+// id 1182
+sphere{<2.65276,3.74554,9.31955>,s}
+// id 1225
+sphere{<1.59721,3.59034,9.48109>,s}
+// id 1292
+sphere{<1.10723,2.91515,10.0318>,s}
+// id 1322
+sphere{<1.9386,4.36778,10.0089>,s}
+// id 1348
+sphere{<2.28268,3.41287,10.1868>,s}
+// id 1339
+sphere{<0.988159,4.60163,10.2137>,s}
+// id 1347
+sphere{<1.38347,3.7296,10.542>,s}
+// id 1264
+sphere{<4.00693,3.76763,9.86651>,s}
+// id 1260
+sphere{<3.19027,3.09196,9.8519>,s}
+// id 1301
+sphere{<4.56026,3.07542,10.3288>,s}
+// id 1299
+sphere{<3.09782,4.02342,10.2023>,s}
+// id 1224
+sphere{<-1.77339,5.20642,9.88446>,s}
+// id 1282
+sphere{<-2.67762,4.80477,10.0268>,s}
+// id 1365
+sphere{<-1.02528,5.40362,10.5178>,s}
+// id 1275
+sphere{<0.782554,5.44407,9.71574>,s}
+// id 1236
+sphere{<-0.530726,5.01032,9.74287>,s}
+// id 1340
+sphere{<0.0494861,5.49984,10.3936>,s}
+// id 1280
+sphere{<2.76759,4.75347,9.60472>,s}
+// id 1244
+sphere{<1.73736,5.21855,9.48871>,s}
+// id 1438
+sphere{<1.73229,5.22034,10.4885>,s}
+// id 1449
+sphere{<-2.8444,-4.70783,11.1591>,s}
+// id 1404
+sphere{<-1.37727,-5.32508,10.8451>,s}
+// id 1595
+sphere{<-1.72119,-5.22398,11.8152>,s}
+// id 1399
+sphere{<-0.348297,-5.48925,10.7183>,s}
+// id 1485
+sphere{<0.250386,-4.97164,11.3292>,s}
+// id 1547
+sphere{<-0.764946,-5.4466,11.6261>,s}
+// id 1462
+sphere{<2.06243,-5.09897,10.7807>,s}
+// id 1498
+sphere{<1.86448,-5.17454,11.7578>,s}
+// id 1523
+sphere{<1.11936,-5.38505,10.9501>,s}
+// id 1445
+sphere{<-3.50544,-2.97674,10.7097>,s}
+// id 1467
+sphere{<-4.6301,-2.9692,10.6141>,s}
+// id 1514
+sphere{<-3.64953,-4.11492,11.1655>,s}
+// id 1530
+sphere{<-4.30887,-3.41818,11.4478>,s}
+// id 1552
+sphere{<-3.32487,-3.29691,11.6399>,s}
+// id 1323
+sphere{<-1.7169,-3.6808,10.5892>,s}
+// id 1441
+sphere{<-1.29706,-2.78667,10.7436>,s}
+// id 1484
+sphere{<-2.52845,-3.7646,11.2576>,s}
+// id 1493
+sphere{<-1.8654,-4.50322,11.1376>,s}
+// id 1496
+sphere{<-1.68239,-3.29693,11.5117>,s}
+// id 1533
+sphere{<-1.04961,-4.07084,11.5216>,s}
+// id 1363
+sphere{<0.253505,-2.79033,10.6365>,s}
+// id 1422
+sphere{<-0.583374,-4.51829,10.7588>,s}
+// id 1413
+sphere{<0.664237,-3.19129,11.4552>,s}
+// id 1442
+sphere{<-0.617658,-3.5183,10.7948>,s}
+// id 1542
+sphere{<-0.72055,-3.09473,11.6947>,s}
+// id 1548
+sphere{<0.205892,-4.00172,11.0904>,s}
+// id 1555
+sphere{<0.774488,-4.30208,11.8559>,s}
+// id 1402
+sphere{<2.0229,-3.64573,10.7254>,s}
+// id 1450
+sphere{<1.59051,-2.89496,11.2241>,s}
+// id 1519
+sphere{<2.50519,-4.3404,11.2588>,s}
+// id 1528
+sphere{<1.49497,-4.37169,11.1661>,s}
+// id 1556
+sphere{<1.9303,-3.68427,11.7473>,s}
+// id 1385
+sphere{<4.61161,-2.99718,10.8047>,s}
+// id 1473
+sphere{<3.83309,-3.94431,10.7759>,s}
+// id 1479
+sphere{<2.84245,-3.40427,11.4483>,s}
+// id 1525
+sphere{<4.237,-3.50682,11.5793>,s}
+// id 1575
+sphere{<3.43517,-4.29534,11.6234>,s}
+// id 1453
+sphere{<-4.79145,-1.99747,10.787>,s}
+// id 1474
+sphere{<-4.66545,-1.0418,11.0525>,s}
+// id 1536
+sphere{<-4.85231,-2.59076,11.589>,s}
+// id 1560
+sphere{<-5.24985,-1.6403,11.6006>,s}
+// id 1461
+sphere{<-3.16161,-1.19937,11.1464>,s}
+// id 1469
+sphere{<-3.85784,-1.91643,11.1342>,s}
+// id 1532
+sphere{<-3.02832,-2.35521,11.481>,s}
+// id 1302
+sphere{<-1.5142,-1.44021,10.6062>,s}
+// id 1374
+sphere{<-2.28569,-2.66966,10.6493>,s}
+// id 1409
+sphere{<-2.33326,-1.7557,11.0844>,s}
+// id 1466
+sphere{<-1.24886,-2.02005,11.3838>,s}
+// id 1495
+sphere{<-1.68785,-1.13577,11.5427>,s}
+// id 1543
+sphere{<-2.07824,-2.42067,11.7859>,s}
+// id 1344
+sphere{<-0.77512,-1.00466,11.1312>,s}
+// id 1370
+sphere{<0.129325,-1.36462,10.9029>,s}
+// id 1435
+sphere{<-0.521635,-2.15632,10.7111>,s}
+// id 1456
+sphere{<0.859124,-1.24523,11.6137>,s}
+// id 1463
+sphere{<0.158384,-2.20609,11.4422>,s}
+// id 1327
+sphere{<1.0222,-0.968871,10.6667>,s}
+// id 1368
+sphere{<0.930817,-1.95466,10.8067>,s}
+// id 1388
+sphere{<1.97161,-1.03758,10.9714>,s}
+// id 1403
+sphere{<2.7655,-1.54438,10.6369>,s}
+// id 1407
+sphere{<2.48352,-2.72539,10.8078>,s}
+// id 1433
+sphere{<2.0045,-1.98685,11.2837>,s}
+// id 1534
+sphere{<1.10669,-2.2029,11.7593>,s}
+// id 1538
+sphere{<2.7042,-1.41151,11.7068>,s}
+// id 1452
+sphere{<3.47595,-2.6356,10.8881>,s}
+// id 1458
+sphere{<4.51975,-1.62593,11.0039>,s}
+// id 1476
+sphere{<3.54194,-1.70408,11.2463>,s}
+// id 1553
+sphere{<4.09044,-0.958538,11.6248>,s}
+// id 1570
+sphere{<2.88808,-2.39327,11.6598>,s}
+// id 1605
+sphere{<3.9935,-2.45694,11.7241>,s}
+// id 1324
+sphere{<5.3877,-1.10714,10.6392>,s}
+// id 1544
+sphere{<5.31119,-1.42961,11.5825>,s}
+// id 1603
+sphere{<4.96527,-2.3662,11.5071>,s}
+// id 1437
+sphere{<-4.78609,-0.049887,11.1094>,s}
+// id 1389
+sphere{<-5.4655,-0.617931,10.6282>,s}
+// id 1486
+sphere{<-5.44836,0.750003,11.4676>,s}
+// id 1526
+sphere{<-5.45987,-0.663055,11.627>,s}
+// id 1412
+sphere{<-2.9725,0.815024,10.9089>,s}
+// id 1427
+sphere{<-3.16703,-0.255832,10.5969>,s}
+// id 1503
+sphere{<-3.97988,0.44721,11.4319>,s}
+// id 1477
+sphere{<-3.87255,-0.546501,11.4071>,s}
+// id 1509
+sphere{<-3.05719,0.103309,11.6059>,s}
+// id 1375
+sphere{<-1.01385,0.716602,10.5968>,s}
+// id 1383
+sphere{<-1.51241,-0.450138,10.7457>,s}
+// id 1405
+sphere{<-2.12238,0.339645,10.6841>,s}
+// id 1431
+sphere{<-2.40784,-0.543657,11.1806>,s}
+// id 1472
+sphere{<-1.17479,0.692051,11.5833>,s}
+// id 1554
+sphere{<-1.23358,-0.283339,11.8014>,s}
+// id 1561
+sphere{<-2.06815,0.253678,11.6786>,s}
+// id 1392
+sphere{<-0.499566,0.0551124,11.2127>,s}
+// id 1362
+sphere{<-0.0200389,0.764781,10.6953>,s}
+// id 1425
+sphere{<0.419965,-0.14731,10.8765>,s}
+// id 1455
+sphere{<0.0330192,-0.682372,11.6274>,s}
+// id 1494
+sphere{<0.260995,0.551551,11.6309>,s}
+// id 1380
+sphere{<1.41367,0.58168,11.2123>,s}
+// id 1460
+sphere{<2.10527,-0.0527738,10.8613>,s}
+// id 1459
+sphere{<1.34764,-0.394612,11.4174>,s}
+// id 1508
+sphere{<2.27938,-0.508285,11.7615>,s}
+// id 1377
+sphere{<2.85905,0.542451,10.5833>,s}
+// id 1406
+sphere{<4.57851,-0.558813,10.849>,s}
+// id 1426
+sphere{<3.18756,-0.730515,11.0358>,s}
+// id 1451
+sphere{<3.89138,0.0690429,11.2139>,s}
+// id 1465
+sphere{<2.94655,0.194166,11.5161>,s}
+// id 1551
+sphere{<3.631,0.895633,11.7124>,s}
+// id 1414
+sphere{<5.47797,-0.16785,11.0442>,s}
+// id 1430
+sphere{<4.75392,0.555673,11.0656>,s}
+// id 1518
+sphere{<5.47435,0.531941,11.7586>,s}
+// id 1541
+sphere{<4.69708,-0.162348,11.759>,s}
+// id 1396
+sphere{<-4.99657,2.2991,10.6667>,s}
+// id 1367
+sphere{<-5.33011,1.35654,10.6815>,s}
+// id 1470
+sphere{<-5.18064,1.84705,11.54>,s}
+// id 1527
+sphere{<-4.76109,2.75457,11.5258>,s}
+// id 1394
+sphere{<-4.04095,2.50105,10.8805>,s}
+// id 1423
+sphere{<-2.94993,2.52855,10.7342>,s}
+// id 1439
+sphere{<-4.34272,1.21415,10.8987>,s}
+// id 1444
+sphere{<-3.46156,1.68679,10.9054>,s}
+// id 1500
+sphere{<-3.59769,1.35282,11.838>,s}
+// id 1562
+sphere{<-3.93656,2.29341,11.8531>,s}
+// id 1593
+sphere{<-4.57099,1.12546,11.8677>,s}
+// id 1345
+sphere{<-1.22614,1.68424,10.7326>,s}
+// id 1391
+sphere{<-0.994887,2.64961,10.6122>,s}
+// id 1408
+sphere{<-1.9252,2.28649,11.1185>,s}
+// id 1428
+sphere{<-2.09355,1.26137,11.0752>,s}
+// id 1483
+sphere{<-1.50677,1.60811,11.8061>,s}
+// id 1539
+sphere{<-2.77311,1.99556,11.5616>,s}
+// id 1579
+sphere{<-2.64767,1.04365,11.8785>,s}
+// id 1424
+sphere{<0.574774,1.39458,11.1946>,s}
+// id 1447
+sphere{<-0.150107,2.07646,10.7041>,s}
+// id 1475
+sphere{<-0.832003,2.29229,11.5316>,s}
+// id 1502
+sphere{<-0.487025,1.37442,11.3357>,s}
+// id 1521
+sphere{<0.396412,2.32882,11.5026>,s}
+// id 1419
+sphere{<1.78546,2.75138,10.7481>,s}
+// id 1417
+sphere{<2.47595,2.0022,10.9482>,s}
+// id 1420
+sphere{<0.932613,2.16918,10.6738>,s}
+// id 1446
+sphere{<1.59402,1.55996,11.111>,s}
+// id 1481
+sphere{<1.38851,2.40803,11.5993>,s}
+// id 1489
+sphere{<2.42073,1.04195,11.3304>,s}
+// id 1497
+sphere{<2.31671,2.77993,11.5947>,s}
+// id 1567
+sphere{<2.16581,1.83478,11.8839>,s}
+// id 1490
+sphere{<4.42975,2.20165,11.5303>,s}
+// id 1436
+sphere{<3.2747,1.80938,11.518>,s}
+// id 1471
+sphere{<4.18077,1.37405,11.0281>,s}
+// id 1513
+sphere{<3.5982,2.75477,11.4817>,s}
+// id 1401
+sphere{<5.32476,1.37693,11.0338>,s}
+// id 1448
+sphere{<5.0091,2.27187,10.7187>,s}
+// id 1372
+sphere{<-4.09557,3.47574,10.6638>,s}
+// id 1359
+sphere{<-3.25394,4.43425,10.7549>,s}
+// id 1501
+sphere{<-3.79099,3.98513,11.4685>,s}
+// id 1515
+sphere{<-3.42428,3.05533,11.4394>,s}
+// id 1549
+sphere{<-2.85465,3.81241,11.7737>,s}
+// id 1355
+sphere{<-2.30992,4.12005,10.6552>,s}
+// id 1443
+sphere{<-2.36125,3.23726,11.1218>,s}
+// id 1454
+sphere{<-1.41236,3.09631,11.4034>,s}
+// id 1516
+sphere{<-1.89787,4.00798,11.5589>,s}
+// id 1371
+sphere{<0.0751927,3.7605,10.5826>,s}
+// id 1418
+sphere{<-0.840038,3.79985,10.9823>,s}
+// id 1304
+sphere{<-0.396717,4.63858,10.6613>,s}
+// id 1434
+sphere{<0.727942,3.10377,10.9643>,s}
+// id 1440
+sphere{<-0.247337,3.01578,11.1661>,s}
+// id 1487
+sphere{<0.49992,4.51253,11.0857>,s}
+// id 1488
+sphere{<-0.344977,4.55739,11.6566>,s}
+// id 1505
+sphere{<0.231339,3.74037,11.6615>,s}
+// id 1457
+sphere{<2.3132,3.9768,11.0118>,s}
+// id 1482
+sphere{<1.49586,4.52994,11.1721>,s}
+// id 1506
+sphere{<1.53853,3.39576,11.4718>,s}
+// id 1364
+sphere{<3.70797,3.47675,10.7753>,s}
+// id 1566
+sphere{<3.91841,3.85968,11.776>,s}
+// id 1416
+sphere{<3.36132,4.35349,11.1084>,s}
+// id 1429
+sphere{<2.89356,2.89666,10.7866>,s}
+// id 1432
+sphere{<4.49014,3.17712,11.321>,s}
+// id 1499
+sphere{<2.98767,3.53698,11.6044>,s}
+// id 1386
+sphere{<-2.10048,5.08343,10.8212>,s}
+// id 1468
+sphere{<-1.25451,4.68795,11.1783>,s}
+// id 1491
+sphere{<-2.72929,4.77518,11.5349>,s}
+// id 1378
+sphere{<0.8737,5.43055,10.9554>,s}
+// id 1398
+sphere{<-0.394728,5.48604,11.2894>,s}
+// id 1480
+sphere{<0.408814,5.19651,11.8092>,s}
+// id 1379
+sphere{<2.6437,4.82316,10.5944>,s}
+// id 1478
+sphere{<2.31121,4.99099,11.5222>,s}
+// id 1545
+sphere{<1.40597,5.31691,11.7943>,s}
+// id 1656
+sphere{<-1.03562,-5.13785,12.5379>,s}
+// id 1659
+sphere{<-2.34319,-4.9759,12.5577>,s}
+// id 1588
+sphere{<0.91137,-5.4242,11.9274>,s}
+// id 1625
+sphere{<-0.0178572,-5.50025,12.2883>,s}
+// id 1692
+sphere{<0.555736,-4.79206,12.6995>,s}
+// id 1522
+sphere{<2.70795,-4.78742,12.1297>,s}
+// id 1630
+sphere{<1.44124,-5.30792,12.7673>,s}
+// id 1700
+sphere{<2.34367,-4.97573,13.0416>,s}
+// id 1601
+sphere{<-3.11648,-4.53184,12.1051>,s}
+// id 1615
+sphere{<-3.8813,-3.89696,12.2145>,s}
+// id 1634
+sphere{<-4.59763,-3.01946,12.457>,s}
+// id 1669
+sphere{<-3.12533,-3.61754,12.8064>,s}
+// id 1727
+sphere{<-4.15209,-3.60695,13.1324>,s}
+// id 1742
+sphere{<-3.06542,-4.56668,13.1152>,s}
+// id 1550
+sphere{<-1.02804,-3.84491,12.4954>,s}
+// id 1607
+sphere{<-1.90267,-4.10734,12.0547>,s}
+// id 1624
+sphere{<-2.45939,-3.2813,12.1405>,s}
+// id 1666
+sphere{<-1.75681,-4.27324,13.0296>,s}
+// id 1698
+sphere{<-1.44121,-2.89394,12.3942>,s}
+// id 1726
+sphere{<-2.05707,-3.32018,13.0563>,s}
+// id 1574
+sphere{<0.014983,-3.67755,12.0394>,s}
+// id 1569
+sphere{<-0.366729,-4.60148,12.0234>,s}
+// id 1614
+sphere{<0.778997,-3.77186,12.7036>,s}
+// id 1617
+sphere{<-0.489122,-3.02115,12.6713>,s}
+// id 1640
+sphere{<-0.165223,-4.13244,12.9112>,s}
+// id 1622
+sphere{<1.30186,-3.06855,12.2221>,s}
+// id 1645
+sphere{<2.72617,-3.813,12.3533>,s}
+// id 1667
+sphere{<1.62958,-4.41345,12.3621>,s}
+// id 1671
+sphere{<1.88964,-3.57986,12.8489>,s}
+// id 1599
+sphere{<3.37336,-3.06193,12.2231>,s}
+// id 1654
+sphere{<3.87854,-3.89998,12.4278>,s}
+// id 1728
+sphere{<4.36427,-3.34736,13.1746>,s}
+// id 1737
+sphere{<3.20663,-4.46875,12.9355>,s}
+// id 1636
+sphere{<4.64461,-2.94691,12.3025>,s}
+// id 1572
+sphere{<-5.37217,-1.17953,12.4796>,s}
+// id 1616
+sphere{<-5.06931,-2.13365,12.4514>,s}
+// id 1524
+sphere{<-4.3124,-1.45132,11.8936>,s}
+// id 1565
+sphere{<-3.90991,-2.53539,11.917>,s}
+// id 1589
+sphere{<-3.41379,-1.73052,12.2419>,s}
+// id 1610
+sphere{<-3.13262,-2.65561,12.5335>,s}
+// id 1618
+sphere{<-4.44294,-1.18551,12.8486>,s}
+// id 1705
+sphere{<-4.13408,-2.13526,12.8052>,s}
+// id 1712
+sphere{<-3.01097,-1.904,13.1814>,s}
+// id 1688
+sphere{<-2.20517,-2.37178,12.7765>,s}
+// id 1606
+sphere{<-2.4523,-1.53214,12.0517>,s}
+// id 1648
+sphere{<-1.51166,-1.75167,12.3105>,s}
+// id 1683
+sphere{<-2.16674,-1.39876,13.0033>,s}
+// id 1717
+sphere{<-1.28365,-2.25444,13.1465>,s}
+// id 1529
+sphere{<-0.586282,-2.19692,12.1135>,s}
+// id 1573
+sphere{<0.374769,-2.69984,12.2841>,s}
+// id 1578
+sphere{<-0.674861,-1.20109,12.1065>,s}
+// id 1623
+sphere{<0.258232,-1.69298,12.2943>,s}
+// id 1646
+sphere{<-0.48204,-1.68456,12.9663>,s}
+// id 1685
+sphere{<0.328185,-2.23488,13.1681>,s}
+// id 1563
+sphere{<1.75923,-1.36918,12.0309>,s}
+// id 1626
+sphere{<2.04294,-2.39802,12.1943>,s}
+// id 1641
+sphere{<1.22413,-2.08693,12.7455>,s}
+// id 1642
+sphere{<1.00209,-1.11832,12.6347>,s}
+// id 1661
+sphere{<2.13107,-1.69509,12.9>,s}
+// id 1710
+sphere{<2.14147,-2.66188,13.1549>,s}
+// id 1590
+sphere{<3.54072,-1.55425,12.2356>,s}
+// id 1598
+sphere{<2.92316,-2.27992,12.6536>,s}
+// id 1651
+sphere{<4.52243,-1.71104,12.1286>,s}
+// id 1697
+sphere{<3.98063,-2.3145,12.7134>,s}
+// id 1745
+sphere{<3.13397,-1.43281,13.141>,s}
+// id 1777
+sphere{<4.41165,-1.53806,13.1727>,s}
+// id 1715
+sphere{<5.29819,-1.47663,12.7144>,s}
+// id 1783
+sphere{<4.9677,-2.36056,13.0451>,s}
+// id 1504
+sphere{<-5.49877,0.122488,12.2445>,s}
+// id 1718
+sphere{<-5.02199,-0.379072,12.9661>,s}
+// id 1511
+sphere{<-4.61165,-0.343391,12.0493>,s}
+// id 1585
+sphere{<-3.59861,0.496864,12.3549>,s}
+// id 1576
+sphere{<-4.62934,0.474538,12.6243>,s}
+// id 1587
+sphere{<-3.14842,-0.784699,12.056>,s}
+// id 1650
+sphere{<-3.82309,-0.416027,12.6955>,s}
+// id 1687
+sphere{<-2.81419,-0.637005,12.9866>,s}
+// id 1643
+sphere{<-2.18181,-0.583198,12.2139>,s}
+// id 1600
+sphere{<-2.63806,0.260467,12.5001>,s}
+// id 1611
+sphere{<-1.81984,0.880968,12.4163>,s}
+// id 1653
+sphere{<-1.37213,-0.855131,12.7339>,s}
+// id 1664
+sphere{<-1.22496,0.133504,12.7111>,s}
+// id 1655
+sphere{<0.0618575,-0.768278,12.6259>,s}
+// id 1507
+sphere{<0.711136,-0.170984,12.1552>,s}
+// id 1564
+sphere{<-0.370196,0.0284413,12.2034>,s}
+// id 1608
+sphere{<0.217839,0.703184,12.649>,s}
+// id 1660
+sphere{<0.680787,-0.186674,13.1543>,s}
+// id 1679
+sphere{<-0.31116,0.0585492,13.2006>,s}
+// id 1597
+sphere{<2.00879,0.424291,12.0003>,s}
+// id 1631
+sphere{<1.63185,-0.352609,12.5069>,s}
+// id 1686
+sphere{<1.20168,0.530697,12.6914>,s}
+// id 1714
+sphere{<2.51008,-0.793657,12.6915>,s}
+// id 1736
+sphere{<2.67584,0.85308,13.2031>,s}
+// id 1517
+sphere{<2.82581,0.150493,12.5077>,s}
+// id 1535
+sphere{<3.239,-0.623672,12.0285>,s}
+// id 1584
+sphere{<3.88221,0.106313,12.2721>,s}
+// id 1672
+sphere{<4.53194,-0.790645,12.5193>,s}
+// id 1680
+sphere{<4.431,0.892856,12.9478>,s}
+// id 1695
+sphere{<3.64625,-0.597874,12.9413>,s}
+// id 1730
+sphere{<3.57774,0.421557,13.1707>,s}
+// id 1583
+sphere{<5.4625,-0.645144,12.1838>,s}
+// id 1613
+sphere{<5.09158,0.17873,12.6121>,s}
+// id 1709
+sphere{<5.47228,-0.551553,13.1794>,s}
+// id 1619
+sphere{<-4.98609,2.32141,12.3985>,s}
+// id 1673
+sphere{<-5.38993,1.09703,12.44>,s}
+// id 1690
+sphere{<-5.21637,1.74363,13.1825>,s}
+// id 1628
+sphere{<-4.22949,1.70119,12.6102>,s}
+// id 1701
+sphere{<-3.16122,2.27098,12.484>,s}
+// id 1674
+sphere{<-4.11949,2.68327,12.7611>,s}
+// id 1676
+sphere{<-3.12596,1.29954,12.7186>,s}
+// id 1721
+sphere{<-3.94177,0.935547,13.1852>,s}
+// id 1581
+sphere{<-1.5322,2.52108,12.2123>,s}
+// id 1612
+sphere{<-2.27897,1.80619,12.41>,s}
+// id 1635
+sphere{<-1.36135,1.69578,12.7915>,s}
+// id 1629
+sphere{<-0.620966,1.11904,12.2979>,s}
+// id 1559
+sphere{<0.263033,1.55674,12.1304>,s}
+// id 1604
+sphere{<0.80364,2.34807,12.4156>,s}
+// id 1627
+sphere{<-0.509631,2.09974,12.4581>,s}
+// id 1668
+sphere{<-0.0735473,1.52022,13.1464>,s}
+// id 1720
+sphere{<0.182669,2.62244,13.1498>,s}
+// id 1699
+sphere{<0.915627,1.46954,12.8828>,s}
+// id 1568
+sphere{<1.19366,1.21046,11.958>,s}
+// id 1647
+sphere{<1.76359,2.27621,12.6858>,s}
+// id 1663
+sphere{<1.93905,1.20248,12.6244>,s}
+// id 1716
+sphere{<2.59076,1.83824,13.0376>,s}
+// id 1531
+sphere{<4.59637,0.964132,11.9644>,s}
+// id 1594
+sphere{<3.95537,1.68066,12.2391>,s}
+// id 1609
+sphere{<2.93562,2.37644,12.2686>,s}
+// id 1620
+sphere{<2.87176,1.23826,12.2656>,s}
+// id 1677
+sphere{<3.49492,1.41435,13.0853>,s}
+// id 1678
+sphere{<4.08623,2.42007,12.8989>,s}
+// id 1537
+sphere{<5.21432,1.75021,11.9547>,s}
+// id 1662
+sphere{<5.09319,2.07592,12.8923>,s}
+// id 1658
+sphere{<5.38291,1.12919,12.7199>,s}
+// id 1596
+sphere{<-3.36796,3.24718,12.4192>,s}
+// id 1637
+sphere{<-4.30597,3.42229,12.1146>,s}
+// id 1682
+sphere{<-3.50688,4.23724,12.4012>,s}
+// id 1693
+sphere{<-4.13032,3.63209,13.0764>,s}
+// id 1512
+sphere{<-2.46631,2.82636,12.0273>,s}
+// id 1540
+sphere{<-1.19967,4.40657,12.153>,s}
+// id 1633
+sphere{<-1.61203,3.50455,12.374>,s}
+// id 1665
+sphere{<-2.08099,2.85817,12.9769>,s}
+// id 1684
+sphere{<-2.53233,3.71089,12.7146>,s}
+// id 1739
+sphere{<-1.84055,4.40291,12.9203>,s}
+// id 1464
+sphere{<-0.710759,3.55986,11.9443>,s}
+// id 1571
+sphere{<0.918486,3.32951,12.2603>,s}
+// id 1582
+sphere{<0.12167,4.57817,12.5407>,s}
+// id 1591
+sphere{<0.0083621,2.91849,12.2107>,s}
+// id 1638
+sphere{<0.310591,3.69309,12.9661>,s}
+// id 1644
+sphere{<-0.644614,3.96894,12.8599>,s}
+// id 1681
+sphere{<-0.841036,2.99393,12.7583>,s}
+// id 1510
+sphere{<0.939091,4.36749,11.9867>,s}
+// id 1577
+sphere{<2.00317,4.14115,11.9496>,s}
+// id 1621
+sphere{<2.7231,3.77455,12.5389>,s}
+// id 1632
+sphere{<1.90365,3.22132,12.391>,s}
+// id 1649
+sphere{<1.51622,4.32966,12.8024>,s}
+// id 1670
+sphere{<2.59635,2.91153,13.0422>,s}
+// id 1751
+sphere{<1.13209,2.93622,13.1546>,s}
+// id 1557
+sphere{<3.05899,4.571,12.0362>,s}
+// id 1602
+sphere{<3.53116,3.17071,12.3887>,s}
+// id 1639
+sphere{<3.64814,4.1162,12.7039>,s}
+// id 1702
+sphere{<4.31137,3.41502,12.9651>,s}
+// id 1558
+sphere{<4.7049,2.84894,12.2408>,s}
+// id 1546
+sphere{<-2.08007,5.09148,12.2266>,s}
+// id 1520
+sphere{<-1.17765,5.37355,11.9011>,s}
+// id 1689
+sphere{<-1.34469,5.27022,12.8812>,s}
+// id 1696
+sphere{<-2.77698,4.74756,12.8558>,s}
+// id 1580
+sphere{<-0.328983,5.49032,12.4166>,s}
+// id 1586
+sphere{<0.899478,5.42615,12.6494>,s}
+// id 1592
+sphere{<2.09152,5.0868,12.493>,s}
+// id 1740
+sphere{<2.88486,4.68274,13.0144>,s}
+// id 1750
+sphere{<-1.68612,-5.23556,13.2909>,s}
+// id 1781
+sphere{<-2.46382,-4.91728,13.8329>,s}
+// id 1914
+sphere{<-1.00397,-5.40796,14.0011>,s}
+// id 1762
+sphere{<0.709292,-5.45421,13.4327>,s}
+// id 1771
+sphere{<-0.389206,-5.48626,13.2165>,s}
+// id 1811
+sphere{<-0.0186439,-5.49999,14.145>,s}
+// id 1816
+sphere{<1.66834,-5.2397,13.7386>,s}
+// id 1859
+sphere{<0.943733,-5.41869,14.4041>,s}
+// id 1876
+sphere{<2.25394,-5.01704,14.5179>,s}
+// id 1723
+sphere{<-2.87078,-2.90781,13.4647>,s}
+// id 1836
+sphere{<-4.29748,-3.43314,14.1072>,s}
+// id 1851
+sphere{<-3.63442,-4.12811,13.8108>,s}
+// id 1862
+sphere{<-3.32309,-3.28271,14.2735>,s}
+// id 1957
+sphere{<-3.08376,-4.55418,14.5284>,s}
+// id 1729
+sphere{<-1.10991,-3.37159,13.3725>,s}
+// id 1807
+sphere{<-1.63004,-4.36482,14.0172>,s}
+// id 1841
+sphere{<-1.85584,-3.35189,14.0382>,s}
+// id 1860
+sphere{<-2.63913,-3.85729,13.6763>,s}
+// id 1725
+sphere{<0.231252,-3.22277,13.3348>,s}
+// id 1784
+sphere{<0.318133,-4.56553,13.6719>,s}
+// id 1802
+sphere{<-0.892503,-4.62697,13.3868>,s}
+// id 1824
+sphere{<0.847372,-3.72975,13.9375>,s}
+// id 1831
+sphere{<-0.365134,-3.84111,13.8465>,s}
+// id 1846
+sphere{<-0.918545,-3.16431,14.3318>,s}
+// id 1852
+sphere{<0.168165,-2.9672,14.2995>,s}
+// id 1919
+sphere{<-0.545734,-4.63111,14.4322>,s}
+// id 1713
+sphere{<1.24093,-4.41015,13.3194>,s}
+// id 1733
+sphere{<1.19091,-2.96739,13.2181>,s}
+// id 1767
+sphere{<1.91823,-3.36893,13.8259>,s}
+// id 1776
+sphere{<2.74265,-3.69065,13.3587>,s}
+// id 1848
+sphere{<2.1223,-4.34729,13.7871>,s}
+// id 1872
+sphere{<1.16649,-2.82116,14.207>,s}
+// id 1878
+sphere{<1.39657,-4.48608,14.4606>,s}
+// id 1741
+sphere{<3.43432,-2.98268,13.2179>,s}
+// id 1838
+sphere{<3.76539,-4.009,13.6255>,s}
+// id 1871
+sphere{<3.24457,-3.31913,14.1401>,s}
+// id 1890
+sphere{<4.32997,-3.39143,14.173>,s}
+// id 1930
+sphere{<3.05906,-4.57092,14.0559>,s}
+// id 1755
+sphere{<-5.23488,-1.68716,13.3305>,s}
+// id 1759
+sphere{<-4.84287,-2.60704,13.3343>,s}
+// id 1897
+sphere{<-5.25678,-1.61796,14.3278>,s}
+// id 1933
+sphere{<-4.85984,-2.57548,14.3336>,s}
+// id 1765
+sphere{<-3.59787,-1.11901,13.379>,s}
+// id 1788
+sphere{<-3.84971,-2.72769,13.5585>,s}
+// id 1806
+sphere{<-4.30989,-1.73994,13.7068>,s}
+// id 1826
+sphere{<-3.19216,-2.21827,14.1133>,s}
+// id 1887
+sphere{<-3.45366,-1.29687,14.4>,s}
+// id 1775
+sphere{<-2.05623,-2.41124,13.7644>,s}
+// id 1786
+sphere{<-2.48485,-1.52533,13.9428>,s}
+// id 1814
+sphere{<-1.34658,-1.75016,14.0076>,s}
+// id 1738
+sphere{<-0.48004,-2.58897,13.6386>,s}
+// id 1735
+sphere{<0.402955,-1.27022,13.4207>,s}
+// id 1782
+sphere{<-0.353745,-1.64342,13.9572>,s}
+// id 1869
+sphere{<-0.899359,-0.946768,14.4244>,s}
+// id 1894
+sphere{<0.550726,-2.03636,14.1225>,s}
+// id 1780
+sphere{<1.05675,-1.11927,14.162>,s}
+// id 1785
+sphere{<1.51893,-1.85928,13.6735>,s}
+// id 1849
+sphere{<2.4001,-1.40969,13.8197>,s}
+// id 1880
+sphere{<2.10116,-2.46593,14.2147>,s}
+// id 1787
+sphere{<4.16632,-2.48321,13.6812>,s}
+// id 1799
+sphere{<2.90516,-2.25747,13.658>,s}
+// id 1813
+sphere{<3.79027,-1.07764,13.8065>,s}
+// id 1893
+sphere{<3.02654,-0.930665,14.435>,s}
+// id 1906
+sphere{<4.35288,-1.7146,14.3333>,s}
+// id 1861
+sphere{<5.20708,-1.77126,13.8165>,s}
+// id 1979
+sphere{<4.86092,-2.57363,14.3947>,s}
+// id 1652
+sphere{<-5.47974,0.473861,13.2167>,s}
+// id 1803
+sphere{<-5.44004,-0.810513,13.7654>,s}
+// id 1853
+sphere{<-5.49882,0.111262,14.1484>,s}
+// id 1722
+sphere{<-4.44739,-0.696782,13.7208>,s}
+// id 1756
+sphere{<-3.26336,0.207194,13.2785>,s}
+// id 1763
+sphere{<-4.5774,0.287864,13.6052>,s}
+// id 1823
+sphere{<-3.79813,0.593982,14.1518>,s}
+// id 1839
+sphere{<-3.5579,-0.369981,14.0401>,s}
+// id 1915
+sphere{<-4.45079,-0.0838816,14.5248>,s}
+// id 1707
+sphere{<-1.61577,0.871359,13.9408>,s}
+// id 1711
+sphere{<-2.04939,-0.046898,13.2474>,s}
+// id 1732
+sphere{<-1.66765,-0.858527,13.6891>,s}
+// id 1797
+sphere{<-2.57471,-0.529385,13.9513>,s}
+// id 1800
+sphere{<-1.1671,0.00675539,13.7148>,s}
+// id 1801
+sphere{<-2.55736,0.470296,13.936>,s}
+// id 1865
+sphere{<-1.85565,-0.0342991,14.4388>,s}
+// id 1675
+sphere{<-0.907625,0.923379,13.2357>,s}
+// id 1694
+sphere{<-0.680103,-0.835177,13.4553>,s}
+// id 1703
+sphere{<0.701083,0.739274,13.5314>,s}
+// id 1764
+sphere{<-0.215188,0.733703,13.9316>,s}
+// id 1768
+sphere{<0.121922,-0.461056,13.9366>,s}
+// id 1881
+sphere{<0.53065,0.30137,14.438>,s}
+// id 1749
+sphere{<1.68236,-0.908035,13.3369>,s}
+// id 1748
+sphere{<1.93949,0.182593,13.2933>,s}
+// id 1840
+sphere{<2.22117,-0.394226,14.1833>,s}
+// id 1854
+sphere{<1.27426,-0.164664,13.9587>,s}
+// id 1873
+sphere{<1.81662,0.648539,14.1694>,s}
+// id 1724
+sphere{<4.42578,-0.0903087,13.3079>,s}
+// id 1744
+sphere{<4.58909,0.688216,13.9137>,s}
+// id 1760
+sphere{<2.86097,-0.223821,13.4343>,s}
+// id 1828
+sphere{<2.81569,0.496065,14.1266>,s}
+// id 1855
+sphere{<3.67073,-0.106864,14.0146>,s}
+// id 1907
+sphere{<4.55826,-0.139319,14.4742>,s}
+// id 1792
+sphere{<4.76892,-0.87252,13.8278>,s}
+// id 1810
+sphere{<5.47841,0.487727,13.4808>,s}
+// id 1888
+sphere{<5.49402,-0.260725,14.1435>,s}
+// id 1934
+sphere{<5.43871,0.81927,14.4244>,s}
+// id 1731
+sphere{<-4.8334,2.62493,13.4586>,s}
+// id 1820
+sphere{<-5.38138,1.13614,13.9595>,s}
+// id 1835
+sphere{<-5.10992,2.03515,14.3374>,s}
+// id 1691
+sphere{<-3.62621,2.03125,13.3362>,s}
+// id 1779
+sphere{<-4.41746,1.59623,13.7655>,s}
+// id 1793
+sphere{<-3.16075,1.24207,13.7358>,s}
+// id 1834
+sphere{<-3.05042,2.45168,14.1427>,s}
+// id 1858
+sphere{<-3.97351,2.19669,14.4305>,s}
+// id 1706
+sphere{<-2.28825,1.15238,13.2563>,s}
+// id 1752
+sphere{<-2.62849,2.091,13.3109>,s}
+// id 1774
+sphere{<-1.6809,2.14621,13.6251>,s}
+// id 1808
+sphere{<-2.32219,1.5907,14.1543>,s}
+// id 1746
+sphere{<-0.70797,2.26031,13.4246>,s}
+// id 1753
+sphere{<0.923723,2.09881,13.6597>,s}
+// id 1761
+sphere{<-0.846144,1.49899,14.0577>,s}
+// id 1817
+sphere{<-0.204362,2.58367,14.2255>,s}
+// id 1843
+sphere{<0.151568,1.65224,14.1117>,s}
+// id 1874
+sphere{<0.75315,2.59012,14.5136>,s}
+// id 1704
+sphere{<1.99775,2.35513,13.6547>,s}
+// id 1773
+sphere{<1.56847,2.0117,14.49>,s}
+// id 1747
+sphere{<1.65243,1.42177,13.557>,s}
+// id 1847
+sphere{<2.55108,1.45128,13.9946>,s}
+// id 1868
+sphere{<1.00352,1.19568,14.3681>,s}
+// id 1804
+sphere{<3.24206,2.12742,13.7391>,s}
+// id 1825
+sphere{<3.65195,1.02785,13.9938>,s}
+// id 1833
+sphere{<4.34107,1.6947,13.5384>,s}
+// id 1867
+sphere{<4.38608,1.45391,14.5238>,s}
+// id 1895
+sphere{<4.08413,2.38785,14.2116>,s}
+// id 1734
+sphere{<5.30404,1.45553,13.6617>,s}
+// id 1796
+sphere{<4.76464,2.74786,13.5561>,s}
+// id 1832
+sphere{<5.05467,2.16818,14.3173>,s}
+// id 1875
+sphere{<-4.65773,2.92515,14.396>,s}
+// id 1719
+sphere{<-3.00439,3.02324,13.3234>,s}
+// id 1758
+sphere{<-3.24618,4.01316,13.3462>,s}
+// id 1812
+sphere{<-3.91217,2.90559,13.7279>,s}
+// id 1844
+sphere{<-3.92887,3.84918,14.0582>,s}
+// id 1856
+sphere{<-3.01233,3.48055,14.2127>,s}
+// id 1772
+sphere{<-1.41286,3.55979,13.3522>,s}
+// id 1791
+sphere{<-2.18774,2.97239,13.9644>,s}
+// id 1798
+sphere{<-2.30053,3.9197,13.6648>,s}
+// id 1815
+sphere{<-1.22304,4.52293,13.6976>,s}
+// id 1822
+sphere{<-1.16592,2.8887,14.0531>,s}
+// id 1935
+sphere{<-1.50188,3.79164,14.3206>,s}
+// id 1778
+sphere{<-0.398208,3.33066,13.5891>,s}
+// id 1790
+sphere{<-0.242154,4.60255,13.5202>,s}
+// id 1819
+sphere{<0.336011,4.58384,14.3356>,s}
+// id 1842
+sphere{<0.287345,3.45049,14.307>,s}
+// id 1918
+sphere{<-0.531863,4.03252,14.289>,s}
+// id 1708
+sphere{<1.89137,3.56244,13.3308>,s}
+// id 1770
+sphere{<2.13883,4.47789,13.6478>,s}
+// id 1766
+sphere{<0.990517,3.80494,13.6907>,s}
+// id 1818
+sphere{<1.53173,3.09451,14.1404>,s}
+// id 1845
+sphere{<2.72244,2.92812,14.0373>,s}
+// id 1891
+sphere{<1.32974,4.57831,14.2264>,s}
+// id 1902
+sphere{<2.25201,3.7603,14.335>,s}
+// id 1754
+sphere{<3.81944,3.95797,13.6763>,s}
+// id 1757
+sphere{<3.5091,3.03995,13.43>,s}
+// id 1805
+sphere{<2.84622,3.78138,13.531>,s}
+// id 1850
+sphere{<4.36466,3.34684,14.2497>,s}
+// id 1857
+sphere{<3.02927,4.59082,14.0886>,s}
+// id 1909
+sphere{<3.2427,3.67901,14.4441>,s}
+// id 1837
+sphere{<-2.85774,4.69939,13.9609>,s}
+// id 1795
+sphere{<-2.0233,5.11439,13.5987>,s}
+// id 1657
+sphere{<0.741451,4.69802,13.3163>,s}
+// id 1743
+sphere{<0.142254,5.49839,13.2984>,s}
+// id 1769
+sphere{<-0.777929,5.44479,13.686>,s}
+// id 1794
+sphere{<0.857271,5.4323,13.9943>,s}
+// id 1827
+sphere{<-0.0620704,5.49985,14.3818>,s}
+// id 1789
+sphere{<1.59867,5.26273,13.3451>,s}
+// id 1913
+sphere{<2.18764,5.04642,14.4688>,s}
+// id 2003
+sphere{<-1.81337,-5.19258,14.5473>,s}
+// id 2048
+sphere{<-2.47761,-4.91045,15.2394>,s}
+// id 2056
+sphere{<-1.58577,-5.2665,15.5182>,s}
+// id 1974
+sphere{<-0.767706,-5.44617,14.972>,s}
+// id 1995
+sphere{<0.220575,-5.49567,15.1159>,s}
+// id 2009
+sphere{<-0.268051,-4.66805,15.3921>,s}
+// id 2061
+sphere{<0.769316,-4.80382,15.5849>,s}
+// id 1976
+sphere{<1.55394,-5.27601,15.1833>,s}
+// id 1926
+sphere{<-3.82613,-3.95131,14.8208>,s}
+// id 1969
+sphere{<-4.45975,-3.21902,15.0703>,s}
+// id 1994
+sphere{<-2.99476,-3.51545,15.1889>,s}
+// id 2107
+sphere{<-3.29061,-4.40705,15.5317>,s}
+// id 2127
+sphere{<-4.01186,-3.76239,15.785>,s}
+// id 1866
+sphere{<-1.19481,-3.98507,14.8334>,s}
+// id 1972
+sphere{<-2.27303,-3.99015,14.6851>,s}
+// id 1986
+sphere{<-1.66928,-3.12093,14.9999>,s}
+// id 2025
+sphere{<-2.42148,-2.78996,15.5697>,s}
+// id 2065
+sphere{<-1.84179,-4.20939,15.562>,s}
+// id 1905
+sphere{<0.744358,-2.87636,15.1117>,s}
+// id 1924
+sphere{<0.425603,-4.60518,14.6671>,s}
+// id 1948
+sphere{<-0.118634,-3.7793,14.8135>,s}
+// id 1946
+sphere{<-0.349948,-2.91584,15.2615>,s}
+// id 1961
+sphere{<0.790146,-3.86747,15.235>,s}
+// id 1964
+sphere{<-0.660605,-3.78152,15.6538>,s}
+// id 1927
+sphere{<1.60777,-3.54171,14.7605>,s}
+// id 1936
+sphere{<2.53089,-3.87397,14.5674>,s}
+// id 1950
+sphere{<2.78505,-2.80216,14.8621>,s}
+// id 2029
+sphere{<2.34216,-3.4685,15.4619>,s}
+// id 2052
+sphere{<1.40965,-3.30749,15.785>,s}
+// id 2045
+sphere{<2.00177,-4.38443,15.25>,s}
+// id 1921
+sphere{<3.70766,-4.06261,14.6224>,s}
+// id 1985
+sphere{<2.99431,-4.61357,15.0554>,s}
+// id 2004
+sphere{<4.50619,-3.1535,15.1281>,s}
+// id 2007
+sphere{<3.52799,-3.32788,15.2764>,s}
+// id 1931
+sphere{<-5.08261,-2.10163,15.1855>,s}
+// id 2016
+sphere{<-5.36889,-1.19393,15.6121>,s}
+// id 1898
+sphere{<-4.47876,-1.07618,14.6454>,s}
+// id 1971
+sphere{<-4.10759,-2.00568,14.6641>,s}
+// id 1983
+sphere{<-3.45584,-1.7602,15.5485>,s}
+// id 1990
+sphere{<-3.39131,-2.61101,15.0111>,s}
+// id 2055
+sphere{<-4.39487,-1.4181,15.5812>,s}
+// id 2077
+sphere{<-4.2207,-2.40258,15.5955>,s}
+// id 1870
+sphere{<-1.85694,-1.15256,14.626>,s}
+// id 1900
+sphere{<-2.50919,-2.78533,14.5736>,s}
+// id 1949
+sphere{<-2.7133,-1.79044,14.8796>,s}
+// id 1962
+sphere{<-1.13305,-1.49917,15.2244>,s}
+// id 1977
+sphere{<-1.78014,-2.14407,14.8179>,s}
+// id 2035
+sphere{<-1.1813,-2.44667,15.5593>,s}
+// id 2047
+sphere{<-2.50576,-1.83574,15.8567>,s}
+// id 1877
+sphere{<-0.758448,-2.23228,14.6568>,s}
+// id 1884
+sphere{<0.183882,-1.16025,14.6483>,s}
+// id 2002
+sphere{<0.148599,-2.07596,15.0477>,s}
+// id 2012
+sphere{<-0.212319,-1.29444,15.5565>,s}
+// id 1886
+sphere{<2.18009,-1.32923,14.7917>,s}
+// id 1908
+sphere{<1.38432,-1.92072,14.6624>,s}
+// id 1970
+sphere{<0.938595,-1.27849,15.2934>,s}
+// id 2006
+sphere{<1.8422,-2.65625,15.1615>,s}
+// id 2015
+sphere{<2.55617,-2.00692,15.4235>,s}
+// id 2039
+sphere{<1.14852,-2.17059,15.6934>,s}
+// id 2086
+sphere{<1.83307,-1.38397,15.7279>,s}
+// id 1889
+sphere{<3.82071,-2.64697,14.6051>,s}
+// id 1955
+sphere{<3.14033,-1.91515,14.5676>,s}
+// id 1981
+sphere{<4.19519,-1.69299,15.3205>,s}
+// id 1996
+sphere{<3.26379,-1.3039,15.3492>,s}
+// id 2040
+sphere{<3.86644,-2.52503,15.767>,s}
+// id 1916
+sphere{<5.37816,-1.15157,14.5825>,s}
+// id 1966
+sphere{<5.14092,-1.95492,15.1285>,s}
+// id 1942
+sphere{<-5.45576,0.698009,14.957>,s}
+// id 2005
+sphere{<-5.44713,-0.681595,14.7569>,s}
+// id 2034
+sphere{<-5.49936,-0.094721,15.5648>,s}
+// id 2074
+sphere{<-4.73565,0.543259,15.6629>,s}
+// id 1883
+sphere{<-3.09041,0.181453,14.7309>,s}
+// id 1952
+sphere{<-3.71199,-0.549526,15.012>,s}
+// id 2028
+sphere{<-3.88293,0.626556,15.1475>,s}
+// id 2060
+sphere{<-3.2718,0.025165,15.7018>,s}
+// id 2097
+sphere{<-4.55913,-0.433074,15.5301>,s}
+// id 1809
+sphere{<-0.992703,0.445561,14.5968>,s}
+// id 1917
+sphere{<-1.237,-0.347656,15.1592>,s}
+// id 1920
+sphere{<-2.3624,0.858769,14.8365>,s}
+// id 1922
+sphere{<-2.74824,-0.791446,14.9004>,s}
+// id 1944
+sphere{<-2.32272,-0.00309963,15.3443>,s}
+// id 1978
+sphere{<-1.52916,0.599526,15.427>,s}
+// id 2010
+sphere{<-2.02053,-0.925224,15.5859>,s}
+// id 1892
+sphere{<-0.30361,-0.245251,14.8153>,s}
+// id 1967
+sphere{<0.611365,-0.33554,15.2083>,s}
+// id 2008
+sphere{<-0.545141,0.439232,15.5031>,s}
+// id 1923
+sphere{<1.51854,-0.583385,14.8688>,s}
+// id 1959
+sphere{<2.30079,0.246814,14.9466>,s}
+// id 1975
+sphere{<1.31537,0.378297,15.0527>,s}
+// id 1984
+sphere{<2.53971,-0.615586,15.3926>,s}
+// id 2051
+sphere{<1.48265,-0.430984,15.8563>,s}
+// id 1937
+sphere{<3.04571,0.911172,15.0067>,s}
+// id 1947
+sphere{<3.24408,-0.0838293,14.9201>,s}
+// id 1965
+sphere{<3.97672,0.590927,14.8323>,s}
+// id 1999
+sphere{<3.29018,0.434423,15.851>,s}
+// id 2020
+sphere{<3.96696,-0.888495,14.7723>,s}
+// id 2062
+sphere{<4.07775,-0.176358,15.4655>,s}
+// id 1939
+sphere{<5.49973,0.0599703,15.0906>,s}
+// id 2026
+sphere{<4.8613,0.814739,15.2408>,s}
+// id 2041
+sphere{<4.79026,-0.866594,15.3395>,s}
+// id 1958
+sphere{<-5.03512,2.2132,15.3185>,s}
+// id 2069
+sphere{<-5.33352,1.34331,15.711>,s}
+// id 1904
+sphere{<-4.59568,1.02892,14.5693>,s}
+// id 1911
+sphere{<-3.44442,2.3052,15.273>,s}
+// id 1998
+sphere{<-3.41018,1.41198,14.6891>,s}
+// id 2013
+sphere{<-4.20656,1.65876,15.2413>,s}
+// id 2036
+sphere{<-3.05327,1.02302,15.5405>,s}
+// id 1864
+sphere{<-1.5075,1.37588,14.7973>,s}
+// id 1879
+sphere{<-1.80104,2.31294,14.6088>,s}
+// id 1929
+sphere{<-2.57428,1.8493,15.0866>,s}
+// id 1956
+sphere{<-1.41871,2.65353,15.4677>,s}
+// id 2000
+sphere{<-1.88007,1.50161,15.7166>,s}
+// id 2059
+sphere{<-2.58913,2.70793,15.5989>,s}
+// id 1885
+sphere{<-0.846425,2.12495,14.8397>,s}
+// id 1896
+sphere{<-0.322971,1.14896,14.8347>,s}
+// id 1953
+sphere{<0.575363,1.01986,15.2545>,s}
+// id 1960
+sphere{<0.126869,2.01734,15.0424>,s}
+// id 1987
+sphere{<-0.477277,2.43269,15.7224>,s}
+// id 2021
+sphere{<-0.888164,1.47014,15.5943>,s}
+// id 1821
+sphere{<2.53592,2.18226,14.6766>,s}
+// id 1901
+sphere{<2.12414,1.27867,14.8822>,s}
+// id 1925
+sphere{<1.06991,1.88604,15.3476>,s}
+// id 2014
+sphere{<2.04142,2.03328,15.5329>,s}
+// id 2046
+sphere{<1.55086,1.08984,15.7146>,s}
+// id 2057
+sphere{<2.53829,1.21226,15.814>,s}
+// id 1899
+sphere{<3.44069,1.75594,14.6459>,s}
+// id 1968
+sphere{<3.35318,2.74681,14.7918>,s}
+// id 1973
+sphere{<3.04386,2.02463,15.5234>,s}
+// id 1982
+sphere{<4.14597,2.04722,15.2921>,s}
+// id 2027
+sphere{<3.9786,1.13676,15.6701>,s}
+// id 1951
+sphere{<5.21442,1.74968,15.2111>,s}
+// id 1882
+sphere{<-3.37923,4.33946,14.7345>,s}
+// id 1910
+sphere{<-3.75321,3.11652,14.7768>,s}
+// id 1963
+sphere{<-4.55227,3.08683,15.3771>,s}
+// id 1988
+sphere{<-3.91889,3.85908,15.4258>,s}
+// id 1993
+sphere{<-2.96828,3.55814,15.2113>,s}
+// id 1830
+sphere{<-2.06864,3.22997,14.9233>,s}
+// id 1912
+sphere{<-2.3861,4.13421,14.6377>,s}
+// id 2042
+sphere{<-1.38301,4.49943,15.0165>,s}
+// id 2080
+sphere{<-1.40733,3.65049,15.5444>,s}
+// id 1932
+sphere{<-0.760985,3.26422,14.8866>,s}
+// id 1943
+sphere{<0.153125,3.0047,15.1976>,s}
+// id 1954
+sphere{<0.195751,4.0017,15.1361>,s}
+// id 2023
+sphere{<0.876912,4.50985,15.6629>,s}
+// id 2072
+sphere{<-0.438594,3.57507,15.7806>,s}
+// id 1938
+sphere{<1.12128,3.76042,14.7633>,s}
+// id 1941
+sphere{<2.71019,4.34559,15.0039>,s}
+// id 1980
+sphere{<1.14018,2.95603,15.3598>,s}
+// id 1992
+sphere{<1.72618,4.46326,15.1372>,s}
+// id 1991
+sphere{<2.07253,3.01564,14.9778>,s}
+// id 2019
+sphere{<1.75722,3.65382,15.7234>,s}
+// id 1928
+sphere{<4.00779,3.76666,15.0841>,s}
+// id 2022
+sphere{<2.97784,3.46009,15.3836>,s}
+// id 2018
+sphere{<3.83244,2.92637,15.6508>,s}
+// id 2079
+sphere{<3.42784,4.30118,15.6988>,s}
+// id 1903
+sphere{<4.72804,2.81007,15.011>,s}
+// id 1829
+sphere{<-1.13314,5.38207,14.6186>,s}
+// id 1863
+sphere{<-2.08864,5.08802,14.5962>,s}
+// id 2001
+sphere{<-2.70667,4.78808,15.3229>,s}
+// id 2096
+sphere{<-1.82921,5.18714,15.5888>,s}
+// id 1945
+sphere{<-0.421607,4.76869,14.9615>,s}
+// id 2043
+sphere{<0.393413,5.27845,15.244>,s}
+// id 2091
+sphere{<-0.856178,5.43295,15.5781>,s}
+// id 1940
+sphere{<1.32095,5.3391,14.8753>,s}
+// id 2017
+sphere{<2.37204,4.96241,15.7146>,s}
+// id 2177
+sphere{<-2.64565,-4.75901,16.2134>,s}
+// id 2244
+sphere{<-1.25454,-5.35514,16.6864>,s}
+// id 2272
+sphere{<-2.10282,-4.95282,17.0306>,s}
+// id 2070
+sphere{<-0.57504,-5.46986,15.9529>,s}
+// id 2114
+sphere{<0.391069,-5.48613,16.2105>,s}
+// id 2219
+sphere{<0.892734,-4.77184,16.8382>,s}
+// id 2242
+sphere{<-0.289403,-5.11937,16.8448>,s}
+// id 2105
+sphere{<1.39479,-5.32031,16.1696>,s}
+// id 2110
+sphere{<2.46919,-4.91466,15.9573>,s}
+// id 2187
+sphere{<2.0779,-5.09239,16.8634>,s}
+// id 2095
+sphere{<-4.56198,-3.07225,16.2551>,s}
+// id 2161
+sphere{<-3.45977,-2.94536,15.9509>,s}
+// id 2191
+sphere{<-3.46707,-4.26964,16.5063>,s}
+// id 2199
+sphere{<-3.16668,-3.3654,16.8097>,s}
+// id 2247
+sphere{<-4.11705,-3.64697,16.9418>,s}
+// id 2099
+sphere{<-1.0646,-4.60327,16.0552>,s}
+// id 2098
+sphere{<-1.51105,-3.35347,15.9595>,s}
+// id 2113
+sphere{<-2.51591,-3.65924,16.0549>,s}
+// id 2147
+sphere{<-2.26093,-3.13667,17.1663>,s}
+// id 2181
+sphere{<-1.29338,-3.21099,16.925>,s}
+// id 2214
+sphere{<-1.7774,-4.11129,16.5551>,s}
+// id 2280
+sphere{<-2.72875,-4.18657,17.1756>,s}
+// id 2032
+sphere{<0.237392,-3.47682,15.971>,s}
+// id 2090
+sphere{<-0.630358,-2.95817,16.2204>,s}
+// id 2118
+sphere{<-0.591755,-3.86725,16.6476>,s}
+// id 2123
+sphere{<0.871183,-3.78459,16.6805>,s}
+// id 2136
+sphere{<0.145913,-4.4267,16.2698>,s}
+// id 2153
+sphere{<0.0898368,-3.12271,16.8944>,s}
+// id 2125
+sphere{<1.48019,-4.32631,16.1012>,s}
+// id 2150
+sphere{<0.990382,-2.78973,16.5307>,s}
+// id 2143
+sphere{<2.29566,-3.8272,16.3941>,s}
+// id 2217
+sphere{<2.12538,-3.02409,16.9651>,s}
+// id 2050
+sphere{<2.91633,-2.7935,15.925>,s}
+// id 2119
+sphere{<3.11505,-4.02899,15.8576>,s}
+// id 2169
+sphere{<4.30551,-3.4224,16.07>,s}
+// id 2194
+sphere{<3.06387,-3.30852,16.7693>,s}
+// id 2205
+sphere{<2.96268,-4.63388,16.7804>,s}
+// id 2204
+sphere{<3.74484,-4.02824,16.6344>,s}
+// id 2186
+sphere{<4.69418,-2.8662,16.8045>,s}
+// id 2178
+sphere{<-4.79233,-1.28017,16.4884>,s}
+// id 2185
+sphere{<-5.04169,-2.19809,16.1799>,s}
+// id 2104
+sphere{<-2.98169,-0.937365,15.8616>,s}
+// id 2141
+sphere{<-3.86095,-1.99123,16.433>,s}
+// id 2209
+sphere{<-3.22724,-1.29197,16.7638>,s}
+// id 2226
+sphere{<-2.90367,-2.40124,16.579>,s}
+// id 2250
+sphere{<-4.201,-2.66167,17.0924>,s}
+// id 2071
+sphere{<-1.54949,-1.69389,16.1123>,s}
+// id 2093
+sphere{<-1.93177,-2.56769,16.4127>,s}
+// id 2111
+sphere{<-2.2669,-1.13763,16.5316>,s}
+// id 2241
+sphere{<-1.18966,-1.77136,17.042>,s}
+// id 2240
+sphere{<-2.21453,-1.93459,17.1333>,s}
+// id 2037
+sphere{<0.538447,-1.53923,16.172>,s}
+// id 2081
+sphere{<0.231247,-2.47698,15.9599>,s}
+// id 2112
+sphere{<-0.589477,-1.95921,16.2013>,s}
+// id 2197
+sphere{<-0.24876,-1.09179,16.5962>,s}
+// id 2223
+sphere{<0.173073,-2.12618,16.8945>,s}
+// id 2235
+sphere{<0.707612,-1.31778,17.1408>,s}
+// id 2094
+sphere{<1.43636,-1.76732,16.562>,s}
+// id 2101
+sphere{<1.98939,-2.48292,16.1353>,s}
+// id 2152
+sphere{<2.34051,-2.00629,16.9412>,s}
+// id 2182
+sphere{<1.62811,-0.932264,17.0776>,s}
+// id 2144
+sphere{<4.64067,-1.89703,16.5642>,s}
+// id 2156
+sphere{<2.88829,-1.54288,16.2447>,s}
+// id 2166
+sphere{<3.87181,-1.36594,16.2084>,s}
+// id 2192
+sphere{<3.54672,-1.45076,17.1502>,s}
+// id 2202
+sphere{<3.41954,-2.29641,16.6319>,s}
+// id 2239
+sphere{<4.47655,-1.08187,17.1197>,s}
+// id 2030
+sphere{<5.30704,-1.44423,15.9719>,s}
+// id 2102
+sphere{<4.8606,-2.57409,15.862>,s}
+// id 2180
+sphere{<5.42024,-0.933418,16.8241>,s}
+// id 2168
+sphere{<-5.01258,-0.307703,16.4125>,s}
+// id 2195
+sphere{<-5.4696,0.578791,16.341>,s}
+// id 2246
+sphere{<-5.43226,-0.860696,17.1322>,s}
+// id 2124
+sphere{<-3.91236,-0.79804,16.1998>,s}
+// id 2132
+sphere{<-3.19773,0.614803,16.506>,s}
+// id 2163
+sphere{<-4.40259,-0.627059,17.1376>,s}
+// id 2203
+sphere{<-4.10171,0.173487,16.3421>,s}
+// id 2200
+sphere{<-3.47309,-0.308007,16.9527>,s}
+// id 1997
+sphere{<-1.00596,-0.862364,15.9848>,s}
+// id 2049
+sphere{<-2.29244,0.66841,16.0846>,s}
+// id 2108
+sphere{<-1.17239,0.851331,16.3266>,s}
+// id 2133
+sphere{<-1.68244,-0.135176,16.1009>,s}
+// id 2135
+sphere{<-2.62022,-0.206615,16.4407>,s}
+// id 2167
+sphere{<-1.41531,-0.756047,16.8909>,s}
+// id 2172
+sphere{<-1.83074,0.402508,16.9309>,s}
+// id 2058
+sphere{<0.831674,0.324819,15.9262>,s}
+// id 2054
+sphere{<-0.105001,-0.363477,15.9053>,s}
+// id 2053
+sphere{<0.698434,-0.588801,16.4564>,s}
+// id 2078
+sphere{<-0.0319297,0.60524,16.345>,s}
+// id 2117
+sphere{<-0.79594,-0.0464957,16.5549>,s}
+// id 2064
+sphere{<2.22945,0.233296,15.9438>,s}
+// id 2109
+sphere{<2.29113,-0.748046,16.352>,s}
+// id 2126
+sphere{<1.02106,0.770551,16.8011>,s}
+// id 2138
+sphere{<1.66379,0.00718364,16.7368>,s}
+// id 2067
+sphere{<2.85492,0.00549161,16.69>,s}
+// id 2084
+sphere{<3.32605,-0.552646,16.007>,s}
+// id 2082
+sphere{<4.4942,0.42512,16.1472>,s}
+// id 2146
+sphere{<4.53851,-0.570278,16.2608>,s}
+// id 2160
+sphere{<3.71702,0.505577,16.7712>,s}
+// id 2183
+sphere{<2.82955,0.899181,17.1379>,s}
+// id 2207
+sphere{<3.69941,-0.481251,16.9319>,s}
+// id 2075
+sphere{<5.47369,0.539333,15.9816>,s}
+// id 2106
+sphere{<5.48076,-0.459898,15.9446>,s}
+// id 2215
+sphere{<5.15797,0.0306515,16.7826>,s}
+// id 2085
+sphere{<-5.07715,2.1149,16.3127>,s}
+// id 2157
+sphere{<-4.74606,2.77939,16.9826>,s}
+// id 2158
+sphere{<-4.74052,1.21561,16.5917>,s}
+// id 2011
+sphere{<-4.17692,2.36059,15.9529>,s}
+// id 2076
+sphere{<-3.92437,1.10501,16.0246>,s}
+// id 2089
+sphere{<-2.83341,1.85203,16.0547>,s}
+// id 2151
+sphere{<-2.80304,2.70669,16.5799>,s}
+// id 2148
+sphere{<-3.64972,1.85022,16.6323>,s}
+// id 2170
+sphere{<-2.87397,1.38376,17.0572>,s}
+// id 2216
+sphere{<-3.90459,1.00256,17.0975>,s}
+// id 2116
+sphere{<-1.92912,2.33495,16.2669>,s}
+// id 2129
+sphere{<-1.01177,1.97958,16.4458>,s}
+// id 2142
+sphere{<-1.93767,1.37106,16.7063>,s}
+// id 1989
+sphere{<0.0529691,1.54926,15.9229>,s}
+// id 2024
+sphere{<0.508212,2.45187,15.9514>,s}
+// id 2139
+sphere{<0.777577,2.65744,16.8999>,s}
+// id 2176
+sphere{<-0.0636243,2.14972,16.714>,s}
+// id 2198
+sphere{<-0.49417,1.27301,16.9284>,s}
+// id 2031
+sphere{<1.47518,2.52236,16.1962>,s}
+// id 2092
+sphere{<1.98574,0.944471,16.6032>,s}
+// id 2121
+sphere{<0.969521,1.64155,16.3126>,s}
+// id 2164
+sphere{<2.20772,1.91522,16.5118>,s}
+// id 2184
+sphere{<1.74355,2.6152,17.155>,s}
+// id 2044
+sphere{<4.05645,2.03442,16.288>,s}
+// id 2066
+sphere{<3.11833,2.3267,16.4737>,s}
+// id 2131
+sphere{<3.33388,1.35279,16.4032>,s}
+// id 2229
+sphere{<4.37564,1.24369,16.9174>,s}
+// id 2122
+sphere{<4.90815,1.35829,16.0788>,s}
+// id 2162
+sphere{<4.94105,2.41582,15.9049>,s}
+// id 2230
+sphere{<5.11779,2.01453,16.8036>,s}
+// id 2033
+sphere{<-3.31081,4.39188,16.0142>,s}
+// id 2088
+sphere{<-3.46715,3.06437,15.9234>,s}
+// id 2115
+sphere{<-4.33289,3.38787,16.3051>,s}
+// id 2179
+sphere{<-2.91111,3.70023,16.6157>,s}
+// id 2224
+sphere{<-3.75073,2.8136,16.8806>,s}
+// id 2248
+sphere{<-3.81905,3.95796,16.9461>,s}
+// id 2073
+sphere{<-1.08624,4.49579,15.9714>,s}
+// id 2083
+sphere{<-2.08706,4.27984,15.9208>,s}
+// id 2100
+sphere{<-2.08216,3.32109,16.2047>,s}
+// id 2120
+sphere{<-1.07724,3.03354,16.3272>,s}
+// id 2134
+sphere{<-1.64172,4.44281,16.8012>,s}
+// id 2188
+sphere{<-1.59045,3.47854,17.0611>,s}
+// id 2068
+sphere{<0.565481,3.53422,15.939>,s}
+// id 2137
+sphere{<-0.0869579,4.51901,15.9437>,s}
+// id 2154
+sphere{<-0.0706422,3.1436,16.6043>,s}
+// id 2190
+sphere{<0.22611,4.21761,16.8443>,s}
+// id 2196
+sphere{<-0.722764,3.89733,16.6853>,s}
+// id 2038
+sphere{<2.36719,2.88973,15.9329>,s}
+// id 2103
+sphere{<1.61736,4.43572,16.3308>,s}
+// id 2130
+sphere{<2.54873,4.08364,16.1578>,s}
+// id 2155
+sphere{<2.2831,3.39557,16.8389>,s}
+// id 2175
+sphere{<1.31457,3.44405,16.5951>,s}
+// id 2087
+sphere{<4.08461,3.68357,16.2532>,s}
+// id 2128
+sphere{<3.16001,3.31978,16.3645>,s}
+// id 2159
+sphere{<3.40293,4.3209,16.6983>,s}
+// id 2165
+sphere{<4.63244,2.96496,16.6815>,s}
+// id 2232
+sphere{<3.71389,2.87022,17.0652>,s}
+// id 2145
+sphere{<-1.34702,5.33258,16.4527>,s}
+// id 2220
+sphere{<-2.59908,4.84724,16.5656>,s}
+// id 2149
+sphere{<-0.0223981,5.50004,16.1261>,s}
+// id 2173
+sphere{<0.751134,5.00541,16.5222>,s}
+// id 2193
+sphere{<-0.502696,4.90034,16.7693>,s}
+// id 2063
+sphere{<1.44561,5.30665,15.8669>,s}
+// id 2140
+sphere{<2.37787,4.95945,16.7146>,s}
+// id 2174
+sphere{<1.51597,5.28697,17.1016>,s}
+// id 2275
+sphere{<-0.861832,-5.43206,17.6028>,s}
+// id 2299
+sphere{<-4.40006,-3.29995,17.836>,s}
+// id 2298
+sphere{<-3.43787,-3.0534,17.7202>,s}
+// id 2251
+sphere{<-1.12469,-4.50752,17.2008>,s}
+// id 2233
+sphere{<-0.523401,-3.51391,17.5806>,s}
+// id 2281
+sphere{<0.647416,-3.07194,17.7229>,s}
+// id 2253
+sphere{<2.2295,-4.21285,17.3144>,s}
+// id 2270
+sphere{<1.46391,-3.58652,17.4612>,s}
+// id 2210
+sphere{<3.92247,-3.28685,17.2815>,s}
+// id 2300
+sphere{<3.22938,-3.98173,17.49>,s}
+// id 2282
+sphere{<-5.03288,-2.21825,17.4261>,s}
+// id 2257
+sphere{<-3.40076,-2.10825,17.3957>,s}
+// id 2256
+sphere{<-4.25694,-1.60782,17.2673>,s}
+// id 2284
+sphere{<-3.56168,-1.00722,17.6621>,s}
+// id 2261
+sphere{<-1.73997,-1.26812,17.7083>,s}
+// id 2290
+sphere{<-1.58144,-2.54331,17.6114>,s}
+// id 2252
+sphere{<-0.337754,-1.51421,17.4982>,s}
+// id 2262
+sphere{<-0.631854,-2.5607,17.2985>,s}
+// id 2294
+sphere{<0.485183,-1.74039,18.0194>,s}
+// id 2231
+sphere{<1.05209,-2.23299,17.3591>,s}
+// id 2285
+sphere{<2.16667,-1.44216,17.7483>,s}
+// id 2295
+sphere{<1.94795,-2.43613,17.7543>,s}
+// id 2208
+sphere{<2.95425,-2.59774,17.4641>,s}
+// id 2296
+sphere{<4.12099,-2.2485,17.3429>,s}
+// id 2254
+sphere{<5.21529,-1.74668,17.3687>,s}
+// id 2227
+sphere{<-5.42618,0.898195,17.2876>,s}
+// id 2265
+sphere{<-4.60436,0.331,17.341>,s}
+// id 2171
+sphere{<-2.73976,0.277107,17.3283>,s}
+// id 2218
+sphere{<-2.65399,-0.718893,17.353>,s}
+// id 2245
+sphere{<-1.81713,-0.271902,17.669>,s}
+// id 2255
+sphere{<-0.942191,0.500838,17.3789>,s}
+// id 2212
+sphere{<-0.111166,-0.328189,17.227>,s}
+// id 2238
+sphere{<0.86078,-0.112513,17.3205>,s}
+// id 2274
+sphere{<0.180241,0.623657,17.3221>,s}
+// id 2283
+sphere{<-0.882607,-0.710084,17.7359>,s}
+// id 2293
+sphere{<0.246189,0.000369817,18.1012>,s}
+// id 2206
+sphere{<2.76491,-0.832225,17.2286>,s}
+// id 2263
+sphere{<1.08874,0.92096,17.7874>,s}
+// id 2271
+sphere{<1.97594,0.545017,17.5199>,s}
+// id 2279
+sphere{<1.11414,-0.861752,17.9324>,s}
+// id 2291
+sphere{<2.0679,-0.408432,17.807>,s}
+// id 2249
+sphere{<3.25584,0.116907,17.5993>,s}
+// id 2258
+sphere{<-5.17388,1.86576,17.2762>,s}
+// id 2287
+sphere{<-4.2072,2.0678,17.4334>,s}
+// id 2289
+sphere{<-3.19031,2.23592,17.474>,s}
+// id 2213
+sphere{<-1.27512,1.71085,17.3738>,s}
+// id 2228
+sphere{<-2.22723,2.18521,17.2096>,s}
+// id 2267
+sphere{<-2.12858,1.04872,17.6335>,s}
+// id 2286
+sphere{<-2.5196,1.84102,18.1018>,s}
+// id 2211
+sphere{<-0.884943,2.618,17.2162>,s}
+// id 2225
+sphere{<0.55153,1.54674,17.2219>,s}
+// id 2273
+sphere{<-0.340349,1.91747,17.6773>,s}
+// id 2288
+sphere{<-0.392416,0.99263,18.0541>,s}
+// id 2189
+sphere{<1.54891,1.61581,17.2019>,s}
+// id 2266
+sphere{<2.65724,2.26359,17.3588>,s}
+// id 2278
+sphere{<2.32175,1.43708,17.8108>,s}
+// id 2268
+sphere{<3.73636,0.992729,17.6443>,s}
+// id 2264
+sphere{<3.65405,1.87993,17.1903>,s}
+// id 2297
+sphere{<4.47472,2.37192,17.4809>,s}
+// id 2243
+sphere{<-3.0148,4.39142,17.3526>,s}
+// id 2237
+sphere{<-0.944838,4.40551,17.5174>,s}
+// id 2277
+sphere{<-2.09324,4.12499,17.6349>,s}
+// id 2269
+sphere{<-2.49844,3.214,17.386>,s}
+// id 2221
+sphere{<0.0317125,2.83695,17.5506>,s}
+// id 2222
+sphere{<0.720922,3.54426,17.3936>,s}
+// id 2201
+sphere{<2.62753,4.20261,17.3185>,s}
+// id 2234
+sphere{<1.51326,4.14397,17.2816>,s}
+// id 2276
+sphere{<1.92834,3.37879,17.7737>,s}
+// id 2236
+sphere{<3.97787,3.79828,17.3278>,s}
+// id 2292
+sphere{<2.9599,3.29303,17.5679>,s}
+// id 2259
+sphere{<-1.65781,5.24422,17.399>,s}
+// id 2260
+sphere{<0.184618,5.49692,17.1836>,s}
@@ -0,0 +1,219 @@
+0 -0.35 -0.85 0.1
+1 -0.15 -0.85 0.1
+2 0.05 -0.85 0.1
+3 0.25 -0.85 0.1
+4 -0.55 -0.65 0.1
+5 -0.35 -0.65 0.1
+6 -0.15 -0.65 0.1
+7 0.05 -0.65 0.1
+8 0.25 -0.65 0.1
+9 0.45 -0.65 0.1
+10 0.65 -0.65 0.1
+11 -0.75 -0.45 0.1
+12 -0.55 -0.45 0.1
+13 -0.35 -0.45 0.1
+14 -0.15 -0.45 0.1
+15 0.05 -0.45 0.1
+16 0.25 -0.45 0.1
+17 0.45 -0.45 0.1
+18 0.65 -0.45 0.1
+19 -0.75 -0.25 0.1
+20 -0.55 -0.25 0.1
+21 -0.35 -0.25 0.1
+22 -0.15 -0.25 0.1
+23 0.05 -0.25 0.1
+24 0.25 -0.25 0.1
+25 0.45 -0.25 0.1
+26 0.65 -0.25 0.1
+27 0.85 -0.25 0.1
+28 -0.75 -0.05 0.1
+29 -0.55 -0.05 0.1
+30 -0.35 -0.05 0.1
+31 -0.15 -0.05 0.1
+32 0.05 -0.05 0.1
+33 0.25 -0.05 0.1
+34 0.45 -0.05 0.1
+35 0.65 -0.05 0.1
+36 0.85 -0.05 0.1
+37 -0.75 0.15 0.1
+38 -0.55 0.15 0.1
+39 -0.35 0.15 0.1
+40 -0.15 0.15 0.1
+41 0.05 0.15 0.1
+42 0.25 0.15 0.1
+43 0.45 0.15 0.1
+44 0.65 0.15 0.1
+45 0.85 0.15 0.1
+46 -0.75 0.35 0.1
+47 -0.55 0.35 0.1
+48 -0.35 0.35 0.1
+49 -0.15 0.35 0.1
+50 0.05 0.35 0.1
+51 0.25 0.35 0.1
+52 0.45 0.35 0.1
+53 0.65 0.35 0.1
+54 0.85 0.35 0.1
+55 -0.75 0.55 0.1
+56 -0.55 0.55 0.1
+57 -0.35 0.55 0.1
+58 -0.15 0.55 0.1
+59 0.05 0.55 0.1
+60 0.25 0.55 0.1
+61 0.45 0.55 0.1
+62 0.65 0.55 0.1
+63 -0.55 0.75 0.1
+64 -0.35 0.75 0.1
+65 -0.15 0.75 0.1
+66 0.05 0.75 0.1
+67 0.25 0.75 0.1
+68 0.45 0.75 0.1
+69 -0.35 -0.65 0.3
+70 -0.15 -0.65 0.3
+71 0.05 -0.65 0.3
+72 0.25 -0.65 0.3
+73 0.45 -0.65 0.3
+74 -0.55 -0.45 0.3
+75 -0.35 -0.45 0.3
+76 -0.15 -0.45 0.3
+77 0.05 -0.45 0.3
+78 0.25 -0.45 0.3
+79 0.45 -0.45 0.3
+80 0.65 -0.45 0.3
+81 -0.75 -0.25 0.3
+82 -0.55 -0.25 0.3
+83 -0.35 -0.25 0.3
+84 -0.15 -0.25 0.3
+85 0.05 -0.25 0.3
+86 0.25 -0.25 0.3
+87 0.45 -0.25 0.3
+88 0.65 -0.25 0.3
+89 -0.75 -0.05 0.3
+90 -0.55 -0.05 0.3
+91 -0.35 -0.05 0.3
+92 -0.15 -0.05 0.3
+93 0.05 -0.05 0.3
+94 0.25 -0.05 0.3
+95 0.45 -0.05 0.3
+96 0.65 -0.05 0.3
+97 -0.75 0.15 0.3
+98 -0.55 0.15 0.3
+99 -0.35 0.15 0.3
+100 -0.15 0.15 0.3
+101 0.05 0.15 0.3
+102 0.25 0.15 0.3
+103 0.45 0.15 0.3
+104 0.65 0.15 0.3
+105 -0.75 0.35 0.3
+106 -0.55 0.35 0.3
+107 -0.35 0.35 0.3
+108 -0.15 0.35 0.3
+109 0.05 0.35 0.3
+110 0.25 0.35 0.3
+111 0.45 0.35 0.3
+112 0.65 0.35 0.3
+113 -0.55 0.55 0.3
+114 -0.35 0.55 0.3
+115 -0.15 0.55 0.3
+116 0.05 0.55 0.3
+117 0.25 0.55 0.3
+118 0.45 0.55 0.3
+119 -0.35 0.75 0.3
+120 -0.15 0.75 0.3
+121 0.05 0.75 0.3
+122 0.25 0.75 0.3
+123 -0.35 -0.65 0.5
+124 -0.15 -0.65 0.5
+125 0.05 -0.65 0.5
+126 0.25 -0.65 0.5
+127 -0.55 -0.45 0.5
+128 -0.35 -0.45 0.5
+129 -0.15 -0.45 0.5
+130 0.05 -0.45 0.5
+131 0.25 -0.45 0.5
+132 0.45 -0.45 0.5
+133 -0.55 -0.25 0.5
+134 -0.35 -0.25 0.5
+135 -0.15 -0.25 0.5
+136 0.05 -0.25 0.5
+137 0.25 -0.25 0.5
+138 0.45 -0.25 0.5
+139 0.65 -0.25 0.5
+140 -0.55 -0.05 0.5
+141 -0.35 -0.05 0.5
+142 -0.15 -0.05 0.5
+143 0.05 -0.05 0.5
+144 0.25 -0.05 0.5
+145 0.45 -0.05 0.5
+146 0.65 -0.05 0.5
+147 -0.55 0.15 0.5
+148 -0.35 0.15 0.5
+149 -0.15 0.15 0.5
+150 0.05 0.15 0.5
+151 0.25 0.15 0.5
+152 0.45 0.15 0.5
+153 0.65 0.15 0.5
+154 -0.55 0.35 0.5
+155 -0.35 0.35 0.5
+156 -0.15 0.35 0.5
+157 0.05 0.35 0.5
+158 0.25 0.35 0.5
+159 0.45 0.35 0.5
+160 0.65 0.35 0.5
+161 -0.35 0.55 0.5
+162 -0.15 0.55 0.5
+163 0.05 0.55 0.5
+164 0.25 0.55 0.5
+165 0.45 0.55 0.5
+166 -0.35 -0.45 0.7
+167 -0.15 -0.45 0.7
+168 0.05 -0.45 0.7
+169 0.25 -0.45 0.7
+170 0.45 -0.45 0.7
+171 -0.55 -0.25 0.7
+172 -0.35 -0.25 0.7
+173 -0.15 -0.25 0.7
+174 0.05 -0.25 0.7
+175 0.25 -0.25 0.7
+176 0.45 -0.25 0.7
+177 -0.55 -0.05 0.7
+178 -0.35 -0.05 0.7
+179 -0.15 -0.05 0.7
+180 0.05 -0.05 0.7
+181 0.25 -0.05 0.7
+182 0.45 -0.05 0.7
+183 -0.55 0.15 0.7
+184 -0.35 0.15 0.7
+185 -0.15 0.15 0.7
+186 0.05 0.15 0.7
+187 0.25 0.15 0.7
+188 0.45 0.15 0.7
+189 -0.35 0.35 0.7
+190 -0.15 0.35 0.7
+191 0.05 0.35 0.7
+192 0.25 0.35 0.7
+193 0.45 0.35 0.7
+194 -0.15 0.55 0.7
+195 0.05 0.55 0.7
+196 0.25 0.55 0.7
+197 -0.15 -0.45 0.9
+198 0.05 -0.45 0.9
+199 0.25 -0.45 0.9
+200 -0.35 -0.25 0.9
+201 -0.15 -0.25 0.9
+202 0.05 -0.25 0.9
+203 0.25 -0.25 0.9
+204 0.45 -0.25 0.9
+205 -0.35 -0.05 0.9
+206 -0.15 -0.05 0.9
+207 0.05 -0.05 0.9
+208 0.25 -0.05 0.9
+209 0.45 -0.05 0.9
+210 -0.35 0.15 0.9
+211 -0.15 0.15 0.9
+212 0.05 0.15 0.9
+213 0.25 0.15 0.9
+214 0.45 0.15 0.9
+215 -0.35 0.35 0.9
+216 -0.15 0.35 0.9
+217 0.05 0.35 0.9
+218 0.25 0.35 0.9
@@ -0,0 +1,438 @@
+// id 0
+sphere{<-0.35,-0.85,0.1>,s}
+// id 1
+sphere{<-0.15,-0.85,0.1>,s}
+// id 2
+sphere{<0.05,-0.85,0.1>,s}
+// id 3
+sphere{<0.25,-0.85,0.1>,s}
+// id 4
+sphere{<-0.55,-0.65,0.1>,s}
+// id 5
+sphere{<-0.35,-0.65,0.1>,s}
+// id 6
+sphere{<-0.15,-0.65,0.1>,s}
+// id 7
+sphere{<0.05,-0.65,0.1>,s}
+// id 8
+sphere{<0.25,-0.65,0.1>,s}
+// id 9
+sphere{<0.45,-0.65,0.1>,s}
+// id 10
+sphere{<0.65,-0.65,0.1>,s}
+// id 11
+sphere{<-0.75,-0.45,0.1>,s}
+// id 12
+sphere{<-0.55,-0.45,0.1>,s}
+// id 13
+sphere{<-0.35,-0.45,0.1>,s}
+// id 14
+sphere{<-0.15,-0.45,0.1>,s}
+// id 15
+sphere{<0.05,-0.45,0.1>,s}
+// id 16
+sphere{<0.25,-0.45,0.1>,s}
+// id 17
+sphere{<0.45,-0.45,0.1>,s}
+// id 18
+sphere{<0.65,-0.45,0.1>,s}
+// id 19
+sphere{<-0.75,-0.25,0.1>,s}
+// id 20
+sphere{<-0.55,-0.25,0.1>,s}
+// id 21
+sphere{<-0.35,-0.25,0.1>,s}
+// id 22
+sphere{<-0.15,-0.25,0.1>,s}
+// id 23
+sphere{<0.05,-0.25,0.1>,s}
+// id 24
+sphere{<0.25,-0.25,0.1>,s}
+// id 25
+sphere{<0.45,-0.25,0.1>,s}
+// id 26
+sphere{<0.65,-0.25,0.1>,s}
+// id 27
+sphere{<0.85,-0.25,0.1>,s}
+// id 28
+sphere{<-0.75,-0.05,0.1>,s}
+// id 29
+sphere{<-0.55,-0.05,0.1>,s}
+// id 30
+sphere{<-0.35,-0.05,0.1>,s}
+// id 31
+sphere{<-0.15,-0.05,0.1>,s}
+// id 32
+sphere{<0.05,-0.05,0.1>,s}
+// id 33
+sphere{<0.25,-0.05,0.1>,s}
+// id 34
+sphere{<0.45,-0.05,0.1>,s}
+// id 35
+sphere{<0.65,-0.05,0.1>,s}
+// id 36
+sphere{<0.85,-0.05,0.1>,s}
+// id 37
+sphere{<-0.75,0.15,0.1>,s}
+// id 38
+sphere{<-0.55,0.15,0.1>,s}
+// id 39
+sphere{<-0.35,0.15,0.1>,s}
+// id 40
+sphere{<-0.15,0.15,0.1>,s}
+// id 41
+sphere{<0.05,0.15,0.1>,s}
+// id 42
+sphere{<0.25,0.15,0.1>,s}
+// id 43
+sphere{<0.45,0.15,0.1>,s}
+// id 44
+sphere{<0.65,0.15,0.1>,s}
+// id 45
+sphere{<0.85,0.15,0.1>,s}
+// id 46
+sphere{<-0.75,0.35,0.1>,s}
+// id 47
+sphere{<-0.55,0.35,0.1>,s}
+// id 48
+sphere{<-0.35,0.35,0.1>,s}
+// id 49
+sphere{<-0.15,0.35,0.1>,s}
+// id 50
+sphere{<0.05,0.35,0.1>,s}
+// id 51
+sphere{<0.25,0.35,0.1>,s}
+// id 52
+sphere{<0.45,0.35,0.1>,s}
+// id 53
+sphere{<0.65,0.35,0.1>,s}
+// id 54
+sphere{<0.85,0.35,0.1>,s}
+// id 55
+sphere{<-0.75,0.55,0.1>,s}
+// id 56
+sphere{<-0.55,0.55,0.1>,s}
+// id 57
+sphere{<-0.35,0.55,0.1>,s}
+// id 58
+sphere{<-0.15,0.55,0.1>,s}
+// id 59
+sphere{<0.05,0.55,0.1>,s}
+// id 60
+sphere{<0.25,0.55,0.1>,s}
+// id 61
+sphere{<0.45,0.55,0.1>,s}
+// id 62
+sphere{<0.65,0.55,0.1>,s}
+// id 63
+sphere{<-0.55,0.75,0.1>,s}
+// id 64
+sphere{<-0.35,0.75,0.1>,s}
+// id 65
+sphere{<-0.15,0.75,0.1>,s}
+// id 66
+sphere{<0.05,0.75,0.1>,s}
+// id 67
+sphere{<0.25,0.75,0.1>,s}
+// id 68
+sphere{<0.45,0.75,0.1>,s}
+// id 69
+sphere{<-0.35,-0.65,0.3>,s}
+// id 70
+sphere{<-0.15,-0.65,0.3>,s}
+// id 71
+sphere{<0.05,-0.65,0.3>,s}
+// id 72
+sphere{<0.25,-0.65,0.3>,s}
+// id 73
+sphere{<0.45,-0.65,0.3>,s}
+// id 74
+sphere{<-0.55,-0.45,0.3>,s}
+// id 75
+sphere{<-0.35,-0.45,0.3>,s}
+// id 76
+sphere{<-0.15,-0.45,0.3>,s}
+// id 77
+sphere{<0.05,-0.45,0.3>,s}
+// id 78
+sphere{<0.25,-0.45,0.3>,s}
+// id 79
+sphere{<0.45,-0.45,0.3>,s}
+// id 80
+sphere{<0.65,-0.45,0.3>,s}
+// id 81
+sphere{<-0.75,-0.25,0.3>,s}
+// id 82
+sphere{<-0.55,-0.25,0.3>,s}
+// id 83
+sphere{<-0.35,-0.25,0.3>,s}
+// id 84
+sphere{<-0.15,-0.25,0.3>,s}
+// id 85
+sphere{<0.05,-0.25,0.3>,s}
+// id 86
+sphere{<0.25,-0.25,0.3>,s}
+// id 87
+sphere{<0.45,-0.25,0.3>,s}
+// id 88
+sphere{<0.65,-0.25,0.3>,s}
+// id 89
+sphere{<-0.75,-0.05,0.3>,s}
+// id 90
+sphere{<-0.55,-0.05,0.3>,s}
+// id 91
+sphere{<-0.35,-0.05,0.3>,s}
+// id 92
+sphere{<-0.15,-0.05,0.3>,s}
+// id 93
+sphere{<0.05,-0.05,0.3>,s}
+// id 94
+sphere{<0.25,-0.05,0.3>,s}
+// id 95
+sphere{<0.45,-0.05,0.3>,s}
+// id 96
+sphere{<0.65,-0.05,0.3>,s}
+// id 97
+sphere{<-0.75,0.15,0.3>,s}
+// id 98
+sphere{<-0.55,0.15,0.3>,s}
+// id 99
+sphere{<-0.35,0.15,0.3>,s}
+// id 100
+sphere{<-0.15,0.15,0.3>,s}
+// id 101
+sphere{<0.05,0.15,0.3>,s}
+// id 102
+sphere{<0.25,0.15,0.3>,s}
+// id 103
+sphere{<0.45,0.15,0.3>,s}
+// id 104
+sphere{<0.65,0.15,0.3>,s}
+// id 105
+sphere{<-0.75,0.35,0.3>,s}
+// id 106
+sphere{<-0.55,0.35,0.3>,s}
+// id 107
+sphere{<-0.35,0.35,0.3>,s}
+// id 108
+sphere{<-0.15,0.35,0.3>,s}
+// id 109
+sphere{<0.05,0.35,0.3>,s}
+// id 110
+sphere{<0.25,0.35,0.3>,s}
+// id 111
+sphere{<0.45,0.35,0.3>,s}
+// id 112
+sphere{<0.65,0.35,0.3>,s}
+// id 113
+sphere{<-0.55,0.55,0.3>,s}
+// id 114
+sphere{<-0.35,0.55,0.3>,s}
+// id 115
+sphere{<-0.15,0.55,0.3>,s}
+// id 116
+sphere{<0.05,0.55,0.3>,s}
+// id 117
+sphere{<0.25,0.55,0.3>,s}
+// id 118
+sphere{<0.45,0.55,0.3>,s}
+// id 119
+sphere{<-0.35,0.75,0.3>,s}
+// id 120
+sphere{<-0.15,0.75,0.3>,s}
+// id 121
+sphere{<0.05,0.75,0.3>,s}
+// id 122
+sphere{<0.25,0.75,0.3>,s}
+// id 123
+sphere{<-0.35,-0.65,0.5>,s}
+// id 124
+sphere{<-0.15,-0.65,0.5>,s}
+// id 125
+sphere{<0.05,-0.65,0.5>,s}
+// id 126
+sphere{<0.25,-0.65,0.5>,s}
+// id 127
+sphere{<-0.55,-0.45,0.5>,s}
+// id 128
+sphere{<-0.35,-0.45,0.5>,s}
+// id 129
+sphere{<-0.15,-0.45,0.5>,s}
+// id 130
+sphere{<0.05,-0.45,0.5>,s}
+// id 131
+sphere{<0.25,-0.45,0.5>,s}
+// id 132
+sphere{<0.45,-0.45,0.5>,s}
+// id 133
+sphere{<-0.55,-0.25,0.5>,s}
+// id 134
+sphere{<-0.35,-0.25,0.5>,s}
+// id 135
+sphere{<-0.15,-0.25,0.5>,s}
+// id 136
+sphere{<0.05,-0.25,0.5>,s}
+// id 137
+sphere{<0.25,-0.25,0.5>,s}
+// id 138
+sphere{<0.45,-0.25,0.5>,s}
+// id 139
+sphere{<0.65,-0.25,0.5>,s}
+// id 140
+sphere{<-0.55,-0.05,0.5>,s}
+// id 141
+sphere{<-0.35,-0.05,0.5>,s}
+// id 142
+sphere{<-0.15,-0.05,0.5>,s}
+// id 143
+sphere{<0.05,-0.05,0.5>,s}
+// id 144
+sphere{<0.25,-0.05,0.5>,s}
+// id 145
+sphere{<0.45,-0.05,0.5>,s}
+// id 146
+sphere{<0.65,-0.05,0.5>,s}
+// id 147
+sphere{<-0.55,0.15,0.5>,s}
+// id 148
+sphere{<-0.35,0.15,0.5>,s}
+// id 149
+sphere{<-0.15,0.15,0.5>,s}
+// id 150
+sphere{<0.05,0.15,0.5>,s}
+// id 151
+sphere{<0.25,0.15,0.5>,s}
+// id 152
+sphere{<0.45,0.15,0.5>,s}
+// id 153
+sphere{<0.65,0.15,0.5>,s}
+// id 154
+sphere{<-0.55,0.35,0.5>,s}
+// id 155
+sphere{<-0.35,0.35,0.5>,s}
+// id 156
+sphere{<-0.15,0.35,0.5>,s}
+// id 157
+sphere{<0.05,0.35,0.5>,s}
+// id 158
+sphere{<0.25,0.35,0.5>,s}
+// id 159
+sphere{<0.45,0.35,0.5>,s}
+// id 160
+sphere{<0.65,0.35,0.5>,s}
+// id 161
+sphere{<-0.35,0.55,0.5>,s}
+// id 162
+sphere{<-0.15,0.55,0.5>,s}
+// id 163
+sphere{<0.05,0.55,0.5>,s}
+// id 164
+sphere{<0.25,0.55,0.5>,s}
+// id 165
+sphere{<0.45,0.55,0.5>,s}
+// id 166
+sphere{<-0.35,-0.45,0.7>,s}
+// id 167
+sphere{<-0.15,-0.45,0.7>,s}
+// id 168
+sphere{<0.05,-0.45,0.7>,s}
+// id 169
+sphere{<0.25,-0.45,0.7>,s}
+// id 170
+sphere{<0.45,-0.45,0.7>,s}
+// id 171
+sphere{<-0.55,-0.25,0.7>,s}
+// id 172
+sphere{<-0.35,-0.25,0.7>,s}
+// id 173
+sphere{<-0.15,-0.25,0.7>,s}
+// id 174
+sphere{<0.05,-0.25,0.7>,s}
+// id 175
+sphere{<0.25,-0.25,0.7>,s}
+// id 176
+sphere{<0.45,-0.25,0.7>,s}
+// id 177
+sphere{<-0.55,-0.05,0.7>,s}
+// id 178
+sphere{<-0.35,-0.05,0.7>,s}
+// id 179
+sphere{<-0.15,-0.05,0.7>,s}
+// id 180
+sphere{<0.05,-0.05,0.7>,s}
+// id 181
+sphere{<0.25,-0.05,0.7>,s}
+// id 182
+sphere{<0.45,-0.05,0.7>,s}
+// id 183
+sphere{<-0.55,0.15,0.7>,s}
+// id 184
+sphere{<-0.35,0.15,0.7>,s}
+// id 185
+sphere{<-0.15,0.15,0.7>,s}
+// id 186
+sphere{<0.05,0.15,0.7>,s}
+// id 187
+sphere{<0.25,0.15,0.7>,s}
+// id 188
+sphere{<0.45,0.15,0.7>,s}
+// id 189
+sphere{<-0.35,0.35,0.7>,s}
+// id 190
+sphere{<-0.15,0.35,0.7>,s}
+// id 191
+sphere{<0.05,0.35,0.7>,s}
+// id 192
+sphere{<0.25,0.35,0.7>,s}
+// id 193
+sphere{<0.45,0.35,0.7>,s}
+// id 194
+sphere{<-0.15,0.55,0.7>,s}
+// id 195
+sphere{<0.05,0.55,0.7>,s}
+// id 196
+sphere{<0.25,0.55,0.7>,s}
+// id 197
+sphere{<-0.15,-0.45,0.9>,s}
+// id 198
+sphere{<0.05,-0.45,0.9>,s}
+// id 199
+sphere{<0.25,-0.45,0.9>,s}
+// id 200
+sphere{<-0.35,-0.25,0.9>,s}
+// id 201
+sphere{<-0.15,-0.25,0.9>,s}
+// id 202
+sphere{<0.05,-0.25,0.9>,s}
+// id 203
+sphere{<0.25,-0.25,0.9>,s}
+// id 204
+sphere{<0.45,-0.25,0.9>,s}
+// id 205
+sphere{<-0.35,-0.05,0.9>,s}
+// id 206
+sphere{<-0.15,-0.05,0.9>,s}
+// id 207
+sphere{<0.05,-0.05,0.9>,s}
+// id 208
+sphere{<0.25,-0.05,0.9>,s}
+// id 209
+sphere{<0.45,-0.05,0.9>,s}
+// id 210
+sphere{<-0.35,0.15,0.9>,s}
+// id 211
+sphere{<-0.15,0.15,0.9>,s}
+// id 212
+sphere{<0.05,0.15,0.9>,s}
+// id 213
+sphere{<0.25,0.15,0.9>,s}
+// id 214
+sphere{<0.45,0.15,0.9>,s}
+// id 215
+sphere{<-0.35,0.35,0.9>,s}
+// id 216
+sphere{<-0.15,0.35,0.9>,s}
+// id 217
+sphere{<0.05,0.35,0.9>,s}
+// id 218
+sphere{<0.25,0.35,0.9>,s}
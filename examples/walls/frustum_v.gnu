@@ -0,0 +1,6163 @@
+-0.25 -0.828126 0.278126
+-0.469471 -0.769471 0.219471
+-0.45 -0.75 0.2
+-0.25 -0.75 0.2
+-0.25 -0.828126 0.278126
+-0.25 -0.978516 0
+-0.553532 -0.853532 0
+-0.45 -0.75 0
+-0.45 -0.75 0.2
+
+
+-0.25 -0.978516 0
+-0.25 -0.75 0
+-0.25 -0.75 0.2
+
+
+-0.469471 -0.769471 0.219471
+-0.553532 -0.853532 0
+
+
+-0.45 -0.75 0
+-0.25 -0.75 0
+
+
+-0.05 -0.75 0.2
+-0.05 -0.852859 0.302859
+-0.25 -0.82945 0.27945
+-0.25 -0.971334 0
+-0.25 -0.75 0
+-0.25 -0.75 0.2
+-0.25 -0.82945 0.27945
+
+
+-0.05 -0.75 0.2
+-0.05 -0.75 0
+-0.05 -1.00663 0
+-0.05 -0.852859 0.302859
+
+
+-0.05 -0.75 0.2
+-0.25 -0.75 0.2
+
+
+-0.05 -1.00663 0
+-0.25 -0.971334 0
+
+
+-0.05 -0.75 0
+-0.25 -0.75 0
+
+
+0.15 -0.992905 0
+0.15 -0.8451 0.2951
+-0.05 -0.852939 0.302939
+-0.05 -1.00467 0
+-0.05 -0.75 0
+-0.05 -0.75 0.2
+-0.05 -0.852939 0.302939
+
+
+0.15 -0.992905 0
+-0.05 -1.00467 0
+
+
+0.15 -0.992905 0
+0.15 -0.75 0
+-0.05 -0.75 0
+
+
+0.15 -0.75 0.2
+0.15 -0.8451 0.2951
+
+
+0.15 -0.75 0.2
+0.15 -0.75 0
+
+
+0.15 -0.75 0.2
+-0.05 -0.75 0.2
+
+
+0.35 -0.75 0
+0.496366 -0.896366 0
+0.41582 -0.81582 0.2
+0.35 -0.805995 0.255995
+0.35 -0.75 0.2
+0.41582 -0.81582 0.2
+
+
+0.35 -0.75 0
+0.15 -0.75 0
+0.15 -0.75 0.2
+0.15 -0.844665 0.294665
+0.15 -0.998238 0
+0.15 -0.75 0
+
+
+0.35 -0.75 0
+0.35 -0.75 0.2
+0.15 -0.75 0.2
+
+
+0.15 -0.998238 0
+0.496366 -0.896366 0
+
+
+0.15 -0.844665 0.294665
+0.35 -0.805995 0.255995
+
+
+-0.681569 -0.581569 0.231569
+-0.65 -0.55 0.2
+-0.45 -0.55 0.2
+-0.54923 -0.64923 0.29923
+-0.681569 -0.581569 0.231569
+-0.763724 -0.663724 0
+-0.65 -0.55 0
+-0.65 -0.55 0.2
+
+
+-0.547058 -0.847058 0
+-0.469267 -0.769267 0.219267
+-0.54923 -0.64923 0.29923
+
+
+-0.547058 -0.847058 0
+-0.763724 -0.663724 0
+
+
+-0.547058 -0.847058 0
+-0.45 -0.75 0
+-0.45 -0.55 0
+-0.45 -0.55 0.2
+-0.45 -0.75 0.2
+-0.469267 -0.769267 0.219267
+
+
+-0.45 -0.75 0
+-0.45 -0.75 0.2
+
+
+-0.65 -0.55 0
+-0.45 -0.55 0
+
+
+-0.25 -0.75 0
+-0.25 -0.75 0.2
+-0.45 -0.75 0.2
+-0.45 -0.55 0.2
+-0.25 -0.55 0.2
+-0.25 -0.75 0.2
+
+
+-0.25 -0.75 0
+-0.45 -0.75 0
+-0.45 -0.55 0
+-0.45 -0.55 0.2
+
+
+-0.25 -0.75 0
+-0.25 -0.55 0
+-0.25 -0.55 0.2
+
+
+-0.45 -0.75 0.2
+-0.45 -0.75 0
+
+
+-0.25 -0.55 0
+-0.45 -0.55 0
+
+
+-0.05 -0.75 0.2
+-0.25 -0.75 0.2
+-0.25 -0.55 0.2
+-0.05 -0.55 0.2
+-0.05 -0.75 0.2
+-0.05 -0.75 0
+-0.25 -0.75 0
+-0.25 -0.55 0
+-0.25 -0.55 0.2
+
+
+-0.25 -0.55 0
+-0.05 -0.55 0
+-0.05 -0.75 0
+
+
+-0.25 -0.75 0.2
+-0.25 -0.75 0
+
+
+-0.05 -0.55 0
+-0.05 -0.55 0.2
+
+
+0.15 -0.75 0.2
+0.15 -0.55 0.2
+-0.05 -0.55 0.2
+-0.05 -0.55 0
+0.15 -0.55 0
+0.15 -0.55 0.2
+
+
+0.15 -0.75 0.2
+-0.05 -0.75 0.2
+-0.05 -0.55 0.2
+
+
+0.15 -0.75 0.2
+0.15 -0.75 0
+-0.05 -0.75 0
+-0.05 -0.75 0.2
+
+
+0.15 -0.55 0
+0.15 -0.75 0
+
+
+-0.05 -0.55 0
+-0.05 -0.75 0
+
+
+0.35 -0.75 0.2
+0.35 -0.55 0.2
+0.35 -0.55 0
+0.35 -0.75 0
+0.35 -0.75 0.2
+0.15 -0.75 0.2
+0.15 -0.55 0.2
+0.35 -0.55 0.2
+
+
+0.15 -0.55 0
+0.35 -0.55 0
+
+
+0.15 -0.55 0
+0.15 -0.75 0
+0.15 -0.75 0.2
+
+
+0.15 -0.55 0
+0.15 -0.55 0.2
+
+
+0.35 -0.75 0
+0.15 -0.75 0
+
+
+0.55 -0.55 0.2
+0.55 -0.713865 0.2
+0.410466 -0.810466 0.2
+0.35 -0.75 0.2
+0.35 -0.55 0.2
+0.55 -0.55 0.2
+0.55 -0.55 0
+0.55 -0.835491 0
+0.55 -0.713865 0.2
+
+
+0.482336 -0.882336 0
+0.35 -0.75 -1.38778e-17
+0.35 -0.75 0.2
+
+
+0.482336 -0.882336 0
+0.55 -0.835491 0
+
+
+0.482336 -0.882336 0
+0.410466 -0.810466 0.2
+
+
+0.55 -0.55 0
+0.35 -0.55 -1.38778e-17
+0.35 -0.75 -1.38778e-17
+
+
+0.35 -0.55 -1.38778e-17
+0.35 -0.55 0.2
+
+
+0.55 -0.55 0
+0.864214 -0.55 0
+0.722792 -0.55 0.2
+0.613829 -0.613829 0.263829
+0.55 -0.722792 0.2
+0.55 -0.55 0.2
+0.613829 -0.613829 0.263829
+
+
+0.55 -0.55 0
+0.55 -0.864214 0
+0.864214 -0.55 0
+
+
+0.55 -0.55 0
+0.55 -0.55 0.2
+0.722792 -0.55 0.2
+
+
+0.55 -0.864214 0
+0.55 -0.722792 0.2
+
+
+-0.95619 -0.35 0
+-0.65 -0.35 0
+-0.65 -0.35 0.2
+-0.736836 -0.436836 0.286836
+-0.839571 -0.35 0.2
+-0.65 -0.35 0.2
+-0.65 -0.55 0.2
+-0.681868 -0.581868 0.231868
+-0.736836 -0.436836 0.286836
+
+
+-0.95619 -0.35 0
+-0.766369 -0.666369 0
+-0.681868 -0.581868 0.231868
+
+
+-0.95619 -0.35 0
+-0.839571 -0.35 0.2
+
+
+-0.766369 -0.666369 0
+-0.65 -0.55 0
+-0.65 -0.35 0
+
+
+-0.65 -0.55 0
+-0.65 -0.55 0.2
+
+
+-0.65 -0.55 0.2
+-0.65 -0.35 0.2
+-0.65 -0.35 0
+-0.45 -0.35 0
+-0.45 -0.35 0.2
+-0.65 -0.35 0.2
+
+
+-0.65 -0.55 0.2
+-0.65 -0.55 0
+-0.65 -0.35 0
+
+
+-0.65 -0.55 0.2
+-0.45 -0.55 0.2
+-0.45 -0.55 0
+-0.65 -0.55 0
+
+
+-0.45 -0.55 0
+-0.45 -0.35 0
+
+
+-0.45 -0.35 0.2
+-0.45 -0.55 0.2
+
+
+-0.25 -0.55 0
+-0.25 -0.55 0.2
+-0.45 -0.55 0.2
+-0.45 -0.55 0
+-0.45 -0.35 0
+-0.45 -0.35 0.2
+-0.45 -0.55 0.2
+
+
+-0.25 -0.55 0
+-0.45 -0.55 0
+
+
+-0.25 -0.55 0
+-0.25 -0.35 0
+-0.45 -0.35 0
+
+
+-0.25 -0.35 0
+-0.25 -0.35 0.2
+-0.25 -0.55 0.2
+
+
+-0.45 -0.35 0.2
+-0.25 -0.35 0.2
+
+
+-0.05 -0.55 0
+-0.25 -0.55 0
+-0.25 -0.55 0.2
+-0.25 -0.35 0.2
+-0.05 -0.35 0.2
+-0.05 -0.35 0
+-0.05 -0.55 0
+-0.05 -0.55 0.2
+-0.05 -0.35 0.2
+
+
+-0.25 -0.35 0
+-0.25 -0.35 0.2
+
+
+-0.25 -0.35 0
+-0.05 -0.35 0
+
+
+-0.25 -0.35 0
+-0.25 -0.55 0
+
+
+-0.05 -0.55 0.2
+-0.25 -0.55 0.2
+
+
+-0.05 -0.55 0.2
+0.15 -0.55 0.2
+0.15 -0.35 0.2
+0.15 -0.35 0
+0.15 -0.55 0
+-0.05 -0.55 0
+-0.05 -0.35 0
+0.15 -0.35 0
+
+
+-0.05 -0.55 0.2
+-0.05 -0.35 0.2
+0.15 -0.35 0.2
+
+
+-0.05 -0.55 0.2
+-0.05 -0.55 0
+
+
+-0.05 -0.35 0
+-0.05 -0.35 0.2
+
+
+0.15 -0.55 0
+0.15 -0.55 0.2
+
+
+0.15 -0.55 0.2
+0.15 -0.35 0.2
+0.35 -0.35 0.2
+0.35 -0.55 0.2
+0.15 -0.55 0.2
+0.15 -0.55 0
+0.15 -0.35 0
+0.15 -0.35 0.2
+
+
+0.35 -0.35 0.2
+0.35 -0.35 0
+0.35 -0.55 0
+0.15 -0.55 0
+
+
+0.35 -0.35 0
+0.15 -0.35 0
+
+
+0.35 -0.55 0
+0.35 -0.55 0.2
+
+
+0.55 -0.35 0
+0.55 -0.35 0.2
+0.55 -0.55 0.2
+0.35 -0.55 0.2
+0.35 -0.35 0.2
+0.55 -0.35 0.2
+
+
+0.55 -0.35 0
+0.55 -0.55 0
+0.55 -0.55 0.2
+
+
+0.55 -0.35 0
+0.35 -0.35 0
+0.35 -0.55 0
+0.35 -0.55 0.2
+
+
+0.55 -0.55 0
+0.35 -0.55 0
+
+
+0.35 -0.35 0.2
+0.35 -0.35 0
+
+
+0.713865 -0.55 0.2
+0.55 -0.55 0.2
+0.55 -0.55 0
+0.55 -0.35 0
+0.55 -0.35 0.2
+0.55 -0.55 0.2
+
+
+0.713865 -0.55 0.2
+0.835491 -0.55 0
+0.55 -0.55 0
+
+
+0.713865 -0.55 0.2
+0.810466 -0.410466 0.2
+0.882336 -0.482336 0
+0.835491 -0.55 0
+
+
+0.882336 -0.482336 0
+0.75 -0.35 0
+0.55 -0.35 0
+
+
+0.810466 -0.410466 0.2
+0.75 -0.35 0.2
+0.55 -0.35 0.2
+
+
+0.75 -0.35 0.2
+0.75 -0.35 0
+
+
+-0.65 -0.35 0
+-0.65 -0.35 0.2
+-0.832017 -0.35 0.2
+-0.898683 -0.15 0.2
+-1.00409 -0.15 0
+-0.65 -0.15 0
+-0.65 -0.15 0.2
+-0.65 -0.35 0.2
+
+
+-0.65 -0.35 0
+-0.937426 -0.35 0
+-0.832017 -0.35 0.2
+
+
+-0.65 -0.35 0
+-0.65 -0.15 0
+
+
+-0.937426 -0.35 0
+-1.00409 -0.15 0
+
+
+-0.65 -0.15 0.2
+-0.898683 -0.15 0.2
+
+
+-0.45 -0.35 0
+-0.65 -0.35 0
+-0.65 -0.15 0
+-0.65 -0.15 0.2
+-0.65 -0.35 0.2
+-0.65 -0.35 0
+
+
+-0.45 -0.35 0
+-0.45 -0.15 0
+-0.45 -0.15 0.2
+-0.45 -0.35 0.2
+-0.45 -0.35 0
+
+
+-0.45 -0.35 0.2
+-0.65 -0.35 0.2
+
+
+-0.45 -0.15 0.2
+-0.65 -0.15 0.2
+
+
+-0.45 -0.15 0
+-0.65 -0.15 0
+
+
+-0.25 -0.35 0
+-0.45 -0.35 0
+-0.45 -0.35 0.2
+-0.25 -0.35 0.2
+-0.25 -0.15 0.2
+-0.25 -0.15 0
+-0.25 -0.35 0
+-0.25 -0.35 0.2
+
+
+-0.25 -0.15 0
+-0.45 -0.15 0
+-0.45 -0.35 0
+
+
+-0.25 -0.15 0.2
+-0.45 -0.15 0.2
+-0.45 -0.35 0.2
+
+
+-0.45 -0.15 0
+-0.45 -0.15 0.2
+
+
+-0.05 -0.35 0
+-0.25 -0.35 0
+-0.25 -0.35 0.2
+-0.05 -0.35 0.2
+-0.05 -0.35 0
+-0.05 -0.15 0
+-0.25 -0.15 0
+-0.25 -0.15 0.2
+-0.25 -0.35 0.2
+
+
+-0.25 -0.15 0.2
+-0.05 -0.15 0.2
+-0.05 -0.35 0.2
+
+
+-0.25 -0.35 0
+-0.25 -0.15 0
+
+
+-0.05 -0.15 0.2
+-0.05 -0.15 0
+
+
+0.15 -0.15 0
+0.15 -0.15 0.2
+0.15 -0.35 0.2
+-0.05 -0.35 0.2
+-0.05 -0.15 0.2
+0.15 -0.15 0.2
+
+
+0.15 -0.15 0
+0.15 -0.35 0
+0.15 -0.35 0.2
+
+
+0.15 -0.15 0
+-0.05 -0.15 0
+-0.05 -0.15 0.2
+
+
+-0.05 -0.35 0
+-0.05 -0.15 0
+
+
+-0.05 -0.35 0
+0.15 -0.35 0
+
+
+-0.05 -0.35 0
+-0.05 -0.35 0.2
+
+
+0.35 -0.15 0
+0.35 -0.35 0
+0.35 -0.35 0.2
+0.35 -0.15 0.2
+0.35 -0.15 0
+0.15 -0.15 0
+0.15 -0.35 0
+0.15 -0.35 0.2
+0.35 -0.35 0.2
+
+
+0.15 -0.15 0.2
+0.35 -0.15 0.2
+
+
+0.15 -0.15 0.2
+0.15 -0.15 0
+
+
+0.15 -0.15 0.2
+0.15 -0.35 0.2
+
+
+0.35 -0.35 0
+0.15 -0.35 0
+
+
+0.35 -0.35 0.2
+0.35 -0.15 0.2
+0.55 -0.15 0.2
+0.55 -0.15 0
+0.55 -0.35 0
+0.55 -0.35 0.2
+0.35 -0.35 0.2
+0.35 -0.35 0
+0.35 -0.15 0
+0.35 -0.15 0.2
+
+
+0.35 -0.15 0
+0.55 -0.15 0
+
+
+0.35 -0.35 0
+0.55 -0.35 0
+
+
+0.55 -0.15 0.2
+0.55 -0.35 0.2
+
+
+0.55 -0.35 0.2
+0.55 -0.15 0.2
+0.75 -0.15 0.2
+0.75 -0.35 0.2
+0.55 -0.35 0.2
+0.55 -0.35 0
+0.55 -0.15 0
+0.55 -0.15 0.2
+
+
+0.55 -0.15 0
+0.75 -0.15 0
+0.75 -0.35 0
+0.55 -0.35 0
+
+
+0.75 -0.15 0
+0.75 -0.15 0.2
+
+
+0.75 -0.35 0.2
+0.75 -0.35 0
+
+
+0.896366 -0.496366 0
+0.75 -0.35 0
+0.75 -0.35 0.2
+0.805995 -0.35 0.255995
+0.81582 -0.41582 0.2
+0.75 -0.35 0.2
+0.75 -0.15 0.2
+0.844665 -0.15 0.294665
+0.805995 -0.35 0.255995
+
+
+0.896366 -0.496366 0
+0.998238 -0.15 0
+0.844665 -0.15 0.294665
+
+
+0.896366 -0.496366 0
+0.81582 -0.41582 0.2
+
+
+0.75 -0.15 0
+0.998238 -0.15 0
+
+
+0.75 -0.15 0
+0.75 -0.35 0
+
+
+0.75 -0.15 0
+0.75 -0.15 0.2
+
+
+-0.65 0.05 0
+-0.65 0.05 0.2
+-0.905331 0.05 0.2
+-1.00555 0.05 0
+-0.65 0.05 0
+-0.65 -0.15 0
+-0.99222 -0.15 0
+-0.891998 -0.15 0.2
+-0.65 -0.15 0.2
+-0.65 -0.15 0
+
+
+-1.00555 0.05 0
+-0.99222 -0.15 0
+
+
+-0.905331 0.05 0.2
+-0.891998 -0.15 0.2
+
+
+-0.65 0.05 0.2
+-0.65 -0.15 0.2
+
+
+-0.45 -0.15 0
+-0.65 -0.15 0
+-0.65 -0.15 0.2
+-0.45 -0.15 0.2
+-0.45 -0.15 0
+-0.45 0.05 0
+-0.45 0.05 0.2
+-0.45 -0.15 0.2
+
+
+-0.65 -0.15 0
+-0.65 0.05 0
+-0.65 0.05 0.2
+-0.65 -0.15 0.2
+
+
+-0.45 0.05 0
+-0.65 0.05 0
+
+
+-0.65 0.05 0.2
+-0.45 0.05 0.2
+
+
+-0.25 -0.15 0
+-0.25 -0.15 0.2
+-0.45 -0.15 0.2
+-0.45 0.05 0.2
+-0.25 0.05 0.2
+-0.25 -0.15 0.2
+
+
+-0.25 -0.15 0
+-0.45 -0.15 0
+-0.45 -0.15 0.2
+
+
+-0.25 -0.15 0
+-0.25 0.05 1.38778e-17
+-0.25 0.05 0.2
+
+
+-0.45 0.05 1.38778e-17
+-0.45 0.05 0.2
+
+
+-0.45 0.05 1.38778e-17
+-0.25 0.05 1.38778e-17
+
+
+-0.45 0.05 1.38778e-17
+-0.45 -0.15 0
+
+
+-0.05 -0.15 0
+-0.05 -0.15 0.2
+-0.05 0.05 0.2
+-0.05 0.05 0
+-0.05 -0.15 0
+-0.25 -0.15 0
+-0.25 -0.15 0.2
+-0.25 0.05 0.2
+-0.05 0.05 0.2
+
+
+-0.25 0.05 0.2
+-0.25 0.05 0
+-0.05 0.05 0
+
+
+-0.25 0.05 0
+-0.25 -0.15 0
+
+
+-0.05 -0.15 0.2
+-0.25 -0.15 0.2
+
+
+0.15 -0.15 0
+-0.05 -0.15 0
+-0.05 -0.15 0.2
+0.15 -0.15 0.2
+0.15 -0.15 0
+0.15 0.05 0
+0.15 0.05 0.2
+0.15 -0.15 0.2
+
+
+-0.05 0.05 0.2
+-0.05 0.05 0
+0.15 0.05 0
+
+
+-0.05 0.05 0.2
+-0.05 -0.15 0.2
+
+
+-0.05 0.05 0.2
+0.15 0.05 0.2
+
+
+-0.05 0.05 0
+-0.05 -0.15 0
+
+
+0.15 0.05 0.2
+0.15 -0.15 0.2
+0.15 -0.15 0
+0.15 0.05 0
+0.15 0.05 0.2
+0.35 0.05 0.2
+0.35 -0.15 0.2
+0.15 -0.15 0.2
+
+
+0.35 0.05 0.2
+0.35 0.05 0
+0.35 -0.15 0
+0.35 -0.15 0.2
+
+
+0.35 -0.15 0
+0.15 -0.15 0
+
+
+0.15 0.05 0
+0.35 0.05 0
+
+
+0.55 -0.15 0.2
+0.55 -0.15 -1.38778e-17
+0.35 -0.15 -1.38778e-17
+0.35 -0.15 0.2
+0.55 -0.15 0.2
+0.55 0.05 0.2
+0.55 0.05 -1.38778e-17
+0.55 -0.15 -1.38778e-17
+
+
+0.35 0.05 -1.38778e-17
+0.35 0.05 0.2
+0.55 0.05 0.2
+
+
+0.35 0.05 -1.38778e-17
+0.55 0.05 -1.38778e-17
+
+
+0.35 0.05 -1.38778e-17
+0.35 -0.15 -1.38778e-17
+
+
+0.35 -0.15 0.2
+0.35 0.05 0.2
+
+
+0.75 0.05 0.2
+0.75 -0.15 0.2
+0.55 -0.15 0.2
+0.55 0.05 0.2
+0.75 0.05 0.2
+0.75 0.05 0
+0.75 -0.15 0
+0.75 -0.15 0.2
+
+
+0.55 0.05 0
+0.55 0.05 0.2
+
+
+0.55 0.05 0
+0.75 0.05 0
+
+
+0.55 0.05 0
+0.55 -0.15 0
+0.55 -0.15 0.2
+
+
+0.55 -0.15 0
+0.75 -0.15 0
+
+
+0.992905 -0.15 0
+0.75 -0.15 0
+0.75 0.05 0
+1.00467 0.05 0
+0.852939 0.05 0.302939
+0.75 0.05 0.2
+0.75 0.05 0
+
+
+0.992905 -0.15 0
+1.00467 0.05 0
+
+
+0.992905 -0.15 0
+0.8451 -0.15 0.2951
+0.75 -0.15 0.2
+0.75 0.05 0.2
+
+
+0.852939 0.05 0.302939
+0.8451 -0.15 0.2951
+
+
+0.75 -0.15 0
+0.75 -0.15 0.2
+
+
+-0.65 0.05 0.2
+-0.65 0.05 0
+-1.0098 0.05 0
+-0.907824 0.05 0.2
+-0.65 0.05 0.2
+-0.65 0.25 0.2
+-0.867824 0.25 0.2
+-0.969804 0.25 0
+-0.65 0.25 0
+-0.65 0.05 0
+
+
+-0.969804 0.25 0
+-1.0098 0.05 0
+
+
+-0.65 0.25 0
+-0.65 0.25 0.2
+
+
+-0.867824 0.25 0.2
+-0.907824 0.05 0.2
+
+
+-0.45 0.05 0
+-0.65 0.05 0
+-0.65 0.05 0.2
+-0.45 0.05 0.2
+-0.45 0.05 0
+-0.45 0.25 0
+-0.45 0.25 0.2
+-0.65 0.25 0.2
+-0.65 0.25 0
+-0.45 0.25 0
+
+
+-0.65 0.25 0.2
+-0.65 0.05 0.2
+
+
+-0.45 0.05 0.2
+-0.45 0.25 0.2
+
+
+-0.65 0.25 0
+-0.65 0.05 0
+
+
+-0.25 0.25 0.2
+-0.25 0.05 0.2
+-0.45 0.05 0.2
+-0.45 0.25 0.2
+-0.25 0.25 0.2
+-0.25 0.25 0
+-0.25 0.05 0
+-0.45 0.05 0
+-0.45 0.25 0
+-0.25 0.25 0
+
+
+-0.25 0.05 0.2
+-0.25 0.05 0
+
+
+-0.45 0.25 0
+-0.45 0.25 0.2
+
+
+-0.45 0.05 0
+-0.45 0.05 0.2
+
+
+-0.05 0.05 0
+-0.05 0.05 0.2
+-0.05 0.25 0.2
+-0.05 0.25 0
+-0.05 0.05 0
+-0.25 0.05 0
+-0.25 0.05 0.2
+-0.25 0.25 0.2
+-0.05 0.25 0.2
+
+
+-0.25 0.05 0.2
+-0.05 0.05 0.2
+
+
+-0.25 0.25 0
+-0.25 0.25 0.2
+
+
+-0.25 0.25 0
+-0.05 0.25 0
+
+
+-0.25 0.25 0
+-0.25 0.05 0
+
+
+0.15 0.05 0
+-0.05 0.05 0
+-0.05 0.05 0.2
+-0.05 0.25 0.2
+-0.05 0.25 0
+0.15 0.25 0
+0.15 0.25 0.2
+-0.05 0.25 0.2
+
+
+0.15 0.05 0
+0.15 0.25 0
+
+
+0.15 0.05 0
+0.15 0.05 0.2
+-0.05 0.05 0.2
+
+
+-0.05 0.25 0
+-0.05 0.05 0
+
+
+0.15 0.05 0.2
+0.15 0.25 0.2
+
+
+0.35 0.05 0
+0.15 0.05 0
+0.15 0.05 0.2
+0.35 0.05 0.2
+0.35 0.05 0
+0.35 0.25 0
+0.35 0.25 0.2
+0.35 0.05 0.2
+
+
+0.35 0.25 0.2
+0.15 0.25 0.2
+0.15 0.25 0
+0.35 0.25 0
+
+
+0.15 0.05 0.2
+0.15 0.25 0.2
+
+
+0.15 0.25 0
+0.15 0.05 0
+
+
+0.55 0.05 0
+0.55 0.05 0.2
+0.55 0.25 0.2
+0.55 0.25 0
+0.55 0.05 0
+0.35 0.05 0
+0.35 0.05 0.2
+0.55 0.05 0.2
+
+
+0.35 0.25 0
+0.55 0.25 0
+
+
+0.35 0.25 0
+0.35 0.05 0
+
+
+0.35 0.25 0
+0.35 0.25 0.2
+0.55 0.25 0.2
+
+
+0.35 0.25 0.2
+0.35 0.05 0.2
+
+
+0.55 0.25 0
+0.75 0.25 0
+0.75 0.25 0.2
+0.55 0.25 0.2
+0.55 0.25 0
+0.55 0.05 0
+0.55 0.05 0.2
+0.55 0.25 0.2
+
+
+0.75 0.25 0.2
+0.75 0.05 0.2
+0.55 0.05 0.2
+
+
+0.75 0.05 0
+0.75 0.05 0.2
+
+
+0.75 0.05 0
+0.55 0.05 0
+
+
+0.75 0.05 0
+0.75 0.25 0
+
+
+0.971334 0.25 0
+0.82945 0.25 0.27945
+0.75 0.25 0.2
+0.75 0.25 0
+0.971334 0.25 0
+1.00663 0.05 0
+0.75 0.05 0
+0.75 0.05 0.2
+0.75 0.25 0.2
+
+
+0.75 0.25 0
+0.75 0.05 0
+
+
+0.82945 0.25 0.27945
+0.852859 0.05 0.302859
+0.75 0.05 0.2
+
+
+1.00663 0.05 0
+0.852859 0.05 0.302859
+
+
+-0.65 0.45 0.2
+-0.65 0.25 0.2
+-0.65 0.25 0
+-0.986863 0.25 0
+-0.87651 0.25 0.2
+-0.65 0.25 0.2
+
+
+-0.65 0.45 0.2
+-0.65 0.45 0
+-0.65 0.25 0
+
+
+-0.65 0.45 0.2
+-0.783177 0.45 0.2
+-0.89353 0.45 0
+-0.65 0.45 0
+
+
+-0.89353 0.45 0
+-0.986863 0.25 0
+
+
+-0.783177 0.45 0.2
+-0.87651 0.25 0.2
+
+
+-0.45 0.25 0.2
+-0.45 0.25 0
+-0.65 0.25 0
+-0.65 0.25 0.2
+-0.45 0.25 0.2
+-0.45 0.45 0.2
+-0.45 0.45 0
+-0.45 0.25 0
+
+
+-0.45 0.45 0.2
+-0.65 0.45 0.2
+-0.65 0.45 0
+-0.45 0.45 0
+
+
+-0.65 0.25 0.2
+-0.65 0.45 0.2
+
+
+-0.65 0.25 0
+-0.65 0.45 0
+
+
+-0.25 0.25 0
+-0.25 0.25 0.2
+-0.25 0.45 0.2
+-0.25 0.45 0
+-0.25 0.25 0
+-0.45 0.25 0
+-0.45 0.25 0.2
+-0.25 0.25 0.2
+
+
+-0.25 0.45 0.2
+-0.45 0.45 0.2
+-0.45 0.45 0
+-0.25 0.45 0
+
+
+-0.45 0.45 0.2
+-0.45 0.25 0.2
+
+
+-0.45 0.45 0
+-0.45 0.25 0
+
+
+-0.05 0.25 0
+-0.05 0.25 0.2
+-0.05 0.45 0.2
+-0.25 0.45 0.2
+-0.25 0.45 0
+-0.05 0.45 0
+-0.05 0.25 0
+-0.25 0.25 0
+-0.25 0.25 0.2
+-0.05 0.25 0.2
+
+
+-0.25 0.45 0
+-0.25 0.25 0
+
+
+-0.05 0.45 0
+-0.05 0.45 0.2
+
+
+-0.25 0.45 0.2
+-0.25 0.25 0.2
+
+
+0.15 0.25 0
+-0.05 0.25 0
+-0.05 0.25 0.2
+0.15 0.25 0.2
+0.15 0.25 0
+0.15 0.45 0
+0.15 0.45 0.2
+0.15 0.25 0.2
+
+
+-0.05 0.45 0
+-0.05 0.45 0.2
+0.15 0.45 0.2
+
+
+-0.05 0.45 0
+0.15 0.45 0
+
+
+-0.05 0.45 0
+-0.05 0.25 0
+
+
+-0.05 0.25 0.2
+-0.05 0.45 0.2
+
+
+0.35 0.25 0
+0.15 0.25 0
+0.15 0.45 0
+0.35 0.45 0
+0.35 0.25 0
+0.35 0.25 0.2
+0.35 0.45 0.2
+0.15 0.45 0.2
+0.15 0.45 0
+
+
+0.35 0.45 0.2
+0.35 0.45 0
+
+
+0.35 0.25 0.2
+0.15 0.25 0.2
+0.15 0.45 0.2
+
+
+0.15 0.25 0
+0.15 0.25 0.2
+
+
+0.55 0.25 0
+0.55 0.25 0.2
+0.35 0.25 0.2
+0.35 0.45 0.2
+0.35 0.45 0
+0.55 0.45 0
+0.55 0.25 0
+0.35 0.25 0
+0.35 0.25 0.2
+
+
+0.55 0.45 0.2
+0.35 0.45 0.2
+
+
+0.55 0.45 0.2
+0.55 0.25 0.2
+
+
+0.55 0.45 0.2
+0.55 0.45 0
+
+
+0.35 0.45 0
+0.35 0.25 0
+
+
+0.55 0.45 0
+0.75 0.45 0
+0.75 0.45 0.2
+0.75 0.25 0.2
+0.75 0.25 0
+0.55 0.25 0
+0.55 0.45 0
+0.55 0.45 0.2
+0.55 0.25 0.2
+0.75 0.25 0.2
+
+
+0.75 0.45 0.2
+0.55 0.45 0.2
+
+
+0.55 0.25 0.2
+0.55 0.25 0
+
+
+0.75 0.45 0
+0.75 0.25 0
+
+
+0.75 0.25 0
+0.75 0.45 0
+0.853532 0.553532 0
+0.769471 0.469471 0.219471
+0.828126 0.25 0.278126
+0.75 0.25 0.2
+0.75 0.45 0.2
+0.769471 0.469471 0.219471
+
+
+0.75 0.25 0
+0.978516 0.25 0
+0.853532 0.553532 0
+
+
+0.75 0.25 0
+0.75 0.25 0.2
+
+
+0.75 0.45 0
+0.75 0.45 0.2
+
+
+0.978516 0.25 0
+0.828126 0.25 0.278126
+
+
+-0.910072 0.45 0
+-0.786065 0.45 0.2
+-0.707817 0.507817 0.257817
+-0.65 0.635543 0.2
+-0.65 0.45 0.2
+-0.707817 0.507817 0.257817
+
+
+-0.910072 0.45 0
+-0.715426 0.715426 0
+-0.65 0.65 0
+-0.65 0.65 0.182901
+-0.715426 0.715426 0
+
+
+-0.910072 0.45 0
+-0.65 0.45 0
+-0.65 0.45 0.2
+-0.786065 0.45 0.2
+
+
+-0.65 0.65 0.182901
+-0.65 0.635543 0.2
+
+
+-0.65 0.65 0
+-0.65 0.45 0
+
+
+-0.45 0.45 0
+-0.65 0.45 0
+-0.65 0.45 0.2
+-0.45 0.45 0.2
+-0.45 0.45 0
+-0.45 0.65 0
+-0.45 0.65 0.2
+-0.45 0.45 0.2
+
+
+-0.45 0.65 0
+-0.65 0.65 0
+-0.65 0.45 0
+
+
+-0.65 0.622792 0.2
+-0.622792 0.65 0.2
+-0.45 0.65 0.2
+
+
+-0.65 0.622792 0.2
+-0.65 0.65 0.161522
+-0.65 0.65 0
+
+
+-0.65 0.622792 0.2
+-0.65 0.45 0.2
+
+
+-0.65 0.65 0.161522
+-0.622792 0.65 0.2
+
+
+-0.45 0.45 0.2
+-0.45 0.45 0
+-0.45 0.65 0
+-0.25 0.65 0
+-0.25 0.45 0
+-0.45 0.45 0
+
+
+-0.45 0.45 0.2
+-0.25 0.45 0.2
+-0.25 0.45 0
+
+
+-0.45 0.45 0.2
+-0.45 0.65 0.2
+-0.25 0.65 0.2
+-0.25 0.45 0.2
+
+
+-0.45 0.65 0
+-0.45 0.65 0.2
+
+
+-0.25 0.65 0.2
+-0.25 0.65 0
+
+
+-0.05 0.45 0
+-0.05 0.45 0.2
+-0.05 0.65 0.2
+-0.05 0.65 0
+-0.05 0.45 0
+-0.25 0.45 0
+-0.25 0.45 0.2
+-0.25 0.65 0.2
+-0.05 0.65 0.2
+
+
+-0.05 0.65 0
+-0.25 0.65 0
+-0.25 0.65 0.2
+
+
+-0.05 0.45 0.2
+-0.25 0.45 0.2
+
+
+-0.25 0.65 0
+-0.25 0.45 0
+
+
+-0.05 0.65 0
+-0.05 0.65 0.2
+0.15 0.65 0.2
+0.15 0.45 0.2
+-0.05 0.45 0.2
+-0.05 0.65 0.2
+
+
+-0.05 0.65 0
+0.15 0.65 0
+0.15 0.45 0
+-0.05 0.45 0
+-0.05 0.45 0.2
+
+
+-0.05 0.65 0
+-0.05 0.45 0
+
+
+0.15 0.65 0
+0.15 0.65 0.2
+
+
+0.15 0.45 0
+0.15 0.45 0.2
+
+
+0.35 0.45 0
+0.35 0.45 0.2
+0.15 0.45 0.2
+0.15 0.65 0.2
+0.15 0.65 0
+0.35 0.65 0
+0.35 0.45 0
+0.15 0.45 0
+0.15 0.65 0
+
+
+0.35 0.65 0.2
+0.15 0.65 0.2
+
+
+0.35 0.65 0.2
+0.35 0.45 0.2
+
+
+0.35 0.65 0.2
+0.35 0.65 0
+
+
+0.15 0.45 0.2
+0.15 0.45 0
+
+
+0.35 0.45 0
+0.35 0.65 0
+0.35 0.65 0.2
+0.55 0.65 0.2
+0.55 0.45 0.2
+0.35 0.45 0.2
+0.35 0.65 0.2
+
+
+0.35 0.45 0
+0.55 0.45 0
+0.55 0.45 0.2
+
+
+0.35 0.45 0
+0.35 0.45 0.2
+
+
+0.35 0.65 0
+0.55 0.65 0
+0.55 0.65 0.2
+
+
+0.55 0.45 0
+0.55 0.65 0
+
+
+0.55 0.45 0
+0.55 0.65 0
+0.663724 0.763724 0
+0.581569 0.681569 0.231569
+0.64923 0.54923 0.29923
+0.55 0.45 0.2
+0.55 0.65 0.2
+0.581569 0.681569 0.231569
+
+
+0.55 0.45 0
+0.75 0.45 0
+0.75 0.45 0.2
+0.55 0.45 0.2
+0.55 0.45 0
+
+
+0.769267 0.469267 0.219267
+0.75 0.45 0.2
+
+
+0.769267 0.469267 0.219267
+0.847058 0.547058 0
+0.75 0.45 0
+
+
+0.769267 0.469267 0.219267
+0.64923 0.54923 0.29923
+
+
+0.847058 0.547058 0
+0.663724 0.763724 0
+
+
+0.55 0.65 0.2
+0.55 0.65 0
+
+
+-0.45 0.65 0
+-0.65 0.65 0
+-0.715426 0.715426 0
+-0.65 0.65 0.182901
+-0.65 0.65 0
+
+
+-0.45 0.65 0
+-0.45 0.910072 0
+-0.715426 0.715426 0
+
+
+-0.45 0.65 0
+-0.45 0.65 0.2
+-0.635543 0.65 0.2
+-0.507817 0.707817 0.257817
+-0.45 0.65 0.2
+-0.45 0.786065 0.2
+-0.45 0.910072 0
+
+
+-0.507817 0.707817 0.257817
+-0.45 0.786065 0.2
+
+
+-0.65 0.65 0.182901
+-0.635543 0.65 0.2
+
+
+-0.45 0.65 -1.38778e-17
+-0.45 0.89353 0
+-0.45 0.783177 0.2
+-0.25 0.87651 0.2
+-0.25 0.986863 0
+-0.25 0.65 -1.38778e-17
+-0.25 0.65 0.2
+-0.25 0.87651 0.2
+
+
+-0.45 0.65 -1.38778e-17
+-0.25 0.65 -1.38778e-17
+
+
+-0.45 0.65 -1.38778e-17
+-0.45 0.65 0.2
+-0.45 0.783177 0.2
+
+
+-0.45 0.89353 0
+-0.25 0.986863 0
+
+
+-0.45 0.65 0.2
+-0.25 0.65 0.2
+
+
+-0.05 0.65 0
+-0.05 0.65 0.2
+-0.05 0.907824 0.2
+-0.05 1.0098 0
+-0.05 0.65 0
+-0.25 0.65 0
+-0.25 0.65 0.2
+-0.25 0.867824 0.2
+-0.05 0.907824 0.2
+
+
+-0.25 0.969804 0
+-0.25 0.867824 0.2
+
+
+-0.25 0.969804 0
+-0.05 1.0098 0
+
+
+-0.25 0.969804 0
+-0.25 0.65 0
+
+
+-0.25 0.65 0.2
+-0.05 0.65 0.2
+
+
+0.15 0.65 0
+-0.05 0.65 0
+-0.05 1.00555 0
+-0.05 0.905331 0.2
+-0.05 0.65 0.2
+0.15 0.65 0.2
+0.15 0.65 0
+0.15 0.99222 0
+-0.05 1.00555 0
+
+
+0.15 0.99222 0
+0.15 0.891998 0.2
+0.15 0.65 0.2
+
+
+-0.05 0.65 0.2
+-0.05 0.65 0
+
+
+0.15 0.891998 0.2
+-0.05 0.905331 0.2
+
+
+0.15 0.65 0
+0.15 1.00409 0
+0.15 0.898683 0.2
+0.35 0.832017 0.2
+0.35 0.65 0.2
+0.15 0.65 0.2
+0.15 0.898683 0.2
+
+
+0.15 0.65 0
+0.35 0.65 0
+0.35 0.65 0.2
+
+
+0.15 0.65 0
+0.15 0.65 0.2
+
+
+0.15 1.00409 0
+0.35 0.937426 0
+0.35 0.65 0
+
+
+0.35 0.832017 0.2
+0.35 0.937426 0
+
+
+0.35 0.65 0
+0.35 0.95619 0
+0.35 0.839571 0.2
+0.436836 0.736836 0.286836
+0.35 0.65 0.2
+0.35 0.839571 0.2
+
+
+0.35 0.65 0
+0.55 0.65 0
+0.55 0.65 0.2
+0.35 0.65 0.2
+0.35 0.65 0
+
+
+0.55 0.65 0.2
+0.581868 0.681868 0.231868
+0.666369 0.766369 0
+0.55 0.65 0
+
+
+0.666369 0.766369 0
+0.35 0.95619 0
+
+
+0.581868 0.681868 0.231868
+0.436836 0.736836 0.286836
+
+
+-0.45 -0.75 0.2
+-0.45 -0.55 0.2
+-0.559134 -0.659134 0.309134
+-0.464182 -0.764182 0.214182
+-0.45 -0.75 0.2
+-0.25 -0.75 0.2
+-0.25 -0.55 0.2
+-0.45 -0.55 0.2
+-0.45 -0.55 0.4
+-0.525593 -0.625593 0.4
+-0.559134 -0.659134 0.309134
+
+
+-0.25 -0.75 0.2
+-0.25 -0.837739 0.287739
+-0.25 -0.773989 0.4
+-0.25 -0.55 0.4
+-0.25 -0.55 0.2
+
+
+-0.525593 -0.625593 0.4
+-0.25 -0.773989 0.4
+
+
+-0.25 -0.55 0.4
+-0.45 -0.55 0.4
+
+
+-0.25 -0.837739 0.287739
+-0.464182 -0.764182 0.214182
+
+
+-0.05 -0.809487 0.4
+-0.25 -0.763333 0.4
+-0.25 -0.826636 0.276636
+-0.05 -0.857138 0.307138
+-0.05 -0.809487 0.4
+-0.05 -0.55 0.4
+-0.05 -0.55 0.2
+-0.05 -0.75 0.2
+-0.05 -0.857138 0.307138
+
+
+-0.25 -0.55 0.2
+-0.25 -0.75 0.2
+-0.25 -0.826636 0.276636
+
+
+-0.25 -0.55 0.2
+-0.25 -0.55 0.4
+-0.25 -0.763333 0.4
+
+
+-0.25 -0.55 0.2
+-0.05 -0.55 0.2
+
+
+-0.25 -0.75 0.2
+-0.05 -0.75 0.2
+
+
+-0.05 -0.55 0.4
+-0.25 -0.55 0.4
+
+
+-0.05 -0.854234 0.304234
+0.15 -0.843988 0.293988
+0.15 -0.790825 0.4
+0.15 -0.55 0.4
+0.15 -0.55 0.2
+0.15 -0.75 0.2
+0.15 -0.843988 0.293988
+
+
+-0.05 -0.854234 0.304234
+-0.05 -0.80621 0.4
+-0.05 -0.55 0.4
+0.15 -0.55 0.4
+
+
+-0.05 -0.854234 0.304234
+-0.05 -0.75 0.2
+-0.05 -0.55 0.2
+0.15 -0.55 0.2
+
+
+-0.05 -0.55 0.4
+-0.05 -0.55 0.2
+
+
+-0.05 -0.80621 0.4
+0.15 -0.790825 0.4
+
+
+0.15 -0.75 0.2
+-0.05 -0.75 0.2
+
+
+0.35 -0.722516 0.4
+0.15 -0.799439 0.4
+0.15 -0.85196 0.30196
+0.35 -0.80187 0.25187
+0.35 -0.75 0.2
+0.35 -0.55 0.2
+0.35 -0.55 0.4
+0.35 -0.722516 0.4
+0.35 -0.80187 0.25187
+
+
+0.35 -0.55 0.4
+0.15 -0.55 0.4
+0.15 -0.55 0.2
+0.35 -0.55 0.2
+
+
+0.15 -0.85196 0.30196
+0.15 -0.75 0.2
+0.15 -0.55 0.2
+
+
+0.15 -0.55 0.4
+0.15 -0.799439 0.4
+
+
+0.15 -0.75 0.2
+0.35 -0.75 0.2
+
+
+0.55 -0.55 0.2
+0.55 -0.55 0.4
+0.568361 -0.568361 0.418361
+0.428551 -0.628551 0.478551
+0.35 -0.55 0.4
+0.55 -0.55 0.4
+
+
+0.55 -0.55 0.2
+0.621232 -0.621232 0.271232
+0.568361 -0.568361 0.418361
+
+
+0.55 -0.55 0.2
+0.55 -0.713865 0.2
+0.621232 -0.621232 0.271232
+
+
+0.55 -0.55 0.2
+0.35 -0.55 0.2
+0.35 -0.75 0.2
+0.35 -0.813631 0.263631
+0.410466 -0.810466 0.2
+0.35 -0.75 0.2
+
+
+0.35 -0.55 0.2
+0.35 -0.55 0.4
+0.35 -0.730701 0.4
+0.35 -0.813631 0.263631
+
+
+0.35 -0.730701 0.4
+0.428551 -0.628551 0.478551
+
+
+0.55 -0.713865 0.2
+0.410466 -0.810466 0.2
+
+
+-0.703507 -0.403507 0.4
+-0.741912 -0.441912 0.291912
+-0.675507 -0.575507 0.225507
+-0.65 -0.55 0.2
+-0.65 -0.35 0.2
+-0.741912 -0.441912 0.291912
+
+
+-0.703507 -0.403507 0.4
+-0.523507 -0.623507 0.4
+-0.556669 -0.656669 0.306669
+-0.45 -0.55 0.2
+-0.65 -0.55 0.2
+
+
+-0.703507 -0.403507 0.4
+-0.65 -0.35 0.4
+-0.45 -0.35 0.4
+-0.45 -0.55 0.4
+-0.523507 -0.623507 0.4
+
+
+-0.556669 -0.656669 0.306669
+-0.675507 -0.575507 0.225507
+
+
+-0.45 -0.55 0.4
+-0.45 -0.55 0.2
+-0.45 -0.35 0.2
+-0.65 -0.35 0.2
+-0.65 -0.35 0.4
+
+
+-0.45 -0.35 0.4
+-0.45 -0.35 0.2
+
+
+-0.25 -0.55 0.2
+-0.25 -0.55 0.4
+-0.25 -0.35 0.4
+-0.25 -0.35 0.2
+-0.25 -0.55 0.2
+-0.45 -0.55 0.2
+-0.45 -0.35 0.2
+-0.45 -0.35 0.4
+-0.25 -0.35 0.4
+
+
+-0.25 -0.35 0.2
+-0.45 -0.35 0.2
+
+
+-0.25 -0.55 0.4
+-0.45 -0.55 0.4
+-0.45 -0.35 0.4
+
+
+-0.45 -0.55 0.4
+-0.45 -0.55 0.2
+
+
+-0.05 -0.55 0.2
+-0.05 -0.35 0.2
+-0.25 -0.35 0.2
+-0.25 -0.55 0.2
+-0.05 -0.55 0.2
+-0.05 -0.55 0.4
+-0.05 -0.35 0.4
+-0.05 -0.35 0.2
+
+
+-0.25 -0.35 0.4
+-0.25 -0.55 0.4
+-0.25 -0.55 0.2
+
+
+-0.25 -0.35 0.4
+-0.05 -0.35 0.4
+
+
+-0.25 -0.35 0.4
+-0.25 -0.35 0.2
+
+
+-0.25 -0.55 0.4
+-0.05 -0.55 0.4
+
+
+-0.05 -0.55 0.4
+0.15 -0.55 0.4
+0.15 -0.35 0.4
+0.15 -0.35 0.2
+0.15 -0.55 0.2
+0.15 -0.55 0.4
+
+
+-0.05 -0.55 0.4
+-0.05 -0.35 0.4
+0.15 -0.35 0.4
+
+
+-0.05 -0.55 0.4
+-0.05 -0.55 0.2
+0.15 -0.55 0.2
+
+
+-0.05 -0.35 0.2
+0.15 -0.35 0.2
+
+
+-0.05 -0.35 0.2
+-0.05 -0.55 0.2
+
+
+-0.05 -0.35 0.2
+-0.05 -0.35 0.4
+
+
+0.15 -0.55 0.4
+0.15 -0.35 0.4
+0.35 -0.35 0.4
+0.35 -0.55 0.4
+0.15 -0.55 0.4
+0.15 -0.55 0.2
+0.15 -0.35 0.2
+0.35 -0.35 0.2
+0.35 -0.35 0.4
+
+
+0.35 -0.35 0.2
+0.35 -0.55 0.2
+0.35 -0.55 0.4
+
+
+0.35 -0.55 0.2
+0.15 -0.55 0.2
+
+
+0.15 -0.35 0.4
+0.15 -0.35 0.2
+
+
+0.55 -0.35 0.2
+0.55 -0.35 0.4
+0.35 -0.35 0.4
+0.35 -0.35 0.2
+0.55 -0.35 0.2
+0.55 -0.55 0.2
+0.55 -0.55 0.4
+0.35 -0.55 0.4
+0.35 -0.35 0.4
+
+
+0.55 -0.35 0.4
+0.55 -0.55 0.4
+
+
+0.55 -0.55 0.2
+0.35 -0.55 0.2
+0.35 -0.35 0.2
+
+
+0.35 -0.55 0.4
+0.35 -0.55 0.2
+
+
+0.713865 -0.55 0.2
+0.55 -0.55 0.2
+0.621232 -0.621232 0.271232
+0.713865 -0.55 0.2
+0.810466 -0.410466 0.2
+0.813631 -0.35 0.263631
+0.75 -0.35 0.2
+0.810466 -0.410466 0.2
+
+
+0.55 -0.35 0.2
+0.55 -0.55 0.2
+0.55 -0.55 0.4
+0.55 -0.35 0.4
+0.628551 -0.428551 0.478551
+0.568361 -0.568361 0.418361
+0.55 -0.55 0.4
+
+
+0.55 -0.35 0.2
+0.55 -0.35 0.4
+0.730701 -0.35 0.4
+0.628551 -0.428551 0.478551
+
+
+0.55 -0.35 0.2
+0.75 -0.35 0.2
+
+
+0.621232 -0.621232 0.271232
+0.568361 -0.568361 0.418361
+
+
+0.813631 -0.35 0.263631
+0.730701 -0.35 0.4
+
+
+-0.747838 -0.447838 0.297838
+-0.65 -0.35 0.2
+-0.832017 -0.35 0.2
+-0.747838 -0.447838 0.297838
+-0.707456 -0.407456 0.4
+-0.700167 -0.35 0.450167
+-0.65 -0.35 0.4
+-0.707456 -0.407456 0.4
+
+
+-0.65 -0.35 0.2
+-0.65 -0.15 0.2
+-0.65 -0.15 0.4
+-0.743824 -0.15 0.493824
+-0.898683 -0.15 0.2
+-0.65 -0.15 0.2
+
+
+-0.65 -0.35 0.2
+-0.65 -0.35 0.4
+-0.65 -0.15 0.4
+
+
+-0.743824 -0.15 0.493824
+-0.700167 -0.35 0.450167
+
+
+-0.832017 -0.35 0.2
+-0.898683 -0.15 0.2
+
+
+-0.45 -0.35 0.2
+-0.65 -0.35 0.2
+-0.65 -0.35 0.4
+-0.65 -0.15 0.4
+-0.45 -0.15 0.4
+-0.45 -0.35 0.4
+-0.65 -0.35 0.4
+
+
+-0.45 -0.35 0.2
+-0.45 -0.15 0.2
+-0.45 -0.15 0.4
+
+
+-0.45 -0.35 0.2
+-0.45 -0.35 0.4
+
+
+-0.65 -0.35 0.2
+-0.65 -0.15 0.2
+-0.65 -0.15 0.4
+
+
+-0.45 -0.15 0.2
+-0.65 -0.15 0.2
+
+
+-0.25 -0.35 0.2
+-0.25 -0.15 0.2
+-0.45 -0.15 0.2
+-0.45 -0.15 0.4
+-0.25 -0.15 0.4
+-0.25 -0.15 0.2
+
+
+-0.25 -0.35 0.2
+-0.25 -0.35 0.4
+-0.25 -0.15 0.4
+
+
+-0.25 -0.35 0.2
+-0.45 -0.35 0.2
+-0.45 -0.15 0.2
+
+
+-0.25 -0.35 0.4
+-0.45 -0.35 0.4
+-0.45 -0.15 0.4
+
+
+-0.45 -0.35 0.4
+-0.45 -0.35 0.2
+
+
+-0.05 -0.35 0.4
+-0.05 -0.15 0.4
+-0.05 -0.15 0.2
+-0.25 -0.15 0.2
+-0.25 -0.15 0.4
+-0.05 -0.15 0.4
+
+
+-0.05 -0.35 0.4
+-0.25 -0.35 0.4
+-0.25 -0.15 0.4
+
+
+-0.05 -0.35 0.4
+-0.05 -0.35 0.2
+-0.05 -0.15 0.2
+
+
+-0.25 -0.35 0.4
+-0.25 -0.35 0.2
+-0.25 -0.15 0.2
+
+
+-0.05 -0.35 0.2
+-0.25 -0.35 0.2
+
+
+0.15 -0.15 0.2
+0.15 -0.35 0.2
+0.15 -0.35 0.4
+-0.05 -0.35 0.4
+-0.05 -0.15 0.4
+0.15 -0.15 0.4
+0.15 -0.35 0.4
+
+
+0.15 -0.15 0.2
+-0.05 -0.15 0.2
+-0.05 -0.35 0.2
+0.15 -0.35 0.2
+
+
+0.15 -0.15 0.2
+0.15 -0.15 0.4
+
+
+-0.05 -0.15 0.4
+-0.05 -0.15 0.2
+
+
+-0.05 -0.35 0.2
+-0.05 -0.35 0.4
+
+
+0.35 -0.15 0.4
+0.35 -0.15 0.2
+0.15 -0.15 0.2
+0.15 -0.35 0.2
+0.35 -0.35 0.2
+0.35 -0.15 0.2
+
+
+0.35 -0.15 0.4
+0.15 -0.15 0.4
+0.15 -0.15 0.2
+
+
+0.35 -0.15 0.4
+0.35 -0.35 0.4
+0.35 -0.35 0.2
+
+
+0.15 -0.15 0.4
+0.15 -0.35 0.4
+0.35 -0.35 0.4
+
+
+0.15 -0.35 0.4
+0.15 -0.35 0.2
+
+
+0.55 -0.35 0.4
+0.55 -0.35 0.2
+0.55 -0.15 0.2
+0.55 -0.15 0.4
+0.55 -0.35 0.4
+0.35 -0.35 0.4
+0.35 -0.15 0.4
+0.55 -0.15 0.4
+
+
+0.35 -0.15 0.4
+0.35 -0.15 0.2
+0.55 -0.15 0.2
+
+
+0.35 -0.35 0.4
+0.35 -0.35 0.2
+0.55 -0.35 0.2
+
+
+0.35 -0.15 0.2
+0.35 -0.35 0.2
+
+
+0.55 -0.15 0.4
+0.55 -0.35 0.4
+0.55 -0.35 0.2
+0.75 -0.35 0.2
+0.75 -0.15 0.2
+0.55 -0.15 0.2
+0.55 -0.35 0.2
+
+
+0.55 -0.15 0.4
+0.799439 -0.15 0.4
+0.722516 -0.35 0.4
+0.55 -0.35 0.4
+
+
+0.55 -0.15 0.4
+0.55 -0.15 0.2
+
+
+0.75 -0.15 0.2
+0.85196 -0.15 0.30196
+0.799439 -0.15 0.4
+
+
+0.75 -0.35 0.2
+0.80187 -0.35 0.25187
+0.85196 -0.15 0.30196
+
+
+0.722516 -0.35 0.4
+0.80187 -0.35 0.25187
+
+
+-0.65 0.05 0.2
+-0.905331 0.05 0.2
+-0.891998 -0.15 0.2
+-0.65 -0.15 0.2
+-0.65 0.05 0.2
+-0.65 0.05 0.4
+-0.65 -0.15 0.4
+-0.744447 -0.15 0.494447
+-0.75333 0.05 0.50333
+-0.65 0.05 0.4
+
+
+-0.905331 0.05 0.2
+-0.75333 0.05 0.50333
+
+
+-0.65 -0.15 0.2
+-0.65 -0.15 0.4
+
+
+-0.744447 -0.15 0.494447
+-0.891998 -0.15 0.2
+
+
+-0.45 -0.15 0.2
+-0.45 0.05 0.2
+-0.45 0.05 0.4
+-0.45 -0.15 0.4
+-0.45 -0.15 0.2
+-0.65 -0.15 0.2
+-0.65 -0.15 0.4
+-0.45 -0.15 0.4
+
+
+-0.65 -0.15 0.2
+-0.65 0.05 0.2
+-0.65 0.05 0.4
+-0.45 0.05 0.4
+
+
+-0.45 0.05 0.2
+-0.65 0.05 0.2
+
+
+-0.65 -0.15 0.4
+-0.65 0.05 0.4
+
+
+-0.25 -0.15 0.2
+-0.25 0.05 0.2
+-0.45 0.05 0.2
+-0.45 0.05 0.4
+-0.25 0.05 0.4
+-0.25 0.05 0.2
+
+
+-0.25 -0.15 0.2
+-0.25 -0.15 0.4
+-0.25 0.05 0.4
+
+
+-0.25 -0.15 0.2
+-0.45 -0.15 0.2
+-0.45 0.05 0.2
+
+
+-0.45 -0.15 0.4
+-0.45 0.05 0.4
+
+
+-0.45 -0.15 0.4
+-0.45 -0.15 0.2
+
+
+-0.45 -0.15 0.4
+-0.25 -0.15 0.4
+
+
+-0.05 -0.15 0.2
+-0.05 0.05 0.2
+-0.25 0.05 0.2
+-0.25 0.05 0.4
+-0.05 0.05 0.4
+-0.05 0.05 0.2
+
+
+-0.05 -0.15 0.2
+-0.05 -0.15 0.4
+-0.05 0.05 0.4
+
+
+-0.05 -0.15 0.2
+-0.25 -0.15 0.2
+-0.25 0.05 0.2
+
+
+-0.25 0.05 0.4
+-0.25 -0.15 0.4
+-0.25 -0.15 0.2
+
+
+-0.05 -0.15 0.4
+-0.25 -0.15 0.4
+
+
+0.15 -0.15 0.2
+-0.05 -0.15 0.2
+-0.05 -0.15 0.4
+-0.05 0.05 0.4
+-0.05 0.05 0.2
+-0.05 -0.15 0.2
+
+
+0.15 -0.15 0.2
+0.15 0.05 0.2
+-0.05 0.05 0.2
+
+
+0.15 -0.15 0.2
+0.15 -0.15 0.4
+-0.05 -0.15 0.4
+
+
+-0.05 0.05 0.4
+0.15 0.05 0.4
+0.15 -0.15 0.4
+
+
+0.15 0.05 0.4
+0.15 0.05 0.2
+
+
+0.15 0.05 0.4
+0.15 -0.15 0.4
+0.15 -0.15 0.2
+0.15 0.05 0.2
+0.15 0.05 0.4
+0.35 0.05 0.4
+0.35 -0.15 0.4
+0.15 -0.15 0.4
+
+
+0.35 0.05 0.4
+0.35 0.05 0.2
+0.35 -0.15 0.2
+0.15 -0.15 0.2
+
+
+0.35 -0.15 0.2
+0.35 -0.15 0.4
+
+
+0.15 0.05 0.2
+0.35 0.05 0.2
+
+
+0.55 -0.15 0.4
+0.55 -0.15 0.2
+0.55 0.05 0.2
+0.35 0.05 0.2
+0.35 0.05 0.4
+0.55 0.05 0.4
+0.55 -0.15 0.4
+0.35 -0.15 0.4
+0.35 0.05 0.4
+
+
+0.35 0.05 0.2
+0.35 -0.15 0.2
+0.55 -0.15 0.2
+
+
+0.35 -0.15 0.4
+0.35 -0.15 0.2
+
+
+0.55 0.05 0.2
+0.55 0.05 0.4
+
+
+0.75 0.05 0.2
+0.75 -0.15 0.2
+0.55 -0.15 0.2
+0.55 0.05 0.2
+0.55 0.05 0.4
+0.80621 0.05 0.4
+0.790825 -0.15 0.4
+0.55 -0.15 0.4
+0.55 0.05 0.4
+
+
+0.75 0.05 0.2
+0.55 0.05 0.2
+
+
+0.75 0.05 0.2
+0.854234 0.05 0.304234
+0.80621 0.05 0.4
+
+
+0.854234 0.05 0.304234
+0.843988 -0.15 0.293988
+0.75 -0.15 0.2
+
+
+0.55 -0.15 0.2
+0.55 -0.15 0.4
+
+
+0.843988 -0.15 0.293988
+0.790825 -0.15 0.4
+
+
+-0.65 0.05 0.4
+-0.753214 0.05 0.503214
+-0.726722 0.25 0.476722
+-0.867824 0.25 0.2
+-0.907824 0.05 0.2
+-0.753214 0.05 0.503214
+
+
+-0.65 0.05 0.4
+-0.65 0.05 0.2
+-0.907824 0.05 0.2
+
+
+-0.65 0.05 0.4
+-0.65 0.25 0.4
+-0.726722 0.25 0.476722
+
+
+-0.867824 0.25 0.2
+-0.65 0.25 0.2
+-0.65 0.25 0.4
+
+
+-0.65 0.05 0.2
+-0.65 0.25 0.2
+
+
+-0.45 0.25 0.4
+-0.45 0.05 0.4
+-0.65 0.05 0.4
+-0.65 0.25 0.4
+-0.45 0.25 0.4
+-0.45 0.25 0.2
+-0.45 0.05 0.2
+-0.45 0.05 0.4
+
+
+-0.45 0.25 0.2
+-0.65 0.25 0.2
+-0.65 0.05 0.2
+-0.45 0.05 0.2
+
+
+-0.65 0.25 0.2
+-0.65 0.25 0.4
+
+
+-0.65 0.05 0.4
+-0.65 0.05 0.2
+
+
+-0.25 0.25 0.4
+-0.25 0.25 0.2
+-0.45 0.25 0.2
+-0.45 0.05 0.2
+-0.45 0.05 0.4
+-0.45 0.25 0.4
+-0.45 0.25 0.2
+
+
+-0.25 0.25 0.4
+-0.45 0.25 0.4
+
+
+-0.25 0.25 0.4
+-0.25 0.05 0.4
+-0.45 0.05 0.4
+
+
+-0.25 0.25 0.2
+-0.25 0.05 0.2
+-0.25 0.05 0.4
+
+
+-0.25 0.05 0.2
+-0.45 0.05 0.2
+
+
+-0.05 0.05 0.2
+-0.05 0.25 0.2
+-0.05 0.25 0.4
+-0.05 0.05 0.4
+-0.25 0.05 0.4
+-0.25 0.25 0.4
+-0.05 0.25 0.4
+
+
+-0.05 0.05 0.2
+-0.05 0.05 0.4
+
+
+-0.05 0.05 0.2
+-0.25 0.05 0.2
+-0.25 0.25 0.2
+-0.05 0.25 0.2
+
+
+-0.25 0.05 0.4
+-0.25 0.05 0.2
+
+
+-0.25 0.25 0.2
+-0.25 0.25 0.4
+
+
+0.15 0.05 0.2
+-0.05 0.05 0.2
+-0.05 0.05 0.4
+0.15 0.05 0.4
+0.15 0.05 0.2
+0.15 0.25 0.2
+-0.05 0.25 0.2
+-0.05 0.05 0.2
+
+
+-0.05 0.25 0.2
+-0.05 0.25 0.4
+-0.05 0.05 0.4
+
+
+-0.05 0.25 0.4
+0.15 0.25 0.4
+0.15 0.05 0.4
+
+
+0.15 0.25 0.4
+0.15 0.25 0.2
+
+
+0.35 0.05 0.2
+0.35 0.25 0.2
+0.35 0.25 0.4
+0.35 0.05 0.4
+0.15 0.05 0.4
+0.15 0.25 0.4
+0.35 0.25 0.4
+
+
+0.35 0.05 0.2
+0.35 0.05 0.4
+
+
+0.35 0.05 0.2
+0.15 0.05 0.2
+0.15 0.05 0.4
+
+
+0.35 0.25 0.2
+0.15 0.25 0.2
+0.15 0.05 0.2
+
+
+0.15 0.25 0.2
+0.15 0.25 0.4
+
+
+0.55 0.05 0.2
+0.55 0.25 0.2
+0.55 0.25 0.4
+0.55 0.05 0.4
+0.35 0.05 0.4
+0.35 0.25 0.4
+0.55 0.25 0.4
+
+
+0.55 0.05 0.2
+0.55 0.05 0.4
+
+
+0.55 0.05 0.2
+0.35 0.05 0.2
+0.35 0.05 0.4
+
+
+0.55 0.25 0.2
+0.35 0.25 0.2
+0.35 0.05 0.2
+
+
+0.35 0.25 0.4
+0.35 0.25 0.2
+
+
+0.55 0.05 0.2
+0.55 0.05 0.4
+0.55 0.25 0.4
+0.55 0.25 0.2
+0.55 0.05 0.2
+0.75 0.05 0.2
+0.857138 0.05 0.307138
+0.826636 0.25 0.276636
+0.763333 0.25 0.4
+0.55 0.25 0.4
+
+
+0.55 0.25 0.2
+0.75 0.25 0.2
+0.826636 0.25 0.276636
+
+
+0.55 0.05 0.4
+0.809487 0.05 0.4
+0.857138 0.05 0.307138
+
+
+0.75 0.05 0.2
+0.75 0.25 0.2
+
+
+0.809487 0.05 0.4
+0.763333 0.25 0.4
+
+
+-0.724855 0.25 0.474855
+-0.661308 0.461308 0.411308
+-0.65 0.45 0.4
+-0.65 0.25 0.4
+-0.724855 0.25 0.474855
+-0.87651 0.25 0.2
+-0.65 0.25 0.2
+-0.65 0.45 0.2
+-0.71598 0.51598 0.26598
+-0.783177 0.45 0.2
+-0.65 0.45 0.2
+-0.65 0.45 0.4
+
+
+-0.65 0.25 0.4
+-0.65 0.25 0.2
+
+
+-0.661308 0.461308 0.411308
+-0.71598 0.51598 0.26598
+
+
+-0.87651 0.25 0.2
+-0.783177 0.45 0.2
+
+
+-0.65 0.45 0.4
+-0.45 0.45 0.4
+-0.45 0.25 0.4
+-0.45 0.25 0.2
+-0.45 0.45 0.2
+-0.45 0.45 0.4
+
+
+-0.65 0.45 0.4
+-0.65 0.45 0.2
+-0.45 0.45 0.2
+
+
+-0.65 0.45 0.4
+-0.65 0.25 0.4
+-0.45 0.25 0.4
+
+
+-0.65 0.45 0.2
+-0.65 0.25 0.2
+-0.45 0.25 0.2
+
+
+-0.65 0.25 0.4
+-0.65 0.25 0.2
+
+
+-0.25 0.25 0.2
+-0.25 0.45 0.2
+-0.45 0.45 0.2
+-0.45 0.25 0.2
+-0.25 0.25 0.2
+-0.25 0.25 0.4
+-0.25 0.45 0.4
+-0.25 0.45 0.2
+
+
+-0.25 0.45 0.4
+-0.45 0.45 0.4
+-0.45 0.45 0.2
+
+
+-0.45 0.45 0.4
+-0.45 0.25 0.4
+-0.25 0.25 0.4
+
+
+-0.45 0.25 0.4
+-0.45 0.25 0.2
+
+
+-0.05 0.25 0.2
+-0.05 0.45 0.2
+-0.05 0.45 0.4
+-0.25 0.45 0.4
+-0.25 0.45 0.2
+-0.05 0.45 0.2
+
+
+-0.05 0.25 0.2
+-0.05 0.25 0.4
+-0.05 0.45 0.4
+
+
+-0.05 0.25 0.2
+-0.25 0.25 0.2
+-0.25 0.25 0.4
+-0.05 0.25 0.4
+
+
+-0.25 0.45 0.2
+-0.25 0.25 0.2
+
+
+-0.25 0.25 0.4
+-0.25 0.45 0.4
+
+
+0.15 0.25 0.2
+0.15 0.45 0.2
+0.15 0.45 0.4
+0.15 0.25 0.4
+0.15 0.25 0.2
+-0.05 0.25 0.2
+-0.05 0.25 0.4
+0.15 0.25 0.4
+
+
+-0.05 0.45 0.2
+0.15 0.45 0.2
+
+
+-0.05 0.45 0.2
+-0.05 0.25 0.2
+
+
+-0.05 0.45 0.2
+-0.05 0.45 0.4
+0.15 0.45 0.4
+
+
+-0.05 0.25 0.4
+-0.05 0.45 0.4
+
+
+0.35 0.25 0.2
+0.35 0.45 0.2
+0.15 0.45 0.2
+0.15 0.25 0.2
+0.35 0.25 0.2
+0.35 0.25 0.4
+0.35 0.45 0.4
+0.15 0.45 0.4
+0.15 0.45 0.2
+
+
+0.15 0.25 0.4
+0.35 0.25 0.4
+
+
+0.15 0.25 0.4
+0.15 0.45 0.4
+
+
+0.15 0.25 0.4
+0.15 0.25 0.2
+
+
+0.35 0.45 0.4
+0.35 0.45 0.2
+
+
+0.55 0.25 0.2
+0.55 0.45 0.2
+0.35 0.45 0.2
+0.35 0.25 0.2
+0.55 0.25 0.2
+0.55 0.25 0.4
+0.35 0.25 0.4
+0.35 0.45 0.4
+0.35 0.45 0.2
+
+
+0.35 0.25 0.4
+0.35 0.25 0.2
+
+
+0.35 0.45 0.4
+0.55 0.45 0.4
+0.55 0.25 0.4
+
+
+0.55 0.45 0.4
+0.55 0.45 0.2
+
+
+0.55 0.25 0.2
+0.55 0.25 0.4
+0.773989 0.25 0.4
+0.837739 0.25 0.287739
+0.75 0.25 0.2
+0.55 0.25 0.2
+0.55 0.45 0.2
+0.75 0.45 0.2
+0.764182 0.464182 0.214182
+0.659134 0.559134 0.309134
+0.55 0.45 0.2
+0.55 0.45 0.4
+0.625593 0.525593 0.4
+0.773989 0.25 0.4
+
+
+0.75 0.45 0.2
+0.75 0.25 0.2
+
+
+0.659134 0.559134 0.309134
+0.625593 0.525593 0.4
+
+
+0.764182 0.464182 0.214182
+0.837739 0.25 0.287739
+
+
+0.55 0.45 0.4
+0.55 0.25 0.4
+
+
+-0.45 0.45 0.2
+-0.45 0.65 0.2
+-0.513829 0.713829 0.263829
+-0.622792 0.65 0.2
+-0.45 0.65 0.2
+-0.45 0.65 0.4
+-0.45 0.45 0.4
+-0.65 0.45 0.4
+-0.661588 0.461588 0.411588
+-0.535468 0.535468 0.485468
+-0.45 0.45 0.4
+-0.45 0.45 0.2
+-0.65 0.45 0.2
+-0.65 0.622792 0.2
+-0.713829 0.513829 0.263829
+-0.65 0.45 0.2
+-0.65 0.45 0.4
+
+
+-0.661588 0.461588 0.411588
+-0.713829 0.513829 0.263829
+
+
+-0.513829 0.713829 0.263829
+-0.461588 0.661588 0.411588
+-0.45 0.65 0.4
+
+
+-0.535468 0.535468 0.485468
+-0.461588 0.661588 0.411588
+
+
+-0.622792 0.65 0.2
+-0.65 0.622792 0.2
+
+
+-0.45 0.65 0.2
+-0.45 0.45 0.2
+-0.25 0.45 0.2
+-0.25 0.45 0.4
+-0.45 0.45 0.4
+-0.45 0.45 0.2
+
+
+-0.45 0.65 0.2
+-0.45 0.65 0.4
+-0.25 0.65 0.4
+-0.25 0.45 0.4
+
+
+-0.45 0.65 0.2
+-0.25 0.65 0.2
+-0.25 0.45 0.2
+
+
+-0.45 0.65 0.4
+-0.45 0.45 0.4
+
+
+-0.25 0.65 0.2
+-0.25 0.65 0.4
+
+
+-0.05 0.65 0.2
+-0.25 0.65 0.2
+-0.25 0.65 0.4
+-0.05 0.65 0.4
+-0.05 0.65 0.2
+-0.05 0.45 0.2
+-0.05 0.45 0.4
+-0.05 0.65 0.4
+
+
+-0.25 0.65 0.2
+-0.25 0.45 0.2
+-0.05 0.45 0.2
+
+
+-0.05 0.45 0.4
+-0.25 0.45 0.4
+-0.25 0.65 0.4
+
+
+-0.25 0.45 0.4
+-0.25 0.45 0.2
+
+
+0.15 0.65 0.2
+0.15 0.65 0.4
+-0.05 0.65 0.4
+-0.05 0.65 0.2
+0.15 0.65 0.2
+0.15 0.45 0.2
+0.15 0.45 0.4
+0.15 0.65 0.4
+
+
+0.15 0.45 0.4
+-0.05 0.45 0.4
+-0.05 0.65 0.4
+
+
+-0.05 0.45 0.4
+-0.05 0.45 0.2
+-0.05 0.65 0.2
+
+
+0.15 0.45 0.2
+-0.05 0.45 0.2
+
+
+0.35 0.45 0.2
+0.35 0.45 0.4
+0.15 0.45 0.4
+0.15 0.45 0.2
+0.35 0.45 0.2
+0.35 0.65 0.2
+0.15 0.65 0.2
+0.15 0.45 0.2
+
+
+0.35 0.65 0.4
+0.35 0.45 0.4
+
+
+0.35 0.65 0.4
+0.35 0.65 0.2
+
+
+0.35 0.65 0.4
+0.15 0.65 0.4
+0.15 0.45 0.4
+
+
+0.15 0.65 0.4
+0.15 0.65 0.2
+
+
+0.35 0.45 0.2
+0.55 0.45 0.2
+0.656669 0.556669 0.306669
+0.575507 0.675507 0.225507
+0.441912 0.741912 0.291912
+0.35 0.65 0.2
+0.55 0.65 0.2
+0.575507 0.675507 0.225507
+
+
+0.35 0.45 0.2
+0.35 0.45 0.4
+0.55 0.45 0.4
+0.623507 0.523507 0.4
+0.656669 0.556669 0.306669
+
+
+0.35 0.45 0.2
+0.35 0.65 0.2
+0.35 0.65 0.4
+0.35 0.45 0.4
+
+
+0.55 0.45 0.4
+0.55 0.45 0.2
+0.55 0.65 0.2
+
+
+0.623507 0.523507 0.4
+0.403507 0.703507 0.4
+0.35 0.65 0.4
+
+
+0.403507 0.703507 0.4
+0.441912 0.741912 0.291912
+
+
+-0.45 0.783177 0.2
+-0.51598 0.71598 0.26598
+-0.45 0.65 0.2
+-0.45 0.783177 0.2
+-0.25 0.87651 0.2
+-0.25 0.65 0.2
+-0.25 0.65 0.4
+-0.25 0.724855 0.474855
+-0.25 0.87651 0.2
+
+
+-0.461308 0.661308 0.411308
+-0.25 0.724855 0.474855
+
+
+-0.461308 0.661308 0.411308
+-0.51598 0.71598 0.26598
+
+
+-0.461308 0.661308 0.411308
+-0.45 0.65 0.4
+-0.45 0.65 0.2
+-0.25 0.65 0.2
+
+
+-0.25 0.65 0.4
+-0.45 0.65 0.4
+
+
+-0.05 0.65 0.2
+-0.05 0.907824 0.2
+-0.25 0.867824 0.2
+-0.25 0.726722 0.476722
+-0.05 0.753214 0.503214
+-0.05 0.907824 0.2
+
+
+-0.05 0.65 0.2
+-0.05 0.65 0.4
+-0.05 0.753214 0.503214
+
+
+-0.05 0.65 0.2
+-0.25 0.65 0.2
+-0.25 0.867824 0.2
+
+
+-0.25 0.65 0.4
+-0.25 0.726722 0.476722
+
+
+-0.25 0.65 0.4
+-0.25 0.65 0.2
+
+
+-0.25 0.65 0.4
+-0.05 0.65 0.4
+
+
+0.15 0.65 0.2
+0.15 0.891998 0.2
+-0.05 0.905331 0.2
+-0.05 0.75333 0.50333
+-0.05 0.65 0.4
+-0.05 0.65 0.2
+0.15 0.65 0.2
+0.15 0.65 0.4
+-0.05 0.65 0.4
+
+
+-0.05 0.905331 0.2
+-0.05 0.65 0.2
+
+
+0.15 0.891998 0.2
+0.15 0.744447 0.494447
+0.15 0.65 0.4
+
+
+0.15 0.744447 0.494447
+-0.05 0.75333 0.50333
+
+
+0.15 0.65 0.2
+0.15 0.65 0.4
+0.15 0.743824 0.493824
+0.35 0.700167 0.450167
+0.407456 0.707456 0.4
+0.35 0.65 0.4
+0.35 0.700167 0.450167
+
+
+0.15 0.65 0.2
+0.15 0.898683 0.2
+0.15 0.743824 0.493824
+
+
+0.15 0.65 0.2
+0.35 0.65 0.2
+0.447838 0.747838 0.297838
+0.35 0.832017 0.2
+0.35 0.65 0.2
+0.35 0.65 0.4
+0.15 0.65 0.4
+
+
+0.15 0.898683 0.2
+0.35 0.832017 0.2
+
+
+0.407456 0.707456 0.4
+0.447838 0.747838 0.297838
+
+
+-0.25 -0.773989 0.4
+-0.25 -0.620422 0.670422
+-0.451292 -0.551292 0.601292
+-0.525593 -0.625593 0.4
+-0.25 -0.773989 0.4
+-0.25 -0.55 0.4
+-0.45 -0.55 0.4
+-0.525593 -0.625593 0.4
+
+
+-0.25 -0.55 0.4
+-0.25 -0.55 0.6
+-0.25 -0.620422 0.670422
+
+
+-0.451292 -0.551292 0.601292
+-0.45 -0.55 0.6
+-0.25 -0.55 0.6
+
+
+-0.45 -0.55 0.6
+-0.45 -0.55 0.4
+
+
+-0.25 -0.55 0.4
+-0.25 -0.55 0.6
+-0.05 -0.55 0.6
+-0.05 -0.55 0.4
+-0.05 -0.809487 0.4
+-0.05 -0.653664 0.703664
+-0.05 -0.55 0.6
+
+
+-0.25 -0.55 0.4
+-0.05 -0.55 0.4
+
+
+-0.25 -0.55 0.4
+-0.25 -0.763333 0.4
+-0.05 -0.809487 0.4
+
+
+-0.25 -0.763333 0.4
+-0.25 -0.623162 0.673162
+-0.25 -0.55 0.6
+
+
+-0.25 -0.623162 0.673162
+-0.05 -0.653664 0.703664
+
+
+0.15 -0.790825 0.4
+0.15 -0.55 0.4
+0.15 -0.55 0.6
+0.15 -0.643594 0.693594
+-0.05 -0.65384 0.70384
+-0.05 -0.80621 0.4
+-0.05 -0.55 0.4
+0.15 -0.55 0.4
+
+
+0.15 -0.790825 0.4
+0.15 -0.643594 0.693594
+
+
+0.15 -0.790825 0.4
+-0.05 -0.80621 0.4
+
+
+0.15 -0.55 0.6
+-0.05 -0.55 0.6
+-0.05 -0.65384 0.70384
+
+
+-0.05 -0.55 0.4
+-0.05 -0.55 0.6
+
+
+0.35 -0.59257 0.64257
+0.35 -0.55 0.6
+0.397215 -0.597215 0.6
+0.35 -0.59257 0.64257
+0.15 -0.642659 0.692659
+0.15 -0.799439 0.4
+0.35 -0.722516 0.4
+0.439837 -0.639837 0.489837
+0.397215 -0.597215 0.6
+
+
+0.439837 -0.639837 0.489837
+0.35 -0.55 0.4
+0.35 -0.55 0.6
+0.15 -0.55 0.6
+0.15 -0.642659 0.692659
+
+
+0.35 -0.722516 0.4
+0.35 -0.55 0.4
+0.15 -0.55 0.4
+0.15 -0.799439 0.4
+
+
+0.15 -0.55 0.6
+0.15 -0.55 0.4
+
+
+-0.45 -0.55 0.6
+-0.451803 -0.551803 0.601803
+-0.518208 -0.418208 0.668208
+-0.618079 -0.35 0.6
+-0.45 -0.35 0.6
+-0.518208 -0.418208 0.668208
+
+
+-0.45 -0.55 0.6
+-0.45 -0.55 0.4
+-0.45 -0.35 0.4
+-0.65 -0.35 0.4
+-0.709103 -0.35 0.459103
+-0.703507 -0.403507 0.4
+-0.65 -0.35 0.4
+
+
+-0.45 -0.55 0.6
+-0.45 -0.35 0.6
+-0.45 -0.35 0.4
+
+
+-0.618079 -0.35 0.6
+-0.709103 -0.35 0.459103
+
+
+-0.45 -0.55 0.4
+-0.523507 -0.623507 0.4
+-0.451803 -0.551803 0.601803
+
+
+-0.523507 -0.623507 0.4
+-0.703507 -0.403507 0.4
+
+
+-0.25 -0.55 0.4
+-0.25 -0.35 0.4
+-0.45 -0.35 0.4
+-0.45 -0.55 0.4
+-0.25 -0.55 0.4
+-0.25 -0.55 0.6
+-0.25 -0.35 0.6
+-0.25 -0.35 0.4
+
+
+-0.25 -0.35 0.6
+-0.45 -0.35 0.6
+-0.45 -0.35 0.4
+
+
+-0.45 -0.55 0.579166
+-0.45 -0.55 0.4
+
+
+-0.45 -0.55 0.579166
+-0.433033 -0.55 0.6
+-0.45 -0.536803 0.6
+-0.45 -0.55 0.579166
+
+
+-0.25 -0.55 0.6
+-0.433033 -0.55 0.6
+
+
+-0.45 -0.536803 0.6
+-0.45 -0.35 0.6
+
+
+-0.05 -0.55 0.4
+-0.05 -0.55 0.6
+-0.05 -0.35 0.6
+-0.05 -0.35 0.4
+-0.05 -0.55 0.4
+-0.25 -0.55 0.4
+-0.25 -0.55 0.6
+-0.25 -0.35 0.6
+-0.25 -0.35 0.4
+-0.05 -0.35 0.4
+
+
+-0.25 -0.35 0.6
+-0.05 -0.35 0.6
+
+
+-0.25 -0.35 0.4
+-0.25 -0.55 0.4
+
+
+-0.25 -0.55 0.6
+-0.05 -0.55 0.6
+
+
+-0.05 -0.55 0.6
+-0.05 -0.35 0.6
+0.15 -0.35 0.6
+0.15 -0.55 0.6
+-0.05 -0.55 0.6
+-0.05 -0.55 0.4
+0.15 -0.55 0.4
+0.15 -0.35 0.4
+0.15 -0.35 0.6
+
+
+-0.05 -0.35 0.4
+-0.05 -0.55 0.4
+
+
+-0.05 -0.35 0.4
+-0.05 -0.35 0.6
+
+
+-0.05 -0.35 0.4
+0.15 -0.35 0.4
+
+
+0.15 -0.55 0.4
+0.15 -0.55 0.6
+
+
+0.35 -0.35 0.6
+0.15 -0.35 0.6
+0.15 -0.35 0.4
+0.35 -0.35 0.4
+0.35 -0.35 0.6
+0.35 -0.55 0.6
+0.15 -0.55 0.6
+0.15 -0.35 0.6
+
+
+0.35 -0.55 0.4
+0.35 -0.35 0.4
+
+
+0.35 -0.55 0.4
+0.35 -0.55 0.6
+
+
+0.35 -0.55 0.4
+0.15 -0.55 0.4
+0.15 -0.35 0.4
+
+
+0.15 -0.55 0.6
+0.15 -0.55 0.4
+
+
+0.35 -0.35 0.6
+0.35 -0.35 0.4
+0.55 -0.35 0.4
+0.55 -0.35 0.6
+0.35 -0.35 0.6
+0.35 -0.55 0.6
+0.35 -0.55 0.4
+0.55 -0.55 0.4
+0.561588 -0.561588 0.411588
+0.635468 -0.435468 0.485468
+0.594975 -0.394975 0.6
+0.55 -0.35 0.6
+
+
+0.35 -0.55 0.4
+0.435468 -0.635468 0.485468
+0.561588 -0.561588 0.411588
+
+
+0.35 -0.55 0.4
+0.35 -0.35 0.4
+
+
+0.394975 -0.594975 0.6
+0.435468 -0.635468 0.485468
+
+
+0.394975 -0.594975 0.6
+0.594975 -0.394975 0.6
+
+
+0.394975 -0.594975 0.6
+0.35 -0.55 0.6
+
+
+0.55 -0.55 0.4
+0.55 -0.35 0.4
+0.635468 -0.435468 0.485468
+
+
+-0.45 -0.15 0.4
+-0.45 -0.15 0.6
+-0.45 -0.35 0.6
+-0.45 -0.35 0.4
+-0.45 -0.15 0.4
+-0.65 -0.15 0.4
+-0.65 -0.35 0.4
+-0.45 -0.35 0.4
+
+
+-0.45 -0.15 0.6
+-0.700739 -0.15 0.6
+-0.753655 -0.15 0.503655
+-0.65 -0.15 0.4
+
+
+-0.700739 -0.15 0.6
+-0.60983 -0.35 0.6
+-0.45 -0.35 0.6
+
+
+-0.60983 -0.35 0.6
+-0.694975 -0.35 0.444975
+-0.65 -0.35 0.4
+
+
+-0.694975 -0.35 0.444975
+-0.753655 -0.15 0.503655
+
+
+-0.25 -0.35 0.4
+-0.25 -0.15 0.4
+-0.45 -0.15 0.4
+-0.45 -0.15 0.6
+-0.45 -0.35 0.6
+-0.25 -0.35 0.6
+-0.25 -0.15 0.6
+-0.25 -0.15 0.4
+
+
+-0.25 -0.35 0.4
+-0.25 -0.35 0.6
+
+
+-0.25 -0.35 0.4
+-0.45 -0.35 0.4
+-0.45 -0.15 0.4
+
+
+-0.25 -0.15 0.6
+-0.45 -0.15 0.6
+
+
+-0.45 -0.35 0.6
+-0.45 -0.35 0.4
+
+
+-0.05 -0.35 0.6
+-0.05 -0.35 0.4
+-0.25 -0.35 0.4
+-0.25 -0.35 0.6
+-0.05 -0.35 0.6
+-0.05 -0.15 0.6
+-0.05 -0.15 0.4
+-0.05 -0.35 0.4
+
+
+-0.25 -0.35 0.6
+-0.25 -0.15 0.6
+-0.05 -0.15 0.6
+
+
+-0.25 -0.15 0.6
+-0.25 -0.15 0.4
+-0.25 -0.35 0.4
+
+
+-0.05 -0.15 0.4
+-0.25 -0.15 0.4
+
+
+0.15 -0.35 0.6
+0.15 -0.15 0.6
+0.15 -0.15 0.4
+0.15 -0.35 0.4
+0.15 -0.35 0.6
+-0.05 -0.35 0.6
+-0.05 -0.15 0.6
+0.15 -0.15 0.6
+
+
+-0.05 -0.15 0.6
+-0.05 -0.15 0.4
+0.15 -0.15 0.4
+
+
+0.15 -0.35 0.4
+-0.05 -0.35 0.4
+-0.05 -0.35 0.6
+
+
+-0.05 -0.35 0.4
+-0.05 -0.15 0.4
+
+
+0.35 -0.15 0.6
+0.35 -0.15 0.4
+0.15 -0.15 0.4
+0.15 -0.15 0.6
+0.35 -0.15 0.6
+0.35 -0.35 0.6
+0.15 -0.35 0.6
+0.15 -0.15 0.6
+
+
+0.35 -0.15 0.4
+0.35 -0.35 0.4
+0.35 -0.35 0.6
+
+
+0.15 -0.35 0.6
+0.15 -0.35 0.4
+0.35 -0.35 0.4
+
+
+0.15 -0.15 0.4
+0.15 -0.35 0.4
+
+
+0.55 -0.15 0.6
+0.55 -0.35 0.6
+0.35 -0.35 0.6
+0.35 -0.15 0.6
+0.55 -0.15 0.6
+0.55 -0.15 0.4
+0.35 -0.15 0.4
+0.35 -0.15 0.6
+
+
+0.55 -0.15 0.4
+0.55 -0.35 0.4
+0.55 -0.35 0.6
+
+
+0.35 -0.35 0.6
+0.35 -0.35 0.4
+0.55 -0.35 0.4
+
+
+0.35 -0.15 0.4
+0.35 -0.35 0.4
+
+
+0.55 -0.15 0.6
+0.642659 -0.15 0.692659
+0.59257 -0.35 0.64257
+0.597215 -0.397215 0.6
+0.55 -0.35 0.6
+0.59257 -0.35 0.64257
+
+
+0.55 -0.15 0.6
+0.55 -0.15 0.4
+0.799439 -0.15 0.4
+0.642659 -0.15 0.692659
+
+
+0.55 -0.15 0.6
+0.55 -0.35 0.6
+0.55 -0.35 0.4
+0.55 -0.15 0.4
+
+
+0.722516 -0.35 0.4
+0.55 -0.35 0.4
+0.639837 -0.439837 0.489837
+0.722516 -0.35 0.4
+0.799439 -0.15 0.4
+
+
+0.597215 -0.397215 0.6
+0.639837 -0.439837 0.489837
+
+
+-0.45 -0.15 0.4
+-0.45 0.05 0.4
+-0.45 0.05 0.6
+-0.45 -0.15 0.6
+-0.45 -0.15 0.4
+-0.65 -0.15 0.4
+-0.65 0.05 0.4
+-0.45 0.05 0.4
+
+
+-0.65 0.05 0.4
+-0.755085 0.05 0.505085
+-0.742981 -0.15 0.492981
+-0.65 -0.15 0.4
+
+
+-0.68925 -0.15 0.6
+-0.45 -0.15 0.6
+
+
+-0.68925 -0.15 0.6
+-0.707432 0.05 0.6
+-0.45 0.05 0.6
+
+
+-0.68925 -0.15 0.6
+-0.742981 -0.15 0.492981
+
+
+-0.707432 0.05 0.6
+-0.755085 0.05 0.505085
+
+
+-0.25 -0.15 0.4
+-0.25 -0.15 0.6
+-0.25 0.05 0.6
+-0.25 0.05 0.4
+-0.45 0.05 0.4
+-0.45 0.05 0.6
+-0.45 -0.15 0.6
+-0.25 -0.15 0.6
+
+
+-0.25 -0.15 0.4
+-0.45 -0.15 0.4
+-0.45 -0.15 0.6
+
+
+-0.25 -0.15 0.4
+-0.25 0.05 0.4
+
+
+-0.45 0.05 0.4
+-0.45 -0.15 0.4
+
+
+-0.45 0.05 0.6
+-0.25 0.05 0.6
+
+
+-0.05 -0.15 0.4
+-0.05 -0.15 0.6
+-0.05 0.05 0.6
+-0.05 0.05 0.4
+-0.05 -0.15 0.4
+-0.25 -0.15 0.4
+-0.25 -0.15 0.6
+-0.05 -0.15 0.6
+
+
+-0.05 0.05 0.6
+-0.25 0.05 0.6
+-0.25 0.05 0.4
+-0.05 0.05 0.4
+
+
+-0.25 0.05 0.6
+-0.25 -0.15 0.6
+
+
+-0.25 0.05 0.4
+-0.25 -0.15 0.4
+
+
+-0.05 -0.15 0.4
+-0.05 -0.15 0.6
+-0.05 0.05 0.6
+0.15 0.05 0.6
+0.15 -0.15 0.6
+-0.05 -0.15 0.6
+
+
+-0.05 -0.15 0.4
+-0.05 0.05 0.4
+-0.05 0.05 0.6
+
+
+-0.05 -0.15 0.4
+0.15 -0.15 0.4
+0.15 -0.15 0.6
+
+
+-0.05 0.05 0.4
+0.15 0.05 0.4
+0.15 -0.15 0.4
+
+
+0.15 0.05 0.6
+0.15 0.05 0.4
+
+
+0.15 0.05 0.6
+0.35 0.05 0.6
+0.35 0.05 0.4
+0.15 0.05 0.4
+0.15 0.05 0.6
+0.15 -0.15 0.6
+0.35 -0.15 0.6
+0.35 0.05 0.6
+
+
+0.35 -0.15 0.4
+0.35 -0.15 0.6
+
+
+0.35 -0.15 0.4
+0.15 -0.15 0.4
+0.15 -0.15 0.6
+
+
+0.35 -0.15 0.4
+0.35 0.05 0.4
+
+
+0.15 0.05 0.4
+0.15 -0.15 0.4
+
+
+0.55 -0.15 0.6
+0.55 -0.15 0.4
+0.55 0.05 0.4
+0.35 0.05 0.4
+0.35 0.05 0.6
+0.55 0.05 0.6
+0.55 0.05 0.4
+
+
+0.55 -0.15 0.6
+0.55 0.05 0.6
+
+
+0.55 -0.15 0.6
+0.35 -0.15 0.6
+0.35 0.05 0.6
+
+
+0.35 0.05 0.4
+0.35 -0.15 0.4
+0.35 -0.15 0.6
+
+
+0.55 -0.15 0.4
+0.35 -0.15 0.4
+
+
+0.790825 -0.15 0.4
+0.80621 0.05 0.4
+0.65384 0.05 0.70384
+0.643594 -0.15 0.693594
+0.55 -0.15 0.6
+0.55 0.05 0.6
+0.65384 0.05 0.70384
+
+
+0.790825 -0.15 0.4
+0.643594 -0.15 0.693594
+
+
+0.790825 -0.15 0.4
+0.55 -0.15 0.4
+0.55 0.05 0.4
+0.55 0.05 0.6
+
+
+0.55 0.05 0.4
+0.80621 0.05 0.4
+
+
+0.55 -0.15 0.4
+0.55 -0.15 0.6
+
+
+-0.45 0.25 0.4
+-0.65 0.25 0.4
+-0.723134 0.25 0.473134
+-0.75906 0.05 0.50906
+-0.71193 0.05 0.6
+-0.657384 0.25 0.6
+-0.723134 0.25 0.473134
+
+
+-0.45 0.25 0.4
+-0.45 0.25 0.6
+-0.657384 0.25 0.6
+
+
+-0.45 0.25 0.4
+-0.45 0.05 0.4
+-0.65 0.05 0.4
+-0.75906 0.05 0.50906
+
+
+-0.71193 0.05 0.6
+-0.45 0.05 0.6
+-0.45 0.05 0.4
+
+
+-0.65 0.25 0.4
+-0.65 0.05 0.4
+
+
+-0.45 0.25 0.6
+-0.45 0.05 0.6
+
+
+-0.45 0.25 0.4
+-0.45 0.25 0.6
+-0.45 0.05 0.6
+-0.25 0.05 0.6
+-0.25 0.25 0.6
+-0.45 0.25 0.6
+
+
+-0.45 0.25 0.4
+-0.25 0.25 0.4
+-0.25 0.25 0.6
+
+
+-0.45 0.25 0.4
+-0.45 0.05 0.4
+-0.45 0.05 0.6
+
+
+-0.25 0.05 0.6
+-0.25 0.05 0.4
+-0.45 0.05 0.4
+
+
+-0.25 0.25 0.4
+-0.25 0.05 0.4
+
+
+-0.25 0.05 0.6
+-0.25 0.05 0.4
+-0.25 0.25 0.4
+-0.05 0.25 0.4
+-0.05 0.25 0.6
+-0.25 0.25 0.6
+-0.25 0.25 0.4
+
+
+-0.25 0.05 0.6
+-0.05 0.05 0.6
+-0.05 0.25 0.6
+
+
+-0.25 0.05 0.6
+-0.25 0.25 0.6
+
+
+-0.05 0.05 0.4
+-0.05 0.05 0.6
+
+
+-0.05 0.05 0.4
+-0.25 0.05 0.4
+
+
+-0.05 0.05 0.4
+-0.05 0.25 0.4
+
+
+0.15 0.05 0.4
+-0.05 0.05 0.4
+-0.05 0.05 0.6
+-0.05 0.25 0.6
+-0.05 0.25 0.4
+-0.05 0.05 0.4
+
+
+0.15 0.05 0.4
+0.15 0.25 0.4
+0.15 0.25 0.6
+-0.05 0.25 0.6
+
+
+0.15 0.05 0.4
+0.15 0.05 0.6
+0.15 0.25 0.6
+
+
+-0.05 0.25 0.4
+0.15 0.25 0.4
+
+
+-0.05 0.05 0.6
+0.15 0.05 0.6
+
+
+0.35 0.05 0.4
+0.35 0.25 0.4
+0.35 0.25 0.6
+0.15 0.25 0.6
+0.15 0.25 0.4
+0.35 0.25 0.4
+
+
+0.35 0.05 0.4
+0.35 0.05 0.6
+0.35 0.25 0.6
+
+
+0.35 0.05 0.4
+0.15 0.05 0.4
+0.15 0.05 0.6
+0.35 0.05 0.6
+
+
+0.15 0.05 0.6
+0.15 0.25 0.6
+
+
+0.15 0.25 0.4
+0.15 0.05 0.4
+
+
+0.55 0.05 0.4
+0.55 0.25 0.4
+0.55 0.25 0.6
+0.35 0.25 0.6
+0.35 0.25 0.4
+0.55 0.25 0.4
+
+
+0.55 0.05 0.4
+0.55 0.05 0.6
+0.55 0.25 0.6
+
+
+0.55 0.05 0.4
+0.35 0.05 0.4
+0.35 0.05 0.6
+0.55 0.05 0.6
+
+
+0.35 0.05 0.6
+0.35 0.25 0.6
+
+
+0.35 0.25 0.4
+0.35 0.05 0.4
+
+
+0.809487 0.05 0.4
+0.55 0.05 0.4
+0.55 0.25 0.4
+0.763333 0.25 0.4
+0.623162 0.25 0.673162
+0.55 0.25 0.6
+0.55 0.25 0.4
+
+
+0.809487 0.05 0.4
+0.763333 0.25 0.4
+
+
+0.809487 0.05 0.4
+0.653664 0.05 0.703664
+0.55 0.05 0.6
+0.55 0.25 0.6
+
+
+0.55 0.05 0.4
+0.55 0.05 0.6
+
+
+0.623162 0.25 0.673162
+0.653664 0.05 0.703664
+
+
+-0.45 0.25 0.6
+-0.670626 0.25 0.6
+-0.548979 0.348979 0.698979
+-0.45 0.25 0.6
+-0.45 0.25 0.4
+-0.45 0.45 0.4
+-0.545057 0.545057 0.495057
+-0.655331 0.455331 0.405331
+-0.65 0.45 0.4
+-0.45 0.45 0.4
+-0.45 0.45 0.6
+-0.491881 0.491881 0.641881
+-0.545057 0.545057 0.495057
+
+
+-0.45 0.25 0.6
+-0.45 0.45 0.6
+
+
+-0.655331 0.455331 0.405331
+-0.737374 0.25 0.487374
+-0.670626 0.25 0.6
+
+
+-0.491881 0.491881 0.641881
+-0.548979 0.348979 0.698979
+
+
+-0.45 0.25 0.4
+-0.65 0.25 0.4
+-0.737374 0.25 0.487374
+
+
+-0.65 0.45 0.4
+-0.65 0.25 0.4
+
+
+-0.25 0.25 0.4
+-0.25 0.25 0.6
+-0.25 0.45 0.6
+-0.45 0.45 0.6
+-0.45 0.25 0.6
+-0.25 0.25 0.6
+
+
+-0.25 0.25 0.4
+-0.45 0.25 0.4
+-0.45 0.25 0.6
+
+
+-0.25 0.25 0.4
+-0.25 0.45 0.4
+-0.25 0.45 0.6
+
+
+-0.45 0.45 0.4
+-0.25 0.45 0.4
+
+
+-0.45 0.45 0.4
+-0.45 0.25 0.4
+
+
+-0.45 0.45 0.4
+-0.45 0.45 0.6
+
+
+-0.05 0.25 0.4
+-0.05 0.25 0.6
+-0.05 0.45 0.6
+-0.25 0.45 0.6
+-0.25 0.25 0.6
+-0.05 0.25 0.6
+
+
+-0.05 0.25 0.4
+-0.25 0.25 0.4
+-0.25 0.25 0.6
+
+
+-0.05 0.25 0.4
+-0.05 0.45 0.4
+-0.05 0.45 0.6
+
+
+-0.25 0.45 0.4
+-0.25 0.45 0.6
+
+
+-0.25 0.45 0.4
+-0.05 0.45 0.4
+
+
+-0.25 0.45 0.4
+-0.25 0.25 0.4
+
+
+0.15 0.25 0.4
+0.15 0.25 0.6
+0.15 0.45 0.6
+-0.05 0.45 0.6
+-0.05 0.45 0.4
+0.15 0.45 0.4
+0.15 0.45 0.6
+
+
+0.15 0.25 0.4
+-0.05 0.25 0.4
+-0.05 0.25 0.6
+0.15 0.25 0.6
+
+
+0.15 0.25 0.4
+0.15 0.45 0.4
+
+
+-0.05 0.45 0.4
+-0.05 0.25 0.4
+
+
+-0.05 0.25 0.6
+-0.05 0.45 0.6
+
+
+0.35 0.25 0.4
+0.15 0.25 0.4
+0.15 0.25 0.6
+0.15 0.45 0.6
+0.15 0.45 0.4
+0.15 0.25 0.4
+
+
+0.35 0.25 0.4
+0.35 0.45 0.4
+0.15 0.45 0.4
+
+
+0.35 0.25 0.4
+0.35 0.25 0.6
+0.35 0.45 0.6
+0.15 0.45 0.6
+
+
+0.15 0.25 0.6
+0.35 0.25 0.6
+
+
+0.35 0.45 0.6
+0.35 0.45 0.4
+
+
+0.55 0.25 0.4
+0.55 0.45 0.4
+0.55 0.45 0.579166
+0.536803 0.45 0.6
+0.35 0.45 0.6
+0.35 0.45 0.4
+0.55 0.45 0.4
+
+
+0.55 0.25 0.4
+0.55 0.25 0.6
+0.55 0.433033 0.6
+0.55 0.45 0.579166
+
+
+0.55 0.25 0.4
+0.35 0.25 0.4
+0.35 0.25 0.6
+0.55 0.25 0.6
+
+
+0.536803 0.45 0.6
+0.55 0.433033 0.6
+
+
+0.35 0.25 0.6
+0.35 0.45 0.6
+
+
+0.35 0.25 0.4
+0.35 0.45 0.4
+
+
+0.55 0.25 0.6
+0.55 0.45 0.6
+0.55 0.45 0.4
+0.625593 0.525593 0.4
+0.551292 0.451292 0.601292
+0.55 0.45 0.6
+
+
+0.55 0.25 0.6
+0.55 0.25 0.4
+0.55 0.45 0.4
+
+
+0.55 0.25 0.6
+0.620422 0.25 0.670422
+0.773989 0.25 0.4
+0.55 0.25 0.4
+
+
+0.773989 0.25 0.4
+0.625593 0.525593 0.4
+
+
+0.551292 0.451292 0.601292
+0.620422 0.25 0.670422
+
+
+-0.45 0.45 0.6
+-0.45 0.45 0.4
+-0.45 0.65 0.4
+-0.455331 0.655331 0.405331
+-0.545057 0.545057 0.495057
+-0.45 0.45 0.4
+-0.25 0.45 0.4
+-0.25 0.45 0.6
+-0.348979 0.548979 0.698979
+-0.25 0.670626 0.6
+-0.25 0.45 0.6
+-0.45 0.45 0.6
+-0.491881 0.491881 0.641881
+-0.348979 0.548979 0.698979
+
+
+-0.25 0.45 0.4
+-0.25 0.65 0.4
+-0.25 0.737374 0.487374
+-0.455331 0.655331 0.405331
+
+
+-0.545057 0.545057 0.495057
+-0.491881 0.491881 0.641881
+
+
+-0.25 0.670626 0.6
+-0.25 0.737374 0.487374
+
+
+-0.45 0.65 0.4
+-0.25 0.65 0.4
+
+
+-0.05 0.45 0.4
+-0.05 0.45 0.6
+-0.05 0.71193 0.6
+-0.05 0.75906 0.50906
+-0.05 0.65 0.4
+-0.05 0.45 0.4
+-0.25 0.45 0.4
+-0.25 0.45 0.6
+-0.05 0.45 0.6
+
+
+-0.05 0.71193 0.6
+-0.25 0.657384 0.6
+-0.25 0.45 0.6
+
+
+-0.05 0.65 0.4
+-0.25 0.65 0.4
+-0.25 0.45 0.4
+
+
+-0.25 0.723134 0.473134
+-0.25 0.65 0.4
+
+
+-0.25 0.723134 0.473134
+-0.25 0.657384 0.6
+
+
+-0.25 0.723134 0.473134
+-0.05 0.75906 0.50906
+
+
+0.15 0.45 0.4
+0.15 0.65 0.4
+-0.05 0.65 0.4
+-0.05 0.755085 0.505085
+-0.05 0.707432 0.6
+0.15 0.68925 0.6
+0.15 0.742981 0.492981
+0.15 0.65 0.4
+
+
+0.15 0.45 0.4
+0.15 0.45 0.6
+0.15 0.68925 0.6
+
+
+0.15 0.45 0.4
+-0.05 0.45 0.4
+-0.05 0.65 0.4
+
+
+0.15 0.742981 0.492981
+-0.05 0.755085 0.505085
+
+
+-0.05 0.45 0.6
+-0.05 0.707432 0.6
+
+
+-0.05 0.45 0.6
+-0.05 0.45 0.4
+
+
+-0.05 0.45 0.6
+0.15 0.45 0.6
+
+
+0.35 0.45 0.6
+0.35 0.60983 0.6
+0.35 0.694975 0.444975
+0.15 0.753655 0.503655
+0.15 0.65 0.4
+0.35 0.65 0.4
+0.35 0.694975 0.444975
+
+
+0.35 0.45 0.6
+0.15 0.45 0.6
+0.15 0.700739 0.6
+0.35 0.60983 0.6
+
+
+0.35 0.45 0.6
+0.35 0.45 0.4
+0.15 0.45 0.4
+0.15 0.45 0.6
+
+
+0.15 0.45 0.4
+0.15 0.65 0.4
+
+
+0.15 0.700739 0.6
+0.15 0.753655 0.503655
+
+
+0.35 0.45 0.4
+0.35 0.65 0.4
+
+
+0.35 0.618079 0.6
+0.418208 0.518208 0.668208
+0.35 0.45 0.6
+0.35 0.618079 0.6
+0.35 0.709103 0.459103
+0.35 0.65 0.4
+0.403507 0.703507 0.4
+0.35 0.709103 0.459103
+
+
+0.418208 0.518208 0.668208
+0.551803 0.451803 0.601803
+0.623507 0.523507 0.4
+0.403507 0.703507 0.4
+
+
+0.35 0.45 0.4
+0.55 0.45 0.4
+0.623507 0.523507 0.4
+
+
+0.35 0.45 0.4
+0.35 0.45 0.6
+0.55 0.45 0.6
+0.551803 0.451803 0.601803
+
+
+0.35 0.45 0.4
+0.35 0.65 0.4
+
+
+0.55 0.45 0.4
+0.55 0.45 0.6
+
+
+-0.25 -0.35 0.6
+-0.45 -0.35 0.6
+-0.527473 -0.427473 0.677473
+-0.45 -0.536803 0.6
+-0.45 -0.35 0.6
+-0.45 -0.35 0.8
+-0.25 -0.35 0.8
+-0.25 -0.565673 0.8
+-0.339446 -0.439446 0.889446
+-0.25 -0.35 0.8
+-0.25 -0.35 0.6
+-0.25 -0.55 0.6
+-0.433033 -0.55 0.6
+-0.25 -0.637153 0.687153
+-0.25 -0.55 0.6
+
+
+-0.339446 -0.439446 0.889446
+-0.474932 -0.374932 0.824932
+-0.45 -0.35 0.8
+
+
+-0.25 -0.637153 0.687153
+-0.25 -0.565673 0.8
+
+
+-0.474932 -0.374932 0.824932
+-0.527473 -0.427473 0.677473
+
+
+-0.45 -0.536803 0.6
+-0.433033 -0.55 0.6
+
+
+-0.05 -0.35 0.6
+-0.25 -0.35 0.6
+-0.25 -0.35 0.8
+-0.25 -0.549122 0.8
+-0.25 -0.618453 0.668453
+-0.25 -0.55 0.6
+-0.25 -0.35 0.6
+
+
+-0.05 -0.35 0.6
+-0.05 -0.35 0.8
+-0.25 -0.35 0.8
+
+
+-0.05 -0.35 0.6
+-0.05 -0.55 0.6
+-0.25 -0.55 0.6
+
+
+-0.05 -0.55 0.6
+-0.05 -0.662111 0.712111
+-0.05 -0.615789 0.8
+-0.05 -0.35 0.8
+
+
+-0.05 -0.662111 0.712111
+-0.25 -0.618453 0.668453
+
+
+-0.25 -0.549122 0.8
+-0.05 -0.615789 0.8
+
+
+-0.05 -0.656357 0.706357
+0.15 -0.641573 0.691573
+0.15 -0.55 0.6
+-0.05 -0.55 0.6
+-0.05 -0.656357 0.706357
+-0.05 -0.609248 0.8
+-0.05 -0.35 0.8
+-0.05 -0.35 0.6
+-0.05 -0.55 0.6
+
+
+-0.05 -0.35 0.6
+0.15 -0.35 0.6
+0.15 -0.35 0.8
+-0.05 -0.35 0.8
+
+
+0.15 -0.35 0.6
+0.15 -0.55 0.6
+
+
+-0.05 -0.609248 0.8
+0.15 -0.587026 0.8
+0.15 -0.35 0.8
+
+
+0.15 -0.587026 0.8
+0.15 -0.641573 0.691573
+
+
+0.35 -0.491931 0.8
+0.15 -0.603042 0.8
+0.15 -0.656514 0.706514
+0.35 -0.585832 0.635832
+0.35 -0.55 0.6
+0.35 -0.35 0.6
+0.35 -0.35 0.8
+0.35 -0.491931 0.8
+0.35 -0.585832 0.635832
+
+
+0.15 -0.35 0.8
+0.35 -0.35 0.8
+
+
+0.15 -0.35 0.8
+0.15 -0.35 0.6
+0.35 -0.35 0.6
+
+
+0.15 -0.35 0.8
+0.15 -0.603042 0.8
+
+
+0.15 -0.656514 0.706514
+0.15 -0.55 0.6
+0.15 -0.35 0.6
+
+
+0.15 -0.55 0.6
+0.35 -0.55 0.6
+
+
+0.498528 -0.35 0.8
+0.404866 -0.404866 0.854866
+0.35 -0.35 0.8
+0.498528 -0.35 0.8
+0.602691 -0.35 0.652691
+0.55 -0.35 0.6
+0.594975 -0.394975 0.6
+0.602691 -0.35 0.652691
+
+
+0.35 -0.35 0.6
+0.55 -0.35 0.6
+
+
+0.35 -0.35 0.6
+0.35 -0.55 0.6
+0.35 -0.602691 0.652691
+0.394975 -0.594975 0.6
+0.35 -0.55 0.6
+
+
+0.35 -0.35 0.6
+0.35 -0.35 0.8
+0.35 -0.498528 0.8
+0.35 -0.602691 0.652691
+
+
+0.394975 -0.594975 0.6
+0.594975 -0.394975 0.6
+
+
+0.404866 -0.404866 0.854866
+0.35 -0.498528 0.8
+
+
+-0.60983 -0.35 0.6
+-0.529765 -0.429765 0.679765
+-0.45 -0.35 0.6
+-0.60983 -0.35 0.6
+-0.700739 -0.15 0.6
+-0.540944 -0.15 0.890944
+-0.474945 -0.374945 0.824945
+-0.529765 -0.429765 0.679765
+
+
+-0.45 -0.15 0.8
+-0.540944 -0.15 0.890944
+
+
+-0.45 -0.15 0.8
+-0.45 -0.35 0.8
+-0.474945 -0.374945 0.824945
+
+
+-0.45 -0.15 0.8
+-0.45 -0.15 0.6
+-0.700739 -0.15 0.6
+
+
+-0.45 -0.35 0.8
+-0.45 -0.35 0.6
+-0.45 -0.15 0.6
+
+
+-0.25 -0.35 0.6
+-0.25 -0.35 0.8
+-0.45 -0.35 0.8
+-0.45 -0.15 0.8
+-0.25 -0.15 0.8
+-0.25 -0.35 0.8
+
+
+-0.25 -0.35 0.6
+-0.45 -0.35 0.6
+-0.45 -0.35 0.8
+
+
+-0.25 -0.35 0.6
+-0.25 -0.15 0.6
+-0.45 -0.15 0.6
+-0.45 -0.35 0.6
+
+
+-0.25 -0.15 0.6
+-0.25 -0.15 0.8
+
+
+-0.45 -0.15 0.6
+-0.45 -0.15 0.8
+
+
+-0.05 -0.15 0.6
+-0.05 -0.35 0.6
+-0.05 -0.35 0.8
+-0.25 -0.35 0.8
+-0.25 -0.35 0.6
+-0.05 -0.35 0.6
+
+
+-0.05 -0.15 0.6
+-0.25 -0.15 0.6
+-0.25 -0.35 0.6
+
+
+-0.05 -0.15 0.6
+-0.05 -0.15 0.8
+-0.05 -0.35 0.8
+
+
+-0.25 -0.35 0.8
+-0.25 -0.15 0.8
+-0.05 -0.15 0.8
+
+
+-0.25 -0.15 0.6
+-0.25 -0.15 0.8
+
+
+0.15 -0.15 0.6
+0.15 -0.35 0.6
+0.15 -0.35 0.8
+-0.05 -0.35 0.8
+-0.05 -0.15 0.8
+0.15 -0.15 0.8
+0.15 -0.35 0.8
+
+
+0.15 -0.15 0.6
+-0.05 -0.15 0.6
+-0.05 -0.35 0.6
+0.15 -0.35 0.6
+
+
+0.15 -0.15 0.6
+0.15 -0.15 0.8
+
+
+-0.05 -0.15 0.8
+-0.05 -0.15 0.6
+
+
+-0.05 -0.35 0.6
+-0.05 -0.35 0.8
+
+
+0.35 -0.15 0.8
+0.35 -0.15 0.6
+0.15 -0.15 0.6
+0.15 -0.35 0.6
+0.35 -0.35 0.6
+0.35 -0.15 0.6
+
+
+0.35 -0.15 0.8
+0.15 -0.15 0.8
+0.15 -0.15 0.6
+
+
+0.35 -0.15 0.8
+0.35 -0.35 0.8
+0.35 -0.35 0.6
+
+
+0.15 -0.15 0.8
+0.15 -0.35 0.8
+0.35 -0.35 0.8
+
+
+0.15 -0.35 0.8
+0.15 -0.35 0.6
+
+
+0.35 -0.15 0.6
+0.35 -0.15 0.8
+0.603042 -0.15 0.8
+0.491931 -0.35 0.8
+0.35 -0.35 0.8
+0.35 -0.15 0.8
+
+
+0.35 -0.15 0.6
+0.55 -0.15 0.6
+0.656514 -0.15 0.706514
+0.603042 -0.15 0.8
+
+
+0.35 -0.15 0.6
+0.35 -0.35 0.6
+0.55 -0.35 0.6
+0.55 -0.15 0.6
+
+
+0.656514 -0.15 0.706514
+0.585832 -0.35 0.635832
+0.491931 -0.35 0.8
+
+
+0.585832 -0.35 0.635832
+0.55 -0.35 0.6
+
+
+0.35 -0.35 0.8
+0.35 -0.35 0.6
+
+
+-0.45 -0.15 0.6
+-0.45 0.05 0.6
+-0.45 0.05 0.8
+-0.554536 0.05 0.904536
+-0.707432 0.05 0.6
+-0.45 0.05 0.6
+
+
+-0.45 -0.15 0.6
+-0.45 -0.15 0.8
+-0.542432 -0.15 0.892432
+-0.554536 0.05 0.904536
+
+
+-0.45 -0.15 0.6
+-0.68925 -0.15 0.6
+-0.542432 -0.15 0.892432
+
+
+-0.707432 0.05 0.6
+-0.68925 -0.15 0.6
+
+
+-0.45 -0.15 0.8
+-0.45 0.05 0.8
+
+
+-0.25 -0.15 0.6
+-0.25 -0.15 0.8
+-0.45 -0.15 0.8
+-0.45 0.05 0.8
+-0.25 0.05 0.8
+-0.25 -0.15 0.8
+
+
+-0.25 -0.15 0.6
+-0.45 -0.15 0.6
+-0.45 0.05 0.6
+-0.45 0.05 0.8
+
+
+-0.25 -0.15 0.6
+-0.25 0.05 0.6
+-0.45 0.05 0.6
+
+
+-0.25 0.05 0.6
+-0.25 0.05 0.8
+
+
+-0.45 -0.15 0.8
+-0.45 -0.15 0.6
+
+
+-0.05 -0.15 0.6
+-0.05 -0.15 0.8
+-0.25 -0.15 0.8
+-0.25 0.05 0.8
+-0.05 0.05 0.8
+-0.05 -0.15 0.8
+
+
+-0.05 -0.15 0.6
+-0.25 -0.15 0.6
+-0.25 0.05 0.6
+-0.25 0.05 0.8
+
+
+-0.05 -0.15 0.6
+-0.05 0.05 0.6
+-0.25 0.05 0.6
+
+
+-0.05 0.05 0.8
+-0.05 0.05 0.6
+
+
+-0.25 -0.15 0.8
+-0.25 -0.15 0.6
+
+
+0.15 -0.15 0.6
+-0.05 -0.15 0.6
+-0.05 -0.15 0.8
+0.15 -0.15 0.8
+0.15 -0.15 0.6
+0.15 0.05 0.6
+-0.05 0.05 0.6
+-0.05 -0.15 0.6
+
+
+-0.05 0.05 0.8
+-0.05 0.05 0.6
+
+
+-0.05 0.05 0.8
+-0.05 -0.15 0.8
+
+
+-0.05 0.05 0.8
+0.15 0.05 0.8
+0.15 -0.15 0.8
+
+
+0.15 0.05 0.8
+0.15 0.05 0.6
+
+
+0.15 0.05 0.8
+0.15 -0.15 0.8
+0.35 -0.15 0.8
+0.35 -0.15 0.6
+0.15 -0.15 0.6
+0.15 -0.15 0.8
+
+
+0.15 0.05 0.8
+0.35 0.05 0.8
+0.35 -0.15 0.8
+
+
+0.15 0.05 0.8
+0.15 0.05 0.6
+0.15 -0.15 0.6
+
+
+0.35 0.05 0.8
+0.35 0.05 0.6
+0.35 -0.15 0.6
+
+
+0.15 0.05 0.6
+0.35 0.05 0.6
+
+
+0.656357 0.05 0.706357
+0.609248 0.05 0.8
+0.587026 -0.15 0.8
+0.641573 -0.15 0.691573
+0.656357 0.05 0.706357
+0.55 0.05 0.6
+0.55 -0.15 0.6
+0.641573 -0.15 0.691573
+
+
+0.35 0.05 0.6
+0.35 0.05 0.8
+0.609248 0.05 0.8
+
+
+0.35 0.05 0.6
+0.55 0.05 0.6
+
+
+0.35 0.05 0.6
+0.35 -0.15 0.6
+0.55 -0.15 0.6
+
+
+0.35 -0.15 0.8
+0.587026 -0.15 0.8
+
+
+0.35 -0.15 0.8
+0.35 0.05 0.8
+
+
+0.35 -0.15 0.8
+0.35 -0.15 0.6
+
+
+-0.71193 0.05 0.6
+-0.554249 0.05 0.904249
+-0.518323 0.25 0.868323
+-0.531504 0.331504 0.8
+-0.45 0.25 0.8
+-0.518323 0.25 0.868323
+
+
+-0.71193 0.05 0.6
+-0.657384 0.25 0.6
+-0.45 0.25 0.6
+-0.565793 0.365793 0.715793
+-0.657384 0.25 0.6
+
+
+-0.71193 0.05 0.6
+-0.45 0.05 0.6
+-0.45 0.25 0.6
+-0.45 0.25 0.8
+-0.45 0.05 0.8
+-0.554249 0.05 0.904249
+
+
+-0.531504 0.331504 0.8
+-0.565793 0.365793 0.715793
+
+
+-0.45 0.05 0.6
+-0.45 0.05 0.8
+
+
+-0.25 0.25 0.8
+-0.45 0.25 0.8
+-0.45 0.25 0.6
+-0.45 0.05 0.6
+-0.25 0.05 0.6
+-0.25 0.25 0.6
+-0.45 0.25 0.6
+
+
+-0.25 0.25 0.8
+-0.25 0.05 0.8
+-0.45 0.05 0.8
+-0.45 0.25 0.8
+
+
+-0.25 0.25 0.8
+-0.25 0.25 0.6
+
+
+-0.25 0.05 0.6
+-0.25 0.05 0.8
+
+
+-0.45 0.05 0.8
+-0.45 0.05 0.6
+
+
+-0.05 0.25 0.6
+-0.25 0.25 0.6
+-0.25 0.25 0.8
+-0.25 0.05 0.8
+-0.25 0.05 0.6
+-0.25 0.25 0.6
+
+
+-0.05 0.25 0.6
+-0.05 0.25 0.8
+-0.25 0.25 0.8
+
+
+-0.05 0.25 0.6
+-0.05 0.05 0.6
+-0.05 0.05 0.8
+-0.25 0.05 0.8
+
+
+-0.05 0.25 0.8
+-0.05 0.05 0.8
+
+
+-0.25 0.05 0.6
+-0.05 0.05 0.6
+
+
+0.15 0.05 0.6
+-0.05 0.05 0.6
+-0.05 0.05 0.8
+-0.05 0.25 0.8
+0.15 0.25 0.8
+0.15 0.05 0.8
+-0.05 0.05 0.8
+
+
+0.15 0.05 0.6
+0.15 0.25 0.6
+-0.05 0.25 0.6
+-0.05 0.05 0.6
+
+
+0.15 0.05 0.6
+0.15 0.05 0.8
+
+
+-0.05 0.25 0.6
+-0.05 0.25 0.8
+
+
+0.15 0.25 0.8
+0.15 0.25 0.6
+
+
+0.35 0.05 0.6
+0.15 0.05 0.6
+0.15 0.05 0.8
+0.35 0.05 0.8
+0.35 0.05 0.6
+0.35 0.25 0.6
+0.35 0.25 0.8
+0.35 0.05 0.8
+
+
+0.35 0.25 0.6
+0.15 0.25 0.6
+0.15 0.05 0.6
+
+
+0.15 0.05 0.8
+0.15 0.25 0.8
+0.35 0.25 0.8
+
+
+0.15 0.25 0.8
+0.15 0.25 0.6
+
+
+0.35 0.25 0.6
+0.35 0.05 0.6
+0.35 0.05 0.8
+0.35 0.25 0.8
+0.35 0.25 0.6
+0.55 0.25 0.6
+0.55 0.05 0.6
+0.35 0.05 0.6
+
+
+0.615789 0.05 0.8
+0.35 0.05 0.8
+
+
+0.615789 0.05 0.8
+0.662111 0.05 0.712111
+0.55 0.05 0.6
+
+
+0.615789 0.05 0.8
+0.549122 0.25 0.8
+0.618453 0.25 0.668453
+0.55 0.25 0.6
+
+
+0.662111 0.05 0.712111
+0.618453 0.25 0.668453
+
+
+0.35 0.25 0.8
+0.549122 0.25 0.8
+
+
+-0.524264 0.324264 0.8
+-0.45 0.25 0.8
+-0.45 0.25 0.6
+-0.557107 0.357107 0.707107
+-0.524264 0.324264 0.8
+-0.324264 0.524264 0.8
+-0.357107 0.557107 0.707107
+-0.25 0.45 0.6
+-0.25 0.25 0.6
+-0.25 0.25 0.8
+-0.45 0.25 0.8
+
+
+-0.557107 0.357107 0.707107
+-0.483227 0.483227 0.633227
+-0.357107 0.557107 0.707107
+
+
+-0.45 0.25 0.6
+-0.45 0.45 0.6
+-0.483227 0.483227 0.633227
+
+
+-0.45 0.25 0.6
+-0.25 0.25 0.6
+
+
+-0.25 0.25 0.8
+-0.25 0.45 0.8
+-0.25 0.45 0.6
+-0.45 0.45 0.6
+
+
+-0.324264 0.524264 0.8
+-0.25 0.45 0.8
+
+
+-0.05 0.45 0.6
+-0.25 0.45 0.6
+-0.25 0.45 0.8
+-0.05 0.45 0.8
+-0.05 0.25 0.8
+-0.05 0.25 0.6
+-0.05 0.45 0.6
+-0.05 0.45 0.8
+
+
+-0.05 0.25 0.6
+-0.25 0.25 0.6
+-0.25 0.25 0.8
+-0.05 0.25 0.8
+
+
+-0.25 0.45 0.8
+-0.25 0.25 0.8
+
+
+-0.25 0.45 0.6
+-0.25 0.25 0.6
+
+
+0.15 0.25 0.6
+0.15 0.45 0.6
+0.15 0.45 0.8
+-0.05 0.45 0.8
+-0.05 0.45 0.6
+0.15 0.45 0.6
+
+
+0.15 0.25 0.6
+0.15 0.25 0.8
+0.15 0.45 0.8
+
+
+0.15 0.25 0.6
+-0.05 0.25 0.6
+-0.05 0.25 0.8
+0.15 0.25 0.8
+
+
+-0.05 0.45 0.6
+-0.05 0.25 0.6
+
+
+-0.05 0.25 0.8
+-0.05 0.45 0.8
+
+
+0.35 0.25 0.6
+0.15 0.25 0.6
+0.15 0.25 0.8
+0.15 0.45 0.8
+0.35 0.45 0.8
+0.35 0.25 0.8
+0.15 0.25 0.8
+
+
+0.35 0.25 0.6
+0.35 0.45 0.6
+0.35 0.45 0.8
+
+
+0.35 0.25 0.6
+0.35 0.25 0.8
+
+
+0.35 0.45 0.6
+0.15 0.45 0.6
+0.15 0.25 0.6
+
+
+0.15 0.45 0.8
+0.15 0.45 0.6
+
+
+0.55 0.25 0.6
+0.637153 0.25 0.687153
+0.55 0.433033 0.6
+0.55 0.25 0.6
+0.35 0.25 0.6
+0.35 0.25 0.8
+0.439446 0.339446 0.889446
+0.565673 0.25 0.8
+0.35 0.25 0.8
+0.35 0.45 0.8
+0.374932 0.474932 0.824932
+0.439446 0.339446 0.889446
+
+
+0.374932 0.474932 0.824932
+0.427473 0.527473 0.677473
+0.35 0.45 0.6
+0.536803 0.45 0.6
+0.427473 0.527473 0.677473
+
+
+0.35 0.25 0.6
+0.35 0.45 0.6
+0.35 0.45 0.8
+
+
+0.637153 0.25 0.687153
+0.565673 0.25 0.8
+
+
+0.536803 0.45 0.6
+0.55 0.433033 0.6
+
+
+-0.25 0.657384 0.6
+-0.365793 0.565793 0.715793
+-0.25 0.45 0.6
+-0.25 0.657384 0.6
+-0.05 0.71193 0.6
+-0.05 0.554249 0.904249
+-0.25 0.518323 0.868323
+-0.25 0.45 0.8
+-0.331504 0.531504 0.8
+-0.25 0.518323 0.868323
+
+
+-0.05 0.71193 0.6
+-0.05 0.45 0.6
+-0.05 0.45 0.8
+-0.05 0.554249 0.904249
+
+
+-0.365793 0.565793 0.715793
+-0.331504 0.531504 0.8
+
+
+-0.05 0.45 0.8
+-0.25 0.45 0.8
+-0.25 0.45 0.6
+-0.05 0.45 0.6
+
+
+0.15 0.68925 0.6
+-0.05 0.707432 0.6
+-0.05 0.554536 0.904536
+0.15 0.542432 0.892432
+0.15 0.68925 0.6
+0.15 0.45 0.6
+0.15 0.45 0.8
+0.15 0.542432 0.892432
+
+
+-0.05 0.707432 0.6
+-0.05 0.45 0.6
+0.15 0.45 0.6
+
+
+-0.05 0.45 0.8
+-0.05 0.554536 0.904536
+
+
+-0.05 0.45 0.8
+-0.05 0.45 0.6
+
+
+-0.05 0.45 0.8
+0.15 0.45 0.8
+
+
+0.35 0.45 0.6
+0.429765 0.529765 0.679765
+0.35 0.60983 0.6
+0.35 0.45 0.6
+0.35 0.45 0.8
+0.15 0.45 0.8
+0.15 0.540944 0.890944
+0.374945 0.474945 0.824945
+0.35 0.45 0.8
+
+
+0.35 0.45 0.6
+0.15 0.45 0.6
+0.15 0.45 0.8
+
+
+0.15 0.700739 0.6
+0.15 0.45 0.6
+
+
+0.15 0.700739 0.6
+0.15 0.540944 0.890944
+
+
+0.15 0.700739 0.6
+0.35 0.60983 0.6
+
+
+0.374945 0.474945 0.824945
+0.429765 0.529765 0.679765
+
+
+-0.05 -0.615789 0.8
+-0.05 -0.35 0.8
+-0.25 -0.35 0.8
+-0.357033 -0.457033 0.907033
+-0.25 -0.549122 0.8
+-0.25 -0.35 0.8
+-0.25 -0.35 1
+-0.320285 -0.420285 1
+-0.357033 -0.457033 0.907033
+
+
+-0.05 -0.615789 0.8
+-0.05 -0.51038 1
+-0.05 -0.35 1
+-0.05 -0.35 0.8
+
+
+-0.05 -0.615789 0.8
+-0.25 -0.549122 0.8
+
+
+-0.25 -0.35 1
+-0.05 -0.35 1
+
+
+-0.320285 -0.420285 1
+-0.05 -0.51038 1
+
+
+0.15 -0.587026 0.8
+0.15 -0.35 0.8
+-0.05 -0.35 0.8
+-0.05 -0.609248 0.8
+0.15 -0.587026 0.8
+0.15 -0.48641 1
+0.15 -0.35 1
+-0.05 -0.35 1
+-0.05 -0.508633 1
+-0.05 -0.609248 0.8
+
+
+-0.05 -0.35 0.8
+-0.05 -0.35 1
+
+
+0.15 -0.35 0.8
+0.15 -0.35 1
+
+
+-0.05 -0.508633 1
+0.15 -0.48641 1
+
+
+0.367701 -0.367701 1
+0.35 -0.35 1
+0.35 -0.35 0.8
+0.416711 -0.416711 0.866711
+0.367701 -0.367701 1
+0.15 -0.488646 1
+0.15 -0.603042 0.8
+0.35 -0.491931 0.8
+0.416711 -0.416711 0.866711
+
+
+0.15 -0.35 1
+0.15 -0.488646 1
+
+
+0.15 -0.35 1
+0.35 -0.35 1
+
+
+0.15 -0.35 1
+0.15 -0.35 0.8
+0.35 -0.35 0.8
+0.35 -0.491931 0.8
+
+
+0.15 -0.603042 0.8
+0.15 -0.35 0.8
+
+
+-0.561616 -0.15 0.911616
+-0.466035 -0.366035 0.816035
+-0.45 -0.35 0.8
+-0.45 -0.15 0.8
+-0.561616 -0.15 0.911616
+-0.507309 -0.15 1
+-0.316764 -0.416764 1
+-0.25 -0.35 1
+-0.25 -0.35 0.8
+-0.25 -0.15 0.8
+-0.45 -0.15 0.8
+
+
+-0.25 -0.15 0.8
+-0.25 -0.15 1
+-0.507309 -0.15 1
+
+
+-0.25 -0.15 1
+-0.25 -0.35 1
+
+
+-0.316764 -0.416764 1
+-0.351919 -0.451919 0.901919
+-0.25 -0.35 0.8
+-0.45 -0.35 0.8
+
+
+-0.466035 -0.366035 0.816035
+-0.351919 -0.451919 0.901919
+
+
+-0.05 -0.35 0.8
+-0.05 -0.35 1
+-0.05 -0.15 1
+-0.05 -0.15 0.8
+-0.05 -0.35 0.8
+-0.25 -0.35 0.8
+-0.25 -0.35 1
+-0.05 -0.35 1
+
+
+-0.25 -0.35 1
+-0.25 -0.15 1
+-0.05 -0.15 1
+
+
+-0.25 -0.15 1
+-0.25 -0.15 0.8
+-0.25 -0.35 0.8
+
+
+-0.05 -0.15 0.8
+-0.25 -0.15 0.8
+
+
+0.15 -0.15 0.8
+0.15 -0.35 0.8
+0.15 -0.35 1
+0.15 -0.15 1
+0.15 -0.15 0.8
+-0.05 -0.15 0.8
+-0.05 -0.35 0.8
+0.15 -0.35 0.8
+
+
+-0.05 -0.15 1
+-0.05 -0.35 1
+0.15 -0.35 1
+
+
+-0.05 -0.15 1
+0.15 -0.15 1
+
+
+-0.05 -0.15 1
+-0.05 -0.15 0.8
+
+
+-0.05 -0.35 0.8
+-0.05 -0.35 1
+
+
+0.35 -0.15 0.8
+0.15 -0.15 0.8
+0.15 -0.15 1
+0.15 -0.35 1
+0.35 -0.35 1
+0.35 -0.15 1
+0.35 -0.15 0.8
+0.35 -0.35 0.8
+0.35 -0.35 1
+
+
+0.15 -0.15 1
+0.35 -0.15 1
+
+
+0.35 -0.35 0.8
+0.15 -0.35 0.8
+0.15 -0.35 1
+
+
+0.15 -0.15 0.8
+0.15 -0.35 0.8
+
+
+0.35 -0.15 0.8
+0.35 -0.15 1
+0.35 -0.35 1
+0.367701 -0.367701 1
+0.416711 -0.416711 0.866711
+0.491931 -0.35 0.8
+0.35 -0.35 0.8
+0.35 -0.15 0.8
+0.603042 -0.15 0.8
+0.488646 -0.15 1
+0.35 -0.15 1
+
+
+0.491931 -0.35 0.8
+0.603042 -0.15 0.8
+
+
+0.367701 -0.367701 1
+0.488646 -0.15 1
+
+
+0.35 -0.35 1
+0.35 -0.35 0.8
+0.416711 -0.416711 0.866711
+
+
+-0.25 -0.15 0.8
+-0.25 -0.15 1
+-0.25 0.05 1
+-0.25 0.05 0.8
+-0.25 -0.15 0.8
+-0.45 -0.15 0.8
+-0.45 0.05 0.8
+-0.25 0.05 0.8
+
+
+-0.45 0.05 0.8
+-0.558456 0.05 0.908456
+-0.539473 -0.15 0.889473
+-0.45 -0.15 0.8
+
+
+-0.483648 -0.15 1
+-0.25 -0.15 1
+
+
+-0.483648 -0.15 1
+-0.512219 0.05 1
+-0.558456 0.05 0.908456
+
+
+-0.483648 -0.15 1
+-0.539473 -0.15 0.889473
+
+
+-0.512219 0.05 1
+-0.25 0.05 1
+
+
+-0.05 -0.15 0.8
+-0.05 0.05 0.8
+-0.25 0.05 0.8
+-0.25 0.05 1
+-0.25 -0.15 1
+-0.05 -0.15 1
+-0.05 0.05 1
+-0.05 0.05 0.8
+
+
+-0.05 -0.15 0.8
+-0.05 -0.15 1
+
+
+-0.05 -0.15 0.8
+-0.25 -0.15 0.8
+-0.25 0.05 0.8
+
+
+-0.05 0.05 1
+-0.25 0.05 1
+
+
+-0.25 -0.15 1
+-0.25 -0.15 0.8
+
+
+0.15 -0.15 0.8
+0.15 -0.15 1
+0.15 0.05 1
+-0.05 0.05 1
+-0.05 -0.15 1
+0.15 -0.15 1
+
+
+0.15 -0.15 0.8
+-0.05 -0.15 0.8
+-0.05 -0.15 1
+
+
+0.15 -0.15 0.8
+0.15 0.05 0.8
+-0.05 0.05 0.8
+-0.05 -0.15 0.8
+
+
+-0.05 0.05 1
+-0.05 0.05 0.8
+
+
+0.15 0.05 1
+0.15 0.05 0.8
+
+
+0.15 0.05 1
+0.15 -0.15 1
+0.35 -0.15 1
+0.35 0.05 1
+0.35 0.05 0.8
+0.35 -0.15 0.8
+0.15 -0.15 0.8
+0.15 -0.15 1
+
+
+0.15 0.05 1
+0.35 0.05 1
+
+
+0.15 0.05 1
+0.15 0.05 0.8
+0.15 -0.15 0.8
+
+
+0.35 -0.15 0.8
+0.35 -0.15 1
+
+
+0.15 0.05 0.8
+0.35 0.05 0.8
+
+
+0.587026 -0.15 0.8
+0.609248 0.05 0.8
+0.508633 0.05 1
+0.35 0.05 1
+0.35 -0.15 1
+0.48641 -0.15 1
+0.587026 -0.15 0.8
+0.35 -0.15 0.8
+0.35 -0.15 1
+
+
+0.35 0.05 0.8
+0.35 0.05 1
+
+
+0.35 0.05 0.8
+0.609248 0.05 0.8
+
+
+0.35 0.05 0.8
+0.35 -0.15 0.8
+
+
+0.48641 -0.15 1
+0.508633 0.05 1
+
+
+-0.511942 0.25 0.861942
+-0.567457 0.05 0.917457
+-0.522555 0.05 1
+-0.25 0.05 1
+-0.25 0.05 0.8
+-0.25 0.25 0.8
+-0.45 0.25 0.8
+-0.45 0.05 0.8
+-0.567457 0.05 0.917457
+
+
+-0.511942 0.25 0.861942
+-0.436841 0.25 1
+-0.522555 0.05 1
+
+
+-0.511942 0.25 0.861942
+-0.45 0.25 0.8
+
+
+-0.25 0.25 1
+-0.25 0.25 0.8
+
+
+-0.25 0.25 1
+-0.436841 0.25 1
+
+
+-0.25 0.25 1
+-0.25 0.05 1
+
+
+-0.25 0.05 0.8
+-0.45 0.05 0.8
+
+
+-0.05 0.05 0.8
+-0.05 0.25 0.8
+-0.05 0.25 1
+-0.25 0.25 1
+-0.25 0.05 1
+-0.05 0.05 1
+-0.05 0.25 1
+
+
+-0.05 0.05 0.8
+-0.05 0.05 1
+
+
+-0.05 0.05 0.8
+-0.25 0.05 0.8
+-0.25 0.25 0.8
+-0.05 0.25 0.8
+
+
+-0.25 0.05 1
+-0.25 0.05 0.8
+
+
+-0.25 0.25 0.8
+-0.25 0.25 1
+
+
+0.15 0.05 0.8
+-0.05 0.05 0.8
+-0.05 0.05 1
+0.15 0.05 1
+0.15 0.05 0.8
+0.15 0.25 0.8
+-0.05 0.25 0.8
+-0.05 0.05 0.8
+
+
+-0.05 0.25 0.8
+-0.05 0.25 1
+-0.05 0.05 1
+
+
+-0.05 0.25 1
+0.15 0.25 1
+0.15 0.05 1
+
+
+0.15 0.25 1
+0.15 0.25 0.8
+
+
+0.35 0.05 0.8
+0.35 0.25 0.8
+0.35 0.25 1
+0.15 0.25 1
+0.15 0.05 1
+0.35 0.05 1
+0.35 0.05 0.8
+0.15 0.05 0.8
+0.15 0.05 1
+
+
+0.35 0.25 1
+0.35 0.05 1
+
+
+0.35 0.25 0.8
+0.15 0.25 0.8
+0.15 0.05 0.8
+
+
+0.15 0.25 0.8
+0.15 0.25 1
+
+
+0.457033 0.357033 0.907033
+0.35 0.25 0.8
+0.549122 0.25 0.8
+0.457033 0.357033 0.907033
+0.420285 0.320285 1
+0.35 0.25 1
+0.35 0.25 0.8
+0.35 0.05 0.8
+0.615789 0.05 0.8
+0.549122 0.25 0.8
+
+
+0.35 0.25 1
+0.35 0.05 1
+0.51038 0.05 1
+0.615789 0.05 0.8
+
+
+0.35 0.05 1
+0.35 0.05 0.8
+
+
+0.420285 0.320285 1
+0.51038 0.05 1
+
+
+-0.457107 0.25 1
+-0.25 0.25 1
+-0.25 0.25 0.8
+-0.45 0.25 0.8
+-0.524264 0.324264 0.8
+-0.537006 0.25 0.887006
+-0.45 0.25 0.8
+
+
+-0.457107 0.25 1
+-0.25 0.457107 1
+-0.25 0.537006 0.887006
+-0.324264 0.524264 0.8
+-0.25 0.45 0.8
+-0.25 0.537006 0.887006
+
+
+-0.457107 0.25 1
+-0.537006 0.25 0.887006
+
+
+-0.324264 0.524264 0.8
+-0.524264 0.324264 0.8
+
+
+-0.25 0.25 1
+-0.25 0.457107 1
+
+
+-0.25 0.25 0.8
+-0.25 0.45 0.8
+
+
+-0.25 0.436841 1
+-0.25 0.25 1
+-0.05 0.25 1
+-0.05 0.522555 1
+-0.05 0.567457 0.917457
+-0.25 0.511942 0.861942
+-0.25 0.45 0.8
+-0.05 0.45 0.8
+-0.05 0.567457 0.917457
+
+
+-0.25 0.436841 1
+-0.05 0.522555 1
+
+
+-0.25 0.436841 1
+-0.25 0.511942 0.861942
+
+
+-0.25 0.25 1
+-0.25 0.25 0.8
+-0.05 0.25 0.8
+-0.05 0.45 0.8
+
+
+-0.05 0.25 1
+-0.05 0.25 0.8
+
+
+-0.25 0.45 0.8
+-0.25 0.25 0.8
+
+
+0.15 0.25 0.8
+0.15 0.45 0.8
+0.15 0.539473 0.889473
+-0.05 0.558456 0.908456
+-0.05 0.512219 1
+-0.05 0.25 1
+0.15 0.25 1
+0.15 0.483648 1
+0.15 0.539473 0.889473
+
+
+0.15 0.25 0.8
+0.15 0.25 1
+
+
+0.15 0.25 0.8
+-0.05 0.25 0.8
+-0.05 0.25 1
+
+
+0.15 0.45 0.8
+-0.05 0.45 0.8
+-0.05 0.558456 0.908456
+
+
+-0.05 0.512219 1
+0.15 0.483648 1
+
+
+-0.05 0.45 0.8
+-0.05 0.25 0.8
+
+
+0.35 0.25 0.8
+0.15 0.25 0.8
+0.15 0.25 1
+0.35 0.25 1
+0.416764 0.316764 1
+0.451919 0.351919 0.901919
+0.366035 0.466035 0.816035
+0.15 0.561616 0.911616
+0.15 0.45 0.8
+0.35 0.45 0.8
+0.366035 0.466035 0.816035
+
+
+0.35 0.25 0.8
+0.35 0.45 0.8
+
+
+0.35 0.25 0.8
+0.451919 0.351919 0.901919
+
+
+0.35 0.25 0.8
+0.35 0.25 1
+
+
+0.15 0.561616 0.911616
+0.15 0.507309 1
+0.15 0.25 1
+
+
+0.15 0.507309 1
+0.416764 0.316764 1
+
+
+0.15 0.25 0.8
+0.15 0.45 0.8
+
+
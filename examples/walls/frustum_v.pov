@@ -0,0 +1,5011 @@
+// cell 0
+sphere{<-0.25,-0.75,0>,r}
+sphere{<-0.25,-0.828126,0.278126>,r}
+sphere{<-0.25,-0.978516,0>,r}
+cylinder{<-0.25,-0.978516,0>,<-0.25,-0.828126,0.278126>,r}
+cylinder{<-0.25,-0.978516,0>,<-0.25,-0.75,0>,r}
+sphere{<-0.469471,-0.769471,0.219471>,r}
+cylinder{<-0.469471,-0.769471,0.219471>,<-0.25,-0.828126,0.278126>,r}
+sphere{<-0.45,-0.75,0>,r}
+cylinder{<-0.45,-0.75,0>,<-0.25,-0.75,0>,r}
+sphere{<-0.553532,-0.853532,0>,r}
+cylinder{<-0.553532,-0.853532,0>,<-0.45,-0.75,0>,r}
+cylinder{<-0.553532,-0.853532,0>,<-0.25,-0.978516,0>,r}
+cylinder{<-0.553532,-0.853532,0>,<-0.469471,-0.769471,0.219471>,r}
+sphere{<-0.25,-0.75,0.2>,r}
+cylinder{<-0.25,-0.75,0.2>,<-0.25,-0.828126,0.278126>,r}
+cylinder{<-0.25,-0.75,0.2>,<-0.25,-0.75,0>,r}
+sphere{<-0.45,-0.75,0.2>,r}
+cylinder{<-0.45,-0.75,0.2>,<-0.25,-0.75,0.2>,r}
+cylinder{<-0.45,-0.75,0.2>,<-0.45,-0.75,0>,r}
+cylinder{<-0.45,-0.75,0.2>,<-0.469471,-0.769471,0.219471>,r}
+// cell 1
+sphere{<-0.25,-0.75,0>,r}
+sphere{<-0.05,-0.75,0.2>,r}
+sphere{<-0.05,-1.00663,0>,r}
+sphere{<-0.05,-0.75,0>,r}
+cylinder{<-0.05,-0.75,0>,<-0.05,-0.75,0.2>,r}
+cylinder{<-0.05,-0.75,0>,<-0.05,-1.00663,0>,r}
+cylinder{<-0.05,-0.75,0>,<-0.25,-0.75,0>,r}
+sphere{<-0.05,-0.852859,0.302859>,r}
+cylinder{<-0.05,-0.852859,0.302859>,<-0.05,-1.00663,0>,r}
+cylinder{<-0.05,-0.852859,0.302859>,<-0.05,-0.75,0.2>,r}
+sphere{<-0.25,-0.971334,0>,r}
+cylinder{<-0.25,-0.971334,0>,<-0.25,-0.75,0>,r}
+cylinder{<-0.25,-0.971334,0>,<-0.05,-1.00663,0>,r}
+sphere{<-0.25,-0.75,0.2>,r}
+cylinder{<-0.25,-0.75,0.2>,<-0.05,-0.75,0.2>,r}
+cylinder{<-0.25,-0.75,0.2>,<-0.25,-0.75,0>,r}
+sphere{<-0.25,-0.82945,0.27945>,r}
+cylinder{<-0.25,-0.82945,0.27945>,<-0.25,-0.971334,0>,r}
+cylinder{<-0.25,-0.82945,0.27945>,<-0.05,-0.852859,0.302859>,r}
+cylinder{<-0.25,-0.82945,0.27945>,<-0.25,-0.75,0.2>,r}
+// cell 2
+sphere{<-0.05,-1.00467,0>,r}
+sphere{<0.15,-0.992905,0>,r}
+cylinder{<0.15,-0.992905,0>,<-0.05,-1.00467,0>,r}
+sphere{<0.15,-0.75,0.2>,r}
+sphere{<0.15,-0.75,0>,r}
+cylinder{<0.15,-0.75,0>,<0.15,-0.992905,0>,r}
+cylinder{<0.15,-0.75,0>,<0.15,-0.75,0.2>,r}
+sphere{<-0.05,-0.75,0>,r}
+cylinder{<-0.05,-0.75,0>,<0.15,-0.75,0>,r}
+cylinder{<-0.05,-0.75,0>,<-0.05,-1.00467,0>,r}
+sphere{<0.15,-0.8451,0.2951>,r}
+cylinder{<0.15,-0.8451,0.2951>,<0.15,-0.992905,0>,r}
+cylinder{<0.15,-0.8451,0.2951>,<0.15,-0.75,0.2>,r}
+sphere{<-0.05,-0.75,0.2>,r}
+cylinder{<-0.05,-0.75,0.2>,<0.15,-0.75,0.2>,r}
+cylinder{<-0.05,-0.75,0.2>,<-0.05,-0.75,0>,r}
+sphere{<-0.05,-0.852939,0.302939>,r}
+cylinder{<-0.05,-0.852939,0.302939>,<-0.05,-1.00467,0>,r}
+cylinder{<-0.05,-0.852939,0.302939>,<0.15,-0.8451,0.2951>,r}
+cylinder{<-0.05,-0.852939,0.302939>,<-0.05,-0.75,0.2>,r}
+// cell 3
+sphere{<0.15,-0.75,0>,r}
+sphere{<0.35,-0.75,0>,r}
+cylinder{<0.35,-0.75,0>,<0.15,-0.75,0>,r}
+sphere{<0.15,-0.998238,0>,r}
+cylinder{<0.15,-0.998238,0>,<0.15,-0.75,0>,r}
+sphere{<0.41582,-0.81582,0.2>,r}
+sphere{<0.35,-0.75,0.2>,r}
+cylinder{<0.35,-0.75,0.2>,<0.41582,-0.81582,0.2>,r}
+cylinder{<0.35,-0.75,0.2>,<0.35,-0.75,0>,r}
+sphere{<0.496366,-0.896366,0>,r}
+cylinder{<0.496366,-0.896366,0>,<0.41582,-0.81582,0.2>,r}
+cylinder{<0.496366,-0.896366,0>,<0.15,-0.998238,0>,r}
+cylinder{<0.496366,-0.896366,0>,<0.35,-0.75,0>,r}
+sphere{<0.15,-0.75,0.2>,r}
+cylinder{<0.15,-0.75,0.2>,<0.35,-0.75,0.2>,r}
+cylinder{<0.15,-0.75,0.2>,<0.15,-0.75,0>,r}
+sphere{<0.15,-0.844665,0.294665>,r}
+cylinder{<0.15,-0.844665,0.294665>,<0.15,-0.998238,0>,r}
+cylinder{<0.15,-0.844665,0.294665>,<0.15,-0.75,0.2>,r}
+sphere{<0.35,-0.805995,0.255995>,r}
+cylinder{<0.35,-0.805995,0.255995>,<0.35,-0.75,0.2>,r}
+cylinder{<0.35,-0.805995,0.255995>,<0.15,-0.844665,0.294665>,r}
+cylinder{<0.35,-0.805995,0.255995>,<0.41582,-0.81582,0.2>,r}
+// cell 4
+sphere{<-0.45,-0.55,0>,r}
+sphere{<-0.681569,-0.581569,0.231569>,r}
+sphere{<-0.547058,-0.847058,0>,r}
+sphere{<-0.45,-0.75,0>,r}
+cylinder{<-0.45,-0.75,0>,<-0.547058,-0.847058,0>,r}
+cylinder{<-0.45,-0.75,0>,<-0.45,-0.55,0>,r}
+sphere{<-0.469267,-0.769267,0.219267>,r}
+cylinder{<-0.469267,-0.769267,0.219267>,<-0.547058,-0.847058,0>,r}
+sphere{<-0.45,-0.75,0.2>,r}
+cylinder{<-0.45,-0.75,0.2>,<-0.469267,-0.769267,0.219267>,r}
+cylinder{<-0.45,-0.75,0.2>,<-0.45,-0.75,0>,r}
+sphere{<-0.65,-0.55,0>,r}
+cylinder{<-0.65,-0.55,0>,<-0.45,-0.55,0>,r}
+sphere{<-0.763724,-0.663724,0>,r}
+cylinder{<-0.763724,-0.663724,0>,<-0.65,-0.55,0>,r}
+cylinder{<-0.763724,-0.663724,0>,<-0.547058,-0.847058,0>,r}
+cylinder{<-0.763724,-0.663724,0>,<-0.681569,-0.581569,0.231569>,r}
+sphere{<-0.54923,-0.64923,0.29923>,r}
+cylinder{<-0.54923,-0.64923,0.29923>,<-0.681569,-0.581569,0.231569>,r}
+cylinder{<-0.54923,-0.64923,0.29923>,<-0.469267,-0.769267,0.219267>,r}
+sphere{<-0.65,-0.55,0.2>,r}
+cylinder{<-0.65,-0.55,0.2>,<-0.65,-0.55,0>,r}
+cylinder{<-0.65,-0.55,0.2>,<-0.681569,-0.581569,0.231569>,r}
+sphere{<-0.45,-0.55,0.2>,r}
+cylinder{<-0.45,-0.55,0.2>,<-0.54923,-0.64923,0.29923>,r}
+cylinder{<-0.45,-0.55,0.2>,<-0.45,-0.75,0.2>,r}
+cylinder{<-0.45,-0.55,0.2>,<-0.45,-0.55,0>,r}
+cylinder{<-0.45,-0.55,0.2>,<-0.65,-0.55,0.2>,r}
+// cell 5
+sphere{<-0.45,-0.55,0>,r}
+sphere{<-0.25,-0.75,0>,r}
+sphere{<-0.45,-0.75,0.2>,r}
+sphere{<-0.45,-0.55,0.2>,r}
+cylinder{<-0.45,-0.55,0.2>,<-0.45,-0.55,0>,r}
+cylinder{<-0.45,-0.55,0.2>,<-0.45,-0.75,0.2>,r}
+sphere{<-0.45,-0.75,0>,r}
+cylinder{<-0.45,-0.75,0>,<-0.45,-0.55,0>,r}
+cylinder{<-0.45,-0.75,0>,<-0.25,-0.75,0>,r}
+cylinder{<-0.45,-0.75,0>,<-0.45,-0.75,0.2>,r}
+sphere{<-0.25,-0.75,0.2>,r}
+cylinder{<-0.25,-0.75,0.2>,<-0.45,-0.75,0.2>,r}
+cylinder{<-0.25,-0.75,0.2>,<-0.25,-0.75,0>,r}
+sphere{<-0.25,-0.55,0.2>,r}
+cylinder{<-0.25,-0.55,0.2>,<-0.25,-0.75,0.2>,r}
+cylinder{<-0.25,-0.55,0.2>,<-0.45,-0.55,0.2>,r}
+sphere{<-0.25,-0.55,0>,r}
+cylinder{<-0.25,-0.55,0>,<-0.25,-0.55,0.2>,r}
+cylinder{<-0.25,-0.55,0>,<-0.25,-0.75,0>,r}
+cylinder{<-0.25,-0.55,0>,<-0.45,-0.55,0>,r}
+// cell 6
+sphere{<-0.05,-0.55,0.2>,r}
+sphere{<-0.05,-0.75,0.2>,r}
+cylinder{<-0.05,-0.75,0.2>,<-0.05,-0.55,0.2>,r}
+sphere{<-0.25,-0.55,0>,r}
+sphere{<-0.05,-0.75,0>,r}
+cylinder{<-0.05,-0.75,0>,<-0.05,-0.75,0.2>,r}
+sphere{<-0.25,-0.75,0.2>,r}
+cylinder{<-0.25,-0.75,0.2>,<-0.05,-0.75,0.2>,r}
+sphere{<-0.25,-0.75,0>,r}
+cylinder{<-0.25,-0.75,0>,<-0.25,-0.55,0>,r}
+cylinder{<-0.25,-0.75,0>,<-0.05,-0.75,0>,r}
+cylinder{<-0.25,-0.75,0>,<-0.25,-0.75,0.2>,r}
+sphere{<-0.25,-0.55,0.2>,r}
+cylinder{<-0.25,-0.55,0.2>,<-0.05,-0.55,0.2>,r}
+cylinder{<-0.25,-0.55,0.2>,<-0.25,-0.55,0>,r}
+cylinder{<-0.25,-0.55,0.2>,<-0.25,-0.75,0.2>,r}
+sphere{<-0.05,-0.55,0>,r}
+cylinder{<-0.05,-0.55,0>,<-0.05,-0.75,0>,r}
+cylinder{<-0.05,-0.55,0>,<-0.25,-0.55,0>,r}
+cylinder{<-0.05,-0.55,0>,<-0.05,-0.55,0.2>,r}
+// cell 7
+sphere{<0.15,-0.75,0>,r}
+sphere{<0.15,-0.75,0.2>,r}
+cylinder{<0.15,-0.75,0.2>,<0.15,-0.75,0>,r}
+sphere{<0.15,-0.55,0>,r}
+cylinder{<0.15,-0.55,0>,<0.15,-0.75,0>,r}
+sphere{<0.15,-0.55,0.2>,r}
+cylinder{<0.15,-0.55,0.2>,<0.15,-0.75,0.2>,r}
+cylinder{<0.15,-0.55,0.2>,<0.15,-0.55,0>,r}
+sphere{<-0.05,-0.55,0.2>,r}
+cylinder{<-0.05,-0.55,0.2>,<0.15,-0.55,0.2>,r}
+sphere{<-0.05,-0.75,0.2>,r}
+cylinder{<-0.05,-0.75,0.2>,<-0.05,-0.55,0.2>,r}
+cylinder{<-0.05,-0.75,0.2>,<0.15,-0.75,0.2>,r}
+sphere{<-0.05,-0.55,0>,r}
+cylinder{<-0.05,-0.55,0>,<0.15,-0.55,0>,r}
+cylinder{<-0.05,-0.55,0>,<-0.05,-0.55,0.2>,r}
+sphere{<-0.05,-0.75,0>,r}
+cylinder{<-0.05,-0.75,0>,<-0.05,-0.75,0.2>,r}
+cylinder{<-0.05,-0.75,0>,<-0.05,-0.55,0>,r}
+cylinder{<-0.05,-0.75,0>,<0.15,-0.75,0>,r}
+// cell 8
+sphere{<0.15,-0.75,0>,r}
+sphere{<0.35,-0.75,0.2>,r}
+sphere{<0.15,-0.55,0>,r}
+cylinder{<0.15,-0.55,0>,<0.15,-0.75,0>,r}
+sphere{<0.15,-0.55,0.2>,r}
+cylinder{<0.15,-0.55,0.2>,<0.15,-0.55,0>,r}
+sphere{<0.35,-0.75,0>,r}
+cylinder{<0.35,-0.75,0>,<0.35,-0.75,0.2>,r}
+cylinder{<0.35,-0.75,0>,<0.15,-0.75,0>,r}
+sphere{<0.15,-0.75,0.2>,r}
+cylinder{<0.15,-0.75,0.2>,<0.15,-0.55,0.2>,r}
+cylinder{<0.15,-0.75,0.2>,<0.15,-0.75,0>,r}
+cylinder{<0.15,-0.75,0.2>,<0.35,-0.75,0.2>,r}
+sphere{<0.35,-0.55,0>,r}
+cylinder{<0.35,-0.55,0>,<0.35,-0.75,0>,r}
+cylinder{<0.35,-0.55,0>,<0.15,-0.55,0>,r}
+sphere{<0.35,-0.55,0.2>,r}
+cylinder{<0.35,-0.55,0.2>,<0.35,-0.75,0.2>,r}
+cylinder{<0.35,-0.55,0.2>,<0.35,-0.55,0>,r}
+cylinder{<0.35,-0.55,0.2>,<0.15,-0.55,0.2>,r}
+// cell 9
+sphere{<0.35,-0.75,-1.38778e-17>,r}
+sphere{<0.55,-0.55,0.2>,r}
+sphere{<0.482336,-0.882336,0>,r}
+cylinder{<0.482336,-0.882336,0>,<0.35,-0.75,-1.38778e-17>,r}
+sphere{<0.55,-0.55,0>,r}
+cylinder{<0.55,-0.55,0>,<0.55,-0.55,0.2>,r}
+sphere{<0.55,-0.713865,0.2>,r}
+cylinder{<0.55,-0.713865,0.2>,<0.55,-0.55,0.2>,r}
+sphere{<0.55,-0.835491,0>,r}
+cylinder{<0.55,-0.835491,0>,<0.55,-0.713865,0.2>,r}
+cylinder{<0.55,-0.835491,0>,<0.482336,-0.882336,0>,r}
+cylinder{<0.55,-0.835491,0>,<0.55,-0.55,0>,r}
+sphere{<0.35,-0.55,-1.38778e-17>,r}
+cylinder{<0.35,-0.55,-1.38778e-17>,<0.55,-0.55,0>,r}
+cylinder{<0.35,-0.55,-1.38778e-17>,<0.35,-0.75,-1.38778e-17>,r}
+sphere{<0.35,-0.55,0.2>,r}
+cylinder{<0.35,-0.55,0.2>,<0.55,-0.55,0.2>,r}
+cylinder{<0.35,-0.55,0.2>,<0.35,-0.55,-1.38778e-17>,r}
+sphere{<0.35,-0.75,0.2>,r}
+cylinder{<0.35,-0.75,0.2>,<0.35,-0.55,0.2>,r}
+cylinder{<0.35,-0.75,0.2>,<0.35,-0.75,-1.38778e-17>,r}
+sphere{<0.410466,-0.810466,0.2>,r}
+cylinder{<0.410466,-0.810466,0.2>,<0.35,-0.75,0.2>,r}
+cylinder{<0.410466,-0.810466,0.2>,<0.482336,-0.882336,0>,r}
+cylinder{<0.410466,-0.810466,0.2>,<0.55,-0.713865,0.2>,r}
+// cell 10
+sphere{<0.864214,-0.55,0>,r}
+sphere{<0.55,-0.55,0>,r}
+cylinder{<0.55,-0.55,0>,<0.864214,-0.55,0>,r}
+sphere{<0.55,-0.55,0.2>,r}
+cylinder{<0.55,-0.55,0.2>,<0.55,-0.55,0>,r}
+sphere{<0.55,-0.864214,0>,r}
+cylinder{<0.55,-0.864214,0>,<0.55,-0.55,0>,r}
+cylinder{<0.55,-0.864214,0>,<0.864214,-0.55,0>,r}
+sphere{<0.722792,-0.55,0.2>,r}
+cylinder{<0.722792,-0.55,0.2>,<0.864214,-0.55,0>,r}
+cylinder{<0.722792,-0.55,0.2>,<0.55,-0.55,0.2>,r}
+sphere{<0.55,-0.722792,0.2>,r}
+cylinder{<0.55,-0.722792,0.2>,<0.55,-0.55,0.2>,r}
+cylinder{<0.55,-0.722792,0.2>,<0.55,-0.864214,0>,r}
+sphere{<0.613829,-0.613829,0.263829>,r}
+cylinder{<0.613829,-0.613829,0.263829>,<0.55,-0.722792,0.2>,r}
+cylinder{<0.613829,-0.613829,0.263829>,<0.722792,-0.55,0.2>,r}
+cylinder{<0.613829,-0.613829,0.263829>,<0.55,-0.55,0.2>,r}
+// cell 11
+sphere{<-0.65,-0.35,0>,r}
+sphere{<-0.95619,-0.35,0>,r}
+cylinder{<-0.95619,-0.35,0>,<-0.65,-0.35,0>,r}
+sphere{<-0.766369,-0.666369,0>,r}
+cylinder{<-0.766369,-0.666369,0>,<-0.95619,-0.35,0>,r}
+sphere{<-0.65,-0.55,0>,r}
+cylinder{<-0.65,-0.55,0>,<-0.766369,-0.666369,0>,r}
+cylinder{<-0.65,-0.55,0>,<-0.65,-0.35,0>,r}
+sphere{<-0.681868,-0.581868,0.231868>,r}
+cylinder{<-0.681868,-0.581868,0.231868>,<-0.766369,-0.666369,0>,r}
+sphere{<-0.65,-0.55,0.2>,r}
+cylinder{<-0.65,-0.55,0.2>,<-0.681868,-0.581868,0.231868>,r}
+cylinder{<-0.65,-0.55,0.2>,<-0.65,-0.55,0>,r}
+sphere{<-0.736836,-0.436836,0.286836>,r}
+cylinder{<-0.736836,-0.436836,0.286836>,<-0.681868,-0.581868,0.231868>,r}
+sphere{<-0.839571,-0.35,0.2>,r}
+cylinder{<-0.839571,-0.35,0.2>,<-0.95619,-0.35,0>,r}
+cylinder{<-0.839571,-0.35,0.2>,<-0.736836,-0.436836,0.286836>,r}
+sphere{<-0.65,-0.35,0.2>,r}
+cylinder{<-0.65,-0.35,0.2>,<-0.736836,-0.436836,0.286836>,r}
+cylinder{<-0.65,-0.35,0.2>,<-0.65,-0.55,0.2>,r}
+cylinder{<-0.65,-0.35,0.2>,<-0.65,-0.35,0>,r}
+cylinder{<-0.65,-0.35,0.2>,<-0.839571,-0.35,0.2>,r}
+// cell 12
+sphere{<-0.45,-0.35,0>,r}
+sphere{<-0.65,-0.55,0.2>,r}
+sphere{<-0.65,-0.35,0.2>,r}
+cylinder{<-0.65,-0.35,0.2>,<-0.65,-0.55,0.2>,r}
+sphere{<-0.45,-0.55,0>,r}
+cylinder{<-0.45,-0.55,0>,<-0.45,-0.35,0>,r}
+sphere{<-0.45,-0.35,0.2>,r}
+cylinder{<-0.45,-0.35,0.2>,<-0.65,-0.35,0.2>,r}
+cylinder{<-0.45,-0.35,0.2>,<-0.45,-0.35,0>,r}
+sphere{<-0.45,-0.55,0.2>,r}
+cylinder{<-0.45,-0.55,0.2>,<-0.65,-0.55,0.2>,r}
+cylinder{<-0.45,-0.55,0.2>,<-0.45,-0.55,0>,r}
+cylinder{<-0.45,-0.55,0.2>,<-0.45,-0.35,0.2>,r}
+sphere{<-0.65,-0.35,0>,r}
+cylinder{<-0.65,-0.35,0>,<-0.45,-0.35,0>,r}
+cylinder{<-0.65,-0.35,0>,<-0.65,-0.35,0.2>,r}
+sphere{<-0.65,-0.55,0>,r}
+cylinder{<-0.65,-0.55,0>,<-0.65,-0.35,0>,r}
+cylinder{<-0.65,-0.55,0>,<-0.45,-0.55,0>,r}
+cylinder{<-0.65,-0.55,0>,<-0.65,-0.55,0.2>,r}
+// cell 13
+sphere{<-0.45,-0.35,0>,r}
+sphere{<-0.25,-0.55,0>,r}
+sphere{<-0.25,-0.35,0>,r}
+cylinder{<-0.25,-0.35,0>,<-0.25,-0.55,0>,r}
+cylinder{<-0.25,-0.35,0>,<-0.45,-0.35,0>,r}
+sphere{<-0.25,-0.55,0.2>,r}
+cylinder{<-0.25,-0.55,0.2>,<-0.25,-0.55,0>,r}
+sphere{<-0.45,-0.55,0>,r}
+cylinder{<-0.45,-0.55,0>,<-0.45,-0.35,0>,r}
+cylinder{<-0.45,-0.55,0>,<-0.25,-0.55,0>,r}
+sphere{<-0.45,-0.55,0.2>,r}
+cylinder{<-0.45,-0.55,0.2>,<-0.45,-0.55,0>,r}
+cylinder{<-0.45,-0.55,0.2>,<-0.25,-0.55,0.2>,r}
+sphere{<-0.45,-0.35,0.2>,r}
+cylinder{<-0.45,-0.35,0.2>,<-0.45,-0.55,0.2>,r}
+cylinder{<-0.45,-0.35,0.2>,<-0.45,-0.35,0>,r}
+sphere{<-0.25,-0.35,0.2>,r}
+cylinder{<-0.25,-0.35,0.2>,<-0.25,-0.55,0.2>,r}
+cylinder{<-0.25,-0.35,0.2>,<-0.25,-0.35,0>,r}
+cylinder{<-0.25,-0.35,0.2>,<-0.45,-0.35,0.2>,r}
+// cell 14
+sphere{<-0.25,-0.55,0.2>,r}
+sphere{<-0.05,-0.55,0>,r}
+sphere{<-0.25,-0.35,0>,r}
+sphere{<-0.05,-0.35,0>,r}
+cylinder{<-0.05,-0.35,0>,<-0.05,-0.55,0>,r}
+cylinder{<-0.05,-0.35,0>,<-0.25,-0.35,0>,r}
+sphere{<-0.05,-0.35,0.2>,r}
+cylinder{<-0.05,-0.35,0.2>,<-0.05,-0.35,0>,r}
+sphere{<-0.25,-0.55,0>,r}
+cylinder{<-0.25,-0.55,0>,<-0.25,-0.55,0.2>,r}
+cylinder{<-0.25,-0.55,0>,<-0.25,-0.35,0>,r}
+cylinder{<-0.25,-0.55,0>,<-0.05,-0.55,0>,r}
+sphere{<-0.25,-0.35,0.2>,r}
+cylinder{<-0.25,-0.35,0.2>,<-0.05,-0.35,0.2>,r}
+cylinder{<-0.25,-0.35,0.2>,<-0.25,-0.35,0>,r}
+cylinder{<-0.25,-0.35,0.2>,<-0.25,-0.55,0.2>,r}
+sphere{<-0.05,-0.55,0.2>,r}
+cylinder{<-0.05,-0.55,0.2>,<-0.05,-0.35,0.2>,r}
+cylinder{<-0.05,-0.55,0.2>,<-0.25,-0.55,0.2>,r}
+cylinder{<-0.05,-0.55,0.2>,<-0.05,-0.55,0>,r}
+// cell 15
+sphere{<-0.05,-0.55,0>,r}
+sphere{<-0.05,-0.55,0.2>,r}
+cylinder{<-0.05,-0.55,0.2>,<-0.05,-0.55,0>,r}
+sphere{<-0.05,-0.35,0>,r}
+cylinder{<-0.05,-0.35,0>,<-0.05,-0.55,0>,r}
+sphere{<0.15,-0.35,0>,r}
+cylinder{<0.15,-0.35,0>,<-0.05,-0.35,0>,r}
+sphere{<-0.05,-0.35,0.2>,r}
+cylinder{<-0.05,-0.35,0.2>,<-0.05,-0.35,0>,r}
+cylinder{<-0.05,-0.35,0.2>,<-0.05,-0.55,0.2>,r}
+sphere{<0.15,-0.55,0>,r}
+cylinder{<0.15,-0.55,0>,<-0.05,-0.55,0>,r}
+cylinder{<0.15,-0.55,0>,<0.15,-0.35,0>,r}
+sphere{<0.15,-0.35,0.2>,r}
+cylinder{<0.15,-0.35,0.2>,<0.15,-0.35,0>,r}
+cylinder{<0.15,-0.35,0.2>,<-0.05,-0.35,0.2>,r}
+sphere{<0.15,-0.55,0.2>,r}
+cylinder{<0.15,-0.55,0.2>,<0.15,-0.35,0.2>,r}
+cylinder{<0.15,-0.55,0.2>,<-0.05,-0.55,0.2>,r}
+cylinder{<0.15,-0.55,0.2>,<0.15,-0.55,0>,r}
+// cell 16
+sphere{<0.15,-0.55,0>,r}
+sphere{<0.15,-0.55,0.2>,r}
+cylinder{<0.15,-0.55,0.2>,<0.15,-0.55,0>,r}
+sphere{<0.35,-0.35,0.2>,r}
+sphere{<0.35,-0.35,0>,r}
+cylinder{<0.35,-0.35,0>,<0.35,-0.35,0.2>,r}
+sphere{<0.35,-0.55,0>,r}
+cylinder{<0.35,-0.55,0>,<0.15,-0.55,0>,r}
+cylinder{<0.35,-0.55,0>,<0.35,-0.35,0>,r}
+sphere{<0.15,-0.35,0.2>,r}
+cylinder{<0.15,-0.35,0.2>,<0.35,-0.35,0.2>,r}
+cylinder{<0.15,-0.35,0.2>,<0.15,-0.55,0.2>,r}
+sphere{<0.15,-0.35,0>,r}
+cylinder{<0.15,-0.35,0>,<0.15,-0.35,0.2>,r}
+cylinder{<0.15,-0.35,0>,<0.35,-0.35,0>,r}
+cylinder{<0.15,-0.35,0>,<0.15,-0.55,0>,r}
+sphere{<0.35,-0.55,0.2>,r}
+cylinder{<0.35,-0.55,0.2>,<0.35,-0.35,0.2>,r}
+cylinder{<0.35,-0.55,0.2>,<0.15,-0.55,0.2>,r}
+cylinder{<0.35,-0.55,0.2>,<0.35,-0.55,0>,r}
+// cell 17
+sphere{<0.35,-0.55,0>,r}
+sphere{<0.55,-0.35,0>,r}
+sphere{<0.55,-0.35,0.2>,r}
+cylinder{<0.55,-0.35,0.2>,<0.55,-0.35,0>,r}
+sphere{<0.55,-0.55,0.2>,r}
+cylinder{<0.55,-0.55,0.2>,<0.55,-0.35,0.2>,r}
+sphere{<0.55,-0.55,0>,r}
+cylinder{<0.55,-0.55,0>,<0.55,-0.55,0.2>,r}
+cylinder{<0.55,-0.55,0>,<0.35,-0.55,0>,r}
+cylinder{<0.55,-0.55,0>,<0.55,-0.35,0>,r}
+sphere{<0.35,-0.35,0.2>,r}
+cylinder{<0.35,-0.35,0.2>,<0.55,-0.35,0.2>,r}
+sphere{<0.35,-0.35,0>,r}
+cylinder{<0.35,-0.35,0>,<0.55,-0.35,0>,r}
+cylinder{<0.35,-0.35,0>,<0.35,-0.55,0>,r}
+cylinder{<0.35,-0.35,0>,<0.35,-0.35,0.2>,r}
+sphere{<0.35,-0.55,0.2>,r}
+cylinder{<0.35,-0.55,0.2>,<0.35,-0.35,0.2>,r}
+cylinder{<0.35,-0.55,0.2>,<0.35,-0.55,0>,r}
+cylinder{<0.35,-0.55,0.2>,<0.55,-0.55,0.2>,r}
+// cell 18
+sphere{<0.75,-0.35,0>,r}
+sphere{<0.713865,-0.55,0.2>,r}
+sphere{<0.835491,-0.55,0>,r}
+cylinder{<0.835491,-0.55,0>,<0.713865,-0.55,0.2>,r}
+sphere{<0.882336,-0.482336,0>,r}
+cylinder{<0.882336,-0.482336,0>,<0.835491,-0.55,0>,r}
+cylinder{<0.882336,-0.482336,0>,<0.75,-0.35,0>,r}
+sphere{<0.55,-0.55,0.2>,r}
+cylinder{<0.55,-0.55,0.2>,<0.713865,-0.55,0.2>,r}
+sphere{<0.55,-0.55,0>,r}
+cylinder{<0.55,-0.55,0>,<0.55,-0.55,0.2>,r}
+cylinder{<0.55,-0.55,0>,<0.835491,-0.55,0>,r}
+sphere{<0.810466,-0.410466,0.2>,r}
+cylinder{<0.810466,-0.410466,0.2>,<0.713865,-0.55,0.2>,r}
+cylinder{<0.810466,-0.410466,0.2>,<0.882336,-0.482336,0>,r}
+sphere{<0.55,-0.35,0>,r}
+cylinder{<0.55,-0.35,0>,<0.75,-0.35,0>,r}
+cylinder{<0.55,-0.35,0>,<0.55,-0.55,0>,r}
+sphere{<0.75,-0.35,0.2>,r}
+cylinder{<0.75,-0.35,0.2>,<0.810466,-0.410466,0.2>,r}
+cylinder{<0.75,-0.35,0.2>,<0.75,-0.35,0>,r}
+sphere{<0.55,-0.35,0.2>,r}
+cylinder{<0.55,-0.35,0.2>,<0.55,-0.55,0.2>,r}
+cylinder{<0.55,-0.35,0.2>,<0.75,-0.35,0.2>,r}
+cylinder{<0.55,-0.35,0.2>,<0.55,-0.35,0>,r}
+// cell 19
+sphere{<-1.00409,-0.15,0>,r}
+sphere{<-0.65,-0.35,0>,r}
+sphere{<-0.937426,-0.35,0>,r}
+cylinder{<-0.937426,-0.35,0>,<-1.00409,-0.15,0>,r}
+cylinder{<-0.937426,-0.35,0>,<-0.65,-0.35,0>,r}
+sphere{<-0.65,-0.35,0.2>,r}
+cylinder{<-0.65,-0.35,0.2>,<-0.65,-0.35,0>,r}
+sphere{<-0.65,-0.15,0>,r}
+cylinder{<-0.65,-0.15,0>,<-0.65,-0.35,0>,r}
+cylinder{<-0.65,-0.15,0>,<-1.00409,-0.15,0>,r}
+sphere{<-0.65,-0.15,0.2>,r}
+cylinder{<-0.65,-0.15,0.2>,<-0.65,-0.35,0.2>,r}
+cylinder{<-0.65,-0.15,0.2>,<-0.65,-0.15,0>,r}
+sphere{<-0.898683,-0.15,0.2>,r}
+cylinder{<-0.898683,-0.15,0.2>,<-1.00409,-0.15,0>,r}
+cylinder{<-0.898683,-0.15,0.2>,<-0.65,-0.15,0.2>,r}
+sphere{<-0.832017,-0.35,0.2>,r}
+cylinder{<-0.832017,-0.35,0.2>,<-0.898683,-0.15,0.2>,r}
+cylinder{<-0.832017,-0.35,0.2>,<-0.937426,-0.35,0>,r}
+cylinder{<-0.832017,-0.35,0.2>,<-0.65,-0.35,0.2>,r}
+// cell 20
+sphere{<-0.65,-0.15,0>,r}
+sphere{<-0.45,-0.35,0>,r}
+sphere{<-0.45,-0.35,0.2>,r}
+cylinder{<-0.45,-0.35,0.2>,<-0.45,-0.35,0>,r}
+sphere{<-0.45,-0.15,0.2>,r}
+cylinder{<-0.45,-0.15,0.2>,<-0.45,-0.35,0.2>,r}
+sphere{<-0.65,-0.35,0>,r}
+cylinder{<-0.65,-0.35,0>,<-0.65,-0.15,0>,r}
+cylinder{<-0.65,-0.35,0>,<-0.45,-0.35,0>,r}
+sphere{<-0.65,-0.15,0.2>,r}
+cylinder{<-0.65,-0.15,0.2>,<-0.45,-0.15,0.2>,r}
+cylinder{<-0.65,-0.15,0.2>,<-0.65,-0.15,0>,r}
+sphere{<-0.45,-0.15,0>,r}
+cylinder{<-0.45,-0.15,0>,<-0.45,-0.15,0.2>,r}
+cylinder{<-0.45,-0.15,0>,<-0.45,-0.35,0>,r}
+cylinder{<-0.45,-0.15,0>,<-0.65,-0.15,0>,r}
+sphere{<-0.65,-0.35,0.2>,r}
+cylinder{<-0.65,-0.35,0.2>,<-0.65,-0.35,0>,r}
+cylinder{<-0.65,-0.35,0.2>,<-0.45,-0.35,0.2>,r}
+cylinder{<-0.65,-0.35,0.2>,<-0.65,-0.15,0.2>,r}
+// cell 21
+sphere{<-0.45,-0.15,0.2>,r}
+sphere{<-0.25,-0.35,0>,r}
+sphere{<-0.25,-0.15,0>,r}
+cylinder{<-0.25,-0.15,0>,<-0.25,-0.35,0>,r}
+sphere{<-0.25,-0.15,0.2>,r}
+cylinder{<-0.25,-0.15,0.2>,<-0.25,-0.15,0>,r}
+cylinder{<-0.25,-0.15,0.2>,<-0.45,-0.15,0.2>,r}
+sphere{<-0.45,-0.15,0>,r}
+cylinder{<-0.45,-0.15,0>,<-0.25,-0.15,0>,r}
+cylinder{<-0.45,-0.15,0>,<-0.45,-0.15,0.2>,r}
+sphere{<-0.25,-0.35,0.2>,r}
+cylinder{<-0.25,-0.35,0.2>,<-0.25,-0.15,0.2>,r}
+cylinder{<-0.25,-0.35,0.2>,<-0.25,-0.35,0>,r}
+sphere{<-0.45,-0.35,0.2>,r}
+cylinder{<-0.45,-0.35,0.2>,<-0.25,-0.35,0.2>,r}
+cylinder{<-0.45,-0.35,0.2>,<-0.45,-0.15,0.2>,r}
+sphere{<-0.45,-0.35,0>,r}
+cylinder{<-0.45,-0.35,0>,<-0.45,-0.35,0.2>,r}
+cylinder{<-0.45,-0.35,0>,<-0.45,-0.15,0>,r}
+cylinder{<-0.45,-0.35,0>,<-0.25,-0.35,0>,r}
+// cell 22
+sphere{<-0.25,-0.15,0>,r}
+sphere{<-0.05,-0.35,0>,r}
+sphere{<-0.25,-0.35,0.2>,r}
+sphere{<-0.25,-0.15,0.2>,r}
+cylinder{<-0.25,-0.15,0.2>,<-0.25,-0.35,0.2>,r}
+cylinder{<-0.25,-0.15,0.2>,<-0.25,-0.15,0>,r}
+sphere{<-0.25,-0.35,0>,r}
+cylinder{<-0.25,-0.35,0>,<-0.25,-0.35,0.2>,r}
+cylinder{<-0.25,-0.35,0>,<-0.25,-0.15,0>,r}
+cylinder{<-0.25,-0.35,0>,<-0.05,-0.35,0>,r}
+sphere{<-0.05,-0.35,0.2>,r}
+cylinder{<-0.05,-0.35,0.2>,<-0.25,-0.35,0.2>,r}
+cylinder{<-0.05,-0.35,0.2>,<-0.05,-0.35,0>,r}
+sphere{<-0.05,-0.15,0.2>,r}
+cylinder{<-0.05,-0.15,0.2>,<-0.05,-0.35,0.2>,r}
+cylinder{<-0.05,-0.15,0.2>,<-0.25,-0.15,0.2>,r}
+sphere{<-0.05,-0.15,0>,r}
+cylinder{<-0.05,-0.15,0>,<-0.05,-0.35,0>,r}
+cylinder{<-0.05,-0.15,0>,<-0.25,-0.15,0>,r}
+cylinder{<-0.05,-0.15,0>,<-0.05,-0.15,0.2>,r}
+// cell 23
+sphere{<-0.05,-0.15,0>,r}
+sphere{<0.15,-0.15,0>,r}
+cylinder{<0.15,-0.15,0>,<-0.05,-0.15,0>,r}
+sphere{<-0.05,-0.15,0.2>,r}
+cylinder{<-0.05,-0.15,0.2>,<-0.05,-0.15,0>,r}
+sphere{<-0.05,-0.35,0>,r}
+cylinder{<-0.05,-0.35,0>,<-0.05,-0.15,0>,r}
+sphere{<0.15,-0.15,0.2>,r}
+cylinder{<0.15,-0.15,0.2>,<0.15,-0.15,0>,r}
+cylinder{<0.15,-0.15,0.2>,<-0.05,-0.15,0.2>,r}
+sphere{<0.15,-0.35,0.2>,r}
+cylinder{<0.15,-0.35,0.2>,<0.15,-0.15,0.2>,r}
+sphere{<-0.05,-0.35,0.2>,r}
+cylinder{<-0.05,-0.35,0.2>,<0.15,-0.35,0.2>,r}
+cylinder{<-0.05,-0.35,0.2>,<-0.05,-0.15,0.2>,r}
+cylinder{<-0.05,-0.35,0.2>,<-0.05,-0.35,0>,r}
+sphere{<0.15,-0.35,0>,r}
+cylinder{<0.15,-0.35,0>,<0.15,-0.35,0.2>,r}
+cylinder{<0.15,-0.35,0>,<-0.05,-0.35,0>,r}
+cylinder{<0.15,-0.35,0>,<0.15,-0.15,0>,r}
+// cell 24
+sphere{<0.15,-0.35,0>,r}
+sphere{<0.35,-0.15,0>,r}
+sphere{<0.15,-0.15,0.2>,r}
+sphere{<0.35,-0.35,0>,r}
+cylinder{<0.35,-0.35,0>,<0.15,-0.35,0>,r}
+cylinder{<0.35,-0.35,0>,<0.35,-0.15,0>,r}
+sphere{<0.35,-0.35,0.2>,r}
+cylinder{<0.35,-0.35,0.2>,<0.35,-0.35,0>,r}
+sphere{<0.15,-0.35,0.2>,r}
+cylinder{<0.15,-0.35,0.2>,<0.35,-0.35,0.2>,r}
+cylinder{<0.15,-0.35,0.2>,<0.15,-0.15,0.2>,r}
+cylinder{<0.15,-0.35,0.2>,<0.15,-0.35,0>,r}
+sphere{<0.15,-0.15,0>,r}
+cylinder{<0.15,-0.15,0>,<0.35,-0.15,0>,r}
+cylinder{<0.15,-0.15,0>,<0.15,-0.35,0>,r}
+cylinder{<0.15,-0.15,0>,<0.15,-0.15,0.2>,r}
+sphere{<0.35,-0.15,0.2>,r}
+cylinder{<0.35,-0.15,0.2>,<0.35,-0.15,0>,r}
+cylinder{<0.35,-0.15,0.2>,<0.15,-0.15,0.2>,r}
+cylinder{<0.35,-0.15,0.2>,<0.35,-0.35,0.2>,r}
+// cell 25
+sphere{<0.55,-0.35,0>,r}
+sphere{<0.35,-0.35,0.2>,r}
+sphere{<0.35,-0.15,0>,r}
+sphere{<0.55,-0.15,0>,r}
+cylinder{<0.55,-0.15,0>,<0.55,-0.35,0>,r}
+cylinder{<0.55,-0.15,0>,<0.35,-0.15,0>,r}
+sphere{<0.35,-0.35,0>,r}
+cylinder{<0.35,-0.35,0>,<0.35,-0.35,0.2>,r}
+cylinder{<0.35,-0.35,0>,<0.35,-0.15,0>,r}
+cylinder{<0.35,-0.35,0>,<0.55,-0.35,0>,r}
+sphere{<0.35,-0.15,0.2>,r}
+cylinder{<0.35,-0.15,0.2>,<0.35,-0.15,0>,r}
+cylinder{<0.35,-0.15,0.2>,<0.35,-0.35,0.2>,r}
+sphere{<0.55,-0.15,0.2>,r}
+cylinder{<0.55,-0.15,0.2>,<0.55,-0.15,0>,r}
+cylinder{<0.55,-0.15,0.2>,<0.35,-0.15,0.2>,r}
+sphere{<0.55,-0.35,0.2>,r}
+cylinder{<0.55,-0.35,0.2>,<0.35,-0.35,0.2>,r}
+cylinder{<0.55,-0.35,0.2>,<0.55,-0.35,0>,r}
+cylinder{<0.55,-0.35,0.2>,<0.55,-0.15,0.2>,r}
+// cell 26
+sphere{<0.75,-0.35,0>,r}
+sphere{<0.55,-0.35,0.2>,r}
+sphere{<0.55,-0.15,0>,r}
+sphere{<0.75,-0.15,0>,r}
+cylinder{<0.75,-0.15,0>,<0.75,-0.35,0>,r}
+cylinder{<0.75,-0.15,0>,<0.55,-0.15,0>,r}
+sphere{<0.55,-0.35,0>,r}
+cylinder{<0.55,-0.35,0>,<0.55,-0.35,0.2>,r}
+cylinder{<0.55,-0.35,0>,<0.55,-0.15,0>,r}
+cylinder{<0.55,-0.35,0>,<0.75,-0.35,0>,r}
+sphere{<0.75,-0.15,0.2>,r}
+cylinder{<0.75,-0.15,0.2>,<0.75,-0.15,0>,r}
+sphere{<0.55,-0.15,0.2>,r}
+cylinder{<0.55,-0.15,0.2>,<0.75,-0.15,0.2>,r}
+cylinder{<0.55,-0.15,0.2>,<0.55,-0.15,0>,r}
+cylinder{<0.55,-0.15,0.2>,<0.55,-0.35,0.2>,r}
+sphere{<0.75,-0.35,0.2>,r}
+cylinder{<0.75,-0.35,0.2>,<0.55,-0.35,0.2>,r}
+cylinder{<0.75,-0.35,0.2>,<0.75,-0.35,0>,r}
+cylinder{<0.75,-0.35,0.2>,<0.75,-0.15,0.2>,r}
+// cell 27
+sphere{<0.81582,-0.41582,0.2>,r}
+sphere{<0.896366,-0.496366,0>,r}
+cylinder{<0.896366,-0.496366,0>,<0.81582,-0.41582,0.2>,r}
+sphere{<0.75,-0.15,0>,r}
+sphere{<0.998238,-0.15,0>,r}
+cylinder{<0.998238,-0.15,0>,<0.896366,-0.496366,0>,r}
+cylinder{<0.998238,-0.15,0>,<0.75,-0.15,0>,r}
+sphere{<0.844665,-0.15,0.294665>,r}
+cylinder{<0.844665,-0.15,0.294665>,<0.998238,-0.15,0>,r}
+sphere{<0.75,-0.35,0>,r}
+cylinder{<0.75,-0.35,0>,<0.75,-0.15,0>,r}
+cylinder{<0.75,-0.35,0>,<0.896366,-0.496366,0>,r}
+sphere{<0.75,-0.15,0.2>,r}
+cylinder{<0.75,-0.15,0.2>,<0.844665,-0.15,0.294665>,r}
+cylinder{<0.75,-0.15,0.2>,<0.75,-0.15,0>,r}
+sphere{<0.805995,-0.35,0.255995>,r}
+cylinder{<0.805995,-0.35,0.255995>,<0.81582,-0.41582,0.2>,r}
+cylinder{<0.805995,-0.35,0.255995>,<0.844665,-0.15,0.294665>,r}
+sphere{<0.75,-0.35,0.2>,r}
+cylinder{<0.75,-0.35,0.2>,<0.805995,-0.35,0.255995>,r}
+cylinder{<0.75,-0.35,0.2>,<0.75,-0.15,0.2>,r}
+cylinder{<0.75,-0.35,0.2>,<0.75,-0.35,0>,r}
+cylinder{<0.75,-0.35,0.2>,<0.81582,-0.41582,0.2>,r}
+// cell 28
+sphere{<-0.99222,-0.15,0>,r}
+sphere{<-0.65,0.05,0>,r}
+sphere{<-1.00555,0.05,0>,r}
+cylinder{<-1.00555,0.05,0>,<-0.65,0.05,0>,r}
+cylinder{<-1.00555,0.05,0>,<-0.99222,-0.15,0>,r}
+sphere{<-0.65,-0.15,0>,r}
+cylinder{<-0.65,-0.15,0>,<-0.99222,-0.15,0>,r}
+cylinder{<-0.65,-0.15,0>,<-0.65,0.05,0>,r}
+sphere{<-0.905331,0.05,0.2>,r}
+cylinder{<-0.905331,0.05,0.2>,<-1.00555,0.05,0>,r}
+sphere{<-0.65,0.05,0.2>,r}
+cylinder{<-0.65,0.05,0.2>,<-0.65,0.05,0>,r}
+cylinder{<-0.65,0.05,0.2>,<-0.905331,0.05,0.2>,r}
+sphere{<-0.891998,-0.15,0.2>,r}
+cylinder{<-0.891998,-0.15,0.2>,<-0.905331,0.05,0.2>,r}
+cylinder{<-0.891998,-0.15,0.2>,<-0.99222,-0.15,0>,r}
+sphere{<-0.65,-0.15,0.2>,r}
+cylinder{<-0.65,-0.15,0.2>,<-0.65,-0.15,0>,r}
+cylinder{<-0.65,-0.15,0.2>,<-0.65,0.05,0.2>,r}
+cylinder{<-0.65,-0.15,0.2>,<-0.891998,-0.15,0.2>,r}
+// cell 29
+sphere{<-0.65,0.05,0>,r}
+sphere{<-0.45,-0.15,0>,r}
+sphere{<-0.65,-0.15,0>,r}
+cylinder{<-0.65,-0.15,0>,<-0.65,0.05,0>,r}
+cylinder{<-0.65,-0.15,0>,<-0.45,-0.15,0>,r}
+sphere{<-0.45,0.05,0>,r}
+cylinder{<-0.45,0.05,0>,<-0.45,-0.15,0>,r}
+cylinder{<-0.45,0.05,0>,<-0.65,0.05,0>,r}
+sphere{<-0.65,-0.15,0.2>,r}
+cylinder{<-0.65,-0.15,0.2>,<-0.65,-0.15,0>,r}
+sphere{<-0.65,0.05,0.2>,r}
+cylinder{<-0.65,0.05,0.2>,<-0.65,-0.15,0.2>,r}
+cylinder{<-0.65,0.05,0.2>,<-0.65,0.05,0>,r}
+sphere{<-0.45,0.05,0.2>,r}
+cylinder{<-0.45,0.05,0.2>,<-0.45,0.05,0>,r}
+cylinder{<-0.45,0.05,0.2>,<-0.65,0.05,0.2>,r}
+sphere{<-0.45,-0.15,0.2>,r}
+cylinder{<-0.45,-0.15,0.2>,<-0.45,-0.15,0>,r}
+cylinder{<-0.45,-0.15,0.2>,<-0.45,0.05,0.2>,r}
+cylinder{<-0.45,-0.15,0.2>,<-0.65,-0.15,0.2>,r}
+// cell 30
+sphere{<-0.45,-0.15,0>,r}
+sphere{<-0.25,-0.15,0>,r}
+cylinder{<-0.25,-0.15,0>,<-0.45,-0.15,0>,r}
+sphere{<-0.45,0.05,1.38778e-17>,r}
+cylinder{<-0.45,0.05,1.38778e-17>,<-0.45,-0.15,0>,r}
+sphere{<-0.25,0.05,1.38778e-17>,r}
+cylinder{<-0.25,0.05,1.38778e-17>,<-0.25,-0.15,0>,r}
+cylinder{<-0.25,0.05,1.38778e-17>,<-0.45,0.05,1.38778e-17>,r}
+sphere{<-0.45,-0.15,0.2>,r}
+cylinder{<-0.45,-0.15,0.2>,<-0.45,-0.15,0>,r}
+sphere{<-0.25,-0.15,0.2>,r}
+cylinder{<-0.25,-0.15,0.2>,<-0.45,-0.15,0.2>,r}
+cylinder{<-0.25,-0.15,0.2>,<-0.25,-0.15,0>,r}
+sphere{<-0.45,0.05,0.2>,r}
+cylinder{<-0.45,0.05,0.2>,<-0.45,0.05,1.38778e-17>,r}
+cylinder{<-0.45,0.05,0.2>,<-0.45,-0.15,0.2>,r}
+sphere{<-0.25,0.05,0.2>,r}
+cylinder{<-0.25,0.05,0.2>,<-0.25,-0.15,0.2>,r}
+cylinder{<-0.25,0.05,0.2>,<-0.25,0.05,1.38778e-17>,r}
+cylinder{<-0.25,0.05,0.2>,<-0.45,0.05,0.2>,r}
+// cell 31
+sphere{<-0.25,-0.15,0>,r}
+sphere{<-0.05,-0.15,0>,r}
+cylinder{<-0.05,-0.15,0>,<-0.25,-0.15,0>,r}
+sphere{<-0.05,0.05,0.2>,r}
+sphere{<-0.25,0.05,0.2>,r}
+cylinder{<-0.25,0.05,0.2>,<-0.05,0.05,0.2>,r}
+sphere{<-0.25,0.05,0>,r}
+cylinder{<-0.25,0.05,0>,<-0.25,0.05,0.2>,r}
+cylinder{<-0.25,0.05,0>,<-0.25,-0.15,0>,r}
+sphere{<-0.05,-0.15,0.2>,r}
+cylinder{<-0.05,-0.15,0.2>,<-0.05,0.05,0.2>,r}
+cylinder{<-0.05,-0.15,0.2>,<-0.05,-0.15,0>,r}
+sphere{<-0.05,0.05,0>,r}
+cylinder{<-0.05,0.05,0>,<-0.05,-0.15,0>,r}
+cylinder{<-0.05,0.05,0>,<-0.25,0.05,0>,r}
+cylinder{<-0.05,0.05,0>,<-0.05,0.05,0.2>,r}
+sphere{<-0.25,-0.15,0.2>,r}
+cylinder{<-0.25,-0.15,0.2>,<-0.25,0.05,0.2>,r}
+cylinder{<-0.25,-0.15,0.2>,<-0.25,-0.15,0>,r}
+cylinder{<-0.25,-0.15,0.2>,<-0.05,-0.15,0.2>,r}
+// cell 32
+sphere{<0.15,0.05,0>,r}
+sphere{<0.15,-0.15,0>,r}
+cylinder{<0.15,-0.15,0>,<0.15,0.05,0>,r}
+sphere{<-0.05,0.05,0.2>,r}
+sphere{<0.15,0.05,0.2>,r}
+cylinder{<0.15,0.05,0.2>,<0.15,0.05,0>,r}
+cylinder{<0.15,0.05,0.2>,<-0.05,0.05,0.2>,r}
+sphere{<-0.05,-0.15,0.2>,r}
+cylinder{<-0.05,-0.15,0.2>,<-0.05,0.05,0.2>,r}
+sphere{<0.15,-0.15,0.2>,r}
+cylinder{<0.15,-0.15,0.2>,<-0.05,-0.15,0.2>,r}
+cylinder{<0.15,-0.15,0.2>,<0.15,-0.15,0>,r}
+cylinder{<0.15,-0.15,0.2>,<0.15,0.05,0.2>,r}
+sphere{<-0.05,0.05,0>,r}
+cylinder{<-0.05,0.05,0>,<-0.05,0.05,0.2>,r}
+cylinder{<-0.05,0.05,0>,<0.15,0.05,0>,r}
+sphere{<-0.05,-0.15,0>,r}
+cylinder{<-0.05,-0.15,0>,<-0.05,-0.15,0.2>,r}
+cylinder{<-0.05,-0.15,0>,<-0.05,0.05,0>,r}
+cylinder{<-0.05,-0.15,0>,<0.15,-0.15,0>,r}
+// cell 33
+sphere{<0.35,0.05,0>,r}
+sphere{<0.15,0.05,0.2>,r}
+sphere{<0.35,0.05,0.2>,r}
+cylinder{<0.35,0.05,0.2>,<0.35,0.05,0>,r}
+cylinder{<0.35,0.05,0.2>,<0.15,0.05,0.2>,r}
+sphere{<0.35,-0.15,0>,r}
+cylinder{<0.35,-0.15,0>,<0.35,0.05,0>,r}
+sphere{<0.15,-0.15,0.2>,r}
+cylinder{<0.15,-0.15,0.2>,<0.15,0.05,0.2>,r}
+sphere{<0.15,0.05,0>,r}
+cylinder{<0.15,0.05,0>,<0.15,0.05,0.2>,r}
+cylinder{<0.15,0.05,0>,<0.35,0.05,0>,r}
+sphere{<0.15,-0.15,0>,r}
+cylinder{<0.15,-0.15,0>,<0.15,-0.15,0.2>,r}
+cylinder{<0.15,-0.15,0>,<0.15,0.05,0>,r}
+cylinder{<0.15,-0.15,0>,<0.35,-0.15,0>,r}
+sphere{<0.35,-0.15,0.2>,r}
+cylinder{<0.35,-0.15,0.2>,<0.15,-0.15,0.2>,r}
+cylinder{<0.35,-0.15,0.2>,<0.35,-0.15,0>,r}
+cylinder{<0.35,-0.15,0.2>,<0.35,0.05,0.2>,r}
+// cell 34
+sphere{<0.35,-0.15,-1.38778e-17>,r}
+sphere{<0.55,-0.15,0.2>,r}
+sphere{<0.35,0.05,-1.38778e-17>,r}
+cylinder{<0.35,0.05,-1.38778e-17>,<0.35,-0.15,-1.38778e-17>,r}
+sphere{<0.35,-0.15,0.2>,r}
+cylinder{<0.35,-0.15,0.2>,<0.55,-0.15,0.2>,r}
+cylinder{<0.35,-0.15,0.2>,<0.35,-0.15,-1.38778e-17>,r}
+sphere{<0.55,-0.15,-1.38778e-17>,r}
+cylinder{<0.55,-0.15,-1.38778e-17>,<0.55,-0.15,0.2>,r}
+cylinder{<0.55,-0.15,-1.38778e-17>,<0.35,-0.15,-1.38778e-17>,r}
+sphere{<0.55,0.05,-1.38778e-17>,r}
+cylinder{<0.55,0.05,-1.38778e-17>,<0.55,-0.15,-1.38778e-17>,r}
+cylinder{<0.55,0.05,-1.38778e-17>,<0.35,0.05,-1.38778e-17>,r}
+sphere{<0.35,0.05,0.2>,r}
+cylinder{<0.35,0.05,0.2>,<0.35,0.05,-1.38778e-17>,r}
+cylinder{<0.35,0.05,0.2>,<0.35,-0.15,0.2>,r}
+sphere{<0.55,0.05,0.2>,r}
+cylinder{<0.55,0.05,0.2>,<0.55,0.05,-1.38778e-17>,r}
+cylinder{<0.55,0.05,0.2>,<0.35,0.05,0.2>,r}
+cylinder{<0.55,0.05,0.2>,<0.55,-0.15,0.2>,r}
+// cell 35
+sphere{<0.75,-0.15,0>,r}
+sphere{<0.75,0.05,0.2>,r}
+sphere{<0.55,0.05,0>,r}
+sphere{<0.75,-0.15,0.2>,r}
+cylinder{<0.75,-0.15,0.2>,<0.75,-0.15,0>,r}
+cylinder{<0.75,-0.15,0.2>,<0.75,0.05,0.2>,r}
+sphere{<0.75,0.05,0>,r}
+cylinder{<0.75,0.05,0>,<0.75,0.05,0.2>,r}
+cylinder{<0.75,0.05,0>,<0.75,-0.15,0>,r}
+cylinder{<0.75,0.05,0>,<0.55,0.05,0>,r}
+sphere{<0.55,-0.15,0>,r}
+cylinder{<0.55,-0.15,0>,<0.55,0.05,0>,r}
+cylinder{<0.55,-0.15,0>,<0.75,-0.15,0>,r}
+sphere{<0.55,0.05,0.2>,r}
+cylinder{<0.55,0.05,0.2>,<0.75,0.05,0.2>,r}
+cylinder{<0.55,0.05,0.2>,<0.55,0.05,0>,r}
+sphere{<0.55,-0.15,0.2>,r}
+cylinder{<0.55,-0.15,0.2>,<0.55,0.05,0.2>,r}
+cylinder{<0.55,-0.15,0.2>,<0.55,-0.15,0>,r}
+cylinder{<0.55,-0.15,0.2>,<0.75,-0.15,0.2>,r}
+// cell 36
+sphere{<0.8451,-0.15,0.2951>,r}
+sphere{<0.992905,-0.15,0>,r}
+cylinder{<0.992905,-0.15,0>,<0.8451,-0.15,0.2951>,r}
+sphere{<0.75,0.05,0>,r}
+sphere{<1.00467,0.05,0>,r}
+cylinder{<1.00467,0.05,0>,<0.992905,-0.15,0>,r}
+cylinder{<1.00467,0.05,0>,<0.75,0.05,0>,r}
+sphere{<0.852939,0.05,0.302939>,r}
+cylinder{<0.852939,0.05,0.302939>,<0.8451,-0.15,0.2951>,r}
+cylinder{<0.852939,0.05,0.302939>,<1.00467,0.05,0>,r}
+sphere{<0.75,-0.15,0>,r}
+cylinder{<0.75,-0.15,0>,<0.75,0.05,0>,r}
+cylinder{<0.75,-0.15,0>,<0.992905,-0.15,0>,r}
+sphere{<0.75,0.05,0.2>,r}
+cylinder{<0.75,0.05,0.2>,<0.75,0.05,0>,r}
+cylinder{<0.75,0.05,0.2>,<0.852939,0.05,0.302939>,r}
+sphere{<0.75,-0.15,0.2>,r}
+cylinder{<0.75,-0.15,0.2>,<0.75,0.05,0.2>,r}
+cylinder{<0.75,-0.15,0.2>,<0.75,-0.15,0>,r}
+cylinder{<0.75,-0.15,0.2>,<0.8451,-0.15,0.2951>,r}
+// cell 37
+sphere{<-0.907824,0.05,0.2>,r}
+sphere{<-0.65,0.05,0.2>,r}
+cylinder{<-0.65,0.05,0.2>,<-0.907824,0.05,0.2>,r}
+sphere{<-0.969804,0.25,0>,r}
+sphere{<-0.65,0.25,0>,r}
+cylinder{<-0.65,0.25,0>,<-0.969804,0.25,0>,r}
+sphere{<-1.0098,0.05,0>,r}
+cylinder{<-1.0098,0.05,0>,<-0.907824,0.05,0.2>,r}
+cylinder{<-1.0098,0.05,0>,<-0.969804,0.25,0>,r}
+sphere{<-0.65,0.05,0>,r}
+cylinder{<-0.65,0.05,0>,<-1.0098,0.05,0>,r}
+cylinder{<-0.65,0.05,0>,<-0.65,0.25,0>,r}
+cylinder{<-0.65,0.05,0>,<-0.65,0.05,0.2>,r}
+sphere{<-0.65,0.25,0.2>,r}
+cylinder{<-0.65,0.25,0.2>,<-0.65,0.05,0.2>,r}
+cylinder{<-0.65,0.25,0.2>,<-0.65,0.25,0>,r}
+sphere{<-0.867824,0.25,0.2>,r}
+cylinder{<-0.867824,0.25,0.2>,<-0.969804,0.25,0>,r}
+cylinder{<-0.867824,0.25,0.2>,<-0.907824,0.05,0.2>,r}
+cylinder{<-0.867824,0.25,0.2>,<-0.65,0.25,0.2>,r}
+// cell 38
+sphere{<-0.65,0.05,0>,r}
+sphere{<-0.45,0.05,0>,r}
+cylinder{<-0.45,0.05,0>,<-0.65,0.05,0>,r}
+sphere{<-0.65,0.25,0.2>,r}
+sphere{<-0.45,0.25,0>,r}
+cylinder{<-0.45,0.25,0>,<-0.45,0.05,0>,r}
+sphere{<-0.45,0.05,0.2>,r}
+cylinder{<-0.45,0.05,0.2>,<-0.45,0.05,0>,r}
+sphere{<-0.65,0.05,0.2>,r}
+cylinder{<-0.65,0.05,0.2>,<-0.45,0.05,0.2>,r}
+cylinder{<-0.65,0.05,0.2>,<-0.65,0.25,0.2>,r}
+cylinder{<-0.65,0.05,0.2>,<-0.65,0.05,0>,r}
+sphere{<-0.65,0.25,0>,r}
+cylinder{<-0.65,0.25,0>,<-0.65,0.25,0.2>,r}
+cylinder{<-0.65,0.25,0>,<-0.45,0.25,0>,r}
+cylinder{<-0.65,0.25,0>,<-0.65,0.05,0>,r}
+sphere{<-0.45,0.25,0.2>,r}
+cylinder{<-0.45,0.25,0.2>,<-0.65,0.25,0.2>,r}
+cylinder{<-0.45,0.25,0.2>,<-0.45,0.05,0.2>,r}
+cylinder{<-0.45,0.25,0.2>,<-0.45,0.25,0>,r}
+// cell 39
+sphere{<-0.45,0.05,0.2>,r}
+sphere{<-0.25,0.25,0.2>,r}
+sphere{<-0.25,0.05,0.2>,r}
+cylinder{<-0.25,0.05,0.2>,<-0.25,0.25,0.2>,r}
+cylinder{<-0.25,0.05,0.2>,<-0.45,0.05,0.2>,r}
+sphere{<-0.45,0.25,0>,r}
+sphere{<-0.45,0.25,0.2>,r}
+cylinder{<-0.45,0.25,0.2>,<-0.25,0.25,0.2>,r}
+cylinder{<-0.45,0.25,0.2>,<-0.45,0.25,0>,r}
+cylinder{<-0.45,0.25,0.2>,<-0.45,0.05,0.2>,r}
+sphere{<-0.25,0.05,0>,r}
+cylinder{<-0.25,0.05,0>,<-0.25,0.05,0.2>,r}
+sphere{<-0.45,0.05,0>,r}
+cylinder{<-0.45,0.05,0>,<-0.45,0.25,0>,r}
+cylinder{<-0.45,0.05,0>,<-0.25,0.05,0>,r}
+cylinder{<-0.45,0.05,0>,<-0.45,0.05,0.2>,r}
+sphere{<-0.25,0.25,0>,r}
+cylinder{<-0.25,0.25,0>,<-0.25,0.05,0>,r}
+cylinder{<-0.25,0.25,0>,<-0.45,0.25,0>,r}
+cylinder{<-0.25,0.25,0>,<-0.25,0.25,0.2>,r}
+// cell 40
+sphere{<-0.25,0.05,0>,r}
+sphere{<-0.05,0.05,0>,r}
+cylinder{<-0.05,0.05,0>,<-0.25,0.05,0>,r}
+sphere{<-0.25,0.05,0.2>,r}
+cylinder{<-0.25,0.05,0.2>,<-0.25,0.05,0>,r}
+sphere{<-0.05,0.25,0.2>,r}
+sphere{<-0.25,0.25,0>,r}
+cylinder{<-0.25,0.25,0>,<-0.25,0.05,0>,r}
+sphere{<-0.05,0.05,0.2>,r}
+cylinder{<-0.05,0.05,0.2>,<-0.05,0.05,0>,r}
+cylinder{<-0.05,0.05,0.2>,<-0.05,0.25,0.2>,r}
+cylinder{<-0.05,0.05,0.2>,<-0.25,0.05,0.2>,r}
+sphere{<-0.05,0.25,0>,r}
+cylinder{<-0.05,0.25,0>,<-0.05,0.05,0>,r}
+cylinder{<-0.05,0.25,0>,<-0.25,0.25,0>,r}
+cylinder{<-0.05,0.25,0>,<-0.05,0.25,0.2>,r}
+sphere{<-0.25,0.25,0.2>,r}
+cylinder{<-0.25,0.25,0.2>,<-0.05,0.25,0.2>,r}
+cylinder{<-0.25,0.25,0.2>,<-0.25,0.25,0>,r}
+cylinder{<-0.25,0.25,0.2>,<-0.25,0.05,0.2>,r}
+// cell 41
+sphere{<0.15,0.25,0>,r}
+sphere{<0.15,0.05,0>,r}
+cylinder{<0.15,0.05,0>,<0.15,0.25,0>,r}
+sphere{<-0.05,0.25,0>,r}
+cylinder{<-0.05,0.25,0>,<0.15,0.25,0>,r}
+sphere{<-0.05,0.05,0.2>,r}
+sphere{<-0.05,0.25,0.2>,r}
+cylinder{<-0.05,0.25,0.2>,<-0.05,0.25,0>,r}
+cylinder{<-0.05,0.25,0.2>,<-0.05,0.05,0.2>,r}
+sphere{<0.15,0.05,0.2>,r}
+cylinder{<0.15,0.05,0.2>,<-0.05,0.05,0.2>,r}
+cylinder{<0.15,0.05,0.2>,<0.15,0.05,0>,r}
+sphere{<0.15,0.25,0.2>,r}
+cylinder{<0.15,0.25,0.2>,<-0.05,0.25,0.2>,r}
+cylinder{<0.15,0.25,0.2>,<0.15,0.05,0.2>,r}
+cylinder{<0.15,0.25,0.2>,<0.15,0.25,0>,r}
+sphere{<-0.05,0.05,0>,r}
+cylinder{<-0.05,0.05,0>,<-0.05,0.05,0.2>,r}
+cylinder{<-0.05,0.05,0>,<-0.05,0.25,0>,r}
+cylinder{<-0.05,0.05,0>,<0.15,0.05,0>,r}
+// cell 42
+sphere{<0.15,0.05,0>,r}
+sphere{<0.35,0.05,0>,r}
+cylinder{<0.35,0.05,0>,<0.15,0.05,0>,r}
+sphere{<0.35,0.25,0.2>,r}
+sphere{<0.35,0.25,0>,r}
+cylinder{<0.35,0.25,0>,<0.35,0.25,0.2>,r}
+cylinder{<0.35,0.25,0>,<0.35,0.05,0>,r}
+sphere{<0.15,0.05,0.2>,r}
+cylinder{<0.15,0.05,0.2>,<0.15,0.05,0>,r}
+sphere{<0.35,0.05,0.2>,r}
+cylinder{<0.35,0.05,0.2>,<0.35,0.05,0>,r}
+cylinder{<0.35,0.05,0.2>,<0.35,0.25,0.2>,r}
+cylinder{<0.35,0.05,0.2>,<0.15,0.05,0.2>,r}
+sphere{<0.15,0.25,0>,r}
+cylinder{<0.15,0.25,0>,<0.35,0.25,0>,r}
+cylinder{<0.15,0.25,0>,<0.15,0.05,0>,r}
+sphere{<0.15,0.25,0.2>,r}
+cylinder{<0.15,0.25,0.2>,<0.35,0.25,0.2>,r}
+cylinder{<0.15,0.25,0.2>,<0.15,0.25,0>,r}
+cylinder{<0.15,0.25,0.2>,<0.15,0.05,0.2>,r}
+// cell 43
+sphere{<0.35,0.05,0>,r}
+sphere{<0.55,0.05,0>,r}
+cylinder{<0.55,0.05,0>,<0.35,0.05,0>,r}
+sphere{<0.35,0.25,0>,r}
+cylinder{<0.35,0.25,0>,<0.35,0.05,0>,r}
+sphere{<0.35,0.25,0.2>,r}
+cylinder{<0.35,0.25,0.2>,<0.35,0.25,0>,r}
+sphere{<0.55,0.05,0.2>,r}
+cylinder{<0.55,0.05,0.2>,<0.55,0.05,0>,r}
+sphere{<0.55,0.25,0>,r}
+cylinder{<0.55,0.25,0>,<0.55,0.05,0>,r}
+cylinder{<0.55,0.25,0>,<0.35,0.25,0>,r}
+sphere{<0.55,0.25,0.2>,r}
+cylinder{<0.55,0.25,0.2>,<0.55,0.05,0.2>,r}
+cylinder{<0.55,0.25,0.2>,<0.55,0.25,0>,r}
+cylinder{<0.55,0.25,0.2>,<0.35,0.25,0.2>,r}
+sphere{<0.35,0.05,0.2>,r}
+cylinder{<0.35,0.05,0.2>,<0.55,0.05,0.2>,r}
+cylinder{<0.35,0.05,0.2>,<0.35,0.25,0.2>,r}
+cylinder{<0.35,0.05,0.2>,<0.35,0.05,0>,r}
+// cell 44
+sphere{<0.75,0.25,0>,r}
+sphere{<0.55,0.25,0>,r}
+cylinder{<0.55,0.25,0>,<0.75,0.25,0>,r}
+sphere{<0.55,0.25,0.2>,r}
+cylinder{<0.55,0.25,0.2>,<0.55,0.25,0>,r}
+sphere{<0.75,0.25,0.2>,r}
+cylinder{<0.75,0.25,0.2>,<0.55,0.25,0.2>,r}
+cylinder{<0.75,0.25,0.2>,<0.75,0.25,0>,r}
+sphere{<0.55,0.05,0.2>,r}
+cylinder{<0.55,0.05,0.2>,<0.55,0.25,0.2>,r}
+sphere{<0.75,0.05,0>,r}
+cylinder{<0.75,0.05,0>,<0.75,0.25,0>,r}
+sphere{<0.75,0.05,0.2>,r}
+cylinder{<0.75,0.05,0.2>,<0.55,0.05,0.2>,r}
+cylinder{<0.75,0.05,0.2>,<0.75,0.05,0>,r}
+cylinder{<0.75,0.05,0.2>,<0.75,0.25,0.2>,r}
+sphere{<0.55,0.05,0>,r}
+cylinder{<0.55,0.05,0>,<0.55,0.05,0.2>,r}
+cylinder{<0.55,0.05,0>,<0.55,0.25,0>,r}
+cylinder{<0.55,0.05,0>,<0.75,0.05,0>,r}
+// cell 45
+sphere{<0.852859,0.05,0.302859>,r}
+sphere{<0.971334,0.25,0>,r}
+sphere{<0.75,0.25,0>,r}
+cylinder{<0.75,0.25,0>,<0.971334,0.25,0>,r}
+sphere{<0.82945,0.25,0.27945>,r}
+cylinder{<0.82945,0.25,0.27945>,<0.852859,0.05,0.302859>,r}
+cylinder{<0.82945,0.25,0.27945>,<0.971334,0.25,0>,r}
+sphere{<0.75,0.05,0>,r}
+cylinder{<0.75,0.05,0>,<0.75,0.25,0>,r}
+sphere{<1.00663,0.05,0>,r}
+cylinder{<1.00663,0.05,0>,<0.75,0.05,0>,r}
+cylinder{<1.00663,0.05,0>,<0.971334,0.25,0>,r}
+cylinder{<1.00663,0.05,0>,<0.852859,0.05,0.302859>,r}
+sphere{<0.75,0.25,0.2>,r}
+cylinder{<0.75,0.25,0.2>,<0.75,0.25,0>,r}
+cylinder{<0.75,0.25,0.2>,<0.82945,0.25,0.27945>,r}
+sphere{<0.75,0.05,0.2>,r}
+cylinder{<0.75,0.05,0.2>,<0.75,0.25,0.2>,r}
+cylinder{<0.75,0.05,0.2>,<0.75,0.05,0>,r}
+cylinder{<0.75,0.05,0.2>,<0.852859,0.05,0.302859>,r}
+// cell 46
+sphere{<-0.986863,0.25,0>,r}
+sphere{<-0.65,0.45,0.2>,r}
+sphere{<-0.89353,0.45,0>,r}
+cylinder{<-0.89353,0.45,0>,<-0.986863,0.25,0>,r}
+sphere{<-0.65,0.25,0>,r}
+cylinder{<-0.65,0.25,0>,<-0.986863,0.25,0>,r}
+sphere{<-0.65,0.45,0>,r}
+cylinder{<-0.65,0.45,0>,<-0.65,0.45,0.2>,r}
+cylinder{<-0.65,0.45,0>,<-0.65,0.25,0>,r}
+cylinder{<-0.65,0.45,0>,<-0.89353,0.45,0>,r}
+sphere{<-0.783177,0.45,0.2>,r}
+cylinder{<-0.783177,0.45,0.2>,<-0.65,0.45,0.2>,r}
+cylinder{<-0.783177,0.45,0.2>,<-0.89353,0.45,0>,r}
+sphere{<-0.87651,0.25,0.2>,r}
+cylinder{<-0.87651,0.25,0.2>,<-0.783177,0.45,0.2>,r}
+cylinder{<-0.87651,0.25,0.2>,<-0.986863,0.25,0>,r}
+sphere{<-0.65,0.25,0.2>,r}
+cylinder{<-0.65,0.25,0.2>,<-0.65,0.25,0>,r}
+cylinder{<-0.65,0.25,0.2>,<-0.65,0.45,0.2>,r}
+cylinder{<-0.65,0.25,0.2>,<-0.87651,0.25,0.2>,r}
+// cell 47
+sphere{<-0.65,0.45,0>,r}
+sphere{<-0.45,0.25,0.2>,r}
+sphere{<-0.45,0.45,0.2>,r}
+cylinder{<-0.45,0.45,0.2>,<-0.45,0.25,0.2>,r}
+sphere{<-0.45,0.45,0>,r}
+cylinder{<-0.45,0.45,0>,<-0.45,0.45,0.2>,r}
+cylinder{<-0.45,0.45,0>,<-0.65,0.45,0>,r}
+sphere{<-0.65,0.25,0.2>,r}
+cylinder{<-0.65,0.25,0.2>,<-0.45,0.25,0.2>,r}
+sphere{<-0.65,0.25,0>,r}
+cylinder{<-0.65,0.25,0>,<-0.65,0.25,0.2>,r}
+cylinder{<-0.65,0.25,0>,<-0.65,0.45,0>,r}
+sphere{<-0.65,0.45,0.2>,r}
+cylinder{<-0.65,0.45,0.2>,<-0.45,0.45,0.2>,r}
+cylinder{<-0.65,0.45,0.2>,<-0.65,0.45,0>,r}
+cylinder{<-0.65,0.45,0.2>,<-0.65,0.25,0.2>,r}
+sphere{<-0.45,0.25,0>,r}
+cylinder{<-0.45,0.25,0>,<-0.65,0.25,0>,r}
+cylinder{<-0.45,0.25,0>,<-0.45,0.45,0>,r}
+cylinder{<-0.45,0.25,0>,<-0.45,0.25,0.2>,r}
+// cell 48
+sphere{<-0.45,0.25,0>,r}
+sphere{<-0.25,0.25,0>,r}
+cylinder{<-0.25,0.25,0>,<-0.45,0.25,0>,r}
+sphere{<-0.25,0.45,0.2>,r}
+sphere{<-0.25,0.45,0>,r}
+cylinder{<-0.25,0.45,0>,<-0.25,0.45,0.2>,r}
+cylinder{<-0.25,0.45,0>,<-0.25,0.25,0>,r}
+sphere{<-0.45,0.45,0.2>,r}
+cylinder{<-0.45,0.45,0.2>,<-0.25,0.45,0.2>,r}
+sphere{<-0.25,0.25,0.2>,r}
+cylinder{<-0.25,0.25,0.2>,<-0.25,0.25,0>,r}
+cylinder{<-0.25,0.25,0.2>,<-0.25,0.45,0.2>,r}
+sphere{<-0.45,0.45,0>,r}
+cylinder{<-0.45,0.45,0>,<-0.45,0.45,0.2>,r}
+cylinder{<-0.45,0.45,0>,<-0.25,0.45,0>,r}
+cylinder{<-0.45,0.45,0>,<-0.45,0.25,0>,r}
+sphere{<-0.45,0.25,0.2>,r}
+cylinder{<-0.45,0.25,0.2>,<-0.25,0.25,0.2>,r}
+cylinder{<-0.45,0.25,0.2>,<-0.45,0.45,0.2>,r}
+cylinder{<-0.45,0.25,0.2>,<-0.45,0.25,0>,r}
+// cell 49
+sphere{<-0.25,0.25,0>,r}
+sphere{<-0.05,0.25,0>,r}
+cylinder{<-0.05,0.25,0>,<-0.25,0.25,0>,r}
+sphere{<-0.25,0.45,0>,r}
+cylinder{<-0.25,0.45,0>,<-0.25,0.25,0>,r}
+sphere{<-0.05,0.45,0>,r}
+cylinder{<-0.05,0.45,0>,<-0.05,0.25,0>,r}
+cylinder{<-0.05,0.45,0>,<-0.25,0.45,0>,r}
+sphere{<-0.25,0.45,0.2>,r}
+cylinder{<-0.25,0.45,0.2>,<-0.25,0.45,0>,r}
+sphere{<-0.25,0.25,0.2>,r}
+cylinder{<-0.25,0.25,0.2>,<-0.25,0.45,0.2>,r}
+cylinder{<-0.25,0.25,0.2>,<-0.25,0.25,0>,r}
+sphere{<-0.05,0.25,0.2>,r}
+cylinder{<-0.05,0.25,0.2>,<-0.05,0.25,0>,r}
+cylinder{<-0.05,0.25,0.2>,<-0.25,0.25,0.2>,r}
+sphere{<-0.05,0.45,0.2>,r}
+cylinder{<-0.05,0.45,0.2>,<-0.25,0.45,0.2>,r}
+cylinder{<-0.05,0.45,0.2>,<-0.05,0.25,0.2>,r}
+cylinder{<-0.05,0.45,0.2>,<-0.05,0.45,0>,r}
+// cell 50
+sphere{<-0.05,0.25,0>,r}
+sphere{<0.15,0.25,0>,r}
+cylinder{<0.15,0.25,0>,<-0.05,0.25,0>,r}
+sphere{<-0.05,0.45,0>,r}
+cylinder{<-0.05,0.45,0>,<-0.05,0.25,0>,r}
+sphere{<0.15,0.45,0>,r}
+cylinder{<0.15,0.45,0>,<0.15,0.25,0>,r}
+cylinder{<0.15,0.45,0>,<-0.05,0.45,0>,r}
+sphere{<-0.05,0.25,0.2>,r}
+cylinder{<-0.05,0.25,0.2>,<-0.05,0.25,0>,r}
+sphere{<0.15,0.25,0.2>,r}
+cylinder{<0.15,0.25,0.2>,<0.15,0.25,0>,r}
+cylinder{<0.15,0.25,0.2>,<-0.05,0.25,0.2>,r}
+sphere{<-0.05,0.45,0.2>,r}
+cylinder{<-0.05,0.45,0.2>,<-0.05,0.45,0>,r}
+cylinder{<-0.05,0.45,0.2>,<-0.05,0.25,0.2>,r}
+sphere{<0.15,0.45,0.2>,r}
+cylinder{<0.15,0.45,0.2>,<0.15,0.25,0.2>,r}
+cylinder{<0.15,0.45,0.2>,<0.15,0.45,0>,r}
+cylinder{<0.15,0.45,0.2>,<-0.05,0.45,0.2>,r}
+// cell 51
+sphere{<0.35,0.45,0>,r}
+sphere{<0.35,0.25,0>,r}
+cylinder{<0.35,0.25,0>,<0.35,0.45,0>,r}
+sphere{<0.35,0.45,0.2>,r}
+cylinder{<0.35,0.45,0.2>,<0.35,0.45,0>,r}
+sphere{<0.15,0.45,0>,r}
+cylinder{<0.15,0.45,0>,<0.35,0.45,0>,r}
+sphere{<0.35,0.25,0.2>,r}
+cylinder{<0.35,0.25,0.2>,<0.35,0.25,0>,r}
+cylinder{<0.35,0.25,0.2>,<0.35,0.45,0.2>,r}
+sphere{<0.15,0.45,0.2>,r}
+cylinder{<0.15,0.45,0.2>,<0.15,0.45,0>,r}
+cylinder{<0.15,0.45,0.2>,<0.35,0.45,0.2>,r}
+sphere{<0.15,0.25,0>,r}
+cylinder{<0.15,0.25,0>,<0.15,0.45,0>,r}
+cylinder{<0.15,0.25,0>,<0.35,0.25,0>,r}
+sphere{<0.15,0.25,0.2>,r}
+cylinder{<0.15,0.25,0.2>,<0.35,0.25,0.2>,r}
+cylinder{<0.15,0.25,0.2>,<0.15,0.45,0.2>,r}
+cylinder{<0.15,0.25,0.2>,<0.15,0.25,0>,r}
+// cell 52
+sphere{<0.55,0.45,0>,r}
+sphere{<0.55,0.25,0>,r}
+cylinder{<0.55,0.25,0>,<0.55,0.45,0>,r}
+sphere{<0.55,0.45,0.2>,r}
+cylinder{<0.55,0.45,0.2>,<0.55,0.45,0>,r}
+sphere{<0.35,0.45,0.2>,r}
+cylinder{<0.35,0.45,0.2>,<0.55,0.45,0.2>,r}
+sphere{<0.35,0.45,0>,r}
+cylinder{<0.35,0.45,0>,<0.55,0.45,0>,r}
+cylinder{<0.35,0.45,0>,<0.35,0.45,0.2>,r}
+sphere{<0.55,0.25,0.2>,r}
+cylinder{<0.55,0.25,0.2>,<0.55,0.25,0>,r}
+cylinder{<0.55,0.25,0.2>,<0.55,0.45,0.2>,r}
+sphere{<0.35,0.25,0>,r}
+cylinder{<0.35,0.25,0>,<0.35,0.45,0>,r}
+cylinder{<0.35,0.25,0>,<0.55,0.25,0>,r}
+sphere{<0.35,0.25,0.2>,r}
+cylinder{<0.35,0.25,0.2>,<0.35,0.45,0.2>,r}
+cylinder{<0.35,0.25,0.2>,<0.35,0.25,0>,r}
+cylinder{<0.35,0.25,0.2>,<0.55,0.25,0.2>,r}
+// cell 53
+sphere{<0.55,0.45,0.2>,r}
+sphere{<0.55,0.45,0>,r}
+cylinder{<0.55,0.45,0>,<0.55,0.45,0.2>,r}
+sphere{<0.75,0.45,0.2>,r}
+cylinder{<0.75,0.45,0.2>,<0.55,0.45,0.2>,r}
+sphere{<0.55,0.25,0.2>,r}
+cylinder{<0.55,0.25,0.2>,<0.55,0.45,0.2>,r}
+sphere{<0.75,0.25,0.2>,r}
+cylinder{<0.75,0.25,0.2>,<0.75,0.45,0.2>,r}
+cylinder{<0.75,0.25,0.2>,<0.55,0.25,0.2>,r}
+sphere{<0.55,0.25,0>,r}
+cylinder{<0.55,0.25,0>,<0.55,0.45,0>,r}
+cylinder{<0.55,0.25,0>,<0.55,0.25,0.2>,r}
+sphere{<0.75,0.45,0>,r}
+cylinder{<0.75,0.45,0>,<0.75,0.45,0.2>,r}
+cylinder{<0.75,0.45,0>,<0.55,0.45,0>,r}
+sphere{<0.75,0.25,0>,r}
+cylinder{<0.75,0.25,0>,<0.75,0.25,0.2>,r}
+cylinder{<0.75,0.25,0>,<0.55,0.25,0>,r}
+cylinder{<0.75,0.25,0>,<0.75,0.45,0>,r}
+// cell 54
+sphere{<0.769471,0.469471,0.219471>,r}
+sphere{<0.75,0.25,0>,r}
+sphere{<0.75,0.45,0>,r}
+cylinder{<0.75,0.45,0>,<0.75,0.25,0>,r}
+sphere{<0.978516,0.25,0>,r}
+cylinder{<0.978516,0.25,0>,<0.75,0.25,0>,r}
+sphere{<0.75,0.45,0.2>,r}
+cylinder{<0.75,0.45,0.2>,<0.769471,0.469471,0.219471>,r}
+cylinder{<0.75,0.45,0.2>,<0.75,0.45,0>,r}
+sphere{<0.853532,0.553532,0>,r}
+cylinder{<0.853532,0.553532,0>,<0.769471,0.469471,0.219471>,r}
+cylinder{<0.853532,0.553532,0>,<0.978516,0.25,0>,r}
+cylinder{<0.853532,0.553532,0>,<0.75,0.45,0>,r}
+sphere{<0.75,0.25,0.2>,r}
+cylinder{<0.75,0.25,0.2>,<0.75,0.45,0.2>,r}
+cylinder{<0.75,0.25,0.2>,<0.75,0.25,0>,r}
+sphere{<0.828126,0.25,0.278126>,r}
+cylinder{<0.828126,0.25,0.278126>,<0.75,0.25,0.2>,r}
+cylinder{<0.828126,0.25,0.278126>,<0.978516,0.25,0>,r}
+cylinder{<0.828126,0.25,0.278126>,<0.769471,0.469471,0.219471>,r}
+// cell 55
+sphere{<-0.65,0.45,0>,r}
+sphere{<-0.910072,0.45,0>,r}
+cylinder{<-0.910072,0.45,0>,<-0.65,0.45,0>,r}
+sphere{<-0.786065,0.45,0.2>,r}
+cylinder{<-0.786065,0.45,0.2>,<-0.910072,0.45,0>,r}
+sphere{<-0.65,0.65,0.182901>,r}
+sphere{<-0.65,0.65,0>,r}
+cylinder{<-0.65,0.65,0>,<-0.65,0.65,0.182901>,r}
+cylinder{<-0.65,0.65,0>,<-0.65,0.45,0>,r}
+sphere{<-0.715426,0.715426,0>,r}
+cylinder{<-0.715426,0.715426,0>,<-0.65,0.65,0>,r}
+cylinder{<-0.715426,0.715426,0>,<-0.910072,0.45,0>,r}
+cylinder{<-0.715426,0.715426,0>,<-0.65,0.65,0.182901>,r}
+sphere{<-0.707817,0.507817,0.257817>,r}
+cylinder{<-0.707817,0.507817,0.257817>,<-0.786065,0.45,0.2>,r}
+sphere{<-0.65,0.635543,0.2>,r}
+cylinder{<-0.65,0.635543,0.2>,<-0.65,0.65,0.182901>,r}
+cylinder{<-0.65,0.635543,0.2>,<-0.707817,0.507817,0.257817>,r}
+sphere{<-0.65,0.45,0.2>,r}
+cylinder{<-0.65,0.45,0.2>,<-0.707817,0.507817,0.257817>,r}
+cylinder{<-0.65,0.45,0.2>,<-0.786065,0.45,0.2>,r}
+cylinder{<-0.65,0.45,0.2>,<-0.65,0.45,0>,r}
+cylinder{<-0.65,0.45,0.2>,<-0.65,0.635543,0.2>,r}
+// cell 56
+sphere{<-0.65,0.45,0>,r}
+sphere{<-0.45,0.45,0>,r}
+cylinder{<-0.45,0.45,0>,<-0.65,0.45,0>,r}
+sphere{<-0.45,0.45,0.2>,r}
+cylinder{<-0.45,0.45,0.2>,<-0.45,0.45,0>,r}
+sphere{<-0.45,0.65,0>,r}
+cylinder{<-0.45,0.65,0>,<-0.45,0.45,0>,r}
+sphere{<-0.65,0.622792,0.2>,r}
+sphere{<-0.45,0.65,0.2>,r}
+cylinder{<-0.45,0.65,0.2>,<-0.45,0.45,0.2>,r}
+cylinder{<-0.45,0.65,0.2>,<-0.45,0.65,0>,r}
+sphere{<-0.65,0.65,0>,r}
+cylinder{<-0.65,0.65,0>,<-0.45,0.65,0>,r}
+cylinder{<-0.65,0.65,0>,<-0.65,0.45,0>,r}
+sphere{<-0.65,0.65,0.161522>,r}
+cylinder{<-0.65,0.65,0.161522>,<-0.65,0.65,0>,r}
+cylinder{<-0.65,0.65,0.161522>,<-0.65,0.622792,0.2>,r}
+sphere{<-0.65,0.45,0.2>,r}
+cylinder{<-0.65,0.45,0.2>,<-0.45,0.45,0.2>,r}
+cylinder{<-0.65,0.45,0.2>,<-0.65,0.622792,0.2>,r}
+cylinder{<-0.65,0.45,0.2>,<-0.65,0.45,0>,r}
+sphere{<-0.622792,0.65,0.2>,r}
+cylinder{<-0.622792,0.65,0.2>,<-0.45,0.65,0.2>,r}
+cylinder{<-0.622792,0.65,0.2>,<-0.65,0.65,0.161522>,r}
+cylinder{<-0.622792,0.65,0.2>,<-0.65,0.622792,0.2>,r}
+// cell 57
+sphere{<-0.45,0.65,0.2>,r}
+sphere{<-0.45,0.45,0.2>,r}
+cylinder{<-0.45,0.45,0.2>,<-0.45,0.65,0.2>,r}
+sphere{<-0.45,0.65,0>,r}
+cylinder{<-0.45,0.65,0>,<-0.45,0.65,0.2>,r}
+sphere{<-0.25,0.45,0>,r}
+sphere{<-0.25,0.65,0.2>,r}
+cylinder{<-0.25,0.65,0.2>,<-0.45,0.65,0.2>,r}
+sphere{<-0.25,0.45,0.2>,r}
+cylinder{<-0.25,0.45,0.2>,<-0.45,0.45,0.2>,r}
+cylinder{<-0.25,0.45,0.2>,<-0.25,0.45,0>,r}
+cylinder{<-0.25,0.45,0.2>,<-0.25,0.65,0.2>,r}
+sphere{<-0.45,0.45,0>,r}
+cylinder{<-0.45,0.45,0>,<-0.45,0.65,0>,r}
+cylinder{<-0.45,0.45,0>,<-0.25,0.45,0>,r}
+cylinder{<-0.45,0.45,0>,<-0.45,0.45,0.2>,r}
+sphere{<-0.25,0.65,0>,r}
+cylinder{<-0.25,0.65,0>,<-0.25,0.45,0>,r}
+cylinder{<-0.25,0.65,0>,<-0.45,0.65,0>,r}
+cylinder{<-0.25,0.65,0>,<-0.25,0.65,0.2>,r}
+// cell 58
+sphere{<-0.25,0.45,0>,r}
+sphere{<-0.05,0.45,0>,r}
+cylinder{<-0.05,0.45,0>,<-0.25,0.45,0>,r}
+sphere{<-0.05,0.65,0.2>,r}
+sphere{<-0.05,0.65,0>,r}
+cylinder{<-0.05,0.65,0>,<-0.05,0.45,0>,r}
+cylinder{<-0.05,0.65,0>,<-0.05,0.65,0.2>,r}
+sphere{<-0.25,0.65,0.2>,r}
+cylinder{<-0.25,0.65,0.2>,<-0.05,0.65,0.2>,r}
+sphere{<-0.05,0.45,0.2>,r}
+cylinder{<-0.05,0.45,0.2>,<-0.05,0.65,0.2>,r}
+cylinder{<-0.05,0.45,0.2>,<-0.05,0.45,0>,r}
+sphere{<-0.25,0.45,0.2>,r}
+cylinder{<-0.25,0.45,0.2>,<-0.25,0.65,0.2>,r}
+cylinder{<-0.25,0.45,0.2>,<-0.25,0.45,0>,r}
+cylinder{<-0.25,0.45,0.2>,<-0.05,0.45,0.2>,r}
+sphere{<-0.25,0.65,0>,r}
+cylinder{<-0.25,0.65,0>,<-0.25,0.65,0.2>,r}
+cylinder{<-0.25,0.65,0>,<-0.05,0.65,0>,r}
+cylinder{<-0.25,0.65,0>,<-0.25,0.45,0>,r}
+// cell 59
+sphere{<-0.05,0.45,0>,r}
+sphere{<-0.05,0.65,0>,r}
+cylinder{<-0.05,0.65,0>,<-0.05,0.45,0>,r}
+sphere{<0.15,0.65,0>,r}
+cylinder{<0.15,0.65,0>,<-0.05,0.65,0>,r}
+sphere{<-0.05,0.45,0.2>,r}
+cylinder{<-0.05,0.45,0.2>,<-0.05,0.45,0>,r}
+sphere{<0.15,0.65,0.2>,r}
+cylinder{<0.15,0.65,0.2>,<0.15,0.65,0>,r}
+sphere{<0.15,0.45,0>,r}
+cylinder{<0.15,0.45,0>,<-0.05,0.45,0>,r}
+cylinder{<0.15,0.45,0>,<0.15,0.65,0>,r}
+sphere{<-0.05,0.65,0.2>,r}
+cylinder{<-0.05,0.65,0.2>,<0.15,0.65,0.2>,r}
+cylinder{<-0.05,0.65,0.2>,<-0.05,0.65,0>,r}
+cylinder{<-0.05,0.65,0.2>,<-0.05,0.45,0.2>,r}
+sphere{<0.15,0.45,0.2>,r}
+cylinder{<0.15,0.45,0.2>,<0.15,0.65,0.2>,r}
+cylinder{<0.15,0.45,0.2>,<-0.05,0.45,0.2>,r}
+cylinder{<0.15,0.45,0.2>,<0.15,0.45,0>,r}
+// cell 60
+sphere{<0.35,0.65,0>,r}
+sphere{<0.35,0.45,0>,r}
+cylinder{<0.35,0.45,0>,<0.35,0.65,0>,r}
+sphere{<0.35,0.65,0.2>,r}
+cylinder{<0.35,0.65,0.2>,<0.35,0.65,0>,r}
+sphere{<0.15,0.65,0.2>,r}
+cylinder{<0.15,0.65,0.2>,<0.35,0.65,0.2>,r}
+sphere{<0.15,0.65,0>,r}
+cylinder{<0.15,0.65,0>,<0.35,0.65,0>,r}
+cylinder{<0.15,0.65,0>,<0.15,0.65,0.2>,r}
+sphere{<0.35,0.45,0.2>,r}
+cylinder{<0.35,0.45,0.2>,<0.35,0.45,0>,r}
+cylinder{<0.35,0.45,0.2>,<0.35,0.65,0.2>,r}
+sphere{<0.15,0.45,0.2>,r}
+cylinder{<0.15,0.45,0.2>,<0.15,0.65,0.2>,r}
+cylinder{<0.15,0.45,0.2>,<0.35,0.45,0.2>,r}
+sphere{<0.15,0.45,0>,r}
+cylinder{<0.15,0.45,0>,<0.15,0.65,0>,r}
+cylinder{<0.15,0.45,0>,<0.35,0.45,0>,r}
+cylinder{<0.15,0.45,0>,<0.15,0.45,0.2>,r}
+// cell 61
+sphere{<0.55,0.65,0>,r}
+sphere{<0.35,0.45,0>,r}
+sphere{<0.55,0.45,0.2>,r}
+sphere{<0.35,0.65,0>,r}
+cylinder{<0.35,0.65,0>,<0.55,0.65,0>,r}
+cylinder{<0.35,0.65,0>,<0.35,0.45,0>,r}
+sphere{<0.35,0.65,0.2>,r}
+cylinder{<0.35,0.65,0.2>,<0.35,0.65,0>,r}
+sphere{<0.55,0.45,0>,r}
+cylinder{<0.55,0.45,0>,<0.55,0.45,0.2>,r}
+cylinder{<0.55,0.45,0>,<0.35,0.45,0>,r}
+cylinder{<0.55,0.45,0>,<0.55,0.65,0>,r}
+sphere{<0.35,0.45,0.2>,r}
+cylinder{<0.35,0.45,0.2>,<0.35,0.65,0.2>,r}
+cylinder{<0.35,0.45,0.2>,<0.35,0.45,0>,r}
+cylinder{<0.35,0.45,0.2>,<0.55,0.45,0.2>,r}
+sphere{<0.55,0.65,0.2>,r}
+cylinder{<0.55,0.65,0.2>,<0.55,0.45,0.2>,r}
+cylinder{<0.55,0.65,0.2>,<0.55,0.65,0>,r}
+cylinder{<0.55,0.65,0.2>,<0.35,0.65,0.2>,r}
+// cell 62
+sphere{<0.55,0.65,0>,r}
+sphere{<0.55,0.45,0>,r}
+cylinder{<0.55,0.45,0>,<0.55,0.65,0>,r}
+sphere{<0.769267,0.469267,0.219267>,r}
+sphere{<0.847058,0.547058,0>,r}
+cylinder{<0.847058,0.547058,0>,<0.769267,0.469267,0.219267>,r}
+sphere{<0.64923,0.54923,0.29923>,r}
+cylinder{<0.64923,0.54923,0.29923>,<0.769267,0.469267,0.219267>,r}
+sphere{<0.75,0.45,0>,r}
+cylinder{<0.75,0.45,0>,<0.55,0.45,0>,r}
+cylinder{<0.75,0.45,0>,<0.847058,0.547058,0>,r}
+sphere{<0.581569,0.681569,0.231569>,r}
+cylinder{<0.581569,0.681569,0.231569>,<0.64923,0.54923,0.29923>,r}
+sphere{<0.663724,0.763724,0>,r}
+cylinder{<0.663724,0.763724,0>,<0.581569,0.681569,0.231569>,r}
+cylinder{<0.663724,0.763724,0>,<0.847058,0.547058,0>,r}
+cylinder{<0.663724,0.763724,0>,<0.55,0.65,0>,r}
+sphere{<0.55,0.65,0.2>,r}
+cylinder{<0.55,0.65,0.2>,<0.581569,0.681569,0.231569>,r}
+cylinder{<0.55,0.65,0.2>,<0.55,0.65,0>,r}
+sphere{<0.75,0.45,0.2>,r}
+cylinder{<0.75,0.45,0.2>,<0.75,0.45,0>,r}
+cylinder{<0.75,0.45,0.2>,<0.769267,0.469267,0.219267>,r}
+sphere{<0.55,0.45,0.2>,r}
+cylinder{<0.55,0.45,0.2>,<0.55,0.65,0.2>,r}
+cylinder{<0.55,0.45,0.2>,<0.55,0.45,0>,r}
+cylinder{<0.55,0.45,0.2>,<0.75,0.45,0.2>,r}
+cylinder{<0.55,0.45,0.2>,<0.64923,0.54923,0.29923>,r}
+// cell 63
+sphere{<-0.65,0.65,0>,r}
+sphere{<-0.45,0.65,0>,r}
+cylinder{<-0.45,0.65,0>,<-0.65,0.65,0>,r}
+sphere{<-0.507817,0.707817,0.257817>,r}
+sphere{<-0.45,0.910072,0>,r}
+cylinder{<-0.45,0.910072,0>,<-0.45,0.65,0>,r}
+sphere{<-0.65,0.65,0.182901>,r}
+cylinder{<-0.65,0.65,0.182901>,<-0.65,0.65,0>,r}
+sphere{<-0.715426,0.715426,0>,r}
+cylinder{<-0.715426,0.715426,0>,<-0.65,0.65,0.182901>,r}
+cylinder{<-0.715426,0.715426,0>,<-0.45,0.910072,0>,r}
+cylinder{<-0.715426,0.715426,0>,<-0.65,0.65,0>,r}
+sphere{<-0.45,0.786065,0.2>,r}
+cylinder{<-0.45,0.786065,0.2>,<-0.45,0.910072,0>,r}
+cylinder{<-0.45,0.786065,0.2>,<-0.507817,0.707817,0.257817>,r}
+sphere{<-0.45,0.65,0.2>,r}
+cylinder{<-0.45,0.65,0.2>,<-0.45,0.65,0>,r}
+cylinder{<-0.45,0.65,0.2>,<-0.45,0.786065,0.2>,r}
+cylinder{<-0.45,0.65,0.2>,<-0.507817,0.707817,0.257817>,r}
+sphere{<-0.635543,0.65,0.2>,r}
+cylinder{<-0.635543,0.65,0.2>,<-0.507817,0.707817,0.257817>,r}
+cylinder{<-0.635543,0.65,0.2>,<-0.65,0.65,0.182901>,r}
+cylinder{<-0.635543,0.65,0.2>,<-0.45,0.65,0.2>,r}
+// cell 64
+sphere{<-0.25,0.986863,0>,r}
+sphere{<-0.45,0.65,-1.38778e-17>,r}
+sphere{<-0.25,0.65,-1.38778e-17>,r}
+cylinder{<-0.25,0.65,-1.38778e-17>,<-0.45,0.65,-1.38778e-17>,r}
+cylinder{<-0.25,0.65,-1.38778e-17>,<-0.25,0.986863,0>,r}
+sphere{<-0.45,0.89353,0>,r}
+cylinder{<-0.45,0.89353,0>,<-0.25,0.986863,0>,r}
+cylinder{<-0.45,0.89353,0>,<-0.45,0.65,-1.38778e-17>,r}
+sphere{<-0.45,0.65,0.2>,r}
+cylinder{<-0.45,0.65,0.2>,<-0.45,0.65,-1.38778e-17>,r}
+sphere{<-0.25,0.65,0.2>,r}
+cylinder{<-0.25,0.65,0.2>,<-0.45,0.65,0.2>,r}
+cylinder{<-0.25,0.65,0.2>,<-0.25,0.65,-1.38778e-17>,r}
+sphere{<-0.25,0.87651,0.2>,r}
+cylinder{<-0.25,0.87651,0.2>,<-0.25,0.986863,0>,r}
+cylinder{<-0.25,0.87651,0.2>,<-0.25,0.65,0.2>,r}
+sphere{<-0.45,0.783177,0.2>,r}
+cylinder{<-0.45,0.783177,0.2>,<-0.25,0.87651,0.2>,r}
+cylinder{<-0.45,0.783177,0.2>,<-0.45,0.89353,0>,r}
+cylinder{<-0.45,0.783177,0.2>,<-0.45,0.65,0.2>,r}
+// cell 65
+sphere{<-0.25,0.65,0>,r}
+sphere{<-0.05,0.65,0>,r}
+cylinder{<-0.05,0.65,0>,<-0.25,0.65,0>,r}
+sphere{<-0.25,0.969804,0>,r}
+cylinder{<-0.25,0.969804,0>,<-0.25,0.65,0>,r}
+sphere{<-0.05,0.907824,0.2>,r}
+sphere{<-0.05,1.0098,0>,r}
+cylinder{<-0.05,1.0098,0>,<-0.05,0.65,0>,r}
+cylinder{<-0.05,1.0098,0>,<-0.25,0.969804,0>,r}
+cylinder{<-0.05,1.0098,0>,<-0.05,0.907824,0.2>,r}
+sphere{<-0.25,0.867824,0.2>,r}
+cylinder{<-0.25,0.867824,0.2>,<-0.05,0.907824,0.2>,r}
+cylinder{<-0.25,0.867824,0.2>,<-0.25,0.969804,0>,r}
+sphere{<-0.25,0.65,0.2>,r}
+cylinder{<-0.25,0.65,0.2>,<-0.25,0.867824,0.2>,r}
+cylinder{<-0.25,0.65,0.2>,<-0.25,0.65,0>,r}
+sphere{<-0.05,0.65,0.2>,r}
+cylinder{<-0.05,0.65,0.2>,<-0.05,0.907824,0.2>,r}
+cylinder{<-0.05,0.65,0.2>,<-0.25,0.65,0.2>,r}
+cylinder{<-0.05,0.65,0.2>,<-0.05,0.65,0>,r}
+// cell 66
+sphere{<-0.05,0.905331,0.2>,r}
+sphere{<0.15,0.65,0>,r}
+sphere{<-0.05,1.00555,0>,r}
+cylinder{<-0.05,1.00555,0>,<-0.05,0.905331,0.2>,r}
+sphere{<0.15,0.99222,0>,r}
+cylinder{<0.15,0.99222,0>,<0.15,0.65,0>,r}
+cylinder{<0.15,0.99222,0>,<-0.05,1.00555,0>,r}
+sphere{<-0.05,0.65,0.2>,r}
+cylinder{<-0.05,0.65,0.2>,<-0.05,0.905331,0.2>,r}
+sphere{<-0.05,0.65,0>,r}
+cylinder{<-0.05,0.65,0>,<-0.05,1.00555,0>,r}
+cylinder{<-0.05,0.65,0>,<0.15,0.65,0>,r}
+cylinder{<-0.05,0.65,0>,<-0.05,0.65,0.2>,r}
+sphere{<0.15,0.65,0.2>,r}
+cylinder{<0.15,0.65,0.2>,<-0.05,0.65,0.2>,r}
+cylinder{<0.15,0.65,0.2>,<0.15,0.65,0>,r}
+sphere{<0.15,0.891998,0.2>,r}
+cylinder{<0.15,0.891998,0.2>,<0.15,0.65,0.2>,r}
+cylinder{<0.15,0.891998,0.2>,<0.15,0.99222,0>,r}
+cylinder{<0.15,0.891998,0.2>,<-0.05,0.905331,0.2>,r}
+// cell 67
+sphere{<0.35,0.937426,0>,r}
+sphere{<0.15,0.65,0>,r}
+sphere{<0.15,1.00409,0>,r}
+cylinder{<0.15,1.00409,0>,<0.35,0.937426,0>,r}
+cylinder{<0.15,1.00409,0>,<0.15,0.65,0>,r}
+sphere{<0.15,0.65,0.2>,r}
+cylinder{<0.15,0.65,0.2>,<0.15,0.65,0>,r}
+sphere{<0.35,0.65,0.2>,r}
+cylinder{<0.35,0.65,0.2>,<0.15,0.65,0.2>,r}
+sphere{<0.35,0.65,0>,r}
+cylinder{<0.35,0.65,0>,<0.35,0.65,0.2>,r}
+cylinder{<0.35,0.65,0>,<0.15,0.65,0>,r}
+cylinder{<0.35,0.65,0>,<0.35,0.937426,0>,r}
+sphere{<0.35,0.832017,0.2>,r}
+cylinder{<0.35,0.832017,0.2>,<0.35,0.65,0.2>,r}
+cylinder{<0.35,0.832017,0.2>,<0.35,0.937426,0>,r}
+sphere{<0.15,0.898683,0.2>,r}
+cylinder{<0.15,0.898683,0.2>,<0.35,0.832017,0.2>,r}
+cylinder{<0.15,0.898683,0.2>,<0.15,1.00409,0>,r}
+cylinder{<0.15,0.898683,0.2>,<0.15,0.65,0.2>,r}
+// cell 68
+sphere{<0.35,0.95619,0>,r}
+sphere{<0.35,0.65,0>,r}
+cylinder{<0.35,0.65,0>,<0.35,0.95619,0>,r}
+sphere{<0.55,0.65,0.2>,r}
+sphere{<0.666369,0.766369,0>,r}
+cylinder{<0.666369,0.766369,0>,<0.35,0.95619,0>,r}
+sphere{<0.581868,0.681868,0.231868>,r}
+cylinder{<0.581868,0.681868,0.231868>,<0.55,0.65,0.2>,r}
+cylinder{<0.581868,0.681868,0.231868>,<0.666369,0.766369,0>,r}
+sphere{<0.55,0.65,0>,r}
+cylinder{<0.55,0.65,0>,<0.55,0.65,0.2>,r}
+cylinder{<0.55,0.65,0>,<0.35,0.65,0>,r}
+cylinder{<0.55,0.65,0>,<0.666369,0.766369,0>,r}
+sphere{<0.35,0.65,0.2>,r}
+cylinder{<0.35,0.65,0.2>,<0.35,0.65,0>,r}
+cylinder{<0.35,0.65,0.2>,<0.55,0.65,0.2>,r}
+sphere{<0.436836,0.736836,0.286836>,r}
+cylinder{<0.436836,0.736836,0.286836>,<0.35,0.65,0.2>,r}
+cylinder{<0.436836,0.736836,0.286836>,<0.581868,0.681868,0.231868>,r}
+sphere{<0.35,0.839571,0.2>,r}
+cylinder{<0.35,0.839571,0.2>,<0.436836,0.736836,0.286836>,r}
+cylinder{<0.35,0.839571,0.2>,<0.35,0.95619,0>,r}
+cylinder{<0.35,0.839571,0.2>,<0.35,0.65,0.2>,r}
+// cell 69
+sphere{<-0.25,-0.773989,0.4>,r}
+sphere{<-0.45,-0.75,0.2>,r}
+sphere{<-0.25,-0.75,0.2>,r}
+cylinder{<-0.25,-0.75,0.2>,<-0.45,-0.75,0.2>,r}
+sphere{<-0.25,-0.55,0.2>,r}
+cylinder{<-0.25,-0.55,0.2>,<-0.25,-0.75,0.2>,r}
+sphere{<-0.525593,-0.625593,0.4>,r}
+cylinder{<-0.525593,-0.625593,0.4>,<-0.25,-0.773989,0.4>,r}
+sphere{<-0.25,-0.55,0.4>,r}
+cylinder{<-0.25,-0.55,0.4>,<-0.25,-0.55,0.2>,r}
+cylinder{<-0.25,-0.55,0.4>,<-0.25,-0.773989,0.4>,r}
+sphere{<-0.25,-0.837739,0.287739>,r}
+cylinder{<-0.25,-0.837739,0.287739>,<-0.25,-0.75,0.2>,r}
+cylinder{<-0.25,-0.837739,0.287739>,<-0.25,-0.773989,0.4>,r}
+sphere{<-0.464182,-0.764182,0.214182>,r}
+cylinder{<-0.464182,-0.764182,0.214182>,<-0.45,-0.75,0.2>,r}
+cylinder{<-0.464182,-0.764182,0.214182>,<-0.25,-0.837739,0.287739>,r}
+sphere{<-0.45,-0.55,0.4>,r}
+cylinder{<-0.45,-0.55,0.4>,<-0.525593,-0.625593,0.4>,r}
+cylinder{<-0.45,-0.55,0.4>,<-0.25,-0.55,0.4>,r}
+sphere{<-0.559134,-0.659134,0.309134>,r}
+cylinder{<-0.559134,-0.659134,0.309134>,<-0.464182,-0.764182,0.214182>,r}
+cylinder{<-0.559134,-0.659134,0.309134>,<-0.525593,-0.625593,0.4>,r}
+sphere{<-0.45,-0.55,0.2>,r}
+cylinder{<-0.45,-0.55,0.2>,<-0.559134,-0.659134,0.309134>,r}
+cylinder{<-0.45,-0.55,0.2>,<-0.45,-0.55,0.4>,r}
+cylinder{<-0.45,-0.55,0.2>,<-0.25,-0.55,0.2>,r}
+cylinder{<-0.45,-0.55,0.2>,<-0.45,-0.75,0.2>,r}
+// cell 70
+sphere{<-0.05,-0.55,0.2>,r}
+sphere{<-0.05,-0.809487,0.4>,r}
+sphere{<-0.25,-0.55,0.2>,r}
+cylinder{<-0.25,-0.55,0.2>,<-0.05,-0.55,0.2>,r}
+sphere{<-0.25,-0.826636,0.276636>,r}
+sphere{<-0.25,-0.763333,0.4>,r}
+cylinder{<-0.25,-0.763333,0.4>,<-0.25,-0.826636,0.276636>,r}
+cylinder{<-0.25,-0.763333,0.4>,<-0.05,-0.809487,0.4>,r}
+sphere{<-0.25,-0.75,0.2>,r}
+cylinder{<-0.25,-0.75,0.2>,<-0.25,-0.826636,0.276636>,r}
+cylinder{<-0.25,-0.75,0.2>,<-0.25,-0.55,0.2>,r}
+sphere{<-0.05,-0.55,0.4>,r}
+cylinder{<-0.05,-0.55,0.4>,<-0.05,-0.809487,0.4>,r}
+cylinder{<-0.05,-0.55,0.4>,<-0.05,-0.55,0.2>,r}
+sphere{<-0.25,-0.55,0.4>,r}
+cylinder{<-0.25,-0.55,0.4>,<-0.25,-0.763333,0.4>,r}
+cylinder{<-0.25,-0.55,0.4>,<-0.05,-0.55,0.4>,r}
+cylinder{<-0.25,-0.55,0.4>,<-0.25,-0.55,0.2>,r}
+sphere{<-0.05,-0.75,0.2>,r}
+cylinder{<-0.05,-0.75,0.2>,<-0.25,-0.75,0.2>,r}
+cylinder{<-0.05,-0.75,0.2>,<-0.05,-0.55,0.2>,r}
+sphere{<-0.05,-0.857138,0.307138>,r}
+cylinder{<-0.05,-0.857138,0.307138>,<-0.05,-0.809487,0.4>,r}
+cylinder{<-0.05,-0.857138,0.307138>,<-0.25,-0.826636,0.276636>,r}
+cylinder{<-0.05,-0.857138,0.307138>,<-0.05,-0.75,0.2>,r}
+// cell 71
+sphere{<-0.05,-0.75,0.2>,r}
+sphere{<-0.05,-0.854234,0.304234>,r}
+cylinder{<-0.05,-0.854234,0.304234>,<-0.05,-0.75,0.2>,r}
+sphere{<-0.05,-0.55,0.4>,r}
+sphere{<0.15,-0.55,0.2>,r}
+sphere{<-0.05,-0.55,0.2>,r}
+cylinder{<-0.05,-0.55,0.2>,<0.15,-0.55,0.2>,r}
+cylinder{<-0.05,-0.55,0.2>,<-0.05,-0.75,0.2>,r}
+cylinder{<-0.05,-0.55,0.2>,<-0.05,-0.55,0.4>,r}
+sphere{<0.15,-0.55,0.4>,r}
+cylinder{<0.15,-0.55,0.4>,<0.15,-0.55,0.2>,r}
+cylinder{<0.15,-0.55,0.4>,<-0.05,-0.55,0.4>,r}
+sphere{<-0.05,-0.80621,0.4>,r}
+cylinder{<-0.05,-0.80621,0.4>,<-0.05,-0.55,0.4>,r}
+cylinder{<-0.05,-0.80621,0.4>,<-0.05,-0.854234,0.304234>,r}
+sphere{<0.15,-0.790825,0.4>,r}
+cylinder{<0.15,-0.790825,0.4>,<0.15,-0.55,0.4>,r}
+cylinder{<0.15,-0.790825,0.4>,<-0.05,-0.80621,0.4>,r}
+sphere{<0.15,-0.75,0.2>,r}
+cylinder{<0.15,-0.75,0.2>,<-0.05,-0.75,0.2>,r}
+cylinder{<0.15,-0.75,0.2>,<0.15,-0.55,0.2>,r}
+sphere{<0.15,-0.843988,0.293988>,r}
+cylinder{<0.15,-0.843988,0.293988>,<0.15,-0.790825,0.4>,r}
+cylinder{<0.15,-0.843988,0.293988>,<-0.05,-0.854234,0.304234>,r}
+cylinder{<0.15,-0.843988,0.293988>,<0.15,-0.75,0.2>,r}
+// cell 72
+sphere{<0.15,-0.55,0.2>,r}
+sphere{<0.35,-0.722516,0.4>,r}
+sphere{<0.35,-0.55,0.4>,r}
+cylinder{<0.35,-0.55,0.4>,<0.35,-0.722516,0.4>,r}
+sphere{<0.35,-0.55,0.2>,r}
+cylinder{<0.35,-0.55,0.2>,<0.35,-0.55,0.4>,r}
+cylinder{<0.35,-0.55,0.2>,<0.15,-0.55,0.2>,r}
+sphere{<0.15,-0.85196,0.30196>,r}
+sphere{<0.35,-0.80187,0.25187>,r}
+cylinder{<0.35,-0.80187,0.25187>,<0.35,-0.722516,0.4>,r}
+cylinder{<0.35,-0.80187,0.25187>,<0.15,-0.85196,0.30196>,r}
+sphere{<0.15,-0.55,0.4>,r}
+cylinder{<0.15,-0.55,0.4>,<0.35,-0.55,0.4>,r}
+cylinder{<0.15,-0.55,0.4>,<0.15,-0.55,0.2>,r}
+sphere{<0.15,-0.799439,0.4>,r}
+cylinder{<0.15,-0.799439,0.4>,<0.15,-0.85196,0.30196>,r}
+cylinder{<0.15,-0.799439,0.4>,<0.35,-0.722516,0.4>,r}
+cylinder{<0.15,-0.799439,0.4>,<0.15,-0.55,0.4>,r}
+sphere{<0.15,-0.75,0.2>,r}
+cylinder{<0.15,-0.75,0.2>,<0.15,-0.85196,0.30196>,r}
+cylinder{<0.15,-0.75,0.2>,<0.15,-0.55,0.2>,r}
+sphere{<0.35,-0.75,0.2>,r}
+cylinder{<0.35,-0.75,0.2>,<0.35,-0.55,0.2>,r}
+cylinder{<0.35,-0.75,0.2>,<0.35,-0.80187,0.25187>,r}
+cylinder{<0.35,-0.75,0.2>,<0.15,-0.75,0.2>,r}
+// cell 73
+sphere{<0.35,-0.813631,0.263631>,r}
+sphere{<0.55,-0.55,0.2>,r}
+sphere{<0.35,-0.55,0.2>,r}
+cylinder{<0.35,-0.55,0.2>,<0.55,-0.55,0.2>,r}
+sphere{<0.55,-0.55,0.4>,r}
+cylinder{<0.55,-0.55,0.4>,<0.55,-0.55,0.2>,r}
+sphere{<0.621232,-0.621232,0.271232>,r}
+cylinder{<0.621232,-0.621232,0.271232>,<0.55,-0.55,0.2>,r}
+sphere{<0.568361,-0.568361,0.418361>,r}
+cylinder{<0.568361,-0.568361,0.418361>,<0.621232,-0.621232,0.271232>,r}
+cylinder{<0.568361,-0.568361,0.418361>,<0.55,-0.55,0.4>,r}
+sphere{<0.35,-0.730701,0.4>,r}
+cylinder{<0.35,-0.730701,0.4>,<0.35,-0.813631,0.263631>,r}
+sphere{<0.428551,-0.628551,0.478551>,r}
+cylinder{<0.428551,-0.628551,0.478551>,<0.35,-0.730701,0.4>,r}
+cylinder{<0.428551,-0.628551,0.478551>,<0.568361,-0.568361,0.418361>,r}
+sphere{<0.55,-0.713865,0.2>,r}
+cylinder{<0.55,-0.713865,0.2>,<0.621232,-0.621232,0.271232>,r}
+cylinder{<0.55,-0.713865,0.2>,<0.55,-0.55,0.2>,r}
+sphere{<0.35,-0.75,0.2>,r}
+cylinder{<0.35,-0.75,0.2>,<0.35,-0.813631,0.263631>,r}
+cylinder{<0.35,-0.75,0.2>,<0.35,-0.55,0.2>,r}
+sphere{<0.410466,-0.810466,0.2>,r}
+cylinder{<0.410466,-0.810466,0.2>,<0.35,-0.75,0.2>,r}
+cylinder{<0.410466,-0.810466,0.2>,<0.55,-0.713865,0.2>,r}
+cylinder{<0.410466,-0.810466,0.2>,<0.35,-0.813631,0.263631>,r}
+sphere{<0.35,-0.55,0.4>,r}
+cylinder{<0.35,-0.55,0.4>,<0.55,-0.55,0.4>,r}
+cylinder{<0.35,-0.55,0.4>,<0.35,-0.55,0.2>,r}
+cylinder{<0.35,-0.55,0.4>,<0.35,-0.730701,0.4>,r}
+cylinder{<0.35,-0.55,0.4>,<0.428551,-0.628551,0.478551>,r}
+// cell 74
+sphere{<-0.45,-0.35,0.2>,r}
+sphere{<-0.703507,-0.403507,0.4>,r}
+sphere{<-0.556669,-0.656669,0.306669>,r}
+sphere{<-0.675507,-0.575507,0.225507>,r}
+cylinder{<-0.675507,-0.575507,0.225507>,<-0.556669,-0.656669,0.306669>,r}
+sphere{<-0.523507,-0.623507,0.4>,r}
+cylinder{<-0.523507,-0.623507,0.4>,<-0.703507,-0.403507,0.4>,r}
+cylinder{<-0.523507,-0.623507,0.4>,<-0.556669,-0.656669,0.306669>,r}
+sphere{<-0.45,-0.55,0.4>,r}
+cylinder{<-0.45,-0.55,0.4>,<-0.523507,-0.623507,0.4>,r}
+sphere{<-0.45,-0.35,0.4>,r}
+cylinder{<-0.45,-0.35,0.4>,<-0.45,-0.55,0.4>,r}
+cylinder{<-0.45,-0.35,0.4>,<-0.45,-0.35,0.2>,r}
+sphere{<-0.65,-0.55,0.2>,r}
+cylinder{<-0.65,-0.55,0.2>,<-0.675507,-0.575507,0.225507>,r}
+sphere{<-0.65,-0.35,0.4>,r}
+cylinder{<-0.65,-0.35,0.4>,<-0.45,-0.35,0.4>,r}
+cylinder{<-0.65,-0.35,0.4>,<-0.703507,-0.403507,0.4>,r}
+sphere{<-0.741912,-0.441912,0.291912>,r}
+cylinder{<-0.741912,-0.441912,0.291912>,<-0.675507,-0.575507,0.225507>,r}
+cylinder{<-0.741912,-0.441912,0.291912>,<-0.703507,-0.403507,0.4>,r}
+sphere{<-0.45,-0.55,0.2>,r}
+cylinder{<-0.45,-0.55,0.2>,<-0.65,-0.55,0.2>,r}
+cylinder{<-0.45,-0.55,0.2>,<-0.45,-0.35,0.2>,r}
+cylinder{<-0.45,-0.55,0.2>,<-0.45,-0.55,0.4>,r}
+cylinder{<-0.45,-0.55,0.2>,<-0.556669,-0.656669,0.306669>,r}
+sphere{<-0.65,-0.35,0.2>,r}
+cylinder{<-0.65,-0.35,0.2>,<-0.741912,-0.441912,0.291912>,r}
+cylinder{<-0.65,-0.35,0.2>,<-0.65,-0.35,0.4>,r}
+cylinder{<-0.65,-0.35,0.2>,<-0.45,-0.35,0.2>,r}
+cylinder{<-0.65,-0.35,0.2>,<-0.65,-0.55,0.2>,r}
+// cell 75
+sphere{<-0.45,-0.55,0.2>,r}
+sphere{<-0.25,-0.55,0.2>,r}
+cylinder{<-0.25,-0.55,0.2>,<-0.45,-0.55,0.2>,r}
+sphere{<-0.25,-0.35,0.2>,r}
+cylinder{<-0.25,-0.35,0.2>,<-0.25,-0.55,0.2>,r}
+sphere{<-0.25,-0.35,0.4>,r}
+cylinder{<-0.25,-0.35,0.4>,<-0.25,-0.35,0.2>,r}
+sphere{<-0.45,-0.35,0.2>,r}
+cylinder{<-0.45,-0.35,0.2>,<-0.25,-0.35,0.2>,r}
+cylinder{<-0.45,-0.35,0.2>,<-0.45,-0.55,0.2>,r}
+sphere{<-0.25,-0.55,0.4>,r}
+cylinder{<-0.25,-0.55,0.4>,<-0.25,-0.35,0.4>,r}
+cylinder{<-0.25,-0.55,0.4>,<-0.25,-0.55,0.2>,r}
+sphere{<-0.45,-0.55,0.4>,r}
+cylinder{<-0.45,-0.55,0.4>,<-0.45,-0.55,0.2>,r}
+cylinder{<-0.45,-0.55,0.4>,<-0.25,-0.55,0.4>,r}
+sphere{<-0.45,-0.35,0.4>,r}
+cylinder{<-0.45,-0.35,0.4>,<-0.25,-0.35,0.4>,r}
+cylinder{<-0.45,-0.35,0.4>,<-0.45,-0.35,0.2>,r}
+cylinder{<-0.45,-0.35,0.4>,<-0.45,-0.55,0.4>,r}
+// cell 76
+sphere{<-0.05,-0.55,0.4>,r}
+sphere{<-0.05,-0.55,0.2>,r}
+cylinder{<-0.05,-0.55,0.2>,<-0.05,-0.55,0.4>,r}
+sphere{<-0.25,-0.35,0.4>,r}
+sphere{<-0.05,-0.35,0.2>,r}
+cylinder{<-0.05,-0.35,0.2>,<-0.05,-0.55,0.2>,r}
+sphere{<-0.25,-0.55,0.4>,r}
+cylinder{<-0.25,-0.55,0.4>,<-0.05,-0.55,0.4>,r}
+cylinder{<-0.25,-0.55,0.4>,<-0.25,-0.35,0.4>,r}
+sphere{<-0.25,-0.35,0.2>,r}
+cylinder{<-0.25,-0.35,0.2>,<-0.25,-0.35,0.4>,r}
+cylinder{<-0.25,-0.35,0.2>,<-0.05,-0.35,0.2>,r}
+sphere{<-0.25,-0.55,0.2>,r}
+cylinder{<-0.25,-0.55,0.2>,<-0.05,-0.55,0.2>,r}
+cylinder{<-0.25,-0.55,0.2>,<-0.25,-0.55,0.4>,r}
+cylinder{<-0.25,-0.55,0.2>,<-0.25,-0.35,0.2>,r}
+sphere{<-0.05,-0.35,0.4>,r}
+cylinder{<-0.05,-0.35,0.4>,<-0.05,-0.35,0.2>,r}
+cylinder{<-0.05,-0.35,0.4>,<-0.25,-0.35,0.4>,r}
+cylinder{<-0.05,-0.35,0.4>,<-0.05,-0.55,0.4>,r}
+// cell 77
+sphere{<-0.05,-0.55,0.2>,r}
+sphere{<-0.05,-0.55,0.4>,r}
+cylinder{<-0.05,-0.55,0.4>,<-0.05,-0.55,0.2>,r}
+sphere{<-0.05,-0.35,0.2>,r}
+cylinder{<-0.05,-0.35,0.2>,<-0.05,-0.55,0.2>,r}
+sphere{<0.15,-0.35,0.2>,r}
+cylinder{<0.15,-0.35,0.2>,<-0.05,-0.35,0.2>,r}
+sphere{<-0.05,-0.35,0.4>,r}
+cylinder{<-0.05,-0.35,0.4>,<-0.05,-0.35,0.2>,r}
+cylinder{<-0.05,-0.35,0.4>,<-0.05,-0.55,0.4>,r}
+sphere{<0.15,-0.55,0.2>,r}
+cylinder{<0.15,-0.55,0.2>,<0.15,-0.35,0.2>,r}
+cylinder{<0.15,-0.55,0.2>,<-0.05,-0.55,0.2>,r}
+sphere{<0.15,-0.35,0.4>,r}
+cylinder{<0.15,-0.35,0.4>,<0.15,-0.35,0.2>,r}
+cylinder{<0.15,-0.35,0.4>,<-0.05,-0.35,0.4>,r}
+sphere{<0.15,-0.55,0.4>,r}
+cylinder{<0.15,-0.55,0.4>,<0.15,-0.35,0.4>,r}
+cylinder{<0.15,-0.55,0.4>,<-0.05,-0.55,0.4>,r}
+cylinder{<0.15,-0.55,0.4>,<0.15,-0.55,0.2>,r}
+// cell 78
+sphere{<0.15,-0.55,0.2>,r}
+sphere{<0.15,-0.55,0.4>,r}
+cylinder{<0.15,-0.55,0.4>,<0.15,-0.55,0.2>,r}
+sphere{<0.35,-0.35,0.4>,r}
+sphere{<0.35,-0.35,0.2>,r}
+cylinder{<0.35,-0.35,0.2>,<0.35,-0.35,0.4>,r}
+sphere{<0.35,-0.55,0.2>,r}
+cylinder{<0.35,-0.55,0.2>,<0.35,-0.35,0.2>,r}
+cylinder{<0.35,-0.55,0.2>,<0.15,-0.55,0.2>,r}
+sphere{<0.15,-0.35,0.4>,r}
+cylinder{<0.15,-0.35,0.4>,<0.35,-0.35,0.4>,r}
+cylinder{<0.15,-0.35,0.4>,<0.15,-0.55,0.4>,r}
+sphere{<0.15,-0.35,0.2>,r}
+cylinder{<0.15,-0.35,0.2>,<0.35,-0.35,0.2>,r}
+cylinder{<0.15,-0.35,0.2>,<0.15,-0.55,0.2>,r}
+cylinder{<0.15,-0.35,0.2>,<0.15,-0.35,0.4>,r}
+sphere{<0.35,-0.55,0.4>,r}
+cylinder{<0.35,-0.55,0.4>,<0.35,-0.35,0.4>,r}
+cylinder{<0.35,-0.55,0.4>,<0.15,-0.55,0.4>,r}
+cylinder{<0.35,-0.55,0.4>,<0.35,-0.55,0.2>,r}
+// cell 79
+sphere{<0.35,-0.55,0.2>,r}
+sphere{<0.55,-0.35,0.2>,r}
+sphere{<0.55,-0.35,0.4>,r}
+cylinder{<0.55,-0.35,0.4>,<0.55,-0.35,0.2>,r}
+sphere{<0.55,-0.55,0.4>,r}
+cylinder{<0.55,-0.55,0.4>,<0.55,-0.35,0.4>,r}
+sphere{<0.55,-0.55,0.2>,r}
+cylinder{<0.55,-0.55,0.2>,<0.55,-0.35,0.2>,r}
+cylinder{<0.55,-0.55,0.2>,<0.55,-0.55,0.4>,r}
+cylinder{<0.55,-0.55,0.2>,<0.35,-0.55,0.2>,r}
+sphere{<0.35,-0.35,0.4>,r}
+cylinder{<0.35,-0.35,0.4>,<0.55,-0.35,0.4>,r}
+sphere{<0.35,-0.35,0.2>,r}
+cylinder{<0.35,-0.35,0.2>,<0.55,-0.35,0.2>,r}
+cylinder{<0.35,-0.35,0.2>,<0.35,-0.55,0.2>,r}
+cylinder{<0.35,-0.35,0.2>,<0.35,-0.35,0.4>,r}
+sphere{<0.35,-0.55,0.4>,r}
+cylinder{<0.35,-0.55,0.4>,<0.35,-0.35,0.4>,r}
+cylinder{<0.35,-0.55,0.4>,<0.35,-0.55,0.2>,r}
+cylinder{<0.35,-0.55,0.4>,<0.55,-0.55,0.4>,r}
+// cell 80
+sphere{<0.730701,-0.35,0.4>,r}
+sphere{<0.713865,-0.55,0.2>,r}
+sphere{<0.55,-0.35,0.2>,r}
+sphere{<0.75,-0.35,0.2>,r}
+cylinder{<0.75,-0.35,0.2>,<0.55,-0.35,0.2>,r}
+sphere{<0.55,-0.55,0.4>,r}
+sphere{<0.621232,-0.621232,0.271232>,r}
+cylinder{<0.621232,-0.621232,0.271232>,<0.713865,-0.55,0.2>,r}
+sphere{<0.55,-0.55,0.2>,r}
+cylinder{<0.55,-0.55,0.2>,<0.713865,-0.55,0.2>,r}
+cylinder{<0.55,-0.55,0.2>,<0.621232,-0.621232,0.271232>,r}
+cylinder{<0.55,-0.55,0.2>,<0.55,-0.55,0.4>,r}
+cylinder{<0.55,-0.55,0.2>,<0.55,-0.35,0.2>,r}
+sphere{<0.568361,-0.568361,0.418361>,r}
+cylinder{<0.568361,-0.568361,0.418361>,<0.55,-0.55,0.4>,r}
+cylinder{<0.568361,-0.568361,0.418361>,<0.621232,-0.621232,0.271232>,r}
+sphere{<0.55,-0.35,0.4>,r}
+cylinder{<0.55,-0.35,0.4>,<0.730701,-0.35,0.4>,r}
+cylinder{<0.55,-0.35,0.4>,<0.55,-0.35,0.2>,r}
+cylinder{<0.55,-0.35,0.4>,<0.55,-0.55,0.4>,r}
+sphere{<0.628551,-0.428551,0.478551>,r}
+cylinder{<0.628551,-0.428551,0.478551>,<0.568361,-0.568361,0.418361>,r}
+cylinder{<0.628551,-0.428551,0.478551>,<0.730701,-0.35,0.4>,r}
+cylinder{<0.628551,-0.428551,0.478551>,<0.55,-0.35,0.4>,r}
+sphere{<0.813631,-0.35,0.263631>,r}
+cylinder{<0.813631,-0.35,0.263631>,<0.75,-0.35,0.2>,r}
+cylinder{<0.813631,-0.35,0.263631>,<0.730701,-0.35,0.4>,r}
+sphere{<0.810466,-0.410466,0.2>,r}
+cylinder{<0.810466,-0.410466,0.2>,<0.813631,-0.35,0.263631>,r}
+cylinder{<0.810466,-0.410466,0.2>,<0.713865,-0.55,0.2>,r}
+cylinder{<0.810466,-0.410466,0.2>,<0.75,-0.35,0.2>,r}
+// cell 81
+sphere{<-0.898683,-0.15,0.2>,r}
+sphere{<-0.747838,-0.447838,0.297838>,r}
+sphere{<-0.65,-0.35,0.2>,r}
+cylinder{<-0.65,-0.35,0.2>,<-0.747838,-0.447838,0.297838>,r}
+sphere{<-0.707456,-0.407456,0.4>,r}
+cylinder{<-0.707456,-0.407456,0.4>,<-0.747838,-0.447838,0.297838>,r}
+sphere{<-0.65,-0.15,0.2>,r}
+cylinder{<-0.65,-0.15,0.2>,<-0.65,-0.35,0.2>,r}
+cylinder{<-0.65,-0.15,0.2>,<-0.898683,-0.15,0.2>,r}
+sphere{<-0.65,-0.35,0.4>,r}
+cylinder{<-0.65,-0.35,0.4>,<-0.707456,-0.407456,0.4>,r}
+cylinder{<-0.65,-0.35,0.4>,<-0.65,-0.35,0.2>,r}
+sphere{<-0.65,-0.15,0.4>,r}
+cylinder{<-0.65,-0.15,0.4>,<-0.65,-0.35,0.4>,r}
+cylinder{<-0.65,-0.15,0.4>,<-0.65,-0.15,0.2>,r}
+sphere{<-0.743824,-0.15,0.493824>,r}
+cylinder{<-0.743824,-0.15,0.493824>,<-0.898683,-0.15,0.2>,r}
+cylinder{<-0.743824,-0.15,0.493824>,<-0.65,-0.15,0.4>,r}
+sphere{<-0.700167,-0.35,0.450167>,r}
+cylinder{<-0.700167,-0.35,0.450167>,<-0.65,-0.35,0.4>,r}
+cylinder{<-0.700167,-0.35,0.450167>,<-0.743824,-0.15,0.493824>,r}
+cylinder{<-0.700167,-0.35,0.450167>,<-0.707456,-0.407456,0.4>,r}
+sphere{<-0.832017,-0.35,0.2>,r}
+cylinder{<-0.832017,-0.35,0.2>,<-0.747838,-0.447838,0.297838>,r}
+cylinder{<-0.832017,-0.35,0.2>,<-0.898683,-0.15,0.2>,r}
+cylinder{<-0.832017,-0.35,0.2>,<-0.65,-0.35,0.2>,r}
+// cell 82
+sphere{<-0.65,-0.15,0.2>,r}
+sphere{<-0.45,-0.35,0.2>,r}
+sphere{<-0.45,-0.35,0.4>,r}
+cylinder{<-0.45,-0.35,0.4>,<-0.45,-0.35,0.2>,r}
+sphere{<-0.45,-0.15,0.4>,r}
+cylinder{<-0.45,-0.15,0.4>,<-0.45,-0.35,0.4>,r}
+sphere{<-0.65,-0.35,0.2>,r}
+cylinder{<-0.65,-0.35,0.2>,<-0.45,-0.35,0.2>,r}
+cylinder{<-0.65,-0.35,0.2>,<-0.65,-0.15,0.2>,r}
+sphere{<-0.65,-0.15,0.4>,r}
+cylinder{<-0.65,-0.15,0.4>,<-0.45,-0.15,0.4>,r}
+cylinder{<-0.65,-0.15,0.4>,<-0.65,-0.15,0.2>,r}
+sphere{<-0.45,-0.15,0.2>,r}
+cylinder{<-0.45,-0.15,0.2>,<-0.45,-0.15,0.4>,r}
+cylinder{<-0.45,-0.15,0.2>,<-0.45,-0.35,0.2>,r}
+cylinder{<-0.45,-0.15,0.2>,<-0.65,-0.15,0.2>,r}
+sphere{<-0.65,-0.35,0.4>,r}
+cylinder{<-0.65,-0.35,0.4>,<-0.65,-0.15,0.4>,r}
+cylinder{<-0.65,-0.35,0.4>,<-0.65,-0.35,0.2>,r}
+cylinder{<-0.65,-0.35,0.4>,<-0.45,-0.35,0.4>,r}
+// cell 83
+sphere{<-0.45,-0.35,0.2>,r}
+sphere{<-0.25,-0.35,0.2>,r}
+cylinder{<-0.25,-0.35,0.2>,<-0.45,-0.35,0.2>,r}
+sphere{<-0.25,-0.15,0.2>,r}
+cylinder{<-0.25,-0.15,0.2>,<-0.25,-0.35,0.2>,r}
+sphere{<-0.25,-0.15,0.4>,r}
+cylinder{<-0.25,-0.15,0.4>,<-0.25,-0.15,0.2>,r}
+sphere{<-0.45,-0.15,0.2>,r}
+cylinder{<-0.45,-0.15,0.2>,<-0.25,-0.15,0.2>,r}
+cylinder{<-0.45,-0.15,0.2>,<-0.45,-0.35,0.2>,r}
+sphere{<-0.25,-0.35,0.4>,r}
+cylinder{<-0.25,-0.35,0.4>,<-0.25,-0.15,0.4>,r}
+cylinder{<-0.25,-0.35,0.4>,<-0.25,-0.35,0.2>,r}
+sphere{<-0.45,-0.35,0.4>,r}
+cylinder{<-0.45,-0.35,0.4>,<-0.45,-0.35,0.2>,r}
+cylinder{<-0.45,-0.35,0.4>,<-0.25,-0.35,0.4>,r}
+sphere{<-0.45,-0.15,0.4>,r}
+cylinder{<-0.45,-0.15,0.4>,<-0.25,-0.15,0.4>,r}
+cylinder{<-0.45,-0.15,0.4>,<-0.45,-0.15,0.2>,r}
+cylinder{<-0.45,-0.15,0.4>,<-0.45,-0.35,0.4>,r}
+// cell 84
+sphere{<-0.25,-0.35,0.2>,r}
+sphere{<-0.05,-0.35,0.4>,r}
+sphere{<-0.25,-0.35,0.4>,r}
+cylinder{<-0.25,-0.35,0.4>,<-0.25,-0.35,0.2>,r}
+cylinder{<-0.25,-0.35,0.4>,<-0.05,-0.35,0.4>,r}
+sphere{<-0.25,-0.15,0.4>,r}
+cylinder{<-0.25,-0.15,0.4>,<-0.25,-0.35,0.4>,r}
+sphere{<-0.25,-0.15,0.2>,r}
+cylinder{<-0.25,-0.15,0.2>,<-0.25,-0.15,0.4>,r}
+cylinder{<-0.25,-0.15,0.2>,<-0.25,-0.35,0.2>,r}
+sphere{<-0.05,-0.35,0.2>,r}
+cylinder{<-0.05,-0.35,0.2>,<-0.05,-0.35,0.4>,r}
+cylinder{<-0.05,-0.35,0.2>,<-0.25,-0.35,0.2>,r}
+sphere{<-0.05,-0.15,0.4>,r}
+cylinder{<-0.05,-0.15,0.4>,<-0.25,-0.15,0.4>,r}
+cylinder{<-0.05,-0.15,0.4>,<-0.05,-0.35,0.4>,r}
+sphere{<-0.05,-0.15,0.2>,r}
+cylinder{<-0.05,-0.15,0.2>,<-0.25,-0.15,0.2>,r}
+cylinder{<-0.05,-0.15,0.2>,<-0.05,-0.15,0.4>,r}
+cylinder{<-0.05,-0.15,0.2>,<-0.05,-0.35,0.2>,r}
+// cell 85
+sphere{<-0.05,-0.15,0.2>,r}
+sphere{<0.15,-0.15,0.2>,r}
+cylinder{<0.15,-0.15,0.2>,<-0.05,-0.15,0.2>,r}
+sphere{<-0.05,-0.15,0.4>,r}
+cylinder{<-0.05,-0.15,0.4>,<-0.05,-0.15,0.2>,r}
+sphere{<-0.05,-0.35,0.2>,r}
+cylinder{<-0.05,-0.35,0.2>,<-0.05,-0.15,0.2>,r}
+sphere{<0.15,-0.15,0.4>,r}
+cylinder{<0.15,-0.15,0.4>,<0.15,-0.15,0.2>,r}
+cylinder{<0.15,-0.15,0.4>,<-0.05,-0.15,0.4>,r}
+sphere{<0.15,-0.35,0.4>,r}
+cylinder{<0.15,-0.35,0.4>,<0.15,-0.15,0.4>,r}
+sphere{<-0.05,-0.35,0.4>,r}
+cylinder{<-0.05,-0.35,0.4>,<0.15,-0.35,0.4>,r}
+cylinder{<-0.05,-0.35,0.4>,<-0.05,-0.15,0.4>,r}
+cylinder{<-0.05,-0.35,0.4>,<-0.05,-0.35,0.2>,r}
+sphere{<0.15,-0.35,0.2>,r}
+cylinder{<0.15,-0.35,0.2>,<0.15,-0.35,0.4>,r}
+cylinder{<0.15,-0.35,0.2>,<-0.05,-0.35,0.2>,r}
+cylinder{<0.15,-0.35,0.2>,<0.15,-0.15,0.2>,r}
+// cell 86
+sphere{<0.15,-0.35,0.2>,r}
+sphere{<0.35,-0.15,0.4>,r}
+sphere{<0.15,-0.15,0.4>,r}
+cylinder{<0.15,-0.15,0.4>,<0.35,-0.15,0.4>,r}
+sphere{<0.35,-0.15,0.2>,r}
+cylinder{<0.35,-0.15,0.2>,<0.35,-0.15,0.4>,r}
+sphere{<0.15,-0.35,0.4>,r}
+cylinder{<0.15,-0.35,0.4>,<0.15,-0.15,0.4>,r}
+cylinder{<0.15,-0.35,0.4>,<0.15,-0.35,0.2>,r}
+sphere{<0.35,-0.35,0.4>,r}
+cylinder{<0.35,-0.35,0.4>,<0.35,-0.15,0.4>,r}
+cylinder{<0.35,-0.35,0.4>,<0.15,-0.35,0.4>,r}
+sphere{<0.15,-0.15,0.2>,r}
+cylinder{<0.15,-0.15,0.2>,<0.35,-0.15,0.2>,r}
+cylinder{<0.15,-0.15,0.2>,<0.15,-0.35,0.2>,r}
+cylinder{<0.15,-0.15,0.2>,<0.15,-0.15,0.4>,r}
+sphere{<0.35,-0.35,0.2>,r}
+cylinder{<0.35,-0.35,0.2>,<0.35,-0.15,0.2>,r}
+cylinder{<0.35,-0.35,0.2>,<0.35,-0.35,0.4>,r}
+cylinder{<0.35,-0.35,0.2>,<0.15,-0.35,0.2>,r}
+// cell 87
+sphere{<0.35,-0.35,0.2>,r}
+sphere{<0.55,-0.35,0.4>,r}
+sphere{<0.35,-0.15,0.4>,r}
+sphere{<0.55,-0.15,0.2>,r}
+sphere{<0.35,-0.35,0.4>,r}
+cylinder{<0.35,-0.35,0.4>,<0.55,-0.35,0.4>,r}
+cylinder{<0.35,-0.35,0.4>,<0.35,-0.15,0.4>,r}
+cylinder{<0.35,-0.35,0.4>,<0.35,-0.35,0.2>,r}
+sphere{<0.55,-0.35,0.2>,r}
+cylinder{<0.55,-0.35,0.2>,<0.55,-0.15,0.2>,r}
+cylinder{<0.55,-0.35,0.2>,<0.55,-0.35,0.4>,r}
+cylinder{<0.55,-0.35,0.2>,<0.35,-0.35,0.2>,r}
+sphere{<0.35,-0.15,0.2>,r}
+cylinder{<0.35,-0.15,0.2>,<0.35,-0.15,0.4>,r}
+cylinder{<0.35,-0.15,0.2>,<0.55,-0.15,0.2>,r}
+cylinder{<0.35,-0.15,0.2>,<0.35,-0.35,0.2>,r}
+sphere{<0.55,-0.15,0.4>,r}
+cylinder{<0.55,-0.15,0.4>,<0.55,-0.35,0.4>,r}
+cylinder{<0.55,-0.15,0.4>,<0.55,-0.15,0.2>,r}
+cylinder{<0.55,-0.15,0.4>,<0.35,-0.15,0.4>,r}
+// cell 88
+sphere{<0.799439,-0.15,0.4>,r}
+sphere{<0.55,-0.15,0.4>,r}
+cylinder{<0.55,-0.15,0.4>,<0.799439,-0.15,0.4>,r}
+sphere{<0.75,-0.15,0.2>,r}
+sphere{<0.75,-0.35,0.2>,r}
+cylinder{<0.75,-0.35,0.2>,<0.75,-0.15,0.2>,r}
+sphere{<0.55,-0.35,0.2>,r}
+cylinder{<0.55,-0.35,0.2>,<0.75,-0.35,0.2>,r}
+sphere{<0.55,-0.15,0.2>,r}
+cylinder{<0.55,-0.15,0.2>,<0.55,-0.35,0.2>,r}
+cylinder{<0.55,-0.15,0.2>,<0.55,-0.15,0.4>,r}
+cylinder{<0.55,-0.15,0.2>,<0.75,-0.15,0.2>,r}
+sphere{<0.55,-0.35,0.4>,r}
+cylinder{<0.55,-0.35,0.4>,<0.55,-0.35,0.2>,r}
+cylinder{<0.55,-0.35,0.4>,<0.55,-0.15,0.4>,r}
+sphere{<0.722516,-0.35,0.4>,r}
+cylinder{<0.722516,-0.35,0.4>,<0.55,-0.35,0.4>,r}
+cylinder{<0.722516,-0.35,0.4>,<0.799439,-0.15,0.4>,r}
+sphere{<0.85196,-0.15,0.30196>,r}
+cylinder{<0.85196,-0.15,0.30196>,<0.75,-0.15,0.2>,r}
+cylinder{<0.85196,-0.15,0.30196>,<0.799439,-0.15,0.4>,r}
+sphere{<0.80187,-0.35,0.25187>,r}
+cylinder{<0.80187,-0.35,0.25187>,<0.85196,-0.15,0.30196>,r}
+cylinder{<0.80187,-0.35,0.25187>,<0.722516,-0.35,0.4>,r}
+cylinder{<0.80187,-0.35,0.25187>,<0.75,-0.35,0.2>,r}
+// cell 89
+sphere{<-0.891998,-0.15,0.2>,r}
+sphere{<-0.65,0.05,0.2>,r}
+sphere{<-0.905331,0.05,0.2>,r}
+cylinder{<-0.905331,0.05,0.2>,<-0.65,0.05,0.2>,r}
+cylinder{<-0.905331,0.05,0.2>,<-0.891998,-0.15,0.2>,r}
+sphere{<-0.65,-0.15,0.2>,r}
+cylinder{<-0.65,-0.15,0.2>,<-0.65,0.05,0.2>,r}
+cylinder{<-0.65,-0.15,0.2>,<-0.891998,-0.15,0.2>,r}
+sphere{<-0.75333,0.05,0.50333>,r}
+cylinder{<-0.75333,0.05,0.50333>,<-0.905331,0.05,0.2>,r}
+sphere{<-0.65,0.05,0.4>,r}
+cylinder{<-0.65,0.05,0.4>,<-0.65,0.05,0.2>,r}
+cylinder{<-0.65,0.05,0.4>,<-0.75333,0.05,0.50333>,r}
+sphere{<-0.744447,-0.15,0.494447>,r}
+cylinder{<-0.744447,-0.15,0.494447>,<-0.75333,0.05,0.50333>,r}
+cylinder{<-0.744447,-0.15,0.494447>,<-0.891998,-0.15,0.2>,r}
+sphere{<-0.65,-0.15,0.4>,r}
+cylinder{<-0.65,-0.15,0.4>,<-0.744447,-0.15,0.494447>,r}
+cylinder{<-0.65,-0.15,0.4>,<-0.65,-0.15,0.2>,r}
+cylinder{<-0.65,-0.15,0.4>,<-0.65,0.05,0.4>,r}
+// cell 90
+sphere{<-0.65,0.05,0.2>,r}
+sphere{<-0.45,-0.15,0.2>,r}
+sphere{<-0.65,-0.15,0.2>,r}
+cylinder{<-0.65,-0.15,0.2>,<-0.45,-0.15,0.2>,r}
+cylinder{<-0.65,-0.15,0.2>,<-0.65,0.05,0.2>,r}
+sphere{<-0.45,0.05,0.2>,r}
+cylinder{<-0.45,0.05,0.2>,<-0.45,-0.15,0.2>,r}
+cylinder{<-0.45,0.05,0.2>,<-0.65,0.05,0.2>,r}
+sphere{<-0.65,-0.15,0.4>,r}
+cylinder{<-0.65,-0.15,0.4>,<-0.65,-0.15,0.2>,r}
+sphere{<-0.65,0.05,0.4>,r}
+cylinder{<-0.65,0.05,0.4>,<-0.65,0.05,0.2>,r}
+cylinder{<-0.65,0.05,0.4>,<-0.65,-0.15,0.4>,r}
+sphere{<-0.45,0.05,0.4>,r}
+cylinder{<-0.45,0.05,0.4>,<-0.45,0.05,0.2>,r}
+cylinder{<-0.45,0.05,0.4>,<-0.65,0.05,0.4>,r}
+sphere{<-0.45,-0.15,0.4>,r}
+cylinder{<-0.45,-0.15,0.4>,<-0.45,-0.15,0.2>,r}
+cylinder{<-0.45,-0.15,0.4>,<-0.45,0.05,0.4>,r}
+cylinder{<-0.45,-0.15,0.4>,<-0.65,-0.15,0.4>,r}
+// cell 91
+sphere{<-0.45,-0.15,0.2>,r}
+sphere{<-0.25,-0.15,0.2>,r}
+cylinder{<-0.25,-0.15,0.2>,<-0.45,-0.15,0.2>,r}
+sphere{<-0.45,0.05,0.2>,r}
+cylinder{<-0.45,0.05,0.2>,<-0.45,-0.15,0.2>,r}
+sphere{<-0.25,0.05,0.2>,r}
+cylinder{<-0.25,0.05,0.2>,<-0.45,0.05,0.2>,r}
+cylinder{<-0.25,0.05,0.2>,<-0.25,-0.15,0.2>,r}
+sphere{<-0.45,-0.15,0.4>,r}
+cylinder{<-0.45,-0.15,0.4>,<-0.45,-0.15,0.2>,r}
+sphere{<-0.25,-0.15,0.4>,r}
+cylinder{<-0.25,-0.15,0.4>,<-0.45,-0.15,0.4>,r}
+cylinder{<-0.25,-0.15,0.4>,<-0.25,-0.15,0.2>,r}
+sphere{<-0.45,0.05,0.4>,r}
+cylinder{<-0.45,0.05,0.4>,<-0.45,0.05,0.2>,r}
+cylinder{<-0.45,0.05,0.4>,<-0.45,-0.15,0.4>,r}
+sphere{<-0.25,0.05,0.4>,r}
+cylinder{<-0.25,0.05,0.4>,<-0.25,0.05,0.2>,r}
+cylinder{<-0.25,0.05,0.4>,<-0.45,0.05,0.4>,r}
+cylinder{<-0.25,0.05,0.4>,<-0.25,-0.15,0.4>,r}
+// cell 92
+sphere{<-0.25,-0.15,0.2>,r}
+sphere{<-0.05,-0.15,0.2>,r}
+cylinder{<-0.05,-0.15,0.2>,<-0.25,-0.15,0.2>,r}
+sphere{<-0.05,0.05,0.4>,r}
+sphere{<-0.25,0.05,0.4>,r}
+cylinder{<-0.25,0.05,0.4>,<-0.05,0.05,0.4>,r}
+sphere{<-0.25,0.05,0.2>,r}
+cylinder{<-0.25,0.05,0.2>,<-0.25,0.05,0.4>,r}
+cylinder{<-0.25,0.05,0.2>,<-0.25,-0.15,0.2>,r}
+sphere{<-0.05,-0.15,0.4>,r}
+cylinder{<-0.05,-0.15,0.4>,<-0.05,0.05,0.4>,r}
+cylinder{<-0.05,-0.15,0.4>,<-0.05,-0.15,0.2>,r}
+sphere{<-0.05,0.05,0.2>,r}
+cylinder{<-0.05,0.05,0.2>,<-0.25,0.05,0.2>,r}
+cylinder{<-0.05,0.05,0.2>,<-0.05,0.05,0.4>,r}
+cylinder{<-0.05,0.05,0.2>,<-0.05,-0.15,0.2>,r}
+sphere{<-0.25,-0.15,0.4>,r}
+cylinder{<-0.25,-0.15,0.4>,<-0.25,0.05,0.4>,r}
+cylinder{<-0.25,-0.15,0.4>,<-0.25,-0.15,0.2>,r}
+cylinder{<-0.25,-0.15,0.4>,<-0.05,-0.15,0.4>,r}
+// cell 93
+sphere{<0.15,0.05,0.2>,r}
+sphere{<0.15,-0.15,0.2>,r}
+cylinder{<0.15,-0.15,0.2>,<0.15,0.05,0.2>,r}
+sphere{<-0.05,0.05,0.4>,r}
+sphere{<0.15,0.05,0.4>,r}
+cylinder{<0.15,0.05,0.4>,<0.15,0.05,0.2>,r}
+cylinder{<0.15,0.05,0.4>,<-0.05,0.05,0.4>,r}
+sphere{<-0.05,-0.15,0.4>,r}
+cylinder{<-0.05,-0.15,0.4>,<-0.05,0.05,0.4>,r}
+sphere{<0.15,-0.15,0.4>,r}
+cylinder{<0.15,-0.15,0.4>,<-0.05,-0.15,0.4>,r}
+cylinder{<0.15,-0.15,0.4>,<0.15,-0.15,0.2>,r}
+cylinder{<0.15,-0.15,0.4>,<0.15,0.05,0.4>,r}
+sphere{<-0.05,0.05,0.2>,r}
+cylinder{<-0.05,0.05,0.2>,<-0.05,0.05,0.4>,r}
+cylinder{<-0.05,0.05,0.2>,<0.15,0.05,0.2>,r}
+sphere{<-0.05,-0.15,0.2>,r}
+cylinder{<-0.05,-0.15,0.2>,<-0.05,-0.15,0.4>,r}
+cylinder{<-0.05,-0.15,0.2>,<-0.05,0.05,0.2>,r}
+cylinder{<-0.05,-0.15,0.2>,<0.15,-0.15,0.2>,r}
+// cell 94
+sphere{<0.35,0.05,0.2>,r}
+sphere{<0.15,0.05,0.4>,r}
+sphere{<0.35,0.05,0.4>,r}
+cylinder{<0.35,0.05,0.4>,<0.35,0.05,0.2>,r}
+cylinder{<0.35,0.05,0.4>,<0.15,0.05,0.4>,r}
+sphere{<0.35,-0.15,0.2>,r}
+cylinder{<0.35,-0.15,0.2>,<0.35,0.05,0.2>,r}
+sphere{<0.15,-0.15,0.4>,r}
+cylinder{<0.15,-0.15,0.4>,<0.15,0.05,0.4>,r}
+sphere{<0.15,0.05,0.2>,r}
+cylinder{<0.15,0.05,0.2>,<0.15,0.05,0.4>,r}
+cylinder{<0.15,0.05,0.2>,<0.35,0.05,0.2>,r}
+sphere{<0.15,-0.15,0.2>,r}
+cylinder{<0.15,-0.15,0.2>,<0.15,-0.15,0.4>,r}
+cylinder{<0.15,-0.15,0.2>,<0.15,0.05,0.2>,r}
+cylinder{<0.15,-0.15,0.2>,<0.35,-0.15,0.2>,r}
+sphere{<0.35,-0.15,0.4>,r}
+cylinder{<0.35,-0.15,0.4>,<0.15,-0.15,0.4>,r}
+cylinder{<0.35,-0.15,0.4>,<0.35,-0.15,0.2>,r}
+cylinder{<0.35,-0.15,0.4>,<0.35,0.05,0.4>,r}
+// cell 95
+sphere{<0.35,-0.15,0.2>,r}
+sphere{<0.55,-0.15,0.4>,r}
+sphere{<0.35,0.05,0.2>,r}
+cylinder{<0.35,0.05,0.2>,<0.35,-0.15,0.2>,r}
+sphere{<0.35,-0.15,0.4>,r}
+cylinder{<0.35,-0.15,0.4>,<0.55,-0.15,0.4>,r}
+cylinder{<0.35,-0.15,0.4>,<0.35,-0.15,0.2>,r}
+sphere{<0.55,-0.15,0.2>,r}
+cylinder{<0.55,-0.15,0.2>,<0.55,-0.15,0.4>,r}
+cylinder{<0.55,-0.15,0.2>,<0.35,-0.15,0.2>,r}
+sphere{<0.55,0.05,0.2>,r}
+cylinder{<0.55,0.05,0.2>,<0.35,0.05,0.2>,r}
+cylinder{<0.55,0.05,0.2>,<0.55,-0.15,0.2>,r}
+sphere{<0.35,0.05,0.4>,r}
+cylinder{<0.35,0.05,0.4>,<0.35,0.05,0.2>,r}
+cylinder{<0.35,0.05,0.4>,<0.35,-0.15,0.4>,r}
+sphere{<0.55,0.05,0.4>,r}
+cylinder{<0.55,0.05,0.4>,<0.55,-0.15,0.4>,r}
+cylinder{<0.55,0.05,0.4>,<0.55,0.05,0.2>,r}
+cylinder{<0.55,0.05,0.4>,<0.35,0.05,0.4>,r}
+// cell 96
+sphere{<0.790825,-0.15,0.4>,r}
+sphere{<0.75,0.05,0.2>,r}
+sphere{<0.55,0.05,0.2>,r}
+cylinder{<0.55,0.05,0.2>,<0.75,0.05,0.2>,r}
+sphere{<0.854234,0.05,0.304234>,r}
+cylinder{<0.854234,0.05,0.304234>,<0.75,0.05,0.2>,r}
+sphere{<0.80621,0.05,0.4>,r}
+cylinder{<0.80621,0.05,0.4>,<0.790825,-0.15,0.4>,r}
+cylinder{<0.80621,0.05,0.4>,<0.854234,0.05,0.304234>,r}
+sphere{<0.55,-0.15,0.2>,r}
+cylinder{<0.55,-0.15,0.2>,<0.55,0.05,0.2>,r}
+sphere{<0.55,0.05,0.4>,r}
+cylinder{<0.55,0.05,0.4>,<0.80621,0.05,0.4>,r}
+cylinder{<0.55,0.05,0.4>,<0.55,0.05,0.2>,r}
+sphere{<0.55,-0.15,0.4>,r}
+cylinder{<0.55,-0.15,0.4>,<0.55,0.05,0.4>,r}
+cylinder{<0.55,-0.15,0.4>,<0.55,-0.15,0.2>,r}
+cylinder{<0.55,-0.15,0.4>,<0.790825,-0.15,0.4>,r}
+sphere{<0.843988,-0.15,0.293988>,r}
+cylinder{<0.843988,-0.15,0.293988>,<0.854234,0.05,0.304234>,r}
+cylinder{<0.843988,-0.15,0.293988>,<0.790825,-0.15,0.4>,r}
+sphere{<0.75,-0.15,0.2>,r}
+cylinder{<0.75,-0.15,0.2>,<0.55,-0.15,0.2>,r}
+cylinder{<0.75,-0.15,0.2>,<0.75,0.05,0.2>,r}
+cylinder{<0.75,-0.15,0.2>,<0.843988,-0.15,0.293988>,r}
+// cell 97
+sphere{<-0.65,0.25,0.2>,r}
+sphere{<-0.65,0.05,0.4>,r}
+sphere{<-0.726722,0.25,0.476722>,r}
+sphere{<-0.867824,0.25,0.2>,r}
+cylinder{<-0.867824,0.25,0.2>,<-0.726722,0.25,0.476722>,r}
+cylinder{<-0.867824,0.25,0.2>,<-0.65,0.25,0.2>,r}
+sphere{<-0.907824,0.05,0.2>,r}
+cylinder{<-0.907824,0.05,0.2>,<-0.867824,0.25,0.2>,r}
+sphere{<-0.65,0.05,0.2>,r}
+cylinder{<-0.65,0.05,0.2>,<-0.907824,0.05,0.2>,r}
+cylinder{<-0.65,0.05,0.2>,<-0.65,0.25,0.2>,r}
+cylinder{<-0.65,0.05,0.2>,<-0.65,0.05,0.4>,r}
+sphere{<-0.65,0.25,0.4>,r}
+cylinder{<-0.65,0.25,0.4>,<-0.726722,0.25,0.476722>,r}
+cylinder{<-0.65,0.25,0.4>,<-0.65,0.05,0.4>,r}
+cylinder{<-0.65,0.25,0.4>,<-0.65,0.25,0.2>,r}
+sphere{<-0.753214,0.05,0.503214>,r}
+cylinder{<-0.753214,0.05,0.503214>,<-0.726722,0.25,0.476722>,r}
+cylinder{<-0.753214,0.05,0.503214>,<-0.907824,0.05,0.2>,r}
+cylinder{<-0.753214,0.05,0.503214>,<-0.65,0.05,0.4>,r}
+// cell 98
+sphere{<-0.65,0.05,0.2>,r}
+sphere{<-0.45,0.25,0.4>,r}
+sphere{<-0.45,0.25,0.2>,r}
+cylinder{<-0.45,0.25,0.2>,<-0.45,0.25,0.4>,r}
+sphere{<-0.45,0.05,0.2>,r}
+cylinder{<-0.45,0.05,0.2>,<-0.45,0.25,0.2>,r}
+cylinder{<-0.45,0.05,0.2>,<-0.65,0.05,0.2>,r}
+sphere{<-0.65,0.25,0.2>,r}
+cylinder{<-0.65,0.25,0.2>,<-0.45,0.25,0.2>,r}
+cylinder{<-0.65,0.25,0.2>,<-0.65,0.05,0.2>,r}
+sphere{<-0.65,0.25,0.4>,r}
+cylinder{<-0.65,0.25,0.4>,<-0.45,0.25,0.4>,r}
+cylinder{<-0.65,0.25,0.4>,<-0.65,0.25,0.2>,r}
+sphere{<-0.45,0.05,0.4>,r}
+cylinder{<-0.45,0.05,0.4>,<-0.45,0.05,0.2>,r}
+cylinder{<-0.45,0.05,0.4>,<-0.45,0.25,0.4>,r}
+sphere{<-0.65,0.05,0.4>,r}
+cylinder{<-0.65,0.05,0.4>,<-0.65,0.25,0.4>,r}
+cylinder{<-0.65,0.05,0.4>,<-0.65,0.05,0.2>,r}
+cylinder{<-0.65,0.05,0.4>,<-0.45,0.05,0.4>,r}
+// cell 99
+sphere{<-0.25,0.05,0.4>,r}
+sphere{<-0.25,0.25,0.4>,r}
+cylinder{<-0.25,0.25,0.4>,<-0.25,0.05,0.4>,r}
+sphere{<-0.25,0.25,0.2>,r}
+cylinder{<-0.25,0.25,0.2>,<-0.25,0.25,0.4>,r}
+sphere{<-0.45,0.25,0.2>,r}
+cylinder{<-0.45,0.25,0.2>,<-0.25,0.25,0.2>,r}
+sphere{<-0.45,0.25,0.4>,r}
+cylinder{<-0.45,0.25,0.4>,<-0.45,0.25,0.2>,r}
+cylinder{<-0.45,0.25,0.4>,<-0.25,0.25,0.4>,r}
+sphere{<-0.25,0.05,0.2>,r}
+cylinder{<-0.25,0.05,0.2>,<-0.25,0.25,0.2>,r}
+cylinder{<-0.25,0.05,0.2>,<-0.25,0.05,0.4>,r}
+sphere{<-0.45,0.05,0.2>,r}
+cylinder{<-0.45,0.05,0.2>,<-0.45,0.25,0.2>,r}
+cylinder{<-0.45,0.05,0.2>,<-0.25,0.05,0.2>,r}
+sphere{<-0.45,0.05,0.4>,r}
+cylinder{<-0.45,0.05,0.4>,<-0.45,0.25,0.4>,r}
+cylinder{<-0.45,0.05,0.4>,<-0.45,0.05,0.2>,r}
+cylinder{<-0.45,0.05,0.4>,<-0.25,0.05,0.4>,r}
+// cell 100
+sphere{<-0.25,0.05,0.2>,r}
+sphere{<-0.05,0.05,0.2>,r}
+cylinder{<-0.05,0.05,0.2>,<-0.25,0.05,0.2>,r}
+sphere{<-0.25,0.05,0.4>,r}
+cylinder{<-0.25,0.05,0.4>,<-0.25,0.05,0.2>,r}
+sphere{<-0.05,0.25,0.4>,r}
+sphere{<-0.25,0.25,0.2>,r}
+cylinder{<-0.25,0.25,0.2>,<-0.25,0.05,0.2>,r}
+sphere{<-0.05,0.05,0.4>,r}
+cylinder{<-0.05,0.05,0.4>,<-0.05,0.25,0.4>,r}
+cylinder{<-0.05,0.05,0.4>,<-0.25,0.05,0.4>,r}
+cylinder{<-0.05,0.05,0.4>,<-0.05,0.05,0.2>,r}
+sphere{<-0.05,0.25,0.2>,r}
+cylinder{<-0.05,0.25,0.2>,<-0.05,0.25,0.4>,r}
+cylinder{<-0.05,0.25,0.2>,<-0.05,0.05,0.2>,r}
+cylinder{<-0.05,0.25,0.2>,<-0.25,0.25,0.2>,r}
+sphere{<-0.25,0.25,0.4>,r}
+cylinder{<-0.25,0.25,0.4>,<-0.25,0.05,0.4>,r}
+cylinder{<-0.25,0.25,0.4>,<-0.05,0.25,0.4>,r}
+cylinder{<-0.25,0.25,0.4>,<-0.25,0.25,0.2>,r}
+// cell 101
+sphere{<0.15,0.25,0.2>,r}
+sphere{<0.15,0.05,0.2>,r}
+cylinder{<0.15,0.05,0.2>,<0.15,0.25,0.2>,r}
+sphere{<-0.05,0.25,0.2>,r}
+cylinder{<-0.05,0.25,0.2>,<0.15,0.25,0.2>,r}
+sphere{<-0.05,0.05,0.4>,r}
+sphere{<-0.05,0.25,0.4>,r}
+cylinder{<-0.05,0.25,0.4>,<-0.05,0.25,0.2>,r}
+cylinder{<-0.05,0.25,0.4>,<-0.05,0.05,0.4>,r}
+sphere{<0.15,0.05,0.4>,r}
+cylinder{<0.15,0.05,0.4>,<0.15,0.05,0.2>,r}
+cylinder{<0.15,0.05,0.4>,<-0.05,0.05,0.4>,r}
+sphere{<0.15,0.25,0.4>,r}
+cylinder{<0.15,0.25,0.4>,<-0.05,0.25,0.4>,r}
+cylinder{<0.15,0.25,0.4>,<0.15,0.05,0.4>,r}
+cylinder{<0.15,0.25,0.4>,<0.15,0.25,0.2>,r}
+sphere{<-0.05,0.05,0.2>,r}
+cylinder{<-0.05,0.05,0.2>,<-0.05,0.05,0.4>,r}
+cylinder{<-0.05,0.05,0.2>,<-0.05,0.25,0.2>,r}
+cylinder{<-0.05,0.05,0.2>,<0.15,0.05,0.2>,r}
+// cell 102
+sphere{<0.15,0.05,0.2>,r}
+sphere{<0.35,0.05,0.2>,r}
+cylinder{<0.35,0.05,0.2>,<0.15,0.05,0.2>,r}
+sphere{<0.35,0.25,0.4>,r}
+sphere{<0.35,0.25,0.2>,r}
+cylinder{<0.35,0.25,0.2>,<0.35,0.25,0.4>,r}
+cylinder{<0.35,0.25,0.2>,<0.35,0.05,0.2>,r}
+sphere{<0.15,0.05,0.4>,r}
+cylinder{<0.15,0.05,0.4>,<0.15,0.05,0.2>,r}
+sphere{<0.35,0.05,0.4>,r}
+cylinder{<0.35,0.05,0.4>,<0.15,0.05,0.4>,r}
+cylinder{<0.35,0.05,0.4>,<0.35,0.05,0.2>,r}
+cylinder{<0.35,0.05,0.4>,<0.35,0.25,0.4>,r}
+sphere{<0.15,0.25,0.2>,r}
+cylinder{<0.15,0.25,0.2>,<0.35,0.25,0.2>,r}
+cylinder{<0.15,0.25,0.2>,<0.15,0.05,0.2>,r}
+sphere{<0.15,0.25,0.4>,r}
+cylinder{<0.15,0.25,0.4>,<0.35,0.25,0.4>,r}
+cylinder{<0.15,0.25,0.4>,<0.15,0.25,0.2>,r}
+cylinder{<0.15,0.25,0.4>,<0.15,0.05,0.4>,r}
+// cell 103
+sphere{<0.35,0.05,0.2>,r}
+sphere{<0.55,0.05,0.2>,r}
+cylinder{<0.55,0.05,0.2>,<0.35,0.05,0.2>,r}
+sphere{<0.55,0.25,0.2>,r}
+cylinder{<0.55,0.25,0.2>,<0.55,0.05,0.2>,r}
+sphere{<0.55,0.25,0.4>,r}
+cylinder{<0.55,0.25,0.4>,<0.55,0.25,0.2>,r}
+sphere{<0.35,0.05,0.4>,r}
+cylinder{<0.35,0.05,0.4>,<0.35,0.05,0.2>,r}
+sphere{<0.35,0.25,0.4>,r}
+cylinder{<0.35,0.25,0.4>,<0.55,0.25,0.4>,r}
+cylinder{<0.35,0.25,0.4>,<0.35,0.05,0.4>,r}
+sphere{<0.35,0.25,0.2>,r}
+cylinder{<0.35,0.25,0.2>,<0.55,0.25,0.2>,r}
+cylinder{<0.35,0.25,0.2>,<0.35,0.05,0.2>,r}
+cylinder{<0.35,0.25,0.2>,<0.35,0.25,0.4>,r}
+sphere{<0.55,0.05,0.4>,r}
+cylinder{<0.55,0.05,0.4>,<0.35,0.05,0.4>,r}
+cylinder{<0.55,0.05,0.4>,<0.55,0.05,0.2>,r}
+cylinder{<0.55,0.05,0.4>,<0.55,0.25,0.4>,r}
+// cell 104
+sphere{<0.75,0.25,0.2>,r}
+sphere{<0.55,0.05,0.2>,r}
+sphere{<0.55,0.25,0.2>,r}
+cylinder{<0.55,0.25,0.2>,<0.55,0.05,0.2>,r}
+cylinder{<0.55,0.25,0.2>,<0.75,0.25,0.2>,r}
+sphere{<0.55,0.25,0.4>,r}
+cylinder{<0.55,0.25,0.4>,<0.55,0.25,0.2>,r}
+sphere{<0.55,0.05,0.4>,r}
+cylinder{<0.55,0.05,0.4>,<0.55,0.25,0.4>,r}
+cylinder{<0.55,0.05,0.4>,<0.55,0.05,0.2>,r}
+sphere{<0.75,0.05,0.2>,r}
+cylinder{<0.75,0.05,0.2>,<0.55,0.05,0.2>,r}
+cylinder{<0.75,0.05,0.2>,<0.75,0.25,0.2>,r}
+sphere{<0.809487,0.05,0.4>,r}
+cylinder{<0.809487,0.05,0.4>,<0.55,0.05,0.4>,r}
+sphere{<0.763333,0.25,0.4>,r}
+cylinder{<0.763333,0.25,0.4>,<0.55,0.25,0.4>,r}
+cylinder{<0.763333,0.25,0.4>,<0.809487,0.05,0.4>,r}
+sphere{<0.826636,0.25,0.276636>,r}
+cylinder{<0.826636,0.25,0.276636>,<0.763333,0.25,0.4>,r}
+cylinder{<0.826636,0.25,0.276636>,<0.75,0.25,0.2>,r}
+sphere{<0.857138,0.05,0.307138>,r}
+cylinder{<0.857138,0.05,0.307138>,<0.826636,0.25,0.276636>,r}
+cylinder{<0.857138,0.05,0.307138>,<0.809487,0.05,0.4>,r}
+cylinder{<0.857138,0.05,0.307138>,<0.75,0.05,0.2>,r}
+// cell 105
+sphere{<-0.71598,0.51598,0.26598>,r}
+sphere{<-0.724855,0.25,0.474855>,r}
+sphere{<-0.65,0.45,0.2>,r}
+cylinder{<-0.65,0.45,0.2>,<-0.71598,0.51598,0.26598>,r}
+sphere{<-0.65,0.25,0.4>,r}
+cylinder{<-0.65,0.25,0.4>,<-0.724855,0.25,0.474855>,r}
+sphere{<-0.661308,0.461308,0.411308>,r}
+cylinder{<-0.661308,0.461308,0.411308>,<-0.71598,0.51598,0.26598>,r}
+cylinder{<-0.661308,0.461308,0.411308>,<-0.724855,0.25,0.474855>,r}
+sphere{<-0.65,0.25,0.2>,r}
+cylinder{<-0.65,0.25,0.2>,<-0.65,0.45,0.2>,r}
+cylinder{<-0.65,0.25,0.2>,<-0.65,0.25,0.4>,r}
+sphere{<-0.87651,0.25,0.2>,r}
+cylinder{<-0.87651,0.25,0.2>,<-0.65,0.25,0.2>,r}
+cylinder{<-0.87651,0.25,0.2>,<-0.724855,0.25,0.474855>,r}
+sphere{<-0.65,0.45,0.4>,r}
+cylinder{<-0.65,0.45,0.4>,<-0.65,0.25,0.4>,r}
+cylinder{<-0.65,0.45,0.4>,<-0.65,0.45,0.2>,r}
+cylinder{<-0.65,0.45,0.4>,<-0.661308,0.461308,0.411308>,r}
+sphere{<-0.783177,0.45,0.2>,r}
+cylinder{<-0.783177,0.45,0.2>,<-0.65,0.45,0.2>,r}
+cylinder{<-0.783177,0.45,0.2>,<-0.87651,0.25,0.2>,r}
+cylinder{<-0.783177,0.45,0.2>,<-0.71598,0.51598,0.26598>,r}
+// cell 106
+sphere{<-0.65,0.25,0.2>,r}
+sphere{<-0.65,0.45,0.4>,r}
+sphere{<-0.45,0.25,0.4>,r}
+sphere{<-0.45,0.45,0.2>,r}
+sphere{<-0.65,0.45,0.2>,r}
+cylinder{<-0.65,0.45,0.2>,<-0.45,0.45,0.2>,r}
+cylinder{<-0.65,0.45,0.2>,<-0.65,0.25,0.2>,r}
+cylinder{<-0.65,0.45,0.2>,<-0.65,0.45,0.4>,r}
+sphere{<-0.45,0.45,0.4>,r}
+cylinder{<-0.45,0.45,0.4>,<-0.65,0.45,0.4>,r}
+cylinder{<-0.45,0.45,0.4>,<-0.45,0.25,0.4>,r}
+cylinder{<-0.45,0.45,0.4>,<-0.45,0.45,0.2>,r}
+sphere{<-0.45,0.25,0.2>,r}
+cylinder{<-0.45,0.25,0.2>,<-0.45,0.45,0.2>,r}
+cylinder{<-0.45,0.25,0.2>,<-0.45,0.25,0.4>,r}
+cylinder{<-0.45,0.25,0.2>,<-0.65,0.25,0.2>,r}
+sphere{<-0.65,0.25,0.4>,r}
+cylinder{<-0.65,0.25,0.4>,<-0.45,0.25,0.4>,r}
+cylinder{<-0.65,0.25,0.4>,<-0.65,0.45,0.4>,r}
+cylinder{<-0.65,0.25,0.4>,<-0.65,0.25,0.2>,r}
+// cell 107
+sphere{<-0.45,0.25,0.2>,r}
+sphere{<-0.25,0.25,0.2>,r}
+cylinder{<-0.25,0.25,0.2>,<-0.45,0.25,0.2>,r}
+sphere{<-0.25,0.45,0.4>,r}
+sphere{<-0.25,0.45,0.2>,r}
+cylinder{<-0.25,0.45,0.2>,<-0.25,0.45,0.4>,r}
+cylinder{<-0.25,0.45,0.2>,<-0.25,0.25,0.2>,r}
+sphere{<-0.45,0.45,0.4>,r}
+cylinder{<-0.45,0.45,0.4>,<-0.25,0.45,0.4>,r}
+sphere{<-0.25,0.25,0.4>,r}
+cylinder{<-0.25,0.25,0.4>,<-0.25,0.45,0.4>,r}
+cylinder{<-0.25,0.25,0.4>,<-0.25,0.25,0.2>,r}
+sphere{<-0.45,0.45,0.2>,r}
+cylinder{<-0.45,0.45,0.2>,<-0.25,0.45,0.2>,r}
+cylinder{<-0.45,0.45,0.2>,<-0.45,0.25,0.2>,r}
+cylinder{<-0.45,0.45,0.2>,<-0.45,0.45,0.4>,r}
+sphere{<-0.45,0.25,0.4>,r}
+cylinder{<-0.45,0.25,0.4>,<-0.25,0.25,0.4>,r}
+cylinder{<-0.45,0.25,0.4>,<-0.45,0.45,0.4>,r}
+cylinder{<-0.45,0.25,0.4>,<-0.45,0.25,0.2>,r}
+// cell 108
+sphere{<-0.25,0.25,0.2>,r}
+sphere{<-0.05,0.25,0.2>,r}
+cylinder{<-0.05,0.25,0.2>,<-0.25,0.25,0.2>,r}
+sphere{<-0.25,0.45,0.2>,r}
+cylinder{<-0.25,0.45,0.2>,<-0.25,0.25,0.2>,r}
+sphere{<-0.05,0.45,0.2>,r}
+cylinder{<-0.05,0.45,0.2>,<-0.05,0.25,0.2>,r}
+cylinder{<-0.05,0.45,0.2>,<-0.25,0.45,0.2>,r}
+sphere{<-0.05,0.45,0.4>,r}
+cylinder{<-0.05,0.45,0.4>,<-0.05,0.45,0.2>,r}
+sphere{<-0.05,0.25,0.4>,r}
+cylinder{<-0.05,0.25,0.4>,<-0.05,0.25,0.2>,r}
+cylinder{<-0.05,0.25,0.4>,<-0.05,0.45,0.4>,r}
+sphere{<-0.25,0.25,0.4>,r}
+cylinder{<-0.25,0.25,0.4>,<-0.05,0.25,0.4>,r}
+cylinder{<-0.25,0.25,0.4>,<-0.25,0.25,0.2>,r}
+sphere{<-0.25,0.45,0.4>,r}
+cylinder{<-0.25,0.45,0.4>,<-0.05,0.45,0.4>,r}
+cylinder{<-0.25,0.45,0.4>,<-0.25,0.45,0.2>,r}
+cylinder{<-0.25,0.45,0.4>,<-0.25,0.25,0.4>,r}
+// cell 109
+sphere{<-0.05,0.25,0.2>,r}
+sphere{<0.15,0.25,0.2>,r}
+cylinder{<0.15,0.25,0.2>,<-0.05,0.25,0.2>,r}
+sphere{<-0.05,0.45,0.2>,r}
+cylinder{<-0.05,0.45,0.2>,<-0.05,0.25,0.2>,r}
+sphere{<0.15,0.45,0.2>,r}
+cylinder{<0.15,0.45,0.2>,<0.15,0.25,0.2>,r}
+cylinder{<0.15,0.45,0.2>,<-0.05,0.45,0.2>,r}
+sphere{<-0.05,0.25,0.4>,r}
+cylinder{<-0.05,0.25,0.4>,<-0.05,0.25,0.2>,r}
+sphere{<0.15,0.25,0.4>,r}
+cylinder{<0.15,0.25,0.4>,<0.15,0.25,0.2>,r}
+cylinder{<0.15,0.25,0.4>,<-0.05,0.25,0.4>,r}
+sphere{<-0.05,0.45,0.4>,r}
+cylinder{<-0.05,0.45,0.4>,<-0.05,0.45,0.2>,r}
+cylinder{<-0.05,0.45,0.4>,<-0.05,0.25,0.4>,r}
+sphere{<0.15,0.45,0.4>,r}
+cylinder{<0.15,0.45,0.4>,<0.15,0.25,0.4>,r}
+cylinder{<0.15,0.45,0.4>,<0.15,0.45,0.2>,r}
+cylinder{<0.15,0.45,0.4>,<-0.05,0.45,0.4>,r}
+// cell 110
+sphere{<0.35,0.45,0.2>,r}
+sphere{<0.35,0.25,0.2>,r}
+cylinder{<0.35,0.25,0.2>,<0.35,0.45,0.2>,r}
+sphere{<0.15,0.45,0.2>,r}
+cylinder{<0.15,0.45,0.2>,<0.35,0.45,0.2>,r}
+sphere{<0.15,0.25,0.4>,r}
+sphere{<0.15,0.45,0.4>,r}
+cylinder{<0.15,0.45,0.4>,<0.15,0.45,0.2>,r}
+cylinder{<0.15,0.45,0.4>,<0.15,0.25,0.4>,r}
+sphere{<0.35,0.25,0.4>,r}
+cylinder{<0.35,0.25,0.4>,<0.35,0.25,0.2>,r}
+cylinder{<0.35,0.25,0.4>,<0.15,0.25,0.4>,r}
+sphere{<0.15,0.25,0.2>,r}
+cylinder{<0.15,0.25,0.2>,<0.35,0.25,0.2>,r}
+cylinder{<0.15,0.25,0.2>,<0.15,0.25,0.4>,r}
+cylinder{<0.15,0.25,0.2>,<0.15,0.45,0.2>,r}
+sphere{<0.35,0.45,0.4>,r}
+cylinder{<0.35,0.45,0.4>,<0.15,0.45,0.4>,r}
+cylinder{<0.35,0.45,0.4>,<0.35,0.25,0.4>,r}
+cylinder{<0.35,0.45,0.4>,<0.35,0.45,0.2>,r}
+// cell 111
+sphere{<0.55,0.45,0.2>,r}
+sphere{<0.55,0.25,0.2>,r}
+cylinder{<0.55,0.25,0.2>,<0.55,0.45,0.2>,r}
+sphere{<0.35,0.45,0.2>,r}
+cylinder{<0.35,0.45,0.2>,<0.55,0.45,0.2>,r}
+sphere{<0.35,0.25,0.4>,r}
+sphere{<0.35,0.45,0.4>,r}
+cylinder{<0.35,0.45,0.4>,<0.35,0.45,0.2>,r}
+cylinder{<0.35,0.45,0.4>,<0.35,0.25,0.4>,r}
+sphere{<0.55,0.25,0.4>,r}
+cylinder{<0.55,0.25,0.4>,<0.35,0.25,0.4>,r}
+cylinder{<0.55,0.25,0.4>,<0.55,0.25,0.2>,r}
+sphere{<0.35,0.25,0.2>,r}
+cylinder{<0.35,0.25,0.2>,<0.55,0.25,0.2>,r}
+cylinder{<0.35,0.25,0.2>,<0.35,0.25,0.4>,r}
+cylinder{<0.35,0.25,0.2>,<0.35,0.45,0.2>,r}
+sphere{<0.55,0.45,0.4>,r}
+cylinder{<0.55,0.45,0.4>,<0.35,0.45,0.4>,r}
+cylinder{<0.55,0.45,0.4>,<0.55,0.25,0.4>,r}
+cylinder{<0.55,0.45,0.4>,<0.55,0.45,0.2>,r}
+// cell 112
+sphere{<0.55,0.25,0.4>,r}
+sphere{<0.55,0.25,0.2>,r}
+cylinder{<0.55,0.25,0.2>,<0.55,0.25,0.4>,r}
+sphere{<0.75,0.45,0.2>,r}
+sphere{<0.773989,0.25,0.4>,r}
+cylinder{<0.773989,0.25,0.4>,<0.55,0.25,0.4>,r}
+sphere{<0.659134,0.559134,0.309134>,r}
+sphere{<0.764182,0.464182,0.214182>,r}
+cylinder{<0.764182,0.464182,0.214182>,<0.659134,0.559134,0.309134>,r}
+cylinder{<0.764182,0.464182,0.214182>,<0.75,0.45,0.2>,r}
+sphere{<0.837739,0.25,0.287739>,r}
+cylinder{<0.837739,0.25,0.287739>,<0.764182,0.464182,0.214182>,r}
+cylinder{<0.837739,0.25,0.287739>,<0.773989,0.25,0.4>,r}
+sphere{<0.75,0.25,0.2>,r}
+cylinder{<0.75,0.25,0.2>,<0.55,0.25,0.2>,r}
+cylinder{<0.75,0.25,0.2>,<0.75,0.45,0.2>,r}
+cylinder{<0.75,0.25,0.2>,<0.837739,0.25,0.287739>,r}
+sphere{<0.55,0.45,0.4>,r}
+cylinder{<0.55,0.45,0.4>,<0.55,0.25,0.4>,r}
+sphere{<0.625593,0.525593,0.4>,r}
+cylinder{<0.625593,0.525593,0.4>,<0.773989,0.25,0.4>,r}
+cylinder{<0.625593,0.525593,0.4>,<0.659134,0.559134,0.309134>,r}
+cylinder{<0.625593,0.525593,0.4>,<0.55,0.45,0.4>,r}
+sphere{<0.55,0.45,0.2>,r}
+cylinder{<0.55,0.45,0.2>,<0.75,0.45,0.2>,r}
+cylinder{<0.55,0.45,0.2>,<0.55,0.25,0.2>,r}
+cylinder{<0.55,0.45,0.2>,<0.55,0.45,0.4>,r}
+cylinder{<0.55,0.45,0.2>,<0.659134,0.559134,0.309134>,r}
+// cell 113
+sphere{<-0.65,0.622792,0.2>,r}
+sphere{<-0.45,0.45,0.2>,r}
+sphere{<-0.661588,0.461588,0.411588>,r}
+sphere{<-0.513829,0.713829,0.263829>,r}
+sphere{<-0.535468,0.535468,0.485468>,r}
+cylinder{<-0.535468,0.535468,0.485468>,<-0.661588,0.461588,0.411588>,r}
+sphere{<-0.45,0.65,0.2>,r}
+cylinder{<-0.45,0.65,0.2>,<-0.513829,0.713829,0.263829>,r}
+cylinder{<-0.45,0.65,0.2>,<-0.45,0.45,0.2>,r}
+sphere{<-0.45,0.45,0.4>,r}
+cylinder{<-0.45,0.45,0.4>,<-0.45,0.45,0.2>,r}
+cylinder{<-0.45,0.45,0.4>,<-0.535468,0.535468,0.485468>,r}
+sphere{<-0.713829,0.513829,0.263829>,r}
+cylinder{<-0.713829,0.513829,0.263829>,<-0.661588,0.461588,0.411588>,r}
+cylinder{<-0.713829,0.513829,0.263829>,<-0.65,0.622792,0.2>,r}
+sphere{<-0.45,0.65,0.4>,r}
+cylinder{<-0.45,0.65,0.4>,<-0.45,0.45,0.4>,r}
+cylinder{<-0.45,0.65,0.4>,<-0.45,0.65,0.2>,r}
+sphere{<-0.461588,0.661588,0.411588>,r}
+cylinder{<-0.461588,0.661588,0.411588>,<-0.45,0.65,0.4>,r}
+cylinder{<-0.461588,0.661588,0.411588>,<-0.513829,0.713829,0.263829>,r}
+cylinder{<-0.461588,0.661588,0.411588>,<-0.535468,0.535468,0.485468>,r}
+sphere{<-0.65,0.45,0.4>,r}
+cylinder{<-0.65,0.45,0.4>,<-0.661588,0.461588,0.411588>,r}
+cylinder{<-0.65,0.45,0.4>,<-0.45,0.45,0.4>,r}
+sphere{<-0.65,0.45,0.2>,r}
+cylinder{<-0.65,0.45,0.2>,<-0.65,0.622792,0.2>,r}
+cylinder{<-0.65,0.45,0.2>,<-0.45,0.45,0.2>,r}
+cylinder{<-0.65,0.45,0.2>,<-0.65,0.45,0.4>,r}
+cylinder{<-0.65,0.45,0.2>,<-0.713829,0.513829,0.263829>,r}
+sphere{<-0.622792,0.65,0.2>,r}
+cylinder{<-0.622792,0.65,0.2>,<-0.45,0.65,0.2>,r}
+cylinder{<-0.622792,0.65,0.2>,<-0.65,0.622792,0.2>,r}
+cylinder{<-0.622792,0.65,0.2>,<-0.513829,0.713829,0.263829>,r}
+// cell 114
+sphere{<-0.25,0.65,0.4>,r}
+sphere{<-0.45,0.65,0.2>,r}
+sphere{<-0.45,0.65,0.4>,r}
+cylinder{<-0.45,0.65,0.4>,<-0.25,0.65,0.4>,r}
+cylinder{<-0.45,0.65,0.4>,<-0.45,0.65,0.2>,r}
+sphere{<-0.25,0.65,0.2>,r}
+cylinder{<-0.25,0.65,0.2>,<-0.45,0.65,0.2>,r}
+cylinder{<-0.25,0.65,0.2>,<-0.25,0.65,0.4>,r}
+sphere{<-0.45,0.45,0.4>,r}
+cylinder{<-0.45,0.45,0.4>,<-0.45,0.65,0.4>,r}
+sphere{<-0.25,0.45,0.2>,r}
+cylinder{<-0.25,0.45,0.2>,<-0.25,0.65,0.2>,r}
+sphere{<-0.45,0.45,0.2>,r}
+cylinder{<-0.45,0.45,0.2>,<-0.25,0.45,0.2>,r}
+cylinder{<-0.45,0.45,0.2>,<-0.45,0.45,0.4>,r}
+cylinder{<-0.45,0.45,0.2>,<-0.45,0.65,0.2>,r}
+sphere{<-0.25,0.45,0.4>,r}
+cylinder{<-0.25,0.45,0.4>,<-0.45,0.45,0.4>,r}
+cylinder{<-0.25,0.45,0.4>,<-0.25,0.45,0.2>,r}
+cylinder{<-0.25,0.45,0.4>,<-0.25,0.65,0.4>,r}
+// cell 115
+sphere{<-0.25,0.45,0.2>,r}
+sphere{<-0.05,0.65,0.2>,r}
+sphere{<-0.25,0.65,0.2>,r}
+cylinder{<-0.25,0.65,0.2>,<-0.05,0.65,0.2>,r}
+cylinder{<-0.25,0.65,0.2>,<-0.25,0.45,0.2>,r}
+sphere{<-0.05,0.45,0.2>,r}
+cylinder{<-0.05,0.45,0.2>,<-0.05,0.65,0.2>,r}
+cylinder{<-0.05,0.45,0.2>,<-0.25,0.45,0.2>,r}
+sphere{<-0.05,0.45,0.4>,r}
+cylinder{<-0.05,0.45,0.4>,<-0.05,0.45,0.2>,r}
+sphere{<-0.05,0.65,0.4>,r}
+cylinder{<-0.05,0.65,0.4>,<-0.05,0.65,0.2>,r}
+cylinder{<-0.05,0.65,0.4>,<-0.05,0.45,0.4>,r}
+sphere{<-0.25,0.45,0.4>,r}
+cylinder{<-0.25,0.45,0.4>,<-0.25,0.45,0.2>,r}
+cylinder{<-0.25,0.45,0.4>,<-0.05,0.45,0.4>,r}
+sphere{<-0.25,0.65,0.4>,r}
+cylinder{<-0.25,0.65,0.4>,<-0.05,0.65,0.4>,r}
+cylinder{<-0.25,0.65,0.4>,<-0.25,0.65,0.2>,r}
+cylinder{<-0.25,0.65,0.4>,<-0.25,0.45,0.4>,r}
+// cell 116
+sphere{<-0.05,0.45,0.2>,r}
+sphere{<0.15,0.65,0.2>,r}
+sphere{<0.15,0.45,0.4>,r}
+sphere{<-0.05,0.45,0.4>,r}
+cylinder{<-0.05,0.45,0.4>,<-0.05,0.45,0.2>,r}
+cylinder{<-0.05,0.45,0.4>,<0.15,0.45,0.4>,r}
+sphere{<-0.05,0.65,0.2>,r}
+cylinder{<-0.05,0.65,0.2>,<0.15,0.65,0.2>,r}
+cylinder{<-0.05,0.65,0.2>,<-0.05,0.45,0.2>,r}
+sphere{<0.15,0.45,0.2>,r}
+cylinder{<0.15,0.45,0.2>,<0.15,0.65,0.2>,r}
+cylinder{<0.15,0.45,0.2>,<0.15,0.45,0.4>,r}
+cylinder{<0.15,0.45,0.2>,<-0.05,0.45,0.2>,r}
+sphere{<-0.05,0.65,0.4>,r}
+cylinder{<-0.05,0.65,0.4>,<-0.05,0.65,0.2>,r}
+cylinder{<-0.05,0.65,0.4>,<-0.05,0.45,0.4>,r}
+sphere{<0.15,0.65,0.4>,r}
+cylinder{<0.15,0.65,0.4>,<0.15,0.65,0.2>,r}
+cylinder{<0.15,0.65,0.4>,<-0.05,0.65,0.4>,r}
+cylinder{<0.15,0.65,0.4>,<0.15,0.45,0.4>,r}
+// cell 117
+sphere{<0.35,0.65,0.2>,r}
+sphere{<0.35,0.45,0.2>,r}
+cylinder{<0.35,0.45,0.2>,<0.35,0.65,0.2>,r}
+sphere{<0.35,0.65,0.4>,r}
+cylinder{<0.35,0.65,0.4>,<0.35,0.65,0.2>,r}
+sphere{<0.15,0.65,0.4>,r}
+cylinder{<0.15,0.65,0.4>,<0.35,0.65,0.4>,r}
+sphere{<0.15,0.65,0.2>,r}
+cylinder{<0.15,0.65,0.2>,<0.15,0.65,0.4>,r}
+cylinder{<0.15,0.65,0.2>,<0.35,0.65,0.2>,r}
+sphere{<0.35,0.45,0.4>,r}
+cylinder{<0.35,0.45,0.4>,<0.35,0.45,0.2>,r}
+cylinder{<0.35,0.45,0.4>,<0.35,0.65,0.4>,r}
+sphere{<0.15,0.45,0.4>,r}
+cylinder{<0.15,0.45,0.4>,<0.35,0.45,0.4>,r}
+cylinder{<0.15,0.45,0.4>,<0.15,0.65,0.4>,r}
+sphere{<0.15,0.45,0.2>,r}
+cylinder{<0.15,0.45,0.2>,<0.35,0.45,0.2>,r}
+cylinder{<0.15,0.45,0.2>,<0.15,0.45,0.4>,r}
+cylinder{<0.15,0.45,0.2>,<0.15,0.65,0.2>,r}
+// cell 118
+sphere{<0.35,0.65,0.4>,r}
+sphere{<0.35,0.45,0.2>,r}
+sphere{<0.55,0.45,0.4>,r}
+sphere{<0.55,0.65,0.2>,r}
+sphere{<0.623507,0.523507,0.4>,r}
+cylinder{<0.623507,0.523507,0.4>,<0.55,0.45,0.4>,r}
+sphere{<0.656669,0.556669,0.306669>,r}
+cylinder{<0.656669,0.556669,0.306669>,<0.623507,0.523507,0.4>,r}
+sphere{<0.35,0.65,0.2>,r}
+cylinder{<0.35,0.65,0.2>,<0.55,0.65,0.2>,r}
+cylinder{<0.35,0.65,0.2>,<0.35,0.45,0.2>,r}
+cylinder{<0.35,0.65,0.2>,<0.35,0.65,0.4>,r}
+sphere{<0.35,0.45,0.4>,r}
+cylinder{<0.35,0.45,0.4>,<0.35,0.45,0.2>,r}
+cylinder{<0.35,0.45,0.4>,<0.55,0.45,0.4>,r}
+cylinder{<0.35,0.45,0.4>,<0.35,0.65,0.4>,r}
+sphere{<0.403507,0.703507,0.4>,r}
+cylinder{<0.403507,0.703507,0.4>,<0.35,0.65,0.4>,r}
+cylinder{<0.403507,0.703507,0.4>,<0.623507,0.523507,0.4>,r}
+sphere{<0.575507,0.675507,0.225507>,r}
+cylinder{<0.575507,0.675507,0.225507>,<0.656669,0.556669,0.306669>,r}
+cylinder{<0.575507,0.675507,0.225507>,<0.55,0.65,0.2>,r}
+sphere{<0.55,0.45,0.2>,r}
+cylinder{<0.55,0.45,0.2>,<0.656669,0.556669,0.306669>,r}
+cylinder{<0.55,0.45,0.2>,<0.55,0.45,0.4>,r}
+cylinder{<0.55,0.45,0.2>,<0.35,0.45,0.2>,r}
+cylinder{<0.55,0.45,0.2>,<0.55,0.65,0.2>,r}
+sphere{<0.441912,0.741912,0.291912>,r}
+cylinder{<0.441912,0.741912,0.291912>,<0.35,0.65,0.2>,r}
+cylinder{<0.441912,0.741912,0.291912>,<0.403507,0.703507,0.4>,r}
+cylinder{<0.441912,0.741912,0.291912>,<0.575507,0.675507,0.225507>,r}
+// cell 119
+sphere{<-0.45,0.65,0.4>,r}
+sphere{<-0.45,0.783177,0.2>,r}
+sphere{<-0.461308,0.661308,0.411308>,r}
+cylinder{<-0.461308,0.661308,0.411308>,<-0.45,0.65,0.4>,r}
+sphere{<-0.25,0.65,0.4>,r}
+cylinder{<-0.25,0.65,0.4>,<-0.45,0.65,0.4>,r}
+sphere{<-0.51598,0.71598,0.26598>,r}
+cylinder{<-0.51598,0.71598,0.26598>,<-0.461308,0.661308,0.411308>,r}
+cylinder{<-0.51598,0.71598,0.26598>,<-0.45,0.783177,0.2>,r}
+sphere{<-0.25,0.724855,0.474855>,r}
+cylinder{<-0.25,0.724855,0.474855>,<-0.461308,0.661308,0.411308>,r}
+cylinder{<-0.25,0.724855,0.474855>,<-0.25,0.65,0.4>,r}
+sphere{<-0.25,0.87651,0.2>,r}
+cylinder{<-0.25,0.87651,0.2>,<-0.45,0.783177,0.2>,r}
+cylinder{<-0.25,0.87651,0.2>,<-0.25,0.724855,0.474855>,r}
+sphere{<-0.25,0.65,0.2>,r}
+cylinder{<-0.25,0.65,0.2>,<-0.25,0.65,0.4>,r}
+cylinder{<-0.25,0.65,0.2>,<-0.25,0.87651,0.2>,r}
+sphere{<-0.45,0.65,0.2>,r}
+cylinder{<-0.45,0.65,0.2>,<-0.45,0.783177,0.2>,r}
+cylinder{<-0.45,0.65,0.2>,<-0.25,0.65,0.2>,r}
+cylinder{<-0.45,0.65,0.2>,<-0.45,0.65,0.4>,r}
+cylinder{<-0.45,0.65,0.2>,<-0.51598,0.71598,0.26598>,r}
+// cell 120
+sphere{<-0.25,0.65,0.2>,r}
+sphere{<-0.05,0.65,0.2>,r}
+cylinder{<-0.05,0.65,0.2>,<-0.25,0.65,0.2>,r}
+sphere{<-0.25,0.867824,0.2>,r}
+cylinder{<-0.25,0.867824,0.2>,<-0.25,0.65,0.2>,r}
+sphere{<-0.25,0.65,0.4>,r}
+cylinder{<-0.25,0.65,0.4>,<-0.25,0.65,0.2>,r}
+sphere{<-0.05,0.907824,0.2>,r}
+cylinder{<-0.05,0.907824,0.2>,<-0.25,0.867824,0.2>,r}
+cylinder{<-0.05,0.907824,0.2>,<-0.05,0.65,0.2>,r}
+sphere{<-0.05,0.753214,0.503214>,r}
+cylinder{<-0.05,0.753214,0.503214>,<-0.05,0.907824,0.2>,r}
+sphere{<-0.25,0.726722,0.476722>,r}
+cylinder{<-0.25,0.726722,0.476722>,<-0.05,0.753214,0.503214>,r}
+cylinder{<-0.25,0.726722,0.476722>,<-0.25,0.867824,0.2>,r}
+cylinder{<-0.25,0.726722,0.476722>,<-0.25,0.65,0.4>,r}
+sphere{<-0.05,0.65,0.4>,r}
+cylinder{<-0.05,0.65,0.4>,<-0.05,0.753214,0.503214>,r}
+cylinder{<-0.05,0.65,0.4>,<-0.25,0.65,0.4>,r}
+cylinder{<-0.05,0.65,0.4>,<-0.05,0.65,0.2>,r}
+// cell 121
+sphere{<-0.05,0.75333,0.50333>,r}
+sphere{<0.15,0.65,0.2>,r}
+sphere{<-0.05,0.905331,0.2>,r}
+cylinder{<-0.05,0.905331,0.2>,<-0.05,0.75333,0.50333>,r}
+sphere{<0.15,0.891998,0.2>,r}
+cylinder{<0.15,0.891998,0.2>,<-0.05,0.905331,0.2>,r}
+cylinder{<0.15,0.891998,0.2>,<0.15,0.65,0.2>,r}
+sphere{<-0.05,0.65,0.4>,r}
+cylinder{<-0.05,0.65,0.4>,<-0.05,0.75333,0.50333>,r}
+sphere{<-0.05,0.65,0.2>,r}
+cylinder{<-0.05,0.65,0.2>,<0.15,0.65,0.2>,r}
+cylinder{<-0.05,0.65,0.2>,<-0.05,0.65,0.4>,r}
+cylinder{<-0.05,0.65,0.2>,<-0.05,0.905331,0.2>,r}
+sphere{<0.15,0.65,0.4>,r}
+cylinder{<0.15,0.65,0.4>,<-0.05,0.65,0.4>,r}
+cylinder{<0.15,0.65,0.4>,<0.15,0.65,0.2>,r}
+sphere{<0.15,0.744447,0.494447>,r}
+cylinder{<0.15,0.744447,0.494447>,<0.15,0.65,0.4>,r}
+cylinder{<0.15,0.744447,0.494447>,<0.15,0.891998,0.2>,r}
+cylinder{<0.15,0.744447,0.494447>,<-0.05,0.75333,0.50333>,r}
+// cell 122
+sphere{<0.447838,0.747838,0.297838>,r}
+sphere{<0.15,0.65,0.2>,r}
+sphere{<0.15,0.898683,0.2>,r}
+cylinder{<0.15,0.898683,0.2>,<0.15,0.65,0.2>,r}
+sphere{<0.15,0.743824,0.493824>,r}
+cylinder{<0.15,0.743824,0.493824>,<0.15,0.898683,0.2>,r}
+sphere{<0.15,0.65,0.4>,r}
+cylinder{<0.15,0.65,0.4>,<0.15,0.743824,0.493824>,r}
+cylinder{<0.15,0.65,0.4>,<0.15,0.65,0.2>,r}
+sphere{<0.35,0.65,0.2>,r}
+cylinder{<0.35,0.65,0.2>,<0.447838,0.747838,0.297838>,r}
+cylinder{<0.35,0.65,0.2>,<0.15,0.65,0.2>,r}
+sphere{<0.35,0.65,0.4>,r}
+cylinder{<0.35,0.65,0.4>,<0.15,0.65,0.4>,r}
+cylinder{<0.35,0.65,0.4>,<0.35,0.65,0.2>,r}
+sphere{<0.35,0.700167,0.450167>,r}
+cylinder{<0.35,0.700167,0.450167>,<0.15,0.743824,0.493824>,r}
+cylinder{<0.35,0.700167,0.450167>,<0.35,0.65,0.4>,r}
+sphere{<0.407456,0.707456,0.4>,r}
+cylinder{<0.407456,0.707456,0.4>,<0.35,0.65,0.4>,r}
+cylinder{<0.407456,0.707456,0.4>,<0.447838,0.747838,0.297838>,r}
+cylinder{<0.407456,0.707456,0.4>,<0.35,0.700167,0.450167>,r}
+sphere{<0.35,0.832017,0.2>,r}
+cylinder{<0.35,0.832017,0.2>,<0.35,0.65,0.2>,r}
+cylinder{<0.35,0.832017,0.2>,<0.15,0.898683,0.2>,r}
+cylinder{<0.35,0.832017,0.2>,<0.447838,0.747838,0.297838>,r}
+// cell 123
+sphere{<-0.25,-0.55,0.6>,r}
+sphere{<-0.25,-0.773989,0.4>,r}
+sphere{<-0.25,-0.55,0.4>,r}
+cylinder{<-0.25,-0.55,0.4>,<-0.25,-0.773989,0.4>,r}
+cylinder{<-0.25,-0.55,0.4>,<-0.25,-0.55,0.6>,r}
+sphere{<-0.525593,-0.625593,0.4>,r}
+cylinder{<-0.525593,-0.625593,0.4>,<-0.25,-0.773989,0.4>,r}
+sphere{<-0.451292,-0.551292,0.601292>,r}
+cylinder{<-0.451292,-0.551292,0.601292>,<-0.525593,-0.625593,0.4>,r}
+sphere{<-0.25,-0.620422,0.670422>,r}
+cylinder{<-0.25,-0.620422,0.670422>,<-0.451292,-0.551292,0.601292>,r}
+cylinder{<-0.25,-0.620422,0.670422>,<-0.25,-0.773989,0.4>,r}
+cylinder{<-0.25,-0.620422,0.670422>,<-0.25,-0.55,0.6>,r}
+sphere{<-0.45,-0.55,0.6>,r}
+cylinder{<-0.45,-0.55,0.6>,<-0.451292,-0.551292,0.601292>,r}
+cylinder{<-0.45,-0.55,0.6>,<-0.25,-0.55,0.6>,r}
+sphere{<-0.45,-0.55,0.4>,r}
+cylinder{<-0.45,-0.55,0.4>,<-0.525593,-0.625593,0.4>,r}
+cylinder{<-0.45,-0.55,0.4>,<-0.45,-0.55,0.6>,r}
+cylinder{<-0.45,-0.55,0.4>,<-0.25,-0.55,0.4>,r}
+// cell 124
+sphere{<-0.05,-0.653664,0.703664>,r}
+sphere{<-0.25,-0.55,0.4>,r}
+sphere{<-0.05,-0.55,0.4>,r}
+cylinder{<-0.05,-0.55,0.4>,<-0.25,-0.55,0.4>,r}
+sphere{<-0.05,-0.55,0.6>,r}
+cylinder{<-0.05,-0.55,0.6>,<-0.05,-0.55,0.4>,r}
+cylinder{<-0.05,-0.55,0.6>,<-0.05,-0.653664,0.703664>,r}
+sphere{<-0.25,-0.763333,0.4>,r}
+cylinder{<-0.25,-0.763333,0.4>,<-0.25,-0.55,0.4>,r}
+sphere{<-0.05,-0.809487,0.4>,r}
+cylinder{<-0.05,-0.809487,0.4>,<-0.05,-0.653664,0.703664>,r}
+cylinder{<-0.05,-0.809487,0.4>,<-0.25,-0.763333,0.4>,r}
+cylinder{<-0.05,-0.809487,0.4>,<-0.05,-0.55,0.4>,r}
+sphere{<-0.25,-0.623162,0.673162>,r}
+cylinder{<-0.25,-0.623162,0.673162>,<-0.25,-0.763333,0.4>,r}
+cylinder{<-0.25,-0.623162,0.673162>,<-0.05,-0.653664,0.703664>,r}
+sphere{<-0.25,-0.55,0.6>,r}
+cylinder{<-0.25,-0.55,0.6>,<-0.05,-0.55,0.6>,r}
+cylinder{<-0.25,-0.55,0.6>,<-0.25,-0.55,0.4>,r}
+cylinder{<-0.25,-0.55,0.6>,<-0.25,-0.623162,0.673162>,r}
+// cell 125
+sphere{<-0.05,-0.80621,0.4>,r}
+sphere{<0.15,-0.790825,0.4>,r}
+cylinder{<0.15,-0.790825,0.4>,<-0.05,-0.80621,0.4>,r}
+sphere{<0.15,-0.55,0.6>,r}
+sphere{<0.15,-0.55,0.4>,r}
+cylinder{<0.15,-0.55,0.4>,<0.15,-0.55,0.6>,r}
+cylinder{<0.15,-0.55,0.4>,<0.15,-0.790825,0.4>,r}
+sphere{<-0.05,-0.55,0.4>,r}
+cylinder{<-0.05,-0.55,0.4>,<0.15,-0.55,0.4>,r}
+cylinder{<-0.05,-0.55,0.4>,<-0.05,-0.80621,0.4>,r}
+sphere{<0.15,-0.643594,0.693594>,r}
+cylinder{<0.15,-0.643594,0.693594>,<0.15,-0.790825,0.4>,r}
+cylinder{<0.15,-0.643594,0.693594>,<0.15,-0.55,0.6>,r}
+sphere{<-0.05,-0.55,0.6>,r}
+cylinder{<-0.05,-0.55,0.6>,<0.15,-0.55,0.6>,r}
+cylinder{<-0.05,-0.55,0.6>,<-0.05,-0.55,0.4>,r}
+sphere{<-0.05,-0.65384,0.70384>,r}
+cylinder{<-0.05,-0.65384,0.70384>,<-0.05,-0.80621,0.4>,r}
+cylinder{<-0.05,-0.65384,0.70384>,<0.15,-0.643594,0.693594>,r}
+cylinder{<-0.05,-0.65384,0.70384>,<-0.05,-0.55,0.6>,r}
+// cell 126
+sphere{<0.15,-0.55,0.4>,r}
+sphere{<0.35,-0.59257,0.64257>,r}
+sphere{<0.397215,-0.597215,0.6>,r}
+cylinder{<0.397215,-0.597215,0.6>,<0.35,-0.59257,0.64257>,r}
+sphere{<0.439837,-0.639837,0.489837>,r}
+cylinder{<0.439837,-0.639837,0.489837>,<0.397215,-0.597215,0.6>,r}
+sphere{<0.35,-0.722516,0.4>,r}
+cylinder{<0.35,-0.722516,0.4>,<0.439837,-0.639837,0.489837>,r}
+sphere{<0.15,-0.799439,0.4>,r}
+cylinder{<0.15,-0.799439,0.4>,<0.35,-0.722516,0.4>,r}
+cylinder{<0.15,-0.799439,0.4>,<0.15,-0.55,0.4>,r}
+sphere{<0.15,-0.55,0.6>,r}
+cylinder{<0.15,-0.55,0.6>,<0.15,-0.55,0.4>,r}
+sphere{<0.15,-0.642659,0.692659>,r}
+cylinder{<0.15,-0.642659,0.692659>,<0.15,-0.799439,0.4>,r}
+cylinder{<0.15,-0.642659,0.692659>,<0.35,-0.59257,0.64257>,r}
+cylinder{<0.15,-0.642659,0.692659>,<0.15,-0.55,0.6>,r}
+sphere{<0.35,-0.55,0.4>,r}
+cylinder{<0.35,-0.55,0.4>,<0.439837,-0.639837,0.489837>,r}
+cylinder{<0.35,-0.55,0.4>,<0.35,-0.722516,0.4>,r}
+cylinder{<0.35,-0.55,0.4>,<0.15,-0.55,0.4>,r}
+sphere{<0.35,-0.55,0.6>,r}
+cylinder{<0.35,-0.55,0.6>,<0.397215,-0.597215,0.6>,r}
+cylinder{<0.35,-0.55,0.6>,<0.35,-0.55,0.4>,r}
+cylinder{<0.35,-0.55,0.6>,<0.15,-0.55,0.6>,r}
+cylinder{<0.35,-0.55,0.6>,<0.35,-0.59257,0.64257>,r}
+// cell 127
+sphere{<-0.45,-0.35,0.4>,r}
+sphere{<-0.45,-0.55,0.6>,r}
+sphere{<-0.618079,-0.35,0.6>,r}
+sphere{<-0.45,-0.55,0.4>,r}
+cylinder{<-0.45,-0.55,0.4>,<-0.45,-0.35,0.4>,r}
+cylinder{<-0.45,-0.55,0.4>,<-0.45,-0.55,0.6>,r}
+sphere{<-0.518208,-0.418208,0.668208>,r}
+cylinder{<-0.518208,-0.418208,0.668208>,<-0.618079,-0.35,0.6>,r}
+sphere{<-0.523507,-0.623507,0.4>,r}
+cylinder{<-0.523507,-0.623507,0.4>,<-0.45,-0.55,0.4>,r}
+sphere{<-0.709103,-0.35,0.459103>,r}
+cylinder{<-0.709103,-0.35,0.459103>,<-0.618079,-0.35,0.6>,r}
+sphere{<-0.451803,-0.551803,0.601803>,r}
+cylinder{<-0.451803,-0.551803,0.601803>,<-0.518208,-0.418208,0.668208>,r}
+cylinder{<-0.451803,-0.551803,0.601803>,<-0.523507,-0.623507,0.4>,r}
+cylinder{<-0.451803,-0.551803,0.601803>,<-0.45,-0.55,0.6>,r}
+sphere{<-0.45,-0.35,0.6>,r}
+cylinder{<-0.45,-0.35,0.6>,<-0.518208,-0.418208,0.668208>,r}
+cylinder{<-0.45,-0.35,0.6>,<-0.45,-0.55,0.6>,r}
+cylinder{<-0.45,-0.35,0.6>,<-0.45,-0.35,0.4>,r}
+cylinder{<-0.45,-0.35,0.6>,<-0.618079,-0.35,0.6>,r}
+sphere{<-0.65,-0.35,0.4>,r}
+cylinder{<-0.65,-0.35,0.4>,<-0.709103,-0.35,0.459103>,r}
+cylinder{<-0.65,-0.35,0.4>,<-0.45,-0.35,0.4>,r}
+sphere{<-0.703507,-0.403507,0.4>,r}
+cylinder{<-0.703507,-0.403507,0.4>,<-0.65,-0.35,0.4>,r}
+cylinder{<-0.703507,-0.403507,0.4>,<-0.523507,-0.623507,0.4>,r}
+cylinder{<-0.703507,-0.403507,0.4>,<-0.709103,-0.35,0.459103>,r}
+// cell 128
+sphere{<-0.433033,-0.55,0.6>,r}
+sphere{<-0.25,-0.55,0.4>,r}
+sphere{<-0.25,-0.35,0.4>,r}
+cylinder{<-0.25,-0.35,0.4>,<-0.25,-0.55,0.4>,r}
+sphere{<-0.25,-0.35,0.6>,r}
+cylinder{<-0.25,-0.35,0.6>,<-0.25,-0.35,0.4>,r}
+sphere{<-0.45,-0.55,0.579166>,r}
+cylinder{<-0.45,-0.55,0.579166>,<-0.433033,-0.55,0.6>,r}
+sphere{<-0.25,-0.55,0.6>,r}
+cylinder{<-0.25,-0.55,0.6>,<-0.25,-0.35,0.6>,r}
+cylinder{<-0.25,-0.55,0.6>,<-0.433033,-0.55,0.6>,r}
+cylinder{<-0.25,-0.55,0.6>,<-0.25,-0.55,0.4>,r}
+sphere{<-0.45,-0.55,0.4>,r}
+cylinder{<-0.45,-0.55,0.4>,<-0.25,-0.55,0.4>,r}
+cylinder{<-0.45,-0.55,0.4>,<-0.45,-0.55,0.579166>,r}
+sphere{<-0.45,-0.35,0.4>,r}
+cylinder{<-0.45,-0.35,0.4>,<-0.25,-0.35,0.4>,r}
+cylinder{<-0.45,-0.35,0.4>,<-0.45,-0.55,0.4>,r}
+sphere{<-0.45,-0.536803,0.6>,r}
+cylinder{<-0.45,-0.536803,0.6>,<-0.45,-0.55,0.579166>,r}
+cylinder{<-0.45,-0.536803,0.6>,<-0.433033,-0.55,0.6>,r}
+sphere{<-0.45,-0.35,0.6>,r}
+cylinder{<-0.45,-0.35,0.6>,<-0.45,-0.35,0.4>,r}
+cylinder{<-0.45,-0.35,0.6>,<-0.45,-0.536803,0.6>,r}
+cylinder{<-0.45,-0.35,0.6>,<-0.25,-0.35,0.6>,r}
+// cell 129
+sphere{<-0.05,-0.55,0.6>,r}
+sphere{<-0.05,-0.55,0.4>,r}
+cylinder{<-0.05,-0.55,0.4>,<-0.05,-0.55,0.6>,r}
+sphere{<-0.05,-0.35,0.4>,r}
+cylinder{<-0.05,-0.35,0.4>,<-0.05,-0.55,0.4>,r}
+sphere{<-0.25,-0.35,0.6>,r}
+sphere{<-0.25,-0.35,0.4>,r}
+cylinder{<-0.25,-0.35,0.4>,<-0.05,-0.35,0.4>,r}
+cylinder{<-0.25,-0.35,0.4>,<-0.25,-0.35,0.6>,r}
+sphere{<-0.25,-0.55,0.4>,r}
+cylinder{<-0.25,-0.55,0.4>,<-0.05,-0.55,0.4>,r}
+cylinder{<-0.25,-0.55,0.4>,<-0.25,-0.35,0.4>,r}
+sphere{<-0.25,-0.55,0.6>,r}
+cylinder{<-0.25,-0.55,0.6>,<-0.25,-0.35,0.6>,r}
+cylinder{<-0.25,-0.55,0.6>,<-0.25,-0.55,0.4>,r}
+cylinder{<-0.25,-0.55,0.6>,<-0.05,-0.55,0.6>,r}
+sphere{<-0.05,-0.35,0.6>,r}
+cylinder{<-0.05,-0.35,0.6>,<-0.05,-0.35,0.4>,r}
+cylinder{<-0.05,-0.35,0.6>,<-0.25,-0.35,0.6>,r}
+cylinder{<-0.05,-0.35,0.6>,<-0.05,-0.55,0.6>,r}
+// cell 130
+sphere{<-0.05,-0.55,0.4>,r}
+sphere{<-0.05,-0.55,0.6>,r}
+cylinder{<-0.05,-0.55,0.6>,<-0.05,-0.55,0.4>,r}
+sphere{<-0.05,-0.35,0.4>,r}
+cylinder{<-0.05,-0.35,0.4>,<-0.05,-0.55,0.4>,r}
+sphere{<0.15,-0.35,0.4>,r}
+cylinder{<0.15,-0.35,0.4>,<-0.05,-0.35,0.4>,r}
+sphere{<-0.05,-0.35,0.6>,r}
+cylinder{<-0.05,-0.35,0.6>,<-0.05,-0.35,0.4>,r}
+cylinder{<-0.05,-0.35,0.6>,<-0.05,-0.55,0.6>,r}
+sphere{<0.15,-0.55,0.4>,r}
+cylinder{<0.15,-0.55,0.4>,<0.15,-0.35,0.4>,r}
+cylinder{<0.15,-0.55,0.4>,<-0.05,-0.55,0.4>,r}
+sphere{<0.15,-0.35,0.6>,r}
+cylinder{<0.15,-0.35,0.6>,<-0.05,-0.35,0.6>,r}
+cylinder{<0.15,-0.35,0.6>,<0.15,-0.35,0.4>,r}
+sphere{<0.15,-0.55,0.6>,r}
+cylinder{<0.15,-0.55,0.6>,<0.15,-0.35,0.6>,r}
+cylinder{<0.15,-0.55,0.6>,<-0.05,-0.55,0.6>,r}
+cylinder{<0.15,-0.55,0.6>,<0.15,-0.55,0.4>,r}
+// cell 131
+sphere{<0.15,-0.55,0.4>,r}
+sphere{<0.35,-0.35,0.6>,r}
+sphere{<0.15,-0.35,0.6>,r}
+cylinder{<0.15,-0.35,0.6>,<0.35,-0.35,0.6>,r}
+sphere{<0.35,-0.55,0.4>,r}
+cylinder{<0.35,-0.55,0.4>,<0.15,-0.55,0.4>,r}
+sphere{<0.15,-0.55,0.6>,r}
+cylinder{<0.15,-0.55,0.6>,<0.15,-0.35,0.6>,r}
+cylinder{<0.15,-0.55,0.6>,<0.15,-0.55,0.4>,r}
+sphere{<0.35,-0.55,0.6>,r}
+cylinder{<0.35,-0.55,0.6>,<0.35,-0.35,0.6>,r}
+cylinder{<0.35,-0.55,0.6>,<0.15,-0.55,0.6>,r}
+cylinder{<0.35,-0.55,0.6>,<0.35,-0.55,0.4>,r}
+sphere{<0.15,-0.35,0.4>,r}
+cylinder{<0.15,-0.35,0.4>,<0.15,-0.55,0.4>,r}
+cylinder{<0.15,-0.35,0.4>,<0.15,-0.35,0.6>,r}
+sphere{<0.35,-0.35,0.4>,r}
+cylinder{<0.35,-0.35,0.4>,<0.35,-0.35,0.6>,r}
+cylinder{<0.35,-0.35,0.4>,<0.35,-0.55,0.4>,r}
+cylinder{<0.35,-0.35,0.4>,<0.15,-0.35,0.4>,r}
+// cell 132
+sphere{<0.55,-0.35,0.6>,r}
+sphere{<0.35,-0.35,0.6>,r}
+cylinder{<0.35,-0.35,0.6>,<0.55,-0.35,0.6>,r}
+sphere{<0.35,-0.55,0.4>,r}
+sphere{<0.561588,-0.561588,0.411588>,r}
+sphere{<0.394975,-0.594975,0.6>,r}
+sphere{<0.594975,-0.394975,0.6>,r}
+cylinder{<0.594975,-0.394975,0.6>,<0.55,-0.35,0.6>,r}
+cylinder{<0.594975,-0.394975,0.6>,<0.394975,-0.594975,0.6>,r}
+sphere{<0.35,-0.55,0.6>,r}
+cylinder{<0.35,-0.55,0.6>,<0.35,-0.55,0.4>,r}
+cylinder{<0.35,-0.55,0.6>,<0.394975,-0.594975,0.6>,r}
+cylinder{<0.35,-0.55,0.6>,<0.35,-0.35,0.6>,r}
+sphere{<0.35,-0.35,0.4>,r}
+cylinder{<0.35,-0.35,0.4>,<0.35,-0.55,0.4>,r}
+cylinder{<0.35,-0.35,0.4>,<0.35,-0.35,0.6>,r}
+sphere{<0.435468,-0.635468,0.485468>,r}
+cylinder{<0.435468,-0.635468,0.485468>,<0.561588,-0.561588,0.411588>,r}
+cylinder{<0.435468,-0.635468,0.485468>,<0.394975,-0.594975,0.6>,r}
+cylinder{<0.435468,-0.635468,0.485468>,<0.35,-0.55,0.4>,r}
+sphere{<0.55,-0.55,0.4>,r}
+cylinder{<0.55,-0.55,0.4>,<0.561588,-0.561588,0.411588>,r}
+cylinder{<0.55,-0.55,0.4>,<0.35,-0.55,0.4>,r}
+sphere{<0.635468,-0.435468,0.485468>,r}
+cylinder{<0.635468,-0.435468,0.485468>,<0.594975,-0.394975,0.6>,r}
+cylinder{<0.635468,-0.435468,0.485468>,<0.561588,-0.561588,0.411588>,r}
+sphere{<0.55,-0.35,0.4>,r}
+cylinder{<0.55,-0.35,0.4>,<0.35,-0.35,0.4>,r}
+cylinder{<0.55,-0.35,0.4>,<0.55,-0.35,0.6>,r}
+cylinder{<0.55,-0.35,0.4>,<0.635468,-0.435468,0.485468>,r}
+cylinder{<0.55,-0.35,0.4>,<0.55,-0.55,0.4>,r}
+// cell 133
+sphere{<-0.753655,-0.15,0.503655>,r}
+sphere{<-0.45,-0.15,0.4>,r}
+sphere{<-0.45,-0.15,0.6>,r}
+cylinder{<-0.45,-0.15,0.6>,<-0.45,-0.15,0.4>,r}
+sphere{<-0.700739,-0.15,0.6>,r}
+cylinder{<-0.700739,-0.15,0.6>,<-0.45,-0.15,0.6>,r}
+cylinder{<-0.700739,-0.15,0.6>,<-0.753655,-0.15,0.503655>,r}
+sphere{<-0.45,-0.35,0.4>,r}
+cylinder{<-0.45,-0.35,0.4>,<-0.45,-0.15,0.4>,r}
+sphere{<-0.65,-0.15,0.4>,r}
+cylinder{<-0.65,-0.15,0.4>,<-0.45,-0.15,0.4>,r}
+cylinder{<-0.65,-0.15,0.4>,<-0.753655,-0.15,0.503655>,r}
+sphere{<-0.45,-0.35,0.6>,r}
+cylinder{<-0.45,-0.35,0.6>,<-0.45,-0.35,0.4>,r}
+cylinder{<-0.45,-0.35,0.6>,<-0.45,-0.15,0.6>,r}
+sphere{<-0.60983,-0.35,0.6>,r}
+cylinder{<-0.60983,-0.35,0.6>,<-0.45,-0.35,0.6>,r}
+cylinder{<-0.60983,-0.35,0.6>,<-0.700739,-0.15,0.6>,r}
+sphere{<-0.65,-0.35,0.4>,r}
+cylinder{<-0.65,-0.35,0.4>,<-0.65,-0.15,0.4>,r}
+cylinder{<-0.65,-0.35,0.4>,<-0.45,-0.35,0.4>,r}
+sphere{<-0.694975,-0.35,0.444975>,r}
+cylinder{<-0.694975,-0.35,0.444975>,<-0.65,-0.35,0.4>,r}
+cylinder{<-0.694975,-0.35,0.444975>,<-0.60983,-0.35,0.6>,r}
+cylinder{<-0.694975,-0.35,0.444975>,<-0.753655,-0.15,0.503655>,r}
+// cell 134
+sphere{<-0.45,-0.35,0.4>,r}
+sphere{<-0.25,-0.35,0.4>,r}
+cylinder{<-0.25,-0.35,0.4>,<-0.45,-0.35,0.4>,r}
+sphere{<-0.25,-0.15,0.4>,r}
+cylinder{<-0.25,-0.15,0.4>,<-0.25,-0.35,0.4>,r}
+sphere{<-0.25,-0.15,0.6>,r}
+cylinder{<-0.25,-0.15,0.6>,<-0.25,-0.15,0.4>,r}
+sphere{<-0.45,-0.15,0.4>,r}
+cylinder{<-0.45,-0.15,0.4>,<-0.25,-0.15,0.4>,r}
+cylinder{<-0.45,-0.15,0.4>,<-0.45,-0.35,0.4>,r}
+sphere{<-0.25,-0.35,0.6>,r}
+cylinder{<-0.25,-0.35,0.6>,<-0.25,-0.15,0.6>,r}
+cylinder{<-0.25,-0.35,0.6>,<-0.25,-0.35,0.4>,r}
+sphere{<-0.45,-0.35,0.6>,r}
+cylinder{<-0.45,-0.35,0.6>,<-0.25,-0.35,0.6>,r}
+cylinder{<-0.45,-0.35,0.6>,<-0.45,-0.35,0.4>,r}
+sphere{<-0.45,-0.15,0.6>,r}
+cylinder{<-0.45,-0.15,0.6>,<-0.45,-0.35,0.6>,r}
+cylinder{<-0.45,-0.15,0.6>,<-0.25,-0.15,0.6>,r}
+cylinder{<-0.45,-0.15,0.6>,<-0.45,-0.15,0.4>,r}
+// cell 135
+sphere{<-0.25,-0.15,0.4>,r}
+sphere{<-0.05,-0.35,0.6>,r}
+sphere{<-0.25,-0.35,0.6>,r}
+cylinder{<-0.25,-0.35,0.6>,<-0.05,-0.35,0.6>,r}
+sphere{<-0.25,-0.15,0.6>,r}
+cylinder{<-0.25,-0.15,0.6>,<-0.25,-0.35,0.6>,r}
+cylinder{<-0.25,-0.15,0.6>,<-0.25,-0.15,0.4>,r}
+sphere{<-0.25,-0.35,0.4>,r}
+cylinder{<-0.25,-0.35,0.4>,<-0.25,-0.35,0.6>,r}
+cylinder{<-0.25,-0.35,0.4>,<-0.25,-0.15,0.4>,r}
+sphere{<-0.05,-0.35,0.4>,r}
+cylinder{<-0.05,-0.35,0.4>,<-0.05,-0.35,0.6>,r}
+cylinder{<-0.05,-0.35,0.4>,<-0.25,-0.35,0.4>,r}
+sphere{<-0.05,-0.15,0.6>,r}
+cylinder{<-0.05,-0.15,0.6>,<-0.05,-0.35,0.6>,r}
+cylinder{<-0.05,-0.15,0.6>,<-0.25,-0.15,0.6>,r}
+sphere{<-0.05,-0.15,0.4>,r}
+cylinder{<-0.05,-0.15,0.4>,<-0.05,-0.35,0.4>,r}
+cylinder{<-0.05,-0.15,0.4>,<-0.25,-0.15,0.4>,r}
+cylinder{<-0.05,-0.15,0.4>,<-0.05,-0.15,0.6>,r}
+// cell 136
+sphere{<-0.05,-0.15,0.4>,r}
+sphere{<0.15,-0.35,0.6>,r}
+sphere{<-0.05,-0.15,0.6>,r}
+cylinder{<-0.05,-0.15,0.6>,<-0.05,-0.15,0.4>,r}
+sphere{<0.15,-0.15,0.4>,r}
+cylinder{<0.15,-0.15,0.4>,<-0.05,-0.15,0.4>,r}
+sphere{<0.15,-0.35,0.4>,r}
+cylinder{<0.15,-0.35,0.4>,<0.15,-0.35,0.6>,r}
+cylinder{<0.15,-0.35,0.4>,<0.15,-0.15,0.4>,r}
+sphere{<-0.05,-0.35,0.4>,r}
+cylinder{<-0.05,-0.35,0.4>,<0.15,-0.35,0.4>,r}
+cylinder{<-0.05,-0.35,0.4>,<-0.05,-0.15,0.4>,r}
+sphere{<-0.05,-0.35,0.6>,r}
+cylinder{<-0.05,-0.35,0.6>,<0.15,-0.35,0.6>,r}
+cylinder{<-0.05,-0.35,0.6>,<-0.05,-0.15,0.6>,r}
+cylinder{<-0.05,-0.35,0.6>,<-0.05,-0.35,0.4>,r}
+sphere{<0.15,-0.15,0.6>,r}
+cylinder{<0.15,-0.15,0.6>,<0.15,-0.35,0.6>,r}
+cylinder{<0.15,-0.15,0.6>,<0.15,-0.15,0.4>,r}
+cylinder{<0.15,-0.15,0.6>,<-0.05,-0.15,0.6>,r}
+// cell 137
+sphere{<0.15,-0.35,0.4>,r}
+sphere{<0.35,-0.15,0.6>,r}
+sphere{<0.15,-0.15,0.6>,r}
+cylinder{<0.15,-0.15,0.6>,<0.35,-0.15,0.6>,r}
+sphere{<0.35,-0.15,0.4>,r}
+cylinder{<0.35,-0.15,0.4>,<0.35,-0.15,0.6>,r}
+sphere{<0.15,-0.35,0.6>,r}
+cylinder{<0.15,-0.35,0.6>,<0.15,-0.15,0.6>,r}
+cylinder{<0.15,-0.35,0.6>,<0.15,-0.35,0.4>,r}
+sphere{<0.35,-0.35,0.6>,r}
+cylinder{<0.35,-0.35,0.6>,<0.35,-0.15,0.6>,r}
+cylinder{<0.35,-0.35,0.6>,<0.15,-0.35,0.6>,r}
+sphere{<0.15,-0.15,0.4>,r}
+cylinder{<0.15,-0.15,0.4>,<0.15,-0.15,0.6>,r}
+cylinder{<0.15,-0.15,0.4>,<0.35,-0.15,0.4>,r}
+cylinder{<0.15,-0.15,0.4>,<0.15,-0.35,0.4>,r}
+sphere{<0.35,-0.35,0.4>,r}
+cylinder{<0.35,-0.35,0.4>,<0.35,-0.15,0.4>,r}
+cylinder{<0.35,-0.35,0.4>,<0.35,-0.35,0.6>,r}
+cylinder{<0.35,-0.35,0.4>,<0.15,-0.35,0.4>,r}
+// cell 138
+sphere{<0.35,-0.35,0.4>,r}
+sphere{<0.55,-0.15,0.6>,r}
+sphere{<0.35,-0.15,0.6>,r}
+cylinder{<0.35,-0.15,0.6>,<0.55,-0.15,0.6>,r}
+sphere{<0.55,-0.15,0.4>,r}
+cylinder{<0.55,-0.15,0.4>,<0.55,-0.15,0.6>,r}
+sphere{<0.35,-0.35,0.6>,r}
+cylinder{<0.35,-0.35,0.6>,<0.35,-0.15,0.6>,r}
+cylinder{<0.35,-0.35,0.6>,<0.35,-0.35,0.4>,r}
+sphere{<0.55,-0.35,0.6>,r}
+cylinder{<0.55,-0.35,0.6>,<0.35,-0.35,0.6>,r}
+cylinder{<0.55,-0.35,0.6>,<0.55,-0.15,0.6>,r}
+sphere{<0.35,-0.15,0.4>,r}
+cylinder{<0.35,-0.15,0.4>,<0.35,-0.15,0.6>,r}
+cylinder{<0.35,-0.15,0.4>,<0.55,-0.15,0.4>,r}
+cylinder{<0.35,-0.15,0.4>,<0.35,-0.35,0.4>,r}
+sphere{<0.55,-0.35,0.4>,r}
+cylinder{<0.55,-0.35,0.4>,<0.55,-0.15,0.4>,r}
+cylinder{<0.55,-0.35,0.4>,<0.55,-0.35,0.6>,r}
+cylinder{<0.55,-0.35,0.4>,<0.35,-0.35,0.4>,r}
+// cell 139
+sphere{<0.639837,-0.439837,0.489837>,r}
+sphere{<0.55,-0.15,0.6>,r}
+sphere{<0.722516,-0.35,0.4>,r}
+cylinder{<0.722516,-0.35,0.4>,<0.639837,-0.439837,0.489837>,r}
+sphere{<0.799439,-0.15,0.4>,r}
+cylinder{<0.799439,-0.15,0.4>,<0.722516,-0.35,0.4>,r}
+sphere{<0.55,-0.35,0.6>,r}
+cylinder{<0.55,-0.35,0.6>,<0.55,-0.15,0.6>,r}
+sphere{<0.55,-0.15,0.4>,r}
+cylinder{<0.55,-0.15,0.4>,<0.55,-0.15,0.6>,r}
+cylinder{<0.55,-0.15,0.4>,<0.799439,-0.15,0.4>,r}
+sphere{<0.59257,-0.35,0.64257>,r}
+cylinder{<0.59257,-0.35,0.64257>,<0.55,-0.35,0.6>,r}
+sphere{<0.642659,-0.15,0.692659>,r}
+cylinder{<0.642659,-0.15,0.692659>,<0.59257,-0.35,0.64257>,r}
+cylinder{<0.642659,-0.15,0.692659>,<0.799439,-0.15,0.4>,r}
+cylinder{<0.642659,-0.15,0.692659>,<0.55,-0.15,0.6>,r}
+sphere{<0.55,-0.35,0.4>,r}
+cylinder{<0.55,-0.35,0.4>,<0.55,-0.15,0.4>,r}
+cylinder{<0.55,-0.35,0.4>,<0.722516,-0.35,0.4>,r}
+cylinder{<0.55,-0.35,0.4>,<0.639837,-0.439837,0.489837>,r}
+cylinder{<0.55,-0.35,0.4>,<0.55,-0.35,0.6>,r}
+sphere{<0.597215,-0.397215,0.6>,r}
+cylinder{<0.597215,-0.397215,0.6>,<0.55,-0.35,0.6>,r}
+cylinder{<0.597215,-0.397215,0.6>,<0.639837,-0.439837,0.489837>,r}
+cylinder{<0.597215,-0.397215,0.6>,<0.59257,-0.35,0.64257>,r}
+// cell 140
+sphere{<-0.755085,0.05,0.505085>,r}
+sphere{<-0.45,-0.15,0.4>,r}
+sphere{<-0.65,0.05,0.4>,r}
+cylinder{<-0.65,0.05,0.4>,<-0.755085,0.05,0.505085>,r}
+sphere{<-0.45,0.05,0.4>,r}
+cylinder{<-0.45,0.05,0.4>,<-0.45,-0.15,0.4>,r}
+cylinder{<-0.45,0.05,0.4>,<-0.65,0.05,0.4>,r}
+sphere{<-0.68925,-0.15,0.6>,r}
+sphere{<-0.45,-0.15,0.6>,r}
+cylinder{<-0.45,-0.15,0.6>,<-0.45,-0.15,0.4>,r}
+cylinder{<-0.45,-0.15,0.6>,<-0.68925,-0.15,0.6>,r}
+sphere{<-0.707432,0.05,0.6>,r}
+cylinder{<-0.707432,0.05,0.6>,<-0.755085,0.05,0.505085>,r}
+cylinder{<-0.707432,0.05,0.6>,<-0.68925,-0.15,0.6>,r}
+sphere{<-0.45,0.05,0.6>,r}
+cylinder{<-0.45,0.05,0.6>,<-0.45,-0.15,0.6>,r}
+cylinder{<-0.45,0.05,0.6>,<-0.45,0.05,0.4>,r}
+cylinder{<-0.45,0.05,0.6>,<-0.707432,0.05,0.6>,r}
+sphere{<-0.65,-0.15,0.4>,r}
+cylinder{<-0.65,-0.15,0.4>,<-0.65,0.05,0.4>,r}
+cylinder{<-0.65,-0.15,0.4>,<-0.45,-0.15,0.4>,r}
+sphere{<-0.742981,-0.15,0.492981>,r}
+cylinder{<-0.742981,-0.15,0.492981>,<-0.65,-0.15,0.4>,r}
+cylinder{<-0.742981,-0.15,0.492981>,<-0.68925,-0.15,0.6>,r}
+cylinder{<-0.742981,-0.15,0.492981>,<-0.755085,0.05,0.505085>,r}
+// cell 141
+sphere{<-0.45,-0.15,0.4>,r}
+sphere{<-0.25,-0.15,0.4>,r}
+cylinder{<-0.25,-0.15,0.4>,<-0.45,-0.15,0.4>,r}
+sphere{<-0.45,0.05,0.4>,r}
+cylinder{<-0.45,0.05,0.4>,<-0.45,-0.15,0.4>,r}
+sphere{<-0.25,0.05,0.4>,r}
+cylinder{<-0.25,0.05,0.4>,<-0.45,0.05,0.4>,r}
+cylinder{<-0.25,0.05,0.4>,<-0.25,-0.15,0.4>,r}
+sphere{<-0.45,-0.15,0.6>,r}
+cylinder{<-0.45,-0.15,0.6>,<-0.45,-0.15,0.4>,r}
+sphere{<-0.25,-0.15,0.6>,r}
+cylinder{<-0.25,-0.15,0.6>,<-0.45,-0.15,0.6>,r}
+cylinder{<-0.25,-0.15,0.6>,<-0.25,-0.15,0.4>,r}
+sphere{<-0.45,0.05,0.6>,r}
+cylinder{<-0.45,0.05,0.6>,<-0.45,-0.15,0.6>,r}
+cylinder{<-0.45,0.05,0.6>,<-0.45,0.05,0.4>,r}
+sphere{<-0.25,0.05,0.6>,r}
+cylinder{<-0.25,0.05,0.6>,<-0.25,0.05,0.4>,r}
+cylinder{<-0.25,0.05,0.6>,<-0.45,0.05,0.6>,r}
+cylinder{<-0.25,0.05,0.6>,<-0.25,-0.15,0.6>,r}
+// cell 142
+sphere{<-0.25,-0.15,0.4>,r}
+sphere{<-0.05,-0.15,0.4>,r}
+cylinder{<-0.05,-0.15,0.4>,<-0.25,-0.15,0.4>,r}
+sphere{<-0.05,0.05,0.6>,r}
+sphere{<-0.25,0.05,0.6>,r}
+cylinder{<-0.25,0.05,0.6>,<-0.05,0.05,0.6>,r}
+sphere{<-0.25,0.05,0.4>,r}
+cylinder{<-0.25,0.05,0.4>,<-0.25,0.05,0.6>,r}
+cylinder{<-0.25,0.05,0.4>,<-0.25,-0.15,0.4>,r}
+sphere{<-0.05,-0.15,0.6>,r}
+cylinder{<-0.05,-0.15,0.6>,<-0.05,0.05,0.6>,r}
+cylinder{<-0.05,-0.15,0.6>,<-0.05,-0.15,0.4>,r}
+sphere{<-0.05,0.05,0.4>,r}
+cylinder{<-0.05,0.05,0.4>,<-0.05,-0.15,0.4>,r}
+cylinder{<-0.05,0.05,0.4>,<-0.25,0.05,0.4>,r}
+cylinder{<-0.05,0.05,0.4>,<-0.05,0.05,0.6>,r}
+sphere{<-0.25,-0.15,0.6>,r}
+cylinder{<-0.25,-0.15,0.6>,<-0.05,-0.15,0.6>,r}
+cylinder{<-0.25,-0.15,0.6>,<-0.25,0.05,0.6>,r}
+cylinder{<-0.25,-0.15,0.6>,<-0.25,-0.15,0.4>,r}
+// cell 143
+sphere{<0.15,0.05,0.4>,r}
+sphere{<-0.05,-0.15,0.4>,r}
+sphere{<-0.05,0.05,0.6>,r}
+sphere{<-0.05,0.05,0.4>,r}
+cylinder{<-0.05,0.05,0.4>,<-0.05,-0.15,0.4>,r}
+cylinder{<-0.05,0.05,0.4>,<-0.05,0.05,0.6>,r}
+cylinder{<-0.05,0.05,0.4>,<0.15,0.05,0.4>,r}
+sphere{<0.15,0.05,0.6>,r}
+cylinder{<0.15,0.05,0.6>,<0.15,0.05,0.4>,r}
+cylinder{<0.15,0.05,0.6>,<-0.05,0.05,0.6>,r}
+sphere{<-0.05,-0.15,0.6>,r}
+cylinder{<-0.05,-0.15,0.6>,<-0.05,0.05,0.6>,r}
+cylinder{<-0.05,-0.15,0.6>,<-0.05,-0.15,0.4>,r}
+sphere{<0.15,-0.15,0.6>,r}
+cylinder{<0.15,-0.15,0.6>,<0.15,0.05,0.6>,r}
+cylinder{<0.15,-0.15,0.6>,<-0.05,-0.15,0.6>,r}
+sphere{<0.15,-0.15,0.4>,r}
+cylinder{<0.15,-0.15,0.4>,<0.15,-0.15,0.6>,r}
+cylinder{<0.15,-0.15,0.4>,<-0.05,-0.15,0.4>,r}
+cylinder{<0.15,-0.15,0.4>,<0.15,0.05,0.4>,r}
+// cell 144
+sphere{<0.15,-0.15,0.4>,r}
+sphere{<0.15,0.05,0.6>,r}
+sphere{<0.35,-0.15,0.4>,r}
+cylinder{<0.35,-0.15,0.4>,<0.15,-0.15,0.4>,r}
+sphere{<0.35,0.05,0.4>,r}
+cylinder{<0.35,0.05,0.4>,<0.35,-0.15,0.4>,r}
+sphere{<0.15,-0.15,0.6>,r}
+cylinder{<0.15,-0.15,0.6>,<0.15,0.05,0.6>,r}
+cylinder{<0.15,-0.15,0.6>,<0.15,-0.15,0.4>,r}
+sphere{<0.15,0.05,0.4>,r}
+cylinder{<0.15,0.05,0.4>,<0.15,0.05,0.6>,r}
+cylinder{<0.15,0.05,0.4>,<0.35,0.05,0.4>,r}
+cylinder{<0.15,0.05,0.4>,<0.15,-0.15,0.4>,r}
+sphere{<0.35,0.05,0.6>,r}
+cylinder{<0.35,0.05,0.6>,<0.35,0.05,0.4>,r}
+cylinder{<0.35,0.05,0.6>,<0.15,0.05,0.6>,r}
+sphere{<0.35,-0.15,0.6>,r}
+cylinder{<0.35,-0.15,0.6>,<0.35,0.05,0.6>,r}
+cylinder{<0.35,-0.15,0.6>,<0.15,-0.15,0.6>,r}
+cylinder{<0.35,-0.15,0.6>,<0.35,-0.15,0.4>,r}
+// cell 145
+sphere{<0.35,-0.15,0.4>,r}
+sphere{<0.55,-0.15,0.6>,r}
+sphere{<0.35,0.05,0.4>,r}
+cylinder{<0.35,0.05,0.4>,<0.35,-0.15,0.4>,r}
+sphere{<0.35,-0.15,0.6>,r}
+cylinder{<0.35,-0.15,0.6>,<0.55,-0.15,0.6>,r}
+cylinder{<0.35,-0.15,0.6>,<0.35,-0.15,0.4>,r}
+sphere{<0.55,-0.15,0.4>,r}
+cylinder{<0.55,-0.15,0.4>,<0.55,-0.15,0.6>,r}
+cylinder{<0.55,-0.15,0.4>,<0.35,-0.15,0.4>,r}
+sphere{<0.55,0.05,0.4>,r}
+cylinder{<0.55,0.05,0.4>,<0.35,0.05,0.4>,r}
+cylinder{<0.55,0.05,0.4>,<0.55,-0.15,0.4>,r}
+sphere{<0.35,0.05,0.6>,r}
+cylinder{<0.35,0.05,0.6>,<0.35,0.05,0.4>,r}
+cylinder{<0.35,0.05,0.6>,<0.35,-0.15,0.6>,r}
+sphere{<0.55,0.05,0.6>,r}
+cylinder{<0.55,0.05,0.6>,<0.55,0.05,0.4>,r}
+cylinder{<0.55,0.05,0.6>,<0.35,0.05,0.6>,r}
+cylinder{<0.55,0.05,0.6>,<0.55,-0.15,0.6>,r}
+// cell 146
+sphere{<0.643594,-0.15,0.693594>,r}
+sphere{<0.790825,-0.15,0.4>,r}
+cylinder{<0.790825,-0.15,0.4>,<0.643594,-0.15,0.693594>,r}
+sphere{<0.55,0.05,0.4>,r}
+sphere{<0.80621,0.05,0.4>,r}
+cylinder{<0.80621,0.05,0.4>,<0.790825,-0.15,0.4>,r}
+cylinder{<0.80621,0.05,0.4>,<0.55,0.05,0.4>,r}
+sphere{<0.65384,0.05,0.70384>,r}
+cylinder{<0.65384,0.05,0.70384>,<0.643594,-0.15,0.693594>,r}
+cylinder{<0.65384,0.05,0.70384>,<0.80621,0.05,0.4>,r}
+sphere{<0.55,-0.15,0.4>,r}
+cylinder{<0.55,-0.15,0.4>,<0.55,0.05,0.4>,r}
+cylinder{<0.55,-0.15,0.4>,<0.790825,-0.15,0.4>,r}
+sphere{<0.55,0.05,0.6>,r}
+cylinder{<0.55,0.05,0.6>,<0.65384,0.05,0.70384>,r}
+cylinder{<0.55,0.05,0.6>,<0.55,0.05,0.4>,r}
+sphere{<0.55,-0.15,0.6>,r}
+cylinder{<0.55,-0.15,0.6>,<0.55,0.05,0.6>,r}
+cylinder{<0.55,-0.15,0.6>,<0.55,-0.15,0.4>,r}
+cylinder{<0.55,-0.15,0.6>,<0.643594,-0.15,0.693594>,r}
+// cell 147
+sphere{<-0.45,0.05,0.4>,r}
+sphere{<-0.45,0.25,0.4>,r}
+cylinder{<-0.45,0.25,0.4>,<-0.45,0.05,0.4>,r}
+sphere{<-0.71193,0.05,0.6>,r}
+sphere{<-0.65,0.25,0.4>,r}
+cylinder{<-0.65,0.25,0.4>,<-0.45,0.25,0.4>,r}
+sphere{<-0.45,0.25,0.6>,r}
+cylinder{<-0.45,0.25,0.6>,<-0.45,0.25,0.4>,r}
+sphere{<-0.45,0.05,0.6>,r}
+cylinder{<-0.45,0.05,0.6>,<-0.71193,0.05,0.6>,r}
+cylinder{<-0.45,0.05,0.6>,<-0.45,0.05,0.4>,r}
+cylinder{<-0.45,0.05,0.6>,<-0.45,0.25,0.6>,r}
+sphere{<-0.723134,0.25,0.473134>,r}
+cylinder{<-0.723134,0.25,0.473134>,<-0.65,0.25,0.4>,r}
+sphere{<-0.657384,0.25,0.6>,r}
+cylinder{<-0.657384,0.25,0.6>,<-0.723134,0.25,0.473134>,r}
+cylinder{<-0.657384,0.25,0.6>,<-0.71193,0.05,0.6>,r}
+cylinder{<-0.657384,0.25,0.6>,<-0.45,0.25,0.6>,r}
+sphere{<-0.65,0.05,0.4>,r}
+cylinder{<-0.65,0.05,0.4>,<-0.65,0.25,0.4>,r}
+cylinder{<-0.65,0.05,0.4>,<-0.45,0.05,0.4>,r}
+sphere{<-0.75906,0.05,0.50906>,r}
+cylinder{<-0.75906,0.05,0.50906>,<-0.71193,0.05,0.6>,r}
+cylinder{<-0.75906,0.05,0.50906>,<-0.723134,0.25,0.473134>,r}
+cylinder{<-0.75906,0.05,0.50906>,<-0.65,0.05,0.4>,r}
+// cell 148
+sphere{<-0.25,0.05,0.4>,r}
+sphere{<-0.45,0.25,0.4>,r}
+sphere{<-0.25,0.05,0.6>,r}
+cylinder{<-0.25,0.05,0.6>,<-0.25,0.05,0.4>,r}
+sphere{<-0.45,0.05,0.4>,r}
+cylinder{<-0.45,0.05,0.4>,<-0.45,0.25,0.4>,r}
+cylinder{<-0.45,0.05,0.4>,<-0.25,0.05,0.4>,r}
+sphere{<-0.25,0.25,0.4>,r}
+cylinder{<-0.25,0.25,0.4>,<-0.25,0.05,0.4>,r}
+cylinder{<-0.25,0.25,0.4>,<-0.45,0.25,0.4>,r}
+sphere{<-0.25,0.25,0.6>,r}
+cylinder{<-0.25,0.25,0.6>,<-0.25,0.05,0.6>,r}
+cylinder{<-0.25,0.25,0.6>,<-0.25,0.25,0.4>,r}
+sphere{<-0.45,0.05,0.6>,r}
+cylinder{<-0.45,0.05,0.6>,<-0.25,0.05,0.6>,r}
+cylinder{<-0.45,0.05,0.6>,<-0.45,0.05,0.4>,r}
+sphere{<-0.45,0.25,0.6>,r}
+cylinder{<-0.45,0.25,0.6>,<-0.45,0.05,0.6>,r}
+cylinder{<-0.45,0.25,0.6>,<-0.25,0.25,0.6>,r}
+cylinder{<-0.45,0.25,0.6>,<-0.45,0.25,0.4>,r}
+// cell 149
+sphere{<-0.05,0.25,0.4>,r}
+sphere{<-0.25,0.05,0.6>,r}
+sphere{<-0.25,0.25,0.6>,r}
+cylinder{<-0.25,0.25,0.6>,<-0.25,0.05,0.6>,r}
+sphere{<-0.05,0.05,0.4>,r}
+cylinder{<-0.05,0.05,0.4>,<-0.05,0.25,0.4>,r}
+sphere{<-0.05,0.25,0.6>,r}
+cylinder{<-0.05,0.25,0.6>,<-0.25,0.25,0.6>,r}
+cylinder{<-0.05,0.25,0.6>,<-0.05,0.25,0.4>,r}
+sphere{<-0.05,0.05,0.6>,r}
+cylinder{<-0.05,0.05,0.6>,<-0.05,0.25,0.6>,r}
+cylinder{<-0.05,0.05,0.6>,<-0.25,0.05,0.6>,r}
+cylinder{<-0.05,0.05,0.6>,<-0.05,0.05,0.4>,r}
+sphere{<-0.25,0.25,0.4>,r}
+cylinder{<-0.25,0.25,0.4>,<-0.05,0.25,0.4>,r}
+cylinder{<-0.25,0.25,0.4>,<-0.25,0.25,0.6>,r}
+sphere{<-0.25,0.05,0.4>,r}
+cylinder{<-0.25,0.05,0.4>,<-0.25,0.25,0.4>,r}
+cylinder{<-0.25,0.05,0.4>,<-0.05,0.05,0.4>,r}
+cylinder{<-0.25,0.05,0.4>,<-0.25,0.05,0.6>,r}
+// cell 150
+sphere{<0.15,0.25,0.4>,r}
+sphere{<0.15,0.05,0.4>,r}
+cylinder{<0.15,0.05,0.4>,<0.15,0.25,0.4>,r}
+sphere{<-0.05,0.25,0.4>,r}
+cylinder{<-0.05,0.25,0.4>,<0.15,0.25,0.4>,r}
+sphere{<-0.05,0.05,0.6>,r}
+sphere{<-0.05,0.25,0.6>,r}
+cylinder{<-0.05,0.25,0.6>,<-0.05,0.25,0.4>,r}
+cylinder{<-0.05,0.25,0.6>,<-0.05,0.05,0.6>,r}
+sphere{<0.15,0.05,0.6>,r}
+cylinder{<0.15,0.05,0.6>,<0.15,0.05,0.4>,r}
+cylinder{<0.15,0.05,0.6>,<-0.05,0.05,0.6>,r}
+sphere{<0.15,0.25,0.6>,r}
+cylinder{<0.15,0.25,0.6>,<-0.05,0.25,0.6>,r}
+cylinder{<0.15,0.25,0.6>,<0.15,0.05,0.6>,r}
+cylinder{<0.15,0.25,0.6>,<0.15,0.25,0.4>,r}
+sphere{<-0.05,0.05,0.4>,r}
+cylinder{<-0.05,0.05,0.4>,<-0.05,0.05,0.6>,r}
+cylinder{<-0.05,0.05,0.4>,<-0.05,0.25,0.4>,r}
+cylinder{<-0.05,0.05,0.4>,<0.15,0.05,0.4>,r}
+// cell 151
+sphere{<0.15,0.05,0.4>,r}
+sphere{<0.35,0.05,0.4>,r}
+cylinder{<0.35,0.05,0.4>,<0.15,0.05,0.4>,r}
+sphere{<0.35,0.25,0.6>,r}
+sphere{<0.35,0.25,0.4>,r}
+cylinder{<0.35,0.25,0.4>,<0.35,0.25,0.6>,r}
+cylinder{<0.35,0.25,0.4>,<0.35,0.05,0.4>,r}
+sphere{<0.15,0.05,0.6>,r}
+cylinder{<0.15,0.05,0.6>,<0.15,0.05,0.4>,r}
+sphere{<0.35,0.05,0.6>,r}
+cylinder{<0.35,0.05,0.6>,<0.35,0.05,0.4>,r}
+cylinder{<0.35,0.05,0.6>,<0.35,0.25,0.6>,r}
+cylinder{<0.35,0.05,0.6>,<0.15,0.05,0.6>,r}
+sphere{<0.15,0.25,0.4>,r}
+cylinder{<0.15,0.25,0.4>,<0.35,0.25,0.4>,r}
+cylinder{<0.15,0.25,0.4>,<0.15,0.05,0.4>,r}
+sphere{<0.15,0.25,0.6>,r}
+cylinder{<0.15,0.25,0.6>,<0.15,0.25,0.4>,r}
+cylinder{<0.15,0.25,0.6>,<0.15,0.05,0.6>,r}
+cylinder{<0.15,0.25,0.6>,<0.35,0.25,0.6>,r}
+// cell 152
+sphere{<0.35,0.05,0.4>,r}
+sphere{<0.55,0.05,0.4>,r}
+cylinder{<0.55,0.05,0.4>,<0.35,0.05,0.4>,r}
+sphere{<0.55,0.25,0.4>,r}
+cylinder{<0.55,0.25,0.4>,<0.55,0.05,0.4>,r}
+sphere{<0.55,0.25,0.6>,r}
+cylinder{<0.55,0.25,0.6>,<0.55,0.25,0.4>,r}
+sphere{<0.35,0.05,0.6>,r}
+cylinder{<0.35,0.05,0.6>,<0.35,0.05,0.4>,r}
+sphere{<0.35,0.25,0.6>,r}
+cylinder{<0.35,0.25,0.6>,<0.35,0.05,0.6>,r}
+cylinder{<0.35,0.25,0.6>,<0.55,0.25,0.6>,r}
+sphere{<0.35,0.25,0.4>,r}
+cylinder{<0.35,0.25,0.4>,<0.55,0.25,0.4>,r}
+cylinder{<0.35,0.25,0.4>,<0.35,0.05,0.4>,r}
+cylinder{<0.35,0.25,0.4>,<0.35,0.25,0.6>,r}
+sphere{<0.55,0.05,0.6>,r}
+cylinder{<0.55,0.05,0.6>,<0.55,0.05,0.4>,r}
+cylinder{<0.55,0.05,0.6>,<0.55,0.25,0.6>,r}
+cylinder{<0.55,0.05,0.6>,<0.35,0.05,0.6>,r}
+// cell 153
+sphere{<0.653664,0.05,0.703664>,r}
+sphere{<0.809487,0.05,0.4>,r}
+cylinder{<0.809487,0.05,0.4>,<0.653664,0.05,0.703664>,r}
+sphere{<0.55,0.25,0.6>,r}
+sphere{<0.55,0.25,0.4>,r}
+cylinder{<0.55,0.25,0.4>,<0.55,0.25,0.6>,r}
+sphere{<0.55,0.05,0.4>,r}
+cylinder{<0.55,0.05,0.4>,<0.55,0.25,0.4>,r}
+cylinder{<0.55,0.05,0.4>,<0.809487,0.05,0.4>,r}
+sphere{<0.55,0.05,0.6>,r}
+cylinder{<0.55,0.05,0.6>,<0.55,0.25,0.6>,r}
+cylinder{<0.55,0.05,0.6>,<0.55,0.05,0.4>,r}
+cylinder{<0.55,0.05,0.6>,<0.653664,0.05,0.703664>,r}
+sphere{<0.623162,0.25,0.673162>,r}
+cylinder{<0.623162,0.25,0.673162>,<0.55,0.25,0.6>,r}
+cylinder{<0.623162,0.25,0.673162>,<0.653664,0.05,0.703664>,r}
+sphere{<0.763333,0.25,0.4>,r}
+cylinder{<0.763333,0.25,0.4>,<0.55,0.25,0.4>,r}
+cylinder{<0.763333,0.25,0.4>,<0.623162,0.25,0.673162>,r}
+cylinder{<0.763333,0.25,0.4>,<0.809487,0.05,0.4>,r}
+// cell 154
+sphere{<-0.545057,0.545057,0.495057>,r}
+sphere{<-0.45,0.25,0.6>,r}
+sphere{<-0.655331,0.455331,0.405331>,r}
+cylinder{<-0.655331,0.455331,0.405331>,<-0.545057,0.545057,0.495057>,r}
+sphere{<-0.491881,0.491881,0.641881>,r}
+cylinder{<-0.491881,0.491881,0.641881>,<-0.545057,0.545057,0.495057>,r}
+sphere{<-0.670626,0.25,0.6>,r}
+cylinder{<-0.670626,0.25,0.6>,<-0.45,0.25,0.6>,r}
+sphere{<-0.45,0.25,0.4>,r}
+cylinder{<-0.45,0.25,0.4>,<-0.45,0.25,0.6>,r}
+sphere{<-0.65,0.45,0.4>,r}
+cylinder{<-0.65,0.45,0.4>,<-0.655331,0.455331,0.405331>,r}
+sphere{<-0.65,0.25,0.4>,r}
+cylinder{<-0.65,0.25,0.4>,<-0.65,0.45,0.4>,r}
+cylinder{<-0.65,0.25,0.4>,<-0.45,0.25,0.4>,r}
+sphere{<-0.737374,0.25,0.487374>,r}
+cylinder{<-0.737374,0.25,0.487374>,<-0.670626,0.25,0.6>,r}
+cylinder{<-0.737374,0.25,0.487374>,<-0.655331,0.455331,0.405331>,r}
+cylinder{<-0.737374,0.25,0.487374>,<-0.65,0.25,0.4>,r}
+sphere{<-0.45,0.45,0.6>,r}
+cylinder{<-0.45,0.45,0.6>,<-0.491881,0.491881,0.641881>,r}
+cylinder{<-0.45,0.45,0.6>,<-0.45,0.25,0.6>,r}
+sphere{<-0.45,0.45,0.4>,r}
+cylinder{<-0.45,0.45,0.4>,<-0.545057,0.545057,0.495057>,r}
+cylinder{<-0.45,0.45,0.4>,<-0.45,0.45,0.6>,r}
+cylinder{<-0.45,0.45,0.4>,<-0.45,0.25,0.4>,r}
+cylinder{<-0.45,0.45,0.4>,<-0.65,0.45,0.4>,r}
+sphere{<-0.548979,0.348979,0.698979>,r}
+cylinder{<-0.548979,0.348979,0.698979>,<-0.45,0.25,0.6>,r}
+cylinder{<-0.548979,0.348979,0.698979>,<-0.491881,0.491881,0.641881>,r}
+cylinder{<-0.548979,0.348979,0.698979>,<-0.670626,0.25,0.6>,r}
+// cell 155
+sphere{<-0.45,0.25,0.4>,r}
+sphere{<-0.25,0.25,0.4>,r}
+cylinder{<-0.25,0.25,0.4>,<-0.45,0.25,0.4>,r}
+sphere{<-0.45,0.45,0.4>,r}
+cylinder{<-0.45,0.45,0.4>,<-0.45,0.25,0.4>,r}
+sphere{<-0.25,0.45,0.4>,r}
+cylinder{<-0.25,0.45,0.4>,<-0.25,0.25,0.4>,r}
+cylinder{<-0.25,0.45,0.4>,<-0.45,0.45,0.4>,r}
+sphere{<-0.45,0.25,0.6>,r}
+cylinder{<-0.45,0.25,0.6>,<-0.45,0.25,0.4>,r}
+sphere{<-0.25,0.25,0.6>,r}
+cylinder{<-0.25,0.25,0.6>,<-0.45,0.25,0.6>,r}
+cylinder{<-0.25,0.25,0.6>,<-0.25,0.25,0.4>,r}
+sphere{<-0.45,0.45,0.6>,r}
+cylinder{<-0.45,0.45,0.6>,<-0.45,0.25,0.6>,r}
+cylinder{<-0.45,0.45,0.6>,<-0.45,0.45,0.4>,r}
+sphere{<-0.25,0.45,0.6>,r}
+cylinder{<-0.25,0.45,0.6>,<-0.45,0.45,0.6>,r}
+cylinder{<-0.25,0.45,0.6>,<-0.25,0.25,0.6>,r}
+cylinder{<-0.25,0.45,0.6>,<-0.25,0.45,0.4>,r}
+// cell 156
+sphere{<-0.25,0.25,0.4>,r}
+sphere{<-0.05,0.25,0.4>,r}
+cylinder{<-0.05,0.25,0.4>,<-0.25,0.25,0.4>,r}
+sphere{<-0.25,0.45,0.4>,r}
+cylinder{<-0.25,0.45,0.4>,<-0.25,0.25,0.4>,r}
+sphere{<-0.05,0.45,0.4>,r}
+cylinder{<-0.05,0.45,0.4>,<-0.05,0.25,0.4>,r}
+cylinder{<-0.05,0.45,0.4>,<-0.25,0.45,0.4>,r}
+sphere{<-0.05,0.45,0.6>,r}
+cylinder{<-0.05,0.45,0.6>,<-0.05,0.45,0.4>,r}
+sphere{<-0.05,0.25,0.6>,r}
+cylinder{<-0.05,0.25,0.6>,<-0.05,0.45,0.6>,r}
+cylinder{<-0.05,0.25,0.6>,<-0.05,0.25,0.4>,r}
+sphere{<-0.25,0.25,0.6>,r}
+cylinder{<-0.25,0.25,0.6>,<-0.05,0.25,0.6>,r}
+cylinder{<-0.25,0.25,0.6>,<-0.25,0.25,0.4>,r}
+sphere{<-0.25,0.45,0.6>,r}
+cylinder{<-0.25,0.45,0.6>,<-0.25,0.25,0.6>,r}
+cylinder{<-0.25,0.45,0.6>,<-0.05,0.45,0.6>,r}
+cylinder{<-0.25,0.45,0.6>,<-0.25,0.45,0.4>,r}
+// cell 157
+sphere{<-0.05,0.25,0.4>,r}
+sphere{<0.15,0.25,0.4>,r}
+cylinder{<0.15,0.25,0.4>,<-0.05,0.25,0.4>,r}
+sphere{<-0.05,0.45,0.4>,r}
+cylinder{<-0.05,0.45,0.4>,<-0.05,0.25,0.4>,r}
+sphere{<0.15,0.45,0.4>,r}
+cylinder{<0.15,0.45,0.4>,<0.15,0.25,0.4>,r}
+cylinder{<0.15,0.45,0.4>,<-0.05,0.45,0.4>,r}
+sphere{<-0.05,0.25,0.6>,r}
+cylinder{<-0.05,0.25,0.6>,<-0.05,0.25,0.4>,r}
+sphere{<0.15,0.25,0.6>,r}
+cylinder{<0.15,0.25,0.6>,<-0.05,0.25,0.6>,r}
+cylinder{<0.15,0.25,0.6>,<0.15,0.25,0.4>,r}
+sphere{<-0.05,0.45,0.6>,r}
+cylinder{<-0.05,0.45,0.6>,<-0.05,0.45,0.4>,r}
+cylinder{<-0.05,0.45,0.6>,<-0.05,0.25,0.6>,r}
+sphere{<0.15,0.45,0.6>,r}
+cylinder{<0.15,0.45,0.6>,<-0.05,0.45,0.6>,r}
+cylinder{<0.15,0.45,0.6>,<0.15,0.25,0.6>,r}
+cylinder{<0.15,0.45,0.6>,<0.15,0.45,0.4>,r}
+// cell 158
+sphere{<0.35,0.45,0.4>,r}
+sphere{<0.35,0.25,0.4>,r}
+cylinder{<0.35,0.25,0.4>,<0.35,0.45,0.4>,r}
+sphere{<0.15,0.45,0.4>,r}
+cylinder{<0.15,0.45,0.4>,<0.35,0.45,0.4>,r}
+sphere{<0.15,0.25,0.6>,r}
+sphere{<0.15,0.45,0.6>,r}
+cylinder{<0.15,0.45,0.6>,<0.15,0.45,0.4>,r}
+cylinder{<0.15,0.45,0.6>,<0.15,0.25,0.6>,r}
+sphere{<0.35,0.25,0.6>,r}
+cylinder{<0.35,0.25,0.6>,<0.15,0.25,0.6>,r}
+cylinder{<0.35,0.25,0.6>,<0.35,0.25,0.4>,r}
+sphere{<0.15,0.25,0.4>,r}
+cylinder{<0.15,0.25,0.4>,<0.15,0.25,0.6>,r}
+cylinder{<0.15,0.25,0.4>,<0.15,0.45,0.4>,r}
+cylinder{<0.15,0.25,0.4>,<0.35,0.25,0.4>,r}
+sphere{<0.35,0.45,0.6>,r}
+cylinder{<0.35,0.45,0.6>,<0.15,0.45,0.6>,r}
+cylinder{<0.35,0.45,0.6>,<0.35,0.25,0.6>,r}
+cylinder{<0.35,0.45,0.6>,<0.35,0.45,0.4>,r}
+// cell 159
+sphere{<0.35,0.45,0.6>,r}
+sphere{<0.55,0.25,0.4>,r}
+sphere{<0.536803,0.45,0.6>,r}
+cylinder{<0.536803,0.45,0.6>,<0.35,0.45,0.6>,r}
+sphere{<0.35,0.25,0.6>,r}
+cylinder{<0.35,0.25,0.6>,<0.35,0.45,0.6>,r}
+sphere{<0.55,0.45,0.579166>,r}
+cylinder{<0.55,0.45,0.579166>,<0.536803,0.45,0.6>,r}
+sphere{<0.55,0.25,0.6>,r}
+cylinder{<0.55,0.25,0.6>,<0.55,0.25,0.4>,r}
+cylinder{<0.55,0.25,0.6>,<0.35,0.25,0.6>,r}
+sphere{<0.35,0.25,0.4>,r}
+cylinder{<0.35,0.25,0.4>,<0.55,0.25,0.4>,r}
+cylinder{<0.35,0.25,0.4>,<0.35,0.25,0.6>,r}
+sphere{<0.55,0.433033,0.6>,r}
+cylinder{<0.55,0.433033,0.6>,<0.55,0.25,0.6>,r}
+cylinder{<0.55,0.433033,0.6>,<0.55,0.45,0.579166>,r}
+cylinder{<0.55,0.433033,0.6>,<0.536803,0.45,0.6>,r}
+sphere{<0.55,0.45,0.4>,r}
+cylinder{<0.55,0.45,0.4>,<0.55,0.45,0.579166>,r}
+cylinder{<0.55,0.45,0.4>,<0.55,0.25,0.4>,r}
+sphere{<0.35,0.45,0.4>,r}
+cylinder{<0.35,0.45,0.4>,<0.55,0.45,0.4>,r}
+cylinder{<0.35,0.45,0.4>,<0.35,0.25,0.4>,r}
+cylinder{<0.35,0.45,0.4>,<0.35,0.45,0.6>,r}
+// cell 160
+sphere{<0.620422,0.25,0.670422>,r}
+sphere{<0.55,0.25,0.6>,r}
+cylinder{<0.55,0.25,0.6>,<0.620422,0.25,0.670422>,r}
+sphere{<0.55,0.45,0.6>,r}
+cylinder{<0.55,0.45,0.6>,<0.55,0.25,0.6>,r}
+sphere{<0.55,0.45,0.4>,r}
+cylinder{<0.55,0.45,0.4>,<0.55,0.45,0.6>,r}
+sphere{<0.773989,0.25,0.4>,r}
+cylinder{<0.773989,0.25,0.4>,<0.620422,0.25,0.670422>,r}
+sphere{<0.55,0.25,0.4>,r}
+cylinder{<0.55,0.25,0.4>,<0.55,0.45,0.4>,r}
+cylinder{<0.55,0.25,0.4>,<0.773989,0.25,0.4>,r}
+cylinder{<0.55,0.25,0.4>,<0.55,0.25,0.6>,r}
+sphere{<0.551292,0.451292,0.601292>,r}
+cylinder{<0.551292,0.451292,0.601292>,<0.55,0.45,0.6>,r}
+cylinder{<0.551292,0.451292,0.601292>,<0.620422,0.25,0.670422>,r}
+sphere{<0.625593,0.525593,0.4>,r}
+cylinder{<0.625593,0.525593,0.4>,<0.551292,0.451292,0.601292>,r}
+cylinder{<0.625593,0.525593,0.4>,<0.773989,0.25,0.4>,r}
+cylinder{<0.625593,0.525593,0.4>,<0.55,0.45,0.4>,r}
+// cell 161
+sphere{<-0.25,0.65,0.4>,r}
+sphere{<-0.45,0.45,0.6>,r}
+sphere{<-0.25,0.45,0.4>,r}
+cylinder{<-0.25,0.45,0.4>,<-0.25,0.65,0.4>,r}
+sphere{<-0.45,0.45,0.4>,r}
+cylinder{<-0.45,0.45,0.4>,<-0.25,0.45,0.4>,r}
+cylinder{<-0.45,0.45,0.4>,<-0.45,0.45,0.6>,r}
+sphere{<-0.545057,0.545057,0.495057>,r}
+cylinder{<-0.545057,0.545057,0.495057>,<-0.45,0.45,0.4>,r}
+sphere{<-0.348979,0.548979,0.698979>,r}
+sphere{<-0.25,0.670626,0.6>,r}
+cylinder{<-0.25,0.670626,0.6>,<-0.348979,0.548979,0.698979>,r}
+sphere{<-0.25,0.737374,0.487374>,r}
+cylinder{<-0.25,0.737374,0.487374>,<-0.25,0.670626,0.6>,r}
+cylinder{<-0.25,0.737374,0.487374>,<-0.25,0.65,0.4>,r}
+sphere{<-0.491881,0.491881,0.641881>,r}
+cylinder{<-0.491881,0.491881,0.641881>,<-0.45,0.45,0.6>,r}
+cylinder{<-0.491881,0.491881,0.641881>,<-0.348979,0.548979,0.698979>,r}
+cylinder{<-0.491881,0.491881,0.641881>,<-0.545057,0.545057,0.495057>,r}
+sphere{<-0.455331,0.655331,0.405331>,r}
+cylinder{<-0.455331,0.655331,0.405331>,<-0.545057,0.545057,0.495057>,r}
+cylinder{<-0.455331,0.655331,0.405331>,<-0.25,0.737374,0.487374>,r}
+sphere{<-0.45,0.65,0.4>,r}
+cylinder{<-0.45,0.65,0.4>,<-0.455331,0.655331,0.405331>,r}
+cylinder{<-0.45,0.65,0.4>,<-0.25,0.65,0.4>,r}
+cylinder{<-0.45,0.65,0.4>,<-0.45,0.45,0.4>,r}
+sphere{<-0.25,0.45,0.6>,r}
+cylinder{<-0.25,0.45,0.6>,<-0.348979,0.548979,0.698979>,r}
+cylinder{<-0.25,0.45,0.6>,<-0.45,0.45,0.6>,r}
+cylinder{<-0.25,0.45,0.6>,<-0.25,0.45,0.4>,r}
+cylinder{<-0.25,0.45,0.6>,<-0.25,0.670626,0.6>,r}
+// cell 162
+sphere{<-0.25,0.657384,0.6>,r}
+sphere{<-0.05,0.45,0.4>,r}
+sphere{<-0.05,0.71193,0.6>,r}
+cylinder{<-0.05,0.71193,0.6>,<-0.25,0.657384,0.6>,r}
+sphere{<-0.05,0.65,0.4>,r}
+cylinder{<-0.05,0.65,0.4>,<-0.05,0.45,0.4>,r}
+sphere{<-0.25,0.45,0.6>,r}
+cylinder{<-0.25,0.45,0.6>,<-0.25,0.657384,0.6>,r}
+sphere{<-0.05,0.45,0.6>,r}
+cylinder{<-0.05,0.45,0.6>,<-0.05,0.71193,0.6>,r}
+cylinder{<-0.05,0.45,0.6>,<-0.25,0.45,0.6>,r}
+cylinder{<-0.05,0.45,0.6>,<-0.05,0.45,0.4>,r}
+sphere{<-0.25,0.723134,0.473134>,r}
+cylinder{<-0.25,0.723134,0.473134>,<-0.25,0.657384,0.6>,r}
+sphere{<-0.25,0.45,0.4>,r}
+cylinder{<-0.25,0.45,0.4>,<-0.05,0.45,0.4>,r}
+cylinder{<-0.25,0.45,0.4>,<-0.25,0.45,0.6>,r}
+sphere{<-0.25,0.65,0.4>,r}
+cylinder{<-0.25,0.65,0.4>,<-0.05,0.65,0.4>,r}
+cylinder{<-0.25,0.65,0.4>,<-0.25,0.45,0.4>,r}
+cylinder{<-0.25,0.65,0.4>,<-0.25,0.723134,0.473134>,r}
+sphere{<-0.05,0.75906,0.50906>,r}
+cylinder{<-0.05,0.75906,0.50906>,<-0.05,0.65,0.4>,r}
+cylinder{<-0.05,0.75906,0.50906>,<-0.25,0.723134,0.473134>,r}
+cylinder{<-0.05,0.75906,0.50906>,<-0.05,0.71193,0.6>,r}
+// cell 163
+sphere{<-0.05,0.45,0.4>,r}
+sphere{<0.15,0.45,0.4>,r}
+cylinder{<0.15,0.45,0.4>,<-0.05,0.45,0.4>,r}
+sphere{<0.15,0.742981,0.492981>,r}
+sphere{<0.15,0.65,0.4>,r}
+cylinder{<0.15,0.65,0.4>,<0.15,0.45,0.4>,r}
+cylinder{<0.15,0.65,0.4>,<0.15,0.742981,0.492981>,r}
+sphere{<-0.05,0.45,0.6>,r}
+cylinder{<-0.05,0.45,0.6>,<-0.05,0.45,0.4>,r}
+sphere{<0.15,0.68925,0.6>,r}
+cylinder{<0.15,0.68925,0.6>,<0.15,0.742981,0.492981>,r}
+sphere{<-0.05,0.707432,0.6>,r}
+cylinder{<-0.05,0.707432,0.6>,<0.15,0.68925,0.6>,r}
+cylinder{<-0.05,0.707432,0.6>,<-0.05,0.45,0.6>,r}
+sphere{<0.15,0.45,0.6>,r}
+cylinder{<0.15,0.45,0.6>,<0.15,0.68925,0.6>,r}
+cylinder{<0.15,0.45,0.6>,<-0.05,0.45,0.6>,r}
+cylinder{<0.15,0.45,0.6>,<0.15,0.45,0.4>,r}
+sphere{<-0.05,0.65,0.4>,r}
+cylinder{<-0.05,0.65,0.4>,<0.15,0.65,0.4>,r}
+cylinder{<-0.05,0.65,0.4>,<-0.05,0.45,0.4>,r}
+sphere{<-0.05,0.755085,0.505085>,r}
+cylinder{<-0.05,0.755085,0.505085>,<-0.05,0.707432,0.6>,r}
+cylinder{<-0.05,0.755085,0.505085>,<0.15,0.742981,0.492981>,r}
+cylinder{<-0.05,0.755085,0.505085>,<-0.05,0.65,0.4>,r}
+// cell 164
+sphere{<0.35,0.694975,0.444975>,r}
+sphere{<0.35,0.45,0.6>,r}
+sphere{<0.15,0.45,0.4>,r}
+sphere{<0.15,0.45,0.6>,r}
+cylinder{<0.15,0.45,0.6>,<0.15,0.45,0.4>,r}
+cylinder{<0.15,0.45,0.6>,<0.35,0.45,0.6>,r}
+sphere{<0.15,0.700739,0.6>,r}
+cylinder{<0.15,0.700739,0.6>,<0.15,0.45,0.6>,r}
+sphere{<0.35,0.45,0.4>,r}
+cylinder{<0.35,0.45,0.4>,<0.35,0.45,0.6>,r}
+cylinder{<0.35,0.45,0.4>,<0.15,0.45,0.4>,r}
+sphere{<0.35,0.65,0.4>,r}
+cylinder{<0.35,0.65,0.4>,<0.35,0.694975,0.444975>,r}
+cylinder{<0.35,0.65,0.4>,<0.35,0.45,0.4>,r}
+sphere{<0.35,0.60983,0.6>,r}
+cylinder{<0.35,0.60983,0.6>,<0.35,0.694975,0.444975>,r}
+cylinder{<0.35,0.60983,0.6>,<0.15,0.700739,0.6>,r}
+cylinder{<0.35,0.60983,0.6>,<0.35,0.45,0.6>,r}
+sphere{<0.15,0.65,0.4>,r}
+cylinder{<0.15,0.65,0.4>,<0.35,0.65,0.4>,r}
+cylinder{<0.15,0.65,0.4>,<0.15,0.45,0.4>,r}
+sphere{<0.15,0.753655,0.503655>,r}
+cylinder{<0.15,0.753655,0.503655>,<0.15,0.65,0.4>,r}
+cylinder{<0.15,0.753655,0.503655>,<0.15,0.700739,0.6>,r}
+cylinder{<0.15,0.753655,0.503655>,<0.35,0.694975,0.444975>,r}
+// cell 165
+sphere{<0.55,0.45,0.6>,r}
+sphere{<0.35,0.618079,0.6>,r}
+sphere{<0.418208,0.518208,0.668208>,r}
+cylinder{<0.418208,0.518208,0.668208>,<0.35,0.618079,0.6>,r}
+sphere{<0.35,0.45,0.4>,r}
+sphere{<0.623507,0.523507,0.4>,r}
+sphere{<0.55,0.45,0.4>,r}
+cylinder{<0.55,0.45,0.4>,<0.623507,0.523507,0.4>,r}
+cylinder{<0.55,0.45,0.4>,<0.55,0.45,0.6>,r}
+cylinder{<0.55,0.45,0.4>,<0.35,0.45,0.4>,r}
+sphere{<0.35,0.65,0.4>,r}
+cylinder{<0.35,0.65,0.4>,<0.35,0.45,0.4>,r}
+sphere{<0.551803,0.451803,0.601803>,r}
+cylinder{<0.551803,0.451803,0.601803>,<0.623507,0.523507,0.4>,r}
+cylinder{<0.551803,0.451803,0.601803>,<0.418208,0.518208,0.668208>,r}
+cylinder{<0.551803,0.451803,0.601803>,<0.55,0.45,0.6>,r}
+sphere{<0.35,0.45,0.6>,r}
+cylinder{<0.35,0.45,0.6>,<0.35,0.618079,0.6>,r}
+cylinder{<0.35,0.45,0.6>,<0.35,0.45,0.4>,r}
+cylinder{<0.35,0.45,0.6>,<0.55,0.45,0.6>,r}
+cylinder{<0.35,0.45,0.6>,<0.418208,0.518208,0.668208>,r}
+sphere{<0.35,0.709103,0.459103>,r}
+cylinder{<0.35,0.709103,0.459103>,<0.35,0.65,0.4>,r}
+cylinder{<0.35,0.709103,0.459103>,<0.35,0.618079,0.6>,r}
+sphere{<0.403507,0.703507,0.4>,r}
+cylinder{<0.403507,0.703507,0.4>,<0.35,0.709103,0.459103>,r}
+cylinder{<0.403507,0.703507,0.4>,<0.623507,0.523507,0.4>,r}
+cylinder{<0.403507,0.703507,0.4>,<0.35,0.65,0.4>,r}
+// cell 166
+sphere{<-0.433033,-0.55,0.6>,r}
+sphere{<-0.25,-0.35,0.6>,r}
+sphere{<-0.339446,-0.439446,0.889446>,r}
+sphere{<-0.25,-0.35,0.8>,r}
+cylinder{<-0.25,-0.35,0.8>,<-0.25,-0.35,0.6>,r}
+cylinder{<-0.25,-0.35,0.8>,<-0.339446,-0.439446,0.889446>,r}
+sphere{<-0.45,-0.35,0.6>,r}
+cylinder{<-0.45,-0.35,0.6>,<-0.25,-0.35,0.6>,r}
+sphere{<-0.25,-0.55,0.6>,r}
+cylinder{<-0.25,-0.55,0.6>,<-0.433033,-0.55,0.6>,r}
+cylinder{<-0.25,-0.55,0.6>,<-0.25,-0.35,0.6>,r}
+sphere{<-0.25,-0.637153,0.687153>,r}
+cylinder{<-0.25,-0.637153,0.687153>,<-0.25,-0.55,0.6>,r}
+cylinder{<-0.25,-0.637153,0.687153>,<-0.433033,-0.55,0.6>,r}
+sphere{<-0.474932,-0.374932,0.824932>,r}
+cylinder{<-0.474932,-0.374932,0.824932>,<-0.339446,-0.439446,0.889446>,r}
+sphere{<-0.527473,-0.427473,0.677473>,r}
+cylinder{<-0.527473,-0.427473,0.677473>,<-0.474932,-0.374932,0.824932>,r}
+cylinder{<-0.527473,-0.427473,0.677473>,<-0.45,-0.35,0.6>,r}
+sphere{<-0.45,-0.35,0.8>,r}
+cylinder{<-0.45,-0.35,0.8>,<-0.25,-0.35,0.8>,r}
+cylinder{<-0.45,-0.35,0.8>,<-0.45,-0.35,0.6>,r}
+cylinder{<-0.45,-0.35,0.8>,<-0.474932,-0.374932,0.824932>,r}
+sphere{<-0.45,-0.536803,0.6>,r}
+cylinder{<-0.45,-0.536803,0.6>,<-0.45,-0.35,0.6>,r}
+cylinder{<-0.45,-0.536803,0.6>,<-0.433033,-0.55,0.6>,r}
+cylinder{<-0.45,-0.536803,0.6>,<-0.527473,-0.427473,0.677473>,r}
+sphere{<-0.25,-0.565673,0.8>,r}
+cylinder{<-0.25,-0.565673,0.8>,<-0.339446,-0.439446,0.889446>,r}
+cylinder{<-0.25,-0.565673,0.8>,<-0.25,-0.637153,0.687153>,r}
+cylinder{<-0.25,-0.565673,0.8>,<-0.25,-0.35,0.8>,r}
+// cell 167
+sphere{<-0.05,-0.615789,0.8>,r}
+sphere{<-0.05,-0.35,0.6>,r}
+sphere{<-0.05,-0.55,0.6>,r}
+cylinder{<-0.05,-0.55,0.6>,<-0.05,-0.35,0.6>,r}
+sphere{<-0.25,-0.55,0.6>,r}
+cylinder{<-0.25,-0.55,0.6>,<-0.05,-0.55,0.6>,r}
+sphere{<-0.25,-0.35,0.6>,r}
+cylinder{<-0.25,-0.35,0.6>,<-0.05,-0.35,0.6>,r}
+cylinder{<-0.25,-0.35,0.6>,<-0.25,-0.55,0.6>,r}
+sphere{<-0.05,-0.35,0.8>,r}
+cylinder{<-0.05,-0.35,0.8>,<-0.05,-0.35,0.6>,r}
+cylinder{<-0.05,-0.35,0.8>,<-0.05,-0.615789,0.8>,r}
+sphere{<-0.05,-0.662111,0.712111>,r}
+cylinder{<-0.05,-0.662111,0.712111>,<-0.05,-0.55,0.6>,r}
+cylinder{<-0.05,-0.662111,0.712111>,<-0.05,-0.615789,0.8>,r}
+sphere{<-0.25,-0.618453,0.668453>,r}
+cylinder{<-0.25,-0.618453,0.668453>,<-0.25,-0.55,0.6>,r}
+cylinder{<-0.25,-0.618453,0.668453>,<-0.05,-0.662111,0.712111>,r}
+sphere{<-0.25,-0.549122,0.8>,r}
+cylinder{<-0.25,-0.549122,0.8>,<-0.25,-0.618453,0.668453>,r}
+cylinder{<-0.25,-0.549122,0.8>,<-0.05,-0.615789,0.8>,r}
+sphere{<-0.25,-0.35,0.8>,r}
+cylinder{<-0.25,-0.35,0.8>,<-0.25,-0.35,0.6>,r}
+cylinder{<-0.25,-0.35,0.8>,<-0.25,-0.549122,0.8>,r}
+cylinder{<-0.25,-0.35,0.8>,<-0.05,-0.35,0.8>,r}
+// cell 168
+sphere{<0.15,-0.641573,0.691573>,r}
+sphere{<-0.05,-0.656357,0.706357>,r}
+cylinder{<-0.05,-0.656357,0.706357>,<0.15,-0.641573,0.691573>,r}
+sphere{<-0.05,-0.35,0.6>,r}
+sphere{<0.15,-0.35,0.6>,r}
+cylinder{<0.15,-0.35,0.6>,<-0.05,-0.35,0.6>,r}
+sphere{<-0.05,-0.609248,0.8>,r}
+cylinder{<-0.05,-0.609248,0.8>,<-0.05,-0.656357,0.706357>,r}
+sphere{<0.15,-0.587026,0.8>,r}
+cylinder{<0.15,-0.587026,0.8>,<-0.05,-0.609248,0.8>,r}
+cylinder{<0.15,-0.587026,0.8>,<0.15,-0.641573,0.691573>,r}
+sphere{<-0.05,-0.35,0.8>,r}
+cylinder{<-0.05,-0.35,0.8>,<-0.05,-0.35,0.6>,r}
+cylinder{<-0.05,-0.35,0.8>,<-0.05,-0.609248,0.8>,r}
+sphere{<0.15,-0.35,0.8>,r}
+cylinder{<0.15,-0.35,0.8>,<-0.05,-0.35,0.8>,r}
+cylinder{<0.15,-0.35,0.8>,<0.15,-0.587026,0.8>,r}
+cylinder{<0.15,-0.35,0.8>,<0.15,-0.35,0.6>,r}
+sphere{<-0.05,-0.55,0.6>,r}
+cylinder{<-0.05,-0.55,0.6>,<-0.05,-0.656357,0.706357>,r}
+cylinder{<-0.05,-0.55,0.6>,<-0.05,-0.35,0.6>,r}
+sphere{<0.15,-0.55,0.6>,r}
+cylinder{<0.15,-0.55,0.6>,<-0.05,-0.55,0.6>,r}
+cylinder{<0.15,-0.55,0.6>,<0.15,-0.35,0.6>,r}
+cylinder{<0.15,-0.55,0.6>,<0.15,-0.641573,0.691573>,r}
+// cell 169
+sphere{<0.15,-0.35,0.6>,r}
+sphere{<0.35,-0.491931,0.8>,r}
+sphere{<0.15,-0.35,0.8>,r}
+cylinder{<0.15,-0.35,0.8>,<0.15,-0.35,0.6>,r}
+sphere{<0.35,-0.35,0.6>,r}
+cylinder{<0.35,-0.35,0.6>,<0.15,-0.35,0.6>,r}
+sphere{<0.35,-0.585832,0.635832>,r}
+cylinder{<0.35,-0.585832,0.635832>,<0.35,-0.491931,0.8>,r}
+sphere{<0.15,-0.656514,0.706514>,r}
+cylinder{<0.15,-0.656514,0.706514>,<0.35,-0.585832,0.635832>,r}
+sphere{<0.15,-0.603042,0.8>,r}
+cylinder{<0.15,-0.603042,0.8>,<0.15,-0.656514,0.706514>,r}
+cylinder{<0.15,-0.603042,0.8>,<0.35,-0.491931,0.8>,r}
+cylinder{<0.15,-0.603042,0.8>,<0.15,-0.35,0.8>,r}
+sphere{<0.35,-0.35,0.8>,r}
+cylinder{<0.35,-0.35,0.8>,<0.35,-0.491931,0.8>,r}
+cylinder{<0.35,-0.35,0.8>,<0.35,-0.35,0.6>,r}
+cylinder{<0.35,-0.35,0.8>,<0.15,-0.35,0.8>,r}
+sphere{<0.15,-0.55,0.6>,r}
+cylinder{<0.15,-0.55,0.6>,<0.15,-0.656514,0.706514>,r}
+cylinder{<0.15,-0.55,0.6>,<0.15,-0.35,0.6>,r}
+sphere{<0.35,-0.55,0.6>,r}
+cylinder{<0.35,-0.55,0.6>,<0.35,-0.35,0.6>,r}
+cylinder{<0.35,-0.55,0.6>,<0.35,-0.585832,0.635832>,r}
+cylinder{<0.35,-0.55,0.6>,<0.15,-0.55,0.6>,r}
+// cell 170
+sphere{<0.35,-0.498528,0.8>,r}
+sphere{<0.498528,-0.35,0.8>,r}
+sphere{<0.35,-0.35,0.6>,r}
+sphere{<0.55,-0.35,0.6>,r}
+cylinder{<0.55,-0.35,0.6>,<0.35,-0.35,0.6>,r}
+sphere{<0.394975,-0.594975,0.6>,r}
+sphere{<0.404866,-0.404866,0.854866>,r}
+cylinder{<0.404866,-0.404866,0.854866>,<0.35,-0.498528,0.8>,r}
+cylinder{<0.404866,-0.404866,0.854866>,<0.498528,-0.35,0.8>,r}
+sphere{<0.35,-0.602691,0.652691>,r}
+cylinder{<0.35,-0.602691,0.652691>,<0.394975,-0.594975,0.6>,r}
+cylinder{<0.35,-0.602691,0.652691>,<0.35,-0.498528,0.8>,r}
+sphere{<0.35,-0.55,0.6>,r}
+cylinder{<0.35,-0.55,0.6>,<0.35,-0.602691,0.652691>,r}
+cylinder{<0.35,-0.55,0.6>,<0.35,-0.35,0.6>,r}
+cylinder{<0.35,-0.55,0.6>,<0.394975,-0.594975,0.6>,r}
+sphere{<0.35,-0.35,0.8>,r}
+cylinder{<0.35,-0.35,0.8>,<0.498528,-0.35,0.8>,r}
+cylinder{<0.35,-0.35,0.8>,<0.35,-0.35,0.6>,r}
+cylinder{<0.35,-0.35,0.8>,<0.35,-0.498528,0.8>,r}
+cylinder{<0.35,-0.35,0.8>,<0.404866,-0.404866,0.854866>,r}
+sphere{<0.602691,-0.35,0.652691>,r}
+cylinder{<0.602691,-0.35,0.652691>,<0.55,-0.35,0.6>,r}
+cylinder{<0.602691,-0.35,0.652691>,<0.498528,-0.35,0.8>,r}
+sphere{<0.594975,-0.394975,0.6>,r}
+cylinder{<0.594975,-0.394975,0.6>,<0.602691,-0.35,0.652691>,r}
+cylinder{<0.594975,-0.394975,0.6>,<0.394975,-0.594975,0.6>,r}
+cylinder{<0.594975,-0.394975,0.6>,<0.55,-0.35,0.6>,r}
+// cell 171
+sphere{<-0.529765,-0.429765,0.679765>,r}
+sphere{<-0.60983,-0.35,0.6>,r}
+cylinder{<-0.60983,-0.35,0.6>,<-0.529765,-0.429765,0.679765>,r}
+sphere{<-0.45,-0.15,0.8>,r}
+sphere{<-0.540944,-0.15,0.890944>,r}
+cylinder{<-0.540944,-0.15,0.890944>,<-0.45,-0.15,0.8>,r}
+sphere{<-0.700739,-0.15,0.6>,r}
+cylinder{<-0.700739,-0.15,0.6>,<-0.60983,-0.35,0.6>,r}
+cylinder{<-0.700739,-0.15,0.6>,<-0.540944,-0.15,0.890944>,r}
+sphere{<-0.45,-0.35,0.8>,r}
+cylinder{<-0.45,-0.35,0.8>,<-0.45,-0.15,0.8>,r}
+sphere{<-0.45,-0.15,0.6>,r}
+cylinder{<-0.45,-0.15,0.6>,<-0.700739,-0.15,0.6>,r}
+cylinder{<-0.45,-0.15,0.6>,<-0.45,-0.15,0.8>,r}
+sphere{<-0.474945,-0.374945,0.824945>,r}
+cylinder{<-0.474945,-0.374945,0.824945>,<-0.540944,-0.15,0.890944>,r}
+cylinder{<-0.474945,-0.374945,0.824945>,<-0.529765,-0.429765,0.679765>,r}
+cylinder{<-0.474945,-0.374945,0.824945>,<-0.45,-0.35,0.8>,r}
+sphere{<-0.45,-0.35,0.6>,r}
+cylinder{<-0.45,-0.35,0.6>,<-0.60983,-0.35,0.6>,r}
+cylinder{<-0.45,-0.35,0.6>,<-0.45,-0.15,0.6>,r}
+cylinder{<-0.45,-0.35,0.6>,<-0.45,-0.35,0.8>,r}
+cylinder{<-0.45,-0.35,0.6>,<-0.529765,-0.429765,0.679765>,r}
+// cell 172
+sphere{<-0.45,-0.15,0.8>,r}
+sphere{<-0.25,-0.35,0.6>,r}
+sphere{<-0.25,-0.15,0.6>,r}
+cylinder{<-0.25,-0.15,0.6>,<-0.25,-0.35,0.6>,r}
+sphere{<-0.25,-0.35,0.8>,r}
+cylinder{<-0.25,-0.35,0.8>,<-0.25,-0.35,0.6>,r}
+sphere{<-0.25,-0.15,0.8>,r}
+cylinder{<-0.25,-0.15,0.8>,<-0.25,-0.35,0.8>,r}
+cylinder{<-0.25,-0.15,0.8>,<-0.25,-0.15,0.6>,r}
+cylinder{<-0.25,-0.15,0.8>,<-0.45,-0.15,0.8>,r}
+sphere{<-0.45,-0.35,0.8>,r}
+cylinder{<-0.45,-0.35,0.8>,<-0.45,-0.15,0.8>,r}
+cylinder{<-0.45,-0.35,0.8>,<-0.25,-0.35,0.8>,r}
+sphere{<-0.45,-0.35,0.6>,r}
+cylinder{<-0.45,-0.35,0.6>,<-0.25,-0.35,0.6>,r}
+cylinder{<-0.45,-0.35,0.6>,<-0.45,-0.35,0.8>,r}
+sphere{<-0.45,-0.15,0.6>,r}
+cylinder{<-0.45,-0.15,0.6>,<-0.45,-0.35,0.6>,r}
+cylinder{<-0.45,-0.15,0.6>,<-0.45,-0.15,0.8>,r}
+cylinder{<-0.45,-0.15,0.6>,<-0.25,-0.15,0.6>,r}
+// cell 173
+sphere{<-0.25,-0.15,0.8>,r}
+sphere{<-0.05,-0.15,0.6>,r}
+sphere{<-0.05,-0.35,0.6>,r}
+cylinder{<-0.05,-0.35,0.6>,<-0.05,-0.15,0.6>,r}
+sphere{<-0.25,-0.35,0.8>,r}
+cylinder{<-0.25,-0.35,0.8>,<-0.25,-0.15,0.8>,r}
+sphere{<-0.25,-0.35,0.6>,r}
+cylinder{<-0.25,-0.35,0.6>,<-0.05,-0.35,0.6>,r}
+cylinder{<-0.25,-0.35,0.6>,<-0.25,-0.35,0.8>,r}
+sphere{<-0.05,-0.35,0.8>,r}
+cylinder{<-0.05,-0.35,0.8>,<-0.25,-0.35,0.8>,r}
+cylinder{<-0.05,-0.35,0.8>,<-0.05,-0.35,0.6>,r}
+sphere{<-0.05,-0.15,0.8>,r}
+cylinder{<-0.05,-0.15,0.8>,<-0.05,-0.35,0.8>,r}
+cylinder{<-0.05,-0.15,0.8>,<-0.05,-0.15,0.6>,r}
+cylinder{<-0.05,-0.15,0.8>,<-0.25,-0.15,0.8>,r}
+sphere{<-0.25,-0.15,0.6>,r}
+cylinder{<-0.25,-0.15,0.6>,<-0.25,-0.35,0.6>,r}
+cylinder{<-0.25,-0.15,0.6>,<-0.25,-0.15,0.8>,r}
+cylinder{<-0.25,-0.15,0.6>,<-0.05,-0.15,0.6>,r}
+// cell 174
+sphere{<-0.05,-0.15,0.6>,r}
+sphere{<0.15,-0.15,0.6>,r}
+cylinder{<0.15,-0.15,0.6>,<-0.05,-0.15,0.6>,r}
+sphere{<-0.05,-0.15,0.8>,r}
+cylinder{<-0.05,-0.15,0.8>,<-0.05,-0.15,0.6>,r}
+sphere{<-0.05,-0.35,0.6>,r}
+cylinder{<-0.05,-0.35,0.6>,<-0.05,-0.15,0.6>,r}
+sphere{<0.15,-0.15,0.8>,r}
+cylinder{<0.15,-0.15,0.8>,<0.15,-0.15,0.6>,r}
+cylinder{<0.15,-0.15,0.8>,<-0.05,-0.15,0.8>,r}
+sphere{<0.15,-0.35,0.8>,r}
+cylinder{<0.15,-0.35,0.8>,<0.15,-0.15,0.8>,r}
+sphere{<-0.05,-0.35,0.8>,r}
+cylinder{<-0.05,-0.35,0.8>,<0.15,-0.35,0.8>,r}
+cylinder{<-0.05,-0.35,0.8>,<-0.05,-0.15,0.8>,r}
+cylinder{<-0.05,-0.35,0.8>,<-0.05,-0.35,0.6>,r}
+sphere{<0.15,-0.35,0.6>,r}
+cylinder{<0.15,-0.35,0.6>,<0.15,-0.35,0.8>,r}
+cylinder{<0.15,-0.35,0.6>,<-0.05,-0.35,0.6>,r}
+cylinder{<0.15,-0.35,0.6>,<0.15,-0.15,0.6>,r}
+// cell 175
+sphere{<0.15,-0.35,0.6>,r}
+sphere{<0.35,-0.15,0.8>,r}
+sphere{<0.15,-0.15,0.8>,r}
+cylinder{<0.15,-0.15,0.8>,<0.35,-0.15,0.8>,r}
+sphere{<0.35,-0.15,0.6>,r}
+cylinder{<0.35,-0.15,0.6>,<0.35,-0.15,0.8>,r}
+sphere{<0.15,-0.35,0.8>,r}
+cylinder{<0.15,-0.35,0.8>,<0.15,-0.15,0.8>,r}
+cylinder{<0.15,-0.35,0.8>,<0.15,-0.35,0.6>,r}
+sphere{<0.35,-0.35,0.8>,r}
+cylinder{<0.35,-0.35,0.8>,<0.35,-0.15,0.8>,r}
+cylinder{<0.35,-0.35,0.8>,<0.15,-0.35,0.8>,r}
+sphere{<0.15,-0.15,0.6>,r}
+cylinder{<0.15,-0.15,0.6>,<0.35,-0.15,0.6>,r}
+cylinder{<0.15,-0.15,0.6>,<0.15,-0.35,0.6>,r}
+cylinder{<0.15,-0.15,0.6>,<0.15,-0.15,0.8>,r}
+sphere{<0.35,-0.35,0.6>,r}
+cylinder{<0.35,-0.35,0.6>,<0.35,-0.15,0.6>,r}
+cylinder{<0.35,-0.35,0.6>,<0.35,-0.35,0.8>,r}
+cylinder{<0.35,-0.35,0.6>,<0.15,-0.35,0.6>,r}
+// cell 176
+sphere{<0.35,-0.35,0.6>,r}
+sphere{<0.35,-0.15,0.6>,r}
+cylinder{<0.35,-0.15,0.6>,<0.35,-0.35,0.6>,r}
+sphere{<0.656514,-0.15,0.706514>,r}
+sphere{<0.585832,-0.35,0.635832>,r}
+cylinder{<0.585832,-0.35,0.635832>,<0.656514,-0.15,0.706514>,r}
+sphere{<0.491931,-0.35,0.8>,r}
+cylinder{<0.491931,-0.35,0.8>,<0.585832,-0.35,0.635832>,r}
+sphere{<0.35,-0.35,0.8>,r}
+cylinder{<0.35,-0.35,0.8>,<0.35,-0.35,0.6>,r}
+cylinder{<0.35,-0.35,0.8>,<0.491931,-0.35,0.8>,r}
+sphere{<0.603042,-0.15,0.8>,r}
+cylinder{<0.603042,-0.15,0.8>,<0.491931,-0.35,0.8>,r}
+cylinder{<0.603042,-0.15,0.8>,<0.656514,-0.15,0.706514>,r}
+sphere{<0.35,-0.15,0.8>,r}
+cylinder{<0.35,-0.15,0.8>,<0.603042,-0.15,0.8>,r}
+cylinder{<0.35,-0.15,0.8>,<0.35,-0.15,0.6>,r}
+cylinder{<0.35,-0.15,0.8>,<0.35,-0.35,0.8>,r}
+sphere{<0.55,-0.35,0.6>,r}
+cylinder{<0.55,-0.35,0.6>,<0.585832,-0.35,0.635832>,r}
+cylinder{<0.55,-0.35,0.6>,<0.35,-0.35,0.6>,r}
+sphere{<0.55,-0.15,0.6>,r}
+cylinder{<0.55,-0.15,0.6>,<0.656514,-0.15,0.706514>,r}
+cylinder{<0.55,-0.15,0.6>,<0.55,-0.35,0.6>,r}
+cylinder{<0.55,-0.15,0.6>,<0.35,-0.15,0.6>,r}
+// cell 177
+sphere{<-0.68925,-0.15,0.6>,r}
+sphere{<-0.45,-0.15,0.6>,r}
+cylinder{<-0.45,-0.15,0.6>,<-0.68925,-0.15,0.6>,r}
+sphere{<-0.707432,0.05,0.6>,r}
+cylinder{<-0.707432,0.05,0.6>,<-0.68925,-0.15,0.6>,r}
+sphere{<-0.45,0.05,0.6>,r}
+cylinder{<-0.45,0.05,0.6>,<-0.45,-0.15,0.6>,r}
+cylinder{<-0.45,0.05,0.6>,<-0.707432,0.05,0.6>,r}
+sphere{<-0.45,-0.15,0.8>,r}
+cylinder{<-0.45,-0.15,0.8>,<-0.45,-0.15,0.6>,r}
+sphere{<-0.542432,-0.15,0.892432>,r}
+cylinder{<-0.542432,-0.15,0.892432>,<-0.68925,-0.15,0.6>,r}
+cylinder{<-0.542432,-0.15,0.892432>,<-0.45,-0.15,0.8>,r}
+sphere{<-0.554536,0.05,0.904536>,r}
+cylinder{<-0.554536,0.05,0.904536>,<-0.707432,0.05,0.6>,r}
+cylinder{<-0.554536,0.05,0.904536>,<-0.542432,-0.15,0.892432>,r}
+sphere{<-0.45,0.05,0.8>,r}
+cylinder{<-0.45,0.05,0.8>,<-0.554536,0.05,0.904536>,r}
+cylinder{<-0.45,0.05,0.8>,<-0.45,-0.15,0.8>,r}
+cylinder{<-0.45,0.05,0.8>,<-0.45,0.05,0.6>,r}
+// cell 178
+sphere{<-0.45,-0.15,0.6>,r}
+sphere{<-0.25,-0.15,0.6>,r}
+cylinder{<-0.25,-0.15,0.6>,<-0.45,-0.15,0.6>,r}
+sphere{<-0.45,0.05,0.6>,r}
+cylinder{<-0.45,0.05,0.6>,<-0.45,-0.15,0.6>,r}
+sphere{<-0.25,0.05,0.6>,r}
+cylinder{<-0.25,0.05,0.6>,<-0.25,-0.15,0.6>,r}
+cylinder{<-0.25,0.05,0.6>,<-0.45,0.05,0.6>,r}
+sphere{<-0.45,-0.15,0.8>,r}
+cylinder{<-0.45,-0.15,0.8>,<-0.45,-0.15,0.6>,r}
+sphere{<-0.25,-0.15,0.8>,r}
+cylinder{<-0.25,-0.15,0.8>,<-0.45,-0.15,0.8>,r}
+cylinder{<-0.25,-0.15,0.8>,<-0.25,-0.15,0.6>,r}
+sphere{<-0.45,0.05,0.8>,r}
+cylinder{<-0.45,0.05,0.8>,<-0.45,0.05,0.6>,r}
+cylinder{<-0.45,0.05,0.8>,<-0.45,-0.15,0.8>,r}
+sphere{<-0.25,0.05,0.8>,r}
+cylinder{<-0.25,0.05,0.8>,<-0.25,-0.15,0.8>,r}
+cylinder{<-0.25,0.05,0.8>,<-0.25,0.05,0.6>,r}
+cylinder{<-0.25,0.05,0.8>,<-0.45,0.05,0.8>,r}
+// cell 179
+sphere{<-0.25,-0.15,0.6>,r}
+sphere{<-0.05,-0.15,0.6>,r}
+cylinder{<-0.05,-0.15,0.6>,<-0.25,-0.15,0.6>,r}
+sphere{<-0.05,0.05,0.8>,r}
+sphere{<-0.25,0.05,0.8>,r}
+cylinder{<-0.25,0.05,0.8>,<-0.05,0.05,0.8>,r}
+sphere{<-0.25,0.05,0.6>,r}
+cylinder{<-0.25,0.05,0.6>,<-0.25,0.05,0.8>,r}
+cylinder{<-0.25,0.05,0.6>,<-0.25,-0.15,0.6>,r}
+sphere{<-0.05,-0.15,0.8>,r}
+cylinder{<-0.05,-0.15,0.8>,<-0.05,-0.15,0.6>,r}
+cylinder{<-0.05,-0.15,0.8>,<-0.05,0.05,0.8>,r}
+sphere{<-0.05,0.05,0.6>,r}
+cylinder{<-0.05,0.05,0.6>,<-0.05,-0.15,0.6>,r}
+cylinder{<-0.05,0.05,0.6>,<-0.25,0.05,0.6>,r}
+cylinder{<-0.05,0.05,0.6>,<-0.05,0.05,0.8>,r}
+sphere{<-0.25,-0.15,0.8>,r}
+cylinder{<-0.25,-0.15,0.8>,<-0.25,0.05,0.8>,r}
+cylinder{<-0.25,-0.15,0.8>,<-0.25,-0.15,0.6>,r}
+cylinder{<-0.25,-0.15,0.8>,<-0.05,-0.15,0.8>,r}
+// cell 180
+sphere{<0.15,0.05,0.6>,r}
+sphere{<0.15,-0.15,0.6>,r}
+cylinder{<0.15,-0.15,0.6>,<0.15,0.05,0.6>,r}
+sphere{<-0.05,0.05,0.8>,r}
+sphere{<0.15,0.05,0.8>,r}
+cylinder{<0.15,0.05,0.8>,<0.15,0.05,0.6>,r}
+cylinder{<0.15,0.05,0.8>,<-0.05,0.05,0.8>,r}
+sphere{<-0.05,-0.15,0.8>,r}
+cylinder{<-0.05,-0.15,0.8>,<-0.05,0.05,0.8>,r}
+sphere{<0.15,-0.15,0.8>,r}
+cylinder{<0.15,-0.15,0.8>,<0.15,-0.15,0.6>,r}
+cylinder{<0.15,-0.15,0.8>,<0.15,0.05,0.8>,r}
+cylinder{<0.15,-0.15,0.8>,<-0.05,-0.15,0.8>,r}
+sphere{<-0.05,0.05,0.6>,r}
+cylinder{<-0.05,0.05,0.6>,<-0.05,0.05,0.8>,r}
+cylinder{<-0.05,0.05,0.6>,<0.15,0.05,0.6>,r}
+sphere{<-0.05,-0.15,0.6>,r}
+cylinder{<-0.05,-0.15,0.6>,<-0.05,-0.15,0.8>,r}
+cylinder{<-0.05,-0.15,0.6>,<-0.05,0.05,0.6>,r}
+cylinder{<-0.05,-0.15,0.6>,<0.15,-0.15,0.6>,r}
+// cell 181
+sphere{<0.35,0.05,0.6>,r}
+sphere{<0.15,0.05,0.8>,r}
+sphere{<0.35,0.05,0.8>,r}
+cylinder{<0.35,0.05,0.8>,<0.35,0.05,0.6>,r}
+cylinder{<0.35,0.05,0.8>,<0.15,0.05,0.8>,r}
+sphere{<0.35,-0.15,0.6>,r}
+cylinder{<0.35,-0.15,0.6>,<0.35,0.05,0.6>,r}
+sphere{<0.15,-0.15,0.8>,r}
+cylinder{<0.15,-0.15,0.8>,<0.15,0.05,0.8>,r}
+sphere{<0.15,0.05,0.6>,r}
+cylinder{<0.15,0.05,0.6>,<0.15,0.05,0.8>,r}
+cylinder{<0.15,0.05,0.6>,<0.35,0.05,0.6>,r}
+sphere{<0.15,-0.15,0.6>,r}
+cylinder{<0.15,-0.15,0.6>,<0.15,-0.15,0.8>,r}
+cylinder{<0.15,-0.15,0.6>,<0.15,0.05,0.6>,r}
+cylinder{<0.15,-0.15,0.6>,<0.35,-0.15,0.6>,r}
+sphere{<0.35,-0.15,0.8>,r}
+cylinder{<0.35,-0.15,0.8>,<0.35,-0.15,0.6>,r}
+cylinder{<0.35,-0.15,0.8>,<0.35,0.05,0.8>,r}
+cylinder{<0.35,-0.15,0.8>,<0.15,-0.15,0.8>,r}
+// cell 182
+sphere{<0.35,-0.15,0.6>,r}
+sphere{<0.656357,0.05,0.706357>,r}
+sphere{<0.35,0.05,0.6>,r}
+cylinder{<0.35,0.05,0.6>,<0.35,-0.15,0.6>,r}
+sphere{<0.641573,-0.15,0.691573>,r}
+cylinder{<0.641573,-0.15,0.691573>,<0.656357,0.05,0.706357>,r}
+sphere{<0.35,-0.15,0.8>,r}
+cylinder{<0.35,-0.15,0.8>,<0.35,-0.15,0.6>,r}
+sphere{<0.587026,-0.15,0.8>,r}
+cylinder{<0.587026,-0.15,0.8>,<0.641573,-0.15,0.691573>,r}
+cylinder{<0.587026,-0.15,0.8>,<0.35,-0.15,0.8>,r}
+sphere{<0.35,0.05,0.8>,r}
+cylinder{<0.35,0.05,0.8>,<0.35,0.05,0.6>,r}
+cylinder{<0.35,0.05,0.8>,<0.35,-0.15,0.8>,r}
+sphere{<0.609248,0.05,0.8>,r}
+cylinder{<0.609248,0.05,0.8>,<0.587026,-0.15,0.8>,r}
+cylinder{<0.609248,0.05,0.8>,<0.656357,0.05,0.706357>,r}
+cylinder{<0.609248,0.05,0.8>,<0.35,0.05,0.8>,r}
+sphere{<0.55,-0.15,0.6>,r}
+cylinder{<0.55,-0.15,0.6>,<0.641573,-0.15,0.691573>,r}
+cylinder{<0.55,-0.15,0.6>,<0.35,-0.15,0.6>,r}
+sphere{<0.55,0.05,0.6>,r}
+cylinder{<0.55,0.05,0.6>,<0.656357,0.05,0.706357>,r}
+cylinder{<0.55,0.05,0.6>,<0.55,-0.15,0.6>,r}
+cylinder{<0.55,0.05,0.6>,<0.35,0.05,0.6>,r}
+// cell 183
+sphere{<-0.45,0.05,0.8>,r}
+sphere{<-0.71193,0.05,0.6>,r}
+sphere{<-0.554249,0.05,0.904249>,r}
+cylinder{<-0.554249,0.05,0.904249>,<-0.71193,0.05,0.6>,r}
+cylinder{<-0.554249,0.05,0.904249>,<-0.45,0.05,0.8>,r}
+sphere{<-0.531504,0.331504,0.8>,r}
+sphere{<-0.518323,0.25,0.868323>,r}
+cylinder{<-0.518323,0.25,0.868323>,<-0.531504,0.331504,0.8>,r}
+cylinder{<-0.518323,0.25,0.868323>,<-0.554249,0.05,0.904249>,r}
+sphere{<-0.45,0.05,0.6>,r}
+cylinder{<-0.45,0.05,0.6>,<-0.71193,0.05,0.6>,r}
+cylinder{<-0.45,0.05,0.6>,<-0.45,0.05,0.8>,r}
+sphere{<-0.565793,0.365793,0.715793>,r}
+cylinder{<-0.565793,0.365793,0.715793>,<-0.531504,0.331504,0.8>,r}
+sphere{<-0.657384,0.25,0.6>,r}
+cylinder{<-0.657384,0.25,0.6>,<-0.71193,0.05,0.6>,r}
+cylinder{<-0.657384,0.25,0.6>,<-0.565793,0.365793,0.715793>,r}
+sphere{<-0.45,0.25,0.6>,r}
+cylinder{<-0.45,0.25,0.6>,<-0.565793,0.365793,0.715793>,r}
+cylinder{<-0.45,0.25,0.6>,<-0.45,0.05,0.6>,r}
+cylinder{<-0.45,0.25,0.6>,<-0.657384,0.25,0.6>,r}
+sphere{<-0.45,0.25,0.8>,r}
+cylinder{<-0.45,0.25,0.8>,<-0.518323,0.25,0.868323>,r}
+cylinder{<-0.45,0.25,0.8>,<-0.45,0.05,0.8>,r}
+cylinder{<-0.45,0.25,0.8>,<-0.45,0.25,0.6>,r}
+cylinder{<-0.45,0.25,0.8>,<-0.531504,0.331504,0.8>,r}
+// cell 184
+sphere{<-0.25,0.05,0.8>,r}
+sphere{<-0.25,0.25,0.8>,r}
+cylinder{<-0.25,0.25,0.8>,<-0.25,0.05,0.8>,r}
+sphere{<-0.25,0.05,0.6>,r}
+cylinder{<-0.25,0.05,0.6>,<-0.25,0.05,0.8>,r}
+sphere{<-0.45,0.05,0.8>,r}
+cylinder{<-0.45,0.05,0.8>,<-0.25,0.05,0.8>,r}
+sphere{<-0.45,0.25,0.6>,r}
+sphere{<-0.45,0.25,0.8>,r}
+cylinder{<-0.45,0.25,0.8>,<-0.45,0.25,0.6>,r}
+cylinder{<-0.45,0.25,0.8>,<-0.45,0.05,0.8>,r}
+cylinder{<-0.45,0.25,0.8>,<-0.25,0.25,0.8>,r}
+sphere{<-0.45,0.05,0.6>,r}
+cylinder{<-0.45,0.05,0.6>,<-0.45,0.25,0.6>,r}
+cylinder{<-0.45,0.05,0.6>,<-0.25,0.05,0.6>,r}
+cylinder{<-0.45,0.05,0.6>,<-0.45,0.05,0.8>,r}
+sphere{<-0.25,0.25,0.6>,r}
+cylinder{<-0.25,0.25,0.6>,<-0.25,0.05,0.6>,r}
+cylinder{<-0.25,0.25,0.6>,<-0.45,0.25,0.6>,r}
+cylinder{<-0.25,0.25,0.6>,<-0.25,0.25,0.8>,r}
+// cell 185
+sphere{<-0.05,0.05,0.6>,r}
+sphere{<-0.05,0.25,0.6>,r}
+cylinder{<-0.05,0.25,0.6>,<-0.05,0.05,0.6>,r}
+sphere{<-0.05,0.25,0.8>,r}
+cylinder{<-0.05,0.25,0.8>,<-0.05,0.25,0.6>,r}
+sphere{<-0.25,0.25,0.8>,r}
+cylinder{<-0.25,0.25,0.8>,<-0.05,0.25,0.8>,r}
+sphere{<-0.25,0.25,0.6>,r}
+cylinder{<-0.25,0.25,0.6>,<-0.25,0.25,0.8>,r}
+cylinder{<-0.25,0.25,0.6>,<-0.05,0.25,0.6>,r}
+sphere{<-0.05,0.05,0.8>,r}
+cylinder{<-0.05,0.05,0.8>,<-0.05,0.05,0.6>,r}
+cylinder{<-0.05,0.05,0.8>,<-0.05,0.25,0.8>,r}
+sphere{<-0.25,0.05,0.6>,r}
+cylinder{<-0.25,0.05,0.6>,<-0.25,0.25,0.6>,r}
+cylinder{<-0.25,0.05,0.6>,<-0.05,0.05,0.6>,r}
+sphere{<-0.25,0.05,0.8>,r}
+cylinder{<-0.25,0.05,0.8>,<-0.25,0.25,0.8>,r}
+cylinder{<-0.25,0.05,0.8>,<-0.25,0.05,0.6>,r}
+cylinder{<-0.25,0.05,0.8>,<-0.05,0.05,0.8>,r}
+// cell 186
+sphere{<0.15,0.25,0.6>,r}
+sphere{<0.15,0.05,0.6>,r}
+cylinder{<0.15,0.05,0.6>,<0.15,0.25,0.6>,r}
+sphere{<-0.05,0.25,0.6>,r}
+cylinder{<-0.05,0.25,0.6>,<0.15,0.25,0.6>,r}
+sphere{<-0.05,0.05,0.8>,r}
+sphere{<-0.05,0.25,0.8>,r}
+cylinder{<-0.05,0.25,0.8>,<-0.05,0.25,0.6>,r}
+cylinder{<-0.05,0.25,0.8>,<-0.05,0.05,0.8>,r}
+sphere{<0.15,0.05,0.8>,r}
+cylinder{<0.15,0.05,0.8>,<-0.05,0.05,0.8>,r}
+cylinder{<0.15,0.05,0.8>,<0.15,0.05,0.6>,r}
+sphere{<0.15,0.25,0.8>,r}
+cylinder{<0.15,0.25,0.8>,<0.15,0.05,0.8>,r}
+cylinder{<0.15,0.25,0.8>,<0.15,0.25,0.6>,r}
+cylinder{<0.15,0.25,0.8>,<-0.05,0.25,0.8>,r}
+sphere{<-0.05,0.05,0.6>,r}
+cylinder{<-0.05,0.05,0.6>,<-0.05,0.05,0.8>,r}
+cylinder{<-0.05,0.05,0.6>,<-0.05,0.25,0.6>,r}
+cylinder{<-0.05,0.05,0.6>,<0.15,0.05,0.6>,r}
+// cell 187
+sphere{<0.15,0.25,0.6>,r}
+sphere{<0.35,0.05,0.6>,r}
+sphere{<0.35,0.25,0.6>,r}
+cylinder{<0.35,0.25,0.6>,<0.35,0.05,0.6>,r}
+cylinder{<0.35,0.25,0.6>,<0.15,0.25,0.6>,r}
+sphere{<0.15,0.05,0.6>,r}
+cylinder{<0.15,0.05,0.6>,<0.15,0.25,0.6>,r}
+cylinder{<0.15,0.05,0.6>,<0.35,0.05,0.6>,r}
+sphere{<0.15,0.05,0.8>,r}
+cylinder{<0.15,0.05,0.8>,<0.15,0.05,0.6>,r}
+sphere{<0.35,0.05,0.8>,r}
+cylinder{<0.35,0.05,0.8>,<0.35,0.05,0.6>,r}
+cylinder{<0.35,0.05,0.8>,<0.15,0.05,0.8>,r}
+sphere{<0.15,0.25,0.8>,r}
+cylinder{<0.15,0.25,0.8>,<0.15,0.25,0.6>,r}
+cylinder{<0.15,0.25,0.8>,<0.15,0.05,0.8>,r}
+sphere{<0.35,0.25,0.8>,r}
+cylinder{<0.35,0.25,0.8>,<0.35,0.05,0.8>,r}
+cylinder{<0.35,0.25,0.8>,<0.35,0.25,0.6>,r}
+cylinder{<0.35,0.25,0.8>,<0.15,0.25,0.8>,r}
+// cell 188
+sphere{<0.618453,0.25,0.668453>,r}
+sphere{<0.35,0.25,0.6>,r}
+sphere{<0.615789,0.05,0.8>,r}
+sphere{<0.35,0.05,0.6>,r}
+cylinder{<0.35,0.05,0.6>,<0.35,0.25,0.6>,r}
+sphere{<0.35,0.05,0.8>,r}
+cylinder{<0.35,0.05,0.8>,<0.35,0.05,0.6>,r}
+cylinder{<0.35,0.05,0.8>,<0.615789,0.05,0.8>,r}
+sphere{<0.55,0.25,0.6>,r}
+cylinder{<0.55,0.25,0.6>,<0.35,0.25,0.6>,r}
+cylinder{<0.55,0.25,0.6>,<0.618453,0.25,0.668453>,r}
+sphere{<0.662111,0.05,0.712111>,r}
+cylinder{<0.662111,0.05,0.712111>,<0.618453,0.25,0.668453>,r}
+cylinder{<0.662111,0.05,0.712111>,<0.615789,0.05,0.8>,r}
+sphere{<0.55,0.05,0.6>,r}
+cylinder{<0.55,0.05,0.6>,<0.35,0.05,0.6>,r}
+cylinder{<0.55,0.05,0.6>,<0.55,0.25,0.6>,r}
+cylinder{<0.55,0.05,0.6>,<0.662111,0.05,0.712111>,r}
+sphere{<0.35,0.25,0.8>,r}
+cylinder{<0.35,0.25,0.8>,<0.35,0.25,0.6>,r}
+cylinder{<0.35,0.25,0.8>,<0.35,0.05,0.8>,r}
+sphere{<0.549122,0.25,0.8>,r}
+cylinder{<0.549122,0.25,0.8>,<0.615789,0.05,0.8>,r}
+cylinder{<0.549122,0.25,0.8>,<0.618453,0.25,0.668453>,r}
+cylinder{<0.549122,0.25,0.8>,<0.35,0.25,0.8>,r}
+// cell 189
+sphere{<-0.25,0.45,0.6>,r}
+sphere{<-0.524264,0.324264,0.8>,r}
+sphere{<-0.557107,0.357107,0.707107>,r}
+cylinder{<-0.557107,0.357107,0.707107>,<-0.524264,0.324264,0.8>,r}
+sphere{<-0.45,0.25,0.6>,r}
+cylinder{<-0.45,0.25,0.6>,<-0.557107,0.357107,0.707107>,r}
+sphere{<-0.25,0.25,0.8>,r}
+sphere{<-0.25,0.25,0.6>,r}
+cylinder{<-0.25,0.25,0.6>,<-0.25,0.25,0.8>,r}
+cylinder{<-0.25,0.25,0.6>,<-0.45,0.25,0.6>,r}
+cylinder{<-0.25,0.25,0.6>,<-0.25,0.45,0.6>,r}
+sphere{<-0.357107,0.557107,0.707107>,r}
+cylinder{<-0.357107,0.557107,0.707107>,<-0.25,0.45,0.6>,r}
+sphere{<-0.324264,0.524264,0.8>,r}
+cylinder{<-0.324264,0.524264,0.8>,<-0.357107,0.557107,0.707107>,r}
+cylinder{<-0.324264,0.524264,0.8>,<-0.524264,0.324264,0.8>,r}
+sphere{<-0.483227,0.483227,0.633227>,r}
+cylinder{<-0.483227,0.483227,0.633227>,<-0.557107,0.357107,0.707107>,r}
+cylinder{<-0.483227,0.483227,0.633227>,<-0.357107,0.557107,0.707107>,r}
+sphere{<-0.45,0.45,0.6>,r}
+cylinder{<-0.45,0.45,0.6>,<-0.483227,0.483227,0.633227>,r}
+cylinder{<-0.45,0.45,0.6>,<-0.25,0.45,0.6>,r}
+cylinder{<-0.45,0.45,0.6>,<-0.45,0.25,0.6>,r}
+sphere{<-0.45,0.25,0.8>,r}
+cylinder{<-0.45,0.25,0.8>,<-0.524264,0.324264,0.8>,r}
+cylinder{<-0.45,0.25,0.8>,<-0.45,0.25,0.6>,r}
+cylinder{<-0.45,0.25,0.8>,<-0.25,0.25,0.8>,r}
+sphere{<-0.25,0.45,0.8>,r}
+cylinder{<-0.25,0.45,0.8>,<-0.25,0.25,0.8>,r}
+cylinder{<-0.25,0.45,0.8>,<-0.25,0.45,0.6>,r}
+cylinder{<-0.25,0.45,0.8>,<-0.324264,0.524264,0.8>,r}
+// cell 190
+sphere{<-0.25,0.25,0.6>,r}
+sphere{<-0.05,0.45,0.6>,r}
+sphere{<-0.05,0.45,0.8>,r}
+cylinder{<-0.05,0.45,0.8>,<-0.05,0.45,0.6>,r}
+sphere{<-0.05,0.25,0.6>,r}
+cylinder{<-0.05,0.25,0.6>,<-0.05,0.45,0.6>,r}
+cylinder{<-0.05,0.25,0.6>,<-0.25,0.25,0.6>,r}
+sphere{<-0.25,0.45,0.8>,r}
+cylinder{<-0.25,0.45,0.8>,<-0.05,0.45,0.8>,r}
+sphere{<-0.25,0.25,0.8>,r}
+cylinder{<-0.25,0.25,0.8>,<-0.25,0.45,0.8>,r}
+cylinder{<-0.25,0.25,0.8>,<-0.25,0.25,0.6>,r}
+sphere{<-0.05,0.25,0.8>,r}
+cylinder{<-0.05,0.25,0.8>,<-0.05,0.25,0.6>,r}
+cylinder{<-0.05,0.25,0.8>,<-0.05,0.45,0.8>,r}
+cylinder{<-0.05,0.25,0.8>,<-0.25,0.25,0.8>,r}
+sphere{<-0.25,0.45,0.6>,r}
+cylinder{<-0.25,0.45,0.6>,<-0.25,0.45,0.8>,r}
+cylinder{<-0.25,0.45,0.6>,<-0.05,0.45,0.6>,r}
+cylinder{<-0.25,0.45,0.6>,<-0.25,0.25,0.6>,r}
+// cell 191
+sphere{<-0.05,0.25,0.6>,r}
+sphere{<0.15,0.25,0.6>,r}
+cylinder{<0.15,0.25,0.6>,<-0.05,0.25,0.6>,r}
+sphere{<-0.05,0.45,0.6>,r}
+cylinder{<-0.05,0.45,0.6>,<-0.05,0.25,0.6>,r}
+sphere{<0.15,0.45,0.6>,r}
+cylinder{<0.15,0.45,0.6>,<0.15,0.25,0.6>,r}
+cylinder{<0.15,0.45,0.6>,<-0.05,0.45,0.6>,r}
+sphere{<-0.05,0.25,0.8>,r}
+cylinder{<-0.05,0.25,0.8>,<-0.05,0.25,0.6>,r}
+sphere{<0.15,0.25,0.8>,r}
+cylinder{<0.15,0.25,0.8>,<0.15,0.25,0.6>,r}
+cylinder{<0.15,0.25,0.8>,<-0.05,0.25,0.8>,r}
+sphere{<-0.05,0.45,0.8>,r}
+cylinder{<-0.05,0.45,0.8>,<-0.05,0.45,0.6>,r}
+cylinder{<-0.05,0.45,0.8>,<-0.05,0.25,0.8>,r}
+sphere{<0.15,0.45,0.8>,r}
+cylinder{<0.15,0.45,0.8>,<0.15,0.45,0.6>,r}
+cylinder{<0.15,0.45,0.8>,<-0.05,0.45,0.8>,r}
+cylinder{<0.15,0.45,0.8>,<0.15,0.25,0.8>,r}
+// cell 192
+sphere{<0.15,0.45,0.6>,r}
+sphere{<0.35,0.25,0.6>,r}
+sphere{<0.35,0.25,0.8>,r}
+cylinder{<0.35,0.25,0.8>,<0.35,0.25,0.6>,r}
+sphere{<0.35,0.45,0.6>,r}
+cylinder{<0.35,0.45,0.6>,<0.35,0.25,0.6>,r}
+cylinder{<0.35,0.45,0.6>,<0.15,0.45,0.6>,r}
+sphere{<0.35,0.45,0.8>,r}
+cylinder{<0.35,0.45,0.8>,<0.35,0.25,0.8>,r}
+cylinder{<0.35,0.45,0.8>,<0.35,0.45,0.6>,r}
+sphere{<0.15,0.45,0.8>,r}
+cylinder{<0.15,0.45,0.8>,<0.35,0.45,0.8>,r}
+cylinder{<0.15,0.45,0.8>,<0.15,0.45,0.6>,r}
+sphere{<0.15,0.25,0.6>,r}
+cylinder{<0.15,0.25,0.6>,<0.15,0.45,0.6>,r}
+cylinder{<0.15,0.25,0.6>,<0.35,0.25,0.6>,r}
+sphere{<0.15,0.25,0.8>,r}
+cylinder{<0.15,0.25,0.8>,<0.15,0.45,0.8>,r}
+cylinder{<0.15,0.25,0.8>,<0.15,0.25,0.6>,r}
+cylinder{<0.15,0.25,0.8>,<0.35,0.25,0.8>,r}
+// cell 193
+sphere{<0.55,0.433033,0.6>,r}
+sphere{<0.55,0.25,0.6>,r}
+cylinder{<0.55,0.25,0.6>,<0.55,0.433033,0.6>,r}
+sphere{<0.374932,0.474932,0.824932>,r}
+sphere{<0.35,0.25,0.6>,r}
+cylinder{<0.35,0.25,0.6>,<0.55,0.25,0.6>,r}
+sphere{<0.35,0.45,0.8>,r}
+cylinder{<0.35,0.45,0.8>,<0.374932,0.474932,0.824932>,r}
+sphere{<0.637153,0.25,0.687153>,r}
+cylinder{<0.637153,0.25,0.687153>,<0.55,0.433033,0.6>,r}
+cylinder{<0.637153,0.25,0.687153>,<0.55,0.25,0.6>,r}
+sphere{<0.35,0.25,0.8>,r}
+cylinder{<0.35,0.25,0.8>,<0.35,0.45,0.8>,r}
+cylinder{<0.35,0.25,0.8>,<0.35,0.25,0.6>,r}
+sphere{<0.439446,0.339446,0.889446>,r}
+cylinder{<0.439446,0.339446,0.889446>,<0.374932,0.474932,0.824932>,r}
+cylinder{<0.439446,0.339446,0.889446>,<0.35,0.25,0.8>,r}
+sphere{<0.35,0.45,0.6>,r}
+cylinder{<0.35,0.45,0.6>,<0.35,0.25,0.6>,r}
+cylinder{<0.35,0.45,0.6>,<0.35,0.45,0.8>,r}
+sphere{<0.427473,0.527473,0.677473>,r}
+cylinder{<0.427473,0.527473,0.677473>,<0.35,0.45,0.6>,r}
+cylinder{<0.427473,0.527473,0.677473>,<0.374932,0.474932,0.824932>,r}
+sphere{<0.536803,0.45,0.6>,r}
+cylinder{<0.536803,0.45,0.6>,<0.427473,0.527473,0.677473>,r}
+cylinder{<0.536803,0.45,0.6>,<0.55,0.433033,0.6>,r}
+cylinder{<0.536803,0.45,0.6>,<0.35,0.45,0.6>,r}
+sphere{<0.565673,0.25,0.8>,r}
+cylinder{<0.565673,0.25,0.8>,<0.35,0.25,0.8>,r}
+cylinder{<0.565673,0.25,0.8>,<0.637153,0.25,0.687153>,r}
+cylinder{<0.565673,0.25,0.8>,<0.439446,0.339446,0.889446>,r}
+// cell 194
+sphere{<-0.05,0.45,0.6>,r}
+sphere{<-0.25,0.657384,0.6>,r}
+sphere{<-0.05,0.71193,0.6>,r}
+cylinder{<-0.05,0.71193,0.6>,<-0.25,0.657384,0.6>,r}
+cylinder{<-0.05,0.71193,0.6>,<-0.05,0.45,0.6>,r}
+sphere{<-0.05,0.554249,0.904249>,r}
+cylinder{<-0.05,0.554249,0.904249>,<-0.05,0.71193,0.6>,r}
+sphere{<-0.365793,0.565793,0.715793>,r}
+cylinder{<-0.365793,0.565793,0.715793>,<-0.25,0.657384,0.6>,r}
+sphere{<-0.05,0.45,0.8>,r}
+cylinder{<-0.05,0.45,0.8>,<-0.05,0.554249,0.904249>,r}
+cylinder{<-0.05,0.45,0.8>,<-0.05,0.45,0.6>,r}
+sphere{<-0.331504,0.531504,0.8>,r}
+cylinder{<-0.331504,0.531504,0.8>,<-0.365793,0.565793,0.715793>,r}
+sphere{<-0.25,0.518323,0.868323>,r}
+cylinder{<-0.25,0.518323,0.868323>,<-0.05,0.554249,0.904249>,r}
+cylinder{<-0.25,0.518323,0.868323>,<-0.331504,0.531504,0.8>,r}
+sphere{<-0.25,0.45,0.6>,r}
+cylinder{<-0.25,0.45,0.6>,<-0.25,0.657384,0.6>,r}
+cylinder{<-0.25,0.45,0.6>,<-0.05,0.45,0.6>,r}
+cylinder{<-0.25,0.45,0.6>,<-0.365793,0.565793,0.715793>,r}
+sphere{<-0.25,0.45,0.8>,r}
+cylinder{<-0.25,0.45,0.8>,<-0.331504,0.531504,0.8>,r}
+cylinder{<-0.25,0.45,0.8>,<-0.25,0.45,0.6>,r}
+cylinder{<-0.25,0.45,0.8>,<-0.05,0.45,0.8>,r}
+cylinder{<-0.25,0.45,0.8>,<-0.25,0.518323,0.868323>,r}
+// cell 195
+sphere{<-0.05,0.45,0.6>,r}
+sphere{<0.15,0.68925,0.6>,r}
+sphere{<-0.05,0.707432,0.6>,r}
+cylinder{<-0.05,0.707432,0.6>,<0.15,0.68925,0.6>,r}
+cylinder{<-0.05,0.707432,0.6>,<-0.05,0.45,0.6>,r}
+sphere{<0.15,0.542432,0.892432>,r}
+cylinder{<0.15,0.542432,0.892432>,<0.15,0.68925,0.6>,r}
+sphere{<-0.05,0.45,0.8>,r}
+cylinder{<-0.05,0.45,0.8>,<-0.05,0.45,0.6>,r}
+sphere{<0.15,0.45,0.6>,r}
+cylinder{<0.15,0.45,0.6>,<0.15,0.68925,0.6>,r}
+cylinder{<0.15,0.45,0.6>,<-0.05,0.45,0.6>,r}
+sphere{<-0.05,0.554536,0.904536>,r}
+cylinder{<-0.05,0.554536,0.904536>,<0.15,0.542432,0.892432>,r}
+cylinder{<-0.05,0.554536,0.904536>,<-0.05,0.707432,0.6>,r}
+cylinder{<-0.05,0.554536,0.904536>,<-0.05,0.45,0.8>,r}
+sphere{<0.15,0.45,0.8>,r}
+cylinder{<0.15,0.45,0.8>,<0.15,0.542432,0.892432>,r}
+cylinder{<0.15,0.45,0.8>,<-0.05,0.45,0.8>,r}
+cylinder{<0.15,0.45,0.8>,<0.15,0.45,0.6>,r}
+// cell 196
+sphere{<0.429765,0.529765,0.679765>,r}
+sphere{<0.35,0.45,0.6>,r}
+cylinder{<0.35,0.45,0.6>,<0.429765,0.529765,0.679765>,r}
+sphere{<0.15,0.700739,0.6>,r}
+sphere{<0.35,0.45,0.8>,r}
+cylinder{<0.35,0.45,0.8>,<0.35,0.45,0.6>,r}
+sphere{<0.15,0.45,0.8>,r}
+cylinder{<0.15,0.45,0.8>,<0.35,0.45,0.8>,r}
+sphere{<0.374945,0.474945,0.824945>,r}
+cylinder{<0.374945,0.474945,0.824945>,<0.35,0.45,0.8>,r}
+cylinder{<0.374945,0.474945,0.824945>,<0.429765,0.529765,0.679765>,r}
+sphere{<0.15,0.540944,0.890944>,r}
+cylinder{<0.15,0.540944,0.890944>,<0.374945,0.474945,0.824945>,r}
+cylinder{<0.15,0.540944,0.890944>,<0.15,0.700739,0.6>,r}
+cylinder{<0.15,0.540944,0.890944>,<0.15,0.45,0.8>,r}
+sphere{<0.15,0.45,0.6>,r}
+cylinder{<0.15,0.45,0.6>,<0.35,0.45,0.6>,r}
+cylinder{<0.15,0.45,0.6>,<0.15,0.45,0.8>,r}
+cylinder{<0.15,0.45,0.6>,<0.15,0.700739,0.6>,r}
+sphere{<0.35,0.60983,0.6>,r}
+cylinder{<0.35,0.60983,0.6>,<0.35,0.45,0.6>,r}
+cylinder{<0.35,0.60983,0.6>,<0.15,0.700739,0.6>,r}
+cylinder{<0.35,0.60983,0.6>,<0.429765,0.529765,0.679765>,r}
+// cell 197
+sphere{<-0.05,-0.51038,1>,r}
+sphere{<-0.05,-0.615789,0.8>,r}
+cylinder{<-0.05,-0.615789,0.8>,<-0.05,-0.51038,1>,r}
+sphere{<-0.25,-0.35,0.8>,r}
+sphere{<-0.05,-0.35,0.8>,r}
+cylinder{<-0.05,-0.35,0.8>,<-0.25,-0.35,0.8>,r}
+cylinder{<-0.05,-0.35,0.8>,<-0.05,-0.615789,0.8>,r}
+sphere{<-0.25,-0.35,1>,r}
+cylinder{<-0.25,-0.35,1>,<-0.25,-0.35,0.8>,r}
+sphere{<-0.320285,-0.420285,1>,r}
+cylinder{<-0.320285,-0.420285,1>,<-0.05,-0.51038,1>,r}
+cylinder{<-0.320285,-0.420285,1>,<-0.25,-0.35,1>,r}
+sphere{<-0.25,-0.549122,0.8>,r}
+cylinder{<-0.25,-0.549122,0.8>,<-0.25,-0.35,0.8>,r}
+cylinder{<-0.25,-0.549122,0.8>,<-0.05,-0.615789,0.8>,r}
+sphere{<-0.05,-0.35,1>,r}
+cylinder{<-0.05,-0.35,1>,<-0.05,-0.35,0.8>,r}
+cylinder{<-0.05,-0.35,1>,<-0.25,-0.35,1>,r}
+cylinder{<-0.05,-0.35,1>,<-0.05,-0.51038,1>,r}
+sphere{<-0.357033,-0.457033,0.907033>,r}
+cylinder{<-0.357033,-0.457033,0.907033>,<-0.25,-0.549122,0.8>,r}
+cylinder{<-0.357033,-0.457033,0.907033>,<-0.320285,-0.420285,1>,r}
+cylinder{<-0.357033,-0.457033,0.907033>,<-0.25,-0.35,0.8>,r}
+// cell 198
+sphere{<-0.05,-0.609248,0.8>,r}
+sphere{<0.15,-0.587026,0.8>,r}
+cylinder{<0.15,-0.587026,0.8>,<-0.05,-0.609248,0.8>,r}
+sphere{<-0.05,-0.35,0.8>,r}
+cylinder{<-0.05,-0.35,0.8>,<-0.05,-0.609248,0.8>,r}
+sphere{<0.15,-0.35,0.8>,r}
+cylinder{<0.15,-0.35,0.8>,<-0.05,-0.35,0.8>,r}
+cylinder{<0.15,-0.35,0.8>,<0.15,-0.587026,0.8>,r}
+sphere{<-0.05,-0.508633,1>,r}
+cylinder{<-0.05,-0.508633,1>,<-0.05,-0.609248,0.8>,r}
+sphere{<0.15,-0.48641,1>,r}
+cylinder{<0.15,-0.48641,1>,<-0.05,-0.508633,1>,r}
+cylinder{<0.15,-0.48641,1>,<0.15,-0.587026,0.8>,r}
+sphere{<-0.05,-0.35,1>,r}
+cylinder{<-0.05,-0.35,1>,<-0.05,-0.508633,1>,r}
+cylinder{<-0.05,-0.35,1>,<-0.05,-0.35,0.8>,r}
+sphere{<0.15,-0.35,1>,r}
+cylinder{<0.15,-0.35,1>,<-0.05,-0.35,1>,r}
+cylinder{<0.15,-0.35,1>,<0.15,-0.48641,1>,r}
+cylinder{<0.15,-0.35,1>,<0.15,-0.35,0.8>,r}
+// cell 199
+sphere{<0.15,-0.35,0.8>,r}
+sphere{<0.367701,-0.367701,1>,r}
+sphere{<0.15,-0.35,1>,r}
+cylinder{<0.15,-0.35,1>,<0.15,-0.35,0.8>,r}
+sphere{<0.416711,-0.416711,0.866711>,r}
+cylinder{<0.416711,-0.416711,0.866711>,<0.367701,-0.367701,1>,r}
+sphere{<0.15,-0.603042,0.8>,r}
+cylinder{<0.15,-0.603042,0.8>,<0.15,-0.35,0.8>,r}
+sphere{<0.35,-0.35,0.8>,r}
+cylinder{<0.35,-0.35,0.8>,<0.416711,-0.416711,0.866711>,r}
+cylinder{<0.35,-0.35,0.8>,<0.15,-0.35,0.8>,r}
+sphere{<0.15,-0.488646,1>,r}
+cylinder{<0.15,-0.488646,1>,<0.15,-0.603042,0.8>,r}
+cylinder{<0.15,-0.488646,1>,<0.367701,-0.367701,1>,r}
+cylinder{<0.15,-0.488646,1>,<0.15,-0.35,1>,r}
+sphere{<0.35,-0.35,1>,r}
+cylinder{<0.35,-0.35,1>,<0.35,-0.35,0.8>,r}
+cylinder{<0.35,-0.35,1>,<0.15,-0.35,1>,r}
+cylinder{<0.35,-0.35,1>,<0.367701,-0.367701,1>,r}
+sphere{<0.35,-0.491931,0.8>,r}
+cylinder{<0.35,-0.491931,0.8>,<0.416711,-0.416711,0.866711>,r}
+cylinder{<0.35,-0.491931,0.8>,<0.15,-0.603042,0.8>,r}
+cylinder{<0.35,-0.491931,0.8>,<0.35,-0.35,0.8>,r}
+// cell 200
+sphere{<-0.351919,-0.451919,0.901919>,r}
+sphere{<-0.561616,-0.15,0.911616>,r}
+sphere{<-0.25,-0.15,0.8>,r}
+sphere{<-0.25,-0.15,1>,r}
+cylinder{<-0.25,-0.15,1>,<-0.25,-0.15,0.8>,r}
+sphere{<-0.45,-0.15,0.8>,r}
+cylinder{<-0.45,-0.15,0.8>,<-0.561616,-0.15,0.911616>,r}
+cylinder{<-0.45,-0.15,0.8>,<-0.25,-0.15,0.8>,r}
+sphere{<-0.316764,-0.416764,1>,r}
+cylinder{<-0.316764,-0.416764,1>,<-0.351919,-0.451919,0.901919>,r}
+sphere{<-0.25,-0.35,1>,r}
+cylinder{<-0.25,-0.35,1>,<-0.25,-0.15,1>,r}
+cylinder{<-0.25,-0.35,1>,<-0.316764,-0.416764,1>,r}
+sphere{<-0.507309,-0.15,1>,r}
+cylinder{<-0.507309,-0.15,1>,<-0.561616,-0.15,0.911616>,r}
+cylinder{<-0.507309,-0.15,1>,<-0.316764,-0.416764,1>,r}
+cylinder{<-0.507309,-0.15,1>,<-0.25,-0.15,1>,r}
+sphere{<-0.25,-0.35,0.8>,r}
+cylinder{<-0.25,-0.35,0.8>,<-0.25,-0.15,0.8>,r}
+cylinder{<-0.25,-0.35,0.8>,<-0.25,-0.35,1>,r}
+cylinder{<-0.25,-0.35,0.8>,<-0.351919,-0.451919,0.901919>,r}
+sphere{<-0.45,-0.35,0.8>,r}
+cylinder{<-0.45,-0.35,0.8>,<-0.45,-0.15,0.8>,r}
+cylinder{<-0.45,-0.35,0.8>,<-0.25,-0.35,0.8>,r}
+sphere{<-0.466035,-0.366035,0.816035>,r}
+cylinder{<-0.466035,-0.366035,0.816035>,<-0.45,-0.35,0.8>,r}
+cylinder{<-0.466035,-0.366035,0.816035>,<-0.351919,-0.451919,0.901919>,r}
+cylinder{<-0.466035,-0.366035,0.816035>,<-0.561616,-0.15,0.911616>,r}
+// cell 201
+sphere{<-0.25,-0.15,0.8>,r}
+sphere{<-0.05,-0.35,0.8>,r}
+sphere{<-0.25,-0.35,1>,r}
+sphere{<-0.25,-0.15,1>,r}
+cylinder{<-0.25,-0.15,1>,<-0.25,-0.35,1>,r}
+cylinder{<-0.25,-0.15,1>,<-0.25,-0.15,0.8>,r}
+sphere{<-0.25,-0.35,0.8>,r}
+cylinder{<-0.25,-0.35,0.8>,<-0.05,-0.35,0.8>,r}
+cylinder{<-0.25,-0.35,0.8>,<-0.25,-0.35,1>,r}
+cylinder{<-0.25,-0.35,0.8>,<-0.25,-0.15,0.8>,r}
+sphere{<-0.05,-0.35,1>,r}
+cylinder{<-0.05,-0.35,1>,<-0.05,-0.35,0.8>,r}
+cylinder{<-0.05,-0.35,1>,<-0.25,-0.35,1>,r}
+sphere{<-0.05,-0.15,1>,r}
+cylinder{<-0.05,-0.15,1>,<-0.25,-0.15,1>,r}
+cylinder{<-0.05,-0.15,1>,<-0.05,-0.35,1>,r}
+sphere{<-0.05,-0.15,0.8>,r}
+cylinder{<-0.05,-0.15,0.8>,<-0.05,-0.35,0.8>,r}
+cylinder{<-0.05,-0.15,0.8>,<-0.25,-0.15,0.8>,r}
+cylinder{<-0.05,-0.15,0.8>,<-0.05,-0.15,1>,r}
+// cell 202
+sphere{<-0.05,-0.15,0.8>,r}
+sphere{<0.15,-0.15,0.8>,r}
+cylinder{<0.15,-0.15,0.8>,<-0.05,-0.15,0.8>,r}
+sphere{<-0.05,-0.15,1>,r}
+cylinder{<-0.05,-0.15,1>,<-0.05,-0.15,0.8>,r}
+sphere{<-0.05,-0.35,0.8>,r}
+cylinder{<-0.05,-0.35,0.8>,<-0.05,-0.15,0.8>,r}
+sphere{<0.15,-0.15,1>,r}
+cylinder{<0.15,-0.15,1>,<0.15,-0.15,0.8>,r}
+cylinder{<0.15,-0.15,1>,<-0.05,-0.15,1>,r}
+sphere{<0.15,-0.35,1>,r}
+cylinder{<0.15,-0.35,1>,<0.15,-0.15,1>,r}
+sphere{<-0.05,-0.35,1>,r}
+cylinder{<-0.05,-0.35,1>,<0.15,-0.35,1>,r}
+cylinder{<-0.05,-0.35,1>,<-0.05,-0.15,1>,r}
+cylinder{<-0.05,-0.35,1>,<-0.05,-0.35,0.8>,r}
+sphere{<0.15,-0.35,0.8>,r}
+cylinder{<0.15,-0.35,0.8>,<0.15,-0.35,1>,r}
+cylinder{<0.15,-0.35,0.8>,<-0.05,-0.35,0.8>,r}
+cylinder{<0.15,-0.35,0.8>,<0.15,-0.15,0.8>,r}
+// cell 203
+sphere{<0.15,-0.35,0.8>,r}
+sphere{<0.35,-0.15,0.8>,r}
+sphere{<0.15,-0.15,1>,r}
+sphere{<0.35,-0.35,0.8>,r}
+cylinder{<0.35,-0.35,0.8>,<0.35,-0.15,0.8>,r}
+cylinder{<0.35,-0.35,0.8>,<0.15,-0.35,0.8>,r}
+sphere{<0.35,-0.35,1>,r}
+cylinder{<0.35,-0.35,1>,<0.35,-0.35,0.8>,r}
+sphere{<0.15,-0.35,1>,r}
+cylinder{<0.15,-0.35,1>,<0.35,-0.35,1>,r}
+cylinder{<0.15,-0.35,1>,<0.15,-0.15,1>,r}
+cylinder{<0.15,-0.35,1>,<0.15,-0.35,0.8>,r}
+sphere{<0.15,-0.15,0.8>,r}
+cylinder{<0.15,-0.15,0.8>,<0.15,-0.15,1>,r}
+cylinder{<0.15,-0.15,0.8>,<0.35,-0.15,0.8>,r}
+cylinder{<0.15,-0.15,0.8>,<0.15,-0.35,0.8>,r}
+sphere{<0.35,-0.15,1>,r}
+cylinder{<0.35,-0.15,1>,<0.35,-0.15,0.8>,r}
+cylinder{<0.35,-0.15,1>,<0.15,-0.15,1>,r}
+cylinder{<0.35,-0.15,1>,<0.35,-0.35,1>,r}
+// cell 204
+sphere{<0.416711,-0.416711,0.866711>,r}
+sphere{<0.35,-0.15,0.8>,r}
+sphere{<0.491931,-0.35,0.8>,r}
+cylinder{<0.491931,-0.35,0.8>,<0.416711,-0.416711,0.866711>,r}
+sphere{<0.603042,-0.15,0.8>,r}
+cylinder{<0.603042,-0.15,0.8>,<0.491931,-0.35,0.8>,r}
+cylinder{<0.603042,-0.15,0.8>,<0.35,-0.15,0.8>,r}
+sphere{<0.367701,-0.367701,1>,r}
+cylinder{<0.367701,-0.367701,1>,<0.416711,-0.416711,0.866711>,r}
+sphere{<0.35,-0.35,1>,r}
+cylinder{<0.35,-0.35,1>,<0.367701,-0.367701,1>,r}
+sphere{<0.488646,-0.15,1>,r}
+cylinder{<0.488646,-0.15,1>,<0.367701,-0.367701,1>,r}
+cylinder{<0.488646,-0.15,1>,<0.603042,-0.15,0.8>,r}
+sphere{<0.35,-0.15,1>,r}
+cylinder{<0.35,-0.15,1>,<0.35,-0.35,1>,r}
+cylinder{<0.35,-0.15,1>,<0.488646,-0.15,1>,r}
+cylinder{<0.35,-0.15,1>,<0.35,-0.15,0.8>,r}
+sphere{<0.35,-0.35,0.8>,r}
+cylinder{<0.35,-0.35,0.8>,<0.35,-0.15,0.8>,r}
+cylinder{<0.35,-0.35,0.8>,<0.491931,-0.35,0.8>,r}
+cylinder{<0.35,-0.35,0.8>,<0.416711,-0.416711,0.866711>,r}
+cylinder{<0.35,-0.35,0.8>,<0.35,-0.35,1>,r}
+// cell 205
+sphere{<-0.558456,0.05,0.908456>,r}
+sphere{<-0.25,-0.15,0.8>,r}
+sphere{<-0.45,0.05,0.8>,r}
+cylinder{<-0.45,0.05,0.8>,<-0.558456,0.05,0.908456>,r}
+sphere{<-0.25,0.05,0.8>,r}
+cylinder{<-0.25,0.05,0.8>,<-0.25,-0.15,0.8>,r}
+cylinder{<-0.25,0.05,0.8>,<-0.45,0.05,0.8>,r}
+sphere{<-0.483648,-0.15,1>,r}
+sphere{<-0.25,-0.15,1>,r}
+cylinder{<-0.25,-0.15,1>,<-0.25,-0.15,0.8>,r}
+cylinder{<-0.25,-0.15,1>,<-0.483648,-0.15,1>,r}
+sphere{<-0.512219,0.05,1>,r}
+cylinder{<-0.512219,0.05,1>,<-0.558456,0.05,0.908456>,r}
+cylinder{<-0.512219,0.05,1>,<-0.483648,-0.15,1>,r}
+sphere{<-0.25,0.05,1>,r}
+cylinder{<-0.25,0.05,1>,<-0.25,0.05,0.8>,r}
+cylinder{<-0.25,0.05,1>,<-0.512219,0.05,1>,r}
+cylinder{<-0.25,0.05,1>,<-0.25,-0.15,1>,r}
+sphere{<-0.45,-0.15,0.8>,r}
+cylinder{<-0.45,-0.15,0.8>,<-0.45,0.05,0.8>,r}
+cylinder{<-0.45,-0.15,0.8>,<-0.25,-0.15,0.8>,r}
+sphere{<-0.539473,-0.15,0.889473>,r}
+cylinder{<-0.539473,-0.15,0.889473>,<-0.45,-0.15,0.8>,r}
+cylinder{<-0.539473,-0.15,0.889473>,<-0.483648,-0.15,1>,r}
+cylinder{<-0.539473,-0.15,0.889473>,<-0.558456,0.05,0.908456>,r}
+// cell 206
+sphere{<-0.25,-0.15,0.8>,r}
+sphere{<-0.05,-0.15,0.8>,r}
+cylinder{<-0.05,-0.15,0.8>,<-0.25,-0.15,0.8>,r}
+sphere{<-0.05,0.05,1>,r}
+sphere{<-0.25,0.05,1>,r}
+cylinder{<-0.25,0.05,1>,<-0.05,0.05,1>,r}
+sphere{<-0.25,0.05,0.8>,r}
+cylinder{<-0.25,0.05,0.8>,<-0.25,0.05,1>,r}
+cylinder{<-0.25,0.05,0.8>,<-0.25,-0.15,0.8>,r}
+sphere{<-0.05,-0.15,1>,r}
+cylinder{<-0.05,-0.15,1>,<-0.05,0.05,1>,r}
+cylinder{<-0.05,-0.15,1>,<-0.05,-0.15,0.8>,r}
+sphere{<-0.05,0.05,0.8>,r}
+cylinder{<-0.05,0.05,0.8>,<-0.25,0.05,0.8>,r}
+cylinder{<-0.05,0.05,0.8>,<-0.05,0.05,1>,r}
+cylinder{<-0.05,0.05,0.8>,<-0.05,-0.15,0.8>,r}
+sphere{<-0.25,-0.15,1>,r}
+cylinder{<-0.25,-0.15,1>,<-0.05,-0.15,1>,r}
+cylinder{<-0.25,-0.15,1>,<-0.25,0.05,1>,r}
+cylinder{<-0.25,-0.15,1>,<-0.25,-0.15,0.8>,r}
+// cell 207
+sphere{<0.15,0.05,0.8>,r}
+sphere{<0.15,-0.15,0.8>,r}
+cylinder{<0.15,-0.15,0.8>,<0.15,0.05,0.8>,r}
+sphere{<-0.05,0.05,1>,r}
+sphere{<0.15,0.05,1>,r}
+cylinder{<0.15,0.05,1>,<-0.05,0.05,1>,r}
+cylinder{<0.15,0.05,1>,<0.15,0.05,0.8>,r}
+sphere{<-0.05,-0.15,1>,r}
+cylinder{<-0.05,-0.15,1>,<-0.05,0.05,1>,r}
+sphere{<0.15,-0.15,1>,r}
+cylinder{<0.15,-0.15,1>,<0.15,-0.15,0.8>,r}
+cylinder{<0.15,-0.15,1>,<0.15,0.05,1>,r}
+cylinder{<0.15,-0.15,1>,<-0.05,-0.15,1>,r}
+sphere{<-0.05,0.05,0.8>,r}
+cylinder{<-0.05,0.05,0.8>,<-0.05,0.05,1>,r}
+cylinder{<-0.05,0.05,0.8>,<0.15,0.05,0.8>,r}
+sphere{<-0.05,-0.15,0.8>,r}
+cylinder{<-0.05,-0.15,0.8>,<-0.05,-0.15,1>,r}
+cylinder{<-0.05,-0.15,0.8>,<-0.05,0.05,0.8>,r}
+cylinder{<-0.05,-0.15,0.8>,<0.15,-0.15,0.8>,r}
+// cell 208
+sphere{<0.35,0.05,0.8>,r}
+sphere{<0.15,0.05,1>,r}
+sphere{<0.35,0.05,1>,r}
+cylinder{<0.35,0.05,1>,<0.35,0.05,0.8>,r}
+cylinder{<0.35,0.05,1>,<0.15,0.05,1>,r}
+sphere{<0.35,-0.15,0.8>,r}
+cylinder{<0.35,-0.15,0.8>,<0.35,0.05,0.8>,r}
+sphere{<0.15,-0.15,1>,r}
+cylinder{<0.15,-0.15,1>,<0.15,0.05,1>,r}
+sphere{<0.15,0.05,0.8>,r}
+cylinder{<0.15,0.05,0.8>,<0.15,0.05,1>,r}
+cylinder{<0.15,0.05,0.8>,<0.35,0.05,0.8>,r}
+sphere{<0.15,-0.15,0.8>,r}
+cylinder{<0.15,-0.15,0.8>,<0.15,-0.15,1>,r}
+cylinder{<0.15,-0.15,0.8>,<0.15,0.05,0.8>,r}
+cylinder{<0.15,-0.15,0.8>,<0.35,-0.15,0.8>,r}
+sphere{<0.35,-0.15,1>,r}
+cylinder{<0.35,-0.15,1>,<0.35,0.05,1>,r}
+cylinder{<0.35,-0.15,1>,<0.15,-0.15,1>,r}
+cylinder{<0.35,-0.15,1>,<0.35,-0.15,0.8>,r}
+// cell 209
+sphere{<0.35,-0.15,0.8>,r}
+sphere{<0.587026,-0.15,0.8>,r}
+cylinder{<0.587026,-0.15,0.8>,<0.35,-0.15,0.8>,r}
+sphere{<0.35,0.05,0.8>,r}
+cylinder{<0.35,0.05,0.8>,<0.35,-0.15,0.8>,r}
+sphere{<0.609248,0.05,0.8>,r}
+cylinder{<0.609248,0.05,0.8>,<0.587026,-0.15,0.8>,r}
+cylinder{<0.609248,0.05,0.8>,<0.35,0.05,0.8>,r}
+sphere{<0.35,-0.15,1>,r}
+cylinder{<0.35,-0.15,1>,<0.35,-0.15,0.8>,r}
+sphere{<0.48641,-0.15,1>,r}
+cylinder{<0.48641,-0.15,1>,<0.587026,-0.15,0.8>,r}
+cylinder{<0.48641,-0.15,1>,<0.35,-0.15,1>,r}
+sphere{<0.35,0.05,1>,r}
+cylinder{<0.35,0.05,1>,<0.35,-0.15,1>,r}
+cylinder{<0.35,0.05,1>,<0.35,0.05,0.8>,r}
+sphere{<0.508633,0.05,1>,r}
+cylinder{<0.508633,0.05,1>,<0.35,0.05,1>,r}
+cylinder{<0.508633,0.05,1>,<0.48641,-0.15,1>,r}
+cylinder{<0.508633,0.05,1>,<0.609248,0.05,0.8>,r}
+// cell 210
+sphere{<-0.25,0.05,1>,r}
+sphere{<-0.511942,0.25,0.861942>,r}
+sphere{<-0.522555,0.05,1>,r}
+cylinder{<-0.522555,0.05,1>,<-0.25,0.05,1>,r}
+sphere{<-0.45,0.25,0.8>,r}
+cylinder{<-0.45,0.25,0.8>,<-0.511942,0.25,0.861942>,r}
+sphere{<-0.25,0.25,1>,r}
+cylinder{<-0.25,0.25,1>,<-0.25,0.05,1>,r}
+sphere{<-0.25,0.05,0.8>,r}
+cylinder{<-0.25,0.05,0.8>,<-0.25,0.05,1>,r}
+sphere{<-0.436841,0.25,1>,r}
+cylinder{<-0.436841,0.25,1>,<-0.511942,0.25,0.861942>,r}
+cylinder{<-0.436841,0.25,1>,<-0.522555,0.05,1>,r}
+cylinder{<-0.436841,0.25,1>,<-0.25,0.25,1>,r}
+sphere{<-0.25,0.25,0.8>,r}
+cylinder{<-0.25,0.25,0.8>,<-0.45,0.25,0.8>,r}
+cylinder{<-0.25,0.25,0.8>,<-0.25,0.25,1>,r}
+cylinder{<-0.25,0.25,0.8>,<-0.25,0.05,0.8>,r}
+sphere{<-0.45,0.05,0.8>,r}
+cylinder{<-0.45,0.05,0.8>,<-0.45,0.25,0.8>,r}
+cylinder{<-0.45,0.05,0.8>,<-0.25,0.05,0.8>,r}
+sphere{<-0.567457,0.05,0.917457>,r}
+cylinder{<-0.567457,0.05,0.917457>,<-0.522555,0.05,1>,r}
+cylinder{<-0.567457,0.05,0.917457>,<-0.511942,0.25,0.861942>,r}
+cylinder{<-0.567457,0.05,0.917457>,<-0.45,0.05,0.8>,r}
+// cell 211
+sphere{<-0.25,0.05,0.8>,r}
+sphere{<-0.05,0.05,0.8>,r}
+cylinder{<-0.05,0.05,0.8>,<-0.25,0.05,0.8>,r}
+sphere{<-0.25,0.05,1>,r}
+cylinder{<-0.25,0.05,1>,<-0.25,0.05,0.8>,r}
+sphere{<-0.05,0.25,1>,r}
+sphere{<-0.25,0.25,0.8>,r}
+cylinder{<-0.25,0.25,0.8>,<-0.25,0.05,0.8>,r}
+sphere{<-0.05,0.05,1>,r}
+cylinder{<-0.05,0.05,1>,<-0.05,0.25,1>,r}
+cylinder{<-0.05,0.05,1>,<-0.25,0.05,1>,r}
+cylinder{<-0.05,0.05,1>,<-0.05,0.05,0.8>,r}
+sphere{<-0.05,0.25,0.8>,r}
+cylinder{<-0.05,0.25,0.8>,<-0.05,0.25,1>,r}
+cylinder{<-0.05,0.25,0.8>,<-0.05,0.05,0.8>,r}
+cylinder{<-0.05,0.25,0.8>,<-0.25,0.25,0.8>,r}
+sphere{<-0.25,0.25,1>,r}
+cylinder{<-0.25,0.25,1>,<-0.25,0.05,1>,r}
+cylinder{<-0.25,0.25,1>,<-0.05,0.25,1>,r}
+cylinder{<-0.25,0.25,1>,<-0.25,0.25,0.8>,r}
+// cell 212
+sphere{<0.15,0.25,0.8>,r}
+sphere{<0.15,0.05,0.8>,r}
+cylinder{<0.15,0.05,0.8>,<0.15,0.25,0.8>,r}
+sphere{<-0.05,0.25,0.8>,r}
+cylinder{<-0.05,0.25,0.8>,<0.15,0.25,0.8>,r}
+sphere{<-0.05,0.05,1>,r}
+sphere{<-0.05,0.25,1>,r}
+cylinder{<-0.05,0.25,1>,<-0.05,0.05,1>,r}
+cylinder{<-0.05,0.25,1>,<-0.05,0.25,0.8>,r}
+sphere{<0.15,0.05,1>,r}
+cylinder{<0.15,0.05,1>,<0.15,0.05,0.8>,r}
+cylinder{<0.15,0.05,1>,<-0.05,0.05,1>,r}
+sphere{<0.15,0.25,1>,r}
+cylinder{<0.15,0.25,1>,<-0.05,0.25,1>,r}
+cylinder{<0.15,0.25,1>,<0.15,0.05,1>,r}
+cylinder{<0.15,0.25,1>,<0.15,0.25,0.8>,r}
+sphere{<-0.05,0.05,0.8>,r}
+cylinder{<-0.05,0.05,0.8>,<-0.05,0.05,1>,r}
+cylinder{<-0.05,0.05,0.8>,<-0.05,0.25,0.8>,r}
+cylinder{<-0.05,0.05,0.8>,<0.15,0.05,0.8>,r}
+// cell 213
+sphere{<0.15,0.05,0.8>,r}
+sphere{<0.35,0.05,0.8>,r}
+cylinder{<0.35,0.05,0.8>,<0.15,0.05,0.8>,r}
+sphere{<0.35,0.25,1>,r}
+sphere{<0.35,0.25,0.8>,r}
+cylinder{<0.35,0.25,0.8>,<0.35,0.25,1>,r}
+cylinder{<0.35,0.25,0.8>,<0.35,0.05,0.8>,r}
+sphere{<0.15,0.05,1>,r}
+cylinder{<0.15,0.05,1>,<0.15,0.05,0.8>,r}
+sphere{<0.35,0.05,1>,r}
+cylinder{<0.35,0.05,1>,<0.35,0.05,0.8>,r}
+cylinder{<0.35,0.05,1>,<0.35,0.25,1>,r}
+cylinder{<0.35,0.05,1>,<0.15,0.05,1>,r}
+sphere{<0.15,0.25,0.8>,r}
+cylinder{<0.15,0.25,0.8>,<0.35,0.25,0.8>,r}
+cylinder{<0.15,0.25,0.8>,<0.15,0.05,0.8>,r}
+sphere{<0.15,0.25,1>,r}
+cylinder{<0.15,0.25,1>,<0.15,0.05,1>,r}
+cylinder{<0.15,0.25,1>,<0.35,0.25,1>,r}
+cylinder{<0.15,0.25,1>,<0.15,0.25,0.8>,r}
+// cell 214
+sphere{<0.35,0.05,0.8>,r}
+sphere{<0.457033,0.357033,0.907033>,r}
+sphere{<0.549122,0.25,0.8>,r}
+cylinder{<0.549122,0.25,0.8>,<0.457033,0.357033,0.907033>,r}
+sphere{<0.35,0.25,1>,r}
+sphere{<0.35,0.05,1>,r}
+cylinder{<0.35,0.05,1>,<0.35,0.25,1>,r}
+cylinder{<0.35,0.05,1>,<0.35,0.05,0.8>,r}
+sphere{<0.615789,0.05,0.8>,r}
+cylinder{<0.615789,0.05,0.8>,<0.549122,0.25,0.8>,r}
+cylinder{<0.615789,0.05,0.8>,<0.35,0.05,0.8>,r}
+sphere{<0.420285,0.320285,1>,r}
+cylinder{<0.420285,0.320285,1>,<0.35,0.25,1>,r}
+cylinder{<0.420285,0.320285,1>,<0.457033,0.357033,0.907033>,r}
+sphere{<0.51038,0.05,1>,r}
+cylinder{<0.51038,0.05,1>,<0.615789,0.05,0.8>,r}
+cylinder{<0.51038,0.05,1>,<0.420285,0.320285,1>,r}
+cylinder{<0.51038,0.05,1>,<0.35,0.05,1>,r}
+sphere{<0.35,0.25,0.8>,r}
+cylinder{<0.35,0.25,0.8>,<0.549122,0.25,0.8>,r}
+cylinder{<0.35,0.25,0.8>,<0.35,0.05,0.8>,r}
+cylinder{<0.35,0.25,0.8>,<0.35,0.25,1>,r}
+cylinder{<0.35,0.25,0.8>,<0.457033,0.357033,0.907033>,r}
+// cell 215
+sphere{<-0.25,0.457107,1>,r}
+sphere{<-0.457107,0.25,1>,r}
+cylinder{<-0.457107,0.25,1>,<-0.25,0.457107,1>,r}
+sphere{<-0.537006,0.25,0.887006>,r}
+cylinder{<-0.537006,0.25,0.887006>,<-0.457107,0.25,1>,r}
+sphere{<-0.324264,0.524264,0.8>,r}
+sphere{<-0.25,0.25,1>,r}
+cylinder{<-0.25,0.25,1>,<-0.25,0.457107,1>,r}
+cylinder{<-0.25,0.25,1>,<-0.457107,0.25,1>,r}
+sphere{<-0.25,0.25,0.8>,r}
+cylinder{<-0.25,0.25,0.8>,<-0.25,0.25,1>,r}
+sphere{<-0.25,0.537006,0.887006>,r}
+cylinder{<-0.25,0.537006,0.887006>,<-0.324264,0.524264,0.8>,r}
+cylinder{<-0.25,0.537006,0.887006>,<-0.25,0.457107,1>,r}
+sphere{<-0.25,0.45,0.8>,r}
+cylinder{<-0.25,0.45,0.8>,<-0.25,0.537006,0.887006>,r}
+cylinder{<-0.25,0.45,0.8>,<-0.25,0.25,0.8>,r}
+cylinder{<-0.25,0.45,0.8>,<-0.324264,0.524264,0.8>,r}
+sphere{<-0.524264,0.324264,0.8>,r}
+cylinder{<-0.524264,0.324264,0.8>,<-0.537006,0.25,0.887006>,r}
+cylinder{<-0.524264,0.324264,0.8>,<-0.324264,0.524264,0.8>,r}
+sphere{<-0.45,0.25,0.8>,r}
+cylinder{<-0.45,0.25,0.8>,<-0.524264,0.324264,0.8>,r}
+cylinder{<-0.45,0.25,0.8>,<-0.25,0.25,0.8>,r}
+cylinder{<-0.45,0.25,0.8>,<-0.537006,0.25,0.887006>,r}
+// cell 216
+sphere{<-0.25,0.25,0.8>,r}
+sphere{<-0.25,0.436841,1>,r}
+sphere{<-0.05,0.567457,0.917457>,r}
+sphere{<-0.05,0.522555,1>,r}
+cylinder{<-0.05,0.522555,1>,<-0.05,0.567457,0.917457>,r}
+cylinder{<-0.05,0.522555,1>,<-0.25,0.436841,1>,r}
+sphere{<-0.25,0.25,1>,r}
+cylinder{<-0.25,0.25,1>,<-0.25,0.436841,1>,r}
+cylinder{<-0.25,0.25,1>,<-0.25,0.25,0.8>,r}
+sphere{<-0.05,0.25,1>,r}
+cylinder{<-0.05,0.25,1>,<-0.05,0.522555,1>,r}
+cylinder{<-0.05,0.25,1>,<-0.25,0.25,1>,r}
+sphere{<-0.05,0.45,0.8>,r}
+cylinder{<-0.05,0.45,0.8>,<-0.05,0.567457,0.917457>,r}
+sphere{<-0.05,0.25,0.8>,r}
+cylinder{<-0.05,0.25,0.8>,<-0.05,0.45,0.8>,r}
+cylinder{<-0.05,0.25,0.8>,<-0.05,0.25,1>,r}
+cylinder{<-0.05,0.25,0.8>,<-0.25,0.25,0.8>,r}
+sphere{<-0.25,0.45,0.8>,r}
+cylinder{<-0.25,0.45,0.8>,<-0.05,0.45,0.8>,r}
+cylinder{<-0.25,0.45,0.8>,<-0.25,0.25,0.8>,r}
+sphere{<-0.25,0.511942,0.861942>,r}
+cylinder{<-0.25,0.511942,0.861942>,<-0.25,0.45,0.8>,r}
+cylinder{<-0.25,0.511942,0.861942>,<-0.25,0.436841,1>,r}
+cylinder{<-0.25,0.511942,0.861942>,<-0.05,0.567457,0.917457>,r}
+// cell 217
+sphere{<-0.05,0.25,0.8>,r}
+sphere{<0.15,0.25,0.8>,r}
+cylinder{<0.15,0.25,0.8>,<-0.05,0.25,0.8>,r}
+sphere{<0.15,0.539473,0.889473>,r}
+sphere{<0.15,0.45,0.8>,r}
+cylinder{<0.15,0.45,0.8>,<0.15,0.539473,0.889473>,r}
+cylinder{<0.15,0.45,0.8>,<0.15,0.25,0.8>,r}
+sphere{<-0.05,0.25,1>,r}
+cylinder{<-0.05,0.25,1>,<-0.05,0.25,0.8>,r}
+sphere{<0.15,0.25,1>,r}
+cylinder{<0.15,0.25,1>,<-0.05,0.25,1>,r}
+cylinder{<0.15,0.25,1>,<0.15,0.25,0.8>,r}
+sphere{<-0.05,0.512219,1>,r}
+cylinder{<-0.05,0.512219,1>,<-0.05,0.25,1>,r}
+sphere{<0.15,0.483648,1>,r}
+cylinder{<0.15,0.483648,1>,<0.15,0.539473,0.889473>,r}
+cylinder{<0.15,0.483648,1>,<-0.05,0.512219,1>,r}
+cylinder{<0.15,0.483648,1>,<0.15,0.25,1>,r}
+sphere{<-0.05,0.45,0.8>,r}
+cylinder{<-0.05,0.45,0.8>,<0.15,0.45,0.8>,r}
+cylinder{<-0.05,0.45,0.8>,<-0.05,0.25,0.8>,r}
+sphere{<-0.05,0.558456,0.908456>,r}
+cylinder{<-0.05,0.558456,0.908456>,<-0.05,0.512219,1>,r}
+cylinder{<-0.05,0.558456,0.908456>,<0.15,0.539473,0.889473>,r}
+cylinder{<-0.05,0.558456,0.908456>,<-0.05,0.45,0.8>,r}
+// cell 218
+sphere{<0.451919,0.351919,0.901919>,r}
+sphere{<0.35,0.25,0.8>,r}
+cylinder{<0.35,0.25,0.8>,<0.451919,0.351919,0.901919>,r}
+sphere{<0.15,0.561616,0.911616>,r}
+sphere{<0.15,0.25,1>,r}
+sphere{<0.15,0.507309,1>,r}
+cylinder{<0.15,0.507309,1>,<0.15,0.25,1>,r}
+cylinder{<0.15,0.507309,1>,<0.15,0.561616,0.911616>,r}
+sphere{<0.35,0.25,1>,r}
+cylinder{<0.35,0.25,1>,<0.15,0.25,1>,r}
+cylinder{<0.35,0.25,1>,<0.35,0.25,0.8>,r}
+sphere{<0.15,0.25,0.8>,r}
+cylinder{<0.15,0.25,0.8>,<0.15,0.25,1>,r}
+cylinder{<0.15,0.25,0.8>,<0.35,0.25,0.8>,r}
+sphere{<0.416764,0.316764,1>,r}
+cylinder{<0.416764,0.316764,1>,<0.451919,0.351919,0.901919>,r}
+cylinder{<0.416764,0.316764,1>,<0.15,0.507309,1>,r}
+cylinder{<0.416764,0.316764,1>,<0.35,0.25,1>,r}
+sphere{<0.15,0.45,0.8>,r}
+cylinder{<0.15,0.45,0.8>,<0.15,0.25,0.8>,r}
+cylinder{<0.15,0.45,0.8>,<0.15,0.561616,0.911616>,r}
+sphere{<0.366035,0.466035,0.816035>,r}
+cylinder{<0.366035,0.466035,0.816035>,<0.15,0.561616,0.911616>,r}
+cylinder{<0.366035,0.466035,0.816035>,<0.451919,0.351919,0.901919>,r}
+sphere{<0.35,0.45,0.8>,r}
+cylinder{<0.35,0.45,0.8>,<0.366035,0.466035,0.816035>,r}
+cylinder{<0.35,0.45,0.8>,<0.35,0.25,0.8>,r}
+cylinder{<0.35,0.45,0.8>,<0.15,0.45,0.8>,r}
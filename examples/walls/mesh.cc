@@ -0,0 +1,72 @@
+// Triangle mesh wall example code
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+#include "voro++.hh"
+using namespace voro;
+
+#include <vector>
+using namespace std;
+
+const double pi=3.1415926535897932384626433832795;
+
+// Set the number of divisions of the mesh in latitude and longitude
+const int n_lat=24,n_lon=48;
+
+int main() {
+	int i,j,k,n=0;
+	double x,y,z,th,ph,mvol=0,vvol;
+	vector<double> v;
+	vector<int> t;
+
+	// Create a triangulated sphere of radius 1, with a vertex at each
+	// pole and a ring of vertices at each latitude
+	v.push_back(0);v.push_back(0);v.push_back(1);
+	for(i=1;i<n_lat;i++) for(j=0;j<n_lon;j++) {
+		th=pi*i/n_lat;ph=2*pi*j/n_lon;
+		v.push_back(sin(th)*cos(ph));v.push_back(sin(th)*sin(ph));v.push_back(cos(th));
+	}
+	v.push_back(0);v.push_back(0);v.push_back(-1);
+	k=v.size()/3-1;
+	for(j=0;j<n_lon;j++) {
+		t.push_back(0);t.push_back(1+j);t.push_back(1+(j+1)%n_lon);
+		t.push_back(k);t.push_back(k-n_lon+(j+1)%n_lon);t.push_back(k-n_lon+j);
+	}
+	for(i=0;i<n_lat-2;i++) for(j=0;j<n_lon;j++) {
+		int a=1+i*n_lon+j,b=1+i*n_lon+(j+1)%n_lon;
+		t.push_back(a);t.push_back(a+n_lon);t.push_back(b+n_lon);
+		t.push_back(a);t.push_back(b+n_lon);t.push_back(b);
+	}
+
+	// Compute the exact volume of the mesh by summing the signed volumes
+	// of the tetrahedra that join each triangle to the origin
+	for(i=0;i<(int) t.size();i+=3) {
+		double *p0=&v[3*t[i]],*p1=&v[3*t[i+1]],*p2=&v[3*t[i+2]];
+		mvol+=(p0[0]*(p1[1]*p2[2]-p1[2]*p2[1])+p0[1]*(p1[2]*p2[0]-p1[0]*p2[2])
+		      +p0[2]*(p1[0]*p2[1]-p1[1]*p2[0]))/6;
+	}
+
+	// Create a container that encloses the mesh, and add the mesh as a
+	// wall
+	container con(-1.1,1.1,-1.1,1.1,-1.1,1.1,8,8,8,false,false,false,8);
+	wall_mesh wm(v,t);
+	con.add_wall(wm);
+
+	// Place particles in a regular grid, for points which are inside the
+	// mesh
+	for(z=-0.95;z<1;z+=0.1) for(y=-0.95;y<1;y+=0.1) for(x=-0.95;x<1;x+=0.1)
+		if(con.point_inside(x,y,z)) con.put(n++,x,y,z);
+
+	// Output the particle positions and Voronoi cells in gnuplot format
+	con.draw_particles("mesh_p.gnu");
+	con.draw_cells_gnuplot("mesh_v.gnu");
+
+	// Compute the volume of the Voronoi cells and compare it to the
+	// volume of the mesh
+	vvol=con.sum_cell_volumes();
+	printf("Mesh volume         : %g\n"
+	       "Voronoi cell volume : %g\n"
+	       "Difference          : %g\n",mvol,vvol,vvol-mvol);
+}
@@ -0,0 +1,4224 @@
+38 -0.35 -0.35 -0.85
+32 -0.25 -0.45 -0.85
+33 -0.15 -0.45 -0.85
+34 -0.05 -0.45 -0.85
+39 -0.25 -0.35 -0.85
+40 -0.15 -0.35 -0.85
+41 -0.05 -0.35 -0.85
+35 0.05 -0.45 -0.85
+36 0.15 -0.45 -0.85
+37 0.25 -0.45 -0.85
+42 0.05 -0.35 -0.85
+43 0.15 -0.35 -0.85
+44 0.25 -0.35 -0.85
+45 0.35 -0.35 -0.85
+46 -0.45 -0.25 -0.85
+47 -0.35 -0.25 -0.85
+56 -0.45 -0.15 -0.85
+57 -0.35 -0.15 -0.85
+66 -0.45 -0.05 -0.85
+67 -0.35 -0.05 -0.85
+0 -0.15 -0.25 -0.95
+1 -0.05 -0.25 -0.95
+4 -0.25 -0.15 -0.95
+5 -0.15 -0.15 -0.95
+6 -0.05 -0.15 -0.95
+10 -0.25 -0.05 -0.95
+11 -0.15 -0.05 -0.95
+12 -0.05 -0.05 -0.95
+48 -0.25 -0.25 -0.85
+49 -0.15 -0.25 -0.85
+50 -0.05 -0.25 -0.85
+58 -0.25 -0.15 -0.85
+59 -0.15 -0.15 -0.85
+60 -0.05 -0.15 -0.85
+68 -0.25 -0.05 -0.85
+69 -0.15 -0.05 -0.85
+70 -0.05 -0.05 -0.85
+2 0.05 -0.25 -0.95
+3 0.15 -0.25 -0.95
+7 0.05 -0.15 -0.95
+8 0.15 -0.15 -0.95
+9 0.25 -0.15 -0.95
+13 0.05 -0.05 -0.95
+14 0.15 -0.05 -0.95
+15 0.25 -0.05 -0.95
+51 0.05 -0.25 -0.85
+52 0.15 -0.25 -0.85
+53 0.25 -0.25 -0.85
+61 0.05 -0.15 -0.85
+62 0.15 -0.15 -0.85
+63 0.25 -0.15 -0.85
+71 0.05 -0.05 -0.85
+72 0.15 -0.05 -0.85
+73 0.25 -0.05 -0.85
+54 0.35 -0.25 -0.85
+55 0.45 -0.25 -0.85
+64 0.35 -0.15 -0.85
+65 0.45 -0.15 -0.85
+74 0.35 -0.05 -0.85
+75 0.45 -0.05 -0.85
+76 -0.45 0.05 -0.85
+77 -0.35 0.05 -0.85
+86 -0.45 0.15 -0.85
+87 -0.35 0.15 -0.85
+96 -0.45 0.25 -0.85
+97 -0.35 0.25 -0.85
+16 -0.25 0.05 -0.95
+17 -0.15 0.05 -0.95
+18 -0.05 0.05 -0.95
+22 -0.25 0.15 -0.95
+23 -0.15 0.15 -0.95
+24 -0.05 0.15 -0.95
+28 -0.15 0.25 -0.95
+29 -0.05 0.25 -0.95
+78 -0.25 0.05 -0.85
+79 -0.15 0.05 -0.85
+80 -0.05 0.05 -0.85
+88 -0.25 0.15 -0.85
+89 -0.15 0.15 -0.85
+90 -0.05 0.15 -0.85
+98 -0.25 0.25 -0.85
+99 -0.15 0.25 -0.85
+100 -0.05 0.25 -0.85
+19 0.05 0.05 -0.95
+20 0.15 0.05 -0.95
+21 0.25 0.05 -0.95
+25 0.05 0.15 -0.95
+26 0.15 0.15 -0.95
+27 0.25 0.15 -0.95
+30 0.05 0.25 -0.95
+31 0.15 0.25 -0.95
+81 0.05 0.05 -0.85
+82 0.15 0.05 -0.85
+83 0.25 0.05 -0.85
+91 0.05 0.15 -0.85
+92 0.15 0.15 -0.85
+93 0.25 0.15 -0.85
+101 0.05 0.25 -0.85
+102 0.15 0.25 -0.85
+103 0.25 0.25 -0.85
+84 0.35 0.05 -0.85
+85 0.45 0.05 -0.85
+94 0.35 0.15 -0.85
+95 0.45 0.15 -0.85
+104 0.35 0.25 -0.85
+105 0.45 0.25 -0.85
+106 -0.35 0.35 -0.85
+107 -0.25 0.35 -0.85
+108 -0.15 0.35 -0.85
+109 -0.05 0.35 -0.85
+114 -0.25 0.45 -0.85
+115 -0.15 0.45 -0.85
+116 -0.05 0.45 -0.85
+110 0.05 0.35 -0.85
+111 0.15 0.35 -0.85
+112 0.25 0.35 -0.85
+117 0.05 0.45 -0.85
+118 0.15 0.45 -0.85
+119 0.25 0.45 -0.85
+113 0.35 0.35 -0.85
+262 -0.35 -0.65 -0.65
+120 -0.05 -0.65 -0.75
+260 -0.05 -0.75 -0.65
+263 -0.25 -0.65 -0.65
+264 -0.15 -0.65 -0.65
+265 -0.05 -0.65 -0.65
+121 0.05 -0.65 -0.75
+261 0.05 -0.75 -0.65
+266 0.05 -0.65 -0.65
+267 0.15 -0.65 -0.65
+268 0.25 -0.65 -0.65
+269 0.35 -0.65 -0.65
+292 -0.65 -0.35 -0.65
+122 -0.35 -0.55 -0.75
+130 -0.45 -0.45 -0.75
+131 -0.35 -0.45 -0.75
+140 -0.55 -0.35 -0.75
+141 -0.45 -0.35 -0.75
+142 -0.35 -0.35 -0.75
+270 -0.45 -0.55 -0.65
+271 -0.35 -0.55 -0.65
+280 -0.55 -0.45 -0.65
+281 -0.45 -0.45 -0.65
+282 -0.35 -0.45 -0.65
+293 -0.55 -0.35 -0.65
+294 -0.45 -0.35 -0.65
+295 -0.35 -0.35 -0.65
+123 -0.25 -0.55 -0.75
+124 -0.15 -0.55 -0.75
+125 -0.05 -0.55 -0.75
+132 -0.25 -0.45 -0.75
+133 -0.15 -0.45 -0.75
+134 -0.05 -0.45 -0.75
+143 -0.25 -0.35 -0.75
+144 -0.15 -0.35 -0.75
+145 -0.05 -0.35 -0.75
+272 -0.25 -0.55 -0.65
+273 -0.15 -0.55 -0.65
+274 -0.05 -0.55 -0.65
+283 -0.25 -0.45 -0.65
+284 -0.15 -0.45 -0.65
+285 -0.05 -0.45 -0.65
+296 -0.25 -0.35 -0.65
+297 -0.15 -0.35 -0.65
+298 -0.05 -0.35 -0.65
+126 0.05 -0.55 -0.75
+127 0.15 -0.55 -0.75
+128 0.25 -0.55 -0.75
+135 0.05 -0.45 -0.75
+136 0.15 -0.45 -0.75
+137 0.25 -0.45 -0.75
+146 0.05 -0.35 -0.75
+147 0.15 -0.35 -0.75
+148 0.25 -0.35 -0.75
+275 0.05 -0.55 -0.65
+276 0.15 -0.55 -0.65
+277 0.25 -0.55 -0.65
+286 0.05 -0.45 -0.65
+287 0.15 -0.45 -0.65
+288 0.25 -0.45 -0.65
+299 0.05 -0.35 -0.65
+300 0.15 -0.35 -0.65
+301 0.25 -0.35 -0.65
+129 0.35 -0.55 -0.75
+138 0.35 -0.45 -0.75
+139 0.45 -0.45 -0.75
+149 0.35 -0.35 -0.75
+150 0.45 -0.35 -0.75
+151 0.55 -0.35 -0.75
+278 0.35 -0.55 -0.65
+279 0.45 -0.55 -0.65
+289 0.35 -0.45 -0.65
+290 0.45 -0.45 -0.65
+291 0.55 -0.45 -0.65
+302 0.35 -0.35 -0.65
+303 0.45 -0.35 -0.65
+304 0.55 -0.35 -0.65
+305 0.65 -0.35 -0.65
+176 -0.65 -0.05 -0.75
+306 -0.65 -0.25 -0.65
+320 -0.65 -0.15 -0.65
+334 -0.75 -0.05 -0.65
+335 -0.65 -0.05 -0.65
+152 -0.55 -0.25 -0.75
+153 -0.45 -0.25 -0.75
+154 -0.35 -0.25 -0.75
+164 -0.55 -0.15 -0.75
+165 -0.45 -0.15 -0.75
+166 -0.35 -0.15 -0.75
+177 -0.55 -0.05 -0.75
+178 -0.45 -0.05 -0.75
+179 -0.35 -0.05 -0.75
+307 -0.55 -0.25 -0.65
+308 -0.45 -0.25 -0.65
+309 -0.35 -0.25 -0.65
+321 -0.55 -0.15 -0.65
+322 -0.45 -0.15 -0.65
+323 -0.35 -0.15 -0.65
+336 -0.55 -0.05 -0.65
+337 -0.45 -0.05 -0.65
+338 -0.35 -0.05 -0.65
+155 -0.25 -0.25 -0.75
+156 -0.15 -0.25 -0.75
+157 -0.05 -0.25 -0.75
+167 -0.25 -0.15 -0.75
+168 -0.15 -0.15 -0.75
+169 -0.05 -0.15 -0.75
+180 -0.25 -0.05 -0.75
+181 -0.15 -0.05 -0.75
+182 -0.05 -0.05 -0.75
+310 -0.25 -0.25 -0.65
+311 -0.15 -0.25 -0.65
+312 -0.05 -0.25 -0.65
+324 -0.25 -0.15 -0.65
+325 -0.15 -0.15 -0.65
+326 -0.05 -0.15 -0.65
+339 -0.25 -0.05 -0.65
+340 -0.15 -0.05 -0.65
+341 -0.05 -0.05 -0.65
+158 0.05 -0.25 -0.75
+159 0.15 -0.25 -0.75
+160 0.25 -0.25 -0.75
+170 0.05 -0.15 -0.75
+171 0.15 -0.15 -0.75
+172 0.25 -0.15 -0.75
+183 0.05 -0.05 -0.75
+184 0.15 -0.05 -0.75
+185 0.25 -0.05 -0.75
+313 0.05 -0.25 -0.65
+314 0.15 -0.25 -0.65
+315 0.25 -0.25 -0.65
+327 0.05 -0.15 -0.65
+328 0.15 -0.15 -0.65
+329 0.25 -0.15 -0.65
+342 0.05 -0.05 -0.65
+343 0.15 -0.05 -0.65
+344 0.25 -0.05 -0.65
+161 0.35 -0.25 -0.75
+162 0.45 -0.25 -0.75
+163 0.55 -0.25 -0.75
+173 0.35 -0.15 -0.75
+174 0.45 -0.15 -0.75
+175 0.55 -0.15 -0.75
+186 0.35 -0.05 -0.75
+187 0.45 -0.05 -0.75
+188 0.55 -0.05 -0.75
+316 0.35 -0.25 -0.65
+317 0.45 -0.25 -0.65
+318 0.55 -0.25 -0.65
+330 0.35 -0.15 -0.65
+331 0.45 -0.15 -0.65
+332 0.55 -0.15 -0.65
+345 0.35 -0.05 -0.65
+346 0.45 -0.05 -0.65
+347 0.55 -0.05 -0.65
+189 0.65 -0.05 -0.75
+319 0.65 -0.25 -0.65
+333 0.65 -0.15 -0.65
+348 0.65 -0.05 -0.65
+349 0.75 -0.05 -0.65
+190 -0.65 0.05 -0.75
+350 -0.75 0.05 -0.65
+351 -0.65 0.05 -0.65
+366 -0.65 0.15 -0.65
+380 -0.65 0.25 -0.65
+191 -0.55 0.05 -0.75
+192 -0.45 0.05 -0.75
+193 -0.35 0.05 -0.75
+204 -0.55 0.15 -0.75
+205 -0.45 0.15 -0.75
+206 -0.35 0.15 -0.75
+216 -0.55 0.25 -0.75
+217 -0.45 0.25 -0.75
+218 -0.35 0.25 -0.75
+352 -0.55 0.05 -0.65
+353 -0.45 0.05 -0.65
+354 -0.35 0.05 -0.65
+367 -0.55 0.15 -0.65
+368 -0.45 0.15 -0.65
+369 -0.35 0.15 -0.65
+381 -0.55 0.25 -0.65
+382 -0.45 0.25 -0.65
+383 -0.35 0.25 -0.65
+194 -0.25 0.05 -0.75
+195 -0.15 0.05 -0.75
+196 -0.05 0.05 -0.75
+207 -0.25 0.15 -0.75
+208 -0.15 0.15 -0.75
+209 -0.05 0.15 -0.75
+219 -0.25 0.25 -0.75
+220 -0.15 0.25 -0.75
+221 -0.05 0.25 -0.75
+355 -0.25 0.05 -0.65
+356 -0.15 0.05 -0.65
+357 -0.05 0.05 -0.65
+370 -0.25 0.15 -0.65
+371 -0.15 0.15 -0.65
+372 -0.05 0.15 -0.65
+384 -0.25 0.25 -0.65
+385 -0.15 0.25 -0.65
+386 -0.05 0.25 -0.65
+197 0.05 0.05 -0.75
+198 0.15 0.05 -0.75
+199 0.25 0.05 -0.75
+210 0.05 0.15 -0.75
+211 0.15 0.15 -0.75
+212 0.25 0.15 -0.75
+222 0.05 0.25 -0.75
+223 0.15 0.25 -0.75
+224 0.25 0.25 -0.75
+358 0.05 0.05 -0.65
+359 0.15 0.05 -0.65
+360 0.25 0.05 -0.65
+373 0.05 0.15 -0.65
+374 0.15 0.15 -0.65
+375 0.25 0.15 -0.65
+387 0.05 0.25 -0.65
+388 0.15 0.25 -0.65
+389 0.25 0.25 -0.65
+200 0.35 0.05 -0.75
+201 0.45 0.05 -0.75
+202 0.55 0.05 -0.75
+213 0.35 0.15 -0.75
+214 0.45 0.15 -0.75
+215 0.55 0.15 -0.75
+225 0.35 0.25 -0.75
+226 0.45 0.25 -0.75
+227 0.55 0.25 -0.75
+361 0.35 0.05 -0.65
+362 0.45 0.05 -0.65
+363 0.55 0.05 -0.65
+376 0.35 0.15 -0.65
+377 0.45 0.15 -0.65
+378 0.55 0.15 -0.65
+390 0.35 0.25 -0.65
+391 0.45 0.25 -0.65
+392 0.55 0.25 -0.65
+203 0.65 0.05 -0.75
+364 0.65 0.05 -0.65
+365 0.75 0.05 -0.65
+379 0.65 0.15 -0.65
+393 0.65 0.25 -0.65
+394 -0.65 0.35 -0.65
+228 -0.55 0.35 -0.75
+229 -0.45 0.35 -0.75
+230 -0.35 0.35 -0.75
+240 -0.45 0.45 -0.75
+241 -0.35 0.45 -0.75
+250 -0.35 0.55 -0.75
+395 -0.55 0.35 -0.65
+396 -0.45 0.35 -0.65
+397 -0.35 0.35 -0.65
+408 -0.55 0.45 -0.65
+409 -0.45 0.45 -0.65
+410 -0.35 0.45 -0.65
+420 -0.45 0.55 -0.65
+421 -0.35 0.55 -0.65
+231 -0.25 0.35 -0.75
+232 -0.15 0.35 -0.75
+233 -0.05 0.35 -0.75
+242 -0.25 0.45 -0.75
+243 -0.15 0.45 -0.75
+244 -0.05 0.45 -0.75
+251 -0.25 0.55 -0.75
+252 -0.15 0.55 -0.75
+253 -0.05 0.55 -0.75
+398 -0.25 0.35 -0.65
+399 -0.15 0.35 -0.65
+400 -0.05 0.35 -0.65
+411 -0.25 0.45 -0.65
+412 -0.15 0.45 -0.65
+413 -0.05 0.45 -0.65
+422 -0.25 0.55 -0.65
+423 -0.15 0.55 -0.65
+424 -0.05 0.55 -0.65
+234 0.05 0.35 -0.75
+235 0.15 0.35 -0.75
+236 0.25 0.35 -0.75
+245 0.05 0.45 -0.75
+246 0.15 0.45 -0.75
+247 0.25 0.45 -0.75
+254 0.05 0.55 -0.75
+255 0.15 0.55 -0.75
+256 0.25 0.55 -0.75
+401 0.05 0.35 -0.65
+402 0.15 0.35 -0.65
+403 0.25 0.35 -0.65
+414 0.05 0.45 -0.65
+415 0.15 0.45 -0.65
+416 0.25 0.45 -0.65
+425 0.05 0.55 -0.65
+426 0.15 0.55 -0.65
+427 0.25 0.55 -0.65
+237 0.35 0.35 -0.75
+238 0.45 0.35 -0.75
+239 0.55 0.35 -0.75
+248 0.35 0.45 -0.75
+249 0.45 0.45 -0.75
+257 0.35 0.55 -0.75
+404 0.35 0.35 -0.65
+405 0.45 0.35 -0.65
+406 0.55 0.35 -0.65
+417 0.35 0.45 -0.65
+418 0.45 0.45 -0.65
+419 0.55 0.45 -0.65
+428 0.35 0.55 -0.65
+429 0.45 0.55 -0.65
+407 0.65 0.35 -0.65
+430 -0.35 0.65 -0.65
+258 -0.05 0.65 -0.75
+431 -0.25 0.65 -0.65
+432 -0.15 0.65 -0.65
+433 -0.05 0.65 -0.65
+438 -0.05 0.75 -0.65
+259 0.05 0.65 -0.75
+434 0.05 0.65 -0.65
+435 0.15 0.65 -0.65
+436 0.25 0.65 -0.65
+439 0.05 0.75 -0.65
+437 0.35 0.65 -0.65
+912 -0.35 -0.85 -0.35
+656 -0.25 -0.85 -0.45
+657 -0.15 -0.85 -0.45
+658 -0.05 -0.85 -0.45
+913 -0.25 -0.85 -0.35
+914 -0.15 -0.85 -0.35
+915 -0.05 -0.85 -0.35
+659 0.05 -0.85 -0.45
+660 0.15 -0.85 -0.45
+661 0.25 -0.85 -0.45
+916 0.05 -0.85 -0.35
+917 0.15 -0.85 -0.35
+918 0.25 -0.85 -0.35
+919 0.35 -0.85 -0.35
+932 -0.65 -0.65 -0.35
+440 -0.35 -0.75 -0.55
+448 -0.45 -0.65 -0.55
+449 -0.35 -0.65 -0.55
+662 -0.45 -0.75 -0.45
+663 -0.35 -0.75 -0.45
+672 -0.55 -0.65 -0.45
+673 -0.45 -0.65 -0.45
+674 -0.35 -0.65 -0.45
+920 -0.55 -0.75 -0.35
+921 -0.45 -0.75 -0.35
+922 -0.35 -0.75 -0.35
+933 -0.55 -0.65 -0.35
+934 -0.45 -0.65 -0.35
+935 -0.35 -0.65 -0.35
+441 -0.25 -0.75 -0.55
+442 -0.15 -0.75 -0.55
+443 -0.05 -0.75 -0.55
+450 -0.25 -0.65 -0.55
+451 -0.15 -0.65 -0.55
+452 -0.05 -0.65 -0.55
+664 -0.25 -0.75 -0.45
+665 -0.15 -0.75 -0.45
+666 -0.05 -0.75 -0.45
+675 -0.25 -0.65 -0.45
+676 -0.15 -0.65 -0.45
+677 -0.05 -0.65 -0.45
+923 -0.25 -0.75 -0.35
+924 -0.15 -0.75 -0.35
+925 -0.05 -0.75 -0.35
+936 -0.25 -0.65 -0.35
+937 -0.15 -0.65 -0.35
+938 -0.05 -0.65 -0.35
+444 0.05 -0.75 -0.55
+445 0.15 -0.75 -0.55
+446 0.25 -0.75 -0.55
+453 0.05 -0.65 -0.55
+454 0.15 -0.65 -0.55
+455 0.25 -0.65 -0.55
+667 0.05 -0.75 -0.45
+668 0.15 -0.75 -0.45
+669 0.25 -0.75 -0.45
+678 0.05 -0.65 -0.45
+679 0.15 -0.65 -0.45
+680 0.25 -0.65 -0.45
+926 0.05 -0.75 -0.35
+927 0.15 -0.75 -0.35
+928 0.25 -0.75 -0.35
+939 0.05 -0.65 -0.35
+940 0.15 -0.65 -0.35
+941 0.25 -0.65 -0.35
+447 0.35 -0.75 -0.55
+456 0.35 -0.65 -0.55
+457 0.45 -0.65 -0.55
+670 0.35 -0.75 -0.45
+671 0.45 -0.75 -0.45
+681 0.35 -0.65 -0.45
+682 0.45 -0.65 -0.45
+683 0.55 -0.65 -0.45
+929 0.35 -0.75 -0.35
+930 0.45 -0.75 -0.35
+931 0.55 -0.75 -0.35
+942 0.35 -0.65 -0.35
+943 0.45 -0.65 -0.35
+944 0.55 -0.65 -0.35
+945 0.65 -0.65 -0.35
+978 -0.85 -0.35 -0.35
+470 -0.65 -0.45 -0.55
+484 -0.75 -0.35 -0.55
+485 -0.65 -0.35 -0.55
+684 -0.65 -0.55 -0.45
+698 -0.75 -0.45 -0.45
+699 -0.65 -0.45 -0.45
+714 -0.75 -0.35 -0.45
+715 -0.65 -0.35 -0.45
+946 -0.75 -0.55 -0.35
+947 -0.65 -0.55 -0.35
+962 -0.75 -0.45 -0.35
+963 -0.65 -0.45 -0.35
+979 -0.75 -0.35 -0.35
+980 -0.65 -0.35 -0.35
+458 -0.55 -0.55 -0.55
+459 -0.45 -0.55 -0.55
+460 -0.35 -0.55 -0.55
+471 -0.55 -0.45 -0.55
+472 -0.45 -0.45 -0.55
+473 -0.35 -0.45 -0.55
+486 -0.55 -0.35 -0.55
+487 -0.45 -0.35 -0.55
+488 -0.35 -0.35 -0.55
+685 -0.55 -0.55 -0.45
+686 -0.45 -0.55 -0.45
+687 -0.35 -0.55 -0.45
+700 -0.55 -0.45 -0.45
+701 -0.45 -0.45 -0.45
+702 -0.35 -0.45 -0.45
+716 -0.55 -0.35 -0.45
+717 -0.45 -0.35 -0.45
+718 -0.35 -0.35 -0.45
+948 -0.55 -0.55 -0.35
+949 -0.45 -0.55 -0.35
+950 -0.35 -0.55 -0.35
+964 -0.55 -0.45 -0.35
+965 -0.45 -0.45 -0.35
+966 -0.35 -0.45 -0.35
+981 -0.55 -0.35 -0.35
+982 -0.45 -0.35 -0.35
+983 -0.35 -0.35 -0.35
+461 -0.25 -0.55 -0.55
+462 -0.15 -0.55 -0.55
+463 -0.05 -0.55 -0.55
+474 -0.25 -0.45 -0.55
+475 -0.15 -0.45 -0.55
+476 -0.05 -0.45 -0.55
+489 -0.25 -0.35 -0.55
+490 -0.15 -0.35 -0.55
+491 -0.05 -0.35 -0.55
+688 -0.25 -0.55 -0.45
+689 -0.15 -0.55 -0.45
+690 -0.05 -0.55 -0.45
+703 -0.25 -0.45 -0.45
+704 -0.15 -0.45 -0.45
+705 -0.05 -0.45 -0.45
+719 -0.25 -0.35 -0.45
+720 -0.15 -0.35 -0.45
+721 -0.05 -0.35 -0.45
+951 -0.25 -0.55 -0.35
+952 -0.15 -0.55 -0.35
+953 -0.05 -0.55 -0.35
+967 -0.25 -0.45 -0.35
+968 -0.15 -0.45 -0.35
+969 -0.05 -0.45 -0.35
+984 -0.25 -0.35 -0.35
+985 -0.15 -0.35 -0.35
+986 -0.05 -0.35 -0.35
+464 0.05 -0.55 -0.55
+465 0.15 -0.55 -0.55
+466 0.25 -0.55 -0.55
+477 0.05 -0.45 -0.55
+478 0.15 -0.45 -0.55
+479 0.25 -0.45 -0.55
+492 0.05 -0.35 -0.55
+493 0.15 -0.35 -0.55
+494 0.25 -0.35 -0.55
+691 0.05 -0.55 -0.45
+692 0.15 -0.55 -0.45
+693 0.25 -0.55 -0.45
+706 0.05 -0.45 -0.45
+707 0.15 -0.45 -0.45
+708 0.25 -0.45 -0.45
+722 0.05 -0.35 -0.45
+723 0.15 -0.35 -0.45
+724 0.25 -0.35 -0.45
+954 0.05 -0.55 -0.35
+955 0.15 -0.55 -0.35
+956 0.25 -0.55 -0.35
+970 0.05 -0.45 -0.35
+971 0.15 -0.45 -0.35
+972 0.25 -0.45 -0.35
+987 0.05 -0.35 -0.35
+988 0.15 -0.35 -0.35
+989 0.25 -0.35 -0.35
+467 0.35 -0.55 -0.55
+468 0.45 -0.55 -0.55
+469 0.55 -0.55 -0.55
+480 0.35 -0.45 -0.55
+481 0.45 -0.45 -0.55
+482 0.55 -0.45 -0.55
+495 0.35 -0.35 -0.55
+496 0.45 -0.35 -0.55
+497 0.55 -0.35 -0.55
+694 0.35 -0.55 -0.45
+695 0.45 -0.55 -0.45
+696 0.55 -0.55 -0.45
+709 0.35 -0.45 -0.45
+710 0.45 -0.45 -0.45
+711 0.55 -0.45 -0.45
+725 0.35 -0.35 -0.45
+726 0.45 -0.35 -0.45
+727 0.55 -0.35 -0.45
+957 0.35 -0.55 -0.35
+958 0.45 -0.55 -0.35
+959 0.55 -0.55 -0.35
+973 0.35 -0.45 -0.35
+974 0.45 -0.45 -0.35
+975 0.55 -0.45 -0.35
+990 0.35 -0.35 -0.35
+991 0.45 -0.35 -0.35
+992 0.55 -0.35 -0.35
+483 0.65 -0.45 -0.55
+498 0.65 -0.35 -0.55
+499 0.75 -0.35 -0.55
+697 0.65 -0.55 -0.45
+712 0.65 -0.45 -0.45
+713 0.75 -0.45 -0.45
+728 0.65 -0.35 -0.45
+729 0.75 -0.35 -0.45
+960 0.65 -0.55 -0.35
+961 0.75 -0.55 -0.35
+976 0.65 -0.45 -0.35
+977 0.75 -0.45 -0.35
+993 0.65 -0.35 -0.35
+994 0.75 -0.35 -0.35
+995 0.85 -0.35 -0.35
+730 -0.85 -0.25 -0.45
+748 -0.85 -0.15 -0.45
+766 -0.85 -0.05 -0.45
+996 -0.85 -0.25 -0.35
+1014 -0.85 -0.15 -0.35
+1032 -0.85 -0.05 -0.35
+500 -0.75 -0.25 -0.55
+501 -0.65 -0.25 -0.55
+516 -0.75 -0.15 -0.55
+517 -0.65 -0.15 -0.55
+532 -0.75 -0.05 -0.55
+533 -0.65 -0.05 -0.55
+731 -0.75 -0.25 -0.45
+732 -0.65 -0.25 -0.45
+749 -0.75 -0.15 -0.45
+750 -0.65 -0.15 -0.45
+767 -0.75 -0.05 -0.45
+768 -0.65 -0.05 -0.45
+997 -0.75 -0.25 -0.35
+998 -0.65 -0.25 -0.35
+1015 -0.75 -0.15 -0.35
+1016 -0.65 -0.15 -0.35
+1033 -0.75 -0.05 -0.35
+1034 -0.65 -0.05 -0.35
+502 -0.55 -0.25 -0.55
+503 -0.45 -0.25 -0.55
+504 -0.35 -0.25 -0.55
+518 -0.55 -0.15 -0.55
+519 -0.45 -0.15 -0.55
+520 -0.35 -0.15 -0.55
+534 -0.55 -0.05 -0.55
+535 -0.45 -0.05 -0.55
+536 -0.35 -0.05 -0.55
+733 -0.55 -0.25 -0.45
+734 -0.45 -0.25 -0.45
+735 -0.35 -0.25 -0.45
+751 -0.55 -0.15 -0.45
+752 -0.45 -0.15 -0.45
+753 -0.35 -0.15 -0.45
+769 -0.55 -0.05 -0.45
+770 -0.45 -0.05 -0.45
+771 -0.35 -0.05 -0.45
+999 -0.55 -0.25 -0.35
+1000 -0.45 -0.25 -0.35
+1001 -0.35 -0.25 -0.35
+1017 -0.55 -0.15 -0.35
+1018 -0.45 -0.15 -0.35
+1019 -0.35 -0.15 -0.35
+1035 -0.55 -0.05 -0.35
+1036 -0.45 -0.05 -0.35
+1037 -0.35 -0.05 -0.35
+505 -0.25 -0.25 -0.55
+506 -0.15 -0.25 -0.55
+507 -0.05 -0.25 -0.55
+521 -0.25 -0.15 -0.55
+522 -0.15 -0.15 -0.55
+523 -0.05 -0.15 -0.55
+537 -0.25 -0.05 -0.55
+538 -0.15 -0.05 -0.55
+539 -0.05 -0.05 -0.55
+736 -0.25 -0.25 -0.45
+737 -0.15 -0.25 -0.45
+738 -0.05 -0.25 -0.45
+754 -0.25 -0.15 -0.45
+755 -0.15 -0.15 -0.45
+756 -0.05 -0.15 -0.45
+772 -0.25 -0.05 -0.45
+773 -0.15 -0.05 -0.45
+774 -0.05 -0.05 -0.45
+1002 -0.25 -0.25 -0.35
+1003 -0.15 -0.25 -0.35
+1004 -0.05 -0.25 -0.35
+1020 -0.25 -0.15 -0.35
+1021 -0.15 -0.15 -0.35
+1022 -0.05 -0.15 -0.35
+1038 -0.25 -0.05 -0.35
+1039 -0.15 -0.05 -0.35
+1040 -0.05 -0.05 -0.35
+508 0.05 -0.25 -0.55
+509 0.15 -0.25 -0.55
+510 0.25 -0.25 -0.55
+524 0.05 -0.15 -0.55
+525 0.15 -0.15 -0.55
+526 0.25 -0.15 -0.55
+540 0.05 -0.05 -0.55
+541 0.15 -0.05 -0.55
+542 0.25 -0.05 -0.55
+739 0.05 -0.25 -0.45
+740 0.15 -0.25 -0.45
+741 0.25 -0.25 -0.45
+757 0.05 -0.15 -0.45
+758 0.15 -0.15 -0.45
+759 0.25 -0.15 -0.45
+775 0.05 -0.05 -0.45
+776 0.15 -0.05 -0.45
+777 0.25 -0.05 -0.45
+1005 0.05 -0.25 -0.35
+1006 0.15 -0.25 -0.35
+1007 0.25 -0.25 -0.35
+1023 0.05 -0.15 -0.35
+1024 0.15 -0.15 -0.35
+1025 0.25 -0.15 -0.35
+1041 0.05 -0.05 -0.35
+1042 0.15 -0.05 -0.35
+1043 0.25 -0.05 -0.35
+511 0.35 -0.25 -0.55
+512 0.45 -0.25 -0.55
+513 0.55 -0.25 -0.55
+527 0.35 -0.15 -0.55
+528 0.45 -0.15 -0.55
+529 0.55 -0.15 -0.55
+543 0.35 -0.05 -0.55
+544 0.45 -0.05 -0.55
+545 0.55 -0.05 -0.55
+742 0.35 -0.25 -0.45
+743 0.45 -0.25 -0.45
+744 0.55 -0.25 -0.45
+760 0.35 -0.15 -0.45
+761 0.45 -0.15 -0.45
+762 0.55 -0.15 -0.45
+778 0.35 -0.05 -0.45
+779 0.45 -0.05 -0.45
+780 0.55 -0.05 -0.45
+1008 0.35 -0.25 -0.35
+1009 0.45 -0.25 -0.35
+1010 0.55 -0.25 -0.35
+1026 0.35 -0.15 -0.35
+1027 0.45 -0.15 -0.35
+1028 0.55 -0.15 -0.35
+1044 0.35 -0.05 -0.35
+1045 0.45 -0.05 -0.35
+1046 0.55 -0.05 -0.35
+514 0.65 -0.25 -0.55
+515 0.75 -0.25 -0.55
+530 0.65 -0.15 -0.55
+531 0.75 -0.15 -0.55
+546 0.65 -0.05 -0.55
+547 0.75 -0.05 -0.55
+745 0.65 -0.25 -0.45
+746 0.75 -0.25 -0.45
+763 0.65 -0.15 -0.45
+764 0.75 -0.15 -0.45
+781 0.65 -0.05 -0.45
+782 0.75 -0.05 -0.45
+1011 0.65 -0.25 -0.35
+1012 0.75 -0.25 -0.35
+1029 0.65 -0.15 -0.35
+1030 0.75 -0.15 -0.35
+1047 0.65 -0.05 -0.35
+1048 0.75 -0.05 -0.35
+747 0.85 -0.25 -0.45
+765 0.85 -0.15 -0.45
+783 0.85 -0.05 -0.45
+1013 0.85 -0.25 -0.35
+1031 0.85 -0.15 -0.35
+1049 0.85 -0.05 -0.35
+784 -0.85 0.05 -0.45
+802 -0.85 0.15 -0.45
+820 -0.85 0.25 -0.45
+1050 -0.85 0.05 -0.35
+1068 -0.85 0.15 -0.35
+1086 -0.85 0.25 -0.35
+548 -0.75 0.05 -0.55
+549 -0.65 0.05 -0.55
+564 -0.75 0.15 -0.55
+565 -0.65 0.15 -0.55
+580 -0.75 0.25 -0.55
+581 -0.65 0.25 -0.55
+785 -0.75 0.05 -0.45
+786 -0.65 0.05 -0.45
+803 -0.75 0.15 -0.45
+804 -0.65 0.15 -0.45
+821 -0.75 0.25 -0.45
+822 -0.65 0.25 -0.45
+1051 -0.75 0.05 -0.35
+1052 -0.65 0.05 -0.35
+1069 -0.75 0.15 -0.35
+1070 -0.65 0.15 -0.35
+1087 -0.75 0.25 -0.35
+1088 -0.65 0.25 -0.35
+550 -0.55 0.05 -0.55
+551 -0.45 0.05 -0.55
+552 -0.35 0.05 -0.55
+566 -0.55 0.15 -0.55
+567 -0.45 0.15 -0.55
+568 -0.35 0.15 -0.55
+582 -0.55 0.25 -0.55
+583 -0.45 0.25 -0.55
+584 -0.35 0.25 -0.55
+787 -0.55 0.05 -0.45
+788 -0.45 0.05 -0.45
+789 -0.35 0.05 -0.45
+805 -0.55 0.15 -0.45
+806 -0.45 0.15 -0.45
+807 -0.35 0.15 -0.45
+823 -0.55 0.25 -0.45
+824 -0.45 0.25 -0.45
+825 -0.35 0.25 -0.45
+1053 -0.55 0.05 -0.35
+1054 -0.45 0.05 -0.35
+1055 -0.35 0.05 -0.35
+1071 -0.55 0.15 -0.35
+1072 -0.45 0.15 -0.35
+1073 -0.35 0.15 -0.35
+1089 -0.55 0.25 -0.35
+1090 -0.45 0.25 -0.35
+1091 -0.35 0.25 -0.35
+553 -0.25 0.05 -0.55
+554 -0.15 0.05 -0.55
+555 -0.05 0.05 -0.55
+569 -0.25 0.15 -0.55
+570 -0.15 0.15 -0.55
+571 -0.05 0.15 -0.55
+585 -0.25 0.25 -0.55
+586 -0.15 0.25 -0.55
+587 -0.05 0.25 -0.55
+790 -0.25 0.05 -0.45
+791 -0.15 0.05 -0.45
+792 -0.05 0.05 -0.45
+808 -0.25 0.15 -0.45
+809 -0.15 0.15 -0.45
+810 -0.05 0.15 -0.45
+826 -0.25 0.25 -0.45
+827 -0.15 0.25 -0.45
+828 -0.05 0.25 -0.45
+1056 -0.25 0.05 -0.35
+1057 -0.15 0.05 -0.35
+1058 -0.05 0.05 -0.35
+1074 -0.25 0.15 -0.35
+1075 -0.15 0.15 -0.35
+1076 -0.05 0.15 -0.35
+1092 -0.25 0.25 -0.35
+1093 -0.15 0.25 -0.35
+1094 -0.05 0.25 -0.35
+556 0.05 0.05 -0.55
+557 0.15 0.05 -0.55
+558 0.25 0.05 -0.55
+572 0.05 0.15 -0.55
+573 0.15 0.15 -0.55
+574 0.25 0.15 -0.55
+588 0.05 0.25 -0.55
+589 0.15 0.25 -0.55
+590 0.25 0.25 -0.55
+793 0.05 0.05 -0.45
+794 0.15 0.05 -0.45
+795 0.25 0.05 -0.45
+811 0.05 0.15 -0.45
+812 0.15 0.15 -0.45
+813 0.25 0.15 -0.45
+829 0.05 0.25 -0.45
+830 0.15 0.25 -0.45
+831 0.25 0.25 -0.45
+1059 0.05 0.05 -0.35
+1060 0.15 0.05 -0.35
+1061 0.25 0.05 -0.35
+1077 0.05 0.15 -0.35
+1078 0.15 0.15 -0.35
+1079 0.25 0.15 -0.35
+1095 0.05 0.25 -0.35
+1096 0.15 0.25 -0.35
+1097 0.25 0.25 -0.35
+559 0.35 0.05 -0.55
+560 0.45 0.05 -0.55
+561 0.55 0.05 -0.55
+575 0.35 0.15 -0.55
+576 0.45 0.15 -0.55
+577 0.55 0.15 -0.55
+591 0.35 0.25 -0.55
+592 0.45 0.25 -0.55
+593 0.55 0.25 -0.55
+796 0.35 0.05 -0.45
+797 0.45 0.05 -0.45
+798 0.55 0.05 -0.45
+814 0.35 0.15 -0.45
+815 0.45 0.15 -0.45
+816 0.55 0.15 -0.45
+832 0.35 0.25 -0.45
+833 0.45 0.25 -0.45
+834 0.55 0.25 -0.45
+1062 0.35 0.05 -0.35
+1063 0.45 0.05 -0.35
+1064 0.55 0.05 -0.35
+1080 0.35 0.15 -0.35
+1081 0.45 0.15 -0.35
+1082 0.55 0.15 -0.35
+1098 0.35 0.25 -0.35
+1099 0.45 0.25 -0.35
+1100 0.55 0.25 -0.35
+562 0.65 0.05 -0.55
+563 0.75 0.05 -0.55
+578 0.65 0.15 -0.55
+579 0.75 0.15 -0.55
+594 0.65 0.25 -0.55
+595 0.75 0.25 -0.55
+799 0.65 0.05 -0.45
+800 0.75 0.05 -0.45
+817 0.65 0.15 -0.45
+818 0.75 0.15 -0.45
+835 0.65 0.25 -0.45
+836 0.75 0.25 -0.45
+1065 0.65 0.05 -0.35
+1066 0.75 0.05 -0.35
+1083 0.65 0.15 -0.35
+1084 0.75 0.15 -0.35
+1101 0.65 0.25 -0.35
+1102 0.75 0.25 -0.35
+801 0.85 0.05 -0.45
+819 0.85 0.15 -0.45
+837 0.85 0.25 -0.45
+1067 0.85 0.05 -0.35
+1085 0.85 0.15 -0.35
+1103 0.85 0.25 -0.35
+1104 -0.85 0.35 -0.35
+596 -0.75 0.35 -0.55
+597 -0.65 0.35 -0.55
+612 -0.65 0.45 -0.55
+838 -0.75 0.35 -0.45
+839 -0.65 0.35 -0.45
+854 -0.75 0.45 -0.45
+855 -0.65 0.45 -0.45
+870 -0.65 0.55 -0.45
+1105 -0.75 0.35 -0.35
+1106 -0.65 0.35 -0.35
+1122 -0.75 0.45 -0.35
+1123 -0.65 0.45 -0.35
+1138 -0.75 0.55 -0.35
+1139 -0.65 0.55 -0.35
+598 -0.55 0.35 -0.55
+599 -0.45 0.35 -0.55
+600 -0.35 0.35 -0.55
+613 -0.55 0.45 -0.55
+614 -0.45 0.45 -0.55
+615 -0.35 0.45 -0.55
+626 -0.55 0.55 -0.55
+627 -0.45 0.55 -0.55
+628 -0.35 0.55 -0.55
+840 -0.55 0.35 -0.45
+841 -0.45 0.35 -0.45
+842 -0.35 0.35 -0.45
+856 -0.55 0.45 -0.45
+857 -0.45 0.45 -0.45
+858 -0.35 0.45 -0.45
+871 -0.55 0.55 -0.45
+872 -0.45 0.55 -0.45
+873 -0.35 0.55 -0.45
+1107 -0.55 0.35 -0.35
+1108 -0.45 0.35 -0.35
+1109 -0.35 0.35 -0.35
+1124 -0.55 0.45 -0.35
+1125 -0.45 0.45 -0.35
+1126 -0.35 0.45 -0.35
+1140 -0.55 0.55 -0.35
+1141 -0.45 0.55 -0.35
+1142 -0.35 0.55 -0.35
+601 -0.25 0.35 -0.55
+602 -0.15 0.35 -0.55
+603 -0.05 0.35 -0.55
+616 -0.25 0.45 -0.55
+617 -0.15 0.45 -0.55
+618 -0.05 0.45 -0.55
+629 -0.25 0.55 -0.55
+630 -0.15 0.55 -0.55
+631 -0.05 0.55 -0.55
+843 -0.25 0.35 -0.45
+844 -0.15 0.35 -0.45
+845 -0.05 0.35 -0.45
+859 -0.25 0.45 -0.45
+860 -0.15 0.45 -0.45
+861 -0.05 0.45 -0.45
+874 -0.25 0.55 -0.45
+875 -0.15 0.55 -0.45
+876 -0.05 0.55 -0.45
+1110 -0.25 0.35 -0.35
+1111 -0.15 0.35 -0.35
+1112 -0.05 0.35 -0.35
+1127 -0.25 0.45 -0.35
+1128 -0.15 0.45 -0.35
+1129 -0.05 0.45 -0.35
+1143 -0.25 0.55 -0.35
+1144 -0.15 0.55 -0.35
+1145 -0.05 0.55 -0.35
+604 0.05 0.35 -0.55
+605 0.15 0.35 -0.55
+606 0.25 0.35 -0.55
+619 0.05 0.45 -0.55
+620 0.15 0.45 -0.55
+621 0.25 0.45 -0.55
+632 0.05 0.55 -0.55
+633 0.15 0.55 -0.55
+634 0.25 0.55 -0.55
+846 0.05 0.35 -0.45
+847 0.15 0.35 -0.45
+848 0.25 0.35 -0.45
+862 0.05 0.45 -0.45
+863 0.15 0.45 -0.45
+864 0.25 0.45 -0.45
+877 0.05 0.55 -0.45
+878 0.15 0.55 -0.45
+879 0.25 0.55 -0.45
+1113 0.05 0.35 -0.35
+1114 0.15 0.35 -0.35
+1115 0.25 0.35 -0.35
+1130 0.05 0.45 -0.35
+1131 0.15 0.45 -0.35
+1132 0.25 0.45 -0.35
+1146 0.05 0.55 -0.35
+1147 0.15 0.55 -0.35
+1148 0.25 0.55 -0.35
+607 0.35 0.35 -0.55
+608 0.45 0.35 -0.55
+609 0.55 0.35 -0.55
+622 0.35 0.45 -0.55
+623 0.45 0.45 -0.55
+624 0.55 0.45 -0.55
+635 0.35 0.55 -0.55
+636 0.45 0.55 -0.55
+637 0.55 0.55 -0.55
+849 0.35 0.35 -0.45
+850 0.45 0.35 -0.45
+851 0.55 0.35 -0.45
+865 0.35 0.45 -0.45
+866 0.45 0.45 -0.45
+867 0.55 0.45 -0.45
+880 0.35 0.55 -0.45
+881 0.45 0.55 -0.45
+882 0.55 0.55 -0.45
+1116 0.35 0.35 -0.35
+1117 0.45 0.35 -0.35
+1118 0.55 0.35 -0.35
+1133 0.35 0.45 -0.35
+1134 0.45 0.45 -0.35
+1135 0.55 0.45 -0.35
+1149 0.35 0.55 -0.35
+1150 0.45 0.55 -0.35
+1151 0.55 0.55 -0.35
+610 0.65 0.35 -0.55
+611 0.75 0.35 -0.55
+625 0.65 0.45 -0.55
+852 0.65 0.35 -0.45
+853 0.75 0.35 -0.45
+868 0.65 0.45 -0.45
+869 0.75 0.45 -0.45
+883 0.65 0.55 -0.45
+1119 0.65 0.35 -0.35
+1120 0.75 0.35 -0.35
+1136 0.65 0.45 -0.35
+1137 0.75 0.45 -0.35
+1152 0.65 0.55 -0.35
+1153 0.75 0.55 -0.35
+1121 0.85 0.35 -0.35
+1154 -0.65 0.65 -0.35
+638 -0.45 0.65 -0.55
+639 -0.35 0.65 -0.55
+648 -0.35 0.75 -0.55
+884 -0.55 0.65 -0.45
+885 -0.45 0.65 -0.45
+886 -0.35 0.65 -0.45
+896 -0.45 0.75 -0.45
+897 -0.35 0.75 -0.45
+1155 -0.55 0.65 -0.35
+1156 -0.45 0.65 -0.35
+1157 -0.35 0.65 -0.35
+1168 -0.55 0.75 -0.35
+1169 -0.45 0.75 -0.35
+1170 -0.35 0.75 -0.35
+640 -0.25 0.65 -0.55
+641 -0.15 0.65 -0.55
+642 -0.05 0.65 -0.55
+649 -0.25 0.75 -0.55
+650 -0.15 0.75 -0.55
+651 -0.05 0.75 -0.55
+887 -0.25 0.65 -0.45
+888 -0.15 0.65 -0.45
+889 -0.05 0.65 -0.45
+898 -0.25 0.75 -0.45
+899 -0.15 0.75 -0.45
+900 -0.05 0.75 -0.45
+1158 -0.25 0.65 -0.35
+1159 -0.15 0.65 -0.35
+1160 -0.05 0.65 -0.35
+1171 -0.25 0.75 -0.35
+1172 -0.15 0.75 -0.35
+1173 -0.05 0.75 -0.35
+643 0.05 0.65 -0.55
+644 0.15 0.65 -0.55
+645 0.25 0.65 -0.55
+652 0.05 0.75 -0.55
+653 0.15 0.75 -0.55
+654 0.25 0.75 -0.55
+890 0.05 0.65 -0.45
+891 0.15 0.65 -0.45
+892 0.25 0.65 -0.45
+901 0.05 0.75 -0.45
+902 0.15 0.75 -0.45
+903 0.25 0.75 -0.45
+1161 0.05 0.65 -0.35
+1162 0.15 0.65 -0.35
+1163 0.25 0.65 -0.35
+1174 0.05 0.75 -0.35
+1175 0.15 0.75 -0.35
+1176 0.25 0.75 -0.35
+646 0.35 0.65 -0.55
+647 0.45 0.65 -0.55
+655 0.35 0.75 -0.55
+893 0.35 0.65 -0.45
+894 0.45 0.65 -0.45
+895 0.55 0.65 -0.45
+904 0.35 0.75 -0.45
+905 0.45 0.75 -0.45
+1164 0.35 0.65 -0.35
+1165 0.45 0.65 -0.35
+1166 0.55 0.65 -0.35
+1177 0.35 0.75 -0.35
+1178 0.45 0.75 -0.35
+1179 0.55 0.75 -0.35
+1167 0.65 0.65 -0.35
+1180 -0.35 0.85 -0.35
+906 -0.25 0.85 -0.45
+907 -0.15 0.85 -0.45
+908 -0.05 0.85 -0.45
+1181 -0.25 0.85 -0.35
+1182 -0.15 0.85 -0.35
+1183 -0.05 0.85 -0.35
+909 0.05 0.85 -0.45
+910 0.15 0.85 -0.45
+911 0.25 0.85 -0.45
+1184 0.05 0.85 -0.35
+1185 0.15 0.85 -0.35
+1186 0.25 0.85 -0.35
+1187 0.35 0.85 -0.35
+1192 -0.45 -0.85 -0.25
+1193 -0.35 -0.85 -0.25
+1494 -0.45 -0.85 -0.15
+1495 -0.35 -0.85 -0.15
+1802 -0.45 -0.85 -0.05
+1803 -0.35 -0.85 -0.05
+1188 -0.15 -0.95 -0.25
+1189 -0.05 -0.95 -0.25
+1194 -0.25 -0.85 -0.25
+1195 -0.15 -0.85 -0.25
+1196 -0.05 -0.85 -0.25
+1488 -0.25 -0.95 -0.15
+1489 -0.15 -0.95 -0.15
+1490 -0.05 -0.95 -0.15
+1496 -0.25 -0.85 -0.15
+1497 -0.15 -0.85 -0.15
+1498 -0.05 -0.85 -0.15
+1796 -0.25 -0.95 -0.05
+1797 -0.15 -0.95 -0.05
+1798 -0.05 -0.95 -0.05
+1804 -0.25 -0.85 -0.05
+1805 -0.15 -0.85 -0.05
+1806 -0.05 -0.85 -0.05
+1190 0.05 -0.95 -0.25
+1191 0.15 -0.95 -0.25
+1197 0.05 -0.85 -0.25
+1198 0.15 -0.85 -0.25
+1199 0.25 -0.85 -0.25
+1491 0.05 -0.95 -0.15
+1492 0.15 -0.95 -0.15
+1493 0.25 -0.95 -0.15
+1499 0.05 -0.85 -0.15
+1500 0.15 -0.85 -0.15
+1501 0.25 -0.85 -0.15
+1799 0.05 -0.95 -0.05
+1800 0.15 -0.95 -0.05
+1801 0.25 -0.95 -0.05
+1807 0.05 -0.85 -0.05
+1808 0.15 -0.85 -0.05
+1809 0.25 -0.85 -0.05
+1200 0.35 -0.85 -0.25
+1201 0.45 -0.85 -0.25
+1502 0.35 -0.85 -0.15
+1503 0.45 -0.85 -0.15
+1810 0.35 -0.85 -0.05
+1811 0.45 -0.85 -0.05
+1214 -0.65 -0.65 -0.25
+1516 -0.65 -0.65 -0.15
+1812 -0.65 -0.75 -0.05
+1826 -0.75 -0.65 -0.05
+1827 -0.65 -0.65 -0.05
+1202 -0.55 -0.75 -0.25
+1203 -0.45 -0.75 -0.25
+1204 -0.35 -0.75 -0.25
+1215 -0.55 -0.65 -0.25
+1216 -0.45 -0.65 -0.25
+1217 -0.35 -0.65 -0.25
+1504 -0.55 -0.75 -0.15
+1505 -0.45 -0.75 -0.15
+1506 -0.35 -0.75 -0.15
+1517 -0.55 -0.65 -0.15
+1518 -0.45 -0.65 -0.15
+1519 -0.35 -0.65 -0.15
+1813 -0.55 -0.75 -0.05
+1814 -0.45 -0.75 -0.05
+1815 -0.35 -0.75 -0.05
+1828 -0.55 -0.65 -0.05
+1829 -0.45 -0.65 -0.05
+1830 -0.35 -0.65 -0.05
+1205 -0.25 -0.75 -0.25
+1206 -0.15 -0.75 -0.25
+1207 -0.05 -0.75 -0.25
+1218 -0.25 -0.65 -0.25
+1219 -0.15 -0.65 -0.25
+1220 -0.05 -0.65 -0.25
+1507 -0.25 -0.75 -0.15
+1508 -0.15 -0.75 -0.15
+1509 -0.05 -0.75 -0.15
+1520 -0.25 -0.65 -0.15
+1521 -0.15 -0.65 -0.15
+1522 -0.05 -0.65 -0.15
+1816 -0.25 -0.75 -0.05
+1817 -0.15 -0.75 -0.05
+1818 -0.05 -0.75 -0.05
+1831 -0.25 -0.65 -0.05
+1832 -0.15 -0.65 -0.05
+1833 -0.05 -0.65 -0.05
+1208 0.05 -0.75 -0.25
+1209 0.15 -0.75 -0.25
+1210 0.25 -0.75 -0.25
+1221 0.05 -0.65 -0.25
+1222 0.15 -0.65 -0.25
+1223 0.25 -0.65 -0.25
+1510 0.05 -0.75 -0.15
+1511 0.15 -0.75 -0.15
+1512 0.25 -0.75 -0.15
+1523 0.05 -0.65 -0.15
+1524 0.15 -0.65 -0.15
+1525 0.25 -0.65 -0.15
+1819 0.05 -0.75 -0.05
+1820 0.15 -0.75 -0.05
+1821 0.25 -0.75 -0.05
+1834 0.05 -0.65 -0.05
+1835 0.15 -0.65 -0.05
+1836 0.25 -0.65 -0.05
+1211 0.35 -0.75 -0.25
+1212 0.45 -0.75 -0.25
+1213 0.55 -0.75 -0.25
+1224 0.35 -0.65 -0.25
+1225 0.45 -0.65 -0.25
+1226 0.55 -0.65 -0.25
+1513 0.35 -0.75 -0.15
+1514 0.45 -0.75 -0.15
+1515 0.55 -0.75 -0.15
+1526 0.35 -0.65 -0.15
+1527 0.45 -0.65 -0.15
+1528 0.55 -0.65 -0.15
+1822 0.35 -0.75 -0.05
+1823 0.45 -0.75 -0.05
+1824 0.55 -0.75 -0.05
+1837 0.35 -0.65 -0.05
+1838 0.45 -0.65 -0.05
+1839 0.55 -0.65 -0.05
+1227 0.65 -0.65 -0.25
+1529 0.65 -0.65 -0.15
+1825 0.65 -0.75 -0.05
+1840 0.65 -0.65 -0.05
+1841 0.75 -0.65 -0.05
+1244 -0.85 -0.45 -0.25
+1262 -0.85 -0.35 -0.25
+1546 -0.85 -0.45 -0.15
+1564 -0.85 -0.35 -0.15
+1858 -0.85 -0.45 -0.05
+1876 -0.85 -0.35 -0.05
+1228 -0.75 -0.55 -0.25
+1229 -0.65 -0.55 -0.25
+1245 -0.75 -0.45 -0.25
+1246 -0.65 -0.45 -0.25
+1263 -0.75 -0.35 -0.25
+1264 -0.65 -0.35 -0.25
+1530 -0.75 -0.55 -0.15
+1531 -0.65 -0.55 -0.15
+1547 -0.75 -0.45 -0.15
+1548 -0.65 -0.45 -0.15
+1565 -0.75 -0.35 -0.15
+1566 -0.65 -0.35 -0.15
+1842 -0.75 -0.55 -0.05
+1843 -0.65 -0.55 -0.05
+1859 -0.75 -0.45 -0.05
+1860 -0.65 -0.45 -0.05
+1877 -0.75 -0.35 -0.05
+1878 -0.65 -0.35 -0.05
+1230 -0.55 -0.55 -0.25
+1231 -0.45 -0.55 -0.25
+1232 -0.35 -0.55 -0.25
+1247 -0.55 -0.45 -0.25
+1248 -0.45 -0.45 -0.25
+1249 -0.35 -0.45 -0.25
+1265 -0.55 -0.35 -0.25
+1266 -0.45 -0.35 -0.25
+1267 -0.35 -0.35 -0.25
+1532 -0.55 -0.55 -0.15
+1533 -0.45 -0.55 -0.15
+1534 -0.35 -0.55 -0.15
+1549 -0.55 -0.45 -0.15
+1550 -0.45 -0.45 -0.15
+1551 -0.35 -0.45 -0.15
+1567 -0.55 -0.35 -0.15
+1568 -0.45 -0.35 -0.15
+1569 -0.35 -0.35 -0.15
+1844 -0.55 -0.55 -0.05
+1845 -0.45 -0.55 -0.05
+1846 -0.35 -0.55 -0.05
+1861 -0.55 -0.45 -0.05
+1862 -0.45 -0.45 -0.05
+1863 -0.35 -0.45 -0.05
+1879 -0.55 -0.35 -0.05
+1880 -0.45 -0.35 -0.05
+1881 -0.35 -0.35 -0.05
+1233 -0.25 -0.55 -0.25
+1234 -0.15 -0.55 -0.25
+1235 -0.05 -0.55 -0.25
+1250 -0.25 -0.45 -0.25
+1251 -0.15 -0.45 -0.25
+1252 -0.05 -0.45 -0.25
+1268 -0.25 -0.35 -0.25
+1269 -0.15 -0.35 -0.25
+1270 -0.05 -0.35 -0.25
+1535 -0.25 -0.55 -0.15
+1536 -0.15 -0.55 -0.15
+1537 -0.05 -0.55 -0.15
+1552 -0.25 -0.45 -0.15
+1553 -0.15 -0.45 -0.15
+1554 -0.05 -0.45 -0.15
+1570 -0.25 -0.35 -0.15
+1571 -0.15 -0.35 -0.15
+1572 -0.05 -0.35 -0.15
+1847 -0.25 -0.55 -0.05
+1848 -0.15 -0.55 -0.05
+1849 -0.05 -0.55 -0.05
+1864 -0.25 -0.45 -0.05
+1865 -0.15 -0.45 -0.05
+1866 -0.05 -0.45 -0.05
+1882 -0.25 -0.35 -0.05
+1883 -0.15 -0.35 -0.05
+1884 -0.05 -0.35 -0.05
+1236 0.05 -0.55 -0.25
+1237 0.15 -0.55 -0.25
+1238 0.25 -0.55 -0.25
+1253 0.05 -0.45 -0.25
+1254 0.15 -0.45 -0.25
+1255 0.25 -0.45 -0.25
+1271 0.05 -0.35 -0.25
+1272 0.15 -0.35 -0.25
+1273 0.25 -0.35 -0.25
+1538 0.05 -0.55 -0.15
+1539 0.15 -0.55 -0.15
+1540 0.25 -0.55 -0.15
+1555 0.05 -0.45 -0.15
+1556 0.15 -0.45 -0.15
+1557 0.25 -0.45 -0.15
+1573 0.05 -0.35 -0.15
+1574 0.15 -0.35 -0.15
+1575 0.25 -0.35 -0.15
+1850 0.05 -0.55 -0.05
+1851 0.15 -0.55 -0.05
+1852 0.25 -0.55 -0.05
+1867 0.05 -0.45 -0.05
+1868 0.15 -0.45 -0.05
+1869 0.25 -0.45 -0.05
+1885 0.05 -0.35 -0.05
+1886 0.15 -0.35 -0.05
+1887 0.25 -0.35 -0.05
+1239 0.35 -0.55 -0.25
+1240 0.45 -0.55 -0.25
+1241 0.55 -0.55 -0.25
+1256 0.35 -0.45 -0.25
+1257 0.45 -0.45 -0.25
+1258 0.55 -0.45 -0.25
+1274 0.35 -0.35 -0.25
+1275 0.45 -0.35 -0.25
+1276 0.55 -0.35 -0.25
+1541 0.35 -0.55 -0.15
+1542 0.45 -0.55 -0.15
+1543 0.55 -0.55 -0.15
+1558 0.35 -0.45 -0.15
+1559 0.45 -0.45 -0.15
+1560 0.55 -0.45 -0.15
+1576 0.35 -0.35 -0.15
+1577 0.45 -0.35 -0.15
+1578 0.55 -0.35 -0.15
+1853 0.35 -0.55 -0.05
+1854 0.45 -0.55 -0.05
+1855 0.55 -0.55 -0.05
+1870 0.35 -0.45 -0.05
+1871 0.45 -0.45 -0.05
+1872 0.55 -0.45 -0.05
+1888 0.35 -0.35 -0.05
+1889 0.45 -0.35 -0.05
+1890 0.55 -0.35 -0.05
+1242 0.65 -0.55 -0.25
+1243 0.75 -0.55 -0.25
+1259 0.65 -0.45 -0.25
+1260 0.75 -0.45 -0.25
+1277 0.65 -0.35 -0.25
+1278 0.75 -0.35 -0.25
+1544 0.65 -0.55 -0.15
+1545 0.75 -0.55 -0.15
+1561 0.65 -0.45 -0.15
+1562 0.75 -0.45 -0.15
+1579 0.65 -0.35 -0.15
+1580 0.75 -0.35 -0.15
+1856 0.65 -0.55 -0.05
+1857 0.75 -0.55 -0.05
+1873 0.65 -0.45 -0.05
+1874 0.75 -0.45 -0.05
+1891 0.65 -0.35 -0.05
+1892 0.75 -0.35 -0.05
+1261 0.85 -0.45 -0.25
+1279 0.85 -0.35 -0.25
+1563 0.85 -0.45 -0.15
+1581 0.85 -0.35 -0.15
+1875 0.85 -0.45 -0.05
+1893 0.85 -0.35 -0.05
+1280 -0.85 -0.25 -0.25
+1298 -0.95 -0.15 -0.25
+1299 -0.85 -0.15 -0.25
+1318 -0.95 -0.05 -0.25
+1319 -0.85 -0.05 -0.25
+1582 -0.95 -0.25 -0.15
+1583 -0.85 -0.25 -0.15
+1602 -0.95 -0.15 -0.15
+1603 -0.85 -0.15 -0.15
+1622 -0.95 -0.05 -0.15
+1623 -0.85 -0.05 -0.15
+1894 -0.95 -0.25 -0.05
+1895 -0.85 -0.25 -0.05
+1914 -0.95 -0.15 -0.05
+1915 -0.85 -0.15 -0.05
+1934 -0.95 -0.05 -0.05
+1935 -0.85 -0.05 -0.05
+1281 -0.75 -0.25 -0.25
+1282 -0.65 -0.25 -0.25
+1300 -0.75 -0.15 -0.25
+1301 -0.65 -0.15 -0.25
+1320 -0.75 -0.05 -0.25
+1321 -0.65 -0.05 -0.25
+1584 -0.75 -0.25 -0.15
+1585 -0.65 -0.25 -0.15
+1604 -0.75 -0.15 -0.15
+1605 -0.65 -0.15 -0.15
+1624 -0.75 -0.05 -0.15
+1625 -0.65 -0.05 -0.15
+1896 -0.75 -0.25 -0.05
+1897 -0.65 -0.25 -0.05
+1916 -0.75 -0.15 -0.05
+1917 -0.65 -0.15 -0.05
+1936 -0.75 -0.05 -0.05
+1937 -0.65 -0.05 -0.05
+1283 -0.55 -0.25 -0.25
+1284 -0.45 -0.25 -0.25
+1285 -0.35 -0.25 -0.25
+1302 -0.55 -0.15 -0.25
+1303 -0.45 -0.15 -0.25
+1304 -0.35 -0.15 -0.25
+1322 -0.55 -0.05 -0.25
+1323 -0.45 -0.05 -0.25
+1324 -0.35 -0.05 -0.25
+1586 -0.55 -0.25 -0.15
+1587 -0.45 -0.25 -0.15
+1588 -0.35 -0.25 -0.15
+1606 -0.55 -0.15 -0.15
+1607 -0.45 -0.15 -0.15
+1608 -0.35 -0.15 -0.15
+1626 -0.55 -0.05 -0.15
+1627 -0.45 -0.05 -0.15
+1628 -0.35 -0.05 -0.15
+1898 -0.55 -0.25 -0.05
+1899 -0.45 -0.25 -0.05
+1900 -0.35 -0.25 -0.05
+1918 -0.55 -0.15 -0.05
+1919 -0.45 -0.15 -0.05
+1920 -0.35 -0.15 -0.05
+1938 -0.55 -0.05 -0.05
+1939 -0.45 -0.05 -0.05
+1940 -0.35 -0.05 -0.05
+1286 -0.25 -0.25 -0.25
+1287 -0.15 -0.25 -0.25
+1288 -0.05 -0.25 -0.25
+1305 -0.25 -0.15 -0.25
+1306 -0.15 -0.15 -0.25
+1307 -0.05 -0.15 -0.25
+1325 -0.25 -0.05 -0.25
+1326 -0.15 -0.05 -0.25
+1327 -0.05 -0.05 -0.25
+1589 -0.25 -0.25 -0.15
+1590 -0.15 -0.25 -0.15
+1591 -0.05 -0.25 -0.15
+1609 -0.25 -0.15 -0.15
+1610 -0.15 -0.15 -0.15
+1611 -0.05 -0.15 -0.15
+1629 -0.25 -0.05 -0.15
+1630 -0.15 -0.05 -0.15
+1631 -0.05 -0.05 -0.15
+1901 -0.25 -0.25 -0.05
+1902 -0.15 -0.25 -0.05
+1903 -0.05 -0.25 -0.05
+1921 -0.25 -0.15 -0.05
+1922 -0.15 -0.15 -0.05
+1923 -0.05 -0.15 -0.05
+1941 -0.25 -0.05 -0.05
+1942 -0.15 -0.05 -0.05
+1943 -0.05 -0.05 -0.05
+1289 0.05 -0.25 -0.25
+1290 0.15 -0.25 -0.25
+1291 0.25 -0.25 -0.25
+1308 0.05 -0.15 -0.25
+1309 0.15 -0.15 -0.25
+1310 0.25 -0.15 -0.25
+1328 0.05 -0.05 -0.25
+1329 0.15 -0.05 -0.25
+1330 0.25 -0.05 -0.25
+1592 0.05 -0.25 -0.15
+1593 0.15 -0.25 -0.15
+1594 0.25 -0.25 -0.15
+1612 0.05 -0.15 -0.15
+1613 0.15 -0.15 -0.15
+1614 0.25 -0.15 -0.15
+1632 0.05 -0.05 -0.15
+1633 0.15 -0.05 -0.15
+1634 0.25 -0.05 -0.15
+1904 0.05 -0.25 -0.05
+1905 0.15 -0.25 -0.05
+1906 0.25 -0.25 -0.05
+1924 0.05 -0.15 -0.05
+1925 0.15 -0.15 -0.05
+1926 0.25 -0.15 -0.05
+1944 0.05 -0.05 -0.05
+1945 0.15 -0.05 -0.05
+1946 0.25 -0.05 -0.05
+1292 0.35 -0.25 -0.25
+1293 0.45 -0.25 -0.25
+1294 0.55 -0.25 -0.25
+1311 0.35 -0.15 -0.25
+1312 0.45 -0.15 -0.25
+1313 0.55 -0.15 -0.25
+1331 0.35 -0.05 -0.25
+1332 0.45 -0.05 -0.25
+1333 0.55 -0.05 -0.25
+1595 0.35 -0.25 -0.15
+1596 0.45 -0.25 -0.15
+1597 0.55 -0.25 -0.15
+1615 0.35 -0.15 -0.15
+1616 0.45 -0.15 -0.15
+1617 0.55 -0.15 -0.15
+1635 0.35 -0.05 -0.15
+1636 0.45 -0.05 -0.15
+1637 0.55 -0.05 -0.15
+1907 0.35 -0.25 -0.05
+1908 0.45 -0.25 -0.05
+1909 0.55 -0.25 -0.05
+1927 0.35 -0.15 -0.05
+1928 0.45 -0.15 -0.05
+1929 0.55 -0.15 -0.05
+1947 0.35 -0.05 -0.05
+1948 0.45 -0.05 -0.05
+1949 0.55 -0.05 -0.05
+1295 0.65 -0.25 -0.25
+1296 0.75 -0.25 -0.25
+1314 0.65 -0.15 -0.25
+1315 0.75 -0.15 -0.25
+1334 0.65 -0.05 -0.25
+1335 0.75 -0.05 -0.25
+1598 0.65 -0.25 -0.15
+1599 0.75 -0.25 -0.15
+1618 0.65 -0.15 -0.15
+1619 0.75 -0.15 -0.15
+1638 0.65 -0.05 -0.15
+1639 0.75 -0.05 -0.15
+1910 0.65 -0.25 -0.05
+1911 0.75 -0.25 -0.05
+1930 0.65 -0.15 -0.05
+1931 0.75 -0.15 -0.05
+1950 0.65 -0.05 -0.05
+1951 0.75 -0.05 -0.05
+1297 0.85 -0.25 -0.25
+1316 0.85 -0.15 -0.25
+1317 0.95 -0.15 -0.25
+1336 0.85 -0.05 -0.25
+1337 0.95 -0.05 -0.25
+1600 0.85 -0.25 -0.15
+1601 0.95 -0.25 -0.15
+1620 0.85 -0.15 -0.15
+1621 0.95 -0.15 -0.15
+1640 0.85 -0.05 -0.15
+1641 0.95 -0.05 -0.15
+1912 0.85 -0.25 -0.05
+1913 0.95 -0.25 -0.05
+1932 0.85 -0.15 -0.05
+1933 0.95 -0.15 -0.05
+1952 0.85 -0.05 -0.05
+1953 0.95 -0.05 -0.05
+1338 -0.95 0.05 -0.25
+1339 -0.85 0.05 -0.25
+1358 -0.95 0.15 -0.25
+1359 -0.85 0.15 -0.25
+1378 -0.85 0.25 -0.25
+1642 -0.95 0.05 -0.15
+1643 -0.85 0.05 -0.15
+1662 -0.95 0.15 -0.15
+1663 -0.85 0.15 -0.15
+1682 -0.95 0.25 -0.15
+1683 -0.85 0.25 -0.15
+1954 -0.95 0.05 -0.05
+1955 -0.85 0.05 -0.05
+1974 -0.95 0.15 -0.05
+1975 -0.85 0.15 -0.05
+1994 -0.95 0.25 -0.05
+1995 -0.85 0.25 -0.05
+1340 -0.75 0.05 -0.25
+1341 -0.65 0.05 -0.25
+1360 -0.75 0.15 -0.25
+1361 -0.65 0.15 -0.25
+1379 -0.75 0.25 -0.25
+1380 -0.65 0.25 -0.25
+1644 -0.75 0.05 -0.15
+1645 -0.65 0.05 -0.15
+1664 -0.75 0.15 -0.15
+1665 -0.65 0.15 -0.15
+1684 -0.75 0.25 -0.15
+1685 -0.65 0.25 -0.15
+1956 -0.75 0.05 -0.05
+1957 -0.65 0.05 -0.05
+1976 -0.75 0.15 -0.05
+1977 -0.65 0.15 -0.05
+1996 -0.75 0.25 -0.05
+1997 -0.65 0.25 -0.05
+1342 -0.55 0.05 -0.25
+1343 -0.45 0.05 -0.25
+1344 -0.35 0.05 -0.25
+1362 -0.55 0.15 -0.25
+1363 -0.45 0.15 -0.25
+1364 -0.35 0.15 -0.25
+1381 -0.55 0.25 -0.25
+1382 -0.45 0.25 -0.25
+1383 -0.35 0.25 -0.25
+1646 -0.55 0.05 -0.15
+1647 -0.45 0.05 -0.15
+1648 -0.35 0.05 -0.15
+1666 -0.55 0.15 -0.15
+1667 -0.45 0.15 -0.15
+1668 -0.35 0.15 -0.15
+1686 -0.55 0.25 -0.15
+1687 -0.45 0.25 -0.15
+1688 -0.35 0.25 -0.15
+1958 -0.55 0.05 -0.05
+1959 -0.45 0.05 -0.05
+1960 -0.35 0.05 -0.05
+1978 -0.55 0.15 -0.05
+1979 -0.45 0.15 -0.05
+1980 -0.35 0.15 -0.05
+1998 -0.55 0.25 -0.05
+1999 -0.45 0.25 -0.05
+2000 -0.35 0.25 -0.05
+1345 -0.25 0.05 -0.25
+1346 -0.15 0.05 -0.25
+1347 -0.05 0.05 -0.25
+1365 -0.25 0.15 -0.25
+1366 -0.15 0.15 -0.25
+1367 -0.05 0.15 -0.25
+1384 -0.25 0.25 -0.25
+1385 -0.15 0.25 -0.25
+1386 -0.05 0.25 -0.25
+1649 -0.25 0.05 -0.15
+1650 -0.15 0.05 -0.15
+1651 -0.05 0.05 -0.15
+1669 -0.25 0.15 -0.15
+1670 -0.15 0.15 -0.15
+1671 -0.05 0.15 -0.15
+1689 -0.25 0.25 -0.15
+1690 -0.15 0.25 -0.15
+1691 -0.05 0.25 -0.15
+1961 -0.25 0.05 -0.05
+1962 -0.15 0.05 -0.05
+1963 -0.05 0.05 -0.05
+1981 -0.25 0.15 -0.05
+1982 -0.15 0.15 -0.05
+1983 -0.05 0.15 -0.05
+2001 -0.25 0.25 -0.05
+2002 -0.15 0.25 -0.05
+2003 -0.05 0.25 -0.05
+1348 0.05 0.05 -0.25
+1349 0.15 0.05 -0.25
+1350 0.25 0.05 -0.25
+1368 0.05 0.15 -0.25
+1369 0.15 0.15 -0.25
+1370 0.25 0.15 -0.25
+1387 0.05 0.25 -0.25
+1388 0.15 0.25 -0.25
+1389 0.25 0.25 -0.25
+1652 0.05 0.05 -0.15
+1653 0.15 0.05 -0.15
+1654 0.25 0.05 -0.15
+1672 0.05 0.15 -0.15
+1673 0.15 0.15 -0.15
+1674 0.25 0.15 -0.15
+1692 0.05 0.25 -0.15
+1693 0.15 0.25 -0.15
+1694 0.25 0.25 -0.15
+1964 0.05 0.05 -0.05
+1965 0.15 0.05 -0.05
+1966 0.25 0.05 -0.05
+1984 0.05 0.15 -0.05
+1985 0.15 0.15 -0.05
+1986 0.25 0.15 -0.05
+2004 0.05 0.25 -0.05
+2005 0.15 0.25 -0.05
+2006 0.25 0.25 -0.05
+1351 0.35 0.05 -0.25
+1352 0.45 0.05 -0.25
+1353 0.55 0.05 -0.25
+1371 0.35 0.15 -0.25
+1372 0.45 0.15 -0.25
+1373 0.55 0.15 -0.25
+1390 0.35 0.25 -0.25
+1391 0.45 0.25 -0.25
+1392 0.55 0.25 -0.25
+1655 0.35 0.05 -0.15
+1656 0.45 0.05 -0.15
+1657 0.55 0.05 -0.15
+1675 0.35 0.15 -0.15
+1676 0.45 0.15 -0.15
+1677 0.55 0.15 -0.15
+1695 0.35 0.25 -0.15
+1696 0.45 0.25 -0.15
+1697 0.55 0.25 -0.15
+1967 0.35 0.05 -0.05
+1968 0.45 0.05 -0.05
+1969 0.55 0.05 -0.05
+1987 0.35 0.15 -0.05
+1988 0.45 0.15 -0.05
+1989 0.55 0.15 -0.05
+2007 0.35 0.25 -0.05
+2008 0.45 0.25 -0.05
+2009 0.55 0.25 -0.05
+1354 0.65 0.05 -0.25
+1355 0.75 0.05 -0.25
+1374 0.65 0.15 -0.25
+1375 0.75 0.15 -0.25
+1393 0.65 0.25 -0.25
+1394 0.75 0.25 -0.25
+1658 0.65 0.05 -0.15
+1659 0.75 0.05 -0.15
+1678 0.65 0.15 -0.15
+1679 0.75 0.15 -0.15
+1698 0.65 0.25 -0.15
+1699 0.75 0.25 -0.15
+1970 0.65 0.05 -0.05
+1971 0.75 0.05 -0.05
+1990 0.65 0.15 -0.05
+1991 0.75 0.15 -0.05
+2010 0.65 0.25 -0.05
+2011 0.75 0.25 -0.05
+1356 0.85 0.05 -0.25
+1357 0.95 0.05 -0.25
+1376 0.85 0.15 -0.25
+1377 0.95 0.15 -0.25
+1395 0.85 0.25 -0.25
+1660 0.85 0.05 -0.15
+1661 0.95 0.05 -0.15
+1680 0.85 0.15 -0.15
+1681 0.95 0.15 -0.15
+1700 0.85 0.25 -0.15
+1701 0.95 0.25 -0.15
+1972 0.85 0.05 -0.05
+1973 0.95 0.05 -0.05
+1992 0.85 0.15 -0.05
+1993 0.95 0.15 -0.05
+2012 0.85 0.25 -0.05
+2013 0.95 0.25 -0.05
+1396 -0.85 0.35 -0.25
+1414 -0.85 0.45 -0.25
+1702 -0.85 0.35 -0.15
+1720 -0.85 0.45 -0.15
+2014 -0.85 0.35 -0.05
+2032 -0.85 0.45 -0.05
+1397 -0.75 0.35 -0.25
+1398 -0.65 0.35 -0.25
+1415 -0.75 0.45 -0.25
+1416 -0.65 0.45 -0.25
+1432 -0.75 0.55 -0.25
+1433 -0.65 0.55 -0.25
+1703 -0.75 0.35 -0.15
+1704 -0.65 0.35 -0.15
+1721 -0.75 0.45 -0.15
+1722 -0.65 0.45 -0.15
+1738 -0.75 0.55 -0.15
+1739 -0.65 0.55 -0.15
+2015 -0.75 0.35 -0.05
+2016 -0.65 0.35 -0.05
+2033 -0.75 0.45 -0.05
+2034 -0.65 0.45 -0.05
+2050 -0.75 0.55 -0.05
+2051 -0.65 0.55 -0.05
+1399 -0.55 0.35 -0.25
+1400 -0.45 0.35 -0.25
+1401 -0.35 0.35 -0.25
+1417 -0.55 0.45 -0.25
+1418 -0.45 0.45 -0.25
+1419 -0.35 0.45 -0.25
+1434 -0.55 0.55 -0.25
+1435 -0.45 0.55 -0.25
+1436 -0.35 0.55 -0.25
+1705 -0.55 0.35 -0.15
+1706 -0.45 0.35 -0.15
+1707 -0.35 0.35 -0.15
+1723 -0.55 0.45 -0.15
+1724 -0.45 0.45 -0.15
+1725 -0.35 0.45 -0.15
+1740 -0.55 0.55 -0.15
+1741 -0.45 0.55 -0.15
+1742 -0.35 0.55 -0.15
+2017 -0.55 0.35 -0.05
+2018 -0.45 0.35 -0.05
+2019 -0.35 0.35 -0.05
+2035 -0.55 0.45 -0.05
+2036 -0.45 0.45 -0.05
+2037 -0.35 0.45 -0.05
+2052 -0.55 0.55 -0.05
+2053 -0.45 0.55 -0.05
+2054 -0.35 0.55 -0.05
+1402 -0.25 0.35 -0.25
+1403 -0.15 0.35 -0.25
+1404 -0.05 0.35 -0.25
+1420 -0.25 0.45 -0.25
+1421 -0.15 0.45 -0.25
+1422 -0.05 0.45 -0.25
+1437 -0.25 0.55 -0.25
+1438 -0.15 0.55 -0.25
+1439 -0.05 0.55 -0.25
+1708 -0.25 0.35 -0.15
+1709 -0.15 0.35 -0.15
+1710 -0.05 0.35 -0.15
+1726 -0.25 0.45 -0.15
+1727 -0.15 0.45 -0.15
+1728 -0.05 0.45 -0.15
+1743 -0.25 0.55 -0.15
+1744 -0.15 0.55 -0.15
+1745 -0.05 0.55 -0.15
+2020 -0.25 0.35 -0.05
+2021 -0.15 0.35 -0.05
+2022 -0.05 0.35 -0.05
+2038 -0.25 0.45 -0.05
+2039 -0.15 0.45 -0.05
+2040 -0.05 0.45 -0.05
+2055 -0.25 0.55 -0.05
+2056 -0.15 0.55 -0.05
+2057 -0.05 0.55 -0.05
+1405 0.05 0.35 -0.25
+1406 0.15 0.35 -0.25
+1407 0.25 0.35 -0.25
+1423 0.05 0.45 -0.25
+1424 0.15 0.45 -0.25
+1425 0.25 0.45 -0.25
+1440 0.05 0.55 -0.25
+1441 0.15 0.55 -0.25
+1442 0.25 0.55 -0.25
+1711 0.05 0.35 -0.15
+1712 0.15 0.35 -0.15
+1713 0.25 0.35 -0.15
+1729 0.05 0.45 -0.15
+1730 0.15 0.45 -0.15
+1731 0.25 0.45 -0.15
+1746 0.05 0.55 -0.15
+1747 0.15 0.55 -0.15
+1748 0.25 0.55 -0.15
+2023 0.05 0.35 -0.05
+2024 0.15 0.35 -0.05
+2025 0.25 0.35 -0.05
+2041 0.05 0.45 -0.05
+2042 0.15 0.45 -0.05
+2043 0.25 0.45 -0.05
+2058 0.05 0.55 -0.05
+2059 0.15 0.55 -0.05
+2060 0.25 0.55 -0.05
+1408 0.35 0.35 -0.25
+1409 0.45 0.35 -0.25
+1410 0.55 0.35 -0.25
+1426 0.35 0.45 -0.25
+1427 0.45 0.45 -0.25
+1428 0.55 0.45 -0.25
+1443 0.35 0.55 -0.25
+1444 0.45 0.55 -0.25
+1445 0.55 0.55 -0.25
+1714 0.35 0.35 -0.15
+1715 0.45 0.35 -0.15
+1716 0.55 0.35 -0.15
+1732 0.35 0.45 -0.15
+1733 0.45 0.45 -0.15
+1734 0.55 0.45 -0.15
+1749 0.35 0.55 -0.15
+1750 0.45 0.55 -0.15
+1751 0.55 0.55 -0.15
+2026 0.35 0.35 -0.05
+2027 0.45 0.35 -0.05
+2028 0.55 0.35 -0.05
+2044 0.35 0.45 -0.05
+2045 0.45 0.45 -0.05
+2046 0.55 0.45 -0.05
+2061 0.35 0.55 -0.05
+2062 0.45 0.55 -0.05
+2063 0.55 0.55 -0.05
+1411 0.65 0.35 -0.25
+1412 0.75 0.35 -0.25
+1429 0.65 0.45 -0.25
+1430 0.75 0.45 -0.25
+1446 0.65 0.55 -0.25
+1447 0.75 0.55 -0.25
+1717 0.65 0.35 -0.15
+1718 0.75 0.35 -0.15
+1735 0.65 0.45 -0.15
+1736 0.75 0.45 -0.15
+1752 0.65 0.55 -0.15
+1753 0.75 0.55 -0.15
+2029 0.65 0.35 -0.05
+2030 0.75 0.35 -0.05
+2047 0.65 0.45 -0.05
+2048 0.75 0.45 -0.05
+2064 0.65 0.55 -0.05
+2065 0.75 0.55 -0.05
+1413 0.85 0.35 -0.25
+1431 0.85 0.45 -0.25
+1719 0.85 0.35 -0.15
+1737 0.85 0.45 -0.15
+2031 0.85 0.35 -0.05
+2049 0.85 0.45 -0.05
+1448 -0.65 0.65 -0.25
+1754 -0.65 0.65 -0.15
+2066 -0.75 0.65 -0.05
+2067 -0.65 0.65 -0.05
+2082 -0.65 0.75 -0.05
+1449 -0.55 0.65 -0.25
+1450 -0.45 0.65 -0.25
+1451 -0.35 0.65 -0.25
+1462 -0.55 0.75 -0.25
+1463 -0.45 0.75 -0.25
+1464 -0.35 0.75 -0.25
+1755 -0.55 0.65 -0.15
+1756 -0.45 0.65 -0.15
+1757 -0.35 0.65 -0.15
+1768 -0.55 0.75 -0.15
+1769 -0.45 0.75 -0.15
+1770 -0.35 0.75 -0.15
+2068 -0.55 0.65 -0.05
+2069 -0.45 0.65 -0.05
+2070 -0.35 0.65 -0.05
+2083 -0.55 0.75 -0.05
+2084 -0.45 0.75 -0.05
+2085 -0.35 0.75 -0.05
+1452 -0.25 0.65 -0.25
+1453 -0.15 0.65 -0.25
+1454 -0.05 0.65 -0.25
+1465 -0.25 0.75 -0.25
+1466 -0.15 0.75 -0.25
+1467 -0.05 0.75 -0.25
+1758 -0.25 0.65 -0.15
+1759 -0.15 0.65 -0.15
+1760 -0.05 0.65 -0.15
+1771 -0.25 0.75 -0.15
+1772 -0.15 0.75 -0.15
+1773 -0.05 0.75 -0.15
+2071 -0.25 0.65 -0.05
+2072 -0.15 0.65 -0.05
+2073 -0.05 0.65 -0.05
+2086 -0.25 0.75 -0.05
+2087 -0.15 0.75 -0.05
+2088 -0.05 0.75 -0.05
+1455 0.05 0.65 -0.25
+1456 0.15 0.65 -0.25
+1457 0.25 0.65 -0.25
+1468 0.05 0.75 -0.25
+1469 0.15 0.75 -0.25
+1470 0.25 0.75 -0.25
+1761 0.05 0.65 -0.15
+1762 0.15 0.65 -0.15
+1763 0.25 0.65 -0.15
+1774 0.05 0.75 -0.15
+1775 0.15 0.75 -0.15
+1776 0.25 0.75 -0.15
+2074 0.05 0.65 -0.05
+2075 0.15 0.65 -0.05
+2076 0.25 0.65 -0.05
+2089 0.05 0.75 -0.05
+2090 0.15 0.75 -0.05
+2091 0.25 0.75 -0.05
+1458 0.35 0.65 -0.25
+1459 0.45 0.65 -0.25
+1460 0.55 0.65 -0.25
+1471 0.35 0.75 -0.25
+1472 0.45 0.75 -0.25
+1473 0.55 0.75 -0.25
+1764 0.35 0.65 -0.15
+1765 0.45 0.65 -0.15
+1766 0.55 0.65 -0.15
+1777 0.35 0.75 -0.15
+1778 0.45 0.75 -0.15
+1779 0.55 0.75 -0.15
+2077 0.35 0.65 -0.05
+2078 0.45 0.65 -0.05
+2079 0.55 0.65 -0.05
+2092 0.35 0.75 -0.05
+2093 0.45 0.75 -0.05
+2094 0.55 0.75 -0.05
+1461 0.65 0.65 -0.25
+1767 0.65 0.65 -0.15
+2080 0.65 0.65 -0.05
+2081 0.75 0.65 -0.05
+2095 0.65 0.75 -0.05
+1474 -0.45 0.85 -0.25
+1475 -0.35 0.85 -0.25
+1780 -0.45 0.85 -0.15
+1781 -0.35 0.85 -0.15
+2096 -0.45 0.85 -0.05
+2097 -0.35 0.85 -0.05
+1476 -0.25 0.85 -0.25
+1477 -0.15 0.85 -0.25
+1478 -0.05 0.85 -0.25
+1484 -0.15 0.95 -0.25
+1485 -0.05 0.95 -0.25
+1782 -0.25 0.85 -0.15
+1783 -0.15 0.85 -0.15
+1784 -0.05 0.85 -0.15
+1790 -0.25 0.95 -0.15
+1791 -0.15 0.95 -0.15
+1792 -0.05 0.95 -0.15
+2098 -0.25 0.85 -0.05
+2099 -0.15 0.85 -0.05
+2100 -0.05 0.85 -0.05
+2106 -0.25 0.95 -0.05
+2107 -0.15 0.95 -0.05
+2108 -0.05 0.95 -0.05
+1479 0.05 0.85 -0.25
+1480 0.15 0.85 -0.25
+1481 0.25 0.85 -0.25
+1486 0.05 0.95 -0.25
+1487 0.15 0.95 -0.25
+1785 0.05 0.85 -0.15
+1786 0.15 0.85 -0.15
+1787 0.25 0.85 -0.15
+1793 0.05 0.95 -0.15
+1794 0.15 0.95 -0.15
+1795 0.25 0.95 -0.15
+2101 0.05 0.85 -0.05
+2102 0.15 0.85 -0.05
+2103 0.25 0.85 -0.05
+2109 0.05 0.95 -0.05
+2110 0.15 0.95 -0.05
+2111 0.25 0.95 -0.05
+1482 0.35 0.85 -0.25
+1483 0.45 0.85 -0.25
+1788 0.35 0.85 -0.15
+1789 0.45 0.85 -0.15
+2104 0.35 0.85 -0.05
+2105 0.45 0.85 -0.05
+2118 -0.45 -0.85 0.05
+2119 -0.35 -0.85 0.05
+2434 -0.45 -0.85 0.15
+2435 -0.35 -0.85 0.15
+2740 -0.45 -0.85 0.25
+2741 -0.35 -0.85 0.25
+2112 -0.25 -0.95 0.05
+2113 -0.15 -0.95 0.05
+2114 -0.05 -0.95 0.05
+2120 -0.25 -0.85 0.05
+2121 -0.15 -0.85 0.05
+2122 -0.05 -0.85 0.05
+2428 -0.25 -0.95 0.15
+2429 -0.15 -0.95 0.15
+2430 -0.05 -0.95 0.15
+2436 -0.25 -0.85 0.15
+2437 -0.15 -0.85 0.15
+2438 -0.05 -0.85 0.15
+2736 -0.15 -0.95 0.25
+2737 -0.05 -0.95 0.25
+2742 -0.25 -0.85 0.25
+2743 -0.15 -0.85 0.25
+2744 -0.05 -0.85 0.25
+2115 0.05 -0.95 0.05
+2116 0.15 -0.95 0.05
+2117 0.25 -0.95 0.05
+2123 0.05 -0.85 0.05
+2124 0.15 -0.85 0.05
+2125 0.25 -0.85 0.05
+2431 0.05 -0.95 0.15
+2432 0.15 -0.95 0.15
+2433 0.25 -0.95 0.15
+2439 0.05 -0.85 0.15
+2440 0.15 -0.85 0.15
+2441 0.25 -0.85 0.15
+2738 0.05 -0.95 0.25
+2739 0.15 -0.95 0.25
+2745 0.05 -0.85 0.25
+2746 0.15 -0.85 0.25
+2747 0.25 -0.85 0.25
+2126 0.35 -0.85 0.05
+2127 0.45 -0.85 0.05
+2442 0.35 -0.85 0.15
+2443 0.45 -0.85 0.15
+2748 0.35 -0.85 0.25
+2749 0.45 -0.85 0.25
+2128 -0.65 -0.75 0.05
+2142 -0.75 -0.65 0.05
+2143 -0.65 -0.65 0.05
+2456 -0.65 -0.65 0.15
+2762 -0.65 -0.65 0.25
+2129 -0.55 -0.75 0.05
+2130 -0.45 -0.75 0.05
+2131 -0.35 -0.75 0.05
+2144 -0.55 -0.65 0.05
+2145 -0.45 -0.65 0.05
+2146 -0.35 -0.65 0.05
+2444 -0.55 -0.75 0.15
+2445 -0.45 -0.75 0.15
+2446 -0.35 -0.75 0.15
+2457 -0.55 -0.65 0.15
+2458 -0.45 -0.65 0.15
+2459 -0.35 -0.65 0.15
+2750 -0.55 -0.75 0.25
+2751 -0.45 -0.75 0.25
+2752 -0.35 -0.75 0.25
+2763 -0.55 -0.65 0.25
+2764 -0.45 -0.65 0.25
+2765 -0.35 -0.65 0.25
+2132 -0.25 -0.75 0.05
+2133 -0.15 -0.75 0.05
+2134 -0.05 -0.75 0.05
+2147 -0.25 -0.65 0.05
+2148 -0.15 -0.65 0.05
+2149 -0.05 -0.65 0.05
+2447 -0.25 -0.75 0.15
+2448 -0.15 -0.75 0.15
+2449 -0.05 -0.75 0.15
+2460 -0.25 -0.65 0.15
+2461 -0.15 -0.65 0.15
+2462 -0.05 -0.65 0.15
+2753 -0.25 -0.75 0.25
+2754 -0.15 -0.75 0.25
+2755 -0.05 -0.75 0.25
+2766 -0.25 -0.65 0.25
+2767 -0.15 -0.65 0.25
+2768 -0.05 -0.65 0.25
+2135 0.05 -0.75 0.05
+2136 0.15 -0.75 0.05
+2137 0.25 -0.75 0.05
+2150 0.05 -0.65 0.05
+2151 0.15 -0.65 0.05
+2152 0.25 -0.65 0.05
+2450 0.05 -0.75 0.15
+2451 0.15 -0.75 0.15
+2452 0.25 -0.75 0.15
+2463 0.05 -0.65 0.15
+2464 0.15 -0.65 0.15
+2465 0.25 -0.65 0.15
+2756 0.05 -0.75 0.25
+2757 0.15 -0.75 0.25
+2758 0.25 -0.75 0.25
+2769 0.05 -0.65 0.25
+2770 0.15 -0.65 0.25
+2771 0.25 -0.65 0.25
+2138 0.35 -0.75 0.05
+2139 0.45 -0.75 0.05
+2140 0.55 -0.75 0.05
+2153 0.35 -0.65 0.05
+2154 0.45 -0.65 0.05
+2155 0.55 -0.65 0.05
+2453 0.35 -0.75 0.15
+2454 0.45 -0.75 0.15
+2455 0.55 -0.75 0.15
+2466 0.35 -0.65 0.15
+2467 0.45 -0.65 0.15
+2468 0.55 -0.65 0.15
+2759 0.35 -0.75 0.25
+2760 0.45 -0.75 0.25
+2761 0.55 -0.75 0.25
+2772 0.35 -0.65 0.25
+2773 0.45 -0.65 0.25
+2774 0.55 -0.65 0.25
+2141 0.65 -0.75 0.05
+2156 0.65 -0.65 0.05
+2157 0.75 -0.65 0.05
+2469 0.65 -0.65 0.15
+2775 0.65 -0.65 0.25
+2174 -0.85 -0.45 0.05
+2192 -0.85 -0.35 0.05
+2486 -0.85 -0.45 0.15
+2504 -0.85 -0.35 0.15
+2792 -0.85 -0.45 0.25
+2810 -0.85 -0.35 0.25
+2158 -0.75 -0.55 0.05
+2159 -0.65 -0.55 0.05
+2175 -0.75 -0.45 0.05
+2176 -0.65 -0.45 0.05
+2193 -0.75 -0.35 0.05
+2194 -0.65 -0.35 0.05
+2470 -0.75 -0.55 0.15
+2471 -0.65 -0.55 0.15
+2487 -0.75 -0.45 0.15
+2488 -0.65 -0.45 0.15
+2505 -0.75 -0.35 0.15
+2506 -0.65 -0.35 0.15
+2776 -0.75 -0.55 0.25
+2777 -0.65 -0.55 0.25
+2793 -0.75 -0.45 0.25
+2794 -0.65 -0.45 0.25
+2811 -0.75 -0.35 0.25
+2812 -0.65 -0.35 0.25
+2160 -0.55 -0.55 0.05
+2161 -0.45 -0.55 0.05
+2162 -0.35 -0.55 0.05
+2177 -0.55 -0.45 0.05
+2178 -0.45 -0.45 0.05
+2179 -0.35 -0.45 0.05
+2195 -0.55 -0.35 0.05
+2196 -0.45 -0.35 0.05
+2197 -0.35 -0.35 0.05
+2472 -0.55 -0.55 0.15
+2473 -0.45 -0.55 0.15
+2474 -0.35 -0.55 0.15
+2489 -0.55 -0.45 0.15
+2490 -0.45 -0.45 0.15
+2491 -0.35 -0.45 0.15
+2507 -0.55 -0.35 0.15
+2508 -0.45 -0.35 0.15
+2509 -0.35 -0.35 0.15
+2778 -0.55 -0.55 0.25
+2779 -0.45 -0.55 0.25
+2780 -0.35 -0.55 0.25
+2795 -0.55 -0.45 0.25
+2796 -0.45 -0.45 0.25
+2797 -0.35 -0.45 0.25
+2813 -0.55 -0.35 0.25
+2814 -0.45 -0.35 0.25
+2815 -0.35 -0.35 0.25
+2163 -0.25 -0.55 0.05
+2164 -0.15 -0.55 0.05
+2165 -0.05 -0.55 0.05
+2180 -0.25 -0.45 0.05
+2181 -0.15 -0.45 0.05
+2182 -0.05 -0.45 0.05
+2198 -0.25 -0.35 0.05
+2199 -0.15 -0.35 0.05
+2200 -0.05 -0.35 0.05
+2475 -0.25 -0.55 0.15
+2476 -0.15 -0.55 0.15
+2477 -0.05 -0.55 0.15
+2492 -0.25 -0.45 0.15
+2493 -0.15 -0.45 0.15
+2494 -0.05 -0.45 0.15
+2510 -0.25 -0.35 0.15
+2511 -0.15 -0.35 0.15
+2512 -0.05 -0.35 0.15
+2781 -0.25 -0.55 0.25
+2782 -0.15 -0.55 0.25
+2783 -0.05 -0.55 0.25
+2798 -0.25 -0.45 0.25
+2799 -0.15 -0.45 0.25
+2800 -0.05 -0.45 0.25
+2816 -0.25 -0.35 0.25
+2817 -0.15 -0.35 0.25
+2818 -0.05 -0.35 0.25
+2166 0.05 -0.55 0.05
+2167 0.15 -0.55 0.05
+2168 0.25 -0.55 0.05
+2183 0.05 -0.45 0.05
+2184 0.15 -0.45 0.05
+2185 0.25 -0.45 0.05
+2201 0.05 -0.35 0.05
+2202 0.15 -0.35 0.05
+2203 0.25 -0.35 0.05
+2478 0.05 -0.55 0.15
+2479 0.15 -0.55 0.15
+2480 0.25 -0.55 0.15
+2495 0.05 -0.45 0.15
+2496 0.15 -0.45 0.15
+2497 0.25 -0.45 0.15
+2513 0.05 -0.35 0.15
+2514 0.15 -0.35 0.15
+2515 0.25 -0.35 0.15
+2784 0.05 -0.55 0.25
+2785 0.15 -0.55 0.25
+2786 0.25 -0.55 0.25
+2801 0.05 -0.45 0.25
+2802 0.15 -0.45 0.25
+2803 0.25 -0.45 0.25
+2819 0.05 -0.35 0.25
+2820 0.15 -0.35 0.25
+2821 0.25 -0.35 0.25
+2169 0.35 -0.55 0.05
+2170 0.45 -0.55 0.05
+2171 0.55 -0.55 0.05
+2186 0.35 -0.45 0.05
+2187 0.45 -0.45 0.05
+2188 0.55 -0.45 0.05
+2204 0.35 -0.35 0.05
+2205 0.45 -0.35 0.05
+2206 0.55 -0.35 0.05
+2481 0.35 -0.55 0.15
+2482 0.45 -0.55 0.15
+2483 0.55 -0.55 0.15
+2498 0.35 -0.45 0.15
+2499 0.45 -0.45 0.15
+2500 0.55 -0.45 0.15
+2516 0.35 -0.35 0.15
+2517 0.45 -0.35 0.15
+2518 0.55 -0.35 0.15
+2787 0.35 -0.55 0.25
+2788 0.45 -0.55 0.25
+2789 0.55 -0.55 0.25
+2804 0.35 -0.45 0.25
+2805 0.45 -0.45 0.25
+2806 0.55 -0.45 0.25
+2822 0.35 -0.35 0.25
+2823 0.45 -0.35 0.25
+2824 0.55 -0.35 0.25
+2172 0.65 -0.55 0.05
+2173 0.75 -0.55 0.05
+2189 0.65 -0.45 0.05
+2190 0.75 -0.45 0.05
+2207 0.65 -0.35 0.05
+2208 0.75 -0.35 0.05
+2484 0.65 -0.55 0.15
+2485 0.75 -0.55 0.15
+2501 0.65 -0.45 0.15
+2502 0.75 -0.45 0.15
+2519 0.65 -0.35 0.15
+2520 0.75 -0.35 0.15
+2790 0.65 -0.55 0.25
+2791 0.75 -0.55 0.25
+2807 0.65 -0.45 0.25
+2808 0.75 -0.45 0.25
+2825 0.65 -0.35 0.25
+2826 0.75 -0.35 0.25
+2191 0.85 -0.45 0.05
+2209 0.85 -0.35 0.05
+2503 0.85 -0.45 0.15
+2521 0.85 -0.35 0.15
+2809 0.85 -0.45 0.25
+2827 0.85 -0.35 0.25
+2210 -0.95 -0.25 0.05
+2211 -0.85 -0.25 0.05
+2230 -0.95 -0.15 0.05
+2231 -0.85 -0.15 0.05
+2250 -0.95 -0.05 0.05
+2251 -0.85 -0.05 0.05
+2522 -0.95 -0.25 0.15
+2523 -0.85 -0.25 0.15
+2542 -0.95 -0.15 0.15
+2543 -0.85 -0.15 0.15
+2562 -0.95 -0.05 0.15
+2563 -0.85 -0.05 0.15
+2828 -0.85 -0.25 0.25
+2846 -0.95 -0.15 0.25
+2847 -0.85 -0.15 0.25
+2866 -0.95 -0.05 0.25
+2867 -0.85 -0.05 0.25
+2212 -0.75 -0.25 0.05
+2213 -0.65 -0.25 0.05
+2232 -0.75 -0.15 0.05
+2233 -0.65 -0.15 0.05
+2252 -0.75 -0.05 0.05
+2253 -0.65 -0.05 0.05
+2524 -0.75 -0.25 0.15
+2525 -0.65 -0.25 0.15
+2544 -0.75 -0.15 0.15
+2545 -0.65 -0.15 0.15
+2564 -0.75 -0.05 0.15
+2565 -0.65 -0.05 0.15
+2829 -0.75 -0.25 0.25
+2830 -0.65 -0.25 0.25
+2848 -0.75 -0.15 0.25
+2849 -0.65 -0.15 0.25
+2868 -0.75 -0.05 0.25
+2869 -0.65 -0.05 0.25
+2214 -0.55 -0.25 0.05
+2215 -0.45 -0.25 0.05
+2216 -0.35 -0.25 0.05
+2234 -0.55 -0.15 0.05
+2235 -0.45 -0.15 0.05
+2236 -0.35 -0.15 0.05
+2254 -0.55 -0.05 0.05
+2255 -0.45 -0.05 0.05
+2256 -0.35 -0.05 0.05
+2526 -0.55 -0.25 0.15
+2527 -0.45 -0.25 0.15
+2528 -0.35 -0.25 0.15
+2546 -0.55 -0.15 0.15
+2547 -0.45 -0.15 0.15
+2548 -0.35 -0.15 0.15
+2566 -0.55 -0.05 0.15
+2567 -0.45 -0.05 0.15
+2568 -0.35 -0.05 0.15
+2831 -0.55 -0.25 0.25
+2832 -0.45 -0.25 0.25
+2833 -0.35 -0.25 0.25
+2850 -0.55 -0.15 0.25
+2851 -0.45 -0.15 0.25
+2852 -0.35 -0.15 0.25
+2870 -0.55 -0.05 0.25
+2871 -0.45 -0.05 0.25
+2872 -0.35 -0.05 0.25
+2217 -0.25 -0.25 0.05
+2218 -0.15 -0.25 0.05
+2219 -0.05 -0.25 0.05
+2237 -0.25 -0.15 0.05
+2238 -0.15 -0.15 0.05
+2239 -0.05 -0.15 0.05
+2257 -0.25 -0.05 0.05
+2258 -0.15 -0.05 0.05
+2259 -0.05 -0.05 0.05
+2529 -0.25 -0.25 0.15
+2530 -0.15 -0.25 0.15
+2531 -0.05 -0.25 0.15
+2549 -0.25 -0.15 0.15
+2550 -0.15 -0.15 0.15
+2551 -0.05 -0.15 0.15
+2569 -0.25 -0.05 0.15
+2570 -0.15 -0.05 0.15
+2571 -0.05 -0.05 0.15
+2834 -0.25 -0.25 0.25
+2835 -0.15 -0.25 0.25
+2836 -0.05 -0.25 0.25
+2853 -0.25 -0.15 0.25
+2854 -0.15 -0.15 0.25
+2855 -0.05 -0.15 0.25
+2873 -0.25 -0.05 0.25
+2874 -0.15 -0.05 0.25
+2875 -0.05 -0.05 0.25
+2220 0.05 -0.25 0.05
+2221 0.15 -0.25 0.05
+2222 0.25 -0.25 0.05
+2240 0.05 -0.15 0.05
+2241 0.15 -0.15 0.05
+2242 0.25 -0.15 0.05
+2260 0.05 -0.05 0.05
+2261 0.15 -0.05 0.05
+2262 0.25 -0.05 0.05
+2532 0.05 -0.25 0.15
+2533 0.15 -0.25 0.15
+2534 0.25 -0.25 0.15
+2552 0.05 -0.15 0.15
+2553 0.15 -0.15 0.15
+2554 0.25 -0.15 0.15
+2572 0.05 -0.05 0.15
+2573 0.15 -0.05 0.15
+2574 0.25 -0.05 0.15
+2837 0.05 -0.25 0.25
+2838 0.15 -0.25 0.25
+2839 0.25 -0.25 0.25
+2856 0.05 -0.15 0.25
+2857 0.15 -0.15 0.25
+2858 0.25 -0.15 0.25
+2876 0.05 -0.05 0.25
+2877 0.15 -0.05 0.25
+2878 0.25 -0.05 0.25
+2223 0.35 -0.25 0.05
+2224 0.45 -0.25 0.05
+2225 0.55 -0.25 0.05
+2243 0.35 -0.15 0.05
+2244 0.45 -0.15 0.05
+2245 0.55 -0.15 0.05
+2263 0.35 -0.05 0.05
+2264 0.45 -0.05 0.05
+2265 0.55 -0.05 0.05
+2535 0.35 -0.25 0.15
+2536 0.45 -0.25 0.15
+2537 0.55 -0.25 0.15
+2555 0.35 -0.15 0.15
+2556 0.45 -0.15 0.15
+2557 0.55 -0.15 0.15
+2575 0.35 -0.05 0.15
+2576 0.45 -0.05 0.15
+2577 0.55 -0.05 0.15
+2840 0.35 -0.25 0.25
+2841 0.45 -0.25 0.25
+2842 0.55 -0.25 0.25
+2859 0.35 -0.15 0.25
+2860 0.45 -0.15 0.25
+2861 0.55 -0.15 0.25
+2879 0.35 -0.05 0.25
+2880 0.45 -0.05 0.25
+2881 0.55 -0.05 0.25
+2226 0.65 -0.25 0.05
+2227 0.75 -0.25 0.05
+2246 0.65 -0.15 0.05
+2247 0.75 -0.15 0.05
+2266 0.65 -0.05 0.05
+2267 0.75 -0.05 0.05
+2538 0.65 -0.25 0.15
+2539 0.75 -0.25 0.15
+2558 0.65 -0.15 0.15
+2559 0.75 -0.15 0.15
+2578 0.65 -0.05 0.15
+2579 0.75 -0.05 0.15
+2843 0.65 -0.25 0.25
+2844 0.75 -0.25 0.25
+2862 0.65 -0.15 0.25
+2863 0.75 -0.15 0.25
+2882 0.65 -0.05 0.25
+2883 0.75 -0.05 0.25
+2228 0.85 -0.25 0.05
+2229 0.95 -0.25 0.05
+2248 0.85 -0.15 0.05
+2249 0.95 -0.15 0.05
+2268 0.85 -0.05 0.05
+2269 0.95 -0.05 0.05
+2540 0.85 -0.25 0.15
+2541 0.95 -0.25 0.15
+2560 0.85 -0.15 0.15
+2561 0.95 -0.15 0.15
+2580 0.85 -0.05 0.15
+2581 0.95 -0.05 0.15
+2845 0.85 -0.25 0.25
+2864 0.85 -0.15 0.25
+2865 0.95 -0.15 0.25
+2884 0.85 -0.05 0.25
+2885 0.95 -0.05 0.25
+2270 -0.95 0.05 0.05
+2271 -0.85 0.05 0.05
+2290 -0.95 0.15 0.05
+2291 -0.85 0.15 0.05
+2310 -0.95 0.25 0.05
+2311 -0.85 0.25 0.05
+2582 -0.95 0.05 0.15
+2583 -0.85 0.05 0.15
+2602 -0.95 0.15 0.15
+2603 -0.85 0.15 0.15
+2622 -0.95 0.25 0.15
+2623 -0.85 0.25 0.15
+2886 -0.95 0.05 0.25
+2887 -0.85 0.05 0.25
+2906 -0.95 0.15 0.25
+2907 -0.85 0.15 0.25
+2926 -0.85 0.25 0.25
+2272 -0.75 0.05 0.05
+2273 -0.65 0.05 0.05
+2292 -0.75 0.15 0.05
+2293 -0.65 0.15 0.05
+2312 -0.75 0.25 0.05
+2313 -0.65 0.25 0.05
+2584 -0.75 0.05 0.15
+2585 -0.65 0.05 0.15
+2604 -0.75 0.15 0.15
+2605 -0.65 0.15 0.15
+2624 -0.75 0.25 0.15
+2625 -0.65 0.25 0.15
+2888 -0.75 0.05 0.25
+2889 -0.65 0.05 0.25
+2908 -0.75 0.15 0.25
+2909 -0.65 0.15 0.25
+2927 -0.75 0.25 0.25
+2928 -0.65 0.25 0.25
+2274 -0.55 0.05 0.05
+2275 -0.45 0.05 0.05
+2276 -0.35 0.05 0.05
+2294 -0.55 0.15 0.05
+2295 -0.45 0.15 0.05
+2296 -0.35 0.15 0.05
+2314 -0.55 0.25 0.05
+2315 -0.45 0.25 0.05
+2316 -0.35 0.25 0.05
+2586 -0.55 0.05 0.15
+2587 -0.45 0.05 0.15
+2588 -0.35 0.05 0.15
+2606 -0.55 0.15 0.15
+2607 -0.45 0.15 0.15
+2608 -0.35 0.15 0.15
+2626 -0.55 0.25 0.15
+2627 -0.45 0.25 0.15
+2628 -0.35 0.25 0.15
+2890 -0.55 0.05 0.25
+2891 -0.45 0.05 0.25
+2892 -0.35 0.05 0.25
+2910 -0.55 0.15 0.25
+2911 -0.45 0.15 0.25
+2912 -0.35 0.15 0.25
+2929 -0.55 0.25 0.25
+2930 -0.45 0.25 0.25
+2931 -0.35 0.25 0.25
+2277 -0.25 0.05 0.05
+2278 -0.15 0.05 0.05
+2279 -0.05 0.05 0.05
+2297 -0.25 0.15 0.05
+2298 -0.15 0.15 0.05
+2299 -0.05 0.15 0.05
+2317 -0.25 0.25 0.05
+2318 -0.15 0.25 0.05
+2319 -0.05 0.25 0.05
+2589 -0.25 0.05 0.15
+2590 -0.15 0.05 0.15
+2591 -0.05 0.05 0.15
+2609 -0.25 0.15 0.15
+2610 -0.15 0.15 0.15
+2611 -0.05 0.15 0.15
+2629 -0.25 0.25 0.15
+2630 -0.15 0.25 0.15
+2631 -0.05 0.25 0.15
+2893 -0.25 0.05 0.25
+2894 -0.15 0.05 0.25
+2895 -0.05 0.05 0.25
+2913 -0.25 0.15 0.25
+2914 -0.15 0.15 0.25
+2915 -0.05 0.15 0.25
+2932 -0.25 0.25 0.25
+2933 -0.15 0.25 0.25
+2934 -0.05 0.25 0.25
+2280 0.05 0.05 0.05
+2281 0.15 0.05 0.05
+2282 0.25 0.05 0.05
+2300 0.05 0.15 0.05
+2301 0.15 0.15 0.05
+2302 0.25 0.15 0.05
+2320 0.05 0.25 0.05
+2321 0.15 0.25 0.05
+2322 0.25 0.25 0.05
+2592 0.05 0.05 0.15
+2593 0.15 0.05 0.15
+2594 0.25 0.05 0.15
+2612 0.05 0.15 0.15
+2613 0.15 0.15 0.15
+2614 0.25 0.15 0.15
+2632 0.05 0.25 0.15
+2633 0.15 0.25 0.15
+2634 0.25 0.25 0.15
+2896 0.05 0.05 0.25
+2897 0.15 0.05 0.25
+2898 0.25 0.05 0.25
+2916 0.05 0.15 0.25
+2917 0.15 0.15 0.25
+2918 0.25 0.15 0.25
+2935 0.05 0.25 0.25
+2936 0.15 0.25 0.25
+2937 0.25 0.25 0.25
+2283 0.35 0.05 0.05
+2284 0.45 0.05 0.05
+2285 0.55 0.05 0.05
+2303 0.35 0.15 0.05
+2304 0.45 0.15 0.05
+2305 0.55 0.15 0.05
+2323 0.35 0.25 0.05
+2324 0.45 0.25 0.05
+2325 0.55 0.25 0.05
+2595 0.35 0.05 0.15
+2596 0.45 0.05 0.15
+2597 0.55 0.05 0.15
+2615 0.35 0.15 0.15
+2616 0.45 0.15 0.15
+2617 0.55 0.15 0.15
+2635 0.35 0.25 0.15
+2636 0.45 0.25 0.15
+2637 0.55 0.25 0.15
+2899 0.35 0.05 0.25
+2900 0.45 0.05 0.25
+2901 0.55 0.05 0.25
+2919 0.35 0.15 0.25
+2920 0.45 0.15 0.25
+2921 0.55 0.15 0.25
+2938 0.35 0.25 0.25
+2939 0.45 0.25 0.25
+2940 0.55 0.25 0.25
+2286 0.65 0.05 0.05
+2287 0.75 0.05 0.05
+2306 0.65 0.15 0.05
+2307 0.75 0.15 0.05
+2326 0.65 0.25 0.05
+2327 0.75 0.25 0.05
+2598 0.65 0.05 0.15
+2599 0.75 0.05 0.15
+2618 0.65 0.15 0.15
+2619 0.75 0.15 0.15
+2638 0.65 0.25 0.15
+2639 0.75 0.25 0.15
+2902 0.65 0.05 0.25
+2903 0.75 0.05 0.25
+2922 0.65 0.15 0.25
+2923 0.75 0.15 0.25
+2941 0.65 0.25 0.25
+2942 0.75 0.25 0.25
+2288 0.85 0.05 0.05
+2289 0.95 0.05 0.05
+2308 0.85 0.15 0.05
+2309 0.95 0.15 0.05
+2328 0.85 0.25 0.05
+2329 0.95 0.25 0.05
+2600 0.85 0.05 0.15
+2601 0.95 0.05 0.15
+2620 0.85 0.15 0.15
+2621 0.95 0.15 0.15
+2640 0.85 0.25 0.15
+2641 0.95 0.25 0.15
+2904 0.85 0.05 0.25
+2905 0.95 0.05 0.25
+2924 0.85 0.15 0.25
+2925 0.95 0.15 0.25
+2943 0.85 0.25 0.25
+2330 -0.85 0.35 0.05
+2348 -0.85 0.45 0.05
+2642 -0.85 0.35 0.15
+2660 -0.85 0.45 0.15
+2944 -0.85 0.35 0.25
+2962 -0.85 0.45 0.25
+2331 -0.75 0.35 0.05
+2332 -0.65 0.35 0.05
+2349 -0.75 0.45 0.05
+2350 -0.65 0.45 0.05
+2366 -0.75 0.55 0.05
+2367 -0.65 0.55 0.05
+2643 -0.75 0.35 0.15
+2644 -0.65 0.35 0.15
+2661 -0.75 0.45 0.15
+2662 -0.65 0.45 0.15
+2678 -0.75 0.55 0.15
+2679 -0.65 0.55 0.15
+2945 -0.75 0.35 0.25
+2946 -0.65 0.35 0.25
+2963 -0.75 0.45 0.25
+2964 -0.65 0.45 0.25
+2980 -0.75 0.55 0.25
+2981 -0.65 0.55 0.25
+2333 -0.55 0.35 0.05
+2334 -0.45 0.35 0.05
+2335 -0.35 0.35 0.05
+2351 -0.55 0.45 0.05
+2352 -0.45 0.45 0.05
+2353 -0.35 0.45 0.05
+2368 -0.55 0.55 0.05
+2369 -0.45 0.55 0.05
+2370 -0.35 0.55 0.05
+2645 -0.55 0.35 0.15
+2646 -0.45 0.35 0.15
+2647 -0.35 0.35 0.15
+2663 -0.55 0.45 0.15
+2664 -0.45 0.45 0.15
+2665 -0.35 0.45 0.15
+2680 -0.55 0.55 0.15
+2681 -0.45 0.55 0.15
+2682 -0.35 0.55 0.15
+2947 -0.55 0.35 0.25
+2948 -0.45 0.35 0.25
+2949 -0.35 0.35 0.25
+2965 -0.55 0.45 0.25
+2966 -0.45 0.45 0.25
+2967 -0.35 0.45 0.25
+2982 -0.55 0.55 0.25
+2983 -0.45 0.55 0.25
+2984 -0.35 0.55 0.25
+2336 -0.25 0.35 0.05
+2337 -0.15 0.35 0.05
+2338 -0.05 0.35 0.05
+2354 -0.25 0.45 0.05
+2355 -0.15 0.45 0.05
+2356 -0.05 0.45 0.05
+2371 -0.25 0.55 0.05
+2372 -0.15 0.55 0.05
+2373 -0.05 0.55 0.05
+2648 -0.25 0.35 0.15
+2649 -0.15 0.35 0.15
+2650 -0.05 0.35 0.15
+2666 -0.25 0.45 0.15
+2667 -0.15 0.45 0.15
+2668 -0.05 0.45 0.15
+2683 -0.25 0.55 0.15
+2684 -0.15 0.55 0.15
+2685 -0.05 0.55 0.15
+2950 -0.25 0.35 0.25
+2951 -0.15 0.35 0.25
+2952 -0.05 0.35 0.25
+2968 -0.25 0.45 0.25
+2969 -0.15 0.45 0.25
+2970 -0.05 0.45 0.25
+2985 -0.25 0.55 0.25
+2986 -0.15 0.55 0.25
+2987 -0.05 0.55 0.25
+2339 0.05 0.35 0.05
+2340 0.15 0.35 0.05
+2341 0.25 0.35 0.05
+2357 0.05 0.45 0.05
+2358 0.15 0.45 0.05
+2359 0.25 0.45 0.05
+2374 0.05 0.55 0.05
+2375 0.15 0.55 0.05
+2376 0.25 0.55 0.05
+2651 0.05 0.35 0.15
+2652 0.15 0.35 0.15
+2653 0.25 0.35 0.15
+2669 0.05 0.45 0.15
+2670 0.15 0.45 0.15
+2671 0.25 0.45 0.15
+2686 0.05 0.55 0.15
+2687 0.15 0.55 0.15
+2688 0.25 0.55 0.15
+2953 0.05 0.35 0.25
+2954 0.15 0.35 0.25
+2955 0.25 0.35 0.25
+2971 0.05 0.45 0.25
+2972 0.15 0.45 0.25
+2973 0.25 0.45 0.25
+2988 0.05 0.55 0.25
+2989 0.15 0.55 0.25
+2990 0.25 0.55 0.25
+2342 0.35 0.35 0.05
+2343 0.45 0.35 0.05
+2344 0.55 0.35 0.05
+2360 0.35 0.45 0.05
+2361 0.45 0.45 0.05
+2362 0.55 0.45 0.05
+2377 0.35 0.55 0.05
+2378 0.45 0.55 0.05
+2379 0.55 0.55 0.05
+2654 0.35 0.35 0.15
+2655 0.45 0.35 0.15
+2656 0.55 0.35 0.15
+2672 0.35 0.45 0.15
+2673 0.45 0.45 0.15
+2674 0.55 0.45 0.15
+2689 0.35 0.55 0.15
+2690 0.45 0.55 0.15
+2691 0.55 0.55 0.15
+2956 0.35 0.35 0.25
+2957 0.45 0.35 0.25
+2958 0.55 0.35 0.25
+2974 0.35 0.45 0.25
+2975 0.45 0.45 0.25
+2976 0.55 0.45 0.25
+2991 0.35 0.55 0.25
+2992 0.45 0.55 0.25
+2993 0.55 0.55 0.25
+2345 0.65 0.35 0.05
+2346 0.75 0.35 0.05
+2363 0.65 0.45 0.05
+2364 0.75 0.45 0.05
+2380 0.65 0.55 0.05
+2381 0.75 0.55 0.05
+2657 0.65 0.35 0.15
+2658 0.75 0.35 0.15
+2675 0.65 0.45 0.15
+2676 0.75 0.45 0.15
+2692 0.65 0.55 0.15
+2693 0.75 0.55 0.15
+2959 0.65 0.35 0.25
+2960 0.75 0.35 0.25
+2977 0.65 0.45 0.25
+2978 0.75 0.45 0.25
+2994 0.65 0.55 0.25
+2995 0.75 0.55 0.25
+2347 0.85 0.35 0.05
+2365 0.85 0.45 0.05
+2659 0.85 0.35 0.15
+2677 0.85 0.45 0.15
+2961 0.85 0.35 0.25
+2979 0.85 0.45 0.25
+2382 -0.75 0.65 0.05
+2383 -0.65 0.65 0.05
+2398 -0.65 0.75 0.05
+2694 -0.65 0.65 0.15
+2996 -0.65 0.65 0.25
+2384 -0.55 0.65 0.05
+2385 -0.45 0.65 0.05
+2386 -0.35 0.65 0.05
+2399 -0.55 0.75 0.05
+2400 -0.45 0.75 0.05
+2401 -0.35 0.75 0.05
+2695 -0.55 0.65 0.15
+2696 -0.45 0.65 0.15
+2697 -0.35 0.65 0.15
+2708 -0.55 0.75 0.15
+2709 -0.45 0.75 0.15
+2710 -0.35 0.75 0.15
+2997 -0.55 0.65 0.25
+2998 -0.45 0.65 0.25
+2999 -0.35 0.65 0.25
+3010 -0.55 0.75 0.25
+3011 -0.45 0.75 0.25
+3012 -0.35 0.75 0.25
+2387 -0.25 0.65 0.05
+2388 -0.15 0.65 0.05
+2389 -0.05 0.65 0.05
+2402 -0.25 0.75 0.05
+2403 -0.15 0.75 0.05
+2404 -0.05 0.75 0.05
+2698 -0.25 0.65 0.15
+2699 -0.15 0.65 0.15
+2700 -0.05 0.65 0.15
+2711 -0.25 0.75 0.15
+2712 -0.15 0.75 0.15
+2713 -0.05 0.75 0.15
+3000 -0.25 0.65 0.25
+3001 -0.15 0.65 0.25
+3002 -0.05 0.65 0.25
+3013 -0.25 0.75 0.25
+3014 -0.15 0.75 0.25
+3015 -0.05 0.75 0.25
+2390 0.05 0.65 0.05
+2391 0.15 0.65 0.05
+2392 0.25 0.65 0.05
+2405 0.05 0.75 0.05
+2406 0.15 0.75 0.05
+2407 0.25 0.75 0.05
+2701 0.05 0.65 0.15
+2702 0.15 0.65 0.15
+2703 0.25 0.65 0.15
+2714 0.05 0.75 0.15
+2715 0.15 0.75 0.15
+2716 0.25 0.75 0.15
+3003 0.05 0.65 0.25
+3004 0.15 0.65 0.25
+3005 0.25 0.65 0.25
+3016 0.05 0.75 0.25
+3017 0.15 0.75 0.25
+3018 0.25 0.75 0.25
+2393 0.35 0.65 0.05
+2394 0.45 0.65 0.05
+2395 0.55 0.65 0.05
+2408 0.35 0.75 0.05
+2409 0.45 0.75 0.05
+2410 0.55 0.75 0.05
+2704 0.35 0.65 0.15
+2705 0.45 0.65 0.15
+2706 0.55 0.65 0.15
+2717 0.35 0.75 0.15
+2718 0.45 0.75 0.15
+2719 0.55 0.75 0.15
+3006 0.35 0.65 0.25
+3007 0.45 0.65 0.25
+3008 0.55 0.65 0.25
+3019 0.35 0.75 0.25
+3020 0.45 0.75 0.25
+3021 0.55 0.75 0.25
+2396 0.65 0.65 0.05
+2397 0.75 0.65 0.05
+2411 0.65 0.75 0.05
+2707 0.65 0.65 0.15
+3009 0.65 0.65 0.25
+2412 -0.45 0.85 0.05
+2413 -0.35 0.85 0.05
+2720 -0.45 0.85 0.15
+2721 -0.35 0.85 0.15
+3022 -0.45 0.85 0.25
+3023 -0.35 0.85 0.25
+2414 -0.25 0.85 0.05
+2415 -0.15 0.85 0.05
+2416 -0.05 0.85 0.05
+2422 -0.25 0.95 0.05
+2423 -0.15 0.95 0.05
+2424 -0.05 0.95 0.05
+2722 -0.25 0.85 0.15
+2723 -0.15 0.85 0.15
+2724 -0.05 0.85 0.15
+2730 -0.25 0.95 0.15
+2731 -0.15 0.95 0.15
+2732 -0.05 0.95 0.15
+3024 -0.25 0.85 0.25
+3025 -0.15 0.85 0.25
+3026 -0.05 0.85 0.25
+3032 -0.15 0.95 0.25
+3033 -0.05 0.95 0.25
+2417 0.05 0.85 0.05
+2418 0.15 0.85 0.05
+2419 0.25 0.85 0.05
+2425 0.05 0.95 0.05
+2426 0.15 0.95 0.05
+2427 0.25 0.95 0.05
+2725 0.05 0.85 0.15
+2726 0.15 0.85 0.15
+2727 0.25 0.85 0.15
+2733 0.05 0.95 0.15
+2734 0.15 0.95 0.15
+2735 0.25 0.95 0.15
+3027 0.05 0.85 0.25
+3028 0.15 0.85 0.25
+3029 0.25 0.85 0.25
+3034 0.05 0.95 0.25
+3035 0.15 0.95 0.25
+2420 0.35 0.85 0.05
+2421 0.45 0.85 0.05
+2728 0.35 0.85 0.15
+2729 0.45 0.85 0.15
+3030 0.35 0.85 0.25
+3031 0.45 0.85 0.25
+3036 -0.35 -0.85 0.35
+3037 -0.25 -0.85 0.35
+3038 -0.15 -0.85 0.35
+3039 -0.05 -0.85 0.35
+3312 -0.25 -0.85 0.45
+3313 -0.15 -0.85 0.45
+3314 -0.05 -0.85 0.45
+3040 0.05 -0.85 0.35
+3041 0.15 -0.85 0.35
+3042 0.25 -0.85 0.35
+3315 0.05 -0.85 0.45
+3316 0.15 -0.85 0.45
+3317 0.25 -0.85 0.45
+3043 0.35 -0.85 0.35
+3056 -0.65 -0.65 0.35
+3044 -0.55 -0.75 0.35
+3045 -0.45 -0.75 0.35
+3046 -0.35 -0.75 0.35
+3057 -0.55 -0.65 0.35
+3058 -0.45 -0.65 0.35
+3059 -0.35 -0.65 0.35
+3318 -0.45 -0.75 0.45
+3319 -0.35 -0.75 0.45
+3328 -0.55 -0.65 0.45
+3329 -0.45 -0.65 0.45
+3330 -0.35 -0.65 0.45
+3568 -0.35 -0.75 0.55
+3576 -0.45 -0.65 0.55
+3577 -0.35 -0.65 0.55
+3047 -0.25 -0.75 0.35
+3048 -0.15 -0.75 0.35
+3049 -0.05 -0.75 0.35
+3060 -0.25 -0.65 0.35
+3061 -0.15 -0.65 0.35
+3062 -0.05 -0.65 0.35
+3320 -0.25 -0.75 0.45
+3321 -0.15 -0.75 0.45
+3322 -0.05 -0.75 0.45
+3331 -0.25 -0.65 0.45
+3332 -0.15 -0.65 0.45
+3333 -0.05 -0.65 0.45
+3569 -0.25 -0.75 0.55
+3570 -0.15 -0.75 0.55
+3571 -0.05 -0.75 0.55
+3578 -0.25 -0.65 0.55
+3579 -0.15 -0.65 0.55
+3580 -0.05 -0.65 0.55
+3050 0.05 -0.75 0.35
+3051 0.15 -0.75 0.35
+3052 0.25 -0.75 0.35
+3063 0.05 -0.65 0.35
+3064 0.15 -0.65 0.35
+3065 0.25 -0.65 0.35
+3323 0.05 -0.75 0.45
+3324 0.15 -0.75 0.45
+3325 0.25 -0.75 0.45
+3334 0.05 -0.65 0.45
+3335 0.15 -0.65 0.45
+3336 0.25 -0.65 0.45
+3572 0.05 -0.75 0.55
+3573 0.15 -0.75 0.55
+3574 0.25 -0.75 0.55
+3581 0.05 -0.65 0.55
+3582 0.15 -0.65 0.55
+3583 0.25 -0.65 0.55
+3053 0.35 -0.75 0.35
+3054 0.45 -0.75 0.35
+3055 0.55 -0.75 0.35
+3066 0.35 -0.65 0.35
+3067 0.45 -0.65 0.35
+3068 0.55 -0.65 0.35
+3326 0.35 -0.75 0.45
+3327 0.45 -0.75 0.45
+3337 0.35 -0.65 0.45
+3338 0.45 -0.65 0.45
+3339 0.55 -0.65 0.45
+3575 0.35 -0.75 0.55
+3584 0.35 -0.65 0.55
+3585 0.45 -0.65 0.55
+3069 0.65 -0.65 0.35
+3102 -0.85 -0.35 0.35
+3070 -0.75 -0.55 0.35
+3071 -0.65 -0.55 0.35
+3086 -0.75 -0.45 0.35
+3087 -0.65 -0.45 0.35
+3103 -0.75 -0.35 0.35
+3104 -0.65 -0.35 0.35
+3340 -0.65 -0.55 0.45
+3354 -0.75 -0.45 0.45
+3355 -0.65 -0.45 0.45
+3370 -0.75 -0.35 0.45
+3371 -0.65 -0.35 0.45
+3598 -0.65 -0.45 0.55
+3612 -0.75 -0.35 0.55
+3613 -0.65 -0.35 0.55
+3072 -0.55 -0.55 0.35
+3073 -0.45 -0.55 0.35
+3074 -0.35 -0.55 0.35
+3088 -0.55 -0.45 0.35
+3089 -0.45 -0.45 0.35
+3090 -0.35 -0.45 0.35
+3105 -0.55 -0.35 0.35
+3106 -0.45 -0.35 0.35
+3107 -0.35 -0.35 0.35
+3341 -0.55 -0.55 0.45
+3342 -0.45 -0.55 0.45
+3343 -0.35 -0.55 0.45
+3356 -0.55 -0.45 0.45
+3357 -0.45 -0.45 0.45
+3358 -0.35 -0.45 0.45
+3372 -0.55 -0.35 0.45
+3373 -0.45 -0.35 0.45
+3374 -0.35 -0.35 0.45
+3586 -0.55 -0.55 0.55
+3587 -0.45 -0.55 0.55
+3588 -0.35 -0.55 0.55
+3599 -0.55 -0.45 0.55
+3600 -0.45 -0.45 0.55
+3601 -0.35 -0.45 0.55
+3614 -0.55 -0.35 0.55
+3615 -0.45 -0.35 0.55
+3616 -0.35 -0.35 0.55
+3075 -0.25 -0.55 0.35
+3076 -0.15 -0.55 0.35
+3077 -0.05 -0.55 0.35
+3091 -0.25 -0.45 0.35
+3092 -0.15 -0.45 0.35
+3093 -0.05 -0.45 0.35
+3108 -0.25 -0.35 0.35
+3109 -0.15 -0.35 0.35
+3110 -0.05 -0.35 0.35
+3344 -0.25 -0.55 0.45
+3345 -0.15 -0.55 0.45
+3346 -0.05 -0.55 0.45
+3359 -0.25 -0.45 0.45
+3360 -0.15 -0.45 0.45
+3361 -0.05 -0.45 0.45
+3375 -0.25 -0.35 0.45
+3376 -0.15 -0.35 0.45
+3377 -0.05 -0.35 0.45
+3589 -0.25 -0.55 0.55
+3590 -0.15 -0.55 0.55
+3591 -0.05 -0.55 0.55
+3602 -0.25 -0.45 0.55
+3603 -0.15 -0.45 0.55
+3604 -0.05 -0.45 0.55
+3617 -0.25 -0.35 0.55
+3618 -0.15 -0.35 0.55
+3619 -0.05 -0.35 0.55
+3078 0.05 -0.55 0.35
+3079 0.15 -0.55 0.35
+3080 0.25 -0.55 0.35
+3094 0.05 -0.45 0.35
+3095 0.15 -0.45 0.35
+3096 0.25 -0.45 0.35
+3111 0.05 -0.35 0.35
+3112 0.15 -0.35 0.35
+3113 0.25 -0.35 0.35
+3347 0.05 -0.55 0.45
+3348 0.15 -0.55 0.45
+3349 0.25 -0.55 0.45
+3362 0.05 -0.45 0.45
+3363 0.15 -0.45 0.45
+3364 0.25 -0.45 0.45
+3378 0.05 -0.35 0.45
+3379 0.15 -0.35 0.45
+3380 0.25 -0.35 0.45
+3592 0.05 -0.55 0.55
+3593 0.15 -0.55 0.55
+3594 0.25 -0.55 0.55
+3605 0.05 -0.45 0.55
+3606 0.15 -0.45 0.55
+3607 0.25 -0.45 0.55
+3620 0.05 -0.35 0.55
+3621 0.15 -0.35 0.55
+3622 0.25 -0.35 0.55
+3081 0.35 -0.55 0.35
+3082 0.45 -0.55 0.35
+3083 0.55 -0.55 0.35
+3097 0.35 -0.45 0.35
+3098 0.45 -0.45 0.35
+3099 0.55 -0.45 0.35
+3114 0.35 -0.35 0.35
+3115 0.45 -0.35 0.35
+3116 0.55 -0.35 0.35
+3350 0.35 -0.55 0.45
+3351 0.45 -0.55 0.45
+3352 0.55 -0.55 0.45
+3365 0.35 -0.45 0.45
+3366 0.45 -0.45 0.45
+3367 0.55 -0.45 0.45
+3381 0.35 -0.35 0.45
+3382 0.45 -0.35 0.45
+3383 0.55 -0.35 0.45
+3595 0.35 -0.55 0.55
+3596 0.45 -0.55 0.55
+3597 0.55 -0.55 0.55
+3608 0.35 -0.45 0.55
+3609 0.45 -0.45 0.55
+3610 0.55 -0.45 0.55
+3623 0.35 -0.35 0.55
+3624 0.45 -0.35 0.55
+3625 0.55 -0.35 0.55
+3084 0.65 -0.55 0.35
+3085 0.75 -0.55 0.35
+3100 0.65 -0.45 0.35
+3101 0.75 -0.45 0.35
+3117 0.65 -0.35 0.35
+3118 0.75 -0.35 0.35
+3353 0.65 -0.55 0.45
+3368 0.65 -0.45 0.45
+3369 0.75 -0.45 0.45
+3384 0.65 -0.35 0.45
+3385 0.75 -0.35 0.45
+3611 0.65 -0.45 0.55
+3626 0.65 -0.35 0.55
+3627 0.75 -0.35 0.55
+3119 0.85 -0.35 0.35
+3120 -0.85 -0.25 0.35
+3138 -0.85 -0.15 0.35
+3156 -0.85 -0.05 0.35
+3386 -0.85 -0.25 0.45
+3404 -0.85 -0.15 0.45
+3422 -0.85 -0.05 0.45
+3121 -0.75 -0.25 0.35
+3122 -0.65 -0.25 0.35
+3139 -0.75 -0.15 0.35
+3140 -0.65 -0.15 0.35
+3157 -0.75 -0.05 0.35
+3158 -0.65 -0.05 0.35
+3387 -0.75 -0.25 0.45
+3388 -0.65 -0.25 0.45
+3405 -0.75 -0.15 0.45
+3406 -0.65 -0.15 0.45
+3423 -0.75 -0.05 0.45
+3424 -0.65 -0.05 0.45
+3628 -0.75 -0.25 0.55
+3629 -0.65 -0.25 0.55
+3644 -0.75 -0.15 0.55
+3645 -0.65 -0.15 0.55
+3660 -0.75 -0.05 0.55
+3661 -0.65 -0.05 0.55
+3123 -0.55 -0.25 0.35
+3124 -0.45 -0.25 0.35
+3125 -0.35 -0.25 0.35
+3141 -0.55 -0.15 0.35
+3142 -0.45 -0.15 0.35
+3143 -0.35 -0.15 0.35
+3159 -0.55 -0.05 0.35
+3160 -0.45 -0.05 0.35
+3161 -0.35 -0.05 0.35
+3389 -0.55 -0.25 0.45
+3390 -0.45 -0.25 0.45
+3391 -0.35 -0.25 0.45
+3407 -0.55 -0.15 0.45
+3408 -0.45 -0.15 0.45
+3409 -0.35 -0.15 0.45
+3425 -0.55 -0.05 0.45
+3426 -0.45 -0.05 0.45
+3427 -0.35 -0.05 0.45
+3630 -0.55 -0.25 0.55
+3631 -0.45 -0.25 0.55
+3632 -0.35 -0.25 0.55
+3646 -0.55 -0.15 0.55
+3647 -0.45 -0.15 0.55
+3648 -0.35 -0.15 0.55
+3662 -0.55 -0.05 0.55
+3663 -0.45 -0.05 0.55
+3664 -0.35 -0.05 0.55
+3126 -0.25 -0.25 0.35
+3127 -0.15 -0.25 0.35
+3128 -0.05 -0.25 0.35
+3144 -0.25 -0.15 0.35
+3145 -0.15 -0.15 0.35
+3146 -0.05 -0.15 0.35
+3162 -0.25 -0.05 0.35
+3163 -0.15 -0.05 0.35
+3164 -0.05 -0.05 0.35
+3392 -0.25 -0.25 0.45
+3393 -0.15 -0.25 0.45
+3394 -0.05 -0.25 0.45
+3410 -0.25 -0.15 0.45
+3411 -0.15 -0.15 0.45
+3412 -0.05 -0.15 0.45
+3428 -0.25 -0.05 0.45
+3429 -0.15 -0.05 0.45
+3430 -0.05 -0.05 0.45
+3633 -0.25 -0.25 0.55
+3634 -0.15 -0.25 0.55
+3635 -0.05 -0.25 0.55
+3649 -0.25 -0.15 0.55
+3650 -0.15 -0.15 0.55
+3651 -0.05 -0.15 0.55
+3665 -0.25 -0.05 0.55
+3666 -0.15 -0.05 0.55
+3667 -0.05 -0.05 0.55
+3129 0.05 -0.25 0.35
+3130 0.15 -0.25 0.35
+3131 0.25 -0.25 0.35
+3147 0.05 -0.15 0.35
+3148 0.15 -0.15 0.35
+3149 0.25 -0.15 0.35
+3165 0.05 -0.05 0.35
+3166 0.15 -0.05 0.35
+3167 0.25 -0.05 0.35
+3395 0.05 -0.25 0.45
+3396 0.15 -0.25 0.45
+3397 0.25 -0.25 0.45
+3413 0.05 -0.15 0.45
+3414 0.15 -0.15 0.45
+3415 0.25 -0.15 0.45
+3431 0.05 -0.05 0.45
+3432 0.15 -0.05 0.45
+3433 0.25 -0.05 0.45
+3636 0.05 -0.25 0.55
+3637 0.15 -0.25 0.55
+3638 0.25 -0.25 0.55
+3652 0.05 -0.15 0.55
+3653 0.15 -0.15 0.55
+3654 0.25 -0.15 0.55
+3668 0.05 -0.05 0.55
+3669 0.15 -0.05 0.55
+3670 0.25 -0.05 0.55
+3132 0.35 -0.25 0.35
+3133 0.45 -0.25 0.35
+3134 0.55 -0.25 0.35
+3150 0.35 -0.15 0.35
+3151 0.45 -0.15 0.35
+3152 0.55 -0.15 0.35
+3168 0.35 -0.05 0.35
+3169 0.45 -0.05 0.35
+3170 0.55 -0.05 0.35
+3398 0.35 -0.25 0.45
+3399 0.45 -0.25 0.45
+3400 0.55 -0.25 0.45
+3416 0.35 -0.15 0.45
+3417 0.45 -0.15 0.45
+3418 0.55 -0.15 0.45
+3434 0.35 -0.05 0.45
+3435 0.45 -0.05 0.45
+3436 0.55 -0.05 0.45
+3639 0.35 -0.25 0.55
+3640 0.45 -0.25 0.55
+3641 0.55 -0.25 0.55
+3655 0.35 -0.15 0.55
+3656 0.45 -0.15 0.55
+3657 0.55 -0.15 0.55
+3671 0.35 -0.05 0.55
+3672 0.45 -0.05 0.55
+3673 0.55 -0.05 0.55
+3135 0.65 -0.25 0.35
+3136 0.75 -0.25 0.35
+3153 0.65 -0.15 0.35
+3154 0.75 -0.15 0.35
+3171 0.65 -0.05 0.35
+3172 0.75 -0.05 0.35
+3401 0.65 -0.25 0.45
+3402 0.75 -0.25 0.45
+3419 0.65 -0.15 0.45
+3420 0.75 -0.15 0.45
+3437 0.65 -0.05 0.45
+3438 0.75 -0.05 0.45
+3642 0.65 -0.25 0.55
+3643 0.75 -0.25 0.55
+3658 0.65 -0.15 0.55
+3659 0.75 -0.15 0.55
+3674 0.65 -0.05 0.55
+3675 0.75 -0.05 0.55
+3137 0.85 -0.25 0.35
+3155 0.85 -0.15 0.35
+3173 0.85 -0.05 0.35
+3403 0.85 -0.25 0.45
+3421 0.85 -0.15 0.45
+3439 0.85 -0.05 0.45
+3174 -0.85 0.05 0.35
+3192 -0.85 0.15 0.35
+3210 -0.85 0.25 0.35
+3440 -0.85 0.05 0.45
+3458 -0.85 0.15 0.45
+3476 -0.85 0.25 0.45
+3175 -0.75 0.05 0.35
+3176 -0.65 0.05 0.35
+3193 -0.75 0.15 0.35
+3194 -0.65 0.15 0.35
+3211 -0.75 0.25 0.35
+3212 -0.65 0.25 0.35
+3441 -0.75 0.05 0.45
+3442 -0.65 0.05 0.45
+3459 -0.75 0.15 0.45
+3460 -0.65 0.15 0.45
+3477 -0.75 0.25 0.45
+3478 -0.65 0.25 0.45
+3676 -0.75 0.05 0.55
+3677 -0.65 0.05 0.55
+3692 -0.75 0.15 0.55
+3693 -0.65 0.15 0.55
+3708 -0.75 0.25 0.55
+3709 -0.65 0.25 0.55
+3177 -0.55 0.05 0.35
+3178 -0.45 0.05 0.35
+3179 -0.35 0.05 0.35
+3195 -0.55 0.15 0.35
+3196 -0.45 0.15 0.35
+3197 -0.35 0.15 0.35
+3213 -0.55 0.25 0.35
+3214 -0.45 0.25 0.35
+3215 -0.35 0.25 0.35
+3443 -0.55 0.05 0.45
+3444 -0.45 0.05 0.45
+3445 -0.35 0.05 0.45
+3461 -0.55 0.15 0.45
+3462 -0.45 0.15 0.45
+3463 -0.35 0.15 0.45
+3479 -0.55 0.25 0.45
+3480 -0.45 0.25 0.45
+3481 -0.35 0.25 0.45
+3678 -0.55 0.05 0.55
+3679 -0.45 0.05 0.55
+3680 -0.35 0.05 0.55
+3694 -0.55 0.15 0.55
+3695 -0.45 0.15 0.55
+3696 -0.35 0.15 0.55
+3710 -0.55 0.25 0.55
+3711 -0.45 0.25 0.55
+3712 -0.35 0.25 0.55
+3180 -0.25 0.05 0.35
+3181 -0.15 0.05 0.35
+3182 -0.05 0.05 0.35
+3198 -0.25 0.15 0.35
+3199 -0.15 0.15 0.35
+3200 -0.05 0.15 0.35
+3216 -0.25 0.25 0.35
+3217 -0.15 0.25 0.35
+3218 -0.05 0.25 0.35
+3446 -0.25 0.05 0.45
+3447 -0.15 0.05 0.45
+3448 -0.05 0.05 0.45
+3464 -0.25 0.15 0.45
+3465 -0.15 0.15 0.45
+3466 -0.05 0.15 0.45
+3482 -0.25 0.25 0.45
+3483 -0.15 0.25 0.45
+3484 -0.05 0.25 0.45
+3681 -0.25 0.05 0.55
+3682 -0.15 0.05 0.55
+3683 -0.05 0.05 0.55
+3697 -0.25 0.15 0.55
+3698 -0.15 0.15 0.55
+3699 -0.05 0.15 0.55
+3713 -0.25 0.25 0.55
+3714 -0.15 0.25 0.55
+3715 -0.05 0.25 0.55
+3183 0.05 0.05 0.35
+3184 0.15 0.05 0.35
+3185 0.25 0.05 0.35
+3201 0.05 0.15 0.35
+3202 0.15 0.15 0.35
+3203 0.25 0.15 0.35
+3219 0.05 0.25 0.35
+3220 0.15 0.25 0.35
+3221 0.25 0.25 0.35
+3449 0.05 0.05 0.45
+3450 0.15 0.05 0.45
+3451 0.25 0.05 0.45
+3467 0.05 0.15 0.45
+3468 0.15 0.15 0.45
+3469 0.25 0.15 0.45
+3485 0.05 0.25 0.45
+3486 0.15 0.25 0.45
+3487 0.25 0.25 0.45
+3684 0.05 0.05 0.55
+3685 0.15 0.05 0.55
+3686 0.25 0.05 0.55
+3700 0.05 0.15 0.55
+3701 0.15 0.15 0.55
+3702 0.25 0.15 0.55
+3716 0.05 0.25 0.55
+3717 0.15 0.25 0.55
+3718 0.25 0.25 0.55
+3186 0.35 0.05 0.35
+3187 0.45 0.05 0.35
+3188 0.55 0.05 0.35
+3204 0.35 0.15 0.35
+3205 0.45 0.15 0.35
+3206 0.55 0.15 0.35
+3222 0.35 0.25 0.35
+3223 0.45 0.25 0.35
+3224 0.55 0.25 0.35
+3452 0.35 0.05 0.45
+3453 0.45 0.05 0.45
+3454 0.55 0.05 0.45
+3470 0.35 0.15 0.45
+3471 0.45 0.15 0.45
+3472 0.55 0.15 0.45
+3488 0.35 0.25 0.45
+3489 0.45 0.25 0.45
+3490 0.55 0.25 0.45
+3687 0.35 0.05 0.55
+3688 0.45 0.05 0.55
+3689 0.55 0.05 0.55
+3703 0.35 0.15 0.55
+3704 0.45 0.15 0.55
+3705 0.55 0.15 0.55
+3719 0.35 0.25 0.55
+3720 0.45 0.25 0.55
+3721 0.55 0.25 0.55
+3189 0.65 0.05 0.35
+3190 0.75 0.05 0.35
+3207 0.65 0.15 0.35
+3208 0.75 0.15 0.35
+3225 0.65 0.25 0.35
+3226 0.75 0.25 0.35
+3455 0.65 0.05 0.45
+3456 0.75 0.05 0.45
+3473 0.65 0.15 0.45
+3474 0.75 0.15 0.45
+3491 0.65 0.25 0.45
+3492 0.75 0.25 0.45
+3690 0.65 0.05 0.55
+3691 0.75 0.05 0.55
+3706 0.65 0.15 0.55
+3707 0.75 0.15 0.55
+3722 0.65 0.25 0.55
+3723 0.75 0.25 0.55
+3191 0.85 0.05 0.35
+3209 0.85 0.15 0.35
+3227 0.85 0.25 0.35
+3457 0.85 0.05 0.45
+3475 0.85 0.15 0.45
+3493 0.85 0.25 0.45
+3228 -0.85 0.35 0.35
+3229 -0.75 0.35 0.35
+3230 -0.65 0.35 0.35
+3246 -0.75 0.45 0.35
+3247 -0.65 0.45 0.35
+3262 -0.75 0.55 0.35
+3263 -0.65 0.55 0.35
+3494 -0.75 0.35 0.45
+3495 -0.65 0.35 0.45
+3510 -0.75 0.45 0.45
+3511 -0.65 0.45 0.45
+3526 -0.65 0.55 0.45
+3724 -0.75 0.35 0.55
+3725 -0.65 0.35 0.55
+3740 -0.65 0.45 0.55
+3231 -0.55 0.35 0.35
+3232 -0.45 0.35 0.35
+3233 -0.35 0.35 0.35
+3248 -0.55 0.45 0.35
+3249 -0.45 0.45 0.35
+3250 -0.35 0.45 0.35
+3264 -0.55 0.55 0.35
+3265 -0.45 0.55 0.35
+3266 -0.35 0.55 0.35
+3496 -0.55 0.35 0.45
+3497 -0.45 0.35 0.45
+3498 -0.35 0.35 0.45
+3512 -0.55 0.45 0.45
+3513 -0.45 0.45 0.45
+3514 -0.35 0.45 0.45
+3527 -0.55 0.55 0.45
+3528 -0.45 0.55 0.45
+3529 -0.35 0.55 0.45
+3726 -0.55 0.35 0.55
+3727 -0.45 0.35 0.55
+3728 -0.35 0.35 0.55
+3741 -0.55 0.45 0.55
+3742 -0.45 0.45 0.55
+3743 -0.35 0.45 0.55
+3754 -0.55 0.55 0.55
+3755 -0.45 0.55 0.55
+3756 -0.35 0.55 0.55
+3234 -0.25 0.35 0.35
+3235 -0.15 0.35 0.35
+3236 -0.05 0.35 0.35
+3251 -0.25 0.45 0.35
+3252 -0.15 0.45 0.35
+3253 -0.05 0.45 0.35
+3267 -0.25 0.55 0.35
+3268 -0.15 0.55 0.35
+3269 -0.05 0.55 0.35
+3499 -0.25 0.35 0.45
+3500 -0.15 0.35 0.45
+3501 -0.05 0.35 0.45
+3515 -0.25 0.45 0.45
+3516 -0.15 0.45 0.45
+3517 -0.05 0.45 0.45
+3530 -0.25 0.55 0.45
+3531 -0.15 0.55 0.45
+3532 -0.05 0.55 0.45
+3729 -0.25 0.35 0.55
+3730 -0.15 0.35 0.55
+3731 -0.05 0.35 0.55
+3744 -0.25 0.45 0.55
+3745 -0.15 0.45 0.55
+3746 -0.05 0.45 0.55
+3757 -0.25 0.55 0.55
+3758 -0.15 0.55 0.55
+3759 -0.05 0.55 0.55
+3237 0.05 0.35 0.35
+3238 0.15 0.35 0.35
+3239 0.25 0.35 0.35
+3254 0.05 0.45 0.35
+3255 0.15 0.45 0.35
+3256 0.25 0.45 0.35
+3270 0.05 0.55 0.35
+3271 0.15 0.55 0.35
+3272 0.25 0.55 0.35
+3502 0.05 0.35 0.45
+3503 0.15 0.35 0.45
+3504 0.25 0.35 0.45
+3518 0.05 0.45 0.45
+3519 0.15 0.45 0.45
+3520 0.25 0.45 0.45
+3533 0.05 0.55 0.45
+3534 0.15 0.55 0.45
+3535 0.25 0.55 0.45
+3732 0.05 0.35 0.55
+3733 0.15 0.35 0.55
+3734 0.25 0.35 0.55
+3747 0.05 0.45 0.55
+3748 0.15 0.45 0.55
+3749 0.25 0.45 0.55
+3760 0.05 0.55 0.55
+3761 0.15 0.55 0.55
+3762 0.25 0.55 0.55
+3240 0.35 0.35 0.35
+3241 0.45 0.35 0.35
+3242 0.55 0.35 0.35
+3257 0.35 0.45 0.35
+3258 0.45 0.45 0.35
+3259 0.55 0.45 0.35
+3273 0.35 0.55 0.35
+3274 0.45 0.55 0.35
+3275 0.55 0.55 0.35
+3505 0.35 0.35 0.45
+3506 0.45 0.35 0.45
+3507 0.55 0.35 0.45
+3521 0.35 0.45 0.45
+3522 0.45 0.45 0.45
+3523 0.55 0.45 0.45
+3536 0.35 0.55 0.45
+3537 0.45 0.55 0.45
+3538 0.55 0.55 0.45
+3735 0.35 0.35 0.55
+3736 0.45 0.35 0.55
+3737 0.55 0.35 0.55
+3750 0.35 0.45 0.55
+3751 0.45 0.45 0.55
+3752 0.55 0.45 0.55
+3763 0.35 0.55 0.55
+3764 0.45 0.55 0.55
+3765 0.55 0.55 0.55
+3243 0.65 0.35 0.35
+3244 0.75 0.35 0.35
+3260 0.65 0.45 0.35
+3261 0.75 0.45 0.35
+3276 0.65 0.55 0.35
+3277 0.75 0.55 0.35
+3508 0.65 0.35 0.45
+3509 0.75 0.35 0.45
+3524 0.65 0.45 0.45
+3525 0.75 0.45 0.45
+3539 0.65 0.55 0.45
+3738 0.65 0.35 0.55
+3739 0.75 0.35 0.55
+3753 0.65 0.45 0.55
+3245 0.85 0.35 0.35
+3278 -0.65 0.65 0.35
+3279 -0.55 0.65 0.35
+3280 -0.45 0.65 0.35
+3281 -0.35 0.65 0.35
+3292 -0.55 0.75 0.35
+3293 -0.45 0.75 0.35
+3294 -0.35 0.75 0.35
+3540 -0.55 0.65 0.45
+3541 -0.45 0.65 0.45
+3542 -0.35 0.65 0.45
+3552 -0.45 0.75 0.45
+3553 -0.35 0.75 0.45
+3766 -0.45 0.65 0.55
+3767 -0.35 0.65 0.55
+3776 -0.35 0.75 0.55
+3282 -0.25 0.65 0.35
+3283 -0.15 0.65 0.35
+3284 -0.05 0.65 0.35
+3295 -0.25 0.75 0.35
+3296 -0.15 0.75 0.35
+3297 -0.05 0.75 0.35
+3543 -0.25 0.65 0.45
+3544 -0.15 0.65 0.45
+3545 -0.05 0.65 0.45
+3554 -0.25 0.75 0.45
+3555 -0.15 0.75 0.45
+3556 -0.05 0.75 0.45
+3768 -0.25 0.65 0.55
+3769 -0.15 0.65 0.55
+3770 -0.05 0.65 0.55
+3777 -0.25 0.75 0.55
+3778 -0.15 0.75 0.55
+3779 -0.05 0.75 0.55
+3285 0.05 0.65 0.35
+3286 0.15 0.65 0.35
+3287 0.25 0.65 0.35
+3298 0.05 0.75 0.35
+3299 0.15 0.75 0.35
+3300 0.25 0.75 0.35
+3546 0.05 0.65 0.45
+3547 0.15 0.65 0.45
+3548 0.25 0.65 0.45
+3557 0.05 0.75 0.45
+3558 0.15 0.75 0.45
+3559 0.25 0.75 0.45
+3771 0.05 0.65 0.55
+3772 0.15 0.65 0.55
+3773 0.25 0.65 0.55
+3780 0.05 0.75 0.55
+3781 0.15 0.75 0.55
+3782 0.25 0.75 0.55
+3288 0.35 0.65 0.35
+3289 0.45 0.65 0.35
+3290 0.55 0.65 0.35
+3301 0.35 0.75 0.35
+3302 0.45 0.75 0.35
+3303 0.55 0.75 0.35
+3549 0.35 0.65 0.45
+3550 0.45 0.65 0.45
+3551 0.55 0.65 0.45
+3560 0.35 0.75 0.45
+3561 0.45 0.75 0.45
+3774 0.35 0.65 0.55
+3775 0.45 0.65 0.55
+3783 0.35 0.75 0.55
+3291 0.65 0.65 0.35
+3304 -0.35 0.85 0.35
+3305 -0.25 0.85 0.35
+3306 -0.15 0.85 0.35
+3307 -0.05 0.85 0.35
+3562 -0.25 0.85 0.45
+3563 -0.15 0.85 0.45
+3564 -0.05 0.85 0.45
+3308 0.05 0.85 0.35
+3309 0.15 0.85 0.35
+3310 0.25 0.85 0.35
+3565 0.05 0.85 0.45
+3566 0.15 0.85 0.45
+3567 0.25 0.85 0.45
+3311 0.35 0.85 0.35
+3786 -0.35 -0.65 0.65
+3784 -0.05 -0.75 0.65
+3787 -0.25 -0.65 0.65
+3788 -0.15 -0.65 0.65
+3789 -0.05 -0.65 0.65
+3964 -0.05 -0.65 0.75
+3785 0.05 -0.75 0.65
+3790 0.05 -0.65 0.65
+3791 0.15 -0.65 0.65
+3792 0.25 -0.65 0.65
+3965 0.05 -0.65 0.75
+3793 0.35 -0.65 0.65
+3816 -0.65 -0.35 0.65
+3794 -0.45 -0.55 0.65
+3795 -0.35 -0.55 0.65
+3804 -0.55 -0.45 0.65
+3805 -0.45 -0.45 0.65
+3806 -0.35 -0.45 0.65
+3817 -0.55 -0.35 0.65
+3818 -0.45 -0.35 0.65
+3819 -0.35 -0.35 0.65
+3966 -0.35 -0.55 0.75
+3974 -0.45 -0.45 0.75
+3975 -0.35 -0.45 0.75
+3984 -0.55 -0.35 0.75
+3985 -0.45 -0.35 0.75
+3986 -0.35 -0.35 0.75
+3796 -0.25 -0.55 0.65
+3797 -0.15 -0.55 0.65
+3798 -0.05 -0.55 0.65
+3807 -0.25 -0.45 0.65
+3808 -0.15 -0.45 0.65
+3809 -0.05 -0.45 0.65
+3820 -0.25 -0.35 0.65
+3821 -0.15 -0.35 0.65
+3822 -0.05 -0.35 0.65
+3967 -0.25 -0.55 0.75
+3968 -0.15 -0.55 0.75
+3969 -0.05 -0.55 0.75
+3976 -0.25 -0.45 0.75
+3977 -0.15 -0.45 0.75
+3978 -0.05 -0.45 0.75
+3987 -0.25 -0.35 0.75
+3988 -0.15 -0.35 0.75
+3989 -0.05 -0.35 0.75
+3799 0.05 -0.55 0.65
+3800 0.15 -0.55 0.65
+3801 0.25 -0.55 0.65
+3810 0.05 -0.45 0.65
+3811 0.15 -0.45 0.65
+3812 0.25 -0.45 0.65
+3823 0.05 -0.35 0.65
+3824 0.15 -0.35 0.65
+3825 0.25 -0.35 0.65
+3970 0.05 -0.55 0.75
+3971 0.15 -0.55 0.75
+3972 0.25 -0.55 0.75
+3979 0.05 -0.45 0.75
+3980 0.15 -0.45 0.75
+3981 0.25 -0.45 0.75
+3990 0.05 -0.35 0.75
+3991 0.15 -0.35 0.75
+3992 0.25 -0.35 0.75
+3802 0.35 -0.55 0.65
+3803 0.45 -0.55 0.65
+3813 0.35 -0.45 0.65
+3814 0.45 -0.45 0.65
+3815 0.55 -0.45 0.65
+3826 0.35 -0.35 0.65
+3827 0.45 -0.35 0.65
+3828 0.55 -0.35 0.65
+3973 0.35 -0.55 0.75
+3982 0.35 -0.45 0.75
+3983 0.45 -0.45 0.75
+3993 0.35 -0.35 0.75
+3994 0.45 -0.35 0.75
+3995 0.55 -0.35 0.75
+3829 0.65 -0.35 0.65
+3830 -0.65 -0.25 0.65
+3844 -0.65 -0.15 0.65
+3858 -0.75 -0.05 0.65
+3859 -0.65 -0.05 0.65
+4020 -0.65 -0.05 0.75
+3831 -0.55 -0.25 0.65
+3832 -0.45 -0.25 0.65
+3833 -0.35 -0.25 0.65
+3845 -0.55 -0.15 0.65
+3846 -0.45 -0.15 0.65
+3847 -0.35 -0.15 0.65
+3860 -0.55 -0.05 0.65
+3861 -0.45 -0.05 0.65
+3862 -0.35 -0.05 0.65
+3996 -0.55 -0.25 0.75
+3997 -0.45 -0.25 0.75
+3998 -0.35 -0.25 0.75
+4008 -0.55 -0.15 0.75
+4009 -0.45 -0.15 0.75
+4010 -0.35 -0.15 0.75
+4021 -0.55 -0.05 0.75
+4022 -0.45 -0.05 0.75
+4023 -0.35 -0.05 0.75
+3834 -0.25 -0.25 0.65
+3835 -0.15 -0.25 0.65
+3836 -0.05 -0.25 0.65
+3848 -0.25 -0.15 0.65
+3849 -0.15 -0.15 0.65
+3850 -0.05 -0.15 0.65
+3863 -0.25 -0.05 0.65
+3864 -0.15 -0.05 0.65
+3865 -0.05 -0.05 0.65
+3999 -0.25 -0.25 0.75
+4000 -0.15 -0.25 0.75
+4001 -0.05 -0.25 0.75
+4011 -0.25 -0.15 0.75
+4012 -0.15 -0.15 0.75
+4013 -0.05 -0.15 0.75
+4024 -0.25 -0.05 0.75
+4025 -0.15 -0.05 0.75
+4026 -0.05 -0.05 0.75
+3837 0.05 -0.25 0.65
+3838 0.15 -0.25 0.65
+3839 0.25 -0.25 0.65
+3851 0.05 -0.15 0.65
+3852 0.15 -0.15 0.65
+3853 0.25 -0.15 0.65
+3866 0.05 -0.05 0.65
+3867 0.15 -0.05 0.65
+3868 0.25 -0.05 0.65
+4002 0.05 -0.25 0.75
+4003 0.15 -0.25 0.75
+4004 0.25 -0.25 0.75
+4014 0.05 -0.15 0.75
+4015 0.15 -0.15 0.75
+4016 0.25 -0.15 0.75
+4027 0.05 -0.05 0.75
+4028 0.15 -0.05 0.75
+4029 0.25 -0.05 0.75
+3840 0.35 -0.25 0.65
+3841 0.45 -0.25 0.65
+3842 0.55 -0.25 0.65
+3854 0.35 -0.15 0.65
+3855 0.45 -0.15 0.65
+3856 0.55 -0.15 0.65
+3869 0.35 -0.05 0.65
+3870 0.45 -0.05 0.65
+3871 0.55 -0.05 0.65
+4005 0.35 -0.25 0.75
+4006 0.45 -0.25 0.75
+4007 0.55 -0.25 0.75
+4017 0.35 -0.15 0.75
+4018 0.45 -0.15 0.75
+4019 0.55 -0.15 0.75
+4030 0.35 -0.05 0.75
+4031 0.45 -0.05 0.75
+4032 0.55 -0.05 0.75
+3843 0.65 -0.25 0.65
+3857 0.65 -0.15 0.65
+3872 0.65 -0.05 0.65
+3873 0.75 -0.05 0.65
+4033 0.65 -0.05 0.75
+3874 -0.75 0.05 0.65
+3875 -0.65 0.05 0.65
+3890 -0.65 0.15 0.65
+3904 -0.65 0.25 0.65
+4034 -0.65 0.05 0.75
+3876 -0.55 0.05 0.65
+3877 -0.45 0.05 0.65
+3878 -0.35 0.05 0.65
+3891 -0.55 0.15 0.65
+3892 -0.45 0.15 0.65
+3893 -0.35 0.15 0.65
+3905 -0.55 0.25 0.65
+3906 -0.45 0.25 0.65
+3907 -0.35 0.25 0.65
+4035 -0.55 0.05 0.75
+4036 -0.45 0.05 0.75
+4037 -0.35 0.05 0.75
+4048 -0.55 0.15 0.75
+4049 -0.45 0.15 0.75
+4050 -0.35 0.15 0.75
+4060 -0.55 0.25 0.75
+4061 -0.45 0.25 0.75
+4062 -0.35 0.25 0.75
+3879 -0.25 0.05 0.65
+3880 -0.15 0.05 0.65
+3881 -0.05 0.05 0.65
+3894 -0.25 0.15 0.65
+3895 -0.15 0.15 0.65
+3896 -0.05 0.15 0.65
+3908 -0.25 0.25 0.65
+3909 -0.15 0.25 0.65
+3910 -0.05 0.25 0.65
+4038 -0.25 0.05 0.75
+4039 -0.15 0.05 0.75
+4040 -0.05 0.05 0.75
+4051 -0.25 0.15 0.75
+4052 -0.15 0.15 0.75
+4053 -0.05 0.15 0.75
+4063 -0.25 0.25 0.75
+4064 -0.15 0.25 0.75
+4065 -0.05 0.25 0.75
+3882 0.05 0.05 0.65
+3883 0.15 0.05 0.65
+3884 0.25 0.05 0.65
+3897 0.05 0.15 0.65
+3898 0.15 0.15 0.65
+3899 0.25 0.15 0.65
+3911 0.05 0.25 0.65
+3912 0.15 0.25 0.65
+3913 0.25 0.25 0.65
+4041 0.05 0.05 0.75
+4042 0.15 0.05 0.75
+4043 0.25 0.05 0.75
+4054 0.05 0.15 0.75
+4055 0.15 0.15 0.75
+4056 0.25 0.15 0.75
+4066 0.05 0.25 0.75
+4067 0.15 0.25 0.75
+4068 0.25 0.25 0.75
+3885 0.35 0.05 0.65
+3886 0.45 0.05 0.65
+3887 0.55 0.05 0.65
+3900 0.35 0.15 0.65
+3901 0.45 0.15 0.65
+3902 0.55 0.15 0.65
+3914 0.35 0.25 0.65
+3915 0.45 0.25 0.65
+3916 0.55 0.25 0.65
+4044 0.35 0.05 0.75
+4045 0.45 0.05 0.75
+4046 0.55 0.05 0.75
+4057 0.35 0.15 0.75
+4058 0.45 0.15 0.75
+4059 0.55 0.15 0.75
+4069 0.35 0.25 0.75
+4070 0.45 0.25 0.75
+4071 0.55 0.25 0.75
+3888 0.65 0.05 0.65
+3889 0.75 0.05 0.65
+3903 0.65 0.15 0.65
+3917 0.65 0.25 0.65
+4047 0.65 0.05 0.75
+3918 -0.65 0.35 0.65
+3919 -0.55 0.35 0.65
+3920 -0.45 0.35 0.65
+3921 -0.35 0.35 0.65
+3932 -0.55 0.45 0.65
+3933 -0.45 0.45 0.65
+3934 -0.35 0.45 0.65
+3944 -0.45 0.55 0.65
+3945 -0.35 0.55 0.65
+4072 -0.55 0.35 0.75
+4073 -0.45 0.35 0.75
+4074 -0.35 0.35 0.75
+4084 -0.45 0.45 0.75
+4085 -0.35 0.45 0.75
+4094 -0.35 0.55 0.75
+3922 -0.25 0.35 0.65
+3923 -0.15 0.35 0.65
+3924 -0.05 0.35 0.65
+3935 -0.25 0.45 0.65
+3936 -0.15 0.45 0.65
+3937 -0.05 0.45 0.65
+3946 -0.25 0.55 0.65
+3947 -0.15 0.55 0.65
+3948 -0.05 0.55 0.65
+4075 -0.25 0.35 0.75
+4076 -0.15 0.35 0.75
+4077 -0.05 0.35 0.75
+4086 -0.25 0.45 0.75
+4087 -0.15 0.45 0.75
+4088 -0.05 0.45 0.75
+4095 -0.25 0.55 0.75
+4096 -0.15 0.55 0.75
+4097 -0.05 0.55 0.75
+3925 0.05 0.35 0.65
+3926 0.15 0.35 0.65
+3927 0.25 0.35 0.65
+3938 0.05 0.45 0.65
+3939 0.15 0.45 0.65
+3940 0.25 0.45 0.65
+3949 0.05 0.55 0.65
+3950 0.15 0.55 0.65
+3951 0.25 0.55 0.65
+4078 0.05 0.35 0.75
+4079 0.15 0.35 0.75
+4080 0.25 0.35 0.75
+4089 0.05 0.45 0.75
+4090 0.15 0.45 0.75
+4091 0.25 0.45 0.75
+4098 0.05 0.55 0.75
+4099 0.15 0.55 0.75
+4100 0.25 0.55 0.75
+3928 0.35 0.35 0.65
+3929 0.45 0.35 0.65
+3930 0.55 0.35 0.65
+3941 0.35 0.45 0.65
+3942 0.45 0.45 0.65
+3943 0.55 0.45 0.65
+3952 0.35 0.55 0.65
+3953 0.45 0.55 0.65
+4081 0.35 0.35 0.75
+4082 0.45 0.35 0.75
+4083 0.55 0.35 0.75
+4092 0.35 0.45 0.75
+4093 0.45 0.45 0.75
+4101 0.35 0.55 0.75
+3931 0.65 0.35 0.65
+3954 -0.35 0.65 0.65
+3955 -0.25 0.65 0.65
+3956 -0.15 0.65 0.65
+3957 -0.05 0.65 0.65
+3962 -0.05 0.75 0.65
+4102 -0.05 0.65 0.75
+3958 0.05 0.65 0.65
+3959 0.15 0.65 0.65
+3960 0.25 0.65 0.65
+3963 0.05 0.75 0.65
+4103 0.05 0.65 0.75
+3961 0.35 0.65 0.65
+4110 -0.35 -0.35 0.85
+4104 -0.25 -0.45 0.85
+4105 -0.15 -0.45 0.85
+4106 -0.05 -0.45 0.85
+4111 -0.25 -0.35 0.85
+4112 -0.15 -0.35 0.85
+4113 -0.05 -0.35 0.85
+4107 0.05 -0.45 0.85
+4108 0.15 -0.45 0.85
+4109 0.25 -0.45 0.85
+4114 0.05 -0.35 0.85
+4115 0.15 -0.35 0.85
+4116 0.25 -0.35 0.85
+4117 0.35 -0.35 0.85
+4118 -0.45 -0.25 0.85
+4119 -0.35 -0.25 0.85
+4128 -0.45 -0.15 0.85
+4129 -0.35 -0.15 0.85
+4138 -0.45 -0.05 0.85
+4139 -0.35 -0.05 0.85
+4120 -0.25 -0.25 0.85
+4121 -0.15 -0.25 0.85
+4122 -0.05 -0.25 0.85
+4130 -0.25 -0.15 0.85
+4131 -0.15 -0.15 0.85
+4132 -0.05 -0.15 0.85
+4140 -0.25 -0.05 0.85
+4141 -0.15 -0.05 0.85
+4142 -0.05 -0.05 0.85
+4192 -0.15 -0.25 0.95
+4193 -0.05 -0.25 0.95
+4196 -0.25 -0.15 0.95
+4197 -0.15 -0.15 0.95
+4198 -0.05 -0.15 0.95
+4202 -0.25 -0.05 0.95
+4203 -0.15 -0.05 0.95
+4204 -0.05 -0.05 0.95
+4123 0.05 -0.25 0.85
+4124 0.15 -0.25 0.85
+4125 0.25 -0.25 0.85
+4133 0.05 -0.15 0.85
+4134 0.15 -0.15 0.85
+4135 0.25 -0.15 0.85
+4143 0.05 -0.05 0.85
+4144 0.15 -0.05 0.85
+4145 0.25 -0.05 0.85
+4194 0.05 -0.25 0.95
+4195 0.15 -0.25 0.95
+4199 0.05 -0.15 0.95
+4200 0.15 -0.15 0.95
+4201 0.25 -0.15 0.95
+4205 0.05 -0.05 0.95
+4206 0.15 -0.05 0.95
+4207 0.25 -0.05 0.95
+4126 0.35 -0.25 0.85
+4127 0.45 -0.25 0.85
+4136 0.35 -0.15 0.85
+4137 0.45 -0.15 0.85
+4146 0.35 -0.05 0.85
+4147 0.45 -0.05 0.85
+4148 -0.45 0.05 0.85
+4149 -0.35 0.05 0.85
+4158 -0.45 0.15 0.85
+4159 -0.35 0.15 0.85
+4168 -0.45 0.25 0.85
+4169 -0.35 0.25 0.85
+4150 -0.25 0.05 0.85
+4151 -0.15 0.05 0.85
+4152 -0.05 0.05 0.85
+4160 -0.25 0.15 0.85
+4161 -0.15 0.15 0.85
+4162 -0.05 0.15 0.85
+4170 -0.25 0.25 0.85
+4171 -0.15 0.25 0.85
+4172 -0.05 0.25 0.85
+4208 -0.25 0.05 0.95
+4209 -0.15 0.05 0.95
+4210 -0.05 0.05 0.95
+4214 -0.25 0.15 0.95
+4215 -0.15 0.15 0.95
+4216 -0.05 0.15 0.95
+4220 -0.15 0.25 0.95
+4221 -0.05 0.25 0.95
+4153 0.05 0.05 0.85
+4154 0.15 0.05 0.85
+4155 0.25 0.05 0.85
+4163 0.05 0.15 0.85
+4164 0.15 0.15 0.85
+4165 0.25 0.15 0.85
+4173 0.05 0.25 0.85
+4174 0.15 0.25 0.85
+4175 0.25 0.25 0.85
+4211 0.05 0.05 0.95
+4212 0.15 0.05 0.95
+4213 0.25 0.05 0.95
+4217 0.05 0.15 0.95
+4218 0.15 0.15 0.95
+4219 0.25 0.15 0.95
+4222 0.05 0.25 0.95
+4223 0.15 0.25 0.95
+4156 0.35 0.05 0.85
+4157 0.45 0.05 0.85
+4166 0.35 0.15 0.85
+4167 0.45 0.15 0.85
+4176 0.35 0.25 0.85
+4177 0.45 0.25 0.85
+4178 -0.35 0.35 0.85
+4179 -0.25 0.35 0.85
+4180 -0.15 0.35 0.85
+4181 -0.05 0.35 0.85
+4186 -0.25 0.45 0.85
+4187 -0.15 0.45 0.85
+4188 -0.05 0.45 0.85
+4182 0.05 0.35 0.85
+4183 0.15 0.35 0.85
+4184 0.25 0.35 0.85
+4189 0.05 0.45 0.85
+4190 0.15 0.45 0.85
+4191 0.25 0.45 0.85
+4185 0.35 0.35 0.85
@@ -0,0 +1,64 @@
+44 -0.138443 -0.143167 -0.966347
+16 0.0574068 -0.294354 -0.62592
+39 -0.249333 -0.304894 -0.323237
+43 -0.132578 -0.416982 -0.553425
+42 -0.0715703 0.212446 -0.682859
+45 -0.19862 0.158194 -0.330749
+50 -0.0480969 -0.229341 -0.701635
+62 -0.0337172 0.269556 -0.605781
+34 0.300811 0.22504 -0.669175
+41 0.679036 0.276792 -0.415637
+46 0.338062 0.108898 -0.593771
+51 0.551275 0.152296 -0.312639
+61 0.192192 0.756776 -0.376856
+29 0.630087 0.589799 -0.289192
+30 0.408121 0.351565 -0.818763
+33 0.864365 0.643863 -0.644286
+40 -0.383457 -0.321362 -0.26525
+18 -0.154044 -0.364088 -0.160254
+20 0.0695629 -0.484803 0.00734134
+22 0.148121 -0.427611 -0.0755035
+36 -0.0227315 -0.366343 0.119672
+10 -0.390485 0.243138 0.217793
+11 -0.425016 -0.0142761 -0.25366
+17 -0.417263 -0.177238 0.129368
+24 -0.300905 0.0517656 -0.00861286
+35 -0.306488 0.0873378 0.219556
+56 -0.402322 -0.283272 0.149629
+26 -0.228846 0.275016 0.184888
+32 0.06285 0.0198241 0.262724
+53 0.229117 0.0940234 -0.187097
+54 0.271684 0.196691 0.0368191
+59 -0.141978 -0.111603 -0.143364
+60 0.0800461 -0.225357 -0.238167
+4 0.701904 -0.0681989 -0.0722567
+15 0.868366 -0.15973 0.164558
+48 0.927828 0.251463 -0.239373
+21 -0.353795 0.397163 -0.206711
+37 -0.694169 0.459436 0.26921
+38 0.0884747 0.612371 0.0125924
+63 -0.154151 0.508998 -0.0957527
+52 0.311593 0.506291 -0.122346
+31 0.0737422 -0.463835 0.360048
+2 0.559915 -0.583805 0.751446
+8 0.791393 -0.752198 0.583556
+9 0.657658 -0.35007 0.447923
+12 0.403051 -0.71409 0.671841
+19 0.511519 -0.531526 0.461964
+28 0.488856 -0.451957 0.735331
+47 0.754169 -0.831748 0.77994
+57 0.758265 -0.783799 0.573326
+3 -0.563619 0.20994 0.31772
+27 -0.438844 0.234095 0.494805
+0 0.21588 -0.0904118 0.515484
+14 0.130057 -0.171041 0.561471
+49 0.261022 0.16921 0.457982
+58 -0.228277 -0.248288 0.480301
+6 0.314539 0.119597 0.380181
+13 0.498633 0.00960507 0.31525
+55 0.469546 -0.219867 0.699139
+5 -0.422691 0.635325 0.435531
+7 0.102988 0.475702 0.384785
+25 0.0334775 0.540984 0.387809
+1 0.883809 -0.862826 0.954137
+23 0.13301 -0.243171 0.871114
@@ -0,0 +1,128 @@
+// id 44
+sphere{<-0.138443,-0.143167,-0.966347>,s}
+// id 16
+sphere{<0.0574068,-0.294354,-0.62592>,s}
+// id 39
+sphere{<-0.249333,-0.304894,-0.323237>,s}
+// id 43
+sphere{<-0.132578,-0.416982,-0.553425>,s}
+// id 42
+sphere{<-0.0715703,0.212446,-0.682859>,s}
+// id 45
+sphere{<-0.19862,0.158194,-0.330749>,s}
+// id 50
+sphere{<-0.0480969,-0.229341,-0.701635>,s}
+// id 62
+sphere{<-0.0337172,0.269556,-0.605781>,s}
+// id 34
+sphere{<0.300811,0.22504,-0.669175>,s}
+// id 41
+sphere{<0.679036,0.276792,-0.415637>,s}
+// id 46
+sphere{<0.338062,0.108898,-0.593771>,s}
+// id 51
+sphere{<0.551275,0.152296,-0.312639>,s}
+// id 61
+sphere{<0.192192,0.756776,-0.376856>,s}
+// id 29
+sphere{<0.630087,0.589799,-0.289192>,s}
+// id 30
+sphere{<0.408121,0.351565,-0.818763>,s}
+// id 33
+sphere{<0.864365,0.643863,-0.644286>,s}
+// id 40
+sphere{<-0.383457,-0.321362,-0.26525>,s}
+// id 18
+sphere{<-0.154044,-0.364088,-0.160254>,s}
+// id 20
+sphere{<0.0695629,-0.484803,0.00734134>,s}
+// id 22
+sphere{<0.148121,-0.427611,-0.0755035>,s}
+// id 36
+sphere{<-0.0227315,-0.366343,0.119672>,s}
+// id 10
+sphere{<-0.390485,0.243138,0.217793>,s}
+// id 11
+sphere{<-0.425016,-0.0142761,-0.25366>,s}
+// id 17
+sphere{<-0.417263,-0.177238,0.129368>,s}
+// id 24
+sphere{<-0.300905,0.0517656,-0.00861286>,s}
+// id 35
+sphere{<-0.306488,0.0873378,0.219556>,s}
+// id 56
+sphere{<-0.402322,-0.283272,0.149629>,s}
+// id 26
+sphere{<-0.228846,0.275016,0.184888>,s}
+// id 32
+sphere{<0.06285,0.0198241,0.262724>,s}
+// id 53
+sphere{<0.229117,0.0940234,-0.187097>,s}
+// id 54
+sphere{<0.271684,0.196691,0.0368191>,s}
+// id 59
+sphere{<-0.141978,-0.111603,-0.143364>,s}
+// id 60
+sphere{<0.0800461,-0.225357,-0.238167>,s}
+// id 4
+sphere{<0.701904,-0.0681989,-0.0722567>,s}
+// id 15
+sphere{<0.868366,-0.15973,0.164558>,s}
+// id 48
+sphere{<0.927828,0.251463,-0.239373>,s}
+// id 21
+sphere{<-0.353795,0.397163,-0.206711>,s}
+// id 37
+sphere{<-0.694169,0.459436,0.26921>,s}
+// id 38
+sphere{<0.0884747,0.612371,0.0125924>,s}
+// id 63
+sphere{<-0.154151,0.508998,-0.0957527>,s}
+// id 52
+sphere{<0.311593,0.506291,-0.122346>,s}
+// id 31
+sphere{<0.0737422,-0.463835,0.360048>,s}
+// id 2
+sphere{<0.559915,-0.583805,0.751446>,s}
+// id 8
+sphere{<0.791393,-0.752198,0.583556>,s}
+// id 9
+sphere{<0.657658,-0.35007,0.447923>,s}
+// id 12
+sphere{<0.403051,-0.71409,0.671841>,s}
+// id 19
+sphere{<0.511519,-0.531526,0.461964>,s}
+// id 28
+sphere{<0.488856,-0.451957,0.735331>,s}
+// id 47
+sphere{<0.754169,-0.831748,0.77994>,s}
+// id 57
+sphere{<0.758265,-0.783799,0.573326>,s}
+// id 3
+sphere{<-0.563619,0.20994,0.31772>,s}
+// id 27
+sphere{<-0.438844,0.234095,0.494805>,s}
+// id 0
+sphere{<0.21588,-0.0904118,0.515484>,s}
+// id 14
+sphere{<0.130057,-0.171041,0.561471>,s}
+// id 49
+sphere{<0.261022,0.16921,0.457982>,s}
+// id 58
+sphere{<-0.228277,-0.248288,0.480301>,s}
+// id 6
+sphere{<0.314539,0.119597,0.380181>,s}
+// id 13
+sphere{<0.498633,0.00960507,0.31525>,s}
+// id 55
+sphere{<0.469546,-0.219867,0.699139>,s}
+// id 5
+sphere{<-0.422691,0.635325,0.435531>,s}
+// id 7
+sphere{<0.102988,0.475702,0.384785>,s}
+// id 25
+sphere{<0.0334775,0.540984,0.387809>,s}
+// id 1
+sphere{<0.883809,-0.862826,0.954137>,s}
+// id 23
+sphere{<0.13301,-0.243171,0.871114>,s}
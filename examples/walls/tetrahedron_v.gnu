@@ -0,0 +1,3675 @@
+-0.26842 -0.418578 -0.849842
+-0.653263 -0.653263 -1
+-0.497281 -0.196825 -0.699544
+-0.26842 -0.418578 -0.849842
+0.142681 -0.00258881 -0.85473
+0.128001 0.00807751 -0.846248
+0.129511 0.129984 -0.999526
+0.129901 0.129901 -1
+0.142681 -0.00258881 -0.85473
+
+
+-0.497281 -0.196825 -0.699544
+-0.317938 -0.021673 -0.703735
+0.128001 0.00807751 -0.846248
+
+
+-0.317938 -0.021673 -0.703735
+0.129511 0.129984 -0.999526
+
+
+-0.653263 -0.653263 -1
+0.129901 0.129901 -1
+
+
+0.338957 -0.203128 -0.457915
+0.120107 -0.484893 -0.395
+-0.0532372 -0.236482 -0.429081
+-0.0734063 -0.134881 -0.445983
+0.00911382 -0.028602 -0.469712
+0.0295819 -0.0146201 -0.473395
+0.0624323 -0.0092088 -0.476276
+0.338957 -0.203128 -0.457915
+0.182074 -0.0708916 -0.747034
+-0.0567341 -0.37841 -0.678324
+0.120107 -0.484893 -0.395
+
+
+-0.0567341 -0.37841 -0.678324
+-0.0944859 -0.196465 -0.469489
+-0.0532372 -0.236482 -0.429081
+
+
+0.0624323 -0.0092088 -0.476276
+0.0645656 -0.00737944 -0.517846
+0.0678759 -0.0083774 -0.534227
+0.182074 -0.0708916 -0.747034
+
+
+0.00911382 -0.028602 -0.469712
+0.0229342 -0.0155387 -0.477753
+0.0466199 -0.0106815 -0.506587
+0.0645656 -0.00737944 -0.517846
+
+
+-0.0944859 -0.196465 -0.469489
+-0.0734063 -0.134881 -0.445983
+
+
+0.0295819 -0.0146201 -0.473395
+0.0229342 -0.0155387 -0.477753
+
+
+0.0466199 -0.0106815 -0.506587
+0.0678759 -0.0083774 -0.534227
+
+
+-0.0387564 -0.378023 -0.352814
+-0.0961643 -0.232654 -0.266454
+-0.0900641 -0.0895853 -0.423836
+-0.0848488 -0.0904706 -0.443201
+-0.0734063 -0.134881 -0.445983
+-0.0532372 -0.236482 -0.429081
+-0.0387564 -0.378023 -0.352814
+-0.282796 -0.691454 -0.323971
+-0.500163 -0.18231 -0.682147
+-0.49639 -0.164854 -0.668464
+-0.487826 -0.159023 -0.671196
+-0.2914 -0.0695654 -0.548873
+-0.224045 -0.0738897 -0.360738
+-0.305421 -0.155778 -0.224174
+-0.49639 -0.164854 -0.668464
+
+
+-0.499803 -0.181945 -0.682142
+-0.0944859 -0.196465 -0.469489
+-0.0734063 -0.134881 -0.445983
+
+
+-0.499803 -0.181945 -0.682142
+-0.500163 -0.18231 -0.682147
+
+
+-0.499803 -0.181945 -0.682142
+-0.487826 -0.159023 -0.671196
+
+
+-0.0848488 -0.0904706 -0.443201
+-0.2914 -0.0695654 -0.548873
+
+
+-0.282796 -0.691454 -0.323971
+-0.270216 -0.231179 -0.164159
+-0.305421 -0.155778 -0.224174
+
+
+-0.270216 -0.231179 -0.164159
+-0.0961643 -0.232654 -0.266454
+
+
+-0.0944859 -0.196465 -0.469489
+-0.0532372 -0.236482 -0.429081
+
+
+-0.0900641 -0.0895853 -0.423836
+-0.224045 -0.0738897 -0.360738
+
+
+0.120107 -0.484893 -0.395
+0.115367 -0.505131 -0.379501
+0.0367034 -0.494255 -0.333057
+-0.0387564 -0.378023 -0.352814
+-0.0532372 -0.236482 -0.429081
+0.120107 -0.484893 -0.395
+-0.0567341 -0.37841 -0.678324
+-0.0944859 -0.196465 -0.469489
+-0.499803 -0.181945 -0.682142
+-0.497281 -0.196825 -0.699544
+-0.653263 -0.653263 -1
+-0.26842 -0.418578 -0.849842
+-0.497281 -0.196825 -0.699544
+
+
+-1 -1 -1
+-0.653263 -0.653263 -1
+
+
+-1 -1 -1
+-0.282443 -1 -0.282443
+-0.344825 -0.948017 -0.292842
+-1 -0.884348 -0.884348
+-0.500163 -0.18231 -0.682147
+-0.282796 -0.691454 -0.323971
+-0.344825 -0.948017 -0.292842
+
+
+-1 -1 -1
+-1 -0.884348 -0.884348
+
+
+-0.0944859 -0.196465 -0.469489
+-0.0532372 -0.236482 -0.429081
+
+
+-0.282443 -1 -0.282443
+-0.0365191 -0.731363 -0.305156
+-0.0111284 -0.690111 -0.30932
+0.0367034 -0.494255 -0.333057
+
+
+-0.499803 -0.181945 -0.682142
+-0.500163 -0.18231 -0.682147
+
+
+-0.282796 -0.691454 -0.323971
+-0.0387564 -0.378023 -0.352814
+
+
+-0.00815701 -0.69694 -0.311217
+-0.0111284 -0.690111 -0.30932
+
+
+-0.00815701 -0.69694 -0.311217
+-0.0365191 -0.731363 -0.305156
+
+
+-0.00815701 -0.69694 -0.311217
+0.115367 -0.505131 -0.379501
+
+
+-0.26842 -0.418578 -0.849842
+-0.0567341 -0.37841 -0.678324
+
+
+0.00842525 -0.0135999 -0.485667
+-0.239198 0.222101 -0.5387
+0.115173 0.32569 -0.789483
+0.129511 0.129984 -0.999526
+0.128001 0.00807751 -0.846248
+0.125834 0.00534951 -0.784766
+0.0678759 -0.0083774 -0.534227
+0.0466199 -0.0106815 -0.506587
+0.0645656 -0.00737944 -0.517846
+0.0678759 -0.0083774 -0.534227
+
+
+0.00842525 -0.0135999 -0.485667
+-0.346683 -0.0269351 -0.615853
+-0.382162 -0.0275644 -0.645403
+-0.37344 0.00615027 -0.62041
+-0.346683 -0.0269351 -0.615853
+
+
+0.00842525 -0.0135999 -0.485667
+0.0466199 -0.0106815 -0.506587
+
+
+0.129511 0.129984 -0.999526
+-0.317938 -0.021673 -0.703735
+0.128001 0.00807751 -0.846248
+
+
+-0.239198 0.222101 -0.5387
+-0.37344 0.00615027 -0.62041
+
+
+-0.317938 -0.021673 -0.703735
+-0.382162 -0.0275644 -0.645403
+
+
+0.125834 0.00534951 -0.784766
+0.116655 0.105022 -0.62671
+0.115173 0.32569 -0.789483
+
+
+0.116655 0.105022 -0.62671
+0.0645656 -0.00737944 -0.517846
+
+
+-0.0384305 0.156115 -0.0856845
+-0.251383 0.0371449 -0.192607
+-0.355096 0.179603 -0.178472
+-0.438576 0.213401 -0.348022
+-0.163809 0.424743 -0.411447
+-0.118511 0.4374 -0.379162
+-0.173535 0.254699 -0.0960122
+-0.355096 0.179603 -0.178472
+
+
+-0.0384305 0.156115 -0.0856845
+0.0140575 0.0147151 -0.305138
+0.0603802 0.0151203 -0.442887
+0.0295819 -0.0146201 -0.473395
+0.0229342 -0.0155387 -0.477753
+0.00911382 -0.028602 -0.469712
+0.0295819 -0.0146201 -0.473395
+
+
+-0.0384305 0.156115 -0.0856845
+-0.0362968 0.216554 -0.0650389
+0.0644266 0.36136 -0.300266
+0.0603802 0.0151203 -0.442887
+
+
+-0.251383 0.0371449 -0.192607
+-0.224045 -0.0738897 -0.360738
+-0.0900641 -0.0895853 -0.423836
+-0.0848488 -0.0904706 -0.443201
+-0.2914 -0.0695654 -0.548873
+-0.224045 -0.0738897 -0.360738
+
+
+-0.163809 0.424743 -0.411447
+-0.239198 0.222101 -0.5387
+0.00842525 -0.0135999 -0.485667
+0.0229342 -0.0155387 -0.477753
+
+
+0.00842525 -0.0135999 -0.485667
+-0.346683 -0.0269351 -0.615853
+-0.37344 0.00615027 -0.62041
+-0.438576 0.213401 -0.348022
+
+
+-0.239198 0.222101 -0.5387
+-0.37344 0.00615027 -0.62041
+
+
+-0.0848488 -0.0904706 -0.443201
+0.00911382 -0.028602 -0.469712
+
+
+0.0140575 0.0147151 -0.305138
+-0.0900641 -0.0895853 -0.423836
+
+
+-0.0362968 0.216554 -0.0650389
+-0.173535 0.254699 -0.0960122
+
+
+-0.346683 -0.0269351 -0.615853
+-0.2914 -0.0695654 -0.548873
+
+
+-0.118511 0.4374 -0.379162
+0.0644266 0.36136 -0.300266
+
+
+0.142681 -0.00258881 -0.85473
+0.155718 -0.0143733 -0.829908
+0.182074 -0.0708916 -0.747034
+0.0678759 -0.0083774 -0.534227
+0.125834 0.00534951 -0.784766
+0.155718 -0.0143733 -0.829908
+
+
+0.142681 -0.00258881 -0.85473
+-0.26842 -0.418578 -0.849842
+-0.0567341 -0.37841 -0.678324
+0.182074 -0.0708916 -0.747034
+
+
+0.142681 -0.00258881 -0.85473
+0.128001 0.00807751 -0.846248
+-0.317938 -0.021673 -0.703735
+-0.497281 -0.196825 -0.699544
+-0.26842 -0.418578 -0.849842
+
+
+-0.0567341 -0.37841 -0.678324
+-0.0944859 -0.196465 -0.469489
+-0.0734063 -0.134881 -0.445983
+-0.0848488 -0.0904706 -0.443201
+0.00911382 -0.028602 -0.469712
+-0.0734063 -0.134881 -0.445983
+
+
+-0.497281 -0.196825 -0.699544
+-0.499803 -0.181945 -0.682142
+-0.0944859 -0.196465 -0.469489
+
+
+-0.2914 -0.0695654 -0.548873
+-0.487826 -0.159023 -0.671196
+-0.382162 -0.0275644 -0.645403
+-0.346683 -0.0269351 -0.615853
+-0.2914 -0.0695654 -0.548873
+-0.0848488 -0.0904706 -0.443201
+
+
+-0.487826 -0.159023 -0.671196
+-0.499803 -0.181945 -0.682142
+
+
+-0.317938 -0.021673 -0.703735
+-0.382162 -0.0275644 -0.645403
+
+
+0.0466199 -0.0106815 -0.506587
+0.0678759 -0.0083774 -0.534227
+
+
+0.0466199 -0.0106815 -0.506587
+0.00842525 -0.0135999 -0.485667
+-0.346683 -0.0269351 -0.615853
+
+
+0.0466199 -0.0106815 -0.506587
+0.0229342 -0.0155387 -0.477753
+0.00842525 -0.0135999 -0.485667
+
+
+0.0229342 -0.0155387 -0.477753
+0.00911382 -0.028602 -0.469712
+
+
+0.128001 0.00807751 -0.846248
+0.125834 0.00534951 -0.784766
+
+
+0.0706049 0.0116096 -0.450778
+0.0624323 -0.0092088 -0.476276
+0.0645656 -0.00737944 -0.517846
+0.0466199 -0.0106815 -0.506587
+0.0229342 -0.0155387 -0.477753
+0.0295819 -0.0146201 -0.473395
+0.0624323 -0.0092088 -0.476276
+
+
+0.0706049 0.0116096 -0.450778
+0.178333 0.263751 -0.412696
+0.116655 0.105022 -0.62671
+0.0645656 -0.00737944 -0.517846
+
+
+0.0706049 0.0116096 -0.450778
+0.0603802 0.0151203 -0.442887
+0.0644266 0.36136 -0.300266
+-0.118511 0.4374 -0.379162
+-0.163809 0.424743 -0.411447
+-0.128071 0.473542 -0.398387
+-0.118511 0.4374 -0.379162
+
+
+0.178333 0.263751 -0.412696
+0.19502 0.351606 -0.386337
+0.066935 0.363798 -0.300819
+0.0651165 0.449259 -0.341369
+0.197701 0.427206 -0.425274
+0.19502 0.351606 -0.386337
+
+
+-0.239198 0.222101 -0.5387
+-0.163809 0.424743 -0.411447
+
+
+-0.239198 0.222101 -0.5387
+0.115173 0.32569 -0.789483
+0.116655 0.105022 -0.62671
+
+
+-0.239198 0.222101 -0.5387
+0.00842525 -0.0135999 -0.485667
+0.0229342 -0.0155387 -0.477753
+
+
+0.115173 0.32569 -0.789483
+0.172601 0.537455 -0.635146
+-0.0532236 0.536504 -0.410272
+0.0651165 0.449259 -0.341369
+
+
+0.172601 0.537455 -0.635146
+0.197701 0.427206 -0.425274
+
+
+0.00842525 -0.0135999 -0.485667
+0.0466199 -0.0106815 -0.506587
+
+
+0.0603802 0.0151203 -0.442887
+0.0295819 -0.0146201 -0.473395
+
+
+0.0644266 0.36136 -0.300266
+0.066935 0.363798 -0.300819
+
+
+-0.128071 0.473542 -0.398387
+-0.0532236 0.536504 -0.410272
+
+
+0.142681 -0.00258881 -0.85473
+0.129901 0.129901 -1
+0.129511 0.129984 -0.999526
+0.128001 0.00807751 -0.846248
+0.142681 -0.00258881 -0.85473
+0.155718 -0.0143733 -0.829908
+0.545082 0.214626 -0.669543
+0.558016 0.237187 -0.641182
+0.447343 0.47005 -0.523615
+0.390522 0.51989 -0.52222
+0.359983 0.475877 -0.453506
+0.388614 0.421467 -0.426086
+0.385323 0.405852 -0.41799
+0.30374 0.328311 -0.3765
+0.303818 0.327333 -0.376754
+0.178333 0.263751 -0.412696
+0.19502 0.351606 -0.386337
+0.30374 0.328311 -0.3765
+
+
+0.128001 0.00807751 -0.846248
+0.125834 0.00534951 -0.784766
+0.155718 -0.0143733 -0.829908
+
+
+0.303818 0.327333 -0.376754
+0.436641 0.306611 -0.474289
+0.558016 0.237187 -0.641182
+
+
+0.115173 0.32569 -0.789483
+0.172601 0.537455 -0.635146
+0.189984 0.545913 -0.644071
+0.390522 0.51989 -0.52222
+
+
+0.115173 0.32569 -0.789483
+0.129511 0.129984 -0.999526
+
+
+0.115173 0.32569 -0.789483
+0.116655 0.105022 -0.62671
+0.125834 0.00534951 -0.784766
+
+
+0.388614 0.421467 -0.426086
+0.447343 0.47005 -0.523615
+
+
+0.15488 0.15488 -1
+0.545082 0.214626 -0.669543
+
+
+0.15488 0.15488 -1
+0.129901 0.129901 -1
+
+
+0.15488 0.15488 -1
+0.189984 0.545913 -0.644071
+
+
+0.436641 0.306611 -0.474289
+0.385323 0.405852 -0.41799
+
+
+0.116655 0.105022 -0.62671
+0.178333 0.263751 -0.412696
+
+
+0.172601 0.537455 -0.635146
+0.197701 0.427206 -0.425274
+0.359983 0.475877 -0.453506
+
+
+0.197701 0.427206 -0.425274
+0.19502 0.351606 -0.386337
+
+
+0.928232 0.410811 -0.482579
+0.776313 0.0904915 -0.314179
+0.673253 0.347111 -0.131835
+0.877755 0.487545 -0.400305
+0.928232 0.410811 -0.482579
+0.691638 0.393606 -0.701968
+0.570774 0.223137 -0.652363
+0.568604 0.113102 -0.544498
+0.436641 0.306611 -0.474289
+0.385323 0.405852 -0.41799
+0.388614 0.421467 -0.426086
+0.418742 0.40606 -0.376284
+0.385323 0.405852 -0.41799
+
+
+0.568604 0.113102 -0.544498
+0.776313 0.0904915 -0.314179
+
+
+0.571207 0.519352 -0.597711
+0.691638 0.393606 -0.701968
+
+
+0.571207 0.519352 -0.597711
+0.447343 0.47005 -0.523615
+0.558016 0.237187 -0.641182
+0.570774 0.223137 -0.652363
+
+
+0.571207 0.519352 -0.597711
+0.877755 0.487545 -0.400305
+
+
+0.436641 0.306611 -0.474289
+0.558016 0.237187 -0.641182
+
+
+0.447343 0.47005 -0.523615
+0.388614 0.421467 -0.426086
+
+
+0.673253 0.347111 -0.131835
+0.418742 0.40606 -0.376284
+
+
+0.178333 0.263751 -0.412696
+0.303818 0.327333 -0.376754
+0.392943 -0.151695 -0.370399
+0.422189 -0.191354 -0.386457
+0.338957 -0.203128 -0.457915
+0.182074 -0.0708916 -0.747034
+0.0678759 -0.0083774 -0.534227
+0.0645656 -0.00737944 -0.517846
+0.0624323 -0.0092088 -0.476276
+0.338957 -0.203128 -0.457915
+
+
+0.178333 0.263751 -0.412696
+0.116655 0.105022 -0.62671
+0.125834 0.00534951 -0.784766
+0.0678759 -0.0083774 -0.534227
+
+
+0.178333 0.263751 -0.412696
+0.0706049 0.0116096 -0.450778
+0.392943 -0.151695 -0.370399
+
+
+0.125834 0.00534951 -0.784766
+0.155718 -0.0143733 -0.829908
+0.545082 0.214626 -0.669543
+0.570774 0.223137 -0.652363
+0.558016 0.237187 -0.641182
+0.545082 0.214626 -0.669543
+
+
+0.116655 0.105022 -0.62671
+0.0645656 -0.00737944 -0.517846
+
+
+0.568604 0.113102 -0.544498
+0.422189 -0.191354 -0.386457
+
+
+0.568604 0.113102 -0.544498
+0.570774 0.223137 -0.652363
+
+
+0.568604 0.113102 -0.544498
+0.436641 0.306611 -0.474289
+0.558016 0.237187 -0.641182
+
+
+0.155718 -0.0143733 -0.829908
+0.182074 -0.0708916 -0.747034
+
+
+0.303818 0.327333 -0.376754
+0.436641 0.306611 -0.474289
+
+
+0.0706049 0.0116096 -0.450778
+0.0624323 -0.0092088 -0.476276
+
+
+0.30374 0.328311 -0.3765
+0.396401 0.276225 -0.162898
+0.637737 0.340202 0.0220607
+0.648876 0.317233 0.033891
+0.646559 0.344368 0.00907275
+0.673253 0.347111 -0.131835
+0.776313 0.0904915 -0.314179
+0.778384 0.0545153 -0.276131
+0.650744 0.308186 0.036535
+0.648876 0.317233 0.033891
+
+
+0.30374 0.328311 -0.3765
+0.385323 0.405852 -0.41799
+0.418742 0.40606 -0.376284
+0.639673 0.345289 0.0150375
+0.637737 0.340202 0.0220607
+
+
+0.30374 0.328311 -0.3765
+0.303818 0.327333 -0.376754
+0.436641 0.306611 -0.474289
+0.385323 0.405852 -0.41799
+
+
+0.303818 0.327333 -0.376754
+0.392943 -0.151695 -0.370399
+0.434104 -0.185302 -0.280374
+0.454826 -0.219994 -0.32518
+0.422189 -0.191354 -0.386457
+0.392943 -0.151695 -0.370399
+
+
+0.418742 0.40606 -0.376284
+0.673253 0.347111 -0.131835
+
+
+0.639673 0.345289 0.0150375
+0.646559 0.344368 0.00907275
+
+
+0.436641 0.306611 -0.474289
+0.568604 0.113102 -0.544498
+0.776313 0.0904915 -0.314179
+
+
+0.568604 0.113102 -0.544498
+0.422189 -0.191354 -0.386457
+
+
+0.434104 -0.185302 -0.280374
+0.468877 0.0597246 -0.0774079
+0.396401 0.276225 -0.162898
+
+
+0.650744 0.308186 0.036535
+0.468877 0.0597246 -0.0774079
+
+
+0.778384 0.0545153 -0.276131
+0.454826 -0.219994 -0.32518
+
+
+0.172601 0.537455 -0.635146
+0.197701 0.427206 -0.425274
+0.359983 0.475877 -0.453506
+0.390522 0.51989 -0.52222
+0.189984 0.545913 -0.644071
+0.172601 0.537455 -0.635146
+-0.0532236 0.536504 -0.410272
+0.0651165 0.449259 -0.341369
+0.197701 0.427206 -0.425274
+
+
+0.420028 0.771096 -0.191124
+0.359983 0.475877 -0.453506
+
+
+0.420028 0.771096 -0.191124
+0.56427 0.969484 -0.533754
+0.559252 1 -0.559252
+0.460465 0.755957 -0.704508
+0.477055 0.68806 -0.634143
+0.56427 0.969484 -0.533754
+
+
+0.420028 0.771096 -0.191124
+0.291564 0.805466 -0.0970299
+0.0809803 1 -0.0809803
+0.559252 1 -0.559252
+
+
+-0.0532236 0.536504 -0.410272
+-0.0417221 0.753053 -0.205225
+0.0706308 0.540567 -0.254092
+0.291564 0.805466 -0.0970299
+
+
+-0.0417221 0.753053 -0.205225
+0.0809803 1 -0.0809803
+
+
+0.390522 0.51989 -0.52222
+0.477055 0.68806 -0.634143
+
+
+0.0706308 0.540567 -0.254092
+0.0651165 0.449259 -0.341369
+
+
+0.189984 0.545913 -0.644071
+0.460465 0.755957 -0.704508
+
+
+0.420028 0.771096 -0.191124
+0.359983 0.475877 -0.453506
+0.388614 0.421467 -0.426086
+0.418742 0.40606 -0.376284
+0.639673 0.345289 0.0150375
+0.646559 0.344368 0.00907275
+0.890205 0.49999 -0.390196
+0.877755 0.487545 -0.400305
+0.673253 0.347111 -0.131835
+0.646559 0.344368 0.00907275
+
+
+0.420028 0.771096 -0.191124
+0.639673 0.345289 0.0150375
+
+
+0.420028 0.771096 -0.191124
+0.56427 0.969484 -0.533754
+0.890205 0.49999 -0.390196
+
+
+0.447343 0.47005 -0.523615
+0.388614 0.421467 -0.426086
+
+
+0.447343 0.47005 -0.523615
+0.390522 0.51989 -0.52222
+0.359983 0.475877 -0.453506
+
+
+0.447343 0.47005 -0.523615
+0.571207 0.519352 -0.597711
+0.477055 0.68806 -0.634143
+0.56427 0.969484 -0.533754
+
+
+0.571207 0.519352 -0.597711
+0.877755 0.487545 -0.400305
+
+
+0.390522 0.51989 -0.52222
+0.477055 0.68806 -0.634143
+
+
+0.673253 0.347111 -0.131835
+0.418742 0.40606 -0.376284
+
+
+0.691638 0.393606 -0.701968
+0.571207 0.519352 -0.597711
+0.477055 0.68806 -0.634143
+0.460465 0.755957 -0.704508
+0.644727 0.644727 -1
+0.691638 0.393606 -0.701968
+0.570774 0.223137 -0.652363
+0.545082 0.214626 -0.669543
+0.558016 0.237187 -0.641182
+0.570774 0.223137 -0.652363
+
+
+0.15488 0.15488 -1
+0.189984 0.545913 -0.644071
+0.460465 0.755957 -0.704508
+
+
+0.15488 0.15488 -1
+0.644727 0.644727 -1
+
+
+0.15488 0.15488 -1
+0.545082 0.214626 -0.669543
+
+
+0.571207 0.519352 -0.597711
+0.447343 0.47005 -0.523615
+0.390522 0.51989 -0.52222
+0.189984 0.545913 -0.644071
+
+
+0.477055 0.68806 -0.634143
+0.390522 0.51989 -0.52222
+
+
+0.447343 0.47005 -0.523615
+0.558016 0.237187 -0.641182
+
+
+0.460465 0.755957 -0.704508
+0.559252 1 -0.559252
+0.56427 0.969484 -0.533754
+0.477055 0.68806 -0.634143
+0.460465 0.755957 -0.704508
+0.644727 0.644727 -1
+1 1 -1
+0.559252 1 -0.559252
+
+
+0.644727 0.644727 -1
+0.691638 0.393606 -0.701968
+0.571207 0.519352 -0.597711
+0.877755 0.487545 -0.400305
+0.890205 0.49999 -0.390196
+1 0.452971 -0.452971
+0.928232 0.410811 -0.482579
+0.877755 0.487545 -0.400305
+
+
+1 1 -1
+1 0.452971 -0.452971
+
+
+0.691638 0.393606 -0.701968
+0.928232 0.410811 -0.482579
+
+
+0.890205 0.49999 -0.390196
+0.56427 0.969484 -0.533754
+
+
+0.477055 0.68806 -0.634143
+0.571207 0.519352 -0.597711
+
+
+-0.31608 -0.235571 -0.0657353
+-0.360327 -0.168115 -0.0941624
+-0.305421 -0.155778 -0.224174
+-0.49639 -0.164854 -0.668464
+-0.500163 -0.18231 -0.682147
+-1 -0.884348 -0.884348
+-0.344825 -0.948017 -0.292842
+-0.282796 -0.691454 -0.323971
+-0.500163 -0.18231 -0.682147
+
+
+-0.31608 -0.235571 -0.0657353
+-0.323005 -0.255936 -0.0588911
+-0.753435 -0.319218 -0.0726532
+-0.875932 -0.237178 -0.11311
+-0.360327 -0.168115 -0.0941624
+
+
+-0.31608 -0.235571 -0.0657353
+-0.270216 -0.231179 -0.164159
+-0.305421 -0.155778 -0.224174
+
+
+-0.344825 -0.948017 -0.292842
+-0.405227 -0.623644 -0.0288709
+-0.323005 -0.255936 -0.0588911
+
+
+-0.875932 -0.237178 -0.11311
+-1 -0.248846 -0.248846
+-0.49639 -0.164854 -0.668464
+
+
+-1 -0.248846 -0.248846
+-1 -0.884348 -0.884348
+
+
+-0.753435 -0.319218 -0.0726532
+-0.405227 -0.623644 -0.0288709
+
+
+-0.282796 -0.691454 -0.323971
+-0.270216 -0.231179 -0.164159
+
+
+-0.344825 -0.948017 -0.292842
+-0.282443 -1 -0.282443
+-0.0365191 -0.731363 -0.305156
+-0.0111284 -0.690111 -0.30932
+0.0367034 -0.494255 -0.333057
+-0.0387564 -0.378023 -0.352814
+-0.282796 -0.691454 -0.323971
+-0.344825 -0.948017 -0.292842
+-0.405227 -0.623644 -0.0288709
+-0.323005 -0.255936 -0.0588911
+-0.269261 -0.240884 -0.019757
+-0.203535 -0.247667 0.0346716
+-0.287052 -0.642278 0.0706698
+-0.405227 -0.623644 -0.0288709
+
+
+-0.282796 -0.691454 -0.323971
+-0.270216 -0.231179 -0.164159
+-0.31608 -0.235571 -0.0657353
+-0.269261 -0.240884 -0.019757
+
+
+-0.0961643 -0.232654 -0.266454
+-0.270216 -0.231179 -0.164159
+
+
+-0.0961643 -0.232654 -0.266454
+-0.014699 -0.250763 -0.0539361
+-0.203535 -0.247667 0.0346716
+
+
+-0.0961643 -0.232654 -0.266454
+-0.0387564 -0.378023 -0.352814
+
+
+-0.014699 -0.250763 -0.0539361
+0.00434811 -0.28809 -0.0631718
+-0.00644878 -0.333176 -0.0584703
+-0.275279 -0.659714 0.0650065
+-0.287052 -0.642278 0.0706698
+
+
+-0.234501 -1 -0.234501
+-0.275279 -0.659714 0.0650065
+
+
+-0.234501 -1 -0.234501
+-0.282443 -1 -0.282443
+
+
+-0.234501 -1 -0.234501
+-0.0365191 -0.731363 -0.305156
+
+
+-0.0111284 -0.690111 -0.30932
+-0.00644878 -0.333176 -0.0584703
+
+
+0.00434811 -0.28809 -0.0631718
+0.0367034 -0.494255 -0.333057
+
+
+-0.31608 -0.235571 -0.0657353
+-0.323005 -0.255936 -0.0588911
+
+
+-0.129802 -0.672344 0.197854
+0.252689 -0.35198 0.174276
+0.349628 -0.476107 0.180507
+0.413249 -0.68404 0.0972886
+0.275667 -0.930084 0.205751
+0.273611 -0.926093 0.20816
+0.349628 -0.476107 0.180507
+
+
+-0.129802 -0.672344 0.197854
+-0.275279 -0.659714 0.0650065
+-0.00644878 -0.333176 -0.0584703
+0.252689 -0.35198 0.174276
+
+
+-0.129802 -0.672344 0.197854
+0.212895 -0.999643 0.213252
+0.273611 -0.926093 0.20816
+
+
+-0.234501 -1 -0.234501
+-0.0365191 -0.731363 -0.305156
+-0.00815701 -0.69694 -0.311217
+-0.0111284 -0.690111 -0.30932
+-0.0365191 -0.731363 -0.305156
+
+
+-0.234501 -1 -0.234501
+0.213051 -1 0.213051
+0.212895 -0.999643 0.213252
+
+
+-0.234501 -1 -0.234501
+-0.275279 -0.659714 0.0650065
+
+
+0.213051 -1 0.213051
+0.275667 -0.930084 0.205751
+
+
+-0.00644878 -0.333176 -0.0584703
+-0.0111284 -0.690111 -0.30932
+
+
+-0.00815701 -0.69694 -0.311217
+0.413249 -0.68404 0.0972886
+
+
+-0.0111284 -0.690111 -0.30932
+-0.00815701 -0.69694 -0.311217
+0.115367 -0.505131 -0.379501
+0.0367034 -0.494255 -0.333057
+-0.0111284 -0.690111 -0.30932
+-0.00644878 -0.333176 -0.0584703
+0.00434811 -0.28809 -0.0631718
+0.0367034 -0.494255 -0.333057
+
+
+-0.00644878 -0.333176 -0.0584703
+0.252689 -0.35198 0.174276
+0.305482 -0.258299 0.191083
+0.289889 -0.223967 0.166656
+0.302943 -0.150428 0.072663
+0.335705 -0.151927 0.0449519
+0.368008 -0.160975 0.0261003
+0.469499 -0.31812 0.11089
+0.410549 -0.322762 0.168964
+0.370455 -0.316013 0.197378
+0.305482 -0.258299 0.191083
+
+
+0.289889 -0.223967 0.166656
+0.17038 -0.150143 0.0388656
+0.00434811 -0.28809 -0.0631718
+
+
+0.272073 -0.140572 0.0518421
+0.335705 -0.151927 0.0449519
+
+
+0.272073 -0.140572 0.0518421
+0.222108 -0.136626 0.0340247
+0.17038 -0.150143 0.0388656
+
+
+0.272073 -0.140572 0.0518421
+0.302943 -0.150428 0.072663
+
+
+0.252689 -0.35198 0.174276
+0.349628 -0.476107 0.180507
+0.370455 -0.316013 0.197378
+
+
+0.222108 -0.136626 0.0340247
+0.389127 -0.19233 -0.105135
+0.454037 -0.29099 -0.254973
+0.567143 -0.467884 0.0350277
+0.413249 -0.68404 0.0972886
+0.349628 -0.476107 0.180507
+
+
+0.454037 -0.29099 -0.254973
+0.115367 -0.505131 -0.379501
+
+
+0.389127 -0.19233 -0.105135
+0.368008 -0.160975 0.0261003
+
+
+-0.00815701 -0.69694 -0.311217
+0.413249 -0.68404 0.0972886
+
+
+0.410549 -0.322762 0.168964
+0.553875 -0.447557 0.0479289
+0.567143 -0.467884 0.0350277
+
+
+0.553875 -0.447557 0.0479289
+0.469499 -0.31812 0.11089
+
+
+-0.211003 -0.480913 0.308085
+-0.232623 -0.473908 0.293469
+-0.287052 -0.642278 0.0706698
+-0.203535 -0.247667 0.0346716
+-0.194105 -0.214589 0.062431
+-0.173107 -0.179421 0.230987
+-0.232623 -0.473908 0.293469
+
+
+-0.211003 -0.480913 0.308085
+-0.129802 -0.672344 0.197854
+-0.275279 -0.659714 0.0650065
+-0.287052 -0.642278 0.0706698
+
+
+-0.211003 -0.480913 0.308085
+-0.0134403 -0.219098 0.33498
+0.284614 -0.238 0.207692
+0.289889 -0.223967 0.166656
+0.305482 -0.258299 0.191083
+0.284614 -0.238 0.207692
+
+
+-0.0134403 -0.219098 0.33498
+-0.157374 -0.148214 0.229739
+-0.158474 -0.148807 0.229306
+-0.148059 -0.122458 0.139215
+-0.141223 -0.118069 0.138698
+-0.157374 -0.148214 0.229739
+
+
+-0.014699 -0.250763 -0.0539361
+0.00434811 -0.28809 -0.0631718
+0.17038 -0.150143 0.0388656
+0.0827999 -0.125075 0.023588
+-0.014699 -0.250763 -0.0539361
+-0.203535 -0.247667 0.0346716
+
+
+0.0827999 -0.125075 0.023588
+-0.135137 -0.116465 0.130727
+-0.141223 -0.118069 0.138698
+
+
+-0.275279 -0.659714 0.0650065
+-0.00644878 -0.333176 -0.0584703
+0.252689 -0.35198 0.174276
+-0.129802 -0.672344 0.197854
+
+
+0.17038 -0.150143 0.0388656
+0.289889 -0.223967 0.166656
+
+
+-0.00644878 -0.333176 -0.0584703
+0.00434811 -0.28809 -0.0631718
+
+
+0.252689 -0.35198 0.174276
+0.305482 -0.258299 0.191083
+
+
+-0.151305 -0.12857 0.126334
+-0.135137 -0.116465 0.130727
+
+
+-0.151305 -0.12857 0.126334
+-0.194105 -0.214589 0.062431
+
+
+-0.151305 -0.12857 0.126334
+-0.148059 -0.122458 0.139215
+
+
+-0.158474 -0.148807 0.229306
+-0.173107 -0.179421 0.230987
+
+
+-0.380152 0.469654 0.0590937
+-0.382545 0.551996 0.127109
+-0.41675 0.559819 0.10796
+-0.433374 0.542872 0.0810596
+-0.380152 0.469654 0.0590937
+-0.355936 0.276794 -0.00878987
+-0.317291 0.180576 0.0878299
+-0.263793 0.212745 0.381793
+-0.3042 0.417241 0.381415
+-0.382545 0.551996 0.127109
+
+
+-0.317291 0.180576 0.0878299
+-0.541272 0.0599715 0.101152
+-0.639667 0.171691 -0.0322115
+-0.662624 0.218896 -0.0563041
+-0.662014 0.251674 -0.0443584
+-0.47279 0.42567 0.341296
+-0.41675 0.559819 0.10796
+
+
+-0.662014 0.251674 -0.0443584
+-0.433374 0.542872 0.0810596
+
+
+-0.355936 0.276794 -0.00878987
+-0.614892 0.21051 -0.0552214
+-0.639667 0.171691 -0.0322115
+
+
+-0.47279 0.42567 0.341296
+-0.464581 0.419573 0.353492
+-0.409633 0.133801 0.353756
+-0.541272 0.0599715 0.101152
+
+
+-0.614892 0.21051 -0.0552214
+-0.662624 0.218896 -0.0563041
+
+
+-0.263793 0.212745 0.381793
+-0.409633 0.133801 0.353756
+
+
+-0.464581 0.419573 0.353492
+-0.3042 0.417241 0.381415
+
+
+-0.438576 0.213401 -0.348022
+-0.355096 0.179603 -0.178472
+-0.614892 0.21051 -0.0552214
+-0.662624 0.218896 -0.0563041
+-0.639667 0.171691 -0.0322115
+-0.658362 0.057749 0.00796545
+-0.98323 -0.0466444 -0.0298743
+-1 -0.037522 -0.037522
+-0.708576 0.222542 -0.0688819
+-0.700453 0.226847 -0.0686008
+-0.662624 0.218896 -0.0563041
+
+
+-0.438576 0.213401 -0.348022
+-0.37344 0.00615027 -0.62041
+-0.346683 -0.0269351 -0.615853
+-0.382162 -0.0275644 -0.645403
+-0.487826 -0.159023 -0.671196
+-0.49639 -0.164854 -0.668464
+-0.305421 -0.155778 -0.224174
+-0.224045 -0.0738897 -0.360738
+-0.2914 -0.0695654 -0.548873
+-0.487826 -0.159023 -0.671196
+
+
+-0.438576 0.213401 -0.348022
+-0.702495 0.227375 -0.0701301
+-0.700453 0.226847 -0.0686008
+
+
+-1 -0.248846 -0.248846
+-0.875932 -0.237178 -0.11311
+-0.360327 -0.168115 -0.0941624
+-0.305421 -0.155778 -0.224174
+
+
+-1 -0.248846 -0.248846
+-1 -0.037522 -0.037522
+
+
+-1 -0.248846 -0.248846
+-0.49639 -0.164854 -0.668464
+
+
+-0.346683 -0.0269351 -0.615853
+-0.2914 -0.0695654 -0.548873
+
+
+-0.360327 -0.168115 -0.0941624
+-0.357562 -0.152708 -0.0876633
+-0.251383 0.0371449 -0.192607
+-0.355096 0.179603 -0.178472
+
+
+-0.658362 0.057749 0.00796545
+-0.357562 -0.152708 -0.0876633
+
+
+-0.702495 0.227375 -0.0701301
+-0.708576 0.222542 -0.0688819
+
+
+-0.875932 -0.237178 -0.11311
+-0.98323 -0.0466444 -0.0298743
+
+
+-0.251383 0.0371449 -0.192607
+-0.224045 -0.0738897 -0.360738
+
+
+-0.382162 -0.0275644 -0.645403
+-0.37344 0.00615027 -0.62041
+
+
+-0.614892 0.21051 -0.0552214
+-0.639667 0.171691 -0.0322115
+
+
+-0.494139 -0.0823338 0.423527
+-0.484978 -0.0769964 0.419674
+-0.158474 -0.148807 0.229306
+-0.173107 -0.179421 0.230987
+-0.438374 -0.189909 0.371717
+-0.494139 -0.0823338 0.423527
+-0.98323 -0.0466444 -0.0298743
+-0.658362 0.057749 0.00796545
+-0.543074 0.0556927 0.101775
+-0.484978 -0.0769964 0.419674
+
+
+-0.543074 0.0556927 0.101775
+-0.148059 -0.122458 0.139215
+-0.151305 -0.12857 0.126334
+-0.194105 -0.214589 0.062431
+-0.173107 -0.179421 0.230987
+
+
+-0.98323 -0.0466444 -0.0298743
+-0.875932 -0.237178 -0.11311
+-0.753435 -0.319218 -0.0726532
+-0.323005 -0.255936 -0.0588911
+-0.269261 -0.240884 -0.019757
+-0.31608 -0.235571 -0.0657353
+-0.323005 -0.255936 -0.0588911
+
+
+-0.438374 -0.189909 0.371717
+-0.753435 -0.319218 -0.0726532
+
+
+-0.658362 0.057749 0.00796545
+-0.357562 -0.152708 -0.0876633
+-0.360327 -0.168115 -0.0941624
+-0.875932 -0.237178 -0.11311
+
+
+-0.151305 -0.12857 0.126334
+-0.357562 -0.152708 -0.0876633
+
+
+-0.158474 -0.148807 0.229306
+-0.148059 -0.122458 0.139215
+
+
+-0.194105 -0.214589 0.062431
+-0.269261 -0.240884 -0.019757
+
+
+-0.360327 -0.168115 -0.0941624
+-0.31608 -0.235571 -0.0657353
+
+
+-0.614892 0.21051 -0.0552214
+-0.355096 0.179603 -0.178472
+-0.251383 0.0371449 -0.192607
+-0.0384305 0.156115 -0.0856845
+-0.0362968 0.216554 -0.0650389
+-0.173535 0.254699 -0.0960122
+-0.355096 0.179603 -0.178472
+
+
+-0.614892 0.21051 -0.0552214
+-0.639667 0.171691 -0.0322115
+-0.541272 0.0599715 0.101152
+-0.543074 0.0556927 0.101775
+-0.658362 0.057749 0.00796545
+-0.639667 0.171691 -0.0322115
+
+
+-0.614892 0.21051 -0.0552214
+-0.355936 0.276794 -0.00878987
+-0.317291 0.180576 0.0878299
+-0.541272 0.0599715 0.101152
+
+
+-0.543074 0.0556927 0.101775
+-0.148059 -0.122458 0.139215
+-0.141223 -0.118069 0.138698
+-0.135137 -0.116465 0.130727
+-0.151305 -0.12857 0.126334
+-0.148059 -0.122458 0.139215
+
+
+-0.173535 0.254699 -0.0960122
+-0.203233 0.271238 -0.0592465
+-0.355936 0.276794 -0.00878987
+
+
+-0.317291 0.180576 0.0878299
+-0.098781 0.0936685 0.106726
+-0.0214535 0.152552 0.00999189
+-0.0306555 0.207826 -0.050353
+-0.0121266 0.123621 -0.0152665
+-0.0384305 0.156115 -0.0856845
+
+
+-0.0121266 0.123621 -0.0152665
+-0.0113337 0.118094 -0.00763114
+-0.0214535 0.152552 0.00999189
+
+
+-0.135137 -0.116465 0.130727
+-0.0113337 0.118094 -0.00763114
+
+
+-0.098781 0.0936685 0.106726
+-0.141223 -0.118069 0.138698
+
+
+-0.151305 -0.12857 0.126334
+-0.357562 -0.152708 -0.0876633
+-0.658362 0.057749 0.00796545
+
+
+-0.357562 -0.152708 -0.0876633
+-0.251383 0.0371449 -0.192607
+
+
+-0.0306555 0.207826 -0.050353
+-0.0344808 0.21702 -0.0595358
+-0.203233 0.271238 -0.0592465
+
+
+-0.0344808 0.21702 -0.0595358
+-0.0362968 0.216554 -0.0650389
+
+
+-0.126795 0.172228 0.469272
+-0.14998 0.0723227 0.511391
+-0.157374 -0.148214 0.229739
+-0.141223 -0.118069 0.138698
+-0.148059 -0.122458 0.139215
+-0.158474 -0.148807 0.229306
+-0.157374 -0.148214 0.229739
+
+
+-0.126795 0.172228 0.469272
+-0.098781 0.0936685 0.106726
+-0.141223 -0.118069 0.138698
+
+
+-0.126795 0.172228 0.469272
+-0.263793 0.212745 0.381793
+-0.317291 0.180576 0.0878299
+-0.098781 0.0936685 0.106726
+
+
+-0.484978 -0.0769964 0.419674
+-0.477185 -0.0680266 0.428882
+-0.14998 0.0723227 0.511391
+
+
+-0.484978 -0.0769964 0.419674
+-0.543074 0.0556927 0.101775
+-0.541272 0.0599715 0.101152
+-0.409633 0.133801 0.353756
+-0.263793 0.212745 0.381793
+
+
+-0.484978 -0.0769964 0.419674
+-0.158474 -0.148807 0.229306
+
+
+-0.317291 0.180576 0.0878299
+-0.541272 0.0599715 0.101152
+
+
+-0.543074 0.0556927 0.101775
+-0.148059 -0.122458 0.139215
+
+
+-0.477185 -0.0680266 0.428882
+-0.409633 0.133801 0.353756
+
+
+-0.203535 -0.247667 0.0346716
+-0.287052 -0.642278 0.0706698
+-0.232623 -0.473908 0.293469
+-0.438374 -0.189909 0.371717
+-0.173107 -0.179421 0.230987
+-0.232623 -0.473908 0.293469
+
+
+-0.203535 -0.247667 0.0346716
+-0.269261 -0.240884 -0.019757
+-0.323005 -0.255936 -0.0588911
+-0.405227 -0.623644 -0.0288709
+-0.287052 -0.642278 0.0706698
+
+
+-0.203535 -0.247667 0.0346716
+-0.194105 -0.214589 0.062431
+-0.269261 -0.240884 -0.019757
+
+
+-0.405227 -0.623644 -0.0288709
+-0.753435 -0.319218 -0.0726532
+-0.438374 -0.189909 0.371717
+
+
+-0.753435 -0.319218 -0.0726532
+-0.323005 -0.255936 -0.0588911
+
+
+-0.173107 -0.179421 0.230987
+-0.194105 -0.214589 0.062431
+
+
+-0.0214535 0.152552 0.00999189
+-0.0306555 0.207826 -0.050353
+-0.0344808 0.21702 -0.0595358
+-0.0304154 0.219991 -0.0559765
+0.0202616 0.335803 0.0540695
+-0.100339 0.504816 0.162884
+-0.0185682 0.426404 0.159951
+-0.131127 0.291634 0.482103
+-0.22657 0.421979 0.434642
+-0.3042 0.417241 0.381415
+-0.382545 0.551996 0.127109
+-0.21631 0.589121 0.202306
+-0.22657 0.421979 0.434642
+
+
+-0.0214535 0.152552 0.00999189
+0.0510104 0.288209 0.183189
+-0.0948994 0.217084 0.496807
+-0.131127 0.291634 0.482103
+
+
+-0.0214535 0.152552 0.00999189
+-0.098781 0.0936685 0.106726
+-0.317291 0.180576 0.0878299
+-0.263793 0.212745 0.381793
+-0.3042 0.417241 0.381415
+
+
+-0.0306555 0.207826 -0.050353
+-0.0304154 0.219991 -0.0559765
+
+
+0.0510104 0.288209 0.183189
+0.0450786 0.351157 0.129839
+0.0202616 0.335803 0.0540695
+
+
+-0.0344808 0.21702 -0.0595358
+-0.203233 0.271238 -0.0592465
+-0.380152 0.469654 0.0590937
+-0.355936 0.276794 -0.00878987
+-0.203233 0.271238 -0.0592465
+
+
+-0.317291 0.180576 0.0878299
+-0.355936 0.276794 -0.00878987
+
+
+-0.380152 0.469654 0.0590937
+-0.382545 0.551996 0.127109
+
+
+-0.263793 0.212745 0.381793
+-0.126795 0.172228 0.469272
+-0.098781 0.0936685 0.106726
+
+
+-0.0948994 0.217084 0.496807
+-0.126795 0.172228 0.469272
+
+
+0.0450786 0.351157 0.129839
+-0.0185682 0.426404 0.159951
+
+
+-0.100339 0.504816 0.162884
+-0.21631 0.589121 0.202306
+
+
+0.279752 -0.104198 0.274057
+0.294461 -0.0175002 0.168895
+0.302943 -0.150428 0.072663
+0.272073 -0.140572 0.0518421
+0.222108 -0.136626 0.0340247
+0.17038 -0.150143 0.0388656
+0.0827999 -0.125075 0.023588
+-0.135137 -0.116465 0.130727
+-0.141223 -0.118069 0.138698
+-0.157374 -0.148214 0.229739
+-0.0134403 -0.219098 0.33498
+-0.00777141 -0.216899 0.345276
+0.135377 -0.220635 0.310686
+0.283918 -0.236806 0.213701
+0.284614 -0.238 0.207692
+-0.0134403 -0.219098 0.33498
+
+
+0.279752 -0.104198 0.274057
+0.164122 0.0340818 0.404372
+0.147295 0.259027 0.249351
+0.294461 -0.0175002 0.168895
+
+
+0.279752 -0.104198 0.274057
+0.283918 -0.236806 0.213701
+
+
+0.284614 -0.238 0.207692
+0.289889 -0.223967 0.166656
+0.17038 -0.150143 0.0388656
+
+
+0.0987075 -0.0734021 -0.00115905
+0.0827999 -0.125075 0.023588
+
+
+0.0987075 -0.0734021 -0.00115905
+-0.000580677 0.10421 -0.00856129
+-0.0113337 0.118094 -0.00763114
+-0.0214535 0.152552 0.00999189
+-0.098781 0.0936685 0.106726
+-0.126795 0.172228 0.469272
+-0.14998 0.0723227 0.511391
+-0.157374 -0.148214 0.229739
+
+
+0.0987075 -0.0734021 -0.00115905
+0.222108 -0.136626 0.0340247
+
+
+0.0510104 0.288209 0.183189
+0.144762 0.262201 0.249494
+-0.0857212 0.208954 0.524154
+-0.0895416 0.132235 0.586727
+-0.121677 0.0831381 0.562589
+-0.14998 0.0723227 0.511391
+
+
+0.0510104 0.288209 0.183189
+-0.0214535 0.152552 0.00999189
+
+
+0.0510104 0.288209 0.183189
+-0.0948994 0.217084 0.496807
+-0.0857212 0.208954 0.524154
+
+
+0.302943 -0.150428 0.072663
+0.289889 -0.223967 0.166656
+
+
+0.147295 0.259027 0.249351
+0.144762 0.262201 0.249494
+
+
+-0.000580677 0.10421 -0.00856129
+0.272073 -0.140572 0.0518421
+
+
+-0.135137 -0.116465 0.130727
+-0.0113337 0.118094 -0.00763114
+
+
+-0.0368794 0.102603 0.555949
+-0.0895416 0.132235 0.586727
+
+
+-0.0368794 0.102603 0.555949
+0.135377 -0.220635 0.310686
+
+
+-0.0368794 0.102603 0.555949
+0.164122 0.0340818 0.404372
+
+
+-0.141223 -0.118069 0.138698
+-0.098781 0.0936685 0.106726
+
+
+-0.121677 0.0831381 0.562589
+-0.00777141 -0.216899 0.345276
+
+
+-0.126795 0.172228 0.469272
+-0.0948994 0.217084 0.496807
+
+
+0.0706049 0.0116096 -0.450778
+0.392943 -0.151695 -0.370399
+0.434104 -0.185302 -0.280374
+0.468877 0.0597246 -0.0774079
+0.396401 0.276225 -0.162898
+0.0765779 0.334882 -0.128994
+-0.0304154 0.219991 -0.0559765
+-0.0344808 0.21702 -0.0595358
+-0.0306555 0.207826 -0.050353
+-0.0121266 0.123621 -0.0152665
+-0.0384305 0.156115 -0.0856845
+-0.0362968 0.216554 -0.0650389
+-0.0344808 0.21702 -0.0595358
+
+
+0.0706049 0.0116096 -0.450778
+0.0603802 0.0151203 -0.442887
+0.0140575 0.0147151 -0.305138
+0.0987075 -0.0734021 -0.00115905
+0.222108 -0.136626 0.0340247
+0.272073 -0.140572 0.0518421
+0.335705 -0.151927 0.0449519
+0.379587 -0.127665 0.0254859
+0.368008 -0.160975 0.0261003
+0.335705 -0.151927 0.0449519
+
+
+0.0706049 0.0116096 -0.450778
+0.178333 0.263751 -0.412696
+0.19502 0.351606 -0.386337
+0.30374 0.328311 -0.3765
+0.396401 0.276225 -0.162898
+
+
+-0.0306555 0.207826 -0.050353
+-0.0304154 0.219991 -0.0559765
+
+
+-0.000580677 0.10421 -0.00856129
+0.0987075 -0.0734021 -0.00115905
+
+
+-0.000580677 0.10421 -0.00856129
+0.272073 -0.140572 0.0518421
+
+
+-0.000580677 0.10421 -0.00856129
+-0.0121266 0.123621 -0.0152665
+
+
+0.066935 0.363798 -0.300819
+0.0765779 0.334882 -0.128994
+
+
+0.066935 0.363798 -0.300819
+0.19502 0.351606 -0.386337
+
+
+0.066935 0.363798 -0.300819
+0.0644266 0.36136 -0.300266
+0.0603802 0.0151203 -0.442887
+
+
+0.434104 -0.185302 -0.280374
+0.389127 -0.19233 -0.105135
+0.222108 -0.136626 0.0340247
+
+
+0.468877 0.0597246 -0.0774079
+0.379587 -0.127665 0.0254859
+
+
+0.178333 0.263751 -0.412696
+0.303818 0.327333 -0.376754
+0.392943 -0.151695 -0.370399
+
+
+0.303818 0.327333 -0.376754
+0.30374 0.328311 -0.3765
+
+
+0.0140575 0.0147151 -0.305138
+-0.0384305 0.156115 -0.0856845
+
+
+0.0644266 0.36136 -0.300266
+-0.0362968 0.216554 -0.0650389
+
+
+0.389127 -0.19233 -0.105135
+0.368008 -0.160975 0.0261003
+
+
+0.0787245 0.352985 -0.0932439
+0.0765779 0.334882 -0.128994
+0.396401 0.276225 -0.162898
+0.468877 0.0597246 -0.0774079
+0.650744 0.308186 0.036535
+0.651853 0.308847 0.0392996
+0.648876 0.317233 0.033891
+0.650744 0.308186 0.036535
+
+
+0.0787245 0.352985 -0.0932439
+0.0202616 0.335803 0.0540695
+-0.0304154 0.219991 -0.0559765
+0.0765779 0.334882 -0.128994
+
+
+0.0787245 0.352985 -0.0932439
+0.280918 0.456828 0.159444
+0.349381 0.462661 0.187958
+0.359247 0.388734 0.252019
+0.15824 0.269343 0.250301
+0.144762 0.262201 0.249494
+0.0510104 0.288209 0.183189
+0.0450786 0.351157 0.129839
+0.280918 0.456828 0.159444
+
+
+-0.0304154 0.219991 -0.0559765
+-0.0306555 0.207826 -0.050353
+-0.0214535 0.152552 0.00999189
+-0.0113337 0.118094 -0.00763114
+-0.0121266 0.123621 -0.0152665
+-0.0306555 0.207826 -0.050353
+
+
+0.147295 0.259027 0.249351
+0.144762 0.262201 0.249494
+
+
+0.147295 0.259027 0.249351
+0.294461 -0.0175002 0.168895
+0.494912 0.291772 0.213316
+0.642213 0.275482 0.0823055
+0.379587 -0.127665 0.0254859
+0.335705 -0.151927 0.0449519
+0.272073 -0.140572 0.0518421
+0.302943 -0.150428 0.072663
+0.335705 -0.151927 0.0449519
+
+
+0.147295 0.259027 0.249351
+0.15824 0.269343 0.250301
+
+
+0.294461 -0.0175002 0.168895
+0.302943 -0.150428 0.072663
+
+
+0.642213 0.275482 0.0823055
+0.651853 0.308847 0.0392996
+
+
+-0.0113337 0.118094 -0.00763114
+-0.000580677 0.10421 -0.00856129
+-0.0121266 0.123621 -0.0152665
+
+
+-0.000580677 0.10421 -0.00856129
+0.272073 -0.140572 0.0518421
+
+
+0.379587 -0.127665 0.0254859
+0.468877 0.0597246 -0.0774079
+
+
+0.0202616 0.335803 0.0540695
+0.0450786 0.351157 0.129839
+
+
+0.648876 0.317233 0.033891
+0.637737 0.340202 0.0220607
+0.396401 0.276225 -0.162898
+
+
+0.637737 0.340202 0.0220607
+0.349381 0.462661 0.187958
+
+
+0.494912 0.291772 0.213316
+0.359247 0.388734 0.252019
+
+
+0.0510104 0.288209 0.183189
+-0.0214535 0.152552 0.00999189
+
+
+0.0827999 -0.125075 0.023588
+-0.014699 -0.250763 -0.0539361
+-0.203535 -0.247667 0.0346716
+-0.194105 -0.214589 0.062431
+-0.151305 -0.12857 0.126334
+-0.135137 -0.116465 0.130727
+0.0827999 -0.125075 0.023588
+0.0987075 -0.0734021 -0.00115905
+0.0140575 0.0147151 -0.305138
+-0.0384305 0.156115 -0.0856845
+-0.0121266 0.123621 -0.0152665
+-0.0113337 0.118094 -0.00763114
+-0.135137 -0.116465 0.130727
+
+
+-0.014699 -0.250763 -0.0539361
+-0.0961643 -0.232654 -0.266454
+-0.0900641 -0.0895853 -0.423836
+-0.224045 -0.0738897 -0.360738
+-0.305421 -0.155778 -0.224174
+-0.360327 -0.168115 -0.0941624
+-0.31608 -0.235571 -0.0657353
+-0.270216 -0.231179 -0.164159
+-0.305421 -0.155778 -0.224174
+
+
+-0.269261 -0.240884 -0.019757
+-0.203535 -0.247667 0.0346716
+
+
+-0.269261 -0.240884 -0.019757
+-0.194105 -0.214589 0.062431
+
+
+-0.269261 -0.240884 -0.019757
+-0.31608 -0.235571 -0.0657353
+
+
+0.0140575 0.0147151 -0.305138
+-0.0900641 -0.0895853 -0.423836
+
+
+-0.251383 0.0371449 -0.192607
+-0.0384305 0.156115 -0.0856845
+
+
+-0.251383 0.0371449 -0.192607
+-0.224045 -0.0738897 -0.360738
+
+
+-0.251383 0.0371449 -0.192607
+-0.357562 -0.152708 -0.0876633
+-0.360327 -0.168115 -0.0941624
+
+
+-0.357562 -0.152708 -0.0876633
+-0.151305 -0.12857 0.126334
+
+
+-0.0113337 0.118094 -0.00763114
+-0.000580677 0.10421 -0.00856129
+0.0987075 -0.0734021 -0.00115905
+
+
+-0.000580677 0.10421 -0.00856129
+-0.0121266 0.123621 -0.0152665
+
+
+-0.0961643 -0.232654 -0.266454
+-0.270216 -0.231179 -0.164159
+
+
+0.00434811 -0.28809 -0.0631718
+-0.014699 -0.250763 -0.0539361
+0.0827999 -0.125075 0.023588
+0.17038 -0.150143 0.0388656
+0.00434811 -0.28809 -0.0631718
+0.0367034 -0.494255 -0.333057
+0.115367 -0.505131 -0.379501
+0.120107 -0.484893 -0.395
+-0.0532372 -0.236482 -0.429081
+-0.0387564 -0.378023 -0.352814
+0.0367034 -0.494255 -0.333057
+
+
+0.0295819 -0.0146201 -0.473395
+0.00911382 -0.028602 -0.469712
+-0.0734063 -0.134881 -0.445983
+-0.0848488 -0.0904706 -0.443201
+-0.0900641 -0.0895853 -0.423836
+-0.0961643 -0.232654 -0.266454
+-0.0387564 -0.378023 -0.352814
+
+
+0.0295819 -0.0146201 -0.473395
+0.0603802 0.0151203 -0.442887
+0.0140575 0.0147151 -0.305138
+-0.0900641 -0.0895853 -0.423836
+
+
+0.0295819 -0.0146201 -0.473395
+0.0624323 -0.0092088 -0.476276
+0.338957 -0.203128 -0.457915
+0.422189 -0.191354 -0.386457
+0.454826 -0.219994 -0.32518
+0.434104 -0.185302 -0.280374
+0.392943 -0.151695 -0.370399
+0.422189 -0.191354 -0.386457
+
+
+0.0624323 -0.0092088 -0.476276
+0.0706049 0.0116096 -0.450778
+0.0603802 0.0151203 -0.442887
+
+
+0.0706049 0.0116096 -0.450778
+0.392943 -0.151695 -0.370399
+
+
+0.222108 -0.136626 0.0340247
+0.389127 -0.19233 -0.105135
+0.434104 -0.185302 -0.280374
+
+
+0.222108 -0.136626 0.0340247
+0.0987075 -0.0734021 -0.00115905
+0.0827999 -0.125075 0.023588
+
+
+0.222108 -0.136626 0.0340247
+0.17038 -0.150143 0.0388656
+
+
+0.0987075 -0.0734021 -0.00115905
+0.0140575 0.0147151 -0.305138
+
+
+0.338957 -0.203128 -0.457915
+0.120107 -0.484893 -0.395
+
+
+0.115367 -0.505131 -0.379501
+0.454037 -0.29099 -0.254973
+0.389127 -0.19233 -0.105135
+
+
+-0.0848488 -0.0904706 -0.443201
+0.00911382 -0.028602 -0.469712
+
+
+-0.0734063 -0.134881 -0.445983
+-0.0532372 -0.236482 -0.429081
+
+
+-0.0961643 -0.232654 -0.266454
+-0.014699 -0.250763 -0.0539361
+
+
+0.454037 -0.29099 -0.254973
+0.454826 -0.219994 -0.32518
+
+
+0.733718 0.10093 0.165352
+0.558393 -0.265513 0.146958
+0.595376 -0.453087 0.0484626
+0.575005 -0.465174 0.0401799
+0.567143 -0.467884 0.0350277
+0.553875 -0.447557 0.0479289
+0.575005 -0.465174 0.0401799
+
+
+0.733718 0.10093 0.165352
+0.972801 0.0497033 -0.0225046
+0.651853 0.308847 0.0392996
+0.642213 0.275482 0.0823055
+0.733718 0.10093 0.165352
+
+
+0.368008 -0.160975 0.0261003
+0.469499 -0.31812 0.11089
+0.558393 -0.265513 0.146958
+
+
+0.368008 -0.160975 0.0261003
+0.379587 -0.127665 0.0254859
+0.642213 0.275482 0.0823055
+
+
+0.368008 -0.160975 0.0261003
+0.389127 -0.19233 -0.105135
+0.434104 -0.185302 -0.280374
+0.468877 0.0597246 -0.0774079
+0.650744 0.308186 0.036535
+0.651853 0.308847 0.0392996
+
+
+0.778384 0.0545153 -0.276131
+0.650744 0.308186 0.036535
+
+
+0.778384 0.0545153 -0.276131
+0.988041 0.0291869 -0.0411464
+0.972801 0.0497033 -0.0225046
+
+
+0.778384 0.0545153 -0.276131
+0.454826 -0.219994 -0.32518
+0.434104 -0.185302 -0.280374
+
+
+0.379587 -0.127665 0.0254859
+0.468877 0.0597246 -0.0774079
+
+
+0.988041 0.0291869 -0.0411464
+0.595376 -0.453087 0.0484626
+
+
+0.454826 -0.219994 -0.32518
+0.454037 -0.29099 -0.254973
+0.389127 -0.19233 -0.105135
+
+
+0.454037 -0.29099 -0.254973
+0.567143 -0.467884 0.0350277
+
+
+0.469499 -0.31812 0.11089
+0.553875 -0.447557 0.0479289
+
+
+0.595376 -0.453087 0.0484626
+0.558393 -0.265513 0.146958
+0.72632 -0.105578 0.379258
+1 -0.391026 0.391026
+0.595376 -0.453087 0.0484626
+0.988041 0.0291869 -0.0411464
+0.972801 0.0497033 -0.0225046
+0.733718 0.10093 0.165352
+0.72632 -0.105578 0.379258
+
+
+0.558393 -0.265513 0.146958
+0.733718 0.10093 0.165352
+
+
+0.972801 0.0497033 -0.0225046
+1 0.034241 -0.034241
+1 -0.391026 0.391026
+
+
+1 0.034241 -0.034241
+0.988041 0.0291869 -0.0411464
+
+
+1 0.034241 -0.034241
+0.988041 0.0291869 -0.0411464
+0.778384 0.0545153 -0.276131
+0.776313 0.0904915 -0.314179
+0.673253 0.347111 -0.131835
+0.877755 0.487545 -0.400305
+0.890205 0.49999 -0.390196
+0.646559 0.344368 0.00907275
+0.673253 0.347111 -0.131835
+
+
+1 0.034241 -0.034241
+1 0.452971 -0.452971
+0.890205 0.49999 -0.390196
+
+
+1 0.034241 -0.034241
+0.972801 0.0497033 -0.0225046
+0.988041 0.0291869 -0.0411464
+
+
+0.972801 0.0497033 -0.0225046
+0.651853 0.308847 0.0392996
+0.650744 0.308186 0.036535
+0.648876 0.317233 0.033891
+0.651853 0.308847 0.0392996
+
+
+0.928232 0.410811 -0.482579
+1 0.452971 -0.452971
+
+
+0.928232 0.410811 -0.482579
+0.776313 0.0904915 -0.314179
+
+
+0.928232 0.410811 -0.482579
+0.877755 0.487545 -0.400305
+
+
+0.778384 0.0545153 -0.276131
+0.650744 0.308186 0.036535
+
+
+0.646559 0.344368 0.00907275
+0.648876 0.317233 0.033891
+
+
+-0.614892 0.21051 -0.0552214
+-0.355936 0.276794 -0.00878987
+-0.380152 0.469654 0.0590937
+-0.203233 0.271238 -0.0592465
+-0.355936 0.276794 -0.00878987
+
+
+-0.614892 0.21051 -0.0552214
+-0.662624 0.218896 -0.0563041
+-0.700453 0.226847 -0.0686008
+-0.662014 0.251674 -0.0443584
+-0.662624 0.218896 -0.0563041
+
+
+-0.614892 0.21051 -0.0552214
+-0.355096 0.179603 -0.178472
+-0.173535 0.254699 -0.0960122
+-0.118511 0.4374 -0.379162
+-0.128071 0.473542 -0.398387
+-0.163809 0.424743 -0.411447
+-0.118511 0.4374 -0.379162
+
+
+-0.438576 0.213401 -0.348022
+-0.355096 0.179603 -0.178472
+
+
+-0.438576 0.213401 -0.348022
+-0.702495 0.227375 -0.0701301
+-0.700453 0.226847 -0.0686008
+
+
+-0.438576 0.213401 -0.348022
+-0.163809 0.424743 -0.411447
+
+
+-0.128071 0.473542 -0.398387
+-0.454518 0.603489 0.0580064
+-0.702495 0.227375 -0.0701301
+
+
+-0.454518 0.603489 0.0580064
+-0.433374 0.542872 0.0810596
+-0.380152 0.469654 0.0590937
+
+
+-0.433374 0.542872 0.0810596
+-0.662014 0.251674 -0.0443584
+
+
+-0.203233 0.271238 -0.0592465
+-0.173535 0.254699 -0.0960122
+
+
+-1 0.802902 0.802902
+-0.444509 0.632208 0.0767165
+-0.454518 0.603489 0.0580064
+-0.433374 0.542872 0.0810596
+-0.41675 0.559819 0.10796
+-0.444509 0.632208 0.0767165
+
+
+-1 0.802902 0.802902
+-1 0.103586 0.103586
+-0.753311 0.323364 0.570054
+-0.753397 0.487416 0.734019
+-0.488595 0.422971 0.369949
+-0.753311 0.323364 0.570054
+
+
+-1 0.802902 0.802902
+-0.753397 0.487416 0.734019
+
+
+-0.433374 0.542872 0.0810596
+-0.662014 0.251674 -0.0443584
+-0.700453 0.226847 -0.0686008
+-0.708576 0.222542 -0.0688819
+-1 0.103586 0.103586
+
+
+-0.41675 0.559819 0.10796
+-0.47279 0.42567 0.341296
+-0.662014 0.251674 -0.0443584
+
+
+-0.708576 0.222542 -0.0688819
+-0.702495 0.227375 -0.0701301
+-0.454518 0.603489 0.0580064
+
+
+-0.702495 0.227375 -0.0701301
+-0.700453 0.226847 -0.0686008
+
+
+-0.47279 0.42567 0.341296
+-0.488595 0.422971 0.369949
+
+
+0.315565 0.507672 0.176763
+0.280918 0.456828 0.159444
+0.0787245 0.352985 -0.0932439
+0.0202616 0.335803 0.0540695
+0.0450786 0.351157 0.129839
+0.280918 0.456828 0.159444
+
+
+0.315565 0.507672 0.176763
+0.291564 0.805466 -0.0970299
+0.0809803 1 -0.0809803
+-0.0417221 0.753053 -0.205225
+0.0706308 0.540567 -0.254092
+0.291564 0.805466 -0.0970299
+
+
+0.315565 0.507672 0.176763
+0.161909 0.615677 0.222414
+-0.0185682 0.426404 0.159951
+0.0450786 0.351157 0.129839
+
+
+-0.0185682 0.426404 0.159951
+-0.100339 0.504816 0.162884
+-0.194709 0.701574 0.186486
+-0.241153 0.879541 0.120694
+-0.183652 1 0.183652
+-0.146158 0.912438 0.23372
+-0.194709 0.701574 0.186486
+
+
+-0.146158 0.912438 0.23372
+0.161909 0.615677 0.222414
+
+
+-0.183652 1 0.183652
+0.0809803 1 -0.0809803
+
+
+-0.100339 0.504816 0.162884
+0.0202616 0.335803 0.0540695
+
+
+0.0706308 0.540567 -0.254092
+0.0787245 0.352985 -0.0932439
+
+
+-0.0417221 0.753053 -0.205225
+-0.241153 0.879541 0.120694
+
+
+-0.454518 0.603489 0.0580064
+-0.444509 0.632208 0.0767165
+-0.241153 0.879541 0.120694
+-0.194709 0.701574 0.186486
+-0.21631 0.589121 0.202306
+-0.382545 0.551996 0.127109
+-0.41675 0.559819 0.10796
+-0.444509 0.632208 0.0767165
+
+
+-0.454518 0.603489 0.0580064
+-0.128071 0.473542 -0.398387
+-0.118511 0.4374 -0.379162
+0.0644266 0.36136 -0.300266
+0.066935 0.363798 -0.300819
+0.0765779 0.334882 -0.128994
+0.0787245 0.352985 -0.0932439
+0.0706308 0.540567 -0.254092
+0.0651165 0.449259 -0.341369
+0.066935 0.363798 -0.300819
+
+
+-0.454518 0.603489 0.0580064
+-0.433374 0.542872 0.0810596
+-0.41675 0.559819 0.10796
+
+
+-0.0417221 0.753053 -0.205225
+-0.0532236 0.536504 -0.410272
+-0.128071 0.473542 -0.398387
+
+
+-0.0417221 0.753053 -0.205225
+-0.241153 0.879541 0.120694
+
+
+-0.0417221 0.753053 -0.205225
+0.0706308 0.540567 -0.254092
+
+
+0.0202616 0.335803 0.0540695
+0.0787245 0.352985 -0.0932439
+
+
+0.0202616 0.335803 0.0540695
+-0.100339 0.504816 0.162884
+-0.21631 0.589121 0.202306
+
+
+0.0202616 0.335803 0.0540695
+-0.0304154 0.219991 -0.0559765
+-0.0344808 0.21702 -0.0595358
+-0.0362968 0.216554 -0.0650389
+0.0644266 0.36136 -0.300266
+
+
+-0.194709 0.701574 0.186486
+-0.100339 0.504816 0.162884
+
+
+-0.0344808 0.21702 -0.0595358
+-0.203233 0.271238 -0.0592465
+-0.380152 0.469654 0.0590937
+-0.433374 0.542872 0.0810596
+
+
+0.0765779 0.334882 -0.128994
+-0.0304154 0.219991 -0.0559765
+
+
+-0.0362968 0.216554 -0.0650389
+-0.173535 0.254699 -0.0960122
+-0.203233 0.271238 -0.0592465
+
+
+-0.380152 0.469654 0.0590937
+-0.382545 0.551996 0.127109
+
+
+-0.118511 0.4374 -0.379162
+-0.173535 0.254699 -0.0960122
+
+
+-0.0532236 0.536504 -0.410272
+0.0651165 0.449259 -0.341369
+
+
+0.197701 0.427206 -0.425274
+0.19502 0.351606 -0.386337
+0.30374 0.328311 -0.3765
+0.396401 0.276225 -0.162898
+0.637737 0.340202 0.0220607
+0.639673 0.345289 0.0150375
+0.418742 0.40606 -0.376284
+0.385323 0.405852 -0.41799
+0.30374 0.328311 -0.3765
+
+
+0.197701 0.427206 -0.425274
+0.0651165 0.449259 -0.341369
+0.066935 0.363798 -0.300819
+0.19502 0.351606 -0.386337
+
+
+0.197701 0.427206 -0.425274
+0.359983 0.475877 -0.453506
+0.420028 0.771096 -0.191124
+0.291564 0.805466 -0.0970299
+0.0706308 0.540567 -0.254092
+0.0651165 0.449259 -0.341369
+
+
+0.420028 0.771096 -0.191124
+0.639673 0.345289 0.0150375
+
+
+0.291564 0.805466 -0.0970299
+0.315565 0.507672 0.176763
+0.349381 0.462661 0.187958
+0.280918 0.456828 0.159444
+0.315565 0.507672 0.176763
+
+
+0.0765779 0.334882 -0.128994
+0.0787245 0.352985 -0.0932439
+0.280918 0.456828 0.159444
+
+
+0.0765779 0.334882 -0.128994
+0.066935 0.363798 -0.300819
+
+
+0.0765779 0.334882 -0.128994
+0.396401 0.276225 -0.162898
+
+
+0.0706308 0.540567 -0.254092
+0.0787245 0.352985 -0.0932439
+
+
+0.359983 0.475877 -0.453506
+0.388614 0.421467 -0.426086
+0.385323 0.405852 -0.41799
+
+
+0.418742 0.40606 -0.376284
+0.388614 0.421467 -0.426086
+
+
+0.349381 0.462661 0.187958
+0.637737 0.340202 0.0220607
+
+
+-0.129802 -0.672344 0.197854
+0.252689 -0.35198 0.174276
+0.305482 -0.258299 0.191083
+0.370455 -0.316013 0.197378
+0.353786 -0.292821 0.284383
+0.283918 -0.236806 0.213701
+0.284614 -0.238 0.207692
+0.305482 -0.258299 0.191083
+
+
+-0.129802 -0.672344 0.197854
+0.212895 -0.999643 0.213252
+0.164446 -0.494897 0.669549
+0.114383 -0.455877 0.658506
+0.18434 -0.467078 0.65523
+0.176946 -0.485377 0.663988
+0.164446 -0.494897 0.669549
+
+
+-0.129802 -0.672344 0.197854
+-0.211003 -0.480913 0.308085
+-0.0134403 -0.219098 0.33498
+0.284614 -0.238 0.207692
+
+
+0.270973 -0.41672 0.557808
+0.18434 -0.467078 0.65523
+
+
+0.270973 -0.41672 0.557808
+0.254974 -0.490049 0.577826
+0.176946 -0.485377 0.663988
+
+
+0.270973 -0.41672 0.557808
+0.312041 -0.338845 0.433126
+0.353786 -0.292821 0.284383
+
+
+0.252689 -0.35198 0.174276
+0.349628 -0.476107 0.180507
+0.273611 -0.926093 0.20816
+0.254974 -0.490049 0.577826
+
+
+0.273611 -0.926093 0.20816
+0.212895 -0.999643 0.213252
+
+
+-0.211003 -0.480913 0.308085
+-0.0277814 -0.381737 0.590482
+0.114383 -0.455877 0.658506
+
+
+0.349628 -0.476107 0.180507
+0.370455 -0.316013 0.197378
+
+
+0.312041 -0.338845 0.433126
+0.135377 -0.220635 0.310686
+-0.00777141 -0.216899 0.345276
+-0.0134403 -0.219098 0.33498
+
+
+-0.00777141 -0.216899 0.345276
+-0.0277814 -0.381737 0.590482
+
+
+0.135377 -0.220635 0.310686
+0.283918 -0.236806 0.213701
+
+
+0.58031 -0.685192 0.576219
+0.5939 -0.766758 0.682934
+0.674311 -0.701844 0.699592
+0.640199 -0.626344 0.576834
+0.58031 -0.685192 0.576219
+0.461423 -0.567212 0.617401
+0.639022 -0.473047 0.604716
+0.73254 -0.413346 0.680806
+0.499779 -0.499779 1
+0.385073 -0.586179 0.798894
+0.461423 -0.567212 0.617401
+
+
+0.559619 -0.782829 0.776789
+0.670391 -0.670391 1
+0.81232 -0.585286 0.772966
+0.674311 -0.701844 0.699592
+
+
+0.559619 -0.782829 0.776789
+0.385073 -0.586179 0.798894
+
+
+0.559619 -0.782829 0.776789
+0.5939 -0.766758 0.682934
+
+
+0.640199 -0.626344 0.576834
+0.711509 -0.533204 0.581734
+0.639022 -0.473047 0.604716
+
+
+0.499779 -0.499779 1
+0.670391 -0.670391 1
+
+
+0.711509 -0.533204 0.581734
+0.812462 -0.473037 0.660576
+0.73254 -0.413346 0.680806
+
+
+0.81232 -0.585286 0.772966
+0.812462 -0.473037 0.660576
+
+
+0.81232 -0.585286 0.772966
+1 -0.744177 0.744177
+0.822075 -0.846806 0.668881
+0.721019 -0.641778 0.362797
+0.640199 -0.626344 0.576834
+0.674311 -0.701844 0.699592
+0.822075 -0.846806 0.668881
+
+
+0.81232 -0.585286 0.772966
+0.812462 -0.473037 0.660576
+0.711509 -0.533204 0.581734
+0.640199 -0.626344 0.576834
+
+
+0.81232 -0.585286 0.772966
+0.674311 -0.701844 0.699592
+
+
+1 -0.473699 0.473699
+0.812462 -0.473037 0.660576
+
+
+1 -0.473699 0.473699
+1 -0.744177 0.744177
+
+
+1 -0.473699 0.473699
+0.763181 -0.592324 0.355504
+0.711509 -0.533204 0.581734
+
+
+0.721019 -0.641778 0.362797
+0.763181 -0.592324 0.355504
+
+
+0.43511 -0.212094 0.439546
+0.39231 -0.286626 0.446126
+0.3753 -0.282701 0.319819
+0.43511 -0.212094 0.439546
+0.600577 -0.112308 0.511731
+0.660123 -0.328481 0.668358
+0.493464 -0.359315 0.559545
+0.39231 -0.286626 0.446126
+
+
+0.72632 -0.105578 0.379258
+0.558393 -0.265513 0.146958
+0.595376 -0.453087 0.0484626
+1 -0.391026 0.391026
+0.72632 -0.105578 0.379258
+0.600577 -0.112308 0.511731
+
+
+0.558393 -0.265513 0.146958
+0.469499 -0.31812 0.11089
+0.410549 -0.322762 0.168964
+0.553875 -0.447557 0.0479289
+0.469499 -0.31812 0.11089
+
+
+0.812462 -0.473037 0.660576
+1 -0.473699 0.473699
+0.763181 -0.592324 0.355504
+0.575005 -0.465174 0.0401799
+0.595376 -0.453087 0.0484626
+
+
+0.812462 -0.473037 0.660576
+0.73254 -0.413346 0.680806
+0.639022 -0.473047 0.604716
+0.493464 -0.359315 0.559545
+
+
+0.812462 -0.473037 0.660576
+0.711509 -0.533204 0.581734
+0.763181 -0.592324 0.355504
+
+
+0.73254 -0.413346 0.680806
+0.660123 -0.328481 0.668358
+
+
+0.639022 -0.473047 0.604716
+0.711509 -0.533204 0.581734
+
+
+0.575005 -0.465174 0.0401799
+0.553875 -0.447557 0.0479289
+
+
+1 -0.391026 0.391026
+1 -0.473699 0.473699
+
+
+0.3753 -0.282701 0.319819
+0.410549 -0.322762 0.168964
+
+
+0.58031 -0.685192 0.576219
+0.482547 -0.876625 0.359172
+0.496391 -1 0.496391
+0.557024 -0.907478 0.649546
+0.5939 -0.766758 0.682934
+0.58031 -0.685192 0.576219
+0.461423 -0.567212 0.617401
+0.385073 -0.586179 0.798894
+0.18195 -0.493049 0.688901
+0.164446 -0.494897 0.669549
+0.176946 -0.485377 0.663988
+0.18195 -0.493049 0.688901
+
+
+0.482547 -0.876625 0.359172
+0.275667 -0.930084 0.205751
+0.273611 -0.926093 0.20816
+0.212895 -0.999643 0.213252
+0.213051 -1 0.213051
+0.275667 -0.930084 0.205751
+
+
+0.385073 -0.586179 0.798894
+0.559619 -0.782829 0.776789
+0.5939 -0.766758 0.682934
+
+
+0.557024 -0.907478 0.649546
+0.559619 -0.782829 0.776789
+
+
+0.496391 -1 0.496391
+0.213051 -1 0.213051
+
+
+0.461423 -0.567212 0.617401
+0.254974 -0.490049 0.577826
+0.176946 -0.485377 0.663988
+
+
+0.254974 -0.490049 0.577826
+0.273611 -0.926093 0.20816
+
+
+0.212895 -0.999643 0.213252
+0.164446 -0.494897 0.669549
+
+
+0.410549 -0.322762 0.168964
+0.370455 -0.316013 0.197378
+0.349628 -0.476107 0.180507
+0.413249 -0.68404 0.0972886
+0.567143 -0.467884 0.0350277
+0.553875 -0.447557 0.0479289
+0.410549 -0.322762 0.168964
+0.3753 -0.282701 0.319819
+0.39231 -0.286626 0.446126
+0.336017 -0.330072 0.493253
+0.306711 -0.376488 0.549061
+0.270973 -0.41672 0.557808
+0.312041 -0.338845 0.433126
+0.336017 -0.330072 0.493253
+
+
+0.721019 -0.641778 0.362797
+0.482547 -0.876625 0.359172
+0.58031 -0.685192 0.576219
+0.640199 -0.626344 0.576834
+0.721019 -0.641778 0.362797
+0.763181 -0.592324 0.355504
+0.711509 -0.533204 0.581734
+0.639022 -0.473047 0.604716
+0.461423 -0.567212 0.617401
+0.254974 -0.490049 0.577826
+0.273611 -0.926093 0.20816
+0.275667 -0.930084 0.205751
+0.413249 -0.68404 0.0972886
+
+
+0.711509 -0.533204 0.581734
+0.640199 -0.626344 0.576834
+
+
+0.58031 -0.685192 0.576219
+0.461423 -0.567212 0.617401
+
+
+0.482547 -0.876625 0.359172
+0.275667 -0.930084 0.205751
+
+
+0.567143 -0.467884 0.0350277
+0.575005 -0.465174 0.0401799
+0.553875 -0.447557 0.0479289
+
+
+0.639022 -0.473047 0.604716
+0.493464 -0.359315 0.559545
+0.306711 -0.376488 0.549061
+
+
+0.254974 -0.490049 0.577826
+0.270973 -0.41672 0.557808
+
+
+0.3753 -0.282701 0.319819
+0.353786 -0.292821 0.284383
+0.370455 -0.316013 0.197378
+
+
+0.493464 -0.359315 0.559545
+0.39231 -0.286626 0.446126
+
+
+0.353786 -0.292821 0.284383
+0.312041 -0.338845 0.433126
+
+
+0.575005 -0.465174 0.0401799
+0.763181 -0.592324 0.355504
+
+
+0.273611 -0.926093 0.20816
+0.349628 -0.476107 0.180507
+
+
+0.660123 -0.328481 0.668358
+0.380841 -0.310907 0.930065
+0.371799 -0.371799 1
+0.18195 -0.493049 0.688901
+0.176946 -0.485377 0.663988
+0.18434 -0.467078 0.65523
+0.256174 -0.360368 0.679402
+0.380841 -0.310907 0.930065
+
+
+0.660123 -0.328481 0.668358
+0.73254 -0.413346 0.680806
+0.499779 -0.499779 1
+0.371799 -0.371799 1
+
+
+0.660123 -0.328481 0.668358
+0.493464 -0.359315 0.559545
+0.639022 -0.473047 0.604716
+0.73254 -0.413346 0.680806
+
+
+0.254974 -0.490049 0.577826
+0.270973 -0.41672 0.557808
+0.306711 -0.376488 0.549061
+0.256174 -0.360368 0.679402
+
+
+0.254974 -0.490049 0.577826
+0.461423 -0.567212 0.617401
+0.639022 -0.473047 0.604716
+
+
+0.254974 -0.490049 0.577826
+0.176946 -0.485377 0.663988
+
+
+0.385073 -0.586179 0.798894
+0.461423 -0.567212 0.617401
+
+
+0.385073 -0.586179 0.798894
+0.499779 -0.499779 1
+
+
+0.385073 -0.586179 0.798894
+0.18195 -0.493049 0.688901
+
+
+0.306711 -0.376488 0.549061
+0.493464 -0.359315 0.559545
+
+
+0.270973 -0.41672 0.557808
+0.18434 -0.467078 0.65523
+
+
+0.670391 -0.670391 1
+0.559619 -0.782829 0.776789
+0.557024 -0.907478 0.649546
+0.629512 -1 0.629512
+0.822075 -0.846806 0.668881
+0.674311 -0.701844 0.699592
+0.5939 -0.766758 0.682934
+0.557024 -0.907478 0.649546
+
+
+0.670391 -0.670391 1
+0.68035 -0.68035 1
+1 -0.749733 0.749733
+0.830917 -1 0.830917
+0.68035 -0.68035 1
+
+
+0.670391 -0.670391 1
+0.81232 -0.585286 0.772966
+0.674311 -0.701844 0.699592
+
+
+0.81232 -0.585286 0.772966
+1 -0.744177 0.744177
+1 -0.749733 0.749733
+
+
+0.559619 -0.782829 0.776789
+0.5939 -0.766758 0.682934
+
+
+1 -0.744177 0.744177
+0.822075 -0.846806 0.668881
+
+
+0.629512 -1 0.629512
+0.830917 -1 0.830917
+
+
+0.629512 -1 0.629512
+0.557024 -0.907478 0.649546
+0.5939 -0.766758 0.682934
+0.674311 -0.701844 0.699592
+0.822075 -0.846806 0.668881
+0.629512 -1 0.629512
+0.496391 -1 0.496391
+0.482547 -0.876625 0.359172
+0.721019 -0.641778 0.362797
+0.640199 -0.626344 0.576834
+0.58031 -0.685192 0.576219
+0.482547 -0.876625 0.359172
+
+
+0.721019 -0.641778 0.362797
+0.822075 -0.846806 0.668881
+
+
+0.557024 -0.907478 0.649546
+0.496391 -1 0.496391
+
+
+0.640199 -0.626344 0.576834
+0.674311 -0.701844 0.699592
+
+
+0.58031 -0.685192 0.576219
+0.5939 -0.766758 0.682934
+
+
+-0.494139 -0.0823338 0.423527
+-0.488819 -0.073373 0.437808
+-0.477185 -0.0680266 0.428882
+-0.484978 -0.0769964 0.419674
+-0.494139 -0.0823338 0.423527
+-0.98323 -0.0466444 -0.0298743
+-1 -0.037522 -0.037522
+-1 0.103586 0.103586
+-0.708576 0.222542 -0.0688819
+-0.700453 0.226847 -0.0686008
+-0.662014 0.251674 -0.0443584
+-0.47279 0.42567 0.341296
+-0.488595 0.422971 0.369949
+-0.753311 0.323364 0.570054
+-1 0.103586 0.103586
+
+
+-1 -0.037522 -0.037522
+-0.708576 0.222542 -0.0688819
+
+
+-0.753311 0.323364 0.570054
+-0.488819 -0.073373 0.437808
+
+
+-0.484978 -0.0769964 0.419674
+-0.543074 0.0556927 0.101775
+-0.658362 0.057749 0.00796545
+-0.98323 -0.0466444 -0.0298743
+
+
+-0.658362 0.057749 0.00796545
+-0.639667 0.171691 -0.0322115
+-0.662624 0.218896 -0.0563041
+-0.662014 0.251674 -0.0443584
+
+
+-0.639667 0.171691 -0.0322115
+-0.541272 0.0599715 0.101152
+-0.543074 0.0556927 0.101775
+
+
+-0.409633 0.133801 0.353756
+-0.541272 0.0599715 0.101152
+
+
+-0.409633 0.133801 0.353756
+-0.464581 0.419573 0.353492
+-0.488595 0.422971 0.369949
+
+
+-0.409633 0.133801 0.353756
+-0.477185 -0.0680266 0.428882
+
+
+-0.700453 0.226847 -0.0686008
+-0.662624 0.218896 -0.0563041
+
+
+-0.47279 0.42567 0.341296
+-0.464581 0.419573 0.353492
+
+
+-0.5172 0.5172 1
+-0.753397 0.487416 0.734019
+-0.753311 0.323364 0.570054
+-0.488595 0.422971 0.369949
+-0.753397 0.487416 0.734019
+
+
+-0.5172 0.5172 1
+-0.195007 0.195007 1
+-0.0675146 0.224214 0.843301
+-0.0719917 0.193889 0.811643
+-0.165551 0.0574266 0.780748
+-0.211951 0.0358744 0.823924
+-0.195007 0.195007 1
+
+
+-0.5172 0.5172 1
+-0.187716 0.463233 0.724483
+-0.22657 0.421979 0.434642
+-0.3042 0.417241 0.381415
+-0.263793 0.212745 0.381793
+-0.126795 0.172228 0.469272
+-0.14998 0.0723227 0.511391
+-0.121677 0.0831381 0.562589
+-0.0895416 0.132235 0.586727
+-0.0857212 0.208954 0.524154
+-0.0948994 0.217084 0.496807
+-0.126795 0.172228 0.469272
+
+
+-0.0883359 0.32413 0.764206
+-0.187716 0.463233 0.724483
+
+
+-0.0883359 0.32413 0.764206
+-0.065333 0.281487 0.783846
+-0.0857212 0.208954 0.524154
+
+
+-0.0883359 0.32413 0.764206
+-0.131127 0.291634 0.482103
+-0.22657 0.421979 0.434642
+
+
+-0.0948994 0.217084 0.496807
+-0.131127 0.291634 0.482103
+
+
+-0.165551 0.0574266 0.780748
+-0.121677 0.0831381 0.562589
+
+
+-0.488819 -0.073373 0.437808
+-0.211951 0.0358744 0.823924
+
+
+-0.488819 -0.073373 0.437808
+-0.753311 0.323364 0.570054
+
+
+-0.488819 -0.073373 0.437808
+-0.477185 -0.0680266 0.428882
+-0.14998 0.0723227 0.511391
+
+
+-0.0719917 0.193889 0.811643
+-0.0895416 0.132235 0.586727
+
+
+-0.464581 0.419573 0.353492
+-0.409633 0.133801 0.353756
+-0.477185 -0.0680266 0.428882
+
+
+-0.464581 0.419573 0.353492
+-0.488595 0.422971 0.369949
+
+
+-0.464581 0.419573 0.353492
+-0.3042 0.417241 0.381415
+
+
+-0.409633 0.133801 0.353756
+-0.263793 0.212745 0.381793
+
+
+-0.0675146 0.224214 0.843301
+-0.065333 0.281487 0.783846
+
+
+0.44235 0.0012932 0.556357
+0.279752 -0.104198 0.274057
+0.164122 0.0340818 0.404372
+-0.0368794 0.102603 0.555949
+0.135377 -0.220635 0.310686
+0.283918 -0.236806 0.213701
+0.279752 -0.104198 0.274057
+
+
+0.44235 0.0012932 0.556357
+0.400538 0.0296223 0.569839
+0.164122 0.0340818 0.404372
+
+
+0.44235 0.0012932 0.556357
+0.449906 -0.010861 0.560955
+0.43511 -0.212094 0.439546
+0.3753 -0.282701 0.319819
+0.353786 -0.292821 0.284383
+0.283918 -0.236806 0.213701
+
+
+0.135377 -0.220635 0.310686
+0.312041 -0.338845 0.433126
+0.353786 -0.292821 0.284383
+
+
+0.400538 0.0296223 0.569839
+0.0623498 0.139085 0.798566
+0.28019 -0.0488089 0.768618
+0.268099 -0.119697 0.735351
+0.057859 0.139692 0.79778
+0.0623498 0.139085 0.798566
+
+
+0.268099 -0.119697 0.735351
+0.336017 -0.330072 0.493253
+0.39231 -0.286626 0.446126
+0.3753 -0.282701 0.319819
+
+
+0.449906 -0.010861 0.560955
+0.28019 -0.0488089 0.768618
+
+
+0.057859 0.139692 0.79778
+-0.0368794 0.102603 0.555949
+
+
+0.336017 -0.330072 0.493253
+0.312041 -0.338845 0.433126
+
+
+0.39231 -0.286626 0.446126
+0.43511 -0.212094 0.439546
+
+
+-0.0719917 0.193889 0.811643
+-0.165551 0.0574266 0.780748
+-0.121677 0.0831381 0.562589
+-0.0895416 0.132235 0.586727
+-0.0719917 0.193889 0.811643
+0.057859 0.139692 0.79778
+0.268099 -0.119697 0.735351
+0.256174 -0.360368 0.679402
+0.18434 -0.467078 0.65523
+0.114383 -0.455877 0.658506
+-0.105249 -0.166814 0.727937
+-0.165551 0.0574266 0.780748
+
+
+-0.105249 -0.166814 0.727937
+-0.0277814 -0.381737 0.590482
+0.114383 -0.455877 0.658506
+
+
+-0.0368794 0.102603 0.555949
+-0.0895416 0.132235 0.586727
+
+
+-0.0368794 0.102603 0.555949
+0.057859 0.139692 0.79778
+
+
+-0.0368794 0.102603 0.555949
+0.135377 -0.220635 0.310686
+0.312041 -0.338845 0.433126
+0.270973 -0.41672 0.557808
+0.18434 -0.467078 0.65523
+
+
+-0.0277814 -0.381737 0.590482
+-0.00777141 -0.216899 0.345276
+0.135377 -0.220635 0.310686
+
+
+0.306711 -0.376488 0.549061
+0.270973 -0.41672 0.557808
+
+
+0.306711 -0.376488 0.549061
+0.336017 -0.330072 0.493253
+0.312041 -0.338845 0.433126
+
+
+0.306711 -0.376488 0.549061
+0.256174 -0.360368 0.679402
+
+
+0.268099 -0.119697 0.735351
+0.336017 -0.330072 0.493253
+
+
+-0.00777141 -0.216899 0.345276
+-0.121677 0.0831381 0.562589
+
+
+0.057859 0.139692 0.79778
+-0.0719917 0.193889 0.811643
+-0.0895416 0.132235 0.586727
+-0.0857212 0.208954 0.524154
+-0.065333 0.281487 0.783846
+-0.0675146 0.224214 0.843301
+-0.0719917 0.193889 0.811643
+
+
+0.057859 0.139692 0.79778
+-0.0368794 0.102603 0.555949
+0.164122 0.0340818 0.404372
+0.147295 0.259027 0.249351
+0.15824 0.269343 0.250301
+0.144762 0.262201 0.249494
+0.147295 0.259027 0.249351
+
+
+0.057859 0.139692 0.79778
+0.0623498 0.139085 0.798566
+0.400538 0.0296223 0.569839
+0.327628 0.369289 0.303083
+-0.065333 0.281487 0.783846
+
+
+-0.0368794 0.102603 0.555949
+-0.0895416 0.132235 0.586727
+
+
+0.327628 0.369289 0.303083
+0.15824 0.269343 0.250301
+
+
+0.400538 0.0296223 0.569839
+0.164122 0.0340818 0.404372
+
+
+-0.0675146 0.224214 0.843301
+0.0623498 0.139085 0.798566
+
+
+-0.0857212 0.208954 0.524154
+0.144762 0.262201 0.249494
+
+
+-0.121677 0.0831381 0.562589
+-0.14998 0.0723227 0.511391
+-0.157374 -0.148214 0.229739
+-0.158474 -0.148807 0.229306
+-0.173107 -0.179421 0.230987
+-0.232623 -0.473908 0.293469
+-0.211003 -0.480913 0.308085
+-0.0134403 -0.219098 0.33498
+-0.157374 -0.148214 0.229739
+
+
+-0.121677 0.0831381 0.562589
+-0.165551 0.0574266 0.780748
+-0.105249 -0.166814 0.727937
+-0.211951 0.0358744 0.823924
+-0.165551 0.0574266 0.780748
+
+
+-0.121677 0.0831381 0.562589
+-0.00777141 -0.216899 0.345276
+-0.0277814 -0.381737 0.590482
+-0.105249 -0.166814 0.727937
+
+
+-0.00777141 -0.216899 0.345276
+-0.0134403 -0.219098 0.33498
+
+
+-0.14998 0.0723227 0.511391
+-0.477185 -0.0680266 0.428882
+-0.484978 -0.0769964 0.419674
+-0.158474 -0.148807 0.229306
+
+
+-0.438374 -0.189909 0.371717
+-0.232623 -0.473908 0.293469
+
+
+-0.438374 -0.189909 0.371717
+-0.494139 -0.0823338 0.423527
+-0.488819 -0.073373 0.437808
+-0.477185 -0.0680266 0.428882
+
+
+-0.438374 -0.189909 0.371717
+-0.173107 -0.179421 0.230987
+
+
+-0.211003 -0.480913 0.308085
+-0.0277814 -0.381737 0.590482
+
+
+-0.494139 -0.0823338 0.423527
+-0.484978 -0.0769964 0.419674
+
+
+-0.211951 0.0358744 0.823924
+-0.488819 -0.073373 0.437808
+
+
+0.359247 0.388734 0.252019
+0.327628 0.369289 0.303083
+0.15824 0.269343 0.250301
+0.359247 0.388734 0.252019
+0.494912 0.291772 0.213316
+0.44235 0.0012932 0.556357
+0.279752 -0.104198 0.274057
+0.294461 -0.0175002 0.168895
+0.494912 0.291772 0.213316
+
+
+0.294461 -0.0175002 0.168895
+0.147295 0.259027 0.249351
+0.164122 0.0340818 0.404372
+0.279752 -0.104198 0.274057
+
+
+0.147295 0.259027 0.249351
+0.15824 0.269343 0.250301
+
+
+0.164122 0.0340818 0.404372
+0.400538 0.0296223 0.569839
+0.44235 0.0012932 0.556357
+
+
+0.327628 0.369289 0.303083
+0.400538 0.0296223 0.569839
+
+
+0.335705 -0.151927 0.0449519
+0.302943 -0.150428 0.072663
+0.289889 -0.223967 0.166656
+0.284614 -0.238 0.207692
+0.283918 -0.236806 0.213701
+0.353786 -0.292821 0.284383
+0.370455 -0.316013 0.197378
+0.305482 -0.258299 0.191083
+0.284614 -0.238 0.207692
+
+
+0.335705 -0.151927 0.0449519
+0.379587 -0.127665 0.0254859
+0.642213 0.275482 0.0823055
+0.494912 0.291772 0.213316
+0.294461 -0.0175002 0.168895
+0.302943 -0.150428 0.072663
+
+
+0.335705 -0.151927 0.0449519
+0.368008 -0.160975 0.0261003
+0.379587 -0.127665 0.0254859
+
+
+0.3753 -0.282701 0.319819
+0.410549 -0.322762 0.168964
+0.469499 -0.31812 0.11089
+0.368008 -0.160975 0.0261003
+
+
+0.3753 -0.282701 0.319819
+0.43511 -0.212094 0.439546
+0.600577 -0.112308 0.511731
+0.72632 -0.105578 0.379258
+0.733718 0.10093 0.165352
+0.558393 -0.265513 0.146958
+0.72632 -0.105578 0.379258
+
+
+0.3753 -0.282701 0.319819
+0.353786 -0.292821 0.284383
+
+
+0.370455 -0.316013 0.197378
+0.410549 -0.322762 0.168964
+
+
+0.642213 0.275482 0.0823055
+0.733718 0.10093 0.165352
+
+
+0.294461 -0.0175002 0.168895
+0.279752 -0.104198 0.274057
+0.44235 0.0012932 0.556357
+0.449906 -0.010861 0.560955
+0.43511 -0.212094 0.439546
+
+
+0.494912 0.291772 0.213316
+0.44235 0.0012932 0.556357
+
+
+0.449906 -0.010861 0.560955
+0.600577 -0.112308 0.511731
+
+
+0.558393 -0.265513 0.146958
+0.469499 -0.31812 0.11089
+
+
+0.305482 -0.258299 0.191083
+0.289889 -0.223967 0.166656
+
+
+0.283918 -0.236806 0.213701
+0.279752 -0.104198 0.274057
+
+
+0.28019 -0.0488089 0.768618
+0.380841 -0.310907 0.930065
+0.256174 -0.360368 0.679402
+0.268099 -0.119697 0.735351
+0.28019 -0.0488089 0.768618
+0.449906 -0.010861 0.560955
+0.600577 -0.112308 0.511731
+0.43511 -0.212094 0.439546
+0.449906 -0.010861 0.560955
+
+
+0.39231 -0.286626 0.446126
+0.43511 -0.212094 0.439546
+
+
+0.39231 -0.286626 0.446126
+0.493464 -0.359315 0.559545
+0.306711 -0.376488 0.549061
+0.336017 -0.330072 0.493253
+0.268099 -0.119697 0.735351
+
+
+0.39231 -0.286626 0.446126
+0.336017 -0.330072 0.493253
+
+
+0.600577 -0.112308 0.511731
+0.660123 -0.328481 0.668358
+0.493464 -0.359315 0.559545
+
+
+0.660123 -0.328481 0.668358
+0.380841 -0.310907 0.930065
+
+
+0.306711 -0.376488 0.549061
+0.256174 -0.360368 0.679402
+
+
+-1 1 1
+-1 0.802902 0.802902
+-0.753397 0.487416 0.734019
+-0.5172 0.5172 1
+-0.187716 0.463233 0.724483
+-0.22657 0.421979 0.434642
+-0.21631 0.589121 0.202306
+-0.382545 0.551996 0.127109
+-0.3042 0.417241 0.381415
+-0.22657 0.421979 0.434642
+
+
+-1 1 1
+-0.5172 0.5172 1
+
+
+-1 1 1
+-0.183652 1 0.183652
+-0.241153 0.879541 0.120694
+-0.444509 0.632208 0.0767165
+-0.41675 0.559819 0.10796
+-0.47279 0.42567 0.341296
+-0.464581 0.419573 0.353492
+-0.3042 0.417241 0.381415
+
+
+-0.21631 0.589121 0.202306
+-0.194709 0.701574 0.186486
+-0.241153 0.879541 0.120694
+
+
+-0.41675 0.559819 0.10796
+-0.382545 0.551996 0.127109
+
+
+-0.753397 0.487416 0.734019
+-0.488595 0.422971 0.369949
+-0.47279 0.42567 0.341296
+
+
+-0.488595 0.422971 0.369949
+-0.464581 0.419573 0.353492
+
+
+-1 0.802902 0.802902
+-0.444509 0.632208 0.0767165
+
+
+-0.194709 0.701574 0.186486
+-0.146158 0.912438 0.23372
+-0.183652 1 0.183652
+
+
+-0.187716 0.463233 0.724483
+-0.146158 0.912438 0.23372
+
+
+0.327628 0.369289 0.303083
+0.359247 0.388734 0.252019
+0.15824 0.269343 0.250301
+0.327628 0.369289 0.303083
+-0.065333 0.281487 0.783846
+-0.0857212 0.208954 0.524154
+-0.0948994 0.217084 0.496807
+-0.131127 0.291634 0.482103
+-0.0883359 0.32413 0.764206
+-0.065333 0.281487 0.783846
+
+
+-0.131127 0.291634 0.482103
+-0.0185682 0.426404 0.159951
+0.161909 0.615677 0.222414
+-0.0883359 0.32413 0.764206
+
+
+-0.0185682 0.426404 0.159951
+0.0450786 0.351157 0.129839
+0.0510104 0.288209 0.183189
+0.144762 0.262201 0.249494
+0.15824 0.269343 0.250301
+
+
+0.161909 0.615677 0.222414
+0.315565 0.507672 0.176763
+0.280918 0.456828 0.159444
+0.349381 0.462661 0.187958
+0.315565 0.507672 0.176763
+
+
+-0.0948994 0.217084 0.496807
+0.0510104 0.288209 0.183189
+
+
+0.359247 0.388734 0.252019
+0.349381 0.462661 0.187958
+
+
+-0.0857212 0.208954 0.524154
+0.144762 0.262201 0.249494
+
+
+0.0450786 0.351157 0.129839
+0.280918 0.456828 0.159444
+
+
+-0.131127 0.291634 0.482103
+-0.22657 0.421979 0.434642
+-0.187716 0.463233 0.724483
+-0.0883359 0.32413 0.764206
+-0.131127 0.291634 0.482103
+-0.0185682 0.426404 0.159951
+-0.100339 0.504816 0.162884
+-0.21631 0.589121 0.202306
+-0.194709 0.701574 0.186486
+-0.146158 0.912438 0.23372
+-0.187716 0.463233 0.724483
+
+
+-0.146158 0.912438 0.23372
+0.161909 0.615677 0.222414
+-0.0883359 0.32413 0.764206
+
+
+0.161909 0.615677 0.222414
+-0.0185682 0.426404 0.159951
+
+
+-0.21631 0.589121 0.202306
+-0.22657 0.421979 0.434642
+
+
+-0.194709 0.701574 0.186486
+-0.100339 0.504816 0.162884
+
+
+0.830917 -1 0.830917
+1 -0.749733 0.749733
+0.68035 -0.68035 1
+0.830917 -1 0.830917
+1 -1 1
+1 -0.749733 0.749733
+
+
+0.68035 -0.68035 1
+1 -1 1
+
+
+-0.105249 -0.166814 0.727937
+-0.165551 0.0574266 0.780748
+-0.0719917 0.193889 0.811643
+-0.0675146 0.224214 0.843301
+-0.195007 0.195007 1
+-0.211951 0.0358744 0.823924
+-0.165551 0.0574266 0.780748
+
+
+-0.105249 -0.166814 0.727937
+0.114383 -0.455877 0.658506
+0.164446 -0.494897 0.669549
+0.18195 -0.493049 0.688901
+0.371799 -0.371799 1
+0.380841 -0.310907 0.930065
+0.28019 -0.0488089 0.768618
+0.268099 -0.119697 0.735351
+0.256174 -0.360368 0.679402
+0.380841 -0.310907 0.930065
+
+
+-0.105249 -0.166814 0.727937
+-0.211951 0.0358744 0.823924
+
+
+-0.0719917 0.193889 0.811643
+0.057859 0.139692 0.79778
+0.0623498 0.139085 0.798566
+-0.0675146 0.224214 0.843301
+
+
+0.114383 -0.455877 0.658506
+0.18434 -0.467078 0.65523
+0.176946 -0.485377 0.663988
+0.18195 -0.493049 0.688901
+
+
+0.268099 -0.119697 0.735351
+0.057859 0.139692 0.79778
+
+
+0.18434 -0.467078 0.65523
+0.256174 -0.360368 0.679402
+
+
+0.0623498 0.139085 0.798566
+0.28019 -0.0488089 0.768618
+
+
+0.176946 -0.485377 0.663988
+0.164446 -0.494897 0.669549
+
+
+0.371799 -0.371799 1
+-0.195007 0.195007 1
+
+
@@ -0,0 +1,4786 @@
+// id 102
+sphere{<-2.85061,-10.931,-1.82366>,s}
+// id 1344
+sphere{<-3.71626,-10.4228,-2.05336>,s}
+// id 259
+sphere{<-0.963175,-10.8427,-2.29328>,s}
+// id 2275
+sphere{<-1.69922,-11.2686,-1.63446>,s}
+// id 2084
+sphere{<-2.01005,-10.5644,-2.31273>,s}
+// id 1690
+sphere{<-0.636404,-11.4966,-1.59511>,s}
+// id 2232
+sphere{<-0.021617,-10.7208,-1.39082>,s}
+// id 1517
+sphere{<1.05415,-10.6627,-1.38278>,s}
+// id 1921
+sphere{<0.544052,-11.077,-2.14232>,s}
+// id 118
+sphere{<1.62269,-10.9785,-2.14475>,s}
+// id 325
+sphere{<3.77708,-10.534,-2.05308>,s}
+// id 2088
+sphere{<3.27638,-11.159,-1.44289>,s}
+// id 747
+sphere{<2.61482,-10.8191,-2.11178>,s}
+// id 2015
+sphere{<-8.00314,-8.17414,-1.71896>,s}
+// id 614
+sphere{<-5.29519,-10.2592,-1.38735>,s}
+// id 40
+sphere{<-6.8755,-9.12089,-1.74993>,s}
+// id 720
+sphere{<-5.30643,-9.02575,-1.59903>,s}
+// id 2054
+sphere{<-6.0384,-8.82309,-2.42154>,s}
+// id 861
+sphere{<-6.05555,-9.69131,-1.70158>,s}
+// id 1234
+sphere{<-7.15946,-8.30518,-2.2543>,s}
+// id 228
+sphere{<-5.31382,-8.24915,-2.88341>,s}
+// id 198
+sphere{<-6.36694,-7.92939,-2.73468>,s}
+// id 870
+sphere{<-6.29061,-8.26352,-1.60782>,s}
+// id 33
+sphere{<-4.63197,-9.97173,-2.10575>,s}
+// id 352
+sphere{<-3.90172,-9.55457,-2.68264>,s}
+// id 852
+sphere{<-2.9006,-10.0481,-2.5503>,s}
+// id 121
+sphere{<-2.8004,-8.10878,-2.95487>,s}
+// id 174
+sphere{<-4.32101,-8.54421,-2.92662>,s}
+// id 785
+sphere{<-3.04184,-9.07813,-2.90398>,s}
+// id 1274
+sphere{<-3.11986,-9.32521,-1.88894>,s}
+// id 1903
+sphere{<-5.07651,-9.18534,-2.57807>,s}
+// id 1688
+sphere{<-4.33029,-9.00556,-1.92463>,s}
+// id 518
+sphere{<-4.69226,-8.09141,-2.1093>,s}
+// id 168
+sphere{<-3.56454,-8.42642,-2.27139>,s}
+// id 789
+sphere{<-0.440184,-9.50239,-2.95445>,s}
+// id 1392
+sphere{<-0.283516,-8.96119,-2.12296>,s}
+// id 1976
+sphere{<-2.15954,-9.6201,-1.9884>,s}
+// id 1568
+sphere{<-0.828506,-8.57872,-2.93314>,s}
+// id 2099
+sphere{<-0.930075,-8.21006,-1.96115>,s}
+// id 2135
+sphere{<-1.79108,-8.28016,-2.93501>,s}
+// id 2285
+sphere{<-2.39244,-8.65974,-2.18259>,s}
+// id 444
+sphere{<-2.0078,-9.25642,-2.92611>,s}
+// id 1116
+sphere{<-1.35888,-9.6616,-1.38258>,s}
+// id 892
+sphere{<-0.625648,-9.9244,-2.05456>,s}
+// id 625
+sphere{<-1.32804,-9.98925,-2.76463>,s}
+// id 1663
+sphere{<-1.27029,-9.12345,-2.22067>,s}
+// id 2288
+sphere{<-1.69922,-8.71812,-1.40845>,s}
+// id 1030
+sphere{<-1.85267,-7.83072,-1.84382>,s}
+// id 2064
+sphere{<0.0249154,-10.3924,-2.65523>,s}
+// id 1414
+sphere{<1.04008,-10.3204,-2.6427>,s}
+// id 906
+sphere{<0.480128,-9.80822,-1.76929>,s}
+// id 1248
+sphere{<2.43726,-9.57356,-1.98431>,s}
+// id 1473
+sphere{<2.03288,-10.2075,-2.64765>,s}
+// id 1707
+sphere{<1.49174,-9.88918,-1.84606>,s}
+// id 338
+sphere{<0.765198,-8.87308,-2.16441>,s}
+// id 1543
+sphere{<0.0603959,-8.04824,-1.8859>,s}
+// id 600
+sphere{<1.79473,-8.80926,-2.15125>,s}
+// id 1644
+sphere{<1.08966,-7.95038,-1.87847>,s}
+// id 739
+sphere{<2.12194,-7.87103,-1.95726>,s}
+// id 2179
+sphere{<1.18571,-8.29894,-2.88873>,s}
+// id 1332
+sphere{<0.182306,-8.45063,-2.93721>,s}
+// id 1759
+sphere{<0.572964,-9.45868,-2.9599>,s}
+// id 1879
+sphere{<2.18711,-8.25332,-2.91323>,s}
+// id 988
+sphere{<2.5942,-9.22953,-2.91745>,s}
+// id 379
+sphere{<1.5726,-9.35446,-2.9601>,s}
+// id 537
+sphere{<4.80397,-8.85583,-2.79628>,s}
+// id 2262
+sphere{<3.18169,-8.11579,-2.97558>,s}
+// id 1168
+sphere{<4.18395,-8.09336,-2.99587>,s}
+// id 656
+sphere{<4.66587,-7.84107,-2.1507>,s}
+// id 2123
+sphere{<4.57754,-9.09328,-1.8521>,s}
+// id 1419
+sphere{<3.84788,-8.44406,-2.12027>,s}
+// id 126
+sphere{<4.87292,-10.2497,-1.86401>,s}
+// id 515
+sphere{<3.61159,-9.02907,-2.91109>,s}
+// id 713
+sphere{<3.07333,-10.0637,-2.58603>,s}
+// id 976
+sphere{<4.08739,-9.83777,-1.4022>,s}
+// id 2186
+sphere{<4.21299,-9.76121,-2.51595>,s}
+// id 1433
+sphere{<2.7946,-8.58309,-2.18001>,s}
+// id 495
+sphere{<3.43103,-9.3489,-1.97962>,s}
+// id 891
+sphere{<3.05687,-10.181,-1.45742>,s}
+// id 1475
+sphere{<5.39861,-9.51029,-2.28647>,s}
+// id 1607
+sphere{<5.87099,-10.0126,-1.47564>,s}
+// id 1949
+sphere{<5.28009,-7.98164,-2.93615>,s}
+// id 1859
+sphere{<7.26846,-8.99479,-1.55583>,s}
+// id 1139
+sphere{<5.49816,-8.7636,-1.63082>,s}
+// id 42
+sphere{<6.42395,-8.48281,-1.36564>,s}
+// id 716
+sphere{<6.39338,-9.2997,-1.94158>,s}
+// id 277
+sphere{<6.85884,-8.47062,-2.31613>,s}
+// id 1445
+sphere{<5.91224,-8.68054,-2.57338>,s}
+// id 127
+sphere{<7.74165,-8.18457,-1.9238>,s}
+// id 2114
+sphere{<-8.75897,-7.53587,-1.57226>,s}
+// id 424
+sphere{<-8.53796,-6.82752,-2.24305>,s}
+// id 843
+sphere{<-9.36653,-6.43976,-1.84345>,s}
+// id 526
+sphere{<-9.66447,-5.49414,-2.1064>,s}
+// id 1044
+sphere{<-8.8888,-5.62013,-1.46462>,s}
+// id 1083
+sphere{<-8.82142,-5.89692,-2.48198>,s}
+// id 1453
+sphere{<-7.94776,-5.58816,-2.86276>,s}
+// id 213
+sphere{<-8.05521,-6.0393,-1.84563>,s}
+// id 2334
+sphere{<-6.24583,-5.23496,-2.87357>,s}
+// id 473
+sphere{<-6.94221,-5.96008,-2.96477>,s}
+// id 1890
+sphere{<-7.72299,-7.49195,-2.39656>,s}
+// id 140
+sphere{<-7.7158,-6.55168,-2.73446>,s}
+// id 193
+sphere{<-7.79697,-7.0116,-1.5219>,s}
+// id 1043
+sphere{<-6.92882,-7.47692,-1.7286>,s}
+// id 2211
+sphere{<-5.60716,-7.68855,-2.10157>,s}
+// id 200
+sphere{<-6.8191,-6.97744,-2.85825>,s}
+// id 1221
+sphere{<-7.2287,-5.53689,-2.10211>,s}
+// id 1877
+sphere{<-7.05564,-6.51791,-1.981>,s}
+// id 2259
+sphere{<-5.32171,-5.57696,-2.70237>,s}
+// id 80
+sphere{<-6.12067,-6.83639,-2.15579>,s}
+// id 157
+sphere{<-5.65,-6.3031,-1.44464>,s}
+// id 454
+sphere{<-6.27374,-5.84722,-2.08469>,s}
+// id 1974
+sphere{<-5.51197,-5.33356,-1.6939>,s}
+// id 2271
+sphere{<-5.69196,-7.22636,-2.98569>,s}
+// id 2035
+sphere{<-5.98737,-6.27016,-2.98136>,s}
+// id 957
+sphere{<-4.82546,-7.06794,-2.05301>,s}
+// id 566
+sphere{<-3.89039,-7.50207,-1.98913>,s}
+// id 438
+sphere{<-2.83396,-7.74134,-2.01556>,s}
+// id 530
+sphere{<-3.08761,-7.02875,-2.6756>,s}
+// id 2138
+sphere{<-4.82029,-6.06908,-1.98168>,s}
+// id 1732
+sphere{<-4.05783,-6.75354,-2.63257>,s}
+// id 1719
+sphere{<-3.87937,-5.84181,-2.24002>,s}
+// id 2375
+sphere{<-5.00367,-6.50681,-2.88869>,s}
+// id 635
+sphere{<-4.7071,-7.4571,-2.98232>,s}
+// id 1852
+sphere{<-3.74416,-7.72815,-2.96458>,s}
+// id 845
+sphere{<-3.21012,-6.82488,-1.70386>,s}
+// id 1272
+sphere{<-2.997,-5.85471,-1.76857>,s}
+// id 1144
+sphere{<-0.636252,-7.3969,-1.45673>,s}
+// id 594
+sphere{<-0.684467,-6.39519,-1.52015>,s}
+// id 1376
+sphere{<-2.15166,-7.38114,-2.68496>,s}
+// id 415
+sphere{<-1.21473,-7.14504,-2.4176>,s}
+// id 552
+sphere{<-2.36311,-6.54482,-2.18242>,s}
+// id 1131
+sphere{<-0.0715678,-6.93642,-2.1425>,s}
+// id 1780
+sphere{<-0.426322,-7.69463,-2.693>,s}
+// id 1677
+sphere{<-1.56851,-6.86015,-1.52954>,s}
+// id 767
+sphere{<-2.0622,-6.00085,-1.40034>,s}
+// id 122
+sphere{<0.308569,-6.37321,-1.41076>,s}
+// id 1900
+sphere{<1.54832,-7.16542,-1.39346>,s}
+// id 2083
+sphere{<2.5518,-5.95163,-1.61995>,s}
+// id 2301
+sphere{<0.561348,-7.55143,-2.63067>,s}
+// id 979
+sphere{<0.920896,-6.79365,-2.08271>,s}
+// id 1238
+sphere{<1.93598,-6.61101,-2.13375>,s}
+// id 1035
+sphere{<1.55159,-7.39476,-2.62794>,s}
+// id 1409
+sphere{<2.57454,-7.08589,-1.52768>,s}
+// id 893
+sphere{<2.55968,-7.34227,-2.73573>,s}
+// id 1441
+sphere{<3.5081,-5.52574,-1.7246>,s}
+// id 221
+sphere{<3.20641,-7.66491,-2.03845>,s}
+// id 536
+sphere{<2.96051,-6.50932,-2.35366>,s}
+// id 2314
+sphere{<4.42218,-5.44414,-2.22734>,s}
+// id 952
+sphere{<3.38356,-6.48005,-1.45101>,s}
+// id 2240
+sphere{<4.03426,-7.09132,-1.92147>,s}
+// id 1012
+sphere{<5.01687,-6.88738,-1.98735>,s}
+// id 1296
+sphere{<3.92993,-6.28293,-2.51717>,s}
+// id 490
+sphere{<4.94232,-6.17289,-2.70946>,s}
+// id 2387
+sphere{<4.35105,-6.19951,-1.57399>,s}
+// id 1153
+sphere{<3.58351,-7.18861,-2.83823>,s}
+// id 2010
+sphere{<4.5922,-7.14639,-2.87637>,s}
+// id 708
+sphere{<5.35279,-5.2024,-2.55541>,s}
+// id 790
+sphere{<5.33656,-5.86606,-1.79456>,s}
+// id 1452
+sphere{<7.40116,-5.97044,-1.38908>,s}
+// id 1821
+sphere{<7.56225,-7.27689,-1.46513>,s}
+// id 1006
+sphere{<6.27922,-7.76541,-2.83294>,s}
+// id 2148
+sphere{<6.61955,-7.61852,-1.83429>,s}
+// id 1226
+sphere{<5.64736,-7.67789,-2.05742>,s}
+// id 148
+sphere{<7.23569,-7.55568,-2.61948>,s}
+// id 1256
+sphere{<6.61619,-6.82778,-2.93194>,s}
+// id 606
+sphere{<6.98844,-6.65416,-1.99737>,s}
+// id 323
+sphere{<5.95829,-5.99768,-2.8374>,s}
+// id 1687
+sphere{<6.95506,-5.88674,-2.93442>,s}
+// id 1581
+sphere{<5.99258,-6.69073,-2.09647>,s}
+// id 1855
+sphere{<5.60223,-7.02628,-2.96051>,s}
+// id 908
+sphere{<7.60129,-6.64312,-2.79202>,s}
+// id 1559
+sphere{<6.44917,-5.8075,-1.98015>,s}
+// id 1054
+sphere{<7.32125,-5.34492,-2.16874>,s}
+// id 1605
+sphere{<8.6018,-7.69126,-1.47364>,s}
+// id 857
+sphere{<8.84573,-5.96566,-1.41307>,s}
+// id 1782
+sphere{<8.11763,-6.3598,-1.97806>,s}
+// id 542
+sphere{<8.14604,-7.3127,-2.28001>,s}
+// id 2249
+sphere{<9.00757,-6.85645,-1.89361>,s}
+// id 2039
+sphere{<8.84809,-5.92293,-2.50305>,s}
+// id 50
+sphere{<8.29487,-5.23008,-1.96735>,s}
+// id 2250
+sphere{<7.94658,-5.70751,-2.87856>,s}
+// id 1638
+sphere{<9.67685,-5.65987,-2.00899>,s}
+// id 1264
+sphere{<-10.6342,-4.32061,-1.6541>,s}
+// id 194
+sphere{<-10.5857,-3.39642,-2.09982>,s}
+// id 1737
+sphere{<-8.03922,-3.20442,-2.96114>,s}
+// id 1918
+sphere{<-9.05552,-4.94077,-2.67665>,s}
+// id 1397
+sphere{<-8.95934,-4.36793,-1.8622>,s}
+// id 1094
+sphere{<-8.92783,-3.96507,-2.87242>,s}
+// id 321
+sphere{<-8.99077,-2.88363,-2.95457>,s}
+// id 1833
+sphere{<-8.15254,-4.61255,-2.95571>,s}
+// id 1143
+sphere{<-8.15109,-3.9036,-2.2468>,s}
+// id 584
+sphere{<-8.27778,-5.07971,-2.0589>,s}
+// id 1740
+sphere{<-8.10342,-3.22408,-1.51345>,s}
+// id 994
+sphere{<-9.70369,-4.81902,-1.36875>,s}
+// id 62
+sphere{<-9.76248,-3.82493,-1.61658>,s}
+// id 67
+sphere{<-9.82217,-2.82339,-1.76075>,s}
+// id 1074
+sphere{<-9.89619,-4.53928,-2.31295>,s}
+// id 1318
+sphere{<-9.76143,-3.4534,-2.66337>,s}
+// id 85
+sphere{<-8.97041,-3.3524,-2.0559>,s}
+// id 2171
+sphere{<-6.43164,-4.2117,-2.66456>,s}
+// id 1516
+sphere{<-7.19738,-4.93042,-2.93069>,s}
+// id 1491
+sphere{<-7.22698,-3.5733,-1.93818>,s}
+// id 369
+sphere{<-5.74027,-3.72186,-2.07884>,s}
+// id 183
+sphere{<-6.43273,-3.69478,-1.33969>,s}
+// id 8
+sphere{<-7.03108,-2.74841,-1.40659>,s}
+// id 101
+sphere{<-6.30851,-2.89862,-2.0813>,s}
+// id 2009
+sphere{<-7.41531,-4.55941,-2.02777>,s}
+// id 248
+sphere{<-7.37378,-3.94368,-2.87063>,s}
+// id 90
+sphere{<-7.1077,-2.90485,-2.68238>,s}
+// id 1205
+sphere{<-6.4756,-4.87961,-1.91848>,s}
+// id 2338
+sphere{<-5.5632,-4.64653,-2.42691>,s}
+// id 1866
+sphere{<-4.96781,-4.25143,-1.72006>,s}
+// id 469
+sphere{<-4.64413,-5.10015,-2.13958>,s}
+// id 1454
+sphere{<-3.85395,-5.13835,-1.53188>,s}
+// id 772
+sphere{<4.98259,-4.95921,-1.55454>,s}
+// id 1085
+sphere{<6.11545,-2.83735,-1.88015>,s}
+// id 1598
+sphere{<5.3669,-4.14506,-1.989>,s}
+// id 1797
+sphere{<7.36058,-3.47626,-1.84967>,s}
+// id 672
+sphere{<7.08667,-3.80353,-2.80521>,s}
+// id 2097
+sphere{<5.96036,-4.92926,-1.80671>,s}
+// id 1017
+sphere{<6.19586,-3.7195,-2.35613>,s}
+// id 2004
+sphere{<6.88108,-2.85309,-2.52623>,s}
+// id 1053
+sphere{<6.34752,-5.07663,-2.7825>,s}
+// id 2376
+sphere{<6.80969,-4.48099,-2.12047>,s}
+// id 621
+sphere{<7.29817,-4.76792,-2.98582>,s}
+// id 1613
+sphere{<9.03911,-4.01236,-2.78959>,s}
+// id 1001
+sphere{<9.21677,-4.97953,-2.5817>,s}
+// id 523
+sphere{<8.29726,-4.76388,-2.90927>,s}
+// id 1353
+sphere{<7.80849,-4.3611,-2.12095>,s}
+// id 1239
+sphere{<8.07862,-3.77493,-2.93963>,s}
+// id 1082
+sphere{<8.54674,-3.38319,-2.06527>,s}
+// id 1801
+sphere{<8.34917,-2.78964,-2.94409>,s}
+// id 636
+sphere{<9.06283,-4.3908,-1.76882>,s}
+// id 602
+sphere{<10.3294,-5.01628,-1.60797>,s}
+// id 1186
+sphere{<9.11795,-2.92273,-1.38292>,s}
+// id 2362
+sphere{<9.55112,-3.49443,-2.08184>,s}
+// id 1513
+sphere{<9.97135,-4.38105,-2.29658>,s}
+// id 91
+sphere{<9.34605,-2.86273,-2.84074>,s}
+// id 1606
+sphere{<10.2542,-2.85782,-2.41684>,s}
+// id 314
+sphere{<11.0176,-2.75661,-1.74658>,s}
+// id 1471
+sphere{<10.6174,-3.7126,-1.92408>,s}
+// id 642
+sphere{<-11.3679,-2.30749,-1.45875>,s}
+// id 283
+sphere{<-10.4677,-1.75459,-1.49044>,s}
+// id 1095
+sphere{<-11.3293,-0.257248,-1.82551>,s}
+// id 1521
+sphere{<-11.0867,-1.21553,-2.0628>,s}
+// id 1809
+sphere{<-10.7213,-2.40858,-2.21496>,s}
+// id 311
+sphere{<-10.5761,-0.329932,-2.53558>,s}
+// id 350
+sphere{<-8.56934,-0.246661,-2.9531>,s}
+// id 2253
+sphere{<-9.45695,-0.102058,-1.99552>,s}
+// id 1444
+sphere{<-8.15495,-1.16146,-2.87868>,s}
+// id 2293
+sphere{<-9.22582,-1.64299,-2.95287>,s}
+// id 680
+sphere{<-8.75582,-2.37621,-2.12209>,s}
+// id 806
+sphere{<-9.73566,-0.764019,-2.88106>,s}
+// id 1022
+sphere{<-8.93321,-0.918489,-2.29896>,s}
+// id 1696
+sphere{<-8.19042,-2.17319,-2.93158>,s}
+// id 1851
+sphere{<-8.36154,-1.51903,-1.71521>,s}
+// id 2390
+sphere{<-9.59256,-1.85181,-1.96433>,s}
+// id 1825
+sphere{<-9.22527,-1.13371,-1.36392>,s}
+// id 963
+sphere{<-10.0614,-0.917859,-1.87942>,s}
+// id 2078
+sphere{<-9.86593,-2.44917,-2.73254>,s}
+// id 1878
+sphere{<-10.3111,-1.55969,-2.60482>,s}
+// id 1990
+sphere{<-5.85545,-2.37363,-1.34279>,s}
+// id 2155
+sphere{<-7.75466,-2.46219,-2.05811>,s}
+// id 1577
+sphere{<-7.37055,-1.68181,-1.55763>,s}
+// id 7
+sphere{<-6.52471,-1.92319,-2.03612>,s}
+// id 830
+sphere{<-7.33533,-1.68588,-2.57764>,s}
+// id 805
+sphere{<-7.72238,-0.746859,-1.74673>,s}
+// id 1632
+sphere{<-6.77719,-0.947351,-2.05825>,s}
+// id 2029
+sphere{<-7.61889,-0.334409,-2.65174>,s}
+// id 2011
+sphere{<-6.30736,-0.311643,-1.33821>,s}
+// id 939
+sphere{<7.07729,-2.34804,-1.4342>,s}
+// id 1594
+sphere{<6.97785,-1.85618,-2.40166>,s}
+// id 2370
+sphere{<6.22364,-1.86786,-1.64955>,s}
+// id 1781
+sphere{<6.65372,-1.02054,-1.95985>,s}
+// id 846
+sphere{<7.5628,-1.14468,-1.46142>,s}
+// id 1994
+sphere{<7.08847,-0.264027,-1.46855>,s}
+// id 677
+sphere{<7.4304,-0.988195,-2.59182>,s}
+// id 1597
+sphere{<7.78099,-2.58741,-2.11918>,s}
+// id 529
+sphere{<7.87694,-1.86968,-2.83978>,s}
+// id 709
+sphere{<7.9441,-0.365472,-1.99267>,s}
+// id 1236
+sphere{<8.12435,-2.00401,-1.36964>,s}
+// id 2063
+sphere{<9.78889,-2.27813,-1.74819>,s}
+// id 725
+sphere{<8.8924,-0.736248,-1.42788>,s}
+// id 849
+sphere{<10.1676,-1.35016,-1.60197>,s}
+// id 241
+sphere{<9.81215,-1.98375,-2.73524>,s}
+// id 1040
+sphere{<8.86315,-1.72953,-2.95438>,s}
+// id 138
+sphere{<8.74268,-2.31235,-2.11417>,s}
+// id 620
+sphere{<8.43708,-0.785076,-2.92454>,s}
+// id 569
+sphere{<8.34252,-1.30213,-2.07168>,s}
+// id 1007
+sphere{<8.87447,-0.141749,-2.27774>,s}
+// id 2310
+sphere{<9.81739,-0.393655,-2.02511>,s}
+// id 2169
+sphere{<9.34131,-1.28846,-2.16349>,s}
+// id 2159
+sphere{<9.45502,-0.586652,-2.95905>,s}
+// id 2071
+sphere{<10.2649,-1.07963,-2.62179>,s}
+// id 1232
+sphere{<11.4088,-1.86928,-1.48279>,s}
+// id 2003
+sphere{<11.428,-0.0673064,-1.65865>,s}
+// id 2130
+sphere{<10.6873,-1.94531,-2.25273>,s}
+// id 1884
+sphere{<10.7255,-0.167962,-2.41428>,s}
+// id 497
+sphere{<11.0931,-1.04209,-1.9708>,s}
+// id 2139
+sphere{<-10.4613,1.85231,-2.50841>,s}
+// id 428
+sphere{<-11.2073,1.87606,-1.84016>,s}
+// id 2238
+sphere{<-11.093,0.912114,-2.09576>,s}
+// id 1554
+sphere{<-10.409,0.241673,-1.71689>,s}
+// id 324
+sphere{<-9.47055,1.22005,-2.92947>,s}
+// id 543
+sphere{<-9.45614,0.217254,-2.9476>,s}
+// id 413
+sphere{<-10.312,0.654565,-2.66947>,s}
+// id 235
+sphere{<-7.85788,2.42978,-2.85561>,s}
+// id 748
+sphere{<-9.94088,1.22322,-1.92119>,s}
+// id 1608
+sphere{<-8.28734,0.167282,-2.08391>,s}
+// id 754
+sphere{<-9.48444,2.01877,-2.32697>,s}
+// id 1942
+sphere{<-8.57996,0.762359,-2.94368>,s}
+// id 1306
+sphere{<-8.63141,1.77655,-2.96508>,s}
+// id 783
+sphere{<-9.00891,0.879659,-2.04599>,s}
+// id 1842
+sphere{<-8.15992,1.4085,-2.15044>,s}
+// id 1050
+sphere{<-10.1606,2.14882,-1.60123>,s}
+// id 2318
+sphere{<-9.10429,1.95736,-1.39634>,s}
+// id 156
+sphere{<-8.54857,2.3479,-2.13419>,s}
+// id 521
+sphere{<-6.87814,0.0628851,-2.07846>,s}
+// id 2119
+sphere{<-7.62501,0.677695,-2.64128>,s}
+// id 48
+sphere{<-7.26819,1.65527,-2.54457>,s}
+// id 1268
+sphere{<-6.4533,2.02251,-1.93089>,s}
+// id 356
+sphere{<-6.68825,1.04666,-1.98847>,s}
+// id 1016
+sphere{<-7.58422,0.751704,-1.64572>,s}
+// id 1129
+sphere{<-7.60363,2.25425,-1.81797>,s}
+// id 1350
+sphere{<7.64739,2.01663,-2.79312>,s}
+// id 317
+sphere{<7.57721,0.680453,-1.62997>,s}
+// id 2374
+sphere{<6.51982,0.524901,-1.7174>,s}
+// id 1748
+sphere{<7.58507,1.00938,-2.68124>,s}
+// id 1751
+sphere{<6.88154,1.6017,-2.28962>,s}
+// id 1088
+sphere{<7.16859,0.152737,-2.38061>,s}
+// id 2198
+sphere{<6.2454,1.46855,-1.52354>,s}
+// id 746
+sphere{<6.28271,2.37451,-1.94492>,s}
+// id 2223
+sphere{<7.0768,2.04232,-1.41397>,s}
+// id 1555
+sphere{<8.06852,0.142029,-2.85402>,s}
+// id 1956
+sphere{<8.41817,0.79587,-2.17475>,s}
+// id 2181
+sphere{<10.2237,1.91256,-2.59536>,s}
+// id 743
+sphere{<8.57567,2.36296,-2.64665>,s}
+// id 1862
+sphere{<9.36602,1.36957,-2.54128>,s}
+// id 1664
+sphere{<7.86434,1.61554,-1.90048>,s}
+// id 1467
+sphere{<8.45199,1.42045,-2.95721>,s}
+// id 1584
+sphere{<8.99637,1.34397,-1.56994>,s}
+// id 586
+sphere{<10.2784,2.31928,-1.42263>,s}
+// id 1210
+sphere{<9.41725,2.1725,-1.93883>,s}
+// id 1282
+sphere{<9.92509,0.308588,-2.81784>,s}
+// id 1330
+sphere{<8.72774,0.266442,-1.37307>,s}
+// id 2089
+sphere{<10.0527,1.39001,-1.75596>,s}
+// id 99
+sphere{<9.4978,0.567874,-1.95061>,s}
+// id 1689
+sphere{<8.96671,0.563702,-2.98983>,s}
+// id 803
+sphere{<8.53577,2.24083,-1.45858>,s}
+// id 1474
+sphere{<11.3609,0.988687,-1.70793>,s}
+// id 2239
+sphere{<10.491,0.48524,-1.53449>,s}
+// id 1526
+sphere{<10.6307,0.921505,-2.42481>,s}
+// id 1411
+sphere{<11.013,1.90053,-1.96663>,s}
+// id 404
+sphere{<-10.8509,3.83126,-1.37958>,s}
+// id 210
+sphere{<-10.7879,2.83014,-2.01427>,s}
+// id 24
+sphere{<-10.2356,3.65974,-2.14944>,s}
+// id 359
+sphere{<-10.0083,2.81077,-2.64085>,s}
+// id 84
+sphere{<-9.56801,4.41148,-2.00707>,s}
+// id 839
+sphere{<-8.78758,4.4096,-2.64427>,s}
+// id 1295
+sphere{<-7.95234,4.24168,-2.1066>,s}
+// id 2134
+sphere{<-8.4039,3.48397,-2.85994>,s}
+// id 661
+sphere{<-8.58664,4.93087,-1.73047>,s}
+// id 1019
+sphere{<-9.3875,3.59695,-2.67796>,s}
+// id 1571
+sphere{<-9.03381,2.69918,-2.95007>,s}
+// id 598
+sphere{<-9.35249,2.90331,-1.76804>,s}
+// id 401
+sphere{<-8.8053,3.77099,-1.86487>,s}
+// id 245
+sphere{<-8.00435,3.17414,-1.98912>,s}
+// id 1591
+sphere{<-7.15541,3.68986,-1.86028>,s}
+// id 718
+sphere{<-5.93803,4.63084,-2.5366>,s}
+// id 888
+sphere{<-6.02776,3.01261,-1.91678>,s}
+// id 653
+sphere{<-6.37325,4.03184,-1.33812>,s}
+// id 1659
+sphere{<-5.57014,3.92308,-1.93238>,s}
+// id 889
+sphere{<-6.88208,2.82813,-1.43322>,s}
+// id 2377
+sphere{<-7.39956,3.52741,-2.83196>,s}
+// id 1853
+sphere{<-6.94228,2.69462,-2.5003>,s}
+// id 1389
+sphere{<-6.41699,3.72851,-2.53452>,s}
+// id 901
+sphere{<-7.49018,4.57325,-2.93024>,s}
+// id 1736
+sphere{<-6.83091,4.63447,-2.07373>,s}
+// id 534
+sphere{<-5.75596,4.81784,-1.39244>,s}
+// id 765
+sphere{<-4.98385,4.73823,-2.02722>,s}
+// id 2389
+sphere{<4.91652,4.83324,-2.06254>,s}
+// id 826
+sphere{<5.67714,3.02005,-1.48149>,s}
+// id 2026
+sphere{<6.94539,3.06282,-1.62836>,s}
+// id 1936
+sphere{<7.76767,2.61933,-1.98446>,s}
+// id 1207
+sphere{<5.54448,4.05405,-2.09873>,s}
+// id 1233
+sphere{<6.21789,3.32991,-2.26552>,s}
+// id 212
+sphere{<6.25616,4.14812,-1.39305>,s}
+// id 1472
+sphere{<7.1987,4.03245,-1.71558>,s}
+// id 30
+sphere{<5.89743,4.96568,-1.8759>,s}
+// id 1660
+sphere{<6.96818,2.72757,-2.58006>,s}
+// id 949
+sphere{<7.28984,4.6599,-2.97568>,s}
+// id 2205
+sphere{<6.47907,4.29737,-2.35764>,s}
+// id 1757
+sphere{<7.13553,3.68832,-2.80225>,s}
+// id 1930
+sphere{<6.41541,5.14064,-2.89163>,s}
+// id 1305
+sphere{<9.81925,4.67257,-2.33883>,s}
+// id 2191
+sphere{<9.75129,3.58391,-2.65616>,s}
+// id 432
+sphere{<8.81628,3.31457,-2.94511>,s}
+// id 1181
+sphere{<9.53894,2.61213,-2.8287>,s}
+// id 1193
+sphere{<9.82526,3.21278,-1.57068>,s}
+// id 732
+sphere{<10.393,2.87611,-2.34965>,s}
+// id 1537
+sphere{<8.89905,3.03854,-1.98341>,s}
+// id 2287
+sphere{<7.90605,4.57179,-2.19048>,s}
+// id 1963
+sphere{<8.05305,3.59179,-2.02743>,s}
+// id 1435
+sphere{<8.44137,4.31535,-1.38565>,s}
+// id 234
+sphere{<9.23967,3.98072,-1.88729>,s}
+// id 110
+sphere{<9.08375,5.07519,-1.48416>,s}
+// id 1254
+sphere{<7.8635,3.01226,-2.92474>,s}
+// id 2060
+sphere{<8.07099,3.99364,-2.98997>,s}
+// id 548
+sphere{<9.02006,4.29496,-2.81309>,s}
+// id 394
+sphere{<11.1157,2.87035,-1.6381>,s}
+// id 895
+sphere{<10.4961,3.85421,-2.02631>,s}
+// id 2360
+sphere{<10.4054,4.9892,-1.58788>,s}
+// id 1108
+sphere{<-9.85659,5.49942,-1.60064>,s}
+// id 788
+sphere{<-9.06353,5.69773,-2.17679>,s}
+// id 565
+sphere{<-8.27839,5.27175,-2.67038>,s}
+// id 907
+sphere{<-8.30424,5.84989,-1.45108>,s}
+// id 632
+sphere{<-8.91493,6.58981,-1.73542>,s}
+// id 503
+sphere{<-7.90509,6.80548,-1.53171>,s}
+// id 316
+sphere{<-8.66669,7.51031,-1.4248>,s}
+// id 1079
+sphere{<-8.23349,6.2301,-2.37483>,s}
+// id 1384
+sphere{<-7.88283,7.70149,-2.01706>,s}
+// id 535
+sphere{<-6.7117,5.2099,-2.88774>,s}
+// id 2255
+sphere{<-5.29841,5.79049,-1.62689>,s}
+// id 336
+sphere{<-6.37303,6.4368,-1.50172>,s}
+// id 402
+sphere{<-7.0259,7.19356,-1.87469>,s}
+// id 2329
+sphere{<-5.21479,6.7529,-1.35242>,s}
+// id 1448
+sphere{<-6.5605,6.19722,-2.98741>,s}
+// id 2369
+sphere{<-7.18539,6.21249,-2.04052>,s}
+// id 2047
+sphere{<-6.2246,5.4526,-2.02605>,s}
+// id 1981
+sphere{<-7.49465,5.8375,-2.95054>,s}
+// id 964
+sphere{<-7.58818,5.30094,-1.94671>,s}
+// id 760
+sphere{<-5.40208,5.47112,-2.67942>,s}
+// id 2161
+sphere{<-7.6268,6.97897,-2.66101>,s}
+// id 332
+sphere{<-6.66779,7.18561,-2.87266>,s}
+// id 1067
+sphere{<-5.63803,7.07702,-2.975>,s}
+// id 1072
+sphere{<-5.80449,6.31586,-2.32139>,s}
+// id 1758
+sphere{<-6.02819,7.26745,-2.0681>,s}
+// id 1511
+sphere{<-3.1639,7.58716,-2.88175>,s}
+// id 468
+sphere{<-3.50547,5.8301,-1.91582>,s}
+// id 1666
+sphere{<-3.33578,6.64752,-2.51453>,s}
+// id 119
+sphere{<-3.31623,6.6649,-1.34459>,s}
+// id 1588
+sphere{<-4.33137,7.23798,-1.35281>,s}
+// id 1416
+sphere{<-4.49001,5.57774,-2.2764>,s}
+// id 96
+sphere{<-4.91754,6.35062,-2.78413>,s}
+// id 840
+sphere{<-4.96729,7.18327,-2.22048>,s}
+// id 155
+sphere{<-4.23131,6.51314,-2.03426>,s}
+// id 318
+sphere{<-3.52428,7.4581,-1.94298>,s}
+// id 741
+sphere{<-4.21228,7.07057,-2.87781>,s}
+// id 1380
+sphere{<-0.853834,7.27251,-2.44582>,s}
+// id 1229
+sphere{<-2.58887,6.27121,-1.93232>,s}
+// id 132
+sphere{<-0.0420629,6.84944,-2.04314>,s}
+// id 2235
+sphere{<-0.715952,6.40351,-1.38121>,s}
+// id 1635
+sphere{<-0.722505,7.43928,-1.36183>,s}
+// id 271
+sphere{<-1.53134,6.65549,-1.99541>,s}
+// id 951
+sphere{<-2.43648,7.14837,-1.46679>,s}
+// id 2103
+sphere{<-2.33962,7.0797,-2.5112>,s}
+// id 2160
+sphere{<-1.63146,7.63943,-1.82623>,s}
+// id 1724
+sphere{<0.2894,7.59681,-2.6286>,s}
+// id 340
+sphere{<1.28938,7.61125,-2.6813>,s}
+// id 925
+sphere{<0.774203,6.47714,-1.60461>,s}
+// id 936
+sphere{<1.54237,6.80004,-2.1579>,s}
+// id 1335
+sphere{<1.82331,6.14955,-1.4541>,s}
+// id 1840
+sphere{<2.14693,7.12489,-1.42428>,s}
+// id 808
+sphere{<2.53619,6.41344,-2.11833>,s}
+// id 1609
+sphere{<0.926586,7.45921,-1.72185>,s}
+// id 65
+sphere{<2.30745,7.24062,-2.63436>,s}
+// id 388
+sphere{<3.32205,7.00706,-2.71369>,s}
+// id 1464
+sphere{<2.95594,7.52764,-1.91629>,s}
+// id 1624
+sphere{<4.00126,7.70414,-2.97622>,s}
+// id 1291
+sphere{<5.19676,7.35589,-2.96961>,s}
+// id 1038
+sphere{<3.97179,7.17692,-1.93229>,s}
+// id 2312
+sphere{<3.23871,6.68514,-1.45608>,s}
+// id 417
+sphere{<3.08857,5.71169,-1.62907>,s}
+// id 1003
+sphere{<4.03596,5.31997,-1.89256>,s}
+// id 1086
+sphere{<4.3369,6.28876,-1.62606>,s}
+// id 1501
+sphere{<4.98508,6.88828,-2.10473>,s}
+// id 307
+sphere{<4.6131,5.86787,-2.49943>,s}
+// id 1693
+sphere{<3.65298,6.13632,-2.34155>,s}
+// id 770
+sphere{<4.29183,6.75648,-2.82408>,s}
+// id 1621
+sphere{<5.4604,6.02491,-1.90689>,s}
+// id 917
+sphere{<7.15646,5.23043,-2.09525>,s}
+// id 1283
+sphere{<7.42783,6.22554,-1.9919>,s}
+// id 701
+sphere{<6.47929,5.8855,-1.75909>,s}
+// id 1349
+sphere{<5.82673,7.42813,-2.08192>,s}
+// id 2187
+sphere{<6.95115,7.68319,-1.63763>,s}
+// id 1926
+sphere{<6.63351,6.83549,-2.06442>,s}
+// id 256
+sphere{<5.47086,5.38747,-2.6856>,s}
+// id 2321
+sphere{<6.38326,6.1349,-2.72979>,s}
+// id 1820
+sphere{<7.24632,5.69229,-2.98108>,s}
+// id 2012
+sphere{<6.16205,7.08201,-2.96482>,s}
+// id 2045
+sphere{<5.42809,6.37841,-2.90228>,s}
+// id 68
+sphere{<7.11747,7.65345,-2.62369>,s}
+// id 1578
+sphere{<7.20918,6.68701,-2.869>,s}
+// id 1899
+sphere{<8.80486,7.14361,-1.87951>,s}
+// id 15
+sphere{<9.5397,6.54745,-1.53803>,s}
+// id 1279
+sphere{<9.73423,5.65745,-1.97179>,s}
+// id 14
+sphere{<8.21484,5.54273,-1.92793>,s}
+// id 1308
+sphere{<8.9771,6.22466,-2.29865>,s}
+// id 1204
+sphere{<7.89149,7.09919,-1.45114>,s}
+// id 475
+sphere{<8.52743,6.32548,-1.375>,s}
+// id 453
+sphere{<8.12054,5.21122,-2.92848>,s}
+// id 327
+sphere{<8.08316,6.21479,-2.75006>,s}
+// id 1322
+sphere{<9.06518,5.27231,-2.60521>,s}
+// id 1065
+sphere{<7.98091,7.17622,-2.44409>,s}
+// id 1285
+sphere{<-6.4383,8.08629,-1.66482>,s}
+// id 2028
+sphere{<-7.19943,8.75459,-1.8007>,s}
+// id 289
+sphere{<-5.75123,8.82837,-1.47162>,s}
+// id 349
+sphere{<-6.48385,9.50762,-1.59216>,s}
+// id 1906
+sphere{<-6.32694,8.83594,-2.31667>,s}
+// id 184
+sphere{<-7.04121,8.01667,-2.45909>,s}
+// id 1505
+sphere{<-5.38518,8.82753,-2.67311>,s}
+// id 498
+sphere{<-6.05222,7.98563,-2.7806>,s}
+// id 39
+sphere{<-5.40705,8.05674,-2.00896>,s}
+// id 298
+sphere{<-5.58906,9.64971,-2.0388>,s}
+// id 519
+sphere{<-3.21245,9.99317,-1.46918>,s}
+// id 1412
+sphere{<-2.87462,9.16151,-1.93401>,s}
+// id 264
+sphere{<-3.39961,8.77399,-2.70215>,s}
+// id 482
+sphere{<-3.39258,9.89823,-2.61417>,s}
+// id 1982
+sphere{<-2.65673,7.93439,-2.0872>,s}
+// id 381
+sphere{<-4.76327,8.8947,-1.89301>,s}
+// id 1187
+sphere{<-3.53407,8.43548,-1.70558>,s}
+// id 937
+sphere{<-3.85965,9.36623,-1.90775>,s}
+// id 496
+sphere{<-5.04239,7.92107,-2.93817>,s}
+// id 1585
+sphere{<-4.04547,8.05755,-2.99065>,s}
+// id 470
+sphere{<-4.38609,8.98358,-2.82516>,s}
+// id 2117
+sphere{<-4.38054,7.97949,-2.02135>,s}
+// id 753
+sphere{<-4.6422,9.82053,-2.33627>,s}
+// id 2016
+sphere{<-1.36391,8.83016,-2.99126>,s}
+// id 1015
+sphere{<-1.46082,8.92172,-1.39678>,s}
+// id 693
+sphere{<-2.52185,8.36522,-2.98007>,s}
+// id 457
+sphere{<-0.865002,8.28684,-1.89498>,s}
+// id 382
+sphere{<-0.627484,8.16174,-2.86275>,s}
+// id 1244
+sphere{<-1.63179,7.88225,-2.80178>,s}
+// id 436
+sphere{<-2.58762,9.36891,-2.88841>,s}
+// id 357
+sphere{<-0.73767,10.1609,-2.75465>,s}
+// id 1867
+sphere{<-2.00262,8.76608,-2.22282>,s}
+// id 443
+sphere{<-2.47923,10.3031,-2.52002>,s}
+// id 924
+sphere{<-1.66554,9.78074,-2.85345>,s}
+// id 1410
+sphere{<-1.04019,9.3514,-2.20299>,s}
+// id 306
+sphere{<-0.101237,8.89953,-2.1112>,s}
+// id 2188
+sphere{<-0.442033,9.21975,-2.99016>,s}
+// id 1087
+sphere{<-1.92431,9.7562,-1.88307>,s}
+// id 2151
+sphere{<-0.830316,10.3079,-1.7664>,s}
+// id 662
+sphere{<1.97646,7.93492,-1.989>,s}
+// id 2132
+sphere{<0.0693891,7.97441,-1.71768>,s}
+// id 1459
+sphere{<0.305093,8.54601,-2.95493>,s}
+// id 1430
+sphere{<2.05845,8.21923,-2.94162>,s}
+// id 219
+sphere{<0.903657,9.43201,-2.02975>,s}
+// id 1172
+sphere{<0.897796,8.37401,-2.17018>,s}
+// id 1329
+sphere{<2.5001,9.21427,-1.40511>,s}
+// id 92
+sphere{<1.75354,8.90172,-2.11297>,s}
+// id 1101
+sphere{<1.09288,10.3477,-1.63957>,s}
+// id 1595
+sphere{<0.0259705,9.89732,-2.15818>,s}
+// id 1854
+sphere{<2.16394,9.80341,-2.13632>,s}
+// id 288
+sphere{<1.25627,8.84871,-2.99023>,s}
+// id 1667
+sphere{<0.514327,9.5298,-2.94987>,s}
+// id 1932
+sphere{<2.28912,9.19098,-2.93711>,s}
+// id 2349
+sphere{<1.46387,9.82716,-2.84687>,s}
+// id 291
+sphere{<3.00695,10.1294,-1.47338>,s}
+// id 2234
+sphere{<2.70307,8.59286,-2.21653>,s}
+// id 885
+sphere{<3.02546,7.94243,-2.93934>,s}
+// id 365
+sphere{<4.672,7.84008,-2.2306>,s}
+// id 1307
+sphere{<4.16302,8.00207,-1.37855>,s}
+// id 2256
+sphere{<3.64311,8.24518,-2.20036>,s}
+// id 1811
+sphere{<4.29188,8.95905,-1.93555>,s}
+// id 965
+sphere{<3.98352,9.90916,-1.39841>,s}
+// id 768
+sphere{<3.35316,9.3049,-1.93185>,s}
+// id 179
+sphere{<4.66984,10.1017,-2.10704>,s}
+// id 2270
+sphere{<3.31412,8.9134,-2.95006>,s}
+// id 514
+sphere{<4.28505,8.66062,-2.90877>,s}
+// id 59
+sphere{<3.01006,9.8398,-2.70422>,s}
+// id 273
+sphere{<3.99595,9.59628,-2.65043>,s}
+// id 371
+sphere{<4.99817,9.27544,-2.56972>,s}
+// id 78
+sphere{<6.15221,8.28167,-1.66478>,s}
+// id 629
+sphere{<5.21867,8.59291,-1.84036>,s}
+// id 2082
+sphere{<7.50418,8.89283,-1.43062>,s}
+// id 1347
+sphere{<6.93653,8.55304,-2.22466>,s}
+// id 1354
+sphere{<7.79059,8.07672,-2.01522>,s}
+// id 900
+sphere{<5.60873,9.77888,-1.95839>,s}
+// id 411
+sphere{<6.56606,9.354,-1.76037>,s}
+// id 1387
+sphere{<5.93824,8.96369,-2.43114>,s}
+// id 844
+sphere{<6.21384,8.05932,-2.75408>,s}
+// id 304
+sphere{<5.26405,8.35288,-2.8542>,s}
+// id 1967
+sphere{<8.53715,7.96255,-1.35927>,s}
+// id 391
+sphere{<-3.041,10.8932,-1.87543>,s}
+// id 2175
+sphere{<-3.95478,10.4503,-1.96425>,s}
+// id 1455
+sphere{<-4.91412,10.4104,-1.57506>,s}
+// id 947
+sphere{<-2.08024,11.2125,-1.754>,s}
+// id 1320
+sphere{<-0.940934,11.3072,-1.86454>,s}
+// id 2131
+sphere{<-0.101327,10.9496,-1.34406>,s}
+// id 2118
+sphere{<-1.52197,10.6773,-2.40396>,s}
+// id 258
+sphere{<-0.150015,10.8672,-2.34011>,s}
+// id 879
+sphere{<0.722928,10.4544,-2.60643>,s}
+// id 679
+sphere{<1.6696,10.6954,-2.38067>,s}
+// id 400
+sphere{<2.07553,10.5181,-1.43541>,s}
+// id 1111
+sphere{<1.63056,11.3887,-1.64819>,s}
+// id 274
+sphere{<0.68325,11.2571,-1.94062>,s}
+// id 459
+sphere{<2.65771,10.6724,-2.24831>,s}
+// id 1962
+sphere{<2.96286,11.2266,-1.47653>,s}
+// id 1807
+sphere{<3.64899,10.4199,-2.19785>,s}
+// id 1401
+sphere{<3.94709,10.9569,-1.40844>,s}
+// id 1436
+sphere{<-5.41215,-10.6592,-0.473607>,s}
+// id 2295
+sphere{<-4.39521,-10.7442,-1.28996>,s}
+// id 2381
+sphere{<-3.50838,-11.2215,-1.07479>,s}
+// id 2067
+sphere{<-4.44403,-11.1163,-0.343233>,s}
+// id 2226
+sphere{<-5.03119,-10.8539,0.431563>,s}
+// id 1230
+sphere{<-3.95339,-11.2715,0.538824>,s}
+// id 1217
+sphere{<-4.4753,-10.8196,1.26884>,s}
+// id 1723
+sphere{<-3.71402,-10.4365,-0.451126>,s}
+// id 341
+sphere{<-2.839,-11.5435,0.809418>,s}
+// id 1945
+sphere{<-3.1233,-11.3407,-0.138751>,s}
+// id 1259
+sphere{<-2.70706,-10.5079,1.28249>,s}
+// id 1835
+sphere{<-3.29218,-10.5244,0.465047>,s}
+// id 1948
+sphere{<-2.28472,-10.806,0.424719>,s}
+// id 77
+sphere{<-2.20699,-11.7704,0.00998425>,s}
+// id 2061
+sphere{<-2.51625,-11.389,-0.941421>,s}
+// id 1546
+sphere{<-1.01536,-10.6118,-1.31467>,s}
+// id 1097
+sphere{<-1.80511,-10.8754,-0.456353>,s}
+// id 2243
+sphere{<-1.44669,-11.7631,-0.77931>,s}
+// id 1479
+sphere{<-0.543263,-11.7752,1.10687>,s}
+// id 1119
+sphere{<-1.62898,-11.5112,0.791218>,s}
+// id 2325
+sphere{<-0.343167,-11.0175,0.481493>,s}
+// id 1699
+sphere{<-1.28949,-10.649,0.405936>,s}
+// id 1427
+sphere{<-0.804638,-11.0008,-0.408088>,s}
+// id 733
+sphere{<-0.910257,-11.9497,0.189654>,s}
+// id 1197
+sphere{<-0.443759,-11.8898,-0.69506>,s}
+// id 423
+sphere{<1.07821,-10.6343,1.23432>,s}
+// id 1447
+sphere{<0.542206,-11.5206,1.28966>,s}
+// id 1206
+sphere{<2.04807,-10.5625,-1.32715>,s}
+// id 1570
+sphere{<2.36835,-11.5079,-1.1931>,s}
+// id 2077
+sphere{<0.128,-11.8968,0.287526>,s}
+// id 704
+sphere{<1.26622,-10.9736,-0.406283>,s}
+// id 1654
+sphere{<0.653683,-10.9769,0.384176>,s}
+// id 841
+sphere{<0.84916,-11.9036,-0.468908>,s}
+// id 1522
+sphere{<0.182955,-11.1397,-0.483069>,s}
+// id 778
+sphere{<1.1286,-11.8646,0.491866>,s}
+// id 658
+sphere{<1.97735,-11.3011,0.466066>,s}
+// id 608
+sphere{<1.85228,-11.8224,-0.396882>,s}
+// id 986
+sphere{<0.36058,-11.65,-1.32913>,s}
+// id 222
+sphere{<1.37757,-11.6203,-1.29417>,s}
+// id 407
+sphere{<2.57678,-11.408,1.26129>,s}
+// id 1698
+sphere{<2.01633,-10.4184,0.944943>,s}
+// id 1027
+sphere{<2.05066,-10.4235,-0.0616407>,s}
+// id 1508
+sphere{<4.23966,-10.9432,-1.23081>,s}
+// id 1314
+sphere{<2.80388,-10.8043,-0.630392>,s}
+// id 1731
+sphere{<2.77776,-11.6701,-0.0243659>,s}
+// id 1911
+sphere{<3.60401,-11.3952,-0.525192>,s}
+// id 935
+sphere{<2.97017,-10.6797,0.672558>,s}
+// id 1819
+sphere{<3.66349,-11.3822,0.4744>,s}
+// id 1075
+sphere{<4.43509,-10.9486,0.97165>,s}
+// id 2228
+sphere{<3.6138,-10.4982,-0.0710904>,s}
+// id 665
+sphere{<4.46868,-11.1279,-0.0996899>,s}
+// id 1372
+sphere{<5.22376,-10.6106,-1.00016>,s}
+// id 41
+sphere{<5.39753,-10.5249,0.982452>,s}
+// id 439
+sphere{<5.37769,-10.7106,-0.00614841>,s}
+// id 1492
+sphere{<-8.99586,-7.83296,-0.647058>,s}
+// id 1355
+sphere{<-8.51562,-8.45523,-0.0181487>,s}
+// id 874
+sphere{<-8.8057,-7.98627,0.816026>,s}
+// id 63
+sphere{<-8.08845,-8.69552,0.853527>,s}
+// id 485
+sphere{<-8.04943,-8.70375,-0.867372>,s}
+// id 1871
+sphere{<-5.55773,-10.3626,1.13021>,s}
+// id 1346
+sphere{<-6.10015,-10.3268,0.171849>,s}
+// id 1914
+sphere{<-7.3251,-9.34038,0.873227>,s}
+// id 328
+sphere{<-5.22277,-9.85867,0.305851>,s}
+// id 1999
+sphere{<-5.3027,-8.88017,0.566005>,s}
+// id 1847
+sphere{<-6.21451,-8.89685,0.994835>,s}
+// id 429
+sphere{<-6.48128,-9.86767,0.974033>,s}
+// id 1600
+sphere{<-7.07752,-8.34961,0.836456>,s}
+// id 1438
+sphere{<-6.36189,-8.04208,-0.612237>,s}
+// id 1973
+sphere{<-6.22163,-8.08679,0.376774>,s}
+// id 1977
+sphere{<-7.26967,-9.34695,-0.856049>,s}
+// id 2237
+sphere{<-6.852,-8.7264,-0.0639254>,s}
+// id 914
+sphere{<-7.76957,-9.12471,0.00212665>,s}
+// id 727
+sphere{<-6.9789,-9.74695,0.0272362>,s}
+// id 864
+sphere{<-5.56614,-8.6054,-0.380675>,s}
+// id 2014
+sphere{<-5.52575,-9.55011,-0.709684>,s}
+// id 1156
+sphere{<-6.07007,-9.32455,0.0983602>,s}
+// id 2031
+sphere{<-6.32978,-8.99358,-0.920921>,s}
+// id 1185
+sphere{<-6.41957,-10.007,-0.764678>,s}
+// id 882
+sphere{<-7.20365,-8.22255,-1.11959>,s}
+// id 23
+sphere{<-7.59607,-8.06049,0.00793055>,s}
+// id 2217
+sphere{<-5.34468,-8.10241,-1.21677>,s}
+// id 692
+sphere{<-5.45858,-8.01539,1.04185>,s}
+// id 1422
+sphere{<-2.78464,-10.0821,-0.279474>,s}
+// id 11
+sphere{<-2.70559,-9.7068,0.667994>,s}
+// id 973
+sphere{<-3.07667,-10.1423,-1.23412>,s}
+// id 2368
+sphere{<-3.6844,-9.97956,1.21127>,s}
+// id 943
+sphere{<-4.2516,-10.2029,0.408409>,s}
+// id 1557
+sphere{<-2.63014,-8.35594,-1.24434>,s}
+// id 329
+sphere{<-4.6733,-9.60747,1.11127>,s}
+// id 1799
+sphere{<-3.48294,-9.35984,-0.584494>,s}
+// id 619
+sphere{<-3.62285,-8.63635,-1.29239>,s}
+// id 933
+sphere{<-4.51084,-9.19417,0.0419852>,s}
+// id 1668
+sphere{<-4.04323,-9.79915,-1.30476>,s}
+// id 26
+sphere{<-4.63889,-10.0204,-0.525857>,s}
+// id 74
+sphere{<-4.54956,-8.9966,-0.945919>,s}
+// id 1107
+sphere{<-3.58442,-9.28962,0.412322>,s}
+// id 107
+sphere{<-4.48701,-8.60088,1.07703>,s}
+// id 1105
+sphere{<-3.49877,-8.70535,1.22256>,s}
+// id 1220
+sphere{<-3.85187,-8.31631,0.349006>,s}
+// id 158
+sphere{<-2.85622,-8.38551,0.500189>,s}
+// id 1000
+sphere{<-3.22124,-8.32767,-0.429962>,s}
+// id 339
+sphere{<-4.62889,-8.25565,-0.279874>,s}
+// id 873
+sphere{<-4.34686,-7.9357,-1.18506>,s}
+// id 1774
+sphere{<-0.15458,-8.05945,-0.882976>,s}
+// id 2229
+sphere{<-0.725163,-8.82989,-1.20232>,s}
+// id 872
+sphere{<-0.366275,-9.16243,-0.329134>,s}
+// id 315
+sphere{<-0.231162,-10.1263,0.0145953>,s}
+// id 1122
+sphere{<-0.314427,-9.78829,-1.11378>,s}
+// id 2176
+sphere{<-1.08834,-10.0403,-0.496345>,s}
+// id 406
+sphere{<-2.10396,-10.3933,-1.29134>,s}
+// id 1364
+sphere{<-0.779416,-10.1439,1.10982>,s}
+// id 2184
+sphere{<-0.30921,-9.2777,1.27894>,s}
+// id 2276
+sphere{<-1.0012,-8.36286,-0.316869>,s}
+// id 1795
+sphere{<-2.48229,-9.34722,-1.08291>,s}
+// id 880
+sphere{<-1.78644,-9.58633,1.0554>,s}
+// id 1506
+sphere{<-1.87919,-9.89308,0.104006>,s}
+// id 1894
+sphere{<-1.59242,-9.15517,-0.515304>,s}
+// id 1267
+sphere{<-1.0072,-9.4895,0.382049>,s}
+// id 2128
+sphere{<-0.463117,-8.63972,0.524614>,s}
+// id 738
+sphere{<-2.5166,-8.93259,1.27206>,s}
+// id 292
+sphere{<-1.95963,-8.10248,1.18748>,s}
+// id 721
+sphere{<-1.72048,-8.66815,0.354883>,s}
+// id 902
+sphere{<-1.19464,-8.78687,1.21508>,s}
+// id 1786
+sphere{<-0.997913,-7.86861,0.86661>,s}
+// id 2379
+sphere{<-2.51555,-9.10717,-0.112689>,s}
+// id 1151
+sphere{<-2.21833,-8.02556,-0.390016>,s}
+// id 481
+sphere{<1.28664,-9.03043,-1.31614>,s}
+// id 1814
+sphere{<0.268856,-8.92057,-1.27394>,s}
+// id 2177
+sphere{<2.33607,-8.86058,-1.28917>,s}
+// id 1036
+sphere{<1.45057,-9.93631,-0.807076>,s}
+// id 1340
+sphere{<1.85583,-8.03414,-1.00085>,s}
+// id 834
+sphere{<0.31213,-8.45638,-0.0846069>,s}
+// id 660
+sphere{<0.870854,-8.19834,-0.921671>,s}
+// id 974
+sphere{<0.489898,-10.2087,-0.687239>,s}
+// id 137
+sphere{<0.262884,-7.93171,0.791201>,s}
+// id 1984
+sphere{<0.788728,-9.25679,-0.470877>,s}
+// id 2162
+sphere{<1.09197,-10.0829,0.127066>,s}
+// id 953
+sphere{<0.582594,-8.78537,1.2274>,s}
+// id 2388
+sphere{<0.269021,-9.33242,0.434886>,s}
+// id 1792
+sphere{<0.225281,-10.2223,0.899996>,s}
+// id 1099
+sphere{<1.06951,-9.65352,1.03848>,s}
+// id 301
+sphere{<2.46103,-8.65978,0.49739>,s}
+// id 2056
+sphere{<1.17275,-8.88816,0.395811>,s}
+// id 1816
+sphere{<1.93862,-9.54923,0.439878>,s}
+// id 577
+sphere{<1.76465,-8.90952,1.22312>,s}
+// id 1682
+sphere{<1.28481,-8.06713,0.968037>,s}
+// id 1265
+sphere{<2.44317,-9.78988,-0.765269>,s}
+// id 474
+sphere{<1.80799,-9.05962,-0.429333>,s}
+// id 1923
+sphere{<1.68359,-8.12549,-0.00178841>,s}
+// id 1093
+sphere{<3.57893,-10.0266,1.12656>,s}
+// id 531
+sphere{<4.64016,-10.1129,0.461984>,s}
+// id 1092
+sphere{<2.70494,-9.44463,1.07906>,s}
+// id 1970
+sphere{<3.56827,-8.92295,1.02429>,s}
+// id 1655
+sphere{<4.40847,-9.44279,1.2092>,s}
+// id 1276
+sphere{<3.22024,-7.98168,0.826637>,s}
+// id 675
+sphere{<4.25794,-8.06875,0.650575>,s}
+// id 2208
+sphere{<4.44356,-10.1909,-0.537059>,s}
+// id 1681
+sphere{<3.43632,-9.68708,-0.657748>,s}
+// id 139
+sphere{<3.81996,-9.56626,0.271206>,s}
+// id 450
+sphere{<2.85444,-9.82911,0.147132>,s}
+// id 726
+sphere{<3.71397,-8.57544,-0.0314818>,s}
+// id 1721
+sphere{<2.83716,-8.92169,-0.42037>,s}
+// id 890
+sphere{<5.03433,-9.60095,-1.11392>,s}
+// id 1395
+sphere{<4.61145,-8.95416,0.318934>,s}
+// id 1907
+sphere{<4.30132,-9.11157,-0.637908>,s}
+// id 1928
+sphere{<5.18152,-8.65085,-0.454243>,s}
+// id 1530
+sphere{<2.94213,-7.95009,-0.144115>,s}
+// id 167
+sphere{<4.41173,-7.92515,-0.370891>,s}
+// id 2294
+sphere{<3.50452,-8.77071,-1.16635>,s}
+// id 1754
+sphere{<2.84358,-8.00422,-1.16862>,s}
+// id 2272
+sphere{<4.69874,-8.29258,-1.25641>,s}
+// id 1746
+sphere{<7.28559,-8.13012,-1.00419>,s}
+// id 1057
+sphere{<6.73121,-8.76139,-0.454318>,s}
+// id 1396
+sphere{<7.65587,-9.15597,-0.511398>,s}
+// id 2344
+sphere{<6.80552,-9.67205,-0.982958>,s}
+// id 312
+sphere{<7.57206,-7.98729,0.301876>,s}
+// id 2351
+sphere{<7.64864,-9.11951,0.5124>,s}
+// id 2213
+sphere{<6.95015,-9.68758,0.00756165>,s}
+// id 2100
+sphere{<6.10686,-10.2458,-0.52654>,s}
+// id 1772
+sphere{<6.18426,-10.1579,0.467914>,s}
+// id 2224
+sphere{<5.3378,-9.46117,0.821902>,s}
+// id 1779
+sphere{<6.12862,-8.91014,1.15763>,s}
+// id 2339
+sphere{<6.89895,-9.54336,1.02109>,s}
+// id 2051
+sphere{<7.26292,-8.60648,1.2924>,s}
+// id 1408
+sphere{<5.43399,-8.45148,0.602805>,s}
+// id 1548
+sphere{<6.68325,-8.40086,0.499575>,s}
+// id 313
+sphere{<5.32265,-9.71367,-0.162181>,s}
+// id 284
+sphere{<5.92219,-9.21385,-0.832054>,s}
+// id 3
+sphere{<6.08029,-9.16513,0.191407>,s}
+// id 838
+sphere{<5.64013,-7.91964,-1.0866>,s}
+// id 1897
+sphere{<5.99094,-8.13204,-0.172465>,s}
+// id 913
+sphere{<8.20695,-8.41929,0.990372>,s}
+// id 2115
+sphere{<8.3188,-8.58091,0.00138728>,s}
+// id 1717
+sphere{<8.92316,-7.81239,0.628115>,s}
+// id 458
+sphere{<8.22228,-8.4829,-0.992774>,s}
+// id 630
+sphere{<8.93373,-7.88407,-0.374645>,s}
+// id 272
+sphere{<-10.4494,-5.84403,-0.391781>,s}
+// id 1023
+sphere{<-9.94449,-6.69664,-0.254476>,s}
+// id 129
+sphere{<-10.0701,-5.95764,-1.30798>,s}
+// id 28
+sphere{<-9.35886,-5.85079,-0.609869>,s}
+// id 1645
+sphere{<-9.39432,-5.89668,0.38941>,s}
+// id 1720
+sphere{<-9.46906,-7.05383,-1.05869>,s}
+// id 818
+sphere{<-8.61742,-6.54286,-1.18898>,s}
+// id 626
+sphere{<-10.3734,-5.90972,0.60173>,s}
+// id 596
+sphere{<-8.94259,-6.6865,-0.251458>,s}
+// id 645
+sphere{<-9.81561,-6.73861,0.736537>,s}
+// id 36
+sphere{<-9.38898,-7.46368,0.19293>,s}
+// id 2214
+sphere{<-8.80035,-6.83509,0.729462>,s}
+// id 769
+sphere{<-7.85138,-7.70447,0.914672>,s}
+// id 97
+sphere{<-8.40766,-6.02933,0.285839>,s}
+// id 961
+sphere{<-7.95119,-6.75889,-0.482478>,s}
+// id 2108
+sphere{<-8.39751,-7.46367,0.066083>,s}
+// id 604
+sphere{<-8.01704,-7.70188,-0.829142>,s}
+// id 1089
+sphere{<-8.26851,-5.7526,-0.666385>,s}
+// id 229
+sphere{<-7.83897,-5.20241,0.425902>,s}
+// id 648
+sphere{<-6.99574,-7.38643,0.454708>,s}
+// id 686
+sphere{<-6.93688,-5.73127,0.558208>,s}
+// id 1358
+sphere{<-7.79963,-6.79026,0.508573>,s}
+// id 1182
+sphere{<-7.6789,-5.21296,-1.26995>,s}
+// id 71
+sphere{<-7.28797,-5.49468,-0.355072>,s}
+// id 232
+sphere{<-6.34696,-5.8304,-0.246611>,s}
+// id 2328
+sphere{<-6.4941,-6.5172,-0.95413>,s}
+// id 1195
+sphere{<-7.01687,-6.61958,1.1324>,s}
+// id 187
+sphere{<-7.77379,-5.96401,1.07379>,s}
+// id 2206
+sphere{<-6.65422,-5.5206,-1.1637>,s}
+// id 1176
+sphere{<-7.10467,-7.30167,-0.741903>,s}
+// id 83
+sphere{<-6.2719,-7.13572,-0.198242>,s}
+// id 820
+sphere{<-7.42082,-6.16626,-1.08434>,s}
+// id 1931
+sphere{<-6.04748,-7.35396,-1.26573>,s}
+// id 1614
+sphere{<-7.05093,-6.51975,-0.106583>,s}
+// id 985
+sphere{<-6.17421,-7.31785,1.02035>,s}
+// id 1311
+sphere{<-6.22971,-6.45253,0.526712>,s}
+// id 1829
+sphere{<-5.36734,-6.96305,0.481681>,s}
+// id 1832
+sphere{<-5.71958,-5.24259,0.262062>,s}
+// id 1569
+sphere{<-6.08986,-5.64925,1.10104>,s}
+// id 2096
+sphere{<-5.40046,-7.62101,-0.269109>,s}
+// id 334
+sphere{<-5.54455,-6.46923,-0.385226>,s}
+// id 1470
+sphere{<-5.5152,-5.5218,-0.708568>,s}
+// id 1545
+sphere{<-3.93085,-7.79331,1.27873>,s}
+// id 1004
+sphere{<-4.66712,-7.67769,0.531978>,s}
+// id 393
+sphere{<-3.24436,-6.48302,0.685556>,s}
+// id 1542
+sphere{<-4.1404,-6.89641,0.871984>,s}
+// id 1328
+sphere{<-3.36323,-7.46163,0.524928>,s}
+// id 266
+sphere{<-5.11232,-5.99578,0.537709>,s}
+// id 2143
+sphere{<-4.53736,-5.54568,1.25043>,s}
+// id 226
+sphere{<-4.08143,-5.9836,0.476435>,s}
+// id 342
+sphere{<-2.7521,-5.4447,0.774482>,s}
+// id 255
+sphere{<-4.65697,-6.89598,-0.215682>,s}
+// id 380
+sphere{<-5.07887,-7.14714,-1.09>,s}
+// id 1341
+sphere{<-3.70618,-6.58919,-0.271677>,s}
+// id 1567
+sphere{<-4.08571,-6.97565,-1.12783>,s}
+// id 688
+sphere{<-3.35112,-7.65598,-1.16082>,s}
+// id 1979
+sphere{<-3.89123,-7.56986,-0.318113>,s}
+// id 1625
+sphere{<-2.84182,-6.36479,-0.895096>,s}
+// id 2178
+sphere{<-2.92864,-7.22044,-0.351538>,s}
+// id 2141
+sphere{<-4.75385,-6.21009,-0.996605>,s}
+// id 1695
+sphere{<-3.25943,-5.73379,-0.0374426>,s}
+// id 1270
+sphere{<-3.76338,-6.02699,-1.10091>,s}
+// id 945
+sphere{<-4.29601,-5.55216,-0.398377>,s}
+// id 310
+sphere{<-3.07827,-5.32093,-0.930234>,s}
+// id 1769
+sphere{<-0.314549,-6.08982,-0.642677>,s}
+// id 2236
+sphere{<-2.44523,-6.91293,1.26323>,s}
+// id 171
+sphere{<-2.35803,-7.51751,0.468895>,s}
+// id 1499
+sphere{<-1.72721,-6.75074,0.582601>,s}
+// id 931
+sphere{<-0.311841,-7.28638,1.30242>,s}
+// id 2023
+sphere{<-0.208107,-6.28048,1.18795>,s}
+// id 1369
+sphere{<-0.72808,-6.86522,0.491229>,s}
+// id 1336
+sphere{<-1.85571,-5.74525,0.434353>,s}
+// id 1137
+sphere{<-0.907985,-5.93559,0.16684>,s}
+// id 1622
+sphere{<-1.18651,-6.09966,1.11617>,s}
+// id 154
+sphere{<-1.79896,-6.81722,-0.557043>,s}
+// id 237
+sphere{<-2.49038,-6.4171,0.0437528>,s}
+// id 303
+sphere{<-2.43046,-7.26682,-1.21903>,s}
+// id 848
+sphere{<-1.43631,-7.70776,-0.945727>,s}
+// id 285
+sphere{<-0.360423,-7.68037,0.0425829>,s}
+// id 1140
+sphere{<-1.44923,-7.54,0.0372815>,s}
+// id 509
+sphere{<-0.807228,-6.98679,-0.550596>,s}
+// id 192
+sphere{<-2.22536,-5.61393,-0.497131>,s}
+// id 1686
+sphere{<-1.30155,-5.96971,-0.751203>,s}
+// id 968
+sphere{<2.23099,-6.44857,-0.81413>,s}
+// id 2144
+sphere{<2.5962,-5.50838,-0.713685>,s}
+// id 2326
+sphere{<1.36071,-6.17403,-1.28963>,s}
+// id 240
+sphere{<0.189945,-6.9281,-0.383638>,s}
+// id 112
+sphere{<0.464752,-7.35031,-1.2708>,s}
+// id 1060
+sphere{<1.64253,-5.79254,-0.328346>,s}
+// id 1333
+sphere{<2.38384,-5.54833,0.342715>,s}
+// id 1223
+sphere{<0.0889167,-6.01228,0.266374>,s}
+// id 1713
+sphere{<0.68546,-6.02113,-0.552005>,s}
+// id 2373
+sphere{<1.05479,-6.25096,0.346501>,s}
+// id 2283
+sphere{<0.784205,-6.26894,1.32286>,s}
+// id 1165
+sphere{<0.34573,-6.92881,0.609212>,s}
+// id 1437
+sphere{<1.70734,-5.94622,1.04027>,s}
+// id 1935
+sphere{<1.28728,-6.82332,-0.479618>,s}
+// id 31
+sphere{<0.834805,-7.58715,0.0282795>,s}
+// id 1294
+sphere{<2.2169,-7.71959,0.762687>,s}
+// id 859
+sphere{<1.42455,-7.10876,0.708995>,s}
+// id 2122
+sphere{<2.3119,-6.72718,1.1864>,s}
+// id 1803
+sphere{<2.18372,-7.32501,-0.334838>,s}
+// id 98
+sphere{<2.0714,-6.49487,0.242058>,s}
+// id 819
+sphere{<4.70657,-5.86433,-0.697546>,s}
+// id 1619
+sphere{<3.70877,-5.81878,-0.744631>,s}
+// id 894
+sphere{<4.23276,-5.34287,0.0619875>,s}
+// id 246
+sphere{<2.88504,-7.06913,0.391231>,s}
+// id 21
+sphere{<3.87642,-7.33559,1.23329>,s}
+// id 260
+sphere{<4.90591,-7.62476,1.26973>,s}
+// id 1138
+sphere{<2.67022,-5.78414,1.30524>,s}
+// id 1771
+sphere{<3.33891,-6.49758,1.09049>,s}
+// id 1544
+sphere{<3.36957,-5.60149,0.545457>,s}
+// id 376
+sphere{<4.58006,-6.82194,0.740742>,s}
+// id 1850
+sphere{<4.17515,-5.94766,1.02665>,s}
+// id 1742
+sphere{<4.9595,-5.93791,0.405487>,s}
+// id 2313
+sphere{<3.84057,-7.29685,0.163528>,s}
+// id 1476
+sphere{<3.11067,-7.11222,-0.669223>,s}
+// id 1214
+sphere{<5.09136,-7.56762,0.277936>,s}
+// id 2062
+sphere{<4.87005,-7.28172,-1.07078>,s}
+// id 1946
+sphere{<3.98239,-6.30834,0.111292>,s}
+// id 2353
+sphere{<3.01238,-6.24171,-0.161218>,s}
+// id 1520
+sphere{<4.05306,-6.77865,-0.771644>,s}
+// id 1939
+sphere{<4.87991,-6.72248,-0.212991>,s}
+// id 1280
+sphere{<3.83791,-7.77024,-1.20677>,s}
+// id 1029
+sphere{<7.16652,-5.57564,-0.490063>,s}
+// id 1678
+sphere{<5.6728,-5.37846,-0.959498>,s}
+// id 1630
+sphere{<7.3522,-6.6643,-0.669942>,s}
+// id 1778
+sphere{<7.78738,-5.64145,1.21635>,s}
+// id 1810
+sphere{<5.60383,-6.60118,-1.17158>,s}
+// id 780
+sphere{<6.7823,-5.70306,1.17232>,s}
+// id 1066
+sphere{<6.49679,-7.03115,-1.03745>,s}
+// id 2282
+sphere{<7.28268,-6.56676,1.24511>,s}
+// id 1025
+sphere{<6.4331,-6.03373,-1.00043>,s}
+// id 377
+sphere{<6.84235,-7.60071,-0.266768>,s}
+// id 912
+sphere{<5.68581,-6.13549,-0.289422>,s}
+// id 435
+sphere{<6.55437,-6.67227,0.0387942>,s}
+// id 263
+sphere{<7.58881,-6.98473,0.251849>,s}
+// id 2263
+sphere{<7.34901,-6.02456,0.396386>,s}
+// id 1575
+sphere{<6.42911,-5.67943,0.204762>,s}
+// id 378
+sphere{<5.85822,-7.60002,0.919662>,s}
+// id 1764
+sphere{<6.82358,-7.41507,0.729715>,s}
+// id 2170
+sphere{<5.57404,-6.72364,0.513216>,s}
+// id 1243
+sphere{<6.28662,-6.68185,1.21651>,s}
+// id 599
+sphere{<5.78782,-5.84432,0.965882>,s}
+// id 941
+sphere{<5.7644,-7.17455,-0.358792>,s}
+// id 2036
+sphere{<10.3833,-5.57369,1.10424>,s}
+// id 812
+sphere{<7.81499,-7.43081,1.12319>,s}
+// id 1507
+sphere{<8.57198,-7.03611,0.0769697>,s}
+// id 1573
+sphere{<8.21768,-6.50531,0.894846>,s}
+// id 791
+sphere{<8.11602,-6.1949,-0.226275>,s}
+// id 1512
+sphere{<10.0263,-6.411,0.683303>,s}
+// id 1658
+sphere{<9.28366,-6.97718,1.04914>,s}
+// id 572
+sphere{<9.05398,-6.14514,0.471551>,s}
+// id 1785
+sphere{<9.55588,-7.22855,0.0956954>,s}
+// id 1325
+sphere{<8.24195,-5.39221,0.358347>,s}
+// id 2303
+sphere{<9.419,-5.34264,0.961086>,s}
+// id 756
+sphere{<9.60886,-5.58164,-0.231871>,s}
+// id 159
+sphere{<7.98174,-7.57249,-0.548901>,s}
+// id 1941
+sphere{<8.33784,-6.78197,-1.06774>,s}
+// id 1650
+sphere{<10.0683,-6.47327,-0.327955>,s}
+// id 2109
+sphere{<9.07017,-6.3759,-0.519442>,s}
+// id 977
+sphere{<9.77164,-6.35567,-1.28982>,s}
+// id 601
+sphere{<9.34761,-7.21405,-0.999493>,s}
+// id 1135
+sphere{<8.6425,-5.41259,-0.578852>,s}
+// id 1356
+sphere{<10.3947,-5.69196,-0.869309>,s}
+// id 612
+sphere{<10.542,-5.70756,0.125937>,s}
+// id 1059
+sphere{<-11.1037,-3.82368,1.20788>,s}
+// id 2189
+sphere{<-10.8849,-5.03997,0.0236843>,s}
+// id 1443
+sphere{<-10.8335,-4.76137,0.983872>,s}
+// id 2098
+sphere{<-11.4918,-3.34868,-0.368517>,s}
+// id 2203
+sphere{<-10.5198,-3.58141,-0.410052>,s}
+// id 1255
+sphere{<-11.2581,-4.09398,0.253903>,s}
+// id 752
+sphere{<-11.5036,-3.13043,0.605489>,s}
+// id 1005
+sphere{<-10.4803,-3.35679,0.563677>,s}
+// id 2125
+sphere{<-10.8797,-2.62307,-0.00155648>,s}
+// id 2261
+sphere{<-10.6088,-5.1443,-1.08654>,s}
+// id 742
+sphere{<-11.0847,-4.35763,-0.691511>,s}
+// id 447
+sphere{<-10.6131,-2.74697,-0.963211>,s}
+// id 792
+sphere{<-11.1504,-3.54476,-1.28777>,s}
+// id 2231
+sphere{<-7.98654,-3.58381,1.22903>,s}
+// id 2068
+sphere{<-7.91805,-4.7083,-0.441144>,s}
+// id 111
+sphere{<-8.81678,-5.1821,-0.0487409>,s}
+// id 160
+sphere{<-9.00737,-3.71343,1.08789>,s}
+// id 579
+sphere{<-8.25432,-3.13712,-0.524631>,s}
+// id 2002
+sphere{<-8.47968,-3.13505,0.455697>,s}
+// id 1163
+sphere{<-8.32465,-4.38314,0.728641>,s}
+// id 1710
+sphere{<-8.79426,-4.76412,-0.955049>,s}
+// id 1496
+sphere{<-8.60257,-4.02482,-0.188021>,s}
+// id 1146
+sphere{<-8.02516,-4.2244,-1.3087>,s}
+// id 2273
+sphere{<-8.89273,-5.18848,0.951021>,s}
+// id 1076
+sphere{<-9.81386,-5.10499,-0.122934>,s}
+// id 2347
+sphere{<-10.2686,-4.297,0.294034>,s}
+// id 1068
+sphere{<-9.28254,-4.42979,0.420397>,s}
+// id 29
+sphere{<-9.88964,-5.08032,0.878351>,s}
+// id 850
+sphere{<-9.47012,-3.50684,0.0819742>,s}
+// id 1242
+sphere{<-9.52608,-2.86942,0.8471>,s}
+// id 1009
+sphere{<-9.12879,-2.61172,-0.213229>,s}
+// id 1849
+sphere{<-9.75899,-4.21133,-0.569436>,s}
+// id 1400
+sphere{<-9.70454,-3.19025,-0.837118>,s}
+// id 472
+sphere{<-8.9001,-2.71089,-1.18995>,s}
+// id 860
+sphere{<-8.88151,-3.71068,-1.10173>,s}
+// id 869
+sphere{<-7.36281,-3.56978,-0.935905>,s}
+// id 1047
+sphere{<-5.80505,-3.7952,-0.538409>,s}
+// id 1249
+sphere{<-6.73291,-3.72278,-0.172748>,s}
+// id 899
+sphere{<-5.37338,-3.25482,-1.26039>,s}
+// id 2392
+sphere{<-6.32932,-2.95646,-0.673089>,s}
+// id 403
+sphere{<-6.31898,-4.86106,-0.488496>,s}
+// id 2150
+sphere{<-5.82785,-4.48675,-1.26865>,s}
+// id 1440
+sphere{<-7.00158,-4.49117,-1.11804>,s}
+// id 980
+sphere{<-7.31903,-2.69724,-0.449843>,s}
+// id 2343
+sphere{<-5.46202,-2.67617,-0.246343>,s}
+// id 1309
+sphere{<-7.12197,-3.97621,0.877311>,s}
+// id 269
+sphere{<-7.08132,-4.6319,0.116647>,s}
+// id 2297
+sphere{<-5.93567,-4.1728,1.311>,s}
+// id 386
+sphere{<-6.14994,-4.34303,0.350468>,s}
+// id 992
+sphere{<-6.69442,-4.86704,1.00686>,s}
+// id 1933
+sphere{<-5.40257,-3.21985,1.20009>,s}
+// id 1494
+sphere{<-7.71468,-2.63277,1.07857>,s}
+// id 1021
+sphere{<-7.69357,-3.68633,0.109146>,s}
+// id 1203
+sphere{<-7.02118,-3.00442,0.46138>,s}
+// id 1802
+sphere{<-6.43779,-3.32488,1.20576>,s}
+// id 1227
+sphere{<-5.91641,-3.34743,0.351963>,s}
+// id 1637
+sphere{<-5.34499,-4.9646,1.15067>,s}
+// id 618
+sphere{<-5.26261,-4.61482,-0.359204>,s}
+// id 249
+sphere{<-4.88896,-3.47917,-0.0903434>,s}
+// id 705
+sphere{<-4.56085,-4.07429,-0.823664>,s}
+// id 735
+sphere{<-4.73267,-5.07482,0.365656>,s}
+// id 1922
+sphere{<-3.54271,-4.87728,0.399779>,s}
+// id 278
+sphere{<-5.17355,-4.19231,0.542601>,s}
+// id 489
+sphere{<-4.2166,-4.56172,1.06484>,s}
+// id 1991
+sphere{<-4.26231,-4.22726,0.124992>,s}
+// id 2152
+sphere{<-4.75304,-5.01777,-1.11612>,s}
+// id 1056
+sphere{<-3.8191,-4.7162,-0.625652>,s}
+// id 862
+sphere{<3.34069,-5.00479,-0.263599>,s}
+// id 1368
+sphere{<4.05443,-4.9421,-1.09969>,s}
+// id 2246
+sphere{<3.86443,-4.72325,0.756865>,s}
+// id 1734
+sphere{<4.11886,-4.37309,-0.174891>,s}
+// id 1352
+sphere{<4.85991,-5.04136,0.838814>,s}
+// id 1327
+sphere{<4.69399,-4.09515,1.12675>,s}
+// id 1034
+sphere{<5.04594,-4.26329,0.206824>,s}
+// id 544
+sphere{<5.12068,-3.33214,0.638003>,s}
+// id 2299
+sphere{<4.75308,-4.04766,-1.08975>,s}
+// id 1370
+sphere{<4.89361,-4.89166,-0.558975>,s}
+// id 779
+sphere{<5.16167,-3.44912,-0.373913>,s}
+// id 590
+sphere{<5.68548,-4.11349,0.989119>,s}
+// id 1745
+sphere{<5.56107,-5.18227,0.136848>,s}
+// id 1388
+sphere{<6.30505,-4.87773,0.79306>,s}
+// id 685
+sphere{<6.01484,-4.0855,0.0341453>,s}
+// id 2386
+sphere{<6.80204,-4.0124,0.716619>,s}
+// id 49
+sphere{<7.01184,-3.09035,0.106179>,s}
+// id 2070
+sphere{<6.19386,-3.23098,-0.466034>,s}
+// id 562
+sphere{<7.22693,-4.79985,1.20676>,s}
+// id 2185
+sphere{<5.49616,-3.40827,-1.31878>,s}
+// id 737
+sphere{<6.11939,-3.23618,0.551507>,s}
+// id 1216
+sphere{<5.70021,-4.37678,-0.904101>,s}
+// id 1125
+sphere{<7.49099,-3.11622,0.984479>,s}
+// id 1960
+sphere{<6.41122,-3.81562,-1.32971>,s}
+// id 1293
+sphere{<6.95932,-4.02673,-0.288821>,s}
+// id 1465
+sphere{<7.77531,-4.05508,0.491437>,s}
+// id 2163
+sphere{<7.10058,-3.21812,-0.913545>,s}
+// id 1281
+sphere{<6.43754,-4.87807,-0.409663>,s}
+// id 1910
+sphere{<7.24142,-4.85147,0.207239>,s}
+// id 930
+sphere{<6.80753,-5.14267,-1.3188>,s}
+// id 448
+sphere{<7.29706,-4.26895,-1.22446>,s}
+// id 1179
+sphere{<9.10022,-3.18309,1.11217>,s}
+// id 1174
+sphere{<8.25486,-3.6846,1.29236>,s}
+// id 72
+sphere{<8.25315,-3.9862,-1.30346>,s}
+// id 1245
+sphere{<8.23427,-4.69386,1.13353>,s}
+// id 2133
+sphere{<9.58805,-4.01214,-0.0308226>,s}
+// id 2364
+sphere{<9.97658,-4.30893,1.17102>,s}
+// id 1992
+sphere{<10.0302,-4.85998,0.332442>,s}
+// id 1887
+sphere{<9.03401,-4.15281,0.872728>,s}
+// id 46
+sphere{<10.1734,-4.73458,-0.649968>,s}
+// id 1553
+sphere{<8.34769,-3.24018,0.392714>,s}
+// id 146
+sphere{<7.82064,-2.65554,-0.289889>,s}
+// id 561
+sphere{<9.42936,-5.18833,-1.15428>,s}
+// id 2040
+sphere{<7.87143,-3.64325,-0.437293>,s}
+// id 368
+sphere{<8.09029,-2.99974,-1.19126>,s}
+// id 1753
+sphere{<8.98784,-4.38047,-0.750937>,s}
+// id 875
+sphere{<8.83537,-3.41117,-0.557682>,s}
+// id 1117
+sphere{<8.14211,-4.59918,-0.263485>,s}
+// id 2093
+sphere{<9.04762,-4.83642,0.142085>,s}
+// id 79
+sphere{<7.82872,-5.10633,-1.07752>,s}
+// id 286
+sphere{<9.82011,-3.1492,0.418081>,s}
+// id 1636
+sphere{<9.88072,-4.03335,-1.30328>,s}
+// id 1008
+sphere{<10.2115,-3.08712,-1.25596>,s}
+// id 4
+sphere{<9.61693,-2.79217,-0.50378>,s}
+// id 793
+sphere{<11.0266,-4.65891,-0.133811>,s}
+// id 2190
+sphere{<10.8745,-4.7377,0.859869>,s}
+// id 1735
+sphere{<10.541,-3.85345,0.48566>,s}
+// id 798
+sphere{<11.3779,-3.72369,-0.0507723>,s}
+// id 1633
+sphere{<11.3309,-3.4039,0.901491>,s}
+// id 549
+sphere{<10.7258,-2.94678,0.037928>,s}
+// id 2043
+sphere{<11.6444,-2.6852,-0.298834>,s}
+// id 1478
+sphere{<10.4243,-3.73168,-0.50382>,s}
+// id 100
+sphere{<11.2721,-3.35486,-0.973877>,s}
+// id 2136
+sphere{<10.9123,-4.31405,-1.17748>,s}
+// id 309
+sphere{<-11.7198,-0.272845,1.10149>,s}
+// id 1538
+sphere{<-10.897,-1.65391,0.407513>,s}
+// id 430
+sphere{<-11.8935,-1.43906,-0.203189>,s}
+// id 1880
+sphere{<-11.7537,-2.17486,0.460231>,s}
+// id 1213
+sphere{<-11.8177,-1.21954,0.771995>,s}
+// id 1201
+sphere{<-10.5415,-2.43197,0.929516>,s}
+// id 206
+sphere{<-11.9557,-0.487545,0.10242>,s}
+// id 918
+sphere{<-11.0394,-0.863,-0.195157>,s}
+// id 784
+sphere{<-10.794,-0.735571,0.789751>,s}
+// id 267
+sphere{<-10.8958,-1.7912,-0.583657>,s}
+// id 1002
+sphere{<-11.6647,-1.38167,-1.17569>,s}
+// id 640
+sphere{<-11.7081,-2.37702,-0.518123>,s}
+// id 825
+sphere{<-10.8007,-0.85759,-1.17034>,s}
+// id 1077
+sphere{<-11.8154,-0.406381,-0.930149>,s}
+// id 330
+sphere{<-8.08896,-1.70216,0.962466>,s}
+// id 1898
+sphere{<-8.68997,-2.46367,1.2208>,s}
+// id 1483
+sphere{<-7.98508,-2.32091,-1.09406>,s}
+// id 113
+sphere{<-9.82668,-0.373427,-1.07039>,s}
+// id 610
+sphere{<-8.8418,-0.211834,-1.21374>,s}
+// id 2018
+sphere{<-8.96454,-1.22026,1.06112>,s}
+// id 797
+sphere{<-8.76408,-1.80229,-0.738264>,s}
+// id 1837
+sphere{<-9.7439,-2.18567,-0.920212>,s}
+// id 1482
+sphere{<-8.20599,-2.26688,-0.0345694>,s}
+// id 1113
+sphere{<-8.24243,-1.22607,0.0929066>,s}
+// id 1766
+sphere{<-8.21594,-0.947776,-0.891357>,s}
+// id 2341
+sphere{<-9.69778,-1.89049,0.978075>,s}
+// id 1901
+sphere{<-9.99295,-2.16141,0.0536082>,s}
+// id 796
+sphere{<-9.11885,-1.69265,0.192834>,s}
+// id 238
+sphere{<-9.94833,-1.14146,0.371084>,s}
+// id 231
+sphere{<-10.0206,-1.26596,-0.617245>,s}
+// id 878
+sphere{<-9.0969,-0.879582,-0.404595>,s}
+// id 1860
+sphere{<-7.85134,-0.728918,0.86756>,s}
+// id 1590
+sphere{<-10.2089,-0.300074,-0.146312>,s}
+// id 1514
+sphere{<-9.59829,-0.446869,1.00083>,s}
+// id 1360
+sphere{<-8.77146,-0.451025,0.438689>,s}
+// id 484
+sphere{<-6.20258,-0.665114,1.13245>,s}
+// id 836
+sphere{<-6.01264,-0.1509,0.287469>,s}
+// id 2354
+sphere{<-7.56123,-0.0505411,-1.04433>,s}
+// id 1599
+sphere{<-6.06723,-1.66093,1.27369>,s}
+// id 2355
+sphere{<-6.18025,-1.30838,-1.32606>,s}
+// id 795
+sphere{<-5.77931,-1.76336,-0.497203>,s}
+// id 2219
+sphere{<-6.6923,-2.01247,-0.826138>,s}
+// id 361
+sphere{<-6.79611,-1.17096,-0.0476428>,s}
+// id 2076
+sphere{<-6.78186,-0.150023,-0.403656>,s}
+// id 1487
+sphere{<-7.5586,-1.62743,-0.513572>,s}
+// id 762
+sphere{<-5.9972,-0.771879,-0.502138>,s}
+// id 883
+sphere{<-5.88992,-1.26778,0.364525>,s}
+// id 1715
+sphere{<-6.94997,-1.30385,0.93334>,s}
+// id 560
+sphere{<-7.04187,-0.916885,-1.00045>,s}
+// id 1316
+sphere{<-7.31714,-2.04282,0.368513>,s}
+// id 723
+sphere{<-5.61107,-2.3718,0.701958>,s}
+// id 1413
+sphere{<-6.39603,-2.30709,0.0844374>,s}
+// id 1952
+sphere{<-7.71447,-0.401548,-0.114383>,s}
+// id 47
+sphere{<-6.96504,-0.372888,0.554547>,s}
+// id 1351
+sphere{<5.68762,-2.47949,1.04916>,s}
+// id 2092
+sphere{<6.06726,-0.924926,0.890432>,s}
+// id 2116
+sphere{<6.98658,-1.33745,1.06104>,s}
+// id 1381
+sphere{<7.48328,-2.18352,0.526226>,s}
+// id 546
+sphere{<5.56329,-2.58617,0.0324992>,s}
+// id 37
+sphere{<6.56782,-2.28635,-0.520291>,s}
+// id 1756
+sphere{<6.18805,-0.211249,-1.04181>,s}
+// id 106
+sphere{<6.49256,-2.30516,0.477312>,s}
+// id 488
+sphere{<5.96544,-0.696224,-0.182043>,s}
+// id 1708
+sphere{<5.79148,-1.63039,0.232439>,s}
+// id 2197
+sphere{<7.42725,-1.79963,-0.672427>,s}
+// id 1175
+sphere{<7.61842,-0.899464,-0.27786>,s}
+// id 1864
+sphere{<6.7915,-1.33547,0.0802482>,s}
+// id 1564
+sphere{<7.57851,-0.622399,0.683084>,s}
+// id 668
+sphere{<6.86496,-0.325137,0.0493247>,s}
+// id 20
+sphere{<5.72503,-2.48096,-1.02234>,s}
+// id 1861
+sphere{<5.90833,-1.53282,-0.761594>,s}
+// id 58
+sphere{<6.75773,-1.0171,-0.880272>,s}
+// id 777
+sphere{<6.76583,-0.250742,1.12596>,s}
+// id 1749
+sphere{<8.04865,-0.37218,-1.01049>,s}
+// id 835
+sphere{<9.03767,-0.756071,1.19187>,s}
+// id 554
+sphere{<8.28012,-2.52788,1.15891>,s}
+// id 1892
+sphere{<8.08091,-0.0289922,-0.0434227>,s}
+// id 1565
+sphere{<9.6976,-2.37996,1.08496>,s}
+// id 504
+sphere{<8.91839,-1.75885,1.21851>,s}
+// id 1421
+sphere{<7.97614,-1.47415,1.03576>,s}
+// id 2284
+sphere{<8.33567,-1.83045,0.145114>,s}
+// id 1631
+sphere{<8.48563,-0.860355,0.34035>,s}
+// id 832
+sphere{<9.28502,-1.6353,-0.0981382>,s}
+// id 1747
+sphere{<9.04083,-2.52143,0.334998>,s}
+// id 208
+sphere{<10.0632,-2.20431,0.170728>,s}
+// id 1893
+sphere{<9.45848,-0.689745,0.197264>,s}
+// id 1339
+sphere{<9.77166,-1.40716,0.837457>,s}
+// id 634
+sphere{<10.0431,-0.236986,0.875727>,s}
+// id 1026
+sphere{<10.2879,-0.223988,-0.108455>,s}
+// id 487
+sphere{<10.2638,-1.24419,-0.0187693>,s}
+// id 1390
+sphere{<8.71656,-2.36346,-0.627205>,s}
+// id 827
+sphere{<9.08251,-1.71267,-1.29329>,s}
+// id 2306
+sphere{<9.96525,-1.89702,-0.784112>,s}
+// id 646
+sphere{<8.92297,-0.249372,-0.534769>,s}
+// id 13
+sphere{<8.51525,-1.20371,-0.620834>,s}
+// id 1102
+sphere{<9.61109,-0.950639,-0.758859>,s}
+// id 1964
+sphere{<10.9451,-0.477945,1.24399>,s}
+// id 1069
+sphere{<10.6748,-2.58018,0.968912>,s}
+// id 2216
+sphere{<11.0304,-1.97827,0.0636138>,s}
+// id 759
+sphere{<10.7712,-1.56244,0.936716>,s}
+// id 1680
+sphere{<11.8575,-1.538,0.419911>,s}
+// id 1957
+sphere{<11.6421,-2.4799,0.679379>,s}
+// id 2121
+sphere{<11.1192,-0.846033,0.330339>,s}
+// id 1130
+sphere{<11.9543,-0.773065,-0.21425>,s}
+// id 2194
+sphere{<11.8646,-0.366139,0.846919>,s}
+// id 2037
+sphere{<10.828,-2.41623,-0.817447>,s}
+// id 17
+sphere{<11.77,-1.72531,-0.558876>,s}
+// id 749
+sphere{<10.5582,-0.493414,-1.23866>,s}
+// id 2315
+sphere{<11.2069,-0.174755,-0.499322>,s}
+// id 2331
+sphere{<10.8561,-1.36512,-0.815969>,s}
+// id 2147
+sphere{<11.6961,-0.929167,-1.17664>,s}
+// id 652
+sphere{<-11.6549,0.550002,-1.3294>,s}
+// id 16
+sphere{<-10.9177,0.0757261,-0.830842>,s}
+// id 764
+sphere{<-11.9542,0.414553,-0.373248>,s}
+// id 476
+sphere{<-11.8427,0.615604,0.600252>,s}
+// id 1469
+sphere{<-11.1001,0.0429144,0.224498>,s}
+// id 1045
+sphere{<-11.8954,1.46594,0.0736289>,s}
+// id 1423
+sphere{<-11.7423,1.4583,-0.915828>,s}
+// id 1218
+sphere{<-10.5394,0.131264,1.21889>,s}
+// id 483
+sphere{<-10.7484,0.908174,0.610767>,s}
+// id 1378
+sphere{<-11.6384,2.41802,0.630774>,s}
+// id 2021
+sphere{<-11.5008,1.48078,1.01971>,s}
+// id 1566
+sphere{<-10.4531,1.82067,0.989723>,s}
+// id 1904
+sphere{<-10.9208,1.82702,0.104064>,s}
+// id 2000
+sphere{<-11.0973,0.930296,-0.33502>,s}
+// id 501
+sphere{<-11.7186,2.39233,-0.377076>,s}
+// id 385
+sphere{<-10.6443,1.08575,-1.219>,s}
+// id 1209
+sphere{<-10.9312,2.04898,-0.894514>,s}
+// id 1363
+sphere{<-8.69283,2.11191,1.23146>,s}
+// id 2042
+sphere{<-9.0357,0.911403,0.263843>,s}
+// id 1110
+sphere{<-9.88889,0.401111,0.501111>,s}
+// id 69
+sphere{<-9.12316,0.468338,1.15872>,s}
+// id 2230
+sphere{<-8.3259,0.403557,-0.261368>,s}
+// id 1889
+sphere{<-8.12438,0.245642,0.778822>,s}
+// id 114
+sphere{<-9.43365,1.42581,1.10963>,s}
+// id 491
+sphere{<-9.07677,1.92497,0.284688>,s}
+// id 2202
+sphere{<-9.94303,1.39023,0.238293>,s}
+// id 1744
+sphere{<-9.65503,2.41699,1.09858>,s}
+// id 2005
+sphere{<-9.94756,2.40454,0.142395>,s}
+// id 2165
+sphere{<-8.28179,1.49553,-0.21194>,s}
+// id 773
+sphere{<-8.37984,1.16084,1.09264>,s}
+// id 1468
+sphere{<-8.25141,2.48718,-0.0113219>,s}
+// id 2385
+sphere{<-10.1278,0.686935,-0.453842>,s}
+// id 1583
+sphere{<-9.28934,0.139639,-0.390951>,s}
+// id 1596
+sphere{<-9.55447,0.574324,-1.26555>,s}
+// id 1776
+sphere{<-8.48233,0.743499,-1.19447>,s}
+// id 1671
+sphere{<-9.14546,1.2709,-0.663512>,s}
+// id 57
+sphere{<-9.97748,1.826,-0.672717>,s}
+// id 104
+sphere{<-8.1394,1.68809,-1.18715>,s}
+// id 182
+sphere{<-5.83943,2.33961,-1.19293>,s}
+// id 1031
+sphere{<-6.13563,1.33781,-1.2073>,s}
+// id 928
+sphere{<-6.76295,0.560905,-1.11039>,s}
+// id 1966
+sphere{<-6.01945,0.550596,-0.425201>,s}
+// id 2337
+sphere{<-6.04569,1.79326,1.28172>,s}
+// id 1519
+sphere{<-7.21634,0.420324,1.1629>,s}
+// id 1968
+sphere{<-6.21268,0.377299,1.12285>,s}
+// id 2027
+sphere{<-6.73896,0.572954,0.291763>,s}
+// id 374
+sphere{<-7.73778,1.9189,0.895168>,s}
+// id 694
+sphere{<-7.63112,1.01714,0.37728>,s}
+// id 1103
+sphere{<-7.40538,1.95032,-0.0509096>,s}
+// id 1324
+sphere{<-6.47746,2.00823,0.326155>,s}
+// id 1888
+sphere{<-6.88243,1.34502,0.955835>,s}
+// id 1653
+sphere{<-6.85422,2.4019,1.16832>,s}
+// id 1118
+sphere{<-5.95037,1.17261,0.478621>,s}
+// id 172
+sphere{<-5.59736,2.39221,0.612088>,s}
+// id 1141
+sphere{<-7.5784,0.933809,-0.660061>,s}
+// id 1685
+sphere{<-6.65435,2.29504,-0.618667>,s}
+// id 1704
+sphere{<-7.10053,1.60074,-1.25043>,s}
+// id 547
+sphere{<-5.78656,1.73327,-0.349626>,s}
+// id 2245
+sphere{<-6.69987,1.31788,-0.37725>,s}
+// id 452
+sphere{<7.45299,0.374092,0.634363>,s}
+// id 282
+sphere{<7.34902,0.26028,-0.664>,s}
+// id 363
+sphere{<6.11719,1.58277,1.27951>,s}
+// id 1551
+sphere{<6.28142,0.596969,1.32687>,s}
+// id 2371
+sphere{<6.99777,1.15398,-0.943538>,s}
+// id 1728
+sphere{<6.07073,0.763542,-0.835366>,s}
+// id 164
+sphere{<6.04586,0.0779847,0.491946>,s}
+// id 1793
+sphere{<7.51557,1.17864,-0.0844397>,s}
+// id 1486
+sphere{<6.66735,0.649884,-0.0432066>,s}
+// id 426
+sphere{<6.88916,1.18728,0.773077>,s}
+// id 2266
+sphere{<5.91972,1.15978,0.380438>,s}
+// id 1415
+sphere{<5.75434,2.50799,1.17691>,s}
+// id 1106
+sphere{<7.58496,2.51647,0.932957>,s}
+// id 1359
+sphere{<5.83383,1.72989,-0.648162>,s}
+// id 1673
+sphere{<5.63588,2.1124,0.262744>,s}
+// id 650
+sphere{<6.80003,1.90201,-0.299192>,s}
+// id 275
+sphere{<7.79238,2.13874,-0.0158769>,s}
+// id 1301
+sphere{<6.64387,2.16421,0.658487>,s}
+// id 2241
+sphere{<6.36551,2.54874,-0.927428>,s}
+// id 2166
+sphere{<10.2154,0.696127,-0.593318>,s}
+// id 392
+sphere{<9.22085,0.774997,-0.664721>,s}
+// id 1761
+sphere{<9.8441,1.24372,1.10311>,s}
+// id 34
+sphere{<8.74039,1.18644,1.24265>,s}
+// id 163
+sphere{<8.41543,0.840743,0.331661>,s}
+// id 2342
+sphere{<8.46861,0.024982,0.910897>,s}
+// id 1978
+sphere{<9.26601,0.31573,0.247061>,s}
+// id 287
+sphere{<9.34313,0.38449,1.24817>,s}
+// id 220
+sphere{<9.44385,2.1422,0.924785>,s}
+// id 993
+sphere{<8.21818,0.76642,-0.671757>,s}
+// id 2307
+sphere{<9.37989,2.51511,-0.994663>,s}
+// id 1790
+sphere{<9.3156,2.50902,0.00353034>,s}
+// id 1665
+sphere{<10.2231,2.45192,-0.431412>,s}
+// id 1750
+sphere{<8.82384,1.70941,-0.658881>,s}
+// id 1310
+sphere{<9.68817,0.0151361,-1.12152>,s}
+// id 82
+sphere{<9.80864,1.59922,-0.809399>,s}
+// id 27
+sphere{<10.2132,0.630791,0.407042>,s}
+// id 1338
+sphere{<10.3589,2.33147,0.552535>,s}
+// id 2174
+sphere{<9.50889,1.28901,0.148636>,s}
+// id 335
+sphere{<8.49396,2.15792,1.2463>,s}
+// id 1831
+sphere{<7.82944,1.54774,0.791017>,s}
+// id 55
+sphere{<8.67643,1.8116,0.324527>,s}
+// id 1123
+sphere{<7.85365,1.6739,-0.899544>,s}
+// id 1418
+sphere{<10.6492,0.606624,1.30675>,s}
+// id 613
+sphere{<11.8653,0.806515,0.795673>,s}
+// id 2346
+sphere{<11.5416,2.08828,-1.11932>,s}
+// id 2278
+sphere{<11.1694,2.25428,-0.0424973>,s}
+// id 2323
+sphere{<10.8163,1.49879,0.882168>,s}
+// id 1284
+sphere{<11.7601,1.80825,0.734561>,s}
+// id 1081
+sphere{<10.468,1.53546,-0.0544669>,s}
+// id 1628
+sphere{<11.0983,0.175246,0.503788>,s}
+// id 1424
+sphere{<11.1781,0.851289,-0.227646>,s}
+// id 641
+sphere{<11.9891,0.205541,0.001086>,s}
+// id 744
+sphere{<11.8722,1.58197,-0.318935>,s}
+// id 2365
+sphere{<10.7936,1.42265,-0.997554>,s}
+// id 757
+sphere{<11.818,0.524503,-0.933878>,s}
+// id 383
+sphere{<-10.8563,4.63592,-0.445119>,s}
+// id 1439
+sphere{<-11.2863,2.94724,-1.1542>,s}
+// id 1841
+sphere{<-10.7302,3.86112,1.26408>,s}
+// id 2153
+sphere{<-11.3657,3.39935,0.535729>,s}
+// id 1100
+sphere{<-10.7831,2.80593,-0.236928>,s}
+// id 2046
+sphere{<-10.616,2.78701,0.787415>,s}
+// id 989
+sphere{<-10.4116,3.75389,0.312694>,s}
+// id 999
+sphere{<-10.7953,4.64504,0.56816>,s}
+// id 1434
+sphere{<-11.2122,3.70095,-0.441871>,s}
+// id 699
+sphere{<-10.2982,4.65934,-1.28437>,s}
+// id 1132
+sphere{<-8.9057,2.91477,0.625651>,s}
+// id 1420
+sphere{<-9.0028,3.91377,0.784004>,s}
+// id 833
+sphere{<-9.56346,3.32746,-0.00495006>,s}
+// id 1405
+sphere{<-9.8516,3.40729,1.06612>,s}
+// id 1863
+sphere{<-8.57833,3.42608,-0.213082>,s}
+// id 1813
+sphere{<-8.02695,2.91905,1.14006>,s}
+// id 247
+sphere{<-8.65229,4.86001,0.927238>,s}
+// id 837
+sphere{<-9.10135,4.29293,-0.197083>,s}
+// id 467
+sphere{<-9.95258,4.78106,-0.00330461>,s}
+// id 81
+sphere{<-9.8699,4.40877,0.95578>,s}
+// id 1610
+sphere{<-8.19529,4.27966,0.226028>,s}
+// id 1442
+sphere{<-8.08293,3.98211,1.1891>,s}
+// id 1509
+sphere{<-10.1271,3.01796,-1.09556>,s}
+// id 1120
+sphere{<-9.29925,2.60536,-0.6527>,s}
+// id 1716
+sphere{<-9.21774,3.57388,-0.97463>,s}
+// id 1391
+sphere{<-10.086,3.92109,-0.620171>,s}
+// id 700
+sphere{<-8.16281,3.6697,-1.09281>,s}
+// id 622
+sphere{<-8.45264,2.71439,-1.20099>,s}
+// id 218
+sphere{<-9.31905,4.73245,-1.06907>,s}
+// id 56
+sphere{<-8.2986,4.63559,-0.788149>,s}
+// id 1593
+sphere{<-5.67913,4.14211,-0.620275>,s}
+// id 141
+sphere{<-6.28408,3.22076,-0.721388>,s}
+// id 1166
+sphere{<-5.3768,3.23898,-1.16447>,s}
+// id 494
+sphere{<-5.48771,4.40203,0.504701>,s}
+// id 161
+sphere{<-7.57225,2.68446,-0.72186>,s}
+// id 513
+sphere{<-7.1944,3.62041,-0.846904>,s}
+// id 2006
+sphere{<-5.42928,2.67553,-0.336543>,s}
+// id 815
+sphere{<-7.7265,4.94379,1.32502>,s}
+// id 1334
+sphere{<-7.67492,3.38334,0.226883>,s}
+// id 230
+sphere{<-7.10764,3.40171,1.0554>,s}
+// id 103
+sphere{<-6.14002,3.10019,1.09074>,s}
+// id 1950
+sphere{<-6.75855,2.98051,0.159692>,s}
+// id 319
+sphere{<-5.83567,3.48704,0.145143>,s}
+// id 1784
+sphere{<-7.28293,4.3165,0.682637>,s}
+// id 1623
+sphere{<-6.66312,4.01302,-0.0549675>,s}
+// id 216
+sphere{<-7.43365,4.53746,-1.28136>,s}
+// id 1873
+sphere{<-6.33755,4.06753,0.915266>,s}
+// id 2113
+sphere{<-6.73539,5.01272,1.21152>,s}
+// id 449
+sphere{<-7.40158,4.65421,-0.27525>,s}
+// id 451
+sphere{<-6.29562,5.03762,0.305039>,s}
+// id 823
+sphere{<-5.40811,5.05469,-0.249083>,s}
+// id 1611
+sphere{<-6.50387,4.83181,-0.688458>,s}
+// id 2335
+sphere{<-3.20275,5.11054,-0.306236>,s}
+// id 1466
+sphere{<-4.93684,3.55138,-0.3017>,s}
+// id 520
+sphere{<-5.18505,3.32732,0.889451>,s}
+// id 1730
+sphere{<-3.7798,5.03374,-1.16822>,s}
+// id 962
+sphere{<-4.26903,4.35283,-0.432134>,s}
+// id 1297
+sphere{<-4.54849,4.03696,0.520154>,s}
+// id 493
+sphere{<-3.80116,4.68929,0.386345>,s}
+// id 2069
+sphere{<-4.85108,4.10355,-1.23317>,s}
+// id 1541
+sphere{<-4.72719,5.05421,0.484545>,s}
+// id 414
+sphere{<-4.81528,5.11224,-1.06952>,s}
+// id 465
+sphere{<4.25573,4.25696,-0.27503>,s}
+// id 144
+sphere{<4.66609,3.86639,0.569751>,s}
+// id 2212
+sphere{<3.99577,4.62129,0.625468>,s}
+// id 1556
+sphere{<4.90802,3.49341,-0.328144>,s}
+// id 1844
+sphere{<3.33603,4.99693,-0.0726821>,s}
+// id 776
+sphere{<4.99247,4.82712,0.539795>,s}
+// id 2279
+sphere{<4.42676,4.55336,-1.23478>,s}
+// id 421
+sphere{<5.04716,3.77077,-1.27886>,s}
+// id 442
+sphere{<3.57184,5.05922,-1.04355>,s}
+// id 525
+sphere{<5.76015,4.41168,1.0778>,s}
+// id 1417
+sphere{<6.05766,3.47367,0.897152>,s}
+// id 1775
+sphere{<7.40468,3.50974,0.87458>,s}
+// id 1527
+sphere{<6.73743,4.2072,1.14857>,s}
+// id 2048
+sphere{<7.26496,5.05376,1.27242>,s}
+// id 186
+sphere{<6.17003,2.94726,0.0540355>,s}
+// id 684
+sphere{<5.24477,3.01718,0.482727>,s}
+// id 558
+sphere{<5.43478,2.67798,-0.571979>,s}
+// id 427
+sphere{<7.52599,2.69549,-0.803767>,s}
+// id 967
+sphere{<7.16824,2.91021,0.109798>,s}
+// id 2281
+sphere{<5.84456,3.58788,-0.673724>,s}
+// id 2357
+sphere{<6.25088,4.47888,-0.445835>,s}
+// id 1985
+sphere{<5.56374,4.07256,0.156879>,s}
+// id 25
+sphere{<6.82812,3.40627,-0.696357>,s}
+// id 2359
+sphere{<7.39143,4.48796,0.43216>,s}
+// id 1136
+sphere{<6.67232,3.83521,0.193767>,s}
+// id 691
+sphere{<7.23242,4.30762,-0.538973>,s}
+// id 1603
+sphere{<5.5985,5.18859,-0.169023>,s}
+// id 847
+sphere{<6.45568,4.88083,0.456883>,s}
+// id 1431
+sphere{<5.43615,4.65861,-1.01126>,s}
+// id 1385
+sphere{<6.63279,5.06176,-1.20139>,s}
+// id 617
+sphere{<7.61546,4.86992,-1.27499>,s}
+// id 970
+sphere{<9.97334,4.13348,-1.20954>,s}
+// id 1503
+sphere{<9.07924,3.04495,1.15074>,s}
+// id 1969
+sphere{<9.86207,5.09688,0.213259>,s}
+// id 1674
+sphere{<9.79508,3.24564,0.481822>,s}
+// id 2382
+sphere{<9.67478,3.37704,-0.537459>,s}
+// id 1561
+sphere{<10.2019,4.1987,-0.226481>,s}
+// id 337
+sphere{<10.2837,4.05358,0.819291>,s}
+// id 1188
+sphere{<8.24312,5.16584,1.08949>,s}
+// id 390
+sphere{<9.23727,4.98176,0.995924>,s}
+// id 1534
+sphere{<8.48993,2.64585,-0.543904>,s}
+// id 871
+sphere{<8.41931,2.77768,0.446667>,s}
+// id 1560
+sphere{<7.81441,3.6692,-0.0238086>,s}
+// id 153
+sphere{<8.80436,3.54233,-0.0721475>,s}
+// id 730
+sphere{<8.19025,4.58235,-0.452249>,s}
+// id 1460
+sphere{<8.39713,4.31192,0.488169>,s}
+// id 1275
+sphere{<9.1404,4.2895,-0.666027>,s}
+// id 2030
+sphere{<9.3996,4.20946,0.378703>,s}
+// id 1212
+sphere{<8.88878,5.19088,-0.0452337>,s}
+// id 1222
+sphere{<9.80285,5.02914,-0.788282>,s}
+// id 1020
+sphere{<7.80971,3.62781,-1.02755>,s}
+// id 251
+sphere{<8.81336,3.43453,-1.06887>,s}
+// id 898
+sphere{<10.7276,2.9834,1.21766>,s}
+// id 2333
+sphere{<11.5585,2.8186,0.686277>,s}
+// id 555
+sphere{<11.2498,3.77065,0.821885>,s}
+// id 649
+sphere{<11.5194,3.0923,-0.48529>,s}
+// id 2127
+sphere{<10.7207,3.17291,0.111199>,s}
+// id 1198
+sphere{<11.2058,4.05039,-0.18553>,s}
+// id 611
+sphere{<10.8102,5.00265,-0.658263>,s}
+// id 1042
+sphere{<10.833,4.79761,0.370516>,s}
+// id 623
+sphere{<10.9769,4.16561,-1.19068>,s}
+// id 1202
+sphere{<10.6099,3.28077,-0.879319>,s}
+// id 659
+sphere{<-10.4296,5.62091,0.310372>,s}
+// id 1304
+sphere{<-9.44477,5.39564,0.620508>,s}
+// id 1162
+sphere{<-10.3915,5.27441,1.28032>,s}
+// id 1425
+sphere{<-9.66176,6.35154,-1.11457>,s}
+// id 1580
+sphere{<-9.96785,6.31128,0.892152>,s}
+// id 580
+sphere{<-9.82297,6.30492,-0.105142>,s}
+// id 1250
+sphere{<-9.25583,5.47652,-0.397535>,s}
+// id 89
+sphere{<-9.33017,7.02181,1.24658>,s}
+// id 1652
+sphere{<-10.2533,5.48699,-0.673676>,s}
+// id 1574
+sphere{<-8.32267,7.08341,1.20328>,s}
+// id 2220
+sphere{<-8.06871,5.78814,0.808793>,s}
+// id 2265
+sphere{<-8.34604,5.2523,0.00121411>,s}
+// id 95
+sphere{<-8.94368,6.26321,0.717755>,s}
+// id 244
+sphere{<-9.47107,7.20581,0.252929>,s}
+// id 1891
+sphere{<-8.33806,6.90384,0.154499>,s}
+// id 243
+sphere{<-8.51714,6.16408,-0.505304>,s}
+// id 1262
+sphere{<-7.97831,7.37061,-0.698075>,s}
+// id 1649
+sphere{<-9.04578,7.02166,-0.634167>,s}
+// id 568
+sphere{<-7.21296,5.89656,1.31852>,s}
+// id 364
+sphere{<-5.30806,5.62608,1.065>,s}
+// id 766
+sphere{<-6.57223,6.85971,1.2917>,s}
+// id 1562
+sphere{<-5.63961,6.57032,1.07415>,s}
+// id 1908
+sphere{<-7.63613,6.20151,-0.00855684>,s}
+// id 1462
+sphere{<-7.23117,5.39238,0.428179>,s}
+// id 1374
+sphere{<-6.32548,5.87109,0.859863>,s}
+// id 360
+sphere{<-6.67976,5.91762,-0.228013>,s}
+// id 1477
+sphere{<-5.69995,5.95863,0.0846891>,s}
+// id 425
+sphere{<-7.74758,7.67293,0.496294>,s}
+// id 644
+sphere{<-6.32974,6.70819,0.296365>,s}
+// id 2140
+sphere{<-6.72401,7.57801,0.613287>,s}
+// id 553
+sphere{<-7.44984,6.76365,0.797815>,s}
+// id 1194
+sphere{<-7.19581,7.09738,-0.135868>,s}
+// id 1055
+sphere{<-5.23845,6.85393,0.204467>,s}
+// id 1692
+sphere{<-5.6698,7.53567,0.805724>,s}
+// id 2081
+sphere{<-5.90082,7.50742,-0.167975>,s}
+// id 1929
+sphere{<-7.69912,5.50215,-0.722476>,s}
+// id 1331
+sphere{<-6.8626,5.57232,-1.26528>,s}
+// id 582
+sphere{<-5.94564,5.64697,-0.856622>,s}
+// id 1518
+sphere{<-6.62766,7.24617,-0.946627>,s}
+// id 585
+sphere{<-7.22477,6.43779,-0.897621>,s}
+// id 603
+sphere{<-5.90225,6.62394,-0.636227>,s}
+// id 354
+sphere{<-5.71842,7.60839,-1.16126>,s}
+// id 1524
+sphere{<-2.64198,5.4345,0.467631>,s}
+// id 2008
+sphere{<-3.18132,5.44309,1.31795>,s}
+// id 1913
+sphere{<-2.86663,5.63449,-1.16456>,s}
+// id 1261
+sphere{<-2.63054,6.42905,0.370533>,s}
+// id 1975
+sphere{<-4.32488,5.80918,1.19854>,s}
+// id 1126
+sphere{<-4.79983,7.69054,1.28436>,s}
+// id 2304
+sphere{<-3.83871,7.38805,1.07>,s}
+// id 522
+sphere{<-3.49127,6.39322,1.31215>,s}
+// id 624
+sphere{<-4.60268,6.06972,0.261595>,s}
+// id 1937
+sphere{<-3.61469,5.67231,0.444134>,s}
+// id 1657
+sphere{<-4.19587,5.35295,-0.316688>,s}
+// id 145
+sphere{<-4.61887,6.7488,0.996477>,s}
+// id 2090
+sphere{<-3.31577,7.07182,-0.415043>,s}
+// id 265
+sphere{<-3.75322,6.66213,0.385796>,s}
+// id 771
+sphere{<-4.24695,7.5041,0.164985>,s}
+// id 2199
+sphere{<-2.93538,7.35624,0.590591>,s}
+// id 958
+sphere{<-5.03049,6.06067,-0.651483>,s}
+// id 1049
+sphere{<-3.44836,6.07308,-0.476667>,s}
+// id 786
+sphere{<-4.1817,5.95124,-1.17476>,s}
+// id 1684
+sphere{<-4.93575,7.40608,-0.573259>,s}
+// id 2120
+sphere{<-4.25523,6.67669,-0.479109>,s}
+// id 698
+sphere{<-2.12869,5.88003,1.20391>,s}
+// id 149
+sphere{<-1.42283,5.87294,0.486676>,s}
+// id 2034
+sphere{<-0.925783,6.24053,1.33085>,s}
+// id 1902
+sphere{<-0.476591,6.00497,0.176004>,s}
+// id 1998
+sphere{<-2.405,6.83777,1.25954>,s}
+// id 1697
+sphere{<-2.08335,5.67384,-0.337215>,s}
+// id 1498
+sphere{<-0.579457,6.78715,-0.455957>,s}
+// id 1955
+sphere{<-1.88599,7.3431,0.544763>,s}
+// id 2317
+sphere{<-0.931054,6.82767,0.520425>,s}
+// id 125
+sphere{<-1.87031,6.02935,-1.27579>,s}
+// id 1709
+sphere{<-1.14841,5.95175,-0.570135>,s}
+// id 647
+sphere{<-1.75705,6.6039,-0.118154>,s}
+// id 1725
+sphere{<-0.231532,7.72213,-0.412761>,s}
+// id 1818
+sphere{<-0.243912,7.16746,1.21249>,s}
+// id 2104
+sphere{<-1.18358,7.52658,-0.158763>,s}
+// id 1634
+sphere{<-1.55152,6.97737,-1.03056>,s}
+// id 1836
+sphere{<-2.55329,6.48898,-0.712092>,s}
+// id 1817
+sphere{<-2.35975,7.3956,-0.33469>,s}
+// id 1868
+sphere{<0.0606903,6.21568,1.08443>,s}
+// id 399
+sphere{<0.784725,7.12028,0.949425>,s}
+// id 35
+sphere{<1.04448,6.06163,0.901688>,s}
+// id 345
+sphere{<1.73311,6.78984,0.952664>,s}
+// id 1669
+sphere{<2.07514,5.79893,0.847654>,s}
+// id 296
+sphere{<1.98972,7.7513,0.80386>,s}
+// id 1109
+sphere{<2.45433,5.6525,-0.856499>,s}
+// id 1124
+sphere{<1.79681,5.75378,-0.108916>,s}
+// id 1488
+sphere{<0.0591758,6.86227,0.309649>,s}
+// id 128
+sphere{<0.0877094,6.14888,-0.840074>,s}
+// id 169
+sphere{<1.30717,6.63466,0.0609852>,s}
+// id 2001
+sphere{<1.2237,7.04129,-0.860789>,s}
+// id 396
+sphere{<0.516411,6.00864,0.0548249>,s}
+// id 45
+sphere{<1.09736,6.0528,-0.759432>,s}
+// id 2182
+sphere{<0.18529,7.11266,-1.0952>,s}
+// id 2327
+sphere{<2.08979,6.58372,-0.590354>,s}
+// id 2233
+sphere{<2.40907,7.03918,0.240616>,s}
+// id 1617
+sphere{<0.653087,7.62599,0.0448827>,s}
+// id 322
+sphere{<2.50358,7.69704,-0.591778>,s}
+// id 2367
+sphere{<1.63881,7.56382,-0.11458>,s}
+// id 1523
+sphere{<2.97826,5.37367,0.787806>,s}
+// id 2332
+sphere{<4.35737,7.4865,1.20837>,s}
+// id 1958
+sphere{<2.8553,6.4599,0.92253>,s}
+// id 188
+sphere{<3.78,6.13861,1.19026>,s}
+// id 1303
+sphere{<3.97292,7.4667,0.196544>,s}
+// id 1286
+sphere{<2.75917,6.0152,0.0238997>,s}
+// id 2193
+sphere{<3.38827,7.29652,1.05308>,s}
+// id 734
+sphere{<3.13971,6.93175,-0.491628>,s}
+// id 2129
+sphere{<4.63761,5.54301,1.16364>,s}
+// id 1885
+sphere{<4.6413,6.56998,0.912154>,s}
+// id 2094
+sphere{<4.60167,5.20044,-0.337178>,s}
+// id 358
+sphere{<4.01555,5.59926,0.372524>,s}
+// id 966
+sphere{<3.42627,5.99793,-0.727351>,s}
+// id 276
+sphere{<4.42649,6.13849,-0.641473>,s}
+// id 1739
+sphere{<5.02241,5.88889,0.281512>,s}
+// id 1253
+sphere{<4.74892,6.86671,-0.0369241>,s}
+// id 2017
+sphere{<4.66538,7.7129,-0.562839>,s}
+// id 239
+sphere{<3.63541,6.52878,0.277809>,s}
+// id 1794
+sphere{<4.82762,5.46961,-1.28985>,s}
+// id 420
+sphere{<4.03808,7.02009,-0.941464>,s}
+// id 681
+sphere{<5.02303,6.86221,-1.09715>,s}
+// id 2087
+sphere{<7.7763,7.36705,1.28598>,s}
+// id 88
+sphere{<5.36965,7.70487,1.30937>,s}
+// id 462
+sphere{<5.50412,6.04559,1.1465>,s}
+// id 867
+sphere{<6.34132,5.48959,1.27824>,s}
+// id 1096
+sphere{<6.38412,6.54989,1.04353>,s}
+// id 1601
+sphere{<6.3541,7.53403,0.862329>,s}
+// id 2358
+sphere{<6.06675,5.91821,0.330116>,s}
+// id 93
+sphere{<6.50699,6.10031,-0.56302>,s}
+// id 1572
+sphere{<7.01635,5.73785,0.581731>,s}
+// id 959
+sphere{<7.02038,5.27075,-0.302278>,s}
+// id 2264
+sphere{<7.4099,6.28608,-0.173373>,s}
+// id 1870
+sphere{<5.5637,6.3984,-0.394946>,s}
+// id 1812
+sphere{<5.5691,7.42575,-0.211542>,s}
+// id 865
+sphere{<5.53691,6.95207,0.673105>,s}
+// id 373
+sphere{<7.12378,7.3194,-0.315373>,s}
+// id 1362
+sphere{<6.33481,6.84673,0.0821272>,s}
+// id 984
+sphere{<7.20589,6.91827,0.59871>,s}
+// id 170
+sphere{<5.79897,5.59781,-1.06327>,s}
+// id 1052
+sphere{<7.39787,5.83967,-1.0698>,s}
+// id 1152
+sphere{<5.38117,7.7923,-1.25706>,s}
+// id 2207
+sphere{<5.99874,6.62158,-1.2708>,s}
+// id 1768
+sphere{<6.28465,7.51127,-0.907017>,s}
+// id 1160
+sphere{<6.99877,6.76018,-1.13568>,s}
+// id 1382
+sphere{<9.88689,6.68343,-0.602674>,s}
+// id 257
+sphere{<9.14471,7.71458,0.467273>,s}
+// id 1451
+sphere{<10.3777,5.71524,0.828517>,s}
+// id 1823
+sphere{<10.2073,5.88229,-1.12037>,s}
+// id 398
+sphere{<9.25554,7.35755,-1.01296>,s}
+// id 2204
+sphere{<9.71389,6.87133,0.585673>,s}
+// id 351
+sphere{<7.90161,6.18919,0.692268>,s}
+// id 479
+sphere{<8.84993,5.96213,0.941349>,s}
+// id 2079
+sphere{<8.51098,6.98516,0.722043>,s}
+// id 446
+sphere{<7.90716,5.32625,0.159458>,s}
+// id 320
+sphere{<8.46237,6.09622,-0.155746>,s}
+// id 1791
+sphere{<9.43388,6.02246,0.128583>,s}
+// id 1064
+sphere{<7.86371,7.61479,0.292828>,s}
+// id 628
+sphere{<8.07693,6.966,-0.477314>,s}
+// id 842
+sphere{<9.02739,6.9221,-0.139425>,s}
+// id 1806
+sphere{<8.34049,5.45809,-0.916164>,s}
+// id 2251
+sphere{<9.24707,5.87661,-0.842945>,s}
+// id 294
+sphere{<10.4083,5.9472,-0.143883>,s}
+// id 279
+sphere{<-8.14621,8.62496,0.571364>,s}
+// id 1090
+sphere{<-8.67998,7.99514,-0.328816>,s}
+// id 1024
+sphere{<-8.78638,7.84782,0.665235>,s}
+// id 197
+sphere{<-8.21366,8.3606,-1.15915>,s}
+// id 2296
+sphere{<-6.50114,8.27879,1.29349>,s}
+// id 1247
+sphere{<-7.71972,8.31396,-0.278504>,s}
+// id 983
+sphere{<-6.58397,9.11579,-0.0105534>,s}
+// id 1098
+sphere{<-6.77025,7.99749,-0.29645>,s}
+// id 2200
+sphere{<-7.14822,8.47976,0.531698>,s}
+// id 539
+sphere{<-6.10352,8.32679,0.374161>,s}
+// id 556
+sphere{<-5.97705,9.23487,0.775952>,s}
+// id 1379
+sphere{<-6.44305,10.0693,0.289309>,s}
+// id 142
+sphere{<-6.96793,9.43449,0.855446>,s}
+// id 1700
+sphere{<-7.57143,9.2777,0.069714>,s}
+// id 1916
+sphere{<-5.59479,10.3925,0.710741>,s}
+// id 588
+sphere{<-5.72321,9.49596,-0.38774>,s}
+// id 1940
+sphere{<-7.31163,7.93068,-1.20165>,s}
+// id 682
+sphere{<-7.56359,9.08027,-0.916128>,s}
+// id 1676
+sphere{<-6.6179,8.75256,-0.941993>,s}
+// id 1515
+sphere{<-5.75613,8.41561,-0.560297>,s}
+// id 405
+sphere{<-6.63934,9.86651,-0.669756>,s}
+// id 1539
+sphere{<-5.82677,10.1611,-1.21102>,s}
+// id 2320
+sphere{<-3.16544,9.86011,-0.473286>,s}
+// id 1154
+sphere{<-2.83689,9.61615,0.831976>,s}
+// id 1317
+sphere{<-3.13733,8.71908,1.15628>,s}
+// id 541
+sphere{<-4.08191,8.36998,1.11162>,s}
+// id 117
+sphere{<-4.9096,8.91156,-0.367278>,s}
+// id 1173
+sphere{<-5.13097,8.07624,0.143828>,s}
+// id 181
+sphere{<-5.03617,8.6321,0.968409>,s}
+// id 1558
+sphere{<-4.13905,8.50879,0.124664>,s}
+// id 2052
+sphere{<-3.20396,8.98868,0.143988>,s}
+// id 1493
+sphere{<-3.29334,8.01292,-0.0739396>,s}
+// id 1767
+sphere{<-4.83628,10.0447,-0.352361>,s}
+// id 2195
+sphere{<-5.06702,9.48285,0.443624>,s}
+// id 2085
+sphere{<-4.43673,10.2133,0.720058>,s}
+// id 209
+sphere{<-3.91231,9.34232,0.764818>,s}
+// id 1240
+sphere{<-4.04753,9.44457,-0.220421>,s}
+// id 2007
+sphere{<-4.94301,8.24006,-1.13493>,s}
+// id 2258
+sphere{<-4.06419,7.97913,-0.726068>,s}
+// id 1189
+sphere{<-3.20708,8.85216,-0.84845>,s}
+// id 1925
+sphere{<-4.18466,8.91623,-1.06389>,s}
+// id 1705
+sphere{<-3.06593,7.81008,-1.05887>,s}
+// id 1112
+sphere{<-5.0691,9.50153,-1.15964>,s}
+// id 763
+sphere{<-4.15095,9.91884,-1.11244>,s}
+// id 1484
+sphere{<-0.731345,8.44029,-0.897683>,s}
+// id 2252
+sphere{<-2.39786,8.39497,-0.325163>,s}
+// id 609
+sphere{<-2.37724,8.09034,0.992975>,s}
+// id 1302
+sphere{<-0.820161,7.83263,0.737425>,s}
+// id 2080
+sphere{<-2.39167,8.52886,-1.32882>,s}
+// id 2350
+sphere{<-1.62347,8.29193,0.329444>,s}
+// id 1815
+sphere{<-1.64407,8.024,-0.892622>,s}
+// id 367
+sphere{<-2.11417,9.01253,1.27676>,s}
+// id 2290
+sphere{<-1.79417,9.89628,0.850816>,s}
+// id 1722
+sphere{<-0.797733,9.95738,0.987873>,s}
+// id 502
+sphere{<-1.1951,9.04416,0.84983>,s}
+// id 527
+sphere{<-0.679022,8.60071,0.113937>,s}
+// id 366
+sphere{<-2.1453,9.14748,0.282747>,s}
+// id 1858
+sphere{<-1.41495,9.04184,-0.400542>,s}
+// id 524
+sphere{<-2.14051,9.99313,-0.253251>,s}
+// id 433
+sphere{<-0.219527,10.2125,0.210207>,s}
+// id 384
+sphere{<-1.16394,9.91072,0.0303939>,s}
+// id 1063
+sphere{<-0.601423,10.2737,-0.743071>,s}
+// id 2308
+sphere{<-0.194844,9.41502,-0.392845>,s}
+// id 1383
+sphere{<-0.11352,9.26155,0.605851>,s}
+// id 1954
+sphere{<-1.47346,9.84492,-0.995166>,s}
+// id 130
+sphere{<-2.44047,9.49278,-1.06668>,s}
+// id 1080
+sphere{<-0.602164,9.43892,-1.30824>,s}
+// id 587
+sphere{<0.158487,8.01226,0.825167>,s}
+// id 2137
+sphere{<1.12817,8.24475,0.676206>,s}
+// id 855
+sphere{<2.27108,9.50104,0.879716>,s}
+// id 1225
+sphere{<1.32582,9.44997,1.20169>,s}
+// id 829
+sphere{<1.87161,8.61695,1.29154>,s}
+// id 1729
+sphere{<1.63582,9.66456,-1.14352>,s}
+// id 1458
+sphere{<0.655667,7.97485,-0.907514>,s}
+// id 1343
+sphere{<0.779868,9.39739,-0.618135>,s}
+// id 297
+sphere{<0.860499,9.16162,0.359058>,s}
+// id 1661
+sphere{<0.276159,8.55728,-0.18578>,s}
+// id 2330
+sphere{<1.26467,8.47423,-0.296044>,s}
+// id 124
+sphere{<1.68032,9.37852,-0.178131>,s}
+// id 1905
+sphere{<2.2018,8.65371,-0.63257>,s}
+// id 938
+sphere{<2.26596,8.62692,0.371778>,s}
+// id 866
+sphere{<0.16806,8.81429,-1.14926>,s}
+// id 1157
+sphere{<2.41369,10.034,-0.0192234>,s}
+// id 1480
+sphere{<1.18124,8.78683,-1.30152>,s}
+// id 2126
+sphere{<1.64382,7.93168,-1.04619>,s}
+// id 2383
+sphere{<0.545273,9.97123,0.856977>,s}
+// id 540
+sphere{<0.726089,10.2553,-0.108792>,s}
+// id 1403
+sphere{<1.52978,10.1247,0.476149>,s}
+// id 589
+sphere{<0.256061,10.0239,-1.19342>,s}
+// id 740
+sphere{<2.82799,8.11099,1.20957>,s}
+// id 73
+sphere{<3.7607,8.20858,0.837576>,s}
+// id 195
+sphere{<2.91392,8.30032,-1.28265>,s}
+// id 1158
+sphere{<4.03307,10.3473,0.297758>,s}
+// id 87
+sphere{<3.6952,9.89089,1.26415>,s}
+// id 2073
+sphere{<3.22249,9.0233,1.10404>,s}
+// id 1675
+sphere{<4.13454,9.13801,0.670389>,s}
+// id 175
+sphere{<3.27501,9.69701,0.362967>,s}
+// id 921
+sphere{<4.69105,8.46016,1.15166>,s}
+// id 1251
+sphere{<3.01793,7.83218,0.264827>,s}
+// id 299
+sphere{<3.04473,9.58051,-0.650199>,s}
+// id 1337
+sphere{<3.20248,8.7082,-0.182497>,s}
+// id 9
+sphere{<3.5314,7.85155,-0.616648>,s}
+// id 2391
+sphere{<2.72004,10.349,1.16925>,s}
+// id 477
+sphere{<4.15622,8.41678,-0.0595995>,s}
+// id 683
+sphere{<5.0012,8.89397,0.206268>,s}
+// id 616
+sphere{<4.89175,7.80322,0.423577>,s}
+// id 2154
+sphere{<3.96026,9.371,-0.28597>,s}
+// id 1602
+sphere{<4.57666,10.117,-0.50532>,s}
+// id 1528
+sphere{<4.91562,9.89248,0.409406>,s}
+// id 1805
+sphere{<3.72446,8.86277,-1.11704>,s}
+// id 281
+sphere{<4.71915,8.66744,-0.876938>,s}
+// id 2044
+sphere{<4.91464,9.56722,-1.2712>,s}
+// id 2298
+sphere{<6.36705,9.86227,1.19788>,s}
+// id 370
+sphere{<7.19653,8.07394,0.880801>,s}
+// id 343
+sphere{<5.58978,8.39188,-0.46936>,s}
+// id 881
+sphere{<5.74239,8.32849,0.619172>,s}
+// id 1582
+sphere{<7.33946,8.38647,-0.0744992>,s}
+// id 499
+sphere{<6.60593,8.84375,0.624188>,s}
+// id 787
+sphere{<6.76669,9.75269,-0.869305>,s}
+// id 794
+sphere{<6.28813,9.08646,-0.295254>,s}
+// id 1743
+sphere{<6.19757,10.1509,-0.147026>,s}
+// id 461
+sphere{<5.41462,9.57734,-0.40255>,s}
+// id 2291
+sphere{<5.79415,9.42251,0.507822>,s}
+// id 2172
+sphere{<7.50576,9.33812,-0.339923>,s}
+// id 1219
+sphere{<6.94697,9.75262,0.379997>,s}
+// id 1180
+sphere{<7.64855,9.06796,0.613153>,s}
+// id 761
+sphere{<5.79944,9.0818,-1.17843>,s}
+// id 687
+sphere{<6.77502,8.4528,-0.897563>,s}
+// id 1983
+sphere{<5.90349,10.2015,-1.10457>,s}
+// id 1142
+sphere{<6.41771,7.99655,-0.0427021>,s}
+// id 1642
+sphere{<7.6264,7.91821,-0.937509>,s}
+// id 1500
+sphere{<8.61588,7.91258,1.29853>,s}
+// id 1313
+sphere{<8.61555,7.80162,-0.375363>,s}
+// id 2277
+sphere{<8.41604,8.45465,0.3701>,s}
+// id 463
+sphere{<8.19489,8.6754,-0.624667>,s}
+// id 60
+sphere{<-5.73125,10.4976,-0.275314>,s}
+// id 927
+sphere{<-3.6421,10.7968,-1.05652>,s}
+// id 252
+sphere{<-4.60314,10.9381,-0.784892>,s}
+// id 715
+sphere{<-3.1202,11.4229,0.809206>,s}
+// id 1032
+sphere{<-3.38744,10.4389,0.690534>,s}
+// id 1938
+sphere{<-2.90895,11.4637,-0.908871>,s}
+// id 2227
+sphere{<-4.08589,11.154,0.682662>,s}
+// id 1876
+sphere{<-2.87223,10.7488,-0.12087>,s}
+// id 2192
+sphere{<-3.65439,11.4011,-0.195414>,s}
+// id 305
+sphere{<-3.93558,10.4401,-0.149811>,s}
+// id 1155
+sphere{<-4.91392,10.8976,0.165807>,s}
+// id 480
+sphere{<-1.41855,10.8212,0.749254>,s}
+// id 1161
+sphere{<-2.41609,10.6967,0.82133>,s}
+// id 1972
+sphere{<-2.03545,11.6325,0.99129>,s}
+// id 863
+sphere{<-1.01351,11.7896,0.931081>,s}
+// id 227
+sphere{<-0.374976,10.9863,0.824507>,s}
+// id 1041
+sphere{<-2.5483,11.689,0.0114974>,s}
+// id 2173
+sphere{<-1.56476,11.8686,0.0949302>,s}
+// id 1971
+sphere{<-1.88282,10.9558,-0.169321>,s}
+// id 1104
+sphere{<-0.458168,11.9245,0.050264>,s}
+// id 115
+sphere{<-0.882887,10.9935,-0.103686>,s}
+// id 2057
+sphere{<-1.42446,10.8519,-1.08015>,s}
+// id 1895
+sphere{<-1.90256,11.7002,-0.846893>,s}
+// id 1525
+sphere{<-2.46694,10.5352,-1.05497>,s}
+// id 1796
+sphere{<-0.85895,11.6687,-0.8982>,s}
+// id 1912
+sphere{<2.24658,11.6457,-0.902233>,s}
+// id 1741
+sphere{<1.65561,10.4644,-0.518178>,s}
+// id 1058
+sphere{<2.1125,10.9416,0.259292>,s}
+// id 712
+sphere{<0.174485,11.8456,0.889993>,s}
+// id 969
+sphere{<0.63385,10.9604,0.968111>,s}
+// id 1848
+sphere{<1.66002,10.7866,1.21439>,s}
+// id 581
+sphere{<1.18728,11.795,0.86237>,s}
+// id 528
+sphere{<2.16732,11.6301,0.983639>,s}
+// id 2058
+sphere{<0.138024,11.1152,-0.116542>,s}
+// id 1312
+sphere{<0.629933,11.984,-0.0183475>,s}
+// id 508
+sphere{<1.14465,11.1362,0.105951>,s}
+// id 2268
+sphere{<1.82946,11.8595,-0.0155052>,s}
+// id 1263
+sphere{<0.244052,11.7878,-0.919609>,s}
+// id 1128
+sphere{<1.2446,11.8121,-0.829303>,s}
+// id 1348
+sphere{<0.797518,10.9166,-0.866883>,s}
+// id 1694
+sphere{<4.95671,10.5972,1.3019>,s}
+// id 995
+sphere{<4.81844,10.9618,0.374056>,s}
+// id 1987
+sphere{<2.81388,11.6622,0.0946263>,s}
+// id 1288
+sphere{<4.05295,11.0163,1.21175>,s}
+// id 905
+sphere{<3.13561,11.3846,1.01481>,s}
+// id 697
+sphere{<2.66707,10.7782,-0.632824>,s}
+// id 516
+sphere{<3.08815,10.7131,0.276336>,s}
+// id 1489
+sphere{<3.62058,10.429,-0.624662>,s}
+// id 1648
+sphere{<3.46052,11.4179,-0.631591>,s}
+// id 750
+sphere{<3.86699,11.3455,0.278408>,s}
+// id 627
+sphere{<4.418,11.1039,-0.535335>,s}
+// id 1150
+sphere{<4.95221,10.6084,-1.2928>,s}
+// id 1808
+sphere{<5.73436,10.4506,0.684675>,s}
+// id 1
+sphere{<5.39229,10.6877,-0.396908>,s}
+// id 781
+sphere{<-2.98183,-10.5796,2.24335>,s}
+// id 1701
+sphere{<-3.51002,-11.1007,1.42227>,s}
+// id 94
+sphere{<-3.96031,-10.4655,2.04987>,s}
+// id 2300
+sphere{<-2.22896,-11.34,1.57513>,s}
+// id 1432
+sphere{<-1.8873,-10.7017,2.31215>,s}
+// id 1531
+sphere{<-1.66817,-10.5435,1.33447>,s}
+// id 1231
+sphere{<-0.889531,-10.7236,2.39495>,s}
+// id 2149
+sphere{<-0.226391,-10.902,1.4864>,s}
+// id 990
+sphere{<-1.24004,-11.3748,1.72034>,s}
+// id 1646
+sphere{<1.09538,-10.9135,2.19743>,s}
+// id 1199
+sphere{<1.54164,-11.5193,1.34014>,s}
+// id 886
+sphere{<0.12941,-10.7553,2.41071>,s}
+// id 108
+sphere{<2.08174,-10.9724,2.02286>,s}
+// id 136
+sphere{<3.519,-11.0337,1.43927>,s}
+// id 1371
+sphere{<-7.90924,-8.26861,1.73918>,s}
+// id 633
+sphere{<-6.8519,-9.1683,1.73708>,s}
+// id 1061
+sphere{<-5.93676,-9.71229,1.79833>,s}
+// id 1827
+sphere{<-6.06384,-8.8245,2.25296>,s}
+// id 1752
+sphere{<-7.07273,-8.35766,2.28068>,s}
+// id 408
+sphere{<-6.37913,-8.11831,1.60049>,s}
+// id 1662
+sphere{<-6.21866,-7.96463,2.74195>,s}
+// id 643
+sphere{<-5.31418,-8.46363,2.82031>,s}
+// id 2302
+sphere{<-5.3296,-8.89543,1.57291>,s}
+// id 615
+sphere{<-4.91424,-10.1853,1.91134>,s}
+// id 43
+sphere{<-5.16195,-9.38735,2.46092>,s}
+// id 217
+sphere{<-3.83667,-9.66755,2.64485>,s}
+// id 903
+sphere{<-2.84735,-9.73499,2.76783>,s}
+// id 591
+sphere{<-3.22378,-9.41092,1.89618>,s}
+// id 201
+sphere{<-4.64817,-8.23416,1.99909>,s}
+// id 250
+sphere{<-3.33874,-8.78378,2.92974>,s}
+// id 1208
+sphere{<-3.67422,-8.14058,2.21274>,s}
+// id 455
+sphere{<-4.44002,-7.86742,2.91154>,s}
+// id 1924
+sphere{<-4.25336,-9.14902,1.89488>,s}
+// id 2072
+sphere{<-4.39891,-8.86794,2.85592>,s}
+// id 54
+sphere{<-2.7452,-8.52324,2.15534>,s}
+// id 564
+sphere{<-2.77558,-7.87972,2.92153>,s}
+// id 2286
+sphere{<-2.92975,-7.89256,1.36408>,s}
+// id 1787
+sphere{<-0.335562,-9.96527,2.00466>,s}
+// id 657
+sphere{<-0.846715,-9.83527,2.85864>,s}
+// id 1839
+sphere{<-1.32228,-9.81949,1.93289>,s}
+// id 1882
+sphere{<-0.321583,-8.98996,2.99757>,s}
+// id 1770
+sphere{<-1.8479,-9.82784,2.82723>,s}
+// id 811
+sphere{<-1.33054,-8.96966,2.98928>,s}
+// id 1641
+sphere{<-0.801643,-8.98198,2.11966>,s}
+// id 2101
+sphere{<-2.32134,-9.84416,1.92345>,s}
+// id 703
+sphere{<-2.3313,-8.90648,2.98824>,s}
+// id 1084
+sphere{<-1.80215,-8.07363,2.79827>,s}
+// id 1944
+sphere{<-1.8058,-8.92994,2.05467>,s}
+// id 162
+sphere{<-1.25343,-8.09496,1.94636>,s}
+// id 464
+sphere{<-0.807162,-8.12452,2.88239>,s}
+// id 981
+sphere{<-0.351271,-8.29799,1.51569>,s}
+// id 2248
+sphere{<0.664308,-9.98861,1.89073>,s}
+// id 573
+sphere{<0.232936,-8.99645,2.15035>,s}
+// id 1300
+sphere{<0.163775,-9.85674,2.86424>,s}
+// id 1856
+sphere{<0.286314,-8.1949,2.88373>,s}
+// id 854
+sphere{<0.790578,-9.05331,2.99115>,s}
+// id 185
+sphere{<2.32173,-10.154,2.60869>,s}
+// id 710
+sphere{<1.15026,-10.0673,2.76996>,s}
+// id 807
+sphere{<2.2443,-9.24316,2.05191>,s}
+// id 1510
+sphere{<1.22337,-9.13248,2.06471>,s}
+// id 109
+sphere{<1.76695,-9.273,2.95422>,s}
+// id 822
+sphere{<0.835583,-8.20977,2.00662>,s}
+// id 86
+sphere{<1.84129,-8.32203,2.07376>,s}
+// id 563
+sphere{<2.26936,-8.39161,2.97813>,s}
+// id 1241
+sphere{<1.28725,-8.17292,2.90546>,s}
+// id 395
+sphere{<1.66129,-10.0606,1.81674>,s}
+// id 736
+sphere{<3.40283,-10.2226,2.38885>,s}
+// id 1190
+sphere{<2.77009,-9.28619,2.90151>,s}
+// id 663
+sphere{<3.24097,-9.22698,1.92123>,s}
+// id 954
+sphere{<3.75878,-9.3588,2.77061>,s}
+// id 456
+sphere{<5.12281,-8.74073,2.77731>,s}
+// id 1184
+sphere{<4.57937,-9.34254,2.19094>,s}
+// id 441
+sphere{<3.27106,-8.41962,2.99639>,s}
+// id 2201
+sphere{<3.42447,-8.14977,2.00532>,s}
+// id 578
+sphere{<4.18169,-8.47151,2.57998>,s}
+// id 2319
+sphere{<2.74477,-10.2854,1.62836>,s}
+// id 824
+sphere{<4.21122,-10.3933,1.81674>,s}
+// id 782
+sphere{<5.16862,-10.0858,1.87124>,s}
+// id 397
+sphere{<2.65287,-8.50968,1.46746>,s}
+// id 2033
+sphere{<4.27189,-8.46532,1.57392>,s}
+// id 669
+sphere{<5.72536,-9.33188,2.22973>,s}
+// id 1018
+sphere{<6.66406,-8.97928,2.00681>,s}
+// id 2020
+sphere{<5.30839,-7.96268,2.12165>,s}
+// id 116
+sphere{<6.99223,-8.12901,2.42569>,s}
+// id 817
+sphere{<6.06711,-8.45693,2.62134>,s}
+// id 2041
+sphere{<5.21633,-8.79404,1.5569>,s}
+// id 151
+sphere{<6.04956,-9.90849,1.42925>,s}
+// id 1587
+sphere{<6.24722,-8.07373,1.71153>,s}
+// id 422
+sphere{<7.87826,-8.08795,1.89031>,s}
+// id 1147
+sphere{<-9.69987,-5.94751,1.33788>,s}
+// id 670
+sphere{<-8.61947,-7.56523,1.70468>,s}
+// id 1211
+sphere{<-9.30392,-6.83264,1.59071>,s}
+// id 942
+sphere{<-8.01034,-7.20542,2.42756>,s}
+// id 920
+sphere{<-9.36444,-5.72525,2.25295>,s}
+// id 178
+sphere{<-8.52302,-5.51175,2.76967>,s}
+// id 813
+sphere{<-8.72751,-6.49191,2.33755>,s}
+// id 1589
+sphere{<-7.85912,-6.28236,2.80452>,s}
+// id 667
+sphere{<-7.9494,-6.85424,1.48923>,s}
+// id 1703
+sphere{<-7.86772,-5.66269,2.02116>,s}
+// id 1269
+sphere{<-8.70816,-6.04217,1.44087>,s}
+// id 2215
+sphere{<-6.55949,-5.27416,2.93713>,s}
+// id 1865
+sphere{<-7.20342,-6.60983,2.12403>,s}
+// id 1691
+sphere{<-7.23581,-7.53078,1.68174>,s}
+// id 225
+sphere{<-7.08384,-7.4517,2.70295>,s}
+// id 1980
+sphere{<-6.97064,-5.64722,1.57078>,s}
+// id 1169
+sphere{<-6.87839,-6.21976,2.98767>,s}
+// id 689
+sphere{<-7.56133,-5.34491,2.98756>,s}
+// id 348
+sphere{<-6.23669,-6.99237,2.97383>,s}
+// id 2032
+sphere{<-6.35036,-7.18842,1.99583>,s}
+// id 1407
+sphere{<-5.35603,-7.47096,2.97796>,s}
+// id 434
+sphere{<-5.52366,-7.75045,2.01115>,s}
+// id 131
+sphere{<-5.48714,-6.74268,2.30519>,s}
+// id 123
+sphere{<-6.2776,-6.19144,2.04142>,s}
+// id 801
+sphere{<-5.40772,-5.68103,1.8402>,s}
+// id 1845
+sphere{<-5.86272,-6.06822,2.94763>,s}
+// id 714
+sphere{<-5.64789,-6.52092,1.33743>,s}
+// id 1620
+sphere{<-4.68098,-6.377,1.83538>,s}
+// id 1365
+sphere{<-4.2296,-7.27263,2.08002>,s}
+// id 576
+sphere{<-4.60374,-6.80979,2.8845>,s}
+// id 1989
+sphere{<-3.7173,-6.38951,2.52928>,s}
+// id 419
+sphere{<-3.31104,-7.05302,1.75214>,s}
+// id 2106
+sphere{<-3.60317,-7.32261,2.86625>,s}
+// id 1760
+sphere{<-2.73631,-6.92571,2.56037>,s}
+// id 1394
+sphere{<-4.90329,-5.87903,2.68995>,s}
+// id 1773
+sphere{<-4.12123,-5.55065,2.15763>,s}
+// id 1121
+sphere{<-2.90988,-6.1111,2.00163>,s}
+// id 1857
+sphere{<-4.93859,-7.22851,1.38235>,s}
+// id 1540
+sphere{<-3.76531,-6.2025,1.48703>,s}
+// id 1014
+sphere{<-3.53908,-5.23748,1.35379>,s}
+// id 1366
+sphere{<-2.22766,-7.59677,2.01289>,s}
+// id 2102
+sphere{<-1.90769,-6.59671,2.1081>,s}
+// id 1951
+sphere{<-0.224595,-7.62234,2.24224>,s}
+// id 1461
+sphere{<-0.823258,-6.62995,1.89465>,s}
+// id 1502
+sphere{<-1.26858,-7.27236,2.51873>,s}
+// id 532
+sphere{<-1.49902,-7.21682,1.43903>,s}
+// id 1481
+sphere{<-2.14226,-5.95998,1.37426>,s}
+// id 804
+sphere{<0.733158,-7.36499,2.53733>,s}
+// id 1260
+sphere{<0.179999,-6.7454,1.98159>,s}
+// id 1258
+sphere{<0.756527,-7.36669,1.45288>,s}
+// id 800
+sphere{<1.73157,-7.32389,2.60533>,s}
+// id 690
+sphere{<2.47221,-6.7432,2.25911>,s}
+// id 2222
+sphere{<1.5472,-6.51485,1.92581>,s}
+// id 868
+sphere{<1.74576,-7.44132,1.60196>,s}
+// id 2324
+sphere{<3.46963,-7.05337,2.1292>,s}
+// id 1386
+sphere{<3.7684,-7.55047,2.94341>,s}
+// id 2053
+sphere{<2.79902,-7.62272,2.61209>,s}
+// id 180
+sphere{<4.3157,-7.6062,2.09651>,s}
+// id 1529
+sphere{<4.74604,-7.75793,2.99524>,s}
+// id 1048
+sphere{<3.22067,-6.08468,2.10581>,s}
+// id 1920
+sphere{<4.14624,-5.73902,2.28652>,s}
+// id 538
+sphere{<5.03497,-6.99006,2.4128>,s}
+// id 143
+sphere{<4.15191,-6.645,2.76071>,s}
+// id 1604
+sphere{<4.97133,-6.05311,2.75899>,s}
+// id 2112
+sphere{<2.74331,-7.52537,1.60852>,s}
+// id 262
+sphere{<4.96534,-5.77001,1.62077>,s}
+// id 1755
+sphere{<4.32224,-6.59406,1.77549>,s}
+// id 471
+sphere{<3.54473,-5.34285,1.51491>,s}
+// id 1738
+sphere{<7.73208,-5.41765,2.9637>,s}
+// id 308
+sphere{<6.44651,-5.28761,2.01888>,s}
+// id 460
+sphere{<5.84554,-5.5729,2.85196>,s}
+// id 355
+sphere{<6.68901,-6.09278,2.99908>,s}
+// id 196
+sphere{<7.34938,-5.77248,2.10903>,s}
+// id 6
+sphere{<7.62438,-6.40427,2.83464>,s}
+// id 533
+sphere{<7.61545,-7.35421,2.51709>,s}
+// id 997
+sphere{<5.9441,-7.17226,2.03923>,s}
+// id 2345
+sphere{<5.72772,-7.56482,2.94452>,s}
+// id 1246
+sphere{<6.67127,-7.23677,2.83862>,s}
+// id 2384
+sphere{<6.72545,-6.55255,2.1121>,s}
+// id 1762
+sphere{<5.84481,-6.08482,1.98739>,s}
+// id 722
+sphere{<5.81272,-6.56949,2.92713>,s}
+// id 2289
+sphere{<7.00881,-7.42302,1.71273>,s}
+// id 1826
+sphere{<5.26473,-6.71254,1.46375>,s}
+// id 1640
+sphere{<9.7302,-6.14014,1.60701>,s}
+// id 1224
+sphere{<8.52186,-6.04143,2.57922>,s}
+// id 1170
+sphere{<9.3191,-5.50998,2.29084>,s}
+// id 1323
+sphere{<8.20597,-5.2585,2.03971>,s}
+// id 2366
+sphere{<8.75158,-5.87981,1.47727>,s}
+// id 1909
+sphere{<8.0022,-6.63604,1.93624>,s}
+// id 152
+sphere{<8.99926,-6.70299,1.99294>,s}
+// id 215
+sphere{<8.68393,-7.56654,1.5994>,s}
+// id 919
+sphere{<-10.5057,-4.27044,1.8768>,s}
+// id 134
+sphere{<-11.2126,-2.89086,1.52905>,s}
+// id 190
+sphere{<-10.5515,-3.26623,2.18553>,s}
+// id 1647
+sphere{<-10.108,-5.18583,1.85086>,s}
+// id 2356
+sphere{<-7.99923,-3.49414,2.97911>,s}
+// id 758
+sphere{<-8.75192,-4.03916,2.09647>,s}
+// id 637
+sphere{<-9.47976,-4.46269,1.55699>,s}
+// id 729
+sphere{<-8.63585,-5.01661,1.90843>,s}
+// id 2254
+sphere{<-9.36718,-4.77221,2.56447>,s}
+// id 774
+sphere{<-8.46045,-4.52427,2.92148>,s}
+// id 2164
+sphere{<-9.76515,-2.90876,2.69858>,s}
+// id 2309
+sphere{<-9.83859,-3.89178,2.52123>,s}
+// id 44
+sphere{<-9.21475,-3.1733,1.90629>,s}
+// id 1934
+sphere{<-8.99782,-3.51268,2.91544>,s}
+// id 1563
+sphere{<-8.23109,-3.11806,2.07952>,s}
+// id 1706
+sphere{<-9.96257,-3.58743,1.38748>,s}
+// id 1777
+sphere{<-7.46137,-4.33741,2.97244>,s}
+// id 909
+sphere{<-7.75671,-4.12258,2.04117>,s}
+// id 696
+sphere{<-7.13555,-4.89077,2.20267>,s}
+// id 996
+sphere{<-7.75725,-4.88798,1.38823>,s}
+// id 910
+sphere{<-6.14571,-3.3834,2.2496>,s}
+// id 810
+sphere{<-6.78078,-4.03926,1.81674>,s}
+// id 2322
+sphere{<-7.01865,-3.44604,2.74313>,s}
+// id 2361
+sphere{<-6.48091,-4.29837,2.73476>,s}
+// id 1062
+sphere{<-7.2557,-3.15923,1.79442>,s}
+// id 922
+sphere{<-6.18522,-4.99301,1.85779>,s}
+// id 507
+sphere{<-5.60677,-5.14443,2.66091>,s}
+// id 51
+sphere{<-5.60225,-4.22746,2.2511>,s}
+// id 1550
+sphere{<-4.84144,-4.86985,2.07542>,s}
+// id 877
+sphere{<-4.95761,-4.05697,1.50486>,s}
+// id 2316
+sphere{<5.07587,-5.1293,2.39364>,s}
+// id 1874
+sphere{<4.39797,-4.8595,1.70965>,s}
+// id 204
+sphere{<6.75448,-5.09644,2.95349>,s}
+// id 731
+sphere{<5.92511,-4.60684,2.59182>,s}
+// id 1961
+sphere{<5.26016,-4.20017,1.94981>,s}
+// id 147
+sphere{<6.45292,-4.3499,1.65851>,s}
+// id 32
+sphere{<5.62279,-5.02334,1.51256>,s}
+// id 816
+sphere{<6.88174,-4.10561,2.83164>,s}
+// id 799
+sphere{<7.3382,-4.77737,2.20368>,s}
+// id 2267
+sphere{<7.36873,-3.92304,1.68424>,s}
+// id 2105
+sphere{<6.61403,-3.3218,1.41643>,s}
+// id 1429
+sphere{<5.55179,-3.31555,1.58089>,s}
+// id 2095
+sphere{<6.14266,-3.65832,2.31356>,s}
+// id 1869
+sphere{<6.9162,-3.10623,2.63291>,s}
+// id 2221
+sphere{<6.27675,-2.61493,2.03842>,s}
+// id 1127
+sphere{<7.6786,-3.02,1.98991>,s}
+// id 2218
+sphere{<7.81598,-3.4223,2.94027>,s}
+// id 1679
+sphere{<8.70498,-4.90355,2.83514>,s}
+// id 22
+sphere{<7.82807,-4.42055,3.00285>,s}
+// id 583
+sphere{<8.26593,-4.26146,2.11113>,s}
+// id 1446
+sphere{<8.68767,-3.91106,2.95669>,s}
+// id 2380
+sphere{<9.06902,-4.74377,1.68848>,s}
+// id 1028
+sphere{<9.42763,-3.821,1.84925>,s}
+// id 2025
+sphere{<9.58374,-4.52509,2.54366>,s}
+// id 1051
+sphere{<10.3119,-3.63847,2.28974>,s}
+// id 664
+sphere{<10.1825,-4.97639,1.88605>,s}
+// id 1091
+sphere{<8.61839,-3.32766,2.14313>,s}
+// id 189
+sphere{<8.6298,-2.80631,3.00843>,s}
+// id 166
+sphere{<9.50987,-2.82893,1.95229>,s}
+// id 1357
+sphere{<9.49909,-3.35777,2.80483>,s}
+// id 1727
+sphere{<10.3358,-2.65475,2.493>,s}
+// id 1763
+sphere{<10.1388,-3.33461,1.34767>,s}
+// id 1271
+sphere{<10.9797,-3.04551,1.80533>,s}
+// id 199
+sphere{<10.8564,-4.00573,1.54164>,s}
+// id 638
+sphere{<-11.0925,-0.144316,2.13476>,s}
+// id 1428
+sphere{<-10.8499,-2.20648,2.1662>,s}
+// id 1986
+sphere{<-10.5595,-1.53686,1.38019>,s}
+// id 1615
+sphere{<-11.481,-1.93567,1.39066>,s}
+// id 2372
+sphere{<-10.7148,-1.24526,2.40347>,s}
+// id 728
+sphere{<-11.3986,-0.995435,1.71168>,s}
+// id 1456
+sphere{<-10.2284,-0.664934,1.74566>,s}
+// id 1846
+sphere{<-10.0658,-1.94863,2.72577>,s}
+// id 1367
+sphere{<-7.89644,-2.18348,1.95337>,s}
+// id 2050
+sphere{<-8.11308,-1.70883,2.89276>,s}
+// id 904
+sphere{<-9.69422,-1.50662,1.90046>,s}
+// id 814
+sphere{<-9.97582,-2.52239,1.75706>,s}
+// id 2059
+sphere{<-8.54951,-1.34663,1.96572>,s}
+// id 1943
+sphere{<-9.86086,-0.977458,2.84795>,s}
+// id 333
+sphere{<-9.01488,-2.21697,2.13414>,s}
+// id 593
+sphere{<-8.59769,-0.793871,2.85427>,s}
+// id 1183
+sphere{<-8.6117,-2.57272,2.97852>,s}
+// id 2022
+sphere{<-9.13478,-1.66695,2.96117>,s}
+// id 1800
+sphere{<-9.30077,-0.0567947,2.95288>,s}
+// id 120
+sphere{<-9.26235,-0.63281,2.12417>,s}
+// id 2086
+sphere{<-10.2722,-0.0776003,2.70273>,s}
+// id 897
+sphere{<-8.59572,-0.355781,1.42454>,s}
+// id 557
+sphere{<-7.61437,-0.78287,2.62585>,s}
+// id 1292
+sphere{<-6.90476,-2.18788,1.47537>,s}
+// id 1010
+sphere{<-7.60616,-2.58191,2.82847>,s}
+// id 934
+sphere{<-5.99052,-2.5681,1.68459>,s}
+// id 1039
+sphere{<-6.70561,-2.56552,2.38359>,s}
+// id 2038
+sphere{<-7.58912,-1.24697,1.70022>,s}
+// id 1988
+sphere{<-7.18579,-1.69677,2.51554>,s}
+// id 270
+sphere{<-6.62006,-1.11806,1.92024>,s}
+// id 0
+sphere{<-7.66833,-0.238212,1.78075>,s}
+// id 1071
+sphere{<-6.67744,-0.117933,1.85991>,s}
+// id 1497
+sphere{<7.59102,-1.01775,1.84538>,s}
+// id 707
+sphere{<6.60192,-0.891464,1.87436>,s}
+// id 2055
+sphere{<6.86511,-1.76757,2.31114>,s}
+// id 133
+sphere{<7.54742,-0.372238,2.62472>,s}
+// id 1798
+sphere{<6.97986,-2.34591,1.37362>,s}
+// id 1656
+sphere{<6.19793,-1.74113,1.53356>,s}
+// id 416
+sphere{<7.68308,-2.43475,2.84454>,s}
+// id 2269
+sphere{<7.694,-1.42207,2.75937>,s}
+// id 2168
+sphere{<7.75117,-2.00324,1.90958>,s}
+// id 302
+sphere{<7.67313,-0.0791513,1.51488>,s}
+// id 1115
+sphere{<8.67372,-2.31336,2.12475>,s}
+// id 1319
+sphere{<9.47995,-2.25661,2.90551>,s}
+// id 1651
+sphere{<8.50537,-1.33165,2.10689>,s}
+// id 202
+sphere{<8.58748,-1.807,2.98976>,s}
+// id 2378
+sphere{<8.47372,-0.805341,2.95435>,s}
+// id 706
+sphere{<10.2125,-1.01666,1.65455>,s}
+// id 1618
+sphere{<10.2469,-1.66009,2.66308>,s}
+// id 1235
+sphere{<9.4403,-1.67969,2.07033>,s}
+// id 1133
+sphere{<9.39789,-1.2239,2.96294>,s}
+// id 987
+sphere{<10.3668,-2.00867,1.73027>,s}
+// id 1883
+sphere{<10.1918,-0.659745,2.74245>,s}
+// id 2145
+sphere{<9.26312,-0.194878,2.98711>,s}
+// id 1586
+sphere{<9.39575,-0.678911,2.12433>,s}
+// id 1711
+sphere{<10.1144,-0.0391355,1.85374>,s}
+// id 1953
+sphere{<8.46406,-0.328556,2.07589>,s}
+// id 517
+sphere{<11.03,-1.34299,2.12954>,s}
+// id 2
+sphere{<11.3501,-2.14207,1.57403>,s}
+// id 1643
+sphere{<10.9943,-0.342166,2.23515>,s}
+// id 2024
+sphere{<11.6223,-1.21023,1.3369>,s}
+// id 372
+sphere{<-10.7466,0.765001,2.39921>,s}
+// id 478
+sphere{<-11.3802,0.606645,1.53694>,s}
+// id 1733
+sphere{<-11.0464,1.59584,1.92827>,s}
+// id 52
+sphere{<-11.2659,2.50043,1.56251>,s}
+// id 466
+sphere{<-8.78794,0.830154,2.92282>,s}
+// id 695
+sphere{<-9.80036,0.811548,2.85341>,s}
+// id 2210
+sphere{<-8.11924,0.0948155,2.77179>,s}
+// id 1402
+sphere{<-9.28656,1.70035,2.9534>,s}
+// id 191
+sphere{<-7.85506,1.22293,2.78888>,s}
+// id 1804
+sphere{<-8.68711,2.50207,2.993>,s}
+// id 666
+sphere{<-9.75224,2.58162,2.78886>,s}
+// id 1959
+sphere{<-9.76466,0.217987,1.88471>,s}
+// id 639
+sphere{<-8.28732,0.553234,1.89645>,s}
+// id 1789
+sphere{<-10.3196,2.30485,1.86399>,s}
+// id 64
+sphere{<-10.2313,1.05209,1.59031>,s}
+// id 253
+sphere{<-10.2562,1.67989,2.6428>,s}
+// id 1838
+sphere{<-9.1713,1.01459,2.00087>,s}
+// id 1277
+sphere{<-9.3733,2.00613,1.9899>,s}
+// id 597
+sphere{<-8.41602,1.69873,2.1114>,s}
+// id 1927
+sphere{<-7.72799,2.21641,2.84149>,s}
+// id 505
+sphere{<-7.29075,0.512239,2.35871>,s}
+// id 2196
+sphere{<-7.59094,1.26613,1.72416>,s}
+// id 2156
+sphere{<-7.62671,2.28175,1.82279>,s}
+// id 331
+sphere{<-6.86214,1.84597,2.31398>,s}
+// id 1171
+sphere{<-6.58137,1.00239,1.84737>,s}
+// id 1252
+sphere{<7.55896,0.933993,2.64777>,s}
+// id 982
+sphere{<6.85334,0.103642,2.08117>,s}
+// id 1535
+sphere{<7.14919,1.90153,2.52825>,s}
+// id 1947
+sphere{<6.74058,1.09825,2.07032>,s}
+// id 948
+sphere{<7.14061,1.82455,1.50603>,s}
+// id 1872
+sphere{<7.54374,0.904423,1.50496>,s}
+// id 802
+sphere{<6.37555,2.24144,1.99001>,s}
+// id 1315
+sphere{<10.1466,0.368723,2.77327>,s}
+// id 998
+sphere{<8.32648,0.183477,2.92453>,s}
+// id 2352
+sphere{<8.34663,0.722158,2.06788>,s}
+// id 431
+sphere{<8.57743,1.14631,2.97175>,s}
+// id 1178
+sphere{<10.0739,1.08432,2.06378>,s}
+// id 1783
+sphere{<9.30346,0.472987,2.24702>,s}
+// id 2280
+sphere{<9.57705,1.17469,2.93138>,s}
+// id 2183
+sphere{<10.2969,2.07343,1.51708>,s}
+// id 1549
+sphere{<9.02768,1.50975,2.15105>,s}
+// id 1457
+sphere{<10.0468,2.03013,2.72216>,s}
+// id 592
+sphere{<9.07889,2.09718,2.97333>,s}
+// id 559
+sphere{<9.44984,2.3991,1.94074>,s}
+// id 353
+sphere{<8.07274,2.00581,2.91251>,s}
+// id 1579
+sphere{<8.01578,1.66118,1.97222>,s}
+// id 2167
+sphere{<8.48681,2.53643,2.17325>,s}
+// id 2274
+sphere{<10.959,0.661754,2.26315>,s}
+// id 511
+sphere{<11.5471,0.248222,1.57158>,s}
+// id 719
+sphere{<11.4651,1.2433,1.59838>,s}
+// id 214
+sphere{<11.326,2.2421,1.5324>,s}
+// id 955
+sphere{<10.8507,1.67977,2.25297>,s}
+// id 1046
+sphere{<-10.6994,3.21551,2.04913>,s}
+// id 926
+sphere{<-9.0263,3.45169,2.89096>,s}
+// id 1639
+sphere{<-7.92722,3.231,2.94493>,s}
+// id 567
+sphere{<-8.29052,4.20222,2.98027>,s}
+// id 1532
+sphere{<-9.93601,3.70468,2.52042>,s}
+// id 1915
+sphere{<-9.47574,3.00721,1.92446>,s}
+// id 1504
+sphere{<-8.47318,3.75442,2.09429>,s}
+// id 19
+sphere{<-8.51902,2.72898,2.02046>,s}
+// id 651
+sphere{<-10.2562,4.48063,1.95223>,s}
+// id 2242
+sphere{<-9.22571,4.48386,2.66458>,s}
+// id 412
+sphere{<-9.45785,5.07449,1.58812>,s}
+// id 2336
+sphere{<-9.36553,4.04448,1.74448>,s}
+// id 2013
+sphere{<-8.55693,4.85934,1.96332>,s}
+// id 932
+sphere{<-6.82443,4.1657,1.78038>,s}
+// id 929
+sphere{<-5.51339,4.42094,2.29293>,s}
+// id 1672
+sphere{<-7.16875,3.90996,2.88227>,s}
+// id 1576
+sphere{<-7.68655,4.4346,2.20787>,s}
+// id 809
+sphere{<-5.569,3.55527,1.78312>,s}
+// id 724
+sphere{<-7.54303,3.40275,1.9768>,s}
+// id 5
+sphere{<-6.95927,2.89943,2.61658>,s}
+// id 876
+sphere{<-6.2602,2.60483,1.96034>,s}
+// id 671
+sphere{<-6.30063,3.65014,2.4596>,s}
+// id 38
+sphere{<-6.37476,4.60446,2.77383>,s}
+// id 2110
+sphere{<-7.29131,4.9494,2.98922>,s}
+// id 911
+sphere{<-5.77684,4.80993,1.41237>,s}
+// id 1881
+sphere{<-4.04414,4.85375,1.343>,s}
+// id 1164
+sphere{<-4.87811,4.27676,1.48004>,s}
+// id 960
+sphere{<-4.65391,5.0871,2.0987>,s}
+// id 53
+sphere{<4.63322,4.46472,1.40101>,s}
+// id 775
+sphere{<4.57234,5.16322,2.11656>,s}
+// id 745
+sphere{<3.74551,5.16832,1.43168>,s}
+// id 916
+sphere{<6.74406,3.02515,2.50411>,s}
+// id 211
+sphere{<7.66949,2.92109,2.88775>,s}
+// id 1490
+sphere{<6.69706,4.75073,2.88655>,s}
+// id 176
+sphere{<7.21357,3.84401,2.85643>,s}
+// id 1536
+sphere{<7.51942,2.64315,1.93921>,s}
+// id 205
+sphere{<5.76547,5.06607,2.67857>,s}
+// id 607
+sphere{<6.27131,3.91202,2.52049>,s}
+// id 1070
+sphere{<5.95767,3.18126,1.88916>,s}
+// id 236
+sphere{<6.75334,2.9073,1.33913>,s}
+// id 2348
+sphere{<5.2004,3.63388,1.38671>,s}
+// id 978
+sphere{<6.31091,4.70576,1.90712>,s}
+// id 946
+sphere{<5.42256,4.27901,2.12708>,s}
+// id 972
+sphere{<7.38971,4.60518,2.15905>,s}
+// id 1287
+sphere{<7.23263,3.63802,1.86111>,s}
+// id 1822
+sphere{<5.46008,5.18054,1.65199>,s}
+// id 923
+sphere{<9.61603,2.93267,2.77292>,s}
+// id 574
+sphere{<8.65112,3.09033,2.98796>,s}
+// id 595
+sphere{<9.33081,4.89871,2.55425>,s}
+// id 831
+sphere{<9.79288,3.88952,2.53599>,s}
+// id 631
+sphere{<8.86754,4.06053,2.87893>,s}
+// id 853
+sphere{<9.89622,3.34354,1.64027>,s}
+// id 233
+sphere{<9.74268,4.39062,1.66478>,s}
+// id 1886
+sphere{<7.96271,4.4992,2.97348>,s}
+// id 991
+sphere{<8.45447,4.58316,2.10193>,s}
+// id 1612
+sphere{<9.00048,3.39577,2.08361>,s}
+// id 445
+sphere{<8.08402,3.68299,2.38397>,s}
+// id 1011
+sphere{<8.16016,3.25856,1.481>,s}
+// id 1919
+sphere{<8.86097,4.05038,1.33725>,s}
+// id 1765
+sphere{<7.88074,4.25273,1.35248>,s}
+// id 1463
+sphere{<10.499,2.8362,2.29148>,s}
+// id 851
+sphere{<10.7389,3.91786,1.70549>,s}
+// id 2107
+sphere{<10.5798,4.85891,1.34484>,s}
+// id 751
+sphere{<-9.5553,6.05395,1.78564>,s}
+// id 858
+sphere{<-8.59021,5.81886,1.67278>,s}
+// id 61
+sphere{<-9.13068,5.48086,2.49858>,s}
+// id 177
+sphere{<-8.25784,5.20173,2.89968>,s}
+// id 674
+sphere{<-8.23397,6.19195,2.69708>,s}
+// id 896
+sphere{<-8.80455,6.716,2.06402>,s}
+// id 409
+sphere{<-8.10985,7.43862,2.19965>,s}
+// id 362
+sphere{<-7.28959,5.94878,2.92724>,s}
+// id 1670
+sphere{<-6.29499,5.79099,2.94037>,s}
+// id 828
+sphere{<-5.40524,5.41772,2.67277>,s}
+// id 300
+sphere{<-5.49735,6.4089,2.86457>,s}
+// id 410
+sphere{<-6.74971,5.31805,2.16318>,s}
+// id 150
+sphere{<-7.72803,5.54719,2.12215>,s}
+// id 1321
+sphere{<-7.38453,6.95877,2.71368>,s}
+// id 1200
+sphere{<-6.39904,6.84543,2.90851>,s}
+// id 1997
+sphere{<-5.72475,7.6643,2.79131>,s}
+// id 2146
+sphere{<-5.94197,5.7979,1.81929>,s}
+// id 1843
+sphere{<-7.72137,6.58061,1.84133>,s}
+// id 1406
+sphere{<-6.63141,7.44527,2.11494>,s}
+// id 2292
+sphere{<-7.37092,7.56377,1.41919>,s}
+// id 1726
+sphere{<-6.7726,6.3202,2.11618>,s}
+// id 2142
+sphere{<-5.8874,6.78454,2.02296>,s}
+// id 76
+sphere{<-4.51166,6.14871,2.65809>,s}
+// id 1629
+sphere{<-4.23627,7.09524,2.85125>,s}
+// id 2049
+sphere{<-3.29222,7.45081,2.77853>,s}
+// id 261
+sphere{<-3.48615,6.50586,2.51344>,s}
+// id 1404
+sphere{<-3.84317,5.68126,2.07072>,s}
+// id 2111
+sphere{<-2.76064,6.11919,1.93825>,s}
+// id 1917
+sphere{<-3.16504,7.20328,1.79744>,s}
+// id 1215
+sphere{<-5.00359,6.26918,1.78705>,s}
+// id 295
+sphere{<-5.02896,7.27679,2.17151>,s}
+// id 1485
+sphere{<-4.15825,6.88185,1.87759>,s}
+// id 290
+sphere{<-1.71618,6.46774,1.90884>,s}
+// id 344
+sphere{<-1.32445,7.21933,1.36251>,s}
+// id 1399
+sphere{<-0.805614,6.83762,2.12583>,s}
+// id 2065
+sphere{<-1.51637,7.35713,2.60326>,s}
+// id 18
+sphere{<-0.0333251,7.59647,2.63636>,s}
+// id 575
+sphere{<-2.1182,7.60282,1.8368>,s}
+// id 2363
+sphere{<-2.4275,6.89552,2.47846>,s}
+// id 387
+sphere{<0.188199,6.80033,2.03781>,s}
+// id 1037
+sphere{<1.85165,6.98315,2.38242>,s}
+// id 347
+sphere{<0.914116,7.30961,2.49913>,s}
+// id 2260
+sphere{<1.11971,6.5608,1.76456>,s}
+// id 2180
+sphere{<2.45454,7.1632,1.54976>,s}
+// id 1167
+sphere{<2.07073,6.24764,1.73972>,s}
+// id 975
+sphere{<0.436796,7.78475,1.75846>,s}
+// id 915
+sphere{<1.45056,7.48939,1.60367>,s}
+// id 1896
+sphere{<2.80895,6.57358,2.32764>,s}
+// id 702
+sphere{<3.5365,7.08137,2.78748>,s}
+// id 1627
+sphere{<4.33989,7.65723,2.94184>,s}
+// id 711
+sphere{<4.34843,6.4995,2.74117>,s}
+// id 570
+sphere{<3.86629,6.87932,1.86143>,s}
+// id 165
+sphere{<2.96825,5.81931,1.68299>,s}
+// id 605
+sphere{<2.6135,7.48322,2.78705>,s}
+// id 1996
+sphere{<3.21742,7.63213,2.00195>,s}
+// id 884
+sphere{<4.75916,7.25557,2.12443>,s}
+// id 1393
+sphere{<5.08519,5.80391,2.71146>,s}
+// id 1547
+sphere{<3.82331,5.84216,2.20084>,s}
+// id 2158
+sphere{<4.76698,6.2582,1.85395>,s}
+// id 1830
+sphere{<6.89967,7.5844,1.71545>,s}
+// id 1342
+sphere{<7.52444,6.89484,2.13598>,s}
+// id 1298
+sphere{<5.30137,6.75404,2.94994>,s}
+// id 375
+sphere{<6.31285,6.7564,2.98868>,s}
+// id 717
+sphere{<5.3395,7.75311,2.96342>,s}
+// id 1426
+sphere{<6.06464,7.51816,2.30598>,s}
+// id 1450
+sphere{<7.2315,6.36377,2.93088>,s}
+// id 2225
+sphere{<6.96768,7.47135,2.7331>,s}
+// id 2340
+sphere{<6.43034,5.75301,2.97618>,s}
+// id 1373
+sphere{<7.46599,5.38528,2.96618>,s}
+// id 2209
+sphere{<5.91351,5.93016,2.13454>,s}
+// id 2124
+sphere{<7.23158,6.20675,1.45786>,s}
+// id 654
+sphere{<6.9002,5.51309,2.11286>,s}
+// id 389
+sphere{<5.58743,6.82941,1.76138>,s}
+// id 1495
+sphere{<6.55273,6.69052,2.01988>,s}
+// id 486
+sphere{<9.72627,6.24607,1.37019>,s}
+// id 223
+sphere{<8.87816,5.44943,1.81459>,s}
+// id 173
+sphere{<8.45403,5.36803,2.81342>,s}
+// id 821
+sphere{<9.91912,5.41303,1.89925>,s}
+// id 1449
+sphere{<9.20522,7.10645,1.43023>,s}
+// id 268
+sphere{<8.19957,6.34368,2.66332>,s}
+// id 1995
+sphere{<8.47514,7.20771,2.10673>,s}
+// id 280
+sphere{<9.0682,6.39055,2.14043>,s}
+// id 2257
+sphere{<7.89234,5.46474,1.98242>,s}
+// id 1828
+sphere{<8.20726,6.36514,1.63041>,s}
+// id 1192
+sphere{<-8.23652,8.10558,1.45973>,s}
+// id 2091
+sphere{<-5.41877,8.6661,2.61176>,s}
+// id 207
+sphere{<-6.65941,9.1447,1.76941>,s}
+// id 242
+sphere{<-6.34288,8.37767,2.33309>,s}
+// id 1237
+sphere{<-7.33842,8.2297,2.18119>,s}
+// id 135
+sphere{<-7.53757,8.81682,1.39612>,s}
+// id 1273
+sphere{<-5.69909,8.88216,1.67377>,s}
+// id 755
+sphere{<-5.70035,7.88354,1.74352>,s}
+// id 2157
+sphere{<-5.24297,9.58503,2.22519>,s}
+// id 1299
+sphere{<-5.98509,9.85411,1.56208>,s}
+// id 326
+sphere{<-4.48386,9.05455,2.68429>,s}
+// id 224
+sphere{<-4.75842,7.95513,2.85324>,s}
+// id 551
+sphere{<-2.89041,8.6746,2.91405>,s}
+// id 1552
+sphere{<-3.81495,8.30203,2.83984>,s}
+// id 1073
+sphere{<-3.54915,9.40915,2.72599>,s}
+// id 940
+sphere{<-3.07607,10.2395,2.42586>,s}
+// id 1289
+sphere{<-3.55325,9.89165,1.52021>,s}
+// id 1134
+sphere{<-4.27288,9.91474,2.21888>,s}
+// id 293
+sphere{<-2.8354,9.16011,2.01824>,s}
+// id 1345
+sphere{<-2.93521,8.15339,2.01167>,s}
+// id 346
+sphere{<-4.72339,8.47373,1.90578>,s}
+// id 655
+sphere{<-3.92617,7.84963,1.95755>,s}
+// id 254
+sphere{<-3.85861,8.99868,1.85984>,s}
+// id 678
+sphere{<-4.65728,9.43647,1.42645>,s}
+// id 1326
+sphere{<-5.09053,10.3295,1.57268>,s}
+// id 1788
+sphere{<-0.397313,8.65014,1.36029>,s}
+// id 510
+sphere{<-0.666419,7.81523,1.89573>,s}
+// id 1626
+sphere{<-1.44084,8.24442,1.41785>,s}
+// id 1377
+sphere{<-0.881048,8.088,2.87266>,s}
+// id 1290
+sphere{<-0.739348,9.71435,1.96359>,s}
+// id 1361
+sphere{<-0.522993,9.01588,2.99647>,s}
+// id 440
+sphere{<-2.01595,8.52764,2.20793>,s}
+// id 673
+sphere{<-1.52003,8.88871,2.99811>,s}
+// id 10
+sphere{<-1.00465,8.76817,2.14957>,s}
+// id 1375
+sphere{<-2.01978,10.392,2.51559>,s}
+// id 2247
+sphere{<-2.33544,9.50476,2.87062>,s}
+// id 437
+sphere{<-0.160942,9.93791,2.83686>,s}
+// id 1616
+sphere{<-1.17639,9.83897,2.85426>,s}
+// id 1824
+sphere{<-2.4738,10.0721,1.64529>,s}
+// id 500
+sphere{<-1.45343,10.3553,1.67336>,s}
+// id 956
+sphere{<-1.71854,9.47361,2.07472>,s}
+// id 971
+sphere{<-2.36597,7.82374,2.84955>,s}
+// id 1033
+sphere{<0.0109258,8.56758,2.26974>,s}
+// id 2311
+sphere{<0.724042,8.20931,2.89224>,s}
+// id 1228
+sphere{<0.602385,8.70788,1.39509>,s}
+// id 1159
+sphere{<2.11742,9.00222,2.18711>,s}
+// id 571
+sphere{<1.80941,9.78858,2.8252>,s}
+// id 66
+sphere{<2.58332,10.3546,2.46468>,s}
+// id 512
+sphere{<0.843996,10.0775,2.78498>,s}
+// id 676
+sphere{<0.468055,9.17419,2.99195>,s}
+// id 950
+sphere{<1.2638,8.35873,2.0646>,s}
+// id 1078
+sphere{<2.4813,8.45975,2.96271>,s}
+// id 1266
+sphere{<2.23634,8.02502,2.01106>,s}
+// id 1533
+sphere{<1.6793,7.86513,2.83119>,s}
+// id 545
+sphere{<1.5242,8.84595,2.98671>,s}
+// id 418
+sphere{<1.17426,9.34741,2.19014>,s}
+// id 2244
+sphere{<1.94945,9.97963,1.78542>,s}
+// id 12
+sphere{<0.236424,9.50139,1.88034>,s}
+// id 1145
+sphere{<0.943642,10.2181,1.74146>,s}
+// id 1592
+sphere{<4.23869,10.3911,1.97013>,s}
+// id 1712
+sphere{<3.05391,8.61889,2.06103>,s}
+// id 506
+sphere{<3.41577,8.06499,2.92918>,s}
+// id 105
+sphere{<3.95148,8.99436,1.79627>,s}
+// id 1148
+sphere{<2.86719,9.58122,1.8557>,s}
+// id 1257
+sphere{<3.5144,9.96625,2.51243>,s}
+// id 1196
+sphere{<2.74567,9.41872,2.84453>,s}
+// id 1013
+sphere{<3.66795,9.03142,2.85837>,s}
+// id 2074
+sphere{<4.43212,9.55197,2.47764>,s}
+// id 1278
+sphere{<4.13477,8.03754,2.0227>,s}
+// id 75
+sphere{<5.12463,8.3275,2.05243>,s}
+// id 1683
+sphere{<4.59303,8.62224,2.84672>,s}
+// id 492
+sphere{<4.65452,9.62933,1.37319>,s}
+// id 1965
+sphere{<6.18067,8.25951,1.53587>,s}
+// id 1718
+sphere{<6.92167,8.48963,2.18871>,s}
+// id 1114
+sphere{<6.01956,8.45529,2.6524>,s}
+// id 1702
+sphere{<7.72586,7.87462,2.20078>,s}
+// id 2075
+sphere{<5.36686,9.19642,2.49447>,s}
+// id 1875
+sphere{<5.53348,9.92058,1.77206>,s}
+// id 1177
+sphere{<6.26044,9.23347,2.03166>,s}
+// id 1993
+sphere{<5.50757,8.99438,1.37754>,s}
+// id 203
+sphere{<7.0711,9.18879,1.44008>,s}
+// id 1714
+sphere{<7.85651,8.55167,1.46141>,s}
+// id 1191
+sphere{<-3.18396,10.8977,1.66572>,s}
+// id 2305
+sphere{<-4.15943,10.6931,1.56696>,s}
+// id 1834
+sphere{<-0.632544,10.7115,2.41243>,s}
+// id 887
+sphere{<-0.0972628,10.4032,1.58997>,s}
+// id 2066
+sphere{<-2.20361,11.1196,1.85362>,s}
+// id 1149
+sphere{<-0.183679,11.4065,1.74443>,s}
+// id 944
+sphere{<-1.18231,11.3179,1.81046>,s}
+// id 2019
+sphere{<2.36881,11.1161,1.83785>,s}
+// id 550
+sphere{<1.55726,10.6664,2.40328>,s}
+// id 70
+sphere{<0.382909,10.8514,2.35366>,s}
+// id 1398
+sphere{<1.06464,11.3449,1.7936>,s}
+// id 856
+sphere{<3.31435,10.7646,1.86928>,s}
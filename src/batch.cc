@@ -0,0 +1,81 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file batch.cc
+ * \brief Function implementations for the cell_batch class. */
+
+#include "batch.hh"
+
+namespace voro {
+
+/** Removes all of the cells from the batch, keeping the allocated memory. */
+void cell_batch::clear() {
+	id.clear();pos.clear();pts.clear();fv.clear();fn.clear();
+	vo.resize(1);fo.resize(1);fvo.resize(1);
+}
+
+/** Adds a Voronoi cell to the end of the batch.
+ * \param[in] c a reference to the cell. If this is a voronoicell_neighbor,
+ *              then the neighbor IDs of the faces are also stored.
+ * \param[in] id_ the ID of the particle.
+ * \param[in] (x,y,z) the position of the particle. */
+void cell_batch::add(voronoicell_base &c,voro_id id_,double x,double y,double z) {
+	id.push_back(id_);
+	pos.push_back(x);pos.push_back(y);pos.push_back(z);
+
+	// Copy the vertex positions, removing the factor of two that the
+	// Voronoi cell classes use internally
+	fpoint *pp=c.pts,*pe=pp+(c.p<<2);
+	for(;pp<pe;pp+=4) {
+		pts.push_back(0.5*(*pp));pts.push_back(0.5*pp[1]);pts.push_back(0.5*pp[2]);
+	}
+	vo.push_back(vo.back()+c.p);
+
+	// Convert the face vertex list into compressed sparse row form
+	c.face_vertices(v);
+	unsigned int j=0;
+	for(;j<v.size();j+=v[j]+1) {
+		fv.insert(fv.end(),v.begin()+j+1,v.begin()+j+1+v[j]);
+		fvo.push_back(fv.size());
+	}
+	fo.push_back(fvo.size()-1);
+	c.neighbors(vn);
+	fn.insert(fn.end(),vn.begin(),vn.end());
+}
+
+/** Adds all of the cells of another batch to the end of this one.
+ * \param[in] cb the batch to add. */
+void cell_batch::append(const cell_batch &cb) {
+	int vb=vo.back(),fb=fo.back(),fvb=fvo.back();
+	unsigned int i;
+	id.insert(id.end(),cb.id.begin(),cb.id.end());
+	pos.insert(pos.end(),cb.pos.begin(),cb.pos.end());
+	pts.insert(pts.end(),cb.pts.begin(),cb.pts.end());
+	fv.insert(fv.end(),cb.fv.begin(),cb.fv.end());
+	fn.insert(fn.end(),cb.fn.begin(),cb.fn.end());
+	for(i=1;i<cb.vo.size();i++) vo.push_back(vb+cb.vo[i]);
+	for(i=1;i<cb.fo.size();i++) fo.push_back(fb+cb.fo[i]);
+	for(i=1;i<cb.fvo.size();i++) fvo.push_back(fvb+cb.fvo[i]);
+}
+
+/** Copies one of the cells of the batch into a snapshot, so that the
+ * statistics and output routines of the cell_snapshot class can be used on
+ * it.
+ * \param[in] k the index of the cell in the batch.
+ * \param[out] cs the snapshot to store the cell in. */
+void cell_batch::snapshot(int k,cell_snapshot &cs) {
+	int f0=fo[k],f1=fo[k+1];
+	cs.id=id[k];cs.x=pos[3*k];cs.y=pos[3*k+1];cs.z=pos[3*k+2];
+	cs.pts.assign(pts.begin()+3*vo[k],pts.begin()+3*vo[k+1]);
+	cs.fv.assign(fv.begin()+fvo[f0],fv.begin()+fvo[f1]);
+	cs.fo.resize(f1-f0+1);
+	for(int f=f0;f<=f1;f++) cs.fo[f-f0]=fvo[f]-fvo[f0];
+	if(has_neighbors()) cs.fn.assign(fn.begin()+f0,fn.begin()+f1);
+	else cs.fn.clear();
+	cs.pn.clear();
+}
+
+}
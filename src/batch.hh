@@ -0,0 +1,207 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file batch.hh
+ * \brief Header file for the cell_batch and cell_batcher classes, which
+ * compute the Voronoi cells of a container in batches and store them in
+ * columnar form. */
+
+#ifndef VOROPP_BATCH_HH
+#define VOROPP_BATCH_HH
+
+#include <vector>
+
+#include "config.hh"
+#include "common.hh"
+#include "cell.hh"
+#include "c_loops.hh"
+#include "v_compute.hh"
+#include "snapshot.hh"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace voro {
+
+/** \brief Columnar storage for the geometry of a batch of Voronoi cells.
+ *
+ * This class holds the same information as a sequence of cell_snapshot
+ * classes, but all of the cells share one set of flat arrays, so that a batch
+ * of many cells needs only a handful of allocations and can be copied to
+ * another device or written out as whole columns. The vertices and faces of
+ * each cell are found through compressed sparse row offsets. */
+class cell_batch {
+	public:
+		/** The IDs of the particles. */
+		std::vector<voro_id> id;
+		/** The particle positions, in groups of three. */
+		std::vector<double> pos;
+		/** The offsets of each cell's vertices, counted in vertices,
+		 * with an extra entry marking the end. */
+		std::vector<int> vo;
+		/** The vertex positions, in groups of three, relative to the
+		 * particle positions. */
+		std::vector<double> pts;
+		/** The offsets of each cell's faces, counted in faces, with an
+		 * extra entry marking the end. */
+		std::vector<int> fo;
+		/** The offsets of each face into the fv array, with an extra
+		 * entry marking the end. */
+		std::vector<int> fvo;
+		/** The vertices of each face, listed in order around the face
+		 * and numbered within the cell. */
+		std::vector<int> fv;
+		/** The neighbor IDs of each face, or an empty array if the
+		 * cells were computed without neighbor information. */
+		std::vector<voro_id> fn;
+		cell_batch() : vo(1,0), fo(1,0), fvo(1,0) {}
+		/** Returns the number of cells in the batch. */
+		inline int size() {return id.size();}
+		/** Returns the number of vertices of a cell.
+		 * \param[in] k the index of the cell in the batch. */
+		inline int number_of_vertices(int k) {return vo[k+1]-vo[k];}
+		/** Returns the number of faces of a cell.
+		 * \param[in] k the index of the cell in the batch. */
+		inline int number_of_faces(int k) {return fo[k+1]-fo[k];}
+		/** Returns whether the batch holds neighbor information. */
+		inline bool has_neighbors() {return !fn.empty();}
+		void clear();
+		void add(voronoicell_base &c,voro_id id_,double x,double y,double z);
+		void append(const cell_batch &cb);
+		void snapshot(int k,cell_snapshot &cs);
+		/** Returns the approximate amount of memory used by the batch.
+		 * \return The number of bytes. */
+		inline size_t memory() {
+			return sizeof(cell_batch)+(pos.capacity()+pts.capacity())*sizeof(double)
+			      +(vo.capacity()+fo.capacity()+fvo.capacity()+fv.capacity())*sizeof(int)
+			      +(id.capacity()+fn.capacity())*sizeof(voro_id);
+		}
+	private:
+		/** Temporary storage for the face vertices of a cell. */
+		std::vector<int> v;
+		/** Temporary storage for the neighbors of a cell. */
+		std::vector<voro_id> vn;
+};
+
+/** \brief A class for computing the Voronoi cells of a container in batches.
+ *
+ * This class walks through the particles of a container in block order, and
+ * computes their Voronoi cells a batch at a time into a cell_batch. The list
+ * of non-empty blocks, the Voronoi cells, and the voro_compute classes are set
+ * up once when the class is created and reused for every batch. If several
+ * threads are used, each one computes a contiguous part of the batch, and the
+ * parts are joined in order, so the results do not depend on the number of
+ * threads. Particles whose cells are removed completely, for example by walls,
+ * are left out. The container must not be modified while the class is in use.
+ * \tparam c_class the container class to use.
+ * \tparam v_cell the Voronoi cell class to use. If this is
+ *		  voronoicell_neighbor, then the neighbor IDs of the faces are
+ *		  stored. */
+template<class c_class,class v_cell>
+class cell_batcher {
+	public:
+		/** A reference to the container. */
+		c_class &con;
+		/** The maximum number of particles in each batch. */
+		const int batch_size;
+		/** The number of threads to use. */
+		const int nt;
+		/** Sets up the class.
+		 * \param[in] con_ the container to compute cells for.
+		 * \param[in] batch_size_ the maximum number of particles in
+		 *			  each batch.
+		 * \param[in] nt_ the number of threads to use, or zero to use
+		 *		  the OpenMP default. */
+		cell_batcher(c_class &con_,int batch_size_=batch_default_size,int nt_=1)
+			: con(con_), batch_size(batch_size_), nt(voro_threads(nt_)),
+			bs(con_,1), vc(nt,v_cell(con_)), vcl(new voro_compute<c_class>*[nt]),
+			cbt(nt>1?new cell_batch[nt]:NULL) {
+			if(batch_size<1) voro_fatal_error("Batch size must be positive",VOROPP_INTERNAL_ERROR);
+			for(int t=0;t<nt;t++) vcl[t]=con.new_compute();
+			reset();
+		}
+		/** The class destructor frees the compute classes. */
+		~cell_batcher() {
+			for(int t=nt-1;t>=0;t--) delete vcl[t];
+			delete [] cbt;
+			delete [] vcl;
+		}
+		/** Starts again from the first particle of the container. */
+		inline void reset() {b=0;q=0;}
+		/** Computes the next batch of Voronoi cells.
+		 * \param[out] cb the batch to store the cells in. Any previous
+		 *		  contents are removed.
+		 * \return False if all of the particles have already been
+		 * computed, true otherwise. */
+		bool next(cell_batch &cb) {
+			cb.clear();
+
+			// Gather the blocks and positions of the next batch of
+			// particles
+			bq.clear();
+			while(b<bs.nb&&int(bq.size())<2*batch_size) {
+				int ijk=bs.bl[b];
+				bq.push_back(ijk);bq.push_back(q);
+				if(++q==con.co[ijk]) {b++;q=0;}
+			}
+			int n=bq.size()>>1;
+			if(n==0) return false;
+
+			// Compute the cells, splitting the batch into one
+			// contiguous part per thread
+#ifdef _OPENMP
+			if(nt>1&&n>1) {
+#pragma omp parallel num_threads(nt)
+				{
+					int t=omp_get_thread_num();
+					cbt[t].clear();
+					compute_range(t,t*n/nt,(t+1)*n/nt,cbt[t]);
+				}
+				for(int t=0;t<nt;t++) cb.append(cbt[t]);
+				return true;
+			}
+#endif
+			compute_range(0,0,n,cb);
+			return true;
+		}
+	private:
+		/** A block scheduler, used for its list of the non-empty
+		 * blocks of the container in order. */
+		block_scheduler bs;
+		/** The Voronoi cells of each thread. */
+		std::vector<v_cell> vc;
+		/** The compute classes of each thread. */
+		voro_compute<c_class> **vcl;
+		/** The partial batches of each thread. */
+		cell_batch *cbt;
+		/** The position in the list of non-empty blocks of the next
+		 * particle. */
+		int b;
+		/** The index within its block of the next particle. */
+		int q;
+		/** The blocks and positions of the particles in the current
+		 * batch, in pairs. */
+		std::vector<int> bq;
+		/** Computes the Voronoi cells of part of the current batch.
+		 * \param[in] t the thread number.
+		 * \param[in] (i0,i1) the range of particles in the batch.
+		 * \param[in] cb the batch to add the cells to. */
+		void compute_range(int t,int i0,int i1,cell_batch &cb) {
+			v_cell &c=vc[t];
+			for(int i=i0;i<i1;i++) {
+				int ijk=bq[2*i],qq=bq[2*i+1];
+				if(con.compute_cell(c,ijk,qq,*vcl[t])) {
+					fpoint *pp=con.p[ijk]+con.ps*qq;
+					cb.add(c,con.id[ijk][qq],*pp,pp[1],pp[2]);
+				}
+			}
+		}
+};
+
+}
+
+#endif
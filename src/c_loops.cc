@@ -7,10 +7,47 @@
 /** \file c_loops.cc
  * \brief Function implementations for the loop classes. */
 
+#include <cmath>
+#include <algorithm>
+#include <vector>
+
 #include "c_loops.hh"
+#include "container.hh"
+#include "container_prd.hh"
 
 namespace voro {
 
+/** \brief A function object for sorting block indices along a Morton curve. */
+struct morton_block_cmp {
+	/** The number of blocks in the x direction. */
+	int nx;
+	/** The number of blocks in a z-slice. */
+	int nxy;
+	morton_block_cmp(int nx_,int nxy_) : nx(nx_), nxy(nxy_) {}
+	/** Compares two blocks by their position along the Morton curve.
+	 * \param[in] (a,b) the indices of the blocks.
+	 * \return True if the first block comes first, false otherwise. */
+	inline bool operator()(int a,int b) const {
+		int ka=a/nxy,kb=b/nxy,ja,jb;
+		a-=ka*nxy;b-=kb*nxy;
+		ja=a/nx;jb=b/nx;
+		return morton_less(a-ja*nx,ja,ka,b-jb*nx,jb,kb);
+	}
+};
+
+/** Computes the order of the blocks of a grid along a Morton curve. Grids that
+ * are not cubes, or whose dimensions are not powers of two, are handled by
+ * sorting the blocks on their positions along the curve for the smallest cube
+ * of power-of-two size containing the grid.
+ * \param[in] (nx,ny,nz) the number of blocks in each direction.
+ * \param[out] bo an array of size nx*ny*nz in which to store the block
+ *		  indices in order. */
+void morton_block_order(int nx,int ny,int nz,int *bo) {
+	int l,nxyz=nx*ny*nz;
+	for(l=0;l<nxyz;l++) bo[l]=l;
+	std::sort(bo,bo+nxyz,morton_block_cmp(nx,nx*ny));
+}
+
 /** Initializes a c_loop_subset object to scan over all particles within a
  * given sphere.
  * \param[in] (vx,vy,vz) the position vector of the center of the sphere.
@@ -63,9 +100,9 @@ void c_loop_subset::setup_common() {
 		if(bk>=nz) {bk=nz-1;if(ak>=nz) ak=nz-1;}
 	}
 	ci=ai;cj=aj;ck=ak;
-	di=i=step_mod(ci,nx);apx=px=step_div(ci,nx)*sx;
-	dj=j=step_mod(cj,ny);apy=py=step_div(cj,ny)*sy;
-	dk=k=step_mod(ck,nz);apz=pz=step_div(ck,nz)*sz;
+	di=i=step_mod(ai,nx);apx=px=step_div(ai,nx)*sx;
+	dj=j=step_mod(aj,ny);apy=py=step_div(aj,ny)*sy;
+	dk=k=step_mod(ak,nz);apz=pz=step_div(ak,nz)*sz;
 	inc1=di-step_mod(bi,nx);
 	inc2=nx*(ny+dj-step_mod(bj,ny))+inc1;
 	inc1+=nx;
@@ -110,7 +147,7 @@ void c_loop_subset::setup_box(double xmin,double xmax,double ymin,double ymax,do
  * current loop setup.
  * \return True if the point is out of bounds, false otherwise. */
 bool c_loop_subset::out_of_bounds() {
-	double *pp=p[ijk]+ps*q;
+	fpoint *pp=p[ijk]+ps*q;
 	if(mode==sphere) {
 		double fx(*pp+px-v0),fy(pp[1]+py-v1),fz(pp[2]+pz-v2);
 		return fx*fx+fy*fy+fz*fz>v3;
@@ -124,21 +161,169 @@ bool c_loop_subset::out_of_bounds() {
 /** Returns the next block to be tested in a loop, and updates the periodicity
  * vector if necessary. */
 bool c_loop_subset::next_block() {
-	if(i<bi) {
-		i++;
-		if(ci<nx-1) {ci++;ijk++;} else {ci=0;ijk+=1-nx;px+=sx;}
+	if(ci<bi) {
+		ci++;
+		if(i<nx-1) {i++;ijk++;} else {i=0;ijk+=1-nx;px+=sx;}
 		return true;
-	} else if(j<bj) {
-		i=ai;ci=di;px=apx;j++;
-		if(cj<ny-1) {cj++;ijk+=inc1;} else {cj=0;ijk+=inc1-nxy;py+=sy;}
+	} else if(cj<bj) {
+		ci=ai;i=di;px=apx;cj++;
+		if(j<ny-1) {j++;ijk+=inc1;} else {j=0;ijk+=inc1-nxy;py+=sy;}
 		return true;
-	} else if(k<bk) {
-		i=ai;ci=di;j=aj;cj=dj;px=apx;py=apy;k++;
-		if(ck<nz-1) {ck++;ijk+=inc2;} else {ck=0;ijk+=inc2-nxyz;pz+=sz;}
+	} else if(ck<bk) {
+		ci=ai;i=di;cj=aj;j=dj;px=apx;py=apy;ck++;
+		if(k<nz-1) {k++;ijk+=inc2;} else {k=0;ijk+=inc2-nxyz;pz+=sz;}
 		return true;
 	} else return false;
 }
 
+/** Finds the index of a block in the loop's sequence, without changing the
+ * state of the loop.
+ * \param[in] s the position of the block in the sequence, between zero and
+ *		one less than the number given by blocks().
+ * \return The block index. */
+int c_loop_subset::block(int s) {
+	int lx=bi-ai+1,lxy=lx*(bj-aj+1),kk=s/lxy,jj;
+	s-=kk*lxy;jj=s/lx;
+	return step_mod(ai+s-jj*lx,nx)+nx*(step_mod(aj+jj,ny)+ny*step_mod(ak+kk,nz));
+}
+
+/** Sets the loop to consider the first particle within a given block of the
+ * sequence that passes the bounds test. The block coordinates are wrapped
+ * into the container, and the periodic displacement is set up for the bounds
+ * test. This is used by the c_loop_subset_parallel class.
+ * \param[in] s the position of the block in the sequence.
+ * \return True if a particle was found, false otherwise. */
+bool c_loop_subset::start_block(int s) {
+	int lx=bi-ai+1,lxy=lx*(bj-aj+1),kk=s/lxy,jj;
+	s-=kk*lxy;jj=s/lx;
+	s+=ai-jj*lx;jj+=aj;kk+=ak;
+	i=step_mod(s,nx);px=step_div(s,nx)*sx;
+	j=step_mod(jj,ny);py=step_div(jj,ny)*sy;
+	k=step_mod(kk,nz);pz=step_div(kk,nz)*sz;
+	ijk=i+nx*(j+ny*k);q=0;
+	return find_block();
+}
+
+/** Initializes the class to loop over all particles in a sphere.
+ * \param[in] (vx,vy,vz) the center of the sphere.
+ * \param[in] r the radius of the sphere.
+ * \param[in] bounds_test whether to do detailed bounds checking. If this is
+ *                        false then the class will loop over all particles in
+ *                        blocks that overlap the given sphere. If it is true,
+ *                        the particle will only loop over the particles which
+ *                        actually lie within the sphere. */
+void c_loop_subset_periodic::setup_sphere(double vx,double vy,double vz,double r,bool bounds_test) {
+	if(bounds_test) {mode=sphere;v0=vx;v1=vy;v2=vz;v3=r*r;} else mode=no_check;
+	setup_pieces(vx-r,vx+r,vy-r,vy+r,vz-r,vz+r);
+}
+
+/** Initializes the class to loop over all particles in a rectangular box.
+ * \param[in] (xmin,xmax) the minimum and maximum x coordinates of the box.
+ * \param[in] (ymin,ymax) the minimum and maximum y coordinates of the box.
+ * \param[in] (zmin,zmax) the minimum and maximum z coordinates of the box.
+ * \param[in] bounds_test whether to do detailed bounds checking. If this is
+ *                        false then the class will loop over all particles in
+ *                        blocks that overlap the given box. If it is true, the
+ *                        particle will only loop over the particles which
+ *                        actually lie within the box. */
+void c_loop_subset_periodic::setup_box(double xmin,double xmax,double ymin,double ymax,double zmin,double zmax,bool bounds_test) {
+	if(bounds_test) {mode=box;v0=xmin;v1=xmax;v2=ymin;v3=ymax;v4=zmin;v5=zmax;} else mode=no_check;
+	setup_pieces(xmin,xmax,ymin,ymax,zmin,zmax);
+}
+
+/** Splits a rectangular region into pieces, one for each periodic image of
+ * the primary domain that it overlaps. The images are found one direction at a
+ * time, starting with z, since the periodic displacements in the z and y
+ * directions also shift the region in the directions before them. For each
+ * piece, the range of primary blocks that it covers is stored.
+ * \param[in] (xl,xh) the minimum and maximum x coordinates of the region.
+ * \param[in] (yl,yh) the minimum and maximum y coordinates of the region.
+ * \param[in] (zl,zh) the minimum and maximum z coordinates of the region. */
+void c_loop_subset_periodic::setup_pieces(double xl,double xh,double yl,double yh,double zl,double zh) {
+	int a,b,c,ca=int(floor(zl/bz)),cb=int(floor(zh/bz)),ba,bb,aa,ab;
+	double dx,dy,dz;
+	pr.clear();pd.clear();po.assign(1,0);ns=0;
+	for(c=ca;c<=cb;c++) {
+		dz=c*bz;
+		ba=int(floor((yl-c*byz)/by));bb=int(floor((yh-c*byz)/by));
+		for(b=ba;b<=bb;b++) {
+			dy=b*by+c*byz;
+			aa=int(floor((xl-b*bxy-c*bxz)/bx));ab=int(floor((xh-b*bxy-c*bxz)/bx));
+			for(a=aa;a<=ab;a++) {
+				dx=a*bx+b*bxy+c*bxz;
+				pr.push_back(clamp(step_int((xl-dx)*xsp),nx));
+				pr.push_back(clamp(step_int((xh-dx)*xsp),nx));
+				pr.push_back(clamp(step_int((yl-dy)*ysp),ny)+ey);
+				pr.push_back(clamp(step_int((yh-dy)*ysp),ny)+ey);
+				pr.push_back(clamp(step_int((zl-dz)*zsp),nz)+ez);
+				pr.push_back(clamp(step_int((zh-dz)*zsp),nz)+ez);
+				pd.push_back(dx);pd.push_back(dy);pd.push_back(dz);
+				int *rp=&pr[pr.size()-6];
+				ns+=(rp[1]-*rp+1)*(rp[3]-rp[2]+1)*(rp[5]-rp[4]+1);
+				po.push_back(ns);
+			}
+		}
+	}
+}
+
+/** Finds the piece of the region that a block in the loop's sequence belongs
+ * to.
+ * \param[in] s the position of the block in the sequence.
+ * \param[out] l the position of the block within the piece.
+ * \return The index of the piece. */
+int c_loop_subset_periodic::find_piece(int s,int &l) {
+	int pi=int(std::upper_bound(po.begin(),po.end(),s)-po.begin())-1;
+	l=s-po[pi];
+	return pi;
+}
+
+/** Finds the index of a block in the loop's sequence, without changing the
+ * state of the loop.
+ * \param[in] s the position of the block in the sequence, between zero and
+ *		one less than the number given by blocks().
+ * \return The block index. */
+int c_loop_subset_periodic::block(int s) {
+	int l,*rp=&pr[6*find_piece(s,l)],lx=rp[1]-*rp+1,lxy=lx*(rp[3]-rp[2]+1),kk=l/lxy,jj;
+	l-=kk*lxy;jj=l/lx;
+	return *rp+l-jj*lx+nx*(rp[2]+jj+oy*(rp[4]+kk));
+}
+
+/** Sets the loop to consider the first particle within a given block of the
+ * sequence that passes the bounds test, and sets up the periodic displacement
+ * of the block's piece for the bounds test.
+ * \param[in] s the position of the block in the sequence.
+ * \return True if a particle was found, false otherwise. */
+bool c_loop_subset_periodic::start_block(int s) {
+	int l,pi=find_piece(s,l),*rp=&pr[6*pi],lx=rp[1]-*rp+1,lxy=lx*(rp[3]-rp[2]+1),kk=l/lxy,jj;
+	l-=kk*lxy;jj=l/lx;
+	i=*rp+l-jj*lx;j=rp[2]+jj;k=rp[4]+kk;
+	px=pd[3*pi];py=pd[3*pi+1];pz=pd[3*pi+2];
+	ijk=i+nx*(j+oy*k);q=0;sn=s;
+	return find_block();
+}
+
+/** Starts the loop by finding the first particle to consider.
+ * \return True if there is any particle to consider, false otherwise. */
+bool c_loop_subset_periodic::start() {
+	for(sn=0;sn<ns;sn++) if(start_block(sn)) return true;
+	return false;
+}
+
+/** Computes whether the current point is out of bounds, relative to the
+ * current loop setup.
+ * \return True if the point is out of bounds, false otherwise. */
+bool c_loop_subset_periodic::out_of_bounds() {
+	fpoint *pp=p[ijk]+ps*q;
+	if(mode==sphere) {
+		double fx(*pp+px-v0),fy(pp[1]+py-v1),fz(pp[2]+pz-v2);
+		return fx*fx+fy*fy+fz*fz>v3;
+	} else {
+		double f(*pp+px);if(f<v0||f>v1) return true;
+		f=pp[1]+py;if(f<v2||f>v3) return true;
+		f=pp[2]+pz;return f<v4||f>v5;
+	}
+}
+
 /** Extends the memory available for storing the ordering. */
 void particle_order::add_ordering_memory() {
 	int *no=new int[size<<2],*nop=no,*opp=o;
@@ -147,4 +332,374 @@ void particle_order::add_ordering_memory() {
 	size<<=1;o=no;op=nop;
 }
 
+/** Adds records for all of the particles in a container to the order, in a
+ * sequence that keeps successive particles close together in space. The
+ * blocks are visited along a Morton curve, as in the c_loop_morton class, and
+ * the particles within each block are also sorted along a Morton curve, as in
+ * the container_base::sort_morton() routine. A c_loop_order class that uses
+ * the order then has the same locality as the library's own traversals. The
+ * records refer to the current positions of the particles in the blocks, so
+ * the order must be rebuilt if the container is changed.
+ * \param[in] con the container to use. */
+void particle_order::add_morton(container_base &con) {
+	add_morton_blocks(con.nx,con.ny,con.nz,0,con.nxy,con.co,con.p,con.ps,
+			  con.ax,con.ay,con.az,con.xsp,con.ysp,con.zsp);
+}
+
+/** Adds records for all of the particles in the primary domain of a periodic
+ * container to the order, in the same way as for the non-periodic version of
+ * this routine, for use with the c_loop_order_periodic class.
+ * \param[in] con the periodic container to use. */
+void particle_order::add_morton(container_periodic_base &con) {
+	add_morton_blocks(con.nx,con.ny,con.nz,con.nx*(con.ey+con.oy*con.ez),con.nx*con.oy,
+			  con.co,con.p,con.ps,0,0,0,con.xsp,con.ysp,con.zsp);
+}
+
+/** Adds records for the particles in a grid of blocks in Morton order.
+ * \param[in] (nx,ny,nz) the number of blocks in each direction.
+ * \param[in] ijk0 the index of the first block in the container.
+ * \param[in] sz the step in the block index between z-slices. The step
+ *		 between rows is nx.
+ * \param[in] (co,p,ps) the particle counts and positions of the container
+ *		       blocks, and the number of values per particle.
+ * \param[in] (ax,ay,az) the position of the lower corner of the grid.
+ * \param[in] (xsp,ysp,zsp) the inverse block widths. */
+void particle_order::add_morton_blocks(int nx,int ny,int nz,int ijk0,int sz,int *co,fpoint **p,int ps,
+				       double ax,double ay,double az,double xsp,double ysp,double zsp) {
+	int b,ijk,i,j,k,l,n,nxy=nx*ny,nxyz=nxy*nz,*bo=new int[nxyz];
+	fpoint *pp;
+	std::vector<int> qc,ord;
+	morton_block_order(nx,ny,nz,bo);
+	for(b=0;b<nxyz;b++) {
+		k=bo[b]/nxy;j=(bo[b]-nxy*k)/nx;i=bo[b]-nxy*k-nx*j;
+		ijk=ijk0+i+nx*j+sz*k;n=co[ijk];
+		if(n==0) continue;
+		qc.resize(3*n);ord.resize(n);
+		for(l=0;l<n;l++) {
+			pp=p[ijk]+ps*l;
+			qc[3*l]=morton_quantize((*pp-ax)*xsp-i);
+			qc[3*l+1]=morton_quantize((pp[1]-ay)*ysp-j);
+			qc[3*l+2]=morton_quantize((pp[2]-az)*zsp-k);
+			ord[l]=l;
+		}
+		if(n>1) std::sort(ord.begin(),ord.end(),morton_particle_cmp(&qc[0]));
+		for(l=0;l<n;l++) add(ijk,ord[l]);
+	}
+	delete [] bo;
+}
+
+/** The class constructor queues the blocks on the non-periodic faces of a
+ * container, and the blocks that its walls pass through.
+ * \param[in] con the container class to use. */
+boundary_blocks::boundary_blocks(container_base &con)
+	: nx(con.nx), ny(con.ny), nz(con.nz), nxy(con.nxy),
+	xperiodic(con.xperiodic), yperiodic(con.yperiodic), zperiodic(con.zperiodic),
+	qu(new int[con.nxyz]), qp(qu), qe(qu), mk(new unsigned char[con.nxyz]) {
+	int i,j,k,l;
+	for(l=0;l<con.nxyz;l++) mk[l]=0;
+	for(k=0;k<nz;k++) for(j=0;j<ny;j++) for(i=0;i<nx;i++)
+		if((!xperiodic&&(i==0||i==nx-1))||(!yperiodic&&(j==0||j==ny-1))||(!zperiodic&&(k==0||k==nz-1)))
+			add(i+nx*j+nxy*k);
+	if(con.walls==con.wep) return;
+
+	// Test which corners of the blocks are inside the walls, and queue
+	// the blocks whose corners are not all on the same side
+	int mx=nx+1,mxy=mx*(ny+1),n=mxy*(nz+1);
+	double *pp=new double[3*n],*p=pp;
+	unsigned char *m=new unsigned char[n],*mp;
+	for(k=0;k<=nz;k++) for(j=0;j<=ny;j++) for(i=0;i<=nx;i++) {
+		*(p++)=con.ax+i*con.boxx;
+		*(p++)=con.ay+j*con.boxy;
+		*(p++)=con.az+k*con.boxz;
+	}
+	for(l=0;l<n;l++) m[l]=1;
+	con.points_inside_walls(n,pp,m);
+	for(k=0;k<nz;k++) for(j=0;j<ny;j++) for(i=0;i<nx;i++) {
+		mp=m+i+mx*j+mxy*k;
+		if(*mp!=mp[1]||*mp!=mp[mx]||*mp!=mp[mx+1]||*mp!=mp[mxy]
+		   ||*mp!=mp[mxy+1]||*mp!=mp[mxy+mx]||*mp!=mp[mxy+mx+1]) add(i+nx*j+nxy*k);
+	}
+	delete [] m;
+	delete [] pp;
+}
+
+/** The class destructor frees the dynamically allocated memory. */
+boundary_blocks::~boundary_blocks() {
+	delete [] mk;
+	delete [] qu;
+}
+
+/** Queues the blocks surrounding a given block that have not been queued
+ * before, wrapping around in the periodic directions.
+ * \param[in] ijk the index of the block. */
+void boundary_blocks::expand(int ijk) {
+	int k=ijk/nxy,j=ijk/nx-ny*k,i=ijk-nx*(j+ny*k),di,dj,dk,ci,cj,ck;
+	for(dk=-1;dk<=1;dk++) {
+		if((ck=step(k+dk,nz,zperiodic))<0) continue;
+		for(dj=-1;dj<=1;dj++) {
+			if((cj=step(j+dj,ny,yperiodic))<0) continue;
+			for(di=-1;di<=1;di++) {
+				if((ci=step(i+di,nx,xperiodic))<0) continue;
+				add(ci+nx*cj+nxy*ck);
+			}
+		}
+	}
+}
+
+/** The class constructor divides the non-empty blocks of a container into
+ * chunks of roughly equal cost, and shares the chunks out evenly among the
+ * threads.
+ * \param[in] con the container class to use.
+ * \param[in] nt_ the number of threads.
+ * \param[in] cpt the number of chunks to create per thread. */
+block_scheduler::block_scheduler(container_base &con,int nt_,int cpt)
+	: nt(nt_), bx(con.nx), bxy(con.nxy), ch(new int[nt_]),
+	ce(new int[nt_]) {
+	setup_chunks(con.co,con.nxyz,NULL,cpt);
+	init_locks();
+	reset();
+}
+
+/** The class constructor divides the non-empty blocks in the primary domain of
+ * a periodic container into chunks of roughly equal cost, and shares the
+ * chunks out evenly among the threads.
+ * \param[in] con the periodic container class to use.
+ * \param[in] nt_ the number of threads.
+ * \param[in] cpt the number of chunks to create per thread. */
+block_scheduler::block_scheduler(container_periodic_base &con,int nt_,int cpt)
+	: nt(nt_), bx(con.nx), bxy(con.nx*con.oy), ch(new int[nt_]),
+	ce(new int[nt_]) {
+	int i,j,k,*ijkl=new int[con.nxyz],*ip=ijkl;
+	for(k=con.ez;k<con.wz;k++) for(j=con.ey;j<con.wy;j++) for(i=0;i<con.nx;i++)
+		*(ip++)=i+bxy*k+bx*j;
+	setup_chunks(con.co,con.nxyz,ijkl,cpt);
+	delete [] ijkl;
+	init_locks();
+	reset();
+}
+
+/** The class constructor divides the non-empty blocks that a subset loop
+ * visits into chunks of roughly equal cost, and shares the chunks out evenly
+ * among the threads. The block list then holds the positions of the blocks in
+ * the subset loop's sequence, rather than block indices, and bx and bxy are
+ * set to zero.
+ * \param[in] vl the subset loop to use, which must have been set up.
+ * \param[in] nt_ the number of threads.
+ * \param[in] cpt the number of chunks to create per thread. */
+block_scheduler::block_scheduler(c_loop_subset &vl,int nt_,int cpt)
+	: nt(nt_), bx(0), bxy(0), ch(new int[nt_]), ce(new int[nt_]) {
+	setup_subset(vl,cpt);
+}
+
+/** The class constructor divides the non-empty blocks that a periodic subset
+ * loop visits into chunks, in the same way as for the non-periodic version.
+ * \param[in] vl the subset loop to use, which must have been set up.
+ * \param[in] nt_ the number of threads.
+ * \param[in] cpt the number of chunks to create per thread. */
+block_scheduler::block_scheduler(c_loop_subset_periodic &vl,int nt_,int cpt)
+	: nt(nt_), bx(0), bxy(0), ch(new int[nt_]), ce(new int[nt_]) {
+	setup_subset(vl,cpt);
+}
+
+/** Assembles the chunks for a subset loop, using the number of particles in
+ * each block that it visits as the cost, and sets up the locks.
+ * \param[in] vl the subset loop to use.
+ * \param[in] cpt the number of chunks to create per thread. */
+template<class c_loop_sub>
+void block_scheduler::setup_subset(c_loop_sub &vl,int cpt) {
+	int s,ns=vl.blocks(),*cost=new int[ns];
+	for(s=0;s<ns;s++) cost[s]=vl.co[vl.block(s)];
+	setup_chunks(cost,ns,NULL,cpt);
+	delete [] cost;
+	init_locks();
+	reset();
+}
+
+/** Allocates and initializes a lock for each thread's range of chunks, if the
+ * code is compiled with OpenMP. */
+void block_scheduler::init_locks() {
+#ifdef _OPENMP
+	omp_lock_t *lp=new omp_lock_t[nt];
+	for(int l=0;l<nt;l++) omp_init_lock(lp+l);
+	lk=lp;
+#else
+	lk=NULL;
+#endif
+}
+
+/** The class destructor frees the dynamically allocated memory. */
+block_scheduler::~block_scheduler() {
+#ifdef _OPENMP
+	omp_lock_t *lp=static_cast<omp_lock_t*>(lk);
+	for(int l=0;l<nt;l++) omp_destroy_lock(lp+l);
+	delete [] lp;
+#endif
+	delete [] cs;
+	delete [] bl;
+	delete [] ce;
+	delete [] ch;
+}
+
+/** Assembles the list of non-empty blocks, and splits it into chunks of
+ * roughly equal cost.
+ * \param[in] co the particle counts of the blocks.
+ * \param[in] nblocks the number of blocks to consider.
+ * \param[in] ijkl an array with the indices of the blocks to consider, or NULL
+ *		  if the blocks are numbered from zero up to nblocks-1.
+ * \param[in] cpt the number of chunks to create per thread. */
+void block_scheduler::setup_chunks(int *co,int nblocks,int *ijkl,int cpt) {
+	int l,ijk;long tot=0,acc=0;
+
+	// Count the non-empty blocks and the total cost
+	nb=0;
+	for(l=0;l<nblocks;l++) {
+		ijk=ijkl==NULL?l:ijkl[l];
+		if(co[ijk]>0) {nb++;tot+=co[ijk];}
+	}
+	bl=new int[nb];
+
+	// Create the block list, starting a new chunk each time the
+	// accumulated cost passes the next multiple of the target chunk cost
+	nc=nt*cpt;if(nc>nb) nc=nb;
+	cs=new int[nc+1];
+	int *blp=bl,c=0;
+	for(l=0;l<nblocks;l++) {
+		ijk=ijkl==NULL?l:ijkl[l];
+		if(co[ijk]>0) {
+			if(c<nc&&acc*nc>=tot*c) cs[c++]=int(blp-bl);
+			*(blp++)=ijk;acc+=co[ijk];
+		}
+	}
+	nc=c;cs[nc]=nb;
+}
+
+/** Resets the scheduler so that all of the chunks can be handed out again,
+ * with each thread being given an equal contiguous range of chunks. */
+void block_scheduler::reset() {
+	for(int l=0;l<nt;l++) {
+		ch[l]=int((long(nc)*l)/nt);
+		ce[l]=int((long(nc)*(l+1))/nt);
+	}
+}
+
+/** Takes a chunk from the front of a thread's range.
+ * \param[in] l the thread whose range to take from.
+ * \param[out] c the chunk that was taken.
+ * \return True if a chunk was available, false otherwise. */
+inline bool block_scheduler::take_front(int l,int &c) {
+	bool f;
+#ifdef _OPENMP
+	omp_set_lock(static_cast<omp_lock_t*>(lk)+l);
+#endif
+	if((f=ch[l]<ce[l])) c=ch[l]++;
+#ifdef _OPENMP
+	omp_unset_lock(static_cast<omp_lock_t*>(lk)+l);
+#endif
+	return f;
+}
+
+/** Steals a chunk from the back of another thread's range.
+ * \param[in] l the thread whose range to take from.
+ * \param[out] c the chunk that was taken.
+ * \return True if a chunk was available, false otherwise. */
+inline bool block_scheduler::take_back(int l,int &c) {
+	bool f;
+#ifdef _OPENMP
+	omp_set_lock(static_cast<omp_lock_t*>(lk)+l);
+#endif
+	if((f=ch[l]<ce[l])) c=--ce[l];
+#ifdef _OPENMP
+	omp_unset_lock(static_cast<omp_lock_t*>(lk)+l);
+#endif
+	return f;
+}
+
+/** Hands out the next chunk of blocks to a thread. The thread's own range is
+ * used first, after which chunks are stolen from the other threads.
+ * \param[in] t the thread number.
+ * \param[out] c the index of the chunk.
+ * \param[out] (b0,b1) the range of positions in the block list that make up
+ *		       the chunk.
+ * \return True if a chunk was found, false if there are no more chunks. */
+bool block_scheduler::next_chunk(int t,int &c,int &b0,int &b1) {
+	int l;c=0;
+	if(!take_front(t,c)) {
+		for(l=t+1;l<t+nt;l++) if(take_back(l%nt,c)) break;
+		if(l==t+nt) return false;
+	}
+	b0=cs[c];b1=cs[c+1];
+	return true;
+}
+
+#ifdef _OPENMP
+/** The class constructor allocates the records for each chunk.
+ * \param[in] fp_ the file handle to write the output to.
+ * \param[in] nc_ the number of chunks. */
+chunk_writer::chunk_writer(FILE *fp_,int nc_) : fp(fp_), nc(nc_), nf(0),
+	buf(new char*[nc_]), len(new size_t[nc_]), ms(new FILE*[nc_]),
+	done(new int[nc_]) {
+	for(int c=0;c<nc;c++) done[c]=0;
+	omp_init_lock(&lk);
+}
+
+/** The class destructor writes out any remaining chunks, and frees the
+ * dynamically allocated memory. */
+chunk_writer::~chunk_writer() {
+	finish();
+	omp_destroy_lock(&lk);
+	delete [] done;
+	delete [] ms;
+	delete [] len;
+	delete [] buf;
+}
+
+/** Opens a memory buffer for a chunk.
+ * \param[in] c the index of the chunk.
+ * \return A file handle that writes into the buffer. */
+FILE* chunk_writer::open(int c) {
+	ms[c]=open_memstream(buf+c,len+c);
+	if(ms[c]==NULL) voro_fatal_error("Unable to open an output buffer",VOROPP_MEMORY_ERROR);
+	return ms[c];
+}
+
+/** Closes the memory buffer for a chunk, marks the chunk as completed, and
+ * flushes any chunks that are ready.
+ * \param[in] c the index of the chunk. */
+void chunk_writer::close(int c) {
+	fclose(ms[c]);
+#pragma omp flush
+#pragma omp atomic write
+	done[c]=1;
+	flush_ready();
+}
+
+/** Writes the buffers for consecutive completed chunks to the output stream.
+ * If another thread is already doing this, then the routine returns
+ * immediately. */
+void chunk_writer::flush_ready() {
+	if(!omp_test_lock(&lk)) return;
+	int d;
+	while(nf<nc) {
+#pragma omp atomic read
+		d=done[nf];
+		if(!d) break;
+#pragma omp flush
+		fwrite(buf[nf],1,len[nf],fp);
+		free(buf[nf]);
+		nf++;
+	}
+	omp_unset_lock(&lk);
+}
+
+/** Writes out all remaining completed chunks. This should be called once all
+ * of the threads have finished. */
+void chunk_writer::finish() {
+	while(nf<nc&&done[nf]) {
+		fwrite(buf[nf],1,len[nf],fp);
+		free(buf[nf]);
+		nf++;
+	}
+}
+#endif
+
 }
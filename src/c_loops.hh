@@ -10,10 +10,22 @@
 #ifndef VOROPP_C_LOOPS_HH
 #define VOROPP_C_LOOPS_HH
 
+#include <cstdio>
+#include <vector>
+
 #include "config.hh"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace voro {
 
+class container_base;
+class container_periodic_base;
+class c_loop_subset;
+class c_loop_subset_periodic;
+
 /** A type associated with a c_loop_subset class, determining what type of
  * geometrical region to loop over. */
 enum c_loop_subset_mode {
@@ -64,8 +76,15 @@ class particle_order {
 			if(op==o+size) add_ordering_memory();
 			*(op++)=ijk;*(op++)=q;
 		}
+		/** Removes all of the records from the order, keeping the
+		 * allocated memory. */
+		inline void clear() {op=o;}
+		void add_morton(container_base &con);
+		void add_morton(container_periodic_base &con);
 	private:
 		void add_ordering_memory();
+		void add_morton_blocks(int nx,int ny,int nz,int ijk0,int sz,int *co,fpoint **p,int ps,
+				       double ax,double ay,double az,double xsp,double ysp,double zsp);
 };
 
 /** \brief Base class for looping over particles in a container.
@@ -95,10 +114,10 @@ class c_loop_base {
 		const int ps;
 		/** A pointer to the particle position information in the
 		 * associated container data structure. */
-		double **p;
+		fpoint **p;
 		/** A pointer to the particle ID information in the associated
 		 * container data structure. */
-		int **id;
+		voro_id **id;
 		/** A pointer to the particle counts in the associated
 		 * container data structure. */
 		int *co;
@@ -128,7 +147,7 @@ class c_loop_base {
 		 * considered by the loop.
 		 * \param[out] (x,y,z) the position vector of the particle. */
 		inline void pos(double &x,double &y,double &z) {
-			double *pp=p[ijk]+ps*q;
+			fpoint *pp=p[ijk]+ps*q;
 			x=*(pp++);y=*(pp++);z=*pp;
 		}
 		/** Returns the ID, position vector, and radius of the particle
@@ -138,9 +157,9 @@ class c_loop_base {
 		 * \param[out] r the radius of the particle. If no radius
 		 * 		 information is available the default radius
 		 * 		 value is returned. */
-		inline void pos(int &pid,double &x,double &y,double &z,double &r) {
+		inline void pos(voro_id &pid,double &x,double &y,double &z,double &r) {
 			pid=id[ijk][q];
-			double *pp=p[ijk]+ps*q;
+			fpoint *pp=p[ijk]+ps*q;
 			x=*(pp++);y=*(pp++);z=*pp;
 			r=ps==3?default_radius:*(++pp);
 		}
@@ -155,7 +174,7 @@ class c_loop_base {
 		inline double z() {return p[ijk][ps*q+2];}
 		/** Returns the ID of the particle currently being considered
 		 * by the loop. */
-		inline int pid() {return id[ijk][q];}
+		inline voro_id pid() {return id[ijk][q];}
 };
 
 /** \brief Class for looping over all of the particles in a container.
@@ -174,7 +193,113 @@ class c_loop_all : public c_loop_base {
 		 * otherwise. */
 		inline bool start() {
 			i=j=k=ijk=q=0;
-			while(co[ijk]==0) if(!next_block()) return false;
+			return co[ijk]>0||next_block();
+		}
+		/** Finds the next particle to test.
+		 * \return True if there is another particle, false if no more
+		 * particles are available. */
+		inline bool inc() {
+			q++;
+			if(q>=co[ijk]) {
+				q=0;
+				return next_block();
+			}
+			return true;
+		}
+	private:
+		/** Updates the internal variables to find the next
+		 * computational block with any particles. The empty blocks are
+		 * passed over by only checking their particle counts, and the
+		 * block coordinates are computed once the next block with
+		 * particles is found.
+		 * \return True if another block is found, false if there are
+		 * no more blocks. */
+		inline bool next_block() {
+			do {
+				if(++ijk==nxyz) return false;
+			} while(co[ijk]==0);
+			k=ijk/nxy;
+			j=ijk/nx-ny*k;
+			i=ijk-nx*(j+ny*k);
+			return true;
+		}
+};
+
+/** Compares two sets of non-negative integer coordinates by their position
+ * along a Morton curve, which interleaves the bits of the coordinates with the
+ * z coordinate as the most significant. The comparison is done without
+ * forming the interleaved codes, by finding the coordinate whose most
+ * significant differing bit is highest.
+ * \param[in] (i0,j0,k0) the first set of coordinates.
+ * \param[in] (i1,j1,k1) the second set of coordinates.
+ * \return True if the first set comes before the second, false otherwise. */
+inline bool morton_less(int i0,int j0,int k0,int i1,int j1,int k1) {
+	int x=k0^k1,y=j0^j1,d=2;
+	if(x<y&&x<(x^y)) {x=y;d=1;}
+	y=i0^i1;
+	if(x<y&&x<(x^y)) d=0;
+	return d==2?k0<k1:(d==1?j0<j1:i0<i1);
+}
+
+/** Converts a position within a block, as a fraction of the block width, into
+ * an integer coordinate for sorting along a Morton curve.
+ * \param[in] f the fractional position.
+ * \return The integer coordinate. */
+inline int morton_quantize(double f) {
+	int q=int(f*1024);
+	return q<0?0:(q>1023?1023:q);
+}
+
+/** \brief A function object for sorting the particles of a block along a
+ * Morton curve. */
+struct morton_particle_cmp {
+	/** The quantized coordinates of the particles, in groups of three. */
+	const int *qc;
+	morton_particle_cmp(const int *qc_) : qc(qc_) {}
+	/** Compares two particles by their position along the Morton curve.
+	 * \param[in] (a,b) the indices of the particles.
+	 * \return True if the first particle comes first, false otherwise. */
+	inline bool operator()(int a,int b) const {
+		const int *ap=qc+3*a,*bp=qc+3*b;
+		return morton_less(*ap,ap[1],ap[2],*bp,bp[1],bp[2]);
+	}
+};
+
+void morton_block_order(int nx,int ny,int nz,int *bo);
+
+/** \brief Class for looping over all of the particles in a container, visiting
+ * the blocks along a Morton curve.
+ *
+ * The c_loop_all class visits the blocks in order of their index, so that
+ * consecutive blocks in the y and z directions are far apart in the loop, and
+ * the neighboring blocks that are searched by successive Voronoi cell
+ * computations overlap less. This class visits the blocks along a Morton
+ * curve instead, so that the blocks near each other in the loop are near each
+ * other in space. The order is computed when the class is constructed, and
+ * the particles within each block are visited in order. The class can be used
+ * with the container and container_poly classes, and works best together with
+ * the sort_morton() routine of these classes, which arranges the particle
+ * memory along the same curve. */
+class c_loop_morton : public c_loop_base {
+	public:
+		/** The constructor copies several necessary constants from the
+		 * base container class, and computes the order in which to
+		 * visit the blocks.
+		 * \param[in] con the container class to use. */
+		template<class c_class>
+		c_loop_morton(c_class &con) : c_loop_base(con), bo(new int[con.nxyz]) {
+			morton_block_order(nx,ny,nz,bo);
+		}
+		/** The class destructor frees the block order. */
+		~c_loop_morton() {delete [] bo;}
+		/** Sets the class to consider the first particle.
+		 * \return True if there is any particle to consider, false
+		 * otherwise. */
+		inline bool start() {
+			b=-1;q=0;
+			do {
+				if(!next_block()) return false;
+			} while(co[ijk]==0);
 			return true;
 		}
 		/** Finds the next particle to test.
@@ -191,22 +316,265 @@ class c_loop_all : public c_loop_base {
 			return true;
 		}
 	private:
-		/** Updates the internal variables to find the next
-		 * computational block with any particles.
+		/** The block indices in the order that they are visited. */
+		int *bo;
+		/** The current position in the block order. */
+		int b;
+		/** Moves to the next block in the order, and computes its
+		 * indices in the x, y, and z directions.
 		 * \return True if another block is found, false if there are
 		 * no more blocks. */
 		inline bool next_block() {
-			ijk++;
-			i++;
-			if(i==nx) {
-				i=0;j++;
-				if(j==ny) {
-					j=0;k++;
-					if(ijk==nxyz) return false;
-				}
+			if(++b==nxyz) return false;
+			ijk=bo[b];
+			k=ijk/nxy;
+			int ijkt=ijk-nxy*k;
+			j=ijkt/nx;
+			i=ijkt-j*nx;
+			return true;
+		}
+};
+
+/** \brief A class for sharing out the computational blocks of a container
+ * among several threads.
+ *
+ * This class divides the non-empty blocks of a container into chunks of
+ * consecutive blocks, using the number of particles in each block as an
+ * estimate of its cost, so that each chunk carries roughly the same amount of
+ * work. Each thread is initially given a contiguous range of chunks. Threads
+ * take chunks from the front of their own range, and once it is exhausted they
+ * steal chunks from the back of the other threads' ranges. This keeps the
+ * threads busy even for highly clustered particle arrangements. The class is
+ * used by the c_loop_parallel class. */
+class block_scheduler {
+	public:
+		/** The number of threads that the blocks are shared among. */
+		const int nt;
+		/** The number of non-empty blocks. */
+		int nb;
+		/** The number of chunks. */
+		int nc;
+		/** The indices of the non-empty blocks, in the order that they
+		 * are visited. */
+		int *bl;
+		/** The number of blocks in the x direction, used to decode
+		 * the block indices. */
+		const int bx;
+		/** The number of blocks in a z-slice, used to decode the
+		 * block indices. */
+		const int bxy;
+		block_scheduler(container_base &con,int nt_,int cpt=sched_chunks_per_thread);
+		block_scheduler(container_periodic_base &con,int nt_,int cpt=sched_chunks_per_thread);
+		block_scheduler(c_loop_subset &vl,int nt_,int cpt=sched_chunks_per_thread);
+		block_scheduler(c_loop_subset_periodic &vl,int nt_,int cpt=sched_chunks_per_thread);
+		~block_scheduler();
+		void reset();
+		bool next_chunk(int t,int &c,int &b0,int &b1);
+		/** Finds the range of positions in the block list that a
+		 * thread is given when the scheduler is reset, before any
+		 * chunks are stolen by the other threads.
+		 * \param[in] t the thread number.
+		 * \param[out] (b0,b1) the range of positions. */
+		inline void thread_range(int t,int &b0,int &b1) {
+			b0=cs[int((long(nc)*t)/nt)];
+			b1=cs[int((long(nc)*(t+1))/nt)];
+		}
+	private:
+		/** The positions in bl where each chunk starts, plus a final
+		 * entry marking the end of the last chunk. */
+		int *cs;
+		/** The first chunk remaining in each thread's range. */
+		int *ch;
+		/** The end of each thread's range of chunks. */
+		int *ce;
+		/** Locks protecting each thread's range of chunks. They are
+		 * only allocated if the library is compiled with OpenMP, and
+		 * are kept opaque so that the class layout does not depend on
+		 * the compilation flags of the code that includes this
+		 * header. */
+		void *lk;
+		void init_locks();
+		void setup_chunks(int *co,int nblocks,int *ijkl,int cpt);
+		template<class c_loop_sub>
+		void setup_subset(c_loop_sub &vl,int cpt);
+		inline bool take_front(int t,int &c);
+		inline bool take_back(int t,int &c);
+};
+
+#ifdef _OPENMP
+/** \brief A class for writing output from the chunks of a block_scheduler in
+ * order.
+ *
+ * When the chunks of a block_scheduler are processed by several threads, they
+ * are completed in an unpredictable order. This class gives each chunk its own
+ * memory buffer to write into. When a chunk is finished, the buffers of all
+ * consecutive finished chunks are flushed to the output stream, so that the
+ * output appears in the same order as a serial loop over the blocks. A thread
+ * that finds another thread already flushing does not wait for it, so the
+ * output stream never serializes the computation. */
+class chunk_writer {
+	public:
+		chunk_writer(FILE *fp_,int nc_);
+		~chunk_writer();
+		FILE* open(int c);
+		void close(int c);
+		void finish();
+	private:
+		/** The file handle to write the output to. */
+		FILE *fp;
+		/** The number of chunks. */
+		const int nc;
+		/** The next chunk to be flushed to the output stream. */
+		int nf;
+		/** The memory buffers for each chunk. */
+		char **buf;
+		/** The lengths of the memory buffers for each chunk. */
+		size_t *len;
+		/** The memory streams for each chunk that is being written. */
+		FILE **ms;
+		/** Flags recording which chunks have been completed. */
+		int *done;
+		/** A lock that is held by the thread that is flushing. */
+		omp_lock_t lk;
+		void flush_ready();
+};
+#endif
+
+/** \brief Class for looping over all of the particles in a container, with the
+ * blocks shared out among several threads.
+ *
+ * Each thread creates its own instance of this class, referring to a common
+ * block_scheduler. The instance then loops over all of the particles in the
+ * chunks of blocks that the scheduler hands out to that thread. When all
+ * threads have finished, every particle in the container has been visited
+ * exactly once. */
+class c_loop_parallel : public c_loop_base {
+	public:
+		/** A reference to the block scheduler to use. */
+		block_scheduler &bs;
+		/** The thread number. */
+		const int t;
+		/** The constructor copies several necessary constants from the
+		 * base container class.
+		 * \param[in] con the container class to use.
+		 * \param[in] bs_ the block scheduler to use.
+		 * \param[in] t_ the thread number, between zero and one less
+		 *		than the number of threads in the scheduler. */
+		template<class c_class>
+		c_loop_parallel(c_class &con,block_scheduler &bs_,int t_)
+			: c_loop_base(con), bs(bs_), t(t_) {}
+		/** The index of the chunk currently being looped over. */
+		int chunk;
+		/** Sets the class to consider the first particle.
+		 * \return True if there is any particle to consider, false
+		 * otherwise. */
+		inline bool start() {return start_chunk();}
+		/** Finds the next particle to test.
+		 * \return True if there is another particle, false if no more
+		 * particles are available. */
+		inline bool inc() {
+			return inc_chunk()||start_chunk();
+		}
+		/** Requests a new chunk of blocks from the scheduler, and sets
+		 * the class to consider its first particle.
+		 * \return True if a chunk was found, false if there are no
+		 * more chunks. */
+		inline bool start_chunk() {
+			if(!bs.next_chunk(t,chunk,b,be)) return false;
+			q=0;decode();
+			return true;
+		}
+		/** Finds the next particle to test within the current chunk.
+		 * \return True if there is another particle, false if the end
+		 * of the chunk has been reached. */
+		inline bool inc_chunk() {
+			q++;
+			if(q>=co[ijk]) {
+				q=0;b++;
+				if(b==be) return false;
+				decode();
 			}
 			return true;
 		}
+	private:
+		/** The current position in the scheduler's block list. */
+		int b;
+		/** The end of the current chunk in the scheduler's block list. */
+		int be;
+		/** Sets the block index from the current position in the block
+		 * list, and computes indices in the x, y, and z directions. */
+		inline void decode() {
+			ijk=bs.bl[b];
+			k=ijk/bs.bxy;
+			int ijkt=ijk-bs.bxy*k;
+			j=ijkt/bs.bx;
+			i=ijkt-j*bs.bx;
+		}
+};
+
+/** \brief A class for finding the blocks of a container that may hold cells
+ * reaching its boundary.
+ *
+ * This class is used by the for_each_boundary_cell() routine to compute only
+ * the cells that reach a wall or a non-periodic face of the container. It
+ * hands out the blocks from a queue. The queue starts with the blocks on the
+ * non-periodic faces of the container, and the blocks that a wall passes
+ * through, which are found by testing whether the walls put some of the
+ * corners of a block inside and some outside. Once the cells of a block have
+ * been computed, the caller reports whether any of them reached a wall, in
+ * which case the neighboring blocks that have not been queued yet are added,
+ * so that the search works its way inwards only as far as the boundary cells
+ * reach. Empty blocks always pass the search on, since they give no
+ * information. A wall that lies entirely within a single block, without
+ * separating its corners, is only found if the search reaches that block from
+ * elsewhere. */
+class boundary_blocks {
+	public:
+		boundary_blocks(container_base &con);
+		~boundary_blocks();
+		/** Finds the next block to consider.
+		 * \param[out] ijk the index of the block.
+		 * \return True if there is another block, false if the queue
+		 * is exhausted. */
+		inline bool next(int &ijk) {
+			if(qp==qe) return false;
+			ijk=*(qp++);
+			return true;
+		}
+		void expand(int ijk);
+		/** Returns the number of blocks that have been queued so far. */
+		inline int queued() {return int(qe-qu);}
+	private:
+		/** The number of blocks in each direction. */
+		const int nx,ny,nz;
+		/** The number of blocks in a z-slice. */
+		const int nxy;
+		/** The periodicity in each direction. */
+		const bool xperiodic,yperiodic,zperiodic;
+		/** The queue of blocks, which has room for every block since
+		 * each one is queued at most once. */
+		int *qu;
+		/** The position of the next block to hand out. */
+		int *qp;
+		/** The end of the queue. */
+		int *qe;
+		/** Flags recording which blocks have been queued. */
+		unsigned char *mk;
+		/** Adds a block to the queue, if it has not been queued
+		 * before.
+		 * \param[in] ijk the index of the block. */
+		inline void add(int ijk) {
+			if(mk[ijk]==0) {mk[ijk]=1;*(qe++)=ijk;}
+		}
+		/** Wraps a block coordinate into range.
+		 * \param[in] a the block coordinate.
+		 * \param[in] n the number of blocks in this direction.
+		 * \param[in] periodic whether this direction is periodic.
+		 * \return The wrapped coordinate, or -1 if it lies outside a
+		 * non-periodic direction. */
+		inline int step(int a,int n,bool periodic) {
+			return a<0?(periodic?a+n:-1):(a>=n?(periodic?a-n:-1):a);
+		}
 };
 
 /** \brief Class for looping over a subset of particles in a container.
@@ -242,6 +610,20 @@ class c_loop_subset : public c_loop_base {
 			} while(mode!=no_check&&out_of_bounds());
 			return true;
 		}
+		/** Returns the number of blocks that the loop visits, which
+		 * is used to share them out among several threads.
+		 * \return The number of blocks. */
+		inline int blocks() {return (bi-ai+1)*(bj-aj+1)*(bk-ak+1);}
+		int block(int s);
+	protected:
+		bool start_block(int s);
+		/** Finds the next particle to test within the current block.
+		 * \return True if there is another particle, false if the end
+		 * of the block has been reached. */
+		inline bool inc_block() {
+			q++;
+			return find_block();
+		}
 	private:
 		const double ax,ay,az,sx,sy,sz,xsp,ysp,zsp;
 		const bool xperiodic,yperiodic,zperiodic;
@@ -255,6 +637,161 @@ class c_loop_subset : public c_loop_base {
 		void setup_common();
 		bool next_block();
 		bool out_of_bounds();
+		/** Moves forward from the current particle to the first one
+		 * in the current block that passes the bounds test.
+		 * \return True if a particle was found, false if the end of
+		 * the block was reached. */
+		inline bool find_block() {
+			while(q<co[ijk]) {
+				if(mode==no_check||!out_of_bounds()) return true;
+				q++;
+			}
+			return false;
+		}
+};
+
+/** \brief Class for looping over a subset of particles in a container_periodic
+ * or container_periodic_poly class.
+ *
+ * This class loops over the particles in a rectangular box or sphere, in the
+ * same way as the c_loop_subset class. The region may extend outside the
+ * primary domain, in which case it is split into pieces, one for each periodic
+ * image of the primary domain that it overlaps, and the loop visits the blocks
+ * of the primary domain that each piece covers. The periodic image blocks are
+ * therefore never looped over, and are only constructed as they are needed by
+ * the cells that are computed, so the cost depends on the size of the region
+ * rather than the size of the container. A particle is visited once for each
+ * of its periodic images that lies within the region. The particle positions
+ * are reported in the primary domain. */
+class c_loop_subset_periodic : public c_loop_base {
+	public:
+		/** The current mode of operation, determining whether tests
+		 * should be applied to particles to ensure they are within a
+		 * certain geometrical object. */
+		c_loop_subset_mode mode;
+		/** The constructor copies several necessary constants from the
+		 * base periodic container class.
+		 * \param[in] con the periodic container class to use. */
+		template<class c_class>
+		c_loop_subset_periodic(c_class &con) : c_loop_base(con), bx(con.bx), bxy(con.bxy), by(con.by),
+			bxz(con.bxz), byz(con.byz), bz(con.bz), xsp(con.xsp), ysp(con.ysp), zsp(con.zsp),
+			ey(con.ey), ez(con.ez), oy(con.oy), ns(0) {}
+		void setup_sphere(double vx,double vy,double vz,double r,bool bounds_test=true);
+		void setup_box(double xmin,double xmax,double ymin,double ymax,double zmin,double zmax,bool bounds_test=true);
+		bool start();
+		/** Finds the next particle to test.
+		 * \return True if there is another particle, false if no more
+		 * particles are available. */
+		inline bool inc() {
+			if(inc_block()) return true;
+			while(++sn<ns) if(start_block(sn)) return true;
+			return false;
+		}
+		/** Returns the number of blocks that the loop visits, which
+		 * is used to share them out among several threads.
+		 * \return The number of blocks. */
+		inline int blocks() {return ns;}
+		int block(int s);
+	protected:
+		bool start_block(int s);
+		/** Finds the next particle to test within the current block.
+		 * \return True if there is another particle, false if the end
+		 * of the block has been reached. */
+		inline bool inc_block() {
+			q++;
+			return find_block();
+		}
+	private:
+		const double bx,bxy,by,bxz,byz,bz,xsp,ysp,zsp;
+		const int ey,ez,oy;
+		double px,py,pz;
+		double v0,v1,v2,v3,v4,v5;
+		/** The number of blocks that the loop visits. */
+		int ns;
+		/** The position of the current block in the loop's sequence.
+		 */
+		int sn;
+		/** The ranges of primary blocks covered by each piece of the
+		 * region, as six inclusive limits in the x, y, and z
+		 * directions. */
+		std::vector<int> pr;
+		/** The position in the loop's sequence of the first block of
+		 * each piece, plus a final entry giving the total. */
+		std::vector<int> po;
+		/** The periodic displacement of each piece, as three doubles.
+		 */
+		std::vector<double> pd;
+		inline int step_int(double a) {return a<0?int(a)-1:int(a);}
+		inline int clamp(int a,int n) {return a<0?0:(a>=n?n-1:a);}
+		void setup_pieces(double xl,double xh,double yl,double yh,double zl,double zh);
+		int find_piece(int s,int &l);
+		bool out_of_bounds();
+		/** Moves forward from the current particle to the first one
+		 * in the current block that passes the bounds test.
+		 * \return True if a particle was found, false if the end of
+		 * the block was reached. */
+		inline bool find_block() {
+			while(q<co[ijk]) {
+				if(mode==no_check||!out_of_bounds()) return true;
+				q++;
+			}
+			return false;
+		}
+};
+
+/** \brief Class for looping over a subset of particles with several threads.
+ *
+ * Each thread creates its own instance of this class, copied from a subset loop
+ * that has been set up, and referring to a common block_scheduler that was
+ * made from the same loop. The instance then loops over the particles in the
+ * chunks of blocks that the scheduler hands out to that thread. When all
+ * threads have finished, every particle that the subset loop visits has been
+ * visited exactly once.
+ * \tparam c_loop_sub the subset loop class, which can be c_loop_subset or
+ *		      c_loop_subset_periodic. */
+template<class c_loop_sub>
+class c_loop_subset_parallel : public c_loop_sub {
+	public:
+		/** A reference to the block scheduler to use. */
+		block_scheduler &bs;
+		/** The thread number. */
+		const int t;
+		/** The index of the chunk currently being looped over. */
+		int chunk;
+		/** The constructor copies the setup of a subset loop.
+		 * \param[in] vl the subset loop to copy.
+		 * \param[in] bs_ the block scheduler to use, which must have
+		 *		 been made from the same subset loop.
+		 * \param[in] t_ the thread number, between zero and one less
+		 *		than the number of threads in the scheduler. */
+		c_loop_subset_parallel(const c_loop_sub &vl,block_scheduler &bs_,int t_)
+			: c_loop_sub(vl), bs(bs_), t(t_) {}
+		/** Sets the class to consider the first particle.
+		 * \return True if there is any particle to consider, false
+		 * otherwise. */
+		inline bool start() {return start_chunk();}
+		/** Finds the next particle to test.
+		 * \return True if there is another particle, false if no more
+		 * particles are available. */
+		inline bool inc() {
+			if(this->inc_block()) return true;
+			while(++b<be) if(this->start_block(bs.bl[b])) return true;
+			return start_chunk();
+		}
+	private:
+		/** The current position in the scheduler's block list. */
+		int b;
+		/** The end of the current chunk in the scheduler's block list. */
+		int be;
+		/** Requests new chunks of blocks from the scheduler until one
+		 * is found with a particle to consider.
+		 * \return True if a particle was found, false if there are no
+		 * more chunks. */
+		inline bool start_chunk() {
+			while(bs.next_chunk(t,chunk,b,be))
+				for(;b<be;b++) if(this->start_block(bs.bl[b])) return true;
+			return false;
+		}
 };
 
 /** \brief Class for looping over all of the particles specified in a
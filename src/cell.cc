@@ -13,46 +13,134 @@
 #include "config.hh"
 #include "common.hh"
 #include "cell.hh"
+#include "trace.hh"
 
 namespace voro {
 
-/** Constructs a Voronoi cell and sets up the initial memory. */
-voronoicell_base::voronoicell_base(double max_len_sq) :
-	current_vertices(init_vertices), current_vertex_order(init_vertex_order),
+/** The class constructor sets up an empty arena. No memory is allocated until
+ * it is first needed.
+ * \param[in] chunk_size_ the minimum size in bytes of each chunk. */
+cell_arena::cell_arena(size_t chunk_size_) : chunk_size(chunk_size_), cc(-1), cp(NULL), ce(NULL) {}
+
+/** The class destructor frees all of the chunks. */
+cell_arena::~cell_arena() {
+	for(int i=ch.size()-1;i>=0;i--) delete [] ch[i];
+}
+
+/** Allocates a block of memory from the arena.
+ * \param[in] n the number of bytes to allocate.
+ * \return A pointer to the memory, which is aligned for any of the types
+ *         that the Voronoi cell classes use. */
+void* cell_arena::allocate(size_t n) {
+	n=(n+15)&~static_cast<size_t>(15);
+	if(static_cast<size_t>(ce-cp)<n||cc<0) next_chunk(n);
+	void *q=cp;cp+=n;
+	return q;
+}
+
+/** Moves to the next chunk that can hold a given number of bytes, reusing a
+ * chunk that was allocated before the last release if possible.
+ * \param[in] n the number of bytes. */
+void cell_arena::next_chunk(size_t n) {
+	int nc=ch.size();
+	while(++cc<nc) if(cs[cc]>=n) break;
+	if(cc==nc) {
+		size_t sz=n>chunk_size?n:chunk_size;
+		ch.push_back(new char[sz]);
+		cs.push_back(sz);
+	}
+	cp=ch[cc];ce=cp+cs[cc];
+}
+
+/** Makes all of the memory in the arena available for reuse, without freeing
+ * it. All of the cells that were using the arena must have been destroyed
+ * beforehand. */
+void cell_arena::release() {
+	cc=-1;cp=ce=NULL;
+}
+
+/** Constructs a Voronoi cell and sets up the initial memory.
+ * \param[in] max_len_sq the maximum length squared, which sets the tolerance.
+ * \param[in] arena_ a pointer to an arena to allocate the memory from, or NULL
+ *		     to allocate it individually. */
+voronoicell_base::voronoicell_base(double max_len_sq,cell_arena *arena_) :
+	arena(arena_), current_vertices(init_vertices), current_vertex_order(init_vertex_order),
 	current_delete_size(init_delete_size), current_delete2_size(init_delete2_size),
 	current_xsearch_size(init_xsearch_size),
-	ed(new int*[current_vertices]), nu(new int[current_vertices]),
-	mask(new unsigned int[current_vertices]),
-	pts(new double[current_vertices<<2]), tol(tolerance*max_len_sq),
-	tol_cu(tol*sqrt(tol)), big_tol(big_tolerance_fac*tol), mem(new int[current_vertex_order]),
-	mec(new int[current_vertex_order]),
-	mep(new int*[current_vertex_order]), ds(new int[current_delete_size]),
-	stacke(ds+current_delete_size), ds2(new int[current_delete2_size]),
-	stacke2(ds2+current_delete2_size), xse(new int[current_xsearch_size]),
-	stacke3(xse+current_xsearch_size), maskc(0) {
+	ed(v_new<int*>(current_vertices)), nu(v_new<int>(current_vertices)),
+	mask(v_new<unsigned int>(current_vertices)),
+	pts(v_new<fpoint>(current_vertices<<2)), tol(tolerance*max_len_sq),
+	tol_cu(tol*sqrt(tol)), big_tol(big_tolerance_fac*tol), robust(false),
+	vertex_limit(max_vertices), order_limit(max_vertex_order), over_budget(false), mem(v_new<int>(current_vertex_order)),
+	mec(v_new<int>(current_vertex_order)),
+	mep(v_new<int*>(current_vertex_order)), ds(v_new<int>(current_delete_size)),
+	stacke(ds+current_delete_size), ds2(v_new<int>(current_delete2_size)),
+	stacke2(ds2+current_delete2_size), xse(v_new<int>(current_xsearch_size)),
+	stacke3(xse+current_xsearch_size), maskc(0), mrs_ok(false) {
 	int i;
+	p=up=0;
 	for(i=0;i<current_vertices;i++) mask[i]=0;
 	for(i=0;i<3;i++) {
 		mem[i]=init_n_vertices;mec[i]=0;
-		mep[i]=new int[init_n_vertices*((i<<1)+1)];
+		mep[i]=v_new<int>(init_n_vertices*((i<<1)+1));
 	}
 	mem[3]=init_3_vertices;mec[3]=0;
-	mep[3]=new int[init_3_vertices*7];
+	mep[3]=v_new<int>(init_3_vertices*7);
 	for(i=4;i<current_vertex_order;i++) {
 		mem[i]=init_n_vertices;mec[i]=0;
-		mep[i]=new int[init_n_vertices*((i<<1)+1)];
+		mep[i]=v_new<int>(init_n_vertices*((i<<1)+1));
 	}
 }
 
 /** The voronoicell destructor deallocates all the dynamic memory. */
 voronoicell_base::~voronoicell_base() {
-	for(int i=current_vertex_order-1;i>=0;i--) if(mem[i]>0) delete [] mep[i];
-	delete [] xse;
-	delete [] ds2;delete [] ds;
-	delete [] mep;delete [] mec;
-	delete [] mem;delete [] pts;
-	delete [] mask;
-	delete [] nu;delete [] ed;
+	for(int i=current_vertex_order-1;i>=0;i--) if(mem[i]>0) v_delete(mep[i]);
+	v_delete(xse);
+	v_delete(ds2);v_delete(ds);
+	v_delete(mep);v_delete(mec);
+	v_delete(mem);v_delete(pts);
+	v_delete(mask);
+	v_delete(nu);v_delete(ed);
+}
+
+/** Returns the memory used by the cell's vertices, edges, and stacks. Since
+ * the memory of a cell only grows, this is also the largest amount that the
+ * cell has used. If the cell allocates from an arena, then the arena also
+ * holds the arrays that were replaced as the cell grew, and
+ * cell_arena::total_memory() gives the true amount.
+ * \return The number of bytes. */
+size_t voronoicell_base::memory_used() {
+	size_t s=current_vertices*(sizeof(int*)+sizeof(int)+sizeof(unsigned int)+4*sizeof(fpoint))
+		+current_vertex_order*(2*sizeof(int)+sizeof(int*))
+		+(current_delete_size+current_delete2_size+current_xsearch_size)*sizeof(int);
+	for(int i=0;i<current_vertex_order;i++) s+=size_t(mem[i])*((i<<1)+1)*sizeof(int);
+	return s;
+}
+
+/** Exchanges the memory and the state of this cell with another one. This is
+ * used by the swap routines of the derived classes, which also exchange any
+ * memory of their own.
+ * \param[in] c the cell to exchange with. */
+void voronoicell_base::swap_base(voronoicell_base &c) {
+	if(arena!=c.arena) voro_fatal_error("Voronoi cells with different arenas can not be swapped",VOROPP_INTERNAL_ERROR);
+	std::swap(current_vertices,c.current_vertices);
+	std::swap(current_vertex_order,c.current_vertex_order);
+	std::swap(current_delete_size,c.current_delete_size);
+	std::swap(current_delete2_size,c.current_delete2_size);
+	std::swap(current_xsearch_size,c.current_xsearch_size);
+	std::swap(p,c.p);std::swap(up,c.up);
+	std::swap(ed,c.ed);std::swap(nu,c.nu);std::swap(mask,c.mask);std::swap(pts,c.pts);
+	std::swap(tol,c.tol);std::swap(tol_cu,c.tol_cu);std::swap(big_tol,c.big_tol);
+	std::swap(robust,c.robust);std::swap(counters,c.counters);
+	std::swap(vertex_limit,c.vertex_limit);std::swap(order_limit,c.order_limit);
+	std::swap(over_budget,c.over_budget);
+	std::swap(mem,c.mem);std::swap(mec,c.mec);std::swap(mep,c.mep);
+	std::swap(ds,c.ds);std::swap(stackp,c.stackp);std::swap(stacke,c.stacke);
+	std::swap(ds2,c.ds2);std::swap(stackp2,c.stackp2);std::swap(stacke2,c.stacke2);
+	std::swap(xse,c.xse);std::swap(stackp3,c.stackp3);std::swap(stacke3,c.stacke3);
+	std::swap(maskc,c.maskc);
+	std::swap(mrs,c.mrs);std::swap(mrx,c.mrx);std::swap(mry,c.mry);std::swap(mrz,c.mrz);
+	std::swap(mrs_ok,c.mrs_ok);
 }
 
 /** Ensures that enough memory is allocated prior to carrying out a copy.
@@ -60,6 +148,8 @@ voronoicell_base::~voronoicell_base() {
  * \param[in] vb a pointered to the class to be copied. */
 template<class vc_class>
 void voronoicell_base::check_memory_for_copy(vc_class &vc,voronoicell_base* vb) {
+	if(vertex_limit<vb->current_vertices) vertex_limit=vb->current_vertices;
+	if(order_limit<vb->current_vertex_order) order_limit=vb->current_vertex_order;
 	while(current_vertex_order<vb->current_vertex_order) add_memory_vorder(vc);
 	for(int i=0;i<current_vertex_order;i++) while(mem[i]<vb->mec[i]) add_memory(vc,i);
 	while(current_vertices<vb->p) add_memory_vertices(vc);
@@ -70,7 +160,7 @@ void voronoicell_base::check_memory_for_copy(vc_class &vc,voronoicell_base* vb)
  * \param[in] vb a pointer to the class to copy. */
 void voronoicell_base::copy(voronoicell_base* vb) {
 	int i,j;
-	p=vb->p;up=0;
+	p=vb->p;up=0;mrs_ok=false;
 	for(i=0;i<current_vertex_order;i++) {
 		mec[i]=vb->mec[i];
 		for(j=0;j<mec[i]*(2*i+1);j++) mep[i][j]=vb->mep[i][j];
@@ -109,8 +199,8 @@ void voronoicell_neighbor::operator=(voronoicell_neighbor &c) {
 /** Translates the vertices of the Voronoi cell by a given vector.
  * \param[in] (x,y,z) the coordinates of the vector. */
 void voronoicell_base::translate(double x,double y,double z) {
-	x*=2;y*=2;z*=2;
-	double *ptsp=pts;
+	x*=2;y*=2;z*=2;mrs_ok=false;
+	fpoint *ptsp=pts;
 	while(ptsp<pts+(p<<2)) {
 		*(ptsp++)+=x;*(ptsp++)+=y;*ptsp+=z;ptsp+=2;
 	}
@@ -130,9 +220,10 @@ void voronoicell_base::translate(double x,double y,double z) {
 template<class vc_class>
 void voronoicell_base::add_memory(vc_class &vc,int i) {
 	int s=(i<<1)+1;
+	VOROPP_COUNT(counters.memory_grows++);
 	if(mem[i]==0) {
 		vc.n_allocate(i,init_n_vertices);
-		mep[i]=new int[init_n_vertices*s];
+		mep[i]=v_new<int>(init_n_vertices*s);
 		mem[i]=init_n_vertices;
 #if VOROPP_VERBOSE >=2
 		fprintf(stderr,"Order %d vertex memory created\n",i);
@@ -144,7 +235,7 @@ void voronoicell_base::add_memory(vc_class &vc,int i) {
 #if VOROPP_VERBOSE >=2
 		fprintf(stderr,"Order %d vertex memory scaled up to %d\n",i,mem[i]);
 #endif
-		l=new int[s*mem[i]];
+		l=v_new<int>(s*mem[i]);
 		int m=0;
 		vc.n_allocate_aux1(i);
 		while(j<s*mec[i]) {
@@ -178,66 +269,84 @@ void voronoicell_base::add_memory(vc_class &vc,int i) {
 			for(k=0;k<s;k++,j++) l[j]=mep[i][j];
 			for(k=0;k<i;k++,m++) vc.n_copy_to_aux1(i,m);
 		}
-		delete [] mep[i];
+		v_delete(mep[i]);
 		mep[i]=l;
 		vc.n_switch_to_aux1(i);
 	}
 }
 
 /** Doubles the maximum number of vertices allowed, by reallocating the ed, nu,
- * and pts arrays. If the allocation exceeds the absolute maximum set in
- * max_vertices, then the routine exits with a fatal error. If the template has
- * been instantiated with the neighbor tracking turned on, then the routine
- * also reallocates the ne array. */
+ * and pts arrays. If the allocation exceeds the cell's budget set in
+ * vertex_limit, then the memory is left alone, and the cell is emptied and
+ * flagged as over budget. If the template has been instantiated with the
+ * neighbor tracking turned on, then the routine also reallocates the ne array.
+ * \return False if the budget was exceeded, true otherwise. */
 template<class vc_class>
-void voronoicell_base::add_memory_vertices(vc_class &vc) {
+bool voronoicell_base::add_memory_vertices(vc_class &vc) {
 	int i=(current_vertices<<1),j,**pp,*pnu;
 	unsigned int* pmask;
-	if(i>max_vertices) voro_fatal_error("Vertex memory allocation exceeded absolute maximum",VOROPP_MEMORY_ERROR);
+	if(i>vertex_limit) {
+#if VOROPP_VERBOSE >=1
+		fputs("voro++: vertex memory budget exceeded, abandoning cell\n",stderr);
+#endif
+		over_budget=true;p=0;
+		return false;
+	}
+	VOROPP_COUNT(counters.memory_grows++);
 #if VOROPP_VERBOSE >=2
 	fprintf(stderr,"Vertex memory scaled up to %d\n",i);
 #endif
-	double *ppts;
-	pp=new int*[i];
+	fpoint *ppts;
+	pp=v_new<int*>(i);
 	for(j=0;j<current_vertices;j++) pp[j]=ed[j];
-	delete [] ed;ed=pp;
+	v_delete(ed);ed=pp;
 	vc.n_add_memory_vertices(i);
-	pnu=new int[i];
+	pnu=v_new<int>(i);
 	for(j=0;j<current_vertices;j++) pnu[j]=nu[j];
-	delete [] nu;nu=pnu;
-	pmask=new unsigned int[i];
+	v_delete(nu);nu=pnu;
+	pmask=v_new<unsigned int>(i);
 	for(j=0;j<current_vertices;j++) pmask[j]=mask[j];
 	while(j<i) pmask[j++]=0;
-	delete [] mask;mask=pmask;
-	ppts=new double[i<<2];
+	v_delete(mask);mask=pmask;
+	ppts=v_new<fpoint>(i<<2);
 	for(j=0;j<(current_vertices<<2);j++) ppts[j]=pts[j];
-	delete [] pts;pts=ppts;
+	v_delete(pts);pts=ppts;
 	current_vertices=i;
+	return true;
 }
 
 /** Doubles the maximum allowed vertex order, by reallocating mem, mep, and mec
- * arrays. If the allocation exceeds the absolute maximum set in
- * max_vertex_order, then the routine causes a fatal error. If the template has
- * been instantiated with the neighbor tracking turned on, then the routine
- * also reallocates the mne array. */
+ * arrays. If the allocation exceeds the cell's budget set in order_limit, then
+ * the memory is left alone, and the cell is emptied and flagged as over
+ * budget. If the template has been instantiated with the neighbor tracking
+ * turned on, then the routine also reallocates the mne array.
+ * \return False if the budget was exceeded, true otherwise. */
 template<class vc_class>
-void voronoicell_base::add_memory_vorder(vc_class &vc) {
+bool voronoicell_base::add_memory_vorder(vc_class &vc) {
 	int i=(current_vertex_order<<1),j,*p1,**p2;
-	if(i>max_vertex_order) voro_fatal_error("Vertex order memory allocation exceeded absolute maximum",VOROPP_MEMORY_ERROR);
+	if(i>order_limit) {
+#if VOROPP_VERBOSE >=1
+		fputs("voro++: vertex order budget exceeded, abandoning cell\n",stderr);
+#endif
+		over_budget=true;p=0;
+		return false;
+	}
+	VOROPP_COUNT(counters.memory_grows++);
 #if VOROPP_VERBOSE >=2
 	fprintf(stderr,"Vertex order memory scaled up to %d\n",i);
 #endif
-	p1=new int[i];
+	p1=v_new<int>(i);
 	for(j=0;j<current_vertex_order;j++) p1[j]=mem[j];while(j<i) p1[j++]=0;
-	delete [] mem;mem=p1;
-	p2=new int*[i];
+	v_delete(mem);mem=p1;
+	p2=v_new<int*>(i);
 	for(j=0;j<current_vertex_order;j++) p2[j]=mep[j];
-	delete [] mep;mep=p2;
-	p1=new int[i];
+	v_delete(mep);mep=p2;
+	p1=v_new<int>(i);
 	for(j=0;j<current_vertex_order;j++) p1[j]=mec[j];while(j<i) p1[j++]=0;
-	delete [] mec;mec=p1;
+	v_delete(mec);mec=p1;
 	vc.n_add_memory_vorder(i);
 	current_vertex_order=i;
+	return true;
 }
 
 /** Doubles the size allocation of the main delete stack. If the allocation
@@ -245,13 +354,14 @@ void voronoicell_base::add_memory_vorder(vc_class &vc) {
  * fatal error. */
 void voronoicell_base::add_memory_ds() {
 	current_delete_size<<=1;
+	VOROPP_COUNT(counters.memory_grows++);
 	if(current_delete_size>max_delete_size) voro_fatal_error("Delete stack 1 memory allocation exceeded absolute maximum",VOROPP_MEMORY_ERROR);
 #if VOROPP_VERBOSE >=2
 	fprintf(stderr,"Delete stack 1 memory scaled up to %d\n",current_delete_size);
 #endif
-	int *dsn=new int[current_delete_size],*dsnp=dsn,*dsp=ds;
+	int *dsn=v_new<int>(current_delete_size),*dsnp=dsn,*dsp=ds;
 	while(dsp<stackp) *(dsnp++)=*(dsp++);
-	delete [] ds;ds=dsn;stackp=dsnp;
+	v_delete(ds);ds=dsn;stackp=dsnp;
 	stacke=ds+current_delete_size;
 }
 
@@ -260,13 +370,14 @@ void voronoicell_base::add_memory_ds() {
  * routine causes a fatal error. */
 void voronoicell_base::add_memory_ds2() {
 	current_delete2_size<<=1;
+	VOROPP_COUNT(counters.memory_grows++);
 	if(current_delete2_size>max_delete2_size) voro_fatal_error("Delete stack 2 memory allocation exceeded absolute maximum",VOROPP_MEMORY_ERROR);
 #if VOROPP_VERBOSE >=2
 	fprintf(stderr,"Delete stack 2 memory scaled up to %d\n",current_delete2_size);
 #endif
-	int *dsn=new int[current_delete2_size],*dsnp=dsn,*dsp=ds2;
+	int *dsn=v_new<int>(current_delete2_size),*dsnp=dsn,*dsp=ds2;
 	while(dsp<stackp2) *(dsnp++)=*(dsp++);
-	delete [] ds2;ds2=dsn;stackp2=dsnp;
+	v_delete(ds2);ds2=dsn;stackp2=dsnp;
 	stacke2=ds2+current_delete2_size;
 }
 
@@ -275,13 +386,14 @@ void voronoicell_base::add_memory_ds2() {
  * routine causes a fatal error. */
 void voronoicell_base::add_memory_xse() {
 	current_xsearch_size<<=1;
+	VOROPP_COUNT(counters.memory_grows++);
 	if(current_xsearch_size>max_xsearch_size) voro_fatal_error("Extra search stack memory allocation exceeded absolute maximum",VOROPP_MEMORY_ERROR);
 #if VOROPP_VERBOSE >=2
 	fprintf(stderr,"Extra search stack memory scaled up to %d\n",current_xsearch_size);
 #endif
-	int *dsn=new int[current_xsearch_size],*dsnp=dsn,*dsp=xse;
+	int *dsn=v_new<int>(current_xsearch_size),*dsnp=dsn,*dsp=xse;
 	while(dsp<stackp3) *(dsnp++)=*(dsp++);
-	delete [] xse;xse=dsn;stackp3=dsnp;
+	v_delete(xse);xse=dsn;stackp3=dsnp;
 	stacke3=xse+current_xsearch_size;
 }
 
@@ -291,7 +403,7 @@ void voronoicell_base::add_memory_xse() {
  * \param[in] (zmin,zmax) the minimum and maximum z coordinates. */
 void voronoicell_base::init_base(double xmin,double xmax,double ymin,double ymax,double zmin,double zmax) {
 	for(int i=0;i<current_vertex_order;i++) mec[i]=0;up=0;
-	mec[3]=p=8;xmin*=2;xmax*=2;ymin*=2;ymax*=2;zmin*=2;zmax*=2;
+	mec[3]=p=8;over_budget=mrs_ok=false;xmin*=2;xmax*=2;ymin*=2;ymax*=2;zmin*=2;zmax*=2;
 	*pts=xmin;pts[1]=ymin;pts[2]=zmin;
 	pts[4]=xmax;pts[5]=ymin;pts[6]=zmin;
 	pts[8]=xmin;pts[9]=ymax;pts[10]=zmin;
@@ -318,7 +430,7 @@ void voronoicell_base::init_base(double xmin,double xmax,double ymin,double ymax
  * convexity robustness. */
 void voronoicell::init_l_shape() {
 	for(int i=0;i<current_vertex_order;i++) mec[i]=0;up=0;
-	mec[3]=p=12;
+	mec[3]=p=12;over_budget=mrs_ok=false;
 	const double j=0;
 	*pts=-2;pts[1]=-2;pts[2]=-2;
 	pts[4]=2;pts[5]=-2;pts[6]=-2;
@@ -357,7 +469,7 @@ void voronoicell::init_l_shape() {
  *              (0,l,0), (0,0,-l), and (0,0,l). */
 void voronoicell_base::init_octahedron_base(double l) {
 	for(int i=0;i<current_vertex_order;i++) mec[i]=0;up=0;
-	mec[4]=p=6;l*=2;
+	mec[4]=p=6;over_budget=mrs_ok=false;l*=2;
 	*pts=-l;pts[1]=0;pts[2]=0;
 	pts[4]=l;pts[5]=0;pts[6]=0;
 	pts[8]=0;pts[9]=-l;pts[10]=0;
@@ -383,7 +495,7 @@ void voronoicell_base::init_octahedron_base(double l) {
  * \param (x3,y3,z3) a position vector for the fourth vertex. */
 void voronoicell_base::init_tetrahedron_base(double x0,double y0,double z0,double x1,double y1,double z1,double x2,double y2,double z2,double x3,double y3,double z3) {
 	for(int i=0;i<current_vertex_order;i++) mec[i]=0;up=0;
-	mec[3]=p=4;
+	mec[3]=p=4;over_budget=mrs_ok=false;
 	*pts=x0*2;pts[1]=y0*2;pts[2]=z0*2;
 	pts[4]=x1*2;pts[5]=y1*2;pts[6]=z1*2;
 	pts[8]=x2*2;pts[9]=y2*2;pts[10]=z2*2;
@@ -710,7 +822,7 @@ bool voronoicell_base::definite_min(int &lp,int &us,double &l,double &u,unsigned
  * \param[in] p_id the plane ID (for neighbor tracking only).
  * \return False if the plane cut deleted the cell entirely, true otherwise. */
 template<class vc_class>
-bool voronoicell_base::nplane(vc_class &vc,double x,double y,double z,double rsq,int p_id) {
+bool voronoicell_base::nplane(vc_class &vc,double x,double y,double z,double rsq,voro_id p_id) {
 	int i,j,lp=up,cp,qp,*dsp;
 	int us=0,ls=0;
 	unsigned int uw,lw;
@@ -721,10 +833,14 @@ bool voronoicell_base::nplane(vc_class &vc,double x,double y,double z,double rsq
 	px=x;py=y;pz=z;prsq=rsq;
 	maskc+=4;
 	if(maskc<4) reset_mask();
+	VOROPP_COUNT(counters.plane_tests++);
 
 	uw=m_test(up,u);
 	if(uw==2) {
-		if(!search_downward(lw,lp,ls,us,l,u)) return false;
+		if(!search_downward(lw,lp,ls,us,l,u)) {
+			VOROPP_COUNT(counters.plane_removals++);
+			return false;
+		}
 		if(lw==1) {up=lp;lp=-1;}
 	} else if(uw==0) {
 		if(!search_upward(uw,lp,ls,us,l,u)) return true;
@@ -732,6 +848,12 @@ bool voronoicell_base::nplane(vc_class &vc,double x,double y,double z,double rsq
 	} else {
 		lp=-1;
 	}
+	VOROPP_COUNT(counters.plane_cuts++);
+
+	// New vertices lie on edges of the cell, so the cached maximum radius
+	// can only change if the cut removes the vertex that gives it. This
+	// may also happen to vertices that are marginally inside the plane.
+	if(mrs_ok&&mrx*x+mry*y+mrz*z>rsq-big_tol) mrs_ok=false;
 
 	// Set stack pointers
 	stackp=ds;stackp2=ds2;stackp3=xse;
@@ -739,7 +861,10 @@ bool voronoicell_base::nplane(vc_class &vc,double x,double y,double z,double rsq
 	// Store initial number of vertices
 	int op=p;
 
-	if(create_facet(vc,lp,ls,l,us,u,p_id)) return false;
+	if(create_facet(vc,lp,ls,l,us,u,p_id)) {
+		VOROPP_COUNT(counters.plane_removals++);
+		return false;
+	}
 	int k=0;int xtra=0;
 	while(xse+k<stackp3) {
 		lp=xse[k++];
@@ -761,13 +886,19 @@ bool voronoicell_base::nplane(vc_class &vc,double x,double y,double z,double rsq
 
 				// This is a possible facet starting
 				// from a vertex on the cutting plane
-				if(create_facet(vc,-1,0,0,0,u,p_id)) return false;
+				if(create_facet(vc,-1,0,0,0,u,p_id)) {
+					VOROPP_COUNT(counters.plane_removals++);
+					return false;
+				}
 			} else {
 
 				// This is a new facet
 				us=ed[lp][nu[lp]+ls];
 				m_test(lp,l);
-				if(create_facet(vc,lp,ls,l,us,u,p_id)) return false;
+				if(create_facet(vc,lp,ls,l,us,u,p_id)) {
+					VOROPP_COUNT(counters.plane_removals++);
+					return false;
+				}
 			}
 		}
 		xtra++;
@@ -859,14 +990,18 @@ bool voronoicell_base::nplane(vc_class &vc,double x,double y,double z,double rsq
 	// Check for any vertices of zero order
 	if(*mec>0) voro_fatal_error("Zero order vertex formed",VOROPP_INTERNAL_ERROR);
 
-	// Collapse any order 2 vertices and exit
-	return collapse_order2(vc);
+	// Collapse any order 2 vertices and exit, noting if this removed the
+	// vertex with the maximum radius
+	i=p;
+	if(!collapse_order2(vc)) return false;
+	if(p<i) mrs_ok=false;
+	return true;
 }
 
 /** Creates a new facet.
  * \return True if cell deleted, false otherwise. */
 template<class vc_class>
-bool voronoicell_base::create_facet(vc_class &vc,int lp,int ls,double l,int us,double u,int p_id) {
+bool voronoicell_base::create_facet(vc_class &vc,int lp,int ls,double l,int us,double u,voro_id p_id) {
 	int i,j,k,qp,qs,iqs,cp,cs,rp,*edp,*edd;
 	unsigned int lw,qw;
 	bool new_double_edge=false,double_edge=false;
@@ -875,7 +1010,7 @@ bool voronoicell_base::create_facet(vc_class &vc,int lp,int ls,double l,int us,d
 	// We're about to add the first point of the new facet. In either
 	// routine, we have to add a point, so first check there's space for
 	// it.
-	if(p==current_vertices) add_memory_vertices(vc);
+	if(p==current_vertices&&!add_memory_vertices(vc)) return true;
 
 	if(lp==-1) {
 
@@ -943,7 +1078,7 @@ bool voronoicell_base::create_facet(vc_class &vc,int lp,int ls,double l,int us,d
 
 			// Add memory for the new vertex if needed, and
 			// initialize
-			while (nu[p]>=current_vertex_order) add_memory_vorder(vc);
+			while(nu[p]>=current_vertex_order) if(!add_memory_vorder(vc)) return true;
 			if(mec[nu[p]]==mem[nu[p]]) add_memory(vc,nu[p]);
 			vc.n_set_pointer(p,nu[p]);
 			ed[p]=mep[nu[p]]+((nu[p]<<1)+1)*mec[nu[p]]++;
@@ -1011,7 +1146,7 @@ bool voronoicell_base::create_facet(vc_class &vc,int lp,int ls,double l,int us,d
 			// Add memory to store the vertex if it doesn't exist
 			// already
 			k=1;
-			while(nu[p]>=current_vertex_order) add_memory_vorder(vc);
+			while(nu[p]>=current_vertex_order) if(!add_memory_vorder(vc)) return true;
 			if(mec[nu[p]]==mem[nu[p]]) add_memory(vc,nu[p]);
 
 			// Copy the edges of the original vertex into the new
@@ -1129,7 +1264,7 @@ bool voronoicell_base::create_facet(vc_class &vc,int lp,int ls,double l,int us,d
 			// at the point of intersection. Connect it to the
 			// point we just tested. Also connect it to the previous
 			// new point in the facet we're constructing.
-			if(p==current_vertices) add_memory_vertices(vc);
+			if(p==current_vertices&&!add_memory_vertices(vc)) return true;
 			r=q/(q-l);l=1-r;
 			pts[p<<2]=pts[lp<<2]*r+pts[qp<<2]*l;
 			pts[(p<<2)+1]=pts[(lp<<2)+1]*r+pts[(qp<<2)+1]*l;
@@ -1161,7 +1296,7 @@ bool voronoicell_base::create_facet(vc_class &vc,int lp,int ls,double l,int us,d
 			// We're going to introduce a new point right here, but
 			// first we need to figure out the number of edges it
 			// has.
-			if(p==current_vertices) add_memory_vertices(vc);
+			if(p==current_vertices&&!add_memory_vertices(vc)) return true;
 
 			// If the previous vertex detected a double edge, our
 			// new vertex will have one less edge.
@@ -1257,7 +1392,7 @@ bool voronoicell_base::create_facet(vc_class &vc,int lp,int ls,double l,int us,d
 			// k now holds the number of edges of the new vertex
 			// we are forming. Add memory for it if it doesn't exist
 			// already.
-			while(k>=current_vertex_order) add_memory_vorder(vc);
+			while(k>=current_vertex_order) if(!add_memory_vorder(vc)) return true;
 			if(mec[k]==mem[k]) add_memory(vc,k);
 
 			// Now create a new vertex with order k, or augment
@@ -1377,6 +1512,7 @@ inline bool voronoicell_base::collapse_order2(vc_class &vc) {
 		i=--mec[2];
 		j=mep[2][5*i];k=mep[2][5*i+1];
 		if(j==k) {
+			VOROPP_COUNT(counters.bailouts++);
 #if VOROPP_VERBOSE >=1
 			fputs("Order two vertex joins itself",stderr);
 #endif
@@ -1433,6 +1569,7 @@ bool voronoicell_base::collapse_order1(vc_class &vc) {
 	int i,j,k;
 	while(mec[1]>0) {
 		up=0;
+		VOROPP_COUNT(counters.bailouts++);
 #if VOROPP_VERBOSE >=1
 		fputs("Order one collapse\n",stderr);
 #endif
@@ -1609,13 +1746,19 @@ double voronoicell_base::volume() {
 	return vol*fe;
 }
 
-/** Calculates the contributions to the Minkowski functionals for this Voronoi cell.
- * \param[in] r the radius to consider.
- * \param[out] ar the area functional.
- * \param[out] vo the volume functional. */
-void voronoicell_base::minkowski(double r,double &ar,double &vo) {
+/** Calculates the contributions to the Minkowski functionals for this Voronoi
+ * cell, for several radii at once. The cell is traversed once, and the
+ * geometry of each triangle and edge is computed once and reused for all of
+ * the radii.
+ * \param[in] nr the number of radii.
+ * \param[in] r an array of the radii to consider.
+ * \param[out] ar an array in which to store the area functional for each
+ *		  radius.
+ * \param[out] vo an array in which to store the volume functional for each
+ *		  radius. */
+void voronoicell_base::minkowski(int nr,const double *r,double *ar,double *vo) {
 	int i,j,k,l,m,n;
-	ar=vo=0;r*=2;
+	for(i=0;i<nr;i++) ar[i]=vo[i]=0;
 	for(i=1;i<p;i++) for(j=0;j<nu[i];j++) {
 		k=ed[i][j];
 		if(k>=0) {
@@ -1624,18 +1767,35 @@ void voronoicell_base::minkowski(double r,double &ar,double &vo) {
 			m=ed[k][l];ed[k][l]=-1-m;
 			while(m!=i) {
 				n=cycle_up(ed[k][nu[k]+l],m);
-				minkowski_contrib(i,k,m,r,ar,vo);
+				minkowski_contrib(i,k,m,nr,r,ar,vo);
 				k=m;l=n;
 				m=ed[k][l];ed[k][l]=-1-m;
 			}
 		}
 	}
-	vo*=0.125;
-	ar*=0.25;
+	for(i=0;i<nr;i++) {vo[i]*=0.125;ar[i]*=0.25;}
 	reset_edges();
 }
 
-inline void voronoicell_base::minkowski_contrib(int i,int k,int m,double r,double &ar,double &vo) {
+/** Calculates the contributions to the Minkowski functionals for this Voronoi
+ * cell, for several radii at once.
+ * \param[in] r a vector of the radii to consider.
+ * \param[out] ar a vector in which to store the area functional for each
+ *		  radius.
+ * \param[out] vo a vector in which to store the volume functional for each
+ *		  radius. */
+void voronoicell_base::minkowski(const std::vector<double> &r,std::vector<double> &ar,std::vector<double> &vo) {
+	ar.resize(r.size());vo.resize(r.size());
+	if(!r.empty()) minkowski(r.size(),&r[0],&ar[0],&vo[0]);
+}
+
+/** Adds the contributions of a triangle, made from a face vertex and an edge
+ * of the face, to the Minkowski functionals.
+ * \param[in] (i,k,m) the vertices of the triangle.
+ * \param[in] nr the number of radii.
+ * \param[in] r an array of the radii.
+ * \param[in,out] (ar,vo) arrays of the functionals to add to. */
+inline void voronoicell_base::minkowski_contrib(int i,int k,int m,int nr,const double *r,double *ar,double *vo) {
 	double ix=pts[4*i],iy=pts[4*i+1],iz=pts[4*i+2],
 	       kx=pts[4*k],ky=pts[4*k+1],kz=pts[4*k+2],
 	       mx=pts[4*m],my=pts[4*m+1],mz=pts[4*m+2],
@@ -1668,51 +1828,72 @@ inline void voronoicell_base::minkowski_contrib(int i,int k,int m,double r,doubl
 	       kr=e2x*kx+e2y*ky+e2z*kz,ks=e3x*kx+e3y*ky+e3z*kz,
 	       mr=e2x*mx+e2y*my+e2z*mz,ms=e3x*mx+e3y*my+e3z*mz;
 
-	minkowski_edge(x0,ir,is,kr,ks,r,ar,vo);
-	minkowski_edge(x0,kr,ks,mr,ms,r,ar,vo);
-	minkowski_edge(x0,mr,ms,ir,is,r,ar,vo);
-}
-
-void voronoicell_base::minkowski_edge(double x0,double r1,double s1,double r2,double s2,double r,double &ar,double &vo) {
+	minkowski_edge(x0,ir,is,kr,ks,nr,r,ar,vo);
+	minkowski_edge(x0,kr,ks,mr,ms,nr,r,ar,vo);
+	minkowski_edge(x0,mr,ms,ir,is,nr,r,ar,vo);
+}
+
+/** Adds the contributions of an edge of a triangle to the Minkowski
+ * functionals, by splitting it at the foot of the perpendicular from the
+ * particle.
+ * \param[in] x0 the distance from the particle to the plane of the triangle.
+ * \param[in] (r1,s1) the coordinates of the start of the edge in the plane.
+ * \param[in] (r2,s2) the coordinates of the end of the edge in the plane.
+ * \param[in] nr the number of radii.
+ * \param[in] r an array of the radii.
+ * \param[in,out] (ar,vo) arrays of the functionals to add to. */
+void voronoicell_base::minkowski_edge(double x0,double r1,double s1,double r2,double s2,int nr,const double *r,double *ar,double *vo) {
 	double r12=r2-r1,s12=s2-s1,l12=r12*r12+s12*s12;
 	if(l12<tol*tol) return;
 	l12=1/sqrt(l12);r12*=l12;s12*=l12;
 	double y0=s12*r1-r12*s1;
 	if(fabs(y0)<tol) return;
-	minkowski_formula(x0,y0,-r12*r1-s12*s1,r,ar,vo);
-	minkowski_formula(x0,y0,r12*r2+s12*s2,r,ar,vo);
-}
-
-void voronoicell_base::minkowski_formula(double x0,double y0,double z0,double r,double &ar,double &vo) {
+	minkowski_formula(x0,y0,-r12*r1-s12*s1,nr,r,ar,vo);
+	minkowski_formula(x0,y0,r12*r2+s12*s2,nr,r,ar,vo);
+}
+
+/** Adds the contributions of a right-angled piece of a triangle to the
+ * Minkowski functionals. The quantities that do not depend on the radius are
+ * computed once, and the radii are then considered in turn. The radii are
+ * doubled, to match the internal coordinates of the cell.
+ * \param[in] (x0,y0,z0) the dimensions of the piece.
+ * \param[in] nr the number of radii.
+ * \param[in] rv an array of the radii.
+ * \param[in,out] (ar,vo) arrays of the functionals to add to. */
+void voronoicell_base::minkowski_formula(double x0,double y0,double z0,int nr,const double *rv,double *ar,double *vo) {
 	const double pi=3.1415926535897932384626433832795;
 	if(fabs(z0)<tol) return;
 	double si;
 	if(z0<0) {z0=-z0;si=-1;} else si=1;
 	if(y0<0) {y0=-y0;si=-si;}
-	double xs=x0*x0,ys=y0*y0,zs=z0*z0,res=xs+ys,rvs=res+zs,theta=atan(z0/y0),rs=r*r,rc=rs*r,temp,voc,arc;
-	if(r<x0) {
-		temp=2*theta-0.5*pi-asin((zs*xs-ys*rvs)/(res*(ys+zs)));
-		voc=rc/6.*temp;
-		arc=rs*0.5*temp;
-	} else if(rs<res*1.0000000001) {
-		temp=0.5*pi+asin((zs*xs-ys*rvs)/(res*(ys+zs)));
-		voc=theta*0.5*(rs*x0-xs*x0/3.)-rc/6.*temp;
-		arc=theta*x0*r-rs*0.5*temp;
-	} else if(rs<rvs) {
-		temp=theta-pi*0.5+asin(y0/sqrt(rs-xs));
-		double temp2=(rs*x0-xs*x0/3.),
-		       x2s=rs*xs/res,y2s=rs*ys/res,
-		       temp3=asin((x2s-y2s-xs)/(rs-xs)),
-		       temp4=asin((zs*xs-ys*rvs)/(res*(ys+zs))),
-		       temp5=sqrt(rs-res);
-		voc=0.5*temp*temp2+x0*y0/6.*temp5+r*rs/6*(temp3-temp4);
-		arc=x0*r*temp-0.5*temp2*y0*r/((rs-xs)*temp5)+x0*y0/6.*r/temp5+rs*0.5*temp3+rs*rs/3.*2*xs*ys/(res*(rs-xs)*sqrt((rs-xs)*(rs-xs)-(x2s-y2s-xs)*(x2s-y2s-xs)))-rs*0.5*temp4;
-	} else {
-		voc=x0*y0*z0/6.;
-		arc=0;
+	double xs=x0*x0,ys=y0*y0,zs=z0*z0,res=xs+ys,rvs=res+zs,theta=atan(z0/y0),
+	       temp4=asin((zs*xs-ys*rvs)/(res*(ys+zs))),xc=xs*x0/3.,
+	       r,rs,rc,temp,voc,arc;
+	for(int q=0;q<nr;q++) {
+		r=2*rv[q];rs=r*r;rc=rs*r;
+		if(r<x0) {
+			temp=2*theta-0.5*pi-temp4;
+			voc=rc/6.*temp;
+			arc=rs*0.5*temp;
+		} else if(rs<res*1.0000000001) {
+			temp=0.5*pi+temp4;
+			voc=theta*0.5*(rs*x0-xc)-rc/6.*temp;
+			arc=theta*x0*r-rs*0.5*temp;
+		} else if(rs<rvs) {
+			temp=theta-pi*0.5+asin(y0/sqrt(rs-xs));
+			double temp2=(rs*x0-xc),
+			       x2s=rs*xs/res,y2s=rs*ys/res,
+			       temp3=asin((x2s-y2s-xs)/(rs-xs)),
+			       temp5=sqrt(rs-res);
+			voc=0.5*temp*temp2+x0*y0/6.*temp5+r*rs/6*(temp3-temp4);
+			arc=x0*r*temp-0.5*temp2*y0*r/((rs-xs)*temp5)+x0*y0/6.*r/temp5+rs*0.5*temp3+rs*rs/3.*2*xs*ys/(res*(rs-xs)*sqrt((rs-xs)*(rs-xs)-(x2s-y2s-xs)*(x2s-y2s-xs)))-rs*0.5*temp4;
+		} else {
+			voc=x0*y0*z0/6.;
+			arc=0;
+		}
+		vo[q]+=voc*si;
+		ar[q]+=arc*si;
 	}
-	vo+=voc*si;
-	ar+=arc*si;
 }
 
 /** Calculates the areas of each face of the Voronoi cell and prints the
@@ -1830,20 +2011,221 @@ void voronoicell_base::centroid(double &cx,double &cy,double &cz) {
 	} else cx=cy=cz=0;
 }
 
-/** Computes the maximum radius squared of a vertex from the center of the
- * cell. It can be used to determine when enough particles have been testing an
- * all planes that could cut the cell have been considered.
- * \return The maximum radius squared of a vertex.*/
-double voronoicell_base::max_radius_squared() {
-	double r,s,*ptsp=pts+4,*ptse=pts+(p<<2);
-	r=*pts*(*pts)+pts[1]*pts[1]+pts[2]*pts[2];
+/** Computes the quantities that are asked for by a cell_query. The volume,
+ * centroid, surface area, and number of faces are accumulated together in a
+ * single traversal of the faces, using the same arithmetic as the volume(),
+ * centroid(), and surface_area() routines, and the traversal is skipped
+ * entirely if none of them are needed. The neighbor list is not filled in by
+ * this routine, since it is only available in the voronoicell_neighbor class.
+ * \param[in,out] qr the query, whose mask selects the quantities to compute
+ *		     and in which the results are stored. */
+void voronoicell_base::evaluate(cell_query &qr) {
+	if(qr.mask&(query_volume|query_centroid|query_surface_area|query_faces)) {
+		const bool ar=(qr.mask&query_surface_area)!=0;
+		double tvol,vol=0,area=0,cx=0,cy=0,cz=0;
+		int i,j,k,l,m,n,fa=0;
+		double ux,uy,uz,vx,vy,vz,wx,wy,wz,ax,ay,az;
+		for(i=1;i<p;i++) {
+			ux=*pts-pts[4*i];
+			uy=pts[1]-pts[4*i+1];
+			uz=pts[2]-pts[4*i+2];
+			for(j=0;j<nu[i];j++) {
+				k=ed[i][j];
+				if(k>=0) {
+					fa++;
+					ed[i][j]=-1-k;
+					l=cycle_up(ed[i][nu[i]+j],k);
+					vx=pts[4*k]-*pts;
+					vy=pts[4*k+1]-pts[1];
+					vz=pts[4*k+2]-pts[2];
+					m=ed[k][l];ed[k][l]=-1-m;
+					while(m!=i) {
+						n=cycle_up(ed[k][nu[k]+l],m);
+						wx=pts[4*m]-*pts;
+						wy=pts[4*m+1]-pts[1];
+						wz=pts[4*m+2]-pts[2];
+						tvol=ux*vy*wz+uy*vz*wx+uz*vx*wy-uz*vy*wx-uy*vx*wz-ux*vz*wy;
+						vol+=tvol;
+						cx+=(wx+vx-ux)*tvol;
+						cy+=(wy+vy-uy)*tvol;
+						cz+=(wz+vz-uz)*tvol;
+						if(ar) {
+							double sx=pts[4*k]-pts[4*i],sy=pts[4*k+1]-pts[4*i+1],sz=pts[4*k+2]-pts[4*i+2],
+							       tx=pts[4*m]-pts[4*i],ty=pts[4*m+1]-pts[4*i+1],tz=pts[4*m+2]-pts[4*i+2];
+							ax=sy*tz-sz*ty;
+							ay=sz*tx-sx*tz;
+							az=sx*ty-sy*tx;
+							area+=sqrt(ax*ax+ay*ay+az*az);
+						}
+						k=m;l=n;vx=wx;vy=wy;vz=wz;
+						m=ed[k][l];ed[k][l]=-1-m;
+					}
+				}
+			}
+		}
+		reset_edges();
+		if(qr.mask&query_volume) qr.volume=vol*(1/48.0);
+		if(qr.mask&query_surface_area) qr.area=0.125*area;
+		if(qr.mask&query_faces) qr.faces=fa;
+		if(qr.mask&query_centroid) {
+			if(vol>tol_cu) {
+				vol=0.125/vol;
+				qr.cx=cx*vol+0.5*(*pts);
+				qr.cy=cy*vol+0.5*pts[1];
+				qr.cz=cz*vol+0.5*pts[2];
+			} else qr.cx=qr.cy=qr.cz=0;
+		}
+	}
+	if(qr.mask&query_vertices) qr.vertices=p;
+	if(qr.mask&query_edges) qr.edges=number_of_edges();
+	if(qr.mask&query_max_radius) qr.max_radius=0.5*sqrt(max_radius_squared());
+}
+
+/** Computes the orders, areas, perimeters, neighbor IDs, vertices, and normal
+ * vectors of the faces in a single traversal. The results are the same as
+ * those of the face_orders(), face_areas(), face_perimeters(), neighbors(),
+ * face_vertices(), and normals() routines.
+ * \param[in] vc a reference to the specialized version of the calling class.
+ * \param[out] ord a vector in which to store the number of edges of each
+ *		   face, or NULL if this is not needed.
+ * \param[out] area a vector in which to store the area of each face, or NULL
+ *		    if this is not needed.
+ * \param[out] perim a vector in which to store the perimeter of each face, or
+ *		     NULL if this is not needed.
+ * \param[out] nb a vector in which to store the neighbor ID of each face, or
+ *		  NULL if this is not needed.
+ * \param[out] fv a vector in which to store the vertices of each face, or NULL
+ *		  if this is not needed.
+ * \param[out] nm a vector in which to store the normal vector of each face,
+ *		  or NULL if this is not needed. */
+template<class vc_class>
+void voronoicell_base::face_data(vc_class &vc,std::vector<int> *ord,std::vector<double> *area,std::vector<double> *perim,std::vector<voro_id> *nb,std::vector<int> *fv,std::vector<double> *nm) {
+	int i,j,k,l,m,n,q,fs=0;
+	double ar,pe=0,dx,dy,dz,ux,uy,uz,vx,vy,vz;
+
+	// The normal vectors are computed from the vertices of each face, so
+	// these are recorded in a temporary vector if they are not asked for
+	std::vector<int> fw,*fvp=fv!=NULL?fv:(nm!=NULL?&fw:NULL);
+	if(ord!=NULL) ord->clear();
+	if(area!=NULL) area->clear();
+	if(perim!=NULL) perim->clear();
+	if(nb!=NULL) nb->clear();
+	if(fvp!=NULL) fvp->clear();
+	if(nm!=NULL) nm->clear();
+	for(i=1;i<p;i++) for(j=0;j<nu[i];j++) {
+		k=ed[i][j];
+		if(k>=0) {
+			if(nb!=NULL) vc.n_face_neighbor(nb,i,j);
+			if(fvp!=NULL) {
+				fs=fvp->size();
+				fvp->push_back(0);fvp->push_back(i);fvp->push_back(k);
+			}
+			q=2;ar=0;
+			if(perim!=NULL) {
+				dx=pts[k<<2]-pts[i<<2];
+				dy=pts[(k<<2)+1]-pts[(i<<2)+1];
+				dz=pts[(k<<2)+2]-pts[(i<<2)+2];
+				pe=sqrt(dx*dx+dy*dy+dz*dz);
+			}
+			ed[i][j]=-1-k;
+			l=cycle_up(ed[i][nu[i]+j],k);
+			m=ed[k][l];ed[k][l]=-1-m;
+			while(m!=i) {
+				n=cycle_up(ed[k][nu[k]+l],m);
+				if(area!=NULL) {
+					ux=pts[4*k]-pts[4*i];
+					uy=pts[4*k+1]-pts[4*i+1];
+					uz=pts[4*k+2]-pts[4*i+2];
+					vx=pts[4*m]-pts[4*i];
+					vy=pts[4*m+1]-pts[4*i+1];
+					vz=pts[4*m+2]-pts[4*i+2];
+					dx=uy*vz-uz*vy;
+					dy=uz*vx-ux*vz;
+					dz=ux*vy-uy*vx;
+					ar+=sqrt(dx*dx+dy*dy+dz*dz);
+				}
+				if(perim!=NULL) {
+					dx=pts[m<<2]-pts[k<<2];
+					dy=pts[(m<<2)+1]-pts[(k<<2)+1];
+					dz=pts[(m<<2)+2]-pts[(k<<2)+2];
+					pe+=sqrt(dx*dx+dy*dy+dz*dz);
+				}
+				if(fvp!=NULL) fvp->push_back(m);
+				q++;
+				k=m;l=n;
+				m=ed[k][l];ed[k][l]=-1-m;
+			}
+			if(fvp!=NULL) {
+				(*fvp)[fs]=q;
+				if(nm!=NULL) face_normal(&(*fvp)[fs+1],q,*nm);
+			}
+			if(ord!=NULL) ord->push_back(q);
+			if(area!=NULL) area->push_back(0.125*ar);
+			if(perim!=NULL) {
+				dx=pts[i<<2]-pts[k<<2];
+				dy=pts[(i<<2)+1]-pts[(k<<2)+1];
+				dz=pts[(i<<2)+2]-pts[(k<<2)+2];
+				pe+=sqrt(dx*dx+dy*dy+dz*dz);
+				perim->push_back(0.5*pe);
+			}
+		}
+	}
+	reset_edges();
+}
+
+/** Computes the normal vector of a face from its list of vertices, in the same
+ * way as the normals_search() routine. The first edge whose length is above
+ * the numerical tolerance is found, and the normal vector is constructed from
+ * its vector product with the first subsequent edge for which this is above
+ * the tolerance. If there is no such pair of edges, then (0,0,0) is stored.
+ * \param[in] s a pointer to the vertices of the face, in order.
+ * \param[in] q the number of vertices in the face.
+ * \param[in] v the vector to store the results in. */
+void voronoicell_base::face_normal(const int *s,int q,std::vector<double> &v) {
+	int a,b;
+	fpoint *pk,*pm;
+	double ux,uy,uz,vx,vy,vz,wx,wy,wz,wmag;
+	for(a=1;a<q;a++) {
+		pk=pts+4*s[a];pm=pts+4*s[a+1<q?a+1:0];
+		ux=*pm-*pk;uy=pm[1]-pk[1];uz=pm[2]-pk[2];
+		if(ux*ux+uy*uy+uz*uz>tol) {
+			for(b=a+1;b<q;b++) {
+				pk=pts+4*s[b];pm=pts+4*s[b+1<q?b+1:0];
+				vx=*pm-*pk;vy=pm[1]-pk[1];vz=pm[2]-pk[2];
+				wx=uz*vy-uy*vz;
+				wy=ux*vz-uz*vx;
+				wz=uy*vx-ux*vy;
+				wmag=wx*wx+wy*wy+wz*wz;
+				if(wmag>tol) {
+					wmag=1/sqrt(wmag);
+					v.push_back(wx*wmag);
+					v.push_back(wy*wmag);
+					v.push_back(wz*wmag);
+					return;
+				}
+			}
+			break;
+		}
+	}
+	v.push_back(0);
+	v.push_back(0);
+	v.push_back(0);
+}
+
+/** Recomputes the maximum radius squared of a vertex from the center of the
+ * cell, by scanning all of the vertices, and stores the vertex that gives it.
+ * It can be used to determine when enough particles have been testing an all
+ * planes that could cut the cell have been considered. */
+void voronoicell_base::update_max_radius() {
+	double s;fpoint *ptsp=pts+4,*ptse=pts+(p<<2),*mp=pts;
+	mrs=*pts*(*pts)+pts[1]*pts[1]+pts[2]*pts[2];
 	while(ptsp<ptse) {
 		s=*ptsp*(*ptsp);ptsp++;
 		s+=*ptsp*(*ptsp);ptsp++;
 		s+=*ptsp*(*ptsp);ptsp+=2;
-		if(s>r) r=s;
+		if(s>mrs) {mrs=s;mp=ptsp-4;}
 	}
-	return r;
+	mrx=*mp;mry=mp[1];mrz=mp[2];mrs_ok=true;
 }
 
 /** Calculates the total edge distance of the Voronoi cell.
@@ -1868,39 +2250,58 @@ double voronoicell_base::total_edge_distance() {
  * \param[in] (x,y,z) a displacement vector to be added to the cell's position.
  * \param[in] fp a file handle to write to. */
 void voronoicell_base::draw_pov(double x,double y,double z,FILE* fp) {
-	int i,j,k;double *ptsp=pts,*pt2;
+	int i,j,k,l1,l2;fpoint *ptsp=pts,*pt2;
 	char posbuf1[128],posbuf2[128];
+	text_writer tw(fp);
 	for(i=0;i<p;i++,ptsp+=4) {
-		sprintf(posbuf1,"%g,%g,%g",x+*ptsp*0.5,y+ptsp[1]*0.5,z+ptsp[2]*0.5);
-		fprintf(fp,"sphere{<%s>,r}\n",posbuf1);
+		l1=format_position(posbuf1,x+*ptsp*0.5,y+ptsp[1]*0.5,z+ptsp[2]*0.5,tw.prec);
+		tw.put("sphere{<");tw.put(posbuf1,l1);tw.put(">,r}\n");
 		for(j=0;j<nu[i];j++) {
 			k=ed[i][j];
 			if(k<i) {
 				pt2=pts+(k<<2);
-				sprintf(posbuf2,"%g,%g,%g",x+*pt2*0.5,y+0.5*pt2[1],z+0.5*pt2[2]);
-				if(strcmp(posbuf1,posbuf2)!=0) fprintf(fp,"cylinder{<%s>,<%s>,r}\n",posbuf1,posbuf2);
+				l2=format_position(posbuf2,x+*pt2*0.5,y+0.5*pt2[1],z+0.5*pt2[2],tw.prec);
+				if(l1!=l2||memcmp(posbuf1,posbuf2,l1)!=0) {
+					tw.put("cylinder{<");tw.put(posbuf1,l1);
+					tw.put(">,<");tw.put(posbuf2,l2);tw.put(">,r}\n");
+				}
 			}
 		}
 	}
 }
 
+/** Writes a position vector into a character array as three comma-separated
+ * numbers, for use in the POV-Ray output.
+ * \param[in] s the character array, which must have space for three numbers.
+ * \param[in] (x,y,z) the position vector.
+ * \param[in] prec the number of significant digits.
+ * \return The number of characters written. */
+int voronoicell_base::format_position(char *s,double x,double y,double z,int prec) {
+	char *sp=s;
+	sp+=voro_format_double(x,prec,sp);*(sp++)=',';
+	sp+=voro_format_double(y,prec,sp);*(sp++)=',';
+	sp+=voro_format_double(z,prec,sp);
+	return int(sp-s);
+}
+
 /** Outputs the edges of the Voronoi cell in gnuplot format to an output stream.
  * \param[in] (x,y,z) a displacement vector to be added to the cell's position.
  * \param[in] fp a file handle to write to. */
 void voronoicell_base::draw_gnuplot(double x,double y,double z,FILE *fp) {
 	int i,j,k,l,m;
+	text_writer tw(fp);
 	for(i=1;i<p;i++) for(j=0;j<nu[i];j++) {
 		k=ed[i][j];
 		if(k>=0) {
-			fprintf(fp,"%g %g %g\n",x+0.5*pts[i<<2],y+0.5*pts[(i<<2)+1],z+0.5*pts[(i<<2)+2]);
+			tw.put3(x+0.5*pts[i<<2],y+0.5*pts[(i<<2)+1],z+0.5*pts[(i<<2)+2],' ');tw.put('\n');
 			l=i;m=j;
 			do {
 				ed[k][ed[l][nu[l]+m]]=-1-l;
 				ed[l][m]=-1-k;
 				l=k;
-				fprintf(fp,"%g %g %g\n",x+0.5*pts[k<<2],y+0.5*pts[(k<<2)+1],z+0.5*pts[(k<<2)+2]);
+				tw.put3(x+0.5*pts[k<<2],y+0.5*pts[(k<<2)+1],z+0.5*pts[(k<<2)+2],' ');tw.put('\n');
 			} while (search_edge(l,m,k));
-			fputs("\n\n",fp);
+			tw.put("\n\n");
 		}
 	}
 	reset_edges();
@@ -1924,10 +2325,13 @@ inline bool voronoicell_base::search_edge(int l,int &m,int &k) {
  * \param[in] fp a file handle to write to. */
 void voronoicell_base::draw_pov_mesh(double x,double y,double z,FILE *fp) {
 	int i,j,k,l,m,n;
-	double *ptsp=pts;
-	fprintf(fp,"mesh2 {\nvertex_vectors {\n%d\n",p);
-	for(i=0;i<p;i++,ptsp+=4) fprintf(fp,",<%g,%g,%g>\n",x+*ptsp*0.5,y+ptsp[1]*0.5,z+ptsp[2]*0.5);
-	fprintf(fp,"}\nface_indices {\n%d\n",(p-2)<<1);
+	fpoint *ptsp=pts;
+	text_writer tw(fp);
+	tw.put("mesh2 {\nvertex_vectors {\n");tw.put(p);tw.put('\n');
+	for(i=0;i<p;i++,ptsp+=4) {
+		tw.put(",<");tw.put3(x+*ptsp*0.5,y+ptsp[1]*0.5,z+ptsp[2]*0.5,',');tw.put(">\n");
+	}
+	tw.put("}\nface_indices {\n");tw.put((p-2)<<1);tw.put('\n');
 	for(i=1;i<p;i++) for(j=0;j<nu[i];j++) {
 		k=ed[i][j];
 		if(k>=0) {
@@ -1936,13 +2340,14 @@ void voronoicell_base::draw_pov_mesh(double x,double y,double z,FILE *fp) {
 			m=ed[k][l];ed[k][l]=-1-m;
 			while(m!=i) {
 				n=cycle_up(ed[k][nu[k]+l],m);
-				fprintf(fp,",<%d,%d,%d>\n",i,k,m);
+				tw.put(",<");tw.put(i);tw.put(',');tw.put(k);
+				tw.put(',');tw.put(m);tw.put(">\n");
 				k=m;l=n;
 				m=ed[k][l];ed[k][l]=-1-m;
 			}
 		}
 	}
-	fputs("}\ninside_vector <0,0,1>\n}\n",fp);
+	tw.put("}\ninside_vector <0,0,1>\n}\n");
 	reset_edges();
 }
 
@@ -1977,17 +2382,59 @@ inline unsigned int voronoicell_base::m_test(int n,double &ans) {
 	} else return m_calc(n,ans);
 }
 
+/** Computes the position of a vertex relative to the cutting plane, and
+ * classifies it as inside, outside, or on the plane. If the robust test is
+ * switched on and the result is close to the plane, then it is recomputed
+ * with the m_exact() routine.
+ * \param[in] n the vertex to test.
+ * \param[out] ans the result of the scalar product used in evaluating the
+ *                 location of the point.
+ * \return 0 if the point is inside the plane, 2 if the point is outside the
+ *         plane, or 1 if the point is within the plane. */
 unsigned int voronoicell_base::m_calc(int n,double &ans) {
-	double *pp=pts+4*n;
+	fpoint *pp=pts+4*n;
 	ans=*(pp++)*px;
 	ans+=*(pp++)*py;
 	ans+=*(pp++)*pz-prsq;
+	if(robust&&ans<robust_band_fac*tol&&ans>-robust_band_fac*tol) {
+		ans=m_exact(n);
+		VOROPP_COUNT(counters.exact++);
+	}
 	*pp=ans;
 	unsigned int maskr=ans<-tol?0:(ans>tol?2:1);
+	VOROPP_COUNT(if(maskr==1) counters.marginal++);
 	mask[n]=maskc|maskr;
 	return maskr;
 }
 
+/** Computes the position of a vertex relative to the cutting plane in
+ * extended precision. Each product is split into a sum of two doubles using
+ * Dekker's method, and the sums are accumulated with their rounding errors,
+ * so that the result is as accurate as if it had been computed with twice the
+ * precision of a double and then rounded.
+ * \param[in] n the vertex to test.
+ * \return The scalar product of the vertex with the plane normal, minus the
+ *	   plane displacement. */
+double voronoicell_base::m_exact(int n) {
+	const double sp=134217729.0;
+	double a[3]={pts[4*n],pts[4*n+1],pts[4*n+2]},b[3]={px,py,pz};
+	double s=-prsq,e=0,pr,pe,c,ah,al,bh,bl,t,z;
+	for(int i=0;i<3;i++) {
+
+		// Compute the product and its rounding error
+		pr=a[i]*b[i];
+		c=sp*a[i];ah=c-(c-a[i]);al=a[i]-ah;
+		c=sp*b[i];bh=c-(c-b[i]);bl=b[i]-bh;
+		pe=((ah*bh-pr)+ah*bl+al*bh)+al*bl;
+
+		// Add the product to the sum, keeping the rounding error
+		t=s+pr;z=t-s;
+		e+=(s-(t-z))+(pr-z)+pe;
+		s=t;
+	}
+	return s+e;
+}
+
 /** Checks to see if a given vertex is inside, outside or within the test
  * plane. If the point is far away from the test plane, the routine immediately
  * returns whether it is inside or outside. If the routine is close the the
@@ -2126,9 +2573,16 @@ void voronoicell_base::vertex_orders(std::vector<int> &v) {
 /** Outputs the vertex orders.
  * \param[out] fp the file handle to write to. */
 void voronoicell_base::output_vertex_orders(FILE *fp) {
-	if(p>0) {
-		fprintf(fp,"%d",*nu);
-		for(int *nup=nu+1;nup<nu+p;nup++) fprintf(fp," %d",*nup);
+	text_writer tw(fp);
+	output_vertex_orders(tw);
+}
+
+/** Outputs the vertex orders.
+ * \param[out] tw the text writer to write to. */
+void voronoicell_base::output_vertex_orders(text_writer &tw) {
+	for(int *nup=nu;nup<nu+p;nup++) {
+		if(nup>nu) tw.put(' ');
+		tw.put(*nup);
 	}
 }
 
@@ -2136,7 +2590,7 @@ void voronoicell_base::output_vertex_orders(FILE *fp) {
  * \param[out] v the vector to store the results in. */
 void voronoicell_base::vertices(std::vector<double> &v) {
 	v.resize(p<<2);
-	double *ptsp=pts;
+	fpoint *ptsp=pts;
 	for(int i=0;i<3*p;i+=3) {
 		v[i]=*(ptsp++)*0.5;
 		v[i+1]=*(ptsp++)*0.5;
@@ -2147,9 +2601,16 @@ void voronoicell_base::vertices(std::vector<double> &v) {
 /** Outputs the vertex vectors using the local coordinate system.
  * \param[out] fp the file handle to write to. */
 void voronoicell_base::output_vertices(FILE *fp) {
-	if(p>0) {
-		fprintf(fp,"(%g,%g,%g)",*pts*0.5,pts[1]*0.5,pts[2]*0.5);
-		for(double *ptsp=pts+4;ptsp<pts+(p<<2);ptsp+=4) fprintf(fp," (%g,%g,%g)",*ptsp*0.5,ptsp[1]*0.5,ptsp[2]*0.5);
+	text_writer tw(fp);
+	output_vertices(tw);
+}
+
+/** Outputs the vertex vectors using the local coordinate system.
+ * \param[out] tw the text writer to write to. */
+void voronoicell_base::output_vertices(text_writer &tw) {
+	for(fpoint *ptsp=pts;ptsp<pts+(p<<2);ptsp+=4) {
+		if(ptsp>pts) tw.put(' ');
+		tw.put('(');tw.put3(*ptsp*0.5,ptsp[1]*0.5,ptsp[2]*0.5,',');tw.put(')');
 	}
 }
 
@@ -2159,7 +2620,7 @@ void voronoicell_base::output_vertices(FILE *fp) {
  *                    coordinate system. */
 void voronoicell_base::vertices(double x,double y,double z,std::vector<double> &v) {
 	v.resize(3*p);
-	double *ptsp=pts;
+	fpoint *ptsp=pts;
 	for(int i=0;i<3*p;i+=3) {
 		v[i]=x+*(ptsp++)*0.5;
 		v[i+1]=y+*(ptsp++)*0.5;
@@ -2172,9 +2633,18 @@ void voronoicell_base::vertices(double x,double y,double z,std::vector<double> &
  * \param[in] (x,y,z) the position vector of the particle in the global
  *                    coordinate system. */
 void voronoicell_base::output_vertices(double x,double y,double z,FILE *fp) {
-	if(p>0) {
-		fprintf(fp,"(%g,%g,%g)",x+*pts*0.5,y+pts[1]*0.5,z+pts[2]*0.5);
-		for(double *ptsp=pts+4;ptsp<pts+(p<<2);ptsp+=4) fprintf(fp," (%g,%g,%g)",x+*ptsp*0.5,y+ptsp[1]*0.5,z+ptsp[2]*0.5);
+	text_writer tw(fp);
+	output_vertices(x,y,z,tw);
+}
+
+/** Outputs the vertex vectors using the global coordinate system.
+ * \param[in] (x,y,z) the position vector of the particle in the global
+ *                    coordinate system.
+ * \param[out] tw the text writer to write to. */
+void voronoicell_base::output_vertices(double x,double y,double z,text_writer &tw) {
+	for(fpoint *ptsp=pts;ptsp<pts+(p<<2);ptsp+=4) {
+		if(ptsp>pts) tw.put(' ');
+		tw.put('(');tw.put3(x+*ptsp*0.5,y+ptsp[1]*0.5,z+ptsp[2]*0.5,',');tw.put(')');
 	}
 }
 
@@ -2325,6 +2795,54 @@ bool voronoicell_base::plane_intersects_guess(double x,double y,double z,double
 	return true;
 }
 
+/** This routine tests to see whether the cell intersects any of several planes.
+ * It gives the same result as calling plane_intersects_guess() for the first
+ * plane and plane_intersects() for the others, and it chooses the same guess
+ * point up. However, if none of the planes intersect the guess point, then all
+ * of the planes are checked in a single sweep over the vertices, rather than
+ * one sweep for each plane.
+ * \param[in] n the number of planes, between one and plane_block.
+ * \param[in] pl the planes, stored as four consecutive arrays of length
+ *		 plane_block, holding the x, y, and z components of the
+ *		 normal vectors and the distances along them. The entries
+ *		 from n up to plane_block must be padded with planes that
+ *		 cannot intersect, such as zero normal vectors with a large
+ *		 distance.
+ * \return False if none of the planes intersect the cell, true if any do. */
+bool voronoicell_base::planes_intersect_guess(int n,const double *pl) {
+	const double *ply=pl+plane_block,*plz=ply+plane_block,*plr=plz+plane_block;
+	fpoint *pp;
+	int q,tp;
+	unsigned int o;
+
+	// Choose the guess point using the first plane, in the same way as
+	// the plane_intersects_guess() routine
+	up=0;
+	double g=*pl*(*pts)+*ply*pts[1]+*plz*pts[2];
+	if(g>=*plr) return true;
+	int ca=1,cc=p>>3,mp=1;
+	double m;
+	while(ca<cc) {
+		m=*pl*pts[4*mp]+*ply*pts[4*mp+1]+*plz*pts[4*mp+2];
+		if(m>g) {
+			if(m>*plr) return true;
+			g=m;up=mp;
+		}
+		ca+=mp++;
+	}
+
+	// Test the other planes against the guess point
+	pp=pts+(up<<2);
+	for(q=1;q<n;q++) if(pl[q]*(*pp)+ply[q]*pp[1]+plz[q]*pp[2]>=plr[q]) return true;
+
+	// Test every vertex against all of the planes at once
+	for(tp=0,pp=pts;tp<p;tp++,pp+=4) {
+		for(o=0,q=0;q<plane_block;q++) o|=pl[q]*(*pp)+ply[q]*pp[1]+plz[q]*pp[2]>plr[q];
+		if(o!=0) return true;
+	}
+	return false;
+}
+
 /* This routine tests to see if a cell intersects a plane, by tracing over the
  * cell from vertex to vertex, starting at up. It is meant to be called either
  * by plane_intersects() or plane_intersects_track(), when those routines
@@ -2334,8 +2852,17 @@ bool voronoicell_base::plane_intersects_guess(double x,double y,double z,double
  * \param[in] g the distance of up from the plane.
  * \return False if the plane does not intersect the plane, true if it does. */
 inline bool voronoicell_base::plane_intersects_track(double x,double y,double z,double rsq,double g) {
+	int tp=0,q;
+	unsigned int o;
+	fpoint *pp=pts;
 
-	for(int tp=0;tp<p;tp++) if(x*pts[tp<<2]+y*pts[(tp<<2)+1]+z*pts[(tp<<2)+2]>rsq) return true;
+	// Classify the vertices in blocks without branching, so that the
+	// compiler can evaluate each block with vector instructions
+	for(;tp+vertex_block<=p;tp+=vertex_block) {
+		for(o=0,q=0;q<vertex_block;q++,pp+=4) o|=x*(*pp)+y*pp[1]+z*pp[2]>rsq;
+		if(o!=0) return true;
+	}
+	for(;tp<p;tp++,pp+=4) if(x*(*pp)+y*pp[1]+z*pp[2]>rsq) return true;
 	return false;
 /*
 	int ls,us,lp;
@@ -2372,14 +2899,14 @@ inline bool voronoicell_base::plane_intersects_track(double x,double y,double z,
 				// and find the one which is closest to the
 				// plane
 				for(us=0;us<ls;us++) {
-					tp=ed[up][us];double *pp=pts+(tp<<2);
+					tp=ed[up][us];fpoint *pp=pts+(tp<<2);
 					g=x*(*pp)+y*pp[1]+z*pp[2];
 					if(g>t) break;
 				}
 				if(us==ls) {
 					us++;
 					while(us<nu[up]) {
-						tp=ed[up][us];double *pp=pts+(tp<<2);
+						tp=ed[up][us];fpoint *pp=pts+(tp<<2);
 						g=x*(*pp)+y*pp[1]+z*pp[2];
 						if(g>t) break;
 						us++;
@@ -2412,66 +2939,69 @@ int voronoicell_base::number_of_edges() {
  *                    cell.
  * \param[in] r a radius associated with the particle.
  * \param[in] fp the file handle to write to. */
-void voronoicell_base::output_custom(const char *format,int i,double x,double y,double z,double r,FILE *fp) {
+void voronoicell_base::output_custom(const char *format,voro_id i,double x,double y,double z,double r,FILE *fp) {
+	trace_scope ts("output");
 	char *fmp=(const_cast<char*>(format));
 	std::vector<int> vi;
+	std::vector<voro_id> vn;
 	std::vector<double> vd;
+	text_writer tw(fp);
 	while(*fmp!=0) {
 		if(*fmp=='%') {
 			fmp++;
 			switch(*fmp) {
 
 				// Particle-related output
-				case 'i': fprintf(fp,"%d",i);break;
-				case 'x': fprintf(fp,"%g",x);break;
-				case 'y': fprintf(fp,"%g",y);break;
-				case 'z': fprintf(fp,"%g",z);break;
-				case 'q': fprintf(fp,"%g %g %g",x,y,z);break;
-				case 'r': fprintf(fp,"%g",r);break;
+				case 'i': tw.put(i);break;
+				case 'x': tw.put(x);break;
+				case 'y': tw.put(y);break;
+				case 'z': tw.put(z);break;
+				case 'q': tw.put3(x,y,z,' ');break;
+				case 'r': tw.put(r);break;
 
 				// Vertex-related output
-				case 'w': fprintf(fp,"%d",p);break;
-				case 'p': output_vertices(fp);break;
-				case 'P': output_vertices(x,y,z,fp);break;
-				case 'o': output_vertex_orders(fp);break;
-				case 'm': fprintf(fp,"%g",0.25*max_radius_squared());break;
+				case 'w': tw.put(p);break;
+				case 'p': output_vertices(tw);break;
+				case 'P': output_vertices(x,y,z,tw);break;
+				case 'o': output_vertex_orders(tw);break;
+				case 'm': tw.put(0.25*max_radius_squared());break;
 
 				// Edge-related output
-				case 'g': fprintf(fp,"%d",number_of_edges());break;
-				case 'E': fprintf(fp,"%g",total_edge_distance());break;
-				case 'e': face_perimeters(vd);voro_print_vector(vd,fp);break;
+				case 'g': tw.put(number_of_edges());break;
+				case 'E': tw.put(total_edge_distance());break;
+				case 'e': face_perimeters(vd);voro_print_vector(vd,tw);break;
 
 				// Face-related output
-				case 's': fprintf(fp,"%d",number_of_faces());break;
-				case 'F': fprintf(fp,"%g",surface_area());break;
+				case 's': tw.put(number_of_faces());break;
+				case 'F': tw.put(surface_area());break;
 				case 'A': {
 						  face_freq_table(vi);
-						  voro_print_vector(vi,fp);
+						  voro_print_vector(vi,tw);
 					  } break;
-				case 'a': face_orders(vi);voro_print_vector(vi,fp);break;
-				case 'f': face_areas(vd);voro_print_vector(vd,fp);break;
+				case 'a': face_orders(vi);voro_print_vector(vi,tw);break;
+				case 'f': face_areas(vd);voro_print_vector(vd,tw);break;
 				case 't': {
 						  face_vertices(vi);
-						  voro_print_face_vertices(vi,fp);
+						  voro_print_face_vertices(vi,tw);
 					  } break;
 				case 'l': normals(vd);
-					  voro_print_positions(vd,fp);
+					  voro_print_positions(vd,tw);
 					  break;
-				case 'n': neighbors(vi);
-					  voro_print_vector(vi,fp);
+				case 'n': neighbors(vn);
+					  voro_print_vector(vn,tw);
 					  break;
 
 				// Volume-related output
-				case 'v': fprintf(fp,"%g",volume());break;
+				case 'v': tw.put(volume());break;
 				case 'c': {
 						  double cx,cy,cz;
 						  centroid(cx,cy,cz);
-						  fprintf(fp,"%g %g %g",cx,cy,cz);
+						  tw.put3(cx,cy,cz,' ');
 					  } break;
 				case 'C': {
 						  double cx,cy,cz;
 						  centroid(cx,cy,cz);
-						  fprintf(fp,"%g %g %g",x+cx,y+cy,z+cz);
+						  tw.put3(x+cx,y+cy,z+cz,' ');
 					  } break;
 
 				// End-of-string reached
@@ -2479,12 +3009,12 @@ void voronoicell_base::output_custom(const char *format,int i,double x,double y,
 
 				// The percent sign is not part of a
 				// control sequence
-				default: putc('%',fp);putc(*fmp,fp);
+				default: tw.put('%');tw.put(*fmp);
 			}
-		} else putc(*fmp,fp);
+		} else tw.put(*fmp);
 		fmp++;
 	}
-	fputs("\n",fp);
+	tw.put('\n');
 }
 
 /** This initializes the class to be a rectangular box. It calls the base class
@@ -2496,7 +3026,7 @@ void voronoicell_base::output_custom(const char *format,int i,double x,double y,
  * \param[in] (zmin,zmax) the minimum and maximum z coordinates. */
 void voronoicell_neighbor::init(double xmin,double xmax,double ymin,double ymax,double zmin,double zmax) {
 	init_base(xmin,xmax,ymin,ymax,zmin,zmax);
-	int *q=mne[3];
+	voro_id *q=mne[3];
 	*q=-5;q[1]=-3;q[2]=-1;
 	q[3]=-5;q[4]=-2;q[5]=-3;
 	q[6]=-5;q[7]=-1;q[8]=-4;
@@ -2518,7 +3048,7 @@ void voronoicell_neighbor::init(double xmin,double xmax,double ymin,double ymax,
  *              (0,l,0), (0,0,-l), and (0,0,l). */
 void voronoicell_neighbor::init_octahedron(double l) {
 	init_octahedron_base(l);
-	int *q=mne[4];
+	voro_id *q=mne[4];
 	*q=-5;q[1]=-6;q[2]=-7;q[3]=-8;
 	q[4]=-1;q[5]=-2;q[6]=-3;q[7]=-4;
 	q[8]=-6;q[9]=-5;q[10]=-2;q[11]=-1;
@@ -2538,7 +3068,7 @@ void voronoicell_neighbor::init_octahedron(double l) {
  * \param (x3,y3,z3) a position vector for the fourth vertex. */
 void voronoicell_neighbor::init_tetrahedron(double x0,double y0,double z0,double x1,double y1,double z1,double x2,double y2,double z2,double x3,double y3,double z3) {
 	init_tetrahedron_base(x0,y0,z0,x1,y1,z1,x2,y2,z2,x3,y3,z3);
-	int *q=mne[3];
+	voro_id *q=mne[3];
 	*q=-4;q[1]=-3;q[2]=-2;
 	q[3]=-3;q[4]=-4;q[5]=-1;
 	q[6]=-4;q[7]=-2;q[8]=-1;
@@ -2549,7 +3079,7 @@ void voronoicell_neighbor::init_tetrahedron(double x0,double y0,double z0,double
 /** This routine checks to make sure the neighbor information of each face is
  * consistent. */
 void voronoicell_neighbor::check_facets() {
-	int i,j,k,l,m,q;
+	int i,j,k,l,m;voro_id q;
 	for(i=1;i<p;i++) for(j=0;j<nu[i];j++) {
 		k=ed[i][j];
 		if(k>=0) {
@@ -2559,7 +3089,7 @@ void voronoicell_neighbor::check_facets() {
 			do {
 				m=ed[k][l];
 				ed[k][l]=-1-m;
-				if(ne[k][l]!=q) fprintf(stderr,"Facet error at (%d,%d)=%d, started from (%d,%d)=%d\n",k,l,ne[k][l],i,j,q);
+				if(ne[k][l]!=q) fprintf(stderr,"Facet error at (%d,%d)=%ld, started from (%d,%d)=%ld\n",k,l,long(ne[k][l]),i,j,long(q));
 				l=cycle_up(ed[k][nu[k]+l],m);
 				k=m;
 			} while (k!=i);
@@ -2568,26 +3098,34 @@ void voronoicell_neighbor::check_facets() {
 	reset_edges();
 }
 
+/** Returns the memory used by the cell, including the neighbor information.
+ * \return The number of bytes. */
+size_t voronoicell_neighbor::memory_used() {
+	size_t s=voronoicell_base::memory_used()+(current_vertices+current_vertex_order)*sizeof(voro_id*);
+	for(int i=0;i<current_vertex_order;i++) s+=size_t(mem[i])*i*sizeof(voro_id);
+	return s;
+}
+
 /** The class constructor allocates memory for storing neighbor information. */
 void voronoicell_neighbor::memory_setup() {
 	int i;
-	mne=new int*[current_vertex_order];
-	ne=new int*[current_vertices];
-	for(i=0;i<3;i++) mne[i]=new int[init_n_vertices*i];
-	mne[3]=new int[init_3_vertices*3];
-	for(i=4;i<current_vertex_order;i++) mne[i]=new int[init_n_vertices*i];
+	mne=v_new<voro_id*>(current_vertex_order);
+	ne=v_new<voro_id*>(current_vertices);
+	for(i=0;i<3;i++) mne[i]=v_new<voro_id>(init_n_vertices*i);
+	mne[3]=v_new<voro_id>(init_3_vertices*3);
+	for(i=4;i<current_vertex_order;i++) mne[i]=v_new<voro_id>(init_n_vertices*i);
 }
 
 /** The class destructor frees the dynamically allocated memory for storing
  * neighbor information. */
 voronoicell_neighbor::~voronoicell_neighbor() {
-	for(int i=current_vertex_order-1;i>=0;i--) if(mem[i]>0) delete [] mne[i];
-	delete [] mne;
-	delete [] ne;
+	for(int i=current_vertex_order-1;i>=0;i--) if(mem[i]>0) v_delete(mne[i]);
+	v_delete(mne);
+	v_delete(ne);
 }
 
 /** Computes a vector list of neighbors. */
-void voronoicell_neighbor::neighbors(std::vector<int> &v) {
+void voronoicell_neighbor::neighbors(std::vector<voro_id> &v) {
 	v.clear();
 	int i,j,k,l,m;
 	for(i=1;i<p;i++) for(j=0;j<nu[i];j++) {
@@ -2611,7 +3149,7 @@ void voronoicell_neighbor::neighbors(std::vector<int> &v) {
  * any memory errors are visible. */
 void voronoicell_base::print_edges() {
 	int j;
-	double *ptsp=pts;
+	fpoint *ptsp=pts;
 	for(int i=0;i<p;i++,ptsp+=4) {
 		printf("%d %d  ",i,nu[i]);
 		for(j=0;j<nu[i];j++) printf(" %d",ed[i][j]);
@@ -2630,14 +3168,16 @@ void voronoicell_neighbor::print_edges_neighbors(int i) {
 	if(nu[i]>0) {
 		int j=0;
 		printf("     (");
-		while(j<nu[i]-1) printf("%d,",ne[i][j++]);
-		printf("%d)",ne[i][j]);
+		while(j<nu[i]-1) printf("%ld,",long(ne[i][j++]));
+		printf("%ld)",long(ne[i][j]));
 	} else printf("     ()");
 }
 
 // Explicit instantiation
-template bool voronoicell_base::nplane(voronoicell&,double,double,double,double,int);
-template bool voronoicell_base::nplane(voronoicell_neighbor&,double,double,double,double,int);
+template bool voronoicell_base::nplane(voronoicell&,double,double,double,double,voro_id);
+template bool voronoicell_base::nplane(voronoicell_neighbor&,double,double,double,double,voro_id);
+template void voronoicell_base::face_data(voronoicell&,std::vector<int>*,std::vector<double>*,std::vector<double>*,std::vector<voro_id>*,std::vector<int>*,std::vector<double>*);
+template void voronoicell_base::face_data(voronoicell_neighbor&,std::vector<int>*,std::vector<double>*,std::vector<double>*,std::vector<voro_id>*,std::vector<int>*,std::vector<double>*);
 template void voronoicell_base::check_memory_for_copy(voronoicell&,voronoicell_base*);
 template void voronoicell_base::check_memory_for_copy(voronoicell_neighbor&,voronoicell_base*);
 
@@ -10,6 +10,7 @@
 #ifndef VOROPP_CELL_HH
 #define VOROPP_CELL_HH
 
+#include <algorithm>
 #include <vector>
 
 #include "config.hh"
@@ -17,6 +18,107 @@
 
 namespace voro {
 
+/** The flags that can be combined to describe which quantities a cell_query
+ * asks for. */
+enum cell_query_flags {
+	/** The volume of the cell. */
+	query_volume=1,
+	/** The centroid of the cell, relative to the particle. */
+	query_centroid=2,
+	/** The total surface area of the cell. */
+	query_surface_area=4,
+	/** The number of faces of the cell. */
+	query_faces=8,
+	/** The number of vertices of the cell. */
+	query_vertices=16,
+	/** The number of edges of the cell. */
+	query_edges=32,
+	/** The maximum distance from the particle to a vertex. */
+	query_max_radius=64,
+	/** The IDs of the neighboring particles, one per face. This
+	 * requires the cell to be computed with neighbor tracking. */
+	query_neighbors=128
+};
+
+/** \brief A structure describing a set of quantities to compute for a Voronoi
+ * cell, and holding the results.
+ *
+ * The caller sets the mask to a combination of the cell_query_flags before the
+ * cell is evaluated, and only those quantities are computed. The volume,
+ * centroid, surface area, and number of faces are all found in a single
+ * traversal of the faces of the cell. Fields that were not asked for are left
+ * unchanged. */
+struct cell_query {
+	/** The combination of cell_query_flags that are asked for. */
+	unsigned int mask;
+	/** The volume of the cell. */
+	double volume;
+	/** The x coordinate of the centroid, relative to the particle. */
+	double cx;
+	/** The y coordinate of the centroid, relative to the particle. */
+	double cy;
+	/** The z coordinate of the centroid, relative to the particle. */
+	double cz;
+	/** The total surface area of the cell. */
+	double area;
+	/** The maximum distance from the particle to a vertex. */
+	double max_radius;
+	/** The number of faces of the cell. */
+	int faces;
+	/** The number of vertices of the cell. */
+	int vertices;
+	/** The number of edges of the cell. */
+	int edges;
+	/** The IDs of the neighboring particles. */
+	std::vector<voro_id> neighbors;
+	/** Sets up a query.
+	 * \param[in] mask_ the combination of cell_query_flags to ask
+	 *		    for. */
+	cell_query(unsigned int mask_) : mask(mask_), volume(0), cx(0), cy(0),
+		cz(0), area(0), max_radius(0), faces(0), vertices(0), edges(0) {}
+};
+
+/** \brief A class for allocating the memory of Voronoi cells from large
+ * chunks.
+ *
+ * A Voronoi cell normally makes several dozen separate memory allocations when
+ * it is constructed, and more as it grows. If the cell is given a cell_arena,
+ * then all of these allocations are carved out of large chunks owned by the
+ * arena instead, and they are never freed individually. When all of the cells
+ * using the arena have been destroyed, the release() routine makes all of the
+ * memory available again without returning it to the system, so that cells can
+ * then be repeatedly created and destroyed without calling the system
+ * allocator. An arena must not be shared between threads. */
+class cell_arena {
+	public:
+		cell_arena(size_t chunk_size_=arena_chunk_size);
+		~cell_arena();
+		void* allocate(size_t n);
+		void release();
+		/** Returns the total amount of memory held by the arena.
+		 * \return The number of bytes. */
+		inline size_t total_memory() {
+			size_t t=0;
+			for(unsigned int i=0;i<cs.size();i++) t+=cs[i];
+			return t;
+		}
+	private:
+		/** The minimum size of each chunk. */
+		const size_t chunk_size;
+		/** The index of the chunk currently being allocated from, or -1
+		 * if no allocations have been made since the last release. */
+		int cc;
+		/** A pointer to the next free byte in the current chunk. */
+		char *cp;
+		/** A pointer to the end of the current chunk. */
+		char *ce;
+		/** The chunks of memory. */
+		std::vector<char*> ch;
+		/** The sizes of the chunks. */
+		std::vector<size_t> cs;
+		void next_chunk(size_t n);
+};
+
 /** \brief A class representing a single Voronoi cell.
  *
  * This class represents a single Voronoi cell, as a collection of vertices
@@ -32,6 +134,9 @@ namespace voro {
  * whether neighboring particle ID information needs to be tracked. */
 class voronoicell_base {
 	public:
+		/** A pointer to the arena that the cell's memory is allocated
+		 * from, or NULL if the memory is allocated individually. */
+		cell_arena *const arena;
 		/** This holds the current size of the arrays ed and nu, which
 		 * hold the vertex information. If more vertices are created
 		 * than can fit in this array, then it is dynamically extended
@@ -85,16 +190,53 @@ class voronoicell_base {
 		unsigned int *mask;
 		/** This in an array with size 3*current_vertices for holding
 		 * the positions of the vertices. */
-		double *pts;
+		fpoint *pts;
 		double tol;
 		double tol_cu;
 		double big_tol;
-		voronoicell_base(double max_len_sq);
+		/** Whether the robust plane test is used. If this is set, then
+		 * the position of a vertex relative to a cutting plane is
+		 * recomputed in extended precision whenever the usual floating
+		 * point result is within robust_band_fac times the tolerance
+		 * of the plane, so that vertices close to the plane are
+		 * classified consistently, and the new vertices made from them
+		 * are placed accurately. Vertices far from the plane are
+		 * tested at the usual speed. */
+		bool robust;
+		/** The largest number of vertices that the cell may allocate
+		 * memory for. If a cell needs more than this, then it is
+		 * abandoned as described for over_budget. */
+		int vertex_limit;
+		/** The largest vertex order that the cell may allocate memory
+		 * for. */
+		int order_limit;
+		/** Whether the last computation of the cell was abandoned
+		 * because it exceeded the vertex_limit or order_limit budget.
+		 * In that case the plane routine reports the cell as deleted,
+		 * the cell is left with no vertices, and its memory is not
+		 * enlarged any further. The flag is cleared when the cell is
+		 * next initialized. */
+		bool over_budget;
+		/** Counters for the events in the construction of the cell,
+		 * which are only updated if VOROPP_COUNTERS is set. When the
+		 * cell is computed by a voro_compute class, the counts are
+		 * moved to that class at the end of the computation. */
+		voro_counters counters;
+		voronoicell_base(double max_len_sq,cell_arena *arena_=NULL);
 		~voronoicell_base();
 		void init_base(double xmin,double xmax,double ymin,double ymax,double zmin,double zmax);
 		void init_octahedron_base(double l);
 		void init_tetrahedron_base(double x0,double y0,double z0,double x1,double y1,double z1,double x2,double y2,double z2,double x3,double y3,double z3);
 		void translate(double x,double y,double z);
+		/** Sets the memory budget of the cell. The limits are clamped
+		 * to the absolute maxima in max_vertices and max_vertex_order,
+		 * and to the memory that the cell has already allocated.
+		 * \param[in] nv the largest number of vertices to allow.
+		 * \param[in] no the largest vertex order to allow. */
+		inline void set_memory_budget(int nv,int no) {
+			vertex_limit=nv<current_vertices?current_vertices:(nv>max_vertices?max_vertices:nv);
+			order_limit=no<current_vertex_order?current_vertex_order:(no>max_vertex_order?max_vertex_order:no);
+		}
 		void draw_pov(double x,double y,double z,FILE *fp=stdout);
 		/** Outputs the cell in POV-Ray format, using cylinders for edges
 		 * and spheres for vertices, to a given file.
@@ -128,20 +270,44 @@ class voronoicell_base {
 			fclose(fp);
 		}
 		double volume();
-		double max_radius_squared();
+		/** Computes the maximum radius squared of a vertex from the
+		 * center of the cell. The value is cached, and is only
+		 * recomputed when a plane cut may have removed the vertex that
+		 * gave it, so that the routine can be called after every
+		 * block of particles in the cell computation.
+		 * \return The maximum radius squared of a vertex. */
+		inline double max_radius_squared() {
+			if(!mrs_ok) update_max_radius();
+			return mrs;
+		}
 		double total_edge_distance();
 		double surface_area();
 		void centroid(double &cx,double &cy,double &cz);
+		void evaluate(cell_query &qr);
+		template<class vc_class>
+		void face_data(vc_class &vc,std::vector<int> *ord,std::vector<double> *area,std::vector<double> *perim,std::vector<voro_id> *nb,std::vector<int> *fv=NULL,std::vector<double> *nm=NULL);
 		int number_of_faces();
 		int number_of_edges();
 		void vertex_orders(std::vector<int> &v);
 		void output_vertex_orders(FILE *fp=stdout);
+		void output_vertex_orders(text_writer &tw);
 		void vertices(std::vector<double> &v);
 		void output_vertices(FILE *fp=stdout);
+		void output_vertices(text_writer &tw);
 		void vertices(double x,double y,double z,std::vector<double> &v);
 		void output_vertices(double x,double y,double z,FILE *fp=stdout);
+		void output_vertices(double x,double y,double z,text_writer &tw);
 		void face_areas(std::vector<double> &v);
-		void minkowski(double r,double &ar,double &vo);
+		/** Calculates the contributions to the Minkowski functionals
+		 * for this Voronoi cell.
+		 * \param[in] r the radius to consider.
+		 * \param[out] ar the area functional.
+		 * \param[out] vo the volume functional. */
+		inline void minkowski(double r,double &ar,double &vo) {
+			minkowski(1,&r,&ar,&vo);
+		}
+		void minkowski(int nr,const double *r,double *ar,double *vo);
+		void minkowski(const std::vector<double> &r,std::vector<double> &ar,std::vector<double> &vo);
 		/** Outputs the areas of the faces.
 		 * \param[in] fp the file handle to write to. */
 		inline void output_face_areas(FILE *fp=stdout) {
@@ -187,11 +353,12 @@ class voronoicell_base {
 		 * \param[in] format the custom format string to use.
 		 * \param[in] fp the file handle to write to. */
 		inline void output_custom(const char *format,FILE *fp=stdout) {output_custom(format,0,0,0,0,default_radius,fp);}
-		void output_custom(const char *format,int i,double x,double y,double z,double r,FILE *fp=stdout);
+		void output_custom(const char *format,voro_id i,double x,double y,double z,double r,FILE *fp=stdout);
 		template<class vc_class>
-		bool nplane(vc_class &vc,double x,double y,double z,double rsq,int p_id);
+		bool nplane(vc_class &vc,double x,double y,double z,double rsq,voro_id p_id);
 		bool plane_intersects(double x,double y,double z,double rsq);
 		bool plane_intersects_guess(double x,double y,double z,double rsq);
+		bool planes_intersect_guess(int n,const double *pl);
 		void construct_relations();
 		void check_relations();
 		void check_duplicates();
@@ -201,7 +368,7 @@ class voronoicell_base {
 		 * \param[out] v a reference to a vector in which to return the
 		 *               results. If no neighbor information is
 		 *               available, a blank vector is returned. */
-		virtual void neighbors(std::vector<int> &v) {v.clear();}
+		virtual void neighbors(std::vector<voro_id> &v) {v.clear();}
 		/** This is a virtual function that is overridden by a routine
 		 * to print a list of IDs of neighboring particles
 		 * corresponding to each face. By default, when no neighbor
@@ -214,6 +381,7 @@ class voronoicell_base {
 		 * routine does nothing.
 		 * \param[in] i the vertex to consider. */
 		virtual void print_edges_neighbors(int i) {};
+		virtual size_t memory_used();
 		/** This is a simple inline function for picking out the index
 		 * of the next edge counterclockwise at the current vertex.
 		 * \param[in] a the index of an edge of the current vertex.
@@ -265,18 +433,30 @@ class voronoicell_base {
 		double pz;
 		/** The magnitude of the normal vector to the test plane. */
 		double prsq;
+		/** The cached maximum radius squared of a vertex. */
+		double mrs;
+		/** The x coordinate of the vertex that gives the cached
+		 * maximum radius squared. */
+		double mrx;
+		/** The y coordinate of this vertex. */
+		double mry;
+		/** The z coordinate of this vertex. */
+		double mrz;
+		/** Whether the cached maximum radius squared is up to date. */
+		bool mrs_ok;
+		void update_max_radius();
 		template<class vc_class>
 		void add_memory(vc_class &vc,int i);
 		template<class vc_class>
-		void add_memory_vertices(vc_class &vc);
+		bool add_memory_vertices(vc_class &vc);
 		template<class vc_class>
-		void add_memory_vorder(vc_class &vc);
+		bool add_memory_vorder(vc_class &vc);
 		void add_memory_ds();
 		void add_memory_ds2();
 		void add_memory_xse();
 		bool failsafe_find(int &lp,int &ls,int &us,double &l,double &u);
 		template<class vc_class>
-		bool create_facet(vc_class &vc,int lp,int ls,double l,int us,double u,int p_id);
+		bool create_facet(vc_class &vc,int lp,int ls,double l,int us,double u,voro_id p_id);
 		template<class vc_class>
 		bool collapse_order1(vc_class &vc);
 		template<class vc_class>
@@ -293,17 +473,41 @@ class voronoicell_base {
 		bool definite_max(int &lp,int &ls,double &l,double &u,unsigned int &uw);
 		inline bool search_upward(unsigned int &lw,int &lp,int &ls,int &us,double &l,double &u);
 		bool definite_min(int &lp,int &us,double &l,double &u,unsigned int &lw);
-		inline void minkowski_contrib(int i,int k,int m,double r,double &ar,double &vo);
-		void minkowski_edge(double x0,double r1,double s1,double r2,double s2,double r,double &ar,double &vo);
-		void minkowski_formula(double x0,double y0,double z0,double r,double &ar,double &vo);
+		inline void minkowski_contrib(int i,int k,int m,int nr,const double *r,double *ar,double *vo);
+		void minkowski_edge(double x0,double r1,double s1,double r2,double s2,int nr,const double *r,double *ar,double *vo);
+		void minkowski_formula(double x0,double y0,double z0,int nr,const double *rv,double *ar,double *vo);
 		inline bool plane_intersects_track(double x,double y,double z,double rs,double g);
 		inline void normals_search(std::vector<double> &v,int i,int j,int k);
+		void face_normal(const int *s,int q,std::vector<double> &v);
 		inline bool search_edge(int l,int &m,int &k);
+		static int format_position(char *s,double x,double y,double z,int prec);
 		inline unsigned int m_test(int n,double &ans);
 		inline unsigned int m_testx(int n,double &ans);
 		unsigned int m_calc(int n,double &ans);
+		double m_exact(int n);
 		inline void flip(int tp) {ed[tp][nu[tp]<<1]=-1-ed[tp][nu[tp]<<1];}
 		int check_marginal(int n,double &ans);
+		void swap_base(voronoicell_base &c);
+		/** Copies the tolerances, the robust flag, and the memory
+		 * budget from another cell, which is used when a cell is
+		 * copy-constructed.
+		 * \param[in] c the cell to copy from. */
+		inline void copy_tolerance(const voronoicell_base &c) {
+			tol=c.tol;tol_cu=c.tol_cu;big_tol=c.big_tol;robust=c.robust;
+			vertex_limit=c.vertex_limit;order_limit=c.order_limit;
+		}
+		/** Allocates an array, either from the arena or individually.
+		 * \param[in] n the number of elements.
+		 * \return A pointer to the array. */
+		template<class T>
+		inline T* v_new(int n) {
+			return arena==NULL?new T[n]:static_cast<T*>(arena->allocate(n*sizeof(T)));
+		}
+		/** Frees an array that was allocated by v_new(). Arrays from an
+		 * arena are only freed when the arena is released.
+		 * \param[in] q a pointer to the array. */
+		template<class T>
+		inline void v_delete(T *q) {if(arena==NULL) delete [] q;}
 		friend class voronoicell;
 		friend class voronoicell_neighbor;
 };
@@ -317,10 +521,40 @@ class voronoicell_base {
 class voronoicell : public voronoicell_base {
 	public:
 		using voronoicell_base::nplane;
+		using voronoicell_base::face_data;
 		voronoicell() : voronoicell_base(default_length*default_length) {}
 		voronoicell(double max_len_sq_) : voronoicell_base(max_len_sq_) {}
 		template<class c_class>
 		voronoicell(c_class &con) : voronoicell_base(con.max_len_sq) {}
+		/** Constructs a Voronoi cell whose memory is allocated from an
+		 * arena.
+		 * \param[in] max_len_sq_ the maximum length squared, which
+		 *			sets the tolerance.
+		 * \param[in] ar the arena to use, which must outlive the
+		 *		 cell. */
+		voronoicell(double max_len_sq_,cell_arena &ar) : voronoicell_base(max_len_sq_,&ar) {}
+		/** Constructs a Voronoi cell whose memory is allocated from an
+		 * arena, with the tolerance set to match a container.
+		 * \param[in] con the container class to use.
+		 * \param[in] ar the arena to use, which must outlive the
+		 *		 cell. */
+		template<class c_class>
+		voronoicell(c_class &con,cell_arena &ar) : voronoicell_base(con.max_len_sq,&ar) {}
+		/** Constructs a copy of another Voronoi cell, with the same
+		 * tolerance. The memory of the copy is allocated individually,
+		 * even if the other cell uses an arena, so that cells can be
+		 * stored in standard containers and returned from functions.
+		 * \param[in] c the cell to copy. */
+		voronoicell(const voronoicell &c) : voronoicell_base(default_length*default_length) {
+			copy_tolerance(c);*this=const_cast<voronoicell&>(c);
+		}
+		/** Constructs a copy of another Voronoi cell. This is needed
+		 * so that copying a non-constant cell does not select the
+		 * constructor that takes a container.
+		 * \param[in] c the cell to copy. */
+		voronoicell(voronoicell &c) : voronoicell_base(default_length*default_length) {
+			copy_tolerance(c);*this=c;
+		}
 		/** Copies the information from another voronoicell class into
 		 * this class, extending memory allocation if necessary.
 		 * \param[in] c the class to copy. */
@@ -328,6 +562,11 @@ class voronoicell : public voronoicell_base {
 			voronoicell_base* vb((voronoicell_base*) &c);
 			check_memory_for_copy(*this,vb);copy(vb);
 		}
+		/** Exchanges the contents of this cell with another one, by
+		 * swapping their memory rather than copying it. The two cells
+		 * must use the same arena, or neither use one.
+		 * \param[in] c the cell to exchange with. */
+		inline void swap(voronoicell &c) {swap_base(c);}
 		/** Cuts a Voronoi cell using by the plane corresponding to the
 		 * perpendicular bisector of a particle.
 		 * \param[in] (x,y,z) the position of the particle.
@@ -336,9 +575,28 @@ class voronoicell : public voronoicell_base {
 		 *                 neighbor tracking is enabled.
 		 * \return False if the plane cut deleted the cell entirely,
 		 *         true otherwise. */
-		inline bool nplane(double x,double y,double z,double rsq,int p_id) {
+		inline bool nplane(double x,double y,double z,double rsq,voro_id p_id) {
 			return nplane(*this,x,y,z,rsq,0);
 		}
+		/** Computes the orders, areas, perimeters, neighbor IDs,
+		 * vertices, and normal vectors of the faces in a single
+		 * traversal. Any of the output vectors can be NULL, in which
+		 * case that quantity is skipped.
+		 * \param[out] ord a vector in which to store the number of
+		 *		   edges of each face.
+		 * \param[out] area a vector in which to store the area of each
+		 *		    face.
+		 * \param[out] perim a vector in which to store the perimeter of
+		 *		     each face.
+		 * \param[out] nb a vector in which to store the neighbor ID of
+		 *		  each face, which is left empty for this class.
+		 * \param[out] fv a vector in which to store the vertices of
+		 *		  each face, in the format of face_vertices().
+		 * \param[out] nm a vector in which to store the normal vector
+		 *		  of each face, in the format of normals(). */
+		inline void face_data(std::vector<int> *ord,std::vector<double> *area,std::vector<double> *perim,std::vector<voro_id> *nb,std::vector<int> *fv=NULL,std::vector<double> *nm=NULL) {
+			face_data(*this,ord,area,perim,nb,fv,nm);
+		}
 		/** Cuts a Voronoi cell using by the plane corresponding to the
 		 * perpendicular bisector of a particle.
 		 * \param[in] (x,y,z) the position of the particle.
@@ -346,7 +604,7 @@ class voronoicell : public voronoicell_base {
 		 *                 neighbor tracking is enabled.
 		 * \return False if the plane cut deleted the cell entirely,
 		 *         true otherwise. */
-		inline bool nplane(double x,double y,double z,int p_id) {
+		inline bool nplane(double x,double y,double z,voro_id p_id) {
 			double rsq=x*x+y*y+z*z;
 			return nplane(*this,x,y,z,rsq,0);
 		}
@@ -399,7 +657,7 @@ class voronoicell : public voronoicell_base {
 		inline void n_add_memory_vorder(int i) {};
 		inline void n_set_pointer(int p,int n) {};
 		inline void n_copy(int a,int b,int c,int d) {};
-		inline void n_set(int a,int b,int c) {};
+		inline void n_set(int a,int b,voro_id c) {};
 		inline void n_set_aux1(int k) {};
 		inline void n_copy_aux1(int a,int b) {};
 		inline void n_copy_aux1_shift(int a,int b) {};
@@ -411,7 +669,8 @@ class voronoicell : public voronoicell_base {
 		inline void n_switch_to_aux1(int i) {};
 		inline void n_copy_to_aux1(int i,int m) {};
 		inline void n_set_to_aux1_offset(int k,int m) {};
-		inline void n_neighbors(std::vector<int> &v) {v.clear();};
+		inline void n_neighbors(std::vector<voro_id> &v) {v.clear();};
+		inline void n_face_neighbor(std::vector<voro_id> *v,int i,int j) {};
 		friend class voronoicell_base;
 };
 
@@ -425,18 +684,19 @@ class voronoicell : public voronoicell_base {
 class voronoicell_neighbor : public voronoicell_base {
 	public:
 		using voronoicell_base::nplane;
+		using voronoicell_base::face_data;
 		/** This two dimensional array holds the neighbor information
 		 * associated with each vertex. mne[p] is a one dimensional
 		 * array which holds all of the neighbor information for
 		 * vertices of order p. */
-		int **mne;
+		voro_id **mne;
 		/** This is a two dimensional array that holds the neighbor
 		 * information associated with each vertex. ne[i] points to a
 		 * one-dimensional array in mne[nu[i]]. ne[i][j] holds the
 		 * neighbor information associated with the jth edge of vertex
 		 * i. It is set to the ID number of the plane that made the
 		 * face that is clockwise from the jth edge. */
-		int **ne;
+		voro_id **ne;
 		voronoicell_neighbor() : voronoicell_base(default_length*default_length) {
 			memory_setup();
 		}
@@ -447,9 +707,51 @@ class voronoicell_neighbor : public voronoicell_base {
 		voronoicell_neighbor(c_class &con) : voronoicell_base(con.max_len_sq) {
 			memory_setup();
 		}
+		/** Constructs a Voronoi cell whose memory is allocated from an
+		 * arena.
+		 * \param[in] max_len_sq_ the maximum length squared, which
+		 *			sets the tolerance.
+		 * \param[in] ar the arena to use, which must outlive the
+		 *		 cell. */
+		voronoicell_neighbor(double max_len_sq_,cell_arena &ar) : voronoicell_base(max_len_sq_,&ar) {
+			memory_setup();
+		}
+		/** Constructs a Voronoi cell whose memory is allocated from an
+		 * arena, with the tolerance set to match a container.
+		 * \param[in] con the container class to use.
+		 * \param[in] ar the arena to use, which must outlive the
+		 *		 cell. */
+		template<class c_class>
+		voronoicell_neighbor(c_class &con,cell_arena &ar) : voronoicell_base(con.max_len_sq,&ar) {
+			memory_setup();
+		}
+		/** Constructs a copy of another Voronoi cell, with the same
+		 * tolerance. The memory of the copy is allocated individually,
+		 * even if the other cell uses an arena.
+		 * \param[in] c the cell to copy. */
+		voronoicell_neighbor(const voronoicell_neighbor &c) : voronoicell_base(default_length*default_length) {
+			memory_setup();
+			copy_tolerance(c);*this=const_cast<voronoicell_neighbor&>(c);
+		}
+		/** Constructs a copy of another Voronoi cell. This is needed
+		 * so that copying a non-constant cell does not select the
+		 * constructor that takes a container.
+		 * \param[in] c the cell to copy. */
+		voronoicell_neighbor(voronoicell_neighbor &c) : voronoicell_base(default_length*default_length) {
+			memory_setup();
+			copy_tolerance(c);*this=c;
+		}
 		~voronoicell_neighbor();
 		void operator=(voronoicell &c);
 		void operator=(voronoicell_neighbor &c);
+		/** Exchanges the contents of this cell with another one, by
+		 * swapping their memory rather than copying it. The two cells
+		 * must use the same arena, or neither use one.
+		 * \param[in] c the cell to exchange with. */
+		inline void swap(voronoicell_neighbor &c) {
+			swap_base(c);
+			std::swap(mne,c.mne);std::swap(ne,c.ne);
+		}
 		/** Cuts the Voronoi cell by a particle whose center is at a
 		 * separation of (x,y,z) from the cell center. The value of rsq
 		 * should be initially set to \f$x^2+y^2+z^2\f$.
@@ -458,9 +760,28 @@ class voronoicell_neighbor : public voronoicell_base {
 		 * \param[in] p_id the plane ID (for neighbor tracking only).
 		 * \return False if the plane cut deleted the cell entirely,
 		 * true otherwise. */
-		inline bool nplane(double x,double y,double z,double rsq,int p_id) {
+		inline bool nplane(double x,double y,double z,double rsq,voro_id p_id) {
 			return nplane(*this,x,y,z,rsq,p_id);
 		}
+		/** Computes the orders, areas, perimeters, neighbor IDs,
+		 * vertices, and normal vectors of the faces in a single
+		 * traversal. Any of the output vectors can be NULL, in which
+		 * case that quantity is skipped.
+		 * \param[out] ord a vector in which to store the number of
+		 *		   edges of each face.
+		 * \param[out] area a vector in which to store the area of each
+		 *		    face.
+		 * \param[out] perim a vector in which to store the perimeter of
+		 *		     each face.
+		 * \param[out] nb a vector in which to store the neighbor ID of
+		 *		  each face.
+		 * \param[out] fv a vector in which to store the vertices of
+		 *		  each face, in the format of face_vertices().
+		 * \param[out] nm a vector in which to store the normal vector
+		 *		  of each face, in the format of normals(). */
+		inline void face_data(std::vector<int> *ord,std::vector<double> *area,std::vector<double> *perim,std::vector<voro_id> *nb,std::vector<int> *fv=NULL,std::vector<double> *nm=NULL) {
+			face_data(*this,ord,area,perim,nb,fv,nm);
+		}
 		/** This routine calculates the modulus squared of the vector
 		 * before passing it to the main nplane() routine with full
 		 * arguments.
@@ -468,7 +789,7 @@ class voronoicell_neighbor : public voronoicell_base {
 		 * \param[in] p_id the plane ID (for neighbor tracking only).
 		 * \return False if the plane cut deleted the cell entirely,
 		 *         true otherwise. */
-		inline bool nplane(double x,double y,double z,int p_id) {
+		inline bool nplane(double x,double y,double z,voro_id p_id) {
 			double rsq=x*x+y*y+z*z;
 			return nplane(*this,x,y,z,rsq,p_id);
 		}
@@ -498,32 +819,41 @@ class voronoicell_neighbor : public voronoicell_base {
 		void init_octahedron(double l);
 		void init_tetrahedron(double x0,double y0,double z0,double x1,double y1,double z1,double x2,double y2,double z2,double x3,double y3,double z3);
 		void check_facets();
-		virtual void neighbors(std::vector<int> &v);
+		/** Determines whether any face of the cell was made by a wall
+		 * or by the boundary of the container, which are marked with
+		 * negative IDs, rather than by a neighboring particle.
+		 * \return True if there is such a face, false otherwise. */
+		inline bool reaches_wall() {
+			for(int i=0;i<p;i++) for(int j=0;j<nu[i];j++) if(ne[i][j]<0) return true;
+			return false;
+		}
+		virtual void neighbors(std::vector<voro_id> &v);
 		virtual void print_edges_neighbors(int i);
 		virtual void output_neighbors(FILE *fp=stdout) {
-			std::vector<int> v;neighbors(v);
+			std::vector<voro_id> v;neighbors(v);
 			voro_print_vector(v,fp);
 		}
+		virtual size_t memory_used();
 	private:
-		int *paux1;
-		int *paux2;
+		voro_id *paux1;
+		voro_id *paux2;
 		void memory_setup();
-		inline void n_allocate(int i,int m) {mne[i]=new int[m*i];}
+		inline void n_allocate(int i,int m) {mne[i]=v_new<voro_id>(m*i);}
 		inline void n_add_memory_vertices(int i) {
-			int **pp=new int*[i];
+			voro_id **pp=v_new<voro_id*>(i);
 			for(int j=0;j<current_vertices;j++) pp[j]=ne[j];
-			delete [] ne;ne=pp;
+			v_delete(ne);ne=pp;
 		}
 		inline void n_add_memory_vorder(int i) {
-			int **p2=new int*[i];
+			voro_id **p2=v_new<voro_id*>(i);
 			for(int j=0;j<current_vertex_order;j++) p2[j]=mne[j];
-			delete [] mne;mne=p2;
+			v_delete(mne);mne=p2;
 		}
 		inline void n_set_pointer(int p,int n) {
 			ne[p]=mne[n]+n*mec[n];
 		}
 		inline void n_copy(int a,int b,int c,int d) {ne[a][b]=ne[c][d];}
-		inline void n_set(int a,int b,int c) {ne[a][b]=c;}
+		inline void n_set(int a,int b,voro_id c) {ne[a][b]=c;}
 		inline void n_set_aux1(int k) {paux1=mne[k]+k*mec[k];}
 		inline void n_copy_aux1(int a,int b) {paux1[b]=ne[a][b];}
 		inline void n_copy_aux1_shift(int a,int b) {paux1[b]=ne[a][b+1];}
@@ -534,13 +864,22 @@ class voronoicell_neighbor : public voronoicell_base {
 		inline void n_copy_pointer(int a,int b) {ne[a]=ne[b];}
 		inline void n_set_to_aux1(int j) {ne[j]=paux1;}
 		inline void n_set_to_aux2(int j) {ne[j]=paux2;}
-		inline void n_allocate_aux1(int i) {paux1=new int[i*mem[i]];}
-		inline void n_switch_to_aux1(int i) {delete [] mne[i];mne[i]=paux1;}
+		inline void n_allocate_aux1(int i) {paux1=v_new<voro_id>(i*mem[i]);}
+		inline void n_switch_to_aux1(int i) {v_delete(mne[i]);mne[i]=paux1;}
 		inline void n_copy_to_aux1(int i,int m) {paux1[m]=mne[i][m];}
 		inline void n_set_to_aux1_offset(int k,int m) {ne[k]=paux1+m;}
+		inline void n_face_neighbor(std::vector<voro_id> *v,int i,int j) {v->push_back(ne[i][j]);}
 		friend class voronoicell_base;
 };
 
+/** Exchanges the contents of two Voronoi cells without copying them.
+ * \param[in] (a,b) the cells to exchange. */
+inline void swap(voronoicell &a,voronoicell &b) {a.swap(b);}
+
+/** Exchanges the contents of two Voronoi cells without copying them.
+ * \param[in] (a,b) the cells to exchange. */
+inline void swap(voronoicell_neighbor &a,voronoicell_neighbor &b) {a.swap(b);}
+
 }
 
 #endif
@@ -0,0 +1,353 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file cell_2d.cc
+ * \brief Function implementations for the voronoicell_2d class. */
+
+#include <cmath>
+
+#include "config.hh"
+#include "common.hh"
+#include "cell_2d.hh"
+
+namespace voro {
+
+/** The class constructor allocates memory for the two vertex buffers.
+ * \param[in] max_len_sq the maximum length squared that could be encountered
+ *                       in the cell, used to scale the tolerance. */
+voronoicell_2d::voronoicell_2d(double max_len_sq) : p(0), current_vertices(init_vertices_2d),
+	pts(new double[current_vertices<<1]), ne(new int[current_vertices]),
+	tol(tolerance*max_len_sq), pts2(new double[current_vertices<<1]),
+	ne2(new int[current_vertices]), u(new double[current_vertices]) {}
+
+/** The class destructor frees the dynamically allocated memory. */
+voronoicell_2d::~voronoicell_2d() {
+	delete [] u;
+	delete [] ne2;delete [] pts2;
+	delete [] ne;delete [] pts;
+}
+
+/** Doubles the size of the vertex buffers. The contents of the first buffer
+ * are copied across, while the second buffer and the line positions are
+ * scratch space that does not need to be preserved. */
+void voronoicell_2d::add_memory() {
+	int i=current_vertices<<1;
+	if(i>max_vertices) voro_fatal_error("Vertex memory allocation exceeded absolute maximum",VOROPP_MEMORY_ERROR);
+#if VOROPP_VERBOSE >=2
+	fprintf(stderr,"2D vertex memory scaled up to %d\n",i);
+#endif
+	double *npts=new double[i<<1];
+	int *nne=new int[i];
+	for(int j=0;j<(p<<1);j++) npts[j]=pts[j];
+	for(int j=0;j<p;j++) nne[j]=ne[j];
+	delete [] pts;pts=npts;
+	delete [] ne;ne=nne;
+	delete [] pts2;pts2=new double[i<<1];
+	delete [] ne2;ne2=new int[i];
+	delete [] u;u=new double[i];
+	current_vertices=i;
+}
+
+/** Initializes the cell to be a rectangle. The edges are given the IDs -1 to
+ * -4, for the walls at xmin, xmax, ymin, and ymax respectively, in the same
+ * way as the faces of the three-dimensional cells.
+ * \param[in] (xmin,xmax) the minimum and maximum x coordinates.
+ * \param[in] (ymin,ymax) the minimum and maximum y coordinates. */
+void voronoicell_2d::init(double xmin,double xmax,double ymin,double ymax) {
+	xmin*=2;xmax*=2;ymin*=2;ymax*=2;
+	p=4;
+	*pts=xmin;pts[1]=ymin;*ne=-3;
+	pts[2]=xmax;pts[3]=ymin;ne[1]=-2;
+	pts[4]=xmax;pts[5]=ymax;ne[2]=-4;
+	pts[6]=xmin;pts[7]=ymax;ne[3]=-1;
+}
+
+/** Cuts the cell by a line. The vertices on the far side of the line are
+ * removed, and up to two new vertices are created where the line crosses the
+ * edges of the polygon. Vertices within the tolerance of the line are kept,
+ * and no new vertex is created next to them.
+ * \param[in] (x,y) the normal vector to the line.
+ * \param[in] rsq the distance along this vector of the line.
+ * \param[in] p_id the ID of the new edge.
+ * \return False if the cell was completely removed, true otherwise. */
+bool voronoicell_2d::nplane(double x,double y,double rsq,int p_id) {
+	int i,j,np=0;
+	bool out=false,in=false;
+	double *pp=pts,fr;
+
+	// Compute the position of each vertex relative to the line, and
+	// return straight away if no vertex is cut off
+	for(i=0;i<p;i++,pp+=2) {
+		u[i]=x*(*pp)+y*pp[1]-rsq;
+		if(u[i]>tol) out=true;
+		else if(u[i]<-tol) in=true;
+	}
+	if(!out) return true;
+	if(!in) {p=0;return false;}
+	if(p+2>current_vertices) add_memory();
+
+	// Copy the vertices that survive into the second buffer, adding the
+	// intersections with the line. Each vertex carries the ID of the edge
+	// that leaves it.
+	for(i=0;i<p;i++) {
+		j=i+1==p?0:i+1;
+		if(u[i]<=tol) {
+			pts2[2*np]=pts[2*i];pts2[2*np+1]=pts[2*i+1];
+			if(u[j]>tol) {
+				if(u[i]<-tol) {
+					ne2[np++]=ne[i];
+					fr=u[i]/(u[i]-u[j]);
+					pts2[2*np]=pts[2*i]+fr*(pts[2*j]-pts[2*i]);
+					pts2[2*np+1]=pts[2*i+1]+fr*(pts[2*j+1]-pts[2*i+1]);
+				}
+				ne2[np++]=p_id;
+			} else ne2[np++]=ne[i];
+		} else if(u[j]<-tol) {
+			fr=u[i]/(u[i]-u[j]);
+			pts2[2*np]=pts[2*i]+fr*(pts[2*j]-pts[2*i]);
+			pts2[2*np+1]=pts[2*i+1]+fr*(pts[2*j+1]-pts[2*i+1]);
+			ne2[np++]=ne[i];
+		}
+	}
+
+	// Swap the buffers. A polygon with fewer than three vertices has no
+	// area, so the cell is treated as having been removed.
+	pp=pts;pts=pts2;pts2=pp;
+	int *np2=ne;ne=ne2;ne2=np2;
+	p=np;
+	if(p<3) {p=0;return false;}
+	return true;
+}
+
+/** Tests whether a line cuts the cell.
+ * \param[in] (x,y) the normal vector to the line.
+ * \param[in] rsq the distance along this vector of the line.
+ * \return True if the line cuts the cell, false otherwise. */
+bool voronoicell_2d::plane_intersects(double x,double y,double rsq) {
+	double *pp=pts,*pe=pts+(p<<1);
+	for(;pp<pe;pp+=2) if(x*(*pp)+y*pp[1]-rsq>tol) return true;
+	return false;
+}
+
+/** Computes the maximum radius squared of a vertex from the center of the
+ * cell. Since the vertices are stored at twice their true positions, this is
+ * four times the true value, and it can be compared directly with the
+ * distance squared to another particle.
+ * \return The maximum radius squared of a vertex. */
+double voronoicell_2d::max_radius_squared() {
+	double r=0,s,*pp=pts,*pe=pts+(p<<1);
+	for(;pp<pe;pp+=2) {
+		s=*pp*(*pp)+pp[1]*pp[1];
+		if(s>r) r=s;
+	}
+	return r;
+}
+
+/** Calculates the area of the cell.
+ * \return The area. */
+double voronoicell_2d::area() {
+	double a=0;
+	for(int i=0,j=p-1;i<p;j=i++) a+=pts[2*j]*pts[2*i+1]-pts[2*j+1]*pts[2*i];
+	return 0.125*a;
+}
+
+/** Calculates the perimeter of the cell.
+ * \return The perimeter. */
+double voronoicell_2d::perimeter() {
+	double l=0,dx,dy;
+	for(int i=0,j=p-1;i<p;j=i++) {
+		dx=pts[2*i]-pts[2*j];dy=pts[2*i+1]-pts[2*j+1];
+		l+=sqrt(dx*dx+dy*dy);
+	}
+	return 0.5*l;
+}
+
+/** Calculates the centroid of the cell, relative to the particle.
+ * \param[out] (cx,cy) the coordinates of the centroid. */
+void voronoicell_2d::centroid(double &cx,double &cy) {
+	double a=0,c;
+	cx=cy=0;
+	for(int i=0,j=p-1;i<p;j=i++) {
+		c=pts[2*j]*pts[2*i+1]-pts[2*j+1]*pts[2*i];
+		a+=c;
+		cx+=c*(pts[2*j]+pts[2*i]);
+		cy+=c*(pts[2*j+1]+pts[2*i+1]);
+	}
+	if(a>0) {
+		a=1/(6*a);
+		cx*=a;cy*=a;
+	} else cx=cy=0;
+}
+
+/** Returns a vector of the vertex positions, relative to the particle.
+ * \param[out] v the vector to store the results in. */
+void voronoicell_2d::vertices(std::vector<double> &v) {
+	v.resize(p<<1);
+	for(int i=0;i<(p<<1);i++) v[i]=0.5*pts[i];
+}
+
+/** Returns a vector of the vertex positions, displaced by a given vector.
+ * \param[in] (x,y) the displacement vector.
+ * \param[out] v the vector to store the results in. */
+void voronoicell_2d::vertices(double x,double y,std::vector<double> &v) {
+	v.resize(p<<1);
+	for(int i=0;i<(p<<1);i+=2) {
+		v[i]=x+0.5*pts[i];
+		v[i+1]=y+0.5*pts[i+1];
+	}
+}
+
+/** Returns a vector of the lengths of the edges, in the same order as the
+ * neighbors.
+ * \param[out] v the vector to store the results in. */
+void voronoicell_2d::edge_lengths(std::vector<double> &v) {
+	double dx,dy;
+	v.resize(p);
+	for(int i=0;i<p;i++) {
+		int j=i+1==p?0:i+1;
+		dx=pts[2*j]-pts[2*i];dy=pts[2*j+1]-pts[2*i+1];
+		v[i]=0.5*sqrt(dx*dx+dy*dy);
+	}
+}
+
+/** Returns a vector of the outward unit normals of the edges, as pairs of
+ * numbers.
+ * \param[out] v the vector to store the results in. */
+void voronoicell_2d::normals(std::vector<double> &v) {
+	double dx,dy,l;
+	v.resize(p<<1);
+	for(int i=0;i<p;i++) {
+		int j=i+1==p?0:i+1;
+		dx=pts[2*j]-pts[2*i];dy=pts[2*j+1]-pts[2*i+1];
+		l=sqrt(dx*dx+dy*dy);
+		if(l>0) l=1/l;
+		v[2*i]=dy*l;v[2*i+1]=-dx*l;
+	}
+}
+
+/** Returns a vector of the IDs of the particles or walls that created each
+ * edge.
+ * \param[out] v the vector to store the results in. */
+void voronoicell_2d::neighbors(std::vector<int> &v) {
+	v.resize(p);
+	for(int i=0;i<p;i++) v[i]=ne[i];
+}
+
+/** Outputs the vertex positions, relative to the particle.
+ * \param[in] fp the file handle to write to. */
+void voronoicell_2d::output_vertices(FILE *fp) {
+	if(p>0) {
+		fprintf(fp,"(%g,%g)",0.5*(*pts),0.5*pts[1]);
+		for(int i=2;i<(p<<1);i+=2) fprintf(fp," (%g,%g)",0.5*pts[i],0.5*pts[i+1]);
+	}
+}
+
+/** Outputs the vertex positions, displaced by a given vector.
+ * \param[in] (x,y) the displacement vector.
+ * \param[in] fp the file handle to write to. */
+void voronoicell_2d::output_vertices(double x,double y,FILE *fp) {
+	if(p>0) {
+		fprintf(fp,"(%g,%g)",x+0.5*(*pts),y+0.5*pts[1]);
+		for(int i=2;i<(p<<1);i+=2) fprintf(fp," (%g,%g)",x+0.5*pts[i],y+0.5*pts[i+1]);
+	}
+}
+
+/** Outputs the edges of the cell in gnuplot format, as a closed loop of
+ * vertices followed by a blank line.
+ * \param[in] (x,y) a displacement vector to be added to the cell's position.
+ * \param[in] fp the file handle to write to. */
+void voronoicell_2d::draw_gnuplot(double x,double y,FILE *fp) {
+	if(p==0) return;
+	for(int i=0;i<(p<<1);i+=2) fprintf(fp,"%g %g\n",x+0.5*pts[i],y+0.5*pts[i+1]);
+	fprintf(fp,"%g %g\n\n",x+0.5*(*pts),y+0.5*pts[1]);
+}
+
+/** Outputs a custom string of information about the cell. The following
+ * control sequences are used:
+ * - \%i The particle ID.
+ * - \%x, \%y The position of the particle.
+ * - \%q The position vector of the particle, short for "%x %y".
+ * - \%r The radius of the particle.
+ * - \%w The number of vertices.
+ * - \%p The vertex positions, relative to the particle.
+ * - \%P The vertex positions, relative to the origin.
+ * - \%m The maximum radius squared of a vertex from the particle.
+ * - \%g The number of edges.
+ * - \%E The perimeter.
+ * - \%e The lengths of the edges.
+ * - \%l The outward unit normals of the edges.
+ * - \%n The IDs of the neighboring particles, one per edge.
+ * - \%a The area.
+ * - \%c The centroid, relative to the particle.
+ * - \%C The centroid, relative to the origin.
+ * \param[in] format the custom format string to use.
+ * \param[in] i the ID of the particle associated with this cell.
+ * \param[in] (x,y) the position of the particle.
+ * \param[in] r the radius of the particle.
+ * \param[in] fp the file handle to write to. */
+void voronoicell_2d::output_custom(const char *format,int i,double x,double y,double r,FILE *fp) {
+	char *fmp=(const_cast<char*>(format));
+	std::vector<int> vi;
+	std::vector<double> vd;
+	while(*fmp!=0) {
+		if(*fmp=='%') {
+			fmp++;
+			switch(*fmp) {
+
+				// Particle-related output
+				case 'i': fprintf(fp,"%d",i);break;
+				case 'x': fprintf(fp,"%g",x);break;
+				case 'y': fprintf(fp,"%g",y);break;
+				case 'q': fprintf(fp,"%g %g",x,y);break;
+				case 'r': fprintf(fp,"%g",r);break;
+
+				// Vertex-related output
+				case 'w': fprintf(fp,"%d",p);break;
+				case 'p': output_vertices(fp);break;
+				case 'P': output_vertices(x,y,fp);break;
+				case 'm': fprintf(fp,"%g",0.25*max_radius_squared());break;
+
+				// Edge-related output
+				case 'g': fprintf(fp,"%d",number_of_edges());break;
+				case 'E': fprintf(fp,"%g",perimeter());break;
+				case 'e': edge_lengths(vd);voro_print_vector(vd,fp);break;
+				case 'l': normals(vd);
+					  if(p>0) {
+						  fprintf(fp,"(%g,%g)",vd[0],vd[1]);
+						  for(int k=2;k<(p<<1);k+=2) fprintf(fp," (%g,%g)",vd[k],vd[k+1]);
+					  }
+					  break;
+				case 'n': neighbors(vi);
+					  voro_print_vector(vi,fp);
+					  break;
+
+				// Area-related output
+				case 'a': fprintf(fp,"%g",area());break;
+				case 'c': {
+						  double cx,cy;
+						  centroid(cx,cy);
+						  fprintf(fp,"%g %g",cx,cy);
+					  } break;
+				case 'C': {
+						  double cx,cy;
+						  centroid(cx,cy);
+						  fprintf(fp,"%g %g",x+cx,y+cy);
+					  } break;
+
+				// End-of-string reached
+				case 0: fmp--;break;
+
+				// The percent sign is not part of a
+				// control sequence
+				default: putc('%',fp);putc(*fmp,fp);
+			}
+		} else putc(*fmp,fp);
+		fmp++;
+	}
+	fputs("\n",fp);
+}
+
+}
@@ -0,0 +1,128 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file cell_2d.hh
+ * \brief Header file for the voronoicell_2d class. */
+
+#ifndef VOROPP_CELL_2D_HH
+#define VOROPP_CELL_2D_HH
+
+#include <cstdio>
+#include <vector>
+
+#include "config.hh"
+#include "common.hh"
+
+namespace voro {
+
+/** \brief A class representing a single two-dimensional Voronoi cell.
+ *
+ * The cell is a convex polygon, which is stored as a list of its vertices in
+ * counter-clockwise order. Edge k of the cell joins vertex k to vertex k+1,
+ * wrapping around at the end of the list. Since each vertex has exactly two
+ * edges, no edge table is needed, and a plane cut is carried out by a single
+ * pass over the vertices, copying the part of the polygon that survives into a
+ * second buffer. The two buffers are then swapped, so that no memory is
+ * allocated once the cell has grown to its working size.
+ *
+ * As in the voronoicell_base class, the vertex positions are stored at twice
+ * their true values, relative to the particle, so that the plane routines take
+ * the same arguments as their three-dimensional counterparts. The ID of the
+ * particle or wall that created each edge is recorded, since this only costs a
+ * single copy per vertex during a cut. */
+class voronoicell_2d {
+	public:
+		/** The current number of vertices in the cell. */
+		int p;
+		/** The size of the vertex and edge arrays. */
+		int current_vertices;
+		/** The vertex positions, stored as pairs of numbers at twice
+		 * their true values, in counter-clockwise order. */
+		double *pts;
+		/** The ID of the particle or wall that created each edge. */
+		int *ne;
+		/** The tolerance used to decide whether a vertex lies on a
+		 * cutting line, scaled by the maximum length squared of the
+		 * cell. */
+		const double tol;
+		voronoicell_2d(double max_len_sq=default_length*default_length);
+		~voronoicell_2d();
+		void init(double xmin,double xmax,double ymin,double ymax);
+		bool nplane(double x,double y,double rsq,int p_id);
+		/** Cuts the cell by a line, with the ID of the new edge set
+		 * to zero.
+		 * \param[in] (x,y) the normal vector to the line.
+		 * \param[in] rsq the distance along this vector of the line.
+		 * \return False if the cell was completely removed, true
+		 *         otherwise. */
+		inline bool plane(double x,double y,double rsq) {
+			return nplane(x,y,rsq,0);
+		}
+		/** Cuts the cell by the perpendicular bisector of the particle
+		 * and a point at (x,y) relative to it.
+		 * \param[in] (x,y) the position of the other point.
+		 * \param[in] p_id the ID of the new edge.
+		 * \return False if the cell was completely removed, true
+		 *         otherwise. */
+		inline bool nplane(double x,double y,int p_id) {
+			return nplane(x,y,x*x+y*y,p_id);
+		}
+		/** Cuts the cell by the perpendicular bisector of the particle
+		 * and a point at (x,y) relative to it, with the ID of the new
+		 * edge set to zero.
+		 * \param[in] (x,y) the position of the other point.
+		 * \return False if the cell was completely removed, true
+		 *         otherwise. */
+		inline bool plane(double x,double y) {
+			return nplane(x,y,x*x+y*y,0);
+		}
+		bool plane_intersects(double x,double y,double rsq);
+		double max_radius_squared();
+		double area();
+		double perimeter();
+		void centroid(double &cx,double &cy);
+		/** Returns the number of edges of the cell, which is the same
+		 * as the number of vertices.
+		 * \return The number of edges. */
+		inline int number_of_edges() {return p;}
+		void vertices(std::vector<double> &v);
+		void vertices(double x,double y,std::vector<double> &v);
+		void edge_lengths(std::vector<double> &v);
+		void normals(std::vector<double> &v);
+		void neighbors(std::vector<int> &v);
+		void output_vertices(FILE *fp=stdout);
+		void output_vertices(double x,double y,FILE *fp=stdout);
+		void draw_gnuplot(double x,double y,FILE *fp=stdout);
+		/** Outputs the edges of the cell in gnuplot format to a file.
+		 * \param[in] (x,y) a displacement vector to be added to the
+		 *                  cell's position.
+		 * \param[in] filename the file to write to. */
+		inline void draw_gnuplot(double x,double y,const char *filename) {
+			FILE *fp=safe_fopen(filename,"w");
+			draw_gnuplot(x,y,fp);
+			fclose(fp);
+		}
+		/** Outputs a custom string of information about the cell, for
+		 * a cell that is not associated with a particle.
+		 * \param[in] format the custom string to print.
+		 * \param[in] fp the file handle to write to. */
+		inline void output_custom(const char *format,FILE *fp=stdout) {output_custom(format,0,0,0,default_radius,fp);}
+		void output_custom(const char *format,int i,double x,double y,double r,FILE *fp=stdout);
+	private:
+		/** The vertex positions of the second buffer, that the cut
+		 * polygon is assembled in. */
+		double *pts2;
+		/** The edge IDs of the second buffer. */
+		int *ne2;
+		/** The position of each vertex relative to the current cutting
+		 * line. */
+		double *u;
+		void add_memory();
+};
+
+}
+
+#endif
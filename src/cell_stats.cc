@@ -0,0 +1,164 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file cell_stats.cc
+ * \brief Function implementations for the cell_statistics and related
+ * classes. */
+
+#include <cmath>
+
+#include "cell_stats.hh"
+
+namespace voro {
+
+/** Combines another set of moments with this one.
+ * \param[in] s the moments to combine. */
+void stat_moments::merge(const stat_moments &s) {
+	if(s.n==0) return;
+	if(n==0) {*this=s;return;}
+	long nn=n+s.n;
+	double d=s.mean-mean;
+	mean+=d*s.n/nn;
+	m2+=s.m2+d*d*(double(n)*s.n/nn);
+	n=nn;sum+=s.sum;
+	if(s.min<min) min=s.min;
+	if(s.max>max) max=s.max;
+}
+
+/** Sets up the bins of a histogram, and removes any previous counts.
+ * \param[in] (lo_,hi_) the range of the histogram.
+ * \param[in] bins the number of bins. */
+void stat_histogram::setup(double lo_,double hi_,int bins) {
+	if(bins<=0||hi_<=lo_) voro_fatal_error("Invalid histogram range",VOROPP_INTERNAL_ERROR);
+	lo=lo_;hi=hi_;isp=bins/(hi-lo);
+	counts.assign(bins,0);
+	under=over=0;
+}
+
+/** Adds the counts of another histogram with the same bins to this one.
+ * \param[in] h the histogram to add. */
+void stat_histogram::merge(const stat_histogram &h) {
+	if(h.counts.size()!=counts.size()) voro_fatal_error("Merging histograms with different bins",VOROPP_INTERNAL_ERROR);
+	for(unsigned int i=0;i<counts.size();i++) counts[i]+=h.counts[i];
+	under+=h.under;over+=h.over;
+}
+
+/** Prints the histogram, with the center of each bin and its count on a line.
+ * \param[in] fp a file handle to write to. */
+void stat_histogram::print(FILE *fp) {
+	double w=(hi-lo)/counts.size();
+	for(unsigned int i=0;i<counts.size();i++) fprintf(fp,"%g %ld\n",lo+(i+0.5)*w,counts[i]);
+}
+
+/** Removes all of the accumulated statistics, keeping the choice of
+ * quantities and the bins of the histograms. */
+void cell_statistics::clear() {
+	cells=population=0;
+	volume=area=faces=vertices=edges=max_radius=mink_area=mink_volume=stat_moments();
+	if(volume_hist.active()) volume_hist.setup(volume_hist.lo,volume_hist.hi,volume_hist.counts.size());
+	if(area_hist.active()) area_hist.setup(area_hist.lo,area_hist.hi,area_hist.counts.size());
+	face_freq.clear();
+	face_count_freq.clear();
+}
+
+/** Adds a Voronoi cell to the statistics.
+ * \param[in] c a reference to the Voronoi cell. */
+void cell_statistics::add(voronoicell_base &c) {
+	unsigned int m=mask&(query_volume|query_surface_area|query_faces|query_vertices|query_edges|query_max_radius);
+	if(volume_hist.active()) m|=query_volume;
+	if(area_hist.active()) m|=query_surface_area;
+	if(face_counts) m|=query_faces;
+	cell_query qr(m);
+	c.evaluate(qr);
+	cells++;
+	if(mask&query_volume) volume.add(qr.volume);
+	if(mask&query_surface_area) area.add(qr.area);
+	if(mask&query_faces) faces.add(qr.faces);
+	if(mask&query_vertices) vertices.add(qr.vertices);
+	if(mask&query_edges) edges.add(qr.edges);
+	if(mask&query_max_radius) max_radius.add(qr.max_radius);
+	if(volume_hist.active()) volume_hist.add(qr.volume);
+	if(area_hist.active()) area_hist.add(qr.area);
+	if(face_counts) {
+		if(qr.faces>=int(face_count_freq.size())) face_count_freq.resize(qr.faces+1,0);
+		face_count_freq[qr.faces]++;
+	}
+	if(face_orders) {
+		c.face_freq_table(fv);
+		if(fv.size()>face_freq.size()) face_freq.resize(fv.size(),0);
+		for(unsigned int i=0;i<fv.size();i++) face_freq[i]+=fv[i];
+	}
+	if(mr>=0) {
+		double ar,vo;
+		c.minkowski(mr,ar,vo);
+		mink_area.add(ar);mink_volume.add(vo);
+	}
+}
+
+/** Adds the statistics accumulated by another instance of the class, which
+ * must have been set up in the same way, to this one.
+ * \param[in] s the statistics to add. */
+void cell_statistics::merge(const cell_statistics &s) {
+	unsigned int i;
+	cells+=s.cells;
+	volume.merge(s.volume);area.merge(s.area);faces.merge(s.faces);
+	vertices.merge(s.vertices);edges.merge(s.edges);max_radius.merge(s.max_radius);
+	mink_area.merge(s.mink_area);mink_volume.merge(s.mink_volume);
+	if(volume_hist.active()) volume_hist.merge(s.volume_hist);
+	if(area_hist.active()) area_hist.merge(s.area_hist);
+	if(s.face_freq.size()>face_freq.size()) face_freq.resize(s.face_freq.size(),0);
+	for(i=0;i<s.face_freq.size();i++) face_freq[i]+=s.face_freq[i];
+	if(s.face_count_freq.size()>face_count_freq.size()) face_count_freq.resize(s.face_count_freq.size(),0);
+	for(i=0;i<s.face_count_freq.size();i++) face_count_freq[i]+=s.face_count_freq[i];
+}
+
+/** Computes the half-width of the confidence interval of the mean of a
+ * quantity. If the statistics were sampled, this is the standard error of the
+ * sample mean with the finite population correction, which treats the
+ * sampled cells as independent. Otherwise every cell was computed and the
+ * mean is exact, so the routine returns zero.
+ * \param[in] s the moments of the quantity.
+ * \param[in] z the number of standard errors to span.
+ * \return The half-width. */
+double cell_statistics::confidence(const stat_moments &s,double z) const {
+	if(population<=0||s.n<2) return 0;
+	double f=1-double(s.n)/population;
+	return f>0?z*sqrt(s.variance()*f/s.n):0;
+}
+
+/** Prints a line for each set of moments that has been accumulated, giving
+ * the number of values, the sum, the mean, the standard deviation, the
+ * minimum, and the maximum. If the statistics were sampled, the population is
+ * printed first, the sum is replaced by the estimated total, and the
+ * half-width of the confidence interval of the mean is added at the end of
+ * each line. The frequency tables are then printed as lists of the non-zero
+ * entries.
+ * \param[in] fp a file handle to write to. */
+void cell_statistics::print(FILE *fp) {
+	const char *nm[8]={"volume","area","faces","vertices","edges","max_radius","mink_area","mink_volume"};
+	stat_moments *sm[8]={&volume,&area,&faces,&vertices,&edges,&max_radius,&mink_area,&mink_volume};
+	unsigned int i;
+	if(population>0) fprintf(fp,"population %ld\n",population);
+	fprintf(fp,"cells %ld\n",cells);
+	for(i=0;i<8;i++) if(sm[i]->n>0) {
+		fprintf(fp,"%s %ld %g %g %g %g %g",nm[i],sm[i]->n,total(*sm[i]),sm[i]->mean,
+			sqrt(sm[i]->variance()),sm[i]->min,sm[i]->max);
+		if(population>0) fprintf(fp," %g",confidence(*sm[i]));
+		fputc('\n',fp);
+	}
+	if(!face_freq.empty()) {
+		fputs("face_orders",fp);
+		for(i=0;i<face_freq.size();i++) if(face_freq[i]>0) fprintf(fp," %d:%ld",i,face_freq[i]);
+		fputc('\n',fp);
+	}
+	if(!face_count_freq.empty()) {
+		fputs("face_counts",fp);
+		for(i=0;i<face_count_freq.size();i++) if(face_count_freq[i]>0) fprintf(fp," %d:%ld",i,face_count_freq[i]);
+		fputc('\n',fp);
+	}
+}
+
+}
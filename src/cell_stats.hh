@@ -0,0 +1,349 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file cell_stats.hh
+ * \brief Header file for the cell_statistics and related classes. */
+
+#ifndef VOROPP_CELL_STATS_HH
+#define VOROPP_CELL_STATS_HH
+
+#include <cstdio>
+#include <cmath>
+#include <vector>
+
+#include "config.hh"
+#include "common.hh"
+#include "cell.hh"
+#include "c_loops.hh"
+
+namespace voro {
+
+/** \brief A class for accumulating the moments of a quantity.
+ *
+ * This class keeps the number of values, their sum, minimum, and maximum, and
+ * their mean and sum of squared deviations. The last two are updated using
+ * Welford's method, and two sets of moments are combined using the formula of
+ * Chan et al., so that values can be accumulated separately by several threads
+ * and then merged without loss of accuracy. */
+class stat_moments {
+	public:
+		/** The number of values. */
+		long n;
+		/** The sum of the values. */
+		double sum;
+		/** The mean of the values. */
+		double mean;
+		/** The sum of the squared deviations from the mean. */
+		double m2;
+		/** The smallest value. */
+		double min;
+		/** The largest value. */
+		double max;
+		stat_moments() : n(0), sum(0), mean(0), m2(0), min(0), max(0) {}
+		/** Adds a value.
+		 * \param[in] x the value to add. */
+		inline void add(double x) {
+			double d=x-mean;
+			if(n==0) min=max=x;
+			else if(x<min) min=x;
+			else if(x>max) max=x;
+			n++;sum+=x;
+			mean+=d/n;
+			m2+=d*(x-mean);
+		}
+		void merge(const stat_moments &s);
+		/** Returns the variance of the values.
+		 * \return The variance, or zero if there are fewer than two
+		 *	   values. */
+		inline double variance() const {return n>1?m2/(n-1):0;}
+};
+
+/** \brief A class for accumulating a histogram of a quantity.
+ *
+ * The range of the histogram is divided into bins of equal width. Values
+ * below and above the range are counted separately. */
+class stat_histogram {
+	public:
+		/** The lower end of the range. */
+		double lo;
+		/** The upper end of the range. */
+		double hi;
+		/** The number of values in each bin. */
+		std::vector<long> counts;
+		/** The number of values below the range. */
+		long under;
+		/** The number of values above the range. */
+		long over;
+		stat_histogram() : lo(0), hi(0), under(0), over(0), isp(0) {}
+		void setup(double lo_,double hi_,int bins);
+		/** Returns whether the histogram has been set up.
+		 * \return True if it has bins, false otherwise. */
+		inline bool active() const {return !counts.empty();}
+		/** Adds a value.
+		 * \param[in] x the value to add. */
+		inline void add(double x) {
+			if(x<lo) {under++;return;}
+			int b=int((x-lo)*isp);
+			if(b>=int(counts.size())) {
+				if(x>hi) {over++;return;}
+				b=counts.size()-1;
+			}
+			counts[b]++;
+		}
+		void merge(const stat_histogram &h);
+		void print(FILE *fp=stdout);
+	private:
+		/** The inverse of the bin width. */
+		double isp;
+};
+
+/** \brief A class for computing statistics of the Voronoi cells in a container.
+ *
+ * This class computes the Voronoi cells of the particles in a container, and
+ * accumulates the moments of their volumes, surface areas, numbers of faces,
+ * vertices, and edges, and the maximum distances from the particles to their
+ * vertices, along with histograms of the volumes and surface areas, the face
+ * order frequency table summed over the cells, and the frequency table of the
+ * number of faces of each cell, which is the number of neighbors when no walls
+ * are present. The Minkowski functionals of each cell for a given radius can
+ * also be accumulated. Only the quantities selected by the mask are computed,
+ * and all of the ones that are found by the voronoicell_base::evaluate()
+ * routine are taken from a single traversal of the faces of each cell.
+ *
+ * When several threads are used, the blocks of the container are shared out
+ * with a block_scheduler, and each thread accumulates its own statistics,
+ * which are merged at the end. No per-cell output is produced.
+ *
+ * For a quick estimate on a very large container, the sample() routine
+ * computes the cells of a random subset of the particles, and the moments then
+ * estimate those of the whole container, with confidence intervals given by
+ * confidence(). */
+class cell_statistics {
+	public:
+		/** The combination of cell_query_flags giving the quantities
+		 * to compute the moments of. Of these, query_volume,
+		 * query_surface_area, query_faces, query_vertices,
+		 * query_edges, and query_max_radius are used. */
+		unsigned int mask;
+		/** The number of cells that were computed. */
+		long cells;
+		/** The moments of the cell volumes. */
+		stat_moments volume;
+		/** The moments of the cell surface areas. */
+		stat_moments area;
+		/** The moments of the numbers of faces. */
+		stat_moments faces;
+		/** The moments of the numbers of vertices. */
+		stat_moments vertices;
+		/** The moments of the numbers of edges. */
+		stat_moments edges;
+		/** The moments of the maximum distances from the particles to
+		 * the vertices of their cells. */
+		stat_moments max_radius;
+		/** The moments of the area Minkowski functional. */
+		stat_moments mink_area;
+		/** The moments of the volume Minkowski functional. */
+		stat_moments mink_volume;
+		/** A histogram of the cell volumes. */
+		stat_histogram volume_hist;
+		/** A histogram of the cell surface areas. */
+		stat_histogram area_hist;
+		/** The total number of faces with each number of edges, if
+		 * face_orders has been set. */
+		std::vector<long> face_freq;
+		/** The number of cells with each number of faces, if
+		 * face_counts has been set. */
+		std::vector<long> face_count_freq;
+		/** The number of particles that the statistics were sampled
+		 * from, or zero if they were not sampled. */
+		long population;
+		/** Whether to accumulate the face order frequency table. */
+		bool face_orders;
+		/** Whether to accumulate the frequency table of the number of
+		 * faces of each cell. */
+		bool face_counts;
+		/** Sets up the class to compute the moments of the given
+		 * quantities. Histograms, frequency tables, and Minkowski
+		 * functionals can be switched on separately.
+		 * \param[in] mask_ a combination of cell_query_flags. */
+		cell_statistics(unsigned int mask_=query_volume|query_surface_area|query_faces)
+			: mask(mask_), cells(0), population(0), face_orders(false), face_counts(false), mr(-1) {}
+		/** Sets up a histogram of the cell volumes.
+		 * \param[in] (lo,hi) the range of the histogram.
+		 * \param[in] bins the number of bins. */
+		inline void volume_histogram(double lo,double hi,int bins) {volume_hist.setup(lo,hi,bins);}
+		/** Sets up a histogram of the cell surface areas.
+		 * \param[in] (lo,hi) the range of the histogram.
+		 * \param[in] bins the number of bins. */
+		inline void area_histogram(double lo,double hi,int bins) {area_hist.setup(lo,hi,bins);}
+		/** Switches on the accumulation of the Minkowski functionals
+		 * of the cells.
+		 * \param[in] r the radius to evaluate them at. */
+		inline void minkowski(double r) {mr=r;}
+		void clear();
+		void add(voronoicell_base &c);
+		void merge(const cell_statistics &s);
+		void print(FILE *fp=stdout);
+		double confidence(const stat_moments &s,double z=stat_confidence_z) const;
+		/** Estimates the sum of a quantity over all of the particles
+		 * that the statistics represent, which is the accumulated sum
+		 * unless the statistics were sampled. Its confidence interval
+		 * is that of the mean multiplied by the population.
+		 * \param[in] s the moments of the quantity.
+		 * \return The estimated sum. */
+		inline double total(const stat_moments &s) const {
+			return population>0?s.mean*population:s.sum;
+		}
+		/** Computes the Voronoi cells of the particles in a loop, and
+		 * adds them to the statistics.
+		 * \param[in] vl the loop class to use.
+		 * \param[in] con the container that the loop refers to. */
+		template<class c_loop,class c_class>
+		void add(c_loop &vl,c_class &con) {
+			voronoicell c(con);
+			if(vl.start()) do if(con.compute_cell(c,vl)) add(c);
+			while(vl.inc());
+		}
+		/** Computes the Voronoi cells of all of the particles in a
+		 * container, and adds them to the statistics.
+		 * \param[in] con the container to use, which can be any of
+		 *		  the standard or periodic container classes.
+		 * \param[in] nt the number of threads to use. */
+		template<class c_class>
+		void compute(c_class &con,int nt=1) {
+			nt=voro_threads(nt);
+			block_scheduler bs(con,nt);
+#ifdef _OPENMP
+			if(nt>1) {
+#pragma omp parallel num_threads(nt) VOROPP_BIND
+				{
+					cell_statistics cs(*this);
+					cs.clear();
+#pragma omp barrier
+					cs.compute_thread(con,bs,omp_get_thread_num(),con.new_compute());
+#pragma omp critical
+					{
+						merge(cs);
+					}
+				}
+				return;
+			}
+#endif
+			compute_thread(con,bs,0,con.new_compute());
+		}
+		/** Computes the Voronoi cells of a stratified random sample of
+		 * the particles in a container, and adds them to the
+		 * statistics, replacing any that were accumulated before. The
+		 * non-empty blocks are split into strata of consecutive
+		 * blocks, which are close together in space, and a single
+		 * block is picked at random from each. A random subset of the
+		 * particles in each picked block is then computed. The two
+		 * stages each keep roughly the square root of the requested
+		 * fraction, so that the cells are spread over many blocks
+		 * while only a small part of the container is scanned. The
+		 * choices are made by hashing the block positions and particle
+		 * indices with the seed, so the sample does not depend on the
+		 * number of threads.
+		 * \param[in] con the container to use, which can be any of
+		 *		  the standard or periodic container classes.
+		 * \param[in] fraction the fraction of the particles to
+		 *		       compute.
+		 * \param[in] nt the number of threads to use.
+		 * \param[in] seed the seed for the random choices. */
+		template<class c_class>
+		void sample(c_class &con,double fraction,int nt=1,unsigned int seed=1) {
+			nt=voro_threads(nt);
+			block_scheduler bs(con,nt);
+			long pop=0;
+			for(int l=0;l<bs.nb;l++) pop+=con.co[bs.bl[l]];
+			double fb=sqrt(fraction),fp;
+			int w=fb>0?int(1/fb+0.5):bs.nb+1;
+			if(w<1) w=1;
+			fp=fraction*w;
+			unsigned int thr=fp>=1?0xffffffffU:(unsigned int)(fp*4294967296.0);
+			clear();
+#ifdef _OPENMP
+			if(nt>1) {
+#pragma omp parallel num_threads(nt) VOROPP_BIND
+				{
+					cell_statistics cs(*this);
+#pragma omp barrier
+					cs.sample_thread(con,bs,omp_get_thread_num(),w,thr,seed,con.new_compute());
+#pragma omp critical
+					{
+						merge(cs);
+					}
+				}
+				population=pop;
+				return;
+			}
+#endif
+			sample_thread(con,bs,0,w,thr,seed,con.new_compute());
+			population=pop;
+		}
+	private:
+		/** The radius to evaluate the Minkowski functionals at, or a
+		 * negative value if they are not needed. */
+		double mr;
+		/** Temporary storage for the face order frequency table of a
+		 * cell. */
+		std::vector<int> fv;
+		/** Computes the Voronoi cells in the chunks of blocks that a
+		 * block scheduler hands out to one thread, and adds them to
+		 * the statistics.
+		 * \param[in] con the container to use.
+		 * \param[in] bs the block scheduler to use.
+		 * \param[in] t the thread number.
+		 * \param[in] vcl a pointer to a voro_compute class for the
+		 *		  container, which is deleted at the end. */
+		template<class c_class,class vc_class>
+		void compute_thread(c_class &con,block_scheduler &bs,int t,vc_class *vcl) {
+			voronoicell c(con);
+			c_loop_parallel vl(con,bs,t);
+			if(vl.start()) do if(con.compute_cell(c,vl,*vcl)) add(c);
+			while(vl.inc());
+			delete vcl;
+		}
+		/** Computes the Voronoi cells of the sampled particles in the
+		 * chunks of blocks that a block scheduler hands out to one
+		 * thread, and adds them to the statistics.
+		 * \param[in] con the container to use.
+		 * \param[in] bs the block scheduler to use.
+		 * \param[in] t the thread number.
+		 * \param[in] w the number of blocks in each stratum.
+		 * \param[in] thr the threshold that the hash of a particle
+		 *		  must not exceed for it to be sampled.
+		 * \param[in] seed the seed for the random choices.
+		 * \param[in] vcl a pointer to a voro_compute class for the
+		 *		  container, which is deleted at the end. */
+		template<class c_class,class vc_class>
+		void sample_thread(c_class &con,block_scheduler &bs,int t,int w,unsigned int thr,unsigned int seed,vc_class *vcl) {
+			voronoicell c(con);
+			int ch,b0,b1,l,s,sw,ijk,q;
+			unsigned int h;
+			while(bs.next_chunk(t,ch,b0,b1)) for(l=b0;l<b1;l++) {
+				s=l/w;sw=bs.nb-s*w;if(sw>w) sw=w;
+				if(l!=s*w+int(mix(seed^mix(s))%sw)) continue;
+				ijk=bs.bl[l];h=mix(seed+mix(ijk));
+				for(q=0;q<con.co[ijk];q++)
+					if(mix(h+q)<=thr&&con.compute_cell(c,ijk,q,*vcl)) add(c);
+			}
+			delete vcl;
+		}
+		/** Scrambles the bits of an integer, for making random choices
+		 * that can be repeated.
+		 * \param[in] x the integer.
+		 * \return The scrambled integer. */
+		static inline unsigned int mix(unsigned int x) {
+			x^=x>>16;x*=0x7feb352dU;
+			x^=x>>15;x*=0x846ca68bU;
+			return x^(x>>16);
+		}
+};
+
+}
+
+#endif
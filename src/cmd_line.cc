@@ -8,6 +8,13 @@
  * \brief Source code for the command-line utility. */
 
 #include <cstring>
+#include <ctime>
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #include "voro++.hh"
 using namespace voro;
@@ -29,12 +36,22 @@ void help_message() {
 	     "               <y_max> <z_min> <z_max> <filename>\n\n"
 	     "By default, the utility reads in the input file of particle IDs and positions,\n"
 	     "computes the Voronoi cell for each, and then creates <filename.vol> with an\n"
-	     "additional column containing the volume of each Voronoi cell.\n\n"
+	     "additional column containing the volume of each Voronoi cell. If <filename>\n"
+	     "is \"-\", then the particles are read from the standard input, the custom\n"
+	     "output is written to the standard output, and any other output files use the\n"
+	     "name \"stdin\".\n\n"
 	     "Available options:\n"
+	     " -a         : Choose the internal grid and the memory allocation per grid\n"
+	     "              block from a histogram of the particles\n"
+	     " -ac <n>    : Like -a, but also time the computation of n sample cells\n"
+	     "              on the fastest grids and choose between them\n"
+	     " -b <str>   : Save the statistics given by a string of column codes to the\n"
+	     "              binary column file <filename.col>\n"
 	     " -c <str>   : Specify a custom output string\n"
 	     " -g         : Turn on the gnuplot output to <filename.gnu>\n"
 	     " -h/--help  : Print this information\n"
 	     " -hc        : Print information about custom output\n"
+	     " -ib        : Read the input file as a binary particle file\n"
 	     " -l <len>   : Manually specify a length scale to configure the internal\n"
 	     "              computational grid\n"
 	     " -m <mem>   : Manually choose the memory allocation per grid block\n"
@@ -46,7 +63,22 @@ void help_message() {
 	     " -px        : Make container periodic in the x direction\n"
 	     " -py        : Make container periodic in the y direction\n"
 	     " -pz        : Make container periodic in the z direction\n"
+	     " --pipeline : Overlap reading the input, computing the cells, and writing\n"
+	     "              the output. The input must be sorted by z coordinate, the\n"
+	     "              grid must be set with -l or -n, and this cannot be used with\n"
+	     "              -b, -g, -ib, -o, -pz, -r, -s, or -y\n"
+	     " --precision <n> : Print floating point numbers with n significant digits,\n"
+	     "              from 1 to 17 (default 6)\n"
 	     " -r         : Assume the input file has an extra coordinate for radii\n"
+	     " -s <n>     : Stream the computation in slabs of n grid blocks in the z\n"
+	     "              direction, so that only one slab is held in memory at a time.\n"
+	     "              This requires the grid to be set with -l or -n, and cannot be\n"
+	     "              used with -b, -g, -o, -pz, -r, -y, or walls\n"
+	     " --stats    : Print timing and memory usage information\n"
+	     " -t <n>     : Use n threads for parsing the input and computing the cells.\n"
+	     "              The computation is only threaded when only the custom output\n"
+	     "              is requested without -o, and a value of zero uses the OpenMP\n"
+	     "              default\n"
 	     " -v         : Verbose output\n"
 	     " --version  : Print version information\n"
 	     " -wb [6]    : Add six plane wall objects to make rectangular box containing\n"
@@ -106,7 +138,11 @@ void custom_output_message() {
 	     "\nVolume-related:\n"
 	     "  %v The volume of the Voronoi cell\n"
 	     "  %c The centroid of the Voronoi cell, relative to the particle center\n"
-	     "  %C The centroid of the Voronoi cell, in the global coordinate system");
+	     "  %C The centroid of the Voronoi cell, in the global coordinate system\n"
+	     "\nThe \"-b\" option takes a string of the codes i, q, r, v, F, c, C, s, and n,\n"
+	     "without percentage signs, and saves each of these statistics as a column in a\n"
+	     "binary file. The neighbor lists given by n are saved in compressed sparse row\n"
+	     "form. The file format is described in src/column_writer.hh.");
 }
 
 // Ths message is displayed if the user requests version information
@@ -120,24 +156,122 @@ void error_message() {
 	fputs("voro++: Unrecognized command-line options; type \"voro++ -h\" for more\ninformation.\n",stderr);
 }
 
+// Returns the current wall clock time in seconds, for the statistics output
+double wall_time() {
+#ifdef _OPENMP
+	return omp_get_wtime();
+#else
+	return double(clock())/CLOCKS_PER_SEC;
+#endif
+}
+
+// Returns the peak memory usage of the process in megabytes, or a negative
+// value if it is not available
+double peak_memory() {
+#ifndef _WIN32
+	struct rusage ru;
+	if(getrusage(RUSAGE_SELF,&ru)==0) return ru.ru_maxrss/1024.;
+#endif
+	return -1;
+}
+
+// Imports particles into a container or pre_container, either as text from a
+// file or the standard input, or from a binary particle file
+template<class c_class>
+void cmd_line_import(c_class &con,const char *filename,bool binary,int nt) {
+	if(binary) con.import_binary(filename);
+	else if(strcmp(filename,"-")==0) con.import(stdin,nt);
+	else con.import(filename,nt);
+}
+
+// Imports particles into a container, also storing the order that they are
+// read
+template<class c_class>
+void cmd_line_import(particle_order &vo,c_class &con,const char *filename,bool binary,int nt) {
+	if(binary) con.import_binary(vo,filename);
+	else if(strcmp(filename,"-")==0) con.import(vo,stdin,nt);
+	else con.import(vo,filename,nt);
+}
+
+// Chooses the grid size for the particles in a pre_container, either using the
+// standard estimate, or using the auto-tuner if requested. If the memory
+// allocation per block has not been given on the command line, then the
+// auto-tuner also sets it.
+template<class p_class>
+void cmd_line_grid(p_class &pc,int tune,bool mem_set,int &nx,int &ny,int &nz,int &init_mem) {
+	int im;
+	if(tune<0) {pc.guess_optimal(nx,ny,nz);return;}
+	if(tune==0) pc.auto_tune(nx,ny,nz,im);
+	else pc.calibrate(nx,ny,nz,im,tune);
+	if(!mem_set) init_mem=im;
+}
+
+// Computes the memory in megabytes that is allocated for the particles in a
+// container
+template<class c_class>
+double container_memory(c_class &con) {
+	double m=con.nxyz*(2*sizeof(int)+sizeof(int*)+sizeof(fpoint*));
+	for(int l=0;l<con.nxyz;l++) m+=con.mem[l]*(sizeof(int)+con.ps*sizeof(fpoint));
+	return m/(1024.*1024.);
+}
+
+// An output routine for the streaming mode, which saves the custom output for
+// each cell and accumulates the statistics for the verbose output
+class cmd_line_slab_output {
+	public:
+		compiled_format &fm;
+		FILE *fp;
+		bool verbose;
+		double vol;
+		int vcc;
+		cmd_line_slab_output(compiled_format &fm_,FILE *fp_,bool verbose_)
+			: fm(fm_), fp(fp_), verbose(verbose_), vol(0), vcc(0) {}
+		template<class v_cell>
+		inline void operator()(v_cell &c,int i,double x,double y,double z) {
+			fm.write(c,i,x,y,z,default_radius,fp);
+			if(verbose) {vol+=c.volume();vcc++;}
+		}
+};
+
 // Carries out the Voronoi computation and outputs the results to the requested
-// files
+// files. If more than one thread is requested and only the custom output is
+// needed, then the container's multithreaded output routine is used.
 template<class c_loop,class c_class>
-void cmd_line_output(c_loop &vl,c_class &con,const char* format,FILE* outfile,FILE* gnu_file,FILE* povp_file,FILE* povv_file,bool verbose,double &vol,int &vcc,int &tp) {
-	int pid,ps=con.ps;double x,y,z,r;
-	if(con.contains_neighbor(format)) {
+void cmd_line_output(c_loop &vl,c_class &con,const char* format,FILE* outfile,column_writer* clw,FILE* col_file,FILE* gnu_file,FILE* povp_file,FILE* povv_file,bool verbose,double &vol,int &vcc,int &tp,int nt,double &t_import,double &cmem) {
+	voro_id pid;int ps=con.ps;double x,y,z,r;
+	t_import=wall_time();
+	cmem=container_memory(con);
+	if(nt!=1&&clw==NULL&&gnu_file==NULL&&povp_file==NULL&&povv_file==NULL) {
+		con.print_custom(format,outfile,nt);
+
+		// The statistics for the verbose output need a separate pass
+		// over the cells
+		if(verbose) {
+			voronoicell c;
+			if(vl.start()) do if(con.compute_cell(c,vl)) {vol+=c.volume();vcc++;} while(vl.inc());
+			tp=con.total_particles();
+		}
+		return;
+	}
+	compiled_format fm(format);
+	if(clw!=NULL) clw->write_header(col_file);
+	if(fm.neighbor()||(clw!=NULL&&clw->neighbor())) {
 		voronoicell_neighbor c;
 		if(vl.start()) do if(con.compute_cell(c,vl)) {
 			vl.pos(pid,x,y,z,r);
-			if(outfile!=NULL) c.output_custom(format,pid,x,y,z,r,outfile);
+			if(outfile!=NULL) fm.write(c,pid,x,y,z,r,outfile);
+			if(clw!=NULL) {
+				clw->add(c,pid,x,y,z,r);
+				if(clw->full()) clw->write_chunk(col_file);
+			}
 			if(gnu_file!=NULL) c.draw_gnuplot(x,y,z,gnu_file);
 			if(povp_file!=NULL) {
-				fprintf(povp_file,"// id %d\n",pid);
+				fprintf(povp_file,"// id %ld\n",long(pid));
 				if(ps==4) fprintf(povp_file,"sphere{<%g,%g,%g>,%g}\n",x,y,z,r);
 				else fprintf(povp_file,"sphere{<%g,%g,%g>,s}\n",x,y,z);
 			}
 			if(povv_file!=NULL) {
-				fprintf(povv_file,"// cell %d\n",pid);
+				fprintf(povv_file,"// cell %ld\n",long(pid));
 				c.draw_pov(x,y,z,povv_file);
 			}
 			if(verbose) {vol+=c.volume();vcc++;}
@@ -146,29 +280,36 @@ void cmd_line_output(c_loop &vl,c_class &con,const char* format,FILE* outfile,FI
 		voronoicell c;
 		if(vl.start()) do if(con.compute_cell(c,vl)) {
 			vl.pos(pid,x,y,z,r);
-			if(outfile!=NULL) c.output_custom(format,pid,x,y,z,r,outfile);
+			if(outfile!=NULL) fm.write(c,pid,x,y,z,r,outfile);
+			if(clw!=NULL) {
+				clw->add(c,pid,x,y,z,r);
+				if(clw->full()) clw->write_chunk(col_file);
+			}
 			if(gnu_file!=NULL) c.draw_gnuplot(x,y,z,gnu_file);
 			if(povp_file!=NULL) {
-				fprintf(povp_file,"// id %d\n",pid);
+				fprintf(povp_file,"// id %ld\n",long(pid));
 				if(ps==4) fprintf(povp_file,"sphere{<%g,%g,%g>,%g}\n",x,y,z,r);
 				else fprintf(povp_file,"sphere{<%g,%g,%g>,s}\n",x,y,z);
 			}
 			if(povv_file!=NULL) {
-				fprintf(povv_file,"// cell %d\n",pid);
+				fprintf(povv_file,"// cell %ld\n",long(pid));
 				c.draw_pov(x,y,z,povv_file);
 			}
 			if(verbose) {vol+=c.volume();vcc++;}
 		} while(vl.inc());
 	}
+	if(clw!=NULL) clw->write_chunk(col_file);
 	if(verbose) tp=con.total_particles();
 }
 
 int main(int argc,char **argv) {
-	int i=1,j=-7,custom_output=0,nx,ny,nz,init_mem(8);
+	int i=1,j=-7,custom_output=0,column_output=0,nx,ny,nz,init_mem(8),nt=1,slab_blocks=0,tune=-1;
 	double ls=0;
 	blocks_mode bm=none;
 	bool gnuplot_output=false,povp_output=false,povv_output=false,polydisperse=false;
 	bool xperiodic=false,yperiodic=false,zperiodic=false,ordered=false,verbose=false;
+	bool binary_input=false,stats=false,pipelined=false,mem_set=false;
+	double t_start=wall_time(),t_import,t_compute,cmem=0;
 	pre_container *pcon=NULL;pre_container_poly *pconp=NULL;
 	wall_list wl;
 
@@ -197,7 +338,26 @@ int main(int argc,char **argv) {
 	// We have enough arguments. Now start searching for command-line
 	// options.
 	while(i<argc-7) {
-		if(strcmp(argv[i],"-c")==0) {
+		if(strcmp(argv[i],"-a")==0) {
+			tune=0;
+		} else if(strcmp(argv[i],"-ac")==0) {
+			if(i>=argc-8) {error_message();wl.deallocate();return VOROPP_CMD_LINE_ERROR;}
+			i++;tune=atoi(argv[i]);
+			if(tune<=0) {
+				fputs("voro++: The number of calibration cells must be positive\n",stderr);
+				wl.deallocate();
+				return VOROPP_CMD_LINE_ERROR;
+			}
+		} else if(strcmp(argv[i],"-b")==0) {
+			if(i>=argc-8) {error_message();wl.deallocate();return VOROPP_CMD_LINE_ERROR;}
+			if(column_output==0) {
+				column_output=++i;
+			} else {
+				fputs("voro++: multiple binary column strings detected\n",stderr);
+				wl.deallocate();
+				return VOROPP_CMD_LINE_ERROR;
+			}
+		} else if(strcmp(argv[i],"-c")==0) {
 			if(i>=argc-8) {error_message();wl.deallocate();return VOROPP_CMD_LINE_ERROR;}
 			if(custom_output==0) {
 				custom_output=++i;
@@ -212,6 +372,8 @@ int main(int argc,char **argv) {
 			help_message();wl.deallocate();return 0;
 		} else if(strcmp(argv[i],"-hc")==0) {
 			custom_output_message();wl.deallocate();return 0;
+		} else if(strcmp(argv[i],"-ib")==0) {
+			binary_input=true;
 		} else if(strcmp(argv[i],"-l")==0) {
 			if(i>=argc-8) {error_message();wl.deallocate();return VOROPP_CMD_LINE_ERROR;}
 			if(bm!=none) {
@@ -222,7 +384,7 @@ int main(int argc,char **argv) {
 			bm=length_scale;
 			i++;ls=atof(argv[i]);
 		} else if(strcmp(argv[i],"-m")==0) {
-			i++;init_mem=atoi(argv[i]);
+			i++;init_mem=atoi(argv[i]);mem_set=true;
 		} else if(strcmp(argv[i],"-n")==0) {
 			if(i>=argc-10) {error_message();wl.deallocate();return VOROPP_CMD_LINE_ERROR;}
 			if(bm!=none) {
@@ -251,8 +413,31 @@ int main(int argc,char **argv) {
 			yperiodic=true;
 		} else if(strcmp(argv[i],"-pz")==0) {
 			zperiodic=true;
+		} else if(strcmp(argv[i],"--pipeline")==0) {
+			pipelined=true;
+		} else if(strcmp(argv[i],"--precision")==0) {
+			if(i>=argc-8) {error_message();wl.deallocate();return VOROPP_CMD_LINE_ERROR;}
+			i++;voro_set_precision(atoi(argv[i]));
 		} else if(strcmp(argv[i],"-r")==0) {
 			polydisperse=true;
+		} else if(strcmp(argv[i],"-s")==0) {
+			if(i>=argc-8) {error_message();wl.deallocate();return VOROPP_CMD_LINE_ERROR;}
+			i++;slab_blocks=atoi(argv[i]);
+			if(slab_blocks<=0) {
+				fputs("voro++: The number of blocks per slab must be positive\n",stderr);
+				wl.deallocate();
+				return VOROPP_CMD_LINE_ERROR;
+			}
+		} else if(strcmp(argv[i],"--stats")==0) {
+			stats=true;
+		} else if(strcmp(argv[i],"-t")==0) {
+			if(i>=argc-8) {error_message();wl.deallocate();return VOROPP_CMD_LINE_ERROR;}
+			i++;nt=atoi(argv[i]);
+			if(nt<0) {
+				fputs("voro++: The number of threads must not be negative\n",stderr);
+				wl.deallocate();
+				return VOROPP_CMD_LINE_ERROR;
+			}
 		} else if(strcmp(argv[i],"-v")==0) {
 			verbose=true;
 		} else if(strcmp(argv[i],"--version")==0) {
@@ -348,15 +533,55 @@ int main(int argc,char **argv) {
 		return VOROPP_CMD_LINE_ERROR;
 	}
 
+	// Check that the input options are compatible
+	const char *in_name=argv[i+6];
+	if(tune>=0&&bm!=none) {
+		fputs("voro++: Conflicting options about grid setup (-a/-l/-n)\n",stderr);
+		wl.deallocate();
+		return VOROPP_CMD_LINE_ERROR;
+	}
+	bool std_input=strcmp(in_name,"-")==0;
+	if(binary_input&&std_input) {
+		fputs("voro++: Binary input cannot be read from the standard input\n",stderr);
+		wl.deallocate();
+		return VOROPP_CMD_LINE_ERROR;
+	}
+	if(slab_blocks>0) {
+		if(bm==none) {
+			fputs("voro++: The streaming mode requires the grid to be set with -l or -n\n",stderr);
+			wl.deallocate();
+			return VOROPP_CMD_LINE_ERROR;
+		}
+		if(polydisperse||ordered||zperiodic||wl.wep!=wl.walls||gnuplot_output
+		   ||povp_output||povv_output||column_output!=0) {
+			fputs("voro++: The streaming mode cannot be used with -b, -g, -o, -pz, -r, -y, or walls\n",stderr);
+			wl.deallocate();
+			return VOROPP_CMD_LINE_ERROR;
+		}
+	}
+	if(pipelined) {
+		if(bm==none) {
+			fputs("voro++: The pipelined mode requires the grid to be set with -l or -n\n",stderr);
+			wl.deallocate();
+			return VOROPP_CMD_LINE_ERROR;
+		}
+		if(polydisperse||ordered||zperiodic||binary_input||slab_blocks>0||gnuplot_output
+		   ||povp_output||povv_output||column_output!=0) {
+			fputs("voro++: The pipelined mode cannot be used with -b, -g, -ib, -o, -pz, -r, -s, or -y\n",stderr);
+			wl.deallocate();
+			return VOROPP_CMD_LINE_ERROR;
+		}
+	}
+
 	if(bm==none) {
 		if(polydisperse) {
 			pconp=new pre_container_poly(ax,bx,ay,by,az,bz,xperiodic,yperiodic,zperiodic);
-			pconp->import(argv[i+6]);
-			pconp->guess_optimal(nx,ny,nz);
+			cmd_line_import(*pconp,in_name,binary_input,nt);
+			cmd_line_grid(*pconp,tune,mem_set,nx,ny,nz,init_mem);
 		} else {
 			pcon=new pre_container(ax,bx,ay,by,az,bz,xperiodic,yperiodic,zperiodic);
-			pcon->import(argv[i+6]);
-			pcon->guess_optimal(nx,ny,nz);
+			cmd_line_import(*pcon,in_name,binary_input,nt);
+			cmd_line_grid(*pcon,tune,mem_set,nx,ny,nz,init_mem);
 		}
 	} else {
 		double nxf,nyf,nzf;
@@ -397,28 +622,43 @@ int main(int argc,char **argv) {
 		}
 	}
 
-	// Check that the output filename is a sensible length
-	int flen=strlen(argv[i+6]);
+	// Check that the output filename is a sensible length. If the particles
+	// are read from the standard input, then the custom output is written
+	// to the standard output, and any other files use a fixed name.
+	const char *out_name=std_input?"stdin":in_name;
+	int flen=strlen(out_name);
 	if(flen>4096) {
 		fputs("voro++: Filename too long\n",stderr);
 		wl.deallocate();
 		return VOROPP_CMD_LINE_ERROR;
 	}
 
+	// Check the binary column string, which causes a fatal error if it
+	// contains an unknown code
+	column_writer *clw=column_output==0?NULL:new column_writer(argv[column_output]);
+
 	// Open files for output
 	char *buffer=new char[flen+7];
-	sprintf(buffer,"%s.vol",argv[i+6]);
-	FILE *outfile=safe_fopen(buffer,"w"),*gnu_file,*povp_file,*povv_file;
+	FILE *outfile,*col_file,*gnu_file,*povp_file,*povv_file;
+	if(std_input) outfile=stdout;
+	else {
+		sprintf(buffer,"%s.vol",out_name);
+		outfile=safe_fopen(buffer,"w");
+	}
+	if(clw!=NULL) {
+		sprintf(buffer,"%s.col",out_name);
+		col_file=safe_fopen(buffer,"wb");
+	} else col_file=NULL;
 	if(gnuplot_output) {
-		sprintf(buffer,"%s.gnu",argv[i+6]);
+		sprintf(buffer,"%s.gnu",out_name);
 		gnu_file=safe_fopen(buffer,"w");
 	} else gnu_file=NULL;
 	if(povp_output) {
-		sprintf(buffer,"%s_p.pov",argv[i+6]);
+		sprintf(buffer,"%s_p.pov",out_name);
 		povp_file=safe_fopen(buffer,"w");
 	} else povp_file=NULL;
 	if(povv_output) {
-		sprintf(buffer,"%s_v.pov",argv[i+6]);
+		sprintf(buffer,"%s_v.pov",out_name);
 		povv_file=safe_fopen(buffer,"w");
 	} else povv_file=NULL;
 	delete [] buffer;
@@ -428,27 +668,51 @@ int main(int argc,char **argv) {
 	// Now switch depending on whether polydispersity was enabled, and
 	// whether output ordering is requested
 	double vol=0;int tp=0,vcc=0;
-	if(polydisperse) {
+	if(slab_blocks>0) {
+		slab_stream ss(ax,bx,ay,by,az,bz,nx,ny,nz,xperiodic,yperiodic,slab_blocks,1,init_mem);
+		cmd_line_import(ss,in_name,binary_input,nt);
+		t_import=wall_time();
+		compiled_format fm(c_str);
+		cmd_line_slab_output so(fm,outfile,verbose);
+		if(fm.neighbor()) ss.compute<voronoicell_neighbor>(so);
+		else ss.compute<voronoicell>(so);
+		vol=so.vol;vcc=so.vcc;tp=ss.np;
+	} else if(pipelined) {
+		container con(ax,bx,ay,by,az,bz,nx,ny,nz,xperiodic,yperiodic,false,init_mem);
+		con.add_wall(wl);
+		pipeline pl(con);
+		FILE *in=std_input?stdin:safe_fopen(in_name,"r");
+		t_import=wall_time();
+		pl.print_custom(c_str,in,outfile);
+		if(!std_input) fclose(in);
+		cmem=container_memory(con);
+		if(verbose) {
+			voronoicell c(con);
+			c_loop_all vl(con);
+			if(vl.start()) do if(con.compute_cell(c,vl)) {vol+=c.volume();vcc++;} while(vl.inc());
+		}
+		tp=pl.np;
+	} else if(polydisperse) {
 		if(ordered) {
 			particle_order vo;
 			container_poly con(ax,bx,ay,by,az,bz,nx,ny,nz,xperiodic,yperiodic,zperiodic,init_mem);
 			con.add_wall(wl);
 			if(bm==none) {
 				pconp->setup(vo,con);delete pconp;
-			} else con.import(vo,argv[i+6]);
+			} else cmd_line_import(vo,con,in_name,binary_input,nt);
 
 			c_loop_order vlo(con,vo);
-			cmd_line_output(vlo,con,c_str,outfile,gnu_file,povp_file,povv_file,verbose,vol,vcc,tp);
+			cmd_line_output(vlo,con,c_str,outfile,clw,col_file,gnu_file,povp_file,povv_file,verbose,vol,vcc,tp,1,t_import,cmem);
 		} else {
 			container_poly con(ax,bx,ay,by,az,bz,nx,ny,nz,xperiodic,yperiodic,zperiodic,init_mem);
 			con.add_wall(wl);
 
 			if(bm==none) {
 				pconp->setup(con);delete pconp;
-			} else con.import(argv[i+6]);
+			} else cmd_line_import(con,in_name,binary_input,nt);
 
 			c_loop_all vla(con);
-			cmd_line_output(vla,con,c_str,outfile,gnu_file,povp_file,povv_file,verbose,vol,vcc,tp);
+			cmd_line_output(vla,con,c_str,outfile,clw,col_file,gnu_file,povp_file,povv_file,verbose,vol,vcc,tp,nt,t_import,cmem);
 		}
 	} else {
 		if(ordered) {
@@ -457,39 +721,63 @@ int main(int argc,char **argv) {
 			con.add_wall(wl);
 			if(bm==none) {
 				pcon->setup(vo,con);delete pcon;
-			} else con.import(vo,argv[i+6]);
+			} else cmd_line_import(vo,con,in_name,binary_input,nt);
 
 			c_loop_order vlo(con,vo);
-			cmd_line_output(vlo,con,c_str,outfile,gnu_file,povp_file,povv_file,verbose,vol,vcc,tp);
+			cmd_line_output(vlo,con,c_str,outfile,clw,col_file,gnu_file,povp_file,povv_file,verbose,vol,vcc,tp,1,t_import,cmem);
 		} else {
 			container con(ax,bx,ay,by,az,bz,nx,ny,nz,xperiodic,yperiodic,zperiodic,init_mem);
 			con.add_wall(wl);
 			if(bm==none) {
 				pcon->setup(con);delete pcon;
-			} else con.import(argv[i+6]);
+			} else cmd_line_import(con,in_name,binary_input,nt);
 			c_loop_all vla(con);
-			cmd_line_output(vla,con,c_str,outfile,gnu_file,povp_file,povv_file,verbose,vol,vcc,tp);
+			cmd_line_output(vla,con,c_str,outfile,clw,col_file,gnu_file,povp_file,povv_file,verbose,vol,vcc,tp,nt,t_import,cmem);
 		}
 	}
 
-	// Print information if verbose output requested
+	t_compute=wall_time();
+
+	// Print information if verbose output requested. If the custom output
+	// is being written to the standard output, then this is printed to the
+	// standard error instead.
+	FILE *info=outfile==stdout?stderr:stdout;
 	if(verbose) {
-		printf("Container geometry        : [%g:%g] [%g:%g] [%g:%g]\n"
+		fprintf(info,"Container geometry        : [%g:%g] [%g:%g] [%g:%g]\n"
 		       "Computational grid size   : %d by %d by %d (%s)\n"
 		       "Filename                  : %s\n"
 		       "Output string             : %s%s\n",ax,bx,ay,by,az,bz,nx,ny,nz,
-		       bm==none?"estimated from file":(bm==length_scale?
+		       bm==none?(tune<0?"estimated from file":(tune==0?"auto-tuned from file":
+		       "calibrated from file")):(bm==length_scale?
 		       "estimated using length scale":"directly specified"),
-		       argv[i+6],c_str,custom_output==0?" (default)":"");
-		printf("Total imported particles  : %d (%.2g per grid block)\n"
+		       in_name,c_str,custom_output==0?" (default)":"");
+		fprintf(info,"Total imported particles  : %d (%.2g per grid block)\n"
 		       "Total V. cells computed   : %d\n"
 		       "Total container volume    : %g\n"
 		       "Total V. cell volume      : %g\n",tp,((double) tp)/(nx*ny*nz),
 		       vcc,(bx-ax)*(by-ay)*(bz-az),vol);
 	}
 
+	// Print timing and memory information if requested
+	if(stats) {
+		fprintf(info,"Import and setup time     : %g s\n"
+			     "Computation and output    : %g s\n"
+			     "Total time                : %g s\n",t_import-t_start,
+			t_compute-t_import,t_compute-t_start);
+		if(slab_blocks==0) fprintf(info,"Particle storage          : %.3f MB\n",cmem);
+		double pm=peak_memory();
+		if(pm>=0) fprintf(info,"Peak memory usage         : %.3f MB\n",pm);
+	}
+
 	// Close output files
-	fclose(outfile);
+	if(outfile!=stdout) fclose(outfile);
+	if(col_file!=NULL) {
+		delete clw;
+		if(fclose(col_file)!=0) {
+			fputs("voro++: Error writing the binary column file\n",stderr);
+			return VOROPP_FILE_ERROR;
+		}
+	}
 	if(gnu_file!=NULL) fclose(gnu_file);
 	if(povp_file!=NULL) fclose(povp_file);
 	if(povv_file!=NULL) fclose(povv_file);
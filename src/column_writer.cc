@@ -0,0 +1,110 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file column_writer.cc
+ * \brief Function implementations for the column_writer class. */
+
+#include "column_writer.hh"
+#include "common.hh"
+
+namespace voro {
+
+/** The class constructor checks the column codes and sets up the columns.
+ * \param[in] columns a string of column codes. If the string contains any
+ *		      code that is not recognized, or more than one neighbor
+ *		      column, then a fatal error is caused.
+ * \param[in] chunk_rows_ the maximum number of cells in each chunk. */
+column_writer::column_writer(const char *columns,int chunk_rows_) : chunk_rows(chunk_rows_),
+	rows(0), nbc(false), qr(0), off(1,0) {
+	for(const char *cp=columns;*cp!=0;cp++) {
+		switch(*cp) {
+			case 'v': qr.mask|=query_volume;break;
+			case 'F': qr.mask|=query_surface_area;break;
+			case 'c': case 'C': qr.mask|=query_centroid;break;
+			case 's': qr.mask|=query_faces;break;
+			case 'n': if(nbc) voro_fatal_error("Multiple neighbor columns in binary column output string",VOROPP_CMD_LINE_ERROR);
+				  nbc=true;break;
+			case 'i': case 'q': case 'r': break;
+			default: voro_fatal_error("Unknown code in binary column output string",VOROPP_CMD_LINE_ERROR);
+		}
+		col.push_back(*cp);
+	}
+	ci.resize(col.size());
+	cd.resize(col.size());
+}
+
+/** Writes the header of a binary column file.
+ * \param[in] fp the file handle to write to. */
+void column_writer::write_header(FILE *fp) {
+	unsigned int h[2]={column_file_version,(unsigned int) col.size()};
+	fwrite("VORO++CF",1,8,fp);
+	fwrite(h,sizeof(unsigned int),2,fp);
+	write_padded(col.empty()?NULL:&col[0],col.size(),fp);
+}
+
+/** Writes the cells that have been added to the columns as a chunk, and then
+ * clears the columns. If no cells have been added, then nothing is written.
+ * \param[in] fp the file handle to write to. */
+void column_writer::write_chunk(FILE *fp) {
+	if(rows==0) return;
+	unsigned int h[2]={(unsigned int) rows,nbc?off.back():0};
+	fwrite(h,sizeof(unsigned int),2,fp);
+	for(unsigned int k=0;k<col.size();k++) {
+		if(col[k]=='n') {
+			write_padded(&off[0],off.size()*sizeof(unsigned int),fp);
+			off.resize(1);
+		}
+		if(!ci[k].empty()) write_padded(&ci[k][0],ci[k].size()*sizeof(voro_id),fp);
+		if(!cd[k].empty()) write_padded(&cd[k][0],cd[k].size()*sizeof(double),fp);
+		ci[k].clear();cd[k].clear();
+	}
+	rows=0;
+}
+
+/** Writes a block of data, followed by enough zeros to make its length a
+ * multiple of eight bytes.
+ * \param[in] p a pointer to the data.
+ * \param[in] l the length of the data in bytes.
+ * \param[in] fp the file handle to write to. */
+void column_writer::write_padded(const void *p,size_t l,FILE *fp) {
+	static const char z[8]={0,0,0,0,0,0,0,0};
+	if(l>0) fwrite(p,1,l,fp);
+	if(l&7) fwrite(z,1,8-(l&7),fp);
+}
+
+/** Adds the statistics of a Voronoi cell to the columns.
+ * \param[in] c a reference to the Voronoi cell.
+ * \param[in] i the ID of the particle associated with this Voronoi cell.
+ * \param[in] (x,y,z) the position of the particle associated with this Voronoi
+ *                    cell.
+ * \param[in] r a radius associated with the particle. */
+template<class v_cell>
+void column_writer::add(v_cell &c,voro_id i,double x,double y,double z,double r) {
+	if(qr.mask!=0) c.evaluate(qr);
+	for(unsigned int k=0;k<col.size();k++) {
+		std::vector<double> &d=cd[k];
+		switch(col[k]) {
+			case 'i': ci[k].push_back(i);break;
+			case 'q': d.push_back(x);d.push_back(y);d.push_back(z);break;
+			case 'r': d.push_back(r);break;
+			case 'v': d.push_back(qr.volume);break;
+			case 'F': d.push_back(qr.area);break;
+			case 'c': d.push_back(qr.cx);d.push_back(qr.cy);d.push_back(qr.cz);break;
+			case 'C': d.push_back(x+qr.cx);d.push_back(y+qr.cy);d.push_back(z+qr.cz);break;
+			case 's': ci[k].push_back(qr.faces);break;
+			case 'n': c.neighbors(vn);
+				  ci[k].insert(ci[k].end(),vn.begin(),vn.end());
+				  off.push_back(ci[k].size());
+		}
+	}
+	rows++;
+}
+
+// Explicit instantiation
+template void column_writer::add(voronoicell&,voro_id,double,double,double,double);
+template void column_writer::add(voronoicell_neighbor&,voro_id,double,double,double,double);
+
+}
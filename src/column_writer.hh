@@ -0,0 +1,111 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file column_writer.hh
+ * \brief Header file for the column_writer class.
+ *
+ * A binary column file begins with a header, made up of:
+ *  - the eight characters "VORO++CF",
+ *  - a 32-bit unsigned integer version number, which is currently 1,
+ *  - a 32-bit unsigned integer giving the number of columns,
+ *  - one character per column giving the column codes, padded with zeros to
+ *    a multiple of eight bytes.
+ *
+ * The header is followed by any number of chunks. Each chunk begins with a
+ * 32-bit unsigned integer giving the number of cells in the chunk, and a
+ * 32-bit unsigned integer giving the total number of neighbor entries in the
+ * chunk, which is zero if there is no neighbor column. The columns then follow
+ * in the order of the codes, each padded with zeros to a multiple of eight
+ * bytes. The column codes match those of the custom output strings:
+ *  - 'i' : the particle IDs, as 32-bit integers,
+ *  - 'q' : the particle positions, as three doubles per cell,
+ *  - 'r' : the particle radii, as doubles,
+ *  - 'v' : the cell volumes, as doubles,
+ *  - 'F' : the cell surface areas, as doubles,
+ *  - 'c' : the cell centroids relative to the particles, as three doubles
+ *          per cell,
+ *  - 'C' : the cell centroids in the global coordinate system, as three
+ *          doubles per cell,
+ *  - 's' : the number of faces, and hence of neighbors, of each cell, as
+ *          32-bit integers,
+ *  - 'n' : the neighbor lists in compressed sparse row form, made up of one
+ *          more 32-bit unsigned offset than there are cells, followed by the
+ *          neighbor IDs of all of the cells as 32-bit integers. The neighbors
+ *          of the kth cell of the chunk are at the entries from the kth offset
+ *          up to, but not including, the (k+1)th offset.
+ *
+ * All fields are in the native byte order of the machine. If the library is
+ * compiled with VOROPP_LARGE_IDS, then the integers in the 'i', 's', and 'n'
+ * columns, apart from the offsets, have the size of the voro_id type instead
+ * of 32 bits. */
+
+#ifndef VOROPP_COLUMN_WRITER_HH
+#define VOROPP_COLUMN_WRITER_HH
+
+#include <cstdio>
+#include <vector>
+
+#include "config.hh"
+#include "cell.hh"
+
+namespace voro {
+
+/** The version number of the binary column file format. */
+const unsigned int column_file_version=1;
+/** The default number of cells that are stored in each chunk of a binary
+ * column file. */
+const int column_chunk_rows=65536;
+
+/** \brief A class for writing statistics about Voronoi cells to a binary
+ * column file.
+ *
+ * The statistics of each cell are added to in-memory columns, one for each
+ * quantity. When enough cells have been added, the columns are written out
+ * together as one chunk, so that the quantities can be read back directly
+ * into typed arrays. The header and the chunks are written separately, so
+ * that several instances of this class can write chunks into the memory
+ * buffers of a chunk_writer for multithreaded output. */
+class column_writer {
+	public:
+		/** The maximum number of cells in each chunk. */
+		const int chunk_rows;
+		column_writer(const char *columns,int chunk_rows_=column_chunk_rows);
+		/** Returns whether the columns need neighbor information, and
+		 * therefore need a voronoicell_neighbor class.
+		 * \return True if neighbor information is needed, false
+		 *         otherwise. */
+		inline bool neighbor() {return nbc;}
+		/** Returns whether the current chunk holds the maximum number
+		 * of cells, and should be written out.
+		 * \return True if the chunk is full, false otherwise. */
+		inline bool full() {return rows>=chunk_rows;}
+		void write_header(FILE *fp);
+		void write_chunk(FILE *fp);
+		template<class v_cell>
+		void add(v_cell &c,voro_id i,double x,double y,double z,double r);
+	private:
+		/** The column codes. */
+		std::vector<char> col;
+		/** The number of cells in the current chunk. */
+		int rows;
+		/** Whether there is a neighbor column. */
+		bool nbc;
+		/** The query used to compute the cell statistics. */
+		cell_query qr;
+		/** The integer data of each column. */
+		std::vector<std::vector<voro_id> > ci;
+		/** The floating point data of each column. */
+		std::vector<std::vector<double> > cd;
+		/** The offsets of the neighbor lists of the current chunk. */
+		std::vector<unsigned int> off;
+		/** Temporary storage for the neighbors of a cell. */
+		std::vector<voro_id> vn;
+		void write_padded(const void *p,size_t l,FILE *fp);
+};
+
+}
+
+#endif
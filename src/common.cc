@@ -7,18 +7,141 @@
 /** \file common.cc
  * \brief Implementations of the small helper functions. */
 
+#include <cmath>
+#include <cstring>
+#include <ctime>
+
 #include "common.hh"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace voro {
 
-void check_duplicate(int n,double x,double y,double z,int id,double *qp) {
+void check_duplicate(voro_id n,double x,double y,double z,voro_id id,fpoint *qp) {
 	double dx=*qp-x,dy=qp[1]-y,dz=qp[2]-z;
 	if(dx*dx+dy*dy+dz*dz<1e-10) {
-		printf("Duplicate: %d (%g,%g,%g) matches %d (%g,%g,%g)\n",n,x,y,z,id,*qp,qp[1],qp[2]);
+		printf("Duplicate: %ld (%g,%g,%g) matches %ld (%g,%g,%g)\n",long(n),x,y,z,long(id),*qp,qp[1],qp[2]);
 		exit(1);
 	}
 }
 
+/** The number of significant digits used for floating point numbers by the
+ * text_writer class. */
+int voro_precision=default_precision;
+
+/** Sets the number of significant digits used for floating point numbers in
+ * the text output. This should not be called while any output is being
+ * written.
+ * \param[in] p the number of digits, which is clamped to the range from 1 to
+ *		17. Seventeen digits are always enough for a double to be read
+ *		back exactly. */
+void voro_set_precision(int p) {
+	voro_precision=p<1?1:(p>17?17:p);
+}
+
+/** The powers of ten that can be stored exactly as doubles. */
+static const double voro_p10[23]={1e0,1e1,1e2,1e3,1e4,1e5,1e6,1e7,1e8,1e9,1e10,
+	1e11,1e12,1e13,1e14,1e15,1e16,1e17,1e18,1e19,1e20,1e21,1e22};
+
+/** Writes a floating point number into a character array as text, giving the
+ * same result as the "%.*g" conversion of printf. The digits are found by
+ * scaling the number with a single multiplication or division by an exact
+ * power of ten, which is correctly rounded, so that the only case where the
+ * last digit can be in doubt is when the scaled number lies within a few
+ * units in the last place of a rounding boundary. This case, along with
+ * precisions above fifteen digits, very large or small magnitudes, and
+ * infinite or undefined values, is passed to snprintf().
+ * \param[in] v the number to write.
+ * \param[in] prec the number of significant digits.
+ * \param[in] s a character array with space for at least text_buffer_reserve
+ *		characters.
+ * \return The number of characters written, not including a terminating null
+ * character, which is not added. */
+int voro_format_double(double v,int prec,char *s) {
+	char d[16],*sp=s;
+	double a=fabs(v),sc,fl,fr;
+	int e,k,l,nd;
+	if(v==0) {
+		if(1/v<0) *(sp++)='-';
+		*(sp++)='0';
+		return int(sp-s);
+	}
+	if(prec>15||!(a<1e300&&a>1e-300)) return snprintf(s,text_buffer_reserve,"%.*g",prec,v);
+
+	// Estimate the decimal exponent from the binary one, and scale the
+	// number so that its integer part has prec digits, correcting the
+	// estimate if it is out by one
+	frexp(a,&e);
+	e=int(floor((e-1)*0.30102999566398120));
+	while(true) {
+		k=prec-1-e;
+		if(k>22||k<-22) return snprintf(s,text_buffer_reserve,"%.*g",prec,v);
+		sc=k>=0?a*voro_p10[k]:a/voro_p10[-k];
+		if(sc>=voro_p10[prec]) e++;
+		else if(sc<voro_p10[prec-1]) e--;
+		else break;
+	}
+	fl=floor(sc);fr=sc-fl;
+	if(fabs(fr-0.5)<=sc*5e-16) return snprintf(s,text_buffer_reserve,"%.*g",prec,v);
+	if(fr>0.5) {
+		fl+=1;
+		if(fl>=voro_p10[prec]) {fl=voro_p10[prec-1];e++;}
+	}
+
+	// Extract the digits, and count them without the trailing zeros
+	*d='0';
+	for(l=prec-1;l>=0;l--) {
+		sc=floor(fl*0.1);
+		d[l]='0'+int(fl-10*sc);
+		fl=sc;
+	}
+	for(nd=prec;nd>1&&d[nd-1]=='0';nd--);
+
+	// Assemble the text in fixed or exponential notation, using the same
+	// rule as printf
+	if(v<0) *(sp++)='-';
+	if(e<-4||e>=prec) {
+		*(sp++)=*d;
+		if(nd>1) {
+			*(sp++)='.';
+			for(l=1;l<nd;l++) *(sp++)=d[l];
+		}
+		*(sp++)='e';
+		if(e<0) {*(sp++)='-';e=-e;} else *(sp++)='+';
+		if(e>=100) {*(sp++)='0'+e/100;e%=100;}
+		*(sp++)='0'+e/10;
+		*(sp++)='0'+e%10;
+	} else if(e>=0) {
+		for(l=0;l<=e;l++) *(sp++)=d[l];
+		if(nd>e+1) {
+			*(sp++)='.';
+			for(;l<nd;l++) *(sp++)=d[l];
+		}
+	} else {
+		*(sp++)='0';*(sp++)='.';
+		for(l=-1;l>e;l--) *(sp++)='0';
+		for(l=0;l<nd;l++) *(sp++)=d[l];
+	}
+	return int(sp-s);
+}
+
+/** Writes an integer into a character array as text.
+ * \param[in] v the integer to write.
+ * \param[in] s a character array with space for at least twenty-one
+ *		characters.
+ * \return The number of characters written, not including a terminating null
+ * character, which is not added. */
+int voro_format_long(long v,char *s) {
+	char d[24],*dp=d,*sp=s;
+	unsigned long u=v<0?0UL-(unsigned long) v:(unsigned long) v;
+	do {*(dp++)='0'+int(u%10);u/=10;} while(u>0);
+	if(v<0) *(sp++)='-';
+	while(dp>d) *(sp++)=*(--dp);
+	return int(sp-s);
+}
+
 /** \brief Function for printing fatal error messages and exiting.
  *
  * Function for printing fatal error messages and exiting.
@@ -29,18 +152,26 @@ void voro_fatal_error(const char *p,int status) {
 	exit(status);
 }
 
+/** \brief Prints a vector of positions.
+ *
+ * Prints a vector of positions as bracketed triplets.
+ * \param[in] v the vector to print.
+ * \param[in] tw the text writer to print to. */
+void voro_print_positions(std::vector<double> &v,text_writer &tw) {
+	for(int k=0;(unsigned int) k<v.size();k+=3) {
+		if(k>0) tw.put(' ');
+		tw.put('(');tw.put3(v[k],v[k+1],v[k+2],',');tw.put(')');
+	}
+}
+
 /** \brief Prints a vector of positions.
  *
  * Prints a vector of positions as bracketed triplets.
  * \param[in] v the vector to print.
  * \param[in] fp the file stream to print to. */
 void voro_print_positions(std::vector<double> &v,FILE *fp) {
-	if(v.size()>0) {
-		fprintf(fp,"(%g,%g,%g)",v[0],v[1],v[2]);
-		for(int k=3;(unsigned int) k<v.size();k+=3) {
-			fprintf(fp," (%g,%g,%g)",v[k],v[k+1],v[k+2]);
-		}
-	}
+	text_writer tw(fp);
+	voro_print_positions(v,tw);
 }
 
 /** \brief Opens a file and checks the operation was successful.
@@ -61,42 +192,72 @@ FILE* safe_fopen(const char *filename,const char *mode) {
 
 /** \brief Prints a vector of integers.
  *
- * Prints a vector of integers.
+ * Prints a vector of integers, separated by spaces.
+ * \param[in] v the vector to print.
+ * \param[in] tw the text writer to print to. */
+void voro_print_vector(std::vector<int> &v,text_writer &tw) {
+	for(unsigned int k=0;k<v.size();k++) {
+		if(k>0) tw.put(' ');
+		tw.put(v[k]);
+	}
+}
+
+/** \brief Prints a vector of integers.
+ *
+ * Prints a vector of integers, separated by spaces.
  * \param[in] v the vector to print.
  * \param[in] fp the file stream to print to. */
 void voro_print_vector(std::vector<int> &v,FILE *fp) {
-	int k=0,s=v.size();
-	while(k+4<s) {
-		fprintf(fp,"%d %d %d %d ",v[k],v[k+1],v[k+2],v[k+3]);
-		k+=4;
+	text_writer tw(fp);
+	voro_print_vector(v,tw);
+}
+
+#ifdef VOROPP_LARGE_IDS
+/** \brief Prints a vector of particle IDs.
+ *
+ * Prints a vector of particle IDs, when these are wider than the integers
+ * printed by the routine above.
+ * \param[in] v the vector to print.
+ * \param[in] tw the text writer to print to. */
+void voro_print_vector(std::vector<voro_id> &v,text_writer &tw) {
+	for(unsigned int k=0;k<v.size();k++) {
+		if(k>0) tw.put(' ');
+		tw.put(v[k]);
 	}
-	if(k+3<=s) {
-		if(k+4==s) fprintf(fp,"%d %d %d %d",v[k],v[k+1],v[k+2],v[k+3]);
-		else fprintf(fp,"%d %d %d",v[k],v[k+1],v[k+2]);
-	} else {
-		if(k+2==s) fprintf(fp,"%d %d",v[k],v[k+1]);
-		else fprintf(fp,"%d",v[k]);
+}
+
+/** \brief Prints a vector of particle IDs.
+ *
+ * Prints a vector of particle IDs, when these are wider than the integers
+ * printed by the routine above.
+ * \param[in] v the vector to print.
+ * \param[in] fp the file stream to print to. */
+void voro_print_vector(std::vector<voro_id> &v,FILE *fp) {
+	text_writer tw(fp);
+	voro_print_vector(v,tw);
+}
+#endif
+
+/** \brief Prints a vector of doubles.
+ *
+ * Prints a vector of doubles, separated by spaces.
+ * \param[in] v the vector to print.
+ * \param[in] tw the text writer to print to. */
+void voro_print_vector(std::vector<double> &v,text_writer &tw) {
+	for(unsigned int k=0;k<v.size();k++) {
+		if(k>0) tw.put(' ');
+		tw.put(v[k]);
 	}
 }
 
 /** \brief Prints a vector of doubles.
  *
- * Prints a vector of doubles.
+ * Prints a vector of doubles, separated by spaces.
  * \param[in] v the vector to print.
  * \param[in] fp the file stream to print to. */
 void voro_print_vector(std::vector<double> &v,FILE *fp) {
-	int k=0,s=v.size();
-	while(k+4<s) {
-		fprintf(fp,"%g %g %g %g ",v[k],v[k+1],v[k+2],v[k+3]);
-		k+=4;
-	}
-	if(k+3<=s) {
-		if(k+4==s) fprintf(fp,"%g %g %g %g",v[k],v[k+1],v[k+2],v[k+3]);
-		else fprintf(fp,"%g %g %g",v[k],v[k+1],v[k+2]);
-	} else {
-		if(k+2==s) fprintf(fp,"%g %g",v[k],v[k+1]);
-		else fprintf(fp,"%g",v[k]);
-	}
+	text_writer tw(fp);
+	voro_print_vector(v,tw);
 }
 
 /** \brief Prints a vector a face vertex information.
@@ -106,33 +267,98 @@ void voro_print_vector(std::vector<double> &v,FILE *fp) {
  * this number of values and prints them as a bracked list. This is repeated
  * until the end of the vector is reached.
  * \param[in] v the vector to interpret and print.
- * \param[in] fp the file stream to print to. */
-void voro_print_face_vertices(std::vector<int> &v,FILE *fp) {
+ * \param[in] tw the text writer to print to. */
+void voro_print_face_vertices(std::vector<int> &v,text_writer &tw) {
 	int j,k=0,l;
-	if(v.size()>0) {
+	while((unsigned int) k<v.size()) {
+		if(k>0) tw.put(' ');
 		l=v[k++];
-		if(l<=1) {
-			if(l==1) fprintf(fp,"(%d)",v[k++]);
-			else fputs("()",fp);
-		} else {
-			j=k+l;
-			fprintf(fp,"(%d",v[k++]);
-			while(k<j) fprintf(fp,",%d",v[k++]);
-			fputs(")",fp);
-		}
-		while((unsigned int) k<v.size()) {
-			l=v[k++];
-			if(l<=1) {
-				if(l==1) fprintf(fp," (%d)",v[k++]);
-				else fputs(" ()",fp);
-			} else {
-				j=k+l;
-				fprintf(fp," (%d",v[k++]);
-				while(k<j) fprintf(fp,",%d",v[k++]);
-				fputs(")",fp);
-			}
+		tw.put('(');
+		for(j=k+l;k<j;k++) {
+			if(k+l>j) tw.put(',');
+			tw.put(v[k]);
 		}
+		tw.put(')');
 	}
 }
 
+/** \brief Prints a vector a face vertex information.
+ *
+ * Prints a vector of face vertex information, as described for the routine
+ * above.
+ * \param[in] v the vector to interpret and print.
+ * \param[in] fp the file stream to print to. */
+void voro_print_face_vertices(std::vector<int> &v,FILE *fp) {
+	text_writer tw(fp);
+	voro_print_face_vertices(v,tw);
+}
+
+/** \brief Determines the number of threads to use for a computation.
+ *
+ * Determines the number of threads to use for a computation. If the library
+ * has been compiled without OpenMP support, then this is always one.
+ * \param[in] nt the requested number of threads. If this is zero or
+ *		negative, then the OpenMP default number of threads is used.
+ * \return The number of threads to use. */
+int voro_threads(int nt) {
+#ifdef _OPENMP
+	return nt>0?nt:omp_get_max_threads();
+#else
+	return 1;
+#endif
+}
+
+/** \brief Returns the current time, for timing the code.
+ *
+ * Returns the current time in seconds. If the library has been compiled with
+ * OpenMP support, then this is the wall clock time, and otherwise it is the
+ * processor time used by the program.
+ * \return The time in seconds. */
+double voro_wtime() {
+#ifdef _OPENMP
+	return omp_get_wtime();
+#else
+	return double(clock())/CLOCKS_PER_SEC;
+#endif
+}
+
+/** Sets all of the counters to zero. */
+void voro_counters::clear() {
+	cells=plane_tests=plane_cuts=plane_removals=bailouts=marginal=exact=memory_grows=0;
+	worklist_blocks=queue_blocks=blocks_scanned=blocks_skipped=max_depth=0;
+}
+
+/** Adds another set of counters to this one.
+ * \param[in] vt the counters to add. */
+void voro_counters::merge(const voro_counters &vt) {
+	cells+=vt.cells;plane_tests+=vt.plane_tests;plane_cuts+=vt.plane_cuts;
+	plane_removals+=vt.plane_removals;bailouts+=vt.bailouts;
+	marginal+=vt.marginal;exact+=vt.exact;memory_grows+=vt.memory_grows;
+	worklist_blocks+=vt.worklist_blocks;queue_blocks+=vt.queue_blocks;
+	blocks_scanned+=vt.blocks_scanned;blocks_skipped+=vt.blocks_skipped;
+	if(vt.max_depth>max_depth) max_depth=vt.max_depth;
+}
+
+/** Prints the counters, with the name and value of each one on a line.
+ * \param[in] fp a file handle to write to. */
+void voro_counters::print(FILE *fp) {
+	const char *nm[13]={"cells","plane_tests","plane_cuts","plane_removals","bailouts",
+		"marginal","exact","memory_grows","worklist_blocks","queue_blocks",
+		"blocks_scanned","blocks_skipped","max_depth"};
+	unsigned long v[13]={cells,plane_tests,plane_cuts,plane_removals,bailouts,
+		marginal,exact,memory_grows,worklist_blocks,queue_blocks,
+		blocks_scanned,blocks_skipped,max_depth};
+	for(int i=0;i<13;i++) fprintf(fp,"%s %lu\n",nm[i],v[i]);
+}
+
+/** Prints the memory used by each of the data structures, with the name and
+ * the number of bytes of each one on a line, followed by the total and the
+ * peak.
+ * \param[in] fp a file handle to write to. */
+void voro_memory::print(FILE *fp) const {
+	const char *nm[8]={"particles","images","blocks","worklists","index","cells","total","peak"};
+	size_t v[8]={particles,images,blocks,worklists,index,cells,total(),peak};
+	for(int i=0;i<8;i++) fprintf(fp,"%s %lu\n",nm[i],(unsigned long) v[i]);
+}
+
 }
@@ -18,14 +18,194 @@
 
 namespace voro {
 
-void check_duplicate(int n,double x,double y,double z,int id,double *qp);
+/** \brief A class for counting events in the Voronoi cell computation.
+ *
+ * The Voronoi cell classes and the voro_compute template each hold a set of
+ * these counters, which are only updated if the library is compiled with
+ * VOROPP_COUNTERS set to 1. The counts of a cell are moved into the
+ * voro_compute class that computed it, so that each thread keeps its own
+ * totals, and the totals of the voro_compute classes made by the threaded
+ * routines of a container are added to the container when they are deleted.
+ * The counters are summed over all of the cells since they were last
+ * cleared. */
+class voro_counters {
+	public:
+		/** The number of cells computed. */
+		unsigned long cells;
+		/** The number of plane cuts that were attempted. */
+		unsigned long plane_tests;
+		/** The number of plane cuts that intersected the cell and
+		 * changed it. */
+		unsigned long plane_cuts;
+		/** The number of plane cuts that removed the cell entirely. */
+		unsigned long plane_removals;
+		/** The number of times the plane routine had to recover from
+		 * a degenerate configuration, by collapsing order one
+		 * vertices or abandoning an order two vertex that joins
+		 * itself. */
+		unsigned long bailouts;
+		/** The number of vertex tests that found the vertex within the
+		 * tolerance of the plane. */
+		unsigned long marginal;
+		/** The number of vertex tests that were recomputed in extended
+		 * precision by the robust mode. */
+		unsigned long exact;
+		/** The number of times that the memory of a cell was
+		 * expanded. */
+		unsigned long memory_grows;
+		/** The number of blocks taken from the worklists. */
+		unsigned long worklist_blocks;
+		/** The number of blocks taken from the queue, after the
+		 * worklist was used up. */
+		unsigned long queue_blocks;
+		/** The number of blocks whose particles were tested. */
+		unsigned long blocks_scanned;
+		/** The number of blocks that were skipped because they could
+		 * not intersect the cell. */
+		unsigned long blocks_skipped;
+		/** The furthest position reached in a worklist. */
+		unsigned long max_depth;
+		voro_counters() {clear();}
+		void clear();
+		void merge(const voro_counters &vt);
+		void print(FILE *fp=stdout);
+};
+
+/** \brief A class for reporting the memory used by a container.
+ *
+ * The memory_usage() routines of the containers fill in this class with the
+ * number of bytes that are currently allocated in each of their main data
+ * structures, and the peak number of bytes, which includes the time when a
+ * block's particle storage is being reallocated and both copies exist. The
+ * same class is returned by the container_base::estimate_memory() routine,
+ * which gives the expected footprint of a container before it is created. The
+ * memory of any walls that have been added is not included, since the walls
+ * are owned by the caller. */
+class voro_memory {
+	public:
+		/** The memory for the particle IDs and positions in the
+		 * primary domain. */
+		size_t particles;
+		/** The memory for the particle IDs and positions in the
+		 * periodic images, which is only used by the periodic
+		 * containers. */
+		size_t images;
+		/** The memory for the tables that hold the number of particles
+		 * in each block and the pointers to their storage. */
+		size_t blocks;
+		/** The memory for the worklist radii, any worklist table that
+		 * was generated for the block geometry, and the cutoff
+		 * planes. */
+		size_t worklists;
+		/** The memory for the index from particle IDs to their
+		 * positions in the blocks. */
+		size_t index;
+		/** The memory for the Voronoi cells, which is only set by the
+		 * estimate_memory() routine, for one cell per thread. */
+		size_t cells;
+		/** The peak total memory. */
+		size_t peak;
+		voro_memory() : particles(0), images(0), blocks(0), worklists(0), index(0),
+			cells(0), peak(0) {}
+		/** Returns the total memory that is currently allocated.
+		 * \return The total number of bytes. */
+		inline size_t total() const {return particles+images+blocks+worklists+index+cells;}
+		void print(FILE *fp=stdout) const;
+};
+
+extern int voro_precision;
+void voro_set_precision(int p);
+int voro_format_double(double v,int prec,char *s);
+int voro_format_long(long v,char *s);
+
+/** \brief A class for writing text to a file through a memory buffer.
+ *
+ * Writing numbers with fprintf() parses the format string and converts each
+ * number through the general routines of the C library, which takes most of
+ * the time when cell data is written out. This class collects the text in a
+ * buffer that is passed to the file in large pieces, and converts floating
+ * point numbers with voro_format_double(), which gives the same text as the
+ * "%g" conversion with the precision set by voro_set_precision(). The buffer
+ * is written out by flush() and when the class is destroyed, and it must be
+ * flushed before anything else writes to the same file. */
+class text_writer {
+	public:
+		/** The file handle to write to. */
+		FILE *fp;
+		/** The number of significant digits to use for floating
+		 * point numbers. */
+		const int prec;
+		/** Sets up the class to write to a file.
+		 * \param[in] fp_ the file handle to write to. */
+		explicit text_writer(FILE *fp_) : fp(fp_), prec(voro_precision), bp(buf) {}
+		/** The class destructor writes out any remaining text. */
+		~text_writer() {flush();}
+		/** Passes the text in the buffer to the file. */
+		inline void flush() {
+			if(bp>buf) {fwrite(buf,1,bp-buf,fp);bp=buf;}
+		}
+		/** Writes a floating point number.
+		 * \param[in] v the number to write. */
+		inline void put(double v) {room();bp+=voro_format_double(v,prec,bp);}
+		/** Writes an integer.
+		 * \param[in] v the integer to write. */
+		inline void put(int v) {room();bp+=voro_format_long(v,bp);}
+		/** Writes a long integer.
+		 * \param[in] v the integer to write. */
+		inline void put(long v) {room();bp+=voro_format_long(v,bp);}
+		/** Writes a single character.
+		 * \param[in] c the character to write. */
+		inline void put(char c) {room();*(bp++)=c;}
+		/** Writes a null-terminated string.
+		 * \param[in] s the string to write. */
+		inline void put(const char *s) {
+			while(*s!=0) put(*(s++));
+		}
+		/** Writes a string of a given length.
+		 * \param[in] s the string to write.
+		 * \param[in] n the length of the string. */
+		inline void put(const char *s,int n) {
+			while(n-->0) put(*(s++));
+		}
+		/** Writes three floating point numbers separated by a given
+		 * character.
+		 * \param[in] (x,y,z) the numbers to write.
+		 * \param[in] c the character to put between them. */
+		inline void put3(double x,double y,double z,char c) {
+			put(x);put(c);put(y);put(c);put(z);
+		}
+	private:
+		/** The position of the next character in the buffer. */
+		char *bp;
+		/** The buffer. */
+		char buf[text_buffer_size];
+		/** Flushes the buffer if there might not be enough space left
+		 * for a number. */
+		inline void room() {
+			if(bp>buf+(text_buffer_size-text_buffer_reserve)) flush();
+		}
+};
+
+void check_duplicate(voro_id n,double x,double y,double z,voro_id id,fpoint *qp);
 
 void voro_fatal_error(const char *p,int status);
 void voro_print_positions(std::vector<double> &v,FILE *fp=stdout);
 FILE* safe_fopen(const char *filename,const char *mode);
 void voro_print_vector(std::vector<int> &v,FILE *fp=stdout);
+#ifdef VOROPP_LARGE_IDS
+void voro_print_vector(std::vector<voro_id> &v,FILE *fp=stdout);
+#endif
 void voro_print_vector(std::vector<double> &v,FILE *fp=stdout);
 void voro_print_face_vertices(std::vector<int> &v,FILE *fp=stdout);
+void voro_print_positions(std::vector<double> &v,text_writer &tw);
+void voro_print_vector(std::vector<int> &v,text_writer &tw);
+#ifdef VOROPP_LARGE_IDS
+void voro_print_vector(std::vector<voro_id> &v,text_writer &tw);
+#endif
+void voro_print_vector(std::vector<double> &v,text_writer &tw);
+void voro_print_face_vertices(std::vector<int> &v,text_writer &tw);
+int voro_threads(int nt);
+double voro_wtime();
 
 }
 
@@ -37,6 +37,12 @@ const int init_wall_size=32;
 const int init_ordering_size=4096;
 /** The initial size of the pre_container chunk index. */
 const int init_chunk_size=256;
+/** The initial memory allocation for the number of nodes in the
+ * container_octree class. */
+const int init_octree_nodes=64;
+/** The initial memory allocation for the number of vertices of a
+ * two-dimensional Voronoi cell. */
+const int init_vertices_2d=32;
 
 // If the initial memory is too small, the program dynamically allocates more.
 // However, if the limits below are reached, then the program bails out.
@@ -55,15 +61,83 @@ const int max_xsearch_size=16777216;
 /** The maximum amount of particle memory allocated for a single region. */
 const int max_particle_memory=16777216;
 /** The maximum size for the wall pointer array. */
-const int max_wall_size=2048;
+const int max_wall_size=16777216;
 /** The maximum size for the ordering class. */
 const int max_ordering_size=67108864;
 /** The maximum size for the pre_container chunk index. */
 const int max_chunk_size=65536;
+/** The maximum number of nodes in the container_octree class. */
+const int max_octree_nodes=268435456;
+
+/** The number of vertices that are classified together when a plane is tested
+ * against every vertex of a Voronoi cell. The vertex positions are stored with
+ * a stride of four doubles, and each block is tested without branching, so
+ * that the compiler can use vector instructions for it. */
+const int vertex_block=8;
+
+/** The number of planes that can be tested together against a Voronoi cell,
+ * when checking whether a block of the container can be skipped. The planes
+ * are stored as separate coordinate arrays of this length, and unused entries
+ * are padded, so that every vertex can be tested against all of the planes in
+ * a fixed-length loop that the compiler can vectorize. */
+const int plane_block=8;
+
+/** The default size in bytes of each chunk of memory allocated by the
+ * cell_arena class. The largest part of a Voronoi cell's initial memory is the
+ * edge table, which takes roughly 150 kilobytes, so this holds several cells.
+ */
+const int arena_chunk_size=1048576;
 
 /** The chunk size in the pre_container classes. */
 const int pre_container_chunk_size=1024;
 
+/** The number of chunks per thread that the block_scheduler class divides the
+ * computational blocks into. */
+const int sched_chunks_per_thread=16;
+
+/** The number of standard errors that the confidence intervals of the
+ * cell_statistics class span on either side of the estimated mean, which gives
+ * a 95% confidence level for normally distributed estimates. */
+const double stat_confidence_z=1.96;
+
+/** The default number of particles that a leaf of the container_octree class
+ * can hold before it is divided into eight. */
+const int octree_leaf_max=8;
+
+/** The maximum depth of the container_octree class. A leaf at this depth is
+ * never divided, so that coincident particles do not cause an unbounded
+ * recursion. */
+const int octree_max_depth=24;
+
+/** The maximum number of triangles in a leaf of the bounding volume hierarchy
+ * that is used by the wall_mesh class. */
+const int wall_mesh_leaf_max=4;
+
+/** The maximum number of extra plane cuts that the wall_mesh class makes to a
+ * cell to remove the vertices that are outside the mesh. */
+const int wall_mesh_max_cuts=16;
+
+/** The number of points that are passed to each wall at a time when testing
+ * a batch of points, which is chosen so that the coordinates stay in the L1
+ * cache while each wall is applied. */
+const int points_inside_chunk=512;
+
+/** The size of the memory buffer that the text_writer class collects output in
+ * before passing it to the file. */
+const int text_buffer_size=8192;
+
+/** The space that is kept free at the end of the text_writer buffer, which
+ * must be enough for any single number. */
+const int text_buffer_reserve=64;
+
+/** The default number of significant digits used for floating point numbers in
+ * the text output, which matches the "%g" conversion of printf. */
+const int default_precision=6;
+
+/** The default capacity in bytes of the data area of a shared memory ring
+ * buffer, which is rounded up to a power of two. */
+const int shm_ring_default_size=16777216;
+
 #ifndef VOROPP_VERBOSE
 /** Voro++ can print a number of different status and debugging messages to
  * notify the user of special behavior, and this macro sets the amount which
@@ -75,12 +149,95 @@ const int pre_container_chunk_size=1024;
 #define VOROPP_VERBOSE 2
 #endif
 
+#ifndef VOROPP_COUNTERS
+/** If this is set to 1, then the Voronoi cell classes and the voro_compute
+ * template count events in the cell construction, such as plane cuts, memory
+ * expansions, and the blocks that are searched, which can be read back using
+ * the voro_counters class. At the default of 0, the counting code is removed
+ * at compile time, and the counters always read zero. The memory layout of the
+ * classes is the same either way. */
+#define VOROPP_COUNTERS 0
+#endif
+
+#if VOROPP_COUNTERS
+/** Carries out a counter update if VOROPP_COUNTERS is set, and does nothing
+ * otherwise. */
+#define VOROPP_COUNT(a) a
+#else
+#define VOROPP_COUNT(a)
+#endif
+
+#ifndef VOROPP_NUMA
+/** If this is set to 1, then the parallel routines that share out the blocks
+ * of a container with the block_scheduler class bind their threads to the
+ * processors with the OpenMP proc_bind(spread) clause. Each thread then runs
+ * in the same place in every parallel region, so that the particle memory that
+ * was placed on its memory node by the place_particle_memory() routines of the
+ * containers stays local to it. At the default of 0 the threads are not bound,
+ * unless this is requested at run time with the OMP_PROC_BIND environment
+ * variable, since binding can slow down several programs that share a
+ * machine. */
+#define VOROPP_NUMA 0
+#endif
+
+#if VOROPP_NUMA
+/** The thread binding clause that is added to the parallel regions that use
+ * the block_scheduler class, which is empty unless VOROPP_NUMA is set. */
+#define VOROPP_BIND proc_bind(spread)
+#else
+#define VOROPP_BIND
+#endif
+
+#ifdef VOROPP_SINGLE_PRECISION
+/** The floating point type that is used to store the particle positions in
+ * the containers and the vertex positions of the Voronoi cells. If the
+ * VOROPP_SINGLE_PRECISION macro is defined, then single precision is used,
+ * which halves the memory used by these arrays at the cost of accuracy. All
+ * other computations are still carried out in double precision. */
+typedef float fpoint;
+#else
+typedef double fpoint;
+#endif
+
+#ifdef VOROPP_LARGE_IDS
+/** The integer type that is used for particle IDs, including the neighbor IDs
+ * stored in Voronoi cells, and for total particle counts. If the
+ * VOROPP_LARGE_IDS macro is defined, then this is a long integer, which is 64
+ * bits on LP64 platforms such as Linux and macOS, so that more than 2^31
+ * particles can be numbered. Otherwise a plain integer is used, which keeps
+ * the memory for the IDs and the neighbor information at its smallest. The
+ * number of particles in a single block, and the block indices, are always
+ * plain integers.
+ *
+ * Since ANSI C++ has no integer type that is guaranteed to be 64 bits, the
+ * option is only supported on LP64 platforms. On platforms where a long
+ * integer is 32 bits, such as 64-bit Windows, the voropp_large_ids_check
+ * array below has a negative size, so that compilation stops rather than
+ * silently keeping 32-bit IDs. */
+typedef long voro_id;
+/** An array type that can only be declared if a long integer is at least 64
+ * bits, used to check that the VOROPP_LARGE_IDS option has an effect. */
+typedef char voropp_large_ids_check[sizeof(long)>=8?1:-1];
+#else
+typedef int voro_id;
+#endif
+
 /** If a point is within this distance of a cutting plane, then the code
- * assumes that point exactly lies on the plane. */
-const double tolerance=10.*std::numeric_limits<double>::epsilon();
+ * assumes that point exactly lies on the plane. This is scaled by the machine
+ * epsilon of the type used to store the vertex positions. */
+const double tolerance=10.*std::numeric_limits<fpoint>::epsilon();
 
 const double big_tolerance_fac=20.;
 
+/** If the robust plane test of a Voronoi cell is switched on, then the
+ * position of a vertex relative to a cutting plane is recomputed in extended
+ * precision when it is within this multiple of the tolerance of the plane. */
+const double robust_band_fac=64.;
+
+/** The ID given to the faces of a Voronoi cell that are made by the cutoff
+ * set with voro_base::set_cutoff(). */
+const int cutoff_id=-7;
+
 const double default_length=1000.;
 
 /** A large number that is used in the computation. */
@@ -96,6 +253,47 @@ const int max_unit_voro_shells=10;
  * container grid. */
 const double optimal_particles=5.6;
 
+/** If the ratio of the longest to the shortest side of a computational block
+ * exceeds this value, then the block worklists are generated for the real
+ * block geometry when a container is constructed, instead of using the
+ * pre-computed ones that assume roughly cubic blocks. */
+const double wl_max_aspect=1.5;
+
+/** For the radical Voronoi tessellation, the voro_compute template bounds the
+ * radii of the particles within this many blocks of a cell's block in each
+ * direction by their own maximum, instead of the maximum over the container,
+ * once the cell is small enough for this to be valid. The cells are the same,
+ * but since the search can stop sooner, the vertex positions may differ from
+ * those found with the global maximum by roundoff. */
+const int local_radius_blocks=2;
+/** The size in blocks of the regions that the voro_compute class divides the
+ * container into, so that a region with no particles can be tested against a
+ * cell as a whole and skipped in one step. */
+const int empty_region_blocks=4;
+
+/** The number of grid sizes on either side of the guess_optimal estimate that
+ * are considered by the grid auto-tuner. Successive sizes differ by a factor
+ * of 2^(1/6) in each direction, so that the number of blocks doubles every
+ * two steps. */
+const int tune_grid_steps=9;
+
+/** The grid auto-tuner chooses the grid with the smallest predicted memory out
+ * of those whose predicted time is within this factor of the fastest. */
+const double tune_time_margin=1.05;
+
+/** The largest initial block memory allocation that the grid auto-tuner
+ * considers. */
+const int tune_max_init_mem=64;
+
+/** The factor by which the domain_mpi class increases the ghost layer thickness
+ * required by the cells that failed, when recomputing them. This guards against
+ * round-off making the recomputation fail again. */
+const double ghost_layer_growth=1.1;
+
+/** The default maximum number of particles in each batch computed by the
+ * cell_batcher class. */
+const int batch_default_size=4096;
+
 /** If this is set to 1, then the code reports any instances of particles being
  * put outside of the container geometry. */
 #define VOROPP_REPORT_OUT_OF_BOUNDS 0
@@ -7,7 +7,13 @@
 /** \file container.cc
  * \brief Function implementations for the container and related classes. */
 
+#include <algorithm>
+
 #include "container.hh"
+#include "particle_file.hh"
+#include "text_reader.hh"
+#include "column_writer.hh"
+#include "state_file.hh"
 
 namespace voro {
 
@@ -24,23 +30,25 @@ namespace voro {
  * \param[in] (xperiodic_,yperiodic_,zperiodic_) flags setting whether the
  *                                               container is periodic in each
  *                                               coordinate direction.
- * \param[in] init_mem the initial memory allocation for each block.
+ * \param[in] init_mem_ the initial memory allocation for each block, which is
+ *                      made when the first particle is added to it.
  * \param[in] ps_ the number of floating point entries to store for each
  *                particle. */
 container_base::container_base(double ax_,double bx_,double ay_,double by_,double az_,double bz_,
-		int nx_,int ny_,int nz_,bool xperiodic_,bool yperiodic_,bool zperiodic_,int init_mem,int ps_)
+		int nx_,int ny_,int nz_,bool xperiodic_,bool yperiodic_,bool zperiodic_,int init_mem_,int ps_)
 	: voro_base(nx_,ny_,nz_,(bx_-ax_)/nx_,(by_-ay_)/ny_,(bz_-az_)/nz_),
 	ax(ax_), bx(bx_), ay(ay_), by(by_), az(az_), bz(bz_),
 	max_len_sq((bx-ax)*(bx-ax)*(xperiodic_?0.25:1)+(by-ay)*(by-ay)*(yperiodic_?0.25:1)
 		  +(bz-az)*(bz-az)*(zperiodic_?0.25:1)),
 	xperiodic(xperiodic_), yperiodic(yperiodic_), zperiodic(zperiodic_),
-	id(new int*[nxyz]), p(new double*[nxyz]), co(new int[nxyz]), mem(new int[nxyz]), ps(ps_) {
+	id(new voro_id*[nxyz]), p(new fpoint*[nxyz]), co(new int[nxyz]), mem(new int[nxyz]), init_mem(init_mem_>0?init_mem_:1), ps(ps_), update_count(0), indexed(false) {
 
 	int l;
 	for(l=0;l<nxyz;l++) co[l]=0;
-	for(l=0;l<nxyz;l++) mem[l]=init_mem;
-	for(l=0;l<nxyz;l++) id[l]=new int[init_mem];
-	for(l=0;l<nxyz;l++) p[l]=new double[ps*init_mem];
+	for(l=0;l<nxyz;l++) mem[l]=0;
+	for(l=0;l<nxyz;l++) id[l]=NULL;
+	for(l=0;l<nxyz;l++) p[l]=NULL;
+	set_wall_grid(ax,bx,ay,by,az,bz,nx,ny,nz);
 }
 
 /** The container destructor frees the dynamically allocated memory. */
@@ -53,6 +61,31 @@ container_base::~container_base() {
 	delete [] co;
 	delete [] mem;
 }
+/** Saves the particles and the block structure of the container to a binary
+ * state file.
+ * \param[in] filename the name of the file to write to.
+ * \param[in] mr the maximum particle radius to store. */
+void container_base::save_state(const char *filename,double mr) {
+	int a[4]={xperiodic,yperiodic,zperiodic,0};
+	double g[6]={ax,bx,ay,by,az,bz};
+	write_state_file(filename,0,ps,nx,ny,nz,nxyz,a,g,mr,id,p,co,NULL);
+}
+
+/** Restores the particles and the block structure of the container from a
+ * binary state file. The mapped file is copied directly into the block arrays,
+ * so that the particles do not need to be sorted into blocks again.
+ * \param[in] filename the name of the file to read.
+ * \return The maximum particle radius that was stored in the file. */
+double container_base::load_state(const char *filename) {
+	int a[4]={xperiodic,yperiodic,zperiodic,0};
+	double g[6]={ax,bx,ay,by,az,bz};
+	update_count++;
+	double mr=read_state_file(filename,0,ps,nx,ny,nz,nxyz,a,g,id,p,co,mem,NULL,1);
+	recount_slots(mem,nxyz,false);
+	if(indexed) rebuild_id_index();
+	return mr;
+}
+
 
 /** The class constructor sets up the geometry of container.
  * \param[in] (ax_,bx_) the minimum and maximum x coordinates.
@@ -87,24 +120,46 @@ container_poly::container_poly(double ax_,double bx_,double ay_,double by_,doubl
 /** Put a particle into the correct region of the container.
  * \param[in] n the numerical ID of the inserted particle.
  * \param[in] (x,y,z) the position vector of the inserted particle. */
-void container::put(int n,double x,double y,double z) {
+void container::put(voro_id n,double x,double y,double z) {
 	int ijk;
 	if(put_locate_block(ijk,x,y,z)) {
+		index_particle(n,ijk,co[ijk]);
 		id[ijk][co[ijk]]=n;
-		double *pp=p[ijk]+3*co[ijk]++;
+		fpoint *pp=p[ijk]+3*co[ijk]++;
 		*(pp++)=x;*(pp++)=y;*pp=z;
 	}
 }
 
+/** Put a particle into the correct region of the container, and return where
+ * it was stored.
+ * \param[in] n the numerical ID of the inserted particle.
+ * \param[in] (x,y,z) the position vector of the inserted particle.
+ * \param[out] ijk the block that the particle was stored in.
+ * \param[out] q the index of the particle within the block.
+ * \return True if the particle was stored, false if it was outside the
+ *         container. */
+bool container::put(voro_id n,double x,double y,double z,int &ijk,int &q) {
+	if(put_locate_block(ijk,x,y,z)) {
+		q=co[ijk];
+		index_particle(n,ijk,q);
+		id[ijk][co[ijk]]=n;
+		fpoint *pp=p[ijk]+3*co[ijk]++;
+		*(pp++)=x;*(pp++)=y;*pp=z;
+		return true;
+	}
+	return false;
+}
+
 /** Put a particle into the correct region of the container.
  * \param[in] n the numerical ID of the inserted particle.
  * \param[in] (x,y,z) the position vector of the inserted particle.
  * \param[in] r the radius of the particle. */
-void container_poly::put(int n,double x,double y,double z,double r) {
+void container_poly::put(voro_id n,double x,double y,double z,double r) {
 	int ijk;
 	if(put_locate_block(ijk,x,y,z)) {
+		index_particle(n,ijk,co[ijk]);
 		id[ijk][co[ijk]]=n;
-		double *pp=p[ijk]+4*co[ijk]++;
+		fpoint *pp=p[ijk]+4*co[ijk]++;
 		*(pp++)=x;*(pp++)=y;*(pp++)=z;*pp=r;
 		if(max_radius<r) max_radius=r;
 	}
@@ -115,12 +170,13 @@ void container_poly::put(int n,double x,double y,double z,double r) {
  * \param[in] vo the ordering class in which to record the region.
  * \param[in] n the numerical ID of the inserted particle.
  * \param[in] (x,y,z) the position vector of the inserted particle. */
-void container::put(particle_order &vo,int n,double x,double y,double z) {
+void container::put(particle_order &vo,voro_id n,double x,double y,double z) {
 	int ijk;
 	if(put_locate_block(ijk,x,y,z)) {
+		index_particle(n,ijk,co[ijk]);
 		id[ijk][co[ijk]]=n;
 		vo.add(ijk,co[ijk]);
-		double *pp=p[ijk]+3*co[ijk]++;
+		fpoint *pp=p[ijk]+3*co[ijk]++;
 		*(pp++)=x;*(pp++)=y;*pp=z;
 	}
 }
@@ -131,12 +187,13 @@ void container::put(particle_order &vo,int n,double x,double y,double z) {
  * \param[in] n the numerical ID of the inserted particle.
  * \param[in] (x,y,z) the position vector of the inserted particle.
  * \param[in] r the radius of the particle. */
-void container_poly::put(particle_order &vo,int n,double x,double y,double z,double r) {
+void container_poly::put(particle_order &vo,voro_id n,double x,double y,double z,double r) {
 	int ijk;
 	if(put_locate_block(ijk,x,y,z)) {
+		index_particle(n,ijk,co[ijk]);
 		id[ijk][co[ijk]]=n;
 		vo.add(ijk,co[ijk]);
-		double *pp=p[ijk]+4*co[ijk]++;
+		fpoint *pp=p[ijk]+4*co[ijk]++;
 		*(pp++)=x;*(pp++)=y;*(pp++)=z;*pp=r;
 		if(max_radius<r) max_radius=r;
 	}
@@ -152,6 +209,7 @@ void container_poly::put(particle_order &vo,int n,double x,double y,double z,dou
  * \return True if the particle can be successfully placed into the container,
  * false otherwise. */
 bool container_base::put_locate_block(int &ijk,double &x,double &y,double &z) {
+	update_count++;
 	if(put_remap(ijk,x,y,z)) {
 		if(co[ijk]==mem[ijk]) add_particle_memory(ijk);
 		return true;
@@ -224,25 +282,33 @@ inline bool container_base::remap(int &ai,int &aj,int &ak,int &ci,int &cj,int &c
 }
 
 /** Takes a vector and finds the particle whose Voronoi cell contains that
- * vector. This is equivalent to finding the particle which is nearest to the
- * vector. Additional wall classes are not considered by this routine.
+ * vector, making use of the result of a previous search. If the previous
+ * search started in the same block, then the particle that it found is used
+ * as the initial estimate, which allows much of the search to be skipped for
+ * a sequence of nearby vectors. Additional wall classes are not considered by
+ * this routine.
  * \param[in] (x,y,z) the vector to test.
  * \param[out] (rx,ry,rz) the position of the particle whose Voronoi cell
  *                        contains the vector. If the container is periodic,
  *                        this may point to a particle in a periodic image of
  *                        the primary domain.
  * \param[out] pid the ID of the particle.
+ * \param[in] vcl the voro_compute class to carry out the search with.
+ * \param[in,out] w a particle record holding the result of the previous
+ *		    search.
+ * \param[in,out] wijk the block that the previous search started in, or -1
+ *		       if there is no previous search to use.
  * \return True if a particle was found. If the container has no particles,
  * then the search will not find a Voronoi cell and false is returned. */
-bool container::find_voronoi_cell(double x,double y,double z,double &rx,double &ry,double &rz,int &pid) {
+bool container::find_voronoi_cell(double x,double y,double z,double &rx,double &ry,double &rz,voro_id &pid,voro_compute<container> &vcl,particle_record &w,int &wijk) {
 	int ai,aj,ak,ci,cj,ck,ijk;
-	particle_record w;
 	double mrs;
 
 	// If the given vector lies outside the domain, but the container
 	// is periodic, then remap it back into the domain
 	if(!remap(ai,aj,ak,ci,cj,ck,x,y,z,ijk)) return false;
-	vc.find_voronoi_cell(x,y,z,ci,cj,ck,ijk,w,mrs);
+	vcl.find_voronoi_cell(x,y,z,ci,cj,ck,ijk,w,mrs,wijk==ijk);
+	wijk=w.ijk==-1?-1:ijk;
 
 	if(w.ijk!=-1) {
 
@@ -262,25 +328,71 @@ bool container::find_voronoi_cell(double x,double y,double z,double &rx,double &
 	return false;
 }
 
+/** Finds the particles whose Voronoi cells contain a list of vectors. The
+ * vectors are sorted by block, so that each search can reuse the result of
+ * the previous one, and they can be shared out among several threads, each
+ * with its own voro_compute class.
+ * \param[in] n the number of vectors.
+ * \param[in] pp an array of (x,y,z) vectors.
+ * \param[out] rp an array in which to store the (x,y,z) positions of the
+ *		  particles that were found.
+ * \param[out] pid an array in which to store the IDs of the particles that
+ *		   were found, or -1 if no particle was found.
+ * \param[in] nt the number of threads to use. */
+void container::find_voronoi_cells(int n,const double *pp,double *rp,voro_id *pid,int nt) {
+	int *ord=new int[2*n],*gijk=ord+n,a,l,m;
+	double *gp=new double[3*n];
+	m=sort_by_block(n,pp,3,ord,gijk,gp);
+	for(l=0;l<n;l++) pid[l]=-1;
+	nt=voro_threads(nt);
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nt) private(a,l)
+#endif
+	{
+		voro_compute<container> vcl(*this,vc.hx,vc.hy,vc.hz);
+		particle_record w;
+		int wijk=-1;
+		double *rpp;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic,64)
+#endif
+		for(a=0;a<m;a++) {
+			l=ord[a];rpp=rp+3*l;
+			if(!find_voronoi_cell(pp[3*l],pp[3*l+1],pp[3*l+2],*rpp,rpp[1],rpp[2],pid[l],vcl,w,wijk)) pid[l]=-1;
+		}
+	}
+	delete [] gp;
+	delete [] ord;
+}
+
 /** Takes a vector and finds the particle whose Voronoi cell contains that
- * vector. Additional wall classes are not considered by this routine.
+ * vector, making use of the result of a previous search. If the previous
+ * search started in the same block, then the particle that it found is used
+ * as the initial estimate, which allows much of the search to be skipped for
+ * a sequence of nearby vectors. Additional wall classes are not considered by
+ * this routine.
  * \param[in] (x,y,z) the vector to test.
  * \param[out] (rx,ry,rz) the position of the particle whose Voronoi cell
  *                        contains the vector. If the container is periodic,
  *                        this may point to a particle in a periodic image of
  *                        the primary domain.
  * \param[out] pid the ID of the particle.
+ * \param[in] vcl the voro_compute class to carry out the search with.
+ * \param[in,out] w a particle record holding the result of the previous
+ *		    search.
+ * \param[in,out] wijk the block that the previous search started in, or -1
+ *		       if there is no previous search to use.
  * \return True if a particle was found. If the container has no particles,
  * then the search will not find a Voronoi cell and false is returned. */
-bool container_poly::find_voronoi_cell(double x,double y,double z,double &rx,double &ry,double &rz,int &pid) {
+bool container_poly::find_voronoi_cell(double x,double y,double z,double &rx,double &ry,double &rz,voro_id &pid,voro_compute<container_poly> &vcl,particle_record &w,int &wijk) {
 	int ai,aj,ak,ci,cj,ck,ijk;
-	particle_record w;
 	double mrs;
 
 	// If the given vector lies outside the domain, but the container
 	// is periodic, then remap it back into the domain
 	if(!remap(ai,aj,ak,ci,cj,ck,x,y,z,ijk)) return false;
-	vc.find_voronoi_cell(x,y,z,ci,cj,ck,ijk,w,mrs);
+	vcl.find_voronoi_cell(x,y,z,ci,cj,ck,ijk,w,mrs,wijk==ijk);
+	wijk=w.ijk==-1?-1:ijk;
 
 	if(w.ijk!=-1) {
 
@@ -300,10 +412,300 @@ bool container_poly::find_voronoi_cell(double x,double y,double z,double &rx,dou
 	return false;
 }
 
+/** Finds the particles whose Voronoi cells contain a list of vectors. The
+ * vectors are sorted by block, so that each search can reuse the result of
+ * the previous one, and they can be shared out among several threads, each
+ * with its own voro_compute class.
+ * \param[in] n the number of vectors.
+ * \param[in] pp an array of (x,y,z) vectors.
+ * \param[out] rp an array in which to store the (x,y,z) positions of the
+ *		  particles that were found.
+ * \param[out] pid an array in which to store the IDs of the particles that
+ *		   were found, or -1 if no particle was found.
+ * \param[in] nt the number of threads to use. */
+void container_poly::find_voronoi_cells(int n,const double *pp,double *rp,voro_id *pid,int nt) {
+	int *ord=new int[2*n],*gijk=ord+n,a,l,m;
+	double *gp=new double[3*n];
+	m=sort_by_block(n,pp,3,ord,gijk,gp);
+	for(l=0;l<n;l++) pid[l]=-1;
+	nt=voro_threads(nt);
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nt) private(a,l)
+#endif
+	{
+		voro_compute<container_poly> vcl(*this,vc.hx,vc.hy,vc.hz);
+		particle_record w;
+		int wijk=-1;
+		double *rpp;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic,64)
+#endif
+		for(a=0;a<m;a++) {
+			l=ord[a];rpp=rp+3*l;
+			if(!find_voronoi_cell(pp[3*l],pp[3*l+1],pp[3*l+2],*rpp,rpp[1],rpp[2],pid[l],vcl,w,wijk)) pid[l]=-1;
+		}
+	}
+	delete [] gp;
+	delete [] ord;
+}
+
+/** Moves a stored particle to a new position. If the new position is within
+ * the same block, then the particle is updated in place. Otherwise it is
+ * appended to its new block, along with its ID and any other stored values
+ * such as its radius, and the last particle of its old block is moved into the
+ * vacated position, as in remove_particle(). No memory is allocated unless the
+ * new block is full.
+ * \param[in] ijk the block that the particle is within.
+ * \param[in] q the index of the particle within the block.
+ * \param[in] (x,y,z) the new position of the particle, which is remapped into
+ *		      the primary domain in the periodic directions.
+ * \return True if the particle was moved, false if the new position is outside
+ *	   the container, in which case the particle is left unchanged. */
+bool container_base::move_particle(int ijk,int q,double x,double y,double z) {
+	int nijk;
+	if(!put_remap(nijk,x,y,z)) return false;
+	relocate_particle(ijk,q,nijk,x,y,z);
+	update_count++;
+	return true;
+}
+
+/** Moves all of the stored particles to new positions for the next frame of a
+ * trajectory, without clearing the container. The particles that stay within
+ * their blocks are updated in place, and only those that cross a block
+ * boundary are moved between blocks, so that the memory of the blocks is kept
+ * and the particles are not sorted again. The blocks are scanned in reverse
+ * order of the particles, so that a particle that moves into a vacated
+ * position has already been updated.
+ * \param[in] n the number of particle IDs in the array of new positions.
+ * \param[in] pp the new positions, in groups of three, indexed by the
+ *		  particle IDs. They are remapped into the primary domain in
+ *		  the periodic directions, so unwrapped coordinates can be
+ *		  used. Stored particles whose IDs are negative or at least n
+ *		  are left unchanged.
+ * \param[out] changed a pointer to a vector in which to store the indices of
+ *		       the blocks whose particles have changed, in increasing
+ *		       order, or NULL if this is not needed. A block is
+ *		       included if any particle within it moves, or if any
+ *		       particle enters or leaves it.
+ * \return The number of particles whose new positions are outside the
+ *	   container, which are left at their old positions. */
+int container_base::update_frame(voro_id n,const double *pp,std::vector<int> *changed) {
+	int ijk,q,b,out=0;
+	voro_id i;
+	double x,y,z;
+	bool moved=false;
+	fpoint *fp;
+	if(changed!=NULL) {chf.assign(nxyz,0);changed->clear();}
+	for(ijk=0;ijk<nxyz;ijk++) for(q=co[ijk]-1;q>=0;q--) {
+		i=id[ijk][q];
+		if(i<0||i>=n) continue;
+		x=pp[3*i];y=pp[3*i+1];z=pp[3*i+2];
+		if(!put_remap(b,x,y,z)) {out++;continue;}
+		fp=p[ijk]+ps*q;
+		if(*fp==fpoint(x)&&fp[1]==fpoint(y)&&fp[2]==fpoint(z)) continue;
+		relocate_particle(ijk,q,b,x,y,z);
+		moved=true;
+		if(changed!=NULL) chf[ijk]=chf[b]=1;
+	}
+	if(moved) update_count++;
+	if(changed!=NULL) for(ijk=0;ijk<nxyz;ijk++) if(chf[ijk]) changed->push_back(ijk);
+	return out;
+}
+
+/** Moves a stored particle to a new position within a given block, as
+ * described in move_particle().
+ * \param[in] ijk the block that the particle is within.
+ * \param[in] q the index of the particle within the block.
+ * \param[in] nijk the block that the new position is within.
+ * \param[in] (x,y,z) the new position of the particle, which must already be
+ *		      in the primary domain. */
+void container_base::relocate_particle(int ijk,int q,int nijk,double x,double y,double z) {
+	if(nijk!=ijk) {
+		if(co[nijk]==mem[nijk]) add_particle_memory(nijk);
+		int l=co[nijk]++;
+		voro_id n=id[ijk][q];
+		id[nijk][l]=n;
+		for(int c=3;c<ps;c++) p[nijk][ps*l+c]=p[ijk][ps*q+c];
+		remove_particle(ijk,q);
+		index_particle(n,nijk,l);
+		q=l;
+	}
+	fpoint *pp=p[nijk]+ps*q;
+	*pp=x;pp[1]=y;pp[2]=z;
+}
+
+/** Takes a ghost particle position, maps it into the primary domain if the
+ * container is periodic, and finds the block that it is within. Unlike
+ * put_locate_block(), this does not modify the container.
+ * \param[out] ijk the index of the block.
+ * \param[out] (ci,cj,ck) the coordinates of the block.
+ * \param[in,out] (x,y,z) the ghost particle position, remapped into the
+ *			  primary domain.
+ * \return True if the ghost particle is within the container, false
+ *         otherwise. */
+bool container_base::locate_ghost(int &ijk,int &ci,int &cj,int &ck,double &x,double &y,double &z) {
+	if(!put_remap(ijk,x,y,z)) return false;
+	ck=ijk/nxy;cj=(ijk-nxy*ck)/nx;ci=ijk-nx*(cj+ny*ck);
+	return true;
+}
+
+/** Finds the blocks that a list of positions are in, and sorts the positions
+ * by block, so that consecutive computations for them access the same parts
+ * of the container. Within each block, the positions are kept in their
+ * original order.
+ * \param[in] n the number of positions.
+ * \param[in] pp an array of positions.
+ * \param[in] pps the number of entries per position in pp.
+ * \param[out] ord an array in which to store the indices of the positions
+ *		   that are within the container, sorted by block.
+ * \param[out] gijk an array in which to store the block of each position, or
+ *		    -1 if it is outside the container.
+ * \param[out] gp an array in which to store the positions, remapped into the
+ *		  primary domain.
+ * \return The number of positions that are within the container. */
+int container_base::sort_by_block(int n,const double *pp,int pps,int *ord,int *gijk,double *gp) {
+	trace_scope ts("sort");
+	int *bc=new int[nxyz+1],ijk,l,m=0;
+	double *gpp=gp;
+	for(ijk=0;ijk<=nxyz;ijk++) bc[ijk]=0;
+	for(l=0;l<n;l++,pp+=pps,gpp+=3) {
+		*gpp=*pp;gpp[1]=pp[1];gpp[2]=pp[2];
+		if(put_remap(gijk[l],*gpp,gpp[1],gpp[2])) bc[gijk[l]+1]++;
+		else gijk[l]=-1;
+	}
+	for(ijk=0;ijk<nxyz;ijk++) bc[ijk+1]+=bc[ijk];
+	for(l=0;l<n;l++) if(gijk[l]>=0) {ord[bc[gijk[l]]++]=l;m++;}
+	delete [] bc;
+	return m;
+}
+
+/** Computes the Voronoi cells for a list of ghost particles that have been
+ * sorted by block, and stores a compact summary of each. Each thread uses its
+ * own voro_compute class, and collects the neighbors in its own buffer; these
+ * are then gathered into a single array in the original ghost particle order.
+ * \param[in] con the container to use.
+ * \param[in] (hx,hy,hz) the mask dimensions for the voro_compute classes.
+ * \param[in] n the number of ghost particles.
+ * \param[in] m the number of ghost particles within the container.
+ * \param[in] ord the sorted ghost particle indices.
+ * \param[in] gijk the block of each ghost particle.
+ * \param[in] gp the remapped ghost particle positions.
+ * \param[in] gr an array of radii, with entries spaced by rs, or NULL for
+ *		 the regular Voronoi tessellation.
+ * \param[in] rs the spacing of the radius entries.
+ * \param[out] rec the array of records to fill in.
+ * \param[out] nb a vector in which to store the neighbors, or NULL if they
+ *		  are not needed.
+ * \param[in] nt the number of threads to use. */
+template<class c_class,class v_cell>
+static void compute_ghost_batch(c_class &con,int hx,int hy,int hz,int n,int m,int *ord,int *gijk,double *gp,
+		const double *gr,int rs,ghost_cell_record *rec,std::vector<voro_id> *nb,int nt) {
+	std::vector<voro_id> *tb=new std::vector<voro_id>[nt];
+	int *gt=new int[n],a,l;
+	for(l=0;l<n;l++) {
+		rec[l].volume=rec[l].cx=rec[l].cy=rec[l].cz=0;
+		rec[l].faces=rec[l].nb=0;
+	}
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nt) private(a,l)
+#endif
+	{
+#ifdef _OPENMP
+		int t=omp_get_thread_num();
+#else
+		int t=0;
+#endif
+		v_cell c(con);
+		voro_compute<c_class> vcl(con,hx,hy,hz);
+		cell_query qr(query_volume|query_centroid|query_faces);
+		std::vector<voro_id> v;
+		int ijk,ci,cj,ck;
+		double *pp;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic,64)
+#endif
+		for(a=0;a<m;a++) {
+			l=ord[a];ijk=gijk[l];pp=gp+3*l;
+			ck=ijk/con.nxy;cj=(ijk-con.nxy*ck)/con.nx;ci=ijk-con.nx*(cj+con.ny*ck);
+			if(vcl.compute_ghost_cell(c,*pp,pp[1],pp[2],gr==NULL?0:gr[rs*l],ijk,ci,cj,ck)) {
+				ghost_cell_record &g=rec[l];
+				c.evaluate(qr);
+				g.volume=qr.volume;
+				g.cx=qr.cx;g.cy=qr.cy;g.cz=qr.cz;
+				g.faces=qr.faces;
+				if(nb!=NULL) {
+					c.neighbors(v);
+					g.nb=tb[t].size();gt[l]=t;
+					tb[t].insert(tb[t].end(),v.begin(),v.end());
+				}
+			}
+		}
+	}
+
+	// Gather the neighbors into the output vector in the original order
+	if(nb!=NULL) {
+		nb->clear();
+		for(l=0;l<n;l++) {
+			a=rec[l].nb;rec[l].nb=nb->size();
+			if(rec[l].faces>0) nb->insert(nb->end(),tb[gt[l]].begin()+a,tb[gt[l]].begin()+a+rec[l].faces);
+		}
+	}
+	delete [] gt;
+	delete [] tb;
+}
+
+/** Computes the Voronoi cells for a list of ghost particles, without adding
+ * them to the container. The ghost particles are sorted by block before the
+ * computation, so that consecutive computations access nearby parts of the
+ * container, and they can be shared out among several threads.
+ * \param[in] n the number of ghost particles.
+ * \param[in] pp an array of (x,y,z) positions for the ghost particles.
+ * \param[out] gr an array of n records in which to store the summary of each
+ *		  ghost cell. Ghost particles outside the container, or whose
+ *		  cells are removed by walls, have a zero volume.
+ * \param[out] nb a vector in which to store the neighbors of the ghost cells,
+ *		  indexed by the records, or NULL if they are not needed.
+ * \param[in] nt the number of threads to use. */
+void container::compute_ghost_cells(int n,const double *pp,ghost_cell_record *gr,std::vector<voro_id> *nb,int nt) {
+	int *ord=new int[2*n],*gijk=ord+n,m;
+	double *gp=new double[3*n];
+	m=sort_by_block(n,pp,3,ord,gijk,gp);
+	nt=voro_threads(nt);
+	if(nb==NULL) compute_ghost_batch<container,voronoicell>(*this,vc.hx,vc.hy,vc.hz,n,m,ord,gijk,gp,NULL,0,gr,nb,nt);
+	else compute_ghost_batch<container,voronoicell_neighbor>(*this,vc.hx,vc.hy,vc.hz,n,m,ord,gijk,gp,NULL,0,gr,nb,nt);
+	delete [] gp;
+	delete [] ord;
+}
+
+/** Computes the Voronoi cells for a list of ghost particles, without adding
+ * them to the container. The ghost particles are sorted by block before the
+ * computation, so that consecutive computations access nearby parts of the
+ * container, and they can be shared out among several threads.
+ * \param[in] n the number of ghost particles.
+ * \param[in] pp an array of (x,y,z,r) positions and radii for the ghost
+ *		 particles.
+ * \param[out] gr an array of n records in which to store the summary of each
+ *		  ghost cell. Ghost particles outside the container, or whose
+ *		  cells are removed by walls, have a zero volume.
+ * \param[out] nb a vector in which to store the neighbors of the ghost cells,
+ *		  indexed by the records, or NULL if they are not needed.
+ * \param[in] nt the number of threads to use. */
+void container_poly::compute_ghost_cells(int n,const double *pp,ghost_cell_record *gr,std::vector<voro_id> *nb,int nt) {
+	int *ord=new int[2*n],*gijk=ord+n,m;
+	double *gp=new double[3*n];
+	m=sort_by_block(n,pp,4,ord,gijk,gp);
+	nt=voro_threads(nt);
+	if(nb==NULL) compute_ghost_batch<container_poly,voronoicell>(*this,vc.hx,vc.hy,vc.hz,n,m,ord,gijk,gp,pp+3,4,gr,nb,nt);
+	else compute_ghost_batch<container_poly,voronoicell_neighbor>(*this,vc.hx,vc.hy,vc.hz,n,m,ord,gijk,gp,pp+3,4,gr,nb,nt);
+	delete [] gp;
+	delete [] ord;
+}
+
 /** Increase memory for a particular region.
- * \param[in] i the index of the region to reallocate. */
-void container_base::add_particle_memory(int i) {
-	int l,nmem=mem[i]<<1;
+ * \param[in] i the index of the region to reallocate.
+ * \param[in] nmem the new number of particles to allocate memory for. */
+void container_base::add_particle_memory(int i,int nmem) {
+	int l;
 
 	// Carry out a check on the memory allocation size, and
 	// print a status message if requested
@@ -313,11 +715,18 @@ void container_base::add_particle_memory(int i) {
 	fprintf(stderr,"Particle memory in region %d scaled up to %d\n",i,nmem);
 #endif
 
-	// Allocate new memory and copy in the contents of the old arrays
-	int *idp=new int[nmem];
-	for(l=0;l<co[i];l++) idp[l]=id[i][l];
-	double *pp=new double[ps*nmem];
-	for(l=0;l<ps*co[i];l++) pp[l]=p[i][l];
+	track_slots(mem[i],nmem);
+
+	// Allocate new memory and copy in the contents of the old arrays. A
+	// region with no memory holds null pointers.
+	voro_id *idp=NULL;
+	fpoint *pp=NULL;
+	if(nmem>0) {
+		idp=new voro_id[nmem];
+		for(l=0;l<co[i];l++) idp[l]=id[i][l];
+		pp=new fpoint[ps*nmem];
+		for(l=0;l<ps*co[i];l++) pp[l]=p[i][l];
+	}
 
 	// Update pointers and delete old arrays
 	mem[i]=nmem;
@@ -329,12 +738,13 @@ void container_base::add_particle_memory(int i) {
  * Entries of four numbers (Particle ID, x position, y position, z position)
  * are searched for. If the file cannot be successfully read, then the routine
  * causes a fatal error.
- * \param[in] fp the file handle to read from. */
-void container::import(FILE *fp) {
-	int i,j;
-	double x,y,z;
-	while((j=fscanf(fp,"%d %lg %lg %lg",&i,&x,&y,&z))==4) put(i,x,y,z);
-	if(j!=EOF) voro_fatal_error("File import error",VOROPP_FILE_ERROR);
+ * \param[in] fp the file handle to read from.
+ * \param[in] nt the number of threads to use to parse the file. */
+void container::import(FILE *fp,int nt) {
+	trace_scope ts("import");
+	text_reader tr(fp,3,nt);
+	while(tr.next()) for(unsigned int i=0;i<tr.id.size();i++)
+		put(tr.id[i],tr.v[3*i],tr.v[3*i+1],tr.v[3*i+2]);
 }
 
 /** Import a list of particles from an open file stream, also storing the order
@@ -342,24 +752,53 @@ void container::import(FILE *fp) {
  * position, y position, z position) are searched for. If the file cannot be
  * successfully read, then the routine causes a fatal error.
  * \param[in,out] vo a reference to an ordering class to use.
- * \param[in] fp the file handle to read from. */
-void container::import(particle_order &vo,FILE *fp) {
-	int i,j;
+ * \param[in] fp the file handle to read from.
+ * \param[in] nt the number of threads to use to parse the file. */
+void container::import(particle_order &vo,FILE *fp,int nt) {
+	trace_scope ts("import");
+	text_reader tr(fp,3,nt);
+	while(tr.next()) for(unsigned int i=0;i<tr.id.size();i++)
+		put(vo,tr.id[i],tr.v[3*i],tr.v[3*i+1],tr.v[3*i+2]);
+}
+
+/** Imports a list of particles from a binary particle file into the container.
+ * The file is mapped into memory and each record is passed to put(). Any
+ * radii that are stored in the file are ignored. If the file cannot be read,
+ * then the routine causes a fatal error.
+ * \param[in] filename the name of the file to read. */
+void container::import_binary(const char *filename) {
+	trace_scope ts("import");
+	particle_file pf(filename);
+	int i,n;
 	double x,y,z;
-	while((j=fscanf(fp,"%d %lg %lg %lg",&i,&x,&y,&z))==4) put(vo,i,x,y,z);
-	if(j!=EOF) voro_fatal_error("File import error",VOROPP_FILE_ERROR);
+	for(i=0;i<pf.n;i++) {pf.get(i,n,x,y,z);put(n,x,y,z);}
+}
+
+/** Imports a list of particles from a binary particle file into the container,
+ * also storing the order that the particles are read. Any radii that are
+ * stored in the file are ignored. If the file cannot be read, then the routine
+ * causes a fatal error.
+ * \param[in,out] vo a reference to an ordering class to use.
+ * \param[in] filename the name of the file to read. */
+void container::import_binary(particle_order &vo,const char *filename) {
+	trace_scope ts("import");
+	particle_file pf(filename);
+	int i,n;
+	double x,y,z;
+	for(i=0;i<pf.n;i++) {pf.get(i,n,x,y,z);put(vo,n,x,y,z);}
 }
 
 /** Import a list of particles from an open file stream into the container.
  * Entries of five numbers (Particle ID, x position, y position, z position,
  * radius) are searched for. If the file cannot be successfully read, then the
  * routine causes a fatal error.
- * \param[in] fp the file handle to read from. */
-void container_poly::import(FILE *fp) {
-	int i,j;
-	double x,y,z,r;
-	while((j=fscanf(fp,"%d %lg %lg %lg %lg",&i,&x,&y,&z,&r))==5) put(i,x,y,z,r);
-	if(j!=EOF) voro_fatal_error("File import error",VOROPP_FILE_ERROR);
+ * \param[in] fp the file handle to read from.
+ * \param[in] nt the number of threads to use to parse the file. */
+void container_poly::import(FILE *fp,int nt) {
+	trace_scope ts("import");
+	text_reader tr(fp,4,nt);
+	while(tr.next()) for(unsigned int i=0;i<tr.id.size();i++)
+		put(tr.id[i],tr.v[4*i],tr.v[4*i+1],tr.v[4*i+2],tr.v[4*i+3]);
 }
 
 /** Import a list of particles from an open file stream, also storing the order
@@ -367,12 +806,42 @@ void container_poly::import(FILE *fp) {
  * position, y position, z position, radius) are searched for. If the file
  * cannot be successfully read, then the routine causes a fatal error.
  * \param[in,out] vo a reference to an ordering class to use.
- * \param[in] fp the file handle to read from. */
-void container_poly::import(particle_order &vo,FILE *fp) {
-	int i,j;
+ * \param[in] fp the file handle to read from.
+ * \param[in] nt the number of threads to use to parse the file. */
+void container_poly::import(particle_order &vo,FILE *fp,int nt) {
+	trace_scope ts("import");
+	text_reader tr(fp,4,nt);
+	while(tr.next()) for(unsigned int i=0;i<tr.id.size();i++)
+		put(vo,tr.id[i],tr.v[4*i],tr.v[4*i+1],tr.v[4*i+2],tr.v[4*i+3]);
+}
+
+/** Imports a list of particles from a binary particle file into the container.
+ * The file is mapped into memory and each record is passed to put(). If the
+ * file cannot be read or does not contain the particle radii, then the
+ * routine causes a fatal error.
+ * \param[in] filename the name of the file to read. */
+void container_poly::import_binary(const char *filename) {
+	trace_scope ts("import");
+	particle_file pf(filename);
+	if(!pf.radii) voro_fatal_error("Binary particle file has no radii",VOROPP_FILE_ERROR);
+	int i,n;
+	double x,y,z,r;
+	for(i=0;i<pf.n;i++) {pf.get(i,n,x,y,z,r);put(n,x,y,z,r);}
+}
+
+/** Imports a list of particles from a binary particle file into the container,
+ * also storing the order that the particles are read. If the file cannot be
+ * read or does not contain the particle radii, then the routine causes a fatal
+ * error.
+ * \param[in,out] vo a reference to an ordering class to use.
+ * \param[in] filename the name of the file to read. */
+void container_poly::import_binary(particle_order &vo,const char *filename) {
+	trace_scope ts("import");
+	particle_file pf(filename);
+	if(!pf.radii) voro_fatal_error("Binary particle file has no radii",VOROPP_FILE_ERROR);
+	int i,n;
 	double x,y,z,r;
-	while((j=fscanf(fp,"%d %lg %lg %lg %lg",&i,&x,&y,&z,&r))==5) put(vo,i,x,y,z,r);
-	if(j!=EOF) voro_fatal_error("File import error",VOROPP_FILE_ERROR);
+	for(i=0;i<pf.n;i++) {pf.get(i,n,x,y,z,r);put(vo,n,x,y,z,r);}
 }
 
 /** Outputs the a list of all the container regions along with the number of
@@ -383,59 +852,356 @@ void container_base::region_count() {
 		printf("Region (%d,%d,%d): %d particles\n",i,j,k,*(cop++));
 }
 
+/** Reorders the particles within each block along a Morton curve, and
+ * reallocates the memory of the blocks in the Morton order of the blocks. When
+ * the container is looped over with the c_loop_morton class, successive
+ * particles are then close to each other both in space and in memory. Since
+ * this changes the indices of the particles within the blocks, any
+ * particle_order classes that refer to the container are no longer valid. */
+void container_base::sort_morton() {
+	trace_scope ts("sort");
+	int b,ijk,i,j,k,l,n,c;
+	int *bo=new int[nxyz];
+	voro_id **nid=new voro_id*[nxyz];
+	fpoint **np=new fpoint*[nxyz],*pp,*qp;
+	std::vector<int> qc,ord;
+	morton_block_order(nx,ny,nz,bo);
+
+	// Allocate the new memory for each block in order along the curve,
+	// and copy in the particles in sorted order
+	for(b=0;b<nxyz;b++) {
+		ijk=bo[b];n=co[ijk];
+		k=ijk/nxy;j=(ijk-nxy*k)/nx;i=ijk-nxy*k-nx*j;
+		qc.resize(3*n);ord.resize(n);
+		for(l=0;l<n;l++) {
+			pp=p[ijk]+ps*l;
+			qc[3*l]=morton_quantize((*pp-ax)*xsp-i);
+			qc[3*l+1]=morton_quantize((pp[1]-ay)*ysp-j);
+			qc[3*l+2]=morton_quantize((pp[2]-az)*zsp-k);
+			ord[l]=l;
+		}
+		if(n>1) std::sort(ord.begin(),ord.end(),morton_particle_cmp(&qc[0]));
+		if(mem[ijk]==0) {nid[ijk]=NULL;np[ijk]=NULL;continue;}
+		nid[ijk]=new voro_id[mem[ijk]];
+		np[ijk]=new fpoint[ps*mem[ijk]];
+		for(l=0;l<n;l++) {
+			nid[ijk][l]=id[ijk][ord[l]];
+			pp=p[ijk]+ps*ord[l];qp=np[ijk]+ps*l;
+			for(c=0;c<ps;c++) qp[c]=pp[c];
+		}
+	}
+
+	// Free the old memory and switch to the new arrays
+	recount_slots(mem,nxyz,true);
+	for(l=0;l<nxyz;l++) {
+		delete [] p[l];p[l]=np[l];
+		delete [] id[l];id[l]=nid[l];
+	}
+	delete [] np;
+	delete [] nid;
+	delete [] bo;
+	update_count++;
+	if(indexed) rebuild_id_index();
+}
+
 /** Clears a container of particles. */
 void container::clear() {
 	for(int *cop=co;cop<co+nxyz;cop++) *cop=0;
+	update_count++;
+	idx.clear();
 }
 
 /** Clears a container of particles, also clearing resetting the maximum radius
  * to zero. */
 void container_poly::clear() {
 	for(int *cop=co;cop<co+nxyz;cop++) *cop=0;
+	update_count++;
 	max_radius=0;
+	idx.clear();
 }
 
 /** Computes all the Voronoi cells and saves customized information about them.
  * \param[in] format the custom output string to use.
- * \param[in] fp a file handle to write to. */
-void container::print_custom(const char *format,FILE *fp) {
-	c_loop_all vl(*this);
-	print_custom(vl,format,fp);
+ * \param[in] fp a file handle to write to.
+ * \param[in] nt the number of threads to use. If this is one, then the cells
+ *		are computed serially using the c_loop_all ordering. If this is
+ *		zero, then the OpenMP default number of threads is used. */
+void container::print_custom(const char *format,FILE *fp,int nt) {
+	trace_scope ts("print_custom");
+	nt=voro_threads(nt);
+	if(nt>1) {
+		if(contains_neighbor(format)) print_custom_threaded<voronoicell_neighbor>(format,fp,nt);
+		else print_custom_threaded<voronoicell>(format,fp,nt);
+	} else {
+		c_loop_all vl(*this);
+		print_custom(vl,format,fp);
+	}
 }
 
 /** Computes all the Voronoi cells and saves customized
  * information about them.
  * \param[in] format the custom output string to use.
- * \param[in] fp a file handle to write to. */
-void container_poly::print_custom(const char *format,FILE *fp) {
-	c_loop_all vl(*this);
-	print_custom(vl,format,fp);
+ * \param[in] fp a file handle to write to.
+ * \param[in] nt the number of threads to use. If this is one, then the cells
+ *		are computed serially using the c_loop_all ordering. If this is
+ *		zero, then the OpenMP default number of threads is used. */
+void container_poly::print_custom(const char *format,FILE *fp,int nt) {
+	trace_scope ts("print_custom");
+	nt=voro_threads(nt);
+	if(nt>1) {
+		if(contains_neighbor(format)) print_custom_threaded<voronoicell_neighbor>(format,fp,nt);
+		else print_custom_threaded<voronoicell>(format,fp,nt);
+	} else {
+		c_loop_all vl(*this);
+		print_custom(vl,format,fp);
+	}
 }
 
 /** Computes all the Voronoi cells and saves customized information about them.
  * \param[in] format the custom output string to use.
- * \param[in] filename the name of the file to write to. */
-void container::print_custom(const char *format,const char *filename) {
+ * \param[in] filename the name of the file to write to.
+ * \param[in] nt the number of threads to use. */
+void container::print_custom(const char *format,const char *filename,int nt) {
 	FILE *fp=safe_fopen(filename,"w");
-	print_custom(format,fp);
+	print_custom(format,fp,nt);
 	fclose(fp);
 }
+/** Computes all the Voronoi cells and saves statistics about them in a binary
+ * column file.
+ * \param[in] columns the string of column codes to use.
+ * \param[in] fp a file handle to write to.
+ * \param[in] nt the number of threads to use. If this is one, then the cells
+ *		are computed serially using the c_loop_all ordering. If this is
+ *		zero, then the OpenMP default number of threads is used. */
+void container::print_columns(const char *columns,FILE *fp,int nt) {
+	trace_scope ts("print_columns");
+	column_writer clw(columns);
+	clw.write_header(fp);
+	nt=voro_threads(nt);
+	if(nt>1) {
+		if(clw.neighbor()) print_columns_threaded<voronoicell_neighbor>(columns,fp,nt);
+		else print_columns_threaded<voronoicell>(columns,fp,nt);
+	} else {
+		c_loop_all vl(*this);
+		print_columns(vl,clw,fp);
+	}
+}
+
+/** Computes all the Voronoi cells and saves statistics about them in a binary
+ * column file.
+ * \param[in] columns the string of column codes to use.
+ * \param[in] filename the name of the file to write to.
+ * \param[in] nt the number of threads to use. */
+void container::print_columns(const char *columns,const char *filename,int nt) {
+	FILE *fp=safe_fopen(filename,"wb");
+	print_columns(columns,fp,nt);
+	if(fclose(fp)!=0) voro_fatal_error("File output error",VOROPP_FILE_ERROR);
+}
+
 
 /** Computes all the Voronoi cells and saves customized
  * information about them
  * \param[in] format the custom output string to use.
- * \param[in] filename the name of the file to write to. */
-void container_poly::print_custom(const char *format,const char *filename) {
+ * \param[in] filename the name of the file to write to.
+ * \param[in] nt the number of threads to use. */
+void container_poly::print_custom(const char *format,const char *filename,int nt) {
 	FILE *fp=safe_fopen(filename,"w");
-	print_custom(format,fp);
+	print_custom(format,fp,nt);
 	fclose(fp);
 }
+/** Computes all the Voronoi cells and saves statistics about them in a binary
+ * column file.
+ * \param[in] columns the string of column codes to use.
+ * \param[in] fp a file handle to write to.
+ * \param[in] nt the number of threads to use. If this is one, then the cells
+ *		are computed serially using the c_loop_all ordering. If this is
+ *		zero, then the OpenMP default number of threads is used. */
+void container_poly::print_columns(const char *columns,FILE *fp,int nt) {
+	trace_scope ts("print_columns");
+	column_writer clw(columns);
+	clw.write_header(fp);
+	nt=voro_threads(nt);
+	if(nt>1) {
+		if(clw.neighbor()) print_columns_threaded<voronoicell_neighbor>(columns,fp,nt);
+		else print_columns_threaded<voronoicell>(columns,fp,nt);
+	} else {
+		c_loop_all vl(*this);
+		print_columns(vl,clw,fp);
+	}
+}
+
+/** Computes all the Voronoi cells and saves statistics about them in a binary
+ * column file.
+ * \param[in] columns the string of column codes to use.
+ * \param[in] filename the name of the file to write to.
+ * \param[in] nt the number of threads to use. */
+void container_poly::print_columns(const char *columns,const char *filename,int nt) {
+	FILE *fp=safe_fopen(filename,"wb");
+	print_columns(columns,fp,nt);
+	if(fclose(fp)!=0) voro_fatal_error("File output error",VOROPP_FILE_ERROR);
+}
+
+
+/** Computes all the Voronoi cells using several threads, and saves customized
+ * information about them. The blocks of the container are shared out among
+ * the threads by a block_scheduler, and each thread has its own voro_compute
+ * class and Voronoi cell. Each chunk of blocks is written into its own memory
+ * buffer, and a chunk_writer flushes these to the file in block order, so the
+ * output is identical to the serial routine.
+ * \param[in] format the custom output string to use.
+ * \param[in] fp a file handle to write to.
+ * \param[in] nt the number of threads to use. */
+template<class v_cell>
+void container::print_custom_threaded(const char *format,FILE *fp,int nt) {
+#ifdef _OPENMP
+	block_scheduler bs(*this,nt);
+	chunk_writer cw(fp,bs.nc);
+#pragma omp parallel num_threads(nt) VOROPP_BIND
+	{
+		v_cell c(*this);
+		voro_compute<container> vcl(*this,vc.hx,vc.hy,vc.hz);
+		c_loop_parallel vl(*this,bs,omp_get_thread_num());
+		compiled_format fm(format);
+		fpoint *pp;FILE *cfp;
+		while(vl.start_chunk()) {
+			cfp=cw.open(vl.chunk);
+			do if(compute_cell(c,vl,vcl)) {
+				pp=p[vl.ijk]+ps*vl.q;
+				fm.write(c,id[vl.ijk][vl.q],*pp,pp[1],pp[2],default_radius,cfp);
+			} while(vl.inc_chunk());
+			cw.close(vl.chunk);
+		}
+	}
+#endif
+}
+
+/** Computes all the Voronoi cells using several threads, and saves statistics
+ * about them in a binary column file. The blocks of the container are shared
+ * out among the threads by a block_scheduler, and each thread has its own
+ * voro_compute class, Voronoi cell, and column writer. The cells of each chunk
+ * of blocks are written as one or more column chunks into a memory buffer, and
+ * a chunk_writer flushes these to the file in block order.
+ * \param[in] columns the string of column codes to use.
+ * \param[in] fp a file handle to write to.
+ * \param[in] nt the number of threads to use. */
+template<class v_cell>
+void container::print_columns_threaded(const char *columns,FILE *fp,int nt) {
+#ifdef _OPENMP
+	block_scheduler bs(*this,nt);
+	chunk_writer cw(fp,bs.nc);
+#pragma omp parallel num_threads(nt) VOROPP_BIND
+	{
+		v_cell c(*this);
+		voro_compute<container> vcl(*this,vc.hx,vc.hy,vc.hz);
+		c_loop_parallel vl(*this,bs,omp_get_thread_num());
+		column_writer clw(columns);
+		fpoint *pp;FILE *cfp;
+		while(vl.start_chunk()) {
+			cfp=cw.open(vl.chunk);
+			do if(compute_cell(c,vl,vcl)) {
+				pp=p[vl.ijk]+ps*vl.q;
+				clw.add(c,id[vl.ijk][vl.q],*pp,pp[1],pp[2],default_radius);
+				if(clw.full()) clw.write_chunk(cfp);
+			} while(vl.inc_chunk());
+			clw.write_chunk(cfp);
+			cw.close(vl.chunk);
+		}
+	}
+#endif
+}
+
+/** Computes all the Voronoi cells using several threads, and saves customized
+ * information about them. The blocks of the container are shared out among
+ * the threads by a block_scheduler, and each thread has its own voro_compute
+ * class and Voronoi cell. Each chunk of blocks is written into its own memory
+ * buffer, and a chunk_writer flushes these to the file in block order, so the
+ * output is identical to the serial routine.
+ * \param[in] format the custom output string to use.
+ * \param[in] fp a file handle to write to.
+ * \param[in] nt the number of threads to use. */
+template<class v_cell>
+void container_poly::print_custom_threaded(const char *format,FILE *fp,int nt) {
+#ifdef _OPENMP
+	block_scheduler bs(*this,nt);
+	chunk_writer cw(fp,bs.nc);
+#pragma omp parallel num_threads(nt) VOROPP_BIND
+	{
+		v_cell c(*this);
+		voro_compute<container_poly> vcl(*this,vc.hx,vc.hy,vc.hz);
+		c_loop_parallel vl(*this,bs,omp_get_thread_num());
+		compiled_format fm(format);
+		fpoint *pp;FILE *cfp;
+		while(vl.start_chunk()) {
+			cfp=cw.open(vl.chunk);
+			do if(compute_cell(c,vl,vcl)) {
+				pp=p[vl.ijk]+ps*vl.q;
+				fm.write(c,id[vl.ijk][vl.q],*pp,pp[1],pp[2],pp[3],cfp);
+			} while(vl.inc_chunk());
+			cw.close(vl.chunk);
+		}
+	}
+#endif
+}
+
+/** Computes all the Voronoi cells using several threads, and saves statistics
+ * about them in a binary column file. The blocks of the container are shared
+ * out among the threads by a block_scheduler, and each thread has its own
+ * voro_compute class, Voronoi cell, and column writer. The cells of each chunk
+ * of blocks are written as one or more column chunks into a memory buffer, and
+ * a chunk_writer flushes these to the file in block order.
+ * \param[in] columns the string of column codes to use.
+ * \param[in] fp a file handle to write to.
+ * \param[in] nt the number of threads to use. */
+template<class v_cell>
+void container_poly::print_columns_threaded(const char *columns,FILE *fp,int nt) {
+#ifdef _OPENMP
+	block_scheduler bs(*this,nt);
+	chunk_writer cw(fp,bs.nc);
+#pragma omp parallel num_threads(nt) VOROPP_BIND
+	{
+		v_cell c(*this);
+		voro_compute<container_poly> vcl(*this,vc.hx,vc.hy,vc.hz);
+		c_loop_parallel vl(*this,bs,omp_get_thread_num());
+		column_writer clw(columns);
+		fpoint *pp;FILE *cfp;
+		while(vl.start_chunk()) {
+			cfp=cw.open(vl.chunk);
+			do if(compute_cell(c,vl,vcl)) {
+				pp=p[vl.ijk]+ps*vl.q;
+				clw.add(c,id[vl.ijk][vl.q],*pp,pp[1],pp[2],pp[3]);
+				if(clw.full()) clw.write_chunk(cfp);
+			} while(vl.inc_chunk());
+			clw.write_chunk(cfp);
+			cw.close(vl.chunk);
+		}
+	}
+#endif
+}
 
 /** Computes all of the Voronoi cells in the container, but does nothing
  * with the output. It is useful for measuring the pure computation time
  * of the Voronoi algorithm, without any additional calculations such as
- * volume evaluation or cell output. */
-void container::compute_all_cells() {
+ * volume evaluation or cell output.
+ * \param[in] nt the number of threads to use. If this is more than one,
+ *		then the blocks of the container are shared out among the
+ *		threads by a block_scheduler, and each thread has its own
+ *		voro_compute class and Voronoi cell. */
+void container::compute_all_cells(int nt) {
+	trace_scope ts("compute_all_cells");
+	nt=voro_threads(nt);
+#ifdef _OPENMP
+	if(nt>1) {
+		block_scheduler bs(*this,nt);
+#pragma omp parallel num_threads(nt) VOROPP_BIND
+		{
+			voronoicell c(*this);
+			voro_compute<container> vcl(*this,vc.hx,vc.hy,vc.hz);
+			c_loop_parallel vl(*this,bs,omp_get_thread_num());
+			if(vl.start()) do compute_cell(c,vl,vcl);while(vl.inc());
+		}
+		return;
+	}
+#endif
 	voronoicell c(*this);
 	c_loop_all vl(*this);
 	if(vl.start()) do compute_cell(c,vl);
@@ -445,8 +1211,27 @@ void container::compute_all_cells() {
 /** Computes all of the Voronoi cells in the container, but does nothing
  * with the output. It is useful for measuring the pure computation time
  * of the Voronoi algorithm, without any additional calculations such as
- * volume evaluation or cell output. */
-void container_poly::compute_all_cells() {
+ * volume evaluation or cell output.
+ * \param[in] nt the number of threads to use. If this is more than one,
+ *		then the blocks of the container are shared out among the
+ *		threads by a block_scheduler, and each thread has its own
+ *		voro_compute class and Voronoi cell. */
+void container_poly::compute_all_cells(int nt) {
+	trace_scope ts("compute_all_cells");
+	nt=voro_threads(nt);
+#ifdef _OPENMP
+	if(nt>1) {
+		block_scheduler bs(*this,nt);
+#pragma omp parallel num_threads(nt) VOROPP_BIND
+		{
+			voronoicell c(*this);
+			voro_compute<container_poly> vcl(*this,vc.hx,vc.hy,vc.hz);
+			c_loop_parallel vl(*this,bs,omp_get_thread_num());
+			if(vl.start()) do compute_cell(c,vl,vcl);while(vl.inc());
+		}
+		return;
+	}
+#endif
 	voronoicell c(*this);
 	c_loop_all vl(*this);
 	if(vl.start()) do compute_cell(c,vl);while(vl.inc());
@@ -486,6 +1271,25 @@ bool container_base::point_inside(double x,double y,double z) {
 	return point_inside_walls(x,y,z);
 }
 
+/** This function tests to see if a batch of vectors lie within the container
+ * bounds and any walls, which is faster than calling point_inside() for each
+ * one when prefiltering a large number of candidate particles. The vectors are
+ * processed in chunks that stay in the cache while each wall is applied.
+ * \param[in] n the number of vectors.
+ * \param[in] pp an array of the vectors to be tested, in groups of three.
+ * \param[out] m a mask that is set to one for the vectors that are inside the
+ *		 container, and zero for the others. */
+void container_base::points_inside(int n,const double *pp,unsigned char *m) {
+	for(int i=0;i<n;i+=points_inside_chunk,pp+=3*points_inside_chunk,m+=points_inside_chunk) {
+		int j,l=n-i<points_inside_chunk?n-i:points_inside_chunk;
+		for(j=0;j<l;j++) {
+			const double *q=pp+3*j;
+			m[j]=(*q>=ax)&(*q<=bx)&(q[1]>=ay)&(q[1]<=by)&(q[2]>=az)&(q[2]<=bz);
+		}
+		points_inside_walls(l,pp,m);
+	}
+}
+
 /** Draws an outline of the domain in gnuplot format.
  * \param[in] fp the file handle to write to. */
 void container_base::draw_domain_gnuplot(FILE *fp) {
@@ -518,12 +1322,47 @@ void container_base::draw_domain_pov(FILE *fp) {
 
 /** The wall_list constructor sets up an array of pointers to wall classes. */
 wall_list::wall_list() : walls(new wall*[init_wall_size]), wep(walls), wel(walls+init_wall_size),
-	current_wall_size(init_wall_size) {}
+	current_wall_size(init_wall_size), wnx(0), wny(0), wnz(0), wg(NULL) {}
 
 /** The wall_list destructor frees the array of pointers to the wall classes.
  */
 wall_list::~wall_list() {
 	delete [] walls;
+	delete [] wg;
+}
+
+/** Sets up the grid that is used to index the walls with a bounding box. This
+ * is called by the container classes to align the grid with their blocks.
+ * \param[in] (ax,bx) the x range of the grid.
+ * \param[in] (ay,by) the y range of the grid.
+ * \param[in] (az,bz) the z range of the grid.
+ * \param[in] (nx,ny,nz) the number of blocks in each direction. */
+void wall_list::set_wall_grid(double ax,double bx,double ay,double by,double az,double bz,int nx,int ny,int nz) {
+	wax=ax;way=ay;waz=az;
+	wxsp=nx/(bx-ax);wysp=ny/(by-ay);wzsp=nz/(bz-az);
+	wnx=nx;wny=ny;wnz=nz;
+}
+
+/** Adds a wall to the spatial index. If the wall has a bounding box and a grid
+ * has been set up, then the wall is stored in every block of the grid that its
+ * bounding box overlaps. Otherwise it is stored on the list of walls that are
+ * applied to every cell. A wall that makes further cuts to a finished cell is
+ * also stored on a separate list.
+ * \param[in] w the wall to add. */
+void wall_list::index_wall(wall *w) {
+	double xl,xh,yl,yh,zl,zh;
+	if(w->finishes()) wf.push_back(w);
+	if(wnx==0||!w->bounds(xl,xh,yl,yh,zl,zh)) {wu.push_back(w);return;}
+	if(wg==NULL) wg=new std::vector<int>[wnx*wny*wnz];
+	int n=wbw.size(),i0=wall_coord(xl-wax,wxsp,wnx),i1=wall_coord(xh-wax,wxsp,wnx),
+	    j0=wall_coord(yl-way,wysp,wny),j1=wall_coord(yh-way,wysp,wny),
+	    k0=wall_coord(zl-waz,wzsp,wnz),k1=wall_coord(zh-waz,wzsp,wnz),i,j,k;
+	wbw.push_back(w);
+	wr.push_back(i0);wr.push_back(i1);
+	wr.push_back(j0);wr.push_back(j1);
+	wr.push_back(k0);wr.push_back(k1);
+	for(k=k0;k<=k1;k++) for(j=j0;j<=j1;j++) for(i=i0;i<=i1;i++)
+		wg[i+wnx*(j+wny*k)].push_back(n);
 }
 
 /** Adds all of the walls on another wall_list to this class.
@@ -532,6 +1371,19 @@ void wall_list::add_wall(wall_list &wl) {
 	for(wall **wp=wl.walls;wp<wl.wep;wp++) add_wall(*wp);
 }
 
+/** Exchanges the walls on this list with those on another one, along with
+ * their spatial indices. The wall classes themselves are not copied.
+ * \param[in] wl a reference to the wall list to exchange with. */
+void wall_list::swap_walls(wall_list &wl) {
+	std::swap(walls,wl.walls);std::swap(wep,wl.wep);std::swap(wel,wl.wel);
+	std::swap(current_wall_size,wl.current_wall_size);
+	std::swap(wax,wl.wax);std::swap(way,wl.way);std::swap(waz,wl.waz);
+	std::swap(wxsp,wl.wxsp);std::swap(wysp,wl.wysp);std::swap(wzsp,wl.wzsp);
+	std::swap(wnx,wl.wnx);std::swap(wny,wl.wny);std::swap(wnz,wl.wnz);
+	wu.swap(wl.wu);wbw.swap(wl.wbw);wf.swap(wl.wf);wr.swap(wl.wr);
+	std::swap(wg,wl.wg);
+}
+
 /** Deallocates all of the wall classes pointed to by the wall_list. */
 void wall_list::deallocate() {
 	for(wall **wp=walls;wp<wep;wp++) delete *wp;
@@ -548,4 +1400,355 @@ void wall_list::increase_wall_memory() {
 	walls=nwalls;wel=walls+current_wall_size;wep=nwp;
 }
 
+/** Puts a large number of particles into the container at once. The block
+ * that each particle belongs to is found and the number of new particles in
+ * each block is counted. The memory for each block is then extended exactly
+ * once to the size that is needed, and the particles are copied into the
+ * blocks in order, so that they are stored in the same way as if they had been
+ * added one at a time with put(). Any particles outside the container are
+ * skipped.
+ * \param[in] n the number of particles.
+ * \param[in] pid an array of the particle IDs.
+ * \param[in] pp an array of the particle positions, with ps entries per
+ *		 particle. For the container_poly class, the fourth entry is
+ *		 the radius.
+ * \param[in] nt the number of threads to use. If this is more than one, then
+ *		the put_chunked() routine is used.
+ * \param[in] vo an ordering class in which to record where the particles were
+ *		 stored, or NULL if this is not needed. */
+void container_base::put_bulk(voro_id n,const voro_id *pid,const double *pp,int nt,particle_order *vo) {
+	if(n<=0) return;
+#ifdef _OPENMP
+	nt=voro_threads(nt);
+	if(nt>1) {
+		voro_id *ip=const_cast<voro_id*>(pid);
+		double *dp=const_cast<double*>(pp);
+		put_chunked(n,&ip,&dp,n,nt,vo);
+		return;
+	}
+#endif
+	int *bi=new int[n],*cnt=new int[nxyz],ijk,c;
+	voro_id l;
+	double x,y,z;
+	const double *p2;fpoint *p1;
+	update_count++;
+
+	// Find the block for each particle, and count the number of new
+	// particles in each block
+	for(ijk=0;ijk<nxyz;ijk++) cnt[ijk]=0;
+	for(l=0,p2=pp;l<n;l++,p2+=ps) {
+		x=*p2;y=p2[1];z=p2[2];
+		if(put_remap(bi[l],x,y,z)) cnt[bi[l]]++;
+		else {
+			bi[l]=-1;
+#if VOROPP_REPORT_OUT_OF_BOUNDS ==1
+			fprintf(stderr,"Out of bounds: (x,y,z)=(%g,%g,%g)\n",x,y,z);
+#endif
+		}
+	}
+
+	// Extend the memory of each block exactly once
+	for(ijk=0;ijk<nxyz;ijk++) if(co[ijk]+cnt[ijk]>mem[ijk]) add_particle_memory(ijk,co[ijk]+cnt[ijk]);
+
+	// Copy in the particle IDs and positions
+	for(l=0,p2=pp;l<n;l++,p2+=ps) if((ijk=bi[l])>=0) {
+		x=*p2;y=p2[1];z=p2[2];
+		put_remap(c,x,y,z);
+		if(vo!=NULL) vo->add(ijk,co[ijk]);
+		index_particle(pid[l],ijk,co[ijk]);
+		id[ijk][co[ijk]]=pid[l];
+		p1=p[ijk]+ps*co[ijk]++;
+		*p1=x;p1[1]=y;p1[2]=z;
+		for(c=3;c<ps;c++) p1[c]=p2[c];
+	}
+	delete [] cnt;
+	delete [] bi;
+}
+
+/** Puts a large number of particles into the container at once, and updates
+ * the maximum particle radius.
+ * \param[in] n the number of particles.
+ * \param[in] pid an array of the particle IDs.
+ * \param[in] pp an array of the particle positions and radii, in groups of
+ *		 four.
+ * \param[in] nt the number of threads to use.
+ * \param[in] vo an ordering class in which to record where the particles were
+ *		 stored, or NULL if this is not needed. */
+void container_poly::put_bulk(voro_id n,const voro_id *pid,const double *pp,int nt,particle_order *vo) {
+	container_base::put_bulk(n,pid,pp,nt,vo);
+	int ijk;double x,y,z;
+	for(const double *pe=pp+4*n;pp<pe;pp+=4) if(max_radius<pp[3]) {
+		x=*pp;y=pp[1];z=pp[2];
+		if(put_remap(ijk,x,y,z)) max_radius=pp[3];
+	}
+}
+
+/** Releases the memory that is allocated for each block beyond what is needed
+ * for the particles that it holds. Since the memory of the blocks is doubled
+ * whenever it fills up, up to half of it can be unused after the particles
+ * have been added. The memory of empty blocks is released entirely, and is
+ * allocated again if a particle is added to them. */
+void container_base::shrink_particle_memory() {
+	for(int ijk=0;ijk<nxyz;ijk++)
+		if(mem[ijk]>co[ijk]) add_particle_memory(ijk,co[ijk]);
+}
+
+/** Moves the particle memory of each block to the thread that computes its
+ * cells, for machines with non-uniform memory access. The blocks are shared
+ * out with a block_scheduler, in the same way as in the parallel routines, and
+ * each thread reallocates the memory of the blocks in its own range, so that
+ * the operating system's first-touch policy places it on that thread's memory
+ * node. This should be called after all of the particles have been added,
+ * with the same number of threads as the parallel routines that follow. The
+ * threads only stay on the same memory nodes between parallel regions if they
+ * are bound to processors, by setting VOROPP_NUMA to 1 or with the
+ * OMP_PROC_BIND environment variable. The amount of memory is not changed,
+ * and the routine has no effect if the code is compiled without OpenMP.
+ * \param[in] nt the number of threads to use, or zero to use the OpenMP
+ *		default. */
+void container_base::place_particle_memory(int nt) {
+#ifdef _OPENMP
+	nt=voro_threads(nt);
+	block_scheduler bs(*this,nt);
+#pragma omp parallel num_threads(nt) VOROPP_BIND
+	{
+		int b0,b1,i,l;
+		voro_id *idp;fpoint *pp;
+		bs.thread_range(omp_get_thread_num(),b0,b1);
+		for(;b0<b1;b0++) {
+			i=bs.bl[b0];
+			idp=new voro_id[mem[i]];
+			for(l=0;l<co[i];l++) idp[l]=id[i][l];
+			pp=new fpoint[ps*mem[i]];
+			for(l=0;l<ps*co[i];l++) pp[l]=p[i][l];
+			delete [] id[i];id[i]=idp;
+			delete [] p[i];p[i]=pp;
+		}
+	}
+#endif
+}
+
+/** Reports the memory that is currently allocated by the container, and the
+ * peak amount since it was created. The memory of any walls is not included.
+ * \return A class holding the number of bytes in each data structure. */
+voro_memory container_base::memory_usage() {
+	voro_memory vm;
+	size_t ss=sizeof(int)+ps*sizeof(fpoint);
+	vm.particles=slots*ss;
+	vm.blocks=nxyz*(sizeof(int*)+sizeof(fpoint*)+2*sizeof(int))+chf.capacity();
+	vm.worklists=worklist_memory();
+	vm.index=idx.capacity()*sizeof(int);
+	vm.peak=vm.total()+(peak_slots-slots)*ss;
+	return vm;
+}
+
+/** Exchanges the particles of this container with another one that has the
+ * same geometry and block structure, without copying them. The particle
+ * memory of each pair of corresponding blocks is swapped, so that the
+ * voro_compute classes of both containers remain valid, and the cost is
+ * proportional to the number of blocks rather than the number of particles.
+ * The particle ID indices and the walls are also exchanged, so that each
+ * container computes the same cells as the other did before.
+ * \param[in] c the container to exchange with. */
+void container_base::swap(container_base &c) {
+	if(nx!=c.nx||ny!=c.ny||nz!=c.nz||ps!=c.ps||ax!=c.ax||bx!=c.bx||ay!=c.ay||by!=c.by||az!=c.az||bz!=c.bz
+	 ||xperiodic!=c.xperiodic||yperiodic!=c.yperiodic||zperiodic!=c.zperiodic)
+		voro_fatal_error("Swapping containers with different geometries",VOROPP_INTERNAL_ERROR);
+	for(int l=0;l<nxyz;l++) {
+		std::swap(id[l],c.id[l]);std::swap(p[l],c.p[l]);
+		std::swap(co[l],c.co[l]);std::swap(mem[l],c.mem[l]);
+	}
+	std::swap(slots,c.slots);std::swap(peak_slots,c.peak_slots);
+	std::swap(indexed,c.indexed);idx.swap(c.idx);
+	swap_walls(c);
+	update_count++;c.update_count++;
+}
+
+/** Estimates the memory that a container will use, before it is created, so
+ * that the size of a job can be planned. The particles are assumed to be
+ * distributed uniformly at random, so that the number in each block follows a
+ * Poisson distribution, and the expected memory of each block is found from
+ * the doubling rule that add_particle_memory() uses. Clustered particles need
+ * more memory than this, since more of the blocks are near to full. The
+ * initial memory of one voronoicell_neighbor class is included for each
+ * thread. The peak is the same as the total, apart from the brief doubling of
+ * the particle memory during sort_morton().
+ * \param[in] n the number of particles.
+ * \param[in] (nx_,ny_,nz_) the number of blocks in each direction.
+ * \param[in] ps_ the number of floating point entries stored for each
+ *		  particle, which is 3 for the container class and 4 for the
+ *		  container_poly class.
+ * \param[in] init_mem_ the initial memory allocation for each block.
+ * \param[in] nt the number of threads that will compute cells.
+ * \return A class holding the estimated number of bytes in each data
+ *	   structure. */
+voro_memory container_base::estimate_memory(int n,int nx_,int ny_,int nz_,int ps_,int init_mem_,int nt) {
+	voro_memory vm;
+	double nb=double(nx_)*ny_*nz_,m=n/nb,lm=log(m),lp=-m,ec=0;
+	int c,cap=init_mem_,ce=int(m+10*sqrt(m))+10;
+
+	// Sum the expected capacity of a block over the Poisson distribution
+	// of the number of particles in it, with the probabilities computed
+	// in logarithmic form so that they do not underflow for large m
+	if(m>0) for(c=1;c<=ce;c++) {
+		lp+=lm-log(double(c));
+		while(cap<c) cap<<=1;
+		ec+=exp(lp)*cap;
+	}
+	vm.particles=size_t(nb*ec*(sizeof(int)+ps_*sizeof(fpoint)));
+	vm.blocks=size_t(nb*(sizeof(int*)+sizeof(fpoint*)+2*sizeof(int)));
+	vm.worklists=wl_hgridcu*wl_seq_length*sizeof(double);
+	voronoicell_neighbor vc(1);
+	vm.cells=nt*vc.memory_used();
+	vm.peak=vm.total();
+	return vm;
+}
+
+/** Starts maintaining an index from the particle IDs to the locations where the
+ * particles are stored, so that particles can be found by their ID without
+ * searching the blocks. The index is built from the particles that are
+ * currently stored, and it is then kept up to date by the routines that add,
+ * remove, and rearrange particles. The index has two entries for every ID up
+ * to the largest one, so the IDs should be non-negative and reasonably
+ * compact. If several particles have the same ID, then the index refers to
+ * the one that was added last. */
+void container_base::enable_id_index() {
+	indexed=true;
+	rebuild_id_index();
+}
+
+/** Builds the particle ID index from the particles that are currently
+ * stored. */
+void container_base::rebuild_id_index() {
+	idx.clear();
+	for(int ijk=0;ijk<nxyz;ijk++) for(int q=0;q<co[ijk];q++) index_particle(id[ijk][q],ijk,q);
+}
+
+/** Finds where the particle with a given ID is stored. If the particle ID
+ * index has been enabled, then this takes constant time, and otherwise the
+ * blocks are searched in order.
+ * \param[in] n the ID of the particle.
+ * \param[out] (ijk,q) the block and the index within the block of the
+ *		       particle.
+ * \return True if the particle was found, false otherwise. */
+bool container_base::find_particle(voro_id n,int &ijk,int &q) {
+	if(indexed) {
+		if(n<0||2*n>=voro_id(idx.size())||idx[2*n]<0) return false;
+		ijk=idx[2*n];q=idx[2*n+1];
+		return true;
+	}
+	for(ijk=0;ijk<nxyz;ijk++) for(q=0;q<co[ijk];q++) if(id[ijk][q]==n) return true;
+	return false;
+}
+
+#ifdef _OPENMP
+/** Puts a large number of particles into the container at once using several
+ * threads. In a first pass, the block that each particle belongs to is found
+ * and the number of new particles for each block is counted. The memory for
+ * each block is then extended exactly once, and the particles are scattered
+ * into the blocks in parallel. The particles within each block are finally
+ * sorted so that they appear in the same order as if they had been added one
+ * at a time with put().
+ * \param[in] np the number of particles.
+ * \param[in] pid an array of pointers to chunks of particle IDs.
+ * \param[in] pp an array of pointers to chunks of particle positions, with ps
+ *		 entries per particle.
+ * \param[in] csz the number of particles in each chunk.
+ * \param[in] nt the number of threads to use.
+ * \param[in] vo an ordering class in which to record where the particles were
+ *		 stored, or NULL if this is not needed. */
+void container_base::put_chunked(voro_id np,voro_id **pid,double **pp,voro_id csz,int nt,particle_order *vo) {
+	int *bi=new int[np],*sl=vo==NULL?NULL:new int[np],*cnt=new int[nxyz];
+	int ijk,q,c;voro_id l;
+	double x,y,z,*p2;fpoint *p1;
+	update_count++;
+
+	// Find the block for each particle, and count the number of new
+	// particles in each block
+#pragma omp parallel num_threads(nt) private(ijk,l,x,y,z,p2)
+	{
+#pragma omp for
+		for(ijk=0;ijk<nxyz;ijk++) cnt[ijk]=0;
+#pragma omp for
+		for(l=0;l<np;l++) {
+			p2=pp[l/csz]+ps*(l%csz);x=*p2;y=p2[1];z=p2[2];
+			if(put_remap(bi[l],x,y,z)) {
+#pragma omp atomic
+				cnt[bi[l]]++;
+			} else {
+				bi[l]=-1;
+#if VOROPP_REPORT_OUT_OF_BOUNDS ==1
+				fprintf(stderr,"Out of bounds: (x,y,z)=(%g,%g,%g)\n",x,y,z);
+#endif
+			}
+		}
+
+		// Allocate memory for each block exactly once, and set up the
+		// counters for the scatter pass
+#pragma omp for schedule(dynamic,64)
+		for(ijk=0;ijk<nxyz;ijk++) {
+			if(co[ijk]+cnt[ijk]>mem[ijk]) add_particle_memory(ijk,co[ijk]+cnt[ijk]);
+			cnt[ijk]=co[ijk];
+		}
+	}
+
+	// Scatter the particle indices into the blocks
+#pragma omp parallel for num_threads(nt) private(ijk,c)
+	for(l=0;l<np;l++) if((ijk=bi[l])>=0) {
+#pragma omp atomic capture
+		c=cnt[ijk]++;
+		id[ijk][c]=l;
+	}
+
+	// Sort the new entries in each block into their original order, and
+	// then copy in the particle IDs and positions
+#pragma omp parallel for num_threads(nt) private(l,q,c,x,y,z,p1,p2) schedule(dynamic,64)
+	for(ijk=0;ijk<nxyz;ijk++) {
+		for(q=co[ijk]+1;q<cnt[ijk];q++) {
+			l=id[ijk][q];
+			for(c=q;c>co[ijk]&&id[ijk][c-1]>l;c--) id[ijk][c]=id[ijk][c-1];
+			id[ijk][c]=l;
+		}
+		for(q=co[ijk];q<cnt[ijk];q++) {
+			l=id[ijk][q];
+			p2=pp[l/csz]+ps*(l%csz);x=*p2;y=p2[1];z=p2[2];
+			put_remap(c,x,y,z);
+			p1=p[ijk]+ps*q;
+			*p1=x;p1[1]=y;p1[2]=z;
+			for(c=3;c<ps;c++) p1[c]=p2[c];
+			id[ijk][q]=pid[l/csz][l%csz];
+			if(sl!=NULL) sl[l]=q;
+		}
+		co[ijk]=cnt[ijk];
+	}
+
+	// Record the storage locations in the original order, if requested
+	if(vo!=NULL) {
+		for(l=0;l<np;l++) if(bi[l]>=0) vo->add(bi[l],sl[l]);
+		delete [] sl;
+	}
+	if(indexed) rebuild_id_index();
+	delete [] cnt;
+	delete [] bi;
+}
+
+/** Puts a large number of particles into the container at once using several
+ * threads, and updates the maximum particle radius.
+ * \param[in] np the number of particles.
+ * \param[in] pid an array of pointers to chunks of particle IDs.
+ * \param[in] pp an array of pointers to chunks of particle positions and
+ *		 radii.
+ * \param[in] csz the number of particles in each chunk.
+ * \param[in] nt the number of threads to use.
+ * \param[in] vo an ordering class in which to record where the particles were
+ *		 stored, or NULL if this is not needed. */
+void container_poly::put_chunked(voro_id np,voro_id **pid,double **pp,voro_id csz,int nt,particle_order *vo) {
+	container_base::put_chunked(np,pid,pp,csz,nt,vo);
+	double mr=max_radius;int ijk,q;
+#pragma omp parallel for num_threads(nt) private(q) reduction(max:mr)
+	for(ijk=0;ijk<nxyz;ijk++) for(q=0;q<co[ijk];q++) if(mr<p[ijk][4*q+3]) mr=p[ijk][4*q+3];
+	max_radius=mr;
+}
+#endif
+
 }
@@ -11,15 +11,19 @@
 #define VOROPP_CONTAINER_HH
 
 #include <cstdio>
+#include <cmath>
 #include <vector>
 
 #include "config.hh"
 #include "common.hh"
 #include "v_base.hh"
 #include "cell.hh"
+#include "format.hh"
+#include "column_writer.hh"
 #include "c_loops.hh"
 #include "v_compute.hh"
 #include "rad_option.hh"
+#include "trace.hh"
 
 namespace voro {
 
@@ -34,12 +38,49 @@ class wall {
 		/** A pure virtual function for testing whether a point is
 		 * inside the wall object. */
 		virtual bool point_inside(double x,double y,double z) = 0;
+		/** Tests whether a batch of points are inside the wall object,
+		 * clearing the entries of a mask for those that are outside.
+		 * Entries that are already clear are left unchanged. Derived
+		 * classes can override this with a loop that avoids calling
+		 * point_inside() for each point.
+		 * \param[in] n the number of points.
+		 * \param[in] pp an array of the point coordinates, in groups
+		 *		  of three.
+		 * \param[in,out] m the mask, with one entry per point. */
+		virtual void points_inside(int n,const double *pp,unsigned char *m) {
+			for(int i=0;i<n;i++,pp+=3) if(m[i]&&!point_inside(*pp,pp[1],pp[2])) m[i]=0;
+		}
 		/** A pure virtual function for cutting a cell without
 		 * neighbor-tracking with a wall. */
 		virtual bool cut_cell(voronoicell &c,double x,double y,double z) = 0;
 		/** A pure virtual function for cutting a cell with
 		 * neighbor-tracking enabled with a wall. */
 		virtual bool cut_cell(voronoicell_neighbor &c,double x,double y,double z) = 0;
+		/** Returns a bounding box for the wall, which must be such
+		 * that the wall doesn't alter any cell lying entirely outside
+		 * it. Walls with a bounding box are stored in a spatial index
+		 * by the containers, so that each cell is only cut by the
+		 * walls that are near to it. By default, a wall has no
+		 * bounding box and is applied to every cell.
+		 * \param[out] (xl,xh) the x range of the bounding box.
+		 * \param[out] (yl,yh) the y range of the bounding box.
+		 * \param[out] (zl,zh) the z range of the bounding box.
+		 * \return True if the wall has a bounding box, false
+		 * otherwise. */
+		virtual bool bounds(double &xl,double &xh,double &yl,double &yh,double &zl,double &zh) {return false;}
+		/** Returns whether the wall makes further cuts to a cell once
+		 * it has been cut by the particles, using the finish_cell()
+		 * functions. By default, a wall makes all of its cuts when the
+		 * cell is initialized.
+		 * \return True if the wall has further cuts to make, false
+		 * otherwise. */
+		virtual bool finishes() {return false;}
+		/** Makes any further cuts to a cell without neighbor tracking,
+		 * once it has been cut by the particles. */
+		virtual bool finish_cell(voronoicell &c,double x,double y,double z) {return true;}
+		/** Makes any further cuts to a cell with neighbor tracking,
+		 * once it has been cut by the particles. */
+		virtual bool finish_cell(voronoicell_neighbor &c,double x,double y,double z) {return true;}
 };
 
 /** \brief A class for storing a list of pointers to walls.
@@ -63,11 +104,13 @@ class wall_list {
 		inline void add_wall(wall *w) {
 			if(wep==wel) increase_wall_memory();
 			*(wep++)=w;
+			index_wall(w);
 		}
 		/** Adds a wall to the list.
 		 * \param[in] w a reference to the wall to add. */
 		inline void add_wall(wall &w) {add_wall(&w);}
 		void add_wall(wall_list &wl);
+		void swap_walls(wall_list &wl);
 		/** Determines whether a given position is inside all of the
 		 * walls on the list.
 		 * \param[in] (x,y,z) the position to test.
@@ -76,25 +119,166 @@ class wall_list {
 			for(wall **wp=walls;wp<wep;wp++) if(!((*wp)->point_inside(x,y,z))) return false;
 			return true;
 		}
+		/** Tests whether a batch of points are inside all of the
+		 * walls on the list, clearing the entries of a mask for those
+		 * that are outside. The points are passed to the walls in
+		 * chunks that fit in the cache, so that each wall makes one
+		 * call per chunk.
+		 * \param[in] n the number of points.
+		 * \param[in] pp an array of the point coordinates, in groups
+		 *		  of three.
+		 * \param[in,out] m the mask, with one entry per point. */
+		inline void points_inside_walls(int n,const double *pp,unsigned char *m) {
+			for(int i=0;i<n;i+=points_inside_chunk,pp+=3*points_inside_chunk,m+=points_inside_chunk) {
+				int l=n-i<points_inside_chunk?n-i:points_inside_chunk;
+				for(wall **wp=walls;wp<wep;wp++) (*wp)->points_inside(l,pp,m);
+			}
+		}
 		/** Cuts a Voronoi cell by all of the walls currently on
-		 * the list.
+		 * the list. If some of the walls have a bounding box, then
+		 * only those that overlap the block that the cell is in are
+		 * applied, and the rest are left for apply_far_walls().
 		 * \param[in] c a reference to the Voronoi cell class.
 		 * \param[in] (x,y,z) the position of the cell.
 		 * \return True if the cell still exists, false if the cell is
 		 * deleted. */
 		template<class c_class>
 		bool apply_walls(c_class &c,double x,double y,double z) {
-			for(wall **wp=walls;wp<wep;wp++) if(!((*wp)->cut_cell(c,x,y,z))) return false;
+			if(walls==wep) return true;
+			trace_scope ts("walls");
+			if(wbw.empty()) {
+				for(wall **wp=walls;wp<wep;wp++) if(!((*wp)->cut_cell(c,x,y,z))) return false;
+				return true;
+			}
+
+			// Apply the walls without a bounding box, and those
+			// whose bounding box overlaps the block of the cell
+			int l;
+			for(l=0;l<int(wu.size());l++) if(!wu[l]->cut_cell(c,x,y,z)) return false;
+			std::vector<int> &b=wg[wall_coord(x-wax,wxsp,wnx)+wnx*(wall_coord(y-way,wysp,wny)+wny*wall_coord(z-waz,wzsp,wnz))];
+			for(l=0;l<int(b.size());l++) if(!wbw[b[l]]->cut_cell(c,x,y,z)) return false;
+			return true;
+		}
+		/** Cuts a Voronoi cell by the walls with a bounding box that
+		 * were not applied by apply_walls(), once the cell has been
+		 * cut by the particles. Only the walls whose bounding box
+		 * overlaps the cell's current extent are considered. Any
+		 * walls that make further cuts to a finished cell are then
+		 * applied.
+		 * \param[in] c a reference to the Voronoi cell class.
+		 * \param[in] (x,y,z) the position of the cell.
+		 * \return True if the cell still exists, false if the cell is
+		 * deleted. */
+		template<class c_class>
+		bool apply_far_walls(c_class &c,double x,double y,double z) {
+			if(wbw.empty()&&wf.empty()) return true;
+			trace_scope ts("walls");
+			if(!wbw.empty()&&!apply_indexed_walls(c,x,y,z)) return false;
+			for(int l=0;l<int(wf.size());l++) if(!wf[l]->finish_cell(c,x,y,z)) return false;
 			return true;
 		}
 		void deallocate();
 	protected:
 		void increase_wall_memory();
+		void set_wall_grid(double ax,double bx,double ay,double by,double az,double bz,int nx,int ny,int nz);
 		/** A pointer to the limit of the walls array, used to
 		 * determine when array is full. */
 		wall **wel;
 		/** The current amount of memory allocated for walls. */
 		int current_wall_size;
+	private:
+		/** Cuts a Voronoi cell by the walls with a bounding box that
+		 * overlaps the cell's current extent, apart from those that
+		 * overlap the block of the cell and were applied by
+		 * apply_walls().
+		 * \param[in] c a reference to the Voronoi cell class.
+		 * \param[in] (x,y,z) the position of the cell.
+		 * \return True if the cell still exists, false if the cell is
+		 * deleted. */
+		template<class c_class>
+		bool apply_indexed_walls(c_class &c,double x,double y,double z) {
+			double r=0.5*sqrt(c.max_radius_squared());
+			int pi=wall_coord(x-wax,wxsp,wnx),pj=wall_coord(y-way,wysp,wny),pk=wall_coord(z-waz,wzsp,wnz),
+			    i0=wall_coord(x-r-wax,wxsp,wnx),i1=wall_coord(x+r-wax,wxsp,wnx),
+			    j0=wall_coord(y-r-way,wysp,wny),j1=wall_coord(y+r-way,wysp,wny),
+			    k0=wall_coord(z-r-waz,wzsp,wnz),k1=wall_coord(z+r-waz,wzsp,wnz),i,j,k,l;
+			int *rp;
+			for(k=k0;k<=k1;k++) for(j=j0;j<=j1;j++) for(i=i0;i<=i1;i++) {
+				std::vector<int> &b=wg[i+wnx*(j+wny*k)];
+				for(l=0;l<int(b.size());l++) {
+
+					// Only consider each wall in the first block
+					// of the search that it overlaps, and skip it
+					// if it was already applied by apply_walls()
+					rp=&wr[6*b[l]];
+					if(i!=(rp[0]>i0?rp[0]:i0)||j!=(rp[2]>j0?rp[2]:j0)||k!=(rp[4]>k0?rp[4]:k0)) continue;
+					if(pi>=rp[0]&&pi<=rp[1]&&pj>=rp[2]&&pj<=rp[3]&&pk>=rp[4]&&pk<=rp[5]) continue;
+					if(!wbw[b[l]]->cut_cell(c,x,y,z)) return false;
+				}
+			}
+			return true;
+		}
+		/** The lower corner of the grid used to index the walls. */
+		double wax,way,waz;
+		/** The inverse block sizes of the grid used to index the
+		 * walls. */
+		double wxsp,wysp,wzsp;
+		/** The number of blocks in the grid used to index the walls in
+		 * each direction, or zero if there is no grid. */
+		int wnx,wny,wnz;
+		/** The walls without a bounding box, which are applied to
+		 * every cell. */
+		std::vector<wall*> wu;
+		/** The walls with a bounding box, which are stored in the
+		 * grid. */
+		std::vector<wall*> wbw;
+		/** The walls that make further cuts to a cell once it has
+		 * been cut by the particles. */
+		std::vector<wall*> wf;
+		/** The range of blocks that each wall with a bounding box
+		 * overlaps, given as six integers per wall. */
+		std::vector<int> wr;
+		/** The indices of the walls with a bounding box that overlap
+		 * each block of the grid, or NULL if there are no such walls.
+		 */
+		std::vector<int> *wg;
+		void index_wall(wall *w);
+		/** Computes the coordinate of the block of the wall grid that a
+		 * position is within, clamping it to the grid.
+		 * \param[in] a the position relative to the lower corner of
+		 *		the grid.
+		 * \param[in] sp the inverse block size.
+		 * \param[in] n the number of blocks.
+		 * \return The block coordinate. */
+		inline int wall_coord(double a,double sp,int n) {
+			a*=sp;
+			return a<0?0:(a>=n?n-1:int(a));
+		}
+};
+
+/** \brief A compact summary of a Voronoi cell computed for a ghost particle.
+ *
+ * This structure is filled in by the batched compute_ghost_cells() routines of
+ * the container and container_poly classes. */
+struct ghost_cell_record {
+	/** The volume of the cell, or zero if the cell could not be
+	 * computed. */
+	double volume;
+	/** The x coordinate of the centroid of the cell, relative to the
+	 * ghost particle. */
+	double cx;
+	/** The y coordinate of the centroid of the cell, relative to the
+	 * ghost particle. */
+	double cy;
+	/** The z coordinate of the centroid of the cell, relative to the
+	 * ghost particle. */
+	double cz;
+	/** The number of faces of the cell. */
+	int faces;
+	/** The position in the neighbor array of the first neighbor of the
+	 * cell, if neighbors were requested. The neighbors of the cell,
+	 * one per face, are stored consecutively from here. */
+	int nb;
 };
 
 /** \brief Class for representing a particle system in a three-dimensional
@@ -140,11 +324,11 @@ class container_base : public voro_base, public wall_list {
 		const bool zperiodic;
 		/** This array holds the numerical IDs of each particle in each
 		 * computational box. */
-		int **id;
+		voro_id **id;
 		/** A two dimensional array holding particle positions. For the
 		 * derived container_poly class, this also holds particle
 		 * radii. */
-		double **p;
+		fpoint **p;
 		/** This array holds the number of particles within each
 		 * computational box of the container. */
 		int *co;
@@ -154,6 +338,11 @@ class container_base : public voro_base, public wall_list {
 		 * more is allocated using the add_particle_memory() function.
 		 */
 		int *mem;
+		/** The initial amount of memory to allocate for particles in
+		 * each block. The memory for a block is only allocated when
+		 * the first particle is added to it, so that empty blocks use
+		 * no particle memory. */
+		const int init_mem;
 		/** The amount of memory in the array structure for each
 		 * particle. This is set to 3 when the basic class is
 		 * initialized, so that the array holds (x,y,z) positions. If
@@ -161,11 +350,21 @@ class container_base : public voro_base, public wall_list {
 		 * class container_poly, then this is set to 4, to also hold
 		 * the particle radii. */
 		const int ps;
+		/** A counter that is incremented whenever particles are added
+		 * to or removed from the container, so that any stored results
+		 * that depend on the particle arrangement can be invalidated.
+		 */
+		unsigned int update_count;
+		/** The blocks of the search mask used by the voro_compute
+		 * class refer directly to the blocks of the container, so that
+		 * the empty regions of the container can be skipped. */
+		static const bool direct_blocks=true;
 		container_base(double ax_,double bx_,double ay_,double by_,double az_,double bz_,
 				int nx_,int ny_,int nz_,bool xperiodic_,bool yperiodic_,bool zperiodic_,
 				int init_mem,int ps_);
 		~container_base();
 		bool point_inside(double x,double y,double z);
+		void points_inside(int n,const double *pp,unsigned char *m);
 		void region_count();
 		/** Initializes the Voronoi cell prior to a compute_cell
 		 * operation for a specific particle being carried out by a
@@ -191,13 +390,35 @@ class container_base : public voro_base, public wall_list {
 		template<class v_cell>
 		inline bool initialize_voronoicell(v_cell &c,int ijk,int q,int ci,int cj,int ck,
 				int &i,int &j,int &k,double &x,double &y,double &z,int &disp) {
-			double x1,x2,y1,y2,z1,z2,*pp=p[ijk]+ps*q;
+			fpoint *pp=p[ijk]+ps*q;
 			x=*(pp++);y=*(pp++);z=*pp;
+			return initialize_ghost_voronoicell(c,ijk,ci,cj,ck,i,j,k,x,y,z,disp);
+		}
+		/** Initializes the Voronoi cell prior to a compute_ghost_cell
+		 * operation for an arbitrary position being carried out by a
+		 * voro_compute class. The position does not need to be stored
+		 * in the container.
+		 * \param[in,out] c a reference to a voronoicell object.
+		 * \param[in] ijk the block that the position is within.
+		 * \param[in] (ci,cj,ck) the coordinates of the block in the
+		 * 			 container coordinate system.
+		 * \param[out] (i,j,k) the coordinates of the test block
+		 * 		       relative to the voro_compute
+		 * 		       coordinate system.
+		 * \param[in] (x,y,z) the position.
+		 * \param[out] disp a block displacement used internally by the
+		 *		    compute_cell routine.
+		 * \return False if the plane cuts applied by walls completely
+		 * removed the cell, true otherwise. */
+		template<class v_cell>
+		inline bool initialize_ghost_voronoicell(v_cell &c,int ijk,int ci,int cj,int ck,
+				int &i,int &j,int &k,double x,double y,double z,int &disp) {
+			double x1,x2,y1,y2,z1,z2;
 			if(xperiodic) {x1=-(x2=0.5*(bx-ax));i=nx;} else {x1=ax-x;x2=bx-x;i=ci;}
 			if(yperiodic) {y1=-(y2=0.5*(by-ay));j=ny;} else {y1=ay-y;y2=by-y;j=cj;}
 			if(zperiodic) {z1=-(z2=0.5*(bz-az));k=nz;} else {z1=az-z;z2=bz-z;k=ck;}
 			c.init(x1,x2,y1,y2,z1,z2);
-			if(!apply_walls(c,x,y,z)) return false;
+			if(!apply_cutoff(c)||!apply_walls(c,x,y,z)) return false;
 			disp=ijk-i-nx*(j+ny*k);
 			return true;
 		}
@@ -230,6 +451,15 @@ class container_base : public voro_base, public wall_list {
 			fy=y-ay-boxy*cj;
 			fz=z-az-boxz*ck;
 		}
+		/** Moves a displacement vector between two particles to the
+		 * periodic image that is closest to the origin, for each
+		 * periodic direction.
+		 * \param[in,out] (x,y,z) the displacement vector. */
+		inline void min_image(double &x,double &y,double &z) {
+			if(xperiodic) x-=(bx-ax)*floor(x/(bx-ax)+0.5);
+			if(yperiodic) y-=(by-ay)*floor(y/(by-ay)+0.5);
+			if(zperiodic) z-=(bz-az)*floor(z/(bz-az)+0.5);
+		}
 		/** Calculates the index of block in the container structure
 		 * corresponding to given coordinates.
 		 * \param[in] (ci,cj,ck) the coordinates of the original block
@@ -267,16 +497,90 @@ class container_base : public voro_base, public wall_list {
 		}
 		/** Sums up the total number of stored particles.
 		 * \return The number of particles. */
-		inline int total_particles() {
-			int tp=*co;
+		inline voro_id total_particles() {
+			voro_id tp=*co;
 			for(int *cop=co+1;cop<co+nxyz;cop++) tp+=*cop;
 			return tp;
 		}
+		/** Removes a particle from the container. To keep the
+		 * particles in each block contiguous, the last particle in
+		 * the block is moved into the vacated position.
+		 * \param[in] ijk the block that the particle is within.
+		 * \param[in] q the index of the particle within the block. */
+		inline void remove_particle(int ijk,int q) {
+			int l=--co[ijk];
+			update_count++;
+			if(indexed) {
+				voro_id n=id[ijk][q];
+				if(n>=0&&2*n<voro_id(idx.size())&&idx[2*n]==ijk&&idx[2*n+1]==q) idx[2*n]=idx[2*n+1]=-1;
+			}
+			id[ijk][q]=id[ijk][l];
+			for(int c=0;c<ps;c++) p[ijk][ps*q+c]=p[ijk][ps*l+c];
+			if(q<l) index_particle(id[ijk][q],ijk,q);
+		}
+		bool move_particle(int ijk,int q,double x,double y,double z);
+		int update_frame(voro_id n,const double *pp,std::vector<int> *changed=NULL);
+		void enable_id_index();
+		/** Stops maintaining the particle ID index, and frees its
+		 * memory. */
+		inline void disable_id_index() {
+			indexed=false;
+			std::vector<int>().swap(idx);
+		}
+		bool find_particle(voro_id n,int &ijk,int &q);
+		bool locate_ghost(int &ijk,int &ci,int &cj,int &ck,double &x,double &y,double &z);
+		void sort_morton();
+		void put_bulk(voro_id n,const voro_id *pid,const double *pp,int nt=1,particle_order *vo=NULL);
+		void shrink_particle_memory();
+		void place_particle_memory(int nt=0);
+		voro_memory memory_usage();
+		void swap(container_base &c);
+		static voro_memory estimate_memory(int n,int nx_,int ny_,int nz_,int ps_=3,int init_mem_=8,int nt=1);
+#ifdef _OPENMP
+		void put_chunked(voro_id np,voro_id **pid,double **pp,voro_id csz,int nt,particle_order *vo=NULL);
+#endif
 	protected:
-		void add_particle_memory(int i);
+		/** Whether the particle ID index is being maintained. */
+		bool indexed;
+		/** The particle ID index, holding the block and the index
+		 * within the block of the particle with each ID, in pairs, or
+		 * -1 if there is no particle with that ID. */
+		std::vector<int> idx;
+		/** Temporary storage for flags marking the blocks that are
+		 * changed by update_frame(). */
+		std::vector<char> chf;
+		/** Records where a particle is stored in the ID index, if the
+		 * index is being maintained. Negative IDs are not indexed.
+		 * \param[in] n the ID of the particle.
+		 * \param[in] (ijk,q) the block and the index within the block
+		 *		      of the particle. */
+		inline void index_particle(voro_id n,int ijk,int q) {
+			if(!indexed||n<0) return;
+			if(2*n>=voro_id(idx.size())) idx.resize(2*n+2,-1);
+			idx[2*n]=ijk;idx[2*n+1]=q;
+		}
+		void rebuild_id_index();
+		void save_state(const char *filename,double mr);
+		double load_state(const char *filename);
+		/** Increase memory for a particular region, doubling the
+		 * current allocation, or allocating the initial amount if the
+		 * region has no memory.
+		 * \param[in] i the index of the region to reallocate. */
+		inline void add_particle_memory(int i) {add_particle_memory(i,mem[i]>0?mem[i]<<1:init_mem);}
+		void add_particle_memory(int i,int nmem);
+		int sort_by_block(int n,const double *pp,int pps,int *ord,int *gijk,double *gp);
 		bool put_locate_block(int &ijk,double &x,double &y,double &z);
 		inline bool put_remap(int &ijk,double &x,double &y,double &z);
+		void relocate_particle(int ijk,int q,int nijk,double x,double y,double z);
 		inline bool remap(int &ai,int &aj,int &ak,int &ci,int &cj,int &ck,double &x,double &y,double &z,int &ijk);
+	private:
+		/** The copy constructor is not available, since the
+		 * containers own their particle memory. The contents of two
+		 * containers can be exchanged with swap(). */
+		container_base(const container_base &c);
+		/** Assignment is not available, for the same reason as the
+		 * copy constructor. */
+		void operator=(const container_base &c);
 };
 
 /** \brief Extension of the container_base class for computing regular Voronoi
@@ -290,20 +594,36 @@ class container : public container_base, public radius_mono {
 		container(double ax_,double bx_,double ay_,double by_,double az_,double bz_,
 				int nx_,int ny_,int nz_,bool xperiodic_,bool yperiodic_,bool zperiodic_,int init_mem);
 		void clear();
-		void put(int n,double x,double y,double z);
-		void put(particle_order &vo,int n,double x,double y,double z);
-		void import(FILE *fp=stdin);
-		void import(particle_order &vo,FILE *fp=stdin);
+		/** Saves the particles and the block structure of the
+		 * container to a binary state file. Walls are not saved.
+		 * \param[in] filename the name of the file to write to. */
+		inline void save(const char *filename) {save_state(filename,0);}
+		/** Restores the particles and the block structure of the
+		 * container from a binary state file, replacing any particles
+		 * that are currently stored. The container must have been set
+		 * up with the same geometry and block structure as the one
+		 * that saved the file.
+		 * \param[in] filename the name of the file to read. */
+		inline void load(const char *filename) {load_state(filename);}
+		void put(voro_id n,double x,double y,double z);
+		bool put(voro_id n,double x,double y,double z,int &ijk,int &q);
+		void put(particle_order &vo,voro_id n,double x,double y,double z);
+		void import(FILE *fp=stdin,int nt=1);
+		void import(particle_order &vo,FILE *fp=stdin,int nt=1);
+		void import_binary(const char *filename);
+		void import_binary(particle_order &vo,const char *filename);
 		/** Imports a list of particles from an open file stream into
 		 * the container. Entries of four numbers (Particle ID, x
 		 * position, y position, z position) are searched for. If the
 		 * file cannot be successfully read, then the routine causes a
 		 * fatal error.
 		 * \param[in] filename the name of the file to open and read
-		 *                     from. */
-		inline void import(const char* filename) {
+		 *                     from.
+		 * \param[in] nt the number of threads to use to parse
+		 *               the file. */
+		inline void import(const char* filename,int nt=1) {
 			FILE *fp=safe_fopen(filename,"r");
-			import(fp);
+			import(fp,nt);
 			fclose(fp);
 		}
 		/** Imports a list of particles from an open file stream into
@@ -314,23 +634,27 @@ class container : public container_base, public radius_mono {
 		 * read, then the routine causes a fatal error.
 		 * \param[in,out] vo the ordering class to use.
 		 * \param[in] filename the name of the file to open and read
-		 *                     from. */
-		inline void import(particle_order &vo,const char* filename) {
+		 *                     from.
+		 * \param[in] nt the number of threads to use to parse
+		 *               the file. */
+		inline void import(particle_order &vo,const char* filename,int nt=1) {
 			FILE *fp=safe_fopen(filename,"r");
-			import(vo,fp);
+			import(vo,fp,nt);
 			fclose(fp);
 		}
-		void compute_all_cells();
+		void compute_all_cells(int nt=1);
 		double sum_cell_volumes();
 		/** Dumps particle IDs and positions to a file.
 		 * \param[in] vl the loop class to use.
 		 * \param[in] fp a file handle to write to. */
 		template<class c_loop>
 		void draw_particles(c_loop &vl,FILE *fp) {
-			double *pp;
+			fpoint *pp;
+			text_writer tw(fp);
 			if(vl.start()) do {
 				pp=p[vl.ijk]+3*vl.q;
-				fprintf(fp,"%d %g %g %g\n",id[vl.ijk][vl.q],*pp,pp[1],pp[2]);
+				tw.put(id[vl.ijk][vl.q]);tw.put(' ');
+				tw.put3(*pp,pp[1],pp[2],' ');tw.put('\n');
 			} while(vl.inc());
 		}
 		/** Dumps all of the particle IDs and positions to a file.
@@ -351,11 +675,12 @@ class container : public container_base, public radius_mono {
 		 * \param[in] fp a file handle to write to. */
 		template<class c_loop>
 		void draw_particles_pov(c_loop &vl,FILE *fp) {
-			double *pp;
+			fpoint *pp;
+			text_writer tw(fp);
 			if(vl.start()) do {
 				pp=p[vl.ijk]+3*vl.q;
-				fprintf(fp,"// id %d\nsphere{<%g,%g,%g>,s}\n",
-						id[vl.ijk][vl.q],*pp,pp[1],pp[2]);
+				tw.put("// id ");tw.put(id[vl.ijk][vl.q]);
+				tw.put("\nsphere{<");tw.put3(*pp,pp[1],pp[2],',');tw.put(">,s}\n");
 			} while(vl.inc());
 		}
 		/** Dumps all particle positions in POV-Ray format.
@@ -377,7 +702,7 @@ class container : public container_base, public radius_mono {
 		 * \param[in] fp a file handle to write to. */
 		template<class c_loop>
 		void draw_cells_gnuplot(c_loop &vl,FILE *fp) {
-			voronoicell c(*this);double *pp;
+			voronoicell c(*this);fpoint *pp;
 			if(vl.start()) do if(compute_cell(c,vl)) {
 				pp=p[vl.ijk]+ps*vl.q;
 				c.draw_gnuplot(*pp,pp[1],pp[2],fp);
@@ -404,9 +729,9 @@ class container : public container_base, public radius_mono {
 		 * \param[in] fp a file handle to write to. */
 		template<class c_loop>
 		void draw_cells_pov(c_loop &vl,FILE *fp) {
-			voronoicell c(*this);double *pp;
+			voronoicell c(*this);fpoint *pp;
 			if(vl.start()) do if(compute_cell(c,vl)) {
-				fprintf(fp,"// cell %d\n",id[vl.ijk][vl.q]);
+				fprintf(fp,"// cell %ld\n",long(id[vl.ijk][vl.q]));
 				pp=p[vl.ijk]+ps*vl.q;
 				c.draw_pov(*pp,pp[1],pp[2],fp);
 			} while(vl.inc());
@@ -433,24 +758,86 @@ class container : public container_base, public radius_mono {
 		 * \param[in] fp a file handle to write to. */
 		template<class c_loop>
 		void print_custom(c_loop &vl,const char *format,FILE *fp) {
-			int ijk,q;double *pp;
-			if(contains_neighbor(format)) {
+			int ijk,q;fpoint *pp;
+			compiled_format fm(format);
+			if(fm.neighbor()) {
+				voronoicell_neighbor c(*this);
+				if(vl.start()) do if(compute_cell(c,vl)) {
+					ijk=vl.ijk;q=vl.q;pp=p[ijk]+ps*q;
+					fm.write(c,id[ijk][q],*pp,pp[1],pp[2],default_radius,fp);
+				} while(vl.inc());
+			} else {
+				voronoicell c(*this);
+				if(vl.start()) do if(compute_cell(c,vl)) {
+					ijk=vl.ijk;q=vl.q;pp=p[ijk]+ps*q;
+					fm.write(c,id[ijk][q],*pp,pp[1],pp[2],default_radius,fp);
+				} while(vl.inc());
+			}
+		}
+		void print_custom(const char *format,FILE *fp=stdout,int nt=1);
+		void print_custom(const char *format,const char *filename,int nt=1);
+		/** Computes the Voronoi cells and adds their statistics to a
+		 * binary column writer. Each chunk is written out as soon as it
+		 * is full, and any remaining cells are written at the end. The
+		 * header of the file is not written by this routine.
+		 * \param[in] vl the loop class to use.
+		 * \param[in] clw the column writer to use.
+		 * \param[in] fp a file handle to write to. */
+		template<class c_loop>
+		void print_columns(c_loop &vl,column_writer &clw,FILE *fp) {
+			int ijk,q;fpoint *pp;
+			if(clw.neighbor()) {
 				voronoicell_neighbor c(*this);
 				if(vl.start()) do if(compute_cell(c,vl)) {
 					ijk=vl.ijk;q=vl.q;pp=p[ijk]+ps*q;
-					c.output_custom(format,id[ijk][q],*pp,pp[1],pp[2],default_radius,fp);
+					clw.add(c,id[ijk][q],*pp,pp[1],pp[2],default_radius);
+					if(clw.full()) clw.write_chunk(fp);
 				} while(vl.inc());
 			} else {
 				voronoicell c(*this);
 				if(vl.start()) do if(compute_cell(c,vl)) {
 					ijk=vl.ijk;q=vl.q;pp=p[ijk]+ps*q;
-					c.output_custom(format,id[ijk][q],*pp,pp[1],pp[2],default_radius,fp);
+					clw.add(c,id[ijk][q],*pp,pp[1],pp[2],default_radius);
+					if(clw.full()) clw.write_chunk(fp);
 				} while(vl.inc());
 			}
+			clw.write_chunk(fp);
+		}
+		void print_columns(const char *columns,FILE *fp=stdout,int nt=1);
+		void print_columns(const char *columns,const char *filename,int nt=1);
+		bool find_voronoi_cell(double x,double y,double z,double &rx,double &ry,double &rz,voro_id &pid,voro_compute<container> &vcl,particle_record &w,int &wijk);
+		/** Takes a vector and finds the particle whose Voronoi cell
+		 * contains that vector, using a separate voro_compute class.
+		 * Additional wall classes are not considered by this routine.
+		 * \param[in] (x,y,z) the vector to test.
+		 * \param[out] (rx,ry,rz) the position of the particle whose
+		 *			  Voronoi cell contains the vector. If
+		 *			  the container is periodic, this may
+		 *			  point to a particle in a periodic
+		 *			  image of the primary domain.
+		 * \param[out] pid the ID of the particle.
+		 * \param[in] vcl the voro_compute class to carry out the
+		 *		  search with.
+		 * \return True if a particle was found. If the container has
+		 * no particles, then the search will not find a Voronoi cell
+		 * and false is returned. */
+		inline bool find_voronoi_cell(double x,double y,double z,double &rx,double &ry,double &rz,voro_id &pid,voro_compute<container> &vcl) {
+			particle_record w;
+			int wijk=-1;
+			return find_voronoi_cell(x,y,z,rx,ry,rz,pid,vcl,w,wijk);
+		}
+		void find_voronoi_cells(int n,const double *pp,double *rp,voro_id *pid,int nt=1);
+		/** Takes a vector and finds the particle whose Voronoi cell
+		 * contains that vector, using the container's own
+		 * voro_compute class.
+		 * \param[in] (x,y,z) the vector to test.
+		 * \param[out] (rx,ry,rz) the position of the particle whose
+		 *			  Voronoi cell contains the vector.
+		 * \param[out] pid the ID of the particle.
+		 * \return True if a particle was found, false otherwise. */
+		inline bool find_voronoi_cell(double x,double y,double z,double &rx,double &ry,double &rz,voro_id &pid) {
+			return find_voronoi_cell(x,y,z,rx,ry,rz,pid,vc);
 		}
-		void print_custom(const char *format,FILE *fp=stdout);
-		void print_custom(const char *format,const char *filename);
-		bool find_voronoi_cell(double x,double y,double z,double &rx,double &ry,double &rz,int &pid);
 		/** Computes the Voronoi cell for a particle currently being
 		 * referenced by a loop class.
 		 * \param[out] c a Voronoi cell class in which to store the
@@ -463,6 +850,24 @@ class container : public container_base, public radius_mono {
 		inline bool compute_cell(v_cell &c,c_loop &vl) {
 			return vc.compute_cell(c,vl.ijk,vl.q,vl.i,vl.j,vl.k);
 		}
+		/** Computes the Voronoi cell for a particle currently being
+		 * referenced by a loop class, cutting it first by the planes
+		 * of a list of particles that are expected to be its
+		 * neighbors.
+		 * \param[out] c a Voronoi cell class in which to store the
+		 * 		 computed cell.
+		 * \param[in] vl the loop class to use.
+		 * \param[in] (sp,se) pointers to the start and end of an
+		 *		      array of the seed particles, given as pairs
+		 *		      of the block index and the index within the
+		 *		      block.
+		 * \return True if the cell was computed. If the cell cannot be
+		 * computed, if it is removed entirely by a wall or boundary
+		 * condition, then the routine returns false. */
+		template<class v_cell,class c_loop>
+		inline bool compute_cell(v_cell &c,c_loop &vl,const int *sp,const int *se) {
+			return vc.compute_cell(c,vl.ijk,vl.q,vl.i,vl.j,vl.k,sp,se);
+		}
 		/** Computes the Voronoi cell for given particle.
 		 * \param[out] c a Voronoi cell class in which to store the
 		 * 		 computed cell.
@@ -476,8 +881,96 @@ class container : public container_base, public radius_mono {
 			int k=ijk/nxy,ijkt=ijk-nxy*k,j=ijkt/nx,i=ijkt-j*nx;
 			return vc.compute_cell(c,ijk,q,i,j,k);
 		}
+		/** Computes the Voronoi cell for the particle with a given
+		 * ID. This is fast if the particle ID index has been enabled
+		 * with enable_id_index(), and otherwise the blocks are
+		 * searched for the particle.
+		 * \param[out] c a Voronoi cell class in which to store the
+		 * 		 computed cell.
+		 * \param[in] n the ID of the particle.
+		 * \return True if the cell was computed. If there is no
+		 * particle with this ID, or if the cell is removed entirely by
+		 * a wall or boundary condition, then the routine returns
+		 * false. */
+		template<class v_cell>
+		inline bool compute_cell_by_id(v_cell &c,voro_id n) {
+			int ijk,q;
+			return find_particle(n,ijk,q)&&compute_cell(c,ijk,q);
+		}
+		/** Computes the Voronoi cell for a particle currently being
+		 * referenced by a loop class, using a separate voro_compute
+		 * class. Since the container is only read during the
+		 * computation, several threads can call this routine at once
+		 * provided that each uses its own voro_compute class.
+		 * \param[out] c a Voronoi cell class in which to store the
+		 * 		 computed cell.
+		 * \param[in] vl the loop class to use.
+		 * \param[in] vcl the voro_compute class to use, which can be
+		 *		 created with new_compute().
+		 * \return True if the cell was computed. If the cell cannot be
+		 * computed, if it is removed entirely by a wall or boundary
+		 * condition, then the routine returns false. */
+		template<class v_cell,class c_loop,class w_class>
+		inline bool compute_cell(v_cell &c,c_loop &vl,voro_compute<container,w_class> &vcl) {
+			return vcl.compute_cell(c,vl.ijk,vl.q,vl.i,vl.j,vl.k);
+		}
+		/** Computes the Voronoi cell for given particle, using a
+		 * separate voro_compute class.
+		 * \param[out] c a Voronoi cell class in which to store the
+		 * 		 computed cell.
+		 * \param[in] ijk the block that the particle is within.
+		 * \param[in] q the index of the particle within the block.
+		 * \param[in] vcl the voro_compute class to use.
+		 * \return True if the cell was computed. If the cell cannot be
+		 * computed, if it is removed entirely by a wall or boundary
+		 * condition, then the routine returns false. */
+		template<class v_cell,class w_class>
+		inline bool compute_cell(v_cell &c,int ijk,int q,voro_compute<container,w_class> &vcl) {
+			int k=ijk/nxy,ijkt=ijk-nxy*k,j=ijkt/nx,i=ijkt-j*nx;
+			return vcl.compute_cell(c,ijk,q,i,j,k);
+		}
+		/** Creates a new voro_compute class that is bound to this
+		 * container. It has its own search mask and queue, so it can
+		 * be used to compute Voronoi cells independently of the
+		 * container's own instance, for example in a separate thread.
+		 * The container must not be modified while it is in use.
+		 * \return A pointer to the new class, which the caller must
+		 * delete. */
+		inline voro_compute<container>* new_compute() {
+			return new voro_compute<container>(*this,vc.hx,vc.hy,vc.hz);
+		}
+		/** Returns the event counters for the container, which are the
+		 * totals for the container's own voro_compute class and for
+		 * the ones that have been used on the container and deleted.
+		 * These are only updated if VOROPP_COUNTERS is set.
+		 * \param[out] vt the counters. */
+		inline void total_counters(voro_counters &vt) {
+			vt=counters;vt.merge(vc.counters);
+		}
+		/** Sets all of the event counters for the container to
+		 * zero. */
+		inline void clear_counters() {
+			counters.clear();vc.counters.clear();
+		}
 		/** Computes the Voronoi cell for a ghost particle at a given
-		 * location.
+		 * location, using a separate voro_compute class. The ghost
+		 * particle is not stored in the container, so several threads
+		 * can call this routine at once provided that each uses its
+		 * own voro_compute class.
+		 * \param[out] c a Voronoi cell class in which to store the
+		 * 		 computed cell.
+		 * \param[in] (x,y,z) the location of the ghost particle.
+		 * \param[in] vcl the voro_compute class to use.
+		 * \return True if the cell was computed. If the cell cannot be
+		 * computed, if it is removed entirely by a wall or boundary
+		 * condition, then the routine returns false. */
+		template<class v_cell>
+		inline bool compute_ghost_cell(v_cell &c,double x,double y,double z,voro_compute<container> &vcl) {
+			int ijk,i,j,k;
+			return locate_ghost(ijk,i,j,k,x,y,z)&&vcl.compute_ghost_cell(c,x,y,z,0,ijk,i,j,k);
+		}
+		/** Computes the Voronoi cell for a ghost particle at a given
+		 * location, using the container's own voro_compute class.
 		 * \param[out] c a Voronoi cell class in which to store the
 		 * 		 computed cell.
 		 * \param[in] (x,y,z) the location of the ghost particle.
@@ -486,19 +979,16 @@ class container : public container_base, public radius_mono {
 		 * condition, then the routine returns false. */
 		template<class v_cell>
 		inline bool compute_ghost_cell(v_cell &c,double x,double y,double z) {
-			int ijk;
-			if(put_locate_block(ijk,x,y,z)) {
-				double *pp=p[ijk]+3*co[ijk]++;
-				*(pp++)=x;*(pp++)=y;*pp=z;
-				bool q=compute_cell(c,ijk,co[ijk]-1);
-				co[ijk]--;
-				return q;
-			}
-			return false;
+			return compute_ghost_cell(c,x,y,z,vc);
 		}
+		void compute_ghost_cells(int n,const double *pp,ghost_cell_record *gr,std::vector<voro_id> *nb=NULL,int nt=1);
 	private:
+		template<class v_cell>
+		void print_custom_threaded(const char *format,FILE *fp,int nt);
+		template<class v_cell>
+		void print_columns_threaded(const char *columns,FILE *fp,int nt);
 		voro_compute<container> vc;
-		friend class voro_compute<container>;
+		template<class c_class,class w_class> friend class voro_compute;
 };
 
 /** \brief Extension of the container_base class for computing radical Voronoi
@@ -512,20 +1002,48 @@ class container_poly : public container_base, public radius_poly {
 		container_poly(double ax_,double bx_,double ay_,double by_,double az_,double bz_,
 				int nx_,int ny_,int nz_,bool xperiodic_,bool yperiodic_,bool zperiodic_,int init_mem);
 		void clear();
-		void put(int n,double x,double y,double z,double r);
-		void put(particle_order &vo,int n,double x,double y,double z,double r);
-		void import(FILE *fp=stdin);
-		void import(particle_order &vo,FILE *fp=stdin);
+		/** Exchanges the particles of this container with another
+		 * one, as described for container_base::swap(), along with
+		 * the maximum particle radius.
+		 * \param[in] c the container to exchange with. */
+		inline void swap(container_poly &c) {
+			container_base::swap(c);
+			std::swap(max_radius,c.max_radius);
+		}
+		/** Saves the particles, the block structure, and the maximum
+		 * particle radius of the container to a binary state file.
+		 * Walls are not saved.
+		 * \param[in] filename the name of the file to write to. */
+		inline void save(const char *filename) {save_state(filename,max_radius);}
+		/** Restores the particles, the block structure, and the
+		 * maximum particle radius of the container from a binary
+		 * state file, replacing any particles that are currently
+		 * stored. The container must have been set up with the same
+		 * geometry and block structure as the one that saved the file.
+		 * \param[in] filename the name of the file to read. */
+		inline void load(const char *filename) {max_radius=load_state(filename);}
+		void put(voro_id n,double x,double y,double z,double r);
+		void put(particle_order &vo,voro_id n,double x,double y,double z,double r);
+		void import(FILE *fp=stdin,int nt=1);
+		void put_bulk(voro_id n,const voro_id *pid,const double *pp,int nt=1,particle_order *vo=NULL);
+#ifdef _OPENMP
+		void put_chunked(voro_id np,voro_id **pid,double **pp,voro_id csz,int nt,particle_order *vo=NULL);
+#endif
+		void import(particle_order &vo,FILE *fp=stdin,int nt=1);
+		void import_binary(const char *filename);
+		void import_binary(particle_order &vo,const char *filename);
 		/** Imports a list of particles from an open file stream into
 		 * the container_poly class. Entries of five numbers (Particle
 		 * ID, x position, y position, z position, radius) are searched
 		 * for. If the file cannot be successfully read, then the
 		 * routine causes a fatal error.
 		 * \param[in] filename the name of the file to open and read
-		 *                     from. */
-		inline void import(const char* filename) {
+		 *                     from.
+		 * \param[in] nt the number of threads to use to parse
+		 *               the file. */
+		inline void import(const char* filename,int nt=1) {
 			FILE *fp=safe_fopen(filename,"r");
-			import(fp);
+			import(fp,nt);
 			fclose(fp);
 		}
 		/** Imports a list of particles from an open file stream into
@@ -536,23 +1054,28 @@ class container_poly : public container_base, public radius_poly {
 		 * successfully read, then the routine causes a fatal error.
 		 * \param[in,out] vo the ordering class to use.
 		 * \param[in] filename the name of the file to open and read
-		 *                     from. */
-		inline void import(particle_order &vo,const char* filename) {
+		 *                     from.
+		 * \param[in] nt the number of threads to use to parse
+		 *               the file. */
+		inline void import(particle_order &vo,const char* filename,int nt=1) {
 			FILE *fp=safe_fopen(filename,"r");
-			import(vo,fp);
+			import(vo,fp,nt);
 			fclose(fp);
 		}
-		void compute_all_cells();
+		void compute_all_cells(int nt=1);
 		double sum_cell_volumes();
 		/** Dumps particle IDs, positions and radii to a file.
 		 * \param[in] vl the loop class to use.
 		 * \param[in] fp a file handle to write to. */
 		template<class c_loop>
 		void draw_particles(c_loop &vl,FILE *fp) {
-			double *pp;
+			fpoint *pp;
+			text_writer tw(fp);
 			if(vl.start()) do {
 				pp=p[vl.ijk]+4*vl.q;
-				fprintf(fp,"%d %g %g %g %g\n",id[vl.ijk][vl.q],*pp,pp[1],pp[2],pp[3]);
+				tw.put(id[vl.ijk][vl.q]);tw.put(' ');
+				tw.put3(*pp,pp[1],pp[2],' ');tw.put(' ');
+				tw.put(pp[3]);tw.put('\n');
 			} while(vl.inc());
 		}
 		/** Dumps all of the particle IDs, positions and radii to a
@@ -575,11 +1098,13 @@ class container_poly : public container_base, public radius_poly {
 		 * \param[in] fp a file handle to write to. */
 		template<class c_loop>
 		void draw_particles_pov(c_loop &vl,FILE *fp) {
-			double *pp;
+			fpoint *pp;
+			text_writer tw(fp);
 			if(vl.start()) do {
 				pp=p[vl.ijk]+4*vl.q;
-				fprintf(fp,"// id %d\nsphere{<%g,%g,%g>,%g}\n",
-						id[vl.ijk][vl.q],*pp,pp[1],pp[2],pp[3]);
+				tw.put("// id ");tw.put(id[vl.ijk][vl.q]);
+				tw.put("\nsphere{<");tw.put3(*pp,pp[1],pp[2],',');
+				tw.put(">,");tw.put(pp[3]);tw.put("}\n");
 			} while(vl.inc());
 		}
 		/** Dumps all the particle positions in POV-Ray format.
@@ -601,7 +1126,7 @@ class container_poly : public container_base, public radius_poly {
 		 * \param[in] fp a file handle to write to. */
 		template<class c_loop>
 		void draw_cells_gnuplot(c_loop &vl,FILE *fp) {
-			voronoicell c;double *pp;
+			voronoicell c;fpoint *pp;
 			if(vl.start()) do if(compute_cell(c,vl)) {
 				pp=p[vl.ijk]+ps*vl.q;
 				c.draw_gnuplot(*pp,pp[1],pp[2],fp);
@@ -628,9 +1153,9 @@ class container_poly : public container_base, public radius_poly {
 		 * \param[in] fp a file handle to write to. */
 		template<class c_loop>
 		void draw_cells_pov(c_loop &vl,FILE *fp) {
-			voronoicell c(*this);double *pp;
+			voronoicell c(*this);fpoint *pp;
 			if(vl.start()) do if(compute_cell(c,vl)) {
-				fprintf(fp,"// cell %d\n",id[vl.ijk][vl.q]);
+				fprintf(fp,"// cell %ld\n",long(id[vl.ijk][vl.q]));
 				pp=p[vl.ijk]+ps*vl.q;
 				c.draw_pov(*pp,pp[1],pp[2],fp);
 			} while(vl.inc());
@@ -657,18 +1182,19 @@ class container_poly : public container_base, public radius_poly {
 		 * \param[in] fp a file handle to write to. */
 		template<class c_loop>
 		void print_custom(c_loop &vl,const char *format,FILE *fp) {
-			int ijk,q;double *pp;
-			if(contains_neighbor(format)) {
+			int ijk,q;fpoint *pp;
+			compiled_format fm(format);
+			if(fm.neighbor()) {
 				voronoicell_neighbor c(*this);
 				if(vl.start()) do if(compute_cell(c,vl)) {
 					ijk=vl.ijk;q=vl.q;pp=p[ijk]+ps*q;
-					c.output_custom(format,id[ijk][q],*pp,pp[1],pp[2],pp[3],fp);
+					fm.write(c,id[ijk][q],*pp,pp[1],pp[2],pp[3],fp);
 				} while(vl.inc());
 			} else {
 				voronoicell c(*this);
 				if(vl.start()) do if(compute_cell(c,vl)) {
 					ijk=vl.ijk;q=vl.q;pp=p[ijk]+ps*q;
-					c.output_custom(format,id[ijk][q],*pp,pp[1],pp[2],pp[3],fp);
+					fm.write(c,id[ijk][q],*pp,pp[1],pp[2],pp[3],fp);
 				} while(vl.inc());
 			}
 		}
@@ -684,6 +1210,24 @@ class container_poly : public container_base, public radius_poly {
 		inline bool compute_cell(v_cell &c,c_loop &vl) {
 			return vc.compute_cell(c,vl.ijk,vl.q,vl.i,vl.j,vl.k);
 		}
+		/** Computes the Voronoi cell for a particle currently being
+		 * referenced by a loop class, cutting it first by the planes
+		 * of a list of particles that are expected to be its
+		 * neighbors.
+		 * \param[out] c a Voronoi cell class in which to store the
+		 * 		 computed cell.
+		 * \param[in] vl the loop class to use.
+		 * \param[in] (sp,se) pointers to the start and end of an
+		 *		      array of the seed particles, given as pairs
+		 *		      of the block index and the index within the
+		 *		      block.
+		 * \return True if the cell was computed. If the cell cannot be
+		 * computed, if it is removed entirely by a wall or boundary
+		 * condition, then the routine returns false. */
+		template<class v_cell,class c_loop>
+		inline bool compute_cell(v_cell &c,c_loop &vl,const int *sp,const int *se) {
+			return vc.compute_cell(c,vl.ijk,vl.q,vl.i,vl.j,vl.k,sp,se);
+		}
 		/** Computes the Voronoi cell for given particle.
 		 * \param[out] c a Voronoi cell class in which to store the
 		 * 		 computed cell.
@@ -697,8 +1241,97 @@ class container_poly : public container_base, public radius_poly {
 			int k=ijk/nxy,ijkt=ijk-nxy*k,j=ijkt/nx,i=ijkt-j*nx;
 			return vc.compute_cell(c,ijk,q,i,j,k);
 		}
+		/** Computes the Voronoi cell for the particle with a given
+		 * ID. This is fast if the particle ID index has been enabled
+		 * with enable_id_index(), and otherwise the blocks are
+		 * searched for the particle.
+		 * \param[out] c a Voronoi cell class in which to store the
+		 * 		 computed cell.
+		 * \param[in] n the ID of the particle.
+		 * \return True if the cell was computed. If there is no
+		 * particle with this ID, or if the cell is removed entirely by
+		 * a wall or boundary condition, then the routine returns
+		 * false. */
+		template<class v_cell>
+		inline bool compute_cell_by_id(v_cell &c,voro_id n) {
+			int ijk,q;
+			return find_particle(n,ijk,q)&&compute_cell(c,ijk,q);
+		}
+		/** Computes the Voronoi cell for a particle currently being
+		 * referenced by a loop class, using a separate voro_compute
+		 * class. Since the container is only read during the
+		 * computation, several threads can call this routine at once
+		 * provided that each uses its own voro_compute class.
+		 * \param[out] c a Voronoi cell class in which to store the
+		 * 		 computed cell.
+		 * \param[in] vl the loop class to use.
+		 * \param[in] vcl the voro_compute class to use, which can be
+		 *		 created with new_compute().
+		 * \return True if the cell was computed. If the cell cannot be
+		 * computed, if it is removed entirely by a wall or boundary
+		 * condition, then the routine returns false. */
+		template<class v_cell,class c_loop,class w_class>
+		inline bool compute_cell(v_cell &c,c_loop &vl,voro_compute<container_poly,w_class> &vcl) {
+			return vcl.compute_cell(c,vl.ijk,vl.q,vl.i,vl.j,vl.k);
+		}
+		/** Computes the Voronoi cell for given particle, using a
+		 * separate voro_compute class.
+		 * \param[out] c a Voronoi cell class in which to store the
+		 * 		 computed cell.
+		 * \param[in] ijk the block that the particle is within.
+		 * \param[in] q the index of the particle within the block.
+		 * \param[in] vcl the voro_compute class to use.
+		 * \return True if the cell was computed. If the cell cannot be
+		 * computed, if it is removed entirely by a wall or boundary
+		 * condition, then the routine returns false. */
+		template<class v_cell,class w_class>
+		inline bool compute_cell(v_cell &c,int ijk,int q,voro_compute<container_poly,w_class> &vcl) {
+			int k=ijk/nxy,ijkt=ijk-nxy*k,j=ijkt/nx,i=ijkt-j*nx;
+			return vcl.compute_cell(c,ijk,q,i,j,k);
+		}
+		/** Creates a new voro_compute class that is bound to this
+		 * container. It has its own search mask and queue, so it can
+		 * be used to compute Voronoi cells independently of the
+		 * container's own instance, for example in a separate thread.
+		 * The container must not be modified while it is in use.
+		 * \return A pointer to the new class, which the caller must
+		 * delete. */
+		inline voro_compute<container_poly>* new_compute() {
+			return new voro_compute<container_poly>(*this,vc.hx,vc.hy,vc.hz);
+		}
+		/** Returns the event counters for the container, which are the
+		 * totals for the container's own voro_compute class and for
+		 * the ones that have been used on the container and deleted.
+		 * These are only updated if VOROPP_COUNTERS is set.
+		 * \param[out] vt the counters. */
+		inline void total_counters(voro_counters &vt) {
+			vt=counters;vt.merge(vc.counters);
+		}
+		/** Sets all of the event counters for the container to
+		 * zero. */
+		inline void clear_counters() {
+			counters.clear();vc.counters.clear();
+		}
 		/** Computes the Voronoi cell for a ghost particle at a given
-		 * location.
+		 * location, using a separate voro_compute class. The ghost
+		 * particle is not stored in the container, so several threads
+		 * can call this routine at once provided that each uses its
+		 * own voro_compute class.
+		 * \param[out] c a Voronoi cell class in which to store the
+		 * 		 computed cell.
+		 * \param[in] (x,y,z) the location of the ghost particle.
+		 * \param[in] r the radius of the ghost particle.
+		 * \param[in] vcl the voro_compute class to use.
+		 * \return True if the cell was computed. If the cell cannot be
+		 * computed, if it is removed entirely by a wall or boundary
+		 * condition, then the routine returns false. */
+		template<class v_cell>
+		inline bool compute_ghost_cell(v_cell &c,double x,double y,double z,double r,voro_compute<container_poly> &vcl) {
+			int ijk,i,j,k;
+			return locate_ghost(ijk,i,j,k,x,y,z)&&vcl.compute_ghost_cell(c,x,y,z,r,ijk,i,j,k);
+		}
+		/** Computes the Voronoi cell for a ghost particle at a given
+		 * location, using the container's own voro_compute class.
 		 * \param[out] c a Voronoi cell class in which to store the
 		 * 		 computed cell.
 		 * \param[in] (x,y,z) the location of the ghost particle.
@@ -708,23 +1341,80 @@ class container_poly : public container_base, public radius_poly {
 		 * condition, then the routine returns false. */
 		template<class v_cell>
 		inline bool compute_ghost_cell(v_cell &c,double x,double y,double z,double r) {
-			int ijk;
-			if(put_locate_block(ijk,x,y,z)) {
-				double *pp=p[ijk]+4*co[ijk]++,tm=max_radius;
-				*(pp++)=x;*(pp++)=y;*(pp++)=z;*pp=r;
-				if(r>max_radius) max_radius=r;
-				bool q=compute_cell(c,ijk,co[ijk]-1);
-				co[ijk]--;max_radius=tm;
-				return q;
+			return compute_ghost_cell(c,x,y,z,r,vc);
+		}
+		void compute_ghost_cells(int n,const double *pp,ghost_cell_record *gr,std::vector<voro_id> *nb=NULL,int nt=1);
+		void print_custom(const char *format,FILE *fp=stdout,int nt=1);
+		void print_custom(const char *format,const char *filename,int nt=1);
+		/** Computes the Voronoi cells and adds their statistics to a
+		 * binary column writer. Each chunk is written out as soon as it
+		 * is full, and any remaining cells are written at the end. The
+		 * header of the file is not written by this routine.
+		 * \param[in] vl the loop class to use.
+		 * \param[in] clw the column writer to use.
+		 * \param[in] fp a file handle to write to. */
+		template<class c_loop>
+		void print_columns(c_loop &vl,column_writer &clw,FILE *fp) {
+			int ijk,q;fpoint *pp;
+			if(clw.neighbor()) {
+				voronoicell_neighbor c(*this);
+				if(vl.start()) do if(compute_cell(c,vl)) {
+					ijk=vl.ijk;q=vl.q;pp=p[ijk]+ps*q;
+					clw.add(c,id[ijk][q],*pp,pp[1],pp[2],pp[3]);
+					if(clw.full()) clw.write_chunk(fp);
+				} while(vl.inc());
+			} else {
+				voronoicell c(*this);
+				if(vl.start()) do if(compute_cell(c,vl)) {
+					ijk=vl.ijk;q=vl.q;pp=p[ijk]+ps*q;
+					clw.add(c,id[ijk][q],*pp,pp[1],pp[2],pp[3]);
+					if(clw.full()) clw.write_chunk(fp);
+				} while(vl.inc());
 			}
-			return false;
+			clw.write_chunk(fp);
+		}
+		void print_columns(const char *columns,FILE *fp=stdout,int nt=1);
+		void print_columns(const char *columns,const char *filename,int nt=1);
+		bool find_voronoi_cell(double x,double y,double z,double &rx,double &ry,double &rz,voro_id &pid,voro_compute<container_poly> &vcl,particle_record &w,int &wijk);
+		/** Takes a vector and finds the particle whose Voronoi cell
+		 * contains that vector, using a separate voro_compute class.
+		 * Additional wall classes are not considered by this routine.
+		 * \param[in] (x,y,z) the vector to test.
+		 * \param[out] (rx,ry,rz) the position of the particle whose
+		 *			  Voronoi cell contains the vector. If
+		 *			  the container is periodic, this may
+		 *			  point to a particle in a periodic
+		 *			  image of the primary domain.
+		 * \param[out] pid the ID of the particle.
+		 * \param[in] vcl the voro_compute class to carry out the
+		 *		  search with.
+		 * \return True if a particle was found. If the container has
+		 * no particles, then the search will not find a Voronoi cell
+		 * and false is returned. */
+		inline bool find_voronoi_cell(double x,double y,double z,double &rx,double &ry,double &rz,voro_id &pid,voro_compute<container_poly> &vcl) {
+			particle_record w;
+			int wijk=-1;
+			return find_voronoi_cell(x,y,z,rx,ry,rz,pid,vcl,w,wijk);
+		}
+		void find_voronoi_cells(int n,const double *pp,double *rp,voro_id *pid,int nt=1);
+		/** Takes a vector and finds the particle whose Voronoi cell
+		 * contains that vector, using the container's own
+		 * voro_compute class.
+		 * \param[in] (x,y,z) the vector to test.
+		 * \param[out] (rx,ry,rz) the position of the particle whose
+		 *			  Voronoi cell contains the vector.
+		 * \param[out] pid the ID of the particle.
+		 * \return True if a particle was found, false otherwise. */
+		inline bool find_voronoi_cell(double x,double y,double z,double &rx,double &ry,double &rz,voro_id &pid) {
+			return find_voronoi_cell(x,y,z,rx,ry,rz,pid,vc);
 		}
-		void print_custom(const char *format,FILE *fp=stdout);
-		void print_custom(const char *format,const char *filename);
-		bool find_voronoi_cell(double x,double y,double z,double &rx,double &ry,double &rz,int &pid);
 	private:
+		template<class v_cell>
+		void print_custom_threaded(const char *format,FILE *fp,int nt);
+		template<class v_cell>
+		void print_columns_threaded(const char *columns,FILE *fp,int nt);
 		voro_compute<container_poly> vc;
-		friend class voro_compute<container_poly>;
+		template<class c_class,class w_class> friend class voro_compute;
 };
 
 }
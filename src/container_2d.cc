@@ -0,0 +1,296 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file container_2d.cc
+ * \brief Function implementations for the container_2d class. */
+
+#include "container_2d.hh"
+#include "text_reader.hh"
+
+namespace voro {
+
+/** The class constructor sets up the geometry of the container and allocates
+ * memory for the blocks.
+ * \param[in] (ax_,bx_) the minimum and maximum x coordinates.
+ * \param[in] (ay_,by_) the minimum and maximum y coordinates.
+ * \param[in] (nx_,ny_) the number of grid blocks in each of the two
+ *                      coordinate directions.
+ * \param[in] (xperiodic_,yperiodic_) flags setting whether the container is
+ *                                    periodic in each coordinate direction.
+ * \param[in] init_mem the initial memory allocation for each block. */
+container_2d::container_2d(double ax_,double bx_,double ay_,double by_,int nx_,int ny_,
+		bool xperiodic_,bool yperiodic_,int init_mem)
+	: ax(ax_), bx(bx_), ay(ay_), by(by_), boxx((bx_-ax_)/nx_), boxy((by_-ay_)/ny_),
+	xsp(1/boxx), ysp(1/boxy), nx(nx_), ny(ny_), nxy(nx_*ny_),
+	xperiodic(xperiodic_), yperiodic(yperiodic_),
+	max_len_sq((bx-ax)*(bx-ax)*(xperiodic_?0.25:1)+(by-ay)*(by-ay)*(yperiodic_?0.25:1)),
+	id(new int*[nxy]), p(new fpoint*[nxy]), co(new int[nxy]), mem(new int[nxy]) {
+	int l;
+	for(l=0;l<nxy;l++) co[l]=0;
+	for(l=0;l<nxy;l++) mem[l]=init_mem;
+	for(l=0;l<nxy;l++) id[l]=new int[init_mem];
+	for(l=0;l<nxy;l++) p[l]=new fpoint[2*init_mem];
+}
+
+/** The container destructor frees the dynamically allocated memory. */
+container_2d::~container_2d() {
+	int l;
+	for(l=0;l<nxy;l++) delete [] p[l];
+	for(l=0;l<nxy;l++) delete [] id[l];
+	delete [] id;
+	delete [] p;
+	delete [] co;
+	delete [] mem;
+}
+
+/** Clears a container of particles. */
+void container_2d::clear() {
+	for(int *cop=co;cop<co+nxy;cop++) *cop=0;
+}
+
+/** Put a particle into the correct region of the container.
+ * \param[in] n the numerical ID of the inserted particle.
+ * \param[in] (x,y) the position vector of the inserted particle. */
+void container_2d::put(int n,double x,double y) {
+	int ijk;
+	if(put_remap(ijk,x,y)) {
+		if(co[ijk]==mem[ijk]) add_particle_memory(ijk);
+		id[ijk][co[ijk]]=n;
+		fpoint *pp=p[ijk]+2*co[ijk]++;
+		*(pp++)=x;*pp=y;
+	}
+#if VOROPP_REPORT_OUT_OF_BOUNDS ==1
+	else fprintf(stderr,"Out of bounds: (x,y)=(%g,%g)\n",x,y);
+#endif
+}
+
+/** Takes a particle position vector and computes the region index into which
+ * it should be stored. If the container is periodic, then the routine also
+ * maps the particle position to ensure it is in the primary domain. If the
+ * container is not periodic, the routine bails out.
+ * \param[out] ijk the region index.
+ * \param[in,out] (x,y) the particle position, remapped into the primary
+ *                      domain if necessary.
+ * \return True if the particle can be successfully placed into the container,
+ * false otherwise. */
+bool container_2d::put_remap(int &ijk,double &x,double &y) {
+	int l;
+
+	ijk=step_int((x-ax)*xsp);
+	if(xperiodic) {l=step_mod(ijk,nx);x+=boxx*(l-ijk);ijk=l;}
+	else if(ijk<0||ijk>=nx) return false;
+
+	int j=step_int((y-ay)*ysp);
+	if(yperiodic) {l=step_mod(j,ny);y+=boxy*(l-j);j=l;}
+	else if(j<0||j>=ny) return false;
+
+	ijk+=nx*j;
+	return true;
+}
+
+/** Increase memory for a particular region.
+ * \param[in] i the index of the region to reallocate. */
+void container_2d::add_particle_memory(int i) {
+	int l,nmem=mem[i]<<1;
+
+	// Carry out a check on the memory allocation size, and
+	// print a status message if requested
+	if(nmem>max_particle_memory)
+		voro_fatal_error("Absolute maximum memory allocation exceeded",VOROPP_MEMORY_ERROR);
+#if VOROPP_VERBOSE >=3
+	fprintf(stderr,"Particle memory in region %d scaled up to %d\n",i,nmem);
+#endif
+
+	// Allocate new memory and copy in the contents of the old arrays
+	int *idp=new int[nmem];
+	for(l=0;l<co[i];l++) idp[l]=id[i][l];
+	fpoint *pp=new fpoint[2*nmem];
+	for(l=0;l<2*co[i];l++) pp[l]=p[i][l];
+
+	// Update pointers and delete old arrays
+	mem[i]=nmem;
+	delete [] id[i];id[i]=idp;
+	delete [] p[i];p[i]=pp;
+}
+
+/** Import a list of particles from an open file stream into the container.
+ * Entries of three numbers (Particle ID, x position, y position) are searched
+ * for. If the file cannot be successfully read, then the routine causes a
+ * fatal error.
+ * \param[in] fp the file handle to read from.
+ * \param[in] nt the number of threads to use to parse the file. */
+void container_2d::import(FILE *fp,int nt) {
+	text_reader tr(fp,2,nt);
+	while(tr.next()) for(unsigned int i=0;i<tr.id.size();i++)
+		put(tr.id[i],tr.v[2*i],tr.v[2*i+1]);
+}
+
+/** Counts the number of particles in the container.
+ * \return The number of particles. */
+int container_2d::total_particles() {
+	int tp=*co;
+	for(int *cop=co+1;cop<co+nxy;cop++) tp+=*cop;
+	return tp;
+}
+
+/** Cuts a cell by the particles in a block. Particles that are further away
+ * than the current maximum radius of the cell are skipped without testing
+ * the cell's vertices.
+ * \param[in,out] c the cell to cut.
+ * \param[in] ijk the block to consider.
+ * \param[in] qs the index of a particle in the block to skip, or -1 if all
+ *               particles are to be considered.
+ * \param[in] (x,y) the position of the particle that the cell belongs to,
+ *                  relative to the periodic image of the block.
+ * \param[in,out] mrs the maximum radius squared of the cell, which is updated
+ *                    if the cell is cut.
+ * \return False if the cell was completely removed, true otherwise. */
+bool container_2d::cut_block(voronoicell_2d &c,int ijk,int qs,double x,double y,double &mrs) {
+	int l;
+	bool cut=false;
+	double dx,dy,rs;
+	fpoint *pp=p[ijk];
+	for(l=0;l<co[ijk];l++,pp+=2) if(l!=qs) {
+		dx=*pp-x;dy=pp[1]-y;
+		rs=dx*dx+dy*dy;
+		if(rs<mrs) {
+			if(!c.nplane(dx,dy,rs,id[ijk][l])) return false;
+			cut=true;
+		}
+	}
+	if(cut) mrs=c.max_radius_squared();
+	return true;
+}
+
+/** Computes the Voronoi cell for a particle. The cell is cut by the particles
+ * in the particle's own block, followed by the square rings of blocks around
+ * it. Within a ring, a block is skipped if its closest point is further away
+ * than twice the maximum distance to a vertex of the cell, and the search
+ * ends when this is true for the whole ring.
+ * \param[out] c the cell to store the result in.
+ * \param[in] ijk the block that the particle is within.
+ * \param[in] q the index of the particle within the block.
+ * \return True if the cell was computed, false if it was completely removed
+ *         by the cutting lines. */
+bool container_2d::compute_cell(voronoicell_2d &c,int ijk,int q) {
+	int i=ijk%nx,j=ijk/nx,r,di,dj,ii,jj,ci,cj,step;
+	fpoint *pp=p[ijk]+2*q;
+	double x=*pp,y=pp[1],lx=bx-ax,ly=by-ay,ex,ey,mrs,sx,sy;
+
+	// Initialize the cell. In a periodic direction, the cell is made
+	// twice as large as necessary, so that the edges due to the periodic
+	// images of the particle itself are recorded.
+	c.init(xperiodic?-lx:ax-x,xperiodic?lx:bx-x,yperiodic?-ly:ay-y,yperiodic?ly:by-y);
+	mrs=c.max_radius_squared();
+
+	// Find the distances from the particle to the four sides of its
+	// block, and cut the cell by the other particles in the block
+	double xlo=x-ax-i*boxx,xhi=boxx-xlo,ylo=y-ay-j*boxy,yhi=boxy-ylo;
+	if(!cut_block(c,ijk,q,x,y,mrs)) return false;
+
+	for(r=1;;r++) {
+
+		// Stop when the closest block in the ring is too far away,
+		// or when a non-periodic container has no blocks in the ring
+		ex=(xlo<xhi?xlo:xhi)+(r-1)*boxx;
+		ey=(ylo<yhi?ylo:yhi)+(r-1)*boxy;
+		if(ex>ey) ex=ey;
+		if(ex*ex>mrs) break;
+		if(!xperiodic&&!yperiodic&&i-r<0&&i+r>=nx&&j-r<0&&j+r>=ny) break;
+
+		// Scan the blocks in the ring, stepping along the top and
+		// bottom rows and only visiting the ends of the other rows
+		for(dj=-r;dj<=r;dj++) {
+			jj=j+dj;
+			if(yperiodic) {cj=step_mod(jj,ny);sy=step_div(jj,ny)*ly;}
+			else {
+				if(jj<0||jj>=ny) continue;
+				cj=jj;sy=0;
+			}
+			ey=dj>0?(dj-1)*boxy+yhi:(dj<0?(-dj-1)*boxy+ylo:0);
+			ey*=ey;
+			if(ey>mrs) continue;
+			step=(dj==-r||dj==r)?1:2*r;
+			for(di=-r;di<=r;di+=step) {
+				ii=i+di;
+				if(xperiodic) {ci=step_mod(ii,nx);sx=step_div(ii,nx)*lx;}
+				else {
+					if(ii<0||ii>=nx) continue;
+					ci=ii;sx=0;
+				}
+				ex=di>0?(di-1)*boxx+xhi:(di<0?(-di-1)*boxx+xlo:0);
+				if(ex*ex+ey>mrs) continue;
+				if(!cut_block(c,ci+nx*cj,-1,x-sx,y-sy,mrs)) return false;
+			}
+		}
+	}
+	return true;
+}
+
+/** Computes all of the Voronoi cells in the container, but does nothing with
+ * the output. It is useful for measuring the pure computation time of the
+ * Voronoi algorithm, without any additional calculations such as area
+ * evaluation or cell output. */
+void container_2d::compute_all_cells() {
+	voronoicell_2d c(max_len_sq);
+	c_loop_all_2d vl(*this);
+	if(vl.start()) do compute_cell(c,vl.ijk,vl.q);
+	while(vl.inc());
+}
+
+/** Calculates all of the Voronoi cells and sums their areas. In most cases
+ * without walls, the sum of the Voronoi cell areas should equal the area of
+ * the container to numerical precision.
+ * \return The sum of all of the computed Voronoi areas. */
+double container_2d::sum_cell_areas() {
+	voronoicell_2d c(max_len_sq);
+	double area=0;
+	c_loop_all_2d vl(*this);
+	if(vl.start()) do if(compute_cell(c,vl.ijk,vl.q)) area+=c.area();
+	while(vl.inc());
+	return area;
+}
+
+/** Dumps all of the particle IDs and positions to a file.
+ * \param[in] fp a file handle to write to. */
+void container_2d::draw_particles(FILE *fp) {
+	double x,y;
+	c_loop_all_2d vl(*this);
+	if(vl.start()) do {
+		vl.pos(x,y);
+		fprintf(fp,"%d %g %g\n",vl.pid(),x,y);
+	} while(vl.inc());
+}
+
+/** Computes all of the Voronoi cells in the container, and saves the output
+ * in gnuplot format.
+ * \param[in] fp a file handle to write to. */
+void container_2d::draw_cells_gnuplot(FILE *fp) {
+	voronoicell_2d c(max_len_sq);
+	double x,y;
+	c_loop_all_2d vl(*this);
+	if(vl.start()) do if(compute_cell(c,vl.ijk,vl.q)) {
+		vl.pos(x,y);
+		c.draw_gnuplot(x,y,fp);
+	} while(vl.inc());
+}
+
+/** Computes all of the Voronoi cells in the container, and outputs a custom
+ * string of information about each of them, using the control sequences of
+ * voronoicell_2d::output_custom.
+ * \param[in] format the custom output string to use.
+ * \param[in] fp a file handle to write to. */
+void container_2d::print_custom(const char *format,FILE *fp) {
+	voronoicell_2d c(max_len_sq);
+	double x,y;
+	c_loop_all_2d vl(*this);
+	if(vl.start()) do if(compute_cell(c,vl.ijk,vl.q)) {
+		vl.pos(x,y);
+		c.output_custom(format,vl.pid(),x,y,default_radius,fp);
+	} while(vl.inc());
+}
+
+}
@@ -0,0 +1,218 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file container_2d.hh
+ * \brief Header file for the container_2d and c_loop_all_2d classes. */
+
+#ifndef VOROPP_CONTAINER_2D_HH
+#define VOROPP_CONTAINER_2D_HH
+
+#include <cstdio>
+
+#include "config.hh"
+#include "common.hh"
+#include "cell_2d.hh"
+
+namespace voro {
+
+/** \brief Class for representing a particle system in a two-dimensional
+ * rectangular box.
+ *
+ * This class is the two-dimensional counterpart of the container class. The
+ * particles are sorted into a rectangular grid of blocks, and each Voronoi
+ * cell is computed by cutting a voronoicell_2d by the particles in the
+ * particle's own block, followed by the rings of blocks around it in order of
+ * increasing distance. A block is skipped if it is further away than twice the
+ * maximum distance to a vertex of the cell, and the search ends once a whole
+ * ring is that far away. The container can be periodic in either direction. */
+class container_2d {
+	public:
+		/** The minimum x coordinate of the container. */
+		const double ax;
+		/** The maximum x coordinate of the container. */
+		const double bx;
+		/** The minimum y coordinate of the container. */
+		const double ay;
+		/** The maximum y coordinate of the container. */
+		const double by;
+		/** The size of a computational block in the x direction. */
+		const double boxx;
+		/** The size of a computational block in the y direction. */
+		const double boxy;
+		/** The inverse box length in the x direction. */
+		const double xsp;
+		/** The inverse box length in the y direction. */
+		const double ysp;
+		/** The number of blocks in the x direction. */
+		const int nx;
+		/** The number of blocks in the y direction. */
+		const int ny;
+		/** The total number of blocks. */
+		const int nxy;
+		/** A boolean value that determines if the x coordinate is
+		 * periodic or not. */
+		const bool xperiodic;
+		/** A boolean value that determines if the y coordinate is
+		 * periodic or not. */
+		const bool yperiodic;
+		/** The maximum length squared that could be encountered in the
+		 * Voronoi cell calculation. */
+		const double max_len_sq;
+		/** This array holds the numerical IDs of each particle in each
+		 * computational block. */
+		int **id;
+		/** A two dimensional array holding particle positions, in
+		 * pairs of numbers. */
+		fpoint **p;
+		/** This array holds the number of particles within each
+		 * computational block of the container. */
+		int *co;
+		/** This array holds the maximum amount of particle memory for
+		 * each computational block of the container. */
+		int *mem;
+		container_2d(double ax_,double bx_,double ay_,double by_,int nx_,int ny_,
+				bool xperiodic_,bool yperiodic_,int init_mem);
+		~container_2d();
+		void clear();
+		void put(int n,double x,double y);
+		void import(FILE *fp=stdin,int nt=1);
+		/** Imports a list of particles from a file into the container.
+		 * Entries of three numbers (Particle ID, x position, y
+		 * position) are searched for. If the file cannot be
+		 * successfully read, then the routine causes a fatal error.
+		 * \param[in] filename the name of the file to open and read
+		 *                     from.
+		 * \param[in] nt the number of threads to use to parse
+		 *               the file. */
+		inline void import(const char* filename,int nt=1) {
+			FILE *fp=safe_fopen(filename,"r");
+			import(fp,nt);
+			fclose(fp);
+		}
+		/** Tests whether a point is inside the container.
+		 * \param[in] (x,y) the point to test.
+		 * \return True if the point is inside the container, false
+		 *         otherwise. */
+		inline bool point_inside(double x,double y) {
+			return (xperiodic||(x>=ax&&x<=bx))&&(yperiodic||(y>=ay&&y<=by));
+		}
+		int total_particles();
+		bool compute_cell(voronoicell_2d &c,int ijk,int q);
+		void compute_all_cells();
+		double sum_cell_areas();
+		void draw_particles(FILE *fp=stdout);
+		/** Dumps all of the particle IDs and positions to a file.
+		 * \param[in] filename the name of the file to write to. */
+		inline void draw_particles(const char *filename) {
+			FILE *fp=safe_fopen(filename,"w");
+			draw_particles(fp);
+			fclose(fp);
+		}
+		void draw_cells_gnuplot(FILE *fp=stdout);
+		/** Computes all of the Voronoi cells in the container, and
+		 * saves the output in gnuplot format.
+		 * \param[in] filename the name of the file to write to. */
+		inline void draw_cells_gnuplot(const char *filename) {
+			FILE *fp=safe_fopen(filename,"w");
+			draw_cells_gnuplot(fp);
+			fclose(fp);
+		}
+		void print_custom(const char *format,FILE *fp=stdout);
+		/** Computes all of the Voronoi cells in the container, and
+		 * outputs a custom string of information about each of them,
+		 * using the control sequences of voronoicell_2d::output_custom.
+		 * \param[in] format the custom output string to use.
+		 * \param[in] filename the name of the file to write to. */
+		inline void print_custom(const char *format,const char *filename) {
+			FILE *fp=safe_fopen(filename,"w");
+			print_custom(format,fp);
+			fclose(fp);
+		}
+	private:
+		void add_particle_memory(int i);
+		bool put_remap(int &ijk,double &x,double &y);
+		bool cut_block(voronoicell_2d &c,int ijk,int qs,double x,double y,double &mrs);
+		/** A custom int function that returns consistent stepping
+		 * for negative numbers, so that (-1.5, -0.5, 0.5, 1.5) maps
+		 * to (-2,-1,0,1).
+		 * \param[in] a the number to consider.
+		 * \return The value of the custom int operation. */
+		inline int step_int(double a) {return a<0?int(a)-1:int(a);}
+		/** A custom modulo function that returns consistent stepping
+		 * for negative numbers.
+		 * \param[in] (a,b) the input integers.
+		 * \return The value of a modulo b, consistently moving
+		 * downward. */
+		inline int step_mod(int a,int b) {return a>=0?a%b:b-1-(b-1-a)%b;}
+		/** A custom integer division function that returns consistent
+		 * stepping for negative numbers.
+		 * \param[in] (a,b) the input integers.
+		 * \return The value of a div b, consistently moving downward.
+		 */
+		inline int step_div(int a,int b) {return a>=0?a/b:-1+(a+1)/b;}
+};
+
+/** \brief Class for looping over all of the particles in a container_2d.
+ *
+ * This class plays the same role as the c_loop_all class does for the
+ * three-dimensional containers, stepping through the particles block by
+ * block. */
+class c_loop_all_2d {
+	public:
+		/** The index of the block that the current particle is in. */
+		int ijk;
+		/** The index of the current particle within its block. */
+		int q;
+		/** The constructor copies the necessary pointers from the
+		 * container.
+		 * \param[in] con the container to loop over. */
+		c_loop_all_2d(container_2d &con) : ijk(0), q(0), nxy(con.nxy),
+			co(con.co), id(con.id), p(con.p) {}
+		/** Sets the class to consider the first particle.
+		 * \return True if there is any particle to consider, false
+		 * otherwise. */
+		inline bool start() {
+			ijk=q=0;
+			while(co[ijk]==0) if(++ijk==nxy) return false;
+			return true;
+		}
+		/** Finds the next particle to test.
+		 * \return True if there is another particle, false if no more
+		 * particles are available. */
+		inline bool inc() {
+			q++;
+			if(q>=co[ijk]) {
+				q=0;
+				do {
+					if(++ijk==nxy) return false;
+				} while(co[ijk]==0);
+			}
+			return true;
+		}
+		/** Returns the position of the particle currently being
+		 * considered.
+		 * \param[out] (x,y) the position vector of the particle. */
+		inline void pos(double &x,double &y) {
+			fpoint *pp=p[ijk]+2*q;
+			x=*pp;y=pp[1];
+		}
+		/** Returns the ID of the particle currently being considered.
+		 * \return The ID of the particle. */
+		inline int pid() {return id[ijk][q];}
+	private:
+		/** The total number of blocks in the container. */
+		const int nxy;
+		/** A pointer to the particle counts of the container. */
+		int *co;
+		/** A pointer to the particle IDs of the container. */
+		int **id;
+		/** A pointer to the particle positions of the container. */
+		fpoint **p;
+};
+
+}
+
+#endif
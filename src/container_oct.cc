@@ -0,0 +1,262 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file container_oct.cc
+ * \brief Function implementations for the container_octree class. */
+
+#include "container_oct.hh"
+#include "text_reader.hh"
+
+namespace voro {
+
+/** The class constructor sets up the geometry of the container, and creates an
+ * octree made up of a single empty leaf that covers the whole container.
+ * \param[in] (ax_,bx_) the minimum and maximum x coordinates.
+ * \param[in] (ay_,by_) the minimum and maximum y coordinates.
+ * \param[in] (az_,bz_) the minimum and maximum z coordinates.
+ * \param[in] leaf_max_ the number of particles that a leaf can hold before it
+ *			is divided. */
+container_octree::container_octree(double ax_,double bx_,double ay_,double by_,double az_,double bz_,int leaf_max_)
+	: ax(ax_), bx(bx_), ay(ay_), by(by_), az(az_), bz(bz_),
+	max_len_sq((bx-ax)*(bx-ax)+(by-ay)*(by-ay)+(bz-az)*(bz-az)), leaf_max(leaf_max_),
+	ch(new int[init_octree_nodes]), lv(new int[init_octree_nodes]), tc(new int[init_octree_nodes]),
+	mid(new double[3*init_octree_nodes]), id(new voro_id*[init_octree_nodes]), p(new fpoint*[init_octree_nodes]),
+	co(new int[init_octree_nodes]), mem(new int[init_octree_nodes]), nmem(init_octree_nodes) {
+	if(leaf_max<1) voro_fatal_error("The octree leaf size must be positive",VOROPP_INTERNAL_ERROR);
+	for(int l=0;l<=octree_max_depth;l++) {
+		double f=0.5/(1<<l);
+		hw[3*l]=(bx-ax)*f;hw[3*l+1]=(by-ay)*f;hw[3*l+2]=(bz-az)*f;
+	}
+	*mid=0.5*(ax+bx);mid[1]=0.5*(ay+by);mid[2]=0.5*(az+bz);
+	*ch=-1;*lv=0;*tc=0;*id=NULL;*p=NULL;*co=0;*mem=0;nn=1;
+}
+
+/** The class destructor frees the dynamically allocated memory. */
+container_octree::~container_octree() {
+	for(int l=0;l<nn;l++) if(mem[l]>0) {
+		delete [] p[l];
+		delete [] id[l];
+	}
+	delete [] mem;
+	delete [] co;
+	delete [] p;
+	delete [] id;
+	delete [] mid;
+	delete [] tc;
+	delete [] lv;
+	delete [] ch;
+}
+
+/** Clears a container of particles, returning the octree to a single empty
+ * leaf. */
+void container_octree::clear() {
+	for(int l=0;l<nn;l++) if(mem[l]>0) {
+		delete [] p[l];
+		delete [] id[l];
+	}
+	*ch=-1;*tc=0;*id=NULL;*p=NULL;*co=0;*mem=0;nn=1;
+}
+
+/** Put a particle into the leaf of the octree that contains it. If the leaf is
+ * full, then it is divided into eight.
+ * \param[in] n the numerical ID of the inserted particle.
+ * \param[in] (x,y,z) the position vector of the inserted particle. */
+void container_octree::put(voro_id n,double x,double y,double z) {
+	if(!point_inside(x,y,z)) {
+#if VOROPP_REPORT_OUT_OF_BOUNDS ==1
+		fprintf(stderr,"Out of bounds: (x,y,z)=(%g,%g,%g)\n",x,y,z);
+#endif
+		return;
+	}
+
+	// Find the leaf that contains the particle, counting the particle in
+	// each node on the way
+	int l=0;
+	(*tc)++;
+	while(ch[l]>=0) {l=ch[l]+child_index(l,x,y,z);tc[l]++;}
+
+	// Divide the leaf if it is full, unless it is at the maximum depth
+	while(co[l]==leaf_max&&lv[l]<octree_max_depth) {
+		split(l);
+		l=ch[l]+child_index(l,x,y,z);tc[l]++;
+	}
+	if(co[l]==mem[l]) add_particle_memory(l);
+	id[l][co[l]]=n;
+	fpoint *pp=p[l]+3*co[l]++;
+	*(pp++)=x;*(pp++)=y;*pp=z;
+}
+
+/** Divides a leaf of the octree into eight children, and moves its particles
+ * into them.
+ * \param[in] n the index of the leaf to divide. */
+void container_octree::split(int n) {
+	int c,l,m;
+	while(nn+8>nmem) add_node_memory();
+
+	// Set up the children, whose centers are offset from the center of
+	// the leaf by their half-widths
+	double *mp=mid+3*n,*wp=hw+3*(lv[n]+1),*cp;
+	ch[n]=nn;
+	for(c=0;c<8;c++) {
+		m=nn+c;cp=mid+3*m;
+		ch[m]=-1;lv[m]=lv[n]+1;tc[m]=0;
+		id[m]=NULL;p[m]=NULL;co[m]=0;mem[m]=0;
+		*cp=*mp+(c&1?*wp:-*wp);
+		cp[1]=mp[1]+(c&2?wp[1]:-wp[1]);
+		cp[2]=mp[2]+(c&4?wp[2]:-wp[2]);
+	}
+	nn+=8;
+
+	// Move the particles into the children, and free the memory of the
+	// leaf
+	fpoint *pp=p[n],*qp;
+	for(l=0;l<co[n];l++,pp+=3) {
+		m=ch[n]+child_index(n,*pp,pp[1],pp[2]);
+		if(co[m]==mem[m]) add_particle_memory(m);
+		id[m][co[m]]=id[n][l];
+		qp=p[m]+3*co[m]++;
+		*(qp++)=*pp;*(qp++)=pp[1];*qp=pp[2];
+		tc[m]++;
+	}
+	delete [] p[n];
+	delete [] id[n];
+	id[n]=NULL;p[n]=NULL;co[n]=0;mem[n]=0;
+}
+
+/** Doubles the memory allocation for the nodes of the octree. */
+void container_octree::add_node_memory() {
+	int l,nm=nmem<<1;
+	if(nm>max_octree_nodes)
+		voro_fatal_error("Absolute maximum octree memory allocation exceeded",VOROPP_MEMORY_ERROR);
+#if VOROPP_VERBOSE >=3
+	fprintf(stderr,"Octree memory scaled up to %d\n",nm);
+#endif
+	int *nch=new int[nm],*nlv=new int[nm],*ntc=new int[nm],*nco=new int[nm],*nme=new int[nm];
+	voro_id **nid=new voro_id*[nm];
+	double *nmid=new double[3*nm];
+	fpoint **np=new fpoint*[nm];
+	for(l=0;l<nn;l++) {
+		nch[l]=ch[l];nlv[l]=lv[l];ntc[l]=tc[l];
+		nid[l]=id[l];np[l]=p[l];nco[l]=co[l];nme[l]=mem[l];
+	}
+	for(l=0;l<3*nn;l++) nmid[l]=mid[l];
+	delete [] ch;ch=nch;
+	delete [] lv;lv=nlv;
+	delete [] tc;tc=ntc;
+	delete [] mid;mid=nmid;
+	delete [] id;id=nid;
+	delete [] p;p=np;
+	delete [] co;co=nco;
+	delete [] mem;mem=nme;
+	nmem=nm;
+}
+
+/** Increases the particle memory of a leaf, doubling the current allocation,
+ * or allocating space for leaf_max particles if no memory has been allocated.
+ * \param[in] n the index of the leaf. */
+void container_octree::add_particle_memory(int n) {
+	int l,nm=mem[n]>0?mem[n]<<1:leaf_max;
+	if(nm>max_particle_memory)
+		voro_fatal_error("Absolute maximum memory allocation exceeded",VOROPP_MEMORY_ERROR);
+#if VOROPP_VERBOSE >=3
+	if(mem[n]>0) fprintf(stderr,"Particle memory in leaf %d scaled up to %d\n",n,nm);
+#endif
+	voro_id *idp=new voro_id[nm];
+	for(l=0;l<co[n];l++) idp[l]=id[n][l];
+	fpoint *pp=new fpoint[3*nm];
+	for(l=0;l<3*co[n];l++) pp[l]=p[n][l];
+	if(mem[n]>0) {
+		delete [] id[n];
+		delete [] p[n];
+	}
+	mem[n]=nm;id[n]=idp;p[n]=pp;
+}
+
+/** Import a list of particles from an open file stream into the container.
+ * Entries of four numbers (Particle ID, x position, y position, z position)
+ * are searched for. If the file cannot be successfully read, then the routine
+ * causes a fatal error.
+ * \param[in] fp the file handle to read from.
+ * \param[in] nt the number of threads to use to parse the file. */
+void container_octree::import(FILE *fp,int nt) {
+	text_reader tr(fp,3,nt);
+	while(tr.next()) for(unsigned int i=0;i<tr.id.size();i++)
+		put(tr.id[i],tr.v[3*i],tr.v[3*i+1],tr.v[3*i+2]);
+}
+
+/** Computes all of the Voronoi cells in the container, but does nothing
+ * with the output. It is useful for measuring the pure computation time
+ * of the Voronoi algorithm, without any additional calculations such as
+ * volume evaluation or cell output. */
+void container_octree::compute_all_cells() {
+	voronoicell c(*this);
+	for(int ijk=0;ijk<nn;ijk++) for(int q=0;q<co[ijk];q++) compute_cell(c,ijk,q);
+}
+
+/** Calculates all of the Voronoi cells and sums their volumes. In most cases
+ * without walls, the sum of the Voronoi cell volumes should equal the volume
+ * of the container to numerical precision.
+ * \return The sum of all of the computed Voronoi volumes. */
+double container_octree::sum_cell_volumes() {
+	voronoicell c(*this);
+	double vol=0;
+	for(int ijk=0;ijk<nn;ijk++) for(int q=0;q<co[ijk];q++)
+		if(compute_cell(c,ijk,q)) vol+=c.volume();
+	return vol;
+}
+
+/** Dumps all of the particle IDs and positions to a file.
+ * \param[in] fp a file handle to write to. */
+void container_octree::draw_particles(FILE *fp) {
+	fpoint *pp;
+	for(int ijk=0;ijk<nn;ijk++) for(int q=0;q<co[ijk];q++) {
+		pp=p[ijk]+3*q;
+		fprintf(fp,"%ld %g %g %g\n",long(id[ijk][q]),*pp,pp[1],pp[2]);
+	}
+}
+
+/** Computes all Voronoi cells and saves the output in gnuplot format.
+ * \param[in] fp a file handle to write to. */
+void container_octree::draw_cells_gnuplot(FILE *fp) {
+	voronoicell c(*this);fpoint *pp;
+	for(int ijk=0;ijk<nn;ijk++) for(int q=0;q<co[ijk];q++) if(compute_cell(c,ijk,q)) {
+		pp=p[ijk]+3*q;
+		c.draw_gnuplot(*pp,pp[1],pp[2],fp);
+	}
+}
+
+/** Computes all the Voronoi cells and saves customized information about them.
+ * \param[in] format the custom output string to use.
+ * \param[in] fp a file handle to write to. */
+void container_octree::print_custom(const char *format,FILE *fp) {
+	compiled_format fm(format);
+	if(fm.neighbor()) print_custom<voronoicell_neighbor>(fm,fp);
+	else print_custom<voronoicell>(fm,fp);
+}
+
+/** Computes all the Voronoi cells and saves customized information about them.
+ * \param[in] format the custom output string to use.
+ * \param[in] filename the name of the file to write to. */
+void container_octree::print_custom(const char *format,const char *filename) {
+	FILE *fp=safe_fopen(filename,"w");
+	print_custom(format,fp);
+	fclose(fp);
+}
+
+/** Computes all the Voronoi cells and writes them with a compiled custom
+ * output format.
+ * \param[in] fm the compiled custom output format.
+ * \param[in] fp a file handle to write to. */
+template<class v_cell>
+void container_octree::print_custom(compiled_format &fm,FILE *fp) {
+	v_cell c(*this);fpoint *pp;
+	for(int ijk=0;ijk<nn;ijk++) for(int q=0;q<co[ijk];q++) if(compute_cell(c,ijk,q)) {
+		pp=p[ijk]+3*q;
+		fm.write(c,id[ijk][q],*pp,pp[1],pp[2],default_radius,fp);
+	}
+}
+
+}
@@ -0,0 +1,284 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file container_oct.hh
+ * \brief Header file for the container_octree class. */
+
+#ifndef VOROPP_CONTAINER_OCT_HH
+#define VOROPP_CONTAINER_OCT_HH
+
+#include <cstdio>
+#include <vector>
+#include <algorithm>
+
+#include "config.hh"
+#include "common.hh"
+#include "cell.hh"
+#include "container.hh"
+
+namespace voro {
+
+/** \brief An entry in the search queue of the container_octree class. */
+struct octree_entry {
+	/** The minimum distance squared from the particle being computed to
+	 * the node. */
+	double d;
+	/** The index of the node. */
+	int n;
+	octree_entry(double d_,int n_) : d(d_), n(n_) {}
+	/** Orders the entries so that the standard heap routines put the
+	 * closest node at the top of the heap. */
+	inline bool operator<(const octree_entry &e) const {return d>e.d;}
+};
+
+/** \brief Class for representing a particle system in a rectangular box, using
+ * an adaptive octree in place of a uniform grid of blocks.
+ *
+ * The container and container_poly classes sort the particles into a uniform
+ * grid of blocks, which works well when the particles are roughly evenly
+ * distributed. If dense clusters of particles are surrounded by nearly empty
+ * space, then no grid size works well: a coarse grid puts too many particles
+ * in each block of the clusters, while a fine grid allocates memory for a very
+ * large number of empty blocks, and makes the cells in the empty regions test
+ * a large number of blocks.
+ *
+ * This class stores the particles in an octree. The root node covers the whole
+ * container, and a leaf is divided into eight equal children once it holds
+ * more than a given number of particles, so that the leaves are small where
+ * the particles are dense and large where they are sparse. The memory for the
+ * particles in a leaf is only allocated when the first particle is added to
+ * it. The voro_compute class relies on the blocks being a uniform grid, so the
+ * Voronoi cells are computed by a best-first search over the nodes in order of
+ * their distance from the particle. A node is skipped, and the search ends,
+ * once the distance to it exceeds twice the maximum distance to a vertex of
+ * the cell, which is the same radius bound that voro_compute uses. The class
+ * computes the regular Voronoi tessellation of a non-periodic container. The
+ * particles are referenced by the index of their leaf and their index within
+ * it, in the same way as the blocks of the other container classes. */
+class container_octree : public wall_list {
+	public:
+		/** The minimum x coordinate of the container. */
+		const double ax;
+		/** The maximum x coordinate of the container. */
+		const double bx;
+		/** The minimum y coordinate of the container. */
+		const double ay;
+		/** The maximum y coordinate of the container. */
+		const double by;
+		/** The minimum z coordinate of the container. */
+		const double az;
+		/** The maximum z coordinate of the container. */
+		const double bz;
+		/** The maximum length squared that could be encountered in the
+		 * Voronoi cell calculation. */
+		const double max_len_sq;
+		/** The number of particles that a leaf can hold before it is
+		 * divided. */
+		const int leaf_max;
+		/** The number of nodes in the octree. */
+		int nn;
+		/** The index of the first of the eight children of each node,
+		 * or -1 if the node is a leaf. */
+		int *ch;
+		/** The depth of each node, where the root node has depth
+		 * zero. */
+		int *lv;
+		/** The number of particles within each node, including those
+		 * in all of its descendants. */
+		int *tc;
+		/** The center of each node, in groups of three. */
+		double *mid;
+		/** This array holds the numerical IDs of the particles in each
+		 * leaf. */
+		voro_id **id;
+		/** This array holds the positions of the particles in each
+		 * leaf. */
+		fpoint **p;
+		/** This array holds the number of particles in each leaf. */
+		int *co;
+		/** This array holds the amount of particle memory allocated
+		 * for each leaf, which is zero if no memory has been
+		 * allocated. */
+		int *mem;
+		container_octree(double ax_,double bx_,double ay_,double by_,double az_,double bz_,
+				int leaf_max_=octree_leaf_max);
+		~container_octree();
+		void clear();
+		void put(voro_id n,double x,double y,double z);
+		void import(FILE *fp=stdin,int nt=1);
+		/** Imports a list of particles from a file into the container.
+		 * Entries of four numbers (Particle ID, x position, y position,
+		 * z position) are searched for. If the file cannot be
+		 * successfully read, then the routine causes a fatal error.
+		 * \param[in] filename the name of the file to open and read
+		 *                     from.
+		 * \param[in] nt the number of threads to use to parse
+		 *               the file. */
+		inline void import(const char* filename,int nt=1) {
+			FILE *fp=safe_fopen(filename,"r");
+			import(fp,nt);
+			fclose(fp);
+		}
+		/** Tests whether a point is inside the container.
+		 * \param[in] (x,y,z) the point to test.
+		 * \return True if the point is inside the container, false
+		 *         otherwise. */
+		inline bool point_inside(double x,double y,double z) {
+			return x>=ax&&x<=bx&&y>=ay&&y<=by&&z>=az&&z<=bz;
+		}
+		/** Tests whether a batch of points are inside the container.
+		 * \param[in] n the number of points.
+		 * \param[in] pp an array of the points, in groups of three.
+		 * \param[out] m a mask that is set to one for the points that
+		 *		 are inside the container, and zero for the
+		 *		 others. */
+		inline void points_inside(int n,const double *pp,unsigned char *m) {
+			for(int i=0;i<n;i++) {
+				const double *q=pp+3*i;
+				m[i]=(*q>=ax)&(*q<=bx)&(q[1]>=ay)&(q[1]<=by)&(q[2]>=az)&(q[2]<=bz);
+			}
+		}
+		/** Returns the total number of stored particles.
+		 * \return The number of particles. */
+		inline voro_id total_particles() {return *tc;}
+		/** Finds the leaf of the octree that contains a given point,
+		 * which must be inside the container.
+		 * \param[in] (x,y,z) the point to consider.
+		 * \return The index of the leaf. */
+		inline int region_index(double x,double y,double z) {
+			int n=0;
+			while(ch[n]>=0) n=ch[n]+child_index(n,x,y,z);
+			return n;
+		}
+		/** Initializes the Voronoi cell prior to a compute_cell
+		 * operation, so that it fills the container. Plane cuts made
+		 * by any walls that have been added are then applied to the
+		 * cell.
+		 * \param[in,out] c a reference to a voronoicell object.
+		 * \param[in] ijk the leaf that the particle is within.
+		 * \param[in] q the index of the particle within the leaf.
+		 * \param[out] (x,y,z) the position of the particle.
+		 * \return False if the plane cuts applied by walls completely
+		 * removed the cell, true otherwise. */
+		template<class v_cell>
+		inline bool initialize_voronoicell(v_cell &c,int ijk,int q,double &x,double &y,double &z) {
+			fpoint *pp=p[ijk]+3*q;
+			x=*(pp++);y=*(pp++);z=*pp;
+			c.init(ax-x,bx-x,ay-y,by-y,az-z,bz-z);
+			return apply_walls(c,x,y,z);
+		}
+		/** Computes the Voronoi cell for a particle, by cutting it
+		 * with the particles in the nodes of the octree in order of
+		 * their distance, until the remaining nodes are too far away
+		 * to cut it.
+		 * \param[out] c a Voronoi cell class in which to store the
+		 * 		 computed cell.
+		 * \param[in] ijk the leaf that the particle is within.
+		 * \param[in] q the index of the particle within the leaf.
+		 * \return True if the cell was computed. If the cell cannot be
+		 * computed, if it is removed entirely by a wall, then the
+		 * routine returns false. */
+		template<class v_cell>
+		bool compute_cell(v_cell &c,int ijk,int q) {
+			double x,y,z,x1,y1,z1,rs,mrs;
+			int l,n;fpoint *pp;bool cut;
+			if(!initialize_voronoicell(c,ijk,q,x,y,z)) return false;
+			mrs=c.max_radius_squared();
+			hp.clear();
+			hp.push_back(octree_entry(0,0));
+			while(!hp.empty()) {
+
+				// Take the closest node from the queue, and stop
+				// if it is too far away to cut the cell
+				std::pop_heap(hp.begin(),hp.end());
+				rs=hp.back().d;n=hp.back().n;hp.pop_back();
+				if(rs>mrs) break;
+
+				// Add the non-empty children of the node to the
+				// queue, or cut the cell by the particles of a
+				// leaf and update the maximum radius
+				if(ch[n]>=0) {
+					for(l=ch[n];l<ch[n]+8;l++) if(tc[l]>0) {
+						rs=node_distance(l,x,y,z);
+						if(rs<=mrs) {
+							hp.push_back(octree_entry(rs,l));
+							std::push_heap(hp.begin(),hp.end());
+						}
+					}
+				} else {
+					cut=false;
+					for(l=0,pp=p[n];l<co[n];l++,pp+=3) if(n!=ijk||l!=q) {
+						x1=*pp-x;y1=pp[1]-y;z1=pp[2]-z;
+						rs=x1*x1+y1*y1+z1*z1;
+						if(rs<mrs) {
+							if(!c.nplane(x1,y1,z1,rs,id[n][l])) return false;
+							cut=true;
+						}
+					}
+					if(cut) mrs=c.max_radius_squared();
+				}
+			}
+			return apply_far_walls(c,x,y,z);
+		}
+		void compute_all_cells();
+		double sum_cell_volumes();
+		void draw_particles(FILE *fp=stdout);
+		/** Dumps all of the particle IDs and positions to a file.
+		 * \param[in] filename the name of the file to write to. */
+		inline void draw_particles(const char *filename) {
+			FILE *fp=safe_fopen(filename,"w");
+			draw_particles(fp);
+			fclose(fp);
+		}
+		void draw_cells_gnuplot(FILE *fp=stdout);
+		/** Computes all Voronoi cells and saves the output in gnuplot
+		 * format.
+		 * \param[in] filename the name of the file to write to. */
+		inline void draw_cells_gnuplot(const char *filename) {
+			FILE *fp=safe_fopen(filename,"w");
+			draw_cells_gnuplot(fp);
+			fclose(fp);
+		}
+		void print_custom(const char *format,FILE *fp=stdout);
+		void print_custom(const char *format,const char *filename);
+	private:
+		/** The current amount of memory allocated for the nodes. */
+		int nmem;
+		/** The half-widths of the nodes at each depth, in groups of
+		 * three. */
+		double hw[3*(octree_max_depth+1)];
+		/** The search queue used by the compute_cell routine. */
+		std::vector<octree_entry> hp;
+		/** Calculates which child of a node contains a given point.
+		 * \param[in] n the index of the node.
+		 * \param[in] (x,y,z) the point to consider.
+		 * \return The index of the child, from zero to seven. */
+		inline int child_index(int n,double x,double y,double z) {
+			double *mp=mid+3*n;
+			return (x<*mp?0:1)|(y<mp[1]?0:2)|(z<mp[2]?0:4);
+		}
+		/** Calculates the minimum distance squared from a point to a
+		 * node.
+		 * \param[in] n the index of the node.
+		 * \param[in] (x,y,z) the point to consider.
+		 * \return The distance squared. */
+		inline double node_distance(int n,double x,double y,double z) {
+			double *mp=mid+3*n,*wp=hw+3*lv[n],dx,dy,dz;
+			dx=fabs(x-*mp)-*wp;if(dx<0) dx=0;
+			dy=fabs(y-mp[1])-wp[1];if(dy<0) dy=0;
+			dz=fabs(z-mp[2])-wp[2];if(dz<0) dz=0;
+			return dx*dx+dy*dy+dz*dz;
+		}
+		void add_node_memory();
+		void add_particle_memory(int n);
+		void split(int n);
+		template<class v_cell>
+		void print_custom(compiled_format &fm,FILE *fp);
+};
+
+}
+
+#endif
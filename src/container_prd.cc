@@ -9,6 +9,14 @@
  * related classes. */
 
 #include "container_prd.hh"
+#include "particle_file.hh"
+#include "text_reader.hh"
+#include "column_writer.hh"
+#include "state_file.hh"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 namespace voro {
 
@@ -31,8 +39,36 @@ container_periodic_base::container_periodic_base(double bx_,double bxy_,double b
 	: unitcell(bx_,bxy_,by_,bxz_,byz_,bz_),
 	voro_base(nx_,ny_,nz_,bx_/nx_,by_/ny_,bz_/nz_), max_len_sq(unit_voro.max_radius_squared()),
 	ey(int(max_uv_y*ysp+1)), ez(int(max_uv_z*zsp+1)), wy(ny+ey), wz(nz+ez),
-	oy(ny+2*ey), oz(nz+2*ez), oxyz(nx*oy*oz), id(new int*[oxyz]), p(new double*[oxyz]),
-	co(new int[oxyz]), mem(new int[oxyz]), img(new char[oxyz]), init_mem(init_mem_), ps(ps_) {
+	oy(ny+2*ey), oz(nz+2*ez), oxyz(nx*oy*oz), id(new voro_id*[oxyz]), p(new fpoint*[oxyz]),
+	co(new int[oxyz]), mem(new int[oxyz]), img(new char[oxyz]), init_mem(init_mem_), ps(ps_),
+	update_count(0) {
+	setup_blocks();
+}
+
+/** The class constructor sets up the geometry of the container from a unit
+ * cell descriptor, copying its unit Voronoi cell and any cached periodic
+ * images rather than computing them. If the descriptor has cached the block
+ * grid tables for this grid with unitcell::cache_grid(), then the worklists
+ * are copied as well.
+ * \param[in] uc the unit cell descriptor.
+ * \param[in] (nx_,ny_,nz_) the number of grid blocks in each of the three
+ *                       coordinate directions.
+ * \param[in] init_mem_ the initial memory allocation for each block.
+ * \param[in] ps_ the number of floating point entries to store for each
+ *                particle. */
+container_periodic_base::container_periodic_base(const unitcell &uc,int nx_,int ny_,int nz_,int init_mem_,int ps_)
+	: unitcell(uc),
+	voro_base(nx_,ny_,nz_,uc.bx/nx_,uc.by/ny_,uc.bz/nz_,uc.cached_grid(nx_,ny_,nz_)), max_len_sq(unit_voro.max_radius_squared()),
+	ey(int(max_uv_y*ysp+1)), ez(int(max_uv_z*zsp+1)), wy(ny+ey), wz(nz+ez),
+	oy(ny+2*ey), oz(nz+2*ez), oxyz(nx*oy*oz), id(new voro_id*[oxyz]), p(new fpoint*[oxyz]),
+	co(new int[oxyz]), mem(new int[oxyz]), img(new char[oxyz]), init_mem(init_mem_), ps(ps_),
+	update_count(0) {
+	setup_blocks();
+}
+
+/** Clears the block arrays, and sets up the memory for the blocks in the
+ * primary domain. This is called by the constructors. */
+void container_periodic_base::setup_blocks() {
 	int i,j,k,l;
 
 	// Clear the global arrays
@@ -44,13 +80,26 @@ container_periodic_base::container_periodic_base(double bx_,double bxy_,double b
 	for(k=ez;k<wz;k++) for(j=ey;j<wy;j++) for(i=0;i<nx;i++) {
 		l=i+nx*(j+oy*k);
 		mem[l]=init_mem;
-		id[l]=new int[init_mem];
-		p[l]=new double[ps*init_mem];
+		id[l]=new voro_id[init_mem];
+		p[l]=new fpoint[ps*init_mem];
 	}
+	recount_slots(mem,oxyz,false);
+#ifdef _OPENMP
+	omp_lock_t *lp=new omp_lock_t[oz];
+	for(k=0;k<oz;k++) omp_init_lock(lp+k);
+	ilk=lp;
+#else
+	ilk=NULL;
+#endif
 }
 
 /** The container destructor frees the dynamically allocated memory. */
 container_periodic_base::~container_periodic_base() {
+#ifdef _OPENMP
+	omp_lock_t *lp=static_cast<omp_lock_t*>(ilk);
+	for(int k=0;k<oz;k++) omp_destroy_lock(lp+k);
+	delete [] lp;
+#endif
 	for(int l=oxyz-1;l>=0;l--) if(mem[l]>0) {
 		delete [] p[l];
 		delete [] id[l];
@@ -61,6 +110,31 @@ container_periodic_base::~container_periodic_base() {
 	delete [] id;
 	delete [] p;
 }
+/** Saves the particles, the periodic images, and the block structure of the
+ * container to a binary state file.
+ * \param[in] filename the name of the file to write to.
+ * \param[in] mr the maximum particle radius to store. */
+void container_periodic_base::save_state(const char *filename,double mr) {
+	int a[4]={ey,ez,oy,oz};
+	double g[6]={bx,bxy,by,bxz,byz,bz};
+	write_state_file(filename,1,ps,nx,ny,nz,oxyz,a,g,mr,id,p,co,img);
+}
+
+/** Restores the particles, the periodic images, and the block structure of
+ * the container from a binary state file. The mapped file is copied directly
+ * into the block arrays, so that neither the particles nor their periodic
+ * images need to be created again.
+ * \param[in] filename the name of the file to read.
+ * \return The maximum particle radius that was stored in the file. */
+double container_periodic_base::load_state(const char *filename) {
+	int a[4]={ey,ez,oy,oz};
+	double g[6]={bx,bxy,by,bxz,byz,bz};
+	update_count++;
+	double mr=read_state_file(filename,1,ps,nx,ny,nz,oxyz,a,g,id,p,co,mem,img,init_mem);
+	recount_slots(mem,oxyz,false);
+	return mr;
+}
+
 
 /** The class constructor sets up the geometry of container.
  * \param[in] (bx_) The x coordinate of the first unit vector.
@@ -75,6 +149,16 @@ container_periodic::container_periodic(double bx_,double bxy_,double by_,double
 	: container_periodic_base(bx_,bxy_,by_,bxz_,byz_,bz_,nx_,ny_,nz_,init_mem_,3),
 	vc(*this,2*nx_+1,2*ey+1,2*ez+1) {}
 
+/** The class constructor sets up the geometry of container from a unit cell
+ * descriptor, as described for the container_periodic_base class.
+ * \param[in] uc the unit cell descriptor.
+ * \param[in] (nx_,ny_,nz_) the number of grid blocks in each of the three
+ *			    coordinate directions.
+ * \param[in] init_mem_ the initial memory allocation for each block. */
+container_periodic::container_periodic(const unitcell &uc,int nx_,int ny_,int nz_,int init_mem_)
+	: container_periodic_base(uc,nx_,ny_,nz_,init_mem_,3),
+	vc(*this,2*nx_+1,2*ey+1,2*ez+1) {}
+
 /** The class constructor sets up the geometry of container.
  * \param[in] (bx_) The x coordinate of the first unit vector.
  * \param[in] (bxy_,by_) The x and y coordinates of the second unit vector.
@@ -88,15 +172,25 @@ container_periodic_poly::container_periodic_poly(double bx_,double bxy_,double b
 	: container_periodic_base(bx_,bxy_,by_,bxz_,byz_,bz_,nx_,ny_,nz_,init_mem_,4),
 	vc(*this,2*nx_+1,2*ey+1,2*ez+1) {ppr=p;}
 
+/** The class constructor sets up the geometry of container from a unit cell
+ * descriptor, as described for the container_periodic_base class.
+ * \param[in] uc the unit cell descriptor.
+ * \param[in] (nx_,ny_,nz_) the number of grid blocks in each of the three
+ *			    coordinate directions.
+ * \param[in] init_mem_ the initial memory allocation for each block. */
+container_periodic_poly::container_periodic_poly(const unitcell &uc,int nx_,int ny_,int nz_,int init_mem_)
+	: container_periodic_base(uc,nx_,ny_,nz_,init_mem_,4),
+	vc(*this,2*nx_+1,2*ey+1,2*ez+1) {ppr=p;}
+
 /** Put a particle into the correct region of the container.
  * \param[in] n the numerical ID of the inserted particle.
  * \param[in] (x,y,z) the position vector of the inserted particle. */
-void container_periodic::put(int n,double x,double y,double z) {
+void container_periodic::put(voro_id n,double x,double y,double z) {
 	int ijk;
 	put_locate_block(ijk,x,y,z);
 	for(int l=0;l<co[ijk];l++) check_duplicate(n,x,y,z,id[ijk][l],p[ijk]+3*l);
 	id[ijk][co[ijk]]=n;
-	double *pp=p[ijk]+3*co[ijk]++;
+	fpoint *pp=p[ijk]+3*co[ijk]++;
 	*(pp++)=x;*(pp++)=y;*pp=z;
 }
 
@@ -104,12 +198,12 @@ void container_periodic::put(int n,double x,double y,double z) {
  * \param[in] n the numerical ID of the inserted particle.
  * \param[in] (x,y,z) the position vector of the inserted particle.
  * \param[in] r the radius of the particle. */
-void container_periodic_poly::put(int n,double x,double y,double z,double r) {
+void container_periodic_poly::put(voro_id n,double x,double y,double z,double r) {
 	int ijk;
 	put_locate_block(ijk,x,y,z);
 	for(int l=0;l<co[ijk];l++) check_duplicate(n,x,y,z,id[ijk][l],p[ijk]+4*l);
 	id[ijk][co[ijk]]=n;
-	double *pp=p[ijk]+4*co[ijk]++;
+	fpoint *pp=p[ijk]+4*co[ijk]++;
 	*(pp++)=x;*(pp++)=y;*(pp++)=z;*pp=r;
 	if(max_radius<r) max_radius=r;
 }
@@ -120,12 +214,12 @@ void container_periodic_poly::put(int n,double x,double y,double z,double r) {
  * \param[out] (ai,aj,ak) the periodic image displacement that the particle is
  * 			  in, with (0,0,0) corresponding to the primary domain.
  */
-void container_periodic::put(int n,double x,double y,double z,int &ai,int &aj,int &ak) {
+void container_periodic::put(voro_id n,double x,double y,double z,int &ai,int &aj,int &ak) {
 	int ijk;
 	put_locate_block(ijk,x,y,z,ai,aj,ak);
 	for(int l=0;l<co[ijk];l++) check_duplicate(n,x,y,z,id[ijk][l],p[ijk]+3*l);
 	id[ijk][co[ijk]]=n;
-	double *pp=p[ijk]+3*co[ijk]++;
+	fpoint *pp=p[ijk]+3*co[ijk]++;
 	*(pp++)=x;*(pp++)=y;*pp=z;
 }
 
@@ -136,13 +230,13 @@ void container_periodic::put(int n,double x,double y,double z,int &ai,int &aj,in
  * \param[out] (ai,aj,ak) the periodic image displacement that the particle is
  * 			  in, with (0,0,0) corresponding to the primary domain.
  */
-void container_periodic_poly::put(int n,double x,double y,double z,double r,int &ai,int &aj,int &ak) {
+void container_periodic_poly::put(voro_id n,double x,double y,double z,double r,int &ai,int &aj,int &ak) {
 	int ijk;
 	put_locate_block(ijk,x,y,z,ai,aj,ak);
 	for(int l=0;l<co[ijk];l++) check_duplicate(n,x,y,z,id[ijk][l],p[ijk]+4*l);
 
 	id[ijk][co[ijk]]=n;
-	double *pp=p[ijk]+4*co[ijk]++;
+	fpoint *pp=p[ijk]+4*co[ijk]++;
 	*(pp++)=x;*(pp++)=y;*(pp++)=z;*pp=r;
 	if(max_radius<r) max_radius=r;
 }
@@ -152,12 +246,12 @@ void container_periodic_poly::put(int n,double x,double y,double z,double r,int
  * \param[in] vo the ordering class in which to record the region.
  * \param[in] n the numerical ID of the inserted particle.
  * \param[in] (x,y,z) the position vector of the inserted particle. */
-void container_periodic::put(particle_order &vo,int n,double x,double y,double z) {
+void container_periodic::put(particle_order &vo,voro_id n,double x,double y,double z) {
 	int ijk;
 	put_locate_block(ijk,x,y,z);
 	id[ijk][co[ijk]]=n;
 	vo.add(ijk,co[ijk]);
-	double *pp=p[ijk]+3*co[ijk]++;
+	fpoint *pp=p[ijk]+3*co[ijk]++;
 	*(pp++)=x;*(pp++)=y;*pp=z;
 }
 
@@ -167,26 +261,22 @@ void container_periodic::put(particle_order &vo,int n,double x,double y,double z
  * \param[in] n the numerical ID of the inserted particle.
  * \param[in] (x,y,z) the position vector of the inserted particle.
  * \param[in] r the radius of the particle. */
-void container_periodic_poly::put(particle_order &vo,int n,double x,double y,double z,double r) {
+void container_periodic_poly::put(particle_order &vo,voro_id n,double x,double y,double z,double r) {
 	int ijk;
 	put_locate_block(ijk,x,y,z);
 	id[ijk][co[ijk]]=n;
 	vo.add(ijk,co[ijk]);
-	double *pp=p[ijk]+4*co[ijk]++;
+	fpoint *pp=p[ijk]+4*co[ijk]++;
 	*(pp++)=x;*(pp++)=y;*(pp++)=z;*pp=r;
 	if(max_radius<r) max_radius=r;
 }
 
-/** Takes a particle position vector and computes the region index into which
- * it should be stored. If the container is periodic, then the routine also
- * maps the particle position to ensure it is in the primary domain. If the
- * container is not periodic, the routine bails out.
+/** Takes a particle position vector, maps it into the primary domain, and
+ * computes the region index into which it should be stored.
  * \param[out] ijk the region index.
  * \param[in,out] (x,y,z) the particle position, remapped into the primary
- *                        domain if necessary.
- * \return True if the particle can be successfully placed into the container,
- * false otherwise. */
-void container_periodic_base::put_locate_block(int &ijk,double &x,double &y,double &z) {
+ *                        domain if necessary. */
+inline void container_periodic_base::put_remap(int &ijk,double &x,double &y,double &z) {
 
 	// Remap particle in the z direction if necessary
 	int k=step_int(z*zsp);
@@ -209,9 +299,23 @@ void container_periodic_base::put_locate_block(int &ijk,double &x,double &y,doub
 		x-=ai*bx;ijk-=ai*nx;
 	}
 
-	// Compute the block index and check memory allocation
+	// Compute the block index
 	j+=ey;k+=ez;
 	ijk+=nx*(j+oy*k);
+}
+
+/** Takes a particle position vector and computes the region index into which
+ * it should be stored. If the container is periodic, then the routine also
+ * maps the particle position to ensure it is in the primary domain. If the
+ * container is not periodic, the routine bails out.
+ * \param[out] ijk the region index.
+ * \param[in,out] (x,y,z) the particle position, remapped into the primary
+ *                        domain if necessary.
+ * \return True if the particle can be successfully placed into the container,
+ * false otherwise. */
+void container_periodic_base::put_locate_block(int &ijk,double &x,double &y,double &z) {
+	update_count++;
+	put_remap(ijk,x,y,z);
 	if(co[ijk]==mem[ijk]) add_particle_memory(ijk);
 }
 
@@ -227,6 +331,7 @@ void container_periodic_base::put_locate_block(int &ijk,double &x,double &y,doub
  * \return True if the particle can be successfully placed into the container,
  * false otherwise. */
 void container_periodic_base::put_locate_block(int &ijk,double &x,double &y,double &z,int &ai,int &aj,int &ak) {
+	update_count++;
 
 	// Remap particle in the z direction if necessary
 	int k=step_int(z*zsp);
@@ -290,6 +395,21 @@ inline void container_periodic_base::remap(int &ai,int &aj,int &ak,int &ci,int &
 	ijk=ci+nx*(cj+oy*ck);
 }
 
+/** Takes a position, maps it into the primary domain, and finds the block
+ * that it is within. This does not modify the container. It is the
+ * counterpart of the routine of the same name in the container_base class, so
+ * that searches from arbitrary positions can be written in the same way for
+ * both types of container.
+ * \param[out] ijk the index of the block.
+ * \param[out] (ci,cj,ck) the coordinates of the block.
+ * \param[in,out] (x,y,z) the position, remapped into the primary domain.
+ * \return True, since every position can be mapped into the container. */
+bool container_periodic_base::locate_ghost(int &ijk,int &ci,int &cj,int &ck,double &x,double &y,double &z) {
+	int ai,aj,ak;
+	remap(ai,aj,ak,ci,cj,ck,x,y,z,ijk);
+	return true;
+}
+
 /** Takes a vector and finds the particle whose Voronoi cell contains that
  * vector. This is equivalent to finding the particle which is nearest to the
  * vector.
@@ -300,7 +420,7 @@ inline void container_periodic_base::remap(int &ai,int &aj,int &ak,int &ci,int &
  * \param[out] pid the ID of the particle.
  * \return True if a particle was found. If the container has no particles,
  * then the search will not find a Voronoi cell and false is returned. */
-bool container_periodic::find_voronoi_cell(double x,double y,double z,double &rx,double &ry,double &rz,int &pid) {
+bool container_periodic::find_voronoi_cell(double x,double y,double z,double &rx,double &ry,double &rz,voro_id &pid) {
 	int ai,aj,ak,ci,cj,ck,ijk;
 	particle_record w;
 	double mrs;
@@ -334,7 +454,7 @@ bool container_periodic::find_voronoi_cell(double x,double y,double z,double &rx
  * \param[out] pid the ID of the particle.
  * \return True if a particle was found. If the container has no particles,
  * then the search will not find a Voronoi cell and false is returned. */
-bool container_periodic_poly::find_voronoi_cell(double x,double y,double z,double &rx,double &ry,double &rz,int &pid) {
+bool container_periodic_poly::find_voronoi_cell(double x,double y,double z,double &rx,double &ry,double &rz,voro_id &pid) {
 	int ai,aj,ak,ci,cj,ck,ijk;
 	particle_record w;
 	double mrs;
@@ -364,9 +484,10 @@ void container_periodic_base::add_particle_memory(int i) {
 
 	// Handle the case when no memory has been allocated for this block
 	if(mem[i]==0) {
+		track_slots(0,init_mem);
 		mem[i]=init_mem;
-		id[i]=new int[init_mem];
-		p[i]=new double[ps*init_mem];
+		id[i]=new voro_id[init_mem];
+		p[i]=new fpoint[ps*init_mem];
 		return;
 	}
 
@@ -381,9 +502,10 @@ void container_periodic_base::add_particle_memory(int i) {
 #endif
 
 	// Allocate new memory and copy in the contents of the old arrays
-	int *idp=new int[nmem];
+	track_slots(mem[i],nmem);
+	voro_id *idp=new voro_id[nmem];
 	for(l=0;l<co[i];l++) idp[l]=id[i][l];
-	double *pp=new double[ps*nmem];
+	fpoint *pp=new fpoint[ps*nmem];
 	for(l=0;l<ps*co[i];l++) pp[l]=p[i][l];
 
 	// Update pointers and delete old arrays
@@ -392,16 +514,197 @@ void container_periodic_base::add_particle_memory(int i) {
 	delete [] p[i];p[i]=pp;
 }
 
+/** Increases the memory for a particular region to a given size, or frees it
+ * if the size is zero.
+ * \param[in] i the index of the region to reallocate.
+ * \param[in] nmem the new memory allocation, which must be at least the
+ *		   number of particles in the region. */
+void container_periodic_base::add_particle_memory(int i,int nmem) {
+	if(nmem>max_particle_memory)
+		voro_fatal_error("Absolute maximum memory allocation exceeded",VOROPP_MEMORY_ERROR);
+	track_slots(mem[i],nmem);
+	int l;
+	voro_id *idp=NULL;
+	fpoint *pp=NULL;
+	if(nmem>0) {
+		idp=new voro_id[nmem];
+		for(l=0;l<co[i];l++) idp[l]=id[i][l];
+		pp=new fpoint[ps*nmem];
+		for(l=0;l<ps*co[i];l++) pp[l]=p[i][l];
+	}
+	if(mem[i]>0) {
+		delete [] id[i];
+		delete [] p[i];
+	}
+	mem[i]=nmem;id[i]=idp;p[i]=pp;
+}
+
+/** Removes all of the particles in the periodic images, so that the images
+ * are constructed again when they are next needed. */
+void container_periodic_base::clear_images() {
+	int i,j,k,l;
+	for(k=l=0;k<oz;k++) for(j=0;j<oy;j++) for(i=0;i<nx;i++,l++) {
+		if(k<ez||k>=wz||j<ey||j>=wy) co[l]=0;
+		img[l]=0;
+	}
+}
+
+/** Puts a large number of particles into the container at once. Each particle
+ * is mapped into the primary domain, and the number of new particles in each
+ * block is counted. The memory for each block is then extended exactly once
+ * to the size that is needed, and the particles are copied into the blocks in
+ * order, so that they are stored in the same way as if they had been added one
+ * at a time with put(). Any periodic images that have already been
+ * constructed are removed, so that they are constructed again with the new
+ * particles when they are next needed.
+ * \param[in] n the number of particles.
+ * \param[in] pid an array of the particle IDs.
+ * \param[in] pp an array of the particle positions, with ps entries per
+ *		 particle. For the container_periodic_poly class, the fourth
+ *		 entry is the radius.
+ * \param[in] vo an ordering class in which to record where the particles were
+ *		 stored, or NULL if this is not needed. */
+void container_periodic_base::put_bulk(voro_id n,const voro_id *pid,const double *pp,particle_order *vo) {
+	if(n<=0) return;
+	int *bi=new int[n],*cnt=new int[oxyz],ijk,c;
+	voro_id l;
+	double x,y,z;
+	const double *p2;fpoint *p1;
+	update_count++;
+	clear_images();
+
+	// Find the block for each particle, and count the number of new
+	// particles in each block
+	for(ijk=0;ijk<oxyz;ijk++) cnt[ijk]=0;
+	for(l=0,p2=pp;l<n;l++,p2+=ps) {
+		x=*p2;y=p2[1];z=p2[2];
+		put_remap(bi[l],x,y,z);
+		cnt[bi[l]]++;
+	}
+
+	// Extend the memory of each block exactly once
+	for(ijk=0;ijk<oxyz;ijk++) if(co[ijk]+cnt[ijk]>mem[ijk]) add_particle_memory(ijk,co[ijk]+cnt[ijk]);
+
+	// Copy in the particle IDs and positions, checking for duplicates in
+	// the same way as the put() routine of the container_periodic class
+	for(l=0,p2=pp;l<n;l++,p2+=ps) {
+		x=*p2;y=p2[1];z=p2[2];
+		put_remap(ijk,x,y,z);
+		if(ps==3) for(c=0;c<co[ijk];c++) check_duplicate(pid[l],x,y,z,id[ijk][c],p[ijk]+3*c);
+		if(vo!=NULL) vo->add(ijk,co[ijk]);
+		id[ijk][co[ijk]]=pid[l];
+		p1=p[ijk]+ps*co[ijk]++;
+		*p1=x;p1[1]=y;p1[2]=z;
+		for(c=3;c<ps;c++) p1[c]=p2[c];
+	}
+	delete [] cnt;
+	delete [] bi;
+}
+
+/** Puts a large number of particles into the container at once, and updates
+ * the maximum particle radius.
+ * \param[in] n the number of particles.
+ * \param[in] pid an array of the particle IDs.
+ * \param[in] pp an array of the particle positions and radii, in groups of
+ *		 four.
+ * \param[in] vo an ordering class in which to record where the particles were
+ *		 stored, or NULL if this is not needed. */
+void container_periodic_poly::put_bulk(voro_id n,const voro_id *pid,const double *pp,particle_order *vo) {
+	container_periodic_base::put_bulk(n,pid,pp,vo);
+	for(voro_id l=0;l<n;l++) if(max_radius<pp[4*l+3]) max_radius=pp[4*l+3];
+}
+
+/** Releases the memory that is allocated for each block beyond what is needed
+ * for the particles that it holds. Since the memory of the blocks is doubled
+ * whenever it fills up, up to half of it can be unused after the particles
+ * have been added. The memory of empty blocks is freed completely, and is
+ * allocated again if any particles are added to them. */
+void container_periodic_base::shrink_particle_memory() {
+	for(int ijk=0;ijk<oxyz;ijk++) if(mem[ijk]>co[ijk]) add_particle_memory(ijk,co[ijk]);
+}
+
+/** Moves the particle memory of each block to the thread that computes its
+ * cells, for machines with non-uniform memory access. The blocks are shared
+ * out with a block_scheduler, in the same way as in the parallel routines, and
+ * each thread reallocates the memory of the blocks in its own range, so that
+ * the operating system's first-touch policy places it on that thread's memory
+ * node. This should be called after all of the particles have been added,
+ * with the same number of threads as the parallel routines that follow. The
+ * threads only stay on the same memory nodes between parallel regions if they
+ * are bound to processors, by setting VOROPP_NUMA to 1 or with the
+ * OMP_PROC_BIND environment variable. The amount of memory is not changed,
+ * and the routine has no effect if the code is compiled without OpenMP.
+ * \param[in] nt the number of threads to use, or zero to use the OpenMP
+ *		default. */
+void container_periodic_base::place_particle_memory(int nt) {
+#ifdef _OPENMP
+	nt=voro_threads(nt);
+	block_scheduler bs(*this,nt);
+#pragma omp parallel num_threads(nt) VOROPP_BIND
+	{
+		int b0,b1,i,l;
+		voro_id *idp;fpoint *pp;
+		bs.thread_range(omp_get_thread_num(),b0,b1);
+		for(;b0<b1;b0++) {
+			i=bs.bl[b0];
+			idp=new voro_id[mem[i]];
+			for(l=0;l<co[i];l++) idp[l]=id[i][l];
+			pp=new fpoint[ps*mem[i]];
+			for(l=0;l<ps*co[i];l++) pp[l]=p[i][l];
+			delete [] id[i];id[i]=idp;
+			delete [] p[i];p[i]=pp;
+		}
+	}
+#endif
+}
+
+/** Exchanges the particles and periodic images of this container with another
+ * one that has the same unit cell and block structure, without copying them.
+ * The particle memory and the image flags of each pair of corresponding blocks
+ * are swapped, so that the voro_compute classes of both containers remain
+ * valid, and the cost is proportional to the number of blocks.
+ * \param[in] c the container to exchange with. */
+void container_periodic_base::swap(container_periodic_base &c) {
+	if(nx!=c.nx||ny!=c.ny||nz!=c.nz||oy!=c.oy||oz!=c.oz||ps!=c.ps||bx!=c.bx||bxy!=c.bxy
+	 ||by!=c.by||bxz!=c.bxz||byz!=c.byz||bz!=c.bz)
+		voro_fatal_error("Swapping containers with different geometries",VOROPP_INTERNAL_ERROR);
+	for(int l=0;l<oxyz;l++) {
+		std::swap(id[l],c.id[l]);std::swap(p[l],c.p[l]);
+		std::swap(co[l],c.co[l]);std::swap(mem[l],c.mem[l]);
+		std::swap(img[l],c.img[l]);
+	}
+	std::swap(slots,c.slots);std::swap(peak_slots,c.peak_slots);
+	update_count++;c.update_count++;
+}
+
+/** Reports the memory that is currently allocated by the container, and the
+ * peak amount since it was created. The particles in the primary domain and in
+ * the periodic images are reported separately.
+ * \return A class holding the number of bytes in each data structure. */
+voro_memory container_periodic_base::memory_usage() {
+	voro_memory vm;
+	size_t ss=sizeof(int)+ps*sizeof(fpoint),pm=0;
+	int i,j,k;
+	for(k=ez;k<wz;k++) for(j=ey;j<wy;j++) for(i=0;i<nx;i++) pm+=mem[i+nx*(j+oy*k)];
+	vm.particles=pm*ss;
+	vm.images=(slots-pm)*ss;
+	vm.blocks=oxyz*(sizeof(int*)+sizeof(fpoint*)+2*sizeof(int)+sizeof(char));
+	vm.worklists=worklist_memory();
+	vm.peak=vm.total()+(peak_slots-slots)*ss;
+	return vm;
+}
+
 /** Import a list of particles from an open file stream into the container.
  * Entries of four numbers (Particle ID, x position, y position, z position)
  * are searched for. If the file cannot be successfully read, then the routine
  * causes a fatal error.
- * \param[in] fp the file handle to read from. */
-void container_periodic::import(FILE *fp) {
-	int i,j;
-	double x,y,z;
-	while((j=fscanf(fp,"%d %lg %lg %lg",&i,&x,&y,&z))==4) put(i,x,y,z);
-	if(j!=EOF) voro_fatal_error("File import error",VOROPP_FILE_ERROR);
+ * \param[in] fp the file handle to read from.
+ * \param[in] nt the number of threads to use to parse the file. */
+void container_periodic::import(FILE *fp,int nt) {
+	trace_scope ts("import");
+	text_reader tr(fp,3,nt);
+	while(tr.next()) for(unsigned int i=0;i<tr.id.size();i++)
+		put(tr.id[i],tr.v[3*i],tr.v[3*i+1],tr.v[3*i+2]);
 }
 
 /** Import a list of particles from an open file stream, also storing the order
@@ -409,24 +712,53 @@ void container_periodic::import(FILE *fp) {
  * position, y position, z position) are searched for. If the file cannot be
  * successfully read, then the routine causes a fatal error.
  * \param[in,out] vo a reference to an ordering class to use.
- * \param[in] fp the file handle to read from. */
-void container_periodic::import(particle_order &vo,FILE *fp) {
-	int i,j;
+ * \param[in] fp the file handle to read from.
+ * \param[in] nt the number of threads to use to parse the file. */
+void container_periodic::import(particle_order &vo,FILE *fp,int nt) {
+	trace_scope ts("import");
+	text_reader tr(fp,3,nt);
+	while(tr.next()) for(unsigned int i=0;i<tr.id.size();i++)
+		put(vo,tr.id[i],tr.v[3*i],tr.v[3*i+1],tr.v[3*i+2]);
+}
+
+/** Imports a list of particles from a binary particle file into the container.
+ * The file is mapped into memory and each record is passed to put(). Any
+ * radii that are stored in the file are ignored. If the file cannot be read,
+ * then the routine causes a fatal error.
+ * \param[in] filename the name of the file to read. */
+void container_periodic::import_binary(const char *filename) {
+	trace_scope ts("import");
+	particle_file pf(filename);
+	int i,n;
 	double x,y,z;
-	while((j=fscanf(fp,"%d %lg %lg %lg",&i,&x,&y,&z))==4) put(vo,i,x,y,z);
-	if(j!=EOF) voro_fatal_error("File import error",VOROPP_FILE_ERROR);
+	for(i=0;i<pf.n;i++) {pf.get(i,n,x,y,z);put(n,x,y,z);}
+}
+
+/** Imports a list of particles from a binary particle file into the container,
+ * also storing the order that the particles are read. Any radii that are
+ * stored in the file are ignored. If the file cannot be read, then the routine
+ * causes a fatal error.
+ * \param[in,out] vo a reference to an ordering class to use.
+ * \param[in] filename the name of the file to read. */
+void container_periodic::import_binary(particle_order &vo,const char *filename) {
+	trace_scope ts("import");
+	particle_file pf(filename);
+	int i,n;
+	double x,y,z;
+	for(i=0;i<pf.n;i++) {pf.get(i,n,x,y,z);put(vo,n,x,y,z);}
 }
 
 /** Import a list of particles from an open file stream into the container.
  * Entries of five numbers (Particle ID, x position, y position, z position,
  * radius) are searched for. If the file cannot be successfully read, then the
  * routine causes a fatal error.
- * \param[in] fp the file handle to read from. */
-void container_periodic_poly::import(FILE *fp) {
-	int i,j;
-	double x,y,z,r;
-	while((j=fscanf(fp,"%d %lg %lg %lg %lg",&i,&x,&y,&z,&r))==5) put(i,x,y,z,r);
-	if(j!=EOF) voro_fatal_error("File import error",VOROPP_FILE_ERROR);
+ * \param[in] fp the file handle to read from.
+ * \param[in] nt the number of threads to use to parse the file. */
+void container_periodic_poly::import(FILE *fp,int nt) {
+	trace_scope ts("import");
+	text_reader tr(fp,4,nt);
+	while(tr.next()) for(unsigned int i=0;i<tr.id.size();i++)
+		put(tr.id[i],tr.v[4*i],tr.v[4*i+1],tr.v[4*i+2],tr.v[4*i+3]);
 }
 
 /** Import a list of particles from an open file stream, also storing the order
@@ -434,12 +766,42 @@ void container_periodic_poly::import(FILE *fp) {
  * position, y position, z position, radius) are searched for. If the file
  * cannot be successfully read, then the routine causes a fatal error.
  * \param[in,out] vo a reference to an ordering class to use.
- * \param[in] fp the file handle to read from. */
-void container_periodic_poly::import(particle_order &vo,FILE *fp) {
-	int i,j;
+ * \param[in] fp the file handle to read from.
+ * \param[in] nt the number of threads to use to parse the file. */
+void container_periodic_poly::import(particle_order &vo,FILE *fp,int nt) {
+	trace_scope ts("import");
+	text_reader tr(fp,4,nt);
+	while(tr.next()) for(unsigned int i=0;i<tr.id.size();i++)
+		put(vo,tr.id[i],tr.v[4*i],tr.v[4*i+1],tr.v[4*i+2],tr.v[4*i+3]);
+}
+
+/** Imports a list of particles from a binary particle file into the container.
+ * The file is mapped into memory and each record is passed to put(). If the
+ * file cannot be read or does not contain the particle radii, then the
+ * routine causes a fatal error.
+ * \param[in] filename the name of the file to read. */
+void container_periodic_poly::import_binary(const char *filename) {
+	trace_scope ts("import");
+	particle_file pf(filename);
+	if(!pf.radii) voro_fatal_error("Binary particle file has no radii",VOROPP_FILE_ERROR);
+	int i,n;
+	double x,y,z,r;
+	for(i=0;i<pf.n;i++) {pf.get(i,n,x,y,z,r);put(n,x,y,z,r);}
+}
+
+/** Imports a list of particles from a binary particle file into the container,
+ * also storing the order that the particles are read. If the file cannot be
+ * read or does not contain the particle radii, then the routine causes a fatal
+ * error.
+ * \param[in,out] vo a reference to an ordering class to use.
+ * \param[in] filename the name of the file to read. */
+void container_periodic_poly::import_binary(particle_order &vo,const char *filename) {
+	trace_scope ts("import");
+	particle_file pf(filename);
+	if(!pf.radii) voro_fatal_error("Binary particle file has no radii",VOROPP_FILE_ERROR);
+	int i,n;
 	double x,y,z,r;
-	while((j=fscanf(fp,"%d %lg %lg %lg %lg",&i,&x,&y,&z,&r))==5) put(vo,i,x,y,z,r);
-	if(j!=EOF) voro_fatal_error("File import error",VOROPP_FILE_ERROR);
+	for(i=0;i<pf.n;i++) {pf.get(i,n,x,y,z,r);put(vo,n,x,y,z,r);}
 }
 
 /** Outputs the a list of all the container regions along with the number of
@@ -450,70 +812,330 @@ void container_periodic_base::region_count() {
 		printf("Region (%d,%d,%d): %d particles\n",i,j,k,*(cop++));
 }
 
-/** Clears a container of particles. */
+/** Clears a container of particles, including any periodic images that have
+ * been constructed. */
 void container_periodic::clear() {
-	for(int *cop=co;cop<co+nxyz;cop++) *cop=0;
+	for(int *cop=co;cop<co+oxyz;cop++) *cop=0;
+	for(char *cp=img;cp<img+oxyz;cp++) *cp=0;
+	update_count++;
 }
 
-/** Clears a container of particles, also clearing resetting the maximum radius
- * to zero. */
+/** Clears a container of particles, including any periodic images that have
+ * been constructed, also clearing resetting the maximum radius to zero. */
 void container_periodic_poly::clear() {
-	for(int *cop=co;cop<co+nxyz;cop++) *cop=0;
+	for(int *cop=co;cop<co+oxyz;cop++) *cop=0;
+	for(char *cp=img;cp<img+oxyz;cp++) *cp=0;
+	update_count++;
 	max_radius=0;
 }
 
 /** Computes all the Voronoi cells and saves customized information about them.
  * \param[in] format the custom output string to use.
- * \param[in] fp a file handle to write to. */
-void container_periodic::print_custom(const char *format,FILE *fp) {
-	c_loop_all_periodic vl(*this);
-	print_custom(vl,format,fp);
+ * \param[in] fp a file handle to write to.
+ * \param[in] nt the number of threads to use. If this is one, then the cells
+ *		are computed serially using the c_loop_all_periodic ordering. If
+ *		this is zero, then the OpenMP default number of threads is
+ *		used. */
+void container_periodic::print_custom(const char *format,FILE *fp,int nt) {
+	trace_scope ts("print_custom");
+	nt=voro_threads(nt);
+	if(nt>1) {
+		if(contains_neighbor(format)) print_custom_threaded<voronoicell_neighbor>(format,fp,nt);
+		else print_custom_threaded<voronoicell>(format,fp,nt);
+	} else {
+		c_loop_all_periodic vl(*this);
+		print_custom(vl,format,fp);
+	}
 }
 
-/** Computes all the Voronoi cells and saves customized
- * information about them.
+/** Computes all the Voronoi cells and saves customized information about them.
  * \param[in] format the custom output string to use.
- * \param[in] fp a file handle to write to. */
-void container_periodic_poly::print_custom(const char *format,FILE *fp) {
-	c_loop_all_periodic vl(*this);
-	print_custom(vl,format,fp);
+ * \param[in] fp a file handle to write to.
+ * \param[in] nt the number of threads to use. If this is one, then the cells
+ *		are computed serially using the c_loop_all_periodic ordering. If
+ *		this is zero, then the OpenMP default number of threads is
+ *		used. */
+void container_periodic_poly::print_custom(const char *format,FILE *fp,int nt) {
+	trace_scope ts("print_custom");
+	nt=voro_threads(nt);
+	if(nt>1) {
+		if(contains_neighbor(format)) print_custom_threaded<voronoicell_neighbor>(format,fp,nt);
+		else print_custom_threaded<voronoicell>(format,fp,nt);
+	} else {
+		c_loop_all_periodic vl(*this);
+		print_custom(vl,format,fp);
+	}
 }
 
 /** Computes all the Voronoi cells and saves customized information about them.
  * \param[in] format the custom output string to use.
- * \param[in] filename the name of the file to write to. */
-void container_periodic::print_custom(const char *format,const char *filename) {
+ * \param[in] filename the name of the file to write to.
+ * \param[in] nt the number of threads to use. */
+void container_periodic::print_custom(const char *format,const char *filename,int nt) {
 	FILE *fp=safe_fopen(filename,"w");
-	print_custom(format,fp);
+	print_custom(format,fp,nt);
 	fclose(fp);
 }
+/** Computes all the Voronoi cells and saves statistics about them in a binary
+ * column file.
+ * \param[in] columns the string of column codes to use.
+ * \param[in] fp a file handle to write to.
+ * \param[in] nt the number of threads to use. If this is one, then the cells
+ *		are computed serially using the c_loop_all_periodic ordering. If this is
+ *		zero, then the OpenMP default number of threads is used. */
+void container_periodic::print_columns(const char *columns,FILE *fp,int nt) {
+	trace_scope ts("print_columns");
+	column_writer clw(columns);
+	clw.write_header(fp);
+	nt=voro_threads(nt);
+	if(nt>1) {
+		if(clw.neighbor()) print_columns_threaded<voronoicell_neighbor>(columns,fp,nt);
+		else print_columns_threaded<voronoicell>(columns,fp,nt);
+	} else {
+		c_loop_all_periodic vl(*this);
+		print_columns(vl,clw,fp);
+	}
+}
+
+/** Computes all the Voronoi cells and saves statistics about them in a binary
+ * column file.
+ * \param[in] columns the string of column codes to use.
+ * \param[in] filename the name of the file to write to.
+ * \param[in] nt the number of threads to use. */
+void container_periodic::print_columns(const char *columns,const char *filename,int nt) {
+	FILE *fp=safe_fopen(filename,"wb");
+	print_columns(columns,fp,nt);
+	if(fclose(fp)!=0) voro_fatal_error("File output error",VOROPP_FILE_ERROR);
+}
 
-/** Computes all the Voronoi cells and saves customized
- * information about them
+
+/** Computes all the Voronoi cells and saves customized information about them.
  * \param[in] format the custom output string to use.
- * \param[in] filename the name of the file to write to. */
-void container_periodic_poly::print_custom(const char *format,const char *filename) {
+ * \param[in] filename the name of the file to write to.
+ * \param[in] nt the number of threads to use. */
+void container_periodic_poly::print_custom(const char *format,const char *filename,int nt) {
 	FILE *fp=safe_fopen(filename,"w");
-	print_custom(format,fp);
+	print_custom(format,fp,nt);
 	fclose(fp);
 }
+/** Computes all the Voronoi cells and saves statistics about them in a binary
+ * column file.
+ * \param[in] columns the string of column codes to use.
+ * \param[in] fp a file handle to write to.
+ * \param[in] nt the number of threads to use. If this is one, then the cells
+ *		are computed serially using the c_loop_all_periodic ordering. If this is
+ *		zero, then the OpenMP default number of threads is used. */
+void container_periodic_poly::print_columns(const char *columns,FILE *fp,int nt) {
+	trace_scope ts("print_columns");
+	column_writer clw(columns);
+	clw.write_header(fp);
+	nt=voro_threads(nt);
+	if(nt>1) {
+		if(clw.neighbor()) print_columns_threaded<voronoicell_neighbor>(columns,fp,nt);
+		else print_columns_threaded<voronoicell>(columns,fp,nt);
+	} else {
+		c_loop_all_periodic vl(*this);
+		print_columns(vl,clw,fp);
+	}
+}
+
+/** Computes all the Voronoi cells and saves statistics about them in a binary
+ * column file.
+ * \param[in] columns the string of column codes to use.
+ * \param[in] filename the name of the file to write to.
+ * \param[in] nt the number of threads to use. */
+void container_periodic_poly::print_columns(const char *columns,const char *filename,int nt) {
+	FILE *fp=safe_fopen(filename,"wb");
+	print_columns(columns,fp,nt);
+	if(fclose(fp)!=0) voro_fatal_error("File output error",VOROPP_FILE_ERROR);
+}
+
+
+/** Computes all the Voronoi cells using several threads, and saves customized
+ * information about them. The blocks of the primary domain are shared out
+ * among the threads by a block_scheduler, and the output of each chunk of
+ * blocks is written in order by a chunk_writer. The periodic images are
+ * created by the threads as they are needed.
+ * \param[in] format the custom output string to use.
+ * \param[in] fp a file handle to write to.
+ * \param[in] nt the number of threads to use. */
+template<class v_cell>
+void container_periodic::print_custom_threaded(const char *format,FILE *fp,int nt) {
+#ifdef _OPENMP
+	block_scheduler bs(*this,nt);
+	chunk_writer cw(fp,bs.nc);
+#pragma omp parallel num_threads(nt) VOROPP_BIND
+	{
+		v_cell c(*this);
+		voro_compute<container_periodic> vcl(*this,vc.hx,vc.hy,vc.hz);
+		c_loop_parallel vl(*this,bs,omp_get_thread_num());
+		compiled_format fm(format);
+		fpoint *pp;FILE *cfp;
+		while(vl.start_chunk()) {
+			cfp=cw.open(vl.chunk);
+			do if(compute_cell(c,vl,vcl)) {
+				pp=p[vl.ijk]+ps*vl.q;
+				fm.write(c,id[vl.ijk][vl.q],*pp,pp[1],pp[2],default_radius,cfp);
+			} while(vl.inc_chunk());
+			cw.close(vl.chunk);
+		}
+	}
+#endif
+}
+
+/** Computes all the Voronoi cells using several threads, and saves statistics
+ * about them in a binary column file. The blocks of the primary domain are
+ * shared out among the threads by a block_scheduler, and the column chunks of
+ * each chunk of blocks are written in order by a chunk_writer. The periodic
+ * images are created by the threads as they are needed.
+ * \param[in] columns the string of column codes to use.
+ * \param[in] fp a file handle to write to.
+ * \param[in] nt the number of threads to use. */
+template<class v_cell>
+void container_periodic::print_columns_threaded(const char *columns,FILE *fp,int nt) {
+#ifdef _OPENMP
+	block_scheduler bs(*this,nt);
+	chunk_writer cw(fp,bs.nc);
+#pragma omp parallel num_threads(nt) VOROPP_BIND
+	{
+		v_cell c(*this);
+		voro_compute<container_periodic> vcl(*this,vc.hx,vc.hy,vc.hz);
+		c_loop_parallel vl(*this,bs,omp_get_thread_num());
+		column_writer clw(columns);
+		fpoint *pp;FILE *cfp;
+		while(vl.start_chunk()) {
+			cfp=cw.open(vl.chunk);
+			do if(compute_cell(c,vl,vcl)) {
+				pp=p[vl.ijk]+ps*vl.q;
+				clw.add(c,id[vl.ijk][vl.q],*pp,pp[1],pp[2],default_radius);
+				if(clw.full()) clw.write_chunk(cfp);
+			} while(vl.inc_chunk());
+			clw.write_chunk(cfp);
+			cw.close(vl.chunk);
+		}
+	}
+#endif
+}
+
+/** Computes all the Voronoi cells using several threads, and saves customized
+ * information about them. The blocks of the primary domain are shared out
+ * among the threads by a block_scheduler, and the output of each chunk of
+ * blocks is written in order by a chunk_writer. The periodic images are
+ * created by the threads as they are needed.
+ * \param[in] format the custom output string to use.
+ * \param[in] fp a file handle to write to.
+ * \param[in] nt the number of threads to use. */
+template<class v_cell>
+void container_periodic_poly::print_custom_threaded(const char *format,FILE *fp,int nt) {
+#ifdef _OPENMP
+	block_scheduler bs(*this,nt);
+	chunk_writer cw(fp,bs.nc);
+#pragma omp parallel num_threads(nt) VOROPP_BIND
+	{
+		v_cell c(*this);
+		voro_compute<container_periodic_poly> vcl(*this,vc.hx,vc.hy,vc.hz);
+		c_loop_parallel vl(*this,bs,omp_get_thread_num());
+		compiled_format fm(format);
+		fpoint *pp;FILE *cfp;
+		while(vl.start_chunk()) {
+			cfp=cw.open(vl.chunk);
+			do if(compute_cell(c,vl,vcl)) {
+				pp=p[vl.ijk]+ps*vl.q;
+				fm.write(c,id[vl.ijk][vl.q],*pp,pp[1],pp[2],pp[3],cfp);
+			} while(vl.inc_chunk());
+			cw.close(vl.chunk);
+		}
+	}
+#endif
+}
+
+/** Computes all the Voronoi cells using several threads, and saves statistics
+ * about them in a binary column file. The blocks of the primary domain are
+ * shared out among the threads by a block_scheduler, and the column chunks of
+ * each chunk of blocks are written in order by a chunk_writer. The periodic
+ * images are created by the threads as they are needed.
+ * \param[in] columns the string of column codes to use.
+ * \param[in] fp a file handle to write to.
+ * \param[in] nt the number of threads to use. */
+template<class v_cell>
+void container_periodic_poly::print_columns_threaded(const char *columns,FILE *fp,int nt) {
+#ifdef _OPENMP
+	block_scheduler bs(*this,nt);
+	chunk_writer cw(fp,bs.nc);
+#pragma omp parallel num_threads(nt) VOROPP_BIND
+	{
+		v_cell c(*this);
+		voro_compute<container_periodic_poly> vcl(*this,vc.hx,vc.hy,vc.hz);
+		c_loop_parallel vl(*this,bs,omp_get_thread_num());
+		column_writer clw(columns);
+		fpoint *pp;FILE *cfp;
+		while(vl.start_chunk()) {
+			cfp=cw.open(vl.chunk);
+			do if(compute_cell(c,vl,vcl)) {
+				pp=p[vl.ijk]+ps*vl.q;
+				clw.add(c,id[vl.ijk][vl.q],*pp,pp[1],pp[2],pp[3]);
+				if(clw.full()) clw.write_chunk(cfp);
+			} while(vl.inc_chunk());
+			clw.write_chunk(cfp);
+			cw.close(vl.chunk);
+		}
+	}
+#endif
+}
 
 /** Computes all of the Voronoi cells in the container, but does nothing
  * with the output. It is useful for measuring the pure computation time
  * of the Voronoi algorithm, without any additional calculations such as
- * volume evaluation or cell output. */
-void container_periodic::compute_all_cells() {
+ * volume evaluation or cell output.
+ * \param[in] nt the number of threads to use. If this is more than one,
+ *		then the blocks of the primary domain are shared out among the
+ *		threads by a block_scheduler, and the periodic images are
+ *		created by the threads as they are needed. */
+void container_periodic::compute_all_cells(int nt) {
+	trace_scope ts("compute_all_cells");
+	nt=voro_threads(nt);
+#ifdef _OPENMP
+	if(nt>1) {
+		block_scheduler bs(*this,nt);
+#pragma omp parallel num_threads(nt) VOROPP_BIND
+		{
+			voronoicell c(*this);
+			voro_compute<container_periodic> vcl(*this,vc.hx,vc.hy,vc.hz);
+			c_loop_parallel vl(*this,bs,omp_get_thread_num());
+			if(vl.start()) do compute_cell(c,vl,vcl);while(vl.inc());
+		}
+		return;
+	}
+#endif
 	voronoicell c(*this);
 	c_loop_all_periodic vl(*this);
-	if(vl.start()) do compute_cell(c,vl);
-	while(vl.inc());
+	if(vl.start()) do compute_cell(c,vl);while(vl.inc());
 }
 
 /** Computes all of the Voronoi cells in the container, but does nothing
  * with the output. It is useful for measuring the pure computation time
  * of the Voronoi algorithm, without any additional calculations such as
- * volume evaluation or cell output. */
-void container_periodic_poly::compute_all_cells() {
+ * volume evaluation or cell output.
+ * \param[in] nt the number of threads to use. If this is more than one,
+ *		then the blocks of the primary domain are shared out among the
+ *		threads by a block_scheduler, and the periodic images are
+ *		created by the threads as they are needed. */
+void container_periodic_poly::compute_all_cells(int nt) {
+	trace_scope ts("compute_all_cells");
+	nt=voro_threads(nt);
+#ifdef _OPENMP
+	if(nt>1) {
+		block_scheduler bs(*this,nt);
+#pragma omp parallel num_threads(nt) VOROPP_BIND
+		{
+			voronoicell c(*this);
+			voro_compute<container_periodic_poly> vcl(*this,vc.hx,vc.hy,vc.hz);
+			c_loop_parallel vl(*this,bs,omp_get_thread_num());
+			if(vl.start()) do compute_cell(c,vl,vcl);while(vl.inc());
+		}
+		return;
+	}
+#endif
 	voronoicell c(*this);
 	c_loop_all_periodic vl(*this);
 	if(vl.start()) do compute_cell(c,vl);while(vl.inc());
@@ -543,19 +1165,90 @@ double container_periodic_poly::sum_cell_volumes() {
 	return vol;
 }
 
-/** This routine creates all periodic images of the particles. It is meant for
- * diagnostic purposes only, since usually periodic images are dynamically
- * created in when they are referenced. */
-void container_periodic_base::create_all_images() {
+/** This routine creates all periodic images of the particles. Usually periodic
+ * images are dynamically created when they are referenced, so this is only
+ * needed if the images must all be present, such as when printing all of the
+ * stored particles.
+ * \param[in] nt the number of threads to use. If this is more than one, then
+ *		the z layers of blocks are shared out among the threads. The
+ *		image routines only read from the primary domain and only write
+ *		to blocks in the same z layer, so the layers are independent,
+ *		and the result is identical to the serial computation. */
+void container_periodic_base::create_all_images(int nt) {
+	trace_scope ts("images");
 	int i,j,k;
+	nt=voro_threads(nt);
+#ifdef _OPENMP
+	if(nt>1) {
+#pragma omp parallel for num_threads(nt) private(i,j) schedule(dynamic)
+		for(k=0;k<oz;k++) for(j=0;j<oy;j++) for(i=0;i<nx;i++) create_periodic_image(i,j,k);
+		return;
+	}
+#endif
 	for(k=0;k<oz;k++) for(j=0;j<oy;j++) for(i=0;i<nx;i++) create_periodic_image(i,j,k);
 }
 
+/** Creates particles within an image block by copying them from the primary
+ * domain and shifting them, if this has not already been done. The flags of
+ * the block are checked first, so that the routine returns immediately for a
+ * block of the primary domain or an image block that is complete. Otherwise
+ * the fill_image routine is called to construct the block. When the code is
+ * compiled with OpenMP the flags are read atomically, since another thread may
+ * be constructing the block.
+ * \param[in] (di,dj,dk) the coordinates of the image block to create. */
+void container_periodic_base::create_periodic_image(int di,int dj,int dk) {
+	if(di<0||di>=nx||dj<0||dj>=oy||dk<0||dk>=oz)
+		voro_fatal_error("Constructing periodic image for nonexistent point",VOROPP_INTERNAL_ERROR);
+	char f,*ip=img+di+nx*(dj+oy*dk);
+#ifdef _OPENMP
+#pragma omp atomic read
+	f=*ip;
+#pragma omp flush
+#else
+	f=*ip;
+#endif
+	if(dk>=ez&&dk<wz) {
+		if((dj<ey||dj>=wy)&&f!=3) fill_image(di,dj,dk);
+	} else if(f!=15) fill_image(di,dj,dk);
+}
+
+/** Constructs an image block that has not been completed. If the given block
+ * is aligned with the primary domain in the z-direction, the routine calls the
+ * simpler create_side_image routine where the image block may comprise of
+ * particles from up to two primary blocks. Otherwise is calls the more complex
+ * create_vertical_image where the image block may comprise of particles from
+ * up to four primary blocks. Both routines only write to the given block, and
+ * its contents do not depend on which blocks have already been created. When
+ * the code is compiled with OpenMP the lock for the block's z layer is held
+ * during the construction, and the flags are checked again once it has been
+ * taken in case another thread completed the block first. Threads can
+ * therefore compute Voronoi cells at once, with each image block being created
+ * by the first thread that refers to it, and the output is the same as for the
+ * serial routines.
+ * \param[in] (di,dj,dk) the coordinates of the image block to create. */
+void container_periodic_base::fill_image(int di,int dj,int dk) {
+	trace_scope ts("image");
+	bool side=dk>=ez&&dk<wz;
+#ifdef _OPENMP
+	omp_lock_t *lp=static_cast<omp_lock_t*>(ilk)+dk;
+	omp_set_lock(lp);
+	if(img[di+nx*(dj+oy*dk)]!=(side?3:15)) {
+		if(side) create_side_image(di,dj,dk);
+		else create_vertical_image(di,dj,dk);
+	}
+#pragma omp flush
+	omp_unset_lock(lp);
+#else
+	if(side) create_side_image(di,dj,dk);
+	else create_vertical_image(di,dj,dk);
+#endif
+}
+
 /** Checks that the particles within each block lie within that block's bounds.
  * This is useful for diagnosing problems with periodic image computation. */
 void container_periodic_base::check_compartmentalized() {
 	int c,l,i,j,k;
-	double mix,miy,miz,max,may,maz,*pp;
+	double mix,miy,miz,max,may,maz;fpoint *pp;
 	for(k=l=0;k<oz;k++) for(j=0;j<oy;j++) for(i=0;i<nx;i++,l++) if(mem[l]>0) {
 
 		// Compute the block's bounds, adding in a small tolerance
@@ -566,128 +1259,75 @@ void container_periodic_base::check_compartmentalized() {
 		// Print entries for any particles that lie outside the block's
 		// bounds
 		for(pp=p[l],c=0;c<co[l];c++,pp+=ps) if(*pp<mix||*pp>max||pp[1]<miy||pp[1]>may||pp[2]<miz||pp[2]>maz)
-			printf("%d %d %d %d %f %f %f %f %f %f %f %f %f\n",
-			       id[l][c],i,j,k,*pp,pp[1],pp[2],mix,max,miy,may,miz,maz);
+			printf("%ld %d %d %d %f %f %f %f %f %f %f %f %f\n",
+			       long(id[l][c]),i,j,k,*pp,pp[1],pp[2],mix,max,miy,may,miz,maz);
 	}
 }
 
 /** Creates particles within an image block that is aligned with the primary
  * domain in the z axis. In this case, the image block may be comprised of
  * particles from two primary blocks. The routine considers these two primary
- * blocks, and adds the needed particles to the image. The remaining particles
- * from the primary blocks are also filled into the neighboring images.
+ * blocks in turn, and adds the needed particles to the image. Only the image
+ * block itself is written to, so that the order of its particles does not
+ * depend on the order in which the image blocks are created, and the threaded
+ * routines give the same output as the serial ones.
  * \param[in] (di,dj,dk) the index of the block to consider. The z index must
  *			 satisfy ez<=dk<wz. */
 void container_periodic_base::create_side_image(int di,int dj,int dk) {
-	int l,dijk=di+nx*(dj+oy*dk),odijk,ima=step_div(dj-ey,ny);
+	int l,dijk=di+nx*(dj+oy*dk),ima=step_div(dj-ey,ny);
 	int qua=di+step_int(-ima*bxy*xsp),quadiv=step_div(qua,nx);
 	int fi=qua-quadiv*nx,fijk=fi+nx*(dj-ima*ny+oy*dk);
-	double dis=ima*bxy+quadiv*bx,switchx=di*boxx-ima*bxy-quadiv*bx,adis;
-
-	// Left image computation
-	if((img[dijk]&1)==0) {
-		if(di>0) {
-			odijk=dijk-1;adis=dis;
-		} else {
-			odijk=dijk+nx-1;adis=dis+bx;
-		}
-		img[odijk]|=2;
-		for(l=0;l<co[fijk];l++) {
-			if(p[fijk][ps*l]>switchx) put_image(dijk,fijk,l,dis,by*ima,0);
-			else put_image(odijk,fijk,l,adis,by*ima,0);
-		}
-	}
+	double dis=ima*bxy+quadiv*bx,switchx=di*boxx-ima*bxy-quadiv*bx;
 
-	// Right image computation
-	if((img[dijk]&2)==0) {
-		if(fi==nx-1) {
-			fijk+=1-nx;switchx+=(1-nx)*boxx;dis+=bx;
-		} else {
-			fijk++;switchx+=boxx;
-		}
-		if(di==nx-1) {
-			odijk=dijk-nx+1;adis=dis-bx;
-		} else {
-			odijk=dijk+1;adis=dis;
-		}
-		img[odijk]|=1;
-		for(l=0;l<co[fijk];l++) {
-			if(p[fijk][ps*l]<switchx) put_image(dijk,fijk,l,dis,by*ima,0);
-			else put_image(odijk,fijk,l,adis,by*ima,0);
-		}
+	// Left primary block
+	for(l=0;l<co[fijk];l++)
+		if(p[fijk][ps*l]>switchx) put_image(dijk,fijk,l,dis,by*ima,0);
+
+	// Right primary block
+	if(fi==nx-1) {
+		fijk+=1-nx;switchx+=(1-nx)*boxx;dis+=bx;
+	} else {
+		fijk++;switchx+=boxx;
 	}
+	for(l=0;l<co[fijk];l++)
+		if(p[fijk][ps*l]<switchx) put_image(dijk,fijk,l,dis,by*ima,0);
 
 	// All contributions to the block now added, so set both two bits of
 	// the image information
+#ifdef _OPENMP
+#pragma omp flush
+#endif
 	img[dijk]=3;
 }
 
 /** Creates particles within an image block that is not aligned with the
  * primary domain in the z axis. In this case, the image block may be comprised
  * of particles from four primary blocks. The routine considers these four
- * primary blocks, and adds the needed particles to the image. The remaining
- * particles from the primary blocks are also filled into the neighboring
- * images.
+ * primary blocks in turn, and adds the needed particles to the image. As for
+ * create_side_image(), only the image block itself is written to.
  * \param[in] (di,dj,dk) the index of the block to consider. The z index must
  *			 satisfy dk<ez or dk>=wz. */
 void container_periodic_base::create_vertical_image(int di,int dj,int dk) {
-	int l,dijk=di+nx*(dj+oy*dk),dijkl,dijkr,ima=step_div(dk-ez,nz);
+	int l,dijk=di+nx*(dj+oy*dk),ima=step_div(dk-ez,nz);
 	int qj=dj+step_int(-ima*byz*ysp),qjdiv=step_div(qj-ey,ny);
 	int qi=di+step_int((-ima*bxz-qjdiv*bxy)*xsp),qidiv=step_div(qi,nx);
 	int fi=qi-qidiv*nx,fj=qj-qjdiv*ny,fijk=fi+nx*(fj+oy*(dk-ima*nz)),fijk2;
 	double disy=ima*byz+qjdiv*by,switchy=(dj-ey)*boxy-ima*byz-qjdiv*by;
 	double disx=ima*bxz+qjdiv*bxy+qidiv*bx,switchx=di*boxx-ima*bxz-qjdiv*bxy-qidiv*bx;
-	double switchx2,disxl,disxr,disx2,disxr2;
+	double switchx2,disx2;
 
-	if(di==0) {dijkl=dijk+nx-1;disxl=disx+bx;}
-	else {dijkl=dijk-1;disxl=disx;}
+	// Down-left primary block
+	for(l=0;l<co[fijk];l++)
+		if(p[fijk][ps*l+1]>switchy&&p[fijk][ps*l]>switchx) put_image(dijk,fijk,l,disx,disy,bz*ima);
 
-	if(di==nx-1) {dijkr=dijk-nx+1;disxr=disx-bx;}
-	else {dijkr=dijk+1;disxr=disx;}
-
-	// Down-left image computation
-	bool y_exist=dj!=0;
-	if((img[dijk]&1)==0) {
-		img[dijkl]|=2;
-		if(y_exist) {
-			img[dijkl-nx]|=8;
-			img[dijk-nx]|=4;
-		}
-		for(l=0;l<co[fijk];l++) {
-			if(p[fijk][ps*l+1]>switchy) {
-				if(p[fijk][ps*l]>switchx) put_image(dijk,fijk,l,disx,disy,bz*ima);
-				else put_image(dijkl,fijk,l,disxl,disy,bz*ima);
-			} else {
-				if(!y_exist) continue;
-				if(p[fijk][ps*l]>switchx) put_image(dijk-nx,fijk,l,disx,disy,bz*ima);
-				else put_image(dijkl-nx,fijk,l,disxl,disy,bz*ima);
-			}
-		}
-	}
-
-	// Down-right image computation
-	if((img[dijk]&2)==0) {
-		if(fi==nx-1) {
-			fijk2=fijk+1-nx;switchx2=switchx+(1-nx)*boxx;disx2=disx+bx;disxr2=disxr+bx;
-		} else {
-			fijk2=fijk+1;switchx2=switchx+boxx;disx2=disx;disxr2=disxr;
-		}
-		img[dijkr]|=1;
-		if(y_exist) {
-			img[dijkr-nx]|=4;
-			img[dijk-nx]|=8;
-		}
-		for(l=0;l<co[fijk2];l++) {
-			if(p[fijk2][ps*l+1]>switchy) {
-				if(p[fijk2][ps*l]>switchx2) put_image(dijkr,fijk2,l,disxr2,disy,bz*ima);
-				else put_image(dijk,fijk2,l,disx2,disy,bz*ima);
-			} else {
-				if(!y_exist) continue;
-				if(p[fijk2][ps*l]>switchx2) put_image(dijkr-nx,fijk2,l,disxr2,disy,bz*ima);
-				else put_image(dijk-nx,fijk2,l,disx2,disy,bz*ima);
-			}
-		}
+	// Down-right primary block
+	if(fi==nx-1) {
+		fijk2=fijk+1-nx;switchx2=switchx+(1-nx)*boxx;disx2=disx+bx;
+	} else {
+		fijk2=fijk+1;switchx2=switchx+boxx;disx2=disx;
 	}
+	for(l=0;l<co[fijk2];l++)
+		if(p[fijk2][ps*l+1]>switchy&&p[fijk2][ps*l]<=switchx2) put_image(dijk,fijk2,l,disx2,disy,bz*ima);
 
 	// Recomputation of some intermediate quantities for boundary cases
 	if(fj==wy-1) {
@@ -699,63 +1339,35 @@ void container_periodic_base::create_vertical_image(int di,int dj,int dk) {
 		fi=qi-qidiv*nx;
 		fijk+=fi;
 		disx+=bxy+bx*dqidiv;
-		disxl+=bxy+bx*dqidiv;
-		disxr+=bxy+bx*dqidiv;
 		switchx-=bxy+bx*dqidiv;
 	} else {
 		fijk+=nx;switchy+=boxy;
 	}
 
-	// Up-left image computation
-	y_exist=dj!=oy-1;
-	if((img[dijk]&4)==0) {
-		img[dijkl]|=8;
-		if(y_exist) {
-			img[dijkl+nx]|=2;
-			img[dijk+nx]|=1;
-		}
-		for(l=0;l<co[fijk];l++) {
-			if(p[fijk][ps*l+1]>switchy) {
-				if(!y_exist) continue;
-				if(p[fijk][ps*l]>switchx) put_image(dijk+nx,fijk,l,disx,disy,bz*ima);
-				else put_image(dijkl+nx,fijk,l,disxl,disy,bz*ima);
-			} else {
-				if(p[fijk][ps*l]>switchx) put_image(dijk,fijk,l,disx,disy,bz*ima);
-				else put_image(dijkl,fijk,l,disxl,disy,bz*ima);
-			}
-		}
-	}
+	// Up-left primary block
+	for(l=0;l<co[fijk];l++)
+		if(p[fijk][ps*l+1]<=switchy&&p[fijk][ps*l]>switchx) put_image(dijk,fijk,l,disx,disy,bz*ima);
 
-	// Up-right image computation
-	if((img[dijk]&8)==0) {
-		if(fi==nx-1) {
-			fijk2=fijk+1-nx;switchx2=switchx+(1-nx)*boxx;disx2=disx+bx;disxr2=disxr+bx;
-		} else {
-			fijk2=fijk+1;switchx2=switchx+boxx;disx2=disx;disxr2=disxr;
-		}
-		img[dijkr]|=4;
-		if(y_exist) {
-			img[dijkr+nx]|=1;
-			img[dijk+nx]|=2;
-		}
-		for(l=0;l<co[fijk2];l++) {
-			if(p[fijk2][ps*l+1]>switchy) {
-				if(!y_exist) continue;
-				if(p[fijk2][ps*l]>switchx2) put_image(dijkr+nx,fijk2,l,disxr2,disy,bz*ima);
-				else put_image(dijk+nx,fijk2,l,disx2,disy,bz*ima);
-			} else {
-				if(p[fijk2][ps*l]>switchx2) put_image(dijkr,fijk2,l,disxr2,disy,bz*ima);
-				else put_image(dijk,fijk2,l,disx2,disy,bz*ima);
-			}
-		}
+	// Up-right primary block
+	if(fi==nx-1) {
+		fijk2=fijk+1-nx;switchx2=switchx+(1-nx)*boxx;disx2=disx+bx;
+	} else {
+		fijk2=fijk+1;switchx2=switchx+boxx;disx2=disx;
 	}
+	for(l=0;l<co[fijk2];l++)
+		if(p[fijk2][ps*l+1]<=switchy&&p[fijk2][ps*l]<=switchx2) put_image(dijk,fijk2,l,disx2,disy,bz*ima);
 
 	// All contributions to the block now added, so set all four bits of
 	// the image information
+#ifdef _OPENMP
+#pragma omp flush
+#endif
 	img[dijk]=15;
 }
 
 /** Copies a particle position from the primary domain into an image block.
+ * Only the image block is modified, so several threads can call this routine
+ * at once provided that they write to different image blocks.
  * \param[in] reg the block index within the primary domain that the particle
  *                is within.
  * \param[in] fijk the index of the image block.
@@ -763,7 +1375,7 @@ void container_periodic_base::create_vertical_image(int di,int dj,int dk) {
  * \param[in] (dx,dy,dz) the displacement vector to add to the particle. */
 void container_periodic_base::put_image(int reg,int fijk,int l,double dx,double dy,double dz) {
 	if(co[reg]==mem[reg]) add_particle_memory(reg);
-	double *p1=p[reg]+ps*co[reg],*p2=p[fijk]+ps*l;
+	fpoint *p1=p[reg]+ps*co[reg],*p2=p[fijk]+ps*l;
 	*(p1++)=*(p2++)+dx;
 	*(p1++)=*(p2++)+dy;
 	*p1=*p2+dz;
@@ -11,16 +11,20 @@
 #define VOROPP_CONTAINER_PRD_HH
 
 #include <cstdio>
+#include <cmath>
 #include <vector>
 
 #include "config.hh"
 #include "common.hh"
 #include "v_base.hh"
 #include "cell.hh"
+#include "format.hh"
+#include "column_writer.hh"
 #include "c_loops.hh"
 #include "v_compute.hh"
 #include "unitcell.hh"
 #include "rad_option.hh"
+#include "trace.hh"
 
 namespace voro {
 
@@ -35,7 +39,9 @@ namespace voro {
  * by the three periodicity vectors when they are necessary for the
  * computation. The internal memory structure for this class is significantly
  * different from the container_base class in order to handle the dynamic
- * construction of these periodic images.
+ * construction of these periodic images. An image block is only filled, and
+ * its memory only allocated, the first time that a Voronoi cell computation
+ * refers to it, which also applies when several threads compute cells at once.
  *
  * The class is derived from the unitcell class, which encapsulates information
  * about the domain geometry, and the voro_base class, which encapsulates
@@ -65,11 +71,11 @@ class container_periodic_base : public unitcell, public voro_base {
 		int oxyz;
 		/** This array holds the numerical IDs of each particle in each
 		 * computational box. */
-		int **id;
+		voro_id **id;
 		/** A two dimensional array holding particle positions. For the
 		 * derived container_poly class, this also holds particle
 		 * radii. */
-		double **p;
+		fpoint **p;
 		/** This array holds the number of particles within each
 		 * computational box of the container. */
 		int *co;
@@ -92,15 +98,26 @@ class container_periodic_base : public unitcell, public voro_base {
 		 * class container_poly, then this is set to 4, to also hold
 		 * the particle radii. */
 		const int ps;
+		/** A counter that is incremented whenever particles are added
+		 * to or removed from the container, so that any stored results
+		 * that depend on the particle arrangement can be invalidated.
+		 */
+		unsigned int update_count;
+		/** The blocks of the search mask used by the voro_compute
+		 * class refer to periodic images that are created as they are
+		 * needed, so the empty regions of the container can't be
+		 * skipped. */
+		static const bool direct_blocks=false;
 		container_periodic_base(double bx_,double bxy_,double by_,double bxz_,double byz_,double bz_,
 				int nx_,int ny_,int nz_,int init_mem_,int ps);
+		container_periodic_base(const unitcell &uc,int nx_,int ny_,int nz_,int init_mem_,int ps);
 		~container_periodic_base();
 		/** Prints all particles in the container, including those that
 		 * have been constructed in image blocks. */
 		inline void print_all_particles() {
 			int ijk,q;
 			for(ijk=0;ijk<oxyz;ijk++) for(q=0;q<co[ijk];q++)
-				printf("%d %g %g %g\n",id[ijk][q],p[ijk][ps*q],p[ijk][ps*q+1],p[ijk][ps*q+2]);
+				printf("%ld %g %g %g\n",long(id[ijk][q]),p[ijk][ps*q],p[ijk][ps*q+1],p[ijk][ps*q+2]);
 		}
 		void region_count();
 		/** Initializes the Voronoi cell prior to a compute_cell
@@ -124,9 +141,17 @@ class container_periodic_base : public unitcell, public voro_base {
 		template<class v_cell>
 		inline bool initialize_voronoicell(v_cell &c,int ijk,int q,int ci,int cj,int ck,int &i,int &j,int &k,double &x,double &y,double &z,int &disp) {
 			c=unit_voro;
-			double *pp=p[ijk]+ps*q;
+			fpoint *pp=p[ijk]+ps*q;
 			x=*(pp++);y=*(pp++);z=*pp;
 			i=nx;j=ey;k=ez;
+			return apply_cutoff(c);
+		}
+		/** Finishes a Voronoi cell computation carried out by a
+		 * voro_compute class. Since the periodic containers have no
+		 * walls, there is nothing to do.
+		 * \return True, since the cell is not altered. */
+		template<class v_cell>
+		inline bool apply_far_walls(v_cell &c,double x,double y,double z) {
 			return true;
 		}
 		/** Initializes parameters for a find_voronoi_cell call within
@@ -155,6 +180,17 @@ class container_periodic_base : public unitcell, public voro_base {
 			fy=y-boxy*(cj-ey);
 			fz=z-boxz*(ck-ez);
 		}
+		/** Moves a displacement vector between two particles to a
+		 * nearby periodic image, by removing whole multiples of each
+		 * of the three lattice vectors in turn.
+		 * \param[in,out] (x,y,z) the displacement vector. */
+		inline void min_image(double &x,double &y,double &z) {
+			double d=floor(z/bz+0.5);
+			x-=d*bxz;y-=d*byz;z-=d*bz;
+			d=floor(y/by+0.5);
+			x-=d*bxy;y-=d*by;
+			x-=bx*floor(x/bx+0.5);
+		}
 		/** Calculates the index of block in the container structure
 		 * corresponding to given coordinates.
 		 * \param[in] (ci,cj,ck) the coordinates of the original block
@@ -175,33 +211,45 @@ class container_periodic_base : public unitcell, public voro_base {
 			create_periodic_image(qi,qj,qk);
 			return qi+nx*(qj+oy*qk);
 		}
-		void create_all_images();
+		void create_all_images(int nt=1);
 		void check_compartmentalized();
+		void put_bulk(voro_id n,const voro_id *pid,const double *pp,particle_order *vo=NULL);
+		void shrink_particle_memory();
+		void place_particle_memory(int nt=0);
+		voro_memory memory_usage();
+		void swap(container_periodic_base &c);
+		bool locate_ghost(int &ijk,int &ci,int &cj,int &ck,double &x,double &y,double &z);
 	protected:
+		/** Locks for each z layer of blocks, which are held while the
+		 * image blocks in that layer are being constructed. They are
+		 * only allocated if the library is compiled with OpenMP, and
+		 * are kept opaque so that the class layout does not depend on
+		 * the compilation flags of the code that includes this
+		 * header. */
+		void *ilk;
+		void save_state(const char *filename,double mr);
+		double load_state(const char *filename);
 		void add_particle_memory(int i);
+		void add_particle_memory(int i,int nmem);
+		void clear_images();
+		inline void put_remap(int &ijk,double &x,double &y,double &z);
 		void put_locate_block(int &ijk,double &x,double &y,double &z);
 		void put_locate_block(int &ijk,double &x,double &y,double &z,int &ai,int &aj,int &ak);
-		/** Creates particles within an image block by copying them
-		 * from the primary domain and shifting them. If the given
-		 * block is aligned with the primary domain in the z-direction,
-		 * the routine calls the simpler create_side_image routine
-		 * where the image block may comprise of particles from up to
-		 * two primary blocks. Otherwise is calls the more complex
-		 * create_vertical_image where the image block may comprise of
-		 * particles from up to four primary blocks.
-		 * \param[in] (di,dj,dk) the coordinates of the image block to
-		 *                       create. */
-		inline void create_periodic_image(int di,int dj,int dk) {
-			if(di<0||di>=nx||dj<0||dj>=oy||dk<0||dk>=oz)
-				voro_fatal_error("Constructing periodic image for nonexistent point",VOROPP_INTERNAL_ERROR);
-			if(dk>=ez&&dk<wz) {
-				if(dj<ey||dj>=wy) create_side_image(di,dj,dk);
-			} else create_vertical_image(di,dj,dk);
-		}
+		void create_periodic_image(int di,int dj,int dk);
+		void fill_image(int di,int dj,int dk);
 		void create_side_image(int di,int dj,int dk);
 		void create_vertical_image(int di,int dj,int dk);
 		void put_image(int reg,int fijk,int l,double dx,double dy,double dz);
 		inline void remap(int &ai,int &aj,int &ak,int &ci,int &cj,int &ck,double &x,double &y,double &z,int &ijk);
+	private:
+		void setup_blocks();
+		/** The copy constructor is not available, since the
+		 * containers own their particle memory. The contents of two
+		 * containers can be exchanged with swap(). */
+		container_periodic_base(const container_periodic_base &c);
+		/** Assignment is not available, for the same reason as the
+		 * copy constructor. */
+		void operator=(const container_periodic_base &c);
 };
 
 /** \brief Extension of the container_periodic_base class for computing regular
@@ -214,22 +262,38 @@ class container_periodic : public container_periodic_base, public radius_mono {
 	public:
 		container_periodic(double bx_,double bxy_,double by_,double bxz_,double byz_,double bz_,
 				int nx_,int ny_,int nz_,int init_mem_);
+		container_periodic(const unitcell &uc,int nx_,int ny_,int nz_,int init_mem_);
 		void clear();
-		void put(int n,double x,double y,double z);
-		void put(int n,double x,double y,double z,int &ai,int &aj,int &ak);
-		void put(particle_order &vo,int n,double x,double y,double z);
-		void import(FILE *fp=stdin);
-		void import(particle_order &vo,FILE *fp=stdin);
+		/** Saves the particles and the block structure of the
+		 * container to a binary state file. Walls are not saved.
+		 * \param[in] filename the name of the file to write to. */
+		inline void save(const char *filename) {save_state(filename,0);}
+		/** Restores the particles and the block structure of the
+		 * container from a binary state file, replacing any particles
+		 * that are currently stored. The container must have been set
+		 * up with the same geometry and block structure as the one
+		 * that saved the file.
+		 * \param[in] filename the name of the file to read. */
+		inline void load(const char *filename) {load_state(filename);}
+		void put(voro_id n,double x,double y,double z);
+		void put(voro_id n,double x,double y,double z,int &ai,int &aj,int &ak);
+		void put(particle_order &vo,voro_id n,double x,double y,double z);
+		void import(FILE *fp=stdin,int nt=1);
+		void import(particle_order &vo,FILE *fp=stdin,int nt=1);
+		void import_binary(const char *filename);
+		void import_binary(particle_order &vo,const char *filename);
 		/** Imports a list of particles from an open file stream into
 		 * the container. Entries of four numbers (Particle ID, x
 		 * position, y position, z position) are searched for. If the
 		 * file cannot be successfully read, then the routine causes a
 		 * fatal error.
 		 * \param[in] filename the name of the file to open and read
-		 *                     from. */
-		inline void import(const char* filename) {
+		 *                     from.
+		 * \param[in] nt the number of threads to use to parse
+		 *               the file. */
+		inline void import(const char* filename,int nt=1) {
 			FILE *fp=safe_fopen(filename,"r");
-			import(fp);
+			import(fp,nt);
 			fclose(fp);
 		}
 		/** Imports a list of particles from an open file stream into
@@ -240,23 +304,27 @@ class container_periodic : public container_periodic_base, public radius_mono {
 		 * read, then the routine causes a fatal error.
 		 * \param[in,out] vo the ordering class to use.
 		 * \param[in] filename the name of the file to open and read
-		 *                     from. */
-		inline void import(particle_order &vo,const char* filename) {
+		 *                     from.
+		 * \param[in] nt the number of threads to use to parse
+		 *               the file. */
+		inline void import(particle_order &vo,const char* filename,int nt=1) {
 			FILE *fp=safe_fopen(filename,"r");
-			import(vo,fp);
+			import(vo,fp,nt);
 			fclose(fp);
 		}
-		void compute_all_cells();
+		void compute_all_cells(int nt=1);
 		double sum_cell_volumes();
 		/** Dumps particle IDs and positions to a file.
 		 * \param[in] vl the loop class to use.
 		 * \param[in] fp a file handle to write to. */
 		template<class c_loop>
 		void draw_particles(c_loop &vl,FILE *fp) {
-			double *pp;
+			fpoint *pp;
+			text_writer tw(fp);
 			if(vl.start()) do {
 				pp=p[vl.ijk]+3*vl.q;
-				fprintf(fp,"%d %g %g %g\n",id[vl.ijk][vl.q],*pp,pp[1],pp[2]);
+				tw.put(id[vl.ijk][vl.q]);tw.put(' ');
+				tw.put3(*pp,pp[1],pp[2],' ');tw.put('\n');
 			} while(vl.inc());
 		}
 		/** Dumps all of the particle IDs and positions to a file.
@@ -277,11 +345,12 @@ class container_periodic : public container_periodic_base, public radius_mono {
 		 * \param[in] fp a file handle to write to. */
 		template<class c_loop>
 		void draw_particles_pov(c_loop &vl,FILE *fp) {
-			double *pp;
+			fpoint *pp;
+			text_writer tw(fp);
 			if(vl.start()) do {
 				pp=p[vl.ijk]+3*vl.q;
-				fprintf(fp,"// id %d\nsphere{<%g,%g,%g>,s}\n",
-						id[vl.ijk][vl.q],*pp,pp[1],pp[2]);
+				tw.put("// id ");tw.put(id[vl.ijk][vl.q]);
+				tw.put("\nsphere{<");tw.put3(*pp,pp[1],pp[2],',');tw.put(">,s}\n");
 			} while(vl.inc());
 		}
 		/** Dumps all particle positions in POV-Ray format.
@@ -303,7 +372,7 @@ class container_periodic : public container_periodic_base, public radius_mono {
 		 * \param[in] fp a file handle to write to. */
 		template<class c_loop>
 		void draw_cells_gnuplot(c_loop &vl,FILE *fp) {
-			voronoicell c(*this);double *pp;
+			voronoicell c(*this);fpoint *pp;
 			if(vl.start()) do if(compute_cell(c,vl)) {
 				pp=p[vl.ijk]+ps*vl.q;
 				c.draw_gnuplot(*pp,pp[1],pp[2],fp);
@@ -330,9 +399,9 @@ class container_periodic : public container_periodic_base, public radius_mono {
 		 * \param[in] fp a file handle to write to. */
 		template<class c_loop>
 		void draw_cells_pov(c_loop &vl,FILE *fp) {
-			voronoicell c(*this);double *pp;
+			voronoicell c(*this);fpoint *pp;
 			if(vl.start()) do if(compute_cell(c,vl)) {
-				fprintf(fp,"// cell %d\n",id[vl.ijk][vl.q]);
+				fprintf(fp,"// cell %ld\n",long(id[vl.ijk][vl.q]));
 				pp=p[vl.ijk]+ps*vl.q;
 				c.draw_pov(*pp,pp[1],pp[2],fp);
 			} while(vl.inc());
@@ -359,24 +428,54 @@ class container_periodic : public container_periodic_base, public radius_mono {
 		 * \param[in] fp a file handle to write to. */
 		template<class c_loop>
 		void print_custom(c_loop &vl,const char *format,FILE *fp) {
-			int ijk,q;double *pp;
-			if(contains_neighbor(format)) {
+			int ijk,q;fpoint *pp;
+			compiled_format fm(format);
+			if(fm.neighbor()) {
 				voronoicell_neighbor c(*this);
 				if(vl.start()) do if(compute_cell(c,vl)) {
 					ijk=vl.ijk;q=vl.q;pp=p[ijk]+ps*q;
-					c.output_custom(format,id[ijk][q],*pp,pp[1],pp[2],default_radius,fp);
+					fm.write(c,id[ijk][q],*pp,pp[1],pp[2],default_radius,fp);
 				} while(vl.inc());
 			} else {
 				voronoicell c(*this);
 				if(vl.start()) do if(compute_cell(c,vl)) {
 					ijk=vl.ijk;q=vl.q;pp=p[ijk]+ps*q;
-					c.output_custom(format,id[ijk][q],*pp,pp[1],pp[2],default_radius,fp);
+					fm.write(c,id[ijk][q],*pp,pp[1],pp[2],default_radius,fp);
 				} while(vl.inc());
 			}
 		}
-		void print_custom(const char *format,FILE *fp=stdout);
-		void print_custom(const char *format,const char *filename);
-		bool find_voronoi_cell(double x,double y,double z,double &rx,double &ry,double &rz,int &pid);
+		void print_custom(const char *format,FILE *fp=stdout,int nt=1);
+		void print_custom(const char *format,const char *filename,int nt=1);
+		/** Computes the Voronoi cells and adds their statistics to a
+		 * binary column writer. Each chunk is written out as soon as it
+		 * is full, and any remaining cells are written at the end. The
+		 * header of the file is not written by this routine.
+		 * \param[in] vl the loop class to use.
+		 * \param[in] clw the column writer to use.
+		 * \param[in] fp a file handle to write to. */
+		template<class c_loop>
+		void print_columns(c_loop &vl,column_writer &clw,FILE *fp) {
+			int ijk,q;fpoint *pp;
+			if(clw.neighbor()) {
+				voronoicell_neighbor c(*this);
+				if(vl.start()) do if(compute_cell(c,vl)) {
+					ijk=vl.ijk;q=vl.q;pp=p[ijk]+ps*q;
+					clw.add(c,id[ijk][q],*pp,pp[1],pp[2],default_radius);
+					if(clw.full()) clw.write_chunk(fp);
+				} while(vl.inc());
+			} else {
+				voronoicell c(*this);
+				if(vl.start()) do if(compute_cell(c,vl)) {
+					ijk=vl.ijk;q=vl.q;pp=p[ijk]+ps*q;
+					clw.add(c,id[ijk][q],*pp,pp[1],pp[2],default_radius);
+					if(clw.full()) clw.write_chunk(fp);
+				} while(vl.inc());
+			}
+			clw.write_chunk(fp);
+		}
+		void print_columns(const char *columns,FILE *fp=stdout,int nt=1);
+		void print_columns(const char *columns,const char *filename,int nt=1);
+		bool find_voronoi_cell(double x,double y,double z,double &rx,double &ry,double &rz,voro_id &pid);
 		/** Computes the Voronoi cell for a particle currently being
 		 * referenced by a loop class.
 		 * \param[out] c a Voronoi cell class in which to store the
@@ -389,6 +488,24 @@ class container_periodic : public container_periodic_base, public radius_mono {
 		inline bool compute_cell(v_cell &c,c_loop &vl) {
 			return vc.compute_cell(c,vl.ijk,vl.q,vl.i,vl.j,vl.k);
 		}
+		/** Computes the Voronoi cell for a particle currently being
+		 * referenced by a loop class, cutting it first by the planes
+		 * of a list of particles that are expected to be its
+		 * neighbors.
+		 * \param[out] c a Voronoi cell class in which to store the
+		 * 		 computed cell.
+		 * \param[in] vl the loop class to use.
+		 * \param[in] (sp,se) pointers to the start and end of an
+		 *		      array of the seed particles, given as pairs
+		 *		      of the block index and the index within the
+		 *		      block.
+		 * \return True if the cell was computed. If the cell cannot be
+		 * computed, if it is removed entirely by a wall or boundary
+		 * condition, then the routine returns false. */
+		template<class v_cell,class c_loop>
+		inline bool compute_cell(v_cell &c,c_loop &vl,const int *sp,const int *se) {
+			return vc.compute_cell(c,vl.ijk,vl.q,vl.i,vl.j,vl.k,sp,se);
+		}
 		/** Computes the Voronoi cell for given particle.
 		 * \param[out] c a Voronoi cell class in which to store the
 		 * 		 computed cell.
@@ -402,6 +519,60 @@ class container_periodic : public container_periodic_base, public radius_mono {
 			int k(ijk/(nx*oy)),ijkt(ijk-(nx*oy)*k),j(ijkt/nx),i(ijkt-j*nx);
 			return vc.compute_cell(c,ijk,q,i,j,k);
 		}
+		/** Computes the Voronoi cell for a particle currently being
+		 * referenced by a loop class, using a separate voro_compute
+		 * class. Several threads can call this routine at once provided
+		 * that each uses its own voro_compute class. The periodic
+		 * images are constructed as they are needed, with each z
+		 * layer of blocks locked while its images are made.
+		 * \param[out] c a Voronoi cell class in which to store the
+		 * 		 computed cell.
+		 * \param[in] vl the loop class to use.
+		 * \param[in] vcl the voro_compute class to use, which can be
+		 *		 created with new_compute().
+		 * \return True if the cell was computed. If the cell cannot be
+		 * computed because it was removed entirely for some reason,
+		 * then the routine returns false. */
+		template<class v_cell,class c_loop,class w_class>
+		inline bool compute_cell(v_cell &c,c_loop &vl,voro_compute<container_periodic,w_class> &vcl) {
+			return vcl.compute_cell(c,vl.ijk,vl.q,vl.i,vl.j,vl.k);
+		}
+		/** Computes the Voronoi cell for given particle, using a
+		 * separate voro_compute class.
+		 * \param[out] c a Voronoi cell class in which to store the
+		 * 		 computed cell.
+		 * \param[in] ijk the block that the particle is within.
+		 * \param[in] q the index of the particle within the block.
+		 * \param[in] vcl the voro_compute class to use.
+		 * \return True if the cell was computed. If the cell cannot be
+		 * computed because it was removed entirely for some reason,
+		 * then the routine returns false. */
+		template<class v_cell,class w_class>
+		inline bool compute_cell(v_cell &c,int ijk,int q,voro_compute<container_periodic,w_class> &vcl) {
+			int k(ijk/(nx*oy)),ijkt(ijk-(nx*oy)*k),j(ijkt/nx),i(ijkt-j*nx);
+			return vcl.compute_cell(c,ijk,q,i,j,k);
+		}
+		/** Creates a new voro_compute class that is bound to this
+		 * container, which can be used to compute Voronoi cells
+		 * independently of the container's own instance.
+		 * \return A pointer to the new class, which the caller must
+		 * delete. */
+		inline voro_compute<container_periodic>* new_compute() {
+			return new voro_compute<container_periodic>(*this,vc.hx,vc.hy,vc.hz);
+		}
+		/** Returns the event counters for the container, which are the
+		 * totals for the container's own voro_compute class and for
+		 * the ones that have been used on the container and deleted.
+		 * These are only updated if VOROPP_COUNTERS is set.
+		 * \param[out] vt the counters. */
+		inline void total_counters(voro_counters &vt) {
+			vt=counters;vt.merge(vc.counters);
+		}
+		/** Sets all of the event counters for the container to
+		 * zero. */
+		inline void clear_counters() {
+			counters.clear();vc.counters.clear();
+		}
 		/** Computes the Voronoi cell for a ghost particle at a given
 		 * location.
 		 * \param[out] c a Voronoi cell class in which to store the
@@ -414,15 +585,19 @@ class container_periodic : public container_periodic_base, public radius_mono {
 		inline bool compute_ghost_cell(v_cell &c,double x,double y,double z) {
 			int ijk;
 			put_locate_block(ijk,x,y,z);
-			double *pp=p[ijk]+3*co[ijk]++;
+			fpoint *pp=p[ijk]+3*co[ijk]++;
 			*(pp++)=x;*(pp++)=y;*(pp++)=z;
 			bool q=compute_cell(c,ijk,co[ijk]-1);
 			co[ijk]--;
 			return q;
 		}
 	private:
+		template<class v_cell>
+		void print_custom_threaded(const char *format,FILE *fp,int nt);
+		template<class v_cell>
+		void print_columns_threaded(const char *columns,FILE *fp,int nt);
 		voro_compute<container_periodic> vc;
-		friend class voro_compute<container_periodic>;
+		template<class c_class,class w_class> friend class voro_compute;
 };
 
 /** \brief Extension of the container_periodic_base class for computing radical
@@ -435,22 +610,48 @@ class container_periodic_poly : public container_periodic_base, public radius_po
 	public:
 		container_periodic_poly(double bx_,double bxy_,double by_,double bxz_,double byz_,double bz_,
 				int nx_,int ny_,int nz_,int init_mem_);
+		container_periodic_poly(const unitcell &uc,int nx_,int ny_,int nz_,int init_mem_);
 		void clear();
-		void put(int n,double x,double y,double z,double r);
-		void put(int n,double x,double y,double z,double r,int &ai,int &aj,int &ak);
-		void put(particle_order &vo,int n,double x,double y,double z,double r);
-		void import(FILE *fp=stdin);
-		void import(particle_order &vo,FILE *fp=stdin);
+		/** Exchanges the particles of this container with another
+		 * one, as described for container_periodic_base::swap(),
+		 * along with the maximum particle radius.
+		 * \param[in] c the container to exchange with. */
+		inline void swap(container_periodic_poly &c) {
+			container_periodic_base::swap(c);
+			std::swap(max_radius,c.max_radius);
+		}
+		/** Saves the particles, the block structure, and the maximum
+		 * particle radius of the container to a binary state file.
+		 * Walls are not saved.
+		 * \param[in] filename the name of the file to write to. */
+		inline void save(const char *filename) {save_state(filename,max_radius);}
+		/** Restores the particles, the block structure, and the
+		 * maximum particle radius of the container from a binary
+		 * state file, replacing any particles that are currently
+		 * stored. The container must have been set up with the same
+		 * geometry and block structure as the one that saved the file.
+		 * \param[in] filename the name of the file to read. */
+		inline void load(const char *filename) {max_radius=load_state(filename);}
+		void put(voro_id n,double x,double y,double z,double r);
+		void put(voro_id n,double x,double y,double z,double r,int &ai,int &aj,int &ak);
+		void put(particle_order &vo,voro_id n,double x,double y,double z,double r);
+		void put_bulk(voro_id n,const voro_id *pid,const double *pp,particle_order *vo=NULL);
+		void import(FILE *fp=stdin,int nt=1);
+		void import(particle_order &vo,FILE *fp=stdin,int nt=1);
+		void import_binary(const char *filename);
+		void import_binary(particle_order &vo,const char *filename);
 		/** Imports a list of particles from an open file stream into
 		 * the container_poly class. Entries of five numbers (Particle
 		 * ID, x position, y position, z position, radius) are searched
 		 * for. If the file cannot be successfully read, then the
 		 * routine causes a fatal error.
 		 * \param[in] filename the name of the file to open and read
-		 *                     from. */
-		inline void import(const char* filename) {
+		 *                     from.
+		 * \param[in] nt the number of threads to use to parse
+		 *               the file. */
+		inline void import(const char* filename,int nt=1) {
 			FILE *fp=safe_fopen(filename,"r");
-			import(fp);
+			import(fp,nt);
 			fclose(fp);
 		}
 		/** Imports a list of particles from an open file stream into
@@ -461,23 +662,28 @@ class container_periodic_poly : public container_periodic_base, public radius_po
 		 * successfully read, then the routine causes a fatal error.
 		 * \param[in,out] vo the ordering class to use.
 		 * \param[in] filename the name of the file to open and read
-		 *                     from. */
-		inline void import(particle_order &vo,const char* filename) {
+		 *                     from.
+		 * \param[in] nt the number of threads to use to parse
+		 *               the file. */
+		inline void import(particle_order &vo,const char* filename,int nt=1) {
 			FILE *fp=safe_fopen(filename,"r");
-			import(vo,fp);
+			import(vo,fp,nt);
 			fclose(fp);
 		}
-		void compute_all_cells();
+		void compute_all_cells(int nt=1);
 		double sum_cell_volumes();
 		/** Dumps particle IDs, positions and radii to a file.
 		 * \param[in] vl the loop class to use.
 		 * \param[in] fp a file handle to write to. */
 		template<class c_loop>
 		void draw_particles(c_loop &vl,FILE *fp) {
-			double *pp;
+			fpoint *pp;
+			text_writer tw(fp);
 			if(vl.start()) do {
 				pp=p[vl.ijk]+4*vl.q;
-				fprintf(fp,"%d %g %g %g %g\n",id[vl.ijk][vl.q],*pp,pp[1],pp[2],pp[3]);
+				tw.put(id[vl.ijk][vl.q]);tw.put(' ');
+				tw.put3(*pp,pp[1],pp[2],' ');tw.put(' ');
+				tw.put(pp[3]);tw.put('\n');
 			} while(vl.inc());
 		}
 		/** Dumps all of the particle IDs, positions and radii to a
@@ -500,11 +706,13 @@ class container_periodic_poly : public container_periodic_base, public radius_po
 		 * \param[in] fp a file handle to write to. */
 		template<class c_loop>
 		void draw_particles_pov(c_loop &vl,FILE *fp) {
-			double *pp;
+			fpoint *pp;
+			text_writer tw(fp);
 			if(vl.start()) do {
 				pp=p[vl.ijk]+4*vl.q;
-				fprintf(fp,"// id %d\nsphere{<%g,%g,%g>,%g}\n",
-						id[vl.ijk][vl.q],*pp,pp[1],pp[2],pp[3]);
+				tw.put("// id ");tw.put(id[vl.ijk][vl.q]);
+				tw.put("\nsphere{<");tw.put3(*pp,pp[1],pp[2],',');
+				tw.put(">,");tw.put(pp[3]);tw.put("}\n");
 			} while(vl.inc());
 		}
 		/** Dumps all the particle positions in POV-Ray format.
@@ -526,7 +734,7 @@ class container_periodic_poly : public container_periodic_base, public radius_po
 		 * \param[in] fp a file handle to write to. */
 		template<class c_loop>
 		void draw_cells_gnuplot(c_loop &vl,FILE *fp) {
-			voronoicell c(*this);double *pp;
+			voronoicell c(*this);fpoint *pp;
 			if(vl.start()) do if(compute_cell(c,vl)) {
 				pp=p[vl.ijk]+ps*vl.q;
 				c.draw_gnuplot(*pp,pp[1],pp[2],fp);
@@ -553,9 +761,9 @@ class container_periodic_poly : public container_periodic_base, public radius_po
 		 * \param[in] fp a file handle to write to. */
 		template<class c_loop>
 		void draw_cells_pov(c_loop &vl,FILE *fp) {
-			voronoicell c(*this);double *pp;
+			voronoicell c(*this);fpoint *pp;
 			if(vl.start()) do if(compute_cell(c,vl)) {
-				fprintf(fp,"// cell %d\n",id[vl.ijk][vl.q]);
+				fprintf(fp,"// cell %ld\n",long(id[vl.ijk][vl.q]));
 				pp=p[vl.ijk]+ps*vl.q;
 				c.draw_pov(*pp,pp[1],pp[2],fp);
 			} while(vl.inc());
@@ -582,18 +790,19 @@ class container_periodic_poly : public container_periodic_base, public radius_po
 		 * \param[in] fp a file handle to write to. */
 		template<class c_loop>
 		void print_custom(c_loop &vl,const char *format,FILE *fp) {
-			int ijk,q;double *pp;
-			if(contains_neighbor(format)) {
+			int ijk,q;fpoint *pp;
+			compiled_format fm(format);
+			if(fm.neighbor()) {
 				voronoicell_neighbor c(*this);
 				if(vl.start()) do if(compute_cell(c,vl)) {
 					ijk=vl.ijk;q=vl.q;pp=p[ijk]+ps*q;
-					c.output_custom(format,id[ijk][q],*pp,pp[1],pp[2],pp[3],fp);
+					fm.write(c,id[ijk][q],*pp,pp[1],pp[2],pp[3],fp);
 				} while(vl.inc());
 			} else {
 				voronoicell c(*this);
 				if(vl.start()) do if(compute_cell(c,vl)) {
 					ijk=vl.ijk;q=vl.q;pp=p[ijk]+ps*q;
-					c.output_custom(format,id[ijk][q],*pp,pp[1],pp[2],pp[3],fp);
+					fm.write(c,id[ijk][q],*pp,pp[1],pp[2],pp[3],fp);
 				} while(vl.inc());
 			}
 		}
@@ -609,6 +818,24 @@ class container_periodic_poly : public container_periodic_base, public radius_po
 		inline bool compute_cell(v_cell &c,c_loop &vl) {
 			return vc.compute_cell(c,vl.ijk,vl.q,vl.i,vl.j,vl.k);
 		}
+		/** Computes the Voronoi cell for a particle currently being
+		 * referenced by a loop class, cutting it first by the planes
+		 * of a list of particles that are expected to be its
+		 * neighbors.
+		 * \param[out] c a Voronoi cell class in which to store the
+		 * 		 computed cell.
+		 * \param[in] vl the loop class to use.
+		 * \param[in] (sp,se) pointers to the start and end of an
+		 *		      array of the seed particles, given as pairs
+		 *		      of the block index and the index within the
+		 *		      block.
+		 * \return True if the cell was computed. If the cell cannot be
+		 * computed, if it is removed entirely by a wall or boundary
+		 * condition, then the routine returns false. */
+		template<class v_cell,class c_loop>
+		inline bool compute_cell(v_cell &c,c_loop &vl,const int *sp,const int *se) {
+			return vc.compute_cell(c,vl.ijk,vl.q,vl.i,vl.j,vl.k,sp,se);
+		}
 		/** Computes the Voronoi cell for given particle.
 		 * \param[out] c a Voronoi cell class in which to store the
 		 * 		 computed cell.
@@ -622,6 +849,60 @@ class container_periodic_poly : public container_periodic_base, public radius_po
 			int k(ijk/(nx*oy)),ijkt(ijk-(nx*oy)*k),j(ijkt/nx),i(ijkt-j*nx);
 			return vc.compute_cell(c,ijk,q,i,j,k);
 		}
+		/** Computes the Voronoi cell for a particle currently being
+		 * referenced by a loop class, using a separate voro_compute
+		 * class. Several threads can call this routine at once provided
+		 * that each uses its own voro_compute class. The periodic
+		 * images are constructed as they are needed, with each z
+		 * layer of blocks locked while its images are made.
+		 * \param[out] c a Voronoi cell class in which to store the
+		 * 		 computed cell.
+		 * \param[in] vl the loop class to use.
+		 * \param[in] vcl the voro_compute class to use, which can be
+		 *		 created with new_compute().
+		 * \return True if the cell was computed. If the cell cannot be
+		 * computed because it was removed entirely for some reason,
+		 * then the routine returns false. */
+		template<class v_cell,class c_loop,class w_class>
+		inline bool compute_cell(v_cell &c,c_loop &vl,voro_compute<container_periodic_poly,w_class> &vcl) {
+			return vcl.compute_cell(c,vl.ijk,vl.q,vl.i,vl.j,vl.k);
+		}
+		/** Computes the Voronoi cell for given particle, using a
+		 * separate voro_compute class.
+		 * \param[out] c a Voronoi cell class in which to store the
+		 * 		 computed cell.
+		 * \param[in] ijk the block that the particle is within.
+		 * \param[in] q the index of the particle within the block.
+		 * \param[in] vcl the voro_compute class to use.
+		 * \return True if the cell was computed. If the cell cannot be
+		 * computed because it was removed entirely for some reason,
+		 * then the routine returns false. */
+		template<class v_cell,class w_class>
+		inline bool compute_cell(v_cell &c,int ijk,int q,voro_compute<container_periodic_poly,w_class> &vcl) {
+			int k(ijk/(nx*oy)),ijkt(ijk-(nx*oy)*k),j(ijkt/nx),i(ijkt-j*nx);
+			return vcl.compute_cell(c,ijk,q,i,j,k);
+		}
+		/** Creates a new voro_compute class that is bound to this
+		 * container, which can be used to compute Voronoi cells
+		 * independently of the container's own instance.
+		 * \return A pointer to the new class, which the caller must
+		 * delete. */
+		inline voro_compute<container_periodic_poly>* new_compute() {
+			return new voro_compute<container_periodic_poly>(*this,vc.hx,vc.hy,vc.hz);
+		}
+		/** Returns the event counters for the container, which are the
+		 * totals for the container's own voro_compute class and for
+		 * the ones that have been used on the container and deleted.
+		 * These are only updated if VOROPP_COUNTERS is set.
+		 * \param[out] vt the counters. */
+		inline void total_counters(voro_counters &vt) {
+			vt=counters;vt.merge(vc.counters);
+		}
+		/** Sets all of the event counters for the container to
+		 * zero. */
+		inline void clear_counters() {
+			counters.clear();vc.counters.clear();
+		}
 		/** Computes the Voronoi cell for a ghost particle at a given
 		 * location.
 		 * \param[out] c a Voronoi cell class in which to store the
@@ -635,19 +916,52 @@ class container_periodic_poly : public container_periodic_base, public radius_po
 		inline bool compute_ghost_cell(v_cell &c,double x,double y,double z,double r) {
 			int ijk;
 			put_locate_block(ijk,x,y,z);
-			double *pp=p[ijk]+4*co[ijk]++,tm=max_radius;
+			fpoint *pp=p[ijk]+4*co[ijk]++,tm=max_radius;
 			*(pp++)=x;*(pp++)=y;*(pp++)=z;*pp=r;
 			if(r>max_radius) max_radius=r;
 			bool q=compute_cell(c,ijk,co[ijk]-1);
 			co[ijk]--;max_radius=tm;
 			return q;
 		}
-		void print_custom(const char *format,FILE *fp=stdout);
-		void print_custom(const char *format,const char *filename);
-		bool find_voronoi_cell(double x,double y,double z,double &rx,double &ry,double &rz,int &pid);
+		void print_custom(const char *format,FILE *fp=stdout,int nt=1);
+		void print_custom(const char *format,const char *filename,int nt=1);
+		/** Computes the Voronoi cells and adds their statistics to a
+		 * binary column writer. Each chunk is written out as soon as it
+		 * is full, and any remaining cells are written at the end. The
+		 * header of the file is not written by this routine.
+		 * \param[in] vl the loop class to use.
+		 * \param[in] clw the column writer to use.
+		 * \param[in] fp a file handle to write to. */
+		template<class c_loop>
+		void print_columns(c_loop &vl,column_writer &clw,FILE *fp) {
+			int ijk,q;fpoint *pp;
+			if(clw.neighbor()) {
+				voronoicell_neighbor c(*this);
+				if(vl.start()) do if(compute_cell(c,vl)) {
+					ijk=vl.ijk;q=vl.q;pp=p[ijk]+ps*q;
+					clw.add(c,id[ijk][q],*pp,pp[1],pp[2],pp[3]);
+					if(clw.full()) clw.write_chunk(fp);
+				} while(vl.inc());
+			} else {
+				voronoicell c(*this);
+				if(vl.start()) do if(compute_cell(c,vl)) {
+					ijk=vl.ijk;q=vl.q;pp=p[ijk]+ps*q;
+					clw.add(c,id[ijk][q],*pp,pp[1],pp[2],pp[3]);
+					if(clw.full()) clw.write_chunk(fp);
+				} while(vl.inc());
+			}
+			clw.write_chunk(fp);
+		}
+		void print_columns(const char *columns,FILE *fp=stdout,int nt=1);
+		void print_columns(const char *columns,const char *filename,int nt=1);
+		bool find_voronoi_cell(double x,double y,double z,double &rx,double &ry,double &rz,voro_id &pid);
 	private:
+		template<class v_cell>
+		void print_custom_threaded(const char *format,FILE *fp,int nt);
+		template<class v_cell>
+		void print_columns_threaded(const char *columns,FILE *fp,int nt);
 		voro_compute<container_periodic_poly> vc;
-		friend class voro_compute<container_periodic_poly>;
+		template<class c_class,class w_class> friend class voro_compute;
 };
 
 }
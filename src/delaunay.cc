@@ -0,0 +1,122 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file delaunay.cc
+ * \brief Function implementations for the delaunay_graph class. */
+
+#include <algorithm>
+
+#include "delaunay.hh"
+
+namespace voro {
+
+/** \brief A comparison function object for sorting groups of integers.
+ *
+ * This compares two groups of integers of a fixed length in an array, given
+ * by their indices, in lexicographic order. */
+struct delaunay_cmp {
+	/** A pointer to the array of integers. */
+	const voro_id *v;
+	/** The number of integers in each group. */
+	const int n;
+	delaunay_cmp(const voro_id *v_,int n_) : v(v_), n(n_) {}
+	inline bool operator()(int a,int b) const {
+		const voro_id *p=v+n*a,*q=v+n*b,*e=p+n;
+		for(;p<e;p++,q++) if(*p!=*q) return *p<*q;
+		return false;
+	}
+};
+
+/** Sorts the groups of integers of a fixed length in an array in
+ * lexicographic order, and removes any repeated groups.
+ * \param[in,out] v the array.
+ * \param[in] n the number of integers in each group. */
+static void delaunay_sort(std::vector<voro_id> &v,int n) {
+	int i,j,l=v.size()/n;
+	if(l==0) return;
+	std::vector<int> o(l);
+	std::vector<voro_id> w;
+	for(i=0;i<l;i++) o[i]=i;
+	delaunay_cmp cmp(&v[0],n);
+	std::sort(o.begin(),o.end(),cmp);
+	w.reserve(v.size());
+	for(i=0;i<l;i++) {
+		if(i>0&&!cmp(o[i-1],o[i])) continue;
+		for(j=0;j<n;j++) w.push_back(v[n*o[i]+j]);
+	}
+	v.swap(w);
+}
+
+/** Removes all of the tetrahedra and edges from the graph. */
+void delaunay_graph::clear() {
+	tets.clear();edges.clear();
+}
+
+/** Adds the tetrahedra and edges of a Voronoi cell to the graph. An edge to a
+ * particle with a smaller ID is skipped, as is a tetrahedron that contains
+ * such a particle, since these are added with that particle's cell.
+ * \param[in] c a reference to the Voronoi cell.
+ * \param[in] id the ID of the particle associated with the cell. */
+void delaunay_graph::add(voronoicell_neighbor &c,voro_id id) {
+	int i,j,k;
+	voro_id *np;
+
+	// Add the edges of the Delaunay graph from the faces of the cell
+	c.neighbors(vn);
+	for(i=0;i<int(vn.size());i++) if(vn[i]>id) {
+		edges.push_back(id);edges.push_back(vn[i]);
+	}
+
+	// Add the tetrahedra from the vertices of the cell. The neighbor
+	// information of each edge of a vertex gives the face that is
+	// clockwise from it, so the faces around a vertex are read off in
+	// order.
+	for(i=0;i<c.p;i++) {
+		k=c.nu[i];np=c.ne[i];
+		for(j=1;j<k-1;j++) add_tet(id,*np,np[j],np[j+1]);
+	}
+}
+
+/** Adds a tetrahedron to the graph, as long as the given particle has the
+ * smallest ID and the other three are distinct particles.
+ * \param[in] id the ID of the particle whose cell is being added.
+ * \param[in] (a,b,c) the IDs of the other three particles, which are negative
+ *		      for walls. */
+void delaunay_graph::add_tet(voro_id id,voro_id a,voro_id b,voro_id c) {
+	if(a<=id||b<=id||c<=id||a==b||b==c||a==c) return;
+	if(a>b) std::swap(a,b);
+	if(b>c) {
+		std::swap(b,c);
+		if(a>b) std::swap(a,b);
+	}
+	tets.push_back(id);tets.push_back(a);tets.push_back(b);tets.push_back(c);
+}
+
+/** Sorts the tetrahedra and edges, and removes any repeated entries, which
+ * can occur in periodic containers when a cell borders several images of the
+ * same particle. This should be called once all of the cells have been
+ * added. */
+void delaunay_graph::finish() {
+	delaunay_sort(tets,4);
+	delaunay_sort(edges,2);
+}
+
+/** Prints the tetrahedra, with the four particle IDs of each one on a line.
+ * \param[in] fp a file handle to write to. */
+void delaunay_graph::print_tetrahedra(FILE *fp) {
+	for(unsigned int i=0;i<tets.size();i+=4)
+		fprintf(fp,"%ld %ld %ld %ld\n",long(tets[i]),long(tets[i+1]),long(tets[i+2]),long(tets[i+3]));
+}
+
+/** Prints the edges of the Delaunay graph, with the two particle IDs of each
+ * one on a line.
+ * \param[in] fp a file handle to write to. */
+void delaunay_graph::print_edges(FILE *fp) {
+	for(unsigned int i=0;i<edges.size();i+=2)
+		fprintf(fp,"%ld %ld\n",long(edges[i]),long(edges[i+1]));
+}
+
+}
@@ -0,0 +1,152 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file delaunay.hh
+ * \brief Header file for the delaunay_graph class. */
+
+#ifndef VOROPP_DELAUNAY_HH
+#define VOROPP_DELAUNAY_HH
+
+#include <cstdio>
+#include <vector>
+
+#include "config.hh"
+#include "common.hh"
+#include "cell.hh"
+#include "container.hh"
+#include "container_prd.hh"
+
+namespace voro {
+
+/** \brief A class for extracting the Delaunay tetrahedralization and the dual
+ * neighbor graph of the particles in a container.
+ *
+ * The Delaunay tetrahedralization is the dual of the Voronoi tessellation:
+ * each vertex of a Voronoi cell where three faces meet is the circumcenter of
+ * a tetrahedron formed by the particle and the three neighbors on the other
+ * sides of those faces, and each face is an edge of the Delaunay graph. This
+ * class reads these directly from the neighbor information of each cell as it
+ * is computed. Since every tetrahedron and edge is seen by each of the cells
+ * of its particles, it is only taken from the cell of the particle with the
+ * smallest ID, so that no deduplication table is needed while the cells are
+ * computed. Faces and vertices that touch a wall are skipped.
+ *
+ * At a degenerate vertex, where more than four particles are equidistant, the
+ * Delaunay tetrahedralization is not unique, and the faces around the vertex
+ * are split into a fan of tetrahedra. In a periodic container, the particles
+ * are given by their IDs, so a tetrahedron or edge that contains two periodic
+ * images of the same particle cannot be represented and is skipped. This only
+ * happens when the container is small compared to the particle spacing. */
+class delaunay_graph {
+	public:
+		/** The IDs of the particles of each tetrahedron, in groups of
+		 * four. The IDs of each tetrahedron are in increasing order,
+		 * and the tetrahedra are sorted lexicographically. */
+		std::vector<voro_id> tets;
+		/** The IDs of the particles at the ends of each edge of the
+		 * Delaunay graph, in pairs. The first ID of each pair is the
+		 * smaller one, and the pairs are sorted lexicographically. */
+		std::vector<voro_id> edges;
+		/** Returns the number of tetrahedra.
+		 * \return The number of tetrahedra. */
+		inline int total_tetrahedra() {return tets.size()>>2;}
+		/** Returns the number of edges.
+		 * \return The number of edges. */
+		inline int total_edges() {return edges.size()>>1;}
+		void clear();
+		void add(voronoicell_neighbor &c,voro_id id);
+		void finish();
+		/** Computes the Voronoi cells of the particles in a loop, and
+		 * adds their tetrahedra and edges to the graph. The finish()
+		 * routine must be called once all of the cells have been
+		 * added.
+		 * \param[in] vl the loop class to use.
+		 * \param[in] con the container that the loop refers to. */
+		template<class c_loop,class c_class>
+		void add(c_loop &vl,c_class &con) {
+			voronoicell_neighbor c(con);
+			if(vl.start()) do if(con.compute_cell(c,vl)) add(c,vl.pid());
+			while(vl.inc());
+		}
+		/** Computes the Voronoi cells of all of the particles in a
+		 * container, and stores the Delaunay tetrahedra and edges.
+		 * This is the same pass as the container's
+		 * compute_all_cells() routine, and any previous contents of
+		 * the graph are removed.
+		 * \param[in] con the container to use, which can be any of
+		 *		  the standard or periodic container classes.
+		 * \param[in] nt the number of threads to use. If this is more
+		 *		than one, then the blocks of the container are
+		 *		shared out among the threads by a block_scheduler,
+		 *		and each thread collects its tetrahedra and edges
+		 *		separately before they are merged. */
+		template<class c_class>
+		void compute(c_class &con,int nt=1) {
+			clear();
+			nt=voro_threads(nt);
+			block_scheduler bs(con,nt);
+#ifdef _OPENMP
+			if(nt>1) {
+#pragma omp parallel num_threads(nt) VOROPP_BIND
+				{
+					delaunay_graph dg;
+					dg.compute_thread(con,bs,omp_get_thread_num(),con.new_compute());
+#pragma omp critical
+					{
+						tets.insert(tets.end(),dg.tets.begin(),dg.tets.end());
+						edges.insert(edges.end(),dg.edges.begin(),dg.edges.end());
+					}
+				}
+				finish();
+				return;
+			}
+#endif
+			compute_thread(con,bs,0,con.new_compute());
+			finish();
+		}
+		void print_tetrahedra(FILE *fp=stdout);
+		/** Saves the tetrahedra to a file, with the four particle IDs
+		 * of each one on a line.
+		 * \param[in] filename the name of the file to write to. */
+		inline void print_tetrahedra(const char *filename) {
+			FILE *fp=safe_fopen(filename,"w");
+			print_tetrahedra(fp);
+			fclose(fp);
+		}
+		void print_edges(FILE *fp=stdout);
+		/** Saves the edges of the Delaunay graph to a file, with the
+		 * two particle IDs of each one on a line.
+		 * \param[in] filename the name of the file to write to. */
+		inline void print_edges(const char *filename) {
+			FILE *fp=safe_fopen(filename,"w");
+			print_edges(fp);
+			fclose(fp);
+		}
+	private:
+		/** Temporary storage for the neighbors of a cell. */
+		std::vector<voro_id> vn;
+		/** Computes the Voronoi cells in the chunks of blocks that a
+		 * block scheduler hands out to one thread, and adds them to
+		 * the graph.
+		 * \param[in] con the container to use.
+		 * \param[in] bs the block scheduler to use.
+		 * \param[in] t the thread number.
+		 * \param[in] vcl a pointer to a voro_compute class for the
+		 *		  container, which is deleted at the end. */
+		template<class c_class,class vc_class>
+		void compute_thread(c_class &con,block_scheduler &bs,int t,vc_class *vcl) {
+			voronoicell_neighbor c(con);
+			c_loop_parallel vl(con,bs,t);
+			if(vl.start()) do if(con.compute_cell(c,vl,*vcl)) add(c,vl.pid());
+			while(vl.inc());
+			delete vcl;
+		}
+		void add_tet(voro_id id,voro_id a,voro_id b,voro_id c);
+};
+
+}
+
+#endif
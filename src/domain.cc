@@ -0,0 +1,151 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file domain.cc
+ * \brief Function implementations for the domain_decomp class. */
+
+#include <cmath>
+
+#include "domain.hh"
+
+namespace voro {
+
+/** The class constructor sets up the geometry of the decomposition.
+ * \param[in] (ax_,bx_) the minimum and maximum x coordinates.
+ * \param[in] (ay_,by_) the minimum and maximum y coordinates.
+ * \param[in] (az_,bz_) the minimum and maximum z coordinates.
+ * \param[in] (dx_,dy_,dz_) the number of sub-boxes in each of the three
+ *			    coordinate directions. */
+domain_decomp::domain_decomp(double ax_,double bx_,double ay_,double by_,double az_,double bz_,int dx_,int dy_,int dz_)
+	: ax(ax_), bx(bx_), ay(ay_), by(by_), az(az_), bz(bz_), dx(dx_), dy(dy_), dz(dz_),
+	dxyz(dx_*dy_*dz_), wx((bx_-ax_)/dx_), wy((by_-ay_)/dy_), wz((bz_-az_)/dz_) {}
+
+/** Chooses a grid of sub-boxes for a given number of processes, out of all the
+ * factorizations of the number, that minimizes the total surface area between
+ * the sub-boxes, and hence the number of ghost particles that need to be
+ * exchanged.
+ * \param[in] n the number of sub-boxes to make.
+ * \param[in] (lx,ly,lz) the dimensions of the box.
+ * \param[out] (gx,gy,gz) the number of sub-boxes in each direction. */
+void domain_decomp::guess_grid(int n,double lx,double ly,double lz,int &gx,int &gy,int &gz) {
+	double s,smin=-1;
+	gx=gy=gz=1;
+	for(int i=1;i<=n;i++) if(n%i==0) for(int j=1;j<=n/i;j++) if((n/i)%j==0) {
+		int k=n/(i*j);
+		s=(i-1)*ly*lz+(j-1)*lx*lz+(k-1)*lx*ly;
+		if(smin<0||s<smin) {smin=s;gx=i;gy=j;gz=k;}
+	}
+}
+
+/** Finds the sub-box that owns a given position.
+ * \param[in] (x,y,z) the position to consider.
+ * \return The index of the sub-box, or -1 if the position is outside the
+ *         box. */
+int domain_decomp::owner(double x,double y,double z) {
+	if(x<ax||x>bx||y<ay||y>by||z<az||z>bz) return -1;
+	return index(x-ax,wx,dx)+dx*(index(y-ay,wy,dy)+dy*index(z-az,wz,dz));
+}
+
+/** Computes the bounds of a sub-box.
+ * \param[in] r the index of the sub-box.
+ * \param[out] (sax,sbx) the minimum and maximum x coordinates.
+ * \param[out] (say,sby) the minimum and maximum y coordinates.
+ * \param[out] (saz,sbz) the minimum and maximum z coordinates. */
+void domain_decomp::sub_box(int r,double &sax,double &sbx,double &say,double &sby,double &saz,double &sbz) {
+	int i=r%dx,j=(r/dx)%dy,k=r/(dx*dy);
+	sax=ax+i*wx;sbx=i==dx-1?bx:sax+wx;
+	say=ay+j*wy;sby=j==dy-1?by:say+wy;
+	saz=az+k*wz;sbz=k==dz-1?bz:saz+wz;
+}
+
+/** Computes the bounds of a sub-box extended by a ghost layer, clipped to the
+ * box.
+ * \param[in] r the index of the sub-box.
+ * \param[in] g the thickness of the ghost layer.
+ * \param[out] (gax,gbx) the minimum and maximum x coordinates.
+ * \param[out] (gay,gby) the minimum and maximum y coordinates.
+ * \param[out] (gaz,gbz) the minimum and maximum z coordinates. */
+void domain_decomp::ghost_box(int r,double g,double &gax,double &gbx,double &gay,double &gby,double &gaz,double &gbz) {
+	sub_box(r,gax,gbx,gay,gby,gaz,gbz);
+	gax-=g;if(gax<ax) gax=ax;
+	gbx+=g;if(gbx>bx) gbx=bx;
+	gay-=g;if(gay<ay) gay=ay;
+	gby+=g;if(gby>by) gby=by;
+	gaz-=g;if(gaz<az) gaz=az;
+	gbz+=g;if(gbz>bz) gbz=bz;
+}
+
+/** Finds all of the sub-boxes, other than a given one, whose ghost layers
+ * contain a given position.
+ * \param[in] r the index of the sub-box to exclude, usually the owner of the
+ *		position.
+ * \param[in] (x,y,z) the position to consider.
+ * \param[in] g the thickness of the ghost layer.
+ * \param[out] tg a vector to which the sub-box indices are appended. */
+void domain_decomp::ghost_targets(int r,double x,double y,double z,double g,std::vector<int> &tg) {
+	int i,j,k,ijk,
+	    li=index(x-g-ax,wx,dx),ui=index(x+g-ax,wx,dx),
+	    lj=index(y-g-ay,wy,dy),uj=index(y+g-ay,wy,dy),
+	    lk=index(z-g-az,wz,dz),uk=index(z+g-az,wz,dz);
+	for(k=lk;k<=uk;k++) for(j=lj;j<=uj;j++) for(i=li;i<=ui;i++) {
+		ijk=i+dx*(j+dy*k);
+		if(ijk!=r) tg.push_back(ijk);
+	}
+}
+
+/** Computes the distance from a position inside a sub-box to the nearest face
+ * of the sub-box that is shared with another sub-box. Faces on the boundary of
+ * the box are ignored, since the Voronoi cells are cut by them anyway.
+ * \param[in] r the index of the sub-box.
+ * \param[in] (x,y,z) the position to consider.
+ * \return The distance, or a large number if the sub-box has no shared
+ *         faces. */
+double domain_decomp::interior_distance(int r,double x,double y,double z) {
+	double sax,sbx,say,sby,saz,sbz,d=large_number;
+	int i=r%dx,j=(r/dx)%dy,k=r/(dx*dy);
+	sub_box(r,sax,sbx,say,sby,saz,sbz);
+	if(i>0&&x-sax<d) d=x-sax;
+	if(i<dx-1&&sbx-x<d) d=sbx-x;
+	if(j>0&&y-say<d) d=y-say;
+	if(j<dy-1&&sby-y<d) d=sby-y;
+	if(k>0&&z-saz<d) d=z-saz;
+	if(k<dz-1&&sbz-z<d) d=sbz-z;
+	return d;
+}
+
+/** Computes the ghost layer thickness that is needed for a Voronoi cell to be
+ * exact. A particle can only cut the cell if it is closer than twice the
+ * maximum vertex distance, so the cell is exact if all positions within this
+ * distance are inside the sub-box or its ghost layer.
+ * \param[in] r the index of the sub-box that owns the particle.
+ * \param[in] c a reference to the Voronoi cell, computed from the sub-box and
+ *              its ghost layer.
+ * \param[in] (x,y,z) the position of the particle.
+ * \return The required thickness. If this is less than or equal to the ghost
+ *         layer thickness that was used, then the cell is exact. */
+double domain_decomp::required_layer(int r,voronoicell_base &c,double x,double y,double z) {
+	return sqrt(c.max_radius_squared())-interior_distance(r,x,y,z);
+}
+
+/** Computes the ghost layer thickness that is needed for a radical Voronoi
+ * cell to be exact. A particle of radius rq at a distance d positions its
+ * cutting plane at a distance (d^2+rp^2-rq^2)/(2d), so with a maximum vertex
+ * distance R, all particles further away than R+sqrt(R^2+rmax^2-rp^2) cannot
+ * cut the cell.
+ * \param[in] r the index of the sub-box that owns the particle.
+ * \param[in] c a reference to the Voronoi cell, computed from the sub-box and
+ *              its ghost layer.
+ * \param[in] (x,y,z) the position of the particle.
+ * \param[in] rp the radius of the particle.
+ * \param[in] rmax the maximum radius of any particle.
+ * \return The required thickness. If this is less than or equal to the ghost
+ *         layer thickness that was used, then the cell is exact. */
+double domain_decomp::required_layer(int r,voronoicell_base &c,double x,double y,double z,double rp,double rmax) {
+	double rs=0.25*c.max_radius_squared();
+	return sqrt(rs)+sqrt(rs+rmax*rmax-rp*rp)-interior_distance(r,x,y,z);
+}
+
+}
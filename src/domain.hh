@@ -0,0 +1,92 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file domain.hh
+ * \brief Header file for the domain_decomp class. */
+
+#ifndef VOROPP_DOMAIN_HH
+#define VOROPP_DOMAIN_HH
+
+#include <vector>
+
+#include "config.hh"
+#include "cell.hh"
+
+namespace voro {
+
+/** \brief A class describing a decomposition of a rectangular box into a grid
+ * of sub-boxes.
+ *
+ * This class splits a non-periodic rectangular box into a regular grid of
+ * sub-boxes, so that each sub-box can be tessellated independently, for
+ * example by a separate process. Each sub-box is surrounded by a ghost layer,
+ * and the particles within it are copied from the neighboring sub-boxes. The
+ * class contains routines to determine which sub-box owns a particle, which
+ * sub-boxes need a copy of it as a ghost, and whether a Voronoi cell computed
+ * from a sub-box and its ghost layer is exact. The class is independent of any
+ * communication library. */
+class domain_decomp {
+	public:
+		/** The minimum x coordinate of the box. */
+		const double ax;
+		/** The maximum x coordinate of the box. */
+		const double bx;
+		/** The minimum y coordinate of the box. */
+		const double ay;
+		/** The maximum y coordinate of the box. */
+		const double by;
+		/** The minimum z coordinate of the box. */
+		const double az;
+		/** The maximum z coordinate of the box. */
+		const double bz;
+		/** The number of sub-boxes in the x direction. */
+		const int dx;
+		/** The number of sub-boxes in the y direction. */
+		const int dy;
+		/** The number of sub-boxes in the z direction. */
+		const int dz;
+		/** The total number of sub-boxes. */
+		const int dxyz;
+		/** The size of a sub-box in the x direction. */
+		const double wx;
+		/** The size of a sub-box in the y direction. */
+		const double wy;
+		/** The size of a sub-box in the z direction. */
+		const double wz;
+		domain_decomp(double ax_,double bx_,double ay_,double by_,double az_,double bz_,int dx_,int dy_,int dz_);
+		static void guess_grid(int n,double lx,double ly,double lz,int &gx,int &gy,int &gz);
+		int owner(double x,double y,double z);
+		void sub_box(int r,double &sax,double &sbx,double &say,double &sby,double &saz,double &sbz);
+		void ghost_box(int r,double g,double &gax,double &gbx,double &gay,double &gby,double &gaz,double &gbz);
+		void ghost_targets(int r,double x,double y,double z,double g,std::vector<int> &tg);
+		double interior_distance(int r,double x,double y,double z);
+		double required_layer(int r,voronoicell_base &c,double x,double y,double z);
+		double required_layer(int r,voronoicell_base &c,double x,double y,double z,double rp,double rmax);
+		/** Returns the largest ghost layer thickness that could ever
+		 * be needed, for which the ghost box of any sub-box covers
+		 * the whole domain.
+		 * \return The thickness. */
+		inline double max_layer() {
+			double l=bx-ax;
+			if(by-ay>l) l=by-ay;
+			if(bz-az>l) l=bz-az;
+			return l;
+		}
+	private:
+		/** Computes the sub-box index along one coordinate direction.
+		 * \param[in] u the coordinate relative to the lower bound.
+		 * \param[in] w the sub-box size in this direction.
+		 * \param[in] d the number of sub-boxes in this direction.
+		 * \return The index, clamped to the valid range. */
+		inline int index(double u,double w,int d) {
+			int i=int(u/w);
+			return i<0?0:(i>=d?d-1:i);
+		}
+};
+
+}
+
+#endif
@@ -0,0 +1,340 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file domain_mpi.hh
+ * \brief Header file for the domain_mpi class, which carries out a
+ * distributed Voronoi tessellation using MPI.
+ *
+ * This file is not included by voro++.hh and is not compiled into the
+ * library, so that the library has no dependence on MPI. Programs that use
+ * it should include it directly and be compiled with an MPI compiler
+ * wrapper. */
+
+#ifndef VOROPP_DOMAIN_MPI_HH
+#define VOROPP_DOMAIN_MPI_HH
+
+#include <cmath>
+#include <algorithm>
+#include <vector>
+#include <mpi.h>
+
+#include "config.hh"
+#include "cell.hh"
+#include "container.hh"
+#include "c_loops.hh"
+#include "domain.hh"
+
+namespace voro {
+
+/** The MPI datatype that matches the voro_id type of the particle IDs. */
+#ifdef VOROPP_LARGE_IDS
+#define VOROPP_MPI_ID MPI_LONG
+#else
+#define VOROPP_MPI_ID MPI_INT
+#endif
+
+/** \brief A class for computing a Voronoi tessellation distributed across
+ * several MPI processes.
+ *
+ * The box is split into a grid of sub-boxes using the domain_decomp class,
+ * with one sub-box for each process. Each process owns the particles in its
+ * sub-box, and receives copies of the particles within a ghost layer around
+ * it from the other processes. The owned cells are then computed in a local
+ * container or container_poly class, and are checked against the maximum
+ * vertex distance to see if the ghost layer was thick enough. Any cells that
+ * fail this test are recomputed after another exchange with a thicker ghost
+ * layer, so that the final cells are identical to those of a single
+ * container. All of the routines are collective, and must be called on every
+ * process of the communicator. */
+class domain_mpi : public domain_decomp {
+	public:
+		/** The MPI communicator. */
+		MPI_Comm comm;
+		/** The rank of this process, which is also the index of the
+		 * sub-box that it owns. */
+		const int rank;
+		/** The number of entries stored for each particle, set to 3
+		 * for the regular tessellation and 4 for the radical
+		 * tessellation. */
+		const int ps;
+		/** The IDs of the particles owned by this process. */
+		std::vector<voro_id> id;
+		/** The positions (and radii) of the particles owned by this
+		 * process. */
+		std::vector<double> p;
+		/** The IDs of the ghost particles. */
+		std::vector<voro_id> gid;
+		/** The positions (and radii) of the ghost particles. */
+		std::vector<double> gp;
+		/** The thickness of the current ghost layer. */
+		double gl;
+		/** The walls to apply to the local containers. */
+		wall_list wl;
+		/** The class constructor sets up the geometry of the
+		 * decomposition, choosing a grid of sub-boxes with one per
+		 * process.
+		 * \param[in] (ax_,bx_) the minimum and maximum x coordinates.
+		 * \param[in] (ay_,by_) the minimum and maximum y coordinates.
+		 * \param[in] (az_,bz_) the minimum and maximum z coordinates.
+		 * \param[in] comm_ the MPI communicator to use.
+		 * \param[in] poly whether to compute the radical
+		 *		   tessellation. */
+		domain_mpi(double ax_,double bx_,double ay_,double by_,double az_,double bz_,MPI_Comm comm_,bool poly=false)
+			: domain_decomp(ax_,bx_,ay_,by_,az_,bz_,grid(comm_,bx_-ax_,by_-ay_,bz_-az_,0),
+			  grid(comm_,bx_-ax_,by_-ay_,bz_-az_,1),grid(comm_,bx_-ax_,by_-ay_,bz_-az_,2)),
+			comm(comm_), rank(comm_rank(comm_)), ps(poly?4:3), gl(0) {}
+		/** Stores a particle. The particle can be stored on any
+		 * process, and is sent to its owner by the next call to
+		 * distribute(). For the radical tessellation, the particle is
+		 * given a radius of zero.
+		 * \param[in] n the numerical ID of the particle.
+		 * \param[in] (x,y,z) the position vector of the particle. */
+		inline void put(voro_id n,double x,double y,double z) {
+			nid.push_back(n);
+			np.push_back(x);np.push_back(y);np.push_back(z);
+			if(ps==4) np.push_back(0);
+		}
+		/** Stores a particle with a radius. The particle can be
+		 * stored on any process, and is sent to its owner by the
+		 * next call to distribute().
+		 * \param[in] n the numerical ID of the particle.
+		 * \param[in] (x,y,z) the position vector of the particle.
+		 * \param[in] r the radius of the particle. */
+		inline void put(voro_id n,double x,double y,double z,double r) {
+			nid.push_back(n);
+			np.push_back(x);np.push_back(y);np.push_back(z);
+			if(ps==4) np.push_back(r);
+		}
+		/** Adds a wall, which is applied to all of the local
+		 * containers.
+		 * \param[in] w a reference to the wall to add. */
+		inline void add_wall(wall &w) {wl.add_wall(w);}
+		/** Sends all of the particles that have been stored with put()
+		 * to the processes that own them. Particles outside the box
+		 * are discarded. */
+		void distribute() {
+			std::vector<voro_id> *sid=new std::vector<voro_id>[dxyz];
+			std::vector<double> *sp=new std::vector<double>[dxyz];
+			for(int l=0;l<(int) nid.size();l++) {
+				double *pp=&np[ps*l];
+				int r=owner(*pp,pp[1],pp[2]);
+				if(r>=0) append(sid[r],sp[r],nid[l],pp);
+			}
+			nid.clear();np.clear();
+			alltoall(sid,sp,id,p,true);
+		}
+		/** Exchanges the ghost particles with the other processes,
+		 * replacing any previous ghost particles.
+		 * \param[in] g the thickness of the ghost layer. */
+		void exchange(double g) {
+			std::vector<voro_id> *sid=new std::vector<voro_id>[dxyz];
+			std::vector<int> tg;
+			std::vector<double> *sp=new std::vector<double>[dxyz];
+			for(int l=0;l<(int) id.size();l++) {
+				double *pp=&p[ps*l];
+				tg.clear();
+				ghost_targets(rank,*pp,pp[1],pp[2],g,tg);
+				for(std::vector<int>::iterator it=tg.begin();it<tg.end();it++)
+					append(sid[*it],sp[*it],id[l],pp);
+			}
+			gid.clear();gp.clear();
+			alltoall(sid,sp,gid,gp,false);
+			gl=g;
+		}
+		/** Returns the total number of particles owned by all of the
+		 * processes.
+		 * \return The number of particles. */
+		inline long total_particles() {
+			long n=id.size(),tn;
+			MPI_Allreduce(&n,&tn,1,MPI_LONG,MPI_SUM,comm);
+			return tn;
+		}
+		/** Computes the Voronoi cells of all of the owned particles,
+		 * passing each one to a user-supplied class. Cells that turn
+		 * out to be too large for the ghost layer are recomputed with
+		 * a thicker one, so that each owned cell is passed exactly
+		 * once, with the same result as a single container.
+		 * \param[in] f a reference to a class with an operator
+		 *		() taking a voronoicell_neighbor reference, the
+		 *		particle ID, and the particle position, which is
+		 *		called for each owned cell.
+		 * \param[in] g the initial thickness of the ghost layer. If
+		 *		this is zero or less, it is set to three times
+		 *		the mean particle spacing.
+		 * \return The number of exchange rounds that were needed. */
+		template<class f_class>
+		int compute_all_cells(f_class &f,double g=0) {
+			if(g<=0) g=3*pow((bx-ax)*(by-ay)*(bz-az)/(total_particles()+1.),1/3.0);
+			double rmax=0,need,gneed,b[6];
+			if(ps==4) {
+				double mr=0;
+				for(int l=0;l<(int) id.size();l++) if(p[4*l+3]>mr) mr=p[4*l+3];
+				MPI_Allreduce(&mr,&rmax,1,MPI_DOUBLE,MPI_MAX,comm);
+			}
+			std::vector<int> todo(id.size()),fail;
+			for(int l=0;l<(int) id.size();l++) todo[l]=l;
+			int rounds=0;
+			while(true) {
+				if(g>max_layer()) g=max_layer();
+				exchange(g);
+				ghost_box(rank,g,*b,b[1],b[2],b[3],b[4],b[5]);
+				fail.clear();need=0;
+				if(ps==4) {
+					container_poly con(*b,b[1],b[2],b[3],b[4],b[5],gsize(b,0),
+						gsize(b,1),gsize(b,2),false,false,false,8);
+					compute_round(con,f,todo,fail,rmax,need);
+				} else {
+					container con(*b,b[1],b[2],b[3],b[4],b[5],gsize(b,0),
+						gsize(b,1),gsize(b,2),false,false,false,8);
+					compute_round(con,f,todo,fail,rmax,need);
+				}
+				rounds++;
+				MPI_Allreduce(&need,&gneed,1,MPI_DOUBLE,MPI_MAX,comm);
+				if(gneed<=0) break;
+				g=gneed*ghost_layer_growth;
+				todo.swap(fail);
+			}
+			return rounds;
+		}
+	private:
+		/** The IDs of particles waiting to be distributed. */
+		std::vector<voro_id> nid;
+		/** The positions of particles waiting to be distributed. */
+		std::vector<double> np;
+		/** Computes one component of the sub-box grid for a
+		 * communicator.
+		 * \param[in] c the communicator.
+		 * \param[in] (lx,ly,lz) the dimensions of the box.
+		 * \param[in] d the component to return.
+		 * \return The number of sub-boxes in that direction. */
+		static int grid(MPI_Comm c,double lx,double ly,double lz,int d) {
+			int n,g[3];
+			MPI_Comm_size(c,&n);
+			guess_grid(n,lx,ly,lz,*g,g[1],g[2]);
+			return g[d];
+		}
+		/** Returns the rank of this process in a communicator.
+		 * \param[in] c the communicator.
+		 * \return The rank. */
+		static int comm_rank(MPI_Comm c) {
+			int r;
+			MPI_Comm_rank(c,&r);
+			return r;
+		}
+		/** Appends a particle to a send buffer.
+		 * \param[in] vi the ID buffer.
+		 * \param[in] vp the position buffer.
+		 * \param[in] n the particle ID.
+		 * \param[in] pp a pointer to the particle's position. */
+		inline void append(std::vector<voro_id> &vi,std::vector<double> &vp,voro_id n,double *pp) {
+			vi.push_back(n);
+			for(int c=0;c<ps;c++) vp.push_back(pp[c]);
+		}
+		/** Sends particles to every other process, and collects the
+		 * particles sent from every process. The send buffers are
+		 * freed.
+		 * \param[in] sid an array of ID buffers, one per process.
+		 * \param[in] sp an array of position buffers, one per process.
+		 * \param[in] rid the vector to store the received IDs in.
+		 * \param[in] rp the vector to store the received positions in.
+		 * \param[in] app whether to append to the received vectors,
+		 *		  rather than replacing their contents. */
+		void alltoall(std::vector<voro_id> *sid,std::vector<double> *sp,std::vector<voro_id> &rid,std::vector<double> &rp,bool app) {
+			int *sc=new int[4*dxyz],*sd=sc+dxyz,*rc=sd+dxyz,*rd=rc+dxyz,r,st=0,rt=0;
+			for(r=0;r<dxyz;r++) {sc[r]=sid[r].size();sd[r]=st;st+=sc[r];}
+			MPI_Alltoall(sc,1,MPI_INT,rc,1,MPI_INT,comm);
+			for(r=0;r<dxyz;r++) {rd[r]=rt;rt+=rc[r];}
+			std::vector<voro_id> bi(st+1);std::vector<double> bp(ps*st+1);
+			for(r=0;r<dxyz;r++) if(sc[r]>0) {
+				std::copy(sid[r].begin(),sid[r].end(),bi.begin()+sd[r]);
+				std::copy(sp[r].begin(),sp[r].end(),bp.begin()+ps*sd[r]);
+			}
+			delete [] sid;delete [] sp;
+			int o=app?rid.size():0;
+			rid.resize(o+rt+1);rp.resize(ps*(o+rt)+1);
+			MPI_Alltoallv(&bi[0],sc,sd,VOROPP_MPI_ID,&rid[o],rc,rd,VOROPP_MPI_ID,comm);
+			for(r=0;r<dxyz;r++) {sc[r]*=ps;sd[r]*=ps;rc[r]*=ps;rd[r]*=ps;}
+			MPI_Alltoallv(&bp[0],sc,sd,MPI_DOUBLE,&rp[ps*o],rc,rd,MPI_DOUBLE,comm);
+			rid.resize(o+rt);rp.resize(ps*(o+rt));
+			delete [] sc;
+		}
+		/** Computes the number of blocks for the local container in
+		 * one direction, aiming for the optimal number of particles
+		 * per block.
+		 * \param[in] b the bounds of the local container.
+		 * \param[in] d the direction.
+		 * \return The number of blocks. */
+		inline int gsize(double *b,int d) {
+			double lx=b[1]-*b,ly=b[3]-b[2],lz=b[5]-b[4],
+			       ilscale=pow((id.size()+gid.size())/(optimal_particles*lx*ly*lz),1/3.0);
+			return int((d==0?lx:(d==1?ly:lz))*ilscale+1);
+		}
+		/** Stores a particle in a local container. */
+		inline void put_particle(container &con,particle_order *vo,voro_id n,double *pp) {
+			if(vo==NULL) con.put(n,*pp,pp[1],pp[2]);
+			else con.put(*vo,n,*pp,pp[1],pp[2]);
+		}
+		/** Stores a particle in a local container_poly. */
+		inline void put_particle(container_poly &con,particle_order *vo,voro_id n,double *pp) {
+			if(vo==NULL) con.put(n,*pp,pp[1],pp[2],pp[3]);
+			else con.put(*vo,n,*pp,pp[1],pp[2],pp[3]);
+		}
+		/** Computes the required ghost layer for a regular cell. */
+		inline double required(container &con,voronoicell_base &c,int l,double rmax) {
+			double *pp=&p[3*l];
+			return required_layer(rank,c,*pp,pp[1],pp[2]);
+		}
+		/** Computes the required ghost layer for a radical cell. */
+		inline double required(container_poly &con,voronoicell_base &c,int l,double rmax) {
+			double *pp=&p[4*l];
+			return required_layer(rank,c,*pp,pp[1],pp[2],pp[3],rmax);
+		}
+		/** Carries out one round of computation in a local container.
+		 * \param[in] con the local container, which must be empty.
+		 * \param[in] f the class to pass the exact cells to.
+		 * \param[in] todo the indices of the owned particles to
+		 *		   compute.
+		 * \param[out] fail the indices of the particles whose cells
+		 *		    need a thicker ghost layer.
+		 * \param[in] rmax the maximum particle radius.
+		 * \param[out] need the ghost layer thickness required by the
+		 *		    failed cells. */
+		template<class c_class,class f_class>
+		void compute_round(c_class &con,f_class &f,std::vector<int> &todo,std::vector<int> &fail,double rmax,double &need) {
+			std::vector<bool> mark(id.size(),false);
+			particle_order vo;
+			int l,t=0,nt=todo.size();
+			con.add_wall(wl);
+			for(l=0;l<nt;l++) {
+				mark[todo[l]]=true;
+				put_particle(con,&vo,id[todo[l]],&p[ps*todo[l]]);
+			}
+			for(l=0;l<(int) id.size();l++) if(!mark[l]) put_particle(con,NULL,id[l],&p[ps*l]);
+			for(l=0;l<(int) gid.size();l++) put_particle(con,NULL,gid[l],&gp[ps*l]);
+			voronoicell_neighbor c;
+			c_loop_order cl(con,vo);
+			double x,y,z,rq;
+			if(cl.start()) do {
+				while(t<nt&&id[todo[t]]!=cl.pid()) t++;
+				if(t==nt) break;
+				l=todo[t++];
+				if(con.compute_cell(c,cl)) {
+					rq=required(con,c,l,rmax);
+					if(rq>gl&&gl<max_layer()) {
+						fail.push_back(l);
+						if(rq>need) need=rq;
+					} else {
+						cl.pos(x,y,z);
+						f(c,id[l],x,y,z);
+					}
+				}
+			} while(cl.inc());
+		}
+};
+
+}
+
+#endif
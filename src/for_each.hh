@@ -0,0 +1,216 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file for_each.hh
+ * \brief Header file for the for_each_cell routines, which compute the
+ * Voronoi cells of a container and pass each one to a function object. */
+
+#ifndef VOROPP_FOR_EACH_HH
+#define VOROPP_FOR_EACH_HH
+
+#include "config.hh"
+#include "common.hh"
+#include "c_loops.hh"
+#include "v_compute.hh"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace voro {
+
+/** \brief An execution policy for computing the cells of a container in a
+ * single thread.
+ *
+ * The cells are visited in the order of the blocks of the container, which is
+ * the same as for the c_loop_all class. */
+class exec_serial {};
+
+/** \brief An execution policy for computing the cells of a container with
+ * several threads.
+ *
+ * The blocks of the container are shared out among the threads by a
+ * block_scheduler, and each thread has its own Voronoi cell and voro_compute
+ * class. The function object is shared between the threads, so it must be
+ * safe to call from several threads at once, for example by writing only to
+ * per-particle storage or by using omp_get_thread_num() to select per-thread
+ * storage. The cells are visited in an unpredictable order. */
+class exec_parallel {
+	public:
+		/** The number of threads to use, or zero to use the OpenMP
+		 * default. */
+		const int nt;
+		/** Sets up the policy.
+		 * \param[in] nt_ the number of threads to use. */
+		explicit exec_parallel(int nt_=0) : nt(nt_) {}
+};
+
+/** Computes the Voronoi cells of the particles in a loop, and passes each one
+ * to a function object. Cells that are removed completely, for example by
+ * walls, are skipped. A single Voronoi cell is reused for all of the
+ * particles. The function object is called as f(c,id,x,y,z), where c is a
+ * reference to the Voronoi cell, id is the particle ID, and (x,y,z) is the
+ * particle position, and since it is a template parameter the call can be
+ * inlined.
+ * \tparam v_cell the Voronoi cell class to use, which must be given
+ *		  explicitly.
+ * \param[in] con the container to use.
+ * \param[in] vl the loop class to use.
+ * \param[in] f the function object to call. */
+template<class v_cell,class c_class,class c_loop,class functor>
+void for_each_cell(c_class &con,c_loop &vl,functor &f) {
+	v_cell c(con);
+	double x,y,z;
+	if(vl.start()) do if(con.compute_cell(c,vl)) {
+		vl.pos(x,y,z);
+		f(c,vl.pid(),x,y,z);
+	} while(vl.inc());
+}
+
+/** Computes the Voronoi cells of the particles in the chunks of blocks that a
+ * block scheduler hands out to one thread, and passes each one to a function
+ * object. This is used by the parallel for_each_cell() routine.
+ * \param[in] con the container to use.
+ * \param[in] bs the block scheduler to use.
+ * \param[in] t the thread number.
+ * \param[in] f the function object to call. */
+template<class v_cell,class c_class,class functor>
+void for_each_cell_thread(c_class &con,block_scheduler &bs,int t,functor &f) {
+	v_cell c(con);
+	c_loop_parallel vl(con,bs,t);
+	double x,y,z;
+	voro_compute<c_class> *vcl=con.new_compute();
+	if(vl.start()) do if(con.compute_cell(c,vl,*vcl)) {
+		vl.pos(x,y,z);
+		f(c,vl.pid(),x,y,z);
+	} while(vl.inc());
+	delete vcl;
+}
+
+/** Computes the Voronoi cells of all of the particles in a container in a
+ * single thread, and passes each one to a function object, as described for
+ * the loop version of this routine.
+ * \tparam v_cell the Voronoi cell class to use, which must be given
+ *		  explicitly.
+ * \param[in] con the container to use, which can be any of the standard or
+ *		  periodic container classes.
+ * \param[in] f the function object to call. */
+template<class v_cell,class c_class,class functor>
+void for_each_cell(c_class &con,functor &f,exec_serial ep=exec_serial()) {
+	block_scheduler bs(con,1);
+	c_loop_parallel vl(con,bs,0);
+	for_each_cell<v_cell>(con,vl,f);
+}
+
+/** Computes the Voronoi cells of all of the particles in a container with
+ * several threads, and passes each one to a function object, as described for
+ * the loop version of this routine.
+ * \tparam v_cell the Voronoi cell class to use, which must be given
+ *		  explicitly.
+ * \param[in] con the container to use, which can be any of the standard or
+ *		  periodic container classes.
+ * \param[in] f the function object to call, which must be safe to call from
+ *		several threads at once.
+ * \param[in] ep the execution policy, giving the number of threads. */
+template<class v_cell,class c_class,class functor>
+void for_each_cell(c_class &con,functor &f,exec_parallel ep) {
+	int nt=voro_threads(ep.nt);
+	block_scheduler bs(con,nt);
+#ifdef _OPENMP
+	if(nt>1) {
+#pragma omp parallel num_threads(nt) VOROPP_BIND
+		for_each_cell_thread<v_cell>(con,bs,omp_get_thread_num(),f);
+		return;
+	}
+#endif
+	for_each_cell_thread<v_cell>(con,bs,0,f);
+}
+
+/** Computes the Voronoi cells of the particles in the chunks of blocks of a
+ * subset loop that a block scheduler hands out to one thread, and passes each
+ * one to a function object. This is used by the parallel subset version of
+ * for_each_cell().
+ * \param[in] con the container to use.
+ * \param[in] vs the subset loop to copy.
+ * \param[in] bs the block scheduler to use.
+ * \param[in] t the thread number.
+ * \param[in] f the function object to call. */
+template<class v_cell,class c_class,class c_loop_sub,class functor>
+void for_each_cell_subset_thread(c_class &con,c_loop_sub &vs,block_scheduler &bs,int t,functor &f) {
+	v_cell c(con);
+	c_loop_subset_parallel<c_loop_sub> vl(vs,bs,t);
+	double x,y,z;
+	voro_compute<c_class> *vcl=con.new_compute();
+	if(vl.start()) do if(con.compute_cell(c,vl,*vcl)) {
+		vl.pos(x,y,z);
+		f(c,vl.pid(),x,y,z);
+	} while(vl.inc());
+	delete vcl;
+}
+
+/** Computes the Voronoi cells of the particles in a subset loop with several
+ * threads, and passes each one to a function object, as described for the
+ * serial loop version of this routine. The blocks that the loop visits are
+ * shared out by a block_scheduler. For the periodic containers, the image
+ * blocks are constructed by the threads as the cells need them, so only those
+ * near the region are made.
+ * \tparam v_cell the Voronoi cell class to use, which must be given
+ *		  explicitly.
+ * \param[in] con the container to use.
+ * \param[in] vl the subset loop to use, which must have been set up. This can
+ *		 be a c_loop_subset class for the container and container_poly
+ *		 classes, or a c_loop_subset_periodic class for the periodic
+ *		 container classes.
+ * \param[in] f the function object to call, which must be safe to call from
+ *		several threads at once.
+ * \param[in] ep the execution policy, giving the number of threads. */
+template<class v_cell,class c_class,class c_loop_sub,class functor>
+void for_each_cell(c_class &con,c_loop_sub &vl,functor &f,exec_parallel ep) {
+	int nt=voro_threads(ep.nt);
+	block_scheduler bs(vl,nt);
+#ifdef _OPENMP
+	if(nt>1) {
+#pragma omp parallel num_threads(nt) VOROPP_BIND
+		for_each_cell_subset_thread<v_cell>(con,vl,bs,omp_get_thread_num(),f);
+		return;
+	}
+#endif
+	for_each_cell_subset_thread<v_cell>(con,vl,bs,0,f);
+}
+
+/** Computes only the Voronoi cells that reach a wall or a non-periodic face of
+ * a container, and passes each one to a function object, as described for the
+ * loop version of for_each_cell(). The blocks near the boundary are found by
+ * a boundary_blocks class, and the search only moves further into the
+ * container from blocks where some cell turned out to reach a wall, so for a
+ * large system only a thin layer of cells is computed. The cells are tracked
+ * with neighbor information, since the faces made by the walls are recognized
+ * by their negative IDs.
+ * \param[in] con the container to use, which can be the container or
+ *		  container_poly class.
+ * \param[in] f the function object to call, which is passed a
+ *		voronoicell_neighbor class. */
+template<class c_class,class functor>
+void for_each_boundary_cell(c_class &con,functor &f) {
+	voronoicell_neighbor c(con);
+	boundary_blocks bb(con);
+	int ijk,q;
+	bool ex;
+	fpoint *pp;
+	while(bb.next(ijk)) {
+		ex=con.co[ijk]==0;
+		for(q=0;q<con.co[ijk];q++) if(con.compute_cell(c,ijk,q)&&c.reaches_wall()) {
+			pp=con.p[ijk]+con.ps*q;
+			f(c,con.id[ijk][q],*pp,pp[1],pp[2]);
+			ex=true;
+		}
+		if(ex) bb.expand(ijk);
+	}
+}
+
+}
+
+#endif
@@ -0,0 +1,140 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file format.cc
+ * \brief Function implementations for the compiled_format class. */
+
+#include "format.hh"
+#include "common.hh"
+#include "trace.hh"
+
+namespace voro {
+
+/** The newline that is printed at the end of each cell's information. */
+static const char nl[]="\n";
+
+/** The class constructor parses a custom output string into a list of
+ * operations, and works out which quantities need to be computed for each
+ * cell.
+ * \param[in] format the custom output string to use, which has the same
+ *		     syntax as for voronoicell_base::output_custom(). */
+compiled_format::compiled_format(const char *format) : qmask(0), fo(false),
+	fa(false), fp_(false), fn(false), fv(false), fl(false), qr(0) {
+	const char *fmp=format,*ls=format;
+	while(*fmp!=0) {
+		if(*fmp=='%') {
+			add_literal(ls,fmp);
+			fmp++;
+			switch(*fmp) {
+				case 'v': qmask|=query_volume;break;
+				case 'c': case 'C': qmask|=query_centroid;break;
+				case 'F': qmask|=query_surface_area;break;
+				case 's': qmask|=query_faces;break;
+				case 'a': case 'A': fo=true;break;
+				case 'f': fa=true;break;
+				case 'e': fp_=true;break;
+				case 't': fv=true;break;
+				case 'l': fl=true;break;
+				case 'n': fn=true;
+			}
+
+			// A percent sign at the end of the string is
+			// ignored, in the same way as output_custom()
+			if(*fmp==0) {ls=fmp;break;}
+			op.push_back(*fmp);
+			ls=++fmp;
+		} else fmp++;
+	}
+	add_literal(ls,fmp);
+	add_literal(nl,nl+1);
+	qr.mask=qmask;
+}
+
+/** Adds a piece of literal text to the list of operations, merging it with
+ * the previous piece if they are adjacent.
+ * \param[in] (s,e) pointers to the start and end of the text. */
+void compiled_format::add_literal(const char *s,const char *e) {
+	if(s==e) return;
+	int n=op.size();
+	if(n>=3&&op[n-3]==0&&op[n-2]+op[n-1]==int(lit.size())) op[n-1]+=e-s;
+	else {op.push_back(0);op.push_back(lit.size());op.push_back(e-s);}
+	lit.insert(lit.end(),s,e);
+}
+
+/** Prints information about a Voronoi cell, using the parsed format string.
+ * \param[in] c a reference to the Voronoi cell.
+ * \param[in] i the ID of the particle associated with this Voronoi cell.
+ * \param[in] (x,y,z) the position of the particle associated with this Voronoi
+ *                    cell.
+ * \param[in] r a radius associated with the particle.
+ * \param[in] fp the file handle to write to. */
+template<class v_cell>
+void compiled_format::write(v_cell &c,voro_id i,double x,double y,double z,double r,FILE *fp) {
+	trace_scope ts("output");
+	if(qmask!=0) c.evaluate(qr);
+	if(fo||fa||fp_||fn||fv||fl) c.face_data(fo?&vo:NULL,fa?&va:NULL,fp_?&vp:NULL,fn?&vn:NULL,fv?&vf:NULL,fl?&vl:NULL);
+	std::vector<int>::iterator it=op.begin();
+	text_writer tw(fp);
+	while(it!=op.end()) {
+		switch(*it) {
+
+			// Literal text
+			case 0: tw.put(&lit[it[1]],it[2]);it+=2;break;
+
+			// Particle-related output
+			case 'i': tw.put(i);break;
+			case 'x': tw.put(x);break;
+			case 'y': tw.put(y);break;
+			case 'z': tw.put(z);break;
+			case 'q': tw.put3(x,y,z,' ');break;
+			case 'r': tw.put(r);break;
+
+			// Vertex-related output
+			case 'w': tw.put(c.p);break;
+			case 'p': c.output_vertices(tw);break;
+			case 'P': c.output_vertices(x,y,z,tw);break;
+			case 'o': c.output_vertex_orders(tw);break;
+			case 'm': tw.put(0.25*c.max_radius_squared());break;
+
+			// Edge-related output
+			case 'g': tw.put(c.number_of_edges());break;
+			case 'E': tw.put(c.total_edge_distance());break;
+			case 'e': voro_print_vector(vp,tw);break;
+
+			// Face-related output
+			case 's': tw.put(qr.faces);break;
+			case 'F': tw.put(qr.area);break;
+			case 'A': {
+					  vi.clear();
+					  for(std::vector<int>::iterator o=vo.begin();o!=vo.end();o++) {
+						  if((unsigned int) *o>=vi.size()) vi.resize(*o+1,0);
+						  vi[*o]++;
+					  }
+					  voro_print_vector(vi,tw);
+				  } break;
+			case 'a': voro_print_vector(vo,tw);break;
+			case 'f': voro_print_vector(va,tw);break;
+			case 't': voro_print_face_vertices(vf,tw);break;
+			case 'l': voro_print_positions(vl,tw);break;
+			case 'n': voro_print_vector(vn,tw);break;
+
+			// Volume-related output
+			case 'v': tw.put(qr.volume);break;
+			case 'c': tw.put3(qr.cx,qr.cy,qr.cz,' ');break;
+			case 'C': tw.put3(x+qr.cx,y+qr.cy,z+qr.cz,' ');break;
+
+			// The percent sign is not part of a control sequence
+			default: tw.put('%');tw.put(char(*it));
+		}
+		it++;
+	}
+}
+
+// Explicit instantiation
+template void compiled_format::write(voronoicell&,voro_id,double,double,double,double,FILE*);
+template void compiled_format::write(voronoicell_neighbor&,voro_id,double,double,double,double,FILE*);
+
+}
@@ -0,0 +1,89 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file format.hh
+ * \brief Header file for the compiled_format class. */
+
+#ifndef VOROPP_FORMAT_HH
+#define VOROPP_FORMAT_HH
+
+#include <cstdio>
+#include <vector>
+
+#include "config.hh"
+#include "cell.hh"
+
+namespace voro {
+
+/** \brief A class for printing custom information about Voronoi cells using a
+ * format string that has been parsed in advance.
+ *
+ * The voronoicell_base::output_custom() routine scans the format string for
+ * every cell, and computes each quantity with a separate traversal of the
+ * cell, so that a string such as "%v %c %F" visits the faces three times. This
+ * class parses the format string once into a list of operations. It also
+ * works out which quantities are needed, so that the volume, centroid, surface
+ * area, and number of faces can be computed together by
+ * voronoicell_base::evaluate(), and the face orders, areas, perimeters,
+ * neighbors, vertices, and normals can be computed together by
+ * voronoicell_base::face_data(). The
+ * output is identical to that of output_custom(). */
+class compiled_format {
+	public:
+		compiled_format(const char *format);
+		/** Returns whether the format string contains any requests for
+		 * neighbor information, and therefore needs a
+		 * voronoicell_neighbor class.
+		 * \return True if neighbor information is needed, false
+		 *         otherwise. */
+		inline bool neighbor() {return fn;}
+		template<class v_cell>
+		void write(v_cell &c,voro_id i,double x,double y,double z,double r,FILE *fp=stdout);
+	private:
+		/** The list of operations. Each entry is either the character
+		 * of a control sequence, or zero for a piece of literal text,
+		 * in which case the next two entries hold the start and length
+		 * of the text. */
+		std::vector<int> op;
+		/** A copy of the literal text of the format string. */
+		std::vector<char> lit;
+		/** The combination of cell_query_flags that are computed by a
+		 * single call to voronoicell_base::evaluate(). */
+		unsigned int qmask;
+		/** Whether the face orders are needed. */
+		bool fo;
+		/** Whether the face areas are needed. */
+		bool fa;
+		/** Whether the face perimeters are needed. */
+		bool fp_;
+		/** Whether the neighbor IDs are needed. */
+		bool fn;
+		/** Whether the face vertices are needed. */
+		bool fv;
+		/** Whether the face normals are needed. */
+		bool fl;
+		/** The query used to compute the combined quantities. */
+		cell_query qr;
+		/** Temporary storage for the face orders. */
+		std::vector<int> vo;
+		/** Temporary storage for the neighbor IDs. */
+		std::vector<voro_id> vn;
+		/** Temporary storage for the face areas. */
+		std::vector<double> va;
+		/** Temporary storage for the face perimeters. */
+		std::vector<double> vp;
+		/** Temporary storage for the face vertices. */
+		std::vector<int> vf;
+		/** Temporary storage for the face normals. */
+		std::vector<double> vl;
+		/** Temporary integer storage for the other quantities. */
+		std::vector<int> vi;
+		void add_literal(const char *s,const char *e);
+};
+
+}
+
+#endif
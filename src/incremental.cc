@@ -0,0 +1,155 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file incremental.cc
+ * \brief Function implementations for the incremental_voronoi class. */
+
+#include "incremental.hh"
+#include "c_loops.hh"
+
+namespace voro {
+
+/** The class constructor records where each particle in the container is
+ * stored, and computes the neighbor lists of all of the Voronoi cells. Since
+ * the particle IDs index the internal arrays, a fatal error is caused if any
+ * of them are negative.
+ * \param[in] con_ a reference to the container to use. */
+incremental_voronoi::incremental_voronoi(container &con_) : con(con_), c(con_) {
+	int ijk,q;
+	for(ijk=0;ijk<con.nxyz;ijk++) for(q=0;q<con.co[ijk];q++) {
+		voro_id n=con.id[ijk][q];
+		if(n<0) voro_fatal_error("Negative particle ID in incremental Voronoi computation",VOROPP_INTERNAL_ERROR);
+		grow(n);
+		loc[2*n]=ijk;loc[2*n+1]=q;
+	}
+	c_loop_all vl(con);
+	if(vl.start()) do {
+		if(con.compute_cell(c,vl)) c.neighbors(nb[vl.pid()]);
+	} while(vl.inc());
+}
+
+/** Inserts a new particle, and recomputes the cells that it affects.
+ * \param[in] n the ID of the particle.
+ * \param[in] (x,y,z) the position of the particle.
+ * \param[out] changed a vector in which to store the IDs of all the particles
+ *		       whose Voronoi cells changed, including the new one.
+ * \return True if the particle was inserted, false if the ID is negative, if
+ *         a particle with the same ID is already stored, or if the position
+ *         is outside the container. */
+bool incremental_voronoi::insert(voro_id n,double x,double y,double z,std::vector<voro_id> &changed) {
+	changed.clear();
+	if(n<0||contains(n)||!put_in(n,x,y,z)) return false;
+	recompute(n);
+	changed.push_back(n);
+	add_changed(nb[n],changed);
+	for(unsigned int i=1;i<changed.size();i++) recompute(changed[i]);
+	return true;
+}
+
+/** Removes a particle, and recomputes the cells of its former neighbors.
+ * \param[in] n the ID of the particle.
+ * \param[out] changed a vector in which to store the IDs of all the particles
+ *		       whose Voronoi cells changed.
+ * \return True if the particle was removed, false if it is not stored. */
+bool incremental_voronoi::remove(voro_id n,std::vector<voro_id> &changed) {
+	changed.clear();
+	if(!contains(n)) return false;
+	changed.push_back(n);
+	add_changed(nb[n],changed);
+	changed.erase(changed.begin());
+	take_out(n);
+	for(unsigned int i=0;i<changed.size();i++) recompute(changed[i]);
+	return true;
+}
+
+/** Moves a particle to a new position, and recomputes the cells that are
+ * affected by it having been taken from its old position and put into its
+ * new one.
+ * \param[in] n the ID of the particle.
+ * \param[in] (x,y,z) the new position of the particle.
+ * \param[out] changed a vector in which to store the IDs of all the particles
+ *		       whose Voronoi cells changed, including the moved one.
+ * \return True if the particle was moved. False if it is not stored, or if
+ *         the new position is outside the container, in which case the
+ *         particle is removed. */
+bool incremental_voronoi::move(voro_id n,double x,double y,double z,std::vector<voro_id> &changed) {
+	changed.clear();
+	if(!contains(n)) return false;
+	changed.push_back(n);
+	add_changed(nb[n],changed);
+	take_out(n);
+	bool moved=put_in(n,x,y,z);
+	if(moved) {
+		recompute(n);
+		add_changed(nb[n],changed);
+	}
+	for(unsigned int i=1;i<changed.size();i++) recompute(changed[i]);
+	return moved;
+}
+
+/** Computes the full Voronoi cell of a particle.
+ * \param[out] c_ a Voronoi cell class in which to store the computed cell.
+ * \param[in] n the ID of the particle.
+ * \return True if the cell was computed, false if the particle is not stored
+ *         or its cell was removed entirely by walls. */
+bool incremental_voronoi::compute_cell(voronoicell_neighbor &c_,voro_id n) {
+	return contains(n)&&con.compute_cell(c_,loc[2*n],loc[2*n+1]);
+}
+
+/** Extends the internal arrays so that they can hold a given particle ID.
+ * \param[in] n the ID of the particle. */
+void incremental_voronoi::grow(voro_id n) {
+	if(n>=voro_id(nb.size())) {
+		loc.resize(2*(n+1),-1);
+		nb.resize(n+1);
+	}
+}
+
+/** Recomputes the Voronoi cell of a particle, and stores its neighbor list.
+ * \param[in] n the ID of the particle. */
+void incremental_voronoi::recompute(voro_id n) {
+	if(con.compute_cell(c,loc[2*n],loc[2*n+1])) c.neighbors(nb[n]);
+	else nb[n].clear();
+}
+
+/** Takes a particle out of the container, updating the stored location of
+ * the particle that is moved into its place.
+ * \param[in] n the ID of the particle. */
+void incremental_voronoi::take_out(voro_id n) {
+	int ijk=loc[2*n],q=loc[2*n+1];
+	con.remove_particle(ijk,q);
+	if(q<con.co[ijk]) loc[2*con.id[ijk][q]+1]=q;
+	loc[2*n]=loc[2*n+1]=-1;
+	nb[n].clear();
+}
+
+/** Puts a particle into the container and records where it was stored.
+ * \param[in] n the ID of the particle.
+ * \param[in] (x,y,z) the position of the particle.
+ * \return True if the particle was stored, false if the position is outside
+ *         the container. */
+bool incremental_voronoi::put_in(voro_id n,double x,double y,double z) {
+	grow(n);
+	if(con.put(n,x,y,z,loc[2*n],loc[2*n+1])) return true;
+	loc[2*n]=loc[2*n+1]=-1;
+	return false;
+}
+
+/** Appends the non-negative entries of a neighbor list to a list of changed
+ * particles, skipping any that are already on it.
+ * \param[in] v the neighbor list.
+ * \param[in,out] changed the list of changed particles. */
+void incremental_voronoi::add_changed(std::vector<voro_id> &v,std::vector<voro_id> &changed) {
+	for(unsigned int i=0;i<v.size();i++) {
+		voro_id m=v[i];
+		if(m<0) continue;
+		unsigned int j=0;
+		while(j<changed.size()&&changed[j]!=m) j++;
+		if(j==changed.size()) changed.push_back(m);
+	}
+}
+
+}
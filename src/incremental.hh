@@ -0,0 +1,77 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file incremental.hh
+ * \brief Header file for the incremental_voronoi class. */
+
+#ifndef VOROPP_INCREMENTAL_HH
+#define VOROPP_INCREMENTAL_HH
+
+#include <vector>
+
+#include "config.hh"
+#include "cell.hh"
+#include "container.hh"
+
+namespace voro {
+
+/** \brief A class for keeping a Voronoi tessellation up to date as particles
+ * are inserted, removed, and moved.
+ *
+ * This class is bound to a container, and it stores the neighbor list of the
+ * Voronoi cell of every particle. When a particle is inserted, the only cells
+ * that change are those that neighbor the new cell. When a particle is
+ * removed, the only cells that change are its former neighbors. The class
+ * therefore only recomputes these cells, so that the cost of each update is
+ * independent of the total number of particles. The particle IDs are used to
+ * index the internal arrays, so they must be non-negative, and should be
+ * reasonably compact. Negative IDs cause a fatal error if they are already in
+ * the container, and are rejected by insert(). Once the class has been created, particles should only be added to
+ * or removed from the container using the routines in this class. */
+class incremental_voronoi {
+	public:
+		/** A reference to the container that holds the particles. */
+		container &con;
+		incremental_voronoi(container &con_);
+		bool insert(voro_id n,double x,double y,double z,std::vector<voro_id> &changed);
+		bool remove(voro_id n,std::vector<voro_id> &changed);
+		bool move(voro_id n,double x,double y,double z,std::vector<voro_id> &changed);
+		bool compute_cell(voronoicell_neighbor &c_,voro_id n);
+		/** Returns whether a particle is currently stored in the
+		 * container.
+		 * \param[in] n the ID of the particle.
+		 * \return True if it is stored, false otherwise. */
+		inline bool contains(voro_id n) {
+			return n>=0&&n<voro_id(nb.size())&&loc[2*n]>=0;
+		}
+		/** Returns the neighbor list of the Voronoi cell of a particle,
+		 * with one entry per face. Negative entries refer to walls.
+		 * The list is empty if the particle is not stored or if its
+		 * cell was removed entirely by walls. Since the order of the
+		 * particles within each block changes during updates, the
+		 * faces may be listed in a different order to a fresh
+		 * computation.
+		 * \param[in] n the ID of the particle.
+		 * \return A reference to the list. */
+		inline std::vector<voro_id>& neighbors(voro_id n) {return nb[n];}
+	private:
+		/** The block and the index within the block of each particle,
+		 * in pairs, or -1 if there is no particle with that ID. */
+		std::vector<int> loc;
+		/** The neighbor list of each particle's Voronoi cell. */
+		std::vector<std::vector<voro_id> > nb;
+		/** A Voronoi cell used to recompute the changed cells. */
+		voronoicell_neighbor c;
+		void grow(voro_id n);
+		void recompute(voro_id n);
+		void take_out(voro_id n);
+		bool put_in(voro_id n,double x,double y,double z);
+		void add_changed(std::vector<voro_id> &v,std::vector<voro_id> &changed);
+};
+
+}
+
+#endif
@@ -0,0 +1,175 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file lloyd.hh
+ * \brief Header file for the lloyd_relax class. */
+
+#ifndef VOROPP_LLOYD_HH
+#define VOROPP_LLOYD_HH
+
+#include <vector>
+
+#include "config.hh"
+#include "common.hh"
+#include "cell.hh"
+#include "container.hh"
+
+namespace voro {
+
+/** \brief A class for carrying out Lloyd's algorithm, to relax the particles in
+ * a container towards a centroidal Voronoi tessellation.
+ *
+ * Each iteration computes the Voronoi cell of every particle and moves the
+ * particle to the centroid of its cell. The particles are moved within the
+ * container using container_base::move_particle(), so that the blocks keep
+ * their memory between iterations. The cells can be computed by several
+ * threads, which share out the blocks of the container using a
+ * block_scheduler. The neighbors of each cell are stored, and since they
+ * change very little from one iteration to the next, each cell is first cut
+ * by the planes of its previous neighbors, so that it is close to its final
+ * size when the usual block search begins. The particle IDs are used to index
+ * the internal arrays, so they should be non-negative and reasonably compact.
+ * \tparam c_class the type of the container, which can be the container or
+ *		   container_poly classes. */
+template<class c_class>
+class lloyd_relax {
+	public:
+		/** A reference to the container that holds the particles. */
+		c_class &con;
+		/** The number of iterations that have been carried out. */
+		int iterations;
+		/** The largest distance that a particle moved in the last
+		 * iteration. */
+		double max_move;
+		/** Initializes the class for a container.
+		 * \param[in] con_ a reference to the container. */
+		lloyd_relax(c_class &con_) : con(con_), iterations(0), max_move(0) {}
+		/** Removes the stored neighbor lists, which should be done if
+		 * particles are added to or removed from the container. */
+		inline void reset() {nb.clear();}
+		/** Carries out one iteration of Lloyd's algorithm. A particle
+		 * whose cell is removed entirely by a wall is not moved.
+		 * \param[in] nt the number of threads to use.
+		 * \return The largest distance that a particle moved. */
+		double step(int nt=1) {
+			int ijk,q;
+			voro_id i,n=0;
+			double mm=0;
+
+			// Find the largest ID and record where each particle
+			// is stored
+			for(ijk=0;ijk<con.nxyz;ijk++) for(q=0;q<con.co[ijk];q++)
+				if(con.id[ijk][q]>=n) n=con.id[ijk][q]+1;
+			loc.assign(2*n,-1);
+			for(ijk=0;ijk<con.nxyz;ijk++) for(q=0;q<con.co[ijk];q++) {
+				i=con.id[ijk][q];
+				if(i>=0) {loc[2*i]=ijk;loc[2*i+1]=q;}
+			}
+			if(voro_id(nb.size())<n) nb.resize(n);
+			np.resize(3*n);
+			ok.assign(n,0);
+
+			// Compute the cells and their centroids
+			nt=voro_threads(nt);
+			block_scheduler bs(con,nt);
+#ifdef _OPENMP
+			if(nt>1) {
+#pragma omp parallel num_threads(nt) VOROPP_BIND
+				{
+					double tm=compute_thread(bs,omp_get_thread_num(),con.new_compute());
+#pragma omp critical
+					{
+						if(tm>mm) mm=tm;
+					}
+				}
+			} else mm=compute_thread(bs,0,con.new_compute());
+#else
+			mm=compute_thread(bs,0,con.new_compute());
+#endif
+
+			// Move the particles to the centroids. The blocks are
+			// scanned in reverse order of the particles, so that
+			// each particle that moves into the vacated position
+			// has already been considered.
+			for(ijk=0;ijk<con.nxyz;ijk++) for(q=con.co[ijk]-1;q>=0;q--) {
+				i=con.id[ijk][q];
+				if(i>=0&&ok[i]) con.move_particle(ijk,q,np[3*i],np[3*i+1],np[3*i+2]);
+			}
+			iterations++;
+			return max_move=sqrt(mm);
+		}
+		/** Carries out iterations of Lloyd's algorithm until the
+		 * particles stop moving.
+		 * \param[in] tol the distance below which the largest particle
+		 *		  move is taken to have converged.
+		 * \param[in] max_iter the maximum number of iterations.
+		 * \param[in] nt the number of threads to use.
+		 * \return True if the relaxation converged, false if the
+		 *	   maximum number of iterations was reached first. */
+		bool relax(double tol,int max_iter,int nt=1) {
+			for(int l=0;l<max_iter;l++) if(step(nt)<tol) return true;
+			return false;
+		}
+	private:
+		/** The block and the index within the block of each particle,
+		 * in pairs, or -1 if there is no particle with that ID. */
+		std::vector<int> loc;
+		/** The neighbor list of each particle's cell in the last
+		 * iteration. */
+		std::vector<std::vector<voro_id> > nb;
+		/** The new positions of the particles, in groups of three. */
+		std::vector<double> np;
+		/** Flags recording which particles have a new position. */
+		std::vector<char> ok;
+		/** Computes the cells in the chunks of blocks that a block
+		 * scheduler hands out to one thread, storing the centroids
+		 * and the neighbor lists.
+		 * \param[in] bs the block scheduler to use.
+		 * \param[in] t the thread number.
+		 * \param[in] vcl a pointer to a voro_compute class for the
+		 *		  container, which is deleted at the end.
+		 * \return The largest squared distance that a particle is
+		 *	   moved by. */
+		template<class vc_class>
+		double compute_thread(block_scheduler &bs,int t,vc_class *vcl) {
+			voronoicell_neighbor c(con);
+			c_loop_parallel vl(con,bs,t);
+			std::vector<int> sl;
+			double x,y,z,dx,dy,dz,mm=0;
+			voro_id i,m;
+			bool b;
+			if(vl.start()) do {
+				i=vl.pid();
+				if(i<0) continue;
+
+				// Cut the cell by its previous neighbors first,
+				// skipping walls and the particle itself
+				std::vector<voro_id> &v=nb[i];
+				sl.clear();
+				for(unsigned int k=0;k<v.size();k++) {
+					m=v[k];
+					if(m<0||m==i||2*m>=voro_id(loc.size())||loc[2*m]<0) continue;
+					sl.push_back(loc[2*m]);sl.push_back(loc[2*m+1]);
+				}
+				b=sl.empty()?vcl->compute_cell(c,vl.ijk,vl.q,vl.i,vl.j,vl.k)
+					    :vcl->compute_cell(c,vl.ijk,vl.q,vl.i,vl.j,vl.k,&sl[0],&sl[0]+sl.size());
+				if(!b) {v.clear();continue;}
+				c.neighbors(v);
+				c.centroid(dx,dy,dz);
+				vl.pos(x,y,z);
+				np[3*i]=x+dx;np[3*i+1]=y+dy;np[3*i+2]=z+dz;
+				ok[i]=1;
+				dx=dx*dx+dy*dy+dz*dz;
+				if(dx>mm) mm=dx;
+			} while(vl.inc());
+			delete vcl;
+			return mm;
+		}
+};
+
+}
+
+#endif
@@ -0,0 +1,185 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file mesh.cc
+ * \brief Function implementations for the global_mesh class. */
+
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <utility>
+
+#include "mesh.hh"
+
+namespace voro {
+
+/** The initial size of the hash table of vertices, which must be a power of
+ * two. */
+const int mesh_hash_init=1024;
+
+/** The class constructor sets up an empty mesh.
+ * \param[in] tol_ the distance below which two vertices are merged, which
+ *		   must be positive. */
+global_mesh::global_mesh(double tol_) : tol(tol_), fo(1,0), bw(16*tol_),
+	ht(mesh_hash_init,-1) {}
+
+/** Removes all of the vertices and faces from the mesh. */
+void global_mesh::clear() {
+	pts.clear();fv.clear();owner.clear();neighbor.clear();
+	fo.assign(1,0);
+	ht.assign(mesh_hash_init,-1);
+}
+
+/** Adds the faces of a Voronoi cell to the mesh. A face that borders another
+ * particle with a smaller ID is skipped, since it is added with that
+ * particle's cell. The vertices of the other faces are merged with any that
+ * are already in the mesh.
+ * \param[in] c a reference to the Voronoi cell.
+ * \param[in] id the ID of the particle associated with the cell.
+ * \param[in] (x,y,z) the position of the particle. */
+void global_mesh::add(voronoicell_neighbor &c,voro_id id,double x,double y,double z) {
+	int j,k,f=0,l;
+	voro_id n;
+	c.face_vertices(vf);
+	c.neighbors(vn);
+	c.vertices(x,y,z,vd);
+	vm.assign(c.p,-1);
+	for(unsigned int i=0;i<vf.size();i+=k+1,f++) {
+		k=vf[i];n=vn[f];
+		if(n>=0&&n<id) continue;
+		for(j=i+1;j<=int(i)+k;j++) {
+			l=vf[j];
+			if(vm[l]<0) vm[l]=vertex(vd[3*l],vd[3*l+1],vd[3*l+2]);
+			fv.push_back(vm[l]);
+		}
+		fo.push_back(fv.size());
+		owner.push_back(id);
+		neighbor.push_back(n);
+	}
+}
+
+/** Finds a vertex of the mesh that is within the merging distance of a given
+ * position, adding a new vertex if there is none. The positions are rounded to
+ * bins that are wider than the merging distance, so that only the one or two
+ * bins in each direction that are within the merging distance need to be
+ * searched.
+ * \param[in] (x,y,z) the position.
+ * \return The index of the vertex. */
+int global_mesh::vertex(double x,double y,double z) {
+	unsigned int h,m=ht.size()-1;
+	int k;
+	double bx,by,bz,*pp,
+	       xl=floor((x-tol)/bw)+0.,xu=floor((x+tol)/bw)+0.,
+	       yl=floor((y-tol)/bw)+0.,yu=floor((y+tol)/bw)+0.,
+	       zl=floor((z-tol)/bw)+0.,zu=floor((z+tol)/bw)+0.;
+	for(bz=zl;bz<=zu;bz++) for(by=yl;by<=yu;by++) for(bx=xl;bx<=xu;bx++) {
+		h=hash(bx,by,bz)&m;
+		while((k=ht[h])!=-1) {
+			pp=&pts[3*k];
+			if(fabs(*pp-x)<=tol&&fabs(pp[1]-y)<=tol&&fabs(pp[2]-z)<=tol) return k;
+			h=(h+1)&m;
+		}
+	}
+
+	// No vertex was found, so add a new one, doubling the size of the
+	// hash table if it is more than half full
+	k=pts.size()/3;
+	pts.push_back(x);pts.push_back(y);pts.push_back(z);
+	if(2*(k+1)>int(ht.size())) rehash();
+	else {
+		h=hash(floor(x/bw)+0.,floor(y/bw)+0.,floor(z/bw)+0.)&m;
+		while(ht[h]!=-1) h=(h+1)&m;
+		ht[h]=k;
+	}
+	return k;
+}
+
+/** Computes the hash of a bin of vertex positions.
+ * \param[in] (bx,by,bz) the indices of the bin, stored as doubles so that they
+ *			 cannot overflow.
+ * \return The hash. */
+unsigned int global_mesh::hash(double bx,double by,double bz) {
+	unsigned int w[6],h=2166136261u;
+	memcpy(w,&bx,sizeof(double));
+	memcpy(w+2,&by,sizeof(double));
+	memcpy(w+4,&bz,sizeof(double));
+	for(int i=0;i<6;i++) h=(h^w[i])*16777619u;
+	return h^(h>>15);
+}
+
+/** Doubles the size of the hash table, and adds all of the vertices to it. */
+void global_mesh::rehash() {
+	unsigned int h,m;
+	int k,n=pts.size()/3;
+	ht.assign(ht.size()<<1,-1);
+	m=ht.size()-1;
+	for(k=0;k<n;k++) {
+		h=hash(floor(pts[3*k]/bw)+0.,floor(pts[3*k+1]/bw)+0.,floor(pts[3*k+2]/bw)+0.)&m;
+		while(ht[h]!=-1) h=(h+1)&m;
+		ht[h]=k;
+	}
+}
+
+/** Saves the mesh in an indexed text format. The first line contains the
+ * number of vertices and the number of faces. Each vertex position is then
+ * given on its own line. Each face is then given on its own line, as the ID of
+ * the particle that owns it, the ID of the particle or wall on the other side,
+ * the number of vertices, and the indices of the vertices, counting from zero.
+ * \param[in] fp the file handle to write to. */
+void global_mesh::print_mesh(FILE *fp) {
+	int i,j,nf=total_faces();
+	text_writer tw(fp);
+	tw.put(total_vertices());tw.put(' ');tw.put(nf);tw.put('\n');
+	for(std::vector<double>::iterator pp=pts.begin();pp!=pts.end();pp+=3) {
+		tw.put3(*pp,pp[1],pp[2],' ');tw.put('\n');
+	}
+	for(i=0;i<nf;i++) {
+		tw.put(owner[i]);tw.put(' ');tw.put(neighbor[i]);tw.put(' ');tw.put(fo[i+1]-fo[i]);
+		for(j=fo[i];j<fo[i+1];j++) {tw.put(' ');tw.put(fv[j]);}
+		tw.put('\n');
+	}
+}
+
+/** Saves the mesh as a POV-Ray mesh2 object, in which each face is divided
+ * into triangles that share its first vertex.
+ * \param[in] fp the file handle to write to. */
+void global_mesh::draw_pov(FILE *fp) {
+	int i,j,nf=total_faces();
+	text_writer tw(fp);
+	tw.put("mesh2 {\nvertex_vectors {\n");tw.put(total_vertices());tw.put('\n');
+	for(std::vector<double>::iterator pp=pts.begin();pp!=pts.end();pp+=3) {
+		tw.put(",<");tw.put3(*pp,pp[1],pp[2],',');tw.put(">\n");
+	}
+	tw.put("}\nface_indices {\n");tw.put(int(fv.size())-2*nf);tw.put('\n');
+	for(i=0;i<nf;i++) for(j=fo[i]+2;j<fo[i+1];j++) {
+		tw.put(",<");tw.put(fv[fo[i]]);tw.put(',');tw.put(fv[j-1]);
+		tw.put(',');tw.put(fv[j]);tw.put(">\n");
+	}
+	tw.put("}\n}\n");
+}
+
+/** Saves the distinct edges of the mesh in gnuplot format, with each edge
+ * drawn once.
+ * \param[in] fp the file handle to write to. */
+void global_mesh::draw_gnuplot(FILE *fp) {
+	int i,j,k,l,nf=total_faces();
+	std::vector<std::pair<int,int> > e;
+	e.reserve(fv.size());
+	for(i=0;i<nf;i++) for(j=fo[i];j<fo[i+1];j++) {
+		k=fv[j];l=fv[j+1==fo[i+1]?fo[i]:j+1];
+		e.push_back(k<l?std::make_pair(k,l):std::make_pair(l,k));
+	}
+	std::sort(e.begin(),e.end());
+	e.erase(std::unique(e.begin(),e.end()),e.end());
+	text_writer tw(fp);
+	for(std::vector<std::pair<int,int> >::iterator ep=e.begin();ep!=e.end();ep++) {
+		double *pp=&pts[3*ep->first],*qp=&pts[3*ep->second];
+		tw.put3(*pp,pp[1],pp[2],' ');tw.put('\n');
+		tw.put3(*qp,qp[1],qp[2],' ');tw.put("\n\n\n");
+	}
+}
+
+}
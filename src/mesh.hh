@@ -0,0 +1,129 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file mesh.hh
+ * \brief Header file for the global_mesh class. */
+
+#ifndef VOROPP_MESH_HH
+#define VOROPP_MESH_HH
+
+#include <cstdio>
+#include <vector>
+
+#include "config.hh"
+#include "common.hh"
+#include "cell.hh"
+
+namespace voro {
+
+/** The default distance below which two vertices of a global_mesh are merged,
+ * which is suitable for containers with a length scale of around one. */
+const double mesh_tolerance=1e4*tolerance;
+
+/** \brief A class for assembling the Voronoi cells of a container into a single
+ * indexed mesh.
+ *
+ * The draw_cells_pov() and draw_cells_gnuplot() routines of the containers
+ * draw each cell on its own, so that every face between two particles is
+ * drawn twice, and every vertex is drawn by each of the cells that it belongs
+ * to. This class instead stores each face once, together with the IDs of the
+ * particle that owns it and the particle or wall on the other side of it. A
+ * face between two particles is taken from the cell of the particle with the
+ * smaller ID, so that the result does not depend on the order in which the
+ * cells are added. The vertices are merged across cells using a hash table of
+ * their positions, so that each one is stored once. In a periodic container, a
+ * face that crosses the periodic boundary is stored at the position of the
+ * owning cell, and a face between a particle and its own periodic image is
+ * stored from both sides. The mesh can then be written in an indexed text
+ * format, as a POV-Ray mesh2 object, or as a list of the distinct edges in
+ * gnuplot format. */
+class global_mesh {
+	public:
+		/** The distance below which two vertices are merged. */
+		const double tol;
+		/** The positions of the vertices, in groups of three. */
+		std::vector<double> pts;
+		/** The start of each face in the fv array, with a final extra
+		 * entry marking the end of the last face. */
+		std::vector<int> fo;
+		/** The vertex indices of the faces, in the same order as the
+		 * cell's face_vertices() routine. */
+		std::vector<int> fv;
+		/** The ID of the particle that owns each face. */
+		std::vector<voro_id> owner;
+		/** The ID of the particle or wall on the other side of each
+		 * face. */
+		std::vector<voro_id> neighbor;
+		global_mesh(double tol_=mesh_tolerance);
+		/** Returns the number of distinct vertices in the mesh.
+		 * \return The number of vertices. */
+		inline int total_vertices() {return pts.size()/3;}
+		/** Returns the number of distinct faces in the mesh.
+		 * \return The number of faces. */
+		inline int total_faces() {return owner.size();}
+		void clear();
+		void add(voronoicell_neighbor &c,voro_id id,double x,double y,double z);
+		/** Computes the Voronoi cells of the particles in a loop, and
+		 * adds them to the mesh.
+		 * \param[in] vl the loop class to use.
+		 * \param[in] con the container that the loop refers to. */
+		template<class c_loop,class c_class>
+		void add(c_loop &vl,c_class &con) {
+			voronoicell_neighbor c(con);
+			int pid;double x,y,z,r;
+			if(vl.start()) do if(con.compute_cell(c,vl)) {
+				vl.pos(pid,x,y,z,r);
+				add(c,pid,x,y,z);
+			} while(vl.inc());
+		}
+		void print_mesh(FILE *fp=stdout);
+		/** Saves the mesh in an indexed text format.
+		 * \param[in] filename the name of the file to write to. */
+		inline void print_mesh(const char *filename) {
+			FILE *fp=safe_fopen(filename,"w");
+			print_mesh(fp);
+			fclose(fp);
+		}
+		void draw_pov(FILE *fp=stdout);
+		/** Saves the mesh as a POV-Ray mesh2 object.
+		 * \param[in] filename the name of the file to write to. */
+		inline void draw_pov(const char *filename) {
+			FILE *fp=safe_fopen(filename,"w");
+			draw_pov(fp);
+			fclose(fp);
+		}
+		void draw_gnuplot(FILE *fp=stdout);
+		/** Saves the distinct edges of the mesh in gnuplot format.
+		 * \param[in] filename the name of the file to write to. */
+		inline void draw_gnuplot(const char *filename) {
+			FILE *fp=safe_fopen(filename,"w");
+			draw_gnuplot(fp);
+			fclose(fp);
+		}
+	private:
+		/** The width of the bins that the vertex positions are
+		 * rounded to for hashing. */
+		const double bw;
+		/** The hash table of vertex indices, where -1 marks an empty
+		 * slot. */
+		std::vector<int> ht;
+		/** Temporary storage for the face vertices of a cell. */
+		std::vector<int> vf;
+		/** Temporary storage for the neighbors of a cell. */
+		std::vector<voro_id> vn;
+		/** Temporary storage for the vertex positions of a cell. */
+		std::vector<double> vd;
+		/** Temporary storage for the mapping from the vertices of a
+		 * cell to the vertices of the mesh. */
+		std::vector<int> vm;
+		int vertex(double x,double y,double z);
+		unsigned int hash(double bx,double by,double bz);
+		void rehash();
+};
+
+}
+
+#endif
@@ -0,0 +1,175 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file neighbor_graph.cc
+ * \brief Function implementations for the neighbor_graph class. */
+
+#include <algorithm>
+
+#include "neighbor_graph.hh"
+
+namespace voro {
+
+/** \brief A comparison function object for sorting the rows of a graph by
+ * their particle IDs. */
+struct graph_row_cmp {
+	/** A pointer to the particle IDs of the rows. */
+	const voro_id *id;
+	graph_row_cmp(const voro_id *id_) : id(id_) {}
+	inline bool operator()(int a,int b) const {return id[a]<id[b];}
+};
+
+/** Removes all of the rows from the graph, keeping the mode. */
+void neighbor_graph::clear() {
+	id.clear();nb.clear();area.clear();nrm.clear();vol.clear();
+	off.resize(1);
+}
+
+/** Adds a row for a Voronoi cell to the end of the graph. The neighbors, and
+ * the face areas and normals if they are asked for, are computed in a single
+ * traversal of the cell.
+ * \param[in] c a reference to the Voronoi cell.
+ * \param[in] id_ the ID of the particle associated with the cell. */
+void neighbor_graph::add(voronoicell_neighbor &c,voro_id id_) {
+	const bool ga=(mode&graph_areas)!=0,gn=(mode&graph_normals)!=0;
+	c.face_data(NULL,ga?&va:NULL,NULL,&vn,NULL,gn?&vm:NULL);
+	for(unsigned int f=0;f<vn.size();f++) {
+		if(vn[f]<0&&!(mode&graph_walls)) continue;
+		nb.push_back(vn[f]);
+		if(ga) area.push_back(va[f]);
+		if(gn) nrm.insert(nrm.end(),vm.begin()+3*f,vm.begin()+3*f+3);
+	}
+	id.push_back(id_);
+	off.push_back(nb.size());
+	if(mode&graph_volumes) vol.push_back(c.volume());
+}
+
+/** Adds all of the rows of another graph, which must have been built with the
+ * same mode, to the end of this one.
+ * \param[in] g the graph to add. */
+void neighbor_graph::append(const neighbor_graph &g) {
+	int o=off.back();
+	id.insert(id.end(),g.id.begin(),g.id.end());
+	nb.insert(nb.end(),g.nb.begin(),g.nb.end());
+	area.insert(area.end(),g.area.begin(),g.area.end());
+	nrm.insert(nrm.end(),g.nrm.begin(),g.nrm.end());
+	vol.insert(vol.end(),g.vol.begin(),g.vol.end());
+	for(unsigned int i=1;i<g.off.size();i++) off.push_back(o+g.off[i]);
+}
+
+/** Finds the row of a particle.
+ * \param[in] ord the rows, sorted by their particle IDs.
+ * \param[in] i the particle ID to look for.
+ * \return The row, or -1 if the particle has no row. */
+int neighbor_graph::find_row(const std::vector<int> &ord,voro_id i) {
+	int l=0,u=ord.size(),m;
+	while(l<u) {
+		m=(l+u)>>1;
+		if(id[ord[m]]<i) l=m+1;else u=m;
+	}
+	return l<int(ord.size())&&id[ord[l]]==i?ord[l]:-1;
+}
+
+/** Tests whether a row has an entry for a particle.
+ * \param[in] r the row.
+ * \param[in] i the particle ID to look for.
+ * \return True if the entry is present, false otherwise. */
+bool neighbor_graph::has_entry(int r,voro_id i) {
+	for(int e=off[r];e<off[r+1];e++) if(nb[e]==i) return true;
+	return false;
+}
+
+/** Checks that the graph is reciprocal, so that whenever the row of particle
+ * a has an entry for particle b, the row of particle b has an entry for
+ * particle a. Entries for walls, and for particles that have no row, are not
+ * checked.
+ * \param[out] bad a vector in which to store the indices of the entries that
+ *		   have no reverse entry, or NULL if these are not needed.
+ * \return The number of entries that have no reverse entry. */
+int neighbor_graph::check(std::vector<int> *bad) {
+	int r,e,s,n=0;
+	std::vector<int> ord(rows());
+	for(r=0;r<rows();r++) ord[r]=r;
+	if(rows()>0) std::sort(ord.begin(),ord.end(),graph_row_cmp(&id[0]));
+	if(bad!=NULL) bad->clear();
+	for(r=0;r<rows();r++) for(e=off[r];e<off[r+1];e++) {
+		if(nb[e]<0) continue;
+		s=find_row(ord,nb[e]);
+		if(s>=0&&!has_entry(s,id[r])) {
+			n++;
+			if(bad!=NULL) bad->push_back(e);
+		}
+	}
+	return n;
+}
+
+/** Makes the graph reciprocal, by adding a reverse entry for each entry that
+ * does not have one, as found by the check() routine. The new entries are
+ * added to the ends of their rows, with the same face area and the opposite
+ * normal vector as the entry that they reverse.
+ * \return The number of entries that were added. */
+int neighbor_graph::symmetrize() {
+	std::vector<int> bad;
+	int n=check(&bad);
+	if(n==0) return 0;
+
+	// Find the row of each entry, and the row that its reverse entry is
+	// added to
+	const bool ga=(mode&graph_areas)!=0,gn=(mode&graph_normals)!=0;
+	std::vector<int> ord(rows()),er(n),tr(n),cnt(rows()+1,0);
+	int r,e,k,o;
+	for(r=0;r<rows();r++) ord[r]=r;
+	std::sort(ord.begin(),ord.end(),graph_row_cmp(&id[0]));
+	for(k=0;k<n;k++) {
+		er[k]=int(std::upper_bound(off.begin(),off.end(),bad[k])-off.begin())-1;
+		tr[k]=find_row(ord,nb[bad[k]]);
+		cnt[tr[k]+1]++;
+	}
+
+	// Rebuild the arrays with space for the new entries at the end of
+	// each row
+	std::vector<int> noff(rows()+1);
+	std::vector<voro_id> nnb(nb.size()+n);
+	std::vector<double> nar(ga?area.size()+n:0),nnr(gn?nrm.size()+3*n:0);
+	noff[0]=0;
+	for(r=0;r<rows();r++) {
+		cnt[r+1]+=cnt[r];
+		noff[r+1]=off[r+1]+cnt[r+1];
+		for(e=off[r],o=noff[r];e<off[r+1];e++,o++) {
+			nnb[o]=nb[e];
+			if(ga) nar[o]=area[e];
+			if(gn) {nnr[3*o]=nrm[3*e];nnr[3*o+1]=nrm[3*e+1];nnr[3*o+2]=nrm[3*e+2];}
+		}
+		cnt[r]=noff[r+1]-(cnt[r+1]-cnt[r]);
+	}
+	for(k=0;k<n;k++) {
+		o=cnt[tr[k]]++;e=bad[k];
+		nnb[o]=id[er[k]];
+		if(ga) nar[o]=area[e];
+		if(gn) {nnr[3*o]=-nrm[3*e];nnr[3*o+1]=-nrm[3*e+1];nnr[3*o+2]=-nrm[3*e+2];}
+	}
+	off.swap(noff);nb.swap(nnb);
+	if(ga) area.swap(nar);
+	if(gn) nrm.swap(nnr);
+	return n;
+}
+
+/** Prints the graph, with one row on each line, giving the particle ID
+ * followed by its neighbor IDs. If the face areas are stored, then these are
+ * printed after the neighbor IDs.
+ * \param[in] fp a file handle to write to. */
+void neighbor_graph::print(FILE *fp) {
+	int r,e;
+	text_writer tw(fp);
+	for(r=0;r<rows();r++) {
+		tw.put(id[r]);
+		for(e=off[r];e<off[r+1];e++) {tw.put(' ');tw.put(nb[e]);}
+		if(mode&graph_areas) for(e=off[r];e<off[r+1];e++) {tw.put(' ');tw.put(area[e]);}
+		tw.put('\n');
+	}
+}
+
+}
@@ -0,0 +1,176 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file neighbor_graph.hh
+ * \brief Header file for the neighbor_graph class. */
+
+#ifndef VOROPP_NEIGHBOR_GRAPH_HH
+#define VOROPP_NEIGHBOR_GRAPH_HH
+
+#include <cstdio>
+#include <vector>
+
+#include "config.hh"
+#include "common.hh"
+#include "cell.hh"
+#include "c_loops.hh"
+#include "v_compute.hh"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace voro {
+
+/** The flags that can be combined to set up a neighbor_graph. */
+enum neighbor_graph_flags {
+	/** Keep the entries for faces that touch walls or the container
+	 * boundary, which have negative neighbor IDs. */
+	graph_walls=1,
+	/** Store the area of each face as the weight of its entry. */
+	graph_areas=2,
+	/** Store the outward unit normal vector of each face with its
+	 * entry. */
+	graph_normals=4,
+	/** Store the volume of the Voronoi cell of each row. */
+	graph_volumes=8
+};
+
+/** \brief A class for building the neighbor graph of the particles in a
+ * container in compressed sparse row form.
+ *
+ * Each particle whose Voronoi cell could be computed has a row in the graph,
+ * listing the IDs of the particles on the other sides of the faces of its
+ * cell, in the same order as voronoicell_neighbor::neighbors(). All of the
+ * rows are held in a few flat arrays, so building the graph makes no
+ * allocations per particle. The face areas and normal vectors can optionally
+ * be stored alongside the neighbor IDs, and are computed in the same
+ * traversal of each cell. The rows are in the order of the blocks of the
+ * container, which does not depend on the number of threads used.
+ *
+ * Since the cells are computed independently, round-off can occasionally
+ * make a very small face appear in one cell but not in the cell on the other
+ * side of it. The check() routine counts such entries, and the symmetrize()
+ * routine adds the missing reverse entries. */
+class neighbor_graph {
+	public:
+		/** The combination of neighbor_graph_flags that the graph is
+		 * built with. */
+		unsigned int mode;
+		/** The ID of the particle of each row. */
+		std::vector<voro_id> id;
+		/** The offsets of each row into the neighbor array, with an
+		 * extra entry marking the end. */
+		std::vector<int> off;
+		/** The neighbor IDs of all of the rows. */
+		std::vector<voro_id> nb;
+		/** The area of the face of each entry, if the graph_areas
+		 * flag is set. */
+		std::vector<double> area;
+		/** The normal vector of the face of each entry, in groups of
+		 * three, if the graph_normals flag is set. */
+		std::vector<double> nrm;
+		/** The volume of the Voronoi cell of each row, if the
+		 * graph_volumes flag is set. */
+		std::vector<double> vol;
+		/** Sets up an empty graph.
+		 * \param[in] mode_ the combination of neighbor_graph_flags to
+		 *		    use. */
+		neighbor_graph(unsigned int mode_=0) : mode(mode_), off(1,0) {}
+		/** Returns the number of rows.
+		 * \return The number of rows. */
+		inline int rows() {return id.size();}
+		/** Returns the total number of entries in all of the rows.
+		 * \return The number of entries. */
+		inline int entries() {return nb.size();}
+		/** Returns the number of entries in a row.
+		 * \param[in] r the row.
+		 * \return The number of entries. */
+		inline int degree(int r) {return off[r+1]-off[r];}
+		void clear();
+		void add(voronoicell_neighbor &c,voro_id id_);
+		void append(const neighbor_graph &g);
+		int check(std::vector<int> *bad=NULL);
+		int symmetrize();
+		void print(FILE *fp=stdout);
+		/** Saves the graph to a file, with each row on a line.
+		 * \param[in] filename the name of the file to write to. */
+		inline void print(const char *filename) {
+			FILE *fp=safe_fopen(filename,"w");
+			print(fp);
+			fclose(fp);
+		}
+		/** Computes the Voronoi cells of the particles in a loop, and
+		 * adds their rows to the graph.
+		 * \param[in] vl the loop class to use.
+		 * \param[in] con the container that the loop refers to. */
+		template<class c_loop,class c_class>
+		void add(c_loop &vl,c_class &con) {
+			voronoicell_neighbor c(con);
+			if(vl.start()) do if(con.compute_cell(c,vl)) add(c,vl.pid());
+			while(vl.inc());
+		}
+		/** Computes the Voronoi cells of all of the particles in a
+		 * container, and stores the neighbor graph. Any previous
+		 * contents of the graph are removed.
+		 * \param[in] con the container to use, which can be any of
+		 *		  the standard or periodic container classes.
+		 * \param[in] nt the number of threads to use. If this is more
+		 *		than one, then the blocks of the container are
+		 *		shared out among the threads by a block_scheduler,
+		 *		and the rows of each chunk of blocks are collected
+		 *		separately and joined in order at the end. */
+		template<class c_class>
+		void compute(c_class &con,int nt=1) {
+			clear();
+			nt=voro_threads(nt);
+			block_scheduler bs(con,nt);
+#ifdef _OPENMP
+			if(nt>1) {
+				neighbor_graph *pg=new neighbor_graph[bs.nc];
+				for(int c=0;c<bs.nc;c++) pg[c].mode=mode;
+#pragma omp parallel num_threads(nt) VOROPP_BIND
+				compute_thread(con,bs,omp_get_thread_num(),pg);
+				for(int c=0;c<bs.nc;c++) append(pg[c]);
+				delete [] pg;
+				return;
+			}
+#endif
+			compute_thread(con,bs,0,NULL);
+		}
+	private:
+		/** Temporary storage for the neighbors of a cell. */
+		std::vector<voro_id> vn;
+		/** Temporary storage for the face areas of a cell. */
+		std::vector<double> va;
+		/** Temporary storage for the face normals of a cell. */
+		std::vector<double> vm;
+		/** Computes the Voronoi cells in the chunks of blocks that a
+		 * block scheduler hands out to one thread.
+		 * \param[in] con the container to use.
+		 * \param[in] bs the block scheduler to use.
+		 * \param[in] t the thread number.
+		 * \param[in] pg an array of graphs to store the rows of each
+		 *		 chunk in, or NULL to add them to this graph. */
+		template<class c_class>
+		void compute_thread(c_class &con,block_scheduler &bs,int t,neighbor_graph *pg) {
+			voronoicell_neighbor c(con);
+			c_loop_parallel vl(con,bs,t);
+			voro_compute<c_class> *vcl=con.new_compute();
+			while(vl.start_chunk()) {
+				neighbor_graph &g=pg==NULL?*this:pg[vl.chunk];
+				do if(con.compute_cell(c,vl,*vcl)) g.add(c,vl.pid());
+				while(vl.inc_chunk());
+			}
+			delete vcl;
+		}
+		int find_row(const std::vector<int> &ord,voro_id i);
+		bool has_entry(int r,voro_id i);
+};
+
+}
+
+#endif
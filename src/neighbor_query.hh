@@ -0,0 +1,258 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file neighbor_query.hh
+ * \brief Header file for the neighbor_query class. */
+
+#ifndef VOROPP_NEIGHBOR_QUERY_HH
+#define VOROPP_NEIGHBOR_QUERY_HH
+
+#include <algorithm>
+#include <vector>
+
+#include "config.hh"
+#include "common.hh"
+#include "v_compute.hh"
+
+namespace voro {
+
+/** \brief A class for finding the particles in a container that are near to
+ * given positions.
+ *
+ * This class carries out k-nearest-neighbor and fixed-radius searches using
+ * the blocks of a container as the spatial index, so that no copy of the
+ * particles is needed. The searches are carried out by the find_neighbors()
+ * routine of the voro_compute template, which tests the blocks in the same
+ * order as the Voronoi cell computation, using the precomputed worklists, and
+ * stops once every untested block is further away than the search radius.
+ *
+ * A list of positions can be searched at once. The positions are sorted by
+ * block, so that consecutive searches access the same parts of the container,
+ * and they can be shared out among several threads, each with its own
+ * voro_compute class. The container must not be modified while a search is
+ * being carried out. The particle radii of the radical Voronoi containers are
+ * not used. In the periodic containers, a particle can be found more than once
+ * if the search radius reaches several of its periodic images.
+ * \tparam c_class the type of the container, which can be any of the standard
+ *		   or periodic container classes. */
+template<class c_class>
+class neighbor_query {
+	public:
+		/** A reference to the container that holds the particles. */
+		c_class &con;
+		/** The neighbors found by the last search for a single
+		 * position, sorted by increasing distance. The ID of each
+		 * particle is given by con.id[ijk][l], and its position is
+		 * the search position plus the displacement in the
+		 * record. */
+		std::vector<neighbor_record> nr;
+		/** Initializes the class for a container.
+		 * \param[in] con_ a reference to the container. */
+		neighbor_query(c_class &con_) : con(con_), vc(con_.new_compute()) {}
+		/** The class destructor frees the voro_compute class. */
+		~neighbor_query() {delete vc;}
+		/** Finds the particles near to a position, storing them in
+		 * nr.
+		 * \param[in] (x,y,z) the position.
+		 * \param[in] k the maximum number of particles to find, or a
+		 *		negative value if there is no limit.
+		 * \param[in] rsq the square of the search radius.
+		 * \return The number of particles found. */
+		inline int search(double x,double y,double z,int k,double rsq) {
+			return search(x,y,z,k,rsq,*vc,nr);
+		}
+		/** Finds the k particles that are nearest to a position.
+		 * \param[in] (x,y,z) the position.
+		 * \param[in] k the number of particles to find.
+		 * \param[out] pid the IDs of the particles, sorted by
+		 *		   increasing distance. This has fewer than k
+		 *		   entries if the container has fewer than k
+		 *		   particles.
+		 * \param[out] rs a vector in which to store the squared
+		 *		  distances to the particles, or NULL if this is
+		 *		  not needed. */
+		inline void nearest(double x,double y,double z,int k,std::vector<voro_id> &pid,std::vector<double> *rs=NULL) {
+			search(x,y,z,k,large_number);
+			copy_ids(pid,rs);
+		}
+		/** Finds the particles that are within a given distance of a
+		 * position.
+		 * \param[in] (x,y,z) the position.
+		 * \param[in] r the search radius.
+		 * \param[out] pid the IDs of the particles, sorted by
+		 *		   increasing distance.
+		 * \param[out] rs a vector in which to store the squared
+		 *		  distances to the particles, or NULL if this is
+		 *		  not needed. */
+		inline void within(double x,double y,double z,double r,std::vector<voro_id> &pid,std::vector<double> *rs=NULL) {
+			search(x,y,z,-1,r*r);
+			copy_ids(pid,rs);
+		}
+		/** Finds the k particles that are nearest to each of a list of
+		 * positions.
+		 * \param[in] n the number of positions.
+		 * \param[in] pp an array of (x,y,z) positions.
+		 * \param[in] k the number of particles to find for each
+		 *		position.
+		 * \param[out] pid an array of length n*k in which to store the
+		 *		   IDs of the particles, sorted by increasing
+		 *		   distance for each position. Unused entries, for
+		 *		   positions outside the container or when the
+		 *		   container has fewer than k particles, are set
+		 *		   to -1.
+		 * \param[out] rs an array of length n*k in which to store the
+		 *		  squared distances, with unused entries set to -1,
+		 *		  or NULL if this is not needed.
+		 * \param[in] nt the number of threads to use. */
+		void nearest(int n,const double *pp,int k,voro_id *pid,double *rs=NULL,int nt=1) {
+			std::vector<int> ord;
+			sort_positions(n,pp,ord);
+			for(int l=0;l<n*k;l++) pid[l]=-1;
+			if(rs!=NULL) for(int l=0;l<n*k;l++) rs[l]=-1;
+			nt=voro_threads(nt);
+			int m=ord.size();
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nt)
+#endif
+			{
+				voro_compute<c_class> *vcl=con.new_compute();
+				std::vector<neighbor_record> tr;
+				int a,l,c,j;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic,64)
+#endif
+				for(a=0;a<m;a++) {
+					l=ord[a];
+					c=search(pp[3*l],pp[3*l+1],pp[3*l+2],k,large_number,*vcl,tr);
+					for(j=0;j<c;j++) {
+						pid[k*l+j]=con.id[tr[j].ijk][tr[j].l];
+						if(rs!=NULL) rs[k*l+j]=tr[j].rs;
+					}
+				}
+				delete vcl;
+			}
+		}
+		/** Finds the particles that are within a given distance of
+		 * each of a list of positions. The results are stored in
+		 * compressed form, with the particles for the lth position
+		 * in entries off[l] to off[l+1]-1 of the output vectors.
+		 * \param[in] n the number of positions.
+		 * \param[in] pp an array of (x,y,z) positions.
+		 * \param[in] r the search radius.
+		 * \param[out] off a vector of n+1 offsets into the output.
+		 * \param[out] pid the IDs of the particles, sorted by
+		 *		   increasing distance for each position.
+		 * \param[out] rs a vector in which to store the squared
+		 *		  distances to the particles, or NULL if this is
+		 *		  not needed.
+		 * \param[in] nt the number of threads to use. */
+		void within(int n,const double *pp,double r,std::vector<int> &off,std::vector<voro_id> &pid,std::vector<double> *rs=NULL,int nt=1) {
+			std::vector<int> ord,th(n,0),ts(n,0);
+			sort_positions(n,pp,ord);
+			off.assign(n+1,0);
+			nt=voro_threads(nt);
+			std::vector<std::vector<voro_id> > bi(nt);
+			std::vector<std::vector<double> > br(nt);
+			int m=ord.size(),i,c;
+
+			// Search for each position, with each thread storing its
+			// results in its own buffer and recording where they are
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nt)
+#endif
+			{
+				voro_compute<c_class> *vcl=con.new_compute();
+				std::vector<neighbor_record> tr;
+#ifdef _OPENMP
+				int t=omp_get_thread_num();
+#else
+				int t=0;
+#endif
+				std::vector<voro_id> &ti=bi[t];
+				std::vector<double> &trs=br[t];
+				int a,l,c,j;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic,64)
+#endif
+				for(a=0;a<m;a++) {
+					l=ord[a];
+					c=search(pp[3*l],pp[3*l+1],pp[3*l+2],-1,r*r,*vcl,tr);
+					th[l]=t;ts[l]=ti.size();off[l+1]=c;
+					for(j=0;j<c;j++) {
+						ti.push_back(con.id[tr[j].ijk][tr[j].l]);
+						if(rs!=NULL) trs.push_back(tr[j].rs);
+					}
+				}
+				delete vcl;
+			}
+
+			// Gather the results into the original order
+			for(i=0;i<n;i++) off[i+1]+=off[i];
+			pid.resize(off[n]);
+			if(rs!=NULL) rs->resize(off[n]);
+			for(i=0;i<n;i++) if((c=off[i+1]-off[i])>0) {
+				std::copy(bi[th[i]].begin()+ts[i],bi[th[i]].begin()+ts[i]+c,pid.begin()+off[i]);
+				if(rs!=NULL) std::copy(br[th[i]].begin()+ts[i],br[th[i]].begin()+ts[i]+c,rs->begin()+off[i]);
+			}
+		}
+	private:
+		/** The voro_compute class used for searches for a single
+		 * position. */
+		voro_compute<c_class> *vc;
+		/** Finds the particles near to a position, using a given
+		 * voro_compute class.
+		 * \param[in] (x,y,z) the position.
+		 * \param[in] k the maximum number of particles to find, or a
+		 *		negative value if there is no limit.
+		 * \param[in] rsq the square of the search radius.
+		 * \param[in] vcl the voro_compute class to use.
+		 * \param[out] tr the neighbors that were found.
+		 * \return The number of particles found, which is zero if the
+		 *	   position is outside the container. */
+		int search(double x,double y,double z,int k,double rsq,voro_compute<c_class> &vcl,std::vector<neighbor_record> &tr) {
+			int ijk,ci,cj,ck;
+			if(!con.locate_ghost(ijk,ci,cj,ck,x,y,z)) {tr.clear();return 0;}
+			vcl.find_neighbors(x,y,z,ci,cj,ck,ijk,k,rsq,tr);
+			return tr.size();
+		}
+		/** Copies the IDs and distances of the neighbors in nr to
+		 * vectors.
+		 * \param[out] pid the IDs of the particles.
+		 * \param[out] rs the squared distances, or NULL if these are
+		 *		  not needed. */
+		void copy_ids(std::vector<voro_id> &pid,std::vector<double> *rs) {
+			pid.resize(nr.size());
+			if(rs!=NULL) rs->resize(nr.size());
+			for(unsigned int j=0;j<nr.size();j++) {
+				pid[j]=con.id[nr[j].ijk][nr[j].l];
+				if(rs!=NULL) (*rs)[j]=nr[j].rs;
+			}
+		}
+		/** Orders a list of positions by the block that they are
+		 * within, so that consecutive searches access the same parts
+		 * of the container. Positions outside the container are
+		 * left out.
+		 * \param[in] n the number of positions.
+		 * \param[in] pp an array of (x,y,z) positions.
+		 * \param[out] ord the indices of the positions, in order. */
+		void sort_positions(int n,const double *pp,std::vector<int> &ord) {
+			std::vector<std::pair<int,int> > bl;
+			int ijk,ci,cj,ck;
+			double x,y,z;
+			bl.reserve(n);
+			for(int l=0;l<n;l++) {
+				x=pp[3*l];y=pp[3*l+1];z=pp[3*l+2];
+				if(con.locate_ghost(ijk,ci,cj,ck,x,y,z)) bl.push_back(std::pair<int,int>(ijk,l));
+			}
+			std::sort(bl.begin(),bl.end());
+			ord.resize(bl.size());
+			for(unsigned int l=0;l<bl.size();l++) ord[l]=bl[l].second;
+		}
+};
+
+}
+
+#endif
@@ -0,0 +1,126 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file particle_file.cc
+ * \brief Function implementations for the binary particle file reader and
+ * writer. */
+
+#include <cstdio>
+#include <cstdlib>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "particle_file.hh"
+#include "common.hh"
+
+namespace voro {
+
+/** The class constructor maps a file into memory.
+ * \param[in] filename the name of the file to read.
+ * \param[in] min_size the minimum size of the file in bytes.
+ * \param[in] short_msg the error message to print if the file is shorter
+ *			than the minimum size. */
+mapped_file::mapped_file(const char *filename,size_t min_size,const char *short_msg) {
+#ifdef _WIN32
+
+	// On systems without mmap, read the whole file into memory instead
+	FILE *fp=safe_fopen(filename,"rb");
+	fseek(fp,0,SEEK_END);
+	long l=ftell(fp);
+	if(l<0||size_t(l)<min_size) {
+		fclose(fp);
+		voro_fatal_error(short_msg,VOROPP_FILE_ERROR);
+	}
+	size=l;
+	mp=new char[size];
+	fseek(fp,0,SEEK_SET);
+	if(fread(mp,1,size,fp)!=size) voro_fatal_error("File import error",VOROPP_FILE_ERROR);
+	fclose(fp);
+#else
+	int fd=open(filename,O_RDONLY);
+	if(fd<0) {
+		fprintf(stderr,"voro++: Unable to open file '%s'\n",filename);
+		exit(VOROPP_FILE_ERROR);
+	}
+	struct stat st;
+	if(fstat(fd,&st)!=0||size_t(st.st_size)<min_size) {
+		close(fd);
+		voro_fatal_error(short_msg,VOROPP_FILE_ERROR);
+	}
+	size=st.st_size;
+	mp=size==0?NULL:mmap(NULL,size,PROT_READ,MAP_PRIVATE,fd,0);
+	close(fd);
+	if(mp==MAP_FAILED) voro_fatal_error("Unable to map file into memory",VOROPP_FILE_ERROR);
+	if(size>0) madvise(mp,size,MADV_SEQUENTIAL);
+#endif
+	data=static_cast<const char*>(mp);
+}
+
+/** The class destructor unmaps the file. */
+mapped_file::~mapped_file() {
+#ifdef _WIN32
+	delete [] static_cast<char*>(mp);
+#else
+	if(size>0) munmap(mp,size);
+#endif
+}
+
+/** The class constructor maps a binary particle file into memory and reads
+ * its header.
+ * \param[in] filename the name of the file to read. */
+particle_file::particle_file(const char *filename)
+	: mf(filename,particle_file_header_size,"Binary particle file is too short") {
+
+	// Check the header, and read the particle count and bounds
+	const char *cp=mf.data;
+	unsigned int ver,fl,ui;
+	double b[6];
+	memcpy(&ver,cp+8,sizeof(unsigned int));
+	memcpy(&fl,cp+12,sizeof(unsigned int));
+	memcpy(&ui,cp+16,sizeof(unsigned int));
+	memcpy(b,cp+24,6*sizeof(double));
+	if(memcmp(cp,"VORO++PF",8)!=0||ver!=particle_file_version||ui>0x7fffffffu)
+		voro_fatal_error("Invalid binary particle file header",VOROPP_FILE_ERROR);
+	n=ui;
+	radii=(fl&particle_file_radii)!=0;
+	ax=*b;bx=b[1];ay=b[2];by=b[3];az=b[4];bz=b[5];
+	rs=radii?36:28;
+	rp=cp+particle_file_header_size;
+	if(mf.size<particle_file_header_size+size_t(n)*rs)
+		voro_fatal_error("Binary particle file is truncated",VOROPP_FILE_ERROR);
+}
+
+/** Writes a binary particle file.
+ * \param[in] filename the name of the file to write.
+ * \param[in] n the number of particles.
+ * \param[in] id an array of the particle IDs.
+ * \param[in] pp an array of the particle positions, in groups of three, or in
+ *		 groups of four with the radius if radii is true.
+ * \param[in] radii whether to store the particle radii.
+ * \param[in] (ax,bx) the minimum and maximum x coordinates of the particles.
+ * \param[in] (ay,by) the minimum and maximum y coordinates of the particles.
+ * \param[in] (az,bz) the minimum and maximum z coordinates of the particles. */
+void write_particle_file(const char *filename,int n,const int *id,const double *pp,bool radii,
+		double ax,double bx,double ay,double by,double az,double bz) {
+	FILE *fp=safe_fopen(filename,"wb");
+	unsigned int h[4]={particle_file_version,radii?particle_file_radii:0,(unsigned int) n,0};
+	double b[6]={ax,bx,ay,by,az,bz};
+	int ps=radii?4:3;
+	fwrite("VORO++PF",1,8,fp);
+	fwrite(h,sizeof(unsigned int),4,fp);
+	fwrite(b,sizeof(double),6,fp);
+	for(int i=0;i<n;i++,pp+=ps) {
+		fwrite(id+i,sizeof(int),1,fp);
+		fwrite(pp,sizeof(double),ps,fp);
+	}
+	if(fclose(fp)!=0) voro_fatal_error("File output error",VOROPP_FILE_ERROR);
+}
+
+}
@@ -0,0 +1,117 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file particle_file.hh
+ * \brief Header file for the binary particle file reader and writer.
+ *
+ * A binary particle file begins with a 72-byte header, made up of:
+ *  - the eight characters "VORO++PF",
+ *  - a 32-bit unsigned integer version number, which is currently 1,
+ *  - a 32-bit unsigned integer of flags, where bit 0 is set if the particle
+ *    radii are stored,
+ *  - a 32-bit unsigned integer giving the number of particles,
+ *  - 32 bits of padding, which should be zero,
+ *  - six doubles giving the minimum and maximum x, y, and z coordinates of
+ *    the particles.
+ *
+ * The header is followed by one packed record per particle, made up of a
+ * 32-bit particle ID and the x, y, and z coordinates as doubles, followed by
+ * the radius as a double if bit 0 of the flags is set. The records are
+ * therefore 28 or 36 bytes long, and are not aligned. All fields are in the
+ * native byte order of the machine; a file with the other byte order is
+ * detected from the version number and rejected. */
+
+#ifndef VOROPP_PARTICLE_FILE_HH
+#define VOROPP_PARTICLE_FILE_HH
+
+#include <cstring>
+
+#include "config.hh"
+
+namespace voro {
+
+/** The size of the header of a binary particle file, in bytes. */
+const int particle_file_header_size=72;
+/** The version number of the binary particle file format. */
+const unsigned int particle_file_version=1;
+/** The flag that is set if the particle radii are stored. */
+const unsigned int particle_file_radii=1;
+
+/** \brief A class for mapping a whole file into memory for reading.
+ *
+ * On systems with mmap the file is mapped directly, so that its contents are
+ * only read from the disk as they are used. On Windows, where mmap is not
+ * available, the file is read into a buffer instead. If the file cannot be
+ * opened, or is shorter than a given size, then the constructor causes a fatal
+ * error with the VOROPP_FILE_ERROR status. */
+class mapped_file {
+	public:
+		/** A pointer to the start of the file contents. */
+		const char *data;
+		/** The size of the file in bytes. */
+		size_t size;
+		mapped_file(const char *filename,size_t min_size,const char *short_msg);
+		~mapped_file();
+	private:
+		/** A pointer to the mapped memory. */
+		void *mp;
+};
+
+/** \brief A class for reading a binary particle file.
+ *
+ * The file is mapped into memory, so that the records can be read directly
+ * without any parsing or copying into intermediate buffers. If the file
+ * cannot be opened or its header is invalid, then the constructor causes a
+ * fatal error with the VOROPP_FILE_ERROR status. */
+class particle_file {
+	public:
+		/** The number of particles in the file. */
+		int n;
+		/** Whether the particle radii are stored. */
+		bool radii;
+		/** The minimum and maximum x coordinates of the particles. */
+		double ax,bx;
+		/** The minimum and maximum y coordinates of the particles. */
+		double ay,by;
+		/** The minimum and maximum z coordinates of the particles. */
+		double az,bz;
+		particle_file(const char *filename);
+		/** Reads the ID and position of a particle.
+		 * \param[in] i the index of the particle in the file.
+		 * \param[out] id the ID of the particle.
+		 * \param[out] (x,y,z) the position of the particle. */
+		inline void get(int i,int &id,double &x,double &y,double &z) {
+			const char *cp=rp+size_t(i)*rs;
+			memcpy(&id,cp,sizeof(int));
+			memcpy(&x,cp+4,sizeof(double));
+			memcpy(&y,cp+12,sizeof(double));
+			memcpy(&z,cp+20,sizeof(double));
+		}
+		/** Reads the ID, position, and radius of a particle. This
+		 * should only be called if the radii are stored.
+		 * \param[in] i the index of the particle in the file.
+		 * \param[out] id the ID of the particle.
+		 * \param[out] (x,y,z) the position of the particle.
+		 * \param[out] r the radius of the particle. */
+		inline void get(int i,int &id,double &x,double &y,double &z,double &r) {
+			get(i,id,x,y,z);
+			memcpy(&r,rp+size_t(i)*rs+28,sizeof(double));
+		}
+	private:
+		/** The mapped file. */
+		mapped_file mf;
+		/** A pointer to the first particle record. */
+		const char *rp;
+		/** The size of each particle record in bytes. */
+		int rs;
+};
+
+void write_particle_file(const char *filename,int n,const int *id,const double *pp,bool radii,
+		double ax,double bx,double ay,double by,double az,double bz);
+
+}
+
+#endif
@@ -0,0 +1,163 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file pipeline.cc
+ * \brief Function implementations for the pipeline class. */
+
+#include <cstdlib>
+#include <cmath>
+
+#include "pipeline.hh"
+#include "text_reader.hh"
+
+namespace voro {
+
+/** The class constructor binds the pipeline to a container.
+ * \param[in] con_ the container to put the particles into, which must not be
+ *		   periodic in the z direction. */
+pipeline::pipeline(container &con_) : con(con_), np(0), kw(0), kc(0) {
+	if(con.zperiodic) voro_fatal_error("The pipeline cannot be used with a z-periodic container",VOROPP_INTERNAL_ERROR);
+}
+
+/** Imports particles from an open file stream, computes their Voronoi cells,
+ * and saves customized information about them. The particles are added to
+ * any that are already in the container, whose cells are also computed. The
+ * file must be sorted in the z direction.
+ * \param[in] format the custom output string to use.
+ * \param[in] in the file handle to read the particles from.
+ * \param[in] fp a file handle to write to. */
+void pipeline::print_custom(const char *format,FILE *in,FILE *fp) {
+	compiled_format fm(format);
+	if(fm.neighbor()) run<voronoicell_neighbor>(fm,in,fp);
+	else run<voronoicell>(fm,in,fp);
+}
+
+/** Puts a block of particles into the container, checking that they are
+ * sorted in the z direction.
+ * \param[in] id the IDs of the particles.
+ * \param[in] v the positions of the particles, in groups of three. */
+void pipeline::put_block(std::vector<voro_id> &id,std::vector<double> &v) {
+	int k;double zk;
+	for(unsigned int i=0;i<id.size();i++) {
+		zk=(v[3*i+2]-con.az)*con.zsp;
+		if(zk>=0&&(k=int(zk))<con.nz) {
+			if(k<kw) voro_fatal_error("The particles are not sorted in the z direction",VOROPP_FILE_ERROR);
+			kw=k;
+		}
+		con.put(id[i],v[3*i],v[3*i+1],v[3*i+2]);
+		np++;
+	}
+}
+
+/** Runs the three stages of the pipeline, alternating between two sets of
+ * input and output buffers.
+ * \param[in] fm the compiled custom output format.
+ * \param[in] in the file handle to read the particles from.
+ * \param[in] fp a file handle to write to. */
+template<class v_cell>
+void pipeline::run(compiled_format &fm,FILE *in,FILE *fp) {
+	text_reader tr(in,3,1);
+	std::vector<voro_id> id;
+	std::vector<double> v;
+	v_cell c(con);
+	bool more=tr.next();
+#ifdef _OPENMP
+	char *buf[2]={NULL,NULL};
+	size_t len[2]={0,0};
+	int b=0,wb=-1;
+	FILE *ms;
+	while(more) {
+		tr.id.swap(id);tr.v.swap(v);
+		ms=open_memstream(buf+b,len+b);
+		if(ms==NULL) voro_fatal_error("Unable to open an output buffer",VOROPP_MEMORY_ERROR);
+#pragma omp parallel sections num_threads(3)
+		{
+#pragma omp section
+			more=tr.next();
+#pragma omp section
+			{
+				put_block(id,v);
+				compute_ready(c,fm,ms,false);
+				fclose(ms);
+			}
+#pragma omp section
+			if(wb>=0) {
+				fwrite(buf[wb],1,len[wb],fp);
+				free(buf[wb]);
+			}
+		}
+		wb=b;b=1-b;
+	}
+	if(wb>=0) {
+		fwrite(buf[wb],1,len[wb],fp);
+		free(buf[wb]);
+	}
+#else
+	while(more) {
+		put_block(tr.id,tr.v);
+		compute_ready(c,fm,fp,false);
+		more=tr.next();
+	}
+#endif
+	compute_ready(c,fm,fp,true);
+}
+
+/** Computes the Voronoi cells in the layers of blocks that have been
+ * completely read, and those cells that could not be written in a previous
+ * round.
+ * \param[in] c a Voronoi cell to use for the computation.
+ * \param[in] fm the compiled custom output format.
+ * \param[in] fp a file handle to write to.
+ * \param[in] all whether the whole file has been read, in which case all of
+ *		  the remaining cells are computed. */
+template<class v_cell>
+void pipeline::compute_ready(v_cell &c,compiled_format &fm,FILE *fp,bool all) {
+	double zl=all?con.bz:con.az+kw*con.boxz;
+	int ke=all?con.nz:kw-1,ijk,q;
+
+	// Try the cells from earlier rounds again, if enough of the file has
+	// now been read
+	std::vector<int> odq;
+	std::vector<double> odz;
+	odq.swap(dq);odz.swap(dz);
+	for(unsigned int l=0;l<odz.size();l++) {
+		if(all||odz[l]<zl) output_cell(c,fm,fp,odq[2*l],odq[2*l+1],zl);
+		else {
+			dq.push_back(odq[2*l]);dq.push_back(odq[2*l+1]);
+			dz.push_back(odz[l]);
+		}
+	}
+
+	// Compute the cells in the layers that have been completely read,
+	// leaving the top one as a halo
+	for(;kc<ke;kc++) for(ijk=kc*con.nxy;ijk<(kc+1)*con.nxy;ijk++)
+		for(q=0;q<con.co[ijk];q++) output_cell(c,fm,fp,ijk,q,zl);
+}
+
+/** Computes a single Voronoi cell, and writes it if it only depends on the
+ * particles that have been read. Otherwise it is stored so that it can be
+ * computed again in a later round.
+ * \param[in] c a Voronoi cell to use for the computation.
+ * \param[in] fm the compiled custom output format.
+ * \param[in] fp a file handle to write to.
+ * \param[in] (ijk,q) the block and the index within the block of the
+ *		      particle.
+ * \param[in] zl the z coordinate below which all of the particles have been
+ *		 read, which is the top of the container once the whole file
+ *		 has been read. */
+template<class v_cell>
+inline void pipeline::output_cell(v_cell &c,compiled_format &fm,FILE *fp,int ijk,int q,double zl) {
+	if(!con.compute_cell(c,ijk,q)) return;
+	fpoint *pp=con.p[ijk]+3*q;
+	double zr=*(pp+2)+sqrt(c.max_radius_squared());
+	if(zr<zl||zl>=con.bz) fm.write(c,con.id[ijk][q],*pp,pp[1],pp[2],default_radius,fp);
+	else {
+		dq.push_back(ijk);dq.push_back(q);
+		dz.push_back(zr);
+	}
+}
+
+}
@@ -0,0 +1,88 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file pipeline.hh
+ * \brief Header file for the pipeline class. */
+
+#ifndef VOROPP_PIPELINE_HH
+#define VOROPP_PIPELINE_HH
+
+#include <cstdio>
+#include <vector>
+
+#include "config.hh"
+#include "common.hh"
+#include "cell.hh"
+#include "container.hh"
+#include "format.hh"
+
+namespace voro {
+
+/** \brief A class for importing particles, computing their Voronoi cells, and
+ * writing the output at the same time.
+ *
+ * This class reads a text file of particles that is sorted in the z
+ * direction, so that the z block index of the particles in the container is
+ * non-decreasing. The file is read in large blocks. While one block is being
+ * parsed, the particles of the previous block are put into the container, and
+ * the Voronoi cells in any layers of blocks that have been completely read
+ * are computed, while the output from the round before that is written to the
+ * output stream. Each stage therefore passes its results to the next one
+ * through a queue that holds a single block, which bounds the memory used for
+ * the buffered input and output. When the code is compiled without OpenMP,
+ * the stages are carried out one after another.
+ *
+ * A cell is only written once every point within twice its maximum vertex
+ * distance lies in a layer that has been completely read, since only then can
+ * it not be cut by any particle still to come. Any other cell is computed
+ * again in a later round. The output is therefore the same as that of the
+ * container's print_custom routine, apart from the ordering of the cells. The
+ * container must not be periodic in the z direction, and if the file is not
+ * sorted then a fatal error is caused with the VOROPP_FILE_ERROR status. */
+class pipeline {
+	public:
+		/** A reference to the container to put the particles into. */
+		container &con;
+		/** The number of particles that have been read. */
+		int np;
+		pipeline(container &con_);
+		void print_custom(const char *format,FILE *in,FILE *fp=stdout);
+		/** Imports particles from a file, computes their Voronoi
+		 * cells, and saves customized information about them.
+		 * \param[in] format the custom output string to use.
+		 * \param[in] in_file the name of the file to read from.
+		 * \param[in] filename the name of the file to write to. */
+		inline void print_custom(const char *format,const char *in_file,const char *filename) {
+			FILE *in=safe_fopen(in_file,"r"),*fp=safe_fopen(filename,"w");
+			print_custom(format,in,fp);
+			fclose(fp);
+			fclose(in);
+		}
+	private:
+		/** The z block index of the last particle that has been put
+		 * into the container. All of the layers below it have been
+		 * completely read. */
+		int kw;
+		/** The next layer of blocks whose cells should be computed. */
+		int kc;
+		/** The block and particle indices of the cells that need to be
+		 * computed again, in pairs. */
+		std::vector<int> dq;
+		/** The z coordinate that must be completely read before each
+		 * of the cells in dq can be written. */
+		std::vector<double> dz;
+		void put_block(std::vector<voro_id> &id,std::vector<double> &v);
+		template<class v_cell>
+		void run(compiled_format &fm,FILE *in,FILE *fp);
+		template<class v_cell>
+		void compute_ready(v_cell &c,compiled_format &fm,FILE *fp,bool all);
+		template<class v_cell>
+		inline void output_cell(v_cell &c,compiled_format &fm,FILE *fp,int ijk,int q,double zl);
+};
+
+}
+
+#endif
@@ -9,9 +9,12 @@
  */
 
 #include <cmath>
+#include <algorithm>
 
 #include "config.hh"
 #include "pre_container.hh"
+#include "particle_file.hh"
+#include "text_reader.hh"
 
 namespace voro {
 
@@ -30,9 +33,9 @@ pre_container_base::pre_container_base(double ax_,double bx_,double ay_,double b
 	bool xperiodic_,bool yperiodic_,bool zperiodic_,int ps_) :
 	ax(ax_), bx(bx_), ay(ay_), by(by_), az(az_), bz(bz_),
 	xperiodic(xperiodic_), yperiodic(yperiodic_), zperiodic(zperiodic_), ps(ps_),
-	index_sz(init_chunk_size), pre_id(new int*[index_sz]), end_id(pre_id),
+	index_sz(init_chunk_size), pre_id(new voro_id*[index_sz]), end_id(pre_id),
 	pre_p(new double*[index_sz]), end_p(pre_p) {
-		ch_id=*end_id=new int[pre_container_chunk_size];
+		ch_id=*end_id=new voro_id[pre_container_chunk_size];
 		l_id=end_id+index_sz;e_id=ch_id+pre_container_chunk_size;
 		ch_p=*end_p=new double[ps*pre_container_chunk_size];
 }
@@ -62,13 +65,188 @@ void pre_container_base::guess_optimal(int &nx,int &ny,int &nz) {
 	nz=int(dz*ilscale+1);
 }
 
+/** Computes the index of the block that a coordinate lies in, for the grid
+ * auto-tuner.
+ * \param[in] x the coordinate.
+ * \param[in] a the minimum coordinate of the container.
+ * \param[in] isp the inverse block length.
+ * \param[in] n the number of blocks.
+ * \param[in] periodic whether the container is periodic in this direction.
+ * \return The block index. */
+static inline int tune_block(double x,double a,double isp,int n,bool periodic) {
+	double r=(x-a)*isp;
+	int i=r<0?int(r)-1:int(r);
+	if(periodic) {i%=n;if(i<0) i+=n;}
+	else if(i<0) i=0;
+	else if(i>=n) i=n-1;
+	return i;
+}
+
+/** Applies the boundary conditions to a neighboring block index, for the grid
+ * auto-tuner.
+ * \param[in,out] i the block index, which is wrapped into range if the
+ *		     container is periodic.
+ * \param[in] n the number of blocks.
+ * \param[in] periodic whether the container is periodic in this direction.
+ * \return True if the block exists, false otherwise. */
+static inline bool tune_wrap(int &i,int n,bool periodic) {
+	if(i>=0&&i<n) return true;
+	if(!periodic) return false;
+	i+=i<0?n:-n;
+	return true;
+}
+
+/** Ranks a range of grids by their predicted time to compute all of the
+ * Voronoi cells, using a histogram of the stored particles over each grid.
+ * The grids are centered on the one chosen by guess_optimal, and are refined
+ * and coarsened from it by the factor 2^(1/6) in each direction, for
+ * tune_grid_steps steps in each direction.
+ *
+ * The local density around each block is measured as the mean number of
+ * particles in the block and its 26 neighbors, which is denoted by m. The time
+ * to compute a cell in the block is then modeled as (1+2m^(-1/3))^3 (c+m). The
+ * first factor approximates the number of blocks that are searched, since the
+ * search radius scales with the distance between neighboring particles, and
+ * the second factor accounts for the fixed cost of each block and for testing
+ * each of its particles. The constant c is chosen so that for uniformly
+ * distributed particles the model is minimized at the optimal_particles value
+ * used by guess_optimal. For nonuniform arrangements, the sum over the blocks
+ * balances the cost of the dense regions against that of the sparse ones.
+ *
+ * The memory for each grid is predicted by simulating the block memory
+ * allocation of the container, which doubles the memory in a block whenever
+ * it is full, and the initial allocation that gives the smallest memory is
+ * stored with each grid.
+ * \param[out] gc the grids, sorted by their predicted time. */
+void pre_container_base::rank_grids(std::vector<grid_candidate> &gc) {
+	double dx=bx-ax,dy=by-ay,dz=bz-az,f,t,m,bm;
+	int i,j,k,di,dj,dk,ii,jj,kk,nn,sm;
+	double ilscale=pow(total_particles()/(optimal_particles*dx*dy*dz),1/3.0);
+	double u=pow(optimal_particles,-1/3.0),c=0.5*(1+2*u)*pow(optimal_particles,4/3.0)-optimal_particles;
+	double rs=sizeof(voro_id)+ps*sizeof(fpoint),bs=2*sizeof(int)+sizeof(int*)+sizeof(fpoint*);
+	int l,im,a,mx,nxyz;
+	voro_id **c_id,*idp,*ide;
+	double **c_p,*pp;
+	std::vector<int> hc,oc;
+	grid_candidate g;
+	gc.clear();
+	for(int s=-tune_grid_steps;s<=tune_grid_steps;s++) {
+		f=ilscale*pow(2.0,s/6.0);
+		g.nx=int(dx*f+1);g.ny=int(dy*f+1);g.nz=int(dz*f+1);
+		if(!gc.empty()&&g.nx==gc.back().nx&&g.ny==gc.back().ny&&g.nz==gc.back().nz) continue;
+
+		// Count the particles in each block
+		nxyz=g.nx*g.ny*g.nz;
+		hc.assign(nxyz,0);
+		double xsp=g.nx/dx,ysp=g.ny/dy,zsp=g.nz/dz;
+		for(c_id=pre_id,c_p=pre_p;c_id<=end_id;c_id++,c_p++) {
+			idp=*c_id;ide=c_id==end_id?ch_id:idp+pre_container_chunk_size;
+			for(pp=*c_p;idp<ide;idp++,pp+=ps)
+				hc[tune_block(*pp,ax,xsp,g.nx,xperiodic)
+				  +g.nx*(tune_block(pp[1],ay,ysp,g.ny,yperiodic)
+				  +g.ny*tune_block(pp[2],az,zsp,g.nz,zperiodic))]++;
+		}
+
+		// Predict the time, using the local density around each
+		// non-empty block
+		for(t=0,mx=0,l=0;l<nxyz;l++) if(hc[l]>0) {
+			if(hc[l]>mx) mx=hc[l];
+			i=l%g.nx;j=(l/g.nx)%g.ny;k=l/(g.nx*g.ny);
+			for(sm=nn=0,dk=-1;dk<=1;dk++) {
+				if(!tune_wrap(kk=k+dk,g.nz,zperiodic)) continue;
+				for(dj=-1;dj<=1;dj++) {
+					if(!tune_wrap(jj=j+dj,g.ny,yperiodic)) continue;
+					for(di=-1;di<=1;di++) {
+						if(!tune_wrap(ii=i+di,g.nx,xperiodic)) continue;
+						sm+=hc[ii+g.nx*(jj+g.ny*kk)];nn++;
+					}
+				}
+			}
+			m=double(sm)/nn;u=1+2*pow(m,-1/3.0);
+			t+=hc[l]*u*u*u*(c+m);
+		}
+		g.time=t;
+
+		// Find how many blocks have each number of particles
+		oc.assign(mx+1,0);
+		for(l=0;l<nxyz;l++) oc[hc[l]]++;
+
+		// Find the initial memory allocation that minimizes the
+		// predicted memory
+		g.mem=-1;
+		for(im=1;im<=tune_max_init_mem;im++) {
+			for(bm=0,l=0;l<=mx;l++) if(oc[l]>0) {
+				for(a=im;a<l;a<<=1);
+				bm+=double(oc[l])*a;
+			}
+			bm=nxyz*bs+bm*rs;
+			if(g.mem<0||bm<g.mem) {g.mem=bm;g.init_mem=im;}
+		}
+		gc.push_back(g);
+	}
+	std::sort(gc.begin(),gc.end());
+}
+
+/** Chooses a grid from a list of candidates. Out of the grids whose time is
+ * within the tune_time_margin factor of the fastest, the one with the smallest
+ * predicted memory is chosen.
+ * \param[in] gc the candidates, sorted by their time.
+ * \param[out] (nx,ny,nz) the number of blocks to use.
+ * \param[out] init_mem the initial memory allocation per block to use. */
+void pre_container_base::choose_grid(std::vector<grid_candidate> &gc,int &nx,int &ny,int &nz,int &init_mem) {
+	unsigned int l,b=0;
+	for(l=1;l<gc.size()&&gc[l].time<=tune_time_margin*gc[0].time;l++)
+		if(gc[l].mem<gc[b].mem) b=l;
+	nx=gc[b].nx;ny=gc[b].ny;nz=gc[b].nz;
+	init_mem=gc[b].init_mem;
+}
+
+/** Chooses the grid of blocks and the initial memory allocation per block to
+ * use, based on the histogram of the stored particles. Unlike guess_optimal,
+ * this takes into account the variations in the density of the particles.
+ * \param[out] (nx,ny,nz) the number of blocks to use.
+ * \param[out] init_mem the initial memory allocation per block to use. */
+void pre_container_base::auto_tune(int &nx,int &ny,int &nz,int &init_mem) {
+	std::vector<grid_candidate> gc;
+	rank_grids(gc);
+	choose_grid(gc,nx,ny,nz,init_mem);
+}
+
+/** Measures the time to compute a sample of the Voronoi cells using each of a
+ * list of grids, by setting up a temporary container for each one. The
+ * measured time per cell replaces the predicted time of each grid.
+ * \param[in] pc the pre-container, used to set up the temporary containers.
+ * \param[in,out] gc the grids to measure, which are sorted by their measured
+ *		      time on exit.
+ * \param[in] samples the approximate number of cells to compute for each
+ *		      grid. */
+template<class c_class,class p_class>
+void pre_container_base::calibrate_grids(p_class &pc,std::vector<grid_candidate> &gc,int samples) {
+	voro_id st=samples>0?total_particles()/samples:1,k;
+	int n;
+	double t;
+	if(st<1) st=1;
+	for(unsigned int l=0;l<gc.size();l++) {
+		c_class con(ax,bx,ay,by,az,bz,gc[l].nx,gc[l].ny,gc[l].nz,xperiodic,yperiodic,zperiodic,gc[l].init_mem);
+		pc.setup(con);
+		voronoicell c(con);
+		c_loop_all vl(con);
+		k=n=0;t=voro_wtime();
+		if(vl.start()) do if(k++%st==0) {
+			con.compute_cell(c,vl);n++;
+		} while(vl.inc());
+		gc[l].time=n>0?(voro_wtime()-t)/n:0;
+	}
+	std::sort(gc.begin(),gc.end());
+}
+
 /** Stores a particle ID and position, allocating a new memory chunk if
  * necessary. For coordinate directions in which the container is not periodic,
  * the routine checks to make sure that the particle is within the container
  * bounds. If the particle is out of bounds, it is not stored.
  * \param[in] n the numerical ID of the inserted particle.
  * \param[in] (x,y,z) the position vector of the inserted particle. */
-void pre_container::put(int n,double x,double y,double z) {
+void pre_container::put(voro_id n,double x,double y,double z) {
 	if((xperiodic||(x>=ax&&x<=bx))&&(yperiodic||(y>=ay&&y<=by))&&(zperiodic||(z>=az&&z<=bz))) {
 		if(ch_id==e_id) new_chunk();
 		*(ch_id++)=n;
@@ -83,7 +261,7 @@ void pre_container::put(int n,double x,double y,double z) {
  * \param[in] n the numerical ID of the inserted particle.
  * \param[in] (x,y,z) the position vector of the inserted particle.
  * \param[in] r the radius of the particle. */
-void pre_container_poly::put(int n,double x,double y,double z,double r) {
+void pre_container_poly::put(voro_id n,double x,double y,double z,double r) {
 	if((xperiodic||(x>=ax&&x<=bx))&&(yperiodic||(y>=ay&&y<=by))&&(zperiodic||(z>=az&&z<=bz))) {
 		if(ch_id==e_id) new_chunk();
 		*(ch_id++)=n;
@@ -95,9 +273,17 @@ void pre_container_poly::put(int n,double x,double y,double z,double r) {
 }
 
 /** Transfers the particles stored within the class to a container class.
- * \param[in] con the container class to transfer to. */
-void pre_container::setup(container &con) {
-	int **c_id=pre_id,*idp,*ide,n;
+ * \param[in] con the container class to transfer to.
+ * \param[in] nt the number of threads to use (1 for serial, 0 or less for
+ *		 the OpenMP default). */
+void pre_container::setup(container &con,int nt) {
+#ifdef _OPENMP
+	if((nt=voro_threads(nt))>1) {
+		con.put_chunked(total_particles(),pre_id,pre_p,pre_container_chunk_size,nt,NULL);
+		return;
+	}
+#endif
+	voro_id **c_id=pre_id,*idp,*ide,n;
 	double **c_p=pre_p,*pp,x,y,z;
 	while(c_id<end_id) {
 		idp=*(c_id++);ide=idp+pre_container_chunk_size;
@@ -116,9 +302,17 @@ void pre_container::setup(container &con) {
 }
 
 /** Transfers the particles stored within the class to a container_poly class.
- * \param[in] con the container_poly class to transfer to. */
-void pre_container_poly::setup(container_poly &con) {
-	int **c_id=pre_id,*idp,*ide,n;
+ * \param[in] con the container_poly class to transfer to.
+ * \param[in] nt the number of threads to use (1 for serial, 0 or less for
+ *		 the OpenMP default). */
+void pre_container_poly::setup(container_poly &con,int nt) {
+#ifdef _OPENMP
+	if((nt=voro_threads(nt))>1) {
+		con.put_chunked(total_particles(),pre_id,pre_p,pre_container_chunk_size,nt,NULL);
+		return;
+	}
+#endif
+	voro_id **c_id=pre_id,*idp,*ide,n;
 	double **c_p=pre_p,*pp,x,y,z,r;
 	while(c_id<end_id) {
 		idp=*(c_id++);ide=idp+pre_container_chunk_size;
@@ -139,9 +333,17 @@ void pre_container_poly::setup(container_poly &con) {
 /** Transfers the particles stored within the class to a container class, also
  * recording the order in which particles were stored.
  * \param[in] vo the ordering class to use.
- * \param[in] con the container class to transfer to. */
-void pre_container::setup(particle_order &vo,container &con) {
-	int **c_id=pre_id,*idp,*ide,n;
+ * \param[in] con the container class to transfer to.
+ * \param[in] nt the number of threads to use (1 for serial, 0 or less for
+ *		 the OpenMP default). */
+void pre_container::setup(particle_order &vo,container &con,int nt) {
+#ifdef _OPENMP
+	if((nt=voro_threads(nt))>1) {
+		con.put_chunked(total_particles(),pre_id,pre_p,pre_container_chunk_size,nt,&vo);
+		return;
+	}
+#endif
+	voro_id **c_id=pre_id,*idp,*ide,n;
 	double **c_p=pre_p,*pp,x,y,z;
 	while(c_id<end_id) {
 		idp=*(c_id++);ide=idp+pre_container_chunk_size;
@@ -159,12 +361,39 @@ void pre_container::setup(particle_order &vo,container &con) {
 	}
 }
 
+/** Chooses the grid of blocks and the initial memory allocation per block to
+ * use. The grids that are predicted to be fastest by the auto-tuner are set up,
+ * and the time to compute a sample of the Voronoi cells is measured for each
+ * one. Out of the grids whose measured time is within the tune_time_margin
+ * factor of the fastest, the one with the smallest predicted memory is chosen.
+ * \param[out] (nx,ny,nz) the number of blocks to use.
+ * \param[out] init_mem the initial memory allocation per block to use.
+ * \param[in] samples the approximate number of cells to compute for each
+ *		      grid.
+ * \param[in] ncand the number of grids to measure. */
+void pre_container::calibrate(int &nx,int &ny,int &nz,int &init_mem,int samples,int ncand) {
+	std::vector<grid_candidate> gc;
+	rank_grids(gc);
+	if(ncand<1) ncand=1;
+	if(ncand<int(gc.size())) gc.resize(ncand);
+	calibrate_grids<container>(*this,gc,samples);
+	choose_grid(gc,nx,ny,nz,init_mem);
+}
+
 /** Transfers the particles stored within the class to a container_poly class,
  * also recording the order in which particles were stored.
  * \param[in] vo the ordering class to use.
- * \param[in] con the container_poly class to transfer to. */
-void pre_container_poly::setup(particle_order &vo,container_poly &con) {
-	int **c_id=pre_id,*idp,*ide,n;
+ * \param[in] con the container_poly class to transfer to.
+ * \param[in] nt the number of threads to use (1 for serial, 0 or less for
+ *		 the OpenMP default). */
+void pre_container_poly::setup(particle_order &vo,container_poly &con,int nt) {
+#ifdef _OPENMP
+	if((nt=voro_threads(nt))>1) {
+		con.put_chunked(total_particles(),pre_id,pre_p,pre_container_chunk_size,nt,&vo);
+		return;
+	}
+#endif
+	voro_id **c_id=pre_id,*idp,*ide,n;
 	double **c_p=pre_p,*pp,x,y,z,r;
 	while(c_id<end_id) {
 		idp=*(c_id++);ide=idp+pre_container_chunk_size;
@@ -182,35 +411,79 @@ void pre_container_poly::setup(particle_order &vo,container_poly &con) {
 	}
 }
 
+/** Chooses the grid of blocks and the initial memory allocation per block to
+ * use. The grids that are predicted to be fastest by the auto-tuner are set up,
+ * and the time to compute a sample of the Voronoi cells is measured for each
+ * one. Out of the grids whose measured time is within the tune_time_margin
+ * factor of the fastest, the one with the smallest predicted memory is chosen.
+ * \param[out] (nx,ny,nz) the number of blocks to use.
+ * \param[out] init_mem the initial memory allocation per block to use.
+ * \param[in] samples the approximate number of cells to compute for each
+ *		      grid.
+ * \param[in] ncand the number of grids to measure. */
+void pre_container_poly::calibrate(int &nx,int &ny,int &nz,int &init_mem,int samples,int ncand) {
+	std::vector<grid_candidate> gc;
+	rank_grids(gc);
+	if(ncand<1) ncand=1;
+	if(ncand<int(gc.size())) gc.resize(ncand);
+	calibrate_grids<container_poly>(*this,gc,samples);
+	choose_grid(gc,nx,ny,nz,init_mem);
+}
+
 /** Import a list of particles from an open file stream into the container.
  * Entries of four numbers (Particle ID, x position, y position, z position)
  * are searched for. If the file cannot be successfully read, then the routine
  * causes a fatal error.
- * \param[in] fp the file handle to read from. */
-void pre_container::import(FILE *fp) {
-	int i,j;
+ * \param[in] fp the file handle to read from.
+ * \param[in] nt the number of threads to use to parse the file. */
+void pre_container::import(FILE *fp,int nt) {
+	text_reader tr(fp,3,nt);
+	while(tr.next()) for(unsigned int i=0;i<tr.id.size();i++)
+		put(tr.id[i],tr.v[3*i],tr.v[3*i+1],tr.v[3*i+2]);
+}
+
+/** Imports a list of particles from a binary particle file into the
+ * pre_container. The file is mapped into memory and each record is passed to put(). Any
+ * radii that are stored in the file are ignored. If the file cannot be read,
+ * then the routine causes a fatal error.
+ * \param[in] filename the name of the file to read. */
+void pre_container::import_binary(const char *filename) {
+	particle_file pf(filename);
+	int i,n;
 	double x,y,z;
-	while((j=fscanf(fp,"%d %lg %lg %lg",&i,&x,&y,&z))==4) put(i,x,y,z);
-	if(j!=EOF) voro_fatal_error("File import error",VOROPP_FILE_ERROR);
+	for(i=0;i<pf.n;i++) {pf.get(i,n,x,y,z);put(n,x,y,z);}
 }
 
 /** Import a list of particles from an open file stream, also storing the order
  * of that the particles are read. Entries of four numbers (Particle ID, x
  * position, y position, z position) are searched for. If the file cannot be
  * successfully read, then the routine causes a fatal error.
- * \param[in] fp the file handle to read from. */
-void pre_container_poly::import(FILE *fp) {
-	int i,j;
+ * \param[in] fp the file handle to read from.
+ * \param[in] nt the number of threads to use to parse the file. */
+void pre_container_poly::import(FILE *fp,int nt) {
+	text_reader tr(fp,4,nt);
+	while(tr.next()) for(unsigned int i=0;i<tr.id.size();i++)
+		put(tr.id[i],tr.v[4*i],tr.v[4*i+1],tr.v[4*i+2],tr.v[4*i+3]);
+}
+
+/** Imports a list of particles from a binary particle file into the
+ * pre_container_poly. The file is mapped into memory and each record is passed to put(). If the
+ * file cannot be read or does not contain the particle radii, then the
+ * routine causes a fatal error.
+ * \param[in] filename the name of the file to read. */
+void pre_container_poly::import_binary(const char *filename) {
+	particle_file pf(filename);
+	if(!pf.radii) voro_fatal_error("Binary particle file has no radii",VOROPP_FILE_ERROR);
+	int i,n;
 	double x,y,z,r;
-	while((j=fscanf(fp,"%d %lg %lg %lg %lg",&i,&x,&y,&z,&r))==5) put(i,x,y,z,r);
-	if(j!=EOF) voro_fatal_error("File import error",VOROPP_FILE_ERROR);
+	for(i=0;i<pf.n;i++) {pf.get(i,n,x,y,z,r);put(n,x,y,z,r);}
 }
 
 /** Allocates a new chunk of memory for storing particles. */
 void pre_container_base::new_chunk() {
 	end_id++;end_p++;
 	if(end_id==l_id) extend_chunk_index();
-	ch_id=*end_id=new int[pre_container_chunk_size];
+	ch_id=*end_id=new voro_id[pre_container_chunk_size];
 	e_id=ch_id+pre_container_chunk_size;
 	ch_p=*end_p=new double[ps*pre_container_chunk_size];
 }
@@ -223,7 +496,7 @@ void pre_container_base::extend_chunk_index() {
 #if VOROPP_VERBOSE >=2
 	fprintf(stderr,"Pre-container chunk index scaled up to %d\n",index_sz);
 #endif
-	int **n_id=new int*[index_sz],**p_id=n_id,**c_id=pre_id;
+	voro_id **n_id=new voro_id*[index_sz],**p_id=n_id,**c_id=pre_id;
 	double **n_p=new double*[index_sz],**p_p=n_p,**c_p=pre_p;
 	while(c_id<end_id) {
 		*(p_id++)=*(c_id++);
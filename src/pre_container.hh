@@ -11,12 +11,38 @@
 #define VOROPP_PRE_CONTAINER_HH
 
 #include <cstdio>
+#include <vector>
 
 #include "c_loops.hh"
 #include "container.hh"
 
 namespace voro {
 
+/** \brief A record of a candidate grid that is considered by the grid
+ * auto-tuner. */
+struct grid_candidate {
+	/** The number of blocks in the x direction. */
+	int nx;
+	/** The number of blocks in the y direction. */
+	int ny;
+	/** The number of blocks in the z direction. */
+	int nz;
+	/** The initial memory allocation per block that minimizes the
+	 * predicted memory. */
+	int init_mem;
+	/** The predicted time to compute all of the Voronoi cells, in
+	 * arbitrary units, or the measured time per cell if the grid has been
+	 * calibrated. */
+	double time;
+	/** The predicted memory used to store the particles, in bytes. */
+	double mem;
+	/** Compares two candidates, so that they can be sorted by their
+	 * time.
+	 * \param[in] o the candidate to compare with.
+	 * \return True if this candidate is faster, false otherwise. */
+	inline bool operator<(const grid_candidate &o) const {return time<o.time;}
+};
+
 /** \brief A class for storing an arbitrary number of particles, prior to setting
  * up a container geometry.
  *
@@ -52,13 +78,15 @@ class pre_container_base {
 		 * periodic or not. */
 		const bool zperiodic;
 		void guess_optimal(int &nx,int &ny,int &nz);
+		void rank_grids(std::vector<grid_candidate> &gc);
+		void auto_tune(int &nx,int &ny,int &nz,int &init_mem);
 		pre_container_base(double ax_,double bx_,double ay_,double by_,double az_,double bz_,bool xperiodic_,bool yperiodic_,bool zperiodic_,int ps_);
 		~pre_container_base();
 		/** Calculates and returns the total number of particles stored
 		 * within the class.
 		 * \return The number of particles. */
-		inline int total_particles() {
-			return (end_id-pre_id)*pre_container_chunk_size+(ch_id-*end_id);
+		inline voro_id total_particles() {
+			return voro_id(end_id-pre_id)*pre_container_chunk_size+(ch_id-*end_id);
 		}
 	protected:
 		/** The number of doubles associated with a single particle
@@ -66,22 +94,25 @@ class pre_container_base {
 		 * information is stored). */
 		const int ps;
 		void new_chunk();
+		void choose_grid(std::vector<grid_candidate> &gc,int &nx,int &ny,int &nz,int &init_mem);
+		template<class c_class,class p_class>
+		void calibrate_grids(p_class &pc,std::vector<grid_candidate> &gc,int samples);
 		void extend_chunk_index();
 		/** The size of the chunk index. */
 		int index_sz;
 		/** A pointer to the chunk index to store the integer particle
 		 * IDs. */
-		int **pre_id;
+		voro_id **pre_id;
 		/** A pointer to the last allocated integer ID chunk. */
-		int **end_id;
+		voro_id **end_id;
 		/** A pointer to the end of the integer ID chunk index, used to
 		 * determine when the chunk index is full. */
-		int **l_id;
+		voro_id **l_id;
 		/** A pointer to the next available slot on the current
 		 * particle ID chunk. */
-		int *ch_id;
+		voro_id *ch_id;
 		/** A pointer to the end of the current integer chunk. */
-		int *e_id;
+		voro_id *e_id;
 		/** A pointer to the chunk index to store the floating point
 		 * information associated with particles. */
 		double **pre_p;
@@ -112,17 +143,21 @@ class pre_container : public pre_container_base {
 		pre_container(double ax_,double bx_,double ay_,double by_,double az_,double bz_,
 				bool xperiodic_,bool yperiodic_,bool zperiodic_)
 			: pre_container_base(ax_,bx_,ay_,by_,az_,bz_,xperiodic_,yperiodic_,zperiodic_,3) {};
-		void put(int n,double x,double y,double z);
-		void import(FILE *fp=stdin);
+		void put(voro_id n,double x,double y,double z);
+		void import(FILE *fp=stdin,int nt=1);
+		void import_binary(const char *filename);
 		/** Imports particles from a file.
-		 * \param[in] filename the name of the file to read from. */
-		inline void import(const char* filename) {
+		 * \param[in] filename the name of the file to read from.
+		 * \param[in] nt the number of threads to use to parse
+		 *               the file. */
+		inline void import(const char* filename,int nt=1) {
 			FILE *fp=safe_fopen(filename,"r");
-			import(fp);
+			import(fp,nt);
 			fclose(fp);
 		}
-		void setup(container &con);
-		void setup(particle_order &vo,container &con);
+		void setup(container &con,int nt=1);
+		void setup(particle_order &vo,container &con,int nt=1);
+		void calibrate(int &nx,int &ny,int &nz,int &init_mem,int samples=1000,int ncand=3);
 };
 
 /** \brief A class for storing an arbitrary number of particles with radius
@@ -144,17 +179,21 @@ class pre_container_poly : public pre_container_base {
 		pre_container_poly(double ax_,double bx_,double ay_,double by_,double az_,double bz_,
 				bool xperiodic_,bool yperiodic_,bool zperiodic_)
 			: pre_container_base(ax_,bx_,ay_,by_,az_,bz_,xperiodic_,yperiodic_,zperiodic_,4) {};
-		void put(int n,double x,double y,double z,double r);
-		void import(FILE *fp=stdin);
+		void put(voro_id n,double x,double y,double z,double r);
+		void import(FILE *fp=stdin,int nt=1);
+		void import_binary(const char *filename);
 		/** Imports particles from a file.
-		 * \param[in] filename the name of the file to read from. */
-		inline void import(const char* filename) {
+		 * \param[in] filename the name of the file to read from.
+		 * \param[in] nt the number of threads to use to parse
+		 *               the file. */
+		inline void import(const char* filename,int nt=1) {
 			FILE *fp=safe_fopen(filename,"r");
-			import(fp);
+			import(fp,nt);
 			fclose(fp);
 		}
-		void setup(container_poly &con);
-		void setup(particle_order &vo,container_poly &con);
+		void setup(container_poly &con,int nt=1);
+		void setup(particle_order &vo,container_poly &con,int nt=1);
+		void calibrate(int &nx,int &ny,int &nz,int &init_mem,int samples=1000,int ncand=3);
 };
 
 }
@@ -0,0 +1,77 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file query.hh
+ * \brief Header file for the cell_query_engine class. */
+
+#ifndef VOROPP_QUERY_HH
+#define VOROPP_QUERY_HH
+
+#include "config.hh"
+#include "cell.hh"
+
+namespace voro {
+
+/** \brief A class for evaluating cell_query descriptors on the particles in a
+ * container.
+ *
+ * This class holds a plain Voronoi cell and a Voronoi cell with neighbor
+ * information. Since the neighbor tracking adds bookkeeping to every plane
+ * cut, the plain cell is used unless the query asks for the neighbor list, and
+ * all of the other quantities are then found in a single traversal of the
+ * faces by voronoicell_base::evaluate().
+ * \tparam c_class the type of the container, which can be any of the container
+ *		   classes. */
+template<class c_class>
+class cell_query_engine {
+	public:
+		/** A reference to the container that holds the particles. */
+		c_class &con;
+		/** Initializes the engine for a container.
+		 * \param[in] con_ a reference to the container. */
+		cell_query_engine(c_class &con_) : con(con_), c(con_), cn(con_) {}
+		/** Computes the Voronoi cell of a particle and evaluates a
+		 * query on it.
+		 * \param[in] (ijk,q) the block that the particle is within, and
+		 *                    its index within the block.
+		 * \param[in,out] qr the query, in which the results are
+		 *		     stored.
+		 * \return True if the cell was computed, false if it was
+		 *         removed entirely by walls. */
+		bool compute(int ijk,int q,cell_query &qr) {
+			if(qr.mask&query_neighbors) {
+				if(!con.compute_cell(cn,ijk,q)) return false;
+				cn.neighbors(qr.neighbors);
+				cn.evaluate(qr);
+			} else {
+				if(!con.compute_cell(c,ijk,q)) return false;
+				c.evaluate(qr);
+			}
+			return true;
+		}
+		/** Computes the Voronoi cell of the particle that a loop class
+		 * is currently pointing at, and evaluates a query on it.
+		 * \param[in] vl the loop class to use.
+		 * \param[in,out] qr the query, in which the results are
+		 *		     stored.
+		 * \return True if the cell was computed, false if it was
+		 *         removed entirely by walls. */
+		template<class c_loop>
+		inline bool compute(c_loop &vl,cell_query &qr) {
+			return compute(vl.ijk,vl.q,qr);
+		}
+	private:
+		/** A Voronoi cell used for queries without neighbor
+		 * information. */
+		voronoicell c;
+		/** A Voronoi cell used for queries that need the neighbor
+		 * list. */
+		voronoicell_neighbor cn;
+};
+
+}
+
+#endif
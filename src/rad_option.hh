@@ -22,26 +22,43 @@ namespace voro {
  * and during the Voronoi cell computation, these routines are used to create
  * the regular Voronoi tessellation. */
 class radius_mono {
+	public:
+		/** Whether the voro_compute template should bound the radii
+		 * near each cell by the largest radius in the neighborhood of
+		 * its block. This is not needed for the regular Voronoi
+		 * tessellation. */
+		static const bool r_block_bound=false;
 	protected:
 		/** This is called prior to computing a Voronoi cell for a
 		 * given particle to initialize any required constants.
 		 * \param[in] ijk the block that the particle is within.
-		 * \param[in] s the index of the particle within the block. */
-		inline void r_init(int ijk,int s) {}
+		 * \param[in] s the index of the particle within the block.
+		 * \param[out] (r_rad,r_mul) the constants to initialize. */
+		inline void r_init(int ijk,int s,double &r_rad,double &r_mul) {}
+		/** This is called prior to computing a Voronoi cell for a
+		 * ghost particle to initialize any required constants.
+		 * \param[in] r the radius of the ghost particle.
+		 * \param[out] (r_rad,r_mul) the constants to initialize. */
+		inline void r_init(double r,double &r_rad,double &r_mul) {}
 		/** Sets a required constant to be used when carrying out a
-		 * plane bounds check. */
-		inline void r_prime(double rv) {}
+		 * plane bounds check.
+		 * \param[in] rv the value to prime with.
+		 * \param[in] r_mul a constant set by r_init.
+		 * \param[out] r_val the constant to set. */
+		inline void r_prime(double rv,double r_mul,double &r_val) {}
 		/** Carries out a radius bounds check.
 		 * \param[in] crs the radius squared to be tested.
 		 * \param[in] mrs the current maximum distance to a Voronoi
 		 *                vertex multiplied by two.
+		 * \param[in] r_mul a constant set by r_init.
 		 * \return True if particles at this radius could not possibly
 		 * cut the cell, false otherwise. */
-		inline bool r_ctest(double crs,double mrs) {return crs>mrs;}
+		inline bool r_ctest(double crs,double mrs,double r_mul) {return crs>mrs;}
 		/** Scales a plane displacement during a plane bounds check.
 		 * \param[in] lrs the plane displacement.
+		 * \param[in] r_val a constant set by r_prime.
 		 * \return The scaled value. */
-		inline double r_cutoff(double lrs) {return lrs;}
+		inline double r_cutoff(double lrs,double r_val) {return lrs;}
 		/** Adds the maximum radius squared to a given value.
 		 * \param[in] rs the value to consider.
 		 * \return The value with the radius squared added. */
@@ -58,8 +75,9 @@ class radius_mono {
 		 * \param[in] rs the initial plane displacement.
 		 * \param[in] ijk the block that the particle is within.
 		 * \param[in] q the index of the particle within the block.
+		 * \param[in] r_rad a constant set by r_init.
 		 * \return The scaled plane displacement. */
-		inline double r_scale(double rs,int ijk,int q) {return rs;}
+		inline double r_scale(double rs,int ijk,int q,double r_rad) {return rs;}
 		/** Scales a plane displacement prior to use in the plane
 		 * cutting algorithm, and also checks if it could possibly cut
 		 * the cell.
@@ -68,9 +86,15 @@ class radius_mono {
 		 *                vertex multiplied by two.
 		 * \param[in] ijk the block that the particle is within.
 		 * \param[in] q the index of the particle within the block.
+		 * \param[in] r_rad a constant set by r_init.
 		 * \return True if the cell could possibly cut the cell, false
 		 * otherwise. */
-		inline bool r_scale_check(double &rs,double mrs,int ijk,int q) {return rs<mrs;}
+		inline bool r_scale_check(double &rs,double mrs,int ijk,int q,double r_rad) {return rs<mrs;}
+		/** Computes the largest particle radius in a block.
+		 * \param[in] ijk the block to consider.
+		 * \param[in] n the number of particles in the block.
+		 * \return The largest radius, which is always zero here. */
+		inline double r_block_max(int ijk,int n) {return 0;}
 };
 
 /**  \brief Class containing all of the routines that are specific to computing
@@ -78,15 +102,23 @@ class radius_mono {
  *
  * The container_poly and container_periodic_poly classes are derived from this
  * class, and during the Voronoi cell computation, these routines are used to
- * create the radical Voronoi tessellation. */
+ * create the radical Voronoi tessellation. The constants that depend on the
+ * particle whose cell is being computed are passed in by reference, so that
+ * the class itself is not modified during the computation. */
 class radius_poly {
 	public:
 		/** A two-dimensional array holding particle positions and radii. */
-		double **ppr;
+		fpoint **ppr;
 		/** The current maximum radius of any particle, used to
 		 * determine when to cut off the radical Voronoi computation.
 		 * */
 		double max_radius;
+		/** Whether the voro_compute template should bound the radii
+		 * near each cell by the largest radius in the neighborhood of
+		 * its block. For widely varying radii this is much smaller
+		 * than max_radius in most places, so that the cell searches
+		 * can stop sooner. */
+		static const bool r_block_bound=true;
 		/** The class constructor sets the maximum particle radius to
 		 * be zero. */
 		radius_poly() : max_radius(0) {}
@@ -94,25 +126,39 @@ class radius_poly {
 		/** This is called prior to computing a Voronoi cell for a
 		 * given particle to initialize any required constants.
 		 * \param[in] ijk the block that the particle is within.
-		 * \param[in] s the index of the particle within the block. */
-		inline void r_init(int ijk,int s) {
+		 * \param[in] s the index of the particle within the block.
+		 * \param[out] (r_rad,r_mul) the constants to initialize. */
+		inline void r_init(int ijk,int s,double &r_rad,double &r_mul) {
 			r_rad=ppr[ijk][4*s+3]*ppr[ijk][4*s+3];
 			r_mul=r_rad-max_radius*max_radius;
 		}
+		/** This is called prior to computing a Voronoi cell for a
+		 * ghost particle to initialize any required constants.
+		 * \param[in] r the radius of the ghost particle.
+		 * \param[out] (r_rad,r_mul) the constants to initialize. */
+		inline void r_init(double r,double &r_rad,double &r_mul) {
+			r_rad=r*r;
+			r_mul=r_rad-max_radius*max_radius;
+		}
 		/** Sets a required constant to be used when carrying out a
-		 * plane bounds check. */
-		inline void r_prime(double rv) {r_val=1+r_mul/rv;}
+		 * plane bounds check.
+		 * \param[in] rv the value to prime with.
+		 * \param[in] r_mul a constant set by r_init.
+		 * \param[out] r_val the constant to set. */
+		inline void r_prime(double rv,double r_mul,double &r_val) {r_val=1+r_mul/rv;}
 		/** Carries out a radius bounds check.
 		 * \param[in] crs the radius squared to be tested.
 		 * \param[in] mrs the current maximum distance to a Voronoi
 		 *                vertex multiplied by two.
+		 * \param[in] r_mul a constant set by r_init.
 		 * \return True if particles at this radius could not possibly
 		 * cut the cell, false otherwise. */
-		inline bool r_ctest(double crs,double mrs) {return crs+r_mul>sqrt(mrs*crs);}
+		inline bool r_ctest(double crs,double mrs,double r_mul) {return crs+r_mul>sqrt(mrs*crs);}
 		/** Scales a plane displacement during a plane bounds check.
 		 * \param[in] lrs the plane displacement.
+		 * \param[in] r_val a constant set by r_prime.
 		 * \return The scaled value. */
-		inline double r_cutoff(double lrs) {return lrs*r_val;}
+		inline double r_cutoff(double lrs,double r_val) {return lrs*r_val;}
 		/** Adds the maximum radius squared to a given value.
 		 * \param[in] rs the value to consider.
 		 * \return The value with the radius squared added. */
@@ -131,8 +177,9 @@ class radius_poly {
 		 * \param[in] rs the initial plane displacement.
 		 * \param[in] ijk the block that the particle is within.
 		 * \param[in] q the index of the particle within the block.
+		 * \param[in] r_rad a constant set by r_init.
 		 * \return The scaled plane displacement. */
-		inline double r_scale(double rs,int ijk,int q) {
+		inline double r_scale(double rs,int ijk,int q,double r_rad) {
 			return rs+r_rad-ppr[ijk][4*q+3]*ppr[ijk][4*q+3];
 		}
 		/** Scales a plane displacement prior to use in the plane
@@ -143,15 +190,23 @@ class radius_poly {
 		 *                vertex multiplied by two.
 		 * \param[in] ijk the block that the particle is within.
 		 * \param[in] q the index of the particle within the block.
+		 * \param[in] r_rad a constant set by r_init.
 		 * \return True if the cell could possibly cut the cell, false
 		 * otherwise. */
-		inline bool r_scale_check(double &rs,double mrs,int ijk,int q) {
+		inline bool r_scale_check(double &rs,double mrs,int ijk,int q,double r_rad) {
 			double trs=rs;
 			rs+=r_rad-ppr[ijk][4*q+3]*ppr[ijk][4*q+3];
 			return rs<sqrt(mrs*trs);
 		}
-	private:
-		double r_rad,r_mul,r_val;
+		/** Computes the largest particle radius in a block.
+		 * \param[in] ijk the block to consider.
+		 * \param[in] n the number of particles in the block.
+		 * \return The largest radius. */
+		inline double r_block_max(int ijk,int n) {
+			double bmr=0;
+			for(fpoint *pp=ppr[ijk]+3,*pe=pp+4*n;pp<pe;pp+=4) if(*pp>bmr) bmr=*pp;
+			return bmr;
+		}
 };
 
 }
@@ -0,0 +1,236 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file shm_ring.cc
+ * \brief Function implementations for the shared memory ring buffer classes. */
+
+#include <cstdio>
+#include <cstdlib>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "shm_ring.hh"
+
+namespace voro {
+
+/** Rounds a length up to a multiple of eight bytes.
+ * \param[in] l the length.
+ * \return The rounded length. */
+static inline size_t ring_pad(size_t l) {return (l+7)&~size_t(7);}
+
+/** Rounds a capacity up to a power of two, which is at least 4096 bytes.
+ * \param[in] l the capacity.
+ * \return The rounded capacity. */
+static size_t ring_capacity(size_t l) {
+	size_t c=4096;
+	while(c<l) c<<=1;
+	return c;
+}
+
+/** Maps a ring buffer file into memory.
+ * \param[in] filename the name of the file.
+ * \param[in] create whether to create the file, with a given size.
+ * \param[in,out] size the size of the file, which is set if the file is not
+ *		       created.
+ * \return A pointer to the mapped memory. */
+static char* ring_map(const char *filename,bool create,size_t &size) {
+#ifdef _WIN32
+	voro_fatal_error("Shared memory ring buffers are not supported on this system",VOROPP_FILE_ERROR);
+	return NULL;
+#else
+	int fd=create?open(filename,O_RDWR|O_CREAT|O_TRUNC,0644):open(filename,O_RDONLY);
+	if(fd<0) {
+		fprintf(stderr,"voro++: Unable to open file '%s'\n",filename);
+		exit(VOROPP_FILE_ERROR);
+	}
+	if(create) {
+		if(ftruncate(fd,size)!=0) {
+			::close(fd);
+			voro_fatal_error("Unable to set the size of the ring buffer",VOROPP_FILE_ERROR);
+		}
+	} else {
+		struct stat st;
+		if(fstat(fd,&st)!=0||size_t(st.st_size)<size_t(shm_ring_header_size)) {
+			::close(fd);
+			voro_fatal_error("Ring buffer file is too short",VOROPP_FILE_ERROR);
+		}
+		size=st.st_size;
+	}
+	void *mp=mmap(NULL,size,create?PROT_READ|PROT_WRITE:PROT_READ,MAP_SHARED,fd,0);
+	::close(fd);
+	if(mp==MAP_FAILED) voro_fatal_error("Unable to map ring buffer into memory",VOROPP_FILE_ERROR);
+	return static_cast<char*>(mp);
+#endif
+}
+
+/** The class constructor creates a ring buffer file and maps it into memory.
+ * Any existing file with the same name is replaced.
+ * \param[in] filename the name of the file, which is normally in a shared
+ *		       memory filesystem such as /dev/shm.
+ * \param[in] capacity_ the capacity of the data area in bytes, which is
+ *			rounded up to a power of two. */
+shm_ring::shm_ring(const char *filename,size_t capacity_)
+	: capacity(ring_capacity(capacity_)), size(shm_ring_header_size+capacity) {
+	char *mp=ring_map(filename,true,size);
+	hd=reinterpret_cast<shm_ring_header*>(mp);
+	data=mp+shm_ring_header_size;
+	memcpy(hd->magic,"VORO++RB",8);
+	hd->version=shm_ring_version;
+	hd->id_size=sizeof(voro_id);
+	hd->capacity=capacity;
+	hd->head=hd->reserve=0;
+	hd->closed=0;
+	shm_ring_fence();
+}
+
+/** The class destructor marks the ring buffer as finished and unmaps it. The
+ * file is left in place, so that the readers can finish reading it, and must
+ * be removed by the caller. */
+shm_ring::~shm_ring() {
+	close();
+#ifndef _WIN32
+	munmap(reinterpret_cast<char*>(hd),size);
+#endif
+}
+
+/** Adds a record to the ring buffer. If the record does not fit before the end
+ * of the data area, then the rest of the data area is filled with a padding
+ * record, and the record is written at the start. Since the gap may be only
+ * eight bytes long, the padding record is just given its length and type. The reserve position is
+ * advanced before any data is overwritten, and the write position is advanced
+ * once the record is complete, so that a reader can tell if a record it has
+ * copied was being overwritten.
+ * \param[in] rec a pointer to the record.
+ * \param[in] len the length of the record in bytes, which must be a multiple of
+ *		  eight. */
+void shm_ring::put(const char *rec,size_t len) {
+	if(len>(capacity>>2)) voro_fatal_error("Record is too large for the ring buffer",VOROPP_MEMORY_ERROR);
+	size_t h=hd->head,o=h&(capacity-1);
+	if(o+len>capacity) {
+		size_t pl=capacity-o;
+		hd->reserve=h+pl+len;
+		shm_ring_fence();
+		unsigned int *up=reinterpret_cast<unsigned int*>(data+o);
+		*up=pl;up[1]=shm_ring_pad;
+		h+=pl;o=0;
+	} else {
+		hd->reserve=h+len;
+		shm_ring_fence();
+	}
+	memcpy(data+o,rec,len);
+	shm_ring_fence();
+	hd->head=h+len;
+}
+
+/** Marks the ring buffer as finished, so that the readers can tell that no
+ * more records will be added. */
+void shm_ring::close() {
+	shm_ring_fence();
+	hd->closed=1;
+}
+
+/** The class constructor maps an existing ring buffer file into memory, and
+ * checks its header. If the file was not made by this version of the library,
+ * or uses a different particle ID size, then a fatal error is caused with the
+ * VOROPP_FILE_ERROR status.
+ * \param[in] filename the name of the file. */
+shm_ring_reader::shm_ring_reader(const char *filename) : overruns(0), size(0) {
+	char *mp=ring_map(filename,false,size);
+	hd=reinterpret_cast<shm_ring_header*>(mp);
+	data=mp+shm_ring_header_size;
+	cap=hd->capacity;
+	if(memcmp(hd->magic,"VORO++RB",8)!=0||hd->version!=shm_ring_version||hd->id_size!=sizeof(voro_id)
+	   ||size<shm_ring_header_size+cap||(cap&(cap-1))!=0)
+		voro_fatal_error("Invalid ring buffer file",VOROPP_FILE_ERROR);
+	rp=hd->head;
+}
+
+/** The class destructor unmaps the ring buffer. */
+shm_ring_reader::~shm_ring_reader() {
+#ifndef _WIN32
+	munmap(reinterpret_cast<char*>(hd),size);
+#endif
+}
+
+/** Reads the next cell record from the ring buffer, if one is available. The
+ * record is copied before it is decoded, and it is discarded if the writer
+ * reserved its space while it was being copied. In that case, or if the reader
+ * has fallen more than the capacity behind, the reader skips to the current
+ * write position and the overrun counter is increased.
+ * \param[out] rc the record to fill in.
+ * \return True if a record was read, false if no more records are available
+ *	   yet. */
+bool shm_ring_reader::next(ring_cell &rc) {
+	size_t h,o,len;
+	unsigned int *up;
+	while(true) {
+		h=hd->head;
+		shm_ring_fence();
+		if(rp==h) return false;
+		if(h-rp>cap) {overruns++;rp=h;continue;}
+
+		// Copy the record, checking that its length is plausible
+		o=rp&(cap-1);
+		len=*reinterpret_cast<const unsigned int*>(data+o);
+		if(len<8||(len&7)!=0||len>cap-o||len>h-rp) {overruns++;rp=hd->head;continue;}
+		buf.resize(len);
+		memcpy(&buf[0],data+o,len);
+		shm_ring_fence();
+		if(hd->reserve-rp>cap) {overruns++;rp=hd->head;continue;}
+		rp+=len;
+
+		// Skip padding, and decode a cell record
+		up=reinterpret_cast<unsigned int*>(&buf[0]);
+		if(up[1]!=shm_ring_cell) continue;
+		if(len<16) {overruns++;continue;}
+		size_t nn=up[2],nv=up[3],l=16+ring_pad(sizeof(voro_id));
+		if(len!=l+4*sizeof(double)+ring_pad(nn*sizeof(voro_id))+3*nv*sizeof(double)) {overruns++;continue;}
+		const char *cp=&buf[0];
+		memcpy(&rc.id,cp+16,sizeof(voro_id));
+		const double *dp=reinterpret_cast<const double*>(cp+l);
+		rc.x=*dp;rc.y=dp[1];rc.z=dp[2];rc.volume=dp[3];
+		l+=4*sizeof(double);
+		rc.neighbors.resize(nn);
+		if(nn>0) memcpy(&rc.neighbors[0],cp+l,nn*sizeof(voro_id));
+		l+=ring_pad(nn*sizeof(voro_id));
+		rc.vertices.resize(3*nv);
+		if(nv>0) memcpy(&rc.vertices[0],cp+l,3*nv*sizeof(double));
+		return true;
+	}
+}
+
+/** Builds a cell record in a thread's buffer, and adds it to the ring buffer.
+ * \param[in] b the buffer of the thread, holding the neighbors and vertices of
+ *		the cell.
+ * \param[in] id the ID of the particle.
+ * \param[in] (x,y,z) the position of the particle.
+ * \param[in] vol the volume of the cell. */
+void ring_output::write_record(thread_buffer &b,voro_id id,double x,double y,double z,double vol) {
+	size_t nn=b.vn.size(),nv=b.vv.size()/3,li=ring_pad(sizeof(voro_id)),ln=ring_pad(nn*sizeof(voro_id)),
+	       len=16+li+4*sizeof(double)+ln+3*nv*sizeof(double);
+	b.rec.assign(len,0);
+	char *cp=&b.rec[0];
+	unsigned int *up=reinterpret_cast<unsigned int*>(cp);
+	*up=len;up[1]=shm_ring_cell;up[2]=nn;up[3]=nv;
+	cp+=16;memcpy(cp,&id,sizeof(voro_id));
+	cp+=li;
+	double *dp=reinterpret_cast<double*>(cp);
+	*dp=x;dp[1]=y;dp[2]=z;dp[3]=vol;
+	cp+=4*sizeof(double);
+	if(nn>0) memcpy(cp,&b.vn[0],nn*sizeof(voro_id));
+	cp+=ln;
+	if(nv>0) memcpy(cp,&b.vv[0],3*nv*sizeof(double));
+#ifdef _OPENMP
+#pragma omp critical(voro_ring)
+#endif
+	ring.put(&b.rec[0],len);
+}
+
+}
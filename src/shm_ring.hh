@@ -0,0 +1,252 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file shm_ring.hh
+ * \brief Header file for the shared memory ring buffer classes, which pass
+ * Voronoi cell records to other processes as they are computed.
+ *
+ * The ring buffer is a file, normally in a shared memory filesystem such as
+ * /dev/shm, that is mapped into memory by the writing process and by any
+ * number of reading processes. It begins with a 64-byte header, made up of:
+ *  - the eight characters "VORO++RB",
+ *  - a 32-bit unsigned integer version number, which is currently 1,
+ *  - a 32-bit unsigned integer giving the size of a particle ID in bytes,
+ *  - a size_t giving the capacity of the data area in bytes, which is a power
+ *    of two,
+ *  - a size_t giving the write position, which is the total number of bytes
+ *    that have been published,
+ *  - a size_t giving the reserve position, up to which the writer may be
+ *    overwriting the data area,
+ *  - a 32-bit unsigned integer that is set to one once the writer has
+ *    finished.
+ *
+ * The data area follows, and holds records that are aligned to eight bytes.
+ * A byte position p in the stream is stored at offset p modulo the capacity.
+ * Each record begins with four 32-bit unsigned integers, giving the length of
+ * the record in bytes, its type, the number of neighbors, and the number of
+ * vertices. A record of type 0 is padding that fills the end of the data area
+ * when the next record does not fit, and should be skipped. Padding can be
+ * as short as eight bytes, in which case only its length and type are
+ * present. A record of type 1
+ * holds a cell, and continues with the particle ID, padded to eight bytes, the
+ * particle position and the cell volume as four doubles, the neighbor IDs,
+ * padded to eight bytes, and the vertex positions as three doubles each.
+ *
+ * The writer never waits for the readers. Each reader keeps its own position,
+ * so every reader sees every record, unless it falls more than the capacity
+ * behind the writer. In that case the records it missed are skipped, and the
+ * number of times that this happened is counted. All fields are in the native
+ * byte order of the machine. */
+
+#ifndef VOROPP_SHM_RING_HH
+#define VOROPP_SHM_RING_HH
+
+#include <cstring>
+#include <vector>
+
+#include "config.hh"
+#include "common.hh"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace voro {
+
+/** The version number of the ring buffer format. */
+const unsigned int shm_ring_version=1;
+/** The size of the header of a ring buffer, in bytes. */
+const int shm_ring_header_size=64;
+/** The record type of padding at the end of the data area. */
+const unsigned int shm_ring_pad=0;
+/** The record type of a Voronoi cell. */
+const unsigned int shm_ring_cell=1;
+
+/** \brief The header of a ring buffer, as it is laid out in the shared
+ * memory. */
+struct shm_ring_header {
+	/** The characters "VORO++RB". */
+	char magic[8];
+	/** The version number of the format. */
+	unsigned int version;
+	/** The size of a particle ID in bytes. */
+	unsigned int id_size;
+	/** The capacity of the data area in bytes. */
+	size_t capacity;
+	/** The number of bytes that have been published. */
+	volatile size_t head;
+	/** The position up to which the writer may be overwriting the data
+	 * area. */
+	volatile size_t reserve;
+	/** Set to one once the writer has finished. */
+	volatile unsigned int closed;
+};
+
+/** Makes sure that all of the memory accesses before this point are carried
+ * out before those after it, as seen by other processes sharing the memory. */
+inline void shm_ring_fence() {
+#ifdef __GNUC__
+	__sync_synchronize();
+#else
+#pragma omp flush
+#endif
+}
+
+/** \brief A class for writing Voronoi cell records to a ring buffer in shared
+ * memory.
+ *
+ * The class creates the ring buffer file, and adds records to it. Only one
+ * thread may add records at a time; the ring_output class can be used to
+ * write from several threads. */
+class shm_ring {
+	public:
+		/** The capacity of the data area in bytes. */
+		const size_t capacity;
+		shm_ring(const char *filename,size_t capacity_=shm_ring_default_size);
+		~shm_ring();
+		void put(const char *rec,size_t len);
+		void close();
+	private:
+		/** The size of the mapped file in bytes. */
+		size_t size;
+		/** A pointer to the header in the mapped memory. */
+		shm_ring_header *hd;
+		/** A pointer to the data area in the mapped memory. */
+		char *data;
+		/** The copy constructor is not available, since the class
+		 * owns the mapping. */
+		shm_ring(const shm_ring &r);
+		/** Assignment is not available, for the same reason as the
+		 * copy constructor. */
+		void operator=(const shm_ring &r);
+};
+
+/** \brief A Voronoi cell record that has been read from a ring buffer. */
+struct ring_cell {
+	/** The ID of the particle. */
+	voro_id id;
+	/** The x coordinate of the particle. */
+	double x;
+	/** The y coordinate of the particle. */
+	double y;
+	/** The z coordinate of the particle. */
+	double z;
+	/** The volume of the cell. */
+	double volume;
+	/** The IDs of the neighbors of the cell, which are empty if they were
+	 * not written. */
+	std::vector<voro_id> neighbors;
+	/** The positions of the vertices of the cell, as three doubles per
+	 * vertex, which are empty if they were not written. */
+	std::vector<double> vertices;
+};
+
+/** \brief A class for reading Voronoi cell records from a ring buffer in
+ * shared memory.
+ *
+ * The class maps an existing ring buffer file, and starts reading from the
+ * current write position, so that it receives the records that are written
+ * from then on. It never blocks the writer. */
+class shm_ring_reader {
+	public:
+		/** The number of times that the reader fell more than the
+		 * capacity behind the writer, and skipped to the current
+		 * write position. */
+		unsigned long overruns;
+		shm_ring_reader(const char *filename);
+		~shm_ring_reader();
+		bool next(ring_cell &rc);
+		/** Returns whether the writer has finished and all of its
+		 * records have been read, so that next() will not return any
+		 * more.
+		 * \return True if the stream has ended, false otherwise. */
+		inline bool done() {
+			bool cl=hd->closed!=0;
+			shm_ring_fence();
+			return cl&&rp==hd->head;
+		}
+	private:
+		/** The size of the mapped file in bytes. */
+		size_t size;
+		/** The capacity of the data area in bytes. */
+		size_t cap;
+		/** The position of the next record to read. */
+		size_t rp;
+		/** A pointer to the header in the mapped memory. */
+		shm_ring_header *hd;
+		/** A pointer to the data area in the mapped memory. */
+		const char *data;
+		/** A copy of the record being read, taken before it is
+		 * checked, so that the writer cannot alter it. */
+		std::vector<char> buf;
+		/** The copy constructor is not available, since the class
+		 * owns the mapping. */
+		shm_ring_reader(const shm_ring_reader &r);
+		/** Assignment is not available, for the same reason as the
+		 * copy constructor. */
+		void operator=(const shm_ring_reader &r);
+};
+
+/** \brief A function object for writing Voronoi cells to a ring buffer.
+ *
+ * The class can be passed to the for_each_cell() routines, with any loop class
+ * or execution policy. Each thread builds its records in its own buffer, and
+ * they are added to the ring buffer one at a time in a critical section. The
+ * neighbors are only written if the cells are computed with the
+ * voronoicell_neighbor class. */
+class ring_output {
+	public:
+		/** A reference to the ring buffer to write to. */
+		shm_ring &ring;
+		/** Whether to write the neighbors of the cells. */
+		const bool neighbors;
+		/** Whether to write the vertices of the cells. */
+		const bool vertices;
+		/** Sets up the function object.
+		 * \param[in] ring_ the ring buffer to write to.
+		 * \param[in] neighbors_ whether to write the neighbors.
+		 * \param[in] vertices_ whether to write the vertices.
+		 * \param[in] nt the number of threads that will write cells,
+		 *		 or zero to use the OpenMP default. Any other
+		 *		 threads build their records in temporary
+		 *		 storage. */
+		ring_output(shm_ring &ring_,bool neighbors_=true,bool vertices_=false,int nt=0)
+			: ring(ring_), neighbors(neighbors_), vertices(vertices_), tb(voro_threads(nt)) {}
+		/** Writes a record for a Voronoi cell.
+		 * \param[in] c a reference to the Voronoi cell.
+		 * \param[in] id the ID of the particle.
+		 * \param[in] (x,y,z) the position of the particle. */
+		template<class v_cell>
+		void operator()(v_cell &c,voro_id id,double x,double y,double z) {
+#ifdef _OPENMP
+			unsigned int t=omp_get_thread_num();
+#else
+			unsigned int t=0;
+#endif
+			thread_buffer lb,&b=t<tb.size()?tb[t]:lb;
+			if(neighbors) c.neighbors(b.vn);else b.vn.clear();
+			if(vertices) c.vertices(x,y,z,b.vv);else b.vv.clear();
+			write_record(b,id,x,y,z,c.volume());
+		}
+	private:
+		/** \brief The storage that each thread uses to build its
+		 * records. */
+		struct thread_buffer {
+			/** The record being built. */
+			std::vector<char> rec;
+			/** The neighbors of the cell. */
+			std::vector<voro_id> vn;
+			/** The vertices of the cell. */
+			std::vector<double> vv;
+		};
+		/** The buffers of each thread. */
+		std::vector<thread_buffer> tb;
+		void write_record(thread_buffer &b,voro_id id,double x,double y,double z,double vol);
+};
+
+}
+
+#endif
@@ -0,0 +1,137 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file slab_stream.cc
+ * \brief Function implementations for the slab_stream class. */
+
+#include <cstring>
+
+#include "slab_stream.hh"
+#include "particle_file.hh"
+#include "text_reader.hh"
+
+namespace voro {
+
+/** The number of particle records that are read from a slab file at a
+ * time. */
+const int slab_read_chunk=4096;
+
+/** The size of a particle record in a slab file, in bytes. */
+const int slab_record_size=sizeof(voro_id)+3*sizeof(double);
+
+/** The class constructor sets up the geometry of the container and the
+ * temporary slab files.
+ * \param[in] (ax_,bx_) the minimum and maximum x coordinates.
+ * \param[in] (ay_,by_) the minimum and maximum y coordinates.
+ * \param[in] (az_,bz_) the minimum and maximum z coordinates.
+ * \param[in] (nx_,ny_,nz_) the number of grid blocks in each of the three
+ *			    coordinate directions.
+ * \param[in] (xperiodic_,yperiodic_) flags setting whether the container is
+ *				      periodic in the x and y directions.
+ * \param[in] sb_ the number of blocks in the z direction in each slab.
+ * \param[in] hb_ the initial number of halo blocks above and below each slab,
+ *		  which must be at least one.
+ * \param[in] init_mem_ the initial memory allocation for each block of the
+ *			slab containers. */
+slab_stream::slab_stream(double ax_,double bx_,double ay_,double by_,double az_,double bz_,
+		int nx_,int ny_,int nz_,bool xperiodic_,bool yperiodic_,int sb_,int hb_,int init_mem_)
+	: ax(ax_), bx(bx_), ay(ay_), by(by_), az(az_), bz(bz_), nx(nx_), ny(ny_), nz(nz_),
+	xperiodic(xperiodic_), yperiodic(yperiodic_), sb(sb_), hb(hb_<1?1:hb_), ns((nz_+sb_-1)/sb_),
+	init_mem(init_mem_), np(0), zsp(nz_/(bz_-az_)), boxz((bz_-az_)/nz_), sf(new FILE*[ns]) {
+	for(int s=0;s<ns;s++) {
+		sf[s]=tmpfile();
+		if(sf[s]==NULL) voro_fatal_error("Unable to create a temporary slab file",VOROPP_FILE_ERROR);
+	}
+}
+
+/** The class destructor closes the temporary slab files, which deletes them.
+ */
+slab_stream::~slab_stream() {
+	for(int s=0;s<ns;s++) fclose(sf[s]);
+	delete [] sf;
+}
+
+/** Puts a particle into the slab file that it belongs to. The slab is
+ * determined using the position as it will be stored in the slab containers,
+ * so that each particle is assigned to exactly one slab. Particles outside the
+ * container in the z direction are ignored.
+ * \param[in] n the ID of the particle.
+ * \param[in] (x,y,z) the position vector of the particle. */
+void slab_stream::put(voro_id n,double x,double y,double z) {
+	double zf=fpoint(z);
+	if(zf<az||zf>=bz) return;
+	char b[slab_record_size];
+	memcpy(b,&n,sizeof(voro_id));
+	memcpy(b+sizeof(voro_id),&x,sizeof(double));
+	memcpy(b+sizeof(voro_id)+sizeof(double),&y,sizeof(double));
+	memcpy(b+sizeof(voro_id)+2*sizeof(double),&z,sizeof(double));
+	if(fwrite(b,slab_record_size,1,sf[slab_of(zf)])!=1)
+		voro_fatal_error("Unable to write to a temporary slab file",VOROPP_FILE_ERROR);
+	np++;
+}
+
+/** Imports a list of particles from an open file stream into the slab files.
+ * Entries of four numbers (Particle ID, x position, y position, z position)
+ * are searched for.
+ * \param[in] fp the file handle to read from.
+ * \param[in] nt the number of threads to use to parse the file. */
+void slab_stream::import(FILE *fp,int nt) {
+	text_reader tr(fp,3,nt);
+	while(tr.next()) for(unsigned int i=0;i<tr.id.size();i++)
+		put(tr.id[i],tr.v[3*i],tr.v[3*i+1],tr.v[3*i+2]);
+}
+
+/** Imports a list of particles from a binary particle file into the slab
+ * files. Any radii that are stored in the file are ignored.
+ * \param[in] filename the name of the file to read. */
+void slab_stream::import_binary(const char *filename) {
+	particle_file pf(filename);
+	int i,n;
+	double x,y,z;
+	for(i=0;i<pf.n;i++) {pf.get(i,n,x,y,z);put(n,x,y,z);}
+}
+
+/** Reads the particles in a range of blocks in the z direction from the slab
+ * files, and puts them into a container.
+ * \param[in] con the container to fill.
+ * \param[in] (k0,k1) the range of blocks, including k0 but not k1. */
+void slab_stream::fill(container &con,int k0,int k1) {
+	char b[slab_read_chunk*slab_record_size],*cp;
+	int s,n,k;
+	voro_id id;
+	double x,y,z;
+	for(s=k0/sb;s<=(k1-1)/sb;s++) {
+		rewind(sf[s]);
+		while((n=fread(b,slab_record_size,slab_read_chunk,sf[s]))>0) {
+			for(cp=b;cp<b+n*slab_record_size;cp+=slab_record_size) {
+				memcpy(&id,cp,sizeof(voro_id));
+				memcpy(&x,cp+sizeof(voro_id),sizeof(double));
+				memcpy(&y,cp+sizeof(voro_id)+sizeof(double),sizeof(double));
+				memcpy(&z,cp+sizeof(voro_id)+2*sizeof(double),sizeof(double));
+				k=int((double(fpoint(z))-az)*zsp);
+				if(k>=nz) k=nz-1;
+				if(k>=k0&&k<k1) con.put(id,x,y,z);
+			}
+		}
+
+		// Move back to the end of the file, so that more particles can
+		// be added
+		fseek(sf[s],0,SEEK_END);
+	}
+}
+
+/** Computes all of the Voronoi cells and saves customized information about
+ * them.
+ * \param[in] format the custom output string to use.
+ * \param[in] fp a file handle to write to. */
+void slab_stream::print_custom(const char *format,FILE *fp) {
+	compiled_format fm(format);
+	slab_custom_output so(fm,fp);
+	if(fm.neighbor()) compute<voronoicell_neighbor>(so);
+	else compute<voronoicell>(so);
+}
+
+}
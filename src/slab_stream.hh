@@ -0,0 +1,224 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file slab_stream.hh
+ * \brief Header file for the slab_stream class. */
+
+#ifndef VOROPP_SLAB_STREAM_HH
+#define VOROPP_SLAB_STREAM_HH
+
+#include <cstdio>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+#include "config.hh"
+#include "common.hh"
+#include "cell.hh"
+#include "container.hh"
+#include "format.hh"
+
+namespace voro {
+
+/** \brief A record of a particle whose Voronoi cell needs to be recomputed
+ * with a larger halo. */
+struct slab_record {
+	/** The ID of the particle. */
+	voro_id id;
+	/** The position of the particle. */
+	double x,y,z;
+	/** Compares two records, so that they can be sorted and searched.
+	 * \param[in] o the record to compare with.
+	 * \return True if this record comes first, false otherwise. */
+	inline bool operator<(const slab_record &o) const {
+		return id!=o.id?id<o.id:(x!=o.x?x<o.x:(y!=o.y?y<o.y:z<o.z));
+	}
+};
+
+/** \brief A class for computing the Voronoi tessellation of a set of particles
+ * that is too large to be held in memory.
+ *
+ * The particles are first sorted into slabs, which are contiguous ranges of
+ * the blocks of a global computational grid in the z direction. Each slab is
+ * held in its own temporary file. The slabs are then swept in order. For each
+ * slab, a container is set up that covers the slab together with a halo of
+ * extra blocks above and below it, and the Voronoi cells of the particles in
+ * the slab are computed and passed to an output routine. The container is
+ * then discarded, so that only one slab and its halo are held in memory at a
+ * time.
+ *
+ * The boundaries of the halo are not part of the global geometry, so a cell
+ * that reaches them might be missing some of its faces, and more generally a
+ * cell is only guaranteed to be correct if every point within twice its
+ * maximum vertex distance lies inside the container. Any cell that does not
+ * satisfy this is recomputed after the rest of the slab, using a container
+ * whose halo is twice as large, and this is repeated until every cell is
+ * correct. The output is therefore identical to that of a single container
+ * covering the whole domain, except that those cells appear at the end of
+ * their slab. The container may be periodic in the x and y directions, but not
+ * in the z direction. Walls are not supported. */
+class slab_stream {
+	public:
+		/** The minimum x coordinate of the container. */
+		const double ax;
+		/** The maximum x coordinate of the container. */
+		const double bx;
+		/** The minimum y coordinate of the container. */
+		const double ay;
+		/** The maximum y coordinate of the container. */
+		const double by;
+		/** The minimum z coordinate of the container. */
+		const double az;
+		/** The maximum z coordinate of the container. */
+		const double bz;
+		/** The number of blocks in the x direction. */
+		const int nx;
+		/** The number of blocks in the y direction. */
+		const int ny;
+		/** The number of blocks in the z direction. */
+		const int nz;
+		/** Whether the container is periodic in the x direction. */
+		const bool xperiodic;
+		/** Whether the container is periodic in the y direction. */
+		const bool yperiodic;
+		/** The number of blocks in the z direction in each slab. */
+		const int sb;
+		/** The initial number of halo blocks above and below each
+		 * slab. */
+		const int hb;
+		/** The number of slabs. */
+		const int ns;
+		/** The initial amount of memory to allocate for each block of
+		 * the slab containers. */
+		const int init_mem;
+		/** The number of particles that have been put into the slab
+		 * files. */
+		voro_id np;
+		slab_stream(double ax_,double bx_,double ay_,double by_,double az_,double bz_,
+				int nx_,int ny_,int nz_,bool xperiodic_,bool yperiodic_,
+				int sb_,int hb_,int init_mem_=8);
+		~slab_stream();
+		void put(voro_id n,double x,double y,double z);
+		void import(FILE *fp=stdin,int nt=1);
+		/** Imports particles from a file.
+		 * \param[in] filename the name of the file to read from.
+		 * \param[in] nt the number of threads to use to parse the
+		 *		 file. */
+		inline void import(const char *filename,int nt=1) {
+			FILE *fp=safe_fopen(filename,"r");
+			import(fp,nt);
+			fclose(fp);
+		}
+		void import_binary(const char *filename);
+		/** Computes the Voronoi cells of all of the particles, slab by
+		 * slab, and passes each one to an output routine.
+		 * \param[in] f the output routine, which is called as
+		 *		f(c,id,x,y,z) with each computed cell, the ID of
+		 *		its particle, and the particle position. */
+		template<class v_cell,class c_func>
+		void compute(c_func &f) {
+			int s,h;
+			std::vector<slab_record> fl,nfl;
+			for(s=0;s<ns;s++) {
+				h=hb;
+				compute_slab<v_cell>(s,h,NULL,fl,f);
+				while(!fl.empty()) {
+					h*=2;
+					std::sort(fl.begin(),fl.end());
+					nfl.clear();
+					compute_slab<v_cell>(s,h,&fl,nfl,f);
+					fl.swap(nfl);
+				}
+			}
+		}
+		void print_custom(const char *format,FILE *fp=stdout);
+		/** Computes all of the Voronoi cells and saves customized
+		 * information about them.
+		 * \param[in] format the custom output string to use.
+		 * \param[in] filename the name of the file to write to. */
+		inline void print_custom(const char *format,const char *filename) {
+			FILE *fp=safe_fopen(filename,"w");
+			print_custom(format,fp);
+			fclose(fp);
+		}
+	private:
+		/** The inverse of the block length in the z direction. */
+		const double zsp;
+		/** The block length in the z direction. */
+		const double boxz;
+		/** The temporary files holding the particles of each slab. */
+		FILE **sf;
+		/** Returns the slab that a z coordinate is in.
+		 * \param[in] z the z coordinate.
+		 * \return The slab index. */
+		inline int slab_of(double z) {
+			int k=int((z-az)*zsp);
+			if(k>=nz) k=nz-1;
+			return k/sb;
+		}
+		void fill(container &con,int k0,int k1);
+		/** Computes Voronoi cells in one slab using a given halo
+		 * size.
+		 * \param[in] s the slab to consider.
+		 * \param[in] h the number of halo blocks.
+		 * \param[in] only a sorted list of the particles to compute,
+		 *		   or NULL if all of the particles in the slab
+		 *		   should be computed.
+		 * \param[out] fl a list in which to store the particles whose
+		 *		  cells could not be computed correctly with this
+		 *		  halo.
+		 * \param[in] f the output routine. */
+		template<class v_cell,class c_func>
+		void compute_slab(int s,int h,std::vector<slab_record> *only,std::vector<slab_record> &fl,c_func &f) {
+			int k0=s*sb-h,k1=(s+1)*sb+h;
+			if(k0<0) k0=0;
+			if(k1>nz) k1=nz;
+			double zl=az+k0*boxz,zh=k1==nz?bz:az+k1*boxz,r;
+			container con(ax,bx,ay,by,zl,zh,nx,ny,k1-k0,xperiodic,yperiodic,false,init_mem);
+			fill(con,k0,k1);
+			v_cell c(con);
+			c_loop_all vl(con);
+			slab_record sr;
+			fl.clear();
+			if(vl.start()) do {
+				fpoint *pp=con.p[vl.ijk]+3*vl.q;
+				if(slab_of(pp[2])!=s) continue;
+				sr.id=con.id[vl.ijk][vl.q];sr.x=*pp;sr.y=pp[1];sr.z=pp[2];
+				if(only!=NULL&&!std::binary_search(only->begin(),only->end(),sr)) continue;
+				if(con.compute_cell(c,vl)) {
+					r=sqrt(c.max_radius_squared());
+					if((k0>0&&sr.z-r<zl)||(k1<nz&&sr.z+r>zh)) fl.push_back(sr);
+					else f(c,sr.id,sr.x,sr.y,sr.z);
+				}
+			} while(vl.inc());
+		}
+};
+
+/** \brief An output routine for the slab_stream class that saves customized
+ * information about each cell. */
+class slab_custom_output {
+	public:
+		/** The compiled format string to use. */
+		compiled_format &fm;
+		/** The file handle to write to. */
+		FILE *fp;
+		/** Sets up the output routine.
+		 * \param[in] fm_ the compiled format string to use.
+		 * \param[in] fp_ the file handle to write to. */
+		slab_custom_output(compiled_format &fm_,FILE *fp_) : fm(fm_), fp(fp_) {}
+		/** Saves information about a cell.
+		 * \param[in] c the Voronoi cell.
+		 * \param[in] i the ID of the particle.
+		 * \param[in] (x,y,z) the position of the particle. */
+		template<class v_cell>
+		inline void operator()(v_cell &c,voro_id i,double x,double y,double z) {
+			fm.write(c,i,x,y,z,default_radius,fp);
+		}
+};
+
+}
+
+#endif
@@ -0,0 +1,248 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file snapshot.cc
+ * \brief Function implementations for the cell_snapshot class. */
+
+#include <cmath>
+
+#include "snapshot.hh"
+
+namespace voro {
+
+/** Makes a snapshot of a Voronoi cell, replacing any previous contents.
+ * \param[in] c a reference to the cell. If this is a voronoicell_neighbor,
+ *              then the neighbor IDs of the faces are also stored.
+ * \param[in] id_ the ID of the particle.
+ * \param[in] (x_,y_,z_) the position of the particle. */
+void cell_snapshot::set(voronoicell_base &c,voro_id id_,double x_,double y_,double z_) {
+	id=id_;x=x_;y=y_;z=z_;
+
+	// Copy the vertex positions, removing the factor of two that the
+	// Voronoi cell classes use internally
+	pts.resize(3*c.p);
+	fpoint *pp=c.pts;
+	for(int i=0;i<3*c.p;i+=3,pp+=4) {
+		pts[i]=0.5*(*pp);pts[i+1]=0.5*pp[1];pts[i+2]=0.5*pp[2];
+	}
+
+	// Convert the face vertex list into compressed sparse row form
+	std::vector<int> v;
+	c.face_vertices(v);
+	fo.resize(1);fv.clear();
+	for(unsigned int j=0;j<v.size();j+=v[j]+1) {
+		fv.insert(fv.end(),v.begin()+j+1,v.begin()+j+1+v[j]);
+		fo.push_back(fv.size());
+	}
+	c.neighbors(fn);
+	pn.clear();
+}
+
+/** Replaces the neighbor IDs of the faces with a packed_neighbors encoding
+ * relative to the particle ID, and frees the memory of the unpacked array. */
+void cell_snapshot::pack_neighbors() {
+	if(fn.empty()) return;
+	pn.pack(id,fn);
+	std::vector<voro_id>().swap(fn);
+}
+
+/** Prints the neighbor IDs of the faces, separated by spaces, in the same way
+ * as the %n control sequence of voronoicell_base::output_custom(). Packed IDs
+ * are printed as they are decoded.
+ * \param[in] fp the file handle to write to. */
+void cell_snapshot::output_neighbors(FILE *fp) {
+	text_writer tw(fp);
+	if(pn.n>0) pn.print(id,tw);
+	else for(unsigned int k=0;k<fn.size();k++) {
+		if(k>0) tw.put(' ');
+		tw.put(fn[k]);
+	}
+}
+
+/** Encodes a list of neighbor IDs, replacing any previous contents.
+ * \param[in] id the ID of the particle, which the differences are taken
+ *		  relative to.
+ * \param[in] v the neighbor IDs. */
+void packed_neighbors::pack(voro_id id,const std::vector<voro_id> &v) {
+	long d;unsigned long z;
+	n=v.size();b.clear();
+	for(int i=0;i<n;i++) {
+		d=long(v[i])-long(id);
+		z=d<0?((static_cast<unsigned long>(-(d+1))<<1)|1):static_cast<unsigned long>(d)<<1;
+		while(z>=128) {b.push_back(static_cast<unsigned char>(z|128));z>>=7;}
+		b.push_back(static_cast<unsigned char>(z));
+	}
+	std::vector<unsigned char>(b).swap(b);
+}
+
+/** Prints the neighbor IDs, separated by spaces.
+ * \param[in] id the ID of the particle that the neighbors were encoded
+ *		  relative to.
+ * \param[in] tw the text writer to print to. */
+void packed_neighbors::print(voro_id id,text_writer &tw) const {
+	if(n==0) return;
+	const unsigned char *cp=&b[0];
+	tw.put(decode(cp,id));
+	for(int i=1;i<n;i++) {
+		tw.put(' ');
+		tw.put(decode(cp,id));
+	}
+}
+
+/** Computes the vector area of a face, whose direction is the outward normal
+ * and whose length is twice the area of the face.
+ * \param[in] f the index of the face.
+ * \param[out] (wx,wy,wz) the vector. */
+void cell_snapshot::face_vector(int f,double &wx,double &wy,double &wz) {
+	const int *vp=&fv[fo[f]],*ve=&fv[0]+fo[f+1];
+	const double *p0=&pts[3*(*vp)],*p2=&pts[3*vp[1]];
+	double ux,uy,uz,vx=p2[0]-p0[0],vy=p2[1]-p0[1],vz=p2[2]-p0[2];
+	wx=wy=wz=0;
+	for(vp+=2;vp<ve;vp++) {
+		p2=&pts[3*(*vp)];
+		ux=vx;uy=vy;uz=vz;
+		vx=p2[0]-p0[0];vy=p2[1]-p0[1];vz=p2[2]-p0[2];
+		wx+=vy*uz-vz*uy;
+		wy+=vz*ux-vx*uz;
+		wz+=vx*uy-vy*ux;
+	}
+}
+
+/** Calculates the volume of the cell, by decomposing each face into triangles
+ * and summing the volumes of the tetrahedra that they make with the particle
+ * position.
+ * \return The volume. */
+double cell_snapshot::volume() {
+	double vol=0,wx,wy,wz,*p0;
+	for(int f=0;f<number_of_faces();f++) {
+		face_vector(f,wx,wy,wz);
+		p0=&pts[3*fv[fo[f]]];
+		vol+=*p0*wx+p0[1]*wy+p0[2]*wz;
+	}
+	return vol*(1/6.0);
+}
+
+/** Calculates the total surface area of the cell.
+ * \return The area. */
+double cell_snapshot::surface_area() {
+	double area=0,wx,wy,wz;
+	for(int f=0;f<number_of_faces();f++) {
+		face_vector(f,wx,wy,wz);
+		area+=sqrt(wx*wx+wy*wy+wz*wz);
+	}
+	return 0.5*area;
+}
+
+/** Calculates the centroid of the cell relative to the particle position, by
+ * decomposing it into tetrahedra that extend from the particle position to
+ * triangles on each face.
+ * \param[out] (cx,cy,cz) references to floating point numbers in which to
+ *                        pass back the centroid vector. */
+void cell_snapshot::centroid(double &cx,double &cy,double &cz) {
+	double vol=0,tvol,*p0,*p1,*p2;
+	const int *vp,*ve;
+	cx=cy=cz=0;
+	for(int f=0;f<number_of_faces();f++) {
+		vp=&fv[fo[f]];ve=&fv[0]+fo[f+1];
+		p0=&pts[3*(*vp)];p2=&pts[3*vp[1]];
+		for(vp+=2;vp<ve;vp++) {
+			p1=p2;p2=&pts[3*(*vp)];
+			tvol=*p0*(p2[1]*p1[2]-p2[2]*p1[1])
+			    +p0[1]*(p2[2]*p1[0]-p2[0]*p1[2])
+			    +p0[2]*(p2[0]*p1[1]-p2[1]*p1[0]);
+			vol+=tvol;
+			cx+=(*p0+*p1+*p2)*tvol;
+			cy+=(p0[1]+p1[1]+p2[1])*tvol;
+			cz+=(p0[2]+p1[2]+p2[2])*tvol;
+		}
+	}
+	if(vol>0) {
+		vol=0.25/vol;
+		cx*=vol;cy*=vol;cz*=vol;
+	} else cx=cy=cz=0;
+}
+
+/** Calculates the area of each face of the cell.
+ * \param[out] v the vector to store the results in. */
+void cell_snapshot::face_areas(std::vector<double> &v) {
+	double wx,wy,wz;
+	v.resize(number_of_faces());
+	for(int f=0;f<number_of_faces();f++) {
+		face_vector(f,wx,wy,wz);
+		v[f]=0.5*sqrt(wx*wx+wy*wy+wz*wz);
+	}
+}
+
+/** Calculates the outward unit normal vector of each face of the cell. If a
+ * face has zero area, then (0,0,0) is returned for it.
+ * \param[out] v the vector to store the results in, in groups of three. */
+void cell_snapshot::normals(std::vector<double> &v) {
+	double wx,wy,wz,wmag;
+	v.resize(3*number_of_faces());
+	for(int f=0;f<number_of_faces();f++) {
+		face_vector(f,wx,wy,wz);
+		wmag=wx*wx+wy*wy+wz*wz;
+		if(wmag>0) {
+			wmag=1/sqrt(wmag);
+			wx*=wmag;wy*=wmag;wz*=wmag;
+		}
+		v[3*f]=wx;v[3*f+1]=wy;v[3*f+2]=wz;
+	}
+}
+
+/** Computes the number of vertices in each face of the cell.
+ * \param[out] v the vector to store the results in. */
+void cell_snapshot::face_orders(std::vector<int> &v) {
+	v.resize(number_of_faces());
+	for(int f=0;f<number_of_faces();f++) v[f]=face_order(f);
+}
+
+/** Computes the vertices of each face, in the same format as
+ * voronoicell_base::face_vertices(), where each face is given by its number
+ * of vertices followed by the vertex indices.
+ * \param[out] v the vector to store the results in. */
+void cell_snapshot::face_vertices(std::vector<int> &v) {
+	v.clear();
+	for(int f=0;f<number_of_faces();f++) {
+		v.push_back(face_order(f));
+		v.insert(v.end(),fv.begin()+fo[f],fv.begin()+fo[f+1]);
+	}
+}
+
+/** Copies the vertex positions relative to the particle position.
+ * \param[out] v the vector to store the results in. */
+void cell_snapshot::vertices(std::vector<double> &v) {
+	v=pts;
+}
+
+/** Computes the vertex positions in the global coordinate system.
+ * \param[in] (x_,y_,z_) the position vector of the particle.
+ * \param[out] v the vector to store the results in. */
+void cell_snapshot::vertices(double x_,double y_,double z_,std::vector<double> &v) {
+	v.resize(pts.size());
+	for(unsigned int i=0;i<pts.size();i+=3) {
+		v[i]=x_+pts[i];v[i+1]=y_+pts[i+1];v[i+2]=z_+pts[i+2];
+	}
+}
+
+/** Outputs the faces of the cell in gnuplot format, as a closed loop of
+ * vertices for each face.
+ * \param[in] (x_,y_,z_) a displacement vector to be added to the cell's
+ *                       position.
+ * \param[in] fp a file handle to write to. */
+void cell_snapshot::draw_gnuplot(double x_,double y_,double z_,FILE *fp) {
+	double *pp;
+	text_writer tw(fp);
+	for(int f=0;f<number_of_faces();f++) {
+		for(int j=fo[f];j<=fo[f+1];j++) {
+			pp=&pts[3*fv[j<fo[f+1]?j:fo[f]]];
+			tw.put3(x_+*pp,y_+pp[1],z_+pp[2],' ');tw.put('\n');
+		}
+		tw.put("\n\n");
+	}
+}
+
+}
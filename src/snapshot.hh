@@ -0,0 +1,249 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file snapshot.hh
+ * \brief Header file for the cell_snapshot class. */
+
+#ifndef VOROPP_SNAPSHOT_HH
+#define VOROPP_SNAPSHOT_HH
+
+#include <cstdio>
+#include <vector>
+
+#include "config.hh"
+#include "common.hh"
+#include "cell.hh"
+
+namespace voro {
+
+/** \brief A compact encoding of the neighbor IDs of the faces of a cell.
+ *
+ * The neighbors of a particle usually have IDs that are close to its own,
+ * particularly if the IDs follow a spatial ordering. This class stores each
+ * neighbor ID as its difference from the particle ID, mapped to an unsigned
+ * integer so that small negative differences stay small, and written as a
+ * sequence of bytes that each hold seven bits. A difference of less than 64 in
+ * magnitude takes a single byte, compared with the four or eight bytes of a
+ * voro_id. */
+class packed_neighbors {
+	public:
+		/** The encoded differences. */
+		std::vector<unsigned char> b;
+		/** The number of neighbor IDs. */
+		int n;
+		packed_neighbors() : n(0) {}
+		void pack(voro_id id,const std::vector<voro_id> &v);
+		/** Decodes the neighbor IDs.
+		 * \param[in] id the ID of the particle that the neighbors
+		 *		  were encoded relative to.
+		 * \param[out] v the vector to store the neighbor IDs in. */
+		inline void unpack(voro_id id,std::vector<voro_id> &v) const {
+			v.resize(n);
+			if(n==0) return;
+			const unsigned char *cp=&b[0];
+			voro_id *vp=&v[0],*ve=vp+n;
+			while(vp<ve) *(vp++)=decode(cp,id);
+		}
+		void print(voro_id id,text_writer &tw) const;
+		/** Removes all of the neighbor IDs. */
+		inline void clear() {b.clear();n=0;}
+		/** Returns the amount of memory used by the encoded
+		 * differences.
+		 * \return The number of bytes. */
+		inline size_t memory() const {return b.capacity();}
+	private:
+		/** Decodes a single neighbor ID, and moves past it.
+		 * \param[in,out] cp a pointer to the first byte of the ID.
+		 * \param[in] id the ID of the particle.
+		 * \return The neighbor ID. */
+		static inline voro_id decode(const unsigned char *&cp,voro_id id) {
+			unsigned long z=*(cp++);
+			if(z>=128) {
+				unsigned long c;int sh=7;
+				z&=127;
+				do {
+					c=*(cp++);
+					z|=(c&127)<<sh;sh+=7;
+				} while(c>=128);
+			}
+			return voro_id((z&1)?long(id)-long(z>>1)-1:long(id)+long(z>>1));
+		}
+};
+
+/** \brief A compact, read-only copy of the geometry of a Voronoi cell.
+ *
+ * A voronoicell or voronoicell_neighbor class holds large edge tables that
+ * are designed for cutting the cell by planes, and copying them costs many
+ * kilobytes per cell. This class stores just the geometry of a computed cell,
+ * as a flat array of vertex coordinates together with compressed sparse row
+ * arrays of the vertices and neighbors of each face. It is intended for
+ * keeping the results for large numbers of cells after they have been
+ * computed, and the common statistics can be evaluated on it directly. */
+class cell_snapshot {
+	public:
+		/** The ID of the particle associated with the cell. */
+		voro_id id;
+		/** The x coordinate of the particle. */
+		double x;
+		/** The y coordinate of the particle. */
+		double y;
+		/** The z coordinate of the particle. */
+		double z;
+		/** The vertex positions, in groups of three, relative to the
+		 * particle position. */
+		std::vector<double> pts;
+		/** The offsets of each face into the fv array, with an extra
+		 * entry marking the end. */
+		std::vector<int> fo;
+		/** The vertices of each face, listed in order around the face.
+		 */
+		std::vector<int> fv;
+		/** The neighbor IDs of each face, or an empty array if the
+		 * snapshot was made from a cell without neighbor information.
+		 */
+		std::vector<voro_id> fn;
+		/** The neighbor IDs of each face in packed form, which are
+		 * used in place of fn once pack_neighbors() has been called.
+		 */
+		packed_neighbors pn;
+		cell_snapshot() : id(0), x(0), y(0), z(0), fo(1,0) {}
+		/** Makes a snapshot of a Voronoi cell.
+		 * \param[in] c a reference to the cell.
+		 * \param[in] id_ the ID of the particle.
+		 * \param[in] (x_,y_,z_) the position of the particle. */
+		cell_snapshot(voronoicell_base &c,voro_id id_=0,double x_=0,double y_=0,double z_=0) {
+			set(c,id_,x_,y_,z_);
+		}
+		void set(voronoicell_base &c,voro_id id_=0,double x_=0,double y_=0,double z_=0);
+		/** Returns the number of vertices of the cell. */
+		inline int number_of_vertices() {return pts.size()/3;}
+		/** Returns the number of faces of the cell. */
+		inline int number_of_faces() {return fo.size()-1;}
+		/** Returns the number of edges of the cell. Each edge is
+		 * shared by two faces. */
+		inline int number_of_edges() {return fv.size()>>1;}
+		/** Returns the number of vertices in a face.
+		 * \param[in] f the index of the face. */
+		inline int face_order(int f) {return fo[f+1]-fo[f];}
+		/** Returns whether the snapshot holds neighbor information. */
+		inline bool has_neighbors() {return !fn.empty()||pn.n>0;}
+		double volume();
+		double surface_area();
+		void centroid(double &cx,double &cy,double &cz);
+		void face_areas(std::vector<double> &v);
+		void normals(std::vector<double> &v);
+		void face_orders(std::vector<int> &v);
+		void face_vertices(std::vector<int> &v);
+		void vertices(std::vector<double> &v);
+		void vertices(double x_,double y_,double z_,std::vector<double> &v);
+		/** Copies the neighbor IDs of each face into a vector,
+		 * decoding them if they have been packed.
+		 * \param[out] v the vector to store the results in. */
+		inline void neighbors(std::vector<voro_id> &v) {
+			if(pn.n>0) pn.unpack(id,v);else v=fn;
+		}
+		void pack_neighbors();
+		void output_neighbors(FILE *fp=stdout);
+		void draw_gnuplot(double x_,double y_,double z_,FILE *fp=stdout);
+		/** Returns the approximate amount of memory used by the
+		 * snapshot.
+		 * \return The number of bytes. */
+		inline size_t memory() {
+			return sizeof(cell_snapshot)+pts.capacity()*sizeof(double)
+			      +(fo.capacity()+fv.capacity())*sizeof(int)+fn.capacity()*sizeof(voro_id)
+			      +pn.memory();
+		}
+	private:
+		void face_vector(int f,double &wx,double &wy,double &wz);
+};
+
+/** \brief A cache of cell snapshots for the particles in a container.
+ *
+ * This template stores a cell_snapshot for each particle whose Voronoi cell
+ * has been requested, indexed by the block and the position within the block,
+ * so that repeated queries for the same particle do not need to recompute the
+ * cell. The cache checks the update counter of the container on every query,
+ * and discards all of its entries if any particles have been added or removed
+ * since they were computed. The neighbor IDs of the snapshots can optionally
+ * be packed, which makes the cache smaller. The class is not safe to use from
+ * several threads at once. */
+template<class c_class>
+class cell_cache {
+	public:
+		/** A reference to the container that the cells are computed
+		 * for. */
+		c_class &con;
+		/** The number of queries that were answered from the cache.
+		 */
+		unsigned int hits;
+		/** The number of queries that needed a cell to be computed.
+		 */
+		unsigned int misses;
+		/** Whether the neighbor IDs of the snapshots are packed. */
+		const bool pack;
+		/** Creates an empty cache.
+		 * \param[in] con_ the container to compute cells for.
+		 * \param[in] pack_ whether to pack the neighbor IDs of the
+		 *		    snapshots. */
+		cell_cache(c_class &con_,bool pack_=false) : con(con_), hits(0), misses(0),
+			pack(pack_), uc(con_.update_count), c(con_) {}
+		/** Returns the snapshot of the Voronoi cell of a particle,
+		 * computing it if it is not already in the cache.
+		 * \param[in] ijk the block that the particle is within.
+		 * \param[in] q the index of the particle within the block.
+		 * \return A pointer to the snapshot, which remains valid
+		 * until the container or the cache is next modified, or NULL
+		 * if the cell could not be computed. */
+		cell_snapshot* get(int ijk,int q) {
+			if(uc!=con.update_count) clear();
+			if(ijk>=int(st.size())) {st.resize(ijk+1);cs.resize(ijk+1);}
+			std::vector<char> &stb=st[ijk];
+			if(q>=int(stb.size())) {
+				int sz=q<con.co[ijk]?con.co[ijk]:q+1;
+				stb.resize(sz,0);cs[ijk].resize(sz);
+			}
+			if(stb[q]==0) {
+				misses++;
+				if(con.compute_cell(c,ijk,q)) {
+					fpoint *pp=con.p[ijk]+con.ps*q;
+					cs[ijk][q].set(c,con.id[ijk][q],*pp,pp[1],pp[2]);
+					if(pack) cs[ijk][q].pack_neighbors();
+					stb[q]=1;
+				} else stb[q]=2;
+			} else hits++;
+			return stb[q]==1?&cs[ijk][q]:NULL;
+		}
+		/** Returns the snapshot of the Voronoi cell of the particle
+		 * currently being referenced by a loop class, computing it if
+		 * it is not already in the cache.
+		 * \param[in] vl the loop class to use.
+		 * \return A pointer to the snapshot, or NULL if the cell
+		 * could not be computed. */
+		template<class c_loop>
+		inline cell_snapshot* get(c_loop &vl) {return get(vl.ijk,vl.q);}
+		/** Discards all of the entries in the cache. */
+		inline void clear() {
+			st.clear();cs.clear();
+			uc=con.update_count;
+		}
+	private:
+		/** The value of the container's update counter when the
+		 * entries in the cache were computed. */
+		unsigned int uc;
+		/** The state of each entry, indexed by block and then by
+		 * position within the block. It is 0 if the cell has not been
+		 * computed, 1 if it is stored, or 2 if it could not be
+		 * computed. */
+		std::vector<std::vector<char> > st;
+		/** The stored snapshots, indexed in the same way as st. */
+		std::vector<std::vector<cell_snapshot> > cs;
+		/** A Voronoi cell used to compute the snapshots. */
+		voronoicell_neighbor c;
+};
+
+}
+
+#endif
@@ -0,0 +1,149 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file state_file.cc
+ * \brief Function implementations for the routines that save and restore the
+ * block structure of a container. */
+
+#include <cstring>
+
+#include "state_file.hh"
+#include "common.hh"
+
+namespace voro {
+
+/** Returns a length rounded up to a multiple of eight bytes.
+ * \param[in] l the length.
+ * \return The rounded length. */
+static inline size_t state_pad(size_t l) {return (l+7)&~size_t(7);}
+
+/** Returns the value recorded in a state file for the sizes of the floating
+ * point and particle ID types. The ID size is only added when it differs from
+ * the four bytes of the original format, so that files written with the
+ * default types are unchanged.
+ * \return The value. */
+static inline int state_type_sizes() {
+	return int(sizeof(fpoint))+(sizeof(voro_id)==4?0:int(sizeof(voro_id))<<8);
+}
+
+/** Writes a block of data, followed by enough zeros to make its length a
+ * multiple of eight bytes.
+ * \param[in] p a pointer to the data.
+ * \param[in] l the length of the data in bytes.
+ * \param[in] fp the file handle to write to. */
+static void state_write(const void *p,size_t l,FILE *fp) {
+	static const char z[8]={0,0,0,0,0,0,0,0};
+	if(l>0) fwrite(p,1,l,fp);
+	if(l&7) fwrite(z,1,8-(l&7),fp);
+}
+
+/** Writes a container state file.
+ * \param[in] filename the name of the file to write.
+ * \param[in] kind the kind of container.
+ * \param[in] ps the number of values stored per particle.
+ * \param[in] (nx,ny,nz) the number of blocks in each direction.
+ * \param[in] nb the total number of blocks.
+ * \param[in] a the four integers describing the block structure.
+ * \param[in] g the six doubles describing the geometry.
+ * \param[in] mr the maximum particle radius.
+ * \param[in] id the particle IDs in each block.
+ * \param[in] p the particle positions in each block.
+ * \param[in] co the number of particles in each block.
+ * \param[in] img the periodic image flags of each block, or NULL if there are
+ *		  none. */
+void write_state_file(const char *filename,unsigned int kind,int ps,int nx,int ny,int nz,int nb,
+		const int *a,const double *g,double mr,voro_id **id,fpoint **p,const int *co,const char *img) {
+	FILE *fp=safe_fopen(filename,"wb");
+	unsigned int h[2]={state_file_version,kind};
+	int d[6]={ps,state_type_sizes(),nx,ny,nz,nb};
+	fwrite("VORO++CS",1,8,fp);
+	fwrite(h,sizeof(unsigned int),2,fp);
+	fwrite(d,sizeof(int),6,fp);
+	fwrite(a,sizeof(int),4,fp);
+	fwrite(g,sizeof(double),6,fp);
+	fwrite(&mr,sizeof(double),1,fp);
+	state_write(co,nb*sizeof(int),fp);
+	if(img!=NULL) state_write(img,nb,fp);
+	for(int l=0;l<nb;l++) {
+		state_write(id[l],co[l]*sizeof(voro_id),fp);
+		state_write(p[l],ps*co[l]*sizeof(fpoint),fp);
+	}
+	if(fclose(fp)!=0) voro_fatal_error("File output error",VOROPP_FILE_ERROR);
+}
+
+/** Reads a container state file into the block structure of a container. The
+ * file is mapped into memory, and the particles of each block are copied
+ * directly into the block arrays, which are only reallocated if they are too
+ * small. If the file cannot be read, or it was saved from a container with a
+ * different kind, geometry, or block structure, then a fatal error is caused.
+ * \param[in] filename the name of the file to read.
+ * \param[in] kind the kind of container.
+ * \param[in] ps the number of values stored per particle.
+ * \param[in] (nx,ny,nz) the number of blocks in each direction.
+ * \param[in] nb the total number of blocks.
+ * \param[in] a the four integers describing the block structure.
+ * \param[in] g the six doubles describing the geometry.
+ * \param[in,out] id the particle IDs in each block.
+ * \param[in,out] p the particle positions in each block.
+ * \param[out] co the number of particles in each block.
+ * \param[in,out] mem the memory allocated for each block.
+ * \param[out] img the periodic image flags of each block, or NULL if there are
+ *		   none.
+ * \param[in] min_mem the minimum amount of memory to allocate for a block
+ *		      that has none.
+ * \return The maximum particle radius. */
+double read_state_file(const char *filename,unsigned int kind,int ps,int nx,int ny,int nz,int nb,
+		const int *a,const double *g,voro_id **id,fpoint **p,int *co,int *mem,char *img,int min_mem) {
+	mapped_file mf(filename,state_file_header_size,"Container state file is too short");
+	const char *cp=mf.data;
+	unsigned int h[2];
+	int d[6],fa[4],l,n;
+	bool match;
+	double fg[6],mr;
+	memcpy(h,cp+8,2*sizeof(unsigned int));
+	memcpy(d,cp+16,6*sizeof(int));
+	memcpy(fa,cp+40,4*sizeof(int));
+	memcpy(fg,cp+56,6*sizeof(double));
+	memcpy(&mr,cp+104,sizeof(double));
+	if(memcmp(cp,"VORO++CS",8)!=0||*h!=state_file_version)
+		voro_fatal_error("Invalid container state file header",VOROPP_FILE_ERROR);
+	match=h[1]==kind&&*d==ps&&d[1]==state_type_sizes()&&d[2]==nx&&d[3]==ny&&d[4]==nz&&d[5]==nb;
+	for(l=0;l<4;l++) if(fa[l]!=a[l]) match=false;
+	for(l=0;l<6;l++) if(fg[l]!=g[l]) match=false;
+	if(!match) voro_fatal_error("Container state file does not match the container",VOROPP_FILE_ERROR);
+
+	// Read the block counts and image flags, and check that the file
+	// is long enough to hold all of the particles
+	size_t o=state_file_header_size+state_pad(nb*sizeof(int)),e=o;
+	if(img!=NULL) o=e=o+state_pad(nb);
+	if(mf.size<o) voro_fatal_error("Container state file is truncated",VOROPP_FILE_ERROR);
+	memcpy(co,cp+state_file_header_size,nb*sizeof(int));
+	for(l=0;l<nb;l++) {
+		if(co[l]<0) voro_fatal_error("Invalid container state file",VOROPP_FILE_ERROR);
+		e+=state_pad(co[l]*sizeof(voro_id))+state_pad(ps*co[l]*sizeof(fpoint));
+	}
+	if(mf.size<e) voro_fatal_error("Container state file is truncated",VOROPP_FILE_ERROR);
+	if(img!=NULL) memcpy(img,cp+o-state_pad(nb),nb);
+
+	// Copy the particles into the blocks
+	for(l=0;l<nb;l++) {
+		n=co[l];
+		if(mem[l]<n) {
+			if(mem[l]>0) {delete [] id[l];delete [] p[l];}
+			mem[l]=n>min_mem?n:min_mem;
+			id[l]=new voro_id[mem[l]];
+			p[l]=new fpoint[ps*mem[l]];
+		}
+		if(n==0) continue;
+		memcpy(id[l],cp+o,n*sizeof(voro_id));
+		o+=state_pad(n*sizeof(voro_id));
+		memcpy(p[l],cp+o,ps*n*sizeof(fpoint));
+		o+=state_pad(ps*n*sizeof(fpoint));
+	}
+	return mr;
+}
+
+}
@@ -0,0 +1,62 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file state_file.hh
+ * \brief Header file for the routines that save and restore the block
+ * structure of a container.
+ *
+ * A container state file begins with a 112-byte header, made up of:
+ *  - the eight characters "VORO++CS",
+ *  - a 32-bit unsigned integer version number, which is currently 1,
+ *  - a 32-bit unsigned integer giving the kind of container, which is zero
+ *    for the container and container_poly classes, and one for the
+ *    container_periodic and container_periodic_poly classes,
+ *  - 32-bit integers giving the number of values stored per particle, and the
+ *    size of the floating point type used for the particle positions, plus
+ *    256 times the size of the particle ID type if this is not four bytes,
+ *  - 32-bit integers giving the number of blocks in the x, y, and z
+ *    directions, and the total number of blocks including any periodic
+ *    images,
+ *  - four 32-bit integers describing the block structure, which are the
+ *    periodicity flags and a zero for the first kind of container, and the
+ *    ey, ez, oy, and oz values for the second kind,
+ *  - six doubles giving the geometry, which are the bounds of the container
+ *    for the first kind, and the unit cell vectors for the second kind,
+ *  - a double giving the maximum particle radius, which is zero for
+ *    containers that do not store radii.
+ *
+ * The header is followed by the number of particles in each block as 32-bit
+ * integers. For the second kind of container, this is followed by one byte
+ * per block of periodic image flags. The particles of each block then follow
+ * in turn, as the particle IDs, which are 32-bit integers unless the library
+ * is compiled with VOROPP_LARGE_IDS, and then the particle positions. Each of these arrays is padded with zeros to a multiple of eight
+ * bytes, so that every array in the file is aligned when the file is mapped
+ * into memory. All fields are in the native byte order of the machine. Walls
+ * are not stored. */
+
+#ifndef VOROPP_STATE_FILE_HH
+#define VOROPP_STATE_FILE_HH
+
+#include <cstdio>
+
+#include "config.hh"
+#include "particle_file.hh"
+
+namespace voro {
+
+/** The size of the header of a container state file, in bytes. */
+const int state_file_header_size=112;
+/** The version number of the container state file format. */
+const unsigned int state_file_version=1;
+
+void write_state_file(const char *filename,unsigned int kind,int ps,int nx,int ny,int nz,int nb,
+		const int *a,const double *g,double mr,voro_id **id,fpoint **p,const int *co,const char *img);
+double read_state_file(const char *filename,unsigned int kind,int ps,int nx,int ny,int nz,int nb,
+		const int *a,const double *g,voro_id **id,fpoint **p,int *co,int *mem,char *img,int min_mem);
+
+}
+
+#endif
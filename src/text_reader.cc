@@ -0,0 +1,201 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file text_reader.cc
+ * \brief Function implementations for the text_reader class. */
+
+#include <cstdlib>
+#include <cstring>
+#include <cctype>
+
+#include "text_reader.hh"
+#include "common.hh"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace voro {
+
+/** The class constructor allocates the buffer and the per-thread arrays.
+ * \param[in] fp_ the file handle to read from.
+ * \param[in] nv_ the number of floating point values in each record.
+ * \param[in] nt_ the number of threads to use for parsing. If this is zero or
+ *		  negative, then the OpenMP default number of threads is used. */
+text_reader::text_reader(FILE *fp_,int nv_,int nt_) : nv(nv_), nt(voro_threads(nt_)),
+	fp(fp_), buf(new char[text_reader_block+1]), bsz(text_reader_block), len(0), eof(false),
+	tid(new std::vector<voro_id>[nt]), tv(new std::vector<double>[nt]) {}
+
+/** The class destructor frees the dynamically allocated memory. */
+text_reader::~text_reader() {
+	delete [] tv;
+	delete [] tid;
+	delete [] buf;
+}
+
+/** Reads from the file until the buffer is full or the end of the file is
+ * reached. */
+void text_reader::fill() {
+	while(!eof&&len<bsz) {
+		size_t l=fread(buf+len,1,bsz-len,fp);
+		len+=l;
+		if(l==0) eof=true;
+	}
+}
+
+/** Doubles the size of the buffer, and reads more of the file into it. */
+void text_reader::grow() {
+	char *nb=new char[2*bsz+1];
+	memcpy(nb,buf,len);
+	delete [] buf;
+	buf=nb;bsz*=2;
+	fill();
+}
+
+/** Reads and parses the next block of the file.
+ * \return True if a block was read, false if the end of the file has been
+ *         reached. */
+bool text_reader::next() {
+	id.clear();v.clear();
+	fill();
+	if(len==0) return false;
+
+	// Find the end of the last complete line in the buffer. If there is no
+	// complete line, then the buffer is enlarged until one fits.
+	size_t e=len;
+	if(!eof) {
+		while(e>0&&buf[e-1]!='\n') e--;
+		while(e==0) {
+			grow();
+			if(eof) e=len;
+			else {e=len;while(e>0&&buf[e-1]!='\n') e--;}
+		}
+	}
+
+	// Terminate the text to be parsed, so that the number parsing routines
+	// cannot read past it
+	char sc=buf[e];buf[e]=0;
+
+	// Divide the text into one part per thread at newline boundaries,
+	// and parse each part
+	bool ok=true;
+	if(nt==1) ok=parse_lines(buf,buf+e,id,v);
+#ifdef _OPENMP
+	else {
+#pragma omp parallel num_threads(nt) reduction(&&:ok)
+		{
+			int t=omp_get_thread_num();
+			size_t s0=e*t/nt,s1=e*(t+1)/nt;
+			while(s0>0&&s0<e&&buf[s0-1]!='\n') s0++;
+			while(s1<e&&buf[s1-1]!='\n') s1++;
+			tid[t].clear();tv[t].clear();
+			ok=s0>=s1||parse_lines(buf+s0,buf+s1,tid[t],tv[t]);
+		}
+		if(ok) for(int t=0;t<nt;t++) {
+			id.insert(id.end(),tid[t].begin(),tid[t].end());
+			v.insert(v.end(),tv[t].begin(),tv[t].end());
+		}
+	}
+#endif
+
+	// If the block does not have one record per line, then parse it again
+	// sequentially. This may leave a partial record at the end, which is
+	// kept for the next block.
+	if(!ok) {
+		id.clear();v.clear();
+		size_t l=parse_sequential(e);
+		buf[e]=sc;
+		e=l;
+
+		// If a single record does not fit in the buffer, then enlarge
+		// it so that the next call can make progress
+		if(e==0) grow();
+	} else buf[e]=sc;
+
+	// Move the unparsed text to the start of the buffer
+	len-=e;
+	memmove(buf,buf+e,len);
+	return true;
+}
+
+/** Parses a section of text in which each line is expected to hold exactly one
+ * record, or to be blank.
+ * \param[in] (cp,ce) pointers to the start and end of the text.
+ * \param[out] id_ a vector to append the particle IDs to.
+ * \param[out] v_ a vector to append the floating point values to.
+ * \return True if the text was parsed successfully, false if any line did not
+ *         hold exactly one record. */
+bool text_reader::parse_lines(const char *cp,const char *ce,std::vector<voro_id> &id_,std::vector<double> &v_) {
+	char *np;
+	while(cp<ce) {
+
+		// Skip any blank lines
+		while(*cp==' '||*cp=='\t'||*cp=='\r') cp++;
+		if(cp==ce) break;
+		if(*cp=='\n') {cp++;continue;}
+
+		// Read the ID and the floating point values, checking that they
+		// are all on the same line
+		long n=strtol(cp,&np,10);
+		if(np==cp) return false;
+		id_.push_back(voro_id(n));
+		cp=np;
+		for(int c=0;c<nv;c++) {
+			while(*cp==' '||*cp=='\t'||*cp=='\r') cp++;
+			if(*cp=='\n'||cp==ce) return false;
+			double x=strtod(cp,&np);
+			if(np==cp) return false;
+			v_.push_back(x);
+			cp=np;
+		}
+
+		// Check that nothing else is on the line
+		while(*cp==' '||*cp=='\t'||*cp=='\r') cp++;
+		if(cp<ce) {
+			if(*cp!='\n') return false;
+			cp++;
+		}
+	}
+	return true;
+}
+
+/** Parses the text at the start of the buffer as a sequence of records
+ * separated by any whitespace. If the text cannot be parsed, then a fatal
+ * error is caused.
+ * \param[in] e the length of the text to parse.
+ * \return The length of the text that was used. This is less than e if the
+ *         text ends with a partial record and the end of the file has not
+ *         been reached. */
+size_t text_reader::parse_sequential(size_t e) {
+	char *cp=buf,*ce=buf+e,*rp,*np;
+	while(true) {
+		while(cp<ce&&isspace((unsigned char) *cp)) cp++;
+		if(cp==ce) return e;
+		rp=cp;
+		long n=strtol(cp,&np,10);
+		if(np==cp) voro_fatal_error("File import error",VOROPP_FILE_ERROR);
+		cp=np;
+		for(int c=0;c<nv;c++) {
+			while(cp<ce&&isspace((unsigned char) *cp)) cp++;
+			if(cp==ce) {
+
+				// The record is not complete. If there is more of
+				// the file to read, then keep the record for the
+				// next block.
+				if(eof) voro_fatal_error("File import error",VOROPP_FILE_ERROR);
+				v.resize(v.size()-c);
+				return rp-buf;
+			}
+			double x=strtod(cp,&np);
+			if(np==cp) voro_fatal_error("File import error",VOROPP_FILE_ERROR);
+			v.push_back(x);
+			cp=np;
+		}
+		id.push_back(voro_id(n));
+	}
+}
+
+}
@@ -0,0 +1,76 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file text_reader.hh
+ * \brief Header file for the text_reader class. */
+
+#ifndef VOROPP_TEXT_READER_HH
+#define VOROPP_TEXT_READER_HH
+
+#include <cstdio>
+#include <vector>
+
+#include "config.hh"
+
+namespace voro {
+
+/** The number of bytes that the text_reader class reads from the file at a
+ * time. */
+const int text_reader_block=1<<24;
+
+/** \brief A class for reading a text file of particles in large blocks.
+ *
+ * This class reads a text file of particle records, each made up of an
+ * integer ID followed by a fixed number of floating point values. The file is
+ * read in large blocks, which are divided at newline boundaries, and each
+ * part is parsed on a separate thread. The threaded parser requires that each
+ * line holds exactly one record. If any part of a block does not satisfy
+ * this, then the whole block is parsed again by a sequential parser, which
+ * treats all whitespace alike in the same way as the fscanf routine, so that
+ * records may span several lines or share a line. If the file contains
+ * anything that cannot be read as a sequence of complete records, then a
+ * fatal error is caused with the VOROPP_FILE_ERROR status, in the same way as
+ * for the previous fscanf-based import routines. */
+class text_reader {
+	public:
+		/** The number of floating point values in each record. */
+		const int nv;
+		/** The number of threads to use for parsing. */
+		const int nt;
+		/** The IDs of the particles in the current block. */
+		std::vector<voro_id> id;
+		/** The floating point values of the particles in the current
+		 * block, in groups of nv. */
+		std::vector<double> v;
+		text_reader(FILE *fp_,int nv_,int nt_=1);
+		~text_reader();
+		bool next();
+	private:
+		/** The file handle to read from. */
+		FILE *fp;
+		/** The buffer that holds the text of the current block. */
+		char *buf;
+		/** The size of the buffer, excluding the space for a
+		 * terminating null character. */
+		size_t bsz;
+		/** The number of bytes currently in the buffer. */
+		size_t len;
+		/** Whether the end of the file has been reached. */
+		bool eof;
+		/** The IDs that are found by each thread. */
+		std::vector<voro_id> *tid;
+		/** The floating point values that are found by each
+		 * thread. */
+		std::vector<double> *tv;
+		void fill();
+		void grow();
+		bool parse_lines(const char *cp,const char *ce,std::vector<voro_id> &id_,std::vector<double> &v_);
+		size_t parse_sequential(size_t e);
+};
+
+}
+
+#endif
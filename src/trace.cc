@@ -0,0 +1,111 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file trace.cc
+ * \brief Function implementations for the phase tracing classes. */
+
+#include "trace.hh"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace voro {
+
+/** The trace sink that the phase timings are passed to, or a null pointer if
+ * they are not being taken. */
+trace_sink *voro_trace=NULL;
+
+/** Sets the trace sink that the phase timings are passed to. This should not
+ * be called while the library is carrying out a computation.
+ * \param[in] ts a pointer to the sink, or a null pointer to stop taking
+ *		 timings. */
+void voro_set_trace(trace_sink *ts) {
+	voro_trace=ts;
+}
+
+/** Passes a finished phase to the trace sink, together with the current thread
+ * number. This is called by the trace_scope class.
+ * \param[in] name the name of the phase.
+ * \param[in] t0 the start time of the phase. */
+void trace_finish(const char *name,double t0) {
+#ifdef _OPENMP
+	voro_trace->span(name,omp_get_thread_num(),t0,voro_wtime());
+#else
+	voro_trace->span(name,0,t0,voro_wtime());
+#endif
+}
+
+/** Initializes the class to write to an open file handle, and writes the start
+ * of the JSON array.
+ * \param[in] fp_ the file handle to write to. */
+trace_chrome::trace_chrome(FILE *fp_) : fp(fp_), own(false), started(false), tz(voro_wtime()) {
+	fputc('[',fp);
+}
+
+/** Initializes the class to write to a file, and writes the start of the JSON
+ * array.
+ * \param[in] filename the name of the file to write to. */
+trace_chrome::trace_chrome(const char *filename) : fp(safe_fopen(filename,"w")), own(true),
+	started(false), tz(voro_wtime()) {
+	fputc('[',fp);
+}
+
+/** The class destructor finishes the JSON array, and closes the file if it was
+ * opened by the class. */
+trace_chrome::~trace_chrome() {
+	fputs("\n]\n",fp);
+	if(own) fclose(fp);
+	else fflush(fp);
+}
+
+/** Writes a phase as a complete event.
+ * \param[in] name the name of the phase.
+ * \param[in] thread the thread that carried it out.
+ * \param[in] (t0,t1) the start and end times. */
+void trace_chrome::span(const char *name,int thread,double t0,double t1) {
+#ifdef _OPENMP
+#pragma omp critical(voro_trace)
+#endif
+	{
+		fprintf(fp,"%s\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+			started?",":"",name,thread,1e6*(t0-tz),1e6*(t1-t0));
+		started=true;
+	}
+}
+
+/** Adds a phase to the totals.
+ * \param[in] name the name of the phase.
+ * \param[in] thread the thread that carried it out, which is not used.
+ * \param[in] (t0,t1) the start and end times. */
+void trace_summary::span(const char *name,int thread,double t0,double t1) {
+#ifdef _OPENMP
+#pragma omp critical(voro_trace)
+#endif
+	{
+		std::pair<long,double> &e=tot[name];
+		e.first++;e.second+=t1-t0;
+	}
+}
+
+/** Returns the total time spent in a phase.
+ * \param[in] name the name of the phase.
+ * \return The total time in seconds, or zero if the phase has not been
+ *	   carried out. */
+double trace_summary::total(const char *name) {
+	std::map<std::string,std::pair<long,double> >::iterator it=tot.find(name);
+	return it==tot.end()?0:it->second.second;
+}
+
+/** Prints the totals, with the name of each phase, the number of times that it
+ * was carried out, and the total time in seconds on a line.
+ * \param[in] fp a file handle to write to. */
+void trace_summary::print(FILE *fp) {
+	for(std::map<std::string,std::pair<long,double> >::iterator it=tot.begin();it!=tot.end();it++)
+		fprintf(fp,"%s %ld %.6f\n",it->first.c_str(),it->second.first,it->second.second);
+}
+
+}
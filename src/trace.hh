@@ -0,0 +1,112 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file trace.hh
+ * \brief Header file for the phase tracing classes. */
+
+#ifndef VOROPP_TRACE_HH
+#define VOROPP_TRACE_HH
+
+#include <cstdio>
+#include <map>
+#include <string>
+
+#include "config.hh"
+#include "common.hh"
+
+namespace voro {
+
+/** \brief The base class for the destinations of phase timings.
+ *
+ * The library times the main phases of its work, such as importing particles,
+ * sorting, creating periodic images, computing each cell, applying walls, and
+ * formatting output, and passes each one to the sink that has been set with
+ * voro_set_trace(). If no sink is set, which is the default, then no timings
+ * are taken. The phases of each cell are nested within the routine that
+ * computes them, and the walls of a cell are nested within its computation.
+ * The routines may be called by several threads at once. */
+class trace_sink {
+	public:
+		virtual ~trace_sink() {}
+		/** Records a phase.
+		 * \param[in] name the name of the phase.
+		 * \param[in] thread the thread that carried it out.
+		 * \param[in] (t0,t1) the start and end times, as given by
+		 *		      voro_wtime(). */
+		virtual void span(const char *name,int thread,double t0,double t1) = 0;
+};
+
+/** \brief A trace sink that writes the phases in the Chrome trace format.
+ *
+ * This class writes each phase as a complete event in the JSON trace event
+ * format, which can be viewed in the Chrome trace viewer or Perfetto. The
+ * times are given in microseconds from the creation of the class. The events
+ * are written in a critical section, so tracing the phases of every cell
+ * slows down a threaded computation. */
+class trace_chrome : public trace_sink {
+	public:
+		trace_chrome(FILE *fp_);
+		trace_chrome(const char *filename);
+		~trace_chrome();
+		virtual void span(const char *name,int thread,double t0,double t1);
+	private:
+		/** The file handle to write to. */
+		FILE *fp;
+		/** Whether the file was opened by the class. */
+		bool own;
+		/** Whether an event has been written. */
+		bool started;
+		/** The time that the class was created. */
+		double tz;
+};
+
+/** \brief A trace sink that sums the time spent in each phase.
+ *
+ * This class keeps the number of times that each phase was carried out and
+ * the total time spent in it, summed over all of the threads. Since the
+ * phases are nested, the time of a phase includes that of the phases within
+ * it. */
+class trace_summary : public trace_sink {
+	public:
+		virtual void span(const char *name,int thread,double t0,double t1);
+		/** Removes all of the totals. */
+		inline void clear() {tot.clear();}
+		double total(const char *name);
+		void print(FILE *fp=stdout);
+	private:
+		/** The number of times and the total time of each phase. */
+		std::map<std::string,std::pair<long,double> > tot;
+};
+
+extern trace_sink *voro_trace;
+void voro_set_trace(trace_sink *ts);
+void trace_finish(const char *name,double t0);
+
+/** \brief A class for timing a phase within a scope.
+ *
+ * An instance of this class takes the time when it is created, and passes the
+ * phase to the trace sink when it goes out of scope. If no sink has been set,
+ * then the only cost is a test of the sink pointer. */
+class trace_scope {
+	public:
+		/** Starts timing a phase.
+		 * \param[in] name_ the name of the phase, which must remain
+		 *		    valid until the end of the phase. */
+		trace_scope(const char *name_) : name(name_), t0(voro_trace==NULL?-1:voro_wtime()) {}
+		/** Finishes timing the phase, if a sink was set when it
+		 * started. */
+		~trace_scope() {if(t0>=0&&voro_trace!=NULL) trace_finish(name,t0);}
+	private:
+		/** The name of the phase. */
+		const char *name;
+		/** The start time of the phase, or -1 if it is not being
+		 * timed. */
+		const double t0;
+};
+
+}
+
+#endif
@@ -25,7 +25,7 @@ namespace voro {
  *                            vector. */
 unitcell::unitcell(double bx_,double bxy_,double by_,double bxz_,double byz_,double bz_)
 	: bx(bx_), bxy(bxy_), by(by_), bxz(bxz_), byz(byz_), bz(bz_),
-	unit_voro(max_unit_voro_shells*max_unit_voro_shells*4*(bx*bx+by*by+bz*bz)) {
+	unit_voro(max_unit_voro_shells*max_unit_voro_shells*4*(bx*bx+by*by+bz*bz)), grid(NULL) {
 	int i,j,l=1;
 
 	// Initialize the Voronoi cell to be a very large rectangular box
@@ -64,7 +64,7 @@ unitcell::unitcell(double bx_,double bxy_,double by_,double bxz_,double byz_,dou
 			// than the one based on computing the maximum radius
 			// of a Voronoi cell vertex.
 			max_uv_y=max_uv_z=0;
-			double y,z,q,*pts=unit_voro.pts,*pp=pts;
+			double y,z,q;fpoint *pts=unit_voro.pts,*pp=pts;
 			while(pp<pts+4*unit_voro.p) {
 				q=*(pp++);y=*(pp++);z=*pp;pp+=2;q=sqrt(q*q+y*y+z*z);
 				if(y+q>max_uv_y) max_uv_y=y+q;
@@ -84,6 +84,38 @@ unitcell::unitcell(double bx_,double bxy_,double by_,double bxz_,double byz_,dou
 	voro_fatal_error("Periodic cell computation failed",VOROPP_MEMORY_ERROR);
 }
 
+/** The copy constructor duplicates the unit Voronoi cell, its bounds, and any
+ * cached list of periodic images, so that the unit cell doesn't need to be
+ * computed again. The block grid tables are not copied.
+ * \param[in] uc the class to copy. */
+unitcell::unitcell(const unitcell &uc)
+	: bx(uc.bx), bxy(uc.bxy), by(uc.by), bxz(uc.bxz), byz(uc.byz), bz(uc.bz),
+	unit_voro(uc.unit_voro), grid(NULL), max_uv_y(uc.max_uv_y), max_uv_z(uc.max_uv_z),
+	ivi(uc.ivi), ivd(uc.ivd) {}
+
+/** The class destructor frees the block grid tables. */
+unitcell::~unitcell() {
+	delete grid;
+}
+
+/** Computes the list of periodic images that intersect the unit Voronoi cell
+ * and stores it, so that later calls to images() return it directly. */
+void unitcell::cache_images() {
+	if(ivd.empty()) find_images(ivi,ivd);
+}
+
+/** Computes the worklists and their radii for a particular block grid and
+ * stores them, so that containers with this grid that are constructed from
+ * the class can copy them instead of generating them again. Only one grid is
+ * stored at a time.
+ * \param[in] (nx,ny,nz) the number of blocks in each of the three coordinate
+ *			directions. */
+void unitcell::cache_grid(int nx,int ny,int nz) {
+	if(cached_grid(nx,ny,nz)!=NULL) return;
+	delete grid;
+	grid=new voro_base(nx,ny,nz,bx/nx,by/ny,bz/nz);
+}
+
 /** Applies a pair of opposing plane cuts from a periodic image point
  * to the unit Voronoi cell.
  * \param[in] (i,j,k) the index of the periodic image to consider. */
@@ -114,13 +146,26 @@ bool unitcell::intersects_image(double dx,double dy,double dz,double &vol) {
 	return true;
 }
 
-/** Computes a list of periodic domain images that intersect the unit Voronoi cell.
+/** Computes a list of periodic domain images that intersect the unit Voronoi
+ * cell, using the cached list if cache_images() has been called.
  * \param[out] vi a vector containing triplets (i,j,k) corresponding to domain
  *                images that intersect the unit Voronoi cell, when it is
  *                centered in the middle of the primary domain.
  * \param[out] vd a vector containing the fraction of the Voronoi cell volume
  *                within each corresponding image listed in vi. */
 void unitcell::images(std::vector<int> &vi,std::vector<double> &vd) {
+	if(ivd.empty()) find_images(vi,vd);
+	else {
+		vi.insert(vi.end(),ivi.begin(),ivi.end());
+		vd.insert(vd.end(),ivd.begin(),ivd.end());
+	}
+}
+
+/** Carries out the search for the periodic domain images that intersect the
+ * unit Voronoi cell, as described for images().
+ * \param[out] vi a vector to append the image triplets to.
+ * \param[out] vd a vector to append the volume fractions to. */
+void unitcell::find_images(std::vector<int> &vi,std::vector<double> &vd) {
 	const int ms2=max_unit_voro_shells*2+1,mss=ms2*ms2*ms2;
 	bool *a=new bool[mss],*ac=a+max_unit_voro_shells*(1+ms2*(1+ms2)),*ap=a;
 	int i,j,k;
@@ -14,11 +14,21 @@
 
 #include "config.hh"
 #include "cell.hh"
+#include "v_base.hh"
 
 namespace voro {
 
 /** \brief Class for computation of the unit Voronoi cell associated with
- * a 3D non-rectangular periodic domain. */
+ * a 3D non-rectangular periodic domain.
+ *
+ * The class can also be used as a descriptor of the periodic domain that is
+ * shared between many containers with the same geometry. The list of periodic
+ * images can be cached with cache_images(), and the worklists for a block grid
+ * can be cached with cache_grid(), after which the container_periodic and
+ * container_periodic_poly classes can be constructed from the descriptor
+ * without recomputing the unit Voronoi cell, its bounds, or the worklists.
+ * Once the tables are cached, the descriptor is only read by the containers,
+ * so it can be shared between threads. */
 class unitcell {
 	public:
 		/** The x coordinate of the first vector defining the periodic
@@ -42,7 +52,23 @@ class unitcell {
 		/** The computed unit Voronoi cell corresponding the given
 		 * 3D non-rectangular periodic domain geometry. */
 		voronoicell unit_voro;
+		/** The block grid tables stored by cache_grid(), or NULL if
+		 * none have been stored. */
+		voro_base *grid;
 		unitcell(double bx_,double bxy_,double by_,double bxz_,double byz_,double bz_);
+		unitcell(const unitcell &uc);
+		~unitcell();
+		void cache_images();
+		void cache_grid(int nx,int ny,int nz);
+		/** Checks whether the block grid tables have been stored for
+		 * a particular grid.
+		 * \param[in] (nx,ny,nz) the number of blocks in each of the
+		 *			three coordinate directions.
+		 * \return A pointer to the tables if they match the grid,
+		 *	   or NULL otherwise. */
+		inline const voro_base* cached_grid(int nx,int ny,int nz) const {
+			return grid!=NULL&&grid->nx==nx&&grid->ny==ny&&grid->nz==nz?grid:NULL;
+		}
 		/** Draws an outline of the domain in Gnuplot format.
 		 * \param[in] filename the filename to write to. */
 		inline void draw_domain_gnuplot(const char* filename) {
@@ -69,6 +95,15 @@ class unitcell {
 		 * computed unit Voronoi cell. */
 		double max_uv_z;
 	private:
+		/** The cached triplets of periodic image indices, which are
+		 * empty if cache_images() has not been called. */
+		std::vector<int> ivi;
+		/** The cached volume fractions of the periodic images. */
+		std::vector<double> ivd;
+		void find_images(std::vector<int> &vi,std::vector<double> &vd);
+		/** Assignment is not available, since the domain vectors are
+		 * constant. */
+		void operator=(const unitcell &uc);
 		inline void unit_voro_apply(int i,int j,int k);
 		bool unit_voro_intersect(int l);
 		inline bool unit_voro_test(int i,int j,int k);
@@ -7,32 +7,245 @@
 /** \file v_base.cc
  * \brief Function implementations for the base Voronoi container class. */
 
+#include <cmath>
+#include <vector>
+#include <map>
+
 #include "v_base.hh"
 #include "config.hh"
+#include "common.hh"
 
 namespace voro {
 
-/** This function is called during container construction. The routine scans
- * all of the worklists in the wl[] array. For a given worklist of blocks
- * labeled \f$w_1\f$ to \f$w_n\f$, it computes a sequence \f$r_0\f$ to
- * \f$r_n\f$ so that $r_i$ is the minimum distance to all the blocks
+/** The class constructor sets up the geometry of the blocks, and computes the
+ * minimum distances associated with the default worklists. The pre-computed
+ * worklists assume that the blocks are roughly cubic. If the ratio of the
+ * longest to the shortest block side exceeds wl_max_aspect, then worklists are
+ * instead generated for the real block geometry, so that the blocks are tested
+ * in order of their true distance. Since generating the worklists is costly,
+ * they can instead be copied from another class with the same block geometry.
+ * \param[in] (nx_,ny_,nz_) the number of blocks in each of the three
+ *			    coordinate directions.
+ * \param[in] (boxx_,boxy_,boxz_) the dimensions of a block.
+ * \param[in] vb a class with the same block dimensions to copy the worklists
+ *		 and their radii from, or NULL to compute them. */
+voro_base::voro_base(int nx_,int ny_,int nz_,double boxx_,double boxy_,double boxz_,const voro_base *vb) :
+	nx(nx_), ny(ny_), nz(nz_), nxy(nx_*ny_), nxyz(nxy*nz_), boxx(boxx_), boxy(boxy_), boxz(boxz_),
+	xsp(1/boxx_), ysp(1/boxy_), zsp(1/boxz_), mrad(new double[wl_hgridcu*wl_seq_length]),
+	wl(worklist_default::wl), cutoff(-1), cutoff_sphere(false), slots(0), peak_slots(0), gwl(NULL) {
+	if(vb!=NULL) {
+		if(vb->gwl!=NULL) {
+			gwl=new unsigned int[wl_hgridcu*wl_seq_length];
+			for(int i=0;i<wl_hgridcu*wl_seq_length;i++) gwl[i]=vb->gwl[i];
+			wl=gwl;
+		}
+		for(int i=0;i<wl_hgridcu*wl_seq_length;i++) mrad[i]=vb->mrad[i];
+		return;
+	}
+	double bmin=boxx<boxy?boxx:boxy,bmax=boxx>boxy?boxx:boxy;
+	if(boxz<bmin) bmin=boxz;
+	if(boxz>bmax) bmax=boxz;
+	if(bmax>wl_max_aspect*bmin) {
+		gwl=new unsigned int[wl_hgridcu*wl_seq_length];
+		generate_worklists(gwl,wl_hgrid,wl_seq_length);
+		wl=gwl;
+	}
+	worklist_radii(wl,wl_hgrid,wl_seq_length,mrad);
+}
+
+/** Generates a table of worklists for the block geometry of this class, using
+ * the same method as the worklist_gen.pl script. For each subregion, the
+ * worklist is grown outwards from the block containing it, each time adding
+ * the neighboring block that is closest to the center of the subregion. The
+ * distances are measured using the real block dimensions, scaled so that a
+ * block has unit volume, so that for cubic blocks the table matches the
+ * pre-computed one.
+ * \param[out] e an array of size seq_length*hgrid^3 in which to store the
+ *		 worklists.
+ * \param[in] hgrid half the number of subregions that a block is divided
+ *		    into.
+ * \param[in] seq_length the number of elements in each worklist. */
+void voro_base::generate_worklists(unsigned int *e,int hgrid,int seq_length) {
+	double l=pow(boxx*boxy*boxz,1/3.0);
+	for(int kk=0;kk<hgrid;kk++) for(int jj=0;jj<hgrid;jj++) for(int ii=0;ii<hgrid;ii++)
+		generate_worklist(e,ii,jj,kk,hgrid,seq_length,boxx/l,boxy/l,boxz/l);
+}
+
+/** Adds a set of counters to the totals for the container. Since this is
+ * called as the voro_compute classes of the threaded routines are deleted,
+ * the update is made in a critical section.
+ * \param[in] vt the counters to add. */
+void voro_base::merge_counters(const voro_counters &vt) {
+#ifdef _OPENMP
+#pragma omp critical(voro_counters)
+#endif
+	counters.merge(vt);
+}
+
+/** Returns the memory used by the worklist radii, any worklist table that was
+ * generated for the block geometry, and the cutoff planes.
+ * \return The number of bytes. */
+size_t voro_base::worklist_memory() {
+	size_t s=wl_hgridcu*wl_seq_length*sizeof(double)+cplanes.capacity()*sizeof(double);
+	if(gwl!=NULL) s+=wl_hgridcu*wl_seq_length*sizeof(unsigned int);
+	return s;
+}
+
+/** Sets a cutoff distance that bounds the Voronoi cells. Each cell is
+ * initialized as the intersection of its usual starting shape with a cube or
+ * sphere of the given size centered on the particle, so that a cell can only
+ * be cut by the particles within twice the largest distance from the particle
+ * to the cube or sphere. Since the voro_compute routines stop searching once the untested blocks are
+ * further away than twice the largest distance to a vertex of the cell, this
+ * limits the search, which can greatly speed up the computation in dilute or
+ * clustered systems. A sphere is approximated by the polyhedron made from its
+ * 26 tangent planes normal to the faces, edges, and corners of a cube, which
+ * reaches at most 1.13 times the cutoff distance from the particle.
+ * \param[in] r the cutoff distance, which is half the side length of the
+ *		 cube or the radius of the sphere.
+ * \param[in] sphere whether to use a sphere instead of a cube. */
+void voro_base::set_cutoff(double r,bool sphere) {
+	if(r<=0) voro_fatal_error("Cutoff distance must be positive",VOROPP_INTERNAL_ERROR);
+	double rsq=4*r*r,m;
+	int i,j,k;
+	cutoff=r;cutoff_sphere=sphere;
+	cplanes.clear();
+	for(k=-1;k<=1;k++) for(j=-1;j<=1;j++) for(i=-1;i<=1;i++) {
+		m=i*i+j*j+k*k;
+		if(m==0||(!sphere&&m>1)) continue;
+		m=2*r/sqrt(m);
+		cplanes.push_back(i*m);cplanes.push_back(j*m);
+		cplanes.push_back(k*m);cplanes.push_back(rsq);
+	}
+}
+
+/** Generates the worklist for a single subregion, as a part of the
+ * generate_worklists() routine. The blocks are marked in a map, since for
+ * elongated blocks a worklist can extend a long way in one direction.
+ * \param[in,out] e a pointer to the position in which to store the worklist,
+ *		     which is advanced past it.
+ * \param[in] (ii,jj,kk) the index of the subregion.
+ * \param[in] hgrid half the number of subregions that a block is divided
+ *		    into.
+ * \param[in] seq_length the number of elements in each worklist.
+ * \param[in] (sx,sy,sz) the scaled dimensions of a block. */
+void voro_base::generate_worklist(unsigned int *&e,int ii,int jj,int kk,int hgrid,int seq_length,double sx,double sy,double sz) {
+	const int d=256,dd=d*d,d0=128*(1+d+dd);
+	const int dx[6]={1,0,0,-1,0,0},dy[6]={0,1,0,0,-1,0},dz[6]={0,0,1,0,0,-1};
+	std::map<int,int> m,la;
+	std::vector<int> a,b;
+	double x=(ii+0.5)/(2*hgrid),y=(jj+0.5)/(2*hgrid),z=(kk+0.5)/(2*hgrid);
+	double xc,yc,zc,wei,minwei;
+	int i,j,l,q,xp=0,yp=0,zp=0,xt,yt,zt,k,n=0,on=6;
+	unsigned int o;
+
+	// Grow the worklist one block at a time. Unlisted blocks adjacent to
+	// the worklist are held in a, and each step picks the one at the
+	// smallest distance from the subregion center, with a small penalty
+	// for jumping away from the previously added block. The compute_cell
+	// routine relies on the six neighbors of the central block being on
+	// the worklist, so for very elongated blocks, where the far neighbors
+	// would not be reached, the last entries are reserved for them.
+	m[d0]=1;
+	for(q=0;q<6;q++) if(m[d0+dx[q]+d*dy[q]+dd*dz[q]]!=1) {
+		m[d0+dx[q]+d*dy[q]+dd*dz[q]]=1;
+		a.push_back(dx[q]);a.push_back(dy[q]);a.push_back(dz[q]);
+	}
+	for(l=1;l<seq_length;l++) {
+		minwei=large_number;
+		for(i=0;i<(int) a.size();i+=3) {
+			xt=a[i];yt=a[i+1];zt=a[i+2];
+			if(on>=seq_length-l&&abs(xt)+abs(yt)+abs(zt)!=1) continue;
+			xc=xt>0?x-xt:(xt<0?x-xt-1:0);
+			yc=yt>0?y-yt:(yt<0?y-yt-1:0);
+			zc=zt>0?z-zt:(zt<0?z-zt-1:0);
+			wei=sqrt(sx*sx*xc*xc+sy*sy*yc*yc+sz*sz*zc*zc)
+			   +0.02*sqrt(sx*sx*(xt-xp)*(xt-xp)+sy*sy*(yt-yp)*(yt-yp)+sz*sz*(zt-zp)*(zt-zp));
+			if(wei<minwei) {n=i;minwei=wei;}
+		}
+		xp=a[n];yp=a[n+1];zp=a[n+2];
+		if(abs(xp)+abs(yp)+abs(zp)==1) on--;
+		for(q=0;q<6;q++) {
+			xt=xp+dx[q];yt=yp+dy[q];zt=zp+dz[q];
+			if(xt<-63||xt>62||yt<-63||yt>62||zt<-63||zt>62) continue;
+			k=d0+xt+d*yt+dd*zt;
+			if(m[k]!=1) {
+				m[k]=1;
+				a.push_back(xt);a.push_back(yt);a.push_back(zt);
+			}
+		}
+		b.insert(b.end(),a.begin()+n,a.begin()+n+3);
+		a.erase(a.begin()+n,a.begin()+n+3);
+	}
+
+	// Mark all blocks that are on the worklist, and then find which
+	// neighboring outside blocks need to be marked when considering each
+	// block. The marks are overwritten so that the last entry that can
+	// reach a block is used.
+	m[d0]=2;
+	for(i=0;i<(int) b.size();i+=3) m[d0+b[i]+d*b[i+1]+dd*b[i+2]]=2;
+	for(i=j=0;i<(int) b.size();i+=3,j++) {
+		k=d0+b[i]+d*b[i+1]+dd*b[i+2];
+		for(q=0;q<6;q++) {
+			if((dx[q]!=0&&dx[q]*b[i]<0)||(dy[q]!=0&&dy[q]*b[i+1]<0)||(dz[q]!=0&&dz[q]*b[i+2]<0)) continue;
+			int kn=k+dx[q]+d*dy[q]+dd*dz[q];
+			if(m[kn]!=2) {la[kn]=j;m[kn]=3;}
+		}
+	}
+
+	// Check that no neighboring blocks have been missed, and count the
+	// number of entries where outside blocks do not need to be considered
+	for(i=0;i<(int) b.size();i+=3) {
+		k=d0+b[i]+d*b[i+1]+dd*b[i+2];
+		for(q=0;q<6;q++) if(m[k+dx[q]+d*dy[q]+dd*dz[q]]<2)
+			voro_fatal_error("Failure in worklist construction",VOROPP_INTERNAL_ERROR);
+	}
+	for(i=j=0;i<(int) b.size();i+=3,j++) {
+		k=d0+b[i]+d*b[i+1]+dd*b[i+2];
+		for(q=0;q<6;q++) if(m[k+dx[q]+d*dy[q]+dd*dz[q]]!=2) break;
+		if(q<6) break;
+	}
+	*(e++)=j;
+
+	// Encode the worklist entries, together with the bits that mark which
+	// outside neighbors must be added to the mask
+	for(i=j=0;i<(int) b.size();i+=3,j++) {
+		xt=b[i];yt=b[i+1];zt=b[i+2];
+		k=d0+xt+d*yt+dd*zt;
+		o=0;
+		if(m[k+1]!=2&&la[k+1]==j) o|=1;
+		if(m[k-1]!=2&&la[k-1]==j) o^=3;
+		if(m[k+d]!=2&&la[k+d]==j) o|=8;
+		if(m[k-d]!=2&&la[k-d]==j) o^=24;
+		if(m[k+dd]!=2&&la[k+dd]==j) o|=64;
+		if(m[k-dd]!=2&&la[k-dd]==j) o^=192;
+		*(e++)=(xt+64)|(yt+64)<<7|(zt+64)<<14|o<<21;
+	}
+}
+
+/** This function scans all of the worklists in a table. For a given worklist
+ * of blocks labeled \f$w_1\f$ to \f$w_n\f$, it computes a sequence \f$r_0\f$
+ * to \f$r_n\f$ so that $r_i$ is the minimum distance to all the blocks
  * \f$w_{j}\f$ where \f$j>i\f$ and all blocks outside the worklist. The values
  * of \f$r_n\f$ is calculated first, as the minimum distance to any block in
  * the shell surrounding the worklist. The \f$r_i\f$ are then computed in
- * reverse order by considering the distance to \f$w_{i+1}\f$. */
-voro_base::voro_base(int nx_,int ny_,int nz_,double boxx_,double boxy_,double boxz_) :
-	nx(nx_), ny(ny_), nz(nz_), nxy(nx_*ny_), nxyz(nxy*nz_), boxx(boxx_), boxy(boxy_), boxz(boxz_),
-	xsp(1/boxx_), ysp(1/boxy_), zsp(1/boxz_), mrad(new double[wl_hgridcu*wl_seq_length]) {
+ * reverse order by considering the distance to \f$w_{i+1}\f$.
+ * \param[in] e a pointer to the table of worklists.
+ * \param[in] hgrid half the number of subregions that a block is divided into.
+ * \param[in] seq_length the number of elements in each worklist.
+ * \param[out] radp an array of size seq_length*hgrid^3 in which to store the
+ *		    minimum distances. */
+void voro_base::worklist_radii(const unsigned int *e,int hgrid,int seq_length,double *radp) {
 	const unsigned int b1=1<<21,b2=1<<22,b3=1<<24,b4=1<<25,b5=1<<27,b6=1<<28;
-	const double xstep=boxx/wl_fgrid,ystep=boxy/wl_fgrid,zstep=boxz/wl_fgrid;
+	const double xstep=boxx/(2*hgrid),ystep=boxy/(2*hgrid),zstep=boxz/(2*hgrid);
 	int i,j,k,lx,ly,lz,q;
-	unsigned int f,*e=const_cast<unsigned int*> (wl);
-	double xlo,ylo,zlo,xhi,yhi,zhi,minr,*radp=mrad;
-	for(zlo=0,zhi=zstep,lz=0;lz<wl_hgrid;zlo=zhi,zhi+=zstep,lz++) {
-		for(ylo=0,yhi=ystep,ly=0;ly<wl_hgrid;ylo=yhi,yhi+=ystep,ly++) {
-			for(xlo=0,xhi=xstep,lx=0;lx<wl_hgrid;xlo=xhi,xhi+=xstep,lx++) {
+	unsigned int f;
+	double xlo,ylo,zlo,xhi,yhi,zhi,minr;
+	for(zlo=0,zhi=zstep,lz=0;lz<hgrid;zlo=zhi,zhi+=zstep,lz++) {
+		for(ylo=0,yhi=ystep,ly=0;ly<hgrid;ylo=yhi,yhi+=ystep,ly++) {
+			for(xlo=0,xhi=xstep,lx=0;lx<hgrid;xlo=xhi,xhi+=xstep,lx++) {
 				minr=large_number;
-				for(q=e[0]+1;q<wl_seq_length;q++) {
+				for(q=e[0]+1;q<seq_length;q++) {
 					f=e[q];
 					i=(f&127)-64;
 					j=(f>>7&127)-64;
@@ -61,8 +274,8 @@ voro_base::voro_base(int nx_,int ny_,int nz_,double boxx_,double boxy_,double bo
 					q--;
 				}
 				*radp=minr;
-				e+=wl_seq_length;
-				radp+=wl_seq_length;
+				e+=seq_length;
+				radp+=seq_length;
 			}
 		}
 	}
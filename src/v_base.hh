@@ -10,6 +10,10 @@
 #ifndef VOROPP_V_BASE_HH
 #define VOROPP_V_BASE_HH
 
+#include <vector>
+
+#include "config.hh"
+#include "common.hh"
 #include "worklist.hh"
 
 namespace voro {
@@ -53,11 +57,48 @@ class voro_base {
 		 * worklists. This array is initialized during container
 		 * construction, by the initialize_radii() routine. */
 		double *mrad;
-		/** The pre-computed block worklists. */
-		static const unsigned int wl[wl_seq_length*wl_hgridcu];
+		/** A pointer to the block worklists that are used by default.
+		 * This is the pre-computed table of worklist_default, unless
+		 * the blocks are far from cubic, in which case a table is
+		 * generated for the real block geometry during construction. */
+		const unsigned int *wl;
+		/** The cutoff distance that bounds the initial Voronoi cells,
+		 * or a negative value if no cutoff is used. */
+		double cutoff;
+		/** Whether the cutoff is a sphere, approximated by a
+		 * circumscribing polyhedron, rather than a cube. */
+		bool cutoff_sphere;
+		/** The counters of the voro_compute classes that have been
+		 * used on the container and deleted, such as those made for
+		 * each thread by the threaded routines. These are only
+		 * updated if VOROPP_COUNTERS is set. */
+		voro_counters counters;
 		bool contains_neighbor(const char* format);
-		voro_base(int nx_,int ny_,int nz_,double boxx_,double boxy_,double boxz_);
-		~voro_base() {delete [] mrad;}
+		voro_base(int nx_,int ny_,int nz_,double boxx_,double boxy_,double boxz_,const voro_base *vb=NULL);
+		~voro_base() {
+			delete [] gwl;
+			delete [] mrad;
+		}
+		void worklist_radii(const unsigned int *e,int hgrid,int seq_length,double *radp);
+		void generate_worklists(unsigned int *e,int hgrid,int seq_length);
+		void set_cutoff(double r,bool sphere=false);
+		void merge_counters(const voro_counters &vt);
+		size_t worklist_memory();
+		/** Switches off the cutoff, so that the Voronoi cells are
+		 * computed in full. */
+		inline void clear_cutoff() {cutoff=-1;cplanes.clear();}
+		/** Cuts a Voronoi cell by the planes of the cutoff, if one has
+		 * been set. The planes are given the ID cutoff_id.
+		 * \param[in,out] c a reference to the Voronoi cell, whose
+		 *		    particle is at the origin.
+		 * \return False if the cell was removed entirely, true
+		 *	   otherwise. */
+		template<class v_cell>
+		inline bool apply_cutoff(v_cell &c) {
+			for(unsigned int l=0;l<cplanes.size();l+=4)
+				if(!c.nplane(cplanes[l],cplanes[l+1],cplanes[l+2],cplanes[l+3],cutoff_id)) return false;
+			return true;
+		}
 	protected:
 		/** A custom int function that returns consistent stepping
 		 * for negative numbers, so that (-1.5, -0.5, 0.5, 1.5) maps
@@ -79,7 +120,51 @@ class voro_base {
 		 * \return The value of a div b, consistent for negative
 		 * numbers. */
 		inline int step_div(int a,int b) {return a>=0?a/b:-1+(a+1)/b;}
+		/** The total number of particle slots allocated in the
+		 * blocks. */
+		size_t slots;
+		/** The largest number of particle slots that have been
+		 * allocated at once. */
+		size_t peak_slots;
+		/** Records a change in the particle memory of a block. Since
+		 * the old and new storage exist together while the particles
+		 * are copied, both are counted towards the peak. The update is
+		 * made in a critical section, since the image blocks of the
+		 * periodic containers can be extended by several threads.
+		 * \param[in] omem the old number of slots in the block.
+		 * \param[in] nmem the new number of slots in the block. */
+		inline void track_slots(int omem,int nmem) {
+#ifdef _OPENMP
+#pragma omp critical(voro_slots)
+#endif
+			{
+				if(slots+nmem>peak_slots) peak_slots=slots+nmem;
+				slots+=nmem-omem;
+			}
+		}
+		/** Recounts the particle slots after the memory of all of the
+		 * blocks has been replaced.
+		 * \param[in] mem the number of slots in each block.
+		 * \param[in] n the number of blocks.
+		 * \param[in] copied whether the old storage was kept until
+		 *		     all of the new storage was filled, in which
+		 *		     case both are counted towards the peak. */
+		inline void recount_slots(const int *mem,int n,bool copied) {
+			size_t s=0;
+			for(const int *mp=mem;mp<mem+n;mp++) s+=*mp;
+			if(copied) s+=slots;
+			if(s>peak_slots) peak_slots=s;
+			slots=s-(copied?slots:0);
+		}
 	private:
+		/** The worklist table that is generated for the block geometry,
+		 * or a null pointer if the pre-computed table is used. */
+		unsigned int *gwl;
+		/** The planes of the cutoff, in groups of four giving the
+		 * normal vector and the squared distance in the form used by
+		 * the plane routines of the Voronoi cell classes. */
+		std::vector<double> cplanes;
+		void generate_worklist(unsigned int *&e,int ii,int jj,int kk,int hgrid,int seq_length,double sx,double sy,double sz);
 		void compute_minimum(double &minr,double &xlo,double &xhi,double &ylo,double &yhi,double &zlo,double &zhi,int ti,int tj,int tk);
 };
 
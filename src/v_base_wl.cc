@@ -5,13 +5,13 @@
 // Date     : August 30th 2011
 
 /** \file v_base_wl.cc
- * \brief The table of block worklists that are used during the cell
- * computation, which is part of the voro_base class.
+ * \brief The tables of block worklists that are used during the cell
+ * computation, for each of the worklist_variant classes.
  *
  * This file is automatically generated by worklist_gen.pl and it is not
  * intended to be edited by hand. */
 
-const unsigned int voro_base::wl[wl_seq_length*wl_hgridcu]={
+template<> const unsigned int worklist_variant<4,64>::wl[4096]={
 	7,0x10203f,0x101fc0,0xfe040,0xfe03f,0x101fbf,0xfdfc0,0xfdfbf,0x10fe0bf,0x11020bf,0x11020c0,0x10fe0c0,0x2fe041,0x302041,0x301fc1,0x2fdfc1,0x8105fc0,0x8106040,0x810603f,0x8105fbf,0x701fbe,0x70203e,0x6fe03e,0x6fdfbe,0x30fdf3f,0x3101f3f,0x3101f40,0x30fdf40,0x180f9fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x12fe0c1,0x13020c1,0x91060c0,0x91060bf,0x8306041,0x8305fc1,0x3301f41,0x32fdf41,0x182f9fc1,0x182fa041,0x190fa0c0,0x190fa0bf,0x16fe0be,0x17020be,0x870603e,0x8705fbe,0xb105f3f,0xb105f40,0x3701f3e,0x36fdf3e,0x186f9fbe,0x186fa03e,0x1b0f9f3f,0x1b0f9f40,0x93060c1,0x192fa0c1,0x97060be,0xb305f41,0x1b2f9f41,0x196fa0be,0xb705f3e,0x1b6f9f3e,
 	11,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0xfdfbf,0xfdfc1,0x101fc1,0x102041,0xfe041,0x10fe0c0,0x11020c0,0x8106040,0x8105fc0,0x8105fbf,0x810603f,0x11020bf,0x10fe0bf,0x180fa040,0x180f9fc0,0x30fdf40,0x3101f40,0x3101f3f,0x30fdf3f,0x180f9fbf,0x180fa03f,0x6fe03e,0x70203e,0x701fbe,0x6fdfbe,0x8105fc1,0x8106041,0x11020c1,0x10fe0c1,0x180fa041,0x180f9fc1,0x30fdf41,0x3101f41,0x91060c0,0x91060bf,0x190fa0c0,0x190fa0bf,0xb105f40,0xb105f3f,0x8705fbe,0x870603e,0x97020be,0x16fe0be,0x1b0f9f40,0x1b0f9f3f,0x36fdf3e,0xb701f3e,0x1b6f9fbe,0x196fa03e,0x93060c1,0xb305f41,0x192fa0c1,0x1b2f9f41,0x1b2fdfc2,0xb301fc2,0x9302042,0x192fe042,
 	11,0x101fc0,0xfe040,0xfdfc0,0xfdfbf,0x101fbf,0x10203f,0xfe03f,0xfe041,0x102041,0x101fc1,0xfdfc1,0x8105fc0,0x8106040,0x11020c0,0x10fe0c0,0x10fe0bf,0x11020bf,0x810603f,0x8105fbf,0x3101f40,0x30fdf40,0x180f9fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x30fdf3f,0x3101f3f,0x8105fc1,0x8106041,0x11020c1,0x10fe0c1,0x180fa041,0x180f9fc1,0x30fdf41,0x3101f41,0x701fbe,0x70203e,0x6fe03e,0x6fdfbe,0x91060c0,0x91060bf,0xb105f40,0xb105f3f,0x190fa0c0,0x190fa0bf,0x93060c1,0x1b0f9f40,0x1b0f9f3f,0xb305f41,0x192fa0c1,0x16fe0be,0x17020be,0x970603e,0x8705fbe,0xb701f3e,0x36fdf3e,0x1b2f9f41,0x1b2fdfc2,0x192fe042,0x9302042,0xb301fc2,0x1b6f9fbe,0x196fa03e,
@@ -77,3 +77,596 @@ const unsigned int voro_base::wl[wl_seq_length*wl_hgridcu]={
 	17,0x10203f,0x101fc0,0xfe040,0xfe03f,0x101fbf,0x106040,0x1020c0,0xfdfc0,0x1020bf,0x10603f,0x102041,0xfdfbf,0x105fc0,0xfe0c0,0xfe0bf,0x105fbf,0x1060c0,0x101fc1,0xfe041,0x1060bf,0x106041,0x1020c1,0x2fdfc1,0x305fc1,0x2fe0c1,0x3060c1,0x70203e,0x6fe03e,0x701fbe,0x70603e,0x7020be,0x6fdfbe,0x3101f40,0x3701f3f,0x180fa040,0x186fa03f,0x6fe0be,0x705fbe,0x30fdf40,0x1b0f9fc0,0x186f9fbf,0x1b6fdf3f,0x3105f40,0x3705f3f,0x97060be,0x830a040,0x870a03f,0x1302140,0x180fa0c0,0x186fa0bf,0x170213f,0x192fe140,0x192fa041,0x3301f41,0xb309fc0,0xb709fbf,0x850a0c0,0x9506140,0x196fe13f,0x182f9fc1,0x1b2fdf41,0xb305f41,0x12302042,
 	16,0x10203f,0x101fc0,0xfe040,0x102041,0x1020c0,0x106040,0x101fbf,0xfe03f,0xfdfc0,0x101fc1,0x105fc0,0x10603f,0x1020bf,0xfe0c0,0xfe041,0xfdfbf,0x1020c1,0x106041,0x1060c0,0x105fbf,0xfe0bf,0xfdfc1,0x105fc1,0x1060bf,0xfe0c1,0x83060c1,0x70203e,0x3101f40,0x180fa040,0x180fa03f,0x186fe03e,0x701fbe,0x3701f3f,0x30fdf40,0x1b0f9fc0,0x180fa041,0x180fa0c0,0x7020be,0x70603e,0x3105f40,0xb101f41,0x9302042,0x1102140,0x930a040,0x6fdfbe,0x36fdf3f,0x1b6f9fbf,0x190fa0bf,0x196fe0be,0x170213f,0x196fe140,0x182f9fc1,0x1b2fdf41,0xb301fc2,0x1a2fe042,0x192fa0c1,0x8705fbe,0xb705f3f,0xb309fc0,0xa70a03f,0x97060be,0x9706140,0x11302141
 };
+
+template<> const unsigned int worklist_variant<2,32>::wl[256]={
+	7,0x10203f,0x101fc0,0xfe040,0xfe03f,0x101fbf,0xfdfc0,0xfdfbf,0x302041,0x13020c0,0x9306040,0x810603f,0x91020bf,0x10fe0c0,0x12fe041,0x301fc1,0x8305fc0,0x8105fbf,0x10fe0bf,0x2fdfc1,0xb301f40,0xb101f3f,0x30fdf3f,0x32fdf40,0x1b2f9fc0,0x192fa040,0x190fa03f,0x1b0f9fbf,0x196fe03e,0x970203e,0xb701fbe,0x1b6fdfbe,
+	3,0x101fc0,0xfe040,0xfdfc0,0x70203f,0x701fbf,0x6fe03f,0x6fdfbf,0x302041,0x301fc1,0x2fe041,0x2fdfc1,0x11020c0,0x9106040,0x8105fc0,0x10fe0c0,0x16fe0bf,0x17020bf,0x970603f,0x8705fbf,0x8306041,0xb305fc1,0x93020c1,0x192fe0c1,0x192fa040,0x182f9fc0,0x1b2fdf40,0xb301f40,0xb701f3f,0x36fdf3f,0x1b6f9fbf,0x196fa03f,
+	3,0x10203f,0xfe040,0xfe03f,0x3101fc0,0x3101fbf,0x30fdfc0,0x30fdfbf,0x11020c0,0x11020bf,0x10fe0c0,0x10fe0bf,0x302041,0x8306040,0x810603f,0x2fe041,0x32fdfc1,0x3301fc1,0xb305fc0,0xb105fbf,0x91060c0,0x97060bf,0x93020c1,0x192fe0c1,0x192fa040,0x190fa03f,0x196fe03e,0x970203e,0xb701fbe,0x36fdfbe,0x1b6f9fbf,0x1b2f9fc0,
+	1,0xfe040,0x70203f,0x3101fc0,0x30fdfc0,0x6fe03f,0x3701fbf,0x36fdfbf,0x302041,0x11020c0,0x10fe0c0,0x2fe041,0x3301fc1,0x32fdfc1,0x17020bf,0x16fe0bf,0x8106040,0x13020c1,0x12fe0c1,0x870603f,0xb105fc0,0xb705fbf,0x8306041,0x91060c0,0x97060bf,0x182fa040,0xb305fc1,0x1b2f9fc0,0x186fa03f,0x1b6f9fbf,0x93060c1,0x194fa0c0,
+	3,0x10203f,0x101fc0,0x101fbf,0x180fe040,0x180fe03f,0x180fdfc0,0x180fdfbf,0x8106040,0x810603f,0x8105fc0,0x8105fbf,0x302041,0x13020c0,0x11020bf,0x301fc1,0x182fdfc1,0x182fe041,0x192fe0c0,0x190fe0bf,0x91060c0,0x97060bf,0x9306041,0xb305fc1,0xb301f40,0xb101f3f,0xb701fbe,0x970203e,0x196fe03e,0x186fdfbe,0x1b6fdf3f,0x1b2fdf40,
+	1,0x101fc0,0x70203f,0x180fe040,0x180fdfc0,0x701fbf,0x186fe03f,0x186fdfbf,0x302041,0x8106040,0x8105fc0,0x301fc1,0x182fe041,0x182fdfc1,0x870603f,0x8705fbf,0x11020c0,0x8306041,0x8305fc1,0x17020bf,0x190fe0c0,0x196fe0bf,0x13020c1,0x91060c0,0x97060bf,0x3301f40,0x192fe0c1,0x1b2fdf40,0x3701f3f,0x1b6fdf3f,0x93060c1,0xb505f40,
+	1,0x10203f,0x3101fc0,0x180fe040,0x180fe03f,0x3101fbf,0x1b0fdfc0,0x1b0fdfbf,0x11020c0,0x8106040,0x810603f,0x11020bf,0x190fe0c0,0x190fe0bf,0xb105fc0,0xb105fbf,0x302041,0x91060c0,0x91060bf,0x3301fc1,0x182fe041,0x1b2fdfc1,0x13020c1,0x8306041,0xb305fc1,0x170203e,0x192fe0c1,0x196fe03e,0x3701fbe,0x1b6fdfbe,0x93060c1,0xa70603e,
+	4,0x10203f,0x101fc0,0xfe040,0xfe03f,0x101fbf,0xfdfc0,0x302041,0x11020c0,0x8106040,0x30fdfbf,0x11020bf,0x810603f,0x8105fc0,0x301fc1,0x2fe041,0x10fe0c0,0x10fe0bf,0xb705fbf,0x1b2fdfc1,0x13020c1,0x8306041,0x91060c0,0x97060bf,0xb305fc1,0x192fe0c1,0x93060c1,0xa70203e,0x13501f40,0x1a2fa040,0x1a0fa03f,0x1a6fe03e
+};
+
+template<> const unsigned int worklist_variant<4,128>::wl[8192]={
+	51,0x10203f,0x101fc0,0xfe040,0xfe03f,0x101fbf,0xfdfc0,0xfdfbf,0xfe0bf,0x1020bf,0x1020c0,0xfe0c0,0xfe041,0x102041,0x101fc1,0xfdfc1,0x105fc0,0x106040,0x10603f,0x105fbf,0x101fbe,0x10203e,0xfe03e,0xfdfbe,0xfdf3f,0x101f3f,0x101f40,0xfdf40,0xf9fc0,0xfa040,0xfa03f,0xf9fbf,0xfe0c1,0x1020c1,0x1060c0,0x1060bf,0x106041,0x105fc1,0x101f41,0xfdf41,0xf9fc1,0xfa041,0xfa0c0,0xfa0bf,0xfe0be,0x1020be,0x10603e,0x105fbe,0x105f3f,0x105f40,0x101f3e,0xfdf3e,0xf9fbe,0xfa03e,0xf9f3f,0xf9f40,0x1060c1,0xfa0c1,0x1060be,0x105f41,0xf9f41,0xfa0be,0x105f3e,0x180f9f3e,0x10fe13f,0x110213f,0x1102140,0x10fe140,0x2fe042,0x302042,0x301fc2,0x2fdfc2,0x8109fc0,0x810a040,0x810a03f,0x8109fbf,0x701fbd,0x70203d,0x186fe03d,0x186fdfbd,0x1b0fdebf,0x3101ebf,0x3101ec0,0x1b0fdec0,0x1b0f5fc0,0x180f6040,0x186f603f,0x1b6f5fbf,0x2fe0c2,0x3020c2,0x1302141,0x12fe141,0x1306140,0x110613f,0x910a0bf,0x910a0c0,0x910a041,0x8109fc1,0x8305fc2,0x9306042,0x8301f42,0x2fdf42,0x32f9fc2,0x12fa042,0x12fa140,0x10fa13f,0x190fe13e,0x910213e,0x910a03e,0x8109fbe,0x8709f3f,0x8309f40,0xb105ec0,0xb105ebf,0xb301ec1,0x1b2fdec1,0x1b2f5fc1,0x182f6041,0x192f60c0,0x196f60bf,0x196fe0bd,0x17020bd,0x970603d,0x8705fbd,0x8701f3d,0x186fdf3d,0x1b6fdebe,0xb701ebe,
+	45,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0xfdfbf,0xfdfc1,0x101fc1,0x102041,0xfe041,0xfe0c0,0x1020c0,0x106040,0x105fc0,0x105fbf,0x10603f,0x1020bf,0xfe0bf,0xfa040,0xf9fc0,0xfdf40,0x101f40,0x101f3f,0xfdf3f,0xf9fbf,0xfa03f,0xfe03e,0x10203e,0x101fbe,0xfdfbe,0x105fc1,0x106041,0x1020c1,0xfe0c1,0xfa041,0xf9fc1,0xfdf41,0x101f41,0x1060c0,0x1060bf,0xfa0c0,0xfa0bf,0x105f40,0x105f3f,0x105fbe,0x10603e,0x1020be,0xfe0be,0xf9f40,0xf9f3f,0xfdf3e,0x101f3e,0xf9fbe,0xfa03e,0x1060c1,0x105f41,0xfa0c1,0xf9f41,0x2fdfc2,0x301fc2,0x302042,0x2fe042,0x7060be,0x6fa0be,0x705f3e,0x1b6f9f3e,0x10fe140,0x1102140,0x110213f,0x10fe13f,0x810a040,0x8109fc0,0x8109fbf,0x810a03f,0x306042,0x305fc2,0x3020c2,0x2fe0c2,0x180f6040,0x180f5fc0,0x186f5fbf,0x186f603f,0x1b0fdec0,0x3101ec0,0x3701ebf,0x1b6fdebf,0x2fdf42,0x301f42,0x32f9fc2,0x2fa042,0x12fe141,0x1302141,0x830a041,0x8309fc1,0x810a0c0,0x810a0bf,0x9106140,0x910613f,0x970203d,0x196fe03d,0x1b6fdfbd,0xb701fbd,0x8109f3f,0x8109f40,0x3301ec1,0x1b2fdec1,0x182f5fc1,0x182f6041,0x10fa140,0x10fa13f,0x192f60c0,0x196f60bf,0x196fe13e,0x970213e,0x970a03e,0xb709fbe,0xb705ebf,0xb305ec0,0x3060c2,0x1306141,0x930a0c1,0x3305f42,0xb309f41,0x182fa0c2,0x192fa141,0x1b4f5f40,
+	49,0x101fc0,0xfe040,0xfdfc0,0xfdfbf,0x101fbf,0x10203f,0xfe03f,0xfe041,0x102041,0x101fc1,0xfdfc1,0x105fc0,0x106040,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x10603f,0x105fbf,0x101f40,0xfdf40,0xf9fc0,0xfa040,0xfa03f,0xf9fbf,0xfdf3f,0x101f3f,0x105fc1,0x106041,0x1020c1,0xfe0c1,0xfa041,0xf9fc1,0xfdf41,0x101f41,0x101fbe,0x10203e,0xfe03e,0xfdfbe,0x1060c0,0x1060bf,0x105f40,0x105f3f,0xfa0c0,0xfa0bf,0x1060c1,0xf9f40,0xf9f3f,0x105f41,0xfa0c1,0xfe0be,0x1020be,0x10603e,0x105fbe,0x101f3e,0xfdf3e,0xf9f41,0x2fdfc2,0x2fe042,0x302042,0x301fc2,0xf9fbe,0xfa03e,0x7060be,0x810a040,0x8109fc0,0x305fc2,0x306042,0x3020c2,0x2fe0c2,0x10fe140,0x1102140,0x170213f,0x6fa0be,0x16fe13f,0x705f3e,0x8709fbf,0x870a03f,0x301f42,0x2fdf42,0x2f9fc2,0x2fa042,0x6f9f3e,0x30fdec0,0x3101ec0,0x3701ebf,0x36fdebf,0x180f5fc0,0x180f6040,0x186f603f,0x186f5fbf,0x12fe141,0x1302141,0x830a041,0x8309fc1,0x3060c2,0x1106140,0x910a0c0,0x870a0bf,0x970613f,0x182f6041,0x182f5fc1,0x32fdec1,0x3301ec1,0x305f42,0x8109f40,0x8709f3f,0xb105ec0,0xb705ebf,0x192fa0c2,0x12fa140,0x16fa13f,0x192f60c0,0x196f60bf,0x1b2f9f42,0x1306141,0x930a0c1,0x8309f41,0xb305ec1,0x32f9ec0,0x1b2f5f40,0x186f5f3f,0x1b6f9ebf,0x1b6fdfbd,0xb701fbd,0x970203d,0x196fe03d,
+	37,0x101fc0,0xfe040,0xfdfc0,0xfdfbf,0x101fbf,0x10203f,0xfe03f,0xfe041,0x102041,0x101fc1,0xfdfc1,0x105fc0,0x106040,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x10603f,0x105fbf,0x101f40,0xfdf40,0xf9fc0,0xfa040,0xfe0c1,0x1020c1,0x106041,0x105fc1,0x101f3f,0xfdf3f,0xf9fbf,0xfa03f,0xfa041,0xf9fc1,0xfdf41,0x101f41,0x1060c0,0x1060bf,0x70203e,0x701fbe,0x6fdfbe,0x6fe03e,0xfa0c0,0x105f40,0x105f3f,0x1060c1,0xfa0bf,0xfa0c1,0xf9f40,0xf9f3f,0x105f41,0x301fc2,0x302042,0x2fe042,0x2fdfc2,0xf9f41,0x6fe0be,0x7020be,0x70603e,0x705fbe,0x701f3e,0x6fdf3e,0x6f9fbe,0x6fa03e,0x2fe0c2,0x3020c2,0x306042,0x305fc2,0x301f42,0x2fdf42,0x2f9fc2,0x2fa042,0x10fe140,0x1102140,0x810a040,0x8109fc0,0x8709fbf,0x7060be,0x170213f,0x16fe13f,0x6fa0be,0x870a03f,0x830a041,0x8309fc1,0x705f3e,0x3101ec0,0x30fdec0,0x180f5fc0,0x180f6040,0x12fe141,0x1302141,0x3060c2,0x2fa0c2,0x182f6041,0x186f603f,0x6f9f3e,0x36fdebf,0x3701ebf,0x305f42,0x3301ec1,0x32fdec1,0x186f5fbf,0x182f5fc1,0x2f9f42,0x1106140,0x910a0c0,0x870a0bf,0x970613f,0x1306141,0x930a0c1,0x8109f40,0x8709f3f,0xb105ec0,0x8309f41,0x10fa140,0x16fa13f,0x190f60c0,0x12fa141,0x196f60bf,0x192f60c1,0x180f5f40,0x1b0f9ec0,0xb705ebf,0xb305ec1,0x36f9ebf,0x1b6f5f3f,0x182f5f41,0x1b2f9ec1,
+	45,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0xfdfbf,0xfe0bf,0x1020bf,0x1020c0,0xfe0c0,0xfe041,0x102041,0x106040,0x10603f,0x105fbf,0x105fc0,0x101fc1,0xfdfc1,0xfa040,0xfa03f,0xfe03e,0x10203e,0x101fbe,0xfdfbe,0xf9fbf,0xf9fc0,0xfdf40,0x101f40,0x101f3f,0xfdf3f,0x1060bf,0x1060c0,0x1020c1,0xfe0c1,0xfa0c0,0xfa0bf,0xfe0be,0x1020be,0x106041,0x105fc1,0xfa041,0xf9fc1,0x10603e,0x105fbe,0x105f3f,0x105f40,0x101f41,0xfdf41,0xfa03e,0xf9fbe,0xfdf3e,0x101f3e,0xf9f3f,0xf9f40,0x1060c1,0x1060be,0xfa0c1,0xfa0be,0x10fe13f,0x110213f,0x1102140,0x10fe140,0x3105f41,0x30f9f41,0x3105f3e,0x1b6f9f3e,0x2fe042,0x302042,0x301fc2,0x2fdfc2,0x810a040,0x810a03f,0x8109fbf,0x8109fc0,0x1106140,0x110613f,0x1102141,0x10fe141,0x180f6040,0x180f603f,0x1b0f5fbf,0x1b0f5fc0,0x186fe03d,0x70203d,0x3701fbd,0x1b6fdfbd,0x10fe13e,0x110213e,0x16fa13f,0x10fa140,0x12fe0c2,0x13020c2,0x910a0c0,0x910a0bf,0x810a041,0x8109fc1,0x8306042,0x8305fc2,0xb301ec0,0x1b2fdec0,0x1b6fdebf,0xb701ebf,0x8109fbe,0x810a03e,0x17020bd,0x196fe0bd,0x190f60bf,0x190f60c0,0x2fa042,0x2f9fc2,0x192f6041,0x1b2f5fc1,0x1b2fdf42,0xb301f42,0xb309f40,0xb709f3f,0xb705fbd,0x970603d,0x1106141,0x13060c2,0x930a0c1,0x170613e,0x970a0be,0x190fa141,0x192fa0c2,0x1a6f603e,
+	48,0xfe040,0x10203f,0x101fc0,0xfdfc0,0xfe03f,0xfdfbf,0x101fbf,0x102041,0xfe041,0xfe0c0,0x1020c0,0x1020bf,0xfe0bf,0xfdfc1,0x101fc1,0x106040,0x10603f,0x105fc0,0x105fbf,0xfa040,0xf9fc0,0xfa03f,0xf9fbf,0xfe0c1,0x1020c1,0x10203e,0xfe03e,0xfdfbe,0x101fbe,0x101f3f,0x101f40,0xfdf40,0xfdf3f,0x106041,0x1060c0,0x1060bf,0x105fc1,0xfa041,0xfa0c0,0xfa0bf,0xf9fc1,0xfdf41,0x101f41,0x1020be,0xfe0be,0x1060c1,0x10603e,0x105fbe,0x105f3f,0x105f40,0xfa0c1,0xf9f40,0xf9f3f,0xf9fbe,0xfa03e,0xfdf3e,0x101f3e,0x1060be,0x105f41,0xf9f41,0x2fdfc2,0x2fe042,0x302042,0x301fc2,0x1102140,0x10fe140,0xfa0be,0x10fe13f,0x110213f,0x810a040,0x810a03f,0x3105f3e,0x8109fbf,0x8109fc0,0x3020c2,0x2fe0c2,0x12fe141,0x1302141,0x1106140,0x110613f,0x1b6f9f3e,0x1b6f5fbf,0x180f6040,0x1b0f5fc0,0x186f603f,0x306042,0x305fc2,0x830a041,0x910a0c0,0x910a0bf,0x8309fc1,0x2fa042,0x2f9fc2,0x10fa140,0x10fa13f,0x190fe13e,0x110213e,0x70203d,0x186fe03d,0x1b6fdfbd,0x3701fbd,0xb701ebf,0xb101ec0,0x1b0fdec0,0x182fdf42,0x8301f42,0x3060c2,0x1306141,0x930a0c1,0x1b6fdebf,0x1b2f5fc1,0x182f6041,0x192f60c0,0x196f60bf,0x190fa141,0x192fa0c2,0xb309f40,0xb109f3f,0xb109fbe,0x910a03e,0x17020bd,0x196fe0bd,0x970613e,0x970603d,0xb705fbd,0xb301ec1,0x1b2fdec1,
+	46,0xfe040,0x101fc0,0xfdfc0,0xfe03f,0x10203f,0x101fbf,0xfdfbf,0xfe041,0x102041,0x101fc1,0xfdfc1,0xfe0c0,0x1020c0,0x1020bf,0xfe0bf,0x106040,0x105fc0,0x10603f,0x105fbf,0x1020c1,0xfe0c1,0xfa040,0xf9fc0,0xfa03f,0xf9fbf,0xfdf40,0x101f40,0x106041,0x105fc1,0x101f3f,0xfdf3f,0x1060c0,0x1060bf,0xfa041,0xf9fc1,0xfe03e,0x10203e,0x101fbe,0xfdfbe,0xfa0c0,0xfa0bf,0xfdf41,0x101f41,0x1060c1,0xfa0c1,0x105f40,0x105f3f,0x1020be,0xfe0be,0x10603e,0x105fbe,0xf9f40,0xf9f3f,0xf9fbe,0xfa03e,0x105f41,0x301fc2,0x302042,0x2fe042,0x2fdfc2,0xf9f41,0xfdf3e,0x101f3e,0x7060be,0x1102140,0x10fe140,0x10fe13f,0x110213f,0x6fa0be,0x2fe0c2,0x3020c2,0x306042,0x305fc2,0x810a040,0x8109fc0,0x810a03f,0x8109fbf,0x1302141,0x12fe141,0x2fa042,0x2f9fc2,0x2fdf42,0x301f42,0x3705f3e,0x1b6f9f3e,0x1b0f5fc0,0x180f6040,0x186f603f,0x1b6f5fbf,0x1106140,0x110613f,0x830a041,0x8309fc1,0x3060c2,0x910a0c0,0x910a0bf,0x10fa140,0x10fa13f,0x2fa0c2,0x182f6041,0x1b2f5fc1,0x1b0fdec0,0x3101ec0,0x3701ebf,0x1b6fdebf,0x1306141,0x930a0c1,0x12fa141,0x190f60c0,0x196f60bf,0x196fe13e,0x970213e,0x970203d,0x196fe03d,0x1b6fdfbd,0xb701fbd,0x8109f40,0x3305f42,0x3301ec1,0x1b2fdec1,0x1b2f9f42,0x192f60c1,0xb109f3f,0xb709fbe,0x970a03e,0xb309f41,0xb505ec0,
+	40,0xfe040,0x101fc0,0xfdfc0,0xfe03f,0x10203f,0x101fbf,0xfdfbf,0xfe041,0x102041,0x101fc1,0xfdfc1,0xfe0c0,0x1020c0,0x1020bf,0xfe0bf,0x106040,0x105fc0,0x1020c1,0xfe0c1,0x10603f,0x105fbf,0xfa040,0xf9fc0,0x106041,0x105fc1,0x101f40,0xfa03f,0xf9fbf,0xfdf40,0xfa041,0xf9fc1,0x1060c0,0x101f3f,0xfdf3f,0xfdf41,0x101f41,0x1060bf,0xfa0c0,0x1060c1,0xfa0bf,0x6fe03e,0x70203e,0x701fbe,0x6fdfbe,0xfa0c1,0x2fe042,0x105f40,0x105f3f,0x302042,0x301fc2,0x2fdfc2,0xf9f40,0xf9f3f,0x105f41,0x7020be,0x6fe0be,0x70603e,0x705fbe,0xf9f41,0x2fe0c2,0x3020c2,0x306042,0x305fc2,0x1102140,0x10fe140,0x6fa03e,0x6f9fbe,0x6fdf3e,0x701f3e,0x110213f,0x10fe13f,0x10fe141,0x1302141,0x2fa042,0x2f9fc2,0x2fdf42,0x301f42,0x7060be,0x810a040,0x8109fc0,0x870a03f,0x8709fbf,0x6fa0be,0x3060c2,0x830a041,0x8309fc1,0x1106140,0x110613f,0x910a0c0,0x2fa0c2,0x180f6040,0x180f5fc0,0x186f603f,0x186f5fbf,0x10fa140,0x10fa13f,0x1306141,0x705f3e,0x36f9f3e,0x182f5fc1,0x182f6041,0x10fa141,0x970a0bf,0x930a0c1,0x3305f42,0x3101ec0,0x30fdec0,0x36fdebf,0x3701ebf,0x3301ec1,0x32fdec1,0x32f9f42,0x190f60c0,0x196f60bf,0x192f60c1,0x196fe13e,0x970213e,0x8109f40,0x8709f3f,0xb309f41,0xb305ec0,0xb705ebf,0x180f5f40,0x1b6f5f3f,0x1b4f9ec0,0x1b2f5f41,0x192fe142,
+	49,0x10203f,0xfe040,0xfe03f,0xfdfbf,0x101fbf,0x101fc0,0xfdfc0,0xfe0c0,0x1020c0,0x1020bf,0xfe0bf,0x10603f,0x106040,0x102041,0xfe041,0xfdfc1,0x101fc1,0x105fc0,0x105fbf,0x10203e,0xfe03e,0xfa03f,0xfa040,0xf9fc0,0xf9fbf,0xfdfbe,0x101fbe,0x1060bf,0x1060c0,0x1020c1,0xfe0c1,0xfa0c0,0xfa0bf,0xfe0be,0x1020be,0x101f3f,0x101f40,0xfdf40,0xfdf3f,0x106041,0x105fc1,0x10603e,0x105fbe,0xfa041,0xf9fc1,0x1060c1,0xfa03e,0xf9fbe,0x1060be,0xfa0c1,0xfdf41,0x101f41,0x105f40,0x105f3f,0x101f3e,0xfdf3e,0xfa0be,0x10fe13f,0x10fe140,0x1102140,0x110213f,0xf9f3f,0xf9f40,0x3105f41,0x810a040,0x810a03f,0x110613f,0x1106140,0x1102141,0x10fe141,0x2fe042,0x302042,0x3301fc2,0x30f9f41,0x32fdfc2,0x3105f3e,0xb109fbf,0xb109fc0,0x110213e,0x10fe13e,0x10fa13f,0x10fa140,0x30f9f3e,0x6fe03d,0x70203d,0x3701fbd,0x36fdfbd,0x180f603f,0x180f6040,0x1b0f5fc0,0x1b0f5fbf,0x12fe0c2,0x13020c2,0x910a0c0,0x910a0bf,0x1106141,0x306042,0x830a041,0xb109fc1,0xb305fc2,0x190f60c0,0x190f60bf,0x16fe0bd,0x17020bd,0x110613e,0x810a03e,0xb109fbe,0x870603d,0xb705fbd,0x192fa141,0x12fa042,0x32f9fc2,0x192f6041,0x1b2f5fc1,0x196fa13e,0x13060c2,0x930a0c1,0x910a0be,0x97060bd,0x16fa03d,0x196f603e,0x1b0f5fbe,0x1b6f9fbd,0x1b6fdebf,0xb701ebf,0xb301ec0,0x1b2fdec0,
+	46,0xfe040,0x10203f,0xfe03f,0xfdfc0,0x101fc0,0x101fbf,0xfdfbf,0xfe0c0,0x1020c0,0x1020bf,0xfe0bf,0xfe041,0x102041,0x101fc1,0xfdfc1,0x106040,0x10603f,0x105fc0,0x105fbf,0x1020c1,0xfe0c1,0xfa040,0xfa03f,0xf9fc0,0xf9fbf,0xfe03e,0x10203e,0x1060c0,0x1060bf,0x101fbe,0xfdfbe,0x106041,0x105fc1,0xfa0c0,0xfa0bf,0xfdf40,0x101f40,0x101f3f,0xfdf3f,0xfa041,0xf9fc1,0xfe0be,0x1020be,0x1060c1,0xfa0c1,0x10603e,0x105fbe,0x101f41,0xfdf41,0x105f40,0x105f3f,0xfa03e,0xf9fbe,0xf9f3f,0xf9f40,0x1060be,0x110213f,0x1102140,0x10fe140,0x10fe13f,0xfa0be,0xfdf3e,0x101f3e,0x3105f41,0x302042,0x2fe042,0x2fdfc2,0x301fc2,0x30f9f41,0x10fe141,0x1102141,0x1106140,0x110613f,0x810a040,0x810a03f,0x8109fc0,0x8109fbf,0x13020c2,0x12fe0c2,0x10fa140,0x10fa13f,0x10fe13e,0x110213e,0x3705f3e,0x1b6f9f3e,0x186f603f,0x180f6040,0x1b0f5fc0,0x1b6f5fbf,0x306042,0x305fc2,0x910a0c0,0x910a0bf,0x1106141,0x830a041,0x8309fc1,0x2fa042,0x2f9fc2,0x10fa141,0x190f60c0,0x196f60bf,0x186fe03d,0x70203d,0x3701fbd,0x1b6fdfbd,0x13060c2,0x930a0c1,0x12fa0c2,0x182f6041,0x1b2f5fc1,0x1b2fdf42,0xb301f42,0xb301ec0,0x1b2fdec0,0x1b6fdebf,0xb701ebf,0x810a03e,0x170613e,0x17020bd,0x196fe0bd,0x196fa13e,0x192f60c1,0x8709fbe,0xb709f3f,0xb309f40,0x970a0be,0xa70603d,
+	45,0xfe040,0xfe03f,0x10203f,0x101fc0,0xfdfc0,0xfdfbf,0x101fbf,0x102041,0xfe041,0xfe0c0,0x1020c0,0x1020bf,0xfe0bf,0xfdfc1,0x101fc1,0x106040,0x1020c1,0xfe0c1,0x10603f,0x105fc0,0x105fbf,0xfa040,0xfa03f,0xf9fc0,0xf9fbf,0x106041,0x1060c0,0x1060bf,0x105fc1,0xfa041,0xfa0c0,0xfa0bf,0xfe03e,0x10203e,0x101f40,0xfdf40,0xf9fc1,0xfdf3f,0x101f3f,0x101fbe,0xfdfbe,0x1060c1,0xfa0c1,0xfe0be,0x1020be,0x101f41,0xfdf41,0x105f40,0x105f3f,0x10603e,0x105fbe,0xfa03e,0xf9fbe,0xf9f40,0xf9f3f,0x2fe042,0x302042,0x301fc2,0x2fdfc2,0x10fe140,0x1102140,0x110213f,0x10fe13f,0x1060be,0x3105f41,0x30f9f41,0x2fe0c2,0x3020c2,0x1302141,0x10fe141,0xfa0be,0xfdf3e,0x101f3e,0x810a040,0x306042,0x305fc2,0x1106140,0x110613f,0x810a03f,0x8109fc0,0x8109fbf,0x2fa042,0x2f9fc2,0x10fa140,0x10fa13f,0x180f6040,0x186f603f,0x1b0f5fc0,0x1b6f5fbf,0x3060c2,0x1306141,0x910a0c0,0x830a041,0x8309fc1,0x910a0bf,0x3705f3e,0x1b6f9f3e,0x2fa0c2,0x10fa141,0x10fe13e,0x110213e,0x930a0c1,0x3301f42,0x1b2fdf42,0x182f6041,0x190f60c0,0x196f60bf,0x1b2f5fc1,0x192f60c1,0x186fe03d,0x870203d,0xb701fbd,0x1b6fdfbd,0x1b2fdec0,0xb301ec0,0xb701ebf,0x1b6fdebf,0xb309f40,0xb305f42,0xb109f3f,0x970a03e,0x970613e,0xb709fbe,0x97020bd,0x196fe0bd,0x196fa13e,0x192fe142,
+	43,0xfe040,0xfdfc0,0x101fc0,0x10203f,0xfe03f,0xfdfbf,0x101fbf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x1020c1,0xfe0c1,0x106040,0x105fc0,0x10603f,0x105fbf,0xfa040,0xf9fc0,0x106041,0x105fc1,0x1060c0,0xfa03f,0xf9fbf,0xfa041,0xf9fc1,0xfa0c0,0x1060bf,0x1060c1,0x101f40,0xfdf40,0xfdf3f,0xfa0bf,0xfa0c1,0x101f3f,0x101f41,0xfdf41,0xfe03e,0x10203e,0x101fbe,0xfdfbe,0xfe0be,0x1020be,0x302042,0x2fe042,0x2fdfc2,0x301fc2,0x105f40,0x105f3f,0x105f41,0xf9f40,0xf9f3f,0x10fe140,0x1102140,0x3020c2,0x2fe0c2,0x10fe13f,0x110213f,0x10603e,0x705fbe,0xfa03e,0xf9fbe,0xf9f41,0x10fe141,0x1102141,0x306042,0x305fc2,0x7060be,0x1106140,0x2fa042,0x2f9fc2,0x6fa0be,0xfdf3e,0x701f3e,0x810a040,0x8109fc0,0x3060c2,0x1106141,0x110613f,0x810a03f,0x8109fbf,0x830a041,0x8309fc1,0x301f42,0x2fdf42,0x2fa0c2,0x10fa140,0x10fa13f,0x180f6040,0x1b0f5fc0,0x186f603f,0x10fa141,0x910a0c0,0x910a0bf,0x930a0c1,0x182f6041,0x1b6f5fbf,0x1b2f5fc1,0x190f60c0,0x196f60bf,0x3705f3e,0x1b6f9f3e,0x196fe13e,0x170213e,0x192f60c1,0x3305f42,0x1b2f9f42,0x1b0fdec0,0xb101ec0,0xb701ebf,0x1b6fdebf,0xb109f40,0x9302142,0x192fe142,0x1b2fdec1,0xb301ec1,0xb709f3f,0xb309f41,0xa70a03e,0x970613e,0xa70203d,0x196fe03d,0x1b6fdfbd,
+	37,0x10203f,0xfe040,0xfe03f,0xfdfbf,0x101fbf,0x101fc0,0xfdfc0,0xfe0c0,0x1020c0,0x1020bf,0xfe0bf,0x10603f,0x106040,0x102041,0xfe041,0xfdfc1,0x101fc1,0x105fc0,0x105fbf,0x10203e,0xfe03e,0xfa03f,0xfa040,0xfe0c1,0x1020c1,0x1060c0,0x1060bf,0x101fbe,0xfdfbe,0xf9fbf,0xf9fc0,0xfa0c0,0xfa0bf,0xfe0be,0x1020be,0x106041,0x105fc1,0x3101f40,0x3101f3f,0x30fdf3f,0x30fdf40,0xfa041,0x10603e,0x105fbe,0x1060c1,0xf9fc1,0xfa0c1,0xfa03e,0xf9fbe,0x1060be,0x110213f,0x1102140,0x10fe140,0x10fe13f,0xfa0be,0x30fdf41,0x3101f41,0x3105f40,0x3105f3f,0x3101f3e,0x30fdf3e,0x30f9f3f,0x30f9f40,0x10fe141,0x1102141,0x1106140,0x110613f,0x110213e,0x10fe13e,0x10fa13f,0x10fa140,0x2fe042,0x302042,0x810a040,0x810a03f,0xb109fbf,0x3105f41,0x3301fc2,0x32fdfc2,0x30f9f41,0xb109fc0,0x910a0c0,0x910a0bf,0x3105f3e,0x70203d,0x6fe03d,0x180f603f,0x180f6040,0x12fe0c2,0x13020c2,0x1106141,0x10fa141,0x190f60c0,0x1b0f5fc0,0x30f9f3e,0x36fdfbd,0x3701fbd,0x110613e,0x17020bd,0x16fe0bd,0x1b0f5fbf,0x190f60bf,0x10fa13e,0x306042,0x830a041,0xb109fc1,0xb305fc2,0x13060c2,0x930a0c1,0x810a03e,0xb109fbe,0x870603d,0x910a0be,0x2fa042,0x32f9fc2,0x182f6041,0x12fa0c2,0x1b2f5fc1,0x192f60c1,0x180f603e,0x186fa03d,0xb705fbd,0x97060bd,0x36f9fbd,0x1b6f5fbe,0x190f60be,0x196fa0bd,
+	40,0xfe040,0x10203f,0xfe03f,0xfdfc0,0x101fc0,0x101fbf,0xfdfbf,0xfe0c0,0x1020c0,0x1020bf,0xfe0bf,0xfe041,0x102041,0x101fc1,0xfdfc1,0x106040,0x10603f,0x1020c1,0xfe0c1,0x105fc0,0x105fbf,0xfa040,0xfa03f,0x1060c0,0x1060bf,0x10203e,0xf9fc0,0xf9fbf,0xfe03e,0xfa0c0,0xfa0bf,0x106041,0x101fbe,0xfdfbe,0xfe0be,0x1020be,0x105fc1,0xfa041,0x1060c1,0xf9fc1,0x30fdf40,0x3101f40,0x3101f3f,0x30fdf3f,0xfa0c1,0x10fe140,0x10603e,0x105fbe,0x1102140,0x110213f,0x10fe13f,0xfa03e,0xf9fbe,0x1060be,0x3101f41,0x30fdf41,0x3105f40,0x3105f3f,0xfa0be,0x10fe141,0x1102141,0x1106140,0x110613f,0x302042,0x2fe042,0x30f9f40,0x30f9f3f,0x30fdf3e,0x3101f3e,0x301fc2,0x2fdfc2,0x2fe0c2,0x13020c2,0x10fa140,0x10fa13f,0x10fe13e,0x110213e,0x3105f41,0x810a040,0x810a03f,0xb109fc0,0xb109fbf,0x30f9f41,0x1106141,0x910a0c0,0x910a0bf,0x306042,0x305fc2,0x830a041,0x10fa141,0x180f6040,0x180f603f,0x1b0f5fc0,0x1b0f5fbf,0x2fa042,0x2f9fc2,0x13060c2,0x3105f3e,0x36f9f3e,0x190f60bf,0x190f60c0,0x2fa0c2,0xb309fc1,0x930a0c1,0x170613e,0x70203d,0x6fe03d,0x36fdfbd,0x3701fbd,0x17020bd,0x16fe0bd,0x16fa13e,0x182f6041,0x1b2f5fc1,0x192f60c1,0x1b2fdf42,0xb301f42,0x810a03e,0xb109fbe,0x970a0be,0x970603d,0xb705fbd,0x180f603e,0x1b6f5fbe,0x1a6fa03d,0x196f60be,0x192fe142,
+	43,0xfe040,0xfe03f,0x10203f,0x101fc0,0xfdfc0,0xfdfbf,0x101fbf,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x1020c1,0xfe0c1,0x106040,0x10603f,0x105fc0,0x105fbf,0xfa040,0xfa03f,0x1060c0,0x1060bf,0x106041,0xf9fc0,0xf9fbf,0xfa0c0,0xfa0bf,0xfa041,0x105fc1,0x1060c1,0x10203e,0xfe03e,0xfdfbe,0xf9fc1,0xfa0c1,0x101fbe,0x1020be,0xfe0be,0xfdf40,0x101f40,0x101f3f,0xfdf3f,0xfdf41,0x101f41,0x1102140,0x10fe140,0x10fe13f,0x110213f,0x10603e,0x105fbe,0x1060be,0xfa03e,0xf9fbe,0x2fe042,0x302042,0x1102141,0x10fe141,0x2fdfc2,0x301fc2,0x105f40,0x3105f3f,0xf9f40,0xf9f3f,0xfa0be,0x2fe0c2,0x3020c2,0x1106140,0x110613f,0x3105f41,0x306042,0x10fa140,0x10fa13f,0x30f9f41,0xfdf3e,0x3101f3e,0x810a040,0x810a03f,0x1106141,0x3060c2,0x305fc2,0x8109fc0,0x8109fbf,0x910a0c0,0x910a0bf,0x110213e,0x10fe13e,0x10fa141,0x2fa042,0x2f9fc2,0x180f6040,0x186f603f,0x1b0f5fc0,0x2fa0c2,0x830a041,0x8309fc1,0x930a0c1,0x190f60c0,0x1b6f5fbf,0x196f60bf,0x182f6041,0x1b2f5fc1,0x3705f3e,0x1b6f9f3e,0x1b2fdf42,0x3301f42,0x192f60c1,0x170613e,0x196fa13e,0x186fe03d,0x870203d,0xb701fbd,0x1b6fdfbd,0x870a03e,0x9302142,0x192fe142,0x196fe0bd,0x97020bd,0xb709fbe,0x970a0be,0xb509f40,0xb305f42,0xb501ec0,0x1b2fdec0,0x1b6fdebf,
+	39,0xfe040,0xfe03f,0x10203f,0x101fc0,0xfdfc0,0xfe041,0x102041,0x1020c0,0xfe0c0,0xfdfbf,0x101fbf,0x1020bf,0xfe0bf,0xfdfc1,0x101fc1,0x1020c1,0xfe0c1,0x106040,0x10603f,0x105fc0,0x106041,0x1060c0,0xfa040,0xfa03f,0xf9fc0,0x105fbf,0x1060bf,0x105fc1,0xfa041,0xfa0c0,0xf9fbf,0x1060c1,0xfa0bf,0xf9fc1,0xfa0c1,0xfe03e,0x10203e,0x101f40,0xfdf40,0xfdf3f,0x101f3f,0x101fbe,0xfdfbe,0xfe0be,0x1020be,0x1102140,0x10fe140,0x2fe042,0x302042,0x101f41,0xfdf41,0x2fdfc2,0x301fc2,0x3020c2,0x2fe0c2,0x10fe13f,0x110213f,0x1102141,0x10fe141,0x10603e,0x105f40,0x3105f3f,0x105fbe,0x7060be,0xfa03e,0xf9f40,0x30f9f3f,0x6f9fbe,0x3105f41,0x306042,0x1106140,0x110613f,0x6fa0be,0x10fa140,0x2fa042,0x30f9f41,0x305fc2,0x3060c2,0x1106141,0x810a040,0x810a03f,0x8109fc0,0x2f9fc2,0x2fa0c2,0x10fa141,0x10fa13f,0x910a0c0,0x810a041,0x8109fbf,0x3101f3e,0x36fdf3e,0x180f6040,0x186f603f,0x1b0f5fc0,0x182f6041,0x190f60c0,0x910a0bf,0x8109fc1,0x910a0c1,0x170213e,0x16fe13e,0x1b6f5fbf,0x32fdf42,0x3301f42,0x1b2f5fc1,0x196f60bf,0x192f60c1,0x12fe142,0x1302142,0x3705f3e,0x1b6f9f3e,0x970613e,0xb305f42,0x1b2f9f42,0x1b4fdec0,0xb501ec0,0xb309f40,0x970a03e,0x196fa13e,0x196fe03d,0x970203d,0x13701fbd,0x8709fbe,0xb709f3f,0x9306142,0x192fa142,0xa30a042,
+	45,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0xfdfbf,0x105fbf,0x10603f,0x106040,0x105fc0,0x101fc1,0x102041,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0xfe041,0xfdfc1,0x101f40,0x101f3f,0x101fbe,0x10203e,0xfe03e,0xfdfbe,0xfdf3f,0xfdf40,0xf9fc0,0xfa040,0xfa03f,0xf9fbf,0x1060bf,0x1060c0,0x106041,0x105fc1,0x105f40,0x105f3f,0x105fbe,0x10603e,0x1020c1,0xfe0c1,0x101f41,0xfdf41,0x1020be,0xfe0be,0xfa0bf,0xfa0c0,0xfa041,0xf9fc1,0x101f3e,0xfdf3e,0xf9fbe,0xfa03e,0xf9f3f,0xf9f40,0x1060c1,0x1060be,0x105f41,0x105f3e,0x8109fbf,0x810a03f,0x810a040,0x8109fc0,0x180fa0c1,0x180f9f41,0x180fa0be,0x1b6f9f3e,0x301fc2,0x302042,0x2fe042,0x2fdfc2,0x1102140,0x110213f,0x10fe13f,0x10fe140,0x810a0c0,0x810a0bf,0x810a041,0x8109fc1,0x3101ec0,0x3101ebf,0x1b0fdebf,0x1b0fdec0,0x3701fbd,0x70203d,0x186fe03d,0x1b6fdfbd,0x8109fbe,0x810a03e,0x8709f3f,0x8109f40,0x8305fc2,0x8306042,0x9106140,0x910613f,0x1102141,0x10fe141,0x13020c2,0x12fe0c2,0x192f6040,0x1b2f5fc0,0x1b6f5fbf,0x196f603f,0x10fe13e,0x110213e,0x870603d,0xb705fbd,0xb105ebf,0xb105ec0,0x301f42,0x2fdf42,0xb301ec1,0x1b2fdec1,0x1b2f9fc2,0x192fa042,0x192fa140,0x196fa13f,0x196fe0bd,0x97020bd,0x810a0c1,0x83060c2,0x9306141,0x870a0be,0x970613e,0xb109f41,0xb305f42,0x13701ebe,
+	48,0x101fc0,0x10203f,0xfe040,0xfdfc0,0x101fbf,0xfdfbf,0xfe03f,0x102041,0x101fc1,0x105fc0,0x106040,0x10603f,0x105fbf,0xfdfc1,0xfe041,0x1020c0,0x1020bf,0xfe0c0,0xfe0bf,0x101f40,0xfdf40,0x101f3f,0xfdf3f,0x105fc1,0x106041,0x10203e,0x101fbe,0xfdfbe,0xfe03e,0xfa03f,0xfa040,0xf9fc0,0xf9fbf,0x1020c1,0x1060c0,0x1060bf,0xfe0c1,0x101f41,0x105f40,0x105f3f,0xfdf41,0xf9fc1,0xfa041,0x10603e,0x105fbe,0x1060c1,0x1020be,0xfe0be,0xfa0bf,0xfa0c0,0x105f41,0xf9f40,0xf9f3f,0xfdf3e,0x101f3e,0xf9fbe,0xfa03e,0x1060be,0xfa0c1,0xf9f41,0x2fdfc2,0x301fc2,0x302042,0x2fe042,0x810a040,0x8109fc0,0x105f3e,0x8109fbf,0x810a03f,0x1102140,0x110213f,0x180fa0be,0x10fe13f,0x10fe140,0x306042,0x305fc2,0x8309fc1,0x830a041,0x810a0c0,0x810a0bf,0x1b6f9f3e,0x1b6fdebf,0x3101ec0,0x1b0fdec0,0x3701ebf,0x3020c2,0x2fe0c2,0x1302141,0x9106140,0x910613f,0x12fe141,0x301f42,0x2fdf42,0x8109f40,0x8109f3f,0xb109fbe,0x810a03e,0x70203d,0x3701fbd,0x1b6fdfbd,0x186fe03d,0x196f603f,0x190f6040,0x1b0f5fc0,0x32f9fc2,0x12fa042,0x3060c2,0x830a0c1,0x9306141,0x1b6f5fbf,0x1b2fdec1,0x3301ec1,0xb305ec0,0xb705ebf,0xb109f41,0xb305f42,0x192fa140,0x190fa13f,0x190fe13e,0x910213e,0x870603d,0xb705fbd,0x970a0be,0x97020bd,0x196fe0bd,0x192f6041,0x1b2f5fc1,
+	46,0x101fc0,0xfe040,0xfdfc0,0x101fbf,0x10203f,0xfe03f,0xfdfbf,0x101fc1,0x102041,0xfe041,0xfdfc1,0x105fc0,0x106040,0x10603f,0x105fbf,0x1020c0,0xfe0c0,0x1020bf,0xfe0bf,0x106041,0x105fc1,0x101f40,0xfdf40,0x101f3f,0xfdf3f,0xf9fc0,0xfa040,0x1020c1,0xfe0c1,0xfa03f,0xf9fbf,0x1060c0,0x1060bf,0x101f41,0xfdf41,0x101fbe,0x10203e,0xfe03e,0xfdfbe,0x105f40,0x105f3f,0xf9fc1,0xfa041,0x1060c1,0x105f41,0xfa0c0,0xfa0bf,0x10603e,0x105fbe,0x1020be,0xfe0be,0xf9f40,0xf9f3f,0xfdf3e,0x101f3e,0xfa0c1,0x2fe042,0x302042,0x301fc2,0x2fdfc2,0xf9f41,0xf9fbe,0xfa03e,0x7060be,0x810a040,0x8109fc0,0x8109fbf,0x810a03f,0x705f3e,0x305fc2,0x306042,0x3020c2,0x2fe0c2,0x1102140,0x10fe140,0x110213f,0x10fe13f,0x830a041,0x8309fc1,0x301f42,0x2fdf42,0x2f9fc2,0x2fa042,0x186fa0be,0x1b6f9f3e,0x1b0fdec0,0x3101ec0,0x3701ebf,0x1b6fdebf,0x810a0c0,0x810a0bf,0x1302141,0x12fe141,0x3060c2,0x9106140,0x910613f,0x8109f40,0x8109f3f,0x305f42,0x3301ec1,0x1b2fdec1,0x1b0f5fc0,0x180f6040,0x186f603f,0x1b6f5fbf,0x830a0c1,0x9306141,0x8309f41,0xb105ec0,0xb705ebf,0xb709fbe,0x970a03e,0x970203d,0xb701fbd,0x1b6fdfbd,0x196fe03d,0x10fa140,0x182fa0c2,0x182f6041,0x1b2f5fc1,0x1b2f9f42,0xb305ec1,0x190fa13f,0x196fe13e,0x970213e,0x192fa141,0x194f60c0,
+	40,0x101fc0,0xfe040,0xfdfc0,0x101fbf,0x10203f,0xfe03f,0xfdfbf,0x101fc1,0x102041,0xfe041,0xfdfc1,0x105fc0,0x106040,0x10603f,0x105fbf,0x1020c0,0xfe0c0,0x106041,0x105fc1,0x1020bf,0xfe0bf,0x101f40,0xfdf40,0x1020c1,0xfe0c1,0xfa040,0x101f3f,0xfdf3f,0xf9fc0,0x101f41,0xfdf41,0x1060c0,0xfa03f,0xf9fbf,0xf9fc1,0xfa041,0x1060bf,0x105f40,0x1060c1,0x105f3f,0x701fbe,0x70203e,0x6fe03e,0x6fdfbe,0x105f41,0x301fc2,0xfa0c0,0xfa0bf,0x302042,0x2fe042,0x2fdfc2,0xf9f40,0xf9f3f,0xfa0c1,0x70603e,0x705fbe,0x7020be,0x6fe0be,0xf9f41,0x305fc2,0x306042,0x3020c2,0x2fe0c2,0x810a040,0x8109fc0,0x701f3e,0x6fdf3e,0x6f9fbe,0x6fa03e,0x810a03f,0x8109fbf,0x8109fc1,0x830a041,0x301f42,0x2fdf42,0x2f9fc2,0x2fa042,0x7060be,0x1102140,0x10fe140,0x170213f,0x16fe13f,0x705f3e,0x3060c2,0x1302141,0x12fe141,0x810a0c0,0x810a0bf,0x9106140,0x305f42,0x3101ec0,0x30fdec0,0x3701ebf,0x36fdebf,0x8109f40,0x8109f3f,0x830a0c1,0x6fa0be,0x186f9f3e,0x32fdec1,0x3301ec1,0x8109f41,0x970613f,0x9306141,0x182fa0c2,0x180f6040,0x180f5fc0,0x186f5fbf,0x186f603f,0x182f6041,0x182f5fc1,0x182f9f42,0xb105ec0,0xb705ebf,0xb305ec1,0xb709fbe,0x970a03e,0x10fa140,0x16fa13f,0x192fa141,0x192f60c0,0x196f60bf,0x30f9ec0,0x1b6f9ebf,0x1b4f5f40,0x1b2f9ec1,0xb309fc2,
+	48,0x10203f,0x101fc0,0xfe040,0xfe03f,0x101fbf,0xfdfbf,0xfdfc0,0x1020c0,0x1020bf,0x10603f,0x106040,0x105fc0,0x105fbf,0xfe0bf,0xfe0c0,0x102041,0x101fc1,0xfe041,0xfdfc1,0x10203e,0xfe03e,0x101fbe,0xfdfbe,0x1060bf,0x1060c0,0x101f40,0x101f3f,0xfdf3f,0xfdf40,0xf9fc0,0xfa040,0xfa03f,0xf9fbf,0x1020c1,0x106041,0x105fc1,0xfe0c1,0x1020be,0x10603e,0x105fbe,0xfe0be,0xfa0bf,0xfa0c0,0x105f40,0x105f3f,0x1060c1,0x101f41,0xfdf41,0xf9fc1,0xfa041,0x1060be,0xfa03e,0xf9fbe,0xfdf3e,0x101f3e,0xf9f3f,0xf9f40,0x105f41,0xfa0c1,0xfa0be,0x10fe13f,0x110213f,0x1102140,0x10fe140,0x810a040,0x810a03f,0x105f3e,0x8109fbf,0x8109fc0,0x302042,0x301fc2,0x180f9f41,0x2fdfc2,0x2fe042,0x1106140,0x110613f,0x910a0bf,0x910a0c0,0x810a041,0x8109fc1,0x1b6f9f3e,0x1b6fdfbd,0x70203d,0x186fe03d,0x3701fbd,0x1102141,0x10fe141,0x13020c2,0x8306042,0x8305fc2,0x12fe0c2,0x110213e,0x10fe13e,0x810a03e,0x8109fbe,0x8709f3f,0x8109f40,0x3101ec0,0x3701ebf,0x1b6fdebf,0x1b0fdec0,0x1b2f5fc0,0x182f6040,0x186f603f,0x16fa13f,0x12fa140,0x1106141,0x910a0c1,0x93060c2,0x1b6f5fbf,0x196fe0bd,0x17020bd,0x970603d,0xb705fbd,0x870a0be,0x970613e,0x192fa042,0x182f9fc2,0x182fdf42,0x8301f42,0xb105ec0,0xb705ebf,0xb309f41,0xb301ec1,0x1b2fdec1,0x192f60c0,0x196f60bf,
+	45,0x10203f,0x101fc0,0xfe040,0xfe03f,0x101fbf,0xfdfc0,0xfdfbf,0x102041,0x1020c0,0x106040,0x10603f,0x1020bf,0xfe0c0,0xfe041,0x101fc1,0x105fc0,0x105fbf,0xfe0bf,0xfdfc1,0x1020c1,0x106041,0x1060c0,0x1060bf,0xfe0c1,0x105fc1,0x101f40,0x101f3f,0x101fbe,0x10203e,0xfe03e,0xfa03f,0xfa040,0xf9fc0,0xfdf40,0xfdf3f,0xfdfbe,0xf9fbf,0xfa0c0,0xfa041,0x1060c1,0x10603e,0x1020be,0xfe0be,0xfa0bf,0xf9fc1,0xfdf41,0x101f41,0x105f40,0x105f3f,0x105fbe,0x1060be,0xfa0c1,0x3105f41,0x101f3e,0xfdf3e,0xf9f3f,0xf9f40,0xf9fbe,0xfa03e,0x10fe13f,0x1102140,0x110213f,0x10fe140,0x302042,0x2fe042,0x301fc2,0x2fdfc2,0x810a040,0x810a03f,0x8109fc0,0x8109fbf,0x105f3e,0xfa0be,0x30f9f41,0x3020c2,0x1302141,0x1106140,0x910a0c0,0x810a041,0x8306042,0x305fc2,0x8309fc1,0x810a0bf,0x910613f,0x10fe141,0x12fe0c2,0x1b6f9f3e,0x1b6fdebf,0x3701ebf,0xb301ec0,0xb301f42,0x32fdf42,0x32f9fc2,0x2fa042,0x3060c2,0x1306141,0x930a0c1,0x810a03e,0x8109fbe,0x8709f3f,0xb309f40,0x1b2fdec0,0x1b0f5fc0,0x180f6040,0x10fa140,0x10fa13f,0x190fe13e,0x110213e,0x70203d,0x3701fbd,0x1b6fdfbd,0x186fe03d,0x186f603f,0x1b6f5fbf,0x190f60c0,0x190fa141,0x192fa0c2,0x192f6041,0x1b2f5fc1,0x196f60bf,0x196fe0bd,0x17020bd,0x170613e,0x970a0be,0x970603d,0xb705fbd,0xb705ebf,
+	46,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0xfe041,0xfdfc1,0x1020c0,0x106040,0x105fc0,0xfe0c0,0x1020bf,0x10603f,0x105fbf,0xfe0bf,0x1020c1,0x106041,0x105fc1,0xfe0c1,0x1060c0,0x1060bf,0x101f40,0xfdf40,0xf9fc0,0xfa040,0xfa03f,0xf9fbf,0xfdf3f,0x101f3f,0x101fbe,0x10203e,0xfe03e,0xfdfbe,0x1060c1,0x101f41,0xfdf41,0xf9fc1,0xfa041,0xfa0c0,0xfa0bf,0x105f40,0x105f3f,0x105fbe,0x10603e,0x1020be,0xfe0be,0xfa0c1,0x105f41,0x301fc2,0x302042,0x2fe042,0x2fdfc2,0xf9f40,0xf9f3f,0xf9fbe,0xfa03e,0x7060be,0x101f3e,0xfdf3e,0xf9f41,0x1102140,0x10fe140,0x110213f,0x10fe13f,0x810a040,0x8109fc0,0x810a03f,0x8109fbf,0x306042,0x3020c2,0x2fe0c2,0x305fc2,0x830a041,0x8309fc1,0x1302141,0x12fe141,0x6fa0be,0x705f3e,0x810a0c0,0x9106140,0x110613f,0x910a0bf,0x3060c2,0x301f42,0x2fdf42,0x32f9fc2,0x2fa042,0x1306141,0x930a0c1,0x8109f40,0x8109f3f,0x1b6f9f3e,0x1b0fdec0,0x3101ec0,0x3701ebf,0x1b6fdebf,0x1b0f5fc0,0x180f6040,0x10fa140,0x10fa13f,0x186f603f,0x1b6f5fbf,0x182fa0c2,0x192fa141,0x196fe13e,0x970213e,0x870a03e,0xb709fbe,0x3305f42,0xb309f41,0x3301ec1,0x1b2fdec1,0x1b2f5fc1,0x182f6041,0x192f60c0,0x196f60bf,0x196fe03d,0x970203d,0xb701fbd,0x1b6fdfbd,0xb305ec0,0xb705ebf,0x970a0be,
+	39,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0xfe041,0xfdfc1,0x1020c0,0x106040,0x105fc0,0xfe0c0,0x1020bf,0x10603f,0x105fbf,0xfe0bf,0x1020c1,0x106041,0x105fc1,0xfe0c1,0x1060c0,0x1060bf,0x101f40,0xfdf40,0xf9fc0,0xfa040,0xfa03f,0xf9fbf,0xfdf3f,0x101f3f,0x101f41,0x1060c1,0xfa041,0xf9fc1,0xfdf41,0x105f40,0x70203e,0x701fbe,0x6fe03e,0x6fdfbe,0xfa0c0,0xfa0bf,0xfa0c1,0x105f3f,0x105f41,0x301fc2,0x302042,0x2fe042,0x2fdfc2,0xf9f40,0x7020be,0x70603e,0x705fbe,0x6fe0be,0xf9f3f,0xf9f41,0x3020c2,0x306042,0x305fc2,0x2fe0c2,0x1102140,0x10fe140,0x810a040,0x8109fc0,0x810a03f,0x7060be,0x110213f,0x10fe13f,0x6fa03e,0x6f9fbe,0x6fdf3e,0x701f3e,0x8109fbf,0x810a041,0x8109fc1,0x1102141,0x10fe141,0x3060c2,0x301f42,0x2fdf42,0x2f9fc2,0x2fa042,0x1106140,0x910a0c0,0x810a0bf,0x910613f,0x6fa0be,0x3705f3e,0x810a0c1,0x9106141,0x2fa0c2,0x3305f42,0x8109f40,0xb109f3f,0x3101ec0,0x1b0fdec0,0x1b0f5fc0,0x180f6040,0x10fa140,0x10fa13f,0x186f603f,0x1b6f5fbf,0x1b6f9f3e,0x1b6fdebf,0x3701ebf,0x3301ec1,0xb109f41,0x1b2fdec1,0x1b2f5fc1,0x182f6041,0x10fa141,0x190f60c0,0x1b2f9f42,0xb505ec0,0xb709fbe,0x970a03e,0x970213e,0x196fe13e,0x196f60bf,0x192f60c1,0x192fe142,0x9302142,0x930a042,0xb309fc2,
+	46,0x10203f,0xfe040,0xfe03f,0x101fbf,0x101fc0,0xfdfc0,0xfdfbf,0x1020bf,0x1020c0,0xfe0c0,0xfe0bf,0x10603f,0x106040,0x105fc0,0x105fbf,0x102041,0xfe041,0x101fc1,0xfdfc1,0x1060c0,0x1060bf,0x10203e,0xfe03e,0x101fbe,0xfdfbe,0xfa03f,0xfa040,0x1020c1,0xfe0c1,0xf9fc0,0xf9fbf,0x106041,0x105fc1,0x1020be,0xfe0be,0x101f3f,0x101f40,0xfdf40,0xfdf3f,0x10603e,0x105fbe,0xfa0bf,0xfa0c0,0x1060c1,0x1060be,0xfa041,0xf9fc1,0x105f40,0x105f3f,0x101f41,0xfdf41,0xfa03e,0xf9fbe,0xfdf3e,0x101f3e,0xfa0c1,0x10fe140,0x1102140,0x110213f,0x10fe13f,0xfa0be,0xf9f3f,0xf9f40,0x3105f41,0x810a040,0x810a03f,0x8109fbf,0x8109fc0,0x3105f3e,0x110613f,0x1106140,0x1102141,0x10fe141,0x302042,0x2fe042,0x301fc2,0x2fdfc2,0x910a0c0,0x910a0bf,0x110213e,0x10fe13e,0x10fa13f,0x10fa140,0x1b0f9f41,0x1b6f9f3e,0x186fe03d,0x70203d,0x3701fbd,0x1b6fdfbd,0x810a041,0x8109fc1,0x13020c2,0x12fe0c2,0x1106141,0x8306042,0x8305fc2,0x810a03e,0x8109fbe,0x110613e,0x17020bd,0x196fe0bd,0x186f603f,0x180f6040,0x1b0f5fc0,0x1b6f5fbf,0x910a0c1,0x93060c2,0x910a0be,0x870603d,0xb705fbd,0xb709f3f,0xb309f40,0xb301ec0,0xb701ebf,0x1b6fdebf,0x1b2fdec0,0x2fa042,0x190fa141,0x190f60c0,0x196f60bf,0x196fa13e,0x97060bd,0x182f9fc2,0x1b2fdf42,0xb301f42,0x192fa0c2,0x1a2f6041,
+	46,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0xfe0c0,0xfe0bf,0x102041,0x106040,0x10603f,0xfe041,0x101fc1,0x105fc0,0x105fbf,0xfdfc1,0x1020c1,0x1060c0,0x1060bf,0xfe0c1,0x106041,0x105fc1,0x10203e,0xfe03e,0xfa03f,0xfa040,0xf9fc0,0xf9fbf,0xfdfbe,0x101fbe,0x101f3f,0x101f40,0xfdf40,0xfdf3f,0x1060c1,0x1020be,0xfe0be,0xfa0bf,0xfa0c0,0xfa041,0xf9fc1,0x10603e,0x105fbe,0x105f3f,0x105f40,0x101f41,0xfdf41,0xfa0c1,0x1060be,0x110213f,0x1102140,0x10fe140,0x10fe13f,0xfa03e,0xf9fbe,0xf9f3f,0xf9f40,0x3105f41,0x101f3e,0xfdf3e,0xfa0be,0x302042,0x2fe042,0x301fc2,0x2fdfc2,0x810a040,0x810a03f,0x8109fc0,0x8109fbf,0x1106140,0x1102141,0x10fe141,0x110613f,0x910a0c0,0x910a0bf,0x13020c2,0x12fe0c2,0x30f9f41,0x3105f3e,0x810a041,0x8306042,0x305fc2,0x8309fc1,0x1106141,0x110213e,0x10fe13e,0x16fa13f,0x10fa140,0x13060c2,0x930a0c1,0x810a03e,0x8109fbe,0x1b6f9f3e,0x186fe03d,0x70203d,0x3701fbd,0x1b6fdfbd,0x186f603f,0x180f6040,0x2fa042,0x2f9fc2,0x1b0f5fc0,0x1b6f5fbf,0x190fa141,0x192fa0c2,0x1b2fdf42,0xb301f42,0xb109f40,0xb709f3f,0x170613e,0x970a0be,0x17020bd,0x196fe0bd,0x196f60bf,0x190f60c0,0x192f6041,0x1b2f5fc1,0x1b2fdec0,0xb301ec0,0xb701ebf,0x1b6fdebf,0x970603d,0xb705fbd,0xb309f41,
+	42,0xfe040,0x10203f,0x101fc0,0xfdfc0,0xfe03f,0x101fbf,0xfdfbf,0x102041,0x1020c0,0xfe0c0,0xfe041,0x101fc1,0xfdfc1,0x1020bf,0xfe0bf,0x106040,0x10603f,0x105fc0,0x105fbf,0x1020c1,0xfe0c1,0x106041,0x1060c0,0x1060bf,0x105fc1,0xfa040,0xf9fc0,0xfa03f,0xf9fbf,0x1060c1,0x10203e,0xfe03e,0x101f40,0xfdf40,0x101f3f,0x101fbe,0xfdfbe,0xfdf3f,0xfa041,0xfa0c0,0xfa0bf,0xf9fc1,0xfdf41,0x101f41,0x1020be,0xfe0be,0x10603e,0x105fbe,0x105f40,0x105f3f,0xfa0c1,0x10fe140,0x1102140,0x110213f,0x7060be,0x302042,0x2fe042,0x301fc2,0x3105f41,0x2fdfc2,0x10fe13f,0xfa03e,0xf9fbe,0xf9f40,0xf9f3f,0xfdf3e,0x101f3e,0x810a040,0x810a03f,0x8109fc0,0x8109fbf,0x3020c2,0x1102141,0x10fe141,0x2fe0c2,0x306042,0x305fc2,0x1106140,0x110613f,0x6fa0be,0x30f9f41,0x830a041,0x910a0c0,0x910a0bf,0x8309fc1,0x3060c2,0x1106141,0x930a0c1,0x3705f3e,0x2fa042,0x2f9fc2,0x10fa140,0x10fa13f,0x196fe13e,0x170213e,0x10fa141,0x2fa0c2,0x1b2fdf42,0x3301f42,0x180f6040,0x1b0f5fc0,0x186f603f,0x1b6f5fbf,0x1b6f9f3e,0x870a03e,0x8709fbe,0xb109f40,0xb709f3f,0x3305f42,0xb301ec0,0x1b2fdec0,0x1b6fdebf,0xb701ebf,0x970203d,0x170613e,0x970a0be,0x196fe03d,0x1b6fdfbd,0xb701fbd,0x190f60c0,0x182f6041,0x1b2f5fc1,0x196f60bf,0x192f60c1,0x192fe142,0x9302142,0xb309f41,
+	38,0xfe040,0x101fc0,0xfdfc0,0x10203f,0xfe03f,0x101fbf,0xfdfbf,0x102041,0xfe041,0x101fc1,0xfdfc1,0x1020c0,0xfe0c0,0x1020bf,0x106040,0xfe0bf,0x105fc0,0x1020c1,0xfe0c1,0x10603f,0x105fbf,0x106041,0x105fc1,0x1060c0,0x1060bf,0x1060c1,0xfa040,0xf9fc0,0xfa03f,0xf9fbf,0xfa041,0xf9fc1,0xfdf40,0x101f40,0x101f3f,0xfdf3f,0xfa0c0,0xfa0bf,0x6fe03e,0x70203e,0x701fbe,0x101f41,0xfdf41,0x6fdfbe,0xfa0c1,0x2fe042,0x302042,0x105f40,0x105f3f,0x301fc2,0x2fdfc2,0x7020be,0x6fe0be,0x70603e,0x705fbe,0x105f41,0x1102140,0x10fe140,0x3020c2,0x2fe0c2,0x306042,0x305fc2,0x110213f,0x10fe13f,0x1102141,0x10fe141,0xf9f40,0xf9f3f,0x7060be,0x810a040,0x8109fc0,0x810a03f,0x8109fbf,0x1106140,0x3060c2,0x810a041,0x8109fc1,0xf9f41,0x6fa03e,0x6f9fbe,0x6fdf3e,0x701f3e,0x110613f,0x910a0c0,0x1106141,0x910a0bf,0x910a0c1,0x2fa042,0x2f9fc2,0x6fa0be,0x10fa140,0x2fa0c2,0x2fdf42,0x301f42,0x3705f3e,0x10fa13f,0x10fa141,0x180f6040,0x1b0f5fc0,0x186f603f,0x1b6f5fbf,0x3305f42,0xb109f40,0xb109f3f,0x170213e,0x196fe13e,0x182f6041,0x1b2f5fc1,0x190f60c0,0x196f60bf,0x1b6f9f3e,0x1b0fdec0,0xb101ec0,0xb109f41,0x970a03e,0xb709fbe,0x9302142,0x192fe142,0x192f60c1,0x1b2f9f42,0x1b2fdec1,0xb701ebf,0x1b6fdebf,0xb301ec1,0x930a042,0xb309fc2,0x970613e,
+	40,0x10203f,0xfe040,0xfe03f,0x101fbf,0x101fc0,0xfdfc0,0xfdfbf,0x1020bf,0x1020c0,0xfe0c0,0xfe0bf,0x10603f,0x106040,0x105fc0,0x105fbf,0x102041,0xfe041,0x1060c0,0x1060bf,0x101fc1,0xfdfc1,0x10203e,0xfe03e,0x1020c1,0xfe0c1,0xfa040,0x101fbe,0xfdfbe,0xfa03f,0x1020be,0xfe0be,0x106041,0xf9fc0,0xf9fbf,0xfa0bf,0xfa0c0,0x105fc1,0x10603e,0x1060c1,0x105fbe,0x3101f3f,0x3101f40,0x30fdf40,0x30fdf3f,0x1060be,0x110213f,0xfa041,0xf9fc1,0x1102140,0x10fe140,0x10fe13f,0xfa03e,0xf9fbe,0xfa0c1,0x3105f40,0x3105f3f,0x3101f41,0x30fdf41,0xfa0be,0x110613f,0x1106140,0x1102141,0x10fe141,0x810a040,0x810a03f,0x3101f3e,0x30fdf3e,0x30f9f3f,0x30f9f40,0x8109fc0,0x8109fbf,0x810a0bf,0x910a0c0,0x110213e,0x10fe13e,0x10fa13f,0x10fa140,0x3105f41,0x302042,0x2fe042,0x3301fc2,0x32fdfc2,0x3105f3e,0x1106141,0x13020c2,0x12fe0c2,0x810a041,0x8109fc1,0x8306042,0x110613e,0x70203d,0x6fe03d,0x3701fbd,0x36fdfbd,0x810a03e,0x8109fbe,0x910a0c1,0x30f9f41,0x1b0f9f3e,0x16fe0bd,0x17020bd,0x810a0be,0xb305fc2,0x93060c2,0x190fa141,0x180f6040,0x180f603f,0x1b0f5fbf,0x1b0f5fc0,0x190f60c0,0x190f60bf,0x190fa13e,0x870603d,0xb705fbd,0x97060bd,0xb709f3f,0xb309f40,0x2fa042,0x32f9fc2,0x192fa0c2,0x192f6041,0x1b2f5fc1,0x6fa03d,0x1b6f9fbd,0x1a6f603e,0x196fa0bd,0x970a13f,
+	39,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0xfe0c0,0xfe0bf,0x102041,0x106040,0x10603f,0xfe041,0x101fc1,0x105fc0,0x105fbf,0xfdfc1,0x1020c1,0x1060c0,0x1060bf,0xfe0c1,0x106041,0x105fc1,0x10203e,0xfe03e,0xfa03f,0xfa040,0xf9fc0,0xf9fbf,0xfdfbe,0x101fbe,0x1020be,0x1060c1,0xfa0c0,0xfa0bf,0xfe0be,0x10603e,0x3101f40,0x3101f3f,0x30fdf40,0x30fdf3f,0xfa041,0xf9fc1,0xfa0c1,0x105fbe,0x1060be,0x110213f,0x1102140,0x10fe140,0x10fe13f,0xfa03e,0x3101f41,0x3105f40,0x3105f3f,0x30fdf41,0xf9fbe,0xfa0be,0x1102141,0x1106140,0x110613f,0x10fe141,0x302042,0x2fe042,0x810a040,0x810a03f,0x8109fc0,0x3105f41,0x301fc2,0x2fdfc2,0x30f9f40,0x30f9f3f,0x30fdf3e,0x3101f3e,0x8109fbf,0x810a0c0,0x810a0bf,0x3020c2,0x2fe0c2,0x1106141,0x110213e,0x10fe13e,0x10fa13f,0x10fa140,0x306042,0x830a041,0x8109fc1,0x8305fc2,0x30f9f41,0x3705f3e,0x810a0c1,0x83060c2,0x10fa141,0x170613e,0x810a03e,0x8709fbe,0x70203d,0x186fe03d,0x186f603f,0x180f6040,0x2fa042,0x2f9fc2,0x1b0f5fc0,0x1b6f5fbf,0x1b6f9f3e,0x1b6fdfbd,0x3701fbd,0x17020bd,0x870a0be,0x196fe0bd,0x196f60bf,0x190f60c0,0x2fa0c2,0x182f6041,0x196fa13e,0xa70603d,0xb709f3f,0xb309f40,0xb301f42,0x1b2fdf42,0x1b2f5fc1,0x192f60c1,0x192fe142,0x9302142,0x930a140,0x970a13f,
+	38,0xfe040,0x10203f,0xfe03f,0x101fc0,0xfdfc0,0x101fbf,0xfdfbf,0x1020c0,0xfe0c0,0x1020bf,0xfe0bf,0x102041,0xfe041,0x101fc1,0x106040,0xfdfc1,0x10603f,0x1020c1,0xfe0c1,0x105fc0,0x105fbf,0x1060c0,0x1060bf,0x106041,0x105fc1,0x1060c1,0xfa040,0xfa03f,0xf9fc0,0xf9fbf,0xfa0c0,0xfa0bf,0xfe03e,0x10203e,0x101fbe,0xfdfbe,0xfa041,0xf9fc1,0x30fdf40,0x3101f40,0x3101f3f,0x1020be,0xfe0be,0x30fdf3f,0xfa0c1,0x10fe140,0x1102140,0x10603e,0x105fbe,0x110213f,0x10fe13f,0x3101f41,0x30fdf41,0x3105f40,0x3105f3f,0x1060be,0x302042,0x2fe042,0x1102141,0x10fe141,0x1106140,0x110613f,0x301fc2,0x2fdfc2,0x3020c2,0x2fe0c2,0xfa03e,0xf9fbe,0x3105f41,0x810a040,0x810a03f,0x8109fc0,0x8109fbf,0x306042,0x1106141,0x810a0c0,0x810a0bf,0xfa0be,0x30f9f40,0x30f9f3f,0x30fdf3e,0x3101f3e,0x305fc2,0x830a041,0x3060c2,0x8309fc1,0x830a0c1,0x10fa140,0x10fa13f,0x30f9f41,0x2fa042,0x10fa141,0x10fe13e,0x110213e,0x3705f3e,0x2f9fc2,0x2fa0c2,0x180f6040,0x186f603f,0x1b0f5fc0,0x1b6f5fbf,0x170613e,0x870a03e,0x8709fbe,0x3301f42,0x1b2fdf42,0x190f60c0,0x196f60bf,0x182f6041,0x1b2f5fc1,0x1b6f9f3e,0x186fe03d,0x870203d,0x870a0be,0xb309f40,0xb709f3f,0x9302142,0x192fe142,0x192f60c1,0x196fa13e,0x196fe0bd,0xb701fbd,0x1b6fdfbd,0x97020bd,0x930a140,0x970a13f,0xb305f42,
+	35,0xfe040,0x10203f,0x101fc0,0xfdfc0,0xfe03f,0x1020c0,0x102041,0xfe041,0xfe0c0,0x101fbf,0xfdfbf,0x1020bf,0xfe0bf,0x101fc1,0xfdfc1,0x1020c1,0xfe0c1,0x106040,0x10603f,0x105fc0,0x106041,0x1060c0,0x105fbf,0x1060bf,0x105fc1,0x1060c1,0xfa040,0xf9fc0,0xfa03f,0xfa0c0,0xfa041,0xf9fbf,0xfa0bf,0xf9fc1,0xfa0c1,0x70203e,0x6fe03e,0x101f40,0xfdf40,0x101f3f,0x701fbe,0x6fdfbe,0x30fdf3f,0x101f41,0x30fdf41,0x302042,0x2fe042,0x1102140,0x7020be,0x6fe0be,0x10fe140,0x110213f,0x10fe13f,0x1102141,0x301fc2,0x2fdfc2,0x3020c2,0x2fe0c2,0x10fe141,0x70603e,0x105f40,0x3105f3f,0x705fbe,0x7060be,0x1106140,0x306042,0x3105f41,0x305fc2,0x810a040,0x110613f,0x1106141,0x3060c2,0x8109fc0,0x810a03f,0x810a0c0,0x810a041,0x30f9f40,0x6fa03e,0x6f9fbe,0x30f9f3f,0x30f9f41,0x8109fbf,0x810a0bf,0x8109fc1,0x810a0c1,0x10fa140,0x6fa0be,0x10fa13f,0x2fa042,0x2f9fc2,0x2fa0c2,0x10fa141,0x3701f3e,0x36fdf3e,0x3301f42,0x1b2fdf42,0x170213e,0x196fe13e,0x180f6040,0x1b0f5fc0,0x186f603f,0x3705f3e,0x1302142,0x192fe142,0x190f60c0,0x182f6041,0x1b6f5fbf,0x196f60bf,0x1b2f5fc1,0x3305f42,0xb109f40,0x170613e,0x870a03e,0x8709fbe,0xb709f3f,0xb109f41,0x830a042,0x1306142,0x192f60c1,0x1b6f9f3e,0x870a0be,0x910a140,0x970a13f,0x910a141,0x930a0c2,0xb309fc2,0x13501ec0,
+	49,0x10203f,0x101fc0,0x101fbf,0xfdfbf,0xfe03f,0xfe040,0xfdfc0,0x105fc0,0x106040,0x10603f,0x105fbf,0x1020bf,0x1020c0,0x102041,0x101fc1,0xfdfc1,0xfe041,0xfe0c0,0xfe0bf,0x10203e,0x101fbe,0x101f3f,0x101f40,0xfdf40,0xfdf3f,0xfdfbe,0xfe03e,0x1060bf,0x1060c0,0x106041,0x105fc1,0x105f40,0x105f3f,0x105fbe,0x10603e,0xfa03f,0xfa040,0xf9fc0,0xf9fbf,0x1020c1,0xfe0c1,0x1020be,0xfe0be,0x101f41,0xfdf41,0x1060c1,0x101f3e,0xfdf3e,0x1060be,0x105f41,0xf9fc1,0xfa041,0xfa0c0,0xfa0bf,0xfa03e,0xf9fbe,0x105f3e,0x8109fbf,0x8109fc0,0x810a040,0x810a03f,0xf9f3f,0xf9f40,0x180fa0c1,0x1102140,0x110213f,0x810a0bf,0x810a0c0,0x810a041,0x8109fc1,0x301fc2,0x302042,0x182fe042,0x180f9f41,0x182fdfc2,0x180fa0be,0x190fe13f,0x190fe140,0x810a03e,0x8109fbe,0x8109f3f,0x8109f40,0x180f9f3e,0x701fbd,0x70203d,0x186fe03d,0x186fdfbd,0x3101ebf,0x3101ec0,0x1b0fdec0,0x1b0fdebf,0x8305fc2,0x8306042,0x9106140,0x910613f,0x810a0c1,0x3020c2,0x1302141,0x190fe141,0x192fe0c2,0xb105ec0,0xb105ebf,0x8705fbd,0x870603d,0x810a0be,0x110213e,0x190fe13e,0x17020bd,0x196fe0bd,0xb309f41,0x8301f42,0x182fdf42,0xb301ec1,0x1b2fdec1,0xb709f3e,0x83060c2,0x9306141,0x910613e,0x97060bd,0x8701f3d,0xb701ebe,0x1b0fdebe,0x1b6fdf3d,0x1b6f5fbf,0x196f603f,0x192f6040,0x1b2f5fc0,
+	46,0x101fc0,0x10203f,0x101fbf,0xfdfc0,0xfe040,0xfe03f,0xfdfbf,0x105fc0,0x106040,0x10603f,0x105fbf,0x101fc1,0x102041,0xfe041,0xfdfc1,0x1020c0,0x1020bf,0xfe0c0,0xfe0bf,0x106041,0x105fc1,0x101f40,0x101f3f,0xfdf40,0xfdf3f,0x101fbe,0x10203e,0x1060c0,0x1060bf,0xfe03e,0xfdfbe,0x1020c1,0xfe0c1,0x105f40,0x105f3f,0xf9fc0,0xfa040,0xfa03f,0xf9fbf,0x101f41,0xfdf41,0x105fbe,0x10603e,0x1060c1,0x105f41,0x1020be,0xfe0be,0xfa041,0xf9fc1,0xfa0c0,0xfa0bf,0x101f3e,0xfdf3e,0xf9f3f,0xf9f40,0x1060be,0x810a03f,0x810a040,0x8109fc0,0x8109fbf,0x105f3e,0xf9fbe,0xfa03e,0x180fa0c1,0x302042,0x301fc2,0x2fdfc2,0x2fe042,0x180f9f41,0x8109fc1,0x810a041,0x810a0c0,0x810a0bf,0x1102140,0x110213f,0x10fe140,0x10fe13f,0x8306042,0x8305fc2,0x8109f40,0x8109f3f,0x8109fbe,0x810a03e,0x186fa0be,0x1b6f9f3e,0x3701ebf,0x3101ec0,0x1b0fdec0,0x1b6fdebf,0x3020c2,0x2fe0c2,0x9106140,0x910613f,0x810a0c1,0x1302141,0x12fe141,0x301f42,0x2fdf42,0x8109f41,0xb105ec0,0xb705ebf,0x3701fbd,0x70203d,0x186fe03d,0x1b6fdfbd,0x83060c2,0x9306141,0x8305f42,0x3301ec1,0x1b2fdec1,0x1b2f9fc2,0x192fa042,0x192f6040,0x1b2f5fc0,0x1b6f5fbf,0x196f603f,0x110213e,0x870a0be,0x870603d,0xb705fbd,0xb709f3e,0xb305ec1,0x16fe13e,0x196fa13f,0x192fa140,0x970613e,0x117020bd,
+	45,0x101fc0,0x101fbf,0x10203f,0xfe040,0xfdfc0,0xfdfbf,0xfe03f,0x102041,0x101fc1,0x105fc0,0x106040,0x10603f,0x105fbf,0xfdfc1,0xfe041,0x1020c0,0x106041,0x105fc1,0x1020bf,0xfe0c0,0xfe0bf,0x101f40,0x101f3f,0xfdf40,0xfdf3f,0x1020c1,0x1060c0,0x1060bf,0xfe0c1,0x101f41,0x105f40,0x105f3f,0x101fbe,0x10203e,0xfa040,0xf9fc0,0xfdf41,0xf9fbf,0xfa03f,0xfe03e,0xfdfbe,0x1060c1,0x105f41,0x105fbe,0x10603e,0xfa041,0xf9fc1,0xfa0c0,0xfa0bf,0x1020be,0xfe0be,0x101f3e,0xfdf3e,0xf9f40,0xf9f3f,0x301fc2,0x302042,0x2fe042,0x2fdfc2,0x8109fc0,0x810a040,0x810a03f,0x8109fbf,0x1060be,0x180fa0c1,0x180f9f41,0x305fc2,0x306042,0x830a041,0x8109fc1,0x105f3e,0xf9fbe,0xfa03e,0x1102140,0x3020c2,0x2fe0c2,0x810a0c0,0x810a0bf,0x110213f,0x10fe140,0x10fe13f,0x301f42,0x2fdf42,0x8109f40,0x8109f3f,0x3101ec0,0x3701ebf,0x1b0fdec0,0x1b6fdebf,0x3060c2,0x830a0c1,0x9106140,0x1302141,0x12fe141,0x910613f,0x186fa0be,0x1b6f9f3e,0x305f42,0x8109f41,0x8109fbe,0x810a03e,0x9306141,0x182fa042,0x1b2f9fc2,0x3301ec1,0xb105ec0,0xb705ebf,0x1b2fdec1,0xb305ec1,0x3701fbd,0x170203d,0x196fe03d,0x1b6fdfbd,0x1b2f5fc0,0x192f6040,0x196f603f,0x1b6f5fbf,0x192fa140,0x192fa0c2,0x190fa13f,0x970213e,0x970a0be,0x196fe13e,0x970603d,0xb705fbd,0xb709f3e,0xb309fc2,
+	43,0x101fc0,0xfdfc0,0xfe040,0x10203f,0x101fbf,0xfdfbf,0xfe03f,0x102041,0x101fc1,0xfdfc1,0xfe041,0x106040,0x105fc0,0x105fbf,0x10603f,0x106041,0x105fc1,0x1020c0,0xfe0c0,0x1020bf,0xfe0bf,0x101f40,0xfdf40,0x1020c1,0xfe0c1,0x1060c0,0x101f3f,0xfdf3f,0x101f41,0xfdf41,0x105f40,0x1060bf,0x1060c1,0xfa040,0xf9fc0,0xf9fbf,0x105f3f,0x105f41,0xfa03f,0xfa041,0xf9fc1,0x101fbe,0x10203e,0xfe03e,0xfdfbe,0x105fbe,0x10603e,0x302042,0x301fc2,0x2fdfc2,0x2fe042,0xfa0c0,0xfa0bf,0xfa0c1,0xf9f40,0xf9f3f,0x8109fc0,0x810a040,0x306042,0x305fc2,0x8109fbf,0x810a03f,0x1020be,0x6fe0be,0x101f3e,0xfdf3e,0xf9f41,0x8109fc1,0x810a041,0x3020c2,0x2fe0c2,0x7060be,0x810a0c0,0x301f42,0x2fdf42,0x705f3e,0xf9fbe,0x6fa03e,0x1102140,0x10fe140,0x3060c2,0x810a0c1,0x810a0bf,0x110213f,0x10fe13f,0x1302141,0x12fe141,0x2fa042,0x2f9fc2,0x305f42,0x8109f40,0x8109f3f,0x3101ec0,0x1b0fdec0,0x3701ebf,0x8109f41,0x9106140,0x910613f,0x9306141,0x3301ec1,0x1b6fdebf,0x1b2fdec1,0xb105ec0,0xb705ebf,0x186fa0be,0x1b6f9f3e,0xb709fbe,0x870a03e,0xb305ec1,0x182fa0c2,0x1b2f9f42,0x1b0f5fc0,0x190f6040,0x196f603f,0x1b6f5fbf,0x190fa140,0x930a042,0xb309fc2,0x1b2f5fc1,0x192f6041,0x196fa13f,0x192fa141,0x1170213e,0x970a0be,0x1170203d,0xb701fbd,0x1b6fdfbd,
+	46,0x10203f,0x101fc0,0x101fbf,0xfe03f,0xfe040,0xfdfc0,0xfdfbf,0x10603f,0x106040,0x105fc0,0x105fbf,0x1020bf,0x1020c0,0xfe0c0,0xfe0bf,0x102041,0x101fc1,0xfe041,0xfdfc1,0x1060c0,0x1060bf,0x10203e,0x101fbe,0xfe03e,0xfdfbe,0x101f3f,0x101f40,0x106041,0x105fc1,0xfdf40,0xfdf3f,0x1020c1,0xfe0c1,0x10603e,0x105fbe,0xfa03f,0xfa040,0xf9fc0,0xf9fbf,0x1020be,0xfe0be,0x105f3f,0x105f40,0x1060c1,0x1060be,0x101f41,0xfdf41,0xfa0c0,0xfa0bf,0xfa041,0xf9fc1,0x101f3e,0xfdf3e,0xf9fbe,0xfa03e,0x105f41,0x8109fc0,0x810a040,0x810a03f,0x8109fbf,0x105f3e,0xf9f3f,0xf9f40,0x180fa0c1,0x1102140,0x110213f,0x10fe13f,0x10fe140,0x180fa0be,0x810a0bf,0x810a0c0,0x810a041,0x8109fc1,0x302042,0x301fc2,0x2fe042,0x2fdfc2,0x9106140,0x910613f,0x810a03e,0x8109fbe,0x8109f3f,0x8109f40,0x1b0f9f41,0x1b6f9f3e,0x3701fbd,0x70203d,0x186fe03d,0x1b6fdfbd,0x1102141,0x10fe141,0x8306042,0x8305fc2,0x810a0c1,0x13020c2,0x12fe0c2,0x110213e,0x10fe13e,0x810a0be,0x870603d,0xb705fbd,0x3701ebf,0x3101ec0,0x1b0fdec0,0x1b6fdebf,0x9106141,0x93060c2,0x910613e,0x17020bd,0x196fe0bd,0x196fa13f,0x192fa140,0x192f6040,0x196f603f,0x1b6f5fbf,0x1b2f5fc0,0x301f42,0xb109f41,0xb105ec0,0xb705ebf,0xb709f3e,0x97060bd,0x32fdf42,0x1b2f9fc2,0x192fa042,0xb305f42,0x13301ec1,
+	46,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0xfdfbf,0x106040,0x10603f,0x105fc0,0x105fbf,0x102041,0x1020c0,0x1020bf,0x101fc1,0xfe041,0xfe0c0,0xfe0bf,0xfdfc1,0x106041,0x1060c0,0x1060bf,0x105fc1,0x1020c1,0xfe0c1,0x10203e,0x101fbe,0x101f3f,0x101f40,0xfdf40,0xfdf3f,0xfdfbe,0xfe03e,0xfa03f,0xfa040,0xf9fc0,0xf9fbf,0x1060c1,0x10603e,0x105fbe,0x105f3f,0x105f40,0x101f41,0xfdf41,0x1020be,0xfe0be,0xfa0bf,0xfa0c0,0xfa041,0xf9fc1,0x105f41,0x1060be,0x810a03f,0x810a040,0x8109fc0,0x8109fbf,0x101f3e,0xfdf3e,0xf9f3f,0xf9f40,0x180fa0c1,0xfa03e,0xf9fbe,0x105f3e,0x302042,0x301fc2,0x2fe042,0x2fdfc2,0x1102140,0x110213f,0x10fe140,0x10fe13f,0x810a0c0,0x810a041,0x8109fc1,0x810a0bf,0x9106140,0x910613f,0x8306042,0x8305fc2,0x180f9f41,0x180fa0be,0x1102141,0x13020c2,0x2fe0c2,0x12fe141,0x810a0c1,0x810a03e,0x8109fbe,0x8709f3f,0x8109f40,0x83060c2,0x9306141,0x110213e,0x10fe13e,0x1b6f9f3e,0x3701fbd,0x70203d,0x186fe03d,0x1b6fdfbd,0x3701ebf,0x3101ec0,0x301f42,0x2fdf42,0x1b0fdec0,0x1b6fdebf,0xb109f41,0xb305f42,0x1b2f9fc2,0x192fa042,0x190fa140,0x196fa13f,0x870a0be,0x970613e,0x870603d,0xb705fbd,0xb705ebf,0xb105ec0,0xb301ec1,0x1b2fdec1,0x1b2f5fc0,0x192f6040,0x196f603f,0x1b6f5fbf,0x97020bd,0x196fe0bd,0x192fa141,
+	42,0x101fc0,0x10203f,0xfe040,0xfdfc0,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x106040,0x105fc0,0x101fc1,0xfe041,0xfdfc1,0x10603f,0x105fbf,0x1020c0,0x1020bf,0xfe0c0,0xfe0bf,0x106041,0x105fc1,0x1020c1,0x1060c0,0x1060bf,0xfe0c1,0x101f40,0xfdf40,0x101f3f,0xfdf3f,0x1060c1,0x10203e,0x101fbe,0xfa040,0xf9fc0,0xfa03f,0xfe03e,0xfdfbe,0xf9fbf,0x101f41,0x105f40,0x105f3f,0xfdf41,0xf9fc1,0xfa041,0x10603e,0x105fbe,0x1020be,0xfe0be,0xfa0c0,0xfa0bf,0x105f41,0x8109fc0,0x810a040,0x810a03f,0x7060be,0x302042,0x301fc2,0x2fe042,0x180fa0c1,0x2fdfc2,0x8109fbf,0x101f3e,0xfdf3e,0xf9f40,0xf9f3f,0xf9fbe,0xfa03e,0x1102140,0x110213f,0x10fe140,0x10fe13f,0x306042,0x810a041,0x8109fc1,0x305fc2,0x3020c2,0x2fe0c2,0x810a0c0,0x810a0bf,0x705f3e,0x180f9f41,0x1302141,0x9106140,0x910613f,0x12fe141,0x3060c2,0x810a0c1,0x9306141,0x186fa0be,0x301f42,0x2fdf42,0x8109f40,0x8109f3f,0xb709fbe,0x870a03e,0x8109f41,0x305f42,0x1b2f9fc2,0x182fa042,0x3101ec0,0x1b0fdec0,0x3701ebf,0x1b6fdebf,0x1b6f9f3e,0x170213e,0x16fe13e,0x190fa140,0x196fa13f,0x182fa0c2,0x192f6040,0x1b2f5fc0,0x1b6f5fbf,0x196f603f,0x970203d,0x870a0be,0x970613e,0xb701fbd,0x1b6fdfbd,0x196fe03d,0xb105ec0,0x3301ec1,0x1b2fdec1,0xb705ebf,0xb305ec1,0xb309fc2,0x930a042,0x192fa141,
+	38,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0xfe041,0xfdfc1,0x106040,0x105fc0,0x10603f,0x1020c0,0x105fbf,0xfe0c0,0x106041,0x105fc1,0x1020bf,0xfe0bf,0x1020c1,0xfe0c1,0x1060c0,0x1060bf,0x1060c1,0x101f40,0xfdf40,0x101f3f,0xfdf3f,0x101f41,0xfdf41,0xf9fc0,0xfa040,0xfa03f,0xf9fbf,0x105f40,0x105f3f,0x701fbe,0x70203e,0x6fe03e,0xfa041,0xf9fc1,0x6fdfbe,0x105f41,0x301fc2,0x302042,0xfa0c0,0xfa0bf,0x2fe042,0x2fdfc2,0x70603e,0x705fbe,0x7020be,0x6fe0be,0xfa0c1,0x810a040,0x8109fc0,0x306042,0x305fc2,0x3020c2,0x2fe0c2,0x810a03f,0x8109fbf,0x810a041,0x8109fc1,0xf9f40,0xf9f3f,0x7060be,0x1102140,0x10fe140,0x110213f,0x10fe13f,0x810a0c0,0x3060c2,0x1102141,0x10fe141,0xf9f41,0x701f3e,0x6fdf3e,0x6f9fbe,0x6fa03e,0x810a0bf,0x9106140,0x810a0c1,0x910613f,0x9106141,0x301f42,0x2fdf42,0x705f3e,0x8109f40,0x305f42,0x2f9fc2,0x2fa042,0x186fa0be,0x8109f3f,0x8109f41,0x3101ec0,0x1b0fdec0,0x3701ebf,0x1b6fdebf,0x182fa0c2,0x190fa140,0x190fa13f,0x870a03e,0xb709fbe,0x3301ec1,0x1b2fdec1,0xb105ec0,0xb705ebf,0x1b6f9f3e,0x1b0f5fc0,0x190f6040,0x190fa141,0x970213e,0x196fe13e,0x930a042,0xb309fc2,0xb305ec1,0x1b2f9f42,0x1b2f5fc1,0x196f603f,0x1b6f5fbf,0x192f6041,0x9302142,0x192fe142,0x970a0be,
+	45,0x10203f,0x101fbf,0x101fc0,0xfe040,0xfe03f,0xfdfbf,0xfdfc0,0x1020c0,0x1020bf,0x10603f,0x106040,0x105fc0,0x105fbf,0xfe0bf,0xfe0c0,0x102041,0x1060c0,0x1060bf,0x101fc1,0xfe041,0xfdfc1,0x10203e,0x101fbe,0xfe03e,0xfdfbe,0x1020c1,0x106041,0x105fc1,0xfe0c1,0x1020be,0x10603e,0x105fbe,0x101f3f,0x101f40,0xfa040,0xfa03f,0xfe0be,0xf9fbf,0xf9fc0,0xfdf40,0xfdf3f,0x1060c1,0x1060be,0x105f3f,0x105f40,0xfa0c0,0xfa0bf,0xfa041,0xf9fc1,0x101f41,0xfdf41,0x101f3e,0xfdf3e,0xfa03e,0xf9fbe,0x110213f,0x1102140,0x10fe140,0x10fe13f,0x810a03f,0x810a040,0x8109fc0,0x8109fbf,0x105f41,0x180fa0c1,0x180fa0be,0x110613f,0x1106140,0x910a0c0,0x810a0bf,0x105f3e,0xf9f3f,0xf9f40,0x302042,0x1102141,0x10fe141,0x810a041,0x8109fc1,0x301fc2,0x2fe042,0x2fdfc2,0x110213e,0x10fe13e,0x810a03e,0x8109fbe,0x70203d,0x3701fbd,0x186fe03d,0x1b6fdfbd,0x1106141,0x910a0c1,0x8306042,0x13020c2,0x12fe0c2,0x8305fc2,0x1b0f9f41,0x1b6f9f3e,0x110613e,0x810a0be,0x8109f3f,0x8109f40,0x93060c2,0x190fa140,0x196fa13f,0x17020bd,0x870603d,0xb705fbd,0x196fe0bd,0x97060bd,0x3701ebf,0x3301ec0,0x1b2fdec0,0x1b6fdebf,0x196f603f,0x192f6040,0x1b2f5fc0,0x1b6f5fbf,0x192fa042,0x192fa141,0x182f9fc2,0xb301f42,0xb309f41,0x1b2fdf42,0xb305ec0,0xb705ebf,0xb709f3e,0x970a13f,
+	42,0x10203f,0x101fc0,0xfe040,0xfe03f,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x106040,0x10603f,0x1020bf,0xfe0c0,0xfe0bf,0x105fc0,0x105fbf,0x102041,0x101fc1,0xfe041,0xfdfc1,0x1060c0,0x1060bf,0x1020c1,0x106041,0x105fc1,0xfe0c1,0x10203e,0xfe03e,0x101fbe,0xfdfbe,0x1060c1,0x101f40,0x101f3f,0xfa040,0xfa03f,0xf9fc0,0xfdf40,0xfdf3f,0xf9fbf,0x1020be,0x10603e,0x105fbe,0xfe0be,0xfa0bf,0xfa0c0,0x105f40,0x105f3f,0x101f41,0xfdf41,0xfa041,0xf9fc1,0x1060be,0x810a03f,0x810a040,0x8109fc0,0x3105f41,0x1102140,0x110213f,0x10fe140,0x180fa0c1,0x10fe13f,0x8109fbf,0x101f3e,0xfdf3e,0xfa03e,0xf9fbe,0xf9f3f,0xf9f40,0x302042,0x301fc2,0x2fe042,0x2fdfc2,0x1106140,0x810a0c0,0x810a0bf,0x110613f,0x1102141,0x10fe141,0x810a041,0x8109fc1,0x3105f3e,0x180fa0be,0x13020c2,0x8306042,0x8305fc2,0x12fe0c2,0x1106141,0x810a0c1,0x93060c2,0x1b0f9f41,0x110213e,0x10fe13e,0x810a03e,0x8109fbe,0xb709f3f,0xb109f40,0x810a0be,0x110613e,0x196fa13f,0x190fa140,0x70203d,0x186fe03d,0x3701fbd,0x1b6fdfbd,0x1b6f9f3e,0x3301f42,0x32fdf42,0x182fa042,0x1b2f9fc2,0x190fa141,0x192f6040,0x196f603f,0x1b6f5fbf,0x1b2f5fc0,0xb301ec0,0xb109f41,0xb305f42,0xb701ebf,0x1b6fdebf,0x1b2fdec0,0x870603d,0x17020bd,0x196fe0bd,0xb705fbd,0x97060bd,0x970a13f,0x930a140,0x192fa0c2,
+	38,0x10203f,0x101fc0,0xfe040,0xfe03f,0x101fbf,0xfdfc0,0xfdfbf,0x102041,0x1020c0,0x106040,0x10603f,0x1020bf,0xfe0c0,0xfe041,0x101fc1,0x105fc0,0x105fbf,0xfe0bf,0xfdfc1,0x1020c1,0x106041,0x1060c0,0x1060bf,0xfe0c1,0x105fc1,0x1060c1,0x10203e,0x101f40,0xfa040,0xfa03f,0xfe03e,0x101fbe,0x101f3f,0xfdf40,0xf9fc0,0xf9fbf,0xfdfbe,0xfdf3f,0x101f41,0x105f40,0x105f3f,0x10603e,0x1020be,0xfe0be,0xfa0c0,0xfa041,0xf9fc1,0xfdf41,0x105fbe,0xfa0bf,0x180fa0c1,0x1060be,0x3105f41,0x302042,0x2fe042,0x301fc2,0x810a040,0x810a03f,0x8109fc0,0x1102140,0x110213f,0x10fe140,0x10fe13f,0x8109fbf,0x2fdfc2,0x3020c2,0x1102141,0x1106140,0x810a0c0,0x810a041,0x8306042,0x305fc2,0x8309fc1,0x810a0bf,0x110613f,0x10fe141,0x2fe0c2,0xf9f40,0xf9f3f,0xfa03e,0xf9fbe,0x101f3e,0xfdf3e,0x3705f3e,0x810a0c1,0x83060c2,0x1106141,0x180fa0be,0x1b0f9f41,0x3301f42,0x32fdf42,0x182fa042,0x1b2f9fc2,0x190fa140,0x190fa13f,0x110213e,0x190fe13e,0x810a03e,0x8709fbe,0xb109f40,0xb709f3f,0xb109f41,0xb305f42,0x182fa0c2,0x190fa141,0x170613e,0x870a0be,0x70203d,0x1b6f9f3e,0xb301ec0,0xb701ebf,0x1b2fdec0,0x1b6fdebf,0x192f6040,0x196f603f,0x1b2f5fc0,0x1b6f5fbf,0x186fe03d,0x3701fbd,0x1b6fdfbd,0xb70603d,0x97020bd,0x196fe0bd,0x930a140,0x970a13f,0x9302142,0x192fe142,
+	38,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0x102041,0x101fc1,0xfdfbf,0xfe041,0x1020c0,0x106040,0xfdfc1,0x105fc0,0xfe0c0,0x1020bf,0x10603f,0x105fbf,0xfe0bf,0x1020c1,0x106041,0x105fc1,0xfe0c1,0x1060c0,0x1060bf,0x1060c1,0x101f40,0xfa040,0xf9fc0,0xfdf40,0x101f3f,0xfdf3f,0xfa03f,0xf9fbf,0xfa041,0xf9fc1,0x101f41,0xfdf41,0x70203e,0x701fbe,0x6fe03e,0x6fdfbe,0x105f40,0x105f3f,0xfa0c0,0xfa0bf,0xfa0c1,0x302042,0x301fc2,0x105f41,0x2fe042,0x2fdfc2,0x7020be,0x70603e,0x705fbe,0x6fe0be,0x1102140,0x10fe140,0x3020c2,0x306042,0x810a040,0x8109fc0,0x810a03f,0x7060be,0x110213f,0x10fe13f,0x2fe0c2,0x305fc2,0x810a041,0x8109fbf,0x8109fc1,0x1102141,0x10fe141,0x1106140,0x810a0c0,0x3060c2,0x1106141,0x110613f,0x810a0bf,0x810a0c1,0xf9f40,0xf9f3f,0xf9f41,0x701f3e,0x6fdf3e,0x6fa03e,0x6f9fbe,0x186fa0be,0x2fa042,0x2f9fc2,0x301f42,0x182fdf42,0x705f3e,0x8109f40,0x3305f42,0x182fa0c2,0x190fa140,0x190fa13f,0x190fa141,0x170213e,0x196fe13e,0x8109f3f,0xb109f41,0x870a03e,0xb709fbe,0x870a0be,0x970613e,0x9302142,0x192fe142,0x930a042,0xb309fc2,0x3101ec0,0x1b0fdec0,0x3701ebf,0x1b6fdebf,0x1b6f9f3e,0x190f6040,0x1b0f5fc0,0x196f603f,0x1b6f5fbf,0x192f6041,0x1b2f5fc1,0x3301ec1,0x1b2fdec1,0xb305ec0,0xb705ebf,0x950a140,
+	43,0x10203f,0xfe03f,0xfe040,0x101fc0,0x101fbf,0xfdfbf,0xfdfc0,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x106040,0x10603f,0x105fbf,0x105fc0,0x1060c0,0x1060bf,0x102041,0xfe041,0x101fc1,0xfdfc1,0x10203e,0xfe03e,0x1020c1,0xfe0c1,0x106041,0x101fbe,0xfdfbe,0x1020be,0xfe0be,0x10603e,0x105fc1,0x1060c1,0xfa040,0xfa03f,0xf9fbf,0x105fbe,0x1060be,0xf9fc0,0xfa0c0,0xfa0bf,0x101f3f,0x101f40,0xfdf40,0xfdf3f,0x105f3f,0x105f40,0x1102140,0x110213f,0x10fe13f,0x10fe140,0xfa041,0xf9fc1,0xfa0c1,0xfa03e,0xf9fbe,0x810a03f,0x810a040,0x1106140,0x110613f,0x8109fbf,0x8109fc0,0x101f41,0x30fdf41,0x101f3e,0xfdf3e,0xfa0be,0x810a0bf,0x810a0c0,0x1102141,0x10fe141,0x3105f41,0x810a041,0x110213e,0x10fe13e,0x3105f3e,0xf9f3f,0x30f9f40,0x302042,0x2fe042,0x1106141,0x810a0c1,0x8109fc1,0x301fc2,0x2fdfc2,0x13020c2,0x12fe0c2,0x10fa140,0x10fa13f,0x110613e,0x810a03e,0x8109fbe,0x70203d,0x186fe03d,0x3701fbd,0x810a0be,0x8306042,0x8305fc2,0x93060c2,0x17020bd,0x1b6fdfbd,0x196fe0bd,0x870603d,0xb705fbd,0x1b0f9f41,0x1b6f9f3e,0xb709f3f,0xb109f40,0x97060bd,0x190fa141,0x196fa13e,0x186f603f,0x182f6040,0x1b2f5fc0,0x1b6f5fbf,0x182fa042,0x930a140,0x970a13f,0x196f60bf,0x192f60c0,0x1b2f9fc2,0x192fa0c2,0x13301f42,0xb309f41,0x13301ec0,0xb701ebf,0x1b6fdebf,
+	38,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0xfe0c0,0xfe0bf,0x106040,0x10603f,0x105fc0,0x102041,0x105fbf,0xfe041,0x1060c0,0x1060bf,0x101fc1,0xfdfc1,0x1020c1,0xfe0c1,0x106041,0x105fc1,0x1060c1,0x10203e,0xfe03e,0x101fbe,0xfdfbe,0x1020be,0xfe0be,0xfa03f,0xfa040,0xf9fc0,0xf9fbf,0x10603e,0x105fbe,0x3101f3f,0x3101f40,0x30fdf40,0xfa0c0,0xfa0bf,0x30fdf3f,0x1060be,0x110213f,0x1102140,0xfa041,0xf9fc1,0x10fe140,0x10fe13f,0x3105f40,0x3105f3f,0x3101f41,0x30fdf41,0xfa0c1,0x810a040,0x810a03f,0x1106140,0x110613f,0x1102141,0x10fe141,0x8109fc0,0x8109fbf,0x810a0c0,0x810a0bf,0xfa03e,0xf9fbe,0x3105f41,0x302042,0x2fe042,0x301fc2,0x2fdfc2,0x810a041,0x1106141,0x3020c2,0x2fe0c2,0xfa0be,0x3101f3e,0x30fdf3e,0x30f9f3f,0x30f9f40,0x8109fc1,0x8306042,0x810a0c1,0x8305fc2,0x83060c2,0x110213e,0x10fe13e,0x3105f3e,0x810a03e,0x110613e,0x10fa13f,0x10fa140,0x1b0f9f41,0x8109fbe,0x810a0be,0x70203d,0x186fe03d,0x3701fbd,0x1b6fdfbd,0x190fa141,0x182fa042,0x182f9fc2,0xb109f40,0xb709f3f,0x17020bd,0x196fe0bd,0x870603d,0xb705fbd,0x1b6f9f3e,0x186f603f,0x182f6040,0x182fa0c2,0xb301f42,0x1b2fdf42,0x930a140,0x970a13f,0x97060bd,0x196fa13e,0x196f60bf,0x1b2f5fc0,0x1b6f5fbf,0x192f60c0,0x9302142,0x192fe142,0xb309f41,
+	38,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0x1020c0,0x1020bf,0xfdfbf,0xfe0c0,0x102041,0x106040,0xfe0bf,0x10603f,0xfe041,0x101fc1,0x105fc0,0x105fbf,0xfdfc1,0x1020c1,0x1060c0,0x1060bf,0xfe0c1,0x106041,0x105fc1,0x1060c1,0x10203e,0xfa040,0xfa03f,0xfe03e,0x101fbe,0xfdfbe,0xf9fc0,0xf9fbf,0xfa0c0,0xfa0bf,0x1020be,0xfe0be,0x3101f40,0x3101f3f,0x30fdf40,0x30fdf3f,0x10603e,0x105fbe,0xfa041,0xf9fc1,0xfa0c1,0x1102140,0x110213f,0x1060be,0x10fe140,0x10fe13f,0x3101f41,0x3105f40,0x3105f3f,0x30fdf41,0x302042,0x2fe042,0x1102141,0x1106140,0x810a040,0x810a03f,0x8109fc0,0x3105f41,0x301fc2,0x2fdfc2,0x10fe141,0x110613f,0x810a0c0,0x8109fbf,0x810a0bf,0x3020c2,0x2fe0c2,0x306042,0x810a041,0x1106141,0x3060c2,0x305fc2,0x8109fc1,0x810a0c1,0xfa03e,0xf9fbe,0xfa0be,0x3101f3e,0x30fdf3e,0x30f9f40,0x30f9f3f,0x1b0f9f41,0x10fa140,0x10fa13f,0x110213e,0x190fe13e,0x3105f3e,0x810a03e,0x170613e,0x190fa141,0x182fa042,0x182f9fc2,0x182fa0c2,0x3301f42,0x1b2fdf42,0x8109fbe,0x870a0be,0xb109f40,0xb709f3f,0xb109f41,0xb305f42,0x9302142,0x192fe142,0x930a140,0x970a13f,0x70203d,0x186fe03d,0x3701fbd,0x1b6fdfbd,0x1b6f9f3e,0x182f6040,0x186f603f,0x1b2f5fc0,0x1b6f5fbf,0x192f60c0,0x196f60bf,0x17020bd,0x196fe0bd,0x970603d,0xb705fbd,0xa30a042,
+	33,0xfe040,0x10203f,0x101fc0,0xfdfc0,0xfe03f,0x1020c0,0x102041,0x101fbf,0xfe041,0xfe0c0,0x106040,0xfdfbf,0x1020bf,0x101fc1,0xfdfc1,0xfe0bf,0x1020c1,0x10603f,0x105fc0,0xfe0c1,0x1060c0,0x106041,0x105fbf,0x1060bf,0x105fc1,0x1060c1,0xfa040,0xf9fc0,0xfa03f,0xfa0c0,0xfa041,0xf9fbf,0x10203e,0xfe03e,0x3101f40,0x30fdf40,0xf9fc1,0xfa0bf,0x101fbe,0x3101f3f,0x30fdf3f,0x6fdfbe,0x1020be,0x6fe0be,0xfa0c1,0x1102140,0x10fe140,0x302042,0x3101f41,0x30fdf41,0x2fe042,0x301fc2,0x3105f40,0x10603e,0x110213f,0x10fe13f,0x1102141,0x3020c2,0x2fdfc2,0x3105f3f,0x705fbe,0x7060be,0x810a040,0x3105f41,0x306042,0x2fe0c2,0x10fe141,0x1106140,0x110613f,0x810a03f,0x8109fc0,0x305fc2,0x810a041,0x810a0c0,0x1106141,0x3060c2,0x8109fbf,0x810a0bf,0x8109fc1,0x810a0c1,0x30f9f40,0x6fa03e,0x6f9fbe,0x30f9f3f,0x30f9f41,0x2fa042,0x10fa140,0x6fa0be,0x3701f3e,0x36fdf3e,0x2f9fc2,0x2fa0c2,0x10fa141,0x10fa13f,0x170213e,0x196fe13e,0x3705f3e,0x3301f42,0x1b2fdf42,0x3305f42,0xb109f40,0x870a03e,0x170613e,0x1302142,0x192fe142,0x1306142,0x830a042,0xb109f3f,0xb709fbe,0x870a0be,0x910a140,0x970a13f,0xb109f41,0xb309fc2,0x830a0c2,0x930a141,0x180f6040,0x1b0f5fc0,0x186f603f,0x190f60c0,0x182f6041,0x1b6f5fbf,0x1b6f9f3e,0x1b2f5fc1,0x196f60bf,0x192f60c1,0x1270203d,
+	37,0x10203f,0x101fc0,0x101fbf,0xfdfbf,0xfe03f,0xfe040,0xfdfc0,0x105fc0,0x106040,0x10603f,0x105fbf,0x1020bf,0x1020c0,0x102041,0x101fc1,0xfdfc1,0xfe041,0xfe0c0,0xfe0bf,0x10203e,0x101fbe,0x101f3f,0x101f40,0x105fc1,0x106041,0x1060c0,0x1060bf,0xfe03e,0xfdfbe,0xfdf3f,0xfdf40,0x105f40,0x105f3f,0x105fbe,0x10603e,0x1020c1,0xfe0c1,0x180fa040,0x180fa03f,0x180f9fbf,0x180f9fc0,0x101f41,0x1020be,0xfe0be,0x1060c1,0xfdf41,0x105f41,0x101f3e,0xfdf3e,0x1060be,0x810a03f,0x810a040,0x8109fc0,0x8109fbf,0x105f3e,0x180f9fc1,0x180fa041,0x180fa0c0,0x180fa0bf,0x180fa03e,0x180f9fbe,0x180f9f3f,0x180f9f40,0x8109fc1,0x810a041,0x810a0c0,0x810a0bf,0x810a03e,0x8109fbe,0x8109f3f,0x8109f40,0x301fc2,0x302042,0x1102140,0x110213f,0x190fe13f,0x180fa0c1,0x182fe042,0x182fdfc2,0x180f9f41,0x190fe140,0x9106140,0x910613f,0x180fa0be,0x70203d,0x701fbd,0x3101ebf,0x3101ec0,0x8305fc2,0x8306042,0x810a0c1,0x8109f41,0xb105ec0,0x1b0fdec0,0x180f9f3e,0x186fdfbd,0x186fe03d,0x810a0be,0x870603d,0x8705fbd,0x1b0fdebf,0xb105ebf,0x8109f3e,0x3020c2,0x1302141,0x190fe141,0x192fe0c2,0x83060c2,0x9306141,0x110213e,0x190fe13e,0x17020bd,0x910613e,0x301f42,0x182fdf42,0x3301ec1,0x8305f42,0x1b2fdec1,0xb305ec1,0x3101ebe,0x3701f3d,0x196fe0bd,0x97060bd,0x186fdf3d,0x1b6fdebe,0xb105ebe,0xb705f3d,
+	40,0x101fc0,0x10203f,0x101fbf,0xfdfc0,0xfe040,0xfe03f,0xfdfbf,0x105fc0,0x106040,0x10603f,0x105fbf,0x101fc1,0x102041,0xfe041,0xfdfc1,0x1020c0,0x1020bf,0x106041,0x105fc1,0xfe0c0,0xfe0bf,0x101f40,0x101f3f,0x1060c0,0x1060bf,0x10203e,0xfdf40,0xfdf3f,0x101fbe,0x105f40,0x105f3f,0x1020c1,0xfe03e,0xfdfbe,0x105fbe,0x10603e,0xfe0c1,0x101f41,0x1060c1,0xfdf41,0x180f9fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x105f41,0x8109fc0,0x1020be,0xfe0be,0x810a040,0x810a03f,0x8109fbf,0x101f3e,0xfdf3e,0x1060be,0x180fa041,0x180f9fc1,0x180fa0c0,0x180fa0bf,0x105f3e,0x8109fc1,0x810a041,0x810a0c0,0x810a0bf,0x302042,0x301fc2,0x180f9f40,0x180f9f3f,0x180f9fbe,0x180fa03e,0x2fe042,0x2fdfc2,0x305fc2,0x8306042,0x8109f40,0x8109f3f,0x8109fbe,0x810a03e,0x180fa0c1,0x1102140,0x110213f,0x190fe140,0x190fe13f,0x180f9f41,0x810a0c1,0x9106140,0x910613f,0x3020c2,0x2fe0c2,0x1302141,0x8109f41,0x3101ec0,0x3101ebf,0x1b0fdec0,0x1b0fdebf,0x301f42,0x2fdf42,0x83060c2,0x180fa0be,0x186f9f3e,0xb105ebf,0xb105ec0,0x305f42,0x192fe141,0x9306141,0x870a0be,0x70203d,0x701fbd,0x186fdfbd,0x186fe03d,0x870603d,0x8705fbd,0x8709f3e,0x3301ec1,0x1b2fdec1,0xb305ec1,0x1b2f9fc2,0x192fa042,0x110213e,0x190fe13e,0x970613e,0x97020bd,0x196fe0bd,0x3101ebe,0x1b6fdebe,0x13701f3d,0xb705ebe,0xb309fc2,
+	43,0x101fc0,0x101fbf,0x10203f,0xfe040,0xfdfc0,0xfdfbf,0xfe03f,0x106040,0x105fc0,0x105fbf,0x10603f,0x102041,0x101fc1,0xfdfc1,0xfe041,0x106041,0x105fc1,0x1020c0,0x1020bf,0xfe0c0,0xfe0bf,0x101f40,0x101f3f,0x1060c0,0x1060bf,0x1020c1,0xfdf40,0xfdf3f,0x105f40,0x105f3f,0x101f41,0xfe0c1,0x1060c1,0x10203e,0x101fbe,0xfdfbe,0xfdf41,0x105f41,0xfe03e,0x10603e,0x105fbe,0xf9fc0,0xfa040,0xfa03f,0xf9fbf,0xf9fc1,0xfa041,0x810a040,0x8109fc0,0x8109fbf,0x810a03f,0x1020be,0xfe0be,0x1060be,0x101f3e,0xfdf3e,0x301fc2,0x302042,0x810a041,0x8109fc1,0x2fdfc2,0x2fe042,0xfa0c0,0x180fa0bf,0xf9f40,0xf9f3f,0x105f3e,0x305fc2,0x306042,0x810a0c0,0x810a0bf,0x180fa0c1,0x3020c2,0x8109f40,0x8109f3f,0x180f9f41,0xf9fbe,0x180fa03e,0x1102140,0x110213f,0x810a0c1,0x3060c2,0x2fe0c2,0x10fe140,0x10fe13f,0x9106140,0x910613f,0x810a03e,0x8109fbe,0x8109f41,0x301f42,0x2fdf42,0x3101ec0,0x3701ebf,0x1b0fdec0,0x305f42,0x1302141,0x12fe141,0x9306141,0xb105ec0,0x1b6fdebf,0xb705ebf,0x3301ec1,0x1b2fdec1,0x186fa0be,0x1b6f9f3e,0x1b2f9fc2,0x182fa042,0xb305ec1,0x870a0be,0xb709f3e,0x3701fbd,0x170203d,0x196fe03d,0x1b6fdfbd,0x170213e,0x930a042,0xb309fc2,0xb705fbd,0x970603d,0x196fe13e,0x970613e,0x194fa140,0x192fa0c2,0x194f6040,0x1b2f5fc0,0x1b6f5fbf,
+	39,0x101fc0,0x101fbf,0x10203f,0xfe040,0xfdfc0,0x101fc1,0x102041,0x106040,0x105fc0,0xfdfbf,0xfe03f,0x10603f,0x105fbf,0xfdfc1,0xfe041,0x106041,0x105fc1,0x1020c0,0x1020bf,0xfe0c0,0x1020c1,0x1060c0,0x101f40,0x101f3f,0xfdf40,0xfe0bf,0x1060bf,0xfe0c1,0x101f41,0x105f40,0xfdf3f,0x1060c1,0x105f3f,0xfdf41,0x105f41,0x101fbe,0x10203e,0xfa040,0xf9fc0,0xf9fbf,0xfa03f,0xfe03e,0xfdfbe,0x105fbe,0x10603e,0x810a040,0x8109fc0,0x301fc2,0x302042,0xfa041,0xf9fc1,0x2fdfc2,0x2fe042,0x306042,0x305fc2,0x8109fbf,0x810a03f,0x810a041,0x8109fc1,0x1020be,0xfa0c0,0x180fa0bf,0xfe0be,0x7060be,0x101f3e,0xf9f40,0x180f9f3f,0x6fdf3e,0x180fa0c1,0x3020c2,0x810a0c0,0x810a0bf,0x705f3e,0x8109f40,0x301f42,0x180f9f41,0x2fe0c2,0x3060c2,0x810a0c1,0x1102140,0x110213f,0x10fe140,0x2fdf42,0x305f42,0x8109f41,0x8109f3f,0x9106140,0x1102141,0x10fe13f,0x180fa03e,0x186f9fbe,0x3101ec0,0x3701ebf,0x1b0fdec0,0x3301ec1,0xb105ec0,0x910613f,0x10fe141,0x9106141,0x870a03e,0x8709fbe,0x1b6fdebf,0x182f9fc2,0x182fa042,0x1b2fdec1,0xb705ebf,0xb305ec1,0x8309fc2,0x830a042,0x186fa0be,0x1b6f9f3e,0x970a0be,0x192fa0c2,0x1b2f9f42,0x1b4f5fc0,0x194f6040,0x192fa140,0x970213e,0xb709f3e,0xb701fbd,0x970203d,0x1a6fe03d,0x16fe13e,0x196fa13f,0x930a0c2,0xb309f42,0x11302142,
+	40,0x10203f,0x101fc0,0x101fbf,0xfe03f,0xfe040,0xfdfc0,0xfdfbf,0x10603f,0x106040,0x105fc0,0x105fbf,0x1020bf,0x1020c0,0xfe0c0,0xfe0bf,0x102041,0x101fc1,0x1060c0,0x1060bf,0xfe041,0xfdfc1,0x10203e,0x101fbe,0x106041,0x105fc1,0x101f40,0xfe03e,0xfdfbe,0x101f3f,0x10603e,0x105fbe,0x1020c1,0xfdf40,0xfdf3f,0x105f3f,0x105f40,0xfe0c1,0x1020be,0x1060c1,0xfe0be,0x180fa03f,0x180fa040,0x180f9fc0,0x180f9fbf,0x1060be,0x810a03f,0x101f41,0xfdf41,0x810a040,0x8109fc0,0x8109fbf,0x101f3e,0xfdf3e,0x105f41,0x180fa0c0,0x180fa0bf,0x180fa041,0x180f9fc1,0x105f3e,0x810a0bf,0x810a0c0,0x810a041,0x8109fc1,0x1102140,0x110213f,0x180fa03e,0x180f9fbe,0x180f9f3f,0x180f9f40,0x10fe140,0x10fe13f,0x110613f,0x9106140,0x810a03e,0x8109fbe,0x8109f3f,0x8109f40,0x180fa0c1,0x302042,0x301fc2,0x182fe042,0x182fdfc2,0x180fa0be,0x810a0c1,0x8306042,0x8305fc2,0x1102141,0x10fe141,0x13020c2,0x810a0be,0x70203d,0x701fbd,0x186fe03d,0x186fdfbd,0x110213e,0x10fe13e,0x9106141,0x180f9f41,0x1b0f9f3e,0x8705fbd,0x870603d,0x110613e,0x192fe0c2,0x93060c2,0xb109f41,0x3101ec0,0x3101ebf,0x1b0fdebf,0x1b0fdec0,0xb105ec0,0xb105ebf,0xb109f3e,0x17020bd,0x196fe0bd,0x97060bd,0x196fa13f,0x192fa140,0x301f42,0x182fdf42,0xb305f42,0xb301ec1,0x1b2fdec1,0x701f3d,0x1b6fdf3d,0x13701ebe,0xb705f3d,0x970a13f,
+	39,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0xfdfbf,0x106040,0x10603f,0x105fc0,0x105fbf,0x102041,0x1020c0,0x1020bf,0x101fc1,0xfe041,0xfe0c0,0xfe0bf,0xfdfc1,0x106041,0x1060c0,0x1060bf,0x105fc1,0x1020c1,0xfe0c1,0x10203e,0x101fbe,0x101f3f,0x101f40,0xfdf40,0xfdf3f,0xfdfbe,0xfe03e,0x10603e,0x1060c1,0x105f40,0x105f3f,0x105fbe,0x1020be,0x180fa040,0x180fa03f,0x180f9fc0,0x180f9fbf,0x101f41,0xfdf41,0x105f41,0xfe0be,0x1060be,0x810a03f,0x810a040,0x8109fc0,0x8109fbf,0x101f3e,0x180fa041,0x180fa0c0,0x180fa0bf,0x180f9fc1,0xfdf3e,0x105f3e,0x810a041,0x810a0c0,0x810a0bf,0x8109fc1,0x302042,0x301fc2,0x1102140,0x110213f,0x10fe140,0x180fa0c1,0x2fe042,0x2fdfc2,0x180f9f40,0x180f9f3f,0x180f9fbe,0x180fa03e,0x10fe13f,0x1106140,0x110613f,0x306042,0x305fc2,0x810a0c1,0x810a03e,0x8109fbe,0x8109f3f,0x8109f40,0x3020c2,0x1302141,0x10fe141,0x12fe0c2,0x180f9f41,0x186fa0be,0x1106141,0x13060c2,0x8109f41,0x870a0be,0x110213e,0x16fe13e,0x70203d,0x3701fbd,0x3701ebf,0x3101ec0,0x301f42,0x2fdf42,0x1b0fdec0,0x1b6fdebf,0x1b6f9f3e,0x1b6fdfbd,0x186fe03d,0x870603d,0x170613e,0xb705fbd,0xb705ebf,0xb105ec0,0x305f42,0x3301ec1,0xb709f3e,0x117020bd,0x196fa13f,0x192fa140,0x192fa042,0x1b2f9fc2,0x1b2fdec1,0xb305ec1,0xb309fc2,0x930a042,0x930a140,0x970a13f,
+	38,0x101fc0,0x10203f,0x101fbf,0xfe040,0xfdfc0,0xfe03f,0xfdfbf,0x106040,0x105fc0,0x10603f,0x105fbf,0x102041,0x101fc1,0xfe041,0x1020c0,0xfdfc1,0x1020bf,0x106041,0x105fc1,0xfe0c0,0xfe0bf,0x1060c0,0x1060bf,0x1020c1,0xfe0c1,0x1060c1,0x101f40,0x101f3f,0xfdf40,0xfdf3f,0x105f40,0x105f3f,0x101fbe,0x10203e,0xfe03e,0xfdfbe,0x101f41,0xfdf41,0x180f9fc0,0x180fa040,0x180fa03f,0x10603e,0x105fbe,0x180f9fbf,0x105f41,0x8109fc0,0x810a040,0x1020be,0xfe0be,0x810a03f,0x8109fbf,0x180fa041,0x180f9fc1,0x180fa0c0,0x180fa0bf,0x1060be,0x302042,0x301fc2,0x810a041,0x8109fc1,0x810a0c0,0x810a0bf,0x2fe042,0x2fdfc2,0x306042,0x305fc2,0x101f3e,0xfdf3e,0x180fa0c1,0x1102140,0x110213f,0x10fe140,0x10fe13f,0x3020c2,0x810a0c1,0x1106140,0x110613f,0x105f3e,0x180f9f40,0x180f9f3f,0x180f9fbe,0x180fa03e,0x2fe0c2,0x1302141,0x3060c2,0x12fe141,0x1306141,0x8109f40,0x8109f3f,0x180f9f41,0x301f42,0x8109f41,0x8109fbe,0x810a03e,0x186fa0be,0x2fdf42,0x305f42,0x3101ec0,0x3701ebf,0x1b0fdec0,0x1b6fdebf,0x870a0be,0x170213e,0x16fe13e,0x182fa042,0x1b2f9fc2,0xb105ec0,0xb705ebf,0x3301ec1,0x1b2fdec1,0x1b6f9f3e,0x3701fbd,0x170203d,0x170613e,0x192fa140,0x196fa13f,0x930a042,0xb309fc2,0xb305ec1,0xb709f3e,0xb705fbd,0x196fe03d,0x1b6fdfbd,0x970603d,0x930a140,0x970a13f,0x192fa0c2,
+	35,0x101fc0,0x10203f,0xfe040,0xfdfc0,0x101fbf,0x106040,0x102041,0x101fc1,0x105fc0,0xfe03f,0xfdfbf,0x10603f,0x105fbf,0xfe041,0xfdfc1,0x106041,0x105fc1,0x1020c0,0x1020bf,0xfe0c0,0x1020c1,0x1060c0,0xfe0bf,0x1060bf,0xfe0c1,0x1060c1,0x101f40,0xfdf40,0x101f3f,0x105f40,0x101f41,0xfdf3f,0x105f3f,0xfdf41,0x105f41,0x70203e,0x701fbe,0xfa040,0xf9fc0,0xfa03f,0x6fe03e,0x6fdfbe,0x180f9fbf,0xfa041,0x180f9fc1,0x302042,0x301fc2,0x810a040,0x70603e,0x705fbe,0x8109fc0,0x810a03f,0x8109fbf,0x810a041,0x2fe042,0x2fdfc2,0x306042,0x305fc2,0x8109fc1,0x7020be,0xfa0c0,0x180fa0bf,0x6fe0be,0x7060be,0x810a0c0,0x3020c2,0x180fa0c1,0x2fe0c2,0x1102140,0x810a0bf,0x810a0c1,0x3060c2,0x10fe140,0x110213f,0x1106140,0x1102141,0x180f9f40,0x701f3e,0x6fdf3e,0x180f9f3f,0x180f9f41,0x10fe13f,0x110613f,0x10fe141,0x1106141,0x8109f40,0x705f3e,0x8109f3f,0x301f42,0x2fdf42,0x305f42,0x8109f41,0x186fa03e,0x186f9fbe,0x182fa042,0x1b2f9fc2,0x870a03e,0xb709fbe,0x3101ec0,0x1b0fdec0,0x3701ebf,0x186fa0be,0x830a042,0xb309fc2,0xb105ec0,0x3301ec1,0x1b6fdebf,0xb705ebf,0x1b2fdec1,0x182fa0c2,0x190fa140,0x870a0be,0x170213e,0x16fe13e,0x196fa13f,0x190fa141,0x1302142,0x830a0c2,0xb305ec1,0x1b6f9f3e,0x170613e,0x910a140,0x970a13f,0x910a141,0x9306142,0x192fe142,0x1a4f6040,
+	43,0x10203f,0x101fbf,0x101fc0,0xfe040,0xfe03f,0xfdfbf,0xfdfc0,0x106040,0x10603f,0x105fbf,0x105fc0,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x1060c0,0x1060bf,0x102041,0x101fc1,0xfe041,0xfdfc1,0x10203e,0x101fbe,0x106041,0x105fc1,0x1020c1,0xfe03e,0xfdfbe,0x10603e,0x105fbe,0x1020be,0xfe0c1,0x1060c1,0x101f40,0x101f3f,0xfdf3f,0xfe0be,0x1060be,0xfdf40,0x105f40,0x105f3f,0xfa03f,0xfa040,0xf9fc0,0xf9fbf,0xfa0bf,0xfa0c0,0x810a040,0x810a03f,0x8109fbf,0x8109fc0,0x101f41,0xfdf41,0x105f41,0x101f3e,0xfdf3e,0x110213f,0x1102140,0x810a0c0,0x810a0bf,0x10fe13f,0x10fe140,0xfa041,0x180f9fc1,0xfa03e,0xf9fbe,0x105f3e,0x110613f,0x1106140,0x810a041,0x8109fc1,0x180fa0c1,0x1102141,0x810a03e,0x8109fbe,0x180fa0be,0xf9f3f,0x180f9f40,0x302042,0x301fc2,0x810a0c1,0x1106141,0x10fe141,0x2fe042,0x2fdfc2,0x8306042,0x8305fc2,0x8109f40,0x8109f3f,0x810a0be,0x110213e,0x10fe13e,0x70203d,0x3701fbd,0x186fe03d,0x110613e,0x13020c2,0x12fe0c2,0x93060c2,0x870603d,0x1b6fdfbd,0xb705fbd,0x17020bd,0x196fe0bd,0x1b0f9f41,0x1b6f9f3e,0x196fa13f,0x190fa140,0x97060bd,0xb109f41,0xb709f3e,0x3701ebf,0x3301ec0,0x1b2fdec0,0x1b6fdebf,0x3301f42,0x930a140,0x970a13f,0xb705ebf,0xb305ec0,0x1b2fdf42,0xb305f42,0x1a2fa042,0x192fa141,0x1a2f6040,0x196f603f,0x1b6f5fbf,
+	38,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0xfdfbf,0x106040,0x10603f,0x105fc0,0x105fbf,0x1020c0,0x1020bf,0xfe0c0,0x102041,0xfe0bf,0x101fc1,0x1060c0,0x1060bf,0xfe041,0xfdfc1,0x106041,0x105fc1,0x1020c1,0xfe0c1,0x1060c1,0x10203e,0x101fbe,0xfe03e,0xfdfbe,0x10603e,0x105fbe,0x101f3f,0x101f40,0xfdf40,0xfdf3f,0x1020be,0xfe0be,0x180fa03f,0x180fa040,0x180f9fc0,0x105f40,0x105f3f,0x180f9fbf,0x1060be,0x810a03f,0x810a040,0x101f41,0xfdf41,0x8109fc0,0x8109fbf,0x180fa0c0,0x180fa0bf,0x180fa041,0x180f9fc1,0x105f41,0x1102140,0x110213f,0x810a0c0,0x810a0bf,0x810a041,0x8109fc1,0x10fe140,0x10fe13f,0x1106140,0x110613f,0x101f3e,0xfdf3e,0x180fa0c1,0x302042,0x301fc2,0x2fe042,0x2fdfc2,0x1102141,0x810a0c1,0x306042,0x305fc2,0x105f3e,0x180fa03e,0x180f9fbe,0x180f9f3f,0x180f9f40,0x10fe141,0x13020c2,0x1106141,0x12fe0c2,0x13060c2,0x810a03e,0x8109fbe,0x180fa0be,0x110213e,0x810a0be,0x8109f3f,0x8109f40,0x1b0f9f41,0x10fe13e,0x110613e,0x70203d,0x3701fbd,0x186fe03d,0x1b6fdfbd,0xb109f41,0x3301f42,0x32fdf42,0x190fa140,0x196fa13f,0x870603d,0xb705fbd,0x17020bd,0x196fe0bd,0x1b6f9f3e,0x3701ebf,0x3301ec0,0x3305f42,0x192fa042,0x1b2f9fc2,0x930a140,0x970a13f,0x97060bd,0xb709f3e,0xb705ebf,0x1b2fdec0,0x1b6fdebf,0xb305ec0,0x930a042,0xb309fc2,0x192fa141,
+	38,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0x106040,0x10603f,0xfdfbf,0x105fc0,0x102041,0x1020c0,0x105fbf,0x1020bf,0x101fc1,0xfe041,0xfe0c0,0xfe0bf,0xfdfc1,0x106041,0x1060c0,0x1060bf,0x105fc1,0x1020c1,0xfe0c1,0x1060c1,0x10203e,0x101f40,0x101f3f,0x101fbe,0xfe03e,0xfdfbe,0xfdf40,0xfdf3f,0x105f40,0x105f3f,0x10603e,0x105fbe,0x180fa040,0x180fa03f,0x180f9fc0,0x180f9fbf,0x1020be,0xfe0be,0x101f41,0xfdf41,0x105f41,0x810a040,0x810a03f,0x1060be,0x8109fc0,0x8109fbf,0x180fa041,0x180fa0c0,0x180fa0bf,0x180f9fc1,0x302042,0x301fc2,0x810a041,0x810a0c0,0x1102140,0x110213f,0x10fe140,0x180fa0c1,0x2fe042,0x2fdfc2,0x8109fc1,0x810a0bf,0x1106140,0x10fe13f,0x110613f,0x306042,0x305fc2,0x3020c2,0x1102141,0x810a0c1,0x3060c2,0x2fe0c2,0x10fe141,0x1106141,0x101f3e,0xfdf3e,0x105f3e,0x180fa03e,0x180f9fbe,0x180f9f40,0x180f9f3f,0x1b0f9f41,0x8109f40,0x8109f3f,0x810a03e,0xb109fbe,0x180fa0be,0x110213e,0x870a0be,0xb109f41,0x3301f42,0x32fdf42,0x3305f42,0x182fa042,0x1b2f9fc2,0x10fe13e,0x170613e,0x190fa140,0x196fa13f,0x190fa141,0x192fa0c2,0x930a042,0xb309fc2,0x930a140,0x970a13f,0x70203d,0x3701fbd,0x186fe03d,0x1b6fdfbd,0x1b6f9f3e,0x3301ec0,0x3701ebf,0x1b2fdec0,0x1b6fdebf,0xb305ec0,0xb705ebf,0x870603d,0xb705fbd,0x97020bd,0x196fe0bd,0x11302142,
+	33,0x101fc0,0x10203f,0xfe040,0xfdfc0,0x101fbf,0x106040,0x102041,0xfe03f,0x101fc1,0x105fc0,0x1020c0,0xfdfbf,0x10603f,0xfe041,0xfdfc1,0x105fbf,0x106041,0x1020bf,0xfe0c0,0x105fc1,0x1060c0,0x1020c1,0xfe0bf,0x1060bf,0xfe0c1,0x1060c1,0x101f40,0xfdf40,0x101f3f,0x105f40,0x101f41,0xfdf3f,0x10203e,0x101fbe,0x180fa040,0x180f9fc0,0xfdf41,0x105f3f,0xfe03e,0x180fa03f,0x180f9fbf,0x6fdfbe,0x10603e,0x705fbe,0x105f41,0x810a040,0x8109fc0,0x302042,0x180fa041,0x180f9fc1,0x301fc2,0x2fe042,0x180fa0c0,0x1020be,0x810a03f,0x8109fbf,0x810a041,0x306042,0x2fdfc2,0x180fa0bf,0x6fe0be,0x7060be,0x1102140,0x180fa0c1,0x3020c2,0x305fc2,0x8109fc1,0x810a0c0,0x810a0bf,0x110213f,0x10fe140,0x2fe0c2,0x1102141,0x1106140,0x810a0c1,0x3060c2,0x10fe13f,0x110613f,0x10fe141,0x1106141,0x180f9f40,0x701f3e,0x6fdf3e,0x180f9f3f,0x180f9f41,0x301f42,0x8109f40,0x705f3e,0x186fa03e,0x186f9fbe,0x2fdf42,0x305f42,0x8109f41,0x8109f3f,0x870a03e,0xb709fbe,0x186fa0be,0x182fa042,0x1b2f9fc2,0x182fa0c2,0x190fa140,0x170213e,0x870a0be,0x830a042,0xb309fc2,0x830a0c2,0x1302142,0x190fa13f,0x196fe13e,0x170613e,0x910a140,0x970a13f,0x190fa141,0x192fe142,0x1306142,0x930a141,0x3101ec0,0x1b0fdec0,0x3701ebf,0xb105ec0,0x3301ec1,0x1b6fdebf,0x1b6f9f3e,0x1b2fdec1,0xb705ebf,0xb305ec1,0x1270203d,
+	39,0x10203f,0x101fbf,0x101fc0,0xfe040,0xfe03f,0x1020bf,0x1020c0,0x106040,0x10603f,0xfdfbf,0xfdfc0,0x105fc0,0x105fbf,0xfe0bf,0xfe0c0,0x1060c0,0x1060bf,0x102041,0x101fc1,0xfe041,0x1020c1,0x106041,0x10203e,0x101fbe,0xfe03e,0xfdfc1,0x105fc1,0xfe0c1,0x1020be,0x10603e,0xfdfbe,0x1060c1,0x105fbe,0xfe0be,0x1060be,0x101f3f,0x101f40,0xfa040,0xfa03f,0xf9fbf,0xf9fc0,0xfdf40,0xfdf3f,0x105f3f,0x105f40,0x810a040,0x810a03f,0x110213f,0x1102140,0xfa0c0,0xfa0bf,0x10fe13f,0x10fe140,0x1106140,0x110613f,0x8109fbf,0x8109fc0,0x810a0c0,0x810a0bf,0x101f41,0xfa041,0x180f9fc1,0xfdf41,0x3105f41,0x101f3e,0xfa03e,0x180f9fbe,0x30fdf3e,0x180fa0c1,0x1102141,0x810a041,0x8109fc1,0x3105f3e,0x810a03e,0x110213e,0x180fa0be,0x10fe141,0x1106141,0x810a0c1,0x302042,0x301fc2,0x2fe042,0x10fe13e,0x110613e,0x810a0be,0x8109fbe,0x8306042,0x3020c2,0x2fdfc2,0x180f9f40,0x1b0f9f3f,0x70203d,0x3701fbd,0x186fe03d,0x17020bd,0x870603d,0x8305fc2,0x2fe0c2,0x83060c2,0xb109f40,0xb109f3f,0x1b6fdfbd,0x190fa13f,0x190fa140,0x196fe0bd,0xb705fbd,0x97060bd,0x910a13f,0x910a140,0x1b0f9f41,0x1b6f9f3e,0xb309f41,0x192fa141,0x196fa13e,0x1a6f603f,0x1a2f6040,0x192fa042,0xb301f42,0xb709f3e,0xb701ebf,0xb301ec0,0x1b4fdec0,0x32fdf42,0x1b2f9fc2,0x930a141,0x970a13e,0x11302142,
+	35,0x10203f,0x101fc0,0xfe040,0xfe03f,0x101fbf,0x106040,0x1020c0,0x1020bf,0x10603f,0xfdfc0,0xfdfbf,0x105fc0,0x105fbf,0xfe0c0,0xfe0bf,0x1060c0,0x1060bf,0x102041,0x101fc1,0xfe041,0x1020c1,0x106041,0xfdfc1,0x105fc1,0xfe0c1,0x1060c1,0x10203e,0xfe03e,0x101fbe,0x10603e,0x1020be,0xfdfbe,0x105fbe,0xfe0be,0x1060be,0x3101f40,0x3101f3f,0xfa040,0xfa03f,0xf9fc0,0x30fdf40,0x30fdf3f,0x180f9fbf,0xfa0c0,0x180fa0bf,0x1102140,0x110213f,0x810a040,0x3105f40,0x3105f3f,0x810a03f,0x8109fc0,0x8109fbf,0x810a0c0,0x10fe140,0x10fe13f,0x1106140,0x110613f,0x810a0bf,0x3101f41,0xfa041,0x180f9fc1,0x30fdf41,0x3105f41,0x810a041,0x1102141,0x180fa0c1,0x10fe141,0x302042,0x8109fc1,0x810a0c1,0x1106141,0x2fe042,0x301fc2,0x306042,0x3020c2,0x180fa03e,0x3101f3e,0x30fdf3e,0x180f9fbe,0x180fa0be,0x2fdfc2,0x305fc2,0x2fe0c2,0x3060c2,0x810a03e,0x3105f3e,0x8109fbe,0x110213e,0x10fe13e,0x110613e,0x810a0be,0x1b0f9f40,0x1b0f9f3f,0x190fa140,0x196fa13f,0xb109f40,0xb709f3f,0x70203d,0x186fe03d,0x3701fbd,0x1b0f9f41,0x910a140,0x970a13f,0x870603d,0x17020bd,0x1b6fdfbd,0xb705fbd,0x196fe0bd,0x190fa141,0x182fa042,0xb109f41,0x3301f42,0x32fdf42,0x1b2f9fc2,0x182fa0c2,0x1302142,0x910a141,0x97060bd,0x1b6f9f3e,0x3305f42,0x830a042,0xb309fc2,0x830a0c2,0x9306142,0x192fe142,0x1a4f6040,
+	33,0x10203f,0x101fc0,0xfe040,0xfe03f,0x101fbf,0x106040,0x1020c0,0xfdfc0,0x1020bf,0x10603f,0x102041,0xfdfbf,0x105fc0,0xfe0c0,0xfe0bf,0x105fbf,0x1060c0,0x101fc1,0xfe041,0x1060bf,0x106041,0x1020c1,0xfdfc1,0x105fc1,0xfe0c1,0x1060c1,0x10203e,0xfe03e,0x101fbe,0x10603e,0x1020be,0xfdfbe,0x101f40,0x101f3f,0x180fa040,0x180fa03f,0xfe0be,0x105fbe,0xfdf40,0x180f9fc0,0x180f9fbf,0x30fdf3f,0x105f40,0x3105f3f,0x1060be,0x810a040,0x810a03f,0x1102140,0x180fa0c0,0x180fa0bf,0x110213f,0x10fe140,0x180fa041,0x101f41,0x8109fc0,0x8109fbf,0x810a0c0,0x1106140,0x10fe13f,0x180f9fc1,0x30fdf41,0x3105f41,0x302042,0x180fa0c1,0x1102141,0x110613f,0x810a0bf,0x810a041,0x8109fc1,0x301fc2,0x2fe042,0x10fe141,0x3020c2,0x306042,0x810a0c1,0x1106141,0x2fdfc2,0x305fc2,0x2fe0c2,0x3060c2,0x180fa03e,0x3101f3e,0x30fdf3e,0x180f9fbe,0x180fa0be,0x110213e,0x810a03e,0x3105f3e,0x1b0f9f40,0x1b0f9f3f,0x10fe13e,0x110613e,0x810a0be,0x8109fbe,0xb109f40,0xb709f3f,0x1b0f9f41,0x190fa140,0x196fa13f,0x190fa141,0x182fa042,0x3301f42,0xb109f41,0x910a140,0x970a13f,0x910a141,0x1302142,0x182f9fc2,0x1b2fdf42,0x3305f42,0x830a042,0xb309fc2,0x182fa0c2,0x192fe142,0x1306142,0x930a0c2,0x70203d,0x186fe03d,0x3701fbd,0x870603d,0x17020bd,0x1b6fdfbd,0x1b6f9f3e,0x196fe0bd,0xb705fbd,0x97060bd,0x13501ec0,
+	37,0x10203f,0x101fc0,0xfe040,0x102041,0x1020c0,0x106040,0x101fbf,0xfe03f,0xfdfc0,0x101fc1,0x105fc0,0x10603f,0x1020bf,0xfe0c0,0xfe041,0xfdfbf,0x1020c1,0x106041,0x1060c0,0x105fbf,0xfe0bf,0xfdfc1,0x105fc1,0x1060bf,0xfe0c1,0x1060c1,0x10203e,0x101f40,0xfa040,0xfa03f,0xfe03e,0x101fbe,0x101f3f,0xfdf40,0xf9fc0,0xfa041,0xfa0c0,0x1020be,0x10603e,0x105f40,0x101f41,0x302042,0x1102140,0x810a040,0xfdfbe,0xfdf3f,0xf9fbf,0xfa0bf,0xfe0be,0x110213f,0x10fe140,0xf9fc1,0xfdf41,0x301fc2,0x2fe042,0xfa0c1,0x105fbe,0x105f3f,0x8109fc0,0x810a03f,0x7060be,0x1106140,0x1102141,0x3020c2,0x306042,0x3105f41,0x810a041,0x810a0c0,0x8109fbf,0x8109fc1,0x2fdfc2,0x305fc2,0x2fe0c2,0x10fe13f,0x110613f,0x810a0bf,0x10fe141,0x1106141,0x3060c2,0x810a0c1,0x101f3e,0xfa03e,0xf9f40,0x1b0f9f3f,0x36fdf3e,0x1b6f9fbe,0x186fa0be,0x10fa140,0x2fa042,0x1b0f9f41,0x3301f42,0xb109f40,0x3705f3e,0x870a03e,0x170213e,0x16fe13e,0x196fa13f,0x190fa141,0x182fa0c2,0x182f9fc2,0x1b2fdf42,0x3305f42,0xb109f41,0xb109f3f,0xb709fbe,0x870a0be,0x170613e,0x910a140,0x1302142,0x830a042,0xb309fc2,0x830a0c2,0x1306142,0x192fe142,0x970a13f,0x930a141,0x970203d,0x196fe03d,0x13701fbd,0xb301ec0,0xb701ebf,0x1b4fdec0,0x180f6040,0x186f603f,0x1b6f5fc0,0x1b2f6041,0x194f60c0
+};
+
+template<> const unsigned int worklist_variant<8,64>::wl[32768]={
+	7,0x10203f,0x101fc0,0xfe040,0xfe03f,0x101fbf,0xfdfc0,0xfdfbf,0x10fe0bf,0x11020bf,0x11020c0,0x10fe0c0,0x2fe041,0x302041,0x301fc1,0x2fdfc1,0x8105fc0,0x8106040,0x810603f,0x8105fbf,0x701fbe,0x70203e,0x6fe03e,0x6fdfbe,0x30fdf3f,0x3101f3f,0x3101f40,0x30fdf40,0x180f9fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x12fe0c1,0x13020c1,0x91060c0,0x91060bf,0x8306041,0x8305fc1,0x3301f41,0x32fdf41,0x182f9fc1,0x182fa041,0x190fa0c0,0x190fa0bf,0x16fe0be,0x17020be,0x870603e,0x8705fbe,0xb105f3f,0xb105f40,0x3701f3e,0x36fdf3e,0x186f9fbe,0x186fa03e,0x1b0f9f3f,0x1b0f9f40,0x93060c1,0x192fa0c1,0x97060be,0xb305f41,0x1b2f9f41,0x196fa0be,0xb705f3e,0x1b6f9f3e,
+	7,0x101fc0,0xfe040,0xfdfc0,0xfdfbf,0x101fbf,0x10203f,0xfe03f,0x2fe041,0x302041,0x301fc1,0x2fdfc1,0x8105fc0,0x8106040,0x810603f,0x8105fbf,0x11020c0,0x10fe0c0,0x10fe0bf,0x11020bf,0x180fa03f,0x180fa040,0x180f9fc0,0x180f9fbf,0x30fdf3f,0x30fdf40,0x3101f40,0x3101f3f,0x701fbe,0x70203e,0x6fe03e,0x6fdfbe,0x12fe0c1,0x13020c1,0x8306041,0x8305fc1,0x3301f41,0x32fdf41,0x182f9fc1,0x182fa041,0x91060c0,0x91060bf,0xb105f3f,0xb105f40,0x190fa0c0,0x190fa0bf,0x16fe0be,0x17020be,0x870603e,0x8705fbe,0x1b0f9f3f,0x1b0f9f40,0x186f9fbe,0x186fa03e,0x36fdf3e,0x3701f3e,0x93060c1,0x192fa0c1,0xb305f41,0x1b2f9f41,0x97060be,0xb705f3e,0x196fa0be,0x1b6f9f3e,
+	11,0x101fc0,0xfe040,0xfdfc0,0xfdfbf,0x101fbf,0x10203f,0xfe03f,0xfe041,0x102041,0x101fc1,0xfdfc1,0x8105fc0,0x8106040,0x11020c0,0x10fe0c0,0x10fe0bf,0x11020bf,0x810603f,0x8105fbf,0x3101f40,0x30fdf40,0x180f9fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x30fdf3f,0x3101f3f,0x701fbe,0x70203e,0x6fe03e,0x6fdfbe,0x10fe0c1,0x11020c1,0x8106041,0x8105fc1,0x3101f41,0x30fdf41,0x180f9fc1,0x180fa041,0x91060c0,0x91060bf,0xb105f40,0xb105f3f,0x190fa0c0,0x190fa0bf,0x1b0f9f40,0x1b0f9f3f,0x16fe0be,0x17020be,0x970603e,0x8705fbe,0xb701f3e,0x36fdf3e,0x1b6f9fbe,0x196fa03e,0x93060c1,0x192fa0c1,0xb305f41,0x1b2f9f41,0x1b2fdfc2,0x192fe042,0x9302042,0xb301fc2,
+	11,0x101fc0,0xfe040,0xfdfc0,0xfdfbf,0x101fbf,0x10203f,0xfe03f,0xfe041,0x102041,0x101fc1,0xfdfc1,0x8105fc0,0x8106040,0x11020c0,0x10fe0c0,0x10fe0bf,0x11020bf,0x810603f,0x8105fbf,0x3101f40,0x30fdf40,0x180f9fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x30fdf3f,0x3101f3f,0x701fbe,0x70203e,0x6fe03e,0x6fdfbe,0x10fe0c1,0x11020c1,0x8106041,0x8105fc1,0x3101f41,0x30fdf41,0x180f9fc1,0x180fa041,0x91060c0,0x91060bf,0xb105f40,0xb105f3f,0x190fa0c0,0x190fa0bf,0x1b0f9f40,0x1b0f9f3f,0x16fe0be,0x17020be,0x970603e,0x8705fbe,0xb701f3e,0x36fdf3e,0x1b6f9fbe,0x196fa03e,0x93060c1,0x192fa0c1,0xb305f41,0x1b2f9f41,0x1b2fdfc2,0x192fe042,0x9302042,0xb301fc2,
+	11,0x101fc0,0xfe040,0xfdfc0,0xfdfbf,0x101fbf,0x10203f,0xfe03f,0xfe041,0x102041,0x101fc1,0xfdfc1,0x8105fc0,0x8106040,0x11020c0,0x10fe0c0,0x10fe0bf,0x11020bf,0x810603f,0x8105fbf,0x3101f40,0x30fdf40,0x180f9fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x30fdf3f,0x3101f3f,0x8105fc1,0x8106041,0x11020c1,0x10fe0c1,0x180fa041,0x180f9fc1,0x30fdf41,0x3101f41,0x701fbe,0x70203e,0x6fe03e,0x6fdfbe,0x91060c0,0x91060bf,0xb105f40,0xb105f3f,0x190fa0c0,0x190fa0bf,0x1b0f9f40,0x1b0f9f3f,0x93060c1,0xb305f41,0x8705fbe,0x870603e,0x97020be,0x16fe0be,0x192fa0c1,0x1b2f9f41,0x186f9fbe,0x196fa03e,0x1b6fdf3e,0xb701f3e,0xb301fc2,0x9302042,0x192fe042,0x1b2fdfc2,
+	11,0x101fc0,0xfe040,0xfdfc0,0xfdfbf,0x101fbf,0x10203f,0xfe03f,0xfe041,0x102041,0x101fc1,0xfdfc1,0x8105fc0,0x8106040,0x11020c0,0x10fe0c0,0x10fe0bf,0x11020bf,0x810603f,0x8105fbf,0x3101f40,0x30fdf40,0x180f9fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x30fdf3f,0x3101f3f,0x8105fc1,0x8106041,0x11020c1,0x10fe0c1,0x180fa041,0x180f9fc1,0x30fdf41,0x3101f41,0x701fbe,0x70203e,0x6fe03e,0x6fdfbe,0x91060c0,0x91060bf,0xb105f40,0xb105f3f,0x190fa0c0,0x190fa0bf,0x1b0f9f40,0x1b0f9f3f,0x93060c1,0xb305f41,0x192fa0c1,0x1b2f9f41,0x1b2fdfc2,0x192fe042,0x9302042,0xb301fc2,0x8705fbe,0x870603e,0x97020be,0x16fe0be,0x196fa03e,0x186f9fbe,0x1b6fdf3e,0xb701f3e,
+	11,0x101fc0,0xfe040,0xfdfc0,0xfdfbf,0x101fbf,0x10203f,0xfe03f,0xfe041,0x102041,0x101fc1,0xfdfc1,0x8105fc0,0x8106040,0x11020c0,0x10fe0c0,0x180fa040,0x180f9fc0,0x30fdf40,0x3101f40,0x8105fbf,0x810603f,0x11020bf,0x10fe0bf,0x180fa03f,0x180f9fbf,0x30fdf3f,0x3101f3f,0x8105fc1,0x8106041,0x11020c1,0x10fe0c1,0x180fa041,0x180f9fc1,0x30fdf41,0x3101f41,0x91060c0,0x91060bf,0x70203e,0x701fbe,0x6fdfbe,0x6fe03e,0x190fa0c0,0x190fa0bf,0xb105f40,0xb105f3f,0x1b0f9f40,0x1b0f9f3f,0x93060c1,0xb305f41,0x192fa0c1,0x192fe042,0x9302042,0xb301fc2,0x1b2fdfc2,0x1b2f9f41,0x8705fbe,0x870603e,0x97020be,0x16fe0be,0x196fa03e,0x186f9fbe,0x1b6fdf3e,0xb701f3e,
+	11,0x101fc0,0xfe040,0xfdfc0,0xfdfbf,0x101fbf,0x10203f,0xfe03f,0xfe041,0x102041,0x101fc1,0xfdfc1,0x8105fc0,0x8106040,0x11020c0,0x10fe0c0,0x180fa040,0x180f9fc0,0x30fdf40,0x3101f40,0x8105fbf,0x810603f,0x11020bf,0x10fe0bf,0x10fe0c1,0x11020c1,0x8106041,0x8105fc1,0x3101f3f,0x30fdf3f,0x180f9fbf,0x180fa03f,0x180fa041,0x180f9fc1,0x30fdf41,0x3101f41,0x91060c0,0x91060bf,0xb105f40,0x190fa0c0,0x190fa0bf,0x6fe03e,0x70203e,0x701fbe,0x6fdfbe,0x1b0f9f40,0x1b0f9f3f,0xb105f3f,0x93060c1,0x9302042,0x192fe042,0x192fa0c1,0x1b2fdfc2,0xb301fc2,0xb305f41,0x1b2f9f41,0x8705fbe,0x870603e,0x97020be,0x16fe0be,0x196fa03e,0x186f9fbe,0x1b6fdf3e,0xb701f3e,
+	7,0x10203f,0xfe040,0xfe03f,0xfdfbf,0x101fbf,0x101fc0,0xfdfc0,0x10fe0c0,0x11020c0,0x11020bf,0x10fe0bf,0x810603f,0x8106040,0x8105fc0,0x8105fbf,0x302041,0x2fe041,0x2fdfc1,0x301fc1,0x180f9fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x6fdfbe,0x6fe03e,0x70203e,0x701fbe,0x3101f3f,0x3101f40,0x30fdf40,0x30fdf3f,0x12fe0c1,0x13020c1,0x91060c0,0x91060bf,0x17020be,0x16fe0be,0x190fa0bf,0x190fa0c0,0x8306041,0x8305fc1,0x8705fbe,0x870603e,0x182fa041,0x182f9fc1,0x32fdf41,0x3301f41,0xb105f40,0xb105f3f,0x186f9fbe,0x186fa03e,0x1b0f9f3f,0x1b0f9f40,0x36fdf3e,0x3701f3e,0x93060c1,0x192fa0c1,0x97060be,0x196fa0be,0xb305f41,0xb705f3e,0x1b2f9f41,0x1b6f9f3e,
+	7,0xfe040,0xfe03f,0x10203f,0x101fc0,0xfdfc0,0xfdfbf,0x101fbf,0x302041,0x2fe041,0x2fdfc1,0x301fc1,0x11020c0,0x10fe0c0,0x10fe0bf,0x11020bf,0x810603f,0x8106040,0x8105fc0,0x8105fbf,0x180fa040,0x180fa03f,0x180f9fbf,0x180f9fc0,0x30fdf40,0x3101f40,0x3101f3f,0x30fdf3f,0x6fdfbe,0x6fe03e,0x70203e,0x701fbe,0x13020c1,0x12fe0c1,0x8306041,0x8305fc1,0x91060c0,0x91060bf,0x190fa0bf,0x190fa0c0,0x182fa041,0x182f9fc1,0x32fdf41,0x3301f41,0xb105f40,0xb105f3f,0x17020be,0x16fe0be,0x870603e,0x8705fbe,0x186f9fbe,0x186fa03e,0x1b0f9f3f,0x1b0f9f40,0x36fdf3e,0x3701f3e,0x93060c1,0x192fa0c1,0xb305f41,0x97060be,0x196fa0be,0x1b2f9f41,0xb705f3e,0x1b6f9f3e,
+	9,0xfe040,0xfdfc0,0x101fc0,0x10203f,0xfe03f,0xfdfbf,0x101fbf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x11020c0,0x10fe0c0,0x10fe0bf,0x11020bf,0x8106040,0x8105fc0,0x8105fbf,0x810603f,0x180fa040,0x180f9fc0,0x180f9fbf,0x180fa03f,0x30fdf40,0x3101f40,0x3101f3f,0x30fdf3f,0x6fdfbe,0x6fe03e,0x70203e,0x701fbe,0x11020c1,0x10fe0c1,0x8106041,0x8305fc1,0x91060c0,0x91060bf,0x180fa041,0x182f9fc1,0x32fdf41,0x3301f41,0x190fa0c0,0x190fa0bf,0x16fe0be,0x17020be,0xb105f3f,0xb105f40,0x8705fbe,0x870603e,0x1b0f9f40,0x1b0f9f3f,0x186f9fbe,0x186fa03e,0x1b6fdf3e,0xb701f3e,0x93060c1,0x192fa0c1,0xb305f41,0x1b2f9f41,0x97060be,0x196fa0be,0x1a2fe042,0xa302042,
+	11,0xfe040,0xfdfc0,0x101fc0,0x10203f,0xfe03f,0xfdfbf,0x101fbf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x11020c0,0x10fe0c0,0x10fe0bf,0x11020bf,0x8106040,0x8105fc0,0x8105fbf,0x810603f,0x180fa040,0x180f9fc0,0x180f9fbf,0x180fa03f,0x30fdf40,0x3101f40,0x3101f3f,0x30fdf3f,0x6fdfbe,0x6fe03e,0x70203e,0x701fbe,0x11020c1,0x10fe0c1,0x8106041,0x8105fc1,0x180fa041,0x180f9fc1,0x30fdf41,0x3101f41,0x91060c0,0x91060bf,0x190fa0c0,0x190fa0bf,0x16fe0be,0x17020be,0xb105f40,0xb105f3f,0x1b0f9f40,0x1b0f9f3f,0x8705fbe,0x970603e,0x93060c1,0x192fa0c1,0x196fa03e,0x186f9fbe,0x1b6fdf3e,0xb701f3e,0xb305f41,0x1b2f9f41,0x1b2fdfc2,0x192fe042,0x9302042,0xb301fc2,
+	11,0xfe040,0xfdfc0,0x101fc0,0x10203f,0xfe03f,0xfdfbf,0x101fbf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x11020c0,0x10fe0c0,0x10fe0bf,0x11020bf,0x8106040,0x8105fc0,0x8105fbf,0x810603f,0x180fa040,0x180f9fc0,0x180f9fbf,0x180fa03f,0x30fdf40,0x3101f40,0x3101f3f,0x30fdf3f,0x10fe0c1,0x11020c1,0x8106041,0x8105fc1,0x180fa041,0x180f9fc1,0x30fdf41,0x3101f41,0x701fbe,0x70203e,0x6fe03e,0x6fdfbe,0x91060c0,0x91060bf,0x190fa0c0,0x190fa0bf,0xb105f40,0xb105f3f,0x1b0f9f40,0x1b0f9f3f,0x93060c1,0x192fa0c1,0x16fe0be,0x17020be,0x970603e,0x8705fbe,0xb305f41,0x1b2f9f41,0x186f9fbe,0x196fa03e,0x1b6fdf3e,0xb701f3e,0xb301fc2,0x9302042,0x192fe042,0x1b2fdfc2,
+	11,0xfe040,0xfdfc0,0x101fc0,0x10203f,0xfe03f,0xfdfbf,0x101fbf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x11020c0,0x10fe0c0,0x10fe0bf,0x11020bf,0x8106040,0x8105fc0,0x8105fbf,0x810603f,0x180fa040,0x180f9fc0,0x180f9fbf,0x180fa03f,0x30fdf40,0x3101f40,0x3101f3f,0x30fdf3f,0x10fe0c1,0x11020c1,0x8106041,0x8105fc1,0x180fa041,0x180f9fc1,0x30fdf41,0x3101f41,0x91060c0,0x91060bf,0x70203e,0x6fe03e,0x6fdfbe,0x701fbe,0x190fa0c0,0x190fa0bf,0xb105f40,0xb105f3f,0x93060c1,0x192fa0c1,0x1b0f9f40,0x1b0f9f3f,0xb305f41,0xb301fc2,0x9302042,0x192fe042,0x1b2fdfc2,0x1b2f9f41,0x16fe0be,0x17020be,0x970603e,0x8705fbe,0x186f9fbe,0x196fa03e,0x1b6fdf3e,0xb701f3e,
+	11,0xfe040,0xfdfc0,0x101fc0,0x10203f,0xfe03f,0xfdfbf,0x101fbf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x11020c0,0x10fe0c0,0x8106040,0x8105fc0,0x11020bf,0x10fe0bf,0x180fa040,0x180f9fc0,0x810603f,0x8105fbf,0x3101f40,0x30fdf40,0x180f9fbf,0x180fa03f,0x10fe0c1,0x11020c1,0x8106041,0x8105fc1,0x3101f3f,0x30fdf3f,0x180f9fc1,0x180fa041,0x30fdf41,0x3101f41,0x91060c0,0x91060bf,0x190fa0c0,0x190fa0bf,0x6fe03e,0x70203e,0x701fbe,0x6fdfbe,0xb105f40,0x93060c1,0x192fa0c1,0x1b0f9f40,0x1b0f9f3f,0xb105f3f,0xb305f41,0xb301fc2,0x9302042,0x192fe042,0x1b2fdfc2,0x1b2f9f41,0x16fe0be,0x17020be,0x970603e,0x8705fbe,0x186f9fbe,0x196fa03e,0x1b6fdf3e,0xb701f3e,
+	11,0xfe040,0xfdfc0,0x101fc0,0x10203f,0xfe03f,0xfdfbf,0x101fbf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x11020c0,0x10fe0c0,0x8106040,0x8105fc0,0x11020bf,0x10fe0bf,0x180fa040,0x180f9fc0,0x10fe0c1,0x11020c1,0x810603f,0x8105fbf,0x3101f40,0x30fdf40,0x8105fc1,0x8106041,0x180fa03f,0x180f9fbf,0x180f9fc1,0x180fa041,0x30fdf3f,0x3101f3f,0x3101f41,0x30fdf41,0x91060c0,0x91060bf,0x190fa0c0,0x190fa0bf,0x91060c1,0xb105f40,0x3701fbe,0x70203e,0x6fe03e,0x36fdfbe,0x190fa0c1,0x182fe042,0x8302042,0xb301fc2,0x1b2fdfc2,0x1b0f9f40,0x1b0f9f3f,0xb105f3f,0xb305f41,0x1b2f9f41,0x16fe0be,0x17020be,0x970603e,0xb705fbe,0x1b6f9fbe,0x196fa03e,0x192fe0c2,0x93020c2,
+	11,0x10203f,0xfe040,0xfe03f,0xfdfbf,0x101fbf,0x101fc0,0xfdfc0,0xfe0c0,0x1020c0,0x1020bf,0xfe0bf,0x810603f,0x8106040,0x302041,0x2fe041,0x2fdfc1,0x301fc1,0x8105fc0,0x8105fbf,0x70203e,0x6fe03e,0x180fa03f,0x180fa040,0x180f9fc0,0x180f9fbf,0x6fdfbe,0x701fbe,0x3101f3f,0x3101f40,0x30fdf40,0x30fdf3f,0x2fe0c1,0x3020c1,0x81060c0,0x81060bf,0x7020be,0x6fe0be,0x180fa0bf,0x180fa0c0,0x8306041,0x8305fc1,0x870603e,0x8705fbe,0x182fa041,0x182f9fc1,0x186fa03e,0x186f9fbe,0x32fdf41,0x3301f41,0xb305f40,0xb105f3f,0xb701f3e,0x36fdf3e,0x1b6f9f3f,0x1b2f9f40,0x93060c1,0x192fa0c1,0x97060be,0x196fa0be,0x196fe13f,0x192fe140,0x9302140,0x970213f,
+	9,0xfe040,0xfe03f,0x10203f,0x101fc0,0xfdfc0,0xfdfbf,0x101fbf,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x302041,0x2fe041,0x2fdfc1,0x301fc1,0x8106040,0x810603f,0x8105fbf,0x8105fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x180f9fc0,0x6fe03e,0x70203e,0x701fbe,0x6fdfbe,0x30fdf3f,0x30fdf40,0x3101f40,0x3101f3f,0x3020c1,0x2fe0c1,0x81060c0,0x91060bf,0x8306041,0x8305fc1,0x180fa0c0,0x190fa0bf,0x16fe0be,0x17020be,0x182fa041,0x182f9fc1,0x32fdf41,0x3301f41,0x8705fbe,0x870603e,0xb105f3f,0xb105f40,0x186fa03e,0x186f9fbe,0x1b0f9f3f,0x1b0f9f40,0x1b6fdf3e,0xb701f3e,0x93060c1,0x192fa0c1,0x97060be,0x196fa0be,0xb305f41,0x1b2f9f41,0x194fe140,0x9502140,
+	7,0xfe040,0xfe03f,0x10203f,0x101fc0,0xfdfc0,0xfdfbf,0x101fbf,0x302041,0x2fe041,0xfe0c0,0x11020c0,0x11020bf,0xfe0bf,0x2fdfc1,0x301fc1,0x8106040,0x810603f,0x8105fc0,0x8105fbf,0x180fa040,0x180fa03f,0x180f9fc0,0x180f9fbf,0x6fe03e,0x70203e,0x701fbe,0x6fdfbe,0x30fdf3f,0x30fdf40,0x3101f40,0x3101f3f,0x13020c1,0x2fe0c1,0x8306041,0x91060c0,0x91060bf,0x8305fc1,0x182fa041,0x180fa0c0,0x180fa0bf,0x182f9fc1,0x32fdf41,0x3301f41,0x17020be,0x6fe0be,0x870603e,0x8705fbe,0xb105f3f,0xb105f40,0x93060c1,0x186fa03e,0x186f9fbe,0x1b0f9f3f,0x1b0f9f40,0x192fa0c1,0x1b6fdf3e,0xb701f3e,0x97060be,0xb305f41,0x1b2f9f41,0x196fa0be,0x196fe13f,0x192fe140,
+	11,0xfe040,0xfdfc0,0x101fc0,0x10203f,0xfe03f,0xfdfbf,0x101fbf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x11020c0,0x10fe0c0,0x10fe0bf,0x11020bf,0x8106040,0x8105fc0,0x810603f,0x8105fbf,0x180fa040,0x180f9fc0,0x180fa03f,0x180f9fbf,0x30fdf40,0x3101f40,0x3101f3f,0x30fdf3f,0x10fe0c1,0x11020c1,0x8106041,0x8105fc1,0x70203e,0x6fe03e,0x6fdfbe,0x701fbe,0x91060c0,0x91060bf,0x180fa041,0x180f9fc1,0x190fa0c0,0x190fa0bf,0x30fdf41,0x3101f41,0xb105f40,0xb105f3f,0x17020be,0x16fe0be,0x93060c1,0x192fa0c1,0x1b0f9f40,0x1b0f9f3f,0x8705fbe,0x970603e,0x196fa03e,0x186f9fbe,0x1b6fdf3e,0xb701f3e,0xb305f41,0x1b2f9f41,0x1b2fdfc2,0x192fe042,0x9302042,0xb301fc2,
+	11,0xfe040,0xfdfc0,0x101fc0,0x10203f,0xfe03f,0xfdfbf,0x101fbf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x11020c0,0x10fe0c0,0x10fe0bf,0x11020bf,0x8106040,0x8105fc0,0x810603f,0x8105fbf,0x180fa040,0x180f9fc0,0x180fa03f,0x180f9fbf,0x10fe0c1,0x11020c1,0x3101f40,0x30fdf40,0x30fdf3f,0x3101f3f,0x8105fc1,0x8106041,0x91060c0,0x180fa041,0x180f9fc1,0x6fe03e,0x70203e,0x701fbe,0x6fdfbe,0x91060bf,0x190fa0c0,0x190fa0bf,0x30fdf41,0x3101f41,0x93060c1,0xb105f40,0xb105f3f,0x17020be,0x16fe0be,0x192fa0c1,0x1b0f9f40,0x1b0f9f3f,0x8705fbe,0x970603e,0x196fa03e,0x186f9fbe,0x1b6fdf3e,0xb305f41,0xb301fc2,0x9302042,0x192fe042,0x1b2fdfc2,0x1b2f9f41,0xb701f3e,
+	11,0xfe040,0xfdfc0,0x101fc0,0x10203f,0xfe03f,0xfdfbf,0x101fbf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x11020c0,0x10fe0c0,0x10fe0bf,0x11020bf,0x8106040,0x8105fc0,0x810603f,0x8105fbf,0x180fa040,0x180f9fc0,0x180fa03f,0x180f9fbf,0x10fe0c1,0x11020c1,0x8106041,0x8105fc1,0x3101f40,0x30fdf40,0x30fdf3f,0x3101f3f,0x180fa041,0x180f9fc1,0x30fdf41,0x3101f41,0x91060c0,0x91060bf,0x70203e,0x6fe03e,0x6fdfbe,0x701fbe,0x190fa0c0,0x190fa0bf,0x93060c1,0x192fa0c1,0xb105f40,0xb105f3f,0x1b0f9f40,0x1b0f9f3f,0x16fe0be,0x17020be,0x970603e,0x8705fbe,0xb305f41,0xb301fc2,0x9302042,0x192fe042,0x1b2fdfc2,0x1b2f9f41,0x186f9fbe,0x196fa03e,0x1b6fdf3e,0xb701f3e,
+	11,0xfe040,0xfdfc0,0x101fc0,0x10203f,0xfe03f,0xfdfbf,0x101fbf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x11020c0,0x10fe0c0,0x10fe0bf,0x11020bf,0x8106040,0x8105fc0,0x810603f,0x11020c1,0x10fe0c1,0x180fa040,0x180f9fc0,0x8105fbf,0x180fa03f,0x180f9fbf,0x30fdf40,0x3101f40,0x8105fc1,0x8106041,0x180fa041,0x180f9fc1,0x30fdf3f,0x3101f3f,0x3101f41,0x30fdf41,0x91060c0,0x91060bf,0x190fa0c0,0x190fa0bf,0x6fe03e,0x70203e,0x701fbe,0x6fdfbe,0x93060c1,0x192fa0c1,0xb105f40,0xb105f3f,0x1b0f9f40,0x1b0f9f3f,0x1b2fdfc2,0x192fe042,0x9302042,0xb301fc2,0xb305f41,0x1b2f9f41,0x16fe0be,0x17020be,0x970603e,0x8705fbe,0x196fa03e,0x186f9fbe,0x1b6fdf3e,0xb701f3e,
+	11,0xfe040,0xfdfc0,0x101fc0,0x10203f,0xfe03f,0xfdfbf,0x101fbf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x11020c0,0x10fe0c0,0x10fe0bf,0x11020bf,0x8106040,0x8105fc0,0x11020c1,0x10fe0c1,0x180fa040,0x180f9fc0,0x810603f,0x8105fbf,0x8106041,0x8105fc1,0x3101f40,0x30fdf40,0x180f9fbf,0x180fa03f,0x180fa041,0x180f9fc1,0x30fdf3f,0x3101f3f,0x3101f41,0x30fdf41,0x91060c0,0x91060bf,0x190fa0c0,0x190fa0bf,0x91060c1,0x190fa0c1,0x186fe03e,0x70203e,0x3701fbe,0x1b6fdfbe,0xb105f40,0x3301fc2,0x302042,0x182fe042,0x1b2fdfc2,0x1b0f9f40,0x1b6f9f3f,0xb105f3f,0xb105f41,0x1b2f9f41,0x196fe0be,0x17020be,0x970603e,0xb705fbe,0x13020c2,0x192fe0c2,0x9306042,0xb305fc2,
+	11,0x10203f,0xfe040,0xfe03f,0xfdfbf,0x101fbf,0x101fc0,0xfdfc0,0xfe0c0,0x1020c0,0x1020bf,0xfe0bf,0x810603f,0x8106040,0x302041,0x2fe041,0x2fdfc1,0x301fc1,0x8105fc0,0x8105fbf,0x70203e,0x6fe03e,0x180fa03f,0x180fa040,0x180f9fc0,0x180f9fbf,0x6fdfbe,0x701fbe,0x3101f3f,0x3101f40,0x30fdf40,0x30fdf3f,0x2fe0c1,0x3020c1,0x81060c0,0x81060bf,0x7020be,0x6fe0be,0x180fa0bf,0x180fa0c0,0x8306041,0x8305fc1,0x870603e,0x8705fbe,0x182fa041,0x182f9fc1,0x186fa03e,0x186f9fbe,0x32fdf41,0x3301f41,0xb305f40,0xb105f3f,0xb701f3e,0x36fdf3e,0x1b6f9f3f,0x1b2f9f40,0x93060c1,0x192fa0c1,0x97060be,0x196fa0be,0x196fe13f,0x192fe140,0x9302140,0x970213f,
+	11,0xfe040,0xfe03f,0x10203f,0x101fc0,0xfdfc0,0xfdfbf,0x101fbf,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x302041,0x2fe041,0x2fdfc1,0x301fc1,0x8106040,0x810603f,0x8105fbf,0x8105fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x180f9fc0,0x6fe03e,0x70203e,0x701fbe,0x6fdfbe,0x30fdf3f,0x30fdf40,0x3101f40,0x3101f3f,0x3020c1,0x2fe0c1,0x81060c0,0x81060bf,0x180fa0c0,0x180fa0bf,0x6fe0be,0x7020be,0x8306041,0x8305fc1,0x182fa041,0x182f9fc1,0x32fdf41,0x3301f41,0x870603e,0x8705fbe,0x186fa03e,0x186f9fbe,0xb105f3f,0xb305f40,0x93060c1,0x192fa0c1,0x1b2f9f40,0x1b0f9f3f,0x1b6fdf3e,0xb701f3e,0x97060be,0x196fa0be,0x196fe13f,0x192fe140,0x9302140,0x970213f,
+	11,0xfe040,0xfe03f,0x10203f,0x101fc0,0xfdfc0,0xfdfbf,0x101fbf,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x302041,0x2fe041,0x2fdfc1,0x301fc1,0x8106040,0x810603f,0x8105fc0,0x8105fbf,0x180fa040,0x180fa03f,0x180f9fc0,0x180f9fbf,0x6fe03e,0x70203e,0x701fbe,0x6fdfbe,0x2fe0c1,0x3020c1,0x81060c0,0x81060bf,0x3101f40,0x30fdf40,0x30fdf3f,0x3101f3f,0x8306041,0x8305fc1,0x180fa0c0,0x180fa0bf,0x182fa041,0x182f9fc1,0x6fe0be,0x7020be,0x870603e,0x8705fbe,0x3301f41,0x32fdf41,0x93060c1,0x192fa0c1,0x186fa03e,0x186f9fbe,0xb105f3f,0xb305f40,0x1b2f9f40,0x1b0f9f3f,0x1b6fdf3e,0xb701f3e,0x97060be,0x196fa0be,0x196fe13f,0x192fe140,0x9302140,0x970213f,
+	9,0xfe040,0xfe03f,0x10203f,0x101fc0,0xfdfc0,0xfdfbf,0x101fbf,0x102041,0xfe041,0x10fe0c0,0x11020c0,0x11020bf,0x10fe0bf,0xfdfc1,0x101fc1,0x8106040,0x810603f,0x8105fc0,0x8105fbf,0x180fa040,0x180fa03f,0x180f9fc0,0x180f9fbf,0x10fe0c1,0x11020c1,0x8106041,0x3101f40,0x30fdf40,0x30fdf3f,0x3101f3f,0x70203e,0x6fe03e,0x6fdfbe,0x701fbe,0x91060c0,0x91060bf,0x8105fc1,0x180fa041,0x190fa0c0,0x190fa0bf,0x180f9fc1,0x30fdf41,0x3101f41,0x17020be,0x16fe0be,0x93060c1,0x192fa0c1,0x870603e,0x8705fbe,0xb105f3f,0xb105f40,0x1b2f9f40,0x1b0f9f3f,0x186f9fbe,0x196fa03e,0x1b6fdf3e,0xb701f3e,0x97060be,0xb305f41,0xb301fc2,0x9302042,0x192fe042,0x1b2fdfc2,
+	11,0xfe040,0xfdfc0,0x101fc0,0x10203f,0xfe03f,0xfdfbf,0x101fbf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x11020c0,0x10fe0c0,0x10fe0bf,0x11020bf,0x8106040,0x8105fc0,0x810603f,0x8105fbf,0x180fa040,0x180f9fc0,0x180fa03f,0x10fe0c1,0x11020c1,0x180f9fbf,0x30fdf40,0x3101f40,0x8106041,0x8105fc1,0x91060c0,0x91060bf,0x3101f3f,0x30fdf3f,0x180fa041,0x180f9fc1,0x190fa0c0,0x6fe03e,0x70203e,0x701fbe,0x6fdfbe,0x190fa0bf,0x30fdf41,0x3101f41,0x93060c1,0x192fa0c1,0x16fe0be,0x17020be,0xb105f40,0xb105f3f,0x8705fbe,0x970603e,0x1b0f9f40,0x1b0f9f3f,0x186f9fbe,0x196fa03e,0x192fe042,0x9302042,0xb301fc2,0xb305f41,0x1b2fdfc2,0x1b2f9f41,0x1b6fdf3e,0xb701f3e,
+	13,0xfe040,0xfdfc0,0x101fc0,0x10203f,0xfe03f,0xfdfbf,0x101fbf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x8106040,0x8105fc0,0x810603f,0x1020c1,0xfe0c1,0x180fa040,0x180f9fc0,0x8105fbf,0x180fa03f,0x180f9fbf,0x8106041,0x8105fc1,0x3101f40,0x30fdf40,0x180fa041,0x180f9fc1,0x30fdf3f,0x3101f3f,0x81060c0,0x91060bf,0x180fa0c0,0x190fa0bf,0x6fe03e,0x70203e,0x3701fbe,0x36fdfbe,0x30fdf41,0x3101f41,0x93060c1,0x192fa0c1,0x16fe0be,0x17020be,0xb105f40,0xb105f3f,0x1b0f9f40,0x1b0f9f3f,0x192fe042,0x9302042,0xb301fc2,0x1b2fdfc2,0xb305f41,0x970603e,0xb705fbe,0x196fa03e,0x1b6f9fbe,0x1b2f9f41,0x194fe140,0x9502140,
+	13,0xfe040,0xfdfc0,0x101fc0,0x10203f,0xfe03f,0xfdfbf,0x101fbf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x8106040,0x8105fc0,0x1020c1,0xfe0c1,0x180fa040,0x180f9fc0,0x810603f,0x8105fbf,0x180fa03f,0x180f9fbf,0x8106041,0x8105fc1,0x180fa041,0x180f9fc1,0x30fdf40,0x3101f40,0x3101f3f,0x30fdf3f,0x81060c0,0x91060bf,0x180fa0c0,0x190fa0bf,0x30fdf41,0x3101f41,0x93060c1,0x70203e,0x6fe03e,0x36fdfbe,0x3701fbe,0x192fa0c1,0x192fe042,0x9302042,0xb105f40,0xb105f3f,0x1b0f9f40,0x1b2fdfc2,0xb301fc2,0x17020be,0x16fe0be,0x1b0f9f3f,0xb305f41,0x1b2f9f41,0x970603e,0xb705fbe,0x196fa03e,0x1b6f9fbe,0x194fe140,0x9502140,
+	13,0xfe040,0xfdfc0,0x101fc0,0x10203f,0xfe03f,0xfdfbf,0x101fbf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x1020c1,0xfe0c1,0x8106040,0x8105fc0,0x180fa040,0x180f9fc0,0x810603f,0x8105fbf,0x8106041,0x8105fc1,0x180fa03f,0x180f9fbf,0x180fa041,0x180f9fc1,0x30fdf40,0x3101f40,0x81060c0,0x91060bf,0x180fa0c0,0x30fdf3f,0x3101f3f,0x3101f41,0x30fdf41,0x91060c1,0x190fa0bf,0x190fa0c1,0x186fe03e,0x70203e,0x3701fbe,0x1b6fdfbe,0x182fe042,0x8302042,0xb301fc2,0x1b2fdfc2,0xb105f40,0xb105f3f,0x1b0f9f40,0x1b6f9f3f,0xb305f41,0x1b2f9f41,0x196fe0be,0x17020be,0x970603e,0xb705fbe,0x93020c2,0x192fe0c2,0x194fe140,0x9502140,
+	11,0x10203f,0xfe040,0xfe03f,0xfdfbf,0x101fbf,0x101fc0,0xfdfc0,0xfe0c0,0x1020c0,0x1020bf,0xfe0bf,0x810603f,0x8106040,0x302041,0x2fe041,0x2fdfc1,0x301fc1,0x8105fc0,0x8105fbf,0x70203e,0x6fe03e,0x180fa03f,0x180fa040,0x180f9fc0,0x180f9fbf,0x6fdfbe,0x701fbe,0x81060bf,0x81060c0,0x3020c1,0x2fe0c1,0x180fa0c0,0x180fa0bf,0x6fe0be,0x7020be,0x3101f3f,0x3101f40,0x30fdf40,0x30fdf3f,0x8306041,0x8305fc1,0x870603e,0x8705fbe,0x182fa041,0x182f9fc1,0x186fa03e,0x186f9fbe,0x93060c1,0x97060be,0xb105f3f,0xb105f40,0xb301f41,0x32fdf41,0x192fa0c1,0x196fa0be,0x1b0f9f3f,0x1b2f9f40,0x1b6fdf3e,0xb701f3e,0x970213f,0x9302140,0x192fe140,0x196fe13f,
+	11,0xfe040,0xfe03f,0x10203f,0x101fc0,0xfdfc0,0xfdfbf,0x101fbf,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x302041,0x2fe041,0x2fdfc1,0x301fc1,0x8106040,0x810603f,0x8105fbf,0x8105fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x180f9fc0,0x6fe03e,0x70203e,0x701fbe,0x6fdfbe,0x2fe0c1,0x3020c1,0x81060c0,0x81060bf,0x180fa0c0,0x180fa0bf,0x6fe0be,0x7020be,0x3101f3f,0x3101f40,0x30fdf40,0x30fdf3f,0x8306041,0x8305fc1,0x182fa041,0x182f9fc1,0x870603e,0x8705fbe,0x186fa03e,0x186f9fbe,0x93060c1,0x192fa0c1,0x32fdf41,0x3301f41,0xb305f40,0xb105f3f,0x97060be,0x196fa0be,0x1b0f9f3f,0x1b2f9f40,0x1b6fdf3e,0xb701f3e,0x970213f,0x9302140,0x192fe140,0x196fe13f,
+	11,0xfe040,0xfe03f,0x10203f,0x101fc0,0xfdfc0,0xfdfbf,0x101fbf,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x302041,0x2fe041,0x2fdfc1,0x301fc1,0x8106040,0x810603f,0x8105fc0,0x8105fbf,0x180fa040,0x180fa03f,0x180f9fc0,0x180f9fbf,0x2fe0c1,0x3020c1,0x70203e,0x6fe03e,0x6fdfbe,0x701fbe,0x81060bf,0x81060c0,0x8306041,0x180fa0c0,0x180fa0bf,0x30fdf40,0x3101f40,0x3101f3f,0x30fdf3f,0x8305fc1,0x182fa041,0x182f9fc1,0x6fe0be,0x7020be,0x93060c1,0x870603e,0x8705fbe,0x3301f41,0x32fdf41,0x192fa0c1,0x186fa03e,0x186f9fbe,0xb105f3f,0xb305f40,0x1b2f9f40,0x1b0f9f3f,0x1b6fdf3e,0x97060be,0x970213f,0x9302140,0x192fe140,0x196fe13f,0x196fa0be,0xb701f3e,
+	11,0xfe040,0xfe03f,0x10203f,0x101fc0,0xfdfc0,0xfdfbf,0x101fbf,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x302041,0x2fe041,0x2fdfc1,0x301fc1,0x8106040,0x810603f,0x8105fc0,0x8105fbf,0x180fa040,0x180fa03f,0x180f9fc0,0x2fe0c1,0x3020c1,0x180f9fbf,0x6fe03e,0x70203e,0x81060c0,0x81060bf,0x8306041,0x8305fc1,0x701fbe,0x6fdfbe,0x180fa0c0,0x180fa0bf,0x182fa041,0x30fdf40,0x3101f40,0x3101f3f,0x30fdf3f,0x182f9fc1,0x6fe0be,0x7020be,0x93060c1,0x192fa0c1,0x32fdf41,0x3301f41,0x870603e,0x8705fbe,0xb105f3f,0xb305f40,0x186fa03e,0x186f9fbe,0x1b0f9f3f,0x1b2f9f40,0x192fe140,0x9302140,0x970213f,0x97060be,0x196fe13f,0x196fa0be,0x1b6fdf3e,0xb701f3e,
+	15,0xfe040,0xfe03f,0x10203f,0x101fc0,0xfdfc0,0xfdfbf,0x101fbf,0x102041,0xfe041,0xfe0c0,0x1020c0,0x1020bf,0xfe0bf,0xfdfc1,0x101fc1,0x8106040,0x810603f,0x8105fc0,0x1020c1,0xfe0c1,0x180fa040,0x180fa03f,0x180f9fc0,0x8105fbf,0x180f9fbf,0x8106041,0x81060c0,0x81060bf,0x8105fc1,0x3101f40,0x30fdf40,0x180fa041,0x180fa0c0,0x180fa0bf,0x6fe03e,0x70203e,0x701fbe,0x6fdfbe,0x36fdf3f,0x3701f3f,0x180f9fc1,0x93060c1,0x192fa0c1,0x6fe0be,0x7020be,0x3101f41,0x30fdf41,0xb305f40,0xb105f3f,0x970603e,0xb705fbe,0x196fa03e,0x186f9fbe,0x1b2f9f40,0x1b6f9f3f,0x192fe042,0x9302042,0xb301fc2,0x1b2fdfc2,0x192fe140,0x9302140,0x970213f,0x196fe13f,
+	15,0xfe040,0xfdfc0,0x101fc0,0x10203f,0xfe03f,0xfdfbf,0x101fbf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x8106040,0x1020c1,0xfe0c1,0x180fa040,0x8105fc0,0x810603f,0x8105fbf,0x180f9fc0,0x180fa03f,0x180f9fbf,0x8106041,0x8105fc1,0x81060c0,0x81060bf,0x180fa041,0x180f9fc1,0x180fa0c0,0x180fa0bf,0x30fdf40,0x3101f40,0x3101f3f,0x30fdf3f,0x6fe03e,0x70203e,0x3701fbe,0x36fdfbe,0x93060c1,0x192fa0c1,0x30fdf41,0x3101f41,0x7020be,0x6fe0be,0xb305f40,0xb105f3f,0x970603e,0xb705fbe,0x1b2f9f40,0x1b0f9f3f,0x192fe042,0x9302042,0xb301fc2,0x1b2fdfc2,0x196fa03e,0x1b6f9fbe,0x192fe140,0x9302140,0x970213f,0x196fe13f,
+	15,0xfe040,0xfdfc0,0x101fc0,0x10203f,0xfe03f,0xfdfbf,0x101fbf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x1020c1,0xfe0c1,0x8106040,0x8105fc0,0x810603f,0x180fa040,0x180f9fc0,0x180fa03f,0x8105fbf,0x8106041,0x8105fc1,0x180f9fbf,0x180fa041,0x180f9fc1,0x81060c0,0x81060bf,0x180fa0c0,0x180fa0bf,0x30fdf40,0x3101f40,0x3101f3f,0x30fdf3f,0x93060c1,0x192fa0c1,0x6fe03e,0x70203e,0x3701fbe,0x36fdfbe,0x30fdf41,0x3101f41,0xb105f40,0x9302042,0x192fe042,0x1b2fdfc2,0xb301fc2,0x7020be,0x6fe0be,0x1b2f9f40,0x1b6f9f3f,0xb105f3f,0x970603e,0xb705fbe,0xb305f41,0x9302140,0x192fe140,0x196fe13f,0x970213f,0x1a6fa03e,
+	15,0xfe040,0xfdfc0,0x101fc0,0x10203f,0xfe03f,0xfdfbf,0x101fbf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x1020c1,0xfe0c1,0x8106040,0x8105fc0,0x180fa040,0x180f9fc0,0x810603f,0x8105fbf,0x8106041,0x8105fc1,0x180fa03f,0x180f9fbf,0x180fa041,0x180f9fc1,0x81060c0,0x81060bf,0x180fa0c0,0x30fdf40,0x3101f40,0x3101f3f,0x30fdf3f,0x91060c1,0x180fa0bf,0x190fa0c1,0x30fdf41,0x3101f41,0x70203e,0x186fe03e,0x1b6fdfbe,0x3701fbe,0x8302042,0x182fe042,0x1b2fdfc2,0xb301fc2,0xb105f40,0xb705f3f,0x7020be,0x186fe0be,0x1b2f9f40,0x1b6f9f3f,0xb305f41,0x93020c2,0x192fe0c2,0x192fe140,0x9302140,0x970213f,0x196fe13f,0xa70603e,
+	11,0x10203f,0xfe040,0xfe03f,0xfdfbf,0x101fbf,0x101fc0,0xfdfc0,0xfe0c0,0x1020c0,0x1020bf,0xfe0bf,0x810603f,0x8106040,0x302041,0x2fe041,0x2fdfc1,0x301fc1,0x8105fc0,0x8105fbf,0x70203e,0x6fe03e,0x180fa03f,0x180fa040,0x180f9fc0,0x180f9fbf,0x6fdfbe,0x701fbe,0x81060bf,0x81060c0,0x3020c1,0x2fe0c1,0x180fa0c0,0x180fa0bf,0x6fe0be,0x7020be,0x3101f3f,0x3101f40,0x30fdf40,0x30fdf3f,0x8306041,0x8305fc1,0x870603e,0x8705fbe,0x182fa041,0x182f9fc1,0x186fa03e,0x186f9fbe,0x93060c1,0x97060be,0x192fa0c1,0x196fa0be,0x196fe13f,0x192fe140,0x9302140,0x970213f,0xb105f3f,0xb105f40,0xb301f41,0x32fdf41,0x1b2f9f40,0x1b0f9f3f,0x1b6fdf3e,0xb701f3e,
+	11,0xfe040,0xfe03f,0x10203f,0x101fc0,0xfdfc0,0xfdfbf,0x101fbf,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x302041,0x2fe041,0x2fdfc1,0x301fc1,0x8106040,0x810603f,0x8105fbf,0x8105fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x180f9fc0,0x6fe03e,0x70203e,0x701fbe,0x6fdfbe,0x2fe0c1,0x3020c1,0x81060c0,0x81060bf,0x180fa0c0,0x180fa0bf,0x6fe0be,0x7020be,0x8306041,0x8305fc1,0x3101f40,0x30fdf40,0x30fdf3f,0x3101f3f,0x182fa041,0x182f9fc1,0x870603e,0x8705fbe,0x93060c1,0x192fa0c1,0x186fa03e,0x186f9fbe,0x97060be,0x970213f,0x9302140,0x192fe140,0x196fe13f,0x196fa0be,0x32fdf41,0x3301f41,0xb305f40,0xb105f3f,0x1b0f9f3f,0x1b2f9f40,0x1b6fdf3e,0xb701f3e,
+	11,0xfe040,0xfe03f,0x10203f,0x101fc0,0xfdfc0,0xfdfbf,0x101fbf,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x302041,0x2fe041,0x2fdfc1,0x301fc1,0x8106040,0x810603f,0x8105fc0,0x8105fbf,0x180fa040,0x180fa03f,0x180f9fc0,0x180f9fbf,0x2fe0c1,0x3020c1,0x81060c0,0x81060bf,0x70203e,0x6fe03e,0x6fdfbe,0x701fbe,0x180fa0c0,0x180fa0bf,0x6fe0be,0x7020be,0x8306041,0x8305fc1,0x3101f40,0x30fdf40,0x30fdf3f,0x3101f3f,0x182fa041,0x182f9fc1,0x93060c1,0x192fa0c1,0x870603e,0x8705fbe,0x186fa03e,0x186f9fbe,0x32fdf41,0x3301f41,0xb305f40,0xb105f3f,0x97060be,0x970213f,0x9302140,0x192fe140,0x196fe13f,0x196fa0be,0x1b0f9f3f,0x1b2f9f40,0x1b6fdf3e,0xb701f3e,
+	13,0xfe040,0xfe03f,0x10203f,0x101fc0,0xfdfc0,0xfdfbf,0x101fbf,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x8106040,0x810603f,0x8105fc0,0x1020c1,0xfe0c1,0x180fa040,0x180fa03f,0x8105fbf,0x180f9fc0,0x180f9fbf,0x81060c0,0x81060bf,0x70203e,0x6fe03e,0x180fa0c0,0x180fa0bf,0x6fdfbe,0x701fbe,0x8106041,0x8305fc1,0x180fa041,0x182f9fc1,0x30fdf40,0x3101f40,0x3701f3f,0x36fdf3f,0x6fe0be,0x7020be,0x93060c1,0x192fa0c1,0x32fdf41,0x3301f41,0x870603e,0x8705fbe,0x186fa03e,0x186f9fbe,0x192fe140,0x9302140,0x970213f,0x196fe13f,0x97060be,0xb305f40,0xb705f3f,0x1b2f9f40,0x1b6f9f3f,0x196fa0be,0x1a2fe042,0xa302042,
+	15,0xfe040,0xfe03f,0x10203f,0x101fc0,0xfdfc0,0xfdfbf,0x101fbf,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x8106040,0x1020c1,0xfe0c1,0x180fa040,0x810603f,0x8105fc0,0x8105fbf,0x180fa03f,0x180f9fc0,0x180f9fbf,0x81060c0,0x81060bf,0x8106041,0x8105fc1,0x180fa0c0,0x180fa0bf,0x180fa041,0x180f9fc1,0x6fe03e,0x70203e,0x701fbe,0x6fdfbe,0x30fdf40,0x3101f40,0x3701f3f,0x36fdf3f,0x93060c1,0x192fa0c1,0x6fe0be,0x7020be,0x3101f41,0x30fdf41,0x970603e,0x8705fbe,0xb305f40,0xb705f3f,0x196fa03e,0x186f9fbe,0x192fe140,0x9302140,0x970213f,0x196fe13f,0x1b2f9f40,0x1b6f9f3f,0x192fe042,0x9302042,0xb301fc2,0x1b2fdfc2,
+	15,0xfe040,0xfe03f,0x10203f,0x101fc0,0xfdfc0,0xfdfbf,0x101fbf,0x102041,0xfe041,0xfe0c0,0x1020c0,0x1020bf,0xfe0bf,0xfdfc1,0x101fc1,0x1020c1,0xfe0c1,0x8106040,0x810603f,0x8105fc0,0x180fa040,0x180fa03f,0x180f9fc0,0x8105fbf,0x180f9fbf,0x8106041,0x81060c0,0x81060bf,0x8105fc1,0x180fa041,0x180fa0c0,0x180fa0bf,0x180f9fc1,0x30fdf40,0x3101f40,0x70203e,0x6fe03e,0x6fdfbe,0x701fbe,0x3701f3f,0x36fdf3f,0x93060c1,0x192fa0c1,0x6fe0be,0x7020be,0x3101f41,0x30fdf41,0x192fe042,0x9302042,0xb301fc2,0xb305f40,0xb105f3f,0x970603e,0xb705fbe,0x9302140,0x192fe140,0x196fe13f,0x970213f,0x196fa03e,0x186f9fbe,0x1b2f9f40,0x1b2fdfc2,0x1b6f9f3f,
+	15,0xfe040,0xfdfc0,0x101fc0,0x10203f,0xfe03f,0xfdfbf,0x101fbf,0x102041,0xfe041,0xfe0c0,0x1020c0,0x101fc1,0xfdfc1,0xfe0bf,0x1020bf,0x1020c1,0xfe0c1,0x8106040,0x8105fc0,0x810603f,0x180fa040,0x180f9fc0,0x180fa03f,0x8105fbf,0x8106041,0x81060c0,0x8105fc1,0x180f9fbf,0x180fa041,0x180fa0c0,0x180f9fc1,0x81060bf,0x180fa0bf,0x93060c1,0x3101f40,0x30fdf40,0x30fdf3f,0x3101f3f,0x192fa0c1,0x6fe03e,0x70203e,0x3701fbe,0x36fdfbe,0x30fdf41,0x3101f41,0x7020be,0x6fe0be,0x192fe042,0x9302042,0xb301fc2,0x1b2fdfc2,0xb305f40,0xb105f3f,0x9302140,0x192fe140,0x196fe13f,0x970213f,0x970603e,0xb705fbe,0x1b2f9f40,0x1b0f9f3f,0x196fa03e,0x1b6f9fbe,
+	17,0xfe040,0xfdfc0,0x101fc0,0x10203f,0xfe03f,0xfe041,0x102041,0x101fbf,0xfdfbf,0xfdfc1,0x101fc1,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x1020c1,0xfe0c1,0x8106040,0x8105fc0,0x180fa040,0x180f9fc0,0x810603f,0x8106041,0x8105fbf,0x180fa03f,0x180fa041,0x8105fc1,0x81060c0,0x180f9fbf,0x180f9fc1,0x180fa0c0,0x81060bf,0x81060c1,0x180fa0bf,0x180fa0c1,0x30fdf40,0x3101f40,0x3101f3f,0x30fdf3f,0x30fdf41,0x3101f41,0x870203e,0x186fe03e,0x1b6fdfbe,0xb701fbe,0x8302042,0x182fe042,0x1b2fdfc2,0xb301fc2,0x87020be,0x186fe0be,0x190fe140,0x9102140,0x83020c2,0x182fe0c2,0xb305f40,0xb705f3f,0x1b2f9f40,0x1b6f9f3f,0x196fe13f,0x970213f,0x9302141,0x192fe141,
+	11,0x10203f,0xfe040,0xfe03f,0xfdfbf,0x101fbf,0x101fc0,0xfdfc0,0xfe0c0,0x1020c0,0x1020bf,0xfe0bf,0x810603f,0x8106040,0x302041,0x2fe041,0x180fa040,0x180fa03f,0x6fe03e,0x70203e,0x8105fbf,0x8105fc0,0x301fc1,0x2fdfc1,0x180f9fc0,0x180f9fbf,0x6fdfbe,0x701fbe,0x81060bf,0x81060c0,0x3020c1,0x2fe0c1,0x180fa0c0,0x180fa0bf,0x6fe0be,0x7020be,0x8306041,0x8305fc1,0x3101f40,0x3101f3f,0x30fdf3f,0x30fdf40,0x182fa041,0x182f9fc1,0x870603e,0x8705fbe,0x186fa03e,0x186f9fbe,0x93060c1,0x97060be,0x192fa0c1,0x192fe140,0x9302140,0x970213f,0x196fe13f,0x196fa0be,0xb105f3f,0xb105f40,0xb301f41,0x32fdf41,0x1b2f9f40,0x1b0f9f3f,0x1b6fdf3e,0xb701f3e,
+	11,0xfe040,0xfe03f,0x10203f,0x101fc0,0xfdfc0,0xfdfbf,0x101fbf,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x302041,0x2fe041,0x8106040,0x810603f,0x301fc1,0x2fdfc1,0x180fa040,0x180fa03f,0x8105fc0,0x8105fbf,0x70203e,0x6fe03e,0x180f9fbf,0x180f9fc0,0x2fe0c1,0x3020c1,0x81060c0,0x81060bf,0x701fbe,0x6fdfbe,0x180fa0bf,0x180fa0c0,0x6fe0be,0x7020be,0x8306041,0x8305fc1,0x182fa041,0x182f9fc1,0x30fdf40,0x3101f40,0x3101f3f,0x30fdf3f,0x870603e,0x93060c1,0x192fa0c1,0x186fa03e,0x186f9fbe,0x8705fbe,0x97060be,0x970213f,0x9302140,0x192fe140,0x196fe13f,0x196fa0be,0x32fdf41,0x3301f41,0xb305f40,0xb105f3f,0x1b0f9f3f,0x1b2f9f40,0x1b6fdf3e,0xb701f3e,
+	11,0xfe040,0xfe03f,0x10203f,0x101fc0,0xfdfc0,0xfdfbf,0x101fbf,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x302041,0x2fe041,0x2fdfc1,0x301fc1,0x8106040,0x810603f,0x8105fc0,0x3020c1,0x2fe0c1,0x180fa040,0x180fa03f,0x8105fbf,0x180f9fc0,0x180f9fbf,0x6fe03e,0x70203e,0x81060bf,0x81060c0,0x180fa0c0,0x180fa0bf,0x6fdfbe,0x701fbe,0x7020be,0x6fe0be,0x8306041,0x8305fc1,0x182fa041,0x182f9fc1,0x30fdf40,0x3101f40,0x3101f3f,0x30fdf3f,0x93060c1,0x192fa0c1,0x870603e,0x8705fbe,0x186fa03e,0x186f9fbe,0x196fe13f,0x192fe140,0x9302140,0x970213f,0x97060be,0x196fa0be,0x32fdf41,0x3301f41,0xb305f40,0xb105f3f,0x1b2f9f40,0x1b0f9f3f,0x1b6fdf3e,0xb701f3e,
+	13,0xfe040,0xfe03f,0x10203f,0x101fc0,0xfdfc0,0xfdfbf,0x101fbf,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x8106040,0x810603f,0x1020c1,0xfe0c1,0x180fa040,0x180fa03f,0x8105fc0,0x8105fbf,0x180f9fc0,0x180f9fbf,0x81060c0,0x81060bf,0x180fa0c0,0x180fa0bf,0x6fe03e,0x70203e,0x701fbe,0x6fdfbe,0x8106041,0x8305fc1,0x180fa041,0x182f9fc1,0x6fe0be,0x7020be,0x93060c1,0x3101f40,0x30fdf40,0x36fdf3f,0x3701f3f,0x192fa0c1,0x192fe140,0x9302140,0x870603e,0x8705fbe,0x186fa03e,0x196fe13f,0x970213f,0x3301f41,0x32fdf41,0x186f9fbe,0x97060be,0x196fa0be,0xb305f40,0xb705f3f,0x1b2f9f40,0x1b6f9f3f,0x1a2fe042,0xa302042,
+	15,0xfe040,0xfe03f,0x10203f,0x101fc0,0xfdfc0,0xfdfbf,0x101fbf,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x1020c1,0xfe0c1,0x8106040,0x810603f,0x8105fc0,0x180fa040,0x180fa03f,0x180f9fc0,0x8105fbf,0x81060c0,0x81060bf,0x180f9fbf,0x180fa0c0,0x180fa0bf,0x8106041,0x8105fc1,0x180fa041,0x180f9fc1,0x6fe03e,0x70203e,0x701fbe,0x6fdfbe,0x93060c1,0x192fa0c1,0x30fdf40,0x3101f40,0x3701f3f,0x36fdf3f,0x6fe0be,0x7020be,0x870603e,0x9302140,0x192fe140,0x196fe13f,0x970213f,0x3101f41,0x30fdf41,0x196fa03e,0x1b6f9fbe,0x8705fbe,0xb305f40,0xb705f3f,0x97060be,0x9302042,0x192fe042,0x1b2fdfc2,0xb301fc2,0x1b4f9f40,
+	15,0xfe040,0xfe03f,0x10203f,0x101fc0,0xfdfc0,0xfdfbf,0x101fbf,0x1020c0,0xfe0c0,0xfe041,0x102041,0x1020bf,0xfe0bf,0xfdfc1,0x101fc1,0x1020c1,0xfe0c1,0x8106040,0x810603f,0x8105fc0,0x180fa040,0x180fa03f,0x180f9fc0,0x8105fbf,0x81060c0,0x8106041,0x81060bf,0x180f9fbf,0x180fa0c0,0x180fa041,0x180fa0bf,0x8105fc1,0x180f9fc1,0x93060c1,0x70203e,0x6fe03e,0x6fdfbe,0x701fbe,0x192fa0c1,0x30fdf40,0x3101f40,0x3701f3f,0x36fdf3f,0x6fe0be,0x7020be,0x3101f41,0x30fdf41,0x192fe140,0x9302140,0x970213f,0x196fe13f,0x970603e,0x8705fbe,0x9302042,0x192fe042,0x1b2fdfc2,0xb301fc2,0xb305f40,0xb705f3f,0x196fa03e,0x186f9fbe,0x1b2f9f40,0x1b6f9f3f,
+	17,0xfe040,0xfe03f,0x10203f,0x101fc0,0xfdfc0,0xfdfbf,0x101fbf,0x102041,0xfe041,0xfe0c0,0x1020c0,0x1020bf,0xfe0bf,0xfdfc1,0x101fc1,0x1020c1,0xfe0c1,0x8106040,0x810603f,0x8105fc0,0x180fa040,0x180fa03f,0x180f9fc0,0x8105fbf,0x8106041,0x81060c0,0x81060bf,0x180f9fbf,0x180fa041,0x180fa0c0,0x180fa0bf,0x8105fc1,0x180f9fc1,0x81060c1,0x180fa0c1,0x186fe03e,0x70203e,0x3101f40,0x1b0fdf40,0x1b0fdf3f,0x3101f3f,0x3701fbe,0x1b6fdfbe,0x186fe0be,0x7020be,0x3101f41,0x1b0fdf41,0x182fe042,0x8302042,0x9102140,0x190fe140,0x196fe13f,0x970213f,0xb301fc2,0x1b2fdfc2,0x182fe0c2,0x83020c2,0x9302141,0x192fe141,0x970603e,0xb305f40,0xb105f3f,0xb705fbe,
+	17,0xfe040,0xfdfc0,0x101fc0,0x10203f,0xfe03f,0xfe041,0x102041,0x1020c0,0xfe0c0,0xfdfbf,0x101fbf,0x101fc1,0xfdfc1,0xfe0bf,0x1020bf,0x1020c1,0xfe0c1,0x8106040,0x8105fc0,0x180fa040,0x180f9fc0,0x810603f,0x8106041,0x81060c0,0x8105fbf,0x180fa03f,0x180fa041,0x180fa0c0,0x180f9fbf,0x8105fc1,0x81060bf,0x81060c1,0x180f9fc1,0x180fa0bf,0x180fa0c1,0x1b0fdf40,0x3101f40,0x3101f3f,0x1b0fdf3f,0x186fe03e,0x70203e,0x3701fbe,0x1b6fdfbe,0x1b0fdf41,0x3101f41,0x8302042,0x182fe042,0x1b2fdfc2,0xb301fc2,0x9102140,0x190fe140,0x186fe0be,0x7020be,0x970213f,0x196fe13f,0x182fe0c2,0x83020c2,0x9302141,0x192fe141,0xb305f40,0xb105f3f,0x970603e,0xb705fbe,
+	11,0x10203f,0xfe040,0xfe03f,0xfdfbf,0x101fbf,0x101fc0,0xfdfc0,0xfe0c0,0x1020c0,0x1020bf,0xfe0bf,0x810603f,0x8106040,0x302041,0x2fe041,0x180fa040,0x180fa03f,0x6fe03e,0x70203e,0x8105fbf,0x8105fc0,0x301fc1,0x2fdfc1,0x2fe0c1,0x3020c1,0x81060c0,0x81060bf,0x701fbe,0x6fdfbe,0x180f9fbf,0x180f9fc0,0x180fa0c0,0x180fa0bf,0x6fe0be,0x7020be,0x8306041,0x8305fc1,0x870603e,0x182fa041,0x182f9fc1,0x30fdf40,0x3101f40,0x3101f3f,0x30fdf3f,0x186fa03e,0x186f9fbe,0x8705fbe,0x93060c1,0x9302140,0x192fe140,0x192fa0c1,0x196fe13f,0x970213f,0x97060be,0x196fa0be,0xb105f3f,0xb105f40,0xb301f41,0x32fdf41,0x1b2f9f40,0x1b0f9f3f,0x1b6fdf3e,0xb701f3e,
+	11,0xfe040,0xfe03f,0x10203f,0x101fc0,0xfdfc0,0xfdfbf,0x101fbf,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x302041,0x2fe041,0x8106040,0x810603f,0x301fc1,0x2fdfc1,0x180fa040,0x180fa03f,0x2fe0c1,0x3020c1,0x8105fc0,0x8105fbf,0x70203e,0x6fe03e,0x81060bf,0x81060c0,0x180f9fc0,0x180f9fbf,0x180fa0bf,0x180fa0c0,0x6fdfbe,0x701fbe,0x7020be,0x6fe0be,0x8306041,0x8305fc1,0x182fa041,0x182f9fc1,0x83060c1,0x870603e,0x3701f3f,0x3101f40,0x30fdf40,0x36fdf3f,0x182fa0c1,0x190fe140,0x9102140,0x970213f,0x196fe13f,0x186fa03e,0x186f9fbe,0x8705fbe,0x97060be,0x196fa0be,0x32fdf41,0x3301f41,0xb305f40,0xb705f3f,0x1b6f9f3f,0x1b2f9f40,0x192fe141,0x9302141,
+	11,0xfe040,0xfe03f,0x10203f,0x101fc0,0xfdfc0,0xfdfbf,0x101fbf,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x302041,0x2fe041,0x2fdfc1,0x301fc1,0x8106040,0x810603f,0x3020c1,0x2fe0c1,0x180fa040,0x180fa03f,0x8105fc0,0x8105fbf,0x81060c0,0x81060bf,0x70203e,0x6fe03e,0x180f9fbf,0x180f9fc0,0x180fa0c0,0x180fa0bf,0x6fdfbe,0x701fbe,0x7020be,0x6fe0be,0x8306041,0x8305fc1,0x182fa041,0x182f9fc1,0x83060c1,0x182fa0c1,0x1b0fdf40,0x3101f40,0x3701f3f,0x1b6fdf3f,0x870603e,0x170213f,0x1102140,0x190fe140,0x196fe13f,0x186fa03e,0x1b6f9fbe,0x8705fbe,0x87060be,0x196fa0be,0x1b2fdf41,0x3301f41,0xb305f40,0xb705f3f,0x1302141,0x192fe141,0x9306140,0x970613f,
+	13,0xfe040,0xfe03f,0x10203f,0x101fc0,0xfdfc0,0xfdfbf,0x101fbf,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x1020c1,0xfe0c1,0x8106040,0x810603f,0x180fa040,0x180fa03f,0x8105fc0,0x8105fbf,0x81060c0,0x81060bf,0x180f9fc0,0x180f9fbf,0x180fa0c0,0x180fa0bf,0x6fe03e,0x70203e,0x8106041,0x8305fc1,0x180fa041,0x6fdfbe,0x701fbe,0x7020be,0x6fe0be,0x83060c1,0x182f9fc1,0x182fa0c1,0x1b0fdf40,0x3101f40,0x3701f3f,0x1b6fdf3f,0x190fe140,0x9102140,0x970213f,0x196fe13f,0x870603e,0x8705fbe,0x186fa03e,0x1b6f9fbe,0x97060be,0x196fa0be,0x1b2fdf41,0x3301f41,0xb305f40,0xb705f3f,0x9302141,0x192fe141,0x1a2fe042,0xa302042,
+	15,0xfe040,0xfe03f,0x10203f,0x101fc0,0xfdfc0,0xfdfbf,0x101fbf,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x1020c1,0xfe0c1,0x8106040,0x810603f,0x180fa040,0x180fa03f,0x8105fc0,0x8105fbf,0x81060c0,0x81060bf,0x180f9fc0,0x180f9fbf,0x180fa0c0,0x180fa0bf,0x8106041,0x8105fc1,0x180fa041,0x6fe03e,0x70203e,0x701fbe,0x6fdfbe,0x83060c1,0x180f9fc1,0x182fa0c1,0x6fe0be,0x7020be,0x3101f40,0x1b0fdf40,0x1b6fdf3f,0x3701f3f,0x9102140,0x190fe140,0x196fe13f,0x970213f,0x870603e,0xb705fbe,0x3101f41,0x1b0fdf41,0x196fa03e,0x1b6f9fbe,0x97060be,0x9302141,0x192fe141,0x192fe042,0x9302042,0xb301fc2,0x1b2fdfc2,0xb505f40,
+	17,0xfe040,0xfe03f,0x10203f,0x101fc0,0xfdfc0,0xfe0c0,0x1020c0,0x101fbf,0xfdfbf,0xfe0bf,0x1020bf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x1020c1,0xfe0c1,0x8106040,0x810603f,0x180fa040,0x180fa03f,0x8105fc0,0x81060c0,0x8105fbf,0x180f9fc0,0x180fa0c0,0x81060bf,0x8106041,0x180f9fbf,0x180fa0bf,0x180fa041,0x8105fc1,0x81060c1,0x180f9fc1,0x180fa0c1,0x6fe03e,0x70203e,0x701fbe,0x6fdfbe,0x6fe0be,0x7020be,0xb101f40,0x1b0fdf40,0x1b6fdf3f,0xb701f3f,0x9102140,0x190fe140,0x196fe13f,0x970213f,0xb101f41,0x1b0fdf41,0x182fe042,0x8302042,0x9102141,0x190fe141,0x970603e,0xb705fbe,0x196fa03e,0x1b6f9fbe,0x1b2fdfc2,0xb301fc2,0x93020c2,0x192fe0c2,
+	17,0xfe040,0xfe03f,0x10203f,0x101fc0,0xfdfc0,0xfe0c0,0x1020c0,0x102041,0xfe041,0xfdfbf,0x101fbf,0x1020bf,0xfe0bf,0xfdfc1,0x101fc1,0x1020c1,0xfe0c1,0x8106040,0x810603f,0x180fa040,0x180fa03f,0x8105fc0,0x81060c0,0x8106041,0x8105fbf,0x180f9fc0,0x180fa0c0,0x180fa041,0x180f9fbf,0x81060bf,0x8105fc1,0x81060c1,0x180fa0bf,0x180f9fc1,0x180fa0c1,0x186fe03e,0x70203e,0x701fbe,0x186fdfbe,0x1b0fdf40,0x3101f40,0x3701f3f,0x1b6fdf3f,0x186fe0be,0x7020be,0x9102140,0x190fe140,0x196fe13f,0x970213f,0x8302042,0x182fe042,0x1b0fdf41,0x3101f41,0xb301fc2,0x1b2fdfc2,0x190fe141,0x9102141,0x93020c2,0x192fe0c2,0x970603e,0x8705fbe,0xb305f40,0xb705f3f,
+	17,0xfe040,0xfe03f,0x10203f,0x101fc0,0xfdfc0,0xfe041,0x102041,0x1020c0,0xfe0c0,0xfdfbf,0x101fbf,0x1020bf,0xfe0bf,0xfdfc1,0x101fc1,0x1020c1,0xfe0c1,0x8106040,0x180fa040,0x810603f,0x8105fc0,0x8106041,0x81060c0,0x180fa03f,0x180f9fc0,0x180fa041,0x180fa0c0,0x8105fbf,0x81060bf,0x8105fc1,0x81060c1,0x180f9fbf,0x180fa0bf,0x180f9fc1,0x180fa0c1,0x186fe03e,0x70203e,0x3101f40,0x1b0fdf40,0x1b0fdf3f,0x3101f3f,0x3701fbe,0x1b6fdfbe,0x186fe0be,0x190fe140,0x9102140,0x8302042,0x182fe042,0x1b0fdf41,0x3101f41,0xb301fc2,0x1b2fdfc2,0x7020be,0x970213f,0x196fe13f,0x190fe141,0x9102141,0x93020c2,0x192fe0c2,0xb305f40,0x970603e,0x8705fbe,0xb705f3f,
+	7,0x10203f,0x101fc0,0x101fbf,0xfdfbf,0xfe03f,0xfe040,0xfdfc0,0x8105fc0,0x8106040,0x810603f,0x8105fbf,0x11020bf,0x11020c0,0x10fe0c0,0x10fe0bf,0x302041,0x301fc1,0x2fdfc1,0x2fe041,0x30fdf40,0x3101f40,0x3101f3f,0x30fdf3f,0x6fdfbe,0x701fbe,0x70203e,0x6fe03e,0x180fa03f,0x180fa040,0x180f9fc0,0x180f9fbf,0x8305fc1,0x8306041,0x91060c0,0x91060bf,0x870603e,0x8705fbe,0xb105f3f,0xb105f40,0x13020c1,0x12fe0c1,0x16fe0be,0x17020be,0x3301f41,0x32fdf41,0x182f9fc1,0x182fa041,0x190fa0c0,0x190fa0bf,0x36fdf3e,0x3701f3e,0x1b0f9f3f,0x1b0f9f40,0x186f9fbe,0x186fa03e,0x93060c1,0xb305f41,0x97060be,0xb705f3e,0x192fa0c1,0x196fa0be,0x1b2f9f41,0x1b6f9f3e,
+	7,0x101fc0,0x101fbf,0x10203f,0xfe040,0xfdfc0,0xfdfbf,0xfe03f,0x302041,0x301fc1,0x2fdfc1,0x2fe041,0x8106040,0x8105fc0,0x8105fbf,0x810603f,0x11020bf,0x11020c0,0x10fe0c0,0x10fe0bf,0x3101f40,0x3101f3f,0x30fdf3f,0x30fdf40,0x180f9fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x6fdfbe,0x701fbe,0x70203e,0x6fe03e,0x8306041,0x8305fc1,0x13020c1,0x12fe0c1,0x91060c0,0x91060bf,0xb105f3f,0xb105f40,0x3301f41,0x32fdf41,0x182f9fc1,0x182fa041,0x190fa0c0,0x190fa0bf,0x870603e,0x8705fbe,0x17020be,0x16fe0be,0x36fdf3e,0x3701f3e,0x1b0f9f3f,0x1b0f9f40,0x186f9fbe,0x186fa03e,0x93060c1,0xb305f41,0x192fa0c1,0x97060be,0xb705f3e,0x1b2f9f41,0x196fa0be,0x1b6f9f3e,
+	9,0x101fc0,0xfdfc0,0xfe040,0x10203f,0x101fbf,0xfdfbf,0xfe03f,0x102041,0x101fc1,0xfdfc1,0xfe041,0x8106040,0x8105fc0,0x8105fbf,0x810603f,0x11020c0,0x10fe0c0,0x10fe0bf,0x11020bf,0x3101f40,0x30fdf40,0x30fdf3f,0x3101f3f,0x180f9fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x6fdfbe,0x701fbe,0x70203e,0x6fe03e,0x8106041,0x8105fc1,0x11020c1,0x12fe0c1,0x91060c0,0x91060bf,0x3101f41,0x32fdf41,0x182f9fc1,0x182fa041,0xb105f40,0xb105f3f,0x8705fbe,0x870603e,0x190fa0bf,0x190fa0c0,0x16fe0be,0x17020be,0x1b0f9f40,0x1b0f9f3f,0x36fdf3e,0x3701f3e,0x1b6f9fbe,0x196fa03e,0x93060c1,0xb305f41,0x192fa0c1,0x1b2f9f41,0x97060be,0xb705f3e,0x13301fc2,0x11302042,
+	11,0x101fc0,0xfdfc0,0xfe040,0x10203f,0x101fbf,0xfdfbf,0xfe03f,0x102041,0x101fc1,0xfdfc1,0xfe041,0x8106040,0x8105fc0,0x8105fbf,0x810603f,0x11020c0,0x10fe0c0,0x10fe0bf,0x11020bf,0x3101f40,0x30fdf40,0x30fdf3f,0x3101f3f,0x180f9fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x6fdfbe,0x701fbe,0x70203e,0x6fe03e,0x8106041,0x8105fc1,0x11020c1,0x10fe0c1,0x3101f41,0x30fdf41,0x180f9fc1,0x180fa041,0x91060c0,0x91060bf,0xb105f40,0xb105f3f,0x8705fbe,0x870603e,0x190fa0c0,0x190fa0bf,0x1b0f9f40,0x1b0f9f3f,0x16fe0be,0x97020be,0x93060c1,0xb305f41,0xb701f3e,0x36fdf3e,0x1b6f9fbe,0x196fa03e,0x192fa0c1,0x1b2f9f41,0x1b2fdfc2,0xb301fc2,0x9302042,0x192fe042,
+	11,0x101fc0,0xfdfc0,0xfe040,0x10203f,0x101fbf,0xfdfbf,0xfe03f,0x102041,0x101fc1,0xfdfc1,0xfe041,0x8106040,0x8105fc0,0x8105fbf,0x810603f,0x11020c0,0x10fe0c0,0x10fe0bf,0x11020bf,0x3101f40,0x30fdf40,0x30fdf3f,0x3101f3f,0x180f9fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x8105fc1,0x8106041,0x11020c1,0x10fe0c1,0x3101f41,0x30fdf41,0x180f9fc1,0x180fa041,0x6fe03e,0x70203e,0x701fbe,0x6fdfbe,0x91060c0,0x91060bf,0xb105f40,0xb105f3f,0x190fa0c0,0x190fa0bf,0x1b0f9f40,0x1b0f9f3f,0x93060c1,0xb305f41,0x8705fbe,0x870603e,0x97020be,0x16fe0be,0x192fa0c1,0x1b2f9f41,0x36fdf3e,0xb701f3e,0x1b6f9fbe,0x196fa03e,0x192fe042,0x9302042,0xb301fc2,0x1b2fdfc2,
+	11,0x101fc0,0xfdfc0,0xfe040,0x10203f,0x101fbf,0xfdfbf,0xfe03f,0x102041,0x101fc1,0xfdfc1,0xfe041,0x8106040,0x8105fc0,0x8105fbf,0x810603f,0x11020c0,0x10fe0c0,0x10fe0bf,0x11020bf,0x3101f40,0x30fdf40,0x30fdf3f,0x3101f3f,0x180f9fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x8105fc1,0x8106041,0x11020c1,0x10fe0c1,0x3101f41,0x30fdf41,0x180f9fc1,0x180fa041,0x91060c0,0x91060bf,0x70203e,0x701fbe,0x6fdfbe,0x6fe03e,0xb105f40,0xb105f3f,0x190fa0c0,0x190fa0bf,0x93060c1,0xb305f41,0x1b0f9f40,0x1b0f9f3f,0x192fa0c1,0x192fe042,0x9302042,0xb301fc2,0x1b2fdfc2,0x1b2f9f41,0x8705fbe,0x870603e,0x97020be,0x16fe0be,0x36fdf3e,0xb701f3e,0x1b6f9fbe,0x196fa03e,
+	11,0x101fc0,0xfdfc0,0xfe040,0x10203f,0x101fbf,0xfdfbf,0xfe03f,0x102041,0x101fc1,0xfdfc1,0xfe041,0x8106040,0x8105fc0,0x11020c0,0x10fe0c0,0x810603f,0x8105fbf,0x3101f40,0x30fdf40,0x11020bf,0x10fe0bf,0x180fa040,0x180f9fc0,0x30fdf3f,0x3101f3f,0x8105fc1,0x8106041,0x11020c1,0x10fe0c1,0x180fa03f,0x180f9fbf,0x30fdf41,0x3101f41,0x180f9fc1,0x180fa041,0x91060c0,0x91060bf,0xb105f40,0xb105f3f,0x701fbe,0x70203e,0x6fe03e,0x6fdfbe,0x190fa0c0,0x93060c1,0xb305f41,0x1b0f9f40,0x1b0f9f3f,0x190fa0bf,0x192fa0c1,0x192fe042,0x9302042,0xb301fc2,0x1b2fdfc2,0x1b2f9f41,0x8705fbe,0x870603e,0x97020be,0x16fe0be,0x36fdf3e,0xb701f3e,0x1b6f9fbe,0x196fa03e,
+	11,0x101fc0,0xfdfc0,0xfe040,0x10203f,0x101fbf,0xfdfbf,0xfe03f,0x102041,0x101fc1,0xfdfc1,0xfe041,0x8106040,0x8105fc0,0x11020c0,0x10fe0c0,0x810603f,0x8105fbf,0x3101f40,0x30fdf40,0x8105fc1,0x8106041,0x11020bf,0x10fe0bf,0x180fa040,0x180f9fc0,0x10fe0c1,0x11020c1,0x3101f3f,0x30fdf3f,0x30fdf41,0x3101f41,0x180f9fbf,0x180fa03f,0x180fa041,0x180f9fc1,0x91060c0,0x91060bf,0xb105f40,0xb105f3f,0x91060c1,0x190fa0c0,0x186fe03e,0x70203e,0x701fbe,0x186fdfbe,0xb105f41,0x3301fc2,0x1302042,0x192fe042,0x1b2fdfc2,0x1b0f9f40,0x1b0f9f3f,0x190fa0bf,0x192fa0c1,0x1b2f9f41,0x8705fbe,0x870603e,0x97020be,0x196fe0be,0x1b6fdf3e,0xb701f3e,0xb305fc2,0x9306042,
+	7,0x10203f,0x101fbf,0x101fc0,0xfe040,0xfe03f,0xfdfbf,0xfdfc0,0x11020c0,0x11020bf,0x10fe0bf,0x10fe0c0,0x8106040,0x810603f,0x8105fbf,0x8105fc0,0x301fc1,0x302041,0x2fe041,0x2fdfc1,0x70203e,0x701fbe,0x6fdfbe,0x6fe03e,0x180fa03f,0x180fa040,0x180f9fc0,0x180f9fbf,0x30fdf3f,0x3101f3f,0x3101f40,0x30fdf40,0x91060c0,0x91060bf,0x13020c1,0x12fe0c1,0x8306041,0x8305fc1,0x8705fbe,0x870603e,0x17020be,0x16fe0be,0x190fa0bf,0x190fa0c0,0x182fa041,0x182f9fc1,0xb105f40,0xb105f3f,0x3301f41,0x32fdf41,0x36fdf3e,0x3701f3e,0x186f9fbe,0x186fa03e,0x1b0f9f3f,0x1b0f9f40,0x93060c1,0x97060be,0x192fa0c1,0xb305f41,0xb705f3e,0x196fa0be,0x1b2f9f41,0x1b6f9f3e,
+	7,0x10203f,0x101fc0,0xfe040,0xfe03f,0x101fbf,0xfdfc0,0xfdfbf,0x302041,0x301fc1,0x2fdfc1,0x2fe041,0x10fe0c0,0x11020c0,0x11020bf,0x10fe0bf,0x8106040,0x810603f,0x105fbf,0x8105fc0,0x3101f40,0x3101f3f,0x30fdf3f,0x30fdf40,0x180f9fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x6fdfbe,0x6fe03e,0x70203e,0x701fbe,0x91060bf,0x91060c0,0x13020c1,0x12fe0c1,0x8306041,0x8305fc1,0x3301f41,0x32fdf41,0x182f9fc1,0x182fa041,0x190fa0c0,0x190fa0bf,0x16fe0be,0x17020be,0x870603e,0x705fbe,0x3105f3f,0xb105f40,0x3701f3e,0x36fdf3e,0x1b0f9f3f,0x1b0f9f40,0x1b6f9fbe,0x186fa03e,0x93060c1,0x97060be,0x192fa0c1,0xb305f41,0x1b2f9f41,0x196fa0be,0xb705f3e,0xb709fbf,
+	10,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0xfdfc1,0xfe041,0x10fe0c0,0x11020c0,0x8106040,0x8105fc0,0x8105fbf,0x810603f,0x11020bf,0x10fe0bf,0x180fa040,0x180f9fc0,0x30fdf40,0x3101f40,0x3101f3f,0x30fdf3f,0x180f9fbf,0x180fa03f,0x6fe03e,0x70203e,0x701fbe,0x6fdfbe,0x11020c1,0x12fe0c1,0x8106041,0x8105fc1,0x91060c0,0x91060bf,0x3101f41,0x30fdf41,0x180f9fc1,0x182fa041,0x190fa0c0,0x190fa0bf,0x16fe0be,0x17020be,0xb105f40,0xb105f3f,0x8705fbe,0x870603e,0x93060c1,0x1b0f9f40,0x1b0f9f3f,0x36fdf3e,0xb701f3e,0x1b6f9fbe,0x196fa03e,0x192fa0c1,0xb305f41,0x97060be,0x1b2f9f41,0x1b2fdfc2,0xb301fc2,0x11302042,
+	11,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0xfdfc1,0xfe041,0x10fe0c0,0x11020c0,0x8106040,0x8105fc0,0x8105fbf,0x810603f,0x11020bf,0x10fe0bf,0x180fa040,0x180f9fc0,0x30fdf40,0x3101f40,0x3101f3f,0x30fdf3f,0x180f9fbf,0x180fa03f,0x10fe0c1,0x11020c1,0x8106041,0x8105fc1,0x70203e,0x701fbe,0x6fdfbe,0x6fe03e,0x91060c0,0x91060bf,0x3101f41,0x30fdf41,0x180f9fc1,0x180fa041,0x190fa0c0,0x190fa0bf,0xb105f40,0xb105f3f,0x8705fbe,0x870603e,0x97020be,0x16fe0be,0x93060c1,0x1b0f9f40,0x1b0f9f3f,0x36fdf3e,0xb701f3e,0xb305f41,0x192fa0c1,0x196fa03e,0x1b6f9fbe,0x1b2f9f41,0x1b2fdfc2,0xb301fc2,0x9302042,0x192fe042,
+	11,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0xfdfc1,0xfe041,0x10fe0c0,0x11020c0,0x8106040,0x8105fc0,0x8105fbf,0x810603f,0x11020bf,0x10fe0bf,0x180fa040,0x180f9fc0,0x30fdf40,0x3101f40,0x3101f3f,0x30fdf3f,0x180f9fbf,0x180fa03f,0x10fe0c1,0x11020c1,0x8106041,0x8105fc1,0x91060c0,0x70203e,0x701fbe,0x6fdfbe,0x6fe03e,0x91060bf,0x3101f41,0x30fdf41,0x180f9fc1,0x180fa041,0x190fa0c0,0x190fa0bf,0xb105f40,0xb105f3f,0x93060c1,0x870603e,0x8705fbe,0x97020be,0x16fe0be,0x1b0f9f40,0x1b0f9f3f,0x192fa0c1,0xb305f41,0xb701f3e,0x36fdf3e,0x1b6f9fbe,0x196fa03e,0x1b2f9f41,0x1b2fdfc2,0xb301fc2,0x9302042,0x192fe042,
+	11,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0xfdfc1,0xfe041,0x10fe0c0,0x11020c0,0x8106040,0x8105fc0,0x8105fbf,0x810603f,0x11020bf,0x10fe0bf,0x180fa040,0x180f9fc0,0x30fdf40,0x3101f40,0x8105fc1,0x8106041,0x11020c1,0x10fe0c1,0x180fa03f,0x180f9fbf,0x30fdf3f,0x3101f3f,0x3101f41,0x30fdf41,0x180f9fc1,0x180fa041,0x91060c0,0x91060bf,0x70203e,0x701fbe,0x6fdfbe,0x6fe03e,0x190fa0c0,0x190fa0bf,0xb105f40,0xb105f3f,0x93060c1,0xb305f41,0x1b0f9f40,0x1b0f9f3f,0x192fa0c1,0x16fe0be,0x17020be,0x970603e,0x8705fbe,0x9302042,0xb301fc2,0x1b2fdfc2,0x192fe042,0x1b2f9f41,0x186f9fbe,0x196fa03e,0x1b6fdf3e,0xb701f3e,
+	11,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0xfdfc1,0xfe041,0x10fe0c0,0x11020c0,0x8106040,0x8105fc0,0x8105fbf,0x810603f,0x11020bf,0x10fe0bf,0x10fe0c1,0x11020c1,0x8106041,0x8105fc1,0x3101f40,0x30fdf40,0x180f9fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x30fdf3f,0x3101f3f,0x3101f41,0x30fdf41,0x180f9fc1,0x180fa041,0x91060c0,0x91060bf,0x70203e,0x701fbe,0x6fdfbe,0x6fe03e,0x190fa0c0,0x93060c1,0xb105f40,0xb105f3f,0x190fa0bf,0x192fa0c1,0x1b0f9f40,0xb305f41,0xb301fc2,0x9302042,0x192fe042,0x1b2fdfc2,0x1b0f9f3f,0x1b2f9f41,0x8705fbe,0x870603e,0x97020be,0x16fe0be,0x196fa03e,0x186f9fbe,0x1b6fdf3e,0xb701f3e,
+	11,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0xfdfc1,0xfe041,0x10fe0c0,0x11020c0,0x8106040,0x8105fc0,0x8105fbf,0x810603f,0x11020bf,0x10fe0bf,0x10fe0c1,0x11020c1,0x8106041,0x8105fc1,0x3101f40,0x30fdf40,0x180f9fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x30fdf3f,0x3101f3f,0x3101f41,0x30fdf41,0x180f9fc1,0x180fa041,0x91060c0,0x91060bf,0x93060c1,0x190fa0c0,0xb105f40,0xb105f3f,0x701fbe,0x70203e,0x6fe03e,0x6fdfbe,0x190fa0bf,0x192fa0c1,0x192fe042,0x9302042,0xb301fc2,0xb305f41,0x1b2fdfc2,0x1b0f9f40,0x1b0f9f3f,0x1b2f9f41,0x8705fbe,0x870603e,0x97020be,0x16fe0be,0x196fa03e,0x186f9fbe,0x1b6fdf3e,0xb701f3e,
+	9,0x10203f,0xfe03f,0xfe040,0x101fc0,0x101fbf,0xfdfbf,0xfdfc0,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x8106040,0x810603f,0x8105fbf,0x8105fc0,0x302041,0x2fe041,0x2fdfc1,0x301fc1,0x70203e,0x6fe03e,0x6fdfbe,0x701fbe,0x180fa03f,0x180fa040,0x180f9fc0,0x180f9fbf,0x30fdf3f,0x3101f3f,0x3101f40,0x30fdf40,0x81060c0,0x81060bf,0x3020c1,0x12fe0c1,0x8306041,0x8305fc1,0x7020be,0x16fe0be,0x190fa0bf,0x190fa0c0,0x870603e,0x8705fbe,0xb105f3f,0xb105f40,0x182f9fc1,0x182fa041,0x32fdf41,0x3301f41,0x186fa03e,0x186f9fbe,0x36fdf3e,0x3701f3e,0x1b6f9f3f,0x1b2f9f40,0x93060c1,0x97060be,0x192fa0c1,0x196fa0be,0xb305f41,0xb705f3e,0x1170213f,0x11302140,
+	10,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x2fe041,0x302041,0x8106040,0x810603f,0x8105fbf,0x8105fc0,0x301fc1,0x2fdfc1,0x180fa040,0x180fa03f,0x6fe03e,0x70203e,0x701fbe,0x6fdfbe,0x180f9fbf,0x180f9fc0,0x30fdf40,0x3101f40,0x3101f3f,0x30fdf3f,0x3020c1,0x12fe0c1,0x81060c0,0x81060bf,0x8306041,0x8305fc1,0x7020be,0x6fe0be,0x180fa0bf,0x190fa0c0,0x182fa041,0x182f9fc1,0x32fdf41,0x3301f41,0x870603e,0x8705fbe,0xb105f3f,0xb105f40,0x93060c1,0x186fa03e,0x186f9fbe,0x36fdf3e,0xb701f3e,0x1b6f9f3f,0x1b2f9f40,0x192fa0c1,0x97060be,0xb305f41,0x196fa0be,0x196fe13f,0x970213f,0x11302140,
+	7,0xfe040,0x10203f,0x101fc0,0xfdfc0,0xfe03f,0x101fbf,0xfdfbf,0x302041,0x2fe041,0xfe0c0,0x11020c0,0x11020bf,0xfe0bf,0x301fc1,0x2fdfc1,0x8106040,0x810603f,0x8105fc0,0x8105fbf,0x180fa040,0x180f9fc0,0x180fa03f,0x180f9fbf,0x30fdf40,0x3101f40,0x3101f3f,0x30fdf3f,0x6fdfbe,0x6fe03e,0x70203e,0x701fbe,0x13020c1,0x2fe0c1,0x8306041,0x91060c0,0x91060bf,0x8305fc1,0x182fa041,0x180fa0c0,0x180fa0bf,0x182f9fc1,0x32fdf41,0x3301f41,0xb105f40,0xb105f3f,0x17020be,0x6fe0be,0x870603e,0x8705fbe,0x93060c1,0x192fa0c1,0x1b0f9f40,0x1b0f9f3f,0x186f9fbe,0x186fa03e,0x1b6fdf3e,0xb701f3e,0x97060be,0xb305f41,0x1b2f9f41,0x196fa0be,0x196fe13f,0x192fe140,
+	10,0xfe040,0x101fc0,0xfdfc0,0x10203f,0xfe03f,0x101fbf,0xfdfbf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x11020c0,0x10fe0c0,0x10fe0bf,0x11020bf,0x8106040,0x8105fc0,0x810603f,0x8105fbf,0x180fa040,0x180f9fc0,0x180fa03f,0x180f9fbf,0x30fdf40,0x3101f40,0x3101f3f,0x30fdf3f,0x11020c1,0x10fe0c1,0x8106041,0x8305fc1,0x91060c0,0x70203e,0x6fe03e,0x6fdfbe,0x701fbe,0x91060bf,0x180fa041,0x180f9fc1,0x190fa0c0,0x190fa0bf,0x30fdf41,0x3301f41,0xb105f40,0xb105f3f,0x93060c1,0x17020be,0x16fe0be,0x870603e,0x8705fbe,0x1b0f9f40,0x1b0f9f3f,0x192fa0c1,0x196fa03e,0x186f9fbe,0x1b6fdf3e,0xb701f3e,0xb305f41,0x97060be,0xa302042,0x192fe042,0x1b2fdfc2,0x1b2f9f41,
+	11,0xfe040,0x101fc0,0xfdfc0,0x10203f,0xfe03f,0x101fbf,0xfdfbf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x11020c0,0x10fe0c0,0x10fe0bf,0x11020bf,0x8106040,0x8105fc0,0x810603f,0x8105fbf,0x180fa040,0x180f9fc0,0x180fa03f,0x180f9fbf,0x10fe0c1,0x11020c1,0x8106041,0x8105fc1,0x3101f40,0x30fdf40,0x30fdf3f,0x3101f3f,0x91060c0,0x91060bf,0x70203e,0x6fe03e,0x6fdfbe,0x701fbe,0x180fa041,0x180f9fc1,0x30fdf41,0x3101f41,0x190fa0c0,0x190fa0bf,0x93060c1,0xb105f40,0xb105f3f,0x17020be,0x16fe0be,0x970603e,0x8705fbe,0x192fa0c1,0x1b0f9f40,0x1b0f9f3f,0xb305f41,0xb301fc2,0x9302042,0x192fe042,0x1b2fdfc2,0x196fa03e,0x186f9fbe,0x1b6fdf3e,0xb701f3e,0x1b2f9f41,
+	11,0xfe040,0x101fc0,0xfdfc0,0x10203f,0xfe03f,0x101fbf,0xfdfbf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x11020c0,0x10fe0c0,0x10fe0bf,0x11020bf,0x8106040,0x8105fc0,0x810603f,0x8105fbf,0x11020c1,0x10fe0c1,0x180fa040,0x180f9fc0,0x180fa03f,0x180f9fbf,0x8106041,0x8105fc1,0x3101f40,0x30fdf40,0x30fdf3f,0x3101f3f,0x91060c0,0x91060bf,0x180fa041,0x180f9fc1,0x30fdf41,0x3101f41,0x70203e,0x6fe03e,0x6fdfbe,0x701fbe,0x190fa0c0,0x190fa0bf,0x93060c1,0xb105f40,0xb105f3f,0x192fa0c1,0x16fe0be,0x17020be,0x970603e,0x8705fbe,0x1b0f9f40,0x1b0f9f3f,0xb305f41,0xb301fc2,0x9302042,0x192fe042,0x1b2fdfc2,0x1b2f9f41,0x186f9fbe,0x196fa03e,0x1b6fdf3e,0xb701f3e,
+	11,0xfe040,0x101fc0,0xfdfc0,0x10203f,0xfe03f,0x101fbf,0xfdfbf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x11020c0,0x10fe0c0,0x8106040,0x8105fc0,0x11020bf,0x10fe0bf,0x810603f,0x8105fbf,0x11020c1,0x10fe0c1,0x8106041,0x8105fc1,0x180fa040,0x180f9fc0,0x30fdf40,0x3101f40,0x180f9fbf,0x180fa03f,0x30fdf3f,0x3101f3f,0x91060c0,0x180fa041,0x180f9fc1,0x30fdf41,0x3101f41,0x91060bf,0x93060c1,0x190fa0c0,0x6fe03e,0x70203e,0x701fbe,0x6fdfbe,0x190fa0bf,0x192fa0c1,0xb105f40,0xb105f3f,0xb305f41,0xb301fc2,0x9302042,0x192fe042,0x1b2fdfc2,0x1b0f9f40,0x1b0f9f3f,0x16fe0be,0x17020be,0x970603e,0x8705fbe,0x1b2f9f41,0x186f9fbe,0x196fa03e,0x1b6fdf3e,0xb701f3e,
+	11,0xfe040,0x101fc0,0xfdfc0,0x10203f,0xfe03f,0x101fbf,0xfdfbf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x11020c0,0x10fe0c0,0x8106040,0x8105fc0,0x11020bf,0x10fe0bf,0x10fe0c1,0x11020c1,0x810603f,0x8105fbf,0x8106041,0x8105fc1,0x180fa040,0x180f9fc0,0x30fdf40,0x3101f40,0x180f9fbf,0x180fa03f,0x180fa041,0x180f9fc1,0x30fdf3f,0x3101f3f,0x91060c0,0x3101f41,0x30fdf41,0x91060bf,0x91060c1,0x190fa0c0,0x190fa0bf,0x186fe03e,0x70203e,0x3701fbe,0x1b6fdfbe,0xb105f40,0xb105f3f,0x190fa0c1,0x182fe042,0x302042,0x3301fc2,0x1b2fdfc2,0xb105f41,0x1b0f9f40,0x1b6f9f3f,0x1b2f9f41,0x196fe0be,0x17020be,0x970603e,0xb705fbe,0x13020c2,0x192fe0c2,0x9306042,0xb305fc2,
+	11,0x10203f,0xfe03f,0xfe040,0x101fc0,0x101fbf,0xfdfbf,0xfdfc0,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x8106040,0x810603f,0x8105fbf,0x8105fc0,0x302041,0x2fe041,0x2fdfc1,0x301fc1,0x70203e,0x6fe03e,0x6fdfbe,0x701fbe,0x180fa03f,0x180fa040,0x180f9fc0,0x180f9fbf,0x30fdf3f,0x3101f3f,0x3101f40,0x30fdf40,0x81060c0,0x81060bf,0x3020c1,0x2fe0c1,0x7020be,0x6fe0be,0x180fa0bf,0x180fa0c0,0x8306041,0x8305fc1,0x870603e,0x8705fbe,0xb105f3f,0xb105f40,0x182fa041,0x182f9fc1,0x186fa03e,0x186f9fbe,0x32fdf41,0xb301f41,0x93060c1,0x97060be,0xb701f3e,0x36fdf3e,0x1b6f9f3f,0x1b2f9f40,0x192fa0c1,0x196fa0be,0x196fe13f,0x970213f,0x9302140,0x192fe140,
+	11,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x2fe041,0x302041,0x8106040,0x810603f,0x8105fbf,0x8105fc0,0x301fc1,0x2fdfc1,0x180fa040,0x180fa03f,0x6fe03e,0x70203e,0x701fbe,0x6fdfbe,0x180f9fbf,0x180f9fc0,0x2fe0c1,0x3020c1,0x81060c0,0x81060bf,0x3101f40,0x3101f3f,0x30fdf3f,0x30fdf40,0x8306041,0x8305fc1,0x7020be,0x6fe0be,0x180fa0bf,0x180fa0c0,0x182fa041,0x182f9fc1,0x870603e,0x8705fbe,0xb105f3f,0xb105f40,0xb301f41,0x32fdf41,0x93060c1,0x186fa03e,0x186f9fbe,0x36fdf3e,0xb701f3e,0x97060be,0x192fa0c1,0x1b2f9f40,0x1b6f9f3f,0x196fa0be,0x196fe13f,0x970213f,0x9302140,0x192fe140,
+	10,0xfe040,0x10203f,0xfe03f,0x101fc0,0xfdfc0,0x101fbf,0xfdfbf,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x302041,0x2fe041,0x2fdfc1,0x301fc1,0x8106040,0x810603f,0x8105fc0,0x8105fbf,0x180fa040,0x180fa03f,0x180f9fc0,0x180f9fbf,0x6fe03e,0x70203e,0x701fbe,0x6fdfbe,0x3020c1,0x2fe0c1,0x81060c0,0x91060bf,0x8306041,0x3101f40,0x30fdf40,0x30fdf3f,0x3101f3f,0x8305fc1,0x180fa0c0,0x180fa0bf,0x182fa041,0x182f9fc1,0x6fe0be,0x17020be,0x870603e,0x8705fbe,0x93060c1,0x3301f41,0x32fdf41,0xb105f40,0xb105f3f,0x186fa03e,0x186f9fbe,0x192fa0c1,0x1b2f9f40,0x1b0f9f3f,0x1b6fdf3e,0xb701f3e,0x97060be,0xb305f41,0x9502140,0x192fe140,0x196fe13f,0x196fa0be,
+	9,0xfe040,0x10203f,0x101fc0,0xfdfc0,0xfe03f,0x101fbf,0xfdfbf,0x102041,0xfe041,0x10fe0c0,0x11020c0,0x11020bf,0x10fe0bf,0x101fc1,0xfdfc1,0x8106040,0x810603f,0x8105fc0,0x8105fbf,0x180fa040,0x180f9fc0,0x180fa03f,0x180f9fbf,0x10fe0c1,0x11020c1,0x8106041,0x91060c0,0x91060bf,0x70203e,0x6fe03e,0x6fdfbe,0x701fbe,0x3101f40,0x30fdf40,0x30fdf3f,0x3101f3f,0x8105fc1,0x180fa041,0x190fa0c0,0x190fa0bf,0x180f9fc1,0x30fdf41,0x3101f41,0x93060c1,0x17020be,0x16fe0be,0x870603e,0x8705fbe,0xb105f3f,0xb105f40,0x192fa0c1,0x1b2f9f40,0x1b0f9f3f,0x186f9fbe,0x196fa03e,0x1b6fdf3e,0xb701f3e,0x97060be,0xb305f41,0xb301fc2,0x9302042,0x192fe042,0x1b2fdfc2,
+	11,0xfe040,0x101fc0,0xfdfc0,0x10203f,0xfe03f,0x101fbf,0xfdfbf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x11020c0,0x10fe0c0,0x10fe0bf,0x11020bf,0x8106040,0x8105fc0,0x810603f,0x8105fbf,0x11020c1,0x10fe0c1,0x180fa040,0x180f9fc0,0x180fa03f,0x180f9fbf,0x8106041,0x8105fc1,0x91060c0,0x91060bf,0x3101f40,0x30fdf40,0x30fdf3f,0x3101f3f,0x70203e,0x6fe03e,0x6fdfbe,0x701fbe,0x180fa041,0x180f9fc1,0x190fa0c0,0x190fa0bf,0x93060c1,0x3101f41,0x30fdf41,0xb105f40,0xb105f3f,0x17020be,0x16fe0be,0x192fa0c1,0x970603e,0x8705fbe,0x1b0f9f40,0x1b0f9f3f,0x186f9fbe,0x196fa03e,0xb305f41,0xb301fc2,0x9302042,0x192fe042,0x1b2fdfc2,0x1b2f9f41,0x1b6fdf3e,0xb701f3e,
+	11,0xfe040,0x101fc0,0xfdfc0,0x10203f,0xfe03f,0x101fbf,0xfdfbf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x11020c0,0x10fe0c0,0x10fe0bf,0x11020bf,0x8106040,0x8105fc0,0x810603f,0x8105fbf,0x11020c1,0x10fe0c1,0x180fa040,0x180f9fc0,0x180fa03f,0x180f9fbf,0x8106041,0x8105fc1,0x91060c0,0x91060bf,0x3101f40,0x30fdf40,0x30fdf3f,0x3101f3f,0x180fa041,0x180f9fc1,0x190fa0c0,0x6fe03e,0x70203e,0x701fbe,0x6fdfbe,0x190fa0bf,0x93060c1,0x3101f41,0x30fdf41,0x192fa0c1,0xb105f40,0xb105f3f,0x17020be,0x16fe0be,0x970603e,0x8705fbe,0x1b0f9f40,0x1b0f9f3f,0xb305f41,0x9302042,0x192fe042,0x1b2fdfc2,0xb301fc2,0x1b2f9f41,0x196fa03e,0x186f9fbe,0x1b6fdf3e,0xb701f3e,
+	13,0xfe040,0x101fc0,0xfdfc0,0x10203f,0xfe03f,0x101fbf,0xfdfbf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x8106040,0x8105fc0,0x810603f,0x1020c1,0xfe0c1,0x8105fbf,0x8106041,0x8105fc1,0x180fa040,0x180f9fc0,0x180fa03f,0x180f9fbf,0x30fdf40,0x3101f40,0x81060c0,0x91060bf,0x180fa041,0x180f9fc1,0x30fdf3f,0x3101f3f,0x3101f41,0x30fdf41,0x91060c1,0x180fa0c0,0x190fa0bf,0x186fe03e,0x70203e,0x3701fbe,0x1b6fdfbe,0x190fa0c1,0xb105f40,0xb105f3f,0x8302042,0x182fe042,0x1b2fdfc2,0xb301fc2,0xb305f41,0x17020be,0x196fe0be,0x1b0f9f40,0x1b6f9f3f,0x970603e,0xb705fbe,0x1b2f9f41,0x192fe0c2,0x93020c2,0x9502140,0x194fe140,
+	11,0xfe040,0x101fc0,0xfdfc0,0x10203f,0xfe03f,0x101fbf,0xfdfbf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x11020c0,0x10fe0c0,0x10fe0bf,0x11020bf,0x8106040,0x8105fc0,0x11020c1,0x10fe0c1,0x810603f,0x8105fbf,0x8106041,0x8105fc1,0x180fa040,0x180f9fc0,0x180fa03f,0x180f9fbf,0x30fdf40,0x3101f40,0x91060c0,0x180fa041,0x180f9fc1,0x30fdf3f,0x3101f3f,0x91060bf,0x91060c1,0x3101f41,0x30fdf41,0x190fa0c0,0x190fa0bf,0x190fa0c1,0x186fe03e,0x70203e,0x3701fbe,0x1b6fdfbe,0xb105f40,0x302042,0x182fe042,0x1b2fdfc2,0x3301fc2,0xb105f41,0xb105f3f,0x1b0f9f40,0x1b6f9f3f,0x196fe0be,0x17020be,0x970603e,0xb705fbe,0x1b2f9f41,0x192fe0c2,0x13020c2,0x9306042,0xb305fc2,
+	11,0x10203f,0xfe03f,0xfe040,0x101fc0,0x101fbf,0xfdfbf,0xfdfc0,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x8106040,0x810603f,0x8105fbf,0x8105fc0,0x302041,0x2fe041,0x2fdfc1,0x301fc1,0x70203e,0x6fe03e,0x6fdfbe,0x701fbe,0x180fa03f,0x180fa040,0x180f9fc0,0x180f9fbf,0x81060bf,0x81060c0,0x3020c1,0x2fe0c1,0x7020be,0x6fe0be,0x180fa0bf,0x180fa0c0,0x30fdf40,0x3101f40,0x3101f3f,0x30fdf3f,0x8306041,0x8305fc1,0x870603e,0x8705fbe,0x182fa041,0x182f9fc1,0x186fa03e,0x186f9fbe,0x93060c1,0x97060be,0xb105f3f,0xb105f40,0xb301f41,0x32fdf41,0x192fa0c1,0x196fa0be,0x36fdf3e,0xb701f3e,0x1b6f9f3f,0x1b2f9f40,0x192fe140,0x9302140,0x970213f,0x196fe13f,
+	11,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x2fe041,0x302041,0x8106040,0x810603f,0x8105fbf,0x8105fc0,0x301fc1,0x2fdfc1,0x180fa040,0x180fa03f,0x6fe03e,0x70203e,0x701fbe,0x6fdfbe,0x180f9fbf,0x180f9fc0,0x2fe0c1,0x3020c1,0x81060c0,0x81060bf,0x8306041,0x3101f40,0x3101f3f,0x30fdf3f,0x30fdf40,0x8305fc1,0x7020be,0x6fe0be,0x180fa0bf,0x180fa0c0,0x182fa041,0x182f9fc1,0x870603e,0x8705fbe,0x93060c1,0xb105f40,0xb105f3f,0xb301f41,0x32fdf41,0x186fa03e,0x186f9fbe,0x192fa0c1,0x97060be,0xb701f3e,0x36fdf3e,0x1b6f9f3f,0x1b2f9f40,0x196fa0be,0x196fe13f,0x970213f,0x9302140,0x192fe140,
+	11,0xfe040,0x10203f,0xfe03f,0x101fc0,0xfdfc0,0x101fbf,0xfdfbf,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x302041,0x2fe041,0x2fdfc1,0x301fc1,0x8106040,0x810603f,0x8105fc0,0x8105fbf,0x180fa040,0x180fa03f,0x180f9fc0,0x180f9fbf,0x2fe0c1,0x3020c1,0x81060c0,0x81060bf,0x70203e,0x6fe03e,0x6fdfbe,0x701fbe,0x8306041,0x8305fc1,0x3101f40,0x30fdf40,0x30fdf3f,0x3101f3f,0x180fa0c0,0x180fa0bf,0x6fe0be,0x7020be,0x182fa041,0x182f9fc1,0x93060c1,0x870603e,0x8705fbe,0x3301f41,0x32fdf41,0xb305f40,0xb105f3f,0x192fa0c1,0x186fa03e,0x186f9fbe,0x97060be,0x970213f,0x9302140,0x192fe140,0x196fe13f,0x1b2f9f40,0x1b0f9f3f,0x1b6fdf3e,0xb701f3e,0x196fa0be,
+	11,0xfe040,0x10203f,0xfe03f,0x101fc0,0xfdfc0,0x101fbf,0xfdfbf,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x302041,0x2fe041,0x2fdfc1,0x301fc1,0x8106040,0x810603f,0x8105fc0,0x8105fbf,0x3020c1,0x2fe0c1,0x180fa040,0x180fa03f,0x180f9fc0,0x180f9fbf,0x81060c0,0x81060bf,0x8306041,0x8305fc1,0x70203e,0x6fe03e,0x6fdfbe,0x701fbe,0x3101f40,0x30fdf40,0x30fdf3f,0x3101f3f,0x180fa0c0,0x180fa0bf,0x182fa041,0x182f9fc1,0x93060c1,0x7020be,0x6fe0be,0x870603e,0x8705fbe,0x3301f41,0x32fdf41,0x192fa0c1,0xb305f40,0xb105f3f,0x186fa03e,0x186f9fbe,0x1b0f9f3f,0x1b2f9f40,0x97060be,0x970213f,0x9302140,0x192fe140,0x196fe13f,0x196fa0be,0x1b6fdf3e,0xb701f3e,
+	14,0xfe040,0x10203f,0x101fc0,0xfdfc0,0xfe03f,0x101fbf,0xfdfbf,0x102041,0xfe041,0xfe0c0,0x1020c0,0x1020bf,0xfe0bf,0x101fc1,0xfdfc1,0x8106040,0x810603f,0x8105fc0,0x8105fbf,0x1020c1,0xfe0c1,0x180fa040,0x180f9fc0,0x180fa03f,0x180f9fbf,0x8106041,0x81060c0,0x81060bf,0x8105fc1,0x3101f40,0x30fdf40,0x30fdf3f,0x6fe03e,0x70203e,0x701fbe,0x36fdfbe,0x3701f3f,0x180fa041,0x180fa0c0,0x180fa0bf,0x182f9fc1,0x93060c1,0x7020be,0x6fe0be,0x3101f41,0x32fdf41,0x192fa0c1,0x870603e,0x8705fbe,0xb305f40,0xb705f3f,0x1b2f9f40,0x1b0f9f3f,0x196fa03e,0x1b6f9fbe,0x192fe140,0x9302140,0x970213f,0x97060be,0x196fe13f,0x192fe042,0x9302042,0x13301fc2,
+	13,0xfe040,0x101fc0,0xfdfc0,0x10203f,0xfe03f,0x101fbf,0xfdfbf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x8106040,0x8105fc0,0x810603f,0x1020c1,0xfe0c1,0x8105fbf,0x180fa040,0x180f9fc0,0x180fa03f,0x8106041,0x8105fc1,0x81060c0,0x81060bf,0x180f9fbf,0x30fdf40,0x3101f40,0x180fa041,0x180f9fc1,0x180fa0c0,0x190fa0bf,0x6fe03e,0x70203e,0x3101f3f,0x30fdf3f,0x36fdfbe,0x3701fbe,0x93060c1,0x3101f41,0x30fdf41,0x192fa0c1,0x16fe0be,0x7020be,0xb105f40,0xb105f3f,0x970603e,0xb705fbe,0x9302042,0x192fe042,0x1b2fdfc2,0xb301fc2,0xb305f41,0x1b2f9f40,0x1b0f9f3f,0x196fa03e,0x1b6f9fbe,0x192fe140,0x9302140,0x1170213f,
+	15,0xfe040,0x101fc0,0xfdfc0,0x10203f,0xfe03f,0x101fbf,0xfdfbf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x8106040,0x1020c1,0xfe0c1,0x8105fc0,0x810603f,0x8105fbf,0x8106041,0x8105fc1,0x180fa040,0x180f9fc0,0x180fa03f,0x180f9fbf,0x81060c0,0x81060bf,0x180fa041,0x180f9fc1,0x30fdf40,0x3101f40,0x3101f3f,0x30fdf3f,0x180fa0c0,0x93060c1,0x180fa0bf,0x186fe03e,0x70203e,0x3701fbe,0x1b6fdfbe,0x3101f41,0x30fdf41,0x190fa0c1,0x182fe042,0x9302042,0xb105f40,0xb105f3f,0x7020be,0x186fe0be,0xb301fc2,0x1b2fdfc2,0xb305f41,0x970603e,0xb705fbe,0x1b2f9f40,0x1b6f9f3f,0x192fe140,0x9302140,0x970213f,0x196fe13f,0x192fe0c2,
+	13,0xfe040,0x101fc0,0xfdfc0,0x10203f,0xfe03f,0xfdfbf,0x101fbf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x1020c1,0xfe0c1,0x8106040,0x8105fc0,0x810603f,0x8105fbf,0x8106041,0x8105fc1,0x180fa040,0x180f9fc0,0x180fa03f,0x81060c0,0x81060bf,0x180fa041,0x180f9fbf,0x180f9fc1,0x30fdf40,0x3101f40,0x91060c1,0x180fa0c0,0x190fa0bf,0x30fdf3f,0x3101f3f,0x3101f41,0x30fdf41,0x190fa0c1,0x186fe03e,0x70203e,0x3701fbe,0x1b6fdfbe,0x8302042,0x182fe042,0x1b2fdfc2,0xb301fc2,0xb105f40,0xb105f3f,0xb305f41,0x7020be,0x196fe0be,0x1b2f9f40,0x1b6f9f3f,0x192fe0c2,0x93020c2,0x9302140,0x192fe140,0x970603e,0xb705fbe,0x1170213f,
+	11,0x10203f,0xfe03f,0xfe040,0x101fc0,0x101fbf,0xfdfbf,0xfdfc0,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x8106040,0x810603f,0x8105fbf,0x8105fc0,0x302041,0x2fe041,0x2fdfc1,0x301fc1,0x70203e,0x6fe03e,0x6fdfbe,0x701fbe,0x180fa03f,0x180fa040,0x180f9fc0,0x180f9fbf,0x81060bf,0x81060c0,0x3020c1,0x2fe0c1,0x7020be,0x6fe0be,0x180fa0bf,0x180fa0c0,0x8306041,0x8305fc1,0x3101f40,0x3101f3f,0x30fdf3f,0x30fdf40,0x870603e,0x8705fbe,0x182fa041,0x182f9fc1,0x93060c1,0x97060be,0x186fa03e,0x186f9fbe,0x192fa0c1,0x192fe140,0x9302140,0x970213f,0x196fe13f,0x196fa0be,0xb105f3f,0xb105f40,0xb301f41,0x32fdf41,0x36fdf3e,0xb701f3e,0x1b6f9f3f,0x1b2f9f40,
+	11,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x2fe041,0x302041,0x8106040,0x810603f,0x8105fbf,0x8105fc0,0x301fc1,0x2fdfc1,0x180fa040,0x180fa03f,0x6fe03e,0x70203e,0x81060bf,0x81060c0,0x3020c1,0x2fe0c1,0x180f9fc0,0x180f9fbf,0x6fdfbe,0x701fbe,0x7020be,0x6fe0be,0x180fa0bf,0x180fa0c0,0x8306041,0x8305fc1,0x3101f40,0x3101f3f,0x30fdf3f,0x30fdf40,0x182fa041,0x182f9fc1,0x870603e,0x8705fbe,0x93060c1,0x97060be,0x186fa03e,0x186f9fbe,0x192fa0c1,0x32fdf41,0x3301f41,0xb305f40,0xb105f3f,0x9302140,0x970213f,0x196fe13f,0x192fe140,0x196fa0be,0x1b0f9f3f,0x1b2f9f40,0x1b6fdf3e,0xb701f3e,
+	11,0xfe040,0x10203f,0xfe03f,0x101fc0,0xfdfc0,0x101fbf,0xfdfbf,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x302041,0x2fe041,0x2fdfc1,0x301fc1,0x8106040,0x810603f,0x8105fc0,0x8105fbf,0x3020c1,0x2fe0c1,0x180fa040,0x180fa03f,0x180f9fc0,0x180f9fbf,0x81060c0,0x81060bf,0x70203e,0x6fe03e,0x6fdfbe,0x701fbe,0x8306041,0x8305fc1,0x180fa0c0,0x180fa0bf,0x6fe0be,0x7020be,0x3101f40,0x30fdf40,0x30fdf3f,0x3101f3f,0x182fa041,0x182f9fc1,0x93060c1,0x870603e,0x8705fbe,0x192fa0c1,0x32fdf41,0x3301f41,0xb305f40,0xb105f3f,0x186fa03e,0x186f9fbe,0x97060be,0x970213f,0x9302140,0x192fe140,0x196fe13f,0x196fa0be,0x1b0f9f3f,0x1b2f9f40,0x1b6fdf3e,0xb701f3e,
+	11,0xfe040,0x10203f,0xfe03f,0x101fc0,0xfdfc0,0x101fbf,0xfdfbf,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x302041,0x2fe041,0x2fdfc1,0x301fc1,0x8106040,0x810603f,0x8105fc0,0x8105fbf,0x3020c1,0x2fe0c1,0x180fa040,0x180fa03f,0x180f9fc0,0x180f9fbf,0x81060c0,0x81060bf,0x8306041,0x8305fc1,0x70203e,0x6fe03e,0x6fdfbe,0x701fbe,0x180fa0c0,0x180fa0bf,0x182fa041,0x30fdf40,0x3101f40,0x3101f3f,0x30fdf3f,0x182f9fc1,0x93060c1,0x7020be,0x6fe0be,0x192fa0c1,0x870603e,0x8705fbe,0x3301f41,0x32fdf41,0xb305f40,0xb105f3f,0x186fa03e,0x186f9fbe,0x97060be,0x9302140,0x192fe140,0x196fe13f,0x970213f,0x196fa0be,0x1b2f9f40,0x1b0f9f3f,0x1b6fdf3e,0xb701f3e,
+	13,0xfe040,0x10203f,0xfe03f,0x101fc0,0xfdfc0,0x101fbf,0xfdfbf,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x8106040,0x810603f,0x8105fc0,0x1020c1,0xfe0c1,0x8105fbf,0x180fa040,0x180fa03f,0x180f9fc0,0x81060c0,0x81060bf,0x8106041,0x8105fc1,0x180f9fbf,0x6fe03e,0x70203e,0x180fa0c0,0x180fa0bf,0x180fa041,0x182f9fc1,0x30fdf40,0x3101f40,0x701fbe,0x6fdfbe,0x36fdf3f,0x3701f3f,0x93060c1,0x7020be,0x6fe0be,0x192fa0c1,0x32fdf41,0x3101f41,0x870603e,0x8705fbe,0xb305f40,0xb705f3f,0x9302140,0x192fe140,0x196fe13f,0x970213f,0x97060be,0x196fa03e,0x186f9fbe,0x1b2f9f40,0x1b6f9f3f,0x192fe042,0x9302042,0x13301fc2,
+	15,0xfe040,0x10203f,0x101fc0,0xfdfc0,0xfe03f,0x101fbf,0xfdfbf,0x102041,0xfe041,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x101fc1,0xfdfc1,0x8106040,0x1020c1,0xfe0c1,0x810603f,0x8105fc0,0x8105fbf,0x180fa040,0x180f9fc0,0x180fa03f,0x81060c0,0x8106041,0x8105fc1,0x81060bf,0x180f9fbf,0x180fa041,0x180fa0c0,0x180fa0bf,0x93060c1,0x180f9fc1,0x30fdf40,0x3101f40,0x70203e,0x6fe03e,0x6fdfbe,0x701fbe,0x3701f3f,0x36fdf3f,0x192fa0c1,0x6fe0be,0x7020be,0x3101f41,0x30fdf41,0xb105f40,0xb105f3f,0x970603e,0xb705fbe,0x9302140,0x192fe140,0x196fe13f,0x970213f,0x9302042,0x192fe042,0x1b2fdfc2,0xb301fc2,0xb305f41,0x1b2f9f40,0x1b6f9f3f,0x1a6fa03e,
+	15,0xfe040,0x101fc0,0xfdfc0,0x10203f,0xfe03f,0xfdfbf,0x101fbf,0x102041,0xfe041,0x1020c0,0xfe0c0,0x101fc1,0xfdfc1,0x1020bf,0xfe0bf,0x1020c1,0xfe0c1,0x8106040,0x8105fc0,0x810603f,0x8105fbf,0x8106041,0x81060c0,0x180fa040,0x180f9fc0,0x180fa03f,0x8105fc1,0x81060bf,0x180f9fbf,0x180fa041,0x180fa0c0,0x91060c1,0x180f9fc1,0x1b0fdf40,0x3101f40,0x180fa0bf,0x186fe03e,0x70203e,0x3101f3f,0x1b0fdf3f,0x1b6fdfbe,0x3701fbe,0x180fa0c1,0x1b0fdf41,0x3101f41,0x7020be,0x186fe0be,0x8302042,0x182fe042,0x1b2fdfc2,0xb301fc2,0xb105f40,0xb105f3f,0x970603e,0x9302140,0x190fe140,0x196fe13f,0x970213f,0xb705fbe,0xb305f41,0x93020c2,0x182fe0c2,0x192fe141,
+	17,0xfe040,0x101fc0,0xfdfc0,0x10203f,0xfe03f,0x102041,0xfe041,0x101fbf,0xfdfbf,0x101fc1,0xfdfc1,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x1020c1,0xfe0c1,0x8106040,0x8105fc0,0x810603f,0x8106041,0x8105fbf,0x8105fc1,0x180fa040,0x180f9fc0,0x81060c0,0x81060bf,0x180fa03f,0x180fa041,0x180f9fbf,0x180f9fc1,0x81060c1,0x180fa0c0,0x180fa0bf,0x30fdf40,0x3101f40,0x3101f3f,0x30fdf3f,0x180fa0c1,0x30fdf41,0x3101f41,0x870203e,0x186fe03e,0x1b6fdfbe,0xb701fbe,0x8302042,0x182fe042,0x1b2fdfc2,0xb301fc2,0xb105f40,0x87020be,0x186fe0be,0x190fe140,0x9102140,0x83020c2,0x182fe0c2,0x192fe141,0x9302141,0x970213f,0x196fe13f,0xb705f3f,0xb305f41,0x1b4f9f40,
+	11,0x10203f,0xfe03f,0xfe040,0x101fc0,0x101fbf,0xfdfbf,0xfdfc0,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x8106040,0x810603f,0x302041,0x2fe041,0x8105fc0,0x8105fbf,0x70203e,0x6fe03e,0x301fc1,0x2fdfc1,0x180fa040,0x180fa03f,0x6fdfbe,0x701fbe,0x81060bf,0x81060c0,0x3020c1,0x2fe0c1,0x180f9fc0,0x180f9fbf,0x6fe0be,0x7020be,0x180fa0bf,0x180fa0c0,0x8306041,0x8305fc1,0x870603e,0x8705fbe,0x3101f3f,0x3101f40,0x30fdf40,0x30fdf3f,0x182fa041,0x93060c1,0x97060be,0x186fa03e,0x186f9fbe,0x182f9fc1,0x192fa0c1,0x192fe140,0x9302140,0x970213f,0x196fe13f,0x196fa0be,0xb105f3f,0xb105f40,0xb301f41,0x32fdf41,0x36fdf3e,0xb701f3e,0x1b6f9f3f,0x1b2f9f40,
+	11,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x2fe041,0x302041,0x8106040,0x810603f,0x8105fbf,0x8105fc0,0x301fc1,0x2fdfc1,0x2fe0c1,0x3020c1,0x81060c0,0x81060bf,0x70203e,0x6fe03e,0x180fa03f,0x180fa040,0x180f9fc0,0x180f9fbf,0x6fdfbe,0x701fbe,0x7020be,0x6fe0be,0x180fa0bf,0x180fa0c0,0x8306041,0x8305fc1,0x3101f40,0x3101f3f,0x30fdf3f,0x30fdf40,0x182fa041,0x93060c1,0x870603e,0x8705fbe,0x182f9fc1,0x192fa0c1,0x186fa03e,0x97060be,0x970213f,0x9302140,0x192fe140,0x196fe13f,0x186f9fbe,0x196fa0be,0xb105f3f,0xb105f40,0xb301f41,0x32fdf41,0x1b2f9f40,0x1b0f9f3f,0x1b6fdf3e,0xb701f3e,
+	11,0xfe040,0x10203f,0xfe03f,0x101fc0,0xfdfc0,0x101fbf,0xfdfbf,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x302041,0x2fe041,0x8106040,0x810603f,0x301fc1,0x2fdfc1,0x8105fc0,0x8105fbf,0x3020c1,0x2fe0c1,0x81060c0,0x81060bf,0x180fa040,0x180fa03f,0x6fe03e,0x70203e,0x180f9fbf,0x180f9fc0,0x6fdfbe,0x701fbe,0x8306041,0x180fa0c0,0x180fa0bf,0x6fe0be,0x7020be,0x8305fc1,0x93060c1,0x182fa041,0x30fdf40,0x3101f40,0x3101f3f,0x30fdf3f,0x182f9fc1,0x192fa0c1,0x870603e,0x8705fbe,0x97060be,0x970213f,0x9302140,0x192fe140,0x196fe13f,0x186fa03e,0x186f9fbe,0x32fdf41,0x3301f41,0xb305f40,0xb105f3f,0x196fa0be,0x1b0f9f3f,0x1b2f9f40,0x1b6fdf3e,0xb701f3e,
+	13,0xfe040,0x10203f,0xfe03f,0x101fc0,0xfdfc0,0x101fbf,0xfdfbf,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x8106040,0x810603f,0x8105fc0,0x1020c1,0xfe0c1,0x8105fbf,0x81060c0,0x81060bf,0x180fa040,0x180fa03f,0x180f9fc0,0x180f9fbf,0x6fe03e,0x70203e,0x8106041,0x8305fc1,0x180fa0c0,0x180fa0bf,0x6fdfbe,0x701fbe,0x7020be,0x6fe0be,0x83060c1,0x180fa041,0x182f9fc1,0x1b0fdf40,0x3101f40,0x3701f3f,0x1b6fdf3f,0x182fa0c1,0x870603e,0x8705fbe,0x9102140,0x190fe140,0x196fe13f,0x970213f,0x97060be,0x3301f41,0x1b2fdf41,0x186fa03e,0x1b6f9fbe,0xb305f40,0xb705f3f,0x196fa0be,0x192fe141,0x9302141,0xa302042,0x1a2fe042,
+	15,0xfe040,0x10203f,0xfe03f,0x101fc0,0xfdfc0,0x101fbf,0xfdfbf,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x8106040,0x1020c1,0xfe0c1,0x810603f,0x8105fc0,0x8105fbf,0x81060c0,0x81060bf,0x180fa040,0x180fa03f,0x180f9fc0,0x180f9fbf,0x8106041,0x8105fc1,0x180fa0c0,0x180fa0bf,0x6fe03e,0x70203e,0x701fbe,0x6fdfbe,0x180fa041,0x93060c1,0x180f9fc1,0x1b0fdf40,0x3101f40,0x3701f3f,0x1b6fdf3f,0x7020be,0x6fe0be,0x182fa0c1,0x190fe140,0x9302140,0x870603e,0x8705fbe,0x3101f41,0x1b0fdf41,0x970213f,0x196fe13f,0x97060be,0xb305f40,0xb705f3f,0x196fa03e,0x1b6f9fbe,0x192fe042,0x9302042,0xb301fc2,0x1b2fdfc2,0x192fe141,
+	15,0xfe040,0x10203f,0xfe03f,0x101fc0,0xfdfc0,0xfdfbf,0x101fbf,0x1020c0,0xfe0c0,0x102041,0xfe041,0x1020bf,0xfe0bf,0x101fc1,0xfdfc1,0x1020c1,0xfe0c1,0x8106040,0x810603f,0x8105fc0,0x8105fbf,0x81060c0,0x8106041,0x180fa040,0x180fa03f,0x180f9fc0,0x81060bf,0x8105fc1,0x180f9fbf,0x180fa0c0,0x180fa041,0x83060c1,0x180fa0bf,0x186fe03e,0x70203e,0x180f9fc1,0x1b0fdf40,0x3101f40,0x701fbe,0x186fdfbe,0x1b6fdf3f,0x3701f3f,0x180fa0c1,0x186fe0be,0x7020be,0x3101f41,0x1b0fdf41,0x9102140,0x190fe140,0x196fe13f,0x970213f,0x870603e,0x8705fbe,0xb305f40,0x9302042,0x182fe042,0x1b2fdfc2,0xb301fc2,0xb705f3f,0x97060be,0x9302141,0x190fe141,0x192fe0c2,
+	17,0xfe040,0x10203f,0x101fc0,0xfdfc0,0xfe03f,0xfdfbf,0x101fbf,0x102041,0xfe041,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x101fc1,0xfdfc1,0x1020c1,0xfe0c1,0x8106040,0x810603f,0x8105fc0,0x8105fbf,0x8106041,0x81060c0,0x180fa040,0x180f9fc0,0x180fa03f,0x81060bf,0x8105fc1,0x81060c1,0x180fa041,0x180fa0c0,0x180f9fbf,0x180fa0bf,0x180f9fc1,0x180fa0c1,0x1b0fdf40,0x3101f40,0x70203e,0x186fe03e,0x186fdfbe,0x701fbe,0x3701f3f,0x1b6fdf3f,0x1b0fdf41,0x3101f41,0x7020be,0x186fe0be,0x190fe140,0x9102140,0x8302042,0x182fe042,0x1b2fdfc2,0xb301fc2,0xb305f40,0x970603e,0x970213f,0x196fe13f,0x190fe141,0x9102141,0x93020c2,0x192fe0c2,0xb105f3f,0xb705fbe,
+	17,0xfe040,0x101fc0,0xfdfc0,0x10203f,0xfe03f,0x102041,0xfe041,0x1020c0,0xfe0c0,0x101fbf,0xfdfbf,0x101fc1,0xfdfc1,0x1020bf,0xfe0bf,0x1020c1,0xfe0c1,0x8106040,0x8105fc0,0x810603f,0x8106041,0x81060c0,0x8105fbf,0x180fa040,0x180f9fc0,0x8105fc1,0x81060bf,0x81060c1,0x180fa03f,0x180fa041,0x180fa0c0,0x180f9fbf,0x180f9fc1,0x180fa0bf,0x180fa0c1,0x1b0fdf40,0x3101f40,0x3101f3f,0x1b0fdf3f,0x186fe03e,0x70203e,0x3701fbe,0x1b6fdfbe,0x1b0fdf41,0x3101f41,0x8302042,0x182fe042,0x1b2fdfc2,0xb301fc2,0x9102140,0x190fe140,0x186fe0be,0x7020be,0x970213f,0x196fe13f,0x182fe0c2,0x83020c2,0x9302141,0x192fe141,0xb305f40,0xb105f3f,0x970603e,0xb705fbe,
+	11,0x10203f,0xfe03f,0xfe040,0x101fc0,0x101fbf,0xfdfbf,0xfdfc0,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x8106040,0x810603f,0x302041,0x2fe041,0x8105fc0,0x8105fbf,0x70203e,0x6fe03e,0x81060bf,0x81060c0,0x301fc1,0x2fdfc1,0x180fa040,0x180fa03f,0x2fe0c1,0x3020c1,0x701fbe,0x6fdfbe,0x6fe0be,0x7020be,0x180f9fbf,0x180f9fc0,0x180fa0c0,0x180fa0bf,0x8306041,0x8305fc1,0x870603e,0x8705fbe,0x83060c1,0x182fa041,0x1b0fdf40,0x3101f40,0x3101f3f,0x1b0fdf3f,0x87060be,0x170213f,0x1302140,0x192fe140,0x196fe13f,0x186fa03e,0x186f9fbe,0x182f9fc1,0x192fa0c1,0x196fa0be,0xb105f3f,0xb105f40,0xb301f41,0x1b2fdf41,0x1b6fdf3e,0xb701f3e,0x970613f,0x9306140,
+	11,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x2fe041,0x302041,0x8106040,0x810603f,0x8105fbf,0x8105fc0,0x301fc1,0x2fdfc1,0x2fe0c1,0x3020c1,0x81060c0,0x81060bf,0x70203e,0x6fe03e,0x180fa03f,0x180fa040,0x180f9fc0,0x180f9fbf,0x6fdfbe,0x701fbe,0x7020be,0x6fe0be,0x180fa0bf,0x180fa0c0,0x8306041,0x8305fc1,0x93060c1,0x182fa041,0x870603e,0x8705fbe,0x3101f3f,0x3101f40,0x30fdf40,0x30fdf3f,0x182f9fc1,0x192fa0c1,0x192fe140,0x9302140,0x970213f,0x97060be,0x196fe13f,0x186fa03e,0x186f9fbe,0x196fa0be,0xb105f3f,0xb105f40,0xb301f41,0x32fdf41,0x1b2f9f40,0x1b0f9f3f,0x1b6fdf3e,0xb701f3e,
+	11,0xfe040,0x10203f,0xfe03f,0x101fc0,0xfdfc0,0x101fbf,0xfdfbf,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x302041,0x2fe041,0x8106040,0x810603f,0x301fc1,0x2fdfc1,0x2fe0c1,0x3020c1,0x8105fc0,0x8105fbf,0x81060c0,0x81060bf,0x180fa040,0x180fa03f,0x6fe03e,0x70203e,0x180f9fbf,0x180f9fc0,0x180fa0c0,0x180fa0bf,0x6fdfbe,0x701fbe,0x8306041,0x7020be,0x6fe0be,0x8305fc1,0x83060c1,0x182fa041,0x182f9fc1,0x1b0fdf40,0x3101f40,0x3701f3f,0x1b6fdf3f,0x870603e,0x8705fbe,0x182fa0c1,0x190fe140,0x1102140,0x170213f,0x196fe13f,0x87060be,0x186fa03e,0x1b6f9fbe,0x196fa0be,0x1b2fdf41,0x3301f41,0xb305f40,0xb705f3f,0x1302141,0x192fe141,0x9306140,0x970613f,
+	11,0xfe040,0x10203f,0xfe03f,0x101fc0,0xfdfc0,0x101fbf,0xfdfbf,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x302041,0x2fe041,0x2fdfc1,0x301fc1,0x8106040,0x810603f,0x3020c1,0x2fe0c1,0x8105fc0,0x8105fbf,0x81060c0,0x81060bf,0x180fa040,0x180fa03f,0x180f9fc0,0x180f9fbf,0x6fe03e,0x70203e,0x8306041,0x180fa0c0,0x180fa0bf,0x6fdfbe,0x701fbe,0x8305fc1,0x83060c1,0x7020be,0x6fe0be,0x182fa041,0x182f9fc1,0x182fa0c1,0x1b0fdf40,0x3101f40,0x3701f3f,0x1b6fdf3f,0x870603e,0x1102140,0x190fe140,0x196fe13f,0x170213f,0x87060be,0x8705fbe,0x186fa03e,0x1b6f9fbe,0x1b2fdf41,0x3301f41,0xb305f40,0xb705f3f,0x196fa0be,0x192fe141,0x1302141,0x9306140,0x970613f,
+	13,0xfe040,0x10203f,0xfe03f,0x101fc0,0xfdfc0,0xfdfbf,0x101fbf,0x1020c0,0xfe0c0,0xfe0bf,0x1020bf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x1020c1,0xfe0c1,0x8106040,0x810603f,0x8105fc0,0x8105fbf,0x81060c0,0x81060bf,0x180fa040,0x180fa03f,0x180f9fc0,0x8106041,0x8105fc1,0x180fa0c0,0x180f9fbf,0x180fa0bf,0x6fe03e,0x70203e,0x83060c1,0x180fa041,0x182f9fc1,0x6fdfbe,0x701fbe,0x7020be,0x6fe0be,0x182fa0c1,0x1b0fdf40,0x3101f40,0x3701f3f,0x1b6fdf3f,0x9102140,0x190fe140,0x196fe13f,0x970213f,0x870603e,0x8705fbe,0x97060be,0x3101f41,0x1b2fdf41,0x196fa03e,0x1b6f9fbe,0x192fe141,0x9302141,0x9302042,0x192fe042,0xb305f40,0xb705f3f,0x13301fc2,
+	17,0xfe040,0x10203f,0xfe03f,0x101fc0,0xfdfc0,0x1020c0,0xfe0c0,0x101fbf,0xfdfbf,0x1020bf,0xfe0bf,0x102041,0xfe041,0xfdfc1,0x101fc1,0x1020c1,0xfe0c1,0x8106040,0x810603f,0x8105fc0,0x81060c0,0x8105fbf,0x81060bf,0x180fa040,0x180fa03f,0x8106041,0x8105fc1,0x180f9fc0,0x180fa0c0,0x180f9fbf,0x180fa0bf,0x81060c1,0x180fa041,0x180f9fc1,0x6fe03e,0x70203e,0x701fbe,0x6fdfbe,0x180fa0c1,0x6fe0be,0x7020be,0xb101f40,0x1b0fdf40,0x1b6fdf3f,0xb701f3f,0x9102140,0x190fe140,0x196fe13f,0x970213f,0x870603e,0xb101f41,0x1b0fdf41,0x182fe042,0x8302042,0x9102141,0x190fe141,0x192fe0c2,0x93020c2,0xb301fc2,0x1b2fdfc2,0xb705fbe,0x97060be,0x1a6fa03e,
+	17,0xfe040,0x10203f,0xfe03f,0x101fc0,0xfdfc0,0x1020c0,0xfe0c0,0x102041,0xfe041,0x101fbf,0xfdfbf,0x1020bf,0xfe0bf,0x101fc1,0xfdfc1,0x1020c1,0xfe0c1,0x8106040,0x810603f,0x8105fc0,0x81060c0,0x8106041,0x8105fbf,0x180fa040,0x180fa03f,0x81060bf,0x8105fc1,0x81060c1,0x180f9fc0,0x180fa0c0,0x180fa041,0x180f9fbf,0x180fa0bf,0x180f9fc1,0x180fa0c1,0x186fe03e,0x70203e,0x701fbe,0x186fdfbe,0x1b0fdf40,0x3101f40,0x3701f3f,0x1b6fdf3f,0x186fe0be,0x7020be,0x9102140,0x190fe140,0x196fe13f,0x970213f,0x8302042,0x182fe042,0x1b0fdf41,0x3101f41,0xb301fc2,0x1b2fdfc2,0x190fe141,0x9102141,0x93020c2,0x192fe0c2,0x970603e,0x8705fbe,0xb305f40,0xb705f3f,
+	17,0xfe040,0x10203f,0x101fc0,0xfdfc0,0xfe03f,0x1020c0,0xfe0c0,0x102041,0xfe041,0x101fbf,0xfdfbf,0x1020bf,0xfe0bf,0x101fc1,0xfdfc1,0x1020c1,0xfe0c1,0x8106040,0x810603f,0x8105fc0,0x8106041,0x81060c0,0x180fa040,0x8105fbf,0x81060bf,0x8105fc1,0x81060c1,0x180f9fc0,0x180fa03f,0x180fa0c0,0x180fa041,0x180f9fc1,0x180f9fbf,0x180fa0bf,0x180fa0c1,0x1b0fdf40,0x3101f40,0x70203e,0x186fe03e,0x186fdfbe,0x701fbe,0x3701f3f,0x1b6fdf3f,0x1b0fdf41,0x182fe042,0x8302042,0x9102140,0x190fe140,0x186fe0be,0x7020be,0x970213f,0x196fe13f,0x3101f41,0xb301fc2,0x1b2fdfc2,0x182fe0c2,0x83020c2,0x9302141,0x192fe141,0x970603e,0xb305f40,0xb105f3f,0xb705fbe,
+	11,0x10203f,0x101fc0,0x101fbf,0xfdfbf,0xfe03f,0xfe040,0xfdfc0,0x105fc0,0x106040,0x10603f,0x105fbf,0x11020bf,0x11020c0,0x302041,0x301fc1,0x2fdfc1,0x2fe041,0x10fe0c0,0x10fe0bf,0x70203e,0x701fbe,0x3101f3f,0x3101f40,0x30fdf40,0x30fdf3f,0x6fdfbe,0x6fe03e,0x180fa03f,0x180fa040,0x180f9fc0,0x180f9fbf,0x305fc1,0x306041,0x11060c0,0x11060bf,0x70603e,0x705fbe,0x3105f3f,0x3105f40,0x13020c1,0x12fe0c1,0x17020be,0x16fe0be,0x3301f41,0x32fdf41,0x3701f3e,0x36fdf3e,0x182f9fc1,0x182fa041,0x192fa0c0,0x190fa0bf,0x196fa03e,0x186f9fbe,0x1b6f9f3f,0x1b2f9f40,0x93060c1,0xb305f41,0x97060be,0xb705f3e,0xb709fbf,0xb309fc0,0x930a040,0x970a03f,
+	9,0x101fc0,0x101fbf,0x10203f,0xfe040,0xfdfc0,0xfdfbf,0xfe03f,0x106040,0x105fc0,0x105fbf,0x10603f,0x302041,0x301fc1,0x2fdfc1,0x2fe041,0x11020c0,0x11020bf,0x10fe0bf,0x10fe0c0,0x3101f40,0x3101f3f,0x30fdf3f,0x30fdf40,0x701fbe,0x70203e,0x6fe03e,0x6fdfbe,0x180f9fbf,0x180f9fc0,0x180fa040,0x180fa03f,0x306041,0x305fc1,0x11060c0,0x91060bf,0x13020c1,0x12fe0c1,0x3105f40,0xb105f3f,0x8705fbe,0x870603e,0x3301f41,0x32fdf41,0x182f9fc1,0x182fa041,0x16fe0be,0x17020be,0x190fa0bf,0x190fa0c0,0x3701f3e,0x36fdf3e,0x1b0f9f3f,0x1b0f9f40,0x1b6f9fbe,0x196fa03e,0x93060c1,0xb305f41,0x97060be,0xb705f3e,0x192fa0c1,0x1b2f9f41,0xb509fc0,0x950a040,
+	7,0x101fc0,0x101fbf,0x10203f,0xfe040,0xfdfc0,0xfdfbf,0xfe03f,0x302041,0x301fc1,0x105fc0,0x8106040,0x810603f,0x105fbf,0x2fdfc1,0x2fe041,0x11020c0,0x11020bf,0x10fe0c0,0x10fe0bf,0x3101f40,0x3101f3f,0x30fdf40,0x30fdf3f,0x701fbe,0x70203e,0x6fe03e,0x6fdfbe,0x180f9fbf,0x180f9fc0,0x180fa040,0x180fa03f,0x8306041,0x305fc1,0x13020c1,0x91060c0,0x91060bf,0x12fe0c1,0x3301f41,0x3105f40,0x3105f3f,0x32fdf41,0x182f9fc1,0x182fa041,0x870603e,0x705fbe,0x17020be,0x16fe0be,0x190fa0bf,0x190fa0c0,0x93060c1,0x3701f3e,0x36fdf3e,0x1b0f9f3f,0x1b0f9f40,0xb305f41,0x1b6f9fbe,0x196fa03e,0x97060be,0x192fa0c1,0x1b2f9f41,0xb705f3e,0xb709fbf,0xb309fc0,
+	11,0x101fc0,0xfdfc0,0xfe040,0x10203f,0x101fbf,0xfdfbf,0xfe03f,0x102041,0x101fc1,0xfdfc1,0xfe041,0x8106040,0x8105fc0,0x8105fbf,0x810603f,0x11020c0,0x10fe0c0,0x11020bf,0x10fe0bf,0x3101f40,0x30fdf40,0x3101f3f,0x30fdf3f,0x180f9fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x8105fc1,0x8106041,0x11020c1,0x10fe0c1,0x70203e,0x701fbe,0x6fdfbe,0x6fe03e,0x91060c0,0x91060bf,0x3101f41,0x30fdf41,0xb105f40,0xb105f3f,0x180f9fc1,0x180fa041,0x190fa0c0,0x190fa0bf,0x870603e,0x8705fbe,0x93060c1,0xb305f41,0x1b0f9f40,0x1b0f9f3f,0x16fe0be,0x97020be,0xb701f3e,0x36fdf3e,0x1b6f9fbe,0x196fa03e,0x192fa0c1,0x1b2f9f41,0x1b2fdfc2,0xb301fc2,0x9302042,0x192fe042,
+	11,0x101fc0,0xfdfc0,0xfe040,0x10203f,0x101fbf,0xfdfbf,0xfe03f,0x102041,0x101fc1,0xfdfc1,0xfe041,0x8106040,0x8105fc0,0x8105fbf,0x810603f,0x11020c0,0x10fe0c0,0x11020bf,0x10fe0bf,0x3101f40,0x30fdf40,0x3101f3f,0x30fdf3f,0x8105fc1,0x8106041,0x180fa040,0x180f9fc0,0x180f9fbf,0x180fa03f,0x10fe0c1,0x11020c1,0x91060c0,0x3101f41,0x30fdf41,0x701fbe,0x70203e,0x6fe03e,0x6fdfbe,0x91060bf,0xb105f40,0xb105f3f,0x180f9fc1,0x180fa041,0x93060c1,0x190fa0c0,0x190fa0bf,0x870603e,0x8705fbe,0xb305f41,0x1b0f9f40,0x1b0f9f3f,0x16fe0be,0x97020be,0xb701f3e,0x36fdf3e,0x1b6f9fbe,0x192fa0c1,0x192fe042,0x9302042,0xb301fc2,0x1b2fdfc2,0x1b2f9f41,0x196fa03e,
+	11,0x101fc0,0xfdfc0,0xfe040,0x10203f,0x101fbf,0xfdfbf,0xfe03f,0x102041,0x101fc1,0xfdfc1,0xfe041,0x8106040,0x8105fc0,0x8105fbf,0x810603f,0x11020c0,0x10fe0c0,0x11020bf,0x10fe0bf,0x3101f40,0x30fdf40,0x3101f3f,0x30fdf3f,0x8105fc1,0x8106041,0x11020c1,0x10fe0c1,0x180fa040,0x180f9fc0,0x180f9fbf,0x180fa03f,0x3101f41,0x30fdf41,0x180f9fc1,0x180fa041,0x91060c0,0x91060bf,0x70203e,0x701fbe,0x6fdfbe,0x6fe03e,0xb105f40,0xb105f3f,0x93060c1,0xb305f41,0x190fa0c0,0x190fa0bf,0x1b0f9f40,0x1b0f9f3f,0x8705fbe,0x870603e,0x97020be,0x16fe0be,0x192fa0c1,0x192fe042,0x9302042,0xb301fc2,0x1b2fdfc2,0x1b2f9f41,0x36fdf3e,0xb701f3e,0x1b6f9fbe,0x196fa03e,
+	11,0x101fc0,0xfdfc0,0xfe040,0x10203f,0x101fbf,0xfdfbf,0xfe03f,0x102041,0x101fc1,0xfdfc1,0xfe041,0x8106040,0x8105fc0,0x8105fbf,0x810603f,0x11020c0,0x10fe0c0,0x11020bf,0x8106041,0x8105fc1,0x3101f40,0x30fdf40,0x10fe0bf,0x3101f3f,0x30fdf3f,0x180f9fc0,0x180fa040,0x10fe0c1,0x11020c1,0x3101f41,0x30fdf41,0x180f9fbf,0x180fa03f,0x180fa041,0x180f9fc1,0x91060c0,0x91060bf,0xb105f40,0xb105f3f,0x701fbe,0x70203e,0x6fe03e,0x6fdfbe,0x93060c1,0xb305f41,0x190fa0c0,0x190fa0bf,0x1b0f9f40,0x1b0f9f3f,0x1b2fdfc2,0xb301fc2,0x9302042,0x192fe042,0x192fa0c1,0x1b2f9f41,0x8705fbe,0x870603e,0x97020be,0x16fe0be,0xb701f3e,0x36fdf3e,0x1b6f9fbe,0x196fa03e,
+	11,0x101fc0,0xfdfc0,0xfe040,0x10203f,0x101fbf,0xfdfbf,0xfe03f,0x102041,0x101fc1,0xfdfc1,0xfe041,0x8106040,0x8105fc0,0x8105fbf,0x810603f,0x11020c0,0x10fe0c0,0x8106041,0x8105fc1,0x3101f40,0x30fdf40,0x11020bf,0x10fe0bf,0x11020c1,0x10fe0c1,0x180fa040,0x180f9fc0,0x30fdf3f,0x3101f3f,0x3101f41,0x30fdf41,0x180f9fbf,0x180fa03f,0x180fa041,0x180f9fc1,0x91060c0,0x91060bf,0xb105f40,0xb105f3f,0x91060c1,0xb105f41,0x3701fbe,0x70203e,0x186fe03e,0x1b6fdfbe,0x190fa0c0,0x182fe042,0x302042,0x3301fc2,0x1b2fdfc2,0x1b0f9f40,0x1b6f9f3f,0x190fa0bf,0x190fa0c1,0x1b2f9f41,0xb705fbe,0x870603e,0x97020be,0x196fe0be,0x8306042,0xb305fc2,0x93020c2,0x192fe0c2,
+	9,0x10203f,0x101fbf,0x101fc0,0xfe040,0xfe03f,0xfdfbf,0xfdfc0,0x106040,0x10603f,0x105fbf,0x105fc0,0x11020c0,0x11020bf,0x10fe0bf,0x10fe0c0,0x302041,0x301fc1,0x2fdfc1,0x2fe041,0x70203e,0x701fbe,0x6fdfbe,0x6fe03e,0x3101f3f,0x3101f40,0x30fdf40,0x30fdf3f,0x180f9fbf,0x180fa03f,0x180fa040,0x180f9fc0,0x11060c0,0x11060bf,0x306041,0x8305fc1,0x13020c1,0x12fe0c1,0x70603e,0x8705fbe,0xb105f3f,0xb105f40,0x17020be,0x16fe0be,0x190fa0bf,0x190fa0c0,0x32fdf41,0x3301f41,0x182f9fc1,0x182fa041,0x3701f3e,0x36fdf3e,0x186f9fbe,0x186fa03e,0x1b6f9f3f,0x1b2f9f40,0x93060c1,0x97060be,0xb305f41,0xb705f3e,0x192fa0c1,0x196fa0be,0xa70a03f,0xa30a040,
+	10,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0xfdfbf,0x106040,0x10603f,0x105fbf,0x105fc0,0x301fc1,0x302041,0x11020c0,0x11020bf,0x10fe0bf,0x10fe0c0,0x2fe041,0x2fdfc1,0x3101f40,0x3101f3f,0x701fbe,0x70203e,0x6fe03e,0x6fdfbe,0x30fdf3f,0x30fdf40,0x180f9fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x306041,0x8305fc1,0x11060c0,0x11060bf,0x13020c1,0x12fe0c1,0x70603e,0x705fbe,0x3105f3f,0xb105f40,0x3301f41,0x32fdf41,0x182f9fc1,0x182fa041,0x17020be,0x16fe0be,0x190fa0bf,0x190fa0c0,0x93060c1,0x3701f3e,0x36fdf3e,0x186f9fbe,0x196fa03e,0x1b6f9f3f,0x1b2f9f40,0xb305f41,0x97060be,0x192fa0c1,0xb705f3e,0xb709fbf,0x970a03f,0xa30a040,
+	7,0x101fc0,0x10203f,0xfe040,0xfdfc0,0x101fbf,0xfe03f,0xfdfbf,0x302041,0x301fc1,0x105fc0,0x8106040,0x810603f,0x105fbf,0x2fe041,0x2fdfc1,0x11020c0,0x11020bf,0x10fe0c0,0x10fe0bf,0x3101f40,0x30fdf40,0x3101f3f,0x30fdf3f,0x180f9fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x6fdfbe,0x701fbe,0x70203e,0x6fe03e,0x8306041,0x305fc1,0x13020c1,0x91060c0,0x91060bf,0x12fe0c1,0x3301f41,0x3105f40,0x3105f3f,0x32fdf41,0x182f9fc1,0x182fa041,0x190fa0c0,0x190fa0bf,0x870603e,0x705fbe,0x17020be,0x16fe0be,0x93060c1,0xb305f41,0x1b0f9f40,0x1b0f9f3f,0x36fdf3e,0x3701f3e,0x1b6f9fbe,0x196fa03e,0x97060be,0x192fa0c1,0x1b2f9f41,0xb705f3e,0xb709fbf,0xb309fc0,
+	10,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0xfdfc1,0xfe041,0x8106040,0x8105fc0,0x8105fbf,0x810603f,0x11020c0,0x10fe0c0,0x11020bf,0x10fe0bf,0x3101f40,0x30fdf40,0x3101f3f,0x30fdf3f,0x180f9fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x8106041,0x8105fc1,0x11020c1,0x12fe0c1,0x91060c0,0x70203e,0x701fbe,0x6fdfbe,0x6fe03e,0x91060bf,0x3101f41,0x30fdf41,0xb105f40,0xb105f3f,0x180f9fc1,0x182fa041,0x190fa0c0,0x190fa0bf,0x93060c1,0x870603e,0x8705fbe,0x17020be,0x16fe0be,0x1b0f9f40,0x1b0f9f3f,0xb305f41,0xb701f3e,0x36fdf3e,0x1b6f9fbe,0x196fa03e,0x192fa0c1,0x97060be,0x11302042,0xb301fc2,0x1b2fdfc2,0x1b2f9f41,
+	11,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0xfdfc1,0xfe041,0x8106040,0x8105fc0,0x8105fbf,0x810603f,0x11020c0,0x10fe0c0,0x11020bf,0x10fe0bf,0x3101f40,0x30fdf40,0x3101f3f,0x30fdf3f,0x8105fc1,0x8106041,0x11020c1,0x10fe0c1,0x180fa040,0x180f9fc0,0x180f9fbf,0x180fa03f,0x91060c0,0x91060bf,0x70203e,0x701fbe,0x6fdfbe,0x6fe03e,0x3101f41,0x30fdf41,0x180f9fc1,0x180fa041,0xb105f40,0xb105f3f,0x93060c1,0x190fa0c0,0x190fa0bf,0x870603e,0x8705fbe,0x97020be,0x16fe0be,0xb305f41,0x1b0f9f40,0x1b0f9f3f,0x192fa0c1,0x192fe042,0x9302042,0xb301fc2,0x1b2fdfc2,0xb701f3e,0x36fdf3e,0x1b6f9fbe,0x196fa03e,0x1b2f9f41,
+	11,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0xfdfc1,0xfe041,0x8106040,0x8105fc0,0x8105fbf,0x810603f,0x11020c0,0x10fe0c0,0x11020bf,0x10fe0bf,0x8106041,0x8105fc1,0x3101f40,0x30fdf40,0x3101f3f,0x30fdf3f,0x11020c1,0x10fe0c1,0x180fa040,0x180f9fc0,0x180f9fbf,0x180fa03f,0x91060c0,0x91060bf,0x3101f41,0x30fdf41,0x180f9fc1,0x180fa041,0x70203e,0x701fbe,0x6fdfbe,0x6fe03e,0xb105f40,0xb105f3f,0x93060c1,0x190fa0c0,0x190fa0bf,0xb305f41,0x8705fbe,0x870603e,0x97020be,0x16fe0be,0x1b0f9f40,0x1b0f9f3f,0x192fa0c1,0x192fe042,0x9302042,0xb301fc2,0x1b2fdfc2,0x1b2f9f41,0x36fdf3e,0xb701f3e,0x1b6f9fbe,0x196fa03e,
+	11,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0xfdfc1,0xfe041,0x8106040,0x8105fc0,0x11020c0,0x10fe0c0,0x810603f,0x8105fbf,0x11020bf,0x10fe0bf,0x8106041,0x8105fc1,0x11020c1,0x10fe0c1,0x3101f40,0x30fdf40,0x180f9fc0,0x180fa040,0x30fdf3f,0x3101f3f,0x180f9fbf,0x180fa03f,0x91060c0,0x3101f41,0x30fdf41,0x180f9fc1,0x180fa041,0x91060bf,0x93060c1,0xb105f40,0x701fbe,0x70203e,0x6fe03e,0x6fdfbe,0xb105f3f,0xb305f41,0x190fa0c0,0x190fa0bf,0x192fa0c1,0x192fe042,0x9302042,0xb301fc2,0x1b2fdfc2,0x1b0f9f40,0x1b0f9f3f,0x8705fbe,0x870603e,0x97020be,0x16fe0be,0x1b2f9f41,0x36fdf3e,0xb701f3e,0x1b6f9fbe,0x196fa03e,
+	11,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0xfdfc1,0xfe041,0x8106040,0x8105fc0,0x11020c0,0x10fe0c0,0x810603f,0x8105fbf,0x8105fc1,0x8106041,0x11020bf,0x10fe0bf,0x11020c1,0x10fe0c1,0x3101f40,0x30fdf40,0x180f9fc0,0x180fa040,0x30fdf3f,0x3101f3f,0x3101f41,0x30fdf41,0x180f9fbf,0x180fa03f,0x91060c0,0x180fa041,0x180f9fc1,0x91060bf,0x91060c1,0xb105f40,0xb105f3f,0x3701fbe,0x70203e,0x186fe03e,0x1b6fdfbe,0x190fa0c0,0x190fa0bf,0xb105f41,0x3301fc2,0x302042,0x182fe042,0x1b2fdfc2,0x190fa0c1,0x1b0f9f40,0x1b6f9f3f,0x1b2f9f41,0xb705fbe,0x870603e,0x97020be,0x196fe0be,0x8306042,0xb305fc2,0x93020c2,0x192fe0c2,
+	7,0x10203f,0x101fbf,0x101fc0,0xfe040,0xfe03f,0xfdfbf,0xfdfc0,0x11020c0,0x11020bf,0x10603f,0x8106040,0x8105fc0,0x105fbf,0x10fe0bf,0x10fe0c0,0x302041,0x301fc1,0x2fe041,0x2fdfc1,0x70203e,0x701fbe,0x6fe03e,0x6fdfbe,0x3101f3f,0x3101f40,0x30fdf40,0x30fdf3f,0x180f9fbf,0x180fa03f,0x180fa040,0x180f9fc0,0x91060c0,0x11060bf,0x13020c1,0x8306041,0x8305fc1,0x12fe0c1,0x17020be,0x70603e,0x705fbe,0x16fe0be,0x190fa0bf,0x190fa0c0,0xb105f40,0x3105f3f,0x3301f41,0x32fdf41,0x182f9fc1,0x182fa041,0x93060c1,0x3701f3e,0x36fdf3e,0x186f9fbe,0x186fa03e,0x97060be,0x1b6f9f3f,0x1b2f9f40,0xb305f41,0x192fa0c1,0x196fa0be,0xb705f3e,0xb709fbf,0x970a03f,
+	7,0x10203f,0x101fc0,0xfe040,0xfe03f,0x101fbf,0xfdfc0,0xfdfbf,0x11020c0,0x11020bf,0x10603f,0x8106040,0x8105fc0,0x105fbf,0x10fe0c0,0x10fe0bf,0x302041,0x301fc1,0x2fe041,0x2fdfc1,0x70203e,0x6fe03e,0x701fbe,0x6fdfbe,0x180fa03f,0x180fa040,0x180f9fc0,0x180f9fbf,0x30fdf3f,0x3101f3f,0x3101f40,0x30fdf40,0x91060c0,0x11060bf,0x13020c1,0x8306041,0x8305fc1,0x12fe0c1,0x17020be,0x70603e,0x705fbe,0x16fe0be,0x190fa0bf,0x190fa0c0,0x182fa041,0x182f9fc1,0xb105f40,0x3105f3f,0x3301f41,0x32fdf41,0x93060c1,0x97060be,0x186fa03e,0x186f9fbe,0x36fdf3e,0x3701f3e,0x1b6f9f3f,0x1b2f9f40,0xb305f41,0x192fa0c1,0x196fa0be,0xb705f3e,0xb709fbf,0x970a03f,
+	8,0x10203f,0x101fc0,0xfe040,0xfe03f,0x101fbf,0xfdfc0,0xfdfbf,0x102041,0x11020c0,0x8106040,0x810603f,0x11020bf,0x10fe0c0,0xfe041,0x101fc1,0x8105fc0,0x8105fbf,0x10fe0bf,0xfdfc1,0x3101f40,0x3101f3f,0x701fbe,0x70203e,0x6fe03e,0x180fa03f,0x180fa040,0x180f9fc0,0x30fdf40,0x30fdf3f,0x6fdfbe,0x180f9fbf,0x11020c1,0x8106041,0x91060c0,0x91060bf,0x10fe0c1,0x8105fc1,0x3101f41,0xb105f40,0xb105f3f,0x8705fbe,0x870603e,0x17020be,0x16fe0be,0x190fa0bf,0x190fa0c0,0x180fa041,0x180f9fc1,0x30fdf41,0x93060c1,0x97060be,0xb701f3e,0x36fdf3e,0x1b0f9f3f,0x1b2f9f40,0x1b6f9fbe,0x196fa03e,0x192fa0c1,0xb305f41,0xb301fc2,0x9302042,0x192fe042,0x1b2fdfc2,
+	11,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0xfe041,0xfdfc1,0x11020c0,0x8106040,0x8105fc0,0x810603f,0x11020bf,0x10fe0c0,0x10fe0bf,0x8105fbf,0x3101f40,0x30fdf40,0x180f9fc0,0x180fa040,0x10fe0c1,0x11020c1,0x8106041,0x8105fc1,0x3101f3f,0x30fdf3f,0x180f9fbf,0x180fa03f,0x6fe03e,0x70203e,0x91060c0,0x91060bf,0x701fbe,0x6fdfbe,0x3101f41,0x30fdf41,0x180f9fc1,0x180fa041,0x190fa0c0,0x190fa0bf,0x93060c1,0xb105f40,0xb105f3f,0x8705fbe,0x870603e,0x17020be,0x16fe0be,0x192fa0c1,0x1b2f9f40,0x1b0f9f3f,0xb305f41,0xb701f3e,0x36fdf3e,0x1b6f9fbe,0x196fa03e,0x97060be,0x9302042,0xb301fc2,0x1b2fdfc2,0x192fe042,
+	11,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0xfe041,0xfdfc1,0x11020c0,0x8106040,0x8105fc0,0x10fe0c0,0x11020bf,0x810603f,0x8105fbf,0x10fe0bf,0x11020c1,0x8106041,0x8105fc1,0x10fe0c1,0x180fa040,0x180f9fc0,0x30fdf40,0x3101f40,0x3101f3f,0x30fdf3f,0x180f9fbf,0x180fa03f,0x91060c0,0x91060bf,0x70203e,0x701fbe,0x6fe03e,0x6fdfbe,0x3101f41,0x30fdf41,0x180f9fc1,0x180fa041,0x93060c1,0xb105f40,0xb105f3f,0x190fa0c0,0x190fa0bf,0x16fe0be,0x17020be,0x970603e,0x8705fbe,0xb305f41,0x192fa0c1,0x1b0f9f40,0x1b0f9f3f,0x36fdf3e,0xb701f3e,0x1b6f9fbe,0x196fa03e,0x9302042,0xb301fc2,0x1b2fdfc2,0x192fe042,0x1b2f9f41,
+	11,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0xfe041,0xfdfc1,0x11020c0,0x8106040,0x8105fc0,0x10fe0c0,0x11020bf,0x810603f,0x8105fbf,0x10fe0bf,0x11020c1,0x8106041,0x8105fc1,0x10fe0c1,0x180fa040,0x180f9fc0,0x30fdf40,0x3101f40,0x3101f3f,0x30fdf3f,0x180f9fbf,0x180fa03f,0x91060c0,0x91060bf,0x70203e,0x701fbe,0x6fe03e,0x6fdfbe,0x3101f41,0x30fdf41,0x180f9fc1,0x180fa041,0x93060c1,0xb105f40,0xb105f3f,0x190fa0c0,0x190fa0bf,0x192fa0c1,0x16fe0be,0x17020be,0x970603e,0x8705fbe,0xb305f41,0xb301fc2,0x9302042,0x192fe042,0x1b2fdfc2,0x1b0f9f40,0x1b0f9f3f,0x1b2f9f41,0x36fdf3e,0xb701f3e,0x1b6f9fbe,0x196fa03e,
+	11,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0xfe041,0xfdfc1,0x11020c0,0x8106040,0x8105fc0,0x10fe0c0,0x11020bf,0x810603f,0x8105fbf,0x10fe0bf,0x11020c1,0x8106041,0x8105fc1,0x10fe0c1,0x180fa040,0x180f9fc0,0x30fdf40,0x3101f40,0x3101f3f,0x30fdf3f,0x180f9fbf,0x180fa03f,0x91060c0,0x91060bf,0x91060c1,0x3101f41,0x30fdf41,0x180f9fc1,0x180fa041,0x190fa0c0,0x186fe03e,0x70203e,0x3701fbe,0x1b6fdfbe,0xb105f40,0xb105f3f,0x190fa0bf,0x190fa0c1,0xb105f41,0x3301fc2,0x302042,0x182fe042,0x1b2fdfc2,0x1b0f9f40,0x1b6f9f3f,0xb705fbe,0x870603e,0x97020be,0x196fe0be,0x1b2f9f41,0xb305fc2,0x8306042,0x93020c2,0x192fe0c2,
+	11,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0xfe041,0xfdfc1,0x11020c0,0x8106040,0x8105fc0,0x10fe0c0,0x11020bf,0x810603f,0x8105fbf,0x10fe0bf,0x11020c1,0x8106041,0x8105fc1,0x10fe0c1,0x180fa040,0x180f9fc0,0x30fdf40,0x3101f40,0x91060c0,0x91060bf,0x3101f3f,0x30fdf3f,0x180f9fbf,0x180fa03f,0x180fa041,0x180f9fc1,0x30fdf41,0x3101f41,0x91060c1,0xb105f40,0x190fa0c0,0x186fe03e,0x70203e,0x3701fbe,0x1b6fdfbe,0xb105f3f,0xb105f41,0x3301fc2,0x302042,0x182fe042,0x190fa0c1,0x190fa0bf,0x1b2fdfc2,0x1b0f9f40,0x1b6f9f3f,0x1b2f9f41,0x17020be,0x196fe0be,0x970603e,0xb705fbe,0x8306042,0xb305fc2,0x93020c2,0x192fe0c2,
+	11,0x10203f,0xfe03f,0xfe040,0x101fc0,0x101fbf,0xfdfbf,0xfdfc0,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x8106040,0x810603f,0x8105fbf,0x8105fc0,0x302041,0x2fe041,0x301fc1,0x2fdfc1,0x70203e,0x6fe03e,0x701fbe,0x6fdfbe,0x180fa03f,0x180fa040,0x180f9fc0,0x180f9fbf,0x81060bf,0x81060c0,0x3020c1,0x2fe0c1,0x3101f40,0x3101f3f,0x30fdf3f,0x30fdf40,0x8306041,0x8305fc1,0x7020be,0x6fe0be,0x870603e,0x8705fbe,0x180fa0bf,0x180fa0c0,0x182fa041,0x182f9fc1,0xb105f40,0xb105f3f,0x93060c1,0x97060be,0x186fa03e,0x186f9fbe,0x32fdf41,0xb301f41,0xb701f3e,0x36fdf3e,0x1b6f9f3f,0x1b2f9f40,0x192fa0c1,0x196fa0be,0x196fe13f,0x970213f,0x9302140,0x192fe140,
+	10,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x8106040,0x810603f,0x8105fbf,0x8105fc0,0x302041,0x2fe041,0x301fc1,0x2fdfc1,0x70203e,0x6fe03e,0x701fbe,0x6fdfbe,0x180fa03f,0x180fa040,0x180f9fc0,0x180f9fbf,0x81060c0,0x81060bf,0x3020c1,0x12fe0c1,0x8306041,0x3101f40,0x3101f3f,0x30fdf3f,0x30fdf40,0x8305fc1,0x7020be,0x6fe0be,0x870603e,0x8705fbe,0x180fa0bf,0x190fa0c0,0x182fa041,0x182f9fc1,0x93060c1,0xb105f40,0xb105f3f,0x3301f41,0x32fdf41,0x186fa03e,0x186f9fbe,0x97060be,0xb701f3e,0x36fdf3e,0x1b6f9f3f,0x1b2f9f40,0x192fa0c1,0xb305f41,0x11302140,0x970213f,0x196fe13f,0x196fa0be,
+	11,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0xfe0c0,0xfe0bf,0x302041,0x8106040,0x810603f,0x8105fc0,0x301fc1,0x2fe041,0x2fdfc1,0x8105fbf,0x70203e,0x6fe03e,0x180fa03f,0x180fa040,0x2fe0c1,0x3020c1,0x81060c0,0x81060bf,0x701fbe,0x6fdfbe,0x180f9fbf,0x180f9fc0,0x30fdf40,0x3101f40,0x8306041,0x8305fc1,0x3101f3f,0x30fdf3f,0x7020be,0x6fe0be,0x180fa0bf,0x180fa0c0,0x182fa041,0x182f9fc1,0x93060c1,0x870603e,0x8705fbe,0xb105f3f,0xb105f40,0x3301f41,0x32fdf41,0x192fa0c1,0x196fa03e,0x186f9fbe,0x97060be,0xb701f3e,0x36fdf3e,0x1b6f9f3f,0x1b2f9f40,0xb305f41,0x9302140,0x970213f,0x196fe13f,0x192fe140,
+	8,0xfe040,0x10203f,0x101fc0,0xfdfc0,0xfe03f,0x101fbf,0xfdfbf,0x102041,0x11020c0,0x10fe0c0,0xfe041,0x101fc1,0xfdfc1,0x11020bf,0x10fe0bf,0x8106040,0x810603f,0x8105fc0,0x8105fbf,0x11020c1,0x10fe0c1,0x180fa040,0x180f9fc0,0x180fa03f,0x91060c0,0x8106041,0x8105fc1,0x91060bf,0x70203e,0x180f9fbf,0x30fdf40,0x3101f40,0x3101f3f,0x701fbe,0x6fe03e,0x6fdfbe,0x30fdf3f,0x180fa041,0x190fa0c0,0x190fa0bf,0x93060c1,0x180f9fc1,0x30fdf41,0x3101f41,0xb105f40,0xb105f3f,0x17020be,0x16fe0be,0x870603e,0x8705fbe,0x192fa0c1,0x1b2f9f40,0x1b0f9f3f,0x186f9fbe,0x196fa03e,0x97060be,0xb305f41,0xb701f3e,0x1b6fdf3e,0x9302042,0x192fe042,0x1b2fdfc2,0xb301fc2,
+	11,0xfe040,0x101fc0,0xfdfc0,0x10203f,0xfe03f,0x101fbf,0xfdfbf,0x102041,0xfe041,0x101fc1,0xfdfc1,0x11020c0,0x10fe0c0,0x11020bf,0x10fe0bf,0x8106040,0x8105fc0,0x810603f,0x8105fbf,0x11020c1,0x10fe0c1,0x8106041,0x8105fc1,0x91060c0,0x91060bf,0x180fa040,0x180f9fc0,0x180fa03f,0x180f9fbf,0x30fdf40,0x3101f40,0x3101f3f,0x30fdf3f,0x70203e,0x6fe03e,0x701fbe,0x6fdfbe,0x180fa041,0x180f9fc1,0x93060c1,0x190fa0c0,0x190fa0bf,0x3101f41,0x30fdf41,0xb105f40,0xb105f3f,0x17020be,0x16fe0be,0x870603e,0x8705fbe,0x192fa0c1,0xb305f41,0x1b2f9f40,0x1b0f9f3f,0x186f9fbe,0x196fa03e,0x97060be,0x9302042,0x192fe042,0x1b2fdfc2,0xb301fc2,0xb701f3e,0x1b6fdf3e,
+	13,0xfe040,0x101fc0,0xfdfc0,0x10203f,0xfe03f,0x101fbf,0xfdfbf,0x102041,0xfe041,0x101fc1,0xfdfc1,0x1020c0,0xfe0c0,0x1020bf,0x8106040,0x8105fc0,0xfe0bf,0x810603f,0x8105fbf,0x1020c1,0xfe0c1,0x8106041,0x8105fc1,0x81060c0,0x180fa040,0x180f9fc0,0x180fa03f,0x180f9fbf,0x30fdf40,0x3101f40,0x91060bf,0x3101f3f,0x30fdf3f,0x180fa041,0x180f9fc1,0x93060c1,0x70203e,0x6fe03e,0x3701fbe,0x36fdfbe,0x3101f41,0x30fdf41,0x180fa0c0,0x190fa0bf,0xb105f40,0xb105f3f,0x17020be,0x16fe0be,0x192fa0c1,0x870603e,0xb705fbe,0xb305f41,0x9302042,0x192fe042,0x1b2fdfc2,0xb301fc2,0x1b2f9f40,0x1b0f9f3f,0x1b6f9fbe,0x196fa03e,0x97060be,0x9502140,0x194fe140,
+	13,0xfe040,0x101fc0,0xfdfc0,0x10203f,0xfe03f,0x101fbf,0xfdfbf,0x102041,0xfe041,0x101fc1,0xfdfc1,0x1020c0,0xfe0c0,0x8106040,0x8105fc0,0x1020bf,0xfe0bf,0x810603f,0x8105fbf,0x1020c1,0xfe0c1,0x8106041,0x8105fc1,0x81060c0,0x180fa040,0x180f9fc0,0x180fa03f,0x180f9fbf,0x30fdf40,0x3101f40,0x91060bf,0x91060c1,0x3101f3f,0x30fdf3f,0x180fa041,0x180f9fc1,0x30fdf41,0x3101f41,0x180fa0c0,0x186fe03e,0x70203e,0x3701fbe,0x1b6fdfbe,0x190fa0bf,0x190fa0c1,0xb105f40,0xb105f3f,0xb305f41,0x8302042,0x182fe042,0x1b2fdfc2,0xb301fc2,0x17020be,0x196fe0be,0x970603e,0xb705fbe,0x1b0f9f40,0x1b6f9f3f,0x1b2f9f41,0x192fe0c2,0x93020c2,0x9502140,0x194fe140,
+	11,0xfe040,0x101fc0,0xfdfc0,0x10203f,0xfe03f,0x101fbf,0xfdfbf,0x102041,0xfe041,0x101fc1,0xfdfc1,0x11020c0,0x10fe0c0,0x8106040,0x8105fc0,0x11020bf,0x10fe0bf,0x11020c1,0x10fe0c1,0x810603f,0x8105fbf,0x8106041,0x8105fc1,0x91060c0,0x180fa040,0x180f9fc0,0x30fdf40,0x3101f40,0x180fa03f,0x180f9fbf,0x91060bf,0x91060c1,0x180fa041,0x180f9fc1,0x30fdf3f,0x3101f3f,0x3101f41,0x30fdf41,0x190fa0c0,0x190fa0bf,0x186fe03e,0x70203e,0x3701fbe,0x1b6fdfbe,0xb105f40,0xb105f3f,0x190fa0c1,0x182fe042,0x302042,0x3301fc2,0x1b2fdfc2,0xb105f41,0x1b0f9f40,0x196fe0be,0x17020be,0x970603e,0xb705fbe,0x1b6f9f3f,0x1b2f9f41,0x192fe0c2,0x13020c2,0x9306042,0xb305fc2,
+	11,0x10203f,0xfe03f,0xfe040,0x101fc0,0x101fbf,0xfdfbf,0xfdfc0,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x8106040,0x810603f,0x8105fbf,0x8105fc0,0x302041,0x2fe041,0x301fc1,0x2fdfc1,0x70203e,0x6fe03e,0x701fbe,0x6fdfbe,0x81060bf,0x81060c0,0x180fa040,0x180fa03f,0x180f9fbf,0x180f9fc0,0x2fe0c1,0x3020c1,0x8306041,0x7020be,0x6fe0be,0x3101f3f,0x3101f40,0x30fdf40,0x30fdf3f,0x8305fc1,0x870603e,0x8705fbe,0x180fa0bf,0x180fa0c0,0x93060c1,0x182fa041,0x182f9fc1,0xb105f40,0xb105f3f,0x97060be,0x186fa03e,0x186f9fbe,0x32fdf41,0xb301f41,0xb701f3e,0x36fdf3e,0x1b6f9f3f,0x192fa0c1,0x192fe140,0x9302140,0x970213f,0x196fe13f,0x196fa0be,0x1b2f9f40,
+	11,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x8106040,0x810603f,0x8105fbf,0x8105fc0,0x302041,0x2fe041,0x301fc1,0x2fdfc1,0x70203e,0x6fe03e,0x701fbe,0x6fdfbe,0x81060bf,0x81060c0,0x3020c1,0x2fe0c1,0x180fa040,0x180fa03f,0x180f9fbf,0x180f9fc0,0x8306041,0x8305fc1,0x3101f40,0x3101f3f,0x30fdf3f,0x30fdf40,0x7020be,0x6fe0be,0x180fa0bf,0x180fa0c0,0x870603e,0x8705fbe,0x93060c1,0x182fa041,0x182f9fc1,0xb105f40,0xb105f3f,0xb301f41,0x32fdf41,0x97060be,0x186fa03e,0x186f9fbe,0x192fa0c1,0x192fe140,0x9302140,0x970213f,0x196fe13f,0xb701f3e,0x36fdf3e,0x1b6f9f3f,0x1b2f9f40,0x196fa0be,
+	11,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0xfe0c0,0xfe0bf,0x302041,0x8106040,0x810603f,0x2fe041,0x301fc1,0x8105fc0,0x8105fbf,0x2fdfc1,0x3020c1,0x81060c0,0x81060bf,0x2fe0c1,0x180fa040,0x180fa03f,0x6fe03e,0x70203e,0x701fbe,0x6fdfbe,0x180f9fbf,0x180f9fc0,0x8306041,0x8305fc1,0x3101f40,0x3101f3f,0x30fdf40,0x30fdf3f,0x7020be,0x6fe0be,0x180fa0bf,0x180fa0c0,0x93060c1,0x870603e,0x8705fbe,0x182fa041,0x182f9fc1,0x32fdf41,0x3301f41,0xb305f40,0xb105f3f,0x97060be,0x192fa0c1,0x186fa03e,0x186f9fbe,0x36fdf3e,0xb701f3e,0x1b6f9f3f,0x1b2f9f40,0x9302140,0x970213f,0x196fe13f,0x192fe140,0x196fa0be,
+	11,0xfe040,0x10203f,0xfe03f,0x101fc0,0xfdfc0,0x101fbf,0xfdfbf,0x1020c0,0xfe0c0,0x1020bf,0xfe0bf,0x302041,0x2fe041,0x301fc1,0x2fdfc1,0x8106040,0x810603f,0x8105fc0,0x8105fbf,0x3020c1,0x2fe0c1,0x81060c0,0x81060bf,0x8306041,0x8305fc1,0x180fa040,0x180fa03f,0x180f9fc0,0x180f9fbf,0x6fe03e,0x70203e,0x701fbe,0x6fdfbe,0x3101f40,0x30fdf40,0x3101f3f,0x30fdf3f,0x180fa0c0,0x180fa0bf,0x93060c1,0x182fa041,0x182f9fc1,0x7020be,0x6fe0be,0x870603e,0x8705fbe,0x3301f41,0x32fdf41,0xb105f40,0xb105f3f,0x192fa0c1,0x97060be,0x196fa03e,0x186f9fbe,0x1b0f9f3f,0x1b2f9f40,0xb305f41,0x9302140,0x192fe140,0x196fe13f,0x970213f,0xb701f3e,0x1b6fdf3e,
+	11,0xfe040,0x10203f,0x101fc0,0xfdfc0,0xfe03f,0x101fbf,0xfdfbf,0x102041,0x1020c0,0xfe0c0,0xfe041,0x101fc1,0xfdfc1,0x1020bf,0xfe0bf,0x8106040,0x810603f,0x8105fc0,0x8105fbf,0x1020c1,0xfe0c1,0x8106041,0x81060c0,0x81060bf,0x8305fc1,0x180fa040,0x180f9fc0,0x180fa03f,0x180f9fbf,0x30fdf40,0x3101f40,0x3101f3f,0x70203e,0x6fe03e,0x3701fbe,0x6fdfbe,0x36fdf3f,0x93060c1,0x180fa0c0,0x180fa041,0x180f9fc1,0x180fa0bf,0x6fe0be,0x7020be,0x3301f41,0x30fdf41,0xb105f40,0xb105f3f,0x870603e,0xb705fbe,0x192fa0c1,0x192fe140,0x9302140,0x97060be,0x970213f,0x196fe13f,0x196fa03e,0x1b6f9fbe,0x1b4f9f40,0xb305f41,0xa302042,0x192fe042,0x1b2fdfc2,
+	15,0xfe040,0x101fc0,0xfdfc0,0x10203f,0xfe03f,0x101fbf,0xfdfbf,0x102041,0xfe041,0x101fc1,0xfdfc1,0x1020c0,0xfe0c0,0x1020bf,0xfe0bf,0x8106040,0x8105fc0,0x810603f,0x8105fbf,0x1020c1,0xfe0c1,0x8106041,0x8105fc1,0x81060c0,0x81060bf,0x180fa040,0x180f9fc0,0x180fa03f,0x180f9fbf,0x30fdf40,0x3101f40,0x3101f3f,0x30fdf3f,0x93060c1,0x180fa041,0x180f9fc1,0x180fa0c0,0x186fe03e,0x70203e,0x3701fbe,0x1b6fdfbe,0x180fa0bf,0x3101f41,0x30fdf41,0x192fa0c1,0x186fe0be,0x7020be,0xb105f40,0xb105f3f,0x870603e,0xb705fbe,0xb305f41,0x9302042,0x192fe042,0x1b2fdfc2,0xb301fc2,0x1b2f9f40,0x1b6f9f3f,0x9302140,0x192fe140,0x196fe13f,0x970213f,0x97060be,
+	15,0xfe040,0x101fc0,0xfdfc0,0x10203f,0xfe03f,0x101fbf,0xfdfbf,0x102041,0xfe041,0x101fc1,0xfdfc1,0x1020c0,0xfe0c0,0x1020bf,0xfe0bf,0x8106040,0x8105fc0,0x810603f,0x1020c1,0xfe0c1,0x8105fbf,0x8106041,0x8105fc1,0x81060c0,0x81060bf,0x180fa040,0x180f9fc0,0x180fa03f,0x180f9fbf,0x30fdf40,0x3101f40,0x91060c1,0x180fa041,0x180f9fc1,0x30fdf3f,0x3101f3f,0x180fa0c0,0x180fa0bf,0x186fe03e,0x70203e,0x3701fbe,0x1b6fdfbe,0x3101f41,0x30fdf41,0x190fa0c1,0xb105f40,0xb105f3f,0x7020be,0x186fe0be,0x8302042,0x182fe042,0x1b2fdfc2,0xb301fc2,0xb305f41,0x970603e,0xb705fbe,0x9302140,0x192fe140,0x196fe13f,0x970213f,0x93020c2,0x192fe0c2,0x1b4f9f40,
+	13,0xfe040,0x101fc0,0xfdfc0,0x10203f,0xfe03f,0x101fbf,0x102041,0xfe041,0xfdfbf,0x101fc1,0xfdfc1,0x1020c0,0xfe0c0,0x1020bf,0x8106040,0x8105fc0,0xfe0bf,0x1020c1,0xfe0c1,0x810603f,0x8105fbf,0x8106041,0x8105fc1,0x81060c0,0x180fa040,0x180f9fc0,0x180fa03f,0x91060bf,0x91060c1,0x180fa041,0x180f9fc1,0x180f9fbf,0x30fdf40,0x3101f40,0x3101f3f,0x30fdf3f,0x180fa0c0,0x190fa0bf,0x3101f41,0x30fdf41,0x190fa0c1,0x186fe03e,0x70203e,0x3701fbe,0x1b6fdfbe,0xb105f40,0x302042,0x182fe042,0x1b2fdfc2,0x3301fc2,0xb305f41,0xb105f3f,0x17020be,0x196fe0be,0x970603e,0xb705fbe,0x13020c2,0x192fe0c2,0x9502140,0x194fe140,0x1b2f9f40,0x1b6f9f3f,0xa306042,
+	11,0x10203f,0xfe03f,0xfe040,0x101fc0,0x101fbf,0xfdfbf,0xfdfc0,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x8106040,0x810603f,0x8105fbf,0x8105fc0,0x302041,0x2fe041,0x301fc1,0x2fdfc1,0x70203e,0x6fe03e,0x701fbe,0x6fdfbe,0x81060bf,0x81060c0,0x3020c1,0x2fe0c1,0x180fa040,0x180fa03f,0x180f9fbf,0x180f9fc0,0x7020be,0x6fe0be,0x180fa0bf,0x180fa0c0,0x8306041,0x8305fc1,0x3101f40,0x3101f3f,0x30fdf3f,0x30fdf40,0x870603e,0x8705fbe,0x93060c1,0x97060be,0x182fa041,0x182f9fc1,0x186fa03e,0x186f9fbe,0xb105f3f,0xb105f40,0xb301f41,0x32fdf41,0x192fa0c1,0x192fe140,0x9302140,0x970213f,0x196fe13f,0x196fa0be,0x36fdf3e,0xb701f3e,0x1b6f9f3f,0x1b2f9f40,
+	11,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x8106040,0x810603f,0x8105fbf,0x8105fc0,0x302041,0x2fe041,0x301fc1,0x2fdfc1,0x81060c0,0x81060bf,0x70203e,0x6fe03e,0x701fbe,0x6fdfbe,0x3020c1,0x2fe0c1,0x180fa040,0x180fa03f,0x180f9fbf,0x180f9fc0,0x8306041,0x8305fc1,0x7020be,0x6fe0be,0x180fa0bf,0x180fa0c0,0x3101f40,0x3101f3f,0x30fdf3f,0x30fdf40,0x870603e,0x8705fbe,0x93060c1,0x182fa041,0x182f9fc1,0x97060be,0xb105f3f,0xb105f40,0xb301f41,0x32fdf41,0x186fa03e,0x186f9fbe,0x192fa0c1,0x192fe140,0x9302140,0x970213f,0x196fe13f,0x196fa0be,0x36fdf3e,0xb701f3e,0x1b6f9f3f,0x1b2f9f40,
+	11,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0xfe0c0,0xfe0bf,0x302041,0x8106040,0x810603f,0x2fe041,0x301fc1,0x8105fc0,0x8105fbf,0x2fdfc1,0x3020c1,0x81060c0,0x81060bf,0x2fe0c1,0x180fa040,0x180fa03f,0x6fe03e,0x70203e,0x701fbe,0x6fdfbe,0x180f9fbf,0x180f9fc0,0x8306041,0x8305fc1,0x3101f40,0x3101f3f,0x30fdf40,0x30fdf3f,0x7020be,0x6fe0be,0x180fa0bf,0x180fa0c0,0x93060c1,0x870603e,0x8705fbe,0x182fa041,0x182f9fc1,0x192fa0c1,0x32fdf41,0x3301f41,0xb305f40,0xb105f3f,0x97060be,0x970213f,0x9302140,0x192fe140,0x196fe13f,0x186fa03e,0x186f9fbe,0x196fa0be,0x36fdf3e,0xb701f3e,0x1b6f9f3f,0x1b2f9f40,
+	13,0xfe040,0x10203f,0xfe03f,0x101fc0,0xfdfc0,0x101fbf,0xfdfbf,0x1020c0,0xfe0c0,0x1020bf,0xfe0bf,0x102041,0xfe041,0x101fc1,0x8106040,0x810603f,0xfdfc1,0x8105fc0,0x8105fbf,0x1020c1,0xfe0c1,0x81060c0,0x81060bf,0x8106041,0x180fa040,0x180fa03f,0x180f9fc0,0x180f9fbf,0x6fe03e,0x70203e,0x8305fc1,0x701fbe,0x6fdfbe,0x180fa0c0,0x180fa0bf,0x93060c1,0x3101f40,0x30fdf40,0x3701f3f,0x36fdf3f,0x7020be,0x6fe0be,0x180fa041,0x182f9fc1,0x870603e,0x8705fbe,0x3301f41,0x32fdf41,0x192fa0c1,0xb105f40,0xb705f3f,0x97060be,0x9302140,0x192fe140,0x196fe13f,0x970213f,0x196fa03e,0x186f9fbe,0x1b6f9f3f,0x1b2f9f40,0xb305f41,0xa302042,0x1a2fe042,
+	15,0xfe040,0x10203f,0xfe03f,0x101fc0,0xfdfc0,0x101fbf,0xfdfbf,0x1020c0,0xfe0c0,0x1020bf,0xfe0bf,0x102041,0xfe041,0x101fc1,0xfdfc1,0x8106040,0x810603f,0x8105fc0,0x8105fbf,0x1020c1,0xfe0c1,0x81060c0,0x81060bf,0x8106041,0x8105fc1,0x180fa040,0x180fa03f,0x180f9fc0,0x180f9fbf,0x6fe03e,0x70203e,0x701fbe,0x6fdfbe,0x93060c1,0x180fa0c0,0x180fa0bf,0x180fa041,0x1b0fdf40,0x3101f40,0x3701f3f,0x1b6fdf3f,0x180f9fc1,0x7020be,0x6fe0be,0x192fa0c1,0x1b0fdf41,0x3101f41,0x870603e,0x8705fbe,0xb105f40,0xb705f3f,0x97060be,0x9302140,0x192fe140,0x196fe13f,0x970213f,0x196fa03e,0x1b6f9fbe,0x9302042,0x192fe042,0x1b2fdfc2,0xb301fc2,0xb305f41,
+	15,0xfe040,0x10203f,0x101fc0,0xfdfc0,0xfe03f,0x101fbf,0xfdfbf,0x102041,0x1020c0,0xfe0c0,0xfe041,0x101fc1,0xfdfc1,0x1020bf,0xfe0bf,0x8106040,0x810603f,0x8105fc0,0x1020c1,0xfe0c1,0x8105fbf,0x8106041,0x81060c0,0x81060bf,0x8105fc1,0x180fa040,0x180f9fc0,0x180fa03f,0x180f9fbf,0x93060c1,0x180fa0c0,0x180fa041,0x180f9fc1,0x1b0fdf40,0x3101f40,0x70203e,0x6fe03e,0x180fa0bf,0x6fdfbe,0x701fbe,0x3701f3f,0x1b6fdf3f,0x3101f41,0x1b0fdf41,0x192fa0c1,0x6fe0be,0x7020be,0x870603e,0xb105f40,0xb105f3f,0xb705fbe,0x9302140,0x192fe140,0x9302042,0x192fe042,0x1b2fdfc2,0xb301fc2,0xb305f41,0x970213f,0x196fe13f,0x97060be,0x196fa03e,0x1b6f9fbe,
+	15,0xfe040,0x101fc0,0xfdfc0,0x10203f,0xfe03f,0x101fbf,0xfdfbf,0x102041,0xfe041,0x1020c0,0xfe0c0,0x101fc1,0xfdfc1,0x1020bf,0xfe0bf,0x8106040,0x1020c1,0xfe0c1,0x8105fc0,0x810603f,0x8105fbf,0x8106041,0x81060c0,0x8105fc1,0x81060bf,0x180fa040,0x180f9fc0,0x180fa03f,0x180f9fbf,0x81060c1,0x180fa041,0x180fa0c0,0x180f9fc1,0x1b0fdf40,0x3101f40,0x3101f3f,0x1b0fdf3f,0x180fa0bf,0x186fe03e,0x70203e,0x3701fbe,0x1b6fdfbe,0x190fa0c1,0x1b0fdf41,0x3101f41,0xb105f40,0x7020be,0x186fe0be,0x8302042,0x182fe042,0x1b2fdfc2,0xb301fc2,0xb105f3f,0x970603e,0xb705fbe,0x9102140,0x190fe140,0x196fe13f,0x970213f,0xb305f41,0x83020c2,0x192fe0c2,0x11302141,
+	16,0xfe040,0x101fc0,0xfdfc0,0x10203f,0xfe03f,0x102041,0xfe041,0x101fbf,0xfdfbf,0x101fc1,0xfdfc1,0x1020c0,0xfe0c0,0x1020bf,0xfe0bf,0x1020c1,0x8106040,0xfe0c1,0x8105fc0,0x810603f,0x8106041,0x8105fbf,0x8105fc1,0x81060c0,0x81060bf,0x180fa040,0x180f9fc0,0x81060c1,0x180fa03f,0x180fa041,0x180f9fc1,0x180f9fbf,0x180fa0c0,0x3101f40,0x1b0fdf40,0x3101f3f,0x1b0fdf3f,0x180fa0bf,0x190fa0c1,0x1b0fdf41,0x3101f41,0x70203e,0x186fe03e,0x1b6fdfbe,0x3701fbe,0x8302042,0x182fe042,0x1b2fdfc2,0xb301fc2,0xb105f40,0xb105f3f,0x7020be,0x186fe0be,0x9102140,0x190fe140,0x83020c2,0x192fe0c2,0xb305f41,0x970603e,0xb705fbe,0x970213f,0x196fe13f,0x11302141,
+	11,0x10203f,0xfe03f,0xfe040,0x101fc0,0x101fbf,0xfdfbf,0xfdfc0,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x8106040,0x810603f,0x8105fbf,0x8105fc0,0x302041,0x2fe041,0x301fc1,0x81060c0,0x81060bf,0x70203e,0x6fe03e,0x2fdfc1,0x701fbe,0x6fdfbe,0x180fa03f,0x180fa040,0x2fe0c1,0x3020c1,0x7020be,0x6fe0be,0x180f9fbf,0x180f9fc0,0x180fa0c0,0x180fa0bf,0x8306041,0x8305fc1,0x870603e,0x8705fbe,0x3101f3f,0x3101f40,0x30fdf40,0x30fdf3f,0x93060c1,0x97060be,0x182fa041,0x182f9fc1,0x186fa03e,0x186f9fbe,0x196fe13f,0x970213f,0x9302140,0x192fe140,0x192fa0c1,0x196fa0be,0xb105f3f,0xb105f40,0xb301f41,0x32fdf41,0xb701f3e,0x36fdf3e,0x1b6f9f3f,0x1b2f9f40,
+	11,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x8106040,0x810603f,0x302041,0x2fe041,0x8105fc0,0x8105fbf,0x301fc1,0x2fdfc1,0x81060c0,0x81060bf,0x3020c1,0x2fe0c1,0x70203e,0x6fe03e,0x180fa03f,0x180fa040,0x6fdfbe,0x701fbe,0x180f9fbf,0x180f9fc0,0x8306041,0x7020be,0x6fe0be,0x180fa0bf,0x180fa0c0,0x8305fc1,0x93060c1,0x870603e,0x3101f3f,0x3101f40,0x30fdf40,0x30fdf3f,0x8705fbe,0x97060be,0x182fa041,0x182f9fc1,0x192fa0c1,0x192fe140,0x9302140,0x970213f,0x196fe13f,0x186fa03e,0x186f9fbe,0xb105f3f,0xb105f40,0xb301f41,0x32fdf41,0x196fa0be,0x36fdf3e,0xb701f3e,0x1b6f9f3f,0x1b2f9f40,
+	11,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0xfe0c0,0xfe0bf,0x302041,0x8106040,0x810603f,0x2fe041,0x301fc1,0x8105fc0,0x8105fbf,0x2fdfc1,0x3020c1,0x81060c0,0x81060bf,0x2fe0c1,0x180fa040,0x180fa03f,0x6fe03e,0x70203e,0x701fbe,0x6fdfbe,0x180f9fbf,0x180f9fc0,0x8306041,0x8305fc1,0x83060c1,0x7020be,0x6fe0be,0x180fa0bf,0x180fa0c0,0x182fa041,0x1b0fdf40,0x3101f40,0x3701f3f,0x1b6fdf3f,0x870603e,0x8705fbe,0x182f9fc1,0x182fa0c1,0x87060be,0x170213f,0x1102140,0x190fe140,0x196fe13f,0x186fa03e,0x1b6f9fbe,0xb705f3f,0xb105f40,0xb301f41,0x1b2fdf41,0x196fa0be,0x970613f,0x9106140,0x9302141,0x192fe141,
+	13,0xfe040,0x10203f,0xfe03f,0x101fc0,0xfdfc0,0x101fbf,0xfdfbf,0x1020c0,0xfe0c0,0x1020bf,0xfe0bf,0x102041,0xfe041,0x8106040,0x810603f,0x101fc1,0xfdfc1,0x8105fc0,0x8105fbf,0x1020c1,0xfe0c1,0x81060c0,0x81060bf,0x8106041,0x180fa040,0x180fa03f,0x180f9fc0,0x180f9fbf,0x6fe03e,0x70203e,0x8305fc1,0x83060c1,0x701fbe,0x6fdfbe,0x180fa0c0,0x180fa0bf,0x6fe0be,0x7020be,0x180fa041,0x1b0fdf40,0x3101f40,0x3701f3f,0x1b6fdf3f,0x182f9fc1,0x182fa0c1,0x870603e,0x8705fbe,0x97060be,0x9102140,0x190fe140,0x196fe13f,0x970213f,0x3301f41,0x1b2fdf41,0xb305f40,0xb705f3f,0x186fa03e,0x1b6f9fbe,0x196fa0be,0x192fe141,0x9302141,0xa302042,0x1a2fe042,
+	15,0xfe040,0x10203f,0xfe03f,0x101fc0,0xfdfc0,0x101fbf,0xfdfbf,0x1020c0,0xfe0c0,0x1020bf,0xfe0bf,0x102041,0xfe041,0x101fc1,0xfdfc1,0x8106040,0x810603f,0x8105fc0,0x1020c1,0xfe0c1,0x8105fbf,0x81060c0,0x81060bf,0x8106041,0x8105fc1,0x180fa040,0x180fa03f,0x180f9fc0,0x180f9fbf,0x6fe03e,0x70203e,0x83060c1,0x180fa0c0,0x180fa0bf,0x6fdfbe,0x701fbe,0x180fa041,0x180f9fc1,0x1b0fdf40,0x3101f40,0x3701f3f,0x1b6fdf3f,0x7020be,0x6fe0be,0x182fa0c1,0x870603e,0x8705fbe,0x3101f41,0x1b0fdf41,0x9102140,0x190fe140,0x196fe13f,0x970213f,0x97060be,0xb305f40,0xb705f3f,0x9302042,0x192fe042,0x1b2fdfc2,0xb301fc2,0x9302141,0x192fe141,0x1a6fa03e,
+	15,0xfe040,0x10203f,0xfe03f,0x101fc0,0xfdfc0,0x101fbf,0xfdfbf,0x1020c0,0xfe0c0,0x102041,0xfe041,0x1020bf,0xfe0bf,0x101fc1,0xfdfc1,0x8106040,0x1020c1,0xfe0c1,0x810603f,0x8105fc0,0x8105fbf,0x81060c0,0x8106041,0x81060bf,0x8105fc1,0x180fa040,0x180fa03f,0x180f9fc0,0x180f9fbf,0x81060c1,0x180fa0c0,0x180fa041,0x180fa0bf,0x186fe03e,0x70203e,0x701fbe,0x186fdfbe,0x180f9fc1,0x1b0fdf40,0x3101f40,0x3701f3f,0x1b6fdf3f,0x182fa0c1,0x186fe0be,0x7020be,0x870603e,0x3101f41,0x1b0fdf41,0x9102140,0x190fe140,0x196fe13f,0x970213f,0x8705fbe,0xb305f40,0xb705f3f,0x8302042,0x182fe042,0x1b2fdfc2,0xb301fc2,0x97060be,0x9102141,0x192fe141,0x113020c2,
+	17,0xfe040,0x10203f,0x101fc0,0xfdfc0,0xfe03f,0x101fbf,0xfdfbf,0x102041,0x1020c0,0xfe0c0,0xfe041,0x101fc1,0xfdfc1,0x1020bf,0xfe0bf,0x1020c1,0xfe0c1,0x8106040,0x810603f,0x8105fc0,0x8105fbf,0x8106041,0x81060c0,0x81060bf,0x8105fc1,0x180fa040,0x180f9fc0,0x180fa03f,0x81060c1,0x180fa0c0,0x180fa041,0x180f9fbf,0x180f9fc1,0x180fa0bf,0x186fe03e,0x70203e,0x3101f40,0x1b0fdf40,0x3101f3f,0x3701fbe,0x186fdfbe,0x1b6fdf3f,0x180fa0c1,0x1b0fdf41,0x3101f41,0x7020be,0x186fe0be,0x9102140,0x190fe140,0x8302042,0x182fe042,0x1b2fdfc2,0xb301fc2,0xb305f40,0x970603e,0x970213f,0x196fe13f,0x9102141,0x190fe141,0x93020c2,0x192fe0c2,0xb105f3f,0xb705fbe,
+	17,0xfe040,0x101fc0,0xfdfc0,0x10203f,0xfe03f,0x102041,0xfe041,0x1020c0,0xfe0c0,0x101fbf,0xfdfbf,0x101fc1,0xfdfc1,0x1020bf,0xfe0bf,0x1020c1,0xfe0c1,0x8106040,0x8105fc0,0x810603f,0x8106041,0x81060c0,0x8105fbf,0x8105fc1,0x81060bf,0x81060c1,0x180fa040,0x180f9fc0,0x180fa03f,0x180fa041,0x180fa0c0,0x180f9fbf,0x180f9fc1,0x180fa0bf,0x180fa0c1,0x3101f40,0x1b0fdf40,0x1b0fdf3f,0x3101f3f,0x70203e,0x186fe03e,0x1b6fdfbe,0x3701fbe,0x3101f41,0x1b0fdf41,0x8302042,0x182fe042,0x1b2fdfc2,0xb301fc2,0x9102140,0x190fe140,0x7020be,0x186fe0be,0x970213f,0x196fe13f,0x83020c2,0x182fe0c2,0x9302141,0x192fe141,0xb305f40,0xb105f3f,0x970603e,0xb705fbe,
+	11,0x10203f,0xfe03f,0xfe040,0x101fc0,0x101fbf,0xfdfbf,0xfdfc0,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x8106040,0x810603f,0x8105fbf,0x8105fc0,0x302041,0x2fe041,0x81060c0,0x81060bf,0x70203e,0x6fe03e,0x301fc1,0x2fdfc1,0x3020c1,0x2fe0c1,0x180fa040,0x180fa03f,0x6fdfbe,0x701fbe,0x7020be,0x6fe0be,0x180f9fbf,0x180f9fc0,0x180fa0c0,0x180fa0bf,0x8306041,0x8305fc1,0x870603e,0x8705fbe,0x83060c1,0x87060be,0x3701f3f,0x3101f40,0x1b0fdf40,0x1b6fdf3f,0x182fa041,0x190fe140,0x1102140,0x170213f,0x196fe13f,0x186fa03e,0x1b6f9fbe,0x182f9fc1,0x182fa0c1,0x196fa0be,0xb705f3f,0xb105f40,0xb301f41,0x1b2fdf41,0x9106140,0x970613f,0x9302141,0x192fe141,
+	11,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x8106040,0x810603f,0x302041,0x2fe041,0x8105fc0,0x8105fbf,0x81060bf,0x81060c0,0x301fc1,0x2fdfc1,0x3020c1,0x2fe0c1,0x70203e,0x6fe03e,0x180fa03f,0x180fa040,0x6fdfbe,0x701fbe,0x7020be,0x6fe0be,0x180f9fbf,0x180f9fc0,0x8306041,0x180fa0c0,0x180fa0bf,0x8305fc1,0x83060c1,0x870603e,0x8705fbe,0x3701f3f,0x3101f40,0x1b0fdf40,0x1b6fdf3f,0x182fa041,0x182f9fc1,0x87060be,0x170213f,0x1102140,0x190fe140,0x196fe13f,0x182fa0c1,0x186fa03e,0x1b6f9fbe,0x196fa0be,0xb705f3f,0xb105f40,0xb301f41,0x1b2fdf41,0x9106140,0x970613f,0x9302141,0x192fe141,
+	11,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0xfe0c0,0xfe0bf,0x302041,0x8106040,0x810603f,0x2fe041,0x301fc1,0x8105fc0,0x8105fbf,0x2fdfc1,0x3020c1,0x81060c0,0x81060bf,0x2fe0c1,0x180fa040,0x180fa03f,0x6fe03e,0x70203e,0x8306041,0x8305fc1,0x701fbe,0x6fdfbe,0x180f9fbf,0x180f9fc0,0x180fa0c0,0x180fa0bf,0x6fe0be,0x7020be,0x83060c1,0x870603e,0x182fa041,0x1b0fdf40,0x3101f40,0x3701f3f,0x1b6fdf3f,0x8705fbe,0x87060be,0x170213f,0x1102140,0x190fe140,0x182fa0c1,0x182f9fc1,0x196fe13f,0x186fa03e,0x1b6f9fbe,0x196fa0be,0x3301f41,0x1b2fdf41,0xb305f40,0xb705f3f,0x9106140,0x970613f,0x9302141,0x192fe141,
+	11,0xfe040,0x10203f,0xfe03f,0x101fc0,0xfdfc0,0x101fbf,0xfdfbf,0x1020c0,0xfe0c0,0x1020bf,0xfe0bf,0x302041,0x2fe041,0x8106040,0x810603f,0x301fc1,0x2fdfc1,0x3020c1,0x2fe0c1,0x8105fc0,0x8105fbf,0x81060c0,0x81060bf,0x8306041,0x180fa040,0x180fa03f,0x6fe03e,0x70203e,0x180f9fc0,0x180f9fbf,0x8305fc1,0x83060c1,0x180fa0c0,0x180fa0bf,0x6fdfbe,0x701fbe,0x7020be,0x6fe0be,0x182fa041,0x182f9fc1,0x1b0fdf40,0x3101f40,0x3701f3f,0x1b6fdf3f,0x870603e,0x8705fbe,0x182fa0c1,0x190fe140,0x1102140,0x170213f,0x196fe13f,0x87060be,0x186fa03e,0x1b2fdf41,0x3301f41,0xb305f40,0xb705f3f,0x1b6f9fbe,0x196fa0be,0x192fe141,0x1302141,0x9306140,0x970613f,
+	13,0xfe040,0x10203f,0xfe03f,0x101fc0,0xfdfc0,0x101fbf,0x1020c0,0xfe0c0,0xfdfbf,0x1020bf,0xfe0bf,0x102041,0xfe041,0x101fc1,0x8106040,0x810603f,0xfdfc1,0x1020c1,0xfe0c1,0x8105fc0,0x8105fbf,0x81060c0,0x81060bf,0x8106041,0x180fa040,0x180fa03f,0x180f9fc0,0x8305fc1,0x83060c1,0x180fa0c0,0x180fa0bf,0x180f9fbf,0x6fe03e,0x70203e,0x701fbe,0x6fdfbe,0x180fa041,0x182f9fc1,0x7020be,0x6fe0be,0x182fa0c1,0x1b0fdf40,0x3101f40,0x3701f3f,0x1b6fdf3f,0x870603e,0x1102140,0x190fe140,0x196fe13f,0x170213f,0x97060be,0x8705fbe,0x3301f41,0x1b2fdf41,0xb305f40,0xb705f3f,0x1302141,0x192fe141,0xa302042,0x1a2fe042,0x196fa03e,0x1b6f9fbe,0x9506140,
+	16,0xfe040,0x10203f,0xfe03f,0x101fc0,0xfdfc0,0x1020c0,0xfe0c0,0x101fbf,0xfdfbf,0x1020bf,0xfe0bf,0x102041,0xfe041,0x101fc1,0xfdfc1,0x1020c1,0x8106040,0xfe0c1,0x810603f,0x8105fc0,0x81060c0,0x8105fbf,0x81060bf,0x8106041,0x8105fc1,0x180fa040,0x180fa03f,0x81060c1,0x180f9fc0,0x180fa0c0,0x180fa0bf,0x180f9fbf,0x180fa041,0x70203e,0x186fe03e,0x701fbe,0x186fdfbe,0x180f9fc1,0x182fa0c1,0x186fe0be,0x7020be,0x3101f40,0x1b0fdf40,0x1b6fdf3f,0x3701f3f,0x9102140,0x190fe140,0x196fe13f,0x970213f,0x870603e,0x8705fbe,0x3101f41,0x1b0fdf41,0x8302042,0x182fe042,0x9102141,0x192fe141,0x97060be,0xb305f40,0xb705f3f,0xb301fc2,0x1b2fdfc2,0x113020c2,
+	17,0xfe040,0x10203f,0xfe03f,0x101fc0,0xfdfc0,0x1020c0,0xfe0c0,0x102041,0xfe041,0x101fbf,0xfdfbf,0x1020bf,0xfe0bf,0x101fc1,0xfdfc1,0x1020c1,0xfe0c1,0x8106040,0x810603f,0x8105fc0,0x81060c0,0x8106041,0x8105fbf,0x81060bf,0x8105fc1,0x81060c1,0x180fa040,0x180fa03f,0x180f9fc0,0x180fa0c0,0x180fa041,0x180f9fbf,0x180fa0bf,0x180f9fc1,0x180fa0c1,0x70203e,0x186fe03e,0x186fdfbe,0x701fbe,0x3101f40,0x1b0fdf40,0x1b6fdf3f,0x3701f3f,0x7020be,0x186fe0be,0x9102140,0x190fe140,0x196fe13f,0x970213f,0x8302042,0x182fe042,0x3101f41,0x1b0fdf41,0xb301fc2,0x1b2fdfc2,0x9102141,0x190fe141,0x93020c2,0x192fe0c2,0x970603e,0x8705fbe,0xb305f40,0xb705f3f,
+	17,0xfe040,0x10203f,0x101fc0,0xfdfc0,0xfe03f,0x1020c0,0x102041,0xfe041,0xfe0c0,0x101fbf,0xfdfbf,0x1020bf,0xfe0bf,0x101fc1,0xfdfc1,0x1020c1,0xfe0c1,0x8106040,0x810603f,0x8105fc0,0x8106041,0x81060c0,0x8105fbf,0x81060bf,0x8105fc1,0x81060c1,0x180fa040,0x180f9fc0,0x180fa03f,0x180fa0c0,0x180fa041,0x180f9fc1,0x180f9fbf,0x180fa0bf,0x180fa0c1,0x1b0fdf40,0x3101f40,0x70203e,0x186fe03e,0x186fdfbe,0x701fbe,0x3701f3f,0x1b6fdf3f,0x8302042,0x182fe042,0x9102140,0x190fe140,0x7020be,0x186fe0be,0x970213f,0x196fe13f,0x3101f41,0x1b0fdf41,0xb301fc2,0x1b2fdfc2,0x83020c2,0x182fe0c2,0x9302141,0x192fe141,0x970603e,0xb305f40,0xb105f3f,0xb705fbe,
+	11,0x10203f,0x101fc0,0x101fbf,0xfdfbf,0xfe03f,0xfe040,0xfdfc0,0x105fc0,0x106040,0x10603f,0x105fbf,0x11020bf,0x11020c0,0x302041,0x301fc1,0x2fdfc1,0x2fe041,0x10fe0c0,0x10fe0bf,0x70203e,0x701fbe,0x3101f3f,0x3101f40,0x30fdf40,0x30fdf3f,0x6fdfbe,0x6fe03e,0x180fa03f,0x180fa040,0x180f9fc0,0x180f9fbf,0x305fc1,0x306041,0x11060c0,0x11060bf,0x70603e,0x705fbe,0x3105f3f,0x3105f40,0x13020c1,0x12fe0c1,0x17020be,0x16fe0be,0x3301f41,0x32fdf41,0x3701f3e,0x36fdf3e,0x182f9fc1,0x182fa041,0x192fa0c0,0x190fa0bf,0x196fa03e,0x186f9fbe,0x1b6f9f3f,0x1b2f9f40,0x93060c1,0xb305f41,0x97060be,0xb705f3e,0xb709fbf,0xb309fc0,0x930a040,0x970a03f,
+	11,0x101fc0,0x101fbf,0x10203f,0xfe040,0xfdfc0,0xfdfbf,0xfe03f,0x106040,0x105fc0,0x105fbf,0x10603f,0x302041,0x301fc1,0x2fdfc1,0x2fe041,0x11020c0,0x11020bf,0x10fe0bf,0x10fe0c0,0x3101f40,0x3101f3f,0x30fdf3f,0x30fdf40,0x701fbe,0x70203e,0x6fe03e,0x6fdfbe,0x180f9fbf,0x180f9fc0,0x180fa040,0x180fa03f,0x306041,0x305fc1,0x11060c0,0x11060bf,0x3105f40,0x3105f3f,0x705fbe,0x70603e,0x13020c1,0x12fe0c1,0x3301f41,0x32fdf41,0x182f9fc1,0x182fa041,0x17020be,0x16fe0be,0x3701f3e,0x36fdf3e,0x190fa0bf,0x192fa0c0,0x93060c1,0xb305f41,0x1b2f9f40,0x1b0f9f3f,0x1b6f9fbe,0x196fa03e,0x97060be,0xb705f3e,0xb709fbf,0xb309fc0,0x930a040,0x970a03f,
+	11,0x101fc0,0x101fbf,0x10203f,0xfe040,0xfdfc0,0xfdfbf,0xfe03f,0x106040,0x105fc0,0x105fbf,0x10603f,0x302041,0x301fc1,0x2fdfc1,0x2fe041,0x11020c0,0x11020bf,0x10fe0c0,0x10fe0bf,0x3101f40,0x3101f3f,0x30fdf40,0x30fdf3f,0x701fbe,0x70203e,0x6fe03e,0x6fdfbe,0x305fc1,0x306041,0x11060c0,0x11060bf,0x180fa040,0x180f9fc0,0x180f9fbf,0x180fa03f,0x13020c1,0x12fe0c1,0x3105f40,0x3105f3f,0x3301f41,0x32fdf41,0x705fbe,0x70603e,0x17020be,0x16fe0be,0x182fa041,0x182f9fc1,0x93060c1,0xb305f41,0x3701f3e,0x36fdf3e,0x190fa0bf,0x192fa0c0,0x1b2f9f40,0x1b0f9f3f,0x1b6f9fbe,0x196fa03e,0x97060be,0xb705f3e,0xb709fbf,0xb309fc0,0x930a040,0x970a03f,
+	9,0x101fc0,0x101fbf,0x10203f,0xfe040,0xfdfc0,0xfdfbf,0xfe03f,0x102041,0x101fc1,0x8105fc0,0x8106040,0x810603f,0x8105fbf,0xfdfc1,0xfe041,0x11020c0,0x11020bf,0x10fe0c0,0x10fe0bf,0x3101f40,0x3101f3f,0x30fdf40,0x30fdf3f,0x8105fc1,0x8106041,0x11020c1,0x180fa040,0x180f9fc0,0x180f9fbf,0x180fa03f,0x70203e,0x701fbe,0x6fdfbe,0x6fe03e,0x91060c0,0x91060bf,0x10fe0c1,0x3101f41,0xb105f40,0xb105f3f,0x30fdf41,0x180f9fc1,0x180fa041,0x870603e,0x8705fbe,0x93060c1,0xb305f41,0x17020be,0x16fe0be,0x190fa0bf,0x190fa0c0,0x1b2f9f40,0x1b0f9f3f,0x36fdf3e,0xb701f3e,0x1b6f9fbe,0x196fa03e,0x97060be,0x192fa0c1,0x192fe042,0x9302042,0xb301fc2,0x1b2fdfc2,
+	11,0x101fc0,0xfdfc0,0xfe040,0x10203f,0x101fbf,0xfdfbf,0xfe03f,0x102041,0x101fc1,0xfdfc1,0xfe041,0x8106040,0x8105fc0,0x8105fbf,0x810603f,0x11020c0,0x10fe0c0,0x11020bf,0x10fe0bf,0x3101f40,0x30fdf40,0x3101f3f,0x8105fc1,0x8106041,0x30fdf3f,0x180f9fc0,0x180fa040,0x11020c1,0x10fe0c1,0x91060c0,0x91060bf,0x180fa03f,0x180f9fbf,0x3101f41,0x30fdf41,0xb105f40,0x701fbe,0x70203e,0x6fe03e,0x6fdfbe,0xb105f3f,0x180f9fc1,0x180fa041,0x93060c1,0xb305f41,0x8705fbe,0x870603e,0x190fa0c0,0x190fa0bf,0x16fe0be,0x97020be,0x1b0f9f40,0x1b0f9f3f,0x36fdf3e,0xb701f3e,0xb301fc2,0x9302042,0x192fe042,0x192fa0c1,0x1b2fdfc2,0x1b2f9f41,0x1b6f9fbe,0x196fa03e,
+	13,0x101fc0,0xfdfc0,0xfe040,0x10203f,0x101fbf,0xfdfbf,0xfe03f,0x102041,0x101fc1,0xfdfc1,0xfe041,0x106040,0x105fc0,0x105fbf,0x10603f,0x11020c0,0x10fe0c0,0x11020bf,0x106041,0x105fc1,0x3101f40,0x30fdf40,0x10fe0bf,0x3101f3f,0x30fdf3f,0x11020c1,0x10fe0c1,0x180fa040,0x180f9fc0,0x3101f41,0x30fdf41,0x180f9fbf,0x180fa03f,0x11060c0,0x91060bf,0x3105f40,0xb105f3f,0x701fbe,0x70203e,0x186fe03e,0x186fdfbe,0x180f9fc1,0x180fa041,0x93060c1,0xb305f41,0x8705fbe,0x870603e,0x190fa0c0,0x190fa0bf,0x1b0f9f40,0x1b0f9f3f,0xb301fc2,0x9302042,0x192fe042,0x1b2fdfc2,0x192fa0c1,0x97020be,0x196fe0be,0xb701f3e,0x1b6fdf3e,0x1b2f9f41,0xb509fc0,0x950a040,
+	13,0x101fc0,0xfdfc0,0xfe040,0x10203f,0x101fbf,0xfdfbf,0xfe03f,0x102041,0x101fc1,0xfdfc1,0xfe041,0x106040,0x105fc0,0x105fbf,0x10603f,0x11020c0,0x10fe0c0,0x106041,0x105fc1,0x3101f40,0x30fdf40,0x11020bf,0x10fe0bf,0x3101f3f,0x30fdf3f,0x11020c1,0x10fe0c1,0x3101f41,0x30fdf41,0x180f9fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x11060c0,0x91060bf,0x3105f40,0xb105f3f,0x180f9fc1,0x180fa041,0x93060c1,0x70203e,0x701fbe,0x186fdfbe,0x186fe03e,0xb305f41,0xb301fc2,0x9302042,0x190fa0c0,0x190fa0bf,0x1b0f9f40,0x1b2fdfc2,0x192fe042,0x870603e,0x8705fbe,0x1b0f9f3f,0x192fa0c1,0x1b2f9f41,0x97020be,0x196fe0be,0xb701f3e,0x1b6fdf3e,0xb509fc0,0x950a040,
+	13,0x101fc0,0xfdfc0,0xfe040,0x10203f,0x101fbf,0xfdfbf,0xfe03f,0x102041,0x101fc1,0xfdfc1,0xfe041,0x106040,0x105fc0,0x105fbf,0x10603f,0x106041,0x105fc1,0x11020c0,0x10fe0c0,0x3101f40,0x30fdf40,0x11020bf,0x10fe0bf,0x11020c1,0x10fe0c1,0x3101f3f,0x30fdf3f,0x3101f41,0x30fdf41,0x180f9fc0,0x180fa040,0x11060c0,0x91060bf,0x3105f40,0x180f9fbf,0x180fa03f,0x180fa041,0x180f9fc1,0x91060c1,0xb105f3f,0xb105f41,0x3701fbe,0x70203e,0x186fe03e,0x1b6fdfbe,0x3301fc2,0x1302042,0x192fe042,0x1b2fdfc2,0x190fa0c0,0x190fa0bf,0x1b0f9f40,0x1b6f9f3f,0x192fa0c1,0x1b2f9f41,0xb705fbe,0x870603e,0x97020be,0x196fe0be,0x9306042,0xb305fc2,0xb509fc0,0x950a040,
+	11,0x10203f,0x101fbf,0x101fc0,0xfe040,0xfe03f,0xfdfbf,0xfdfc0,0x106040,0x10603f,0x105fbf,0x105fc0,0x11020c0,0x11020bf,0x10fe0bf,0x10fe0c0,0x302041,0x301fc1,0x2fdfc1,0x2fe041,0x70203e,0x701fbe,0x6fdfbe,0x6fe03e,0x3101f3f,0x3101f40,0x30fdf40,0x30fdf3f,0x180f9fbf,0x180fa03f,0x180fa040,0x180f9fc0,0x11060c0,0x11060bf,0x306041,0x305fc1,0x70603e,0x705fbe,0x3105f3f,0x3105f40,0x13020c1,0x12fe0c1,0x17020be,0x16fe0be,0x190fa0bf,0x190fa0c0,0x3301f41,0x32fdf41,0x3701f3e,0x36fdf3e,0x182f9fc1,0x192fa041,0x93060c1,0x97060be,0x196fa03e,0x186f9fbe,0x1b6f9f3f,0x1b2f9f40,0xb305f41,0xb705f3e,0xb709fbf,0x970a03f,0x930a040,0xb309fc0,
+	11,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0xfdfbf,0x106040,0x10603f,0x105fbf,0x105fc0,0x301fc1,0x302041,0x11020c0,0x11020bf,0x10fe0bf,0x10fe0c0,0x2fe041,0x2fdfc1,0x3101f40,0x3101f3f,0x701fbe,0x70203e,0x6fe03e,0x6fdfbe,0x30fdf3f,0x30fdf40,0x305fc1,0x306041,0x11060c0,0x11060bf,0x180fa040,0x180fa03f,0x180f9fbf,0x180f9fc0,0x13020c1,0x12fe0c1,0x70603e,0x705fbe,0x3105f3f,0x3105f40,0x3301f41,0x32fdf41,0x17020be,0x16fe0be,0x190fa0bf,0x190fa0c0,0x192fa041,0x182f9fc1,0x93060c1,0x3701f3e,0x36fdf3e,0x186f9fbe,0x196fa03e,0x97060be,0xb305f41,0x1b2f9f40,0x1b6f9f3f,0xb705f3e,0xb709fbf,0x970a03f,0x930a040,0xb309fc0,
+	10,0x101fc0,0x10203f,0x101fbf,0xfe040,0xfdfc0,0xfe03f,0xfdfbf,0x106040,0x105fc0,0x105fbf,0x10603f,0x302041,0x301fc1,0x2fdfc1,0x2fe041,0x11020c0,0x11020bf,0x10fe0c0,0x10fe0bf,0x3101f40,0x3101f3f,0x30fdf40,0x30fdf3f,0x701fbe,0x70203e,0x6fe03e,0x6fdfbe,0x306041,0x305fc1,0x11060c0,0x91060bf,0x13020c1,0x180fa040,0x180f9fc0,0x180f9fbf,0x180fa03f,0x12fe0c1,0x3105f40,0x3105f3f,0x3301f41,0x32fdf41,0x705fbe,0x870603e,0x17020be,0x16fe0be,0x93060c1,0x182fa041,0x182f9fc1,0x190fa0c0,0x190fa0bf,0x3701f3e,0x36fdf3e,0xb305f41,0x1b2f9f40,0x1b0f9f3f,0x1b6f9fbe,0x196fa03e,0x97060be,0x192fa0c1,0x950a040,0xb309fc0,0xb709fbf,0xb705f3e,
+	9,0x101fc0,0x10203f,0xfe040,0xfdfc0,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0x8105fc0,0x8106040,0x810603f,0x8105fbf,0xfe041,0xfdfc1,0x11020c0,0x11020bf,0x10fe0c0,0x10fe0bf,0x3101f40,0x30fdf40,0x3101f3f,0x30fdf3f,0x8105fc1,0x8106041,0x11020c1,0x91060c0,0x91060bf,0x70203e,0x701fbe,0x6fdfbe,0x6fe03e,0x180fa040,0x180f9fc0,0x180f9fbf,0x180fa03f,0x10fe0c1,0x3101f41,0xb105f40,0xb105f3f,0x30fdf41,0x180f9fc1,0x180fa041,0x93060c1,0x870603e,0x8705fbe,0x17020be,0x16fe0be,0x190fa0bf,0x190fa0c0,0xb305f41,0x1b2f9f40,0x1b0f9f3f,0x36fdf3e,0xb701f3e,0x1b6f9fbe,0x196fa03e,0x97060be,0x192fa0c1,0x192fe042,0x9302042,0xb301fc2,0x1b2fdfc2,
+	11,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0xfdfc1,0xfe041,0x8106040,0x8105fc0,0x8105fbf,0x810603f,0x11020c0,0x10fe0c0,0x11020bf,0x10fe0bf,0x8106041,0x8105fc1,0x3101f40,0x30fdf40,0x3101f3f,0x30fdf3f,0x11020c1,0x10fe0c1,0x91060c0,0x91060bf,0x180fa040,0x180f9fc0,0x180f9fbf,0x180fa03f,0x70203e,0x701fbe,0x6fdfbe,0x6fe03e,0x3101f41,0x30fdf41,0xb105f40,0xb105f3f,0x93060c1,0x180fa041,0x180f9fc1,0x190fa0c0,0x190fa0bf,0x870603e,0x8705fbe,0xb305f41,0x97020be,0x16fe0be,0x1b0f9f40,0x1b0f9f3f,0x36fdf3e,0xb701f3e,0x192fa0c1,0x192fe042,0x9302042,0xb301fc2,0x1b2fdfc2,0x1b2f9f41,0x1b6f9fbe,0x196fa03e,
+	11,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0xfdfc1,0xfe041,0x8106040,0x8105fc0,0x8105fbf,0x810603f,0x11020c0,0x10fe0c0,0x11020bf,0x10fe0bf,0x8106041,0x8105fc1,0x3101f40,0x30fdf40,0x3101f3f,0x30fdf3f,0x11020c1,0x10fe0c1,0x91060c0,0x91060bf,0x180fa040,0x180f9fc0,0x180f9fbf,0x180fa03f,0x3101f41,0x30fdf41,0xb105f40,0x701fbe,0x70203e,0x6fe03e,0x6fdfbe,0xb105f3f,0x93060c1,0x180fa041,0x180f9fc1,0xb305f41,0x190fa0c0,0x190fa0bf,0x870603e,0x8705fbe,0x97020be,0x16fe0be,0x1b0f9f40,0x1b0f9f3f,0x192fa0c1,0x9302042,0xb301fc2,0x1b2fdfc2,0x192fe042,0x1b2f9f41,0xb701f3e,0x36fdf3e,0x1b6f9fbe,0x196fa03e,
+	13,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0xfdfc1,0xfe041,0x106040,0x105fc0,0x105fbf,0x10603f,0x11020c0,0x10fe0c0,0x11020bf,0x106041,0x105fc1,0x10fe0bf,0x11020c1,0x10fe0c1,0x3101f40,0x30fdf40,0x3101f3f,0x30fdf3f,0x180f9fc0,0x180fa040,0x11060c0,0x91060bf,0x3101f41,0x30fdf41,0x180f9fbf,0x180fa03f,0x180fa041,0x180f9fc1,0x91060c1,0x3105f40,0xb105f3f,0x3701fbe,0x70203e,0x186fe03e,0x1b6fdfbe,0xb105f41,0x190fa0c0,0x190fa0bf,0x1302042,0x3301fc2,0x1b2fdfc2,0x192fe042,0x192fa0c1,0x870603e,0xb705fbe,0x1b0f9f40,0x1b6f9f3f,0x97020be,0x196fe0be,0x1b2f9f41,0xb305fc2,0x9306042,0x950a040,0xb509fc0,
+	11,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0xfdfc1,0xfe041,0x8106040,0x8105fc0,0x8105fbf,0x810603f,0x11020c0,0x10fe0c0,0x8106041,0x8105fc1,0x11020bf,0x10fe0bf,0x11020c1,0x10fe0c1,0x3101f40,0x30fdf40,0x3101f3f,0x30fdf3f,0x180f9fc0,0x180fa040,0x91060c0,0x3101f41,0x30fdf41,0x180f9fbf,0x180fa03f,0x91060bf,0x91060c1,0x180fa041,0x180f9fc1,0xb105f40,0xb105f3f,0xb105f41,0x3701fbe,0x70203e,0x186fe03e,0x1b6fdfbe,0x190fa0c0,0x302042,0x3301fc2,0x1b2fdfc2,0x182fe042,0x190fa0c1,0x190fa0bf,0x1b0f9f40,0x1b6f9f3f,0xb705fbe,0x870603e,0x97020be,0x196fe0be,0x1b2f9f41,0xb305fc2,0x8306042,0x93020c2,0x192fe0c2,
+	11,0x10203f,0x101fbf,0x101fc0,0xfe040,0xfe03f,0xfdfbf,0xfdfc0,0x106040,0x10603f,0x105fbf,0x105fc0,0x11020c0,0x11020bf,0x10fe0bf,0x10fe0c0,0x302041,0x301fc1,0x2fe041,0x2fdfc1,0x70203e,0x701fbe,0x6fe03e,0x6fdfbe,0x3101f3f,0x3101f40,0x30fdf40,0x30fdf3f,0x11060bf,0x11060c0,0x306041,0x305fc1,0x180fa040,0x180fa03f,0x180f9fbf,0x180f9fc0,0x13020c1,0x12fe0c1,0x70603e,0x705fbe,0x17020be,0x16fe0be,0x3105f3f,0x3105f40,0x3301f41,0x32fdf41,0x190fa0c0,0x190fa0bf,0x93060c1,0x97060be,0x3701f3e,0x36fdf3e,0x182f9fc1,0x192fa041,0x196fa03e,0x186f9fbe,0x1b6f9f3f,0x1b2f9f40,0xb305f41,0xb705f3e,0xb709fbf,0x970a03f,0x930a040,0xb309fc0,
+	10,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0xfdfbf,0x106040,0x10603f,0x105fbf,0x105fc0,0x11020c0,0x11020bf,0x10fe0bf,0x10fe0c0,0x302041,0x301fc1,0x2fe041,0x2fdfc1,0x70203e,0x701fbe,0x6fe03e,0x6fdfbe,0x3101f3f,0x3101f40,0x30fdf40,0x30fdf3f,0x11060c0,0x11060bf,0x306041,0x8305fc1,0x13020c1,0x180fa040,0x180fa03f,0x180f9fbf,0x180f9fc0,0x12fe0c1,0x70603e,0x705fbe,0x17020be,0x16fe0be,0x3105f3f,0xb105f40,0x3301f41,0x32fdf41,0x93060c1,0x190fa0c0,0x190fa0bf,0x182fa041,0x182f9fc1,0x3701f3e,0x36fdf3e,0x97060be,0x196fa03e,0x186f9fbe,0x1b6f9f3f,0x1b2f9f40,0xb305f41,0x192fa0c1,0xa30a040,0x970a03f,0xb709fbf,0xb705f3e,
+	11,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0xfdfbf,0x106040,0x10603f,0x105fc0,0x105fbf,0x302041,0x11020c0,0x11020bf,0x10fe0c0,0x2fe041,0x301fc1,0x2fdfc1,0x10fe0bf,0x70203e,0x701fbe,0x3101f3f,0x3101f40,0x305fc1,0x306041,0x11060c0,0x11060bf,0x6fe03e,0x6fdfbe,0x30fdf3f,0x30fdf40,0x180f9fc0,0x180fa040,0x13020c1,0x12fe0c1,0x180fa03f,0x180f9fbf,0x70603e,0x705fbe,0x3105f3f,0x3105f40,0x3301f41,0x32fdf41,0x93060c1,0x17020be,0x16fe0be,0x190fa0bf,0x190fa0c0,0x182fa041,0x182f9fc1,0xb305f41,0xb701f3e,0x36fdf3e,0x97060be,0x196fa03e,0x186f9fbe,0x1b6f9f3f,0x1b2f9f40,0x192fa0c1,0x930a040,0x970a03f,0xb709fbf,0xb309fc0,
+	8,0x101fc0,0x10203f,0xfe040,0xfdfc0,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x8106040,0x8105fc0,0x101fc1,0xfe041,0xfdfc1,0x810603f,0x8105fbf,0x11020c0,0x11020bf,0x10fe0c0,0x10fe0bf,0x8106041,0x8105fc1,0x3101f40,0x30fdf40,0x3101f3f,0x91060c0,0x11020c1,0x10fe0c1,0x91060bf,0x70203e,0x30fdf3f,0x180f9fc0,0x180fa040,0x180fa03f,0x6fe03e,0x701fbe,0x6fdfbe,0x180f9fbf,0x3101f41,0xb105f40,0xb105f3f,0x93060c1,0x30fdf41,0x180f9fc1,0x180fa041,0x190fa0c0,0x190fa0bf,0x870603e,0x8705fbe,0x17020be,0x16fe0be,0xb305f41,0x1b2f9f40,0x1b0f9f3f,0x36fdf3e,0xb701f3e,0x97060be,0x192fa0c1,0x196fa03e,0x1b6f9fbe,0x9302042,0xb301fc2,0x1b2fdfc2,0x192fe042,
+	11,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0xfe041,0xfdfc1,0x8106040,0x8105fc0,0x810603f,0x8105fbf,0x11020c0,0x10fe0c0,0x11020bf,0x10fe0bf,0x8106041,0x8105fc1,0x11020c1,0x10fe0c1,0x91060c0,0x91060bf,0x3101f40,0x30fdf40,0x3101f3f,0x30fdf3f,0x180f9fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x70203e,0x701fbe,0x6fe03e,0x6fdfbe,0x3101f41,0x30fdf41,0x93060c1,0xb105f40,0xb105f3f,0x180fa041,0x180f9fc1,0x190fa0c0,0x190fa0bf,0x870603e,0x8705fbe,0x17020be,0x16fe0be,0xb305f41,0x192fa0c1,0x1b2f9f40,0x1b0f9f3f,0x36fdf3e,0xb701f3e,0x97060be,0x9302042,0xb301fc2,0x1b2fdfc2,0x192fe042,0x196fa03e,0x1b6f9fbe,
+	13,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0xfe041,0xfdfc1,0x106040,0x105fc0,0x10603f,0x11020c0,0x10fe0c0,0x105fbf,0x11020bf,0x10fe0bf,0x106041,0x105fc1,0x11020c1,0x10fe0c1,0x11060c0,0x3101f40,0x30fdf40,0x3101f3f,0x30fdf3f,0x180f9fc0,0x180fa040,0x91060bf,0x180fa03f,0x180f9fbf,0x3101f41,0x30fdf41,0x93060c1,0x70203e,0x701fbe,0x186fe03e,0x186fdfbe,0x180fa041,0x180f9fc1,0x3105f40,0xb105f3f,0x190fa0c0,0x190fa0bf,0x870603e,0x8705fbe,0xb305f41,0x17020be,0x196fe0be,0x192fa0c1,0x9302042,0xb301fc2,0x1b2fdfc2,0x192fe042,0x1b2f9f40,0x1b0f9f3f,0x1b6fdf3e,0xb701f3e,0x97060be,0x950a040,0xb509fc0,
+	13,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0xfe041,0xfdfc1,0x106040,0x105fc0,0x11020c0,0x10fe0c0,0x10603f,0x105fbf,0x11020bf,0x10fe0bf,0x106041,0x105fc1,0x11020c1,0x10fe0c1,0x11060c0,0x3101f40,0x30fdf40,0x3101f3f,0x30fdf3f,0x180f9fc0,0x180fa040,0x91060bf,0x91060c1,0x180fa03f,0x180f9fbf,0x3101f41,0x30fdf41,0x180f9fc1,0x180fa041,0x3105f40,0x3701fbe,0x70203e,0x186fe03e,0x1b6fdfbe,0xb105f3f,0xb105f41,0x190fa0c0,0x190fa0bf,0x192fa0c1,0x1302042,0x3301fc2,0x1b2fdfc2,0x192fe042,0x870603e,0xb705fbe,0x97020be,0x196fe0be,0x1b0f9f40,0x1b6f9f3f,0x1b2f9f41,0xb305fc2,0x9306042,0x950a040,0xb509fc0,
+	11,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0xfe041,0xfdfc1,0x8106040,0x8105fc0,0x11020c0,0x10fe0c0,0x810603f,0x8105fbf,0x8106041,0x8105fc1,0x11020bf,0x10fe0bf,0x11020c1,0x10fe0c1,0x91060c0,0x3101f40,0x30fdf40,0x180f9fc0,0x180fa040,0x3101f3f,0x30fdf3f,0x91060bf,0x91060c1,0x3101f41,0x30fdf41,0x180f9fbf,0x180fa03f,0x180fa041,0x180f9fc1,0xb105f40,0xb105f3f,0x3701fbe,0x70203e,0x186fe03e,0x1b6fdfbe,0x190fa0c0,0x190fa0bf,0xb105f41,0x3301fc2,0x302042,0x182fe042,0x1b2fdfc2,0x190fa0c1,0x1b0f9f40,0xb705fbe,0x870603e,0x97020be,0x196fe0be,0x1b6f9f3f,0x1b2f9f41,0xb305fc2,0x8306042,0x93020c2,0x192fe0c2,
+	9,0x10203f,0x101fbf,0x101fc0,0xfe040,0xfe03f,0xfdfbf,0xfdfc0,0x1020c0,0x1020bf,0x810603f,0x8106040,0x8105fc0,0x8105fbf,0xfe0bf,0xfe0c0,0x302041,0x301fc1,0x2fe041,0x2fdfc1,0x70203e,0x701fbe,0x6fe03e,0x6fdfbe,0x81060bf,0x81060c0,0x3020c1,0x180fa040,0x180fa03f,0x180f9fbf,0x180f9fc0,0x3101f40,0x3101f3f,0x30fdf3f,0x30fdf40,0x8306041,0x8305fc1,0x2fe0c1,0x7020be,0x870603e,0x8705fbe,0x6fe0be,0x180fa0bf,0x180fa0c0,0xb105f40,0xb105f3f,0x93060c1,0x97060be,0x3301f41,0x32fdf41,0x182f9fc1,0x182fa041,0x196fa03e,0x186f9fbe,0x36fdf3e,0xb701f3e,0x1b6f9f3f,0x1b2f9f40,0xb305f41,0x192fa0c1,0x192fe140,0x9302140,0x970213f,0x196fe13f,
+	9,0x10203f,0x101fc0,0xfe040,0xfe03f,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0x810603f,0x8106040,0x8105fc0,0x8105fbf,0xfe0c0,0xfe0bf,0x302041,0x301fc1,0x2fe041,0x2fdfc1,0x70203e,0x6fe03e,0x701fbe,0x6fdfbe,0x81060bf,0x81060c0,0x3020c1,0x8306041,0x8305fc1,0x3101f40,0x3101f3f,0x30fdf3f,0x30fdf40,0x180fa040,0x180fa03f,0x180f9fbf,0x180f9fc0,0x2fe0c1,0x7020be,0x870603e,0x8705fbe,0x6fe0be,0x180fa0bf,0x180fa0c0,0x93060c1,0xb105f40,0xb105f3f,0x3301f41,0x32fdf41,0x182f9fc1,0x182fa041,0x97060be,0x196fa03e,0x186f9fbe,0x36fdf3e,0xb701f3e,0x1b6f9f3f,0x1b2f9f40,0xb305f41,0x192fa0c1,0x192fe140,0x9302140,0x970213f,0x196fe13f,
+	8,0x10203f,0x101fc0,0xfe040,0xfe03f,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x8106040,0x810603f,0x1020bf,0xfe0c0,0xfe0bf,0x8105fc0,0x8105fbf,0x302041,0x301fc1,0x2fe041,0x2fdfc1,0x81060c0,0x81060bf,0x70203e,0x6fe03e,0x701fbe,0x8306041,0x3020c1,0x2fe0c1,0x8305fc1,0x3101f40,0x6fdfbe,0x180fa03f,0x180fa040,0x180f9fc0,0x30fdf40,0x3101f3f,0x30fdf3f,0x180f9fbf,0x7020be,0x870603e,0x8705fbe,0x93060c1,0x6fe0be,0x180fa0bf,0x180fa0c0,0x182fa041,0x182f9fc1,0xb105f40,0xb105f3f,0x3301f41,0x32fdf41,0x97060be,0x196fa03e,0x186f9fbe,0x36fdf3e,0xb701f3e,0xb305f41,0x192fa0c1,0x1b2f9f40,0x1b6f9f3f,0x9302140,0x970213f,0x196fe13f,0x192fe140,
+	7,0x10203f,0x101fc0,0xfe040,0xfe03f,0x101fbf,0xfdfc0,0xfdfbf,0x302041,0x1020c0,0x8106040,0x810603f,0x1020bf,0xfe0c0,0x2fe041,0x301fc1,0x8105fc0,0x8105fbf,0xfe0bf,0x2fdfc1,0x3020c1,0x8306041,0x81060c0,0x81060bf,0x2fe0c1,0x8305fc1,0x3101f40,0x3101f3f,0x70203e,0x6fe03e,0x180fa040,0x180fa03f,0x180f9fc0,0x30fdf40,0x30fdf3f,0x701fbe,0x6fdfbe,0x180f9fbf,0x93060c1,0x870603e,0x7020be,0x6fe0be,0x180fa0bf,0x180fa0c0,0x182fa041,0x182f9fc1,0x32fdf41,0x3301f41,0xb105f40,0xb105f3f,0x8705fbe,0x97060be,0x192fa0c1,0xb305f41,0xb701f3e,0x36fdf3e,0x1b0f9f3f,0x1b2f9f40,0x196fa03e,0x1b6f9fbe,0x9302140,0x970213f,0x192fe140,0x196fe13f,
+	12,0x101fc0,0xfe040,0x10203f,0xfdfc0,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0xfe041,0xfdfc1,0x1020c0,0x8106040,0x8105fc0,0x810603f,0x1020bf,0xfe0c0,0xfe0bf,0x8105fbf,0x8106041,0x1020c1,0xfe0c1,0x8105fc1,0x81060c0,0x91060bf,0x3101f40,0x30fdf40,0x180fa040,0x180f9fc0,0x180fa03f,0x180f9fbf,0x3101f3f,0x30fdf3f,0x70203e,0x3701fbe,0x6fe03e,0x36fdfbe,0x93060c1,0x3101f41,0x30fdf41,0x180fa041,0x180f9fc1,0x180fa0c0,0x190fa0bf,0xb105f40,0xb105f3f,0xb705fbe,0x870603e,0x17020be,0x16fe0be,0x192fa0c1,0xb305f41,0xb301fc2,0x9302042,0x192fe042,0x1b2fdfc2,0x1b2f9f40,0x1b0f9f3f,0x97060be,0x9502140,0x194fe140,0x196fa03e,0x1b6f9fbe,
+	13,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0xfe041,0xfdfc1,0x1020c0,0x106040,0x105fc0,0xfe0c0,0x1020bf,0x10603f,0x8105fbf,0xfe0bf,0x1020c1,0x106041,0x8105fc1,0xfe0c1,0x1060c0,0x81060bf,0x3101f40,0x30fdf40,0x180fa040,0x180f9fc0,0x180fa03f,0x180f9fbf,0x3101f3f,0x30fdf3f,0x93060c1,0x70203e,0x3701fbe,0x186fe03e,0x1b6fdfbe,0x3101f41,0x30fdf41,0x180fa041,0x180f9fc1,0x180fa0c0,0x190fa0bf,0xb105f40,0xb105f3f,0xb705fbe,0x870603e,0x7020be,0x196fe0be,0x192fa0c1,0xb305f41,0x9302042,0xb301fc2,0x192fe042,0x1b2fdfc2,0x1b2f9f40,0x1b6f9f3f,0x97060be,0x9302140,0x192fe140,0x1170213f,0xa50a040,
+	11,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0xfe041,0xfdfc1,0x11020c0,0x106040,0x105fc0,0x10fe0c0,0x11020bf,0x10603f,0x8105fbf,0x10fe0bf,0x11020c1,0x106041,0x8105fc1,0x10fe0c1,0x11060c0,0x91060bf,0x3101f40,0x30fdf40,0x180fa040,0x180f9fc0,0x180fa03f,0x180f9fbf,0x3101f3f,0x30fdf3f,0x91060c1,0x3101f41,0x30fdf41,0x180fa041,0x180f9fc1,0x70203e,0x3701fbe,0x186fe03e,0x1b6fdfbe,0xb105f40,0xb105f3f,0x190fa0c0,0x190fa0bf,0x192fa0c1,0x302042,0xb105f41,0x3301fc2,0x182fe042,0x1b2fdfc2,0x17020be,0x970603e,0xb705fbe,0x196fe0be,0x1b0f9f40,0x1b6f9f3f,0x1b2f9f41,0x193020c2,0x9306042,0xb305fc2,0xa50a040,
+	11,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0x102041,0x101fc1,0xfe041,0xfdfbf,0xfdfc1,0x11020c0,0x106040,0x105fc0,0x10fe0c0,0x11020bf,0x10603f,0x105fbf,0x106041,0x11020c1,0x10fe0bf,0x10fe0c1,0x105fc1,0x11060c0,0x91060bf,0x91060c1,0x3101f40,0x30fdf40,0x180fa040,0x180f9fc0,0x180fa03f,0x180f9fbf,0x3101f3f,0x30fdf3f,0x3101f41,0x30fdf41,0x180fa041,0x180f9fc1,0x190fa0c0,0x70203e,0x3701fbe,0x3105f40,0xb105f3f,0x186fe03e,0x1b6fdfbe,0x190fa0bf,0x190fa0c1,0x302042,0x3301fc2,0x182fe042,0x1b2fdfc2,0xb105f41,0x870603e,0x97020be,0x196fe0be,0xb705fbe,0x1b4f9f40,0x8306042,0x93020c2,0x192fe0c2,0xb305fc2,0x950a040,0xb509fc0,
+	11,0x10203f,0xfe03f,0xfe040,0x101fc0,0x101fbf,0xfdfbf,0xfdfc0,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x8106040,0x810603f,0x8105fbf,0x8105fc0,0x302041,0x2fe041,0x301fc1,0x2fdfc1,0x70203e,0x6fe03e,0x701fbe,0x81060bf,0x81060c0,0x6fdfbe,0x180fa03f,0x180fa040,0x3020c1,0x2fe0c1,0x8306041,0x8305fc1,0x180f9fc0,0x180f9fbf,0x7020be,0x6fe0be,0x870603e,0x3101f3f,0x3101f40,0x30fdf40,0x30fdf3f,0x8705fbe,0x180fa0bf,0x180fa0c0,0x93060c1,0x97060be,0xb105f3f,0xb105f40,0x182fa041,0x182f9fc1,0x32fdf41,0xb301f41,0x186fa03e,0x186f9fbe,0x36fdf3e,0xb701f3e,0x970213f,0x9302140,0x192fe140,0x192fa0c1,0x196fe13f,0x196fa0be,0x1b6f9f3f,0x1b2f9f40,
+	11,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x8106040,0x810603f,0x8105fbf,0x8105fc0,0x302041,0x2fe041,0x301fc1,0x2fdfc1,0x81060c0,0x81060bf,0x70203e,0x6fe03e,0x701fbe,0x6fdfbe,0x3020c1,0x2fe0c1,0x8306041,0x8305fc1,0x180fa040,0x180fa03f,0x180f9fbf,0x180f9fc0,0x3101f40,0x3101f3f,0x30fdf3f,0x30fdf40,0x7020be,0x6fe0be,0x870603e,0x8705fbe,0x93060c1,0x180fa0c0,0x180fa0bf,0x182fa041,0x182f9fc1,0xb105f40,0xb105f3f,0x97060be,0xb301f41,0x32fdf41,0x186fa03e,0x186f9fbe,0x36fdf3e,0xb701f3e,0x192fa0c1,0x192fe140,0x9302140,0x970213f,0x196fe13f,0x196fa0be,0x1b6f9f3f,0x1b2f9f40,
+	11,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0xfe0c0,0xfe0bf,0x8106040,0x810603f,0x8105fc0,0x8105fbf,0x302041,0x2fe041,0x301fc1,0x2fdfc1,0x81060c0,0x81060bf,0x3020c1,0x2fe0c1,0x8306041,0x8305fc1,0x70203e,0x6fe03e,0x701fbe,0x6fdfbe,0x180fa03f,0x180fa040,0x180f9fc0,0x180f9fbf,0x3101f40,0x3101f3f,0x30fdf40,0x30fdf3f,0x7020be,0x6fe0be,0x93060c1,0x870603e,0x8705fbe,0x180fa0c0,0x180fa0bf,0x182fa041,0x182f9fc1,0xb105f40,0xb105f3f,0x3301f41,0x32fdf41,0x97060be,0x192fa0c1,0x196fa03e,0x186f9fbe,0x36fdf3e,0xb701f3e,0xb305f41,0x9302140,0x970213f,0x196fe13f,0x192fe140,0x1b2f9f40,0x1b6f9f3f,
+	12,0x10203f,0xfe040,0x101fc0,0xfe03f,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0xfe0c0,0xfe0bf,0x102041,0x8106040,0x810603f,0x8105fc0,0x101fc1,0xfe041,0xfdfc1,0x8105fbf,0x81060c0,0x1020c1,0xfe0c1,0x81060bf,0x8106041,0x8305fc1,0x70203e,0x6fe03e,0x180fa040,0x180fa03f,0x180f9fc0,0x180f9fbf,0x701fbe,0x6fdfbe,0x3101f40,0x3701f3f,0x30fdf40,0x36fdf3f,0x93060c1,0x7020be,0x6fe0be,0x180fa0c0,0x180fa0bf,0x180fa041,0x182f9fc1,0x870603e,0x8705fbe,0xb705f3f,0xb105f40,0x3301f41,0x32fdf41,0x192fa0c1,0x97060be,0x970213f,0x9302140,0x192fe140,0x196fe13f,0x196fa03e,0x186f9fbe,0xb305f41,0xa302042,0x1a2fe042,0x1b2f9f40,0x1b6f9f3f,
+	12,0xfe040,0x10203f,0x101fc0,0xfdfc0,0xfe03f,0x101fbf,0xfdfbf,0x102041,0x1020c0,0xfe0c0,0xfe041,0x101fc1,0x8106040,0x1020bf,0xfe0bf,0xfdfc1,0x8105fc0,0x810603f,0x8105fbf,0x1020c1,0xfe0c1,0x8106041,0x81060c0,0x81060bf,0x8105fc1,0x180fa040,0x180f9fc0,0x180fa03f,0x180f9fbf,0x70203e,0x6fe03e,0x701fbe,0x3101f40,0x1b0fdf40,0x3701f3f,0x1b0fdf3f,0x36fdfbe,0x93060c1,0x180fa0c0,0x180fa041,0x180f9fc1,0x180fa0bf,0x6fe0be,0x7020be,0x870603e,0x3101f41,0x1b0fdf41,0xb105f40,0xb105f3f,0xb705fbe,0x192fa0c1,0x97060be,0xb305f41,0x9302042,0x192fe042,0xb301fc2,0x1b2fdfc2,0x9302140,0x192fe140,0x970213f,0x196fe13f,0x196fa03e,0x1b6f9fbe,
+	13,0xfe040,0x101fc0,0x10203f,0xfdfc0,0xfe03f,0x101fbf,0xfdfbf,0x102041,0xfe041,0x101fc1,0x1020c0,0xfe0c0,0xfdfc1,0x8106040,0x1020bf,0xfe0bf,0x8105fc0,0x810603f,0x8105fbf,0x1020c1,0xfe0c1,0x8106041,0x8105fc1,0x81060c0,0x81060bf,0x180fa040,0x180f9fc0,0x180fa03f,0x180f9fbf,0x3101f40,0x93060c1,0x30fdf40,0x3101f3f,0x30fdf3f,0x70203e,0x186fe03e,0x3701fbe,0x1b6fdfbe,0x180fa041,0x180f9fc1,0x180fa0c0,0x180fa0bf,0x3101f41,0x30fdf41,0xb105f40,0xb105f3f,0x7020be,0x186fe0be,0x870603e,0xb705fbe,0x192fa0c1,0x9302042,0xb305f41,0xb301fc2,0x192fe042,0x1b2fdfc2,0x9302140,0x192fe140,0x97060be,0x970213f,0x196fe13f,0x1b2f9f40,0x1b6f9f3f,
+	13,0xfe040,0x101fc0,0xfdfc0,0x10203f,0xfe03f,0x101fbf,0xfdfbf,0x102041,0xfe041,0x101fc1,0xfdfc1,0x1020c0,0xfe0c0,0x8106040,0x8105fc0,0x1020bf,0xfe0bf,0x810603f,0x8105fbf,0x1020c1,0xfe0c1,0x8106041,0x8105fc1,0x81060c0,0x81060bf,0x91060c1,0x180fa040,0x180f9fc0,0x180fa03f,0x180f9fbf,0x3101f40,0x1b0fdf40,0x3101f3f,0x1b0fdf3f,0x180fa041,0x180f9fc1,0x3101f41,0x1b0fdf41,0x70203e,0x186fe03e,0x3701fbe,0x1b6fdfbe,0x180fa0c0,0x180fa0bf,0x190fa0c1,0xb105f40,0xb105f3f,0x7020be,0x186fe0be,0x870603e,0xb705fbe,0xb305f41,0x8302042,0x182fe042,0xb301fc2,0x1b2fdfc2,0x93020c2,0x9302140,0x192fe140,0x970213f,0x97060be,0x196fe13f,0x192fe0c2,
+	13,0xfe040,0x101fc0,0xfdfc0,0x10203f,0xfe03f,0x101fbf,0x102041,0xfe041,0x101fc1,0xfdfbf,0xfdfc1,0x1020c0,0xfe0c0,0x8106040,0x8105fc0,0x1020bf,0xfe0bf,0x1020c1,0xfe0c1,0x810603f,0x8105fbf,0x8106041,0x8105fc1,0x81060c0,0x81060bf,0x91060c1,0x180fa040,0x180f9fc0,0x3101f40,0x1b0fdf40,0x180fa03f,0x180f9fbf,0x180fa041,0x180f9fc1,0x3101f3f,0x1b0fdf3f,0x3101f41,0x1b0fdf41,0x180fa0c0,0x190fa0bf,0x70203e,0x186fe03e,0x3701fbe,0x1b6fdfbe,0xb105f40,0x302042,0x190fa0c1,0x182fe042,0x3301fc2,0x1b2fdfc2,0xb105f41,0xb105f3f,0x7020be,0x196fe0be,0x970603e,0xb705fbe,0x13020c2,0x192fe0c2,0x9306042,0xb305fc2,0x9302140,0x192fe140,0x1170213f,
+	13,0x10203f,0xfe03f,0xfe040,0x101fc0,0x101fbf,0xfdfbf,0xfdfc0,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x106040,0x10603f,0x105fbf,0x105fc0,0x302041,0x2fe041,0x301fc1,0x1060c0,0x1060bf,0x70203e,0x6fe03e,0x2fdfc1,0x701fbe,0x6fdfbe,0x3020c1,0x2fe0c1,0x180fa040,0x180fa03f,0x7020be,0x6fe0be,0x180f9fbf,0x180f9fc0,0x306041,0x8305fc1,0x70603e,0x8705fbe,0x3101f3f,0x3101f40,0x1b0fdf40,0x1b0fdf3f,0x180fa0bf,0x180fa0c0,0x93060c1,0x97060be,0xb105f3f,0xb105f40,0x182fa041,0x182f9fc1,0x186fa03e,0x186f9fbe,0x970213f,0x9302140,0x192fe140,0x196fe13f,0x192fa0c1,0xb301f41,0x1b2fdf41,0xb701f3e,0x1b6fdf3e,0x196fa0be,0xa70a03f,0xa30a040,
+	11,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x8106040,0x810603f,0x8105fbf,0x8105fc0,0x302041,0x2fe041,0x301fc1,0x2fdfc1,0x81060c0,0x81060bf,0x70203e,0x6fe03e,0x701fbe,0x6fdfbe,0x3020c1,0x2fe0c1,0x8306041,0x8305fc1,0x180fa040,0x180fa03f,0x180f9fbf,0x180f9fc0,0x7020be,0x6fe0be,0x870603e,0x3101f3f,0x3101f40,0x30fdf40,0x30fdf3f,0x8705fbe,0x93060c1,0x180fa0c0,0x180fa0bf,0x97060be,0x182fa041,0x182f9fc1,0xb105f40,0xb105f3f,0xb301f41,0x32fdf41,0x186fa03e,0x186f9fbe,0x192fa0c1,0x9302140,0x970213f,0x196fe13f,0x192fe140,0x196fa0be,0xb701f3e,0x36fdf3e,0x1b6f9f3f,0x1b2f9f40,
+	13,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0xfe0c0,0xfe0bf,0x106040,0x10603f,0x105fc0,0x302041,0x2fe041,0x105fbf,0x301fc1,0x2fdfc1,0x1060c0,0x1060bf,0x3020c1,0x2fe0c1,0x306041,0x70203e,0x6fe03e,0x701fbe,0x6fdfbe,0x180fa03f,0x180fa040,0x8305fc1,0x180f9fc0,0x180f9fbf,0x7020be,0x6fe0be,0x93060c1,0x3101f40,0x3101f3f,0x1b0fdf40,0x1b0fdf3f,0x180fa0c0,0x180fa0bf,0x70603e,0x8705fbe,0x182fa041,0x182f9fc1,0xb105f40,0xb105f3f,0x97060be,0x3301f41,0x1b2fdf41,0x192fa0c1,0x9302140,0x970213f,0x196fe13f,0x192fe140,0x196fa03e,0x186f9fbe,0x1b6fdf3e,0xb701f3e,0xb305f41,0xa30a040,0xa70a03f,
+	13,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0xfe0c0,0xfe0bf,0x102041,0x106040,0x10603f,0xfe041,0x101fc1,0x105fc0,0x8105fbf,0xfdfc1,0x1020c1,0x1060c0,0x81060bf,0xfe0c1,0x106041,0x8105fc1,0x70203e,0x6fe03e,0x180fa040,0x180fa03f,0x180f9fc0,0x180f9fbf,0x701fbe,0x6fdfbe,0x93060c1,0x3101f40,0x3701f3f,0x1b0fdf40,0x1b6fdf3f,0x7020be,0x6fe0be,0x180fa0c0,0x180fa0bf,0x180fa041,0x182f9fc1,0x870603e,0x8705fbe,0xb705f3f,0xb105f40,0x3101f41,0x1b2fdf41,0x192fa0c1,0x97060be,0x9302140,0x970213f,0x192fe140,0x196fe13f,0x196fa03e,0x1b6f9fbe,0xb305f41,0x9302042,0x192fe042,0x13301fc2,0xa50a040,
+	13,0xfe040,0x10203f,0x101fc0,0xfe03f,0xfdfc0,0x101fbf,0xfdfbf,0x1020c0,0xfe0c0,0x1020bf,0x102041,0xfe041,0xfe0bf,0x8106040,0x101fc1,0xfdfc1,0x810603f,0x8105fc0,0x8105fbf,0x1020c1,0xfe0c1,0x81060c0,0x81060bf,0x8106041,0x8105fc1,0x180fa040,0x180fa03f,0x180f9fc0,0x180f9fbf,0x70203e,0x93060c1,0x6fe03e,0x701fbe,0x6fdfbe,0x3101f40,0x1b0fdf40,0x3701f3f,0x1b6fdf3f,0x180fa0c0,0x180fa0bf,0x180fa041,0x180f9fc1,0x7020be,0x6fe0be,0x870603e,0x8705fbe,0x3101f41,0x1b0fdf41,0xb105f40,0xb705f3f,0x192fa0c1,0x9302140,0x97060be,0x970213f,0x192fe140,0x196fe13f,0x9302042,0x192fe042,0xb305f41,0xb301fc2,0x1b2fdfc2,0x196fa03e,0x1b6f9fbe,
+	15,0xfe040,0x10203f,0x101fc0,0xfdfc0,0xfe03f,0x101fbf,0xfdfbf,0x102041,0x1020c0,0xfe0c0,0xfe041,0x101fc1,0xfdfc1,0x1020bf,0xfe0bf,0x8106040,0x810603f,0x8105fc0,0x8105fbf,0x1020c1,0xfe0c1,0x8106041,0x81060c0,0x81060bf,0x8105fc1,0x81060c1,0x180fa040,0x180f9fc0,0x180fa03f,0x180f9fbf,0x70203e,0x186fe03e,0x3101f40,0x1b0fdf40,0x3101f3f,0x3701fbe,0x186fdfbe,0x1b6fdf3f,0x180fa041,0x180fa0c0,0x180fa0bf,0x180f9fc1,0x1b0fdf41,0x3101f41,0x7020be,0x186fe0be,0x192fa0c1,0x870603e,0xb105f40,0xb105f3f,0xb705fbe,0x97060be,0x9102140,0x190fe140,0x8302042,0x182fe042,0xb301fc2,0xb305f41,0x1b2fdfc2,0x970213f,0x196fe13f,0x11102141,0x113020c2,
+	13,0xfe040,0x101fc0,0xfdfc0,0x10203f,0xfe03f,0x101fbf,0xfdfbf,0x102041,0xfe041,0x1020c0,0xfe0c0,0x101fc1,0xfdfc1,0x8106040,0x1020bf,0xfe0bf,0x8105fc0,0x810603f,0x1020c1,0xfe0c1,0x8105fbf,0x8106041,0x81060c0,0x8105fc1,0x81060bf,0x91060c1,0x180fa040,0x180f9fc0,0x180fa03f,0x180f9fbf,0x3101f40,0x1b0fdf40,0x180fa041,0x180fa0c0,0x180f9fc1,0x3101f3f,0x1b0fdf3f,0x70203e,0x186fe03e,0x3701fbe,0x1b6fdfbe,0x180fa0bf,0x190fa0c1,0x3101f41,0x1b0fdf41,0xb105f40,0xb105f3f,0x7020be,0x186fe0be,0x870603e,0xb705fbe,0x8302042,0x182fe042,0xb301fc2,0x1b2fdfc2,0xb305f41,0x9302140,0x192fe140,0x970213f,0x196fe13f,0x97060be,0x93020c2,0x192fe0c2,
+	13,0xfe040,0x101fc0,0xfdfc0,0x10203f,0xfe03f,0x102041,0xfe041,0x101fbf,0xfdfbf,0x101fc1,0xfdfc1,0x1020c0,0xfe0c0,0x8106040,0x1020bf,0xfe0bf,0x1020c1,0xfe0c1,0x8105fc0,0x810603f,0x8106041,0x8105fbf,0x8105fc1,0x81060c0,0x81060bf,0x81060c1,0x180fa040,0x180f9fc0,0x180fa03f,0x180fa041,0x180f9fc1,0x180f9fbf,0x3101f40,0x1b0fdf40,0x180fa0c0,0x180fa0bf,0x3101f3f,0x1b0fdf3f,0x3101f41,0x1b0fdf41,0x70203e,0x186fe03e,0x3701fbe,0x1b6fdfbe,0x190fa0c1,0x8302042,0x182fe042,0xb301fc2,0xb105f40,0xb105f3f,0x1b2fdfc2,0xb305f41,0x7020be,0x186fe0be,0x9102140,0x190fe140,0x83020c2,0x192fe0c2,0x970603e,0xb705fbe,0x970213f,0x196fe13f,0x11302141,
+	13,0x10203f,0xfe03f,0xfe040,0x101fc0,0x101fbf,0xfdfbf,0xfdfc0,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x106040,0x10603f,0x105fbf,0x105fc0,0x302041,0x2fe041,0x1060c0,0x1060bf,0x70203e,0x6fe03e,0x301fc1,0x2fdfc1,0x701fbe,0x6fdfbe,0x3020c1,0x2fe0c1,0x7020be,0x6fe0be,0x180fa03f,0x180fa040,0x180f9fc0,0x180f9fbf,0x306041,0x8305fc1,0x70603e,0x8705fbe,0x180fa0bf,0x180fa0c0,0x93060c1,0x3101f40,0x3101f3f,0x1b0fdf3f,0x1b0fdf40,0x97060be,0x970213f,0x9302140,0x182fa041,0x182f9fc1,0x186fa03e,0x196fe13f,0x192fe140,0xb105f40,0xb105f3f,0x186f9fbe,0x192fa0c1,0x196fa0be,0xb301f41,0x1b2fdf41,0xb701f3e,0x1b6fdf3e,0xa70a03f,0xa30a040,
+	13,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x106040,0x10603f,0x105fbf,0x105fc0,0x302041,0x2fe041,0x301fc1,0x1060c0,0x1060bf,0x2fdfc1,0x3020c1,0x2fe0c1,0x70203e,0x6fe03e,0x701fbe,0x6fdfbe,0x180fa03f,0x180fa040,0x306041,0x8305fc1,0x7020be,0x6fe0be,0x180f9fbf,0x180f9fc0,0x180fa0c0,0x180fa0bf,0x83060c1,0x70603e,0x8705fbe,0x3701f3f,0x3101f40,0x1b0fdf40,0x1b6fdf3f,0x87060be,0x182fa041,0x182f9fc1,0x1302140,0x170213f,0x196fe13f,0x192fe140,0x192fa0c1,0xb105f40,0xb705f3f,0x186fa03e,0x1b6f9fbe,0xb301f41,0x1b2fdf41,0x196fa0be,0x970613f,0x9306140,0xa30a040,0xa70a03f,
+	13,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0xfe0c0,0xfe0bf,0x106040,0x10603f,0x302041,0x2fe041,0x105fc0,0x105fbf,0x301fc1,0x2fdfc1,0x1060c0,0x1060bf,0x3020c1,0x2fe0c1,0x306041,0x70203e,0x6fe03e,0x701fbe,0x6fdfbe,0x180fa03f,0x180fa040,0x8305fc1,0x83060c1,0x180f9fc0,0x180f9fbf,0x7020be,0x6fe0be,0x180fa0bf,0x180fa0c0,0x70603e,0x3701f3f,0x3101f40,0x1b0fdf40,0x1b6fdf3f,0x8705fbe,0x87060be,0x182fa041,0x182f9fc1,0x192fa0c1,0x1302140,0x170213f,0x196fe13f,0x192fe140,0xb105f40,0xb705f3f,0xb301f41,0x1b2fdf41,0x186fa03e,0x1b6f9fbe,0x196fa0be,0x970613f,0x9306140,0xa30a040,0xa70a03f,
+	11,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0xfe0c0,0xfe0bf,0x302041,0x106040,0x10603f,0x2fe041,0x301fc1,0x105fc0,0x8105fbf,0x2fdfc1,0x3020c1,0x1060c0,0x81060bf,0x2fe0c1,0x306041,0x8305fc1,0x70203e,0x6fe03e,0x180fa040,0x180fa03f,0x180f9fc0,0x180f9fbf,0x701fbe,0x6fdfbe,0x83060c1,0x7020be,0x6fe0be,0x180fa0c0,0x180fa0bf,0x3101f40,0x3701f3f,0x1b0fdf40,0x1b6fdf3f,0x870603e,0x8705fbe,0x182fa041,0x182f9fc1,0x192fa0c1,0x1102140,0x87060be,0x170213f,0x190fe140,0x196fe13f,0x3301f41,0xb305f40,0xb705f3f,0x1b2fdf41,0x186fa03e,0x1b6f9fbe,0x196fa0be,0x19302141,0x9306140,0x970613f,0xa50a040,
+	13,0xfe040,0x10203f,0xfe03f,0x101fc0,0xfdfc0,0x101fbf,0xfdfbf,0x1020c0,0xfe0c0,0x1020bf,0xfe0bf,0x102041,0xfe041,0x8106040,0x810603f,0x101fc1,0xfdfc1,0x8105fc0,0x8105fbf,0x1020c1,0xfe0c1,0x81060c0,0x81060bf,0x8106041,0x8105fc1,0x83060c1,0x180fa040,0x180fa03f,0x180f9fc0,0x180f9fbf,0x70203e,0x186fe03e,0x701fbe,0x186fdfbe,0x180fa0c0,0x180fa0bf,0x7020be,0x186fe0be,0x3101f40,0x1b0fdf40,0x3701f3f,0x1b6fdf3f,0x180fa041,0x180f9fc1,0x182fa0c1,0x870603e,0x8705fbe,0x3101f41,0x1b0fdf41,0xb105f40,0xb705f3f,0x97060be,0x9102140,0x190fe140,0x970213f,0x196fe13f,0x9302141,0x9302042,0x192fe042,0xb301fc2,0xb305f41,0x1b2fdfc2,0x192fe141,
+	13,0xfe040,0x10203f,0xfe03f,0x101fc0,0xfdfc0,0x101fbf,0xfdfbf,0x1020c0,0xfe0c0,0x102041,0xfe041,0x1020bf,0xfe0bf,0x8106040,0x101fc1,0xfdfc1,0x810603f,0x8105fc0,0x1020c1,0xfe0c1,0x8105fbf,0x81060c0,0x8106041,0x81060bf,0x8105fc1,0x83060c1,0x180fa040,0x180fa03f,0x180f9fc0,0x180f9fbf,0x70203e,0x186fe03e,0x180fa0c0,0x180fa041,0x180fa0bf,0x701fbe,0x186fdfbe,0x3101f40,0x1b0fdf40,0x3701f3f,0x1b6fdf3f,0x180f9fc1,0x182fa0c1,0x7020be,0x186fe0be,0x870603e,0x8705fbe,0x3101f41,0x1b0fdf41,0xb105f40,0xb705f3f,0x9102140,0x190fe140,0x970213f,0x196fe13f,0x97060be,0x9302042,0x192fe042,0xb301fc2,0x1b2fdfc2,0xb305f41,0x9302141,0x192fe141,
+	15,0xfe040,0x10203f,0x101fc0,0xfdfc0,0xfe03f,0x101fbf,0xfdfbf,0x102041,0x1020c0,0xfe0c0,0xfe041,0x101fc1,0xfdfc1,0x1020bf,0xfe0bf,0x8106040,0x1020c1,0xfe0c1,0x810603f,0x8105fc0,0x8105fbf,0x8106041,0x81060c0,0x81060bf,0x8105fc1,0x81060c1,0x180fa040,0x180f9fc0,0x180fa03f,0x180f9fbf,0x180fa0c0,0x180fa041,0x180f9fc1,0x3101f40,0x1b0fdf40,0x70203e,0x186fe03e,0x180fa0bf,0x180fa0c1,0x701fbe,0x3701f3f,0x1b0fdf3f,0x1b6fdfbe,0x7020be,0x186fe0be,0x3101f41,0x1b0fdf41,0x8302042,0x182fe042,0x9102140,0x190fe140,0x970213f,0x970603e,0xb305f40,0xb105f3f,0xb705fbe,0xb301fc2,0x1b2fdfc2,0x196fe13f,0x9102141,0x93020c2,0x182fe0c2,0x192fe141,
+	15,0xfe040,0x101fc0,0xfdfc0,0x10203f,0xfe03f,0x102041,0xfe041,0x1020c0,0xfe0c0,0x101fbf,0xfdfbf,0x101fc1,0xfdfc1,0x1020bf,0xfe0bf,0x8106040,0x1020c1,0xfe0c1,0x8105fc0,0x810603f,0x8106041,0x81060c0,0x8105fbf,0x8105fc1,0x81060bf,0x81060c1,0x180fa040,0x180f9fc0,0x180fa03f,0x180fa041,0x180fa0c0,0x180f9fbf,0x180f9fc1,0x3101f40,0x1b0fdf40,0x180fa0bf,0x180fa0c1,0x70203e,0x186fe03e,0x3101f3f,0x1b0fdf3f,0x3101f41,0x1b0fdf41,0x302042,0x182fe042,0x3701fbe,0x1b6fdfbe,0x7020be,0x186fe0be,0x9102140,0x190fe140,0x3301fc2,0x1b2fdfc2,0xb305f40,0xb705f3f,0xa70603e,0x970213f,0x196fe13f,0x3020c2,0x182fe0c2,0x9302141,0x192fe141,0xa306042,
+	13,0x10203f,0xfe03f,0xfe040,0x101fc0,0x101fbf,0xfdfbf,0xfdfc0,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x106040,0x10603f,0x105fbf,0x105fc0,0x1060c0,0x1060bf,0x302041,0x2fe041,0x70203e,0x6fe03e,0x301fc1,0x2fdfc1,0x3020c1,0x2fe0c1,0x701fbe,0x6fdfbe,0x7020be,0x6fe0be,0x180fa03f,0x180fa040,0x306041,0x8305fc1,0x70603e,0x180f9fbf,0x180f9fc0,0x180fa0c0,0x180fa0bf,0x83060c1,0x8705fbe,0x87060be,0x3701f3f,0x3101f40,0x1b0fdf40,0x1b6fdf3f,0x170213f,0x1302140,0x192fe140,0x196fe13f,0x182fa041,0x182f9fc1,0x186fa03e,0x1b6f9fbe,0x192fa0c1,0x196fa0be,0xb705f3f,0xb105f40,0xb301f41,0x1b2fdf41,0x9306140,0x970613f,0xa70a03f,0xa30a040,
+	11,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x8106040,0x810603f,0x8105fbf,0x8105fc0,0x302041,0x2fe041,0x81060c0,0x81060bf,0x301fc1,0x2fdfc1,0x3020c1,0x2fe0c1,0x70203e,0x6fe03e,0x701fbe,0x6fdfbe,0x180fa03f,0x180fa040,0x8306041,0x7020be,0x6fe0be,0x180f9fbf,0x180f9fc0,0x8305fc1,0x83060c1,0x180fa0c0,0x180fa0bf,0x870603e,0x8705fbe,0x87060be,0x3701f3f,0x3101f40,0x1b0fdf40,0x1b6fdf3f,0x182fa041,0x1102140,0x170213f,0x196fe13f,0x190fe140,0x182fa0c1,0x182f9fc1,0x186fa03e,0x1b6f9fbe,0xb705f3f,0xb105f40,0xb301f41,0x1b2fdf41,0x196fa0be,0x970613f,0x9106140,0x9302141,0x192fe141,
+	11,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0xfe0c0,0xfe0bf,0x8106040,0x810603f,0x302041,0x2fe041,0x8105fc0,0x8105fbf,0x81060c0,0x81060bf,0x301fc1,0x2fdfc1,0x3020c1,0x2fe0c1,0x8306041,0x70203e,0x6fe03e,0x180fa03f,0x180fa040,0x701fbe,0x6fdfbe,0x8305fc1,0x83060c1,0x7020be,0x6fe0be,0x180f9fbf,0x180f9fc0,0x180fa0c0,0x180fa0bf,0x870603e,0x8705fbe,0x3701f3f,0x3101f40,0x1b0fdf40,0x1b6fdf3f,0x182fa041,0x182f9fc1,0x87060be,0x170213f,0x1102140,0x190fe140,0x196fe13f,0x182fa0c1,0x186fa03e,0xb705f3f,0xb105f40,0xb301f41,0x1b2fdf41,0x1b6f9fbe,0x196fa0be,0x970613f,0x9106140,0x9302141,0x192fe141,
+	11,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0x1020c0,0x1020bf,0xfe0c0,0xfdfbf,0xfe0bf,0x302041,0x106040,0x10603f,0x2fe041,0x301fc1,0x105fc0,0x105fbf,0x1060c0,0x3020c1,0x2fdfc1,0x2fe0c1,0x1060bf,0x306041,0x8305fc1,0x83060c1,0x70203e,0x6fe03e,0x180fa040,0x180fa03f,0x180f9fc0,0x180f9fbf,0x701fbe,0x6fdfbe,0x7020be,0x6fe0be,0x180fa0c0,0x180fa0bf,0x182fa041,0x3101f40,0x3701f3f,0x70603e,0x8705fbe,0x1b0fdf40,0x1b6fdf3f,0x182f9fc1,0x182fa0c1,0x1102140,0x170213f,0x190fe140,0x196fe13f,0x87060be,0xb105f40,0xb301f41,0x1b2fdf41,0xb705f3f,0x1a6fa03e,0x9106140,0x9302141,0x192fe141,0x970613f,0xa30a040,0xa70a03f,
+	13,0xfe040,0x10203f,0xfe03f,0x101fc0,0xfdfc0,0x101fbf,0x1020c0,0xfe0c0,0x1020bf,0xfdfbf,0xfe0bf,0x102041,0xfe041,0x8106040,0x810603f,0x101fc1,0xfdfc1,0x1020c1,0xfe0c1,0x8105fc0,0x8105fbf,0x81060c0,0x81060bf,0x8106041,0x8105fc1,0x83060c1,0x180fa040,0x180fa03f,0x70203e,0x186fe03e,0x180f9fc0,0x180f9fbf,0x180fa0c0,0x180fa0bf,0x701fbe,0x186fdfbe,0x7020be,0x186fe0be,0x180fa041,0x182f9fc1,0x3101f40,0x1b0fdf40,0x3701f3f,0x1b6fdf3f,0x870603e,0x1102140,0x182fa0c1,0x190fe140,0x170213f,0x196fe13f,0x87060be,0x8705fbe,0x3101f41,0x1b2fdf41,0xb305f40,0xb705f3f,0x1302141,0x192fe141,0x9306140,0x970613f,0x9302042,0x192fe042,0x13301fc2,
+	13,0xfe040,0x10203f,0xfe03f,0x101fc0,0xfdfc0,0x1020c0,0xfe0c0,0x101fbf,0xfdfbf,0x1020bf,0xfe0bf,0x102041,0xfe041,0x8106040,0x101fc1,0xfdfc1,0x1020c1,0xfe0c1,0x810603f,0x8105fc0,0x81060c0,0x8105fbf,0x81060bf,0x8106041,0x8105fc1,0x81060c1,0x180fa040,0x180fa03f,0x180f9fc0,0x180fa0c0,0x180fa0bf,0x180f9fbf,0x70203e,0x186fe03e,0x180fa041,0x180f9fc1,0x701fbe,0x186fdfbe,0x7020be,0x186fe0be,0x3101f40,0x1b0fdf40,0x3701f3f,0x1b6fdf3f,0x182fa0c1,0x9102140,0x190fe140,0x970213f,0x870603e,0x8705fbe,0x196fe13f,0x97060be,0x3101f41,0x1b0fdf41,0x8302042,0x182fe042,0x9102141,0x192fe141,0xb305f40,0xb705f3f,0xb301fc2,0x1b2fdfc2,0x113020c2,
+	15,0xfe040,0x10203f,0xfe03f,0x101fc0,0xfdfc0,0x1020c0,0xfe0c0,0x102041,0xfe041,0x101fbf,0xfdfbf,0x1020bf,0xfe0bf,0x101fc1,0xfdfc1,0x8106040,0x1020c1,0xfe0c1,0x810603f,0x8105fc0,0x81060c0,0x8106041,0x8105fbf,0x81060bf,0x8105fc1,0x81060c1,0x180fa040,0x180fa03f,0x180f9fc0,0x180fa0c0,0x180fa041,0x180f9fbf,0x180fa0bf,0x70203e,0x186fe03e,0x180f9fc1,0x180fa0c1,0x3101f40,0x1b0fdf40,0x701fbe,0x186fdfbe,0x7020be,0x186fe0be,0x1102140,0x190fe140,0x3701f3f,0x1b6fdf3f,0x3101f41,0x1b0fdf41,0x8302042,0x182fe042,0x170213f,0x196fe13f,0x970603e,0xb705fbe,0xb505f40,0xb301fc2,0x1b2fdfc2,0x1102141,0x190fe141,0x93020c2,0x192fe0c2,0x9506140,
+	17,0xfe040,0x10203f,0x101fc0,0xfdfc0,0xfe03f,0x1020c0,0x102041,0xfe041,0xfe0c0,0x101fbf,0xfdfbf,0x1020bf,0xfe0bf,0x101fc1,0xfdfc1,0x1020c1,0xfe0c1,0x8106040,0x810603f,0x8105fc0,0x8106041,0x81060c0,0x8105fbf,0x81060bf,0x8105fc1,0x81060c1,0x180fa040,0x180f9fc0,0x180fa03f,0x180fa0c0,0x180fa041,0x180f9fc1,0x180f9fbf,0x180fa0bf,0x180fa0c1,0x70203e,0x186fe03e,0x3101f40,0x1b0fdf40,0x3101f3f,0x3701fbe,0x186fdfbe,0x1b6fdf3f,0x8302042,0x182fe042,0x9102140,0x190fe140,0x7020be,0x186fe0be,0x970213f,0x196fe13f,0x3101f41,0x1b0fdf41,0xb301fc2,0x1b2fdfc2,0x83020c2,0x9302141,0x190fe141,0x192fe0c2,0xb305f40,0x970603e,0x8705fbe,0xb705f3f,
+	11,0x10203f,0x101fc0,0x101fbf,0xfdfbf,0xfe03f,0xfe040,0xfdfc0,0x105fc0,0x106040,0x10603f,0x105fbf,0x11020bf,0x11020c0,0x302041,0x301fc1,0x2fdfc1,0x2fe041,0x10fe0c0,0x10fe0bf,0x70203e,0x701fbe,0x3101f3f,0x3101f40,0x30fdf40,0x30fdf3f,0x6fdfbe,0x6fe03e,0x11060bf,0x11060c0,0x306041,0x305fc1,0x3105f40,0x3105f3f,0x705fbe,0x70603e,0x180fa03f,0x180fa040,0x180f9fc0,0x180f9fbf,0x13020c1,0x12fe0c1,0x17020be,0x16fe0be,0x3301f41,0x32fdf41,0x3701f3e,0x36fdf3e,0x93060c1,0x97060be,0x190fa0bf,0x190fa0c0,0x192fa041,0x182f9fc1,0xb305f41,0xb705f3e,0x1b0f9f3f,0x1b2f9f40,0x1b6f9fbe,0x196fa03e,0x970a03f,0x930a040,0xb309fc0,0xb709fbf,
+	11,0x101fc0,0x101fbf,0x10203f,0xfe040,0xfdfc0,0xfdfbf,0xfe03f,0x106040,0x105fc0,0x105fbf,0x10603f,0x302041,0x301fc1,0x2fdfc1,0x2fe041,0x11020c0,0x11020bf,0x10fe0bf,0x10fe0c0,0x3101f40,0x3101f3f,0x30fdf3f,0x30fdf40,0x701fbe,0x70203e,0x6fe03e,0x6fdfbe,0x305fc1,0x306041,0x11060c0,0x11060bf,0x3105f40,0x3105f3f,0x705fbe,0x70603e,0x180fa03f,0x180fa040,0x180f9fc0,0x180f9fbf,0x13020c1,0x12fe0c1,0x3301f41,0x32fdf41,0x17020be,0x16fe0be,0x3701f3e,0x36fdf3e,0x93060c1,0xb305f41,0x182f9fc1,0x182fa041,0x192fa0c0,0x190fa0bf,0x97060be,0xb705f3e,0x1b0f9f3f,0x1b2f9f40,0x1b6f9fbe,0x196fa03e,0x970a03f,0x930a040,0xb309fc0,0xb709fbf,
+	11,0x101fc0,0x101fbf,0x10203f,0xfe040,0xfdfc0,0xfdfbf,0xfe03f,0x106040,0x105fc0,0x105fbf,0x10603f,0x302041,0x301fc1,0x2fdfc1,0x2fe041,0x11020c0,0x11020bf,0x10fe0c0,0x10fe0bf,0x3101f40,0x3101f3f,0x30fdf40,0x30fdf3f,0x305fc1,0x306041,0x70203e,0x701fbe,0x6fdfbe,0x6fe03e,0x11060bf,0x11060c0,0x13020c1,0x3105f40,0x3105f3f,0x180f9fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x12fe0c1,0x3301f41,0x32fdf41,0x705fbe,0x70603e,0x93060c1,0x17020be,0x16fe0be,0x182fa041,0x182f9fc1,0xb305f41,0x3701f3e,0x36fdf3e,0x190fa0bf,0x192fa0c0,0x1b2f9f40,0x1b0f9f3f,0x1b6f9fbe,0x97060be,0x970a03f,0x930a040,0xb309fc0,0xb709fbf,0xb705f3e,0x196fa03e,
+	11,0x101fc0,0x101fbf,0x10203f,0xfe040,0xfdfc0,0xfdfbf,0xfe03f,0x106040,0x105fc0,0x105fbf,0x10603f,0x302041,0x301fc1,0x2fdfc1,0x2fe041,0x11020c0,0x11020bf,0x10fe0c0,0x10fe0bf,0x3101f40,0x3101f3f,0x30fdf40,0x305fc1,0x306041,0x30fdf3f,0x701fbe,0x70203e,0x11060c0,0x11060bf,0x13020c1,0x12fe0c1,0x6fe03e,0x6fdfbe,0x3105f40,0x3105f3f,0x3301f41,0x180f9fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x32fdf41,0x705fbe,0x70603e,0x93060c1,0xb305f41,0x182f9fc1,0x182fa041,0x17020be,0x16fe0be,0x190fa0bf,0x192fa0c0,0x3701f3e,0x36fdf3e,0x1b0f9f3f,0x1b2f9f40,0xb309fc0,0x930a040,0x970a03f,0x97060be,0xb709fbf,0xb705f3e,0x1b6f9fbe,0x196fa03e,
+	15,0x101fc0,0x101fbf,0x10203f,0xfe040,0xfdfc0,0xfdfbf,0xfe03f,0x102041,0x101fc1,0x105fc0,0x106040,0x10603f,0x105fbf,0xfdfc1,0xfe041,0x11020c0,0x11020bf,0x10fe0c0,0x106041,0x105fc1,0x3101f40,0x3101f3f,0x30fdf40,0x10fe0bf,0x30fdf3f,0x11020c1,0x11060c0,0x11060bf,0x10fe0c1,0x180fa040,0x180f9fc0,0x3101f41,0x3105f40,0x3105f3f,0x701fbe,0x70203e,0x6fe03e,0x6fdfbe,0x186f9fbf,0x186fa03f,0x30fdf41,0x93060c1,0xb305f41,0x705fbe,0x70603e,0x180fa041,0x180f9fc1,0x192fa0c0,0x190fa0bf,0x97020be,0x196fe0be,0xb701f3e,0x36fdf3e,0x1b2f9f40,0x1b6f9f3f,0xb301fc2,0x9302042,0x192fe042,0x1b2fdfc2,0xb309fc0,0x930a040,0x970a03f,0xb709fbf,
+	15,0x101fc0,0xfdfc0,0xfe040,0x10203f,0x101fbf,0xfdfbf,0xfe03f,0x102041,0x101fc1,0xfdfc1,0xfe041,0x106040,0x105fc0,0x105fbf,0x10603f,0x11020c0,0x106041,0x105fc1,0x3101f40,0x10fe0c0,0x11020bf,0x10fe0bf,0x30fdf40,0x3101f3f,0x30fdf3f,0x11020c1,0x10fe0c1,0x11060c0,0x11060bf,0x3101f41,0x30fdf41,0x3105f40,0x3105f3f,0x180f9fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x701fbe,0x70203e,0x186fe03e,0x186fdfbe,0x93060c1,0xb305f41,0x180f9fc1,0x180fa041,0x70603e,0x705fbe,0x192fa0c0,0x190fa0bf,0x97020be,0x196fe0be,0x1b2f9f40,0x1b0f9f3f,0xb301fc2,0x9302042,0x192fe042,0x1b2fdfc2,0xb701f3e,0x1b6fdf3e,0xb309fc0,0x930a040,0x970a03f,0xb709fbf,
+	15,0x101fc0,0xfdfc0,0xfe040,0x10203f,0x101fbf,0xfdfbf,0xfe03f,0x102041,0x101fc1,0xfdfc1,0xfe041,0x106040,0x105fc0,0x105fbf,0x10603f,0x106041,0x105fc1,0x11020c0,0x10fe0c0,0x11020bf,0x3101f40,0x30fdf40,0x3101f3f,0x10fe0bf,0x11020c1,0x10fe0c1,0x30fdf3f,0x3101f41,0x30fdf41,0x11060c0,0x11060bf,0x3105f40,0x3105f3f,0x180f9fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x93060c1,0xb305f41,0x701fbe,0x70203e,0x186fe03e,0x186fdfbe,0x180f9fc1,0x180fa041,0x190fa0c0,0x9302042,0xb301fc2,0x1b2fdfc2,0x192fe042,0x70603e,0x705fbe,0x1b2f9f40,0x1b6f9f3f,0x190fa0bf,0x97020be,0x196fe0be,0x192fa0c1,0x930a040,0xb309fc0,0xb709fbf,0x970a03f,0x13701f3e,
+	15,0x101fc0,0xfdfc0,0xfe040,0x10203f,0x101fbf,0xfdfbf,0xfe03f,0x102041,0x101fc1,0xfdfc1,0xfe041,0x106040,0x105fc0,0x105fbf,0x10603f,0x106041,0x105fc1,0x11020c0,0x10fe0c0,0x3101f40,0x30fdf40,0x11020bf,0x10fe0bf,0x11020c1,0x10fe0c1,0x3101f3f,0x30fdf3f,0x3101f41,0x30fdf41,0x11060c0,0x11060bf,0x3105f40,0x180f9fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x91060c1,0x3105f3f,0xb105f41,0x180f9fc1,0x180fa041,0x70203e,0x3701fbe,0x1b6fdfbe,0x186fe03e,0x1302042,0x3301fc2,0x1b2fdfc2,0x192fe042,0x190fa0c0,0x196fa0bf,0x70603e,0x3705fbe,0x1b2f9f40,0x1b6f9f3f,0x192fa0c1,0x9306042,0xb305fc2,0xb309fc0,0x930a040,0x970a03f,0xb709fbf,0x117020be,
+	11,0x10203f,0x101fbf,0x101fc0,0xfe040,0xfe03f,0xfdfbf,0xfdfc0,0x106040,0x10603f,0x105fbf,0x105fc0,0x11020c0,0x11020bf,0x10fe0bf,0x10fe0c0,0x302041,0x301fc1,0x2fdfc1,0x2fe041,0x70203e,0x701fbe,0x6fdfbe,0x6fe03e,0x3101f3f,0x3101f40,0x30fdf40,0x30fdf3f,0x11060bf,0x11060c0,0x306041,0x305fc1,0x70603e,0x705fbe,0x3105f3f,0x3105f40,0x180f9fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x13020c1,0x12fe0c1,0x17020be,0x16fe0be,0x3301f41,0x32fdf41,0x3701f3e,0x36fdf3e,0x93060c1,0x97060be,0x190fa0bf,0x190fa0c0,0x192fa041,0x182f9fc1,0xb305f41,0xb705f3e,0x186f9fbe,0x196fa03e,0x1b6f9f3f,0x1b2f9f40,0xb309fc0,0x930a040,0x970a03f,0xb709fbf,
+	11,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0xfdfbf,0x106040,0x10603f,0x105fbf,0x105fc0,0x301fc1,0x302041,0x11020c0,0x11020bf,0x10fe0bf,0x10fe0c0,0x2fe041,0x2fdfc1,0x3101f40,0x3101f3f,0x701fbe,0x70203e,0x6fe03e,0x6fdfbe,0x30fdf3f,0x30fdf40,0x305fc1,0x306041,0x11060c0,0x11060bf,0x13020c1,0x180fa040,0x180fa03f,0x180f9fbf,0x180f9fc0,0x12fe0c1,0x70603e,0x705fbe,0x3105f3f,0x3105f40,0x3301f41,0x32fdf41,0x17020be,0x16fe0be,0x93060c1,0x190fa0c0,0x190fa0bf,0x192fa041,0x182f9fc1,0x3701f3e,0x36fdf3e,0xb305f41,0x97060be,0x196fa03e,0x186f9fbe,0x1b6f9f3f,0x1b2f9f40,0xb705f3e,0xb709fbf,0x970a03f,0x930a040,0xb309fc0,
+	11,0x101fc0,0x10203f,0x101fbf,0xfe040,0xfdfc0,0xfe03f,0xfdfbf,0x106040,0x105fc0,0x105fbf,0x10603f,0x302041,0x301fc1,0x2fdfc1,0x2fe041,0x11020c0,0x11020bf,0x10fe0c0,0x10fe0bf,0x3101f40,0x3101f3f,0x30fdf40,0x30fdf3f,0x305fc1,0x306041,0x11060c0,0x11060bf,0x70203e,0x701fbe,0x6fdfbe,0x6fe03e,0x13020c1,0x12fe0c1,0x180fa040,0x180f9fc0,0x180f9fbf,0x180fa03f,0x3105f40,0x3105f3f,0x705fbe,0x70603e,0x3301f41,0x32fdf41,0x93060c1,0x17020be,0x16fe0be,0x182fa041,0x182f9fc1,0x192fa0c0,0x190fa0bf,0xb305f41,0x3701f3e,0x36fdf3e,0x97060be,0x970a03f,0x930a040,0xb309fc0,0xb709fbf,0x1b2f9f40,0x1b0f9f3f,0x1b6f9fbe,0x196fa03e,0xb705f3e,
+	11,0x101fc0,0x10203f,0x101fbf,0xfe040,0xfdfc0,0xfe03f,0xfdfbf,0x106040,0x105fc0,0x105fbf,0x10603f,0x302041,0x301fc1,0x2fdfc1,0x2fe041,0x11020c0,0x11020bf,0x10fe0c0,0x10fe0bf,0x306041,0x305fc1,0x3101f40,0x3101f3f,0x30fdf40,0x30fdf3f,0x11060c0,0x11060bf,0x13020c1,0x12fe0c1,0x70203e,0x701fbe,0x6fdfbe,0x6fe03e,0x180fa040,0x180f9fc0,0x180f9fbf,0x180fa03f,0x3105f40,0x3105f3f,0x3301f41,0x32fdf41,0x93060c1,0x70603e,0x705fbe,0x17020be,0x16fe0be,0x182fa041,0x182f9fc1,0xb305f41,0x192fa0c0,0x190fa0bf,0x3701f3e,0x36fdf3e,0x1b0f9f3f,0x1b2f9f40,0x97060be,0x970a03f,0x930a040,0xb309fc0,0xb709fbf,0xb705f3e,0x1b6f9fbe,0x196fa03e,
+	14,0x101fc0,0x10203f,0xfe040,0xfdfc0,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0x105fc0,0x106040,0x10603f,0x105fbf,0xfe041,0xfdfc1,0x11020c0,0x11020bf,0x10fe0c0,0x10fe0bf,0x106041,0x105fc1,0x3101f40,0x30fdf40,0x3101f3f,0x30fdf3f,0x11020c1,0x11060c0,0x11060bf,0x10fe0c1,0x180fa040,0x180f9fc0,0x180f9fbf,0x701fbe,0x70203e,0x6fe03e,0x186fdfbe,0x186fa03f,0x3101f41,0x3105f40,0x3105f3f,0x32fdf41,0x93060c1,0x70603e,0x705fbe,0x180fa041,0x182f9fc1,0xb305f41,0x17020be,0x16fe0be,0x192fa0c0,0x196fa0bf,0x1b2f9f40,0x1b0f9f3f,0xb701f3e,0x1b6fdf3e,0xb309fc0,0x930a040,0x970a03f,0x97060be,0xb709fbf,0xb301fc2,0x9302042,0x1a2fe042,
+	13,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0xfdfc1,0xfe041,0x106040,0x105fc0,0x105fbf,0x10603f,0x11020c0,0x10fe0c0,0x11020bf,0x106041,0x105fc1,0x10fe0bf,0x3101f40,0x30fdf40,0x3101f3f,0x11020c1,0x10fe0c1,0x11060c0,0x11060bf,0x30fdf3f,0x180f9fc0,0x180fa040,0x3101f41,0x30fdf41,0x3105f40,0xb105f3f,0x701fbe,0x70203e,0x180fa03f,0x180f9fbf,0x186fdfbe,0x186fe03e,0x93060c1,0x180fa041,0x180f9fc1,0xb305f41,0x8705fbe,0x70603e,0x190fa0c0,0x190fa0bf,0x97020be,0x196fe0be,0x9302042,0xb301fc2,0x1b2fdfc2,0x192fe042,0x192fa0c1,0x1b2f9f40,0x1b0f9f3f,0xb701f3e,0x1b6fdf3e,0xb309fc0,0x930a040,0xa70a03f,
+	15,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0xfdfc1,0xfe041,0x106040,0x105fc0,0x105fbf,0x10603f,0x11020c0,0x106041,0x105fc1,0x10fe0c0,0x11020bf,0x10fe0bf,0x11020c1,0x10fe0c1,0x3101f40,0x30fdf40,0x3101f3f,0x30fdf3f,0x11060c0,0x11060bf,0x3101f41,0x30fdf41,0x180f9fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x3105f40,0x93060c1,0x3105f3f,0x3701fbe,0x70203e,0x186fe03e,0x1b6fdfbe,0x180fa041,0x180f9fc1,0xb105f41,0x3301fc2,0x9302042,0x190fa0c0,0x190fa0bf,0x70603e,0x3705fbe,0x192fe042,0x1b2fdfc2,0x192fa0c1,0x97020be,0x196fe0be,0x1b2f9f40,0x1b6f9f3f,0xb309fc0,0x930a040,0x970a03f,0xb709fbf,0xb305fc2,
+	13,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfdfbf,0xfe03f,0x102041,0x101fc1,0xfdfc1,0xfe041,0x106040,0x105fc0,0x105fbf,0x10603f,0x106041,0x105fc1,0x11020c0,0x10fe0c0,0x11020bf,0x10fe0bf,0x11020c1,0x10fe0c1,0x3101f40,0x30fdf40,0x3101f3f,0x11060c0,0x11060bf,0x3101f41,0x30fdf3f,0x30fdf41,0x180f9fc0,0x180fa040,0x91060c1,0x3105f40,0xb105f3f,0x180f9fbf,0x180fa03f,0x180fa041,0x180f9fc1,0xb105f41,0x3701fbe,0x70203e,0x186fe03e,0x1b6fdfbe,0x1302042,0x3301fc2,0x1b2fdfc2,0x192fe042,0x190fa0c0,0x190fa0bf,0x192fa0c1,0x70603e,0xb705fbe,0x1b2f9f40,0x1b6f9f3f,0xb305fc2,0x9306042,0x930a040,0xb309fc0,0x97020be,0x196fe0be,0xa70a03f,
+	11,0x10203f,0x101fbf,0x101fc0,0xfe040,0xfe03f,0xfdfbf,0xfdfc0,0x106040,0x10603f,0x105fbf,0x105fc0,0x11020c0,0x11020bf,0x10fe0bf,0x10fe0c0,0x302041,0x301fc1,0x2fe041,0x2fdfc1,0x70203e,0x701fbe,0x6fe03e,0x6fdfbe,0x11060bf,0x11060c0,0x3101f40,0x3101f3f,0x30fdf3f,0x30fdf40,0x305fc1,0x306041,0x13020c1,0x70603e,0x705fbe,0x180fa03f,0x180fa040,0x180f9fc0,0x180f9fbf,0x12fe0c1,0x17020be,0x16fe0be,0x3105f3f,0x3105f40,0x93060c1,0x3301f41,0x32fdf41,0x190fa0c0,0x190fa0bf,0x97060be,0x3701f3e,0x36fdf3e,0x182f9fc1,0x192fa041,0x196fa03e,0x186f9fbe,0x1b6f9f3f,0xb305f41,0xb309fc0,0x930a040,0x970a03f,0xb709fbf,0xb705f3e,0x1b2f9f40,
+	11,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0xfdfbf,0x106040,0x10603f,0x105fbf,0x105fc0,0x11020c0,0x11020bf,0x10fe0bf,0x10fe0c0,0x302041,0x301fc1,0x2fe041,0x2fdfc1,0x70203e,0x701fbe,0x6fe03e,0x6fdfbe,0x11060bf,0x11060c0,0x306041,0x305fc1,0x3101f40,0x3101f3f,0x30fdf3f,0x30fdf40,0x13020c1,0x12fe0c1,0x180fa040,0x180fa03f,0x180f9fbf,0x180f9fc0,0x70603e,0x705fbe,0x3105f3f,0x3105f40,0x17020be,0x16fe0be,0x93060c1,0x3301f41,0x32fdf41,0x190fa0c0,0x190fa0bf,0x192fa041,0x182f9fc1,0x97060be,0x3701f3e,0x36fdf3e,0xb305f41,0xb309fc0,0x930a040,0x970a03f,0xb709fbf,0x196fa03e,0x186f9fbe,0x1b6f9f3f,0x1b2f9f40,0xb705f3e,
+	11,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0xfdfbf,0x106040,0x10603f,0x105fc0,0x105fbf,0x302041,0x11020c0,0x11020bf,0x301fc1,0x2fe041,0x10fe0c0,0x10fe0bf,0x2fdfc1,0x306041,0x11060c0,0x11060bf,0x305fc1,0x3101f40,0x3101f3f,0x701fbe,0x70203e,0x6fe03e,0x6fdfbe,0x30fdf3f,0x30fdf40,0x13020c1,0x12fe0c1,0x180fa040,0x180fa03f,0x180f9fc0,0x180f9fbf,0x70603e,0x705fbe,0x3105f3f,0x3105f40,0x93060c1,0x17020be,0x16fe0be,0x3301f41,0x32fdf41,0x182f9fc1,0x182fa041,0x192fa0c0,0x190fa0bf,0x97060be,0xb305f41,0x3701f3e,0x36fdf3e,0x186f9fbe,0x196fa03e,0x1b6f9f3f,0x1b2f9f40,0x930a040,0x970a03f,0xb709fbf,0xb309fc0,0xb705f3e,
+	11,0x101fc0,0x10203f,0x101fbf,0xfe040,0xfdfc0,0xfe03f,0xfdfbf,0x106040,0x105fc0,0x10603f,0x105fbf,0x302041,0x301fc1,0x2fe041,0x2fdfc1,0x11020c0,0x11020bf,0x10fe0c0,0x10fe0bf,0x306041,0x305fc1,0x11060c0,0x11060bf,0x13020c1,0x12fe0c1,0x3101f40,0x3101f3f,0x30fdf40,0x30fdf3f,0x701fbe,0x70203e,0x6fe03e,0x6fdfbe,0x180fa040,0x180f9fc0,0x180fa03f,0x180f9fbf,0x3105f40,0x3105f3f,0x93060c1,0x3301f41,0x32fdf41,0x70603e,0x705fbe,0x17020be,0x16fe0be,0x182fa041,0x182f9fc1,0x190fa0c0,0x190fa0bf,0xb305f41,0x97060be,0xb701f3e,0x36fdf3e,0x1b0f9f3f,0x1b2f9f40,0x192fa0c1,0x930a040,0xb309fc0,0xb709fbf,0x970a03f,0x196fa03e,0x1b6f9fbe,
+	11,0x101fc0,0x10203f,0xfe040,0xfdfc0,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x106040,0x105fc0,0x101fc1,0xfe041,0xfdfc1,0x10603f,0x105fbf,0x11020c0,0x11020bf,0x10fe0c0,0x10fe0bf,0x106041,0x105fc1,0x11020c1,0x11060c0,0x11060bf,0x12fe0c1,0x3101f40,0x30fdf40,0x3101f3f,0x30fdf3f,0x180f9fc0,0x180fa040,0x180fa03f,0x70203e,0x701fbe,0x186fe03e,0x6fdfbe,0x186f9fbf,0x93060c1,0x3105f40,0x3101f41,0x30fdf41,0x3105f3f,0x705fbe,0x70603e,0x182fa041,0x180f9fc1,0x190fa0c0,0x190fa0bf,0x17020be,0x196fe0be,0xb305f41,0xb309fc0,0x930a040,0x97060be,0x970a03f,0xb709fbf,0xb701f3e,0x1b6fdf3e,0x1b4f9f40,0x192fa0c1,0x11302042,0xb301fc2,0x1b2fdfc2,
+	15,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0xfe041,0xfdfc1,0x106040,0x105fc0,0x10603f,0x105fbf,0x11020c0,0x10fe0c0,0x11020bf,0x10fe0bf,0x106041,0x105fc1,0x11020c1,0x10fe0c1,0x11060c0,0x11060bf,0x3101f40,0x30fdf40,0x3101f3f,0x30fdf3f,0x180f9fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x93060c1,0x3101f41,0x30fdf41,0x3105f40,0x3701fbe,0x70203e,0x186fe03e,0x1b6fdfbe,0x3105f3f,0x180fa041,0x180f9fc1,0xb305f41,0x3705fbe,0x70603e,0x190fa0c0,0x190fa0bf,0x17020be,0x196fe0be,0x192fa0c1,0x9302042,0xb301fc2,0x1b2fdfc2,0x192fe042,0x1b2f9f40,0x1b6f9f3f,0x930a040,0xb309fc0,0xb709fbf,0x970a03f,0x97060be,
+	15,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0xfe041,0xfdfc1,0x106040,0x105fc0,0x10603f,0x105fbf,0x11020c0,0x10fe0c0,0x11020bf,0x106041,0x105fc1,0x10fe0bf,0x11020c1,0x10fe0c1,0x11060c0,0x11060bf,0x3101f40,0x30fdf40,0x3101f3f,0x30fdf3f,0x180f9fc0,0x180fa040,0x91060c1,0x3101f41,0x30fdf41,0x180f9fbf,0x180fa03f,0x3105f40,0x3105f3f,0x3701fbe,0x70203e,0x186fe03e,0x1b6fdfbe,0x180fa041,0x180f9fc1,0xb105f41,0x190fa0c0,0x190fa0bf,0x70603e,0x3705fbe,0x1302042,0x3301fc2,0x1b2fdfc2,0x192fe042,0x192fa0c1,0x97020be,0x196fe0be,0x930a040,0xb309fc0,0xb709fbf,0x970a03f,0x9306042,0xb305fc2,0x1b4f9f40,
+	13,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0x102041,0x101fc1,0xfdfbf,0xfe041,0xfdfc1,0x106040,0x105fc0,0x10603f,0x11020c0,0x10fe0c0,0x105fbf,0x106041,0x105fc1,0x11020bf,0x10fe0bf,0x11020c1,0x10fe0c1,0x11060c0,0x3101f40,0x30fdf40,0x3101f3f,0x91060bf,0x91060c1,0x3101f41,0x30fdf41,0x30fdf3f,0x180f9fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x3105f40,0xb105f3f,0x180fa041,0x180f9fc1,0xb105f41,0x3701fbe,0x70203e,0x186fe03e,0x1b6fdfbe,0x190fa0c0,0x302042,0x3301fc2,0x1b2fdfc2,0x182fe042,0x192fa0c1,0x190fa0bf,0x870603e,0xb705fbe,0x97020be,0x196fe0be,0x8306042,0xb305fc2,0x950a040,0xb509fc0,0x1b2f9f40,0x1b6f9f3f,0x113020c2,
+	11,0x10203f,0x101fbf,0x101fc0,0xfe040,0xfe03f,0xfdfbf,0xfdfc0,0x106040,0x10603f,0x105fbf,0x105fc0,0x11020c0,0x11020bf,0x10fe0bf,0x10fe0c0,0x302041,0x301fc1,0x2fe041,0x2fdfc1,0x70203e,0x701fbe,0x6fe03e,0x11060bf,0x11060c0,0x6fdfbe,0x3101f3f,0x3101f40,0x306041,0x305fc1,0x13020c1,0x12fe0c1,0x30fdf40,0x30fdf3f,0x70603e,0x705fbe,0x17020be,0x180fa03f,0x180fa040,0x180f9fc0,0x180f9fbf,0x16fe0be,0x3105f3f,0x3105f40,0x93060c1,0x97060be,0x190fa0bf,0x190fa0c0,0x3301f41,0x32fdf41,0x182f9fc1,0x192fa041,0x3701f3e,0x36fdf3e,0x186f9fbe,0x196fa03e,0x970a03f,0x930a040,0xb309fc0,0xb305f41,0xb709fbf,0xb705f3e,0x1b6f9f3f,0x1b2f9f40,
+	11,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0xfdfbf,0x106040,0x10603f,0x105fbf,0x105fc0,0x11020c0,0x11020bf,0x10fe0bf,0x10fe0c0,0x302041,0x301fc1,0x2fe041,0x2fdfc1,0x11060c0,0x11060bf,0x70203e,0x701fbe,0x6fe03e,0x6fdfbe,0x306041,0x305fc1,0x13020c1,0x12fe0c1,0x3101f40,0x3101f3f,0x30fdf3f,0x30fdf40,0x180fa040,0x180fa03f,0x180f9fbf,0x180f9fc0,0x70603e,0x705fbe,0x17020be,0x16fe0be,0x93060c1,0x3105f40,0x3105f3f,0x3301f41,0x32fdf41,0x190fa0c0,0x190fa0bf,0x97060be,0x192fa041,0x182f9fc1,0x3701f3e,0x36fdf3e,0x186f9fbe,0x196fa03e,0xb305f41,0xb309fc0,0x930a040,0x970a03f,0xb709fbf,0xb705f3e,0x1b6f9f3f,0x1b2f9f40,
+	11,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0xfdfbf,0x106040,0x10603f,0x105fc0,0x105fbf,0x11020c0,0x11020bf,0x10fe0c0,0x10fe0bf,0x302041,0x301fc1,0x2fe041,0x2fdfc1,0x11060c0,0x11060bf,0x306041,0x305fc1,0x13020c1,0x12fe0c1,0x70203e,0x701fbe,0x6fe03e,0x6fdfbe,0x3101f3f,0x3101f40,0x30fdf40,0x30fdf3f,0x180fa040,0x180fa03f,0x180f9fc0,0x180f9fbf,0x70603e,0x705fbe,0x93060c1,0x17020be,0x16fe0be,0x3105f40,0x3105f3f,0x3301f41,0x32fdf41,0x190fa0c0,0x190fa0bf,0x182fa041,0x182f9fc1,0x97060be,0xb305f41,0xb701f3e,0x36fdf3e,0x186f9fbe,0x196fa03e,0x192fa0c1,0x930a040,0x970a03f,0xb709fbf,0xb309fc0,0x1b2f9f40,0x1b6f9f3f,
+	12,0x10203f,0x101fc0,0xfe040,0x101fbf,0xfe03f,0xfdfc0,0xfdfbf,0x106040,0x10603f,0x105fc0,0x105fbf,0x102041,0x11020c0,0x11020bf,0x10fe0c0,0xfe041,0x101fc1,0xfdfc1,0x10fe0bf,0x11060c0,0x106041,0x105fc1,0x11060bf,0x11020c1,0x12fe0c1,0x70203e,0x701fbe,0x3101f40,0x3101f3f,0x30fdf40,0x30fdf3f,0x6fe03e,0x6fdfbe,0x180fa040,0x186fa03f,0x180f9fc0,0x186f9fbf,0x93060c1,0x70603e,0x705fbe,0x3105f40,0x3105f3f,0x3101f41,0x32fdf41,0x17020be,0x16fe0be,0x196fa0bf,0x190fa0c0,0x182fa041,0x182f9fc1,0xb305f41,0x97060be,0x970a03f,0x930a040,0xb309fc0,0xb709fbf,0xb701f3e,0x36fdf3e,0x192fa0c1,0x11302042,0x13301fc2,0x1b2f9f40,0x1b6f9f3f,
+	12,0x101fc0,0x10203f,0xfe040,0xfdfc0,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x106040,0x105fc0,0x101fc1,0xfe041,0x11020c0,0x10603f,0x105fbf,0xfdfc1,0x10fe0c0,0x11020bf,0x10fe0bf,0x106041,0x105fc1,0x11020c1,0x11060c0,0x11060bf,0x10fe0c1,0x3101f40,0x30fdf40,0x3101f3f,0x30fdf3f,0x70203e,0x701fbe,0x6fe03e,0x180fa040,0x1b0f9fc0,0x186fa03f,0x1b0f9fbf,0x186fdfbe,0x93060c1,0x3105f40,0x3101f41,0x30fdf41,0x3105f3f,0x705fbe,0x70603e,0x17020be,0x180fa041,0x1b0f9fc1,0x190fa0c0,0x190fa0bf,0x196fe0be,0xb305f41,0x97060be,0x192fa0c1,0x9302042,0xb301fc2,0x192fe042,0x1b2fdfc2,0x930a040,0xb309fc0,0x970a03f,0xb709fbf,0xb701f3e,0x1b6fdf3e,
+	13,0x101fc0,0xfe040,0x10203f,0xfdfc0,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0xfe041,0x106040,0x105fc0,0xfdfc1,0x11020c0,0x10603f,0x105fbf,0x10fe0c0,0x11020bf,0x10fe0bf,0x106041,0x105fc1,0x11020c1,0x10fe0c1,0x11060c0,0x11060bf,0x3101f40,0x30fdf40,0x3101f3f,0x30fdf3f,0x180fa040,0x93060c1,0x180f9fc0,0x180fa03f,0x180f9fbf,0x70203e,0x3701fbe,0x186fe03e,0x1b6fdfbe,0x3101f41,0x30fdf41,0x3105f40,0x3105f3f,0x180fa041,0x180f9fc1,0x190fa0c0,0x190fa0bf,0x70603e,0x3705fbe,0x17020be,0x196fe0be,0xb305f41,0x9302042,0x192fa0c1,0x192fe042,0xb301fc2,0x1b2fdfc2,0x930a040,0xb309fc0,0x97060be,0x970a03f,0xb709fbf,0x1b2f9f40,0x1b6f9f3f,
+	13,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0xfe041,0xfdfc1,0x106040,0x105fc0,0x11020c0,0x10fe0c0,0x10603f,0x105fbf,0x11020bf,0x10fe0bf,0x106041,0x105fc1,0x11020c1,0x10fe0c1,0x11060c0,0x11060bf,0x91060c1,0x3101f40,0x30fdf40,0x3101f3f,0x30fdf3f,0x180fa040,0x1b0f9fc0,0x180fa03f,0x1b0f9fbf,0x3101f41,0x30fdf41,0x180fa041,0x1b0f9fc1,0x70203e,0x3701fbe,0x186fe03e,0x1b6fdfbe,0x3105f40,0x3105f3f,0xb105f41,0x190fa0c0,0x190fa0bf,0x70603e,0x3705fbe,0x17020be,0x196fe0be,0x192fa0c1,0x1302042,0x3301fc2,0x192fe042,0x1b2fdfc2,0x9306042,0x930a040,0xb309fc0,0x970a03f,0x97060be,0xb709fbf,0xb305fc2,
+	13,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0x102041,0x101fc1,0xfe041,0xfdfbf,0xfdfc1,0x106040,0x105fc0,0x11020c0,0x10fe0c0,0x10603f,0x105fbf,0x106041,0x105fc1,0x11020bf,0x10fe0bf,0x11020c1,0x10fe0c1,0x11060c0,0x11060bf,0x91060c1,0x3101f40,0x30fdf40,0x180fa040,0x1b0f9fc0,0x3101f3f,0x30fdf3f,0x3101f41,0x30fdf41,0x180fa03f,0x1b0f9fbf,0x180fa041,0x1b0f9fc1,0x3105f40,0xb105f3f,0x70203e,0x3701fbe,0x186fe03e,0x1b6fdfbe,0x190fa0c0,0x302042,0xb105f41,0x3301fc2,0x182fe042,0x1b2fdfc2,0x190fa0c1,0x190fa0bf,0x70603e,0xb705fbe,0x97020be,0x196fe0be,0x8306042,0xb305fc2,0x93020c2,0x192fe0c2,0x930a040,0xb309fc0,0xa70a03f,
+	15,0x10203f,0x101fbf,0x101fc0,0xfe040,0xfe03f,0xfdfbf,0xfdfc0,0x1020c0,0x1020bf,0x10603f,0x106040,0x105fc0,0x105fbf,0xfe0bf,0xfe0c0,0x302041,0x301fc1,0x2fe041,0x1060c0,0x1060bf,0x70203e,0x701fbe,0x6fe03e,0x2fdfc1,0x6fdfbe,0x3020c1,0x306041,0x305fc1,0x2fe0c1,0x180fa040,0x180fa03f,0x7020be,0x70603e,0x705fbe,0x3101f3f,0x3101f40,0x30fdf40,0x30fdf3f,0x1b0f9fbf,0x1b0f9fc0,0x6fe0be,0x93060c1,0x97060be,0x3105f3f,0x3105f40,0x180fa0c0,0x180fa0bf,0x192fa041,0x182f9fc1,0xb301f41,0x1b2fdf41,0xb701f3e,0x36fdf3e,0x196fa03e,0x1b6f9fbe,0x970213f,0x9302140,0x192fe140,0x196fe13f,0x970a03f,0x930a040,0xb309fc0,0xb709fbf,
+	14,0x10203f,0x101fc0,0xfe040,0xfe03f,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0x10603f,0x106040,0x105fc0,0x105fbf,0xfe0c0,0xfe0bf,0x302041,0x301fc1,0x2fe041,0x2fdfc1,0x1060c0,0x1060bf,0x70203e,0x6fe03e,0x701fbe,0x6fdfbe,0x3020c1,0x306041,0x305fc1,0x2fe0c1,0x180fa040,0x180fa03f,0x180f9fbf,0x3101f3f,0x3101f40,0x30fdf40,0x1b0fdf3f,0x1b0f9fc0,0x7020be,0x70603e,0x705fbe,0x16fe0be,0x93060c1,0x3105f40,0x3105f3f,0x180fa0c0,0x190fa0bf,0x97060be,0x3301f41,0x32fdf41,0x192fa041,0x1b2f9fc1,0x196fa03e,0x186f9fbe,0xb701f3e,0x1b6fdf3e,0x970a03f,0x930a040,0xb309fc0,0xb305f41,0xb709fbf,0x970213f,0x9302140,0x194fe140,
+	11,0x10203f,0x101fc0,0xfe040,0xfe03f,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x106040,0x10603f,0x1020bf,0xfe0c0,0xfe0bf,0x105fc0,0x105fbf,0x302041,0x301fc1,0x2fe041,0x2fdfc1,0x1060c0,0x1060bf,0x3020c1,0x306041,0x305fc1,0x12fe0c1,0x70203e,0x6fe03e,0x701fbe,0x6fdfbe,0x180fa03f,0x180fa040,0x180f9fc0,0x3101f40,0x3101f3f,0x1b0fdf40,0x30fdf3f,0x1b0f9fbf,0x93060c1,0x70603e,0x7020be,0x6fe0be,0x705fbe,0x3105f3f,0x3105f40,0x190fa0c0,0x180fa0bf,0x182fa041,0x182f9fc1,0x3301f41,0x1b2fdf41,0x97060be,0x970a03f,0x930a040,0xb305f41,0xb309fc0,0xb709fbf,0xb701f3e,0x1b6fdf3e,0x1a6fa03e,0x192fa0c1,0x11302140,0x970213f,0x196fe13f,
+	12,0x10203f,0x101fc0,0xfe040,0xfe03f,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x106040,0x10603f,0x1020bf,0xfe0c0,0x302041,0x105fc0,0x105fbf,0xfe0bf,0x2fe041,0x301fc1,0x2fdfc1,0x1060c0,0x1060bf,0x3020c1,0x306041,0x305fc1,0x2fe0c1,0x70203e,0x6fe03e,0x701fbe,0x6fdfbe,0x3101f40,0x3101f3f,0x30fdf40,0x180fa040,0x186fa03f,0x1b0f9fc0,0x186f9fbf,0x1b0fdf3f,0x93060c1,0x70603e,0x7020be,0x6fe0be,0x705fbe,0x3105f3f,0x3105f40,0x3301f41,0x180fa0c0,0x186fa0bf,0x182fa041,0x182f9fc1,0x1b2fdf41,0x97060be,0xb305f41,0x192fa0c1,0x9302140,0x970213f,0x192fe140,0x196fe13f,0x930a040,0x970a03f,0xb309fc0,0xb709fbf,0xb701f3e,0x1b6fdf3e,
+	17,0x10203f,0x101fc0,0xfe040,0xfe03f,0x101fbf,0xfdfc0,0xfdfbf,0x102041,0x1020c0,0x106040,0x10603f,0x1020bf,0xfe0c0,0xfe041,0x101fc1,0x105fc0,0x105fbf,0xfe0bf,0xfdfc1,0x1020c1,0x106041,0x1060c0,0x1060bf,0xfe0c1,0x105fc1,0x93060c1,0x70203e,0x6fe03e,0x180fa040,0x186fa03f,0x180f9fc0,0x3101f40,0x3101f3f,0x3701fbe,0x1b0fdf40,0x30fdf3f,0x36fdfbe,0x1b6f9fbf,0x180fa0c0,0x180fa041,0x182f9fc1,0x3101f41,0x3105f40,0x3105f3f,0x70603e,0x7020be,0x16fe0be,0x196fa0bf,0x3705fbe,0x1b2fdf41,0xb305f41,0x97060be,0x192fa0c1,0x9302042,0x192fe042,0x13301fc2,0x930a040,0x970a03f,0xb309fc0,0xb709fbf,0x9302140,0x970213f,0x194fe140,
+	17,0x101fc0,0xfe040,0x10203f,0xfdfc0,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0xfe041,0x1020c0,0x106040,0x105fc0,0xfdfc1,0xfe0c0,0x1020bf,0x10603f,0x105fbf,0xfe0bf,0x1020c1,0x106041,0x105fc1,0x1060c0,0xfe0c1,0x1060bf,0x93060c1,0x3101f40,0x30fdf40,0x180fa040,0x1b0f9fc0,0x180fa03f,0x180f9fbf,0x3101f3f,0x1b0fdf3f,0x70203e,0x3701fbe,0x186fe03e,0x1b6fdfbe,0x3101f41,0x30fdf41,0x180fa041,0x1b0f9fc1,0x180fa0c0,0x190fa0bf,0x3105f40,0xb105f3f,0x70603e,0x7020be,0x196fe0be,0xb705fbe,0xb305f41,0x192fa0c1,0x9302042,0xb301fc2,0x192fe042,0x1b2fdfc2,0x97060be,0x9302140,0x192fe140,0x1170213f,0x930a040,0xb309fc0,0xa70a03f,
+	17,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0xfe041,0xfdfc1,0x1020c0,0x106040,0x105fc0,0xfe0c0,0x1020bf,0x10603f,0x105fbf,0xfe0bf,0x1020c1,0x106041,0x105fc1,0xfe0c1,0x1060c0,0x1060bf,0x93060c1,0x3101f40,0x30fdf40,0x180fa040,0x1b0f9fc0,0x180fa03f,0x180f9fbf,0x3101f3f,0x1b0fdf3f,0x70203e,0x3701fbe,0x186fe03e,0x180fa041,0x180f9fc1,0x3101f41,0x1b0fdf41,0x3105f40,0x1b6fdfbe,0x180fa0c0,0x190fa0bf,0xb105f3f,0x70603e,0x7020be,0x196fe0be,0x192fa0c1,0x9302042,0xb305f41,0xb301fc2,0x192fe042,0x1b2fdfc2,0xb705fbe,0x930a040,0xb309fc0,0x9302140,0x192fe140,0x1170213f,0x97060be,0xa70a03f,
+	13,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0x102041,0x101fc1,0xfe041,0xfdfbf,0xfdfc1,0x1020c0,0x106040,0x105fc0,0xfe0c0,0x1020bf,0x10603f,0x8105fbf,0x106041,0x1020c1,0xfe0bf,0xfe0c1,0x8105fc1,0x1060c0,0x91060bf,0x91060c1,0x3101f40,0x30fdf40,0x180fa040,0x1b0f9fc0,0x180fa03f,0x180f9fbf,0x3101f3f,0x1b0fdf3f,0x3101f41,0x30fdf41,0x180fa041,0x1b0f9fc1,0x180fa0c0,0x70203e,0x3701fbe,0xb105f40,0xb105f3f,0x186fe03e,0x1b6fdfbe,0x190fa0bf,0x190fa0c1,0x302042,0x3301fc2,0x182fe042,0x1b2fdfc2,0xb105f41,0x870603e,0x97020be,0x196fe0be,0xb705fbe,0xa50a040,0x8306042,0x93020c2,0x192fe0c2,0x9502140,0x194fe140,0xb305fc2,
+	15,0x10203f,0xfe03f,0xfe040,0x101fc0,0x101fbf,0xfdfbf,0xfdfc0,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x106040,0x10603f,0x105fbf,0x105fc0,0x302041,0x1060c0,0x1060bf,0x70203e,0x2fe041,0x301fc1,0x2fdfc1,0x6fe03e,0x701fbe,0x6fdfbe,0x3020c1,0x2fe0c1,0x306041,0x305fc1,0x7020be,0x6fe0be,0x70603e,0x705fbe,0x180fa03f,0x180fa040,0x180f9fc0,0x180f9fbf,0x3101f3f,0x3101f40,0x1b0fdf40,0x1b0fdf3f,0x93060c1,0x97060be,0x180fa0bf,0x180fa0c0,0x3105f40,0x3105f3f,0x192fa041,0x182f9fc1,0xb301f41,0x1b2fdf41,0x196fa03e,0x186f9fbe,0x970213f,0x9302140,0x192fe140,0x196fe13f,0xb701f3e,0x1b6fdf3e,0x970a03f,0x930a040,0xb309fc0,0xb709fbf,
+	13,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x106040,0x10603f,0x105fbf,0x105fc0,0x302041,0x2fe041,0x301fc1,0x1060c0,0x1060bf,0x2fdfc1,0x70203e,0x6fe03e,0x701fbe,0x3020c1,0x2fe0c1,0x306041,0x305fc1,0x6fdfbe,0x180fa03f,0x180fa040,0x7020be,0x6fe0be,0x70603e,0x8705fbe,0x3101f3f,0x3101f40,0x180f9fc0,0x180f9fbf,0x1b0fdf3f,0x1b0fdf40,0x93060c1,0x180fa0c0,0x180fa0bf,0x97060be,0xb105f3f,0x3105f40,0x182fa041,0x182f9fc1,0xb301f41,0x1b2fdf41,0x9302140,0x970213f,0x196fe13f,0x192fe140,0x192fa0c1,0x196fa03e,0x186f9fbe,0xb701f3e,0x1b6fdf3e,0x970a03f,0x930a040,0xb509fc0,
+	15,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0xfe0c0,0xfe0bf,0x106040,0x10603f,0x105fc0,0x105fbf,0x302041,0x2fe041,0x301fc1,0x2fdfc1,0x1060c0,0x1060bf,0x3020c1,0x2fe0c1,0x306041,0x305fc1,0x70203e,0x6fe03e,0x701fbe,0x6fdfbe,0x180fa03f,0x180fa040,0x180f9fc0,0x180f9fbf,0x93060c1,0x7020be,0x6fe0be,0x70603e,0x3701f3f,0x3101f40,0x1b0fdf40,0x1b6fdf3f,0x705fbe,0x180fa0c0,0x180fa0bf,0x97060be,0x3705f3f,0x3105f40,0x182fa041,0x182f9fc1,0x3301f41,0x1b2fdf41,0x192fa0c1,0x9302140,0x970213f,0x196fe13f,0x192fe140,0x196fa03e,0x1b6f9fbe,0x930a040,0x970a03f,0xb709fbf,0xb309fc0,0xb305f41,
+	13,0x10203f,0xfe040,0x101fc0,0xfe03f,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0xfe0c0,0x106040,0x10603f,0xfe0bf,0x302041,0x105fc0,0x105fbf,0x2fe041,0x301fc1,0x2fdfc1,0x1060c0,0x1060bf,0x3020c1,0x2fe0c1,0x306041,0x305fc1,0x70203e,0x6fe03e,0x701fbe,0x6fdfbe,0x180fa040,0x93060c1,0x180fa03f,0x180f9fc0,0x180f9fbf,0x3101f40,0x3701f3f,0x1b0fdf40,0x1b6fdf3f,0x7020be,0x6fe0be,0x70603e,0x705fbe,0x180fa0c0,0x180fa0bf,0x182fa041,0x182f9fc1,0x3105f40,0x3705f3f,0x3301f41,0x1b2fdf41,0x97060be,0x9302140,0x192fa0c1,0x192fe140,0x970213f,0x196fe13f,0x930a040,0x970a03f,0xb305f41,0xb309fc0,0xb709fbf,0x196fa03e,0x1b6f9fbe,
+	17,0x10203f,0xfe040,0x101fc0,0xfe03f,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0xfe0c0,0x102041,0x106040,0x10603f,0xfe0bf,0xfe041,0x101fc1,0x105fc0,0x105fbf,0xfdfc1,0x1020c1,0x1060c0,0x1060bf,0x106041,0xfe0c1,0x105fc1,0x93060c1,0x70203e,0x6fe03e,0x180fa040,0x186fa03f,0x180f9fc0,0x180f9fbf,0x701fbe,0x186fdfbe,0x3101f40,0x3701f3f,0x1b0fdf40,0x1b6fdf3f,0x7020be,0x6fe0be,0x180fa0c0,0x186fa0bf,0x180fa041,0x182f9fc1,0x70603e,0x8705fbe,0x3105f40,0x3101f41,0x1b2fdf41,0xb705f3f,0x97060be,0x192fa0c1,0x9302140,0x970213f,0x192fe140,0x196fe13f,0xb305f41,0x9302042,0x192fe042,0x13301fc2,0x930a040,0x970a03f,0xb509fc0,
+	16,0xfe040,0x10203f,0x101fc0,0xfdfc0,0xfe03f,0x101fbf,0xfdfbf,0x102041,0x1020c0,0xfe0c0,0xfe041,0x106040,0x1020bf,0x101fc1,0xfdfc1,0x105fc0,0x10603f,0xfe0bf,0x105fbf,0x1020c1,0xfe0c1,0x106041,0x1060c0,0x81060bf,0x105fc1,0x93060c1,0x180fa040,0x180f9fc0,0x180fa03f,0x70203e,0x186fe03e,0x3101f40,0x1b0fdf40,0x180f9fbf,0x701fbe,0x3701f3f,0x1b0fdf3f,0x1b6fdfbe,0x180fa0c0,0x180fa041,0x180f9fc1,0x180fa0bf,0x7020be,0x186fe0be,0x870603e,0x3101f41,0x1b0fdf41,0x3105f40,0xb105f3f,0xb705fbe,0x192fa0c1,0x9302042,0x192fe042,0x9302140,0x192fe140,0x97060be,0x970213f,0x196fe13f,0xb305f41,0xb301fc2,0x1b2fdfc2,0x950a040,0xb509fc0,
+	15,0xfe040,0x101fc0,0x10203f,0xfdfc0,0xfe03f,0x101fbf,0xfdfbf,0x102041,0xfe041,0x1020c0,0x101fc1,0x106040,0xfe0c0,0xfdfc1,0x1020bf,0xfe0bf,0x105fc0,0x10603f,0x105fbf,0x1020c1,0xfe0c1,0x106041,0x1060c0,0x105fc1,0x81060bf,0x91060c1,0x180fa040,0x180f9fc0,0x180fa03f,0x3101f40,0x1b0fdf40,0x180f9fbf,0x3101f3f,0x70203e,0x186fe03e,0x180fa041,0x180fa0c0,0x1b0fdf3f,0x3701fbe,0x1b6fdfbe,0x180f9fc1,0x3101f41,0x1b0fdf41,0x3105f40,0x190fa0bf,0x7020be,0x196fe0be,0x192fa0c1,0x8302042,0x182fe042,0xb301fc2,0xb105f3f,0x870603e,0xb705fbe,0xb305f41,0x1b2fdfc2,0x9302140,0x192fe140,0x1170213f,0x97060be,0x950a040,0xb509fc0,0x113020c2,
+	14,0xfe040,0x101fc0,0xfdfc0,0x10203f,0xfe03f,0x102041,0xfe041,0x101fbf,0xfdfbf,0x101fc1,0x1020c0,0xfe0c0,0xfdfc1,0x106040,0x105fc0,0x1020bf,0xfe0bf,0x1020c1,0x10603f,0x106041,0xfe0c1,0x8105fbf,0x8105fc1,0x1060c0,0x91060bf,0x91060c1,0x180fa040,0x180f9fc0,0x3101f40,0x1b0fdf40,0x180fa03f,0x180f9fbf,0x180fa041,0x180f9fc1,0x3101f3f,0x1b0fdf3f,0x3101f41,0x1b0fdf41,0x180fa0c0,0x70203e,0x186fe03e,0x3701fbe,0x1b6fdfbe,0x190fa0bf,0x190fa0c1,0x302042,0x182fe042,0xb105f40,0xb105f3f,0x3301fc2,0x1b2fdfc2,0xb105f41,0x17020be,0x196fe0be,0x970603e,0xb705fbe,0x9502140,0x194fe140,0x13020c2,0x192fe0c2,0x9306042,0xb305fc2,0xa50a040,
+	15,0x10203f,0xfe03f,0xfe040,0x101fc0,0x101fbf,0xfdfbf,0xfdfc0,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x106040,0x10603f,0x105fbf,0x105fc0,0x1060c0,0x1060bf,0x302041,0x2fe041,0x301fc1,0x70203e,0x6fe03e,0x701fbe,0x2fdfc1,0x3020c1,0x2fe0c1,0x6fdfbe,0x7020be,0x6fe0be,0x306041,0x305fc1,0x70603e,0x705fbe,0x180fa03f,0x180fa040,0x180f9fc0,0x180f9fbf,0x93060c1,0x97060be,0x3101f3f,0x3101f40,0x1b0fdf40,0x1b0fdf3f,0x180fa0bf,0x180fa0c0,0x182fa041,0x9302140,0x970213f,0x196fe13f,0x192fe140,0x3105f40,0x3105f3f,0x196fa03e,0x1b6f9fbe,0x182f9fc1,0xb301f41,0x1b2fdf41,0x192fa0c1,0x930a040,0x970a03f,0xb709fbf,0xb309fc0,0x13701f3e,
+	15,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x106040,0x10603f,0x105fbf,0x105fc0,0x302041,0x1060c0,0x1060bf,0x2fe041,0x301fc1,0x2fdfc1,0x3020c1,0x2fe0c1,0x70203e,0x6fe03e,0x701fbe,0x6fdfbe,0x306041,0x305fc1,0x7020be,0x6fe0be,0x180fa03f,0x180fa040,0x180f9fc0,0x180f9fbf,0x70603e,0x93060c1,0x705fbe,0x3701f3f,0x3101f40,0x1b0fdf40,0x1b6fdf3f,0x180fa0c0,0x180fa0bf,0x87060be,0x170213f,0x9302140,0x182fa041,0x182f9fc1,0x3105f40,0x3705f3f,0x192fe140,0x196fe13f,0x192fa0c1,0xb301f41,0x1b2fdf41,0x196fa03e,0x1b6f9fbe,0x970a03f,0x930a040,0xb309fc0,0xb709fbf,0x970613f,
+	15,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0xfe0c0,0xfe0bf,0x106040,0x10603f,0x105fc0,0x105fbf,0x302041,0x2fe041,0x301fc1,0x1060c0,0x1060bf,0x2fdfc1,0x3020c1,0x2fe0c1,0x306041,0x305fc1,0x70203e,0x6fe03e,0x701fbe,0x6fdfbe,0x180fa03f,0x180fa040,0x83060c1,0x7020be,0x6fe0be,0x180f9fbf,0x180f9fc0,0x70603e,0x705fbe,0x3701f3f,0x3101f40,0x1b0fdf40,0x1b6fdf3f,0x180fa0c0,0x180fa0bf,0x87060be,0x182fa041,0x182f9fc1,0x3105f40,0x3705f3f,0x1302140,0x170213f,0x196fe13f,0x192fe140,0x192fa0c1,0xb301f41,0x1b2fdf41,0x930a040,0x970a03f,0xb709fbf,0xb309fc0,0x9306140,0x970613f,0x1a6fa03e,
+	13,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0xfe0c0,0xfe0bf,0x106040,0x10603f,0x302041,0x2fe041,0x105fc0,0x105fbf,0x301fc1,0x2fdfc1,0x1060c0,0x1060bf,0x3020c1,0x2fe0c1,0x306041,0x305fc1,0x83060c1,0x70203e,0x6fe03e,0x701fbe,0x6fdfbe,0x180fa040,0x186fa03f,0x180f9fc0,0x186f9fbf,0x7020be,0x6fe0be,0x180fa0c0,0x186fa0bf,0x3101f40,0x3701f3f,0x1b0fdf40,0x1b6fdf3f,0x70603e,0x705fbe,0x87060be,0x182fa041,0x182f9fc1,0x3105f40,0x3705f3f,0x3301f41,0x1b2fdf41,0x192fa0c1,0x1302140,0x170213f,0x192fe140,0x196fe13f,0x9306140,0x930a040,0x970a03f,0xb309fc0,0xb305f41,0xb709fbf,0x970613f,
+	17,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0xfe0c0,0xfe0bf,0x102041,0x106040,0x10603f,0xfe041,0x101fc1,0x105fc0,0x105fbf,0xfdfc1,0x1020c1,0x1060c0,0x1060bf,0xfe0c1,0x106041,0x105fc1,0x93060c1,0x70203e,0x6fe03e,0x180fa040,0x186fa03f,0x180f9fc0,0x180f9fbf,0x701fbe,0x186fdfbe,0x3101f40,0x3701f3f,0x1b0fdf40,0x180fa0c0,0x180fa0bf,0x7020be,0x186fe0be,0x70603e,0x1b6fdf3f,0x180fa041,0x182f9fc1,0x8705fbe,0x3105f40,0x3101f41,0x1b2fdf41,0x192fa0c1,0x9302140,0x97060be,0x970213f,0x192fe140,0x196fe13f,0xb705f3f,0x930a040,0x970a03f,0x9302042,0x192fe042,0x13301fc2,0xb305f41,0xb509fc0,
+	15,0xfe040,0x10203f,0x101fc0,0xfe03f,0xfdfc0,0x101fbf,0xfdfbf,0x1020c0,0xfe0c0,0x102041,0x1020bf,0x106040,0xfe041,0xfe0bf,0x101fc1,0xfdfc1,0x10603f,0x105fc0,0x105fbf,0x1020c1,0xfe0c1,0x1060c0,0x106041,0x1060bf,0x8105fc1,0x83060c1,0x180fa040,0x180fa03f,0x180f9fc0,0x70203e,0x186fe03e,0x180f9fbf,0x701fbe,0x3101f40,0x1b0fdf40,0x180fa0c0,0x180fa041,0x186fdfbe,0x3701f3f,0x1b6fdf3f,0x180fa0bf,0x7020be,0x186fe0be,0x70603e,0x182f9fc1,0x3101f41,0x1b2fdf41,0x192fa0c1,0x9102140,0x190fe140,0x970213f,0x8705fbe,0xb105f40,0xb705f3f,0x97060be,0x196fe13f,0x9302042,0x192fe042,0x13301fc2,0xb305f41,0xa30a040,0xa70a03f,0x11302141,
+	12,0xfe040,0x10203f,0x101fc0,0xfdfc0,0xfe03f,0x101fbf,0x102041,0x1020c0,0xfe0c0,0xfdfbf,0xfe041,0x101fc1,0x8106040,0x1020bf,0xfe0bf,0xfdfc1,0x8105fc0,0x810603f,0x1020c1,0xfe0c1,0x8106041,0x81060c0,0x8105fbf,0x8105fc1,0x81060bf,0x81060c1,0x180fa040,0x180f9fc0,0x180fa03f,0x180f9fbf,0x70203e,0x186fe03e,0x180fa0c0,0x180fa041,0x3101f40,0x1b0fdf40,0x3101f3f,0x3701fbe,0x186fdfbe,0x180fa0bf,0x180f9fc1,0x1b6fdf3f,0x3101f41,0x1b0fdf41,0x190fa0c1,0x7020be,0x186fe0be,0x870603e,0xb305f40,0xb105f3f,0xb705fbe,0x9102140,0x190fe140,0x8302042,0x182fe042,0xb301fc2,0x1b2fdfc2,0x970213f,0x196fe13f,0x97060be,0x11102141,0x93020c2,0x192fe0c2,
+	13,0xfe040,0x101fc0,0x10203f,0xfdfc0,0x102041,0xfe03f,0x1020c0,0xfe041,0x101fbf,0xfdfbf,0xfe0c0,0x101fc1,0xfdfc1,0x8106040,0x1020bf,0xfe0bf,0x1020c1,0xfe0c1,0x8105fc0,0x810603f,0x8106041,0x81060c0,0x8105fbf,0x8105fc1,0x81060bf,0x81060c1,0x180fa040,0x180f9fc0,0x180fa03f,0x180fa041,0x180fa0c0,0x180f9fbf,0x3101f40,0x1b0fdf40,0x180f9fc1,0x3101f3f,0x70203e,0x186fe03e,0x190fa0bf,0x190fa0c1,0x3101f41,0x1b0fdf41,0x1b0fdf3f,0x3701fbe,0x1b6fdfbe,0x302042,0x182fe042,0x3301fc2,0xb105f40,0x7020be,0x196fe0be,0x9102140,0x190fe140,0x1b2fdfc2,0x3020c2,0x192fe0c2,0x11302141,0x1170213f,0xa70603e,0xb705f3f,0xb105f41,0x9306042,0xb305fc2,
+	15,0x10203f,0xfe03f,0xfe040,0x101fc0,0x101fbf,0xfdfbf,0xfdfc0,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x106040,0x10603f,0x105fbf,0x105fc0,0x1060c0,0x1060bf,0x302041,0x2fe041,0x70203e,0x6fe03e,0x301fc1,0x2fdfc1,0x3020c1,0x2fe0c1,0x701fbe,0x6fdfbe,0x7020be,0x6fe0be,0x306041,0x305fc1,0x70603e,0x180fa03f,0x180fa040,0x180f9fc0,0x180f9fbf,0x83060c1,0x705fbe,0x87060be,0x180fa0bf,0x180fa0c0,0x3101f40,0x3701f3f,0x1b6fdf3f,0x1b0fdf40,0x1302140,0x170213f,0x196fe13f,0x192fe140,0x182fa041,0x1b2f9fc1,0x3105f40,0x3705f3f,0x196fa03e,0x1b6f9fbe,0x192fa0c1,0x9306140,0x970613f,0x970a03f,0x930a040,0xb309fc0,0xb709fbf,0x13301f41,
+	13,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfbf,0xfdfc0,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x106040,0x10603f,0x105fbf,0x105fc0,0x1060c0,0x1060bf,0x302041,0x2fe041,0x301fc1,0x2fdfc1,0x3020c1,0x2fe0c1,0x70203e,0x6fe03e,0x701fbe,0x306041,0x305fc1,0x7020be,0x6fdfbe,0x6fe0be,0x180fa03f,0x180fa040,0x83060c1,0x70603e,0x8705fbe,0x180f9fbf,0x180f9fc0,0x180fa0c0,0x180fa0bf,0x87060be,0x3701f3f,0x3101f40,0x1b0fdf40,0x1b6fdf3f,0x1302140,0x170213f,0x196fe13f,0x192fe140,0x182fa041,0x182f9fc1,0x192fa0c1,0x3105f40,0xb705f3f,0x196fa03e,0x1b6f9fbe,0x970613f,0x9306140,0x930a040,0x970a03f,0xb301f41,0x1b2fdf41,0xb509fc0,
+	13,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0x1020c0,0x1020bf,0xfdfbf,0xfe0c0,0xfe0bf,0x106040,0x10603f,0x105fc0,0x302041,0x2fe041,0x105fbf,0x1060c0,0x1060bf,0x301fc1,0x2fdfc1,0x3020c1,0x2fe0c1,0x306041,0x70203e,0x6fe03e,0x701fbe,0x8305fc1,0x83060c1,0x7020be,0x6fe0be,0x6fdfbe,0x180fa03f,0x180fa040,0x180f9fc0,0x180f9fbf,0x70603e,0x8705fbe,0x180fa0c0,0x180fa0bf,0x87060be,0x3701f3f,0x3101f40,0x1b0fdf40,0x1b6fdf3f,0x182fa041,0x1102140,0x170213f,0x196fe13f,0x190fe140,0x192fa0c1,0x182f9fc1,0xb105f40,0xb705f3f,0xb301f41,0x1b2fdf41,0x9106140,0x970613f,0xa30a040,0xa70a03f,0x196fa03e,0x1b6f9fbe,0x11302141,
+	13,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0x1020c0,0x1020bf,0xfe0c0,0xfdfbf,0xfe0bf,0x106040,0x10603f,0x302041,0x2fe041,0x105fc0,0x105fbf,0x1060c0,0x1060bf,0x301fc1,0x2fdfc1,0x3020c1,0x2fe0c1,0x306041,0x305fc1,0x83060c1,0x70203e,0x6fe03e,0x180fa040,0x186fa03f,0x701fbe,0x6fdfbe,0x7020be,0x6fe0be,0x180f9fc0,0x186f9fbf,0x180fa0c0,0x186fa0bf,0x70603e,0x8705fbe,0x3101f40,0x3701f3f,0x1b0fdf40,0x1b6fdf3f,0x182fa041,0x1102140,0x87060be,0x170213f,0x190fe140,0x196fe13f,0x182fa0c1,0x182f9fc1,0x3105f40,0xb705f3f,0xb301f41,0x1b2fdf41,0x9106140,0x970613f,0x9302141,0x192fe141,0x930a040,0x970a03f,0xb509fc0,
+	13,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0x1020c0,0x1020bf,0xfe0c0,0xfdfbf,0xfe0bf,0x102041,0x106040,0x10603f,0xfe041,0x101fc1,0x105fc0,0x8105fbf,0x1060c0,0x1020c1,0xfdfc1,0xfe0c1,0x81060bf,0x106041,0x8305fc1,0x83060c1,0x70203e,0x6fe03e,0x180fa040,0x186fa03f,0x180f9fc0,0x180f9fbf,0x701fbe,0x186fdfbe,0x7020be,0x6fe0be,0x180fa0c0,0x186fa0bf,0x180fa041,0x3101f40,0x3701f3f,0x870603e,0x8705fbe,0x1b0fdf40,0x1b6fdf3f,0x182f9fc1,0x182fa0c1,0x1102140,0x170213f,0x190fe140,0x196fe13f,0x87060be,0xb105f40,0xb301f41,0x1b2fdf41,0xb705f3f,0xa50a040,0x9106140,0x9302141,0x192fe141,0xa302042,0x1a2fe042,0x970613f,
+	14,0xfe040,0x10203f,0xfe03f,0x101fc0,0xfdfc0,0x1020c0,0xfe0c0,0x101fbf,0xfdfbf,0x1020bf,0x102041,0xfe041,0xfe0bf,0x106040,0x10603f,0x101fc1,0xfdfc1,0x1020c1,0x105fc0,0x1060c0,0xfe0c1,0x8105fbf,0x81060bf,0x106041,0x8305fc1,0x83060c1,0x180fa040,0x180fa03f,0x70203e,0x186fe03e,0x180f9fc0,0x180f9fbf,0x180fa0c0,0x180fa0bf,0x701fbe,0x186fdfbe,0x7020be,0x186fe0be,0x180fa041,0x3101f40,0x1b0fdf40,0x3701f3f,0x1b6fdf3f,0x182f9fc1,0x182fa0c1,0x1102140,0x190fe140,0x870603e,0x8705fbe,0x170213f,0x196fe13f,0x87060be,0x3301f41,0x1b2fdf41,0xb305f40,0xb705f3f,0xa302042,0x1a2fe042,0x1302141,0x192fe141,0x9306140,0x970613f,0xa50a040,
+	13,0xfe040,0x10203f,0x101fc0,0xfe03f,0x1020c0,0xfdfc0,0x102041,0xfe0c0,0x101fbf,0xfdfbf,0xfe041,0x1020bf,0xfe0bf,0x8106040,0x101fc1,0xfdfc1,0x1020c1,0xfe0c1,0x810603f,0x8105fc0,0x81060c0,0x8106041,0x8105fbf,0x81060bf,0x8105fc1,0x81060c1,0x180fa040,0x180fa03f,0x180f9fc0,0x180fa0c0,0x180fa041,0x180f9fbf,0x70203e,0x186fe03e,0x180fa0bf,0x701fbe,0x3101f40,0x1b0fdf40,0x182f9fc1,0x182fa0c1,0x7020be,0x186fe0be,0x186fdfbe,0x3701f3f,0x1b6fdf3f,0x1102140,0x190fe140,0x170213f,0x870603e,0x3101f41,0x1b2fdf41,0x8302042,0x182fe042,0x196fe13f,0x1102141,0x192fe141,0x113020c2,0x13301fc2,0xb505f40,0xb705fbe,0x87060be,0x9306140,0x970613f,
+	12,0xfe040,0x10203f,0x101fc0,0x102041,0x1020c0,0xfe03f,0xfdfc0,0xfe041,0xfe0c0,0x101fbf,0xfdfbf,0x1020bf,0x8106040,0x101fc1,0xfdfc1,0x1020c1,0xfe0bf,0xfe0c1,0x810603f,0x8105fc0,0x8106041,0x81060c0,0x8105fbf,0x81060bf,0x8105fc1,0x81060c1,0x180fa040,0x180fa03f,0x180f9fc0,0x180fa041,0x180fa0c0,0x180fa0bf,0x180f9fbf,0x180f9fc1,0x3101f40,0x1b0fdf40,0x70203e,0x186fe03e,0x180fa0c1,0x8302042,0x182fe042,0x9102140,0x190fe140,0x7020be,0x701fbe,0x3701f3f,0x1b0fdf3f,0x1b6fdfbe,0x186fe0be,0x970213f,0x196fe13f,0x3101f41,0x1b0fdf41,0xb301fc2,0x1b2fdfc2,0x83020c2,0x9302141,0x190fe141,0x192fe0c2,0xb305f40,0x970603e,0x8705fbe,0xb705f3f,
+	11,0x10203f,0x101fc0,0x101fbf,0xfdfbf,0xfe03f,0xfe040,0xfdfc0,0x105fc0,0x106040,0x10603f,0x105fbf,0x11020bf,0x11020c0,0x302041,0x301fc1,0x2fdfc1,0x2fe041,0x10fe0c0,0x10fe0bf,0x70203e,0x701fbe,0x3101f3f,0x3101f40,0x30fdf40,0x30fdf3f,0x6fdfbe,0x6fe03e,0x11060bf,0x11060c0,0x306041,0x305fc1,0x3105f40,0x3105f3f,0x705fbe,0x70603e,0x180fa03f,0x180fa040,0x180f9fc0,0x180f9fbf,0x13020c1,0x12fe0c1,0x17020be,0x16fe0be,0x3301f41,0x32fdf41,0x3701f3e,0x36fdf3e,0x93060c1,0x97060be,0xb305f41,0xb705f3e,0xb709fbf,0xb309fc0,0x930a040,0x970a03f,0x190fa0bf,0x190fa0c0,0x192fa041,0x182f9fc1,0x1b2f9f40,0x1b0f9f3f,0x1b6f9fbe,0x196fa03e,
+	11,0x101fc0,0x101fbf,0x10203f,0xfe040,0xfdfc0,0xfdfbf,0xfe03f,0x106040,0x105fc0,0x105fbf,0x10603f,0x302041,0x301fc1,0x2fdfc1,0x2fe041,0x11020c0,0x11020bf,0x10fe0bf,0x10fe0c0,0x3101f40,0x3101f3f,0x30fdf3f,0x30fdf40,0x701fbe,0x70203e,0x6fe03e,0x6fdfbe,0x305fc1,0x306041,0x11060c0,0x11060bf,0x3105f40,0x3105f3f,0x705fbe,0x70603e,0x13020c1,0x12fe0c1,0x180fa040,0x180f9fc0,0x180f9fbf,0x180fa03f,0x3301f41,0x32fdf41,0x17020be,0x16fe0be,0x93060c1,0xb305f41,0x3701f3e,0x36fdf3e,0x97060be,0x970a03f,0x930a040,0xb309fc0,0xb709fbf,0xb705f3e,0x182f9fc1,0x182fa041,0x192fa0c0,0x190fa0bf,0x1b0f9f3f,0x1b2f9f40,0x1b6f9fbe,0x196fa03e,
+	11,0x101fc0,0x101fbf,0x10203f,0xfe040,0xfdfc0,0xfdfbf,0xfe03f,0x106040,0x105fc0,0x105fbf,0x10603f,0x302041,0x301fc1,0x2fdfc1,0x2fe041,0x11020c0,0x11020bf,0x10fe0c0,0x10fe0bf,0x3101f40,0x3101f3f,0x30fdf40,0x30fdf3f,0x305fc1,0x306041,0x11060c0,0x11060bf,0x70203e,0x701fbe,0x6fdfbe,0x6fe03e,0x3105f40,0x3105f3f,0x705fbe,0x70603e,0x13020c1,0x12fe0c1,0x180fa040,0x180f9fc0,0x180f9fbf,0x180fa03f,0x3301f41,0x32fdf41,0x93060c1,0xb305f41,0x17020be,0x16fe0be,0x3701f3e,0x36fdf3e,0x182f9fc1,0x182fa041,0x192fa0c0,0x190fa0bf,0x97060be,0x970a03f,0x930a040,0xb309fc0,0xb709fbf,0xb705f3e,0x1b0f9f3f,0x1b2f9f40,0x1b6f9fbe,0x196fa03e,
+	13,0x101fc0,0x101fbf,0x10203f,0xfe040,0xfdfc0,0xfdfbf,0xfe03f,0x106040,0x105fc0,0x105fbf,0x10603f,0x102041,0x101fc1,0xfdfc1,0xfe041,0x11020c0,0x11020bf,0x10fe0c0,0x106041,0x105fc1,0x3101f40,0x3101f3f,0x10fe0bf,0x30fdf40,0x30fdf3f,0x11060c0,0x11060bf,0x70203e,0x701fbe,0x3105f40,0x3105f3f,0x6fdfbe,0x6fe03e,0x11020c1,0x12fe0c1,0x3101f41,0x32fdf41,0x180f9fc0,0x180fa040,0x186fa03f,0x186f9fbf,0x705fbe,0x70603e,0x93060c1,0xb305f41,0x182f9fc1,0x182fa041,0x17020be,0x16fe0be,0x3701f3e,0x36fdf3e,0xb309fc0,0x930a040,0x970a03f,0xb709fbf,0x97060be,0x192fa0c0,0x196fa0bf,0x1b2f9f40,0x1b6f9f3f,0xb705f3e,0x13301fc2,0x11302042,
+	15,0x101fc0,0x101fbf,0x10203f,0xfe040,0xfdfc0,0xfdfbf,0xfe03f,0x106040,0x105fc0,0x105fbf,0x10603f,0x102041,0x101fc1,0xfdfc1,0xfe041,0x11020c0,0x106041,0x105fc1,0x3101f40,0x11020bf,0x10fe0c0,0x10fe0bf,0x3101f3f,0x30fdf40,0x30fdf3f,0x11060c0,0x11060bf,0x11020c1,0x10fe0c1,0x3105f40,0x3105f3f,0x3101f41,0x30fdf41,0x701fbe,0x70203e,0x6fe03e,0x6fdfbe,0x180f9fc0,0x180fa040,0x186fa03f,0x186f9fbf,0x93060c1,0xb305f41,0x705fbe,0x70603e,0x180fa041,0x180f9fc1,0x97020be,0x16fe0be,0x192fa0c0,0x196fa0bf,0xb701f3e,0x36fdf3e,0xb309fc0,0x930a040,0x970a03f,0xb709fbf,0x1b2f9f40,0x1b6f9f3f,0xb301fc2,0x9302042,0x192fe042,0x1b2fdfc2,
+	15,0x101fc0,0x101fbf,0x10203f,0xfe040,0xfdfc0,0xfdfbf,0xfe03f,0x102041,0x101fc1,0x105fc0,0x106040,0x10603f,0x105fbf,0xfdfc1,0xfe041,0x106041,0x105fc1,0x11020c0,0x11020bf,0x10fe0c0,0x3101f40,0x3101f3f,0x30fdf40,0x10fe0bf,0x30fdf3f,0x11020c1,0x11060c0,0x11060bf,0x10fe0c1,0x3101f41,0x3105f40,0x3105f3f,0x30fdf41,0x180f9fc0,0x180fa040,0x70203e,0x701fbe,0x6fdfbe,0x6fe03e,0x186fa03f,0x186f9fbf,0x93060c1,0xb305f41,0x705fbe,0x70603e,0x180fa041,0x180f9fc1,0xb301fc2,0x9302042,0x192fe042,0x192fa0c0,0x190fa0bf,0x97020be,0x196fe0be,0x930a040,0xb309fc0,0xb709fbf,0x970a03f,0xb701f3e,0x36fdf3e,0x1b2f9f40,0x1b2fdfc2,0x1b6f9f3f,
+	15,0x101fc0,0xfdfc0,0xfe040,0x10203f,0x101fbf,0xfdfbf,0xfe03f,0x102041,0x101fc1,0x105fc0,0x106040,0xfe041,0xfdfc1,0x105fbf,0x10603f,0x106041,0x105fc1,0x11020c0,0x10fe0c0,0x11020bf,0x3101f40,0x30fdf40,0x3101f3f,0x10fe0bf,0x11020c1,0x11060c0,0x10fe0c1,0x30fdf3f,0x3101f41,0x3105f40,0x30fdf41,0x11060bf,0x3105f3f,0x93060c1,0x180fa040,0x180f9fc0,0x180f9fbf,0x180fa03f,0xb305f41,0x701fbe,0x70203e,0x186fe03e,0x186fdfbe,0x180f9fc1,0x180fa041,0x70603e,0x705fbe,0xb301fc2,0x9302042,0x192fe042,0x1b2fdfc2,0x192fa0c0,0x190fa0bf,0x930a040,0xb309fc0,0xb709fbf,0x970a03f,0x97020be,0x196fe0be,0x1b2f9f40,0x1b0f9f3f,0xb701f3e,0x1b6fdf3e,
+	17,0x101fc0,0xfdfc0,0xfe040,0x10203f,0x101fbf,0x101fc1,0x102041,0xfe03f,0xfdfbf,0xfdfc1,0xfe041,0x106040,0x105fc0,0x105fbf,0x10603f,0x106041,0x105fc1,0x11020c0,0x10fe0c0,0x3101f40,0x30fdf40,0x11020bf,0x11020c1,0x10fe0bf,0x3101f3f,0x3101f41,0x10fe0c1,0x11060c0,0x30fdf3f,0x30fdf41,0x3105f40,0x11060bf,0x11060c1,0x3105f3f,0x3105f41,0x180f9fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x180f9fc1,0x180fa041,0x170203e,0x3701fbe,0x1b6fdfbe,0x196fe03e,0x1302042,0x3301fc2,0x1b2fdfc2,0x192fe042,0x170603e,0x3705fbe,0xb109fc0,0x910a040,0x1306042,0x3305fc2,0x192fa0c0,0x196fa0bf,0x1b2f9f40,0x1b6f9f3f,0xb709fbf,0x970a03f,0x930a041,0xb309fc1,
+	11,0x10203f,0x101fbf,0x101fc0,0xfe040,0xfe03f,0xfdfbf,0xfdfc0,0x106040,0x10603f,0x105fbf,0x105fc0,0x11020c0,0x11020bf,0x10fe0bf,0x10fe0c0,0x302041,0x301fc1,0x2fdfc1,0x2fe041,0x70203e,0x701fbe,0x6fdfbe,0x6fe03e,0x3101f3f,0x3101f40,0x30fdf40,0x30fdf3f,0x11060bf,0x11060c0,0x306041,0x305fc1,0x70603e,0x705fbe,0x3105f3f,0x3105f40,0x13020c1,0x12fe0c1,0x180fa040,0x180fa03f,0x180f9fbf,0x180f9fc0,0x17020be,0x16fe0be,0x3301f41,0x32fdf41,0x93060c1,0x97060be,0x3701f3e,0x36fdf3e,0xb305f41,0xb309fc0,0x930a040,0x970a03f,0xb709fbf,0xb705f3e,0x190fa0bf,0x190fa0c0,0x192fa041,0x182f9fc1,0x186f9fbe,0x196fa03e,0x1b6f9f3f,0x1b2f9f40,
+	11,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0xfdfbf,0x106040,0x10603f,0x105fbf,0x105fc0,0x301fc1,0x302041,0x11020c0,0x11020bf,0x10fe0bf,0x10fe0c0,0x2fe041,0x2fdfc1,0x3101f40,0x3101f3f,0x701fbe,0x70203e,0x11060bf,0x11060c0,0x306041,0x305fc1,0x30fdf40,0x30fdf3f,0x6fdfbe,0x6fe03e,0x70603e,0x705fbe,0x3105f3f,0x3105f40,0x13020c1,0x12fe0c1,0x180fa040,0x180fa03f,0x180f9fbf,0x180f9fc0,0x3301f41,0x32fdf41,0x17020be,0x16fe0be,0x93060c1,0x97060be,0x3701f3e,0x36fdf3e,0xb305f41,0x182f9fc1,0x182fa041,0x192fa0c0,0x190fa0bf,0x930a040,0x970a03f,0xb709fbf,0xb309fc0,0xb705f3e,0x1b0f9f3f,0x1b2f9f40,0x1b6f9fbe,0x196fa03e,
+	11,0x101fc0,0x10203f,0x101fbf,0xfe040,0xfdfc0,0xfe03f,0xfdfbf,0x106040,0x105fc0,0x105fbf,0x10603f,0x302041,0x301fc1,0x2fdfc1,0x2fe041,0x11020c0,0x11020bf,0x10fe0c0,0x10fe0bf,0x306041,0x305fc1,0x3101f40,0x3101f3f,0x30fdf40,0x30fdf3f,0x11060c0,0x11060bf,0x70203e,0x701fbe,0x6fdfbe,0x6fe03e,0x13020c1,0x12fe0c1,0x3105f40,0x3105f3f,0x705fbe,0x70603e,0x180fa040,0x180f9fc0,0x180f9fbf,0x180fa03f,0x3301f41,0x32fdf41,0x93060c1,0x17020be,0x16fe0be,0xb305f41,0x182f9fc1,0x182fa041,0x192fa0c0,0x190fa0bf,0x3701f3e,0x36fdf3e,0x97060be,0x970a03f,0x930a040,0xb309fc0,0xb709fbf,0xb705f3e,0x1b0f9f3f,0x1b2f9f40,0x1b6f9fbe,0x196fa03e,
+	11,0x101fc0,0x10203f,0x101fbf,0xfe040,0xfdfc0,0xfe03f,0xfdfbf,0x106040,0x105fc0,0x105fbf,0x10603f,0x302041,0x301fc1,0x2fdfc1,0x2fe041,0x11020c0,0x11020bf,0x10fe0c0,0x10fe0bf,0x306041,0x305fc1,0x3101f40,0x3101f3f,0x30fdf40,0x30fdf3f,0x11060c0,0x11060bf,0x13020c1,0x12fe0c1,0x70203e,0x701fbe,0x6fdfbe,0x6fe03e,0x3105f40,0x3105f3f,0x3301f41,0x180f9fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x32fdf41,0x93060c1,0x70603e,0x705fbe,0xb305f41,0x17020be,0x16fe0be,0x182fa041,0x182f9fc1,0x192fa0c0,0x190fa0bf,0x3701f3e,0x36fdf3e,0x97060be,0x930a040,0xb309fc0,0xb709fbf,0x970a03f,0xb705f3e,0x1b2f9f40,0x1b0f9f3f,0x1b6f9fbe,0x196fa03e,
+	13,0x101fc0,0x10203f,0x101fbf,0xfe040,0xfdfc0,0xfe03f,0xfdfbf,0x106040,0x105fc0,0x105fbf,0x10603f,0x102041,0x101fc1,0xfdfc1,0xfe041,0x11020c0,0x11020bf,0x10fe0c0,0x106041,0x105fc1,0x10fe0bf,0x3101f40,0x3101f3f,0x30fdf40,0x11060c0,0x11060bf,0x11020c1,0x10fe0c1,0x30fdf3f,0x701fbe,0x70203e,0x3105f40,0x3105f3f,0x3101f41,0x32fdf41,0x180f9fc0,0x180fa040,0x6fe03e,0x6fdfbe,0x186f9fbf,0x186fa03f,0x93060c1,0x70603e,0x705fbe,0xb305f41,0x182f9fc1,0x180fa041,0x17020be,0x16fe0be,0x192fa0c0,0x196fa0bf,0x930a040,0xb309fc0,0xb709fbf,0x970a03f,0x97060be,0xb701f3e,0x36fdf3e,0x1b2f9f40,0x1b6f9f3f,0xb301fc2,0x9302042,0x1a2fe042,
+	15,0x101fc0,0x10203f,0xfe040,0xfdfc0,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0x106040,0x105fc0,0x105fbf,0x10603f,0xfe041,0xfdfc1,0x11020c0,0x106041,0x105fc1,0x11020bf,0x10fe0c0,0x10fe0bf,0x3101f40,0x30fdf40,0x3101f3f,0x11060c0,0x11020c1,0x10fe0c1,0x11060bf,0x30fdf3f,0x3101f41,0x3105f40,0x3105f3f,0x93060c1,0x30fdf41,0x180f9fc0,0x180fa040,0x70203e,0x701fbe,0x6fdfbe,0x6fe03e,0x186fa03f,0x186f9fbf,0xb305f41,0x705fbe,0x70603e,0x180fa041,0x180f9fc1,0x190fa0c0,0x190fa0bf,0x97020be,0x196fe0be,0x930a040,0xb309fc0,0xb709fbf,0x970a03f,0x9302042,0xb301fc2,0x1b2fdfc2,0x192fe042,0x192fa0c1,0x1b2f9f40,0x1b6f9f3f,0x13701f3e,
+	15,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfdfbf,0xfe03f,0x102041,0x101fc1,0x106040,0x105fc0,0xfe041,0xfdfc1,0x10603f,0x105fbf,0x106041,0x105fc1,0x11020c0,0x10fe0c0,0x11020bf,0x10fe0bf,0x11020c1,0x11060c0,0x3101f40,0x30fdf40,0x3101f3f,0x10fe0c1,0x11060bf,0x30fdf3f,0x3101f41,0x3105f40,0x91060c1,0x30fdf41,0x1b0f9fc0,0x180fa040,0x3105f3f,0x3701fbe,0x70203e,0x180fa03f,0x1b0f9fbf,0x1b6fdfbe,0x186fe03e,0x3105f41,0x1b0f9fc1,0x180fa041,0x70603e,0x3705fbe,0x1302042,0x3301fc2,0x1b2fdfc2,0x192fe042,0x190fa0c0,0x190fa0bf,0x97020be,0x930a040,0xb109fc0,0xb709fbf,0x970a03f,0x196fe0be,0x192fa0c1,0x9306042,0x3305fc2,0xb309fc1,
+	17,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0x102041,0x101fc1,0xfe03f,0xfdfbf,0xfe041,0xfdfc1,0x106040,0x105fc0,0x105fbf,0x10603f,0x106041,0x105fc1,0x11020c0,0x10fe0c0,0x11020bf,0x11020c1,0x10fe0bf,0x10fe0c1,0x3101f40,0x30fdf40,0x11060c0,0x11060bf,0x3101f3f,0x3101f41,0x30fdf3f,0x30fdf41,0x11060c1,0x3105f40,0x3105f3f,0x180f9fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x3105f41,0x180f9fc1,0x180fa041,0x170203e,0x3701fbe,0x1b6fdfbe,0x196fe03e,0x1302042,0x3301fc2,0x1b2fdfc2,0x192fe042,0x190fa0c0,0x170603e,0x3705fbe,0xb109fc0,0x910a040,0x1306042,0x3305fc2,0xb309fc1,0x930a041,0x970a03f,0xb709fbf,0x196fa0bf,0x192fa0c1,0x1b4f9f40,
+	11,0x10203f,0x101fbf,0x101fc0,0xfe040,0xfe03f,0xfdfbf,0xfdfc0,0x106040,0x10603f,0x105fbf,0x105fc0,0x11020c0,0x11020bf,0x10fe0bf,0x10fe0c0,0x302041,0x301fc1,0x2fe041,0x2fdfc1,0x70203e,0x701fbe,0x6fe03e,0x6fdfbe,0x11060bf,0x11060c0,0x306041,0x305fc1,0x3101f40,0x3101f3f,0x30fdf3f,0x30fdf40,0x70603e,0x705fbe,0x3105f3f,0x3105f40,0x13020c1,0x12fe0c1,0x180fa040,0x180fa03f,0x180f9fbf,0x180f9fc0,0x17020be,0x16fe0be,0x93060c1,0x97060be,0x3301f41,0x32fdf41,0x3701f3e,0x36fdf3e,0x190fa0bf,0x190fa0c0,0x192fa041,0x182f9fc1,0xb305f41,0xb309fc0,0x930a040,0x970a03f,0xb709fbf,0xb705f3e,0x186f9fbe,0x196fa03e,0x1b6f9f3f,0x1b2f9f40,
+	11,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0xfdfbf,0x106040,0x10603f,0x105fbf,0x105fc0,0x11020c0,0x11020bf,0x10fe0bf,0x10fe0c0,0x302041,0x301fc1,0x2fe041,0x2fdfc1,0x11060c0,0x11060bf,0x70203e,0x701fbe,0x6fe03e,0x6fdfbe,0x306041,0x305fc1,0x3101f40,0x3101f3f,0x30fdf3f,0x30fdf40,0x13020c1,0x12fe0c1,0x70603e,0x705fbe,0x3105f3f,0x3105f40,0x180fa040,0x180fa03f,0x180f9fbf,0x180f9fc0,0x17020be,0x16fe0be,0x93060c1,0x3301f41,0x32fdf41,0x97060be,0x190fa0bf,0x190fa0c0,0x192fa041,0x182f9fc1,0x3701f3e,0x36fdf3e,0xb305f41,0xb309fc0,0x930a040,0x970a03f,0xb709fbf,0xb705f3e,0x186f9fbe,0x196fa03e,0x1b6f9f3f,0x1b2f9f40,
+	11,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0xfdfbf,0x106040,0x10603f,0x105fc0,0x105fbf,0x302041,0x11020c0,0x11020bf,0x301fc1,0x2fe041,0x10fe0c0,0x10fe0bf,0x2fdfc1,0x306041,0x11060c0,0x11060bf,0x305fc1,0x3101f40,0x3101f3f,0x701fbe,0x70203e,0x6fe03e,0x6fdfbe,0x30fdf3f,0x30fdf40,0x13020c1,0x12fe0c1,0x180fa040,0x180fa03f,0x180f9fc0,0x180f9fbf,0x70603e,0x705fbe,0x3105f3f,0x3105f40,0x93060c1,0x17020be,0x16fe0be,0x3301f41,0x32fdf41,0xb305f41,0x182f9fc1,0x182fa041,0x192fa0c0,0x190fa0bf,0x97060be,0x970a03f,0x930a040,0xb309fc0,0xb709fbf,0x3701f3e,0x36fdf3e,0xb705f3e,0x186f9fbe,0x196fa03e,0x1b6f9f3f,0x1b2f9f40,
+	13,0x101fc0,0x10203f,0x101fbf,0xfe040,0xfdfc0,0xfe03f,0xfdfbf,0x106040,0x105fc0,0x10603f,0x105fbf,0x102041,0x101fc1,0xfe041,0x11020c0,0x11020bf,0xfdfc1,0x10fe0c0,0x10fe0bf,0x106041,0x105fc1,0x11060c0,0x11060bf,0x11020c1,0x3101f40,0x3101f3f,0x30fdf40,0x30fdf3f,0x701fbe,0x70203e,0x12fe0c1,0x6fe03e,0x6fdfbe,0x3105f40,0x3105f3f,0x93060c1,0x180fa040,0x180f9fc0,0x186fa03f,0x186f9fbf,0x70603e,0x705fbe,0x3101f41,0x32fdf41,0x17020be,0x16fe0be,0x182fa041,0x182f9fc1,0xb305f41,0x190fa0c0,0x196fa0bf,0x97060be,0x930a040,0xb309fc0,0xb709fbf,0x970a03f,0xb701f3e,0x36fdf3e,0x1b6f9f3f,0x1b2f9f40,0x192fa0c1,0x11302042,0x13301fc2,
+	15,0x101fc0,0x10203f,0x101fbf,0xfe040,0xfdfc0,0xfe03f,0xfdfbf,0x106040,0x105fc0,0x10603f,0x105fbf,0x102041,0x101fc1,0xfe041,0xfdfc1,0x11020c0,0x11020bf,0x10fe0c0,0x10fe0bf,0x106041,0x105fc1,0x11060c0,0x11060bf,0x11020c1,0x10fe0c1,0x3101f40,0x3101f3f,0x30fdf40,0x30fdf3f,0x701fbe,0x70203e,0x6fe03e,0x6fdfbe,0x93060c1,0x3105f40,0x3105f3f,0x3101f41,0x1b0f9fc0,0x180fa040,0x186fa03f,0x1b6f9fbf,0x30fdf41,0x70603e,0x705fbe,0xb305f41,0x1b0f9fc1,0x180fa041,0x17020be,0x16fe0be,0x190fa0c0,0x196fa0bf,0x97060be,0x930a040,0xb309fc0,0xb709fbf,0x970a03f,0xb701f3e,0x1b6fdf3e,0x9302042,0xb301fc2,0x1b2fdfc2,0x192fe042,0x192fa0c1,
+	15,0x101fc0,0x10203f,0xfe040,0xfdfc0,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x106040,0x105fc0,0x101fc1,0xfe041,0xfdfc1,0x10603f,0x105fbf,0x11020c0,0x11020bf,0x10fe0c0,0x106041,0x105fc1,0x10fe0bf,0x11020c1,0x11060c0,0x11060bf,0x10fe0c1,0x3101f40,0x30fdf40,0x3101f3f,0x30fdf3f,0x93060c1,0x3105f40,0x3101f41,0x30fdf41,0x1b0f9fc0,0x180fa040,0x70203e,0x701fbe,0x3105f3f,0x6fdfbe,0x6fe03e,0x186fa03f,0x1b6f9fbf,0x180fa041,0x1b0f9fc1,0xb305f41,0x705fbe,0x70603e,0x17020be,0x190fa0c0,0x190fa0bf,0x196fe0be,0x930a040,0xb309fc0,0x9302042,0xb301fc2,0x1b2fdfc2,0x192fe042,0x192fa0c1,0x970a03f,0xb709fbf,0x97060be,0xb701f3e,0x1b6fdf3e,
+	15,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0x106040,0x105fc0,0xfe041,0xfdfc1,0x10603f,0x105fbf,0x11020c0,0x106041,0x105fc1,0x10fe0c0,0x11020bf,0x10fe0bf,0x11020c1,0x11060c0,0x10fe0c1,0x11060bf,0x3101f40,0x30fdf40,0x3101f3f,0x30fdf3f,0x11060c1,0x3101f41,0x3105f40,0x30fdf41,0x1b0f9fc0,0x180fa040,0x180fa03f,0x1b0f9fbf,0x3105f3f,0x3701fbe,0x70203e,0x186fe03e,0x1b6fdfbe,0xb105f41,0x1b0f9fc1,0x180fa041,0x190fa0c0,0x70603e,0x3705fbe,0x1302042,0x3301fc2,0x1b2fdfc2,0x192fe042,0x190fa0bf,0x97020be,0x196fe0be,0x910a040,0xb109fc0,0xb709fbf,0x970a03f,0x192fa0c1,0x1306042,0xb305fc2,0xa30a041,
+	16,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0x102041,0x101fc1,0xfe03f,0xfdfbf,0xfe041,0xfdfc1,0x106040,0x105fc0,0x10603f,0x105fbf,0x106041,0x11020c0,0x105fc1,0x10fe0c0,0x11020bf,0x11020c1,0x10fe0bf,0x10fe0c1,0x11060c0,0x11060bf,0x3101f40,0x30fdf40,0x11060c1,0x3101f3f,0x3101f41,0x30fdf41,0x30fdf3f,0x3105f40,0x180fa040,0x1b0f9fc0,0x180fa03f,0x1b0f9fbf,0x3105f3f,0xb105f41,0x1b0f9fc1,0x180fa041,0x70203e,0x3701fbe,0x1b6fdfbe,0x186fe03e,0x1302042,0x3301fc2,0x1b2fdfc2,0x192fe042,0x190fa0c0,0x190fa0bf,0x70603e,0x3705fbe,0x910a040,0xb109fc0,0x1306042,0xb305fc2,0x192fa0c1,0x97020be,0x196fe0be,0x970a03f,0xb709fbf,0xa30a041,
+	13,0x10203f,0x101fbf,0x101fc0,0xfe040,0xfe03f,0xfdfbf,0xfdfc0,0x106040,0x10603f,0x105fbf,0x105fc0,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x302041,0x301fc1,0x2fe041,0x1060c0,0x1060bf,0x70203e,0x701fbe,0x2fdfc1,0x6fe03e,0x6fdfbe,0x306041,0x305fc1,0x3101f40,0x3101f3f,0x70603e,0x705fbe,0x30fdf3f,0x30fdf40,0x3020c1,0x12fe0c1,0x7020be,0x16fe0be,0x180fa03f,0x180fa040,0x1b0f9fc0,0x1b0f9fbf,0x3105f3f,0x3105f40,0x93060c1,0x97060be,0x190fa0bf,0x190fa0c0,0x3301f41,0x32fdf41,0x3701f3e,0x36fdf3e,0x970a03f,0x930a040,0xb309fc0,0xb709fbf,0xb305f41,0x192fa041,0x1b2f9fc1,0x196fa03e,0x1b6f9fbe,0xb705f3e,0x1170213f,0x11302140,
+	11,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0xfdfbf,0x106040,0x10603f,0x105fbf,0x105fc0,0x11020c0,0x11020bf,0x10fe0bf,0x10fe0c0,0x302041,0x301fc1,0x2fe041,0x2fdfc1,0x11060c0,0x11060bf,0x70203e,0x701fbe,0x6fe03e,0x6fdfbe,0x306041,0x305fc1,0x13020c1,0x12fe0c1,0x3101f40,0x3101f3f,0x30fdf3f,0x30fdf40,0x70603e,0x705fbe,0x17020be,0x180fa03f,0x180fa040,0x180f9fc0,0x180f9fbf,0x16fe0be,0x93060c1,0x3105f40,0x3105f3f,0x97060be,0x3301f41,0x32fdf41,0x190fa0c0,0x190fa0bf,0x192fa041,0x182f9fc1,0x3701f3e,0x36fdf3e,0xb305f41,0x930a040,0x970a03f,0xb709fbf,0xb309fc0,0xb705f3e,0x196fa03e,0x186f9fbe,0x1b6f9f3f,0x1b2f9f40,
+	13,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0xfdfbf,0x106040,0x10603f,0x105fc0,0x105fbf,0x1020c0,0x1020bf,0xfe0c0,0x302041,0x301fc1,0xfe0bf,0x2fe041,0x2fdfc1,0x1060c0,0x1060bf,0x306041,0x305fc1,0x3020c1,0x70203e,0x701fbe,0x6fe03e,0x6fdfbe,0x3101f3f,0x3101f40,0x12fe0c1,0x30fdf40,0x30fdf3f,0x70603e,0x705fbe,0x93060c1,0x180fa040,0x180fa03f,0x1b0f9fc0,0x1b0f9fbf,0x3105f40,0x3105f3f,0x7020be,0x16fe0be,0x3301f41,0x32fdf41,0x190fa0c0,0x190fa0bf,0x97060be,0x182fa041,0x1b2f9fc1,0xb305f41,0x930a040,0x970a03f,0xb709fbf,0xb309fc0,0xb701f3e,0x36fdf3e,0x1b6f9fbe,0x196fa03e,0x192fa0c1,0x11302140,0x1170213f,
+	13,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0xfdfbf,0x106040,0x10603f,0x105fc0,0x105fbf,0x102041,0x1020c0,0x1020bf,0x101fc1,0xfe041,0xfe0c0,0x10fe0bf,0xfdfc1,0x106041,0x1060c0,0x11060bf,0x105fc1,0x1020c1,0x10fe0c1,0x70203e,0x701fbe,0x3101f40,0x3101f3f,0x30fdf40,0x30fdf3f,0x6fe03e,0x6fdfbe,0x93060c1,0x180fa040,0x186fa03f,0x1b0f9fc0,0x1b6f9fbf,0x70603e,0x705fbe,0x3105f40,0x3105f3f,0x3101f41,0x32fdf41,0x17020be,0x16fe0be,0x196fa0bf,0x190fa0c0,0x180fa041,0x1b2f9fc1,0xb305f41,0x97060be,0x930a040,0x970a03f,0xb309fc0,0xb709fbf,0xb701f3e,0x1b6fdf3e,0x192fa0c1,0x9302042,0xb301fc2,0x1a2fe042,0x11502140,
+	13,0x101fc0,0x10203f,0xfe040,0x101fbf,0xfdfc0,0xfe03f,0xfdfbf,0x106040,0x105fc0,0x10603f,0x102041,0x101fc1,0x105fbf,0x11020c0,0xfe041,0xfdfc1,0x11020bf,0x10fe0c0,0x10fe0bf,0x106041,0x105fc1,0x11060c0,0x11060bf,0x11020c1,0x10fe0c1,0x3101f40,0x3101f3f,0x30fdf40,0x30fdf3f,0x70203e,0x93060c1,0x701fbe,0x6fe03e,0x6fdfbe,0x180fa040,0x1b0f9fc0,0x186fa03f,0x1b6f9fbf,0x3105f40,0x3105f3f,0x3101f41,0x30fdf41,0x70603e,0x705fbe,0x17020be,0x16fe0be,0x180fa041,0x1b0f9fc1,0x190fa0c0,0x196fa0bf,0xb305f41,0x930a040,0x97060be,0x970a03f,0xb309fc0,0xb709fbf,0x9302042,0xb301fc2,0x192fa0c1,0x192fe042,0x1b2fdfc2,0xb701f3e,0x1b6fdf3e,
+	15,0x101fc0,0x10203f,0xfe040,0xfdfc0,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x106040,0x105fc0,0x101fc1,0xfe041,0xfdfc1,0x10603f,0x105fbf,0x11020c0,0x11020bf,0x10fe0c0,0x10fe0bf,0x106041,0x105fc1,0x11020c1,0x11060c0,0x11060bf,0x10fe0c1,0x11060c1,0x3101f40,0x30fdf40,0x3101f3f,0x30fdf3f,0x70203e,0x3701fbe,0x180fa040,0x1b0f9fc0,0x180fa03f,0x186fe03e,0x36fdfbe,0x1b6f9fbf,0x3101f41,0x3105f40,0x3105f3f,0x30fdf41,0x1b0f9fc1,0x180fa041,0x70603e,0x3705fbe,0xb305f41,0x17020be,0x190fa0c0,0x190fa0bf,0x196fe0be,0x97060be,0x910a040,0xb109fc0,0x1302042,0x3301fc2,0x192fe042,0x192fa0c1,0x1b2fdfc2,0x970a03f,0xb709fbf,0xa10a041,0xa306042,
+	13,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0x106040,0x105fc0,0xfe041,0xfdfc1,0x11020c0,0x10603f,0x105fbf,0x10fe0c0,0x11020bf,0x106041,0x105fc1,0x10fe0bf,0x11020c1,0x11060c0,0x10fe0c1,0x11060bf,0x91060c1,0x3101f40,0x30fdf40,0x3101f3f,0x30fdf3f,0x180fa040,0x1b0f9fc0,0x3101f41,0x3105f40,0x30fdf41,0x180fa03f,0x1b0f9fbf,0x70203e,0x3701fbe,0x186fe03e,0x1b6fdfbe,0x3105f3f,0xb105f41,0x180fa041,0x1b0f9fc1,0x190fa0c0,0x190fa0bf,0x70603e,0x3705fbe,0x17020be,0x196fe0be,0x1302042,0x3301fc2,0x192fe042,0x1b2fdfc2,0x192fa0c1,0x930a040,0xb309fc0,0x970a03f,0xb709fbf,0x97060be,0x9306042,0xb305fc2,
+	13,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0x102041,0x101fc1,0xfe03f,0xfdfbf,0xfe041,0xfdfc1,0x106040,0x105fc0,0x11020c0,0x10603f,0x105fbf,0x106041,0x105fc1,0x10fe0c0,0x11020bf,0x11020c1,0x10fe0bf,0x10fe0c1,0x11060c0,0x11060bf,0x11060c1,0x3101f40,0x30fdf40,0x3101f3f,0x3101f41,0x30fdf41,0x30fdf3f,0x180fa040,0x1b0f9fc0,0x3105f40,0x3105f3f,0x180fa03f,0x1b0f9fbf,0x180fa041,0x1b0f9fc1,0x70203e,0x3701fbe,0x186fe03e,0x1b6fdfbe,0xb105f41,0x1302042,0x3301fc2,0x192fe042,0x190fa0c0,0x190fa0bf,0x1b2fdfc2,0x192fa0c1,0x70603e,0x3705fbe,0x910a040,0xb109fc0,0x1306042,0xb305fc2,0x97020be,0x196fe0be,0x970a03f,0xb709fbf,0xa30a041,
+	15,0x10203f,0x101fbf,0x101fc0,0xfe040,0xfe03f,0xfdfbf,0xfdfc0,0x106040,0x10603f,0x105fbf,0x105fc0,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x302041,0x1060c0,0x1060bf,0x70203e,0x301fc1,0x2fe041,0x2fdfc1,0x701fbe,0x6fe03e,0x6fdfbe,0x306041,0x305fc1,0x3020c1,0x2fe0c1,0x70603e,0x705fbe,0x7020be,0x6fe0be,0x3101f3f,0x3101f40,0x30fdf40,0x30fdf3f,0x180fa03f,0x180fa040,0x1b0f9fc0,0x1b0f9fbf,0x93060c1,0x97060be,0x3105f3f,0x3105f40,0x180fa0c0,0x180fa0bf,0xb301f41,0x32fdf41,0x192fa041,0x1b2f9fc1,0xb701f3e,0x36fdf3e,0x970a03f,0x930a040,0xb309fc0,0xb709fbf,0x196fa03e,0x1b6f9fbe,0x970213f,0x9302140,0x192fe140,0x196fe13f,
+	13,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0xfdfbf,0x106040,0x10603f,0x105fbf,0x105fc0,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x302041,0x301fc1,0x2fe041,0x1060c0,0x1060bf,0x2fdfc1,0x70203e,0x701fbe,0x6fe03e,0x306041,0x305fc1,0x3020c1,0x2fe0c1,0x6fdfbe,0x3101f3f,0x3101f40,0x70603e,0x705fbe,0x7020be,0x16fe0be,0x180fa03f,0x180fa040,0x30fdf40,0x30fdf3f,0x1b0f9fbf,0x1b0f9fc0,0x93060c1,0x3105f40,0x3105f3f,0x97060be,0x190fa0bf,0x180fa0c0,0x3301f41,0x32fdf41,0x192fa041,0x1b2f9fc1,0x930a040,0x970a03f,0xb709fbf,0xb309fc0,0xb305f41,0xb701f3e,0x36fdf3e,0x196fa03e,0x1b6f9fbe,0x970213f,0x9302140,0x194fe140,
+	15,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0xfdfbf,0x106040,0x10603f,0x105fc0,0x105fbf,0x1020c0,0x1020bf,0xfe0c0,0xfe0bf,0x302041,0x301fc1,0x2fe041,0x2fdfc1,0x1060c0,0x1060bf,0x306041,0x305fc1,0x3020c1,0x2fe0c1,0x70203e,0x701fbe,0x6fe03e,0x6fdfbe,0x3101f3f,0x3101f40,0x30fdf40,0x30fdf3f,0x93060c1,0x70603e,0x705fbe,0x7020be,0x186fa03f,0x180fa040,0x1b0f9fc0,0x1b6f9fbf,0x6fe0be,0x3105f40,0x3105f3f,0x97060be,0x186fa0bf,0x180fa0c0,0x3301f41,0x32fdf41,0x182fa041,0x1b2f9fc1,0xb305f41,0x930a040,0x970a03f,0xb709fbf,0xb309fc0,0xb701f3e,0x1b6fdf3e,0x9302140,0x970213f,0x196fe13f,0x192fe140,0x192fa0c1,
+	13,0x10203f,0x101fc0,0xfe040,0x101fbf,0xfe03f,0xfdfc0,0xfdfbf,0x106040,0x10603f,0x105fc0,0x1020c0,0x1020bf,0x105fbf,0x302041,0xfe0c0,0xfe0bf,0x301fc1,0x2fe041,0x2fdfc1,0x1060c0,0x1060bf,0x306041,0x305fc1,0x3020c1,0x2fe0c1,0x70203e,0x701fbe,0x6fe03e,0x6fdfbe,0x3101f40,0x93060c1,0x3101f3f,0x30fdf40,0x30fdf3f,0x180fa040,0x186fa03f,0x1b0f9fc0,0x1b6f9fbf,0x70603e,0x705fbe,0x7020be,0x6fe0be,0x3105f40,0x3105f3f,0x3301f41,0x32fdf41,0x180fa0c0,0x186fa0bf,0x182fa041,0x1b2f9fc1,0x97060be,0x930a040,0xb305f41,0xb309fc0,0x970a03f,0xb709fbf,0x9302140,0x970213f,0x192fa0c1,0x192fe140,0x196fe13f,0xb701f3e,0x1b6fdf3e,
+	17,0x10203f,0x101fc0,0xfe040,0x101fbf,0xfe03f,0xfdfc0,0xfdfbf,0x106040,0x10603f,0x105fc0,0x102041,0x1020c0,0x1020bf,0x105fbf,0x101fc1,0xfe041,0xfe0c0,0xfe0bf,0xfdfc1,0x106041,0x1060c0,0x1060bf,0x1020c1,0x105fc1,0xfe0c1,0x93060c1,0x70203e,0x701fbe,0x3101f40,0x3701f3f,0x30fdf40,0x30fdf3f,0x6fe03e,0x36fdfbe,0x180fa040,0x186fa03f,0x1b0f9fc0,0x1b6f9fbf,0x70603e,0x705fbe,0x3105f40,0x3705f3f,0x3101f41,0x32fdf41,0x7020be,0x16fe0be,0x180fa0c0,0x180fa041,0x1b2f9fc1,0x196fa0bf,0x97060be,0xb305f41,0x930a040,0x970a03f,0xb309fc0,0xb709fbf,0x192fa0c1,0x9302042,0xb301fc2,0x1a2fe042,0x9302140,0x970213f,0x194fe140,
+	16,0x101fc0,0x10203f,0xfe040,0xfdfc0,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x106040,0x105fc0,0x101fc1,0x1020c0,0x10603f,0xfe041,0xfdfc1,0xfe0c0,0x1020bf,0x105fbf,0xfe0bf,0x106041,0x105fc1,0x1020c1,0x1060c0,0x11060bf,0xfe0c1,0x93060c1,0x3101f40,0x30fdf40,0x3101f3f,0x70203e,0x3701fbe,0x180fa040,0x1b0f9fc0,0x30fdf3f,0x6fe03e,0x186fa03f,0x1b0f9fbf,0x1b6fdfbe,0x3105f40,0x3101f41,0x30fdf41,0x3105f3f,0x70603e,0x3705fbe,0x17020be,0x180fa041,0x1b0f9fc1,0x180fa0c0,0x190fa0bf,0x196fe0be,0xb305f41,0x9302042,0xb301fc2,0x930a040,0xb309fc0,0x97060be,0x970a03f,0xb709fbf,0x192fa0c1,0x192fe042,0x1b2fdfc2,0x9502140,0x194fe140,
+	15,0x101fc0,0xfe040,0x10203f,0xfdfc0,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x101fc1,0x106040,0xfe041,0x1020c0,0x105fc0,0xfdfc1,0x10603f,0x105fbf,0xfe0c0,0x1020bf,0xfe0bf,0x106041,0x105fc1,0x1020c1,0x1060c0,0xfe0c1,0x11060bf,0x91060c1,0x3101f40,0x30fdf40,0x3101f3f,0x180fa040,0x1b0f9fc0,0x30fdf3f,0x180fa03f,0x70203e,0x3701fbe,0x3101f41,0x3105f40,0x1b0f9fbf,0x186fe03e,0x1b6fdfbe,0x30fdf41,0x180fa041,0x1b0f9fc1,0x180fa0c0,0xb105f3f,0x70603e,0xb705fbe,0xb305f41,0x1302042,0x3301fc2,0x192fe042,0x190fa0bf,0x17020be,0x196fe0be,0x192fa0c1,0x1b2fdfc2,0x930a040,0xb309fc0,0xa70a03f,0x97060be,0x9502140,0x194fe140,0xa306042,
+	14,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0x102041,0x101fc1,0xfe03f,0xfdfbf,0xfe041,0x106040,0x105fc0,0xfdfc1,0x1020c0,0xfe0c0,0x10603f,0x105fbf,0x106041,0x1020bf,0x1020c1,0x105fc1,0x10fe0bf,0x10fe0c1,0x1060c0,0x91060bf,0x91060c1,0x3101f40,0x30fdf40,0x180fa040,0x1b0f9fc0,0x3101f3f,0x30fdf3f,0x3101f41,0x30fdf41,0x180fa03f,0x1b0f9fbf,0x180fa041,0x1b0f9fc1,0x3105f40,0x70203e,0x3701fbe,0x186fe03e,0x1b6fdfbe,0xb105f3f,0xb105f41,0x302042,0x3301fc2,0x190fa0c0,0x190fa0bf,0x182fe042,0x1b2fdfc2,0x190fa0c1,0x870603e,0xb705fbe,0x97020be,0x196fe0be,0x950a040,0xb509fc0,0x8306042,0xb305fc2,0x93020c2,0x192fe0c2,0x11502140,
+	15,0x10203f,0x101fbf,0x101fc0,0xfe040,0xfe03f,0xfdfbf,0xfdfc0,0x1020c0,0x1020bf,0x10603f,0x106040,0x105fc0,0x105fbf,0xfe0bf,0xfe0c0,0x1060c0,0x1060bf,0x302041,0x301fc1,0x2fe041,0x70203e,0x701fbe,0x6fe03e,0x2fdfc1,0x6fdfbe,0x3020c1,0x306041,0x305fc1,0x2fe0c1,0x7020be,0x70603e,0x705fbe,0x6fe0be,0x180fa03f,0x180fa040,0x3101f40,0x3101f3f,0x30fdf3f,0x30fdf40,0x1b0f9fc0,0x1b0f9fbf,0x93060c1,0x97060be,0x3105f3f,0x3105f40,0x180fa0c0,0x180fa0bf,0x970213f,0x9302140,0x192fe140,0x192fa041,0x182f9fc1,0xb301f41,0x1b2fdf41,0x930a040,0x970a03f,0xb709fbf,0xb309fc0,0xb701f3e,0x36fdf3e,0x196fa03e,0x196fe13f,0x1b6f9fbe,
+	15,0x10203f,0x101fc0,0xfe040,0xfe03f,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0x106040,0x10603f,0x105fbf,0x105fc0,0xfe0c0,0xfe0bf,0x302041,0x1060c0,0x1060bf,0x301fc1,0x2fe041,0x2fdfc1,0x70203e,0x6fe03e,0x701fbe,0x306041,0x3020c1,0x2fe0c1,0x305fc1,0x6fdfbe,0x7020be,0x70603e,0x705fbe,0x93060c1,0x6fe0be,0x180fa03f,0x180fa040,0x3101f40,0x3101f3f,0x30fdf3f,0x30fdf40,0x1b0f9fc0,0x1b0f9fbf,0x97060be,0x3105f3f,0x3105f40,0x180fa0c0,0x180fa0bf,0x182fa041,0x182f9fc1,0xb301f41,0x1b2fdf41,0x930a040,0x970a03f,0xb709fbf,0xb309fc0,0x9302140,0x970213f,0x196fe13f,0x192fe140,0x192fa0c1,0x196fa03e,0x1b6f9fbe,0x13701f3e,
+	15,0x10203f,0x101fc0,0xfe040,0xfe03f,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x106040,0x10603f,0x1020bf,0xfe0c0,0xfe0bf,0x105fc0,0x105fbf,0x302041,0x301fc1,0x2fe041,0x1060c0,0x1060bf,0x2fdfc1,0x3020c1,0x306041,0x305fc1,0x2fe0c1,0x70203e,0x6fe03e,0x701fbe,0x6fdfbe,0x93060c1,0x70603e,0x7020be,0x6fe0be,0x186fa03f,0x180fa040,0x3101f40,0x3101f3f,0x705fbe,0x30fdf3f,0x30fdf40,0x1b0f9fc0,0x1b6f9fbf,0x180fa0c0,0x186fa0bf,0x97060be,0x3105f3f,0x3105f40,0x3301f41,0x182fa041,0x182f9fc1,0x1b2fdf41,0x930a040,0x970a03f,0x9302140,0x970213f,0x196fe13f,0x192fe140,0x192fa0c1,0xb309fc0,0xb709fbf,0xb305f41,0xb701f3e,0x1b6fdf3e,
+	15,0x10203f,0x101fc0,0xfe040,0xfe03f,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x106040,0x10603f,0x1020bf,0xfe0c0,0xfe0bf,0x105fc0,0x105fbf,0x302041,0x301fc1,0x2fe041,0x2fdfc1,0x1060c0,0x1060bf,0x3020c1,0x306041,0x305fc1,0x2fe0c1,0x3060c1,0x70203e,0x6fe03e,0x701fbe,0x6fdfbe,0x3101f40,0x3701f3f,0x180fa040,0x186fa03f,0x180f9fc0,0x1b0fdf40,0x36fdf3f,0x1b6f9fbf,0x7020be,0x70603e,0x705fbe,0x6fe0be,0x186fa0bf,0x180fa0c0,0x3105f40,0x3705f3f,0x97060be,0x3301f41,0x182fa041,0x182f9fc1,0x1b2fdf41,0xb305f41,0x830a040,0x870a03f,0x1302140,0x170213f,0x192fe140,0x192fa0c1,0x196fe13f,0xb309fc0,0xb709fbf,0x850a0c0,0x9506140,
+	16,0x10203f,0x101fc0,0xfe040,0xfe03f,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x106040,0x10603f,0x1020bf,0x102041,0x105fc0,0xfe0c0,0xfe0bf,0xfe041,0x101fc1,0x105fbf,0xfdfc1,0x1060c0,0x1060bf,0x1020c1,0x106041,0x305fc1,0xfe0c1,0x93060c1,0x70203e,0x6fe03e,0x701fbe,0x3101f40,0x3701f3f,0x180fa040,0x186fa03f,0x6fdfbe,0x30fdf40,0x1b0f9fc0,0x186f9fbf,0x1b6fdf3f,0x70603e,0x7020be,0x6fe0be,0x705fbe,0x3105f40,0x3705f3f,0x3301f41,0x180fa0c0,0x186fa0bf,0x180fa041,0x182f9fc1,0x1b2fdf41,0x97060be,0x9302140,0x970213f,0x930a040,0x970a03f,0xb305f41,0xb309fc0,0xb709fbf,0x192fa0c1,0x192fe140,0x196fe13f,0xa302042,0x1a2fe042,
+	13,0x10203f,0x101fc0,0xfe040,0xfe03f,0x101fbf,0xfdfc0,0xfdfbf,0x102041,0x1020c0,0x106040,0x10603f,0x1020bf,0xfe0c0,0xfe041,0x101fc1,0x105fc0,0x105fbf,0xfe0bf,0xfdfc1,0x1020c1,0x106041,0x1060c0,0x1060bf,0x2fe0c1,0x105fc1,0x93060c1,0x70203e,0x3101f40,0x180fa040,0x180fa03f,0x186fe03e,0x701fbe,0x3701f3f,0x30fdf40,0x1b0f9fc0,0x180f9fbf,0x186fdfbe,0x1b6fdf3f,0x3101f41,0x3105f40,0x70603e,0x7020be,0x180fa0c0,0x182fa041,0x182f9fc1,0x1b2fdf41,0x3105f3f,0x3705fbe,0x6fe0be,0x186fa0bf,0x192fa0c1,0x11302042,0xb305f41,0x930a040,0x97060be,0x9302140,0x970213f,0x192fe140,0x196fe13f,0x970a03f,0xb309fc0,0xb709fbf,0x13301fc2,
+	17,0x101fc0,0xfe040,0x10203f,0xfdfc0,0x101fbf,0xfe03f,0x102041,0xfdfbf,0x1020c0,0x106040,0x101fc1,0xfe041,0xfe0c0,0x105fc0,0x10603f,0x1020bf,0xfdfc1,0x105fbf,0xfe0bf,0x1020c1,0x106041,0x1060c0,0x105fc1,0xfe0c1,0x1060bf,0x93060c1,0x3101f40,0x180fa040,0x180f9fc0,0x1b0fdf40,0x3101f3f,0x70203e,0x180fa03f,0x180f9fbf,0x1b0fdf3f,0x3701fbe,0x186fe03e,0x1b6fdfbe,0x3101f41,0x3105f40,0x180fa041,0x180fa0c0,0x180f9fc1,0x1b0fdf41,0xb105f3f,0x70603e,0x7020be,0x190fa0bf,0x196fe0be,0xb705fbe,0xb305f41,0x9302042,0xb301fc2,0x192fe042,0x192fa0c1,0x9302140,0x192fe140,0x930a040,0xb309fc0,0xa70a03f,0x97060be,0x1170213f,0x1b2fdfc2,
+	14,0x101fc0,0xfe040,0x10203f,0xfdfc0,0x102041,0x101fbf,0xfe03f,0xfe041,0x101fc1,0x106040,0x1020c0,0xfdfbf,0xfdfc1,0x105fc0,0xfe0c0,0x1020bf,0x10603f,0x106041,0x1020c1,0x10fe0bf,0x105fbf,0x105fc1,0x10fe0c1,0x1060c0,0x91060bf,0x91060c1,0x3101f40,0x180fa040,0x180f9fc0,0x1b0fdf40,0x3101f3f,0x180fa03f,0x180f9fbf,0x180fa041,0x3101f41,0x30fdf41,0x1b0fdf3f,0x70203e,0x3701fbe,0x186fe03e,0x190fa0c0,0x1b0f9fc1,0x3105f40,0xb105f3f,0x1b6fdfbe,0x302042,0x182fe042,0x3301fc2,0xb105f41,0x1b2fdfc2,0x190fa0c1,0x190fa0bf,0x17020be,0x970603e,0xb705fbe,0x196fe0be,0x11502140,0x13020c2,0x9306042,0x950a040,0xb509fc0,0xb305fc2,0x192fe0c2,
+	15,0x10203f,0xfe03f,0xfe040,0x101fc0,0x101fbf,0xfdfbf,0xfdfc0,0x1020c0,0x1020bf,0x10603f,0x106040,0xfe0c0,0xfe0bf,0x105fbf,0x105fc0,0x1060c0,0x1060bf,0x302041,0x2fe041,0x301fc1,0x70203e,0x6fe03e,0x701fbe,0x2fdfc1,0x3020c1,0x306041,0x2fe0c1,0x6fdfbe,0x7020be,0x70603e,0x6fe0be,0x305fc1,0x705fbe,0x93060c1,0x180fa040,0x180fa03f,0x180f9fbf,0x180f9fc0,0x97060be,0x3101f3f,0x3101f40,0x1b0fdf40,0x1b0fdf3f,0x180fa0bf,0x180fa0c0,0x3105f40,0x3105f3f,0x970213f,0x9302140,0x192fe140,0x196fe13f,0x192fa041,0x182f9fc1,0x930a040,0x970a03f,0xb709fbf,0xb309fc0,0xb301f41,0x1b2fdf41,0x196fa03e,0x186f9fbe,0xb701f3e,0x1b6fdf3e,
+	15,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfbf,0xfdfc0,0x1020c0,0x1020bf,0x106040,0x10603f,0xfe0c0,0xfe0bf,0x105fc0,0x105fbf,0x1060c0,0x1060bf,0x302041,0x2fe041,0x301fc1,0x2fdfc1,0x3020c1,0x306041,0x70203e,0x6fe03e,0x701fbe,0x2fe0c1,0x305fc1,0x6fdfbe,0x7020be,0x70603e,0x83060c1,0x6fe0be,0x186fa03f,0x180fa040,0x705fbe,0x3701f3f,0x3101f40,0x180f9fc0,0x186f9fbf,0x1b6fdf3f,0x1b0fdf40,0x7060be,0x186fa0bf,0x180fa0c0,0x3105f40,0x3705f3f,0x1302140,0x170213f,0x196fe13f,0x192fe140,0x182fa041,0x182f9fc1,0xb301f41,0x930a040,0x870a03f,0xb709fbf,0xb309fc0,0x1b2fdf41,0x192fa0c1,0x9306140,0x170613f,0x970a0bf,
+	15,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0x106040,0x10603f,0xfe0c0,0xfe0bf,0x105fc0,0x105fbf,0x302041,0x1060c0,0x1060bf,0x2fe041,0x301fc1,0x2fdfc1,0x3020c1,0x306041,0x2fe0c1,0x305fc1,0x70203e,0x6fe03e,0x701fbe,0x6fdfbe,0x3060c1,0x7020be,0x70603e,0x6fe0be,0x186fa03f,0x180fa040,0x180f9fc0,0x186f9fbf,0x705fbe,0x3701f3f,0x3101f40,0x1b0fdf40,0x1b6fdf3f,0x87060be,0x186fa0bf,0x180fa0c0,0x182fa041,0x3105f40,0x3705f3f,0x1302140,0x170213f,0x196fe13f,0x192fe140,0x182f9fc1,0xb301f41,0x1b2fdf41,0x830a040,0x870a03f,0xb709fbf,0xb309fc0,0x192fa0c1,0x1306140,0x970613f,0x950a0c0,
+	13,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0x106040,0x10603f,0xfe0c0,0xfe0bf,0x302041,0x105fc0,0x105fbf,0x2fe041,0x301fc1,0x1060c0,0x1060bf,0x2fdfc1,0x3020c1,0x306041,0x2fe0c1,0x305fc1,0x83060c1,0x70203e,0x6fe03e,0x701fbe,0x6fdfbe,0x180fa040,0x186fa03f,0x7020be,0x70603e,0x6fe0be,0x180f9fc0,0x186f9fbf,0x3101f40,0x3701f3f,0x1b0fdf40,0x1b6fdf3f,0x705fbe,0x87060be,0x180fa0c0,0x186fa0bf,0x182fa041,0x182f9fc1,0x3105f40,0x3705f3f,0x3301f41,0x1b2fdf41,0x1302140,0x170213f,0x192fe140,0x196fe13f,0x192fa0c1,0x930a040,0x970a03f,0xb309fc0,0xb709fbf,0xb305f41,0x9306140,0x970613f,
+	15,0x10203f,0xfe040,0x101fc0,0xfe03f,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x1020bf,0x106040,0xfe0c0,0x102041,0x10603f,0xfe0bf,0x105fc0,0x105fbf,0xfe041,0x101fc1,0xfdfc1,0x1060c0,0x1060bf,0x1020c1,0x106041,0xfe0c1,0x305fc1,0x83060c1,0x70203e,0x6fe03e,0x701fbe,0x180fa040,0x186fa03f,0x6fdfbe,0x180f9fc0,0x3101f40,0x3701f3f,0x7020be,0x70603e,0x186f9fbf,0x1b0fdf40,0x1b6fdf3f,0x6fe0be,0x180fa0c0,0x186fa0bf,0x180fa041,0x8705fbe,0x3105f40,0xb705f3f,0x97060be,0x1302140,0x170213f,0x192fe140,0x182f9fc1,0x3301f41,0x1b2fdf41,0x192fa0c1,0x196fe13f,0x930a040,0x970a03f,0xb509fc0,0xb305f41,0xa302042,0x1a2fe042,0x9506140,
+	17,0x10203f,0xfe040,0x101fc0,0xfe03f,0x101fbf,0xfdfc0,0x1020c0,0xfdfbf,0x102041,0x106040,0x1020bf,0xfe0c0,0xfe041,0x10603f,0x105fc0,0x101fc1,0xfe0bf,0x105fbf,0xfdfc1,0x1020c1,0x1060c0,0x106041,0x1060bf,0xfe0c1,0x105fc1,0x93060c1,0x70203e,0x180fa040,0x180fa03f,0x186fe03e,0x701fbe,0x3101f40,0x180f9fc0,0x180f9fbf,0x186fdfbe,0x3701f3f,0x1b0fdf40,0x1b6fdf3f,0x7020be,0x70603e,0x180fa0c0,0x180fa041,0x180fa0bf,0x186fe0be,0x8705fbe,0x3105f40,0x3101f41,0x182f9fc1,0x1b2fdf41,0xb705f3f,0x97060be,0x9302140,0x970213f,0x192fe140,0x192fa0c1,0x9302042,0x192fe042,0x930a040,0x970a03f,0xb509fc0,0xb305f41,0x13301fc2,0x196fe13f,
+	14,0xfe040,0x10203f,0x101fc0,0xfdfc0,0xfe03f,0x101fbf,0x102041,0x1020c0,0x106040,0xfdfbf,0xfe041,0xfe0c0,0x1020bf,0x101fc1,0x105fc0,0x10603f,0xfe0bf,0xfdfc1,0x1020c1,0x106041,0x1060c0,0x8105fbf,0xfe0c1,0x81060bf,0x8105fc1,0x91060c1,0x180fa040,0x180f9fc0,0x180fa03f,0x70203e,0x3101f40,0x1b0fdf40,0x3101f3f,0x3701fbe,0x186fe03e,0x180f9fbf,0x180fa041,0x180fa0c0,0x180fa0bf,0x186fdfbe,0x1b6fdf3f,0x3101f41,0x180f9fc1,0x1b0fdf41,0xb105f40,0x7020be,0x870603e,0x186fe0be,0x9302140,0x192fa0c1,0x8302042,0x182fe042,0xb301fc2,0xb105f3f,0xb705fbe,0x97060be,0x970213f,0x192fe140,0x196fe13f,0xa50a040,0xb305f41,0x1b2fdfc2,0x113020c2,
+	15,0xfe040,0x101fc0,0x10203f,0xfdfc0,0x102041,0x1020c0,0xfe03f,0x101fbf,0xfe041,0x101fc1,0x106040,0xfe0c0,0xfdfbf,0xfdfc1,0x1020bf,0x105fc0,0x10603f,0x1020c1,0x106041,0xfe0bf,0xfe0c1,0x1060c0,0x8105fbf,0x8105fc1,0x81060bf,0x81060c1,0x180fa040,0x180f9fc0,0x3101f40,0x1b0fdf40,0x180fa03f,0x180fa041,0x180fa0c0,0x180f9fbf,0x70203e,0x3101f3f,0x1b0fdf3f,0x3101f41,0x180f9fc1,0x1b0fdf41,0x302042,0x182fe042,0x186fe03e,0x3701fbe,0x1b6fdfbe,0x190fa0bf,0x190fa0c1,0xb105f40,0x3301fc2,0x1b2fdfc2,0x9102140,0x7020be,0xa70603e,0x196fe0be,0x190fe140,0x1170213f,0xb705f3f,0xb305f41,0xa50a040,0x3020c2,0xa306042,0x192fe0c2,0x11302141,
+	17,0x10203f,0xfe03f,0xfe040,0x101fc0,0x101fbf,0x1020bf,0x1020c0,0xfdfc0,0xfdfbf,0xfe0bf,0xfe0c0,0x106040,0x10603f,0x105fbf,0x105fc0,0x1060c0,0x1060bf,0x302041,0x2fe041,0x70203e,0x6fe03e,0x301fc1,0x3020c1,0x2fdfc1,0x701fbe,0x7020be,0x2fe0c1,0x306041,0x6fdfbe,0x6fe0be,0x70603e,0x305fc1,0x3060c1,0x705fbe,0x7060be,0x180fa03f,0x180fa040,0x180f9fc0,0x180f9fbf,0x180fa0bf,0x180fa0c0,0x3301f40,0x3701f3f,0x1b6fdf3f,0x1b2fdf40,0x1302140,0x170213f,0x196fe13f,0x192fe140,0x3305f40,0x3705f3f,0x870a03f,0x830a040,0x1306140,0x170613f,0x192fa041,0x1b2f9fc1,0x196fa03e,0x1b6f9fbe,0xb709fbf,0xb309fc0,0x930a0c0,0x970a0bf,
+	17,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0x1020c0,0x1020bf,0xfdfc0,0xfdfbf,0xfe0c0,0xfe0bf,0x106040,0x10603f,0x105fbf,0x105fc0,0x1060c0,0x1060bf,0x302041,0x2fe041,0x301fc1,0x3020c1,0x2fdfc1,0x2fe0c1,0x70203e,0x6fe03e,0x306041,0x305fc1,0x701fbe,0x7020be,0x6fdfbe,0x6fe0be,0x3060c1,0x70603e,0x705fbe,0x180fa03f,0x180fa040,0x180f9fc0,0x180f9fbf,0x7060be,0x180fa0bf,0x180fa0c0,0x3301f40,0x3701f3f,0x1b6fdf3f,0x1b2fdf40,0x1302140,0x170213f,0x196fe13f,0x192fe140,0x182fa041,0x3305f40,0x3705f3f,0x870a03f,0x830a040,0x1306140,0x170613f,0x970a0bf,0x930a0c0,0xb309fc0,0xb709fbf,0x1b2f9fc1,0x192fa0c1,0x1a6fa03e,
+	16,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0x1020c0,0x1020bf,0xfdfc0,0xfdfbf,0xfe0c0,0xfe0bf,0x106040,0x10603f,0x105fc0,0x105fbf,0x1060c0,0x302041,0x1060bf,0x2fe041,0x301fc1,0x3020c1,0x2fdfc1,0x2fe0c1,0x306041,0x305fc1,0x70203e,0x6fe03e,0x3060c1,0x701fbe,0x7020be,0x6fe0be,0x6fdfbe,0x70603e,0x180fa040,0x186fa03f,0x180f9fc0,0x186f9fbf,0x705fbe,0x87060be,0x186fa0bf,0x180fa0c0,0x3101f40,0x3701f3f,0x1b6fdf3f,0x1b0fdf40,0x1302140,0x170213f,0x196fe13f,0x192fe140,0x182fa041,0x182f9fc1,0x3105f40,0x3705f3f,0x830a040,0x870a03f,0x1306140,0x970613f,0x192fa0c1,0xb301f41,0x1b2fdf41,0xb309fc0,0xb709fbf,0x950a0c0,
+	13,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0x1020c0,0x1020bf,0xfdfc0,0xfdfbf,0xfe0c0,0xfe0bf,0x106040,0x10603f,0x302041,0x105fc0,0x105fbf,0x1060c0,0x1060bf,0x2fe041,0x301fc1,0x3020c1,0x2fdfc1,0x2fe0c1,0x306041,0x305fc1,0x3060c1,0x70203e,0x6fe03e,0x701fbe,0x7020be,0x6fe0be,0x6fdfbe,0x180fa040,0x186fa03f,0x70603e,0x705fbe,0x180f9fc0,0x186f9fbf,0x180fa0c0,0x186fa0bf,0x3101f40,0x3701f3f,0x1b0fdf40,0x1b6fdf3f,0x87060be,0x1302140,0x170213f,0x192fe140,0x182fa041,0x182f9fc1,0x196fe13f,0x192fa0c1,0x3105f40,0x3705f3f,0x830a040,0x870a03f,0x1306140,0x970613f,0xb301f41,0x1b2fdf41,0xb309fc0,0xb709fbf,0x950a0c0,
+	14,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0x1020c0,0x1020bf,0xfdfc0,0xfdfbf,0xfe0c0,0x106040,0x10603f,0xfe0bf,0x102041,0xfe041,0x105fc0,0x105fbf,0x1060c0,0x101fc1,0x1020c1,0x1060bf,0x2fdfc1,0x2fe0c1,0x106041,0x8305fc1,0x83060c1,0x70203e,0x6fe03e,0x180fa040,0x186fa03f,0x701fbe,0x6fdfbe,0x7020be,0x6fe0be,0x180f9fc0,0x186f9fbf,0x180fa0c0,0x186fa0bf,0x70603e,0x3101f40,0x3701f3f,0x1b0fdf40,0x1b6fdf3f,0x8705fbe,0x87060be,0x1102140,0x170213f,0x182fa041,0x182f9fc1,0x190fe140,0x196fe13f,0x182fa0c1,0xb105f40,0xb705f3f,0xb301f41,0x1b2fdf41,0xa30a040,0xa70a03f,0x9106140,0x970613f,0x9302141,0x192fe141,0x12302042,
+	14,0x10203f,0xfe040,0x101fc0,0xfe03f,0x1020c0,0x101fbf,0xfdfc0,0xfe0c0,0x1020bf,0x106040,0x102041,0xfdfbf,0xfe0bf,0x10603f,0xfe041,0x101fc1,0x105fc0,0x1060c0,0x1020c1,0x2fdfc1,0x105fbf,0x1060bf,0x2fe0c1,0x106041,0x8305fc1,0x83060c1,0x70203e,0x180fa040,0x180fa03f,0x186fe03e,0x701fbe,0x180f9fc0,0x180f9fbf,0x180fa0c0,0x7020be,0x6fe0be,0x186fdfbe,0x3101f40,0x3701f3f,0x1b0fdf40,0x182fa041,0x186fa0bf,0x70603e,0x8705fbe,0x1b6fdf3f,0x1102140,0x190fe140,0x170213f,0x87060be,0x196fe13f,0x182fa0c1,0x182f9fc1,0x3301f41,0xb305f40,0xb705f3f,0x1b2fdf41,0x12302042,0x1302141,0x9306140,0xa30a040,0xa70a03f,0x970613f,0x192fe141,
+	15,0xfe040,0x10203f,0x101fc0,0xfe03f,0x1020c0,0x102041,0xfdfc0,0x101fbf,0xfe0c0,0x1020bf,0x106040,0xfe041,0xfdfbf,0xfe0bf,0x101fc1,0x10603f,0x105fc0,0x1020c1,0x1060c0,0xfdfc1,0xfe0c1,0x106041,0x8105fbf,0x81060bf,0x8105fc1,0x81060c1,0x180fa040,0x180fa03f,0x70203e,0x186fe03e,0x180f9fc0,0x180fa0c0,0x180fa041,0x180f9fbf,0x3101f40,0x701fbe,0x186fdfbe,0x7020be,0x180fa0bf,0x186fe0be,0x1102140,0x190fe140,0x1b0fdf40,0x3701f3f,0x1b6fdf3f,0x182f9fc1,0x182fa0c1,0x870603e,0x170213f,0x196fe13f,0x8302042,0x3101f41,0xb505f40,0x1b2fdf41,0x182fe042,0x13301fc2,0xb705fbe,0x97060be,0xa50a040,0x1102141,0x9506140,0x192fe141,0x113020c2,
+	16,0xfe040,0x10203f,0x101fc0,0x102041,0x1020c0,0xfe03f,0xfdfc0,0xfe041,0xfe0c0,0x106040,0x101fbf,0x1020bf,0x101fc1,0x1020c1,0xfdfbf,0xfe0bf,0xfdfc1,0x105fc0,0x10603f,0x1060c0,0xfe0c1,0x106041,0x8105fbf,0x81060bf,0x8105fc1,0x81060c1,0x180fa040,0x180fa03f,0x180f9fc0,0x180fa041,0x180fa0c0,0x70203e,0x3101f40,0x1b0fdf40,0x180f9fbf,0x186fe03e,0x180fa0bf,0x182f9fc1,0x182fa0c1,0x8302042,0x1102140,0x190fe140,0x7020be,0x701fbe,0x3701f3f,0x1b0fdf3f,0x3101f41,0x182fe042,0x13301fc2,0x1b2fdf41,0x1b6fdfbe,0x186fe0be,0x170213f,0x970603e,0xb305f40,0xb105f3f,0xb705fbe,0xa50a040,0x103020c2,0x1302141,0x192fe141,0x196fe13f,0x9506140,
+	11,0x10203f,0x101fc0,0x101fbf,0xfdfbf,0xfe03f,0xfe040,0xfdfc0,0x105fc0,0x106040,0x10603f,0x105fbf,0x11020bf,0x11020c0,0x302041,0x301fc1,0x3101f40,0x3101f3f,0x701fbe,0x70203e,0x10fe0bf,0x10fe0c0,0x2fe041,0x2fdfc1,0x30fdf40,0x30fdf3f,0x6fdfbe,0x6fe03e,0x11060bf,0x11060c0,0x306041,0x305fc1,0x3105f40,0x3105f3f,0x705fbe,0x70603e,0x13020c1,0x12fe0c1,0x180fa040,0x180fa03f,0x180f9fbf,0x180f9fc0,0x3301f41,0x32fdf41,0x17020be,0x16fe0be,0x3701f3e,0x36fdf3e,0x93060c1,0x97060be,0xb305f41,0xb309fc0,0x930a040,0x970a03f,0xb709fbf,0xb705f3e,0x190fa0bf,0x190fa0c0,0x192fa041,0x182f9fc1,0x1b2f9f40,0x1b0f9f3f,0x1b6f9fbe,0x196fa03e,
+	11,0x101fc0,0x101fbf,0x10203f,0xfe040,0xfdfc0,0xfdfbf,0xfe03f,0x106040,0x105fc0,0x105fbf,0x10603f,0x302041,0x301fc1,0x11020c0,0x11020bf,0x2fe041,0x2fdfc1,0x3101f40,0x3101f3f,0x10fe0c0,0x10fe0bf,0x70203e,0x701fbe,0x30fdf3f,0x30fdf40,0x305fc1,0x306041,0x11060c0,0x11060bf,0x6fe03e,0x6fdfbe,0x3105f3f,0x3105f40,0x705fbe,0x70603e,0x13020c1,0x12fe0c1,0x3301f41,0x32fdf41,0x180f9fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x17020be,0x93060c1,0xb305f41,0x3701f3e,0x36fdf3e,0x16fe0be,0x97060be,0x970a03f,0x930a040,0xb309fc0,0xb709fbf,0xb705f3e,0x182f9fc1,0x182fa041,0x192fa0c0,0x190fa0bf,0x1b0f9f3f,0x1b2f9f40,0x1b6f9fbe,0x196fa03e,
+	11,0x101fc0,0x101fbf,0x10203f,0xfe040,0xfdfc0,0xfdfbf,0xfe03f,0x106040,0x105fc0,0x105fbf,0x10603f,0x302041,0x301fc1,0x2fdfc1,0x2fe041,0x11020c0,0x11020bf,0x10fe0c0,0x306041,0x305fc1,0x3101f40,0x3101f3f,0x10fe0bf,0x30fdf40,0x30fdf3f,0x701fbe,0x70203e,0x11060bf,0x11060c0,0x3105f40,0x3105f3f,0x6fdfbe,0x6fe03e,0x70603e,0x705fbe,0x13020c1,0x12fe0c1,0x3301f41,0x32fdf41,0x180f9fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x93060c1,0xb305f41,0x17020be,0x16fe0be,0x3701f3e,0x36fdf3e,0xb709fbf,0xb309fc0,0x930a040,0x970a03f,0x97060be,0xb705f3e,0x182f9fc1,0x182fa041,0x192fa0c0,0x190fa0bf,0x1b2f9f40,0x1b0f9f3f,0x1b6f9fbe,0x196fa03e,
+	13,0x101fc0,0x101fbf,0x10203f,0xfe040,0xfdfc0,0xfdfbf,0xfe03f,0x106040,0x105fc0,0x105fbf,0x10603f,0x102041,0x101fc1,0xfdfc1,0xfe041,0x11020c0,0x11020bf,0x106041,0x105fc1,0x3101f40,0x3101f3f,0x10fe0c0,0x10fe0bf,0x30fdf40,0x30fdf3f,0x11060c0,0x11060bf,0x3105f40,0x3105f3f,0x701fbe,0x70203e,0x6fe03e,0x6fdfbe,0x11020c1,0x12fe0c1,0x3101f41,0x32fdf41,0x705fbe,0x70603e,0x93060c1,0x180fa040,0x180f9fc0,0x186f9fbf,0x186fa03f,0xb305f41,0xb309fc0,0x930a040,0x17020be,0x16fe0be,0x3701f3e,0xb709fbf,0x970a03f,0x182fa041,0x182f9fc1,0x36fdf3e,0x97060be,0xb705f3e,0x192fa0c0,0x196fa0bf,0x1b2f9f40,0x1b6f9f3f,0x13301fc2,0x11302042,
+	15,0x101fc0,0x101fbf,0x10203f,0xfe040,0xfdfc0,0xfdfbf,0xfe03f,0x106040,0x105fc0,0x105fbf,0x10603f,0x102041,0x101fc1,0xfdfc1,0xfe041,0x106041,0x105fc1,0x11020c0,0x11020bf,0x10fe0c0,0x3101f40,0x3101f3f,0x30fdf40,0x10fe0bf,0x11060c0,0x11060bf,0x30fdf3f,0x3105f40,0x3105f3f,0x11020c1,0x10fe0c1,0x3101f41,0x30fdf41,0x701fbe,0x70203e,0x6fe03e,0x6fdfbe,0x93060c1,0xb305f41,0x180f9fc0,0x180fa040,0x186fa03f,0x186f9fbf,0x705fbe,0x70603e,0x17020be,0x930a040,0xb309fc0,0xb709fbf,0x970a03f,0x180fa041,0x180f9fc1,0xb701f3e,0x1b6fdf3e,0x16fe0be,0x192fa0c0,0x196fa0bf,0x97060be,0x9302042,0xb301fc2,0x1b2fdfc2,0x192fe042,0x1b4f9f40,
+	15,0x101fc0,0x101fbf,0x10203f,0xfe040,0xfdfc0,0xfdfbf,0xfe03f,0x106040,0x105fc0,0x101fc1,0x102041,0x10603f,0x105fbf,0xfdfc1,0xfe041,0x106041,0x105fc1,0x11020c0,0x11020bf,0x10fe0c0,0x3101f40,0x3101f3f,0x30fdf40,0x10fe0bf,0x11060c0,0x11020c1,0x11060bf,0x30fdf3f,0x3105f40,0x3101f41,0x3105f3f,0x10fe0c1,0x30fdf41,0x93060c1,0x70203e,0x701fbe,0x6fdfbe,0x6fe03e,0xb305f41,0x180f9fc0,0x180fa040,0x186fa03f,0x186f9fbf,0x705fbe,0x70603e,0x180fa041,0x180f9fc1,0xb309fc0,0x930a040,0x970a03f,0xb709fbf,0x97020be,0x16fe0be,0x9302042,0xb301fc2,0x1b2fdfc2,0x192fe042,0x192fa0c0,0x196fa0bf,0xb701f3e,0x36fdf3e,0x1b2f9f40,0x1b6f9f3f,
+	17,0x101fc0,0x101fbf,0x10203f,0xfe040,0xfdfc0,0xfdfbf,0xfe03f,0x102041,0x101fc1,0x105fc0,0x106040,0x10603f,0x105fbf,0xfdfc1,0xfe041,0x106041,0x105fc1,0x11020c0,0x11020bf,0x10fe0c0,0x3101f40,0x3101f3f,0x30fdf40,0x10fe0bf,0x11020c1,0x11060c0,0x11060bf,0x30fdf3f,0x3101f41,0x3105f40,0x3105f3f,0x10fe0c1,0x30fdf41,0x11060c1,0x3105f41,0x3701fbe,0x70203e,0x180fa040,0x1b0f9fc0,0x1b0f9fbf,0x180fa03f,0x186fe03e,0x1b6fdfbe,0x3705fbe,0x70603e,0x180fa041,0x1b0f9fc1,0x3301fc2,0x1302042,0x910a040,0xb109fc0,0xb709fbf,0x970a03f,0x192fe042,0x1b2fdfc2,0x3305fc2,0x1306042,0x930a041,0xb309fc1,0x97020be,0x192fa0c0,0x190fa0bf,0x196fe0be,
+	17,0x101fc0,0xfdfc0,0xfe040,0x10203f,0x101fbf,0x101fc1,0x102041,0x106040,0x105fc0,0xfdfbf,0xfe03f,0xfe041,0xfdfc1,0x105fbf,0x10603f,0x106041,0x105fc1,0x11020c0,0x10fe0c0,0x3101f40,0x30fdf40,0x11020bf,0x11020c1,0x11060c0,0x10fe0bf,0x3101f3f,0x3101f41,0x3105f40,0x30fdf3f,0x10fe0c1,0x11060bf,0x11060c1,0x30fdf41,0x3105f3f,0x3105f41,0x1b0f9fc0,0x180fa040,0x180fa03f,0x1b0f9fbf,0x3701fbe,0x70203e,0x186fe03e,0x1b6fdfbe,0x1b0f9fc1,0x180fa041,0x1302042,0x3301fc2,0x1b2fdfc2,0x192fe042,0x910a040,0xb109fc0,0x3705fbe,0x70603e,0x970a03f,0xb709fbf,0x3305fc2,0x1306042,0x930a041,0xb309fc1,0x192fa0c0,0x190fa0bf,0x97020be,0x196fe0be,
+	11,0x10203f,0x101fbf,0x101fc0,0xfe040,0xfe03f,0xfdfbf,0xfdfc0,0x106040,0x10603f,0x105fbf,0x105fc0,0x11020c0,0x11020bf,0x302041,0x301fc1,0x10fe0c0,0x10fe0bf,0x70203e,0x701fbe,0x2fe041,0x2fdfc1,0x3101f40,0x3101f3f,0x6fdfbe,0x6fe03e,0x11060bf,0x11060c0,0x306041,0x305fc1,0x30fdf40,0x30fdf3f,0x705fbe,0x70603e,0x3105f3f,0x3105f40,0x13020c1,0x12fe0c1,0x17020be,0x16fe0be,0x180fa03f,0x180fa040,0x180f9fc0,0x180f9fbf,0x3301f41,0x93060c1,0x97060be,0x3701f3e,0x36fdf3e,0x32fdf41,0xb305f41,0xb309fc0,0x930a040,0x970a03f,0xb709fbf,0xb705f3e,0x190fa0bf,0x190fa0c0,0x192fa041,0x182f9fc1,0x186f9fbe,0x196fa03e,0x1b6f9f3f,0x1b2f9f40,
+	11,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0xfdfbf,0x106040,0x10603f,0x105fbf,0x105fc0,0x301fc1,0x302041,0x11020c0,0x11020bf,0x10fe0bf,0x10fe0c0,0x2fe041,0x2fdfc1,0x305fc1,0x306041,0x11060c0,0x11060bf,0x70203e,0x701fbe,0x3101f3f,0x3101f40,0x30fdf40,0x30fdf3f,0x6fdfbe,0x6fe03e,0x70603e,0x705fbe,0x3105f3f,0x3105f40,0x13020c1,0x12fe0c1,0x180fa040,0x180fa03f,0x180f9fbf,0x180f9fc0,0x3301f41,0x93060c1,0x17020be,0x16fe0be,0x32fdf41,0xb305f41,0x3701f3e,0x97060be,0x970a03f,0x930a040,0xb309fc0,0xb709fbf,0x36fdf3e,0xb705f3e,0x190fa0bf,0x190fa0c0,0x192fa041,0x182f9fc1,0x1b2f9f40,0x1b0f9f3f,0x1b6f9fbe,0x196fa03e,
+	11,0x101fc0,0x10203f,0x101fbf,0xfe040,0xfdfc0,0xfe03f,0xfdfbf,0x106040,0x105fc0,0x105fbf,0x10603f,0x302041,0x301fc1,0x11020c0,0x11020bf,0x2fe041,0x2fdfc1,0x10fe0c0,0x10fe0bf,0x306041,0x305fc1,0x11060c0,0x11060bf,0x3101f40,0x3101f3f,0x701fbe,0x70203e,0x30fdf3f,0x30fdf40,0x6fdfbe,0x6fe03e,0x13020c1,0x3105f40,0x3105f3f,0x705fbe,0x70603e,0x12fe0c1,0x93060c1,0x3301f41,0x180f9fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x32fdf41,0xb305f41,0x17020be,0x16fe0be,0x97060be,0x970a03f,0x930a040,0xb309fc0,0xb709fbf,0x3701f3e,0x36fdf3e,0x182f9fc1,0x182fa041,0x192fa0c0,0x190fa0bf,0xb705f3e,0x1b0f9f3f,0x1b2f9f40,0x1b6f9fbe,0x196fa03e,
+	13,0x101fc0,0x10203f,0x101fbf,0xfe040,0xfdfc0,0xfe03f,0xfdfbf,0x106040,0x105fc0,0x105fbf,0x10603f,0x102041,0x101fc1,0xfdfc1,0xfe041,0x11020c0,0x11020bf,0x10fe0c0,0x106041,0x105fc1,0x10fe0bf,0x11060c0,0x11060bf,0x3101f40,0x3101f3f,0x30fdf40,0x30fdf3f,0x701fbe,0x70203e,0x11020c1,0x12fe0c1,0x3105f40,0x3105f3f,0x6fdfbe,0x6fe03e,0x70603e,0x705fbe,0x13060c1,0x3101f41,0x32fdf41,0x1b0f9fc0,0x180fa040,0x186fa03f,0x1b6f9fbf,0x3305f41,0x17020be,0x16fe0be,0x910a040,0xb109fc0,0xb709fbf,0x970a03f,0x97060be,0x182fa041,0x1b2f9fc1,0x3701f3e,0x1b6fdf3e,0x192fa0c0,0x196fa0bf,0xb705f3e,0xb309fc1,0x930a041,0x11302042,0x13301fc2,
+	15,0x101fc0,0x10203f,0x101fbf,0xfe040,0xfdfc0,0xfe03f,0xfdfbf,0x106040,0x105fc0,0x105fbf,0x10603f,0x102041,0x101fc1,0xfdfc1,0xfe041,0x11020c0,0x106041,0x105fc1,0x11020bf,0x10fe0c0,0x10fe0bf,0x11060c0,0x11060bf,0x3101f40,0x3101f3f,0x30fdf40,0x30fdf3f,0x11020c1,0x10fe0c1,0x3105f40,0x3105f3f,0x701fbe,0x70203e,0x6fe03e,0x6fdfbe,0x3101f41,0x93060c1,0x30fdf41,0x1b0f9fc0,0x180fa040,0x186fa03f,0x1b6f9fbf,0x70603e,0x705fbe,0x3305f41,0xb109fc0,0x930a040,0x17020be,0x16fe0be,0x180fa041,0x1b0f9fc1,0x970a03f,0xb709fbf,0x97060be,0x192fa0c0,0x196fa0bf,0xb701f3e,0x1b6fdf3e,0xb301fc2,0x9302042,0x192fe042,0x1b2fdfc2,0xb309fc1,
+	15,0x101fc0,0x10203f,0x101fbf,0xfe040,0xfdfc0,0xfdfbf,0xfe03f,0x106040,0x105fc0,0x102041,0x101fc1,0x10603f,0x105fbf,0xfe041,0xfdfc1,0x106041,0x105fc1,0x11020c0,0x11020bf,0x10fe0c0,0x10fe0bf,0x11060c0,0x11020c1,0x3101f40,0x3101f3f,0x30fdf40,0x11060bf,0x10fe0c1,0x30fdf3f,0x3105f40,0x3101f41,0x13060c1,0x3105f3f,0x3701fbe,0x70203e,0x30fdf41,0x1b0f9fc0,0x180fa040,0x6fe03e,0x36fdfbe,0x1b6f9fbf,0x186fa03f,0x3105f41,0x3705fbe,0x70603e,0x180fa041,0x1b0f9fc1,0x910a040,0xb109fc0,0xb709fbf,0x970a03f,0x17020be,0x16fe0be,0x192fa0c0,0x9302042,0x3301fc2,0x1b2fdfc2,0x192fe042,0x196fa0bf,0x97060be,0x930a041,0xb109fc1,0xb305fc2,
+	17,0x101fc0,0x10203f,0xfe040,0xfdfc0,0x101fbf,0xfdfbf,0xfe03f,0x102041,0x101fc1,0x106040,0x105fc0,0x105fbf,0x10603f,0xfe041,0xfdfc1,0x106041,0x105fc1,0x11020c0,0x11020bf,0x10fe0c0,0x10fe0bf,0x11020c1,0x11060c0,0x3101f40,0x30fdf40,0x3101f3f,0x11060bf,0x10fe0c1,0x11060c1,0x3101f41,0x3105f40,0x30fdf3f,0x3105f3f,0x30fdf41,0x3105f41,0x1b0f9fc0,0x180fa040,0x70203e,0x3701fbe,0x36fdfbe,0x6fe03e,0x186fa03f,0x1b6f9fbf,0x1b0f9fc1,0x180fa041,0x70603e,0x3705fbe,0xb109fc0,0x910a040,0x1302042,0x3301fc2,0x1b2fdfc2,0x192fe042,0x192fa0c0,0x97020be,0x970a03f,0xb709fbf,0xb109fc1,0x910a041,0x9306042,0xb305fc2,0x190fa0bf,0x196fe0be,
+	17,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0x102041,0x101fc1,0x106040,0x105fc0,0xfe03f,0xfdfbf,0xfe041,0xfdfc1,0x10603f,0x105fbf,0x106041,0x105fc1,0x11020c0,0x10fe0c0,0x11020bf,0x11020c1,0x11060c0,0x10fe0bf,0x3101f40,0x30fdf40,0x10fe0c1,0x11060bf,0x11060c1,0x3101f3f,0x3101f41,0x3105f40,0x30fdf3f,0x30fdf41,0x3105f3f,0x3105f41,0x1b0f9fc0,0x180fa040,0x180fa03f,0x1b0f9fbf,0x3701fbe,0x70203e,0x186fe03e,0x1b6fdfbe,0x1b0f9fc1,0x180fa041,0x1302042,0x3301fc2,0x1b2fdfc2,0x192fe042,0x910a040,0xb109fc0,0x3705fbe,0x70603e,0x970a03f,0xb709fbf,0x3305fc2,0x1306042,0x930a041,0xb309fc1,0x192fa0c0,0x190fa0bf,0x97020be,0x196fe0be,
+	11,0x10203f,0x101fbf,0x101fc0,0xfe040,0xfe03f,0xfdfbf,0xfdfc0,0x106040,0x10603f,0x105fbf,0x105fc0,0x11020c0,0x11020bf,0x10fe0bf,0x10fe0c0,0x302041,0x301fc1,0x2fe041,0x11060c0,0x11060bf,0x70203e,0x701fbe,0x2fdfc1,0x6fe03e,0x6fdfbe,0x3101f3f,0x3101f40,0x305fc1,0x306041,0x70603e,0x705fbe,0x30fdf3f,0x30fdf40,0x3105f40,0x3105f3f,0x13020c1,0x12fe0c1,0x17020be,0x16fe0be,0x180fa03f,0x180fa040,0x180f9fc0,0x180f9fbf,0x93060c1,0x97060be,0x3301f41,0x32fdf41,0x3701f3e,0x36fdf3e,0xb709fbf,0x970a03f,0x930a040,0xb309fc0,0xb305f41,0xb705f3e,0x190fa0bf,0x190fa0c0,0x192fa041,0x182f9fc1,0x196fa03e,0x186f9fbe,0x1b6f9f3f,0x1b2f9f40,
+	11,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0xfdfbf,0x106040,0x10603f,0x105fbf,0x105fc0,0x11020c0,0x11020bf,0x302041,0x301fc1,0x10fe0c0,0x10fe0bf,0x2fe041,0x2fdfc1,0x11060c0,0x11060bf,0x306041,0x305fc1,0x70203e,0x701fbe,0x3101f3f,0x3101f40,0x6fdfbe,0x6fe03e,0x30fdf3f,0x30fdf40,0x13020c1,0x70603e,0x705fbe,0x3105f3f,0x3105f40,0x12fe0c1,0x93060c1,0x17020be,0x180fa03f,0x180fa040,0x180f9fc0,0x180f9fbf,0x16fe0be,0x97060be,0x3301f41,0x32fdf41,0xb305f41,0xb309fc0,0x930a040,0x970a03f,0xb709fbf,0x3701f3e,0x36fdf3e,0x190fa0bf,0x190fa0c0,0x192fa041,0x182f9fc1,0xb705f3e,0x186f9fbe,0x196fa03e,0x1b6f9f3f,0x1b2f9f40,
+	11,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0xfdfbf,0x106040,0x10603f,0x105fc0,0x105fbf,0x302041,0x11020c0,0x11020bf,0x301fc1,0x2fe041,0x10fe0c0,0x10fe0bf,0x2fdfc1,0x306041,0x11060c0,0x11060bf,0x305fc1,0x3101f40,0x3101f3f,0x701fbe,0x70203e,0x6fe03e,0x6fdfbe,0x30fdf3f,0x30fdf40,0x13020c1,0x12fe0c1,0x13060c1,0x70603e,0x705fbe,0x3105f3f,0x3105f40,0x3301f41,0x1b0f9fc0,0x180fa040,0x186fa03f,0x1b6f9fbf,0x17020be,0x16fe0be,0x32fdf41,0x3305f41,0x17060be,0x870a03f,0x810a040,0xb109fc0,0xb709fbf,0x3701f3e,0x1b6fdf3e,0x196fa0bf,0x190fa0c0,0x192fa041,0x1b2f9fc1,0xb705f3e,0x970a0bf,0x910a0c0,0x930a041,0xb309fc1,
+	13,0x101fc0,0x10203f,0x101fbf,0xfe040,0xfdfc0,0xfe03f,0xfdfbf,0x106040,0x105fc0,0x10603f,0x105fbf,0x102041,0x101fc1,0x11020c0,0x11020bf,0xfe041,0xfdfc1,0x10fe0c0,0x10fe0bf,0x106041,0x105fc1,0x11060c0,0x11060bf,0x11020c1,0x3101f40,0x3101f3f,0x30fdf40,0x30fdf3f,0x701fbe,0x70203e,0x12fe0c1,0x13060c1,0x6fe03e,0x6fdfbe,0x3105f40,0x3105f3f,0x705fbe,0x70603e,0x3101f41,0x1b0f9fc0,0x180fa040,0x186fa03f,0x1b6f9fbf,0x32fdf41,0x3305f41,0x17020be,0x16fe0be,0x97060be,0x910a040,0xb109fc0,0xb709fbf,0x970a03f,0x182fa041,0x1b2f9fc1,0x192fa0c0,0x196fa0bf,0x3701f3e,0x1b6fdf3e,0xb705f3e,0xb309fc1,0x930a041,0x11302042,0x13301fc2,
+	15,0x101fc0,0x10203f,0x101fbf,0xfe040,0xfdfc0,0xfe03f,0xfdfbf,0x106040,0x105fc0,0x10603f,0x105fbf,0x102041,0x101fc1,0xfe041,0xfdfc1,0x11020c0,0x11020bf,0x10fe0c0,0x106041,0x105fc1,0x10fe0bf,0x11060c0,0x11060bf,0x11020c1,0x10fe0c1,0x3101f40,0x3101f3f,0x30fdf40,0x30fdf3f,0x701fbe,0x70203e,0x13060c1,0x3105f40,0x3105f3f,0x6fdfbe,0x6fe03e,0x3101f41,0x30fdf41,0x1b0f9fc0,0x180fa040,0x186fa03f,0x1b6f9fbf,0x70603e,0x705fbe,0x3305f41,0x17020be,0x16fe0be,0x180fa041,0x1b0f9fc1,0x910a040,0xb109fc0,0xb709fbf,0x970a03f,0x97060be,0x192fa0c0,0x196fa0bf,0x9302042,0xb301fc2,0x1b2fdfc2,0x192fe042,0x930a041,0xb309fc1,0x13701f3e,
+	15,0x101fc0,0x10203f,0x101fbf,0xfe040,0xfdfc0,0xfe03f,0xfdfbf,0x106040,0x105fc0,0x102041,0x101fc1,0x10603f,0x105fbf,0xfe041,0xfdfc1,0x11020c0,0x106041,0x105fc1,0x11020bf,0x10fe0c0,0x10fe0bf,0x11060c0,0x11020c1,0x11060bf,0x10fe0c1,0x3101f40,0x3101f3f,0x30fdf40,0x30fdf3f,0x11060c1,0x3105f40,0x3101f41,0x3105f3f,0x3701fbe,0x70203e,0x6fe03e,0x36fdfbe,0x30fdf41,0x1b0f9fc0,0x180fa040,0x186fa03f,0x1b6f9fbf,0x3305f41,0x3705fbe,0x70603e,0x17020be,0x180fa041,0x1b0f9fc1,0x910a040,0xb109fc0,0xb709fbf,0x970a03f,0x16fe0be,0x192fa0c0,0x196fa0bf,0x1302042,0x3301fc2,0x1b2fdfc2,0x192fe042,0x97060be,0x910a041,0xb309fc1,0xa306042,
+	17,0x101fc0,0x10203f,0xfe040,0xfdfc0,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x106040,0x105fc0,0x101fc1,0xfe041,0xfdfc1,0x10603f,0x105fbf,0x106041,0x105fc1,0x11020c0,0x11020bf,0x10fe0c0,0x10fe0bf,0x11020c1,0x11060c0,0x11060bf,0x10fe0c1,0x3101f40,0x30fdf40,0x3101f3f,0x11060c1,0x3105f40,0x3101f41,0x30fdf3f,0x30fdf41,0x3105f3f,0x3701fbe,0x70203e,0x180fa040,0x1b0f9fc0,0x180fa03f,0x186fe03e,0x36fdfbe,0x1b6f9fbf,0x3105f41,0x1b0f9fc1,0x180fa041,0x70603e,0x3705fbe,0x910a040,0xb109fc0,0x1302042,0x3301fc2,0x1b2fdfc2,0x192fe042,0x192fa0c0,0x97020be,0x970a03f,0xb709fbf,0x910a041,0xb109fc1,0x9306042,0xb305fc2,0x190fa0bf,0x196fe0be,
+	17,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0x102041,0x101fc1,0x106040,0x105fc0,0xfe03f,0xfdfbf,0xfe041,0xfdfc1,0x10603f,0x105fbf,0x106041,0x105fc1,0x11020c0,0x10fe0c0,0x11020bf,0x11020c1,0x11060c0,0x10fe0bf,0x10fe0c1,0x11060bf,0x11060c1,0x3101f40,0x30fdf40,0x3101f3f,0x3101f41,0x3105f40,0x30fdf3f,0x30fdf41,0x3105f3f,0x3105f41,0x180fa040,0x1b0f9fc0,0x1b0f9fbf,0x180fa03f,0x70203e,0x3701fbe,0x1b6fdfbe,0x186fe03e,0x180fa041,0x1b0f9fc1,0x1302042,0x3301fc2,0x1b2fdfc2,0x192fe042,0x910a040,0xb109fc0,0x70603e,0x3705fbe,0x970a03f,0xb709fbf,0x1306042,0x3305fc2,0x930a041,0xb309fc1,0x192fa0c0,0x190fa0bf,0x97020be,0x196fe0be,
+	13,0x10203f,0x101fbf,0x101fc0,0xfe040,0xfe03f,0xfdfbf,0xfdfc0,0x106040,0x10603f,0x105fbf,0x105fc0,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x302041,0x301fc1,0x1060c0,0x1060bf,0x70203e,0x701fbe,0x2fe041,0x2fdfc1,0x6fe03e,0x6fdfbe,0x306041,0x305fc1,0x70603e,0x705fbe,0x3101f3f,0x3101f40,0x30fdf40,0x30fdf3f,0x3020c1,0x12fe0c1,0x7020be,0x16fe0be,0x3105f3f,0x3105f40,0x93060c1,0x180fa040,0x180fa03f,0x1b0f9fbf,0x1b0f9fc0,0x97060be,0x970a03f,0x930a040,0x3301f41,0x32fdf41,0x3701f3e,0xb709fbf,0xb309fc0,0x190fa0c0,0x190fa0bf,0x36fdf3e,0xb305f41,0xb705f3e,0x192fa041,0x1b2f9fc1,0x196fa03e,0x1b6f9fbe,0x1170213f,0x11302140,
+	13,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0xfdfbf,0x106040,0x10603f,0x105fbf,0x105fc0,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x302041,0x301fc1,0x2fe041,0x1060c0,0x1060bf,0x2fdfc1,0x306041,0x305fc1,0x70203e,0x701fbe,0x6fe03e,0x6fdfbe,0x3101f3f,0x3101f40,0x3020c1,0x12fe0c1,0x70603e,0x705fbe,0x30fdf3f,0x30fdf40,0x3105f40,0x3105f3f,0x13060c1,0x7020be,0x16fe0be,0x186fa03f,0x180fa040,0x1b0f9fc0,0x1b6f9fbf,0x17060be,0x3301f41,0x32fdf41,0x830a040,0x870a03f,0xb709fbf,0xb309fc0,0xb305f41,0x190fa0c0,0x196fa0bf,0x3701f3e,0x1b6fdf3e,0x192fa041,0x1b2f9fc1,0xb705f3e,0x970a0bf,0x930a0c0,0x11302140,0x1170213f,
+	13,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0xfdfbf,0x106040,0x10603f,0x105fc0,0x105fbf,0x1020c0,0x1020bf,0x302041,0x301fc1,0xfe0c0,0xfe0bf,0x2fe041,0x2fdfc1,0x1060c0,0x1060bf,0x306041,0x305fc1,0x3020c1,0x70203e,0x701fbe,0x6fe03e,0x6fdfbe,0x3101f3f,0x3101f40,0x12fe0c1,0x13060c1,0x30fdf40,0x30fdf3f,0x70603e,0x705fbe,0x3105f3f,0x3105f40,0x7020be,0x186fa03f,0x180fa040,0x1b0f9fc0,0x1b6f9fbf,0x16fe0be,0x17060be,0x3301f41,0x32fdf41,0xb305f41,0x830a040,0x870a03f,0xb709fbf,0xb309fc0,0x190fa0c0,0x196fa0bf,0x192fa041,0x1b2f9fc1,0x3701f3e,0x1b6fdf3e,0xb705f3e,0x970a0bf,0x930a0c0,0x11302140,0x1170213f,
+	11,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0xfdfbf,0x106040,0x10603f,0x105fc0,0x105fbf,0x302041,0x1020c0,0x1020bf,0x301fc1,0x2fe041,0xfe0c0,0x10fe0bf,0x2fdfc1,0x306041,0x1060c0,0x11060bf,0x305fc1,0x3020c1,0x12fe0c1,0x70203e,0x701fbe,0x3101f40,0x3101f3f,0x30fdf40,0x30fdf3f,0x6fe03e,0x6fdfbe,0x13060c1,0x70603e,0x705fbe,0x3105f40,0x3105f3f,0x180fa040,0x186fa03f,0x1b0f9fc0,0x1b6f9fbf,0x17020be,0x16fe0be,0x3301f41,0x32fdf41,0xb305f41,0x810a040,0x17060be,0x870a03f,0xb109fc0,0xb709fbf,0x182fa041,0x192fa0c0,0x196fa0bf,0x1b2f9fc1,0x3701f3e,0x1b6fdf3e,0xb705f3e,0xb30a041,0x930a0c0,0x970a0bf,0x11502140,
+	13,0x101fc0,0x10203f,0x101fbf,0xfe040,0xfdfc0,0xfe03f,0xfdfbf,0x106040,0x105fc0,0x10603f,0x105fbf,0x102041,0x101fc1,0x11020c0,0x11020bf,0xfe041,0xfdfc1,0x10fe0c0,0x10fe0bf,0x106041,0x105fc1,0x11060c0,0x11060bf,0x11020c1,0x10fe0c1,0x13060c1,0x3101f40,0x3101f3f,0x30fdf40,0x30fdf3f,0x70203e,0x3701fbe,0x6fe03e,0x36fdfbe,0x3105f40,0x3105f3f,0x70603e,0x3705fbe,0x180fa040,0x1b0f9fc0,0x186fa03f,0x1b6f9fbf,0x3101f41,0x30fdf41,0x3305f41,0x17020be,0x16fe0be,0x180fa041,0x1b0f9fc1,0x190fa0c0,0x196fa0bf,0x97060be,0x910a040,0xb109fc0,0x970a03f,0xb709fbf,0x930a041,0x9302042,0xb301fc2,0x192fe042,0x192fa0c1,0x1b2fdfc2,0xb309fc1,
+	13,0x101fc0,0x10203f,0x101fbf,0xfe040,0xfdfc0,0xfe03f,0xfdfbf,0x106040,0x105fc0,0x102041,0x101fc1,0x10603f,0x105fbf,0x11020c0,0xfe041,0xfdfc1,0x11020bf,0x10fe0c0,0x106041,0x105fc1,0x10fe0bf,0x11060c0,0x11020c1,0x11060bf,0x10fe0c1,0x13060c1,0x3101f40,0x3101f3f,0x30fdf40,0x30fdf3f,0x70203e,0x3701fbe,0x3105f40,0x3101f41,0x3105f3f,0x6fe03e,0x36fdfbe,0x180fa040,0x1b0f9fc0,0x186fa03f,0x1b6f9fbf,0x30fdf41,0x3305f41,0x70603e,0x3705fbe,0x17020be,0x16fe0be,0x180fa041,0x1b0f9fc1,0x190fa0c0,0x196fa0bf,0x910a040,0xb109fc0,0x970a03f,0xb709fbf,0x97060be,0x9302042,0xb301fc2,0x192fe042,0x1b2fdfc2,0x192fa0c1,0x930a041,0xb309fc1,
+	15,0x101fc0,0x10203f,0xfe040,0xfdfc0,0x101fbf,0xfe03f,0xfdfbf,0x102041,0x106040,0x105fc0,0x101fc1,0xfe041,0xfdfc1,0x10603f,0x105fbf,0x11020c0,0x106041,0x105fc1,0x11020bf,0x10fe0c0,0x10fe0bf,0x11020c1,0x11060c0,0x11060bf,0x10fe0c1,0x11060c1,0x3101f40,0x30fdf40,0x3101f3f,0x30fdf3f,0x3105f40,0x3101f41,0x30fdf41,0x180fa040,0x1b0f9fc0,0x70203e,0x3701fbe,0x3105f3f,0x3105f41,0x6fe03e,0x186fa03f,0x1b0f9fbf,0x1b6fdfbe,0x70603e,0x3705fbe,0x180fa041,0x1b0f9fc1,0x1302042,0x3301fc2,0x910a040,0xb109fc0,0x970a03f,0x97020be,0x192fa0c0,0x190fa0bf,0x196fe0be,0x192fe042,0x1b2fdfc2,0xb709fbf,0x910a041,0x9306042,0x3305fc2,0xb309fc1,
+	15,0x101fc0,0xfe040,0xfdfc0,0x10203f,0x101fbf,0x102041,0x101fc1,0x106040,0x105fc0,0xfe03f,0xfdfbf,0xfe041,0xfdfc1,0x10603f,0x105fbf,0x11020c0,0x106041,0x105fc1,0x10fe0c0,0x11020bf,0x11020c1,0x11060c0,0x10fe0bf,0x10fe0c1,0x11060bf,0x11060c1,0x3101f40,0x30fdf40,0x3101f3f,0x3101f41,0x3105f40,0x30fdf3f,0x30fdf41,0x180fa040,0x1b0f9fc0,0x3105f3f,0x3105f41,0x70203e,0x3701fbe,0x180fa03f,0x1b0f9fbf,0x180fa041,0x1b0f9fc1,0x302042,0x3301fc2,0x186fe03e,0x1b6fdfbe,0x70603e,0x3705fbe,0x910a040,0xb109fc0,0x182fe042,0x1b2fdfc2,0x192fa0c0,0x196fa0bf,0x117020be,0x970a03f,0xb709fbf,0x306042,0x3305fc2,0x930a041,0xb309fc1,0x113020c2,
+	15,0x10203f,0x101fbf,0x101fc0,0xfe040,0xfe03f,0xfdfbf,0xfdfc0,0x106040,0x10603f,0x105fbf,0x105fc0,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x1060c0,0x1060bf,0x302041,0x301fc1,0x2fe041,0x70203e,0x701fbe,0x6fe03e,0x2fdfc1,0x306041,0x305fc1,0x6fdfbe,0x70603e,0x705fbe,0x3020c1,0x2fe0c1,0x7020be,0x6fe0be,0x3101f3f,0x3101f40,0x30fdf40,0x30fdf3f,0x93060c1,0x97060be,0x180fa03f,0x180fa040,0x1b0f9fc0,0x1b0f9fbf,0x3105f3f,0x3105f40,0x3301f41,0x930a040,0x970a03f,0xb709fbf,0xb309fc0,0x180fa0c0,0x180fa0bf,0xb701f3e,0x1b6fdf3e,0x32fdf41,0x192fa041,0x1b2f9fc1,0xb305f41,0x9302140,0x970213f,0x196fe13f,0x192fe140,0x1a6fa03e,
+	15,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0xfdfbf,0x106040,0x10603f,0x105fbf,0x105fc0,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x302041,0x1060c0,0x1060bf,0x301fc1,0x2fe041,0x2fdfc1,0x306041,0x305fc1,0x70203e,0x701fbe,0x6fe03e,0x6fdfbe,0x3020c1,0x2fe0c1,0x70603e,0x705fbe,0x3101f3f,0x3101f40,0x30fdf40,0x30fdf3f,0x7020be,0x93060c1,0x6fe0be,0x186fa03f,0x180fa040,0x1b0f9fc0,0x1b6f9fbf,0x3105f40,0x3105f3f,0x17060be,0x870a03f,0x930a040,0x3301f41,0x32fdf41,0x180fa0c0,0x186fa0bf,0xb309fc0,0xb709fbf,0xb305f41,0x192fa041,0x1b2f9fc1,0xb701f3e,0x1b6fdf3e,0x970213f,0x9302140,0x192fe140,0x196fe13f,0x970a0bf,
+	15,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0xfdfbf,0x106040,0x10603f,0x105fc0,0x105fbf,0x1020c0,0x1020bf,0xfe0c0,0xfe0bf,0x302041,0x301fc1,0x2fe041,0x1060c0,0x1060bf,0x2fdfc1,0x306041,0x305fc1,0x3020c1,0x2fe0c1,0x70203e,0x701fbe,0x6fe03e,0x6fdfbe,0x3101f3f,0x3101f40,0x13060c1,0x70603e,0x705fbe,0x30fdf3f,0x30fdf40,0x7020be,0x6fe0be,0x186fa03f,0x180fa040,0x1b0f9fc0,0x1b6f9fbf,0x3105f40,0x3105f3f,0x17060be,0x3301f41,0x32fdf41,0x180fa0c0,0x186fa0bf,0x830a040,0x870a03f,0xb709fbf,0xb309fc0,0xb305f41,0x192fa041,0x1b2f9fc1,0x9302140,0x970213f,0x196fe13f,0x192fe140,0x930a0c0,0x970a0bf,0x13701f3e,
+	13,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0xfdfbf,0x106040,0x10603f,0x105fc0,0x105fbf,0x1020c0,0x1020bf,0x302041,0x301fc1,0xfe0c0,0xfe0bf,0x2fe041,0x2fdfc1,0x1060c0,0x1060bf,0x306041,0x305fc1,0x3020c1,0x2fe0c1,0x13060c1,0x70203e,0x701fbe,0x6fe03e,0x6fdfbe,0x3101f40,0x3701f3f,0x30fdf40,0x36fdf3f,0x70603e,0x705fbe,0x3105f40,0x3705f3f,0x180fa040,0x186fa03f,0x1b0f9fc0,0x1b6f9fbf,0x7020be,0x6fe0be,0x17060be,0x3301f41,0x32fdf41,0x180fa0c0,0x186fa0bf,0x182fa041,0x1b2f9fc1,0xb305f41,0x830a040,0x870a03f,0xb309fc0,0xb709fbf,0x930a0c0,0x9302140,0x970213f,0x192fe140,0x192fa0c1,0x196fe13f,0x970a0bf,
+	17,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0xfdfbf,0x106040,0x10603f,0x105fc0,0x105fbf,0x102041,0x1020c0,0x1020bf,0x101fc1,0xfe041,0xfe0c0,0xfe0bf,0xfdfc1,0x106041,0x1060c0,0x1060bf,0x105fc1,0x1020c1,0xfe0c1,0x93060c1,0x70203e,0x701fbe,0x3101f40,0x3701f3f,0x30fdf40,0x30fdf3f,0x6fe03e,0x36fdfbe,0x180fa040,0x186fa03f,0x1b0f9fc0,0x3105f40,0x3105f3f,0x70603e,0x3705fbe,0x7020be,0x1b6f9fbf,0x3101f41,0x32fdf41,0x16fe0be,0x180fa0c0,0x180fa041,0x1b2f9fc1,0xb305f41,0x930a040,0x97060be,0x970a03f,0xb309fc0,0xb709fbf,0x196fa0bf,0x9302140,0x970213f,0x9302042,0xb301fc2,0x1a2fe042,0x192fa0c1,0x194fe140,
+	15,0x101fc0,0x10203f,0xfe040,0x101fbf,0xfdfc0,0xfe03f,0xfdfbf,0x106040,0x105fc0,0x102041,0x10603f,0x1020c0,0x101fc1,0x105fbf,0xfe041,0xfdfc1,0x1020bf,0xfe0c0,0xfe0bf,0x106041,0x105fc1,0x1060c0,0x1020c1,0x1060bf,0x10fe0c1,0x13060c1,0x3101f40,0x3101f3f,0x30fdf40,0x70203e,0x3701fbe,0x30fdf3f,0x6fe03e,0x180fa040,0x1b0f9fc0,0x3105f40,0x3101f41,0x36fdfbe,0x186fa03f,0x1b6f9fbf,0x3105f3f,0x70603e,0x3705fbe,0x7020be,0x32fdf41,0x180fa041,0x1b2f9fc1,0xb305f41,0x910a040,0xb109fc0,0x970a03f,0x16fe0be,0x190fa0c0,0x196fa0bf,0x97060be,0xb709fbf,0x9302042,0xb301fc2,0x1a2fe042,0x192fa0c1,0x11302140,0x1170213f,0xa30a041,
+	12,0x101fc0,0x10203f,0xfe040,0xfdfc0,0x101fbf,0xfe03f,0x102041,0x106040,0x105fc0,0xfdfbf,0x101fc1,0xfe041,0x11020c0,0x10603f,0x105fbf,0xfdfc1,0x10fe0c0,0x11020bf,0x106041,0x105fc1,0x11020c1,0x11060c0,0x10fe0bf,0x10fe0c1,0x11060bf,0x11060c1,0x3101f40,0x30fdf40,0x3101f3f,0x30fdf3f,0x70203e,0x3701fbe,0x3105f40,0x3101f41,0x180fa040,0x1b0f9fc0,0x180fa03f,0x186fe03e,0x36fdfbe,0x3105f3f,0x30fdf41,0x1b6f9fbf,0x180fa041,0x1b0f9fc1,0xb105f41,0x70603e,0x3705fbe,0x17020be,0x192fa0c0,0x190fa0bf,0x196fe0be,0x910a040,0xb109fc0,0x1302042,0x3301fc2,0x192fe042,0x1b2fdfc2,0x970a03f,0xb709fbf,0x97060be,0xa10a041,0x9306042,0xb305fc2,
+	13,0x101fc0,0xfe040,0x10203f,0xfdfc0,0x102041,0x101fbf,0x106040,0x101fc1,0xfe03f,0xfdfbf,0x105fc0,0xfe041,0xfdfc1,0x11020c0,0x10603f,0x105fbf,0x106041,0x105fc1,0x10fe0c0,0x11020bf,0x11020c1,0x11060c0,0x10fe0bf,0x10fe0c1,0x11060bf,0x11060c1,0x3101f40,0x30fdf40,0x3101f3f,0x3101f41,0x3105f40,0x30fdf3f,0x180fa040,0x1b0f9fc0,0x30fdf41,0x180fa03f,0x70203e,0x3701fbe,0xb105f3f,0xb105f41,0x180fa041,0x1b0f9fc1,0x1b0f9fbf,0x186fe03e,0x1b6fdfbe,0x302042,0x3301fc2,0x182fe042,0x190fa0c0,0x70603e,0xb705fbe,0x910a040,0xb109fc0,0x1b2fdfc2,0x306042,0xb305fc2,0xa30a041,0xa70a03f,0x117020be,0x196fa0bf,0x190fa0c1,0x93020c2,0x192fe0c2,
+	15,0x10203f,0x101fbf,0x101fc0,0xfe040,0xfe03f,0xfdfbf,0xfdfc0,0x106040,0x10603f,0x1020bf,0x1020c0,0x105fc0,0x105fbf,0xfe0bf,0xfe0c0,0x1060c0,0x1060bf,0x302041,0x301fc1,0x2fe041,0x70203e,0x701fbe,0x6fe03e,0x2fdfc1,0x306041,0x3020c1,0x305fc1,0x6fdfbe,0x70603e,0x7020be,0x705fbe,0x2fe0c1,0x6fe0be,0x93060c1,0x3101f40,0x3101f3f,0x30fdf3f,0x30fdf40,0x97060be,0x180fa03f,0x180fa040,0x1b0f9fc0,0x1b0f9fbf,0x3105f3f,0x3105f40,0x180fa0c0,0x180fa0bf,0x970a03f,0x930a040,0xb309fc0,0xb709fbf,0xb301f41,0x32fdf41,0x9302140,0x970213f,0x196fe13f,0x192fe140,0x192fa041,0x1b2f9fc1,0xb701f3e,0x36fdf3e,0x196fa03e,0x1b6f9fbe,
+	15,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfbf,0xfdfc0,0x106040,0x10603f,0x1020c0,0x1020bf,0x105fc0,0x105fbf,0xfe0c0,0xfe0bf,0x1060c0,0x1060bf,0x302041,0x301fc1,0x2fe041,0x2fdfc1,0x306041,0x3020c1,0x70203e,0x701fbe,0x6fe03e,0x305fc1,0x2fe0c1,0x6fdfbe,0x70603e,0x7020be,0x13060c1,0x705fbe,0x3701f3f,0x3101f40,0x6fe0be,0x186fa03f,0x180fa040,0x30fdf40,0x36fdf3f,0x1b6f9fbf,0x1b0f9fc0,0x7060be,0x3705f3f,0x3105f40,0x180fa0c0,0x186fa0bf,0x830a040,0x870a03f,0xb709fbf,0xb309fc0,0x3301f41,0x32fdf41,0x192fa041,0x9302140,0x170213f,0x196fe13f,0x192fe140,0x1b2f9fc1,0xb305f41,0x930a0c0,0x870a0bf,0x970613f,
+	15,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0xfdfbf,0x106040,0x10603f,0x1020c0,0x1020bf,0x105fc0,0x105fbf,0xfe0c0,0xfe0bf,0x302041,0x1060c0,0x1060bf,0x301fc1,0x2fe041,0x2fdfc1,0x306041,0x3020c1,0x305fc1,0x2fe0c1,0x70203e,0x701fbe,0x6fe03e,0x6fdfbe,0x3060c1,0x70603e,0x7020be,0x705fbe,0x3701f3f,0x3101f40,0x30fdf40,0x36fdf3f,0x6fe0be,0x186fa03f,0x180fa040,0x1b0f9fc0,0x1b6f9fbf,0x17060be,0x3705f3f,0x3105f40,0x3301f41,0x180fa0c0,0x186fa0bf,0x830a040,0x870a03f,0xb709fbf,0xb309fc0,0x32fdf41,0x192fa041,0x1b2f9fc1,0x1302140,0x170213f,0x196fe13f,0x192fe140,0xb305f41,0x830a0c0,0x970a0bf,0x9506140,
+	13,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0xfdfbf,0x106040,0x10603f,0x1020c0,0x1020bf,0x105fc0,0x105fbf,0x302041,0xfe0c0,0xfe0bf,0x301fc1,0x2fe041,0x1060c0,0x1060bf,0x2fdfc1,0x306041,0x3020c1,0x305fc1,0x2fe0c1,0x13060c1,0x70203e,0x701fbe,0x6fe03e,0x6fdfbe,0x3101f40,0x3701f3f,0x70603e,0x7020be,0x705fbe,0x30fdf40,0x36fdf3f,0x180fa040,0x186fa03f,0x1b0f9fc0,0x1b6f9fbf,0x6fe0be,0x17060be,0x3105f40,0x3705f3f,0x3301f41,0x32fdf41,0x180fa0c0,0x186fa0bf,0x182fa041,0x1b2f9fc1,0x830a040,0x870a03f,0xb309fc0,0xb709fbf,0xb305f41,0x9302140,0x970213f,0x192fe140,0x196fe13f,0x192fa0c1,0x930a0c0,0x970a0bf,
+	15,0x10203f,0x101fc0,0xfe040,0x101fbf,0xfe03f,0xfdfc0,0xfdfbf,0x106040,0x10603f,0x1020c0,0x105fc0,0x102041,0x1020bf,0x105fbf,0xfe0c0,0xfe0bf,0x101fc1,0xfe041,0xfdfc1,0x1060c0,0x1060bf,0x106041,0x1020c1,0x105fc1,0x2fe0c1,0x13060c1,0x70203e,0x701fbe,0x6fe03e,0x3101f40,0x3701f3f,0x6fdfbe,0x30fdf40,0x180fa040,0x186fa03f,0x70603e,0x7020be,0x36fdf3f,0x1b0f9fc0,0x1b6f9fbf,0x705fbe,0x3105f40,0x3705f3f,0x3101f41,0x16fe0be,0x180fa0c0,0x196fa0bf,0x97060be,0x830a040,0x870a03f,0xb309fc0,0x32fdf41,0x182fa041,0x1b2f9fc1,0xb305f41,0xb709fbf,0x9302140,0x970213f,0x194fe140,0x192fa0c1,0x11302042,0x13301fc2,0x950a0c0,
+	17,0x10203f,0x101fc0,0xfe040,0x101fbf,0xfe03f,0xfdfc0,0x106040,0xfdfbf,0x102041,0x1020c0,0x10603f,0x105fc0,0x101fc1,0x1020bf,0xfe0c0,0xfe041,0x105fbf,0xfe0bf,0xfdfc1,0x106041,0x1060c0,0x1020c1,0x1060bf,0x105fc1,0xfe0c1,0x93060c1,0x70203e,0x3101f40,0x3101f3f,0x3701fbe,0x6fe03e,0x180fa040,0x30fdf40,0x30fdf3f,0x36fdfbe,0x186fa03f,0x1b0f9fc0,0x1b6f9fbf,0x70603e,0x7020be,0x3105f40,0x3101f41,0x3105f3f,0x3705fbe,0x16fe0be,0x180fa0c0,0x180fa041,0x32fdf41,0x1b2f9fc1,0x196fa0bf,0x97060be,0x930a040,0x970a03f,0xb309fc0,0xb305f41,0x9302042,0xb301fc2,0x9302140,0x970213f,0x194fe140,0x192fa0c1,0x1a2fe042,0xb709fbf,
+	14,0x101fc0,0x10203f,0xfe040,0xfdfc0,0x101fbf,0xfe03f,0x102041,0x106040,0x1020c0,0xfdfbf,0x101fc1,0x105fc0,0x10603f,0xfe041,0xfe0c0,0x1020bf,0x105fbf,0xfdfc1,0x106041,0x1020c1,0x1060c0,0x10fe0bf,0x105fc1,0x11060bf,0x10fe0c1,0x91060c1,0x3101f40,0x30fdf40,0x3101f3f,0x70203e,0x180fa040,0x1b0f9fc0,0x180fa03f,0x186fe03e,0x3701fbe,0x30fdf3f,0x3101f41,0x3105f40,0x3105f3f,0x36fdfbe,0x1b6f9fbf,0x180fa041,0x30fdf41,0x1b0f9fc1,0x190fa0c0,0x70603e,0x17020be,0x3705fbe,0x930a040,0xb305f41,0x1302042,0x3301fc2,0x192fe042,0x190fa0bf,0x196fe0be,0x97060be,0x970a03f,0xb309fc0,0xb709fbf,0x11502140,0x192fa0c1,0x1b2fdfc2,0xa306042,
+	15,0x101fc0,0xfe040,0x10203f,0xfdfc0,0x102041,0x106040,0x101fbf,0xfe03f,0x101fc1,0xfe041,0x1020c0,0x105fc0,0xfdfbf,0xfdfc1,0x10603f,0xfe0c0,0x1020bf,0x106041,0x1020c1,0x105fbf,0x105fc1,0x1060c0,0x10fe0bf,0x10fe0c1,0x11060bf,0x11060c1,0x3101f40,0x30fdf40,0x180fa040,0x1b0f9fc0,0x3101f3f,0x3101f41,0x3105f40,0x30fdf3f,0x70203e,0x180fa03f,0x1b0f9fbf,0x180fa041,0x30fdf41,0x1b0f9fc1,0x302042,0x3301fc2,0x3701fbe,0x186fe03e,0x1b6fdfbe,0xb105f3f,0xb105f41,0x190fa0c0,0x182fe042,0x1b2fdfc2,0x910a040,0x70603e,0x117020be,0xb705fbe,0xb109fc0,0xa70a03f,0x196fa0bf,0x192fa0c1,0x11502140,0x306042,0x113020c2,0xb305fc2,0xa30a041,
+	17,0x10203f,0x101fbf,0x101fc0,0xfe040,0xfe03f,0xfdfbf,0xfdfc0,0x1020c0,0x1020bf,0x10603f,0x106040,0x105fc0,0x105fbf,0xfe0bf,0xfe0c0,0x1060c0,0x1060bf,0x302041,0x301fc1,0x2fe041,0x70203e,0x701fbe,0x6fe03e,0x2fdfc1,0x3020c1,0x306041,0x305fc1,0x6fdfbe,0x7020be,0x70603e,0x705fbe,0x2fe0c1,0x6fe0be,0x3060c1,0x7060be,0x3701f3f,0x3101f40,0x180fa040,0x186fa03f,0x186f9fbf,0x180f9fc0,0x1b0fdf40,0x1b6fdf3f,0x3705f3f,0x3105f40,0x180fa0c0,0x186fa0bf,0x170213f,0x1302140,0x830a040,0x870a03f,0xb709fbf,0xb309fc0,0x192fe140,0x196fe13f,0x170613f,0x1306140,0x930a0c0,0x970a0bf,0xb301f41,0x192fa041,0x182f9fc1,0x1b2fdf41,
+	17,0x10203f,0x101fc0,0xfe040,0xfe03f,0x101fbf,0xfdfbf,0xfdfc0,0x1020c0,0x1020bf,0x106040,0x10603f,0x105fbf,0x105fc0,0xfe0c0,0xfe0bf,0x1060c0,0x1060bf,0x302041,0x301fc1,0x2fe041,0x2fdfc1,0x3020c1,0x306041,0x70203e,0x6fe03e,0x701fbe,0x305fc1,0x2fe0c1,0x3060c1,0x7020be,0x70603e,0x6fdfbe,0x705fbe,0x6fe0be,0x7060be,0x186fa03f,0x180fa040,0x3101f40,0x3701f3f,0x36fdf3f,0x30fdf40,0x1b0f9fc0,0x1b6f9fbf,0x186fa0bf,0x180fa0c0,0x3105f40,0x3705f3f,0x870a03f,0x830a040,0x1302140,0x170213f,0x196fe13f,0x192fe140,0x192fa041,0xb301f41,0xb309fc0,0xb709fbf,0x870a0bf,0x830a0c0,0x9306140,0x970613f,0x182f9fc1,0x1b2fdf41,
+	17,0x10203f,0x101fc0,0xfe040,0xfe03f,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x106040,0x10603f,0x1020bf,0xfe0c0,0xfe0bf,0x105fc0,0x105fbf,0x1060c0,0x1060bf,0x302041,0x301fc1,0x2fe041,0x2fdfc1,0x3020c1,0x306041,0x305fc1,0x2fe0c1,0x70203e,0x6fe03e,0x701fbe,0x3060c1,0x70603e,0x7020be,0x6fdfbe,0x6fe0be,0x705fbe,0x3701f3f,0x3101f40,0x180fa040,0x186fa03f,0x180f9fc0,0x1b0fdf40,0x36fdf3f,0x1b6f9fbf,0x7060be,0x186fa0bf,0x180fa0c0,0x3105f40,0x3705f3f,0x830a040,0x870a03f,0x1302140,0x170213f,0x196fe13f,0x192fe140,0x192fa041,0xb301f41,0xb309fc0,0xb709fbf,0x830a0c0,0x870a0bf,0x9306140,0x970613f,0x182f9fc1,0x1b2fdf41,
+	15,0x10203f,0x101fc0,0xfe040,0xfe03f,0x101fbf,0xfdfc0,0xfdfbf,0x1020c0,0x106040,0x10603f,0x1020bf,0xfe0c0,0xfe0bf,0x105fc0,0x105fbf,0x302041,0x1060c0,0x1060bf,0x301fc1,0x2fe041,0x2fdfc1,0x3020c1,0x306041,0x305fc1,0x2fe0c1,0x3060c1,0x70203e,0x6fe03e,0x701fbe,0x6fdfbe,0x70603e,0x7020be,0x6fe0be,0x180fa040,0x186fa03f,0x3101f40,0x3701f3f,0x705fbe,0x7060be,0x30fdf40,0x1b0f9fc0,0x186f9fbf,0x1b6fdf3f,0x3105f40,0x3705f3f,0x180fa0c0,0x186fa0bf,0x1302140,0x170213f,0x830a040,0x870a03f,0xb309fc0,0xb301f41,0x192fa041,0x182f9fc1,0x1b2fdf41,0x192fe140,0x196fe13f,0xb709fbf,0x830a0c0,0x9306140,0x170613f,0x970a0bf,
+	12,0x10203f,0x101fc0,0xfe040,0xfe03f,0x101fbf,0xfdfc0,0x1020c0,0x106040,0x10603f,0xfdfbf,0x1020bf,0xfe0c0,0x302041,0x105fc0,0x105fbf,0xfe0bf,0x2fe041,0x301fc1,0x1060c0,0x1060bf,0x3020c1,0x306041,0x2fdfc1,0x2fe0c1,0x305fc1,0x3060c1,0x70203e,0x6fe03e,0x701fbe,0x6fdfbe,0x3101f40,0x3701f3f,0x70603e,0x7020be,0x180fa040,0x186fa03f,0x180f9fc0,0x1b0fdf40,0x36fdf3f,0x705fbe,0x6fe0be,0x1b6f9fbf,0x180fa0c0,0x186fa0bf,0x87060be,0x3105f40,0x3705f3f,0x3301f41,0x192fa041,0x182f9fc1,0x1b2fdf41,0x830a040,0x870a03f,0x1302140,0x170213f,0x192fe140,0x196fe13f,0xb309fc0,0xb709fbf,0xb305f41,0x850a0c0,0x9306140,0x970613f,
+	14,0x10203f,0x101fc0,0xfe040,0xfe03f,0x101fbf,0xfdfc0,0x1020c0,0x106040,0x102041,0xfdfbf,0x1020bf,0x10603f,0x105fc0,0xfe0c0,0xfe041,0x101fc1,0x105fbf,0xfe0bf,0x1060c0,0x1020c1,0x106041,0x2fdfc1,0x1060bf,0x305fc1,0x2fe0c1,0x83060c1,0x70203e,0x6fe03e,0x701fbe,0x3101f40,0x180fa040,0x186fa03f,0x180f9fc0,0x1b0fdf40,0x3701f3f,0x6fdfbe,0x7020be,0x70603e,0x705fbe,0x36fdf3f,0x1b6f9fbf,0x180fa0c0,0x6fe0be,0x186fa0bf,0x182fa041,0x3105f40,0x3301f41,0x3705f3f,0x930a040,0x97060be,0x1302140,0x170213f,0x192fe140,0x182f9fc1,0x1b2fdf41,0xb305f41,0xb309fc0,0x970a03f,0xb709fbf,0x12302042,0x192fa0c1,0x196fe13f,0x9506140,
+	16,0x10203f,0x101fc0,0xfe040,0xfe03f,0x101fbf,0xfdfc0,0x102041,0x1020c0,0x106040,0x10603f,0x1020bf,0xfe0c0,0xfe041,0x101fc1,0x105fc0,0xfdfbf,0xfe0bf,0x105fbf,0xfdfc1,0x1020c1,0x106041,0x1060c0,0x1060bf,0xfe0c1,0x105fc1,0x93060c1,0x70203e,0x3101f40,0x180fa040,0x180fa03f,0x186fe03e,0x701fbe,0x3701f3f,0x30fdf40,0x1b0f9fc0,0x180f9fbf,0x186fdfbe,0x1b6fdf3f,0x3101f41,0x3105f40,0x70603e,0x7020be,0x180fa0c0,0x180fa041,0x182f9fc1,0x1b2fdf41,0x3105f3f,0x3705fbe,0x16fe0be,0x196fa0bf,0x9302140,0x9302042,0x930a040,0x970a03f,0x97060be,0x970213f,0x194fe140,0x192fa0c1,0x192fe042,0x13301fc2,0xb305f41,0xb309fc0,0xb709fbf,
+	13,0x101fc0,0xfe040,0x10203f,0x102041,0xfdfc0,0x1020c0,0x106040,0x101fbf,0xfe03f,0xfe041,0x101fc1,0x105fc0,0xfe0c0,0x1020bf,0x10603f,0xfdfbf,0xfdfc1,0x1020c1,0x106041,0x1060c0,0x105fbf,0xfe0bf,0xfe0c1,0x105fc1,0x11060bf,0x91060c1,0x3101f40,0x180fa040,0x180f9fc0,0x1b0fdf40,0x3101f3f,0x70203e,0x180fa03f,0x180fa041,0x180fa0c0,0x186fe03e,0x3701fbe,0x3101f41,0x3105f40,0x30fdf3f,0x1b0f9fbf,0x180f9fc1,0x302042,0x182fe042,0x1b0fdf41,0x3301fc2,0xb305f41,0xb105f3f,0x1b6fdfbe,0x17020be,0x170603e,0x930a040,0x9502140,0x190fa0bf,0x192fa0c1,0x194fe140,0x196fe0be,0xb705fbe,0xb309fc0,0xa70a03f,0xb306042,0x113020c2,0x1b2fdfc2,
+	17,0x10203f,0xfe03f,0xfe040,0x101fc0,0x101fbf,0x1020bf,0x1020c0,0x106040,0x10603f,0xfdfbf,0xfdfc0,0xfe0c0,0xfe0bf,0x105fbf,0x105fc0,0x1060c0,0x1060bf,0x302041,0x2fe041,0x70203e,0x6fe03e,0x301fc1,0x3020c1,0x306041,0x2fdfc1,0x701fbe,0x7020be,0x70603e,0x6fdfbe,0x2fe0c1,0x305fc1,0x3060c1,0x6fe0be,0x705fbe,0x7060be,0x186fa03f,0x180fa040,0x180f9fc0,0x186f9fbf,0x3701f3f,0x3101f40,0x1b0fdf40,0x1b6fdf3f,0x186fa0bf,0x180fa0c0,0x1302140,0x170213f,0x196fe13f,0x192fe140,0x830a040,0x870a03f,0x3705f3f,0x3105f40,0xb309fc0,0xb709fbf,0x170613f,0x1306140,0x930a0c0,0x970a0bf,0x192fa041,0x182f9fc1,0xb301f41,0x1b2fdf41,
+	17,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0x1020c0,0x1020bf,0x106040,0x10603f,0xfdfc0,0xfdfbf,0xfe0c0,0xfe0bf,0x105fc0,0x105fbf,0x1060c0,0x1060bf,0x302041,0x2fe041,0x301fc1,0x3020c1,0x306041,0x2fdfc1,0x70203e,0x6fe03e,0x2fe0c1,0x305fc1,0x3060c1,0x701fbe,0x7020be,0x70603e,0x6fdfbe,0x6fe0be,0x705fbe,0x7060be,0x186fa03f,0x180fa040,0x180f9fc0,0x186f9fbf,0x3701f3f,0x3101f40,0x1b0fdf40,0x1b6fdf3f,0x186fa0bf,0x180fa0c0,0x1302140,0x170213f,0x196fe13f,0x192fe140,0x830a040,0x870a03f,0x3705f3f,0x3105f40,0xb309fc0,0xb709fbf,0x170613f,0x1306140,0x930a0c0,0x970a0bf,0x192fa041,0x182f9fc1,0xb301f41,0x1b2fdf41,
+	17,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0x1020c0,0x1020bf,0x106040,0x10603f,0xfdfc0,0xfdfbf,0xfe0c0,0xfe0bf,0x105fc0,0x105fbf,0x1060c0,0x1060bf,0x302041,0x2fe041,0x301fc1,0x3020c1,0x306041,0x2fdfc1,0x2fe0c1,0x305fc1,0x3060c1,0x70203e,0x6fe03e,0x701fbe,0x7020be,0x70603e,0x6fdfbe,0x6fe0be,0x705fbe,0x7060be,0x180fa040,0x186fa03f,0x186f9fbf,0x180f9fc0,0x3101f40,0x3701f3f,0x1b6fdf3f,0x1b0fdf40,0x180fa0c0,0x186fa0bf,0x1302140,0x170213f,0x196fe13f,0x192fe140,0x830a040,0x870a03f,0x3105f40,0x3705f3f,0xb309fc0,0xb709fbf,0x1306140,0x170613f,0x930a0c0,0x970a0bf,0x192fa041,0x182f9fc1,0xb301f41,0x1b2fdf41,
+	15,0x10203f,0xfe040,0xfe03f,0x101fc0,0x101fbf,0x1020c0,0x1020bf,0x106040,0x10603f,0xfdfc0,0xfdfbf,0xfe0c0,0xfe0bf,0x105fc0,0x105fbf,0x302041,0x1060c0,0x1060bf,0x2fe041,0x301fc1,0x3020c1,0x306041,0x2fdfc1,0x2fe0c1,0x305fc1,0x3060c1,0x70203e,0x6fe03e,0x701fbe,0x7020be,0x70603e,0x6fdfbe,0x6fe0be,0x180fa040,0x186fa03f,0x705fbe,0x7060be,0x3101f40,0x3701f3f,0x180f9fc0,0x186f9fbf,0x180fa0c0,0x186fa0bf,0x1102140,0x170213f,0x1b0fdf40,0x1b6fdf3f,0x3105f40,0x3705f3f,0x830a040,0x870a03f,0x190fe140,0x196fe13f,0x192fa041,0x1b2f9fc1,0x13301f41,0xb309fc0,0xb709fbf,0x1106140,0x170613f,0x930a0c0,0x970a0bf,0x11302141,
+	13,0x10203f,0xfe040,0x101fc0,0xfe03f,0x1020c0,0x101fbf,0x106040,0x1020bf,0xfdfc0,0xfdfbf,0x10603f,0xfe0c0,0xfe0bf,0x302041,0x105fc0,0x105fbf,0x1060c0,0x1060bf,0x2fe041,0x301fc1,0x3020c1,0x306041,0x2fdfc1,0x2fe0c1,0x305fc1,0x3060c1,0x70203e,0x6fe03e,0x701fbe,0x7020be,0x70603e,0x6fdfbe,0x180fa040,0x186fa03f,0x6fe0be,0x180f9fc0,0x3101f40,0x3701f3f,0x8705fbe,0x87060be,0x180fa0c0,0x186fa0bf,0x186f9fbf,0x1b0fdf40,0x1b6fdf3f,0x1102140,0x170213f,0x190fe140,0x182fa041,0x3105f40,0xb705f3f,0x830a040,0x870a03f,0x196fe13f,0x1106140,0x970613f,0x950a0c0,0xb509fc0,0x13301f41,0x1b2f9fc1,0x182fa0c1,0x9302141,0x192fe141,
+	15,0x10203f,0xfe040,0x101fc0,0xfe03f,0x1020c0,0x106040,0x101fbf,0xfdfc0,0x1020bf,0xfe0c0,0x102041,0x10603f,0xfdfbf,0xfe0bf,0x105fc0,0xfe041,0x101fc1,0x1060c0,0x1020c1,0x105fbf,0x1060bf,0x106041,0x2fdfc1,0x2fe0c1,0x305fc1,0x3060c1,0x70203e,0x6fe03e,0x180fa040,0x186fa03f,0x701fbe,0x7020be,0x70603e,0x6fdfbe,0x3101f40,0x180f9fc0,0x186f9fbf,0x180fa0c0,0x6fe0be,0x186fa0bf,0x1102140,0x170213f,0x3701f3f,0x1b0fdf40,0x1b6fdf3f,0x8705fbe,0x87060be,0x182fa041,0x190fe140,0x196fe13f,0x830a040,0x3105f40,0x13301f41,0xb705f3f,0x870a03f,0xb509fc0,0x1b2f9fc1,0x192fa0c1,0x12302042,0x1106140,0x11302141,0x970613f,0x950a0c0,
+	13,0x10203f,0xfe040,0x101fc0,0x1020c0,0xfe03f,0x102041,0x106040,0x101fbf,0xfdfc0,0xfe0c0,0x1020bf,0x10603f,0xfe041,0x101fc1,0x105fc0,0xfdfbf,0xfe0bf,0x1020c1,0x1060c0,0x106041,0x105fbf,0xfdfc1,0xfe0c1,0x1060bf,0x305fc1,0x83060c1,0x70203e,0x180fa040,0x180fa03f,0x186fe03e,0x701fbe,0x3101f40,0x180f9fc0,0x180fa0c0,0x180fa041,0x1b0fdf40,0x3701f3f,0x7020be,0x70603e,0x6fdfbe,0x186f9fbf,0x180fa0bf,0x1102140,0x190fe140,0x186fe0be,0x170213f,0x97060be,0x8705fbe,0x1b6fdf3f,0x3301f41,0x3305f40,0x930a040,0xa302042,0x182f9fc1,0x192fa0c1,0x1a2fe042,0x1b2fdf41,0xb705f3f,0x970a03f,0xb509fc0,0x9706140,0x11302141,0x196fe13f,
+	13,0xfe040,0x10203f,0x101fc0,0x102041,0x1020c0,0x106040,0xfe03f,0xfdfc0,0x101fbf,0xfe041,0xfe0c0,0x1020bf,0x101fc1,0x105fc0,0x10603f,0x1020c1,0x106041,0x1060c0,0xfdfbf,0xfe0bf,0xfdfc1,0xfe0c1,0x8105fbf,0x81060bf,0x8105fc1,0x81060c1,0x180fa040,0x180fa03f,0x180f9fc0,0x3101f40,0x70203e,0x186fe03e,0x180fa0c0,0x180fa041,0x1b0fdf40,0x3101f3f,0x3701fbe,0x180f9fbf,0x302042,0x1102140,0x190fe140,0x180fa0bf,0x7020be,0xa70603e,0x3101f41,0xb505f40,0xa50a040,0x182fe042,0x182f9fc1,0x180fa0c1,0x170213f,0x186fe0be,0x186fdfbe,0x1b6fdf3f,0x1b2fdf41,0x1b301fc2,0x3020c2,0x1302141,0x9506140,0x196fe13f,0x190fe141,0x192fe0c2,0xa306042,
+	11,0x10203f,0x101fc0,0x101fbf,0xfdfbf,0xfe03f,0xfe040,0xfdfc0,0x105fc0,0x106040,0x10603f,0x105fbf,0x11020bf,0x11020c0,0x302041,0x301fc1,0x3101f40,0x3101f3f,0x701fbe,0x70203e,0x10fe0bf,0x10fe0c0,0x2fe041,0x2fdfc1,0x305fc1,0x306041,0x11060c0,0x11060bf,0x6fe03e,0x6fdfbe,0x30fdf3f,0x30fdf40,0x3105f40,0x3105f3f,0x705fbe,0x70603e,0x13020c1,0x12fe0c1,0x17020be,0x3301f41,0x32fdf41,0x180f9fc0,0x180fa040,0x180fa03f,0x180f9fbf,0x3701f3e,0x36fdf3e,0x16fe0be,0x93060c1,0x930a040,0xb309fc0,0xb305f41,0xb709fbf,0x970a03f,0x97060be,0xb705f3e,0x190fa0bf,0x190fa0c0,0x192fa041,0x182f9fc1,0x1b2f9f40,0x1b0f9f3f,0x1b6f9fbe,0x196fa03e,
+	11,0x101fc0,0x101fbf,0x10203f,0xfe040,0xfdfc0,0xfdfbf,0xfe03f,0x106040,0x105fc0,0x105fbf,0x10603f,0x302041,0x301fc1,0x11020c0,0x11020bf,0x2fe041,0x2fdfc1,0x3101f40,0x3101f3f,0x305fc1,0x306041,0x10fe0c0,0x10fe0bf,0x70203e,0x701fbe,0x11060bf,0x11060c0,0x30fdf40,0x30fdf3f,0x3105f3f,0x3105f40,0x6fdfbe,0x6fe03e,0x70603e,0x705fbe,0x13020c1,0x12fe0c1,0x3301f41,0x32fdf41,0x13060c1,0x17020be,0x186fa03f,0x180fa040,0x180f9fc0,0x186f9fbf,0x3305f41,0xb109fc0,0x910a040,0x970a03f,0xb709fbf,0x3701f3e,0x36fdf3e,0x16fe0be,0x97060be,0xb705f3e,0x182f9fc1,0x182fa041,0x192fa0c0,0x196fa0bf,0x1b6f9f3f,0x1b2f9f40,0xb309fc1,0x930a041,
+	11,0x101fc0,0x101fbf,0x10203f,0xfe040,0xfdfc0,0xfdfbf,0xfe03f,0x106040,0x105fc0,0x105fbf,0x10603f,0x302041,0x301fc1,0x2fdfc1,0x2fe041,0x11020c0,0x11020bf,0x306041,0x305fc1,0x3101f40,0x3101f3f,0x10fe0c0,0x10fe0bf,0x11060c0,0x11060bf,0x70203e,0x701fbe,0x30fdf3f,0x30fdf40,0x3105f40,0x3105f3f,0x6fdfbe,0x6fe03e,0x70603e,0x705fbe,0x13020c1,0x12fe0c1,0x3301f41,0x32fdf41,0x13060c1,0x3305f41,0x1b0f9fc0,0x180fa040,0x186fa03f,0x1b6f9fbf,0x17020be,0x870a03f,0x810a040,0xb109fc0,0xb709fbf,0x3701f3e,0x1b6fdf3e,0x16fe0be,0x17060be,0xb705f3e,0x1b2f9fc1,0x182fa041,0x192fa0c0,0x196fa0bf,0x830a041,0xb309fc1,0x930a0c0,0x970a0bf,
+	13,0x101fc0,0x101fbf,0x10203f,0xfe040,0xfdfc0,0xfdfbf,0xfe03f,0x106040,0x105fc0,0x105fbf,0x10603f,0x102041,0x101fc1,0xfdfc1,0xfe041,0x106041,0x105fc1,0x11020c0,0x11020bf,0x3101f40,0x3101f3f,0x10fe0c0,0x10fe0bf,0x11060c0,0x11060bf,0x30fdf40,0x30fdf3f,0x3105f40,0x3105f3f,0x701fbe,0x70203e,0x11020c1,0x12fe0c1,0x3101f41,0x6fdfbe,0x6fe03e,0x70603e,0x705fbe,0x13060c1,0x32fdf41,0x3305f41,0x1b0f9fc0,0x180fa040,0x186fa03f,0x1b6f9fbf,0xb109fc0,0x910a040,0x970a03f,0xb709fbf,0x17020be,0x16fe0be,0x3701f3e,0x1b6fdf3e,0x97060be,0xb705f3e,0x1b2f9fc1,0x182fa041,0x192fa0c0,0x196fa0bf,0x930a041,0xb309fc1,0x13301fc2,0x11302042,
+	15,0x101fc0,0x101fbf,0x10203f,0xfe040,0xfdfc0,0xfdfbf,0xfe03f,0x106040,0x105fc0,0x105fbf,0x10603f,0x102041,0x101fc1,0xfdfc1,0xfe041,0x106041,0x105fc1,0x11020c0,0x11020bf,0x3101f40,0x3101f3f,0x10fe0c0,0x10fe0bf,0x11060c0,0x11060bf,0x30fdf40,0x30fdf3f,0x3105f40,0x3105f3f,0x11020c1,0x10fe0c1,0x3101f41,0x701fbe,0x70203e,0x6fe03e,0x6fdfbe,0x13060c1,0x30fdf41,0x3305f41,0x705fbe,0x70603e,0x180fa040,0x1b0f9fc0,0x1b6f9fbf,0x186fa03f,0x910a040,0xb109fc0,0xb709fbf,0x970a03f,0x17020be,0x196fe0be,0x180fa041,0x1b0f9fc1,0xb701f3e,0x1b6fdf3e,0x97060be,0x930a041,0xb309fc1,0xb301fc2,0x9302042,0x192fe042,0x1b2fdfc2,0x194fa0c0,
+	17,0x101fc0,0x101fbf,0x10203f,0xfe040,0xfdfc0,0x105fc0,0x106040,0xfe03f,0xfdfbf,0x105fbf,0x10603f,0x102041,0x101fc1,0xfdfc1,0xfe041,0x106041,0x105fc1,0x11020c0,0x11020bf,0x3101f40,0x3101f3f,0x10fe0c0,0x11060c0,0x10fe0bf,0x30fdf40,0x3105f40,0x11060bf,0x11020c1,0x30fdf3f,0x3105f3f,0x3101f41,0x10fe0c1,0x11060c1,0x30fdf41,0x3105f41,0x701fbe,0x70203e,0x6fe03e,0x6fdfbe,0x705fbe,0x70603e,0x190fa040,0x1b0f9fc0,0x1b6f9fbf,0x196fa03f,0x910a040,0xb109fc0,0xb709fbf,0x970a03f,0x190fa041,0x1b0f9fc1,0x3301fc2,0x1302042,0x910a041,0xb109fc1,0x97020be,0x196fe0be,0xb701f3e,0x1b6fdf3e,0x1b2fdfc2,0x192fe042,0x9306042,0xb305fc2,
+	17,0x101fc0,0x101fbf,0x10203f,0xfe040,0xfdfc0,0x105fc0,0x106040,0x102041,0x101fc1,0xfdfbf,0xfe03f,0x10603f,0x105fbf,0xfdfc1,0xfe041,0x106041,0x105fc1,0x11020c0,0x11020bf,0x3101f40,0x3101f3f,0x10fe0c0,0x11060c0,0x11020c1,0x10fe0bf,0x30fdf40,0x3105f40,0x3101f41,0x30fdf3f,0x11060bf,0x10fe0c1,0x11060c1,0x3105f3f,0x30fdf41,0x3105f41,0x3701fbe,0x70203e,0x6fe03e,0x36fdfbe,0x1b0f9fc0,0x180fa040,0x186fa03f,0x1b6f9fbf,0x3705fbe,0x70603e,0x910a040,0xb109fc0,0xb709fbf,0x970a03f,0x1302042,0x3301fc2,0x1b0f9fc1,0x180fa041,0x192fe042,0x1b2fdfc2,0xb109fc1,0x910a041,0x9306042,0xb305fc2,0x97020be,0x16fe0be,0x192fa0c0,0x196fa0bf,
+	17,0x101fc0,0x101fbf,0x10203f,0xfe040,0xfdfc0,0x101fc1,0x102041,0x106040,0x105fc0,0xfdfbf,0xfe03f,0x10603f,0x105fbf,0xfdfc1,0xfe041,0x106041,0x105fc1,0x11020c0,0x3101f40,0x11020bf,0x10fe0c0,0x11020c1,0x11060c0,0x3101f3f,0x30fdf40,0x3101f41,0x3105f40,0x10fe0bf,0x11060bf,0x10fe0c1,0x11060c1,0x30fdf3f,0x3105f3f,0x30fdf41,0x3105f41,0x3701fbe,0x70203e,0x180fa040,0x1b0f9fc0,0x1b0f9fbf,0x180fa03f,0x186fe03e,0x1b6fdfbe,0x3705fbe,0xb109fc0,0x910a040,0x1302042,0x3301fc2,0x1b0f9fc1,0x180fa041,0x192fe042,0x1b2fdfc2,0x70603e,0x970a03f,0xb709fbf,0xb109fc1,0x910a041,0x9306042,0xb305fc2,0x192fa0c0,0x97020be,0x16fe0be,0x196fa0bf,
+	11,0x10203f,0x101fbf,0x101fc0,0xfe040,0xfe03f,0xfdfbf,0xfdfc0,0x106040,0x10603f,0x105fbf,0x105fc0,0x11020c0,0x11020bf,0x302041,0x301fc1,0x10fe0c0,0x10fe0bf,0x70203e,0x701fbe,0x11060bf,0x11060c0,0x2fe041,0x2fdfc1,0x3101f40,0x3101f3f,0x305fc1,0x306041,0x6fe03e,0x6fdfbe,0x705fbe,0x70603e,0x30fdf3f,0x30fdf40,0x3105f40,0x3105f3f,0x13020c1,0x12fe0c1,0x17020be,0x16fe0be,0x13060c1,0x3301f41,0x1b0f9fc0,0x180fa040,0x180fa03f,0x1b0f9fbf,0x17060be,0x870a03f,0x830a040,0xb309fc0,0xb709fbf,0x3701f3e,0x36fdf3e,0x32fdf41,0xb305f41,0xb705f3e,0x190fa0bf,0x190fa0c0,0x192fa041,0x1b2f9fc1,0x1b6f9fbe,0x196fa03e,0x970a0bf,0x930a0c0,
+	11,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0xfdfbf,0x106040,0x10603f,0x105fbf,0x105fc0,0x301fc1,0x302041,0x11020c0,0x11020bf,0x10fe0bf,0x10fe0c0,0x2fe041,0x2fdfc1,0x305fc1,0x306041,0x11060c0,0x11060bf,0x70203e,0x701fbe,0x3101f3f,0x3101f40,0x30fdf40,0x30fdf3f,0x6fdfbe,0x6fe03e,0x70603e,0x705fbe,0x3105f3f,0x3105f40,0x13020c1,0x12fe0c1,0x93060c1,0x3301f41,0x17020be,0x16fe0be,0x180fa03f,0x180fa040,0x180f9fc0,0x180f9fbf,0x32fdf41,0xb305f41,0xb309fc0,0x930a040,0x970a03f,0x97060be,0xb709fbf,0x3701f3e,0x36fdf3e,0xb705f3e,0x190fa0bf,0x190fa0c0,0x192fa041,0x182f9fc1,0x1b2f9f40,0x1b0f9f3f,0x1b6f9fbe,0x196fa03e,
+	11,0x101fc0,0x10203f,0x101fbf,0xfe040,0xfdfc0,0xfe03f,0xfdfbf,0x106040,0x105fc0,0x105fbf,0x10603f,0x302041,0x301fc1,0x11020c0,0x11020bf,0x2fe041,0x2fdfc1,0x305fc1,0x306041,0x10fe0c0,0x10fe0bf,0x11060c0,0x11060bf,0x3101f40,0x3101f3f,0x701fbe,0x70203e,0x30fdf3f,0x30fdf40,0x3105f40,0x3105f3f,0x6fdfbe,0x6fe03e,0x13020c1,0x70603e,0x705fbe,0x12fe0c1,0x13060c1,0x3301f41,0x32fdf41,0x1b0f9fc0,0x180fa040,0x186fa03f,0x1b6f9fbf,0x17020be,0x16fe0be,0x3305f41,0xb109fc0,0x810a040,0x870a03f,0xb709fbf,0x17060be,0x3701f3e,0x1b6fdf3e,0xb705f3e,0x1b2f9fc1,0x182fa041,0x192fa0c0,0x196fa0bf,0x830a041,0xb309fc1,0x930a0c0,0x970a0bf,
+	11,0x101fc0,0x10203f,0x101fbf,0xfe040,0xfdfc0,0xfe03f,0xfdfbf,0x106040,0x105fc0,0x105fbf,0x10603f,0x302041,0x301fc1,0x2fdfc1,0x2fe041,0x11020c0,0x11020bf,0x306041,0x305fc1,0x10fe0c0,0x10fe0bf,0x11060c0,0x11060bf,0x3101f40,0x3101f3f,0x30fdf40,0x30fdf3f,0x701fbe,0x70203e,0x13020c1,0x3105f40,0x3105f3f,0x6fdfbe,0x6fe03e,0x12fe0c1,0x13060c1,0x70603e,0x705fbe,0x3301f41,0x32fdf41,0x3305f41,0x1b0f9fc0,0x180fa040,0x186fa03f,0x1b6f9fbf,0x17020be,0x810a040,0xb109fc0,0xb709fbf,0x870a03f,0x17060be,0x16fe0be,0x3701f3e,0x1b6fdf3e,0x1b2f9fc1,0x182fa041,0x192fa0c0,0x196fa0bf,0xb705f3e,0xb309fc1,0x830a041,0x930a0c0,0x970a0bf,
+	13,0x101fc0,0x10203f,0x101fbf,0xfe040,0xfdfc0,0xfdfbf,0xfe03f,0x106040,0x105fc0,0x105fbf,0x10603f,0x102041,0x101fc1,0xfdfc1,0xfe041,0x106041,0x105fc1,0x11020c0,0x11020bf,0x10fe0c0,0x10fe0bf,0x11060c0,0x11060bf,0x3101f40,0x3101f3f,0x30fdf40,0x11020c1,0x10fe0c1,0x3105f40,0x30fdf3f,0x3105f3f,0x701fbe,0x70203e,0x13060c1,0x3101f41,0x32fdf41,0x6fdfbe,0x6fe03e,0x70603e,0x705fbe,0x3305f41,0x1b0f9fc0,0x180fa040,0x186fa03f,0x1b6f9fbf,0x910a040,0xb109fc0,0xb709fbf,0x970a03f,0x17020be,0x16fe0be,0x97060be,0x180fa041,0x1b2f9fc1,0xb701f3e,0x1b6fdf3e,0xb309fc1,0x930a041,0x9302042,0xb301fc2,0x192fa0c0,0x196fa0bf,0x1a2fe042,
+	17,0x101fc0,0x10203f,0x101fbf,0xfe040,0xfdfc0,0x106040,0x105fc0,0xfe03f,0xfdfbf,0x10603f,0x105fbf,0x102041,0x101fc1,0xfdfc1,0xfe041,0x106041,0x105fc1,0x11020c0,0x11020bf,0x10fe0c0,0x11060c0,0x10fe0bf,0x11060bf,0x3101f40,0x3101f3f,0x11020c1,0x10fe0c1,0x30fdf40,0x3105f40,0x30fdf3f,0x3105f3f,0x11060c1,0x3101f41,0x30fdf41,0x701fbe,0x70203e,0x6fe03e,0x6fdfbe,0x3105f41,0x705fbe,0x70603e,0x190fa040,0x1b0f9fc0,0x1b6f9fbf,0x196fa03f,0x910a040,0xb109fc0,0xb709fbf,0x970a03f,0x17020be,0x190fa041,0x1b0f9fc1,0x3301fc2,0x1302042,0x910a041,0xb109fc1,0xb305fc2,0x9306042,0x192fe042,0x1b2fdfc2,0x196fe0be,0x97060be,0x13701f3e,
+	17,0x101fc0,0x10203f,0x101fbf,0xfe040,0xfdfc0,0x106040,0x105fc0,0x102041,0x101fc1,0xfe03f,0xfdfbf,0x10603f,0x105fbf,0xfe041,0xfdfc1,0x106041,0x105fc1,0x11020c0,0x11020bf,0x10fe0c0,0x11060c0,0x11020c1,0x10fe0bf,0x3101f40,0x3101f3f,0x11060bf,0x10fe0c1,0x11060c1,0x30fdf40,0x3105f40,0x3101f41,0x30fdf3f,0x3105f3f,0x30fdf41,0x3105f41,0x3701fbe,0x70203e,0x6fe03e,0x36fdfbe,0x1b0f9fc0,0x180fa040,0x186fa03f,0x1b6f9fbf,0x3705fbe,0x70603e,0x910a040,0xb109fc0,0xb709fbf,0x970a03f,0x1302042,0x3301fc2,0x1b0f9fc1,0x180fa041,0x192fe042,0x1b2fdfc2,0xb109fc1,0x910a041,0x9306042,0xb305fc2,0x97020be,0x16fe0be,0x192fa0c0,0x196fa0bf,
+	17,0x101fc0,0x10203f,0xfe040,0xfdfc0,0x101fbf,0x106040,0x105fc0,0x102041,0x101fc1,0xfe03f,0xfdfbf,0x10603f,0x105fbf,0xfe041,0xfdfc1,0x106041,0x105fc1,0x11020c0,0x11020bf,0x10fe0c0,0x11020c1,0x11060c0,0x3101f40,0x10fe0bf,0x11060bf,0x10fe0c1,0x11060c1,0x30fdf40,0x3101f3f,0x3105f40,0x3101f41,0x30fdf41,0x30fdf3f,0x3105f3f,0x3105f41,0x1b0f9fc0,0x180fa040,0x70203e,0x3701fbe,0x36fdfbe,0x6fe03e,0x186fa03f,0x1b6f9fbf,0x1b0f9fc1,0x3301fc2,0x1302042,0x910a040,0xb109fc0,0x3705fbe,0x70603e,0x970a03f,0xb709fbf,0x180fa041,0x192fe042,0x1b2fdfc2,0x3305fc2,0x1306042,0x930a041,0xb309fc1,0x97020be,0x192fa0c0,0x190fa0bf,0x196fe0be,
+	11,0x10203f,0x101fbf,0x101fc0,0xfe040,0xfe03f,0xfdfbf,0xfdfc0,0x106040,0x10603f,0x105fbf,0x105fc0,0x11020c0,0x11020bf,0x10fe0bf,0x10fe0c0,0x302041,0x301fc1,0x11060c0,0x11060bf,0x70203e,0x701fbe,0x2fe041,0x2fdfc1,0x306041,0x305fc1,0x3101f40,0x3101f3f,0x6fdfbe,0x6fe03e,0x70603e,0x705fbe,0x30fdf3f,0x30fdf40,0x3105f40,0x3105f3f,0x13020c1,0x12fe0c1,0x17020be,0x16fe0be,0x13060c1,0x17060be,0x186fa03f,0x180fa040,0x1b0f9fc0,0x1b6f9fbf,0x3301f41,0xb109fc0,0x810a040,0x870a03f,0xb709fbf,0x3701f3e,0x1b6fdf3e,0x32fdf41,0x3305f41,0xb705f3e,0x196fa0bf,0x190fa0c0,0x192fa041,0x1b2f9fc1,0x910a0c0,0x970a0bf,0x930a041,0xb309fc1,
+	11,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0xfdfbf,0x106040,0x10603f,0x105fbf,0x105fc0,0x11020c0,0x11020bf,0x302041,0x301fc1,0x10fe0c0,0x10fe0bf,0x11060bf,0x11060c0,0x2fe041,0x2fdfc1,0x306041,0x305fc1,0x70203e,0x701fbe,0x3101f3f,0x3101f40,0x6fdfbe,0x6fe03e,0x70603e,0x705fbe,0x30fdf3f,0x30fdf40,0x13020c1,0x3105f40,0x3105f3f,0x12fe0c1,0x13060c1,0x17020be,0x16fe0be,0x186fa03f,0x180fa040,0x1b0f9fc0,0x1b6f9fbf,0x3301f41,0x32fdf41,0x17060be,0x870a03f,0x810a040,0xb109fc0,0xb709fbf,0x3305f41,0x3701f3e,0x1b6fdf3e,0xb705f3e,0x196fa0bf,0x190fa0c0,0x192fa041,0x1b2f9fc1,0x910a0c0,0x970a0bf,0x930a041,0xb309fc1,
+	11,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0xfdfbf,0x106040,0x10603f,0x105fc0,0x105fbf,0x302041,0x11020c0,0x11020bf,0x301fc1,0x2fe041,0x10fe0c0,0x10fe0bf,0x2fdfc1,0x306041,0x11060c0,0x11060bf,0x305fc1,0x3101f40,0x3101f3f,0x701fbe,0x70203e,0x13020c1,0x12fe0c1,0x6fe03e,0x6fdfbe,0x30fdf3f,0x30fdf40,0x3105f40,0x3105f3f,0x705fbe,0x70603e,0x13060c1,0x17020be,0x3301f41,0x1b0f9fc0,0x180fa040,0x186fa03f,0x1b6f9fbf,0x16fe0be,0x17060be,0x870a03f,0x810a040,0xb109fc0,0x3305f41,0x32fdf41,0xb709fbf,0x3701f3e,0x1b6fdf3e,0xb705f3e,0x182fa041,0x1b2f9fc1,0x192fa0c0,0x196fa0bf,0x910a0c0,0x970a0bf,0x930a041,0xb309fc1,
+	11,0x101fc0,0x10203f,0x101fbf,0xfe040,0xfdfc0,0xfe03f,0xfdfbf,0x106040,0x105fc0,0x10603f,0x105fbf,0x302041,0x301fc1,0x11020c0,0x11020bf,0x2fe041,0x2fdfc1,0x306041,0x305fc1,0x10fe0c0,0x10fe0bf,0x11060c0,0x11060bf,0x13020c1,0x3101f40,0x3101f3f,0x701fbe,0x70203e,0x30fdf40,0x30fdf3f,0x12fe0c1,0x13060c1,0x3105f40,0x3105f3f,0x6fdfbe,0x6fe03e,0x70603e,0x705fbe,0x3301f41,0x32fdf41,0x1b0f9fc0,0x180fa040,0x186fa03f,0x1b6f9fbf,0x17020be,0x16fe0be,0x3305f41,0xb109fc0,0x810a040,0x870a03f,0xb709fbf,0x17060be,0x3701f3e,0x1b2f9fc1,0x182fa041,0x192fa0c0,0x196fa0bf,0x1b6fdf3e,0xb705f3e,0xb309fc1,0x830a041,0x930a0c0,0x970a0bf,
+	13,0x101fc0,0x10203f,0x101fbf,0xfe040,0xfdfc0,0xfe03f,0x106040,0x105fc0,0xfdfbf,0x10603f,0x105fbf,0x102041,0x101fc1,0xfe041,0x11020c0,0x11020bf,0xfdfc1,0x106041,0x105fc1,0x10fe0c0,0x10fe0bf,0x11060c0,0x11060bf,0x11020c1,0x3101f40,0x3101f3f,0x30fdf40,0x12fe0c1,0x13060c1,0x3105f40,0x3105f3f,0x30fdf3f,0x701fbe,0x70203e,0x6fe03e,0x6fdfbe,0x3101f41,0x32fdf41,0x70603e,0x705fbe,0x3305f41,0x1b0f9fc0,0x180fa040,0x186fa03f,0x1b6f9fbf,0x17020be,0x810a040,0xb109fc0,0xb709fbf,0x870a03f,0x97060be,0x16fe0be,0x182fa041,0x1b2f9fc1,0x192fa0c0,0x196fa0bf,0x830a041,0xb309fc1,0x11302042,0x13301fc2,0xb701f3e,0x1b6fdf3e,0x950a0c0,
+	16,0x101fc0,0x10203f,0x101fbf,0xfe040,0xfdfc0,0x106040,0x105fc0,0xfe03f,0xfdfbf,0x10603f,0x105fbf,0x102041,0x101fc1,0xfe041,0xfdfc1,0x106041,0x11020c0,0x105fc1,0x11020bf,0x10fe0c0,0x11060c0,0x10fe0bf,0x11060bf,0x11020c1,0x10fe0c1,0x3101f40,0x3101f3f,0x11060c1,0x30fdf40,0x3105f40,0x3105f3f,0x30fdf3f,0x3101f41,0x70203e,0x3701fbe,0x6fe03e,0x36fdfbe,0x30fdf41,0x3305f41,0x3705fbe,0x70603e,0x180fa040,0x1b0f9fc0,0x1b6f9fbf,0x186fa03f,0x910a040,0xb109fc0,0xb709fbf,0x970a03f,0x17020be,0x16fe0be,0x180fa041,0x1b0f9fc1,0x1302042,0x3301fc2,0x910a041,0xb309fc1,0x97060be,0x192fa0c0,0x196fa0bf,0x192fe042,0x1b2fdfc2,0xa306042,
+	17,0x101fc0,0x10203f,0x101fbf,0xfe040,0xfdfc0,0x106040,0x105fc0,0x102041,0x101fc1,0xfe03f,0xfdfbf,0x10603f,0x105fbf,0xfe041,0xfdfc1,0x106041,0x105fc1,0x11020c0,0x11020bf,0x10fe0c0,0x11060c0,0x11020c1,0x10fe0bf,0x11060bf,0x10fe0c1,0x11060c1,0x3101f40,0x3101f3f,0x30fdf40,0x3105f40,0x3101f41,0x30fdf3f,0x3105f3f,0x30fdf41,0x3105f41,0x70203e,0x3701fbe,0x36fdfbe,0x6fe03e,0x180fa040,0x1b0f9fc0,0x1b6f9fbf,0x186fa03f,0x70603e,0x3705fbe,0x910a040,0xb109fc0,0xb709fbf,0x970a03f,0x1302042,0x3301fc2,0x180fa041,0x1b0f9fc1,0x192fe042,0x1b2fdfc2,0x910a041,0xb109fc1,0x9306042,0xb305fc2,0x97020be,0x16fe0be,0x192fa0c0,0x196fa0bf,
+	17,0x101fc0,0x10203f,0xfe040,0xfdfc0,0x101fbf,0x106040,0x102041,0x101fc1,0x105fc0,0xfe03f,0xfdfbf,0x10603f,0x105fbf,0xfe041,0xfdfc1,0x106041,0x105fc1,0x11020c0,0x11020bf,0x10fe0c0,0x11020c1,0x11060c0,0x10fe0bf,0x11060bf,0x10fe0c1,0x11060c1,0x3101f40,0x30fdf40,0x3101f3f,0x3105f40,0x3101f41,0x30fdf41,0x30fdf3f,0x3105f3f,0x3105f41,0x1b0f9fc0,0x180fa040,0x70203e,0x3701fbe,0x36fdfbe,0x6fe03e,0x186fa03f,0x1b6f9fbf,0x1302042,0x3301fc2,0x910a040,0xb109fc0,0x70603e,0x3705fbe,0x970a03f,0xb709fbf,0x180fa041,0x1b0f9fc1,0x192fe042,0x1b2fdfc2,0x1306042,0x3305fc2,0x930a041,0xb309fc1,0x97020be,0x192fa0c0,0x190fa0bf,0x196fe0be,
+	13,0x10203f,0x101fbf,0x101fc0,0xfe040,0xfe03f,0xfdfbf,0xfdfc0,0x106040,0x10603f,0x105fbf,0x105fc0,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x1060c0,0x1060bf,0x302041,0x301fc1,0x70203e,0x701fbe,0x2fe041,0x2fdfc1,0x306041,0x305fc1,0x6fe03e,0x6fdfbe,0x70603e,0x705fbe,0x3101f3f,0x3101f40,0x3020c1,0x12fe0c1,0x7020be,0x30fdf3f,0x30fdf40,0x3105f40,0x3105f3f,0x13060c1,0x16fe0be,0x17060be,0x186fa03f,0x180fa040,0x1b0f9fc0,0x1b6f9fbf,0x870a03f,0x830a040,0xb309fc0,0xb709fbf,0x3301f41,0x32fdf41,0x3701f3e,0x1b6fdf3e,0xb305f41,0xb705f3e,0x196fa0bf,0x190fa0c0,0x192fa041,0x1b2f9fc1,0x930a0c0,0x970a0bf,0x1170213f,0x11302140,
+	11,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0xfdfbf,0x106040,0x10603f,0x105fbf,0x105fc0,0x11020c0,0x11020bf,0x10fe0bf,0x10fe0c0,0x302041,0x301fc1,0x11060c0,0x11060bf,0x2fe041,0x2fdfc1,0x306041,0x305fc1,0x70203e,0x701fbe,0x6fe03e,0x6fdfbe,0x3101f3f,0x3101f40,0x13020c1,0x70603e,0x705fbe,0x30fdf3f,0x30fdf40,0x12fe0c1,0x13060c1,0x3105f40,0x3105f3f,0x17020be,0x16fe0be,0x17060be,0x186fa03f,0x180fa040,0x1b0f9fc0,0x1b6f9fbf,0x3301f41,0x810a040,0x870a03f,0xb709fbf,0xb109fc0,0x3305f41,0x32fdf41,0x3701f3e,0x1b6fdf3e,0x196fa0bf,0x190fa0c0,0x192fa041,0x1b2f9fc1,0xb705f3e,0x970a0bf,0x910a0c0,0x930a041,0xb309fc1,
+	11,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0xfdfbf,0x106040,0x10603f,0x105fc0,0x105fbf,0x11020c0,0x11020bf,0x302041,0x301fc1,0x10fe0c0,0x10fe0bf,0x11060c0,0x11060bf,0x2fe041,0x2fdfc1,0x306041,0x305fc1,0x13020c1,0x70203e,0x701fbe,0x3101f3f,0x3101f40,0x6fe03e,0x6fdfbe,0x12fe0c1,0x13060c1,0x70603e,0x705fbe,0x30fdf3f,0x30fdf40,0x3105f40,0x3105f3f,0x17020be,0x16fe0be,0x186fa03f,0x180fa040,0x1b0f9fc0,0x1b6f9fbf,0x3301f41,0x32fdf41,0x17060be,0x870a03f,0x810a040,0xb109fc0,0xb709fbf,0x3305f41,0x3701f3e,0x196fa0bf,0x190fa0c0,0x192fa041,0x1b2f9fc1,0x1b6fdf3e,0xb705f3e,0x970a0bf,0x910a0c0,0x930a041,0xb309fc1,
+	11,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0x106040,0x10603f,0x105fc0,0xfdfbf,0x105fbf,0x302041,0x1020c0,0x1020bf,0x301fc1,0x2fe041,0xfe0c0,0xfe0bf,0x1060c0,0x306041,0x2fdfc1,0x305fc1,0x1060bf,0x3020c1,0x12fe0c1,0x13060c1,0x70203e,0x701fbe,0x3101f40,0x3101f3f,0x30fdf40,0x30fdf3f,0x6fe03e,0x6fdfbe,0x70603e,0x705fbe,0x3105f40,0x3105f3f,0x3301f41,0x180fa040,0x186fa03f,0x7020be,0x16fe0be,0x1b0f9fc0,0x1b6f9fbf,0x32fdf41,0x3305f41,0x810a040,0x870a03f,0xb109fc0,0xb709fbf,0x17060be,0x190fa0c0,0x192fa041,0x1b2f9fc1,0x196fa0bf,0x13701f3e,0x910a0c0,0x930a041,0xb309fc1,0x970a0bf,0x11302140,0x1170213f,
+	13,0x101fc0,0x10203f,0x101fbf,0xfe040,0xfdfc0,0xfe03f,0x106040,0x105fc0,0x10603f,0xfdfbf,0x105fbf,0x102041,0x101fc1,0x11020c0,0x11020bf,0xfe041,0xfdfc1,0x106041,0x105fc1,0x10fe0c0,0x10fe0bf,0x11060c0,0x11060bf,0x11020c1,0x10fe0c1,0x13060c1,0x3101f40,0x3101f3f,0x70203e,0x3701fbe,0x30fdf40,0x30fdf3f,0x3105f40,0x3105f3f,0x6fe03e,0x36fdfbe,0x70603e,0x3705fbe,0x3101f41,0x32fdf41,0x180fa040,0x1b0f9fc0,0x186fa03f,0x1b6f9fbf,0x17020be,0x810a040,0x3305f41,0xb109fc0,0x870a03f,0xb709fbf,0x17060be,0x16fe0be,0x180fa041,0x1b2f9fc1,0x192fa0c0,0x196fa0bf,0x830a041,0xb309fc1,0x930a0c0,0x970a0bf,0x9302042,0xb301fc2,0x1a2fe042,
+	13,0x101fc0,0x10203f,0x101fbf,0xfe040,0xfdfc0,0x106040,0x105fc0,0xfe03f,0xfdfbf,0x10603f,0x105fbf,0x102041,0x101fc1,0x11020c0,0xfe041,0xfdfc1,0x106041,0x105fc1,0x11020bf,0x10fe0c0,0x11060c0,0x10fe0bf,0x11060bf,0x11020c1,0x10fe0c1,0x11060c1,0x3101f40,0x3101f3f,0x30fdf40,0x3105f40,0x3105f3f,0x30fdf3f,0x70203e,0x3701fbe,0x3101f41,0x30fdf41,0x6fe03e,0x36fdfbe,0x70603e,0x3705fbe,0x180fa040,0x1b0f9fc0,0x186fa03f,0x1b6f9fbf,0x3305f41,0x910a040,0xb109fc0,0x970a03f,0x17020be,0x16fe0be,0xb709fbf,0x97060be,0x180fa041,0x1b0f9fc1,0x1302042,0x3301fc2,0x910a041,0xb309fc1,0x192fa0c0,0x196fa0bf,0x192fe042,0x1b2fdfc2,0xa306042,
+	15,0x101fc0,0x10203f,0x101fbf,0xfe040,0xfdfc0,0x106040,0x105fc0,0x102041,0x101fc1,0xfe03f,0xfdfbf,0x10603f,0x105fbf,0xfe041,0xfdfc1,0x11020c0,0x106041,0x105fc1,0x11020bf,0x10fe0c0,0x11060c0,0x11020c1,0x10fe0bf,0x11060bf,0x10fe0c1,0x11060c1,0x3101f40,0x3101f3f,0x30fdf40,0x3105f40,0x3101f41,0x30fdf3f,0x3105f3f,0x70203e,0x3701fbe,0x30fdf41,0x3105f41,0x180fa040,0x1b0f9fc0,0x6fe03e,0x36fdfbe,0x70603e,0x3705fbe,0x810a040,0xb109fc0,0x186fa03f,0x1b6f9fbf,0x180fa041,0x1b0f9fc1,0x1302042,0x3301fc2,0x870a03f,0xb709fbf,0x97020be,0x196fe0be,0x194fa0c0,0x192fe042,0x1b2fdfc2,0x810a041,0xb109fc1,0x9306042,0xb305fc2,0x950a0c0,
+	17,0x101fc0,0x10203f,0xfe040,0xfdfc0,0x101fbf,0x106040,0x102041,0x101fc1,0x105fc0,0xfe03f,0xfdfbf,0x10603f,0x105fbf,0xfe041,0xfdfc1,0x106041,0x105fc1,0x11020c0,0x11020bf,0x10fe0c0,0x11020c1,0x11060c0,0x10fe0bf,0x11060bf,0x10fe0c1,0x11060c1,0x3101f40,0x30fdf40,0x3101f3f,0x3105f40,0x3101f41,0x30fdf41,0x30fdf3f,0x3105f3f,0x3105f41,0x70203e,0x3701fbe,0x180fa040,0x1b0f9fc0,0x180fa03f,0x186fe03e,0x36fdfbe,0x1b6f9fbf,0x1302042,0x3301fc2,0x910a040,0xb109fc0,0x70603e,0x3705fbe,0x970a03f,0xb709fbf,0x180fa041,0x1b0f9fc1,0x192fe042,0x1b2fdfc2,0x1306042,0x930a041,0xb109fc1,0xb305fc2,0x192fa0c0,0x97020be,0x16fe0be,0x196fa0bf,
+	15,0x10203f,0x101fbf,0x101fc0,0xfe040,0xfe03f,0xfdfbf,0xfdfc0,0x106040,0x10603f,0x105fbf,0x105fc0,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x1060c0,0x1060bf,0x302041,0x301fc1,0x70203e,0x701fbe,0x2fe041,0x2fdfc1,0x306041,0x305fc1,0x6fe03e,0x6fdfbe,0x70603e,0x705fbe,0x3020c1,0x2fe0c1,0x7020be,0x3101f3f,0x3101f40,0x30fdf40,0x30fdf3f,0x13060c1,0x6fe0be,0x17060be,0x3105f3f,0x3105f40,0x180fa040,0x186fa03f,0x1b6f9fbf,0x1b0f9fc0,0x830a040,0x870a03f,0xb709fbf,0xb309fc0,0x3301f41,0x1b2fdf41,0x180fa0c0,0x186fa0bf,0xb701f3e,0x1b6fdf3e,0xb305f41,0x930a0c0,0x970a0bf,0x970213f,0x9302140,0x192fe140,0x196fe13f,0x1a2fa041,
+	13,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfbf,0xfdfc0,0x106040,0x10603f,0x105fbf,0x105fc0,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x1060c0,0x1060bf,0x302041,0x301fc1,0x2fe041,0x2fdfc1,0x306041,0x305fc1,0x70203e,0x701fbe,0x6fe03e,0x3020c1,0x2fe0c1,0x70603e,0x6fdfbe,0x705fbe,0x3101f3f,0x3101f40,0x13060c1,0x7020be,0x16fe0be,0x30fdf3f,0x30fdf40,0x3105f40,0x3105f3f,0x17060be,0x186fa03f,0x180fa040,0x1b0f9fc0,0x1b6f9fbf,0x830a040,0x870a03f,0xb709fbf,0xb309fc0,0x3301f41,0x32fdf41,0xb305f41,0x180fa0c0,0x196fa0bf,0xb701f3e,0x1b6fdf3e,0x970a0bf,0x930a0c0,0x9302140,0x970213f,0x192fa041,0x1b2f9fc1,0x194fe140,
+	13,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0x106040,0x10603f,0xfdfbf,0x105fc0,0x105fbf,0x1020c0,0x1020bf,0xfe0c0,0x302041,0x301fc1,0xfe0bf,0x1060c0,0x1060bf,0x2fe041,0x2fdfc1,0x306041,0x305fc1,0x3020c1,0x70203e,0x701fbe,0x6fe03e,0x12fe0c1,0x13060c1,0x70603e,0x705fbe,0x6fdfbe,0x3101f3f,0x3101f40,0x30fdf40,0x30fdf3f,0x7020be,0x16fe0be,0x3105f40,0x3105f3f,0x17060be,0x186fa03f,0x180fa040,0x1b0f9fc0,0x1b6f9fbf,0x3301f41,0x810a040,0x870a03f,0xb709fbf,0xb109fc0,0xb305f41,0x32fdf41,0x190fa0c0,0x196fa0bf,0x192fa041,0x1b2f9fc1,0x910a0c0,0x970a0bf,0x11302140,0x1170213f,0xb701f3e,0x1b6fdf3e,0xa30a041,
+	13,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0x106040,0x10603f,0x105fc0,0xfdfbf,0x105fbf,0x1020c0,0x1020bf,0x302041,0x301fc1,0xfe0c0,0xfe0bf,0x1060c0,0x1060bf,0x2fe041,0x2fdfc1,0x306041,0x305fc1,0x3020c1,0x2fe0c1,0x13060c1,0x70203e,0x701fbe,0x3101f40,0x3701f3f,0x6fe03e,0x6fdfbe,0x70603e,0x705fbe,0x30fdf40,0x36fdf3f,0x3105f40,0x3705f3f,0x7020be,0x16fe0be,0x180fa040,0x186fa03f,0x1b0f9fc0,0x1b6f9fbf,0x3301f41,0x810a040,0x17060be,0x870a03f,0xb109fc0,0xb709fbf,0x3305f41,0x32fdf41,0x180fa0c0,0x196fa0bf,0x192fa041,0x1b2f9fc1,0x910a0c0,0x970a0bf,0x930a041,0xb309fc1,0x9302140,0x970213f,0x194fe140,
+	13,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0xfdfc0,0x106040,0x10603f,0x105fc0,0xfdfbf,0x105fbf,0x102041,0x1020c0,0x1020bf,0x101fc1,0xfe041,0xfe0c0,0x10fe0bf,0x1060c0,0x106041,0xfdfc1,0x105fc1,0x11060bf,0x1020c1,0x12fe0c1,0x13060c1,0x70203e,0x701fbe,0x3101f40,0x3701f3f,0x30fdf40,0x30fdf3f,0x6fe03e,0x36fdfbe,0x70603e,0x705fbe,0x3105f40,0x3705f3f,0x3101f41,0x180fa040,0x186fa03f,0x17020be,0x16fe0be,0x1b0f9fc0,0x1b6f9fbf,0x32fdf41,0x3305f41,0x810a040,0x870a03f,0xb109fc0,0xb709fbf,0x17060be,0x190fa0c0,0x192fa041,0x1b2f9fc1,0x196fa0bf,0x11502140,0x910a0c0,0x930a041,0xb309fc1,0x11302042,0x13301fc2,0x970a0bf,
+	14,0x101fc0,0x10203f,0x101fbf,0xfe040,0xfdfc0,0x106040,0x105fc0,0xfe03f,0xfdfbf,0x10603f,0x102041,0x101fc1,0x105fbf,0x1020c0,0x1020bf,0xfe041,0xfdfc1,0x106041,0xfe0c0,0x1060c0,0x105fc1,0x10fe0bf,0x11060bf,0x1020c1,0x12fe0c1,0x13060c1,0x3101f40,0x3101f3f,0x70203e,0x3701fbe,0x30fdf40,0x30fdf3f,0x3105f40,0x3105f3f,0x6fe03e,0x36fdfbe,0x70603e,0x3705fbe,0x3101f41,0x180fa040,0x1b0f9fc0,0x186fa03f,0x1b6f9fbf,0x32fdf41,0x3305f41,0x810a040,0xb109fc0,0x17020be,0x16fe0be,0x870a03f,0xb709fbf,0x17060be,0x182fa041,0x1b2f9fc1,0x192fa0c0,0x196fa0bf,0x11302042,0x13301fc2,0x830a041,0xb309fc1,0x930a0c0,0x970a0bf,0x11502140,
+	13,0x101fc0,0x10203f,0xfe040,0x101fbf,0x106040,0xfdfc0,0x102041,0x105fc0,0xfe03f,0xfdfbf,0x101fc1,0x10603f,0x105fbf,0x11020c0,0xfe041,0xfdfc1,0x106041,0x105fc1,0x11020bf,0x10fe0c0,0x11060c0,0x11020c1,0x10fe0bf,0x11060bf,0x10fe0c1,0x11060c1,0x3101f40,0x3101f3f,0x30fdf40,0x3105f40,0x3101f41,0x30fdf3f,0x70203e,0x3701fbe,0x3105f3f,0x6fe03e,0x180fa040,0x1b0f9fc0,0x32fdf41,0x3305f41,0x70603e,0x3705fbe,0x36fdfbe,0x186fa03f,0x1b6f9fbf,0x810a040,0xb109fc0,0x870a03f,0x17020be,0x180fa041,0x1b2f9fc1,0x1302042,0x3301fc2,0xb709fbf,0x810a041,0xb309fc1,0xa306042,0x1a2fe042,0x194fa0c0,0x196fe0be,0x17060be,0x930a0c0,0x970a0bf,
+	12,0x101fc0,0x10203f,0xfe040,0x102041,0x106040,0x101fbf,0xfdfc0,0x101fc1,0x105fc0,0xfe03f,0xfdfbf,0x10603f,0x11020c0,0xfe041,0xfdfc1,0x106041,0x105fbf,0x105fc1,0x11020bf,0x10fe0c0,0x11020c1,0x11060c0,0x10fe0bf,0x11060bf,0x10fe0c1,0x11060c1,0x3101f40,0x3101f3f,0x30fdf40,0x3101f41,0x3105f40,0x3105f3f,0x30fdf3f,0x30fdf41,0x180fa040,0x1b0f9fc0,0x70203e,0x3701fbe,0x3105f41,0x1302042,0x3301fc2,0x910a040,0xb109fc0,0x70603e,0x6fe03e,0x186fa03f,0x1b0f9fbf,0x1b6fdfbe,0x3705fbe,0x970a03f,0xb709fbf,0x180fa041,0x1b0f9fc1,0x192fe042,0x1b2fdfc2,0x1306042,0x930a041,0xb109fc1,0xb305fc2,0x192fa0c0,0x97020be,0x16fe0be,0x196fa0bf,
+	17,0x10203f,0x101fbf,0x101fc0,0xfe040,0xfe03f,0x10603f,0x106040,0xfdfc0,0xfdfbf,0x105fbf,0x105fc0,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x1060c0,0x1060bf,0x302041,0x301fc1,0x70203e,0x701fbe,0x2fe041,0x306041,0x2fdfc1,0x6fe03e,0x70603e,0x305fc1,0x3020c1,0x6fdfbe,0x705fbe,0x7020be,0x2fe0c1,0x3060c1,0x6fe0be,0x7060be,0x3101f3f,0x3101f40,0x30fdf40,0x30fdf3f,0x3105f3f,0x3105f40,0x182fa040,0x186fa03f,0x1b6f9fbf,0x1b2f9fc0,0x830a040,0x870a03f,0xb709fbf,0xb309fc0,0x182fa0c0,0x186fa0bf,0x170213f,0x1302140,0x830a0c0,0x870a0bf,0xb301f41,0x1b2fdf41,0xb701f3e,0x1b6fdf3e,0x196fe13f,0x192fe140,0x9306140,0x970613f,
+	17,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0x106040,0x10603f,0xfdfc0,0xfdfbf,0x105fc0,0x105fbf,0x1020c0,0x1020bf,0xfe0bf,0xfe0c0,0x1060c0,0x1060bf,0x302041,0x301fc1,0x2fe041,0x306041,0x2fdfc1,0x305fc1,0x70203e,0x701fbe,0x3020c1,0x2fe0c1,0x6fe03e,0x70603e,0x6fdfbe,0x705fbe,0x3060c1,0x7020be,0x6fe0be,0x3101f3f,0x3101f40,0x30fdf40,0x30fdf3f,0x7060be,0x3105f3f,0x3105f40,0x182fa040,0x186fa03f,0x1b6f9fbf,0x1b2f9fc0,0x830a040,0x870a03f,0xb709fbf,0xb309fc0,0x3301f41,0x182fa0c0,0x186fa0bf,0x170213f,0x1302140,0x830a0c0,0x870a0bf,0x970613f,0x9306140,0x192fe140,0x196fe13f,0x1b2fdf41,0xb305f41,0x13701f3e,
+	16,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0x106040,0x10603f,0xfdfc0,0xfdfbf,0x105fc0,0x105fbf,0x1020c0,0x1020bf,0xfe0c0,0xfe0bf,0x1060c0,0x302041,0x1060bf,0x301fc1,0x2fe041,0x306041,0x2fdfc1,0x305fc1,0x3020c1,0x2fe0c1,0x70203e,0x701fbe,0x3060c1,0x6fe03e,0x70603e,0x705fbe,0x6fdfbe,0x7020be,0x3101f40,0x3701f3f,0x30fdf40,0x36fdf3f,0x6fe0be,0x17060be,0x3705f3f,0x3105f40,0x180fa040,0x186fa03f,0x1b6f9fbf,0x1b0f9fc0,0x830a040,0x870a03f,0xb709fbf,0xb309fc0,0x3301f41,0x32fdf41,0x180fa0c0,0x186fa0bf,0x1302140,0x170213f,0x830a0c0,0x970a0bf,0xb305f41,0x192fa041,0x1b2f9fc1,0x192fe140,0x196fe13f,0x9506140,
+	13,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0x106040,0x10603f,0xfdfc0,0xfdfbf,0x105fc0,0x105fbf,0x1020c0,0x1020bf,0x302041,0xfe0c0,0xfe0bf,0x1060c0,0x1060bf,0x301fc1,0x2fe041,0x306041,0x2fdfc1,0x305fc1,0x3020c1,0x2fe0c1,0x3060c1,0x70203e,0x701fbe,0x6fe03e,0x70603e,0x705fbe,0x6fdfbe,0x3101f40,0x3701f3f,0x7020be,0x6fe0be,0x30fdf40,0x36fdf3f,0x3105f40,0x3705f3f,0x180fa040,0x186fa03f,0x1b0f9fc0,0x1b6f9fbf,0x17060be,0x830a040,0x870a03f,0xb309fc0,0x3301f41,0x32fdf41,0xb709fbf,0xb305f41,0x180fa0c0,0x186fa0bf,0x1302140,0x170213f,0x830a0c0,0x970a0bf,0x192fa041,0x1b2f9fc1,0x192fe140,0x196fe13f,0x9506140,
+	14,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0x106040,0x10603f,0xfdfc0,0xfdfbf,0x105fc0,0x1020c0,0x1020bf,0x105fbf,0x102041,0x101fc1,0xfe0c0,0xfe0bf,0x1060c0,0xfe041,0x106041,0x1060bf,0x2fdfc1,0x305fc1,0x1020c1,0x12fe0c1,0x13060c1,0x70203e,0x701fbe,0x3101f40,0x3701f3f,0x6fe03e,0x6fdfbe,0x70603e,0x705fbe,0x30fdf40,0x36fdf3f,0x3105f40,0x3705f3f,0x7020be,0x180fa040,0x186fa03f,0x1b0f9fc0,0x1b6f9fbf,0x16fe0be,0x17060be,0x810a040,0x870a03f,0x3301f41,0x32fdf41,0xb109fc0,0xb709fbf,0x3305f41,0x190fa0c0,0x196fa0bf,0x192fa041,0x1b2f9fc1,0x11302140,0x1170213f,0x910a0c0,0x970a0bf,0x930a041,0xb309fc1,0x12302042,
+	14,0x10203f,0x101fc0,0xfe040,0x101fbf,0x106040,0xfe03f,0xfdfc0,0x105fc0,0x10603f,0x1020c0,0x102041,0xfdfbf,0x105fbf,0x1020bf,0x101fc1,0xfe041,0xfe0c0,0x1060c0,0x106041,0x2fdfc1,0xfe0bf,0x1060bf,0x305fc1,0x1020c1,0x12fe0c1,0x13060c1,0x70203e,0x3101f40,0x3101f3f,0x3701fbe,0x6fe03e,0x30fdf40,0x30fdf3f,0x3105f40,0x70603e,0x705fbe,0x36fdfbe,0x180fa040,0x186fa03f,0x1b0f9fc0,0x3301f41,0x3705f3f,0x7020be,0x16fe0be,0x1b6f9fbf,0x810a040,0xb109fc0,0x870a03f,0x17060be,0xb709fbf,0x3305f41,0x32fdf41,0x182fa041,0x192fa0c0,0x196fa0bf,0x1b2f9fc1,0x12302042,0x830a041,0x930a0c0,0x11302140,0x1170213f,0x970a0bf,0xb309fc1,
+	15,0x101fc0,0x10203f,0xfe040,0x101fbf,0x106040,0x102041,0xfdfc0,0xfe03f,0x105fc0,0x10603f,0x1020c0,0x101fc1,0xfdfbf,0x105fbf,0xfe041,0x1020bf,0xfe0c0,0x106041,0x1060c0,0xfdfc1,0x105fc1,0x1020c1,0x10fe0bf,0x11060bf,0x10fe0c1,0x11060c1,0x3101f40,0x3101f3f,0x70203e,0x3701fbe,0x30fdf40,0x3105f40,0x3101f41,0x30fdf3f,0x180fa040,0x6fe03e,0x36fdfbe,0x70603e,0x3105f3f,0x3705fbe,0x810a040,0xb109fc0,0x1b0f9fc0,0x186fa03f,0x1b6f9fbf,0x32fdf41,0x3305f41,0x17020be,0x870a03f,0xb709fbf,0x1302042,0x180fa041,0x194fa0c0,0x1b2f9fc1,0x3301fc2,0x1a2fe042,0x196fe0be,0x97060be,0x11502140,0x810a041,0x950a0c0,0xb309fc1,0xa306042,
+	16,0x101fc0,0x10203f,0xfe040,0x102041,0x106040,0x101fbf,0xfdfc0,0x101fc1,0x105fc0,0x1020c0,0xfe03f,0x10603f,0xfe041,0x106041,0xfdfbf,0x105fbf,0xfdfc1,0xfe0c0,0x1020bf,0x1060c0,0x105fc1,0x1020c1,0x10fe0bf,0x11060bf,0x10fe0c1,0x11060c1,0x3101f40,0x3101f3f,0x30fdf40,0x3101f41,0x3105f40,0x70203e,0x180fa040,0x1b0f9fc0,0x30fdf3f,0x3701fbe,0x3105f3f,0x32fdf41,0x3305f41,0x1302042,0x810a040,0xb109fc0,0x70603e,0x6fe03e,0x186fa03f,0x1b0f9fbf,0x180fa041,0x3301fc2,0x1a2fe042,0x1b2f9fc1,0x1b6fdfbe,0x3705fbe,0x870a03f,0x97020be,0x192fa0c0,0x190fa0bf,0x196fe0be,0x11502140,0x2306042,0x830a041,0xb309fc1,0xb709fbf,0x950a0c0,
+	17,0x10203f,0x101fbf,0x101fc0,0xfe040,0xfe03f,0x10603f,0x106040,0x1020c0,0x1020bf,0xfdfbf,0xfdfc0,0x105fc0,0x105fbf,0xfe0bf,0xfe0c0,0x1060c0,0x1060bf,0x302041,0x301fc1,0x70203e,0x701fbe,0x2fe041,0x306041,0x3020c1,0x2fdfc1,0x6fe03e,0x70603e,0x7020be,0x6fdfbe,0x305fc1,0x2fe0c1,0x3060c1,0x705fbe,0x6fe0be,0x7060be,0x3701f3f,0x3101f40,0x30fdf40,0x36fdf3f,0x186fa03f,0x180fa040,0x1b0f9fc0,0x1b6f9fbf,0x3705f3f,0x3105f40,0x830a040,0x870a03f,0xb709fbf,0xb309fc0,0x1302140,0x170213f,0x186fa0bf,0x180fa0c0,0x192fe140,0x196fe13f,0x870a0bf,0x830a0c0,0x9306140,0x970613f,0xb301f41,0x32fdf41,0x192fa041,0x1b2f9fc1,
+	17,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0x106040,0x10603f,0x1020c0,0x1020bf,0xfdfc0,0xfdfbf,0x105fc0,0x105fbf,0xfe0c0,0xfe0bf,0x1060c0,0x1060bf,0x302041,0x301fc1,0x2fe041,0x306041,0x3020c1,0x2fdfc1,0x70203e,0x701fbe,0x305fc1,0x2fe0c1,0x3060c1,0x6fe03e,0x70603e,0x7020be,0x6fdfbe,0x705fbe,0x6fe0be,0x7060be,0x3701f3f,0x3101f40,0x30fdf40,0x36fdf3f,0x186fa03f,0x180fa040,0x1b0f9fc0,0x1b6f9fbf,0x3705f3f,0x3105f40,0x830a040,0x870a03f,0xb709fbf,0xb309fc0,0x1302140,0x170213f,0x186fa0bf,0x180fa0c0,0x192fe140,0x196fe13f,0x870a0bf,0x830a0c0,0x9306140,0x970613f,0xb301f41,0x32fdf41,0x192fa041,0x1b2f9fc1,
+	17,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0x106040,0x10603f,0x1020c0,0x1020bf,0xfdfc0,0xfdfbf,0x105fc0,0x105fbf,0xfe0c0,0xfe0bf,0x1060c0,0x1060bf,0x302041,0x301fc1,0x2fe041,0x306041,0x3020c1,0x2fdfc1,0x305fc1,0x2fe0c1,0x3060c1,0x70203e,0x701fbe,0x6fe03e,0x70603e,0x7020be,0x6fdfbe,0x705fbe,0x6fe0be,0x7060be,0x3101f40,0x3701f3f,0x36fdf3f,0x30fdf40,0x180fa040,0x186fa03f,0x1b6f9fbf,0x1b0f9fc0,0x3105f40,0x3705f3f,0x830a040,0x870a03f,0xb709fbf,0xb309fc0,0x1302140,0x170213f,0x180fa0c0,0x186fa0bf,0x192fe140,0x196fe13f,0x830a0c0,0x870a0bf,0x9306140,0x970613f,0xb301f41,0x32fdf41,0x192fa041,0x1b2f9fc1,
+	15,0x10203f,0x101fc0,0x101fbf,0xfe040,0xfe03f,0x106040,0x10603f,0x1020c0,0x1020bf,0xfdfc0,0xfdfbf,0x105fc0,0x105fbf,0xfe0c0,0xfe0bf,0x302041,0x1060c0,0x1060bf,0x301fc1,0x2fe041,0x306041,0x3020c1,0x2fdfc1,0x305fc1,0x2fe0c1,0x3060c1,0x70203e,0x701fbe,0x6fe03e,0x70603e,0x7020be,0x6fdfbe,0x705fbe,0x3101f40,0x3701f3f,0x6fe0be,0x7060be,0x180fa040,0x186fa03f,0x30fdf40,0x36fdf3f,0x3105f40,0x3705f3f,0x810a040,0x870a03f,0x1b0f9fc0,0x1b6f9fbf,0x180fa0c0,0x186fa0bf,0x1302140,0x170213f,0xb109fc0,0xb709fbf,0xb301f41,0x1b2fdf41,0x1a2fa041,0x192fe140,0x196fe13f,0x810a0c0,0x870a0bf,0x9306140,0x970613f,0xa30a041,
+	13,0x10203f,0x101fc0,0xfe040,0x101fbf,0x106040,0xfe03f,0x1020c0,0x10603f,0xfdfc0,0xfdfbf,0x1020bf,0x105fc0,0x105fbf,0x302041,0xfe0c0,0xfe0bf,0x1060c0,0x1060bf,0x301fc1,0x2fe041,0x306041,0x3020c1,0x2fdfc1,0x305fc1,0x2fe0c1,0x3060c1,0x70203e,0x701fbe,0x6fe03e,0x70603e,0x7020be,0x6fdfbe,0x3101f40,0x3701f3f,0x705fbe,0x30fdf40,0x180fa040,0x186fa03f,0x16fe0be,0x17060be,0x3105f40,0x3705f3f,0x36fdf3f,0x1b0f9fc0,0x1b6f9fbf,0x810a040,0x870a03f,0xb109fc0,0x3301f41,0x180fa0c0,0x196fa0bf,0x1302140,0x170213f,0xb709fbf,0x810a0c0,0x970a0bf,0x9506140,0x194fe140,0x1a2fa041,0x1b2fdf41,0x3305f41,0x930a041,0xb309fc1,
+	15,0x10203f,0x101fc0,0xfe040,0x101fbf,0x106040,0x1020c0,0xfe03f,0xfdfc0,0x10603f,0x105fc0,0x102041,0x1020bf,0xfdfbf,0x105fbf,0xfe0c0,0x101fc1,0xfe041,0x1060c0,0x106041,0xfe0bf,0x1060bf,0x1020c1,0x2fdfc1,0x305fc1,0x2fe0c1,0x3060c1,0x70203e,0x701fbe,0x3101f40,0x3701f3f,0x6fe03e,0x70603e,0x7020be,0x6fdfbe,0x180fa040,0x30fdf40,0x36fdf3f,0x3105f40,0x705fbe,0x3705f3f,0x810a040,0x870a03f,0x186fa03f,0x1b0f9fc0,0x1b6f9fbf,0x16fe0be,0x17060be,0x3301f41,0xb109fc0,0xb709fbf,0x1302140,0x180fa0c0,0x1a2fa041,0x196fa0bf,0x170213f,0x194fe140,0x1b2fdf41,0xb305f41,0x12302042,0x810a0c0,0xa30a041,0x970a0bf,0x9506140,
+	13,0x10203f,0x101fc0,0xfe040,0x106040,0x101fbf,0x102041,0x1020c0,0xfe03f,0xfdfc0,0x105fc0,0x10603f,0x1020bf,0x101fc1,0xfe041,0xfe0c0,0xfdfbf,0x105fbf,0x106041,0x1060c0,0x1020c1,0xfe0bf,0xfdfc1,0x105fc1,0x1060bf,0x2fe0c1,0x13060c1,0x70203e,0x3101f40,0x3101f3f,0x3701fbe,0x6fe03e,0x180fa040,0x30fdf40,0x3105f40,0x3101f41,0x1b0f9fc0,0x186fa03f,0x70603e,0x7020be,0x6fdfbe,0x36fdf3f,0x3105f3f,0x810a040,0xb109fc0,0x3705fbe,0x870a03f,0x97060be,0x16fe0be,0x1b6f9fbf,0x182fa041,0x182fa0c0,0x9302140,0x11302042,0x32fdf41,0xb305f41,0x13301fc2,0x1b2f9fc1,0x196fa0bf,0x970213f,0x194fe140,0x970a0c0,0xa30a041,0xb709fbf,
+	13,0x101fc0,0x10203f,0xfe040,0x102041,0x106040,0x1020c0,0x101fbf,0xfdfc0,0xfe03f,0x101fc1,0x105fc0,0x10603f,0xfe041,0xfe0c0,0x1020bf,0x106041,0x1020c1,0x1060c0,0xfdfbf,0x105fbf,0xfdfc1,0x105fc1,0x10fe0bf,0x11060bf,0x10fe0c1,0x11060c1,0x3101f40,0x3101f3f,0x30fdf40,0x180fa040,0x70203e,0x3701fbe,0x3105f40,0x3101f41,0x1b0f9fc0,0x180fa03f,0x186fe03e,0x30fdf3f,0x302042,0x810a040,0xb109fc0,0x3105f3f,0x70603e,0x117020be,0x180fa041,0x194fa0c0,0x11502140,0x3301fc2,0x32fdf41,0x3105f41,0x870a03f,0x3705fbe,0x36fdfbe,0x1b6f9fbf,0x1b2f9fc1,0x1b2fe042,0x306042,0x830a041,0x950a0c0,0xb709fbf,0xb109fc1,0xb305fc2,0x113020c2,
+	17,0x10203f,0x101fbf,0x101fc0,0xfe040,0xfe03f,0x1020bf,0x1020c0,0x106040,0x10603f,0xfdfbf,0xfdfc0,0x105fc0,0x105fbf,0xfe0bf,0xfe0c0,0x1060c0,0x1060bf,0x302041,0x70203e,0x301fc1,0x2fe041,0x3020c1,0x306041,0x701fbe,0x6fe03e,0x7020be,0x70603e,0x2fdfc1,0x305fc1,0x2fe0c1,0x3060c1,0x6fdfbe,0x705fbe,0x6fe0be,0x7060be,0x3701f3f,0x3101f40,0x180fa040,0x186fa03f,0x186f9fbf,0x180f9fc0,0x1b0fdf40,0x1b6fdf3f,0x3705f3f,0x870a03f,0x830a040,0x1302140,0x170213f,0x186fa0bf,0x180fa0c0,0x192fe140,0x196fe13f,0x3105f40,0xb309fc0,0xb709fbf,0x870a0bf,0x830a0c0,0x9306140,0x970613f,0x192fa041,0xb301f41,0x32fdf41,0x1b2f9fc1,
+	17,0x10203f,0x101fc0,0xfe040,0xfe03f,0x101fbf,0x106040,0x10603f,0x1020c0,0x1020bf,0xfdfc0,0xfdfbf,0x105fc0,0x105fbf,0xfe0c0,0xfe0bf,0x1060c0,0x1060bf,0x302041,0x301fc1,0x2fe041,0x3020c1,0x306041,0x70203e,0x2fdfc1,0x305fc1,0x2fe0c1,0x3060c1,0x6fe03e,0x701fbe,0x70603e,0x7020be,0x6fe0be,0x6fdfbe,0x705fbe,0x7060be,0x186fa03f,0x180fa040,0x3101f40,0x3701f3f,0x36fdf3f,0x30fdf40,0x1b0f9fc0,0x1b6f9fbf,0x186fa0bf,0x170213f,0x1302140,0x830a040,0x870a03f,0x3705f3f,0x3105f40,0xb309fc0,0xb709fbf,0x180fa0c0,0x192fe140,0x196fe13f,0x170613f,0x1306140,0x930a0c0,0x970a0bf,0xb301f41,0x192fa041,0x182f9fc1,0x1b2fdf41,
+	17,0x10203f,0x101fc0,0xfe040,0xfe03f,0x101fbf,0x106040,0x1020c0,0x1020bf,0x10603f,0xfdfc0,0xfdfbf,0x105fc0,0x105fbf,0xfe0c0,0xfe0bf,0x1060c0,0x1060bf,0x302041,0x301fc1,0x2fe041,0x3020c1,0x306041,0x2fdfc1,0x305fc1,0x2fe0c1,0x3060c1,0x70203e,0x6fe03e,0x701fbe,0x70603e,0x7020be,0x6fe0be,0x6fdfbe,0x705fbe,0x7060be,0x186fa03f,0x180fa040,0x3101f40,0x3701f3f,0x36fdf3f,0x30fdf40,0x1b0f9fc0,0x1b6f9fbf,0x1302140,0x170213f,0x830a040,0x870a03f,0x3105f40,0x3705f3f,0xb309fc0,0xb709fbf,0x180fa0c0,0x186fa0bf,0x192fe140,0x196fe13f,0x1306140,0x170613f,0x930a0c0,0x970a0bf,0xb301f41,0x192fa041,0x182f9fc1,0x1b2fdf41,
+	17,0x10203f,0x101fc0,0xfe040,0xfe03f,0x101fbf,0x106040,0x1020c0,0x1020bf,0x10603f,0xfdfc0,0xfdfbf,0x105fc0,0x105fbf,0xfe0c0,0xfe0bf,0x1060c0,0x1060bf,0x302041,0x301fc1,0x2fe041,0x3020c1,0x306041,0x2fdfc1,0x305fc1,0x2fe0c1,0x3060c1,0x70203e,0x6fe03e,0x701fbe,0x70603e,0x7020be,0x6fe0be,0x6fdfbe,0x705fbe,0x7060be,0x3101f40,0x3701f3f,0x180fa040,0x186fa03f,0x180f9fc0,0x1b0fdf40,0x36fdf3f,0x1b6f9fbf,0x1302140,0x170213f,0x830a040,0x870a03f,0x3105f40,0x3705f3f,0xb309fc0,0xb709fbf,0x180fa0c0,0x186fa0bf,0x192fe140,0x196fe13f,0x1306140,0x930a0c0,0x870a0bf,0x970613f,0x192fa041,0xb301f41,0x32fdf41,0x1b2f9fc1,
+	12,0x10203f,0x101fc0,0xfe040,0x1020c0,0x106040,0x101fbf,0xfe03f,0x1020bf,0x10603f,0xfdfc0,0xfdfbf,0x105fc0,0x302041,0xfe0c0,0xfe0bf,0x1060c0,0x105fbf,0x1060bf,0x301fc1,0x2fe041,0x3020c1,0x306041,0x2fdfc1,0x305fc1,0x2fe0c1,0x3060c1,0x70203e,0x701fbe,0x6fe03e,0x7020be,0x70603e,0x705fbe,0x6fdfbe,0x6fe0be,0x180fa040,0x186fa03f,0x3101f40,0x3701f3f,0x7060be,0x1302140,0x170213f,0x830a040,0x870a03f,0x3105f40,0x30fdf40,0x1b0f9fc0,0x186f9fbf,0x1b6fdf3f,0x3705f3f,0xb309fc0,0xb709fbf,0x180fa0c0,0x186fa0bf,0x192fe140,0x196fe13f,0x1306140,0x930a0c0,0x870a0bf,0x970613f,0x192fa041,0xb301f41,0x32fdf41,0x1b2f9fc1,
+	16,0x10203f,0x101fc0,0xfe040,0x1020c0,0x106040,0x101fbf,0xfe03f,0x1020bf,0x10603f,0x102041,0xfdfc0,0x105fc0,0xfe0c0,0x1060c0,0xfdfbf,0x105fbf,0xfe0bf,0xfe041,0x101fc1,0x106041,0x1060bf,0x1020c1,0x2fdfc1,0x305fc1,0x2fe0c1,0x3060c1,0x70203e,0x701fbe,0x6fe03e,0x7020be,0x70603e,0x3101f40,0x180fa040,0x186fa03f,0x6fdfbe,0x3701f3f,0x705fbe,0x16fe0be,0x17060be,0x1302140,0x810a040,0x870a03f,0x3105f40,0x30fdf40,0x1b0f9fc0,0x186f9fbf,0x180fa0c0,0x170213f,0x194fe140,0x196fa0bf,0x1b6fdf3f,0x3705f3f,0xb109fc0,0xb301f41,0x192fa041,0x182f9fc1,0x1b2fdf41,0x12302042,0x1506140,0x910a0c0,0x970a0bf,0xb709fbf,0xa30a041,
+	13,0x10203f,0x101fc0,0xfe040,0x1020c0,0x106040,0x102041,0x101fbf,0xfe03f,0xfdfc0,0x1020bf,0x10603f,0x105fc0,0xfe0c0,0xfe041,0x101fc1,0x1060c0,0x1020c1,0x106041,0xfdfbf,0x105fbf,0xfe0bf,0x1060bf,0x2fdfc1,0x305fc1,0x2fe0c1,0x3060c1,0x70203e,0x701fbe,0x6fe03e,0x180fa040,0x3101f40,0x3701f3f,0x70603e,0x7020be,0x186fa03f,0x180f9fc0,0x1b0fdf40,0x6fdfbe,0x1102140,0x810a040,0x870a03f,0x705fbe,0x3105f40,0x13301f41,0x180fa0c0,0x1a2fa041,0x12302042,0x170213f,0x16fe0be,0x7060be,0xb109fc0,0x3705f3f,0x36fdf3f,0x1b6f9fbf,0x196fa0bf,0x196fe140,0x1106140,0x910a0c0,0xa30a041,0xb709fbf,0x870a0bf,0x970613f,0x11302141,
+	19,0x10203f,0x101fc0,0xfe040,0x102041,0x1020c0,0x106040,0x101fbf,0xfe03f,0xfdfc0,0x101fc1,0x105fc0,0x10603f,0x1020bf,0xfe0c0,0xfe041,0x1020c1,0x106041,0x1060c0,0xfdfbf,0x105fbf,0xfe0bf,0xfdfc1,0x105fc1,0x1060bf,0xfe0c1,0x1060c1,0x70203e,0x3101f40,0x180fa040,0x180fa03f,0x186fe03e,0x701fbe,0x3701f3f,0x30fdf40,0x1b0f9fc0,0x1b0fa041,0x302042,0x1102140,0x810a040,0x3705f40,0x13101f41,0x3301fc2,0x1b2fe042,0x182fa0c0,0x7020be,0x70603e,0x870a03f,0xb709fc0,0xb10a041,0xb306042,0x103020c2,0x1302141,0x192fe140,0x1970213f,0x1506140,0x950a0c0,0xb705fbe,0x6fdfbe,0x36fdf3f,0x1b6f9fbf,0x190fa0bf,0x196fe0be,0x97060be
+};
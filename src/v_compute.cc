@@ -7,27 +7,67 @@
 /** \file v_compute.cc
  * \brief Function implementantions for the voro_compute template. */
 
+#include <algorithm>
+
 #include "worklist.hh"
 #include "v_compute.hh"
 #include "rad_option.hh"
 #include "container.hh"
 #include "container_prd.hh"
+#include "trace.hh"
 
 namespace voro {
 
 /** The class constructor initializes constants from the container class, and
- * sets up the mask and queue used for Voronoi computations.
+ * sets up the mask and queue used for Voronoi computations. If the default
+ * worklists are selected, then the container's worklists are used, which may
+ * have been generated for its block geometry.
  * \param[in] con_ a reference to the container class to use.
  * \param[in] (hx_,hy_,hz_) the size of the mask to use. */
-template<class c_class>
-voro_compute<c_class>::voro_compute(c_class &con_,int hx_,int hy_,int hz_) :
+template<class c_class,class w_class>
+voro_compute<c_class,w_class>::voro_compute(c_class &con_,int hx_,int hy_,int hz_) :
 	con(con_), boxx(con_.boxx), boxy(con_.boxy), boxz(con_.boxz),
 	xsp(con_.xsp), ysp(con_.ysp), zsp(con_.zsp),
 	hx(hx_), hy(hy_), hz(hz_), hxy(hx_*hy_), hxyz(hxy*hz_), ps(con_.ps),
 	id(con_.id), p(con_.p), co(con_.co), bxsq(boxx*boxx+boxy*boxy+boxz*boxz),
-	mv(0), qu_size(3*(3+hxy+hz*(hx+hy))), wl(con_.wl), mrad(con_.mrad),
-	mask(new unsigned int[hxyz]), qu(new int[qu_size]), qu_l(qu+qu_size) {
+	mv(0), qu_size(3*(3+hxy+hz*(hx+hy))), wl(&w_class::wl[0]==&worklist_default::wl[0]?con_.wl:w_class::wl),
+	mrad(wl==con_.wl?con_.mrad:new double[w_class::seq_length*w_class::hgridcu]),
+	mask(new unsigned int[hxyz]), qu(new int[qu_size]), qu_l(qu+qu_size),
+	wsp(NULL), wse(NULL), bru(con_.update_count), bmg(1), lb(false),
+	rx((con_.nx+empty_region_blocks-1)/empty_region_blocks),
+	ry((con_.ny+empty_region_blocks-1)/empty_region_blocks), rcu(0), rsp(false) {
+	if(mrad!=con.mrad) con.worklist_radii(wl,w_class::hgrid,w_class::seq_length,mrad);
 	reset_mask();
+	lbd=boxx<boxy?boxx:boxy;
+	if(boxz<lbd) lbd=boxz;
+	lbd*=local_radius_blocks;lbd*=lbd;
+}
+
+/** Computes the largest particle radius in the blocks that are within
+ * local_radius_blocks of a given block in each direction, storing it the first
+ * time that the block is considered. Any block outside this neighborhood is at
+ * least a distance of sqrt(lbd) from a particle in the given block.
+ * \param[in] ijk the block to consider.
+ * \param[in] (ci,cj,ck) the coordinates of the block relative to the
+ *			 container.
+ * \param[in] (i,j,k) the coordinates of the block relative to the mask.
+ * \param[in] disp a block displacement set by the container.
+ * \return The largest radius. */
+template<class c_class,class w_class>
+double voro_compute<c_class,w_class>::local_max_radius(int ijk,int ci,int cj,int ck,int i,int j,int k,int disp) {
+	block_max_radius(ijk);	// Discards the stored radii if they are stale
+	if(ijk>=(int) blv.size()) {blv.resize(ijk+1,0);blr.resize(ijk+1);}
+	if(blv[ijk]==bmg) return blr[ijk];
+	const int w=local_radius_blocks;
+	double lr=0,r,qx,qy,qz;
+	for(int ek=k-w;ek<=k+w;ek++) if(ek>=0&&ek<hz)
+		for(int ej=j-w;ej<=j+w;ej++) if(ej>=0&&ej<hy)
+			for(int ei=i-w;ei<=i+w;ei++) if(ei>=0&&ei<hx) {
+				r=block_max_radius(con.region_index(ci,cj,ck,ei,ej,ek,qx,qy,qz,disp));
+				if(r>lr) lr=r;
+			}
+	blv[ijk]=bmg;
+	return blr[ijk]=lr;
 }
 
 /** Scans all of the particles within a block to see if any of them have a
@@ -43,8 +83,8 @@ voro_compute<c_class>::voro_compute(c_class &con_,int hx_,int hy_,int hz_) :
  *		    vector is within.
  * \param[in,out] mrs the current minimum distance, that may be updated if a
  * 		      closer particle is found. */
-template<class c_class>
-inline void voro_compute<c_class>::scan_all(int ijk,double x,double y,double z,int di,int dj,int dk,particle_record &w,double &mrs) {
+template<class c_class,class w_class>
+inline void voro_compute<c_class,w_class>::scan_all(int ijk,double x,double y,double z,int di,int dj,int dk,particle_record &w,double &mrs) {
 	double x1,y1,z1,rs;bool in_block=false;
 	for(int l=0;l<co[ijk];l++) {
 		x1=p[ijk][ps*l]-x;
@@ -64,21 +104,32 @@ inline void voro_compute<c_class>::scan_all(int ijk,double x,double y,double z,i
  * \param[in] (ci,cj,ck) the coordinates of the block that the test particle is
  *                       in relative to the container data structure.
  * \param[in] ijk the index of the block that the test particle is in.
- * \param[out] w a reference to a particle record in which to store information
- * 		 about the particle whose Voronoi cell the vector is within.
- * \param[out] mrs the minimum computed distance. */
-template<class c_class>
-void voro_compute<c_class>::find_voronoi_cell(double x,double y,double z,int ci,int cj,int ck,int ijk,particle_record &w,double &mrs) {
+ * \param[in,out] w a reference to a particle record in which to store
+ *		    information about the particle whose Voronoi cell the
+ *		    vector is within.
+ * \param[out] mrs the minimum computed distance.
+ * \param[in] warm whether w holds the result of a previous search that
+ *		   started in the same block. If so, the particle in it is used
+ *		   as the initial estimate, so that blocks that are further away
+ *		   can be skipped sooner. */
+template<class c_class,class w_class>
+void voro_compute<c_class,w_class>::find_voronoi_cell(double x,double y,double z,int ci,int cj,int ck,int ijk,particle_record &w,double &mrs,bool warm) {
 	double qx=0,qy=0,qz=0,rs;
 	int i,j,k,di,dj,dk,ei,ej,ek,f,g,disp;
 	double fx,fy,fz,mxs,mys,mzs,*radp;
 	unsigned int q,*e,*mijk;
 
-	// Init setup for parameters to return
-	w.ijk=-1;mrs=large_number;
-
 	con.initialize_search(ci,cj,ck,ijk,i,j,k,disp);
 
+	// Init setup for parameters to return, starting from the previous
+	// result if one is available
+	if(warm&&w.ijk!=-1) {
+		int sijk=con.region_index(ci,cj,ck,w.di+i,w.dj+j,w.dk+k,qx,qy,qz,disp);
+		double x1=p[sijk][ps*w.l]-x+qx,y1=p[sijk][ps*w.l+1]-y+qy,z1=p[sijk][ps*w.l+2]-z+qz;
+		mrs=con.r_current_sub(x1*x1+y1*y1+z1*z1,sijk,w.l);
+		w.ijk=sijk;qx=qy=qz=0;
+	} else {w.ijk=-1;mrs=large_number;}
+
 	// Test all particles in the particle's local region first
 	scan_all(ijk,x,y,z,0,0,0,w,mrs);
 
@@ -87,7 +138,7 @@ void voro_compute<c_class>::find_voronoi_cell(double x,double y,double z,int ci,
 	// (di,dj,dk) of which subregion the particle is within.
 	unsigned int m1,m2;
 	con.frac_pos(x,y,z,ci,cj,ck,fx,fy,fz);
-	di=int(fx*xsp*wl_fgrid);dj=int(fy*ysp*wl_fgrid);dk=int(fz*zsp*wl_fgrid);
+	di=int(fx*xsp*w_class::fgrid);dj=int(fy*ysp*w_class::fgrid);dk=int(fz*zsp*w_class::fgrid);
 
 	// The indices (di,dj,dk) tell us which worklist to use, to test the
 	// blocks in the optimal order. But we only store worklists for the
@@ -96,17 +147,17 @@ void voro_compute<c_class>::find_voronoi_cell(double x,double y,double z,int ci,
 	// section, we detect for these cases, by reflecting high values of di,
 	// dj, and dk. For these cases, a mask is constructed in m1 and m2
 	// which is used to flip the worklist information when it is loaded.
-	if(di>=wl_hgrid) {
+	if(di>=w_class::hgrid) {
 		mxs=boxx-fx;
-		m1=127+(3<<21);m2=1+(1<<21);di=wl_fgrid-1-di;if(di<0) di=0;
+		m1=127+(3<<21);m2=1+(1<<21);di=w_class::fgrid-1-di;if(di<0) di=0;
 	} else {m1=m2=0;mxs=fx;}
-	if(dj>=wl_hgrid) {
+	if(dj>=w_class::hgrid) {
 		mys=boxy-fy;
-		m1|=(127<<7)+(3<<24);m2|=(1<<7)+(1<<24);dj=wl_fgrid-1-dj;if(dj<0) dj=0;
+		m1|=(127<<7)+(3<<24);m2|=(1<<7)+(1<<24);dj=w_class::fgrid-1-dj;if(dj<0) dj=0;
 	} else mys=fy;
-	if(dk>=wl_hgrid) {
+	if(dk>=w_class::hgrid) {
 		mzs=boxz-fz;
-		m1|=(127<<14)+(3<<27);m2|=(1<<14)+(1<<27);dk=wl_fgrid-1-dk;if(dk<0) dk=0;
+		m1|=(127<<14)+(3<<27);m2|=(1<<14)+(1<<27);dk=w_class::fgrid-1-dk;if(dk<0) dk=0;
 	} else mzs=fz;
 
 	// Do a quick test to account for the case when the minimum radius is
@@ -116,14 +167,15 @@ void voro_compute<c_class>::find_voronoi_cell(double x,double y,double z,int ci,
 
 	// Now compute which worklist we are going to use, and set radp and e to
 	// point at the right offsets
-	ijk=di+wl_hgrid*(dj+wl_hgrid*dk);
-	radp=mrad+ijk*wl_seq_length;
-	e=(const_cast<unsigned int*> (wl))+ijk*wl_seq_length;
+	ijk=di+w_class::hgrid*(dj+w_class::hgrid*dk);
+	radp=mrad+ijk*w_class::seq_length;
+	e=(const_cast<unsigned int*> (wl))+ijk*w_class::seq_length;
 
 	// Read in how many items in the worklist can be tested without having to
-	// worry about writing to the mask
+	// worry about writing to the mask. This can be zero for worklists that
+	// are generated for elongated blocks.
 	f=e[0];g=0;
-	do {
+	while(g<f) {
 
 		// If mrs is less than the minimum distance to any untested
 		// block, then we are done
@@ -159,14 +211,14 @@ void voro_compute<c_class>::find_voronoi_cell(double x,double y,double z,int ci,
 		// intersections. Otherwise, we do additional checks and skip
 		// those particles which can't possibly intersect the block.
 		scan_all(ijk,x-qx,y-qy,z-qz,di,dj,dk,w,mrs);
-	} while(g<f);
+	}
 
 	// Update mask value and initialize queue
 	mv++;
 	if(mv==0) {reset_mask();mv=1;}
 	int *qu_s=qu,*qu_e=qu;
 
-	while(g<wl_seq_length-1) {
+	while(g<w_class::seq_length-1) {
 
 		// If mrs is less than the minimum distance to any untested
 		// block, then we are done
@@ -227,13 +279,174 @@ void voro_compute<c_class>::find_voronoi_cell(double x,double y,double z,int ci,
 	}
 }
 
+/** Scans all of the particles within a block, and adds those that are within
+ * the current search radius to a list of neighbors. If a maximum number of
+ * neighbors is given, then the list is kept as a heap with the furthest
+ * neighbor at the top, and once it is full, the search radius is reduced to
+ * the distance of that neighbor.
+ * \param[in] ijk the index of the block.
+ * \param[in] (x,y,z) the test vector to consider (which may have already had a
+ *                    periodic displacement applied to it).
+ * \param[in] k the maximum number of neighbors, or a negative value if there
+ *		is no limit.
+ * \param[in,out] nr the list of neighbors.
+ * \param[in,out] mrs the current search radius squared, which may be reduced
+ *		      if a maximum number of neighbors is given. */
+template<class c_class,class w_class>
+inline void voro_compute<c_class,w_class>::scan_neighbors(int ijk,double x,double y,double z,int k,std::vector<neighbor_record> &nr,double &mrs) {
+	neighbor_record r;
+	fpoint *pp=p[ijk];
+	for(int l=0;l<co[ijk];l++,pp+=ps) {
+		r.x=*pp-x;r.y=pp[1]-y;r.z=pp[2]-z;
+		r.rs=r.x*r.x+r.y*r.y+r.z*r.z;
+		if(r.rs>mrs) continue;
+		r.ijk=ijk;r.l=l;
+		nr.push_back(r);
+		if(k<0) continue;
+		std::push_heap(nr.begin(),nr.end());
+		if(int(nr.size())>k) {std::pop_heap(nr.begin(),nr.end());nr.pop_back();}
+		if(int(nr.size())==k) mrs=nr[0].rs;
+	}
+}
+
+/** Finds the particles that are near to a given vector, either the k nearest
+ * ones, or all of those within a given distance, or the k nearest ones within
+ * a given distance. The blocks are searched in the same order as in the
+ * find_voronoi_cell() routine, using the worklists and the mask, and the
+ * search stops once every untested block is further away than the search
+ * radius, which for a k-nearest-neighbor search is the distance to the kth
+ * nearest particle found so far. The particle radii of the radical Voronoi
+ * containers are not used, and the distances are the usual Euclidean ones. In
+ * the periodic containers, a particle can be found several times if the
+ * search reaches more than one of its periodic images, and the search does not
+ * extend beyond the periodic images that are covered by the mask.
+ * \param[in] (x,y,z) the vector to consider.
+ * \param[in] (ci,cj,ck) the coordinates of the block that the vector is in
+ *                       relative to the container data structure.
+ * \param[in] ijk the index of the block that the vector is in.
+ * \param[in] k the maximum number of neighbors to find, or a negative value if
+ *		there is no limit.
+ * \param[in] rsq the square of the search radius, which can be set to
+ *		  large_number for a k-nearest-neighbor search.
+ * \param[out] nr the neighbors that were found, sorted by increasing
+ *		  distance. */
+template<class c_class,class w_class>
+void voro_compute<c_class,w_class>::find_neighbors(double x,double y,double z,int ci,int cj,int ck,int ijk,int k,double rsq,std::vector<neighbor_record> &nr) {
+	nr.clear();
+	if(k==0) return;
+	neighbor_search(x,y,z,ci,cj,ck,ijk,k,nr,rsq);
+	if(k<0) std::sort(nr.begin(),nr.end());
+	else std::sort_heap(nr.begin(),nr.end());
+}
+
+/** Carries out the block search for the find_neighbors() routine.
+ * \param[in] (x,y,z) the vector to consider.
+ * \param[in] (ci,cj,ck) the coordinates of the block that the vector is in
+ *                       relative to the container data structure.
+ * \param[in] ijk the index of the block that the vector is in.
+ * \param[in] k the maximum number of neighbors to find, or a negative value if
+ *		there is no limit.
+ * \param[in,out] nr the list of neighbors, which is kept as a heap if k is
+ *		     non-negative.
+ * \param[in,out] mrs the square of the search radius. */
+template<class c_class,class w_class>
+void voro_compute<c_class,w_class>::neighbor_search(double x,double y,double z,int ci,int cj,int ck,int ijk,int k,std::vector<neighbor_record> &nr,double &mrs) {
+	double qx=0,qy=0,qz=0;
+	int i,j,kk,di,dj,dk,ei,ej,ek,f,g,disp;
+	double fx,fy,fz,mxs,mys,mzs,*radp;
+	unsigned int q,*e,*mijk;
+
+	// Test all particles in the vector's local region first
+	con.initialize_search(ci,cj,ck,ijk,i,j,kk,disp);
+	scan_neighbors(ijk,x,y,z,k,nr,mrs);
+
+	// Find which worklist to use, and set up the symmetry masks, in the
+	// same way as in the find_voronoi_cell() routine
+	unsigned int m1,m2;
+	con.frac_pos(x,y,z,ci,cj,ck,fx,fy,fz);
+	di=int(fx*xsp*w_class::fgrid);dj=int(fy*ysp*w_class::fgrid);dk=int(fz*zsp*w_class::fgrid);
+	if(di>=w_class::hgrid) {
+		mxs=boxx-fx;
+		m1=127+(3<<21);m2=1+(1<<21);di=w_class::fgrid-1-di;if(di<0) di=0;
+	} else {m1=m2=0;mxs=fx;}
+	if(dj>=w_class::hgrid) {
+		mys=boxy-fy;
+		m1|=(127<<7)+(3<<24);m2|=(1<<7)+(1<<24);dj=w_class::fgrid-1-dj;if(dj<0) dj=0;
+	} else mys=fy;
+	if(dk>=w_class::hgrid) {
+		mzs=boxz-fz;
+		m1|=(127<<14)+(3<<27);m2|=(1<<14)+(1<<27);dk=w_class::fgrid-1-dk;if(dk<0) dk=0;
+	} else mzs=fz;
+	if(mxs*mxs>mrs&&mys*mys>mrs&&mzs*mzs>mrs) return;
+	ijk=di+w_class::hgrid*(dj+w_class::hgrid*dk);
+	radp=mrad+ijk*w_class::seq_length;
+	e=(const_cast<unsigned int*> (wl))+ijk*w_class::seq_length;
+
+	// Test the blocks in the worklist that do not need to be marked on
+	// the mask
+	f=e[0];g=0;
+	while(g<f) {
+		if(mrs<radp[g]) return;
+		g++;
+		q=e[g];q^=m1;q+=m2;
+		di=q&127;di-=64;
+		dj=(q>>7)&127;dj-=64;
+		dk=(q>>14)&127;dk-=64;
+		ei=di+i;if(ei<0||ei>=hx) continue;
+		ej=dj+j;if(ej<0||ej>=hy) continue;
+		ek=dk+kk;if(ek<0||ek>=hz) continue;
+		if(block_distance(di,dj,dk,fx,fy,fz)>mrs) continue;
+		ijk=con.region_index(ci,cj,ck,ei,ej,ek,qx,qy,qz,disp);
+		scan_neighbors(ijk,x-qx,y-qy,z-qz,k,nr,mrs);
+	}
+
+	// Test the rest of the worklist, marking the blocks on the mask and
+	// adding their neighbors to the queue
+	mv++;
+	if(mv==0) {reset_mask();mv=1;}
+	int *qu_s=qu,*qu_e=qu;
+	while(g<w_class::seq_length-1) {
+		if(mrs<radp[g]) return;
+		g++;
+		q=e[g];q^=m1;q+=m2;
+		di=q&127;di-=64;
+		dj=(q>>7)&127;dj-=64;
+		dk=(q>>14)&127;dk-=64;
+		ei=di+i;if(ei<0||ei>=hx) continue;
+		ej=dj+j;if(ej<0||ej>=hy) continue;
+		ek=dk+kk;if(ek<0||ek>=hz) continue;
+		mijk=mask+ei+hx*(ej+hy*ek);
+		*mijk=mv;
+		if(block_distance(di,dj,dk,fx,fy,fz)>mrs) continue;
+		ijk=con.region_index(ci,cj,ck,ei,ej,ek,qx,qy,qz,disp);
+		scan_neighbors(ijk,x-qx,y-qy,z-qz,k,nr,mrs);
+		if(qu_e>qu_l-18) add_list_memory(qu_s,qu_e);
+		scan_bits_mask_add(q,mijk,ei,ej,ek,qu_e);
+	}
+	if(mrs<radp[g]) return;
+
+	// Work outwards block by block from the queue. A block that is beyond
+	// the search radius is not expanded, since the blocks behind it are
+	// further away.
+	while(qu_s!=qu_e) {
+		if(qu_s==qu_l) qu_s=qu;
+		ei=*(qu_s++);ej=*(qu_s++);ek=*(qu_s++);
+		di=ei-i;dj=ej-j;dk=ek-kk;
+		if(block_distance(di,dj,dk,fx,fy,fz)>mrs) continue;
+		ijk=con.region_index(ci,cj,ck,ei,ej,ek,qx,qy,qz,disp);
+		scan_neighbors(ijk,x-qx,y-qy,z-qz,k,nr,mrs);
+		if((qu_s<=qu_e?(qu_l-qu_e)+(qu_s-qu):qu_s-qu_e)<18) add_list_memory(qu_s,qu_e);
+		add_to_mask(ei,ej,ek,qu_e);
+	}
+}
+
 /** Scans the six orthogonal neighbors of a given block and adds them to the
  * queue if they haven't been considered already. It assumes that the queue
  * will definitely have enough memory to add six entries at the end.
  * \param[in] (ei,ej,ek) the block to consider.
  * \param[in,out] qu_e a pointer to the end of the queue. */
-template<class c_class>
-inline void voro_compute<c_class>::add_to_mask(int ei,int ej,int ek,int *&qu_e) {
+template<class c_class,class w_class>
+inline void voro_compute<c_class,w_class>::add_to_mask(int ei,int ej,int ek,int *&qu_e) {
 	unsigned int *mijk=mask+ei+hx*(ej+hy*ek);
 	if(ek>0) if(*(mijk-hxy)!=mv) {if(qu_e==qu_l) qu_e=qu;*(mijk-hxy)=mv;*(qu_e++)=ei;*(qu_e++)=ej;*(qu_e++)=ek-1;}
 	if(ej>0) if(*(mijk-hx)!=mv) {if(qu_e==qu_l) qu_e=qu;*(mijk-hx)=mv;*(qu_e++)=ei;*(qu_e++)=ej-1;*(qu_e++)=ek;}
@@ -246,8 +459,8 @@ inline void voro_compute<c_class>::add_to_mask(int ei,int ej,int ek,int *&qu_e)
 /** Scans a worklist entry and adds any blocks to the queue
  * \param[in] (ei,ej,ek) the block to consider.
  * \param[in,out] qu_e a pointer to the end of the queue. */
-template<class c_class>
-inline void voro_compute<c_class>::scan_bits_mask_add(unsigned int q,unsigned int *mijk,int ei,int ej,int ek,int *&qu_e) {
+template<class c_class,class w_class>
+inline void voro_compute<c_class,w_class>::scan_bits_mask_add(unsigned int q,unsigned int *mijk,int ei,int ej,int ek,int *&qu_e) {
 	const unsigned int b1=1<<21,b2=1<<22,b3=1<<24,b4=1<<25,b5=1<<27,b6=1<<28;
 	if((q&b2)==b2) {
 		if(ei>0) {*(mijk-1)=mv;*(qu_e++)=ei-1;*(qu_e++)=ej;*(qu_e++)=ek;}
@@ -286,39 +499,139 @@ inline void voro_compute<c_class>::scan_bits_mask_add(unsigned int q,unsigned in
  *                       in relative to the container data structure.
  * \return False if the Voronoi cell was completely removed during the
  *         computation and has zero volume, true otherwise. */
-template<class c_class>
+template<class c_class,class w_class>
 template<class v_cell>
-bool voro_compute<c_class>::compute_cell(v_cell &c,int ijk,int s,int ci,int cj,int ck) {
-	static const int count_list[8]={7,11,15,19,26,35,45,59},*count_e=count_list+8;
-	double x,y,z,x1,y1,z1,qx=0,qy=0,qz=0;
+bool voro_compute<c_class,w_class>::compute_cell(v_cell &c,int ijk,int s,int ci,int cj,int ck) {
+	trace_scope ts("cell");
+	double x,y,z;
+	int i,j,k,disp=0;
+	if(!con.initialize_voronoicell(c,ijk,s,ci,cj,ck,i,j,k,x,y,z,disp)) return collect_counters(c,false);
+	con.r_init(ijk,s,r_rad,r_mul);
+	return collect_counters(c,compute_cell(c,ijk,s,ci,cj,ck,i,j,k,x,y,z,disp)&&con.apply_far_walls(c,x,y,z));
+}
+
+/** This routine computes the Voronoi cell for a ghost particle at an arbitrary
+ * position, which is not stored in the container. The computation is the same
+ * as for a stored particle, except that no particles in the ghost particle's
+ * block are skipped. Since the container is not modified, several instances
+ * of this class can compute ghost cells on the same container at once.
+ * \param[in,out] c a reference to a voronoicell object.
+ * \param[in] (x,y,z) the position of the ghost particle, which must be in the
+ *		     primary domain.
+ * \param[in] r the radius of the ghost particle, which is ignored for the
+ *		regular Voronoi tessellation.
+ * \param[in] ijk the index of the block that the ghost particle is in.
+ * \param[in] (ci,cj,ck) the coordinates of the block that the ghost particle
+ *		         is in relative to the container data structure.
+ * \return False if the Voronoi cell was completely removed during the
+ *         computation and has zero volume, true otherwise. */
+template<class c_class,class w_class>
+template<class v_cell>
+bool voro_compute<c_class,w_class>::compute_ghost_cell(v_cell &c,double x,double y,double z,double r,int ijk,int ci,int cj,int ck) {
+	trace_scope ts("cell");
+	int i,j,k,disp;
+	if(!con.initialize_ghost_voronoicell(c,ijk,ci,cj,ck,i,j,k,x,y,z,disp)) return collect_counters(c,false);
+	con.r_init(r,r_rad,r_mul);
+	return collect_counters(c,compute_cell(c,ijk,co[ijk],ci,cj,ck,i,j,k,x,y,z,disp)&&con.apply_far_walls(c,x,y,z));
+}
+
+/** This routine computes the Voronoi cell for a particle, starting from a list
+ * of particles that are expected to be its neighbors, such as those from a
+ * previous frame of a trajectory. The cell is cut by the planes of these
+ * particles first, so that it is already close to its final size when the
+ * usual block search begins. The radius bound for the search is therefore
+ * much smaller, so fewer blocks are visited, and most of the later plane cuts
+ * miss the cell and exit early. The seed particles are taken at the periodic
+ * image closest to the particle. The resulting cell is the same as that from
+ * the usual routine, although the vertices may be stored in a different
+ * order.
+ * \param[in,out] c a reference to a voronoicell object.
+ * \param[in] ijk the index of the block that the test particle is in.
+ * \param[in] s the index of the particle within the test block.
+ * \param[in] (ci,cj,ck) the coordinates of the block that the test particle is
+ *                       in relative to the container data structure.
+ * \param[in] (sp,se) pointers to the start and end of an array of the seed
+ *		      particles, given as pairs of the block index and the
+ *		      index within the block.
+ * \return False if the Voronoi cell was completely removed during the
+ *         computation and has zero volume, true otherwise. */
+template<class c_class,class w_class>
+template<class v_cell>
+bool voro_compute<c_class,w_class>::compute_cell(v_cell &c,int ijk,int s,int ci,int cj,int ck,const int *sp,const int *se) {
+	trace_scope ts("cell");
+	double x,y,z,x1,y1,z1,rs;
+	int i,j,k,disp=0;
+	if(!con.initialize_voronoicell(c,ijk,s,ci,cj,ck,i,j,k,x,y,z,disp)) return collect_counters(c,false);
+	con.r_init(ijk,s,r_rad,r_mul);
+
+	// Cut the cell by the seed particles, storing their displacements so
+	// that they can be skipped during the block search
+	if(sp==se) return collect_counters(c,compute_cell(c,ijk,s,ci,cj,ck,i,j,k,x,y,z,disp)&&con.apply_far_walls(c,x,y,z));
+	wsd.resize(se-sp+((se-sp)>>1));
+	double *dp=&wsd[0];
+	for(const int *tp=sp;tp<se;tp+=2,dp+=3) {
+		x1=p[*tp][ps*tp[1]]-x;
+		y1=p[*tp][ps*tp[1]+1]-y;
+		z1=p[*tp][ps*tp[1]+2]-z;
+		con.min_image(x1,y1,z1);
+		*dp=x1;dp[1]=y1;dp[2]=z1;
+		rs=con.r_scale(x1*x1+y1*y1+z1*z1,*tp,tp[1],r_rad);
+		if(!c.nplane(x1,y1,z1,rs,id[*tp][tp[1]])) return collect_counters(c,false);
+	}
+	wsp=sp;wse=se;
+	bool b=compute_cell(c,ijk,s,ci,cj,ck,i,j,k,x,y,z,disp);
+	wsp=wse=NULL;
+	return collect_counters(c,b&&con.apply_far_walls(c,x,y,z));
+}
+
+/** Carries out the main part of a Voronoi cell computation, once the cell has
+ * been initialized and the radius-dependent constants have been set up.
+ * \param[in,out] c a reference to a voronoicell object.
+ * \param[in] ijk the index of the block that the test particle is in.
+ * \param[in] s the index of the particle within the test block, which is
+ *		skipped. If this is equal to the number of particles in the
+ *		block, then no particles are skipped.
+ * \param[in] (ci,cj,ck) the coordinates of the block that the test particle is
+ *                       in relative to the container data structure.
+ * \param[in] (i,j,k) the coordinates of the test block relative to the
+ *		      voro_compute coordinate system.
+ * \param[in] (x,y,z) the position of the test particle.
+ * \param[in] disp a block displacement set by the container.
+ * \return False if the Voronoi cell was completely removed during the
+ *         computation and has zero volume, true otherwise. */
+template<class c_class,class w_class>
+template<class v_cell>
+bool voro_compute<c_class,w_class>::compute_cell(v_cell &c,int ijk,int s,int ci,int cj,int ck,int i,int j,int k,double x,double y,double z,int disp) {
+	double x1,y1,z1,qx=0,qy=0,qz=0;
 	double xlo,ylo,zlo,xhi,yhi,zhi,x2,y2,z2,rs;
-	int i,j,k,di,dj,dk,ei,ej,ek,f,g,l,disp;
+	int di,dj,dk,ei,ej,ek,f,g,l;
 	double fx,fy,fz,gxs,gys,gzs,*radp;
 	unsigned int q,*e,*mijk;
 
-	if(!con.initialize_voronoicell(c,ijk,s,ci,cj,ck,i,j,k,x,y,z,disp)) return false;
-	con.r_init(ijk,s);
-
 	// Initialize the Voronoi cell to fill the entire container
 	double crs,mrs;
 
-	int next_count=3,*count_p=(const_cast<int*> (count_list));
+	int cijk=ijk;
+	lb=false;
 
-	// Test all particles in the particle's local region first
+	// Test all particles in the particle's local region first, skipping
+	// any seed particles that have already been cut
+	bool sk=wsp!=wse&&seed_block(ijk);
+	VOROPP_COUNT(counters.blocks_scanned++);
 	for(l=0;l<s;l++) {
 		x1=p[ijk][ps*l]-x;
 		y1=p[ijk][ps*l+1]-y;
 		z1=p[ijk][ps*l+2]-z;
-		rs=con.r_scale(x1*x1+y1*y1+z1*z1,ijk,l);
-		if(!c.nplane(x1,y1,z1,rs,id[ijk][l])) return false;
+		rs=con.r_scale(x1*x1+y1*y1+z1*z1,ijk,l,r_rad);
+		if(!(sk&&seed_skip(ijk,l,x1,y1,z1))&&!c.nplane(x1,y1,z1,rs,id[ijk][l])) return false;
 	}
 	l++;
 	while(l<co[ijk]) {
 		x1=p[ijk][ps*l]-x;
 		y1=p[ijk][ps*l+1]-y;
 		z1=p[ijk][ps*l+2]-z;
-		rs=con.r_scale(x1*x1+y1*y1+z1*z1,ijk,l);
-		if(!c.nplane(x1,y1,z1,rs,id[ijk][l])) return false;
+		rs=con.r_scale(x1*x1+y1*y1+z1*z1,ijk,l,r_rad);
+		if(!(sk&&seed_skip(ijk,l,x1,y1,z1))&&!c.nplane(x1,y1,z1,rs,id[ijk][l])) return false;
 		l++;
 	}
 
@@ -326,13 +639,14 @@ bool voro_compute<c_class>::compute_cell(v_cell &c,int ijk,int s,int ci,int cj,i
 	// vertex. This is used to cut off the calculation since we only need
 	// to test out to twice this range.
 	mrs=c.max_radius_squared();
+	local_bound(cijk,ci,cj,ck,i,j,k,disp,mrs);
 
 	// Now compute the fractional position of the particle within its
 	// region and store it in (fx,fy,fz). We use this to compute an index
 	// (di,dj,dk) of which subregion the particle is within.
 	unsigned int m1,m2;
 	con.frac_pos(x,y,z,ci,cj,ck,fx,fy,fz);
-	di=int(fx*xsp*wl_fgrid);dj=int(fy*ysp*wl_fgrid);dk=int(fz*zsp*wl_fgrid);
+	di=int(fx*xsp*w_class::fgrid);dj=int(fy*ysp*w_class::fgrid);dk=int(fz*zsp*w_class::fgrid);
 
 	// The indices (di,dj,dk) tell us which worklist to use, to test the
 	// blocks in the optimal order. But we only store worklists for the
@@ -341,42 +655,44 @@ bool voro_compute<c_class>::compute_cell(v_cell &c,int ijk,int s,int ci,int cj,i
 	// section, we detect for these cases, by reflecting high values of di,
 	// dj, and dk. For these cases, a mask is constructed in m1 and m2
 	// which is used to flip the worklist information when it is loaded.
-	if(di>=wl_hgrid) {
+	if(di>=w_class::hgrid) {
 		gxs=fx;
-		m1=127+(3<<21);m2=1+(1<<21);di=wl_fgrid-1-di;if(di<0) di=0;
+		m1=127+(3<<21);m2=1+(1<<21);di=w_class::fgrid-1-di;if(di<0) di=0;
 	} else {m1=m2=0;gxs=boxx-fx;}
-	if(dj>=wl_hgrid) {
+	if(dj>=w_class::hgrid) {
 		gys=fy;
-		m1|=(127<<7)+(3<<24);m2|=(1<<7)+(1<<24);dj=wl_fgrid-1-dj;if(dj<0) dj=0;
+		m1|=(127<<7)+(3<<24);m2|=(1<<7)+(1<<24);dj=w_class::fgrid-1-dj;if(dj<0) dj=0;
 	} else gys=boxy-fy;
-	if(dk>=wl_hgrid) {
+	if(dk>=w_class::hgrid) {
 		gzs=fz;
-		m1|=(127<<14)+(3<<27);m2|=(1<<14)+(1<<27);dk=wl_fgrid-1-dk;if(dk<0) dk=0;
+		m1|=(127<<14)+(3<<27);m2|=(1<<14)+(1<<27);dk=w_class::fgrid-1-dk;if(dk<0) dk=0;
 	} else gzs=boxz-fz;
 	gxs*=gxs;gys*=gys;gzs*=gzs;
 
 	// Now compute which worklist we are going to use, and set radp and e to
 	// point at the right offsets
-	ijk=di+wl_hgrid*(dj+wl_hgrid*dk);
-	radp=mrad+ijk*wl_seq_length;
-	e=(const_cast<unsigned int*> (wl))+ijk*wl_seq_length;
+	ijk=di+w_class::hgrid*(dj+w_class::hgrid*dk);
+	radp=mrad+ijk*w_class::seq_length;
+	e=(const_cast<unsigned int*> (wl))+ijk*w_class::seq_length;
 
 	// Read in how many items in the worklist can be tested without having to
-	// worry about writing to the mask
+	// worry about writing to the mask. This can be zero for worklists that
+	// are generated for elongated blocks.
 	f=e[0];g=0;
-	do {
+	while(g<f) {
 
-		// At the intervals specified by count_list, we recompute the
-		// maximum radius squared
-		if(g==next_count) {
-			mrs=c.max_radius_squared();
-			if(count_p!=count_e) next_count=*(count_p++);
-		}
+		// Update the maximum radius squared. The cell caches this, and
+		// only rescans its vertices when a cut has removed the vertex
+		// that gave it, so this is cheap enough to do for every block.
+		mrs=c.max_radius_squared();
+		local_bound(cijk,ci,cj,ck,i,j,k,disp,mrs);
 
 		// If mrs is less than the minimum distance to any untested
 		// block, then we are done
-		if(con.r_ctest(radp[g],mrs)) return true;
+		if(con.r_ctest(radp[g],mrs,r_mul)) return true;
 		g++;
+		VOROPP_COUNT(counters.worklist_blocks++);
+		VOROPP_COUNT(if((unsigned long) g>counters.max_depth) counters.max_depth=g);
 
 		// Load in a block off the worklist, permute it with the
 		// symmetry mask, and decode its position. These are all
@@ -396,7 +712,10 @@ bool voro_compute<c_class>::compute_cell(v_cell &c,int ijk,int s,int ci,int cj,i
 		// current mrs, in which case we skip this block and move on.
 		// Otherwise, it computes the maximum distance to the block and
 		// returns it in crs.
-		if(compute_min_max_radius(di,dj,dk,fx,fy,fz,gxs,gys,gzs,crs,mrs)) continue;
+		if(compute_min_max_radius(di,dj,dk,fx,fy,fz,gxs,gys,gzs,crs,mrs)) {
+			VOROPP_COUNT(counters.blocks_skipped++);
+			continue;
+		}
 
 		// Now compute which region we are going to loop over, adding a
 		// displacement for the periodic cases
@@ -407,14 +726,16 @@ bool voro_compute<c_class>::compute_cell(v_cell &c,int ijk,int s,int ci,int cj,i
 		// intersections. Otherwise, we do additional checks and skip
 		// those particles which can't possibly intersect the block.
 		if(co[ijk]>0) {
+			VOROPP_COUNT(counters.blocks_scanned++);
 			l=0;x2=x-qx;y2=y-qy;z2=z-qz;
-			if(!con.r_ctest(crs,mrs)) {
+			sk=wsp!=wse&&seed_block(ijk);
+			if(!con.r_ctest(crs,mrs,r_mul)) {
 				do {
 					x1=p[ijk][ps*l]-x2;
 					y1=p[ijk][ps*l+1]-y2;
 					z1=p[ijk][ps*l+2]-z2;
-					rs=con.r_scale(x1*x1+y1*y1+z1*z1,ijk,l);
-					if(!c.nplane(x1,y1,z1,rs,id[ijk][l])) return false;
+					rs=con.r_scale(x1*x1+y1*y1+z1*z1,ijk,l,r_rad);
+					if(!(sk&&seed_skip(ijk,l,x1,y1,z1))&&!c.nplane(x1,y1,z1,rs,id[ijk][l])) return false;
 					l++;
 				} while (l<co[ijk]);
 			} else {
@@ -423,12 +744,12 @@ bool voro_compute<c_class>::compute_cell(v_cell &c,int ijk,int s,int ci,int cj,i
 					y1=p[ijk][ps*l+1]-y2;
 					z1=p[ijk][ps*l+2]-z2;
 					rs=x1*x1+y1*y1+z1*z1;
-					if(con.r_scale_check(rs,mrs,ijk,l)&&!c.nplane(x1,y1,z1,rs,id[ijk][l])) return false;
+					if(con.r_scale_check(rs,mrs,ijk,l,r_rad)&&!(sk&&seed_skip(ijk,l,x1,y1,z1))&&!c.nplane(x1,y1,z1,rs,id[ijk][l])) return false;
 					l++;
 				} while (l<co[ijk]);
 			}
 		}
-	} while(g<f);
+	}
 
 	// If we reach here, we were unable to compute the entire cell using
 	// the first part of the worklist. This section of the algorithm
@@ -446,19 +767,20 @@ bool voro_compute<c_class>::compute_cell(v_cell &c,int ijk,int s,int ci,int cj,i
 	// Set the queue pointers
 	int *qu_s=qu,*qu_e=qu;
 
-	while(g<wl_seq_length-1) {
+	while(g<w_class::seq_length-1) {
 
-		// At the intervals specified by count_list, we recompute the
-		// maximum radius squared
-		if(g==next_count) {
-			mrs=c.max_radius_squared();
-			if(count_p!=count_e) next_count=*(count_p++);
-		}
+		// Update the maximum radius squared. The cell caches this, and
+		// only rescans its vertices when a cut has removed the vertex
+		// that gave it, so this is cheap enough to do for every block.
+		mrs=c.max_radius_squared();
+		local_bound(cijk,ci,cj,ck,i,j,k,disp,mrs);
 
 		// If mrs is less than the minimum distance to any untested
 		// block, then we are done
-		if(con.r_ctest(radp[g],mrs)) return true;
+		if(con.r_ctest(radp[g],mrs,r_mul)) return true;
 		g++;
+		VOROPP_COUNT(counters.worklist_blocks++);
+		VOROPP_COUNT(if((unsigned long) g>counters.max_depth) counters.max_depth=g);
 
 		// Load in a block off the worklist, permute it with the
 		// symmetry mask, and decode its position. These are all
@@ -482,7 +804,10 @@ bool voro_compute<c_class>::compute_cell(v_cell &c,int ijk,int s,int ci,int cj,i
 		// current mrs, in which case we skip this block and move on.
 		// Otherwise, it computes the maximum distance to the block and
 		// returns it in crs.
-		if(compute_min_max_radius(di,dj,dk,fx,fy,fz,gxs,gys,gzs,crs,mrs)) continue;
+		if(compute_min_max_radius(di,dj,dk,fx,fy,fz,gxs,gys,gzs,crs,mrs)) {
+			VOROPP_COUNT(counters.blocks_skipped++);
+			continue;
+		}
 
 		// Now compute which region we are going to loop over, adding a
 		// displacement for the periodic cases
@@ -493,14 +818,16 @@ bool voro_compute<c_class>::compute_cell(v_cell &c,int ijk,int s,int ci,int cj,i
 		// intersections. Otherwise, we do additional checks and skip
 		// those particles which can't possibly intersect the block.
 		if(co[ijk]>0) {
+			VOROPP_COUNT(counters.blocks_scanned++);
 			l=0;x2=x-qx;y2=y-qy;z2=z-qz;
-			if(!con.r_ctest(crs,mrs)) {
+			sk=wsp!=wse&&seed_block(ijk);
+			if(!con.r_ctest(crs,mrs,r_mul)) {
 				do {
 					x1=p[ijk][ps*l]-x2;
 					y1=p[ijk][ps*l+1]-y2;
 					z1=p[ijk][ps*l+2]-z2;
-					rs=con.r_scale(x1*x1+y1*y1+z1*z1,ijk,l);
-					if(!c.nplane(x1,y1,z1,rs,id[ijk][l])) return false;
+					rs=con.r_scale(x1*x1+y1*y1+z1*z1,ijk,l,r_rad);
+					if(!(sk&&seed_skip(ijk,l,x1,y1,z1))&&!c.nplane(x1,y1,z1,rs,id[ijk][l])) return false;
 					l++;
 				} while (l<co[ijk]);
 			} else {
@@ -509,7 +836,7 @@ bool voro_compute<c_class>::compute_cell(v_cell &c,int ijk,int s,int ci,int cj,i
 					y1=p[ijk][ps*l+1]-y2;
 					z1=p[ijk][ps*l+2]-z2;
 					rs=x1*x1+y1*y1+z1*z1;
-					if(con.r_scale_check(rs,mrs,ijk,l)&&!c.nplane(x1,y1,z1,rs,id[ijk][l])) return false;
+					if(con.r_scale_check(rs,mrs,ijk,l,r_rad)&&!(sk&&seed_skip(ijk,l,x1,y1,z1))&&!c.nplane(x1,y1,z1,rs,id[ijk][l])) return false;
 					l++;
 				} while (l<co[ijk]);
 			}
@@ -526,11 +853,26 @@ bool voro_compute<c_class>::compute_cell(v_cell &c,int ijk,int s,int ci,int cj,i
 	}
 
 	// Do a check to see if we've reached the radius cutoff
-	if(con.r_ctest(radp[g],mrs)) return true;
+	mrs=c.max_radius_squared();
+	local_bound(cijk,ci,cj,ck,i,j,k,disp,mrs);
+	if(con.r_ctest(radp[g],mrs,r_mul)) return true;
 
 	// We were unable to completely compute the cell based on the blocks in
 	// the worklist, so now we have to go block by block, reading in items
-	// off the list
+	// off the list. Empty regions are added to the queue as a whole, so
+	// the blocks from the first part of the worklist must be marked on the
+	// mask to make sure they are not visited again.
+	bool sr=c_class::direct_blocks&&qu_s!=qu_e&&sparse_regions();
+	if(sr) {
+		mask[i+hx*(j+hy*k)]=mv;
+		for(g=1;g<=f;g++) {
+			q=e[g];q^=m1;q+=m2;
+			ei=int(q&127)-64+i;if(ei<0||ei>=hx) continue;
+			ej=int((q>>7)&127)-64+j;if(ej<0||ej>=hy) continue;
+			ek=int((q>>14)&127)-64+k;if(ek<0||ek>=hz) continue;
+			mask[ei+hx*(ej+hy*ek)]=mv;
+		}
+	}
 	while(qu_s!=qu_e) {
 
 		// If we reached the end of the list memory loop back to the
@@ -540,54 +882,18 @@ bool voro_compute<c_class>::compute_cell(v_cell &c,int ijk,int s,int ci,int cj,i
 		// Read in a block off the list, and compute the upper and lower
 		// coordinates in each of the three dimensions
 		ei=*(qu_s++);ej=*(qu_s++);ek=*(qu_s++);
+		VOROPP_COUNT(counters.queue_blocks++);
 		xlo=(ei-i)*boxx-fx;xhi=xlo+boxx;
 		ylo=(ej-j)*boxy-fy;yhi=ylo+boxy;
 		zlo=(ek-k)*boxz-fz;zhi=zlo+boxz;
 
 		// Carry out plane tests to see if any particle in this block
-		// could possibly intersect the cell
-		if(ei>i) {
-			if(ej>j) {
-				if(ek>k) {if(corner_test(c,xlo,ylo,zlo,xhi,yhi,zhi)) continue;}
-				else if(ek<k) {if(corner_test(c,xlo,ylo,zhi,xhi,yhi,zlo)) continue;}
-				else {if(edge_z_test(c,xlo,ylo,zlo,xhi,yhi,zhi)) continue;}
-			} else if(ej<j) {
-				if(ek>k) {if(corner_test(c,xlo,yhi,zlo,xhi,ylo,zhi)) continue;}
-				else if(ek<k) {if(corner_test(c,xlo,yhi,zhi,xhi,ylo,zlo)) continue;}
-				else {if(edge_z_test(c,xlo,yhi,zlo,xhi,ylo,zhi)) continue;}
-			} else {
-				if(ek>k) {if(edge_y_test(c,xlo,ylo,zlo,xhi,yhi,zhi)) continue;}
-				else if(ek<k) {if(edge_y_test(c,xlo,ylo,zhi,xhi,yhi,zlo)) continue;}
-				else {if(face_x_test(c,xlo,ylo,zlo,yhi,zhi)) continue;}
-			}
-		} else if(ei<i) {
-			if(ej>j) {
-				if(ek>k) {if(corner_test(c,xhi,ylo,zlo,xlo,yhi,zhi)) continue;}
-				else if(ek<k) {if(corner_test(c,xhi,ylo,zhi,xlo,yhi,zlo)) continue;}
-				else {if(edge_z_test(c,xhi,ylo,zlo,xlo,yhi,zhi)) continue;}
-			} else if(ej<j) {
-				if(ek>k) {if(corner_test(c,xhi,yhi,zlo,xlo,ylo,zhi)) continue;}
-				else if(ek<k) {if(corner_test(c,xhi,yhi,zhi,xlo,ylo,zlo)) continue;}
-				else {if(edge_z_test(c,xhi,yhi,zlo,xlo,ylo,zhi)) continue;}
-			} else {
-				if(ek>k) {if(edge_y_test(c,xhi,ylo,zlo,xlo,yhi,zhi)) continue;}
-				else if(ek<k) {if(edge_y_test(c,xhi,ylo,zhi,xlo,yhi,zlo)) continue;}
-				else {if(face_x_test(c,xhi,ylo,zlo,yhi,zhi)) continue;}
-			}
-		} else {
-			if(ej>j) {
-				if(ek>k) {if(edge_x_test(c,xlo,ylo,zlo,xhi,yhi,zhi)) continue;}
-				else if(ek<k) {if(edge_x_test(c,xlo,ylo,zhi,xhi,yhi,zlo)) continue;}
-				else {if(face_y_test(c,xlo,ylo,zlo,xhi,zhi)) continue;}
-			} else if(ej<j) {
-				if(ek>k) {if(edge_x_test(c,xlo,yhi,zlo,xhi,ylo,zhi)) continue;}
-				else if(ek<k) {if(edge_x_test(c,xlo,yhi,zhi,xhi,ylo,zlo)) continue;}
-				else {if(face_y_test(c,xlo,yhi,zlo,xhi,zhi)) continue;}
-			} else {
-				if(ek>k) {if(face_z_test(c,xlo,ylo,zlo,xhi,yhi)) continue;}
-				else if(ek<k) {if(face_z_test(c,xlo,ylo,zhi,xhi,yhi)) continue;}
-				else voro_fatal_error("Compute cell routine revisiting central block, which should never\nhappen.",VOROPP_INTERNAL_ERROR);
-			}
+		// could possibly intersect the cell, dealing with the whole of
+		// the surrounding region at once if it is empty
+		if((sr&&skip_empty_region(c,ci,cj,ck,i,j,k,ei,ej,ek,fx,fy,fz,qu_s,qu_e))
+		   ||box_test(c,ei-i,ej-j,ek-k,xlo,ylo,zlo,xhi,yhi,zhi)) {
+			VOROPP_COUNT(counters.blocks_skipped++);
+			continue;
 		}
 
 		// Now compute the region that we are going to test over, and
@@ -598,13 +904,15 @@ bool voro_compute<c_class>::compute_cell(v_cell &c,int ijk,int s,int ci,int cj,i
 		// would be possible to exclude some of these cases by testing
 		// against mrs, but this will probably not save time.
 		if(co[ijk]>0) {
+			VOROPP_COUNT(counters.blocks_scanned++);
 			l=0;x2=x-qx;y2=y-qy;z2=z-qz;
+			sk=wsp!=wse&&seed_block(ijk);
 			do {
 				x1=p[ijk][ps*l]-x2;
 				y1=p[ijk][ps*l+1]-y2;
 				z1=p[ijk][ps*l+2]-z2;
-				rs=con.r_scale(x1*x1+y1*y1+z1*z1,ijk,l);
-				if(!c.nplane(x1,y1,z1,rs,id[ijk][l])) return false;
+				rs=con.r_scale(x1*x1+y1*y1+z1*z1,ijk,l,r_rad);
+				if(!(sk&&seed_skip(ijk,l,x1,y1,z1))&&!c.nplane(x1,y1,z1,rs,id[ijk][l])) return false;
 				l++;
 			} while (l<co[ijk]);
 		}
@@ -620,6 +928,166 @@ bool voro_compute<c_class>::compute_cell(v_cell &c,int ijk,int s,int ci,int cj,i
 	return true;
 }
 
+/** Checks whether a box of blocks can possibly have any intersection with a
+ * Voronoi cell, by choosing the appropriate test according to where the box is
+ * relative to the block of the cell.
+ * \param[in,out] c a reference to a Voronoi cell.
+ * \param[in] (si,sj,sk) the position of the box relative to the block of the
+ *			 cell in each direction, which is positive if the box
+ *			 is entirely above it, negative if it is entirely below
+ *			 it, and zero otherwise.
+ * \param[in] (xlo,ylo,zlo) the lower corner of the box, relative to the
+ *			    particle.
+ * \param[in] (xhi,yhi,zhi) the upper corner of the box, relative to the
+ *			    particle.
+ * \return True if the box can be skipped, false otherwise. */
+template<class c_class,class w_class>
+template<class v_cell>
+inline bool voro_compute<c_class,w_class>::box_test(v_cell &c,int si,int sj,int sk,double xlo,double ylo,double zlo,double xhi,double yhi,double zhi) {
+	if(si>0) {
+		if(sj>0) {
+			if(sk>0) return corner_test(c,xlo,ylo,zlo,xhi,yhi,zhi);
+			else if(sk<0) return corner_test(c,xlo,ylo,zhi,xhi,yhi,zlo);
+			else return edge_z_test(c,xlo,ylo,zlo,xhi,yhi,zhi);
+		} else if(sj<0) {
+			if(sk>0) return corner_test(c,xlo,yhi,zlo,xhi,ylo,zhi);
+			else if(sk<0) return corner_test(c,xlo,yhi,zhi,xhi,ylo,zlo);
+			else return edge_z_test(c,xlo,yhi,zlo,xhi,ylo,zhi);
+		} else {
+			if(sk>0) return edge_y_test(c,xlo,ylo,zlo,xhi,yhi,zhi);
+			else if(sk<0) return edge_y_test(c,xlo,ylo,zhi,xhi,yhi,zlo);
+			else return face_x_test(c,xlo,ylo,zlo,yhi,zhi);
+		}
+	} else if(si<0) {
+		if(sj>0) {
+			if(sk>0) return corner_test(c,xhi,ylo,zlo,xlo,yhi,zhi);
+			else if(sk<0) return corner_test(c,xhi,ylo,zhi,xlo,yhi,zlo);
+			else return edge_z_test(c,xhi,ylo,zlo,xlo,yhi,zhi);
+		} else if(sj<0) {
+			if(sk>0) return corner_test(c,xhi,yhi,zlo,xlo,ylo,zhi);
+			else if(sk<0) return corner_test(c,xhi,yhi,zhi,xlo,ylo,zlo);
+			else return edge_z_test(c,xhi,yhi,zlo,xlo,ylo,zhi);
+		} else {
+			if(sk>0) return edge_y_test(c,xhi,ylo,zlo,xlo,yhi,zhi);
+			else if(sk<0) return edge_y_test(c,xhi,ylo,zhi,xlo,yhi,zlo);
+			else return face_x_test(c,xhi,ylo,zlo,yhi,zhi);
+		}
+	} else {
+		if(sj>0) {
+			if(sk>0) return edge_x_test(c,xlo,ylo,zlo,xhi,yhi,zhi);
+			else if(sk<0) return edge_x_test(c,xlo,ylo,zhi,xhi,yhi,zlo);
+			else return face_y_test(c,xlo,ylo,zlo,xhi,zhi);
+		} else if(sj<0) {
+			if(sk>0) return edge_x_test(c,xlo,yhi,zlo,xhi,ylo,zhi);
+			else if(sk<0) return edge_x_test(c,xlo,yhi,zhi,xhi,ylo,zlo);
+			else return face_y_test(c,xlo,yhi,zlo,xhi,zhi);
+		} else {
+			if(sk>0) return face_z_test(c,xlo,ylo,zlo,xhi,yhi);
+			else if(sk<0) return face_z_test(c,xlo,ylo,zhi,xhi,yhi);
+			voro_fatal_error("Compute cell routine revisiting central block, which should never\nhappen.",VOROPP_INTERNAL_ERROR);
+		}
+	}
+	return false;
+}
+
+/** Handles a block that lies in an empty region of the container. The
+ * container is divided into regions of empty_region_blocks blocks in each
+ * direction, and if the region holding the block has no particles, then the
+ * part of it that is covered by the mask is dealt with as a whole. All of its
+ * blocks are marked on the mask, since none of them have particles to test. If
+ * the region can't intersect the cell, then the search doesn't continue past
+ * it, since no point in the region could cut the cell. Otherwise, the blocks
+ * just outside the region are added to the queue, which replaces the testing
+ * of every block in the region with a single test of the region.
+ * \param[in,out] c a reference to a Voronoi cell.
+ * \param[in] (ci,cj,ck) the coordinates of the block of the cell relative to
+ *			 the container.
+ * \param[in] (i,j,k) the coordinates of the block of the cell relative to the
+ *		      mask.
+ * \param[in] (ei,ej,ek) the coordinates of the block to consider relative to
+ *			 the mask.
+ * \param[in] (fx,fy,fz) the position of the particle relative to its block.
+ * \param[in,out] qu_s a pointer to the start of the queue.
+ * \param[in,out] qu_e a pointer to the end of the queue.
+ * \return True if the block was dealt with, false if it is in a region with
+ *	   particles and must be tested on its own. */
+template<class c_class,class w_class>
+template<class v_cell>
+bool voro_compute<c_class,w_class>::skip_empty_region(v_cell &c,int ci,int cj,int ck,int i,int j,int k,int ei,int ej,int ek,double fx,double fy,double fz,int *&qu_s,int *&qu_e) {
+	const int s=empty_region_blocks;
+
+	// Find the block in the container, and the region that it is in
+	int bi=ci+ei-i,bj=cj+ej-j,bk=ck+ek-k;
+	if(bi<0||bi>=con.nx) bi=con.step_mod(bi,con.nx);
+	if(bj<0||bj>=con.ny) bj=con.step_mod(bj,con.ny);
+	if(bk<0||bk>=con.nz) bk=con.step_mod(bk,con.nz);
+	if(rc[bi/s+rx*(bj/s+ry*(bk/s))]>0) return false;
+
+	// Find the extent of the region in the mask. If the region has
+	// already been dealt with, then there is nothing more to do.
+	int ei0=ei-bi%s,ej0=ej-bj%s,ek0=ek-bk%s;
+	int ei1=ei0+s-1,ej1=ej0+s-1,ek1=ek0+s-1;
+	if(ei1>ei+con.nx-1-bi) ei1=ei+con.nx-1-bi;
+	if(ej1>ej+con.ny-1-bj) ej1=ej+con.ny-1-bj;
+	if(ek1>ek+con.nz-1-bk) ek1=ek+con.nz-1-bk;
+	if(ei0<0) ei0=0;
+	if(ei1>=hx) ei1=hx-1;
+	if(ej0<0) ej0=0;
+	if(ej1>=hy) ej1=hy-1;
+	if(ek0<0) ek0=0;
+	if(ek1>=hz) ek1=hz-1;
+	int si=ei0>i?1:(ei1<i?-1:0),sj=ej0>j?1:(ej1<j?-1:0),sk=ek0>k?1:(ek1<k?-1:0);
+	if(si==0&&sj==0&&sk==0) return false;
+	int r=ei0+hx*(ej0+hy*ek0),ii,jj,kk;
+	if(rv.empty()) rv.assign(hxyz,0);
+	if(rv[r]==mv) return true;
+	rv[r]=mv;
+
+	// Mark all of the blocks of the region on the mask, and test the
+	// region as a single box
+	unsigned int *mp;
+	for(kk=ek0;kk<=ek1;kk++) for(jj=ej0;jj<=ej1;jj++) {
+		mp=mask+hx*(jj+hy*kk);
+		for(ii=ei0;ii<=ei1;ii++) mp[ii]=mv;
+	}
+	if(box_test(c,si,sj,sk,(ei0-i)*boxx-fx,(ej0-j)*boxy-fy,(ek0-k)*boxz-fz,
+		(ei1+1-i)*boxx-fx,(ej1+1-j)*boxy-fy,(ek1+1-k)*boxz-fz)) return true;
+
+	// Add the blocks that are next to the region to the queue
+	while((qu_s<=qu_e?(qu_l-qu_e)+(qu_s-qu):qu_s-qu_e)<18*s*s+18) add_list_memory(qu_s,qu_e);
+	for(kk=ek0;kk<=ek1;kk++) for(jj=ej0;jj<=ej1;jj++) {
+		if(ei0>0) queue_block(ei0-1,jj,kk,qu_e);
+		if(ei1<hx-1) queue_block(ei1+1,jj,kk,qu_e);
+	}
+	for(kk=ek0;kk<=ek1;kk++) for(ii=ei0;ii<=ei1;ii++) {
+		if(ej0>0) queue_block(ii,ej0-1,kk,qu_e);
+		if(ej1<hy-1) queue_block(ii,ej1+1,kk,qu_e);
+	}
+	for(jj=ej0;jj<=ej1;jj++) for(ii=ei0;ii<=ei1;ii++) {
+		if(ek0>0) queue_block(ii,jj,ek0-1,qu_e);
+		if(ek1<hz-1) queue_block(ii,jj,ek1+1,qu_e);
+	}
+	return true;
+}
+
+/** Counts the number of particles in each region of empty_region_blocks
+ * blocks in each direction, for use by the skip_empty_region routine. The
+ * regions are only used if the container is sparse enough that at least seven
+ * eighths of them are empty, since otherwise testing them costs more than it
+ * saves. */
+template<class c_class,class w_class>
+void voro_compute<c_class,w_class>::count_regions() {
+	const int s=empty_region_blocks;
+	int ii,jj,kk,ijk=0,rz=(con.nz+s-1)/s;
+	rc.assign(rx*ry*rz,0);
+	for(kk=0;kk<con.nz;kk++) for(jj=0;jj<con.ny;jj++) for(ii=0;ii<con.nx;ii++,ijk++)
+		rc[ii/s+rx*(jj/s+ry*(kk/s))]+=co[ijk];
+	int ne=0;
+	for(std::vector<int>::iterator it=rc.begin();it!=rc.end();it++) if(*it==0) ne++;
+	rsp=8*ne>=7*int(rc.size());
+	rcu=con.update_count;
+}
+
 /** This function checks to see whether a particular block can possibly have
  * any intersection with a Voronoi cell, for the case when the closest point
  * from the cell center to the block is at a corner.
@@ -629,17 +1097,17 @@ bool voro_compute<c_class>::compute_cell(v_cell &c,int ijk,int s,int ci,int cj,i
  * \param[in] (xh,yh,zh) the relative coordinates of the corner of the block
  *                       furthest away from the cell center.
  * \return False if the block may intersect, true if does not. */
-template<class c_class>
+template<class c_class,class w_class>
 template<class v_cell>
-bool voro_compute<c_class>::corner_test(v_cell &c,double xl,double yl,double zl,double xh,double yh,double zh) {
-	con.r_prime(xl*xl+yl*yl+zl*zl);
-	if(c.plane_intersects_guess(xh,yl,zl,con.r_cutoff(xl*xh+yl*yl+zl*zl))) return false;
-	if(c.plane_intersects(xh,yh,zl,con.r_cutoff(xl*xh+yl*yh+zl*zl))) return false;
-	if(c.plane_intersects(xl,yh,zl,con.r_cutoff(xl*xl+yl*yh+zl*zl))) return false;
-	if(c.plane_intersects(xl,yh,zh,con.r_cutoff(xl*xl+yl*yh+zl*zh))) return false;
-	if(c.plane_intersects(xl,yl,zh,con.r_cutoff(xl*xl+yl*yl+zl*zh))) return false;
-	if(c.plane_intersects(xh,yl,zh,con.r_cutoff(xl*xh+yl*yl+zl*zh))) return false;
-	return true;
+bool voro_compute<c_class,w_class>::corner_test(v_cell &c,double xl,double yl,double zl,double xh,double yh,double zh) {
+	con.r_prime(xl*xl+yl*yl+zl*zl,r_mul,r_val);
+	add_plane(0,xh,yl,zl,con.r_cutoff(xl*xh+yl*yl+zl*zl,r_val));
+	add_plane(1,xh,yh,zl,con.r_cutoff(xl*xh+yl*yh+zl*zl,r_val));
+	add_plane(2,xl,yh,zl,con.r_cutoff(xl*xl+yl*yh+zl*zl,r_val));
+	add_plane(3,xl,yh,zh,con.r_cutoff(xl*xl+yl*yh+zl*zh,r_val));
+	add_plane(4,xl,yl,zh,con.r_cutoff(xl*xl+yl*yl+zl*zh,r_val));
+	add_plane(5,xh,yl,zh,con.r_cutoff(xl*xh+yl*yl+zl*zh,r_val));
+	return !planes_intersect(c,6);
 }
 
 /** This function checks to see whether a particular block can possibly have
@@ -654,17 +1122,17 @@ bool voro_compute<c_class>::corner_test(v_cell &c,double xl,double yl,double zl,
  * \param[in] (yh,zh) the relative y and z coordinates of the corner of the
  *                    block furthest away from the cell center.
  * \return False if the block may intersect, true if does not. */
-template<class c_class>
+template<class c_class,class w_class>
 template<class v_cell>
-inline bool voro_compute<c_class>::edge_x_test(v_cell &c,double x0,double yl,double zl,double x1,double yh,double zh) {
-	con.r_prime(yl*yl+zl*zl);
-	if(c.plane_intersects_guess(x0,yl,zh,con.r_cutoff(yl*yl+zl*zh))) return false;
-	if(c.plane_intersects(x1,yl,zh,con.r_cutoff(yl*yl+zl*zh))) return false;
-	if(c.plane_intersects(x1,yl,zl,con.r_cutoff(yl*yl+zl*zl))) return false;
-	if(c.plane_intersects(x0,yl,zl,con.r_cutoff(yl*yl+zl*zl))) return false;
-	if(c.plane_intersects(x0,yh,zl,con.r_cutoff(yl*yh+zl*zl))) return false;
-	if(c.plane_intersects(x1,yh,zl,con.r_cutoff(yl*yh+zl*zl))) return false;
-	return true;
+inline bool voro_compute<c_class,w_class>::edge_x_test(v_cell &c,double x0,double yl,double zl,double x1,double yh,double zh) {
+	con.r_prime(yl*yl+zl*zl,r_mul,r_val);
+	add_plane(0,x0,yl,zh,con.r_cutoff(yl*yl+zl*zh,r_val));
+	add_plane(1,x1,yl,zh,con.r_cutoff(yl*yl+zl*zh,r_val));
+	add_plane(2,x1,yl,zl,con.r_cutoff(yl*yl+zl*zl,r_val));
+	add_plane(3,x0,yl,zl,con.r_cutoff(yl*yl+zl*zl,r_val));
+	add_plane(4,x0,yh,zl,con.r_cutoff(yl*yh+zl*zl,r_val));
+	add_plane(5,x1,yh,zl,con.r_cutoff(yl*yh+zl*zl,r_val));
+	return !planes_intersect(c,6);
 }
 
 /** This function checks to see whether a particular block can possibly have
@@ -679,17 +1147,17 @@ inline bool voro_compute<c_class>::edge_x_test(v_cell &c,double x0,double yl,dou
  * \param[in] (xh,zh) the relative x and z coordinates of the corner of the
  *                    block furthest away from the cell center.
  * \return False if the block may intersect, true if does not. */
-template<class c_class>
+template<class c_class,class w_class>
 template<class v_cell>
-inline bool voro_compute<c_class>::edge_y_test(v_cell &c,double xl,double y0,double zl,double xh,double y1,double zh) {
-	con.r_prime(xl*xl+zl*zl);
-	if(c.plane_intersects_guess(xl,y0,zh,con.r_cutoff(xl*xl+zl*zh))) return false;
-	if(c.plane_intersects(xl,y1,zh,con.r_cutoff(xl*xl+zl*zh))) return false;
-	if(c.plane_intersects(xl,y1,zl,con.r_cutoff(xl*xl+zl*zl))) return false;
-	if(c.plane_intersects(xl,y0,zl,con.r_cutoff(xl*xl+zl*zl))) return false;
-	if(c.plane_intersects(xh,y0,zl,con.r_cutoff(xl*xh+zl*zl))) return false;
-	if(c.plane_intersects(xh,y1,zl,con.r_cutoff(xl*xh+zl*zl))) return false;
-	return true;
+inline bool voro_compute<c_class,w_class>::edge_y_test(v_cell &c,double xl,double y0,double zl,double xh,double y1,double zh) {
+	con.r_prime(xl*xl+zl*zl,r_mul,r_val);
+	add_plane(0,xl,y0,zh,con.r_cutoff(xl*xl+zl*zh,r_val));
+	add_plane(1,xl,y1,zh,con.r_cutoff(xl*xl+zl*zh,r_val));
+	add_plane(2,xl,y1,zl,con.r_cutoff(xl*xl+zl*zl,r_val));
+	add_plane(3,xl,y0,zl,con.r_cutoff(xl*xl+zl*zl,r_val));
+	add_plane(4,xh,y0,zl,con.r_cutoff(xl*xh+zl*zl,r_val));
+	add_plane(5,xh,y1,zl,con.r_cutoff(xl*xh+zl*zl,r_val));
+	return !planes_intersect(c,6);
 }
 
 /** This function checks to see whether a particular block can possibly have
@@ -703,17 +1171,17 @@ inline bool voro_compute<c_class>::edge_y_test(v_cell &c,double xl,double y0,dou
  * \param[in] (xh,yh) the relative x and y coordinates of the corner of the
  *                    block furthest away from the cell center.
  * \return False if the block may intersect, true if does not. */
-template<class c_class>
+template<class c_class,class w_class>
 template<class v_cell>
-inline bool voro_compute<c_class>::edge_z_test(v_cell &c,double xl,double yl,double z0,double xh,double yh,double z1) {
-	con.r_prime(xl*xl+yl*yl);
-	if(c.plane_intersects_guess(xl,yh,z0,con.r_cutoff(xl*xl+yl*yh))) return false;
-	if(c.plane_intersects(xl,yh,z1,con.r_cutoff(xl*xl+yl*yh))) return false;
-	if(c.plane_intersects(xl,yl,z1,con.r_cutoff(xl*xl+yl*yl))) return false;
-	if(c.plane_intersects(xl,yl,z0,con.r_cutoff(xl*xl+yl*yl))) return false;
-	if(c.plane_intersects(xh,yl,z0,con.r_cutoff(xl*xh+yl*yl))) return false;
-	if(c.plane_intersects(xh,yl,z1,con.r_cutoff(xl*xh+yl*yl))) return false;
-	return true;
+inline bool voro_compute<c_class,w_class>::edge_z_test(v_cell &c,double xl,double yl,double z0,double xh,double yh,double z1) {
+	con.r_prime(xl*xl+yl*yl,r_mul,r_val);
+	add_plane(0,xl,yh,z0,con.r_cutoff(xl*xl+yl*yh,r_val));
+	add_plane(1,xl,yh,z1,con.r_cutoff(xl*xl+yl*yh,r_val));
+	add_plane(2,xl,yl,z1,con.r_cutoff(xl*xl+yl*yl,r_val));
+	add_plane(3,xl,yl,z0,con.r_cutoff(xl*xl+yl*yl,r_val));
+	add_plane(4,xh,yl,z0,con.r_cutoff(xl*xh+yl*yl,r_val));
+	add_plane(5,xh,yl,z1,con.r_cutoff(xl*xh+yl*yl,r_val));
+	return !planes_intersect(c,6);
 }
 
 /** This function checks to see whether a particular block can possibly have
@@ -726,15 +1194,15 @@ inline bool voro_compute<c_class>::edge_z_test(v_cell &c,double xl,double yl,dou
  * \param[in] (z0,z1) the minimum and maximum relative z coordinates of the
  *                    block.
  * \return False if the block may intersect, true if does not. */
-template<class c_class>
+template<class c_class,class w_class>
 template<class v_cell>
-inline bool voro_compute<c_class>::face_x_test(v_cell &c,double xl,double y0,double z0,double y1,double z1) {
-	con.r_prime(xl*xl);
-	if(c.plane_intersects_guess(xl,y0,z0,con.r_cutoff(xl*xl))) return false;
-	if(c.plane_intersects(xl,y0,z1,con.r_cutoff(xl*xl))) return false;
-	if(c.plane_intersects(xl,y1,z1,con.r_cutoff(xl*xl))) return false;
-	if(c.plane_intersects(xl,y1,z0,con.r_cutoff(xl*xl))) return false;
-	return true;
+inline bool voro_compute<c_class,w_class>::face_x_test(v_cell &c,double xl,double y0,double z0,double y1,double z1) {
+	con.r_prime(xl*xl,r_mul,r_val);
+	add_plane(0,xl,y0,z0,con.r_cutoff(xl*xl,r_val));
+	add_plane(1,xl,y0,z1,con.r_cutoff(xl*xl,r_val));
+	add_plane(2,xl,y1,z1,con.r_cutoff(xl*xl,r_val));
+	add_plane(3,xl,y1,z0,con.r_cutoff(xl*xl,r_val));
+	return !planes_intersect(c,4);
 }
 
 /** This function checks to see whether a particular block can possibly have
@@ -747,15 +1215,15 @@ inline bool voro_compute<c_class>::face_x_test(v_cell &c,double xl,double y0,dou
  * \param[in] (z0,z1) the minimum and maximum relative z coordinates of the
  *                    block.
  * \return False if the block may intersect, true if does not. */
-template<class c_class>
+template<class c_class,class w_class>
 template<class v_cell>
-inline bool voro_compute<c_class>::face_y_test(v_cell &c,double x0,double yl,double z0,double x1,double z1) {
-	con.r_prime(yl*yl);
-	if(c.plane_intersects_guess(x0,yl,z0,con.r_cutoff(yl*yl))) return false;
-	if(c.plane_intersects(x0,yl,z1,con.r_cutoff(yl*yl))) return false;
-	if(c.plane_intersects(x1,yl,z1,con.r_cutoff(yl*yl))) return false;
-	if(c.plane_intersects(x1,yl,z0,con.r_cutoff(yl*yl))) return false;
-	return true;
+inline bool voro_compute<c_class,w_class>::face_y_test(v_cell &c,double x0,double yl,double z0,double x1,double z1) {
+	con.r_prime(yl*yl,r_mul,r_val);
+	add_plane(0,x0,yl,z0,con.r_cutoff(yl*yl,r_val));
+	add_plane(1,x0,yl,z1,con.r_cutoff(yl*yl,r_val));
+	add_plane(2,x1,yl,z1,con.r_cutoff(yl*yl,r_val));
+	add_plane(3,x1,yl,z0,con.r_cutoff(yl*yl,r_val));
+	return !planes_intersect(c,4);
 }
 
 /** This function checks to see whether a particular block can possibly have
@@ -768,15 +1236,15 @@ inline bool voro_compute<c_class>::face_y_test(v_cell &c,double x0,double yl,dou
  * \param[in] (y0,y1) the minimum and maximum relative y coordinates of the
  *                    block.
  * \return False if the block may intersect, true if does not. */
-template<class c_class>
+template<class c_class,class w_class>
 template<class v_cell>
-inline bool voro_compute<c_class>::face_z_test(v_cell &c,double x0,double y0,double zl,double x1,double y1) {
-	con.r_prime(zl*zl);
-	if(c.plane_intersects_guess(x0,y0,zl,con.r_cutoff(zl*zl))) return false;
-	if(c.plane_intersects(x0,y1,zl,con.r_cutoff(zl*zl))) return false;
-	if(c.plane_intersects(x1,y1,zl,con.r_cutoff(zl*zl))) return false;
-	if(c.plane_intersects(x1,y0,zl,con.r_cutoff(zl*zl))) return false;
-	return true;
+inline bool voro_compute<c_class,w_class>::face_z_test(v_cell &c,double x0,double y0,double zl,double x1,double y1) {
+	con.r_prime(zl*zl,r_mul,r_val);
+	add_plane(0,x0,y0,zl,con.r_cutoff(zl*zl,r_val));
+	add_plane(1,x0,y1,zl,con.r_cutoff(zl*zl,r_val));
+	add_plane(2,x1,y1,zl,con.r_cutoff(zl*zl,r_val));
+	add_plane(3,x1,y0,zl,con.r_cutoff(zl*zl,r_val));
+	return !planes_intersect(c,4);
 }
 
 /** This routine checks to see whether a point is within a particular distance
@@ -793,8 +1261,8 @@ inline bool voro_compute<c_class>::face_z_test(v_cell &c,double x0,double y0,dou
  * \param[in] mrs the distance to be tested.
  * \return True if the region is further away than mrs, false if the region in
  *         within mrs. */
-template<class c_class>
-bool voro_compute<c_class>::compute_min_max_radius(int di,int dj,int dk,double fx,double fy,double fz,double gxs,double gys,double gzs,double &crs,double mrs) {
+template<class c_class,class w_class>
+bool voro_compute<c_class,w_class>::compute_min_max_radius(int di,int dj,int dk,double fx,double fy,double fz,double gxs,double gys,double gzs,double &crs,double mrs) {
 	double xlo,ylo,zlo;
 	if(di>0) {
 		xlo=di*boxx-fx;
@@ -804,14 +1272,14 @@ bool voro_compute<c_class>::compute_min_max_radius(int di,int dj,int dk,double f
 			crs+=ylo*ylo;
 			if(dk>0) {
 				zlo=dk*boxz-fz;
-				crs+=zlo*zlo;if(con.r_ctest(crs,mrs)) return true;
+				crs+=zlo*zlo;if(con.r_ctest(crs,mrs,r_mul)) return true;
 				crs+=bxsq+2*(boxx*xlo+boxy*ylo+boxz*zlo);
 			} else if(dk<0) {
 				zlo=(dk+1)*boxz-fz;
-				crs+=zlo*zlo;if(con.r_ctest(crs,mrs)) return true;
+				crs+=zlo*zlo;if(con.r_ctest(crs,mrs,r_mul)) return true;
 				crs+=bxsq+2*(boxx*xlo+boxy*ylo-boxz*zlo);
 			} else {
-				if(con.r_ctest(crs,mrs)) return true;
+				if(con.r_ctest(crs,mrs,r_mul)) return true;
 				crs+=boxx*(2*xlo+boxx)+boxy*(2*ylo+boxy)+gzs;
 			}
 		} else if(dj<0) {
@@ -819,27 +1287,27 @@ bool voro_compute<c_class>::compute_min_max_radius(int di,int dj,int dk,double f
 			crs+=ylo*ylo;
 			if(dk>0) {
 				zlo=dk*boxz-fz;
-				crs+=zlo*zlo;if(con.r_ctest(crs,mrs)) return true;
+				crs+=zlo*zlo;if(con.r_ctest(crs,mrs,r_mul)) return true;
 				crs+=bxsq+2*(boxx*xlo-boxy*ylo+boxz*zlo);
 			} else if(dk<0) {
 				zlo=(dk+1)*boxz-fz;
-				crs+=zlo*zlo;if(con.r_ctest(crs,mrs)) return true;
+				crs+=zlo*zlo;if(con.r_ctest(crs,mrs,r_mul)) return true;
 				crs+=bxsq+2*(boxx*xlo-boxy*ylo-boxz*zlo);
 			} else {
-				if(con.r_ctest(crs,mrs)) return true;
+				if(con.r_ctest(crs,mrs,r_mul)) return true;
 				crs+=boxx*(2*xlo+boxx)+boxy*(-2*ylo+boxy)+gzs;
 			}
 		} else {
 			if(dk>0) {
 				zlo=dk*boxz-fz;
-				crs+=zlo*zlo;if(con.r_ctest(crs,mrs)) return true;
+				crs+=zlo*zlo;if(con.r_ctest(crs,mrs,r_mul)) return true;
 				crs+=boxz*(2*zlo+boxz);
 			} else if(dk<0) {
 				zlo=(dk+1)*boxz-fz;
-				crs+=zlo*zlo;if(con.r_ctest(crs,mrs)) return true;
+				crs+=zlo*zlo;if(con.r_ctest(crs,mrs,r_mul)) return true;
 				crs+=boxz*(-2*zlo+boxz);
 			} else {
-				if(con.r_ctest(crs,mrs)) return true;
+				if(con.r_ctest(crs,mrs,r_mul)) return true;
 				crs+=gzs;
 			}
 			crs+=gys+boxx*(2*xlo+boxx);
@@ -852,14 +1320,14 @@ bool voro_compute<c_class>::compute_min_max_radius(int di,int dj,int dk,double f
 			crs+=ylo*ylo;
 			if(dk>0) {
 				zlo=dk*boxz-fz;
-				crs+=zlo*zlo;if(con.r_ctest(crs,mrs)) return true;
+				crs+=zlo*zlo;if(con.r_ctest(crs,mrs,r_mul)) return true;
 				crs+=bxsq+2*(-boxx*xlo+boxy*ylo+boxz*zlo);
 			} else if(dk<0) {
 				zlo=(dk+1)*boxz-fz;
-				crs+=zlo*zlo;if(con.r_ctest(crs,mrs)) return true;
+				crs+=zlo*zlo;if(con.r_ctest(crs,mrs,r_mul)) return true;
 				crs+=bxsq+2*(-boxx*xlo+boxy*ylo-boxz*zlo);
 			} else {
-				if(con.r_ctest(crs,mrs)) return true;
+				if(con.r_ctest(crs,mrs,r_mul)) return true;
 				crs+=boxx*(-2*xlo+boxx)+boxy*(2*ylo+boxy)+gzs;
 			}
 		} else if(dj<0) {
@@ -867,27 +1335,27 @@ bool voro_compute<c_class>::compute_min_max_radius(int di,int dj,int dk,double f
 			crs+=ylo*ylo;
 			if(dk>0) {
 				zlo=dk*boxz-fz;
-				crs+=zlo*zlo;if(con.r_ctest(crs,mrs)) return true;
+				crs+=zlo*zlo;if(con.r_ctest(crs,mrs,r_mul)) return true;
 				crs+=bxsq+2*(-boxx*xlo-boxy*ylo+boxz*zlo);
 			} else if(dk<0) {
 				zlo=(dk+1)*boxz-fz;
-				crs+=zlo*zlo;if(con.r_ctest(crs,mrs)) return true;
+				crs+=zlo*zlo;if(con.r_ctest(crs,mrs,r_mul)) return true;
 				crs+=bxsq+2*(-boxx*xlo-boxy*ylo-boxz*zlo);
 			} else {
-				if(con.r_ctest(crs,mrs)) return true;
+				if(con.r_ctest(crs,mrs,r_mul)) return true;
 				crs+=boxx*(-2*xlo+boxx)+boxy*(-2*ylo+boxy)+gzs;
 			}
 		} else {
 			if(dk>0) {
 				zlo=dk*boxz-fz;
-				crs+=zlo*zlo;if(con.r_ctest(crs,mrs)) return true;
+				crs+=zlo*zlo;if(con.r_ctest(crs,mrs,r_mul)) return true;
 				crs+=boxz*(2*zlo+boxz);
 			} else if(dk<0) {
 				zlo=(dk+1)*boxz-fz;
-				crs+=zlo*zlo;if(con.r_ctest(crs,mrs)) return true;
+				crs+=zlo*zlo;if(con.r_ctest(crs,mrs,r_mul)) return true;
 				crs+=boxz*(-2*zlo+boxz);
 			} else {
-				if(con.r_ctest(crs,mrs)) return true;
+				if(con.r_ctest(crs,mrs,r_mul)) return true;
 				crs+=gzs;
 			}
 			crs+=gys+boxx*(-2*xlo+boxx);
@@ -898,14 +1366,14 @@ bool voro_compute<c_class>::compute_min_max_radius(int di,int dj,int dk,double f
 			crs=ylo*ylo;
 			if(dk>0) {
 				zlo=dk*boxz-fz;
-				crs+=zlo*zlo;if(con.r_ctest(crs,mrs)) return true;
+				crs+=zlo*zlo;if(con.r_ctest(crs,mrs,r_mul)) return true;
 				crs+=boxz*(2*zlo+boxz);
 			} else if(dk<0) {
 				zlo=(dk+1)*boxz-fz;
-				crs+=zlo*zlo;if(con.r_ctest(crs,mrs)) return true;
+				crs+=zlo*zlo;if(con.r_ctest(crs,mrs,r_mul)) return true;
 				crs+=boxz*(-2*zlo+boxz);
 			} else {
-				if(con.r_ctest(crs,mrs)) return true;
+				if(con.r_ctest(crs,mrs,r_mul)) return true;
 				crs+=gzs;
 			}
 			crs+=boxy*(2*ylo+boxy);
@@ -914,23 +1382,23 @@ bool voro_compute<c_class>::compute_min_max_radius(int di,int dj,int dk,double f
 			crs=ylo*ylo;
 			if(dk>0) {
 				zlo=dk*boxz-fz;
-				crs+=zlo*zlo;if(con.r_ctest(crs,mrs)) return true;
+				crs+=zlo*zlo;if(con.r_ctest(crs,mrs,r_mul)) return true;
 				crs+=boxz*(2*zlo+boxz);
 			} else if(dk<0) {
 				zlo=(dk+1)*boxz-fz;
-				crs+=zlo*zlo;if(con.r_ctest(crs,mrs)) return true;
+				crs+=zlo*zlo;if(con.r_ctest(crs,mrs,r_mul)) return true;
 				crs+=boxz*(-2*zlo+boxz);
 			} else {
-				if(con.r_ctest(crs,mrs)) return true;
+				if(con.r_ctest(crs,mrs,r_mul)) return true;
 				crs+=gzs;
 			}
 			crs+=boxy*(-2*ylo+boxy);
 		} else {
 			if(dk>0) {
-				zlo=dk*boxz-fz;crs=zlo*zlo;if(con.r_ctest(crs,mrs)) return true;
+				zlo=dk*boxz-fz;crs=zlo*zlo;if(con.r_ctest(crs,mrs,r_mul)) return true;
 				crs+=boxz*(2*zlo+boxz);
 			} else if(dk<0) {
-				zlo=(dk+1)*boxz-fz;crs=zlo*zlo;if(con.r_ctest(crs,mrs)) return true;
+				zlo=(dk+1)*boxz-fz;crs=zlo*zlo;if(con.r_ctest(crs,mrs,r_mul)) return true;
 				crs+=boxz*(-2*zlo+boxz);
 			} else {
 				crs=0;
@@ -943,8 +1411,8 @@ bool voro_compute<c_class>::compute_min_max_radius(int di,int dj,int dk,double f
 	return false;
 }
 
-template<class c_class>
-bool voro_compute<c_class>::compute_min_radius(int di,int dj,int dk,double fx,double fy,double fz,double mrs) {
+template<class c_class,class w_class>
+bool voro_compute<c_class,w_class>::compute_min_radius(int di,int dj,int dk,double fx,double fy,double fz,double mrs) {
 	double t,crs;
 
 	if(di>0) {t=di*boxx-fx;crs=t*t;}
@@ -963,8 +1431,8 @@ bool voro_compute<c_class>::compute_min_radius(int di,int dj,int dk,double fx,do
 /** Adds memory to the queue.
  * \param[in,out] qu_s a reference to the queue start pointer.
  * \param[in,out] qu_e a reference to the queue end pointer. */
-template<class c_class>
-inline void voro_compute<c_class>::add_list_memory(int*& qu_s,int*& qu_e) {
+template<class c_class,class w_class>
+inline void voro_compute<c_class,w_class>::add_list_memory(int*& qu_s,int*& qu_e) {
 	qu_size<<=1;
 	int *qu_n=new int[qu_size],*qu_c=qu_n;
 #if VOROPP_VERBOSE >=2
@@ -986,20 +1454,74 @@ inline void voro_compute<c_class>::add_list_memory(int*& qu_s,int*& qu_e) {
 template voro_compute<container>::voro_compute(container&,int,int,int);
 template voro_compute<container_poly>::voro_compute(container_poly&,int,int,int);
 template bool voro_compute<container>::compute_cell(voronoicell&,int,int,int,int,int);
+template bool voro_compute<container>::compute_cell(voronoicell&,int,int,int,int,int,const int*,const int*);
 template bool voro_compute<container>::compute_cell(voronoicell_neighbor&,int,int,int,int,int);
-template void voro_compute<container>::find_voronoi_cell(double,double,double,int,int,int,int,particle_record&,double&);
+template bool voro_compute<container>::compute_cell(voronoicell_neighbor&,int,int,int,int,int,const int*,const int*);
+template bool voro_compute<container>::compute_ghost_cell(voronoicell&,double,double,double,double,int,int,int,int);
+template bool voro_compute<container>::compute_ghost_cell(voronoicell_neighbor&,double,double,double,double,int,int,int,int);
+template void voro_compute<container>::find_voronoi_cell(double,double,double,int,int,int,int,particle_record&,double&,bool);
+template void voro_compute<container>::find_neighbors(double,double,double,int,int,int,int,int,double,std::vector<neighbor_record>&);
 template bool voro_compute<container_poly>::compute_cell(voronoicell&,int,int,int,int,int);
+template bool voro_compute<container_poly>::compute_cell(voronoicell&,int,int,int,int,int,const int*,const int*);
 template bool voro_compute<container_poly>::compute_cell(voronoicell_neighbor&,int,int,int,int,int);
-template void voro_compute<container_poly>::find_voronoi_cell(double,double,double,int,int,int,int,particle_record&,double&);
+template bool voro_compute<container_poly>::compute_cell(voronoicell_neighbor&,int,int,int,int,int,const int*,const int*);
+template bool voro_compute<container_poly>::compute_ghost_cell(voronoicell&,double,double,double,double,int,int,int,int);
+template bool voro_compute<container_poly>::compute_ghost_cell(voronoicell_neighbor&,double,double,double,double,int,int,int,int);
+template void voro_compute<container_poly>::find_voronoi_cell(double,double,double,int,int,int,int,particle_record&,double&,bool);
+template void voro_compute<container_poly>::find_neighbors(double,double,double,int,int,int,int,int,double,std::vector<neighbor_record>&);
 
 // Explicit template instantiation
 template voro_compute<container_periodic>::voro_compute(container_periodic&,int,int,int);
 template voro_compute<container_periodic_poly>::voro_compute(container_periodic_poly&,int,int,int);
 template bool voro_compute<container_periodic>::compute_cell(voronoicell&,int,int,int,int,int);
+template bool voro_compute<container_periodic>::compute_cell(voronoicell&,int,int,int,int,int,const int*,const int*);
 template bool voro_compute<container_periodic>::compute_cell(voronoicell_neighbor&,int,int,int,int,int);
-template void voro_compute<container_periodic>::find_voronoi_cell(double,double,double,int,int,int,int,particle_record&,double&);
+template bool voro_compute<container_periodic>::compute_cell(voronoicell_neighbor&,int,int,int,int,int,const int*,const int*);
+template void voro_compute<container_periodic>::find_voronoi_cell(double,double,double,int,int,int,int,particle_record&,double&,bool);
+template void voro_compute<container_periodic>::find_neighbors(double,double,double,int,int,int,int,int,double,std::vector<neighbor_record>&);
 template bool voro_compute<container_periodic_poly>::compute_cell(voronoicell&,int,int,int,int,int);
+template bool voro_compute<container_periodic_poly>::compute_cell(voronoicell&,int,int,int,int,int,const int*,const int*);
 template bool voro_compute<container_periodic_poly>::compute_cell(voronoicell_neighbor&,int,int,int,int,int);
-template void voro_compute<container_periodic_poly>::find_voronoi_cell(double,double,double,int,int,int,int,particle_record&,double&);
+template bool voro_compute<container_periodic_poly>::compute_cell(voronoicell_neighbor&,int,int,int,int,int,const int*,const int*);
+template void voro_compute<container_periodic_poly>::find_voronoi_cell(double,double,double,int,int,int,int,particle_record&,double&,bool);
+template void voro_compute<container_periodic_poly>::find_neighbors(double,double,double,int,int,int,int,int,double,std::vector<neighbor_record>&);
+
+// Explicit template instantiation for the alternative worklists
+template voro_compute<container,worklist_variant<2,32> >::voro_compute(container&,int,int,int);
+template bool voro_compute<container,worklist_variant<2,32> >::compute_cell(voronoicell&,int,int,int,int,int);
+template bool voro_compute<container,worklist_variant<2,32> >::compute_cell(voronoicell_neighbor&,int,int,int,int,int);
+template voro_compute<container_poly,worklist_variant<2,32> >::voro_compute(container_poly&,int,int,int);
+template bool voro_compute<container_poly,worklist_variant<2,32> >::compute_cell(voronoicell&,int,int,int,int,int);
+template bool voro_compute<container_poly,worklist_variant<2,32> >::compute_cell(voronoicell_neighbor&,int,int,int,int,int);
+template voro_compute<container_periodic,worklist_variant<2,32> >::voro_compute(container_periodic&,int,int,int);
+template bool voro_compute<container_periodic,worklist_variant<2,32> >::compute_cell(voronoicell&,int,int,int,int,int);
+template bool voro_compute<container_periodic,worklist_variant<2,32> >::compute_cell(voronoicell_neighbor&,int,int,int,int,int);
+template voro_compute<container_periodic_poly,worklist_variant<2,32> >::voro_compute(container_periodic_poly&,int,int,int);
+template bool voro_compute<container_periodic_poly,worklist_variant<2,32> >::compute_cell(voronoicell&,int,int,int,int,int);
+template bool voro_compute<container_periodic_poly,worklist_variant<2,32> >::compute_cell(voronoicell_neighbor&,int,int,int,int,int);
+template voro_compute<container,worklist_variant<4,128> >::voro_compute(container&,int,int,int);
+template bool voro_compute<container,worklist_variant<4,128> >::compute_cell(voronoicell&,int,int,int,int,int);
+template bool voro_compute<container,worklist_variant<4,128> >::compute_cell(voronoicell_neighbor&,int,int,int,int,int);
+template voro_compute<container_poly,worklist_variant<4,128> >::voro_compute(container_poly&,int,int,int);
+template bool voro_compute<container_poly,worklist_variant<4,128> >::compute_cell(voronoicell&,int,int,int,int,int);
+template bool voro_compute<container_poly,worklist_variant<4,128> >::compute_cell(voronoicell_neighbor&,int,int,int,int,int);
+template voro_compute<container_periodic,worklist_variant<4,128> >::voro_compute(container_periodic&,int,int,int);
+template bool voro_compute<container_periodic,worklist_variant<4,128> >::compute_cell(voronoicell&,int,int,int,int,int);
+template bool voro_compute<container_periodic,worklist_variant<4,128> >::compute_cell(voronoicell_neighbor&,int,int,int,int,int);
+template voro_compute<container_periodic_poly,worklist_variant<4,128> >::voro_compute(container_periodic_poly&,int,int,int);
+template bool voro_compute<container_periodic_poly,worklist_variant<4,128> >::compute_cell(voronoicell&,int,int,int,int,int);
+template bool voro_compute<container_periodic_poly,worklist_variant<4,128> >::compute_cell(voronoicell_neighbor&,int,int,int,int,int);
+template voro_compute<container,worklist_variant<8,64> >::voro_compute(container&,int,int,int);
+template bool voro_compute<container,worklist_variant<8,64> >::compute_cell(voronoicell&,int,int,int,int,int);
+template bool voro_compute<container,worklist_variant<8,64> >::compute_cell(voronoicell_neighbor&,int,int,int,int,int);
+template voro_compute<container_poly,worklist_variant<8,64> >::voro_compute(container_poly&,int,int,int);
+template bool voro_compute<container_poly,worklist_variant<8,64> >::compute_cell(voronoicell&,int,int,int,int,int);
+template bool voro_compute<container_poly,worklist_variant<8,64> >::compute_cell(voronoicell_neighbor&,int,int,int,int,int);
+template voro_compute<container_periodic,worklist_variant<8,64> >::voro_compute(container_periodic&,int,int,int);
+template bool voro_compute<container_periodic,worklist_variant<8,64> >::compute_cell(voronoicell&,int,int,int,int,int);
+template bool voro_compute<container_periodic,worklist_variant<8,64> >::compute_cell(voronoicell_neighbor&,int,int,int,int,int);
+template voro_compute<container_periodic_poly,worklist_variant<8,64> >::voro_compute(container_periodic_poly&,int,int,int);
+template bool voro_compute<container_periodic_poly,worklist_variant<8,64> >::compute_cell(voronoicell&,int,int,int,int,int);
+template bool voro_compute<container_periodic_poly,worklist_variant<8,64> >::compute_cell(voronoicell_neighbor&,int,int,int,int,int);
 
 }
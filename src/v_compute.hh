@@ -10,6 +10,8 @@
 #ifndef VOROPP_V_COMPUTE_HH
 #define VOROPP_V_COMPUTE_HH
 
+#include <vector>
+
 #include "config.hh"
 #include "worklist.hh"
 #include "cell.hh"
@@ -34,8 +36,37 @@ struct particle_record {
 	int dk;
 };
 
-/** \brief Template for carrying out Voronoi cell computations. */
-template <class c_class>
+/** \brief Structure for holding information about a neighbor found by a
+ * search.
+ *
+ * This small structure holds a particle found by the k-nearest-neighbor and
+ * fixed-radius searches in the voro_compute template. The position of the
+ * particle is stored as a displacement from the search vector, so that it
+ * refers to the correct periodic image. */
+struct neighbor_record {
+	/** The squared distance from the search vector to the particle. */
+	double rs;
+	/** The index of the block that the particle is within. */
+	int ijk;
+	/** The number of the particle within its block. */
+	int l;
+	/** The x component of the displacement to the particle. */
+	double x;
+	/** The y component of the displacement to the particle. */
+	double y;
+	/** The z component of the displacement to the particle. */
+	double z;
+	/** Compares two records by their distance, so that they can be
+	 * kept in a heap with the furthest at the top. */
+	inline bool operator<(const neighbor_record &o) const {return rs<o.rs;}
+};
+
+/** \brief Template for carrying out Voronoi cell computations.
+ *
+ * The second template parameter selects the set of block worklists that is
+ * used to search for the particles that cut each cell, which can be any of the
+ * worklist_variant classes defined in worklist.hh. */
+template <class c_class,class w_class=worklist_default>
 class voro_compute {
 	public:
 		/** A reference to the container class on which to carry out*/
@@ -76,24 +107,39 @@ class voro_compute {
 		const int ps;
 		/** This array holds the numerical IDs of each particle in each
 		 * computational box. */
-		int **id;
+		voro_id **id;
 		/** A two dimensional array holding particle positions. For the
 		 * derived container_poly class, this also holds particle
 		 * radii. */
-		double **p;
+		fpoint **p;
 		/** An array holding the number of particles within each
 		 * computational box of the container. */
 		int *co;
+		/** Counters for the events in the cell computations carried
+		 * out by this class, including those of the cells themselves,
+		 * which are only updated if VOROPP_COUNTERS is set. */
+		voro_counters counters;
 		voro_compute(c_class &con_,int hx_,int hy_,int hz_);
 		/** The class destructor frees the dynamically allocated memory
-		 * for the mask and queue. */
+		 * for the mask and queue, and for the worklist distances if
+		 * they are not shared with the container. If counting is
+		 * switched on, the counters are added to the container. */
 		~voro_compute() {
+#if VOROPP_COUNTERS
+			con.merge_counters(counters);
+#endif
 			delete [] qu;
 			delete [] mask;
+			if(mrad!=con.mrad) delete [] mrad;
 		}
 		template<class v_cell>
 		bool compute_cell(v_cell &c,int ijk,int s,int ci,int cj,int ck);
-		void find_voronoi_cell(double x,double y,double z,int ci,int cj,int ck,int ijk,particle_record &w,double &mrs);
+		template<class v_cell>
+		bool compute_cell(v_cell &c,int ijk,int s,int ci,int cj,int ck,const int *sp,const int *se);
+		template<class v_cell>
+		bool compute_ghost_cell(v_cell &c,double x,double y,double z,double r,int ijk,int ci,int cj,int ck);
+		void find_voronoi_cell(double x,double y,double z,int ci,int cj,int ck,int ijk,particle_record &w,double &mrs,bool warm=false);
+		void find_neighbors(double x,double y,double z,int ci,int cj,int ck,int ijk,int k,double rsq,std::vector<neighbor_record> &nr);
 	private:
 		/** A constant set to boxx*boxx+boxy*boxy+boxz*boxz, which is
 		 * frequently used in the computation. */
@@ -106,7 +152,9 @@ class voro_compute {
 		/** A pointer to the array of worklists. */
 		const unsigned int *wl;
 		/** An pointer to the array holding the minimum distances
-		 * associated with the worklists. */
+		 * associated with the worklists. If the default worklists are
+		 * used then this is shared with the container, and otherwise
+		 * it is computed by the constructor. */
 		double *mrad;
 		/** This array is used during the cell computation to determine
 		 * which blocks have been considered. */
@@ -117,6 +165,184 @@ class voro_compute {
 		/** A pointer to the end of the queue array, used to determine
 		 * when the queue is full. */
 		int *qu_l;
+		/** The radius-dependent constants for the cell currently being
+		 * computed, which are set up by the container's r_init and
+		 * r_prime routines. They are stored here rather than in the
+		 * container so that several instances of this class can work
+		 * on the same container at once. */
+		double r_rad,r_mul,r_val;
+		/** Pointers to the start and end of the seed particles for the
+		 * cell currently being computed, given as pairs of the block
+		 * index and the index within the block. These are equal if
+		 * there are no seed particles. */
+		const int *wsp,*wse;
+		/** The displacement vectors of the seed particles, in groups
+		 * of three. */
+		std::vector<double> wsd;
+		/** Moves the counters of a cell that has just been computed
+		 * to this class, if counting is switched on.
+		 * \param[in] c a reference to the Voronoi cell.
+		 * \param[in] b the result of the computation.
+		 * \return The result of the computation. */
+		template<class v_cell>
+		inline bool collect_counters(v_cell &c,bool b) {
+#if VOROPP_COUNTERS
+			counters.cells++;
+			counters.merge(c.counters);
+			c.counters.clear();
+#endif
+			return b;
+		}
+		/** Checks whether a block holds any of the seed particles.
+		 * \param[in] ijk the index of the block.
+		 * \return True if it does, false otherwise. */
+		inline bool seed_block(int ijk) {
+			for(const int *sp=wsp;sp<wse;sp+=2) if(*sp==ijk) return true;
+			return false;
+		}
+		/** Checks whether a particle is a seed particle that has
+		 * already been cut at the same periodic image, so that it can
+		 * be skipped.
+		 * \param[in] (ijk,l) the block and the index of the particle
+		 *		      within the block.
+		 * \param[in] (x,y,z) the displacement vector to the particle.
+		 * \return True if it can be skipped, false otherwise. */
+		inline bool seed_skip(int ijk,int l,double x,double y,double z) {
+			const double *dp=&wsd[0];
+			for(const int *sp=wsp;sp<wse;sp+=2,dp+=3) if(*sp==ijk&&sp[1]==l) {
+				x-=*dp;y-=dp[1];z-=dp[2];
+				if(x*x+y*y+z*z<tolerance*bxsq) return true;
+			}
+			return false;
+		}
+		/** The value of the container's update counter when the block
+		 * radius bounds were last valid. */
+		unsigned int bru;
+		/** The current value being used to mark valid entries in the
+		 * block radius bounds. */
+		unsigned int bmg;
+		/** The largest particle radius in each block of the container,
+		 * computed when a block is first needed. This is only used by
+		 * the containers for the radical Voronoi tessellation. */
+		std::vector<double> bmr;
+		/** Marks which entries of bmr are valid, by storing the value
+		 * of bmg when each was computed. */
+		std::vector<unsigned int> bmv;
+		/** The largest particle radius in the neighborhood of each
+		 * block, computed when a cell in the block is first needed. */
+		std::vector<double> blr;
+		/** Marks which entries of blr are valid, by storing the value
+		 * of bmg when each was computed. */
+		std::vector<unsigned int> blv;
+		/** The square of a lower bound on the distance from a particle
+		 * to any block outside the neighborhood of its own block. */
+		double lbd;
+		/** Whether r_mul has been switched to the largest radius in
+		 * the neighborhood, for the cell currently being computed. */
+		bool lb;
+		/** Returns the largest particle radius in a block, computing
+		 * and storing it the first time that the block is considered.
+		 * The stored radii are discarded when the container's update
+		 * counter changes.
+		 * \param[in] ijk the index of the block in the container.
+		 * \return The largest radius. */
+		inline double block_max_radius(int ijk) {
+			if(bru!=con.update_count) {
+				bru=con.update_count;
+				if(++bmg==0) {
+					bmv.assign(bmv.size(),0);
+					blv.assign(blv.size(),0);
+					bmg=1;
+				}
+			}
+			if(ijk>=(int) bmv.size()) {bmv.resize(ijk+1,0);bmr.resize(ijk+1);}
+			if(bmv[ijk]!=bmg) {bmr[ijk]=con.r_block_max(ijk,co[ijk]);bmv[ijk]=bmg;}
+			return bmr[ijk];
+		}
+		/** Once a cell is small enough that no particle outside the
+		 * neighborhood of its block could cut it, even with the
+		 * largest radius in the container, switches r_mul to use the
+		 * largest radius in the neighborhood instead. Since the cell
+		 * only shrinks, this stays valid for the rest of the
+		 * computation. The radius of a ghost particle may exceed that
+		 * of its neighbors, so the bound is never made smaller than
+		 * its own radius. Fewer particles may then be tested against
+		 * the cell, so that its vertices can differ by roundoff from
+		 * those found using the global maximum. This is only used by
+		 * the containers for the radical Voronoi tessellation.
+		 * \param[in] ijk the block of the cell.
+		 * \param[in] (ci,cj,ck) the coordinates of the block of the
+		 *			 cell relative to the container.
+		 * \param[in] (i,j,k) the coordinates of the block of the cell
+		 *		      relative to the mask.
+		 * \param[in] disp a block displacement set by the container.
+		 * \param[in] mrs the current maximum distance to a Voronoi
+		 *		  vertex multiplied by two. */
+		inline void local_bound(int ijk,int ci,int cj,int ck,int i,int j,int k,int disp,double mrs) {
+			if(!c_class::r_block_bound||lb||!con.r_ctest(lbd,mrs,r_mul)) return;
+			double lr=local_max_radius(ijk,ci,cj,ck,i,j,k,disp);
+			r_mul=r_rad-lr*lr;
+			if(r_mul>0) r_mul=0;
+			lb=true;
+		}
+		double local_max_radius(int ijk,int ci,int cj,int ck,int i,int j,int k,int disp);
+		/** The number of regions of empty_region_blocks blocks that
+		 * the container is divided into in the x direction. */
+		const int rx;
+		/** The number of regions in the y direction. */
+		const int ry;
+		/** The value of the container's update counter when the
+		 * region counts were last computed. */
+		unsigned int rcu;
+		/** Whether the container is sparse enough for its empty
+		 * regions to be used. */
+		bool rsp;
+		/** The number of particles in each region of the container,
+		 * or an empty vector if the counts have not been computed. */
+		std::vector<int> rc;
+		/** Marks the empty regions that have been dealt with for the
+		 * cell currently being computed, by storing the value of mv at
+		 * the position of the lower corner of each region in the
+		 * mask. */
+		std::vector<unsigned int> rv;
+		/** The planes to be tested against the cell when checking
+		 * whether a block can be skipped, stored as consecutive x, y,
+		 * z, and distance arrays of length plane_block. */
+		double pb[4*plane_block];
+		/** Stores a plane to be tested against the cell.
+		 * \param[in] q the index of the plane.
+		 * \param[in] (x,y,z) the normal vector to the plane.
+		 * \param[in] rs the distance along this vector of the plane. */
+		inline void add_plane(int q,double x,double y,double z,double rs) {
+			pb[q]=x;pb[plane_block+q]=y;pb[2*plane_block+q]=z;pb[3*plane_block+q]=rs;
+		}
+		/** Pads the stored planes with ones that cannot intersect, and
+		 * tests them all against the cell.
+		 * \param[in] c a reference to the Voronoi cell.
+		 * \param[in] n the number of planes that have been stored.
+		 * \return True if any plane intersects the cell, false
+		 * otherwise. */
+		template<class v_cell>
+		inline bool planes_intersect(v_cell &c,int n) {
+			for(int q=n;q<plane_block;q++) add_plane(q,0,0,0,large_number);
+			return c.planes_intersect_guess(n,pb);
+		}
+		template<class v_cell>
+		bool compute_cell(v_cell &c,int ijk,int s,int ci,int cj,int ck,int i,int j,int k,double x,double y,double z,int disp);
+		template<class v_cell>
+		inline bool box_test(v_cell &c,int si,int sj,int sk,double xlo,double ylo,double zlo,double xhi,double yhi,double zhi);
+		template<class v_cell>
+		bool skip_empty_region(v_cell &c,int ci,int cj,int ck,int i,int j,int k,int ei,int ej,int ek,double fx,double fy,double fz,int *&qu_s,int *&qu_e);
+		void count_regions();
+		/** Checks whether the empty regions of the container should be
+		 * used, recomputing the region counts if the container has
+		 * changed since they were last computed.
+		 * \return True if the regions should be used, false
+		 * otherwise. */
+		inline bool sparse_regions() {
+			if(rcu!=con.update_count||rc.empty()) count_regions();
+			return rsp;
+		}
 		template<class v_cell>
 		bool corner_test(v_cell &c,double xl,double yl,double zl,double xh,double yh,double zh);
 		template<class v_cell>
@@ -134,16 +360,81 @@ class voro_compute {
 		bool compute_min_max_radius(int di,int dj,int dk,double fx,double fy,double fz,double gx,double gy,double gz,double& crs,double mrs);
 		bool compute_min_radius(int di,int dj,int dk,double fx,double fy,double fz,double mrs);
 		inline void add_to_mask(int ei,int ej,int ek,int *&qu_e);
+		/** Adds a block to the queue and marks it on the mask, if it
+		 * hasn't already been marked.
+		 * \param[in] (ei,ej,ek) the block to consider.
+		 * \param[in,out] qu_e a pointer to the end of the queue. */
+		inline void queue_block(int ei,int ej,int ek,int *&qu_e) {
+			unsigned int *mijk=mask+ei+hx*(ej+hy*ek);
+			if(*mijk!=mv) {
+				if(qu_e==qu_l) qu_e=qu;
+				*mijk=mv;*(qu_e++)=ei;*(qu_e++)=ej;*(qu_e++)=ek;
+			}
+		}
 		inline void scan_bits_mask_add(unsigned int q,unsigned int *mijk,int ei,int ej,int ek,int *&qu_e);
 		inline void scan_all(int ijk,double x,double y,double z,int di,int dj,int dk,particle_record &w,double &mrs);
+		inline void scan_neighbors(int ijk,double x,double y,double z,int k,std::vector<neighbor_record> &nr,double &mrs);
+		void neighbor_search(double x,double y,double z,int ci,int cj,int ck,int ijk,int k,std::vector<neighbor_record> &nr,double &mrs);
+		/** Computes the squared distance from a vector to a block,
+		 * which is zero for the block that the vector is within.
+		 * \param[in] (di,dj,dk) the position of the block relative to
+		 *			 the block of the vector.
+		 * \param[in] (fx,fy,fz) the position of the vector relative
+		 *			 to the lower corner of its block.
+		 * \return The squared distance. */
+		inline double block_distance(int di,int dj,int dk,double fx,double fy,double fz) {
+			double t,crs=0;
+			if(di>0) {t=di*boxx-fx;crs=t*t;}
+			else if(di<0) {t=(di+1)*boxx-fx;crs=t*t;}
+			if(dj>0) {t=dj*boxy-fy;crs+=t*t;}
+			else if(dj<0) {t=(dj+1)*boxy-fy;crs+=t*t;}
+			if(dk>0) {t=dk*boxz-fz;crs+=t*t;}
+			else if(dk<0) {t=(dk+1)*boxz-fz;crs+=t*t;}
+			return crs;
+		}
 		void add_list_memory(int*& qu_s,int*& qu_e);
 		/** Resets the mask in cases where the mask counter wraps
 		 * around. */
 		inline void reset_mask() {
 			for(unsigned int *mp(mask);mp<mask+hxyz;mp++) *mp=0;
+			rv.assign(rv.size(),0);
 		}
 };
 
+/** \brief A set of independent voro_compute classes bound to one container.
+ *
+ * This class holds a number of voro_compute classes that all refer to the
+ * same container. Each has its own search mask and queue, so that separate
+ * threads can compute Voronoi cells concurrently without copying the particle
+ * data. The container must not be modified while the pool is in use. */
+template <class c_class>
+class voro_compute_pool {
+	public:
+		/** The number of voro_compute classes in the pool. */
+		const int n;
+		/** The class constructor creates the voro_compute classes.
+		 * \param[in] con the container to bind them to.
+		 * \param[in] n_ the number of classes to create, which would
+		 *		typically be the number of threads. */
+		voro_compute_pool(c_class &con,int n_) : n(n_),
+			vcs(new voro_compute<c_class>*[n_]) {
+			for(int i=0;i<n;i++) vcs[i]=con.new_compute();
+		}
+		/** The class destructor frees the voro_compute classes. */
+		~voro_compute_pool() {
+			for(int i=n-1;i>=0;i--) delete vcs[i];
+			delete [] vcs;
+		}
+		/** Returns one of the voro_compute classes in the pool.
+		 * \param[in] i the index of the class, typically the thread
+		 *		 number.
+		 * \return A reference to the class. */
+		inline voro_compute<c_class>& operator[](int i) {return *vcs[i];}
+	private:
+		/** An array of pointers to the voro_compute classes. */
+		voro_compute<c_class> **vcs;
+};
+
 }
 
 #endif
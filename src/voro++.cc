@@ -9,6 +9,15 @@
 
 #include "cell.cc"
 #include "common.cc"
+#include "particle_file.cc"
+#include "text_reader.cc"
+#include "format.cc"
+#include "column_writer.cc"
+#include "mesh.cc"
+#include "state_file.cc"
+#include "slab_stream.cc"
+#include "pipeline.cc"
+#include "container_oct.cc"
 #include "v_base.cc"
 #include "container.cc"
 #include "unitcell.cc"
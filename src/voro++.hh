@@ -289,7 +289,19 @@
  * c_loop_all_periodic class, that is specifically for use with the
  * container_periodic and container_periodic_poly classes. Since the data
  * structures of these containers differ considerably, it requires a different
- * loop class that is not interoperable with the others.
+ * loop class that is not interoperable with the others. Likewise, the
+ * c_loop_subset_periodic class loops over the particles of a periodic
+ * container that lie in a rectangular box or sphere.
+ *
+ * The subset loops can also be passed to for_each_cell() with the
+ * exec_parallel policy, in which case the blocks that they visit are shared
+ * out among several threads.
+ *
+ * On machines with several memory nodes, the place_particle_memory() routine
+ * of the containers can be called once the particles have been added. It moves
+ * the particles of each block to the memory node of the thread that computes
+ * them. The threads should then be bound to processors, either by compiling
+ * with VOROPP_NUMA set to 1 or with the OMP_PROC_BIND environment variable.
  *
  * \section pre_container The pre_container classes
  * Voro++ makes use of internal computational grid of blocks that are used to
@@ -329,5 +341,32 @@
 #include "v_compute.hh"
 #include "c_loops.hh"
 #include "wall.hh"
+#include "domain.hh"
+#include "snapshot.hh"
+#include "incremental.hh"
+#include "query.hh"
+#include "warm_start.hh"
+#include "particle_file.hh"
+#include "shm_ring.hh"
+#include "text_reader.hh"
+#include "format.hh"
+#include "column_writer.hh"
+#include "mesh.hh"
+#include "state_file.hh"
+#include "slab_stream.hh"
+#include "pipeline.hh"
+#include "container_oct.hh"
+#include "cell_2d.hh"
+#include "container_2d.hh"
+#include "wall_mesh.hh"
+#include "delaunay.hh"
+#include "lloyd.hh"
+#include "neighbor_query.hh"
+#include "cell_stats.hh"
+#include "trace.hh"
+#include "for_each.hh"
+#include "batch.hh"
+#include "neighbor_graph.hh"
+#include "voro_c.h"
 
 #endif
@@ -0,0 +1,220 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file voro_c.cc
+ * \brief Function implementations for the C interface to the library. */
+
+#include "voro_c.h"
+#include "container.hh"
+#include "for_each.hh"
+#include "neighbor_graph.hh"
+
+using namespace voro;
+
+/** \brief The data behind a tessellation handle of the C interface.
+ *
+ * This holds the geometry of the domain, and a container and a
+ * neighbor_graph that are kept between calls. The container is only
+ * reallocated when the domain, the grid size that suits the number of
+ * particles, or the use of radii changes. Otherwise it is cleared and
+ * refilled, keeping the memory that its blocks have grown to. */
+struct voro_c_tess {
+	/** The minimum and maximum coordinates of the domain. */
+	double ax,bx,ay,by,az,bz;
+	/** Whether the domain is periodic in each direction. */
+	const bool xperiodic,yperiodic,zperiodic;
+	/** The number of threads to use. */
+	int nt;
+	/** The grid size of the current container. */
+	int nx,ny,nz;
+	/** The current container for particles without radii, or NULL if
+	 * there is none. */
+	container *con;
+	/** The current container for particles with radii, or NULL if there
+	 * is none. */
+	container_poly *conp;
+	/** The neighbor graph that is filled in by each computation. */
+	neighbor_graph g;
+	voro_c_tess(double ax_,double bx_,double ay_,double by_,double az_,double bz_,
+		    bool xperiodic_,bool yperiodic_,bool zperiodic_)
+		: ax(ax_), bx(bx_), ay(ay_), by(by_), az(az_), bz(bz_),
+		xperiodic(xperiodic_), yperiodic(yperiodic_), zperiodic(zperiodic_),
+		nt(1), nx(0), ny(0), nz(0), con(NULL), conp(NULL) {}
+	~voro_c_tess() {
+		delete conp;
+		delete con;
+	}
+	void reset() {
+		delete conp;conp=NULL;
+		delete con;con=NULL;
+	}
+	void setup(int n,bool poly);
+};
+
+/** Makes sure that there is an empty container of the right type, with a
+ * grid size that suits a given number of particles.
+ * \param[in] n the number of particles.
+ * \param[in] poly whether the particles have radii. */
+void voro_c_tess::setup(int n,bool poly) {
+	double dx=bx-ax,dy=by-ay,dz=bz-az;
+	double ilscale=pow((n>0?n:1)/(optimal_particles*dx*dy*dz),1/3.0);
+	int mx=int(dx*ilscale+1),my=int(dy*ilscale+1),mz=int(dz*ilscale+1);
+	if(mx!=nx||my!=ny||mz!=nz||(poly?conp==NULL:con==NULL)) {
+		reset();
+		nx=mx;ny=my;nz=mz;
+		if(poly) conp=new container_poly(ax,bx,ay,by,az,bz,nx,ny,nz,xperiodic,yperiodic,zperiodic,int(2*optimal_particles));
+		else con=new container(ax,bx,ay,by,az,bz,nx,ny,nz,xperiodic,yperiodic,zperiodic,int(2*optimal_particles));
+	} else if(poly) conp->clear();
+	else con->clear();
+}
+
+/** \brief A function object that stores the volume of each Voronoi cell in a
+ * caller-provided array, indexed by the particle ID. */
+struct voro_c_volume {
+	/** The array to store the volumes in. */
+	double *vol;
+	voro_c_volume(double *vol_) : vol(vol_) {}
+	inline void operator()(voronoicell &c,voro_id id,double x,double y,double z) {
+		vol[id]=c.volume();
+	}
+};
+
+/** Computes the cells of the particles in a container, and scatters the
+ * results into the caller's buffers in the order of the particle IDs.
+ * \param[in] t the tessellation handle.
+ * \param[in] cn the container, which holds the particles.
+ * \param[in] n the number of particles.
+ * \param[out] (vol,nb_off,nb,nb_cap,nb_area,flags) the buffers to fill in, as
+ *		   described for voro_c_compute().
+ * \return The status code. */
+template<class c_class>
+static int voro_c_run(voro_c_tess *t,c_class &cn,int n,double *vol,int *nb_off,int *nb,int nb_cap,double *nb_area,int flags) {
+	int i,r,e,o;
+	if(vol!=NULL) for(i=0;i<n;i++) vol[i]=0;
+
+	// If only the volumes are needed, then the faces of the cells do not
+	// have to be traversed
+	if(nb_off==NULL) {
+		if(vol!=NULL) {
+			voro_c_volume f(vol);
+			for_each_cell<voronoicell>(cn,f,exec_parallel(t->nt));
+		}
+		return VORO_C_OK;
+	}
+
+	// Compute the neighbor graph, and use the degrees of its rows to set
+	// up the offsets in particle ID order
+	neighbor_graph &g=t->g;
+	g.mode=(vol!=NULL?graph_volumes:0)|(nb_area!=NULL?graph_areas:0)
+	      |((flags&VORO_C_WALLS)!=0?graph_walls:0);
+	g.compute(cn,t->nt);
+	for(i=0;i<=n;i++) nb_off[i]=0;
+	for(r=0;r<g.rows();r++) {
+		nb_off[int(g.id[r])+1]=g.degree(r);
+		if(vol!=NULL) vol[g.id[r]]=g.vol[r];
+	}
+	for(i=0;i<n;i++) nb_off[i+1]+=nb_off[i];
+	if(nb_off[n]>nb_cap) return VORO_C_SHORT_BUFFER;
+
+	// Copy each row into place
+	if(nb!=NULL) for(r=0;r<g.rows();r++) {
+		o=nb_off[int(g.id[r])];
+		for(e=g.off[r];e<g.off[r+1];e++,o++) {
+			nb[o]=int(g.nb[e]);
+			if(nb_area!=NULL) nb_area[o]=g.area[e];
+		}
+	}
+	return VORO_C_OK;
+}
+
+extern "C" {
+
+/** Creates a tessellation handle for a rectangular domain.
+ * \param[in] (ax,bx) the minimum and maximum x coordinates.
+ * \param[in] (ay,by) the minimum and maximum y coordinates.
+ * \param[in] (az,bz) the minimum and maximum z coordinates.
+ * \param[in] (xperiodic,yperiodic,zperiodic) non-zero values to make the
+ *					    domain periodic in each direction.
+ * \return The handle, or NULL if the domain is invalid. */
+voro_c_tess* voro_c_create(double ax,double bx,double ay,double by,double az,double bz,
+			   int xperiodic,int yperiodic,int zperiodic) {
+	if(!(ax<bx&&ay<by&&az<bz)) return NULL;
+	return new voro_c_tess(ax,bx,ay,by,az,bz,xperiodic!=0,yperiodic!=0,zperiodic!=0);
+}
+
+/** Frees a tessellation handle and all of its memory.
+ * \param[in] t the handle, which may be NULL. */
+void voro_c_destroy(voro_c_tess *t) {
+	delete t;
+}
+
+/** Changes the domain of a tessellation handle, for example to follow a
+ * simulation box that changes size. The periodicity is kept.
+ * \param[in] t the handle.
+ * \param[in] (ax,bx,ay,by,az,bz) the new domain.
+ * \return VORO_C_OK, or VORO_C_INVALID if the domain is invalid. */
+int voro_c_set_box(voro_c_tess *t,double ax,double bx,double ay,double by,double az,double bz) {
+	if(t==NULL||!(ax<bx&&ay<by&&az<bz)) return VORO_C_INVALID;
+	if(ax!=t->ax||bx!=t->bx||ay!=t->ay||by!=t->by||az!=t->az||bz!=t->bz) {
+		t->ax=ax;t->bx=bx;t->ay=ay;t->by=by;t->az=az;t->bz=bz;
+		t->reset();
+	}
+	return VORO_C_OK;
+}
+
+/** Sets the number of threads that a tessellation handle uses.
+ * \param[in] t the handle.
+ * \param[in] nt the number of threads, or zero to use the OpenMP default. */
+void voro_c_set_threads(voro_c_tess *t,int nt) {
+	if(t!=NULL&&nt>=0) t->nt=nt;
+}
+
+/** Computes the Voronoi tessellation of a set of particles, or the radical
+ * tessellation if radii are given. The coordinates of particle i are read
+ * from x[i*stride], y[i*stride], and z[i*stride], so that interleaved
+ * coordinates can be passed as (p,p+1,p+2,3) and separate coordinate arrays
+ * as (x,y,z,1). The particles are copied straight into the container's
+ * blocks, and the results are written straight into the caller's buffers,
+ * indexed by the particle number. Particles that lie outside a non-periodic
+ * direction of the domain are left out, and get a volume of zero and no
+ * neighbors. Any of the output buffers can be NULL if that output is not
+ * needed.
+ * \param[in] t the handle.
+ * \param[in] n the number of particles.
+ * \param[in] (x,y,z,stride) the particle coordinates, and their stride.
+ * \param[in] (rad,rstride) the particle radii and their stride, or NULL for
+ *			    the standard Voronoi tessellation.
+ * \param[out] vol an array of n values in which to store the cell volumes.
+ * \param[out] nb_off an array of n+1 values in which to store the offsets of
+ *		      the neighbors of each particle in the nb array.
+ * \param[out] nb an array of nb_cap values in which to store the neighbor
+ *		  lists, using the particle numbers.
+ * \param[in] nb_cap the size of the nb and nb_area arrays.
+ * \param[out] nb_area an array of nb_cap values in which to store the area
+ *		       of the face shared with each neighbor.
+ * \param[in] flags a combination of voro_c_flags.
+ * \return VORO_C_OK on success, VORO_C_SHORT_BUFFER if the neighbor lists do
+ * not fit in nb_cap values, in which case nb_off[n] gives the size needed, or
+ * VORO_C_INVALID if the arguments are inconsistent. */
+int voro_c_compute(voro_c_tess *t,int n,const double *x,const double *y,const double *z,int stride,
+		   const double *rad,int rstride,double *vol,int *nb_off,int *nb,int nb_cap,
+		   double *nb_area,int flags) {
+	if(t==NULL||n<0||x==NULL||y==NULL||z==NULL||stride<1||(rad!=NULL&&rstride<1)
+	   ||(nb!=NULL&&nb_off==NULL)||(nb_area!=NULL&&nb==NULL)) return VORO_C_INVALID;
+	int i;
+	if(rad!=NULL) {
+		t->setup(n,true);
+		container_poly &cn=*t->conp;
+		for(i=0;i<n;i++,x+=stride,y+=stride,z+=stride,rad+=rstride) cn.put(i,*x,*y,*z,*rad);
+		return voro_c_run(t,cn,n,vol,nb_off,nb,nb_cap,nb_area,flags);
+	}
+	t->setup(n,false);
+	container &cn=*t->con;
+	for(i=0;i<n;i++,x+=stride,y+=stride,z+=stride) cn.put(i,*x,*y,*z);
+	return voro_c_run(t,cn,n,vol,nb_off,nb,nb_cap,nb_area,flags);
+}
+
+}
@@ -0,0 +1,61 @@
+/* Voro++, a 3D cell-based Voronoi library
+ *
+ * Author   : Chris H. Rycroft (LBL / UC Berkeley)
+ * Email    : chr@alum.mit.edu
+ * Date     : August 30th 2011 */
+
+/** \file voro_c.h
+ * \brief Header file for the C interface to the library, which can be used
+ * from C and Fortran codes.
+ *
+ * The interface works on an opaque tessellation handle. Each call to
+ * voro_c_compute() reads the particle positions directly from arrays owned by
+ * the caller, with an arbitrary stride so that both interleaved and separate
+ * coordinate arrays can be used, and writes the results directly into buffers
+ * owned by the caller. The handle keeps its container and working memory
+ * between calls, so that a tessellation that is repeated every timestep of a
+ * simulation does not need to reallocate anything once it has reached a
+ * steady state. */
+
+#ifndef VOROPP_VORO_C_H
+#define VOROPP_VORO_C_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** An opaque handle to a tessellation. */
+typedef struct voro_c_tess voro_c_tess;
+
+/** The status codes returned by voro_c_compute(). */
+enum voro_c_status {
+	/** The computation succeeded. */
+	VORO_C_OK=0,
+	/** The neighbor buffer was too small. The offsets are still
+	 * filled in, so that the last one gives the size needed. */
+	VORO_C_SHORT_BUFFER=1,
+	/** One of the arguments was invalid. */
+	VORO_C_INVALID=2
+};
+
+/** The flags that can be passed to voro_c_compute(). */
+enum voro_c_flags {
+	/** Include the faces on the container walls in the neighbor lists,
+	 * with the negative IDs that the library uses for them. */
+	VORO_C_WALLS=1
+};
+
+voro_c_tess* voro_c_create(double ax,double bx,double ay,double by,double az,double bz,
+			   int xperiodic,int yperiodic,int zperiodic);
+void voro_c_destroy(voro_c_tess *t);
+int voro_c_set_box(voro_c_tess *t,double ax,double bx,double ay,double by,double az,double bz);
+void voro_c_set_threads(voro_c_tess *t,int nt);
+int voro_c_compute(voro_c_tess *t,int n,const double *x,const double *y,const double *z,int stride,
+		   const double *rad,int rstride,double *vol,int *nb_off,int *nb,int nb_cap,
+		   double *nb_area,int flags);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -18,6 +18,21 @@ bool wall_sphere::point_inside(double x,double y,double z) {
 	return (x-xc)*(x-xc)+(y-yc)*(y-yc)+(z-zc)*(z-zc)<rc*rc;
 }
 
+/** Tests whether a batch of points are inside the sphere wall object, clearing
+ * the mask entries of those that are not. The test is written without
+ * branches, so that the compiler can vectorize the loop.
+ * \param[in] n the number of points.
+ * \param[in] pp an array of the point coordinates, in groups of three.
+ * \param[in,out] m the mask, with one entry per point. */
+void wall_sphere::points_inside(int n,const double *pp,unsigned char *m) {
+	double rsq=rc*rc;
+	for(int i=0;i<n;i++) {
+		const double *q=pp+3*i;
+		double xd=*q-xc,yd=q[1]-yc,zd=q[2]-zc;
+		m[i]&=xd*xd+yd*yd+zd*zd<rsq;
+	}
+}
+
 /** Cuts a cell by the sphere wall object. The spherical wall is approximated by
  * a single plane applied at the point on the sphere which is closest to the center
  * of the cell. This works well for particle arrangements that are packed against
@@ -35,6 +50,56 @@ bool wall_sphere::cut_cell_base(v_cell &c,double x,double y,double z) {
 	return true;
 }
 
+/** Tests to see whether a point is outside the spherical obstacle.
+ * \param[in] (x,y,z) the vector to test.
+ * \return True if the point is outside, false if the point is inside. */
+bool wall_sphere_inv::point_inside(double x,double y,double z) {
+	return (x-xc)*(x-xc)+(y-yc)*(y-yc)+(z-zc)*(z-zc)>rc*rc;
+}
+
+/** Tests whether a batch of points are outside the spherical obstacle, clearing
+ * the mask entries of those that are not. The test is written without
+ * branches, so that the compiler can vectorize the loop.
+ * \param[in] n the number of points.
+ * \param[in] pp an array of the point coordinates, in groups of three.
+ * \param[in,out] m the mask, with one entry per point. */
+void wall_sphere_inv::points_inside(int n,const double *pp,unsigned char *m) {
+	double rsq=rc*rc;
+	for(int i=0;i<n;i++) {
+		const double *q=pp+3*i;
+		double xd=*q-xc,yd=q[1]-yc,zd=q[2]-zc;
+		m[i]&=xd*xd+yd*yd+zd*zd>rsq;
+	}
+}
+
+/** Computes the bounding box of the spherical obstacle.
+ * \param[out] (xl,xh) the x range of the bounding box.
+ * \param[out] (yl,yh) the y range of the bounding box.
+ * \param[out] (zl,zh) the z range of the bounding box.
+ * \return True, since the obstacle always has a bounding box. */
+bool wall_sphere_inv::bounds(double &xl,double &xh,double &yl,double &yh,double &zl,double &zh) {
+	xl=xc-rc;xh=xc+rc;
+	yl=yc-rc;yh=yc+rc;
+	zl=zc-rc;zh=zc+rc;
+	return true;
+}
+
+/** Cuts a cell by the spherical obstacle. The sphere is approximated by a
+ * single plane applied at the point on the sphere which is closest to the
+ * center of the cell, with the cell kept on the outside.
+ * \param[in,out] c the Voronoi cell to be cut.
+ * \param[in] (x,y,z) the location of the Voronoi cell.
+ * \return True if the cell still exists, false if the cell is deleted. */
+template<class v_cell>
+bool wall_sphere_inv::cut_cell_base(v_cell &c,double x,double y,double z) {
+	double xd=x-xc,yd=y-yc,zd=z-zc,dq=xd*xd+yd*yd+zd*zd;
+	if (dq>1e-5) {
+		dq=2*(sqrt(dq)*rc-dq);
+		return c.nplane(-xd,-yd,-zd,-dq,w_id);
+	}
+	return true;
+}
+
 /** Tests to see whether a point is inside the plane wall object.
  * \param[in] (x,y,z) the vector to test.
  * \return True if the point is inside, false if the point is outside. */
@@ -42,6 +107,19 @@ bool wall_plane::point_inside(double x,double y,double z) {
 	return x*xc+y*yc+z*zc<ac;
 }
 
+/** Tests whether a batch of points are inside the plane wall object, clearing
+ * the mask entries of those that are not. The test is written without
+ * branches, so that the compiler can vectorize the loop.
+ * \param[in] n the number of points.
+ * \param[in] pp an array of the point coordinates, in groups of three.
+ * \param[in,out] m the mask, with one entry per point. */
+void wall_plane::points_inside(int n,const double *pp,unsigned char *m) {
+	for(int i=0;i<n;i++) {
+		const double *q=pp+3*i;
+		m[i]&=*q*xc+q[1]*yc+q[2]*zc<ac;
+	}
+}
+
 /** Cuts a cell by the plane wall object.
  * \param[in,out] c the Voronoi cell to be cut.
  * \param[in] (x,y,z) the location of the Voronoi cell.
@@ -62,6 +140,22 @@ bool wall_cylinder::point_inside(double x,double y,double z) {
 	return xd*xd+yd*yd+zd*zd<rc*rc;
 }
 
+/** Tests whether a batch of points are inside the cylindrical wall object, clearing
+ * the mask entries of those that are not. The test is written without
+ * branches, so that the compiler can vectorize the loop.
+ * \param[in] n the number of points.
+ * \param[in] pp an array of the point coordinates, in groups of three.
+ * \param[in,out] m the mask, with one entry per point. */
+void wall_cylinder::points_inside(int n,const double *pp,unsigned char *m) {
+	double rsq=rc*rc;
+	for(int i=0;i<n;i++) {
+		const double *q=pp+3*i;
+		double xd=*q-xc,yd=q[1]-yc,zd=q[2]-zc,pa=(xd*xa+yd*ya+zd*za)*asi;
+		xd-=xa*pa;yd-=ya*pa;zd-=za*pa;
+		m[i]&=xd*xd+yd*yd+zd*zd<rsq;
+	}
+}
+
 /** Cuts a cell by the cylindrical wall object. The cylindrical wall is
  * approximated by a single plane applied at the point on the cylinder which is
  * closest to the center of the cell. This works well for particle arrangements
@@ -82,6 +176,64 @@ bool wall_cylinder::cut_cell_base(v_cell &c,double x,double y,double z) {
 	return true;
 }
 
+/** Tests to see whether a point is outside the cylindrical obstacle.
+ * \param[in] (x,y,z) the vector to test.
+ * \return True if the point is outside, false if the point is inside. */
+bool wall_cylinder_inv::point_inside(double x,double y,double z) {
+	double xd=x-xc,yd=y-yc,zd=z-zc;
+	double pa=(xd*xa+yd*ya+zd*za)*asi;
+	xd-=xa*pa;yd-=ya*pa;zd-=za*pa;
+	return xd*xd+yd*yd+zd*zd>rc*rc;
+}
+
+/** Tests whether a batch of points are outside the cylindrical obstacle, clearing
+ * the mask entries of those that are not. The test is written without
+ * branches, so that the compiler can vectorize the loop.
+ * \param[in] n the number of points.
+ * \param[in] pp an array of the point coordinates, in groups of three.
+ * \param[in,out] m the mask, with one entry per point. */
+void wall_cylinder_inv::points_inside(int n,const double *pp,unsigned char *m) {
+	double rsq=rc*rc;
+	for(int i=0;i<n;i++) {
+		const double *q=pp+3*i;
+		double xd=*q-xc,yd=q[1]-yc,zd=q[2]-zc,pa=(xd*xa+yd*ya+zd*za)*asi;
+		xd-=xa*pa;yd-=ya*pa;zd-=za*pa;
+		m[i]&=xd*xd+yd*yd+zd*zd>rsq;
+	}
+}
+
+/** Computes the bounding box of the cylindrical obstacle. The cylinder is
+ * infinite, so the box only has a finite range in the directions that are
+ * perpendicular to its axis.
+ * \param[out] (xl,xh) the x range of the bounding box.
+ * \param[out] (yl,yh) the y range of the bounding box.
+ * \param[out] (zl,zh) the z range of the bounding box.
+ * \return True, since the obstacle always has a bounding box. */
+bool wall_cylinder_inv::bounds(double &xl,double &xh,double &yl,double &yh,double &zl,double &zh) {
+	if(xa==0) {xl=xc-rc;xh=xc+rc;} else {xl=-large_number;xh=large_number;}
+	if(ya==0) {yl=yc-rc;yh=yc+rc;} else {yl=-large_number;yh=large_number;}
+	if(za==0) {zl=zc-rc;zh=zc+rc;} else {zl=-large_number;zh=large_number;}
+	return true;
+}
+
+/** Cuts a cell by the cylindrical obstacle. The cylinder is approximated by a
+ * single plane applied at the point on the cylinder which is closest to the
+ * center of the cell, with the cell kept on the outside.
+ * \param[in,out] c the Voronoi cell to be cut.
+ * \param[in] (x,y,z) the location of the Voronoi cell.
+ * \return True if the cell still exists, false if the cell is deleted. */
+template<class v_cell>
+bool wall_cylinder_inv::cut_cell_base(v_cell &c,double x,double y,double z) {
+	double xd=x-xc,yd=y-yc,zd=z-zc,pa=(xd*xa+yd*ya+zd*za)*asi;
+	xd-=xa*pa;yd-=ya*pa;zd-=za*pa;
+	pa=xd*xd+yd*yd+zd*zd;
+	if(pa>1e-5) {
+		pa=2*(sqrt(pa)*rc-pa);
+		return c.nplane(-xd,-yd,-zd,-pa,w_id);
+	}
+	return true;
+}
+
 /** Tests to see whether a point is inside the cone wall object.
  * \param[in] (x,y,z) the vector to test.
  * \return True if the point is inside, false if the point is outside. */
@@ -94,6 +246,22 @@ bool wall_cone::point_inside(double x,double y,double z) {
 	return xd*xd+yd*yd+zd*zd<pa;
 }
 
+/** Tests whether a batch of points are inside the cone wall object, clearing
+ * the mask entries of those that are not. The test is written without
+ * branches, so that the compiler can vectorize the loop.
+ * \param[in] n the number of points.
+ * \param[in] pp an array of the point coordinates, in groups of three.
+ * \param[in,out] m the mask, with one entry per point. */
+void wall_cone::points_inside(int n,const double *pp,unsigned char *m) {
+	for(int i=0;i<n;i++) {
+		const double *q=pp+3*i;
+		double xd=*q-xc,yd=q[1]-yc,zd=q[2]-zc,pa=(xd*xa+yd*ya+zd*za)*asi;
+		xd-=xa*pa;yd-=ya*pa;zd-=za*pa;
+		pa*=gra;
+		m[i]&=(pa>=0)&(xd*xd+yd*yd+zd*zd<pa*pa);
+	}
+}
+
 /** Cuts a cell by the cone wall object. The conical wall is
  * approximated by a single plane applied at the point on the cone which is
  * closest to the center of the cell. This works well for particle arrangements
@@ -122,10 +290,14 @@ bool wall_cone::cut_cell_base(v_cell &c,double x,double y,double z) {
 // Explicit instantiation
 template bool wall_sphere::cut_cell_base(voronoicell&,double,double,double);
 template bool wall_sphere::cut_cell_base(voronoicell_neighbor&,double,double,double);
+template bool wall_sphere_inv::cut_cell_base(voronoicell&,double,double,double);
+template bool wall_sphere_inv::cut_cell_base(voronoicell_neighbor&,double,double,double);
 template bool wall_plane::cut_cell_base(voronoicell&,double,double,double);
 template bool wall_plane::cut_cell_base(voronoicell_neighbor&,double,double,double);
 template bool wall_cylinder::cut_cell_base(voronoicell&,double,double,double);
 template bool wall_cylinder::cut_cell_base(voronoicell_neighbor&,double,double,double);
+template bool wall_cylinder_inv::cut_cell_base(voronoicell&,double,double,double);
+template bool wall_cylinder_inv::cut_cell_base(voronoicell_neighbor&,double,double,double);
 template bool wall_cone::cut_cell_base(voronoicell&,double,double,double);
 template bool wall_cone::cut_cell_base(voronoicell_neighbor&,double,double,double);
 
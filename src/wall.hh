@@ -29,6 +29,35 @@ struct wall_sphere : public wall {
 		wall_sphere(double xc_,double yc_,double zc_,double rc_,int w_id_=-99)
 			: w_id(w_id_), xc(xc_), yc(yc_), zc(zc_), rc(rc_) {}
 		bool point_inside(double x,double y,double z);
+		void points_inside(int n,const double *pp,unsigned char *m);
+		template<class v_cell>
+		bool cut_cell_base(v_cell &c,double x,double y,double z);
+		bool cut_cell(voronoicell &c,double x,double y,double z) {return cut_cell_base(c,x,y,z);}
+		bool cut_cell(voronoicell_neighbor &c,double x,double y,double z) {return cut_cell_base(c,x,y,z);}
+	private:
+		const int w_id;
+		const double xc,yc,zc,rc;
+};
+
+/** \brief A class representing a spherical obstacle.
+ *
+ * This class represents a spherical wall object that particles are kept
+ * outside of, such as an obstacle in a porous medium. Since it can only alter
+ * the cells that reach it, it has a bounding box, so that a container with
+ * many obstacles only applies each one to the cells near it. */
+struct wall_sphere_inv : public wall {
+	public:
+		/** Constructs a spherical obstacle.
+		 * \param[in] (xc_,yc_,zc_) a position vector for the sphere's
+		 * 			    center.
+		 * \param[in] rc_ the radius of the sphere.
+		 * \param[in] w_id_ an ID number to associate with the wall for
+		 *		    neighbor tracking. */
+		wall_sphere_inv(double xc_,double yc_,double zc_,double rc_,int w_id_=-99)
+			: w_id(w_id_), xc(xc_), yc(yc_), zc(zc_), rc(rc_) {}
+		bool point_inside(double x,double y,double z);
+		void points_inside(int n,const double *pp,unsigned char *m);
+		bool bounds(double &xl,double &xh,double &yl,double &yh,double &zl,double &zh);
 		template<class v_cell>
 		bool cut_cell_base(v_cell &c,double x,double y,double z);
 		bool cut_cell(voronoicell &c,double x,double y,double z) {return cut_cell_base(c,x,y,z);}
@@ -51,6 +80,7 @@ struct wall_plane : public wall {
 		wall_plane(double xc_,double yc_,double zc_,double ac_,int w_id_=-99)
 			: w_id(w_id_), xc(xc_), yc(yc_), zc(zc_), ac(ac_) {}
 		bool point_inside(double x,double y,double z);
+		void points_inside(int n,const double *pp,unsigned char *m);
 		template<class v_cell>
 		bool cut_cell_base(v_cell &c,double x,double y,double z);
 		bool cut_cell(voronoicell &c,double x,double y,double z) {return cut_cell_base(c,x,y,z);}
@@ -77,6 +107,38 @@ struct wall_cylinder : public wall {
 			: w_id(w_id_), xc(xc_), yc(yc_), zc(zc_), xa(xa_), ya(ya_), za(za_),
 			asi(1/(xa_*xa_+ya_*ya_+za_*za_)), rc(rc_) {}
 		bool point_inside(double x,double y,double z);
+		void points_inside(int n,const double *pp,unsigned char *m);
+		template<class v_cell>
+		bool cut_cell_base(v_cell &c,double x,double y,double z);
+		bool cut_cell(voronoicell &c,double x,double y,double z) {return cut_cell_base(c,x,y,z);}
+		bool cut_cell(voronoicell_neighbor &c,double x,double y,double z) {return cut_cell_base(c,x,y,z);}
+	private:
+		const int w_id;
+		const double xc,yc,zc,xa,ya,za,asi,rc;
+};
+
+/** \brief A class representing a cylindrical obstacle.
+ *
+ * This class represents an open cylinder wall object that particles are kept
+ * outside of. Its bounding box is finite in the directions perpendicular to
+ * the cylinder's axis, so that obstacles aligned with a coordinate axis are
+ * only applied to the cells near them. */
+struct wall_cylinder_inv : public wall {
+	public:
+		/** Constructs a cylindrical obstacle.
+		 * \param[in] (xc_,yc_,zc_) a point on the axis of the
+		 *			    cylinder.
+		 * \param[in] (xa_,ya_,za_) a vector pointing along the
+		 *			    direction of the cylinder.
+		 * \param[in] rc_ the radius of the cylinder
+		 * \param[in] w_id_ an ID number to associate with the wall for
+		 *		    neighbor tracking. */
+		wall_cylinder_inv(double xc_,double yc_,double zc_,double xa_,double ya_,double za_,double rc_,int w_id_=-99)
+			: w_id(w_id_), xc(xc_), yc(yc_), zc(zc_), xa(xa_), ya(ya_), za(za_),
+			asi(1/(xa_*xa_+ya_*ya_+za_*za_)), rc(rc_) {}
+		bool point_inside(double x,double y,double z);
+		void points_inside(int n,const double *pp,unsigned char *m);
+		bool bounds(double &xl,double &xh,double &yl,double &yh,double &zl,double &zh);
 		template<class v_cell>
 		bool cut_cell_base(v_cell &c,double x,double y,double z);
 		bool cut_cell(voronoicell &c,double x,double y,double z) {return cut_cell_base(c,x,y,z);}
@@ -104,6 +166,7 @@ struct wall_cone : public wall {
 			asi(1/(xa_*xa_+ya_*ya_+za_*za_)),
 			gra(tan(ang)), sang(sin(ang)), cang(cos(ang)) {}
 		bool point_inside(double x,double y,double z);
+		void points_inside(int n,const double *pp,unsigned char *m);
 		template<class v_cell>
 		bool cut_cell_base(v_cell &c,double x,double y,double z);
 		bool cut_cell(voronoicell &c,double x,double y,double z) {return cut_cell_base(c,x,y,z);}
@@ -113,6 +176,85 @@ struct wall_cone : public wall {
 		const double xc,yc,zc,xa,ya,za,asi,gra,sang,cang;
 };
 
+
+/** \brief An empty wall that fills the unused slots of a wall_set.
+ *
+ * This class has the same functions as a wall, but none of them alter a cell,
+ * and since they are not virtual they are removed entirely by the compiler. */
+struct wall_none {
+	public:
+		inline bool point_inside(double x,double y,double z) {return true;}
+		inline void points_inside(int n,const double *pp,unsigned char *m) {}
+		template<class v_cell>
+		inline bool cut_cell(v_cell &c,double x,double y,double z) {return true;}
+		inline bool finishes() {return false;}
+		template<class v_cell>
+		inline bool finish_cell(v_cell &c,double x,double y,double z) {return true;}
+};
+
+/** \brief A fixed set of walls whose types are known at compile time.
+ *
+ * This class holds up to four walls by value, and is itself a wall, so that it
+ * can be added to a container alongside other walls. A container makes one
+ * virtual call to the set, and the set then calls the functions of each of its
+ * walls directly, using qualified calls that the compiler can resolve without
+ * the virtual function table. Larger sets can be made by nesting one wall_set
+ * inside another. The set has no bounding box, so it is applied to every cell.
+ * \tparam w1 the type of the first wall.
+ * \tparam (w2,w3,w4) the types of the other walls, which default to the
+ *		      wall_none class. */
+template<class w1,class w2=wall_none,class w3=wall_none,class w4=wall_none>
+struct wall_set : public wall {
+	public:
+		/** The first wall in the set. */
+		w1 wa;
+		/** The second wall in the set. */
+		w2 wb;
+		/** The third wall in the set. */
+		w3 wc;
+		/** The fourth wall in the set. */
+		w4 wd;
+		/** Constructs a wall set, by copying the walls that are given.
+		 * \param[in] (wa_,wb_,wc_,wd_) the walls to copy. */
+		wall_set(const w1 &wa_,const w2 &wb_=w2(),const w3 &wc_=w3(),const w4 &wd_=w4())
+			: wa(wa_), wb(wb_), wc(wc_), wd(wd_) {}
+		bool point_inside(double x,double y,double z) {
+			return wa.w1::point_inside(x,y,z)&&wb.w2::point_inside(x,y,z)
+			     &&wc.w3::point_inside(x,y,z)&&wd.w4::point_inside(x,y,z);
+		}
+		void points_inside(int n,const double *pp,unsigned char *m) {
+			wa.w1::points_inside(n,pp,m);wb.w2::points_inside(n,pp,m);
+			wc.w3::points_inside(n,pp,m);wd.w4::points_inside(n,pp,m);
+		}
+		/** Cuts a cell by all of the walls in the set.
+		 * \param[in] c a reference to the Voronoi cell class.
+		 * \param[in] (x,y,z) the position of the cell.
+		 * \return True if the cell still exists, false if the cell is
+		 * deleted. */
+		template<class v_cell>
+		inline bool cut_cell_base(v_cell &c,double x,double y,double z) {
+			return wa.w1::cut_cell(c,x,y,z)&&wb.w2::cut_cell(c,x,y,z)
+			     &&wc.w3::cut_cell(c,x,y,z)&&wd.w4::cut_cell(c,x,y,z);
+		}
+		bool cut_cell(voronoicell &c,double x,double y,double z) {return cut_cell_base(c,x,y,z);}
+		bool cut_cell(voronoicell_neighbor &c,double x,double y,double z) {return cut_cell_base(c,x,y,z);}
+		bool finishes() {
+			return wa.w1::finishes()||wb.w2::finishes()||wc.w3::finishes()||wd.w4::finishes();
+		}
+		/** Makes any further cuts to a cell by the walls in the set.
+		 * \param[in] c a reference to the Voronoi cell class.
+		 * \param[in] (x,y,z) the position of the cell.
+		 * \return True if the cell still exists, false if the cell is
+		 * deleted. */
+		template<class v_cell>
+		inline bool finish_cell_base(v_cell &c,double x,double y,double z) {
+			return wa.w1::finish_cell(c,x,y,z)&&wb.w2::finish_cell(c,x,y,z)
+			     &&wc.w3::finish_cell(c,x,y,z)&&wd.w4::finish_cell(c,x,y,z);
+		}
+		bool finish_cell(voronoicell &c,double x,double y,double z) {return finish_cell_base(c,x,y,z);}
+		bool finish_cell(voronoicell_neighbor &c,double x,double y,double z) {return finish_cell_base(c,x,y,z);}
+};
+
 }
 
 #endif
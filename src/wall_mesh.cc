@@ -0,0 +1,365 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file wall_mesh.cc
+ * \brief Function implementations for the wall_mesh class. */
+
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+
+#include "wall_mesh.hh"
+
+namespace voro {
+
+/** The size of the stack used to traverse the BVH. Since the triangles are
+ * split at the median, the depth of the BVH is at most 32. */
+const int wall_mesh_stack=64;
+
+/** The direction of the ray that is used to test whether a point is inside
+ * the mesh. It is chosen to not be aligned with any of the axes, so that it is
+ * unlikely to pass exactly through an edge or corner of a triangle. All of its
+ * components must be positive. */
+const double wall_mesh_rx=0.8186421903;
+const double wall_mesh_ry=0.4470852687;
+const double wall_mesh_rz=0.3602797315;
+
+/** \brief A function object for comparing the centroids of two triangles
+ * along one direction. */
+struct wall_mesh_cmp {
+	/** A pointer to the centroid coordinates for the direction being
+	 * compared, which are stored in groups of three. */
+	const double *c;
+	wall_mesh_cmp(const double *c_) : c(c_) {}
+	inline bool operator()(int a,int b) const {return c[3*a]<c[3*b];}
+};
+
+/** The class constructor reads the triangles of the mesh from an STL file,
+ * which can be in either the ASCII or the binary format, and builds the BVH.
+ * \param[in] filename the name of the file to read.
+ * \param[in] w_id_ an ID number to associate with the wall for neighbor
+ *		    tracking. */
+wall_mesh::wall_mesh(const char *filename,int w_id_) : w_id(w_id_) {
+	import_stl(filename);
+	build();
+}
+
+/** The class constructor sets up the mesh from a list of vertices and
+ * triangles, and builds the BVH.
+ * \param[in] v the positions of the vertices, in groups of three.
+ * \param[in] t the vertex indices of the corners of each triangle, in groups
+ *		of three.
+ * \param[in] w_id_ an ID number to associate with the wall for neighbor
+ *		    tracking. */
+wall_mesh::wall_mesh(std::vector<double> &v,std::vector<int> &t,int w_id_) : w_id(w_id_) {
+	tv.resize(3*t.size());
+	for(int i=0;i<int(t.size());i++) {
+		tv[3*i]=v[3*t[i]];
+		tv[3*i+1]=v[3*t[i]+1];
+		tv[3*i+2]=v[3*t[i]+2];
+	}
+	build();
+}
+
+/** Reads the triangles of the mesh from an STL file. A file is taken to be in
+ * the binary format if its size matches the number of triangles given in its
+ * header, and in the ASCII format otherwise.
+ * \param[in] filename the name of the file to read. */
+void wall_mesh::import_stl(const char *filename) {
+	FILE *fp=safe_fopen(filename,"rb");
+	char buf[256];
+	unsigned int i,j,n;
+	long sz;
+
+	// Find the size of the file, and check for a binary header
+	fseek(fp,0,SEEK_END);sz=ftell(fp);fseek(fp,0,SEEK_SET);
+	if(sz>=84&&fread(buf,1,80,fp)==80&&fread(&n,4,1,fp)==1&&sz==84+50*long(n)) {
+
+		// Read the binary triangles, each of which has a normal
+		// vector, three corners, and two bytes of attributes
+		float f[12];
+		tv.resize(9*n);
+		for(i=0;i<n;i++) {
+			if(fread(f,4,12,fp)!=12||fread(buf,1,2,fp)!=2)
+				voro_fatal_error("File import error",VOROPP_FILE_ERROR);
+			for(j=0;j<9;j++) tv[9*i+j]=f[j+3];
+		}
+	} else {
+
+		// Read the ASCII triangles by searching for each corner
+		double x,y,z;
+		fseek(fp,0,SEEK_SET);
+		while(fscanf(fp,"%255s",buf)==1) if(strcmp(buf,"vertex")==0) {
+			if(fscanf(fp,"%lg %lg %lg",&x,&y,&z)!=3)
+				voro_fatal_error("File import error",VOROPP_FILE_ERROR);
+			tv.push_back(x);tv.push_back(y);tv.push_back(z);
+		}
+		if(tv.size()%9!=0) voro_fatal_error("File import error",VOROPP_FILE_ERROR);
+	}
+	fclose(fp);
+}
+
+/** Builds the BVH, and reorders the triangles so that those in each leaf are
+ * stored consecutively. */
+void wall_mesh::build() {
+	int i,j;
+	nt=tv.size()/9;
+	if(nt==0) return;
+
+	// Compute the centroid of each triangle
+	std::vector<double> cen(3*nt);
+	std::vector<int> ind(nt);
+	for(i=0;i<nt;i++) {
+		ind[i]=i;
+		for(j=0;j<3;j++) cen[3*i+j]=(tv[9*i+j]+tv[9*i+j+3]+tv[9*i+j+6])*(1/3.0);
+	}
+
+	// Build the tree, starting from the root node
+	bn.resize(2);bb.resize(6);
+	build_node(0,&ind[0],0,nt,cen);
+
+	// Store the triangles in the order of the leaves
+	std::vector<double> ntv(9*nt);
+	for(i=0;i<nt;i++) for(j=0;j<9;j++) ntv[9*i+j]=tv[9*ind[i]+j];
+	tv.swap(ntv);
+}
+
+/** Sets up a node of the BVH for a range of triangles, dividing it into two
+ * children at the median centroid along the longest direction if it has too
+ * many triangles.
+ * \param[in] n the index of the node.
+ * \param[in] ind the array of triangle indices.
+ * \param[in] (i0,i1) the range of the array to consider.
+ * \param[in] cen the centroids of the triangles. */
+void wall_mesh::build_node(int n,int *ind,int i0,int i1,std::vector<double> &cen) {
+	int i,j,l;
+	double *bp=&bb[6*n],*tp,cl[3],ch[3];
+
+	// Compute the bounding box of the triangles, and the range of
+	// their centroids
+	for(j=0;j<3;j++) {
+		bp[2*j]=cl[j]=large_number;
+		bp[2*j+1]=ch[j]=-large_number;
+	}
+	for(i=i0;i<i1;i++) {
+		tp=&tv[9*ind[i]];
+		for(j=0;j<9;j++) {
+			if(tp[j]<bp[2*(j%3)]) bp[2*(j%3)]=tp[j];
+			if(tp[j]>bp[2*(j%3)+1]) bp[2*(j%3)+1]=tp[j];
+		}
+		for(j=0;j<3;j++) {
+			if(cen[3*ind[i]+j]<cl[j]) cl[j]=cen[3*ind[i]+j];
+			if(cen[3*ind[i]+j]>ch[j]) ch[j]=cen[3*ind[i]+j];
+		}
+	}
+
+	// Store a leaf if there are few enough triangles
+	if(i1-i0<=wall_mesh_leaf_max) {
+		bn[2*n]=i0;bn[2*n+1]=i1-i0;
+		return;
+	}
+
+	// Divide the triangles at the median along the longest direction
+	j=ch[1]-cl[1]>ch[0]-cl[0]?1:0;
+	if(ch[2]-cl[2]>ch[j]-cl[j]) j=2;
+	i=(i0+i1)>>1;
+	std::nth_element(ind+i0,ind+i,ind+i1,wall_mesh_cmp(&cen[j]));
+
+	// Create the two children
+	l=bn.size()>>1;
+	bn[2*n]=l;bn[2*n+1]=0;
+	bn.resize(bn.size()+4);bb.resize(bb.size()+12);
+	build_node(l,ind,i0,i,cen);
+	build_node(l+1,ind,i,i1,cen);
+}
+
+/** Tests to see whether a point is inside the mesh, by counting the number of
+ * times that a ray from the point crosses the mesh.
+ * \param[in] (x,y,z) the point to test.
+ * \return True if the point is inside, false if the point is outside. */
+bool wall_mesh::point_inside(double x,double y,double z) {
+	int st[wall_mesh_stack],*sp=st,*np;
+	bool in=false;
+	if(nt==0) return false;
+	*(sp++)=0;
+	while(sp>st) {
+		sp--;
+		if(!ray_hits_box(*sp,x,y,z)) continue;
+		np=&bn[2*(*sp)];
+		if(np[1]>0) {
+			for(double *tp=&tv[9*(*np)],*te=tp+9*np[1];tp<te;tp+=9)
+				if(ray_hits_triangle(tp,x,y,z)) in=!in;
+		} else {*(sp++)=*np;*(sp++)=*np+1;}
+	}
+	return in;
+}
+
+/** Finds the point on the mesh that is closest to a given point.
+ * \param[in] (x,y,z) the point to consider.
+ * \param[out] (qx,qy,qz) the closest point on the mesh.
+ * \return The squared distance to the closest point, or a large number if the
+ * mesh has no triangles. */
+double wall_mesh::nearest(double x,double y,double z,double &qx,double &qy,double &qz) {
+	int st[wall_mesh_stack],*sp=st,*np;
+	double ds=large_number,d,d2,ax,ay,az;
+	qx=x;qy=y;qz=z;
+	if(nt==0) return ds;
+	*(sp++)=0;
+	while(sp>st) {
+		sp--;
+		if(box_dist(*sp,x,y,z)>=ds) continue;
+		np=&bn[2*(*sp)];
+		if(np[1]>0) {
+			for(double *tp=&tv[9*(*np)],*te=tp+9*np[1];tp<te;tp+=9) {
+				d=triangle_dist(tp,x,y,z,ax,ay,az);
+				if(d<ds) {ds=d;qx=ax;qy=ay;qz=az;}
+			}
+		} else {
+
+			// Push the closer child last, so that it is
+			// considered first
+			d=box_dist(*np,x,y,z);d2=box_dist(*np+1,x,y,z);
+			if(d<d2) {*(sp++)=*np+1;*(sp++)=*np;}
+			else {*(sp++)=*np;*(sp++)=*np+1;}
+		}
+	}
+	return ds;
+}
+
+/** Tests whether the ray used by point_inside() passes through the bounding box
+ * of a node of the BVH, using the slab method.
+ * \param[in] n the node to consider.
+ * \param[in] (x,y,z) the start of the ray.
+ * \return True if the ray passes through the box, false otherwise. */
+bool wall_mesh::ray_hits_box(int n,double x,double y,double z) {
+	double *bp=&bb[6*n],t0=0,t1=large_number,t;
+	t=(*bp-x)*(1/wall_mesh_rx);if(t>t0) t0=t;
+	t=(bp[1]-x)*(1/wall_mesh_rx);if(t<t1) t1=t;
+	t=(bp[2]-y)*(1/wall_mesh_ry);if(t>t0) t0=t;
+	t=(bp[3]-y)*(1/wall_mesh_ry);if(t<t1) t1=t;
+	t=(bp[4]-z)*(1/wall_mesh_rz);if(t>t0) t0=t;
+	t=(bp[5]-z)*(1/wall_mesh_rz);if(t<t1) t1=t;
+	return t0<=t1;
+}
+
+/** Tests whether the ray used by point_inside() crosses a triangle, using the
+ * Moller-Trumbore algorithm.
+ * \param[in] tp a pointer to the corners of the triangle.
+ * \param[in] (x,y,z) the start of the ray.
+ * \return True if the ray crosses the triangle, false otherwise. */
+bool wall_mesh::ray_hits_triangle(double *tp,double x,double y,double z) {
+	double e1x=tp[3]-*tp,e1y=tp[4]-tp[1],e1z=tp[5]-tp[2],
+	       e2x=tp[6]-*tp,e2y=tp[7]-tp[1],e2z=tp[8]-tp[2],
+	       px=wall_mesh_ry*e2z-wall_mesh_rz*e2y,
+	       py=wall_mesh_rz*e2x-wall_mesh_rx*e2z,
+	       pz=wall_mesh_rx*e2y-wall_mesh_ry*e2x,
+	       det=e1x*px+e1y*py+e1z*pz,sx,sy,sz,qx,qy,qz,u,v;
+	if(det==0) return false;
+	det=1/det;
+	sx=x-*tp;sy=y-tp[1];sz=z-tp[2];
+	u=(sx*px+sy*py+sz*pz)*det;
+	if(u<0||u>1) return false;
+	qx=sy*e1z-sz*e1y;qy=sz*e1x-sx*e1z;qz=sx*e1y-sy*e1x;
+	v=(wall_mesh_rx*qx+wall_mesh_ry*qy+wall_mesh_rz*qz)*det;
+	if(v<0||u+v>1) return false;
+	return (e2x*qx+e2y*qy+e2z*qz)*det>0;
+}
+
+/** Finds the point on a triangle that is closest to a given point, by
+ * determining which corner, edge, or the interior of the triangle that the
+ * point projects onto.
+ * \param[in] tp a pointer to the corners of the triangle.
+ * \param[in] (x,y,z) the point to consider.
+ * \param[out] (qx,qy,qz) the closest point on the triangle.
+ * \return The squared distance to the closest point. */
+double wall_mesh::triangle_dist(double *tp,double x,double y,double z,double &qx,double &qy,double &qz) {
+	double abx=tp[3]-*tp,aby=tp[4]-tp[1],abz=tp[5]-tp[2],
+	       acx=tp[6]-*tp,acy=tp[7]-tp[1],acz=tp[8]-tp[2],
+	       px=x-*tp,py=y-tp[1],pz=z-tp[2],
+	       d1=abx*px+aby*py+abz*pz,d2=acx*px+acy*py+acz*pz,
+	       d3,d4,d5,d6,va,vb,vc,s,t;
+
+	// Find the closest point as a+s*(b-a)+t*(c-a)
+	d3=d1-(abx*abx+aby*aby+abz*abz);
+	d4=d2-(abx*acx+aby*acy+abz*acz);
+	d5=d1-(abx*acx+aby*acy+abz*acz);
+	d6=d2-(acx*acx+acy*acy+acz*acz);
+	vc=d1*d4-d3*d2;
+	vb=d5*d2-d1*d6;
+	va=d3*d6-d5*d4;
+	if(d1<=0&&d2<=0) s=t=0;
+	else if(d3>=0&&d4<=d3) {s=1;t=0;}
+	else if(vc<=0&&d1>=0&&d3<=0) {s=d1/(d1-d3);t=0;}
+	else if(d6>=0&&d5<=d6) {s=0;t=1;}
+	else if(vb<=0&&d2>=0&&d6<=0) {s=0;t=d2/(d2-d6);}
+	else if(va<=0&&d4-d3>=0&&d5-d6>=0) {t=(d4-d3)/((d4-d3)+(d5-d6));s=1-t;}
+	else {s=1/(va+vb+vc);t=vc*s;s*=vb;}
+	qx=*tp+s*abx+t*acx;
+	qy=tp[1]+s*aby+t*acy;
+	qz=tp[2]+s*abz+t*acz;
+	px=x-qx;py=y-qy;pz=z-qz;
+	return px*px+py*py+pz*pz;
+}
+
+/** Cuts a cell by the mesh. The mesh is approximated by a single plane
+ * applied at the point on the mesh which is closest to the center of the cell.
+ * \param[in,out] c the Voronoi cell to be cut.
+ * \param[in] (x,y,z) the location of the Voronoi cell.
+ * \return True if the cell still exists, false if the cell is deleted. */
+template<class v_cell>
+bool wall_mesh::cut_cell_base(v_cell &c,double x,double y,double z) {
+	double qx,qy,qz,ds=nearest(x,y,z,qx,qy,qz);
+	if(ds<tolerance*tolerance||4*ds>=c.max_radius_squared()) return true;
+	return c.nplane(qx-x,qy-y,qz-z,2*ds,w_id);
+}
+
+/** Makes further cuts to a cell once it has been cut by the particles. Any
+ * vertex of the cell that is outside the mesh is cut off by the tangent plane
+ * at its closest point on the mesh, as long as the particle is on the inner
+ * side of that plane. Vertices that lie on the mesh to within the cell's
+ * tolerance are left in place, and the vertices that are closer to the
+ * particle than the mesh are not tested.
+ * \param[in,out] c the Voronoi cell to be cut.
+ * \param[in] (x,y,z) the location of the Voronoi cell.
+ * \return True if the cell still exists, false if the cell is deleted. */
+template<class v_cell>
+bool wall_mesh::finish_cell_base(v_cell &c,double x,double y,double z) {
+	double qx,qy,qz,xd=0,yd=0,zd=0,rs=0,ls,ds=nearest(x,y,z,qx,qy,qz);
+	int i,l;
+	fpoint *pp;
+	if(4*ds>=c.max_radius_squared()) return true;
+
+	// Search for a vertex that is outside the mesh. If one is found, then
+	// cut it off and search again.
+	for(l=0;l<wall_mesh_max_cuts;l++) {
+		for(i=0,pp=c.pts;i<c.p;i++,pp+=4) {
+			if(0.25*(*pp*(*pp)+pp[1]*pp[1]+pp[2]*pp[2])<=ds) continue;
+			xd=x+0.5*(*pp);yd=y+0.5*pp[1];zd=z+0.5*pp[2];
+			if(point_inside(xd,yd,zd)) continue;
+			nearest(xd,yd,zd,qx,qy,qz);
+			xd-=qx;yd-=qy;zd-=qz;
+			rs=xd*(qx-x)+yd*(qy-y)+zd*(qz-z);
+			if(rs>c.tol) break;
+		}
+		if(i==c.p) return true;
+
+		// Scale the normal vector so that it is the displacement from
+		// the particle to the plane. The vertex is then at a distance
+		// of rs above the plane in the units of the cell's tolerance,
+		// which ensures that it is removed.
+		ls=xd*xd+yd*yd+zd*zd;rs/=ls;
+		if(!c.nplane(xd*rs,yd*rs,zd*rs,2*rs*rs*ls,w_id)) return false;
+	}
+	return true;
+}
+
+// Explicit instantiation
+template bool wall_mesh::cut_cell_base(voronoicell&,double,double,double);
+template bool wall_mesh::cut_cell_base(voronoicell_neighbor&,double,double,double);
+template bool wall_mesh::finish_cell_base(voronoicell&,double,double,double);
+template bool wall_mesh::finish_cell_base(voronoicell_neighbor&,double,double,double);
+
+}
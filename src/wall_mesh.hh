@@ -0,0 +1,96 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file wall_mesh.hh
+ * \brief Header file for the wall_mesh class. */
+
+#ifndef VOROPP_WALL_MESH_HH
+#define VOROPP_WALL_MESH_HH
+
+#include <vector>
+
+#include "config.hh"
+#include "common.hh"
+#include "cell.hh"
+#include "container.hh"
+
+namespace voro {
+
+/** \brief A wall object given by a closed triangle mesh.
+ *
+ * This class represents a wall given by a closed triangle mesh, such as one
+ * exported from a CAD package as an STL file, that particles are kept inside
+ * of. The triangles are stored in a bounding volume hierarchy (BVH), which is
+ * built by splitting them at the median of their centroids along the longest
+ * axis, so that the nearest point on the mesh and the crossings of a ray can
+ * be found in logarithmic time.
+ *
+ * A point is inside the mesh if a ray from it crosses the mesh an odd number
+ * of times, so the orientation of the triangles is not needed. A cell is cut
+ * by the tangent plane at the point on the mesh that is closest to the
+ * particle, in the same way as the other walls. Once the cell has been cut by
+ * the particles, each vertex that still lies outside the mesh is cut off by
+ * the tangent plane at its own nearest point on the mesh, which handles the
+ * edges and corners of the mesh. Only the part of the mesh near the cell is
+ * examined, and if the cell lies within the distance to the mesh, no cuts are
+ * made at all. */
+class wall_mesh : public wall {
+	public:
+		/** The number of triangles in the mesh. */
+		int nt;
+		wall_mesh(const char *filename,int w_id_=-99);
+		wall_mesh(std::vector<double> &v,std::vector<int> &t,int w_id_=-99);
+		bool point_inside(double x,double y,double z);
+		double nearest(double x,double y,double z,double &qx,double &qy,double &qz);
+		template<class v_cell>
+		bool cut_cell_base(v_cell &c,double x,double y,double z);
+		bool cut_cell(voronoicell &c,double x,double y,double z) {return cut_cell_base(c,x,y,z);}
+		bool cut_cell(voronoicell_neighbor &c,double x,double y,double z) {return cut_cell_base(c,x,y,z);}
+		/** Returns whether the wall makes further cuts to a finished
+		 * cell, which it always does.
+		 * \return True. */
+		bool finishes() {return true;}
+		template<class v_cell>
+		bool finish_cell_base(v_cell &c,double x,double y,double z);
+		bool finish_cell(voronoicell &c,double x,double y,double z) {return finish_cell_base(c,x,y,z);}
+		bool finish_cell(voronoicell_neighbor &c,double x,double y,double z) {return finish_cell_base(c,x,y,z);}
+	private:
+		const int w_id;
+		/** The positions of the corners of the triangles, in groups
+		 * of nine, stored in the order of the leaves of the BVH. */
+		std::vector<double> tv;
+		/** The bounding boxes of the nodes of the BVH, in groups of
+		 * six, giving the x, y, and z ranges. */
+		std::vector<double> bb;
+		/** The contents of the nodes of the BVH, in pairs. For a leaf,
+		 * these are the first triangle and the number of triangles.
+		 * For other nodes, these are the index of the first child,
+		 * which is followed by the second, and zero. */
+		std::vector<int> bn;
+		void import_stl(const char *filename);
+		void build();
+		void build_node(int n,int *ind,int i0,int i1,std::vector<double> &cen);
+		/** Computes the squared distance from a point to the bounding
+		 * box of a node of the BVH.
+		 * \param[in] n the node to consider.
+		 * \param[in] (x,y,z) the point.
+		 * \return The squared distance, which is zero if the point is
+		 * inside the box. */
+		inline double box_dist(int n,double x,double y,double z) {
+			double *bp=&bb[6*n],d=0,t;
+			if(x<*bp) {t=*bp-x;d+=t*t;} else if(x>bp[1]) {t=x-bp[1];d+=t*t;}
+			if(y<bp[2]) {t=bp[2]-y;d+=t*t;} else if(y>bp[3]) {t=y-bp[3];d+=t*t;}
+			if(z<bp[4]) {t=bp[4]-z;d+=t*t;} else if(z>bp[5]) {t=z-bp[5];d+=t*t;}
+			return d;
+		}
+		bool ray_hits_box(int n,double x,double y,double z);
+		bool ray_hits_triangle(double *tp,double x,double y,double z);
+		double triangle_dist(double *tp,double x,double y,double z,double &qx,double &qy,double &qz);
+};
+
+}
+
+#endif
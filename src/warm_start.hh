@@ -0,0 +1,92 @@
+// Voro++, a 3D cell-based Voronoi library
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+/** \file warm_start.hh
+ * \brief Header file for the warm_start class. */
+
+#ifndef VOROPP_WARM_START_HH
+#define VOROPP_WARM_START_HH
+
+#include <vector>
+
+#include "config.hh"
+
+namespace voro {
+
+/** \brief A class for computing Voronoi cells starting from the neighbor lists
+ * of a previous frame.
+ *
+ * In a molecular dynamics trajectory, the neighbors of each particle change
+ * very little from one frame to the next. This class stores the block and
+ * index of every particle in a container, so that the neighbor IDs that were
+ * found with voronoicell_neighbor::neighbors() in the previous frame can be
+ * looked up and used to cut each cell before the usual block search. Since
+ * the container's own voro_compute class is used, only one thread should call
+ * the compute routine at a time.
+ * \tparam c_class the type of the container, which can be any of the container
+ *		   classes. */
+template<class c_class>
+class warm_start {
+	public:
+		/** A reference to the container that holds the particles. */
+		c_class &con;
+		/** Initializes the class for a container. The index() routine
+		 * must be called before any cells are computed.
+		 * \param[in] con_ a reference to the container. */
+		warm_start(c_class &con_) : con(con_) {}
+		/** Records where each particle in the container is stored. This
+		 * must be called again whenever particles are added to or
+		 * removed from the container. The particle IDs are used to
+		 * index the internal array, so they should be non-negative and
+		 * reasonably compact.
+		 * \param[in] vl a loop class over all of the particles in the
+		 *		 container. */
+		template<class c_loop>
+		void index(c_loop &vl) {
+			loc.assign(loc.size(),-1);
+			if(vl.start()) do {
+				voro_id n=vl.pid();
+				if(2*n>=voro_id(loc.size())) loc.resize(2*(n+1),-1);
+				loc[2*n]=vl.ijk;loc[2*n+1]=vl.q;
+			} while(vl.inc());
+		}
+		/** Computes the Voronoi cell for a particle currently being
+		 * referenced by a loop class, cutting it first by the planes
+		 * of the particles in a neighbor list. Negative entries, which
+		 * refer to walls, and IDs that are not in the container are
+		 * skipped.
+		 * \param[out] c a Voronoi cell class in which to store the
+		 * 		 computed cell.
+		 * \param[in] vl the loop class to use.
+		 * \param[in] prev the neighbor list of the particle from the
+		 *		   previous frame.
+		 * \return True if the cell was computed. If the cell cannot be
+		 * computed, if it is removed entirely by a wall or boundary
+		 * condition, then the routine returns false. */
+		template<class v_cell,class c_loop>
+		bool compute_cell(v_cell &c,c_loop &vl,const std::vector<voro_id> &prev) {
+			sl.clear();
+			for(unsigned int i=0;i<prev.size();i++) {
+				voro_id n=prev[i];
+				if(n<0||2*n>=voro_id(loc.size())||loc[2*n]<0) continue;
+				if(loc[2*n]==vl.ijk&&loc[2*n+1]==vl.q) continue;
+				sl.push_back(loc[2*n]);sl.push_back(loc[2*n+1]);
+			}
+			if(sl.empty()) return con.compute_cell(c,vl);
+			return con.compute_cell(c,vl,&sl[0],&sl[0]+sl.size());
+		}
+	private:
+		/** The block and the index within the block of each particle,
+		 * in pairs, or -1 if there is no particle with that ID. */
+		std::vector<int> loc;
+		/** The list of seed particles for the cell currently being
+		 * computed, in the same format as loc. */
+		std::vector<int> sl;
+};
+
+}
+
+#endif
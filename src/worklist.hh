@@ -28,5 +28,38 @@ const int wl_hgridcu=64;
 /** The number of elements in each worklist. */
 const int wl_seq_length=64;
 
+/** \brief A set of precomputed block worklists.
+ *
+ * This template describes a set of block worklists, which can be passed to
+ * the voro_compute template to select how finely each block is subdivided and
+ * how many blocks are held in each worklist. A finer subdivision prunes the
+ * search better when there are many particles per block, and longer worklists
+ * are useful when there are few. The tables are only available for the
+ * combinations of parameters that are generated by worklist_gen.pl.
+ * \tparam hgrid_ half the number of subregions that a block is subdivided
+ *                into in each direction.
+ * \tparam seq_length_ the number of elements in each worklist. */
+template<int hgrid_,int seq_length_>
+struct worklist_variant {
+	/** Half the number of subregions that a block is divided into. */
+	static const int hgrid=hgrid_;
+	/** The number of subregions that a block is divided into. */
+	static const int fgrid=2*hgrid_;
+	/** The total number of worklists. */
+	static const int hgridcu=hgrid_*hgrid_*hgrid_;
+	/** The number of elements in each worklist. */
+	static const int seq_length=seq_length_;
+	/** The worklists, one after another. */
+	static const unsigned int wl[seq_length_*hgrid_*hgrid_*hgrid_];
+};
+
+template<> const unsigned int worklist_variant<4,64>::wl[4096];
+template<> const unsigned int worklist_variant<2,32>::wl[256];
+template<> const unsigned int worklist_variant<4,128>::wl[8192];
+template<> const unsigned int worklist_variant<8,64>::wl[32768];
+
+/** The set of worklists that is used by default. */
+typedef worklist_variant<4,64> worklist_default;
+
 }
 #endif
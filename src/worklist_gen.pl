@@ -10,16 +10,12 @@
 # compute_cell() routine to ensure maximum efficiency
 
 # Each region is divided into a grid of subregions, and a worklist is
-# constructed for each. This parameter sets is set to half the number of
-# subregions that the block is divided into.
-$hr=4;
-
-# This parameter is automatically set to the the number of subregions that the
-# block is divided into
-$r=$hr*2;
-
-# This parameter sets the total number of block entries in each worklist
-$ls=63;
+# constructed for each. Several sets of worklists are generated, each given by
+# a pair of numbers. The first is half the number of subregions that the block
+# is divided into, and the second is the total number of block entries in each
+# worklist. The first set is the default one that is used by the voro_compute
+# template.
+@variants=([4,63],[2,31],[4,127],[8,63]);
 
 # When the worklists are being constructed, a mask array is made use of. To
 # prevent the creation of array elements with negative indices, this parameter
@@ -31,6 +27,8 @@ $d=2*$dis+1;$dd=$d*$d;$d0=(1+$d+$dd)*$dis;
 
 use Math::Trig;
 
+($hr,$ls)=@{$variants[0]};$r=$hr*2;
+
 # Construct the worklist header file, based on the parameters above
 open W,">worklist.hh";
 print W <<EOF;
@@ -72,6 +70,43 @@ EOF
 printf W "const int wl_seq_length=%d;\n",$ls+1;
 print W <<EOF;
 
+/** \\brief A set of precomputed block worklists.
+ *
+ * This template describes a set of block worklists, which can be passed to
+ * the voro_compute template to select how finely each block is subdivided and
+ * how many blocks are held in each worklist. A finer subdivision prunes the
+ * search better when there are many particles per block, and longer worklists
+ * are useful when there are few. The tables are only available for the
+ * combinations of parameters that are generated by worklist_gen.pl.
+ * \\tparam hgrid_ half the number of subregions that a block is subdivided
+ *                into in each direction.
+ * \\tparam seq_length_ the number of elements in each worklist. */
+template<int hgrid_,int seq_length_>
+struct worklist_variant {
+	/** Half the number of subregions that a block is divided into. */
+	static const int hgrid=hgrid_;
+	/** The number of subregions that a block is divided into. */
+	static const int fgrid=2*hgrid_;
+	/** The total number of worklists. */
+	static const int hgridcu=hgrid_*hgrid_*hgrid_;
+	/** The number of elements in each worklist. */
+	static const int seq_length=seq_length_;
+	/** The worklists, one after another. */
+	static const unsigned int wl[seq_length_*hgrid_*hgrid_*hgrid_];
+};
+
+EOF
+foreach (@variants) {
+	($hr,$ls)=@$_;
+	printf W "template<> const unsigned int worklist_variant<%d,%d>::wl[%d];\n",$hr,$ls+1,($ls+1)*$hr*$hr*$hr;
+}
+print W <<EOF;
+
+/** The set of worklists that is used by default. */
+EOF
+printf W "typedef worklist_variant<%d,%d> worklist_default;\n",$variants[0][0],$variants[0][1]+1;
+print W <<EOF;
+
 }
 #endif
 EOF
@@ -87,26 +122,30 @@ print W <<EOF;
 // Date     : August 30th 2011
 
 /** \\file v_base_wl.cc
- * \\brief The table of block worklists that are used during the cell
- * computation, which is part of the voro_base class.
+ * \\brief The tables of block worklists that are used during the cell
+ * computation, for each of the worklist_variant classes.
  *
  * This file is automatically generated by worklist_gen.pl and it is not
  * intended to be edited by hand. */
 
 EOF
-printf W "const unsigned int voro_base::wl[wl_seq_length*wl_hgridcu]={\n";
 
-# Now create a worklist for each subregion
-for($kk=0;$kk<$hr;$kk++) {
-	for($jj=0;$jj<$hr;$jj++) {
-		for($ii=0;$ii<$hr;$ii++) {
-			worklist($ii,$jj,$kk);
+# Now create a worklist for each subregion, for each set of worklists
+foreach $vr (0..$#variants) {
+	($hr,$ls)=@{$variants[$vr]};$r=$hr*2;
+	print W "\n" if $vr>0;
+	printf W "template<> const unsigned int worklist_variant<%d,%d>::wl[%d]={\n",$hr,$ls+1,($ls+1)*$hr*$hr*$hr;
+	for($kk=0;$kk<$hr;$kk++) {
+		for($jj=0;$jj<$hr;$jj++) {
+			for($ii=0;$ii<$hr;$ii++) {
+				worklist($ii,$jj,$kk);
+			}
 		}
 	}
+	print W "};\n";
 }
 
 # Finish the file and close it
-print W "};\n";
 close W;
 
 # A subroutine
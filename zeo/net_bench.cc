@@ -0,0 +1,94 @@
+// Voronoi network vertex lookup benchmark
+//
+// Author   : Chris H. Rycroft (LBL / UC Berkeley)
+// Email    : chr@alum.mit.edu
+// Date     : August 30th 2011
+
+#include <cstdlib>
+#include <cstring>
+
+#include "voro++.hh"
+using namespace voro;
+
+#include "v_network.hh"
+
+// The number of particles per unit volume, and the shear of the unit cell
+const double density=1;
+const double shear=0.3;
+
+// The number of repetitions of each timing, and the number of particles per
+// grid block that the container is set up with
+int reps=3;
+double ppb=6;
+
+// This function returns a random double between 0 and 1
+double rnd() {return double(rand())/RAND_MAX;}
+
+// Writes a network to a temporary file and returns its contents, so that the
+// networks built with the two lookup methods can be compared
+void network_text(voronoi_network &vn,char *&s,long &n) {
+	FILE *fp=tmpfile();
+	if(fp==NULL) voro_fatal_error("Unable to open temporary file",VOROPP_FILE_ERROR);
+	vn.print_network(fp);
+	n=ftell(fp);rewind(fp);
+	s=new char[n];
+	if(long(fread(s,1,n,fp))!=n) voro_fatal_error("Temporary file read error",VOROPP_FILE_ERROR);
+	fclose(fp);
+}
+
+// Builds the general and rectangular networks of a container with one lookup
+// method, printing the fastest time and the network sizes
+void bench(container_periodic &con,bool hashed,char **s,long *n) {
+	double t0,t,tmin=large_number;
+	voronoi_network vn(con,1e-5,hashed),vn2(con,1e-5,hashed);
+	for(int l=0;l<reps;l++) {
+		vn.clear_network();vn2.clear_network();
+		t0=voro_wtime();
+		vn.add_all_cells(con,1,&vn2);
+		t=voro_wtime()-t0;
+		if(t<tmin) tmin=t;
+	}
+	printf("%s %.3f %d %d\n",hashed?"hashed":"grid",tmin,vn.edc,vn2.edc);
+	network_text(vn,s[0],n[0]);
+	network_text(vn2,s[1],n[1]);
+}
+
+int main(int argc,char **argv) {
+	int i,n=20000;
+
+	// Read the command-line options
+	for(i=1;i<argc;i++) {
+		if(i+1<argc&&strcmp(argv[i],"-n")==0) n=atoi(argv[++i]);
+		else if(i+1<argc&&strcmp(argv[i],"-r")==0) reps=atoi(argv[++i]);
+		else if(i+1<argc&&strcmp(argv[i],"-b")==0) ppb=atof(argv[++i]);
+		else {
+			fputs("Usage: net_bench [-n particles] [-r repetitions] [-b particles_per_block]\n",stderr);
+			return VOROPP_CMD_LINE_ERROR;
+		}
+	}
+	if(n<1||reps<1||ppb<=0) {
+		fputs("The number of particles, repetitions, and particles per block must be\npositive\n",stderr);
+		return VOROPP_CMD_LINE_ERROR;
+	}
+
+	// Set up a sheared periodic unit cell with the requested number of
+	// particles per block, and fill it with randomly positioned particles
+	double b=pow(n/density,1.0/3.0);
+	int nb=int(b*pow(density/ppb,1.0/3.0)+1);
+	container_periodic con(b,shear*b,b,shear*b,shear*b,b,nb,nb,nb,8);
+	srand(1);
+	for(i=0;i<n;i++) con.put(i,b*rnd(),b*rnd(),b*rnd());
+	printf("# %d particles, %d^3 blocks, %d repetitions\n"
+	       "# lookup seconds vertices rectangular_vertices\n",n,nb,reps);
+
+	// Time both lookup methods, and check that they give the same
+	// networks
+	char *s[4];long sn[4];
+	bench(con,false,s,sn);
+	bench(con,true,s+2,sn+2);
+	for(i=0;i<2;i++) {
+		printf("%s networks %s\n",i==0?"General":"Rectangular",
+		       sn[i]==sn[i+2]&&memcmp(s[i],s[i+2],sn[i])==0?"match":"differ");
+		delete [] s[i];delete [] s[i+2];
+	}
+}
@@ -4,7 +4,10 @@
 // Email    : chr@alum.mit.edu
 // Date     : August 30th 2011
 
+#include <cstdlib>
 #include <cstring>
+#include <string>
+#include <vector>
 
 #include "voro++.hh"
 using namespace voro;
@@ -22,126 +25,322 @@ const int max_regions=16777216;
 // A buffer size
 const int bsize=2048;
 
+// The contents of a .v1 file
+struct v1_structure {
+	double bx,bxy,by,bxz,byz,bz;
+	int n;
+	// The particle positions and radii, in groups of four
+	std::vector<double> p;
+	// A message describing a read error that depends on the file contents
+	std::string msg;
+};
+
+// The containers and networks of one batch thread, which are kept between
+// structures and cleared when the next structure has the same geometry
+struct net_worker {
+	double g[6];
+	int nx,ny,nz;
+	bool radial;
+	container_periodic *con;
+	container_periodic_poly *pcon;
+	voronoi_network *vn,*vn2;
+	net_worker() : con(NULL), pcon(NULL), vn(NULL), vn2(NULL) {}
+	~net_worker() {release();}
+	void release() {
+		delete vn2;delete vn;delete pcon;delete con;
+		con=NULL;pcon=NULL;vn=vn2=NULL;
+	}
+};
+
 // Output routine
 template<class c_class>
-void compute(c_class &con,char *buffer,int bp,double vol);
-
-// Commonly used error message
-void file_import_error() {
-	voro_fatal_error("File import error",VOROPP_FILE_ERROR);
+void compute(c_class &con,voronoi_network &vn,voronoi_network &vn2,char *buffer,int bp,double vol,int nt,bool binary,FILE *log);
+
+// Checks that a filename can be used to make the output filenames
+const char* check_filename(const char *farg) {
+	int bp=strlen(farg);
+	if(bp+2>bsize) return "Filename too long";
+	if(bp<3||farg[bp-3]!='.'||farg[bp-2]!='v'||farg[bp-1]!='1') return "Filename must end in '.v1'";
+	return NULL;
 }
 
-int main(int argc,char **argv) {
-	char *farg,buffer[bsize];
-	bool radial;int i,n,bp;
-	double bx,bxy,by,bxz,byz,bz,x,y,z,vol;
-
-	// Check the command line syntax
-	if(argc==2) {
-		radial=false;farg=argv[1];
-	} else if(argc==3&&strcmp(argv[1],"-r")==0) {
-		radial=true;farg=argv[2];
-	} else {
-		fputs("Syntax: ./network [-r] <filename.v1>\n",stderr);
-		return VOROPP_CMD_LINE_ERROR;
-	}
-
-	// Check that the file has a ".v1" extension
-	bp=strlen(farg);
-	if(bp+2>bsize) {
-		fputs("Filename too long\n",stderr);
-		return VOROPP_CMD_LINE_ERROR;
-	}
-	if(bp<3||farg[bp-3]!='.'||farg[bp-2]!='v'||farg[bp-1]!='1') {
-		fputs("Filename must end in '.v1'\n",stderr);
-		return VOROPP_CMD_LINE_ERROR;
-	}
+// Reads a .v1 file, returning an error message if it could not be read
+const char* read_v1(const char *farg,bool radial,radius_table &rt,v1_structure &s) {
+	char buffer[bsize];
+	double x,y,z;
 
 	// Try opening the file
 	FILE *fp(fopen(farg,"r"));
-	if(fp==NULL) voro_fatal_error("Unable to open file for import",VOROPP_FILE_ERROR);
+	if(fp==NULL) return "Unable to open file for import";
+	const char *err="File import error";
 
 	// Read header line
-	if(fgets(buffer,bsize,fp)!=buffer) file_import_error();
-	if(strcmp(buffer,"Unit cell vectors:\n")!=0)
-		voro_fatal_error("Invalid header line",VOROPP_FILE_ERROR);
+	if(fgets(buffer,bsize,fp)!=buffer) goto fail;
+	if(strcmp(buffer,"Unit cell vectors:\n")!=0) {err="Invalid header line";goto fail;}
 
 	// Read in the box dimensions and the number of particles
-	if(fscanf(fp,"%s %lg %lg %lg",buffer,&bx,&x,&x)!=4) file_import_error();
-	if(strcmp(buffer,"va=")!=0) voro_fatal_error("Invalid first vector",VOROPP_FILE_ERROR);
-	if(fscanf(fp,"%s %lg %lg %lg",buffer,&bxy,&by,&x)!=4) file_import_error();
-	if(strcmp(buffer,"vb=")!=0) voro_fatal_error("Invalid second vector",VOROPP_FILE_ERROR);
-	if(fscanf(fp,"%s %lg %lg %lg",buffer,&bxz,&byz,&bz)!=4) file_import_error();
-	if(strcmp(buffer,"vc=")!=0) voro_fatal_error("Invalid third vector",VOROPP_FILE_ERROR);
-	if(fscanf(fp,"%d",&n)!=1) file_import_error();
-
-	// Print the box dimensions
-	printf("Box dimensions:\n"
-	       "  va=(%f 0 0)\n"
-	       "  vb=(%f %f 0)\n"
-	       "  vc=(%f %f %f)\n\n",bx,bxy,by,bxz,byz,bz);
+	if(fscanf(fp,"%s %lg %lg %lg",buffer,&s.bx,&x,&x)!=4) goto fail;
+	if(strcmp(buffer,"va=")!=0) {err="Invalid first vector";goto fail;}
+	if(fscanf(fp,"%s %lg %lg %lg",buffer,&s.bxy,&s.by,&x)!=4) goto fail;
+	if(strcmp(buffer,"vb=")!=0) {err="Invalid second vector";goto fail;}
+	if(fscanf(fp,"%s %lg %lg %lg",buffer,&s.bxz,&s.byz,&s.bz)!=4) goto fail;
+	if(strcmp(buffer,"vc=")!=0) {err="Invalid third vector";goto fail;}
+	if(fscanf(fp,"%d",&s.n)!=1) goto fail;
 
 	// Check that the input parameters make sense
-	if(n<1) voro_fatal_error("Invalid number of particles",VOROPP_FILE_ERROR);
-	if(bx<tolerance||by<tolerance||bz<tolerance)
-		voro_fatal_error("Invalid box dimensions",VOROPP_FILE_ERROR);
-
-	// Compute the internal grid size, aiming to make
-	// the grid blocks square with around 6 particles
-	// in each
-	double ls=1.8*pow(bx*by*bz,-1.0/3.0);
-	double nxf=bx*ls+1.5;
-	double nyf=by*ls+1.5;
-	double nzf=bz*ls+1.5;
+	if(s.n<1) {err="Invalid number of particles";goto fail;}
+	if(s.bx<tolerance||s.by<tolerance||s.bz<tolerance) {err="Invalid box dimensions";goto fail;}
+
+	// Read in the particles
+	s.p.resize(4*s.n);
+	for(int i=0;i<s.n;i++) {
+		if(fscanf(fp,"%s %lg %lg %lg",buffer,&x,&y,&z)!=4) goto fail;
+		double *pp=&s.p[4*i];
+		*pp=x;pp[1]=y;pp[2]=z;
+		if(radial) {
+			int e=rt.find(buffer);
+			if(e<0) {
+				s.msg="Entry \"";s.msg+=buffer;s.msg+="\" not found in radius table";
+				err=s.msg.c_str();goto fail;
+			}
+			pp[3]=rt.radius(e);
+		} else pp[3]=0;
+	}
+	fclose(fp);
+	return NULL;
+fail:
+	fclose(fp);
+	return err;
+}
+
+// Computes the internal grid size, aiming to make the grid blocks square with
+// around 6 particles in each, and returning false if the grid is too large
+bool grid_size(v1_structure &s,int &nx,int &ny,int &nz) {
+	double ls=1.8*pow(s.bx*s.by*s.bz,-1.0/3.0);
+	double nxf=s.bx*ls+1.5;
+	double nyf=s.by*ls+1.5;
+	double nzf=s.bz*ls+1.5;
 
 	// Check the grid is not too huge, using floating point numbers to avoid
 	// integer wrap-arounds
-	if (nxf*nyf*nzf>max_regions) {
-		fprintf(stderr,"voro++: Number of computational blocks exceeds the maximum allowed of %d\n"
-			"Either increase the particle length scale, or recompile with an increased\nmaximum.\n",
-			max_regions);
-		return VOROPP_MEMORY_ERROR;
-	}
+	if(nxf*nyf*nzf>max_regions) return false;
 
 	// Now that we are confident that the number of regions is reasonable,
 	// create integer versions of them
-	int nx=int(nxf);
-	int ny=int(nyf);
-	int nz=int(nzf);
-	printf("Total particles = %d\n\nInternal grid size = (%d %d %d)\n\n",n,nx,ny,nz);
+	nx=int(nxf);
+	ny=int(nyf);
+	nz=int(nzf);
+	return true;
+}
 
-	vol=bx*by*bz;
-	if(radial) {
+// Prints the error message for a grid that is too large
+void grid_error(FILE *fp) {
+	fprintf(fp,"voro++: Number of computational blocks exceeds the maximum allowed of %d\n"
+		"Either increase the particle length scale, or recompile with an increased\nmaximum.\n",
+		max_regions);
+}
+
+// Puts the particles of a structure into a container
+void put_particles(container_periodic &con,v1_structure &s) {
+	for(int i=0;i<s.n;i++) con.put(i,s.p[4*i],s.p[4*i+1],s.p[4*i+2]);
+}
+void put_particles(container_periodic_poly &con,v1_structure &s) {
+	for(int i=0;i<s.n;i++) con.put(i,s.p[4*i],s.p[4*i+1],s.p[4*i+2],s.p[4*i+3]);
+}
 
-		// Create a container with the geometry given above
-		container_periodic_poly con(bx,bxy,by,bxz,byz,bz,nx,ny,nz,memory);
+// Processes one structure in batch mode, reusing the containers and networks
+// of the worker if the geometry is unchanged. Returns true on success.
+bool batch_job(const char *farg,bool radial,bool binary,bool hashed,int nt,radius_table &rt,net_worker &w) {
+	v1_structure s;
+	char buffer[bsize];
+	const char *err=check_filename(farg);
+	if(err==NULL) err=read_v1(farg,radial,rt,s);
+	if(err!=NULL) {
+#ifdef _OPENMP
+#pragma omp critical(network_log)
+#endif
+		fprintf(stderr,"voro++: %s: %s\n",farg,err);
+		return false;
+	}
+	int nx,ny,nz,bp=strlen(farg);
+	if(!grid_size(s,nx,ny,nz)) {
+#ifdef _OPENMP
+#pragma omp critical(network_log)
+#endif
+		{
+			fprintf(stderr,"%s: ",farg);
+			grid_error(stderr);
+		}
+		return false;
+	}
 
-		// Read in the particles from the file
-		for(i=0;i<n;i++) {
-			if(fscanf(fp,"%s %lg %lg %lg",buffer,&x,&y,&z)!=4) file_import_error();
-			con.put(i,x,y,z,radial_lookup(buffer));
+	// Reuse the containers and networks if the geometry matches, and
+	// create new ones otherwise
+	double g[6]={s.bx,s.bxy,s.by,s.bxz,s.byz,s.bz};
+	bool same=(w.con!=NULL||w.pcon!=NULL)&&w.radial==radial&&w.nx==nx&&w.ny==ny&&w.nz==nz;
+	for(int i=0;i<6&&same;i++) if(w.g[i]!=g[i]) same=false;
+	if(same) {
+		if(radial) w.pcon->clear();else w.con->clear();
+		w.vn->clear_network();w.vn2->clear_network();
+	} else {
+		w.release();
+		for(int i=0;i<6;i++) w.g[i]=g[i];
+		w.nx=nx;w.ny=ny;w.nz=nz;w.radial=radial;
+		if(radial) {
+			w.pcon=new container_periodic_poly(s.bx,s.bxy,s.by,s.bxz,s.byz,s.bz,nx,ny,nz,memory);
+			w.vn=new voronoi_network(*w.pcon,1e-5,hashed);
+			w.vn2=new voronoi_network(*w.pcon,1e-5,hashed);
+		} else {
+			w.con=new container_periodic(s.bx,s.bxy,s.by,s.bxz,s.byz,s.bz,nx,ny,nz,memory);
+			w.vn=new voronoi_network(*w.con,1e-5,hashed);
+			w.vn2=new voronoi_network(*w.con,1e-5,hashed);
 		}
-		fclose(fp);
+	}
 
-		// Copy the output filename
-		for(i=0;i<bp-2;i++) buffer[i]=farg[i];
-		compute(con,buffer,bp,vol);
+	// Compute the networks, and write the summary to the log file of the
+	// structure
+	for(int i=0;i<bp-2;i++) buffer[i]=farg[i];
+	memcpy(buffer+bp-2,"log",4);
+	FILE *log=safe_fopen(buffer,"w");
+	fprintf(log,"Total particles = %d\n\nInternal grid size = (%d %d %d)\n\n",s.n,nx,ny,nz);
+	if(radial) {
+		put_particles(*w.pcon,s);
+		compute(*w.pcon,*w.vn,*w.vn2,buffer,bp,s.bx*s.by*s.bz,nt,binary,log);
 	} else {
+		put_particles(*w.con,s);
+		compute(*w.con,*w.vn,*w.vn2,buffer,bp,s.bx*s.by*s.bz,nt,binary,log);
+	}
+	fclose(log);
+	return true;
+}
+
+// Processes a list of structures concurrently, with each thread taking the
+// next structure from the list as it finishes the previous one
+int batch(std::vector<std::string> &files,bool radial,bool binary,bool hashed,int nt,int nj,radius_table &rt) {
+	int failed=0,nw=voro_threads(nj),jn=files.size();
+	std::vector<net_worker> ws(nw);
+	std::vector<radius_table> rts(nw,rt);
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nw) schedule(dynamic) reduction(+:failed)
+#endif
+	for(int j=0;j<jn;j++) {
+#ifdef _OPENMP
+		int t=omp_get_thread_num();
+#else
+		int t=0;
+#endif
+		if(!batch_job(files[j].c_str(),radial,binary,hashed,nt,rts[t],ws[t])) failed++;
+	}
+	printf("Processed %d structures, %d failed\n",jn-failed,failed);
+	return failed>0?VOROPP_FILE_ERROR:0;
+}
+
+// Reads a list of filenames, one per line, from a file
+void read_list(const char *fn,std::vector<std::string> &files) {
+	char buffer[bsize];
+	FILE *fp=safe_fopen(fn,"r");
+	while(fgets(buffer,bsize,fp)==buffer) {
+		int l=strlen(buffer);
+		while(l>0&&(buffer[l-1]=='\n'||buffer[l-1]=='\r'||buffer[l-1]==' ')) buffer[--l]=0;
+		if(l>0) files.push_back(buffer);
+	}
+	fclose(fp);
+}
 
-		// Create a container with the geometry given above
-		container_periodic con(bx,bxy,by,bxz,byz,bz,nx,ny,nz,memory);
+int main(int argc,char **argv) {
+	char buffer[bsize];
+	const char *farg;
+	bool radial=false,binary=false,hashed=false,listed=false;int i,bp,nt=1,nj=-1,ac=1;
+	double vol;
+	radius_table rt;
+	std::vector<std::string> files;
 
-		// Read in the particles from the file
-		for(i=0;i<n;i++) {
-			if(fscanf(fp,"%s %lg %lg %lg",buffer,&x,&y,&z)!=4)
-				voro_fatal_error("File import error",VOROPP_FILE_ERROR);
-			con.put(i,x,y,z);
+	// Check the command line syntax
+	while(ac<argc) {
+		if(strcmp(argv[ac],"-r")==0) radial=true;
+		else if(strcmp(argv[ac],"-b")==0) binary=true;
+		else if(strcmp(argv[ac],"-s")==0) hashed=true;
+		else if(strcmp(argv[ac],"-a")==0&&ac<argc-2) {
+			rt.load(argv[++ac]);
+			radial=true;
+		} else if(strcmp(argv[ac],"-t")==0&&ac<argc-2) {
+			nt=atoi(argv[++ac]);
+			if(nt<0) {
+				fputs("The number of threads must be non-negative\n",stderr);
+				return VOROPP_CMD_LINE_ERROR;
+			}
+		} else if(strcmp(argv[ac],"-j")==0&&ac<argc-1) {
+			nj=atoi(argv[++ac]);
+			if(nj<0) {
+				fputs("The number of jobs must be non-negative\n",stderr);
+				return VOROPP_CMD_LINE_ERROR;
+			}
+		} else if(strcmp(argv[ac],"-l")==0&&ac<argc-1) {
+			read_list(argv[++ac],files);
+			listed=true;
 		}
-		fclose(fp);
+		else break;
+		ac++;
+	}
+	while(ac<argc) files.push_back(argv[ac++]);
+	if(files.empty()) {
+		fputs("Syntax: ./network [-a <radius_file>] [-b] [-r] [-s] [-t <threads>]\n"
+		      "                 [-j <jobs>] [-l <list_file>] [<filename.v1> ...]\n\n"
+		      "If more than one file is given, or the -j or -l options are used,\n"
+		      "then the files are processed in a batch, with <jobs> structures\n"
+		      "computed at once, and each using <threads> threads. The summary of\n"
+		      "each structure is written to a file with the extension '.log'.\n",stderr);
+		return VOROPP_CMD_LINE_ERROR;
+	}
+	if(files.size()>1||nj>=0||listed) return batch(files,radial,binary,hashed,nt,nj<0?0:nj,rt);
+	farg=files[0].c_str();
 
-		// Copy the output filename
-		for(i=0;i<bp-2;i++) buffer[i]=farg[i];
-		compute(con,buffer,bp,vol);
+	// Check that the file has a ".v1" extension
+	const char *err=check_filename(farg);
+	if(err!=NULL) {
+		fprintf(stderr,"%s\n",err);
+		return VOROPP_CMD_LINE_ERROR;
+	}
+	bp=strlen(farg);
+
+	// Read the file
+	v1_structure s;
+	err=read_v1(farg,radial,rt,s);
+	if(err!=NULL) voro_fatal_error(err,VOROPP_FILE_ERROR);
+
+	// Print the box dimensions
+	printf("Box dimensions:\n"
+	       "  va=(%f 0 0)\n"
+	       "  vb=(%f %f 0)\n"
+	       "  vc=(%f %f %f)\n\n",s.bx,s.bxy,s.by,s.bxz,s.byz,s.bz);
+
+	// Compute the internal grid size
+	int nx,ny,nz;
+	if(!grid_size(s,nx,ny,nz)) {
+		grid_error(stderr);
+		return VOROPP_MEMORY_ERROR;
+	}
+	printf("Total particles = %d\n\nInternal grid size = (%d %d %d)\n\n",s.n,nx,ny,nz);
+
+	// Copy the output filename
+	for(i=0;i<bp-2;i++) buffer[i]=farg[i];
+	vol=s.bx*s.by*s.bz;
+	if(radial) {
+
+		// Create a container with the geometry given above, and put
+		// the particles into it
+		container_periodic_poly con(s.bx,s.bxy,s.by,s.bxz,s.byz,s.bz,nx,ny,nz,memory);
+		put_particles(con,s);
+		voronoi_network vn(con,1e-5,hashed),vn2(con,1e-5,hashed);
+		compute(con,vn,vn2,buffer,bp,vol,nt,binary,stdout);
+	} else {
+
+		// Create a container with the geometry given above, and put
+		// the particles into it
+		container_periodic con(s.bx,s.bxy,s.by,s.bxz,s.byz,s.bz,nx,ny,nz,memory);
+		put_particles(con,s);
+		voronoi_network vn(con,1e-5,hashed),vn2(con,1e-5,hashed);
+		compute(con,vn,vn2,buffer,bp,vol,nt,binary,stdout);
 	}
 }
 
@@ -151,33 +350,25 @@ inline void extension(const char *ext,char *bu) {
 }
 
 template<class c_class>
-void compute(c_class &con,char *buffer,int bp,double vol) {
+void compute(c_class &con,voronoi_network &vn,voronoi_network &vn2,char *buffer,int bp,double vol,int nt,bool binary,FILE *log) {
 	char *bu(buffer+bp-2);
-	int id;
-	double vvol(0),x,y,z,r;
-	voronoicell c(con);
-	voronoi_network vn(con,1e-5),vn2(con,1e-5);
-
-	// Compute Voronoi cells and
-	c_loop_all_periodic vl(con);
-	if(vl.start()) do if(con.compute_cell(c,vl)) {
-		vvol+=c.volume();
-		vl.pos(id,x,y,z,r);
-		vn.add_to_network(c,id,x,y,z,r);
-		vn2.add_to_network_rectangular(c,id,x,y,z,r);
-	} while(vl.inc());
+
+	// Compute Voronoi cells and add them to both networks
+	double vvol=vn.add_all_cells(con,nt,&vn2);
 
 	// Carry out the volume check
-	printf("Volume check:\n  Total domain volume  = %f\n"
-	       "  Total Voronoi volume = %f\n",vol,vvol);
+	fprintf(log,"Volume check:\n  Total domain volume  = %f\n"
+		"  Total Voronoi volume = %f\n",vol,vvol);
 
 	// Print non-rectangular cell network
 	extension("nd2",bu);vn.draw_network(buffer);
 	extension("nt2",bu);vn.print_network(buffer);
+	if(binary) {extension("nb2",bu);vn.print_network_binary(buffer);}
 
 	// Print rectangular cell network
 	extension("ntd",bu);vn2.draw_network(buffer);
 	extension("net",bu);vn2.print_network(buffer);
+	if(binary) {extension("nbn",bu);vn2.print_network_binary(buffer);}
 
 	// Output the particles and any constructed periodic images
 	extension("par",bu);con.draw_particles(buffer);
@@ -5,6 +5,8 @@
 // Date     : July 1st 2008
 
 #include <cstdlib>
+#include <cstring>
+#include <vector>
 
 const int n_table=2;
 
@@ -18,8 +20,136 @@ const double rad_table[]={
 	0.5
 };
 
+/** The name of the environment variable that can give a file of radii to load
+ * into every radius_table. */
+const char radius_table_env[]="ZEO_RADIUS_TABLE";
+
+/** The initial number of slots in the hash table of a radius_table, which must
+ * be a power of two. */
+const int init_radius_table_memory=64;
+
+/** \brief A table of the radii of the atoms of each element.
+ *
+ * The table starts with the built-in radii above. More radii can be loaded
+ * from files, and from the file given in the ZEO_RADIUS_TABLE environment
+ * variable if it is set. Each element name is interned to an integer ID using
+ * an open addressing hash table, so that a lookup costs a single hash of the
+ * name rather than a comparison with every entry. The ID of the most recent
+ * lookup is cached, since the atoms of a frame are often listed in runs of
+ * the same element. */
+class radius_table {
+	public:
+		radius_table() : hmem(init_radius_table_memory), ht(hmem,-1), last(-1) {
+			for(int i=0;i<n_table;i++) set(rad_ctable[i],rad_table[i]);
+			const char *fn=getenv(radius_table_env);
+			if(fn!=NULL&&*fn!=0) load(fn);
+		}
+		/** Returns the number of elements in the table. */
+		inline int size() {return rad.size();}
+		/** Returns the name of an element.
+		 * \param[in] e the element ID. */
+		inline const char* name(int e) {return &nm[no[e]];}
+		/** Returns the radius of an element.
+		 * \param[in] e the element ID. */
+		inline double radius(int e) {return rad[e];}
+		/** Finds the ID of an element.
+		 * \param[in] s the element name.
+		 * \return The element ID, or -1 if the element is not in the
+		 * table. */
+		inline int find(const char *s) {
+			if(last>=0&&strcmp(name(last),s)==0) return last;
+			int h=ht[slot(s)];
+			if(h>=0) last=h;
+			return h;
+		}
+		/** Looks up the radius of an element, exiting with an error
+		 * if it is not in the table.
+		 * \param[in] s the element name.
+		 * \return The radius. */
+		inline double lookup(const char *s) {
+			int e=find(s);
+			if(e<0) {
+				fprintf(stderr,"Entry \"%s\" not found in table\n",s);
+				exit(VOROPP_FILE_ERROR);
+			}
+			return rad[e];
+		}
+		/** Sets the radius of an element, adding it to the table if it
+		 * is not already there.
+		 * \param[in] s the element name.
+		 * \param[in] r the radius.
+		 * \return The element ID. */
+		int set(const char *s,double r) {
+			int l=slot(s);
+			if(ht[l]>=0) {rad[ht[l]]=r;return ht[l];}
+
+			// Keep the table at most half full, so that the probe
+			// sequences remain short
+			if(2*(size()+1)>hmem) {rehash();l=slot(s);}
+			ht[l]=size();
+			no.push_back(nm.size());
+			nm.insert(nm.end(),s,s+strlen(s)+1);
+			rad.push_back(r);
+			return ht[l];
+		}
+		/** Loads radii from a file. Each line gives an element name and
+		 * a radius, separated by white space. Blank lines and lines
+		 * starting with a '#' are skipped. Entries for elements that
+		 * are already in the table replace the existing radii.
+		 * \param[in] filename the name of the file to load. */
+		void load(const char *filename) {
+			char buf[256],s[256];
+			double r;
+			FILE *fp=safe_fopen(filename,"r");
+			while(fgets(buf,256,fp)!=NULL) {
+				if(sscanf(buf,"%255s",s)!=1||*s=='#') continue;
+				if(sscanf(buf,"%255s %lg",s,&r)!=2) {
+					fprintf(stderr,"Invalid line in radius table \"%s\": %s",filename,buf);
+					exit(VOROPP_FILE_ERROR);
+				}
+				set(s,r);
+			}
+			fclose(fp);
+		}
+	private:
+		/** The number of slots in the hash table. */
+		int hmem;
+		/** The hash table of element IDs, where -1 marks an empty
+		 * slot. */
+		std::vector<int> ht;
+		/** The element names, each terminated by a null character. */
+		std::vector<char> nm;
+		/** The offset of each element name in the nm array. */
+		std::vector<int> no;
+		/** The radius of each element. */
+		std::vector<double> rad;
+		/** The ID of the most recently found element, or -1 if there
+		 * is none. */
+		int last;
+		/** Finds the slot of an element name in the hash table, using
+		 * an FNV-1a hash and linear probing.
+		 * \param[in] s the element name.
+		 * \return The slot holding the element, or the empty slot
+		 * where it would be added. */
+		inline int slot(const char *s) {
+			unsigned int h=2166136261u;
+			for(const char *c=s;*c!=0;c++) h=(h^((unsigned char) *c))*16777619u;
+			int l=int(h&(hmem-1));
+			while(ht[l]>=0&&strcmp(name(ht[l]),s)!=0) l=(l+1)&(hmem-1);
+			return l;
+		}
+		/** Doubles the size of the hash table. */
+		void rehash() {
+			hmem<<=1;
+			ht.assign(hmem,-1);
+			for(int e=0;e<size();e++) ht[slot(name(e))]=e;
+		}
+};
+
+/** Looks up the radius of an element in a table that is shared by all calls.
+ * \param[in] buffer the element name.
+ * \return The radius. */
 double radial_lookup(char *buffer) {
-	for(int i=0;i<n_table;i++) if(strcmp(rad_ctable[i],buffer)==0) return rad_table[i];
-	fprintf(stderr,"Entry \"%s\" not found in table\n",buffer);
-	exit(VOROPP_FILE_ERROR);
+	static radius_table rt;
+	return rt.lookup(buffer);
 }
@@ -1,13 +1,23 @@
 #include "v_network.hh"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 /** Initializes the Voronoi network object. The geometry is set up to match a
  * corresponding container class, and memory is allocated for the network.
- * \param[in] c a reference to a container or container_poly class. */
+ * \param[in] c a reference to a container or container_poly class.
+ * \param[in] net_tol_ the distance within which two vertices are merged.
+ * \param[in] hashed_ whether to look up existing vertices with a hash table.
+ *		      Each grid block is split into a finer grid of cells, and
+ *		      the cells that hold vertices are stored in an open
+ *		      addressing hash table, so that a lookup only has to check
+ *		      the few vertices in the cells within the tolerance. */
 template<class c_class>
-voronoi_network::voronoi_network(c_class &c,double net_tol_) :
+voronoi_network::voronoi_network(c_class &c,double net_tol_,bool hashed_) :
 	bx(c.bx), bxy(c.bxy), by(c.by), bxz(c.bxz), byz(c.byz), bz(c.bz),
 	nx(c.nx), ny(c.ny), nz(c.nz), nxyz(nx*ny*nz),
-	xsp(nx/bx), ysp(ny/by), zsp(nz/bz), net_tol(net_tol_) {
+	xsp(nx/bx), ysp(ny/by), zsp(nz/bz), net_tol(net_tol_), hashed(hashed_) {
 	int l;
 
 	// Allocate memory for vertex structure
@@ -47,12 +57,37 @@ voronoi_network::voronoi_network(c_class &c,double net_tol_) :
 	// vertices
 	vmap=new int[4*init_vertices];
 	map_mem=init_vertices;
+
+	// Set up the hash table. The grid blocks are split so that the hash
+	// grid cells hold a few vertices each, based on the number of particles
+	// in the primary domain, but the cells are kept wider than the
+	// tolerance region.
+	if(hashed) {
+		int i,j,k,n=0,r;
+		for(k=c.ez;k<c.wz;k++) for(j=c.ey;j<c.wy;j++) for(i=0;i<nx;i++) n+=c.co[i+nx*(j+c.oy*k)];
+		r=n==0?network_hash_refine:int(pow(7.0*n/(network_hash_cell_vertices*nxyz),1/3.0)+0.5);
+		double w=bx/nx;
+		if(by/ny<w) w=by/ny;
+		if(bz/nz<w) w=bz/nz;
+		if(r>max_network_hash_refine) r=max_network_hash_refine;
+		while(r>1&&w<2*net_tol*r) r--;
+		hnx=r*nx;hny=r*ny;hnz=r*nz;
+		hxsp=hnx/bx;hysp=hny/by;hzsp=hnz/bz;
+		hmem=init_network_hash_memory;hc=0;
+		hk=new int[3*hmem];
+		hh=new int[hmem];
+		for(l=0;l<hmem;l++) hh[l]=-1;
+		hn=new int[edmem];
+	} else {hk=hh=hn=NULL;hmem=hc=0;}
 }
 
 /** The voronoi_network destructor removes the dynamically allocated memory. */
 voronoi_network::~voronoi_network() {
 	int l;
 
+	// Remove the hash table
+	delete [] hn;delete [] hh;delete [] hk;
+
 	// Remove Voronoi mapping array
 	delete [] vmap;
 
@@ -148,6 +183,29 @@ void voronoi_network::add_edge_network_memory() {
 	delete [] numem;numem=nnumem;
 	delete [] reg;reg=nreg;
 	delete [] regp;regp=nregp;
+
+	// Extend the hash table lists, if they are in use
+	if(hashed) {
+		int *nhn(new int[edmem]);
+		for(i=0;i<edc;i++) nhn[i]=hn[i];
+		delete [] hn;hn=nhn;
+	}
+}
+
+/** Doubles the number of slots in the hash table, and moves the occupied slots
+ * to their new positions. */
+void voronoi_network::add_hash_memory() {
+	int l,s,omem=hmem,*ohk=hk,*ohh=hh;
+	hmem<<=1;
+	hk=new int[3*hmem];
+	hh=new int[hmem];
+	for(l=0;l<hmem;l++) hh[l]=-1;
+	for(l=0;l<omem;l++) if(ohh[l]>=0) {
+		s=hash_find(ohk[3*l],ohk[3*l+1],ohk[3*l+2]);
+		s=-1-s;hh[s]=ohh[l];
+		hk[3*s]=ohk[3*l];hk[3*s+1]=ohk[3*l+1];hk[3*s+2]=ohk[3*l+2];
+	}
+	delete [] ohh;delete [] ohk;
 }
 
 /** Increase a particular vertex memory. */
@@ -193,7 +251,11 @@ void voronoi_network::clear_network() {
 	int l;
 	edc=0;
 	for(l=0;l<nxyz;l++) ptsc[l]=0;
-	for(l=0;l<edmem;l++) nu[l]=0;
+	for(l=0;l<edmem;l++) nu[l]=nec[l]=0;
+	if(hashed) {
+		for(l=0;l<hmem;l++) hh[l]=-1;
+		hc=0;
+	}
 }
 
 /** Outputs the network in a format that can be read by gnuplot.
@@ -201,6 +263,7 @@ void voronoi_network::clear_network() {
 void voronoi_network::draw_network(FILE *fp) {
 	int l,q,ai,aj,ak;
 	double x,y,z,*ptsp;
+	network_text_buffer tb(fp);
 	for(l=0;l<edc;l++) {
 		ptsp=pts[reg[l]]+4*regp[l];
 		x=*(ptsp++);y=*(ptsp++);z=*ptsp;
@@ -208,9 +271,10 @@ void voronoi_network::draw_network(FILE *fp) {
 			unpack_periodicity(pered[l][q],ai,aj,ak);
 			if(ed[l][q]<l&&ai==0&&aj==0&&ak==0) continue;
 			ptsp=pts[reg[ed[l][q]]]+4*regp[ed[l][q]];
-			fprintf(fp,"%g %g %g\n%g %g %g\n\n\n",x,y,z,
-				*ptsp+bx*ai+bxy*aj+bxz*ak,
-				ptsp[1]+by*aj+byz*ak,ptsp[2]+bz*ak);
+			tb.put_double(x);tb.put(' ');tb.put_double(y);tb.put(' ');tb.put_double(z);tb.put('\n');
+			tb.put_double(*ptsp+bx*ai+bxy*aj+bxz*ak);tb.put(' ');
+			tb.put_double(ptsp[1]+by*aj+byz*ak);tb.put(' ');
+			tb.put_double(ptsp[2]+bz*ak);tb.put("\n\n\n");
 		}
 	}
 }
@@ -222,19 +286,20 @@ void voronoi_network::draw_network(FILE *fp) {
 void voronoi_network::print_network(FILE *fp,bool reverse_remove) {
 	int ai,aj,ak,j,l,ll,q;
 	double x,y,z,x2,y2,z2,*ptsp;
+	network_text_buffer tb(fp);
 
 	// Print the vertex table
-	fprintf(fp,"Vertex table:\n%d\n",edc);
-	//os << edc << "\n";
+	tb.put("Vertex table:\n");tb.put_int(edc);tb.put('\n');
 	for(l=0;l<edc;l++) {
 		ptsp=pts[reg[l]];j=4*regp[l];
-		fprintf(fp,"%d %g %g %g %g",l,ptsp[j],ptsp[j+1],ptsp[j+2],ptsp[j+3]);
-		for(ll=0;ll<nec[l];ll++) fprintf(fp," %d",ne[l][ll]);
-		fputs("\n",fp);
+		tb.put_int(l);
+		for(ll=0;ll<4;ll++) {tb.put(' ');tb.put_double(ptsp[j+ll]);}
+		for(ll=0;ll<nec[l];ll++) {tb.put(' ');tb.put_int(ne[l][ll]);}
+		tb.put('\n');
 	}
 
 	// Print out the edge table, loop over vertices
-	fputs("\nEdge table:\n",fp);
+	tb.put("\nEdge table:\n");
 	for(l=0;l<edc;l++) {
 
 		// Store the position of this vertex
@@ -250,19 +315,101 @@ void voronoi_network::print_network(FILE *fp,bool reverse_remove) {
 			// print edges from i to j for j<i.
 			if(reverse_remove) if(ed[l][q]<l&&ai==0&&aj==0&&ak==0) continue;
 
-			fprintf(fp,"%d -> %d",l,ed[l][q]);
-			raded[l][q].print(fp);
+			tb.put_int(l);tb.put(" -> ");tb.put_int(ed[l][q]);
+			raded[l][q].print(tb);
 
 			// Compute and print the length of the edge
 			ptsp=pts[reg[ed[l][q]]];j=4*regp[ed[l][q]];
 			x2=ptsp[j]+ai*bx+aj*bxy+ak*bxz-x;
 			y2=ptsp[j+1]+aj*by+ak*byz-y;
 			z2=ptsp[j+2]+ak*bz-z;
-			fprintf(fp," %d %d %d %g\n",ai,aj,ak,sqrt(x2*x2+y2*y2+z2*z2));
+			tb.put(' ');tb.put_int(ai);tb.put(' ');tb.put_int(aj);
+			tb.put(' ');tb.put_int(ak);tb.put(' ');
+			tb.put_double(sqrt(x2*x2+y2*y2+z2*z2));tb.put('\n');
 		}
 	}
 }
 
+/** Writes a block of data to a binary network file, followed by zero bytes to
+ * pad it to a multiple of eight bytes.
+ * \param[in] fp a file handle to write to.
+ * \param[in] p a pointer to the data.
+ * \param[in] n the number of bytes to write. */
+static void write_padded(FILE *fp,const void *p,size_t n) {
+	static const char z[8]={0,0,0,0,0,0,0,0};
+	if(n>0&&fwrite(p,1,n,fp)!=n) voro_fatal_error("Error writing the binary network file",VOROPP_FILE_ERROR);
+	if(n&7) fwrite(z,1,8-(n&7),fp);
+}
+
+/** Prints out the network in a binary format, which can be read without
+ * parsing any text. The file starts with the eight characters "ZEO++NET",
+ * followed by five 32-bit integers: the format version, the number of
+ * vertices, the number of edges, the total number of particles that the
+ * vertices are next to, and a zero for padding. This is followed by a
+ * sequence of columns, each padded with zeros to a multiple of eight bytes:
+ *   - the vertex positions and radii, as four doubles per vertex,
+ *   - the offsets into the particle list for each vertex, as 32-bit integers,
+ *     with an extra entry marking the end of the list,
+ *   - the particle list, as 32-bit integers,
+ *   - the vertices at the start and at the end of each edge, as two columns
+ *     of 32-bit integers,
+ *   - the periodic image of the end of each edge, as three signed bytes per
+ *     edge,
+ *   - the two radius statistics of each edge, in the same order as the text
+ *     output, and the length of each edge, as three columns of doubles.
+ * All of the values are stored with the byte order of the machine that
+ * writes the file.
+ * \param[in] fp a file handle to write to.
+ * \param[in] reverse_remove a boolean value, setting whether or not to remove
+ *                           reverse edges. */
+void voronoi_network::print_network_binary(FILE *fp,bool reverse_remove) {
+	int ai,aj,ak,j,l,q;
+	double x2,y2,z2,*ptsp;
+
+	// Assemble the vertex columns
+	std::vector<int> eo(1,0),ep;
+	std::vector<double> vp;
+	vp.reserve(4*edc);eo.reserve(edc+1);
+	for(l=0;l<edc;l++) {
+		ptsp=pts[reg[l]]+4*regp[l];
+		vp.insert(vp.end(),ptsp,ptsp+4);
+		ep.insert(ep.end(),ne[l],ne[l]+nec[l]);
+		eo.push_back(int(ep.size()));
+	}
+
+	// Assemble the edge columns
+	std::vector<int> ef,et;
+	std::vector<signed char> per;
+	std::vector<double> re,rd,len;
+	for(l=0;l<edc;l++) for(q=0;q<nu[l];q++) {
+		unpack_periodicity(pered[l][q],ai,aj,ak);
+		if(reverse_remove) if(ed[l][q]<l&&ai==0&&aj==0&&ak==0) continue;
+		ef.push_back(l);et.push_back(ed[l][q]);
+		per.push_back((signed char) ai);per.push_back((signed char) aj);
+		per.push_back((signed char) ak);
+		re.push_back(raded[l][q].e);rd.push_back(raded[l][q].dis);
+		ptsp=pts[reg[ed[l][q]]];j=4*regp[ed[l][q]];
+		x2=ptsp[j]+ai*bx+aj*bxy+ak*bxz-vp[4*l];
+		y2=ptsp[j+1]+aj*by+ak*byz-vp[4*l+1];
+		z2=ptsp[j+2]+ak*bz-vp[4*l+2];
+		len.push_back(sqrt(x2*x2+y2*y2+z2*z2));
+	}
+
+	// Write the header and the columns
+	int ne_=int(ef.size()),h[5]={1,edc,ne_,int(ep.size()),0};
+	write_padded(fp,"ZEO++NET",8);
+	write_padded(fp,h,sizeof(h));
+	write_padded(fp,edc>0?&vp[0]:NULL,4*edc*sizeof(double));
+	write_padded(fp,&eo[0],(edc+1)*sizeof(int));
+	write_padded(fp,ep.empty()?NULL:&ep[0],ep.size()*sizeof(int));
+	write_padded(fp,ne_>0?&ef[0]:NULL,ne_*sizeof(int));
+	write_padded(fp,ne_>0?&et[0]:NULL,ne_*sizeof(int));
+	write_padded(fp,ne_>0?&per[0]:NULL,3*ne_);
+	write_padded(fp,ne_>0?&re[0]:NULL,ne_*sizeof(double));
+	write_padded(fp,ne_>0?&rd[0]:NULL,ne_*sizeof(double));
+	write_padded(fp,ne_>0?&len[0]:NULL,ne_*sizeof(double));
+}
+
 // Converts three periodic image displacements into a single unsigned integer.
 // \param[in] i the periodic image in the x direction.
 // \param[in] j the periodic image in the y direction.
@@ -295,7 +442,7 @@ inline void voronoi_network::unpack_periodicity(unsigned int pa,int &i,int &j,in
 template<class v_cell>
 void voronoi_network::add_to_network_internal(v_cell &c,int idn,double x,double y,double z,double rad,int *cmap) {
 	int i,j,k,ijk,l,q,ai,aj,ak,*vmp(cmap);
-	double gx,gy,vx,vy,vz,crad,*cp(c.pts);
+	double gx,gy,vx,vy,vz,crad;fpoint *cp(c.pts);
 
 	// Loop over the vertices of the Voronoi cell
 	for(l=0;l<c.p;l++,vmp+=4) {
@@ -311,7 +458,8 @@ void voronoi_network::add_to_network_internal(v_cell &c,int idn,double x,double
 
 		// Check to see if a vertex very close to this one already
 		// exists in the network
-		if(search_previous(gx,gy,vx,vy,vz,ijk,q,vmp[1],vmp[2],vmp[3])) {
+		if(hashed?search_hash(gx,gy,vx,vy,vz,ijk,q,vmp[1],vmp[2],vmp[3])
+			 :search_previous(gx,gy,vx,vy,vz,ijk,q,vmp[1],vmp[2],vmp[3])) {
 
 			// If it does, then just map the Voronoi cell
 			// vertex to it
@@ -337,6 +485,7 @@ void voronoi_network::add_to_network_internal(v_cell &c,int idn,double x,double
 			pts[ijk][4*ptsc[ijk]+2]=vz;
 			pts[ijk][4*ptsc[ijk]+3]=crad;
 			idmem[ijk][ptsc[ijk]++]=edc;
+			if(hashed) hash_insert(edc,step_int((gx-bx*ai)*hxsp),step_int((gy-by*aj)*hysp),step_int(vz*hzsp));
 			*vmp=edc++;
 		}
 
@@ -403,12 +552,13 @@ void voronoi_network::add_edges_to_network(v_cell &c,double x,double y,double z,
 template<class v_cell>
 void voronoi_network::add_to_network_rectangular_internal(v_cell &c,int idn,double x,double y,double z,double rad,int *cmap) {
 	int i,j,k,ijk,l,q,ai,aj,ak,*vmp(cmap);
-	double vx,vy,vz,crad,*cp(c.pts);
+	double vx,vy,vz,crad;fpoint *cp(c.pts);
 
 	for(l=0;l<c.p;l++,vmp+=4) {
 		vx=x+cp[4*l]*0.5;vy=y+cp[4*l+1]*0.5;vz=z+cp[4*l+2]*0.5;
 		crad=0.5*sqrt(cp[4*l]*cp[4*l]+cp[4*l+1]*cp[4*l+1]+cp[4*l+2]*cp[4*l+2])-rad;
-		if(safe_search_previous_rect(vx,vy,vz,ijk,q,vmp[1],vmp[2],vmp[3])) {
+		if(hashed?search_hash_rect(vx,vy,vz,ijk,q,vmp[1],vmp[2],vmp[3])
+			 :safe_search_previous_rect(vx,vy,vz,ijk,q,vmp[1],vmp[2],vmp[3])) {
 			*vmp=idmem[ijk][q];
 
 			// Store this radius if it smaller than the current
@@ -442,6 +592,7 @@ void voronoi_network::add_to_network_rectangular_internal(v_cell &c,int idn,doub
 			pts[ijk][4*ptsc[ijk]+2]=vz;
 			pts[ijk][4*ptsc[ijk]+3]=crad;
 			idmem[ijk][ptsc[ijk]++]=edc;
+			if(hashed) hash_insert(edc,step_int(vx*hxsp),step_int(vy*hysp),step_int(vz*hzsp));
 			*vmp=edc++;
 		}
 
@@ -515,6 +666,132 @@ bool voronoi_network::search_previous_rect(double x,double y,double z,int &ijk,i
 	return false;
 }
 
+/** Searches for a network vertex within the tolerance of a given position,
+ * using the hash table. This carries out the same search as
+ * search_previous(), scanning the hash grid cells that overlap the tolerance
+ * region instead of the grid blocks. If several vertices are found, the one
+ * that was added first is chosen.
+ * \param[in] (gx,gy) the position along the non-rectangular axes.
+ * \param[in] (x,y,z) the position.
+ * \param[out] (ijk,q) the grid block and index of the vertex that is found.
+ * \param[out] (pi,pj,pk) the periodic image of the vertex that is found.
+ * \return True if a vertex is found, false otherwise. */
+bool voronoi_network::search_hash(double gx,double gy,double x,double y,double z,int &ijk,int &q,int &pi,int &pj,int &pk) {
+	int ai=step_int((gx-net_tol)*hxsp),bi=step_int((gx+net_tol)*hxsp);
+	int aj=step_int((gy-net_tol)*hysp),bj=step_int((gy+net_tol)*hysp);
+	int ak=step_int((z-net_tol)*hzsp),bk=step_int((z+net_tol)*hzsp);
+	int i,j,k,ci,cj,ck,w=-1;
+	double px,py,pz,px2,py2;
+
+	for(k=ak;k<=bk;k++) {
+		ck=step_div(k,hnz);px=ck*bxz;py=ck*byz;pz=ck*bz;
+		for(j=aj;j<=bj;j++) {
+			cj=step_div(j,hny);px2=px+cj*bxy;py2=py+cj*by;
+			for(i=ai;i<=bi;i++) {
+				ci=step_div(i,hnx);
+				if(hash_check(i-hnx*ci,j-hny*cj,k-hnz*ck,x-px2-ci*bx,y-py2,z-pz,w)) {
+					pi=ci;pj=cj;pk=ck;
+				}
+			}
+		}
+	}
+	if(w<0) return false;
+	ijk=reg[w];q=regp[w];
+	return true;
+}
+
+/** Searches for a network vertex within the tolerance of a given position,
+ * using the hash table, for a network built with the rectangular routines.
+ * All of the hash grid cells that overlap the tolerance region are scanned,
+ * which replaces the eight offset probes of safe_search_previous_rect(). If
+ * several vertices are found, the one that was added first is chosen.
+ * \param[in] (x,y,z) the position.
+ * \param[out] (ijk,q) the grid block and index of the vertex that is found.
+ * \param[out] (pi,pj,pk) the periodic image of the vertex that is found.
+ * \return True if a vertex is found, false otherwise. */
+bool voronoi_network::search_hash_rect(double x,double y,double z,int &ijk,int &q,int &pi,int &pj,int &pk) {
+	int ak=step_int((z-net_tol)*hzsp),bk=step_int((z+net_tol)*hzsp);
+	int ai,aj,bi,bj,i,j,k,ci,cj,ck,w=-1;
+	double px,py,pz,px2,py2;
+
+	for(k=ak;k<=bk;k++) {
+		ck=step_div(k,hnz);px=ck*bxz;py=ck*byz;pz=ck*bz;
+		aj=step_int((y-py-net_tol)*hysp);bj=step_int((y-py+net_tol)*hysp);
+		for(j=aj;j<=bj;j++) {
+			cj=step_div(j,hny);px2=px+cj*bxy;py2=py+cj*by;
+			ai=step_int((x-px2-net_tol)*hxsp);bi=step_int((x-px2+net_tol)*hxsp);
+			for(i=ai;i<=bi;i++) {
+				ci=step_div(i,hnx);
+				if(hash_check(i-hnx*ci,j-hny*cj,k-hnz*ck,x-px2-ci*bx,y-py2,z-pz,w)) {
+					pi=ci;pj=cj;pk=ck;
+				}
+			}
+		}
+	}
+	if(w<0) return false;
+	ijk=reg[w];q=regp[w];
+	return true;
+}
+
+/** Checks the vertices in a hash grid cell against a position.
+ * \param[in] (mi,mj,mk) the hash grid cell.
+ * \param[in] (x,y,z) the position, relative to the periodic image being
+ *		      scanned.
+ * \param[in,out] w the earliest vertex found so far, or -1 if none has been
+ *		     found. It is updated if an earlier one is in this cell.
+ * \return True if w is updated, false otherwise. */
+inline bool voronoi_network::hash_check(int mi,int mj,int mk,double x,double y,double z,int &w) {
+	int s=hash_find(mi,mj,mk),v;
+	bool f=false;
+	if(s<0) return false;
+	double *pp;
+
+	// The vertices are listed with the most recently added first, so the
+	// last match in the list is the earliest one
+	for(v=hh[s];v>=0;v=hn[v]) {
+		pp=pts[reg[v]]+4*regp[v];
+		if(fabs(*pp-x)<net_tol&&fabs(pp[1]-y)<net_tol&&fabs(pp[2]-z)<net_tol&&(w<0||v<w)) {
+			w=v;f=true;
+		}
+	}
+	return f;
+}
+
+/** Finds the slot of a hash grid cell in the hash table, using linear probing.
+ * \param[in] (mi,mj,mk) the hash grid cell.
+ * \return The slot if the cell is in the table, or minus one minus the empty
+ * slot where it would be added otherwise. */
+inline int voronoi_network::hash_find(int mi,int mj,int mk) {
+	unsigned int h=((unsigned int) mi)*73856093u^((unsigned int) mj)*19349663u^((unsigned int) mk)*83492791u;
+	int s=int((h^(h>>16))&(hmem-1)),*kp;
+	while(hh[s]>=0) {
+		kp=hk+3*s;
+		if(*kp==mi&&kp[1]==mj&&kp[2]==mk) return s;
+		s=(s+1)&(hmem-1);
+	}
+	return -1-s;
+}
+
+/** Adds a network vertex to the hash table.
+ * \param[in] v the network vertex.
+ * \param[in] (mi,mj,mk) the hash grid cell of the vertex within the primary
+ *		      domain, which is clamped to the valid range in case of
+ *		      round-off. */
+void voronoi_network::hash_insert(int v,int mi,int mj,int mk) {
+	if(mi<0) mi=0;else if(mi>=hnx) mi=hnx-1;
+	if(mj<0) mj=0;else if(mj>=hny) mj=hny-1;
+	if(mk<0) mk=0;else if(mk>=hnz) mk=hnz-1;
+	int s=hash_find(mi,mj,mk);
+	if(s>=0) {hn[v]=hh[s];hh[s]=v;return;}
+
+	// Keep the table at most half full, so that the probe sequences
+	// remain short
+	if(2*(hc+1)>hmem) {add_hash_memory();s=hash_find(mi,mj,mk);}
+	s=-1-s;hc++;
+	hk[3*s]=mi;hk[3*s+1]=mj;hk[3*s+2]=mk;
+	hh[s]=v;hn[v]=-1;
+}
+
 /** Custom int function, that gives consistent stepping for negative numbers.
  * With normal int, we have (-1.5,-0.5,0.5,1.5) -> (-1,0,0,1).
  * With this routine, we have (-1.5,-0.5,0.5,1.5) -> (-2,-1,0,1). */
@@ -529,9 +806,132 @@ inline int voronoi_network::step_div(int a,int b) {
 }
 
 // Explicit instantiation
-template voronoi_network::voronoi_network(container_periodic&, double);
-template voronoi_network::voronoi_network(container_periodic_poly&, double);
+/** Adds all of the Voronoi cells stored in a buffer to the network, in the
+ * order that they were stored.
+ * \param[in] nb a reference to the buffer.
+ * \param[in] rectangular whether to use the rectangular network routines. */
+void voronoi_network::add_buffer(network_cell_buffer &nb,bool rectangular) {
+	network_cell c;
+	std::vector<int*> edp;
+	int i,l,*ep(nb.ed.empty()?NULL:&nb.ed[0]);
+	double *pp;
+	for(i=0;i<nb.n;i++) {
+		c.p=nb.vo[i+1]-nb.vo[i];
+		if(c.p==0) continue;
+		c.pts=&nb.pts[4*nb.vo[i]];
+		c.nu=&nb.nu[nb.vo[i]];
+		edp.resize(c.p);
+		for(l=0;l<c.p;l++) {edp[l]=ep;ep+=c.nu[l];}
+		c.ed=&edp[0];
+		pp=&nb.pos[4*i];
+		if(rectangular) add_to_network_rectangular(c,nb.id[i],*pp,pp[1],pp[2],pp[3]);
+		else add_to_network(c,nb.id[i],*pp,pp[1],pp[2],pp[3]);
+	}
+}
+
+#ifdef _OPENMP
+/** Merges a buffer of Voronoi cells into a network, and optionally into a
+ * second rectangular network, and then frees the buffer.
+ * \param[in] vn a reference to the network.
+ * \param[in] rvn a pointer to the rectangular network, or NULL if there is
+ *		   none.
+ * \param[in] nb a pointer to the buffer.
+ * \param[in,out] vvol the total volume, to which the volume of the cells in
+ *		       the buffer is added. */
+static void merge_buffer(voronoi_network &vn,voronoi_network *rvn,network_cell_buffer *nb,double &vvol) {
+	vn.add_buffer(*nb);
+	if(rvn!=NULL) rvn->add_buffer(*nb,true);
+	vvol+=nb->vol;
+	delete nb;
+}
+#endif
+
+/** Computes all of the Voronoi cells in a periodic container and adds them to
+ * the network. If several threads are used, then all of the periodic images
+ * are first created, and the blocks of the primary domain are shared out among
+ * the threads by a block_scheduler. Each thread computes the cells in a chunk
+ * of blocks and stores them in a network_cell_buffer. The buffers are merged
+ * into the network in chunk order, by whichever thread finds the next buffer
+ * complete, so the network does not depend on the number of threads.
+ * \param[in] con a reference to the container.
+ * \param[in] nt the number of threads to use. If this is one, then the cells
+ *		are computed serially using the c_loop_all_periodic ordering. If
+ *		this is zero, then the OpenMP default number of threads is
+ *		used.
+ * \param[in] rvn a pointer to a second network to add the cells to with the
+ *		 rectangular routines, or NULL if there is none.
+ * \return The total volume of the Voronoi cells. */
+template<class c_class>
+double voronoi_network::add_all_cells(c_class &con,int nt,voronoi_network *rvn) {
+	double vvol=0;
+	nt=voro_threads(nt);
+#ifdef _OPENMP
+	if(nt>1) {
+		con.create_all_images(nt);
+		block_scheduler bs(con,nt);
+		network_cell_buffer **nb=new network_cell_buffer*[bs.nc];
+		int *done=new int[bs.nc],nf=0;
+		for(int i=0;i<bs.nc;i++) done[i]=0;
+		omp_lock_t lk;
+		omp_init_lock(&lk);
+#pragma omp parallel num_threads(nt) VOROPP_BIND
+		{
+			voronoicell c(con);
+			voro_compute<c_class> *vcl=con.new_compute();
+			c_loop_parallel vl(con,bs,omp_get_thread_num());
+			network_cell_buffer *b;
+			voro_id id;int d;double x,y,z,r;
+			while(vl.start_chunk()) {
+				b=new network_cell_buffer;
+				do if(con.compute_cell(c,vl,*vcl)) {
+					vl.pos(id,x,y,z,r);
+					b->store(c,id,x,y,z,r);
+				} while(vl.inc_chunk());
+				nb[vl.chunk]=b;
+#pragma omp flush
+#pragma omp atomic write
+				done[vl.chunk]=1;
+
+				// Merge any consecutive completed chunks, unless
+				// another thread is already doing so
+				if(omp_test_lock(&lk)) {
+					while(nf<bs.nc) {
+#pragma omp atomic read
+						d=done[nf];
+						if(!d) break;
+#pragma omp flush
+						merge_buffer(*this,rvn,nb[nf],vvol);
+						nf++;
+					}
+					omp_unset_lock(&lk);
+				}
+			}
+			delete vcl;
+		}
+		while(nf<bs.nc) {merge_buffer(*this,rvn,nb[nf],vvol);nf++;}
+		omp_destroy_lock(&lk);
+		delete [] done;
+		delete [] nb;
+		return vvol;
+	}
+#endif
+	voro_id id;double x,y,z,r;
+	voronoicell c(con);
+	c_loop_all_periodic vl(con);
+	if(vl.start()) do if(con.compute_cell(c,vl)) {
+		vvol+=c.volume();
+		vl.pos(id,x,y,z,r);
+		add_to_network(c,id,x,y,z,r);
+		if(rvn!=NULL) rvn->add_to_network_rectangular(c,id,x,y,z,r);
+	} while(vl.inc());
+	return vvol;
+}
+
+template voronoi_network::voronoi_network(container_periodic&, double, bool);
+template voronoi_network::voronoi_network(container_periodic_poly&, double, bool);
 template void voronoi_network::add_to_network<voronoicell>(voronoicell&, int, double, double, double, double);
 template void voronoi_network::add_to_network<voronoicell_neighbor>(voronoicell_neighbor&, int, double, double, double, double);
 template void voronoi_network::add_to_network_rectangular<voronoicell>(voronoicell&, int, double, double, double, double);
 template void voronoi_network::add_to_network_rectangular<voronoicell_neighbor>(voronoicell_neighbor&, int, double, double, double, double);
+template double voronoi_network::add_all_cells(container_periodic&,int,voronoi_network*);
+template double voronoi_network::add_all_cells(container_periodic_poly&,int,voronoi_network*);
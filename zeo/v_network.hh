@@ -10,6 +10,87 @@ const int init_network_edge_memory=4;
 const int init_network_vertex_memory=64;
 const int max_network_vertex_memory=65536;
 
+/** The initial number of slots in the hash table that is used to look up
+ * network vertices, which must be a power of two. */
+const int init_network_hash_memory=1024;
+
+/** The average number of network vertices that the hash grid cells are sized
+ * to hold when the hashed vertex lookup is used. A Voronoi tessellation of
+ * randomly positioned particles has around seven vertices per particle, which
+ * is used to estimate the number of vertices from the number of particles. */
+const double network_hash_cell_vertices=1.5;
+
+/** The number of hash grid cells that each grid block is split into along
+ * each axis if the container is empty when the network is set up. */
+const int network_hash_refine=4;
+
+/** The maximum number of hash grid cells that each grid block is split into
+ * along each axis, which keeps the hash grid cell indices well within the
+ * range of an integer. */
+const int max_network_hash_refine=64;
+
+/** The size of the buffer used by the network_text_buffer class. */
+const int network_buffer_size=1<<16;
+
+/** \brief A buffer for writing text output.
+ *
+ * This class collects text in a large memory buffer, which is written to the
+ * output stream with a single call each time that it fills up. Integers are
+ * converted directly, which avoids the overhead of a separate fprintf call
+ * for every number in the network output. */
+class network_text_buffer {
+	public:
+		network_text_buffer(FILE *fp_) : fp(fp_), buf(new char[network_buffer_size]), bp(buf) {}
+		~network_text_buffer() {
+			flush();
+			delete [] buf;
+		}
+		/** Adds a string to the buffer.
+		 * \param[in] s the string to add. */
+		inline void put(const char *s) {
+			while(*s!=0) *(bp++)=*(s++);
+			check();
+		}
+		/** Adds a single character to the buffer.
+		 * \param[in] c the character to add. */
+		inline void put(char c) {*(bp++)=c;}
+		/** Adds an integer to the buffer, in the same format as the
+		 * %d conversion.
+		 * \param[in] n the integer to add. */
+		inline void put_int(int n) {
+			char t[12],*tp=t;
+			unsigned int u=n<0?0u-(unsigned int) n:(unsigned int) n;
+			if(n<0) *(bp++)='-';
+			do {*(tp++)='0'+u%10;u/=10;} while(u>0);
+			while(tp>t) *(bp++)=*(--tp);
+			check();
+		}
+		/** Adds a floating point number to the buffer, in the same
+		 * format as the %g conversion.
+		 * \param[in] x the number to add. */
+		inline void put_double(double x) {
+			bp+=sprintf(bp,"%g",x);
+			check();
+		}
+		/** Writes the contents of the buffer to the output stream. */
+		inline void flush() {
+			fwrite(buf,1,bp-buf,fp);
+			bp=buf;
+		}
+	private:
+		/** The output stream. */
+		FILE *fp;
+		/** The memory buffer. */
+		char *buf;
+		/** A pointer to the next free character in the buffer. */
+		char *bp;
+		/** Flushes the buffer if there is not enough space left to
+		 * safely add another number. */
+		inline void check() {
+			if(bp>buf+network_buffer_size-256) flush();
+		}
+};
+
 struct block {
 	double dis;
 	double e;
@@ -19,6 +100,74 @@ struct block {
 		else if(v<e) {e=v;dis=d;}
 	}
 	inline void print(FILE *fp) {fprintf(fp," %g %g",e,dis);}
+	inline void print(network_text_buffer &tb) {
+		tb.put(' ');tb.put_double(e);
+		tb.put(' ');tb.put_double(dis);
+	}
+};
+
+/** \brief A lightweight view of a Voronoi cell.
+ *
+ * This structure exposes the vertex positions and the edge table of a Voronoi
+ * cell in the same form as the voronoicell class, so that a cell stored in a
+ * network_cell_buffer can be passed to the network construction routines. */
+struct network_cell {
+	/** The number of vertices. */
+	int p;
+	/** The vertex positions, in the same format as voronoicell::pts. */
+	fpoint *pts;
+	/** The order of each vertex. */
+	int *nu;
+	/** The edge table, in the same format as voronoicell::ed, but
+	 * without the back pointers. */
+	int **ed;
+};
+
+/** \brief A buffer of computed Voronoi cells.
+ *
+ * This class stores the parts of a sequence of Voronoi cells that are needed
+ * to add them to a Voronoi network. It is used when the cells are computed by
+ * several threads, so that they can be merged into a network afterwards in a
+ * fixed order. */
+class network_cell_buffer {
+	public:
+		/** The number of cells stored. */
+		int n;
+		/** The total volume of the stored cells. */
+		double vol;
+		/** The particle IDs of the cells. */
+		std::vector<int> id;
+		/** The particle positions and radii of the cells, in groups of
+		 * four. */
+		std::vector<double> pos;
+		/** The offsets of each cell's vertices into the nu array, with
+		 * one extra entry marking the end. */
+		std::vector<int> vo;
+		/** The vertex positions of all the cells. */
+		std::vector<fpoint> pts;
+		/** The vertex orders of all the cells. */
+		std::vector<int> nu;
+		/** The edge tables of all the cells. */
+		std::vector<int> ed;
+		network_cell_buffer() : n(0), vol(0), vo(1,0) {}
+		/** Stores a Voronoi cell in the buffer.
+		 * \param[in] c a reference to the Voronoi cell.
+		 * \param[in] idn the ID of the particle associated with the cell.
+		 * \param[in] (x,y,z) the position of the particle.
+		 * \param[in] rad the radius of the particle. */
+		template<class v_cell>
+		void store(v_cell &c,int idn,double x,double y,double z,double rad) {
+			vol+=c.volume();
+			id.push_back(idn);
+			pos.push_back(x);pos.push_back(y);pos.push_back(z);pos.push_back(rad);
+			pts.insert(pts.end(),c.pts,c.pts+4*c.p);
+			for(int l=0;l<c.p;l++) {
+				nu.push_back(c.nu[l]);
+				ed.insert(ed.end(),c.ed[l],c.ed[l]+c.nu[l]);
+			}
+			vo.push_back(vo.back()+c.p);
+			n++;
+		}
 };
 
 class voronoi_network {
@@ -51,15 +200,24 @@ class voronoi_network {
 		int *regp;
 		int *vmap;
 		int map_mem;
+		/** Whether vertices are looked up with a hash table of a finer
+		 * grid, rather than by scanning the grid blocks. */
+		const bool hashed;
 		template<class c_class>
-		voronoi_network(c_class &c,double net_tol_=tolerance);
+		voronoi_network(c_class &c,double net_tol_=tolerance,bool hashed_=false);
 		~voronoi_network();
 		void print_network(FILE *fp=stdout,bool reverse_remove=false);
 		inline void print_network(const char* filename,bool reverse_remove=false) {
 			FILE *fp(safe_fopen(filename,"w"));
-			print_network(fp);
+			print_network(fp,reverse_remove);
 			fclose(fp);
 		}
+		void print_network_binary(FILE *fp,bool reverse_remove=false);
+		inline void print_network_binary(const char* filename,bool reverse_remove=false) {
+			FILE *fp(safe_fopen(filename,"wb"));
+			print_network_binary(fp,reverse_remove);
+			if(fclose(fp)!=0) voro_fatal_error("Error writing the binary network file",VOROPP_FILE_ERROR);
+		}
 		void draw_network(FILE *fp=stdout);
 		inline void draw_network(const char* filename) {
 			FILE *fp(safe_fopen(filename,"w"));
@@ -87,6 +245,9 @@ class voronoi_network {
 			add_to_network_rectangular_internal(c,idn,x,y,z,rad,vmap);
 		}
 
+		void add_buffer(network_cell_buffer &nb,bool rectangular=false);
+		template<class c_class>
+		double add_all_cells(c_class &con,int nt=1,voronoi_network *rvn=NULL);
 		void clear_network();
 	private:
 		inline int step_div(int a,int b);
@@ -104,6 +265,28 @@ class voronoi_network {
 		bool search_previous(double gx,double gy,double x,double y,double z,int &ijk,int &q,int &ci,int &cj,int &ck);
 		bool safe_search_previous_rect(double x,double y,double z,int &ijk,int &q,int &ci,int &cj,int &ck);
 		bool search_previous_rect(double x,double y,double z,int &ijk,int &q,int &ci,int &cj,int &ck);
+		bool search_hash(double gx,double gy,double x,double y,double z,int &ijk,int &q,int &ci,int &cj,int &ck);
+		bool search_hash_rect(double x,double y,double z,int &ijk,int &q,int &ci,int &cj,int &ck);
+		inline bool hash_check(int mi,int mj,int mk,double x,double y,double z,int &w);
+		inline int hash_find(int mi,int mj,int mk);
+		void hash_insert(int v,int mi,int mj,int mk);
+		void add_hash_memory();
+		/** The number of hash grid cells along each axis. */
+		int hnx,hny,hnz;
+		/** The inverse widths of the hash grid cells. */
+		double hxsp,hysp,hzsp;
+		/** The number of slots in the hash table. */
+		int hmem;
+		/** The number of occupied slots in the hash table. */
+		int hc;
+		/** The hash grid cell of each slot, in groups of three. */
+		int *hk;
+		/** The most recently added network vertex of each slot, or -1
+		 * if the slot is empty. */
+		int *hh;
+		/** The next network vertex in the same hash grid cell, for
+		 * each network vertex, or -1 at the end of the list. */
+		int *hn;
 		template<class v_cell>
 		void add_to_network_internal(v_cell &c,int idn,double x,double y,double z,double rad,int *cmap);
 		template<class v_cell>